@@ -0,0 +1,42 @@
+# usage
+# cmake -DOBJDUMP=<objdump> -DOBJDIR=<object directory of the library>
+#       -DKERNELS=<kernel>|<kernel>... -DPATTERNS=<regex>|<regex>... -P check_hwloops.cmake
+#
+# Disassembles the object file of every kernel and fails when one of the
+# patterns is missing from it, by default an lp.setup hardware loop and a
+# post-increment load. The whole object is searched because the loops may
+# sit in a static helper of the kernel that the compiler did not inline.
+
+string(REPLACE "|" ";" KERNELS "${KERNELS}")
+string(REPLACE "|" ";" PATTERNS "${PATTERNS}")
+
+file(GLOB_RECURSE objects "${OBJDIR}/*.o" "${OBJDIR}/*.obj")
+
+foreach(kernel ${KERNELS})
+    set(object "")
+    foreach(candidate ${objects})
+        get_filename_component(name ${candidate} NAME)
+        if(name MATCHES "^${kernel}\\.c\\.(o|obj)$")
+            set(object ${candidate})
+        endif()
+    endforeach()
+
+    if(NOT object)
+        message(SEND_ERROR "check_hwloops: no object file for ${kernel} under ${OBJDIR}")
+        continue()
+    endif()
+
+    execute_process(COMMAND ${OBJDUMP} -d ${object}
+        OUTPUT_VARIABLE disassembly
+        RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(SEND_ERROR "check_hwloops: ${OBJDUMP} failed on ${object}")
+        continue()
+    endif()
+
+    foreach(pattern ${PATTERNS})
+        if(NOT disassembly MATCHES "${pattern}")
+            message(SEND_ERROR "check_hwloops: ${kernel} does not match '${pattern}' in its disassembly")
+        endif()
+    endforeach()
+endforeach()
@@ -0,0 +1,32 @@
+# usage
+# cmake -DNM=<nm> -DLIB=<library> -P check_softfloat.cmake
+#
+# Lists the undefined symbols of the library and fails when one of them is
+# a soft-float routine of libgcc (__addsf3, __muldf3, __fixsfsi, ...) or a
+# libm function, calls that take hundreds of cycles on a core without F.
+
+execute_process(COMMAND ${NM} -u ${LIB}
+    OUTPUT_VARIABLE symbols
+    RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "check_softfloat: ${NM} failed on ${LIB}")
+endif()
+
+set(softfloat "^__((add|sub|mul|div|neg)[sdt]f3|(fix|fixuns)[sdt]f[sdt]i|float(un)?[sdt]i[sdt]f|extend[sd]f[dt]f2|trunc[dt]f[sd]f2|(eq|ne|lt|le|gt|ge|unord|cmp)[sdt]f2)$")
+set(libm "^(sqrt|cbrt|hypot|sin|cos|tan|asin|acos|atan|atan2|sinh|cosh|tanh|exp|exp2|expm1|log|log2|log10|log1p|pow|floor|ceil|round|lround|llround|rint|lrint|trunc|fabs|fmod|fmin|fmax|ldexp|frexp|modf)[fl]?$")
+
+string(REPLACE "\n" ";" symbols "${symbols}")
+set(found "")
+foreach(line ${symbols})
+    string(REGEX REPLACE "^.*[ \t]" "" symbol "${line}")
+    string(REGEX REPLACE "@.*$" "" symbol "${symbol}")
+    if(symbol MATCHES "${softfloat}" OR symbol MATCHES "${libm}")
+        list(APPEND found ${symbol})
+    endif()
+endforeach()
+
+if(found)
+    list(REMOVE_DUPLICATES found)
+    string(REPLACE ";" ", " found "${found}")
+    message(FATAL_ERROR "check_softfloat: ${LIB} calls ${found}")
+endif()
@@ -43,6 +43,49 @@
 
 #include "riscv_math.h"
 
+/* CFFT lengths whose tables are in the library: all of them, or those of
+   RISCV_DSP_FFT_SIZES when CMake generates the tables (riscv_fft_sizes.h) */
+#if defined (RISCV_FFT_SIZES_CONFIG)
+#include RISCV_FFT_SIZES_CONFIG
+#else
+#define RISCV_DSP_FFT_LEN_16    1
+#define RISCV_DSP_FFT_LEN_32    1
+#define RISCV_DSP_FFT_LEN_64    1
+#define RISCV_DSP_FFT_LEN_128   1
+#define RISCV_DSP_FFT_LEN_256   1
+#define RISCV_DSP_FFT_LEN_512   1
+#define RISCV_DSP_FFT_LEN_1024  1
+#define RISCV_DSP_FFT_LEN_2048  1
+#define RISCV_DSP_FFT_LEN_4096  1
+#endif
+#define RISCV_DSP_FFT_LEN(N)  RISCV_DSP_FFT_LEN_##N
+
+/* Longest CFFT length in the library, a transform of length N can take every
+   (RISCV_DSP_FFT_LEN_MAX/N)-th twiddle factor of its tables */
+#if RISCV_DSP_FFT_LEN_4096
+#define RISCV_DSP_FFT_LEN_MAX  4096
+#elif RISCV_DSP_FFT_LEN_2048
+#define RISCV_DSP_FFT_LEN_MAX  2048
+#elif RISCV_DSP_FFT_LEN_1024
+#define RISCV_DSP_FFT_LEN_MAX  1024
+#elif RISCV_DSP_FFT_LEN_512
+#define RISCV_DSP_FFT_LEN_MAX  512
+#elif RISCV_DSP_FFT_LEN_256
+#define RISCV_DSP_FFT_LEN_MAX  256
+#elif RISCV_DSP_FFT_LEN_128
+#define RISCV_DSP_FFT_LEN_MAX  128
+#elif RISCV_DSP_FFT_LEN_64
+#define RISCV_DSP_FFT_LEN_MAX  64
+#elif RISCV_DSP_FFT_LEN_32
+#define RISCV_DSP_FFT_LEN_MAX  32
+#else
+#define RISCV_DSP_FFT_LEN_MAX  16
+#endif
+
+/* Table of a length given by a macro, RISCV_DSP_FFT_TABLE(twiddleCoef_, RISCV_DSP_FFT_LEN_MAX, _q15) */
+#define RISCV_DSP_FFT_TABLE(PREFIX, N, SUFFIX)   RISCV_DSP_FFT_TABLE_(PREFIX, N, SUFFIX)
+#define RISCV_DSP_FFT_TABLE_(PREFIX, N, SUFFIX)  PREFIX##N##SUFFIX
+
 extern const uint16_t riscvBitRevTable[1024];
 extern const q15_t riscvRecipTableQ15[64];
 extern const q31_t riscvRecipTableQ31[64];
@@ -84,6 +127,119 @@ extern const float32_t twiddleCoef_rfft_512[512];
 extern const float32_t twiddleCoef_rfft_1024[1024];
 extern const float32_t twiddleCoef_rfft_2048[2048];
 extern const float32_t twiddleCoef_rfft_4096[4096];
+extern const q31_t twiddleCoef_rfft_32_q31[32];
+extern const q31_t twiddleCoef_rfft_64_q31[64];
+extern const q31_t twiddleCoef_rfft_128_q31[128];
+extern const q31_t twiddleCoef_rfft_256_q31[256];
+extern const q31_t twiddleCoef_rfft_512_q31[512];
+extern const q31_t twiddleCoef_rfft_1024_q31[1024];
+extern const q31_t twiddleCoef_rfft_2048_q31[2048];
+extern const q31_t twiddleCoef_rfft_4096_q31[4096];
+
+/* quarter-wave twiddle tables, cos(2*pi*i/N) for i = 0..N/4, see RISCV_MATH_COMPACT_TWIDDLE */
+extern const float32_t twiddleCoefQuarter_16[5];
+extern const float32_t twiddleCoefQuarter_32[9];
+extern const float32_t twiddleCoefQuarter_64[17];
+extern const float32_t twiddleCoefQuarter_128[33];
+extern const float32_t twiddleCoefQuarter_256[65];
+extern const float32_t twiddleCoefQuarter_512[129];
+extern const float32_t twiddleCoefQuarter_1024[257];
+extern const float32_t twiddleCoefQuarter_2048[513];
+extern const float32_t twiddleCoefQuarter_4096[1025];
+
+extern const q15_t twiddleCoefQuarter_16_q15[5];
+extern const q15_t twiddleCoefQuarter_32_q15[9];
+extern const q15_t twiddleCoefQuarter_64_q15[17];
+extern const q15_t twiddleCoefQuarter_128_q15[33];
+extern const q15_t twiddleCoefQuarter_256_q15[65];
+extern const q15_t twiddleCoefQuarter_512_q15[129];
+extern const q15_t twiddleCoefQuarter_1024_q15[257];
+extern const q15_t twiddleCoefQuarter_2048_q15[513];
+extern const q15_t twiddleCoefQuarter_4096_q15[1025];
+
+/* twiddle table of the fftLen = N floating-point and Q15 CFFT */
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+#define RISCV_CFFT_TWIDDLE_F32(N) twiddleCoefQuarter_##N
+#define RISCV_CFFT_TWIDDLE_Q15(N) twiddleCoefQuarter_##N##_q15
+#else
+#define RISCV_CFFT_TWIDDLE_F32(N) twiddleCoef_##N
+#define RISCV_CFFT_TWIDDLE_Q15(N) twiddleCoef_##N##_q15
+#endif
+
+/* mode flags of the floating-point radix-8 kernels, the inverse transform runs the forward
+   butterflies on the input with its real and imaginary parts swapped and swaps the output back */
+#define RISCV_RADIX8_SWAP_IN   0x1u    /* the first stage reads (imag, real) pairs */
+#define RISCV_RADIX8_SWAP_OUT  0x2u    /* the last stage writes (imag, real) pairs */
+#define RISCV_RADIX8_SCALE     0x4u    /* the first stage multiplies its inputs by the scale argument */
+
+/*
+* Reads twiddle factor k, cos(2*pi*k/(4*qLen)) and sin(2*pi*k/(4*qLen)), from a quarter-wave
+* table of qLen+1 values, 0 <= k < 4*qLen.  The sin value and the other quadrants are
+* folded from the first quadrant.
+*/
+static inline void riscv_twiddle_fold_f32(
+  const float32_t * pTab,
+  uint32_t qLen,
+  uint32_t k,
+  float32_t * pCos,
+  float32_t * pSin)
+{
+  if(k <= qLen)
+  {
+    *pCos = pTab[k];
+    *pSin = pTab[qLen - k];
+  }
+  else if(k <= (2u * qLen))
+  {
+    k -= qLen;
+    *pCos = -pTab[qLen - k];
+    *pSin = pTab[k];
+  }
+  else if(k <= (3u * qLen))
+  {
+    k -= 2u * qLen;
+    *pCos = -pTab[k];
+    *pSin = -pTab[qLen - k];
+  }
+  else
+  {
+    k -= 3u * qLen;
+    *pCos = pTab[qLen - k];
+    *pSin = -pTab[k];
+  }
+}
+
+static inline void riscv_twiddle_fold_q15(
+  const q15_t * pTab,
+  uint32_t qLen,
+  uint32_t k,
+  q15_t * pCos,
+  q15_t * pSin)
+{
+  if(k <= qLen)
+  {
+    *pCos = pTab[k];
+    *pSin = pTab[qLen - k];
+  }
+  else if(k <= (2u * qLen))
+  {
+    k -= qLen;
+    *pCos = (q15_t) -pTab[qLen - k];
+    *pSin = pTab[k];
+  }
+  else if(k <= (3u * qLen))
+  {
+    k -= 2u * qLen;
+    *pCos = (q15_t) -pTab[k];
+    *pSin = (q15_t) -pTab[qLen - k];
+  }
+  else
+  {
+    k -= 3u * qLen;
+    *pCos = pTab[qLen - k];
+    *pSin = (q15_t) -pTab[k];
+  }
+}
 
 
 /* floating-point bit reversal tables */
@@ -132,5 +288,143 @@ extern const uint16_t riscvBitRevIndexTable_fixed_4096[RISCVBITREVINDEXTABLE_FIX
 extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
 extern const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1];
 extern const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1];
+extern const float32_t sinTableQuarter64_f32[FAST_MATH_QUARTER_TABLE_SIZE + 3];
+extern const q31_t sinTableQuarter64_q31[FAST_MATH_QUARTER_TABLE_SIZE + 3];
+
+/* Sine of a phase in turns, with turns in [-0.5 1.5): minimax odd polynomial of degree 7 in the
+ * quarter turns z, |error| < 8e-7 with the f32 rounding.  The RISCV_MATH_SIN_COS_POLY tier of riscv_sin_f32(). */
+static inline float32_t riscv_sin_poly_f32(
+  float32_t turns)
+{
+  float32_t z, z2;
+
+  /* Fold to a quarter wave around 0, z in [-1 1] */
+  if(turns >= 0.5f)
+  {
+    turns -= 1.0f;
+  }
+  if(turns > 0.25f)
+  {
+    turns = 0.5f - turns;
+  }
+  else if(turns < -0.25f)
+  {
+    turns = -0.5f - turns;
+  }
+  z = 4.0f * turns;
+  z2 = z * z;
+
+  return (z * (1.570791011e+00f + z2 * (-6.458928495e-01f + z2 * (7.943434462e-02f + z2 * -4.333095293e-03f))));
+}
+
+/* Sine of a phase in turns, with turns in [-0.5 1.5): quadratic interpolation of the 64 intervals
+ * of sinTableQuarter64_f32, |error| < 1.2e-6.  The RISCV_MATH_SIN_COS_TABLE64 tier of riscv_sin_f32(). */
+static inline float32_t riscv_sin_table64_f32(
+  float32_t turns)
+{
+  float32_t z, s, f, y0, y1, y2, y;
+  uint32_t i;
+
+  if(turns >= 0.5f)
+  {
+    turns -= 1.0f;
+  }
+  if(turns > 0.25f)
+  {
+    turns = 0.5f - turns;
+  }
+  else if(turns < -0.25f)
+  {
+    turns = -0.5f - turns;
+  }
+  z = 4.0f * turns;
+
+  /* Interval and position in the interval of |z| */
+  s = ((z < 0.0f) ? -z : z) * (float32_t) FAST_MATH_QUARTER_TABLE_SIZE;
+  i = (uint32_t) s;
+  f = s - (float32_t) i;
+  y0 = sinTableQuarter64_f32[i];
+  y1 = sinTableQuarter64_f32[i + 1u];
+  y2 = sinTableQuarter64_f32[i + 2u];
+
+  /* Newton forward form through the 3 points */
+  y = y0 + f * ((y1 - y0) + 0.5f * (f - 1.0f) * ((y2 - y1) - (y1 - y0)));
+
+  return ((z < 0.0f) ? -y : y);
+}
+
+/* Sine of a phase in Q32 turns: minimax odd polynomial of degree 9 in the quarter turns z,
+ * evaluated in Q30, |error| < 1e-8.  The RISCV_MATH_SIN_COS_POLY tier of riscv_sin_q31(). */
+static inline q31_t riscv_sin_poly_q31(
+  uint32_t phase)
+{
+  q31_t z = (q31_t) phase;                       /* Q30 quarter turns once folded */
+  q31_t z2, acc;
+
+  /* Fold to a quarter wave around 0, z in [-1 1] */
+  if((z > 0x40000000) || (z < -0x40000000))
+  {
+    z = (q31_t) (0x80000000u - phase);
+  }
+  z2 = (q31_t) (((q63_t) z * z) >> 30);
+
+  acc = 161942;
+  acc = -5016767 + (q31_t) (((q63_t) acc * z2) >> 30);
+  acc = 85564854 + (q31_t) (((q63_t) acc * z2) >> 30);
+  acc = -693597876 + (q31_t) (((q63_t) acc * z2) >> 30);
+  acc = 1686629674 + (q31_t) (((q63_t) acc * z2) >> 30);
+
+  return (clip_q63_to_q31(((q63_t) acc * z) >> 29));
+}
+
+/* Sine of a phase in Q32 turns: quadratic interpolation of the 64 intervals of
+ * sinTableQuarter64_q31, |error| < 1e-6.  The RISCV_MATH_SIN_COS_TABLE64 tier of riscv_sin_q31(). */
+static inline q31_t riscv_sin_table64_q31(
+  uint32_t phase)
+{
+  q31_t z = (q31_t) phase;
+  q31_t s, f, y0, y1, y2, d1;
+  q63_t d2, y;
+  uint32_t i;
+
+  if((z > 0x40000000) || (z < -0x40000000))
+  {
+    z = (q31_t) (0x80000000u - phase);
+  }
+
+  /* |z| in Q30: 64 intervals of 2^24, the position in the interval in Q31 */
+  s = (z < 0) ? -z : z;
+  i = (uint32_t) s >> 24;
+  f = (s & 0x00FFFFFF) << 7;
+  y0 = sinTableQuarter64_q31[i];
+  y1 = sinTableQuarter64_q31[i + 1u];
+  y2 = sinTableQuarter64_q31[i + 2u];
+
+  /* y0 + f*((y1 - y0) + (f - 1)/2*(y2 - 2*y1 + y0)) */
+  d1 = y1 - y0;
+  d2 = (q63_t) y2 - 2 * (q63_t) y1 + y0;
+  d1 += (q31_t) ((((q63_t) f - 0x80000000LL) * d2) >> 32);
+  y = y0 + (((q63_t) f * d1) >> 31);
+  y = clip_q63_to_q31(y);
+
+  return ((z < 0) ? (q31_t) -y : (q31_t) y);
+}
+
+#if defined (RISCV_MATH_SIN_COS_POLY)
+#define riscv_sin_tier_f32 riscv_sin_poly_f32
+#define riscv_sin_tier_q31 riscv_sin_poly_q31
+#elif defined (RISCV_MATH_SIN_COS_TABLE64)
+#define riscv_sin_tier_f32 riscv_sin_table64_f32
+#define riscv_sin_tier_q31 riscv_sin_table64_q31
+#endif
+
+/* Table for the Newton-Raphson seed of the Q15 and Q31 square root */
+extern const q15_t invSqrtTable_q15[48];
+
+/* Tables for the fast atan2, logarithm and exponential */
+extern const q31_t atanTable_q31[31];
+extern const q31_t logRecipTable_q31[32];
+extern const q31_t logTable_q31[32];
+extern const q31_t exp2Table_q31[32];
 
 #endif /*  RISCV_COMMON_TABLES_H */
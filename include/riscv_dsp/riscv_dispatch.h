@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dispatch.h
+*
+* Description:  Run-time selection between the scalar and the xpulp
+*               variants of the hot Q15/Q7 kernels.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+/*
+* USE_DSP_RISCV selects the xpulp kernels at compile time, so a firmware
+* built against riscv_cmsis_dsp_lib_xpulp does not run on cores without the
+* PULP extension (Ibex, Zero-riscy) and one built against riscv_cmsis_dsp_lib
+* leaves the SIMD units of RI5CY idle.  riscv_cmsis_dsp_lib_dispatch holds
+* both: the kernels of RISCV_DISPATCH_KERNELS are compiled once as
+* <name>_scalar and once with USE_DSP_RISCV as <name>_xpulp, and <name>
+* jumps through a table of function pointers that riscv_dispatch_init()
+* points at the variant the core supports.  Every other function of the
+* library is the scalar one.
+*
+*   #include <riscv_dsp/riscv_dispatch.h>
+*
+*   riscv_dispatch_init();                       // once, before the kernels
+*   riscv_fir_q15(&S, pSrc, pDst, blockSize);    // scalar or xpulp
+*
+* Until riscv_dispatch_init() or riscv_dispatch_select() is called the table
+* holds the scalar kernels.  After it a call costs one load of the function
+* pointer and one indirect jump, the entry points are tail calls.  The
+* instance structures of the listed kernels are the same in both variants.
+*
+* The table is one variable, riscv_dispatch_table_ in the section
+* .data.riscv_dispatch_table_.  When cores with and without the extension
+* run the library at the same time, the linker script must place that
+* section in memory private to each core and each core calls
+* riscv_dispatch_init().
+*
+* The build compiles the sources of the listed kernels with this header
+* forced in first and RISCV_DISPATCH_SUFFIX defined to _scalar or _xpulp,
+* which renames the kernels and the helpers they share with each other.
+*/
+
+#ifndef _RISCV_DISPATCH_H
+#define _RISCV_DISPATCH_H
+
+#if defined (RISCV_DISPATCH_SUFFIX)
+#define RISCV_DISPATCH_CAT_(A, B)      A##B
+#define RISCV_DISPATCH_CAT(A, B)       RISCV_DISPATCH_CAT_(A, B)
+#define RISCV_DISPATCH_RENAME(NAME)    RISCV_DISPATCH_CAT(NAME, RISCV_DISPATCH_SUFFIX)
+
+/* Dispatched kernels */
+#define riscv_dot_prod_q15                       RISCV_DISPATCH_RENAME(riscv_dot_prod_q15)
+#define riscv_dot_prod_q7                        RISCV_DISPATCH_RENAME(riscv_dot_prod_q7)
+#define riscv_mult_q15                           RISCV_DISPATCH_RENAME(riscv_mult_q15)
+#define riscv_add_q15                            RISCV_DISPATCH_RENAME(riscv_add_q15)
+#define riscv_scale_q15                          RISCV_DISPATCH_RENAME(riscv_scale_q15)
+#define riscv_power_q15                          RISCV_DISPATCH_RENAME(riscv_power_q15)
+#define riscv_fir_q15                            RISCV_DISPATCH_RENAME(riscv_fir_q15)
+#define riscv_fir_fast_q15                       RISCV_DISPATCH_RENAME(riscv_fir_fast_q15)
+#define riscv_fir_q7                             RISCV_DISPATCH_RENAME(riscv_fir_q7)
+#define riscv_biquad_cascade_df1_q15             RISCV_DISPATCH_RENAME(riscv_biquad_cascade_df1_q15)
+#define riscv_cmplx_mult_cmplx_q15               RISCV_DISPATCH_RENAME(riscv_cmplx_mult_cmplx_q15)
+#define riscv_cmplx_mag_q15                      RISCV_DISPATCH_RENAME(riscv_cmplx_mag_q15)
+#define riscv_mat_vec_mult_q15                   RISCV_DISPATCH_RENAME(riscv_mat_vec_mult_q15)
+#define riscv_cfft_q15                           RISCV_DISPATCH_RENAME(riscv_cfft_q15)
+#define riscv_cfft_oop_q15                       RISCV_DISPATCH_RENAME(riscv_cfft_oop_q15)
+#define riscv_cfft_batch_q15                     RISCV_DISPATCH_RENAME(riscv_cfft_batch_q15)
+#define riscv_cfft_bfp_q15                       RISCV_DISPATCH_RENAME(riscv_cfft_bfp_q15)
+#define riscv_cfft_radix4_q15                    RISCV_DISPATCH_RENAME(riscv_cfft_radix4_q15)
+
+/* Helpers defined and called only by the sources of the kernels above */
+#define riscv_cfft_radix4by2_q15                 RISCV_DISPATCH_RENAME(riscv_cfft_radix4by2_q15)
+#define riscv_cfft_radix4by2_oop_q15             RISCV_DISPATCH_RENAME(riscv_cfft_radix4by2_oop_q15)
+#define riscv_cfft_radix4by2_inverse_q15         RISCV_DISPATCH_RENAME(riscv_cfft_radix4by2_inverse_q15)
+#define riscv_cfft_radix4by2_inverse_oop_q15     RISCV_DISPATCH_RENAME(riscv_cfft_radix4by2_inverse_oop_q15)
+#define riscv_radix4_butterfly_q15               RISCV_DISPATCH_RENAME(riscv_radix4_butterfly_q15)
+#define riscv_radix4_butterfly_inverse_q15       RISCV_DISPATCH_RENAME(riscv_radix4_butterfly_inverse_q15)
+#define riscv_radix4_butterfly_oop_q15           RISCV_DISPATCH_RENAME(riscv_radix4_butterfly_oop_q15)
+#define riscv_radix4_butterfly_inverse_oop_q15   RISCV_DISPATCH_RENAME(riscv_radix4_butterfly_inverse_oop_q15)
+#define riscv_radix4_butterfly_batch_q15         RISCV_DISPATCH_RENAME(riscv_radix4_butterfly_batch_q15)
+#define riscv_radix4_butterfly_inverse_batch_q15 RISCV_DISPATCH_RENAME(riscv_radix4_butterfly_inverse_batch_q15)
+#endif /* RISCV_DISPATCH_SUFFIX */
+
+#include "riscv_math.h"
+
+#ifdef	__cplusplus
+extern "C"
+{
+#endif
+
+/*
+* X(name, parameters, arguments) for every dispatched kernel, the renames
+* above and RISCV_DSP_DISPATCH_SOURCES of CMakeLists.txt must match it.
+*/
+#define RISCV_DISPATCH_KERNELS(X)                                                                          \
+  X(riscv_dot_prod_q15, (q15_t * pSrcA, q15_t * pSrcB, uint32_t blockSize, q63_t * result),                \
+    (pSrcA, pSrcB, blockSize, result))                                                                     \
+  X(riscv_dot_prod_q7, (q7_t * pSrcA, q7_t * pSrcB, uint32_t blockSize, q31_t * result),                   \
+    (pSrcA, pSrcB, blockSize, result))                                                                     \
+  X(riscv_mult_q15, (q15_t * pSrcA, q15_t * pSrcB, q15_t * pDst, uint32_t blockSize),                      \
+    (pSrcA, pSrcB, pDst, blockSize))                                                                       \
+  X(riscv_add_q15, (q15_t * pSrcA, q15_t * pSrcB, q15_t * pDst, uint32_t blockSize),                       \
+    (pSrcA, pSrcB, pDst, blockSize))                                                                       \
+  X(riscv_scale_q15, (q15_t * pSrc, q15_t scaleFract, int8_t shift, q15_t * pDst, uint32_t blockSize),     \
+    (pSrc, scaleFract, shift, pDst, blockSize))                                                            \
+  X(riscv_power_q15, (q15_t * pSrc, uint32_t blockSize, q63_t * pResult),                                  \
+    (pSrc, blockSize, pResult))                                                                            \
+  X(riscv_fir_q15, (const riscv_fir_instance_q15 * S, q15_t * pSrc, q15_t * pDst, uint32_t blockSize),     \
+    (S, pSrc, pDst, blockSize))                                                                            \
+  X(riscv_fir_fast_q15, (const riscv_fir_instance_q15 * S, q15_t * pSrc, q15_t * pDst, uint32_t blockSize), \
+    (S, pSrc, pDst, blockSize))                                                                            \
+  X(riscv_fir_q7, (const riscv_fir_instance_q7 * S, q7_t * pSrc, q7_t * pDst, uint32_t blockSize),         \
+    (S, pSrc, pDst, blockSize))                                                                            \
+  X(riscv_biquad_cascade_df1_q15,                                                                          \
+    (const riscv_biquad_casd_df1_inst_q15 * S, q15_t * pSrc, q15_t * pDst, uint32_t blockSize),            \
+    (S, pSrc, pDst, blockSize))                                                                            \
+  X(riscv_cmplx_mult_cmplx_q15, (q15_t * pSrcA, q15_t * pSrcB, q15_t * pDst, uint32_t numSamples),         \
+    (pSrcA, pSrcB, pDst, numSamples))                                                                      \
+  X(riscv_cmplx_mag_q15, (q15_t * pSrc, q15_t * pDst, uint32_t numSamples),                                \
+    (pSrc, pDst, numSamples))                                                                              \
+  X(riscv_mat_vec_mult_q15, (const riscv_matrix_instance_q15 * pSrcMat, q15_t * pVec, q15_t * pDst),       \
+    (pSrcMat, pVec, pDst))                                                                                 \
+  X(riscv_cfft_q15, (const riscv_cfft_instance_q15 * S, q15_t * p1, uint8_t ifftFlag,                      \
+    uint8_t bitReverseFlag), (S, p1, ifftFlag, bitReverseFlag))                                            \
+  X(riscv_cfft_oop_q15, (const riscv_cfft_instance_q15 * S, const q15_t * pSrc, q15_t * pDst,              \
+    uint8_t ifftFlag, uint8_t bitReverseFlag), (S, pSrc, pDst, ifftFlag, bitReverseFlag))                  \
+  X(riscv_cfft_batch_q15, (const riscv_cfft_instance_q15 * S, q15_t * p1, uint16_t numChannels,            \
+    uint8_t ifftFlag, uint8_t bitReverseFlag), (S, p1, numChannels, ifftFlag, bitReverseFlag))             \
+  X(riscv_cfft_bfp_q15, (const riscv_cfft_instance_q15 * S, riscv_bfp_q15 * pBlock, uint8_t ifftFlag,      \
+    uint8_t bitReverseFlag), (S, pBlock, ifftFlag, bitReverseFlag))                                        \
+  X(riscv_cfft_radix4_q15, (const riscv_cfft_radix4_instance_q15 * S, q15_t * pSrc),                       \
+    (S, pSrc))
+
+  /**
+   * @brief Kernel variants of riscv_cmsis_dsp_lib_dispatch.
+   */
+  typedef enum
+  {
+    RISCV_DISPATCH_SCALAR = 0,   /**< RV32IMFC kernels, run on every core. */
+    RISCV_DISPATCH_XPULP = 1     /**< USE_DSP_RISCV kernels, need the PULP extension (RI5CY). */
+  } riscv_dispatch_isa;
+
+  /**
+   * @brief  Variant the executing core supports, from the X bit of misa.
+   * @return RISCV_DISPATCH_XPULP when misa reports non-standard extensions, RISCV_DISPATCH_SCALAR otherwise.
+   */
+  riscv_dispatch_isa riscv_dispatch_detect(void);
+
+  /**
+   * @brief  Points the dispatched kernels at the variant riscv_dispatch_detect() reports.
+   * @return the selected variant.
+   */
+  riscv_dispatch_isa riscv_dispatch_init(void);
+
+  /**
+   * @brief  Points the dispatched kernels at a variant, for cores whose misa does not tell.
+   * @param[in]  isa  variant to run, RISCV_DISPATCH_XPULP only on cores with the PULP extension.
+   */
+  void riscv_dispatch_select(
+  riscv_dispatch_isa isa);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif /* _RISCV_DISPATCH_H */
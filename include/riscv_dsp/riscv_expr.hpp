@@ -0,0 +1,422 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_expr.hpp
+*
+* Description:  C++17 expression templates that fuse chains of element-wise
+*               BasicMathFunctions into one loop.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+/*
+* riscv_expr::span<T> wraps a q7_t, q15_t, q31_t or float32_t buffer and
+* its length.  Arithmetic on spans and scalars builds an expression that
+* is only evaluated when it is assigned to a span, in one loop that reads
+* each input once and writes each output once:
+*
+*   riscv_expr::span<const q15_t> x(pSrc, blockSize);
+*   riscv_expr::span<q15_t> y(pDst, blockSize);
+*
+*   y = riscv_expr::clamp((a * x + b) >> 2, -8192, 8191);
+*
+* replaces riscv_scale_q15(), riscv_offset_q15(), riscv_shift_q15() and a
+* clip over temporaries, three full passes and two buffers.
+*
+* Every operation rounds and saturates to the sample type exactly as the
+* C kernel of the same operation, so the fused result is the result of
+* the chain of calls:
+*
+*   a + b, a - b     riscv_add_xxx(), riscv_sub_xxx(), riscv_offset_xxx()
+*   a * b            riscv_mult_xxx(), or riscv_scale_xxx() with shift 0
+*                    when one operand is a scalar
+*   scale(a, f, s)   riscv_scale_xxx() with scaleFract f and shift s
+*   a << n, a >> n   riscv_shift_xxx() by n and -n bits
+*   -a, abs(a)       riscv_negate_xxx(), riscv_abs_xxx()
+*   minimum, maximum, clamp   element-wise, never saturate
+*
+* A scalar operand is converted to the sample type of the expression, and
+* all operands of an expression must have the same sample type.  Operands
+* have at least as many samples as the span that is assigned; the output
+* may be one of the inputs.  Assigning a span to a span copies the samples
+* rather than the pointer.
+*
+* The loop uses the PULP builtins of the C kernels (clip, mulsN) and, with
+* USE_DSP_RISCV, stores Q15 outputs two and Q7 outputs four at a time with
+* pack2 and pack4, which needs a destination aligned to 4 bytes.  The
+* header is opt-in: the library stays plain C and nothing of it depends on
+* this file.
+*/
+
+#ifndef _RISCV_EXPR_HPP
+#define _RISCV_EXPR_HPP
+
+#if !defined (__cplusplus) || (__cplusplus < 201703L)
+#error "riscv_expr.hpp needs C++17"
+#endif
+
+#include <type_traits>
+#include "riscv_math.h"
+
+namespace riscv_expr
+{
+
+/*
+* Operations of one sample type, with the rounding and saturation of the
+* C kernels.  Q7 and Q15 compute in q31_t, Q31 in q63_t.
+*/
+template <typename T>
+struct sample;
+
+template <typename T, int BITS>
+struct sample_fixed
+{
+  static constexpr q31_t lo = -(1 << (BITS - 1));
+  static constexpr q31_t hi = (1 << (BITS - 1)) - 1;
+
+  static inline T sat(q31_t x)
+  {
+#if defined (USE_DSP_RISCV)
+    return (T) clip(x, lo, hi);
+#else
+    return (T) __SSAT(x, BITS);
+#endif
+  }
+
+  static inline T add(T a, T b) { return sat((q31_t) a + b); }
+  static inline T sub(T a, T b) { return sat((q31_t) a - b); }
+
+  static inline T mul(T a, T b)
+  {
+#if defined (USE_DSP_RISCV)
+    return sat(mulsN(a, b, BITS - 1));
+#else
+    return sat(((q31_t) a * b) >> (BITS - 1));
+#endif
+  }
+
+  static inline T scale(T a, T fract, int8_t shift) { return sat(((q31_t) a * fract) >> ((BITS - 1) - shift)); }
+  static inline T shift(T a, int8_t n) { return (n >= 0) ? sat((q31_t) a << n) : (T) (a >> -n); }
+  static inline T neg(T a) { return (a == (T) lo) ? (T) hi : (T) -a; }
+  static inline T abs(T a) { return (a > 0) ? a : neg(a); }
+};
+
+template <>
+struct sample<q7_t> : sample_fixed<q7_t, 8> {};
+
+template <>
+struct sample<q15_t> : sample_fixed<q15_t, 16> {};
+
+template <>
+struct sample<q31_t>
+{
+  static inline q31_t add(q31_t a, q31_t b) { return clip_q63_to_q31((q63_t) a + b); }
+  static inline q31_t sub(q31_t a, q31_t b) { return clip_q63_to_q31((q63_t) a - b); }
+  static inline q31_t mul(q31_t a, q31_t b) { return clip_q63_to_q31(((q63_t) a * b) >> 31); }
+
+  static inline q31_t scale(q31_t a, q31_t fract, int8_t shift)
+  {
+    q31_t in = (q31_t) (((q63_t) a * fract) >> 32);
+    int32_t k = shift + 1;
+
+    return (k >= 0) ? clip_q63_to_q31((q63_t) in << k) : (in >> -k);
+  }
+
+  static inline q31_t shift(q31_t a, int8_t n) { return (n >= 0) ? clip_q63_to_q31((q63_t) a << n) : (a >> -n); }
+  static inline q31_t neg(q31_t a) { return (a == INT32_MIN) ? INT32_MAX : -a; }
+  static inline q31_t abs(q31_t a) { return (a > 0) ? a : neg(a); }
+};
+
+template <>
+struct sample<float32_t>
+{
+  static inline float32_t add(float32_t a, float32_t b) { return a + b; }
+  static inline float32_t sub(float32_t a, float32_t b) { return a - b; }
+  static inline float32_t mul(float32_t a, float32_t b) { return a * b; }
+  static inline float32_t neg(float32_t a) { return -a; }
+  static inline float32_t abs(float32_t a) { return (a < 0.0f) ? -a : a; }
+};
+
+/* Base of every expression, marks the types the operators apply to */
+struct expr_base {};
+
+template <typename E>
+constexpr bool is_expr = std::is_base_of_v<expr_base, E>;
+
+template <typename E, bool = is_expr<E>>
+struct value_of
+{
+  typedef void type;
+};
+
+template <typename E>
+struct value_of<E, true>
+{
+  typedef typename E::value_type type;
+};
+
+/* Sample type of an expression of A and B, one of which may be a scalar */
+template <typename A, typename B>
+using value_t = std::conditional_t<is_expr<A>, typename value_of<A>::type, typename value_of<B>::type>;
+
+template <typename T, typename E>
+inline void assign(T * pDst, uint32_t blockSize, const E & e);
+
+/* Buffer of blockSize samples */
+template <typename T>
+class span : public expr_base
+{
+public:
+  typedef std::remove_const_t<T> value_type;
+
+  span(T * pData, uint32_t blockSize) : pData_(pData), blockSize_(blockSize) {}
+
+  span(const span & other) = default;
+
+  inline value_type operator[](uint32_t i) const { return pData_[i]; }
+  inline T * data() const { return pData_; }
+  inline uint32_t size() const { return blockSize_; }
+
+  /* Evaluates e into the samples, the span keeps pointing at the same buffer */
+  template <typename E, typename = std::enable_if_t<is_expr<E>>>
+  span & operator=(const E & e)
+  {
+    static_assert(!std::is_const_v<T>, "riscv_expr: assignment to a span of const samples");
+    assign(pData_, blockSize_, e);
+    return *this;
+  }
+
+  span & operator=(const span & other)
+  {
+    static_assert(!std::is_const_v<T>, "riscv_expr: assignment to a span of const samples");
+    assign(pData_, blockSize_, other);
+    return *this;
+  }
+
+private:
+  T *pData_;
+  uint32_t blockSize_;
+};
+
+/* Scalar operand, the same value for every sample */
+template <typename T>
+class constant : public expr_base
+{
+public:
+  typedef T value_type;
+
+  explicit constant(T value) : value_(value) {}
+
+  inline T operator[](uint32_t) const { return value_; }
+
+private:
+  T value_;
+};
+
+/* Element-wise operation of two operands of the same sample type */
+template <typename Op, typename A, typename B>
+class binary : public expr_base
+{
+public:
+  typedef typename A::value_type value_type;
+
+  static_assert(std::is_same_v<value_type, typename B::value_type>,
+                "riscv_expr: operands of different sample types");
+
+  binary(const A & a, const B & b) : a_(a), b_(b) {}
+
+  inline value_type operator[](uint32_t i) const { return Op::apply(a_[i], b_[i]); }
+
+private:
+  A a_;
+  B b_;
+};
+
+/* Element-wise operation of one operand and the parameters of Op */
+template <typename Op, typename A>
+class unary : public expr_base
+{
+public:
+  typedef typename A::value_type value_type;
+
+  unary(const A & a, const Op & op) : a_(a), op_(op) {}
+
+  inline value_type operator[](uint32_t i) const { return op_(a_[i]); }
+
+private:
+  A a_;
+  Op op_;
+};
+
+struct add_op
+{
+  template <typename T> static inline T apply(T a, T b) { return sample<T>::add(a, b); }
+};
+
+struct sub_op
+{
+  template <typename T> static inline T apply(T a, T b) { return sample<T>::sub(a, b); }
+};
+
+struct mul_op
+{
+  template <typename T> static inline T apply(T a, T b) { return sample<T>::mul(a, b); }
+};
+
+struct min_op
+{
+  template <typename T> static inline T apply(T a, T b) { return (a < b) ? a : b; }
+};
+
+struct max_op
+{
+  template <typename T> static inline T apply(T a, T b) { return (a > b) ? a : b; }
+};
+
+struct neg_op
+{
+  template <typename T> inline T operator()(T a) const { return sample<T>::neg(a); }
+};
+
+struct abs_op
+{
+  template <typename T> inline T operator()(T a) const { return sample<T>::abs(a); }
+};
+
+template <typename T>
+struct shift_op
+{
+  int8_t bits;
+  inline T operator()(T a) const { return sample<T>::shift(a, bits); }
+};
+
+template <typename T>
+struct scale_op
+{
+  T fract;
+  int8_t shift;
+  inline T operator()(T a) const { return sample<T>::scale(a, fract, shift); }
+};
+
+template <typename T>
+struct clamp_op
+{
+  T lo;
+  T hi;
+  inline T operator()(T a) const { return (a < lo) ? lo : ((a > hi) ? hi : a); }
+};
+
+/* An expression as it is, a scalar as a constant of sample type T */
+template <typename T, typename S>
+inline auto operand(const S & s)
+{
+  if constexpr (is_expr<S>)
+  {
+    return s;
+  }
+  else
+  {
+    return constant<T>((T) s);
+  }
+}
+
+template <typename Op, typename A, typename B>
+inline auto make_binary(const A & a, const B & b)
+{
+  typedef value_t<A, B> T;
+  typedef decltype(operand<T>(a)) EA;
+  typedef decltype(operand<T>(b)) EB;
+
+  return binary<Op, EA, EB>(operand<T>(a), operand<T>(b));
+}
+
+template <typename A, typename B, typename = std::enable_if_t<is_expr<A> || is_expr<B>>>
+inline auto operator+(const A & a, const B & b) { return make_binary<add_op>(a, b); }
+
+template <typename A, typename B, typename = std::enable_if_t<is_expr<A> || is_expr<B>>>
+inline auto operator-(const A & a, const B & b) { return make_binary<sub_op>(a, b); }
+
+template <typename A, typename B, typename = std::enable_if_t<is_expr<A> || is_expr<B>>>
+inline auto operator*(const A & a, const B & b) { return make_binary<mul_op>(a, b); }
+
+template <typename A, typename B, typename = std::enable_if_t<is_expr<A> || is_expr<B>>>
+inline auto minimum(const A & a, const B & b) { return make_binary<min_op>(a, b); }
+
+template <typename A, typename B, typename = std::enable_if_t<is_expr<A> || is_expr<B>>>
+inline auto maximum(const A & a, const B & b) { return make_binary<max_op>(a, b); }
+
+template <typename A, typename = std::enable_if_t<is_expr<A>>>
+inline auto operator-(const A & a) { return unary<neg_op, A>(a, neg_op()); }
+
+template <typename A, typename = std::enable_if_t<is_expr<A>>>
+inline auto abs(const A & a) { return unary<abs_op, A>(a, abs_op()); }
+
+template <typename A, typename = std::enable_if_t<is_expr<A>>>
+inline auto operator<<(const A & a, int bits)
+{
+  typedef typename A::value_type T;
+
+  static_assert(!std::is_floating_point_v<T>, "riscv_expr: shift of floating-point samples");
+  return unary<shift_op<T>, A>(a, shift_op<T>{ (int8_t) bits });
+}
+
+template <typename A, typename = std::enable_if_t<is_expr<A>>>
+inline auto operator>>(const A & a, int bits)
+{
+  typedef typename A::value_type T;
+
+  static_assert(!std::is_floating_point_v<T>, "riscv_expr: shift of floating-point samples");
+  return unary<shift_op<T>, A>(a, shift_op<T>{ (int8_t) -bits });
+}
+
+template <typename A, typename F, typename = std::enable_if_t<is_expr<A>>>
+inline auto scale(const A & a, F fract, int8_t shift)
+{
+  typedef typename A::value_type T;
+
+  static_assert(!std::is_floating_point_v<T>, "riscv_expr: scale with a shift of floating-point samples");
+  return unary<scale_op<T>, A>(a, scale_op<T>{ (T) fract, shift });
+}
+
+template <typename A, typename L, typename H, typename = std::enable_if_t<is_expr<A>>>
+inline auto clamp(const A & a, L lo, H hi)
+{
+  typedef typename A::value_type T;
+
+  return unary<clamp_op<T>, A>(a, clamp_op<T>{ (T) lo, (T) hi });
+}
+
+/*
+* Evaluates e into blockSize samples at pDst, the fused loop.
+*/
+template <typename T, typename E>
+inline void assign(T * pDst, uint32_t blockSize, const E & e)
+{
+  static_assert(std::is_same_v<T, typename E::value_type>, "riscv_expr: output of another sample type");
+  uint32_t i = 0u;
+
+#if defined (USE_DSP_RISCV)
+  if constexpr (std::is_same_v<T, q15_t>)
+  {
+    for (; (i + 1u) < blockSize; i += 2u)
+    {
+      *(shortV *) &pDst[i] = pack2(e[i], e[i + 1u]);
+    }
+  }
+  else if constexpr (std::is_same_v<T, q7_t>)
+  {
+    for (; (i + 3u) < blockSize; i += 4u)
+    {
+      *(charV *) &pDst[i] = pack4(e[i], e[i + 1u], e[i + 2u], e[i + 3u]);
+    }
+  }
+#endif
+
+  for (; i < blockSize; i++)
+  {
+    pDst[i] = e[i];
+  }
+}
+
+} /* namespace riscv_expr */
+
+#endif /* _RISCV_EXPR_HPP */
@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_fixed.h
+*
+* Description:  Generators of FIR kernels specialized for a fixed number
+*               of taps, optionally with the coefficients compiled in.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+/*
+* RISCV_FIR_FIXED_F32(name, numTaps, coeffs), RISCV_FIR_FIXED_Q31(...) and
+* RISCV_FIR_FIXED_Q15(...) define a function
+*
+*   void name(const riscv_fir_instance_xxx * S, xxx_t * pSrc, xxx_t * pDst, uint32_t blockSize);
+*
+* with the semantics of riscv_fir_xxx() for an instance of numTaps taps.
+* The tap count is a constant, so the tap loop is unrolled completely and
+* has no remainder.  coeffs is the coefficient array the kernel reads:
+*
+* - S->pCoeffs reads the coefficients of the instance, as riscv_fir_xxx();
+* - the name of a const array of numTaps coefficients lets the compiler
+*   use the values as constants instead of loading them.
+*
+* The library instantiates the kernels for the tap counts of the CMake
+* cache variable RISCV_DSP_FIR_FIXED_TAPS, and riscv_fir_init_xxx() stores
+* the one for numTaps in S->pKernel.  A kernel defined by the application
+* is selected by assigning it to S->pKernel after the init function:
+*
+*   static const q15_t lowpass[63] = { ... };
+*   RISCV_FIR_FIXED_Q15(lowpass_q15, 63, lowpass)
+*
+*   riscv_fir_init_q15(&S, 63, (q15_t *) lowpass, state, blockSize);
+*   S.pKernel = lowpass_q15;
+*
+* Every output sums its taps in the order of riscv_fir_xxx(), so the
+* results are the same.  Four outputs are computed per pass and the
+* 0 to 3 remaining outputs of the block one at a time.  Fully unrolled
+* kernels grow with the tap count, about 4 instructions per tap and
+* output of a pass, so only the tap counts actually used should be
+* instantiated.
+*/
+
+#ifndef _RISCV_FIR_FIXED_H
+#define _RISCV_FIR_FIXED_H
+
+#include "riscv_math.h"
+
+/* Complete unrolling of the tap loops, the constant trip count alone only
+   lets older compilers peel short loops */
+#if defined (__GNUC__) && (__GNUC__ >= 8)
+#define RISCV_FIR_FIXED_UNROLL  _Pragma("GCC unroll 256")
+#else
+#define RISCV_FIR_FIXED_UNROLL
+#endif
+
+/*
+* Body shared by the three types: T is the sample type, A the accumulator
+* type, MAC(acc, x, c) accumulates one product and OUT(acc) converts an
+* accumulator to a sample.
+*/
+#define RISCV_FIR_FIXED_BODY(T, A, NUM_TAPS, COEFFS, MAC, OUT)                       \
+{                                                                                    \
+  const T *pb = (const T *) (COEFFS);              /* Coefficients */                \
+  T *pState = S->pState;                           /* Oldest sample of the window */ \
+  T *pStateCurnt = S->pState + ((NUM_TAPS) - 1u);  /* Where new samples go */        \
+  T *px;                                                                             \
+  T x0, x1, x2, x3;                                                                  \
+  A acc0, acc1, acc2, acc3;                                                          \
+  uint32_t blkCnt, k;                                                                \
+                                                                                     \
+  for (blkCnt = blockSize >> 2u; blkCnt > 0u; blkCnt--)                              \
+  {                                                                                  \
+    *pStateCurnt++ = *pSrc++;                                                        \
+    *pStateCurnt++ = *pSrc++;                                                        \
+    *pStateCurnt++ = *pSrc++;                                                        \
+    *pStateCurnt++ = *pSrc++;                                                        \
+                                                                                     \
+    acc0 = 0;                                                                        \
+    acc1 = 0;                                                                        \
+    acc2 = 0;                                                                        \
+    acc3 = 0;                                                                        \
+    px = pState;                                                                     \
+    x0 = px[0];                                                                      \
+    x1 = px[1];                                                                      \
+    x2 = px[2];                                                                      \
+                                                                                     \
+    /* Once unrolled, the rotation of x0 ... x3 is only register renaming */         \
+    RISCV_FIR_FIXED_UNROLL                                                           \
+    for (k = 0u; k < (NUM_TAPS); k++)                                                \
+    {                                                                                \
+      x3 = px[k + 3u];                                                               \
+      MAC(acc0, x0, pb[k]);                                                          \
+      MAC(acc1, x1, pb[k]);                                                          \
+      MAC(acc2, x2, pb[k]);                                                          \
+      MAC(acc3, x3, pb[k]);                                                          \
+      x0 = x1;                                                                       \
+      x1 = x2;                                                                       \
+      x2 = x3;                                                                       \
+    }                                                                                \
+                                                                                     \
+    *pDst++ = OUT(acc0);                                                             \
+    *pDst++ = OUT(acc1);                                                             \
+    *pDst++ = OUT(acc2);                                                             \
+    *pDst++ = OUT(acc3);                                                             \
+    pState += 4;                                                                     \
+  }                                                                                  \
+                                                                                     \
+  for (blkCnt = blockSize & 3u; blkCnt > 0u; blkCnt--)                               \
+  {                                                                                  \
+    *pStateCurnt++ = *pSrc++;                                                        \
+                                                                                     \
+    acc0 = 0;                                                                        \
+    RISCV_FIR_FIXED_UNROLL                                                           \
+    for (k = 0u; k < (NUM_TAPS); k++)                                                \
+    {                                                                                \
+      MAC(acc0, pState[k], pb[k]);                                                   \
+    }                                                                                \
+                                                                                     \
+    *pDst++ = OUT(acc0);                                                             \
+    pState++;                                                                        \
+  }                                                                                  \
+                                                                                     \
+  /* Keep the last numTaps - 1 samples for the next call */                          \
+  pStateCurnt = S->pState;                                                           \
+  for (k = 0u; k < ((NUM_TAPS) - 1u); k++)                                           \
+  {                                                                                  \
+    *pStateCurnt++ = *pState++;                                                      \
+  }                                                                                  \
+}
+
+#define RISCV_FIR_FIXED_MAC_F32(ACC, X, C)  ((ACC) += (X) * (C))
+#define RISCV_FIR_FIXED_OUT_F32(ACC)        (ACC)
+#define RISCV_FIR_FIXED_MAC_Q31(ACC, X, C)  ((ACC) += (q63_t) (X) * (C))
+#define RISCV_FIR_FIXED_OUT_Q31(ACC)        ((q31_t) ((ACC) >> 31u))
+#define RISCV_FIR_FIXED_MAC_Q15(ACC, X, C)  ((ACC) += (q31_t) (X) * (C))
+#define RISCV_FIR_FIXED_OUT_Q15(ACC)        ((q15_t) __SSAT(((ACC) >> 15u), 16))
+
+/**
+ * @brief Defines a floating-point FIR kernel for NUM_TAPS taps reading COEFFS.
+ */
+#define RISCV_FIR_FIXED_F32(NAME, NUM_TAPS, COEFFS)                                  \
+void NAME(                                                                           \
+  const riscv_fir_instance_f32 * S,                                                  \
+  float32_t * pSrc,                                                                  \
+  float32_t * pDst,                                                                  \
+  uint32_t blockSize)                                                                \
+RISCV_FIR_FIXED_BODY(float32_t, float32_t, NUM_TAPS, COEFFS, RISCV_FIR_FIXED_MAC_F32, RISCV_FIR_FIXED_OUT_F32)
+
+/**
+ * @brief Defines a Q31 FIR kernel for NUM_TAPS taps reading COEFFS, 2.62 accumulators as riscv_fir_q31().
+ */
+#define RISCV_FIR_FIXED_Q31(NAME, NUM_TAPS, COEFFS)                                  \
+void NAME(                                                                           \
+  const riscv_fir_instance_q31 * S,                                                  \
+  q31_t * pSrc,                                                                      \
+  q31_t * pDst,                                                                      \
+  uint32_t blockSize)                                                                \
+RISCV_FIR_FIXED_BODY(q31_t, q63_t, NUM_TAPS, COEFFS, RISCV_FIR_FIXED_MAC_Q31, RISCV_FIR_FIXED_OUT_Q31)
+
+/**
+ * @brief Defines a Q15 FIR kernel for NUM_TAPS taps reading COEFFS, 64-bit accumulators as riscv_fir_q15().
+ * Unlike riscv_fir_q15(), any tap count is supported.
+ */
+#define RISCV_FIR_FIXED_Q15(NAME, NUM_TAPS, COEFFS)                                  \
+void NAME(                                                                           \
+  const riscv_fir_instance_q15 * S,                                                  \
+  q15_t * pSrc,                                                                      \
+  q15_t * pDst,                                                                      \
+  uint32_t blockSize)                                                                \
+RISCV_FIR_FIXED_BODY(q15_t, q63_t, NUM_TAPS, COEFFS, RISCV_FIR_FIXED_MAC_Q15, RISCV_FIR_FIXED_OUT_Q15)
+
+#endif /* _RISCV_FIR_FIXED_H */
@@ -134,8 +134,8 @@
  * There is an associated initialization function for each type of matrix
  * data structure.
  * The initialization function sets the values of the internal structure fields.
- * Refer to the function <code>riscv_mat_init_f32()</code>, <code>riscv_mat_init_q31()</code>
- * and <code>riscv_mat_init_q15()</code> for floating-point, Q31 and Q15 types,  respectively.
+ * Refer to the function <code>riscv_mat_init_f32()</code>, <code>riscv_mat_init_q31()</code>,
+ * <code>riscv_mat_init_q15()</code> and <code>riscv_mat_init_q7()</code> for floating-point, Q31, Q15 and Q7 types,  respectively.
  *
  * \par
  * Use of the initialization function is optional. However, if initialization function is used
@@ -197,6 +197,20 @@
  * bilinear interpolation is used for 2-dimensional data.
  */
 
+/**
+ * @defgroup groupParallel Parallel Functions
+ * These functions split the matrix multiplication, FIR filter, convolution and complex FFT
+ * across the cores of a PULP cluster.  The cores are started through the fork hook of
+ * riscv_par_instance, see \ref ParallelFork.
+ */
+
+/**
+ * @defgroup groupNN Neural Network Functions
+ * Fully-connected, convolution and pooling layers, activations and softmax on q7 and q15 data,
+ * with the requantization to the output format fused into the layers.  The interfaces follow
+ * CMSIS-NN.
+ */
+
 /**
  * @defgroup groupExamples Examples
  */
@@ -212,9 +226,70 @@
 extern "C"
 {
 #endif
-/*To use DSP extension*/
+/*To use DSP extension define USE_DSP_RISCV, the riscv_cmsis_dsp_lib_xpulp CMake target does it for the library and its users*/
 //#define USE_DSP_RISCV 
 
+/*To store the floating-point and Q15 CFFT twiddle factors as quarter-wave tables define RISCV_MATH_COMPACT_TWIDDLE, the RISCV_DSP_COMPACT_TWIDDLE CMake option does it for both libraries*/
+//#define RISCV_MATH_COMPACT_TWIDDLE
+
+/*To build kernels for size define RISCV_MATH_COMPACT, the RISCV_DSP_COMPACT CMake variable does it for the sources of the chosen function families*/
+//#define RISCV_MATH_COMPACT
+
+/*
+*Loop unrolling: the kernels with a compact variant run their 4x unrolled loops under RISCV_MATH_LOOPUNROLL
+*and a plain loop, which the compiler turns into a hardware loop, without it.
+*/
+#if !defined (RISCV_MATH_COMPACT)
+#define RISCV_MATH_LOOPUNROLL
+#endif
+
+/*To record the calls, cycles and stalls of every public kernel define RISCV_DSP_PROFILE, the RISCV_DSP_PROFILE CMake option does it for both libraries*/
+//#define RISCV_DSP_PROFILE
+
+/*To count the values each saturating fixed-point kernel clips and record their peak define RISCV_DSP_SAT_STATS, the RISCV_DSP_SAT_STATS CMake option does it for both libraries*/
+//#define RISCV_DSP_SAT_STATS
+
+/*To place the twiddle, bit reversal and sine tables or the hottest kernels in fast memory (TCDM/L1) define RISCV_DSP_FAST_TWIDDLE, RISCV_DSP_FAST_BITREV, RISCV_DSP_FAST_SINE or RISCV_DSP_FAST_KERNELS, the RISCV_DSP_FAST_PLACEMENT CMake variable does it for both libraries*/
+//#define RISCV_DSP_FAST_TWIDDLE
+
+/*
+*Placement of tables and kernels: RISCV_DSP_SECTION(base, name) puts one object in the section base.name, so
+*that --gc-sections still drops it when it is unused and the linker script collects the group with *(base.*).
+*RISCV_DSP_FASTDATA(group, name) and RISCV_DSP_FASTCODE(name) use RISCV_DSP_FASTDATA_SECTION and
+*RISCV_DSP_FASTCODE_SECTION for the groups RISCV_DSP_FAST_<group> enables and are empty otherwise.
+*/
+#ifndef RISCV_DSP_FASTDATA_SECTION
+#define RISCV_DSP_FASTDATA_SECTION  ".fastdata"
+#endif
+#ifndef RISCV_DSP_FASTCODE_SECTION
+#define RISCV_DSP_FASTCODE_SECTION  ".fastcode"
+#endif
+
+#define RISCV_DSP_SECTION(BASE, NAME)  __attribute__((section(BASE "." #NAME)))
+
+#if defined (RISCV_DSP_FAST_TWIDDLE)
+#define RISCV_DSP_FASTDATA_TWIDDLE(NAME)  RISCV_DSP_SECTION(RISCV_DSP_FASTDATA_SECTION, NAME)
+#else
+#define RISCV_DSP_FASTDATA_TWIDDLE(NAME)
+#endif
+#if defined (RISCV_DSP_FAST_BITREV)
+#define RISCV_DSP_FASTDATA_BITREV(NAME)   RISCV_DSP_SECTION(RISCV_DSP_FASTDATA_SECTION, NAME)
+#else
+#define RISCV_DSP_FASTDATA_BITREV(NAME)
+#endif
+#if defined (RISCV_DSP_FAST_SINE)
+#define RISCV_DSP_FASTDATA_SINE(NAME)     RISCV_DSP_SECTION(RISCV_DSP_FASTDATA_SECTION, NAME)
+#else
+#define RISCV_DSP_FASTDATA_SINE(NAME)
+#endif
+#define RISCV_DSP_FASTDATA(GROUP, NAME)   RISCV_DSP_FASTDATA_##GROUP(NAME)
+
+#if defined (RISCV_DSP_FAST_KERNELS)
+#define RISCV_DSP_FASTCODE(NAME)          RISCV_DSP_SECTION(RISCV_DSP_FASTCODE_SECTION, NAME)
+#else
+#define RISCV_DSP_FASTCODE(NAME)
+#endif
+
 
 /*
 *Risc-v DSP built-ins
@@ -231,6 +306,8 @@ extern "C"
 #define dotpv4(a, b)                  __builtin_pulp_dotsp4(a, b)
 #define dotpv2(a, b)                  __builtin_pulp_dotsp2(a, b)
 #define shufflev4(a, b, c)            __builtin_pulp_shuffle2h(a, b, c)
+#define shuffleb(a, b)                __builtin_pulp_shuffleb(a, b)
+#define shuffle2b(a, b, c)            __builtin_pulp_shuffle4b(a, b, c)
 #define mac(a, b, c)                  __builtin_pulp_mac(a, b, c)
 #define muls(a, b)                    __builtin_pulp_muls(a, b)
 #define abs2(a)                       __builtin_pulp_abs2(a)
@@ -246,7 +323,10 @@ extern "C"
 #define sll2(a,b)                    __builtin_pulp_sll2(a,b)
 #define max4(a,b)                    __builtin_pulp_max4(a,b)
 #define min4(a,b)                    __builtin_pulp_min4(a,b)
+#define max2(a,b)                    __builtin_pulp_max2(a,b)
+#define min2(a,b)                    __builtin_pulp_min2(a,b)
 #define macsRN(a,b,c,d,e)            __builtin_pulp_macsRN(a,b,c,d,e)
+#define fl1(a)                       __builtin_pulp_fl1(a)
 
 typedef signed char charV __attribute__((vector_size (4)));
 typedef signed short shortV __attribute__((vector_size (4)));
@@ -263,9 +343,20 @@ typedef signed short shortV __attribute__((vector_size (4)));
 
   /**
    * @brief Macros required for SINE and COSINE Fast math approximations
+   *
+   * riscv_sin_*, riscv_cos_* and riscv_sin_cos_f32/q31 have three accuracy tiers, chosen at build time
+   * (CMake RISCV_DSP_SIN_COS).  Errors are the largest over the period, measured on the host
+   * by tests/Benchmark_FastMathFunctions2; the Q15 functions round the Q31 result in the last two tiers.
+   * - default, FAST_MATH_TABLE_SIZE: linear interpolation of the 512-entry sinTable_*, 2 KB for f32
+   *   and Q31, 1 KB for Q15, error 2e-5, 2 loads and 2 multiplies.
+   * - RISCV_MATH_SIN_COS_TABLE64: quadratic interpolation of the 64 intervals of a quarter wave,
+   *   sinTableQuarter64_f32/q31, 268 bytes per type, error 1.2e-6, 3 loads and 3 multiplies.
+   * - RISCV_MATH_SIN_COS_POLY: minimax polynomial without a table, degree 7 for f32 (error 8e-7,
+   *   5 multiplies) and 9 for Q31 (error 1e-8, 6 multiplies).
    */
 
 #define FAST_MATH_TABLE_SIZE  512
+#define FAST_MATH_QUARTER_TABLE_SIZE  64
 #define FAST_MATH_Q31_SHIFT   (32 - 10)
 #define FAST_MATH_Q15_SHIFT   (16 - 10)
 #define CONTROLLER_Q31_SHIFT  (32 - 9)
@@ -294,7 +385,8 @@ typedef signed short shortV __attribute__((vector_size (4)));
     RISCV_MATH_SIZE_MISMATCH = -3,         /**< Size of matrices is not compatible with the operation. */
     RISCV_MATH_NANINF = -4,                /**< Not-a-number (NaN) or infinity is generated */
     RISCV_MATH_SINGULAR = -5,              /**< Generated by matrix inversion if the input matrix is singular and cannot be inverted. */
-    RISCV_MATH_TEST_FAILURE = -6           /**< Test Failed  */
+    RISCV_MATH_TEST_FAILURE = -6,          /**< Test Failed  */
+    RISCV_MATH_DECOMPOSITION_FAILURE = -7  /**< Generated by matrix decompositions if the input matrix has no decomposition of the requested kind. */
   } riscv_status;
 
   /**
@@ -331,7 +423,7 @@ typedef signed short shortV __attribute__((vector_size (4)));
   /**
    * @brief Clips Q63 to Q31 values.
    */
-  inline q31_t clip_q63_to_q31(
+  static inline q31_t clip_q63_to_q31(
   q63_t x)
   {
     return ((q31_t) (x >> 32) != ((q31_t) x >> 31)) ?
@@ -341,7 +433,7 @@ typedef signed short shortV __attribute__((vector_size (4)));
   /**
    * @brief Clips Q63 to Q15 values.
    */
-  inline q15_t clip_q63_to_q15(
+  static inline q15_t clip_q63_to_q15(
   q63_t x)
   {
     return ((q31_t) (x >> 32) != ((q31_t) x >> 31)) ?
@@ -351,7 +443,7 @@ typedef signed short shortV __attribute__((vector_size (4)));
   /**
    * @brief Clips Q31 to Q7 values.
    */
-  inline q7_t clip_q31_to_q7(
+  static inline q7_t clip_q31_to_q7(
   q31_t x)
   {
     return ((q31_t) (x >> 24) != ((q31_t) x >> 23)) ?
@@ -361,7 +453,7 @@ typedef signed short shortV __attribute__((vector_size (4)));
   /**
    * @brief Clips Q31 to Q15 values.
    */
-  inline q15_t clip_q31_to_q15(
+  static inline q15_t clip_q31_to_q15(
   q31_t x)
   {
     return ((q31_t) (x >> 16) != ((q31_t) x >> 15)) ?
@@ -372,7 +464,7 @@ typedef signed short shortV __attribute__((vector_size (4)));
    * @brief Multiplies 32 X 64 and returns 32 bit result in 2.30 format.
    */
 
-  inline q63_t mult32x64(
+  static inline q63_t mult32x64(
   q63_t x,
   q31_t y)
   {
@@ -380,7 +472,7 @@ typedef signed short shortV __attribute__((vector_size (4)));
             (((q63_t) (x >> 32) * y)));
   }
 
-  inline uint32_t __CLZ(
+  static inline uint32_t __CLZ(
   q31_t data)
   {
     uint32_t count = 0;
@@ -395,9 +487,6 @@ typedef signed short shortV __attribute__((vector_size (4)));
     return (count);
 
   }
-  /**
-   * @brief Function to Calculates 1/in (reciprocal) value of Q31 Data type.
-   */
 
 
   static inline q31_t __SSAT(
@@ -437,65 +526,60 @@ typedef signed short shortV __attribute__((vector_size (4)));
   }
 
 
-// Unused function causing errors. Riddled with bugs
-//  static uint32_t riscv_recip_q31(
-//  q31_t in,
-//  q31_t * dst,
-//  q31_t * pRecipTable)
-//  {
-//    q31_t out;
-//    q31_t outtemp;
-//    uint32_t tempVal;
-//    uint32_t index, i;
-//    uint32_t signBits;
-//    int64_t  tempo;
-//    if (in > 0)
-//    {
-//      signBits = ((uint32_t) (__CLZ( in) - 1));
-//    }
-//    else
-//    {
-//      signBits = ((uint32_t) (__CLZ(-in) - 1));
-//    }
-//
-//    /* Convert input sample to 1.31 format */
-//    in = (in << signBits);
-//
-//    /* calculation of index for initial approximated Val */
-//    index = (uint32_t)(in >> 24);
-//    index = (index & INDEX_MASK);
-//    /* 1.31 with exp 1 */
-//    out = pRecipTable[index];
-//    /* calculation of reciprocal value */
-//    /* running approximation for two iterations */
-//    for (i = 0u; i < 2u; i++)
-//    {
-//      tempVal = (uint32_t) (((q63_t) in * out) >> 31);
-//      tempVal = 0x7FFFFFFFu - tempVal;
-//      /*      1.31 with exp 1 */
-//      /* out = (q31_t) (((q63_t) out * tempVal) >> 30); */ 
-//      uint32_t  x = tempVal;
-//      uint32_t y  = out;
-//      uint32_t out1;
-//      //out1 = (q31_t)clip_q63_to_q31( ((q63_t)x * y) >> 30);
-//      tempo= (q63_t)((uint64_t)x * y) >> 30;
-//      if(tempo > 2147483647) out1 = 0x7FFFFFFF;
-//      else if (tempo < -2147483648) out1 = 0x80000000;
-//      else out1 = tempo & 0x00000000FFFFFFFF;
-//      out = out1;
-//    }
-//    /* write output */
-//    *dst = out;
-//
-//    /* return num of signbits of out = 1/in value */
-//    return (signBits + 1u);
-//  }
+  /**
+   * @brief Function to Calculates 1/in (reciprocal) value of Q31 Data type.
+   */
+  static inline uint32_t riscv_recip_q31(
+  q31_t in,
+  q31_t * dst,
+  q31_t * pRecipTable)
+  {
+    q31_t out;
+    uint32_t tempVal;
+    uint32_t index, i;
+    uint32_t signBits;
+
+    if (in > 0)
+    {
+      signBits = ((uint32_t) (__CLZ( in) - 1));
+    }
+    else
+    {
+      signBits = ((uint32_t) (__CLZ(-in) - 1));
+    }
+
+    /* Convert input sample to 1.31 format */
+    in = (in << signBits);
+
+    /* calculation of index for initial approximated Val */
+    index = (uint32_t) (in >> 24);
+    index = (index & INDEX_MASK);
+
+    /*      1.31 with exp 1  */
+    out = pRecipTable[index];
+
+    /* calculation of reciprocal value */
+    /* running approximation for two iterations */
+    for (i = 0u; i < 2u; i++)
+    {
+      tempVal = (uint32_t) (((q63_t) in * out) >> 31);
+      tempVal = 0x7FFFFFFFu - tempVal;
+      /*      1.31 with exp 1 */
+      out = clip_q63_to_q31(((q63_t) out * tempVal) >> 30);
+    }
+
+    /* write output */
+    *dst = out;
+
+    /* return num of signbits of out = 1/in value */
+    return (signBits + 1u);
+  }
 
 
   /**
    * @brief Function to Calculates 1/in (reciprocal) value of Q15 Data type.
    */
-   inline uint32_t riscv_recip_q15(
+   static inline uint32_t riscv_recip_q15(
   q15_t in,
   q15_t * dst,
   q15_t * pRecipTable)
@@ -552,36 +636,74 @@ typedef signed short shortV __attribute__((vector_size (4)));
     q7_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
   } riscv_fir_instance_q7;
 
+  struct riscv_fir_instance_q15;
+  struct riscv_fir_instance_q31;
+  struct riscv_fir_instance_f32;
+
+  /**
+   * @brief Kernel specialized for one tap count, see riscv_fir_fixed.h.
+   */
+  typedef void (*riscv_fir_kernel_q15)(const struct riscv_fir_instance_q15 * S, q15_t * pSrc, q15_t * pDst, uint32_t blockSize);
+  typedef void (*riscv_fir_kernel_q31)(const struct riscv_fir_instance_q31 * S, q31_t * pSrc, q31_t * pDst, uint32_t blockSize);
+  typedef void (*riscv_fir_kernel_f32)(const struct riscv_fir_instance_f32 * S, float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
   /**
    * @brief Instance structure for the Q15 FIR filter.
    */
-  typedef struct
+  typedef struct riscv_fir_instance_q15
   {
     uint16_t numTaps;         /**< number of filter coefficients in the filter. */
     q15_t *pState;            /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
     q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+    riscv_fir_kernel_q15 pKernel;  /**< kernel specialized for numTaps, NULL for the generic loops. */
   } riscv_fir_instance_q15;
 
   /**
    * @brief Instance structure for the Q31 FIR filter.
    */
-  typedef struct
+  typedef struct riscv_fir_instance_q31
   {
     uint16_t numTaps;         /**< number of filter coefficients in the filter. */
     q31_t *pState;            /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
     q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+    riscv_fir_kernel_q31 pKernel;  /**< kernel specialized for numTaps, NULL for the generic loops. */
   } riscv_fir_instance_q31;
 
   /**
    * @brief Instance structure for the floating-point FIR filter.
    */
-  typedef struct
+  typedef struct riscv_fir_instance_f32
   {
     uint16_t numTaps;     /**< number of filter coefficients in the filter. */
     float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
     float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
+    riscv_fir_kernel_f32 pKernel;  /**< kernel specialized for numTaps, NULL for the generic loop. */
   } riscv_fir_instance_f32;
 
+  /**
+   * @brief Specialized kernel the library was built with for a tap count.
+   * @param[in] numTaps number of filter coefficients.
+   * @return the kernel, or NULL if there is none for numTaps.
+   */
+  riscv_fir_kernel_q15 riscv_fir_fixed_find_q15(
+  uint16_t numTaps);
+
+  /**
+   * @brief Specialized kernel the library was built with for a tap count.
+   * @param[in] numTaps number of filter coefficients.
+   * @return the kernel, or NULL if there is none for numTaps.
+   */
+  riscv_fir_kernel_q31 riscv_fir_fixed_find_q31(
+  uint16_t numTaps);
+
+  /**
+   * @brief Specialized kernel the library was built with for a tap count.
+   * @param[in] numTaps number of filter coefficients.
+   * @return the kernel, or NULL if there is none for numTaps.
+   */
+  riscv_fir_kernel_f32 riscv_fir_fixed_find_f32(
+  uint16_t numTaps);
+
 
   /**
    * @brief Processing function for the Q7 FIR filter.
@@ -661,6 +783,109 @@ typedef signed short shortV __attribute__((vector_size (4)));
   q15_t * pState,
   uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 single-sample FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t stateIndex;      /**< position of the oldest sample in the state array, 0 to numTaps-1. */
+    const q15_t *pCoeffs;     /**< points to the coefficient array of length numTaps, in time reversed order as for riscv_fir_q15(). */
+    q15_t *pState;            /**< points to the state array.  The array is of length 2*numTaps. */
+  } riscv_fir_sample_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 single-sample FIR filter.
+   * @param[out]    *S         points to an instance of the Q15 single-sample FIR structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the filter coefficients, 32-bit aligned.
+   * @param[in]     *pState    points to the state buffer of <code>2*numTaps</code> values, 32-bit aligned.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR if <code>numTaps</code> is 0.
+   */
+
+  riscv_status riscv_fir_sample_init_q15(
+  riscv_fir_sample_instance_q15 * S,
+  uint16_t numTaps,
+  const q15_t * pCoeffs,
+  q15_t * pState);
+
+  /**
+   * @brief  Filters one sample through the Q15 FIR filter, for interrupt handlers.
+   * @param[in,out] *S   points to an instance of the Q15 single-sample FIR structure.
+   * @param[in]     in   input sample.
+   * @return        output sample.
+   *
+   * \par
+   * The state is a circular buffer written twice, at <code>stateIndex</code> and <code>stateIndex+numTaps</code>,
+   * so the last <code>numTaps</code> inputs are always contiguous: a call stores two values and runs one
+   * straight dot product, without the state shift or the loop setup and tails of riscv_fir_q15() with a
+   * block size of 1.  With <code>USE_DSP_RISCV</code> the window is read as aligned pairs, every other call
+   * it starts at an odd index and each pair is shuffled from two loads.
+   * \par
+   * The accumulation and saturation are those of riscv_fir_q15(), the output is bit exact with it.
+   */
+
+  static inline q15_t riscv_fir_sample_q15(
+  riscv_fir_sample_instance_q15 * S,
+  q15_t in)
+  {
+    const q15_t *pb = S->pCoeffs;
+    const q15_t *px;
+    uint32_t numTaps = S->numTaps;
+    uint32_t index = S->stateIndex;
+    uint32_t i;
+    q63_t acc = 0;
+
+    /* The input replaces the oldest sample in both copies */
+    S->pState[index] = in;
+    S->pState[index + numTaps] = in;
+    index = (index + 1u == numTaps) ? 0u : index + 1u;
+    S->stateIndex = (uint16_t) index;
+
+    /* Window from the oldest to the newest sample */
+    px = S->pState + index;
+
+#if defined (USE_DSP_RISCV)
+    if((index & 1u) != 0u)
+    {
+      shortV odd = { 1, 2 };
+      const shortV *pv = (const shortV *) (px - 1);
+      shortV lo = *pv++, hi;
+
+      for (i = numTaps >> 1u; i > 0u; i--)
+      {
+        hi = *pv++;
+        acc += dotpv2(*(const shortV *) pb, shufflev4(lo, hi, odd));
+        lo = hi;
+        pb += 2;
+      }
+    }
+    else
+    {
+      const shortV *pv = (const shortV *) px;
+
+      for (i = numTaps >> 1u; i > 0u; i--)
+      {
+        acc += dotpv2(*(const shortV *) pb, *pv++);
+        pb += 2;
+      }
+    }
+    px += numTaps & ~1u;
+
+    if((numTaps & 1u) != 0u)
+    {
+      acc += (q31_t) *pb * *px;
+    }
+#else
+    for (i = numTaps; i > 0u; i--)
+    {
+      acc += (q31_t) *pb++ * *px++;
+    }
+#endif
+
+    return ((q15_t) __SSAT((acc >> 15), 16));
+  }
+
   /**
    * @brief Processing function for the Q31 FIR filter.
    * @param[in] *S points to an instance of the Q31 FIR filter structure.
@@ -735,6144 +960,19252 @@ typedef signed short shortV __attribute__((vector_size (4)));
   float32_t * pState,
   uint32_t blockSize);
 
-
   /**
-   * @brief Instance structure for the Q15 Biquad cascade filter.
+   * @brief Coefficients of a Q15 FIR filter shared by several streams, see riscv_fir_shared_q15().
    */
   typedef struct
   {
-    int8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q15_t *pState;            /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
-    q15_t *pCoeffs;           /**< Points to the array of coefficients.  The array is of length 5*numStages. */
-    int8_t postShift;         /**< Additional shift, in bits, applied to each output sample. */
-
-  } riscv_biquad_casd_df1_inst_q15;
-
+    uint16_t numTaps;              /**< number of filter coefficients in the filter. */
+    const q15_t *pCoeffs;          /**< points to the coefficient array. The array is of length numTaps. */
+    riscv_fir_kernel_q15 pKernel;  /**< kernel specialized for numTaps, NULL for the generic loops. */
+  } riscv_fir_shared_coefs_q15;
 
   /**
-   * @brief Instance structure for the Q31 Biquad cascade filter.
+   * @brief State of one stream of a shared Q15 FIR filter.
    */
   typedef struct
   {
-    uint32_t numStages;      /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q31_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
-    q31_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 5*numStages. */
-    uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
-
-  } riscv_biquad_casd_df1_inst_q31;
+    const riscv_fir_shared_coefs_q15 *pCoefs;  /**< points to the shared coefficients. */
+    q15_t *pState;                             /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } riscv_fir_shared_state_q15;
 
   /**
-   * @brief Instance structure for the floating-point Biquad cascade filter.
+   * @brief  Initialization function for the shared coefficients of a Q15 FIR filter.
+   * @param[out] *C        points to the shared coefficients.
+   * @param[in]  numTaps   number of filter coefficients in the filter.
+   * @param[in]  *pCoeffs  points to the coefficients, in time reversed order.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is 0.
    */
-  typedef struct
-  {
-    uint32_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;          /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
-    float32_t *pCoeffs;         /**< Points to the array of coefficients.  The array is of length 5*numStages. */
-
-
-  } riscv_biquad_casd_df1_inst_f32;
-
-
+  riscv_status riscv_fir_shared_coefs_init_q15(
+  riscv_fir_shared_coefs_q15 * C,
+  uint16_t numTaps,
+  const q15_t * pCoeffs);
 
   /**
-   * @brief Processing function for the Q15 Biquad cascade filter.
-   * @param[in]  *S points to an instance of the Q15 Biquad cascade structure.
-   * @param[in]  *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in]  blockSize number of samples to process.
+   * @brief  Initialization function for one stream of a shared Q15 FIR filter.
+   * @param[out] *T         points to the state of the stream.
+   * @param[in]  *C         points to the shared coefficients.
+   * @param[in]  *pState    points to the state buffer of the stream, of length numTaps+blockSize-1.
+   * @param[in]  blockSize  number of samples processed per call.
    * @return     none.
    */
+  void riscv_fir_shared_state_init_q15(
+  riscv_fir_shared_state_q15 * T,
+  const riscv_fir_shared_coefs_q15 * C,
+  q15_t * pState,
+  uint32_t blockSize);
 
-  void riscv_biquad_cascade_df1_q15(
-  const riscv_biquad_casd_df1_inst_q15 * S,
+  /**
+   * @brief  Processing function for one stream of a shared Q15 FIR filter.
+   * @param[in,out] *T         points to the state of the stream.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        none.
+   */
+  void riscv_fir_shared_q15(
+  riscv_fir_shared_state_q15 * T,
   q15_t * pSrc,
   q15_t * pDst,
   uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the Q15 Biquad cascade filter.
-   * @param[in,out] *S           points to an instance of the Q15 Biquad cascade structure.
-   * @param[in]     numStages    number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
-   * @return        none
+   * @brief Coefficients of a Q31 FIR filter shared by several streams, see riscv_fir_shared_q31().
    */
+  typedef struct
+  {
+    uint16_t numTaps;              /**< number of filter coefficients in the filter. */
+    const q31_t *pCoeffs;          /**< points to the coefficient array. The array is of length numTaps. */
+    riscv_fir_kernel_q31 pKernel;  /**< kernel specialized for numTaps, NULL for the generic loops. */
+  } riscv_fir_shared_coefs_q31;
 
-  void riscv_biquad_cascade_df1_init_q15(
-  riscv_biquad_casd_df1_inst_q15 * S,
-  uint8_t numStages,
-  q15_t * pCoeffs,
-  q15_t * pState,
-  int8_t postShift);
+  /**
+   * @brief State of one stream of a shared Q31 FIR filter.
+   */
+  typedef struct
+  {
+    const riscv_fir_shared_coefs_q31 *pCoefs;  /**< points to the shared coefficients. */
+    q31_t *pState;                             /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } riscv_fir_shared_state_q31;
 
+  /**
+   * @brief  Initialization function for the shared coefficients of a Q31 FIR filter.
+   * @param[out] *C        points to the shared coefficients.
+   * @param[in]  numTaps   number of filter coefficients in the filter.
+   * @param[in]  *pCoeffs  points to the coefficients, in time reversed order.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is 0.
+   */
+  riscv_status riscv_fir_shared_coefs_init_q31(
+  riscv_fir_shared_coefs_q31 * C,
+  uint16_t numTaps,
+  const q31_t * pCoeffs);
 
   /**
-   * @brief Fast but less precise processing function for the Q15 Biquad cascade filter for Cortex-M3 and Cortex-M4.
-   * @param[in]  *S points to an instance of the Q15 Biquad cascade structure.
-   * @param[in]  *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in]  blockSize number of samples to process.
+   * @brief  Initialization function for one stream of a shared Q31 FIR filter.
+   * @param[out] *T         points to the state of the stream.
+   * @param[in]  *C         points to the shared coefficients.
+   * @param[in]  *pState    points to the state buffer of the stream, of length numTaps+blockSize-1.
+   * @param[in]  blockSize  number of samples processed per call.
    * @return     none.
    */
-
-  void riscv_biquad_cascade_df1_fast_q15(
-  const riscv_biquad_casd_df1_inst_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst,
+  void riscv_fir_shared_state_init_q31(
+  riscv_fir_shared_state_q31 * T,
+  const riscv_fir_shared_coefs_q31 * C,
+  q31_t * pState,
   uint32_t blockSize);
 
-
   /**
-   * @brief Processing function for the Q31 Biquad cascade filter
-   * @param[in]  *S         points to an instance of the Q31 Biquad cascade structure.
-   * @param[in]  *pSrc      points to the block of input data.
-   * @param[out] *pDst      points to the block of output data.
-   * @param[in]  blockSize  number of samples to process.
-   * @return     none.
+   * @brief  Processing function for one stream of a shared Q31 FIR filter.
+   * @param[in,out] *T         points to the state of the stream.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        none.
    */
-
-  void riscv_biquad_cascade_df1_q31(
-  const riscv_biquad_casd_df1_inst_q31 * S,
+  void riscv_fir_shared_q31(
+  riscv_fir_shared_state_q31 * T,
   q31_t * pSrc,
   q31_t * pDst,
   uint32_t blockSize);
 
   /**
-   * @brief Fast but less precise processing function for the Q31 Biquad cascade filter for Cortex-M3 and Cortex-M4.
-   * @param[in]  *S         points to an instance of the Q31 Biquad cascade structure.
-   * @param[in]  *pSrc      points to the block of input data.
-   * @param[out] *pDst      points to the block of output data.
-   * @param[in]  blockSize  number of samples to process.
-   * @return     none.
+   * @brief Coefficients of a floating-point FIR filter shared by several streams, see riscv_fir_shared_f32().
    */
-
-  void riscv_biquad_cascade_df1_fast_q31(
-  const riscv_biquad_casd_df1_inst_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
+  typedef struct
+  {
+    uint16_t numTaps;              /**< number of filter coefficients in the filter. */
+    const float32_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
+    riscv_fir_kernel_f32 pKernel;  /**< kernel specialized for numTaps, NULL for the generic loops. */
+  } riscv_fir_shared_coefs_f32;
 
   /**
-   * @brief  Initialization function for the Q31 Biquad cascade filter.
-   * @param[in,out] *S           points to an instance of the Q31 Biquad cascade structure.
-   * @param[in]     numStages      number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
-   * @return        none
+   * @brief State of one stream of a shared floating-point FIR filter.
    */
+  typedef struct
+  {
+    const riscv_fir_shared_coefs_f32 *pCoefs;  /**< points to the shared coefficients. */
+    float32_t *pState;                         /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } riscv_fir_shared_state_f32;
 
-  void riscv_biquad_cascade_df1_init_q31(
-  riscv_biquad_casd_df1_inst_q31 * S,
-  uint8_t numStages,
-  q31_t * pCoeffs,
-  q31_t * pState,
-  int8_t postShift);
+  /**
+   * @brief  Initialization function for the shared coefficients of a floating-point FIR filter.
+   * @param[out] *C        points to the shared coefficients.
+   * @param[in]  numTaps   number of filter coefficients in the filter.
+   * @param[in]  *pCoeffs  points to the coefficients, in time reversed order.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is 0.
+   */
+  riscv_status riscv_fir_shared_coefs_init_f32(
+  riscv_fir_shared_coefs_f32 * C,
+  uint16_t numTaps,
+  const float32_t * pCoeffs);
 
   /**
-   * @brief Processing function for the floating-point Biquad cascade filter.
-   * @param[in]  *S         points to an instance of the floating-point Biquad cascade structure.
-   * @param[in]  *pSrc      points to the block of input data.
-   * @param[out] *pDst      points to the block of output data.
-   * @param[in]  blockSize  number of samples to process.
+   * @brief  Initialization function for one stream of a shared floating-point FIR filter.
+   * @param[out] *T         points to the state of the stream.
+   * @param[in]  *C         points to the shared coefficients.
+   * @param[in]  *pState    points to the state buffer of the stream, of length numTaps+blockSize-1.
+   * @param[in]  blockSize  number of samples processed per call.
    * @return     none.
    */
+  void riscv_fir_shared_state_init_f32(
+  riscv_fir_shared_state_f32 * T,
+  const riscv_fir_shared_coefs_f32 * C,
+  float32_t * pState,
+  uint32_t blockSize);
 
-  void riscv_biquad_cascade_df1_f32(
-  const riscv_biquad_casd_df1_inst_f32 * S,
+  /**
+   * @brief  Processing function for one stream of a shared floating-point FIR filter.
+   * @param[in,out] *T         points to the state of the stream.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        none.
+   */
+  void riscv_fir_shared_f32(
+  riscv_fir_shared_state_f32 * T,
   float32_t * pSrc,
   float32_t * pDst,
   uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the floating-point Biquad cascade filter.
-   * @param[in,out] *S           points to an instance of the floating-point Biquad cascade structure.
-   * @param[in]     numStages    number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @return        none
+   * @brief Responses of riscv_fir_design_f32().
    */
 
-  void riscv_biquad_cascade_df1_init_f32(
-  riscv_biquad_casd_df1_inst_f32 * S,
-  uint8_t numStages,
-  float32_t * pCoeffs,
-  float32_t * pState);
-
+  typedef enum
+  {
+    RISCV_FIR_DESIGN_LOWPASS = 0,        /**< Passes 0 ... f1 */
+    RISCV_FIR_DESIGN_HIGHPASS = 1,       /**< Passes f1 ... 0.5, odd number of taps */
+    RISCV_FIR_DESIGN_BANDPASS = 2,       /**< Passes f1 ... f2 */
+    RISCV_FIR_DESIGN_BANDSTOP = 3        /**< Stops f1 ... f2, odd number of taps */
+  } riscv_fir_design_type;
 
   /**
-   * @brief Instance structure for the floating-point matrix structure.
+   * @brief  Windowed-sinc design of a floating-point FIR filter.
+   * @param[in]  type      response of the filter.
+   * @param[in]  numTaps   number of filter coefficients.
+   * @param[in]  f1        cut-off frequency or lower band edge, normalized to the sample rate.
+   * @param[in]  f2        upper band edge of the band responses, normalized to the sample rate.
+   * @param[in]  *pWindow  points to a window of numTaps values, or NULL for a Hamming window.
+   * @param[out] *pCoeffs  points to the numTaps filter coefficients.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR for unsupported arguments.
    */
 
-  typedef struct
-  {
-    uint16_t numRows;     /**< number of rows of the matrix.     */
-    uint16_t numCols;     /**< number of columns of the matrix.  */
-    float32_t *pData;     /**< points to the data of the matrix. */
-  } riscv_matrix_instance_f32;
-
+  riscv_status riscv_fir_design_f32(
+  riscv_fir_design_type type,
+  uint16_t numTaps,
+  float32_t f1,
+  float32_t f2,
+  const float32_t * pWindow,
+  float32_t * pCoeffs);
 
   /**
-   * @brief Instance structure for the floating-point matrix structure.
+   * @brief Instance structure for the Q15 complex FIR filter.
    */
-
   typedef struct
   {
-    uint16_t numRows;     /**< number of rows of the matrix.     */
-    uint16_t numCols;     /**< number of columns of the matrix.  */
-    float64_t *pData;     /**< points to the data of the matrix. */
-  } riscv_matrix_instance_f64;
+    uint16_t numTaps;         /**< number of filter taps. */
+    uint8_t cmplxCoeffs;      /**< 0 for numTaps real taps, 1 for numTaps (real, imag) taps. */
+    q15_t *pState;            /**< points to the state array of 2*(numTaps+blockSize-1) values, (real, imag) pairs. */
+    q15_t *pCoeffs;           /**< points to the tap array in time reversed order. */
+  } riscv_cfir_instance_q15;
 
   /**
-   * @brief Instance structure for the Q15 matrix structure.
+   * @brief Instance structure for the floating-point complex FIR filter.
    */
-
   typedef struct
   {
-    uint16_t numRows;     /**< number of rows of the matrix.     */
-    uint16_t numCols;     /**< number of columns of the matrix.  */
-    q15_t *pData;         /**< points to the data of the matrix. */
+    uint16_t numTaps;         /**< number of filter taps. */
+    uint8_t cmplxCoeffs;      /**< 0 for numTaps real taps, 1 for numTaps (real, imag) taps. */
+    float32_t *pState;        /**< points to the state array of 2*(numTaps+blockSize-1) values, (real, imag) pairs. */
+    float32_t *pCoeffs;       /**< points to the tap array in time reversed order. */
+  } riscv_cfir_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 complex FIR filter.
+   * @param[in]  *S          points to an instance of the Q15 complex FIR structure.
+   * @param[in]  *pSrc       points to the block of complex input samples.
+   * @param[out] *pDst       points to the block of complex output samples.
+   * @param[in]  blockSize   number of complex samples to process.
+   * @return none.
+   */
+  void riscv_cfir_q15(
+  const riscv_cfir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
-  } riscv_matrix_instance_q15;
+  /**
+   * @brief  Initialization function for the Q15 complex FIR filter.
+   * @param[in,out] *S            points to an instance of the Q15 complex FIR structure.
+   * @param[in]     numTaps       number of filter taps.
+   * @param[in]     *pCoeffs      points to the taps, numTaps real values or numTaps (real, imag) pairs.
+   * @param[in]     *pState       points to the state buffer of 2*(numTaps+blockSize-1) values.
+   * @param[in]     blockSize     number of complex samples processed per call.
+   * @param[in]     cmplxCoeffs   0 for real taps, 1 for complex taps.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is 0.
+   */
+  riscv_status riscv_cfir_init_q15(
+  riscv_cfir_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize,
+  uint8_t cmplxCoeffs);
 
   /**
-   * @brief Instance structure for the Q31 matrix structure.
+   * @brief Processing function for the floating-point complex FIR filter.
+   * @param[in]  *S          points to an instance of the floating-point complex FIR structure.
+   * @param[in]  *pSrc       points to the block of complex input samples.
+   * @param[out] *pDst       points to the block of complex output samples.
+   * @param[in]  blockSize   number of complex samples to process.
+   * @return none.
+   */
+  void riscv_cfir_f32(
+  const riscv_cfir_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point complex FIR filter.
+   * @param[in,out] *S            points to an instance of the floating-point complex FIR structure.
+   * @param[in]     numTaps       number of filter taps.
+   * @param[in]     *pCoeffs      points to the taps, numTaps real values or numTaps (real, imag) pairs.
+   * @param[in]     *pState       points to the state buffer of 2*(numTaps+blockSize-1) values.
+   * @param[in]     blockSize     number of complex samples processed per call.
+   * @param[in]     cmplxCoeffs   0 for real taps, 1 for complex taps.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is 0.
    */
+  riscv_status riscv_cfir_init_f32(
+  riscv_cfir_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize,
+  uint8_t cmplxCoeffs);
 
+  /**
+   * @brief Instance structure for the Q15 multi-channel FIR filter.
+   */
   typedef struct
   {
-    uint16_t numRows;     /**< number of rows of the matrix.     */
-    uint16_t numCols;     /**< number of columns of the matrix.  */
-    q31_t *pData;         /**< points to the data of the matrix. */
-
-  } riscv_matrix_instance_q31;
-
-
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;     /**< number of channels that share the coefficients. */
+    uint32_t stateStride;     /**< length numTaps+blockSize-1 of the state buffer of one channel. */
+    q15_t *pState;            /**< points to the state buffers of the channels, stored back to back. */
+    q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } riscv_fir_multichan_instance_q15;
 
   /**
-   * @brief Floating-point matrix addition.
-   * @param[in]       *pSrcA points to the first input matrix structure
-   * @param[in]       *pSrcB points to the second input matrix structure
-   * @param[out]      *pDst points to output matrix structure
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief Instance structure for the floating-point multi-channel FIR filter.
    */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;     /**< number of channels that share the coefficients. */
+    uint32_t stateStride;     /**< length numTaps+blockSize-1 of the state buffer of one channel. */
+    float32_t *pState;        /**< points to the state buffers of the channels, stored back to back. */
+    float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+  } riscv_fir_multichan_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 multi-channel FIR filter.
+   * @param[in] *S points to an instance of the Q15 multi-channel FIR structure.
+   * @param[in] *pSrc points to the input blocks of the channels, stored back to back.
+   * @param[out] *pDst points to the output blocks of the channels, stored back to back.
+   * @param[in] blockSize number of samples per channel to process.
+   * @return none.
+   */
+  void riscv_fir_multichan_q15(
+  const riscv_fir_multichan_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
-  riscv_status riscv_mat_add_f32(
-  const riscv_matrix_instance_f32 * pSrcA,
-  const riscv_matrix_instance_f32 * pSrcB,
-  riscv_matrix_instance_f32 * pDst);
+  /**
+   * @brief  Initialization function for the Q15 multi-channel FIR filter.
+   * @param[in,out] *S points to an instance of the Q15 multi-channel FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter. Must be even and greater than or equal to 4.
+   * @param[in] numChannels Number of channels.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffers, numChannels*(numTaps+blockSize-1) samples.
+   * @param[in] blockSize number of samples per channel that are processed at a time.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization was successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> or <code>numChannels</code> is not a supported value.
+   */
+  riscv_status riscv_fir_multichan_init_q15(
+  riscv_fir_multichan_instance_q15 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
 
   /**
-   * @brief Q15 matrix addition.
-   * @param[in]       *pSrcA points to the first input matrix structure
-   * @param[in]       *pSrcB points to the second input matrix structure
-   * @param[out]      *pDst points to output matrix structure
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief Processing function for the floating-point multi-channel FIR filter.
+   * @param[in] *S points to an instance of the floating-point multi-channel FIR structure.
+   * @param[in] *pSrc points to the input blocks of the channels, stored back to back.
+   * @param[out] *pDst points to the output blocks of the channels, stored back to back.
+   * @param[in] blockSize number of samples per channel to process.
+   * @return none.
    */
+  void riscv_fir_multichan_f32(
+  const riscv_fir_multichan_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
-  riscv_status riscv_mat_add_q15(
-  const riscv_matrix_instance_q15 * pSrcA,
-  const riscv_matrix_instance_q15 * pSrcB,
-  riscv_matrix_instance_q15 * pDst);
+  /**
+   * @brief  Initialization function for the floating-point multi-channel FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point multi-channel FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter.
+   * @param[in] numChannels Number of channels.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffers, numChannels*(numTaps+blockSize-1) samples.
+   * @param[in] blockSize number of samples per channel that are processed at a time.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization was successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> or <code>numChannels</code> is 0.
+   */
+  riscv_status riscv_fir_multichan_init_f32(
+  riscv_fir_multichan_instance_f32 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
 
   /**
-   * @brief Q31 matrix addition.
-   * @param[in]       *pSrcA points to the first input matrix structure
-   * @param[in]       *pSrcB points to the second input matrix structure
-   * @param[out]      *pDst points to output matrix structure
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief Instance structure for the Q15 FIR filter with a circular state buffer.
    */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint32_t stateIndex;      /**< write index of the circular buffer. */
+    uint32_t stateLength;     /**< length numTaps+blockSize-1 of the circular buffer. */
+    q15_t *pState;             /**< points to the circular buffer followed by its mirror. The array is of length 2*stateLength. */
+    q15_t *pCoeffs;            /**< points to the coefficient array. The array is of length numTaps. */
+  } riscv_fir_circ_instance_q15;
 
-  riscv_status riscv_mat_add_q31(
-  const riscv_matrix_instance_q31 * pSrcA,
-  const riscv_matrix_instance_q31 * pSrcB,
-  riscv_matrix_instance_q31 * pDst);
+  /**
+   * @brief Instance structure for the Q31 FIR filter with a circular state buffer.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint32_t stateIndex;      /**< write index of the circular buffer. */
+    uint32_t stateLength;     /**< length numTaps+blockSize-1 of the circular buffer. */
+    q31_t *pState;             /**< points to the circular buffer followed by its mirror. The array is of length 2*stateLength. */
+    q31_t *pCoeffs;            /**< points to the coefficient array. The array is of length numTaps. */
+  } riscv_fir_circ_instance_q31;
 
   /**
-   * @brief Floating-point, complex, matrix multiplication.
-   * @param[in]       *pSrcA points to the first input matrix structure
-   * @param[in]       *pSrcB points to the second input matrix structure
-   * @param[out]      *pDst points to output matrix structure
-   * @return     The function returns either
-   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief Instance structure for the floating-point FIR filter with a circular state buffer.
    */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint32_t stateIndex;      /**< write index of the circular buffer. */
+    uint32_t stateLength;     /**< length numTaps+blockSize-1 of the circular buffer. */
+    float32_t *pState;         /**< points to the circular buffer followed by its mirror. The array is of length 2*stateLength. */
+    float32_t *pCoeffs;        /**< points to the coefficient array. The array is of length numTaps. */
+  } riscv_fir_circ_instance_f32;
 
-  riscv_status riscv_mat_cmplx_mult_f32(
-  const riscv_matrix_instance_f32 * pSrcA,
-  const riscv_matrix_instance_f32 * pSrcB,
-  riscv_matrix_instance_f32 * pDst);
+  /**
+   * @brief Processing function for the Q15 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q15 circular FIR structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+  void riscv_fir_circ_q15(
+  riscv_fir_circ_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
   /**
-   * @brief Q15, complex,  matrix multiplication.
-   * @param[in]       *pSrcA points to the first input matrix structure
-   * @param[in]       *pSrcB points to the second input matrix structure
-   * @param[out]      *pDst points to output matrix structure
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief  Initialization function for the Q15 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q15 circular FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter. Must be even and greater than or equal to 4.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer, 2*(numTaps+blockSize-1) samples.
+   * @param[in] blockSize maximum number of samples that are processed at a time.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization was successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> is not a supported value.
    */
+  riscv_status riscv_fir_circ_init_q15(
+  riscv_fir_circ_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
 
-  riscv_status riscv_mat_cmplx_mult_q15(
-  const riscv_matrix_instance_q15 * pSrcA,
-  const riscv_matrix_instance_q15 * pSrcB,
-  riscv_matrix_instance_q15 * pDst,
-  q15_t * pScratch);
+  /**
+   * @brief Processing function for the Q31 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q31 circular FIR structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+  void riscv_fir_circ_q31(
+  riscv_fir_circ_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
   /**
-   * @brief Q31, complex, matrix multiplication.
-   * @param[in]       *pSrcA points to the first input matrix structure
-   * @param[in]       *pSrcB points to the second input matrix structure
-   * @param[out]      *pDst points to output matrix structure
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief  Initialization function for the Q31 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q31 circular FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter. Must be greater than 0.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer, 2*(numTaps+blockSize-1) samples.
+   * @param[in] blockSize maximum number of samples that are processed at a time.
+   * @return none.
    */
+  void riscv_fir_circ_init_q31(
+  riscv_fir_circ_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
 
-  riscv_status riscv_mat_cmplx_mult_q31(
-  const riscv_matrix_instance_q31 * pSrcA,
-  const riscv_matrix_instance_q31 * pSrcB,
-  riscv_matrix_instance_q31 * pDst);
+  /**
+   * @brief Processing function for the floating-point FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the floating-point circular FIR structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+  void riscv_fir_circ_f32(
+  riscv_fir_circ_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
+  /**
+   * @brief  Initialization function for the floating-point FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the floating-point circular FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter. Must be greater than 0.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer, 2*(numTaps+blockSize-1) samples.
+   * @param[in] blockSize maximum number of samples that are processed at a time.
+   * @return none.
+   */
+  void riscv_fir_circ_init_f32(
+  riscv_fir_circ_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
 
   /**
-   * @brief Floating-point matrix transpose.
-   * @param[in]  *pSrc points to the input matrix
-   * @param[out] *pDst points to the output matrix
-   * @return 	The function returns either  <code>RISCV_MATH_SIZE_MISMATCH</code>
-   * or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief Instance structure for the floating-point fractional delay line.
    */
+  typedef struct
+  {
+    uint16_t length;           /**< number of samples the line holds. */
+    uint16_t writeIndex;       /**< slot of the next sample. */
+    float32_t *pState;         /**< points to the circular buffer followed by its mirror. The array is of length 2*length. */
+  } riscv_delay_line_instance_f32;
 
-  riscv_status riscv_mat_trans_f32(
-  const riscv_matrix_instance_f32 * pSrc,
-  riscv_matrix_instance_f32 * pDst);
+  /**
+   * @brief Instance structure for the Q15 fractional delay line.
+   */
+  typedef struct
+  {
+    uint16_t length;           /**< number of samples the line holds. */
+    uint16_t writeIndex;       /**< slot of the next sample. */
+    q15_t *pState;             /**< points to the circular buffer followed by its mirror. The array is of length 2*length. */
+  } riscv_delay_line_instance_q15;
 
+  /**
+   * @brief Read tap of the floating-point fractional delay line.
+   */
+  typedef struct
+  {
+    float32_t delay;           /**< delay of the first output sample of the next read, in samples. */
+    float32_t target;          /**< delay reached at the end of the next read, the delay ramps linearly to it. */
+    float32_t gain;            /**< weight of the tap in the output. */
+  } riscv_delay_line_tap_f32;
 
   /**
-   * @brief Q15 matrix transpose.
-   * @param[in]  *pSrc points to the input matrix
-   * @param[out] *pDst points to the output matrix
-   * @return 	The function returns either  <code>RISCV_MATH_SIZE_MISMATCH</code>
-   * or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief Read tap of the Q15 fractional delay line.
    */
+  typedef struct
+  {
+    q31_t delay;               /**< delay of the first output sample of the next read, in samples in 16.15 format. */
+    q31_t target;              /**< delay reached at the end of the next read in 16.15 format, the delay ramps linearly to it. */
+    q15_t gain;                /**< weight of the tap in the output. */
+  } riscv_delay_line_tap_q15;
 
-  riscv_status riscv_mat_trans_q15(
-  const riscv_matrix_instance_q15 * pSrc,
-  riscv_matrix_instance_q15 * pDst);
+  /**
+   * @brief  Initialization function for the floating-point fractional delay line.
+   * @param[out] *S       points to an instance of the floating-point delay line structure.
+   * @param[in]  length   number of samples the line holds, at least the largest delay plus the block size plus 3.
+   * @param[in]  *pState  points to the state buffer of 2*length samples.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>length</code> is below 4.
+   */
+  riscv_status riscv_delay_line_init_f32(
+  riscv_delay_line_instance_f32 * S,
+  uint16_t length,
+  float32_t * pState);
 
   /**
-   * @brief Q31 matrix transpose.
-   * @param[in]  *pSrc points to the input matrix
-   * @param[out] *pDst points to the output matrix
-   * @return 	The function returns either  <code>RISCV_MATH_SIZE_MISMATCH</code>
-   * or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief  Appends a block of samples to the floating-point fractional delay line.
+   * @param[in,out] *S          points to an instance of the floating-point delay line structure.
+   * @param[in]     *pSrc       points to the block of input data.
+   * @param[in]     blockSize   number of samples to append.
+   * @return none.
    */
-
-  riscv_status riscv_mat_trans_q31(
-  const riscv_matrix_instance_q31 * pSrc,
-  riscv_matrix_instance_q31 * pDst);
-
+  void riscv_delay_line_write_f32(
+  riscv_delay_line_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize);
 
   /**
-   * @brief Floating-point matrix multiplication
-   * @param[in]       *pSrcA points to the first input matrix structure
-   * @param[in]       *pSrcB points to the second input matrix structure
-   * @param[out]      *pDst points to output matrix structure
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief  Reads the last block written to the floating-point fractional delay line through a set of taps.
+   * @param[in]     *S          points to an instance of the floating-point delay line structure.
+   * @param[in,out] *pTaps      points to the taps, their delays move to their targets.
+   * @param[in]     numTaps     number of taps.
+   * @param[out]    *pDst       points to the block of output data, the weighted sum of the taps.
+   * @param[in]     blockSize   number of samples to read.
+   * @return none.
    */
-
-  riscv_status riscv_mat_mult_f32(
-  const riscv_matrix_instance_f32 * pSrcA,
-  const riscv_matrix_instance_f32 * pSrcB,
-  riscv_matrix_instance_f32 * pDst);
+  void riscv_delay_line_read_f32(
+  const riscv_delay_line_instance_f32 * S,
+  riscv_delay_line_tap_f32 * pTaps,
+  uint16_t numTaps,
+  float32_t * pDst,
+  uint32_t blockSize);
 
   /**
-   * @brief Q15 matrix multiplication
-   * @param[in]       *pSrcA points to the first input matrix structure
-   * @param[in]       *pSrcB points to the second input matrix structure
-   * @param[out]      *pDst points to output matrix structure
-   * @param[in]		 *pState points to the array for storing intermediate results
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief  Initialization function for the Q15 fractional delay line.
+   * @param[out] *S       points to an instance of the Q15 delay line structure.
+   * @param[in]  length   number of samples the line holds, at least the largest delay plus the block size plus 3.
+   * @param[in]  *pState  points to the state buffer of 2*length samples.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>length</code> is below 4.
    */
-
-  riscv_status riscv_mat_mult_q15(
-  const riscv_matrix_instance_q15 * pSrcA,
-  const riscv_matrix_instance_q15 * pSrcB,
-  riscv_matrix_instance_q15 * pDst,
+  riscv_status riscv_delay_line_init_q15(
+  riscv_delay_line_instance_q15 * S,
+  uint16_t length,
   q15_t * pState);
 
   /**
-   * @brief Q15 matrix multiplication (fast variant) for Cortex-M3 and Cortex-M4
-   * @param[in]       *pSrcA  points to the first input matrix structure
-   * @param[in]       *pSrcB  points to the second input matrix structure
-   * @param[out]      *pDst   points to output matrix structure
-   * @param[in]		  *pState points to the array for storing intermediate results
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief  Appends a block of samples to the Q15 fractional delay line.
+   * @param[in,out] *S          points to an instance of the Q15 delay line structure.
+   * @param[in]     *pSrc       points to the block of input data.
+   * @param[in]     blockSize   number of samples to append.
+   * @return none.
    */
-
-  riscv_status riscv_mat_mult_fast_q15(
-  const riscv_matrix_instance_q15 * pSrcA,
-  const riscv_matrix_instance_q15 * pSrcB,
-  riscv_matrix_instance_q15 * pDst,
-  q15_t * pState);
+  void riscv_delay_line_write_q15(
+  riscv_delay_line_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize);
 
   /**
-   * @brief Q31 matrix multiplication
-   * @param[in]       *pSrcA points to the first input matrix structure
-   * @param[in]       *pSrcB points to the second input matrix structure
-   * @param[out]      *pDst points to output matrix structure
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief  Reads the last block written to the Q15 fractional delay line through a set of taps.
+   * @param[in]     *S          points to an instance of the Q15 delay line structure.
+   * @param[in,out] *pTaps      points to the taps, their delays move to their targets.
+   * @param[in]     numTaps     number of taps.
+   * @param[out]    *pDst       points to the block of output data, the weighted sum of the taps.
+   * @param[in]     blockSize   number of samples to read.
+   * @return none.
    */
+  void riscv_delay_line_read_q15(
+  const riscv_delay_line_instance_q15 * S,
+  riscv_delay_line_tap_q15 * pTaps,
+  uint16_t numTaps,
+  q15_t * pDst,
+  uint32_t blockSize);
 
-  riscv_status riscv_mat_mult_q31(
-  const riscv_matrix_instance_q31 * pSrcA,
-  const riscv_matrix_instance_q31 * pSrcB,
-  riscv_matrix_instance_q31 * pDst);
 
   /**
-   * @brief Q31 matrix multiplication (fast variant) for Cortex-M3 and Cortex-M4
-   * @param[in]       *pSrcA points to the first input matrix structure
-   * @param[in]       *pSrcB points to the second input matrix structure
-   * @param[out]      *pDst points to output matrix structure
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief Instance structure for the Q15 Biquad cascade filter.
    */
+  typedef struct
+  {
+    int8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q15_t *pState;            /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
+    q15_t *pCoeffs;           /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+    int8_t postShift;         /**< Additional shift, in bits, applied to each output sample. */
 
-  riscv_status riscv_mat_mult_fast_q31(
-  const riscv_matrix_instance_q31 * pSrcA,
-  const riscv_matrix_instance_q31 * pSrcB,
-  riscv_matrix_instance_q31 * pDst);
+  } riscv_biquad_casd_df1_inst_q15;
 
 
   /**
-   * @brief Floating-point matrix subtraction
-   * @param[in]       *pSrcA points to the first input matrix structure
-   * @param[in]       *pSrcB points to the second input matrix structure
-   * @param[out]      *pDst points to output matrix structure
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief Instance structure for the Q31 Biquad cascade filter.
    */
+  typedef struct
+  {
+    uint32_t numStages;      /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q31_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
+    q31_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
 
-  riscv_status riscv_mat_sub_f32(
-  const riscv_matrix_instance_f32 * pSrcA,
-  const riscv_matrix_instance_f32 * pSrcB,
-  riscv_matrix_instance_f32 * pDst);
+  } riscv_biquad_casd_df1_inst_q31;
 
   /**
-   * @brief Q15 matrix subtraction
-   * @param[in]       *pSrcA points to the first input matrix structure
-   * @param[in]       *pSrcB points to the second input matrix structure
-   * @param[out]      *pDst points to output matrix structure
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief Instance structure for the floating-point Biquad cascade filter.
    */
+  typedef struct
+  {
+    uint32_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;          /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
+    float32_t *pCoeffs;         /**< Points to the array of coefficients.  The array is of length 5*numStages. */
 
-  riscv_status riscv_mat_sub_q15(
-  const riscv_matrix_instance_q15 * pSrcA,
-  const riscv_matrix_instance_q15 * pSrcB,
-  riscv_matrix_instance_q15 * pDst);
-
-  /**
-   * @brief Q31 matrix subtraction
-   * @param[in]       *pSrcA points to the first input matrix structure
-   * @param[in]       *pSrcB points to the second input matrix structure
-   * @param[out]      *pDst points to output matrix structure
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
-   */
 
-  riscv_status riscv_mat_sub_q31(
-  const riscv_matrix_instance_q31 * pSrcA,
-  const riscv_matrix_instance_q31 * pSrcB,
-  riscv_matrix_instance_q31 * pDst);
+  } riscv_biquad_casd_df1_inst_f32;
 
-  /**
-   * @brief Floating-point matrix scaling.
-   * @param[in]  *pSrc points to the input matrix
-   * @param[in]  scale scale factor
-   * @param[out] *pDst points to the output matrix
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
-   */
 
-  riscv_status riscv_mat_scale_f32(
-  const riscv_matrix_instance_f32 * pSrc,
-  float32_t scale,
-  riscv_matrix_instance_f32 * pDst);
 
   /**
-   * @brief Q15 matrix scaling.
-   * @param[in]       *pSrc points to input matrix
-   * @param[in]       scaleFract fractional portion of the scale factor
-   * @param[in]       shift number of bits to shift the result by
-   * @param[out]      *pDst points to output matrix
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief Processing function for the Q15 Biquad cascade filter.
+   * @param[in]  *S points to an instance of the Q15 Biquad cascade structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
    */
 
-  riscv_status riscv_mat_scale_q15(
-  const riscv_matrix_instance_q15 * pSrc,
-  q15_t scaleFract,
-  int32_t shift,
-  riscv_matrix_instance_q15 * pDst);
+  void riscv_biquad_cascade_df1_q15(
+  const riscv_biquad_casd_df1_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
   /**
-   * @brief Q31 matrix scaling.
-   * @param[in]       *pSrc points to input matrix
-   * @param[in]       scaleFract fractional portion of the scale factor
-   * @param[in]       shift number of bits to shift the result by
-   * @param[out]      *pDst points to output matrix structure
-   * @return     The function returns either
-   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   * @brief  Initialization function for the Q15 Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the Q15 Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
    */
 
-  riscv_status riscv_mat_scale_q31(
-  const riscv_matrix_instance_q31 * pSrc,
-  q31_t scaleFract,
-  int32_t shift,
-  riscv_matrix_instance_q31 * pDst);
-
+  void riscv_biquad_cascade_df1_init_q15(
+  riscv_biquad_casd_df1_inst_q15 * S,
+  uint8_t numStages,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  int8_t postShift);
 
   /**
-   * @brief  Q31 matrix initialization.
-   * @param[in,out] *S             points to an instance of the floating-point matrix structure.
-   * @param[in]     nRows          number of rows in the matrix.
-   * @param[in]     nColumns       number of columns in the matrix.
-   * @param[in]     *pData	       points to the matrix data array.
-   * @return        none
+   * @brief Instance structure for the Q15 Biquad cascade filter of interleaved stereo data.
    */
-
-  void riscv_mat_init_q31(
-  riscv_matrix_instance_q31 * S,
-  uint16_t nRows,
-  uint16_t nColumns,
-  q31_t * pData);
+  typedef struct
+  {
+    uint8_t numStages;        /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q15_t *pState;            /**< points to the array of state variables.  The array is of length 8*numStages. */
+    const q15_t *pCoeffs;     /**< points to the array of coefficients shared by the two channels.  The array is of length 6*numStages. */
+    int8_t postShift;         /**< additional shift, in bits, applied to each output sample. */
+  } riscv_biquad_cascade_stereo_df1_instance_q15;
 
   /**
-   * @brief  Q15 matrix initialization.
-   * @param[in,out] *S             points to an instance of the floating-point matrix structure.
-   * @param[in]     nRows          number of rows in the matrix.
-   * @param[in]     nColumns       number of columns in the matrix.
-   * @param[in]     *pData	       points to the matrix data array.
+   * @brief  Initialization function for the Q15 Biquad cascade filter of stereo data.
+   * @param[in,out] *S           points to an instance of the stereo Q15 Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients, in the order of riscv_biquad_cascade_df1_init_q15().
+   * @param[in]     *pState      points to the state buffer of 8*numStages values.
+   * @param[in]     postShift    shift to be applied to the accumulator result.
    * @return        none
    */
 
-  void riscv_mat_init_q15(
-  riscv_matrix_instance_q15 * S,
-  uint16_t nRows,
-  uint16_t nColumns,
-  q15_t * pData);
+  void riscv_biquad_cascade_stereo_df1_init_q15(
+  riscv_biquad_cascade_stereo_df1_instance_q15 * S,
+  uint8_t numStages,
+  const q15_t * pCoeffs,
+  q15_t * pState,
+  int8_t postShift);
 
   /**
-   * @brief  Floating-point matrix initialization.
-   * @param[in,out] *S             points to an instance of the floating-point matrix structure.
-   * @param[in]     nRows          number of rows in the matrix.
-   * @param[in]     nColumns       number of columns in the matrix.
-   * @param[in]     *pData	       points to the matrix data array.
-   * @return        none
+   * @brief Processing function for the Q15 Biquad cascade filter of stereo data.
+   * @param[in]  *S         points to an instance of the stereo Q15 Biquad cascade structure.
+   * @param[in]  *pSrc      points to the block of interleaved input pairs {left, right}.
+   * @param[out] *pDst      points to the block of interleaved output pairs.
+   * @param[in]  blockSize  number of sample pairs to process.
+   * @return none.
    */
 
-  void riscv_mat_init_f32(
-  riscv_matrix_instance_f32 * S,
-  uint16_t nRows,
-  uint16_t nColumns,
-  float32_t * pData);
-
+  void riscv_biquad_cascade_stereo_df1_q15(
+  const riscv_biquad_cascade_stereo_df1_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the Q15 PID Control.
+   * @brief  Filters one sample through the Q15 Biquad cascade filter, for interrupt handlers.
+   * @param[in,out] *S   points to an instance of the Q15 Biquad cascade structure.
+   * @param[in]     in   input sample.
+   * @return        output sample.
+   *
+   * \par
+   * Runs the stages of riscv_biquad_cascade_df1_q15() on one sample, bit exact with a call of it with a
+   * block size of 1 but without its grouping of the stages and block loops.  With <code>USE_DSP_RISCV</code>
+   * a stage is two dot products on the state pairs, the coefficients and states must be 32-bit aligned.
    */
-  typedef struct
+
+  static inline q15_t riscv_biquad_df1_sample_q15(
+  const riscv_biquad_casd_df1_inst_q15 * S,
+  q15_t in)
   {
-    q15_t A0;  
+    const q15_t *pCoeffs = S->pCoeffs;
+    q15_t *pState = S->pState;
+    int32_t shift = 15 - (int32_t) S->postShift;
+    uint32_t stage;
+    q63_t acc;
 
+    for (stage = (uint32_t) S->numStages; stage > 0u; stage--)
+    {
+      /* acc = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      acc = (q31_t) pCoeffs[0] * in;
 #if defined (USE_DSP_RISCV)
-    shortV A1;        
+      shortV Xn12 = *(shortV *) pState, Yn12 = *(shortV *) (pState + 2);
+
+      acc += dotpv2(*(const shortV *) (pCoeffs + 2), Xn12);
+      acc += dotpv2(*(const shortV *) (pCoeffs + 4), Yn12);
+      acc = clip((acc >> shift), -32768, 32767);
+
+      *(shortV *) pState = pack2(in, Xn12[0]);
+      *(shortV *) (pState + 2) = pack2((q15_t) acc, Yn12[0]);
 #else
-    q15_t A1;
-    q15_t A2;
-#endif         
-    q15_t state[3];     /**< The state array of length 3. */
-    q15_t Kp;           /**< The proportional gain. */
-    q15_t Ki;           /**< The integral gain. */
-    q15_t Kd;           /**< The derivative gain. */
-  } riscv_pid_instance_q15;
-
-  /**
-   * @brief Instance structure for the Q31 PID Control.
-   */
-  typedef struct
-  {
-    q31_t A0;            /**< The derived gain, A0 = Kp + Ki + Kd . */
-    q31_t A1;            /**< The derived gain, A1 = -Kp - 2Kd. */
-    q31_t A2;            /**< The derived gain, A2 = Kd . */
-    q31_t state[3];      /**< The state array of length 3. */
-    q31_t Kp;            /**< The proportional gain. */
-    q31_t Ki;            /**< The integral gain. */
-    q31_t Kd;            /**< The derivative gain. */
-  } riscv_pid_instance_q31;
-
-  /**
-   * @brief Instance structure for the floating-point PID Control.
-   */
-  typedef struct
-  {
-    float32_t A0;          /**< The derived gain, A0 = Kp + Ki + Kd . */
-    float32_t A1;          /**< The derived gain, A1 = -Kp - 2Kd. */
-    float32_t A2;          /**< The derived gain, A2 = Kd . */
-    float32_t state[3];    /**< The state array of length 3. */
-    float32_t Kp;          /**< The proportional gain. */
-    float32_t Ki;          /**< The integral gain. */
-    float32_t Kd;          /**< The derivative gain. */
-  } riscv_pid_instance_f32;
+      acc += (q31_t) pCoeffs[2] * pState[0];
+      acc += (q31_t) pCoeffs[3] * pState[1];
+      acc += (q31_t) pCoeffs[4] * pState[2];
+      acc += (q31_t) pCoeffs[5] * pState[3];
+      acc = __SSAT((acc >> shift), 16);
+
+      pState[1] = pState[0];
+      pState[0] = in;
+      pState[3] = pState[2];
+      pState[2] = (q15_t) acc;
+#endif
+      in = (q15_t) acc;
+      pCoeffs += 6;
+      pState += 4;
+    }
 
+    return (in);
+  }
 
 
   /**
-   * @brief  Initialization function for the floating-point PID Control.
-   * @param[in,out] S               points to an instance of the PID structure.
-   * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state 1 = reset the state.
+   * @brief Fast but less precise processing function for the Q15 Biquad cascade filter for Cortex-M3 and Cortex-M4.
+   * @param[in]  *S points to an instance of the Q15 Biquad cascade structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
    */
-  void riscv_pid_init_f32(
-  riscv_pid_instance_f32 * S,
-  int32_t resetStateFlag);
+
+  void riscv_biquad_cascade_df1_fast_q15(
+  const riscv_biquad_casd_df1_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
 
   /**
-   * @brief  Reset function for the floating-point PID Control.
-   * @param[in,out] S  is an instance of the floating-point PID Control structure
+   * @brief Processing function for the Q31 Biquad cascade filter
+   * @param[in]  *S         points to an instance of the Q31 Biquad cascade structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   * @return     none.
    */
-  void riscv_pid_reset_f32(
-  riscv_pid_instance_f32 * S);
 
+  void riscv_biquad_cascade_df1_q31(
+  const riscv_biquad_casd_df1_inst_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the Q31 PID Control.
-   * @param[in,out] S               points to an instance of the Q15 PID structure.
-   * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state 1 = reset the state.
+   * @brief Fast but less precise processing function for the Q31 Biquad cascade filter for Cortex-M3 and Cortex-M4.
+   * @param[in]  *S         points to an instance of the Q31 Biquad cascade structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   * @return     none.
    */
-  void riscv_pid_init_q31(
-  riscv_pid_instance_q31 * S,
-  int32_t resetStateFlag);
 
+  void riscv_biquad_cascade_df1_fast_q31(
+  const riscv_biquad_casd_df1_inst_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
   /**
-   * @brief  Reset function for the Q31 PID Control.
-   * @param[in,out] S   points to an instance of the Q31 PID Control structure
+   * @brief  Initialization function for the Q31 Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the Q31 Biquad cascade structure.
+   * @param[in]     numStages      number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
    */
 
-  void riscv_pid_reset_q31(
-  riscv_pid_instance_q31 * S);
-
+  void riscv_biquad_cascade_df1_init_q31(
+  riscv_biquad_casd_df1_inst_q31 * S,
+  uint8_t numStages,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift);
 
   /**
-   * @brief  Initialization function for the Q15 PID Control.
-   * @param[in,out] S               points to an instance of the Q15 PID structure.
-   * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state 1 = reset the state.
+   * @brief Processing function for the floating-point Biquad cascade filter.
+   * @param[in]  *S         points to an instance of the floating-point Biquad cascade structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   * @return     none.
    */
-  void riscv_pid_init_q15(
-  riscv_pid_instance_q15 * S,
-  int32_t resetStateFlag);
 
+  void riscv_biquad_cascade_df1_f32(
+  const riscv_biquad_casd_df1_inst_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
   /**
-   * @brief  Reset function for the Q15 PID Control.
-   * @param[in,out] S  points to an instance of the q15 PID Control structure
+   * @brief  Initialization function for the floating-point Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the floating-point Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
    */
-  void riscv_pid_reset_q15(
-  riscv_pid_instance_q15 * S);
 
+  void riscv_biquad_cascade_df1_init_f32(
+  riscv_biquad_casd_df1_inst_f32 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pState);
 
   /**
-   * @brief Instance structure for the floating-point Linear Interpolate function.
+   * @brief Coefficients of a Q15 Biquad cascade filter shared by several streams, see riscv_biquad_cascade_df1_shared_q15().
    */
   typedef struct
   {
-    uint32_t nValues;           /**< nValues */
-    float32_t x1;               /**< x1 */
-    float32_t xSpacing;         /**< xSpacing */
-    float32_t *pYData;          /**< pointer to the table of Y values */
-  } riscv_linear_interp_instance_f32;
+    int8_t numStages;               /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    const q15_t *pCoeffs;           /**< Points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t postShift;               /**< Additional shift, in bits, applied to each output sample. */
+  } riscv_biquad_casd_df1_shared_coefs_q15;
 
   /**
-   * @brief Instance structure for the floating-point bilinear interpolation function.
+   * @brief State of one stream of a shared Q15 Biquad cascade filter.
    */
-
   typedef struct
   {
-    uint16_t numRows;   /**< number of rows in the data table. */
-    uint16_t numCols;   /**< number of columns in the data table. */
-    float32_t *pData;   /**< points to the data table. */
-  } riscv_bilinear_interp_instance_f32;
+    const riscv_biquad_casd_df1_shared_coefs_q15 *pCoefs;  /**< points to the shared coefficients. */
+    q15_t *pState;                                         /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
+  } riscv_biquad_casd_df1_shared_state_q15;
 
-   /**
-   * @brief Instance structure for the Q31 bilinear interpolation function.
+  /**
+   * @brief  Initialization function for the shared coefficients of a Q15 Biquad cascade filter.
+   * @param[out] *C         points to the shared coefficients.
+   * @param[in]  numStages  number of 2nd order stages in the filter.
+   * @param[in]  *pCoeffs   points to the filter coefficients.
+   * @param[in]  postShift  shift applied to each output sample.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numStages is 0.
    */
+  riscv_status riscv_biquad_cascade_df1_shared_coefs_init_q15(
+  riscv_biquad_casd_df1_shared_coefs_q15 * C,
+  uint8_t numStages,
+  const q15_t * pCoeffs,
+  int8_t postShift);
 
-  typedef struct
-  {
-    uint16_t numRows;   /**< number of rows in the data table. */
-    uint16_t numCols;   /**< number of columns in the data table. */
-    q31_t *pData;       /**< points to the data table. */
-  } riscv_bilinear_interp_instance_q31;
+  /**
+   * @brief  Initialization function for one stream of a shared Q15 Biquad cascade filter.
+   * @param[out] *T       points to the state of the stream.
+   * @param[in]  *C       points to the shared coefficients.
+   * @param[in]  *pState  points to the state buffer of the stream, of length 4*numStages.
+   * @return     none.
+   */
+  void riscv_biquad_cascade_df1_shared_state_init_q15(
+  riscv_biquad_casd_df1_shared_state_q15 * T,
+  const riscv_biquad_casd_df1_shared_coefs_q15 * C,
+  q15_t * pState);
 
-   /**
-   * @brief Instance structure for the Q15 bilinear interpolation function.
+  /**
+   * @brief  Processing function for one stream of a shared Q15 Biquad cascade filter.
+   * @param[in,out] *T         points to the state of the stream.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        none.
    */
+  void riscv_biquad_cascade_df1_shared_q15(
+  riscv_biquad_casd_df1_shared_state_q15 * T,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
+  /**
+   * @brief Coefficients of a Q31 Biquad cascade filter shared by several streams, see riscv_biquad_cascade_df1_shared_q31().
+   */
   typedef struct
   {
-    uint16_t numRows;   /**< number of rows in the data table. */
-    uint16_t numCols;   /**< number of columns in the data table. */
-    q15_t *pData;       /**< points to the data table. */
-  } riscv_bilinear_interp_instance_q15;
+    uint32_t numStages;             /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    const q31_t *pCoeffs;           /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;              /**< Additional shift, in bits, applied to each output sample. */
+  } riscv_biquad_casd_df1_shared_coefs_q31;
 
-   /**
-   * @brief Instance structure for the Q15 bilinear interpolation function.
+  /**
+   * @brief State of one stream of a shared Q31 Biquad cascade filter.
    */
-
   typedef struct
   {
-    uint16_t numRows;   /**< number of rows in the data table. */
-    uint16_t numCols;   /**< number of columns in the data table. */
-    q7_t *pData;                /**< points to the data table. */
-  } riscv_bilinear_interp_instance_q7;
+    const riscv_biquad_casd_df1_shared_coefs_q31 *pCoefs;  /**< points to the shared coefficients. */
+    q31_t *pState;                                         /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
+  } riscv_biquad_casd_df1_shared_state_q31;
 
+  /**
+   * @brief  Initialization function for the shared coefficients of a Q31 Biquad cascade filter.
+   * @param[out] *C         points to the shared coefficients.
+   * @param[in]  numStages  number of 2nd order stages in the filter.
+   * @param[in]  *pCoeffs   points to the filter coefficients.
+   * @param[in]  postShift  shift applied to each output sample.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numStages is 0.
+   */
+  riscv_status riscv_biquad_cascade_df1_shared_coefs_init_q31(
+  riscv_biquad_casd_df1_shared_coefs_q31 * C,
+  uint8_t numStages,
+  const q31_t * pCoeffs,
+  int8_t postShift);
 
   /**
-   * @brief Q7 vector multiplication.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst  points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief  Initialization function for one stream of a shared Q31 Biquad cascade filter.
+   * @param[out] *T       points to the state of the stream.
+   * @param[in]  *C       points to the shared coefficients.
+   * @param[in]  *pState  points to the state buffer of the stream, of length 4*numStages.
+   * @return     none.
    */
+  void riscv_biquad_cascade_df1_shared_state_init_q31(
+  riscv_biquad_casd_df1_shared_state_q31 * T,
+  const riscv_biquad_casd_df1_shared_coefs_q31 * C,
+  q31_t * pState);
 
-  void riscv_mult_q7(
-  q7_t * pSrcA,
-  q7_t * pSrcB,
-  q7_t * pDst,
+  /**
+   * @brief  Processing function for one stream of a shared Q31 Biquad cascade filter.
+   * @param[in,out] *T         points to the state of the stream.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        none.
+   */
+  void riscv_biquad_cascade_df1_shared_q31(
+  riscv_biquad_casd_df1_shared_state_q31 * T,
+  q31_t * pSrc,
+  q31_t * pDst,
   uint32_t blockSize);
 
   /**
-   * @brief Q15 vector multiplication.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst  points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Coefficients of a floating-point Biquad cascade filter shared by several streams, see riscv_biquad_cascade_df1_shared_f32().
    */
-
-  void riscv_mult_q15(
-  q15_t * pSrcA,
-  q15_t * pSrcB,
-  q15_t * pDst,
-  uint32_t blockSize);
+  typedef struct
+  {
+    uint32_t numStages;             /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    const float32_t *pCoeffs;       /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+  } riscv_biquad_casd_df1_shared_coefs_f32;
 
   /**
-   * @brief Q31 vector multiplication.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief State of one stream of a shared floating-point Biquad cascade filter.
    */
+  typedef struct
+  {
+    const riscv_biquad_casd_df1_shared_coefs_f32 *pCoefs;  /**< points to the shared coefficients. */
+    float32_t *pState;                                     /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
+  } riscv_biquad_casd_df1_shared_state_f32;
 
-  void riscv_mult_q31(
-  q31_t * pSrcA,
-  q31_t * pSrcB,
-  q31_t * pDst,
-  uint32_t blockSize);
+  /**
+   * @brief  Initialization function for the shared coefficients of a floating-point Biquad cascade filter.
+   * @param[out] *C         points to the shared coefficients.
+   * @param[in]  numStages  number of 2nd order stages in the filter.
+   * @param[in]  *pCoeffs   points to the filter coefficients.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numStages is 0.
+   */
+  riscv_status riscv_biquad_cascade_df1_shared_coefs_init_f32(
+  riscv_biquad_casd_df1_shared_coefs_f32 * C,
+  uint8_t numStages,
+  const float32_t * pCoeffs);
 
   /**
-   * @brief Floating-point vector multiplication.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief  Initialization function for one stream of a shared floating-point Biquad cascade filter.
+   * @param[out] *T       points to the state of the stream.
+   * @param[in]  *C       points to the shared coefficients.
+   * @param[in]  *pState  points to the state buffer of the stream, of length 4*numStages.
+   * @return     none.
    */
+  void riscv_biquad_cascade_df1_shared_state_init_f32(
+  riscv_biquad_casd_df1_shared_state_f32 * T,
+  const riscv_biquad_casd_df1_shared_coefs_f32 * C,
+  float32_t * pState);
 
-  void riscv_mult_f32(
-  float32_t * pSrcA,
-  float32_t * pSrcB,
+  /**
+   * @brief  Processing function for one stream of a shared floating-point Biquad cascade filter.
+   * @param[in,out] *T         points to the state of the stream.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return        none.
+   */
+  void riscv_biquad_cascade_df1_shared_f32(
+  riscv_biquad_casd_df1_shared_state_f32 * T,
+  float32_t * pSrc,
   float32_t * pDst,
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the floating-point matrix structure.
+   */
 
-
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    float32_t *pData;     /**< points to the data of the matrix. */
+  } riscv_matrix_instance_f32;
 
 
   /**
-   * @brief Instance structure for the Q15 CFFT/CIFFT function.
+   * @brief Instance structure for the floating-point matrix structure.
    */
 
   typedef struct
   {
-    uint16_t fftLen;                 /**< length of the FFT. */
-    uint8_t ifftFlag;                /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
-    uint8_t bitReverseFlag;          /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
-    q15_t *pTwiddle;                     /**< points to the Sin twiddle factor table. */
-    uint16_t *pBitRevTable;          /**< points to the bit reversal table. */
-    uint16_t twidCoefModifier;       /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
-    uint16_t bitRevFactor;           /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
-  } riscv_cfft_radix2_instance_q15;
-
-/* Deprecated */
-  riscv_status riscv_cfft_radix2_init_q15(
-  riscv_cfft_radix2_instance_q15 * S,
-  uint16_t fftLen,
-  uint8_t ifftFlag,
-  uint8_t bitReverseFlag);
-
-/* Deprecated */
-  void riscv_cfft_radix2_q15(
-  const riscv_cfft_radix2_instance_q15 * S,
-  q15_t * pSrc);
-
-
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    float64_t *pData;     /**< points to the data of the matrix. */
+  } riscv_matrix_instance_f64;
 
   /**
-   * @brief Instance structure for the Q15 CFFT/CIFFT function.
+   * @brief Instance structure for the Q7 matrix structure.
    */
 
   typedef struct
   {
-    uint16_t fftLen;                 /**< length of the FFT. */
-    uint8_t ifftFlag;                /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
-    uint8_t bitReverseFlag;          /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
-    q15_t *pTwiddle;                 /**< points to the twiddle factor table. */
-    uint16_t *pBitRevTable;          /**< points to the bit reversal table. */
-    uint16_t twidCoefModifier;       /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
-    uint16_t bitRevFactor;           /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
-  } riscv_cfft_radix4_instance_q15;
-
-/* Deprecated */
-  riscv_status riscv_cfft_radix4_init_q15(
-  riscv_cfft_radix4_instance_q15 * S,
-  uint16_t fftLen,
-  uint8_t ifftFlag,
-  uint8_t bitReverseFlag);
-
-/* Deprecated */
-  void riscv_cfft_radix4_q15(
-  const riscv_cfft_radix4_instance_q15 * S,
-  q15_t * pSrc);
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    q7_t *pData;          /**< points to the data of the matrix. */
+  } riscv_matrix_instance_q7;
 
   /**
-   * @brief Instance structure for the Radix-2 Q31 CFFT/CIFFT function.
+   * @brief Requantization parameters of riscv_mat_mult_q7() and riscv_mat_vec_mult_q4_q7().
    */
 
   typedef struct
   {
-    uint16_t fftLen;                 /**< length of the FFT. */
-    uint8_t ifftFlag;                /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
-    uint8_t bitReverseFlag;          /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
-    q31_t *pTwiddle;                     /**< points to the Twiddle factor table. */
-    uint16_t *pBitRevTable;          /**< points to the bit reversal table. */
-    uint16_t twidCoefModifier;       /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
-    uint16_t bitRevFactor;           /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
-  } riscv_cfft_radix2_instance_q31;
-
-/* Deprecated */
-  riscv_status riscv_cfft_radix2_init_q31(
-  riscv_cfft_radix2_instance_q31 * S,
-  uint16_t fftLen,
-  uint8_t ifftFlag,
-  uint8_t bitReverseFlag);
-
-/* Deprecated */
-  void riscv_cfft_radix2_q31(
-  const riscv_cfft_radix2_instance_q31 * S,
-  q31_t * pSrc);
+    uint16_t numMult;          /**< number of multipliers, 1 (per-tensor) or the number of rows of the output (per-row). */
+    const q31_t *pMultiplier;  /**< points to the Q31 multipliers. */
+    const uint8_t *pShift;     /**< points to the right shifts applied after the multiplication. */
+    q31_t offset;              /**< output offset (zero point) added after the shift. */
+  } riscv_mat_requant_q7;
 
   /**
-   * @brief Instance structure for the Q31 CFFT/CIFFT function.
+   * @brief Instance structure for a matrix of 4-bit weights packed by riscv_mat_pack_q4().
    */
 
   typedef struct
   {
-    uint16_t fftLen;                 /**< length of the FFT. */
-    uint8_t ifftFlag;                /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
-    uint8_t bitReverseFlag;          /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
-    q31_t *pTwiddle;                 /**< points to the twiddle factor table. */
-    uint16_t *pBitRevTable;          /**< points to the bit reversal table. */
-    uint16_t twidCoefModifier;       /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
-    uint16_t bitRevFactor;           /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
-  } riscv_cfft_radix4_instance_q31;
+    uint16_t numRows;                  /**< number of rows of the matrix.     */
+    uint16_t numCols;                  /**< number of columns of the matrix.  */
+    const uint8_t *pData;              /**< points to the packed weights, RISCV_MAT_Q4_ROW_BYTES(numCols) bytes per row, word aligned. */
+    const int8_t *pZero;               /**< points to the zero points of the rows, or NULL for symmetric weights. */
+    const riscv_mat_requant_q7 *pRq;   /**< points to the per-row or per-tensor scale of the output, or NULL. */
+  } riscv_matrix_instance_q4;
 
-/* Deprecated */
-  void riscv_cfft_radix4_q31(
-  const riscv_cfft_radix4_instance_q31 * S,
-  q31_t * pSrc);
+  /**
+   * @brief Bytes of a row of <code>numCols</code> packed 4-bit weights, a whole number of words.
+   */
 
-/* Deprecated */
-  riscv_status riscv_cfft_radix4_init_q31(
-  riscv_cfft_radix4_instance_q31 * S,
-  uint16_t fftLen,
-  uint8_t ifftFlag,
-  uint8_t bitReverseFlag);
+#define RISCV_MAT_Q4_ROW_BYTES(numCols) ((((uint32_t) (numCols) + 7u) >> 3u) << 2u)
 
   /**
-   * @brief Instance structure for the floating-point CFFT/CIFFT function.
+   * @brief Instance structure for the Q15 matrix structure.
    */
 
   typedef struct
   {
-    uint16_t fftLen;                   /**< length of the FFT. */
-    uint8_t ifftFlag;                  /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
-    uint8_t bitReverseFlag;            /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
-    float32_t *pTwiddle;               /**< points to the Twiddle factor table. */
-    uint16_t *pBitRevTable;            /**< points to the bit reversal table. */
-    uint16_t twidCoefModifier;         /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
-    uint16_t bitRevFactor;             /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
-    float32_t onebyfftLen;                 /**< value of 1/fftLen. */
-  } riscv_cfft_radix2_instance_f32;
-
-/* Deprecated */
-  riscv_status riscv_cfft_radix2_init_f32(
-  riscv_cfft_radix2_instance_f32 * S,
-  uint16_t fftLen,
-  uint8_t ifftFlag,
-  uint8_t bitReverseFlag);
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    q15_t *pData;         /**< points to the data of the matrix. */
 
-/* Deprecated */
-  void riscv_cfft_radix2_f32(
-  const riscv_cfft_radix2_instance_f32 * S,
-  float32_t * pSrc);
+  } riscv_matrix_instance_q15;
 
   /**
-   * @brief Instance structure for the floating-point CFFT/CIFFT function.
+   * @brief Instance structure for the Q31 matrix structure.
    */
 
   typedef struct
   {
-    uint16_t fftLen;                   /**< length of the FFT. */
-    uint8_t ifftFlag;                  /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
-    uint8_t bitReverseFlag;            /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
-    float32_t *pTwiddle;               /**< points to the Twiddle factor table. */
-    uint16_t *pBitRevTable;            /**< points to the bit reversal table. */
-    uint16_t twidCoefModifier;         /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
-    uint16_t bitRevFactor;             /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
-    float32_t onebyfftLen;                 /**< value of 1/fftLen. */
-  } riscv_cfft_radix4_instance_f32;
-
-/* Deprecated */
-  riscv_status riscv_cfft_radix4_init_f32(
-  riscv_cfft_radix4_instance_f32 * S,
-  uint16_t fftLen,
-  uint8_t ifftFlag,
-  uint8_t bitReverseFlag);
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    q31_t *pData;         /**< points to the data of the matrix. */
 
-/* Deprecated */
-  void riscv_cfft_radix4_f32(
-  const riscv_cfft_radix4_instance_f32 * S,
-  float32_t * pSrc);
+  } riscv_matrix_instance_q31;
 
   /**
-   * @brief Instance structure for the fixed-point CFFT/CIFFT function.
+   * @brief Q15 block floating-point vector, element n has the value pData[n] * 2^exponent.
    */
 
   typedef struct
   {
-    uint16_t fftLen;                   /**< length of the FFT. */
-    const q15_t *pTwiddle;             /**< points to the Twiddle factor table. */
-    const uint16_t *pBitRevTable;      /**< points to the bit reversal table. */
-    uint16_t bitRevLength;             /**< bit reversal table length. */
-  } riscv_cfft_instance_q15;
+    q15_t *pData;         /**< points to the 1.15 mantissas. */
+    uint32_t blockSize;   /**< number of mantissas.          */
+    int16_t exponent;     /**< exponent shared by the block. */
 
-void riscv_cfft_q15( 
-    const riscv_cfft_instance_q15 * S, 
-    q15_t * p1,
-    uint8_t ifftFlag,
-    uint8_t bitReverseFlag);  
+  } riscv_bfp_q15;
 
   /**
-   * @brief Instance structure for the fixed-point CFFT/CIFFT function.
+   * @brief Q31 block floating-point vector, element n has the value pData[n] * 2^exponent.
    */
 
   typedef struct
   {
-    uint16_t fftLen;                   /**< length of the FFT. */
-    const q31_t *pTwiddle;             /**< points to the Twiddle factor table. */
-    const uint16_t *pBitRevTable;      /**< points to the bit reversal table. */
-    uint16_t bitRevLength;             /**< bit reversal table length. */
-  } riscv_cfft_instance_q31;
+    q31_t *pData;         /**< points to the 1.31 mantissas. */
+    uint32_t blockSize;   /**< number of mantissas.          */
+    int16_t exponent;     /**< exponent shared by the block. */
 
-void riscv_cfft_q31( 
-    const riscv_cfft_instance_q31 * S, 
-    q31_t * p1,
-    uint8_t ifftFlag,
-    uint8_t bitReverseFlag);  
-  
-  /**
-   * @brief Instance structure for the floating-point CFFT/CIFFT function.
-   */
+  } riscv_bfp_q31;
 
-  typedef struct
-  {
-    uint16_t fftLen;                   /**< length of the FFT. */
-    const float32_t *pTwiddle;         /**< points to the Twiddle factor table. */
-    const uint16_t *pBitRevTable;      /**< points to the bit reversal table. */
-    uint16_t bitRevLength;             /**< bit reversal table length. */
-  } riscv_cfft_instance_f32;
 
-  void riscv_cfft_f32(
-  const riscv_cfft_instance_f32 * S,
-  float32_t * p1,
-  uint8_t ifftFlag,
-  uint8_t bitReverseFlag);
 
   /**
-   * @brief Instance structure for the Q15 RFFT/RIFFT function.
+   * @brief Floating-point matrix addition.
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  typedef struct
-  {
-    uint32_t fftLenReal;                      /**< length of the real FFT. */
-    uint8_t ifftFlagR;                        /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
-    uint8_t bitReverseFlagR;                  /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
-    uint32_t twidCoefRModifier;               /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
-    q15_t *pTwiddleAReal;                     /**< points to the real twiddle factor table. */
-    q15_t *pTwiddleBReal;                     /**< points to the imag twiddle factor table. */
-    const riscv_cfft_instance_q15 *pCfft;       /**< points to the complex FFT instance. */
-  } riscv_rfft_instance_q15;
-
-  riscv_status riscv_rfft_init_q15(
-  riscv_rfft_instance_q15 * S,
-  uint32_t fftLenReal,
-  uint32_t ifftFlagR,
-  uint32_t bitReverseFlag);
-
-  void riscv_rfft_q15(
-  const riscv_rfft_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst);
+  riscv_status riscv_mat_add_f32(
+  const riscv_matrix_instance_f32 * pSrcA,
+  const riscv_matrix_instance_f32 * pSrcB,
+  riscv_matrix_instance_f32 * pDst);
 
   /**
-   * @brief Instance structure for the Q31 RFFT/RIFFT function.
+   * @brief Q15 matrix addition.
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  typedef struct
-  {
-    uint32_t fftLenReal;                        /**< length of the real FFT. */
-    uint8_t ifftFlagR;                          /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
-    uint8_t bitReverseFlagR;                    /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
-    uint32_t twidCoefRModifier;                 /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
-    q31_t *pTwiddleAReal;                       /**< points to the real twiddle factor table. */
-    q31_t *pTwiddleBReal;                       /**< points to the imag twiddle factor table. */
-    const riscv_cfft_instance_q31 *pCfft;         /**< points to the complex FFT instance. */
-  } riscv_rfft_instance_q31;
+  riscv_status riscv_mat_add_q15(
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst);
 
-  riscv_status riscv_rfft_init_q31(
-  riscv_rfft_instance_q31 * S,
-  uint32_t fftLenReal,
-  uint32_t ifftFlagR,
-  uint32_t bitReverseFlag);
+  /**
+   * @brief Q31 matrix addition.
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
 
-  void riscv_rfft_q31(
-  const riscv_rfft_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst);
+  riscv_status riscv_mat_add_q31(
+  const riscv_matrix_instance_q31 * pSrcA,
+  const riscv_matrix_instance_q31 * pSrcB,
+  riscv_matrix_instance_q31 * pDst);
 
   /**
-   * @brief Instance structure for the floating-point RFFT/RIFFT function.
+   * @brief Floating-point, complex, matrix multiplication.
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  typedef struct
-  {
-    uint32_t fftLenReal;                        /**< length of the real FFT. */
-    uint16_t fftLenBy2;                         /**< length of the complex FFT. */
-    uint8_t ifftFlagR;                          /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
-    uint8_t bitReverseFlagR;                    /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
-    uint32_t twidCoefRModifier;                     /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
-    float32_t *pTwiddleAReal;                   /**< points to the real twiddle factor table. */
-    float32_t *pTwiddleBReal;                   /**< points to the imag twiddle factor table. */
-    riscv_cfft_radix4_instance_f32 *pCfft;        /**< points to the complex FFT instance. */
-  } riscv_rfft_instance_f32;
+  riscv_status riscv_mat_cmplx_mult_f32(
+  const riscv_matrix_instance_f32 * pSrcA,
+  const riscv_matrix_instance_f32 * pSrcB,
+  riscv_matrix_instance_f32 * pDst);
 
-  riscv_status riscv_rfft_init_f32(
-  riscv_rfft_instance_f32 * S,
-  riscv_cfft_radix4_instance_f32 * S_CFFT,
-  uint32_t fftLenReal,
-  uint32_t ifftFlagR,
-  uint32_t bitReverseFlag);
+  /**
+   * @brief Q15, complex,  matrix multiplication.
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @param[in]       *pScratch points to a buffer of 4*numRowsB*numColsB elements, 2*numRowsB*numColsB without USE_DSP_RISCV
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
 
-  void riscv_rfft_f32(
-  const riscv_rfft_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst);
+  riscv_status riscv_mat_cmplx_mult_q15(
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst,
+  q15_t * pScratch);
 
   /**
-   * @brief Instance structure for the floating-point RFFT/RIFFT function.
+   * @brief Q31, complex, matrix multiplication.
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-typedef struct
-  {
-    riscv_cfft_instance_f32 Sint;      /**< Internal CFFT structure. */
-    uint16_t fftLenRFFT;                        /**< length of the real sequence */
-	float32_t * pTwiddleRFFT;					/**< Twiddle factors real stage  */
-  } riscv_rfft_fast_instance_f32 ;
-
-riscv_status riscv_rfft_fast_init_f32 (
-	riscv_rfft_fast_instance_f32 * S,
-	uint16_t fftLen);
+  riscv_status riscv_mat_cmplx_mult_q31(
+  const riscv_matrix_instance_q31 * pSrcA,
+  const riscv_matrix_instance_q31 * pSrcB,
+  riscv_matrix_instance_q31 * pDst);
 
-void riscv_rfft_fast_f32(
-  riscv_rfft_fast_instance_f32 * S,
-  float32_t * p, float32_t * pOut,
-  uint8_t ifftFlag);
 
   /**
-   * @brief Instance structure for the floating-point DCT4/IDCT4 function.
+   * @brief Floating-point matrix transpose.
+   * @param[in]  *pSrc points to the input matrix
+   * @param[out] *pDst points to the output matrix, it may have the same data as pSrc if the matrix is square
+   * @return 	The function returns either  <code>RISCV_MATH_SIZE_MISMATCH</code>
+   * or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  typedef struct
-  {
-    uint16_t N;                         /**< length of the DCT4. */
-    uint16_t Nby2;                      /**< half of the length of the DCT4. */
-    float32_t normalize;                /**< normalizing factor. */
-    float32_t *pTwiddle;                /**< points to the twiddle factor table. */
-    float32_t *pCosFactor;              /**< points to the cosFactor table. */
-    riscv_rfft_instance_f32 *pRfft;        /**< points to the real FFT instance. */
-    riscv_cfft_radix4_instance_f32 *pCfft; /**< points to the complex FFT instance. */
-  } riscv_dct4_instance_f32;
+  riscv_status riscv_mat_trans_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pDst);
+
 
   /**
-   * @brief  Initialization function for the floating-point DCT4/IDCT4.
-   * @param[in,out] *S         points to an instance of floating-point DCT4/IDCT4 structure.
-   * @param[in]     *S_RFFT    points to an instance of floating-point RFFT/RIFFT structure.
-   * @param[in]     *S_CFFT    points to an instance of floating-point CFFT/CIFFT structure.
-   * @param[in]     N          length of the DCT4.
-   * @param[in]     Nby2       half of the length of the DCT4.
-   * @param[in]     normalize  normalizing factor.
-   * @return		riscv_status function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>fftLenReal</code> is not a supported transform length.
+   * @brief Q15 matrix transpose.
+   * @param[in]  *pSrc points to the input matrix
+   * @param[out] *pDst points to the output matrix, it may have the same data as pSrc if the matrix is square
+   * @return 	The function returns either  <code>RISCV_MATH_SIZE_MISMATCH</code>
+   * or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  riscv_status riscv_dct4_init_f32(
-  riscv_dct4_instance_f32 * S,
-  riscv_rfft_instance_f32 * S_RFFT,
-  riscv_cfft_radix4_instance_f32 * S_CFFT,
-  uint16_t N,
-  uint16_t Nby2,
-  float32_t normalize);
+  riscv_status riscv_mat_trans_q15(
+  const riscv_matrix_instance_q15 * pSrc,
+  riscv_matrix_instance_q15 * pDst);
 
   /**
-   * @brief Processing function for the floating-point DCT4/IDCT4.
-   * @param[in]       *S             points to an instance of the floating-point DCT4/IDCT4 structure.
-   * @param[in]       *pState        points to state buffer.
-   * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.
-   * @return none.
+   * @brief Q31 matrix transpose.
+   * @param[in]  *pSrc points to the input matrix
+   * @param[out] *pDst points to the output matrix, it may have the same data as pSrc if the matrix is square
+   * @return 	The function returns either  <code>RISCV_MATH_SIZE_MISMATCH</code>
+   * or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_dct4_f32(
-  const riscv_dct4_instance_f32 * S,
-  float32_t * pState,
-  float32_t * pInlineBuffer);
+  riscv_status riscv_mat_trans_q31(
+  const riscv_matrix_instance_q31 * pSrc,
+  riscv_matrix_instance_q31 * pDst);
 
   /**
-   * @brief Instance structure for the Q31 DCT4/IDCT4 function.
+   * @brief Floating-point product of a matrix with its transpose, computes the lower triangle only.
+   * @param[in]  *pSrc points to the input matrix A
+   * @param[out] *pDst points to the output matrix C
+   * @param[in]  transFlag 0 computes A * A^T, 1 computes A^T * A
+   * @param[in]  fillFlag 1 copies the lower triangle of C to the upper triangle
+   * @return 	The function returns either  <code>RISCV_MATH_SIZE_MISMATCH</code>
+   * or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  typedef struct
-  {
-    uint16_t N;                         /**< length of the DCT4. */
-    uint16_t Nby2;                      /**< half of the length of the DCT4. */
-    q31_t normalize;                    /**< normalizing factor. */
-    q31_t *pTwiddle;                    /**< points to the twiddle factor table. */
-    q31_t *pCosFactor;                  /**< points to the cosFactor table. */
-    riscv_rfft_instance_q31 *pRfft;        /**< points to the real FFT instance. */
-    riscv_cfft_radix4_instance_q31 *pCfft; /**< points to the complex FFT instance. */
-  } riscv_dct4_instance_q31;
+  riscv_status riscv_mat_syrk_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pDst,
+  uint8_t transFlag,
+  uint8_t fillFlag);
 
   /**
-   * @brief  Initialization function for the Q31 DCT4/IDCT4.
-   * @param[in,out] *S         points to an instance of Q31 DCT4/IDCT4 structure.
-   * @param[in]     *S_RFFT    points to an instance of Q31 RFFT/RIFFT structure
-   * @param[in]     *S_CFFT    points to an instance of Q31 CFFT/CIFFT structure
-   * @param[in]     N          length of the DCT4.
-   * @param[in]     Nby2       half of the length of the DCT4.
-   * @param[in]     normalize  normalizing factor.
-   * @return		riscv_status function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported transform length.
+   * @brief Q15 product of a matrix with its transpose, computes the lower triangle only.
+   * @param[in]  *pSrc points to the input matrix A
+   * @param[out] *pDst points to the output matrix C
+   * @param[in]  transFlag 0 computes A * A^T, 1 computes A^T * A
+   * @param[in]  fillFlag 1 copies the lower triangle of C to the upper triangle
+   * @return 	The function returns either  <code>RISCV_MATH_SIZE_MISMATCH</code>
+   * or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  riscv_status riscv_dct4_init_q31(
-  riscv_dct4_instance_q31 * S,
-  riscv_rfft_instance_q31 * S_RFFT,
-  riscv_cfft_radix4_instance_q31 * S_CFFT,
-  uint16_t N,
-  uint16_t Nby2,
-  q31_t normalize);
+  riscv_status riscv_mat_syrk_q15(
+  const riscv_matrix_instance_q15 * pSrc,
+  riscv_matrix_instance_q15 * pDst,
+  uint8_t transFlag,
+  uint8_t fillFlag);
 
   /**
-   * @brief Processing function for the Q31 DCT4/IDCT4.
-   * @param[in]       *S             points to an instance of the Q31 DCT4 structure.
-   * @param[in]       *pState        points to state buffer.
-   * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.
-   * @return none.
+   * @brief Q31 product of a matrix with its transpose, computes the lower triangle only.
+   * @param[in]  *pSrc points to the input matrix A
+   * @param[out] *pDst points to the output matrix C
+   * @param[in]  transFlag 0 computes A * A^T, 1 computes A^T * A
+   * @param[in]  fillFlag 1 copies the lower triangle of C to the upper triangle
+   * @return 	The function returns either  <code>RISCV_MATH_SIZE_MISMATCH</code>
+   * or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_dct4_q31(
-  const riscv_dct4_instance_q31 * S,
-  q31_t * pState,
-  q31_t * pInlineBuffer);
+  riscv_status riscv_mat_syrk_q31(
+  const riscv_matrix_instance_q31 * pSrc,
+  riscv_matrix_instance_q31 * pDst,
+  uint8_t transFlag,
+  uint8_t fillFlag);
 
   /**
-   * @brief Instance structure for the Q15 DCT4/IDCT4 function.
+   * @brief Floating-point 2x2 matrix multiplication.
+   * @param[in]  *pSrcA points to the 4 elements of the first input matrix
+   * @param[in]  *pSrcB points to the 4 elements of the second input matrix
+   * @param[out] *pDst points to the 4 elements of the output matrix
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint16_t N;                         /**< length of the DCT4. */
-    uint16_t Nby2;                      /**< half of the length of the DCT4. */
-    q15_t normalize;                    /**< normalizing factor. */
-    q15_t *pTwiddle;                    /**< points to the twiddle factor table. */
-    q15_t *pCosFactor;                  /**< points to the cosFactor table. */
-    riscv_rfft_instance_q15 *pRfft;        /**< points to the real FFT instance. */
-    riscv_cfft_radix4_instance_q15 *pCfft; /**< points to the complex FFT instance. */
-  } riscv_dct4_instance_q15;
+  void riscv_mat_mult_2x2_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
 
   /**
-   * @brief  Initialization function for the Q15 DCT4/IDCT4.
-   * @param[in,out] *S         points to an instance of Q15 DCT4/IDCT4 structure.
-   * @param[in]     *S_RFFT    points to an instance of Q15 RFFT/RIFFT structure.
-   * @param[in]     *S_CFFT    points to an instance of Q15 CFFT/CIFFT structure.
-   * @param[in]     N          length of the DCT4.
-   * @param[in]     Nby2       half of the length of the DCT4.
-   * @param[in]     normalize  normalizing factor.
-   * @return		riscv_status function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported transform length.
+   * @brief Floating-point 3x3 matrix multiplication.
+   * @param[in]  *pSrcA points to the 9 elements of the first input matrix
+   * @param[in]  *pSrcB points to the 9 elements of the second input matrix
+   * @param[out] *pDst points to the 9 elements of the output matrix
+   * @return none.
    */
 
-  riscv_status riscv_dct4_init_q15(
-  riscv_dct4_instance_q15 * S,
-  riscv_rfft_instance_q15 * S_RFFT,
-  riscv_cfft_radix4_instance_q15 * S_CFFT,
-  uint16_t N,
-  uint16_t Nby2,
-  q15_t normalize);
+  void riscv_mat_mult_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
 
   /**
-   * @brief Processing function for the Q15 DCT4/IDCT4.
-   * @param[in]       *S             points to an instance of the Q15 DCT4 structure.
-   * @param[in]       *pState        points to state buffer.
-   * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.
+   * @brief Floating-point 4x4 matrix multiplication.
+   * @param[in]  *pSrcA points to the 16 elements of the first input matrix
+   * @param[in]  *pSrcB points to the 16 elements of the second input matrix
+   * @param[out] *pDst points to the 16 elements of the output matrix
    * @return none.
    */
 
-  void riscv_dct4_q15(
-  const riscv_dct4_instance_q15 * S,
-  q15_t * pState,
-  q15_t * pInlineBuffer);
+  void riscv_mat_mult_4x4_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
 
   /**
-   * @brief Floating-point vector addition.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Batched floating-point matrix multiplication of 2x2, 3x3 or 4x4 matrices.
+   * @param[in]  *pSrcA points to the first input matrices
+   * @param[in]  *pSrcB points to the second input matrices
+   * @param[out] *pDst points to the output matrices
+   * @param[in]  dim size of the matrices, 2, 3 or 4
+   * @param[in]  numMatrices number of matrix products
+   * @return The function returns RISCV_MATH_ARGUMENT_ERROR if dim is not supported, otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_add_f32(
-  float32_t * pSrcA,
-  float32_t * pSrcB,
+  riscv_status riscv_mat_mult_batch_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
   float32_t * pDst,
-  uint32_t blockSize);
+  uint16_t dim,
+  uint32_t numMatrices);
 
   /**
-   * @brief Q7 vector addition.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Floating-point 2x2 matrix inverse.
+   * @param[in]  *pSrc points to the 4 elements of the input matrix
+   * @param[out] *pDst points to the 4 elements of the output matrix, it may be the same as pSrc
+   * @return The function returns RISCV_MATH_SINGULAR if the matrix is singular, otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_add_q7(
-  q7_t * pSrcA,
-  q7_t * pSrcB,
-  q7_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_inverse_2x2_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
   /**
-   * @brief Q15 vector addition.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Floating-point 3x3 matrix inverse.
+   * @param[in]  *pSrc points to the 9 elements of the input matrix
+   * @param[out] *pDst points to the 9 elements of the output matrix, it may be the same as pSrc
+   * @return The function returns RISCV_MATH_SINGULAR if the matrix is singular, otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_add_q15(
-  q15_t * pSrcA,
-  q15_t * pSrcB,
-  q15_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_inverse_3x3_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
   /**
-   * @brief Q31 vector addition.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Floating-point 4x4 matrix inverse.
+   * @param[in]  *pSrc points to the 16 elements of the input matrix
+   * @param[out] *pDst points to the 16 elements of the output matrix, it may be the same as pSrc
+   * @return The function returns RISCV_MATH_SINGULAR if the matrix is singular, otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_add_q31(
-  q31_t * pSrcA,
-  q31_t * pSrcB,
-  q31_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_inverse_4x4_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
   /**
-   * @brief Floating-point vector subtraction.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Batched floating-point matrix inverse of 2x2, 3x3 or 4x4 matrices.
+   * @param[in]  *pSrc points to the input matrices
+   * @param[out] *pDst points to the output matrices, it may be the same as pSrc
+   * @param[in]  dim size of the matrices, 2, 3 or 4
+   * @param[in]  numMatrices number of matrices
+   * @return The function returns RISCV_MATH_ARGUMENT_ERROR if dim is not supported,
+   * RISCV_MATH_SINGULAR if a matrix is singular, otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_sub_f32(
-  float32_t * pSrcA,
-  float32_t * pSrcB,
+  riscv_status riscv_mat_inverse_batch_f32(
+  const float32_t * pSrc,
   float32_t * pDst,
-  uint32_t blockSize);
+  uint16_t dim,
+  uint32_t numMatrices);
 
   /**
-   * @brief Q7 vector subtraction.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Floating-point multiplication of vectors in structure-of-arrays layout by a 2x2, 3x3 or 4x4 matrix.
+   * @param[in]  *pMat points to the elements of the matrix
+   * @param[in]  *pSrc points to the dim arrays of numVectors input components
+   * @param[out] *pDst points to the dim arrays of numVectors output components
+   * @param[in]  dim size of the matrix, 2, 3 or 4
+   * @param[in]  numVectors number of vectors
+   * @return The function returns RISCV_MATH_ARGUMENT_ERROR if dim is not supported, otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_sub_q7(
-  q7_t * pSrcA,
-  q7_t * pSrcB,
-  q7_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_vec_mult_soa_f32(
+  const float32_t * pMat,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint16_t dim,
+  uint32_t numVectors);
 
   /**
-   * @brief Q15 vector subtraction.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Floating-point QR decomposition with Givens rotations.
+   * @param[in]  *pSrc points to the M x N input matrix structure, M >= N
+   * @param[out] *pR points to the M x N output matrix structure R, may be the same as pSrc
+   * @param[out] *pQ points to the M x M output matrix structure Q, or NULL
+   * @return The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_sub_q15(
-  q15_t * pSrcA,
-  q15_t * pSrcB,
-  q15_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_qr_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pR,
+  riscv_matrix_instance_f32 * pQ);
 
   /**
-   * @brief Q31 vector subtraction.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Q31 QR decomposition with CORDIC Givens rotations.
+   * @param[in]  *pSrc points to the M x N input matrix structure, M >= N
+   * @param[out] *pR points to the M x N output matrix structure R, may be the same as pSrc
+   * @param[out] *pQ points to the M x M output matrix structure Q, or NULL
+   * @return The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_sub_q31(
-  q31_t * pSrcA,
-  q31_t * pSrcB,
-  q31_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_qr_q31(
+  const riscv_matrix_instance_q31 * pSrc,
+  riscv_matrix_instance_q31 * pR,
+  riscv_matrix_instance_q31 * pQ);
 
   /**
-   * @brief Multiplies a floating-point vector by a scalar.
-   * @param[in]       *pSrc points to the input vector
-   * @param[in]       scale scale factor to be applied
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in the vector
-   * @return none.
+   * @brief Floating-point linear least-squares solver.
+   * @param[in]  *pSrcA points to the M x N matrix structure A, M >= N
+   * @param[in]  *pSrcB points to the M x K matrix structure B
+   * @param[out] *pR points to the M x N matrix structure that receives R, may be the same as pSrcA
+   * @param[out] *pState points to a buffer of M*K words, may be the data of pSrcB
+   * @param[out] *pDst points to the N x K output matrix structure X
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH if the sizes do not match,
+   * RISCV_MATH_SINGULAR if A does not have full column rank, otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_scale_f32(
-  float32_t * pSrc,
-  float32_t scale,
-  float32_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_lstsq_f32(
+  const riscv_matrix_instance_f32 * pSrcA,
+  const riscv_matrix_instance_f32 * pSrcB,
+  riscv_matrix_instance_f32 * pR,
+  float32_t * pState,
+  riscv_matrix_instance_f32 * pDst);
 
   /**
-   * @brief Multiplies a Q7 vector by a scalar.
-   * @param[in]       *pSrc points to the input vector
-   * @param[in]       scaleFract fractional portion of the scale value
-   * @param[in]       shift number of bits to shift the result by
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in the vector
+   * @brief Floating-point QR update of a recursive least-squares problem with one new equation.
+   * @param[in,out] *pR points to the N x N upper triangular matrix structure R
+   * @param[in,out] *pZ points to the N elements of Q^T * b
+   * @param[in,out] *pRow points to the N elements of the new row, it is overwritten
+   * @param[in]     rhs right-hand side of the new equation
+   * @param[in]     forget factor applied to R and pZ before the update, 1 for none
    * @return none.
    */
 
-  void riscv_scale_q7(
-  q7_t * pSrc,
-  q7_t scaleFract,
-  int8_t shift,
-  q7_t * pDst,
-  uint32_t blockSize);
+  void riscv_mat_qr_update_f32(
+  riscv_matrix_instance_f32 * pR,
+  float32_t * pZ,
+  float32_t * pRow,
+  float32_t rhs,
+  float32_t forget);
 
   /**
-   * @brief Multiplies a Q15 vector by a scalar.
-   * @param[in]       *pSrc points to the input vector
-   * @param[in]       scaleFract fractional portion of the scale value
-   * @param[in]       shift number of bits to shift the result by
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in the vector
+   * @brief Q31 QR update of a recursive least-squares problem with one new equation.
+   * @param[in,out] *pR points to the N x N upper triangular matrix structure R
+   * @param[in,out] *pZ points to the N elements of Q^T * b
+   * @param[in,out] *pRow points to the N elements of the new row, it is overwritten
+   * @param[in]     rhs right-hand side of the new equation
+   * @param[in]     forget factor applied to R and pZ before the update, 0x7FFFFFFF for none
    * @return none.
    */
 
-  void riscv_scale_q15(
-  q15_t * pSrc,
-  q15_t scaleFract,
-  int8_t shift,
-  q15_t * pDst,
-  uint32_t blockSize);
+  void riscv_mat_qr_update_q31(
+  riscv_matrix_instance_q31 * pR,
+  q31_t * pZ,
+  q31_t * pRow,
+  q31_t rhs,
+  q31_t forget);
 
   /**
-   * @brief Multiplies a Q31 vector by a scalar.
-   * @param[in]       *pSrc points to the input vector
-   * @param[in]       scaleFract fractional portion of the scale value
-   * @param[in]       shift number of bits to shift the result by
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in the vector
-   * @return none.
+   * @brief Number of sweeps after which riscv_mat_eig_sym_f32() and riscv_mat_svd_f32() give up.
    */
 
-  void riscv_scale_q31(
-  q31_t * pSrc,
-  q31_t scaleFract,
-  int8_t shift,
-  q31_t * pDst,
-  uint32_t blockSize);
+#ifndef RISCV_MAT_JACOBI_MAX_SWEEPS
+#define RISCV_MAT_JACOBI_MAX_SWEEPS 30u
+#endif
 
   /**
-   * @brief Q7 vector absolute value.
-   * @param[in]       *pSrc points to the input buffer
-   * @param[out]      *pDst points to the output buffer
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Floating-point eigen-decomposition of a symmetric matrix with cyclic Jacobi rotations.
+   * @param[in]  *pSrc points to the N x N symmetric input matrix structure
+   * @param[out] *pDst points to the N x N work matrix structure, may be the same as pSrc
+   * @param[out] *pVec points to the N x N output matrix structure of the eigenvectors, one per column, or NULL
+   * @param[out] *pVal points to the N eigenvalues, largest first
+   * @param[in]  tol relative threshold of the off-diagonal elements
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH if the sizes do not match,
+   * RISCV_MATH_DECOMPOSITION_FAILURE if the rotations do not converge, otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_abs_q7(
-  q7_t * pSrc,
-  q7_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_eig_sym_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pDst,
+  riscv_matrix_instance_f32 * pVec,
+  float32_t * pVal,
+  float32_t tol);
 
   /**
-   * @brief Floating-point vector absolute value.
-   * @param[in]       *pSrc points to the input buffer
-   * @param[out]      *pDst points to the output buffer
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Floating-point singular value decomposition with one-sided Jacobi rotations.
+   * @param[in]  *pSrc points to the M x N input matrix structure, M >= N
+   * @param[out] *pU points to the M x N output matrix structure of the left singular vectors, may be the same as pSrc
+   * @param[out] *pSigma points to the N singular values, largest first
+   * @param[out] *pV points to the N x N output matrix structure of the right singular vectors, or NULL
+   * @param[in]  tol relative threshold of the cosine between two columns
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH if the sizes do not match,
+   * RISCV_MATH_DECOMPOSITION_FAILURE if the rotations do not converge, otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_abs_f32(
-  float32_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_svd_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pU,
+  float32_t * pSigma,
+  riscv_matrix_instance_f32 * pV,
+  float32_t tol);
 
   /**
-   * @brief Q15 vector absolute value.
-   * @param[in]       *pSrc points to the input buffer
-   * @param[out]      *pDst points to the output buffer
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Instance structure for the floating-point Kalman filter.
    */
-
-  void riscv_abs_q15(
-  q15_t * pSrc,
-  q15_t * pDst,
-  uint32_t blockSize);
+  typedef struct
+  {
+    uint16_t numStates;                     /**< number of states N. */
+    float32_t *pState;                      /**< points to the N elements of the state estimate x. */
+    riscv_matrix_instance_f32 *pP;          /**< points to the N x N covariance P, only the upper triangle is valid. */
+    const riscv_matrix_instance_f32 *pF;    /**< points to the N x N state transition matrix F. */
+    const riscv_matrix_instance_f32 *pQ;    /**< points to the N x N process noise covariance Q, or NULL. */
+    float32_t *pWork;                       /**< points to a work buffer of N*(N+1) words. */
+  } riscv_kalman_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Kalman filter.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     numStates number of states N.
+   * @param[in,out] *pState points to the N elements of the state estimate x.
+   * @param[in,out] *pP points to the N x N covariance matrix structure P, only the upper triangle is used.
+   * @param[in]     *pF points to the N x N state transition matrix structure F.
+   * @param[in]     *pQ points to the N x N process noise covariance matrix structure Q, or NULL.
+   * @param[in]     *pWork points to a work buffer of N*(N+1) words.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH if a matrix is not N x N, otherwise RISCV_MATH_SUCCESS.
+   */
+
+  riscv_status riscv_kalman_init_f32(
+  riscv_kalman_instance_f32 * S,
+  uint16_t numStates,
+  float32_t * pState,
+  riscv_matrix_instance_f32 * pP,
+  const riscv_matrix_instance_f32 * pF,
+  const riscv_matrix_instance_f32 * pQ,
+  float32_t * pWork);
 
   /**
-   * @brief Q31 vector absolute value.
-   * @param[in]       *pSrc points to the input buffer
-   * @param[out]      *pDst points to the output buffer
-   * @param[in]       blockSize number of samples in each vector
+   * @brief  Floating-point Kalman filter time update, x = F * x + u and P = F * P * F^T + Q.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     *pControl points to the N elements of the control input u, or NULL.
    * @return none.
    */
 
-  void riscv_abs_q31(
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
+  void riscv_kalman_predict_f32(
+  const riscv_kalman_instance_f32 * S,
+  const float32_t * pControl);
 
   /**
-   * @brief Dot product of floating-point vectors.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[in]       blockSize number of samples in each vector
-   * @param[out]      *result output result returned here
-   * @return none.
+   * @brief  Floating-point Kalman filter update with one scalar measurement z = h * x + v.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     *pH points to the N elements of the measurement row h.
+   * @param[in]     z measurement.
+   * @param[in]     r variance of the measurement noise v.
+   * @return The function returns RISCV_MATH_SINGULAR if the innovation variance is not positive,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_dot_prod_f32(
-  float32_t * pSrcA,
-  float32_t * pSrcB,
-  uint32_t blockSize,
-  float32_t * result);
+  riscv_status riscv_kalman_update_scalar_f32(
+  const riscv_kalman_instance_f32 * S,
+  const float32_t * pH,
+  float32_t z,
+  float32_t r);
 
   /**
-   * @brief Dot product of Q7 vectors.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[in]       blockSize number of samples in each vector
-   * @param[out]      *result output result returned here
-   * @return none.
+   * @brief  Floating-point Kalman filter update with M measurements of uncorrelated noise, one after the other.
+   * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     *pH points to the M x N measurement matrix structure H.
+   * @param[in]     *pZ points to the M measurements.
+   * @param[in]     *pR points to the M noise variances, the diagonal of R.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH if H does not have N columns,
+   * RISCV_MATH_SINGULAR if an innovation variance is not positive, otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_dot_prod_q7(
-  q7_t * pSrcA,
-  q7_t * pSrcB,
-  uint32_t blockSize,
-  q31_t * result);
+  riscv_status riscv_kalman_update_f32(
+  const riscv_kalman_instance_f32 * S,
+  const riscv_matrix_instance_f32 * pH,
+  const float32_t * pZ,
+  const float32_t * pR);
+
 
   /**
-   * @brief Dot product of Q15 vectors.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[in]       blockSize number of samples in each vector
-   * @param[out]      *result output result returned here
-   * @return none.
+   * @brief Number of output rows computed together by riscv_mat_mult_f32(), 2 or 4.
    */
 
-  void riscv_dot_prod_q15(
-  q15_t * pSrcA,
-  q15_t * pSrcB,
-  uint32_t blockSize,
-  q63_t * result);
+#ifndef RISCV_MAT_MULT_F32_TILE_ROWS
+#define RISCV_MAT_MULT_F32_TILE_ROWS 4u
+#endif
 
   /**
-   * @brief Dot product of Q31 vectors.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[in]       blockSize number of samples in each vector
-   * @param[out]      *result output result returned here
-   * @return none.
+   * @brief Floating-point matrix multiplication
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_dot_prod_q31(
-  q31_t * pSrcA,
-  q31_t * pSrcB,
-  uint32_t blockSize,
-  q63_t * result);
+  riscv_status riscv_mat_mult_f32(
+  const riscv_matrix_instance_f32 * pSrcA,
+  const riscv_matrix_instance_f32 * pSrcB,
+  riscv_matrix_instance_f32 * pDst);
 
   /**
-   * @brief  Shifts the elements of a Q7 vector a specified number of bits.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  shiftBits number of bits to shift.  A positive value shifts left; a negative value shifts right.
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
-   * @return none.
+   * @brief Double-precision floating-point matrix multiplication
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_shift_q7(
-  q7_t * pSrc,
-  int8_t shiftBits,
-  q7_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_mult_f64(
+  const riscv_matrix_instance_f64 * pSrcA,
+  const riscv_matrix_instance_f64 * pSrcB,
+  riscv_matrix_instance_f64 * pDst);
 
   /**
-   * @brief  Shifts the elements of a Q15 vector a specified number of bits.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  shiftBits number of bits to shift.  A positive value shifts left; a negative value shifts right.
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
-   * @return none.
+   * @brief Q15 matrix multiplication
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @param[in]		 *pState points to the array for storing intermediate results
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_shift_q15(
-  q15_t * pSrc,
-  int8_t shiftBits,
-  q15_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_mult_q15(
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst,
+  q15_t * pState);
 
   /**
-   * @brief  Shifts the elements of a Q31 vector a specified number of bits.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  shiftBits number of bits to shift.  A positive value shifts left; a negative value shifts right.
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
-   * @return none.
+   * @brief Q15 matrix multiplication (fast variant) for Cortex-M3 and Cortex-M4
+   * @param[in]       *pSrcA  points to the first input matrix structure
+   * @param[in]       *pSrcB  points to the second input matrix structure
+   * @param[out]      *pDst   points to output matrix structure
+   * @param[in]		  *pState points to the array for storing intermediate results
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_shift_q31(
-  q31_t * pSrc,
-  int8_t shiftBits,
-  q31_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_mult_fast_q15(
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst,
+  q15_t * pState);
 
   /**
-   * @brief  Adds a constant offset to a floating-point vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  offset is the offset to be added
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
-   * @return none.
+   * @brief Q15 matrix multiplication with a block floating-point result.
+   * @param[in]       *pSrcA  points to the first input matrix structure
+   * @param[in]       *pSrcB  points to the second input matrix structure
+   * @param[out]      *pDst   points to output matrix structure
+   * @param[in]       *pState points to a scratch buffer of <code>numRowsB*numColsB</code> elements
+   * @param[out]      *pExponent exponent of the result, <code>pDst * 2^(*pExponent)</code> is the product of the inputs
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_offset_f32(
-  float32_t * pSrc,
-  float32_t offset,
-  float32_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_mult_bfp_q15(
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst,
+  q15_t * pState,
+  int16_t * pExponent);
 
   /**
-   * @brief  Adds a constant offset to a Q7 vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  offset is the offset to be added
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
-   * @return none.
+   * @brief Instance structure for a Q15 matrix packed by riscv_mat_pack_q15() or riscv_mat_cmplx_pack_q15().
    */
 
-  void riscv_offset_q7(
-  q7_t * pSrc,
-  q7_t offset,
-  q7_t * pDst,
-  uint32_t blockSize);
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the unpacked matrix.     */
+    uint16_t numCols;     /**< number of columns of the unpacked matrix.  */
+    q15_t *pData;         /**< points to the packed data, ((numRows+1)&~1)*numCols elements, 4*numRows*numCols for a complex matrix. */
+  } riscv_matrix_packed_instance_q15;
 
   /**
-   * @brief  Adds a constant offset to a Q15 vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  offset is the offset to be added
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
+   * @brief Packs the right-hand Q15 matrix of riscv_mat_mult_packed_q15().
+   * @param[in]       *pSrc  points to the matrix to pack
+   * @param[out]      *pDst  points to the packed matrix structure
+   * @param[in]       *pData points to a buffer of ((numRows+1)&~1)*numCols elements for the packed data
    * @return none.
    */
 
-  void riscv_offset_q15(
-  q15_t * pSrc,
-  q15_t offset,
-  q15_t * pDst,
-  uint32_t blockSize);
+  void riscv_mat_pack_q15(
+  const riscv_matrix_instance_q15 * pSrc,
+  riscv_matrix_packed_instance_q15 * pDst,
+  q15_t * pData);
 
   /**
-   * @brief  Adds a constant offset to a Q31 vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  offset is the offset to be added
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
-   * @return none.
+   * @brief Q15 matrix multiplication with a packed right-hand matrix
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the packed second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_offset_q31(
-  q31_t * pSrc,
-  q31_t offset,
-  q31_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_mult_packed_q15(
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_packed_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst);
 
   /**
-   * @brief  Negates the elements of a floating-point vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
+   * @brief Packs the right-hand Q15 complex matrix of riscv_mat_cmplx_mult_packed_q15().
+   * @param[in]       *pSrc  points to the complex matrix to pack
+   * @param[out]      *pDst  points to the packed matrix structure
+   * @param[in]       *pData points to a buffer of 4*numRows*numCols elements for the packed data
    * @return none.
    */
 
-  void riscv_negate_f32(
-  float32_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
+  void riscv_mat_cmplx_pack_q15(
+  const riscv_matrix_instance_q15 * pSrc,
+  riscv_matrix_packed_instance_q15 * pDst,
+  q15_t * pData);
 
   /**
-   * @brief  Negates the elements of a Q7 vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
-   * @return none.
+   * @brief Q15 complex matrix multiplication with a packed right-hand matrix
+   * @param[in]       *pSrcA points to the first input complex matrix structure
+   * @param[in]       *pSrcB points to the second input complex matrix, packed by riscv_mat_cmplx_pack_q15()
+   * @param[out]      *pDst points to output complex matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_negate_q7(
-  q7_t * pSrc,
-  q7_t * pDst,
-  uint32_t blockSize);
+  riscv_status riscv_mat_cmplx_mult_packed_q15(
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_packed_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst);
 
   /**
-   * @brief  Negates the elements of a Q15 vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
+   * @brief Q7 matrix and vector multiplication
+   * @param[in]       *pSrcMat points to the input matrix structure
+   * @param[in]       *pVec points to the input vector of numCols elements
+   * @param[out]      *pDst points to the output vector of numRows elements
    * @return none.
    */
 
-  void riscv_negate_q15(
-  q15_t * pSrc,
-  q15_t * pDst,
-  uint32_t blockSize);
+  void riscv_mat_vec_mult_q7(
+  const riscv_matrix_instance_q7 * pSrcMat,
+  q7_t * pVec,
+  q7_t * pDst);
 
   /**
-   * @brief  Negates the elements of a Q31 vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
+   * @brief Packs a matrix of 4-bit weights for riscv_mat_vec_mult_q4_q7().
+   * @param[in]       *pSrc points to the matrix of weights, one per byte, -8 to 7
+   * @param[in]       *pZero points to the zero points of the rows, or NULL
+   * @param[in]       *pRq points to the requantization parameters of the output, or NULL
+   * @param[out]      *pDst points to the packed matrix structure
+   * @param[in]       *pData points to a buffer of numRows*RISCV_MAT_Q4_ROW_BYTES(numCols) bytes, word aligned
    * @return none.
    */
 
-  void riscv_negate_q31(
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
+  void riscv_mat_pack_q4(
+  const riscv_matrix_instance_q7 * pSrc,
+  const int8_t * pZero,
+  const riscv_mat_requant_q7 * pRq,
+  riscv_matrix_instance_q4 * pDst,
+  uint8_t * pData);
+
   /**
-   * @brief  Copies the elements of a floating-point vector.
-   * @param[in]  *pSrc input pointer
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief Multiplication of a Q7 vector by a matrix of packed 4-bit weights.
+   * @param[in]       *pSrcMat points to the packed matrix structure
+   * @param[in]       *pVec points to the input vector, word aligned
+   * @param[out]      *pDst points to the output vector
    * @return none.
    */
-  void riscv_copy_f32(
-  float32_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
+
+  void riscv_mat_vec_mult_q4_q7(
+  const riscv_matrix_instance_q4 * pSrcMat,
+  const q7_t * pVec,
+  q7_t * pDst);
 
   /**
-   * @brief  Copies the elements of a Q7 vector.
-   * @param[in]  *pSrc input pointer
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief Q15 matrix and vector multiplication
+   * @param[in]       *pSrcMat points to the input matrix structure
+   * @param[in]       *pVec points to the input vector of numCols elements
+   * @param[out]      *pDst points to the output vector of numRows elements
    * @return none.
    */
-  void riscv_copy_q7(
-  q7_t * pSrc,
-  q7_t * pDst,
-  uint32_t blockSize);
+
+  void riscv_mat_vec_mult_q15(
+  const riscv_matrix_instance_q15 * pSrcMat,
+  q15_t * pVec,
+  q15_t * pDst);
 
   /**
-   * @brief  Copies the elements of a Q15 vector.
-   * @param[in]  *pSrc input pointer
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief Q31 matrix and vector multiplication
+   * @param[in]       *pSrcMat points to the input matrix structure
+   * @param[in]       *pVec points to the input vector of numCols elements
+   * @param[out]      *pDst points to the output vector of numRows elements
    * @return none.
    */
-  void riscv_copy_q15(
-  q15_t * pSrc,
-  q15_t * pDst,
-  uint32_t blockSize);
+
+  void riscv_mat_vec_mult_q31(
+  const riscv_matrix_instance_q31 * pSrcMat,
+  q31_t * pVec,
+  q31_t * pDst);
 
   /**
-   * @brief  Copies the elements of a Q31 vector.
-   * @param[in]  *pSrc input pointer
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief Floating-point matrix and vector multiplication
+   * @param[in]       *pSrcMat points to the input matrix structure
+   * @param[in]       *pVec points to the input vector of numCols elements
+   * @param[out]      *pDst points to the output vector of numRows elements
    * @return none.
    */
-  void riscv_copy_q31(
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
+
+  void riscv_mat_vec_mult_f32(
+  const riscv_matrix_instance_f32 * pSrcMat,
+  float32_t * pVec,
+  float32_t * pDst);
+
   /**
-   * @brief  Fills a constant value into a floating-point vector.
-   * @param[in]  value input value to be filled
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
-   * @return none.
+   * @brief Instance structure for a Q15 sparse matrix in compressed sparse row (CSR) format.
    */
-  void riscv_fill_f32(
-  float32_t value,
-  float32_t * pDst,
-  uint32_t blockSize);
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    uint32_t *pRowPtr;    /**< points to the numRows+1 offsets of the first nonzero element of every row. */
+    uint16_t *pColIdx;    /**< points to the columns of the nonzero elements. */
+    q15_t *pData;         /**< points to the nonzero elements. */
+  } riscv_sparse_matrix_instance_q15;
 
   /**
-   * @brief  Fills a constant value into a Q7 vector.
-   * @param[in]  value input value to be filled
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
-   * @return none.
+   * @brief Instance structure for a Q15 block sparse matrix in BSR format of 1x4 or 2x2 blocks.
    */
-  void riscv_fill_q7(
-  q7_t value,
-  q7_t * pDst,
-  uint32_t blockSize);
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix, a multiple of blockRows.     */
+    uint16_t numCols;     /**< number of columns of the matrix, a multiple of blockCols.  */
+    uint8_t blockRows;    /**< number of rows of a block, 1 or 2.    */
+    uint8_t blockCols;    /**< number of columns of a block, 4 or 2. */
+    uint32_t *pRowPtr;    /**< points to the numRows/blockRows+1 offsets of the first block of every block row. */
+    uint16_t *pColIdx;    /**< points to the first column of every block. */
+    q15_t *pData;         /**< points to the elements of the blocks, blockRows*blockCols per block in row major order. */
+  } riscv_sparse_block_matrix_instance_q15;
 
   /**
-   * @brief  Fills a constant value into a Q15 vector.
-   * @param[in]  value input value to be filled
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
-   * @return none.
+   * @brief Instance structure for a floating-point sparse matrix in compressed sparse row (CSR) format.
    */
-  void riscv_fill_q15(
-  q15_t value,
-  q15_t * pDst,
-  uint32_t blockSize);
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    uint32_t *pRowPtr;    /**< points to the numRows+1 offsets of the first nonzero element of every row. */
+    uint16_t *pColIdx;    /**< points to the columns of the nonzero elements. */
+    float32_t *pData;     /**< points to the nonzero elements. */
+  } riscv_sparse_matrix_instance_f32;
 
   /**
-   * @brief  Fills a constant value into a Q31 vector.
-   * @param[in]  value input value to be filled
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief Instance structure for a floating-point block sparse matrix in BSR format of 1x4 or 2x2 blocks.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix, a multiple of blockRows.     */
+    uint16_t numCols;     /**< number of columns of the matrix, a multiple of blockCols.  */
+    uint8_t blockRows;    /**< number of rows of a block, 1 or 2.    */
+    uint8_t blockCols;    /**< number of columns of a block, 4 or 2. */
+    uint32_t *pRowPtr;    /**< points to the numRows/blockRows+1 offsets of the first block of every block row. */
+    uint16_t *pColIdx;    /**< points to the first column of every block. */
+    float32_t *pData;     /**< points to the elements of the blocks, blockRows*blockCols per block in row major order. */
+  } riscv_sparse_block_matrix_instance_f32;
+
+  /**
+   * @brief Q15 sparse (CSR) matrix and vector multiplication
+   * @param[in]       *pSrcMat points to the input CSR matrix structure
+   * @param[in]       *pVec points to the input vector of numCols elements
+   * @param[out]      *pDst points to the output vector of numRows elements
    * @return none.
    */
-  void riscv_fill_q31(
-  q31_t value,
-  q31_t * pDst,
-  uint32_t blockSize);
 
-/**
- * @brief Convolution of floating-point sequences.
- * @param[in] *pSrcA points to the first input sequence.
- * @param[in] srcALen length of the first input sequence.
- * @param[in] *pSrcB points to the second input sequence.
- * @param[in] srcBLen length of the second input sequence.
- * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.
- * @return none.
- */
+  void riscv_mat_sparse_vec_mult_q15(
+  const riscv_sparse_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst);
 
-  void riscv_conv_f32(
-  float32_t * pSrcA,
-  uint32_t srcALen,
-  float32_t * pSrcB,
-  uint32_t srcBLen,
-  float32_t * pDst);
+  /**
+   * @brief Q15 block sparse (BSR) matrix and vector multiplication
+   * @param[in]       *pSrcMat points to the input BSR matrix structure
+   * @param[in]       *pVec points to the input vector of numCols elements, word aligned
+   * @param[out]      *pDst points to the output vector of numRows elements
+   * @return none.
+   */
 
+  void riscv_mat_sparse_block_vec_mult_q15(
+  const riscv_sparse_block_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst);
 
   /**
-   * @brief Convolution of Q15 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
-   * @param[in]  *pScratch1 points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]  *pScratch2 points to scratch buffer of size min(srcALen, srcBLen).
-   * @return none.
+   * @brief Converts a Q15 dense matrix to the CSR format
+   * @param[in]       *pSrc points to the input dense matrix structure
+   * @param[in,out]   *pDst points to the CSR matrix structure with the buffers set by the caller
+   * @param[in]       maxNonZeros size of the pColIdx and pData buffers
+   * @return The function returns RISCV_MATH_LENGTH_ERROR if the matrix has more than maxNonZeros
+   * nonzero elements, otherwise RISCV_MATH_SUCCESS.
    */
 
+  riscv_status riscv_mat_sparse_from_dense_q15(
+  const riscv_matrix_instance_q15 * pSrc,
+  riscv_sparse_matrix_instance_q15 * pDst,
+  uint32_t maxNonZeros);
 
-  void riscv_conv_opt_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
+  /**
+   * @brief Converts a Q15 dense matrix to the BSR format
+   * @param[in]       *pSrc points to the input dense matrix structure
+   * @param[in,out]   *pDst points to the BSR matrix structure with the block size and the buffers set by the caller
+   * @param[in]       maxBlocks number of blocks of the pColIdx and pData buffers
+   * @return The function returns RISCV_MATH_ARGUMENT_ERROR if the block size is not 1x4 or 2x2,
+   * RISCV_MATH_SIZE_MISMATCH if the matrix size is not a multiple of the block size,
+   * RISCV_MATH_LENGTH_ERROR if the matrix has more than maxBlocks nonzero blocks, otherwise RISCV_MATH_SUCCESS.
+   */
 
+  riscv_status riscv_mat_sparse_block_from_dense_q15(
+  const riscv_matrix_instance_q15 * pSrc,
+  riscv_sparse_block_matrix_instance_q15 * pDst,
+  uint32_t maxBlocks);
 
-/**
- * @brief Convolution of Q15 sequences.
- * @param[in] *pSrcA points to the first input sequence.
- * @param[in] srcALen length of the first input sequence.
- * @param[in] *pSrcB points to the second input sequence.
- * @param[in] srcBLen length of the second input sequence.
- * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.
- * @return none.
- */
+  /**
+   * @brief Floating-point sparse (CSR) matrix and vector multiplication
+   * @param[in]       *pSrcMat points to the input CSR matrix structure
+   * @param[in]       *pVec points to the input vector of numCols elements
+   * @param[out]      *pDst points to the output vector of numRows elements
+   * @return none.
+   */
 
-  void riscv_conv_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst);
+  void riscv_mat_sparse_vec_mult_f32(
+  const riscv_sparse_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst);
 
   /**
-   * @brief Convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @brief Floating-point block sparse (BSR) matrix and vector multiplication
+   * @param[in]       *pSrcMat points to the input BSR matrix structure
+   * @param[in]       *pVec points to the input vector of numCols elements
+   * @param[out]      *pDst points to the output vector of numRows elements
    * @return none.
    */
 
-  void riscv_conv_fast_q15(
-			  q15_t * pSrcA,
-			 uint32_t srcALen,
-			  q15_t * pSrcB,
-			 uint32_t srcBLen,
-			 q15_t * pDst);
+  void riscv_mat_sparse_block_vec_mult_f32(
+  const riscv_sparse_block_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst);
 
   /**
-   * @brief Convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
-   * @param[in]  *pScratch1 points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]  *pScratch2 points to scratch buffer of size min(srcALen, srcBLen).
-   * @return none.
+   * @brief Converts a floating-point dense matrix to the CSR format
+   * @param[in]       *pSrc points to the input dense matrix structure
+   * @param[in,out]   *pDst points to the CSR matrix structure with the buffers set by the caller
+   * @param[in]       maxNonZeros size of the pColIdx and pData buffers
+   * @return The function returns RISCV_MATH_LENGTH_ERROR if the matrix has more than maxNonZeros
+   * nonzero elements, otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_conv_fast_opt_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
-
-
+  riscv_status riscv_mat_sparse_from_dense_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_sparse_matrix_instance_f32 * pDst,
+  uint32_t maxNonZeros);
 
   /**
-   * @brief Convolution of Q31 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
-   * @return none.
+   * @brief Converts a floating-point dense matrix to the BSR format
+   * @param[in]       *pSrc points to the input dense matrix structure
+   * @param[in,out]   *pDst points to the BSR matrix structure with the block size and the buffers set by the caller
+   * @param[in]       maxBlocks number of blocks of the pColIdx and pData buffers
+   * @return The function returns RISCV_MATH_ARGUMENT_ERROR if the block size is not 1x4 or 2x2,
+   * RISCV_MATH_SIZE_MISMATCH if the matrix size is not a multiple of the block size,
+   * RISCV_MATH_LENGTH_ERROR if the matrix has more than maxBlocks nonzero blocks, otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_conv_q31(
-  q31_t * pSrcA,
-  uint32_t srcALen,
-  q31_t * pSrcB,
-  uint32_t srcBLen,
-  q31_t * pDst);
+  riscv_status riscv_mat_sparse_block_from_dense_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_sparse_block_matrix_instance_f32 * pDst,
+  uint32_t maxBlocks);
 
   /**
-   * @brief Convolution of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
-   * @return none.
+   * @brief Q7 matrix multiplication with fused requantization
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @param[in]       *pRequant points to the requantization parameters, or NULL for the default scaling
+   * @param[in]       *pState points to a buffer of numRowsB*numColsB elements
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_conv_fast_q31(
-  q31_t * pSrcA,
-  uint32_t srcALen,
-  q31_t * pSrcB,
-  uint32_t srcBLen,
-  q31_t * pDst);
-
+  riscv_status riscv_mat_mult_q7(
+  const riscv_matrix_instance_q7 * pSrcA,
+  const riscv_matrix_instance_q7 * pSrcB,
+  riscv_matrix_instance_q7 * pDst,
+  const riscv_mat_requant_q7 * pRequant,
+  q7_t * pState);
 
-    /**
-   * @brief Convolution of Q7 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
-   * @param[in]  *pScratch1 points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]  *pScratch2 points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
-   * @return none.
+  /**
+   * @brief Q31 matrix multiplication
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_conv_opt_q7(
-  q7_t * pSrcA,
-  uint32_t srcALen,
-  q7_t * pSrcB,
-  uint32_t srcBLen,
-  q7_t * pDst,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
-
-
+  riscv_status riscv_mat_mult_q31(
+  const riscv_matrix_instance_q31 * pSrcA,
+  const riscv_matrix_instance_q31 * pSrcB,
+  riscv_matrix_instance_q31 * pDst);
 
   /**
-   * @brief Convolution of Q7 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
-   * @return none.
+   * @brief Q31 matrix multiplication (fast variant) for Cortex-M3 and Cortex-M4
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  void riscv_conv_q7(
-  q7_t * pSrcA,
-  uint32_t srcALen,
-  q7_t * pSrcB,
-  uint32_t srcBLen,
-  q7_t * pDst);
+  riscv_status riscv_mat_mult_fast_q31(
+  const riscv_matrix_instance_q31 * pSrcA,
+  const riscv_matrix_instance_q31 * pSrcB,
+  riscv_matrix_instance_q31 * pDst);
 
 
   /**
-   * @brief Partial convolution of floating-point sequences.
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief Floating-point matrix subtraction
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  riscv_status riscv_conv_partial_f32(
-  float32_t * pSrcA,
-  uint32_t srcALen,
-  float32_t * pSrcB,
-  uint32_t srcBLen,
-  float32_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints);
+  riscv_status riscv_mat_sub_f32(
+  const riscv_matrix_instance_f32 * pSrcA,
+  const riscv_matrix_instance_f32 * pSrcB,
+  riscv_matrix_instance_f32 * pDst);
 
-    /**
-   * @brief Partial convolution of Q15 sequences.
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @param[in]       * pScratch1 points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]       * pScratch2 points to scratch buffer of size min(srcALen, srcBLen).
-   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+  /**
+   * @brief Q15 matrix subtraction
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  riscv_status riscv_conv_partial_opt_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
-
+  riscv_status riscv_mat_sub_q15(
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst);
 
-/**
-   * @brief Partial convolution of Q15 sequences.
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+  /**
+   * @brief Q31 matrix subtraction
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  riscv_status riscv_conv_partial_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints);
+  riscv_status riscv_mat_sub_q31(
+  const riscv_matrix_instance_q31 * pSrcA,
+  const riscv_matrix_instance_q31 * pSrcB,
+  riscv_matrix_instance_q31 * pDst);
 
   /**
-   * @brief Partial convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief Floating-point matrix scaling.
+   * @param[in]  *pSrc points to the input matrix
+   * @param[in]  scale scale factor
+   * @param[out] *pDst points to the output matrix
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  riscv_status riscv_conv_partial_fast_q15(
-				        q15_t * pSrcA,
-				       uint32_t srcALen,
-				        q15_t * pSrcB,
-				       uint32_t srcBLen,
-				       q15_t * pDst,
-				       uint32_t firstIndex,
-				       uint32_t numPoints);
-
+  riscv_status riscv_mat_scale_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  float32_t scale,
+  riscv_matrix_instance_f32 * pDst);
 
   /**
-   * @brief Partial convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @param[in]       * pScratch1 points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]       * pScratch2 points to scratch buffer of size min(srcALen, srcBLen).
-   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief Q15 matrix scaling.
+   * @param[in]       *pSrc points to input matrix
+   * @param[in]       scaleFract fractional portion of the scale factor
+   * @param[in]       shift number of bits to shift the result by
+   * @param[out]      *pDst points to output matrix
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  riscv_status riscv_conv_partial_fast_opt_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
-
+  riscv_status riscv_mat_scale_q15(
+  const riscv_matrix_instance_q15 * pSrc,
+  q15_t scaleFract,
+  int32_t shift,
+  riscv_matrix_instance_q15 * pDst);
 
   /**
-   * @brief Partial convolution of Q31 sequences.
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief Q31 matrix scaling.
+   * @param[in]       *pSrc points to input matrix
+   * @param[in]       scaleFract fractional portion of the scale factor
+   * @param[in]       shift number of bits to shift the result by
+   * @param[out]      *pDst points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 
-  riscv_status riscv_conv_partial_q31(
-  q31_t * pSrcA,
-  uint32_t srcALen,
-  q31_t * pSrcB,
-  uint32_t srcBLen,
-  q31_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints);
+  riscv_status riscv_mat_scale_q31(
+  const riscv_matrix_instance_q31 * pSrc,
+  q31_t scaleFract,
+  int32_t shift,
+  riscv_matrix_instance_q31 * pDst);
 
 
   /**
-   * @brief Partial convolution of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief  Q31 matrix initialization.
+   * @param[in,out] *S             points to an instance of the floating-point matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pData	       points to the matrix data array.
+   * @return        none
    */
 
-  riscv_status riscv_conv_partial_fast_q31(
-  q31_t * pSrcA,
-  uint32_t srcALen,
-  q31_t * pSrcB,
-  uint32_t srcBLen,
-  q31_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints);
-
+  void riscv_mat_init_q31(
+  riscv_matrix_instance_q31 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  q31_t * pData);
 
   /**
-   * @brief Partial convolution of Q7 sequences
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @param[in]  *pScratch1 points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]  *pScratch2 points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
-   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief  Q15 matrix initialization.
+   * @param[in,out] *S             points to an instance of the floating-point matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pData	       points to the matrix data array.
+   * @return        none
    */
 
-  riscv_status riscv_conv_partial_opt_q7(
-  q7_t * pSrcA,
-  uint32_t srcALen,
-  q7_t * pSrcB,
-  uint32_t srcBLen,
-  q7_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
-
+  void riscv_mat_init_q15(
+  riscv_matrix_instance_q15 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  q15_t * pData);
 
-/**
-   * @brief Partial convolution of Q7 sequences.
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+  /**
+   * @brief  Q7 matrix initialization.
+   * @param[in,out] *S             points to an instance of the Q7 matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pData	       points to the matrix data array.
+   * @return        none
    */
 
-  riscv_status riscv_conv_partial_q7(
-  q7_t * pSrcA,
-  uint32_t srcALen,
-  q7_t * pSrcB,
-  uint32_t srcBLen,
-  q7_t * pDst,
-  uint32_t firstIndex,
-  uint32_t numPoints);
+  void riscv_mat_init_q7(
+  riscv_matrix_instance_q7 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  q7_t * pData);
+
+  /**
+   * @brief  Floating-point matrix initialization.
+   * @param[in,out] *S             points to an instance of the floating-point matrix structure.
+   * @param[in]     nRows          number of rows in the matrix.
+   * @param[in]     nColumns       number of columns in the matrix.
+   * @param[in]     *pData	       points to the matrix data array.
+   * @return        none
+   */
 
+  void riscv_mat_init_f32(
+  riscv_matrix_instance_f32 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  float32_t * pData);
 
 
   /**
-   * @brief Instance structure for the Q15 FIR decimator.
+   * @brief Instance structure for the Q15 PID Control.
    */
+  typedef struct
+  {
+    q15_t A0;  
+
+#if defined (USE_DSP_RISCV)
+    shortV A1;        
+#else
+    q15_t A1;
+    q15_t A2;
+#endif         
+    q15_t state[3];     /**< The state array of length 3. */
+    q15_t Kp;           /**< The proportional gain. */
+    q15_t Ki;           /**< The integral gain. */
+    q15_t Kd;           /**< The derivative gain. */
+  } riscv_pid_instance_q15;
 
+  /**
+   * @brief Instance structure for the Q31 PID Control.
+   */
   typedef struct
   {
-    uint8_t M;                      /**< decimation factor. */
-    uint16_t numTaps;               /**< number of coefficients in the filter. */
-    q15_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numTaps.*/
-    q15_t *pState;                   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-  } riscv_fir_decimate_instance_q15;
+    q31_t A0;            /**< The derived gain, A0 = Kp + Ki + Kd . */
+    q31_t A1;            /**< The derived gain, A1 = -Kp - 2Kd. */
+    q31_t A2;            /**< The derived gain, A2 = Kd . */
+    q31_t state[3];      /**< The state array of length 3. */
+    q31_t Kp;            /**< The proportional gain. */
+    q31_t Ki;            /**< The integral gain. */
+    q31_t Kd;            /**< The derivative gain. */
+  } riscv_pid_instance_q31;
 
   /**
-   * @brief Instance structure for the Q31 FIR decimator.
+   * @brief Instance structure for the floating-point PID Control.
    */
+  typedef struct
+  {
+    float32_t A0;          /**< The derived gain, A0 = Kp + Ki + Kd . */
+    float32_t A1;          /**< The derived gain, A1 = -Kp - 2Kd. */
+    float32_t A2;          /**< The derived gain, A2 = Kd . */
+    float32_t state[3];    /**< The state array of length 3. */
+    float32_t Kp;          /**< The proportional gain. */
+    float32_t Ki;          /**< The integral gain. */
+    float32_t Kd;          /**< The derivative gain. */
+  } riscv_pid_instance_f32;
 
+  /**
+   * @brief Instance structure for a batch of floating-point PID controllers.
+   */
   typedef struct
   {
-    uint8_t M;                  /**< decimation factor. */
-    uint16_t numTaps;           /**< number of coefficients in the filter. */
-    q31_t *pCoeffs;              /**< points to the coefficient array. The array is of length numTaps.*/
-    q31_t *pState;               /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    uint16_t numLoops;     /**< number of controllers. */
+    float32_t *pCoeffs;    /**< points to the 3*numLoops derived gains, A0 of every controller, then A1, then A2. */
+    float32_t *pState;     /**< points to the 3*numLoops states, x[n-1] of every controller, then x[n-2], then y[n-1]. */
+    float32_t *pLimits;    /**< points to numLoops pairs {lower, upper} of output limits, or NULL. */
+  } riscv_pid_batch_instance_f32;
 
-  } riscv_fir_decimate_instance_q31;
+  /**
+   * @brief Instance structure for a batch of Q31 PID controllers.
+   */
+  typedef struct
+  {
+    uint16_t numLoops;     /**< number of controllers. */
+    q31_t *pCoeffs;        /**< points to the 3*numLoops derived gains, A0 of every controller, then A1, then A2. */
+    q31_t *pState;         /**< points to the 3*numLoops states, x[n-1] of every controller, then x[n-2], then y[n-1]. */
+    q31_t *pLimits;        /**< points to numLoops pairs {lower, upper} of output limits, or NULL. */
+  } riscv_pid_batch_instance_q31;
 
   /**
-   * @brief Instance structure for the floating-point FIR decimator.
+   * @brief Instance structure for a batch of Q15 PID controllers.
    */
+  typedef struct
+  {
+    uint16_t numLoops;     /**< number of controllers. */
+    q15_t *pCoeffs;        /**< points to the 3*numLoops derived gains, pairs {A1, A2} of every controller, then A0. */
+    q15_t *pState;         /**< points to the 3*numLoops states, pairs {x[n-1], x[n-2]} of every controller, then y[n-1]. */
+    q15_t *pLimits;        /**< points to numLoops pairs {lower, upper} of output limits, or NULL. */
+  } riscv_pid_batch_instance_q15;
 
+  /**
+   * @brief Instance structure for the floating-point field-oriented control step.
+   */
   typedef struct
   {
-    uint8_t M;                          /**< decimation factor. */
-    uint16_t numTaps;                   /**< number of coefficients in the filter. */
-    float32_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numTaps.*/
-    float32_t *pState;                   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    riscv_pid_instance_f32 pidD;   /**< current controller of the d axis. */
+    riscv_pid_instance_f32 pidQ;   /**< current controller of the q axis. */
+    float32_t Id;                  /**< measured d current of the last step. */
+    float32_t Iq;                  /**< measured q current of the last step. */
+  } riscv_foc_instance_f32;
 
-  } riscv_fir_decimate_instance_f32;
+  /**
+   * @brief Instance structure for the Q31 field-oriented control step.
+   */
+  typedef struct
+  {
+    riscv_pid_instance_q31 pidD;   /**< current controller of the d axis. */
+    riscv_pid_instance_q31 pidQ;   /**< current controller of the q axis. */
+    q31_t Id;                      /**< measured d current of the last step. */
+    q31_t Iq;                      /**< measured q current of the last step. */
+  } riscv_foc_instance_q31;
 
 
 
   /**
-   * @brief Processing function for the floating-point FIR decimator.
-   * @param[in] *S points to an instance of the floating-point FIR decimator structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none
+   * @brief  Initialization function for the floating-point PID Control.
+   * @param[in,out] S               points to an instance of the PID structure.
+   * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state 1 = reset the state.
    */
-
-  void riscv_fir_decimate_f32(
-  const riscv_fir_decimate_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
+  void riscv_pid_init_f32(
+  riscv_pid_instance_f32 * S,
+  int32_t resetStateFlag);
 
 
   /**
-   * @brief  Initialization function for the floating-point FIR decimator.
-   * @param[in,out] *S points to an instance of the floating-point FIR decimator structure.
-   * @param[in] numTaps  number of coefficients in the filter.
-   * @param[in] M  decimation factor.
-   * @param[in] *pCoeffs points to the filter coefficients.
-   * @param[in] *pState points to the state buffer.
-   * @param[in] blockSize number of input samples to process per call.
-   * @return    The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_LENGTH_ERROR if
-   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   * @brief  Reset function for the floating-point PID Control.
+   * @param[in,out] S  is an instance of the floating-point PID Control structure
    */
+  void riscv_pid_reset_f32(
+  riscv_pid_instance_f32 * S);
 
-  riscv_status riscv_fir_decimate_init_f32(
-  riscv_fir_decimate_instance_f32 * S,
-  uint16_t numTaps,
-  uint8_t M,
-  float32_t * pCoeffs,
-  float32_t * pState,
-  uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q15 FIR decimator.
-   * @param[in] *S points to an instance of the Q15 FIR decimator structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none
+   * @brief  Initialization function for the Q31 PID Control.
+   * @param[in,out] S               points to an instance of the Q15 PID structure.
+   * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state 1 = reset the state.
    */
+  void riscv_pid_init_q31(
+  riscv_pid_instance_q31 * S,
+  int32_t resetStateFlag);
 
-  void riscv_fir_decimate_q15(
-  const riscv_fir_decimate_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst,
-  uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q15 FIR decimator (fast variant) for Cortex-M3 and Cortex-M4.
-   * @param[in] *S points to an instance of the Q15 FIR decimator structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none
+   * @brief  Reset function for the Q31 PID Control.
+   * @param[in,out] S   points to an instance of the Q31 PID Control structure
    */
 
-  void riscv_fir_decimate_fast_q15(
-  const riscv_fir_decimate_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst,
-  uint32_t blockSize);
-
+  void riscv_pid_reset_q31(
+  riscv_pid_instance_q31 * S);
 
 
   /**
-   * @brief  Initialization function for the Q15 FIR decimator.
-   * @param[in,out] *S points to an instance of the Q15 FIR decimator structure.
-   * @param[in] numTaps  number of coefficients in the filter.
-   * @param[in] M  decimation factor.
-   * @param[in] *pCoeffs points to the filter coefficients.
-   * @param[in] *pState points to the state buffer.
-   * @param[in] blockSize number of input samples to process per call.
-   * @return    The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_LENGTH_ERROR if
-   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   * @brief  Initialization function for the Q15 PID Control.
+   * @param[in,out] S               points to an instance of the Q15 PID structure.
+   * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state 1 = reset the state.
    */
+  void riscv_pid_init_q15(
+  riscv_pid_instance_q15 * S,
+  int32_t resetStateFlag);
 
-  riscv_status riscv_fir_decimate_init_q15(
-  riscv_fir_decimate_instance_q15 * S,
-  uint16_t numTaps,
-  uint8_t M,
-  q15_t * pCoeffs,
-  q15_t * pState,
-  uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q31 FIR decimator.
-   * @param[in] *S points to an instance of the Q31 FIR decimator structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none
+   * @brief  Reset function for the Q15 PID Control.
+   * @param[in,out] S  points to an instance of the q15 PID Control structure
    */
+  void riscv_pid_reset_q15(
+  riscv_pid_instance_q15 * S);
 
-  void riscv_fir_decimate_q31(
-  const riscv_fir_decimate_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q31 FIR decimator (fast variant) for Cortex-M3 and Cortex-M4.
-   * @param[in] *S points to an instance of the Q31 FIR decimator structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none
+   * @brief  Initialization function for a batch of floating-point PID controllers.
+   * @param[in,out] S               points to an instance of the floating-point PID batch structure.
+   * @param[in]     numLoops        number of controllers.
+   * @param[in]     pKp             points to the numLoops proportional gains.
+   * @param[in]     pKi             points to the numLoops integral gains.
+   * @param[in]     pKd             points to the numLoops derivative gains.
+   * @param[in]     pCoeffs         points to a buffer of 3*numLoops derived gains.
+   * @param[in]     pState          points to a buffer of 3*numLoops states.
+   * @param[in]     pLimits         points to numLoops pairs {lower, upper} of output limits, or NULL.
+   * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state 1 = reset the state.
    */
+  void riscv_pid_batch_init_f32(
+  riscv_pid_batch_instance_f32 * S,
+  uint16_t numLoops,
+  const float32_t * pKp,
+  const float32_t * pKi,
+  const float32_t * pKd,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pLimits,
+  int32_t resetStateFlag);
 
-  void riscv_fir_decimate_fast_q31(
-  riscv_fir_decimate_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
+
+  /**
+   * @brief  Reset function for a batch of floating-point PID controllers.
+   * @param[in,out] S  points to an instance of the floating-point PID batch structure.
+   */
+  void riscv_pid_batch_reset_f32(
+  const riscv_pid_batch_instance_f32 * S);
 
 
   /**
-   * @brief  Initialization function for the Q31 FIR decimator.
-   * @param[in,out] *S points to an instance of the Q31 FIR decimator structure.
-   * @param[in] numTaps  number of coefficients in the filter.
-   * @param[in] M  decimation factor.
-   * @param[in] *pCoeffs points to the filter coefficients.
-   * @param[in] *pState points to the state buffer.
-   * @param[in] blockSize number of input samples to process per call.
-   * @return    The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_LENGTH_ERROR if
-   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   * @brief  Process function for a batch of floating-point PID controllers.
+   * @param[in]  S     points to an instance of the floating-point PID batch structure.
+   * @param[in]  pSrc  points to the numLoops inputs, one per controller.
+   * @param[out] pDst  points to the numLoops outputs, one per controller.
    */
+  void riscv_pid_batch_f32(
+  const riscv_pid_batch_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst);
 
-  riscv_status riscv_fir_decimate_init_q31(
-  riscv_fir_decimate_instance_q31 * S,
-  uint16_t numTaps,
-  uint8_t M,
+  /**
+   * @brief  Initialization function for a batch of Q31 PID controllers.
+   * @param[in,out] S               points to an instance of the Q31 PID batch structure.
+   * @param[in]     numLoops        number of controllers.
+   * @param[in]     pKp             points to the numLoops proportional gains.
+   * @param[in]     pKi             points to the numLoops integral gains.
+   * @param[in]     pKd             points to the numLoops derivative gains.
+   * @param[in]     pCoeffs         points to a buffer of 3*numLoops derived gains.
+   * @param[in]     pState          points to a buffer of 3*numLoops states.
+   * @param[in]     pLimits         points to numLoops pairs {lower, upper} of output limits, or NULL.
+   * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state 1 = reset the state.
+   */
+  void riscv_pid_batch_init_q31(
+  riscv_pid_batch_instance_q31 * S,
+  uint16_t numLoops,
+  const q31_t * pKp,
+  const q31_t * pKi,
+  const q31_t * pKd,
   q31_t * pCoeffs,
   q31_t * pState,
-  uint32_t blockSize);
+  q31_t * pLimits,
+  int32_t resetStateFlag);
+
 
+  /**
+   * @brief  Reset function for a batch of Q31 PID controllers.
+   * @param[in,out] S  points to an instance of the Q31 PID batch structure.
+   */
+  void riscv_pid_batch_reset_q31(
+  const riscv_pid_batch_instance_q31 * S);
 
 
   /**
-   * @brief Instance structure for the Q15 FIR interpolator.
+   * @brief  Process function for a batch of Q31 PID controllers.
+   * @param[in]  S     points to an instance of the Q31 PID batch structure.
+   * @param[in]  pSrc  points to the numLoops inputs, one per controller.
+   * @param[out] pDst  points to the numLoops outputs, one per controller.
    */
+  void riscv_pid_batch_q31(
+  const riscv_pid_batch_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst);
+
+  /**
+   * @brief  Initialization function for a batch of Q15 PID controllers.
+   * @param[in,out] S               points to an instance of the Q15 PID batch structure.
+   * @param[in]     numLoops        number of controllers.
+   * @param[in]     pKp             points to the numLoops proportional gains.
+   * @param[in]     pKi             points to the numLoops integral gains.
+   * @param[in]     pKd             points to the numLoops derivative gains.
+   * @param[in]     pCoeffs         points to a buffer of 3*numLoops derived gains.
+   * @param[in]     pState          points to a buffer of 3*numLoops states.
+   * @param[in]     pLimits         points to numLoops pairs {lower, upper} of output limits, or NULL.
+   * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state 1 = reset the state.
+   */
+  void riscv_pid_batch_init_q15(
+  riscv_pid_batch_instance_q15 * S,
+  uint16_t numLoops,
+  const q15_t * pKp,
+  const q15_t * pKi,
+  const q15_t * pKd,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  q15_t * pLimits,
+  int32_t resetStateFlag);
 
-  typedef struct
-  {
-    uint8_t L;                      /**< upsample factor. */
-    uint16_t phaseLength;           /**< length of each polyphase filter component. */
-    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
-    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
-  } riscv_fir_interpolate_instance_q15;
 
   /**
-   * @brief Instance structure for the Q31 FIR interpolator.
+   * @brief  Reset function for a batch of Q15 PID controllers.
+   * @param[in,out] S  points to an instance of the Q15 PID batch structure.
+   */
+  void riscv_pid_batch_reset_q15(
+  const riscv_pid_batch_instance_q15 * S);
+
+
+  /**
+   * @brief  Process function for a batch of Q15 PID controllers.
+   * @param[in]  S     points to an instance of the Q15 PID batch structure.
+   * @param[in]  pSrc  points to the numLoops inputs, one per controller.
+   * @param[out] pDst  points to the numLoops outputs, one per controller.
    */
+  void riscv_pid_batch_q15(
+  const riscv_pid_batch_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst);
 
+
+  /**
+   * @brief Instance structure for the floating-point Linear Interpolate function.
+   */
   typedef struct
   {
-    uint8_t L;                      /**< upsample factor. */
-    uint16_t phaseLength;           /**< length of each polyphase filter component. */
-    q31_t *pCoeffs;                  /**< points to the coefficient array. The array is of length L*phaseLength. */
-    q31_t *pState;                   /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
-  } riscv_fir_interpolate_instance_q31;
+    uint32_t nValues;           /**< nValues */
+    float32_t x1;               /**< x1 */
+    float32_t xSpacing;         /**< xSpacing */
+    float32_t *pYData;          /**< pointer to the table of Y values */
+  } riscv_linear_interp_instance_f32;
 
   /**
-   * @brief Instance structure for the floating-point FIR interpolator.
+   * @brief Instance structure for the floating-point bilinear interpolation function.
    */
 
   typedef struct
   {
-    uint8_t L;                     /**< upsample factor. */
-    uint16_t phaseLength;          /**< length of each polyphase filter component. */
-    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
-    float32_t *pState;              /**< points to the state variable array. The array is of length phaseLength+numTaps-1. */
-  } riscv_fir_interpolate_instance_f32;
+    uint16_t numRows;   /**< number of rows in the data table. */
+    uint16_t numCols;   /**< number of columns in the data table. */
+    float32_t *pData;   /**< points to the data table. */
+  } riscv_bilinear_interp_instance_f32;
+
+   /**
+   * @brief Instance structure for the Q31 bilinear interpolation function.
+   */
 
+  typedef struct
+  {
+    uint16_t numRows;   /**< number of rows in the data table. */
+    uint16_t numCols;   /**< number of columns in the data table. */
+    q31_t *pData;       /**< points to the data table. */
+  } riscv_bilinear_interp_instance_q31;
 
-  /**
-   * @brief Processing function for the Q15 FIR interpolator.
-   * @param[in] *S        points to an instance of the Q15 FIR interpolator structure.
-   * @param[in] *pSrc     points to the block of input data.
-   * @param[out] *pDst    points to the block of output data.
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none.
+   /**
+   * @brief Instance structure for the Q15 bilinear interpolation function.
    */
 
-  void riscv_fir_interpolate_q15(
-  const riscv_fir_interpolate_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst,
-  uint32_t blockSize);
+  typedef struct
+  {
+    uint16_t numRows;   /**< number of rows in the data table. */
+    uint16_t numCols;   /**< number of columns in the data table. */
+    q15_t *pData;       /**< points to the data table. */
+  } riscv_bilinear_interp_instance_q15;
+
+   /**
+   * @brief Instance structure for the Q15 bilinear interpolation function.
+   */
 
+  typedef struct
+  {
+    uint16_t numRows;   /**< number of rows in the data table. */
+    uint16_t numCols;   /**< number of columns in the data table. */
+    q7_t *pData;                /**< points to the data table. */
+  } riscv_bilinear_interp_instance_q7;
 
   /**
-   * @brief  Initialization function for the Q15 FIR interpolator.
-   * @param[in,out] *S        points to an instance of the Q15 FIR interpolator structure.
-   * @param[in]     L         upsample factor.
-   * @param[in]     numTaps   number of filter coefficients in the filter.
-   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
-   * @param[in]     *pState   points to the state buffer.
-   * @param[in]     blockSize number of input samples to process per call.
-   * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   * @brief End condition of the cubic spline.
    */
 
-  riscv_status riscv_fir_interpolate_init_q15(
-  riscv_fir_interpolate_instance_q15 * S,
-  uint8_t L,
-  uint16_t numTaps,
-  q15_t * pCoeffs,
-  q15_t * pState,
-  uint32_t blockSize);
+  typedef enum
+  {
+    RISCV_SPLINE_NATURAL = 0,            /**< Zero second derivative at both ends */
+    RISCV_SPLINE_PARABOLIC_RUNOUT = 1    /**< Parabolic first and last interval */
+  } riscv_spline_type;
 
   /**
-   * @brief Processing function for the Q31 FIR interpolator.
-   * @param[in] *S        points to an instance of the Q15 FIR interpolator structure.
-   * @param[in] *pSrc     points to the block of input data.
-   * @param[out] *pDst    points to the block of output data.
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none.
+   * @brief Instance structure for the floating-point cubic spline interpolation.
    */
 
-  void riscv_fir_interpolate_q31(
-  const riscv_fir_interpolate_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
+  typedef struct
+  {
+    riscv_spline_type type;     /**< end condition of the spline. */
+    float32_t *pX;              /**< points to the abscissas, strictly increasing. */
+    float32_t *pY;              /**< points to the values. */
+    uint32_t nValues;           /**< number of points. */
+    float32_t *pCoeffs;         /**< points to the coefficients b, c, d of every interval. */
+  } riscv_spline_instance_f32;
 
   /**
-   * @brief  Initialization function for the Q31 FIR interpolator.
-   * @param[in,out] *S        points to an instance of the Q31 FIR interpolator structure.
-   * @param[in]     L         upsample factor.
-   * @param[in]     numTaps   number of filter coefficients in the filter.
-   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
-   * @param[in]     *pState   points to the state buffer.
-   * @param[in]     blockSize number of input samples to process per call.
-   * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   * @brief Polynomial of the 4-point cubic interpolators.
    */
 
-  riscv_status riscv_fir_interpolate_init_q31(
-  riscv_fir_interpolate_instance_q31 * S,
-  uint8_t L,
-  uint16_t numTaps,
-  q31_t * pCoeffs,
-  q31_t * pState,
-  uint32_t blockSize);
-
+  typedef enum
+  {
+    RISCV_CUBIC_CATMULL_ROM = 0,         /**< Catmull-Rom spline */
+    RISCV_CUBIC_LAGRANGE = 1             /**< Third order Lagrange polynomial */
+  } riscv_cubic_interp_type;
 
   /**
-   * @brief Processing function for the floating-point FIR interpolator.
-   * @param[in] *S        points to an instance of the floating-point FIR interpolator structure.
-   * @param[in] *pSrc     points to the block of input data.
-   * @param[out] *pDst    points to the block of output data.
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none.
-   */
-
-  void riscv_fir_interpolate_f32(
-  const riscv_fir_interpolate_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
-
-  /**
-   * @brief  Initialization function for the floating-point FIR interpolator.
-   * @param[in,out] *S        points to an instance of the floating-point FIR interpolator structure.
-   * @param[in]     L         upsample factor.
-   * @param[in]     numTaps   number of filter coefficients in the filter.
-   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
-   * @param[in]     *pState   points to the state buffer.
-   * @param[in]     blockSize number of input samples to process per call.
-   * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
-   */
-
-  riscv_status riscv_fir_interpolate_init_f32(
-  riscv_fir_interpolate_instance_f32 * S,
-  uint8_t L,
-  uint16_t numTaps,
-  float32_t * pCoeffs,
-  float32_t * pState,
-  uint32_t blockSize);
-
-  /**
-   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   * @brief Instance structure for the floating-point fractional delay.
    */
 
   typedef struct
   {
-    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
-    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
-
-  } riscv_biquad_cas_df1_32x64_ins_q31;
-
-
-  /**
-   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
-   * @return none.
-   */
-
-  void riscv_biquad_cas_df1_32x64_q31(
-  const riscv_biquad_cas_df1_32x64_ins_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
-
-
-  /**
-   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]     numStages    number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
-   * @return        none
-   */
-
-  void riscv_biquad_cas_df1_32x64_init_q31(
-  riscv_biquad_cas_df1_32x64_ins_q31 * S,
-  uint8_t numStages,
-  q31_t * pCoeffs,
-  q63_t * pState,
-  uint8_t postShift);
-
-
+    riscv_cubic_interp_type type;   /**< interpolation polynomial. */
+    float32_t weights[4];           /**< interpolation weights, oldest sample first. */
+    float32_t *pState;              /**< points to the state variable array of length blockSize+3. */
+  } riscv_frac_delay_instance_f32;
 
   /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Instance structure for the Q31 fractional delay.
    */
 
   typedef struct
   {
-    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
-    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-  } riscv_biquad_cascade_df2T_instance_f32;
-
-
+    riscv_cubic_interp_type type;   /**< interpolation polynomial. */
+    q31_t weights[4];               /**< interpolation weights in 2.30 format, oldest sample first. */
+    q31_t *pState;                  /**< points to the state variable array of length blockSize+3. */
+  } riscv_frac_delay_instance_q31;
 
   /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Instance structure for the Q15 fractional delay.
    */
 
   typedef struct
   {
-    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-  } riscv_biquad_cascade_stereo_df2T_instance_f32;
-
+    riscv_cubic_interp_type type;   /**< interpolation polynomial. */
+    q15_t weights[4];               /**< interpolation weights in 2.14 format, oldest sample first. */
+    q15_t *pState;                  /**< points to the state variable array of length blockSize+3. */
+  } riscv_frac_delay_instance_q15;
 
 
   /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Q7 vector multiplication.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst  points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float64_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
-    float64_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-  } riscv_biquad_cascade_df2T_instance_f64;
-
+  void riscv_mult_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pDst,
+  uint32_t blockSize);
 
   /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in]  *S        points to an instance of the filter data structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
+   * @brief Q15 vector multiplication.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst  points to the output vector
+   * @param[in]       blockSize number of samples in each vector
    * @return none.
    */
 
-  void riscv_biquad_cascade_df2T_f32(
-  const riscv_biquad_cascade_df2T_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
+  void riscv_mult_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
   uint32_t blockSize);
 
-
   /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. 2 channels
-   * @param[in]  *S        points to an instance of the filter data structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
+   * @brief Q31 vector multiplication.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
    * @return none.
    */
 
-  void riscv_biquad_cascade_stereo_df2T_f32(
-  const riscv_biquad_cascade_stereo_df2T_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
+  void riscv_mult_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pDst,
   uint32_t blockSize);
 
   /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in]  *S        points to an instance of the filter data structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
+   * @brief Floating-point vector multiplication.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
    * @return none.
    */
 
-  void riscv_biquad_cascade_df2T_f64(
-  const riscv_biquad_cascade_df2T_instance_f64 * S,
-  float64_t * pSrc,
-  float64_t * pDst,
+  void riscv_mult_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
   uint32_t blockSize);
 
 
-  /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] *S           points to an instance of the filter data structure.
-   * @param[in]     numStages    number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @return        none
-   */
 
-  void riscv_biquad_cascade_df2T_init_f32(
-  riscv_biquad_cascade_df2T_instance_f32 * S,
-  uint8_t numStages,
-  float32_t * pCoeffs,
-  float32_t * pState);
+
 
 
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] *S           points to an instance of the filter data structure.
-   * @param[in]     numStages    number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @return        none
+   * @brief Instance structure for the Q15 CFFT/CIFFT function.
    */
 
-  void riscv_biquad_cascade_stereo_df2T_init_f32(
-  riscv_biquad_cascade_stereo_df2T_instance_f32 * S,
-  uint8_t numStages,
-  float32_t * pCoeffs,
-  float32_t * pState);
-
+  typedef struct
+  {
+    uint16_t fftLen;                 /**< length of the FFT. */
+    uint8_t ifftFlag;                /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
+    uint8_t bitReverseFlag;          /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
+    q15_t *pTwiddle;                     /**< points to the Sin twiddle factor table. */
+    uint16_t *pBitRevTable;          /**< points to the bit reversal table. */
+    uint16_t twidCoefModifier;       /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    uint16_t bitRevFactor;           /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
+  } riscv_cfft_radix2_instance_q15;
 
-  /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] *S           points to an instance of the filter data structure.
-   * @param[in]     numStages    number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @return        none
-   */
+/* Deprecated */
+  riscv_status riscv_cfft_radix2_init_q15(
+  riscv_cfft_radix2_instance_q15 * S,
+  uint16_t fftLen,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
 
-  void riscv_biquad_cascade_df2T_init_f64(
-  riscv_biquad_cascade_df2T_instance_f64 * S,
-  uint8_t numStages,
-  float64_t * pCoeffs,
-  float64_t * pState);
+/* Deprecated */
+  void riscv_cfft_radix2_q15(
+  const riscv_cfft_radix2_instance_q15 * S,
+  q15_t * pSrc);
 
 
 
   /**
-   * @brief Instance structure for the Q15 FIR lattice filter.
+   * @brief Instance structure for the Q15 CFFT/CIFFT function.
    */
 
   typedef struct
   {
-    uint16_t numStages;                          /**< number of filter stages. */
-    q15_t *pState;                               /**< points to the state variable array. The array is of length numStages. */
-    q15_t *pCoeffs;                              /**< points to the coefficient array. The array is of length numStages. */
-  } riscv_fir_lattice_instance_q15;
+    uint16_t fftLen;                 /**< length of the FFT. */
+    uint8_t ifftFlag;                /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
+    uint8_t bitReverseFlag;          /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
+    q15_t *pTwiddle;                 /**< points to the twiddle factor table. */
+    uint16_t *pBitRevTable;          /**< points to the bit reversal table. */
+    uint16_t twidCoefModifier;       /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    uint16_t bitRevFactor;           /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
+  } riscv_cfft_radix4_instance_q15;
 
-  /**
-   * @brief Instance structure for the Q31 FIR lattice filter.
-   */
+/* Deprecated */
+  riscv_status riscv_cfft_radix4_init_q15(
+  riscv_cfft_radix4_instance_q15 * S,
+  uint16_t fftLen,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
 
-  typedef struct
-  {
-    uint16_t numStages;                          /**< number of filter stages. */
-    q31_t *pState;                               /**< points to the state variable array. The array is of length numStages. */
-    q31_t *pCoeffs;                              /**< points to the coefficient array. The array is of length numStages. */
-  } riscv_fir_lattice_instance_q31;
+/* Deprecated */
+  void riscv_cfft_radix4_q15(
+  const riscv_cfft_radix4_instance_q15 * S,
+  q15_t * pSrc);
 
   /**
-   * @brief Instance structure for the floating-point FIR lattice filter.
+   * @brief Instance structure for the Radix-2 Q31 CFFT/CIFFT function.
    */
 
   typedef struct
   {
-    uint16_t numStages;                  /**< number of filter stages. */
-    float32_t *pState;                   /**< points to the state variable array. The array is of length numStages. */
-    float32_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numStages. */
-  } riscv_fir_lattice_instance_f32;
-
-  /**
-   * @brief Initialization function for the Q15 FIR lattice filter.
-   * @param[in] *S points to an instance of the Q15 FIR lattice structure.
-   * @param[in] numStages  number of filter stages.
-   * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
-   * @param[in] *pState points to the state buffer.  The array is of length numStages.
-   * @return none.
-   */
+    uint16_t fftLen;                 /**< length of the FFT. */
+    uint8_t ifftFlag;                /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
+    uint8_t bitReverseFlag;          /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
+    q31_t *pTwiddle;                     /**< points to the Twiddle factor table. */
+    uint16_t *pBitRevTable;          /**< points to the bit reversal table. */
+    uint16_t twidCoefModifier;       /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    uint16_t bitRevFactor;           /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
+  } riscv_cfft_radix2_instance_q31;
 
-  void riscv_fir_lattice_init_q15(
-  riscv_fir_lattice_instance_q15 * S,
-  uint16_t numStages,
-  q15_t * pCoeffs,
-  q15_t * pState);
+/* Deprecated */
+  riscv_status riscv_cfft_radix2_init_q31(
+  riscv_cfft_radix2_instance_q31 * S,
+  uint16_t fftLen,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
 
+/* Deprecated */
+  void riscv_cfft_radix2_q31(
+  const riscv_cfft_radix2_instance_q31 * S,
+  q31_t * pSrc);
 
   /**
-   * @brief Processing function for the Q15 FIR lattice filter.
-   * @param[in] *S points to an instance of the Q15 FIR lattice structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief Instance structure for the Q31 CFFT/CIFFT function.
    */
-  void riscv_fir_lattice_q15(
-  const riscv_fir_lattice_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst,
-  uint32_t blockSize);
 
-  /**
-   * @brief Initialization function for the Q31 FIR lattice filter.
-   * @param[in] *S points to an instance of the Q31 FIR lattice structure.
-   * @param[in] numStages  number of filter stages.
-   * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
-   * @param[in] *pState points to the state buffer.   The array is of length numStages.
-   * @return none.
-   */
+  typedef struct
+  {
+    uint16_t fftLen;                 /**< length of the FFT. */
+    uint8_t ifftFlag;                /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
+    uint8_t bitReverseFlag;          /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
+    q31_t *pTwiddle;                 /**< points to the twiddle factor table. */
+    uint16_t *pBitRevTable;          /**< points to the bit reversal table. */
+    uint16_t twidCoefModifier;       /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    uint16_t bitRevFactor;           /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
+  } riscv_cfft_radix4_instance_q31;
 
-  void riscv_fir_lattice_init_q31(
-  riscv_fir_lattice_instance_q31 * S,
-  uint16_t numStages,
-  q31_t * pCoeffs,
-  q31_t * pState);
+/* Deprecated */
+  void riscv_cfft_radix4_q31(
+  const riscv_cfft_radix4_instance_q31 * S,
+  q31_t * pSrc);
 
+/* Deprecated */
+  riscv_status riscv_cfft_radix4_init_q31(
+  riscv_cfft_radix4_instance_q31 * S,
+  uint16_t fftLen,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
 
   /**
-   * @brief Processing function for the Q31 FIR lattice filter.
-   * @param[in]  *S        points to an instance of the Q31 FIR lattice structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
-   * @return none.
+   * @brief Instance structure for the floating-point CFFT/CIFFT function.
    */
 
-  void riscv_fir_lattice_q31(
-  const riscv_fir_lattice_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
+  typedef struct
+  {
+    uint16_t fftLen;                   /**< length of the FFT. */
+    uint8_t ifftFlag;                  /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
+    uint8_t bitReverseFlag;            /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
+    float32_t *pTwiddle;               /**< points to the Twiddle factor table. */
+    uint16_t *pBitRevTable;            /**< points to the bit reversal table. */
+    uint16_t twidCoefModifier;         /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    uint16_t bitRevFactor;             /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
+    float32_t onebyfftLen;                 /**< value of 1/fftLen. */
+  } riscv_cfft_radix2_instance_f32;
 
-/**
- * @brief Initialization function for the floating-point FIR lattice filter.
- * @param[in] *S points to an instance of the floating-point FIR lattice structure.
- * @param[in] numStages  number of filter stages.
- * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
- * @param[in] *pState points to the state buffer.  The array is of length numStages.
- * @return none.
- */
+/* Deprecated */
+  riscv_status riscv_cfft_radix2_init_f32(
+  riscv_cfft_radix2_instance_f32 * S,
+  uint16_t fftLen,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
 
-  void riscv_fir_lattice_init_f32(
-  riscv_fir_lattice_instance_f32 * S,
-  uint16_t numStages,
-  float32_t * pCoeffs,
-  float32_t * pState);
+/* Deprecated */
+  void riscv_cfft_radix2_f32(
+  const riscv_cfft_radix2_instance_f32 * S,
+  float32_t * pSrc);
 
   /**
-   * @brief Processing function for the floating-point FIR lattice filter.
-   * @param[in]  *S        points to an instance of the floating-point FIR lattice structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
-   * @return none.
+   * @brief Instance structure for the floating-point CFFT/CIFFT function.
    */
 
-  void riscv_fir_lattice_f32(
-  const riscv_fir_lattice_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
-
-  /**
-   * @brief Instance structure for the Q15 IIR lattice filter.
-   */
   typedef struct
   {
-    uint16_t numStages;                         /**< number of stages in the filter. */
-    q15_t *pState;                              /**< points to the state variable array. The array is of length numStages+blockSize. */
-    q15_t *pkCoeffs;                            /**< points to the reflection coefficient array. The array is of length numStages. */
-    q15_t *pvCoeffs;                            /**< points to the ladder coefficient array. The array is of length numStages+1. */
-  } riscv_iir_lattice_instance_q15;
+    uint16_t fftLen;                   /**< length of the FFT. */
+    uint8_t ifftFlag;                  /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
+    uint8_t bitReverseFlag;            /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
+    float32_t *pTwiddle;               /**< points to the Twiddle factor table. */
+    uint16_t *pBitRevTable;            /**< points to the bit reversal table. */
+    uint16_t twidCoefModifier;         /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    uint16_t bitRevFactor;             /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
+    float32_t onebyfftLen;                 /**< value of 1/fftLen. */
+  } riscv_cfft_radix4_instance_f32;
 
-  /**
-   * @brief Instance structure for the Q31 IIR lattice filter.
-   */
-  typedef struct
-  {
-    uint16_t numStages;                         /**< number of stages in the filter. */
-    q31_t *pState;                              /**< points to the state variable array. The array is of length numStages+blockSize. */
-    q31_t *pkCoeffs;                            /**< points to the reflection coefficient array. The array is of length numStages. */
-    q31_t *pvCoeffs;                            /**< points to the ladder coefficient array. The array is of length numStages+1. */
-  } riscv_iir_lattice_instance_q31;
+/* Deprecated */
+  riscv_status riscv_cfft_radix4_init_f32(
+  riscv_cfft_radix4_instance_f32 * S,
+  uint16_t fftLen,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
+
+/* Deprecated */
+  void riscv_cfft_radix4_f32(
+  const riscv_cfft_radix4_instance_f32 * S,
+  float32_t * pSrc);
 
   /**
-   * @brief Instance structure for the floating-point IIR lattice filter.
+   * @brief Instance structure for the fixed-point CFFT/CIFFT function.
    */
+
   typedef struct
   {
-    uint16_t numStages;                         /**< number of stages in the filter. */
-    float32_t *pState;                          /**< points to the state variable array. The array is of length numStages+blockSize. */
-    float32_t *pkCoeffs;                        /**< points to the reflection coefficient array. The array is of length numStages. */
-    float32_t *pvCoeffs;                        /**< points to the ladder coefficient array. The array is of length numStages+1. */
-  } riscv_iir_lattice_instance_f32;
+    uint16_t fftLen;                   /**< length of the FFT. */
+    const q15_t *pTwiddle;             /**< points to the Twiddle factor table. */
+    const uint16_t *pBitRevTable;      /**< points to the bit reversal table. */
+    uint16_t bitRevLength;             /**< bit reversal table length. */
+  } riscv_cfft_instance_q15;
+
+void riscv_cfft_q15( 
+    const riscv_cfft_instance_q15 * S, 
+    q15_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag);  
 
   /**
-   * @brief Processing function for the floating-point IIR lattice filter.
-   * @param[in] *S points to an instance of the floating-point IIR lattice structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in] blockSize number of samples to process.
+   * @brief Q15 complex FFT reading from one buffer and writing to another.
+   * @param[in]  *S points to an instance of the Q15 CFFT structure.
+   * @param[in]  *pSrc points to the input buffer, which is not modified.
+   * @param[out] *pDst points to the output buffer, must not overlap pSrc.
+   * @param[in]  ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]  bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
    * @return none.
    */
 
-  void riscv_iir_lattice_f32(
-  const riscv_iir_lattice_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
+void riscv_cfft_oop_q15( 
+    const riscv_cfft_instance_q15 * S, 
+    const q15_t * pSrc,
+    q15_t * pDst,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag);  
 
   /**
-   * @brief Initialization function for the floating-point IIR lattice filter.
-   * @param[in] *S points to an instance of the floating-point IIR lattice structure.
-   * @param[in] numStages number of stages in the filter.
-   * @param[in] *pkCoeffs points to the reflection coefficient buffer.  The array is of length numStages.
-   * @param[in] *pvCoeffs points to the ladder coefficient buffer.  The array is of length numStages+1.
-   * @param[in] *pState points to the state buffer.  The array is of length numStages+blockSize-1.
-   * @param[in] blockSize number of samples to process.
+   * @brief Q15 complex FFT of several channels of the same length.
+   * @param[in]      *S points to an instance of the Q15 CFFT structure.
+   * @param[in, out] *p1 points to the channels, stored back to back with <code>2*fftLen</code> values each.
+   * @param[in]  numChannels number of channels.
+   * @param[in]  ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]  bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
    * @return none.
    */
 
-  void riscv_iir_lattice_init_f32(
-  riscv_iir_lattice_instance_f32 * S,
-  uint16_t numStages,
-  float32_t * pkCoeffs,
-  float32_t * pvCoeffs,
-  float32_t * pState,
-  uint32_t blockSize);
-
+void riscv_cfft_batch_q15( 
+    const riscv_cfft_instance_q15 * S, 
+    q15_t * p1,
+    uint16_t numChannels,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag);  
 
   /**
-   * @brief Processing function for the Q31 IIR lattice filter.
-   * @param[in] *S points to an instance of the Q31 IIR lattice structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in] blockSize number of samples to process.
+   * @brief Q15 complex FFT of a block floating-point vector.
+   * @param[in]      *S points to an instance of the Q15 CFFT structure.
+   * @param[in, out] *pBlock points to the block of <code>2*fftLen</code> values, the exponent is updated.
+   * @param[in]  ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]  bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
    * @return none.
    */
 
-  void riscv_iir_lattice_q31(
-  const riscv_iir_lattice_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
+void riscv_cfft_bfp_q15( 
+    const riscv_cfft_instance_q15 * S, 
+    riscv_bfp_q15 * pBlock,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag);  
 
+  /** Schedule of riscv_cfft_scaled_q15() and riscv_cfft_scaled_q31() that scales every stage. */
+#define RISCV_CFFT_SCALE_ALL  0x7FFFFFFFu
+  /** Schedule of riscv_cfft_scaled_q15() and riscv_cfft_scaled_q31() that scales a stage only if it could overflow. */
+#define RISCV_CFFT_SCALE_BFP  0x80000000u
 
   /**
-   * @brief Initialization function for the Q31 IIR lattice filter.
-   * @param[in] *S points to an instance of the Q31 IIR lattice structure.
-   * @param[in] numStages number of stages in the filter.
-   * @param[in] *pkCoeffs points to the reflection coefficient buffer.  The array is of length numStages.
-   * @param[in] *pvCoeffs points to the ladder coefficient buffer.  The array is of length numStages+1.
-   * @param[in] *pState points to the state buffer.  The array is of length numStages+blockSize.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief Q15 complex FFT with a per-stage scaling schedule or conditional block floating-point scaling.
+   * @param[in]      *S points to an instance of the Q15 CFFT structure.
+   * @param[in, out] *p1 points to the complex data buffer of size <code>2*fftLen</code>.
+   * @param[in]  ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]  bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+   * @param[in]  scaleSchedule bit s set scales stage s, or RISCV_CFFT_SCALE_BFP.
+   * @return the number of right shifts applied to the transform.
    */
 
-  void riscv_iir_lattice_init_q31(
-  riscv_iir_lattice_instance_q31 * S,
-  uint16_t numStages,
-  q31_t * pkCoeffs,
-  q31_t * pvCoeffs,
-  q31_t * pState,
-  uint32_t blockSize);
-
+uint32_t riscv_cfft_scaled_q15( 
+    const riscv_cfft_instance_q15 * S, 
+    q15_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    uint32_t scaleSchedule);  
 
   /**
-   * @brief Processing function for the Q15 IIR lattice filter.
-   * @param[in] *S points to an instance of the Q15 IIR lattice structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief Initialization function for the Q15 CFFT with tables computed at runtime.
+   * @param[out] *S points to an instance of the Q15 CFFT structure.
+   * @param[in]  fftLen length of the FFT.
+   * @param[out] *pTwiddle points to a buffer of <code>3*fftLen/2</code> words for the twiddle factors.
+   * @param[out] *pBitRevTable points to a buffer of RISCVBITREVINDEXTABLE_FIXED_*_TABLE_LENGTH entries for the bit reversal table.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>fftLen</code> is not a supported transform length.
    */
 
-  void riscv_iir_lattice_q15(
-  const riscv_iir_lattice_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst,
-  uint32_t blockSize);
-
+  riscv_status riscv_cfft_runtime_init_q15(
+  riscv_cfft_instance_q15 * S,
+  uint16_t fftLen,
+  q15_t * pTwiddle,
+  uint16_t * pBitRevTable);
 
-/**
- * @brief Initialization function for the Q15 IIR lattice filter.
- * @param[in] *S points to an instance of the fixed-point Q15 IIR lattice structure.
- * @param[in] numStages  number of stages in the filter.
- * @param[in] *pkCoeffs points to reflection coefficient buffer.  The array is of length numStages.
- * @param[in] *pvCoeffs points to ladder coefficient buffer.  The array is of length numStages+1.
- * @param[in] *pState points to state buffer.  The array is of length numStages+blockSize.
- * @param[in] blockSize number of samples to process per call.
- * @return none.
- */
+  /**
+   * @brief Initialization function for the Q15 CFFT with twiddle factors strided from a longer transform.
+   * @param[out] *S points to an instance of the Q15 CFFT structure.
+   * @param[in]  fftLen length of the FFT.
+   * @param[in]  *pMaster points to an initialized instance of length <code>fftLen</code> or longer.
+   * @param[out] *pTwiddle points to a buffer of <code>3*fftLen/2</code> words for the twiddle factors.
+   * @param[out] *pBitRevTable points to a buffer of RISCVBITREVINDEXTABLE_FIXED_*_TABLE_LENGTH entries for the bit reversal table.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>fftLen</code> is not a supported transform length.
+   */
 
-  void riscv_iir_lattice_init_q15(
-  riscv_iir_lattice_instance_q15 * S,
-  uint16_t numStages,
-  q15_t * pkCoeffs,
-  q15_t * pvCoeffs,
-  q15_t * pState,
-  uint32_t blockSize);
+  riscv_status riscv_cfft_strided_init_q15(
+  riscv_cfft_instance_q15 * S,
+  uint16_t fftLen,
+  const riscv_cfft_instance_q15 * pMaster,
+  q15_t * pTwiddle,
+  uint16_t * pBitRevTable);
 
   /**
-   * @brief Instance structure for the floating-point LMS filter.
+   * @brief Instance structure for the fixed-point CFFT/CIFFT function.
    */
 
   typedef struct
   {
-    uint16_t numTaps;    /**< number of coefficients in the filter. */
-    float32_t *pState;   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    float32_t *pCoeffs;  /**< points to the coefficient array. The array is of length numTaps. */
-    float32_t mu;        /**< step size that controls filter coefficient updates. */
-  } riscv_lms_instance_f32;
+    uint16_t fftLen;                   /**< length of the FFT. */
+    const q31_t *pTwiddle;             /**< points to the Twiddle factor table. */
+    const uint16_t *pBitRevTable;      /**< points to the bit reversal table. */
+    uint16_t bitRevLength;             /**< bit reversal table length. */
+  } riscv_cfft_instance_q31;
+
+void riscv_cfft_q31( 
+    const riscv_cfft_instance_q31 * S, 
+    q31_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag);  
 
   /**
-   * @brief Processing function for floating-point LMS filter.
-   * @param[in]  *S points to an instance of the floating-point LMS filter structure.
-   * @param[in]  *pSrc points to the block of input data.
-   * @param[in]  *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in]  blockSize number of samples to process.
-   * @return     none.
+   * @brief Q31 complex FFT reading from one buffer and writing to another.
+   * @param[in]  *S points to an instance of the Q31 CFFT structure.
+   * @param[in]  *pSrc points to the input buffer, which is not modified.
+   * @param[out] *pDst points to the output buffer, must not overlap pSrc.
+   * @param[in]  ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]  bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+   * @return none.
    */
 
-  void riscv_lms_f32(
-  const riscv_lms_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pRef,
-  float32_t * pOut,
-  float32_t * pErr,
-  uint32_t blockSize);
+void riscv_cfft_oop_q31( 
+    const riscv_cfft_instance_q31 * S, 
+    const q31_t * pSrc,
+    q31_t * pDst,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag);  
 
   /**
-   * @brief Initialization function for floating-point LMS filter.
-   * @param[in] *S points to an instance of the floating-point LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to the coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief Q31 complex FFT with a per-stage scaling schedule or conditional block floating-point scaling.
+   * @param[in]      *S points to an instance of the Q31 CFFT structure.
+   * @param[in, out] *p1 points to the complex data buffer of size <code>2*fftLen</code>.
+   * @param[in]  ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]  bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+   * @param[in]  scaleSchedule bit s set scales stage s, or RISCV_CFFT_SCALE_BFP.
+   * @return the number of right shifts applied to the transform.
    */
 
-  void riscv_lms_init_f32(
-  riscv_lms_instance_f32 * S,
-  uint16_t numTaps,
-  float32_t * pCoeffs,
-  float32_t * pState,
-  float32_t mu,
-  uint32_t blockSize);
+uint32_t riscv_cfft_scaled_q31( 
+    const riscv_cfft_instance_q31 * S, 
+    q31_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    uint32_t scaleSchedule);  
 
   /**
-   * @brief Instance structure for the Q15 LMS filter.
+   * @brief Initialization function for the Q31 CFFT with tables computed at runtime.
+   * @param[out] *S points to an instance of the Q31 CFFT structure.
+   * @param[in]  fftLen length of the FFT.
+   * @param[out] *pTwiddle points to a buffer of <code>3*fftLen/2</code> words for the twiddle factors.
+   * @param[out] *pBitRevTable points to a buffer of RISCVBITREVINDEXTABLE_FIXED_*_TABLE_LENGTH entries for the bit reversal table.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>fftLen</code> is not a supported transform length.
    */
 
-  typedef struct
-  {
-    uint16_t numTaps;    /**< number of coefficients in the filter. */
-    q15_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q15_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
-    q15_t mu;            /**< step size that controls filter coefficient updates. */
-    uint32_t postShift;  /**< bit shift applied to coefficients. */
-  } riscv_lms_instance_q15;
+  riscv_status riscv_cfft_runtime_init_q31(
+  riscv_cfft_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddle,
+  uint16_t * pBitRevTable);
 
+  /**
+   * @brief Initialization function for the Q31 CFFT with twiddle factors strided from a longer transform.
+   * @param[out] *S points to an instance of the Q31 CFFT structure.
+   * @param[in]  fftLen length of the FFT.
+   * @param[in]  *pMaster points to an initialized instance of length <code>fftLen</code> or longer.
+   * @param[out] *pTwiddle points to a buffer of <code>3*fftLen/2</code> words for the twiddle factors.
+   * @param[out] *pBitRevTable points to a buffer of RISCVBITREVINDEXTABLE_FIXED_*_TABLE_LENGTH entries for the bit reversal table.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>fftLen</code> is not a supported transform length.
+   */
 
+  riscv_status riscv_cfft_strided_init_q31(
+  riscv_cfft_instance_q31 * S,
+  uint16_t fftLen,
+  const riscv_cfft_instance_q31 * pMaster,
+  q31_t * pTwiddle,
+  uint16_t * pBitRevTable);
+  
   /**
-   * @brief Initialization function for the Q15 LMS filter.
-   * @param[in] *S points to an instance of the Q15 LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to the coefficient buffer.
-   * @param[in] *pState points to the state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @param[in] postShift bit shift applied to coefficients.
-   * @return    none.
+   * @brief Instance structure for the floating-point CFFT/CIFFT function.
    */
 
-  void riscv_lms_init_q15(
-  riscv_lms_instance_q15 * S,
-  uint16_t numTaps,
-  q15_t * pCoeffs,
-  q15_t * pState,
-  q15_t mu,
-  uint32_t blockSize,
-  uint32_t postShift);
+  typedef struct
+  {
+    uint16_t fftLen;                   /**< length of the FFT. */
+    const float32_t *pTwiddle;         /**< points to the Twiddle factor table. */
+    const uint16_t *pBitRevTable;      /**< points to the bit reversal table. */
+    uint16_t bitRevLength;             /**< bit reversal table length. */
+  } riscv_cfft_instance_f32;
 
   /**
-   * @brief Processing function for Q15 LMS filter.
-   * @param[in] *S points to an instance of the Q15 LMS filter structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[in] *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief ifftFlag of the floating-point CFFT and of riscv_rfft_fast_f32() that selects the inverse
+   * transform without the 1/fftLen scaling.
    */
+#define RISCV_FFT_INVERSE_NOSCALE  2u
 
-  void riscv_lms_q15(
-  const riscv_lms_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pRef,
-  q15_t * pOut,
-  q15_t * pErr,
-  uint32_t blockSize);
-
+  void riscv_cfft_f32(
+  const riscv_cfft_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
 
   /**
-   * @brief Instance structure for the Q31 LMS filter.
+   * @brief Floating-point complex FFT writing the output in natural order to a separate buffer.
+   * @param[in]      *S points to an instance of the floating-point CFFT structure.
+   * @param[in, out] *p1 points to the input buffer, used as work buffer and overwritten.
+   * @param[out]     *pDst points to the output buffer, must not overlap p1.
+   * @param[in]      ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint16_t numTaps;    /**< number of coefficients in the filter. */
-    q31_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q31_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
-    q31_t mu;            /**< step size that controls filter coefficient updates. */
-    uint32_t postShift;  /**< bit shift applied to coefficients. */
-
-  } riscv_lms_instance_q31;
+  void riscv_cfft_ordered_f32(
+  const riscv_cfft_instance_f32 * S,
+  float32_t * p1,
+  float32_t * pDst,
+  uint8_t ifftFlag);
 
   /**
-   * @brief Processing function for Q31 LMS filter.
-   * @param[in]  *S points to an instance of the Q15 LMS filter structure.
-   * @param[in]  *pSrc points to the block of input data.
-   * @param[in]  *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in]  blockSize number of samples to process.
-   * @return     none.
+   * @brief Floating-point complex FFT reading from one buffer and writing to another.
+   * @param[in]  *S points to an instance of the Floating-point CFFT structure.
+   * @param[in]  *pSrc points to the input buffer, which is not modified.
+   * @param[out] *pDst points to the output buffer, must not overlap pSrc.
+   * @param[in]  ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]  bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+   * @return none.
    */
 
-  void riscv_lms_q31(
-  const riscv_lms_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pRef,
-  q31_t * pOut,
-  q31_t * pErr,
-  uint32_t blockSize);
+  void riscv_cfft_oop_f32(
+  const riscv_cfft_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
 
   /**
-   * @brief Initialization function for Q31 LMS filter.
-   * @param[in] *S points to an instance of the Q31 LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @param[in] postShift bit shift applied to coefficients.
+   * @brief Floating-point complex FFT of several channels of the same length.
+   * @param[in]      *S points to an instance of the Floating-point CFFT structure.
+   * @param[in, out] *p1 points to the channels, stored back to back with <code>2*fftLen</code> values each.
+   * @param[in]  numChannels number of channels.
+   * @param[in]  ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]  bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
    * @return none.
    */
 
-  void riscv_lms_init_q31(
-  riscv_lms_instance_q31 * S,
-  uint16_t numTaps,
-  q31_t * pCoeffs,
-  q31_t * pState,
-  q31_t mu,
-  uint32_t blockSize,
-  uint32_t postShift);
+  void riscv_cfft_batch_f32(
+  const riscv_cfft_instance_f32 * S,
+  float32_t * p1,
+  uint16_t numChannels,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
 
   /**
-   * @brief Instance structure for the floating-point normalized LMS filter.
+   * @brief Instance structure for the pruned floating-point CFFT.
    */
+  typedef struct
+  {
+    uint16_t fftLen;                          /**< length of the transform. */
+    uint16_t inputLen;                        /**< number of input samples, the samples from inputLen on are zero. */
+    uint16_t firstBin;                        /**< first output bin. */
+    uint16_t numBins;                         /**< number of output bins. */
+    uint8_t outputSplit;                      /**< 1 when the sub-transforms run on the interleaved input sequences, 0 when they run on the pre-twiddled input. */
+    const riscv_cfft_instance_f32 *pSub;      /**< points to the CFFT instance of the sub-transforms. */
+    const float32_t *pTwiddle;                /**< points to the quarter-wave twiddle table of fftLen. */
+    float32_t *pScratch;                      /**< points to the scratch buffer. */
+  } riscv_cfft_pruned_instance_f32;
 
+  /**
+   * @brief Instance structure for the pruned Q15 CFFT.
+   */
   typedef struct
   {
-    uint16_t numTaps;     /**< number of coefficients in the filter. */
-    float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
-    float32_t mu;        /**< step size that control filter coefficient updates. */
-    float32_t energy;    /**< saves previous frame energy. */
-    float32_t x0;        /**< saves previous input sample. */
-  } riscv_lms_norm_instance_f32;
+    uint16_t fftLen;                          /**< length of the transform. */
+    uint16_t inputLen;                        /**< number of input samples, the samples from inputLen on are zero. */
+    uint16_t firstBin;                        /**< first output bin. */
+    uint16_t numBins;                         /**< number of output bins. */
+    uint8_t outputSplit;                      /**< 1 when the sub-transforms run on the interleaved input sequences, 0 when they run on the pre-twiddled input. */
+    const riscv_cfft_instance_q15 *pSub;      /**< points to the CFFT instance of the sub-transforms. */
+    const q15_t *pTwiddle;                    /**< points to the quarter-wave twiddle table of fftLen. */
+    q15_t *pScratch;                          /**< points to the scratch buffer, word aligned. */
+  } riscv_cfft_pruned_instance_q15;
+
+  /**
+   * @brief Initialization function for the pruned floating-point CFFT.
+   * @param[out] *S points to an instance of the pruned floating-point CFFT structure.
+   * @param[in]  fftLen length of the transform.
+   * @param[in]  inputLen number of input samples, the samples after them are zero.
+   * @param[in]  firstBin first output bin.
+   * @param[in]  numBins number of output bins.
+   * @param[in]  *pScratch points to the scratch buffer.
+   * @param[in]  scratchLen length of the scratch buffer in words.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * a parameter is not a supported value or the scratch buffer is too short.
+   */
+
+  riscv_status riscv_cfft_pruned_init_f32(
+  riscv_cfft_pruned_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t inputLen,
+  uint16_t firstBin,
+  uint16_t numBins,
+  float32_t * pScratch,
+  uint32_t scratchLen);
 
   /**
-   * @brief Processing function for floating-point normalized LMS filter.
-   * @param[in] *S points to an instance of the floating-point normalized LMS filter structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[in] *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in] blockSize number of samples to process.
+   * @brief Pruned floating-point complex FFT of a zero-padded input restricted to a range of bins.
+   * @param[in]  *S points to an instance of the pruned floating-point CFFT structure.
+   * @param[in]  *pSrc points to the <code>inputLen</code> complex input samples.
+   * @param[out] *pDst points to the <code>numBins</code> complex output bins.
    * @return none.
    */
 
-  void riscv_lms_norm_f32(
-  riscv_lms_norm_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pRef,
-  float32_t * pOut,
-  float32_t * pErr,
-  uint32_t blockSize);
+  void riscv_cfft_pruned_f32(
+  const riscv_cfft_pruned_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst);
 
   /**
-   * @brief Initialization function for floating-point normalized LMS filter.
-   * @param[in] *S points to an instance of the floating-point LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
+   * @brief Initialization function for the pruned Q15 CFFT.
+   * @param[out] *S points to an instance of the pruned Q15 CFFT structure.
+   * @param[in]  fftLen length of the transform.
+   * @param[in]  inputLen number of input samples, the samples after them are zero.
+   * @param[in]  firstBin first output bin.
+   * @param[in]  numBins number of output bins.
+   * @param[in]  *pScratch points to the scratch buffer.
+   * @param[in]  scratchLen length of the scratch buffer in Q15 values.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * a parameter is not a supported value or the scratch buffer is too short.
+   */
+
+  riscv_status riscv_cfft_pruned_init_q15(
+  riscv_cfft_pruned_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t inputLen,
+  uint16_t firstBin,
+  uint16_t numBins,
+  q15_t * pScratch,
+  uint32_t scratchLen);
+
+  /**
+   * @brief Pruned Q15 complex FFT of a zero-padded input restricted to a range of bins.
+   * @param[in]  *S points to an instance of the pruned Q15 CFFT structure.
+   * @param[in]  *pSrc points to the <code>inputLen</code> complex input samples.
+   * @param[out] *pDst points to the <code>numBins</code> complex output bins, scaled by 1/fftLen.
    * @return none.
    */
 
-  void riscv_lms_norm_init_f32(
-  riscv_lms_norm_instance_f32 * S,
-  uint16_t numTaps,
-  float32_t * pCoeffs,
-  float32_t * pState,
-  float32_t mu,
-  uint32_t blockSize);
+  void riscv_cfft_pruned_q15(
+  const riscv_cfft_pruned_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst);
 
+  /**
+   * @brief Coefficient buffer length in words of riscv_czt_init_f32() and riscv_czt_init_q31().
+   */
+#define RISCV_CZT_COEF_SIZE(inputLen, numBins, fftLen) (2u * ((inputLen) + (numBins) + (fftLen)))
 
   /**
-   * @brief Instance structure for the Q31 normalized LMS filter.
+   * @brief Instance structure for the floating-point chirp-Z transform.
    */
   typedef struct
   {
-    uint16_t numTaps;     /**< number of coefficients in the filter. */
-    q31_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q31_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
-    q31_t mu;             /**< step size that controls filter coefficient updates. */
-    uint8_t postShift;    /**< bit shift applied to coefficients. */
-    q31_t *recipTable;    /**< points to the reciprocal initial value table. */
-    q31_t energy;         /**< saves previous frame energy. */
-    q31_t x0;             /**< saves previous input sample. */
-  } riscv_lms_norm_instance_q31;
+    uint16_t inputLen;                        /**< number of complex input samples. */
+    uint16_t numBins;                         /**< number of output bins. */
+    const riscv_cfft_instance_f32 *pCfft;     /**< points to the CFFT instance of the convolution. */
+    const float32_t *pPre;                    /**< points to the input chirp of inputLen complex values. */
+    const float32_t *pPost;                   /**< points to the output chirp of numBins complex values. */
+    const float32_t *pFilter;                 /**< points to the spectrum of the convolution chirp, fftLen complex values. */
+    float32_t *pScratch;                      /**< points to the scratch buffer of 2*fftLen words. */
+  } riscv_czt_instance_f32;
 
   /**
-   * @brief Processing function for Q31 normalized LMS filter.
-   * @param[in] *S points to an instance of the Q31 normalized LMS filter structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[in] *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in] blockSize number of samples to process.
+   * @brief Instance structure for the Q31 chirp-Z transform.
+   */
+  typedef struct
+  {
+    uint16_t inputLen;                        /**< number of complex input samples. */
+    uint16_t numBins;                         /**< number of output bins. */
+    uint8_t filterShift;                      /**< exponent of the spectrum of the convolution chirp. */
+    const riscv_cfft_instance_q31 *pCfft;     /**< points to the CFFT instance of the convolution. */
+    const q31_t *pPre;                        /**< points to the input chirp of inputLen complex values. */
+    const q31_t *pPost;                       /**< points to the output chirp of numBins complex values. */
+    const q31_t *pFilter;                     /**< points to the spectrum of the convolution chirp, fftLen complex values. */
+    q31_t *pScratch;                          /**< points to the scratch buffer of 2*fftLen words. */
+  } riscv_czt_instance_q31;
+
+  /**
+   * @brief Initialization function for the floating-point chirp-Z transform.
+   * @param[out] *S points to an instance of the floating-point CZT structure.
+   * @param[in]  inputLen number of complex input samples.
+   * @param[in]  numBins number of output bins.
+   * @param[in]  fStart frequency of bin 0 in cycles per sample.
+   * @param[in]  fStep bin spacing in cycles per sample.
+   * @param[in]  *pCfft points to a CFFT instance of length <code>inputLen+numBins-1</code> or longer.
+   * @param[out] *pCoef points to a buffer of RISCV_CZT_COEF_SIZE(inputLen, numBins, pCfft->fftLen) words.
+   * @param[in]  *pScratch points to the scratch buffer of <code>2*pCfft->fftLen</code> words.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>inputLen</code> or <code>numBins</code> is 0 or the CFFT is too short.
+   */
+
+  riscv_status riscv_czt_init_f32(
+  riscv_czt_instance_f32 * S,
+  uint16_t inputLen,
+  uint16_t numBins,
+  float32_t fStart,
+  float32_t fStep,
+  const riscv_cfft_instance_f32 * pCfft,
+  float32_t * pCoef,
+  float32_t * pScratch);
+
+  /**
+   * @brief Floating-point chirp-Z transform.
+   * @param[in]  *S points to an instance of the floating-point CZT structure.
+   * @param[in]  *pSrc points to the <code>inputLen</code> complex input samples.
+   * @param[out] *pDst points to the <code>numBins</code> complex output bins.
    * @return none.
    */
 
-  void riscv_lms_norm_q31(
-  riscv_lms_norm_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pRef,
-  q31_t * pOut,
-  q31_t * pErr,
-  uint32_t blockSize);
+  void riscv_czt_f32(
+  const riscv_czt_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst);
 
   /**
-   * @brief Initialization function for Q31 normalized LMS filter.
-   * @param[in] *S points to an instance of the Q31 normalized LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @param[in] postShift bit shift applied to coefficients.
-   * @return none.
+   * @brief Initialization function for the Q31 chirp-Z transform.
+   * @param[out] *S points to an instance of the Q31 CZT structure.
+   * @param[in]  inputLen number of complex input samples.
+   * @param[in]  numBins number of output bins.
+   * @param[in]  fStart frequency of bin 0 in cycles per sample.
+   * @param[in]  fStep bin spacing in cycles per sample.
+   * @param[in]  *pCfft points to a Q31 CFFT instance of length <code>inputLen+numBins-1</code> or longer.
+   * @param[out] *pCoef points to a buffer of RISCV_CZT_COEF_SIZE(inputLen, numBins, pCfft->fftLen) words.
+   * @param[in]  *pScratch points to the scratch buffer of <code>2*pCfft->fftLen</code> words.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>inputLen</code> or <code>numBins</code> is 0 or the CFFT is too short.
+   */
+
+  riscv_status riscv_czt_init_q31(
+  riscv_czt_instance_q31 * S,
+  uint16_t inputLen,
+  uint16_t numBins,
+  float32_t fStart,
+  float32_t fStep,
+  const riscv_cfft_instance_q31 * pCfft,
+  q31_t * pCoef,
+  q31_t * pScratch);
+
+  /**
+   * @brief Q31 chirp-Z transform.
+   * @param[in]  *S points to an instance of the Q31 CZT structure.
+   * @param[in]  *pSrc points to the <code>inputLen</code> complex input samples.
+   * @param[out] *pDst points to the <code>numBins</code> complex output bins.
+   * @return the exponent of the output, the output is the transform times 2^-shift.
+   */
+
+  int32_t riscv_czt_q31(
+  const riscv_czt_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst);
+
+  /**
+   * @brief Initialization function for the floating-point CFFT with tables computed at runtime.
+   * @param[out] *S points to an instance of the floating-point CFFT structure.
+   * @param[in]  fftLen length of the FFT.
+   * @param[out] *pTwiddle points to a buffer of <code>2*fftLen</code> words for the twiddle factors.
+   * @param[out] *pBitRevTable points to a buffer of RISCVBITREVINDEXTABLE_*_TABLE_LENGTH entries for the bit reversal table.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>fftLen</code> is not a supported transform length.
    */
 
-  void riscv_lms_norm_init_q31(
-  riscv_lms_norm_instance_q31 * S,
-  uint16_t numTaps,
-  q31_t * pCoeffs,
-  q31_t * pState,
-  q31_t mu,
-  uint32_t blockSize,
-  uint8_t postShift);
+  riscv_status riscv_cfft_runtime_init_f32(
+  riscv_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pBitRevTable);
 
   /**
-   * @brief Instance structure for the Q15 normalized LMS filter.
+   * @brief Initialization function for the floating-point CFFT with twiddle factors strided from a longer transform.
+   * @param[out] *S points to an instance of the floating-point CFFT structure.
+   * @param[in]  fftLen length of the FFT.
+   * @param[in]  *pMaster points to an initialized instance of length <code>fftLen</code> or longer.
+   * @param[out] *pTwiddle points to a buffer of <code>2*fftLen</code> words for the twiddle factors.
+   * @param[out] *pBitRevTable points to a buffer of RISCVBITREVINDEXTABLE_*_TABLE_LENGTH entries for the bit reversal table.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>fftLen</code> is not a supported transform length.
    */
 
-  typedef struct
-  {
-    uint16_t numTaps;    /**< Number of coefficients in the filter. */
-    q15_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q15_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
-    q15_t mu;            /**< step size that controls filter coefficient updates. */
-    uint8_t postShift;   /**< bit shift applied to coefficients. */
-    q15_t *recipTable;   /**< Points to the reciprocal initial value table. */
-    q15_t energy;        /**< saves previous frame energy. */
-    q15_t x0;            /**< saves previous input sample. */
-  } riscv_lms_norm_instance_q15;
+  riscv_status riscv_cfft_strided_init_f32(
+  riscv_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  const riscv_cfft_instance_f32 * pMaster,
+  float32_t * pTwiddle,
+  uint16_t * pBitRevTable);
 
   /**
-   * @brief Processing function for Q15 normalized LMS filter.
-   * @param[in] *S points to an instance of the Q15 normalized LMS filter structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[in] *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief Generates the bit reversal table of the floating-point CFFT.
+   * @param[out] *pBitRevTable points to a buffer of RISCVBITREVINDEXTABLE_*_TABLE_LENGTH entries.
+   * @param[in]  fftLen length of the FFT.
+   * @return number of entries written to the table.
    */
 
-  void riscv_lms_norm_q15(
-  riscv_lms_norm_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pRef,
-  q15_t * pOut,
-  q15_t * pErr,
-  uint32_t blockSize);
-
+  uint16_t riscv_bitreversal_init_f32(
+  uint16_t * pBitRevTable,
+  uint16_t fftLen);
 
   /**
-   * @brief Initialization function for Q15 normalized LMS filter.
-   * @param[in] *S points to an instance of the Q15 normalized LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @param[in] postShift bit shift applied to coefficients.
-   * @return none.
+   * @brief Generates the bit reversal table of the Q31 and Q15 CFFT.
+   * @param[out] *pBitRevTable points to a buffer of RISCVBITREVINDEXTABLE_FIXED_*_TABLE_LENGTH entries.
+   * @param[in]  fftLen length of the FFT.
+   * @return number of entries written to the table.
    */
 
-  void riscv_lms_norm_init_q15(
-  riscv_lms_norm_instance_q15 * S,
-  uint16_t numTaps,
-  q15_t * pCoeffs,
-  q15_t * pState,
-  q15_t mu,
-  uint32_t blockSize,
-  uint8_t postShift);
+  uint16_t riscv_bitreversal_init_fixed(
+  uint16_t * pBitRevTable,
+  uint16_t fftLen);
 
   /**
-   * @brief Correlation of floating-point sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @return none.
+   * @brief Maximum number of stages of a mixed-radix CFFT, reached by 3^10 = 59049.
    */
+#define RISCV_CFFT_MIXED_MAX_STAGES  10u
 
-  void riscv_correlate_f32(
-  float32_t * pSrcA,
-  uint32_t srcALen,
-  float32_t * pSrcB,
-  uint32_t srcBLen,
-  float32_t * pDst);
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
+   */
 
+  typedef struct
+  {
+    uint16_t fftLen;                                    /**< length of the FFT. */
+    uint16_t numStages;                                 /**< number of radix-2, 3, 4 or 5 stages. */
+    uint16_t factors[2u * RISCV_CFFT_MIXED_MAX_STAGES]; /**< radix and remaining length of every stage. */
+    const float32_t *pTwiddle;                          /**< points to the fftLen+1 complex twiddle factors. */
+  } riscv_cfft_mixed_instance_f32;
 
-   /**
-   * @brief Correlation of Q15 sequences
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @param[in]  *pScratch points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @return none.
+  /**
+   * @brief Initialization function for the floating-point mixed-radix CFFT/CIFFT.
+   * @param[out] *S points to an instance of the floating-point mixed-radix CFFT structure.
+   * @param[in]  fftLen length of the FFT, a product of the factors 2, 3 and 5.
+   * @param[out] *pTwiddle points to a buffer of <code>2*(fftLen+1)</code> words for the twiddle factors.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>fftLen</code> is not a supported transform length.
    */
-  void riscv_correlate_opt_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  q15_t * pScratch);
 
+  riscv_status riscv_cfft_mixed_init_f32(
+  riscv_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle);
 
   /**
-   * @brief Correlation of Q15 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @brief Processing function for the floating-point mixed-radix CFFT/CIFFT.
+   * @param[in]  *S points to an instance of the floating-point mixed-radix CFFT structure.
+   * @param[in]  *pSrc points to the input buffer, which is not modified.
+   * @param[out] *pDst points to the output buffer in natural order, must not overlap pSrc.
+   * @param[in]  ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
    * @return none.
    */
 
-  void riscv_correlate_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst);
+  void riscv_cfft_mixed_f32(
+  const riscv_cfft_mixed_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint8_t ifftFlag);
 
   /**
-   * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @return none.
+   * @brief Instance structure for the Q15 RFFT/RIFFT function.
    */
 
-  void riscv_correlate_fast_q15(
-			       q15_t * pSrcA,
-			      uint32_t srcALen,
-			       q15_t * pSrcB,
-			      uint32_t srcBLen,
-			      q15_t * pDst);
+  typedef struct
+  {
+    uint32_t fftLenReal;                      /**< length of the real FFT. */
+    uint8_t ifftFlagR;                        /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
+    uint8_t bitReverseFlagR;                  /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
+    uint32_t twidCoefRModifier;               /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    q15_t *pTwiddleAReal;                     /**< points to the real twiddle factor table. */
+    q15_t *pTwiddleBReal;                     /**< points to the imag twiddle factor table. */
+    const riscv_cfft_instance_q15 *pCfft;       /**< points to the complex FFT instance. */
+  } riscv_rfft_instance_q15;
 
+  riscv_status riscv_rfft_init_q15(
+  riscv_rfft_instance_q15 * S,
+  uint32_t fftLenReal,
+  uint32_t ifftFlagR,
+  uint32_t bitReverseFlag);
 
+  void riscv_rfft_q15(
+  const riscv_rfft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst);
 
   /**
-   * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @param[in]  *pScratch points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @return none.
+   * @brief Instance structure for the Q31 RFFT/RIFFT function.
    */
 
-  void riscv_correlate_fast_opt_q15(
-  q15_t * pSrcA,
-  uint32_t srcALen,
-  q15_t * pSrcB,
-  uint32_t srcBLen,
-  q15_t * pDst,
-  q15_t * pScratch);
+  typedef struct
+  {
+    uint32_t fftLenReal;                        /**< length of the real FFT. */
+    uint8_t ifftFlagR;                          /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
+    uint8_t bitReverseFlagR;                    /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
+    uint32_t twidCoefRModifier;                 /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    q31_t *pTwiddleAReal;                       /**< points to the real twiddle factor table. */
+    q31_t *pTwiddleBReal;                       /**< points to the imag twiddle factor table. */
+    const riscv_cfft_instance_q31 *pCfft;         /**< points to the complex FFT instance. */
+  } riscv_rfft_instance_q31;
 
-  /**
-   * @brief Correlation of Q31 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @return none.
-   */
+  riscv_status riscv_rfft_init_q31(
+  riscv_rfft_instance_q31 * S,
+  uint32_t fftLenReal,
+  uint32_t ifftFlagR,
+  uint32_t bitReverseFlag);
 
-  void riscv_correlate_q31(
-  q31_t * pSrcA,
-  uint32_t srcALen,
-  q31_t * pSrcB,
-  uint32_t srcBLen,
+  void riscv_rfft_q31(
+  const riscv_rfft_instance_q31 * S,
+  q31_t * pSrc,
   q31_t * pDst);
 
   /**
-   * @brief Correlation of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @return none.
+   * @brief Instance structure for the floating-point RFFT/RIFFT function.
    */
 
-  void riscv_correlate_fast_q31(
-  q31_t * pSrcA,
-  uint32_t srcALen,
-  q31_t * pSrcB,
-  uint32_t srcBLen,
-  q31_t * pDst);
+  typedef struct
+  {
+    uint32_t fftLenReal;                        /**< length of the real FFT. */
+    uint16_t fftLenBy2;                         /**< length of the complex FFT. */
+    uint8_t ifftFlagR;                          /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
+    uint8_t bitReverseFlagR;                    /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
+    uint32_t twidCoefRModifier;                     /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    float32_t *pTwiddleAReal;                   /**< points to the real twiddle factor table. */
+    float32_t *pTwiddleBReal;                   /**< points to the imag twiddle factor table. */
+    riscv_cfft_radix4_instance_f32 *pCfft;        /**< points to the complex FFT instance. */
+  } riscv_rfft_instance_f32;
 
+  riscv_status riscv_rfft_init_f32(
+  riscv_rfft_instance_f32 * S,
+  riscv_cfft_radix4_instance_f32 * S_CFFT,
+  uint32_t fftLenReal,
+  uint32_t ifftFlagR,
+  uint32_t bitReverseFlag);
 
+  void riscv_rfft_f32(
+  const riscv_rfft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst);
 
- /**
-   * @brief Correlation of Q7 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @param[in]  *pScratch1 points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-   * @param[in]  *pScratch2 points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
-   * @return none.
+  /**
+   * @brief Instance structure for the floating-point RFFT/RIFFT function.
    */
 
-  void riscv_correlate_opt_q7(
-  q7_t * pSrcA,
-  uint32_t srcALen,
-  q7_t * pSrcB,
-  uint32_t srcBLen,
-  q7_t * pDst,
-  q15_t * pScratch1,
-  q15_t * pScratch2);
+typedef struct
+  {
+    riscv_cfft_instance_f32 Sint;      /**< Internal CFFT structure. */
+    uint16_t fftLenRFFT;                        /**< length of the real sequence */
+	float32_t * pTwiddleRFFT;					/**< Twiddle factors real stage  */
+  } riscv_rfft_fast_instance_f32 ;
 
+riscv_status riscv_rfft_fast_init_f32 (
+	riscv_rfft_fast_instance_f32 * S,
+	uint16_t fftLen);
 
   /**
-   * @brief Correlation of Q7 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @return none.
+   * @brief Length-specific initialization functions for the floating-point real FFT.
+   * @param[in,out] *S points to an riscv_rfft_fast_instance_f32 structure.
+   * @return The functions return RISCV_MATH_SUCCESS.
+   *
+   * Unlike riscv_rfft_fast_init_f32(), each of them only references the tables of its own length.
    */
 
-  void riscv_correlate_q7(
-  q7_t * pSrcA,
-  uint32_t srcALen,
-  q7_t * pSrcB,
-  uint32_t srcBLen,
-  q7_t * pDst);
+riscv_status riscv_rfft_fast_init_32_f32 (
+	riscv_rfft_fast_instance_f32 * S);
 
+riscv_status riscv_rfft_fast_init_64_f32 (
+	riscv_rfft_fast_instance_f32 * S);
 
-  /**
-   * @brief Instance structure for the floating-point sparse FIR filter.
-   */
-  typedef struct
-  {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    float32_t *pState;            /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    float32_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } riscv_fir_sparse_instance_f32;
+riscv_status riscv_rfft_fast_init_128_f32 (
+	riscv_rfft_fast_instance_f32 * S);
 
-  /**
-   * @brief Instance structure for the Q31 sparse FIR filter.
-   */
+riscv_status riscv_rfft_fast_init_256_f32 (
+	riscv_rfft_fast_instance_f32 * S);
 
-  typedef struct
-  {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q31_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q31_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } riscv_fir_sparse_instance_q31;
+riscv_status riscv_rfft_fast_init_512_f32 (
+	riscv_rfft_fast_instance_f32 * S);
+
+riscv_status riscv_rfft_fast_init_1024_f32 (
+	riscv_rfft_fast_instance_f32 * S);
+
+riscv_status riscv_rfft_fast_init_2048_f32 (
+	riscv_rfft_fast_instance_f32 * S);
+
+riscv_status riscv_rfft_fast_init_4096_f32 (
+	riscv_rfft_fast_instance_f32 * S);
+
+void riscv_rfft_fast_f32(
+  riscv_rfft_fast_instance_f32 * S,
+  float32_t * p, float32_t * pOut,
+  uint8_t ifftFlag);
 
   /**
-   * @brief Instance structure for the Q15 sparse FIR filter.
+   * @brief Instance structure for the floating-point fast convolution FIR filter.
    */
 
   typedef struct
   {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q15_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q15_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } riscv_fir_sparse_instance_q15;
+    uint16_t numTaps;                         /**< number of filter coefficients in the filter. */
+    uint16_t blockSize;                       /**< length of a partition of the impulse response and of the input. */
+    uint16_t numPartitions;                   /**< number of partitions, ceil(numTaps/blockSize). */
+    uint16_t fdlIndex;                        /**< slot of the next input spectrum in the frequency-domain delay line. */
+    riscv_rfft_fast_instance_f32 Srfft;       /**< real FFT of 2*blockSize points. */
+    float32_t *pState;                        /**< points to the state buffer of length 2*blockSize*(2*numPartitions+3). */
+  } riscv_fir_fft_instance_f32;
 
   /**
-   * @brief Instance structure for the Q7 sparse FIR filter.
+   * @brief Instance structure for the Q31 fast convolution FIR filter.
    */
 
   typedef struct
   {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q7_t *pState;                 /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q7_t *pCoeffs;                /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } riscv_fir_sparse_instance_q7;
+    riscv_fir_fft_instance_f32 Sfft;          /**< floating-point filter that does the work. */
+  } riscv_fir_fft_instance_q31;
 
   /**
-   * @brief Processing function for the floating-point sparse FIR filter.
-   * @param[in]  *S          points to an instance of the floating-point sparse FIR structure.
-   * @param[in]  *pSrc       points to the block of input data.
-   * @param[out] *pDst       points to the block of output data
-   * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize   number of input samples to process per call.
-   * @return none.
+   * @brief  Initialization function for the floating-point fast convolution FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point fast convolution FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer of length 2*blockSize*(2*ceil(numTaps/blockSize)+3).
+   * @param[in] blockSize length of a partition, a power of two from 16 to 2048.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization was successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> or <code>blockSize</code> is not a supported value.
    */
 
-  void riscv_fir_sparse_f32(
-  riscv_fir_sparse_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
-  float32_t * pScratchIn,
+  riscv_status riscv_fir_fft_init_f32(
+  riscv_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
   uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the floating-point sparse FIR filter.
-   * @param[in,out] *S         points to an instance of the floating-point sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     *pCoeffs   points to the array of filter coefficients.
-   * @param[in]     *pState    points to the state buffer.
-   * @param[in]     *pTapDelay points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
-   * @return none
+   * @brief  Initialization function for the Q31 fast convolution FIR filter.
+   * @param[in,out] *S points to an instance of the Q31 fast convolution FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the floating-point state buffer of length 2*blockSize*(2*ceil(numTaps/blockSize)+3).
+   * @param[in] blockSize length of a partition, a power of two from 16 to 2048.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization was successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> or <code>blockSize</code> is not a supported value.
    */
 
-  void riscv_fir_sparse_init_f32(
-  riscv_fir_sparse_instance_f32 * S,
+  riscv_status riscv_fir_fft_init_q31(
+  riscv_fir_fft_instance_q31 * S,
   uint16_t numTaps,
-  float32_t * pCoeffs,
+  const q31_t * pCoeffs,
   float32_t * pState,
-  int32_t * pTapDelay,
-  uint16_t maxDelay,
   uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q31 sparse FIR filter.
-   * @param[in]  *S          points to an instance of the Q31 sparse FIR structure.
-   * @param[in]  *pSrc       points to the block of input data.
-   * @param[out] *pDst       points to the block of output data
-   * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize   number of input samples to process per call.
+   * @brief Processing function for the floating-point fast convolution FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point fast convolution FIR structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process, a multiple of the partition length.
    * @return none.
    */
 
-  void riscv_fir_sparse_q31(
-  riscv_fir_sparse_instance_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
-  q31_t * pScratchIn,
+  void riscv_fir_fft_f32(
+  riscv_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
   uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the Q31 sparse FIR filter.
-   * @param[in,out] *S         points to an instance of the Q31 sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     *pCoeffs   points to the array of filter coefficients.
-   * @param[in]     *pState    points to the state buffer.
-   * @param[in]     *pTapDelay points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
-   * @return none
+   * @brief Processing function for the Q31 fast convolution FIR filter.
+   * @param[in,out] *S points to an instance of the Q31 fast convolution FIR structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process, a multiple of the partition length.
+   * @return none.
    */
 
-  void riscv_fir_sparse_init_q31(
-  riscv_fir_sparse_instance_q31 * S,
-  uint16_t numTaps,
-  q31_t * pCoeffs,
-  q31_t * pState,
-  int32_t * pTapDelay,
-  uint16_t maxDelay,
+  void riscv_fir_fft_q31(
+  riscv_fir_fft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
   uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q15 sparse FIR filter.
-   * @param[in]  *S           points to an instance of the Q15 sparse FIR structure.
-   * @param[in]  *pSrc        points to the block of input data.
-   * @param[out] *pDst        points to the block of output data
-   * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.
-   * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize    number of input samples to process per call.
-   * @return none.
+   * @brief Maximum number of FFT segments of the non-uniformly partitioned convolution FIR filter.
    */
+#define RISCV_FIR_NUPC_MAX_SEGMENTS 8u
 
-  void riscv_fir_sparse_q15(
-  riscv_fir_sparse_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst,
-  q15_t * pScratchIn,
-  q31_t * pScratchOut,
-  uint32_t blockSize);
+  /**
+   * @brief Instance structure for the floating-point non-uniformly partitioned convolution FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;                         /**< number of filter coefficients in the filter. */
+    uint16_t blockSize;                       /**< samples per call and length of the shortest partition. */
+    uint16_t numSegments;                     /**< number of FFT segments, 0 for at most 2*blockSize taps. */
+    uint32_t count;                           /**< calls since the initialization, selects the work of the segments. */
+    uint32_t ringIndex;                       /**< position of the next input sample in the input history. */
+    uint32_t ringLen;                         /**< length of the input history, three partitions of the last segment. */
+    float32_t *pRing;                         /**< points to the input history of the segments. */
+    riscv_fir_instance_f32 Shead;             /**< direct form filter of the first 2*blockSize taps. */
+    riscv_fir_fft_instance_f32 Sseg[RISCV_FIR_NUPC_MAX_SEGMENTS];  /**< segments of doubling partition length. */
+  } riscv_fir_nupc_instance_f32;
+
+  /**
+   * @brief  Length of the state buffer of the floating-point non-uniformly partitioned convolution FIR filter.
+   * @param[in] numTaps  Number of filter coefficients in the filter.
+   * @param[in] blockSize samples per call, a power of two from 16 to 2048.
+   * @return the length of the state buffer in words.
+   */
 
+  uint32_t riscv_fir_nupc_state_len_f32(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the Q15 sparse FIR filter.
-   * @param[in,out] *S         points to an instance of the Q15 sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     *pCoeffs   points to the array of filter coefficients.
-   * @param[in]     *pState    points to the state buffer.
-   * @param[in]     *pTapDelay points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
-   * @return none
+   * @brief  Initialization function for the floating-point non-uniformly partitioned convolution FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point non-uniformly partitioned convolution FIR structure.
+   * @param[in] numTaps  Number of filter coefficients in the filter.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer of riscv_fir_nupc_state_len_f32() words.
+   * @param[in] blockSize samples per call, a power of two from 16 to 2048.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization was successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> or <code>blockSize</code> is not a supported value.
    */
 
-  void riscv_fir_sparse_init_q15(
-  riscv_fir_sparse_instance_q15 * S,
+  riscv_status riscv_fir_nupc_init_f32(
+  riscv_fir_nupc_instance_f32 * S,
   uint16_t numTaps,
-  q15_t * pCoeffs,
-  q15_t * pState,
-  int32_t * pTapDelay,
-  uint16_t maxDelay,
+  float32_t * pCoeffs,
+  float32_t * pState,
   uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q7 sparse FIR filter.
-   * @param[in]  *S           points to an instance of the Q7 sparse FIR structure.
-   * @param[in]  *pSrc        points to the block of input data.
-   * @param[out] *pDst        points to the block of output data
-   * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.
-   * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize    number of input samples to process per call.
+   * @brief Processing function for the floating-point non-uniformly partitioned convolution FIR filter.
+   * @param[in,out] *S points to an instance of the floating-point non-uniformly partitioned convolution FIR structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process, a multiple of the initialization blockSize.
    * @return none.
    */
 
-  void riscv_fir_sparse_q7(
-  riscv_fir_sparse_instance_q7 * S,
-  q7_t * pSrc,
-  q7_t * pDst,
-  q7_t * pScratchIn,
-  q31_t * pScratchOut,
+  void riscv_fir_nupc_f32(
+  riscv_fir_nupc_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
   uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the Q7 sparse FIR filter.
-   * @param[in,out] *S         points to an instance of the Q7 sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     *pCoeffs   points to the array of filter coefficients.
-   * @param[in]     *pState    points to the state buffer.
-   * @param[in]     *pTapDelay points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
-   * @return none
+   * @brief Instance structure for the Q31 fast RFFT/RIFFT function.
    */
 
-  void riscv_fir_sparse_init_q7(
-  riscv_fir_sparse_instance_q7 * S,
-  uint16_t numTaps,
-  q7_t * pCoeffs,
-  q7_t * pState,
-  int32_t * pTapDelay,
-  uint16_t maxDelay,
-  uint32_t blockSize);
+typedef struct
+  {
+    riscv_cfft_instance_q31 Sint;      /**< Internal CFFT structure. */
+    uint16_t fftLenRFFT;                        /**< length of the real sequence */
+	q31_t * pTwiddleRFFT;					/**< Twiddle factors real stage  */
+  } riscv_rfft_fast_instance_q31 ;
 
+riscv_status riscv_rfft_fast_init_q31 (
+	riscv_rfft_fast_instance_q31 * S,
+	uint16_t fftLen);
 
-  /*
-   * @brief  Floating-point sin_cos function.
-   * @param[in]  theta    input value in degrees
-   * @param[out] *pSinVal points to the processed sine output.
-   * @param[out] *pCosVal points to the processed cos output.
-   * @return none.
+  /**
+   * @brief Length-specific initialization functions for the Q31 fast real FFT.
+   * @param[in,out] *S points to an riscv_rfft_fast_instance_q31 structure.
+   * @return The functions return RISCV_MATH_SUCCESS.
+   *
+   * Unlike riscv_rfft_fast_init_q31(), each of them only references the tables of its own length.
    */
 
-  void riscv_sin_cos_f32(
-  float32_t theta,
-  float32_t * pSinVal,
-  float32_t * pCcosVal);
+riscv_status riscv_rfft_fast_init_32_q31 (
+	riscv_rfft_fast_instance_q31 * S);
 
-  /*
-   * @brief  Q31 sin_cos function.
-   * @param[in]  theta    scaled input value in degrees
-   * @param[out] *pSinVal points to the processed sine output.
-   * @param[out] *pCosVal points to the processed cosine output.
-   * @return none.
+riscv_status riscv_rfft_fast_init_64_q31 (
+	riscv_rfft_fast_instance_q31 * S);
+
+riscv_status riscv_rfft_fast_init_128_q31 (
+	riscv_rfft_fast_instance_q31 * S);
+
+riscv_status riscv_rfft_fast_init_256_q31 (
+	riscv_rfft_fast_instance_q31 * S);
+
+riscv_status riscv_rfft_fast_init_512_q31 (
+	riscv_rfft_fast_instance_q31 * S);
+
+riscv_status riscv_rfft_fast_init_1024_q31 (
+	riscv_rfft_fast_instance_q31 * S);
+
+riscv_status riscv_rfft_fast_init_2048_q31 (
+	riscv_rfft_fast_instance_q31 * S);
+
+riscv_status riscv_rfft_fast_init_4096_q31 (
+	riscv_rfft_fast_instance_q31 * S);
+
+void riscv_rfft_fast_q31(
+  riscv_rfft_fast_instance_q31 * S,
+  q31_t * p, q31_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Windows of the window generators.
    */
 
-  void riscv_sin_cos_q31(
-  q31_t theta,
-  q31_t * pSinVal,
-  q31_t * pCosVal);
+  typedef enum
+  {
+    RISCV_WINDOW_HANN = 0,               /**< Hann window */
+    RISCV_WINDOW_HAMMING = 1,            /**< Hamming window */
+    RISCV_WINDOW_BLACKMAN = 2,           /**< Blackman window */
+    RISCV_WINDOW_KAISER = 3,             /**< Kaiser window of shape parameter beta */
+    RISCV_WINDOW_SINE = 4                /**< Sine window, satisfies the Princen-Bradley condition of the MDCT */
+  } riscv_window_type;
+
+  /**
+   * @brief  Floating-point window generator.
+   * @param[in]  type       window.
+   * @param[in]  beta       shape parameter of the Kaiser window, ignored by the other windows.
+   * @param[in]  windowLen  length of the window.
+   * @param[out] *pDst      points to the half table of (windowLen+1)/2 values.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR for unsupported arguments.
+   */
+
+  riscv_status riscv_window_f32(
+  riscv_window_type type,
+  float32_t beta,
+  uint32_t windowLen,
+  float32_t * pDst);
+
+  /**
+   * @brief  Q31 window generator.
+   * @param[in]  type       window.
+   * @param[in]  beta       shape parameter of the Kaiser window, ignored by the other windows.
+   * @param[in]  windowLen  length of the window.
+   * @param[out] *pDst      points to the half table of (windowLen+1)/2 values.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR for unsupported arguments.
+   */
 
+  riscv_status riscv_window_q31(
+  riscv_window_type type,
+  float32_t beta,
+  uint32_t windowLen,
+  q31_t * pDst);
 
   /**
-   * @brief  Floating-point complex conjugate.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
+   * @brief  Q15 window generator.
+   * @param[in]  type       window.
+   * @param[in]  beta       shape parameter of the Kaiser window, ignored by the other windows.
+   * @param[in]  windowLen  length of the window.
+   * @param[out] *pDst      points to the half table of (windowLen+1)/2 values.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR for unsupported arguments.
+   */
+
+  riscv_status riscv_window_q15(
+  riscv_window_type type,
+  float32_t beta,
+  uint32_t windowLen,
+  q15_t * pDst);
+
+  /**
+   * @brief  Multiplies a floating-point frame by a window.
+   * @param[in]  *pSrc      points to the frame of windowLen samples.
+   * @param[in]  *pWindow   points to the half table of riscv_window_f32().
+   * @param[out] *pDst      points to the windowed frame.
+   * @param[in]  windowLen  length of the window and of the frame.
    * @return none.
    */
 
-  void riscv_cmplx_conj_f32(
+  void riscv_window_apply_f32(
   float32_t * pSrc,
+  const float32_t * pWindow,
   float32_t * pDst,
-  uint32_t numSamples);
+  uint32_t windowLen);
 
   /**
-   * @brief  Q31 complex conjugate.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
+   * @brief  Multiplies a Q31 frame by a window.
+   * @param[in]  *pSrc      points to the frame of windowLen samples.
+   * @param[in]  *pWindow   points to the half table of riscv_window_q31().
+   * @param[out] *pDst      points to the windowed frame.
+   * @param[in]  windowLen  length of the window and of the frame.
    * @return none.
    */
 
-  void riscv_cmplx_conj_q31(
+  void riscv_window_apply_q31(
   q31_t * pSrc,
+  const q31_t * pWindow,
   q31_t * pDst,
-  uint32_t numSamples);
+  uint32_t windowLen);
 
   /**
-   * @brief  Q15 complex conjugate.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
+   * @brief  Multiplies a Q15 frame by a window.
+   * @param[in]  *pSrc      points to the frame of windowLen samples.
+   * @param[in]  *pWindow   points to the half table of riscv_window_q15().
+   * @param[out] *pDst      points to the windowed frame.
+   * @param[in]  windowLen  length of the window and of the frame.
    * @return none.
    */
 
-  void riscv_cmplx_conj_q15(
+  void riscv_window_apply_q15(
   q15_t * pSrc,
+  const q15_t * pWindow,
   q15_t * pDst,
-  uint32_t numSamples);
-
-
+  uint32_t windowLen);
 
   /**
-   * @brief  Floating-point complex magnitude squared
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
+   * @brief  Converts a Q15 frame to floating-point and multiplies it by a window.
+   * @param[in]  *pSrc      points to the Q15 frame of windowLen samples.
+   * @param[in]  *pWindow   points to the half table of riscv_window_f32().
+   * @param[out] *pDst      points to the windowed floating-point frame.
+   * @param[in]  windowLen  length of the window and of the frame.
    * @return none.
    */
 
-  void riscv_cmplx_mag_squared_f32(
-  float32_t * pSrc,
+  void riscv_window_apply_q15_f32(
+  q15_t * pSrc,
+  const float32_t * pWindow,
   float32_t * pDst,
-  uint32_t numSamples);
+  uint32_t windowLen);
 
   /**
-   * @brief  Q31 complex magnitude squared
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
+   * @brief Instance structure for the floating-point MDCT/IMDCT functions.
+   */
+
+  typedef struct
+  {
+    riscv_cfft_mixed_instance_f32 Scfft;      /**< N/2-point complex FFT. */
+    uint16_t N;                               /**< number of MDCT coefficients, half the frame length. */
+    const float32_t *pTwiddle;                /**< points to the N/2 complex pre- and post-twiddle factors. */
+    const float32_t *pWindow;                 /**< points to the first half of the window, N values. */
+    float32_t *pScratch;                      /**< points to the scratch buffer of length N. */
+    float32_t *pOverlap;                      /**< points to the IMDCT overlap buffer of length N. */
+  } riscv_mdct_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 MDCT/IMDCT functions.
+   */
+
+  typedef struct
+  {
+    riscv_cfft_instance_q31 Scfft;            /**< N/2-point complex FFT. */
+    uint16_t N;                               /**< number of MDCT coefficients, half the frame length. */
+    uint8_t outShift;                         /**< log2(2*N), the IMDCT output scaling. */
+    const q31_t *pTwiddle;                    /**< points to the N/2 complex pre- and post-twiddle factors. */
+    const q31_t *pWindow;                     /**< points to the first half of the window, N values. */
+    q31_t *pScratch;                          /**< points to the scratch buffer of length N. */
+    q31_t *pOverlap;                          /**< points to the IMDCT overlap buffer of length N. */
+  } riscv_mdct_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point MDCT/IMDCT.
+   * @param[out]    *S          points to an instance of the floating-point MDCT structure.
+   * @param[in]     N           number of MDCT coefficients, N/2 a product of the factors 2, 3 and 5.
+   * @param[out]    *pTwiddle   points to a buffer of 2*N+2 words for the twiddle factors.
+   * @param[in]     *pWindow    points to the first half of the window of length 2*N.
+   * @param[in]     *pScratch   points to the scratch buffer of length N.
+   * @param[in]     *pOverlap   points to the IMDCT overlap buffer of length N, or NULL for the MDCT only.
+   * @return        RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
+
+  riscv_status riscv_mdct_init_f32(
+  riscv_mdct_instance_f32 * S,
+  uint16_t N,
+  float32_t * pTwiddle,
+  const float32_t * pWindow,
+  float32_t * pScratch,
+  float32_t * pOverlap);
+
+  /**
+   * @brief Processing function for the floating-point MDCT.
+   * @param[in]     *S      points to an instance of the floating-point MDCT structure.
+   * @param[in]     *pSrc   points to the frame of 2*N samples.
+   * @param[out]    *pDst   points to the N MDCT coefficients.
    * @return none.
    */
 
-  void riscv_cmplx_mag_squared_q31(
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t numSamples);
+  void riscv_mdct_f32(
+  const riscv_mdct_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst);
 
   /**
-   * @brief  Q15 complex magnitude squared
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
+   * @brief Processing function for the floating-point IMDCT.
+   * @param[in]     *S      points to an instance of the floating-point MDCT structure.
+   * @param[in]     *pSrc   points to the N MDCT coefficients.
+   * @param[out]    *pDst   points to the N output samples.
    * @return none.
    */
 
-  void riscv_cmplx_mag_squared_q15(
-  q15_t * pSrc,
-  q15_t * pDst,
-  uint32_t numSamples);
+  void riscv_imdct_f32(
+  const riscv_mdct_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst);
 
+  /**
+   * @brief  Initialization function for the Q31 MDCT/IMDCT.
+   * @param[out]    *S             points to an instance of the Q31 MDCT structure.
+   * @param[in]     N              number of MDCT coefficients, a power of two from 32 to 8192.
+   * @param[out]    *pTwiddle      points to a buffer of 7*N/4 words for the twiddle factors.
+   * @param[out]    *pBitRevTable  points to a buffer of RISCVBITREVINDEXTABLE_FIXED_*_TABLE_LENGTH entries
+   *                               of the N/2-point CFFT for the bit reversal table.
+   * @param[in]     *pWindow       points to the first half of the window of length 2*N.
+   * @param[in]     *pScratch      points to the scratch buffer of length N.
+   * @param[in]     *pOverlap      points to the IMDCT overlap buffer of length N, or NULL for the MDCT only.
+   * @return        RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
 
+  riscv_status riscv_mdct_init_q31(
+  riscv_mdct_instance_q31 * S,
+  uint16_t N,
+  q31_t * pTwiddle,
+  uint16_t * pBitRevTable,
+  const q31_t * pWindow,
+  q31_t * pScratch,
+  q31_t * pOverlap);
 
- /**
-   * @ingroup groupController
+  /**
+   * @brief Processing function for the Q31 MDCT.
+   * @param[in]     *S      points to an instance of the Q31 MDCT structure.
+   * @param[in]     *pSrc   points to the frame of 2*N samples.
+   * @param[out]    *pDst   points to the N MDCT coefficients, scaled down by N.
+   * @return none.
    */
 
+  void riscv_mdct_q31(
+  const riscv_mdct_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst);
+
   /**
-   * @defgroup PID PID Motor Control
-   *
-   * A Proportional Integral Derivative (PID) controller is a generic feedback control
-   * loop mechanism widely used in industrial control systems.
-   * A PID controller is the most commonly used type of feedback controller.
-   *
-   * This set of functions implements (PID) controllers
-   * for Q15, Q31, and floating-point data types.  The functions operate on a single sample
-   * of data and each call to the function returns a single processed value.
-   * <code>S</code> points to an instance of the PID control data structure.  <code>in</code>
-   * is the input sample value. The functions return the output value.
-   *
-   * \par Algorithm:
-   * <pre>
-   *    y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]
-   *    A0 = Kp + Ki + Kd
-   *    A1 = (-Kp ) - (2 * Kd )
-   *    A2 = Kd  </pre>
-   *
-   * \par
-   * where \c Kp is proportional constant, \c Ki is Integral constant and \c Kd is Derivative constant
-   *
-   * \par
-   * \image html PID.gif "Proportional Integral Derivative Controller"
-   *
-   * \par
-   * The PID controller calculates an "error" value as the difference between
-   * the measured output and the reference input.
-   * The controller attempts to minimize the error by adjusting the process control inputs.
-   * The proportional value determines the reaction to the current error,
-   * the integral value determines the reaction based on the sum of recent errors,
-   * and the derivative value determines the reaction based on the rate at which the error has been changing.
-   *
-   * \par Instance Structure
-   * The Gains A0, A1, A2 and state variables for a PID controller are stored together in an instance data structure.
-   * A separate instance structure must be defined for each PID Controller.
-   * There are separate instance structure declarations for each of the 3 supported data types.
-   *
-   * \par Reset Functions
-   * There is also an associated reset function for each data type which clears the state array.
-   *
-   * \par Initialization Functions
-   * There is also an associated initialization function for each data type.
-   * The initialization function performs the following operations:
-   * - Initializes the Gains A0, A1, A2 from Kp,Ki, Kd gains.
-   * - Zeros out the values in the state buffer.
-   *
-   * \par
-   * Instance structure cannot be placed into a const data section and it is recommended to use the initialization function.
-   *
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the fixed-point versions of the PID Controller functions.
-   * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
+   * @brief Processing function for the Q31 IMDCT.
+   * @param[in]     *S      points to an instance of the Q31 MDCT structure.
+   * @param[in]     *pSrc   points to the N MDCT coefficients, scaled down by N.
+   * @param[out]    *pDst   points to the N output samples.
+   * @return none.
    */
 
+  void riscv_imdct_q31(
+  const riscv_mdct_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst);
+
   /**
-   * @addtogroup PID
-   * @{
+   * @brief Instance structure for the floating-point STFT function.
    */
 
+  typedef struct
+  {
+    riscv_rfft_fast_instance_f32 Srfft;       /**< real FFT of a frame. */
+    uint16_t fftLen;                          /**< length of a frame. */
+    uint16_t hopSize;                         /**< number of samples between the starts of two frames. */
+    uint16_t writeIndex;                      /**< position of the oldest sample in the ring buffer. */
+    uint16_t samplesToFrame;                  /**< number of samples to push before the next frame. */
+    uint8_t powerFlag;                        /**< flag that selects magnitude (powerFlag=0) or power (powerFlag=1) spectra. */
+    const float32_t *pWindow;                 /**< points to the window table of length fftLen. */
+    float32_t *pRing;                         /**< points to the ring buffer of length fftLen. */
+    float32_t *pScratch;                      /**< points to the scratch buffer of length fftLen. */
+  } riscv_stft_instance_f32;
+
   /**
-   * @brief  Process function for the floating-point PID Control.
-   * @param[in,out] S   is an instance of the floating-point PID Control structure
-   * @param[in]     in  input sample to process
-   * @return out processed output sample.
+   * @brief Instance structure for the Q15 STFT function.
    */
-  inline static float32_t riscv_pid_f32(
-  riscv_pid_instance_f32 * S,
-  float32_t in)
+
+  typedef struct
   {
-    float32_t out;
+    riscv_rfft_instance_q15 Srfft;            /**< real FFT of a frame. */
+    uint16_t fftLen;                          /**< length of a frame. */
+    uint16_t hopSize;                         /**< number of samples between the starts of two frames. */
+    uint16_t writeIndex;                      /**< position of the oldest sample in the ring buffer. */
+    uint16_t samplesToFrame;                  /**< number of samples to push before the next frame. */
+    uint8_t powerFlag;                        /**< flag that selects magnitude (powerFlag=0) or power (powerFlag=1) spectra. */
+    const q15_t *pWindow;                     /**< points to the window table of length fftLen. */
+    q15_t *pRing;                             /**< points to the ring buffer of length fftLen. */
+    q15_t *pScratch;                          /**< points to the scratch buffer of length fftLen. */
+  } riscv_stft_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point STFT.
+   * @param[out]    *S          points to an instance of the floating-point STFT structure.
+   * @param[in]     fftLen      length of a frame.
+   * @param[in]     hopSize     number of samples between the starts of two frames.
+   * @param[in]     powerFlag   magnitude spectra if flag is 0, power spectra if flag is 1.
+   * @param[in]     *pWindow    points to the window table of length fftLen.
+   * @param[in]     *pRing      points to the ring buffer of length fftLen.
+   * @param[in]     *pScratch   points to the scratch buffer of length fftLen.
+   * @return        RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
+
+  riscv_status riscv_stft_init_f32(
+  riscv_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  uint8_t powerFlag,
+  const float32_t * pWindow,
+  float32_t * pRing,
+  float32_t * pScratch);
 
-    /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]  */
-    out = (S->A0 * in) +
-      (S->A1 * S->state[0]) + (S->A2 * S->state[1]) + (S->state[2]);
+  /**
+   * @brief Processing function for the floating-point STFT.
+   * @param[in,out] *S         points to an instance of the floating-point STFT structure.
+   * @param[in]     *pSrc      points to the block of input samples.
+   * @param[in]     blockSize  number of samples to push.
+   * @param[out]    *pDst      points to the output frames, fftLen/2+1 values each.
+   * @return        number of frames written to pDst.
+   */
 
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
+  uint32_t riscv_stft_f32(
+  riscv_stft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst);
 
-    /* return to application */
-    return (out);
+  /**
+   * @brief  Initialization function for the Q15 STFT.
+   * @param[out]    *S          points to an instance of the Q15 STFT structure.
+   * @param[in]     fftLen      length of a frame.
+   * @param[in]     hopSize     number of samples between the starts of two frames.
+   * @param[in]     powerFlag   magnitude spectra if flag is 0, power spectra if flag is 1.
+   * @param[in]     *pWindow    points to the window table of length fftLen.
+   * @param[in]     *pRing      points to the ring buffer of length fftLen.
+   * @param[in]     *pScratch   points to the scratch buffer of length fftLen.
+   * @return        RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
 
-  }
+  riscv_status riscv_stft_init_q15(
+  riscv_stft_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  uint8_t powerFlag,
+  const q15_t * pWindow,
+  q15_t * pRing,
+  q15_t * pScratch);
 
   /**
-   * @brief  Process function for the Q31 PID Control.
-   * @param[in,out] S  points to an instance of the Q31 PID Control structure
-   * @param[in]     in  input sample to process
-   * @return out processed output sample.
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 64-bit accumulator.
-   * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
-   * Thus, if the accumulator result overflows it wraps around rather than clip.
-   * In order to avoid overflows completely the input signal must be scaled down by 2 bits as there are four additions.
-   * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format.
+   * @brief Processing function for the Q15 STFT.
+   * @param[in,out] *S         points to an instance of the Q15 STFT structure.
+   * @param[in]     *pSrc      points to the block of input samples.
+   * @param[in]     blockSize  number of samples to push.
+   * @param[out]    *pDst      points to the output frames, fftLen/2+1 values each.
+   * @return        number of frames written to pDst.
    */
-  inline static q31_t riscv_pid_q31(
-  riscv_pid_instance_q31 * S,
-  q31_t in)
+
+  uint32_t riscv_stft_q15(
+  riscv_stft_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point Welch spectral density estimate.
+   */
+
+  typedef struct
   {
-    q63_t acc;
-    q31_t out;
+    riscv_rfft_fast_instance_f32 Srfft;       /**< real FFT of a segment. */
+    uint16_t fftLen;                          /**< length of a segment. */
+    uint16_t hopSize;                         /**< number of samples between the starts of two segments. */
+    uint16_t writeIndex;                      /**< position of the oldest sample in the ring buffers. */
+    uint16_t samplesToSegment;                /**< number of samples to push before the next segment. */
+    uint8_t crossFlag;                        /**< flag that adds a second channel and the cross-spectrum (crossFlag=1). */
+    uint32_t numSegments;                     /**< number of segments in the average. */
+    float32_t windowEnergy;                   /**< sum of the squared window values. */
+    const float32_t *pWindow;                 /**< points to the window table of length fftLen. */
+    float32_t *pRing;                         /**< points to the ring buffers, fftLen samples per channel. */
+    float32_t *pScratch;                      /**< points to the scratch buffer, fftLen samples per channel. */
+    float32_t *pAcc;                          /**< points to the sums of |X|^2, and with crossFlag of |Y|^2 and X*conj(Y). */
+  } riscv_welch_instance_f32;
 
-    /* acc = A0 * x[n]  */
-    acc = (q63_t) S->A0 * in;
+  /**
+   * @brief Instance structure for the Q31 Welch spectral density estimate.
+   */
 
-    /* acc += A1 * x[n-1] */
-    acc += (q63_t) S->A1 * S->state[0];
+  typedef struct
+  {
+    riscv_rfft_fast_instance_q31 Srfft;       /**< real FFT of a segment. */
+    uint16_t fftLen;                          /**< length of a segment. */
+    uint16_t hopSize;                         /**< number of samples between the starts of two segments. */
+    uint16_t writeIndex;                      /**< position of the oldest sample in the ring buffers. */
+    uint16_t samplesToSegment;                /**< number of samples to push before the next segment. */
+    uint8_t crossFlag;                        /**< flag that adds a second channel and the cross-spectrum (crossFlag=1). */
+    uint32_t numSegments;                     /**< number of segments in the average. */
+    const q31_t *pWindow;                     /**< points to the window table of length fftLen. */
+    q31_t *pRing;                             /**< points to the ring buffers, fftLen samples per channel. */
+    q31_t *pScratch;                          /**< points to the scratch buffer, fftLen samples per channel. */
+    q63_t *pAcc;                              /**< points to the sums of |X|^2, and with crossFlag of |Y|^2 and X*conj(Y). */
+  } riscv_welch_instance_q31;
+
+  /**
+   * @brief Initialization function for the floating-point Welch estimate.
+   * @param[out] *S          points to an instance of the floating-point Welch structure.
+   * @param[in]  fftLen      length of a segment.
+   * @param[in]  hopSize     number of samples between the starts of two segments.
+   * @param[in]  crossFlag   one channel if flag is 0, two channels and their cross-spectrum if flag is 1.
+   * @param[in]  *pWindow    points to the window table of length <code>fftLen</code>.
+   * @param[in]  *pRing      points to the ring buffers, <code>fftLen</code> samples per channel.
+   * @param[in]  *pScratch   points to the scratch buffer, <code>fftLen</code> samples per channel.
+   * @param[in]  *pAcc       points to the accumulators, <code>fftLen/2+1</code> values, <code>4*(fftLen/2+1)</code> with crossFlag.
+   * @return     The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>fftLen</code> or <code>hopSize</code> is not a supported value.
+   */
+
+  riscv_status riscv_welch_init_f32(
+  riscv_welch_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  uint8_t crossFlag,
+  const float32_t * pWindow,
+  float32_t * pRing,
+  float32_t * pScratch,
+  float32_t * pAcc);
+
+  /**
+   * @brief Processing function for the floating-point Welch estimate.
+   * @param[in,out] *S         points to an instance of the floating-point Welch structure.
+   * @param[in]     *pSrcX     points to the block of samples of the first channel.
+   * @param[in]     *pSrcY     points to the block of samples of the second channel, or NULL without crossFlag.
+   * @param[in]     blockSize  number of samples to push.
+   * @return        number of segments added to the average.
+   */
+
+  uint32_t riscv_welch_f32(
+  riscv_welch_instance_f32 * S,
+  const float32_t * pSrcX,
+  const float32_t * pSrcY,
+  uint32_t blockSize);
 
-    /* acc += A2 * x[n-2]  */
-    acc += (q63_t) S->A2 * S->state[1];
+  /**
+   * @brief Power spectral density of a channel of the floating-point Welch estimate.
+   * @param[in]  *S        points to an instance of the floating-point Welch structure.
+   * @param[in]  channel   0 for the first channel, 1 for the second.
+   * @param[out] *pDst     points to the <code>fftLen/2+1</code> output bins.
+   * @return none.
+   */
 
-    /* convert output to 1.31 format to add y[n-1] */
-    out = (q31_t) (acc >> 31u);
+  void riscv_welch_psd_f32(
+  const riscv_welch_instance_f32 * S,
+  uint8_t channel,
+  float32_t * pDst);
 
-    /* out += y[n-1] */
-    out += S->state[2];
+  /**
+   * @brief Cross spectral density of the two channels of the floating-point Welch estimate.
+   * @param[in]  *S        points to an instance of the floating-point Welch structure initialized with crossFlag.
+   * @param[out] *pDst     points to the <code>fftLen/2+1</code> complex output bins.
+   * @return none.
+   */
 
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
+  void riscv_welch_csd_f32(
+  const riscv_welch_instance_f32 * S,
+  float32_t * pDst);
 
-    /* return to application */
-    return (out);
-  }
+  /**
+   * @brief Magnitude-squared coherence of the two channels of the floating-point Welch estimate.
+   * @param[in]  *S        points to an instance of the floating-point Welch structure initialized with crossFlag.
+   * @param[out] *pDst     points to the <code>fftLen/2+1</code> output bins.
+   * @return none.
+   */
 
+  void riscv_welch_coherence_f32(
+  const riscv_welch_instance_f32 * S,
+  float32_t * pDst);
 
   /**
-   * @brief  Process function for the Q15 PID Control.
-   * @param[in,out] S   points to an instance of the Q15 PID Control structure
-   * @param[in]     in  input sample to process
-   * @return out processed output sample.
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using a 64-bit internal accumulator.
-   * Both Gains and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
-   * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
-   * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
-   * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
-   * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+   * @brief Restarts the average of the floating-point Welch estimate.
+   * @param[in,out] *S  points to an instance of the floating-point Welch structure.
+   * @return none.
    */
-  inline static q15_t riscv_pid_q15(
-  riscv_pid_instance_q15 * S,
-  q15_t in)
-  {
-    q63_t acc;
-    q15_t out;
-    /* acc = A0 * x[n]  */
-    acc = ((q31_t) S->A0) * in;
-#if defined (USE_DSP_RISCV)
-    shortV Vstate = *(shortV*)S->state;
-    acc += dotpv2(S->A1,Vstate);
-#else
-    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
-    acc += (q31_t) S->A1 * S->state[0];
-    acc += (q31_t) S->A2 * S->state[1];
-    /* acc += y[n-1] */
-#endif
-    acc += (q31_t) S->state[2] << 15;
 
-    /* saturate the output */
-    out = (q15_t) (__SSAT((acc >> 15), 16));
+  void riscv_welch_reset_f32(
+  riscv_welch_instance_f32 * S);
 
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
+  /**
+   * @brief Initialization function for the Q31 Welch estimate.
+   * @param[out] *S          points to an instance of the Q31 Welch structure.
+   * @param[in]  fftLen      length of a segment.
+   * @param[in]  hopSize     number of samples between the starts of two segments.
+   * @param[in]  crossFlag   one channel if flag is 0, two channels and their cross-spectrum if flag is 1.
+   * @param[in]  *pWindow    points to the window table of length <code>fftLen</code>.
+   * @param[in]  *pRing      points to the ring buffers, <code>fftLen</code> samples per channel.
+   * @param[in]  *pScratch   points to the scratch buffer, <code>fftLen</code> samples per channel.
+   * @param[in]  *pAcc       points to the accumulators, <code>fftLen/2+1</code> values, <code>4*(fftLen/2+1)</code> with crossFlag.
+   * @return     The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>fftLen</code> or <code>hopSize</code> is not a supported value.
+   */
 
-    /* return to application */
-    return (out);
-  }
+  riscv_status riscv_welch_init_q31(
+  riscv_welch_instance_q31 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  uint8_t crossFlag,
+  const q31_t * pWindow,
+  q31_t * pRing,
+  q31_t * pScratch,
+  q63_t * pAcc);
+
+  /**
+   * @brief Processing function for the Q31 Welch estimate.
+   * @param[in,out] *S         points to an instance of the Q31 Welch structure.
+   * @param[in]     *pSrcX     points to the block of samples of the first channel.
+   * @param[in]     *pSrcY     points to the block of samples of the second channel, or NULL without crossFlag.
+   * @param[in]     blockSize  number of samples to push.
+   * @return        number of segments added to the average.
+   */
+
+  uint32_t riscv_welch_q31(
+  riscv_welch_instance_q31 * S,
+  const q31_t * pSrcX,
+  const q31_t * pSrcY,
+  uint32_t blockSize);
 
   /**
-   * @} end of PID group
+   * @brief Average power spectrum of a channel of the Q31 Welch estimate.
+   * @param[in]  *S        points to an instance of the Q31 Welch structure.
+   * @param[in]  channel   0 for the first channel, 1 for the second.
+   * @param[out] *pDst     points to the <code>fftLen/2+1</code> output bins.
+   * @return none.
    */
 
+  void riscv_welch_psd_q31(
+  const riscv_welch_instance_q31 * S,
+  uint8_t channel,
+  q31_t * pDst);
 
   /**
-   * @brief Floating-point matrix inverse.
-   * @param[in]  *src points to the instance of the input floating-point matrix structure.
-   * @param[out] *dst points to the instance of the output floating-point matrix structure.
-   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
-   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status RISCV_MATH_SINGULAR.
+   * @brief Average cross spectrum of the two channels of the Q31 Welch estimate.
+   * @param[in]  *S        points to an instance of the Q31 Welch structure initialized with crossFlag.
+   * @param[out] *pDst     points to the <code>fftLen/2+1</code> complex output bins.
+   * @return none.
    */
 
-  riscv_status riscv_mat_inverse_f32(
-  const riscv_matrix_instance_f32 * src,
-  riscv_matrix_instance_f32 * dst);
-
+  void riscv_welch_csd_q31(
+  const riscv_welch_instance_q31 * S,
+  q31_t * pDst);
 
   /**
-   * @brief Floating-point matrix inverse.
-   * @param[in]  *src points to the instance of the input floating-point matrix structure.
-   * @param[out] *dst points to the instance of the output floating-point matrix structure.
-   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
-   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status RISCV_MATH_SINGULAR.
+   * @brief Restarts the average of the Q31 Welch estimate.
+   * @param[in,out] *S  points to an instance of the Q31 Welch structure.
+   * @return none.
    */
 
-  riscv_status riscv_mat_inverse_f64(
-  const riscv_matrix_instance_f64 * src,
-  riscv_matrix_instance_f64 * dst);
+  void riscv_welch_reset_q31(
+  riscv_welch_instance_q31 * S);
 
+  /**
+   * @brief Wavelets of riscv_dwt_f32(), riscv_dwt_q15() and riscv_dwt_q31().
+   */
 
+  typedef enum
+  {
+    RISCV_DWT_HAAR = 0,                  /**< Haar wavelet, two taps */
+    RISCV_DWT_DB4 = 1                    /**< Daubechies-4 wavelet, four taps */
+  } riscv_dwt_wavelet;
 
   /**
-   * @ingroup groupController
+   * @brief Floating-point multi-level discrete wavelet transform by lifting, in place.
+   * @param[in,out] *pSrcDst     points to the block of samples.
+   * @param[in]     blockSize    number of samples, a multiple of 2^numLevels.
+   * @param[in]     numLevels    number of levels.
+   * @param[in]     wavelet      wavelet of the transform.
+   * @param[in]     inverseFlag  0 for the forward transform, 1 for the inverse transform.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the block cannot be split numLevels times.
    */
 
+  riscv_status riscv_dwt_f32(
+  float32_t * pSrcDst,
+  uint32_t blockSize,
+  uint8_t numLevels,
+  riscv_dwt_wavelet wavelet,
+  uint8_t inverseFlag);
 
   /**
-   * @defgroup clarke Vector Clarke Transform
-   * Forward Clarke transform converts the instantaneous stator phases into a two-coordinate time invariant vector.
-   * Generally the Clarke transform uses three-phase currents <code>Ia, Ib and Ic</code> to calculate currents
-   * in the two-phase orthogonal stator axis <code>Ialpha</code> and <code>Ibeta</code>.
-   * When <code>Ialpha</code> is superposed with <code>Ia</code> as shown in the figure below
-   * \image html clarke.gif Stator current space vector and its components in (a,b).
-   * and <code>Ia + Ib + Ic = 0</code>, in this condition <code>Ialpha</code> and <code>Ibeta</code>
-   * can be calculated using only <code>Ia</code> and <code>Ib</code>.
-   *
-   * The function operates on a single sample of data and each call to the function returns the processed output.
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html clarkeFormula.gif
-   * where <code>Ia</code> and <code>Ib</code> are the instantaneous stator phases and
-   * <code>pIalpha</code> and <code>pIbeta</code> are the two coordinates of time invariant vector.
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Clarke transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
+   * @brief Q15 multi-level discrete wavelet transform by lifting, in place.
+   * @param[in,out] *pSrcDst     points to the block of samples, 4-byte aligned.
+   * @param[in]     blockSize    number of samples, a multiple of 2^numLevels.
+   * @param[in]     numLevels    number of levels.
+   * @param[in]     wavelet      wavelet of the transform.
+   * @param[in]     inverseFlag  0 for the forward transform, 1 for the inverse transform.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the block cannot be split numLevels times.
    */
 
+  riscv_status riscv_dwt_q15(
+  q15_t * pSrcDst,
+  uint32_t blockSize,
+  uint8_t numLevels,
+  riscv_dwt_wavelet wavelet,
+  uint8_t inverseFlag);
+
   /**
-   * @addtogroup clarke
-   * @{
+   * @brief Q31 multi-level discrete wavelet transform by lifting, in place.
+   * @param[in,out] *pSrcDst     points to the block of samples.
+   * @param[in]     blockSize    number of samples, a multiple of 2^numLevels.
+   * @param[in]     numLevels    number of levels.
+   * @param[in]     wavelet      wavelet of the transform.
+   * @param[in]     inverseFlag  0 for the forward transform, 1 for the inverse transform.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the block cannot be split numLevels times.
    */
 
+  riscv_status riscv_dwt_q31(
+  q31_t * pSrcDst,
+  uint32_t blockSize,
+  uint8_t numLevels,
+  riscv_dwt_wavelet wavelet,
+  uint8_t inverseFlag);
+
   /**
-   *
-   * @brief  Floating-point Clarke transform
-   * @param[in]       Ia       input three-phase coordinate <code>a</code>
-   * @param[in]       Ib       input three-phase coordinate <code>b</code>
-   * @param[out]      *pIalpha points to output two-phase orthogonal vector axis alpha
-   * @param[out]      *pIbeta  points to output two-phase orthogonal vector axis beta
-   * @return none.
+   * @brief Instance structure for the floating-point MFCC function.
    */
 
-  inline static void riscv_clarke_f32(
-  float32_t Ia,
-  float32_t Ib,
-  float32_t * pIalpha,
-  float32_t * pIbeta)
+  typedef struct
   {
-    /* Calculate pIalpha using the equation, pIalpha = Ia */
-    *pIalpha = Ia;
-
-    /* Calculate pIbeta using the equation, pIbeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
-    *pIbeta =
-      ((float32_t) 0.57735026919 * Ia + (float32_t) 1.15470053838 * Ib);
+    riscv_rfft_fast_instance_f32 Srfft;       /**< real FFT of a frame. */
+    uint16_t fftLen;                          /**< length of a frame. */
+    uint16_t numFilters;                      /**< number of mel filters. */
+    uint16_t numCoefs;                        /**< number of cepstral coefficients. */
+    const float32_t *pWindow;                 /**< points to the window table of length fftLen. */
+    const uint16_t *pFilterPos;               /**< points to the start bin and the length of each filter. */
+    const float32_t *pFilterCoefs;            /**< points to the nonzero weights of all filters. */
+    float32_t *pDctCoefs;                     /**< points to the numCoefs x numFilters DCT-II table. */
+  } riscv_mfcc_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point MFCC.
+   * @param[out]    *S             points to an instance of the floating-point MFCC structure.
+   * @param[in]     fftLen         length of a frame.
+   * @param[in]     numFilters     number of mel filters.
+   * @param[in]     numCoefs       number of cepstral coefficients.
+   * @param[in]     *pWindow       points to the window table of length fftLen.
+   * @param[in]     *pFilterPos    points to the start bin and the length of each filter.
+   * @param[in]     *pFilterCoefs  points to the nonzero weights of all filters.
+   * @param[out]    *pDctCoefs     points to a buffer of numCoefs*numFilters values for the DCT-II table.
+   * @return        RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
+
+  riscv_status riscv_mfcc_init_f32(
+  riscv_mfcc_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t numFilters,
+  uint16_t numCoefs,
+  const float32_t * pWindow,
+  const uint16_t * pFilterPos,
+  const float32_t * pFilterCoefs,
+  float32_t * pDctCoefs);
+
+  /**
+   * @brief Processing function for the floating-point MFCC.
+   * @param[in]     *S      points to an instance of the floating-point MFCC structure.
+   * @param[in]     *pSrc   points to the frame of fftLen samples.
+   * @param[out]    *pDst   points to the numCoefs cepstral coefficients.
+   * @param[in]     *pTmp   points to a scratch buffer of 2*fftLen values.
+   * @return none.
+   */
 
-  }
+  void riscv_mfcc_f32(
+  riscv_mfcc_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pTmp);
 
   /**
-   * @brief  Clarke transform for Q31 version
-   * @param[in]       Ia       input three-phase coordinate <code>a</code>
-   * @param[in]       Ib       input three-phase coordinate <code>b</code>
-   * @param[out]      *pIalpha points to output two-phase orthogonal vector axis alpha
-   * @param[out]      *pIbeta  points to output two-phase orthogonal vector axis beta
+   * @brief  Band energies of the spectrum of riscv_rfft_fast_f32().
+   * @param[in]  *pSpec       points to the packed spectrum of fftLen values.
+   * @param[in]  fftLen       length of the real FFT.
+   * @param[in]  *pBandEdges  points to the numBands+1 band edges in bins, from 0 to fftLen/2+1.
+   * @param[in]  numBands     number of bands.
+   * @param[out] *pDst        points to the numBands energies.
    * @return none.
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the addition, hence there is no risk of overflow.
    */
-  inline static void riscv_clarke_q31(
-  q31_t Ia,
-  q31_t Ib,
-  q31_t * pIalpha,
-  q31_t * pIbeta)
-  {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
-
-    /* Calculating pIalpha from Ia by equation pIalpha = Ia */
-    *pIalpha = Ia;
-
-    /* Intermediate product is calculated by (1/(sqrt(3)) * Ia) */
-    product1 = (q31_t) (((q63_t) Ia * 0x24F34E8B) >> 30);
 
-    /* Intermediate product is calculated by (2/sqrt(3) * Ib) */
-    product2 = (q31_t) (((q63_t) Ib * 0x49E69D16) >> 30);
-
-    /* pIbeta is calculated by adding the intermediate products */
-    *pIbeta = __SSAT(product1 + product2,32);
-}
+  void riscv_band_energy_f32(
+  const float32_t * pSpec,
+  uint32_t fftLen,
+  const uint16_t * pBandEdges,
+  uint16_t numBands,
+  float32_t * pDst);
 
   /**
-   * @} end of clarke group
+   * @brief  Band energies of the spectrum of riscv_rfft_q15().
+   * @param[in]  *pSpec       points to the interleaved spectrum, bins 0 to fftLen/2.
+   * @param[in]  fftLen       length of the real FFT.
+   * @param[in]  *pBandEdges  points to the numBands+1 band edges in bins, from 0 to fftLen/2+1.
+   * @param[in]  numBands     number of bands.
+   * @param[out] *pDst        points to the numBands energies in 34.30 format.
+   * @return none.
    */
 
+  void riscv_band_energy_q15(
+  const q15_t * pSpec,
+  uint32_t fftLen,
+  const uint16_t * pBandEdges,
+  uint16_t numBands,
+  q63_t * pDst);
+
   /**
-   * @brief  Converts the elements of the Q7 vector to Q31 vector.
-   * @param[in]  *pSrc     input pointer
-   * @param[out]  *pDst    output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief  8-point floating-point DCT-II.
+   * @param[in]  *pSrc points to the 8 input samples.
+   * @param[out] *pDst points to the 8 output coefficients.
    * @return none.
    */
-  void riscv_q7_to_q31(
-  q7_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
 
+  void riscv_dct2_8_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
+  /**
+   * @brief  16-point floating-point DCT-II.
+   * @param[in]  *pSrc points to the 16 input samples.
+   * @param[out] *pDst points to the 16 output coefficients.
+   * @return none.
+   */
 
+  void riscv_dct2_16_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
   /**
-   * @ingroup groupController
+   * @brief  32-point floating-point DCT-II.
+   * @param[in]  *pSrc points to the 32 input samples.
+   * @param[out] *pDst points to the 32 output coefficients.
+   * @return none.
    */
 
+  void riscv_dct2_32_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
+
   /**
-   * @defgroup inv_clarke Vector Inverse Clarke Transform
-   * Inverse Clarke transform converts the two-coordinate time invariant vector into instantaneous stator phases.
-   *
-   * The function operates on a single sample of data and each call to the function returns the processed output.
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html clarkeInvFormula.gif
-   * where <code>pIa</code> and <code>pIb</code> are the instantaneous stator phases and
-   * <code>Ialpha</code> and <code>Ibeta</code> are the two coordinates of time invariant vector.
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Clarke transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
+   * @brief  8-point floating-point DCT-III, the inverse of riscv_dct2_8_f32().
+   * @param[in]  *pSrc points to the 8 input coefficients.
+   * @param[out] *pDst points to the 8 output samples.
+   * @return none.
    */
 
+  void riscv_dct3_8_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
+
   /**
-   * @addtogroup inv_clarke
-   * @{
+   * @brief  16-point floating-point DCT-III, the inverse of riscv_dct2_16_f32().
+   * @param[in]  *pSrc points to the 16 input coefficients.
+   * @param[out] *pDst points to the 16 output samples.
+   * @return none.
    */
 
-   /**
-   * @brief  Floating-point Inverse Clarke transform
-   * @param[in]       Ialpha  input two-phase orthogonal vector axis alpha
-   * @param[in]       Ibeta   input two-phase orthogonal vector axis beta
-   * @param[out]      *pIa    points to output three-phase coordinate <code>a</code>
-   * @param[out]      *pIb    points to output three-phase coordinate <code>b</code>
+  void riscv_dct3_16_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+  /**
+   * @brief  32-point floating-point DCT-III, the inverse of riscv_dct2_32_f32().
+   * @param[in]  *pSrc points to the 32 input coefficients.
+   * @param[out] *pDst points to the 32 output samples.
    * @return none.
    */
 
+  void riscv_dct3_32_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
-  inline void riscv_inv_clarke_f32(
-  float32_t Ialpha,
-  float32_t Ibeta,
-  float32_t * pIa,
-  float32_t * pIb)
-  {
-    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
-    *pIa = Ialpha;
-
-    /* Calculating pIb from Ialpha and Ibeta by equation pIb = -(1/2) * Ialpha + (sqrt(3)/2) * Ibeta */
-    *pIb = -0.5 * Ialpha + (float32_t) 0.8660254039 *Ibeta;
+  /**
+   * @brief  8-point Q15 DCT-II.
+   * @param[in]  *pSrc points to the 8 input samples.
+   * @param[out] *pDst points to the 8 output coefficients.
+   * @return none.
+   */
 
-  }
+  void riscv_dct2_8_q15(
+  const q15_t * pSrc,
+  q15_t * pDst);
 
   /**
-   * @brief  Inverse Clarke transform for Q31 version
-   * @param[in]       Ialpha  input two-phase orthogonal vector axis alpha
-   * @param[in]       Ibeta   input two-phase orthogonal vector axis beta
-   * @param[out]      *pIa    points to output three-phase coordinate <code>a</code>
-   * @param[out]      *pIb    points to output three-phase coordinate <code>b</code>
+   * @brief  16-point Q15 DCT-II.
+   * @param[in]  *pSrc points to the 16 input samples.
+   * @param[out] *pDst points to the 16 output coefficients.
    * @return none.
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the subtraction, hence there is no risk of overflow.
    */
 
-  inline static void riscv_inv_clarke_q31(
-  q31_t Ialpha,
-  q31_t Ibeta,
-  q31_t * pIa,
-  q31_t * pIb)
-  {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+  void riscv_dct2_16_q15(
+  const q15_t * pSrc,
+  q15_t * pDst);
 
-    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
-    *pIa = Ialpha;
+  /**
+   * @brief  32-point Q15 DCT-II.
+   * @param[in]  *pSrc points to the 32 input samples.
+   * @param[out] *pDst points to the 32 output coefficients.
+   * @return none.
+   */
 
-    /* Intermediate product is calculated by (1/(2*sqrt(3)) * Ia) */
-    product1 = (q31_t) (((q63_t) (Ialpha) * (0x40000000)) >> 31);
+  void riscv_dct2_32_q15(
+  const q15_t * pSrc,
+  q15_t * pDst);
 
-    /* Intermediate product is calculated by (1/sqrt(3) * pIb) */
-    product2 = (q31_t) (((q63_t) (Ibeta) * (0x6ED9EBA1)) >> 31);
+  /**
+   * @brief  8-point Q15 DCT-III, the inverse of riscv_dct2_8_q15().
+   * @param[in]  *pSrc points to the 8 input coefficients.
+   * @param[out] *pDst points to the 8 output samples.
+   * @return none.
+   */
 
-    /* pIb is calculated by subtracting the products */
-    *pIb = __SSAT(product2 - product1, 32);
-}
+  void riscv_dct3_8_q15(
+  const q15_t * pSrc,
+  q15_t * pDst);
 
   /**
-   * @brief  Converts the elements of the Q7 vector to Q15 vector.
-   * @param[in]  *pSrc     input pointer
-   * @param[out] *pDst     output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief  16-point Q15 DCT-III, the inverse of riscv_dct2_16_q15().
+   * @param[in]  *pSrc points to the 16 input coefficients.
+   * @param[out] *pDst points to the 16 output samples.
    * @return none.
    */
-  void riscv_q7_to_q15(
-  q7_t * pSrc,
-  q15_t * pDst,
-  uint32_t blockSize);
-
 
+  void riscv_dct3_16_q15(
+  const q15_t * pSrc,
+  q15_t * pDst);
 
   /**
-   * @ingroup groupController
+   * @brief  32-point Q15 DCT-III, the inverse of riscv_dct2_32_q15().
+   * @param[in]  *pSrc points to the 32 input coefficients.
+   * @param[out] *pDst points to the 32 output samples.
+   * @return none.
    */
 
-  /**
-   * @defgroup park Vector Park Transform
-   *
-   * Forward Park transform converts the input two-coordinate vector to flux and torque components.
-   * The Park transform can be used to realize the transformation of the <code>Ialpha</code> and the <code>Ibeta</code> currents
-   * from the stationary to the moving reference frame and control the spatial relationship between
-   * the stator vector current and rotor flux vector.
-   * If we consider the d axis aligned with the rotor flux, the diagram below shows the
-   * current vector and the relationship from the two reference frames:
-   * \image html park.gif "Stator current space vector and its component in (a,b) and in the d,q rotating reference frame"
-   *
-   * The function operates on a single sample of data and each call to the function returns the processed output.
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html parkFormula.gif
-   * where <code>Ialpha</code> and <code>Ibeta</code> are the stator vector components,
-   * <code>pId</code> and <code>pIq</code> are rotor vector components and <code>cosVal</code> and <code>sinVal</code> are the
-   * cosine and sine values of theta (rotor flux position).
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Park transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
-   */
+  void riscv_dct3_32_q15(
+  const q15_t * pSrc,
+  q15_t * pDst);
 
   /**
-   * @addtogroup park
-   * @{
+   * @brief Instance structure for the floating-point Goertzel detector.
    */
 
+  typedef struct
+  {
+    uint16_t numBins;                         /**< number of bins. */
+    const float32_t *pCoefs;                  /**< points to the coefficients 2*cos(2*pi*f), one per bin. */
+    float32_t *pState;                        /**< points to the states {s1, s2}, two per bin. */
+  } riscv_goertzel_instance_f32;
+
   /**
-   * @brief Floating-point Park transform
-   * @param[in]       Ialpha input two-phase vector coordinate alpha
-   * @param[in]       Ibeta  input two-phase vector coordinate beta
-   * @param[out]      *pId   points to output	rotor reference frame d
-   * @param[out]      *pIq   points to output	rotor reference frame q
-   * @param[in]       sinVal sine value of rotation angle theta
-   * @param[in]       cosVal cosine value of rotation angle theta
-   * @return none.
-   *
-   * The function implements the forward Park transform.
-   *
+   * @brief Instance structure for the Q31 Goertzel detector.
    */
 
-  static inline void riscv_park_f32(
-  float32_t Ialpha,
-  float32_t Ibeta,
-  float32_t * pId,
-  float32_t * pIq,
-  float32_t sinVal,
-  float32_t cosVal)
+  typedef struct
   {
-    /* Calculate pId using the equation, pId = Ialpha * cosVal + Ibeta * sinVal */
-    *pId = Ialpha * cosVal + Ibeta * sinVal;
-
-    /* Calculate pIq using the equation, pIq = - Ialpha * sinVal + Ibeta * cosVal */
-    *pIq = -Ialpha * sinVal + Ibeta * cosVal;
-
-  }
+    uint16_t numBins;                         /**< number of bins. */
+    uint8_t scaleShift;                       /**< right shift applied to the input samples. */
+    const q31_t *pCoefs;                      /**< points to the coefficients 2*cos(2*pi*f) in Q30, one per bin. */
+    q31_t *pState;                            /**< points to the states {s1, s2}, two per bin. */
+  } riscv_goertzel_instance_q31;
 
   /**
-   * @brief  Park transform for Q31 version
-   * @param[in]       Ialpha input two-phase vector coordinate alpha
-   * @param[in]       Ibeta  input two-phase vector coordinate beta
-   * @param[out]      *pId   points to output rotor reference frame d
-   * @param[out]      *pIq   points to output rotor reference frame q
-   * @param[in]       sinVal sine value of rotation angle theta
-   * @param[in]       cosVal cosine value of rotation angle theta
-   * @return none.
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the addition and subtraction, hence there is no risk of overflow.
+   * @brief Instance structure for the Q15 Goertzel detector.
    */
-  static inline void riscv_park_q31(
-  q31_t Ialpha,
-  q31_t Ibeta,
-  q31_t * pId,
-  q31_t * pIq,
-  q31_t sinVal,
-  q31_t cosVal)
-  {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
-    q31_t product3, product4;                    /* Temporary variables used to store intermediate results */
-
-    /* Intermediate product is calculated by (Ialpha * cosVal) */
-    product1 = (q31_t) (((q63_t) (Ialpha) * (cosVal)) >> 31);
-
-    /* Intermediate product is calculated by (Ibeta * sinVal) */
-    product2 = (q31_t) (((q63_t) (Ibeta) * (sinVal)) >> 31);
 
-    /* Intermediate product is calculated by (Ialpha * sinVal) */
-    product3 = (q31_t) (((q63_t) (Ialpha) * (sinVal)) >> 31);
-
-    /* Intermediate product is calculated by (Ibeta * cosVal) */
-    product4 = (q31_t) (((q63_t) (Ibeta) * (cosVal)) >> 31);
+  typedef struct
+  {
+    uint16_t numBins;                         /**< number of bins. */
+    uint8_t scaleShift;                       /**< right shift applied to the input samples after their conversion to Q31. */
+    const q31_t *pCoefs;                      /**< points to the coefficients 2*cos(2*pi*f) in Q30, one per bin. */
+    q31_t *pState;                            /**< points to the states {s1, s2}, two per bin. */
+  } riscv_goertzel_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel detector.
+   * @param[out]    *S        points to an instance of the floating-point Goertzel structure.
+   * @param[in]     numBins   number of bins.
+   * @param[in]     *pFreqs   points to the normalized frequencies f/fs of the bins, from 0 to 0.5.
+   * @param[out]    *pCoefs   points to a buffer of numBins coefficients.
+   * @param[out]    *pState   points to a buffer of 2*numBins states.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
+
+  riscv_status riscv_goertzel_init_f32(
+  riscv_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  const float32_t * pFreqs,
+  float32_t * pCoefs,
+  float32_t * pState);
 
-    /* Calculate pId by adding the two intermediate products 1 and 2 */
-    *pId = __SSAT(product1 + product2,32);
+  /**
+   * @brief  Initialization function for the Q31 Goertzel detector.
+   * @param[out]    *S          points to an instance of the Q31 Goertzel structure.
+   * @param[in]     numBins     number of bins.
+   * @param[in]     *pFreqs     points to the normalized frequencies f/fs of the bins, from 0 to 0.5.
+   * @param[in]     scaleShift  right shift applied to the input, from 0 to 31.
+   * @param[out]    *pCoefs     points to a buffer of numBins coefficients.
+   * @param[out]    *pState     points to a buffer of 2*numBins states.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
 
-    /* Calculate pIq by subtracting the two intermediate products 3 from 4 */
-    *pIq = __SSAT(product4 - product3,32);
-}
+  riscv_status riscv_goertzel_init_q31(
+  riscv_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  const float32_t * pFreqs,
+  uint8_t scaleShift,
+  q31_t * pCoefs,
+  q31_t * pState);
 
   /**
-   * @} end of park group
+   * @brief  Initialization function for the Q15 Goertzel detector.
+   * @param[out]    *S          points to an instance of the Q15 Goertzel structure.
+   * @param[in]     numBins     number of bins.
+   * @param[in]     *pFreqs     points to the normalized frequencies f/fs of the bins, from 0 to 0.5.
+   * @param[in]     scaleShift  right shift applied to the input after its conversion to Q31, from 0 to 31.
+   * @param[out]    *pCoefs     points to a buffer of numBins coefficients.
+   * @param[out]    *pState     points to a buffer of 2*numBins states.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
    */
 
+  riscv_status riscv_goertzel_init_q15(
+  riscv_goertzel_instance_q15 * S,
+  uint16_t numBins,
+  const float32_t * pFreqs,
+  uint8_t scaleShift,
+  q31_t * pCoefs,
+  q31_t * pState);
+
   /**
-   * @brief  Converts the elements of the Q7 vector to floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[out]  *pDst is output pointer
-   * @param[in]  blockSize is the number of samples to process
+   * @brief  Runs the floating-point Goertzel recursion over a block of samples.
+   * @param[in]     *S         points to an instance of the floating-point Goertzel structure.
+   * @param[in]     *pSrc      points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
    * @return none.
    */
-  void riscv_q7_to_float(
-  q7_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
 
+  void riscv_goertzel_f32(
+  const riscv_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize);
 
   /**
-   * @ingroup groupController
+   * @brief  Runs the Q31 Goertzel recursion over a block of samples.
+   * @param[in]     *S         points to an instance of the Q31 Goertzel structure.
+   * @param[in]     *pSrc      points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
    */
 
-  /**
-   * @defgroup inv_park Vector Inverse Park transform
-   * Inverse Park transform converts the input flux and torque components to two-coordinate vector.
-   *
-   * The function operates on a single sample of data and each call to the function returns the processed output.
-   * The library provides separate functions for Q31 and floating-point data types.
-   * \par Algorithm
-   * \image html parkInvFormula.gif
-   * where <code>pIalpha</code> and <code>pIbeta</code> are the stator vector components,
-   * <code>Id</code> and <code>Iq</code> are rotor vector components and <code>cosVal</code> and <code>sinVal</code> are the
-   * cosine and sine values of theta (rotor flux position).
-   * \par Fixed-Point Behavior
-   * Care must be taken when using the Q31 version of the Park transform.
-   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
-   * Refer to the function specific documentation below for usage guidelines.
-   */
+  void riscv_goertzel_q31(
+  const riscv_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t blockSize);
 
   /**
-   * @addtogroup inv_park
-   * @{
+   * @brief  Runs the Q15 Goertzel recursion over a block of samples.
+   * @param[in]     *S         points to an instance of the Q15 Goertzel structure.
+   * @param[in]     *pSrc      points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
    */
 
-   /**
-   * @brief  Floating-point Inverse Park transform
-   * @param[in]       Id        input coordinate of rotor reference frame d
-   * @param[in]       Iq        input coordinate of rotor reference frame q
-   * @param[out]      *pIalpha  points to output two-phase orthogonal vector axis alpha
-   * @param[out]      *pIbeta   points to output two-phase orthogonal vector axis beta
-   * @param[in]       sinVal    sine value of rotation angle theta
-   * @param[in]       cosVal    cosine value of rotation angle theta
+  void riscv_goertzel_q15(
+  const riscv_goertzel_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Returns the power of the floating-point Goertzel bins and clears the states.
+   * @param[in]     *S     points to an instance of the floating-point Goertzel structure.
+   * @param[out]    *pDst  points to the numBins output powers.
    * @return none.
    */
 
-  inline void riscv_inv_park_f32(
-  float32_t Id,
-  float32_t Iq,
-  float32_t * pIalpha,
-  float32_t * pIbeta,
-  float32_t sinVal,
-  float32_t cosVal)
-  {
-    /* Calculate pIalpha using the equation, pIalpha = Id * cosVal - Iq * sinVal */
-    *pIalpha = Id * cosVal - Iq * sinVal;
-
-    /* Calculate pIbeta using the equation, pIbeta = Id * sinVal + Iq * cosVal */
-    *pIbeta = Id * sinVal + Iq * cosVal;
+  void riscv_goertzel_power_f32(
+  const riscv_goertzel_instance_f32 * S,
+  float32_t * pDst);
 
-  }
+  /**
+   * @brief  Returns the power of the Q31 Goertzel bins and clears the states.
+   * @param[in]     *S     points to an instance of the Q31 Goertzel structure.
+   * @param[out]    *pDst  points to the numBins output powers.
+   * @return none.
+   */
 
+  void riscv_goertzel_power_q31(
+  const riscv_goertzel_instance_q31 * S,
+  q31_t * pDst);
 
   /**
-   * @brief  Inverse Park transform for	Q31 version
-   * @param[in]       Id        input coordinate of rotor reference frame d
-   * @param[in]       Iq        input coordinate of rotor reference frame q
-   * @param[out]      *pIalpha  points to output two-phase orthogonal vector axis alpha
-   * @param[out]      *pIbeta   points to output two-phase orthogonal vector axis beta
-   * @param[in]       sinVal    sine value of rotation angle theta
-   * @param[in]       cosVal    cosine value of rotation angle theta
+   * @brief  Returns the power of the Q15 Goertzel bins and clears the states.
+   * @param[in]     *S     points to an instance of the Q15 Goertzel structure.
+   * @param[out]    *pDst  points to the numBins output powers in Q31.
    * @return none.
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 32-bit accumulator.
-   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
-   * There is saturation on the addition, hence there is no risk of overflow.
    */
-  inline static void riscv_inv_park_q31(
-  q31_t Id,
-  q31_t Iq,
-  q31_t * pIalpha,
-  q31_t * pIbeta,
-  q31_t sinVal,
-  q31_t cosVal)
-  {
-    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
-    q31_t product3, product4;                    /* Temporary variables used to store intermediate results */
-
-    /* Intermediate product is calculated by (Id * cosVal) */
-    product1 = (q31_t) (((q63_t) (Id) * (cosVal)) >> 31);
 
-    /* Intermediate product is calculated by (Iq * sinVal) */
-    product2 = (q31_t) (((q63_t) (Iq) * (sinVal)) >> 31);
+  void riscv_goertzel_power_q15(
+  const riscv_goertzel_instance_q15 * S,
+  q31_t * pDst);
 
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
 
-    /* Intermediate product is calculated by (Id * sinVal) */
-    product3 = (q31_t) (((q63_t) (Id) * (sinVal)) >> 31);
+  typedef struct
+  {
+    uint16_t fftLen;                          /**< length of the window. */
+    uint16_t numBins;                         /**< number of bins. */
+    uint16_t delayIndex;                      /**< position of the oldest sample in the delay line. */
+    const uint16_t *pBins;                    /**< points to the bin indexes. */
+    const float32_t *pTwiddle;                /**< points to the twiddle factors {cos, sin} of fftLen angles. */
+    float32_t *pState;                        /**< points to the accumulators {real, imag}, two per bin. */
+    float32_t *pDelay;                        /**< points to the delay line of length fftLen. */
+  } riscv_sdft_instance_f32;
 
-    /* Intermediate product is calculated by (Iq * cosVal) */
-    product4 = (q31_t) (((q63_t) (Iq) * (cosVal)) >> 31);
+  /**
+   * @brief Instance structure for the Q15 sliding DFT.
+   */
 
-    /* Calculate pIalpha by using the two intermediate products 1 and 2 */
-    *pIalpha = __SSAT(product1 - product2,32);
+  typedef struct
+  {
+    uint16_t fftLen;                          /**< length of the window. */
+    uint16_t numBins;                         /**< number of bins. */
+    uint16_t delayIndex;                      /**< position of the oldest sample in the delay line. */
+    uint8_t shift;                            /**< log2(fftLen), the right shift applied to the input samples. */
+    const uint16_t *pBins;                    /**< points to the bin indexes. */
+    const q15_t *pTwiddle;                    /**< points to the twiddle factors {cos, sin} of fftLen angles. */
+    q31_t *pState;                            /**< points to the accumulators {real, imag} in Q31, two per bin. */
+    q15_t *pDelay;                            /**< points to the delay line of length fftLen. */
+  } riscv_sdft_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding DFT.
+   * @param[out]    *S         points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     fftLen     length of the window.
+   * @param[in]     numBins    number of bins.
+   * @param[in]     *pBins     points to the bin indexes.
+   * @param[out]    *pTwiddle  points to a buffer of 2*fftLen twiddle factors.
+   * @param[out]    *pState    points to a buffer of 2*numBins accumulators.
+   * @param[out]    *pDelay    points to a buffer of fftLen values for the delay line.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
+
+  riscv_status riscv_sdft_init_f32(
+  riscv_sdft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  float32_t * pTwiddle,
+  float32_t * pState,
+  float32_t * pDelay);
 
-    /* Calculate pIbeta by using the two intermediate products 3 and 4 */
-    *pIbeta = __SSAT(product4 + product3,32 );
-}
+  /**
+   * @brief  Initialization function for the Q15 sliding DFT.
+   * @param[out]    *S         points to an instance of the Q15 sliding DFT structure.
+   * @param[in]     fftLen     length of the window, a power of two from 16 to 4096.
+   * @param[in]     numBins    number of bins.
+   * @param[in]     *pBins     points to the bin indexes.
+   * @param[out]    *pTwiddle  points to a buffer of 2*fftLen twiddle factors.
+   * @param[out]    *pState    points to a buffer of 2*numBins accumulators.
+   * @param[out]    *pDelay    points to a buffer of fftLen values for the delay line.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
 
+  riscv_status riscv_sdft_init_q15(
+  riscv_sdft_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  q15_t * pTwiddle,
+  q31_t * pState,
+  q15_t * pDelay);
 
   /**
-   * @} end of Inverse park group
+   * @brief  Processing function for the floating-point sliding DFT.
+   * @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     *pSrc      points to the block of input samples.
+   * @param[out]    *pDst      points to the 2*numBins output values.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
    */
 
+  void riscv_sdft_f32(
+  riscv_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
 
   /**
-   * @brief  Converts the elements of the Q31 vector to floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[out]  *pDst is output pointer
-   * @param[in]  blockSize is the number of samples to process
+   * @brief  Processing function for the Q15 sliding DFT.
+   * @param[in,out] *S         points to an instance of the Q15 sliding DFT structure.
+   * @param[in]     *pSrc      points to the block of input samples.
+   * @param[out]    *pDst      points to the 2*numBins output values.
+   * @param[in]     blockSize  number of samples to process.
    * @return none.
    */
-  void riscv_q31_to_float(
-  q31_t * pSrc,
-  float32_t * pDst,
+
+  void riscv_sdft_q15(
+  riscv_sdft_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
   uint32_t blockSize);
 
   /**
-   * @ingroup groupInterpolation
+   * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
 
+  typedef struct
+  {
+    uint16_t N;                         /**< length of the DCT4. */
+    uint16_t Nby2;                      /**< half of the length of the DCT4. */
+    float32_t normalize;                /**< normalizing factor. */
+    float32_t *pTwiddle;                /**< points to the twiddle factor table. */
+    float32_t *pCosFactor;              /**< points to the cosFactor table. */
+    riscv_rfft_instance_f32 *pRfft;        /**< points to the real FFT instance. */
+    riscv_cfft_radix4_instance_f32 *pCfft; /**< points to the complex FFT instance. */
+  } riscv_dct4_instance_f32;
+
   /**
-   * @defgroup LinearInterpolate Linear Interpolation
-   *
-   * Linear interpolation is a method of curve fitting using linear polynomials.
-   * Linear interpolation works by effectively drawing a straight line between two neighboring samples and returning the appropriate point along that line
-   *
-   * \par
-   * \image html LinearInterp.gif "Linear interpolation"
-   *
-   * \par
-   * A  Linear Interpolate function calculates an output value(y), for the input(x)
-   * using linear interpolation of the input values x0, x1( nearest input values) and the output values y0 and y1(nearest output values)
+   * @brief  Initialization function for the floating-point DCT4/IDCT4.
+   * @param[in,out] *S         points to an instance of floating-point DCT4/IDCT4 structure.
+   * @param[in]     *S_RFFT    points to an instance of floating-point RFFT/RIFFT structure.
+   * @param[in]     *S_CFFT    points to an instance of floating-point CFFT/CIFFT structure.
+   * @param[in]     N          length of the DCT4.
+   * @param[in]     Nby2       half of the length of the DCT4.
+   * @param[in]     normalize  normalizing factor.
+   * @return		riscv_status function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>fftLenReal</code> is not a supported transform length.
+   */
+
+  riscv_status riscv_dct4_init_f32(
+  riscv_dct4_instance_f32 * S,
+  riscv_rfft_instance_f32 * S_RFFT,
+  riscv_cfft_radix4_instance_f32 * S_CFFT,
+  uint16_t N,
+  uint16_t Nby2,
+  float32_t normalize);
+
+  /**
+   * @brief Processing function for the floating-point DCT4/IDCT4.
+   * @param[in]       *S             points to an instance of the floating-point DCT4/IDCT4 structure.
+   * @param[in]       *pState        points to state buffer.
+   * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.
+   * @return none.
+   */
+
+  void riscv_dct4_f32(
+  const riscv_dct4_instance_f32 * S,
+  float32_t * pState,
+  float32_t * pInlineBuffer);
+
+  /**
+   * @brief Instance structure for the Q31 DCT4/IDCT4 function.
+   */
+
+  typedef struct
+  {
+    uint16_t N;                         /**< length of the DCT4. */
+    uint16_t Nby2;                      /**< half of the length of the DCT4. */
+    q31_t normalize;                    /**< normalizing factor. */
+    q31_t *pTwiddle;                    /**< points to the twiddle factor table. */
+    q31_t *pCosFactor;                  /**< points to the cosFactor table. */
+    riscv_rfft_instance_q31 *pRfft;        /**< points to the real FFT instance. */
+    riscv_cfft_radix4_instance_q31 *pCfft; /**< points to the complex FFT instance. */
+  } riscv_dct4_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 DCT4/IDCT4.
+   * @param[in,out] *S         points to an instance of Q31 DCT4/IDCT4 structure.
+   * @param[in]     *S_RFFT    points to an instance of Q31 RFFT/RIFFT structure
+   * @param[in]     *S_CFFT    points to an instance of Q31 CFFT/CIFFT structure
+   * @param[in]     N          length of the DCT4.
+   * @param[in]     Nby2       half of the length of the DCT4.
+   * @param[in]     normalize  normalizing factor.
+   * @return		riscv_status function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported transform length.
+   */
+
+  riscv_status riscv_dct4_init_q31(
+  riscv_dct4_instance_q31 * S,
+  riscv_rfft_instance_q31 * S_RFFT,
+  riscv_cfft_radix4_instance_q31 * S_CFFT,
+  uint16_t N,
+  uint16_t Nby2,
+  q31_t normalize);
+
+  /**
+   * @brief Processing function for the Q31 DCT4/IDCT4.
+   * @param[in]       *S             points to an instance of the Q31 DCT4 structure.
+   * @param[in]       *pState        points to state buffer.
+   * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.
+   * @return none.
+   */
+
+  void riscv_dct4_q31(
+  const riscv_dct4_instance_q31 * S,
+  q31_t * pState,
+  q31_t * pInlineBuffer);
+
+  /**
+   * @brief Instance structure for the Q15 DCT4/IDCT4 function.
+   */
+
+  typedef struct
+  {
+    uint16_t N;                         /**< length of the DCT4. */
+    uint16_t Nby2;                      /**< half of the length of the DCT4. */
+    q15_t normalize;                    /**< normalizing factor. */
+    q15_t *pTwiddle;                    /**< points to the twiddle factor table. */
+    q15_t *pCosFactor;                  /**< points to the cosFactor table. */
+    riscv_rfft_instance_q15 *pRfft;        /**< points to the real FFT instance. */
+    riscv_cfft_radix4_instance_q15 *pCfft; /**< points to the complex FFT instance. */
+  } riscv_dct4_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 DCT4/IDCT4.
+   * @param[in,out] *S         points to an instance of Q15 DCT4/IDCT4 structure.
+   * @param[in]     *S_RFFT    points to an instance of Q15 RFFT/RIFFT structure.
+   * @param[in]     *S_CFFT    points to an instance of Q15 CFFT/CIFFT structure.
+   * @param[in]     N          length of the DCT4.
+   * @param[in]     Nby2       half of the length of the DCT4.
+   * @param[in]     normalize  normalizing factor.
+   * @return		riscv_status function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported transform length.
+   */
+
+  riscv_status riscv_dct4_init_q15(
+  riscv_dct4_instance_q15 * S,
+  riscv_rfft_instance_q15 * S_RFFT,
+  riscv_cfft_radix4_instance_q15 * S_CFFT,
+  uint16_t N,
+  uint16_t Nby2,
+  q15_t normalize);
+
+  /**
+   * @brief Processing function for the Q15 DCT4/IDCT4.
+   * @param[in]       *S             points to an instance of the Q15 DCT4 structure.
+   * @param[in]       *pState        points to state buffer.
+   * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.
+   * @return none.
+   */
+
+  void riscv_dct4_q15(
+  const riscv_dct4_instance_q15 * S,
+  q15_t * pState,
+  q15_t * pInlineBuffer);
+
+  /**
+   * @brief Floating-point vector addition.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_add_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q7 vector addition.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_add_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q15 vector addition.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_add_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q31 vector addition.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_add_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Floating-point vector subtraction.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_sub_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q7 vector subtraction.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_sub_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q15 vector subtraction.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_sub_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q31 vector subtraction.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_sub_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Multiplies a floating-point vector by a scalar.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       scale scale factor to be applied
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_scale_f32(
+  float32_t * pSrc,
+  float32_t scale,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Multiplies a Q7 vector by a scalar.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       scaleFract fractional portion of the scale value
+   * @param[in]       shift number of bits to shift the result by
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_scale_q7(
+  q7_t * pSrc,
+  q7_t scaleFract,
+  int8_t shift,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Multiplies a Q15 vector by a scalar.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       scaleFract fractional portion of the scale value
+   * @param[in]       shift number of bits to shift the result by
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_scale_q15(
+  q15_t * pSrc,
+  q15_t scaleFract,
+  int8_t shift,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Multiplies a Q31 vector by a scalar.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       scaleFract fractional portion of the scale value
+   * @param[in]       shift number of bits to shift the result by
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_scale_q31(
+  q31_t * pSrc,
+  q31_t scaleFract,
+  int8_t shift,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Floating-point vector multiply-add.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       *pSrcC points to the vector that is added to the product
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_vmac_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pSrcC,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q7 vector multiply-add.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       *pSrcC points to the vector that is added to the product
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_vmac_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pSrcC,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q15 vector multiply-add.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       *pSrcC points to the vector that is added to the product
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_vmac_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pSrcC,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q31 vector multiply-add.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       *pSrcC points to the vector that is added to the product
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_vmac_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pSrcC,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Adds a scaled floating-point vector to a second vector.
+   * @param[in]       *pSrcX points to the vector that is scaled
+   * @param[in]       scale scale factor to be applied
+   * @param[in]       *pSrcY points to the vector that is added
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_axpy_f32(
+  float32_t * pSrcX,
+  float32_t scale,
+  float32_t * pSrcY,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Adds a scaled Q7 vector to a second vector.
+   * @param[in]       *pSrcX points to the vector that is scaled
+   * @param[in]       scaleFract fractional portion of the scale value
+   * @param[in]       shift number of bits to shift the product by
+   * @param[in]       *pSrcY points to the vector that is added
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_axpy_q7(
+  q7_t * pSrcX,
+  q7_t scaleFract,
+  int8_t shift,
+  q7_t * pSrcY,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Adds a scaled Q15 vector to a second vector.
+   * @param[in]       *pSrcX points to the vector that is scaled
+   * @param[in]       scaleFract fractional portion of the scale value
+   * @param[in]       shift number of bits to shift the product by
+   * @param[in]       *pSrcY points to the vector that is added
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_axpy_q15(
+  q15_t * pSrcX,
+  q15_t scaleFract,
+  int8_t shift,
+  q15_t * pSrcY,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Adds a scaled Q31 vector to a second vector.
+   * @param[in]       *pSrcX points to the vector that is scaled
+   * @param[in]       scaleFract fractional portion of the scale value
+   * @param[in]       shift number of bits to shift the product by
+   * @param[in]       *pSrcY points to the vector that is added
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_axpy_q31(
+  q31_t * pSrcX,
+  q31_t scaleFract,
+  int8_t shift,
+  q31_t * pSrcY,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Clamps a floating-point vector to a range.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       low lower bound
+   * @param[in]       high upper bound
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_clip_f32(
+  float32_t * pSrc,
+  float32_t low,
+  float32_t high,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Clamps a Q7 vector to a range.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       low lower bound
+   * @param[in]       high upper bound
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_clip_q7(
+  q7_t * pSrc,
+  q7_t low,
+  q7_t high,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Clamps a Q15 vector to a range.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       low lower bound
+   * @param[in]       high upper bound
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_clip_q15(
+  q15_t * pSrc,
+  q15_t low,
+  q15_t high,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Clamps a Q31 vector to a range.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       low lower bound
+   * @param[in]       high upper bound
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_clip_q31(
+  q31_t * pSrc,
+  q31_t low,
+  q31_t high,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Floating-point vector threshold, elements not above threshold are replaced by fill.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       threshold elements greater than threshold are kept
+   * @param[in]       fill value of the other elements
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_threshold_f32(
+  float32_t * pSrc,
+  float32_t threshold,
+  float32_t fill,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q7 vector threshold, elements not above threshold are replaced by fill.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       threshold elements greater than threshold are kept
+   * @param[in]       fill value of the other elements
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_threshold_q7(
+  q7_t * pSrc,
+  q7_t threshold,
+  q7_t fill,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q15 vector threshold, elements not above threshold are replaced by fill.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       threshold elements greater than threshold are kept
+   * @param[in]       fill value of the other elements
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_threshold_q15(
+  q15_t * pSrc,
+  q15_t threshold,
+  q15_t fill,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q31 vector threshold, elements not above threshold are replaced by fill.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       threshold elements greater than threshold are kept
+   * @param[in]       fill value of the other elements
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_threshold_q31(
+  q31_t * pSrc,
+  q31_t threshold,
+  q31_t fill,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Packed bit mask of the floating-point elements in a range.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       low lower bound of the range
+   * @param[in]       high upper bound of the range
+   * @param[out]      *pMask points to the (blockSize + 31) / 32 words of the mask, bit n%32 of word n/32 for element n
+   * @param[in]       blockSize number of samples in the vector
+   * @return the number of elements in the range.
+   */
+
+  uint32_t riscv_cmp_range_mask_f32(
+  float32_t * pSrc,
+  float32_t low,
+  float32_t high,
+  uint32_t * pMask,
+  uint32_t blockSize);
+
+  /**
+   * @brief Packed bit mask of the Q7 elements in a range.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       low lower bound of the range
+   * @param[in]       high upper bound of the range
+   * @param[out]      *pMask points to the (blockSize + 31) / 32 words of the mask, bit n%32 of word n/32 for element n
+   * @param[in]       blockSize number of samples in the vector
+   * @return the number of elements in the range.
+   */
+
+  uint32_t riscv_cmp_range_mask_q7(
+  q7_t * pSrc,
+  q7_t low,
+  q7_t high,
+  uint32_t * pMask,
+  uint32_t blockSize);
+
+  /**
+   * @brief Packed bit mask of the Q15 elements in a range.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       low lower bound of the range
+   * @param[in]       high upper bound of the range
+   * @param[out]      *pMask points to the (blockSize + 31) / 32 words of the mask, bit n%32 of word n/32 for element n
+   * @param[in]       blockSize number of samples in the vector
+   * @return the number of elements in the range.
+   */
+
+  uint32_t riscv_cmp_range_mask_q15(
+  q15_t * pSrc,
+  q15_t low,
+  q15_t high,
+  uint32_t * pMask,
+  uint32_t blockSize);
+
+  /**
+   * @brief Packed bit mask of the Q31 elements in a range.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       low lower bound of the range
+   * @param[in]       high upper bound of the range
+   * @param[out]      *pMask points to the (blockSize + 31) / 32 words of the mask, bit n%32 of word n/32 for element n
+   * @param[in]       blockSize number of samples in the vector
+   * @return the number of elements in the range.
+   */
+
+  uint32_t riscv_cmp_range_mask_q31(
+  q31_t * pSrc,
+  q31_t low,
+  q31_t high,
+  uint32_t * pMask,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q7 vector absolute value.
+   * @param[in]       *pSrc points to the input buffer
+   * @param[out]      *pDst points to the output buffer
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_abs_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Floating-point vector absolute value.
+   * @param[in]       *pSrc points to the input buffer
+   * @param[out]      *pDst points to the output buffer
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_abs_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q15 vector absolute value.
+   * @param[in]       *pSrc points to the input buffer
+   * @param[out]      *pDst points to the output buffer
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_abs_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Q31 vector absolute value.
+   * @param[in]       *pSrc points to the input buffer
+   * @param[out]      *pDst points to the output buffer
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_abs_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Dot product of floating-point vectors.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *result output result returned here
+   * @return none.
+   */
+
+  void riscv_dot_prod_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * result);
+
+  /**
+   * @brief Dot product of double-precision floating-point vectors.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *result output result returned here
+   * @return none.
+   */
+
+  void riscv_dot_prod_f64(
+  const float64_t * pSrcA,
+  const float64_t * pSrcB,
+  uint32_t blockSize,
+  float64_t * result);
+
+  /**
+   * @brief Dot product of Q7 vectors.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *result output result returned here
+   * @return none.
+   */
+
+  void riscv_dot_prod_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  uint32_t blockSize,
+  q31_t * result);
+
+  /**
+   * @brief Dot product of Q15 vectors.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *result output result returned here
+   * @return none.
+   */
+
+  void riscv_dot_prod_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  uint32_t blockSize,
+  q63_t * result);
+
+  /**
+   * @brief Dot product of Q31 vectors.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *result output result returned here
+   * @return none.
+   */
+
+  void riscv_dot_prod_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  uint32_t blockSize,
+  q63_t * result);
+
+  /**
+   * @brief  Shifts the elements of a Q7 vector a specified number of bits.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  shiftBits number of bits to shift.  A positive value shifts left; a negative value shifts right.
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_shift_q7(
+  q7_t * pSrc,
+  int8_t shiftBits,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Shifts the elements of a Q15 vector a specified number of bits.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  shiftBits number of bits to shift.  A positive value shifts left; a negative value shifts right.
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_shift_q15(
+  q15_t * pSrc,
+  int8_t shiftBits,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Shifts the elements of a Q31 vector a specified number of bits.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  shiftBits number of bits to shift.  A positive value shifts left; a negative value shifts right.
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_shift_q31(
+  q31_t * pSrc,
+  int8_t shiftBits,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Adds a constant offset to a floating-point vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  offset is the offset to be added
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_offset_f32(
+  float32_t * pSrc,
+  float32_t offset,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Adds a constant offset to a Q7 vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  offset is the offset to be added
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_offset_q7(
+  q7_t * pSrc,
+  q7_t offset,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Adds a constant offset to a Q15 vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  offset is the offset to be added
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_offset_q15(
+  q15_t * pSrc,
+  q15_t offset,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Adds a constant offset to a Q31 vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  offset is the offset to be added
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_offset_q31(
+  q31_t * pSrc,
+  q31_t offset,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Negates the elements of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_negate_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Negates the elements of a Q7 vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_negate_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Negates the elements of a Q15 vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_negate_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Negates the elements of a Q31 vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
+
+  void riscv_negate_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+  /**
+   * @brief  Copies the elements of a floating-point vector.
+   * @param[in]  *pSrc input pointer
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void riscv_copy_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Copies the elements of a Q7 vector.
+   * @param[in]  *pSrc input pointer
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void riscv_copy_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Splits interleaved floating-point frames into one block per channel.
+   * @param[in]       *pSrc points to <code>blockSize*numChannels</code> interleaved samples
+   * @param[in]       numChannels number of channels of a frame
+   * @param[out]      *pDst points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+   * @param[in]       blockSize number of frames
+   * @return none.
+   */
+
+  void riscv_deinterleave_f32(
+  float32_t * pSrc,
+  uint16_t numChannels,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Merges one floating-point block per channel into interleaved frames.
+   * @param[in]       *pSrc points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+   * @param[in]       numChannels number of channels of a frame
+   * @param[out]      *pDst points to <code>blockSize*numChannels</code> interleaved samples
+   * @param[in]       blockSize number of frames
+   * @return none.
+   */
+
+  void riscv_interleave_f32(
+  float32_t * pSrc,
+  uint16_t numChannels,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Splits interleaved Q31 frames into one block per channel.
+   * @param[in]       *pSrc points to <code>blockSize*numChannels</code> interleaved samples
+   * @param[in]       numChannels number of channels of a frame
+   * @param[out]      *pDst points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+   * @param[in]       blockSize number of frames
+   * @return none.
+   */
+
+  void riscv_deinterleave_q31(
+  q31_t * pSrc,
+  uint16_t numChannels,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Merges one Q31 block per channel into interleaved frames.
+   * @param[in]       *pSrc points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+   * @param[in]       numChannels number of channels of a frame
+   * @param[out]      *pDst points to <code>blockSize*numChannels</code> interleaved samples
+   * @param[in]       blockSize number of frames
+   * @return none.
+   */
+
+  void riscv_interleave_q31(
+  q31_t * pSrc,
+  uint16_t numChannels,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Splits interleaved Q15 frames into one block per channel.
+   * @param[in]       *pSrc points to <code>blockSize*numChannels</code> interleaved samples
+   * @param[in]       numChannels number of channels of a frame
+   * @param[out]      *pDst points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+   * @param[in]       blockSize number of frames
+   * @return none.
+   */
+
+  void riscv_deinterleave_q15(
+  q15_t * pSrc,
+  uint16_t numChannels,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Merges one Q15 block per channel into interleaved frames.
+   * @param[in]       *pSrc points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+   * @param[in]       numChannels number of channels of a frame
+   * @param[out]      *pDst points to <code>blockSize*numChannels</code> interleaved samples
+   * @param[in]       blockSize number of frames
+   * @return none.
+   */
+
+  void riscv_interleave_q15(
+  q15_t * pSrc,
+  uint16_t numChannels,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Splits interleaved Q7 frames into one block per channel.
+   * @param[in]       *pSrc points to <code>blockSize*numChannels</code> interleaved samples
+   * @param[in]       numChannels number of channels of a frame
+   * @param[out]      *pDst points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+   * @param[in]       blockSize number of frames
+   * @return none.
+   */
+
+  void riscv_deinterleave_q7(
+  q7_t * pSrc,
+  uint16_t numChannels,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Merges one Q7 block per channel into interleaved frames.
+   * @param[in]       *pSrc points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+   * @param[in]       numChannels number of channels of a frame
+   * @param[out]      *pDst points to <code>blockSize*numChannels</code> interleaved samples
+   * @param[in]       blockSize number of frames
+   * @return none.
+   */
+
+  void riscv_interleave_q7(
+  q7_t * pSrc,
+  uint16_t numChannels,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Normalizes a Q15 block floating-point vector.
+   * @param[in,out]   *pBlock points to the block, the mantissas are shifted in place and the exponent is updated
+   * @return none.
+   */
+
+  void riscv_bfp_normalize_q15(
+  riscv_bfp_q15 * pBlock);
+
+  /**
+   * @brief Normalizes a Q31 block floating-point vector.
+   * @param[in,out]   *pBlock points to the block, the mantissas are shifted in place and the exponent is updated
+   * @return none.
+   */
+
+  void riscv_bfp_normalize_q31(
+  riscv_bfp_q31 * pBlock);
+
+  /**
+   * @brief Converts a Q15 block floating-point vector to Q15 values.
+   * @param[in]       *pBlock points to the block
+   * @param[out]      *pDst points to the Q15 output vector of <code>pBlock->blockSize</code> values
+   * @return none.
+   */
+
+  void riscv_bfp_denormalize_q15(
+  const riscv_bfp_q15 * pBlock,
+  q15_t * pDst);
+
+  /**
+   * @brief Converts a Q31 block floating-point vector to Q31 values.
+   * @param[in]       *pBlock points to the block
+   * @param[out]      *pDst points to the Q31 output vector of <code>pBlock->blockSize</code> values
+   * @return none.
+   */
+
+  void riscv_bfp_denormalize_q31(
+  const riscv_bfp_q31 * pBlock,
+  q31_t * pDst);
+
+  /**
+   * @brief Sort order of the riscv_sort_*() functions.
+   */
+
+  typedef enum
+  {
+    RISCV_SORT_ASCENDING = 0,            /**< Smallest sample first */
+    RISCV_SORT_DESCENDING = 1            /**< Largest sample first */
+  } riscv_sort_dir;
+
+  /**
+   * @brief Block length up to which the sort functions use an insertion sort.
+   */
+
+#ifndef RISCV_SORT_INSERTION_LENGTH
+#define RISCV_SORT_INSERTION_LENGTH 16
+#endif
+
+  /**
+   * @brief Sorts a floating-point vector.
+   * @param[in]       *pSrc points to the input vector
+   * @param[out]      *pDst points to the sorted output vector, may be equal to <code>pSrc</code>
+   * @param[out]      *pIndex points to the positions in <code>pSrc</code> of the output samples, or NULL
+   * @param[in]       blockSize length of the input vector
+   * @param[in]       dir RISCV_SORT_ASCENDING or RISCV_SORT_DESCENDING
+   * @return none.
+   */
+
+  void riscv_sort_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint16_t * pIndex,
+  uint32_t blockSize,
+  riscv_sort_dir dir);
+
+  /**
+   * @brief Sorts a Q15 vector.
+   * @param[in]       *pSrc points to the input vector
+   * @param[out]      *pDst points to the sorted output vector
+   * @param[out]      *pIndex points to the positions in <code>pSrc</code> of the output samples, or NULL
+   * @param[in]       *pScratch points to a buffer of <code>blockSize</code> words
+   * @param[in]       blockSize length of the input vector
+   * @param[in]       dir RISCV_SORT_ASCENDING or RISCV_SORT_DESCENDING
+   * @return none.
+   */
+
+  void riscv_sort_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint16_t * pIndex,
+  uint32_t * pScratch,
+  uint32_t blockSize,
+  riscv_sort_dir dir);
+
+  /**
+   * @brief Sorts a Q7 vector.
+   * @param[in]       *pSrc points to the input vector
+   * @param[out]      *pDst points to the sorted output vector
+   * @param[out]      *pIndex points to the positions in <code>pSrc</code> of the output samples, or NULL
+   * @param[in]       blockSize length of the input vector
+   * @param[in]       dir RISCV_SORT_ASCENDING or RISCV_SORT_DESCENDING
+   * @return none.
+   */
+
+  void riscv_sort_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint16_t * pIndex,
+  uint32_t blockSize,
+  riscv_sort_dir dir);
+
+  /**
+   * @brief Largest k samples of a floating-point vector.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       blockSize length of the input vector
+   * @param[in]       k number of samples to return
+   * @param[out]      *pDst points to the <code>k</code> largest samples, in descending order
+   * @param[out]      *pIndex points to the positions in <code>pSrc</code> of the output samples, or NULL
+   * @return none.
+   */
+
+  void riscv_topk_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pDst,
+  uint16_t * pIndex);
+
+  /**
+   * @brief Largest k samples of a Q15 vector.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       blockSize length of the input vector
+   * @param[in]       k number of samples to return
+   * @param[out]      *pDst points to the <code>k</code> largest samples, in descending order
+   * @param[out]      *pIndex points to the positions in <code>pSrc</code> of the output samples, or NULL
+   * @return none.
+   */
+
+  void riscv_topk_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pDst,
+  uint16_t * pIndex);
+
+  /**
+   * @brief Smallest and largest constraint length of the Viterbi decoders.
+   */
+
+#define RISCV_VITERBI_MIN_K 4u
+#define RISCV_VITERBI_MAX_K 7u
+
+  /**
+   * @brief Number of states of the Viterbi decoders for the largest constraint length.
+   */
+
+#define RISCV_VITERBI_MAX_STATES (1u << (RISCV_VITERBI_MAX_K - 1u))
+
+  /**
+   * @brief Words of survivor bits a Viterbi decoder of constraint length K writes per step.
+   */
+
+#define RISCV_VITERBI_DECISION_WORDS(K) (((1u << ((K) - 1u)) + 31u) >> 5u)
+
+  /**
+   * @brief Instance structure of the Q7 Viterbi decoder.
+   */
+
+  typedef struct
+  {
+    uint8_t constraintLen;      /**< constraint length K of the code. */
+    uint16_t numStates;         /**< number of states, 2^(K-1). */
+    uint32_t branch[RISCV_VITERBI_MAX_STATES / 8u]; /**< 8-bit branch metric index of each butterfly. */
+    q7_t *pMetrics;             /**< points to two buffers of numStates path metrics. */
+    uint32_t *pDecisions;       /**< points to the survivor bits, RISCV_VITERBI_DECISION_WORDS(K) words per step. */
+    uint32_t maxSteps;          /**< number of steps the survivor bits buffer holds. */
+    uint32_t numSteps;          /**< number of steps since the initialization. */
+  } riscv_viterbi_instance_q7;
+
+  /**
+   * @brief Instance structure of the Q15 Viterbi decoder.
+   */
+
+  typedef struct
+  {
+    uint8_t constraintLen;      /**< constraint length K of the code. */
+    uint16_t numStates;         /**< number of states, 2^(K-1). */
+    uint32_t branch[RISCV_VITERBI_MAX_STATES / 4u]; /**< 16-bit branch metric index of each butterfly. */
+    q15_t *pMetrics;            /**< points to two buffers of numStates path metrics. */
+    uint32_t *pDecisions;       /**< points to the survivor bits, RISCV_VITERBI_DECISION_WORDS(K) words per step. */
+    uint32_t maxSteps;          /**< number of steps the survivor bits buffer holds. */
+    uint32_t numSteps;          /**< number of steps since the initialization. */
+  } riscv_viterbi_instance_q15;
+
+  /**
+   * @brief Initialization function of the Q7 Viterbi decoder.
+   * @param[out]  *S points to an instance of the Q7 Viterbi decoder.
+   * @param[in]   constraintLen constraint length K of the code, 4 to 7.
+   * @param[in]   poly0 generator polynomial of the first code bit, bit K-1 for the newest input bit.
+   * @param[in]   poly1 generator polynomial of the second code bit.
+   * @param[in]   *pMetrics points to a buffer of <code>2*2^(K-1)</code> path metrics.
+   * @param[in]   *pDecisions points to a buffer of <code>maxSteps*RISCV_VITERBI_DECISION_WORDS(K)</code> words.
+   * @param[in]   maxSteps number of steps the decisions buffer holds.
+   * @return RISCV_MATH_ARGUMENT_ERROR if K or a polynomial is not supported, otherwise RISCV_MATH_SUCCESS.
+   */
+
+  riscv_status riscv_viterbi_init_q7(
+  riscv_viterbi_instance_q7 * S,
+  uint8_t constraintLen,
+  uint32_t poly0,
+  uint32_t poly1,
+  q7_t * pMetrics,
+  uint32_t * pDecisions,
+  uint32_t maxSteps);
+
+  /**
+   * @brief Add-compare-select steps of the Q7 Viterbi decoder.
+   * @param[in,out]  *S points to an instance of the Q7 Viterbi decoder.
+   * @param[in]      *pSrc points to <code>2*numSteps</code> soft bits, positive for a 0.
+   * @param[in]      numSteps number of steps.
+   * @return RISCV_MATH_LENGTH_ERROR if the decisions buffer is full, otherwise RISCV_MATH_SUCCESS.
+   */
+
+  riscv_status riscv_viterbi_acs_q7(
+  riscv_viterbi_instance_q7 * S,
+  const q7_t * pSrc,
+  uint32_t numSteps);
+
+  /**
+   * @brief Traceback of the Q7 Viterbi decoder.
+   * @param[in]   *S points to an instance of the Q7 Viterbi decoder.
+   * @param[in]   endState state of the encoder after the last step, or -1 for the state of the best metric.
+   * @param[out]  *pDst points to <code>(numSteps+7)/8</code> bytes for the decoded bits, first bit in the MSB.
+   * @return RISCV_MATH_ARGUMENT_ERROR if <code>endState</code> is not a state, otherwise RISCV_MATH_SUCCESS.
+   */
+
+  riscv_status riscv_viterbi_traceback_q7(
+  const riscv_viterbi_instance_q7 * S,
+  int32_t endState,
+  uint8_t * pDst);
+
+  /**
+   * @brief Initialization function of the Q15 Viterbi decoder.
+   * @param[out]  *S points to an instance of the Q15 Viterbi decoder.
+   * @param[in]   constraintLen constraint length K of the code, 4 to 7.
+   * @param[in]   poly0 generator polynomial of the first code bit, bit K-1 for the newest input bit.
+   * @param[in]   poly1 generator polynomial of the second code bit.
+   * @param[in]   *pMetrics points to a buffer of <code>2*2^(K-1)</code> path metrics.
+   * @param[in]   *pDecisions points to a buffer of <code>maxSteps*RISCV_VITERBI_DECISION_WORDS(K)</code> words.
+   * @param[in]   maxSteps number of steps the decisions buffer holds.
+   * @return RISCV_MATH_ARGUMENT_ERROR if K or a polynomial is not supported, otherwise RISCV_MATH_SUCCESS.
+   */
+
+  riscv_status riscv_viterbi_init_q15(
+  riscv_viterbi_instance_q15 * S,
+  uint8_t constraintLen,
+  uint32_t poly0,
+  uint32_t poly1,
+  q15_t * pMetrics,
+  uint32_t * pDecisions,
+  uint32_t maxSteps);
+
+  /**
+   * @brief Add-compare-select steps of the Q15 Viterbi decoder.
+   * @param[in,out]  *S points to an instance of the Q15 Viterbi decoder.
+   * @param[in]      *pSrc points to <code>2*numSteps</code> soft bits, positive for a 0.
+   * @param[in]      numSteps number of steps.
+   * @return RISCV_MATH_LENGTH_ERROR if the decisions buffer is full, otherwise RISCV_MATH_SUCCESS.
+   */
+
+  riscv_status riscv_viterbi_acs_q15(
+  riscv_viterbi_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t numSteps);
+
+  /**
+   * @brief Traceback of the Q15 Viterbi decoder.
+   * @param[in]   *S points to an instance of the Q15 Viterbi decoder.
+   * @param[in]   endState state of the encoder after the last step, or -1 for the state of the best metric.
+   * @param[out]  *pDst points to <code>(numSteps+7)/8</code> bytes for the decoded bits, first bit in the MSB.
+   * @return RISCV_MATH_ARGUMENT_ERROR if <code>endState</code> is not a state, otherwise RISCV_MATH_SUCCESS.
+   */
+
+  riscv_status riscv_viterbi_traceback_q15(
+  const riscv_viterbi_instance_q15 * S,
+  int32_t endState,
+  uint8_t * pDst);
+
+  /**
+   * @brief Instance structure of the single-producer, single-consumer ring buffer.
+   */
+
+  typedef struct
+  {
+    uint8_t *pBuffer;           /**< points to the memory of length*elemSize bytes. */
+    uint32_t length;            /**< number of elements, a power of two. */
+    uint32_t elemSize;          /**< size of an element in bytes. */
+    volatile uint32_t head;     /**< number of elements written, changed by the producer only. */
+    volatile uint32_t tail;     /**< number of elements read, changed by the consumer only. */
+  } riscv_ringbuf_instance;
+
+  /**
+   * @brief Orders the accesses to the elements and to the counters of the ring buffer.
+   */
+
+#ifndef RISCV_RINGBUF_BARRIER
+#define RISCV_RINGBUF_BARRIER()       __asm__ volatile ("" : : : "memory")
+#endif
+
+  /**
+   * @brief  Initialization function for the ring buffer.
+   * @param[out] *S        points to an instance of the ring buffer structure.
+   * @param[in]  *pBuffer  points to the memory of <code>length*elemSize</code> bytes.
+   * @param[in]  length    number of elements, a power of two.
+   * @param[in]  elemSize  size of an element in bytes.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_LENGTH_ERROR if <code>length</code> is not a power of two
+   * or <code>elemSize</code> is 0.
+   */
+
+  riscv_status riscv_ringbuf_init(
+  riscv_ringbuf_instance * S,
+  void * pBuffer,
+  uint32_t length,
+  uint32_t elemSize);
+
+  /**
+   * @brief  Number of free elements of the ring buffer, producer side.
+   * @param[in]  *S  points to an instance of the ring buffer structure.
+   * @return     number of elements that can be written.
+   */
+
+  uint32_t riscv_ringbuf_space(
+  const riscv_ringbuf_instance * S);
+
+  /**
+   * @brief  Writes a block of elements to the ring buffer.
+   * @param[in,out] *S      points to an instance of the ring buffer structure.
+   * @param[in]     *pSrc   points to the elements to write.
+   * @param[in]     count   number of elements to write.
+   * @return        number of elements written.
+   */
+
+  uint32_t riscv_ringbuf_write(
+  riscv_ringbuf_instance * S,
+  const void * pSrc,
+  uint32_t count);
+
+  /**
+   * @brief  Contiguous free region of the ring buffer.
+   * @param[in]  *S       points to an instance of the ring buffer structure.
+   * @param[out] *ppSpan  receives the address of the first free element.
+   * @return     number of contiguous free elements at <code>*ppSpan</code>.
+   */
+
+  uint32_t riscv_ringbuf_write_span(
+  const riscv_ringbuf_instance * S,
+  void ** ppSpan);
+
+  /**
+   * @brief  Publishes elements written through riscv_ringbuf_write_span().
+   * @param[in,out] *S     points to an instance of the ring buffer structure.
+   * @param[in]     count  number of elements written.
+   * @return none.
+   */
+
+  void riscv_ringbuf_write_commit(
+  riscv_ringbuf_instance * S,
+  uint32_t count);
+
+  /**
+   * @brief  Number of unread elements of the ring buffer, consumer side.
+   * @param[in]  *S  points to an instance of the ring buffer structure.
+   * @return     number of elements that can be read.
+   */
+
+  uint32_t riscv_ringbuf_count(
+  const riscv_ringbuf_instance * S);
+
+  /**
+   * @brief  Reads a block of elements from the ring buffer.
+   * @param[in,out] *S      points to an instance of the ring buffer structure.
+   * @param[out]    *pDst   points to the destination of the elements.
+   * @param[in]     count   number of elements to read.
+   * @return        number of elements read.
+   */
+
+  uint32_t riscv_ringbuf_read(
+  riscv_ringbuf_instance * S,
+  void * pDst,
+  uint32_t count);
+
+  /**
+   * @brief  Contiguous region of unread elements of the ring buffer.
+   * @param[in]  *S       points to an instance of the ring buffer structure.
+   * @param[out] *ppSpan  receives the address of the oldest unread element.
+   * @return     number of contiguous unread elements at <code>*ppSpan</code>.
+   */
+
+  uint32_t riscv_ringbuf_read_span(
+  const riscv_ringbuf_instance * S,
+  void ** ppSpan);
+
+  /**
+   * @brief  Releases elements read through riscv_ringbuf_read_span().
+   * @param[in,out] *S     points to an instance of the ring buffer structure.
+   * @param[in]     count  number of elements consumed.
+   * @return none.
+   */
+
+  void riscv_ringbuf_read_commit(
+  riscv_ringbuf_instance * S,
+  uint32_t count);
+
+  /**
+   * @brief Function forked on the cores, called once per core.
+   */
+
+  typedef void (*riscv_par_func)(
+  void * arg,
+  uint32_t coreId,
+  uint32_t numCores);
+
+  /**
+   * @brief Fork hook, runs func on numCores cores and returns after all of them are done.
+   */
+
+  typedef void (*riscv_par_fork_func)(
+  uint32_t numCores,
+  riscv_par_func func,
+  void * arg);
+
+  /**
+   * @brief Instance structure of the parallel execution context.
+   */
+
+  typedef struct
+  {
+    uint32_t numCores;             /**< number of cores the functions are forked on. */
+    riscv_par_fork_func fork;      /**< fork function of the runtime. */
+  } riscv_par_instance;
+
+  /**
+   * @brief  Initialization function of the parallel execution context.
+   * @param[out] *P        points to an instance of the parallel execution structure.
+   * @param[in]  numCores  number of cores the functions are forked on.
+   * @param[in]  fork      fork function of the runtime, NULL for riscv_par_fork_seq().
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>numCores</code> is 0.
+   */
+
+  riscv_status riscv_par_init(
+  riscv_par_instance * P,
+  uint32_t numCores,
+  riscv_par_fork_func fork);
+
+  /**
+   * @brief  Sequential fork, calls the function for every core in turn on the calling core.
+   * @param[in]  numCores  number of cores.
+   * @param[in]  func      function forked on the cores.
+   * @param[in]  *arg      argument of the function.
+   * @return none.
+   */
+
+  void riscv_par_fork_seq(
+  uint32_t numCores,
+  riscv_par_func func,
+  void * arg);
+
+  /**
+   * @brief  Part of a range of work items of one core.
+   * @param[in]  total     number of work items.
+   * @param[in]  align     granularity of the parts.
+   * @param[in]  coreId    index of the core.
+   * @param[in]  numCores  number of cores.
+   * @param[out] *pFirst   first item of the core.
+   * @param[out] *pCount   number of items of the core.
+   * @return none.
+   */
+
+  void riscv_par_split(
+  uint32_t total,
+  uint32_t align,
+  uint32_t coreId,
+  uint32_t numCores,
+  uint32_t * pFirst,
+  uint32_t * pCount);
+
+  /**
+   * @brief Floating-point matrix multiplication forked across the cluster cores.
+   * @param[in]       *P     points to the parallel execution context.
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst  points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  riscv_status riscv_mat_mult_par_f32(
+  const riscv_par_instance * P,
+  const riscv_matrix_instance_f32 * pSrcA,
+  const riscv_matrix_instance_f32 * pSrcB,
+  riscv_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Q31 matrix multiplication forked across the cluster cores.
+   * @param[in]       *P     points to the parallel execution context.
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst  points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  riscv_status riscv_mat_mult_par_q31(
+  const riscv_par_instance * P,
+  const riscv_matrix_instance_q31 * pSrcA,
+  const riscv_matrix_instance_q31 * pSrcB,
+  riscv_matrix_instance_q31 * pDst);
+
+  /**
+   * @brief Q15 matrix multiplication with a packed right-hand matrix forked across the cluster cores.
+   * @param[in]       *P     points to the parallel execution context.
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure, packed by riscv_mat_pack_q15()
+   * @param[out]      *pDst  points to output matrix structure
+   * @return     The function returns either
+   * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  riscv_status riscv_mat_mult_packed_par_q15(
+  const riscv_par_instance * P,
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_packed_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst);
+
+  /**
+   * @brief Granularity of the output blocks of the parallel FIR filters, the unroll factor of riscv_fir_f32().
+   */
+
+#define RISCV_FIR_PAR_ALIGN 4u
+
+  /**
+   * @brief Private state length of one core of the parallel FIR filters, even to keep the Q15 states 4-byte aligned.
+   */
+
+#define RISCV_FIR_PAR_STRIDE(numTaps, blockSize, numCores) \
+  (((uint32_t) (numTaps) + (((((uint32_t) (blockSize) + (numCores) - 1u) / (numCores)) + 3u) & ~3u) + 1u) & ~1u)
+
+  /**
+   * @brief Scratch length in samples of riscv_fir_par_f32(), riscv_fir_par_q31() and riscv_fir_par_q15().
+   */
+
+#define RISCV_FIR_PAR_SCRATCH_SIZE(numTaps, blockSize, numCores) \
+  ((numCores) * RISCV_FIR_PAR_STRIDE(numTaps, blockSize, numCores))
+
+  /**
+   * @brief Floating-point FIR filter forked across the cluster cores.
+   * @param[in]     *P         points to the parallel execution context.
+   * @param[in,out] *S         points to an instance of the floating-point FIR structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @param[in]     *pScratch  points to a scratch buffer of RISCV_FIR_PAR_SCRATCH_SIZE(numTaps, blockSize, numCores) samples.
+   * @return none.
+   */
+
+  void riscv_fir_par_f32(
+  const riscv_par_instance * P,
+  const riscv_fir_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize,
+  float32_t * pScratch);
+
+  /**
+   * @brief Q31 FIR filter forked across the cluster cores.
+   * @param[in]     *P         points to the parallel execution context.
+   * @param[in,out] *S         points to an instance of the Q31 FIR structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @param[in]     *pScratch  points to a scratch buffer of RISCV_FIR_PAR_SCRATCH_SIZE(numTaps, blockSize, numCores) samples.
+   * @return none.
+   */
+
+  void riscv_fir_par_q31(
+  const riscv_par_instance * P,
+  const riscv_fir_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize,
+  q31_t * pScratch);
+
+  /**
+   * @brief Q15 FIR filter forked across the cluster cores.
+   * @param[in]     *P         points to the parallel execution context.
+   * @param[in,out] *S         points to an instance of the Q15 FIR structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @param[in]     *pScratch  points to a scratch buffer of RISCV_FIR_PAR_SCRATCH_SIZE(numTaps, blockSize, numCores) samples.
+   * @return none.
+   */
+
+  void riscv_fir_par_q15(
+  const riscv_par_instance * P,
+  const riscv_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize,
+  q15_t * pScratch);
+
+  /**
+   * @brief Floating-point convolution forked across the cluster cores.
+   * @param[in]  *P       points to the parallel execution context.
+   * @param[in]  *pSrcA   points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  *pSrcB   points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] *pDst    points to the block of output data.  Length srcALen+srcBLen-1.
+   * @return none.
+   */
+
+  void riscv_conv_par_f32(
+  const riscv_par_instance * P,
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst);
+
+  /**
+   * @brief Q31 convolution forked across the cluster cores.
+   * @param[in]  *P       points to the parallel execution context.
+   * @param[in]  *pSrcA   points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  *pSrcB   points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] *pDst    points to the block of output data.  Length srcALen+srcBLen-1.
+   * @return none.
+   */
+
+  void riscv_conv_par_q31(
+  const riscv_par_instance * P,
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst);
+
+  /**
+   * @brief Q15 convolution forked across the cluster cores.
+   * @param[in]  *P       points to the parallel execution context.
+   * @param[in]  *pSrcA   points to the first input sequence.
+   * @param[in]  srcALen  length of the first input sequence.
+   * @param[in]  *pSrcB   points to the second input sequence.
+   * @param[in]  srcBLen  length of the second input sequence.
+   * @param[out] *pDst    points to the block of output data.  Length srcALen+srcBLen-1.
+   * @return none.
+   */
+
+  void riscv_conv_par_q15(
+  const riscv_par_instance * P,
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst);
+
+  /**
+   * @brief Twiddle table length in words of riscv_cfft_par_init_f32(), 7 complex factors per radix-8 butterfly.
+   */
+
+#define RISCV_CFFT_PAR_TWIDDLE_SIZE(fftLen) ((14u * (uint32_t) (fftLen)) / 8u)
+
+  /**
+   * @brief Instance structure of the floating-point CFFT forked across the cluster cores.
+   */
+
+  typedef struct
+  {
+    uint32_t fftLen;                       /**< length of the FFT. */
+    const riscv_cfft_instance_f32 *pSub;   /**< points to the CFFT instance of length fftLen/8. */
+    const float32_t *pTwiddle;             /**< points to the twiddle factors of the first stage. */
+    float32_t *pScratch;                   /**< points to the scratch buffer of 2*fftLen words. */
+  } riscv_cfft_par_instance_f32;
+
+  /**
+   * @brief  Initialization function of the floating-point CFFT forked across the cluster cores.
+   * @param[out] *S        points to an instance of the parallel floating-point CFFT structure.
+   * @param[in]  fftLen    length of the FFT, 8 times the length of <code>pSub</code>.
+   * @param[in]  *pSub     points to the floating-point CFFT instance of length <code>fftLen/8</code>.
+   * @param[out] *pTwiddle points to a buffer of RISCV_CFFT_PAR_TWIDDLE_SIZE(fftLen) words.
+   * @param[in]  *pScratch points to a scratch buffer of <code>2*fftLen</code> words.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not 8 times the length of <code>pSub</code>.
+   */
+
+  riscv_status riscv_cfft_par_init_f32(
+  riscv_cfft_par_instance_f32 * S,
+  uint32_t fftLen,
+  const riscv_cfft_instance_f32 * pSub,
+  float32_t * pTwiddle,
+  float32_t * pScratch);
+
+  /**
+   * @brief Floating-point CFFT forked across the cluster cores, output in natural order.
+   * @param[in]      *P        points to the parallel execution context.
+   * @param[in]      *S        points to an instance of the parallel floating-point CFFT structure.
+   * @param[in, out] *p1       points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+   * @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @return none.
+   */
+
+  void riscv_cfft_par_f32(
+  const riscv_par_instance * P,
+  const riscv_cfft_par_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief DMA start hook, queues a 2D transfer and returns its identifier.
+   */
+
+  typedef uint32_t (*riscv_dma_start_func)(
+  void * ctx,
+  void * pDst,
+  const void * pSrc,
+  uint32_t rowSize,
+  uint32_t numRows,
+  uint32_t dstStride,
+  uint32_t srcStride);
+
+  /**
+   * @brief DMA wait hook, returns when the transfer and all transfers started before it are done.
+   */
+
+  typedef void (*riscv_dma_wait_func)(
+  void * ctx,
+  uint32_t id);
+
+  /**
+   * @brief Instance structure of the DMA hook of the streaming functions.
+   */
+
+  typedef struct
+  {
+    riscv_dma_start_func start;    /**< queues a 2D transfer. */
+    riscv_dma_wait_func wait;      /**< waits for a transfer. */
+    void *ctx;                     /**< context of start and wait. */
+  } riscv_dma_instance;
+
+  /**
+   * @brief  Synchronous 2D copy with memcpy, the default DMA of riscv_dma_init().
+   * @param[in]  *ctx       unused.
+   * @param[out] *pDst      points to the first destination row.
+   * @param[in]  *pSrc      points to the first source row.
+   * @param[in]  rowSize    size of a row in bytes.
+   * @param[in]  numRows    number of rows.
+   * @param[in]  dstStride  distance between two destination rows in bytes.
+   * @param[in]  srcStride  distance between two source rows in bytes.
+   * @return     transfer identifier, always 0.
+   */
+
+  uint32_t riscv_dma_start_memcpy(
+  void * ctx,
+  void * pDst,
+  const void * pSrc,
+  uint32_t rowSize,
+  uint32_t numRows,
+  uint32_t dstStride,
+  uint32_t srcStride);
+
+  /**
+   * @brief  Wait of riscv_dma_start_memcpy(), the copies are already done.
+   * @param[in]  *ctx  unused.
+   * @param[in]  id    unused.
+   * @return none.
+   */
+
+  void riscv_dma_wait_none(
+  void * ctx,
+  uint32_t id);
+
+  /**
+   * @brief  Initialization function of the DMA hook.
+   * @param[out] *D     points to an instance of the DMA structure.
+   * @param[in]  start  function that queues a 2D transfer, NULL for riscv_dma_start_memcpy().
+   * @param[in]  wait   function that waits for a transfer, ignored when <code>start</code> is NULL.
+   * @param[in]  *ctx   context handed to <code>start</code> and <code>wait</code>.
+   * @return none.
+   */
+
+  void riscv_dma_init(
+  riscv_dma_instance * D,
+  riscv_dma_start_func start,
+  riscv_dma_wait_func wait,
+  void * ctx);
+
+  /**
+   * @brief Function processing one tile of riscv_stream_process().
+   */
+
+  typedef void (*riscv_stream_func)(
+  void * arg,
+  void * pIn,
+  void * pOut,
+  uint32_t blockSize);
+
+  /**
+   * @brief Size in bytes of the L1 buffer of riscv_stream_process(), two input and two output tiles.
+   */
+
+#define RISCV_STREAM_L1_SIZE(tileSize, elemSize) (4u * (uint32_t) (tileSize) * (uint32_t) (elemSize))
+
+  /**
+   * @brief  Processes a vector in L2 tile by tile in L1.
+   * @param[in]  *D         points to the DMA hook.
+   * @param[in]  func       function processing one tile.
+   * @param[in]  *arg       argument of <code>func</code>.
+   * @param[in]  *pSrc      points to the input vector of <code>length</code> elements.
+   * @param[out] *pDst      points to the output vector of <code>length</code> elements, may be <code>pSrc</code>.
+   * @param[in]  length     number of elements.
+   * @param[in]  elemSize   size of an element in bytes.
+   * @param[in]  tileSize   number of elements of a tile.
+   * @param[in]  *pL1       points to RISCV_STREAM_L1_SIZE(tileSize, elemSize) bytes in L1.
+   * @return none.
+   */
+
+  void riscv_stream_process(
+  const riscv_dma_instance * D,
+  riscv_stream_func func,
+  void * arg,
+  const void * pSrc,
+  void * pDst,
+  uint32_t length,
+  uint32_t elemSize,
+  uint32_t tileSize,
+  void * pL1);
+
+  /**
+   * @brief Floating-point FIR filter streamed from L2 through tiles in L1.
+   * @param[in]  *D         points to the DMA hook.
+   * @param[in]  *S         points to an instance of the floating-point FIR filter structure.
+   * @param[in]  *pSrc      points to the input samples in L2.
+   * @param[out] *pDst      points to the output samples in L2, may be <code>pSrc</code>.
+   * @param[in]  length     number of samples to process.
+   * @param[in]  tileSize   number of samples processed per tile.
+   * @param[in]  *pL1       points to a buffer of <code>4*tileSize</code> samples in L1.
+   * @return none.
+   */
+
+  void riscv_fir_stream_f32(
+  const riscv_dma_instance * D,
+  const riscv_fir_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t length,
+  uint32_t tileSize,
+  float32_t * pL1);
+
+  /**
+   * @brief Q31 FIR filter streamed from L2 through tiles in L1.
+   * @param[in]  *D         points to the DMA hook.
+   * @param[in]  *S         points to an instance of the Q31 FIR filter structure.
+   * @param[in]  *pSrc      points to the input samples in L2.
+   * @param[out] *pDst      points to the output samples in L2, may be <code>pSrc</code>.
+   * @param[in]  length     number of samples to process.
+   * @param[in]  tileSize   number of samples processed per tile.
+   * @param[in]  *pL1       points to a buffer of <code>4*tileSize</code> samples in L1.
+   * @return none.
+   */
+
+  void riscv_fir_stream_q31(
+  const riscv_dma_instance * D,
+  const riscv_fir_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t length,
+  uint32_t tileSize,
+  q31_t * pL1);
+
+  /**
+   * @brief Q15 FIR filter streamed from L2 through tiles in L1.
+   * @param[in]  *D         points to the DMA hook.
+   * @param[in]  *S         points to an instance of the Q15 FIR filter structure.
+   * @param[in]  *pSrc      points to the input samples in L2.
+   * @param[out] *pDst      points to the output samples in L2, may be <code>pSrc</code>.
+   * @param[in]  length     number of samples to process.
+   * @param[in]  tileSize   number of samples processed per tile.
+   * @param[in]  *pL1       points to a buffer of <code>4*tileSize</code> samples in L1.
+   * @return none.
+   */
+
+  void riscv_fir_stream_q15(
+  const riscv_dma_instance * D,
+  const riscv_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t length,
+  uint32_t tileSize,
+  q15_t * pL1);
+
+  /**
+   * @brief Floating-point Biquad cascade filter streamed from L2 through tiles in L1.
+   * @param[in]  *D         points to the DMA hook.
+   * @param[in]  *S         points to an instance of the floating-point Biquad cascade filter structure.
+   * @param[in]  *pSrc      points to the input samples in L2.
+   * @param[out] *pDst      points to the output samples in L2, may be <code>pSrc</code>.
+   * @param[in]  length     number of samples to process.
+   * @param[in]  tileSize   number of samples processed per tile.
+   * @param[in]  *pL1       points to a buffer of <code>4*tileSize</code> samples in L1.
+   * @return none.
+   */
+
+  void riscv_biquad_cascade_df1_stream_f32(
+  const riscv_dma_instance * D,
+  const riscv_biquad_casd_df1_inst_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t length,
+  uint32_t tileSize,
+  float32_t * pL1);
+
+  /**
+   * @brief Q31 Biquad cascade filter streamed from L2 through tiles in L1.
+   * @param[in]  *D         points to the DMA hook.
+   * @param[in]  *S         points to an instance of the Q31 Biquad cascade filter structure.
+   * @param[in]  *pSrc      points to the input samples in L2.
+   * @param[out] *pDst      points to the output samples in L2, may be <code>pSrc</code>.
+   * @param[in]  length     number of samples to process.
+   * @param[in]  tileSize   number of samples processed per tile.
+   * @param[in]  *pL1       points to a buffer of <code>4*tileSize</code> samples in L1.
+   * @return none.
+   */
+
+  void riscv_biquad_cascade_df1_stream_q31(
+  const riscv_dma_instance * D,
+  const riscv_biquad_casd_df1_inst_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t length,
+  uint32_t tileSize,
+  q31_t * pL1);
+
+  /**
+   * @brief Q15 Biquad cascade filter streamed from L2 through tiles in L1.
+   * @param[in]  *D         points to the DMA hook.
+   * @param[in]  *S         points to an instance of the Q15 Biquad cascade filter structure.
+   * @param[in]  *pSrc      points to the input samples in L2.
+   * @param[out] *pDst      points to the output samples in L2, may be <code>pSrc</code>.
+   * @param[in]  length     number of samples to process.
+   * @param[in]  tileSize   number of samples processed per tile.
+   * @param[in]  *pL1       points to a buffer of <code>4*tileSize</code> samples in L1.
+   * @return none.
+   */
+
+  void riscv_biquad_cascade_df1_stream_q15(
+  const riscv_dma_instance * D,
+  const riscv_biquad_casd_df1_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t length,
+  uint32_t tileSize,
+  q15_t * pL1);
+
+
+  /**
+   * @brief Length in elements of the L1 buffer of riscv_mat_vec_mult_stream_q15() and _q7(), two tiles of rows.
+   */
+
+#define RISCV_MAT_VEC_STREAM_L1_SIZE(tileRows, numCols) (2u * (uint32_t) (tileRows) * (uint32_t) (numCols))
+
+  /**
+   * @brief Q15 matrix vector multiplication with the matrix streamed from flash or L2 through tiles in L1.
+   * @param[in]  *D         points to the DMA hook.
+   * @param[in]  *pSrcMat   points to the matrix, its data in flash or L2.
+   * @param[in]  *pVec      points to the input vector, in L1.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  tileRows   number of matrix rows per transfer.
+   * @param[in]  *pL1       points to RISCV_MAT_VEC_STREAM_L1_SIZE(tileRows, numCols) elements in L1.
+   * @return none.
+   */
+
+  void riscv_mat_vec_mult_stream_q15(
+  const riscv_dma_instance * D,
+  const riscv_matrix_instance_q15 * pSrcMat,
+  q15_t * pVec,
+  q15_t * pDst,
+  uint16_t tileRows,
+  q15_t * pL1);
+
+  /**
+   * @brief Q7 matrix vector multiplication with the matrix streamed from flash or L2 through tiles in L1.
+   * @param[in]  *D         points to the DMA hook.
+   * @param[in]  *pSrcMat   points to the matrix, its data in flash or L2.
+   * @param[in]  *pVec      points to the input vector, in L1.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  tileRows   number of matrix rows per transfer.
+   * @param[in]  *pL1       points to RISCV_MAT_VEC_STREAM_L1_SIZE(tileRows, numCols) elements in L1.
+   * @return none.
+   */
+
+  void riscv_mat_vec_mult_stream_q7(
+  const riscv_dma_instance * D,
+  const riscv_matrix_instance_q7 * pSrcMat,
+  q7_t * pVec,
+  q7_t * pDst,
+  uint16_t tileRows,
+  q7_t * pL1);
+
+  /**
+   * @brief Length in samples of the L1 buffer of riscv_fir_coeff_stream_q15(), two tiles of coefficients and state.
+   */
+
+#define RISCV_FIR_COEFF_STREAM_L1_SIZE(tileTaps, blockSize) (2u * ((2u * (uint32_t) (tileTaps)) + (uint32_t) (blockSize) - 1u))
+
+  /**
+   * @brief Q15 FIR filter with the coefficients and the state streamed from flash or L2 through tiles in L1.
+   * @param[in]  *D          points to the DMA hook.
+   * @param[in]  *S          points to an instance of the Q15 FIR filter structure, coefficients in flash or L2, state in L2.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of output samples.
+   * @param[in]  blockSize   number of samples to process.
+   * @param[in]  tileTaps    number of coefficients per transfer.
+   * @param[in]  *pL1        points to RISCV_FIR_COEFF_STREAM_L1_SIZE(tileTaps, blockSize) samples in L1.
+   * @param[out] *pAcc       points to <code>blockSize</code> accumulators in L1.
+   * @return none.
+   */
+
+  void riscv_fir_coeff_stream_q15(
+  const riscv_dma_instance * D,
+  const riscv_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize,
+  uint16_t tileTaps,
+  q15_t * pL1,
+  q63_t * pAcc);
+
+  /**
+   * @brief Twiddle table length in words of riscv_cfft_stream_init_f32().
+   */
+
+#define RISCV_CFFT_STREAM_TWIDDLE_SIZE(N1, N2) (2u * ((uint32_t) (N1) + (uint32_t) (N2)))
+
+  /**
+   * @brief L1 buffer length in words of riscv_cfft_stream_init_f32(), four tiles of each pass and one column.
+   */
+
+#define RISCV_CFFT_STREAM_L1_SIZE(N1, N2, tileSize) \
+  (((8u * (uint32_t) (N1) * (tileSize)) + (2u * (uint32_t) (N1))) > (8u * (uint32_t) (N2) * (tileSize)) ? \
+   ((8u * (uint32_t) (N1) * (tileSize)) + (2u * (uint32_t) (N1))) : (8u * (uint32_t) (N2) * (tileSize)))
+
+  /**
+   * @brief Instance structure of the floating-point CFFT streamed from L2 through tiles in L1.
+   */
+
+  typedef struct
+  {
+    uint32_t fftLen;                       /**< length of the FFT, N1*N2. */
+    const riscv_cfft_instance_f32 *pCol;   /**< points to the CFFT instance of length N1. */
+    const riscv_cfft_instance_f32 *pRow;   /**< points to the CFFT instance of length N2. */
+    uint16_t tileSize;                     /**< number of columns and rows per transfer. */
+    const float32_t *pTwiddle;             /**< points to the twiddle tables, in L1. */
+    float32_t *pL1;                        /**< points to the tiles, in L1. */
+  } riscv_cfft_stream_instance_f32;
+
+  /**
+   * @brief  Initialization function of the floating-point CFFT streamed from L2 through tiles in L1.
+   * @param[out] *S        points to an instance of the streamed floating-point CFFT structure.
+   * @param[in]  *pCol     points to the CFFT instance of length N1.
+   * @param[in]  *pRow     points to the CFFT instance of length N2.
+   * @param[in]  tileSize  number of columns and rows moved per transfer, divides N1 and N2.
+   * @param[out] *pTwiddle points to a buffer of RISCV_CFFT_STREAM_TWIDDLE_SIZE(N1, N2) words in L1.
+   * @param[in]  *pL1      points to a buffer of RISCV_CFFT_STREAM_L1_SIZE(N1, N2, tileSize) words in L1.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>tileSize</code> is 0 or does not divide both lengths.
+   */
+
+  riscv_status riscv_cfft_stream_init_f32(
+  riscv_cfft_stream_instance_f32 * S,
+  const riscv_cfft_instance_f32 * pCol,
+  const riscv_cfft_instance_f32 * pRow,
+  uint16_t tileSize,
+  float32_t * pTwiddle,
+  float32_t * pL1);
+
+  /**
+   * @brief Floating-point four-step CFFT streamed from L2 through tiles in L1, output in natural order.
+   * @param[in]      *D        points to the DMA hook.
+   * @param[in]      *S        points to an instance of the streamed floating-point CFFT structure.
+   * @param[in, out] *pBuf     points to the complex input of <code>2*fftLen</code> words in L2, overwritten.
+   * @param[out]     *pDst     points to the complex output of <code>2*fftLen</code> words in L2, <code>pBuf</code> for an in-place transform.
+   * @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @return none.
+   */
+
+  void riscv_cfft_stream_f32(
+  const riscv_dma_instance * D,
+  const riscv_cfft_stream_instance_f32 * S,
+  float32_t * pBuf,
+  float32_t * pDst,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief  Copies the elements of a Q15 vector.
+   * @param[in]  *pSrc input pointer
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void riscv_copy_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Copies the elements of a Q31 vector.
+   * @param[in]  *pSrc input pointer
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void riscv_copy_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+  /**
+   * @brief  Fills a constant value into a floating-point vector.
+   * @param[in]  value input value to be filled
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void riscv_fill_f32(
+  float32_t value,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fills a constant value into a Q7 vector.
+   * @param[in]  value input value to be filled
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void riscv_fill_q7(
+  q7_t value,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fills a constant value into a Q15 vector.
+   * @param[in]  value input value to be filled
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void riscv_fill_q15(
+  q15_t value,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fills a constant value into a Q31 vector.
+   * @param[in]  value input value to be filled
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void riscv_fill_q31(
+  q31_t value,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+/**
+ * @brief Convolution of floating-point sequences.
+ * @param[in] *pSrcA points to the first input sequence.
+ * @param[in] srcALen length of the first input sequence.
+ * @param[in] *pSrcB points to the second input sequence.
+ * @param[in] srcBLen length of the second input sequence.
+ * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @return none.
+ */
+
+  void riscv_conv_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Convolution of Q15 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in]  *pScratch1 points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]  *pScratch2 points to scratch buffer of size min(srcALen, srcBLen).
+   * @return none.
+   */
+
+
+  void riscv_conv_opt_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
+
+
+/**
+ * @brief Convolution of Q15 sequences.
+ * @param[in] *pSrcA points to the first input sequence.
+ * @param[in] srcALen length of the first input sequence.
+ * @param[in] *pSrcB points to the second input sequence.
+ * @param[in] srcBLen length of the second input sequence.
+ * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @return none.
+ */
+
+  void riscv_conv_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst);
+
+  /**
+   * @brief Convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @return none.
+   */
+
+  void riscv_conv_fast_q15(
+			  q15_t * pSrcA,
+			 uint32_t srcALen,
+			  q15_t * pSrcB,
+			 uint32_t srcBLen,
+			 q15_t * pDst);
+
+  /**
+   * @brief Convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in]  *pScratch1 points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]  *pScratch2 points to scratch buffer of size min(srcALen, srcBLen).
+   * @return none.
+   */
+
+  void riscv_conv_fast_opt_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
+
+
+
+  /**
+   * @brief Convolution of Q31 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @return none.
+   */
+
+  void riscv_conv_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst);
+
+  /**
+   * @brief Convolution of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @return none.
+   */
+
+  void riscv_conv_fast_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst);
+
+
+    /**
+   * @brief Convolution of Q7 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in]  *pScratch1 points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]  *pScratch2 points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
+   * @return none.
+   */
+
+  void riscv_conv_opt_q7(
+  q7_t * pSrcA,
+  uint32_t srcALen,
+  q7_t * pSrcB,
+  uint32_t srcBLen,
+  q7_t * pDst,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
+
+
+
+  /**
+   * @brief Convolution of Q7 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @return none.
+   */
+
+  void riscv_conv_q7(
+  q7_t * pSrcA,
+  uint32_t srcALen,
+  q7_t * pSrcB,
+  uint32_t srcBLen,
+  q7_t * pDst);
+
+
+  /**
+   * @brief Partial convolution of floating-point sequences.
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+
+  riscv_status riscv_conv_partial_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints);
+
+    /**
+   * @brief Partial convolution of Q15 sequences.
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @param[in]       * pScratch1 points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]       * pScratch2 points to scratch buffer of size min(srcALen, srcBLen).
+   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+
+  riscv_status riscv_conv_partial_opt_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
+
+
+/**
+   * @brief Partial convolution of Q15 sequences.
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+
+  riscv_status riscv_conv_partial_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints);
+
+  /**
+   * @brief Partial convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+
+  riscv_status riscv_conv_partial_fast_q15(
+				        q15_t * pSrcA,
+				       uint32_t srcALen,
+				        q15_t * pSrcB,
+				       uint32_t srcBLen,
+				       q15_t * pDst,
+				       uint32_t firstIndex,
+				       uint32_t numPoints);
+
+
+  /**
+   * @brief Partial convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @param[in]       * pScratch1 points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]       * pScratch2 points to scratch buffer of size min(srcALen, srcBLen).
+   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+
+  riscv_status riscv_conv_partial_fast_opt_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
+
+
+  /**
+   * @brief Partial convolution of Q31 sequences.
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+
+  riscv_status riscv_conv_partial_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints);
+
+
+  /**
+   * @brief Partial convolution of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+
+  riscv_status riscv_conv_partial_fast_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints);
+
+
+  /**
+   * @brief Partial convolution of Q7 sequences
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @param[in]  *pScratch1 points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]  *pScratch2 points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
+   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+
+  riscv_status riscv_conv_partial_opt_q7(
+  q7_t * pSrcA,
+  uint32_t srcALen,
+  q7_t * pSrcB,
+  uint32_t srcBLen,
+  q7_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
+
+
+/**
+   * @brief Partial convolution of Q7 sequences.
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+
+  riscv_status riscv_conv_partial_q7(
+  q7_t * pSrcA,
+  uint32_t srcALen,
+  q7_t * pSrcB,
+  uint32_t srcBLen,
+  q7_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints);
+
+  /**
+   * @brief Instance structure for the Q15 streaming convolution.
+   */
+  typedef struct
+  {
+    uint16_t srcBLen;                  /**< length of the fixed sequence. */
+    uint32_t blockSize;                /**< maximum number of samples processed by one call of the FIR filter. */
+    riscv_fir_instance_q15 Sfir;       /**< FIR filter with the time reversed sequence as coefficients. */
+  } riscv_conv_stream_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 streaming convolution.
+   */
+  typedef struct
+  {
+    uint16_t srcBLen;                  /**< length of the fixed sequence. */
+    uint32_t blockSize;                /**< maximum number of samples processed by one call of the FIR filter. */
+    riscv_fir_instance_q31 Sfir;       /**< FIR filter with the time reversed sequence as coefficients. */
+  } riscv_conv_stream_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point streaming convolution.
+   */
+  typedef struct
+  {
+    uint16_t srcBLen;                  /**< length of the fixed sequence. */
+    uint32_t blockSize;                /**< maximum number of samples processed by one call of the FIR filter. */
+    riscv_fir_instance_f32 Sfir;       /**< FIR filter with the time reversed sequence as coefficients. */
+  } riscv_conv_stream_instance_f32;
+
+  /**
+   * @brief  Initialization function for the Q15 streaming convolution.
+   * @param[in,out] *S points to an instance of the Q15 streaming convolution structure.
+   * @param[in] *pSrcB points to the fixed sequence.
+   * @param[in] srcBLen length of the fixed sequence.
+   * @param[out] *pCoeffs points to a buffer of srcBLen samples, rounded up to an even value, that receives the time reversed sequence.
+   * @param[in] *pState points to the state buffer of length numTaps+blockSize-1, numTaps being the length of pCoeffs.
+   * @param[in] blockSize maximum number of samples processed by one call of the FIR filter.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization was successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>srcBLen</code> or <code>blockSize</code> is not a supported value.
+   */
+  riscv_status riscv_conv_stream_init_q15(
+  riscv_conv_stream_instance_q15 * S,
+  q15_t * pSrcB,
+  uint16_t srcBLen,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q15 streaming convolution.
+   * @param[in,out] *S points to an instance of the Q15 streaming convolution structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of srcLen output values.
+   * @param[in] srcLen number of input samples, any value.
+   * @return none.
+   */
+  void riscv_conv_stream_q15(
+  riscv_conv_stream_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t srcLen);
+
+  /**
+   * @brief Returns the last srcBLen-1 outputs of the Q15 streaming convolution and clears its state.
+   * @param[in,out] *S points to an instance of the Q15 streaming convolution structure.
+   * @param[out] *pDst points to the block of srcBLen-1 output values.
+   * @return none.
+   */
+  void riscv_conv_stream_flush_q15(
+  riscv_conv_stream_instance_q15 * S,
+  q15_t * pDst);
+
+  /**
+   * @brief  Initialization function for the Q31 streaming convolution.
+   * @param[in,out] *S points to an instance of the Q31 streaming convolution structure.
+   * @param[in] *pSrcB points to the fixed sequence.
+   * @param[in] srcBLen length of the fixed sequence.
+   * @param[out] *pCoeffs points to a buffer of srcBLen words that receives the time reversed sequence.
+   * @param[in] *pState points to the state buffer of length srcBLen+blockSize-1.
+   * @param[in] blockSize maximum number of samples processed by one call of the FIR filter.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization was successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>srcBLen</code> or <code>blockSize</code> is not a supported value.
+   */
+  riscv_status riscv_conv_stream_init_q31(
+  riscv_conv_stream_instance_q31 * S,
+  q31_t * pSrcB,
+  uint16_t srcBLen,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 streaming convolution.
+   * @param[in,out] *S points to an instance of the Q31 streaming convolution structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of srcLen output values.
+   * @param[in] srcLen number of input samples, any value.
+   * @return none.
+   */
+  void riscv_conv_stream_q31(
+  riscv_conv_stream_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t srcLen);
+
+  /**
+   * @brief Returns the last srcBLen-1 outputs of the Q31 streaming convolution and clears its state.
+   * @param[in,out] *S points to an instance of the Q31 streaming convolution structure.
+   * @param[out] *pDst points to the block of srcBLen-1 output values.
+   * @return none.
+   */
+  void riscv_conv_stream_flush_q31(
+  riscv_conv_stream_instance_q31 * S,
+  q31_t * pDst);
+
+  /**
+   * @brief  Initialization function for the floating-point streaming convolution.
+   * @param[in,out] *S points to an instance of the floating-point streaming convolution structure.
+   * @param[in] *pSrcB points to the fixed sequence.
+   * @param[in] srcBLen length of the fixed sequence.
+   * @param[out] *pCoeffs points to a buffer of srcBLen words that receives the time reversed sequence.
+   * @param[in] *pState points to the state buffer of length srcBLen+blockSize-1.
+   * @param[in] blockSize maximum number of samples processed by one call of the FIR filter.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization was successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>srcBLen</code> or <code>blockSize</code> is not a supported value.
+   */
+  riscv_status riscv_conv_stream_init_f32(
+  riscv_conv_stream_instance_f32 * S,
+  float32_t * pSrcB,
+  uint16_t srcBLen,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point streaming convolution.
+   * @param[in,out] *S points to an instance of the floating-point streaming convolution structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of srcLen output values.
+   * @param[in] srcLen number of input samples, any value.
+   * @return none.
+   */
+  void riscv_conv_stream_f32(
+  riscv_conv_stream_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t srcLen);
+
+  /**
+   * @brief Returns the last srcBLen-1 outputs of the floating-point streaming convolution and clears its state.
+   * @param[in,out] *S points to an instance of the floating-point streaming convolution structure.
+   * @param[out] *pDst points to the block of srcBLen-1 output values.
+   * @return none.
+   */
+  void riscv_conv_stream_flush_f32(
+  riscv_conv_stream_instance_f32 * S,
+  float32_t * pDst);
+
+  /**
+   * @brief Size of the local kernel buffer of riscv_conv2d_q7(), riscv_conv2d_q15() and riscv_conv2d_f32(), in samples.
+   */
+
+#ifndef RISCV_CONV2D_MAX_KERNEL
+#define RISCV_CONV2D_MAX_KERNEL 49u
+#endif
+
+  /**
+   * @brief 2D correlation of a Q7 image with a Q7 kernel.
+   * @param[in] *pSrc points to the image, stored row by row.
+   * @param[in] srcRows number of rows of the image.
+   * @param[in] srcCols number of columns of the image.
+   * @param[in] *pKernel points to the kernel, stored row by row.
+   * @param[in] kRows number of rows of the kernel.
+   * @param[in] kCols number of columns of the kernel.
+   * @param[out] *pDst points to the output image of (srcRows-kRows+1)*(srcCols-kCols+1) samples.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the kernel is empty or larger than the image.
+   */
+  riscv_status riscv_correlate2d_q7(
+  q7_t * pSrc,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  q7_t * pKernel,
+  uint16_t kRows,
+  uint16_t kCols,
+  q7_t * pDst);
+
+  /**
+   * @brief 2D convolution of a Q7 image with a Q7 kernel.
+   * @param[in] *pSrc points to the image, stored row by row.
+   * @param[in] srcRows number of rows of the image.
+   * @param[in] srcCols number of columns of the image.
+   * @param[in] *pKernel points to the kernel, stored row by row.
+   * @param[in] kRows number of rows of the kernel.
+   * @param[in] kCols number of columns of the kernel.
+   * @param[out] *pDst points to the output image of (srcRows-kRows+1)*(srcCols-kCols+1) samples.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the kernel is empty, larger than the image or has more than RISCV_CONV2D_MAX_KERNEL samples.
+   */
+  riscv_status riscv_conv2d_q7(
+  q7_t * pSrc,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  q7_t * pKernel,
+  uint16_t kRows,
+  uint16_t kCols,
+  q7_t * pDst);
+
+  /**
+   * @brief 2D correlation of a Q15 image with a Q15 kernel.
+   * @param[in] *pSrc points to the image, stored row by row.
+   * @param[in] srcRows number of rows of the image.
+   * @param[in] srcCols number of columns of the image.
+   * @param[in] *pKernel points to the kernel, stored row by row.
+   * @param[in] kRows number of rows of the kernel.
+   * @param[in] kCols number of columns of the kernel.
+   * @param[out] *pDst points to the output image of (srcRows-kRows+1)*(srcCols-kCols+1) samples.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the kernel is empty or larger than the image.
+   */
+  riscv_status riscv_correlate2d_q15(
+  q15_t * pSrc,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  q15_t * pKernel,
+  uint16_t kRows,
+  uint16_t kCols,
+  q15_t * pDst);
+
+  /**
+   * @brief 2D convolution of a Q15 image with a Q15 kernel.
+   * @param[in] *pSrc points to the image, stored row by row.
+   * @param[in] srcRows number of rows of the image.
+   * @param[in] srcCols number of columns of the image.
+   * @param[in] *pKernel points to the kernel, stored row by row.
+   * @param[in] kRows number of rows of the kernel.
+   * @param[in] kCols number of columns of the kernel.
+   * @param[out] *pDst points to the output image of (srcRows-kRows+1)*(srcCols-kCols+1) samples.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the kernel is empty, larger than the image or has more than RISCV_CONV2D_MAX_KERNEL samples.
+   */
+  riscv_status riscv_conv2d_q15(
+  q15_t * pSrc,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  q15_t * pKernel,
+  uint16_t kRows,
+  uint16_t kCols,
+  q15_t * pDst);
+
+  /**
+   * @brief 2D correlation of a floating-point image with a floating-point kernel.
+   * @param[in] *pSrc points to the image, stored row by row.
+   * @param[in] srcRows number of rows of the image.
+   * @param[in] srcCols number of columns of the image.
+   * @param[in] *pKernel points to the kernel, stored row by row.
+   * @param[in] kRows number of rows of the kernel.
+   * @param[in] kCols number of columns of the kernel.
+   * @param[out] *pDst points to the output image of (srcRows-kRows+1)*(srcCols-kCols+1) samples.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the kernel is empty or larger than the image.
+   */
+  riscv_status riscv_correlate2d_f32(
+  float32_t * pSrc,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  float32_t * pKernel,
+  uint16_t kRows,
+  uint16_t kCols,
+  float32_t * pDst);
+
+  /**
+   * @brief 2D convolution of a floating-point image with a floating-point kernel.
+   * @param[in] *pSrc points to the image, stored row by row.
+   * @param[in] srcRows number of rows of the image.
+   * @param[in] srcCols number of columns of the image.
+   * @param[in] *pKernel points to the kernel, stored row by row.
+   * @param[in] kRows number of rows of the kernel.
+   * @param[in] kCols number of columns of the kernel.
+   * @param[out] *pDst points to the output image of (srcRows-kRows+1)*(srcCols-kCols+1) samples.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the kernel is empty, larger than the image or has more than RISCV_CONV2D_MAX_KERNEL samples.
+   */
+  riscv_status riscv_conv2d_f32(
+  float32_t * pSrc,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  float32_t * pKernel,
+  uint16_t kRows,
+  uint16_t kCols,
+  float32_t * pDst);
+
+
+
+  /**
+   * @brief Instance structure for the Q15 FIR decimator.
+   */
+
+  typedef struct
+  {
+    uint8_t M;                      /**< decimation factor. */
+    uint16_t numTaps;               /**< number of coefficients in the filter. */
+    q15_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numTaps.*/
+    q15_t *pState;                   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } riscv_fir_decimate_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR decimator.
+   */
+
+  typedef struct
+  {
+    uint8_t M;                  /**< decimation factor. */
+    uint16_t numTaps;           /**< number of coefficients in the filter. */
+    q31_t *pCoeffs;              /**< points to the coefficient array. The array is of length numTaps.*/
+    q31_t *pState;               /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+
+  } riscv_fir_decimate_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR decimator.
+   */
+
+  typedef struct
+  {
+    uint8_t M;                          /**< decimation factor. */
+    uint16_t numTaps;                   /**< number of coefficients in the filter. */
+    float32_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numTaps.*/
+    float32_t *pState;                   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+
+  } riscv_fir_decimate_instance_f32;
+
+
+
+  /**
+   * @brief Processing function for the floating-point FIR decimator.
+   * @param[in] *S points to an instance of the floating-point FIR decimator structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none
+   */
+
+  void riscv_fir_decimate_f32(
+  const riscv_fir_decimate_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR decimator.
+   * @param[in,out] *S points to an instance of the floating-point FIR decimator structure.
+   * @param[in] numTaps  number of coefficients in the filter.
+   * @param[in] M  decimation factor.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return    The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_LENGTH_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   */
+
+  riscv_status riscv_fir_decimate_init_f32(
+  riscv_fir_decimate_instance_f32 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q15 FIR decimator.
+   * @param[in] *S points to an instance of the Q15 FIR decimator structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none
+   */
+
+  void riscv_fir_decimate_q15(
+  const riscv_fir_decimate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q15 FIR decimator (fast variant) for Cortex-M3 and Cortex-M4.
+   * @param[in] *S points to an instance of the Q15 FIR decimator structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none
+   */
+
+  void riscv_fir_decimate_fast_q15(
+  const riscv_fir_decimate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR decimator.
+   * @param[in,out] *S points to an instance of the Q15 FIR decimator structure.
+   * @param[in] numTaps  number of coefficients in the filter.
+   * @param[in] M  decimation factor.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return    The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_LENGTH_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   */
+
+  riscv_status riscv_fir_decimate_init_q15(
+  riscv_fir_decimate_instance_q15 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR decimator.
+   * @param[in] *S points to an instance of the Q31 FIR decimator structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none
+   */
+
+  void riscv_fir_decimate_q31(
+  const riscv_fir_decimate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR decimator (fast variant) for Cortex-M3 and Cortex-M4.
+   * @param[in] *S points to an instance of the Q31 FIR decimator structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none
+   */
+
+  void riscv_fir_decimate_fast_q31(
+  riscv_fir_decimate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 FIR decimator.
+   * @param[in,out] *S points to an instance of the Q31 FIR decimator structure.
+   * @param[in] numTaps  number of coefficients in the filter.
+   * @param[in] M  decimation factor.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return    The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_LENGTH_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   */
+
+  riscv_status riscv_fir_decimate_init_q31(
+  riscv_fir_decimate_instance_q31 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+
+  /**
+   * @brief Instance structure for the Q15 FIR interpolator.
+   */
+
+  typedef struct
+  {
+    uint8_t L;                      /**< upsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } riscv_fir_interpolate_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR interpolator.
+   */
+
+  typedef struct
+  {
+    uint8_t L;                      /**< upsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q31_t *pCoeffs;                  /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                   /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } riscv_fir_interpolate_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR interpolator.
+   */
+
+  typedef struct
+  {
+    uint8_t L;                     /**< upsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length phaseLength+numTaps-1. */
+  } riscv_fir_interpolate_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 FIR interpolator.
+   * @param[in] *S        points to an instance of the Q15 FIR interpolator structure.
+   * @param[in] *pSrc     points to the block of input data.
+   * @param[out] *pDst    points to the block of output data.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none.
+   */
+
+  void riscv_fir_interpolate_q15(
+  const riscv_fir_interpolate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR interpolator.
+   * @param[in,out] *S        points to an instance of the Q15 FIR interpolator structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+
+  riscv_status riscv_fir_interpolate_init_q15(
+  riscv_fir_interpolate_instance_q15 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR interpolator.
+   * @param[in] *S        points to an instance of the Q15 FIR interpolator structure.
+   * @param[in] *pSrc     points to the block of input data.
+   * @param[out] *pDst    points to the block of output data.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none.
+   */
+
+  void riscv_fir_interpolate_q31(
+  const riscv_fir_interpolate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FIR interpolator.
+   * @param[in,out] *S        points to an instance of the Q31 FIR interpolator structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+
+  riscv_status riscv_fir_interpolate_init_q31(
+  riscv_fir_interpolate_instance_q31 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point FIR interpolator.
+   * @param[in] *S        points to an instance of the floating-point FIR interpolator structure.
+   * @param[in] *pSrc     points to the block of input data.
+   * @param[out] *pDst    points to the block of output data.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none.
+   */
+
+  void riscv_fir_interpolate_f32(
+  const riscv_fir_interpolate_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR interpolator.
+   * @param[in,out] *S        points to an instance of the floating-point FIR interpolator structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+
+  riscv_status riscv_fir_interpolate_init_f32(
+  riscv_fir_interpolate_instance_f32 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 symmetric FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;               /**< number of taps of the filter. */
+    q15_t *pCoeffs;                 /**< points to the first (numTaps+1)/2 taps. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } riscv_fir_sym_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 symmetric FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;               /**< number of taps of the filter. */
+    q31_t *pCoeffs;                 /**< points to the first (numTaps+1)/2 taps. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } riscv_fir_sym_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point symmetric FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;               /**< number of taps of the filter. */
+    float32_t *pCoeffs;             /**< points to the first (numTaps+1)/2 taps. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } riscv_fir_sym_instance_f32;
+
+  /**
+   * @brief  Initialization function for the Q15 symmetric FIR filter.
+   * @param[in,out] *S          points to an instance of the Q15 symmetric FIR structure.
+   * @param[in]     numTaps     number of taps of the filter.
+   * @param[in]     *pCoeffs    points to the first (numTaps+1)/2 taps.
+   * @param[in]     *pState     points to the state buffer of numTaps+blockSize-1 samples.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is 0.
+   */
+  riscv_status riscv_fir_sym_init_q15(
+  riscv_fir_sym_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q15 symmetric FIR filter.
+   * @param[in]  *S          points to an instance of the Q15 symmetric FIR structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of output samples.
+   * @param[in]  blockSize   number of samples to process.
+   */
+  void riscv_fir_sym_q15(
+  const riscv_fir_sym_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 symmetric FIR filter.
+   * @param[in,out] *S          points to an instance of the Q31 symmetric FIR structure.
+   * @param[in]     numTaps     number of taps of the filter.
+   * @param[in]     *pCoeffs    points to the first (numTaps+1)/2 taps.
+   * @param[in]     *pState     points to the state buffer of numTaps+blockSize-1 samples.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is 0.
+   */
+  riscv_status riscv_fir_sym_init_q31(
+  riscv_fir_sym_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q31 symmetric FIR filter.
+   * @param[in]  *S          points to an instance of the Q31 symmetric FIR structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of output samples.
+   * @param[in]  blockSize   number of samples to process.
+   */
+  void riscv_fir_sym_q31(
+  const riscv_fir_sym_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point symmetric FIR filter.
+   * @param[in,out] *S          points to an instance of the floating-point symmetric FIR structure.
+   * @param[in]     numTaps     number of taps of the filter.
+   * @param[in]     *pCoeffs    points to the first (numTaps+1)/2 taps.
+   * @param[in]     *pState     points to the state buffer of numTaps+blockSize-1 samples.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is 0.
+   */
+  riscv_status riscv_fir_sym_init_f32(
+  riscv_fir_sym_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the floating-point symmetric FIR filter.
+   * @param[in]  *S          points to an instance of the floating-point symmetric FIR structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of output samples.
+   * @param[in]  blockSize   number of samples to process.
+   */
+  void riscv_fir_sym_f32(
+  const riscv_fir_sym_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 FIR Hilbert transformer.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;               /**< length of the filter, 4*K-1. */
+    q15_t *pCoeffs;                 /**< points to the (numTaps+1)/4 taps of the first half that are not zero. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } riscv_hilbert_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point FIR Hilbert transformer.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;               /**< length of the filter, 4*K-1. */
+    float32_t *pCoeffs;             /**< points to the (numTaps+1)/4 taps of the first half that are not zero. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } riscv_hilbert_instance_f32;
+
+  /**
+   * @brief  Initialization function for the Q15 FIR Hilbert transformer.
+   * @param[in,out] *S          points to an instance of the Q15 Hilbert transformer structure.
+   * @param[in]     numTaps     length of the filter, 4*K-1.
+   * @param[in]     *pCoeffs    points to the (numTaps+1)/4 taps of the first half that are not zero.
+   * @param[in]     *pState     points to the state buffer of numTaps+blockSize-1 samples.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is not 4*K-1.
+   */
+  riscv_status riscv_hilbert_init_q15(
+  riscv_hilbert_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q15 FIR Hilbert transformer.
+   * @param[in]  *S          points to an instance of the Q15 Hilbert transformer structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of outputs Q.
+   * @param[out] *pReal      points to the block of outputs I, the input delayed by (numTaps-1)/2, or NULL.
+   * @param[in]  blockSize   number of samples to process.
+   */
+  void riscv_hilbert_q15(
+  const riscv_hilbert_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  q15_t * pReal,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Envelope and instantaneous phase of a Q15 signal.
+   * @param[in]  *S          points to an instance of the Q15 Hilbert transformer structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pEnv       points to the block of envelope samples in 2.14 format.
+   * @param[out] *pPhase     points to the block of phases in radians in 2.13 format, or NULL.
+   * @param[in]  blockSize   number of samples to process.
+   */
+  void riscv_hilbert_envelope_q15(
+  const riscv_hilbert_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pEnv,
+  q15_t * pPhase,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR Hilbert transformer.
+   * @param[in,out] *S          points to an instance of the floating-point Hilbert transformer structure.
+   * @param[in]     numTaps     length of the filter, 4*K-1.
+   * @param[in]     *pCoeffs    points to the (numTaps+1)/4 taps of the first half that are not zero.
+   * @param[in]     *pState     points to the state buffer of numTaps+blockSize-1 samples.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is not 4*K-1.
+   */
+  riscv_status riscv_hilbert_init_f32(
+  riscv_hilbert_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the floating-point FIR Hilbert transformer.
+   * @param[in]  *S          points to an instance of the floating-point Hilbert transformer structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of outputs Q.
+   * @param[out] *pReal      points to the block of outputs I, the input delayed by (numTaps-1)/2, or NULL.
+   * @param[in]  blockSize   number of samples to process.
+   */
+  void riscv_hilbert_f32(
+  const riscv_hilbert_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pReal,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Envelope and instantaneous phase of a floating-point signal.
+   * @param[in]  *S          points to an instance of the floating-point Hilbert transformer structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pEnv       points to the block of envelope samples.
+   * @param[out] *pPhase     points to the block of phases in radians, or NULL.
+   * @param[in]  blockSize   number of samples to process.
+   */
+  void riscv_hilbert_envelope_f32(
+  const riscv_hilbert_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pEnv,
+  float32_t * pPhase,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Windowed design of a FIR Hilbert transformer.
+   * @param[in]  numTaps   length of the filter, 4*K-1.
+   * @param[out] *pCoeffs  points to the (numTaps+1)/4 taps of the first half that are not zero.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is not 4*K-1.
+   */
+  riscv_status riscv_hilbert_design_f32(
+  uint16_t numTaps,
+  float32_t * pCoeffs);
+
+  /**
+   * @brief Number of columns of a strip of riscv_image_filter_v_q7() and riscv_image_filter_v_q15().
+   */
+
+#ifndef RISCV_IMAGE_STRIP
+#define RISCV_IMAGE_STRIP 16u
+#endif
+
+  /**
+   * @brief  Integral image of a Q7 image.
+   * @param[in]  *pSrc     points to the image of numRows x numCols pixels.
+   * @param[in]  numRows   number of rows of the image.
+   * @param[in]  numCols   number of columns of the image.
+   * @param[out] *pDst     points to the integral image of (numRows+1) x (numCols+1) words.
+   */
+  void riscv_integral_image_q7(
+  const q7_t * pSrc,
+  uint16_t numRows,
+  uint16_t numCols,
+  q31_t * pDst);
+
+  /**
+   * @brief  Integral image of a Q15 image.
+   * @param[in]  *pSrc     points to the image of numRows x numCols pixels.
+   * @param[in]  numRows   number of rows of the image.
+   * @param[in]  numCols   number of columns of the image.
+   * @param[out] *pDst     points to the integral image of (numRows+1) x (numCols+1) words.
+   */
+  void riscv_integral_image_q15(
+  const q15_t * pSrc,
+  uint16_t numRows,
+  uint16_t numCols,
+  q31_t * pDst);
+
+  /**
+   * @brief  Sum of one box of an image from its integral image.
+   * @param[in]  *pIntegral  points to the integral image of riscv_integral_image_q7() or riscv_integral_image_q15().
+   * @param[in]  numCols     number of columns of the image.
+   * @param[in]  row         top row of the box.
+   * @param[in]  col         left column of the box.
+   * @param[in]  boxRows     height of the box.
+   * @param[in]  boxCols     width of the box.
+   * @return     the sum of the boxRows x boxCols pixels.
+   */
+  static inline q31_t riscv_integral_box_sum(
+  const q31_t * pIntegral,
+  uint16_t numCols,
+  uint16_t row,
+  uint16_t col,
+  uint16_t boxRows,
+  uint16_t boxCols)
+  {
+    uint32_t stride = (uint32_t) numCols + 1u;
+    const q31_t *pTop = pIntegral + (row * stride) + col;
+    const q31_t *pBottom = pTop + (boxRows * stride);
+
+    return ((pBottom[boxCols] - pTop[boxCols]) - (pBottom[0] - pTop[0]));
+  }
+
+  /**
+   * @brief  Sums of all the boxes of one size of an image, from its integral image.
+   * @param[in]  *pIntegral  points to the integral image.
+   * @param[in]  numRows     number of rows of the image.
+   * @param[in]  numCols     number of columns of the image.
+   * @param[in]  boxRows     height of the boxes.
+   * @param[in]  boxCols     width of the boxes.
+   * @param[out] *pDst       points to the (numRows-boxRows+1) x (numCols-boxCols+1) sums.
+   */
+  void riscv_integral_box_q31(
+  const q31_t * pIntegral,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint16_t boxRows,
+  uint16_t boxCols,
+  q31_t * pDst);
+
+  /**
+   * @brief  Horizontal pass along the rows of a separable filter of a Q7 image.
+   * @param[in]  *pSrc       points to the image of numRows x numCols pixels.
+   * @param[in]  numRows     number of rows of the image.
+   * @param[in]  numCols     number of columns of the image.
+   * @param[in]  *pCoeffs    points to the numTaps taps.
+   * @param[in]  numTaps     number of taps.
+   * @param[in]  postShift   right shift of the sums.
+   * @param[out] *pDst       points to the output of numRows x (numCols-numTaps+1) pixels.
+   */
+  void riscv_image_filter_h_q7(
+  const q7_t * pSrc,
+  uint16_t numRows,
+  uint16_t numCols,
+  const q7_t * pCoeffs,
+  uint16_t numTaps,
+  uint8_t postShift,
+  q7_t * pDst);
+
+  /**
+   * @brief  Vertical pass along the columns of a separable filter of a Q7 image.
+   * @param[in]  *pSrc       points to the image of numRows x numCols pixels.
+   * @param[in]  numRows     number of rows of the image.
+   * @param[in]  numCols     number of columns of the image.
+   * @param[in]  *pCoeffs    points to the numTaps taps.
+   * @param[in]  numTaps     number of taps.
+   * @param[in]  postShift   right shift of the sums.
+   * @param[out] *pDst       points to the output of (numRows-numTaps+1) x numCols pixels.
+   */
+  void riscv_image_filter_v_q7(
+  const q7_t * pSrc,
+  uint16_t numRows,
+  uint16_t numCols,
+  const q7_t * pCoeffs,
+  uint16_t numTaps,
+  uint8_t postShift,
+  q7_t * pDst);
+
+  /**
+   * @brief  Horizontal pass along the rows of a separable filter of a Q15 image.
+   * @param[in]  *pSrc       points to the image of numRows x numCols pixels.
+   * @param[in]  numRows     number of rows of the image.
+   * @param[in]  numCols     number of columns of the image.
+   * @param[in]  *pCoeffs    points to the numTaps taps.
+   * @param[in]  numTaps     number of taps.
+   * @param[in]  postShift   right shift of the sums.
+   * @param[out] *pDst       points to the output of numRows x (numCols-numTaps+1) pixels.
+   */
+  void riscv_image_filter_h_q15(
+  const q15_t * pSrc,
+  uint16_t numRows,
+  uint16_t numCols,
+  const q15_t * pCoeffs,
+  uint16_t numTaps,
+  uint8_t postShift,
+  q15_t * pDst);
+
+  /**
+   * @brief  Vertical pass along the columns of a separable filter of a Q15 image.
+   * @param[in]  *pSrc       points to the image of numRows x numCols pixels.
+   * @param[in]  numRows     number of rows of the image.
+   * @param[in]  numCols     number of columns of the image.
+   * @param[in]  *pCoeffs    points to the numTaps taps.
+   * @param[in]  numTaps     number of taps.
+   * @param[in]  postShift   right shift of the sums.
+   * @param[out] *pDst       points to the output of (numRows-numTaps+1) x numCols pixels.
+   */
+  void riscv_image_filter_v_q15(
+  const q15_t * pSrc,
+  uint16_t numRows,
+  uint16_t numCols,
+  const q15_t * pCoeffs,
+  uint16_t numTaps,
+  uint8_t postShift,
+  q15_t * pDst);
+
+  /**
+   * @brief Instance structure for the Q15 half-band FIR decimator and interpolator.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;               /**< length of the half-band filter, 4*K-1. */
+    q15_t *pCoeffs;                 /**< points to the (numTaps+5)/4 taps that are not zero, the first half followed by the center tap. */
+    q15_t *pState;                  /**< points to the state variable array, of the length given by the init function. */
+  } riscv_fir_halfband_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 half-band FIR decimator and interpolator.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;               /**< length of the half-band filter, 4*K-1. */
+    q31_t *pCoeffs;                 /**< points to the (numTaps+5)/4 taps that are not zero, the first half followed by the center tap. */
+    q31_t *pState;                  /**< points to the state variable array, of the length given by the init function. */
+  } riscv_fir_halfband_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point half-band FIR decimator and interpolator.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;               /**< length of the half-band filter, 4*K-1. */
+    float32_t *pCoeffs;             /**< points to the (numTaps+5)/4 taps that are not zero, the first half followed by the center tap. */
+    float32_t *pState;              /**< points to the state variable array, of the length given by the init function. */
+  } riscv_fir_halfband_instance_f32;
+
+  /**
+   * @brief  Initialization function for the Q15 half-band FIR decimator.
+   * @param[in,out] *S          points to an instance of the Q15 half-band FIR structure.
+   * @param[in]     numTaps     length of the half-band filter, 4*K-1.
+   * @param[in]     *pCoeffs    points to the (numTaps+5)/4 taps that are not zero.
+   * @param[in]     *pState     points to the state buffer of numTaps+blockSize-1 samples.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        RISCV_MATH_SUCCESS, RISCV_MATH_ARGUMENT_ERROR if numTaps is not of the form 4*K-1,
+   *                or RISCV_MATH_LENGTH_ERROR if blockSize is odd.
+   */
+  riscv_status riscv_fir_halfband_decimate_init_q15(
+  riscv_fir_halfband_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q15 half-band FIR decimator.
+   * @param[in]  *S          points to an instance of the Q15 half-band FIR structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of blockSize/2 output samples.
+   * @param[in]  blockSize   number of input samples to process, even.
+   */
+  void riscv_fir_halfband_decimate_q15(
+  const riscv_fir_halfband_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 half-band FIR interpolator.
+   * @param[in,out] *S          points to an instance of the Q15 half-band FIR structure.
+   * @param[in]     numTaps     length of the half-band filter, 4*K-1.
+   * @param[in]     *pCoeffs    points to the (numTaps+5)/4 taps that are not zero.
+   * @param[in]     *pState     points to the state buffer of (numTaps+1)/2+blockSize-1 samples.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is not of the form 4*K-1.
+   */
+  riscv_status riscv_fir_halfband_interpolate_init_q15(
+  riscv_fir_halfband_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q15 half-band FIR interpolator.
+   * @param[in]  *S          points to an instance of the Q15 half-band FIR structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of 2*blockSize output samples.
+   * @param[in]  blockSize   number of input samples to process.
+   */
+  void riscv_fir_halfband_interpolate_q15(
+  const riscv_fir_halfband_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 half-band FIR decimator.
+   * @param[in,out] *S          points to an instance of the Q31 half-band FIR structure.
+   * @param[in]     numTaps     length of the half-band filter, 4*K-1.
+   * @param[in]     *pCoeffs    points to the (numTaps+5)/4 taps that are not zero.
+   * @param[in]     *pState     points to the state buffer of numTaps+blockSize-1 samples.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        RISCV_MATH_SUCCESS, RISCV_MATH_ARGUMENT_ERROR if numTaps is not of the form 4*K-1,
+   *                or RISCV_MATH_LENGTH_ERROR if blockSize is odd.
+   */
+  riscv_status riscv_fir_halfband_decimate_init_q31(
+  riscv_fir_halfband_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q31 half-band FIR decimator.
+   * @param[in]  *S          points to an instance of the Q31 half-band FIR structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of blockSize/2 output samples.
+   * @param[in]  blockSize   number of input samples to process, even.
+   */
+  void riscv_fir_halfband_decimate_q31(
+  const riscv_fir_halfband_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 half-band FIR interpolator.
+   * @param[in,out] *S          points to an instance of the Q31 half-band FIR structure.
+   * @param[in]     numTaps     length of the half-band filter, 4*K-1.
+   * @param[in]     *pCoeffs    points to the (numTaps+5)/4 taps that are not zero.
+   * @param[in]     *pState     points to the state buffer of (numTaps+1)/2+blockSize-1 samples.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is not of the form 4*K-1.
+   */
+  riscv_status riscv_fir_halfband_interpolate_init_q31(
+  riscv_fir_halfband_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q31 half-band FIR interpolator.
+   * @param[in]  *S          points to an instance of the Q31 half-band FIR structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of 2*blockSize output samples.
+   * @param[in]  blockSize   number of input samples to process.
+   */
+  void riscv_fir_halfband_interpolate_q31(
+  const riscv_fir_halfband_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point half-band FIR decimator.
+   * @param[in,out] *S          points to an instance of the floating-point half-band FIR structure.
+   * @param[in]     numTaps     length of the half-band filter, 4*K-1.
+   * @param[in]     *pCoeffs    points to the (numTaps+5)/4 taps that are not zero.
+   * @param[in]     *pState     points to the state buffer of numTaps+blockSize-1 samples.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        RISCV_MATH_SUCCESS, RISCV_MATH_ARGUMENT_ERROR if numTaps is not of the form 4*K-1,
+   *                or RISCV_MATH_LENGTH_ERROR if blockSize is odd.
+   */
+  riscv_status riscv_fir_halfband_decimate_init_f32(
+  riscv_fir_halfband_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the floating-point half-band FIR decimator.
+   * @param[in]  *S          points to an instance of the floating-point half-band FIR structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of blockSize/2 output samples.
+   * @param[in]  blockSize   number of input samples to process, even.
+   */
+  void riscv_fir_halfband_decimate_f32(
+  const riscv_fir_halfband_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point half-band FIR interpolator.
+   * @param[in,out] *S          points to an instance of the floating-point half-band FIR structure.
+   * @param[in]     numTaps     length of the half-band filter, 4*K-1.
+   * @param[in]     *pCoeffs    points to the (numTaps+5)/4 taps that are not zero.
+   * @param[in]     *pState     points to the state buffer of (numTaps+1)/2+blockSize-1 samples.
+   * @param[in]     blockSize   number of input samples to process per call.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is not of the form 4*K-1.
+   */
+  riscv_status riscv_fir_halfband_interpolate_init_f32(
+  riscv_fir_halfband_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the floating-point half-band FIR interpolator.
+   * @param[in]  *S          points to an instance of the floating-point half-band FIR structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of 2*blockSize output samples.
+   * @param[in]  blockSize   number of input samples to process.
+   */
+  void riscv_fir_halfband_interpolate_f32(
+  const riscv_fir_halfband_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Largest number of allpass coefficients of the IIR half-band filters.
+   */
+
+#ifndef RISCV_IIR_HALFBAND_MAX_COEFS
+#define RISCV_IIR_HALFBAND_MAX_COEFS 16u
+#endif
+
+  /**
+   * @brief Instance structure for the Q15 IIR half-band decimator and interpolator.
+   */
+
+  typedef struct
+  {
+    uint8_t numCoefs;               /**< number of first-order allpass sections of both branches. */
+    uint8_t numChannels;            /**< 1, or 2 for interleaved stereo. */
+    const q15_t *pCoeffs;           /**< points to the numCoefs allpass coefficients, 0 to 1, coefficient k in branch k%2. */
+    q15_t *pState;                  /**< points to the state variable array of numChannels*(numCoefs+2) samples. */
+  } riscv_iir_halfband_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point IIR half-band decimator and interpolator.
+   */
+
+  typedef struct
+  {
+    uint8_t numCoefs;               /**< number of first-order allpass sections of both branches. */
+    uint8_t numChannels;            /**< 1, or 2 for interleaved stereo. */
+    const float32_t *pCoeffs;       /**< points to the numCoefs allpass coefficients, 0 to 1, coefficient k in branch k%2. */
+    float32_t *pState;              /**< points to the state variable array of numChannels*(numCoefs+2) samples. */
+  } riscv_iir_halfband_instance_f32;
+
+  /**
+   * @brief  Allpass coefficients of an IIR half-band filter.
+   * @param[in]  numCoefs     number of coefficients, 1 to RISCV_IIR_HALFBAND_MAX_COEFS.
+   * @param[in]  transition   width of the transition band as a fraction of the input rate, 0 to 0.5.
+   * @param[out] *pCoeffs     points to the numCoefs coefficients.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if an argument is out of range.
+   */
+  riscv_status riscv_iir_halfband_design_f32(
+  uint8_t numCoefs,
+  float32_t transition,
+  float32_t * pCoeffs);
+
+  /**
+   * @brief  Initialization function for the Q15 IIR half-band decimator and interpolator.
+   * @param[in,out] *S            points to an instance of the Q15 IIR half-band structure.
+   * @param[in]     numCoefs      number of allpass coefficients, 1 to RISCV_IIR_HALFBAND_MAX_COEFS.
+   * @param[in]     numChannels   1, or 2 for interleaved stereo.
+   * @param[in]     *pCoeffs      points to the numCoefs coefficients.
+   * @param[in]     *pState       points to the state buffer of numChannels*(numCoefs+2) samples.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numCoefs or numChannels is out of range.
+   */
+  riscv_status riscv_iir_halfband_init_q15(
+  riscv_iir_halfband_instance_q15 * S,
+  uint8_t numCoefs,
+  uint8_t numChannels,
+  const q15_t * pCoeffs,
+  q15_t * pState);
+
+  /**
+   * @brief  Processing function for the Q15 IIR half-band decimator.
+   * @param[in]  *S          points to an instance of the Q15 IIR half-band structure.
+   * @param[in]  *pSrc       points to the block of input frames.
+   * @param[out] *pDst       points to the block of blockSize/2 output frames.
+   * @param[in]  blockSize   number of input frames to process, even.
+   */
+  void riscv_iir_halfband_decimate_q15(
+  const riscv_iir_halfband_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q15 IIR half-band interpolator.
+   * @param[in]  *S          points to an instance of the Q15 IIR half-band structure.
+   * @param[in]  *pSrc       points to the block of input frames.
+   * @param[out] *pDst       points to the block of 2*blockSize output frames.
+   * @param[in]  blockSize   number of input frames to process.
+   */
+  void riscv_iir_halfband_interpolate_q15(
+  const riscv_iir_halfband_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point IIR half-band decimator and interpolator.
+   * @param[in,out] *S            points to an instance of the floating-point IIR half-band structure.
+   * @param[in]     numCoefs      number of allpass coefficients, 1 to RISCV_IIR_HALFBAND_MAX_COEFS.
+   * @param[in]     numChannels   1, or 2 for interleaved stereo.
+   * @param[in]     *pCoeffs      points to the numCoefs coefficients.
+   * @param[in]     *pState       points to the state buffer of numChannels*(numCoefs+2) samples.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numCoefs or numChannels is out of range.
+   */
+  riscv_status riscv_iir_halfband_init_f32(
+  riscv_iir_halfband_instance_f32 * S,
+  uint8_t numCoefs,
+  uint8_t numChannels,
+  const float32_t * pCoeffs,
+  float32_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point IIR half-band decimator.
+   * @param[in]  *S          points to an instance of the floating-point IIR half-band structure.
+   * @param[in]  *pSrc       points to the block of input frames.
+   * @param[out] *pDst       points to the block of blockSize/2 output frames.
+   * @param[in]  blockSize   number of input frames to process, even.
+   */
+  void riscv_iir_halfband_decimate_f32(
+  const riscv_iir_halfband_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the floating-point IIR half-band interpolator.
+   * @param[in]  *S          points to an instance of the floating-point IIR half-band structure.
+   * @param[in]  *pSrc       points to the block of input frames.
+   * @param[out] *pDst       points to the block of 2*blockSize output frames.
+   * @param[in]  blockSize   number of input frames to process.
+   */
+  void riscv_iir_halfband_interpolate_f32(
+  const riscv_iir_halfband_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Highest order of the CIC filters.
+   */
+
+#ifndef RISCV_CIC_MAX_STAGES
+#define RISCV_CIC_MAX_STAGES 5u
+#endif
+
+  /**
+   * @brief Instance structure for the Q15 CIC decimator.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;              /**< order N, number of integrators and of combs. */
+    uint8_t diffDelay;              /**< differential delay M of the combs. */
+    uint16_t R;                     /**< decimation factor. */
+    uint16_t phase;                 /**< inputs since the last output. */
+    uint8_t shift;                  /**< bit growth ceil(log2((R*M)^N)), the right shift of the outputs. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length numStages*(1+diffDelay). */
+  } riscv_cic_decimate_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 CIC decimator.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;              /**< order N, number of integrators and of combs. */
+    uint8_t diffDelay;              /**< differential delay M of the combs. */
+    uint16_t R;                     /**< decimation factor. */
+    uint16_t phase;                 /**< inputs since the last output. */
+    uint8_t shift;                  /**< bit growth ceil(log2((R*M)^N)), the right shift of the outputs. */
+    q63_t *pState;                  /**< points to the state variable array. The array is of length numStages*(1+diffDelay). */
+  } riscv_cic_decimate_instance_q31;
+
+  /**
+   * @brief Instance structure for the CIC decimator of PDM bitstreams.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;              /**< order N, number of integrators and of combs. */
+    uint8_t diffDelay;              /**< differential delay M of the combs. */
+    uint16_t R;                     /**< decimation factor in bits, a multiple of 8. */
+    uint16_t phase;                 /**< input bytes since the last output. */
+    uint8_t shift;                  /**< bit growth ceil(log2((R*M)^N)). */
+    const uint16_t *pLut;           /**< points to the tables of the first factor, 256*numStages values. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length numStages*(2+diffDelay)-1. */
+  } riscv_cic_decimate_pdm_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q15 CIC interpolator.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;              /**< order N, number of combs and of integrators. */
+    uint8_t diffDelay;              /**< differential delay M of the combs. */
+    uint16_t R;                     /**< interpolation factor. */
+    uint8_t shift;                  /**< bit growth ceil(log2((R*M)^N/R)), the right shift of the outputs. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length numStages*(1+diffDelay). */
+  } riscv_cic_interpolate_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 CIC interpolator.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;              /**< order N, number of combs and of integrators. */
+    uint8_t diffDelay;              /**< differential delay M of the combs. */
+    uint16_t R;                     /**< interpolation factor. */
+    uint8_t shift;                  /**< bit growth ceil(log2((R*M)^N/R)), the right shift of the outputs. */
+    q63_t *pState;                  /**< points to the state variable array. The array is of length numStages*(1+diffDelay). */
+  } riscv_cic_interpolate_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q15 CIC decimator.
+   * @param[in,out] *S          points to an instance of the Q15 CIC decimator structure.
+   * @param[in]     numStages   order N of the filter, 1 to RISCV_CIC_MAX_STAGES.
+   * @param[in]     diffDelay   differential delay M of the combs, 1 or 2.
+   * @param[in]     R           decimation factor.
+   * @param[in]     *pState     points to the state buffer of <code>numStages*(1+diffDelay)</code> words.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if a parameter is out of range or the
+   *                registers would grow by more than 16 bits.
+   */
+  riscv_status riscv_cic_decimate_init_q15(
+  riscv_cic_decimate_instance_q15 * S,
+  uint8_t numStages,
+  uint8_t diffDelay,
+  uint16_t R,
+  q31_t * pState);
+
+  /**
+   * @brief  Processing function for the Q15 CIC decimator.
+   * @param[in,out] *S          points to an instance of the Q15 CIC decimator structure.
+   * @param[in]     *pSrc       points to the block of input samples.
+   * @param[out]    *pDst       points to the block of output samples, room for (blockSize + R - 1) / R values.
+   * @param[in]     blockSize   number of input samples to process.
+   * @return        number of output samples written.
+   */
+  uint32_t riscv_cic_decimate_q15(
+  riscv_cic_decimate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 CIC decimator.
+   * @param[in,out] *S          points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     numStages   order N of the filter, 1 to RISCV_CIC_MAX_STAGES.
+   * @param[in]     diffDelay   differential delay M of the combs, 1 or 2.
+   * @param[in]     R           decimation factor.
+   * @param[in]     *pState     points to the state buffer of <code>numStages*(1+diffDelay)</code> words.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if a parameter is out of range or the
+   *                registers would grow by more than 32 bits.
+   */
+  riscv_status riscv_cic_decimate_init_q31(
+  riscv_cic_decimate_instance_q31 * S,
+  uint8_t numStages,
+  uint8_t diffDelay,
+  uint16_t R,
+  q63_t * pState);
+
+  /**
+   * @brief  Processing function for the Q31 CIC decimator.
+   * @param[in,out] *S          points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     *pSrc       points to the block of input samples.
+   * @param[out]    *pDst       points to the block of output samples, room for (blockSize + R - 1) / R values.
+   * @param[in]     blockSize   number of input samples to process.
+   * @return        number of output samples written.
+   */
+  uint32_t riscv_cic_decimate_q31(
+  riscv_cic_decimate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the CIC decimator of PDM bitstreams.
+   * @param[in,out] *S          points to an instance of the PDM CIC decimator structure.
+   * @param[in]     numStages   order N of the filter, 1 to RISCV_CIC_MAX_STAGES.
+   * @param[in]     diffDelay   differential delay M of the combs, 1 or 2.
+   * @param[in]     R           decimation factor in bits, a multiple of 8.
+   * @param[out]    *pLut       points to the tables of <code>256*numStages</code> values the function fills.
+   * @param[in]     *pState     points to the state buffer of <code>numStages*(2+diffDelay)-1</code> words.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if a parameter is out of range or the
+   *                gain <code>(R*M)^N</code> exceeds 2^31.
+   */
+  riscv_status riscv_cic_decimate_pdm_init_q15(
+  riscv_cic_decimate_pdm_instance_q15 * S,
+  uint8_t numStages,
+  uint8_t diffDelay,
+  uint16_t R,
+  uint16_t * pLut,
+  q31_t * pState);
+
+  /**
+   * @brief  Processing function for the CIC decimator of PDM bitstreams.
+   * @param[in,out] *S          points to an instance of the PDM CIC decimator structure.
+   * @param[in]     *pSrc       points to the bitstream, eight samples per byte with the earliest in bit 7.
+   * @param[out]    *pDst       points to the block of output samples, room for (8*numBytes + R - 1) / R values.
+   * @param[in]     numBytes    number of input bytes to process.
+   * @return        number of output samples written.
+   */
+  uint32_t riscv_cic_decimate_pdm_q15(
+  riscv_cic_decimate_pdm_instance_q15 * S,
+  const uint8_t * pSrc,
+  q15_t * pDst,
+  uint32_t numBytes);
+
+  /**
+   * @brief  Initialization function for the Q15 CIC interpolator.
+   * @param[in,out] *S          points to an instance of the Q15 CIC interpolator structure.
+   * @param[in]     numStages   order N of the filter, 1 to RISCV_CIC_MAX_STAGES.
+   * @param[in]     diffDelay   differential delay M of the combs, 1 or 2.
+   * @param[in]     R           interpolation factor.
+   * @param[in]     *pState     points to the state buffer of <code>numStages*(1+diffDelay)</code> words.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if a parameter is out of range or the
+   *                registers would grow by more than 16 bits.
+   */
+  riscv_status riscv_cic_interpolate_init_q15(
+  riscv_cic_interpolate_instance_q15 * S,
+  uint8_t numStages,
+  uint8_t diffDelay,
+  uint16_t R,
+  q31_t * pState);
+
+  /**
+   * @brief  Processing function for the Q15 CIC interpolator.
+   * @param[in]  *S          points to an instance of the Q15 CIC interpolator structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of blockSize*R output samples.
+   * @param[in]  blockSize   number of input samples to process.
+   */
+  void riscv_cic_interpolate_q15(
+  const riscv_cic_interpolate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 CIC interpolator.
+   * @param[in,out] *S          points to an instance of the Q31 CIC interpolator structure.
+   * @param[in]     numStages   order N of the filter, 1 to RISCV_CIC_MAX_STAGES.
+   * @param[in]     diffDelay   differential delay M of the combs, 1 or 2.
+   * @param[in]     R           interpolation factor.
+   * @param[in]     *pState     points to the state buffer of <code>numStages*(1+diffDelay)</code> words.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if a parameter is out of range or the
+   *                registers would grow by more than 32 bits.
+   */
+  riscv_status riscv_cic_interpolate_init_q31(
+  riscv_cic_interpolate_instance_q31 * S,
+  uint8_t numStages,
+  uint8_t diffDelay,
+  uint16_t R,
+  q63_t * pState);
+
+  /**
+   * @brief  Processing function for the Q31 CIC interpolator.
+   * @param[in]  *S          points to an instance of the Q31 CIC interpolator structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to the block of blockSize*R output samples.
+   * @param[in]  blockSize   number of input samples to process.
+   */
+  void riscv_cic_interpolate_q31(
+  const riscv_cic_interpolate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 polyphase analysis filter bank.
+   */
+
+  typedef struct
+  {
+    uint16_t numChannels;           /**< number of channels M, the length of the transform. */
+    uint16_t numTaps;               /**< length of the prototype filter, a multiple of M. */
+    q15_t *pCoeffs;                 /**< points to the taps of the prototype filter. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length numTaps-M+blockSize. */
+    const riscv_cfft_instance_q15 *pCfft;/**< points to the transform instance of length M. */
+  } riscv_pfb_analysis_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q15 polyphase synthesis filter bank.
+   */
+
+  typedef struct
+  {
+    uint16_t numChannels;           /**< number of channels M, the length of the transform. */
+    uint16_t numTaps;               /**< length of the prototype filter, a multiple of M. */
+    uint16_t head;                  /**< slot of the latest block in the state array. */
+    q15_t *pCoeffs;                 /**< points to the taps of the prototype filter. */
+    q15_t *pState;                  /**< points to the branch inputs of the last numTaps/M blocks. The array is of length numTaps. */
+    q15_t *pScratch;                /**< points to the transform buffer of 2*M values. */
+    const riscv_cfft_instance_q15 *pCfft;/**< points to the transform instance of length M. */
+  } riscv_pfb_synthesis_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point polyphase analysis filter bank.
+   */
+
+  typedef struct
+  {
+    uint16_t numChannels;           /**< number of channels M, the length of the transform. */
+    uint16_t numTaps;               /**< length of the prototype filter, a multiple of M. */
+    float32_t *pCoeffs;             /**< points to the taps of the prototype filter. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length numTaps-M+blockSize. */
+    const riscv_cfft_instance_f32 *pCfft;/**< points to the transform instance of length M. */
+  } riscv_pfb_analysis_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point polyphase synthesis filter bank.
+   */
+
+  typedef struct
+  {
+    uint16_t numChannels;           /**< number of channels M, the length of the transform. */
+    uint16_t numTaps;               /**< length of the prototype filter, a multiple of M. */
+    uint16_t head;                  /**< slot of the latest block in the state array. */
+    float32_t *pCoeffs;             /**< points to the taps of the prototype filter. */
+    float32_t *pState;              /**< points to the branch inputs of the last numTaps/M blocks. The array is of length numTaps. */
+    float32_t *pScratch;            /**< points to the transform buffer of 2*M values. */
+    const riscv_cfft_instance_f32 *pCfft;/**< points to the transform instance of length M. */
+  } riscv_pfb_synthesis_instance_f32;
+
+  /**
+   * @brief  Initialization function for the Q15 polyphase analysis filter bank.
+   * @param[in,out] *S          points to an instance of the Q15 analysis filter bank structure.
+   * @param[in]     *pCfft      points to the transform instance, its length is the number of channels M.
+   * @param[in]     numTaps     length of the prototype filter, a multiple of M.
+   * @param[in]     *pCoeffs    points to the numTaps taps of the prototype filter.
+   * @param[in]     *pState     points to the state buffer of numTaps-M+blockSize samples.
+   * @param[in]     blockSize   number of input samples to process per call, a multiple of M.
+   * @return        RISCV_MATH_SUCCESS, RISCV_MATH_ARGUMENT_ERROR if numTaps is not a nonzero multiple of M,
+   *                or RISCV_MATH_LENGTH_ERROR if blockSize is not a multiple of M.
+   */
+  riscv_status riscv_pfb_analysis_init_q15(
+  riscv_pfb_analysis_instance_q15 * S,
+  const riscv_cfft_instance_q15 * pCfft,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q15 polyphase analysis filter bank.
+   * @param[in]  *S          points to an instance of the Q15 analysis filter bank structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to blockSize/M vectors of M complex channel values.
+   * @param[in]  blockSize   number of input samples to process, a multiple of M.
+   */
+  void riscv_pfb_analysis_q15(
+  const riscv_pfb_analysis_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 polyphase synthesis filter bank.
+   * @param[in,out] *S          points to an instance of the Q15 synthesis filter bank structure.
+   * @param[in]     *pCfft      points to the transform instance, its length is the number of channels M.
+   * @param[in]     numTaps     length of the prototype filter, a multiple of M.
+   * @param[in]     *pCoeffs    points to the numTaps taps of the prototype filter.
+   * @param[in]     *pState     points to the state buffer of numTaps values.
+   * @param[in]     *pScratch   points to a scratch buffer of 2*M values.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is not a nonzero multiple of M.
+   */
+  riscv_status riscv_pfb_synthesis_init_q15(
+  riscv_pfb_synthesis_instance_q15 * S,
+  const riscv_cfft_instance_q15 * pCfft,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  q15_t * pScratch);
+
+  /**
+   * @brief  Processing function for the Q15 polyphase synthesis filter bank.
+   * @param[in,out] *S          points to an instance of the Q15 synthesis filter bank structure.
+   * @param[in]     *pSrc       points to blockSize/M vectors of M complex channel values.
+   * @param[out]    *pDst       points to the block of output samples.
+   * @param[in]     blockSize   number of output samples to compute, a multiple of M.
+   */
+  void riscv_pfb_synthesis_q15(
+  riscv_pfb_synthesis_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point polyphase analysis filter bank.
+   * @param[in,out] *S          points to an instance of the floating-point analysis filter bank structure.
+   * @param[in]     *pCfft      points to the transform instance, its length is the number of channels M.
+   * @param[in]     numTaps     length of the prototype filter, a multiple of M.
+   * @param[in]     *pCoeffs    points to the numTaps taps of the prototype filter.
+   * @param[in]     *pState     points to the state buffer of numTaps-M+blockSize samples.
+   * @param[in]     blockSize   number of input samples to process per call, a multiple of M.
+   * @return        RISCV_MATH_SUCCESS, RISCV_MATH_ARGUMENT_ERROR if numTaps is not a nonzero multiple of M,
+   *                or RISCV_MATH_LENGTH_ERROR if blockSize is not a multiple of M.
+   */
+  riscv_status riscv_pfb_analysis_init_f32(
+  riscv_pfb_analysis_instance_f32 * S,
+  const riscv_cfft_instance_f32 * pCfft,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the floating-point polyphase analysis filter bank.
+   * @param[in]  *S          points to an instance of the floating-point analysis filter bank structure.
+   * @param[in]  *pSrc       points to the block of input samples.
+   * @param[out] *pDst       points to blockSize/M vectors of M complex channel values.
+   * @param[in]  blockSize   number of input samples to process, a multiple of M.
+   */
+  void riscv_pfb_analysis_f32(
+  const riscv_pfb_analysis_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point polyphase synthesis filter bank.
+   * @param[in,out] *S          points to an instance of the floating-point synthesis filter bank structure.
+   * @param[in]     *pCfft      points to the transform instance, its length is the number of channels M.
+   * @param[in]     numTaps     length of the prototype filter, a multiple of M.
+   * @param[in]     *pCoeffs    points to the numTaps taps of the prototype filter.
+   * @param[in]     *pState     points to the state buffer of numTaps values.
+   * @param[in]     *pScratch   points to a scratch buffer of 2*M values.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is not a nonzero multiple of M.
+   */
+  riscv_status riscv_pfb_synthesis_init_f32(
+  riscv_pfb_synthesis_instance_f32 * S,
+  const riscv_cfft_instance_f32 * pCfft,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pScratch);
+
+  /**
+   * @brief  Processing function for the floating-point polyphase synthesis filter bank.
+   * @param[in,out] *S          points to an instance of the floating-point synthesis filter bank structure.
+   * @param[in]     *pSrc       points to blockSize/M vectors of M complex channel values.
+   * @param[out]    *pDst       points to the block of output samples.
+   * @param[in]     blockSize   number of output samples to compute, a multiple of M.
+   */
+  void riscv_pfb_synthesis_f32(
+  riscv_pfb_synthesis_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 FIR sample rate converter.
+   */
+
+  typedef struct
+  {
+    uint8_t L;                      /**< upsample factor. */
+    uint8_t M;                      /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q15_t *pCoeffs;               /**< points to the polyphase coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } riscv_fir_resample_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR sample rate converter.
+   */
+
+  typedef struct
+  {
+    uint8_t L;                      /**< upsample factor. */
+    uint8_t M;                      /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q31_t *pCoeffs;               /**< points to the polyphase coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } riscv_fir_resample_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR sample rate converter.
+   */
+
+  typedef struct
+  {
+    uint8_t L;                      /**< upsample factor. */
+    uint8_t M;                      /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    float32_t *pCoeffs;           /**< points to the polyphase coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;            /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } riscv_fir_resample_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 FIR sample rate converter.
+   * @param[in]  *S         points to an instance of the Q15 FIR sample rate converter structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of <code>blockSize*L/M</code> output values.
+   * @param[in]  blockSize  number of input samples to process per call.
+   * @return none.
+   */
+
+  void riscv_fir_resample_q15(
+  const riscv_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR sample rate converter.
+   * @param[in,out] *S             points to an instance of the Q15 FIR sample rate converter structure.
+   * @param[in]     L              upsample factor.
+   * @param[in]     M              downsample factor.
+   * @param[in]     numTaps        number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs       points to the filter coefficients, in the order of riscv_fir_interpolate_init_q15().
+   * @param[out]    *pPhaseCoeffs  points to the buffer that receives the polyphase coefficients.
+   * @param[in]     *pState        points to the state buffer.
+   * @param[in]     blockSize      number of input samples to process per call.
+   * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful, RISCV_MATH_ARGUMENT_ERROR if
+   * <code>L</code> or <code>M</code> is 0, or RISCV_MATH_LENGTH_ERROR if <code>numTaps</code> is not a nonzero multiple
+   * of <code>L</code> or <code>blockSize*L</code> is not a multiple of <code>M</code>.
+   */
+
+  riscv_status riscv_fir_resample_init_q15(
+  riscv_fir_resample_instance_q15 * S,
+  uint8_t L,
+  uint8_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pPhaseCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR sample rate converter.
+   * @param[in]  *S         points to an instance of the Q31 FIR sample rate converter structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of <code>blockSize*L/M</code> output values.
+   * @param[in]  blockSize  number of input samples to process per call.
+   * @return none.
+   */
+
+  void riscv_fir_resample_q31(
+  const riscv_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 FIR sample rate converter.
+   * @param[in,out] *S             points to an instance of the Q31 FIR sample rate converter structure.
+   * @param[in]     L              upsample factor.
+   * @param[in]     M              downsample factor.
+   * @param[in]     numTaps        number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs       points to the filter coefficients, in the order of riscv_fir_interpolate_init_q31().
+   * @param[out]    *pPhaseCoeffs  points to the buffer that receives the polyphase coefficients.
+   * @param[in]     *pState        points to the state buffer.
+   * @param[in]     blockSize      number of input samples to process per call.
+   * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful, RISCV_MATH_ARGUMENT_ERROR if
+   * <code>L</code> or <code>M</code> is 0, or RISCV_MATH_LENGTH_ERROR if <code>numTaps</code> is not a nonzero multiple
+   * of <code>L</code> or <code>blockSize*L</code> is not a multiple of <code>M</code>.
+   */
+
+  riscv_status riscv_fir_resample_init_q31(
+  riscv_fir_resample_instance_q31 * S,
+  uint8_t L,
+  uint8_t M,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pPhaseCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point FIR sample rate converter.
+   * @param[in]  *S         points to an instance of the floating-point FIR sample rate converter structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of <code>blockSize*L/M</code> output values.
+   * @param[in]  blockSize  number of input samples to process per call.
+   * @return none.
+   */
+
+  void riscv_fir_resample_f32(
+  const riscv_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR sample rate converter.
+   * @param[in,out] *S             points to an instance of the floating-point FIR sample rate converter structure.
+   * @param[in]     L              upsample factor.
+   * @param[in]     M              downsample factor.
+   * @param[in]     numTaps        number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs       points to the filter coefficients, in the order of riscv_fir_interpolate_init_f32().
+   * @param[out]    *pPhaseCoeffs  points to the buffer that receives the polyphase coefficients.
+   * @param[in]     *pState        points to the state buffer.
+   * @param[in]     blockSize      number of input samples to process per call.
+   * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful, RISCV_MATH_ARGUMENT_ERROR if
+   * <code>L</code> or <code>M</code> is 0, or RISCV_MATH_LENGTH_ERROR if <code>numTaps</code> is not a nonzero multiple
+   * of <code>L</code> or <code>blockSize*L</code> is not a multiple of <code>M</code>.
+   */
+
+  riscv_status riscv_fir_resample_init_f32(
+  riscv_fir_resample_instance_f32 * S,
+  uint8_t L,
+  uint8_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pPhaseCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
+
+  } riscv_biquad_cas_df1_32x64_ins_q31;
+
+
+  /**
+   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_biquad_cas_df1_32x64_q31(
+  const riscv_biquad_cas_df1_32x64_ins_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void riscv_biquad_cas_df1_32x64_init_q31(
+  riscv_biquad_cas_df1_32x64_ins_q31 * S,
+  uint8_t numStages,
+  q31_t * pCoeffs,
+  q63_t * pState,
+  uint8_t postShift);
+
+
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } riscv_biquad_cascade_df2T_instance_f32;
+
+
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } riscv_biquad_cascade_stereo_df2T_instance_f32;
+
+
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float64_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float64_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } riscv_biquad_cascade_df2T_instance_f64;
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_biquad_cascade_df2T_f32(
+  const riscv_biquad_cascade_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Floating-point transposed direct form II Biquad cascade filter streamed from L2 through tiles in L1.
+   * @param[in]  *D         points to the DMA hook.
+   * @param[in]  *S         points to an instance of the floating-point transposed direct form II Biquad cascade filter structure.
+   * @param[in]  *pSrc      points to the input samples in L2.
+   * @param[out] *pDst      points to the output samples in L2, may be <code>pSrc</code>.
+   * @param[in]  length     number of samples to process.
+   * @param[in]  tileSize   number of samples processed per tile.
+   * @param[in]  *pL1       points to a buffer of <code>4*tileSize</code> samples in L1.
+   * @return none.
+   */
+
+  void riscv_biquad_cascade_df2T_stream_f32(
+  const riscv_dma_instance * D,
+  const riscv_biquad_cascade_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t length,
+  uint32_t tileSize,
+  float32_t * pL1);
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. 2 channels
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_biquad_cascade_stereo_df2T_f32(
+  const riscv_biquad_cascade_stereo_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_biquad_cascade_df2T_f64(
+  const riscv_biquad_cascade_df2T_instance_f64 * S,
+  float64_t * pSrc,
+  float64_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
+   */
+
+  void riscv_biquad_cascade_df2T_init_f32(
+  riscv_biquad_cascade_df2T_instance_f32 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+  /**
+   * @brief  Filters one sample through the floating-point transposed direct form II Biquad cascade filter, for interrupt handlers.
+   * @param[in,out] *S   points to an instance of the filter data structure.
+   * @param[in]     in   input sample.
+   * @return        output sample.
+   *
+   * \par
+   * Runs the stages of riscv_biquad_cascade_df2T_f32() on one sample without its block loops, the state
+   * of a stage is read and written once per call.
+   */
+
+  static inline float32_t riscv_biquad_df2T_sample_f32(
+  const riscv_biquad_cascade_df2T_instance_f32 * S,
+  float32_t in)
+  {
+    const float32_t *pCoeffs = S->pCoeffs;
+    float32_t *pState = S->pState;
+    float32_t out, d1, d2;
+    uint32_t stage;
+
+    for (stage = S->numStages; stage > 0u; stage--)
+    {
+      d1 = pState[0];
+      d2 = pState[1];
+
+      /* y[n] = b0 * x[n] + d1, d1 = b1 * x[n] + a1 * y[n] + d2, d2 = b2 * x[n] + a2 * y[n] */
+      out = (pCoeffs[0] * in) + d1;
+      pState[0] = (pCoeffs[1] * in) + (pCoeffs[3] * out) + d2;
+      pState[1] = (pCoeffs[2] * in) + (pCoeffs[4] * out);
+
+      in = out;
+      pCoeffs += 5;
+      pState += 2;
+    }
+
+    return (in);
+  }
+
+  /**
+   * @brief Instance structure for the floating-point parallel-form IIR filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of second order sections. */
+    float32_t direct;          /**< direct gain d0. */
+    const float32_t *pCoeffs;  /**< points to the coefficients {b0, b1, a1, a2} of every section, 4*numStages values. */
+    float32_t *pState;         /**< points to the states {d1, d2} of every section, 2*numStages values. */
+  } riscv_biquad_parallel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 parallel-form IIR filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of second order sections. */
+    int8_t postShift;          /**< additional shift, in bits, applied to the accumulators. */
+    q15_t direct;              /**< direct gain d0, scaled as the coefficients. */
+    const q15_t *pCoeffs;      /**< points to the coefficients {b0, b1, a1, a2} of every section, 4*numStages values. */
+    q15_t *pState;             /**< points to {x[n-1], 0} and the states {y[n-1], y[n-2]} of every section, 2*numStages+2 values. */
+  } riscv_biquad_parallel_instance_q15;
+
+  /**
+   * @brief  Converts the coefficients of a biquad cascade to the parallel form.
+   * @param[in]   *pCascade   points to the <code>5*numStages</code> coefficients of the cascade.
+   * @param[in]   numStages   number of stages.
+   * @param[out]  *pCoeffs    points to the <code>4*numStages</code> coefficients of the sections.
+   * @param[out]  *pDirect    points to the direct gain.
+   * @return      RISCV_MATH_SUCCESS, RISCV_MATH_ARGUMENT_ERROR or RISCV_MATH_SINGULAR.
+   */
+
+  riscv_status riscv_biquad_parallel_convert_f32(
+  const float32_t * pCascade,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pDirect);
+
+  /**
+   * @brief  Initialization function for the floating-point parallel-form IIR filter.
+   * @param[out]    *S          points to an instance of the floating-point parallel-form structure.
+   * @param[in]     numStages   number of second order sections.
+   * @param[in]     *pCoeffs    points to the coefficients of the sections.
+   * @param[in]     direct      direct gain.
+   * @param[in]     *pState     points to the state buffer of <code>2*numStages</code> values.
+   * @return none.
+   */
+
+  void riscv_biquad_parallel_init_f32(
+  riscv_biquad_parallel_instance_f32 * S,
+  uint8_t numStages,
+  const float32_t * pCoeffs,
+  float32_t direct,
+  float32_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point parallel-form IIR filter.
+   * @param[in]     *S         points to an instance of the floating-point parallel-form structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data, not overlapping <code>pSrc</code>.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
+   */
+
+  void riscv_biquad_parallel_f32(
+  const riscv_biquad_parallel_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Adds the outputs of a range of sections of a floating-point parallel-form IIR filter to a block.
+   * @param[in]     *S           points to an instance of the floating-point parallel-form structure.
+   * @param[in]     firstStage   first section to run.
+   * @param[in]     numStages    number of sections to run.
+   * @param[in]     *pSrc        points to the block of input data.
+   * @param[in,out] *pDst        points to the block the outputs of the sections are added to.
+   * @param[in]     blockSize    number of samples to process.
+   * @return none.
+   */
+
+  void riscv_biquad_parallel_stages_f32(
+  const riscv_biquad_parallel_instance_f32 * S,
+  uint32_t firstStage,
+  uint32_t numStages,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 parallel-form IIR filter.
+   * @param[out]    *S          points to an instance of the Q15 parallel-form structure.
+   * @param[in]     numStages   number of second order sections.
+   * @param[in]     *pCoeffs    points to the coefficients of the sections.
+   * @param[in]     direct      direct gain, scaled as the coefficients.
+   * @param[in]     *pState     points to the state buffer of <code>2*numStages+2</code> values.
+   * @param[in]     postShift   shift to be applied to the accumulators.
+   * @return none.
+   */
+
+  void riscv_biquad_parallel_init_q15(
+  riscv_biquad_parallel_instance_q15 * S,
+  uint8_t numStages,
+  const q15_t * pCoeffs,
+  q15_t direct,
+  q15_t * pState,
+  int8_t postShift);
+
+  /**
+   * @brief  Processing function for the Q15 parallel-form IIR filter.
+   * @param[in]     *S         points to an instance of the Q15 parallel-form structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
+   */
+
+  void riscv_biquad_parallel_q15(
+  const riscv_biquad_parallel_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Floating-point parallel-form IIR filter forked across the cluster cores.
+   * @param[in]     *P         points to the parallel execution context.
+   * @param[in]     *S         points to an instance of the floating-point parallel-form structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data, not overlapping <code>pSrc</code>.
+   * @param[in]     blockSize  number of samples to process.
+   * @param[in]     *pScratch  points to a scratch buffer of <code>(numCores-1)*blockSize</code> samples.
+   * @return none.
+   */
+
+  void riscv_biquad_parallel_par_f32(
+  const riscv_par_instance * P,
+  const riscv_biquad_parallel_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize,
+  float32_t * pScratch);
+
+  /**
+   * @brief Instance structure for the coefficient swap of a filter.
+   */
+
+  typedef struct
+  {
+    void *pBank[2];                           /**< points to the two coefficient banks. */
+    void *pFadeState;                         /**< points to the state buffer of the outgoing filter of a crossfade. */
+    void *pFadeOut;                           /**< points to the output buffer of the outgoing filter of a crossfade. */
+    uint16_t fadeLength;                      /**< number of samples of the crossfade, 0 to switch at the block boundary. */
+    volatile uint16_t fadeCount;              /**< number of samples of the crossfade left, written by the filter. */
+    volatile uint8_t active;                  /**< index of the bank the filter runs, written by the filter. */
+    volatile uint8_t pending;                 /**< set by riscv_coeff_swap_publish(), cleared by the filter. */
+  } riscv_coeff_swap_instance;
+
+  /**
+   * @brief  Initialization function for the coefficient swap.
+   * @param[out] *S           points to an instance of the coefficient swap structure.
+   * @param[in]  *pBankA      points to the coefficients the filter was initialized with.
+   * @param[in]  *pBankB      points to the second bank, of the same size.
+   * @param[in]  fadeLength   number of samples of the crossfade after a swap, 0 to switch at the block boundary.
+   * @param[in]  *pFadeState  points to the state buffer of the outgoing filter, the size of the filter state.
+   * @param[in]  *pFadeOut    points to the scratch buffer of <code>blockSize</code> outputs of the outgoing filter.
+   * @return none.
+   */
+
+  void riscv_coeff_swap_init(
+  riscv_coeff_swap_instance * S,
+  void * pBankA,
+  void * pBankB,
+  uint16_t fadeLength,
+  void * pFadeState,
+  void * pFadeOut);
+
+  /**
+   * @brief  Bank the control side may write.
+   * @param[in]  *S  points to an instance of the coefficient swap structure.
+   * @return     points to the bank the filter does not use, or NULL while a swap is pending or a crossfade runs.
+   */
+
+  void * riscv_coeff_swap_edit(
+  const riscv_coeff_swap_instance * S);
+
+  /**
+   * @brief  Hands the bank returned by riscv_coeff_swap_edit() to the filter.
+   * @param[in,out] *S  points to an instance of the coefficient swap structure.
+   * @return none.
+   */
+
+  void riscv_coeff_swap_publish(
+  riscv_coeff_swap_instance * S);
+
+  /**
+   * @brief  Takes over the published bank, called by the filter side at the start of a block.
+   * @param[in,out] *S  points to an instance of the coefficient swap structure.
+   * @return     points to the bank the filter runs from now on.
+   */
+
+  void * riscv_coeff_swap_take(
+  riscv_coeff_swap_instance * S);
+
+  /**
+   * @brief  Processing function for the floating-point FIR filter with coefficient swap.
+   * @param[in,out] *S          points to an instance of the floating-point FIR structure.
+   * @param[in,out] *pSwap      points to the coefficient swap instance of the filter.
+   * @param[in]     *pSrc       points to the block of input data.
+   * @param[out]    *pDst       points to the block of output data.
+   * @param[in]     blockSize   number of samples to process.
+   * @return none.
+   */
+
+  void riscv_fir_swap_f32(
+  riscv_fir_instance_f32 * S,
+  riscv_coeff_swap_instance * pSwap,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the Q15 FIR filter with coefficient swap.
+   * @param[in,out] *S          points to an instance of the Q15 FIR structure.
+   * @param[in,out] *pSwap      points to the coefficient swap instance of the filter.
+   * @param[in]     *pSrc       points to the block of input data.
+   * @param[out]    *pDst       points to the block of output data.
+   * @param[in]     blockSize   number of samples to process.
+   * @return none.
+   */
+
+  void riscv_fir_swap_q15(
+  riscv_fir_instance_q15 * S,
+  riscv_coeff_swap_instance * pSwap,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Processing function for the floating-point transposed direct form II Biquad cascade with coefficient swap.
+   * @param[in,out] *S          points to an instance of the filter data structure.
+   * @param[in,out] *pSwap      points to the coefficient swap instance of the filter.
+   * @param[in]     *pSrc       points to the block of input data.
+   * @param[out]    *pDst       points to the block of output data.
+   * @param[in]     blockSize   number of samples to process.
+   * @return none.
+   */
+
+  void riscv_biquad_cascade_df2T_swap_f32(
+  riscv_biquad_cascade_df2T_instance_f32 * S,
+  riscv_coeff_swap_instance * pSwap,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Level detectors of the dynamics processor.
+   */
+
+  typedef enum
+  {
+    RISCV_DYNAMICS_PEAK = 0,                  /**< largest magnitude of each sub-block */
+    RISCV_DYNAMICS_RMS = 1                    /**< mean square of each sub-block */
+  } riscv_dynamics_detector;
+
+  /**
+   * @brief Number of samples that share one envelope update and one gain computation.
+   */
+#define RISCV_DYNAMICS_SUBBLOCK 8u
+
+  /**
+   * @brief Instance structure for the floating-point dynamics processor.
+   */
+
+  typedef struct
+  {
+    riscv_dynamics_detector detector;         /**< level detector. */
+    uint16_t lookahead;                       /**< delay of the output in samples, length of pDelay. */
+    uint16_t delayIndex;                      /**< oldest sample of pDelay. */
+    float32_t attackCoef;                     /**< envelope coefficient when the level rises. */
+    float32_t releaseCoef;                    /**< envelope coefficient when the level falls. */
+    float32_t thresholdLog;                   /**< natural logarithm of the threshold. */
+    float32_t slope;                          /**< 1 - 1/ratio. */
+    float32_t maxGainLog;                     /**< natural logarithm of the largest gain before makeup. */
+    float32_t makeupLog;                      /**< natural logarithm of the makeup gain. */
+    float32_t env;                            /**< envelope, of the magnitude or of the mean square. */
+    float32_t gain;                           /**< gain applied to the last output sample. */
+    float32_t *pDelay;                        /**< points to the lookahead delay line. */
+  } riscv_dynamics_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 dynamics processor.
+   */
+
+  typedef struct
+  {
+    riscv_dynamics_detector detector;         /**< level detector. */
+    uint16_t lookahead;                       /**< delay of the output in samples, length of pDelay. */
+    uint16_t delayIndex;                      /**< oldest sample of pDelay. */
+    q31_t attackCoef;                         /**< envelope coefficient when the level rises. */
+    q31_t releaseCoef;                        /**< envelope coefficient when the level falls. */
+    q31_t thresholdLog;                       /**< natural logarithm of the threshold in 5.26 format. */
+    q31_t slope;                              /**< 1 - 1/ratio in Q31. */
+    q31_t maxGainLog;                         /**< natural logarithm of the largest gain before makeup in 5.26 format. */
+    q31_t makeupLog;                          /**< natural logarithm of the makeup gain in 5.26 format. */
+    q31_t env;                                /**< envelope, of the magnitude or of the mean square, in Q31. */
+    q31_t gain;                               /**< gain applied to the last output sample in 8.23 format. */
+    q15_t *pDelay;                            /**< points to the lookahead delay line. */
+  } riscv_dynamics_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point dynamics processor.
+   * @param[out] *S            points to an instance of the floating-point dynamics structure.
+   * @param[in]  detector      level detector.
+   * @param[in]  threshold     level above which the gain falls, the target level of an AGC.
+   * @param[in]  ratio         compression ratio, 1 or more, 0 for an infinite ratio.
+   * @param[in]  maxGain       largest gain before makeup, 1 for a compressor or limiter.
+   * @param[in]  makeupGain    gain applied on top of the computed one.
+   * @param[in]  attackTime    time constant of the envelope when the level rises, in samples.
+   * @param[in]  releaseTime   time constant of the envelope when the level falls, in samples.
+   * @param[in]  lookahead     delay of the output in samples.
+   * @param[in]  *pDelay       points to the delay line of <code>lookahead</code> samples, NULL if it is 0.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR for a parameter out of range.
+   */
+
+  riscv_status riscv_dynamics_init_f32(
+  riscv_dynamics_instance_f32 * S,
+  riscv_dynamics_detector detector,
+  float32_t threshold,
+  float32_t ratio,
+  float32_t maxGain,
+  float32_t makeupGain,
+  float32_t attackTime,
+  float32_t releaseTime,
+  uint16_t lookahead,
+  float32_t * pDelay);
+
+  /**
+   * @brief  Processing function for the floating-point dynamics processor.
+   * @param[in,out] *S          points to an instance of the floating-point dynamics structure.
+   * @param[in]     *pSrc       points to the block of input data.
+   * @param[out]    *pDst       points to the block of output data.
+   * @param[in]     blockSize   number of samples to process.
+   * @return none.
+   */
+
+  void riscv_dynamics_f32(
+  riscv_dynamics_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 dynamics processor.
+   * @param[out] *S            points to an instance of the Q15 dynamics structure.
+   * @param[in]  detector      level detector.
+   * @param[in]  threshold     level above which the gain falls, the target level of an AGC, relative to full scale.
+   * @param[in]  ratio         compression ratio, 1 or more, 0 for an infinite ratio.
+   * @param[in]  maxGain       largest gain before makeup, 1 for a compressor or limiter.
+   * @param[in]  makeupGain    gain applied on top of the computed one.
+   * @param[in]  attackTime    time constant of the envelope when the level rises, in samples.
+   * @param[in]  releaseTime   time constant of the envelope when the level falls, in samples.
+   * @param[in]  lookahead     delay of the output in samples.
+   * @param[in]  *pDelay       points to the delay line of <code>lookahead</code> samples, NULL if it is 0.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR for a parameter out of range.
+   */
+
+  riscv_status riscv_dynamics_init_q15(
+  riscv_dynamics_instance_q15 * S,
+  riscv_dynamics_detector detector,
+  float32_t threshold,
+  float32_t ratio,
+  float32_t maxGain,
+  float32_t makeupGain,
+  float32_t attackTime,
+  float32_t releaseTime,
+  uint16_t lookahead,
+  q15_t * pDelay);
+
+  /**
+   * @brief  Processing function for the Q15 dynamics processor.
+   * @param[in,out] *S          points to an instance of the Q15 dynamics structure.
+   * @param[in]     *pSrc       points to the block of input data.
+   * @param[out]    *pDst       points to the block of output data.
+   * @param[in]     blockSize   number of samples to process.
+   * @return none.
+   */
+
+  void riscv_dynamics_q15(
+  riscv_dynamics_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point moving average filter.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLength;     /**< number of samples in the window. */
+    uint16_t stateIndex;       /**< slot of the oldest sample. */
+    float32_t *pState;      /**< points to the window samples, of length windowLength. */
+    float32_t sum;             /**< sum of the window. */
+    float32_t recip;           /**< 1/windowLength. */
+  } riscv_moving_average_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 moving average filter.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLength;     /**< number of samples in the window. */
+    uint16_t stateIndex;       /**< slot of the oldest sample. */
+    q15_t *pState;          /**< points to the window samples, of length windowLength. */
+    q31_t sum;                 /**< sum of the window. */
+    uint32_t recip;            /**< 2^postShift/windowLength. */
+    uint8_t postShift;         /**< shift of the product with recip. */
+  } riscv_moving_average_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 moving average filter.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLength;     /**< number of samples in the window. */
+    uint16_t stateIndex;       /**< slot of the oldest sample. */
+    q31_t *pState;          /**< points to the window samples, of length windowLength. */
+    q63_t sum;                 /**< sum of the window. */
+    uint32_t recip;            /**< 2^postShift/windowLength. */
+    uint8_t postShift;         /**< shift of the product with recip. */
+  } riscv_moving_average_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point moving average filter.
+   * @param[out]    *S             points to an instance of the floating-point moving average structure.
+   * @param[in]     windowLength   number of samples in the window.
+   * @param[in]     *pState        points to the window buffer of <code>windowLength</code> values.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR if <code>windowLength</code> is 0.
+   */
+
+  riscv_status riscv_moving_average_init_f32(
+  riscv_moving_average_instance_f32 * S,
+  uint16_t windowLength,
+  float32_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point moving average filter.
+   * @param[in,out] *S         points to an instance of the floating-point moving average structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
+   */
+
+  void riscv_moving_average_f32(
+  riscv_moving_average_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 moving average filter.
+   * @param[out]    *S             points to an instance of the Q15 moving average structure.
+   * @param[in]     windowLength   number of samples in the window.
+   * @param[in]     *pState        points to the window buffer of <code>windowLength</code> values.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR if <code>windowLength</code> is 0.
+   */
+
+  riscv_status riscv_moving_average_init_q15(
+  riscv_moving_average_instance_q15 * S,
+  uint16_t windowLength,
+  q15_t * pState);
+
+  /**
+   * @brief  Processing function for the Q15 moving average filter.
+   * @param[in,out] *S         points to an instance of the Q15 moving average structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
+   */
+
+  void riscv_moving_average_q15(
+  riscv_moving_average_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 moving average filter.
+   * @param[out]    *S             points to an instance of the Q31 moving average structure.
+   * @param[in]     windowLength   number of samples in the window.
+   * @param[in]     *pState        points to the window buffer of <code>windowLength</code> values.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR if <code>windowLength</code> is 0.
+   */
+
+  riscv_status riscv_moving_average_init_q31(
+  riscv_moving_average_instance_q31 * S,
+  uint16_t windowLength,
+  q31_t * pState);
+
+  /**
+   * @brief  Processing function for the Q31 moving average filter.
+   * @param[in,out] *S         points to an instance of the Q31 moving average structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
+   */
+
+  void riscv_moving_average_q31(
+  riscv_moving_average_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point exponential smoothers.
+   */
+
+  typedef struct
+  {
+    uint16_t numChannels;      /**< number of channels. */
+    float32_t alpha;       /**< smoothing factor. */
+    float32_t *pState;      /**< points to the last output of every channel, of length numChannels. */
+  } riscv_exp_smooth_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 exponential smoothers.
+   */
+
+  typedef struct
+  {
+    uint16_t numChannels;      /**< number of channels. */
+    q15_t alpha;           /**< smoothing factor. */
+    q15_t *pState;          /**< points to the last output of every channel, of length numChannels. */
+  } riscv_exp_smooth_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 exponential smoothers.
+   */
+
+  typedef struct
+  {
+    uint16_t numChannels;      /**< number of channels. */
+    q31_t alpha;           /**< smoothing factor. */
+    q31_t *pState;          /**< points to the last output of every channel, of length numChannels. */
+  } riscv_exp_smooth_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point exponential smoothers.
+   * @param[out]    *S            points to an instance of the floating-point exponential smoothing structure.
+   * @param[in]     numChannels   number of channels.
+   * @param[in]     alpha         smoothing factor, in (0, 1].
+   * @param[in]     *pState       points to the state buffer of <code>numChannels</code> values.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
+
+  riscv_status riscv_exp_smooth_init_f32(
+  riscv_exp_smooth_instance_f32 * S,
+  uint16_t numChannels,
+  float32_t alpha,
+  float32_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point exponential smoothers.
+   * @param[in]     *S         points to an instance of the floating-point exponential smoothing structure.
+   * @param[in]     *pSrc      points to <code>blockSize</code> frames of <code>numChannels</code> samples.
+   * @param[out]    *pDst      points to <code>blockSize</code> frames of <code>numChannels</code> samples.
+   * @param[in]     blockSize  number of frames to process.
+   * @return none.
+   */
+
+  void riscv_exp_smooth_f32(
+  const riscv_exp_smooth_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 exponential smoothers.
+   * @param[out]    *S            points to an instance of the Q15 exponential smoothing structure.
+   * @param[in]     numChannels   number of channels.
+   * @param[in]     alpha         smoothing factor, from 1 to 0x7FFF.
+   * @param[in]     *pState       points to the state buffer of <code>numChannels</code> values.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
+
+  riscv_status riscv_exp_smooth_init_q15(
+  riscv_exp_smooth_instance_q15 * S,
+  uint16_t numChannels,
+  q15_t alpha,
+  q15_t * pState);
+
+  /**
+   * @brief  Processing function for the Q15 exponential smoothers.
+   * @param[in]     *S         points to an instance of the Q15 exponential smoothing structure.
+   * @param[in]     *pSrc      points to <code>blockSize</code> frames of <code>numChannels</code> samples.
+   * @param[out]    *pDst      points to <code>blockSize</code> frames of <code>numChannels</code> samples.
+   * @param[in]     blockSize  number of frames to process.
+   * @return none.
+   */
+
+  void riscv_exp_smooth_q15(
+  const riscv_exp_smooth_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 exponential smoothers.
+   * @param[out]    *S            points to an instance of the Q31 exponential smoothing structure.
+   * @param[in]     numChannels   number of channels.
+   * @param[in]     alpha         smoothing factor, from 1 to 0x7FFFFFFF.
+   * @param[in]     *pState       points to the state buffer of <code>numChannels</code> values.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
+
+  riscv_status riscv_exp_smooth_init_q31(
+  riscv_exp_smooth_instance_q31 * S,
+  uint16_t numChannels,
+  q31_t alpha,
+  q31_t * pState);
+
+  /**
+   * @brief  Processing function for the Q31 exponential smoothers.
+   * @param[in]     *S         points to an instance of the Q31 exponential smoothing structure.
+   * @param[in]     *pSrc      points to <code>blockSize</code> frames of <code>numChannels</code> samples.
+   * @param[out]    *pDst      points to <code>blockSize</code> frames of <code>numChannels</code> samples.
+   * @param[in]     blockSize  number of frames to process.
+   * @return none.
+   */
+
+  void riscv_exp_smooth_q31(
+  const riscv_exp_smooth_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Responses of riscv_biquad_design_f32().
+   */
+
+  typedef enum
+  {
+    RISCV_BIQUAD_DESIGN_LOWPASS = 0,     /**< Second order lowpass */
+    RISCV_BIQUAD_DESIGN_HIGHPASS = 1,    /**< Second order highpass */
+    RISCV_BIQUAD_DESIGN_BANDPASS = 2,    /**< Bandpass of 0 dB peak gain */
+    RISCV_BIQUAD_DESIGN_NOTCH = 3,       /**< Notch */
+    RISCV_BIQUAD_DESIGN_PEAKING = 4,     /**< Peaking equalizer */
+    RISCV_BIQUAD_DESIGN_LOWSHELF = 5,    /**< Low shelf */
+    RISCV_BIQUAD_DESIGN_HIGHSHELF = 6    /**< High shelf */
+  } riscv_biquad_design_type;
+
+  /**
+   * @brief  Audio EQ Cookbook design of one floating-point Biquad stage.
+   * @param[in]  type      response of the stage.
+   * @param[in]  freq      cut-off, centre or shelf frequency, normalized to the sample rate.
+   * @param[in]  q         quality factor.
+   * @param[in]  gainDb    gain of the peaking and shelving responses in dB.
+   * @param[out] *pCoeffs  points to the 5 coefficients {b0, b1, b2, -a1, -a2} of the stage.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR for unsupported arguments.
+   */
+
+  riscv_status riscv_biquad_design_f32(
+  riscv_biquad_design_type type,
+  float32_t freq,
+  float32_t q,
+  float32_t gainDb,
+  float32_t * pCoeffs);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
+   */
+
+  void riscv_biquad_cascade_stereo_df2T_init_f32(
+  riscv_biquad_cascade_stereo_df2T_instance_f32 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
+   */
+
+  void riscv_biquad_cascade_df2T_init_f64(
+  riscv_biquad_cascade_df2T_instance_f64 * S,
+  uint8_t numStages,
+  float64_t * pCoeffs,
+  float64_t * pState);
+
+  /**
+   * @brief Instance structure for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;      /**< number of interleaved channels that share the coefficients. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } riscv_biquad_cascade_multichan_df2T_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 multi-channel transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;      /**< number of interleaved channels that share the coefficients. */
+    q63_t *pState;             /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    q31_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;         /**< additional shift, in bits, applied to each output sample. */
+  } riscv_biquad_cascade_multichan_df2T_instance_q31;
+
+  /**
+   * @brief Processing function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of interleaved input data.
+   * @param[out] *pDst     points to the block of interleaved output data.
+   * @param[in]  blockSize number of samples per channel to process.
+   * @return none.
+   */
+  void riscv_biquad_cascade_multichan_df2T_f32(
+  const riscv_biquad_cascade_multichan_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>numStages</code> or <code>numChannels</code> is 0.
+   */
+  riscv_status riscv_biquad_cascade_multichan_df2T_init_f32(
+  riscv_biquad_cascade_multichan_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+  /**
+   * @brief Processing function for the Q31 multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of interleaved input data.
+   * @param[out] *pDst     points to the block of interleaved output data.
+   * @param[in]  blockSize number of samples per channel to process.
+   * @return none.
+   */
+  void riscv_biquad_cascade_multichan_df2T_q31(
+  const riscv_biquad_cascade_multichan_df2T_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
+   * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>numStages</code> or <code>numChannels</code> is 0.
+   */
+  riscv_status riscv_biquad_cascade_multichan_df2T_init_q31(
+  riscv_biquad_cascade_multichan_df2T_instance_q31 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  q31_t * pCoeffs,
+  q63_t * pState,
+  uint8_t postShift);
+
+
+
+  /**
+   * @brief Instance structure for the Q15 FIR lattice filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numStages;                          /**< number of filter stages. */
+    q15_t *pState;                               /**< points to the state variable array. The array is of length numStages. */
+    q15_t *pCoeffs;                              /**< points to the coefficient array. The array is of length numStages. */
+  } riscv_fir_lattice_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR lattice filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numStages;                          /**< number of filter stages. */
+    q31_t *pState;                               /**< points to the state variable array. The array is of length numStages. */
+    q31_t *pCoeffs;                              /**< points to the coefficient array. The array is of length numStages. */
+  } riscv_fir_lattice_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR lattice filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numStages;                  /**< number of filter stages. */
+    float32_t *pState;                   /**< points to the state variable array. The array is of length numStages. */
+    float32_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numStages. */
+  } riscv_fir_lattice_instance_f32;
+
+  /**
+   * @brief Initialization function for the Q15 FIR lattice filter.
+   * @param[in] *S points to an instance of the Q15 FIR lattice structure.
+   * @param[in] numStages  number of filter stages.
+   * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
+   * @param[in] *pState points to the state buffer.  The array is of length numStages.
+   * @return none.
+   */
+
+  void riscv_fir_lattice_init_q15(
+  riscv_fir_lattice_instance_q15 * S,
+  uint16_t numStages,
+  q15_t * pCoeffs,
+  q15_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q15 FIR lattice filter.
+   * @param[in] *S points to an instance of the Q15 FIR lattice structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+  void riscv_fir_lattice_q15(
+  const riscv_fir_lattice_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for the Q31 FIR lattice filter.
+   * @param[in] *S points to an instance of the Q31 FIR lattice structure.
+   * @param[in] numStages  number of filter stages.
+   * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
+   * @param[in] *pState points to the state buffer.   The array is of length numStages.
+   * @return none.
+   */
+
+  void riscv_fir_lattice_init_q31(
+  riscv_fir_lattice_instance_q31 * S,
+  uint16_t numStages,
+  q31_t * pCoeffs,
+  q31_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q31 FIR lattice filter.
+   * @param[in]  *S        points to an instance of the Q31 FIR lattice structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_fir_lattice_q31(
+  const riscv_fir_lattice_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+/**
+ * @brief Initialization function for the floating-point FIR lattice filter.
+ * @param[in] *S points to an instance of the floating-point FIR lattice structure.
+ * @param[in] numStages  number of filter stages.
+ * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
+ * @param[in] *pState points to the state buffer.  The array is of length numStages.
+ * @return none.
+ */
+
+  void riscv_fir_lattice_init_f32(
+  riscv_fir_lattice_instance_f32 * S,
+  uint16_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+  /**
+   * @brief Processing function for the floating-point FIR lattice filter.
+   * @param[in]  *S        points to an instance of the floating-point FIR lattice structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_fir_lattice_f32(
+  const riscv_fir_lattice_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 IIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                         /**< number of stages in the filter. */
+    q15_t *pState;                              /**< points to the state variable array. The array is of length numStages+blockSize. */
+    q15_t *pkCoeffs;                            /**< points to the reflection coefficient array. The array is of length numStages. */
+    q15_t *pvCoeffs;                            /**< points to the ladder coefficient array. The array is of length numStages+1. */
+  } riscv_iir_lattice_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 IIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                         /**< number of stages in the filter. */
+    q31_t *pState;                              /**< points to the state variable array. The array is of length numStages+blockSize. */
+    q31_t *pkCoeffs;                            /**< points to the reflection coefficient array. The array is of length numStages. */
+    q31_t *pvCoeffs;                            /**< points to the ladder coefficient array. The array is of length numStages+1. */
+  } riscv_iir_lattice_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point IIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                         /**< number of stages in the filter. */
+    float32_t *pState;                          /**< points to the state variable array. The array is of length numStages+blockSize. */
+    float32_t *pkCoeffs;                        /**< points to the reflection coefficient array. The array is of length numStages. */
+    float32_t *pvCoeffs;                        /**< points to the ladder coefficient array. The array is of length numStages+1. */
+  } riscv_iir_lattice_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point IIR lattice filter.
+   * @param[in] *S points to an instance of the floating-point IIR lattice structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_iir_lattice_f32(
+  const riscv_iir_lattice_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for the floating-point IIR lattice filter.
+   * @param[in] *S points to an instance of the floating-point IIR lattice structure.
+   * @param[in] numStages number of stages in the filter.
+   * @param[in] *pkCoeffs points to the reflection coefficient buffer.  The array is of length numStages.
+   * @param[in] *pvCoeffs points to the ladder coefficient buffer.  The array is of length numStages+1.
+   * @param[in] *pState points to the state buffer.  The array is of length numStages+blockSize-1.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_iir_lattice_init_f32(
+  riscv_iir_lattice_instance_f32 * S,
+  uint16_t numStages,
+  float32_t * pkCoeffs,
+  float32_t * pvCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 IIR lattice filter.
+   * @param[in] *S points to an instance of the Q31 IIR lattice structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_iir_lattice_q31(
+  const riscv_iir_lattice_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for the Q31 IIR lattice filter.
+   * @param[in] *S points to an instance of the Q31 IIR lattice structure.
+   * @param[in] numStages number of stages in the filter.
+   * @param[in] *pkCoeffs points to the reflection coefficient buffer.  The array is of length numStages.
+   * @param[in] *pvCoeffs points to the ladder coefficient buffer.  The array is of length numStages+1.
+   * @param[in] *pState points to the state buffer.  The array is of length numStages+blockSize.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_iir_lattice_init_q31(
+  riscv_iir_lattice_instance_q31 * S,
+  uint16_t numStages,
+  q31_t * pkCoeffs,
+  q31_t * pvCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q15 IIR lattice filter.
+   * @param[in] *S points to an instance of the Q15 IIR lattice structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_iir_lattice_q15(
+  const riscv_iir_lattice_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Initialization function for the Q15 IIR lattice filter.
+ * @param[in] *S points to an instance of the fixed-point Q15 IIR lattice structure.
+ * @param[in] numStages  number of stages in the filter.
+ * @param[in] *pkCoeffs points to reflection coefficient buffer.  The array is of length numStages.
+ * @param[in] *pvCoeffs points to ladder coefficient buffer.  The array is of length numStages+1.
+ * @param[in] *pState points to state buffer.  The array is of length numStages+blockSize.
+ * @param[in] blockSize number of samples to process per call.
+ * @return none.
+ */
+
+  void riscv_iir_lattice_init_q15(
+  riscv_iir_lattice_instance_q15 * S,
+  uint16_t numStages,
+  q15_t * pkCoeffs,
+  q15_t * pvCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;    /**< number of coefficients in the filter. */
+    float32_t *pState;   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;  /**< points to the coefficient array. The array is of length numTaps. */
+    float32_t mu;        /**< step size that controls filter coefficient updates. */
+  } riscv_lms_instance_f32;
+
+  /**
+   * @brief Processing function for floating-point LMS filter.
+   * @param[in]  *S points to an instance of the floating-point LMS filter structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[in]  *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
+   */
+
+  void riscv_lms_f32(
+  const riscv_lms_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for floating-point LMS filter.
+   * @param[in] *S points to an instance of the floating-point LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to the coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_lms_init_f32(
+  riscv_lms_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t mu,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;    /**< number of coefficients in the filter. */
+    q15_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q15_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
+    q15_t mu;            /**< step size that controls filter coefficient updates. */
+    uint32_t postShift;  /**< bit shift applied to coefficients. */
+  } riscv_lms_instance_q15;
+
+
+  /**
+   * @brief Initialization function for the Q15 LMS filter.
+   * @param[in] *S points to an instance of the Q15 LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to the coefficient buffer.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @param[in] postShift bit shift applied to coefficients.
+   * @return    none.
+   */
+
+  void riscv_lms_init_q15(
+  riscv_lms_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  q15_t mu,
+  uint32_t blockSize,
+  uint32_t postShift);
+
+  /**
+   * @brief Processing function for Q15 LMS filter.
+   * @param[in] *S points to an instance of the Q15 LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_lms_q15(
+  const riscv_lms_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pRef,
+  q15_t * pOut,
+  q15_t * pErr,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q15 block LMS filter.
+   * @param[in] *S points to an instance of the Q15 LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process, at most the blockSize given to riscv_lms_init_q15().
+   * @return none.
+   */
+
+  void riscv_lms_block_q15(
+  const riscv_lms_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pRef,
+  q15_t * pOut,
+  q15_t * pErr,
+  uint32_t blockSize);
+
+  /**
+   * @brief Filters a block with fixed coefficients, shared by the Q15 block LMS filters.
+   * @param[in] *pCoeffs points to the coefficient buffer.
+   * @param[in] numTaps number of filter coefficients.
+   * @param[in] *pState points to the oldest state sample of the block.
+   * @param[out] *pOut points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @param[in] postShift bit shift applied to coefficients.
+   * @return none.
+   */
+
+  void riscv_lms_block_filter_q15(
+  const q15_t * pCoeffs,
+  uint32_t numTaps,
+  const q15_t * pState,
+  q15_t * pOut,
+  uint32_t blockSize,
+  uint32_t postShift);
+
+  /**
+   * @brief Adds the gradient of a block to the coefficients, shared by the Q15 block LMS filters.
+   * @param[in,out] *pCoeffs points to the coefficient buffer.
+   * @param[in] numTaps number of filter coefficients.
+   * @param[in] *pState points to the oldest state sample of the block.
+   * @param[in] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples in the block.
+   * @param[in] mu step size applied to the gradient.
+   * @return none.
+   */
+
+  void riscv_lms_block_update_q15(
+  q15_t * pCoeffs,
+  uint32_t numTaps,
+  const q15_t * pState,
+  const q15_t * pErr,
+  uint32_t blockSize,
+  q15_t mu);
+
+
+  /**
+   * @brief Instance structure for the Q31 LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;    /**< number of coefficients in the filter. */
+    q31_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q31_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
+    q31_t mu;            /**< step size that controls filter coefficient updates. */
+    uint32_t postShift;  /**< bit shift applied to coefficients. */
+
+  } riscv_lms_instance_q31;
+
+  /**
+   * @brief Processing function for Q31 LMS filter.
+   * @param[in]  *S points to an instance of the Q15 LMS filter structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[in]  *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
+   */
+
+  void riscv_lms_q31(
+  const riscv_lms_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pRef,
+  q31_t * pOut,
+  q31_t * pErr,
+  uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for Q31 LMS filter.
+   * @param[in] *S points to an instance of the Q31 LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @param[in] postShift bit shift applied to coefficients.
+   * @return none.
+   */
+
+  void riscv_lms_init_q31(
+  riscv_lms_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t mu,
+  uint32_t blockSize,
+  uint32_t postShift);
+
+  /**
+   * @brief Instance structure for the floating-point normalized LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;     /**< number of coefficients in the filter. */
+    float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
+    float32_t mu;        /**< step size that control filter coefficient updates. */
+    float32_t energy;    /**< saves previous frame energy. */
+    float32_t x0;        /**< saves previous input sample. */
+  } riscv_lms_norm_instance_f32;
+
+  /**
+   * @brief Processing function for floating-point normalized LMS filter.
+   * @param[in] *S points to an instance of the floating-point normalized LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_lms_norm_f32(
+  riscv_lms_norm_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for floating-point normalized LMS filter.
+   * @param[in] *S points to an instance of the floating-point LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_lms_norm_init_f32(
+  riscv_lms_norm_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t mu,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q31 normalized LMS filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;     /**< number of coefficients in the filter. */
+    q31_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q31_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+    q31_t mu;             /**< step size that controls filter coefficient updates. */
+    uint8_t postShift;    /**< bit shift applied to coefficients. */
+    q31_t *recipTable;    /**< points to the reciprocal initial value table. */
+    q31_t energy;         /**< saves previous frame energy. */
+    q31_t x0;             /**< saves previous input sample. */
+  } riscv_lms_norm_instance_q31;
+
+  /**
+   * @brief Processing function for Q31 normalized LMS filter.
+   * @param[in] *S points to an instance of the Q31 normalized LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_lms_norm_q31(
+  riscv_lms_norm_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pRef,
+  q31_t * pOut,
+  q31_t * pErr,
+  uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for Q31 normalized LMS filter.
+   * @param[in] *S points to an instance of the Q31 normalized LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @param[in] postShift bit shift applied to coefficients.
+   * @return none.
+   */
+
+  void riscv_lms_norm_init_q31(
+  riscv_lms_norm_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t mu,
+  uint32_t blockSize,
+  uint8_t postShift);
+
+  /**
+   * @brief Instance structure for the Q15 normalized LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;    /**< Number of coefficients in the filter. */
+    q15_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q15_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+    q15_t mu;            /**< step size that controls filter coefficient updates. */
+    uint8_t postShift;   /**< bit shift applied to coefficients. */
+    q15_t *recipTable;   /**< Points to the reciprocal initial value table. */
+    q15_t energy;        /**< saves previous frame energy. */
+    q15_t x0;            /**< saves previous input sample. */
+  } riscv_lms_norm_instance_q15;
+
+  /**
+   * @brief Processing function for Q15 normalized LMS filter.
+   * @param[in] *S points to an instance of the Q15 normalized LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void riscv_lms_norm_q15(
+  riscv_lms_norm_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pRef,
+  q15_t * pOut,
+  q15_t * pErr,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for Q15 normalized LMS filter.
+   * @param[in] *S points to an instance of the Q15 normalized LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @param[in] postShift bit shift applied to coefficients.
+   * @return none.
+   */
+
+  void riscv_lms_norm_init_q15(
+  riscv_lms_norm_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  q15_t mu,
+  uint32_t blockSize,
+  uint8_t postShift);
+
+  /**
+   * @brief Processing function for the Q15 normalized block LMS filter.
+   * @param[in,out] *S points to an instance of the Q15 normalized LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process, at most the blockSize given to riscv_lms_norm_init_q15().
+   * @return none.
+   */
+
+  void riscv_lms_norm_block_q15(
+  riscv_lms_norm_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pRef,
+  q15_t * pOut,
+  q15_t * pErr,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point frequency-domain LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;                         /**< number of coefficients in the filter, also the block length. */
+    float32_t mu;                             /**< step size that controls filter coefficient updates. */
+    float32_t beta;                           /**< smoothing factor of the power estimate of the input bins. */
+    riscv_rfft_fast_instance_f32 Srfft;       /**< real FFT of 2*numTaps points. */
+    float32_t *pState;                        /**< points to the state buffer of length 11*numTaps+1. */
+  } riscv_lms_fdaf_instance_f32;
+
+  /**
+   * @brief Initialization function for the floating-point frequency-domain LMS filter.
+   * @param[out] *S points to an instance of the floating-point frequency-domain LMS filter structure.
+   * @param[in] numTaps number of filter coefficients and block length, a power of two from 16 to 2048.
+   * @param[in] *pCoeffs points to the initial filter coefficients.
+   * @param[in] *pState points to the state buffer of length 11*numTaps+1.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization was successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> is not a supported value.
+   */
+
+  riscv_status riscv_lms_fdaf_init_f32(
+  riscv_lms_fdaf_instance_f32 * S,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t mu);
+
+  /**
+   * @brief Processing function for the floating-point frequency-domain LMS filter.
+   * @param[in,out] *S points to an instance of the floating-point frequency-domain LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process, a multiple of numTaps.
+   * @return none.
+   */
+
+  void riscv_lms_fdaf_f32(
+  riscv_lms_fdaf_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize);
+
+  /**
+   * @brief Correlation of floating-point sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void riscv_correlate_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst);
+
+
+   /**
+   * @brief Correlation of Q15 sequences
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  *pScratch points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @return none.
+   */
+  void riscv_correlate_opt_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch);
+
+
+  /**
+   * @brief Correlation of Q15 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void riscv_correlate_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst);
+
+  /**
+   * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void riscv_correlate_fast_q15(
+			       q15_t * pSrcA,
+			      uint32_t srcALen,
+			       q15_t * pSrcB,
+			      uint32_t srcBLen,
+			      q15_t * pDst);
+
+
+
+  /**
+   * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  *pScratch points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @return none.
+   */
+
+  void riscv_correlate_fast_opt_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  q15_t * pScratch);
+
+  /**
+   * @brief Correlation of Q31 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void riscv_correlate_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst);
+
+  /**
+   * @brief Cost ratio of one FFT butterfly operation to one direct multiply-accumulate, used by riscv_correlate_fft_length().
+   * The FFT path is taken when srcALen*srcBLen > RISCV_CORRELATE_FFT_RATIO*fftLen*log2(fftLen).
+   */
+
+#ifndef RISCV_CORRELATE_FFT_RATIO
+#define RISCV_CORRELATE_FFT_RATIO 4u
+#endif
+
+  /**
+   * @brief FFT length of riscv_correlate_fft_f32() and riscv_correlate_fft_q31().
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @return length of the real FFT, or 0 if the direct path is used.  The scratch buffer is of length 3*fftLen.
+   */
+
+  uint32_t riscv_correlate_fft_length(
+  uint32_t srcALen,
+  uint32_t srcBLen);
+
+  /**
+   * @brief Correlation of floating-point sequences, with an FFT path for long sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in] *pScratch points to scratch buffer of length 3*riscv_correlate_fft_length(srcALen, srcBLen).
+   * @return none.
+   */
+
+  void riscv_correlate_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+  /**
+   * @brief Correlation of Q31 sequences, with an FFT path for long sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in] *pScratch points to floating-point scratch buffer of length 3*riscv_correlate_fft_length(srcALen, srcBLen).
+   * @return none.
+   */
+
+  void riscv_correlate_fft_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  float32_t * pScratch);
+
+  /**
+   * @brief Partial correlation of floating-point sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length numLags.
+   * @param[in] firstLag first lag to compute, lag l is output max(srcALen, srcBLen)-1+l of the full correlation.
+   * @param[in] numLags number of lags to compute.
+   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested lags are not in the range [-(srcBLen-1) srcALen-1].
+   */
+
+  riscv_status riscv_correlate_partial_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  int32_t firstLag,
+  uint32_t numLags);
+
+  /**
+   * @brief Partial correlation of Q15 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length numLags.
+   * @param[in] firstLag first lag to compute, lag l is output max(srcALen, srcBLen)-1+l of the full correlation.
+   * @param[in] numLags number of lags to compute.
+   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested lags are not in the range [-(srcBLen-1) srcALen-1].
+   */
+
+  riscv_status riscv_correlate_partial_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  int32_t firstLag,
+  uint32_t numLags);
+
+  /**
+   * @brief Partial correlation of Q31 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length numLags.
+   * @param[in] firstLag first lag to compute, lag l is output max(srcALen, srcBLen)-1+l of the full correlation.
+   * @param[in] numLags number of lags to compute.
+   * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested lags are not in the range [-(srcBLen-1) srcALen-1].
+   */
+
+  riscv_status riscv_correlate_partial_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  int32_t firstLag,
+  uint32_t numLags);
+
+  /**
+   * @brief Correlation of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void riscv_correlate_fast_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst);
+
+
+
+ /**
+   * @brief Correlation of Q7 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  *pScratch1 points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+   * @param[in]  *pScratch2 points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).
+   * @return none.
+   */
+
+  void riscv_correlate_opt_q7(
+  q7_t * pSrcA,
+  uint32_t srcALen,
+  q7_t * pSrcB,
+  uint32_t srcBLen,
+  q7_t * pDst,
+  q15_t * pScratch1,
+  q15_t * pScratch2);
+
+
+  /**
+   * @brief Correlation of Q7 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void riscv_correlate_q7(
+  q7_t * pSrcA,
+  uint32_t srcALen,
+  q7_t * pSrcB,
+  uint32_t srcBLen,
+  q7_t * pDst);
+
+  /**
+   * @brief Autocorrelation of a floating-point sequence at the lags 0 to maxLag.
+   * @param[in]  *pSrc points to the input sequence.
+   * @param[in]  srcLen length of the input sequence.
+   * @param[out] *pDst points to the maxLag+1 output values.
+   * @param[in]  maxLag last lag to compute, less than srcLen.
+   * @return none.
+   */
+
+  void riscv_autocorr_f32(
+  const float32_t * pSrc,
+  uint32_t srcLen,
+  float32_t * pDst,
+  uint32_t maxLag);
+
+  /**
+   * @brief Normalized autocorrelation of a Q15 sequence at the lags 0 to maxLag.
+   * @param[in]  *pSrc points to the input sequence, 4-byte aligned.
+   * @param[in]  srcLen length of the input sequence.
+   * @param[out] *pDst points to the maxLag+1 output values, lag 0 in [0.5, 1) in 1.31 format.
+   * @param[in]  maxLag last lag to compute, less than srcLen.
+   * @return the exponent of the output, pDst[l] is the autocorrelation at lag l times 2^shift.
+   */
+
+  int32_t riscv_autocorr_q15(
+  const q15_t * pSrc,
+  uint32_t srcLen,
+  q31_t * pDst,
+  uint32_t maxLag);
+
+  /**
+   * @brief Normalized autocorrelation of a Q31 sequence at the lags 0 to maxLag.
+   * @param[in]  *pSrc points to the input sequence.
+   * @param[in]  srcLen length of the input sequence.
+   * @param[out] *pDst points to the maxLag+1 output values, lag 0 in [0.5, 1) in 1.31 format.
+   * @param[in]  maxLag last lag to compute, less than srcLen.
+   * @return the exponent of the output, pDst[l] is the autocorrelation at lag l times 2^shift.
+   */
+
+  int32_t riscv_autocorr_q31(
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  q31_t * pDst,
+  uint32_t maxLag);
+
+  /**
+   * @brief Floating-point Levinson-Durbin recursion.
+   * @param[in]  *pR points to the autocorrelation at the lags 0 to order.
+   * @param[in]  order order of the predictor.
+   * @param[out] *pK points to the order reflection coefficients {k1, ..., kp} of riscv_fir_lattice_f32().
+   * @param[out] *pA points to the order coefficients {a1, ..., ap} of the prediction error filter.
+   * @param[out] *pErr points to the energy of the prediction error.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_SINGULAR if the autocorrelation is not positive definite.
+   */
+
+  riscv_status riscv_levinson_durbin_f32(
+  const float32_t * pR,
+  uint32_t order,
+  float32_t * pK,
+  float32_t * pA,
+  float32_t * pErr);
+
+  /**
+   * @brief Q15 Levinson-Durbin recursion on the output of riscv_autocorr_q15().
+   * @param[in]  *pR points to the autocorrelation at the lags 0 to order.
+   * @param[in]  order order of the predictor.
+   * @param[out] *pK points to the order reflection coefficients {k1, ..., kp} of riscv_fir_lattice_q15(), 1.15 format.
+   * @param[out] *pA points to the order coefficients {a1, ..., ap} of the prediction error filter, 5.27 format.
+   * @param[out] *pErr points to the energy of the prediction error.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_SINGULAR if the autocorrelation is not positive definite.
+   */
+
+  riscv_status riscv_levinson_durbin_q15(
+  const q31_t * pR,
+  uint32_t order,
+  q15_t * pK,
+  q31_t * pA,
+  q31_t * pErr);
+
+  /**
+   * @brief Q31 Levinson-Durbin recursion on the output of riscv_autocorr_q31().
+   * @param[in]  *pR points to the autocorrelation at the lags 0 to order.
+   * @param[in]  order order of the predictor.
+   * @param[out] *pK points to the order reflection coefficients {k1, ..., kp} of riscv_fir_lattice_q31(), 1.31 format.
+   * @param[out] *pA points to the order coefficients {a1, ..., ap} of the prediction error filter, 5.27 format.
+   * @param[out] *pErr points to the energy of the prediction error.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_SINGULAR if the autocorrelation is not positive definite.
+   */
+
+  riscv_status riscv_levinson_durbin_q31(
+  const q31_t * pR,
+  uint32_t order,
+  q31_t * pK,
+  q31_t * pA,
+  q31_t * pErr);
+
+
+  /**
+   * @brief Instance structure for the floating-point YIN pitch estimator.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLen;    /**< length of the window compared with its delayed copy. */
+    uint16_t minLag;       /**< shortest period searched. */
+    uint16_t maxLag;       /**< longest period searched. */
+    uint16_t fftLen;       /**< length of the real FFT of the correlation, 0 for the direct path. */
+    float32_t threshold;   /**< threshold of the normalized difference. */
+    float32_t *pDiff;      /**< points to the difference function, of length maxLag+1. */
+    float32_t *pScratch;   /**< points to the scratch buffer of the FFT path, of length 3*fftLen. */
+  } riscv_pitch_yin_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 YIN pitch estimator.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLen;    /**< length of the window compared with its delayed copy. */
+    uint16_t minLag;       /**< shortest period searched. */
+    uint16_t maxLag;       /**< longest period searched. */
+    q15_t threshold;       /**< threshold of the normalized difference in 1.15 format. */
+    q31_t *pDiff;          /**< points to the scaled difference function, of length maxLag+1. */
+  } riscv_pitch_yin_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point YIN pitch estimator.
+   * @param[out]    *S          points to an instance of the floating-point YIN structure.
+   * @param[in]     windowLen   length of the window compared with its delayed copy.
+   * @param[in]     minLag      shortest period searched, at least 2.
+   * @param[in]     maxLag      longest period searched.
+   * @param[in]     threshold   threshold of the normalized difference.
+   * @param[in]     *pDiff      points to a buffer of <code>maxLag+1</code> values.
+   * @param[in]     *pScratch   points to a scratch buffer of <code>3*fftLen</code> words, or NULL for the direct path.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
+
+  riscv_status riscv_pitch_yin_init_f32(
+  riscv_pitch_yin_instance_f32 * S,
+  uint16_t windowLen,
+  uint16_t minLag,
+  uint16_t maxLag,
+  float32_t threshold,
+  float32_t * pDiff,
+  float32_t * pScratch);
+
+  /**
+   * @brief Floating-point YIN pitch estimator.
+   * @param[in]  *S              points to an instance of the floating-point YIN structure.
+   * @param[in]  *pSrc           points to the frame of <code>windowLen+maxLag</code> samples.
+   * @param[out] *pAperiodicity  normalized difference at the period, or the smallest one of an unvoiced frame, may be NULL.
+   * @return the period in samples, or 0 if the frame is unvoiced.
+   */
+
+  float32_t riscv_pitch_yin_f32(
+  const riscv_pitch_yin_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pAperiodicity);
+
+  /**
+   * @brief  Initialization function for the Q15 YIN pitch estimator.
+   * @param[out]    *S          points to an instance of the Q15 YIN structure.
+   * @param[in]     windowLen   length of the window compared with its delayed copy.
+   * @param[in]     minLag      shortest period searched, at least 2.
+   * @param[in]     maxLag      longest period searched, less than 32768.
+   * @param[in]     threshold   threshold of the normalized difference in 1.15 format.
+   * @param[in]     *pDiff      points to a buffer of <code>maxLag+1</code> values.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
+
+  riscv_status riscv_pitch_yin_init_q15(
+  riscv_pitch_yin_instance_q15 * S,
+  uint16_t windowLen,
+  uint16_t minLag,
+  uint16_t maxLag,
+  q15_t threshold,
+  q31_t * pDiff);
+
+  /**
+   * @brief Q15 YIN pitch estimator.
+   * @param[in]  *S              points to an instance of the Q15 YIN structure.
+   * @param[in]  *pSrc           points to the frame of <code>windowLen+maxLag</code> samples, 4-byte aligned.
+   * @param[out] *pAperiodicity  normalized difference at the period in 1.15 format, may be NULL.
+   * @return the period in samples in 16.16 format, or 0 if the frame is unvoiced.
+   */
+
+  q31_t riscv_pitch_yin_q15(
+  const riscv_pitch_yin_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pAperiodicity);
+
+
+  /**
+   * @brief Instance structure for the floating-point sparse FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    float32_t *pState;            /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    float32_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } riscv_fir_sparse_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sparse FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q31_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q31_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } riscv_fir_sparse_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sparse FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q15_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q15_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } riscv_fir_sparse_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q7 sparse FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q7_t *pState;                 /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q7_t *pCoeffs;                /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } riscv_fir_sparse_instance_q7;
+
+  /**
+   * @brief Processing function for the floating-point sparse FIR filter.
+   * @param[in]  *S          points to an instance of the floating-point sparse FIR structure.
+   * @param[in]  *pSrc       points to the block of input data.
+   * @param[out] *pDst       points to the block of output data
+   * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize   number of input samples to process per call.
+   * @return none.
+   */
+
+  void riscv_fir_sparse_f32(
+  riscv_fir_sparse_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pScratchIn,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point sparse FIR filter.
+   * @param[in,out] *S         points to an instance of the floating-point sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the array of filter coefficients.
+   * @param[in]     *pState    points to the state buffer.
+   * @param[in]     *pTapDelay points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @return none
+   */
+
+  void riscv_fir_sparse_init_f32(
+  riscv_fir_sparse_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  int32_t * pTapDelay,
+  uint16_t maxDelay,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 sparse FIR filter.
+   * @param[in]  *S          points to an instance of the Q31 sparse FIR structure.
+   * @param[in]  *pSrc       points to the block of input data.
+   * @param[out] *pDst       points to the block of output data
+   * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize   number of input samples to process per call.
+   * @return none.
+   */
+
+  void riscv_fir_sparse_q31(
+  riscv_fir_sparse_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  q31_t * pScratchIn,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 sparse FIR filter.
+   * @param[in,out] *S         points to an instance of the Q31 sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the array of filter coefficients.
+   * @param[in]     *pState    points to the state buffer.
+   * @param[in]     *pTapDelay points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @return none
+   */
+
+  void riscv_fir_sparse_init_q31(
+  riscv_fir_sparse_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  int32_t * pTapDelay,
+  uint16_t maxDelay,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q15 sparse FIR filter.
+   * @param[in]  *S           points to an instance of the Q15 sparse FIR structure.
+   * @param[in]  *pSrc        points to the block of input data.
+   * @param[out] *pDst        points to the block of output data
+   * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.
+   * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize    number of input samples to process per call.
+   * @return none.
+   */
+
+  void riscv_fir_sparse_q15(
+  riscv_fir_sparse_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  q15_t * pScratchIn,
+  q31_t * pScratchOut,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 sparse FIR filter.
+   * @param[in,out] *S         points to an instance of the Q15 sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the array of filter coefficients.
+   * @param[in]     *pState    points to the state buffer.
+   * @param[in]     *pTapDelay points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @return none
+   */
+
+  void riscv_fir_sparse_init_q15(
+  riscv_fir_sparse_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  int32_t * pTapDelay,
+  uint16_t maxDelay,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q7 sparse FIR filter.
+   * @param[in]  *S           points to an instance of the Q7 sparse FIR structure.
+   * @param[in]  *pSrc        points to the block of input data.
+   * @param[out] *pDst        points to the block of output data
+   * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.
+   * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize    number of input samples to process per call.
+   * @return none.
+   */
+
+  void riscv_fir_sparse_q7(
+  riscv_fir_sparse_instance_q7 * S,
+  q7_t * pSrc,
+  q7_t * pDst,
+  q7_t * pScratchIn,
+  q31_t * pScratchOut,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q7 sparse FIR filter.
+   * @param[in,out] *S         points to an instance of the Q7 sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the array of filter coefficients.
+   * @param[in]     *pState    points to the state buffer.
+   * @param[in]     *pTapDelay points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @return none
+   */
+
+  void riscv_fir_sparse_init_q7(
+  riscv_fir_sparse_instance_q7 * S,
+  uint16_t numTaps,
+  q7_t * pCoeffs,
+  q7_t * pState,
+  int32_t * pTapDelay,
+  uint16_t maxDelay,
+  uint32_t blockSize);
+
+
+  /*
+   * @brief  Floating-point sin_cos function.
+   * @param[in]  theta    input value in degrees
+   * @param[out] *pSinVal points to the processed sine output.
+   * @param[out] *pCosVal points to the processed cos output.
+   * @return none.
+   */
+
+  void riscv_sin_cos_f32(
+  float32_t theta,
+  float32_t * pSinVal,
+  float32_t * pCcosVal);
+
+  /*
+   * @brief  Q31 sin_cos function.
+   * @param[in]  theta    scaled input value in degrees
+   * @param[out] *pSinVal points to the processed sine output.
+   * @param[out] *pCosVal points to the processed cosine output.
+   * @return none.
+   */
+
+  void riscv_sin_cos_q31(
+  q31_t theta,
+  q31_t * pSinVal,
+  q31_t * pCosVal);
+
+  /**
+   * @brief  Floating-point sine and cosine of a block of angles.
+   * @param[in]  *pTheta    points to the input angles in degrees.
+   * @param[out] *pSinVal   points to the sine outputs.
+   * @param[out] *pCosVal   points to the cosine outputs.
+   * @param[in]  blockSize  number of angles to process.
+   * @return none.
+   */
+
+  void riscv_sin_cos_block_f32(
+  float32_t * pTheta,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q31 sine and cosine of a block of angles.
+   * @param[in]  *pTheta    points to the input angles, [-1 0.9999] maps to [-180 180) degrees.
+   * @param[out] *pSinVal   points to the sine outputs.
+   * @param[out] *pCosVal   points to the cosine outputs.
+   * @param[in]  blockSize  number of angles to process.
+   * @return none.
+   */
+
+  void riscv_sin_cos_block_q31(
+  q31_t * pTheta,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point complex conjugate.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_conj_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex conjugate.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_conj_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex conjugate.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_conj_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples);
+
+
+
+  /**
+   * @brief  Floating-point complex magnitude squared
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_squared_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex magnitude squared
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_squared_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex magnitude squared
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_squared_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples);
+
+
+
+ /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup PID PID Motor Control
+   *
+   * A Proportional Integral Derivative (PID) controller is a generic feedback control
+   * loop mechanism widely used in industrial control systems.
+   * A PID controller is the most commonly used type of feedback controller.
+   *
+   * This set of functions implements (PID) controllers
+   * for Q15, Q31, and floating-point data types.  The functions operate on a single sample
+   * of data and each call to the function returns a single processed value.
+   * <code>S</code> points to an instance of the PID control data structure.  <code>in</code>
+   * is the input sample value. The functions return the output value.
+   *
+   * \par Algorithm:
+   * <pre>
+   *    y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]
+   *    A0 = Kp + Ki + Kd
+   *    A1 = (-Kp ) - (2 * Kd )
+   *    A2 = Kd  </pre>
+   *
+   * \par
+   * where \c Kp is proportional constant, \c Ki is Integral constant and \c Kd is Derivative constant
+   *
+   * \par
+   * \image html PID.gif "Proportional Integral Derivative Controller"
+   *
+   * \par
+   * The PID controller calculates an "error" value as the difference between
+   * the measured output and the reference input.
+   * The controller attempts to minimize the error by adjusting the process control inputs.
+   * The proportional value determines the reaction to the current error,
+   * the integral value determines the reaction based on the sum of recent errors,
+   * and the derivative value determines the reaction based on the rate at which the error has been changing.
+   *
+   * \par Instance Structure
+   * The Gains A0, A1, A2 and state variables for a PID controller are stored together in an instance data structure.
+   * A separate instance structure must be defined for each PID Controller.
+   * There are separate instance structure declarations for each of the 3 supported data types.
+   *
+   * \par Reset Functions
+   * There is also an associated reset function for each data type which clears the state array.
+   *
+   * \par Initialization Functions
+   * There is also an associated initialization function for each data type.
+   * The initialization function performs the following operations:
+   * - Initializes the Gains A0, A1, A2 from Kp,Ki, Kd gains.
+   * - Zeros out the values in the state buffer.
+   *
+   * \par
+   * Instance structure cannot be placed into a const data section and it is recommended to use the initialization function.
+   *
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the fixed-point versions of the PID Controller functions.
+   * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+     *
+   * \par Batched Controllers
+   * riscv_pid_batch_f32(), riscv_pid_batch_q31() and riscv_pid_batch_q15() update <code>numLoops</code>
+   * controllers with one call, for example all current and speed loops of a control tick.
+   * <code>pSrc[k]</code> is the input of controller <code>k</code> and <code>pDst[k]</code> its output.
+   * The gains and states of all controllers are stored as arrays of the same field, see the batch instance
+   * structures, so the loop over the controllers walks each array with a single pointer.
+   * \par
+   * When <code>pLimits</code> is not NULL the output of controller <code>k</code> is clamped to
+   * <code>[pLimits[2k], pLimits[2k+1]]</code> before it is stored as <code>y[n-1]</code>.
+   * In the form above <code>y[n-1]</code> carries the integral, so this is also the anti-windup:
+   * the integral stops growing while the output is limited and the output leaves the limit with the first
+   * increment that points back into the range.
+   */
+
+  /**
+   * @addtogroup PID
+   * @{
+   */
+
+  /**
+   * @brief  Process function for the floating-point PID Control.
+   * @param[in,out] S   is an instance of the floating-point PID Control structure
+   * @param[in]     in  input sample to process
+   * @return out processed output sample.
+   */
+  inline static float32_t riscv_pid_f32(
+  riscv_pid_instance_f32 * S,
+  float32_t in)
+  {
+    float32_t out;
+
+    /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]  */
+    out = (S->A0 * in) +
+      (S->A1 * S->state[0]) + (S->A2 * S->state[1]) + (S->state[2]);
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+
+  }
+
+  /**
+   * @brief  Process function for the Q31 PID Control.
+   * @param[in,out] S  points to an instance of the Q31 PID Control structure
+   * @param[in]     in  input sample to process
+   * @return out processed output sample.
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 64-bit accumulator.
+   * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+   * Thus, if the accumulator result overflows it wraps around rather than clip.
+   * In order to avoid overflows completely the input signal must be scaled down by 2 bits as there are four additions.
+   * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format.
+   */
+  inline static q31_t riscv_pid_q31(
+  riscv_pid_instance_q31 * S,
+  q31_t in)
+  {
+    q63_t acc;
+    q31_t out;
+
+    /* acc = A0 * x[n]  */
+    acc = (q63_t) S->A0 * in;
+
+    /* acc += A1 * x[n-1] */
+    acc += (q63_t) S->A1 * S->state[0];
+
+    /* acc += A2 * x[n-2]  */
+    acc += (q63_t) S->A2 * S->state[1];
+
+    /* convert output to 1.31 format to add y[n-1] */
+    out = (q31_t) (acc >> 31u);
+
+    /* out += y[n-1] */
+    out += S->state[2];
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+  }
+
+
+  /**
+   * @brief  Process function for the Q15 PID Control.
+   * @param[in,out] S   points to an instance of the Q15 PID Control structure
+   * @param[in]     in  input sample to process
+   * @return out processed output sample.
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using a 64-bit internal accumulator.
+   * Both Gains and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+   * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+   * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+   * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+   * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+   */
+  inline static q15_t riscv_pid_q15(
+  riscv_pid_instance_q15 * S,
+  q15_t in)
+  {
+    q63_t acc;
+    q15_t out;
+    /* acc = A0 * x[n]  */
+    acc = ((q31_t) S->A0) * in;
+#if defined (USE_DSP_RISCV)
+    shortV Vstate = *(shortV*)S->state;
+    acc += dotpv2(S->A1,Vstate);
+#else
+    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
+    acc += (q31_t) S->A1 * S->state[0];
+    acc += (q31_t) S->A2 * S->state[1];
+    /* acc += y[n-1] */
+#endif
+    acc += (q31_t) S->state[2] << 15;
+
+    /* saturate the output */
+    out = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+  }
+
+  /**
+   * @} end of PID group
+   */
+
+
+  /**
+   * @brief Floating-point matrix inverse.
+   * @param[in]  *src points to the instance of the input floating-point matrix structure.
+   * @param[out] *dst points to the instance of the output floating-point matrix structure.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status RISCV_MATH_SINGULAR.
+   */
+
+  riscv_status riscv_mat_inverse_f32(
+  const riscv_matrix_instance_f32 * src,
+  riscv_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Floating-point matrix inverse.
+   * @param[in]  *src points to the instance of the input floating-point matrix structure.
+   * @param[out] *dst points to the instance of the output floating-point matrix structure.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status RISCV_MATH_SINGULAR.
+   */
+
+  riscv_status riscv_mat_inverse_f64(
+  const riscv_matrix_instance_f64 * src,
+  riscv_matrix_instance_f64 * dst);
+
+  /**
+   * @brief Q31 matrix inverse with block floating-point scaling.
+   * @param[in]  *pSrc points to the instance of the input Q31 matrix structure.
+   * @param[out] *pDst points to the instance of the output matrix structure that receives the mantissas of the inverse.
+   * @param[out] *pState points to a buffer of numRows*numRows words, it may be the data of pSrc.
+   * @param[out] *pExp points to the numCols exponents of the columns of the inverse.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status RISCV_MATH_SINGULAR.
+   */
+
+  riscv_status riscv_mat_inverse_q31(
+  const riscv_matrix_instance_q31 * pSrc,
+  riscv_matrix_instance_q31 * pDst,
+  q31_t * pState,
+  int8_t * pExp);
+
+  /**
+   * @brief Q15 matrix inverse with block floating-point scaling.
+   * @param[in]  *pSrc points to the instance of the input Q15 matrix structure.
+   * @param[out] *pDst points to the instance of the output matrix structure that receives the mantissas of the inverse.
+   * @param[out] *pState points to a buffer of 2*numRows*numRows words.
+   * @param[out] *pExp points to the numCols exponents of the columns of the inverse.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status RISCV_MATH_SINGULAR.
+   */
+
+  riscv_status riscv_mat_inverse_q15(
+  const riscv_matrix_instance_q15 * pSrc,
+  riscv_matrix_instance_q15 * pDst,
+  q31_t * pState,
+  int8_t * pExp);
+
+  /**
+   * @brief Floating-point Cholesky decomposition.
+   * @param[in]  *pSrc points to the instance of the input symmetric positive definite matrix structure.
+   * @param[out] *pDst points to the instance of the output lower triangular matrix structure, it may be the same as pSrc.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the function returns RISCV_MATH_DECOMPOSITION_FAILURE.
+   */
+
+  riscv_status riscv_mat_cholesky_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point LDL^T decomposition.
+   * @param[in]  *pSrc points to the instance of the input symmetric matrix structure.
+   * @param[out] *pL points to the instance of the output unit lower triangular matrix structure, it may be the same as pSrc.
+   * @param[out] *pD points to the output vector of the diagonal elements of D.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of D is zero, then the function returns RISCV_MATH_DECOMPOSITION_FAILURE.
+   */
+
+  riscv_status riscv_mat_ldlt_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pL,
+  float32_t * pD);
+
+
+  /**
+   * @brief Floating-point forward substitution, solves L * X = B.
+   * @param[in]  *pL points to the instance of the lower triangular matrix structure.
+   * @param[in]  *pSrc points to the instance of the right-hand side matrix structure B.
+   * @param[out] *pDst points to the instance of the solution matrix structure X, it may be the same as pSrc.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of L is zero, then the function returns RISCV_MATH_SINGULAR.
+   */
+
+  riscv_status riscv_mat_solve_lower_triangular_f32(
+  const riscv_matrix_instance_f32 * pL,
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point back substitution, solves U * X = B.
+   * @param[in]  *pU points to the instance of the upper triangular matrix structure.
+   * @param[in]  *pSrc points to the instance of the right-hand side matrix structure B.
+   * @param[out] *pDst points to the instance of the solution matrix structure X, it may be the same as pSrc.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of U is zero, then the function returns RISCV_MATH_SINGULAR.
+   */
+
+  riscv_status riscv_mat_solve_upper_triangular_f32(
+  const riscv_matrix_instance_f32 * pU,
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point symmetric positive definite linear solver, solves A * X = B.
+   * @param[in]  *pSrcA points to the instance of the symmetric positive definite matrix structure A.
+   * @param[in]  *pSrcB points to the instance of the right-hand side matrix structure B.
+   * @param[out] *pL points to the instance of the matrix structure that receives the Cholesky factor of A.
+   * @param[out] *pDst points to the instance of the solution matrix structure X, it may be the same as pSrcB.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If A is not positive definite, then the function returns RISCV_MATH_DECOMPOSITION_FAILURE.
+   */
+
+  riscv_status riscv_mat_cholesky_solve_f32(
+  const riscv_matrix_instance_f32 * pSrcA,
+  const riscv_matrix_instance_f32 * pSrcB,
+  riscv_matrix_instance_f32 * pL,
+  riscv_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Double-precision floating-point Cholesky decomposition.
+   * @param[in]  *pSrc points to the instance of the input symmetric positive definite matrix structure.
+   * @param[out] *pDst points to the instance of the output lower triangular matrix structure, it may be the same as pSrc.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the function returns RISCV_MATH_DECOMPOSITION_FAILURE.
+   */
+
+  riscv_status riscv_mat_cholesky_f64(
+  const riscv_matrix_instance_f64 * pSrc,
+  riscv_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Double-precision floating-point LDL^T decomposition.
+   * @param[in]  *pSrc points to the instance of the input symmetric matrix structure.
+   * @param[out] *pL points to the instance of the output unit lower triangular matrix structure, it may be the same as pSrc.
+   * @param[out] *pD points to the output vector of the diagonal elements of D.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of D is zero, then the function returns RISCV_MATH_DECOMPOSITION_FAILURE.
+   */
+
+  riscv_status riscv_mat_ldlt_f64(
+  const riscv_matrix_instance_f64 * pSrc,
+  riscv_matrix_instance_f64 * pL,
+  float64_t * pD);
+
+
+  /**
+   * @brief Double-precision floating-point forward substitution, solves L * X = B.
+   * @param[in]  *pL points to the instance of the lower triangular matrix structure.
+   * @param[in]  *pSrc points to the instance of the right-hand side matrix structure B.
+   * @param[out] *pDst points to the instance of the solution matrix structure X, it may be the same as pSrc.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of L is zero, then the function returns RISCV_MATH_SINGULAR.
+   */
+
+  riscv_status riscv_mat_solve_lower_triangular_f64(
+  const riscv_matrix_instance_f64 * pL,
+  const riscv_matrix_instance_f64 * pSrc,
+  riscv_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Double-precision floating-point back substitution, solves U * X = B.
+   * @param[in]  *pU points to the instance of the upper triangular matrix structure.
+   * @param[in]  *pSrc points to the instance of the right-hand side matrix structure B.
+   * @param[out] *pDst points to the instance of the solution matrix structure X, it may be the same as pSrc.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of U is zero, then the function returns RISCV_MATH_SINGULAR.
+   */
+
+  riscv_status riscv_mat_solve_upper_triangular_f64(
+  const riscv_matrix_instance_f64 * pU,
+  const riscv_matrix_instance_f64 * pSrc,
+  riscv_matrix_instance_f64 * pDst);
+
+
+  /**
+   * @brief Double-precision floating-point symmetric positive definite linear solver, solves A * X = B.
+   * @param[in]  *pSrcA points to the instance of the symmetric positive definite matrix structure A.
+   * @param[in]  *pSrcB points to the instance of the right-hand side matrix structure B.
+   * @param[out] *pL points to the instance of the matrix structure that receives the Cholesky factor of A.
+   * @param[out] *pDst points to the instance of the solution matrix structure X, it may be the same as pSrcB.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If A is not positive definite, then the function returns RISCV_MATH_DECOMPOSITION_FAILURE.
+   */
+
+  riscv_status riscv_mat_cholesky_solve_f64(
+  const riscv_matrix_instance_f64 * pSrcA,
+  const riscv_matrix_instance_f64 * pSrcB,
+  riscv_matrix_instance_f64 * pL,
+  riscv_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Q31 linear solver with block floating-point scaling, solves A * X = B.
+   * @param[in]  *pSrcA points to the instance of the square matrix structure A.
+   * @param[in]  *pSrcB points to the instance of the right-hand side matrix structure B.
+   * @param[out] *pDst points to the instance of the matrix structure that receives the mantissas of X, it may be the same as pSrcB.
+   * @param[out] *pState points to a buffer of numRows*numRows words, it may be the data of pSrcA.
+   * @param[in,out] *pExp points to the numCols exponents of the columns of B on input and of X on output.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If A is singular, then the function returns RISCV_MATH_SINGULAR.
+   */
+
+  riscv_status riscv_mat_solve_q31(
+  const riscv_matrix_instance_q31 * pSrcA,
+  const riscv_matrix_instance_q31 * pSrcB,
+  riscv_matrix_instance_q31 * pDst,
+  q31_t * pState,
+  int8_t * pExp);
+
+  /**
+   * @brief Q15 linear solver with block floating-point scaling, solves A * X = B.
+   * @param[in]  *pSrcA points to the instance of the square matrix structure A.
+   * @param[in]  *pSrcB points to the instance of the right-hand side matrix structure B.
+   * @param[out] *pDst points to the instance of the matrix structure that receives the mantissas of X, it may be the same as pSrcB.
+   * @param[out] *pState points to a buffer of numRows*(numRows+numCols) words.
+   * @param[in,out] *pExp points to the numCols exponents of the columns of B on input and of X on output.
+   * @return The function returns RISCV_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If A is singular, then the function returns RISCV_MATH_SINGULAR.
+   */
+
+  riscv_status riscv_mat_solve_q15(
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst,
+  q31_t * pState,
+  int8_t * pExp);
+
+
+
+  /**
+   * @ingroup groupController
+   */
+
+
+  /**
+   * @defgroup clarke Vector Clarke Transform
+   * Forward Clarke transform converts the instantaneous stator phases into a two-coordinate time invariant vector.
+   * Generally the Clarke transform uses three-phase currents <code>Ia, Ib and Ic</code> to calculate currents
+   * in the two-phase orthogonal stator axis <code>Ialpha</code> and <code>Ibeta</code>.
+   * When <code>Ialpha</code> is superposed with <code>Ia</code> as shown in the figure below
+   * \image html clarke.gif Stator current space vector and its components in (a,b).
+   * and <code>Ia + Ib + Ic = 0</code>, in this condition <code>Ialpha</code> and <code>Ibeta</code>
+   * can be calculated using only <code>Ia</code> and <code>Ib</code>.
+   *
+   * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The library provides separate functions for Q31 and floating-point data types.
+   * \par Algorithm
+   * \image html clarkeFormula.gif
+   * where <code>Ia</code> and <code>Ib</code> are the instantaneous stator phases and
+   * <code>pIalpha</code> and <code>pIbeta</code> are the two coordinates of time invariant vector.
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Clarke transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup clarke
+   * @{
+   */
+
+  /**
+   *
+   * @brief  Floating-point Clarke transform
+   * @param[in]       Ia       input three-phase coordinate <code>a</code>
+   * @param[in]       Ib       input three-phase coordinate <code>b</code>
+   * @param[out]      *pIalpha points to output two-phase orthogonal vector axis alpha
+   * @param[out]      *pIbeta  points to output two-phase orthogonal vector axis beta
+   * @return none.
+   */
+
+  inline static void riscv_clarke_f32(
+  float32_t Ia,
+  float32_t Ib,
+  float32_t * pIalpha,
+  float32_t * pIbeta)
+  {
+    /* Calculate pIalpha using the equation, pIalpha = Ia */
+    *pIalpha = Ia;
+
+    /* Calculate pIbeta using the equation, pIbeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+    *pIbeta =
+      ((float32_t) 0.57735026919 * Ia + (float32_t) 1.15470053838 * Ib);
+
+  }
+
+  /**
+   * @brief  Clarke transform for Q31 version
+   * @param[in]       Ia       input three-phase coordinate <code>a</code>
+   * @param[in]       Ib       input three-phase coordinate <code>b</code>
+   * @param[out]      *pIalpha points to output two-phase orthogonal vector axis alpha
+   * @param[out]      *pIbeta  points to output two-phase orthogonal vector axis beta
+   * @return none.
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the addition, hence there is no risk of overflow.
+   */
+  inline static void riscv_clarke_q31(
+  q31_t Ia,
+  q31_t Ib,
+  q31_t * pIalpha,
+  q31_t * pIbeta)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+
+    /* Calculating pIalpha from Ia by equation pIalpha = Ia */
+    *pIalpha = Ia;
+
+    /* Intermediate product is calculated by (1/(sqrt(3)) * Ia) */
+    product1 = (q31_t) (((q63_t) Ia * 0x24F34E8B) >> 30);
+
+    /* Intermediate product is calculated by (2/sqrt(3) * Ib) */
+    product2 = (q31_t) (((q63_t) Ib * 0x49E69D16) >> 30);
+
+    /* pIbeta is calculated by adding the intermediate products */
+    *pIbeta = __SSAT(product1 + product2,32);
+}
+
+  /**
+   * @} end of clarke group
+   */
+
+  /**
+   * @brief  Converts the elements of the Q7 vector to Q31 vector.
+   * @param[in]  *pSrc     input pointer
+   * @param[out]  *pDst    output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void riscv_q7_to_q31(
+  q7_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup inv_clarke Vector Inverse Clarke Transform
+   * Inverse Clarke transform converts the two-coordinate time invariant vector into instantaneous stator phases.
+   *
+   * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The library provides separate functions for Q31 and floating-point data types.
+   * \par Algorithm
+   * \image html clarkeInvFormula.gif
+   * where <code>pIa</code> and <code>pIb</code> are the instantaneous stator phases and
+   * <code>Ialpha</code> and <code>Ibeta</code> are the two coordinates of time invariant vector.
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Clarke transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup inv_clarke
+   * @{
+   */
+
+   /**
+   * @brief  Floating-point Inverse Clarke transform
+   * @param[in]       Ialpha  input two-phase orthogonal vector axis alpha
+   * @param[in]       Ibeta   input two-phase orthogonal vector axis beta
+   * @param[out]      *pIa    points to output three-phase coordinate <code>a</code>
+   * @param[out]      *pIb    points to output three-phase coordinate <code>b</code>
+   * @return none.
+   */
+
+
+  static inline void riscv_inv_clarke_f32(
+  float32_t Ialpha,
+  float32_t Ibeta,
+  float32_t * pIa,
+  float32_t * pIb)
+  {
+    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
+    *pIa = Ialpha;
+
+    /* Calculating pIb from Ialpha and Ibeta by equation pIb = -(1/2) * Ialpha + (sqrt(3)/2) * Ibeta */
+    *pIb = -0.5 * Ialpha + (float32_t) 0.8660254039 *Ibeta;
+
+  }
+
+  /**
+   * @brief  Inverse Clarke transform for Q31 version
+   * @param[in]       Ialpha  input two-phase orthogonal vector axis alpha
+   * @param[in]       Ibeta   input two-phase orthogonal vector axis beta
+   * @param[out]      *pIa    points to output three-phase coordinate <code>a</code>
+   * @param[out]      *pIb    points to output three-phase coordinate <code>b</code>
+   * @return none.
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the subtraction, hence there is no risk of overflow.
+   */
+
+  inline static void riscv_inv_clarke_q31(
+  q31_t Ialpha,
+  q31_t Ibeta,
+  q31_t * pIa,
+  q31_t * pIb)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+
+    /* Calculating pIa from Ialpha by equation pIa = Ialpha */
+    *pIa = Ialpha;
+
+    /* Intermediate product is calculated by (1/(2*sqrt(3)) * Ia) */
+    product1 = (q31_t) (((q63_t) (Ialpha) * (0x40000000)) >> 31);
+
+    /* Intermediate product is calculated by (1/sqrt(3) * pIb) */
+    product2 = (q31_t) (((q63_t) (Ibeta) * (0x6ED9EBA1)) >> 31);
+
+    /* pIb is calculated by subtracting the products */
+    *pIb = __SSAT(product2 - product1, 32);
+}
+
+  /**
+   * @brief  Converts the elements of the Q7 vector to Q15 vector.
+   * @param[in]  *pSrc     input pointer
+   * @param[out] *pDst     output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void riscv_q7_to_q15(
+  q7_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup park Vector Park Transform
+   *
+   * Forward Park transform converts the input two-coordinate vector to flux and torque components.
+   * The Park transform can be used to realize the transformation of the <code>Ialpha</code> and the <code>Ibeta</code> currents
+   * from the stationary to the moving reference frame and control the spatial relationship between
+   * the stator vector current and rotor flux vector.
+   * If we consider the d axis aligned with the rotor flux, the diagram below shows the
+   * current vector and the relationship from the two reference frames:
+   * \image html park.gif "Stator current space vector and its component in (a,b) and in the d,q rotating reference frame"
+   *
+   * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The library provides separate functions for Q31 and floating-point data types.
+   * \par Algorithm
+   * \image html parkFormula.gif
+   * where <code>Ialpha</code> and <code>Ibeta</code> are the stator vector components,
+   * <code>pId</code> and <code>pIq</code> are rotor vector components and <code>cosVal</code> and <code>sinVal</code> are the
+   * cosine and sine values of theta (rotor flux position).
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Park transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup park
+   * @{
+   */
+
+  /**
+   * @brief Floating-point Park transform
+   * @param[in]       Ialpha input two-phase vector coordinate alpha
+   * @param[in]       Ibeta  input two-phase vector coordinate beta
+   * @param[out]      *pId   points to output	rotor reference frame d
+   * @param[out]      *pIq   points to output	rotor reference frame q
+   * @param[in]       sinVal sine value of rotation angle theta
+   * @param[in]       cosVal cosine value of rotation angle theta
+   * @return none.
+   *
+   * The function implements the forward Park transform.
+   *
+   */
+
+  static inline void riscv_park_f32(
+  float32_t Ialpha,
+  float32_t Ibeta,
+  float32_t * pId,
+  float32_t * pIq,
+  float32_t sinVal,
+  float32_t cosVal)
+  {
+    /* Calculate pId using the equation, pId = Ialpha * cosVal + Ibeta * sinVal */
+    *pId = Ialpha * cosVal + Ibeta * sinVal;
+
+    /* Calculate pIq using the equation, pIq = - Ialpha * sinVal + Ibeta * cosVal */
+    *pIq = -Ialpha * sinVal + Ibeta * cosVal;
+
+  }
+
+  /**
+   * @brief  Park transform for Q31 version
+   * @param[in]       Ialpha input two-phase vector coordinate alpha
+   * @param[in]       Ibeta  input two-phase vector coordinate beta
+   * @param[out]      *pId   points to output rotor reference frame d
+   * @param[out]      *pIq   points to output rotor reference frame q
+   * @param[in]       sinVal sine value of rotation angle theta
+   * @param[in]       cosVal cosine value of rotation angle theta
+   * @return none.
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the addition and subtraction, hence there is no risk of overflow.
+   */
+  static inline void riscv_park_q31(
+  q31_t Ialpha,
+  q31_t Ibeta,
+  q31_t * pId,
+  q31_t * pIq,
+  q31_t sinVal,
+  q31_t cosVal)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+    q31_t product3, product4;                    /* Temporary variables used to store intermediate results */
+
+    /* Intermediate product is calculated by (Ialpha * cosVal) */
+    product1 = (q31_t) (((q63_t) (Ialpha) * (cosVal)) >> 31);
+
+    /* Intermediate product is calculated by (Ibeta * sinVal) */
+    product2 = (q31_t) (((q63_t) (Ibeta) * (sinVal)) >> 31);
+
+    /* Intermediate product is calculated by (Ialpha * sinVal) */
+    product3 = (q31_t) (((q63_t) (Ialpha) * (sinVal)) >> 31);
+
+    /* Intermediate product is calculated by (Ibeta * cosVal) */
+    product4 = (q31_t) (((q63_t) (Ibeta) * (cosVal)) >> 31);
+
+    /* Calculate pId by adding the two intermediate products 1 and 2 */
+    *pId = __SSAT(product1 + product2,32);
+
+    /* Calculate pIq by subtracting the two intermediate products 3 from 4 */
+    *pIq = __SSAT(product4 - product3,32);
+}
+
+  /**
+   * @} end of park group
+   */
+
+  /**
+   * @brief  Converts the elements of the Q7 vector to floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @return none.
+   */
+  void riscv_q7_to_float(
+  q7_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup inv_park Vector Inverse Park transform
+   * Inverse Park transform converts the input flux and torque components to two-coordinate vector.
+   *
+   * The function operates on a single sample of data and each call to the function returns the processed output.
+   * The library provides separate functions for Q31 and floating-point data types.
+   * \par Algorithm
+   * \image html parkInvFormula.gif
+   * where <code>pIalpha</code> and <code>pIbeta</code> are the stator vector components,
+   * <code>Id</code> and <code>Iq</code> are rotor vector components and <code>cosVal</code> and <code>sinVal</code> are the
+   * cosine and sine values of theta (rotor flux position).
+   * \par Fixed-Point Behavior
+   * Care must be taken when using the Q31 version of the Park transform.
+   * In particular, the overflow and saturation behavior of the accumulator used must be considered.
+   * Refer to the function specific documentation below for usage guidelines.
+   */
+
+  /**
+   * @addtogroup inv_park
+   * @{
+   */
+
+   /**
+   * @brief  Floating-point Inverse Park transform
+   * @param[in]       Id        input coordinate of rotor reference frame d
+   * @param[in]       Iq        input coordinate of rotor reference frame q
+   * @param[out]      *pIalpha  points to output two-phase orthogonal vector axis alpha
+   * @param[out]      *pIbeta   points to output two-phase orthogonal vector axis beta
+   * @param[in]       sinVal    sine value of rotation angle theta
+   * @param[in]       cosVal    cosine value of rotation angle theta
+   * @return none.
+   */
+
+  static inline void riscv_inv_park_f32(
+  float32_t Id,
+  float32_t Iq,
+  float32_t * pIalpha,
+  float32_t * pIbeta,
+  float32_t sinVal,
+  float32_t cosVal)
+  {
+    /* Calculate pIalpha using the equation, pIalpha = Id * cosVal - Iq * sinVal */
+    *pIalpha = Id * cosVal - Iq * sinVal;
+
+    /* Calculate pIbeta using the equation, pIbeta = Id * sinVal + Iq * cosVal */
+    *pIbeta = Id * sinVal + Iq * cosVal;
+
+  }
+
+
+  /**
+   * @brief  Inverse Park transform for	Q31 version
+   * @param[in]       Id        input coordinate of rotor reference frame d
+   * @param[in]       Iq        input coordinate of rotor reference frame q
+   * @param[out]      *pIalpha  points to output two-phase orthogonal vector axis alpha
+   * @param[out]      *pIbeta   points to output two-phase orthogonal vector axis beta
+   * @param[in]       sinVal    sine value of rotation angle theta
+   * @param[in]       cosVal    cosine value of rotation angle theta
+   * @return none.
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 32-bit accumulator.
+   * The accumulator maintains 1.31 format by truncating lower 31 bits of the intermediate multiplication in 2.62 format.
+   * There is saturation on the addition, hence there is no risk of overflow.
+   */
+  inline static void riscv_inv_park_q31(
+  q31_t Id,
+  q31_t Iq,
+  q31_t * pIalpha,
+  q31_t * pIbeta,
+  q31_t sinVal,
+  q31_t cosVal)
+  {
+    q31_t product1, product2;                    /* Temporary variables used to store intermediate results */
+    q31_t product3, product4;                    /* Temporary variables used to store intermediate results */
+
+    /* Intermediate product is calculated by (Id * cosVal) */
+    product1 = (q31_t) (((q63_t) (Id) * (cosVal)) >> 31);
+
+    /* Intermediate product is calculated by (Iq * sinVal) */
+    product2 = (q31_t) (((q63_t) (Iq) * (sinVal)) >> 31);
+
+
+    /* Intermediate product is calculated by (Id * sinVal) */
+    product3 = (q31_t) (((q63_t) (Id) * (sinVal)) >> 31);
+
+    /* Intermediate product is calculated by (Iq * cosVal) */
+    product4 = (q31_t) (((q63_t) (Iq) * (cosVal)) >> 31);
+
+    /* Calculate pIalpha by using the two intermediate products 1 and 2 */
+    *pIalpha = __SSAT(product1 - product2,32);
+
+    /* Calculate pIbeta by using the two intermediate products 3 and 4 */
+    *pIbeta = __SSAT(product4 + product3,32 );
+}
+
+
+  /**
+   * @} end of Inverse park group
+   */
+
+  /**
+   * @brief  Floating-point field-oriented control step.
+   * @param[in,out] *S      points to an instance of the floating-point FOC structure.
+   * @param[in]     Ia      measured phase current a.
+   * @param[in]     Ib      measured phase current b.
+   * @param[in]     theta   rotor flux angle in degrees.
+   * @param[in]     IdRef   reference of the d current.
+   * @param[in]     IqRef   reference of the q current.
+   * @param[out]    *pVa    points to the phase voltage a.
+   * @param[out]    *pVb    points to the phase voltage b.
+   * @return none.
+   */
+
+  void riscv_foc_step_f32(
+  riscv_foc_instance_f32 * S,
+  float32_t Ia,
+  float32_t Ib,
+  float32_t theta,
+  float32_t IdRef,
+  float32_t IqRef,
+  float32_t * pVa,
+  float32_t * pVb);
+
+  /**
+   * @brief  Q31 field-oriented control step.
+   * @param[in,out] *S      points to an instance of the Q31 FOC structure.
+   * @param[in]     Ia      measured phase current a.
+   * @param[in]     Ib      measured phase current b.
+   * @param[in]     theta   rotor flux angle, [-1 0.9999] maps to [-180 180) degrees.
+   * @param[in]     IdRef   reference of the d current.
+   * @param[in]     IqRef   reference of the q current.
+   * @param[out]    *pVa    points to the phase voltage a.
+   * @param[out]    *pVb    points to the phase voltage b.
+   * @return none.
+   */
+
+  void riscv_foc_step_q31(
+  riscv_foc_instance_q31 * S,
+  q31_t Ia,
+  q31_t Ib,
+  q31_t theta,
+  q31_t IdRef,
+  q31_t IqRef,
+  q31_t * pVa,
+  q31_t * pVb);
+
+  /**
+   * @brief  Floating-point Hamilton product of quaternions.
+   * @param[in]   *pSrcA          points to the first quaternions.
+   * @param[in]   *pSrcB          points to the second quaternions.
+   * @param[out]  *pDst           points to the products <code>a b</code>.
+   * @param[in]   numQuaternions  number of quaternions.
+   * @return none.
+   */
+
+  void riscv_quaternion_product_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t numQuaternions);
+
+  /**
+   * @brief  Q31 Hamilton product of quaternions.
+   * @param[in]   *pSrcA          points to the first quaternions.
+   * @param[in]   *pSrcB          points to the second quaternions.
+   * @param[out]  *pDst           points to the products <code>a b</code>.
+   * @param[in]   numQuaternions  number of quaternions.
+   * @return none.
+   */
+
+  void riscv_quaternion_product_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t numQuaternions);
+
+  /**
+   * @brief  Floating-point conjugate of quaternions.
+   * @param[in]   *pSrc           points to the quaternions.
+   * @param[out]  *pDst           points to the conjugates <code>w - x i - y j - z k</code>.
+   * @param[in]   numQuaternions  number of quaternions.
+   * @return none.
+   */
+
+  void riscv_quaternion_conjugate_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numQuaternions);
+
+  /**
+   * @brief  Q31 conjugate of quaternions.
+   * @param[in]   *pSrc           points to the quaternions.
+   * @param[out]  *pDst           points to the conjugates <code>w - x i - y j - z k</code>.
+   * @param[in]   numQuaternions  number of quaternions.
+   * @return none.
+   */
+
+  void riscv_quaternion_conjugate_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numQuaternions);
+
+  /**
+   * @brief  Floating-point normalization of quaternions.
+   * @param[in]   *pSrc           points to the quaternions.
+   * @param[out]  *pDst           points to the unit quaternions.
+   * @param[in]   numQuaternions  number of quaternions.
+   * @return none.
+   */
+
+  void riscv_quaternion_normalize_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numQuaternions);
+
+  /**
+   * @brief  Q31 normalization of quaternions.
+   * @param[in]   *pSrc           points to the quaternions.
+   * @param[out]  *pDst           points to the unit quaternions.
+   * @param[in]   numQuaternions  number of quaternions.
+   * @return none.
+   */
+
+  void riscv_quaternion_normalize_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numQuaternions);
+
+  /**
+   * @brief  Floating-point rotation of 3-vectors by unit quaternions.
+   * @param[in]   *pQuat          points to the unit quaternions.
+   * @param[in]   *pSrc           points to the 3 arrays of <code>numQuaternions</code> input components.
+   * @param[out]  *pDst           points to the 3 arrays of <code>numQuaternions</code> rotated components.
+   * @param[in]   numQuaternions  number of quaternions and of vectors.
+   * @return none.
+   */
+
+  void riscv_quaternion_rotate_f32(
+  const float32_t * pQuat,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numQuaternions);
+
+  /**
+   * @brief  Q31 rotation of 3-vectors by unit quaternions.
+   * @param[in]   *pQuat          points to the unit quaternions.
+   * @param[in]   *pSrc           points to the 3 arrays of <code>numQuaternions</code> input components.
+   * @param[out]  *pDst           points to the 3 arrays of <code>numQuaternions</code> rotated components.
+   * @param[in]   numQuaternions  number of quaternions and of vectors.
+   * @return none.
+   */
+
+  void riscv_quaternion_rotate_q31(
+  const q31_t * pQuat,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numQuaternions);
+
+  /**
+   * @brief  Floating-point conversion of unit quaternions to 3x3 rotation matrices.
+   * @param[in]   *pQuat          points to the unit quaternions.
+   * @param[out]  *pDst           points to the 9 arrays of <code>numQuaternions</code> matrix elements.
+   * @param[in]   numQuaternions  number of quaternions.
+   * @return none.
+   */
+
+  void riscv_quaternion2rotation_f32(
+  const float32_t * pQuat,
+  float32_t * pDst,
+  uint32_t numQuaternions);
+
+  /**
+   * @brief  Q31 conversion of unit quaternions to 3x3 rotation matrices.
+   * @param[in]   *pQuat          points to the unit quaternions.
+   * @param[out]  *pDst           points to the 9 arrays of <code>numQuaternions</code> matrix elements.
+   * @param[in]   numQuaternions  number of quaternions.
+   * @return none.
+   */
+
+  void riscv_quaternion2rotation_q31(
+  const q31_t * pQuat,
+  q31_t * pDst,
+  uint32_t numQuaternions);
+
+
+  /**
+   * @brief  Converts the elements of the Q31 vector to floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @return none.
+   */
+  void riscv_q31_to_float(
+  q31_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @ingroup groupInterpolation
+   */
+
+  /**
+   * @defgroup LinearInterpolate Linear Interpolation
+   *
+   * Linear interpolation is a method of curve fitting using linear polynomials.
+   * Linear interpolation works by effectively drawing a straight line between two neighboring samples and returning the appropriate point along that line
+   *
+   * \par
+   * \image html LinearInterp.gif "Linear interpolation"
+   *
+   * \par
+   * A  Linear Interpolate function calculates an output value(y), for the input(x)
+   * using linear interpolation of the input values x0, x1( nearest input values) and the output values y0 and y1(nearest output values)
+   *
+   * \par Algorithm:
+   * <pre>
+   *       y = y0 + (x - x0) * ((y1 - y0)/(x1-x0))
+   *       where x0, x1 are nearest values of input x
+   *             y0, y1 are nearest values to output y
+   * </pre>
+   *
+   * \par
+   * This set of functions implements Linear interpolation process
+   * for Q7, Q15, Q31, and floating-point data types.  The functions operate on a single
+   * sample of data and each call to the function returns a single processed value.
+   * <code>S</code> points to an instance of the Linear Interpolate function data structure.
+   * <code>x</code> is the input sample value. The functions returns the output value.
+   *
+   * \par
+   * if x is outside of the table boundary, Linear interpolation returns first value of the table
+   * if x is below input range and returns last value of table if x is above range.
+   *
+   * \par Block Functions
+   * riscv_linear_interp_block_f32(), riscv_linear_interp_block_q31(), riscv_linear_interp_block_q15() and
+   * riscv_linear_interp_block_q7() interpolate an array of <code>blockSize</code> points in one call and
+   * riscv_linear_interp_uniform_f32() and riscv_linear_interp_uniform_q15() the points <code>x + n*step</code>,
+   * for example to resample a table.  The fixed-point points are in 12.20 format as for the single point functions.
+   * Every point below the range, negative ones included, returns the first value of the table and every
+   * point at or above the last value of the table returns the last value.
+   */
+
+  /**
+   * @addtogroup LinearInterpolate
+   * @{
+   */
+
+  /**
+   * @brief  Process function for the floating-point Linear Interpolation Function.
+   * @param[in,out] *S is an instance of the floating-point Linear Interpolation structure
+   * @param[in] x input sample to process
+   * @return y processed output sample.
+   *
+   */
+
+  static inline float32_t riscv_linear_interp_f32(
+  riscv_linear_interp_instance_f32 * S,
+  float32_t x)
+  {
+
+    float32_t y;
+    float32_t x0, x1;                            /* Nearest input values */
+    float32_t y0, y1;                            /* Nearest output values */
+    float32_t xSpacing = S->xSpacing;            /* spacing between input values */
+    int32_t i;                                   /* Index variable */
+    float32_t *pYData = S->pYData;               /* pointer to output table */
+
+    /* Calculation of index */
+    i = (int32_t) ((x - S->x1) / xSpacing);
+
+    if(i < 0)
+    {
+      /* Iniatilize output for below specified range as least output value of table */
+      y = pYData[0];
+    }
+    else if((uint32_t)i >= S->nValues)
+    {
+      /* Iniatilize output for above specified range as last output value of table */
+      y = pYData[S->nValues - 1];
+    }
+    else
+    {
+      /* Calculation of nearest input values */
+      x0 = S->x1 + i * xSpacing;
+      x1 = S->x1 + (i + 1) * xSpacing;
+
+      /* Read of nearest output values */
+      y0 = pYData[i];
+      y1 = pYData[i + 1];
+
+      /* Calculation of output */
+      y = y0 + (x - x0) * ((y1 - y0) / (x1 - x0));
+
+    }
+
+    /* returns output value */
+    return (y);
+  }
+
+   /**
+   *
+   * @brief  Process function for the Q31 Linear Interpolation Function.
+   * @param[in] *pYData  pointer to Q31 Linear Interpolation table
+   * @param[in] x input sample to process
+   * @param[in] nValues number of table values
+   * @return y processed output sample.
+   *
+   * \par
+   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
+   * This function can support maximum of table size 2^12.
+   *
+   */
+
+
+  static inline q31_t riscv_linear_interp_q31(
+  q31_t * pYData,
+  q31_t x,
+  uint32_t nValues)
+  {
+    q31_t y;                                     /* output */
+    q31_t y0, y1;                                /* Nearest output values */
+    q31_t fract;                                 /* fractional part */
+    int32_t index;                               /* Index to read nearest output values */
+
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    index = ((x & 0xFFF00000) >> 20);
+
+    if(index >= (int32_t)(nValues - 1))
+    {
+      return (pYData[nValues - 1]);
+    }
+    else if(index < 0)
+    {
+      return (pYData[0]);
+    }
+    else
+    {
+
+      /* 20 bits for the fractional part */
+      /* shift left by 11 to keep fract in 1.31 format */
+      fract = (x & 0x000FFFFF) << 11;
+
+      /* Read two nearest output values from the index in 1.31(q31) format */
+      y0 = pYData[index];
+      y1 = pYData[index + 1u];
+
+      /* Calculation of y0 * (1-fract) and y is in 2.30 format */
+      y = ((q31_t) ((q63_t) y0 * (0x7FFFFFFF - fract) >> 32));
+
+      /* Calculation of y0 * (1-fract) + y1 *fract and y is in 2.30 format */
+      y += ((q31_t) (((q63_t) y1 * fract) >> 32));
+
+      /* Convert y to 1.31 format */
+      return (y << 1u);
+
+    }
+
+  }
+
+  /**
+   *
+   * @brief  Process function for the Q15 Linear Interpolation Function.
+   * @param[in] *pYData  pointer to Q15 Linear Interpolation table
+   * @param[in] x input sample to process
+   * @param[in] nValues number of table values
+   * @return y processed output sample.
+   *
+   * \par
+   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
+   * This function can support maximum of table size 2^12.
+   *
+   */
+
+
+  static inline q15_t riscv_linear_interp_q15(
+  q15_t * pYData,
+  q31_t x,
+  uint32_t nValues)
+  {
+    q63_t y;                                     /* output */
+    q15_t y0, y1;                                /* Nearest output values */
+    q31_t fract;                                 /* fractional part */
+    int32_t index;                               /* Index to read nearest output values */
+
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    index = ((x & 0xFFF00000) >> 20u);
+
+    if(index >= (int32_t)(nValues - 1))
+    {
+      return (pYData[nValues - 1]);
+    }
+    else if(index < 0)
+    {
+      return (pYData[0]);
+    }
+    else
+    {
+      /* 20 bits for the fractional part */
+      /* fract is in 12.20 format */
+      fract = (x & 0x000FFFFF);
+
+      /* Read two nearest output values from the index */
+      y0 = pYData[index];
+      y1 = pYData[index + 1u];
+
+      /* Calculation of y0 * (1-fract) and y is in 13.35 format */
+      y = ((q63_t) y0 * (0xFFFFF - fract));
+
+      /* Calculation of (y0 * (1-fract) + y1 * fract) and y is in 13.35 format */
+      y += ((q63_t) y1 * (fract));
+
+      /* convert y to 1.15 format */
+      return (y >> 20);
+    }
+
+
+  }
+
+  /**
+   *
+   * @brief  Process function for the Q7 Linear Interpolation Function.
+   * @param[in] *pYData  pointer to Q7 Linear Interpolation table
+   * @param[in] x input sample to process
+   * @param[in] nValues number of table values
+   * @return y processed output sample.
+   *
+   * \par
+   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
+   * This function can support maximum of table size 2^12.
+   */
+
+
+  static inline q7_t riscv_linear_interp_q7(
+  q7_t * pYData,
+  q31_t x,
+  uint32_t nValues)
+  {
+    q31_t y;                                     /* output */
+    q7_t y0, y1;                                 /* Nearest output values */
+    q31_t fract;                                 /* fractional part */
+    uint32_t index;                              /* Index to read nearest output values */
+
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    if (x < 0)
+    {
+      return (pYData[0]);
+    }
+    index = (x >> 20) & 0xfff;
+
+
+    if(index >= (nValues - 1))
+    {
+      return (pYData[nValues - 1]);
+    }
+    else
+    {
+
+      /* 20 bits for the fractional part */
+      /* fract is in 12.20 format */
+      fract = (x & 0x000FFFFF);
+
+      /* Read two nearest output values from the index and are in 1.7(q7) format */
+      y0 = pYData[index];
+      y1 = pYData[index + 1u];
+
+      /* Calculation of y0 * (1-fract ) and y is in 13.27(q27) format */
+      y = ((y0 * (0xFFFFF - fract)));
+
+      /* Calculation of y1 * fract + y0 * (1-fract) and y is in 13.27(q27) format */
+      y += (y1 * fract);
+
+      /* convert y to 1.7(q7) format */
+      return (y >> 20u);
+
+    }
+
+  }
+  /**
+   * @} end of LinearInterpolate group
+   */
+
+  /**
+   * @brief  Floating-point linear interpolation of a block of points.
+   * @param[in]  *S         points to an instance of the Linear Interpolation structure.
+   * @param[in]  *pX        points to the points.
+   * @param[out] *pDst      points to the interpolated outputs.
+   * @param[in]  blockSize  number of points.
+   * @return none.
+   */
+
+  void riscv_linear_interp_block_f32(
+  const riscv_linear_interp_instance_f32 * S,
+  float32_t * pX,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point linear interpolation of the points x + n*step.
+   * @param[in]  *S         points to an instance of the Linear Interpolation structure.
+   * @param[in]  x          first point.
+   * @param[in]  step       distance between two points.
+   * @param[out] *pDst      points to the interpolated outputs.
+   * @param[in]  blockSize  number of points.
+   * @return none.
+   */
+
+  void riscv_linear_interp_uniform_f32(
+  const riscv_linear_interp_instance_f32 * S,
+  float32_t x,
+  float32_t step,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q31 linear interpolation of a block of points.
+   * @param[in]  *pYData    points to the table of values.
+   * @param[in]  nValues    number of values in the table.
+   * @param[in]  *pX        points to the points in 12.20 format.
+   * @param[out] *pDst      points to the interpolated outputs.
+   * @param[in]  blockSize  number of points.
+   * @return none.
+   */
+
+  void riscv_linear_interp_block_q31(
+  const q31_t * pYData,
+  uint32_t nValues,
+  q31_t * pX,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q15 linear interpolation of a block of points.
+   * @param[in]  *pYData    points to the table of values.
+   * @param[in]  nValues    number of values in the table.
+   * @param[in]  *pX        points to the points in 12.20 format.
+   * @param[out] *pDst      points to the interpolated outputs.
+   * @param[in]  blockSize  number of points.
+   * @return none.
+   */
+
+  void riscv_linear_interp_block_q15(
+  const q15_t * pYData,
+  uint32_t nValues,
+  q31_t * pX,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q15 linear interpolation of the points x + n*step.
+   * @param[in]  *pYData    points to the table of values.
+   * @param[in]  nValues    number of values in the table.
+   * @param[in]  x          first point in 12.20 format.
+   * @param[in]  step       distance between two points in 12.20 format.
+   * @param[out] *pDst      points to the interpolated outputs.
+   * @param[in]  blockSize  number of points.
+   * @return none.
+   */
+
+  void riscv_linear_interp_uniform_q15(
+  const q15_t * pYData,
+  uint32_t nValues,
+  q31_t x,
+  q31_t step,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q7 linear interpolation of a block of points.
+   * @param[in]  *pYData    points to the table of values.
+   * @param[in]  nValues    number of values in the table.
+   * @param[in]  *pX        points to the points in 12.20 format.
+   * @param[out] *pDst      points to the interpolated outputs.
+   * @param[in]  blockSize  number of points.
+   * @return none.
+   */
+
+  void riscv_linear_interp_block_q7(
+  const q7_t * pYData,
+  uint32_t nValues,
+  q31_t * pX,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fast approximation to the trigonometric sine function for floating-point data.
+   * @param[in] x input value in radians.
+   * @return  sin(x).
+   */
+
+  float32_t riscv_sin_f32(
+  float32_t x);
+
+  /**
+   * @brief  Fast approximation to the trigonometric sine function for Q31 data.
+   * @param[in] x Scaled input value in radians.
+   * @return  sin(x).
+   */
+
+  q31_t riscv_sin_q31(
+  q31_t x);
+
+  /**
+   * @brief  Fast approximation to the trigonometric sine function for Q15 data.
+   * @param[in] x Scaled input value in radians.
+   * @return  sin(x).
+   */
+
+  q15_t riscv_sin_q15(
+  q15_t x);
+
+  /**
+   * @brief  Fast approximation to the trigonometric cosine function for floating-point data.
+   * @param[in] x input value in radians.
+   * @return  cos(x).
+   */
+
+  float32_t riscv_cos_f32(
+  float32_t x);
+
+  /**
+   * @brief Fast approximation to the trigonometric cosine function for Q31 data.
+   * @param[in] x Scaled input value in radians.
+   * @return  cos(x).
+   */
+
+  q31_t riscv_cos_q31(
+  q31_t x);
+
+  /**
+   * @brief  Fast approximation to the trigonometric cosine function for Q15 data.
+   * @param[in] x Scaled input value in radians.
+   * @return  cos(x).
+   */
+
+  q15_t riscv_cos_q15(
+  q15_t x);
+
+  /**
+   * @brief  Sine of a floating-point vector.
+   * @param[in]  *pSrc      points to the input vector, angles in radians.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+
+  void riscv_sin_vec_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Sine of a Q31 vector.
+   * @param[in]  *pSrc      points to the input vector, scaled angles.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+
+  void riscv_sin_vec_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Sine of a Q15 vector.
+   * @param[in]  *pSrc      points to the input vector, scaled angles.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+
+  void riscv_sin_vec_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Cosine of a floating-point vector.
+   * @param[in]  *pSrc      points to the input vector, angles in radians.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+
+  void riscv_cos_vec_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Cosine of a Q31 vector.
+   * @param[in]  *pSrc      points to the input vector, scaled angles.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+
+  void riscv_cos_vec_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Cosine of a Q15 vector.
+   * @param[in]  *pSrc      points to the input vector, scaled angles.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+
+  void riscv_cos_vec_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point NCO.
+   */
+
+  typedef struct
+  {
+    uint32_t phase;            /**< phase of the next sample, one turn is 2^32. */
+    uint32_t phaseInc;         /**< phase increment per sample. */
+  } riscv_nco_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 NCO.
+   */
+
+  typedef struct
+  {
+    uint32_t phase;            /**< phase of the next sample, one turn is 2^32. */
+    uint32_t phaseInc;         /**< phase increment per sample. */
+  } riscv_nco_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 NCO.
+   */
+
+  typedef struct
+  {
+    uint32_t phase;            /**< phase of the next sample, one turn is 2^32. */
+    uint32_t phaseInc;         /**< phase increment per sample. */
+  } riscv_nco_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point NCO.
+   * @param[in,out] *S          points to an instance of the floating-point NCO structure.
+   * @param[in]     startPhase  phase of the first sample in radians.
+   * @param[in]     phaseInc    phase increment per sample in radians.
+   * @return none.
+   */
+
+  void riscv_nco_init_f32(
+  riscv_nco_instance_f32 * S,
+  float32_t startPhase,
+  float32_t phaseInc);
+
+  /**
+   * @brief  Initialization function for the Q31 NCO.
+   * @param[in,out] *S          points to an instance of the Q31 NCO structure.
+   * @param[in]     startPhase  phase of the first sample, [0 +1) maps to [0 2*pi).
+   * @param[in]     phaseInc    phase increment per sample, same scaling.
+   * @return none.
+   */
+
+  void riscv_nco_init_q31(
+  riscv_nco_instance_q31 * S,
+  q31_t startPhase,
+  q31_t phaseInc);
+
+  /**
+   * @brief  Initialization function for the Q15 NCO.
+   * @param[in,out] *S          points to an instance of the Q15 NCO structure.
+   * @param[in]     startPhase  phase of the first sample, [0 +1) maps to [0 2*pi).
+   * @param[in]     phaseInc    phase increment per sample in Q31, same scaling.
+   * @return none.
+   */
+
+  void riscv_nco_init_q15(
+  riscv_nco_instance_q15 * S,
+  q15_t startPhase,
+  q31_t phaseInc);
+
+  /**
+   * @brief Processing function for the floating-point NCO.
+   * @param[in,out] *S         points to an instance of the floating-point NCO structure.
+   * @param[out]    *pSin      points to the block of sine values, or NULL.
+   * @param[out]    *pCos      points to the block of cosine values, or NULL.
+   * @param[in]     blockSize  number of samples to generate.
+   * @return none.
+   */
+
+  void riscv_nco_f32(
+  riscv_nco_instance_f32 * S,
+  float32_t * pSin,
+  float32_t * pCos,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 NCO.
+   * @param[in,out] *S         points to an instance of the Q31 NCO structure.
+   * @param[out]    *pSin      points to the block of sine values, or NULL.
+   * @param[out]    *pCos      points to the block of cosine values, or NULL.
+   * @param[in]     blockSize  number of samples to generate.
+   * @return none.
+   */
+
+  void riscv_nco_q31(
+  riscv_nco_instance_q31 * S,
+  q31_t * pSin,
+  q31_t * pCos,
+  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q15 NCO.
+   * @param[in,out] *S         points to an instance of the Q15 NCO structure.
+   * @param[out]    *pSin      points to the block of sine values, or NULL.
+   * @param[out]    *pCos      points to the block of cosine values, or NULL.
+   * @param[in]     blockSize  number of samples to generate.
+   * @return none.
+   */
+
+  void riscv_nco_q15(
+  riscv_nco_instance_q15 * S,
+  q15_t * pSin,
+  q15_t * pCos,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point complex mixer, multiplies a complex vector by the oscillator of an NCO instance.
+   * @param[in,out] *S           points to an instance of the floating-point NCO structure.
+   * @param[in]     *pSrc        points to the complex input vector.
+   * @param[out]    *pDst        points to the complex output vector.
+   * @param[in]     numSamples   number of complex samples in the vectors.
+   * @return none.
+   */
+
+  void riscv_cmix_f32(
+  riscv_nco_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex mixer, multiplies a complex vector by the oscillator of an NCO instance.
+   * @param[in,out] *S           points to an instance of the Q31 NCO structure.
+   * @param[in]     *pSrc        points to the complex input vector.
+   * @param[out]    *pDst        points to the complex output vector.
+   * @param[in]     numSamples   number of complex samples in the vectors.
+   * @return none.
+   */
+
+  void riscv_cmix_q31(
+  riscv_nco_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex mixer, multiplies a complex vector by the oscillator of an NCO instance.
+   * @param[in,out] *S           points to an instance of the Q15 NCO structure.
+   * @param[in]     *pSrc        points to the complex input vector.
+   * @param[out]    *pDst        points to the complex output vector.
+   * @param[in]     numSamples   number of complex samples in the vectors.
+   * @return none.
+   */
+
+  void riscv_cmix_q15(
+  riscv_nco_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief Instance structure for the floating-point zoom FFT.
+   */
+
+  typedef struct
+  {
+    riscv_nco_instance_f32 Snco;              /**< oscillator of the mixer, moves the centre of the band to 0 Hz. */
+    uint16_t decimation;                      /**< decimation factor. */
+    uint16_t numTaps;                         /**< number of coefficients of the lowpass filter. */
+    uint16_t frameIndex;                      /**< number of decimated samples in the current frame. */
+    uint32_t blockSize;                       /**< number of complex samples per call. */
+    const float32_t *pCoeffs;                 /**< points to the lowpass coefficients, time reversed. */
+    const float32_t *pWindow;                 /**< points to the window of a frame, or NULL. */
+    const riscv_cfft_instance_f32 *pCfft;     /**< points to the CFFT instance of a frame. */
+    float32_t *pState;                        /**< points to the state buffer of 2*(numTaps+blockSize-1) words. */
+    float32_t *pFrame;                        /**< points to the frame buffer of 2*fftLen words. */
+  } riscv_zoom_fft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point zoom FFT.
+   * @param[out] *S points to an instance of the floating-point zoom FFT structure.
+   * @param[in]  centerFreq centre of the band in cycles per sample.
+   * @param[in]  decimation decimation factor.
+   * @param[in]  numTaps number of coefficients of the lowpass filter.
+   * @param[in]  *pCoeffs points to the lowpass coefficients, time reversed.
+   * @param[in]  *pWindow points to the window of fftLen values applied to a frame, or NULL for none.
+   * @param[in]  *pCfft points to the CFFT instance of a frame.
+   * @param[in]  blockSize number of complex samples per call, a multiple of <code>decimation</code>.
+   * @param[in]  *pState points to the state buffer of <code>2*(numTaps+blockSize-1)</code> words.
+   * @param[in]  *pFrame points to the frame buffer of <code>2*fftLen</code> words.
+   * @return The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>decimation</code>.
+   */
+
+  riscv_status riscv_zoom_fft_init_f32(
+  riscv_zoom_fft_instance_f32 * S,
+  float32_t centerFreq,
+  uint16_t decimation,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  const float32_t * pWindow,
+  const riscv_cfft_instance_f32 * pCfft,
+  uint32_t blockSize,
+  float32_t * pState,
+  float32_t * pFrame);
+
+  /**
+   * @brief  Floating-point zoom FFT, mixes, decimates and transforms a stream.
+   * @param[in,out] *S points to an instance of the floating-point zoom FFT structure.
+   * @param[in]     *pSrc points to the <code>blockSize</code> complex input samples.
+   * @param[out]    *pDst points to the output spectra, <code>2*fftLen</code> values each.
+   * @return number of spectra written to pDst.
+   */
+
+  uint32_t riscv_zoom_fft_f32(
+  riscv_zoom_fft_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+
+  /**
+   * @ingroup groupFastMath
+   */
+
+
+  /**
+   * @defgroup SQRT Square Root
+   *
+   * Computes the square root of a number.
+   * There are separate functions for Q15, Q31, and floating-point data types.
+   * The square root function is computed using the Newton-Raphson algorithm.
+   * This is an iterative algorithm of the form:
+   * <pre>
+   *      x1 = x0 - f(x0)/f'(x0)
+   * </pre>
+   * where <code>x1</code> is the current estimate,
+   * <code>x0</code> is the previous estimate, and
+   * <code>f'(x0)</code> is the derivative of <code>f()</code> evaluated at <code>x0</code>.
+   * For the square root function, the algorithm reduces to:
+   * <pre>
+   *     x0 = in/2                         [initial guess]
+   *     x1 = 1/2 * ( x0 + in / x0)        [each iteration]
+   * </pre>
+   * The Q15 and Q31 functions avoid the division and iterate on the inverse square root instead,
+   * after normalizing the input to [0.25 1) with __CLZ():
+   * <pre>
+   *     y0 = invSqrtTable_q15[in*64 - 16]  [initial guess]
+   *     y1 = y0 * (3 - in * y0 * y0) / 2   [each iteration]
+   * </pre>
+   * and return <code>in * y</code>.  They use integer arithmetic only, no floating-point operations.
+   */
+
+
+  /**
+   * @addtogroup SQRT
+   * @{
+   */
+
+  /**
+   * @brief  Floating-point square root function.
+   * @param[in]  in     input value.
+   * @param[out] *pOut  square root of input value.
+   * @return The function returns RISCV_MATH_SUCCESS if input value is positive value or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>in</code> is negative value and returns zero output for negative values.
+   *
+   * With the F extension the root is a single <code>fsqrt.s</code>, otherwise the single-precision
+   * sqrtf() is called, not the double-precision sqrt().
+   */
+
+  static inline riscv_status riscv_sqrt_f32(
+  float32_t in,
+  float32_t * pOut)
+  {
+    if(in > 0)
+    {
+
+#if defined (__riscv_fsqrt)
+      __asm__ ("fsqrt.s %0, %1" : "=f" (*pOut) : "f" (in));
+#else
+      *pOut = sqrtf(in);
+#endif
+
+      return (RISCV_MATH_SUCCESS);
+    }
+    else
+    {
+      *pOut = 0.0f;
+      return (RISCV_MATH_ARGUMENT_ERROR);
+    }
+
+  }
+
+
+  /**
+   * @brief Q31 square root function.
+   * @param[in]   in    input value.  The range of the input value is [0 +1) or 0x00000000 to 0x7FFFFFFF.
+   * @param[out]  *pOut square root of input value.
+   * @return The function returns RISCV_MATH_SUCCESS if input value is positive value or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>in</code> is negative value and returns zero output for negative values.
+   */
+  riscv_status riscv_sqrt_q31(
+  q31_t in,
+  q31_t * pOut);
+
+  /**
+   * @brief  Q15 square root function.
+   * @param[in]   in     input value.  The range of the input value is [0 +1) or 0x0000 to 0x7FFF.
+   * @param[out]  *pOut  square root of input value.
+   * @return The function returns RISCV_MATH_SUCCESS if input value is positive value or RISCV_MATH_ARGUMENT_ERROR if
+   * <code>in</code> is negative value and returns zero output for negative values.
+   */
+  riscv_status riscv_sqrt_q15(
+  q15_t in,
+  q15_t * pOut);
+
+  /**
+   * @brief  Square root of a floating-point vector.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_sqrt_vec_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Square root of a Q31 vector.
+   * @param[in]  *pSrc      points to the input vector, values in the range [0 +1).
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_sqrt_vec_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Square root of a Q15 vector.
+   * @param[in]  *pSrc      points to the input vector, values in the range [0 +1).
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_sqrt_vec_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @} end of SQRT group
+   */
+
+  /**
+   * @brief  Fast four-quadrant arc tangent for floating-point data.
+   * @param[in]  y         ordinate of the point.
+   * @param[in]  x         abscissa of the point.
+   * @param[out] *pResult  angle in radians.
+   * @return The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if both inputs are 0.
+   */
+  riscv_status riscv_atan2_f32(
+  float32_t y,
+  float32_t x,
+  float32_t * pResult);
+
+  /**
+   * @brief  Fast four-quadrant arc tangent of a floating-point vector.
+   * @param[in]  *pSrcY     points to the ordinates.
+   * @param[in]  *pSrcX     points to the abscissas.
+   * @param[out] *pDst      points to the angles in radians.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_atan2_vec_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fast four-quadrant arc tangent for Q31 data.
+   * @param[in]  y         ordinate of the point.
+   * @param[in]  x         abscissa of the point.
+   * @param[out] *pResult  angle in radians in 2.29 format.
+   * @return The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if both inputs are 0.
+   */
+  riscv_status riscv_atan2_q31(
+  q31_t y,
+  q31_t x,
+  q31_t * pResult);
+
+  /**
+   * @brief  Fast four-quadrant arc tangent of a Q31 vector.
+   * @param[in]  *pSrcY     points to the ordinates.
+   * @param[in]  *pSrcX     points to the abscissas.
+   * @param[out] *pDst      points to the angles in radians in 2.29 format.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_atan2_vec_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fast four-quadrant arc tangent for Q15 data.
+   * @param[in]  y         ordinate of the point.
+   * @param[in]  x         abscissa of the point.
+   * @param[out] *pResult  angle in radians in 2.13 format.
+   * @return The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if both inputs are 0.
+   */
+  riscv_status riscv_atan2_q15(
+  q15_t y,
+  q15_t x,
+  q15_t * pResult);
+
+  /**
+   * @brief  Fast four-quadrant arc tangent of a Q15 vector.
+   * @param[in]  *pSrcY     points to the ordinates.
+   * @param[in]  *pSrcX     points to the abscissas.
+   * @param[out] *pDst      points to the angles in radians in 2.13 format.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_atan2_vec_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fast exponential of a floating-point vector.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fast exponential of a Q31 vector.
+   * @param[in]  *pSrc      points to the input vector in 5.26 format.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_vexp_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fast exponential of a Q15 vector.
+   * @param[in]  *pSrc      points to the input vector in 4.11 format.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_vexp_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fast natural logarithm of a floating-point vector.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fast natural logarithm of a Q31 vector.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector in 5.26 format.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_vlog_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fast natural logarithm of a Q15 vector.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector in 4.11 format.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_vlog_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Fast reciprocal of a floating-point vector.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_vinverse_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Reciprocal of a Q31 vector.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the mantissas of the reciprocals.
+   * @param[out] *pShift    points to the shifts of the reciprocals, 1/pSrc[n] = pDst[n] * 2^pShift[n].
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_vinverse_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint8_t * pShift,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Reciprocal of a Q15 vector.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the mantissas of the reciprocals.
+   * @param[out] *pShift    points to the shifts of the reciprocals, 1/pSrc[n] = pDst[n] * 2^pShift[n].
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void riscv_vinverse_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint8_t * pShift,
+  uint32_t blockSize);
+
+
+
+
+
+
+  /**
+   * @brief floating-point Circular write function.
+   */
+
+  static inline void riscv_circularWrite_f32(
+  int32_t * circBuffer,
+  int32_t L,
+  uint16_t * writeOffset,
+  int32_t bufferInc,
+  const int32_t * src,
+  int32_t srcInc,
+  uint32_t blockSize)
+  {
+    uint32_t i = 0u;
+    int32_t wOffset;
+
+    /* Copy the value of Index pointer that points
+     * to the current location where the input samples to be copied */
+    wOffset = *writeOffset;
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while(i > 0u)
+    {
+      /* copy the input sample to the circular buffer */
+      circBuffer[wOffset] = *src;
+
+      /* Update the input pointer */
+      src += srcInc;
+
+      /* Circularly update wOffset.  Watch out for positive and negative value */
+      wOffset += bufferInc;
+      if(wOffset >= L)
+        wOffset -= L;
+
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* Update the index pointer */
+    *writeOffset = wOffset;
+  }
+
+
+
+  /**
+   * @brief floating-point Circular Read function.
+   */
+  static inline void riscv_circularRead_f32(
+  int32_t * circBuffer,
+  int32_t L,
+  int32_t * readOffset,
+  int32_t bufferInc,
+  int32_t * dst,
+  int32_t * dst_base,
+  int32_t dst_length,
+  int32_t dstInc,
+  uint32_t blockSize)
+  {
+    uint32_t i = 0u;
+    int32_t rOffset;
+    int32_t *dst_end;
+
+    /* Copy the value of Index pointer that points
+     * to the current location from where the input samples to be read */
+    rOffset = *readOffset;
+    dst_end = dst_base + dst_length;
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while(i > 0u)
+    {
+      /* copy the sample from the circular buffer to the destination buffer */
+      *dst = circBuffer[rOffset];
+
+      /* Update the input pointer */
+      dst += dstInc;
+
+      if(dst == dst_end)
+      {
+        dst = dst_base;
+      }
+
+      /* Circularly update rOffset.  Watch out for positive and negative value  */
+      rOffset += bufferInc;
+
+      if(rOffset >= L)
+      {
+        rOffset -= L;
+      }
+
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* Update the index pointer */
+    *readOffset = rOffset;
+  }
+
+  /**
+   * @brief Q15 Circular write function.
+   */
+
+  static inline void riscv_circularWrite_q15(
+  q15_t * circBuffer,
+  int32_t L,
+  uint16_t * writeOffset,
+  int32_t bufferInc,
+  const q15_t * src,
+  int32_t srcInc,
+  uint32_t blockSize)
+  {
+    uint32_t i = 0u;
+    int32_t wOffset;
+
+    /* Copy the value of Index pointer that points
+     * to the current location where the input samples to be copied */
+    wOffset = *writeOffset;
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while(i > 0u)
+    {
+      /* copy the input sample to the circular buffer */
+      circBuffer[wOffset] = *src;
+
+      /* Update the input pointer */
+      src += srcInc;
+
+      /* Circularly update wOffset.  Watch out for positive and negative value */
+      wOffset += bufferInc;
+      if(wOffset >= L)
+        wOffset -= L;
+
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* Update the index pointer */
+    *writeOffset = wOffset;
+  }
+
+
+
+  /**
+   * @brief Q15 Circular Read function.
+   */
+  static inline void riscv_circularRead_q15(
+  q15_t * circBuffer,
+  int32_t L,
+  int32_t * readOffset,
+  int32_t bufferInc,
+  q15_t * dst,
+  q15_t * dst_base,
+  int32_t dst_length,
+  int32_t dstInc,
+  uint32_t blockSize)
+  {
+    uint32_t i = 0;
+    int32_t rOffset;
+    q15_t *dst_end;
+
+    /* Copy the value of Index pointer that points
+     * to the current location from where the input samples to be read */
+    rOffset = *readOffset;
+
+    dst_end = dst_base + dst_length;
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while(i > 0u)
+    {
+      /* copy the sample from the circular buffer to the destination buffer */
+      *dst = circBuffer[rOffset];
+
+      /* Update the input pointer */
+      dst += dstInc;
+
+      if(dst == dst_end)
+      {
+        dst = dst_base;
+      }
+
+      /* Circularly update wOffset.  Watch out for positive and negative value */
+      rOffset += bufferInc;
+
+      if(rOffset >= L)
+      {
+        rOffset -= L;
+      }
+
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* Update the index pointer */
+    *readOffset = rOffset;
+  }
+
+
+  /**
+   * @brief Q7 Circular write function.
+   */
+
+  static inline void riscv_circularWrite_q7(
+  q7_t * circBuffer,
+  int32_t L,
+  uint16_t * writeOffset,
+  int32_t bufferInc,
+  const q7_t * src,
+  int32_t srcInc,
+  uint32_t blockSize)
+  {
+    uint32_t i = 0u;
+    int32_t wOffset;
+
+    /* Copy the value of Index pointer that points
+     * to the current location where the input samples to be copied */
+    wOffset = *writeOffset;
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while(i > 0u)
+    {
+      /* copy the input sample to the circular buffer */
+      circBuffer[wOffset] = *src;
+
+      /* Update the input pointer */
+      src += srcInc;
+
+      /* Circularly update wOffset.  Watch out for positive and negative value */
+      wOffset += bufferInc;
+      if(wOffset >= L)
+        wOffset -= L;
+
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* Update the index pointer */
+    *writeOffset = wOffset;
+  }
+
+
+
+  /**
+   * @brief Q7 Circular Read function.
+   */
+  static inline void riscv_circularRead_q7(
+  q7_t * circBuffer,
+  int32_t L,
+  int32_t * readOffset,
+  int32_t bufferInc,
+  q7_t * dst,
+  q7_t * dst_base,
+  int32_t dst_length,
+  int32_t dstInc,
+  uint32_t blockSize)
+  {
+    uint32_t i = 0;
+    int32_t rOffset;
+    q7_t *dst_end;
+
+    /* Copy the value of Index pointer that points
+     * to the current location from where the input samples to be read */
+    rOffset = *readOffset;
+
+    dst_end = dst_base + dst_length;
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while(i > 0u)
+    {
+      /* copy the sample from the circular buffer to the destination buffer */
+      *dst = circBuffer[rOffset];
+
+      /* Update the input pointer */
+      dst += dstInc;
+
+      if(dst == dst_end)
+      {
+        dst = dst_base;
+      }
+
+      /* Circularly update rOffset.  Watch out for positive and negative value */
+      rOffset += bufferInc;
+
+      if(rOffset >= L)
+      {
+        rOffset -= L;
+      }
+
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* Update the index pointer */
+    *readOffset = rOffset;
+  }
+
+
+  /**
+   * @brief  Sum of the squares of the elements of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_power_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q63_t * pResult);
+
+  /**
+   * @brief  Sum of the squares of the elements of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_power_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult);
+
+  /**
+   * @brief  Sum of the squares of the elements of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_power_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q63_t * pResult);
+
+  /**
+   * @brief  Sum of the squares of the elements of a Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_power_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pResult);
+
+  /**
+   * @brief  Mean value of a Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_mean_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  q7_t * pResult);
+
+  /**
+   * @brief  Mean value of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+  void riscv_mean_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult);
+
+  /**
+   * @brief  Mean value of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+  void riscv_mean_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pResult);
+
+  /**
+   * @brief  Mean value of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+  void riscv_mean_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult);
+
+  /**
+   * @brief  Variance of the elements of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_var_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult);
+
+  /**
+   * @brief  Variance of the elements of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_var_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pResult);
+
+  /**
+   * @brief  Variance of the elements of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_var_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult);
+
+  /**
+   * @brief  Variance of the elements of a Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value, in 1.15 format.
+   * @return none.
+   */
+
+  void riscv_var_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult);
+
+  /**
+   * @brief  Root Mean Square of the elements of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_rms_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult);
+
+  /**
+   * @brief  Root Mean Square of the elements of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_rms_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pResult);
+
+  /**
+   * @brief  Root Mean Square of the elements of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_rms_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult);
+
+  /**
+   * @brief  Root Mean Square of the elements of a Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value, in 1.15 format.
+   * @return none.
+   */
+
+  void riscv_rms_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult);
+
+  /**
+   * @brief  Standard deviation of the elements of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_std_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult);
+
+  /**
+   * @brief  Standard deviation of the elements of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_std_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pResult);
+
+  /**
+   * @brief  Standard deviation of the elements of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void riscv_std_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult);
+
+  /**
+   * @brief  Standard deviation of the elements of a Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value, in 1.15 format.
+   * @return none.
+   */
+
+  void riscv_std_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult);
+
+  /**
+   * @brief  Floating-point complex magnitude
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex magnitude
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex magnitude
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex magnitude, alpha-max-plus-beta-min approximation
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_approx_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex magnitude, alpha-max-plus-beta-min approximation
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector, 2.14 format
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_approx_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Base-2 logarithm of the Q15 complex magnitude
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector, 6.10 format
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_log2_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex dot product
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @param[out]  *realResult real part of the result returned here
+   * @param[out]  *imagResult imaginary part of the result returned here
+   * @return none.
+   */
+
+  void riscv_cmplx_dot_prod_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  uint32_t numSamples,
+  q31_t * realResult,
+  q31_t * imagResult);
+
+  /**
+   * @brief  Q31 complex dot product
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @param[out]  *realResult real part of the result returned here
+   * @param[out]  *imagResult imaginary part of the result returned here
+   * @return none.
+   */
+
+  void riscv_cmplx_dot_prod_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  uint32_t numSamples,
+  q63_t * realResult,
+  q63_t * imagResult);
+
+  /**
+   * @brief  Floating-point complex dot product
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @param[out]  *realResult real part of the result returned here
+   * @param[out]  *imagResult imaginary part of the result returned here
+   * @return none.
+   */
+
+  void riscv_cmplx_dot_prod_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  uint32_t numSamples,
+  float32_t * realResult,
+  float32_t * imagResult);
+
+  /**
+   * @brief  Q15 complex-by-real multiplication
+   * @param[in]  *pSrcCmplx points to the complex input vector
+   * @param[in]  *pSrcReal points to the real input vector
+   * @param[out]  *pCmplxDst points to the complex output vector
+   * @param[in]  numSamples number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mult_real_q15(
+  q15_t * pSrcCmplx,
+  q15_t * pSrcReal,
+  q15_t * pCmplxDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex-by-real multiplication
+   * @param[in]  *pSrcCmplx points to the complex input vector
+   * @param[in]  *pSrcReal points to the real input vector
+   * @param[out]  *pCmplxDst points to the complex output vector
+   * @param[in]  numSamples number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mult_real_q31(
+  q31_t * pSrcCmplx,
+  q31_t * pSrcReal,
+  q31_t * pCmplxDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex-by-real multiplication
+   * @param[in]  *pSrcCmplx points to the complex input vector
+   * @param[in]  *pSrcReal points to the real input vector
+   * @param[out]  *pCmplxDst points to the complex output vector
+   * @param[in]  numSamples number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mult_real_f32(
+  float32_t * pSrcCmplx,
+  float32_t * pSrcReal,
+  float32_t * pCmplxDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Minimum value of a Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *result is output pointer
+   * @param[in]  index is the array index of the minimum value in the input buffer.
+   * @return none.
+   */
+
+  void riscv_min_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  q7_t * result,
+  uint32_t * index);
+
+  /**
+   * @brief  Minimum value of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output pointer
+   * @param[in]  *pIndex is the array index of the minimum value in the input buffer.
+   * @return none.
+   */
+
+  void riscv_min_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Minimum value of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output pointer
+   * @param[out]  *pIndex is the array index of the minimum value in the input buffer.
+   * @return none.
+   */
+  void riscv_min_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pResult,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Minimum value of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output pointer
+   * @param[out]  *pIndex is the array index of the minimum value in the input buffer.
+   * @return none.
+   */
+
+  void riscv_min_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult,
+  uint32_t * pIndex);
+
+/**
+ * @brief Maximum value of a Q7 vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult maximum value returned here
+ * @param[out]      *pIndex index of maximum value returned here
+ * @return none.
+ */
+
+  void riscv_max_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  q7_t * pResult,
+  uint32_t * pIndex);
+
+/**
+ * @brief Maximum value of a Q15 vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult maximum value returned here
+ * @param[out]      *pIndex index of maximum value returned here
+ * @return none.
+ */
+
+  void riscv_max_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult,
+  uint32_t * pIndex);
+
+/**
+ * @brief Maximum value of a Q31 vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult maximum value returned here
+ * @param[out]      *pIndex index of maximum value returned here
+ * @return none.
+ */
+
+  void riscv_max_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pResult,
+  uint32_t * pIndex);
+
+/**
+ * @brief Maximum value of a floating-point vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult maximum value returned here
+ * @param[out]      *pIndex index of maximum value returned here
+ * @return none.
+ */
+
+  void riscv_max_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult,
+  uint32_t * pIndex);
+
+  /**
+   * @brief Flags of riscv_stats_f32(), riscv_stats_q31() and riscv_stats_q15() that select the computed results.
+   */
+
+#define RISCV_STATS_MEAN   0x01u                 /**< mean, as riscv_mean_*() */
+#define RISCV_STATS_VAR    0x02u                 /**< variance, as riscv_var_*() */
+#define RISCV_STATS_STD    0x04u                 /**< standard deviation, as riscv_std_*() */
+#define RISCV_STATS_RMS    0x08u                 /**< root mean square, as riscv_rms_*() */
+#define RISCV_STATS_MIN    0x10u                 /**< minimum and its index, as riscv_min_*() */
+#define RISCV_STATS_MAX    0x20u                 /**< maximum and its index, as riscv_max_*() */
+#define RISCV_STATS_POWER  0x40u                 /**< sum of squares, as riscv_power_*() */
+#define RISCV_STATS_ALL    0x7Fu                 /**< all of the above */
+
+  /**
+   * @brief Results of the Q15 fused statistics function.
+   */
+
+  typedef struct
+  {
+    q15_t mean;                /**< mean value. */
+    q15_t var;                 /**< variance. */
+    q15_t std;                 /**< standard deviation. */
+    q15_t rms;                 /**< root mean square. */
+    q15_t min;                 /**< minimum value. */
+    q15_t max;                 /**< maximum value. */
+    uint32_t minIndex;         /**< index of the first minimum value. */
+    uint32_t maxIndex;         /**< index of the first maximum value. */
+    q63_t power;               /**< sum of squares in 34.30 format. */
+  } riscv_stats_result_q15;
+
+  /**
+   * @brief Results of the Q31 fused statistics function.
+   */
+
+  typedef struct
+  {
+    q31_t mean;                /**< mean value. */
+    q31_t var;                 /**< variance. */
+    q31_t std;                 /**< standard deviation. */
+    q31_t rms;                 /**< root mean square. */
+    q31_t min;                 /**< minimum value. */
+    q31_t max;                 /**< maximum value. */
+    uint32_t minIndex;         /**< index of the first minimum value. */
+    uint32_t maxIndex;         /**< index of the first maximum value. */
+    q63_t power;               /**< sum of squares in 16.48 format. */
+  } riscv_stats_result_q31;
+
+  /**
+   * @brief Results of the floating-point fused statistics function.
+   */
+
+  typedef struct
+  {
+    float32_t mean;            /**< mean value. */
+    float32_t var;             /**< variance. */
+    float32_t std;             /**< standard deviation. */
+    float32_t rms;             /**< root mean square. */
+    float32_t min;             /**< minimum value. */
+    float32_t max;             /**< maximum value. */
+    uint32_t minIndex;         /**< index of the first minimum value. */
+    uint32_t maxIndex;         /**< index of the first maximum value. */
+    float32_t power;           /**< sum of squares. */
+  } riscv_stats_result_f32;
+
+/**
+ * @brief Fused statistics of a Q15 vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       flags RISCV_STATS_* mask of the results to compute
+ * @param[out]      *pResult results returned here, fields that are not selected are left unchanged
+ * @return none.
+ */
+
+  void riscv_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t flags,
+  riscv_stats_result_q15 * pResult);
+
+/**
+ * @brief Fused statistics of a Q31 vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       flags RISCV_STATS_* mask of the results to compute
+ * @param[out]      *pResult results returned here, fields that are not selected are left unchanged
+ * @return none.
+ */
+
+  void riscv_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t flags,
+  riscv_stats_result_q31 * pResult);
+
+/**
+ * @brief Fused statistics of a floating-point vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       flags RISCV_STATS_* mask of the results to compute
+ * @param[out]      *pResult results returned here, fields that are not selected are left unchanged
+ * @return none.
+ */
+
+  void riscv_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t flags,
+  riscv_stats_result_f32 * pResult);
+
+  /**
+   * @brief Flags of riscv_spectral_features_f32() that select the computed features.
+   */
+
+#define RISCV_SPECTRAL_CENTROID  0x01u           /**< centroid of the spectrum in bins */
+#define RISCV_SPECTRAL_SPREAD    0x02u           /**< spread around the centroid in bins */
+#define RISCV_SPECTRAL_ROLLOFF   0x04u           /**< bin below which a fraction of the sum lies */
+#define RISCV_SPECTRAL_FLUX      0x08u           /**< squared distance to the previous spectrum */
+#define RISCV_SPECTRAL_ALL       0x0Fu           /**< all of the above */
+
+  /**
+   * @brief Results of the floating-point spectral features function.
+   */
+
+  typedef struct
+  {
+    float32_t sum;             /**< sum of the bins. */
+    float32_t centroid;        /**< centroid in bins. */
+    float32_t spread;          /**< standard deviation around the centroid in bins. */
+    float32_t flux;            /**< sum of the squared differences with the previous spectrum. */
+    uint32_t rolloff;          /**< first bin at which the running sum reaches the rolloff fraction of the sum. */
+  } riscv_spectral_result_f32;
+
+/**
+ * @brief Fused spectral features of a magnitude or power spectrum.
+ * @param[in]       *pSpec points to the numBins magnitudes or powers
+ * @param[in,out]   *pPrev points to the previous spectrum, replaced by pSpec, used with RISCV_SPECTRAL_FLUX only
+ * @param[in]       numBins number of bins
+ * @param[in]       rolloff fraction of the sum for RISCV_SPECTRAL_ROLLOFF, 0 to 1
+ * @param[in]       flags RISCV_SPECTRAL_* mask of the features to compute
+ * @param[out]      *pResult features returned here, fields that are not selected are left unchanged
+ * @return none.
+ */
+
+  void riscv_spectral_features_f32(
+  const float32_t * pSpec,
+  float32_t * pPrev,
+  uint32_t numBins,
+  float32_t rolloff,
+  uint32_t flags,
+  riscv_spectral_result_f32 * pResult);
+
+/**
+ * @brief Zero crossings and energy of a Q15 frame.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pCrossings number of sign changes between neighbouring samples returned here
+ * @param[out]      *pEnergy sum of squares in 34.30 format returned here
+ * @return none.
+ */
+
+  void riscv_zcr_energy_q15(
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t * pCrossings,
+  q63_t * pEnergy);
+
+/**
+ * @brief Zero crossings and energy of a floating-point frame.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pCrossings number of sign changes between neighbouring samples returned here
+ * @param[out]      *pEnergy sum of squares returned here
+ * @return none.
+ */
+
+  void riscv_zcr_energy_f32(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t * pCrossings,
+  float32_t * pEnergy);
+
+  /**
+   * @brief Instance structure for the floating-point running statistics.
+   */
+
+  typedef struct
+  {
+    uint32_t count;            /**< number of samples. */
+    float32_t mean;            /**< mean of the samples. */
+    float32_t m2;              /**< sum of the squared deviations from the mean. */
+  } riscv_running_stats_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 running statistics.
+   */
+
+  typedef struct
+  {
+    uint32_t count;            /**< number of samples. */
+    q31_t mean;                /**< mean of the samples in 1.31 format. */
+    q63_t m2;                  /**< sum of the squared deviations from the mean in 18.46 format. */
+  } riscv_running_stats_instance_q31;
+
+/**
+ * @brief  Initialization function for the floating-point running statistics.
+ * @param[out]      *S points to an instance of the floating-point running statistics structure
+ * @return none.
+ */
+
+  void riscv_running_stats_init_f32(
+  riscv_running_stats_instance_f32 * S);
+
+/**
+ * @brief  Adds a block of samples to the floating-point running statistics.
+ * @param[in,out]   *S points to an instance of the floating-point running statistics structure
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples to add
+ * @return none.
+ */
+
+  void riscv_running_stats_push_f32(
+  riscv_running_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+/**
+ * @brief  Removes a block of previously added samples from the floating-point running statistics.
+ * @param[in,out]   *S points to an instance of the floating-point running statistics structure
+ * @param[in]       *pSrc points to the block of samples to remove
+ * @param[in]       blockSize number of samples to remove
+ * @return none.
+ */
+
+  void riscv_running_stats_evict_f32(
+  riscv_running_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+/**
+ * @brief  Merges two floating-point running statistics.
+ * @param[in,out]   *S points to the instance that receives the samples of <code>pSrc</code>
+ * @param[in]       *pSrc points to the instance to merge
+ * @return none.
+ */
+
+  void riscv_running_stats_merge_f32(
+  riscv_running_stats_instance_f32 * S,
+  const riscv_running_stats_instance_f32 * pSrc);
+
+/**
+ * @brief  Mean, variance and standard deviation of the floating-point running statistics.
+ * @param[in]       *S points to an instance of the floating-point running statistics structure
+ * @param[out]      *pMean mean value returned here
+ * @param[out]      *pVar variance value returned here
+ * @param[out]      *pStd standard deviation value returned here
+ * @return none.
+ */
+
+  void riscv_running_stats_get_f32(
+  const riscv_running_stats_instance_f32 * S,
+  float32_t * pMean,
+  float32_t * pVar,
+  float32_t * pStd);
+
+/**
+ * @brief  Initialization function for the Q31 running statistics.
+ * @param[out]      *S points to an instance of the Q31 running statistics structure
+ * @return none.
+ */
+
+  void riscv_running_stats_init_q31(
+  riscv_running_stats_instance_q31 * S);
+
+/**
+ * @brief  Adds a block of samples to the Q31 running statistics.
+ * @param[in,out]   *S points to an instance of the Q31 running statistics structure
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples to add
+ * @return none.
+ */
+
+  void riscv_running_stats_push_q31(
+  riscv_running_stats_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize);
+
+/**
+ * @brief  Removes a block of previously added samples from the Q31 running statistics.
+ * @param[in,out]   *S points to an instance of the Q31 running statistics structure
+ * @param[in]       *pSrc points to the block of samples to remove
+ * @param[in]       blockSize number of samples to remove
+ * @return none.
+ */
+
+  void riscv_running_stats_evict_q31(
+  riscv_running_stats_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize);
+
+/**
+ * @brief  Merges two Q31 running statistics.
+ * @param[in,out]   *S points to the instance that receives the samples of <code>pSrc</code>
+ * @param[in]       *pSrc points to the instance to merge
+ * @return none.
+ */
+
+  void riscv_running_stats_merge_q31(
+  riscv_running_stats_instance_q31 * S,
+  const riscv_running_stats_instance_q31 * pSrc);
+
+/**
+ * @brief  Mean, variance and standard deviation of the Q31 running statistics.
+ * @param[in]       *S points to an instance of the Q31 running statistics structure
+ * @param[out]      *pMean mean value returned here
+ * @param[out]      *pVar variance value returned here
+ * @param[out]      *pStd standard deviation value returned here
+ * @return none.
+ */
+
+  void riscv_running_stats_get_q31(
+  const riscv_running_stats_instance_q31 * S,
+  q31_t * pMean,
+  q31_t * pVar,
+  q31_t * pStd);
+
+/**
+ * @brief Histogram of a floating-point vector with arbitrary bin edges.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       *pEdges points to the <code>numBins+1</code> increasing bin edges
+ * @param[in]       numBins number of bins
+ * @param[out]      *pHist points to the <code>numBins</code> bin counts
+ * @return none.
+ */
+
+  void riscv_histogram_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pEdges,
+  uint16_t numBins,
+  uint32_t * pHist);
+
+/**
+ * @brief Histogram of a floating-point vector with uniform bins.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       minVal lower edge of the first bin
+ * @param[in]       maxVal upper edge of the last bin
+ * @param[in]       numBins number of bins
+ * @param[out]      *pHist points to the <code>numBins</code> bin counts
+ * @return none.
+ */
+
+  void riscv_histogram_uniform_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t minVal,
+  float32_t maxVal,
+  uint16_t numBins,
+  uint32_t * pHist);
+
+/**
+ * @brief Histogram of a Q15 vector with arbitrary bin edges.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       *pEdges points to the <code>numBins+1</code> increasing bin edges
+ * @param[in]       numBins number of bins
+ * @param[out]      *pHist points to the <code>numBins</code> bin counts
+ * @return none.
+ */
+
+  void riscv_histogram_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pEdges,
+  uint16_t numBins,
+  uint32_t * pHist);
+
+/**
+ * @brief Histogram of a Q15 vector with uniform bins of width 2^shift.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       minVal lower edge of the first bin
+ * @param[in]       shift log2 of the bin width
+ * @param[in]       numBins number of bins
+ * @param[out]      *pHist points to the <code>numBins</code> bin counts
+ * @return none.
+ */
+
+  void riscv_histogram_uniform_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t minVal,
+  uint8_t shift,
+  uint16_t numBins,
+  uint32_t * pHist);
+
+/**
+ * @brief k-th smallest element of a floating-point vector, in place.
+ * @param[in,out]   *pSrc points to the input buffer, partially reordered on return
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       k rank of the element, 0 for the minimum
+ * @param[out]      *pResult k-th smallest value returned here
+ * @return none.
+ */
+
+  void riscv_select_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pResult);
+
+/**
+ * @brief Median of a floating-point vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       *pScratch points to a buffer of <code>blockSize</code> values
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult median value returned here
+ * @return none.
+ */
+
+  void riscv_median_f32(
+  float32_t * pSrc,
+  float32_t * pScratch,
+  uint32_t blockSize,
+  float32_t * pResult);
+
+/**
+ * @brief Percentile of a floating-point vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       *pScratch points to a buffer of <code>blockSize</code> values
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       p fraction of the samples below the result, from 0 to 1
+ * @param[out]      *pResult percentile value returned here
+ * @return none.
+ */
+
+  void riscv_percentile_f32(
+  float32_t * pSrc,
+  float32_t * pScratch,
+  uint32_t blockSize,
+  float32_t p,
+  float32_t * pResult);
+
+/**
+ * @brief k-th smallest element of a Q15 vector, in place.
+ * @param[in,out]   *pSrc points to the input buffer, partially reordered on return
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       k rank of the element, 0 for the minimum
+ * @param[out]      *pResult k-th smallest value returned here
+ * @return none.
+ */
+
+  void riscv_select_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pResult);
+
+/**
+ * @brief Median of a Q15 vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       *pScratch points to a buffer of <code>blockSize</code> values
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult median value returned here
+ * @return none.
+ */
+
+  void riscv_median_q15(
+  q15_t * pSrc,
+  q15_t * pScratch,
+  uint32_t blockSize,
+  q15_t * pResult);
+
+/**
+ * @brief Percentile of a Q15 vector.
+ * @param[in]       *pSrc points to the input buffer
+ * @param[in]       *pScratch points to a buffer of <code>blockSize</code> values
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       p fraction of the samples below the result in 1.15 format, from 0 to 0x7FFF
+ * @param[out]      *pResult percentile value returned here
+ * @return none.
+ */
+
+  void riscv_percentile_q15(
+  q15_t * pSrc,
+  q15_t * pScratch,
+  uint32_t blockSize,
+  q15_t p,
+  q15_t * pResult);
+
+  /**
+   * @brief Instance structure for the floating-point sliding median filter.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLength;     /**< number of samples in the window. */
+    uint16_t stateIndex;       /**< slot of the oldest sample. */
+    float32_t *pState;         /**< points to the window samples, of length windowLength. */
+    uint16_t *pHeap;           /**< points to the slots of the two heaps, of length windowLength. */
+    uint16_t *pPos;            /**< points to the heap position of every slot, of length windowLength. */
+  } riscv_median_filter_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 sliding median filter.
+   */
+
+  typedef struct
+  {
+    uint16_t windowLength;     /**< number of samples in the window. */
+    uint16_t stateIndex;       /**< slot of the oldest sample. */
+    q15_t *pState;             /**< points to the window samples, of length windowLength. */
+    uint16_t *pHeap;           /**< points to the slots of the two heaps, of length windowLength. */
+    uint16_t *pPos;            /**< points to the heap position of every slot, of length windowLength. */
+  } riscv_median_filter_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding median filter.
+   * @param[out]    *S             points to an instance of the floating-point median filter structure.
+   * @param[in]     windowLength   number of samples in the window.
+   * @param[in]     *pState        points to the window buffer of <code>windowLength</code> values.
+   * @param[in]     *pHeap         points to a buffer of <code>windowLength</code> indices.
+   * @param[in]     *pPos          points to a buffer of <code>windowLength</code> indices.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR if <code>windowLength</code> is 0.
+   */
+
+  riscv_status riscv_median_filter_init_f32(
+  riscv_median_filter_instance_f32 * S,
+  uint16_t windowLength,
+  float32_t * pState,
+  uint16_t * pHeap,
+  uint16_t * pPos);
+
+  /**
+   * @brief  Processing function for the floating-point sliding median filter.
+   * @param[in,out] *S         points to an instance of the floating-point median filter structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
+   */
+
+  void riscv_median_filter_f32(
+  riscv_median_filter_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 sliding median filter.
+   * @param[out]    *S             points to an instance of the Q15 median filter structure.
+   * @param[in]     windowLength   number of samples in the window.
+   * @param[in]     *pState        points to the window buffer of <code>windowLength</code> values.
+   * @param[in]     *pHeap         points to a buffer of <code>windowLength</code> indices.
+   * @param[in]     *pPos          points to a buffer of <code>windowLength</code> indices.
+   * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR if <code>windowLength</code> is 0.
+   */
+
+  riscv_status riscv_median_filter_init_q15(
+  riscv_median_filter_instance_q15 * S,
+  uint16_t windowLength,
+  q15_t * pState,
+  uint16_t * pHeap,
+  uint16_t * pPos);
+
+  /**
+   * @brief  Processing function for the Q15 sliding median filter.
+   * @param[in,out] *S         points to an instance of the Q15 median filter structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @return none.
+   */
+
+  void riscv_median_filter_q15(
+  riscv_median_filter_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point CFAR detectors.
+   */
+
+  typedef struct
+  {
+    uint16_t numGuard;         /**< number of guard cells on each side of the cell under test. */
+    uint16_t numTrain;         /**< number of training cells on each side. */
+    uint16_t rank;             /**< order of the OS-CFAR statistic among the 2*numTrain training cells. */
+    float32_t scale;           /**< factor from the statistic to the threshold. */
+    float32_t *pScratch;       /**< points to the sorted training cells of the OS-CFAR, of length 2*numTrain. */
+  } riscv_cfar_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 CFAR detectors.
+   */
+
+  typedef struct
+  {
+    uint16_t numGuard;         /**< number of guard cells on each side of the cell under test. */
+    uint16_t numTrain;         /**< number of training cells on each side. */
+    uint16_t rank;             /**< order of the OS-CFAR statistic among the 2*numTrain training cells. */
+    q15_t scaleFract;          /**< fractional part of the factor from the statistic to the threshold. */
+    int8_t shift;              /**< shift of the factor, scaleFract*2^shift. */
+    q15_t *pScratch;           /**< points to the sorted training cells of the OS-CFAR, of length 2*numTrain. */
+  } riscv_cfar_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point CFAR detectors.
+   * @param[out]    *S          points to an instance of the floating-point CFAR structure.
+   * @param[in]     numGuard    number of guard cells on each side of the cell under test.
+   * @param[in]     numTrain    number of training cells on each side.
+   * @param[in]     rank        order of the OS-CFAR statistic, less than <code>2*numTrain</code>.
+   * @param[in]     scale       factor from the statistic to the threshold.
+   * @param[in]     *pScratch   points to a buffer of <code>2*numTrain</code> values, or NULL without OS-CFAR.
+   * @return        RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
+
+  riscv_status riscv_cfar_init_f32(
+  riscv_cfar_instance_f32 * S,
+  uint16_t numGuard,
+  uint16_t numTrain,
+  uint16_t rank,
+  float32_t scale,
+  float32_t * pScratch);
+
+  /**
+   * @brief  Initialization function for the Q15 CFAR detectors.
+   * @param[out]    *S          points to an instance of the Q15 CFAR structure.
+   * @param[in]     numGuard    number of guard cells on each side of the cell under test.
+   * @param[in]     numTrain    number of training cells on each side.
+   * @param[in]     rank        order of the OS-CFAR statistic, less than <code>2*numTrain</code>.
+   * @param[in]     scaleFract  fractional part of the factor from the statistic to the threshold.
+   * @param[in]     shift       shift of the factor, from -15 to 15.
+   * @param[in]     *pScratch   points to a buffer of <code>2*numTrain</code> values, or NULL without OS-CFAR.
+   * @return        RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR.
+   */
+
+  riscv_status riscv_cfar_init_q15(
+  riscv_cfar_instance_q15 * S,
+  uint16_t numGuard,
+  uint16_t numTrain,
+  uint16_t rank,
+  q15_t scaleFract,
+  int8_t shift,
+  q15_t * pScratch);
+
+  /**
+   * @brief  Floating-point cell-averaging CFAR threshold.
+   * @param[in]   *S           points to an instance of the floating-point CFAR structure.
+   * @param[in]   *pSrc        points to the input cells.
+   * @param[out]  *pThreshold  points to the threshold of every cell.
+   * @param[in]   blockSize    number of cells, at least <code>2*numGuard+2</code>.
+   * @return none.
+   */
+
+  void riscv_cfar_ca_f32(
+  const riscv_cfar_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pThreshold,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q15 cell-averaging CFAR threshold.
+   * @param[in]   *S           points to an instance of the Q15 CFAR structure.
+   * @param[in]   *pSrc        points to the input cells.
+   * @param[out]  *pThreshold  points to the threshold of every cell.
+   * @param[in]   blockSize    number of cells, at least <code>2*numGuard+2</code>.
+   * @return none.
+   */
+
+  void riscv_cfar_ca_q15(
+  const riscv_cfar_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pThreshold,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point ordered-statistic CFAR threshold.
+   * @param[in]   *S           points to an instance of the floating-point CFAR structure, with a scratch buffer.
+   * @param[in]   *pSrc        points to the input cells.
+   * @param[out]  *pThreshold  points to the threshold of every cell.
+   * @param[in]   blockSize    number of cells, at least <code>2*numGuard+2</code>.
+   * @return none.
+   */
+
+  void riscv_cfar_os_f32(
+  const riscv_cfar_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pThreshold,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Q15 ordered-statistic CFAR threshold.
+   * @param[in]   *S           points to an instance of the Q15 CFAR structure, with a scratch buffer.
+   * @param[in]   *pSrc        points to the input cells.
+   * @param[out]  *pThreshold  points to the threshold of every cell.
+   * @param[in]   blockSize    number of cells, at least <code>2*numGuard+2</code>.
+   * @return none.
+   */
+
+  void riscv_cfar_os_q15(
+  const riscv_cfar_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pThreshold,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point peak picking above a threshold.
+   * @param[in]   *pSrc         points to the input cells.
+   * @param[in]   blockSize     number of cells.
+   * @param[in]   *pThreshold   points to the threshold of every cell, or NULL.
+   * @param[in]   threshold     threshold of all cells when <code>pThreshold</code> is NULL.
+   * @param[in]   minDistance   least distance between two peaks.
+   * @param[out]  *pIndex       points to the indices of the peaks.
+   * @param[in]   maxPeaks      size of the <code>pIndex</code> buffer.
+   * @return the number of peaks.
+   */
+
+  uint32_t riscv_find_peaks_f32(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  const float32_t * pThreshold,
+  float32_t threshold,
+  uint32_t minDistance,
+  uint32_t * pIndex,
+  uint32_t maxPeaks);
+
+  /**
+   * @brief  Q15 peak picking above a threshold.
+   * @param[in]   *pSrc         points to the input cells.
+   * @param[in]   blockSize     number of cells.
+   * @param[in]   *pThreshold   points to the threshold of every cell, or NULL.
+   * @param[in]   threshold     threshold of all cells when <code>pThreshold</code> is NULL.
+   * @param[in]   minDistance   least distance between two peaks.
+   * @param[out]  *pIndex       points to the indices of the peaks.
+   * @param[in]   maxPeaks      size of the <code>pIndex</code> buffer.
+   * @return the number of peaks.
+   */
+
+  uint32_t riscv_find_peaks_q15(
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  const q15_t * pThreshold,
+  q15_t threshold,
+  uint32_t minDistance,
+  uint32_t * pIndex,
+  uint32_t maxPeaks);
+
+  /**
+   * @brief  Squared Euclidean distance of a floating-point vector to every template, or to the k nearest.
+   * @param[in]   *pVec          points to the vector.
+   * @param[in]   *pTemplates    points to the templates, one after the other.
+   * @param[in]   dim            number of elements of the vector and of each template.
+   * @param[in]   numTemplates   number of templates.
+   * @param[in]   k              number of nearest templates to keep, 0 for all the distances.
+   * @param[out]  *pDist         points to the distances.
+   * @param[out]  *pIndex        points to the indices of the nearest templates, unused when <code>k</code> is 0.
+   * @return the number of distances written.
+   */
+
+  uint32_t riscv_dist_l2sq_f32(
+  const float32_t * pVec,
+  const float32_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  float32_t * pDist,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Squared Euclidean distance of a Q15 vector to every template, or to the k nearest.
+   * @param[in]   *pVec          points to the vector.
+   * @param[in]   *pTemplates    points to the templates, one after the other.
+   * @param[in]   dim            number of elements of the vector and of each template.
+   * @param[in]   numTemplates   number of templates.
+   * @param[in]   k              number of nearest templates to keep, 0 for all the distances.
+   * @param[out]  *pDist         points to the distances.
+   * @param[out]  *pIndex        points to the indices of the nearest templates, unused when <code>k</code> is 0.
+   * @return the number of distances written.
+   */
+
+  uint32_t riscv_dist_l2sq_q15(
+  const q15_t * pVec,
+  const q15_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  q63_t * pDist,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Squared Euclidean distance of a Q7 vector to every template, or to the k nearest.
+   * @param[in]   *pVec          points to the vector.
+   * @param[in]   *pTemplates    points to the templates, one after the other.
+   * @param[in]   dim            number of elements of the vector and of each template.
+   * @param[in]   numTemplates   number of templates.
+   * @param[in]   k              number of nearest templates to keep, 0 for all the distances.
+   * @param[out]  *pDist         points to the distances.
+   * @param[out]  *pIndex        points to the indices of the nearest templates, unused when <code>k</code> is 0.
+   * @return the number of distances written.
+   */
+
+  uint32_t riscv_dist_l2sq_q7(
+  const q7_t * pVec,
+  const q7_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  q31_t * pDist,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Manhattan distance of a floating-point vector to every template, or to the k nearest.
+   * @param[in]   *pVec          points to the vector.
+   * @param[in]   *pTemplates    points to the templates, one after the other.
+   * @param[in]   dim            number of elements of the vector and of each template.
+   * @param[in]   numTemplates   number of templates.
+   * @param[in]   k              number of nearest templates to keep, 0 for all the distances.
+   * @param[out]  *pDist         points to the distances.
+   * @param[out]  *pIndex        points to the indices of the nearest templates, unused when <code>k</code> is 0.
+   * @return the number of distances written.
+   */
+
+  uint32_t riscv_dist_l1_f32(
+  const float32_t * pVec,
+  const float32_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  float32_t * pDist,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Manhattan distance of a Q15 vector to every template, or to the k nearest.
+   * @param[in]   *pVec          points to the vector.
+   * @param[in]   *pTemplates    points to the templates, one after the other.
+   * @param[in]   dim            number of elements of the vector and of each template.
+   * @param[in]   numTemplates   number of templates.
+   * @param[in]   k              number of nearest templates to keep, 0 for all the distances.
+   * @param[out]  *pDist         points to the distances.
+   * @param[out]  *pIndex        points to the indices of the nearest templates, unused when <code>k</code> is 0.
+   * @return the number of distances written.
+   */
+
+  uint32_t riscv_dist_l1_q15(
+  const q15_t * pVec,
+  const q15_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  q31_t * pDist,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Manhattan distance of a Q7 vector to every template, or to the k nearest.
+   * @param[in]   *pVec          points to the vector.
+   * @param[in]   *pTemplates    points to the templates, one after the other.
+   * @param[in]   dim            number of elements of the vector and of each template.
+   * @param[in]   numTemplates   number of templates.
+   * @param[in]   k              number of nearest templates to keep, 0 for all the distances.
+   * @param[out]  *pDist         points to the distances.
+   * @param[out]  *pIndex        points to the indices of the nearest templates, unused when <code>k</code> is 0.
+   * @return the number of distances written.
+   */
+
+  uint32_t riscv_dist_l1_q7(
+  const q7_t * pVec,
+  const q7_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  q31_t * pDist,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Cosine similarity of a floating-point vector to every template, or to the k most similar.
+   * @param[in]   *pVec          points to the vector.
+   * @param[in]   *pTemplates    points to the templates, one after the other.
+   * @param[in]   dim            number of elements of the vector and of each template.
+   * @param[in]   numTemplates   number of templates.
+   * @param[in]   k              number of most similar templates to keep, 0 for all the similarities.
+   * @param[out]  *pDist         points to the similarities.
+   * @param[out]  *pIndex        points to the indices of the most similar templates, unused when <code>k</code> is 0.
+   * @return the number of similarities written.
+   */
+
+  uint32_t riscv_dist_cosine_f32(
+  const float32_t * pVec,
+  const float32_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  float32_t * pDist,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Cosine similarity of a Q15 vector to every template, or to the k most similar.
+   * @param[in]   *pVec          points to the vector.
+   * @param[in]   *pTemplates    points to the templates, one after the other.
+   * @param[in]   dim            number of elements of the vector and of each template.
+   * @param[in]   numTemplates   number of templates.
+   * @param[in]   k              number of most similar templates to keep, 0 for all the similarities.
+   * @param[out]  *pDist         points to the similarities.
+   * @param[out]  *pIndex        points to the indices of the most similar templates, unused when <code>k</code> is 0.
+   * @return the number of similarities written.
+   */
+
+  uint32_t riscv_dist_cosine_q15(
+  const q15_t * pVec,
+  const q15_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  q15_t * pDist,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Cosine similarity of a Q7 vector to every template, or to the k most similar.
+   * @param[in]   *pVec          points to the vector.
+   * @param[in]   *pTemplates    points to the templates, one after the other.
+   * @param[in]   dim            number of elements of the vector and of each template.
+   * @param[in]   numTemplates   number of templates.
+   * @param[in]   k              number of most similar templates to keep, 0 for all the similarities.
+   * @param[out]  *pDist         points to the similarities.
+   * @param[out]  *pIndex        points to the indices of the most similar templates, unused when <code>k</code> is 0.
+   * @return the number of similarities written.
+   */
+
+  uint32_t riscv_dist_cosine_q7(
+  const q7_t * pVec,
+  const q7_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  q15_t * pDist,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Hamming distance of a packed bit vector to every template, or to the k nearest.
+   * @param[in]   *pVec          points to the vector.
+   * @param[in]   *pTemplates    points to the templates, one after the other.
+   * @param[in]   numWords       number of words of the vector and of each template.
+   * @param[in]   numTemplates   number of templates.
+   * @param[in]   k              number of nearest templates to keep, 0 for all the distances.
+   * @param[out]  *pDist         points to the distances.
+   * @param[out]  *pIndex        points to the indices of the nearest templates, unused when <code>k</code> is 0.
+   * @return the number of distances written.
+   */
+
+  uint32_t riscv_dist_hamming_u32(
+  const uint32_t * pVec,
+  const uint32_t * pTemplates,
+  uint32_t numWords,
+  uint32_t numTemplates,
+  uint32_t k,
+  uint32_t * pDist,
+  uint32_t * pIndex);
+
+  /**
+   * @brief  Covariance matrix of floating-point channel-interleaved data.
+   * @param[in]   *pSrc          points to <code>numSamples</code> frames of <code>numChannels</code> samples.
+   * @param[in]   numChannels    number of channels.
+   * @param[in]   numSamples     number of frames.
+   * @param[in]   lambda         forgetting factor applied to <code>pCov</code>, 0 to overwrite it.
+   * @param[in,out] *pCov        points to the <code>numChannels*numChannels</code> matrix.
+   * @return none.
+   */
+
+  void riscv_covariance_f32(
+  const float32_t * pSrc,
+  uint16_t numChannels,
+  uint32_t numSamples,
+  float32_t lambda,
+  float32_t * pCov);
+
+  /**
+   * @brief  Covariance matrix of Q15 channel-interleaved data.
+   * @param[in]   *pSrc          points to <code>numSamples</code> frames of <code>numChannels</code> samples.
+   * @param[in]   numChannels    number of channels.
+   * @param[in]   numSamples     number of frames.
+   * @param[in]   lambda         forgetting factor in 1.15 format, 0 to overwrite <code>pCov</code>.
+   * @param[in,out] *pCov        points to the <code>numChannels*numChannels</code> matrix, 34.30 format.
+   * @return none.
+   */
+
+  void riscv_covariance_q15(
+  const q15_t * pSrc,
+  uint16_t numChannels,
+  uint32_t numSamples,
+  q15_t lambda,
+  q63_t * pCov);
+
+  /**
+   * @brief  Covariance matrix of Q31 channel-interleaved data.
+   * @param[in]   *pSrc          points to <code>numSamples</code> frames of <code>numChannels</code> samples.
+   * @param[in]   numChannels    number of channels.
+   * @param[in]   numSamples     number of frames.
+   * @param[in]   lambda         forgetting factor in 1.31 format, 0 to overwrite <code>pCov</code>.
+   * @param[in,out] *pCov        points to the <code>numChannels*numChannels</code> matrix, 16.48 format.
+   * @return none.
+   */
+
+  void riscv_covariance_q31(
+  const q31_t * pSrc,
+  uint16_t numChannels,
+  uint32_t numSamples,
+  q31_t lambda,
+  q63_t * pCov);
+
+  /**
+   * @brief  Covariance matrix of complex floating-point channel-interleaved data.
+   * @param[in]   *pSrc          points to <code>numSamples</code> frames of <code>numChannels</code> complex samples.
+   * @param[in]   numChannels    number of channels.
+   * @param[in]   numSamples     number of frames.
+   * @param[in]   lambda         forgetting factor applied to <code>pCov</code>, 0 to overwrite it.
+   * @param[in,out] *pCov        points to the <code>numChannels*numChannels</code> complex matrix.
+   * @return none.
+   */
+
+  void riscv_cmplx_covariance_f32(
+  const float32_t * pSrc,
+  uint16_t numChannels,
+  uint32_t numSamples,
+  float32_t lambda,
+  float32_t * pCov);
+
+  /**
+   * @brief  Covariance matrix of complex Q15 channel-interleaved data.
+   * @param[in]   *pSrc          points to <code>numSamples</code> frames of <code>numChannels</code> complex samples.
+   * @param[in]   numChannels    number of channels.
+   * @param[in]   numSamples     number of frames.
+   * @param[in]   lambda         forgetting factor in 1.15 format, 0 to overwrite <code>pCov</code>.
+   * @param[in,out] *pCov        points to the <code>numChannels*numChannels</code> complex matrix, 34.30 format.
+   * @return none.
+   */
+
+  void riscv_cmplx_covariance_q15(
+  const q15_t * pSrc,
+  uint16_t numChannels,
+  uint32_t numSamples,
+  q15_t lambda,
+  q63_t * pCov);
+
+  /**
+   * @brief  Covariance matrix of complex Q31 channel-interleaved data.
+   * @param[in]   *pSrc          points to <code>numSamples</code> frames of <code>numChannels</code> complex samples.
+   * @param[in]   numChannels    number of channels.
+   * @param[in]   numSamples     number of frames.
+   * @param[in]   lambda         forgetting factor in 1.31 format, 0 to overwrite <code>pCov</code>.
+   * @param[in,out] *pCov        points to the <code>numChannels*numChannels</code> complex matrix, 16.48 format.
+   * @return none.
+   */
+
+  void riscv_cmplx_covariance_q31(
+  const q31_t * pSrc,
+  uint16_t numChannels,
+  uint32_t numSamples,
+  q31_t lambda,
+  q63_t * pCov);
+
+  /**
+   * @brief  Q15 complex-by-complex multiplication
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[out]  *pDst  points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mult_cmplx_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex-by-complex multiplication
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[out]  *pDst  points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mult_cmplx_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex-by-complex multiplication
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[out]  *pDst  points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mult_cmplx_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex-by-complex multiplication on planar data
+   * @param[in]  *pSrcARe points to the real parts of the first input
+   * @param[in]  *pSrcAIm points to the imaginary parts of the first input
+   * @param[in]  *pSrcBRe points to the real parts of the second input
+   * @param[in]  *pSrcBIm points to the imaginary parts of the second input
+   * @param[out] *pDstRe  points to the real parts of the output
+   * @param[out] *pDstIm  points to the imaginary parts of the output
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mult_cmplx_planar_q15(
+  q15_t * pSrcARe,
+  q15_t * pSrcAIm,
+  q15_t * pSrcBRe,
+  q15_t * pSrcBIm,
+  q15_t * pDstRe,
+  q15_t * pDstIm,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex-by-complex multiplication on planar data
+   * @param[in]  *pSrcARe points to the real parts of the first input
+   * @param[in]  *pSrcAIm points to the imaginary parts of the first input
+   * @param[in]  *pSrcBRe points to the real parts of the second input
+   * @param[in]  *pSrcBIm points to the imaginary parts of the second input
+   * @param[out] *pDstRe  points to the real parts of the output
+   * @param[out] *pDstIm  points to the imaginary parts of the output
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mult_cmplx_planar_q31(
+  q31_t * pSrcARe,
+  q31_t * pSrcAIm,
+  q31_t * pSrcBRe,
+  q31_t * pSrcBIm,
+  q31_t * pDstRe,
+  q31_t * pDstIm,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex-by-complex multiplication on planar data
+   * @param[in]  *pSrcARe points to the real parts of the first input
+   * @param[in]  *pSrcAIm points to the imaginary parts of the first input
+   * @param[in]  *pSrcBRe points to the real parts of the second input
+   * @param[in]  *pSrcBIm points to the imaginary parts of the second input
+   * @param[out] *pDstRe  points to the real parts of the output
+   * @param[out] *pDstIm  points to the imaginary parts of the output
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mult_cmplx_planar_f32(
+  float32_t * pSrcARe,
+  float32_t * pSrcAIm,
+  float32_t * pSrcBRe,
+  float32_t * pSrcBIm,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex-by-real multiplication on planar data
+   * @param[in]  *pSrcRe   points to the real parts of the complex input
+   * @param[in]  *pSrcIm   points to the imaginary parts of the complex input
+   * @param[in]  *pSrcReal points to the real input
+   * @param[out] *pDstRe   points to the real parts of the output
+   * @param[out] *pDstIm   points to the imaginary parts of the output
+   * @param[in]  numSamples number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mult_real_planar_q15(
+  q15_t * pSrcRe,
+  q15_t * pSrcIm,
+  q15_t * pSrcReal,
+  q15_t * pDstRe,
+  q15_t * pDstIm,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex-by-real multiplication on planar data
+   * @param[in]  *pSrcRe   points to the real parts of the complex input
+   * @param[in]  *pSrcIm   points to the imaginary parts of the complex input
+   * @param[in]  *pSrcReal points to the real input
+   * @param[out] *pDstRe   points to the real parts of the output
+   * @param[out] *pDstIm   points to the imaginary parts of the output
+   * @param[in]  numSamples number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mult_real_planar_q31(
+  q31_t * pSrcRe,
+  q31_t * pSrcIm,
+  q31_t * pSrcReal,
+  q31_t * pDstRe,
+  q31_t * pDstIm,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex-by-real multiplication on planar data
+   * @param[in]  *pSrcRe   points to the real parts of the complex input
+   * @param[in]  *pSrcIm   points to the imaginary parts of the complex input
+   * @param[in]  *pSrcReal points to the real input
+   * @param[out] *pDstRe   points to the real parts of the output
+   * @param[out] *pDstIm   points to the imaginary parts of the output
+   * @param[in]  numSamples number of samples in each vector
+   * @return none.
+   */
+
+  void riscv_cmplx_mult_real_planar_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pSrcReal,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex magnitude on planar data
+   * @param[in]  *pSrcRe points to the real parts of the input
+   * @param[in]  *pSrcIm points to the imaginary parts of the input
+   * @param[out] *pDst   points to the real output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_planar_q15(
+  q15_t * pSrcRe,
+  q15_t * pSrcIm,
+  q15_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex magnitude on planar data
+   * @param[in]  *pSrcRe points to the real parts of the input
+   * @param[in]  *pSrcIm points to the imaginary parts of the input
+   * @param[out] *pDst   points to the real output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_planar_q31(
+  q31_t * pSrcRe,
+  q31_t * pSrcIm,
+  q31_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex magnitude on planar data
+   * @param[in]  *pSrcRe points to the real parts of the input
+   * @param[in]  *pSrcIm points to the imaginary parts of the input
+   * @param[out] *pDst   points to the real output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_planar_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex magnitude squared on planar data
+   * @param[in]  *pSrcRe points to the real parts of the input
+   * @param[in]  *pSrcIm points to the imaginary parts of the input
+   * @param[out] *pDst   points to the real output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_squared_planar_q15(
+  q15_t * pSrcRe,
+  q15_t * pSrcIm,
+  q15_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex magnitude squared on planar data
+   * @param[in]  *pSrcRe points to the real parts of the input
+   * @param[in]  *pSrcIm points to the imaginary parts of the input
+   * @param[out] *pDst   points to the real output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_squared_planar_q31(
+  q31_t * pSrcRe,
+  q31_t * pSrcIm,
+  q31_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex magnitude squared on planar data
+   * @param[in]  *pSrcRe points to the real parts of the input
+   * @param[in]  *pSrcIm points to the imaginary parts of the input
+   * @param[out] *pDst   points to the real output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void riscv_cmplx_mag_squared_planar_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex conjugate on planar data
+   * @param[in]  *pSrcRe points to the real parts of the input
+   * @param[in]  *pSrcIm points to the imaginary parts of the input
+   * @param[out] *pDstRe points to the real parts of the output
+   * @param[out] *pDstIm points to the imaginary parts of the output
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void riscv_cmplx_conj_planar_q15(
+  q15_t * pSrcRe,
+  q15_t * pSrcIm,
+  q15_t * pDstRe,
+  q15_t * pDstIm,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex conjugate on planar data
+   * @param[in]  *pSrcRe points to the real parts of the input
+   * @param[in]  *pSrcIm points to the imaginary parts of the input
+   * @param[out] *pDstRe points to the real parts of the output
+   * @param[out] *pDstIm points to the imaginary parts of the output
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void riscv_cmplx_conj_planar_q31(
+  q31_t * pSrcRe,
+  q31_t * pSrcIm,
+  q31_t * pDstRe,
+  q31_t * pDstIm,
+  uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex conjugate on planar data
+   * @param[in]  *pSrcRe points to the real parts of the input
+   * @param[in]  *pSrcIm points to the imaginary parts of the input
+   * @param[out] *pDstRe points to the real parts of the output
+   * @param[out] *pDstIm points to the imaginary parts of the output
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void riscv_cmplx_conj_planar_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples);
+
+  /**
+   * @brief Converts the elements of the floating-point vector to Q31 vector.
+   * @param[in]       *pSrc points to the floating-point input vector
+   * @param[out]      *pDst points to the Q31 output vector
+   * @param[in]       blockSize length of the input vector
+   * @return none.
+   */
+  void riscv_float_to_q31(
+  float32_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Converts the elements of the floating-point vector to Q15 vector.
+   * @param[in]       *pSrc points to the floating-point input vector
+   * @param[out]      *pDst points to the Q15 output vector
+   * @param[in]       blockSize length of the input vector
+   * @return          none
+   */
+  void riscv_float_to_q15(
+  float32_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Converts the elements of the floating-point vector to Q7 vector.
+   * @param[in]       *pSrc points to the floating-point input vector
+   * @param[out]      *pDst points to the Q7 output vector
+   * @param[in]       blockSize length of the input vector
+   * @return          none
+   */
+  void riscv_float_to_q7(
+  float32_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Converts the elements of the Q31 vector to Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @return none.
+   */
+  void riscv_q31_to_q15(
+  q31_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure of the dithered Q15 conversions.
+   */
+
+  typedef struct
+  {
+    uint16_t numChannels;           /**< number of interleaved channels, each with its own error feedback. */
+    uint8_t order;                  /**< order of the noise shaping, 0 for plain TPDF dither. */
+    uint32_t seed;                  /**< state of the xorshift32 generator of the dither. */
+    q31_t *pState;                  /**< points to the two last quantization errors of each channel, 2*numChannels words. */
+  } riscv_dither_instance;
+
+  /**
+   * @brief  Initialization function of the dithered Q15 conversions.
+   * @param[out] *S           points to an instance of the dither structure.
+   * @param[in]  numChannels  number of interleaved channels.
+   * @param[in]  order        order of the noise shaping, 0, 1 or 2.
+   * @param[in]  seed         seed of the dither generator, 0 selects a default one.
+   * @param[in]  *pState      points to the state buffer of 2*numChannels words.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numChannels is 0 or order is greater than 2.
+   */
+  riscv_status riscv_dither_init(
+  riscv_dither_instance * S,
+  uint16_t numChannels,
+  uint8_t order,
+  uint32_t seed,
+  q31_t * pState);
+
+  /**
+   * @brief  Converts a Q31 vector to Q15 with TPDF dither and noise shaping.
+   * @param[in,out] *S          points to an instance of the dither structure.
+   * @param[in]     *pSrc       points to the Q31 input vector.
+   * @param[out]    *pDst       points to the Q15 output vector.
+   * @param[in]     blockSize   number of samples, a multiple of the number of channels.
+   * @return none.
+   */
+  void riscv_q31_to_q15_dither(
+  riscv_dither_instance * S,
+  q31_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Converts a floating-point vector to Q15 with TPDF dither and noise shaping.
+   * @param[in,out] *S          points to an instance of the dither structure.
+   * @param[in]     *pSrc       points to the floating-point input vector.
+   * @param[out]    *pDst       points to the Q15 output vector.
+   * @param[in]     blockSize   number of samples, a multiple of the number of channels.
+   * @return none.
+   */
+  void riscv_float_to_q15_dither(
+  riscv_dither_instance * S,
+  float32_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Converts the elements of the Q31 vector to Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @return none.
+   */
+  void riscv_q31_to_q7(
+  q31_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Converts the elements of the Q15 vector to floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @return none.
+   */
+  void riscv_q15_to_float(
+  q15_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Converts the elements of the Q15 vector to Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @return none.
+   */
+  void riscv_q15_to_q31(
+  q15_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Converts the elements of the Q15 vector to Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @return none.
+   */
+  void riscv_q15_to_q7(
+  q15_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @ingroup groupInterpolation
+   */
+
+  /**
+   * @defgroup BilinearInterpolate Bilinear Interpolation
+   *
+   * Bilinear interpolation is an extension of linear interpolation applied to a two dimensional grid.
+   * The underlying function <code>f(x, y)</code> is sampled on a regular grid and the interpolation process
+   * determines values between the grid points.
+   * Bilinear interpolation is equivalent to two step linear interpolation, first in the x-dimension and then in the y-dimension.
+   * Bilinear interpolation is often used in image processing to rescale images.
+   * The CMSIS DSP library provides bilinear interpolation functions for Q7, Q15, Q31, and floating-point data types.
+   *
+   * <b>Algorithm</b>
+   * \par
+   * The instance structure used by the bilinear interpolation functions describes a two dimensional data table.
+   * For floating-point, the instance structure is defined as:
+   * <pre>
+   *   typedef struct
+   *   {
+   *     uint16_t numRows;
+   *     uint16_t numCols;
+   *     float32_t *pData;
+   * } riscv_bilinear_interp_instance_f32;
+   * </pre>
+   *
+   * \par
+   * where <code>numRows</code> specifies the number of rows in the table;
+   * <code>numCols</code> specifies the number of columns in the table;
+   * and <code>pData</code> points to an array of size <code>numRows*numCols</code> values.
+   * The data table <code>pTable</code> is organized in row order and the supplied data values fall on integer indexes.
+   * That is, table element (x,y) is located at <code>pTable[x + y*numCols]</code> where x and y are integers.
    *
-   * \par Algorithm:
+   * \par
+   * Let <code>(x, y)</code> specify the desired interpolation point.  Then define:
    * <pre>
-   *       y = y0 + (x - x0) * ((y1 - y0)/(x1-x0))
-   *       where x0, x1 are nearest values of input x
-   *             y0, y1 are nearest values to output y
+   *     XF = floor(x)
+   *     YF = floor(y)
    * </pre>
-   *
    * \par
-   * This set of functions implements Linear interpolation process
-   * for Q7, Q15, Q31, and floating-point data types.  The functions operate on a single
-   * sample of data and each call to the function returns a single processed value.
-   * <code>S</code> points to an instance of the Linear Interpolate function data structure.
-   * <code>x</code> is the input sample value. The functions returns the output value.
+   * The interpolated output point is computed as:
+   * <pre>
+   *  f(x, y) = f(XF, YF) * (1-(x-XF)) * (1-(y-YF))
+   *           + f(XF+1, YF) * (x-XF)*(1-(y-YF))
+   *           + f(XF, YF+1) * (1-(x-XF))*(y-YF)
+   *           + f(XF+1, YF+1) * (x-XF)*(y-YF)
+   * </pre>
+   * Note that the coordinates (x, y) contain integer and fractional components.
+   * The integer components specify which portion of the table to use while the
+   * fractional components control the interpolation processor.
    *
    * \par
-   * if x is outside of the table boundary, Linear interpolation returns first value of the table
-   * if x is below input range and returns last value of table if x is above range.
+   * if (x,y) are outside of the table boundary, Bilinear interpolation returns zero output.
+   *
+   * \par Block Functions
+   * riscv_bilinear_interp_block_f32(), riscv_bilinear_interp_block_q31(), riscv_bilinear_interp_block_q15() and
+   * riscv_bilinear_interp_block_q7() interpolate the points <code>(pX[n], pY[n])</code> of a block, and
+   * riscv_bilinear_interp_grid_q15() the uniform grid of points used to rescale an image.
+   * <code>X</code> selects the column and <code>Y</code> the row, so table element (x,y) is
+   * <code>pData[x + y*numCols]</code> as described above; the fixed-point coordinates are in 12.20 format.
+   * A point on the last column or row uses that column or row as its own neighbour, points with a negative
+   * coordinate or beyond the last column or row return zero.
    */
 
   /**
-   * @addtogroup LinearInterpolate
+   * @addtogroup BilinearInterpolate
    * @{
    */
 
   /**
-   * @brief  Process function for the floating-point Linear Interpolation Function.
-   * @param[in,out] *S is an instance of the floating-point Linear Interpolation structure
-   * @param[in] x input sample to process
-   * @return y processed output sample.
-   *
-   */
+  *
+  * @brief  Floating-point bilinear interpolation.
+  * @param[in,out] *S points to an instance of the interpolation structure.
+  * @param[in] X interpolation coordinate.
+  * @param[in] Y interpolation coordinate.
+  * @return out interpolated value.
+  */
+
+
+  static inline float32_t riscv_bilinear_interp_f32(
+  const riscv_bilinear_interp_instance_f32 * S,
+  float32_t X,
+  float32_t Y)
+  {
+    float32_t out;
+    float32_t f00, f01, f10, f11;
+    float32_t *pData = S->pData;
+    int32_t xIndex, yIndex, index;
+    float32_t xdiff, ydiff;
+    float32_t b1, b2, b3, b4;
+
+    xIndex = (int32_t) X;
+    yIndex = (int32_t) Y;
+
+    /* Care taken for table outside boundary */
+    /* Returns zero output when values are outside table boundary */
+    if(xIndex < 0 || xIndex > (S->numRows - 1) || yIndex < 0
+       || yIndex > (S->numCols - 1))
+    {
+      return (0);
+    }
+
+    /* Calculation of index for two nearest points in X-direction */
+    index = (xIndex - 1) + (yIndex - 1) * S->numCols;
+
+
+    /* Read two nearest points in X-direction */
+    f00 = pData[index];
+    f01 = pData[index + 1];
+
+    /* Calculation of index for two nearest points in Y-direction */
+    index = (xIndex - 1) + (yIndex) * S->numCols;
+
+
+    /* Read two nearest points in Y-direction */
+    f10 = pData[index];
+    f11 = pData[index + 1];
+
+    /* Calculation of intermediate values */
+    b1 = f00;
+    b2 = f01 - f00;
+    b3 = f10 - f00;
+    b4 = f00 - f01 - f10 + f11;
+
+    /* Calculation of fractional part in X */
+    xdiff = X - xIndex;
+
+    /* Calculation of fractional part in Y */
+    ydiff = Y - yIndex;
+
+    /* Calculation of bi-linear interpolated output */
+    out = b1 + b2 * xdiff + b3 * ydiff + b4 * xdiff * ydiff;
+
+    /* return to application */
+    return (out);
+
+  }
+
+  /**
+  *
+  * @brief  Q31 bilinear interpolation.
+  * @param[in,out] *S points to an instance of the interpolation structure.
+  * @param[in] X interpolation coordinate in 12.20 format.
+  * @param[in] Y interpolation coordinate in 12.20 format.
+  * @return out interpolated value.
+  */
+
+  static inline q31_t riscv_bilinear_interp_q31(
+  riscv_bilinear_interp_instance_q31 * S,
+  q31_t X,
+  q31_t Y)
+  {
+    q31_t out;                                   /* Temporary output */
+    q31_t acc = 0;                               /* output */
+    q31_t xfract, yfract;                        /* X, Y fractional parts */
+    q31_t x1, x2, y1, y2;                        /* Nearest output values */
+    int32_t rI, cI;                              /* Row and column indices */
+    q31_t *pYData = S->pData;                    /* pointer to output table values */
+    uint32_t nCols = S->numCols;                 /* num of rows */
+
+
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    rI = ((X & 0xFFF00000) >> 20u);
+
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    cI = ((Y & 0xFFF00000) >> 20u);
+
+    /* Care taken for table outside boundary */
+    /* Returns zero output when values are outside table boundary */
+    if(rI < 0 || rI > (S->numRows - 1) || cI < 0 || cI > (S->numCols - 1))
+    {
+      return (0);
+    }
+
+    /* 20 bits for the fractional part */
+    /* shift left xfract by 11 to keep 1.31 format */
+    xfract = (X & 0x000FFFFF) << 11u;
+
+    /* Read two nearest output values from the index */
+    x1 = pYData[(rI) + nCols * (cI)];
+    x2 = pYData[(rI) + nCols * (cI) + 1u];
+
+    /* 20 bits for the fractional part */
+    /* shift left yfract by 11 to keep 1.31 format */
+    yfract = (Y & 0x000FFFFF) << 11u;
+
+    /* Read two nearest output values from the index */
+    y1 = pYData[(rI) + nCols * (cI + 1)];
+    y2 = pYData[(rI) + nCols * (cI + 1) + 1u];
+
+    /* Calculation of x1 * (1-xfract ) * (1-yfract) and acc is in 3.29(q29) format */
+    out = ((q31_t) (((q63_t) x1 * (0x7FFFFFFF - xfract)) >> 32));
+    acc = ((q31_t) (((q63_t) out * (0x7FFFFFFF - yfract)) >> 32));
+
+    /* x2 * (xfract) * (1-yfract)  in 3.29(q29) and adding to acc */
+    out = ((q31_t) ((q63_t) x2 * (0x7FFFFFFF - yfract) >> 32));
+    acc += ((q31_t) ((q63_t) out * (xfract) >> 32));
+
+    /* y1 * (1 - xfract) * (yfract)  in 3.29(q29) and adding to acc */
+    out = ((q31_t) ((q63_t) y1 * (0x7FFFFFFF - xfract) >> 32));
+    acc += ((q31_t) ((q63_t) out * (yfract) >> 32));
+
+    /* y2 * (xfract) * (yfract)  in 3.29(q29) and adding to acc */
+    out = ((q31_t) ((q63_t) y2 * (xfract) >> 32));
+    acc += ((q31_t) ((q63_t) out * (yfract) >> 32));
+
+    /* Convert acc to 1.31(q31) format */
+    return (acc << 2u);
+
+  }
+
+  /**
+  * @brief  Q15 bilinear interpolation.
+  * @param[in,out] *S points to an instance of the interpolation structure.
+  * @param[in] X interpolation coordinate in 12.20 format.
+  * @param[in] Y interpolation coordinate in 12.20 format.
+  * @return out interpolated value.
+  */
+
+  static inline q15_t riscv_bilinear_interp_q15(
+  riscv_bilinear_interp_instance_q15 * S,
+  q31_t X,
+  q31_t Y)
+  {
+    q63_t acc = 0;                               /* output */
+    q31_t out;                                   /* Temporary output */
+    q15_t x1, x2, y1, y2;                        /* Nearest output values */
+    q31_t xfract, yfract;                        /* X, Y fractional parts */
+    int32_t rI, cI;                              /* Row and column indices */
+    q15_t *pYData = S->pData;                    /* pointer to output table values */
+    uint32_t nCols = S->numCols;                 /* num of rows */
+
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    rI = ((X & 0xFFF00000) >> 20);
+
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    cI = ((Y & 0xFFF00000) >> 20);
+
+    /* Care taken for table outside boundary */
+    /* Returns zero output when values are outside table boundary */
+    if(rI < 0 || rI > (S->numRows - 1) || cI < 0 || cI > (S->numCols - 1))
+    {
+      return (0);
+    }
+
+    /* 20 bits for the fractional part */
+    /* xfract should be in 12.20 format */
+    xfract = (X & 0x000FFFFF);
+
+    /* Read two nearest output values from the index */
+    x1 = pYData[(rI) + nCols * (cI)];
+    x2 = pYData[(rI) + nCols * (cI) + 1u];
+
+
+    /* 20 bits for the fractional part */
+    /* yfract should be in 12.20 format */
+    yfract = (Y & 0x000FFFFF);
+
+    /* Read two nearest output values from the index */
+    y1 = pYData[(rI) + nCols * (cI + 1)];
+    y2 = pYData[(rI) + nCols * (cI + 1) + 1u];
+
+    /* Calculation of x1 * (1-xfract ) * (1-yfract) and acc is in 13.51 format */
+
+    /* x1 is in 1.15(q15), xfract in 12.20 format and out is in 13.35 format */
+    /* convert 13.35 to 13.31 by right shifting  and out is in 1.31 */
+    out = (q31_t) (((q63_t) x1 * (0xFFFFF - xfract)) >> 4u);
+    acc = ((q63_t) out * (0xFFFFF - yfract));
+
+    /* x2 * (xfract) * (1-yfract)  in 1.51 and adding to acc */
+    out = (q31_t) (((q63_t) x2 * (0xFFFFF - yfract)) >> 4u);
+    acc += ((q63_t) out * (xfract));
+
+    /* y1 * (1 - xfract) * (yfract)  in 1.51 and adding to acc */
+    out = (q31_t) (((q63_t) y1 * (0xFFFFF - xfract)) >> 4u);
+    acc += ((q63_t) out * (yfract));
+
+    /* y2 * (xfract) * (yfract)  in 1.51 and adding to acc */
+    out = (q31_t) (((q63_t) y2 * (xfract)) >> 4u);
+    acc += ((q63_t) out * (yfract));
+
+    /* acc is in 13.51 format and down shift acc by 36 times */
+    /* Convert out to 1.15 format */
+    return (acc >> 36);
+
+  }
+
+  /**
+  * @brief  Q7 bilinear interpolation.
+  * @param[in,out] *S points to an instance of the interpolation structure.
+  * @param[in] X interpolation coordinate in 12.20 format.
+  * @param[in] Y interpolation coordinate in 12.20 format.
+  * @return out interpolated value.
+  */
 
-  static inline float32_t riscv_linear_interp_f32(
-  riscv_linear_interp_instance_f32 * S,
-  float32_t x)
+  static inline q7_t riscv_bilinear_interp_q7(
+  riscv_bilinear_interp_instance_q7 * S,
+  q31_t X,
+  q31_t Y)
   {
+    q63_t acc = 0;                               /* output */
+    q31_t out;                                   /* Temporary output */
+    q31_t xfract, yfract;                        /* X, Y fractional parts */
+    q7_t x1, x2, y1, y2;                         /* Nearest output values */
+    int32_t rI, cI;                              /* Row and column indices */
+    q7_t *pYData = S->pData;                     /* pointer to output table values */
+    uint32_t nCols = S->numCols;                 /* num of rows */
 
-    float32_t y;
-    float32_t x0, x1;                            /* Nearest input values */
-    float32_t y0, y1;                            /* Nearest output values */
-    float32_t xSpacing = S->xSpacing;            /* spacing between input values */
-    int32_t i;                                   /* Index variable */
-    float32_t *pYData = S->pYData;               /* pointer to output table */
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    rI = ((X & 0xFFF00000) >> 20);
 
-    /* Calculation of index */
-    i = (int32_t) ((x - S->x1) / xSpacing);
+    /* Input is in 12.20 format */
+    /* 12 bits for the table index */
+    /* Index value calculation */
+    cI = ((Y & 0xFFF00000) >> 20);
 
-    if(i < 0)
-    {
-      /* Iniatilize output for below specified range as least output value of table */
-      y = pYData[0];
-    }
-    else if((uint32_t)i >= S->nValues)
+    /* Care taken for table outside boundary */
+    /* Returns zero output when values are outside table boundary */
+    if(rI < 0 || rI > (S->numRows - 1) || cI < 0 || cI > (S->numCols - 1))
     {
-      /* Iniatilize output for above specified range as last output value of table */
-      y = pYData[S->nValues - 1];
+      return (0);
     }
-    else
-    {
-      /* Calculation of nearest input values */
-      x0 = S->x1 + i * xSpacing;
-      x1 = S->x1 + (i + 1) * xSpacing;
 
-      /* Read of nearest output values */
-      y0 = pYData[i];
-      y1 = pYData[i + 1];
+    /* 20 bits for the fractional part */
+    /* xfract should be in 12.20 format */
+    xfract = (X & 0x000FFFFF);
 
-      /* Calculation of output */
-      y = y0 + (x - x0) * ((y1 - y0) / (x1 - x0));
+    /* Read two nearest output values from the index */
+    x1 = pYData[(rI) + nCols * (cI)];
+    x2 = pYData[(rI) + nCols * (cI) + 1u];
 
-    }
 
-    /* returns output value */
-    return (y);
-  }
+    /* 20 bits for the fractional part */
+    /* yfract should be in 12.20 format */
+    yfract = (Y & 0x000FFFFF);
 
-   /**
-   *
-   * @brief  Process function for the Q31 Linear Interpolation Function.
-   * @param[in] *pYData  pointer to Q31 Linear Interpolation table
-   * @param[in] x input sample to process
-   * @param[in] nValues number of table values
-   * @return y processed output sample.
-   *
-   * \par
-   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
-   * This function can support maximum of table size 2^12.
-   *
-   */
+    /* Read two nearest output values from the index */
+    y1 = pYData[(rI) + nCols * (cI + 1)];
+    y2 = pYData[(rI) + nCols * (cI + 1) + 1u];
 
+    /* Calculation of x1 * (1-xfract ) * (1-yfract) and acc is in 16.47 format */
+    out = ((x1 * (0xFFFFF - xfract)));
+    acc = (((q63_t) out * (0xFFFFF - yfract)));
 
-  static inline q31_t riscv_linear_interp_q31(
-  q31_t * pYData,
-  q31_t x,
-  uint32_t nValues)
-  {
-    q31_t y;                                     /* output */
-    q31_t y0, y1;                                /* Nearest output values */
-    q31_t fract;                                 /* fractional part */
-    int32_t index;                               /* Index to read nearest output values */
+    /* x2 * (xfract) * (1-yfract)  in 2.22 and adding to acc */
+    out = ((x2 * (0xFFFFF - yfract)));
+    acc += (((q63_t) out * (xfract)));
 
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    index = ((x & 0xFFF00000) >> 20);
+    /* y1 * (1 - xfract) * (yfract)  in 2.22 and adding to acc */
+    out = ((y1 * (0xFFFFF - xfract)));
+    acc += (((q63_t) out * (yfract)));
 
-    if(index >= (int32_t)(nValues - 1))
-    {
-      return (pYData[nValues - 1]);
-    }
-    else if(index < 0)
-    {
-      return (pYData[0]);
-    }
-    else
-    {
+    /* y2 * (xfract) * (yfract)  in 2.22 and adding to acc */
+    out = ((y2 * (yfract)));
+    acc += (((q63_t) out * (xfract)));
 
-      /* 20 bits for the fractional part */
-      /* shift left by 11 to keep fract in 1.31 format */
-      fract = (x & 0x000FFFFF) << 11;
+    /* acc in 16.47 format and down shift by 40 to convert to 1.7 format */
+    return (acc >> 40);
 
-      /* Read two nearest output values from the index in 1.31(q31) format */
-      y0 = pYData[index];
-      y1 = pYData[index + 1u];
+  }
 
-      /* Calculation of y0 * (1-fract) and y is in 2.30 format */
-      y = ((q31_t) ((q63_t) y0 * (0x7FFFFFFF - fract) >> 32));
+  /**
+   * @} end of BilinearInterpolate group
+   */
 
-      /* Calculation of y0 * (1-fract) + y1 *fract and y is in 2.30 format */
-      y += ((q31_t) (((q63_t) y1 * fract) >> 32));
+  /**
+   * @brief  Floating-point bilinear interpolation of a block of points.
+   * @param[in]  *S         points to an instance of the interpolation structure.
+   * @param[in]  *pX        points to the column coordinates of the points.
+   * @param[in]  *pY        points to the row coordinates of the points.
+   * @param[out] *pDst      points to the interpolated outputs.
+   * @param[in]  blockSize  number of points.
+   * @return none.
+   */
 
-      /* Convert y to 1.31 format */
-      return (y << 1u);
+  void riscv_bilinear_interp_block_f32(
+  const riscv_bilinear_interp_instance_f32 * S,
+  float32_t * pX,
+  float32_t * pY,
+  float32_t * pDst,
+  uint32_t blockSize);
 
-    }
+  /**
+   * @brief  Q31 bilinear interpolation of a block of points.
+   * @param[in]  *S         points to an instance of the interpolation structure.
+   * @param[in]  *pX        points to the column coordinates of the points in 12.20 format.
+   * @param[in]  *pY        points to the row coordinates of the points in 12.20 format.
+   * @param[out] *pDst      points to the interpolated outputs.
+   * @param[in]  blockSize  number of points.
+   * @return none.
+   */
 
-  }
+  void riscv_bilinear_interp_block_q31(
+  const riscv_bilinear_interp_instance_q31 * S,
+  q31_t * pX,
+  q31_t * pY,
+  q31_t * pDst,
+  uint32_t blockSize);
 
   /**
-   *
-   * @brief  Process function for the Q15 Linear Interpolation Function.
-   * @param[in] *pYData  pointer to Q15 Linear Interpolation table
-   * @param[in] x input sample to process
-   * @param[in] nValues number of table values
-   * @return y processed output sample.
-   *
-   * \par
-   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
-   * This function can support maximum of table size 2^12.
-   *
+   * @brief  Q15 bilinear interpolation of a block of points.
+   * @param[in]  *S         points to an instance of the interpolation structure.
+   * @param[in]  *pX        points to the column coordinates of the points in 12.20 format.
+   * @param[in]  *pY        points to the row coordinates of the points in 12.20 format.
+   * @param[out] *pDst      points to the interpolated outputs.
+   * @param[in]  blockSize  number of points.
+   * @return none.
    */
 
+  void riscv_bilinear_interp_block_q15(
+  const riscv_bilinear_interp_instance_q15 * S,
+  q31_t * pX,
+  q31_t * pY,
+  q15_t * pDst,
+  uint32_t blockSize);
 
-  static inline q15_t riscv_linear_interp_q15(
-  q15_t * pYData,
+  /**
+   * @brief  Q15 bilinear interpolation on the grid of points (x + i*xStep, y + j*yStep).
+   * @param[in]  *S      points to an instance of the interpolation structure.
+   * @param[in]  x       column coordinate of the first point in 12.20 format.
+   * @param[in]  xStep   distance between two columns of the grid in 12.20 format.
+   * @param[in]  numX    number of columns of the grid.
+   * @param[in]  y       row coordinate of the first point in 12.20 format.
+   * @param[in]  yStep   distance between two rows of the grid in 12.20 format.
+   * @param[in]  numY    number of rows of the grid.
+   * @param[out] *pDst   points to the <code>numX*numY</code> outputs, in row order.
+   * @return none.
+   */
+
+  void riscv_bilinear_interp_grid_q15(
+  const riscv_bilinear_interp_instance_q15 * S,
   q31_t x,
-  uint32_t nValues)
-  {
-    q63_t y;                                     /* output */
-    q15_t y0, y1;                                /* Nearest output values */
-    q31_t fract;                                 /* fractional part */
-    int32_t index;                               /* Index to read nearest output values */
+  q31_t xStep,
+  uint32_t numX,
+  q31_t y,
+  q31_t yStep,
+  uint32_t numY,
+  q15_t * pDst);
 
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    index = ((x & 0xFFF00000) >> 20u);
+  /**
+   * @brief  Q7 bilinear interpolation of a block of points.
+   * @param[in]  *S         points to an instance of the interpolation structure.
+   * @param[in]  *pX        points to the column coordinates of the points in 12.20 format.
+   * @param[in]  *pY        points to the row coordinates of the points in 12.20 format.
+   * @param[out] *pDst      points to the interpolated outputs.
+   * @param[in]  blockSize  number of points.
+   * @return none.
+   */
 
-    if(index >= (int32_t)(nValues - 1))
-    {
-      return (pYData[nValues - 1]);
-    }
-    else if(index < 0)
-    {
-      return (pYData[0]);
-    }
-    else
-    {
-      /* 20 bits for the fractional part */
-      /* fract is in 12.20 format */
-      fract = (x & 0x000FFFFF);
+  void riscv_bilinear_interp_block_q7(
+  const riscv_bilinear_interp_instance_q7 * S,
+  q31_t * pX,
+  q31_t * pY,
+  q7_t * pDst,
+  uint32_t blockSize);
 
-      /* Read two nearest output values from the index */
-      y0 = pYData[index];
-      y1 = pYData[index + 1u];
+  /**
+   * @brief  Initialization function for the floating-point cubic spline interpolation.
+   * @param[out] *S            points to an instance of the spline structure.
+   * @param[in]  type          end condition of the spline.
+   * @param[in]  *pX           points to the <code>nValues</code> abscissas, strictly increasing.
+   * @param[in]  *pY           points to the <code>nValues</code> values.
+   * @param[in]  nValues       number of points, at least 2.
+   * @param[out] *pCoeffs      points to a buffer of <code>3*(nValues-1)</code> words that receives the coefficients.
+   * @param[in]  *pTempBuffer  points to a scratch buffer of <code>2*nValues-1</code> words.
+   * @return     RISCV_MATH_SUCCESS, RISCV_MATH_LENGTH_ERROR if <code>nValues</code> is less than 2, or
+   * RISCV_MATH_ARGUMENT_ERROR if <code>type</code> is unknown or the abscissas are not strictly increasing.
+   */
+
+  riscv_status riscv_spline_init_f32(
+  riscv_spline_instance_f32 * S,
+  riscv_spline_type type,
+  float32_t * pX,
+  float32_t * pY,
+  uint32_t nValues,
+  float32_t * pCoeffs,
+  float32_t * pTempBuffer);
 
-      /* Calculation of y0 * (1-fract) and y is in 13.35 format */
-      y = ((q63_t) y0 * (0xFFFFF - fract));
+  /**
+   * @brief  Floating-point cubic spline interpolation of a block of points.
+   * @param[in]  *S         points to an instance of the spline structure.
+   * @param[in]  *pXq       points to the points.
+   * @param[out] *pDst      points to the interpolated outputs.
+   * @param[in]  blockSize  number of points.
+   * @return none.
+   */
 
-      /* Calculation of (y0 * (1-fract) + y1 * fract) and y is in 13.35 format */
-      y += ((q63_t) y1 * (fract));
+  void riscv_spline_f32(
+  const riscv_spline_instance_f32 * S,
+  float32_t * pXq,
+  float32_t * pDst,
+  uint32_t blockSize);
 
-      /* convert y to 1.15 format */
-      return (y >> 20);
-    }
+  /**
+   * @brief  Weights of a 4-point cubic interpolator in 2.30 format.
+   * @param[in]  type       interpolation polynomial.
+   * @param[in]  t          position between the two middle points in 2.30 format, from 0 to 0x40000000.
+   * @param[out] *pWeights  points to the four weights in 2.30 format, oldest point first.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>type</code> is unknown or <code>t</code>
+   * is outside of the range.
+   */
 
+  riscv_status riscv_cubic_weights_q31(
+  riscv_cubic_interp_type type,
+  q31_t t,
+  q31_t * pWeights);
 
-  }
+  /**
+   * @brief  Initialization function for the floating-point fractional delay.
+   * @param[out] *S         points to an instance of the floating-point fractional delay structure.
+   * @param[in]  type       interpolation polynomial.
+   * @param[in]  fract      fractional part of the delay, from 0 to less than 1.
+   * @param[in]  *pState    points to the state buffer of <code>blockSize+3</code> samples.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>type</code> or <code>fract</code> is invalid.
+   */
+
+  riscv_status riscv_frac_delay_init_f32(
+  riscv_frac_delay_instance_f32 * S,
+  riscv_cubic_interp_type type,
+  float32_t fract,
+  float32_t * pState,
+  uint32_t blockSize);
 
   /**
-   *
-   * @brief  Process function for the Q7 Linear Interpolation Function.
-   * @param[in] *pYData  pointer to Q7 Linear Interpolation table
-   * @param[in] x input sample to process
-   * @param[in] nValues number of table values
-   * @return y processed output sample.
-   *
-   * \par
-   * Input sample <code>x</code> is in 12.20 format which contains 12 bits for table index and 20 bits for fractional part.
-   * This function can support maximum of table size 2^12.
+   * @brief  Sets the fraction of the floating-point fractional delay, the state is kept.
+   * @param[in,out] *S     points to an instance of the floating-point fractional delay structure.
+   * @param[in]     fract  fractional part of the delay, from 0 to less than 1.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>fract</code> is invalid.
+   */
+
+  riscv_status riscv_frac_delay_set_f32(
+  riscv_frac_delay_instance_f32 * S,
+  float32_t fract);
+
+  /**
+   * @brief  Processing function for the floating-point fractional delay.
+   * @param[in]  *S         points to an instance of the floating-point fractional delay structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   * @return none.
+   */
+
+  void riscv_frac_delay_f32(
+  const riscv_frac_delay_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 fractional delay.
+   * @param[out] *S         points to an instance of the Q31 fractional delay structure.
+   * @param[in]  type       interpolation polynomial.
+   * @param[in]  fract      fractional part of the delay in 1.31 format, from 0 to 0x7FFFFFFF.
+   * @param[in]  *pState    points to the state buffer of <code>blockSize+3</code> samples.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>type</code> or <code>fract</code> is invalid.
    */
 
+  riscv_status riscv_frac_delay_init_q31(
+  riscv_frac_delay_instance_q31 * S,
+  riscv_cubic_interp_type type,
+  q31_t fract,
+  q31_t * pState,
+  uint32_t blockSize);
 
-  static inline q7_t riscv_linear_interp_q7(
-  q7_t * pYData,
-  q31_t x,
-  uint32_t nValues)
-  {
-    q31_t y;                                     /* output */
-    q7_t y0, y1;                                 /* Nearest output values */
-    q31_t fract;                                 /* fractional part */
-    uint32_t index;                              /* Index to read nearest output values */
+  /**
+   * @brief  Sets the fraction of the Q31 fractional delay, the state is kept.
+   * @param[in,out] *S     points to an instance of the Q31 fractional delay structure.
+   * @param[in]     fract  fractional part of the delay in 1.31 format, from 0 to 0x7FFFFFFF.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>fract</code> is invalid.
+   */
 
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    if (x < 0)
-    {
-      return (pYData[0]);
-    }
-    index = (x >> 20) & 0xfff;
+  riscv_status riscv_frac_delay_set_q31(
+  riscv_frac_delay_instance_q31 * S,
+  q31_t fract);
 
+  /**
+   * @brief  Processing function for the Q31 fractional delay.
+   * @param[in]  *S         points to an instance of the Q31 fractional delay structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   * @return none.
+   */
 
-    if(index >= (nValues - 1))
-    {
-      return (pYData[nValues - 1]);
-    }
-    else
-    {
+  void riscv_frac_delay_q31(
+  const riscv_frac_delay_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
-      /* 20 bits for the fractional part */
-      /* fract is in 12.20 format */
-      fract = (x & 0x000FFFFF);
+  /**
+   * @brief  Initialization function for the Q15 fractional delay.
+   * @param[out] *S         points to an instance of the Q15 fractional delay structure.
+   * @param[in]  type       interpolation polynomial.
+   * @param[in]  fract      fractional part of the delay in 1.15 format, from 0 to 0x7FFF.
+   * @param[in]  *pState    points to the state buffer of <code>blockSize+3</code> samples, 4-byte aligned.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>type</code> or <code>fract</code> is invalid.
+   */
 
-      /* Read two nearest output values from the index and are in 1.7(q7) format */
-      y0 = pYData[index];
-      y1 = pYData[index + 1u];
+  riscv_status riscv_frac_delay_init_q15(
+  riscv_frac_delay_instance_q15 * S,
+  riscv_cubic_interp_type type,
+  q15_t fract,
+  q15_t * pState,
+  uint32_t blockSize);
 
-      /* Calculation of y0 * (1-fract ) and y is in 13.27(q27) format */
-      y = ((y0 * (0xFFFFF - fract)));
+  /**
+   * @brief  Sets the fraction of the Q15 fractional delay, the state is kept.
+   * @param[in,out] *S     points to an instance of the Q15 fractional delay structure.
+   * @param[in]     fract  fractional part of the delay in 1.15 format, from 0 to 0x7FFF.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>fract</code> is invalid.
+   */
 
-      /* Calculation of y1 * fract + y0 * (1-fract) and y is in 13.27(q27) format */
-      y += (y1 * fract);
+  riscv_status riscv_frac_delay_set_q15(
+  riscv_frac_delay_instance_q15 * S,
+  q15_t fract);
 
-      /* convert y to 1.7(q7) format */
-      return (y >> 20u);
+  /**
+   * @brief  Processing function for the Q15 fractional delay.
+   * @param[in]  *S         points to an instance of the Q15 fractional delay structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   * @return none.
+   */
 
-    }
+  void riscv_frac_delay_q15(
+  const riscv_frac_delay_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
 
-  }
   /**
-   * @} end of LinearInterpolate group
+   * @brief Half an output LSB of the NN layers, added to the accumulators so that the final
+   * right shift by <code>out_shift</code> rounds to nearest.
    */
+#define RISCV_NN_ROUND(out_shift)    ((q31_t) ((0x1u << (out_shift)) >> 1))
 
   /**
-   * @brief  Fast approximation to the trigonometric sine function for floating-point data.
-   * @param[in] x input value in radians.
-   * @return  sin(x).
+   * @brief Q7 fully-connected layer.
+   * @param[in]  *pV          points to the input vector of <code>dim_vec</code> elements.
+   * @param[in]  *pM          points to the weights, <code>num_of_rows</code> rows of <code>dim_vec</code> elements.
+   * @param[in]  dim_vec      length of the input vector.
+   * @param[in]  num_of_rows  number of rows of the weights and of outputs.
+   * @param[in]  bias_shift   left shift of the bias before the accumulation.
+   * @param[in]  out_shift    right shift of the accumulator to the output format.
+   * @param[in]  *bias        points to the <code>num_of_rows</code> biases.
+   * @param[out] *pOut        points to the output vector of <code>num_of_rows</code> elements.
+   * @return none.
    */
 
-  float32_t riscv_sin_f32(
-  float32_t x);
+  void riscv_fully_connected_q7(
+  const q7_t * pV,
+  const q7_t * pM,
+  uint16_t dim_vec,
+  uint16_t num_of_rows,
+  uint16_t bias_shift,
+  uint16_t out_shift,
+  const q7_t * bias,
+  q7_t * pOut);
+
+  /**
+   * @brief Q15 fully-connected layer.
+   * @param[in]  *pV          points to the input vector of <code>dim_vec</code> elements.
+   * @param[in]  *pM          points to the weights, <code>num_of_rows</code> rows of <code>dim_vec</code> elements.
+   * @param[in]  dim_vec      length of the input vector.
+   * @param[in]  num_of_rows  number of rows of the weights and of outputs.
+   * @param[in]  bias_shift   left shift of the bias before the accumulation.
+   * @param[in]  out_shift    right shift of the accumulator to the output format.
+   * @param[in]  *bias        points to the <code>num_of_rows</code> biases.
+   * @param[out] *pOut        points to the output vector of <code>num_of_rows</code> elements.
+   * @return none.
+   */
+
+  void riscv_fully_connected_q15(
+  const q15_t * pV,
+  const q15_t * pM,
+  uint16_t dim_vec,
+  uint16_t num_of_rows,
+  uint16_t bias_shift,
+  uint16_t out_shift,
+  const q15_t * bias,
+  q15_t * pOut);
 
   /**
-   * @brief  Fast approximation to the trigonometric sine function for Q31 data.
-   * @param[in] x Scaled input value in radians.
-   * @return  sin(x).
+   * @brief Q7 convolution layer on HWC images.
+   * @param[in]  *Im_in       points to the input image, <code>dim_im_in * dim_im_in * ch_im_in</code> elements.
+   * @param[in]  dim_im_in    width and height of the input image.
+   * @param[in]  ch_im_in     number of input channels.
+   * @param[in]  *wt          points to the weights, <code>ch_im_out * dim_kernel * dim_kernel * ch_im_in</code> elements.
+   * @param[in]  ch_im_out    number of output channels, filters.
+   * @param[in]  dim_kernel   width and height of the filters.
+   * @param[in]  padding      zero padding on every side of the input image.
+   * @param[in]  stride       distance between the receptive fields of neighboring output pixels.
+   * @param[in]  *bias        points to the <code>ch_im_out</code> biases.
+   * @param[in]  bias_shift   left shift of the bias before the accumulation.
+   * @param[in]  out_shift    right shift of the accumulator to the output format.
+   * @param[out] *Im_out      points to the output image, <code>dim_im_out * dim_im_out * ch_im_out</code> elements.
+   * @param[in]  dim_im_out   width and height of the output image.
+   * @param[in]  *bufferA     points to a buffer of <code>2 * ch_im_in * dim_kernel * dim_kernel</code> elements.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>stride</code> is 0.
+   */
+
+  riscv_status riscv_convolve_HWC_q7(
+  const q7_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  const q7_t * wt,
+  uint16_t ch_im_out,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  const q7_t * bias,
+  uint16_t bias_shift,
+  uint16_t out_shift,
+  q7_t * Im_out,
+  uint16_t dim_im_out,
+  q7_t * bufferA);
+
+  /**
+   * @brief Q15 convolution layer on HWC images, see riscv_convolve_HWC_q7() for the arguments.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>stride</code> is 0.
+   */
+
+  riscv_status riscv_convolve_HWC_q15(
+  const q15_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  const q15_t * wt,
+  uint16_t ch_im_out,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  const q15_t * bias,
+  uint16_t bias_shift,
+  uint16_t out_shift,
+  q15_t * Im_out,
+  uint16_t dim_im_out,
+  q15_t * bufferA);
+
+  /**
+   * @brief Q7 depthwise convolution layer on HWC images, see riscv_convolve_HWC_q7() for the
+   * arguments; the weights are <code>dim_kernel * dim_kernel * ch_im_in</code> elements and
+   * <code>bufferA</code> is unused.
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>ch_im_in</code> and
+   * <code>ch_im_out</code> differ or <code>stride</code> is 0.
+   */
+
+  riscv_status riscv_depthwise_separable_conv_HWC_q7(
+  const q7_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  const q7_t * wt,
+  uint16_t ch_im_out,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  const q7_t * bias,
+  uint16_t bias_shift,
+  uint16_t out_shift,
+  q7_t * Im_out,
+  uint16_t dim_im_out,
+  q7_t * bufferA);
+
+  /**
+   * @brief Q15 depthwise convolution layer on HWC images, see riscv_depthwise_separable_conv_HWC_q7().
+   * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>ch_im_in</code> and
+   * <code>ch_im_out</code> differ or <code>stride</code> is 0.
+   */
+
+  riscv_status riscv_depthwise_separable_conv_HWC_q15(
+  const q15_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  const q15_t * wt,
+  uint16_t ch_im_out,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  const q15_t * bias,
+  uint16_t bias_shift,
+  uint16_t out_shift,
+  q15_t * Im_out,
+  uint16_t dim_im_out,
+  q15_t * bufferA);
+
+  /**
+   * @brief Q7 max pooling layer on HWC images.
+   * @param[in]  *Im_in       points to the input image, <code>dim_im_in * dim_im_in * ch_im_in</code> elements.
+   * @param[in]  dim_im_in    width and height of the input image.
+   * @param[in]  ch_im_in     number of channels.
+   * @param[in]  dim_kernel   width and height of the windows.
+   * @param[in]  padding      padding on every side of the input image.
+   * @param[in]  stride       distance between neighboring windows.
+   * @param[in]  dim_im_out   width and height of the output image.
+   * @param[out] *Im_out      points to the output image, <code>dim_im_out * dim_im_out * ch_im_in</code> elements.
+   * @return none.
    */
 
-  q31_t riscv_sin_q31(
-  q31_t x);
+  void riscv_maxpool_q7_HWC(
+  const q7_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  uint16_t dim_im_out,
+  q7_t * Im_out);
 
   /**
-   * @brief  Fast approximation to the trigonometric sine function for Q15 data.
-   * @param[in] x Scaled input value in radians.
-   * @return  sin(x).
+   * @brief Q7 average pooling layer on HWC images, see riscv_maxpool_q7_HWC() for the arguments.
+   * @return none.
    */
 
-  q15_t riscv_sin_q15(
-  q15_t x);
+  void riscv_avepool_q7_HWC(
+  const q7_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  uint16_t dim_im_out,
+  q7_t * Im_out);
 
   /**
-   * @brief  Fast approximation to the trigonometric cosine function for floating-point data.
-   * @param[in] x input value in radians.
-   * @return  cos(x).
+   * @brief Q15 max pooling layer on HWC images, see riscv_maxpool_q7_HWC() for the arguments.
+   * @return none.
    */
 
-  float32_t riscv_cos_f32(
-  float32_t x);
+  void riscv_maxpool_q15_HWC(
+  const q15_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  uint16_t dim_im_out,
+  q15_t * Im_out);
 
   /**
-   * @brief Fast approximation to the trigonometric cosine function for Q31 data.
-   * @param[in] x Scaled input value in radians.
-   * @return  cos(x).
+   * @brief Q15 average pooling layer on HWC images, see riscv_maxpool_q7_HWC() for the arguments.
+   * @return none.
    */
 
-  q31_t riscv_cos_q31(
-  q31_t x);
+  void riscv_avepool_q15_HWC(
+  const q15_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  uint16_t dim_im_out,
+  q15_t * Im_out);
 
   /**
-   * @brief  Fast approximation to the trigonometric cosine function for Q15 data.
-   * @param[in] x Scaled input value in radians.
-   * @return  cos(x).
+   * @brief Q7 ReLU, in place.
+   * @param[in,out] *data  points to the vector.
+   * @param[in]     size   number of elements.
+   * @return none.
    */
 
-  q15_t riscv_cos_q15(
-  q15_t x);
-
+  void riscv_relu_q7(
+  q7_t * data,
+  uint16_t size);
 
   /**
-   * @ingroup groupFastMath
+   * @brief Q15 ReLU, in place.
+   * @param[in,out] *data  points to the vector.
+   * @param[in]     size   number of elements.
+   * @return none.
    */
 
+  void riscv_relu_q15(
+  q15_t * data,
+  uint16_t size);
 
   /**
-   * @defgroup SQRT Square Root
-   *
-   * Computes the square root of a number.
-   * There are separate functions for Q15, Q31, and floating-point data types.
-   * The square root function is computed using the Newton-Raphson algorithm.
-   * This is an iterative algorithm of the form:
-   * <pre>
-   *      x1 = x0 - f(x0)/f'(x0)
-   * </pre>
-   * where <code>x1</code> is the current estimate,
-   * <code>x0</code> is the previous estimate, and
-   * <code>f'(x0)</code> is the derivative of <code>f()</code> evaluated at <code>x0</code>.
-   * For the square root function, the algorithm reduces to:
-   * <pre>
-   *     x0 = in/2                         [initial guess]
-   *     x1 = 1/2 * ( x0 + in / x0)        [each iteration]
-   * </pre>
+   * @brief Q7 softmax with powers of two.
+   * @param[in]  *vec_in   points to the input vector.
+   * @param[in]  dim_vec   number of elements.
+   * @param[out] *p_out    points to the Q7 probabilities, <code>dim_vec</code> elements.
+   * @return none.
    */
 
+  void riscv_softmax_q7(
+  const q7_t * vec_in,
+  uint16_t dim_vec,
+  q7_t * p_out);
 
   /**
-   * @addtogroup SQRT
-   * @{
+   * @brief Q15 softmax with powers of two.
+   * @param[in]  *vec_in   points to the input vector.
+   * @param[in]  dim_vec   number of elements.
+   * @param[out] *p_out    points to the Q15 probabilities, <code>dim_vec</code> elements.
+   * @return none.
    */
 
+  void riscv_softmax_q15(
+  const q15_t * vec_in,
+  uint16_t dim_vec,
+  q15_t * p_out);
+
   /**
-   * @brief  Floating-point square root function.
-   * @param[in]  in     input value.
-   * @param[out] *pOut  square root of input value.
-   * @return The function returns RISCV_MATH_SUCCESS if input value is positive value or RISCV_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @brief Alignment in bytes of every buffer of an arena.
    */
 
-  inline riscv_status riscv_sqrt_f32(
-  float32_t in,
-  float32_t * pOut)
-  {
-    if(in > 0)
-    {
+#define RISCV_DSP_ARENA_ALIGN 8u
 
+  /**
+   * @brief Bytes of an arena a request of <code>bytes</code> takes, rounded up to RISCV_DSP_ARENA_ALIGN.
+   */
 
-      *pOut = sqrt(in);
+#define RISCV_DSP_ARENA_ROUND(bytes) (((uint32_t) (bytes) + (RISCV_DSP_ARENA_ALIGN - 1u)) & ~(RISCV_DSP_ARENA_ALIGN - 1u))
 
+  /**
+   * @brief Arena the buffers of instances are taken from, see riscv_dsp_arena_init().
+   */
 
-      return (RISCV_MATH_SUCCESS);
-    }
-    else
-    {
-      *pOut = 0.0f;
-      return (RISCV_MATH_ARGUMENT_ERROR);
-    }
+  typedef struct
+  {
+    uint8_t *pBase;                           /**< points to the aligned start of the arena. */
+    uint32_t size;                            /**< usable bytes of the arena. */
+    uint32_t used;                            /**< bytes of the persistent buffers at the start. */
+    uint32_t scratch;                         /**< bytes of the shared scratch region at the end. */
+  } riscv_dsp_arena;
 
-  }
+  /**
+   * @brief  Initialization function for the arena.
+   * @param[out] *A     points to an instance of the arena structure.
+   * @param[in]  *pMem  points to the memory of the arena.
+   * @param[in]  size   size of the memory in bytes.
+   * @return none.
+   */
 
+  void riscv_dsp_arena_init(
+  riscv_dsp_arena * A,
+  void * pMem,
+  uint32_t size);
 
   /**
-   * @brief Q31 square root function.
-   * @param[in]   in    input value.  The range of the input value is [0 +1) or 0x00000000 to 0x7FFFFFFF.
-   * @param[out]  *pOut square root of input value.
-   * @return The function returns RISCV_MATH_SUCCESS if input value is positive value or RISCV_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @brief  Takes a persistent buffer from the start of the arena.
+   * @param[in,out] *A    points to an instance of the arena structure.
+   * @param[in]     size  size of the buffer in bytes.
+   * @return        pointer to the buffer, or NULL if the arena has not enough free memory.
    */
-  riscv_status riscv_sqrt_q31(
-  q31_t in,
-  q31_t * pOut);
+
+  void * riscv_dsp_arena_alloc(
+  riscv_dsp_arena * A,
+  uint32_t size);
 
   /**
-   * @brief  Q15 square root function.
-   * @param[in]   in     input value.  The range of the input value is [0 +1) or 0x0000 to 0x7FFF.
-   * @param[out]  *pOut  square root of input value.
-   * @return The function returns RISCV_MATH_SUCCESS if input value is positive value or RISCV_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @brief  Takes a scratch buffer from the shared region at the end of the arena.
+   * @param[in,out] *A    points to an instance of the arena structure.
+   * @param[in]     size  size of the buffer in bytes.
+   * @return        pointer to the buffer, or NULL if the arena has not enough free memory.
    */
-  riscv_status riscv_sqrt_q15(
-  q15_t in,
-  q15_t * pOut);
+
+  void * riscv_dsp_arena_scratch(
+  riscv_dsp_arena * A,
+  uint32_t size);
 
   /**
-   * @} end of SQRT group
+   * @brief  Number of bytes of the arena in use.
+   * @param[in] *A  points to an instance of the arena structure.
+   * @return    bytes of the persistent buffers and of the scratch region.
    */
 
+  uint32_t riscv_dsp_arena_usage(
+  const riscv_dsp_arena * A);
 
+  /**
+   * @brief  Releases all buffers of the arena.
+   * @param[in,out] *A  points to an instance of the arena structure.
+   * @return none.
+   */
 
+  void riscv_dsp_arena_reset(
+  riscv_dsp_arena * A);
 
+  /**
+   * @brief  Registers the region of the scratch pool.
+   * @param[in]  *pMem  points to the region, or NULL to disable the pool.
+   * @param[in]  size   size of the region in bytes.
+   * @return none.
+   */
 
+  void riscv_dsp_scratch_init(
+  void * pMem,
+  uint32_t size);
 
   /**
-   * @brief floating-point Circular write function.
+   * @brief  Pushes a buffer on the scratch pool.
+   * @param[in]  size  size of the buffer in bytes.
+   * @return     pointer to the buffer, aligned to RISCV_DSP_ARENA_ALIGN bytes, or NULL if the pool is too small.
    */
 
-  inline void riscv_circularWrite_f32(
-  int32_t * circBuffer,
-  int32_t L,
-  uint16_t * writeOffset,
-  int32_t bufferInc,
-  const int32_t * src,
-  int32_t srcInc,
-  uint32_t blockSize)
-  {
-    uint32_t i = 0u;
-    int32_t wOffset;
-
-    /* Copy the value of Index pointer that points
-     * to the current location where the input samples to be copied */
-    wOffset = *writeOffset;
+  void * riscv_dsp_scratch_push(
+  uint32_t size);
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  /**
+   * @brief  Current depth of the scratch pool.
+   * @return     mark that riscv_dsp_scratch_pop() returns the pool to.
+   */
 
-    while(i > 0u)
-    {
-      /* copy the input sample to the circular buffer */
-      circBuffer[wOffset] = *src;
+  uint32_t riscv_dsp_scratch_mark(
+  void);
 
-      /* Update the input pointer */
-      src += srcInc;
+  /**
+   * @brief  Pops the buffers pushed since a mark.
+   * @param[in]  mark  depth returned by riscv_dsp_scratch_mark() before the buffers were pushed.
+   * @return none.
+   */
 
-      /* Circularly update wOffset.  Watch out for positive and negative value */
-      wOffset += bufferInc;
-      if(wOffset >= L)
-        wOffset -= L;
+  void riscv_dsp_scratch_pop(
+  uint32_t mark);
 
-      /* Decrement the loop counter */
-      i--;
-    }
+  /**
+   * @brief  Largest depth the scratch pool reached since riscv_dsp_scratch_init().
+   * @return     bytes, the smallest region that serves the same calls.
+   */
 
-    /* Update the index pointer */
-    *writeOffset = wOffset;
-  }
+  uint32_t riscv_dsp_scratch_peak(
+  void);
 
+  /**
+   * @brief Largest number of input or of output edges of a node of a dataflow graph.
+   */
 
+#ifndef RISCV_SDF_MAX_PORTS
+#define RISCV_SDF_MAX_PORTS 4u
+#endif
 
   /**
-   * @brief floating-point Circular Read function.
+   * @brief Function of a node of a dataflow graph, one firing.
+   * @param[in]  *arg   argument of the node, for example the instance of the kernel.
+   * @param[in]  *pIn   pointers to the <code>consume</code> elements of each input edge, in the order of the edges.
+   * @param[in]  *pOut  pointers to the room for the <code>produce</code> elements of each output edge.
    */
-  inline void riscv_circularRead_f32(
-  int32_t * circBuffer,
-  int32_t L,
-  int32_t * readOffset,
-  int32_t bufferInc,
-  int32_t * dst,
-  int32_t * dst_base,
-  int32_t dst_length,
-  int32_t dstInc,
-  uint32_t blockSize)
-  {
-    uint32_t i = 0u;
-    int32_t rOffset, dst_end;
 
-    /* Copy the value of Index pointer that points
-     * to the current location from where the input samples to be read */
-    rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+  typedef void (*riscv_sdf_func)(
+  void * arg,
+  const void * const * pIn,
+  void * const * pOut);
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  /**
+   * @brief Node of a dataflow graph.
+   */
 
-    while(i > 0u)
-    {
-      /* copy the sample from the circular buffer to the destination buffer */
-      *dst = circBuffer[rOffset];
+  typedef struct
+  {
+    riscv_sdf_func func;        /**< function called for each firing. */
+    void *arg;                  /**< argument of the function. */
+    uint32_t cost;              /**< estimated cycles of a firing, weighs the partition across cores, 0 counts as 1. */
+  } riscv_sdf_node;
+
+  /**
+   * @brief Edge of a dataflow graph, a FIFO from one node to a later one.
+   */
 
-      /* Update the input pointer */
-      dst += dstInc;
+  typedef struct
+  {
+    uint16_t src;               /**< index of the producing node. */
+    uint16_t dst;               /**< index of the consuming node, greater than <code>src</code>. */
+    uint16_t produce;           /**< elements written by a firing of the producer. */
+    uint16_t consume;           /**< elements read by a firing of the consumer. */
+    uint32_t elemSize;          /**< size of an element in bytes. */
+  } riscv_sdf_edge;
 
-      if(dst == (int32_t *) dst_end)
-      {
-        dst = dst_base;
-      }
+  /**
+   * @brief Buffer and positions of an edge of a dataflow graph.
+   */
 
-      /* Circularly update rOffset.  Watch out for positive and negative value  */
-      rOffset += bufferInc;
+  typedef struct
+  {
+    uint8_t *pBuffer;           /**< points to <code>copies*capacity</code> elements. */
+    uint32_t capacity;          /**< elements of a copy. */
+    uint32_t read;              /**< position of the next element to read. */
+    uint32_t write;             /**< position of the next element to write. */
+    uint32_t copies;            /**< 1, or the periods in flight on an edge between two stages. */
+  } riscv_sdf_fifo;
 
-      if(rOffset >= L)
-      {
-        rOffset -= L;
-      }
+  /**
+   * @brief Instance structure of a synchronous dataflow graph.
+   */
 
-      /* Decrement the loop counter */
-      i--;
-    }
+  typedef struct
+  {
+    const riscv_sdf_node *pNodes;   /**< points to the nodes. */
+    const riscv_sdf_edge *pEdges;   /**< points to the edges. */
+    uint16_t numNodes;              /**< number of nodes. */
+    uint16_t numEdges;              /**< number of edges. */
+    uint16_t numStages;             /**< number of pipeline stages the nodes are partitioned into. */
+    uint32_t *pRepeat;              /**< firings of each node in one period, the repetition vector. */
+    uint16_t *pStage;               /**< stage of each node. */
+    uint16_t *pPortIndex;           /**< inputs of node n at pPorts[pPortIndex[2n]], outputs at pPorts[pPortIndex[2n+1]], 2*numNodes+1 entries. */
+    uint16_t *pPorts;               /**< edges of the nodes. */
+    riscv_sdf_fifo *pFifo;          /**< buffer of each edge. */
+    uint16_t *pSchedule;            /**< nodes in the order they fire in one period, grouped by stage. */
+    uint32_t *pStageFirst;          /**< first firing of each stage in pSchedule, numStages+1 entries. */
+  } riscv_sdf_instance;
+
+  /**
+   * @brief  Initialization function of a synchronous dataflow graph.
+   * @param[out]    *G          points to an instance of the dataflow graph structure.
+   * @param[in]     *pNodes     points to the nodes, kept by the instance.
+   * @param[in]     numNodes    number of nodes.
+   * @param[in]     *pEdges     points to the edges, kept by the instance.
+   * @param[in]     numEdges    number of edges.
+   * @param[in]     numStages   number of pipeline stages for riscv_sdf_run_par(), 1 for riscv_sdf_run() only.
+   * @param[in,out] *pArena     points to the arena the schedule and the buffers are taken from.
+   * @return        RISCV_MATH_SUCCESS, RISCV_MATH_ARGUMENT_ERROR if the graph is not a connected chain of
+   * forward edges, RISCV_MATH_SIZE_MISMATCH if the rates have no periodic schedule, or
+   * RISCV_MATH_LENGTH_ERROR if the arena is too small.
+   */
+
+  riscv_status riscv_sdf_init(
+  riscv_sdf_instance * G,
+  const riscv_sdf_node * pNodes,
+  uint16_t numNodes,
+  const riscv_sdf_edge * pEdges,
+  uint16_t numEdges,
+  uint16_t numStages,
+  riscv_dsp_arena * pArena);
 
-    /* Update the index pointer */
-    *readOffset = rOffset;
-  }
+  /**
+   * @brief  Runs periods of a synchronous dataflow graph on the calling core.
+   * @param[in,out] *G          points to an instance of the dataflow graph structure.
+   * @param[in]     numPeriods  number of periods.
+   * @return none.
+   */
+
+  void riscv_sdf_run(
+  riscv_sdf_instance * G,
+  uint32_t numPeriods);
 
   /**
-   * @brief Q15 Circular write function.
+   * @brief  Runs periods of a synchronous dataflow graph as a pipeline, one stage per core.
+   * @param[in]     *P          points to the parallel execution context, at least <code>numStages</code> cores.
+   * @param[in,out] *G          points to an instance of the dataflow graph structure.
+   * @param[in]     numPeriods  number of periods.
+   * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the context has less cores than stages.
    */
 
-  inline void riscv_circularWrite_q15(
-  q15_t * circBuffer,
-  int32_t L,
-  uint16_t * writeOffset,
-  int32_t bufferInc,
-  const q15_t * src,
-  int32_t srcInc,
-  uint32_t blockSize)
-  {
-    uint32_t i = 0u;
-    int32_t wOffset;
+  riscv_status riscv_sdf_run_par(
+  const riscv_par_instance * P,
+  riscv_sdf_instance * G,
+  uint32_t numPeriods);
 
-    /* Copy the value of Index pointer that points
-     * to the current location where the input samples to be copied */
-    wOffset = *writeOffset;
+  /**
+   * @brief  Size of the state buffer of the floating-point FIR filter.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+   */
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  uint32_t riscv_fir_get_buffer_size_f32(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
-    while(i > 0u)
-    {
-      /* copy the input sample to the circular buffer */
-      circBuffer[wOffset] = *src;
+  /**
+   * @brief  Initialization function for the floating-point FIR filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the floating-point FIR filter structure.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in]     blockSize number of samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_get_buffer_size_f32() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
+   */
 
-      /* Update the input pointer */
-      src += srcInc;
+  riscv_status riscv_fir_init_arena_f32(
+  riscv_fir_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena);
 
-      /* Circularly update wOffset.  Watch out for positive and negative value */
-      wOffset += bufferInc;
-      if(wOffset >= L)
-        wOffset -= L;
+  /**
+   * @brief  Size of the state buffer of the Q31 FIR filter.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+   */
 
-      /* Decrement the loop counter */
-      i--;
-    }
+  uint32_t riscv_fir_get_buffer_size_q31(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
-    /* Update the index pointer */
-    *writeOffset = wOffset;
-  }
+  /**
+   * @brief  Initialization function for the Q31 FIR filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q31 FIR filter structure.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in]     blockSize number of samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_get_buffer_size_q31() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
+   */
 
+  riscv_status riscv_fir_init_arena_q31(
+  riscv_fir_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena);
 
+  /**
+   * @brief  Size of the state buffer of the Q15 FIR filter.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numTaps+blockSize</code> samples.
+   */
+
+  uint32_t riscv_fir_get_buffer_size_q15(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
   /**
-   * @brief Q15 Circular Read function.
+   * @brief  Initialization function for the Q15 FIR filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q15 FIR filter structure.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in]     blockSize number of samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_get_buffer_size_q15() bytes free,
+   * otherwise the status of riscv_fir_init_q15().
    */
-  inline void riscv_circularRead_q15(
-  q15_t * circBuffer,
-  int32_t L,
-  int32_t * readOffset,
-  int32_t bufferInc,
-  q15_t * dst,
-  q15_t * dst_base,
-  int32_t dst_length,
-  int32_t dstInc,
-  uint32_t blockSize)
-  {
-    uint32_t i = 0;
-    int32_t rOffset, dst_end;
 
-    /* Copy the value of Index pointer that points
-     * to the current location from where the input samples to be read */
-    rOffset = *readOffset;
+  riscv_status riscv_fir_init_arena_q15(
+  riscv_fir_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena);
 
-    dst_end = (int32_t) (dst_base + dst_length);
+  /**
+   * @brief  Size of the state buffer of the Q7 FIR filter.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+   */
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  uint32_t riscv_fir_get_buffer_size_q7(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
-    while(i > 0u)
-    {
-      /* copy the sample from the circular buffer to the destination buffer */
-      *dst = circBuffer[rOffset];
+  /**
+   * @brief  Initialization function for the Q7 FIR filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q7 FIR filter structure.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in]     blockSize number of samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_get_buffer_size_q7() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
+   */
 
-      /* Update the input pointer */
-      dst += dstInc;
+  riscv_status riscv_fir_init_arena_q7(
+  riscv_fir_instance_q7 * S,
+  uint16_t numTaps,
+  q7_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena);
 
-      if(dst == (q15_t *) dst_end)
-      {
-        dst = dst_base;
-      }
+  /**
+   * @brief  Size of the state buffer of the floating-point FIR decimator.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of input samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+   */
 
-      /* Circularly update wOffset.  Watch out for positive and negative value */
-      rOffset += bufferInc;
+  uint32_t riscv_fir_decimate_get_buffer_size_f32(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
-      if(rOffset >= L)
-      {
-        rOffset -= L;
-      }
+  /**
+   * @brief  Initialization function for the floating-point FIR decimator with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the floating-point FIR decimator structure.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     M         decimation factor.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in]     blockSize number of input samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_decimate_get_buffer_size_f32() bytes free,
+   * otherwise the status of riscv_fir_decimate_init_f32().
+   */
 
-      /* Decrement the loop counter */
-      i--;
-    }
+  riscv_status riscv_fir_decimate_init_arena_f32(
+  riscv_fir_decimate_instance_f32 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  float32_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena);
 
-    /* Update the index pointer */
-    *readOffset = rOffset;
-  }
+  /**
+   * @brief  Size of the state buffer of the Q31 FIR decimator.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of input samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+   */
 
+  uint32_t riscv_fir_decimate_get_buffer_size_q31(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
   /**
-   * @brief Q7 Circular write function.
+   * @brief  Initialization function for the Q31 FIR decimator with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q31 FIR decimator structure.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     M         decimation factor.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in]     blockSize number of input samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_decimate_get_buffer_size_q31() bytes free,
+   * otherwise the status of riscv_fir_decimate_init_q31().
    */
 
-  inline void riscv_circularWrite_q7(
-  q7_t * circBuffer,
-  int32_t L,
-  uint16_t * writeOffset,
-  int32_t bufferInc,
-  const q7_t * src,
-  int32_t srcInc,
-  uint32_t blockSize)
-  {
-    uint32_t i = 0u;
-    int32_t wOffset;
+  riscv_status riscv_fir_decimate_init_arena_q31(
+  riscv_fir_decimate_instance_q31 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  q31_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena);
 
-    /* Copy the value of Index pointer that points
-     * to the current location where the input samples to be copied */
-    wOffset = *writeOffset;
+  /**
+   * @brief  Size of the state buffer of the Q15 FIR decimator.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of input samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+   */
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  uint32_t riscv_fir_decimate_get_buffer_size_q15(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
-    while(i > 0u)
-    {
-      /* copy the input sample to the circular buffer */
-      circBuffer[wOffset] = *src;
+  /**
+   * @brief  Initialization function for the Q15 FIR decimator with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q15 FIR decimator structure.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     M         decimation factor.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in]     blockSize number of input samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_decimate_get_buffer_size_q15() bytes free,
+   * otherwise the status of riscv_fir_decimate_init_q15().
+   */
 
-      /* Update the input pointer */
-      src += srcInc;
+  riscv_status riscv_fir_decimate_init_arena_q15(
+  riscv_fir_decimate_instance_q15 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  q15_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena);
 
-      /* Circularly update wOffset.  Watch out for positive and negative value */
-      wOffset += bufferInc;
-      if(wOffset >= L)
-        wOffset -= L;
+  /**
+   * @brief  Size of the state buffer of the floating-point FIR interpolator.
+   * @param[in]  L          upsample factor.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of input samples processed per call.
+   * @return     bytes the state takes from the arena, <code>(numTaps/L)+blockSize-1</code> samples, 0 if L is 0.
+   */
 
-      /* Decrement the loop counter */
-      i--;
-    }
+  uint32_t riscv_fir_interpolate_get_buffer_size_f32(
+  uint8_t L,
+  uint16_t numTaps,
+  uint32_t blockSize);
 
-    /* Update the index pointer */
-    *writeOffset = wOffset;
-  }
+  /**
+   * @brief  Initialization function for the floating-point FIR interpolator with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the floating-point FIR interpolator structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in]     blockSize number of input samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_interpolate_get_buffer_size_f32() bytes free,
+   * otherwise the status of riscv_fir_interpolate_init_f32().
+   */
+
+  riscv_status riscv_fir_interpolate_init_arena_f32(
+  riscv_fir_interpolate_instance_f32 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena);
 
+  /**
+   * @brief  Size of the state buffer of the Q31 FIR interpolator.
+   * @param[in]  L          upsample factor.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of input samples processed per call.
+   * @return     bytes the state takes from the arena, <code>(numTaps/L)+blockSize-1</code> samples, 0 if L is 0.
+   */
 
+  uint32_t riscv_fir_interpolate_get_buffer_size_q31(
+  uint8_t L,
+  uint16_t numTaps,
+  uint32_t blockSize);
 
   /**
-   * @brief Q7 Circular Read function.
+   * @brief  Initialization function for the Q31 FIR interpolator with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q31 FIR interpolator structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in]     blockSize number of input samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_interpolate_get_buffer_size_q31() bytes free,
+   * otherwise the status of riscv_fir_interpolate_init_q31().
    */
-  inline void riscv_circularRead_q7(
-  q7_t * circBuffer,
-  int32_t L,
-  int32_t * readOffset,
-  int32_t bufferInc,
-  q7_t * dst,
-  q7_t * dst_base,
-  int32_t dst_length,
-  int32_t dstInc,
-  uint32_t blockSize)
-  {
-    uint32_t i = 0;
-    int32_t rOffset, dst_end;
 
-    /* Copy the value of Index pointer that points
-     * to the current location from where the input samples to be read */
-    rOffset = *readOffset;
+  riscv_status riscv_fir_interpolate_init_arena_q31(
+  riscv_fir_interpolate_instance_q31 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena);
 
-    dst_end = (int32_t) (dst_base + dst_length);
+  /**
+   * @brief  Size of the state buffer of the Q15 FIR interpolator.
+   * @param[in]  L          upsample factor.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of input samples processed per call.
+   * @return     bytes the state takes from the arena, <code>(numTaps/L)+blockSize-1</code> samples, 0 if L is 0.
+   */
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  uint32_t riscv_fir_interpolate_get_buffer_size_q15(
+  uint8_t L,
+  uint16_t numTaps,
+  uint32_t blockSize);
 
-    while(i > 0u)
-    {
-      /* copy the sample from the circular buffer to the destination buffer */
-      *dst = circBuffer[rOffset];
+  /**
+   * @brief  Initialization function for the Q15 FIR interpolator with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q15 FIR interpolator structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in]     blockSize number of input samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_interpolate_get_buffer_size_q15() bytes free,
+   * otherwise the status of riscv_fir_interpolate_init_q15().
+   */
 
-      /* Update the input pointer */
-      dst += dstInc;
+  riscv_status riscv_fir_interpolate_init_arena_q15(
+  riscv_fir_interpolate_instance_q15 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena);
 
-      if(dst == (q7_t *) dst_end)
-      {
-        dst = dst_base;
-      }
+  /**
+   * @brief  Size of the state buffer of the floating-point LMS filter.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+   */
 
-      /* Circularly update rOffset.  Watch out for positive and negative value */
-      rOffset += bufferInc;
+  uint32_t riscv_lms_get_buffer_size_f32(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
-      if(rOffset >= L)
-      {
-        rOffset -= L;
-      }
+  /**
+   * @brief  Initialization function for the floating-point LMS filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the floating-point LMS filter structure.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     *pCoeffs  points to the coefficient buffer.
+   * @param[in]     mu        step size that controls filter coefficient updates.
+   * @param[in]     blockSize number of samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_lms_get_buffer_size_f32() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
+   */
 
-      /* Decrement the loop counter */
-      i--;
-    }
+  riscv_status riscv_lms_init_arena_f32(
+  riscv_lms_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t mu,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena);
 
-    /* Update the index pointer */
-    *readOffset = rOffset;
-  }
+  /**
+   * @brief  Size of the state buffer of the Q31 LMS filter.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+   */
 
+  uint32_t riscv_lms_get_buffer_size_q31(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
   /**
-   * @brief  Sum of the squares of the elements of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Initialization function for the Q31 LMS filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q31 LMS filter structure.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     *pCoeffs  points to the coefficient buffer.
+   * @param[in]     mu        step size that controls filter coefficient updates.
+   * @param[in]     blockSize number of samples processed per call.
+   * @param[in]     postShift bit shift applied to coefficients.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_lms_get_buffer_size_q31() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_power_q31(
-  q31_t * pSrc,
+  riscv_status riscv_lms_init_arena_q31(
+  riscv_lms_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t mu,
   uint32_t blockSize,
-  q63_t * pResult);
+  uint32_t postShift,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Sum of the squares of the elements of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Size of the state buffer of the Q15 LMS filter.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
    */
 
-  void riscv_power_f32(
-  float32_t * pSrc,
-  uint32_t blockSize,
-  float32_t * pResult);
+  uint32_t riscv_lms_get_buffer_size_q15(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
   /**
-   * @brief  Sum of the squares of the elements of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Initialization function for the Q15 LMS filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q15 LMS filter structure.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     *pCoeffs  points to the coefficient buffer.
+   * @param[in]     mu        step size that controls filter coefficient updates.
+   * @param[in]     blockSize number of samples processed per call.
+   * @param[in]     postShift bit shift applied to coefficients.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_lms_get_buffer_size_q15() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_power_q15(
-  q15_t * pSrc,
+  riscv_status riscv_lms_init_arena_q15(
+  riscv_lms_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t mu,
   uint32_t blockSize,
-  q63_t * pResult);
+  uint32_t postShift,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Sum of the squares of the elements of a Q7 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Size of the state buffer of the floating-point normalized LMS filter.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
    */
 
-  void riscv_power_q7(
-  q7_t * pSrc,
-  uint32_t blockSize,
-  q31_t * pResult);
+  uint32_t riscv_lms_norm_get_buffer_size_f32(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
   /**
-   * @brief  Mean value of a Q7 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Initialization function for the floating-point normalized LMS filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the floating-point normalized LMS filter structure.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     *pCoeffs  points to the coefficient buffer.
+   * @param[in]     mu        step size that controls filter coefficient updates.
+   * @param[in]     blockSize number of samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_lms_norm_get_buffer_size_f32() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_mean_q7(
-  q7_t * pSrc,
+  riscv_status riscv_lms_norm_init_arena_f32(
+  riscv_lms_norm_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t mu,
   uint32_t blockSize,
-  q7_t * pResult);
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Mean value of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Size of the state buffer of the Q31 normalized LMS filter.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
    */
-  void riscv_mean_q15(
-  q15_t * pSrc,
-  uint32_t blockSize,
-  q15_t * pResult);
+
+  uint32_t riscv_lms_norm_get_buffer_size_q31(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
   /**
-   * @brief  Mean value of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Initialization function for the Q31 normalized LMS filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q31 normalized LMS filter structure.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     *pCoeffs  points to the coefficient buffer.
+   * @param[in]     mu        step size that controls filter coefficient updates.
+   * @param[in]     blockSize number of samples processed per call.
+   * @param[in]     postShift bit shift applied to coefficients.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_lms_norm_get_buffer_size_q31() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
-  void riscv_mean_q31(
-  q31_t * pSrc,
+
+  riscv_status riscv_lms_norm_init_arena_q31(
+  riscv_lms_norm_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t mu,
   uint32_t blockSize,
-  q31_t * pResult);
+  uint8_t postShift,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Mean value of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Size of the state buffer of the Q15 normalized LMS filter.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
    */
-  void riscv_mean_f32(
-  float32_t * pSrc,
-  uint32_t blockSize,
-  float32_t * pResult);
+
+  uint32_t riscv_lms_norm_get_buffer_size_q15(
+  uint16_t numTaps,
+  uint32_t blockSize);
 
   /**
-   * @brief  Variance of the elements of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Initialization function for the Q15 normalized LMS filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q15 normalized LMS filter structure.
+   * @param[in]     numTaps   number of filter coefficients.
+   * @param[in]     *pCoeffs  points to the coefficient buffer.
+   * @param[in]     mu        step size that controls filter coefficient updates.
+   * @param[in]     blockSize number of samples processed per call.
+   * @param[in]     postShift bit shift applied to coefficients.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_lms_norm_get_buffer_size_q15() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_var_f32(
-  float32_t * pSrc,
+  riscv_status riscv_lms_norm_init_arena_q15(
+  riscv_lms_norm_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t mu,
   uint32_t blockSize,
-  float32_t * pResult);
+  uint8_t postShift,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Variance of the elements of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Size of the state buffer of the floating-point Biquad cascade filter.
+   * @param[in]  numStages  number of 2nd order stages in the filter.
+   * @return     bytes the state takes from the arena, <code>4*numStages</code> values.
    */
 
-  void riscv_var_q31(
-  q31_t * pSrc,
-  uint32_t blockSize,
-  q31_t * pResult);
+  uint32_t riscv_biquad_cascade_df1_get_buffer_size_f32(
+  uint8_t numStages);
 
   /**
-   * @brief  Variance of the elements of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Initialization function for the floating-point Biquad cascade filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the floating-point Biquad cascade filter structure.
+   * @param[in]     numStages number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_biquad_cascade_df1_get_buffer_size_f32() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_var_q15(
-  q15_t * pSrc,
-  uint32_t blockSize,
-  q15_t * pResult);
+  riscv_status riscv_biquad_cascade_df1_init_arena_f32(
+  riscv_biquad_casd_df1_inst_f32 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Root Mean Square of the elements of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Size of the state buffer of the Q31 Biquad cascade filter.
+   * @param[in]  numStages  number of 2nd order stages in the filter.
+   * @return     bytes the state takes from the arena, <code>4*numStages</code> values.
    */
 
-  void riscv_rms_f32(
-  float32_t * pSrc,
-  uint32_t blockSize,
-  float32_t * pResult);
+  uint32_t riscv_biquad_cascade_df1_get_buffer_size_q31(
+  uint8_t numStages);
 
   /**
-   * @brief  Root Mean Square of the elements of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Initialization function for the Q31 Biquad cascade filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q31 Biquad cascade filter structure.
+   * @param[in]     numStages number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in]     postShift shift to be applied to the output.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_biquad_cascade_df1_get_buffer_size_q31() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_rms_q31(
-  q31_t * pSrc,
-  uint32_t blockSize,
-  q31_t * pResult);
+  riscv_status riscv_biquad_cascade_df1_init_arena_q31(
+  riscv_biquad_casd_df1_inst_q31 * S,
+  uint8_t numStages,
+  q31_t * pCoeffs,
+  int8_t postShift,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Root Mean Square of the elements of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Size of the state buffer of the Q15 Biquad cascade filter.
+   * @param[in]  numStages  number of 2nd order stages in the filter.
+   * @return     bytes the state takes from the arena, <code>4*numStages</code> values.
    */
 
-  void riscv_rms_q15(
-  q15_t * pSrc,
-  uint32_t blockSize,
-  q15_t * pResult);
+  uint32_t riscv_biquad_cascade_df1_get_buffer_size_q15(
+  uint8_t numStages);
 
   /**
-   * @brief  Standard deviation of the elements of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Initialization function for the Q15 Biquad cascade filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q15 Biquad cascade filter structure.
+   * @param[in]     numStages number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in]     postShift shift to be applied to the output.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_biquad_cascade_df1_get_buffer_size_q15() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_std_f32(
-  float32_t * pSrc,
-  uint32_t blockSize,
-  float32_t * pResult);
+  riscv_status riscv_biquad_cascade_df1_init_arena_q15(
+  riscv_biquad_casd_df1_inst_q15 * S,
+  uint8_t numStages,
+  q15_t * pCoeffs,
+  int8_t postShift,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Standard deviation of the elements of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Size of the state buffer of the floating-point Biquad cascade filter.
+   * @param[in]  numStages  number of 2nd order stages in the filter.
+   * @return     bytes the state takes from the arena, <code>2*numStages</code> values.
    */
 
-  void riscv_std_q31(
-  q31_t * pSrc,
-  uint32_t blockSize,
-  q31_t * pResult);
+  uint32_t riscv_biquad_cascade_df2T_get_buffer_size_f32(
+  uint8_t numStages);
 
   /**
-   * @brief  Standard deviation of the elements of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Initialization function for the floating-point Biquad cascade filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the floating-point Biquad cascade filter structure.
+   * @param[in]     numStages number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficients.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_biquad_cascade_df2T_get_buffer_size_f32() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_std_q15(
-  q15_t * pSrc,
-  uint32_t blockSize,
-  q15_t * pResult);
+  riscv_status riscv_biquad_cascade_df2T_init_arena_f32(
+  riscv_biquad_cascade_df2T_instance_f32 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Floating-point complex magnitude
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
-   * @return none.
+   * @brief  Size of the state buffer of the floating-point FIR lattice filter.
+   * @param[in]  numStages  number of filter stages.
+   * @return     bytes the state takes from the arena, <code>numStages</code> samples.
    */
 
-  void riscv_cmplx_mag_f32(
-  float32_t * pSrc,
-  float32_t * pDst,
-  uint32_t numSamples);
+  uint32_t riscv_fir_lattice_get_buffer_size_f32(
+  uint16_t numStages);
 
   /**
-   * @brief  Q31 complex magnitude
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
-   * @return none.
+   * @brief  Initialization function for the floating-point FIR lattice filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the floating-point FIR lattice filter structure.
+   * @param[in]     numStages number of filter stages.
+   * @param[in]     *pCoeffs  points to the coefficient buffer.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_lattice_get_buffer_size_f32() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_cmplx_mag_q31(
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t numSamples);
+  riscv_status riscv_fir_lattice_init_arena_f32(
+  riscv_fir_lattice_instance_f32 * S,
+  uint16_t numStages,
+  float32_t * pCoeffs,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Q15 complex magnitude
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
-   * @return none.
+   * @brief  Size of the state buffer of the Q31 FIR lattice filter.
+   * @param[in]  numStages  number of filter stages.
+   * @return     bytes the state takes from the arena, <code>numStages</code> samples.
    */
 
-  void riscv_cmplx_mag_q15(
-  q15_t * pSrc,
-  q15_t * pDst,
-  uint32_t numSamples);
+  uint32_t riscv_fir_lattice_get_buffer_size_q31(
+  uint16_t numStages);
 
   /**
-   * @brief  Q15 complex dot product
-   * @param[in]  *pSrcA points to the first input vector
-   * @param[in]  *pSrcB points to the second input vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @param[out]  *realResult real part of the result returned here
-   * @param[out]  *imagResult imaginary part of the result returned here
-   * @return none.
+   * @brief  Initialization function for the Q31 FIR lattice filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q31 FIR lattice filter structure.
+   * @param[in]     numStages number of filter stages.
+   * @param[in]     *pCoeffs  points to the coefficient buffer.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_lattice_get_buffer_size_q31() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_cmplx_dot_prod_q15(
-  q15_t * pSrcA,
-  q15_t * pSrcB,
-  uint32_t numSamples,
-  q31_t * realResult,
-  q31_t * imagResult);
+  riscv_status riscv_fir_lattice_init_arena_q31(
+  riscv_fir_lattice_instance_q31 * S,
+  uint16_t numStages,
+  q31_t * pCoeffs,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Q31 complex dot product
-   * @param[in]  *pSrcA points to the first input vector
-   * @param[in]  *pSrcB points to the second input vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @param[out]  *realResult real part of the result returned here
-   * @param[out]  *imagResult imaginary part of the result returned here
-   * @return none.
+   * @brief  Size of the state buffer of the Q15 FIR lattice filter.
+   * @param[in]  numStages  number of filter stages.
+   * @return     bytes the state takes from the arena, <code>numStages</code> samples.
    */
 
-  void riscv_cmplx_dot_prod_q31(
-  q31_t * pSrcA,
-  q31_t * pSrcB,
-  uint32_t numSamples,
-  q63_t * realResult,
-  q63_t * imagResult);
+  uint32_t riscv_fir_lattice_get_buffer_size_q15(
+  uint16_t numStages);
 
   /**
-   * @brief  Floating-point complex dot product
-   * @param[in]  *pSrcA points to the first input vector
-   * @param[in]  *pSrcB points to the second input vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @param[out]  *realResult real part of the result returned here
-   * @param[out]  *imagResult imaginary part of the result returned here
-   * @return none.
+   * @brief  Initialization function for the Q15 FIR lattice filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q15 FIR lattice filter structure.
+   * @param[in]     numStages number of filter stages.
+   * @param[in]     *pCoeffs  points to the coefficient buffer.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_lattice_get_buffer_size_q15() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_cmplx_dot_prod_f32(
-  float32_t * pSrcA,
-  float32_t * pSrcB,
-  uint32_t numSamples,
-  float32_t * realResult,
-  float32_t * imagResult);
+  riscv_status riscv_fir_lattice_init_arena_q15(
+  riscv_fir_lattice_instance_q15 * S,
+  uint16_t numStages,
+  q15_t * pCoeffs,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Q15 complex-by-real multiplication
-   * @param[in]  *pSrcCmplx points to the complex input vector
-   * @param[in]  *pSrcReal points to the real input vector
-   * @param[out]  *pCmplxDst points to the complex output vector
-   * @param[in]  numSamples number of samples in each vector
-   * @return none.
+   * @brief  Size of the state buffer of the floating-point IIR lattice filter.
+   * @param[in]  numStages  number of stages in the filter.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numStages+blockSize</code> samples.
    */
 
-  void riscv_cmplx_mult_real_q15(
-  q15_t * pSrcCmplx,
-  q15_t * pSrcReal,
-  q15_t * pCmplxDst,
-  uint32_t numSamples);
+  uint32_t riscv_iir_lattice_get_buffer_size_f32(
+  uint16_t numStages,
+  uint32_t blockSize);
 
   /**
-   * @brief  Q31 complex-by-real multiplication
-   * @param[in]  *pSrcCmplx points to the complex input vector
-   * @param[in]  *pSrcReal points to the real input vector
-   * @param[out]  *pCmplxDst points to the complex output vector
-   * @param[in]  numSamples number of samples in each vector
-   * @return none.
+   * @brief  Initialization function for the floating-point IIR lattice filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the floating-point IIR lattice filter structure.
+   * @param[in]     numStages number of stages in the filter.
+   * @param[in]     *pkCoeffs points to the reflection coefficient buffer.
+   * @param[in]     *pvCoeffs points to the ladder coefficient buffer.
+   * @param[in]     blockSize number of samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_iir_lattice_get_buffer_size_f32() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_cmplx_mult_real_q31(
-  q31_t * pSrcCmplx,
-  q31_t * pSrcReal,
-  q31_t * pCmplxDst,
-  uint32_t numSamples);
+  riscv_status riscv_iir_lattice_init_arena_f32(
+  riscv_iir_lattice_instance_f32 * S,
+  uint16_t numStages,
+  float32_t * pkCoeffs,
+  float32_t * pvCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Floating-point complex-by-real multiplication
-   * @param[in]  *pSrcCmplx points to the complex input vector
-   * @param[in]  *pSrcReal points to the real input vector
-   * @param[out]  *pCmplxDst points to the complex output vector
-   * @param[in]  numSamples number of samples in each vector
-   * @return none.
+   * @brief  Size of the state buffer of the Q31 IIR lattice filter.
+   * @param[in]  numStages  number of stages in the filter.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numStages+blockSize</code> samples.
    */
 
-  void riscv_cmplx_mult_real_f32(
-  float32_t * pSrcCmplx,
-  float32_t * pSrcReal,
-  float32_t * pCmplxDst,
-  uint32_t numSamples);
+  uint32_t riscv_iir_lattice_get_buffer_size_q31(
+  uint16_t numStages,
+  uint32_t blockSize);
 
   /**
-   * @brief  Minimum value of a Q7 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *result is output pointer
-   * @param[in]  index is the array index of the minimum value in the input buffer.
-   * @return none.
+   * @brief  Initialization function for the Q31 IIR lattice filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q31 IIR lattice filter structure.
+   * @param[in]     numStages number of stages in the filter.
+   * @param[in]     *pkCoeffs points to the reflection coefficient buffer.
+   * @param[in]     *pvCoeffs points to the ladder coefficient buffer.
+   * @param[in]     blockSize number of samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_iir_lattice_get_buffer_size_q31() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
 
-  void riscv_min_q7(
-  q7_t * pSrc,
+  riscv_status riscv_iir_lattice_init_arena_q31(
+  riscv_iir_lattice_instance_q31 * S,
+  uint16_t numStages,
+  q31_t * pkCoeffs,
+  q31_t * pvCoeffs,
   uint32_t blockSize,
-  q7_t * result,
-  uint32_t * index);
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Minimum value of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output pointer
-   * @param[in]  *pIndex is the array index of the minimum value in the input buffer.
-   * @return none.
+   * @brief  Size of the state buffer of the Q15 IIR lattice filter.
+   * @param[in]  numStages  number of stages in the filter.
+   * @param[in]  blockSize  number of samples processed per call.
+   * @return     bytes the state takes from the arena, <code>numStages+blockSize</code> samples.
    */
 
-  void riscv_min_q15(
-  q15_t * pSrc,
-  uint32_t blockSize,
-  q15_t * pResult,
-  uint32_t * pIndex);
+  uint32_t riscv_iir_lattice_get_buffer_size_q15(
+  uint16_t numStages,
+  uint32_t blockSize);
 
   /**
-   * @brief  Minimum value of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output pointer
-   * @param[out]  *pIndex is the array index of the minimum value in the input buffer.
-   * @return none.
+   * @brief  Initialization function for the Q15 IIR lattice filter with the state taken from an arena.
+   * @param[out]    *S        points to an instance of the Q15 IIR lattice filter structure.
+   * @param[in]     numStages number of stages in the filter.
+   * @param[in]     *pkCoeffs points to the reflection coefficient buffer.
+   * @param[in]     *pvCoeffs points to the ladder coefficient buffer.
+   * @param[in]     blockSize number of samples processed per call.
+   * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_iir_lattice_get_buffer_size_q15() bytes free,
+   * otherwise RISCV_MATH_SUCCESS.
    */
-  void riscv_min_q31(
-  q31_t * pSrc,
+
+  riscv_status riscv_iir_lattice_init_arena_q15(
+  riscv_iir_lattice_instance_q15 * S,
+  uint16_t numStages,
+  q15_t * pkCoeffs,
+  q15_t * pvCoeffs,
   uint32_t blockSize,
-  q31_t * pResult,
-  uint32_t * pIndex);
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Minimum value of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output pointer
-   * @param[out]  *pIndex is the array index of the minimum value in the input buffer.
-   * @return none.
+   * @brief  Size of the ring buffer of the floating-point STFT.
+   * @param[in]  fftLen  length of a frame.
+   * @return     bytes the ring buffer takes from the arena, <code>fftLen</code> samples.
    */
 
-  void riscv_min_f32(
-  float32_t * pSrc,
-  uint32_t blockSize,
-  float32_t * pResult,
-  uint32_t * pIndex);
+  uint32_t riscv_stft_get_buffer_size_f32(
+  uint16_t fftLen);
 
-/**
- * @brief Maximum value of a Q7 vector.
- * @param[in]       *pSrc points to the input buffer
- * @param[in]       blockSize length of the input vector
- * @param[out]      *pResult maximum value returned here
- * @param[out]      *pIndex index of maximum value returned here
- * @return none.
- */
+  /**
+   * @brief  Size of the scratch buffer of the floating-point STFT.
+   * @param[in]  fftLen  length of a frame.
+   * @return     bytes of the shared scratch region the instance needs, <code>fftLen</code> samples.
+   */
 
-  void riscv_max_q7(
-  q7_t * pSrc,
-  uint32_t blockSize,
-  q7_t * pResult,
-  uint32_t * pIndex);
+  uint32_t riscv_stft_get_scratch_size_f32(
+  uint16_t fftLen);
 
-/**
- * @brief Maximum value of a Q15 vector.
- * @param[in]       *pSrc points to the input buffer
- * @param[in]       blockSize length of the input vector
- * @param[out]      *pResult maximum value returned here
- * @param[out]      *pIndex index of maximum value returned here
- * @return none.
- */
+  /**
+   * @brief  Initialization function for the floating-point STFT with the buffers taken from an arena.
+   * @param[out]    *S          points to an instance of the floating-point STFT structure.
+   * @param[in]     fftLen      length of a frame.
+   * @param[in]     hopSize     number of samples between the starts of two frames.
+   * @param[in]     powerFlag   magnitude spectra if flag is 0, power spectra if flag is 1.
+   * @param[in]     *pWindow    points to the window table of length fftLen.
+   * @param[in,out] *pArena     points to the arena the buffers are taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena is too small, otherwise the status of riscv_stft_init_f32().
+   */
 
-  void riscv_max_q15(
-  q15_t * pSrc,
-  uint32_t blockSize,
-  q15_t * pResult,
-  uint32_t * pIndex);
+  riscv_status riscv_stft_init_arena_f32(
+  riscv_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  uint8_t powerFlag,
+  const float32_t * pWindow,
+  riscv_dsp_arena * pArena);
 
-/**
- * @brief Maximum value of a Q31 vector.
- * @param[in]       *pSrc points to the input buffer
- * @param[in]       blockSize length of the input vector
- * @param[out]      *pResult maximum value returned here
- * @param[out]      *pIndex index of maximum value returned here
- * @return none.
- */
+  /**
+   * @brief  Size of the ring buffer of the Q15 STFT.
+   * @param[in]  fftLen  length of a frame.
+   * @return     bytes the ring buffer takes from the arena, <code>fftLen</code> samples.
+   */
 
-  void riscv_max_q31(
-  q31_t * pSrc,
-  uint32_t blockSize,
-  q31_t * pResult,
-  uint32_t * pIndex);
+  uint32_t riscv_stft_get_buffer_size_q15(
+  uint16_t fftLen);
 
-/**
- * @brief Maximum value of a floating-point vector.
- * @param[in]       *pSrc points to the input buffer
- * @param[in]       blockSize length of the input vector
- * @param[out]      *pResult maximum value returned here
- * @param[out]      *pIndex index of maximum value returned here
- * @return none.
- */
+  /**
+   * @brief  Size of the scratch buffer of the Q15 STFT.
+   * @param[in]  fftLen  length of a frame.
+   * @return     bytes of the shared scratch region the instance needs, <code>fftLen</code> samples.
+   */
 
-  void riscv_max_f32(
-  float32_t * pSrc,
-  uint32_t blockSize,
-  float32_t * pResult,
-  uint32_t * pIndex);
+  uint32_t riscv_stft_get_scratch_size_q15(
+  uint16_t fftLen);
 
   /**
-   * @brief  Q15 complex-by-complex multiplication
-   * @param[in]  *pSrcA points to the first input vector
-   * @param[in]  *pSrcB points to the second input vector
-   * @param[out]  *pDst  points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @return none.
+   * @brief  Initialization function for the Q15 STFT with the buffers taken from an arena.
+   * @param[out]    *S          points to an instance of the Q15 STFT structure.
+   * @param[in]     fftLen      length of a frame.
+   * @param[in]     hopSize     number of samples between the starts of two frames.
+   * @param[in]     powerFlag   magnitude spectra if flag is 0, power spectra if flag is 1.
+   * @param[in]     *pWindow    points to the window table of length fftLen.
+   * @param[in,out] *pArena     points to the arena the buffers are taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena is too small, otherwise the status of riscv_stft_init_q15().
    */
 
-  void riscv_cmplx_mult_cmplx_q15(
-  q15_t * pSrcA,
-  q15_t * pSrcB,
-  q15_t * pDst,
-  uint32_t numSamples);
+  riscv_status riscv_stft_init_arena_q15(
+  riscv_stft_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  uint8_t powerFlag,
+  const q15_t * pWindow,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief  Q31 complex-by-complex multiplication
-   * @param[in]  *pSrcA points to the first input vector
-   * @param[in]  *pSrcB points to the second input vector
-   * @param[out]  *pDst  points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @return none.
+   * @brief  Size of the twiddle and overlap buffers of the floating-point MDCT/IMDCT.
+   * @param[in]  N          number of MDCT coefficients.
+   * @param[in]  imdctFlag  0 for an instance that only runs the MDCT, 1 if it also runs the IMDCT.
+   * @return     bytes the buffers take from the arena, <code>2*N+2</code> twiddle words and N overlap samples for the IMDCT.
    */
 
-  void riscv_cmplx_mult_cmplx_q31(
-  q31_t * pSrcA,
-  q31_t * pSrcB,
-  q31_t * pDst,
-  uint32_t numSamples);
+  uint32_t riscv_mdct_get_buffer_size_f32(
+  uint16_t N,
+  uint8_t imdctFlag);
 
   /**
-   * @brief  Floating-point complex-by-complex multiplication
-   * @param[in]  *pSrcA points to the first input vector
-   * @param[in]  *pSrcB points to the second input vector
-   * @param[out]  *pDst  points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @return none.
+   * @brief  Size of the scratch buffer of the floating-point MDCT/IMDCT.
+   * @param[in]  N  number of MDCT coefficients.
+   * @return     bytes of the shared scratch region the instance needs, N samples.
    */
 
-  void riscv_cmplx_mult_cmplx_f32(
-  float32_t * pSrcA,
-  float32_t * pSrcB,
-  float32_t * pDst,
-  uint32_t numSamples);
+  uint32_t riscv_mdct_get_scratch_size_f32(
+  uint16_t N);
 
   /**
-   * @brief Converts the elements of the floating-point vector to Q31 vector.
-   * @param[in]       *pSrc points to the floating-point input vector
-   * @param[out]      *pDst points to the Q31 output vector
-   * @param[in]       blockSize length of the input vector
-   * @return none.
+   * @brief  Initialization function for the floating-point MDCT/IMDCT with the buffers taken from an arena.
+   * @param[out]    *S          points to an instance of the floating-point MDCT structure.
+   * @param[in]     N           number of MDCT coefficients, N/2 a product of the factors 2, 3 and 5.
+   * @param[in]     *pWindow    points to the first half of the window of length 2*N.
+   * @param[in]     imdctFlag   0 for an instance that only runs the MDCT, 1 if it also runs the IMDCT.
+   * @param[in,out] *pArena     points to the arena the buffers are taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena is too small, otherwise the status of riscv_mdct_init_f32().
    */
-  void riscv_float_to_q31(
-  float32_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
+
+  riscv_status riscv_mdct_init_arena_f32(
+  riscv_mdct_instance_f32 * S,
+  uint16_t N,
+  const float32_t * pWindow,
+  uint8_t imdctFlag,
+  riscv_dsp_arena * pArena);
 
   /**
-   * @brief Converts the elements of the floating-point vector to Q15 vector.
-   * @param[in]       *pSrc points to the floating-point input vector
-   * @param[out]      *pDst points to the Q15 output vector
-   * @param[in]       blockSize length of the input vector
-   * @return          none
+   * @brief  Size of the table and overlap buffers of the Q31 MDCT/IMDCT.
+   * @param[in]  N          number of MDCT coefficients.
+   * @param[in]  imdctFlag  0 for an instance that only runs the MDCT, 1 if it also runs the IMDCT.
+   * @return     bytes the buffers take from the arena, <code>7*N/4</code> twiddle words, the bit reversal table of the
+   * N/2-point CFFT and N overlap samples for the IMDCT.
    */
-  void riscv_float_to_q15(
-  float32_t * pSrc,
-  q15_t * pDst,
-  uint32_t blockSize);
+
+  uint32_t riscv_mdct_get_buffer_size_q31(
+  uint16_t N,
+  uint8_t imdctFlag);
 
   /**
-   * @brief Converts the elements of the floating-point vector to Q7 vector.
-   * @param[in]       *pSrc points to the floating-point input vector
-   * @param[out]      *pDst points to the Q7 output vector
-   * @param[in]       blockSize length of the input vector
-   * @return          none
+   * @brief  Size of the scratch buffer of the Q31 MDCT/IMDCT.
+   * @param[in]  N  number of MDCT coefficients.
+   * @return     bytes of the shared scratch region the instance needs, N samples.
    */
-  void riscv_float_to_q7(
-  float32_t * pSrc,
-  q7_t * pDst,
-  uint32_t blockSize);
 
+  uint32_t riscv_mdct_get_scratch_size_q31(
+  uint16_t N);
 
   /**
-   * @brief  Converts the elements of the Q31 vector to Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[out]  *pDst is output pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @return none.
+   * @brief  Initialization function for the Q31 MDCT/IMDCT with the buffers taken from an arena.
+   * @param[out]    *S          points to an instance of the Q31 MDCT structure.
+   * @param[in]     N           number of MDCT coefficients, a power of two from 32 to 8192.
+   * @param[in]     *pWindow    points to the first half of the window of length 2*N.
+   * @param[in]     imdctFlag   0 for an instance that only runs the MDCT, 1 if it also runs the IMDCT.
+   * @param[in,out] *pArena     points to the arena the buffers are taken from.
+   * @return        RISCV_MATH_LENGTH_ERROR if the arena is too small, RISCV_MATH_ARGUMENT_ERROR if <code>N</code> is
+   * not a supported value, otherwise the status of riscv_mdct_init_q31().
    */
-  void riscv_q31_to_q15(
-  q31_t * pSrc,
-  q15_t * pDst,
-  uint32_t blockSize);
+
+  riscv_status riscv_mdct_init_arena_q31(
+  riscv_mdct_instance_q31 * S,
+  uint16_t N,
+  const q31_t * pWindow,
+  uint8_t imdctFlag,
+  riscv_dsp_arena * pArena);
+   
 
   /**
-   * @brief  Converts the elements of the Q31 vector to Q7 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[out]  *pDst is output pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @return none.
+   * @brief Planner flag: times the candidate kernels instead of taking the direct one.
    */
-  void riscv_q31_to_q7(
-  q31_t * pSrc,
-  q7_t * pDst,
-  uint32_t blockSize);
+
+#define RISCV_DSP_PLAN_MEASURE 0x1u
 
   /**
-   * @brief  Converts the elements of the Q15 vector to floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[out]  *pDst is output pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @return none.
+   * @brief Planner flag: riscv_fir_fast_q15() and riscv_fir_fast_q31(), with less accumulator headroom, are candidates.
    */
-  void riscv_q15_to_float(
-  q15_t * pSrc,
-  float32_t * pDst,
-  uint32_t blockSize);
 
+#define RISCV_DSP_PLAN_ALLOW_FAST 0x2u
 
   /**
-   * @brief  Converts the elements of the Q15 vector to Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[out]  *pDst is output pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @return none.
+   * @brief Operations of the kernel planner.
    */
-  void riscv_q15_to_q31(
-  q15_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
 
+  typedef enum
+  {
+    RISCV_DSP_PLAN_FIR_F32 = 1,          /**< riscv_fir_plan_init_f32() */
+    RISCV_DSP_PLAN_FIR_Q31 = 2,          /**< riscv_fir_plan_init_q31() */
+    RISCV_DSP_PLAN_FIR_Q15 = 3           /**< riscv_fir_plan_init_q15() */
+  } riscv_dsp_plan_op;
 
   /**
-   * @brief  Converts the elements of the Q15 vector to Q7 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[out]  *pDst is output pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @return none.
+   * @brief Kernels of the FIR plans.
    */
-  void riscv_q15_to_q7(
-  q15_t * pSrc,
-  q7_t * pDst,
-  uint32_t blockSize);
 
+  typedef enum
+  {
+    RISCV_FIR_PLAN_DIRECT = 0,           /**< riscv_fir_f32(), riscv_fir_q31() or riscv_fir_q15() */
+    RISCV_FIR_PLAN_FAST = 1,             /**< riscv_fir_fast_q31() or riscv_fir_fast_q15() */
+    RISCV_FIR_PLAN_FFT = 2               /**< riscv_fir_fft_f32() */
+  } riscv_fir_plan_variant;
 
   /**
-   * @ingroup groupInterpolation
+   * @brief Entry of the wisdom table, the kernel chosen for one plan.
    */
 
+  typedef struct
+  {
+    uint8_t op;                 /**< riscv_dsp_plan_op of the plan. */
+    uint8_t flags;              /**< RISCV_DSP_PLAN_ALLOW_FAST if the fast kernels were candidates. */
+    uint8_t variant;            /**< chosen kernel, riscv_fir_plan_variant for the FIR plans. */
+    uint16_t size;              /**< first size of the plan, the number of taps of a filter. */
+    uint32_t blockSize;         /**< second size of the plan, the block size of a filter. */
+    uint32_t cycles;            /**< cycles of one call of the chosen kernel when it was measured. */
+  } riscv_dsp_wisdom_entry;
+
   /**
-   * @defgroup BilinearInterpolate Bilinear Interpolation
-   *
-   * Bilinear interpolation is an extension of linear interpolation applied to a two dimensional grid.
-   * The underlying function <code>f(x, y)</code> is sampled on a regular grid and the interpolation process
-   * determines values between the grid points.
-   * Bilinear interpolation is equivalent to two step linear interpolation, first in the x-dimension and then in the y-dimension.
-   * Bilinear interpolation is often used in image processing to rescale images.
-   * The CMSIS DSP library provides bilinear interpolation functions for Q7, Q15, Q31, and floating-point data types.
-   *
-   * <b>Algorithm</b>
-   * \par
-   * The instance structure used by the bilinear interpolation functions describes a two dimensional data table.
-   * For floating-point, the instance structure is defined as:
-   * <pre>
-   *   typedef struct
-   *   {
-   *     uint16_t numRows;
-   *     uint16_t numCols;
-   *     float32_t *pData;
-   * } riscv_bilinear_interp_instance_f32;
-   * </pre>
-   *
-   * \par
-   * where <code>numRows</code> specifies the number of rows in the table;
-   * <code>numCols</code> specifies the number of columns in the table;
-   * and <code>pData</code> points to an array of size <code>numRows*numCols</code> values.
-   * The data table <code>pTable</code> is organized in row order and the supplied data values fall on integer indexes.
-   * That is, table element (x,y) is located at <code>pTable[x + y*numCols]</code> where x and y are integers.
-   *
-   * \par
-   * Let <code>(x, y)</code> specify the desired interpolation point.  Then define:
-   * <pre>
-   *     XF = floor(x)
-   *     YF = floor(y)
-   * </pre>
-   * \par
-   * The interpolated output point is computed as:
-   * <pre>
-   *  f(x, y) = f(XF, YF) * (1-(x-XF)) * (1-(y-YF))
-   *           + f(XF+1, YF) * (x-XF)*(1-(y-YF))
-   *           + f(XF, YF+1) * (1-(x-XF))*(y-YF)
-   *           + f(XF+1, YF+1) * (x-XF)*(y-YF)
-   * </pre>
-   * Note that the coordinates (x, y) contain integer and fractional components.
-   * The integer components specify which portion of the table to use while the
-   * fractional components control the interpolation processor.
-   *
-   * \par
-   * if (x,y) are outside of the table boundary, Bilinear interpolation returns zero output.
+   * @brief Wisdom table of the kernel planner.
    */
 
+  typedef struct
+  {
+    riscv_dsp_wisdom_entry *pEntries;   /**< points to the entries. */
+    uint16_t numEntries;                /**< number of valid entries. */
+    uint16_t maxEntries;                /**< number of entries pEntries holds. */
+  } riscv_dsp_wisdom;
+
   /**
-   * @addtogroup BilinearInterpolate
-   * @{
+   * @brief Kernel of a Q15 FIR plan.
    */
 
+  typedef void (*riscv_fir_plan_func_q15)(
+  const riscv_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
   /**
-  *
-  * @brief  Floating-point bilinear interpolation.
-  * @param[in,out] *S points to an instance of the interpolation structure.
-  * @param[in] X interpolation coordinate.
-  * @param[in] Y interpolation coordinate.
-  * @return out interpolated value.
-  */
+   * @brief Kernel of a Q31 FIR plan.
+   */
 
+  typedef void (*riscv_fir_plan_func_q31)(
+  const riscv_fir_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
 
-  static inline float32_t riscv_bilinear_interp_f32(
-  const riscv_bilinear_interp_instance_f32 * S,
-  float32_t X,
-  float32_t Y)
+  /**
+   * @brief Instance structure of the Q15 FIR plan.
+   */
+
+  typedef struct
   {
-    float32_t out;
-    float32_t f00, f01, f10, f11;
-    float32_t *pData = S->pData;
-    int32_t xIndex, yIndex, index;
-    float32_t xdiff, ydiff;
-    float32_t b1, b2, b3, b4;
+    riscv_fir_plan_func_q15 pFunc;              /**< chosen kernel. */
+    const riscv_fir_instance_q15 *pFilter;      /**< points to the filter. */
+    uint8_t variant;                            /**< riscv_fir_plan_variant of pFunc. */
+  } riscv_fir_plan_instance_q15;
 
-    xIndex = (int32_t) X;
-    yIndex = (int32_t) Y;
+  /**
+   * @brief Instance structure of the Q31 FIR plan.
+   */
 
-    /* Care taken for table outside boundary */
-    /* Returns zero output when values are outside table boundary */
-    if(xIndex < 0 || xIndex > (S->numRows - 1) || yIndex < 0
-       || yIndex > (S->numCols - 1))
-    {
-      return (0);
-    }
+  typedef struct
+  {
+    riscv_fir_plan_func_q31 pFunc;              /**< chosen kernel. */
+    const riscv_fir_instance_q31 *pFilter;      /**< points to the filter. */
+    uint8_t variant;                            /**< riscv_fir_plan_variant of pFunc. */
+  } riscv_fir_plan_instance_q31;
 
-    /* Calculation of index for two nearest points in X-direction */
-    index = (xIndex - 1) + (yIndex - 1) * S->numCols;
+  /**
+   * @brief Instance structure of the floating-point FIR plan.
+   */
 
+  typedef struct
+  {
+    const riscv_fir_instance_f32 *pDirect;      /**< points to the direct filter. */
+    riscv_fir_fft_instance_f32 *pFft;           /**< points to the FFT convolution filter if it was chosen, otherwise NULL. */
+    uint8_t variant;                            /**< riscv_fir_plan_variant of the chosen filter. */
+  } riscv_fir_plan_instance_f32;
 
-    /* Read two nearest points in X-direction */
-    f00 = pData[index];
-    f01 = pData[index + 1];
+  /**
+   * @brief  Initialization function for the wisdom table.
+   * @param[out] *W           points to an instance of the wisdom table.
+   * @param[in]  *pEntries    points to the entries, the first <code>numEntries</code> saved by an earlier run.
+   * @param[in]  numEntries   number of valid entries, 0 for an empty table.
+   * @param[in]  maxEntries   number of entries <code>pEntries</code> holds.
+   * @return none.
+   */
 
-    /* Calculation of index for two nearest points in Y-direction */
-    index = (xIndex - 1) + (yIndex) * S->numCols;
+  void riscv_dsp_wisdom_init(
+  riscv_dsp_wisdom * W,
+  riscv_dsp_wisdom_entry * pEntries,
+  uint16_t numEntries,
+  uint16_t maxEntries);
 
+  /**
+   * @brief  Entry of the wisdom table for a plan.
+   * @param[in]  *W         points to an instance of the wisdom table.
+   * @param[in]  op         operation of the plan.
+   * @param[in]  size       first size of the plan, the number of taps of a filter.
+   * @param[in]  blockSize  second size of the plan, the block size of a filter.
+   * @param[in]  flags      flags of the plan, only RISCV_DSP_PLAN_ALLOW_FAST is part of the key.
+   * @return     points to the entry, or NULL if the table has none for the plan.
+   */
 
-    /* Read two nearest points in Y-direction */
-    f10 = pData[index];
-    f11 = pData[index + 1];
+  const riscv_dsp_wisdom_entry * riscv_dsp_wisdom_find(
+  const riscv_dsp_wisdom * W,
+  riscv_dsp_plan_op op,
+  uint16_t size,
+  uint32_t blockSize,
+  uint32_t flags);
 
-    /* Calculation of intermediate values */
-    b1 = f00;
-    b2 = f01 - f00;
-    b3 = f10 - f00;
-    b4 = f00 - f01 - f10 + f11;
+  /**
+   * @brief  Records the choice of a plan in the wisdom table, over an entry with the same key.
+   * @param[in,out] *W         points to an instance of the wisdom table.
+   * @param[in]     op         operation of the plan.
+   * @param[in]     size       first size of the plan.
+   * @param[in]     blockSize  second size of the plan.
+   * @param[in]     flags      flags of the plan.
+   * @param[in]     variant    chosen kernel.
+   * @param[in]     cycles     cycles of one call of the chosen kernel.
+   * @return RISCV_MATH_LENGTH_ERROR if the table is full, otherwise RISCV_MATH_SUCCESS.
+   */
 
-    /* Calculation of fractional part in X */
-    xdiff = X - xIndex;
+  riscv_status riscv_dsp_wisdom_add(
+  riscv_dsp_wisdom * W,
+  riscv_dsp_plan_op op,
+  uint16_t size,
+  uint32_t blockSize,
+  uint32_t flags,
+  uint8_t variant,
+  uint32_t cycles);
 
-    /* Calculation of fractional part in Y */
-    ydiff = Y - yIndex;
+  /**
+   * @brief  Cycle counter the planner times the candidates with.
+   * @return cycles since the counter started, 0 on other targets than RISC-V.
+   */
 
-    /* Calculation of bi-linear interpolated output */
-    out = b1 + b2 * xdiff + b3 * ydiff + b4 * xdiff * ydiff;
+  uint32_t riscv_dsp_plan_cycles(
+  void);
 
-    /* return to application */
-    return (out);
+  /**
+   * @brief  Chooses between the direct and the FFT convolution of a floating-point FIR filter.
+   * @param[out]    *P          points to an instance of the floating-point FIR plan.
+   * @param[in,out] *S          points to the direct filter.
+   * @param[in,out] *Sfft       points to the FFT convolution filter of the same coefficients, or NULL.
+   * @param[in]     *pSrc       points to <code>blockSize</code> input samples to measure with.
+   * @param[out]    *pDst       points to <code>blockSize</code> output samples to measure with.
+   * @param[in]     blockSize   number of samples of a call.
+   * @param[in]     flags       RISCV_DSP_PLAN_MEASURE or 0.
+   * @param[in,out] *pWisdom    points to the wisdom table, or NULL.
+   * @return RISCV_MATH_ARGUMENT_ERROR if the wisdom table names a kernel that is not a candidate, otherwise
+   * RISCV_MATH_SUCCESS.
+   */
 
-  }
+  riscv_status riscv_fir_plan_init_f32(
+  riscv_fir_plan_instance_f32 * P,
+  const riscv_fir_instance_f32 * S,
+  riscv_fir_fft_instance_f32 * Sfft,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize,
+  uint32_t flags,
+  riscv_dsp_wisdom * pWisdom);
 
   /**
-  *
-  * @brief  Q31 bilinear interpolation.
-  * @param[in,out] *S points to an instance of the interpolation structure.
-  * @param[in] X interpolation coordinate in 12.20 format.
-  * @param[in] Y interpolation coordinate in 12.20 format.
-  * @return out interpolated value.
-  */
+   * @brief  Chooses the kernel of a Q31 FIR filter.
+   * @param[out]    *P          points to an instance of the Q31 FIR plan.
+   * @param[in,out] *S          points to the Q31 FIR filter.
+   * @param[in]     *pSrc       points to <code>blockSize</code> input samples to measure with.
+   * @param[out]    *pDst       points to <code>blockSize</code> output samples to measure with.
+   * @param[in]     blockSize   number of samples of a call.
+   * @param[in]     flags       RISCV_DSP_PLAN_MEASURE and RISCV_DSP_PLAN_ALLOW_FAST, or 0.
+   * @param[in,out] *pWisdom    points to the wisdom table, or NULL.
+   * @return RISCV_MATH_ARGUMENT_ERROR if the wisdom table names a kernel that is not a candidate, otherwise
+   * RISCV_MATH_SUCCESS.
+   */
 
-  static inline q31_t riscv_bilinear_interp_q31(
-  riscv_bilinear_interp_instance_q31 * S,
-  q31_t X,
-  q31_t Y)
-  {
-    q31_t out;                                   /* Temporary output */
-    q31_t acc = 0;                               /* output */
-    q31_t xfract, yfract;                        /* X, Y fractional parts */
-    q31_t x1, x2, y1, y2;                        /* Nearest output values */
-    int32_t rI, cI;                              /* Row and column indices */
-    q31_t *pYData = S->pData;                    /* pointer to output table values */
-    uint32_t nCols = S->numCols;                 /* num of rows */
+  riscv_status riscv_fir_plan_init_q31(
+  riscv_fir_plan_instance_q31 * P,
+  const riscv_fir_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize,
+  uint32_t flags,
+  riscv_dsp_wisdom * pWisdom);
 
+  /**
+   * @brief  Chooses the kernel of a Q15 FIR filter.
+   * @param[out]    *P          points to an instance of the Q15 FIR plan.
+   * @param[in,out] *S          points to the Q15 FIR filter.
+   * @param[in]     *pSrc       points to <code>blockSize</code> input samples to measure with.
+   * @param[out]    *pDst       points to <code>blockSize</code> output samples to measure with.
+   * @param[in]     blockSize   number of samples of a call.
+   * @param[in]     flags       RISCV_DSP_PLAN_MEASURE and RISCV_DSP_PLAN_ALLOW_FAST, or 0.
+   * @param[in,out] *pWisdom    points to the wisdom table, or NULL.
+   * @return RISCV_MATH_ARGUMENT_ERROR if the wisdom table names a kernel that is not a candidate, otherwise
+   * RISCV_MATH_SUCCESS.
+   */
 
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    rI = ((X & 0xFFF00000) >> 20u);
+  riscv_status riscv_fir_plan_init_q15(
+  riscv_fir_plan_instance_q15 * P,
+  const riscv_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize,
+  uint32_t flags,
+  riscv_dsp_wisdom * pWisdom);
 
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    cI = ((Y & 0xFFF00000) >> 20u);
+  /**
+   * @brief  Floating-point FIR filter through the kernel of its plan.
+   * @param[in]  *P          points to an instance of the floating-point FIR plan.
+   * @param[in]  *pSrc       points to the block of input data.
+   * @param[out] *pDst       points to the block of output data.
+   * @param[in]  blockSize   number of samples to process.
+   * @return none.
+   */
 
-    /* Care taken for table outside boundary */
-    /* Returns zero output when values are outside table boundary */
-    if(rI < 0 || rI > (S->numRows - 1) || cI < 0 || cI > (S->numCols - 1))
+  static inline void riscv_fir_plan_f32(
+  const riscv_fir_plan_instance_f32 * P,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+  {
+    if(P->pFft != NULL)
     {
-      return (0);
+      riscv_fir_fft_f32(P->pFft, pSrc, pDst, blockSize);
+    }
+    else
+    {
+      riscv_fir_f32(P->pDirect, pSrc, pDst, blockSize);
     }
+  }
 
-    /* 20 bits for the fractional part */
-    /* shift left xfract by 11 to keep 1.31 format */
-    xfract = (X & 0x000FFFFF) << 11u;
+  /**
+   * @brief  Q31 FIR filter through the kernel of its plan.
+   * @param[in]  *P          points to an instance of the Q31 FIR plan.
+   * @param[in]  *pSrc       points to the block of input data.
+   * @param[out] *pDst       points to the block of output data.
+   * @param[in]  blockSize   number of samples to process.
+   * @return none.
+   */
 
-    /* Read two nearest output values from the index */
-    x1 = pYData[(rI) + nCols * (cI)];
-    x2 = pYData[(rI) + nCols * (cI) + 1u];
+  static inline void riscv_fir_plan_q31(
+  const riscv_fir_plan_instance_q31 * P,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+  {
+    P->pFunc(P->pFilter, pSrc, pDst, blockSize);
+  }
 
-    /* 20 bits for the fractional part */
-    /* shift left yfract by 11 to keep 1.31 format */
-    yfract = (Y & 0x000FFFFF) << 11u;
+  /**
+   * @brief  Q15 FIR filter through the kernel of its plan.
+   * @param[in]  *P          points to an instance of the Q15 FIR plan.
+   * @param[in]  *pSrc       points to the block of input data.
+   * @param[out] *pDst       points to the block of output data.
+   * @param[in]  blockSize   number of samples to process.
+   * @return none.
+   */
 
-    /* Read two nearest output values from the index */
-    y1 = pYData[(rI) + nCols * (cI + 1)];
-    y2 = pYData[(rI) + nCols * (cI + 1) + 1u];
+  static inline void riscv_fir_plan_q15(
+  const riscv_fir_plan_instance_q15 * P,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+  {
+    P->pFunc(P->pFilter, pSrc, pDst, blockSize);
+  }
 
-    /* Calculation of x1 * (1-xfract ) * (1-yfract) and acc is in 3.29(q29) format */
-    out = ((q31_t) (((q63_t) x1 * (0x7FFFFFFF - xfract)) >> 32));
-    acc = ((q31_t) (((q63_t) out * (0x7FFFFFFF - yfract)) >> 32));
+  /**
+   * @brief Maximum number of kernels recorded by the RISCV_DSP_PROFILE instrumentation.
+   */
 
-    /* x2 * (xfract) * (1-yfract)  in 3.29(q29) and adding to acc */
-    out = ((q31_t) ((q63_t) x2 * (0x7FFFFFFF - yfract) >> 32));
-    acc += ((q31_t) ((q63_t) out * (xfract) >> 32));
+#ifndef RISCV_PROFILE_MAX_KERNELS
+#define RISCV_PROFILE_MAX_KERNELS 64u
+#endif
 
-    /* y1 * (1 - xfract) * (yfract)  in 3.29(q29) and adding to acc */
-    out = ((q31_t) ((q63_t) y1 * (0x7FFFFFFF - xfract) >> 32));
-    acc += ((q31_t) ((q63_t) out * (yfract) >> 32));
+  /**
+   * @brief Record of one kernel of the RISCV_DSP_PROFILE instrumentation.
+   */
 
-    /* y2 * (xfract) * (yfract)  in 3.29(q29) and adding to acc */
-    out = ((q31_t) ((q63_t) y2 * (xfract) >> 32));
-    acc += ((q31_t) ((q63_t) out * (yfract) >> 32));
+  typedef struct
+  {
+    const char *name;              /**< name of the kernel. */
+    uint32_t id;                   /**< kernel ID, index in the profile table from 1, 0 before the first call. */
+    uint32_t calls;                /**< number of calls. */
+    uint32_t cycles;               /**< total cycles. */
+    uint32_t instr;                /**< total instructions. */
+    uint32_t stalls;               /**< total load, jump and instruction fetch stalls. */
+  } riscv_profile_entry;
 
-    /* Convert acc to 1.31(q31) format */
-    return (acc << 2u);
+  /**
+   * @brief Counters at the start of a profiled kernel.
+   */
 
-  }
+  typedef struct
+  {
+    riscv_profile_entry *pEntry;   /**< points to the record of the kernel. */
+    uint32_t cycles;               /**< cycle counter. */
+    uint32_t instr;                /**< instruction counter. */
+    uint32_t stalls;               /**< sum of the stall counters. */
+  } riscv_profile_scope;
 
   /**
-  * @brief  Q15 bilinear interpolation.
-  * @param[in,out] *S points to an instance of the interpolation structure.
-  * @param[in] X interpolation coordinate in 12.20 format.
-  * @param[in] Y interpolation coordinate in 12.20 format.
-  * @return out interpolated value.
-  */
+   * @brief Print function of riscv_profile_dump(), called once per record.
+   */
 
-  static inline q15_t riscv_bilinear_interp_q15(
-  riscv_bilinear_interp_instance_q15 * S,
-  q31_t X,
-  q31_t Y)
-  {
-    q63_t acc = 0;                               /* output */
-    q31_t out;                                   /* Temporary output */
-    q15_t x1, x2, y1, y2;                        /* Nearest output values */
-    q31_t xfract, yfract;                        /* X, Y fractional parts */
-    int32_t rI, cI;                              /* Row and column indices */
-    q15_t *pYData = S->pData;                    /* pointer to output table values */
-    uint32_t nCols = S->numCols;                 /* num of rows */
+  typedef void (*riscv_profile_dump_func)(
+  void * ctx,
+  const riscv_profile_entry * pEntry);
 
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    rI = ((X & 0xFFF00000) >> 20);
+  /**
+   * @brief  Start of a profiled kernel, registers its record on the first call.
+   * @param[in, out] *pEntry  points to the record of the kernel.
+   * @return     counters at the start of the kernel.
+   */
 
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    cI = ((Y & 0xFFF00000) >> 20);
+  riscv_profile_scope riscv_profile_enter(
+  riscv_profile_entry * pEntry);
 
-    /* Care taken for table outside boundary */
-    /* Returns zero output when values are outside table boundary */
-    if(rI < 0 || rI > (S->numRows - 1) || cI < 0 || cI > (S->numCols - 1))
-    {
-      return (0);
-    }
+  /**
+   * @brief  End of a profiled kernel, adds the counters since riscv_profile_enter() to its record.
+   * @param[in]  *pScope  points to the counters at the start of the kernel.
+   * @return none.
+   */
 
-    /* 20 bits for the fractional part */
-    /* xfract should be in 12.20 format */
-    xfract = (X & 0x000FFFFF);
+  void riscv_profile_exit(
+  riscv_profile_scope * pScope);
 
-    /* Read two nearest output values from the index */
-    x1 = pYData[(rI) + nCols * (cI)];
-    x2 = pYData[(rI) + nCols * (cI) + 1u];
+  /**
+   * @brief  Clears the records of all kernels and starts the performance counters.
+   * @return none.
+   */
 
+  void riscv_profile_reset(
+  void);
 
-    /* 20 bits for the fractional part */
-    /* yfract should be in 12.20 format */
-    yfract = (Y & 0x000FFFFF);
+  /**
+   * @brief  Record of a kernel ID.
+   * @param[in]  id  kernel ID, 1 to the number of kernels called so far.
+   * @return     points to the record, or NULL if no kernel has this ID.
+   */
 
-    /* Read two nearest output values from the index */
-    y1 = pYData[(rI) + nCols * (cI + 1)];
-    y2 = pYData[(rI) + nCols * (cI + 1) + 1u];
+  const riscv_profile_entry * riscv_profile_get(
+  uint32_t id);
 
-    /* Calculation of x1 * (1-xfract ) * (1-yfract) and acc is in 13.51 format */
+  /**
+   * @brief  Hands the record of every kernel called so far to a print function, in kernel ID order.
+   * @param[in]  func  function called once per record.
+   * @param[in]  *ctx  context handed to <code>func</code>.
+   * @return     number of records.
+   */
 
-    /* x1 is in 1.15(q15), xfract in 12.20 format and out is in 13.35 format */
-    /* convert 13.35 to 13.31 by right shifting  and out is in 1.31 */
-    out = (q31_t) (((q63_t) x1 * (0xFFFFF - xfract)) >> 4u);
-    acc = ((q63_t) out * (0xFFFFF - yfract));
+  uint32_t riscv_profile_dump(
+  riscv_profile_dump_func func,
+  void * ctx);
 
-    /* x2 * (xfract) * (1-yfract)  in 1.51 and adding to acc */
-    out = (q31_t) (((q63_t) x2 * (0xFFFFF - yfract)) >> 4u);
-    acc += ((q63_t) out * (xfract));
+/*
+* First statement of every public kernel.  With RISCV_DSP_PROFILE the record of the kernel is a
+* static variable and riscv_profile_exit() runs on every return through the cleanup attribute,
+* without it the macro is empty.
+*/
+#if defined (RISCV_DSP_PROFILE)
+#define RISCV_PROFILE(name)                                                            \
+  static riscv_profile_entry riscv_profile_entry_ = { #name, 0u, 0u, 0u, 0u, 0u };     \
+  riscv_profile_scope riscv_profile_scope_ __attribute__((cleanup(riscv_profile_exit))) = \
+    riscv_profile_enter(&riscv_profile_entry_)
+#else
+#define RISCV_PROFILE(name)
+#endif
 
-    /* y1 * (1 - xfract) * (yfract)  in 1.51 and adding to acc */
-    out = (q31_t) (((q63_t) y1 * (0xFFFFF - xfract)) >> 4u);
-    acc += ((q63_t) out * (yfract));
+  /**
+   * @brief Maximum number of kernels recorded by the RISCV_DSP_SAT_STATS instrumentation.
+   */
 
-    /* y2 * (xfract) * (yfract)  in 1.51 and adding to acc */
-    out = (q31_t) (((q63_t) y2 * (xfract)) >> 4u);
-    acc += ((q63_t) out * (yfract));
+#ifndef RISCV_SAT_STATS_MAX_KERNELS
+#define RISCV_SAT_STATS_MAX_KERNELS 32u
+#endif
 
-    /* acc is in 13.51 format and down shift acc by 36 times */
-    /* Convert out to 1.15 format */
-    return (acc >> 36);
+  /**
+   * @brief Saturation record of one kernel of the RISCV_DSP_SAT_STATS instrumentation.
+   */
 
-  }
+  typedef struct
+  {
+    const char *name;              /**< name of the kernel. */
+    uint8_t bits;                  /**< width of the saturated values, 16 or 32. */
+    uint32_t id;                   /**< kernel ID, index in the saturation table from 1, 0 before the first call. */
+    uint32_t calls;                /**< number of calls. */
+    uint32_t values;               /**< number of values checked against the saturation limits. */
+    uint32_t saturations;          /**< number of values outside the limits, saturated by the kernel. */
+    q63_t peak;                    /**< largest magnitude of a value before saturation. */
+  } riscv_sat_stats_entry;
 
   /**
-  * @brief  Q7 bilinear interpolation.
-  * @param[in,out] *S points to an instance of the interpolation structure.
-  * @param[in] X interpolation coordinate in 12.20 format.
-  * @param[in] Y interpolation coordinate in 12.20 format.
-  * @return out interpolated value.
-  */
+   * @brief Counts of a call of a kernel of the RISCV_DSP_SAT_STATS instrumentation.
+   */
 
-  static inline q7_t riscv_bilinear_interp_q7(
-  riscv_bilinear_interp_instance_q7 * S,
-  q31_t X,
-  q31_t Y)
+  typedef struct riscv_sat_stats_scope
   {
-    q63_t acc = 0;                               /* output */
-    q31_t out;                                   /* Temporary output */
-    q31_t xfract, yfract;                        /* X, Y fractional parts */
-    q7_t x1, x2, y1, y2;                         /* Nearest output values */
-    int32_t rI, cI;                              /* Row and column indices */
-    q7_t *pYData = S->pData;                     /* pointer to output table values */
-    uint32_t nCols = S->numCols;                 /* num of rows */
+    riscv_sat_stats_entry *pEntry; /**< points to the record of the kernel. */
+    struct riscv_sat_stats_scope *pPrev;  /**< counts of the calling kernel, or NULL. */
+    q63_t max;                     /**< largest value that does not saturate. */
+    uint32_t values;               /**< number of values checked. */
+    uint32_t saturations;          /**< number of values outside the limits. */
+    q63_t peak;                    /**< largest magnitude before saturation. */
+  } riscv_sat_stats_scope;
 
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    rI = ((X & 0xFFF00000) >> 20);
+  /**
+   * @brief Counts of the innermost instrumented kernel running, NULL outside of them.
+   */
 
-    /* Input is in 12.20 format */
-    /* 12 bits for the table index */
-    /* Index value calculation */
-    cI = ((Y & 0xFFF00000) >> 20);
+  extern riscv_sat_stats_scope * riscv_sat_stats_current;
 
-    /* Care taken for table outside boundary */
-    /* Returns zero output when values are outside table boundary */
-    if(rI < 0 || rI > (S->numRows - 1) || cI < 0 || cI > (S->numCols - 1))
-    {
-      return (0);
-    }
+  /**
+   * @brief Print function of riscv_sat_stats_dump(), called once per record.
+   */
 
-    /* 20 bits for the fractional part */
-    /* xfract should be in 12.20 format */
-    xfract = (X & 0x000FFFFF);
+  typedef void (*riscv_sat_stats_dump_func)(
+  void * ctx,
+  const riscv_sat_stats_entry * pEntry);
 
-    /* Read two nearest output values from the index */
-    x1 = pYData[(rI) + nCols * (cI)];
-    x2 = pYData[(rI) + nCols * (cI) + 1u];
+  /**
+   * @brief  Start of an instrumented kernel, registers its record on the first call.
+   * @param[in, out] *pEntry  points to the record of the kernel.
+   * @param[out]     *pScope  points to the counts of the call, which become riscv_sat_stats_current.
+   * @return none.
+   */
 
+  void riscv_sat_stats_enter(
+  riscv_sat_stats_entry * pEntry,
+  riscv_sat_stats_scope * pScope);
 
-    /* 20 bits for the fractional part */
-    /* yfract should be in 12.20 format */
-    yfract = (Y & 0x000FFFFF);
+  /**
+   * @brief  End of an instrumented kernel, adds the counts of the call to its record and restores the counts of the caller.
+   * @param[in]  *pScope  points to the counts of the call.
+   * @return none.
+   */
 
-    /* Read two nearest output values from the index */
-    y1 = pYData[(rI) + nCols * (cI + 1)];
-    y2 = pYData[(rI) + nCols * (cI + 1) + 1u];
+  void riscv_sat_stats_exit(
+  riscv_sat_stats_scope * pScope);
 
-    /* Calculation of x1 * (1-xfract ) * (1-yfract) and acc is in 16.47 format */
-    out = ((x1 * (0xFFFFF - xfract)));
-    acc = (((q63_t) out * (0xFFFFF - yfract)));
+  /**
+   * @brief  Clears the records of all kernels.
+   * @return none.
+   */
 
-    /* x2 * (xfract) * (1-yfract)  in 2.22 and adding to acc */
-    out = ((x2 * (0xFFFFF - yfract)));
-    acc += (((q63_t) out * (xfract)));
+  void riscv_sat_stats_reset(
+  void);
 
-    /* y1 * (1 - xfract) * (yfract)  in 2.22 and adding to acc */
-    out = ((y1 * (0xFFFFF - xfract)));
-    acc += (((q63_t) out * (yfract)));
+  /**
+   * @brief  Record of a kernel ID.
+   * @param[in]  id  kernel ID, 1 to the number of kernels called so far.
+   * @return     points to the record, or NULL if no kernel has this ID.
+   */
 
-    /* y2 * (xfract) * (yfract)  in 2.22 and adding to acc */
-    out = ((y2 * (yfract)));
-    acc += (((q63_t) out * (xfract)));
+  const riscv_sat_stats_entry * riscv_sat_stats_get(
+  uint32_t id);
 
-    /* acc in 16.47 format and down shift by 40 to convert to 1.7 format */
-    return (acc >> 40);
+  /**
+   * @brief  Hands the record of every kernel called so far to a print function, in kernel ID order.
+   * @param[in]  func  function called once per record.
+   * @param[in]  *ctx  context handed to <code>func</code>.
+   * @return     number of records.
+   */
 
-  }
+  uint32_t riscv_sat_stats_dump(
+  riscv_sat_stats_dump_func func,
+  void * ctx);
 
   /**
-   * @} end of BilinearInterpolate group
+   * @brief  Headroom of a kernel, in bits, between the peak of its values and the saturation limit.
+   * @param[in]  *pEntry  points to the record of the kernel.
+   * @return     number of bits the values could grow without saturating, negative when they saturated
+   *             by that many bits.
    */
-   
+
+  int32_t riscv_sat_stats_headroom(
+  const riscv_sat_stats_entry * pEntry);
+
+  /**
+   * @brief  Checks one value of the running instrumented kernel against the saturation limits.
+   * @param[in]  x  value before saturation.
+   * @return     x.
+   */
+
+  static inline q63_t riscv_sat_stats_record(
+  q63_t x)
+  {
+    riscv_sat_stats_scope *pScope = riscv_sat_stats_current;
+    q63_t mag = (x < 0) ? -x : x;
+
+    if(pScope == NULL)
+    {
+      return (x);
+    }
+
+    pScope->values++;
+    if((x > pScope->max) || (x < (-pScope->max - 1)))
+    {
+      pScope->saturations++;
+    }
+    if(mag > pScope->peak)
+    {
+      pScope->peak = mag;
+    }
+
+    return (x);
+  }
+
+/*
+* Saturation instrumentation of the fixed-point kernels.  With RISCV_DSP_SAT_STATS, RISCV_SAT_STATS(name,
+* bits) after RISCV_PROFILE() declares the record of a kernel whose outputs are saturated to bits bits, and
+* RISCV_SAT(x) around a value before its saturation, also in the static helpers of the kernel, counts it
+* and returns it unchanged.  Without it the first is empty and the second is x.
+*/
+#if defined (RISCV_DSP_SAT_STATS)
+#define RISCV_SAT_STATS(name, bits)                                                              \
+  static riscv_sat_stats_entry riscv_sat_stats_entry_ = { #name, (bits), 0u, 0u, 0u, 0u, 0 };     \
+  riscv_sat_stats_scope riscv_sat_stats_scope_ __attribute__((cleanup(riscv_sat_stats_exit)));    \
+  riscv_sat_stats_enter(&riscv_sat_stats_entry_, &riscv_sat_stats_scope_)
+#define RISCV_SAT(x)  ((__typeof__(x)) riscv_sat_stats_record((q63_t) (x)))
+#else
+#define RISCV_SAT_STATS(name, bits)
+#define RISCV_SAT(x)  (x)
+#endif
 
 //SMMLAR
 #define multAcc_32x32_keep32_R(a, x, y) \
@@ -0,0 +1,578 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_math_inline.h
+*
+* Description:  Static inline versions of the short-vector basic math,
+*               complex math and statistics kernels.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+/*
+* riscv_xxx_inline() has the arguments and results of the library kernel
+* riscv_xxx(), and is compiled into the caller.  On 4 to 16 elements the
+* call, the loop setup and the unrolled remainder loops of the library
+* kernel cost more than the arithmetic; inlined with a constant blockSize
+* the compiler unrolls the loop completely and keeps the operands in
+* registers across neighbouring calls:
+*
+*   q63_t acc;
+*
+*   riscv_dot_prod_q15_inline(pState, pCoeffs, 8u, &acc);
+*
+* Every function rounds and saturates like the scalar path of its library
+* kernel and sums in the same order, so the results are the same; the f32
+* ones match as long as the caller is compiled with the same floating-point
+* contraction (-ffp-contract) as the library.  They do not record
+* RISCV_DSP_PROFILE calls or RISCV_DSP_SAT_STATS saturations.  For long
+* vectors the library kernels, with their xpulp SIMD paths, stay faster.
+*/
+
+#ifndef _RISCV_MATH_INLINE_H
+#define _RISCV_MATH_INLINE_H
+
+#include "riscv_math.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+#if defined (USE_DSP_RISCV)
+#define RISCV_INLINE_SAT_Q15(x)  ((q15_t) clip((x), -32768, 32767))
+#else
+#define RISCV_INLINE_SAT_Q15(x)  ((q15_t) __SSAT((x), 16))
+#endif
+
+/* Basic math --------------------------------------------------------- */
+
+  static inline void riscv_add_f32_inline(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = pSrcA[i] + pSrcB[i];
+  }
+
+  static inline void riscv_add_q31_inline(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = clip_q63_to_q31((q63_t) pSrcA[i] + pSrcB[i]);
+  }
+
+  static inline void riscv_add_q15_inline(
+  const q15_t * pSrcA,
+  const q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = RISCV_INLINE_SAT_Q15((q31_t) pSrcA[i] + pSrcB[i]);
+  }
+
+  static inline void riscv_sub_f32_inline(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = pSrcA[i] - pSrcB[i];
+  }
+
+  static inline void riscv_sub_q15_inline(
+  const q15_t * pSrcA,
+  const q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = RISCV_INLINE_SAT_Q15((q31_t) pSrcA[i] - pSrcB[i]);
+  }
+
+  static inline void riscv_mult_f32_inline(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = pSrcA[i] * pSrcB[i];
+  }
+
+  static inline void riscv_mult_q31_inline(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = clip_q63_to_q31(((q63_t) pSrcA[i] * pSrcB[i]) >> 31);
+  }
+
+  static inline void riscv_mult_q15_inline(
+  const q15_t * pSrcA,
+  const q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = RISCV_INLINE_SAT_Q15(((q31_t) pSrcA[i] * pSrcB[i]) >> 15);
+  }
+
+  static inline void riscv_scale_f32_inline(
+  const float32_t * pSrc,
+  float32_t scale,
+  float32_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = pSrc[i] * scale;
+  }
+
+  static inline void riscv_scale_q15_inline(
+  const q15_t * pSrc,
+  q15_t scaleFract,
+  int8_t shift,
+  q15_t * pDst,
+  uint32_t blockSize)
+  {
+    int kShift = 15 - shift;
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = RISCV_INLINE_SAT_Q15(((q31_t) pSrc[i] * scaleFract) >> kShift);
+  }
+
+  static inline void riscv_offset_f32_inline(
+  const float32_t * pSrc,
+  float32_t offset,
+  float32_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = pSrc[i] + offset;
+  }
+
+  static inline void riscv_offset_q15_inline(
+  const q15_t * pSrc,
+  q15_t offset,
+  q15_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = RISCV_INLINE_SAT_Q15((q31_t) pSrc[i] + offset);
+  }
+
+  static inline void riscv_negate_f32_inline(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = -pSrc[i];
+  }
+
+  static inline void riscv_negate_q15_inline(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = (pSrc[i] == (q15_t) 0x8000) ? 0x7fff : -pSrc[i];
+  }
+
+  static inline void riscv_abs_f32_inline(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = fabsf(pSrc[i]);
+  }
+
+  static inline void riscv_abs_q15_inline(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      pDst[i] = (pSrc[i] > 0) ? pSrc[i] : ((pSrc[i] == (q15_t) 0x8000) ? 0x7fff : -pSrc[i]);
+  }
+
+  /* Four partial sums, added like riscv_dot_prod_f32() */
+  static inline void riscv_dot_prod_f32_inline(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * result)
+  {
+    float32_t sum = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+    uint32_t i;
+
+    for (i = 0u; i + 4u <= blockSize; i += 4u)
+    {
+      sum += pSrcA[i] * pSrcB[i];
+      sum1 += pSrcA[i + 1u] * pSrcB[i + 1u];
+      sum2 += pSrcA[i + 2u] * pSrcB[i + 2u];
+      sum3 += pSrcA[i + 3u] * pSrcB[i + 3u];
+    }
+    for (; i < blockSize; i++)
+      sum += pSrcA[i] * pSrcB[i];
+
+    *result = sum + ((sum1 + sum2) + sum3);
+  }
+
+  static inline void riscv_dot_prod_q31_inline(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  uint32_t blockSize,
+  q63_t * result)
+  {
+    q63_t sum = 0;
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      sum += ((q63_t) pSrcA[i] * pSrcB[i]) >> 14u;
+
+    *result = sum;
+  }
+
+  static inline void riscv_dot_prod_q15_inline(
+  const q15_t * pSrcA,
+  const q15_t * pSrcB,
+  uint32_t blockSize,
+  q63_t * result)
+  {
+    q63_t sum = 0;
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      sum += (q63_t) ((q31_t) pSrcA[i] * pSrcB[i]);
+
+    *result = sum;
+  }
+
+/* Complex math ------------------------------------------------------- */
+
+  static inline void riscv_cmplx_conj_f32_inline(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < 2u * numSamples; i += 2u)
+    {
+      pDst[i] = pSrc[i];
+      pDst[i + 1u] = -pSrc[i + 1u];
+    }
+  }
+
+  static inline void riscv_cmplx_conj_q15_inline(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < 2u * numSamples; i += 2u)
+    {
+      pDst[i] = pSrc[i];
+      pDst[i + 1u] = (pSrc[i + 1u] == (q15_t) 0x8000) ? 0x7fff : -pSrc[i + 1u];
+    }
+  }
+
+  static inline void riscv_cmplx_mult_cmplx_f32_inline(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t numSamples)
+  {
+    float32_t a, b, c, d;
+    uint32_t i;
+
+    for (i = 0u; i < 2u * numSamples; i += 2u)
+    {
+      a = pSrcA[i];
+      b = pSrcA[i + 1u];
+      c = pSrcB[i];
+      d = pSrcB[i + 1u];
+      pDst[i] = (a * c) - (b * d);
+      pDst[i + 1u] = (a * d) + (b * c);
+    }
+  }
+
+  static inline void riscv_cmplx_mult_cmplx_q15_inline(
+  const q15_t * pSrcA,
+  const q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t numSamples)
+  {
+    q31_t a, b, c, d;
+    uint32_t i;
+
+    for (i = 0u; i < 2u * numSamples; i += 2u)
+    {
+      a = pSrcA[i];
+      b = pSrcA[i + 1u];
+      c = pSrcB[i];
+      d = pSrcB[i + 1u];
+      pDst[i] = (q15_t) (((a * c) >> 17) - ((b * d) >> 17));
+      pDst[i + 1u] = (q15_t) (((a * d) >> 17) + ((b * c) >> 17));
+    }
+  }
+
+  static inline void riscv_cmplx_mag_squared_f32_inline(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < numSamples; i++)
+      pDst[i] = (pSrc[2u * i] * pSrc[2u * i]) + (pSrc[2u * i + 1u] * pSrc[2u * i + 1u]);
+  }
+
+  static inline void riscv_cmplx_mag_squared_q15_inline(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples)
+  {
+    q31_t re, im;
+    uint32_t i;
+
+    for (i = 0u; i < numSamples; i++)
+    {
+      re = pSrc[2u * i];
+      im = pSrc[2u * i + 1u];
+      pDst[i] = (q15_t) (((q63_t) (re * re) + (im * im)) >> 17);
+    }
+  }
+
+  static inline void riscv_cmplx_dot_prod_f32_inline(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  uint32_t numSamples,
+  float32_t * realResult,
+  float32_t * imagResult)
+  {
+    float32_t real_sum = 0.0f, imag_sum = 0.0f;
+    uint32_t i;
+
+    for (i = 0u; i < 2u * numSamples; i += 2u)
+    {
+      real_sum += pSrcA[i] * pSrcB[i];
+      imag_sum += pSrcA[i] * pSrcB[i + 1u];
+      real_sum -= pSrcA[i + 1u] * pSrcB[i + 1u];
+      imag_sum += pSrcA[i + 1u] * pSrcB[i];
+    }
+
+    *realResult = real_sum;
+    *imagResult = imag_sum;
+  }
+
+/* Statistics --------------------------------------------------------- */
+
+  /* Four partial sums, added like riscv_mean_f32() */
+  static inline void riscv_mean_f32_inline(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult)
+  {
+    float32_t sum = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+    uint32_t i;
+
+    for (i = 0u; i + 4u <= blockSize; i += 4u)
+    {
+      sum += pSrc[i];
+      sum1 += pSrc[i + 1u];
+      sum2 += pSrc[i + 2u];
+      sum3 += pSrc[i + 3u];
+    }
+    for (; i < blockSize; i++)
+      sum += pSrc[i];
+
+    *pResult = (sum + ((sum1 + sum2) + sum3)) / (float32_t) blockSize;
+  }
+
+  static inline void riscv_mean_q15_inline(
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult)
+  {
+    q31_t sum = 0;
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      sum += pSrc[i];
+
+    *pResult = (q15_t) (sum / (q31_t) blockSize);
+  }
+
+  /* Four partial sums, added like riscv_power_f32() */
+  static inline void riscv_power_f32_inline(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult)
+  {
+    float32_t sum = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+    uint32_t i;
+
+    for (i = 0u; i + 4u <= blockSize; i += 4u)
+    {
+      sum += pSrc[i] * pSrc[i];
+      sum1 += pSrc[i + 1u] * pSrc[i + 1u];
+      sum2 += pSrc[i + 2u] * pSrc[i + 2u];
+      sum3 += pSrc[i + 3u] * pSrc[i + 3u];
+    }
+    for (; i < blockSize; i++)
+      sum += pSrc[i] * pSrc[i];
+
+    *pResult = sum + ((sum1 + sum2) + sum3);
+  }
+
+  static inline void riscv_power_q15_inline(
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  q63_t * pResult)
+  {
+    q63_t sum = 0;
+    uint32_t i;
+
+    for (i = 0u; i < blockSize; i++)
+      sum += (q31_t) pSrc[i] * pSrc[i];
+
+    *pResult = sum;
+  }
+
+  /* The first of equal maxima or minima, like the library kernels */
+  static inline void riscv_max_f32_inline(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult,
+  uint32_t * pIndex)
+  {
+    float32_t out = pSrc[0];
+    uint32_t i, outIndex = 0u;
+
+    for (i = 1u; i < blockSize; i++)
+    {
+      if(out < pSrc[i])
+      {
+        out = pSrc[i];
+        outIndex = i;
+      }
+    }
+
+    *pResult = out;
+    *pIndex = outIndex;
+  }
+
+  static inline void riscv_max_q15_inline(
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult,
+  uint32_t * pIndex)
+  {
+    q15_t out = pSrc[0];
+    uint32_t i, outIndex = 0u;
+
+    for (i = 1u; i < blockSize; i++)
+    {
+      if(out < pSrc[i])
+      {
+        out = pSrc[i];
+        outIndex = i;
+      }
+    }
+
+    *pResult = out;
+    *pIndex = outIndex;
+  }
+
+  static inline void riscv_min_f32_inline(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pResult,
+  uint32_t * pIndex)
+  {
+    float32_t out = pSrc[0];
+    uint32_t i, outIndex = 0u;
+
+    for (i = 1u; i < blockSize; i++)
+    {
+      if(out > pSrc[i])
+      {
+        out = pSrc[i];
+        outIndex = i;
+      }
+    }
+
+    *pResult = out;
+    *pIndex = outIndex;
+  }
+
+  static inline void riscv_min_q15_inline(
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult,
+  uint32_t * pIndex)
+  {
+    q15_t out = pSrc[0];
+    uint32_t i, outIndex = 0u;
+
+    for (i = 1u; i < blockSize; i++)
+    {
+      if(out > pSrc[i])
+      {
+        out = pSrc[i];
+        outIndex = i;
+      }
+    }
+
+    *pResult = out;
+    *pIndex = outIndex;
+  }
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _RISCV_MATH_INLINE_H */
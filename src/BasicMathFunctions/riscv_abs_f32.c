@@ -80,9 +80,10 @@ void riscv_abs_f32(
   float32_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_abs_f32);
   uint32_t blkCnt;                               /* loop counter */
 
-#if defined (USE_DSP_RISCV)
+#if defined (USE_DSP_RISCV) && defined (RISCV_MATH_LOOPUNROLL)
 
   float32_t in1, in2, in3, in4;                  /* temporary variables */
 
@@ -68,6 +68,7 @@ void riscv_abs_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_abs_q15);
   uint32_t blkCnt;                               /* loop counter */
   q15_t in;                                      /* Temporary input variable */
 #if defined (USE_DSP_RISCV)
@@ -69,6 +69,7 @@ void riscv_abs_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_abs_q31);
   uint32_t blkCnt;                               /* loop counter */
   q31_t in,out;                                      /* Input value */
 
@@ -72,6 +72,7 @@ void riscv_abs_q7(
   q7_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_abs_q7);
   uint32_t blkCnt;                               /* loop counter */
   q7_t in;                                       /* Input value1 */
 
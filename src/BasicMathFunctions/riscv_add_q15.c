@@ -71,6 +71,8 @@ void riscv_add_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_add_q15);
+  RISCV_SAT_STATS(riscv_add_q15, 16);
   uint32_t blkCnt;                               /* loop counter */
 
 #if defined (USE_DSP_RISCV)
@@ -88,8 +90,8 @@ void riscv_add_q15(
     inB1 = *pSrcB++;
     inB2 = *pSrcB++;
    /*add and saturate them*/
-    *pDst++ =(q15_t)clip((inA1 + inB1),-32768,32767);
-    *pDst++ =(q15_t)clip((inA2 + inB2),-32768,32767);
+    *pDst++ =(q15_t)clip(RISCV_SAT(inA1 + inB1),-32768,32767);
+    *pDst++ =(q15_t)clip(RISCV_SAT(inA2 + inB2),-32768,32767);
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -101,7 +103,7 @@ void riscv_add_q15(
   {
     /* C = A + B */
     /* Add and then store the results in the destination buffer. */
-    *pDst++ = (q15_t)clip((*pSrcA++ + *pSrcB++),-32768,32767);
+    *pDst++ = (q15_t)clip(RISCV_SAT(*pSrcA++ + *pSrcB++),-32768,32767);
     /* Decrement the loop counter */
     blkCnt--;
   }
@@ -115,7 +117,7 @@ void riscv_add_q15(
   {
     /* C = A + B */
     /* Add and then store the results in the destination buffer. */
-    *pDst++ = (q15_t) __SSAT(((q31_t) * pSrcA++ + *pSrcB++), 16);
+    *pDst++ = (q15_t) __SSAT(RISCV_SAT((q31_t) * pSrcA++ + *pSrcB++), 16);
 
     /* Decrement the loop counter */
     blkCnt--;
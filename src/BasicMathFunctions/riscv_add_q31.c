@@ -72,22 +72,52 @@ void riscv_add_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_add_q31);
+  RISCV_SAT_STATS(riscv_add_q31, 32);
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (USE_DSP_RISCV)
+  q31_t inA1, inA2, inB1, inB2;                  /* Input values */
+  q31_t sum1, sum2;                              /* Wrapped 32-bit sums */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+  while(blkCnt > 0u)
+  {
+    /* C = A + B */
+    /* read 2 elements from each buffer */
+    inA1 = *pSrcA++;
+    inA2 = *pSrcA++;
+    inB1 = *pSrcB++;
+    inB2 = *pSrcB++;
+
+    /* Add in 32 bits, an overflow gives a sum with the sign of neither input */
+    sum1 = (q31_t) ((uint32_t) inA1 + (uint32_t) inB1);
+    sum2 = (q31_t) ((uint32_t) inA2 + (uint32_t) inB2);
+    (void) RISCV_SAT((q63_t) inA1 + inB1);
+    (void) RISCV_SAT((q63_t) inA2 + inB2);
+    *pDst++ = (((inA1 ^ sum1) & (inB1 ^ sum1)) < 0) ? (0x7FFFFFFF ^ (inA1 >> 31)) : sum1;
+    *pDst++ = (((inA2 ^ sum2) & (inB2 ^ sum2)) < 0) ? (0x7FFFFFFF ^ (inA2 >> 31)) : sum2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+#else
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
+#endif
 
   while(blkCnt > 0u)
   {
     /* C = A + B */
     /* Add and then store the results in the destination buffer. */
-    *pDst++ = (q31_t) clip_q63_to_q31((q63_t) * pSrcA++ + *pSrcB++);
+    *pDst++ = (q31_t) clip_q63_to_q31(RISCV_SAT((q63_t) * pSrcA++ + *pSrcB++));
 
     /* Decrement the loop counter */
     blkCnt--;
   }
-
-
 }
 
 /**    
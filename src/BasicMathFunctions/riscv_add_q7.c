@@ -71,6 +71,7 @@ void riscv_add_q7(
   q7_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_add_q7);
   uint32_t blkCnt;                               /* loop counter */
 
 
@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_axpy_f32.c
+*
+* Description:  Floating-point scaled vector addition.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @defgroup BasicAxpy Vector Scale-Add
+ *
+ * Adds a scaled vector to a second vector:
+ *
+ * <pre>
+ *     pDst[n] = scale * pSrcX[n] + pSrcY[n],   0 <= n < blockSize.
+ * </pre>
+ *
+ * This is the gain stage of a mixer or the update step of a gradient descent, which
+ * otherwise takes riscv_scale_f32() into a temporary buffer and riscv_add_f32().
+ * As in the \ref scale functions the fixed-point scale is given by a fractional part
+ * <code>scaleFract</code> and a shift <code>shift</code>, <code>scale = scaleFract * 2^shift</code>,
+ * and only the final sum is saturated.
+ *
+ * <code>pDst</code> may point to the same buffer as <code>pSrcY</code>, which gives the
+ * in-place form <code>y = a*x + y</code>.
+ * There are separate functions for floating-point, Q7, Q15, and Q31 data types.
+ */
+
+/**
+ * @addtogroup BasicAxpy
+ * @{
+ */
+
+/**
+ * @brief Adds a scaled floating-point vector to a second vector.
+ * @param[in]       *pSrcX points to the vector that is scaled
+ * @param[in]       scale scale factor to be applied
+ * @param[in]       *pSrcY points to the vector that is added
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void riscv_axpy_f32(
+  float32_t * pSrcX,
+  float32_t scale,
+  float32_t * pSrcY,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_axpy_f32);
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* D = scale * X + Y */
+    *pDst++ = (scale * (*pSrcX++)) + (*pSrcY++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BasicAxpy group
+ */
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_axpy_q15.c
+*
+* Description:  Q15 scaled vector addition.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicAxpy
+ * @{
+ */
+
+/**
+ * @brief Adds a scaled Q15 vector to a second vector.
+ * @param[in]       *pSrcX points to the vector that is scaled
+ * @param[in]       scaleFract fractional portion of the scale value
+ * @param[in]       shift number of bits to shift the product by, at most 15
+ * @param[in]       *pSrcY points to the vector that is added
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input data <code>*pSrcX</code> and <code>scaleFract</code> are in 1.15 format.
+ * Their 2.30 product is shifted right by <code>15 - shift</code> bits, as in riscv_scale_q15(),
+ * <code>pSrcY</code> is added and the sum is saturated to 1.15 format.
+ */
+
+void riscv_axpy_q15(
+  q15_t * pSrcX,
+  q15_t scaleFract,
+  int8_t shift,
+  q15_t * pSrcY,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_axpy_q15);
+  int kShift = 15 - shift;                       /* Shift to apply after scaling */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+  q31_t out1, out2;                              /* Sums before saturation */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+  while(blkCnt > 0u)
+  {
+    /* D = scale * X + Y, the 16x16 products use p.muls */
+    out1 = (muls(pSrcX[0], scaleFract) >> kShift) + pSrcY[0];
+    out2 = (muls(pSrcX[1], scaleFract) >> kShift) + pSrcY[1];
+    pSrcX += 2;
+    pSrcY += 2;
+
+    *pDst++ = (q15_t) clip(out1, -32768, 32767);
+    *pDst++ = (q15_t) clip(out2, -32768, 32767);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+
+  while(blkCnt > 0u)
+  {
+    /* D = scale * X + Y */
+    *pDst++ = (q15_t) clip((muls(*pSrcX++, scaleFract) >> kShift) + *pSrcY++, -32768, 32767);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* D = scale * X + Y */
+    *pDst++ = (q15_t) __SSAT((((q31_t) (*pSrcX++) * scaleFract) >> kShift) + *pSrcY++, 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+#endif
+}
+
+/**
+ * @} end of BasicAxpy group
+ */
@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_axpy_q31.c
+*
+* Description:  Q31 scaled vector addition.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicAxpy
+ * @{
+ */
+
+/**
+ * @brief Adds a scaled Q31 vector to a second vector.
+ * @param[in]       *pSrcX points to the vector that is scaled
+ * @param[in]       scaleFract fractional portion of the scale value
+ * @param[in]       shift number of bits to shift the product by, in the range [-32 31]
+ * @param[in]       *pSrcY points to the vector that is added
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 2.62 product of <code>pSrcX</code> and <code>scaleFract</code> is shifted by
+ * <code>31 - shift</code> bits in a 64-bit accumulator, <code>pSrcY</code> is added and the
+ * sum is saturated to 1.31 format.  The product is not saturated on its own, so a large
+ * intermediate value may still be brought back into range by <code>pSrcY</code>.
+ */
+
+void riscv_axpy_q31(
+  q31_t * pSrcX,
+  q31_t scaleFract,
+  int8_t shift,
+  q31_t * pSrcY,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_axpy_q31);
+  uint32_t kShift = (uint32_t) (31 - shift);     /* Shift to apply after scaling */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+  q63_t acc1, acc2;                              /* Accumulators */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+  while(blkCnt > 0u)
+  {
+    /* D = scale * X + Y */
+    acc1 = (((q63_t) pSrcX[0] * scaleFract) >> kShift) + pSrcY[0];
+    acc2 = (((q63_t) pSrcX[1] * scaleFract) >> kShift) + pSrcY[1];
+    pSrcX += 2;
+    pSrcY += 2;
+
+    *pDst++ = clip_q63_to_q31(acc1);
+    *pDst++ = clip_q63_to_q31(acc2);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+#else
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* D = scale * X + Y */
+    *pDst++ = clip_q63_to_q31((((q63_t) (*pSrcX++) * scaleFract) >> kShift) + *pSrcY++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BasicAxpy group
+ */
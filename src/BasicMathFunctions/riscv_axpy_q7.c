@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_axpy_q7.c
+*
+* Description:  Q7 scaled vector addition.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicAxpy
+ * @{
+ */
+
+/**
+ * @brief Adds a scaled Q7 vector to a second vector.
+ * @param[in]       *pSrcX points to the vector that is scaled
+ * @param[in]       scaleFract fractional portion of the scale value
+ * @param[in]       shift number of bits to shift the product by, at most 7
+ * @param[in]       *pSrcY points to the vector that is added
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input data <code>*pSrcX</code> and <code>scaleFract</code> are in 1.7 format.
+ * Their 2.14 product is shifted right by <code>7 - shift</code> bits, as in riscv_scale_q7(),
+ * <code>pSrcY</code> is added and the sum is saturated to 1.7 format.
+ */
+
+void riscv_axpy_q7(
+  q7_t * pSrcX,
+  q7_t scaleFract,
+  int8_t shift,
+  q7_t * pSrcY,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_axpy_q7);
+  int kShift = 7 - shift;                       /* Shift to apply after scaling */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+  q31_t out1, out2;                              /* Sums before saturation */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+  while(blkCnt > 0u)
+  {
+    /* D = scale * X + Y, the 16x16 products use p.muls */
+    out1 = (muls(pSrcX[0], scaleFract) >> kShift) + pSrcY[0];
+    out2 = (muls(pSrcX[1], scaleFract) >> kShift) + pSrcY[1];
+    pSrcX += 2;
+    pSrcY += 2;
+
+    *pDst++ = (q7_t) clip(out1, -128, 127);
+    *pDst++ = (q7_t) clip(out2, -128, 127);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+
+  while(blkCnt > 0u)
+  {
+    /* D = scale * X + Y */
+    *pDst++ = (q7_t) clip((muls(*pSrcX++, scaleFract) >> kShift) + *pSrcY++, -128, 127);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* D = scale * X + Y */
+    *pDst++ = (q7_t) __SSAT((((q15_t) (*pSrcX++) * scaleFract) >> kShift) + *pSrcY++, 8);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+#endif
+}
+
+/**
+ * @} end of BasicAxpy group
+ */
@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_clip_f32.c
+*
+* Description:  Clamps a floating-point vector to a range.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @defgroup BasicClip Vector Clipping
+ *
+ * Clamps every element of a vector to the range <code>[low, high]</code>:
+ *
+ * <pre>
+ *     pDst[n] = min(max(pSrc[n], low), high),   0 <= n < blockSize.
+ * </pre>
+ *
+ * The bounds are arbitrary values of the data type, <code>low <= high</code>.  The
+ * <code>clip</code> builtin the library uses for saturation only takes the power of two bounds
+ * of <code>p.clip</code>, so the xpulp paths of the Q7 and Q15 functions clamp four or two
+ * elements at a time with <code>pv.min</code> and <code>pv.max</code>, and the Q31 and
+ * floating-point ones compile to <code>p.min</code>/<code>p.max</code> and their floating-point
+ * counterparts.
+ *
+ * <code>pDst</code> may point to the same buffer as <code>pSrc</code>.
+ * There are separate functions for floating-point, Q7, Q15, and Q31 data types.
+ */
+
+/**
+ * @addtogroup BasicClip
+ * @{
+ */
+
+/**
+ * @brief Clamps a floating-point vector to a range.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       low lower bound
+ * @param[in]       high upper bound
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ */
+
+void riscv_clip_f32(
+  float32_t * pSrc,
+  float32_t low,
+  float32_t high,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_clip_f32);
+  float32_t in;                                  /* Input value */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* C = min(max(A, low), high) */
+    in = *pSrc++;
+    in = (in > high) ? high : in;
+    *pDst++ = (in < low) ? low : in;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BasicClip group
+ */
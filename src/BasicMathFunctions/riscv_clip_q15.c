@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_clip_q15.c
+*
+* Description:  Clamps a Q15 vector to a range.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicClip
+ * @{
+ */
+
+/**
+ * @brief Clamps a Q15 vector to a range.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       low lower bound
+ * @param[in]       high upper bound
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ */
+
+void riscv_clip_q15(
+  q15_t * pSrc,
+  q15_t low,
+  q15_t high,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_clip_q15);
+  q15_t in;                                      /* Input value */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+
+  shortV lowV = pack2(low, low);                 /* Bounds in both lanes */
+  shortV highV = pack2(high, high);
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* Clamp 2 elements with pv.min.h and pv.max.h */
+    *(shortV *) pDst = max2(min2(*(shortV *) pSrc, highV), lowV);
+    pSrc += 2;
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* C = min(max(A, low), high) */
+    in = *pSrc++;
+    in = (in > high) ? high : in;
+    *pDst++ = (in < low) ? low : in;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BasicClip group
+ */
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_clip_q31.c
+*
+* Description:  Clamps a Q31 vector to a range.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicClip
+ * @{
+ */
+
+/**
+ * @brief Clamps a Q31 vector to a range.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       low lower bound
+ * @param[in]       high upper bound
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ */
+
+void riscv_clip_q31(
+  q31_t * pSrc,
+  q31_t low,
+  q31_t high,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_clip_q31);
+  q31_t in1, in2;                                /* Input values */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = min(max(A, low), high), p.min and p.max on xpulp */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in1 = (in1 > high) ? high : in1;
+    in2 = (in2 > high) ? high : in2;
+    pDst[0] = (in1 < low) ? low : in1;
+    pDst[1] = (in2 < low) ? low : in2;
+    pSrc += 2;
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = min(max(A, low), high) */
+    in1 = *pSrc++;
+    in1 = (in1 > high) ? high : in1;
+    *pDst++ = (in1 < low) ? low : in1;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BasicClip group
+ */
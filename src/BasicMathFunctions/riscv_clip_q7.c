@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_clip_q7.c
+*
+* Description:  Clamps a Q7 vector to a range.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicClip
+ * @{
+ */
+
+/**
+ * @brief Clamps a Q7 vector to a range.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       low lower bound
+ * @param[in]       high upper bound
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ */
+
+void riscv_clip_q7(
+  q7_t * pSrc,
+  q7_t low,
+  q7_t high,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_clip_q7);
+  q7_t in;                                      /* Input value */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+
+  charV lowV = pack4(low, low, low, low);        /* Bounds in all lanes */
+  charV highV = pack4(high, high, high, high);
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* Clamp 4 elements with pv.min.b and pv.max.b */
+    *(charV *) pDst = max4(min4(*(charV *) pSrc, highV), lowV);
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* C = min(max(A, low), high) */
+    in = *pSrc++;
+    in = (in > high) ? high : in;
+    *pDst++ = (in < low) ? low : in;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BasicClip group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmp_range_mask_f32.c
+*
+* Description:  Packed bit mask of the floating-point elements in a range.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @defgroup BasicCmpMask Vector Compare Mask
+ *
+ * Compares every element of a vector with a range and packs the results into a bit mask,
+ * one bit per element:
+ *
+ * <pre>
+ *     bit n of pMask = (low <= pSrc[n]) && (pSrc[n] <= high),   0 <= n < blockSize.
+ * </pre>
+ *
+ * Bit <code>n</code> is bit <code>n % 32</code> of the word <code>pMask[n / 32]</code>, the
+ * mask takes <code>(blockSize + 31) / 32</code> words and the unused bits of the last one are
+ * cleared.  The function returns the number of bits set.
+ *
+ * One range covers the comparisons with a value: <code>x >= v</code> is the range
+ * <code>[v, max]</code>, <code>x <= v</code> the range <code>[min, v]</code> and
+ * <code>x == v</code> the range <code>[v, v]</code>, where <code>min</code> and <code>max</code>
+ * are the limits of the data type.  A strict comparison takes the neighbouring value,
+ * <code>x > v</code> of an integer is <code>[v + 1, max]</code>, and the complement of a mask
+ * gives the elements outside the range.  A floating-point NaN is never in the range.
+ *
+ * The xpulp paths of the Q7 and Q15 functions compare four or two elements at a time.  The
+ * comparisons give all ones or all zeros per lane, <code>-1</code> or <code>0</code>, and one
+ * <code>pv.dotsp</code> with the weights <code>(1, 2, 4, 8)</code> or <code>(1, 2)</code> turns
+ * the lanes into the negated bits of the mask.
+ *
+ * There are separate functions for floating-point, Q7, Q15, and Q31 data types.
+ */
+
+/**
+ * @addtogroup BasicCmpMask
+ * @{
+ */
+
+/**
+ * @brief Packed bit mask of the floating-point elements in a range.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       low lower bound of the range
+ * @param[in]       high upper bound of the range
+ * @param[out]      *pMask points to the <code>(blockSize + 31) / 32</code> words of the mask
+ * @param[in]       blockSize number of samples in the vector
+ * @return the number of elements in the range.
+ */
+
+uint32_t riscv_cmp_range_mask_f32(
+  float32_t * pSrc,
+  float32_t low,
+  float32_t high,
+  uint32_t * pMask,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cmp_range_mask_f32);
+  uint32_t bits, count = 0u;                     /* Word of the mask and bits set */
+  uint32_t j, n;
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* 32 elements per word */
+  blkCnt = blockSize >> 5u;
+
+  while(blkCnt > 0u)
+  {
+    bits = 0u;
+    for (j = 0u; j < 32u; j++)
+    {
+      bits |= (uint32_t) ((pSrc[j] >= low) && (pSrc[j] <= high)) << j;
+    }
+    pSrc += 32;
+
+    *pMask++ = bits;
+    count += __builtin_popcount(bits);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Last word, partly used */
+  n = blockSize & 31u;
+
+  if(n > 0u)
+  {
+    bits = 0u;
+    for (j = 0u; j < n; j++)
+    {
+      bits |= (uint32_t) ((pSrc[j] >= low) && (pSrc[j] <= high)) << j;
+    }
+
+    *pMask = bits;
+    count += __builtin_popcount(bits);
+  }
+
+  return (count);
+}
+
+/**
+ * @} end of BasicCmpMask group
+ */
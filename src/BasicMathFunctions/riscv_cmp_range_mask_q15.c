@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmp_range_mask_q15.c
+*
+* Description:  Packed bit mask of the Q15 elements in a range.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicCmpMask
+ * @{
+ */
+
+/**
+ * @brief Packed bit mask of the Q15 elements in a range.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       low lower bound of the range
+ * @param[in]       high upper bound of the range
+ * @param[out]      *pMask points to the <code>(blockSize + 31) / 32</code> words of the mask
+ * @param[in]       blockSize number of samples in the vector
+ * @return the number of elements in the range.
+ *
+ * \par Conditions for optimum performance
+ *  Input buffer should be aligned by 32-bit
+ */
+
+uint32_t riscv_cmp_range_mask_q15(
+  q15_t * pSrc,
+  q15_t low,
+  q15_t high,
+  uint32_t * pMask,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cmp_range_mask_q15);
+  uint32_t bits, count = 0u;                     /* Word of the mask and bits set */
+  uint32_t j, n;
+  uint32_t blkCnt;                               /* loop counter */
+#if defined (USE_DSP_RISCV)
+  shortV lowV = pack2(low, low);                 /* Bounds in both lanes */
+  shortV highV = pack2(high, high);
+  shortV weights = { 1, 2 };                     /* Bit of each lane */
+  shortV VectIn, inRange;
+#endif
+
+  /* 32 elements per word */
+  blkCnt = blockSize >> 5u;
+
+  while(blkCnt > 0u)
+  {
+    bits = 0u;
+#if defined (USE_DSP_RISCV)
+    for (j = 0u; j < 32u; j += 2u)
+    {
+      /* -1 in the lanes in the range, pv.cmpge.h and pv.cmple.h */
+      VectIn = *(shortV *) (pSrc + j);
+      inRange = (VectIn >= lowV) & (VectIn <= highV);
+      bits |= (uint32_t) (-dotpv2(inRange, weights)) << j;
+    }
+#else
+    for (j = 0u; j < 32u; j++)
+    {
+      bits |= (uint32_t) ((pSrc[j] >= low) && (pSrc[j] <= high)) << j;
+    }
+#endif
+    pSrc += 32;
+
+    *pMask++ = bits;
+    count += __builtin_popcount(bits);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Last word, partly used */
+  n = blockSize & 31u;
+
+  if(n > 0u)
+  {
+    bits = 0u;
+    for (j = 0u; j < n; j++)
+    {
+      bits |= (uint32_t) ((pSrc[j] >= low) && (pSrc[j] <= high)) << j;
+    }
+
+    *pMask = bits;
+    count += __builtin_popcount(bits);
+  }
+
+  return (count);
+}
+
+/**
+ * @} end of BasicCmpMask group
+ */
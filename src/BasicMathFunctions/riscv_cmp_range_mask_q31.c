@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmp_range_mask_q31.c
+*
+* Description:  Packed bit mask of the Q31 elements in a range.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicCmpMask
+ * @{
+ */
+
+/**
+ * @brief Packed bit mask of the Q31 elements in a range.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       low lower bound of the range
+ * @param[in]       high upper bound of the range
+ * @param[out]      *pMask points to the <code>(blockSize + 31) / 32</code> words of the mask
+ * @param[in]       blockSize number of samples in the vector
+ * @return the number of elements in the range.
+ */
+
+uint32_t riscv_cmp_range_mask_q31(
+  q31_t * pSrc,
+  q31_t low,
+  q31_t high,
+  uint32_t * pMask,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cmp_range_mask_q31);
+  uint32_t bits, count = 0u;                     /* Word of the mask and bits set */
+  uint32_t j, n;
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* 32 elements per word */
+  blkCnt = blockSize >> 5u;
+
+  while(blkCnt > 0u)
+  {
+    bits = 0u;
+    for (j = 0u; j < 32u; j++)
+    {
+      bits |= (uint32_t) ((pSrc[j] >= low) && (pSrc[j] <= high)) << j;
+    }
+    pSrc += 32;
+
+    *pMask++ = bits;
+    count += __builtin_popcount(bits);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Last word, partly used */
+  n = blockSize & 31u;
+
+  if(n > 0u)
+  {
+    bits = 0u;
+    for (j = 0u; j < n; j++)
+    {
+      bits |= (uint32_t) ((pSrc[j] >= low) && (pSrc[j] <= high)) << j;
+    }
+
+    *pMask = bits;
+    count += __builtin_popcount(bits);
+  }
+
+  return (count);
+}
+
+/**
+ * @} end of BasicCmpMask group
+ */
@@ -71,29 +71,75 @@
  * @param[in]       blockSize number of samples in each vector    
  * @param[out]      *result output result returned here    
  * @return none.    
+ *
+ * \par
+ * The products are accumulated in four partial sums, so consecutive multiply-adds do not wait for each
+ * other in the FPU pipeline.  The result can differ from a sequential sum in the last bits.
+ *
+ * \par
+ * With USE_DSP_RISCV the loop reads both vectors through post-incremented pointers and counts down a
+ * single counter, the form the PULP compiler turns into an lp.setup hardware loop of post-increment
+ * loads.  The partial sums are the same, so both builds give the same result.
  */
 
 
+RISCV_DSP_FASTCODE(riscv_dot_prod_f32)
 void riscv_dot_prod_f32(
   float32_t * pSrcA,
   float32_t * pSrcB,
   uint32_t blockSize,
   float32_t * result)
 {
+  RISCV_PROFILE(riscv_dot_prod_f32);
   float32_t sum = 0.0f;                          /* Temporary result storage */
+  float32_t sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;  /* Partial sums */
   uint32_t blkCnt;                               /* loop counter */
-  /* Initialize blkCnt with number of samples */
-  blkCnt = blockSize;
+
+  /* Four independent accumulators hide the latency of the FPU additions */
+  blkCnt = blockSize >> 2u;
+
+#if defined (USE_DSP_RISCV)
+
+  for (; blkCnt > 0u; blkCnt--)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    sum += (*pSrcA++) * (*pSrcB++);
+    sum1 += (*pSrcA++) * (*pSrcB++);
+    sum2 += (*pSrcA++) * (*pSrcB++);
+    sum3 += (*pSrcA++) * (*pSrcB++);
+  }
+
+#else
 
   while(blkCnt > 0u)
   {
     /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
-    /* Calculate dot product and then store the result in a temporary buffer. */
+    sum += pSrcA[0] * pSrcB[0];
+    sum1 += pSrcA[1] * pSrcB[1];
+    sum2 += pSrcA[2] * pSrcB[2];
+    sum3 += pSrcA[3] * pSrcB[3];
+    pSrcA += 4;
+    pSrcB += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#endif
+
+  /* Remaining samples */
+  blkCnt = blockSize & 3u;
+
+  while(blkCnt > 0u)
+  {
     sum += (*pSrcA++) * (*pSrcB++);
 
     /* Decrement the loop counter */
     blkCnt--;
   }
+
+  sum += (sum1 + sum2) + sum3;
+
   /* Store the result back in the destination buffer */
   *result = sum;
 }
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dot_prod_f64.c
+*
+* Description:  Double-precision floating-point dot product.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup dot_prod
+ * @{
+ */
+
+/**
+ * @brief Dot product of double-precision floating-point vectors.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       blockSize number of samples in each vector
+ * @param[out]      *result output result returned here
+ * @return none.
+ *
+ * \par
+ * The products are accumulated in four partial sums like riscv_dot_prod_f32().  Built for a core with
+ * the D extension (RISCV_DSP_BUILD_DOUBLE) the loop runs in fmadd.d/fadd.d, otherwise every operation
+ * is a call into the soft double routines of libgcc.
+ */
+
+void riscv_dot_prod_f64(
+  const float64_t * pSrcA,
+  const float64_t * pSrcB,
+  uint32_t blockSize,
+  float64_t * result)
+{
+  RISCV_PROFILE(riscv_dot_prod_f64);
+  float64_t sum = 0.0;                           /* Temporary result storage */
+  float64_t sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;  /* Partial sums */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Four independent accumulators hide the latency of the FPU additions */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    sum += pSrcA[0] * pSrcB[0];
+    sum1 += pSrcA[1] * pSrcB[1];
+    sum2 += pSrcA[2] * pSrcB[2];
+    sum3 += pSrcA[3] * pSrcB[3];
+    pSrcA += 4;
+    pSrcB += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Remaining samples */
+  blkCnt = blockSize & 3u;
+
+  while(blkCnt > 0u)
+  {
+    sum += (*pSrcA++) * (*pSrcB++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  sum += (sum1 + sum2) + sum3;
+
+  /* Store the result back in the destination buffer */
+  *result = sum;
+}
+
+/**
+ * @} end of dot_prod group
+ */
@@ -66,42 +66,79 @@
  * Nonsaturating additions are used and given that there are 33 guard bits in the accumulator    
  * there is no risk of overflow.    
  * The return result is in 34.30 format.    
+ *
+ * \par
+ * With the xpulp extensions the products are summed by pairs with <code>pv.dotsp.h</code>, whose
+ * 32-bit sum wraps when both products are 0x8000 * 0x8000, that is when two consecutive samples of both
+ * vectors are all -1.0.
+ *
+ * \par
+ * With the xpulp extensions one product aligns <code>pSrcA</code> to a word, and when <code>pSrcB</code>
+ * is then one sample past a word boundary its pairs are built from aligned word loads with one shuffle,
+ * so vectors at any sample offset, such as a window sliding over a buffer, take no misaligned load.
+ * The aligned loads may read the other half of the words holding the first and last sample of <code>pSrcB</code>.
  */
 
+RISCV_DSP_FASTCODE(riscv_dot_prod_q15)
 void riscv_dot_prod_q15(
   q15_t * pSrcA,
   q15_t * pSrcB,
   uint32_t blockSize,
   q63_t * result)
 {
+  RISCV_PROFILE(riscv_dot_prod_q15);
   q63_t sum = 0;                                 /* Temporary result storage */
   uint32_t blkCnt;                               /* loop counter */
 
 #if defined (USE_DSP_RISCV)
 
-  shortV *VectInA;
-  shortV *VectInB;
+  uint32_t numSamples = blockSize;               /* Samples left */
+  shortV lo, hi;                                 /* Aligned pairs of pSrcB */
+  shortV odd = { 1, 2 };                         /* Pair straddling two aligned pairs */
+
+  /* One product when pSrcA is not word aligned */
+  if((numSamples > 0u) && (((uintptr_t) pSrcA & 2u) != 0u))
+  {
+    sum += (q63_t) ((q31_t) * pSrcA++ * *pSrcB++);
+    numSamples--;
+  }
 
   /*loop Unrolling */
-  blkCnt = blockSize >> 1u;
+  blkCnt = numSamples >> 1u;
 
-  while (blkCnt > 0u)
+  if(((uintptr_t) pSrcB & 2u) == 0u)
   {
-    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
-    /*read 2 elements from each buffer */
-    VectInA =  (shortV*)pSrcA;
-    VectInB =  (shortV*)pSrcB;
-    /*increment source buffers */
-    pSrcA+=2;
-    pSrcB+=2;
-    /*dotpv2 to perform dot product, then accumulate the sum*/
-    sum += dotpv2(*VectInA, *VectInB);
-
-    /* Decrement the loop counter */
-    blkCnt--;
+    while (blkCnt > 0u)
+    {
+      /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+      /*dotpv2 to perform dot product of 2 elements of each buffer, then accumulate the sum*/
+      sum += dotpv2(*(shortV *) pSrcA, *(shortV *) pSrcB);
+      pSrcA += 2;
+      pSrcB += 2;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else if(blkCnt > 0u)
+  {
+    /* pSrcB is one sample past a word boundary, each pair is built from two aligned loads */
+    lo = *(shortV *) (pSrcB - 1);
+
+    while (blkCnt > 0u)
+    {
+      hi = *(shortV *) (pSrcB + 1);
+      sum += dotpv2(*(shortV *) pSrcA, shufflev4(lo, hi, odd));
+      lo = hi;
+      pSrcA += 2;
+      pSrcB += 2;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
   }
 
-  blkCnt = blockSize % 0x2u;
+  blkCnt = numSamples % 0x2u;
  /*the remaning sample if vector size is odd*/
   while (blkCnt > 0u) 
   {
@@ -75,6 +75,7 @@ void riscv_dot_prod_q31(
   uint32_t blockSize,
   q63_t * result)
 {
+  RISCV_PROFILE(riscv_dot_prod_q31);
   q63_t sum = 0;                                 /* Temporary result storage */
   uint32_t blkCnt;                               /* loop counter */
 
@@ -66,6 +66,12 @@
  * Nonsaturating additions are used and there is no danger of wrap around as long as    
  * the vectors are less than 2^18 elements long.    
  * The return result is in 18.14 format.    
+ *
+ * \par
+ * With the xpulp extensions up to three products align <code>pSrcA</code> to a word, and the samples of
+ * <code>pSrcB</code> at any byte offset are taken from aligned word loads with one shuffle, so no load is
+ * misaligned.  The aligned loads may read the other bytes of the words holding the first and last sample
+ * of <code>pSrcB</code>.
  */
 
 void riscv_dot_prod_q7(
@@ -74,36 +80,65 @@ void riscv_dot_prod_q7(
   uint32_t blockSize,
   q31_t * result)
 {
+  RISCV_PROFILE(riscv_dot_prod_q7);
   uint32_t blkCnt;                               /* loop counter */
 
   q31_t sum = 0;                                 /* Temporary variables to store output */
 
 #if defined (USE_DSP_RISCV)
 
-  charV *VectInA;
-  charV *VectInB;
+  uint32_t numSamples = blockSize;               /* Samples left */
+  uint32_t offset;                               /* Byte offset of pSrcB in its word */
+  charV lo, hi, sel;                             /* Aligned words of pSrcB and the bytes to take */
+
+  /* Up to three products until pSrcA is word aligned */
+  while((numSamples > 0u) && (((uintptr_t) pSrcA & 3u) != 0u))
+  {
+    sum = mac(*pSrcA++, *pSrcB++, sum);
+    numSamples--;
+  }
 
   /*loop Unrolling */
-  blkCnt = blockSize >> 2u;
-  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
-   ** a second loop below computes the remaining 1 to 3 samples. */
-  while (blkCnt > 0u)
+  blkCnt = numSamples >> 2u;
+  offset = (uintptr_t) pSrcB & 3u;
+
+  if(offset == 0u)
   {
-    /*read 4 elements from each buffer*/
-    VectInA =  (charV*)pSrcA;
-    VectInB =  (charV*)pSrcB;
-    /*increment source buffers*/
-    pSrcA+=4;
-    pSrcB+=4;
-    /* sumdotpv4 to perform dot product for the 4 pairs and accumulate the sum */
-    sum = sumdotpv4(*VectInA, *VectInB, sum);
-    /*decrement loop counter*/
-    blkCnt--;
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while (blkCnt > 0u)
+    {
+      /* sumdotpv4 to perform dot product for the 4 pairs and accumulate the sum */
+      sum = sumdotpv4(*(charV *) pSrcA, *(charV *) pSrcB, sum);
+      pSrcA += 4;
+      pSrcB += 4;
+
+      /*decrement loop counter*/
+      blkCnt--;
+    }
+  }
+  else if(blkCnt > 0u)
+  {
+    /* Each four samples of pSrcB are bytes offset to offset+3 of two aligned words */
+    sel = pack4(offset, offset + 1u, offset + 2u, offset + 3u);
+    lo = *(charV *) (pSrcB - offset);
+
+    while (blkCnt > 0u)
+    {
+      hi = *(charV *) (pSrcB - offset + 4);
+      sum = sumdotpv4(*(charV *) pSrcA, shuffle2b(lo, hi, sel), sum);
+      lo = hi;
+      pSrcA += 4;
+      pSrcB += 4;
+
+      /*decrement loop counter*/
+      blkCnt--;
+    }
   }
 
   /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
    ** No loop unrolling is used. */
-  blkCnt = blockSize % 0x4u;
+  blkCnt = numSamples % 0x4u;
 
   while (blkCnt > 0u)
   {
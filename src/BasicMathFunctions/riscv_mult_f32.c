@@ -78,6 +78,7 @@ void riscv_mult_f32(
   float32_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_mult_f32);
   uint32_t blkCnt;                               /* loop counters */
 
   blkCnt = blockSize;
@@ -72,6 +72,7 @@ void riscv_mult_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_mult_q15);
   uint32_t blkCnt;                               /* loop counters */
 
 #if defined (USE_DSP_RISCV)
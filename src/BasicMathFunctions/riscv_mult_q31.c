@@ -71,8 +71,35 @@ void riscv_mult_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_mult_q31);
   uint32_t blkCnt;                               /* loop counters */
+
+#if defined (USE_DSP_RISCV)
+  q31_t out1, out2;                              /* Products in 1.31 format */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+  while(blkCnt > 0u)
+  {
+    /* C = A * B */
+    out1 = (q31_t) (((q63_t) pSrcA[0] * pSrcB[0]) >> 31);
+    out2 = (q31_t) (((q63_t) pSrcA[1] * pSrcB[1]) >> 31);
+    pSrcA += 2;
+    pSrcB += 2;
+
+    /* Only 0x80000000 * 0x80000000 overflows, its product wraps to 0x80000000 which no other inputs give */
+    *pDst++ = (out1 == INT32_MIN) ? INT32_MAX : out1;
+    *pDst++ = (out2 == INT32_MIN) ? INT32_MAX : out2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+#else
   blkCnt = blockSize;
+#endif
+
   while (blkCnt > 0u)
   {
     /* C = A * B */
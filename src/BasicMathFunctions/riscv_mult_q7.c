@@ -59,6 +59,7 @@ void riscv_mult_q7(
   q7_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_mult_q7);
   uint32_t blkCnt;                               /* loop counters */
 
 #if defined (USE_DSP_RISCV)
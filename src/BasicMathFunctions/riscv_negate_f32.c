@@ -78,6 +78,7 @@ void riscv_negate_f32(
   float32_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_negate_f32);
   uint32_t blkCnt;                               /* loop counter */
 
   /* Initialize blkCnt with number of samples */
@@ -72,6 +72,7 @@ void riscv_negate_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_negate_q15);
   uint32_t blkCnt;                               /* loop counter */
   q15_t in;
   /* Initialize blkCnt with number of samples */
@@ -69,11 +69,34 @@ void riscv_negate_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_negate_q31);
   q31_t in;                                      /* Temporary variable */
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (USE_DSP_RISCV)
+  q31_t in2;                                     /* Temporary variable */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+  while(blkCnt > 0u)
+  {
+    /* C = -A */
+    in = *pSrc++;
+    in2 = *pSrc++;
+
+    /* -0x80000000 wraps to 0x80000000, subtracting the comparison gives 0x7FFFFFFF without a branch */
+    *pDst++ = (q31_t) ((0u - (uint32_t) in) - (uint32_t) (in == INT32_MIN));
+    *pDst++ = (q31_t) ((0u - (uint32_t) in2) - (uint32_t) (in2 == INT32_MIN));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+#else
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
+#endif
 
   while(blkCnt > 0u)
   {
@@ -68,6 +68,7 @@ void riscv_negate_q7(
   q7_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_negate_q7);
   uint32_t blkCnt;                               /* loop counter */
   q7_t in;
 
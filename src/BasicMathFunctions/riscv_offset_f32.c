@@ -80,6 +80,7 @@ void riscv_offset_f32(
   float32_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_offset_f32);
   uint32_t blkCnt;                               /* loop counter */
 
   /* Initialize blkCnt with number of samples */
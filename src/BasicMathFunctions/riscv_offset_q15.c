@@ -71,6 +71,7 @@ void riscv_offset_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_offset_q15);
   uint32_t blkCnt;                               /* loop counter */
 
 #if defined (USE_DSP_RISCV)
@@ -71,10 +71,35 @@ void riscv_offset_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_offset_q31);
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (USE_DSP_RISCV)
+  q31_t in1, in2, out1, out2;                    /* Inputs and wrapped 32-bit sums */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+  while(blkCnt > 0u)
+  {
+    /* C = A + offset */
+    in1 = *pSrc++;
+    in2 = *pSrc++;
+    out1 = (q31_t) ((uint32_t) in1 + (uint32_t) offset);
+    out2 = (q31_t) ((uint32_t) in2 + (uint32_t) offset);
+
+    /* The sum overflowed if its sign differs from the signs of both operands */
+    *pDst++ = (((in1 ^ out1) & (offset ^ out1)) < 0) ? (0x7FFFFFFF ^ (in1 >> 31)) : out1;
+    *pDst++ = (((in2 ^ out2) & (offset ^ out2)) < 0) ? (0x7FFFFFFF ^ (in2 >> 31)) : out2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+#else
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
+#endif
 
   while(blkCnt > 0u)
   {
@@ -71,6 +71,7 @@ void riscv_offset_q7(
   q7_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_offset_q7);
   uint32_t blkCnt;                               /* loop counter */
 
 #if defined (USE_DSP_RISCV)
@@ -94,6 +94,7 @@ void riscv_scale_f32(
   float32_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_scale_f32);
   uint32_t blkCnt;                               /* loop counter */
 
   /* Initialize blkCnt with number of samples */
@@ -74,6 +74,8 @@ void riscv_scale_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_scale_q15);
+  RISCV_SAT_STATS(riscv_scale_q15, 16);
   int kShift = 15 - shift;                    /* shift to apply after scaling */
   uint32_t blkCnt;                               /* loop counter */
 
@@ -85,7 +87,7 @@ void riscv_scale_q15(
   while (blkCnt > 0u)
   {
     /*multiply by scale then shift and saturate*/
-    *pDst++ =  (q15_t)clip((((q31_t) (*pSrc++) *scaleFract ) >> kShift),-32768,32767);
+    *pDst++ =  (q15_t)clip(RISCV_SAT(((q31_t) (*pSrc++) *scaleFract ) >> kShift),-32768,32767);
     blkCnt--;
   }
 
@@ -98,7 +100,7 @@ void riscv_scale_q15(
   {
     /* C = A * scale */
     /* Scale the input and then store the result in the destination buffer. */
-    *pDst++ = (q15_t) (__SSAT(((q31_t) * pSrc++ * scaleFract) >> kShift, 16));
+    *pDst++ = (q15_t) (__SSAT(RISCV_SAT(((q31_t) * pSrc++ * scaleFract) >> kShift), 16));
 
     /* Decrement the loop counter */
     blkCnt--;
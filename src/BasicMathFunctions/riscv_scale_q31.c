@@ -73,12 +73,15 @@ void riscv_scale_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_scale_q31);
+  RISCV_SAT_STATS(riscv_scale_q31, 32);
   int8_t kShift = shift + 1;                     /* Shift to apply after scaling */
   int8_t sign = (kShift & 0x80);
   uint32_t blkCnt;                               /* loop counter */
   q31_t in, out;
-
-
+#if defined (USE_DSP_RISCV)
+  q31_t in2, out2;
+#endif
 
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
@@ -86,6 +89,30 @@ void riscv_scale_q31(
 
   if(sign == 0)
   {
+#if defined (USE_DSP_RISCV)
+	  /*loop Unrolling */
+	  blkCnt = blockSize >> 1u;
+	  while(blkCnt > 0u)
+	  {
+		/* C = A * scale, two samples per iteration */
+		in = (q31_t) (((q63_t) pSrc[0] * scaleFract) >> 32);
+		in2 = (q31_t) (((q63_t) pSrc[1] * scaleFract) >> 32);
+		pSrc += 2;
+
+		out = (q31_t) ((uint32_t) in << kShift);
+		out2 = (q31_t) ((uint32_t) in2 << kShift);
+		(void) RISCV_SAT((q63_t) in << kShift);
+		(void) RISCV_SAT((q63_t) in2 << kShift);
+
+		*pDst++ = (in != (out >> kShift)) ? (0x7FFFFFFF ^ (in >> 31)) : out;
+		*pDst++ = (in2 != (out2 >> kShift)) ? (0x7FFFFFFF ^ (in2 >> 31)) : out2;
+
+		/* Decrement the loop counter */
+		blkCnt--;
+	  }
+
+	  blkCnt = blockSize % 0x2u;
+#endif
 	  while(blkCnt > 0u)
 	  {
 		/* C = A * scale */
@@ -94,6 +121,7 @@ void riscv_scale_q31(
 		in = ((q63_t) in * scaleFract) >> 32;
 
 		out = in << kShift;
+		(void) RISCV_SAT((q63_t) in << kShift);
 		
 		if(in != (out >> kShift))
 			out = 0x7FFFFFFF ^ (in >> 31);
@@ -106,6 +134,25 @@ void riscv_scale_q31(
   }
   else
   {
+#if defined (USE_DSP_RISCV)
+	  /*loop Unrolling */
+	  blkCnt = blockSize >> 1u;
+	  while(blkCnt > 0u)
+	  {
+		/* C = A * scale, two samples per iteration */
+		in = (q31_t) (((q63_t) pSrc[0] * scaleFract) >> 32);
+		in2 = (q31_t) (((q63_t) pSrc[1] * scaleFract) >> 32);
+		pSrc += 2;
+
+		*pDst++ = in >> -kShift;
+		*pDst++ = in2 >> -kShift;
+
+		/* Decrement the loop counter */
+		blkCnt--;
+	  }
+
+	  blkCnt = blockSize % 0x2u;
+#endif
 	  while(blkCnt > 0u)
 	  {
 		/* C = A * scale */
@@ -71,6 +71,8 @@ void riscv_shift_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_shift_q15);
+  RISCV_SAT_STATS(riscv_shift_q15, 16);
   uint32_t blkCnt;                               /* loop counter */
   uint8_t sign;                                  /* Sign of shiftBits */
 
@@ -89,8 +91,8 @@ void riscv_shift_q15(
     {
       /* C = A << shiftBits */
       /* Shift the input and then store the result in the destination buffer. */
-      *pDst++ = (q15_t) clip(((q31_t) * pSrc++ << shiftBits), -32768 , 32767);
-      *pDst++ = (q15_t) clip(((q31_t) * pSrc++ << shiftBits), -32768 , 32767);
+      *pDst++ = (q15_t) clip(RISCV_SAT((q31_t) * pSrc++ << shiftBits), -32768 , 32767);
+      *pDst++ = (q15_t) clip(RISCV_SAT((q31_t) * pSrc++ << shiftBits), -32768 , 32767);
       /* Decrement the loop counter */
       blkCnt--;
     }
@@ -130,7 +132,7 @@ void riscv_shift_q15(
     {
       /* C = A << shiftBits */
       /* Shift and then store the results in the destination buffer. */
-      *pDst++ = __SSAT(((q31_t) * pSrc++ << shiftBits), 16);
+      *pDst++ = __SSAT(RISCV_SAT((q31_t) * pSrc++ << shiftBits), 16);
 
       /* Decrement the loop counter */
       blkCnt--;
@@ -89,16 +89,63 @@ void riscv_shift_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_shift_q31);
+  RISCV_SAT_STATS(riscv_shift_q31, 32);
   uint32_t blkCnt;                               /* loop counter */
   uint8_t sign = (shiftBits & 0x80);             /* Sign of shiftBits */
 
+#if defined (USE_DSP_RISCV)
+  q31_t in1, in2, out1, out2;                    /* Input and shifted values */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  if(sign == 0u)
+  {
+    while(blkCnt > 0u)
+    {
+      /* C = A << shiftBits */
+      in1 = *pSrc++;
+      in2 = *pSrc++;
+      out1 = (q31_t) ((uint32_t) in1 << shiftBits);
+      out2 = (q31_t) ((uint32_t) in2 << shiftBits);
+      (void) RISCV_SAT((q63_t) in1 << shiftBits);
+      (void) RISCV_SAT((q63_t) in2 << shiftBits);
+
+      /* Saturate when shifting back does not restore the input */
+      *pDst++ = (in1 != (out1 >> shiftBits)) ? (0x7FFFFFFF ^ (in1 >> 31)) : out1;
+      *pDst++ = (in2 != (out2 >> shiftBits)) ? (0x7FFFFFFF ^ (in2 >> 31)) : out2;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while(blkCnt > 0u)
+    {
+      /* C = A >> -shiftBits */
+      in1 = *pSrc++;
+      in2 = *pSrc++;
+      *pDst++ = in1 >> -shiftBits;
+      *pDst++ = in2 >> -shiftBits;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  blkCnt = blockSize % 0x2u;
+#else
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
+#endif
+
   while(blkCnt > 0u)
   {
     /* C = A (>> or <<) shiftBits */
     /* Shift the input and then store the result in the destination buffer. */
-    *pDst++ = (sign == 0u) ? clip_q63_to_q31((q63_t) * pSrc++ << shiftBits) :
+    *pDst++ = (sign == 0u) ? clip_q63_to_q31(RISCV_SAT((q63_t) * pSrc++ << shiftBits)) :
       (*pSrc++ >> -shiftBits);
 
     /* Decrement the loop counter */
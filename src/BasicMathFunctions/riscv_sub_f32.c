@@ -79,6 +79,7 @@ void riscv_sub_f32(
   float32_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_sub_f32);
   uint32_t blkCnt;                               /* loop counter */
 
 
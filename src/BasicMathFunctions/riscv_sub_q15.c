@@ -71,6 +71,8 @@ void riscv_sub_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_sub_q15);
+  RISCV_SAT_STATS(riscv_sub_q15, 16);
   uint32_t blkCnt;                               /* loop counter */
 
 
@@ -89,8 +91,8 @@ void riscv_sub_q15(
     inB1 = *pSrcB++;
     inB2 = *pSrcB++;
     /*subract then saturate*/
-    *pDst++ =(q15_t)clip((inA1 - inB1),-32768,32767);
-    *pDst++ =(q15_t)clip((inA2 - inB2),-32768,32767);
+    *pDst++ =(q15_t)clip(RISCV_SAT(inA1 - inB1),-32768,32767);
+    *pDst++ =(q15_t)clip(RISCV_SAT(inA2 - inB2),-32768,32767);
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -102,7 +104,7 @@ void riscv_sub_q15(
   {
     /* C = A + B */
     /* Add and then store the results in the destination buffer. */
-    *pDst++ = (q15_t)clip((*pSrcA++ - *pSrcB++),-32768,32767);
+    *pDst++ = (q15_t)clip(RISCV_SAT(*pSrcA++ - *pSrcB++),-32768,32767);
     /* Decrement the loop counter */
     blkCnt--;
   }
@@ -117,7 +119,7 @@ void riscv_sub_q15(
   {
     /* C = A - B */
     /* Subtract and then store the result in the destination buffer. */
-    *pDst++ = (q15_t) __SSAT(((q31_t) * pSrcA++ - *pSrcB++), 16);
+    *pDst++ = (q15_t) __SSAT(RISCV_SAT((q31_t) * pSrcA++ - *pSrcB++), 16);
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -71,16 +71,48 @@ void riscv_sub_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_sub_q31);
+  RISCV_SAT_STATS(riscv_sub_q31, 32);
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (USE_DSP_RISCV)
+  q31_t inA1, inA2, inB1, inB2;                  /* Input values */
+  q31_t diff1, diff2;                            /* Wrapped 32-bit differences */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+  while(blkCnt > 0u)
+  {
+    /* C = A - B */
+    /* read 2 elements from each buffer */
+    inA1 = *pSrcA++;
+    inA2 = *pSrcA++;
+    inB1 = *pSrcB++;
+    inB2 = *pSrcB++;
+
+    /* Subtract in 32 bits, only inputs of different signs can overflow */
+    diff1 = (q31_t) ((uint32_t) inA1 - (uint32_t) inB1);
+    diff2 = (q31_t) ((uint32_t) inA2 - (uint32_t) inB2);
+    (void) RISCV_SAT((q63_t) inA1 - inB1);
+    (void) RISCV_SAT((q63_t) inA2 - inB2);
+    *pDst++ = (((inA1 ^ inB1) & (inA1 ^ diff1)) < 0) ? (0x7FFFFFFF ^ (inA1 >> 31)) : diff1;
+    *pDst++ = (((inA2 ^ inB2) & (inA2 ^ diff2)) < 0) ? (0x7FFFFFFF ^ (inA2 >> 31)) : diff2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+#else
   /* Initialize blkCnt with number of samples */
   blkCnt = blockSize;
+#endif
 
   while(blkCnt > 0u)
   {
     /* C = A - B */
     /* Subtract and then store the result in the destination buffer. */
-    *pDst++ = (q31_t) clip_q63_to_q31((q63_t) * pSrcA++ - *pSrcB++);
+    *pDst++ = (q31_t) clip_q63_to_q31(RISCV_SAT((q63_t) * pSrcA++ - *pSrcB++));
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_threshold_f32.c
+*
+* Description:  Floating-point vector threshold.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @defgroup BasicThreshold Vector Threshold
+ *
+ * Keeps the elements of a vector that are above a threshold and replaces the others by a
+ * fill value:
+ *
+ * <pre>
+ *     pDst[n] = (pSrc[n] > threshold) ? pSrc[n] : fill,   0 <= n < blockSize.
+ * </pre>
+ *
+ * With <code>threshold = fill = 0</code> this is a rectifier (ReLU), with
+ * <code>fill = 0</code> a noise gate on a magnitude, with <code>fill = threshold</code> the lower
+ * half of riscv_clip_f32().  A binary decision is the mask of riscv_cmp_range_mask_f32().
+ *
+ * The xpulp paths of the Q7 and Q15 functions compare four or two elements at a time, the
+ * comparison gives all ones or all zeros per lane and selects between the element and the fill
+ * value with an and and an or, without a branch.
+ *
+ * <code>pDst</code> may point to the same buffer as <code>pSrc</code>.
+ * There are separate functions for floating-point, Q7, Q15, and Q31 data types.
+ */
+
+/**
+ * @addtogroup BasicThreshold
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector threshold.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       threshold elements greater than threshold are kept
+ * @param[in]       fill value of the other elements
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ */
+
+void riscv_threshold_f32(
+  float32_t * pSrc,
+  float32_t threshold,
+  float32_t fill,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_threshold_f32);
+  float32_t in;                                  /* Input value */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* C = (A > threshold) ? A : fill */
+    in = *pSrc++;
+    *pDst++ = (in > threshold) ? in : fill;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BasicThreshold group
+ */
@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_threshold_q15.c
+*
+* Description:  Q15 vector threshold.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicThreshold
+ * @{
+ */
+
+/**
+ * @brief Q15 vector threshold.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       threshold elements greater than threshold are kept
+ * @param[in]       fill value of the other elements
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ */
+
+void riscv_threshold_q15(
+  q15_t * pSrc,
+  q15_t threshold,
+  q15_t fill,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_threshold_q15);
+  q15_t in;                                      /* Input value */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+
+  shortV thresholdV = pack2(threshold, threshold);   /* Threshold and fill in both lanes */
+  shortV fillV = pack2(fill, fill);
+  shortV VectIn, keep;
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* All ones in the lanes above the threshold, pv.cmpgt.h */
+    VectIn = *(shortV *) pSrc;
+    keep = (VectIn > thresholdV);
+    *(shortV *) pDst = (VectIn & keep) | (fillV & ~keep);
+    pSrc += 2;
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* C = (A > threshold) ? A : fill */
+    in = *pSrc++;
+    *pDst++ = (in > threshold) ? in : fill;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BasicThreshold group
+ */
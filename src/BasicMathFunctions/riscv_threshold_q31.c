@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_threshold_q31.c
+*
+* Description:  Q31 vector threshold.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicThreshold
+ * @{
+ */
+
+/**
+ * @brief Q31 vector threshold.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       threshold elements greater than threshold are kept
+ * @param[in]       fill value of the other elements
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ */
+
+void riscv_threshold_q31(
+  q31_t * pSrc,
+  q31_t threshold,
+  q31_t fill,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_threshold_q31);
+  q31_t in1, in2;                                /* Input values */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = (A > threshold) ? A : fill */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    pDst[0] = (in1 > threshold) ? in1 : fill;
+    pDst[1] = (in2 > threshold) ? in2 : fill;
+    pSrc += 2;
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = (A > threshold) ? A : fill */
+    in1 = *pSrc++;
+    *pDst++ = (in1 > threshold) ? in1 : fill;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BasicThreshold group
+ */
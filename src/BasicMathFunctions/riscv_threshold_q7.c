@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_threshold_q7.c
+*
+* Description:  Q7 vector threshold.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicThreshold
+ * @{
+ */
+
+/**
+ * @brief Q7 vector threshold.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       threshold elements greater than threshold are kept
+ * @param[in]       fill value of the other elements
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ *
+ * \par Conditions for optimum performance
+ *  Input and output buffers should be aligned by 32-bit
+ */
+
+void riscv_threshold_q7(
+  q7_t * pSrc,
+  q7_t threshold,
+  q7_t fill,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_threshold_q7);
+  q7_t in;                                      /* Input value */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+
+  charV thresholdV = pack4(threshold, threshold, threshold, threshold);  /* Threshold and fill in all lanes */
+  charV fillV = pack4(fill, fill, fill, fill);
+  charV VectIn, keep;
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* All ones in the lanes above the threshold, pv.cmpgt.b */
+    VectIn = *(charV *) pSrc;
+    keep = (VectIn > thresholdV);
+    *(charV *) pDst = (VectIn & keep) | (fillV & ~keep);
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* C = (A > threshold) ? A : fill */
+    in = *pSrc++;
+    *pDst++ = (in > threshold) ? in : fill;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BasicThreshold group
+ */
@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_vmac_f32.c
+*
+* Description:  Floating-point vector multiply-add.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @defgroup BasicVMac Vector Multiply-Add
+ *
+ * Element-by-element multiplication of two vectors followed by the addition of a third one.
+ *
+ * <pre>
+ *     pDst[n] = pSrcA[n] * pSrcB[n] + pSrcC[n],   0 <= n < blockSize.
+ * </pre>
+ *
+ * The functions replace riscv_mult_f32() followed by riscv_add_f32() and their fixed-point
+ * counterparts: the product is not stored in a temporary buffer and every vector is read once.
+ * The fixed-point versions saturate only the final sum, the product keeps the precision of
+ * the corresponding riscv_mult function before the truncation.
+ *
+ * <code>pDst</code> may point to the same buffer as <code>pSrcC</code> for an in-place accumulation.
+ * There are separate functions for floating-point, Q7, Q15, and Q31 data types.
+ */
+
+/**
+ * @addtogroup BasicVMac
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector multiply-add.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       *pSrcC points to the vector that is added to the product
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ */
+
+void riscv_vmac_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pSrcC,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_vmac_f32);
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* D = A * B + C */
+    *pDst++ = ((*pSrcA++) * (*pSrcB++)) + (*pSrcC++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BasicVMac group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_vmac_q15.c
+*
+* Description:  Q15 vector multiply-add.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicVMac
+ * @{
+ */
+
+/**
+ * @brief Q15 vector multiply-add.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       *pSrcC points to the vector that is added to the product
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 2.30 product is truncated to 2.15 format, as in riscv_mult_q15(), then <code>pSrcC</code>
+ * is added and the sum is saturated to 1.15 format.
+ * With the DSP extension the product and the shift are a single <code>p.mulsN</code>.
+ */
+
+void riscv_vmac_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pSrcC,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_vmac_q15);
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+  q31_t out1, out2;                              /* Sums in 17.15 format */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+  while(blkCnt > 0u)
+  {
+    /* D = A * B + C */
+    out1 = mulsN(pSrcA[0], pSrcB[0], 15) + pSrcC[0];
+    out2 = mulsN(pSrcA[1], pSrcB[1], 15) + pSrcC[1];
+    pSrcA += 2;
+    pSrcB += 2;
+    pSrcC += 2;
+
+    *pDst++ = (q15_t) clip(out1, -32768, 32767);
+    *pDst++ = (q15_t) clip(out2, -32768, 32767);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+
+  while(blkCnt > 0u)
+  {
+    /* D = A * B + C */
+    *pDst++ = (q15_t) clip(mulsN(*pSrcA++, *pSrcB++, 15) + *pSrcC++, -32768, 32767);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* D = A * B + C */
+    *pDst++ = (q15_t) __SSAT((((q31_t) (*pSrcA++) * (*pSrcB++)) >> 15) + *pSrcC++, 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+#endif
+}
+
+/**
+ * @} end of BasicVMac group
+ */
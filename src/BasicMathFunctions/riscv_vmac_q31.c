@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_vmac_q31.c
+*
+* Description:  Q31 vector multiply-add.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicVMac
+ * @{
+ */
+
+/**
+ * @brief Q31 vector multiply-add.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       *pSrcC points to the vector that is added to the product
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 2.62 product is truncated to 2.31 format, as in riscv_mult_q31(), then <code>pSrcC</code>
+ * is added and the sum is saturated to 1.31 format.
+ */
+
+void riscv_vmac_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pSrcC,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_vmac_q31);
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+  q63_t acc1, acc2;                              /* Sums in 33.31 format */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+  while(blkCnt > 0u)
+  {
+    /* D = A * B + C, the upper words of the two products are formed with mulh */
+    acc1 = (((q63_t) pSrcA[0] * pSrcB[0]) >> 31) + pSrcC[0];
+    acc2 = (((q63_t) pSrcA[1] * pSrcB[1]) >> 31) + pSrcC[1];
+    pSrcA += 2;
+    pSrcB += 2;
+    pSrcC += 2;
+
+    *pDst++ = clip_q63_to_q31(acc1);
+    *pDst++ = clip_q63_to_q31(acc2);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+#else
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* D = A * B + C */
+    *pDst++ = clip_q63_to_q31((((q63_t) (*pSrcA++) * (*pSrcB++)) >> 31) + *pSrcC++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BasicVMac group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_vmac_q7.c
+*
+* Description:  Q7 vector multiply-add.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup BasicVMac
+ * @{
+ */
+
+/**
+ * @brief Q7 vector multiply-add.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       *pSrcC points to the vector that is added to the product
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 2.14 product is truncated to 2.7 format, as in riscv_mult_q7(), then <code>pSrcC</code>
+ * is added and the sum is saturated to 1.7 format.
+ * With the DSP extension the product and the shift are a single <code>p.mulsN</code>.
+ */
+
+void riscv_vmac_q7(
+  q7_t * pSrcA,
+  q7_t * pSrcB,
+  q7_t * pSrcC,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_vmac_q7);
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+  q31_t out1, out2;                              /* Sums in 25.7 format */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+  while(blkCnt > 0u)
+  {
+    /* D = A * B + C */
+    out1 = mulsN(pSrcA[0], pSrcB[0], 7) + pSrcC[0];
+    out2 = mulsN(pSrcA[1], pSrcB[1], 7) + pSrcC[1];
+    pSrcA += 2;
+    pSrcB += 2;
+    pSrcC += 2;
+
+    *pDst++ = (q7_t) clip(out1, -128, 127);
+    *pDst++ = (q7_t) clip(out2, -128, 127);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+
+  while(blkCnt > 0u)
+  {
+    /* D = A * B + C */
+    *pDst++ = (q7_t) clip(mulsN(*pSrcA++, *pSrcB++, 7) + *pSrcC++, -128, 127);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* D = A * B + C */
+    *pDst++ = (q7_t) __SSAT((((q15_t) (*pSrcA++) * (*pSrcB++)) >> 7) + *pSrcC++, 8);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+#endif
+}
+
+/**
+ * @} end of BasicVMac group
+ */
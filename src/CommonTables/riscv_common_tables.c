@@ -79,7 +79,7 @@
 /*    
 * @brief  Table for bit reversal process    
 */
-const uint16_t riscvBitRevTable[1024] = {
+const uint16_t riscvBitRevTable[1024] RISCV_DSP_FASTDATA(BITREV, riscvBitRevTable) = {
    0x400, 0x200, 0x600, 0x100, 0x500, 0x300, 0x700, 0x80, 0x480, 0x280, 
    0x680, 0x180, 0x580, 0x380, 0x780, 0x40, 0x440, 0x240, 0x640, 0x140, 
    0x540, 0x340, 0x740, 0xc0, 0x4c0, 0x2c0, 0x6c0, 0x1c0, 0x5c0, 0x3c0, 
@@ -205,7 +205,9 @@ const uint16_t riscvBitRevTable[1024] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_16[32] = {
+/* Replaced by the generated riscv_fft_tables.c of the lengths of RISCV_DSP_FFT_SIZES */
+#if !defined (RISCV_DSP_FFT_TABLES_GENERATED)
+const float32_t twiddleCoef_16[32] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_16) = {
     1.000000000f,  0.000000000f,
     0.923879533f,  0.382683432f,
     0.707106781f,  0.707106781f,
@@ -239,7 +241,7 @@ const float32_t twiddleCoef_16[32] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_32[64] = {
+const float32_t twiddleCoef_32[64] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_32) = {
     1.000000000f,  0.000000000f,
     0.980785280f,  0.195090322f,
     0.923879533f,  0.382683432f,
@@ -289,7 +291,7 @@ const float32_t twiddleCoef_32[64] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_64[128] = {
+const float32_t twiddleCoef_64[128] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_64) = {
     1.000000000f,  0.000000000f,
     0.995184727f,  0.098017140f,
     0.980785280f,  0.195090322f,
@@ -372,7 +374,7 @@ const float32_t twiddleCoef_64[128] = {
 *     
 */
 
-const float32_t twiddleCoef_128[256] = {
+const float32_t twiddleCoef_128[256] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_128) = {
     1.000000000f	,	0.000000000f	,
     0.998795456f	,	0.049067674f	,
     0.995184727f	,	0.098017140f	,
@@ -518,7 +520,7 @@ const float32_t twiddleCoef_128[256] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_256[512] = {
+const float32_t twiddleCoef_256[512] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_256) = {
     1.000000000f,  0.000000000f,
     0.999698819f,  0.024541229f,
     0.998795456f,  0.049067674f,
@@ -792,7 +794,7 @@ const float32_t twiddleCoef_256[512] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_512[1024] = {
+const float32_t twiddleCoef_512[1024] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_512) = {
     1.000000000f,  0.000000000f,
     0.999924702f,  0.012271538f,
     0.999698819f,  0.024541229f,
@@ -1321,7 +1323,7 @@ const float32_t twiddleCoef_512[1024] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_1024[2048] = {
+const float32_t twiddleCoef_1024[2048] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_1024) = {
 1.000000000f	,	0.000000000f	,
 0.999981175f	,	0.006135885f	,
 0.999924702f	,	0.012271538f	,
@@ -2363,7 +2365,7 @@ const float32_t twiddleCoef_1024[2048] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_2048[4096] = {
+const float32_t twiddleCoef_2048[4096] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_2048) = {
     1.000000000f,  0.000000000f,
     0.999995294f,  0.003067957f,
     0.999981175f,  0.006135885f,
@@ -4429,7 +4431,7 @@ const float32_t twiddleCoef_2048[4096] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_4096[8192] = {
+const float32_t twiddleCoef_4096[8192] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_4096) = {
     1.000000000f,  0.000000000f,
     0.999998823f,  0.001533980f,
     0.999995294f,  0.003067957f,
@@ -8551,7 +8553,7 @@ const float32_t twiddleCoef_4096[8192] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_16_q31[24] = {
+const q31_t twiddleCoef_16_q31[24] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_16_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7641AF3C, 0x30FBC54D,
     0x5A82799A, 0x5A82799A,
@@ -8584,7 +8586,7 @@ const q31_t twiddleCoef_16_q31[24] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_32_q31[48] = {
+const q31_t twiddleCoef_32_q31[48] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_32_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7D8A5F3F, 0x18F8B83C,
     0x7641AF3C, 0x30FBC54D,
@@ -8629,7 +8631,7 @@ const q31_t twiddleCoef_32_q31[48] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_64_q31[96] = {
+const q31_t twiddleCoef_64_q31[96] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_64_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7F62368F, 0x0C8BD35E,
     0x7D8A5F3F, 0x18F8B83C,
@@ -8698,7 +8700,7 @@ const q31_t twiddleCoef_64_q31[96] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_128_q31[192] = {
+const q31_t twiddleCoef_128_q31[192] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_128_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7FD8878D, 0x0647D97C,
     0x7F62368F, 0x0C8BD35E,
@@ -8815,7 +8817,7 @@ const q31_t twiddleCoef_128_q31[192] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_256_q31[384] = {
+const q31_t twiddleCoef_256_q31[384] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_256_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7FF62182, 0x03242ABF,
     0x7FD8878D, 0x0647D97C,
@@ -9028,7 +9030,7 @@ const q31_t twiddleCoef_256_q31[384] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_512_q31[768] = {
+const q31_t twiddleCoef_512_q31[768] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_512_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7FFD885A, 0x01921D1F,
     0x7FF62182, 0x03242ABF,
@@ -9433,7 +9435,7 @@ const q31_t twiddleCoef_512_q31[768] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_1024_q31[1536] = {
+const q31_t twiddleCoef_1024_q31[1536] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_1024_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7FFF6216, 0x00C90F88,
     0x7FFD885A, 0x01921D1F,
@@ -10222,7 +10224,7 @@ const q31_t twiddleCoef_1024_q31[1536] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_2048_q31[3072] = {
+const q31_t twiddleCoef_2048_q31[3072] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_2048_q31) = {
     0x7FFFFFFF, 0x00000000,
     0x7FFFD885, 0x006487E3,
     0x7FFF6216, 0x00C90F88,
@@ -11779,7 +11781,7 @@ const q31_t twiddleCoef_2048_q31[3072] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_4096_q31[6144] = 
+const q31_t twiddleCoef_4096_q31[6144] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_4096_q31) = 
 {
     0x7FFFFFFF, 0x00000000,
     0x7FFFF621, 0x003243F5,
@@ -14880,7 +14882,7 @@ const q31_t twiddleCoef_4096_q31[6144] =
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_16_q15[24] = {
+const q15_t twiddleCoef_16_q15[24] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_16_q15) = {
     0x7FFF, 0x0000,
     0x7641, 0x30FB,
     0x5A82, 0x5A82,
@@ -14913,7 +14915,7 @@ const q15_t twiddleCoef_16_q15[24] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_32_q15[48] = {
+const q15_t twiddleCoef_32_q15[48] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_32_q15) = {
     0x7FFF, 0x0000,
     0x7D8A, 0x18F8,
     0x7641, 0x30FB,
@@ -14958,7 +14960,7 @@ const q15_t twiddleCoef_32_q15[48] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_64_q15[96] = {
+const q15_t twiddleCoef_64_q15[96] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_64_q15) = {
     0x7FFF, 0x0000,
     0x7F62, 0x0C8B,
     0x7D8A, 0x18F8,
@@ -15027,7 +15029,7 @@ const q15_t twiddleCoef_64_q15[96] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_128_q15[192] = {
+const q15_t twiddleCoef_128_q15[192] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_128_q15) = {
     0x7FFF, 0x0000,
     0x7FD8, 0x0647,
     0x7F62, 0x0C8B,
@@ -15144,7 +15146,7 @@ const q15_t twiddleCoef_128_q15[192] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_256_q15[384] = {
+const q15_t twiddleCoef_256_q15[384] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_256_q15) = {
     0x7FFF, 0x0000,
     0x7FF6, 0x0324,
     0x7FD8, 0x0647,
@@ -15357,7 +15359,7 @@ const q15_t twiddleCoef_256_q15[384] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_512_q15[768] = {
+const q15_t twiddleCoef_512_q15[768] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_512_q15) = {
     0x7FFF, 0x0000,
     0x7FFD, 0x0192,
     0x7FF6, 0x0324,
@@ -15762,7 +15764,7 @@ const q15_t twiddleCoef_512_q15[768] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_1024_q15[1536] = {
+const q15_t twiddleCoef_1024_q15[1536] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_1024_q15) = {
     0x7FFF, 0x0000,
     0x7FFF, 0x00C9,
     0x7FFD, 0x0192,
@@ -16551,7 +16553,7 @@ const q15_t twiddleCoef_1024_q15[1536] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_2048_q15[3072] = {
+const q15_t twiddleCoef_2048_q15[3072] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_2048_q15) = {
     0x7FFF, 0x0000,
     0x7FFF, 0x0064,
     0x7FFF, 0x00C9,
@@ -18108,7 +18110,7 @@ const q15_t twiddleCoef_2048_q15[3072] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_4096_q15[6144] = 
+const q15_t twiddleCoef_4096_q15[6144] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_4096_q15) = 
 {
     0x7FFF, 0x0000,
     0x7FFF, 0x0032,
@@ -21183,6 +21185,7 @@ const q15_t twiddleCoef_4096_q15[6144] =
     0xFF9B, 0x8000,
     0xFFCD, 0x8000
 };
+#endif /* !defined (RISCV_DSP_FFT_TABLES_GENERATED) */
 
 
 /**    
@@ -21223,13 +21226,15 @@ const q31_t riscvRecipTableQ31[64] = {
   0x41CCDDB6, 0x4146A3C6, 0x40C28923, 0x40408102
 };
 
-const uint16_t riscvBitRevIndexTable16[RISCVBITREVINDEXTABLE__16_TABLE_LENGTH] = 
+/* Replaced by the generated riscv_fft_tables.c of the lengths of RISCV_DSP_FFT_SIZES */
+#if !defined (RISCV_DSP_FFT_TABLES_GENERATED)
+const uint16_t riscvBitRevIndexTable16[RISCVBITREVINDEXTABLE__16_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable16) = 
 {
    //8x2, size 20
    8,64, 24,72, 16,64, 40,80, 32,64, 56,88, 48,72, 88,104, 72,96, 104,112
 };
 
-const uint16_t riscvBitRevIndexTable32[RISCVBITREVINDEXTABLE__32_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable32[RISCVBITREVINDEXTABLE__32_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable32) = 
 {
    //8x4, size 48
    8,64, 16,128, 24,192, 32,64, 40,72, 48,136, 56,200, 64,128, 72,80, 88,208,
@@ -21237,7 +21242,7 @@ const uint16_t riscvBitRevIndexTable32[RISCVBITREVINDEXTABLE__32_TABLE_LENGTH] =
    152,224, 176,208, 184,232, 216,240, 200,224, 232,240
 };
 
-const uint16_t riscvBitRevIndexTable64[RISCVBITREVINDEXTABLE__64_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable64[RISCVBITREVINDEXTABLE__64_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable64) = 
 {   
    //radix 8, size 56
    8,64, 16,128, 24,192, 32,256, 40,320, 48,384, 56,448, 80,136, 88,200, 
@@ -21246,7 +21251,7 @@ const uint16_t riscvBitRevIndexTable64[RISCVBITREVINDEXTABLE__64_TABLE_LENGTH] =
    368,424, 376,488, 440,496
 };
 
-const uint16_t riscvBitRevIndexTable128[RISCVBITREVINDEXTABLE_128_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable128[RISCVBITREVINDEXTABLE_128_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable128) = 
 {
    //8x2, size 208
    8,512, 16,64, 24,576, 32,128, 40,640, 48,192, 56,704, 64,256, 72,768, 
@@ -21264,7 +21269,7 @@ const uint16_t riscvBitRevIndexTable128[RISCVBITREVINDEXTABLE_128_TABLE_LENGTH]
    904,928, 912,960, 920,992, 944,968, 952,1000, 968,992, 984,1008
 };
 
-const uint16_t riscvBitRevIndexTable256[RISCVBITREVINDEXTABLE_256_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable256[RISCVBITREVINDEXTABLE_256_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable256) = 
 {
    //8x4, size 440
    8,512, 16,1024, 24,1536, 32,64, 40,576, 48,1088, 56,1600, 64,128, 72,640, 
@@ -21302,7 +21307,7 @@ const uint16_t riscvBitRevIndexTable256[RISCVBITREVINDEXTABLE_256_TABLE_LENGTH]
    1960,1968, 2008,2032, 1992,2016, 2024,2032
 };
 
-const uint16_t riscvBitRevIndexTable512[RISCVBITREVINDEXTABLE_512_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable512[RISCVBITREVINDEXTABLE_512_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable512) = 
 {
    //radix 8, size 448
    8,512, 16,1024, 24,1536, 32,2048, 40,2560, 48,3072, 56,3584, 72,576, 
@@ -21342,7 +21347,7 @@ const uint16_t riscvBitRevIndexTable512[RISCVBITREVINDEXTABLE_512_TABLE_LENGTH]
    3448,3952, 3512,4016, 3576,4080
 };
 
-const uint16_t riscvBitRevIndexTable1024[RISCVBITREVINDEXTABLE1024_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable1024[RISCVBITREVINDEXTABLE1024_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable1024) = 
 {
    //8x2, size 1800
    8,4096, 16,512, 24,4608, 32,1024, 40,5120, 48,1536, 56,5632, 64,2048, 
@@ -21494,7 +21499,7 @@ const uint16_t riscvBitRevIndexTable1024[RISCVBITREVINDEXTABLE1024_TABLE_LENGTH]
    8112,8136, 8120,8168, 8136,8160, 8152,8176
 };
 
-const uint16_t riscvBitRevIndexTable2048[RISCVBITREVINDEXTABLE2048_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable2048[RISCVBITREVINDEXTABLE2048_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable2048) = 
 {
    //8x2, size 3808
    8,4096, 16,8192, 24,12288, 32,512, 40,4608, 48,8704, 56,12800, 64,1024, 
@@ -21836,7 +21841,7 @@ const uint16_t riscvBitRevIndexTable2048[RISCVBITREVINDEXTABLE2048_TABLE_LENGTH]
    16328,16352, 16360,16368
 };
 
-const uint16_t riscvBitRevIndexTable4096[RISCVBITREVINDEXTABLE4096_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable4096[RISCVBITREVINDEXTABLE4096_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable4096) = 
 {
    //radix 8, size 4032
    8,4096, 16,8192, 24,12288, 32,16384, 40,20480, 48,24576, 56,28672, 64,512, 
@@ -22208,20 +22213,20 @@ const uint16_t riscvBitRevIndexTable4096[RISCVBITREVINDEXTABLE4096_TABLE_LENGTH]
 };
 
 
-const uint16_t riscvBitRevIndexTable_fixed_16[RISCVBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable_fixed_16[RISCVBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable_fixed_16) = 
 {
    //radix 4, size 12
    8,64, 16,32, 24,96, 40,80, 56,112, 88,104
 };
 
-const uint16_t riscvBitRevIndexTable_fixed_32[RISCVBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable_fixed_32[RISCVBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable_fixed_32) = 
 {
    //4x2, size 24
    8,128, 16,64, 24,192, 40,160, 48,96, 56,224, 72,144,
    88,208, 104,176, 120,240, 152,200, 184,232
 };
 
-const uint16_t riscvBitRevIndexTable_fixed_64[RISCVBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable_fixed_64[RISCVBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable_fixed_64) = 
 {   
    //radix 4, size 56
    8,256, 16,128, 24,384, 32,64, 40,320, 48,192, 56,448, 72,288, 80,160, 88,416, 104,352,
@@ -22229,7 +22234,7 @@ const uint16_t riscvBitRevIndexTable_fixed_64[RISCVBITREVINDEXTABLE_FIXED___64_T
    232,368, 248,496, 280,392, 296,328, 312,456, 344,424, 376,488, 440,472
 };
 
-const uint16_t riscvBitRevIndexTable_fixed_128[RISCVBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable_fixed_128[RISCVBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable_fixed_128) = 
 {
    //4x2, size 112
    8,512, 16,256, 24,768, 32,128, 40,640, 48,384, 56,896, 72,576, 80,320, 88,832, 96,192,
@@ -22240,7 +22245,7 @@ const uint16_t riscvBitRevIndexTable_fixed_128[RISCVBITREVINDEXTABLE_FIXED__128_
    664,808, 696,936, 728,872, 760,1000, 824,920, 888,984
 };
 
-const uint16_t riscvBitRevIndexTable_fixed_256[RISCVBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable_fixed_256[RISCVBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable_fixed_256) = 
 {
    //radix 4, size 240
    8,1024, 16,512, 24,1536, 32,256, 40,1280, 48,768, 56,1792, 64,128, 72,1152, 80,640,
@@ -22259,7 +22264,7 @@ const uint16_t riscvBitRevIndexTable_fixed_256[RISCVBITREVINDEXTABLE_FIXED__256_
    1624,1688, 1656,1944, 1720,1880, 1784,2008, 1912,1976
 };
 
-const uint16_t riscvBitRevIndexTable_fixed_512[RISCVBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable_fixed_512[RISCVBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable_fixed_512) = 
 {
    //4x2, size 480
    8,2048, 16,1024, 24,3072, 32,512, 40,2560, 48,1536, 56,3584, 64,256, 72,2304, 80,1280,
@@ -22293,7 +22298,7 @@ const uint16_t riscvBitRevIndexTable_fixed_512[RISCVBITREVINDEXTABLE_FIXED__512_
    3512,3800, 3576,4056, 3704,3896, 3832,4024
 };
 
-const uint16_t riscvBitRevIndexTable_fixed_1024[RISCVBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable_fixed_1024[RISCVBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable_fixed_1024) = 
 {
     //radix 4, size 992
     8,4096, 16,2048, 24,6144, 32,1024, 40,5120, 48,3072, 56,7168, 64,512, 72,4608, 
@@ -22367,7 +22372,7 @@ const uint16_t riscvBitRevIndexTable_fixed_1024[RISCVBITREVINDEXTABLE_FIXED_1024
     7352,7480, 7416,7992, 7544,7864, 7672,8120, 7928,8056 
 };
 
-const uint16_t riscvBitRevIndexTable_fixed_2048[RISCVBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable_fixed_2048[RISCVBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable_fixed_2048) = 
 {
     //4x2, size 1984
     8,8192, 16,4096, 24,12288, 32,2048, 40,10240, 48,6144, 56,14336, 64,1024, 
@@ -22523,7 +22528,7 @@ const uint16_t riscvBitRevIndexTable_fixed_2048[RISCVBITREVINDEXTABLE_FIXED_2048
     14968,15544, 15096,16056, 15224,15800, 15352,16312, 15608,15992, 15864,16248 
 };
 
-const uint16_t riscvBitRevIndexTable_fixed_4096[RISCVBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH] = 
+const uint16_t riscvBitRevIndexTable_fixed_4096[RISCVBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH] RISCV_DSP_FASTDATA(BITREV, riscvBitRevIndexTable_fixed_4096) = 
 {
     //radix 4, size 4032
     8,16384, 16,8192, 24,24576, 32,4096, 40,20480, 48,12288, 56,28672, 64,2048, 
@@ -22869,7 +22874,7 @@ const uint16_t riscvBitRevIndexTable_fixed_4096[RISCVBITREVINDEXTABLE_FIXED_4096
 * \par    
 * Real and Imag values are in interleaved fashion    
 */
-const float32_t twiddleCoef_rfft_32[32] = {
+const float32_t twiddleCoef_rfft_32[32] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_32) = {
 0.0f			,	1.0f			,
 0.195090322f	,	0.98078528f 	,
 0.382683432f	,	0.923879533f	,
@@ -22888,7 +22893,7 @@ const float32_t twiddleCoef_rfft_32[32] = {
 0.195090322f	,	-0.98078528f	
 };
 
-const float32_t twiddleCoef_rfft_64[64] = {
+const float32_t twiddleCoef_rfft_64[64] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_64) = {
 0.0f,	1.0f,
 0.098017140329561f,	0.995184726672197f,
 0.195090322016128f,	0.98078528040323f,
@@ -22923,7 +22928,7 @@ const float32_t twiddleCoef_rfft_64[64] = {
 0.098017140329561f,	-0.995184726672197f
 };
 
-const float32_t twiddleCoef_rfft_128[128] = {
+const float32_t twiddleCoef_rfft_128[128] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_128) = {
     0.000000000f,  1.000000000f,
     0.049067674f,  0.998795456f,
     0.098017140f,  0.995184727f,
@@ -22990,7 +22995,7 @@ const float32_t twiddleCoef_rfft_128[128] = {
     0.049067674f, -0.998795456f
 };
 
-const float32_t twiddleCoef_rfft_256[256] = {
+const float32_t twiddleCoef_rfft_256[256] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_256) = {
     0.000000000f,  1.000000000f,
     0.024541229f,  0.999698819f,
     0.049067674f,  0.998795456f,
@@ -23121,7 +23126,7 @@ const float32_t twiddleCoef_rfft_256[256] = {
     0.024541229f, -0.999698819f
 };
 
-const float32_t twiddleCoef_rfft_512[512] = {
+const float32_t twiddleCoef_rfft_512[512] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_512) = {
     0.000000000f,  1.000000000f,
     0.012271538f,  0.999924702f,
     0.024541229f,  0.999698819f,
@@ -23380,7 +23385,7 @@ const float32_t twiddleCoef_rfft_512[512] = {
     0.012271538f, -0.999924702f
 };
 
-const float32_t twiddleCoef_rfft_1024[1024] = {
+const float32_t twiddleCoef_rfft_1024[1024] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_1024) = {
     0.000000000f,  1.000000000f,
     0.006135885f,  0.999981175f,
     0.012271538f,  0.999924702f,
@@ -23895,7 +23900,7 @@ const float32_t twiddleCoef_rfft_1024[1024] = {
     0.006135885f, -0.999981175f
 };
 
-const float32_t twiddleCoef_rfft_2048[2048] = {
+const float32_t twiddleCoef_rfft_2048[2048] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_2048) = {
     0.000000000f,  1.000000000f,
     0.003067957f,  0.999995294f,
     0.006135885f,  0.999981175f,
@@ -24922,7 +24927,7 @@ const float32_t twiddleCoef_rfft_2048[2048] = {
     0.003067957f, -0.999995294f
 };
 
-const float32_t twiddleCoef_rfft_4096[4096] = {
+const float32_t twiddleCoef_rfft_4096[4096] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_4096) = {
     0.000000000f,  1.000000000f,
     0.001533980f,  0.999998823f,
     0.003067957f,  0.999995294f,
@@ -26973,6 +26978,5087 @@ const float32_t twiddleCoef_rfft_4096[4096] = {
     0.001533980f, -0.999998823f
 };
 
+/**    
+* \par    
+* Example code for Q31 RFFT Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i < N/2; i++)    
+* {    
+*    twiddleCoefRfftQ31[2*i]= sin(i * 2*PI/(float)N);    
+*    twiddleCoefRfftQ31[2*i+1]= cos(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 32	and PI = 3.14159265358979    
+* \par    
+* Same layout as twiddleCoef_rfft_32, converted to Q31(Fixed point 1.31):    
+*	round(twiddleCoefRfftQ31(i) * pow(2, 31)), saturated to 0x7FFFFFFF    
+*/
+const q31_t twiddleCoef_rfft_32_q31[32] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_32_q31) = {
+    0x00000000, 0x7FFFFFFF,
+    0x18F8B83C, 0x7D8A5F40,
+    0x30FBC54D, 0x7641AF3D,
+    0x471CECE7, 0x6A6D98A4,
+    0x5A82799A, 0x5A82799A,
+    0x6A6D98A4, 0x471CECE7,
+    0x7641AF3D, 0x30FBC54D,
+    0x7D8A5F40, 0x18F8B83C,
+    0x7FFFFFFF, 0x00000000,
+    0x7D8A5F40, 0xE70747C4,
+    0x7641AF3D, 0xCF043AB3,
+    0x6A6D98A4, 0xB8E31319,
+    0x5A82799A, 0xA57D8666,
+    0x471CECE7, 0x9592675C,
+    0x30FBC54D, 0x89BE50C3,
+    0x18F8B83C, 0x8275A0C0
+};
+
+/**    
+* \par    
+* Example code for Q31 RFFT Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i < N/2; i++)    
+* {    
+*    twiddleCoefRfftQ31[2*i]= sin(i * 2*PI/(float)N);    
+*    twiddleCoefRfftQ31[2*i+1]= cos(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 64	and PI = 3.14159265358979    
+* \par    
+* Same layout as twiddleCoef_rfft_64, converted to Q31(Fixed point 1.31):    
+*	round(twiddleCoefRfftQ31(i) * pow(2, 31)), saturated to 0x7FFFFFFF    
+*/
+const q31_t twiddleCoef_rfft_64_q31[64] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_64_q31) = {
+    0x00000000, 0x7FFFFFFF,
+    0x0C8BD35E, 0x7F62368F,
+    0x18F8B83C, 0x7D8A5F40,
+    0x25280C5E, 0x7A7D055B,
+    0x30FBC54D, 0x7641AF3D,
+    0x3C56BA70, 0x70E2CBC6,
+    0x471CECE7, 0x6A6D98A4,
+    0x5133CC94, 0x62F201AC,
+    0x5A82799A, 0x5A82799A,
+    0x62F201AC, 0x5133CC94,
+    0x6A6D98A4, 0x471CECE7,
+    0x70E2CBC6, 0x3C56BA70,
+    0x7641AF3D, 0x30FBC54D,
+    0x7A7D055B, 0x25280C5E,
+    0x7D8A5F40, 0x18F8B83C,
+    0x7F62368F, 0x0C8BD35E,
+    0x7FFFFFFF, 0x00000000,
+    0x7F62368F, 0xF3742CA2,
+    0x7D8A5F40, 0xE70747C4,
+    0x7A7D055B, 0xDAD7F3A2,
+    0x7641AF3D, 0xCF043AB3,
+    0x70E2CBC6, 0xC3A94590,
+    0x6A6D98A4, 0xB8E31319,
+    0x62F201AC, 0xAECC336C,
+    0x5A82799A, 0xA57D8666,
+    0x5133CC94, 0x9D0DFE54,
+    0x471CECE7, 0x9592675C,
+    0x3C56BA70, 0x8F1D343A,
+    0x30FBC54D, 0x89BE50C3,
+    0x25280C5E, 0x8582FAA5,
+    0x18F8B83C, 0x8275A0C0,
+    0x0C8BD35E, 0x809DC971
+};
+
+/**    
+* \par    
+* Example code for Q31 RFFT Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i < N/2; i++)    
+* {    
+*    twiddleCoefRfftQ31[2*i]= sin(i * 2*PI/(float)N);    
+*    twiddleCoefRfftQ31[2*i+1]= cos(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 128	and PI = 3.14159265358979    
+* \par    
+* Same layout as twiddleCoef_rfft_128, converted to Q31(Fixed point 1.31):    
+*	round(twiddleCoefRfftQ31(i) * pow(2, 31)), saturated to 0x7FFFFFFF    
+*/
+const q31_t twiddleCoef_rfft_128_q31[128] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_128_q31) = {
+    0x00000000, 0x7FFFFFFF,
+    0x0647D97C, 0x7FD8878E,
+    0x0C8BD35E, 0x7F62368F,
+    0x12C8106F, 0x7E9D55FC,
+    0x18F8B83C, 0x7D8A5F40,
+    0x1F19F97B, 0x7C29FBEE,
+    0x25280C5E, 0x7A7D055B,
+    0x2B1F34EB, 0x78848414,
+    0x30FBC54D, 0x7641AF3D,
+    0x36BA2014, 0x73B5EBD1,
+    0x3C56BA70, 0x70E2CBC6,
+    0x41CE1E65, 0x6DCA0D14,
+    0x471CECE7, 0x6A6D98A4,
+    0x4C3FDFF4, 0x66CF8120,
+    0x5133CC94, 0x62F201AC,
+    0x55F5A4D2, 0x5ED77C8A,
+    0x5A82799A, 0x5A82799A,
+    0x5ED77C8A, 0x55F5A4D2,
+    0x62F201AC, 0x5133CC94,
+    0x66CF8120, 0x4C3FDFF4,
+    0x6A6D98A4, 0x471CECE7,
+    0x6DCA0D14, 0x41CE1E65,
+    0x70E2CBC6, 0x3C56BA70,
+    0x73B5EBD1, 0x36BA2014,
+    0x7641AF3D, 0x30FBC54D,
+    0x78848414, 0x2B1F34EB,
+    0x7A7D055B, 0x25280C5E,
+    0x7C29FBEE, 0x1F19F97B,
+    0x7D8A5F40, 0x18F8B83C,
+    0x7E9D55FC, 0x12C8106F,
+    0x7F62368F, 0x0C8BD35E,
+    0x7FD8878E, 0x0647D97C,
+    0x7FFFFFFF, 0x00000000,
+    0x7FD8878E, 0xF9B82684,
+    0x7F62368F, 0xF3742CA2,
+    0x7E9D55FC, 0xED37EF91,
+    0x7D8A5F40, 0xE70747C4,
+    0x7C29FBEE, 0xE0E60685,
+    0x7A7D055B, 0xDAD7F3A2,
+    0x78848414, 0xD4E0CB15,
+    0x7641AF3D, 0xCF043AB3,
+    0x73B5EBD1, 0xC945DFEC,
+    0x70E2CBC6, 0xC3A94590,
+    0x6DCA0D14, 0xBE31E19B,
+    0x6A6D98A4, 0xB8E31319,
+    0x66CF8120, 0xB3C0200C,
+    0x62F201AC, 0xAECC336C,
+    0x5ED77C8A, 0xAA0A5B2E,
+    0x5A82799A, 0xA57D8666,
+    0x55F5A4D2, 0xA1288376,
+    0x5133CC94, 0x9D0DFE54,
+    0x4C3FDFF4, 0x99307EE0,
+    0x471CECE7, 0x9592675C,
+    0x41CE1E65, 0x9235F2EC,
+    0x3C56BA70, 0x8F1D343A,
+    0x36BA2014, 0x8C4A142F,
+    0x30FBC54D, 0x89BE50C3,
+    0x2B1F34EB, 0x877B7BEC,
+    0x25280C5E, 0x8582FAA5,
+    0x1F19F97B, 0x83D60412,
+    0x18F8B83C, 0x8275A0C0,
+    0x12C8106F, 0x8162AA04,
+    0x0C8BD35E, 0x809DC971,
+    0x0647D97C, 0x80277872
+};
+
+/**    
+* \par    
+* Example code for Q31 RFFT Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i < N/2; i++)    
+* {    
+*    twiddleCoefRfftQ31[2*i]= sin(i * 2*PI/(float)N);    
+*    twiddleCoefRfftQ31[2*i+1]= cos(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 256	and PI = 3.14159265358979    
+* \par    
+* Same layout as twiddleCoef_rfft_256, converted to Q31(Fixed point 1.31):    
+*	round(twiddleCoefRfftQ31(i) * pow(2, 31)), saturated to 0x7FFFFFFF    
+*/
+const q31_t twiddleCoef_rfft_256_q31[256] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_256_q31) = {
+    0x00000000, 0x7FFFFFFF,
+    0x03242ABF, 0x7FF62182,
+    0x0647D97C, 0x7FD8878E,
+    0x096A9049, 0x7FA736B4,
+    0x0C8BD35E, 0x7F62368F,
+    0x0FAB272B, 0x7F0991C4,
+    0x12C8106F, 0x7E9D55FC,
+    0x15E21445, 0x7E1D93EA,
+    0x18F8B83C, 0x7D8A5F40,
+    0x1C0B826A, 0x7CE3CEB2,
+    0x1F19F97B, 0x7C29FBEE,
+    0x2223A4C5, 0x7B5D039E,
+    0x25280C5E, 0x7A7D055B,
+    0x2826B928, 0x798A23B1,
+    0x2B1F34EB, 0x78848414,
+    0x2E110A62, 0x776C4EDB,
+    0x30FBC54D, 0x7641AF3D,
+    0x33DEF287, 0x7504D345,
+    0x36BA2014, 0x73B5EBD1,
+    0x398CDD32, 0x72552C85,
+    0x3C56BA70, 0x70E2CBC6,
+    0x3F1749B8, 0x6F5F02B2,
+    0x41CE1E65, 0x6DCA0D14,
+    0x447ACD50, 0x6C242960,
+    0x471CECE7, 0x6A6D98A4,
+    0x49B41533, 0x68A69E81,
+    0x4C3FDFF4, 0x66CF8120,
+    0x4EBFE8A5, 0x64E88926,
+    0x5133CC94, 0x62F201AC,
+    0x539B2AF0, 0x60EC3830,
+    0x55F5A4D2, 0x5ED77C8A,
+    0x5842DD54, 0x5CB420E0,
+    0x5A82799A, 0x5A82799A,
+    0x5CB420E0, 0x5842DD54,
+    0x5ED77C8A, 0x55F5A4D2,
+    0x60EC3830, 0x539B2AF0,
+    0x62F201AC, 0x5133CC94,
+    0x64E88926, 0x4EBFE8A5,
+    0x66CF8120, 0x4C3FDFF4,
+    0x68A69E81, 0x49B41533,
+    0x6A6D98A4, 0x471CECE7,
+    0x6C242960, 0x447ACD50,
+    0x6DCA0D14, 0x41CE1E65,
+    0x6F5F02B2, 0x3F1749B8,
+    0x70E2CBC6, 0x3C56BA70,
+    0x72552C85, 0x398CDD32,
+    0x73B5EBD1, 0x36BA2014,
+    0x7504D345, 0x33DEF287,
+    0x7641AF3D, 0x30FBC54D,
+    0x776C4EDB, 0x2E110A62,
+    0x78848414, 0x2B1F34EB,
+    0x798A23B1, 0x2826B928,
+    0x7A7D055B, 0x25280C5E,
+    0x7B5D039E, 0x2223A4C5,
+    0x7C29FBEE, 0x1F19F97B,
+    0x7CE3CEB2, 0x1C0B826A,
+    0x7D8A5F40, 0x18F8B83C,
+    0x7E1D93EA, 0x15E21445,
+    0x7E9D55FC, 0x12C8106F,
+    0x7F0991C4, 0x0FAB272B,
+    0x7F62368F, 0x0C8BD35E,
+    0x7FA736B4, 0x096A9049,
+    0x7FD8878E, 0x0647D97C,
+    0x7FF62182, 0x03242ABF,
+    0x7FFFFFFF, 0x00000000,
+    0x7FF62182, 0xFCDBD541,
+    0x7FD8878E, 0xF9B82684,
+    0x7FA736B4, 0xF6956FB7,
+    0x7F62368F, 0xF3742CA2,
+    0x7F0991C4, 0xF054D8D5,
+    0x7E9D55FC, 0xED37EF91,
+    0x7E1D93EA, 0xEA1DEBBB,
+    0x7D8A5F40, 0xE70747C4,
+    0x7CE3CEB2, 0xE3F47D96,
+    0x7C29FBEE, 0xE0E60685,
+    0x7B5D039E, 0xDDDC5B3B,
+    0x7A7D055B, 0xDAD7F3A2,
+    0x798A23B1, 0xD7D946D8,
+    0x78848414, 0xD4E0CB15,
+    0x776C4EDB, 0xD1EEF59E,
+    0x7641AF3D, 0xCF043AB3,
+    0x7504D345, 0xCC210D79,
+    0x73B5EBD1, 0xC945DFEC,
+    0x72552C85, 0xC67322CE,
+    0x70E2CBC6, 0xC3A94590,
+    0x6F5F02B2, 0xC0E8B648,
+    0x6DCA0D14, 0xBE31E19B,
+    0x6C242960, 0xBB8532B0,
+    0x6A6D98A4, 0xB8E31319,
+    0x68A69E81, 0xB64BEACD,
+    0x66CF8120, 0xB3C0200C,
+    0x64E88926, 0xB140175B,
+    0x62F201AC, 0xAECC336C,
+    0x60EC3830, 0xAC64D510,
+    0x5ED77C8A, 0xAA0A5B2E,
+    0x5CB420E0, 0xA7BD22AC,
+    0x5A82799A, 0xA57D8666,
+    0x5842DD54, 0xA34BDF20,
+    0x55F5A4D2, 0xA1288376,
+    0x539B2AF0, 0x9F13C7D0,
+    0x5133CC94, 0x9D0DFE54,
+    0x4EBFE8A5, 0x9B1776DA,
+    0x4C3FDFF4, 0x99307EE0,
+    0x49B41533, 0x9759617F,
+    0x471CECE7, 0x9592675C,
+    0x447ACD50, 0x93DBD6A0,
+    0x41CE1E65, 0x9235F2EC,
+    0x3F1749B8, 0x90A0FD4E,
+    0x3C56BA70, 0x8F1D343A,
+    0x398CDD32, 0x8DAAD37B,
+    0x36BA2014, 0x8C4A142F,
+    0x33DEF287, 0x8AFB2CBB,
+    0x30FBC54D, 0x89BE50C3,
+    0x2E110A62, 0x8893B125,
+    0x2B1F34EB, 0x877B7BEC,
+    0x2826B928, 0x8675DC4F,
+    0x25280C5E, 0x8582FAA5,
+    0x2223A4C5, 0x84A2FC62,
+    0x1F19F97B, 0x83D60412,
+    0x1C0B826A, 0x831C314E,
+    0x18F8B83C, 0x8275A0C0,
+    0x15E21445, 0x81E26C16,
+    0x12C8106F, 0x8162AA04,
+    0x0FAB272B, 0x80F66E3C,
+    0x0C8BD35E, 0x809DC971,
+    0x096A9049, 0x8058C94C,
+    0x0647D97C, 0x80277872,
+    0x03242ABF, 0x8009DE7E
+};
+
+/**    
+* \par    
+* Example code for Q31 RFFT Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i < N/2; i++)    
+* {    
+*    twiddleCoefRfftQ31[2*i]= sin(i * 2*PI/(float)N);    
+*    twiddleCoefRfftQ31[2*i+1]= cos(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 512	and PI = 3.14159265358979    
+* \par    
+* Same layout as twiddleCoef_rfft_512, converted to Q31(Fixed point 1.31):    
+*	round(twiddleCoefRfftQ31(i) * pow(2, 31)), saturated to 0x7FFFFFFF    
+*/
+const q31_t twiddleCoef_rfft_512_q31[512] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_512_q31) = {
+    0x00000000, 0x7FFFFFFF,
+    0x01921D20, 0x7FFD885A,
+    0x03242ABF, 0x7FF62182,
+    0x04B6195D, 0x7FE9CBC0,
+    0x0647D97C, 0x7FD8878E,
+    0x07D95B9E, 0x7FC25596,
+    0x096A9049, 0x7FA736B4,
+    0x0AFB6805, 0x7F872BF3,
+    0x0C8BD35E, 0x7F62368F,
+    0x0E1BC2E4, 0x7F3857F6,
+    0x0FAB272B, 0x7F0991C4,
+    0x1139F0CF, 0x7ED5E5C6,
+    0x12C8106F, 0x7E9D55FC,
+    0x145576B1, 0x7E5FE493,
+    0x15E21445, 0x7E1D93EA,
+    0x176DD9DE, 0x7DD6668F,
+    0x18F8B83C, 0x7D8A5F40,
+    0x1A82A026, 0x7D3980EC,
+    0x1C0B826A, 0x7CE3CEB2,
+    0x1D934FE5, 0x7C894BDE,
+    0x1F19F97B, 0x7C29FBEE,
+    0x209F701C, 0x7BC5E290,
+    0x2223A4C5, 0x7B5D039E,
+    0x23A6887F, 0x7AEF6323,
+    0x25280C5E, 0x7A7D055B,
+    0x26A82186, 0x7A05EEAD,
+    0x2826B928, 0x798A23B1,
+    0x29A3C485, 0x7909A92D,
+    0x2B1F34EB, 0x78848414,
+    0x2C98FBBA, 0x77FAB989,
+    0x2E110A62, 0x776C4EDB,
+    0x2F875262, 0x76D94989,
+    0x30FBC54D, 0x7641AF3D,
+    0x326E54C7, 0x75A585CF,
+    0x33DEF287, 0x7504D345,
+    0x354D9057, 0x745F9DD1,
+    0x36BA2014, 0x73B5EBD1,
+    0x382493B0, 0x7307C3D0,
+    0x398CDD32, 0x72552C85,
+    0x3AF2EEB7, 0x719E2CD2,
+    0x3C56BA70, 0x70E2CBC6,
+    0x3DB832A6, 0x7023109A,
+    0x3F1749B8, 0x6F5F02B2,
+    0x4073F21D, 0x6E96A99D,
+    0x41CE1E65, 0x6DCA0D14,
+    0x4325C135, 0x6CF934FC,
+    0x447ACD50, 0x6C242960,
+    0x45CD358F, 0x6B4AF279,
+    0x471CECE7, 0x6A6D98A4,
+    0x4869E665, 0x698C246C,
+    0x49B41533, 0x68A69E81,
+    0x4AFB6C98, 0x67BD0FBD,
+    0x4C3FDFF4, 0x66CF8120,
+    0x4D8162C4, 0x65DDFBD3,
+    0x4EBFE8A5, 0x64E88926,
+    0x4FFB654D, 0x63EF3290,
+    0x5133CC94, 0x62F201AC,
+    0x5269126E, 0x61F1003F,
+    0x539B2AF0, 0x60EC3830,
+    0x54CA0A4B, 0x5FE3B38D,
+    0x55F5A4D2, 0x5ED77C8A,
+    0x571DEEFA, 0x5DC79D7C,
+    0x5842DD54, 0x5CB420E0,
+    0x59646498, 0x5B9D1154,
+    0x5A82799A, 0x5A82799A,
+    0x5B9D1154, 0x59646498,
+    0x5CB420E0, 0x5842DD54,
+    0x5DC79D7C, 0x571DEEFA,
+    0x5ED77C8A, 0x55F5A4D2,
+    0x5FE3B38D, 0x54CA0A4B,
+    0x60EC3830, 0x539B2AF0,
+    0x61F1003F, 0x5269126E,
+    0x62F201AC, 0x5133CC94,
+    0x63EF3290, 0x4FFB654D,
+    0x64E88926, 0x4EBFE8A5,
+    0x65DDFBD3, 0x4D8162C4,
+    0x66CF8120, 0x4C3FDFF4,
+    0x67BD0FBD, 0x4AFB6C98,
+    0x68A69E81, 0x49B41533,
+    0x698C246C, 0x4869E665,
+    0x6A6D98A4, 0x471CECE7,
+    0x6B4AF279, 0x45CD358F,
+    0x6C242960, 0x447ACD50,
+    0x6CF934FC, 0x4325C135,
+    0x6DCA0D14, 0x41CE1E65,
+    0x6E96A99D, 0x4073F21D,
+    0x6F5F02B2, 0x3F1749B8,
+    0x7023109A, 0x3DB832A6,
+    0x70E2CBC6, 0x3C56BA70,
+    0x719E2CD2, 0x3AF2EEB7,
+    0x72552C85, 0x398CDD32,
+    0x7307C3D0, 0x382493B0,
+    0x73B5EBD1, 0x36BA2014,
+    0x745F9DD1, 0x354D9057,
+    0x7504D345, 0x33DEF287,
+    0x75A585CF, 0x326E54C7,
+    0x7641AF3D, 0x30FBC54D,
+    0x76D94989, 0x2F875262,
+    0x776C4EDB, 0x2E110A62,
+    0x77FAB989, 0x2C98FBBA,
+    0x78848414, 0x2B1F34EB,
+    0x7909A92D, 0x29A3C485,
+    0x798A23B1, 0x2826B928,
+    0x7A05EEAD, 0x26A82186,
+    0x7A7D055B, 0x25280C5E,
+    0x7AEF6323, 0x23A6887F,
+    0x7B5D039E, 0x2223A4C5,
+    0x7BC5E290, 0x209F701C,
+    0x7C29FBEE, 0x1F19F97B,
+    0x7C894BDE, 0x1D934FE5,
+    0x7CE3CEB2, 0x1C0B826A,
+    0x7D3980EC, 0x1A82A026,
+    0x7D8A5F40, 0x18F8B83C,
+    0x7DD6668F, 0x176DD9DE,
+    0x7E1D93EA, 0x15E21445,
+    0x7E5FE493, 0x145576B1,
+    0x7E9D55FC, 0x12C8106F,
+    0x7ED5E5C6, 0x1139F0CF,
+    0x7F0991C4, 0x0FAB272B,
+    0x7F3857F6, 0x0E1BC2E4,
+    0x7F62368F, 0x0C8BD35E,
+    0x7F872BF3, 0x0AFB6805,
+    0x7FA736B4, 0x096A9049,
+    0x7FC25596, 0x07D95B9E,
+    0x7FD8878E, 0x0647D97C,
+    0x7FE9CBC0, 0x04B6195D,
+    0x7FF62182, 0x03242ABF,
+    0x7FFD885A, 0x01921D20,
+    0x7FFFFFFF, 0x00000000,
+    0x7FFD885A, 0xFE6DE2E0,
+    0x7FF62182, 0xFCDBD541,
+    0x7FE9CBC0, 0xFB49E6A3,
+    0x7FD8878E, 0xF9B82684,
+    0x7FC25596, 0xF826A462,
+    0x7FA736B4, 0xF6956FB7,
+    0x7F872BF3, 0xF50497FB,
+    0x7F62368F, 0xF3742CA2,
+    0x7F3857F6, 0xF1E43D1C,
+    0x7F0991C4, 0xF054D8D5,
+    0x7ED5E5C6, 0xEEC60F31,
+    0x7E9D55FC, 0xED37EF91,
+    0x7E5FE493, 0xEBAA894F,
+    0x7E1D93EA, 0xEA1DEBBB,
+    0x7DD6668F, 0xE8922622,
+    0x7D8A5F40, 0xE70747C4,
+    0x7D3980EC, 0xE57D5FDA,
+    0x7CE3CEB2, 0xE3F47D96,
+    0x7C894BDE, 0xE26CB01B,
+    0x7C29FBEE, 0xE0E60685,
+    0x7BC5E290, 0xDF608FE4,
+    0x7B5D039E, 0xDDDC5B3B,
+    0x7AEF6323, 0xDC597781,
+    0x7A7D055B, 0xDAD7F3A2,
+    0x7A05EEAD, 0xD957DE7A,
+    0x798A23B1, 0xD7D946D8,
+    0x7909A92D, 0xD65C3B7B,
+    0x78848414, 0xD4E0CB15,
+    0x77FAB989, 0xD3670446,
+    0x776C4EDB, 0xD1EEF59E,
+    0x76D94989, 0xD078AD9E,
+    0x7641AF3D, 0xCF043AB3,
+    0x75A585CF, 0xCD91AB39,
+    0x7504D345, 0xCC210D79,
+    0x745F9DD1, 0xCAB26FA9,
+    0x73B5EBD1, 0xC945DFEC,
+    0x7307C3D0, 0xC7DB6C50,
+    0x72552C85, 0xC67322CE,
+    0x719E2CD2, 0xC50D1149,
+    0x70E2CBC6, 0xC3A94590,
+    0x7023109A, 0xC247CD5A,
+    0x6F5F02B2, 0xC0E8B648,
+    0x6E96A99D, 0xBF8C0DE3,
+    0x6DCA0D14, 0xBE31E19B,
+    0x6CF934FC, 0xBCDA3ECB,
+    0x6C242960, 0xBB8532B0,
+    0x6B4AF279, 0xBA32CA71,
+    0x6A6D98A4, 0xB8E31319,
+    0x698C246C, 0xB796199B,
+    0x68A69E81, 0xB64BEACD,
+    0x67BD0FBD, 0xB5049368,
+    0x66CF8120, 0xB3C0200C,
+    0x65DDFBD3, 0xB27E9D3C,
+    0x64E88926, 0xB140175B,
+    0x63EF3290, 0xB0049AB3,
+    0x62F201AC, 0xAECC336C,
+    0x61F1003F, 0xAD96ED92,
+    0x60EC3830, 0xAC64D510,
+    0x5FE3B38D, 0xAB35F5B5,
+    0x5ED77C8A, 0xAA0A5B2E,
+    0x5DC79D7C, 0xA8E21106,
+    0x5CB420E0, 0xA7BD22AC,
+    0x5B9D1154, 0xA69B9B68,
+    0x5A82799A, 0xA57D8666,
+    0x59646498, 0xA462EEAC,
+    0x5842DD54, 0xA34BDF20,
+    0x571DEEFA, 0xA2386284,
+    0x55F5A4D2, 0xA1288376,
+    0x54CA0A4B, 0xA01C4C73,
+    0x539B2AF0, 0x9F13C7D0,
+    0x5269126E, 0x9E0EFFC1,
+    0x5133CC94, 0x9D0DFE54,
+    0x4FFB654D, 0x9C10CD70,
+    0x4EBFE8A5, 0x9B1776DA,
+    0x4D8162C4, 0x9A22042D,
+    0x4C3FDFF4, 0x99307EE0,
+    0x4AFB6C98, 0x9842F043,
+    0x49B41533, 0x9759617F,
+    0x4869E665, 0x9673DB94,
+    0x471CECE7, 0x9592675C,
+    0x45CD358F, 0x94B50D87,
+    0x447ACD50, 0x93DBD6A0,
+    0x4325C135, 0x9306CB04,
+    0x41CE1E65, 0x9235F2EC,
+    0x4073F21D, 0x91695663,
+    0x3F1749B8, 0x90A0FD4E,
+    0x3DB832A6, 0x8FDCEF66,
+    0x3C56BA70, 0x8F1D343A,
+    0x3AF2EEB7, 0x8E61D32E,
+    0x398CDD32, 0x8DAAD37B,
+    0x382493B0, 0x8CF83C30,
+    0x36BA2014, 0x8C4A142F,
+    0x354D9057, 0x8BA0622F,
+    0x33DEF287, 0x8AFB2CBB,
+    0x326E54C7, 0x8A5A7A31,
+    0x30FBC54D, 0x89BE50C3,
+    0x2F875262, 0x8926B677,
+    0x2E110A62, 0x8893B125,
+    0x2C98FBBA, 0x88054677,
+    0x2B1F34EB, 0x877B7BEC,
+    0x29A3C485, 0x86F656D3,
+    0x2826B928, 0x8675DC4F,
+    0x26A82186, 0x85FA1153,
+    0x25280C5E, 0x8582FAA5,
+    0x23A6887F, 0x85109CDD,
+    0x2223A4C5, 0x84A2FC62,
+    0x209F701C, 0x843A1D70,
+    0x1F19F97B, 0x83D60412,
+    0x1D934FE5, 0x8376B422,
+    0x1C0B826A, 0x831C314E,
+    0x1A82A026, 0x82C67F14,
+    0x18F8B83C, 0x8275A0C0,
+    0x176DD9DE, 0x82299971,
+    0x15E21445, 0x81E26C16,
+    0x145576B1, 0x81A01B6D,
+    0x12C8106F, 0x8162AA04,
+    0x1139F0CF, 0x812A1A3A,
+    0x0FAB272B, 0x80F66E3C,
+    0x0E1BC2E4, 0x80C7A80A,
+    0x0C8BD35E, 0x809DC971,
+    0x0AFB6805, 0x8078D40D,
+    0x096A9049, 0x8058C94C,
+    0x07D95B9E, 0x803DAA6A,
+    0x0647D97C, 0x80277872,
+    0x04B6195D, 0x80163440,
+    0x03242ABF, 0x8009DE7E,
+    0x01921D20, 0x800277A6
+};
+
+/**    
+* \par    
+* Example code for Q31 RFFT Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i < N/2; i++)    
+* {    
+*    twiddleCoefRfftQ31[2*i]= sin(i * 2*PI/(float)N);    
+*    twiddleCoefRfftQ31[2*i+1]= cos(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 1024	and PI = 3.14159265358979    
+* \par    
+* Same layout as twiddleCoef_rfft_1024, converted to Q31(Fixed point 1.31):    
+*	round(twiddleCoefRfftQ31(i) * pow(2, 31)), saturated to 0x7FFFFFFF    
+*/
+const q31_t twiddleCoef_rfft_1024_q31[1024] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_1024_q31) = {
+    0x00000000, 0x7FFFFFFF,
+    0x00C90F88, 0x7FFF6216,
+    0x01921D20, 0x7FFD885A,
+    0x025B26D7, 0x7FFA72D1,
+    0x03242ABF, 0x7FF62182,
+    0x03ED26E6, 0x7FF09478,
+    0x04B6195D, 0x7FE9CBC0,
+    0x057F0035, 0x7FE1C76B,
+    0x0647D97C, 0x7FD8878E,
+    0x0710A345, 0x7FCE0C3E,
+    0x07D95B9E, 0x7FC25596,
+    0x08A2009A, 0x7FB563B3,
+    0x096A9049, 0x7FA736B4,
+    0x0A3308BD, 0x7F97CEBD,
+    0x0AFB6805, 0x7F872BF3,
+    0x0BC3AC35, 0x7F754E80,
+    0x0C8BD35E, 0x7F62368F,
+    0x0D53DB92, 0x7F4DE451,
+    0x0E1BC2E4, 0x7F3857F6,
+    0x0EE38766, 0x7F2191B4,
+    0x0FAB272B, 0x7F0991C4,
+    0x1072A048, 0x7EF05860,
+    0x1139F0CF, 0x7ED5E5C6,
+    0x120116D5, 0x7EBA3A39,
+    0x12C8106F, 0x7E9D55FC,
+    0x138EDBB1, 0x7E7F3957,
+    0x145576B1, 0x7E5FE493,
+    0x151BDF86, 0x7E3F57FF,
+    0x15E21445, 0x7E1D93EA,
+    0x16A81305, 0x7DFA98A8,
+    0x176DD9DE, 0x7DD6668F,
+    0x183366E9, 0x7DB0FDF8,
+    0x18F8B83C, 0x7D8A5F40,
+    0x19BDCBF3, 0x7D628AC6,
+    0x1A82A026, 0x7D3980EC,
+    0x1B4732EF, 0x7D0F4218,
+    0x1C0B826A, 0x7CE3CEB2,
+    0x1CCF8CB3, 0x7CB72724,
+    0x1D934FE5, 0x7C894BDE,
+    0x1E56CA1E, 0x7C5A3D50,
+    0x1F19F97B, 0x7C29FBEE,
+    0x1FDCDC1B, 0x7BF88830,
+    0x209F701C, 0x7BC5E290,
+    0x2161B3A0, 0x7B920B89,
+    0x2223A4C5, 0x7B5D039E,
+    0x22E541AF, 0x7B26CB4F,
+    0x23A6887F, 0x7AEF6323,
+    0x24677758, 0x7AB6CBA4,
+    0x25280C5E, 0x7A7D055B,
+    0x25E845B6, 0x7A4210D8,
+    0x26A82186, 0x7A05EEAD,
+    0x27679DF4, 0x79C89F6E,
+    0x2826B928, 0x798A23B1,
+    0x28E5714B, 0x794A7C12,
+    0x29A3C485, 0x7909A92D,
+    0x2A61B101, 0x78C7ABA2,
+    0x2B1F34EB, 0x78848414,
+    0x2BDC4E6F, 0x78403329,
+    0x2C98FBBA, 0x77FAB989,
+    0x2D553AFC, 0x77B417DF,
+    0x2E110A62, 0x776C4EDB,
+    0x2ECC681E, 0x77235F2D,
+    0x2F875262, 0x76D94989,
+    0x3041C761, 0x768E0EA6,
+    0x30FBC54D, 0x7641AF3D,
+    0x31B54A5E, 0x75F42C0B,
+    0x326E54C7, 0x75A585CF,
+    0x3326E2C3, 0x7555BD4C,
+    0x33DEF287, 0x7504D345,
+    0x34968250, 0x74B2C884,
+    0x354D9057, 0x745F9DD1,
+    0x36041AD9, 0x740B53FB,
+    0x36BA2014, 0x73B5EBD1,
+    0x376F9E46, 0x735F6626,
+    0x382493B0, 0x7307C3D0,
+    0x38D8FE93, 0x72AF05A7,
+    0x398CDD32, 0x72552C85,
+    0x3A402DD2, 0x71FA3949,
+    0x3AF2EEB7, 0x719E2CD2,
+    0x3BA51E29, 0x71410805,
+    0x3C56BA70, 0x70E2CBC6,
+    0x3D07C1D6, 0x708378FF,
+    0x3DB832A6, 0x7023109A,
+    0x3E680B2C, 0x6FC19385,
+    0x3F1749B8, 0x6F5F02B2,
+    0x3FC5EC98, 0x6EFB5F12,
+    0x4073F21D, 0x6E96A99D,
+    0x4121589B, 0x6E30E34A,
+    0x41CE1E65, 0x6DCA0D14,
+    0x427A41D0, 0x6D6227FA,
+    0x4325C135, 0x6CF934FC,
+    0x43D09AED, 0x6C8F351C,
+    0x447ACD50, 0x6C242960,
+    0x452456BD, 0x6BB812D1,
+    0x45CD358F, 0x6B4AF279,
+    0x46756828, 0x6ADCC964,
+    0x471CECE7, 0x6A6D98A4,
+    0x47C3C22F, 0x69FD614A,
+    0x4869E665, 0x698C246C,
+    0x490F57EE, 0x6919E320,
+    0x49B41533, 0x68A69E81,
+    0x4A581C9E, 0x683257AB,
+    0x4AFB6C98, 0x67BD0FBD,
+    0x4B9E0390, 0x6746C7D8,
+    0x4C3FDFF4, 0x66CF8120,
+    0x4CE10034, 0x66573CBB,
+    0x4D8162C4, 0x65DDFBD3,
+    0x4E210617, 0x6563BF92,
+    0x4EBFE8A5, 0x64E88926,
+    0x4F5E08E3, 0x646C59BF,
+    0x4FFB654D, 0x63EF3290,
+    0x5097FC5E, 0x637114CC,
+    0x5133CC94, 0x62F201AC,
+    0x51CED46E, 0x6271FA69,
+    0x5269126E, 0x61F1003F,
+    0x53028518, 0x616F146C,
+    0x539B2AF0, 0x60EC3830,
+    0x5433027D, 0x60686CCF,
+    0x54CA0A4B, 0x5FE3B38D,
+    0x556040E2, 0x5F5E0DB3,
+    0x55F5A4D2, 0x5ED77C8A,
+    0x568A34A9, 0x5E50015D,
+    0x571DEEFA, 0x5DC79D7C,
+    0x57B0D256, 0x5D3E5237,
+    0x5842DD54, 0x5CB420E0,
+    0x58D40E8C, 0x5C290ACC,
+    0x59646498, 0x5B9D1154,
+    0x59F3DE12, 0x5B1035CF,
+    0x5A82799A, 0x5A82799A,
+    0x5B1035CF, 0x59F3DE12,
+    0x5B9D1154, 0x59646498,
+    0x5C290ACC, 0x58D40E8C,
+    0x5CB420E0, 0x5842DD54,
+    0x5D3E5237, 0x57B0D256,
+    0x5DC79D7C, 0x571DEEFA,
+    0x5E50015D, 0x568A34A9,
+    0x5ED77C8A, 0x55F5A4D2,
+    0x5F5E0DB3, 0x556040E2,
+    0x5FE3B38D, 0x54CA0A4B,
+    0x60686CCF, 0x5433027D,
+    0x60EC3830, 0x539B2AF0,
+    0x616F146C, 0x53028518,
+    0x61F1003F, 0x5269126E,
+    0x6271FA69, 0x51CED46E,
+    0x62F201AC, 0x5133CC94,
+    0x637114CC, 0x5097FC5E,
+    0x63EF3290, 0x4FFB654D,
+    0x646C59BF, 0x4F5E08E3,
+    0x64E88926, 0x4EBFE8A5,
+    0x6563BF92, 0x4E210617,
+    0x65DDFBD3, 0x4D8162C4,
+    0x66573CBB, 0x4CE10034,
+    0x66CF8120, 0x4C3FDFF4,
+    0x6746C7D8, 0x4B9E0390,
+    0x67BD0FBD, 0x4AFB6C98,
+    0x683257AB, 0x4A581C9E,
+    0x68A69E81, 0x49B41533,
+    0x6919E320, 0x490F57EE,
+    0x698C246C, 0x4869E665,
+    0x69FD614A, 0x47C3C22F,
+    0x6A6D98A4, 0x471CECE7,
+    0x6ADCC964, 0x46756828,
+    0x6B4AF279, 0x45CD358F,
+    0x6BB812D1, 0x452456BD,
+    0x6C242960, 0x447ACD50,
+    0x6C8F351C, 0x43D09AED,
+    0x6CF934FC, 0x4325C135,
+    0x6D6227FA, 0x427A41D0,
+    0x6DCA0D14, 0x41CE1E65,
+    0x6E30E34A, 0x4121589B,
+    0x6E96A99D, 0x4073F21D,
+    0x6EFB5F12, 0x3FC5EC98,
+    0x6F5F02B2, 0x3F1749B8,
+    0x6FC19385, 0x3E680B2C,
+    0x7023109A, 0x3DB832A6,
+    0x708378FF, 0x3D07C1D6,
+    0x70E2CBC6, 0x3C56BA70,
+    0x71410805, 0x3BA51E29,
+    0x719E2CD2, 0x3AF2EEB7,
+    0x71FA3949, 0x3A402DD2,
+    0x72552C85, 0x398CDD32,
+    0x72AF05A7, 0x38D8FE93,
+    0x7307C3D0, 0x382493B0,
+    0x735F6626, 0x376F9E46,
+    0x73B5EBD1, 0x36BA2014,
+    0x740B53FB, 0x36041AD9,
+    0x745F9DD1, 0x354D9057,
+    0x74B2C884, 0x34968250,
+    0x7504D345, 0x33DEF287,
+    0x7555BD4C, 0x3326E2C3,
+    0x75A585CF, 0x326E54C7,
+    0x75F42C0B, 0x31B54A5E,
+    0x7641AF3D, 0x30FBC54D,
+    0x768E0EA6, 0x3041C761,
+    0x76D94989, 0x2F875262,
+    0x77235F2D, 0x2ECC681E,
+    0x776C4EDB, 0x2E110A62,
+    0x77B417DF, 0x2D553AFC,
+    0x77FAB989, 0x2C98FBBA,
+    0x78403329, 0x2BDC4E6F,
+    0x78848414, 0x2B1F34EB,
+    0x78C7ABA2, 0x2A61B101,
+    0x7909A92D, 0x29A3C485,
+    0x794A7C12, 0x28E5714B,
+    0x798A23B1, 0x2826B928,
+    0x79C89F6E, 0x27679DF4,
+    0x7A05EEAD, 0x26A82186,
+    0x7A4210D8, 0x25E845B6,
+    0x7A7D055B, 0x25280C5E,
+    0x7AB6CBA4, 0x24677758,
+    0x7AEF6323, 0x23A6887F,
+    0x7B26CB4F, 0x22E541AF,
+    0x7B5D039E, 0x2223A4C5,
+    0x7B920B89, 0x2161B3A0,
+    0x7BC5E290, 0x209F701C,
+    0x7BF88830, 0x1FDCDC1B,
+    0x7C29FBEE, 0x1F19F97B,
+    0x7C5A3D50, 0x1E56CA1E,
+    0x7C894BDE, 0x1D934FE5,
+    0x7CB72724, 0x1CCF8CB3,
+    0x7CE3CEB2, 0x1C0B826A,
+    0x7D0F4218, 0x1B4732EF,
+    0x7D3980EC, 0x1A82A026,
+    0x7D628AC6, 0x19BDCBF3,
+    0x7D8A5F40, 0x18F8B83C,
+    0x7DB0FDF8, 0x183366E9,
+    0x7DD6668F, 0x176DD9DE,
+    0x7DFA98A8, 0x16A81305,
+    0x7E1D93EA, 0x15E21445,
+    0x7E3F57FF, 0x151BDF86,
+    0x7E5FE493, 0x145576B1,
+    0x7E7F3957, 0x138EDBB1,
+    0x7E9D55FC, 0x12C8106F,
+    0x7EBA3A39, 0x120116D5,
+    0x7ED5E5C6, 0x1139F0CF,
+    0x7EF05860, 0x1072A048,
+    0x7F0991C4, 0x0FAB272B,
+    0x7F2191B4, 0x0EE38766,
+    0x7F3857F6, 0x0E1BC2E4,
+    0x7F4DE451, 0x0D53DB92,
+    0x7F62368F, 0x0C8BD35E,
+    0x7F754E80, 0x0BC3AC35,
+    0x7F872BF3, 0x0AFB6805,
+    0x7F97CEBD, 0x0A3308BD,
+    0x7FA736B4, 0x096A9049,
+    0x7FB563B3, 0x08A2009A,
+    0x7FC25596, 0x07D95B9E,
+    0x7FCE0C3E, 0x0710A345,
+    0x7FD8878E, 0x0647D97C,
+    0x7FE1C76B, 0x057F0035,
+    0x7FE9CBC0, 0x04B6195D,
+    0x7FF09478, 0x03ED26E6,
+    0x7FF62182, 0x03242ABF,
+    0x7FFA72D1, 0x025B26D7,
+    0x7FFD885A, 0x01921D20,
+    0x7FFF6216, 0x00C90F88,
+    0x7FFFFFFF, 0x00000000,
+    0x7FFF6216, 0xFF36F078,
+    0x7FFD885A, 0xFE6DE2E0,
+    0x7FFA72D1, 0xFDA4D929,
+    0x7FF62182, 0xFCDBD541,
+    0x7FF09478, 0xFC12D91A,
+    0x7FE9CBC0, 0xFB49E6A3,
+    0x7FE1C76B, 0xFA80FFCB,
+    0x7FD8878E, 0xF9B82684,
+    0x7FCE0C3E, 0xF8EF5CBB,
+    0x7FC25596, 0xF826A462,
+    0x7FB563B3, 0xF75DFF66,
+    0x7FA736B4, 0xF6956FB7,
+    0x7F97CEBD, 0xF5CCF743,
+    0x7F872BF3, 0xF50497FB,
+    0x7F754E80, 0xF43C53CB,
+    0x7F62368F, 0xF3742CA2,
+    0x7F4DE451, 0xF2AC246E,
+    0x7F3857F6, 0xF1E43D1C,
+    0x7F2191B4, 0xF11C789A,
+    0x7F0991C4, 0xF054D8D5,
+    0x7EF05860, 0xEF8D5FB8,
+    0x7ED5E5C6, 0xEEC60F31,
+    0x7EBA3A39, 0xEDFEE92B,
+    0x7E9D55FC, 0xED37EF91,
+    0x7E7F3957, 0xEC71244F,
+    0x7E5FE493, 0xEBAA894F,
+    0x7E3F57FF, 0xEAE4207A,
+    0x7E1D93EA, 0xEA1DEBBB,
+    0x7DFA98A8, 0xE957ECFB,
+    0x7DD6668F, 0xE8922622,
+    0x7DB0FDF8, 0xE7CC9917,
+    0x7D8A5F40, 0xE70747C4,
+    0x7D628AC6, 0xE642340D,
+    0x7D3980EC, 0xE57D5FDA,
+    0x7D0F4218, 0xE4B8CD11,
+    0x7CE3CEB2, 0xE3F47D96,
+    0x7CB72724, 0xE330734D,
+    0x7C894BDE, 0xE26CB01B,
+    0x7C5A3D50, 0xE1A935E2,
+    0x7C29FBEE, 0xE0E60685,
+    0x7BF88830, 0xE02323E5,
+    0x7BC5E290, 0xDF608FE4,
+    0x7B920B89, 0xDE9E4C60,
+    0x7B5D039E, 0xDDDC5B3B,
+    0x7B26CB4F, 0xDD1ABE51,
+    0x7AEF6323, 0xDC597781,
+    0x7AB6CBA4, 0xDB9888A8,
+    0x7A7D055B, 0xDAD7F3A2,
+    0x7A4210D8, 0xDA17BA4A,
+    0x7A05EEAD, 0xD957DE7A,
+    0x79C89F6E, 0xD898620C,
+    0x798A23B1, 0xD7D946D8,
+    0x794A7C12, 0xD71A8EB5,
+    0x7909A92D, 0xD65C3B7B,
+    0x78C7ABA2, 0xD59E4EFF,
+    0x78848414, 0xD4E0CB15,
+    0x78403329, 0xD423B191,
+    0x77FAB989, 0xD3670446,
+    0x77B417DF, 0xD2AAC504,
+    0x776C4EDB, 0xD1EEF59E,
+    0x77235F2D, 0xD13397E2,
+    0x76D94989, 0xD078AD9E,
+    0x768E0EA6, 0xCFBE389F,
+    0x7641AF3D, 0xCF043AB3,
+    0x75F42C0B, 0xCE4AB5A2,
+    0x75A585CF, 0xCD91AB39,
+    0x7555BD4C, 0xCCD91D3D,
+    0x7504D345, 0xCC210D79,
+    0x74B2C884, 0xCB697DB0,
+    0x745F9DD1, 0xCAB26FA9,
+    0x740B53FB, 0xC9FBE527,
+    0x73B5EBD1, 0xC945DFEC,
+    0x735F6626, 0xC89061BA,
+    0x7307C3D0, 0xC7DB6C50,
+    0x72AF05A7, 0xC727016D,
+    0x72552C85, 0xC67322CE,
+    0x71FA3949, 0xC5BFD22E,
+    0x719E2CD2, 0xC50D1149,
+    0x71410805, 0xC45AE1D7,
+    0x70E2CBC6, 0xC3A94590,
+    0x708378FF, 0xC2F83E2A,
+    0x7023109A, 0xC247CD5A,
+    0x6FC19385, 0xC197F4D4,
+    0x6F5F02B2, 0xC0E8B648,
+    0x6EFB5F12, 0xC03A1368,
+    0x6E96A99D, 0xBF8C0DE3,
+    0x6E30E34A, 0xBEDEA765,
+    0x6DCA0D14, 0xBE31E19B,
+    0x6D6227FA, 0xBD85BE30,
+    0x6CF934FC, 0xBCDA3ECB,
+    0x6C8F351C, 0xBC2F6513,
+    0x6C242960, 0xBB8532B0,
+    0x6BB812D1, 0xBADBA943,
+    0x6B4AF279, 0xBA32CA71,
+    0x6ADCC964, 0xB98A97D8,
+    0x6A6D98A4, 0xB8E31319,
+    0x69FD614A, 0xB83C3DD1,
+    0x698C246C, 0xB796199B,
+    0x6919E320, 0xB6F0A812,
+    0x68A69E81, 0xB64BEACD,
+    0x683257AB, 0xB5A7E362,
+    0x67BD0FBD, 0xB5049368,
+    0x6746C7D8, 0xB461FC70,
+    0x66CF8120, 0xB3C0200C,
+    0x66573CBB, 0xB31EFFCC,
+    0x65DDFBD3, 0xB27E9D3C,
+    0x6563BF92, 0xB1DEF9E9,
+    0x64E88926, 0xB140175B,
+    0x646C59BF, 0xB0A1F71D,
+    0x63EF3290, 0xB0049AB3,
+    0x637114CC, 0xAF6803A2,
+    0x62F201AC, 0xAECC336C,
+    0x6271FA69, 0xAE312B92,
+    0x61F1003F, 0xAD96ED92,
+    0x616F146C, 0xACFD7AE8,
+    0x60EC3830, 0xAC64D510,
+    0x60686CCF, 0xABCCFD83,
+    0x5FE3B38D, 0xAB35F5B5,
+    0x5F5E0DB3, 0xAA9FBF1E,
+    0x5ED77C8A, 0xAA0A5B2E,
+    0x5E50015D, 0xA975CB57,
+    0x5DC79D7C, 0xA8E21106,
+    0x5D3E5237, 0xA84F2DAA,
+    0x5CB420E0, 0xA7BD22AC,
+    0x5C290ACC, 0xA72BF174,
+    0x5B9D1154, 0xA69B9B68,
+    0x5B1035CF, 0xA60C21EE,
+    0x5A82799A, 0xA57D8666,
+    0x59F3DE12, 0xA4EFCA31,
+    0x59646498, 0xA462EEAC,
+    0x58D40E8C, 0xA3D6F534,
+    0x5842DD54, 0xA34BDF20,
+    0x57B0D256, 0xA2C1ADC9,
+    0x571DEEFA, 0xA2386284,
+    0x568A34A9, 0xA1AFFEA3,
+    0x55F5A4D2, 0xA1288376,
+    0x556040E2, 0xA0A1F24D,
+    0x54CA0A4B, 0xA01C4C73,
+    0x5433027D, 0x9F979331,
+    0x539B2AF0, 0x9F13C7D0,
+    0x53028518, 0x9E90EB94,
+    0x5269126E, 0x9E0EFFC1,
+    0x51CED46E, 0x9D8E0597,
+    0x5133CC94, 0x9D0DFE54,
+    0x5097FC5E, 0x9C8EEB34,
+    0x4FFB654D, 0x9C10CD70,
+    0x4F5E08E3, 0x9B93A641,
+    0x4EBFE8A5, 0x9B1776DA,
+    0x4E210617, 0x9A9C406E,
+    0x4D8162C4, 0x9A22042D,
+    0x4CE10034, 0x99A8C345,
+    0x4C3FDFF4, 0x99307EE0,
+    0x4B9E0390, 0x98B93828,
+    0x4AFB6C98, 0x9842F043,
+    0x4A581C9E, 0x97CDA855,
+    0x49B41533, 0x9759617F,
+    0x490F57EE, 0x96E61CE0,
+    0x4869E665, 0x9673DB94,
+    0x47C3C22F, 0x96029EB6,
+    0x471CECE7, 0x9592675C,
+    0x46756828, 0x9523369C,
+    0x45CD358F, 0x94B50D87,
+    0x452456BD, 0x9447ED2F,
+    0x447ACD50, 0x93DBD6A0,
+    0x43D09AED, 0x9370CAE4,
+    0x4325C135, 0x9306CB04,
+    0x427A41D0, 0x929DD806,
+    0x41CE1E65, 0x9235F2EC,
+    0x4121589B, 0x91CF1CB6,
+    0x4073F21D, 0x91695663,
+    0x3FC5EC98, 0x9104A0EE,
+    0x3F1749B8, 0x90A0FD4E,
+    0x3E680B2C, 0x903E6C7B,
+    0x3DB832A6, 0x8FDCEF66,
+    0x3D07C1D6, 0x8F7C8701,
+    0x3C56BA70, 0x8F1D343A,
+    0x3BA51E29, 0x8EBEF7FB,
+    0x3AF2EEB7, 0x8E61D32E,
+    0x3A402DD2, 0x8E05C6B7,
+    0x398CDD32, 0x8DAAD37B,
+    0x38D8FE93, 0x8D50FA59,
+    0x382493B0, 0x8CF83C30,
+    0x376F9E46, 0x8CA099DA,
+    0x36BA2014, 0x8C4A142F,
+    0x36041AD9, 0x8BF4AC05,
+    0x354D9057, 0x8BA0622F,
+    0x34968250, 0x8B4D377C,
+    0x33DEF287, 0x8AFB2CBB,
+    0x3326E2C3, 0x8AAA42B4,
+    0x326E54C7, 0x8A5A7A31,
+    0x31B54A5E, 0x8A0BD3F5,
+    0x30FBC54D, 0x89BE50C3,
+    0x3041C761, 0x8971F15A,
+    0x2F875262, 0x8926B677,
+    0x2ECC681E, 0x88DCA0D3,
+    0x2E110A62, 0x8893B125,
+    0x2D553AFC, 0x884BE821,
+    0x2C98FBBA, 0x88054677,
+    0x2BDC4E6F, 0x87BFCCD7,
+    0x2B1F34EB, 0x877B7BEC,
+    0x2A61B101, 0x8738545E,
+    0x29A3C485, 0x86F656D3,
+    0x28E5714B, 0x86B583EE,
+    0x2826B928, 0x8675DC4F,
+    0x27679DF4, 0x86376092,
+    0x26A82186, 0x85FA1153,
+    0x25E845B6, 0x85BDEF28,
+    0x25280C5E, 0x8582FAA5,
+    0x24677758, 0x8549345C,
+    0x23A6887F, 0x85109CDD,
+    0x22E541AF, 0x84D934B1,
+    0x2223A4C5, 0x84A2FC62,
+    0x2161B3A0, 0x846DF477,
+    0x209F701C, 0x843A1D70,
+    0x1FDCDC1B, 0x840777D0,
+    0x1F19F97B, 0x83D60412,
+    0x1E56CA1E, 0x83A5C2B0,
+    0x1D934FE5, 0x8376B422,
+    0x1CCF8CB3, 0x8348D8DC,
+    0x1C0B826A, 0x831C314E,
+    0x1B4732EF, 0x82F0BDE8,
+    0x1A82A026, 0x82C67F14,
+    0x19BDCBF3, 0x829D753A,
+    0x18F8B83C, 0x8275A0C0,
+    0x183366E9, 0x824F0208,
+    0x176DD9DE, 0x82299971,
+    0x16A81305, 0x82056758,
+    0x15E21445, 0x81E26C16,
+    0x151BDF86, 0x81C0A801,
+    0x145576B1, 0x81A01B6D,
+    0x138EDBB1, 0x8180C6A9,
+    0x12C8106F, 0x8162AA04,
+    0x120116D5, 0x8145C5C7,
+    0x1139F0CF, 0x812A1A3A,
+    0x1072A048, 0x810FA7A0,
+    0x0FAB272B, 0x80F66E3C,
+    0x0EE38766, 0x80DE6E4C,
+    0x0E1BC2E4, 0x80C7A80A,
+    0x0D53DB92, 0x80B21BAF,
+    0x0C8BD35E, 0x809DC971,
+    0x0BC3AC35, 0x808AB180,
+    0x0AFB6805, 0x8078D40D,
+    0x0A3308BD, 0x80683143,
+    0x096A9049, 0x8058C94C,
+    0x08A2009A, 0x804A9C4D,
+    0x07D95B9E, 0x803DAA6A,
+    0x0710A345, 0x8031F3C2,
+    0x0647D97C, 0x80277872,
+    0x057F0035, 0x801E3895,
+    0x04B6195D, 0x80163440,
+    0x03ED26E6, 0x800F6B88,
+    0x03242ABF, 0x8009DE7E,
+    0x025B26D7, 0x80058D2F,
+    0x01921D20, 0x800277A6,
+    0x00C90F88, 0x80009DEA
+};
+
+/**    
+* \par    
+* Example code for Q31 RFFT Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i < N/2; i++)    
+* {    
+*    twiddleCoefRfftQ31[2*i]= sin(i * 2*PI/(float)N);    
+*    twiddleCoefRfftQ31[2*i+1]= cos(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 2048	and PI = 3.14159265358979    
+* \par    
+* Same layout as twiddleCoef_rfft_2048, converted to Q31(Fixed point 1.31):    
+*	round(twiddleCoefRfftQ31(i) * pow(2, 31)), saturated to 0x7FFFFFFF    
+*/
+const q31_t twiddleCoef_rfft_2048_q31[2048] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_2048_q31) = {
+    0x00000000, 0x7FFFFFFF,
+    0x006487E3, 0x7FFFD886,
+    0x00C90F88, 0x7FFF6216,
+    0x012D96B1, 0x7FFE9CB2,
+    0x01921D20, 0x7FFD885A,
+    0x01F6A297, 0x7FFC250F,
+    0x025B26D7, 0x7FFA72D1,
+    0x02BFA9A4, 0x7FF871A2,
+    0x03242ABF, 0x7FF62182,
+    0x0388A9EA, 0x7FF38274,
+    0x03ED26E6, 0x7FF09478,
+    0x0451A177, 0x7FED5791,
+    0x04B6195D, 0x7FE9CBC0,
+    0x051A8E5C, 0x7FE5F108,
+    0x057F0035, 0x7FE1C76B,
+    0x05E36EA9, 0x7FDD4EEC,
+    0x0647D97C, 0x7FD8878E,
+    0x06AC406F, 0x7FD37153,
+    0x0710A345, 0x7FCE0C3E,
+    0x077501BE, 0x7FC85854,
+    0x07D95B9E, 0x7FC25596,
+    0x083DB0A7, 0x7FBC040A,
+    0x08A2009A, 0x7FB563B3,
+    0x09064B3A, 0x7FAE7495,
+    0x096A9049, 0x7FA736B4,
+    0x09CECF89, 0x7F9FAA15,
+    0x0A3308BD, 0x7F97CEBD,
+    0x0A973BA5, 0x7F8FA4B0,
+    0x0AFB6805, 0x7F872BF3,
+    0x0B5F8D9F, 0x7F7E648C,
+    0x0BC3AC35, 0x7F754E80,
+    0x0C27C389, 0x7F6BE9D4,
+    0x0C8BD35E, 0x7F62368F,
+    0x0CEFDB76, 0x7F5834B7,
+    0x0D53DB92, 0x7F4DE451,
+    0x0DB7D376, 0x7F434563,
+    0x0E1BC2E4, 0x7F3857F6,
+    0x0E7FA99E, 0x7F2D1C0E,
+    0x0EE38766, 0x7F2191B4,
+    0x0F475BFF, 0x7F15B8EE,
+    0x0FAB272B, 0x7F0991C4,
+    0x100EE8AD, 0x7EFD1C3C,
+    0x1072A048, 0x7EF05860,
+    0x10D64DBD, 0x7EE34636,
+    0x1139F0CF, 0x7ED5E5C6,
+    0x119D8941, 0x7EC8371A,
+    0x120116D5, 0x7EBA3A39,
+    0x1264994E, 0x7EABEF2C,
+    0x12C8106F, 0x7E9D55FC,
+    0x132B7BF9, 0x7E8E6EB2,
+    0x138EDBB1, 0x7E7F3957,
+    0x13F22F58, 0x7E6FB5F4,
+    0x145576B1, 0x7E5FE493,
+    0x14B8B17F, 0x7E4FC53E,
+    0x151BDF86, 0x7E3F57FF,
+    0x157F0086, 0x7E2E9CDF,
+    0x15E21445, 0x7E1D93EA,
+    0x16451A83, 0x7E0C3D29,
+    0x16A81305, 0x7DFA98A8,
+    0x170AFD8D, 0x7DE8A670,
+    0x176DD9DE, 0x7DD6668F,
+    0x17D0A7BC, 0x7DC3D90D,
+    0x183366E9, 0x7DB0FDF8,
+    0x18961728, 0x7D9DD55A,
+    0x18F8B83C, 0x7D8A5F40,
+    0x195B49EA, 0x7D769BB5,
+    0x19BDCBF3, 0x7D628AC6,
+    0x1A203E1B, 0x7D4E2C7F,
+    0x1A82A026, 0x7D3980EC,
+    0x1AE4F1D6, 0x7D24881B,
+    0x1B4732EF, 0x7D0F4218,
+    0x1BA96335, 0x7CF9AEF0,
+    0x1C0B826A, 0x7CE3CEB2,
+    0x1C6D9053, 0x7CCDA169,
+    0x1CCF8CB3, 0x7CB72724,
+    0x1D31774D, 0x7CA05FF1,
+    0x1D934FE5, 0x7C894BDE,
+    0x1DF5163F, 0x7C71EAF9,
+    0x1E56CA1E, 0x7C5A3D50,
+    0x1EB86B46, 0x7C4242F2,
+    0x1F19F97B, 0x7C29FBEE,
+    0x1F7B7481, 0x7C116853,
+    0x1FDCDC1B, 0x7BF88830,
+    0x203E300D, 0x7BDF5B94,
+    0x209F701C, 0x7BC5E290,
+    0x21009C0C, 0x7BAC1D31,
+    0x2161B3A0, 0x7B920B89,
+    0x21C2B69C, 0x7B77ADA8,
+    0x2223A4C5, 0x7B5D039E,
+    0x22847DE0, 0x7B420D7A,
+    0x22E541AF, 0x7B26CB4F,
+    0x2345EFF8, 0x7B0B3D2C,
+    0x23A6887F, 0x7AEF6323,
+    0x24070B08, 0x7AD33D45,
+    0x24677758, 0x7AB6CBA4,
+    0x24C7CD33, 0x7A9A0E50,
+    0x25280C5E, 0x7A7D055B,
+    0x2588349D, 0x7A5FB0D8,
+    0x25E845B6, 0x7A4210D8,
+    0x26483F6C, 0x7A24256F,
+    0x26A82186, 0x7A05EEAD,
+    0x2707EBC7, 0x79E76CA7,
+    0x27679DF4, 0x79C89F6E,
+    0x27C737D3, 0x79A98715,
+    0x2826B928, 0x798A23B1,
+    0x288621B9, 0x796A7554,
+    0x28E5714B, 0x794A7C12,
+    0x2944A7A2, 0x792A37FE,
+    0x29A3C485, 0x7909A92D,
+    0x2A02C7B8, 0x78E8CFB2,
+    0x2A61B101, 0x78C7ABA2,
+    0x2AC08026, 0x78A63D11,
+    0x2B1F34EB, 0x78848414,
+    0x2B7DCF17, 0x786280BF,
+    0x2BDC4E6F, 0x78403329,
+    0x2C3AB2B9, 0x781D9B65,
+    0x2C98FBBA, 0x77FAB989,
+    0x2CF72939, 0x77D78DAA,
+    0x2D553AFC, 0x77B417DF,
+    0x2DB330C7, 0x7790583E,
+    0x2E110A62, 0x776C4EDB,
+    0x2E6EC792, 0x7747FBCE,
+    0x2ECC681E, 0x77235F2D,
+    0x2F29EBCC, 0x76FE790E,
+    0x2F875262, 0x76D94989,
+    0x2FE49BA7, 0x76B3D0B4,
+    0x3041C761, 0x768E0EA6,
+    0x309ED556, 0x76680376,
+    0x30FBC54D, 0x7641AF3D,
+    0x3158970E, 0x761B1211,
+    0x31B54A5E, 0x75F42C0B,
+    0x3211DF04, 0x75CCFD42,
+    0x326E54C7, 0x75A585CF,
+    0x32CAAB6F, 0x757DC5CA,
+    0x3326E2C3, 0x7555BD4C,
+    0x3382FA88, 0x752D6C6C,
+    0x33DEF287, 0x7504D345,
+    0x343ACA87, 0x74DBF1EF,
+    0x34968250, 0x74B2C884,
+    0x34F219A8, 0x7489571C,
+    0x354D9057, 0x745F9DD1,
+    0x35A8E625, 0x74359CBD,
+    0x36041AD9, 0x740B53FB,
+    0x365F2E3B, 0x73E0C3A3,
+    0x36BA2014, 0x73B5EBD1,
+    0x3714F02A, 0x738ACC9E,
+    0x376F9E46, 0x735F6626,
+    0x37CA2A30, 0x7333B883,
+    0x382493B0, 0x7307C3D0,
+    0x387EDA8E, 0x72DB8828,
+    0x38D8FE93, 0x72AF05A7,
+    0x3932FF87, 0x72823C67,
+    0x398CDD32, 0x72552C85,
+    0x39E6975E, 0x7227D61C,
+    0x3A402DD2, 0x71FA3949,
+    0x3A99A057, 0x71CC5626,
+    0x3AF2EEB7, 0x719E2CD2,
+    0x3B4C18BA, 0x716FBD68,
+    0x3BA51E29, 0x71410805,
+    0x3BFDFECD, 0x71120CC5,
+    0x3C56BA70, 0x70E2CBC6,
+    0x3CAF50DA, 0x70B34525,
+    0x3D07C1D6, 0x708378FF,
+    0x3D600D2C, 0x70536771,
+    0x3DB832A6, 0x7023109A,
+    0x3E10320D, 0x6FF27497,
+    0x3E680B2C, 0x6FC19385,
+    0x3EBFBDCD, 0x6F906D84,
+    0x3F1749B8, 0x6F5F02B2,
+    0x3F6EAEB8, 0x6F2D532C,
+    0x3FC5EC98, 0x6EFB5F12,
+    0x401D0321, 0x6EC92683,
+    0x4073F21D, 0x6E96A99D,
+    0x40CAB958, 0x6E63E87F,
+    0x4121589B, 0x6E30E34A,
+    0x4177CFB1, 0x6DFD9A1C,
+    0x41CE1E65, 0x6DCA0D14,
+    0x42244481, 0x6D963C54,
+    0x427A41D0, 0x6D6227FA,
+    0x42D0161E, 0x6D2DD027,
+    0x4325C135, 0x6CF934FC,
+    0x437B42E1, 0x6CC45698,
+    0x43D09AED, 0x6C8F351C,
+    0x4425C923, 0x6C59D0A9,
+    0x447ACD50, 0x6C242960,
+    0x44CFA740, 0x6BEE3F62,
+    0x452456BD, 0x6BB812D1,
+    0x4578DB93, 0x6B81A3CD,
+    0x45CD358F, 0x6B4AF279,
+    0x4621647D, 0x6B13FEF5,
+    0x46756828, 0x6ADCC964,
+    0x46C9405C, 0x6AA551E9,
+    0x471CECE7, 0x6A6D98A4,
+    0x47706D93, 0x6A359DB9,
+    0x47C3C22F, 0x69FD614A,
+    0x4816EA86, 0x69C4E37A,
+    0x4869E665, 0x698C246C,
+    0x48BCB599, 0x69532442,
+    0x490F57EE, 0x6919E320,
+    0x4961CD33, 0x68E06129,
+    0x49B41533, 0x68A69E81,
+    0x4A062FBD, 0x686C9B4B,
+    0x4A581C9E, 0x683257AB,
+    0x4AA9DBA2, 0x67F7D3C5,
+    0x4AFB6C98, 0x67BD0FBD,
+    0x4B4CCF4D, 0x67820BB7,
+    0x4B9E0390, 0x6746C7D8,
+    0x4BEF092D, 0x670B4444,
+    0x4C3FDFF4, 0x66CF8120,
+    0x4C9087B1, 0x66937E91,
+    0x4CE10034, 0x66573CBB,
+    0x4D31494B, 0x661ABBC5,
+    0x4D8162C4, 0x65DDFBD3,
+    0x4DD14C6E, 0x65A0FD0B,
+    0x4E210617, 0x6563BF92,
+    0x4E708F8F, 0x6526438F,
+    0x4EBFE8A5, 0x64E88926,
+    0x4F0F1126, 0x64AA907F,
+    0x4F5E08E3, 0x646C59BF,
+    0x4FACCFAB, 0x642DE50D,
+    0x4FFB654D, 0x63EF3290,
+    0x5049C999, 0x63B0426D,
+    0x5097FC5E, 0x637114CC,
+    0x50E5FD6D, 0x6331A9D4,
+    0x5133CC94, 0x62F201AC,
+    0x518169A5, 0x62B21C7B,
+    0x51CED46E, 0x6271FA69,
+    0x521C0CC2, 0x62319B9D,
+    0x5269126E, 0x61F1003F,
+    0x52B5E546, 0x61B02876,
+    0x53028518, 0x616F146C,
+    0x534EF1B5, 0x612DC447,
+    0x539B2AF0, 0x60EC3830,
+    0x53E73097, 0x60AA7050,
+    0x5433027D, 0x60686CCF,
+    0x547EA073, 0x60262DD6,
+    0x54CA0A4B, 0x5FE3B38D,
+    0x55153FD4, 0x5FA0FE1F,
+    0x556040E2, 0x5F5E0DB3,
+    0x55AB0D46, 0x5F1AE274,
+    0x55F5A4D2, 0x5ED77C8A,
+    0x56400758, 0x5E93DC1F,
+    0x568A34A9, 0x5E50015D,
+    0x56D42C99, 0x5E0BEC6E,
+    0x571DEEFA, 0x5DC79D7C,
+    0x57677B9D, 0x5D8314B1,
+    0x57B0D256, 0x5D3E5237,
+    0x57F9F2F8, 0x5CF95638,
+    0x5842DD54, 0x5CB420E0,
+    0x588B9140, 0x5C6EB258,
+    0x58D40E8C, 0x5C290ACC,
+    0x591C550E, 0x5BE32A67,
+    0x59646498, 0x5B9D1154,
+    0x59AC3CFD, 0x5B56BFBD,
+    0x59F3DE12, 0x5B1035CF,
+    0x5A3B47AB, 0x5AC973B5,
+    0x5A82799A, 0x5A82799A,
+    0x5AC973B5, 0x5A3B47AB,
+    0x5B1035CF, 0x59F3DE12,
+    0x5B56BFBD, 0x59AC3CFD,
+    0x5B9D1154, 0x59646498,
+    0x5BE32A67, 0x591C550E,
+    0x5C290ACC, 0x58D40E8C,
+    0x5C6EB258, 0x588B9140,
+    0x5CB420E0, 0x5842DD54,
+    0x5CF95638, 0x57F9F2F8,
+    0x5D3E5237, 0x57B0D256,
+    0x5D8314B1, 0x57677B9D,
+    0x5DC79D7C, 0x571DEEFA,
+    0x5E0BEC6E, 0x56D42C99,
+    0x5E50015D, 0x568A34A9,
+    0x5E93DC1F, 0x56400758,
+    0x5ED77C8A, 0x55F5A4D2,
+    0x5F1AE274, 0x55AB0D46,
+    0x5F5E0DB3, 0x556040E2,
+    0x5FA0FE1F, 0x55153FD4,
+    0x5FE3B38D, 0x54CA0A4B,
+    0x60262DD6, 0x547EA073,
+    0x60686CCF, 0x5433027D,
+    0x60AA7050, 0x53E73097,
+    0x60EC3830, 0x539B2AF0,
+    0x612DC447, 0x534EF1B5,
+    0x616F146C, 0x53028518,
+    0x61B02876, 0x52B5E546,
+    0x61F1003F, 0x5269126E,
+    0x62319B9D, 0x521C0CC2,
+    0x6271FA69, 0x51CED46E,
+    0x62B21C7B, 0x518169A5,
+    0x62F201AC, 0x5133CC94,
+    0x6331A9D4, 0x50E5FD6D,
+    0x637114CC, 0x5097FC5E,
+    0x63B0426D, 0x5049C999,
+    0x63EF3290, 0x4FFB654D,
+    0x642DE50D, 0x4FACCFAB,
+    0x646C59BF, 0x4F5E08E3,
+    0x64AA907F, 0x4F0F1126,
+    0x64E88926, 0x4EBFE8A5,
+    0x6526438F, 0x4E708F8F,
+    0x6563BF92, 0x4E210617,
+    0x65A0FD0B, 0x4DD14C6E,
+    0x65DDFBD3, 0x4D8162C4,
+    0x661ABBC5, 0x4D31494B,
+    0x66573CBB, 0x4CE10034,
+    0x66937E91, 0x4C9087B1,
+    0x66CF8120, 0x4C3FDFF4,
+    0x670B4444, 0x4BEF092D,
+    0x6746C7D8, 0x4B9E0390,
+    0x67820BB7, 0x4B4CCF4D,
+    0x67BD0FBD, 0x4AFB6C98,
+    0x67F7D3C5, 0x4AA9DBA2,
+    0x683257AB, 0x4A581C9E,
+    0x686C9B4B, 0x4A062FBD,
+    0x68A69E81, 0x49B41533,
+    0x68E06129, 0x4961CD33,
+    0x6919E320, 0x490F57EE,
+    0x69532442, 0x48BCB599,
+    0x698C246C, 0x4869E665,
+    0x69C4E37A, 0x4816EA86,
+    0x69FD614A, 0x47C3C22F,
+    0x6A359DB9, 0x47706D93,
+    0x6A6D98A4, 0x471CECE7,
+    0x6AA551E9, 0x46C9405C,
+    0x6ADCC964, 0x46756828,
+    0x6B13FEF5, 0x4621647D,
+    0x6B4AF279, 0x45CD358F,
+    0x6B81A3CD, 0x4578DB93,
+    0x6BB812D1, 0x452456BD,
+    0x6BEE3F62, 0x44CFA740,
+    0x6C242960, 0x447ACD50,
+    0x6C59D0A9, 0x4425C923,
+    0x6C8F351C, 0x43D09AED,
+    0x6CC45698, 0x437B42E1,
+    0x6CF934FC, 0x4325C135,
+    0x6D2DD027, 0x42D0161E,
+    0x6D6227FA, 0x427A41D0,
+    0x6D963C54, 0x42244481,
+    0x6DCA0D14, 0x41CE1E65,
+    0x6DFD9A1C, 0x4177CFB1,
+    0x6E30E34A, 0x4121589B,
+    0x6E63E87F, 0x40CAB958,
+    0x6E96A99D, 0x4073F21D,
+    0x6EC92683, 0x401D0321,
+    0x6EFB5F12, 0x3FC5EC98,
+    0x6F2D532C, 0x3F6EAEB8,
+    0x6F5F02B2, 0x3F1749B8,
+    0x6F906D84, 0x3EBFBDCD,
+    0x6FC19385, 0x3E680B2C,
+    0x6FF27497, 0x3E10320D,
+    0x7023109A, 0x3DB832A6,
+    0x70536771, 0x3D600D2C,
+    0x708378FF, 0x3D07C1D6,
+    0x70B34525, 0x3CAF50DA,
+    0x70E2CBC6, 0x3C56BA70,
+    0x71120CC5, 0x3BFDFECD,
+    0x71410805, 0x3BA51E29,
+    0x716FBD68, 0x3B4C18BA,
+    0x719E2CD2, 0x3AF2EEB7,
+    0x71CC5626, 0x3A99A057,
+    0x71FA3949, 0x3A402DD2,
+    0x7227D61C, 0x39E6975E,
+    0x72552C85, 0x398CDD32,
+    0x72823C67, 0x3932FF87,
+    0x72AF05A7, 0x38D8FE93,
+    0x72DB8828, 0x387EDA8E,
+    0x7307C3D0, 0x382493B0,
+    0x7333B883, 0x37CA2A30,
+    0x735F6626, 0x376F9E46,
+    0x738ACC9E, 0x3714F02A,
+    0x73B5EBD1, 0x36BA2014,
+    0x73E0C3A3, 0x365F2E3B,
+    0x740B53FB, 0x36041AD9,
+    0x74359CBD, 0x35A8E625,
+    0x745F9DD1, 0x354D9057,
+    0x7489571C, 0x34F219A8,
+    0x74B2C884, 0x34968250,
+    0x74DBF1EF, 0x343ACA87,
+    0x7504D345, 0x33DEF287,
+    0x752D6C6C, 0x3382FA88,
+    0x7555BD4C, 0x3326E2C3,
+    0x757DC5CA, 0x32CAAB6F,
+    0x75A585CF, 0x326E54C7,
+    0x75CCFD42, 0x3211DF04,
+    0x75F42C0B, 0x31B54A5E,
+    0x761B1211, 0x3158970E,
+    0x7641AF3D, 0x30FBC54D,
+    0x76680376, 0x309ED556,
+    0x768E0EA6, 0x3041C761,
+    0x76B3D0B4, 0x2FE49BA7,
+    0x76D94989, 0x2F875262,
+    0x76FE790E, 0x2F29EBCC,
+    0x77235F2D, 0x2ECC681E,
+    0x7747FBCE, 0x2E6EC792,
+    0x776C4EDB, 0x2E110A62,
+    0x7790583E, 0x2DB330C7,
+    0x77B417DF, 0x2D553AFC,
+    0x77D78DAA, 0x2CF72939,
+    0x77FAB989, 0x2C98FBBA,
+    0x781D9B65, 0x2C3AB2B9,
+    0x78403329, 0x2BDC4E6F,
+    0x786280BF, 0x2B7DCF17,
+    0x78848414, 0x2B1F34EB,
+    0x78A63D11, 0x2AC08026,
+    0x78C7ABA2, 0x2A61B101,
+    0x78E8CFB2, 0x2A02C7B8,
+    0x7909A92D, 0x29A3C485,
+    0x792A37FE, 0x2944A7A2,
+    0x794A7C12, 0x28E5714B,
+    0x796A7554, 0x288621B9,
+    0x798A23B1, 0x2826B928,
+    0x79A98715, 0x27C737D3,
+    0x79C89F6E, 0x27679DF4,
+    0x79E76CA7, 0x2707EBC7,
+    0x7A05EEAD, 0x26A82186,
+    0x7A24256F, 0x26483F6C,
+    0x7A4210D8, 0x25E845B6,
+    0x7A5FB0D8, 0x2588349D,
+    0x7A7D055B, 0x25280C5E,
+    0x7A9A0E50, 0x24C7CD33,
+    0x7AB6CBA4, 0x24677758,
+    0x7AD33D45, 0x24070B08,
+    0x7AEF6323, 0x23A6887F,
+    0x7B0B3D2C, 0x2345EFF8,
+    0x7B26CB4F, 0x22E541AF,
+    0x7B420D7A, 0x22847DE0,
+    0x7B5D039E, 0x2223A4C5,
+    0x7B77ADA8, 0x21C2B69C,
+    0x7B920B89, 0x2161B3A0,
+    0x7BAC1D31, 0x21009C0C,
+    0x7BC5E290, 0x209F701C,
+    0x7BDF5B94, 0x203E300D,
+    0x7BF88830, 0x1FDCDC1B,
+    0x7C116853, 0x1F7B7481,
+    0x7C29FBEE, 0x1F19F97B,
+    0x7C4242F2, 0x1EB86B46,
+    0x7C5A3D50, 0x1E56CA1E,
+    0x7C71EAF9, 0x1DF5163F,
+    0x7C894BDE, 0x1D934FE5,
+    0x7CA05FF1, 0x1D31774D,
+    0x7CB72724, 0x1CCF8CB3,
+    0x7CCDA169, 0x1C6D9053,
+    0x7CE3CEB2, 0x1C0B826A,
+    0x7CF9AEF0, 0x1BA96335,
+    0x7D0F4218, 0x1B4732EF,
+    0x7D24881B, 0x1AE4F1D6,
+    0x7D3980EC, 0x1A82A026,
+    0x7D4E2C7F, 0x1A203E1B,
+    0x7D628AC6, 0x19BDCBF3,
+    0x7D769BB5, 0x195B49EA,
+    0x7D8A5F40, 0x18F8B83C,
+    0x7D9DD55A, 0x18961728,
+    0x7DB0FDF8, 0x183366E9,
+    0x7DC3D90D, 0x17D0A7BC,
+    0x7DD6668F, 0x176DD9DE,
+    0x7DE8A670, 0x170AFD8D,
+    0x7DFA98A8, 0x16A81305,
+    0x7E0C3D29, 0x16451A83,
+    0x7E1D93EA, 0x15E21445,
+    0x7E2E9CDF, 0x157F0086,
+    0x7E3F57FF, 0x151BDF86,
+    0x7E4FC53E, 0x14B8B17F,
+    0x7E5FE493, 0x145576B1,
+    0x7E6FB5F4, 0x13F22F58,
+    0x7E7F3957, 0x138EDBB1,
+    0x7E8E6EB2, 0x132B7BF9,
+    0x7E9D55FC, 0x12C8106F,
+    0x7EABEF2C, 0x1264994E,
+    0x7EBA3A39, 0x120116D5,
+    0x7EC8371A, 0x119D8941,
+    0x7ED5E5C6, 0x1139F0CF,
+    0x7EE34636, 0x10D64DBD,
+    0x7EF05860, 0x1072A048,
+    0x7EFD1C3C, 0x100EE8AD,
+    0x7F0991C4, 0x0FAB272B,
+    0x7F15B8EE, 0x0F475BFF,
+    0x7F2191B4, 0x0EE38766,
+    0x7F2D1C0E, 0x0E7FA99E,
+    0x7F3857F6, 0x0E1BC2E4,
+    0x7F434563, 0x0DB7D376,
+    0x7F4DE451, 0x0D53DB92,
+    0x7F5834B7, 0x0CEFDB76,
+    0x7F62368F, 0x0C8BD35E,
+    0x7F6BE9D4, 0x0C27C389,
+    0x7F754E80, 0x0BC3AC35,
+    0x7F7E648C, 0x0B5F8D9F,
+    0x7F872BF3, 0x0AFB6805,
+    0x7F8FA4B0, 0x0A973BA5,
+    0x7F97CEBD, 0x0A3308BD,
+    0x7F9FAA15, 0x09CECF89,
+    0x7FA736B4, 0x096A9049,
+    0x7FAE7495, 0x09064B3A,
+    0x7FB563B3, 0x08A2009A,
+    0x7FBC040A, 0x083DB0A7,
+    0x7FC25596, 0x07D95B9E,
+    0x7FC85854, 0x077501BE,
+    0x7FCE0C3E, 0x0710A345,
+    0x7FD37153, 0x06AC406F,
+    0x7FD8878E, 0x0647D97C,
+    0x7FDD4EEC, 0x05E36EA9,
+    0x7FE1C76B, 0x057F0035,
+    0x7FE5F108, 0x051A8E5C,
+    0x7FE9CBC0, 0x04B6195D,
+    0x7FED5791, 0x0451A177,
+    0x7FF09478, 0x03ED26E6,
+    0x7FF38274, 0x0388A9EA,
+    0x7FF62182, 0x03242ABF,
+    0x7FF871A2, 0x02BFA9A4,
+    0x7FFA72D1, 0x025B26D7,
+    0x7FFC250F, 0x01F6A297,
+    0x7FFD885A, 0x01921D20,
+    0x7FFE9CB2, 0x012D96B1,
+    0x7FFF6216, 0x00C90F88,
+    0x7FFFD886, 0x006487E3,
+    0x7FFFFFFF, 0x00000000,
+    0x7FFFD886, 0xFF9B781D,
+    0x7FFF6216, 0xFF36F078,
+    0x7FFE9CB2, 0xFED2694F,
+    0x7FFD885A, 0xFE6DE2E0,
+    0x7FFC250F, 0xFE095D69,
+    0x7FFA72D1, 0xFDA4D929,
+    0x7FF871A2, 0xFD40565C,
+    0x7FF62182, 0xFCDBD541,
+    0x7FF38274, 0xFC775616,
+    0x7FF09478, 0xFC12D91A,
+    0x7FED5791, 0xFBAE5E89,
+    0x7FE9CBC0, 0xFB49E6A3,
+    0x7FE5F108, 0xFAE571A4,
+    0x7FE1C76B, 0xFA80FFCB,
+    0x7FDD4EEC, 0xFA1C9157,
+    0x7FD8878E, 0xF9B82684,
+    0x7FD37153, 0xF953BF91,
+    0x7FCE0C3E, 0xF8EF5CBB,
+    0x7FC85854, 0xF88AFE42,
+    0x7FC25596, 0xF826A462,
+    0x7FBC040A, 0xF7C24F59,
+    0x7FB563B3, 0xF75DFF66,
+    0x7FAE7495, 0xF6F9B4C6,
+    0x7FA736B4, 0xF6956FB7,
+    0x7F9FAA15, 0xF6313077,
+    0x7F97CEBD, 0xF5CCF743,
+    0x7F8FA4B0, 0xF568C45B,
+    0x7F872BF3, 0xF50497FB,
+    0x7F7E648C, 0xF4A07261,
+    0x7F754E80, 0xF43C53CB,
+    0x7F6BE9D4, 0xF3D83C77,
+    0x7F62368F, 0xF3742CA2,
+    0x7F5834B7, 0xF310248A,
+    0x7F4DE451, 0xF2AC246E,
+    0x7F434563, 0xF2482C8A,
+    0x7F3857F6, 0xF1E43D1C,
+    0x7F2D1C0E, 0xF1805662,
+    0x7F2191B4, 0xF11C789A,
+    0x7F15B8EE, 0xF0B8A401,
+    0x7F0991C4, 0xF054D8D5,
+    0x7EFD1C3C, 0xEFF11753,
+    0x7EF05860, 0xEF8D5FB8,
+    0x7EE34636, 0xEF29B243,
+    0x7ED5E5C6, 0xEEC60F31,
+    0x7EC8371A, 0xEE6276BF,
+    0x7EBA3A39, 0xEDFEE92B,
+    0x7EABEF2C, 0xED9B66B2,
+    0x7E9D55FC, 0xED37EF91,
+    0x7E8E6EB2, 0xECD48407,
+    0x7E7F3957, 0xEC71244F,
+    0x7E6FB5F4, 0xEC0DD0A8,
+    0x7E5FE493, 0xEBAA894F,
+    0x7E4FC53E, 0xEB474E81,
+    0x7E3F57FF, 0xEAE4207A,
+    0x7E2E9CDF, 0xEA80FF7A,
+    0x7E1D93EA, 0xEA1DEBBB,
+    0x7E0C3D29, 0xE9BAE57D,
+    0x7DFA98A8, 0xE957ECFB,
+    0x7DE8A670, 0xE8F50273,
+    0x7DD6668F, 0xE8922622,
+    0x7DC3D90D, 0xE82F5844,
+    0x7DB0FDF8, 0xE7CC9917,
+    0x7D9DD55A, 0xE769E8D8,
+    0x7D8A5F40, 0xE70747C4,
+    0x7D769BB5, 0xE6A4B616,
+    0x7D628AC6, 0xE642340D,
+    0x7D4E2C7F, 0xE5DFC1E5,
+    0x7D3980EC, 0xE57D5FDA,
+    0x7D24881B, 0xE51B0E2A,
+    0x7D0F4218, 0xE4B8CD11,
+    0x7CF9AEF0, 0xE4569CCB,
+    0x7CE3CEB2, 0xE3F47D96,
+    0x7CCDA169, 0xE3926FAD,
+    0x7CB72724, 0xE330734D,
+    0x7CA05FF1, 0xE2CE88B3,
+    0x7C894BDE, 0xE26CB01B,
+    0x7C71EAF9, 0xE20AE9C1,
+    0x7C5A3D50, 0xE1A935E2,
+    0x7C4242F2, 0xE14794BA,
+    0x7C29FBEE, 0xE0E60685,
+    0x7C116853, 0xE0848B7F,
+    0x7BF88830, 0xE02323E5,
+    0x7BDF5B94, 0xDFC1CFF3,
+    0x7BC5E290, 0xDF608FE4,
+    0x7BAC1D31, 0xDEFF63F4,
+    0x7B920B89, 0xDE9E4C60,
+    0x7B77ADA8, 0xDE3D4964,
+    0x7B5D039E, 0xDDDC5B3B,
+    0x7B420D7A, 0xDD7B8220,
+    0x7B26CB4F, 0xDD1ABE51,
+    0x7B0B3D2C, 0xDCBA1008,
+    0x7AEF6323, 0xDC597781,
+    0x7AD33D45, 0xDBF8F4F8,
+    0x7AB6CBA4, 0xDB9888A8,
+    0x7A9A0E50, 0xDB3832CD,
+    0x7A7D055B, 0xDAD7F3A2,
+    0x7A5FB0D8, 0xDA77CB63,
+    0x7A4210D8, 0xDA17BA4A,
+    0x7A24256F, 0xD9B7C094,
+    0x7A05EEAD, 0xD957DE7A,
+    0x79E76CA7, 0xD8F81439,
+    0x79C89F6E, 0xD898620C,
+    0x79A98715, 0xD838C82D,
+    0x798A23B1, 0xD7D946D8,
+    0x796A7554, 0xD779DE47,
+    0x794A7C12, 0xD71A8EB5,
+    0x792A37FE, 0xD6BB585E,
+    0x7909A92D, 0xD65C3B7B,
+    0x78E8CFB2, 0xD5FD3848,
+    0x78C7ABA2, 0xD59E4EFF,
+    0x78A63D11, 0xD53F7FDA,
+    0x78848414, 0xD4E0CB15,
+    0x786280BF, 0xD48230E9,
+    0x78403329, 0xD423B191,
+    0x781D9B65, 0xD3C54D47,
+    0x77FAB989, 0xD3670446,
+    0x77D78DAA, 0xD308D6C7,
+    0x77B417DF, 0xD2AAC504,
+    0x7790583E, 0xD24CCF39,
+    0x776C4EDB, 0xD1EEF59E,
+    0x7747FBCE, 0xD191386E,
+    0x77235F2D, 0xD13397E2,
+    0x76FE790E, 0xD0D61434,
+    0x76D94989, 0xD078AD9E,
+    0x76B3D0B4, 0xD01B6459,
+    0x768E0EA6, 0xCFBE389F,
+    0x76680376, 0xCF612AAA,
+    0x7641AF3D, 0xCF043AB3,
+    0x761B1211, 0xCEA768F2,
+    0x75F42C0B, 0xCE4AB5A2,
+    0x75CCFD42, 0xCDEE20FC,
+    0x75A585CF, 0xCD91AB39,
+    0x757DC5CA, 0xCD355491,
+    0x7555BD4C, 0xCCD91D3D,
+    0x752D6C6C, 0xCC7D0578,
+    0x7504D345, 0xCC210D79,
+    0x74DBF1EF, 0xCBC53579,
+    0x74B2C884, 0xCB697DB0,
+    0x7489571C, 0xCB0DE658,
+    0x745F9DD1, 0xCAB26FA9,
+    0x74359CBD, 0xCA5719DB,
+    0x740B53FB, 0xC9FBE527,
+    0x73E0C3A3, 0xC9A0D1C5,
+    0x73B5EBD1, 0xC945DFEC,
+    0x738ACC9E, 0xC8EB0FD6,
+    0x735F6626, 0xC89061BA,
+    0x7333B883, 0xC835D5D0,
+    0x7307C3D0, 0xC7DB6C50,
+    0x72DB8828, 0xC7812572,
+    0x72AF05A7, 0xC727016D,
+    0x72823C67, 0xC6CD0079,
+    0x72552C85, 0xC67322CE,
+    0x7227D61C, 0xC61968A2,
+    0x71FA3949, 0xC5BFD22E,
+    0x71CC5626, 0xC5665FA9,
+    0x719E2CD2, 0xC50D1149,
+    0x716FBD68, 0xC4B3E746,
+    0x71410805, 0xC45AE1D7,
+    0x71120CC5, 0xC4020133,
+    0x70E2CBC6, 0xC3A94590,
+    0x70B34525, 0xC350AF26,
+    0x708378FF, 0xC2F83E2A,
+    0x70536771, 0xC29FF2D4,
+    0x7023109A, 0xC247CD5A,
+    0x6FF27497, 0xC1EFCDF3,
+    0x6FC19385, 0xC197F4D4,
+    0x6F906D84, 0xC1404233,
+    0x6F5F02B2, 0xC0E8B648,
+    0x6F2D532C, 0xC0915148,
+    0x6EFB5F12, 0xC03A1368,
+    0x6EC92683, 0xBFE2FCDF,
+    0x6E96A99D, 0xBF8C0DE3,
+    0x6E63E87F, 0xBF3546A8,
+    0x6E30E34A, 0xBEDEA765,
+    0x6DFD9A1C, 0xBE88304F,
+    0x6DCA0D14, 0xBE31E19B,
+    0x6D963C54, 0xBDDBBB7F,
+    0x6D6227FA, 0xBD85BE30,
+    0x6D2DD027, 0xBD2FE9E2,
+    0x6CF934FC, 0xBCDA3ECB,
+    0x6CC45698, 0xBC84BD1F,
+    0x6C8F351C, 0xBC2F6513,
+    0x6C59D0A9, 0xBBDA36DD,
+    0x6C242960, 0xBB8532B0,
+    0x6BEE3F62, 0xBB3058C0,
+    0x6BB812D1, 0xBADBA943,
+    0x6B81A3CD, 0xBA87246D,
+    0x6B4AF279, 0xBA32CA71,
+    0x6B13FEF5, 0xB9DE9B83,
+    0x6ADCC964, 0xB98A97D8,
+    0x6AA551E9, 0xB936BFA4,
+    0x6A6D98A4, 0xB8E31319,
+    0x6A359DB9, 0xB88F926D,
+    0x69FD614A, 0xB83C3DD1,
+    0x69C4E37A, 0xB7E9157A,
+    0x698C246C, 0xB796199B,
+    0x69532442, 0xB7434A67,
+    0x6919E320, 0xB6F0A812,
+    0x68E06129, 0xB69E32CD,
+    0x68A69E81, 0xB64BEACD,
+    0x686C9B4B, 0xB5F9D043,
+    0x683257AB, 0xB5A7E362,
+    0x67F7D3C5, 0xB556245E,
+    0x67BD0FBD, 0xB5049368,
+    0x67820BB7, 0xB4B330B3,
+    0x6746C7D8, 0xB461FC70,
+    0x670B4444, 0xB410F6D3,
+    0x66CF8120, 0xB3C0200C,
+    0x66937E91, 0xB36F784F,
+    0x66573CBB, 0xB31EFFCC,
+    0x661ABBC5, 0xB2CEB6B5,
+    0x65DDFBD3, 0xB27E9D3C,
+    0x65A0FD0B, 0xB22EB392,
+    0x6563BF92, 0xB1DEF9E9,
+    0x6526438F, 0xB18F7071,
+    0x64E88926, 0xB140175B,
+    0x64AA907F, 0xB0F0EEDA,
+    0x646C59BF, 0xB0A1F71D,
+    0x642DE50D, 0xB0533055,
+    0x63EF3290, 0xB0049AB3,
+    0x63B0426D, 0xAFB63667,
+    0x637114CC, 0xAF6803A2,
+    0x6331A9D4, 0xAF1A0293,
+    0x62F201AC, 0xAECC336C,
+    0x62B21C7B, 0xAE7E965B,
+    0x6271FA69, 0xAE312B92,
+    0x62319B9D, 0xADE3F33E,
+    0x61F1003F, 0xAD96ED92,
+    0x61B02876, 0xAD4A1ABA,
+    0x616F146C, 0xACFD7AE8,
+    0x612DC447, 0xACB10E4B,
+    0x60EC3830, 0xAC64D510,
+    0x60AA7050, 0xAC18CF69,
+    0x60686CCF, 0xABCCFD83,
+    0x60262DD6, 0xAB815F8D,
+    0x5FE3B38D, 0xAB35F5B5,
+    0x5FA0FE1F, 0xAAEAC02C,
+    0x5F5E0DB3, 0xAA9FBF1E,
+    0x5F1AE274, 0xAA54F2BA,
+    0x5ED77C8A, 0xAA0A5B2E,
+    0x5E93DC1F, 0xA9BFF8A8,
+    0x5E50015D, 0xA975CB57,
+    0x5E0BEC6E, 0xA92BD367,
+    0x5DC79D7C, 0xA8E21106,
+    0x5D8314B1, 0xA8988463,
+    0x5D3E5237, 0xA84F2DAA,
+    0x5CF95638, 0xA8060D08,
+    0x5CB420E0, 0xA7BD22AC,
+    0x5C6EB258, 0xA7746EC0,
+    0x5C290ACC, 0xA72BF174,
+    0x5BE32A67, 0xA6E3AAF2,
+    0x5B9D1154, 0xA69B9B68,
+    0x5B56BFBD, 0xA653C303,
+    0x5B1035CF, 0xA60C21EE,
+    0x5AC973B5, 0xA5C4B855,
+    0x5A82799A, 0xA57D8666,
+    0x5A3B47AB, 0xA5368C4B,
+    0x59F3DE12, 0xA4EFCA31,
+    0x59AC3CFD, 0xA4A94043,
+    0x59646498, 0xA462EEAC,
+    0x591C550E, 0xA41CD599,
+    0x58D40E8C, 0xA3D6F534,
+    0x588B9140, 0xA3914DA8,
+    0x5842DD54, 0xA34BDF20,
+    0x57F9F2F8, 0xA306A9C8,
+    0x57B0D256, 0xA2C1ADC9,
+    0x57677B9D, 0xA27CEB4F,
+    0x571DEEFA, 0xA2386284,
+    0x56D42C99, 0xA1F41392,
+    0x568A34A9, 0xA1AFFEA3,
+    0x56400758, 0xA16C23E1,
+    0x55F5A4D2, 0xA1288376,
+    0x55AB0D46, 0xA0E51D8C,
+    0x556040E2, 0xA0A1F24D,
+    0x55153FD4, 0xA05F01E1,
+    0x54CA0A4B, 0xA01C4C73,
+    0x547EA073, 0x9FD9D22A,
+    0x5433027D, 0x9F979331,
+    0x53E73097, 0x9F558FB0,
+    0x539B2AF0, 0x9F13C7D0,
+    0x534EF1B5, 0x9ED23BB9,
+    0x53028518, 0x9E90EB94,
+    0x52B5E546, 0x9E4FD78A,
+    0x5269126E, 0x9E0EFFC1,
+    0x521C0CC2, 0x9DCE6463,
+    0x51CED46E, 0x9D8E0597,
+    0x518169A5, 0x9D4DE385,
+    0x5133CC94, 0x9D0DFE54,
+    0x50E5FD6D, 0x9CCE562C,
+    0x5097FC5E, 0x9C8EEB34,
+    0x5049C999, 0x9C4FBD93,
+    0x4FFB654D, 0x9C10CD70,
+    0x4FACCFAB, 0x9BD21AF3,
+    0x4F5E08E3, 0x9B93A641,
+    0x4F0F1126, 0x9B556F81,
+    0x4EBFE8A5, 0x9B1776DA,
+    0x4E708F8F, 0x9AD9BC71,
+    0x4E210617, 0x9A9C406E,
+    0x4DD14C6E, 0x9A5F02F5,
+    0x4D8162C4, 0x9A22042D,
+    0x4D31494B, 0x99E5443B,
+    0x4CE10034, 0x99A8C345,
+    0x4C9087B1, 0x996C816F,
+    0x4C3FDFF4, 0x99307EE0,
+    0x4BEF092D, 0x98F4BBBC,
+    0x4B9E0390, 0x98B93828,
+    0x4B4CCF4D, 0x987DF449,
+    0x4AFB6C98, 0x9842F043,
+    0x4AA9DBA2, 0x98082C3B,
+    0x4A581C9E, 0x97CDA855,
+    0x4A062FBD, 0x979364B5,
+    0x49B41533, 0x9759617F,
+    0x4961CD33, 0x971F9ED7,
+    0x490F57EE, 0x96E61CE0,
+    0x48BCB599, 0x96ACDBBE,
+    0x4869E665, 0x9673DB94,
+    0x4816EA86, 0x963B1C86,
+    0x47C3C22F, 0x96029EB6,
+    0x47706D93, 0x95CA6247,
+    0x471CECE7, 0x9592675C,
+    0x46C9405C, 0x955AAE17,
+    0x46756828, 0x9523369C,
+    0x4621647D, 0x94EC010B,
+    0x45CD358F, 0x94B50D87,
+    0x4578DB93, 0x947E5C33,
+    0x452456BD, 0x9447ED2F,
+    0x44CFA740, 0x9411C09E,
+    0x447ACD50, 0x93DBD6A0,
+    0x4425C923, 0x93A62F57,
+    0x43D09AED, 0x9370CAE4,
+    0x437B42E1, 0x933BA968,
+    0x4325C135, 0x9306CB04,
+    0x42D0161E, 0x92D22FD9,
+    0x427A41D0, 0x929DD806,
+    0x42244481, 0x9269C3AC,
+    0x41CE1E65, 0x9235F2EC,
+    0x4177CFB1, 0x920265E4,
+    0x4121589B, 0x91CF1CB6,
+    0x40CAB958, 0x919C1781,
+    0x4073F21D, 0x91695663,
+    0x401D0321, 0x9136D97D,
+    0x3FC5EC98, 0x9104A0EE,
+    0x3F6EAEB8, 0x90D2ACD4,
+    0x3F1749B8, 0x90A0FD4E,
+    0x3EBFBDCD, 0x906F927C,
+    0x3E680B2C, 0x903E6C7B,
+    0x3E10320D, 0x900D8B69,
+    0x3DB832A6, 0x8FDCEF66,
+    0x3D600D2C, 0x8FAC988F,
+    0x3D07C1D6, 0x8F7C8701,
+    0x3CAF50DA, 0x8F4CBADB,
+    0x3C56BA70, 0x8F1D343A,
+    0x3BFDFECD, 0x8EEDF33B,
+    0x3BA51E29, 0x8EBEF7FB,
+    0x3B4C18BA, 0x8E904298,
+    0x3AF2EEB7, 0x8E61D32E,
+    0x3A99A057, 0x8E33A9DA,
+    0x3A402DD2, 0x8E05C6B7,
+    0x39E6975E, 0x8DD829E4,
+    0x398CDD32, 0x8DAAD37B,
+    0x3932FF87, 0x8D7DC399,
+    0x38D8FE93, 0x8D50FA59,
+    0x387EDA8E, 0x8D2477D8,
+    0x382493B0, 0x8CF83C30,
+    0x37CA2A30, 0x8CCC477D,
+    0x376F9E46, 0x8CA099DA,
+    0x3714F02A, 0x8C753362,
+    0x36BA2014, 0x8C4A142F,
+    0x365F2E3B, 0x8C1F3C5D,
+    0x36041AD9, 0x8BF4AC05,
+    0x35A8E625, 0x8BCA6343,
+    0x354D9057, 0x8BA0622F,
+    0x34F219A8, 0x8B76A8E4,
+    0x34968250, 0x8B4D377C,
+    0x343ACA87, 0x8B240E11,
+    0x33DEF287, 0x8AFB2CBB,
+    0x3382FA88, 0x8AD29394,
+    0x3326E2C3, 0x8AAA42B4,
+    0x32CAAB6F, 0x8A823A36,
+    0x326E54C7, 0x8A5A7A31,
+    0x3211DF04, 0x8A3302BE,
+    0x31B54A5E, 0x8A0BD3F5,
+    0x3158970E, 0x89E4EDEF,
+    0x30FBC54D, 0x89BE50C3,
+    0x309ED556, 0x8997FC8A,
+    0x3041C761, 0x8971F15A,
+    0x2FE49BA7, 0x894C2F4C,
+    0x2F875262, 0x8926B677,
+    0x2F29EBCC, 0x890186F2,
+    0x2ECC681E, 0x88DCA0D3,
+    0x2E6EC792, 0x88B80432,
+    0x2E110A62, 0x8893B125,
+    0x2DB330C7, 0x886FA7C2,
+    0x2D553AFC, 0x884BE821,
+    0x2CF72939, 0x88287256,
+    0x2C98FBBA, 0x88054677,
+    0x2C3AB2B9, 0x87E2649B,
+    0x2BDC4E6F, 0x87BFCCD7,
+    0x2B7DCF17, 0x879D7F41,
+    0x2B1F34EB, 0x877B7BEC,
+    0x2AC08026, 0x8759C2EF,
+    0x2A61B101, 0x8738545E,
+    0x2A02C7B8, 0x8717304E,
+    0x29A3C485, 0x86F656D3,
+    0x2944A7A2, 0x86D5C802,
+    0x28E5714B, 0x86B583EE,
+    0x288621B9, 0x86958AAC,
+    0x2826B928, 0x8675DC4F,
+    0x27C737D3, 0x865678EB,
+    0x27679DF4, 0x86376092,
+    0x2707EBC7, 0x86189359,
+    0x26A82186, 0x85FA1153,
+    0x26483F6C, 0x85DBDA91,
+    0x25E845B6, 0x85BDEF28,
+    0x2588349D, 0x85A04F28,
+    0x25280C5E, 0x8582FAA5,
+    0x24C7CD33, 0x8565F1B0,
+    0x24677758, 0x8549345C,
+    0x24070B08, 0x852CC2BB,
+    0x23A6887F, 0x85109CDD,
+    0x2345EFF8, 0x84F4C2D4,
+    0x22E541AF, 0x84D934B1,
+    0x22847DE0, 0x84BDF286,
+    0x2223A4C5, 0x84A2FC62,
+    0x21C2B69C, 0x84885258,
+    0x2161B3A0, 0x846DF477,
+    0x21009C0C, 0x8453E2CF,
+    0x209F701C, 0x843A1D70,
+    0x203E300D, 0x8420A46C,
+    0x1FDCDC1B, 0x840777D0,
+    0x1F7B7481, 0x83EE97AD,
+    0x1F19F97B, 0x83D60412,
+    0x1EB86B46, 0x83BDBD0E,
+    0x1E56CA1E, 0x83A5C2B0,
+    0x1DF5163F, 0x838E1507,
+    0x1D934FE5, 0x8376B422,
+    0x1D31774D, 0x835FA00F,
+    0x1CCF8CB3, 0x8348D8DC,
+    0x1C6D9053, 0x83325E97,
+    0x1C0B826A, 0x831C314E,
+    0x1BA96335, 0x83065110,
+    0x1B4732EF, 0x82F0BDE8,
+    0x1AE4F1D6, 0x82DB77E5,
+    0x1A82A026, 0x82C67F14,
+    0x1A203E1B, 0x82B1D381,
+    0x19BDCBF3, 0x829D753A,
+    0x195B49EA, 0x8289644B,
+    0x18F8B83C, 0x8275A0C0,
+    0x18961728, 0x82622AA6,
+    0x183366E9, 0x824F0208,
+    0x17D0A7BC, 0x823C26F3,
+    0x176DD9DE, 0x82299971,
+    0x170AFD8D, 0x82175990,
+    0x16A81305, 0x82056758,
+    0x16451A83, 0x81F3C2D7,
+    0x15E21445, 0x81E26C16,
+    0x157F0086, 0x81D16321,
+    0x151BDF86, 0x81C0A801,
+    0x14B8B17F, 0x81B03AC2,
+    0x145576B1, 0x81A01B6D,
+    0x13F22F58, 0x81904A0C,
+    0x138EDBB1, 0x8180C6A9,
+    0x132B7BF9, 0x8171914E,
+    0x12C8106F, 0x8162AA04,
+    0x1264994E, 0x815410D4,
+    0x120116D5, 0x8145C5C7,
+    0x119D8941, 0x8137C8E6,
+    0x1139F0CF, 0x812A1A3A,
+    0x10D64DBD, 0x811CB9CA,
+    0x1072A048, 0x810FA7A0,
+    0x100EE8AD, 0x8102E3C4,
+    0x0FAB272B, 0x80F66E3C,
+    0x0F475BFF, 0x80EA4712,
+    0x0EE38766, 0x80DE6E4C,
+    0x0E7FA99E, 0x80D2E3F2,
+    0x0E1BC2E4, 0x80C7A80A,
+    0x0DB7D376, 0x80BCBA9D,
+    0x0D53DB92, 0x80B21BAF,
+    0x0CEFDB76, 0x80A7CB49,
+    0x0C8BD35E, 0x809DC971,
+    0x0C27C389, 0x8094162C,
+    0x0BC3AC35, 0x808AB180,
+    0x0B5F8D9F, 0x80819B74,
+    0x0AFB6805, 0x8078D40D,
+    0x0A973BA5, 0x80705B50,
+    0x0A3308BD, 0x80683143,
+    0x09CECF89, 0x806055EB,
+    0x096A9049, 0x8058C94C,
+    0x09064B3A, 0x80518B6B,
+    0x08A2009A, 0x804A9C4D,
+    0x083DB0A7, 0x8043FBF6,
+    0x07D95B9E, 0x803DAA6A,
+    0x077501BE, 0x8037A7AC,
+    0x0710A345, 0x8031F3C2,
+    0x06AC406F, 0x802C8EAD,
+    0x0647D97C, 0x80277872,
+    0x05E36EA9, 0x8022B114,
+    0x057F0035, 0x801E3895,
+    0x051A8E5C, 0x801A0EF8,
+    0x04B6195D, 0x80163440,
+    0x0451A177, 0x8012A86F,
+    0x03ED26E6, 0x800F6B88,
+    0x0388A9EA, 0x800C7D8C,
+    0x03242ABF, 0x8009DE7E,
+    0x02BFA9A4, 0x80078E5E,
+    0x025B26D7, 0x80058D2F,
+    0x01F6A297, 0x8003DAF1,
+    0x01921D20, 0x800277A6,
+    0x012D96B1, 0x8001634E,
+    0x00C90F88, 0x80009DEA,
+    0x006487E3, 0x8000277A
+};
+
+/**    
+* \par    
+* Example code for Q31 RFFT Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i < N/2; i++)    
+* {    
+*    twiddleCoefRfftQ31[2*i]= sin(i * 2*PI/(float)N);    
+*    twiddleCoefRfftQ31[2*i+1]= cos(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 4096	and PI = 3.14159265358979    
+* \par    
+* Same layout as twiddleCoef_rfft_4096, converted to Q31(Fixed point 1.31):    
+*	round(twiddleCoefRfftQ31(i) * pow(2, 31)), saturated to 0x7FFFFFFF    
+*/
+const q31_t twiddleCoef_rfft_4096_q31[4096] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoef_rfft_4096_q31) = {
+    0x00000000, 0x7FFFFFFF,
+    0x003243F5, 0x7FFFF621,
+    0x006487E3, 0x7FFFD886,
+    0x0096CBC1, 0x7FFFA72C,
+    0x00C90F88, 0x7FFF6216,
+    0x00FB5330, 0x7FFF0943,
+    0x012D96B1, 0x7FFE9CB2,
+    0x015FDA03, 0x7FFE1C65,
+    0x01921D20, 0x7FFD885A,
+    0x01C45FFE, 0x7FFCE093,
+    0x01F6A297, 0x7FFC250F,
+    0x0228E4E2, 0x7FFB55CE,
+    0x025B26D7, 0x7FFA72D1,
+    0x028D6870, 0x7FF97C18,
+    0x02BFA9A4, 0x7FF871A2,
+    0x02F1EA6C, 0x7FF75370,
+    0x03242ABF, 0x7FF62182,
+    0x03566A96, 0x7FF4DBD9,
+    0x0388A9EA, 0x7FF38274,
+    0x03BAE8B2, 0x7FF21553,
+    0x03ED26E6, 0x7FF09478,
+    0x041F6480, 0x7FEEFFE1,
+    0x0451A177, 0x7FED5791,
+    0x0483DDC3, 0x7FEB9B85,
+    0x04B6195D, 0x7FE9CBC0,
+    0x04E8543E, 0x7FE7E841,
+    0x051A8E5C, 0x7FE5F108,
+    0x054CC7B1, 0x7FE3E616,
+    0x057F0035, 0x7FE1C76B,
+    0x05B137DF, 0x7FDF9508,
+    0x05E36EA9, 0x7FDD4EEC,
+    0x0615A48B, 0x7FDAF519,
+    0x0647D97C, 0x7FD8878E,
+    0x067A0D76, 0x7FD6064C,
+    0x06AC406F, 0x7FD37153,
+    0x06DE7262, 0x7FD0C8A3,
+    0x0710A345, 0x7FCE0C3E,
+    0x0742D311, 0x7FCB3C23,
+    0x077501BE, 0x7FC85854,
+    0x07A72F45, 0x7FC560CF,
+    0x07D95B9E, 0x7FC25596,
+    0x080B86C2, 0x7FBF36AA,
+    0x083DB0A7, 0x7FBC040A,
+    0x086FD947, 0x7FB8BDB8,
+    0x08A2009A, 0x7FB563B3,
+    0x08D42699, 0x7FB1F5FC,
+    0x09064B3A, 0x7FAE7495,
+    0x09386E78, 0x7FAADF7C,
+    0x096A9049, 0x7FA736B4,
+    0x099CB0A7, 0x7FA37A3C,
+    0x09CECF89, 0x7F9FAA15,
+    0x0A00ECE8, 0x7F9BC640,
+    0x0A3308BD, 0x7F97CEBD,
+    0x0A6522FE, 0x7F93C38C,
+    0x0A973BA5, 0x7F8FA4B0,
+    0x0AC952AA, 0x7F8B7227,
+    0x0AFB6805, 0x7F872BF3,
+    0x0B2D7BAF, 0x7F82D214,
+    0x0B5F8D9F, 0x7F7E648C,
+    0x0B919DCF, 0x7F79E35A,
+    0x0BC3AC35, 0x7F754E80,
+    0x0BF5B8CB, 0x7F70A5FE,
+    0x0C27C389, 0x7F6BE9D4,
+    0x0C59CC68, 0x7F671A05,
+    0x0C8BD35E, 0x7F62368F,
+    0x0CBDD865, 0x7F5D3F75,
+    0x0CEFDB76, 0x7F5834B7,
+    0x0D21DC87, 0x7F531655,
+    0x0D53DB92, 0x7F4DE451,
+    0x0D85D88F, 0x7F489EAA,
+    0x0DB7D376, 0x7F434563,
+    0x0DE9CC40, 0x7F3DD87C,
+    0x0E1BC2E4, 0x7F3857F6,
+    0x0E4DB75B, 0x7F32C3D1,
+    0x0E7FA99E, 0x7F2D1C0E,
+    0x0EB199A4, 0x7F2760AF,
+    0x0EE38766, 0x7F2191B4,
+    0x0F1572DC, 0x7F1BAF1E,
+    0x0F475BFF, 0x7F15B8EE,
+    0x0F7942C7, 0x7F0FAF25,
+    0x0FAB272B, 0x7F0991C4,
+    0x0FDD0926, 0x7F0360CB,
+    0x100EE8AD, 0x7EFD1C3C,
+    0x1040C5BB, 0x7EF6C418,
+    0x1072A048, 0x7EF05860,
+    0x10A4784B, 0x7EE9D914,
+    0x10D64DBD, 0x7EE34636,
+    0x11082096, 0x7EDC9FC6,
+    0x1139F0CF, 0x7ED5E5C6,
+    0x116BBE60, 0x7ECF1837,
+    0x119D8941, 0x7EC8371A,
+    0x11CF516A, 0x7EC14270,
+    0x120116D5, 0x7EBA3A39,
+    0x1232D979, 0x7EB31E78,
+    0x1264994E, 0x7EABEF2C,
+    0x1296564D, 0x7EA4AC58,
+    0x12C8106F, 0x7E9D55FC,
+    0x12F9C7AA, 0x7E95EC1A,
+    0x132B7BF9, 0x7E8E6EB2,
+    0x135D2D53, 0x7E86DDC6,
+    0x138EDBB1, 0x7E7F3957,
+    0x13C0870A, 0x7E778166,
+    0x13F22F58, 0x7E6FB5F4,
+    0x1423D492, 0x7E67D703,
+    0x145576B1, 0x7E5FE493,
+    0x148715AE, 0x7E57DEA7,
+    0x14B8B17F, 0x7E4FC53E,
+    0x14EA4A1F, 0x7E47985B,
+    0x151BDF86, 0x7E3F57FF,
+    0x154D71AA, 0x7E37042A,
+    0x157F0086, 0x7E2E9CDF,
+    0x15B08C12, 0x7E26221F,
+    0x15E21445, 0x7E1D93EA,
+    0x16139918, 0x7E14F242,
+    0x16451A83, 0x7E0C3D29,
+    0x1676987F, 0x7E0374A0,
+    0x16A81305, 0x7DFA98A8,
+    0x16D98A0C, 0x7DF1A942,
+    0x170AFD8D, 0x7DE8A670,
+    0x173C6D80, 0x7DDF9034,
+    0x176DD9DE, 0x7DD6668F,
+    0x179F429F, 0x7DCD2981,
+    0x17D0A7BC, 0x7DC3D90D,
+    0x1802092C, 0x7DBA7534,
+    0x183366E9, 0x7DB0FDF8,
+    0x1864C0EA, 0x7DA77359,
+    0x18961728, 0x7D9DD55A,
+    0x18C7699B, 0x7D9423FC,
+    0x18F8B83C, 0x7D8A5F40,
+    0x192A0304, 0x7D808728,
+    0x195B49EA, 0x7D769BB5,
+    0x198C8CE7, 0x7D6C9CE9,
+    0x19BDCBF3, 0x7D628AC6,
+    0x19EF0707, 0x7D58654D,
+    0x1A203E1B, 0x7D4E2C7F,
+    0x1A517128, 0x7D43E05E,
+    0x1A82A026, 0x7D3980EC,
+    0x1AB3CB0D, 0x7D2F0E2B,
+    0x1AE4F1D6, 0x7D24881B,
+    0x1B161479, 0x7D19EEBF,
+    0x1B4732EF, 0x7D0F4218,
+    0x1B784D30, 0x7D048228,
+    0x1BA96335, 0x7CF9AEF0,
+    0x1BDA74F6, 0x7CEEC873,
+    0x1C0B826A, 0x7CE3CEB2,
+    0x1C3C8B8C, 0x7CD8C1AE,
+    0x1C6D9053, 0x7CCDA169,
+    0x1C9E90B8, 0x7CC26DE5,
+    0x1CCF8CB3, 0x7CB72724,
+    0x1D00843D, 0x7CABCD28,
+    0x1D31774D, 0x7CA05FF1,
+    0x1D6265DD, 0x7C94DF83,
+    0x1D934FE5, 0x7C894BDE,
+    0x1DC4355E, 0x7C7DA505,
+    0x1DF5163F, 0x7C71EAF9,
+    0x1E25F282, 0x7C661DBC,
+    0x1E56CA1E, 0x7C5A3D50,
+    0x1E879D0D, 0x7C4E49B7,
+    0x1EB86B46, 0x7C4242F2,
+    0x1EE934C3, 0x7C362904,
+    0x1F19F97B, 0x7C29FBEE,
+    0x1F4AB968, 0x7C1DBBB3,
+    0x1F7B7481, 0x7C116853,
+    0x1FAC2ABF, 0x7C0501D2,
+    0x1FDCDC1B, 0x7BF88830,
+    0x200D888D, 0x7BEBFB70,
+    0x203E300D, 0x7BDF5B94,
+    0x206ED295, 0x7BD2A89E,
+    0x209F701C, 0x7BC5E290,
+    0x20D0089C, 0x7BB9096B,
+    0x21009C0C, 0x7BAC1D31,
+    0x21312A65, 0x7B9F1DE6,
+    0x2161B3A0, 0x7B920B89,
+    0x219237B5, 0x7B84E61F,
+    0x21C2B69C, 0x7B77ADA8,
+    0x21F3304F, 0x7B6A6227,
+    0x2223A4C5, 0x7B5D039E,
+    0x225413F8, 0x7B4F920E,
+    0x22847DE0, 0x7B420D7A,
+    0x22B4E274, 0x7B3475E5,
+    0x22E541AF, 0x7B26CB4F,
+    0x23159B88, 0x7B190DBC,
+    0x2345EFF8, 0x7B0B3D2C,
+    0x23763EF7, 0x7AFD59A4,
+    0x23A6887F, 0x7AEF6323,
+    0x23D6CC87, 0x7AE159AE,
+    0x24070B08, 0x7AD33D45,
+    0x243743FA, 0x7AC50DEC,
+    0x24677758, 0x7AB6CBA4,
+    0x2497A517, 0x7AA8766F,
+    0x24C7CD33, 0x7A9A0E50,
+    0x24F7EFA2, 0x7A8B9348,
+    0x25280C5E, 0x7A7D055B,
+    0x2558235F, 0x7A6E648A,
+    0x2588349D, 0x7A5FB0D8,
+    0x25B84012, 0x7A50EA47,
+    0x25E845B6, 0x7A4210D8,
+    0x26184581, 0x7A332490,
+    0x26483F6C, 0x7A24256F,
+    0x26783370, 0x7A151378,
+    0x26A82186, 0x7A05EEAD,
+    0x26D809A5, 0x79F6B711,
+    0x2707EBC7, 0x79E76CA7,
+    0x2737C7E3, 0x79D80F6F,
+    0x27679DF4, 0x79C89F6E,
+    0x27976DF1, 0x79B91CA4,
+    0x27C737D3, 0x79A98715,
+    0x27F6FB92, 0x7999DEC4,
+    0x2826B928, 0x798A23B1,
+    0x2856708D, 0x797A55E0,
+    0x288621B9, 0x796A7554,
+    0x28B5CCA5, 0x795A820E,
+    0x28E5714B, 0x794A7C12,
+    0x29150FA1, 0x793A6361,
+    0x2944A7A2, 0x792A37FE,
+    0x29743946, 0x7919F9EC,
+    0x29A3C485, 0x7909A92D,
+    0x29D34958, 0x78F945C3,
+    0x2A02C7B8, 0x78E8CFB2,
+    0x2A323F9E, 0x78D846FB,
+    0x2A61B101, 0x78C7ABA2,
+    0x2A911BDC, 0x78B6FDA8,
+    0x2AC08026, 0x78A63D11,
+    0x2AEFDDD8, 0x789569DF,
+    0x2B1F34EB, 0x78848414,
+    0x2B4E8558, 0x78738BB3,
+    0x2B7DCF17, 0x786280BF,
+    0x2BAD1221, 0x7851633B,
+    0x2BDC4E6F, 0x78403329,
+    0x2C0B83FA, 0x782EF08B,
+    0x2C3AB2B9, 0x781D9B65,
+    0x2C69DAA6, 0x780C33B8,
+    0x2C98FBBA, 0x77FAB989,
+    0x2CC815EE, 0x77E92CD9,
+    0x2CF72939, 0x77D78DAA,
+    0x2D263596, 0x77C5DC01,
+    0x2D553AFC, 0x77B417DF,
+    0x2D843964, 0x77A24148,
+    0x2DB330C7, 0x7790583E,
+    0x2DE2211E, 0x777E5CC3,
+    0x2E110A62, 0x776C4EDB,
+    0x2E3FEC8B, 0x775A2E89,
+    0x2E6EC792, 0x7747FBCE,
+    0x2E9D9B70, 0x7735B6AF,
+    0x2ECC681E, 0x77235F2D,
+    0x2EFB2D95, 0x7710F54C,
+    0x2F29EBCC, 0x76FE790E,
+    0x2F58A2BE, 0x76EBEA77,
+    0x2F875262, 0x76D94989,
+    0x2FB5FAB2, 0x76C69647,
+    0x2FE49BA7, 0x76B3D0B4,
+    0x30133539, 0x76A0F8D2,
+    0x3041C761, 0x768E0EA6,
+    0x30705217, 0x767B1231,
+    0x309ED556, 0x76680376,
+    0x30CD5115, 0x7654E279,
+    0x30FBC54D, 0x7641AF3D,
+    0x312A31F8, 0x762E69C4,
+    0x3158970E, 0x761B1211,
+    0x3186F487, 0x7607A828,
+    0x31B54A5E, 0x75F42C0B,
+    0x31E39889, 0x75E09DBD,
+    0x3211DF04, 0x75CCFD42,
+    0x32401DC6, 0x75B94A9C,
+    0x326E54C7, 0x75A585CF,
+    0x329C8402, 0x7591AEDD,
+    0x32CAAB6F, 0x757DC5CA,
+    0x32F8CB07, 0x7569CA99,
+    0x3326E2C3, 0x7555BD4C,
+    0x3354F29B, 0x75419DE7,
+    0x3382FA88, 0x752D6C6C,
+    0x33B0FA84, 0x751928E0,
+    0x33DEF287, 0x7504D345,
+    0x340CE28B, 0x74F06B9E,
+    0x343ACA87, 0x74DBF1EF,
+    0x3468AA76, 0x74C7663A,
+    0x34968250, 0x74B2C884,
+    0x34C4520D, 0x749E18CD,
+    0x34F219A8, 0x7489571C,
+    0x351FD918, 0x74748371,
+    0x354D9057, 0x745F9DD1,
+    0x357B3F5D, 0x744AA63F,
+    0x35A8E625, 0x74359CBD,
+    0x35D684A6, 0x74208150,
+    0x36041AD9, 0x740B53FB,
+    0x3631A8B8, 0x73F614C0,
+    0x365F2E3B, 0x73E0C3A3,
+    0x368CAB5C, 0x73CB60A8,
+    0x36BA2014, 0x73B5EBD1,
+    0x36E78C5B, 0x73A06522,
+    0x3714F02A, 0x738ACC9E,
+    0x37424B7B, 0x73752249,
+    0x376F9E46, 0x735F6626,
+    0x379CE885, 0x73499838,
+    0x37CA2A30, 0x7333B883,
+    0x37F76341, 0x731DC70A,
+    0x382493B0, 0x7307C3D0,
+    0x3851BB77, 0x72F1AED9,
+    0x387EDA8E, 0x72DB8828,
+    0x38ABF0EF, 0x72C54FC1,
+    0x38D8FE93, 0x72AF05A7,
+    0x39060373, 0x7298A9DD,
+    0x3932FF87, 0x72823C67,
+    0x395FF2C9, 0x726BBD48,
+    0x398CDD32, 0x72552C85,
+    0x39B9BEBC, 0x723E8A20,
+    0x39E6975E, 0x7227D61C,
+    0x3A136712, 0x7211107E,
+    0x3A402DD2, 0x71FA3949,
+    0x3A6CEB96, 0x71E35080,
+    0x3A99A057, 0x71CC5626,
+    0x3AC64C0F, 0x71B54A41,
+    0x3AF2EEB7, 0x719E2CD2,
+    0x3B1F8848, 0x7186FDDE,
+    0x3B4C18BA, 0x716FBD68,
+    0x3B78A007, 0x71586B74,
+    0x3BA51E29, 0x71410805,
+    0x3BD19318, 0x7129931F,
+    0x3BFDFECD, 0x71120CC5,
+    0x3C2A6142, 0x70FA74FC,
+    0x3C56BA70, 0x70E2CBC6,
+    0x3C830A50, 0x70CB1128,
+    0x3CAF50DA, 0x70B34525,
+    0x3CDB8E09, 0x709B67C0,
+    0x3D07C1D6, 0x708378FF,
+    0x3D33EC39, 0x706B78E3,
+    0x3D600D2C, 0x70536771,
+    0x3D8C24A8, 0x703B44AD,
+    0x3DB832A6, 0x7023109A,
+    0x3DE4371F, 0x700ACB3C,
+    0x3E10320D, 0x6FF27497,
+    0x3E3C2369, 0x6FDA0CAE,
+    0x3E680B2C, 0x6FC19385,
+    0x3E93E950, 0x6FA90921,
+    0x3EBFBDCD, 0x6F906D84,
+    0x3EEB889C, 0x6F77C0B3,
+    0x3F1749B8, 0x6F5F02B2,
+    0x3F430119, 0x6F463383,
+    0x3F6EAEB8, 0x6F2D532C,
+    0x3F9A5290, 0x6F1461B0,
+    0x3FC5EC98, 0x6EFB5F12,
+    0x3FF17CCA, 0x6EE24B57,
+    0x401D0321, 0x6EC92683,
+    0x40487F94, 0x6EAFF099,
+    0x4073F21D, 0x6E96A99D,
+    0x409F5AB6, 0x6E7D5193,
+    0x40CAB958, 0x6E63E87F,
+    0x40F60DFB, 0x6E4A6E66,
+    0x4121589B, 0x6E30E34A,
+    0x414C992F, 0x6E174730,
+    0x4177CFB1, 0x6DFD9A1C,
+    0x41A2FC1A, 0x6DE3DC11,
+    0x41CE1E65, 0x6DCA0D14,
+    0x41F93689, 0x6DB02D29,
+    0x42244481, 0x6D963C54,
+    0x424F4845, 0x6D7C3A98,
+    0x427A41D0, 0x6D6227FA,
+    0x42A5311B, 0x6D48047E,
+    0x42D0161E, 0x6D2DD027,
+    0x42FAF0D4, 0x6D138AFB,
+    0x4325C135, 0x6CF934FC,
+    0x4350873C, 0x6CDECE2F,
+    0x437B42E1, 0x6CC45698,
+    0x43A5F41E, 0x6CA9CE3B,
+    0x43D09AED, 0x6C8F351C,
+    0x43FB3746, 0x6C748B3F,
+    0x4425C923, 0x6C59D0A9,
+    0x4450507E, 0x6C3F055D,
+    0x447ACD50, 0x6C242960,
+    0x44A53F93, 0x6C093CB6,
+    0x44CFA740, 0x6BEE3F62,
+    0x44FA0450, 0x6BD3316A,
+    0x452456BD, 0x6BB812D1,
+    0x454E9E80, 0x6B9CE39B,
+    0x4578DB93, 0x6B81A3CD,
+    0x45A30DF0, 0x6B66536B,
+    0x45CD358F, 0x6B4AF279,
+    0x45F7526B, 0x6B2F80FB,
+    0x4621647D, 0x6B13FEF5,
+    0x464B6BBE, 0x6AF86C6C,
+    0x46756828, 0x6ADCC964,
+    0x469F59B4, 0x6AC115E2,
+    0x46C9405C, 0x6AA551E9,
+    0x46F31C1A, 0x6A897D7D,
+    0x471CECE7, 0x6A6D98A4,
+    0x4746B2BC, 0x6A51A361,
+    0x47706D93, 0x6A359DB9,
+    0x479A1D67, 0x6A1987B0,
+    0x47C3C22F, 0x69FD614A,
+    0x47ED5BE6, 0x69E12A8C,
+    0x4816EA86, 0x69C4E37A,
+    0x48406E08, 0x69A88C19,
+    0x4869E665, 0x698C246C,
+    0x48935397, 0x696FAC78,
+    0x48BCB599, 0x69532442,
+    0x48E60C62, 0x69368BCE,
+    0x490F57EE, 0x6919E320,
+    0x49389836, 0x68FD2A3D,
+    0x4961CD33, 0x68E06129,
+    0x498AF6DF, 0x68C387E9,
+    0x49B41533, 0x68A69E81,
+    0x49DD282A, 0x6889A4F6,
+    0x4A062FBD, 0x686C9B4B,
+    0x4A2F2BE6, 0x684F8186,
+    0x4A581C9E, 0x683257AB,
+    0x4A8101DE, 0x68151DBE,
+    0x4AA9DBA2, 0x67F7D3C5,
+    0x4AD2A9E2, 0x67DA79C3,
+    0x4AFB6C98, 0x67BD0FBD,
+    0x4B2423BE, 0x679F95B7,
+    0x4B4CCF4D, 0x67820BB7,
+    0x4B756F40, 0x676471C0,
+    0x4B9E0390, 0x6746C7D8,
+    0x4BC68C36, 0x67290E02,
+    0x4BEF092D, 0x670B4444,
+    0x4C177A6E, 0x66ED6AA1,
+    0x4C3FDFF4, 0x66CF8120,
+    0x4C6839B7, 0x66B187C3,
+    0x4C9087B1, 0x66937E91,
+    0x4CB8C9DD, 0x6675658C,
+    0x4CE10034, 0x66573CBB,
+    0x4D092AB0, 0x66390422,
+    0x4D31494B, 0x661ABBC5,
+    0x4D595BFE, 0x65FC63A9,
+    0x4D8162C4, 0x65DDFBD3,
+    0x4DA95D96, 0x65BF8447,
+    0x4DD14C6E, 0x65A0FD0B,
+    0x4DF92F46, 0x65826622,
+    0x4E210617, 0x6563BF92,
+    0x4E48D0DD, 0x6545095F,
+    0x4E708F8F, 0x6526438F,
+    0x4E984229, 0x65076E25,
+    0x4EBFE8A5, 0x64E88926,
+    0x4EE782FB, 0x64C99498,
+    0x4F0F1126, 0x64AA907F,
+    0x4F369320, 0x648B7CE0,
+    0x4F5E08E3, 0x646C59BF,
+    0x4F857269, 0x644D2722,
+    0x4FACCFAB, 0x642DE50D,
+    0x4FD420A4, 0x640E9386,
+    0x4FFB654D, 0x63EF3290,
+    0x50229DA1, 0x63CFC231,
+    0x5049C999, 0x63B0426D,
+    0x5070E92F, 0x6390B34A,
+    0x5097FC5E, 0x637114CC,
+    0x50BF031F, 0x635166F9,
+    0x50E5FD6D, 0x6331A9D4,
+    0x510CEB40, 0x6311DD64,
+    0x5133CC94, 0x62F201AC,
+    0x515AA162, 0x62D216B3,
+    0x518169A5, 0x62B21C7B,
+    0x51A82555, 0x6292130C,
+    0x51CED46E, 0x6271FA69,
+    0x51F576EA, 0x6251D298,
+    0x521C0CC2, 0x62319B9D,
+    0x524295F0, 0x6211557E,
+    0x5269126E, 0x61F1003F,
+    0x528F8238, 0x61D09BE5,
+    0x52B5E546, 0x61B02876,
+    0x52DC3B92, 0x618FA5F7,
+    0x53028518, 0x616F146C,
+    0x5328C1D0, 0x614E73DA,
+    0x534EF1B5, 0x612DC447,
+    0x537514C2, 0x610D05B7,
+    0x539B2AF0, 0x60EC3830,
+    0x53C13439, 0x60CB5BB7,
+    0x53E73097, 0x60AA7050,
+    0x540D2005, 0x60897601,
+    0x5433027D, 0x60686CCF,
+    0x5458D7F9, 0x604754BF,
+    0x547EA073, 0x60262DD6,
+    0x54A45BE6, 0x6004F819,
+    0x54CA0A4B, 0x5FE3B38D,
+    0x54EFAB9C, 0x5FC26038,
+    0x55153FD4, 0x5FA0FE1F,
+    0x553AC6EE, 0x5F7F8D46,
+    0x556040E2, 0x5F5E0DB3,
+    0x5585ADAD, 0x5F3C7F6B,
+    0x55AB0D46, 0x5F1AE274,
+    0x55D05FAA, 0x5EF936D1,
+    0x55F5A4D2, 0x5ED77C8A,
+    0x561ADCB9, 0x5EB5B3A2,
+    0x56400758, 0x5E93DC1F,
+    0x566524AA, 0x5E71F606,
+    0x568A34A9, 0x5E50015D,
+    0x56AF3750, 0x5E2DFE29,
+    0x56D42C99, 0x5E0BEC6E,
+    0x56F9147E, 0x5DE9CC33,
+    0x571DEEFA, 0x5DC79D7C,
+    0x5742BC06, 0x5DA5604F,
+    0x57677B9D, 0x5D8314B1,
+    0x578C2DBA, 0x5D60BAA7,
+    0x57B0D256, 0x5D3E5237,
+    0x57D5696D, 0x5D1BDB65,
+    0x57F9F2F8, 0x5CF95638,
+    0x581E6EF1, 0x5CD6C2B5,
+    0x5842DD54, 0x5CB420E0,
+    0x58673E1B, 0x5C9170BF,
+    0x588B9140, 0x5C6EB258,
+    0x58AFD6BD, 0x5C4BE5B0,
+    0x58D40E8C, 0x5C290ACC,
+    0x58F838A9, 0x5C0621B2,
+    0x591C550E, 0x5BE32A67,
+    0x594063B5, 0x5BC024F0,
+    0x59646498, 0x5B9D1154,
+    0x598857B2, 0x5B79EF96,
+    0x59AC3CFD, 0x5B56BFBD,
+    0x59D01475, 0x5B3381CE,
+    0x59F3DE12, 0x5B1035CF,
+    0x5A1799D1, 0x5AECDBC5,
+    0x5A3B47AB, 0x5AC973B5,
+    0x5A5EE79A, 0x5AA5FDA5,
+    0x5A82799A, 0x5A82799A,
+    0x5AA5FDA5, 0x5A5EE79A,
+    0x5AC973B5, 0x5A3B47AB,
+    0x5AECDBC5, 0x5A1799D1,
+    0x5B1035CF, 0x59F3DE12,
+    0x5B3381CE, 0x59D01475,
+    0x5B56BFBD, 0x59AC3CFD,
+    0x5B79EF96, 0x598857B2,
+    0x5B9D1154, 0x59646498,
+    0x5BC024F0, 0x594063B5,
+    0x5BE32A67, 0x591C550E,
+    0x5C0621B2, 0x58F838A9,
+    0x5C290ACC, 0x58D40E8C,
+    0x5C4BE5B0, 0x58AFD6BD,
+    0x5C6EB258, 0x588B9140,
+    0x5C9170BF, 0x58673E1B,
+    0x5CB420E0, 0x5842DD54,
+    0x5CD6C2B5, 0x581E6EF1,
+    0x5CF95638, 0x57F9F2F8,
+    0x5D1BDB65, 0x57D5696D,
+    0x5D3E5237, 0x57B0D256,
+    0x5D60BAA7, 0x578C2DBA,
+    0x5D8314B1, 0x57677B9D,
+    0x5DA5604F, 0x5742BC06,
+    0x5DC79D7C, 0x571DEEFA,
+    0x5DE9CC33, 0x56F9147E,
+    0x5E0BEC6E, 0x56D42C99,
+    0x5E2DFE29, 0x56AF3750,
+    0x5E50015D, 0x568A34A9,
+    0x5E71F606, 0x566524AA,
+    0x5E93DC1F, 0x56400758,
+    0x5EB5B3A2, 0x561ADCB9,
+    0x5ED77C8A, 0x55F5A4D2,
+    0x5EF936D1, 0x55D05FAA,
+    0x5F1AE274, 0x55AB0D46,
+    0x5F3C7F6B, 0x5585ADAD,
+    0x5F5E0DB3, 0x556040E2,
+    0x5F7F8D46, 0x553AC6EE,
+    0x5FA0FE1F, 0x55153FD4,
+    0x5FC26038, 0x54EFAB9C,
+    0x5FE3B38D, 0x54CA0A4B,
+    0x6004F819, 0x54A45BE6,
+    0x60262DD6, 0x547EA073,
+    0x604754BF, 0x5458D7F9,
+    0x60686CCF, 0x5433027D,
+    0x60897601, 0x540D2005,
+    0x60AA7050, 0x53E73097,
+    0x60CB5BB7, 0x53C13439,
+    0x60EC3830, 0x539B2AF0,
+    0x610D05B7, 0x537514C2,
+    0x612DC447, 0x534EF1B5,
+    0x614E73DA, 0x5328C1D0,
+    0x616F146C, 0x53028518,
+    0x618FA5F7, 0x52DC3B92,
+    0x61B02876, 0x52B5E546,
+    0x61D09BE5, 0x528F8238,
+    0x61F1003F, 0x5269126E,
+    0x6211557E, 0x524295F0,
+    0x62319B9D, 0x521C0CC2,
+    0x6251D298, 0x51F576EA,
+    0x6271FA69, 0x51CED46E,
+    0x6292130C, 0x51A82555,
+    0x62B21C7B, 0x518169A5,
+    0x62D216B3, 0x515AA162,
+    0x62F201AC, 0x5133CC94,
+    0x6311DD64, 0x510CEB40,
+    0x6331A9D4, 0x50E5FD6D,
+    0x635166F9, 0x50BF031F,
+    0x637114CC, 0x5097FC5E,
+    0x6390B34A, 0x5070E92F,
+    0x63B0426D, 0x5049C999,
+    0x63CFC231, 0x50229DA1,
+    0x63EF3290, 0x4FFB654D,
+    0x640E9386, 0x4FD420A4,
+    0x642DE50D, 0x4FACCFAB,
+    0x644D2722, 0x4F857269,
+    0x646C59BF, 0x4F5E08E3,
+    0x648B7CE0, 0x4F369320,
+    0x64AA907F, 0x4F0F1126,
+    0x64C99498, 0x4EE782FB,
+    0x64E88926, 0x4EBFE8A5,
+    0x65076E25, 0x4E984229,
+    0x6526438F, 0x4E708F8F,
+    0x6545095F, 0x4E48D0DD,
+    0x6563BF92, 0x4E210617,
+    0x65826622, 0x4DF92F46,
+    0x65A0FD0B, 0x4DD14C6E,
+    0x65BF8447, 0x4DA95D96,
+    0x65DDFBD3, 0x4D8162C4,
+    0x65FC63A9, 0x4D595BFE,
+    0x661ABBC5, 0x4D31494B,
+    0x66390422, 0x4D092AB0,
+    0x66573CBB, 0x4CE10034,
+    0x6675658C, 0x4CB8C9DD,
+    0x66937E91, 0x4C9087B1,
+    0x66B187C3, 0x4C6839B7,
+    0x66CF8120, 0x4C3FDFF4,
+    0x66ED6AA1, 0x4C177A6E,
+    0x670B4444, 0x4BEF092D,
+    0x67290E02, 0x4BC68C36,
+    0x6746C7D8, 0x4B9E0390,
+    0x676471C0, 0x4B756F40,
+    0x67820BB7, 0x4B4CCF4D,
+    0x679F95B7, 0x4B2423BE,
+    0x67BD0FBD, 0x4AFB6C98,
+    0x67DA79C3, 0x4AD2A9E2,
+    0x67F7D3C5, 0x4AA9DBA2,
+    0x68151DBE, 0x4A8101DE,
+    0x683257AB, 0x4A581C9E,
+    0x684F8186, 0x4A2F2BE6,
+    0x686C9B4B, 0x4A062FBD,
+    0x6889A4F6, 0x49DD282A,
+    0x68A69E81, 0x49B41533,
+    0x68C387E9, 0x498AF6DF,
+    0x68E06129, 0x4961CD33,
+    0x68FD2A3D, 0x49389836,
+    0x6919E320, 0x490F57EE,
+    0x69368BCE, 0x48E60C62,
+    0x69532442, 0x48BCB599,
+    0x696FAC78, 0x48935397,
+    0x698C246C, 0x4869E665,
+    0x69A88C19, 0x48406E08,
+    0x69C4E37A, 0x4816EA86,
+    0x69E12A8C, 0x47ED5BE6,
+    0x69FD614A, 0x47C3C22F,
+    0x6A1987B0, 0x479A1D67,
+    0x6A359DB9, 0x47706D93,
+    0x6A51A361, 0x4746B2BC,
+    0x6A6D98A4, 0x471CECE7,
+    0x6A897D7D, 0x46F31C1A,
+    0x6AA551E9, 0x46C9405C,
+    0x6AC115E2, 0x469F59B4,
+    0x6ADCC964, 0x46756828,
+    0x6AF86C6C, 0x464B6BBE,
+    0x6B13FEF5, 0x4621647D,
+    0x6B2F80FB, 0x45F7526B,
+    0x6B4AF279, 0x45CD358F,
+    0x6B66536B, 0x45A30DF0,
+    0x6B81A3CD, 0x4578DB93,
+    0x6B9CE39B, 0x454E9E80,
+    0x6BB812D1, 0x452456BD,
+    0x6BD3316A, 0x44FA0450,
+    0x6BEE3F62, 0x44CFA740,
+    0x6C093CB6, 0x44A53F93,
+    0x6C242960, 0x447ACD50,
+    0x6C3F055D, 0x4450507E,
+    0x6C59D0A9, 0x4425C923,
+    0x6C748B3F, 0x43FB3746,
+    0x6C8F351C, 0x43D09AED,
+    0x6CA9CE3B, 0x43A5F41E,
+    0x6CC45698, 0x437B42E1,
+    0x6CDECE2F, 0x4350873C,
+    0x6CF934FC, 0x4325C135,
+    0x6D138AFB, 0x42FAF0D4,
+    0x6D2DD027, 0x42D0161E,
+    0x6D48047E, 0x42A5311B,
+    0x6D6227FA, 0x427A41D0,
+    0x6D7C3A98, 0x424F4845,
+    0x6D963C54, 0x42244481,
+    0x6DB02D29, 0x41F93689,
+    0x6DCA0D14, 0x41CE1E65,
+    0x6DE3DC11, 0x41A2FC1A,
+    0x6DFD9A1C, 0x4177CFB1,
+    0x6E174730, 0x414C992F,
+    0x6E30E34A, 0x4121589B,
+    0x6E4A6E66, 0x40F60DFB,
+    0x6E63E87F, 0x40CAB958,
+    0x6E7D5193, 0x409F5AB6,
+    0x6E96A99D, 0x4073F21D,
+    0x6EAFF099, 0x40487F94,
+    0x6EC92683, 0x401D0321,
+    0x6EE24B57, 0x3FF17CCA,
+    0x6EFB5F12, 0x3FC5EC98,
+    0x6F1461B0, 0x3F9A5290,
+    0x6F2D532C, 0x3F6EAEB8,
+    0x6F463383, 0x3F430119,
+    0x6F5F02B2, 0x3F1749B8,
+    0x6F77C0B3, 0x3EEB889C,
+    0x6F906D84, 0x3EBFBDCD,
+    0x6FA90921, 0x3E93E950,
+    0x6FC19385, 0x3E680B2C,
+    0x6FDA0CAE, 0x3E3C2369,
+    0x6FF27497, 0x3E10320D,
+    0x700ACB3C, 0x3DE4371F,
+    0x7023109A, 0x3DB832A6,
+    0x703B44AD, 0x3D8C24A8,
+    0x70536771, 0x3D600D2C,
+    0x706B78E3, 0x3D33EC39,
+    0x708378FF, 0x3D07C1D6,
+    0x709B67C0, 0x3CDB8E09,
+    0x70B34525, 0x3CAF50DA,
+    0x70CB1128, 0x3C830A50,
+    0x70E2CBC6, 0x3C56BA70,
+    0x70FA74FC, 0x3C2A6142,
+    0x71120CC5, 0x3BFDFECD,
+    0x7129931F, 0x3BD19318,
+    0x71410805, 0x3BA51E29,
+    0x71586B74, 0x3B78A007,
+    0x716FBD68, 0x3B4C18BA,
+    0x7186FDDE, 0x3B1F8848,
+    0x719E2CD2, 0x3AF2EEB7,
+    0x71B54A41, 0x3AC64C0F,
+    0x71CC5626, 0x3A99A057,
+    0x71E35080, 0x3A6CEB96,
+    0x71FA3949, 0x3A402DD2,
+    0x7211107E, 0x3A136712,
+    0x7227D61C, 0x39E6975E,
+    0x723E8A20, 0x39B9BEBC,
+    0x72552C85, 0x398CDD32,
+    0x726BBD48, 0x395FF2C9,
+    0x72823C67, 0x3932FF87,
+    0x7298A9DD, 0x39060373,
+    0x72AF05A7, 0x38D8FE93,
+    0x72C54FC1, 0x38ABF0EF,
+    0x72DB8828, 0x387EDA8E,
+    0x72F1AED9, 0x3851BB77,
+    0x7307C3D0, 0x382493B0,
+    0x731DC70A, 0x37F76341,
+    0x7333B883, 0x37CA2A30,
+    0x73499838, 0x379CE885,
+    0x735F6626, 0x376F9E46,
+    0x73752249, 0x37424B7B,
+    0x738ACC9E, 0x3714F02A,
+    0x73A06522, 0x36E78C5B,
+    0x73B5EBD1, 0x36BA2014,
+    0x73CB60A8, 0x368CAB5C,
+    0x73E0C3A3, 0x365F2E3B,
+    0x73F614C0, 0x3631A8B8,
+    0x740B53FB, 0x36041AD9,
+    0x74208150, 0x35D684A6,
+    0x74359CBD, 0x35A8E625,
+    0x744AA63F, 0x357B3F5D,
+    0x745F9DD1, 0x354D9057,
+    0x74748371, 0x351FD918,
+    0x7489571C, 0x34F219A8,
+    0x749E18CD, 0x34C4520D,
+    0x74B2C884, 0x34968250,
+    0x74C7663A, 0x3468AA76,
+    0x74DBF1EF, 0x343ACA87,
+    0x74F06B9E, 0x340CE28B,
+    0x7504D345, 0x33DEF287,
+    0x751928E0, 0x33B0FA84,
+    0x752D6C6C, 0x3382FA88,
+    0x75419DE7, 0x3354F29B,
+    0x7555BD4C, 0x3326E2C3,
+    0x7569CA99, 0x32F8CB07,
+    0x757DC5CA, 0x32CAAB6F,
+    0x7591AEDD, 0x329C8402,
+    0x75A585CF, 0x326E54C7,
+    0x75B94A9C, 0x32401DC6,
+    0x75CCFD42, 0x3211DF04,
+    0x75E09DBD, 0x31E39889,
+    0x75F42C0B, 0x31B54A5E,
+    0x7607A828, 0x3186F487,
+    0x761B1211, 0x3158970E,
+    0x762E69C4, 0x312A31F8,
+    0x7641AF3D, 0x30FBC54D,
+    0x7654E279, 0x30CD5115,
+    0x76680376, 0x309ED556,
+    0x767B1231, 0x30705217,
+    0x768E0EA6, 0x3041C761,
+    0x76A0F8D2, 0x30133539,
+    0x76B3D0B4, 0x2FE49BA7,
+    0x76C69647, 0x2FB5FAB2,
+    0x76D94989, 0x2F875262,
+    0x76EBEA77, 0x2F58A2BE,
+    0x76FE790E, 0x2F29EBCC,
+    0x7710F54C, 0x2EFB2D95,
+    0x77235F2D, 0x2ECC681E,
+    0x7735B6AF, 0x2E9D9B70,
+    0x7747FBCE, 0x2E6EC792,
+    0x775A2E89, 0x2E3FEC8B,
+    0x776C4EDB, 0x2E110A62,
+    0x777E5CC3, 0x2DE2211E,
+    0x7790583E, 0x2DB330C7,
+    0x77A24148, 0x2D843964,
+    0x77B417DF, 0x2D553AFC,
+    0x77C5DC01, 0x2D263596,
+    0x77D78DAA, 0x2CF72939,
+    0x77E92CD9, 0x2CC815EE,
+    0x77FAB989, 0x2C98FBBA,
+    0x780C33B8, 0x2C69DAA6,
+    0x781D9B65, 0x2C3AB2B9,
+    0x782EF08B, 0x2C0B83FA,
+    0x78403329, 0x2BDC4E6F,
+    0x7851633B, 0x2BAD1221,
+    0x786280BF, 0x2B7DCF17,
+    0x78738BB3, 0x2B4E8558,
+    0x78848414, 0x2B1F34EB,
+    0x789569DF, 0x2AEFDDD8,
+    0x78A63D11, 0x2AC08026,
+    0x78B6FDA8, 0x2A911BDC,
+    0x78C7ABA2, 0x2A61B101,
+    0x78D846FB, 0x2A323F9E,
+    0x78E8CFB2, 0x2A02C7B8,
+    0x78F945C3, 0x29D34958,
+    0x7909A92D, 0x29A3C485,
+    0x7919F9EC, 0x29743946,
+    0x792A37FE, 0x2944A7A2,
+    0x793A6361, 0x29150FA1,
+    0x794A7C12, 0x28E5714B,
+    0x795A820E, 0x28B5CCA5,
+    0x796A7554, 0x288621B9,
+    0x797A55E0, 0x2856708D,
+    0x798A23B1, 0x2826B928,
+    0x7999DEC4, 0x27F6FB92,
+    0x79A98715, 0x27C737D3,
+    0x79B91CA4, 0x27976DF1,
+    0x79C89F6E, 0x27679DF4,
+    0x79D80F6F, 0x2737C7E3,
+    0x79E76CA7, 0x2707EBC7,
+    0x79F6B711, 0x26D809A5,
+    0x7A05EEAD, 0x26A82186,
+    0x7A151378, 0x26783370,
+    0x7A24256F, 0x26483F6C,
+    0x7A332490, 0x26184581,
+    0x7A4210D8, 0x25E845B6,
+    0x7A50EA47, 0x25B84012,
+    0x7A5FB0D8, 0x2588349D,
+    0x7A6E648A, 0x2558235F,
+    0x7A7D055B, 0x25280C5E,
+    0x7A8B9348, 0x24F7EFA2,
+    0x7A9A0E50, 0x24C7CD33,
+    0x7AA8766F, 0x2497A517,
+    0x7AB6CBA4, 0x24677758,
+    0x7AC50DEC, 0x243743FA,
+    0x7AD33D45, 0x24070B08,
+    0x7AE159AE, 0x23D6CC87,
+    0x7AEF6323, 0x23A6887F,
+    0x7AFD59A4, 0x23763EF7,
+    0x7B0B3D2C, 0x2345EFF8,
+    0x7B190DBC, 0x23159B88,
+    0x7B26CB4F, 0x22E541AF,
+    0x7B3475E5, 0x22B4E274,
+    0x7B420D7A, 0x22847DE0,
+    0x7B4F920E, 0x225413F8,
+    0x7B5D039E, 0x2223A4C5,
+    0x7B6A6227, 0x21F3304F,
+    0x7B77ADA8, 0x21C2B69C,
+    0x7B84E61F, 0x219237B5,
+    0x7B920B89, 0x2161B3A0,
+    0x7B9F1DE6, 0x21312A65,
+    0x7BAC1D31, 0x21009C0C,
+    0x7BB9096B, 0x20D0089C,
+    0x7BC5E290, 0x209F701C,
+    0x7BD2A89E, 0x206ED295,
+    0x7BDF5B94, 0x203E300D,
+    0x7BEBFB70, 0x200D888D,
+    0x7BF88830, 0x1FDCDC1B,
+    0x7C0501D2, 0x1FAC2ABF,
+    0x7C116853, 0x1F7B7481,
+    0x7C1DBBB3, 0x1F4AB968,
+    0x7C29FBEE, 0x1F19F97B,
+    0x7C362904, 0x1EE934C3,
+    0x7C4242F2, 0x1EB86B46,
+    0x7C4E49B7, 0x1E879D0D,
+    0x7C5A3D50, 0x1E56CA1E,
+    0x7C661DBC, 0x1E25F282,
+    0x7C71EAF9, 0x1DF5163F,
+    0x7C7DA505, 0x1DC4355E,
+    0x7C894BDE, 0x1D934FE5,
+    0x7C94DF83, 0x1D6265DD,
+    0x7CA05FF1, 0x1D31774D,
+    0x7CABCD28, 0x1D00843D,
+    0x7CB72724, 0x1CCF8CB3,
+    0x7CC26DE5, 0x1C9E90B8,
+    0x7CCDA169, 0x1C6D9053,
+    0x7CD8C1AE, 0x1C3C8B8C,
+    0x7CE3CEB2, 0x1C0B826A,
+    0x7CEEC873, 0x1BDA74F6,
+    0x7CF9AEF0, 0x1BA96335,
+    0x7D048228, 0x1B784D30,
+    0x7D0F4218, 0x1B4732EF,
+    0x7D19EEBF, 0x1B161479,
+    0x7D24881B, 0x1AE4F1D6,
+    0x7D2F0E2B, 0x1AB3CB0D,
+    0x7D3980EC, 0x1A82A026,
+    0x7D43E05E, 0x1A517128,
+    0x7D4E2C7F, 0x1A203E1B,
+    0x7D58654D, 0x19EF0707,
+    0x7D628AC6, 0x19BDCBF3,
+    0x7D6C9CE9, 0x198C8CE7,
+    0x7D769BB5, 0x195B49EA,
+    0x7D808728, 0x192A0304,
+    0x7D8A5F40, 0x18F8B83C,
+    0x7D9423FC, 0x18C7699B,
+    0x7D9DD55A, 0x18961728,
+    0x7DA77359, 0x1864C0EA,
+    0x7DB0FDF8, 0x183366E9,
+    0x7DBA7534, 0x1802092C,
+    0x7DC3D90D, 0x17D0A7BC,
+    0x7DCD2981, 0x179F429F,
+    0x7DD6668F, 0x176DD9DE,
+    0x7DDF9034, 0x173C6D80,
+    0x7DE8A670, 0x170AFD8D,
+    0x7DF1A942, 0x16D98A0C,
+    0x7DFA98A8, 0x16A81305,
+    0x7E0374A0, 0x1676987F,
+    0x7E0C3D29, 0x16451A83,
+    0x7E14F242, 0x16139918,
+    0x7E1D93EA, 0x15E21445,
+    0x7E26221F, 0x15B08C12,
+    0x7E2E9CDF, 0x157F0086,
+    0x7E37042A, 0x154D71AA,
+    0x7E3F57FF, 0x151BDF86,
+    0x7E47985B, 0x14EA4A1F,
+    0x7E4FC53E, 0x14B8B17F,
+    0x7E57DEA7, 0x148715AE,
+    0x7E5FE493, 0x145576B1,
+    0x7E67D703, 0x1423D492,
+    0x7E6FB5F4, 0x13F22F58,
+    0x7E778166, 0x13C0870A,
+    0x7E7F3957, 0x138EDBB1,
+    0x7E86DDC6, 0x135D2D53,
+    0x7E8E6EB2, 0x132B7BF9,
+    0x7E95EC1A, 0x12F9C7AA,
+    0x7E9D55FC, 0x12C8106F,
+    0x7EA4AC58, 0x1296564D,
+    0x7EABEF2C, 0x1264994E,
+    0x7EB31E78, 0x1232D979,
+    0x7EBA3A39, 0x120116D5,
+    0x7EC14270, 0x11CF516A,
+    0x7EC8371A, 0x119D8941,
+    0x7ECF1837, 0x116BBE60,
+    0x7ED5E5C6, 0x1139F0CF,
+    0x7EDC9FC6, 0x11082096,
+    0x7EE34636, 0x10D64DBD,
+    0x7EE9D914, 0x10A4784B,
+    0x7EF05860, 0x1072A048,
+    0x7EF6C418, 0x1040C5BB,
+    0x7EFD1C3C, 0x100EE8AD,
+    0x7F0360CB, 0x0FDD0926,
+    0x7F0991C4, 0x0FAB272B,
+    0x7F0FAF25, 0x0F7942C7,
+    0x7F15B8EE, 0x0F475BFF,
+    0x7F1BAF1E, 0x0F1572DC,
+    0x7F2191B4, 0x0EE38766,
+    0x7F2760AF, 0x0EB199A4,
+    0x7F2D1C0E, 0x0E7FA99E,
+    0x7F32C3D1, 0x0E4DB75B,
+    0x7F3857F6, 0x0E1BC2E4,
+    0x7F3DD87C, 0x0DE9CC40,
+    0x7F434563, 0x0DB7D376,
+    0x7F489EAA, 0x0D85D88F,
+    0x7F4DE451, 0x0D53DB92,
+    0x7F531655, 0x0D21DC87,
+    0x7F5834B7, 0x0CEFDB76,
+    0x7F5D3F75, 0x0CBDD865,
+    0x7F62368F, 0x0C8BD35E,
+    0x7F671A05, 0x0C59CC68,
+    0x7F6BE9D4, 0x0C27C389,
+    0x7F70A5FE, 0x0BF5B8CB,
+    0x7F754E80, 0x0BC3AC35,
+    0x7F79E35A, 0x0B919DCF,
+    0x7F7E648C, 0x0B5F8D9F,
+    0x7F82D214, 0x0B2D7BAF,
+    0x7F872BF3, 0x0AFB6805,
+    0x7F8B7227, 0x0AC952AA,
+    0x7F8FA4B0, 0x0A973BA5,
+    0x7F93C38C, 0x0A6522FE,
+    0x7F97CEBD, 0x0A3308BD,
+    0x7F9BC640, 0x0A00ECE8,
+    0x7F9FAA15, 0x09CECF89,
+    0x7FA37A3C, 0x099CB0A7,
+    0x7FA736B4, 0x096A9049,
+    0x7FAADF7C, 0x09386E78,
+    0x7FAE7495, 0x09064B3A,
+    0x7FB1F5FC, 0x08D42699,
+    0x7FB563B3, 0x08A2009A,
+    0x7FB8BDB8, 0x086FD947,
+    0x7FBC040A, 0x083DB0A7,
+    0x7FBF36AA, 0x080B86C2,
+    0x7FC25596, 0x07D95B9E,
+    0x7FC560CF, 0x07A72F45,
+    0x7FC85854, 0x077501BE,
+    0x7FCB3C23, 0x0742D311,
+    0x7FCE0C3E, 0x0710A345,
+    0x7FD0C8A3, 0x06DE7262,
+    0x7FD37153, 0x06AC406F,
+    0x7FD6064C, 0x067A0D76,
+    0x7FD8878E, 0x0647D97C,
+    0x7FDAF519, 0x0615A48B,
+    0x7FDD4EEC, 0x05E36EA9,
+    0x7FDF9508, 0x05B137DF,
+    0x7FE1C76B, 0x057F0035,
+    0x7FE3E616, 0x054CC7B1,
+    0x7FE5F108, 0x051A8E5C,
+    0x7FE7E841, 0x04E8543E,
+    0x7FE9CBC0, 0x04B6195D,
+    0x7FEB9B85, 0x0483DDC3,
+    0x7FED5791, 0x0451A177,
+    0x7FEEFFE1, 0x041F6480,
+    0x7FF09478, 0x03ED26E6,
+    0x7FF21553, 0x03BAE8B2,
+    0x7FF38274, 0x0388A9EA,
+    0x7FF4DBD9, 0x03566A96,
+    0x7FF62182, 0x03242ABF,
+    0x7FF75370, 0x02F1EA6C,
+    0x7FF871A2, 0x02BFA9A4,
+    0x7FF97C18, 0x028D6870,
+    0x7FFA72D1, 0x025B26D7,
+    0x7FFB55CE, 0x0228E4E2,
+    0x7FFC250F, 0x01F6A297,
+    0x7FFCE093, 0x01C45FFE,
+    0x7FFD885A, 0x01921D20,
+    0x7FFE1C65, 0x015FDA03,
+    0x7FFE9CB2, 0x012D96B1,
+    0x7FFF0943, 0x00FB5330,
+    0x7FFF6216, 0x00C90F88,
+    0x7FFFA72C, 0x0096CBC1,
+    0x7FFFD886, 0x006487E3,
+    0x7FFFF621, 0x003243F5,
+    0x7FFFFFFF, 0x00000000,
+    0x7FFFF621, 0xFFCDBC0B,
+    0x7FFFD886, 0xFF9B781D,
+    0x7FFFA72C, 0xFF69343F,
+    0x7FFF6216, 0xFF36F078,
+    0x7FFF0943, 0xFF04ACD0,
+    0x7FFE9CB2, 0xFED2694F,
+    0x7FFE1C65, 0xFEA025FD,
+    0x7FFD885A, 0xFE6DE2E0,
+    0x7FFCE093, 0xFE3BA002,
+    0x7FFC250F, 0xFE095D69,
+    0x7FFB55CE, 0xFDD71B1E,
+    0x7FFA72D1, 0xFDA4D929,
+    0x7FF97C18, 0xFD729790,
+    0x7FF871A2, 0xFD40565C,
+    0x7FF75370, 0xFD0E1594,
+    0x7FF62182, 0xFCDBD541,
+    0x7FF4DBD9, 0xFCA9956A,
+    0x7FF38274, 0xFC775616,
+    0x7FF21553, 0xFC45174E,
+    0x7FF09478, 0xFC12D91A,
+    0x7FEEFFE1, 0xFBE09B80,
+    0x7FED5791, 0xFBAE5E89,
+    0x7FEB9B85, 0xFB7C223D,
+    0x7FE9CBC0, 0xFB49E6A3,
+    0x7FE7E841, 0xFB17ABC2,
+    0x7FE5F108, 0xFAE571A4,
+    0x7FE3E616, 0xFAB3384F,
+    0x7FE1C76B, 0xFA80FFCB,
+    0x7FDF9508, 0xFA4EC821,
+    0x7FDD4EEC, 0xFA1C9157,
+    0x7FDAF519, 0xF9EA5B75,
+    0x7FD8878E, 0xF9B82684,
+    0x7FD6064C, 0xF985F28A,
+    0x7FD37153, 0xF953BF91,
+    0x7FD0C8A3, 0xF9218D9E,
+    0x7FCE0C3E, 0xF8EF5CBB,
+    0x7FCB3C23, 0xF8BD2CEF,
+    0x7FC85854, 0xF88AFE42,
+    0x7FC560CF, 0xF858D0BB,
+    0x7FC25596, 0xF826A462,
+    0x7FBF36AA, 0xF7F4793E,
+    0x7FBC040A, 0xF7C24F59,
+    0x7FB8BDB8, 0xF79026B9,
+    0x7FB563B3, 0xF75DFF66,
+    0x7FB1F5FC, 0xF72BD967,
+    0x7FAE7495, 0xF6F9B4C6,
+    0x7FAADF7C, 0xF6C79188,
+    0x7FA736B4, 0xF6956FB7,
+    0x7FA37A3C, 0xF6634F59,
+    0x7F9FAA15, 0xF6313077,
+    0x7F9BC640, 0xF5FF1318,
+    0x7F97CEBD, 0xF5CCF743,
+    0x7F93C38C, 0xF59ADD02,
+    0x7F8FA4B0, 0xF568C45B,
+    0x7F8B7227, 0xF536AD56,
+    0x7F872BF3, 0xF50497FB,
+    0x7F82D214, 0xF4D28451,
+    0x7F7E648C, 0xF4A07261,
+    0x7F79E35A, 0xF46E6231,
+    0x7F754E80, 0xF43C53CB,
+    0x7F70A5FE, 0xF40A4735,
+    0x7F6BE9D4, 0xF3D83C77,
+    0x7F671A05, 0xF3A63398,
+    0x7F62368F, 0xF3742CA2,
+    0x7F5D3F75, 0xF342279B,
+    0x7F5834B7, 0xF310248A,
+    0x7F531655, 0xF2DE2379,
+    0x7F4DE451, 0xF2AC246E,
+    0x7F489EAA, 0xF27A2771,
+    0x7F434563, 0xF2482C8A,
+    0x7F3DD87C, 0xF21633C0,
+    0x7F3857F6, 0xF1E43D1C,
+    0x7F32C3D1, 0xF1B248A5,
+    0x7F2D1C0E, 0xF1805662,
+    0x7F2760AF, 0xF14E665C,
+    0x7F2191B4, 0xF11C789A,
+    0x7F1BAF1E, 0xF0EA8D24,
+    0x7F15B8EE, 0xF0B8A401,
+    0x7F0FAF25, 0xF086BD39,
+    0x7F0991C4, 0xF054D8D5,
+    0x7F0360CB, 0xF022F6DA,
+    0x7EFD1C3C, 0xEFF11753,
+    0x7EF6C418, 0xEFBF3A45,
+    0x7EF05860, 0xEF8D5FB8,
+    0x7EE9D914, 0xEF5B87B5,
+    0x7EE34636, 0xEF29B243,
+    0x7EDC9FC6, 0xEEF7DF6A,
+    0x7ED5E5C6, 0xEEC60F31,
+    0x7ECF1837, 0xEE9441A0,
+    0x7EC8371A, 0xEE6276BF,
+    0x7EC14270, 0xEE30AE96,
+    0x7EBA3A39, 0xEDFEE92B,
+    0x7EB31E78, 0xEDCD2687,
+    0x7EABEF2C, 0xED9B66B2,
+    0x7EA4AC58, 0xED69A9B3,
+    0x7E9D55FC, 0xED37EF91,
+    0x7E95EC1A, 0xED063856,
+    0x7E8E6EB2, 0xECD48407,
+    0x7E86DDC6, 0xECA2D2AD,
+    0x7E7F3957, 0xEC71244F,
+    0x7E778166, 0xEC3F78F6,
+    0x7E6FB5F4, 0xEC0DD0A8,
+    0x7E67D703, 0xEBDC2B6E,
+    0x7E5FE493, 0xEBAA894F,
+    0x7E57DEA7, 0xEB78EA52,
+    0x7E4FC53E, 0xEB474E81,
+    0x7E47985B, 0xEB15B5E1,
+    0x7E3F57FF, 0xEAE4207A,
+    0x7E37042A, 0xEAB28E56,
+    0x7E2E9CDF, 0xEA80FF7A,
+    0x7E26221F, 0xEA4F73EE,
+    0x7E1D93EA, 0xEA1DEBBB,
+    0x7E14F242, 0xE9EC66E8,
+    0x7E0C3D29, 0xE9BAE57D,
+    0x7E0374A0, 0xE9896781,
+    0x7DFA98A8, 0xE957ECFB,
+    0x7DF1A942, 0xE92675F4,
+    0x7DE8A670, 0xE8F50273,
+    0x7DDF9034, 0xE8C39280,
+    0x7DD6668F, 0xE8922622,
+    0x7DCD2981, 0xE860BD61,
+    0x7DC3D90D, 0xE82F5844,
+    0x7DBA7534, 0xE7FDF6D4,
+    0x7DB0FDF8, 0xE7CC9917,
+    0x7DA77359, 0xE79B3F16,
+    0x7D9DD55A, 0xE769E8D8,
+    0x7D9423FC, 0xE7389665,
+    0x7D8A5F40, 0xE70747C4,
+    0x7D808728, 0xE6D5FCFC,
+    0x7D769BB5, 0xE6A4B616,
+    0x7D6C9CE9, 0xE6737319,
+    0x7D628AC6, 0xE642340D,
+    0x7D58654D, 0xE610F8F9,
+    0x7D4E2C7F, 0xE5DFC1E5,
+    0x7D43E05E, 0xE5AE8ED8,
+    0x7D3980EC, 0xE57D5FDA,
+    0x7D2F0E2B, 0xE54C34F3,
+    0x7D24881B, 0xE51B0E2A,
+    0x7D19EEBF, 0xE4E9EB87,
+    0x7D0F4218, 0xE4B8CD11,
+    0x7D048228, 0xE487B2D0,
+    0x7CF9AEF0, 0xE4569CCB,
+    0x7CEEC873, 0xE4258B0A,
+    0x7CE3CEB2, 0xE3F47D96,
+    0x7CD8C1AE, 0xE3C37474,
+    0x7CCDA169, 0xE3926FAD,
+    0x7CC26DE5, 0xE3616F48,
+    0x7CB72724, 0xE330734D,
+    0x7CABCD28, 0xE2FF7BC3,
+    0x7CA05FF1, 0xE2CE88B3,
+    0x7C94DF83, 0xE29D9A23,
+    0x7C894BDE, 0xE26CB01B,
+    0x7C7DA505, 0xE23BCAA2,
+    0x7C71EAF9, 0xE20AE9C1,
+    0x7C661DBC, 0xE1DA0D7E,
+    0x7C5A3D50, 0xE1A935E2,
+    0x7C4E49B7, 0xE17862F3,
+    0x7C4242F2, 0xE14794BA,
+    0x7C362904, 0xE116CB3D,
+    0x7C29FBEE, 0xE0E60685,
+    0x7C1DBBB3, 0xE0B54698,
+    0x7C116853, 0xE0848B7F,
+    0x7C0501D2, 0xE053D541,
+    0x7BF88830, 0xE02323E5,
+    0x7BEBFB70, 0xDFF27773,
+    0x7BDF5B94, 0xDFC1CFF3,
+    0x7BD2A89E, 0xDF912D6B,
+    0x7BC5E290, 0xDF608FE4,
+    0x7BB9096B, 0xDF2FF764,
+    0x7BAC1D31, 0xDEFF63F4,
+    0x7B9F1DE6, 0xDECED59B,
+    0x7B920B89, 0xDE9E4C60,
+    0x7B84E61F, 0xDE6DC84B,
+    0x7B77ADA8, 0xDE3D4964,
+    0x7B6A6227, 0xDE0CCFB1,
+    0x7B5D039E, 0xDDDC5B3B,
+    0x7B4F920E, 0xDDABEC08,
+    0x7B420D7A, 0xDD7B8220,
+    0x7B3475E5, 0xDD4B1D8C,
+    0x7B26CB4F, 0xDD1ABE51,
+    0x7B190DBC, 0xDCEA6478,
+    0x7B0B3D2C, 0xDCBA1008,
+    0x7AFD59A4, 0xDC89C109,
+    0x7AEF6323, 0xDC597781,
+    0x7AE159AE, 0xDC293379,
+    0x7AD33D45, 0xDBF8F4F8,
+    0x7AC50DEC, 0xDBC8BC06,
+    0x7AB6CBA4, 0xDB9888A8,
+    0x7AA8766F, 0xDB685AE9,
+    0x7A9A0E50, 0xDB3832CD,
+    0x7A8B9348, 0xDB08105E,
+    0x7A7D055B, 0xDAD7F3A2,
+    0x7A6E648A, 0xDAA7DCA1,
+    0x7A5FB0D8, 0xDA77CB63,
+    0x7A50EA47, 0xDA47BFEE,
+    0x7A4210D8, 0xDA17BA4A,
+    0x7A332490, 0xD9E7BA7F,
+    0x7A24256F, 0xD9B7C094,
+    0x7A151378, 0xD987CC90,
+    0x7A05EEAD, 0xD957DE7A,
+    0x79F6B711, 0xD927F65B,
+    0x79E76CA7, 0xD8F81439,
+    0x79D80F6F, 0xD8C8381D,
+    0x79C89F6E, 0xD898620C,
+    0x79B91CA4, 0xD868920F,
+    0x79A98715, 0xD838C82D,
+    0x7999DEC4, 0xD809046E,
+    0x798A23B1, 0xD7D946D8,
+    0x797A55E0, 0xD7A98F73,
+    0x796A7554, 0xD779DE47,
+    0x795A820E, 0xD74A335B,
+    0x794A7C12, 0xD71A8EB5,
+    0x793A6361, 0xD6EAF05F,
+    0x792A37FE, 0xD6BB585E,
+    0x7919F9EC, 0xD68BC6BA,
+    0x7909A92D, 0xD65C3B7B,
+    0x78F945C3, 0xD62CB6A8,
+    0x78E8CFB2, 0xD5FD3848,
+    0x78D846FB, 0xD5CDC062,
+    0x78C7ABA2, 0xD59E4EFF,
+    0x78B6FDA8, 0xD56EE424,
+    0x78A63D11, 0xD53F7FDA,
+    0x789569DF, 0xD5102228,
+    0x78848414, 0xD4E0CB15,
+    0x78738BB3, 0xD4B17AA8,
+    0x786280BF, 0xD48230E9,
+    0x7851633B, 0xD452EDDF,
+    0x78403329, 0xD423B191,
+    0x782EF08B, 0xD3F47C06,
+    0x781D9B65, 0xD3C54D47,
+    0x780C33B8, 0xD396255A,
+    0x77FAB989, 0xD3670446,
+    0x77E92CD9, 0xD337EA12,
+    0x77D78DAA, 0xD308D6C7,
+    0x77C5DC01, 0xD2D9CA6A,
+    0x77B417DF, 0xD2AAC504,
+    0x77A24148, 0xD27BC69C,
+    0x7790583E, 0xD24CCF39,
+    0x777E5CC3, 0xD21DDEE2,
+    0x776C4EDB, 0xD1EEF59E,
+    0x775A2E89, 0xD1C01375,
+    0x7747FBCE, 0xD191386E,
+    0x7735B6AF, 0xD1626490,
+    0x77235F2D, 0xD13397E2,
+    0x7710F54C, 0xD104D26B,
+    0x76FE790E, 0xD0D61434,
+    0x76EBEA77, 0xD0A75D42,
+    0x76D94989, 0xD078AD9E,
+    0x76C69647, 0xD04A054E,
+    0x76B3D0B4, 0xD01B6459,
+    0x76A0F8D2, 0xCFECCAC7,
+    0x768E0EA6, 0xCFBE389F,
+    0x767B1231, 0xCF8FADE9,
+    0x76680376, 0xCF612AAA,
+    0x7654E279, 0xCF32AEEB,
+    0x7641AF3D, 0xCF043AB3,
+    0x762E69C4, 0xCED5CE08,
+    0x761B1211, 0xCEA768F2,
+    0x7607A828, 0xCE790B79,
+    0x75F42C0B, 0xCE4AB5A2,
+    0x75E09DBD, 0xCE1C6777,
+    0x75CCFD42, 0xCDEE20FC,
+    0x75B94A9C, 0xCDBFE23A,
+    0x75A585CF, 0xCD91AB39,
+    0x7591AEDD, 0xCD637BFE,
+    0x757DC5CA, 0xCD355491,
+    0x7569CA99, 0xCD0734F9,
+    0x7555BD4C, 0xCCD91D3D,
+    0x75419DE7, 0xCCAB0D65,
+    0x752D6C6C, 0xCC7D0578,
+    0x751928E0, 0xCC4F057C,
+    0x7504D345, 0xCC210D79,
+    0x74F06B9E, 0xCBF31D75,
+    0x74DBF1EF, 0xCBC53579,
+    0x74C7663A, 0xCB97558A,
+    0x74B2C884, 0xCB697DB0,
+    0x749E18CD, 0xCB3BADF3,
+    0x7489571C, 0xCB0DE658,
+    0x74748371, 0xCAE026E8,
+    0x745F9DD1, 0xCAB26FA9,
+    0x744AA63F, 0xCA84C0A3,
+    0x74359CBD, 0xCA5719DB,
+    0x74208150, 0xCA297B5A,
+    0x740B53FB, 0xC9FBE527,
+    0x73F614C0, 0xC9CE5748,
+    0x73E0C3A3, 0xC9A0D1C5,
+    0x73CB60A8, 0xC97354A4,
+    0x73B5EBD1, 0xC945DFEC,
+    0x73A06522, 0xC91873A5,
+    0x738ACC9E, 0xC8EB0FD6,
+    0x73752249, 0xC8BDB485,
+    0x735F6626, 0xC89061BA,
+    0x73499838, 0xC863177B,
+    0x7333B883, 0xC835D5D0,
+    0x731DC70A, 0xC8089CBF,
+    0x7307C3D0, 0xC7DB6C50,
+    0x72F1AED9, 0xC7AE4489,
+    0x72DB8828, 0xC7812572,
+    0x72C54FC1, 0xC7540F11,
+    0x72AF05A7, 0xC727016D,
+    0x7298A9DD, 0xC6F9FC8D,
+    0x72823C67, 0xC6CD0079,
+    0x726BBD48, 0xC6A00D37,
+    0x72552C85, 0xC67322CE,
+    0x723E8A20, 0xC6464144,
+    0x7227D61C, 0xC61968A2,
+    0x7211107E, 0xC5EC98EE,
+    0x71FA3949, 0xC5BFD22E,
+    0x71E35080, 0xC593146A,
+    0x71CC5626, 0xC5665FA9,
+    0x71B54A41, 0xC539B3F1,
+    0x719E2CD2, 0xC50D1149,
+    0x7186FDDE, 0xC4E077B8,
+    0x716FBD68, 0xC4B3E746,
+    0x71586B74, 0xC4875FF9,
+    0x71410805, 0xC45AE1D7,
+    0x7129931F, 0xC42E6CE8,
+    0x71120CC5, 0xC4020133,
+    0x70FA74FC, 0xC3D59EBE,
+    0x70E2CBC6, 0xC3A94590,
+    0x70CB1128, 0xC37CF5B0,
+    0x70B34525, 0xC350AF26,
+    0x709B67C0, 0xC32471F7,
+    0x708378FF, 0xC2F83E2A,
+    0x706B78E3, 0xC2CC13C7,
+    0x70536771, 0xC29FF2D4,
+    0x703B44AD, 0xC273DB58,
+    0x7023109A, 0xC247CD5A,
+    0x700ACB3C, 0xC21BC8E1,
+    0x6FF27497, 0xC1EFCDF3,
+    0x6FDA0CAE, 0xC1C3DC97,
+    0x6FC19385, 0xC197F4D4,
+    0x6FA90921, 0xC16C16B0,
+    0x6F906D84, 0xC1404233,
+    0x6F77C0B3, 0xC1147764,
+    0x6F5F02B2, 0xC0E8B648,
+    0x6F463383, 0xC0BCFEE7,
+    0x6F2D532C, 0xC0915148,
+    0x6F1461B0, 0xC065AD70,
+    0x6EFB5F12, 0xC03A1368,
+    0x6EE24B57, 0xC00E8336,
+    0x6EC92683, 0xBFE2FCDF,
+    0x6EAFF099, 0xBFB7806C,
+    0x6E96A99D, 0xBF8C0DE3,
+    0x6E7D5193, 0xBF60A54A,
+    0x6E63E87F, 0xBF3546A8,
+    0x6E4A6E66, 0xBF09F205,
+    0x6E30E34A, 0xBEDEA765,
+    0x6E174730, 0xBEB366D1,
+    0x6DFD9A1C, 0xBE88304F,
+    0x6DE3DC11, 0xBE5D03E6,
+    0x6DCA0D14, 0xBE31E19B,
+    0x6DB02D29, 0xBE06C977,
+    0x6D963C54, 0xBDDBBB7F,
+    0x6D7C3A98, 0xBDB0B7BB,
+    0x6D6227FA, 0xBD85BE30,
+    0x6D48047E, 0xBD5ACEE5,
+    0x6D2DD027, 0xBD2FE9E2,
+    0x6D138AFB, 0xBD050F2C,
+    0x6CF934FC, 0xBCDA3ECB,
+    0x6CDECE2F, 0xBCAF78C4,
+    0x6CC45698, 0xBC84BD1F,
+    0x6CA9CE3B, 0xBC5A0BE2,
+    0x6C8F351C, 0xBC2F6513,
+    0x6C748B3F, 0xBC04C8BA,
+    0x6C59D0A9, 0xBBDA36DD,
+    0x6C3F055D, 0xBBAFAF82,
+    0x6C242960, 0xBB8532B0,
+    0x6C093CB6, 0xBB5AC06D,
+    0x6BEE3F62, 0xBB3058C0,
+    0x6BD3316A, 0xBB05FBB0,
+    0x6BB812D1, 0xBADBA943,
+    0x6B9CE39B, 0xBAB16180,
+    0x6B81A3CD, 0xBA87246D,
+    0x6B66536B, 0xBA5CF210,
+    0x6B4AF279, 0xBA32CA71,
+    0x6B2F80FB, 0xBA08AD95,
+    0x6B13FEF5, 0xB9DE9B83,
+    0x6AF86C6C, 0xB9B49442,
+    0x6ADCC964, 0xB98A97D8,
+    0x6AC115E2, 0xB960A64C,
+    0x6AA551E9, 0xB936BFA4,
+    0x6A897D7D, 0xB90CE3E6,
+    0x6A6D98A4, 0xB8E31319,
+    0x6A51A361, 0xB8B94D44,
+    0x6A359DB9, 0xB88F926D,
+    0x6A1987B0, 0xB865E299,
+    0x69FD614A, 0xB83C3DD1,
+    0x69E12A8C, 0xB812A41A,
+    0x69C4E37A, 0xB7E9157A,
+    0x69A88C19, 0xB7BF91F8,
+    0x698C246C, 0xB796199B,
+    0x696FAC78, 0xB76CAC69,
+    0x69532442, 0xB7434A67,
+    0x69368BCE, 0xB719F39E,
+    0x6919E320, 0xB6F0A812,
+    0x68FD2A3D, 0xB6C767CA,
+    0x68E06129, 0xB69E32CD,
+    0x68C387E9, 0xB6750921,
+    0x68A69E81, 0xB64BEACD,
+    0x6889A4F6, 0xB622D7D6,
+    0x686C9B4B, 0xB5F9D043,
+    0x684F8186, 0xB5D0D41A,
+    0x683257AB, 0xB5A7E362,
+    0x68151DBE, 0xB57EFE22,
+    0x67F7D3C5, 0xB556245E,
+    0x67DA79C3, 0xB52D561E,
+    0x67BD0FBD, 0xB5049368,
+    0x679F95B7, 0xB4DBDC42,
+    0x67820BB7, 0xB4B330B3,
+    0x676471C0, 0xB48A90C0,
+    0x6746C7D8, 0xB461FC70,
+    0x67290E02, 0xB43973CA,
+    0x670B4444, 0xB410F6D3,
+    0x66ED6AA1, 0xB3E88592,
+    0x66CF8120, 0xB3C0200C,
+    0x66B187C3, 0xB397C649,
+    0x66937E91, 0xB36F784F,
+    0x6675658C, 0xB3473623,
+    0x66573CBB, 0xB31EFFCC,
+    0x66390422, 0xB2F6D550,
+    0x661ABBC5, 0xB2CEB6B5,
+    0x65FC63A9, 0xB2A6A402,
+    0x65DDFBD3, 0xB27E9D3C,
+    0x65BF8447, 0xB256A26A,
+    0x65A0FD0B, 0xB22EB392,
+    0x65826622, 0xB206D0BA,
+    0x6563BF92, 0xB1DEF9E9,
+    0x6545095F, 0xB1B72F23,
+    0x6526438F, 0xB18F7071,
+    0x65076E25, 0xB167BDD7,
+    0x64E88926, 0xB140175B,
+    0x64C99498, 0xB1187D05,
+    0x64AA907F, 0xB0F0EEDA,
+    0x648B7CE0, 0xB0C96CE0,
+    0x646C59BF, 0xB0A1F71D,
+    0x644D2722, 0xB07A8D97,
+    0x642DE50D, 0xB0533055,
+    0x640E9386, 0xB02BDF5C,
+    0x63EF3290, 0xB0049AB3,
+    0x63CFC231, 0xAFDD625F,
+    0x63B0426D, 0xAFB63667,
+    0x6390B34A, 0xAF8F16D1,
+    0x637114CC, 0xAF6803A2,
+    0x635166F9, 0xAF40FCE1,
+    0x6331A9D4, 0xAF1A0293,
+    0x6311DD64, 0xAEF314C0,
+    0x62F201AC, 0xAECC336C,
+    0x62D216B3, 0xAEA55E9E,
+    0x62B21C7B, 0xAE7E965B,
+    0x6292130C, 0xAE57DAAB,
+    0x6271FA69, 0xAE312B92,
+    0x6251D298, 0xAE0A8916,
+    0x62319B9D, 0xADE3F33E,
+    0x6211557E, 0xADBD6A10,
+    0x61F1003F, 0xAD96ED92,
+    0x61D09BE5, 0xAD707DC8,
+    0x61B02876, 0xAD4A1ABA,
+    0x618FA5F7, 0xAD23C46E,
+    0x616F146C, 0xACFD7AE8,
+    0x614E73DA, 0xACD73E30,
+    0x612DC447, 0xACB10E4B,
+    0x610D05B7, 0xAC8AEB3E,
+    0x60EC3830, 0xAC64D510,
+    0x60CB5BB7, 0xAC3ECBC7,
+    0x60AA7050, 0xAC18CF69,
+    0x60897601, 0xABF2DFFB,
+    0x60686CCF, 0xABCCFD83,
+    0x604754BF, 0xABA72807,
+    0x60262DD6, 0xAB815F8D,
+    0x6004F819, 0xAB5BA41A,
+    0x5FE3B38D, 0xAB35F5B5,
+    0x5FC26038, 0xAB105464,
+    0x5FA0FE1F, 0xAAEAC02C,
+    0x5F7F8D46, 0xAAC53912,
+    0x5F5E0DB3, 0xAA9FBF1E,
+    0x5F3C7F6B, 0xAA7A5253,
+    0x5F1AE274, 0xAA54F2BA,
+    0x5EF936D1, 0xAA2FA056,
+    0x5ED77C8A, 0xAA0A5B2E,
+    0x5EB5B3A2, 0xA9E52347,
+    0x5E93DC1F, 0xA9BFF8A8,
+    0x5E71F606, 0xA99ADB56,
+    0x5E50015D, 0xA975CB57,
+    0x5E2DFE29, 0xA950C8B0,
+    0x5E0BEC6E, 0xA92BD367,
+    0x5DE9CC33, 0xA906EB82,
+    0x5DC79D7C, 0xA8E21106,
+    0x5DA5604F, 0xA8BD43FA,
+    0x5D8314B1, 0xA8988463,
+    0x5D60BAA7, 0xA873D246,
+    0x5D3E5237, 0xA84F2DAA,
+    0x5D1BDB65, 0xA82A9693,
+    0x5CF95638, 0xA8060D08,
+    0x5CD6C2B5, 0xA7E1910F,
+    0x5CB420E0, 0xA7BD22AC,
+    0x5C9170BF, 0xA798C1E5,
+    0x5C6EB258, 0xA7746EC0,
+    0x5C4BE5B0, 0xA7502943,
+    0x5C290ACC, 0xA72BF174,
+    0x5C0621B2, 0xA707C757,
+    0x5BE32A67, 0xA6E3AAF2,
+    0x5BC024F0, 0xA6BF9C4B,
+    0x5B9D1154, 0xA69B9B68,
+    0x5B79EF96, 0xA677A84E,
+    0x5B56BFBD, 0xA653C303,
+    0x5B3381CE, 0xA62FEB8B,
+    0x5B1035CF, 0xA60C21EE,
+    0x5AECDBC5, 0xA5E8662F,
+    0x5AC973B5, 0xA5C4B855,
+    0x5AA5FDA5, 0xA5A11866,
+    0x5A82799A, 0xA57D8666,
+    0x5A5EE79A, 0xA55A025B,
+    0x5A3B47AB, 0xA5368C4B,
+    0x5A1799D1, 0xA513243B,
+    0x59F3DE12, 0xA4EFCA31,
+    0x59D01475, 0xA4CC7E32,
+    0x59AC3CFD, 0xA4A94043,
+    0x598857B2, 0xA486106A,
+    0x59646498, 0xA462EEAC,
+    0x594063B5, 0xA43FDB10,
+    0x591C550E, 0xA41CD599,
+    0x58F838A9, 0xA3F9DE4E,
+    0x58D40E8C, 0xA3D6F534,
+    0x58AFD6BD, 0xA3B41A50,
+    0x588B9140, 0xA3914DA8,
+    0x58673E1B, 0xA36E8F41,
+    0x5842DD54, 0xA34BDF20,
+    0x581E6EF1, 0xA3293D4B,
+    0x57F9F2F8, 0xA306A9C8,
+    0x57D5696D, 0xA2E4249B,
+    0x57B0D256, 0xA2C1ADC9,
+    0x578C2DBA, 0xA29F4559,
+    0x57677B9D, 0xA27CEB4F,
+    0x5742BC06, 0xA25A9FB1,
+    0x571DEEFA, 0xA2386284,
+    0x56F9147E, 0xA21633CD,
+    0x56D42C99, 0xA1F41392,
+    0x56AF3750, 0xA1D201D7,
+    0x568A34A9, 0xA1AFFEA3,
+    0x566524AA, 0xA18E09FA,
+    0x56400758, 0xA16C23E1,
+    0x561ADCB9, 0xA14A4C5E,
+    0x55F5A4D2, 0xA1288376,
+    0x55D05FAA, 0xA106C92F,
+    0x55AB0D46, 0xA0E51D8C,
+    0x5585ADAD, 0xA0C38095,
+    0x556040E2, 0xA0A1F24D,
+    0x553AC6EE, 0xA08072BA,
+    0x55153FD4, 0xA05F01E1,
+    0x54EFAB9C, 0xA03D9FC8,
+    0x54CA0A4B, 0xA01C4C73,
+    0x54A45BE6, 0x9FFB07E7,
+    0x547EA073, 0x9FD9D22A,
+    0x5458D7F9, 0x9FB8AB41,
+    0x5433027D, 0x9F979331,
+    0x540D2005, 0x9F7689FF,
+    0x53E73097, 0x9F558FB0,
+    0x53C13439, 0x9F34A449,
+    0x539B2AF0, 0x9F13C7D0,
+    0x537514C2, 0x9EF2FA49,
+    0x534EF1B5, 0x9ED23BB9,
+    0x5328C1D0, 0x9EB18C26,
+    0x53028518, 0x9E90EB94,
+    0x52DC3B92, 0x9E705A09,
+    0x52B5E546, 0x9E4FD78A,
+    0x528F8238, 0x9E2F641B,
+    0x5269126E, 0x9E0EFFC1,
+    0x524295F0, 0x9DEEAA82,
+    0x521C0CC2, 0x9DCE6463,
+    0x51F576EA, 0x9DAE2D68,
+    0x51CED46E, 0x9D8E0597,
+    0x51A82555, 0x9D6DECF4,
+    0x518169A5, 0x9D4DE385,
+    0x515AA162, 0x9D2DE94D,
+    0x5133CC94, 0x9D0DFE54,
+    0x510CEB40, 0x9CEE229C,
+    0x50E5FD6D, 0x9CCE562C,
+    0x50BF031F, 0x9CAE9907,
+    0x5097FC5E, 0x9C8EEB34,
+    0x5070E92F, 0x9C6F4CB6,
+    0x5049C999, 0x9C4FBD93,
+    0x50229DA1, 0x9C303DCF,
+    0x4FFB654D, 0x9C10CD70,
+    0x4FD420A4, 0x9BF16C7A,
+    0x4FACCFAB, 0x9BD21AF3,
+    0x4F857269, 0x9BB2D8DE,
+    0x4F5E08E3, 0x9B93A641,
+    0x4F369320, 0x9B748320,
+    0x4F0F1126, 0x9B556F81,
+    0x4EE782FB, 0x9B366B68,
+    0x4EBFE8A5, 0x9B1776DA,
+    0x4E984229, 0x9AF891DB,
+    0x4E708F8F, 0x9AD9BC71,
+    0x4E48D0DD, 0x9ABAF6A1,
+    0x4E210617, 0x9A9C406E,
+    0x4DF92F46, 0x9A7D99DE,
+    0x4DD14C6E, 0x9A5F02F5,
+    0x4DA95D96, 0x9A407BB9,
+    0x4D8162C4, 0x9A22042D,
+    0x4D595BFE, 0x9A039C57,
+    0x4D31494B, 0x99E5443B,
+    0x4D092AB0, 0x99C6FBDE,
+    0x4CE10034, 0x99A8C345,
+    0x4CB8C9DD, 0x998A9A74,
+    0x4C9087B1, 0x996C816F,
+    0x4C6839B7, 0x994E783D,
+    0x4C3FDFF4, 0x99307EE0,
+    0x4C177A6E, 0x9912955F,
+    0x4BEF092D, 0x98F4BBBC,
+    0x4BC68C36, 0x98D6F1FE,
+    0x4B9E0390, 0x98B93828,
+    0x4B756F40, 0x989B8E40,
+    0x4B4CCF4D, 0x987DF449,
+    0x4B2423BE, 0x98606A49,
+    0x4AFB6C98, 0x9842F043,
+    0x4AD2A9E2, 0x9825863D,
+    0x4AA9DBA2, 0x98082C3B,
+    0x4A8101DE, 0x97EAE242,
+    0x4A581C9E, 0x97CDA855,
+    0x4A2F2BE6, 0x97B07E7A,
+    0x4A062FBD, 0x979364B5,
+    0x49DD282A, 0x97765B0A,
+    0x49B41533, 0x9759617F,
+    0x498AF6DF, 0x973C7817,
+    0x4961CD33, 0x971F9ED7,
+    0x49389836, 0x9702D5C3,
+    0x490F57EE, 0x96E61CE0,
+    0x48E60C62, 0x96C97432,
+    0x48BCB599, 0x96ACDBBE,
+    0x48935397, 0x96905388,
+    0x4869E665, 0x9673DB94,
+    0x48406E08, 0x965773E7,
+    0x4816EA86, 0x963B1C86,
+    0x47ED5BE6, 0x961ED574,
+    0x47C3C22F, 0x96029EB6,
+    0x479A1D67, 0x95E67850,
+    0x47706D93, 0x95CA6247,
+    0x4746B2BC, 0x95AE5C9F,
+    0x471CECE7, 0x9592675C,
+    0x46F31C1A, 0x95768283,
+    0x46C9405C, 0x955AAE17,
+    0x469F59B4, 0x953EEA1E,
+    0x46756828, 0x9523369C,
+    0x464B6BBE, 0x95079394,
+    0x4621647D, 0x94EC010B,
+    0x45F7526B, 0x94D07F05,
+    0x45CD358F, 0x94B50D87,
+    0x45A30DF0, 0x9499AC95,
+    0x4578DB93, 0x947E5C33,
+    0x454E9E80, 0x94631C65,
+    0x452456BD, 0x9447ED2F,
+    0x44FA0450, 0x942CCE96,
+    0x44CFA740, 0x9411C09E,
+    0x44A53F93, 0x93F6C34A,
+    0x447ACD50, 0x93DBD6A0,
+    0x4450507E, 0x93C0FAA3,
+    0x4425C923, 0x93A62F57,
+    0x43FB3746, 0x938B74C1,
+    0x43D09AED, 0x9370CAE4,
+    0x43A5F41E, 0x935631C5,
+    0x437B42E1, 0x933BA968,
+    0x4350873C, 0x932131D1,
+    0x4325C135, 0x9306CB04,
+    0x42FAF0D4, 0x92EC7505,
+    0x42D0161E, 0x92D22FD9,
+    0x42A5311B, 0x92B7FB82,
+    0x427A41D0, 0x929DD806,
+    0x424F4845, 0x9283C568,
+    0x42244481, 0x9269C3AC,
+    0x41F93689, 0x924FD2D7,
+    0x41CE1E65, 0x9235F2EC,
+    0x41A2FC1A, 0x921C23EF,
+    0x4177CFB1, 0x920265E4,
+    0x414C992F, 0x91E8B8D0,
+    0x4121589B, 0x91CF1CB6,
+    0x40F60DFB, 0x91B5919A,
+    0x40CAB958, 0x919C1781,
+    0x409F5AB6, 0x9182AE6D,
+    0x4073F21D, 0x91695663,
+    0x40487F94, 0x91500F67,
+    0x401D0321, 0x9136D97D,
+    0x3FF17CCA, 0x911DB4A9,
+    0x3FC5EC98, 0x9104A0EE,
+    0x3F9A5290, 0x90EB9E50,
+    0x3F6EAEB8, 0x90D2ACD4,
+    0x3F430119, 0x90B9CC7D,
+    0x3F1749B8, 0x90A0FD4E,
+    0x3EEB889C, 0x90883F4D,
+    0x3EBFBDCD, 0x906F927C,
+    0x3E93E950, 0x9056F6DF,
+    0x3E680B2C, 0x903E6C7B,
+    0x3E3C2369, 0x9025F352,
+    0x3E10320D, 0x900D8B69,
+    0x3DE4371F, 0x8FF534C4,
+    0x3DB832A6, 0x8FDCEF66,
+    0x3D8C24A8, 0x8FC4BB53,
+    0x3D600D2C, 0x8FAC988F,
+    0x3D33EC39, 0x8F94871D,
+    0x3D07C1D6, 0x8F7C8701,
+    0x3CDB8E09, 0x8F649840,
+    0x3CAF50DA, 0x8F4CBADB,
+    0x3C830A50, 0x8F34EED8,
+    0x3C56BA70, 0x8F1D343A,
+    0x3C2A6142, 0x8F058B04,
+    0x3BFDFECD, 0x8EEDF33B,
+    0x3BD19318, 0x8ED66CE1,
+    0x3BA51E29, 0x8EBEF7FB,
+    0x3B78A007, 0x8EA7948C,
+    0x3B4C18BA, 0x8E904298,
+    0x3B1F8848, 0x8E790222,
+    0x3AF2EEB7, 0x8E61D32E,
+    0x3AC64C0F, 0x8E4AB5BF,
+    0x3A99A057, 0x8E33A9DA,
+    0x3A6CEB96, 0x8E1CAF80,
+    0x3A402DD2, 0x8E05C6B7,
+    0x3A136712, 0x8DEEEF82,
+    0x39E6975E, 0x8DD829E4,
+    0x39B9BEBC, 0x8DC175E0,
+    0x398CDD32, 0x8DAAD37B,
+    0x395FF2C9, 0x8D9442B8,
+    0x3932FF87, 0x8D7DC399,
+    0x39060373, 0x8D675623,
+    0x38D8FE93, 0x8D50FA59,
+    0x38ABF0EF, 0x8D3AB03F,
+    0x387EDA8E, 0x8D2477D8,
+    0x3851BB77, 0x8D0E5127,
+    0x382493B0, 0x8CF83C30,
+    0x37F76341, 0x8CE238F6,
+    0x37CA2A30, 0x8CCC477D,
+    0x379CE885, 0x8CB667C8,
+    0x376F9E46, 0x8CA099DA,
+    0x37424B7B, 0x8C8ADDB7,
+    0x3714F02A, 0x8C753362,
+    0x36E78C5B, 0x8C5F9ADE,
+    0x36BA2014, 0x8C4A142F,
+    0x368CAB5C, 0x8C349F58,
+    0x365F2E3B, 0x8C1F3C5D,
+    0x3631A8B8, 0x8C09EB40,
+    0x36041AD9, 0x8BF4AC05,
+    0x35D684A6, 0x8BDF7EB0,
+    0x35A8E625, 0x8BCA6343,
+    0x357B3F5D, 0x8BB559C1,
+    0x354D9057, 0x8BA0622F,
+    0x351FD918, 0x8B8B7C8F,
+    0x34F219A8, 0x8B76A8E4,
+    0x34C4520D, 0x8B61E733,
+    0x34968250, 0x8B4D377C,
+    0x3468AA76, 0x8B3899C6,
+    0x343ACA87, 0x8B240E11,
+    0x340CE28B, 0x8B0F9462,
+    0x33DEF287, 0x8AFB2CBB,
+    0x33B0FA84, 0x8AE6D720,
+    0x3382FA88, 0x8AD29394,
+    0x3354F29B, 0x8ABE6219,
+    0x3326E2C3, 0x8AAA42B4,
+    0x32F8CB07, 0x8A963567,
+    0x32CAAB6F, 0x8A823A36,
+    0x329C8402, 0x8A6E5123,
+    0x326E54C7, 0x8A5A7A31,
+    0x32401DC6, 0x8A46B564,
+    0x3211DF04, 0x8A3302BE,
+    0x31E39889, 0x8A1F6243,
+    0x31B54A5E, 0x8A0BD3F5,
+    0x3186F487, 0x89F857D8,
+    0x3158970E, 0x89E4EDEF,
+    0x312A31F8, 0x89D1963C,
+    0x30FBC54D, 0x89BE50C3,
+    0x30CD5115, 0x89AB1D87,
+    0x309ED556, 0x8997FC8A,
+    0x30705217, 0x8984EDCF,
+    0x3041C761, 0x8971F15A,
+    0x30133539, 0x895F072E,
+    0x2FE49BA7, 0x894C2F4C,
+    0x2FB5FAB2, 0x893969B9,
+    0x2F875262, 0x8926B677,
+    0x2F58A2BE, 0x89141589,
+    0x2F29EBCC, 0x890186F2,
+    0x2EFB2D95, 0x88EF0AB4,
+    0x2ECC681E, 0x88DCA0D3,
+    0x2E9D9B70, 0x88CA4951,
+    0x2E6EC792, 0x88B80432,
+    0x2E3FEC8B, 0x88A5D177,
+    0x2E110A62, 0x8893B125,
+    0x2DE2211E, 0x8881A33D,
+    0x2DB330C7, 0x886FA7C2,
+    0x2D843964, 0x885DBEB8,
+    0x2D553AFC, 0x884BE821,
+    0x2D263596, 0x883A23FF,
+    0x2CF72939, 0x88287256,
+    0x2CC815EE, 0x8816D327,
+    0x2C98FBBA, 0x88054677,
+    0x2C69DAA6, 0x87F3CC48,
+    0x2C3AB2B9, 0x87E2649B,
+    0x2C0B83FA, 0x87D10F75,
+    0x2BDC4E6F, 0x87BFCCD7,
+    0x2BAD1221, 0x87AE9CC5,
+    0x2B7DCF17, 0x879D7F41,
+    0x2B4E8558, 0x878C744D,
+    0x2B1F34EB, 0x877B7BEC,
+    0x2AEFDDD8, 0x876A9621,
+    0x2AC08026, 0x8759C2EF,
+    0x2A911BDC, 0x87490258,
+    0x2A61B101, 0x8738545E,
+    0x2A323F9E, 0x8727B905,
+    0x2A02C7B8, 0x8717304E,
+    0x29D34958, 0x8706BA3D,
+    0x29A3C485, 0x86F656D3,
+    0x29743946, 0x86E60614,
+    0x2944A7A2, 0x86D5C802,
+    0x29150FA1, 0x86C59C9F,
+    0x28E5714B, 0x86B583EE,
+    0x28B5CCA5, 0x86A57DF2,
+    0x288621B9, 0x86958AAC,
+    0x2856708D, 0x8685AA20,
+    0x2826B928, 0x8675DC4F,
+    0x27F6FB92, 0x8666213C,
+    0x27C737D3, 0x865678EB,
+    0x27976DF1, 0x8646E35C,
+    0x27679DF4, 0x86376092,
+    0x2737C7E3, 0x8627F091,
+    0x2707EBC7, 0x86189359,
+    0x26D809A5, 0x860948EF,
+    0x26A82186, 0x85FA1153,
+    0x26783370, 0x85EAEC88,
+    0x26483F6C, 0x85DBDA91,
+    0x26184581, 0x85CCDB70,
+    0x25E845B6, 0x85BDEF28,
+    0x25B84012, 0x85AF15B9,
+    0x2588349D, 0x85A04F28,
+    0x2558235F, 0x85919B76,
+    0x25280C5E, 0x8582FAA5,
+    0x24F7EFA2, 0x85746CB8,
+    0x24C7CD33, 0x8565F1B0,
+    0x2497A517, 0x85578991,
+    0x24677758, 0x8549345C,
+    0x243743FA, 0x853AF214,
+    0x24070B08, 0x852CC2BB,
+    0x23D6CC87, 0x851EA652,
+    0x23A6887F, 0x85109CDD,
+    0x23763EF7, 0x8502A65C,
+    0x2345EFF8, 0x84F4C2D4,
+    0x23159B88, 0x84E6F244,
+    0x22E541AF, 0x84D934B1,
+    0x22B4E274, 0x84CB8A1B,
+    0x22847DE0, 0x84BDF286,
+    0x225413F8, 0x84B06DF2,
+    0x2223A4C5, 0x84A2FC62,
+    0x21F3304F, 0x84959DD9,
+    0x21C2B69C, 0x84885258,
+    0x219237B5, 0x847B19E1,
+    0x2161B3A0, 0x846DF477,
+    0x21312A65, 0x8460E21A,
+    0x21009C0C, 0x8453E2CF,
+    0x20D0089C, 0x8446F695,
+    0x209F701C, 0x843A1D70,
+    0x206ED295, 0x842D5762,
+    0x203E300D, 0x8420A46C,
+    0x200D888D, 0x84140490,
+    0x1FDCDC1B, 0x840777D0,
+    0x1FAC2ABF, 0x83FAFE2E,
+    0x1F7B7481, 0x83EE97AD,
+    0x1F4AB968, 0x83E2444D,
+    0x1F19F97B, 0x83D60412,
+    0x1EE934C3, 0x83C9D6FC,
+    0x1EB86B46, 0x83BDBD0E,
+    0x1E879D0D, 0x83B1B649,
+    0x1E56CA1E, 0x83A5C2B0,
+    0x1E25F282, 0x8399E244,
+    0x1DF5163F, 0x838E1507,
+    0x1DC4355E, 0x83825AFB,
+    0x1D934FE5, 0x8376B422,
+    0x1D6265DD, 0x836B207D,
+    0x1D31774D, 0x835FA00F,
+    0x1D00843D, 0x835432D8,
+    0x1CCF8CB3, 0x8348D8DC,
+    0x1C9E90B8, 0x833D921B,
+    0x1C6D9053, 0x83325E97,
+    0x1C3C8B8C, 0x83273E52,
+    0x1C0B826A, 0x831C314E,
+    0x1BDA74F6, 0x8311378D,
+    0x1BA96335, 0x83065110,
+    0x1B784D30, 0x82FB7DD8,
+    0x1B4732EF, 0x82F0BDE8,
+    0x1B161479, 0x82E61141,
+    0x1AE4F1D6, 0x82DB77E5,
+    0x1AB3CB0D, 0x82D0F1D5,
+    0x1A82A026, 0x82C67F14,
+    0x1A517128, 0x82BC1FA2,
+    0x1A203E1B, 0x82B1D381,
+    0x19EF0707, 0x82A79AB3,
+    0x19BDCBF3, 0x829D753A,
+    0x198C8CE7, 0x82936317,
+    0x195B49EA, 0x8289644B,
+    0x192A0304, 0x827F78D8,
+    0x18F8B83C, 0x8275A0C0,
+    0x18C7699B, 0x826BDC04,
+    0x18961728, 0x82622AA6,
+    0x1864C0EA, 0x82588CA7,
+    0x183366E9, 0x824F0208,
+    0x1802092C, 0x82458ACC,
+    0x17D0A7BC, 0x823C26F3,
+    0x179F429F, 0x8232D67F,
+    0x176DD9DE, 0x82299971,
+    0x173C6D80, 0x82206FCC,
+    0x170AFD8D, 0x82175990,
+    0x16D98A0C, 0x820E56BE,
+    0x16A81305, 0x82056758,
+    0x1676987F, 0x81FC8B60,
+    0x16451A83, 0x81F3C2D7,
+    0x16139918, 0x81EB0DBE,
+    0x15E21445, 0x81E26C16,
+    0x15B08C12, 0x81D9DDE1,
+    0x157F0086, 0x81D16321,
+    0x154D71AA, 0x81C8FBD6,
+    0x151BDF86, 0x81C0A801,
+    0x14EA4A1F, 0x81B867A5,
+    0x14B8B17F, 0x81B03AC2,
+    0x148715AE, 0x81A82159,
+    0x145576B1, 0x81A01B6D,
+    0x1423D492, 0x819828FD,
+    0x13F22F58, 0x81904A0C,
+    0x13C0870A, 0x81887E9A,
+    0x138EDBB1, 0x8180C6A9,
+    0x135D2D53, 0x8179223A,
+    0x132B7BF9, 0x8171914E,
+    0x12F9C7AA, 0x816A13E6,
+    0x12C8106F, 0x8162AA04,
+    0x1296564D, 0x815B53A8,
+    0x1264994E, 0x815410D4,
+    0x1232D979, 0x814CE188,
+    0x120116D5, 0x8145C5C7,
+    0x11CF516A, 0x813EBD90,
+    0x119D8941, 0x8137C8E6,
+    0x116BBE60, 0x8130E7C9,
+    0x1139F0CF, 0x812A1A3A,
+    0x11082096, 0x8123603A,
+    0x10D64DBD, 0x811CB9CA,
+    0x10A4784B, 0x811626EC,
+    0x1072A048, 0x810FA7A0,
+    0x1040C5BB, 0x81093BE8,
+    0x100EE8AD, 0x8102E3C4,
+    0x0FDD0926, 0x80FC9F35,
+    0x0FAB272B, 0x80F66E3C,
+    0x0F7942C7, 0x80F050DB,
+    0x0F475BFF, 0x80EA4712,
+    0x0F1572DC, 0x80E450E2,
+    0x0EE38766, 0x80DE6E4C,
+    0x0EB199A4, 0x80D89F51,
+    0x0E7FA99E, 0x80D2E3F2,
+    0x0E4DB75B, 0x80CD3C2F,
+    0x0E1BC2E4, 0x80C7A80A,
+    0x0DE9CC40, 0x80C22784,
+    0x0DB7D376, 0x80BCBA9D,
+    0x0D85D88F, 0x80B76156,
+    0x0D53DB92, 0x80B21BAF,
+    0x0D21DC87, 0x80ACE9AB,
+    0x0CEFDB76, 0x80A7CB49,
+    0x0CBDD865, 0x80A2C08B,
+    0x0C8BD35E, 0x809DC971,
+    0x0C59CC68, 0x8098E5FB,
+    0x0C27C389, 0x8094162C,
+    0x0BF5B8CB, 0x808F5A02,
+    0x0BC3AC35, 0x808AB180,
+    0x0B919DCF, 0x80861CA6,
+    0x0B5F8D9F, 0x80819B74,
+    0x0B2D7BAF, 0x807D2DEC,
+    0x0AFB6805, 0x8078D40D,
+    0x0AC952AA, 0x80748DD9,
+    0x0A973BA5, 0x80705B50,
+    0x0A6522FE, 0x806C3C74,
+    0x0A3308BD, 0x80683143,
+    0x0A00ECE8, 0x806439C0,
+    0x09CECF89, 0x806055EB,
+    0x099CB0A7, 0x805C85C4,
+    0x096A9049, 0x8058C94C,
+    0x09386E78, 0x80552084,
+    0x09064B3A, 0x80518B6B,
+    0x08D42699, 0x804E0A04,
+    0x08A2009A, 0x804A9C4D,
+    0x086FD947, 0x80474248,
+    0x083DB0A7, 0x8043FBF6,
+    0x080B86C2, 0x8040C956,
+    0x07D95B9E, 0x803DAA6A,
+    0x07A72F45, 0x803A9F31,
+    0x077501BE, 0x8037A7AC,
+    0x0742D311, 0x8034C3DD,
+    0x0710A345, 0x8031F3C2,
+    0x06DE7262, 0x802F375D,
+    0x06AC406F, 0x802C8EAD,
+    0x067A0D76, 0x8029F9B4,
+    0x0647D97C, 0x80277872,
+    0x0615A48B, 0x80250AE7,
+    0x05E36EA9, 0x8022B114,
+    0x05B137DF, 0x80206AF8,
+    0x057F0035, 0x801E3895,
+    0x054CC7B1, 0x801C19EA,
+    0x051A8E5C, 0x801A0EF8,
+    0x04E8543E, 0x801817BF,
+    0x04B6195D, 0x80163440,
+    0x0483DDC3, 0x8014647B,
+    0x0451A177, 0x8012A86F,
+    0x041F6480, 0x8011001F,
+    0x03ED26E6, 0x800F6B88,
+    0x03BAE8B2, 0x800DEAAD,
+    0x0388A9EA, 0x800C7D8C,
+    0x03566A96, 0x800B2427,
+    0x03242ABF, 0x8009DE7E,
+    0x02F1EA6C, 0x8008AC90,
+    0x02BFA9A4, 0x80078E5E,
+    0x028D6870, 0x800683E8,
+    0x025B26D7, 0x80058D2F,
+    0x0228E4E2, 0x8004AA32,
+    0x01F6A297, 0x8003DAF1,
+    0x01C45FFE, 0x80031F6D,
+    0x01921D20, 0x800277A6,
+    0x015FDA03, 0x8001E39B,
+    0x012D96B1, 0x8001634E,
+    0x00FB5330, 0x8000F6BD,
+    0x00C90F88, 0x80009DEA,
+    0x0096CBC1, 0x800058D4,
+    0x006487E3, 0x8000277A,
+    0x003243F5, 0x800009DF
+};
+
+/*    
+* @brief  Quarter-wave twiddle factors Tables    
+*/
+
+/**    
+* \par    
+* Compact tables for RISCV_MATH_COMPACT_TWIDDLE, generation:    
+* \par    
+* <pre>for(i = 0; i <= N/4; i++)    
+* {    
+*    twiddleCoefQuarter[i] = cos(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* The values are the cos entries of the first quadrant of twiddleCoef_N and twiddleCoef_N_q15,    
+* the other quadrants and the sin values are folded by riscv_twiddle_fold_f32() and riscv_twiddle_fold_q15().    
+* A table holds N/4+1 values, instead of 2*N (floating-point) and 3*N/2 (q15) for the full tables.    
+*/
+
+const float32_t twiddleCoefQuarter_16[5] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_16) = {
+    1.000000000f, 0.923879533f, 0.707106781f, 0.382683432f,
+    0.000000000f
+};
+
+const float32_t twiddleCoefQuarter_32[9] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_32) = {
+    1.000000000f, 0.980785280f, 0.923879533f, 0.831469612f,
+    0.707106781f, 0.555570233f, 0.382683432f, 0.195090322f,
+    0.000000000f
+};
+
+const float32_t twiddleCoefQuarter_64[17] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_64) = {
+    1.000000000f, 0.995184727f, 0.980785280f, 0.956940336f,
+    0.923879533f, 0.881921264f, 0.831469612f, 0.773010453f,
+    0.707106781f, 0.634393284f, 0.555570233f, 0.471396737f,
+    0.382683432f, 0.290284677f, 0.195090322f, 0.098017140f,
+    0.000000000f
+};
+
+const float32_t twiddleCoefQuarter_128[33] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_128) = {
+    1.000000000f, 0.998795456f, 0.995184727f, 0.989176510f,
+    0.980785280f, 0.970031253f, 0.956940336f, 0.941544065f,
+    0.923879533f, 0.903989293f, 0.881921264f, 0.857728610f,
+    0.831469612f, 0.803207531f, 0.773010453f, 0.740951125f,
+    0.707106781f, 0.671558955f, 0.634393284f, 0.595699304f,
+    0.555570233f, 0.514102744f, 0.471396737f, 0.427555093f,
+    0.382683432f, 0.336889853f, 0.290284677f, 0.242980180f,
+    0.195090322f, 0.146730474f, 0.098017140f, 0.049067674f,
+    0.000000000f
+};
+
+const float32_t twiddleCoefQuarter_256[65] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_256) = {
+    1.000000000f, 0.999698819f, 0.998795456f, 0.997290457f,
+    0.995184727f, 0.992479535f, 0.989176510f, 0.985277642f,
+    0.980785280f, 0.975702130f, 0.970031253f, 0.963776066f,
+    0.956940336f, 0.949528181f, 0.941544065f, 0.932992799f,
+    0.923879533f, 0.914209756f, 0.903989293f, 0.893224301f,
+    0.881921264f, 0.870086991f, 0.857728610f, 0.844853565f,
+    0.831469612f, 0.817584813f, 0.803207531f, 0.788346428f,
+    0.773010453f, 0.757208847f, 0.740951125f, 0.724247083f,
+    0.707106781f, 0.689540545f, 0.671558955f, 0.653172843f,
+    0.634393284f, 0.615231591f, 0.595699304f, 0.575808191f,
+    0.555570233f, 0.534997620f, 0.514102744f, 0.492898192f,
+    0.471396737f, 0.449611330f, 0.427555093f, 0.405241314f,
+    0.382683432f, 0.359895037f, 0.336889853f, 0.313681740f,
+    0.290284677f, 0.266712757f, 0.242980180f, 0.219101240f,
+    0.195090322f, 0.170961889f, 0.146730474f, 0.122410675f,
+    0.098017140f, 0.073564564f, 0.049067674f, 0.024541229f,
+    0.000000000f
+};
+
+const float32_t twiddleCoefQuarter_512[129] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_512) = {
+    1.000000000f, 0.999924702f, 0.999698819f, 0.999322385f,
+    0.998795456f, 0.998118113f, 0.997290457f, 0.996312612f,
+    0.995184727f, 0.993906970f, 0.992479535f, 0.990902635f,
+    0.989176510f, 0.987301418f, 0.985277642f, 0.983105487f,
+    0.980785280f, 0.978317371f, 0.975702130f, 0.972939952f,
+    0.970031253f, 0.966976471f, 0.963776066f, 0.960430519f,
+    0.956940336f, 0.953306040f, 0.949528181f, 0.945607325f,
+    0.941544065f, 0.937339012f, 0.932992799f, 0.928506080f,
+    0.923879533f, 0.919113852f, 0.914209756f, 0.909167983f,
+    0.903989293f, 0.898674466f, 0.893224301f, 0.887639620f,
+    0.881921264f, 0.876070094f, 0.870086991f, 0.863972856f,
+    0.857728610f, 0.851355193f, 0.844853565f, 0.838224706f,
+    0.831469612f, 0.824589303f, 0.817584813f, 0.810457198f,
+    0.803207531f, 0.795836905f, 0.788346428f, 0.780737229f,
+    0.773010453f, 0.765167266f, 0.757208847f, 0.749136395f,
+    0.740951125f, 0.732654272f, 0.724247083f, 0.715730825f,
+    0.707106781f, 0.698376249f, 0.689540545f, 0.680600998f,
+    0.671558955f, 0.662415778f, 0.653172843f, 0.643831543f,
+    0.634393284f, 0.624859488f, 0.615231591f, 0.605511041f,
+    0.595699304f, 0.585797857f, 0.575808191f, 0.565731811f,
+    0.555570233f, 0.545324988f, 0.534997620f, 0.524589683f,
+    0.514102744f, 0.503538384f, 0.492898192f, 0.482183772f,
+    0.471396737f, 0.460538711f, 0.449611330f, 0.438616239f,
+    0.427555093f, 0.416429560f, 0.405241314f, 0.393992040f,
+    0.382683432f, 0.371317194f, 0.359895037f, 0.348418680f,
+    0.336889853f, 0.325310292f, 0.313681740f, 0.302005949f,
+    0.290284677f, 0.278519689f, 0.266712757f, 0.254865660f,
+    0.242980180f, 0.231058108f, 0.219101240f, 0.207111376f,
+    0.195090322f, 0.183039888f, 0.170961889f, 0.158858143f,
+    0.146730474f, 0.134580709f, 0.122410675f, 0.110222207f,
+    0.098017140f, 0.085797312f, 0.073564564f, 0.061320736f,
+    0.049067674f, 0.036807223f, 0.024541229f, 0.012271538f,
+    0.000000000f
+};
+
+const float32_t twiddleCoefQuarter_1024[257] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_1024) = {
+    1.000000000f, 0.999981175f, 0.999924702f, 0.999830582f,
+    0.999698819f, 0.999529418f, 0.999322385f, 0.999077728f,
+    0.998795456f, 0.998475581f, 0.998118113f, 0.997723067f,
+    0.997290457f, 0.996820299f, 0.996312612f, 0.995767414f,
+    0.995184727f, 0.994564571f, 0.993906970f, 0.993211949f,
+    0.992479535f, 0.991709754f, 0.990902635f, 0.990058210f,
+    0.989176510f, 0.988257568f, 0.987301418f, 0.986308097f,
+    0.985277642f, 0.984210092f, 0.983105487f, 0.981963869f,
+    0.980785280f, 0.979569766f, 0.978317371f, 0.977028143f,
+    0.975702130f, 0.974339383f, 0.972939952f, 0.971503891f,
+    0.970031253f, 0.968522094f, 0.966976471f, 0.965394442f,
+    0.963776066f, 0.962121404f, 0.960430519f, 0.958703475f,
+    0.956940336f, 0.955141168f, 0.953306040f, 0.951435021f,
+    0.949528181f, 0.947585591f, 0.945607325f, 0.943593458f,
+    0.941544065f, 0.939459224f, 0.937339012f, 0.935183510f,
+    0.932992799f, 0.930766961f, 0.928506080f, 0.926210242f,
+    0.923879533f, 0.921514039f, 0.919113852f, 0.916679060f,
+    0.914209756f, 0.911706032f, 0.909167983f, 0.906595705f,
+    0.903989293f, 0.901348847f, 0.898674466f, 0.895966250f,
+    0.893224301f, 0.890448723f, 0.887639620f, 0.884797098f,
+    0.881921264f, 0.879012226f, 0.876070094f, 0.873094978f,
+    0.870086991f, 0.867046246f, 0.863972856f, 0.860866939f,
+    0.857728610f, 0.854557988f, 0.851355193f, 0.848120345f,
+    0.844853565f, 0.841554977f, 0.838224706f, 0.834862875f,
+    0.831469612f, 0.828045045f, 0.824589303f, 0.821102515f,
+    0.817584813f, 0.814036330f, 0.810457198f, 0.806847554f,
+    0.803207531f, 0.799537269f, 0.795836905f, 0.792106577f,
+    0.788346428f, 0.784556597f, 0.780737229f, 0.776888466f,
+    0.773010453f, 0.769103338f, 0.765167266f, 0.761202385f,
+    0.757208847f, 0.753186799f, 0.749136395f, 0.745057785f,
+    0.740951125f, 0.736816569f, 0.732654272f, 0.728464390f,
+    0.724247083f, 0.720002508f, 0.715730825f, 0.711432196f,
+    0.707106781f, 0.702754744f, 0.698376249f, 0.693971461f,
+    0.689540545f, 0.685083668f, 0.680600998f, 0.676092704f,
+    0.671558955f, 0.666999922f, 0.662415778f, 0.657806693f,
+    0.653172843f, 0.648514401f, 0.643831543f, 0.639124445f,
+    0.634393284f, 0.629638239f, 0.624859488f, 0.620057212f,
+    0.615231591f, 0.610382806f, 0.605511041f, 0.600616479f,
+    0.595699304f, 0.590759702f, 0.585797857f, 0.580813958f,
+    0.575808191f, 0.570780746f, 0.565731811f, 0.560661576f,
+    0.555570233f, 0.550457973f, 0.545324988f, 0.540171473f,
+    0.534997620f, 0.529803625f, 0.524589683f, 0.519355990f,
+    0.514102744f, 0.508830143f, 0.503538384f, 0.498227667f,
+    0.492898192f, 0.487550160f, 0.482183772f, 0.476799230f,
+    0.471396737f, 0.465976496f, 0.460538711f, 0.455083587f,
+    0.449611330f, 0.444122145f, 0.438616239f, 0.433093819f,
+    0.427555093f, 0.422000271f, 0.416429560f, 0.410843171f,
+    0.405241314f, 0.399624200f, 0.393992040f, 0.388345047f,
+    0.382683432f, 0.377007410f, 0.371317194f, 0.365612998f,
+    0.359895037f, 0.354163525f, 0.348418680f, 0.342660717f,
+    0.336889853f, 0.331106306f, 0.325310292f, 0.319502031f,
+    0.313681740f, 0.307849640f, 0.302005949f, 0.296150888f,
+    0.290284677f, 0.284407537f, 0.278519689f, 0.272621355f,
+    0.266712757f, 0.260794118f, 0.254865660f, 0.248927606f,
+    0.242980180f, 0.237023606f, 0.231058108f, 0.225083911f,
+    0.219101240f, 0.213110320f, 0.207111376f, 0.201104635f,
+    0.195090322f, 0.189068664f, 0.183039888f, 0.177004220f,
+    0.170961889f, 0.164913120f, 0.158858143f, 0.152797185f,
+    0.146730474f, 0.140658239f, 0.134580709f, 0.128498111f,
+    0.122410675f, 0.116318631f, 0.110222207f, 0.104121634f,
+    0.098017140f, 0.091908956f, 0.085797312f, 0.079682438f,
+    0.073564564f, 0.067443920f, 0.061320736f, 0.055195244f,
+    0.049067674f, 0.042938257f, 0.036807223f, 0.030674803f,
+    0.024541229f, 0.018406730f, 0.012271538f, 0.006135885f,
+    0.000000000f
+};
+
+const float32_t twiddleCoefQuarter_2048[513] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_2048) = {
+    1.000000000f, 0.999995294f, 0.999981175f, 0.999957645f,
+    0.999924702f, 0.999882347f, 0.999830582f, 0.999769405f,
+    0.999698819f, 0.999618822f, 0.999529418f, 0.999430605f,
+    0.999322385f, 0.999204759f, 0.999077728f, 0.998941293f,
+    0.998795456f, 0.998640218f, 0.998475581f, 0.998301545f,
+    0.998118113f, 0.997925286f, 0.997723067f, 0.997511456f,
+    0.997290457f, 0.997060070f, 0.996820299f, 0.996571146f,
+    0.996312612f, 0.996044701f, 0.995767414f, 0.995480755f,
+    0.995184727f, 0.994879331f, 0.994564571f, 0.994240449f,
+    0.993906970f, 0.993564136f, 0.993211949f, 0.992850414f,
+    0.992479535f, 0.992099313f, 0.991709754f, 0.991310860f,
+    0.990902635f, 0.990485084f, 0.990058210f, 0.989622017f,
+    0.989176510f, 0.988721692f, 0.988257568f, 0.987784142f,
+    0.987301418f, 0.986809402f, 0.986308097f, 0.985797509f,
+    0.985277642f, 0.984748502f, 0.984210092f, 0.983662419f,
+    0.983105487f, 0.982539302f, 0.981963869f, 0.981379193f,
+    0.980785280f, 0.980182136f, 0.979569766f, 0.978948175f,
+    0.978317371f, 0.977677358f, 0.977028143f, 0.976369731f,
+    0.975702130f, 0.975025345f, 0.974339383f, 0.973644250f,
+    0.972939952f, 0.972226497f, 0.971503891f, 0.970772141f,
+    0.970031253f, 0.969281235f, 0.968522094f, 0.967753837f,
+    0.966976471f, 0.966190003f, 0.965394442f, 0.964589793f,
+    0.963776066f, 0.962953267f, 0.962121404f, 0.961280486f,
+    0.960430519f, 0.959571513f, 0.958703475f, 0.957826413f,
+    0.956940336f, 0.956045251f, 0.955141168f, 0.954228095f,
+    0.953306040f, 0.952375013f, 0.951435021f, 0.950486074f,
+    0.949528181f, 0.948561350f, 0.947585591f, 0.946600913f,
+    0.945607325f, 0.944604837f, 0.943593458f, 0.942573198f,
+    0.941544065f, 0.940506071f, 0.939459224f, 0.938403534f,
+    0.937339012f, 0.936265667f, 0.935183510f, 0.934092550f,
+    0.932992799f, 0.931884266f, 0.930766961f, 0.929640896f,
+    0.928506080f, 0.927362526f, 0.926210242f, 0.925049241f,
+    0.923879533f, 0.922701128f, 0.921514039f, 0.920318277f,
+    0.919113852f, 0.917900776f, 0.916679060f, 0.915448716f,
+    0.914209756f, 0.912962190f, 0.911706032f, 0.910441292f,
+    0.909167983f, 0.907886116f, 0.906595705f, 0.905296759f,
+    0.903989293f, 0.902673318f, 0.901348847f, 0.900015892f,
+    0.898674466f, 0.897324581f, 0.895966250f, 0.894599486f,
+    0.893224301f, 0.891840709f, 0.890448723f, 0.889048356f,
+    0.887639620f, 0.886222530f, 0.884797098f, 0.883363339f,
+    0.881921264f, 0.880470889f, 0.879012226f, 0.877545290f,
+    0.876070094f, 0.874586652f, 0.873094978f, 0.871595087f,
+    0.870086991f, 0.868570706f, 0.867046246f, 0.865513624f,
+    0.863972856f, 0.862423956f, 0.860866939f, 0.859301818f,
+    0.857728610f, 0.856147328f, 0.854557988f, 0.852960605f,
+    0.851355193f, 0.849741768f, 0.848120345f, 0.846490939f,
+    0.844853565f, 0.843208240f, 0.841554977f, 0.839893794f,
+    0.838224706f, 0.836547727f, 0.834862875f, 0.833170165f,
+    0.831469612f, 0.829761234f, 0.828045045f, 0.826321063f,
+    0.824589303f, 0.822849781f, 0.821102515f, 0.819347520f,
+    0.817584813f, 0.815814411f, 0.814036330f, 0.812250587f,
+    0.810457198f, 0.808656182f, 0.806847554f, 0.805031331f,
+    0.803207531f, 0.801376172f, 0.799537269f, 0.797690841f,
+    0.795836905f, 0.793975478f, 0.792106577f, 0.790230221f,
+    0.788346428f, 0.786455214f, 0.784556597f, 0.782650596f,
+    0.780737229f, 0.778816512f, 0.776888466f, 0.774953107f,
+    0.773010453f, 0.771060524f, 0.769103338f, 0.767138912f,
+    0.765167266f, 0.763188417f, 0.761202385f, 0.759209189f,
+    0.757208847f, 0.755201377f, 0.753186799f, 0.751165132f,
+    0.749136395f, 0.747100606f, 0.745057785f, 0.743007952f,
+    0.740951125f, 0.738887324f, 0.736816569f, 0.734738878f,
+    0.732654272f, 0.730562769f, 0.728464390f, 0.726359155f,
+    0.724247083f, 0.722128194f, 0.720002508f, 0.717870045f,
+    0.715730825f, 0.713584869f, 0.711432196f, 0.709272826f,
+    0.707106781f, 0.704934080f, 0.702754744f, 0.700568794f,
+    0.698376249f, 0.696177131f, 0.693971461f, 0.691759258f,
+    0.689540545f, 0.687315341f, 0.685083668f, 0.682845546f,
+    0.680600998f, 0.678350043f, 0.676092704f, 0.673829000f,
+    0.671558955f, 0.669282588f, 0.666999922f, 0.664710978f,
+    0.662415778f, 0.660114342f, 0.657806693f, 0.655492853f,
+    0.653172843f, 0.650846685f, 0.648514401f, 0.646176013f,
+    0.643831543f, 0.641481013f, 0.639124445f, 0.636761861f,
+    0.634393284f, 0.632018736f, 0.629638239f, 0.627251815f,
+    0.624859488f, 0.622461279f, 0.620057212f, 0.617647308f,
+    0.615231591f, 0.612810082f, 0.610382806f, 0.607949785f,
+    0.605511041f, 0.603066599f, 0.600616479f, 0.598160707f,
+    0.595699304f, 0.593232295f, 0.590759702f, 0.588281548f,
+    0.585797857f, 0.583308653f, 0.580813958f, 0.578313796f,
+    0.575808191f, 0.573297167f, 0.570780746f, 0.568258953f,
+    0.565731811f, 0.563199344f, 0.560661576f, 0.558118531f,
+    0.555570233f, 0.553016706f, 0.550457973f, 0.547894059f,
+    0.545324988f, 0.542750785f, 0.540171473f, 0.537587076f,
+    0.534997620f, 0.532403128f, 0.529803625f, 0.527199135f,
+    0.524589683f, 0.521975293f, 0.519355990f, 0.516731799f,
+    0.514102744f, 0.511468850f, 0.508830143f, 0.506186645f,
+    0.503538384f, 0.500885383f, 0.498227667f, 0.495565262f,
+    0.492898192f, 0.490226483f, 0.487550160f, 0.484869248f,
+    0.482183772f, 0.479493758f, 0.476799230f, 0.474100215f,
+    0.471396737f, 0.468688822f, 0.465976496f, 0.463259784f,
+    0.460538711f, 0.457813304f, 0.455083587f, 0.452349587f,
+    0.449611330f, 0.446868840f, 0.444122145f, 0.441371269f,
+    0.438616239f, 0.435857080f, 0.433093819f, 0.430326481f,
+    0.427555093f, 0.424779681f, 0.422000271f, 0.419216888f,
+    0.416429560f, 0.413638312f, 0.410843171f, 0.408044163f,
+    0.405241314f, 0.402434651f, 0.399624200f, 0.396809987f,
+    0.393992040f, 0.391170384f, 0.388345047f, 0.385516054f,
+    0.382683432f, 0.379847209f, 0.377007410f, 0.374164063f,
+    0.371317194f, 0.368466830f, 0.365612998f, 0.362755724f,
+    0.359895037f, 0.357030961f, 0.354163525f, 0.351292756f,
+    0.348418680f, 0.345541325f, 0.342660717f, 0.339776884f,
+    0.336889853f, 0.333999651f, 0.331106306f, 0.328209844f,
+    0.325310292f, 0.322407679f, 0.319502031f, 0.316593376f,
+    0.313681740f, 0.310767153f, 0.307849640f, 0.304929230f,
+    0.302005949f, 0.299079826f, 0.296150888f, 0.293219163f,
+    0.290284677f, 0.287347460f, 0.284407537f, 0.281464938f,
+    0.278519689f, 0.275571819f, 0.272621355f, 0.269668326f,
+    0.266712757f, 0.263754679f, 0.260794118f, 0.257831102f,
+    0.254865660f, 0.251897818f, 0.248927606f, 0.245955050f,
+    0.242980180f, 0.240003022f, 0.237023606f, 0.234041959f,
+    0.231058108f, 0.228072083f, 0.225083911f, 0.222093621f,
+    0.219101240f, 0.216106797f, 0.213110320f, 0.210111837f,
+    0.207111376f, 0.204108966f, 0.201104635f, 0.198098411f,
+    0.195090322f, 0.192080397f, 0.189068664f, 0.186055152f,
+    0.183039888f, 0.180022901f, 0.177004220f, 0.173983873f,
+    0.170961889f, 0.167938295f, 0.164913120f, 0.161886394f,
+    0.158858143f, 0.155828398f, 0.152797185f, 0.149764535f,
+    0.146730474f, 0.143695033f, 0.140658239f, 0.137620122f,
+    0.134580709f, 0.131540029f, 0.128498111f, 0.125454983f,
+    0.122410675f, 0.119365215f, 0.116318631f, 0.113270952f,
+    0.110222207f, 0.107172425f, 0.104121634f, 0.101069863f,
+    0.098017140f, 0.094963495f, 0.091908956f, 0.088853553f,
+    0.085797312f, 0.082740265f, 0.079682438f, 0.076623861f,
+    0.073564564f, 0.070504573f, 0.067443920f, 0.064382631f,
+    0.061320736f, 0.058258265f, 0.055195244f, 0.052131705f,
+    0.049067674f, 0.046003182f, 0.042938257f, 0.039872928f,
+    0.036807223f, 0.033741172f, 0.030674803f, 0.027608146f,
+    0.024541229f, 0.021474080f, 0.018406730f, 0.015339206f,
+    0.012271538f, 0.009203755f, 0.006135885f, 0.003067957f,
+    0.000000000f
+};
+
+const float32_t twiddleCoefQuarter_4096[1025] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_4096) = {
+    1.000000000f, 0.999998823f, 0.999995294f, 0.999989411f,
+    0.999981175f, 0.999970586f, 0.999957645f, 0.999942350f,
+    0.999924702f, 0.999904701f, 0.999882347f, 0.999857641f,
+    0.999830582f, 0.999801170f, 0.999769405f, 0.999735288f,
+    0.999698819f, 0.999659997f, 0.999618822f, 0.999575296f,
+    0.999529418f, 0.999481187f, 0.999430605f, 0.999377670f,
+    0.999322385f, 0.999264747f, 0.999204759f, 0.999142419f,
+    0.999077728f, 0.999010686f, 0.998941293f, 0.998869550f,
+    0.998795456f, 0.998719012f, 0.998640218f, 0.998559074f,
+    0.998475581f, 0.998389737f, 0.998301545f, 0.998211003f,
+    0.998118113f, 0.998022874f, 0.997925286f, 0.997825350f,
+    0.997723067f, 0.997618435f, 0.997511456f, 0.997402130f,
+    0.997290457f, 0.997176437f, 0.997060070f, 0.996941358f,
+    0.996820299f, 0.996696895f, 0.996571146f, 0.996443051f,
+    0.996312612f, 0.996179829f, 0.996044701f, 0.995907229f,
+    0.995767414f, 0.995625256f, 0.995480755f, 0.995333912f,
+    0.995184727f, 0.995033199f, 0.994879331f, 0.994723121f,
+    0.994564571f, 0.994403680f, 0.994240449f, 0.994074879f,
+    0.993906970f, 0.993736722f, 0.993564136f, 0.993389211f,
+    0.993211949f, 0.993032350f, 0.992850414f, 0.992666142f,
+    0.992479535f, 0.992290591f, 0.992099313f, 0.991905700f,
+    0.991709754f, 0.991511473f, 0.991310860f, 0.991107914f,
+    0.990902635f, 0.990695025f, 0.990485084f, 0.990272812f,
+    0.990058210f, 0.989841278f, 0.989622017f, 0.989400428f,
+    0.989176510f, 0.988950265f, 0.988721692f, 0.988490793f,
+    0.988257568f, 0.988022017f, 0.987784142f, 0.987543942f,
+    0.987301418f, 0.987056571f, 0.986809402f, 0.986559910f,
+    0.986308097f, 0.986053963f, 0.985797509f, 0.985538735f,
+    0.985277642f, 0.985014231f, 0.984748502f, 0.984480455f,
+    0.984210092f, 0.983937413f, 0.983662419f, 0.983385110f,
+    0.983105487f, 0.982823551f, 0.982539302f, 0.982252741f,
+    0.981963869f, 0.981672686f, 0.981379193f, 0.981083391f,
+    0.980785280f, 0.980484862f, 0.980182136f, 0.979877104f,
+    0.979569766f, 0.979260123f, 0.978948175f, 0.978633924f,
+    0.978317371f, 0.977998515f, 0.977677358f, 0.977353900f,
+    0.977028143f, 0.976700086f, 0.976369731f, 0.976037079f,
+    0.975702130f, 0.975364885f, 0.975025345f, 0.974683511f,
+    0.974339383f, 0.973992962f, 0.973644250f, 0.973293246f,
+    0.972939952f, 0.972584369f, 0.972226497f, 0.971866337f,
+    0.971503891f, 0.971139158f, 0.970772141f, 0.970402839f,
+    0.970031253f, 0.969657385f, 0.969281235f, 0.968902805f,
+    0.968522094f, 0.968139105f, 0.967753837f, 0.967366292f,
+    0.966976471f, 0.966584374f, 0.966190003f, 0.965793359f,
+    0.965394442f, 0.964993253f, 0.964589793f, 0.964184064f,
+    0.963776066f, 0.963365800f, 0.962953267f, 0.962538468f,
+    0.962121404f, 0.961702077f, 0.961280486f, 0.960856633f,
+    0.960430519f, 0.960002146f, 0.959571513f, 0.959138622f,
+    0.958703475f, 0.958266071f, 0.957826413f, 0.957384501f,
+    0.956940336f, 0.956493919f, 0.956045251f, 0.955594334f,
+    0.955141168f, 0.954685755f, 0.954228095f, 0.953768190f,
+    0.953306040f, 0.952841648f, 0.952375013f, 0.951906137f,
+    0.951435021f, 0.950961666f, 0.950486074f, 0.950008245f,
+    0.949528181f, 0.949045882f, 0.948561350f, 0.948074586f,
+    0.947585591f, 0.947094366f, 0.946600913f, 0.946105232f,
+    0.945607325f, 0.945107193f, 0.944604837f, 0.944100258f,
+    0.943593458f, 0.943084437f, 0.942573198f, 0.942059740f,
+    0.941544065f, 0.941026175f, 0.940506071f, 0.939983753f,
+    0.939459224f, 0.938932484f, 0.938403534f, 0.937872376f,
+    0.937339012f, 0.936803442f, 0.936265667f, 0.935725689f,
+    0.935183510f, 0.934639130f, 0.934092550f, 0.933543773f,
+    0.932992799f, 0.932439629f, 0.931884266f, 0.931326709f,
+    0.930766961f, 0.930205023f, 0.929640896f, 0.929074581f,
+    0.928506080f, 0.927935395f, 0.927362526f, 0.926787474f,
+    0.926210242f, 0.925630831f, 0.925049241f, 0.924465474f,
+    0.923879533f, 0.923291417f, 0.922701128f, 0.922108669f,
+    0.921514039f, 0.920917242f, 0.920318277f, 0.919717146f,
+    0.919113852f, 0.918508394f, 0.917900776f, 0.917290997f,
+    0.916679060f, 0.916064966f, 0.915448716f, 0.914830312f,
+    0.914209756f, 0.913587048f, 0.912962190f, 0.912335185f,
+    0.911706032f, 0.911074734f, 0.910441292f, 0.909805708f,
+    0.909167983f, 0.908528119f, 0.907886116f, 0.907241978f,
+    0.906595705f, 0.905947298f, 0.905296759f, 0.904644091f,
+    0.903989293f, 0.903332368f, 0.902673318f, 0.902012144f,
+    0.901348847f, 0.900683429f, 0.900015892f, 0.899346237f,
+    0.898674466f, 0.898000580f, 0.897324581f, 0.896646470f,
+    0.895966250f, 0.895283921f, 0.894599486f, 0.893912945f,
+    0.893224301f, 0.892533555f, 0.891840709f, 0.891145765f,
+    0.890448723f, 0.889749586f, 0.889048356f, 0.888345033f,
+    0.887639620f, 0.886932119f, 0.886222530f, 0.885510856f,
+    0.884797098f, 0.884081259f, 0.883363339f, 0.882643340f,
+    0.881921264f, 0.881197113f, 0.880470889f, 0.879742593f,
+    0.879012226f, 0.878279792f, 0.877545290f, 0.876808724f,
+    0.876070094f, 0.875329403f, 0.874586652f, 0.873841843f,
+    0.873094978f, 0.872346059f, 0.871595087f, 0.870842063f,
+    0.870086991f, 0.869329871f, 0.868570706f, 0.867809497f,
+    0.867046246f, 0.866280954f, 0.865513624f, 0.864744258f,
+    0.863972856f, 0.863199422f, 0.862423956f, 0.861646461f,
+    0.860866939f, 0.860085390f, 0.859301818f, 0.858516224f,
+    0.857728610f, 0.856938977f, 0.856147328f, 0.855353665f,
+    0.854557988f, 0.853760301f, 0.852960605f, 0.852158902f,
+    0.851355193f, 0.850549481f, 0.849741768f, 0.848932055f,
+    0.848120345f, 0.847306639f, 0.846490939f, 0.845673247f,
+    0.844853565f, 0.844031895f, 0.843208240f, 0.842382600f,
+    0.841554977f, 0.840725375f, 0.839893794f, 0.839060237f,
+    0.838224706f, 0.837387202f, 0.836547727f, 0.835706284f,
+    0.834862875f, 0.834017501f, 0.833170165f, 0.832320868f,
+    0.831469612f, 0.830616400f, 0.829761234f, 0.828904115f,
+    0.828045045f, 0.827184027f, 0.826321063f, 0.825456154f,
+    0.824589303f, 0.823720511f, 0.822849781f, 0.821977115f,
+    0.821102515f, 0.820225983f, 0.819347520f, 0.818467130f,
+    0.817584813f, 0.816700573f, 0.815814411f, 0.814926329f,
+    0.814036330f, 0.813144415f, 0.812250587f, 0.811354847f,
+    0.810457198f, 0.809557642f, 0.808656182f, 0.807752818f,
+    0.806847554f, 0.805940391f, 0.805031331f, 0.804120377f,
+    0.803207531f, 0.802292796f, 0.801376172f, 0.800457662f,
+    0.799537269f, 0.798614995f, 0.797690841f, 0.796764810f,
+    0.795836905f, 0.794907126f, 0.793975478f, 0.793041960f,
+    0.792106577f, 0.791169330f, 0.790230221f, 0.789289253f,
+    0.788346428f, 0.787401747f, 0.786455214f, 0.785506830f,
+    0.784556597f, 0.783604519f, 0.782650596f, 0.781694832f,
+    0.780737229f, 0.779777788f, 0.778816512f, 0.777853404f,
+    0.776888466f, 0.775921699f, 0.774953107f, 0.773982691f,
+    0.773010453f, 0.772036397f, 0.771060524f, 0.770082837f,
+    0.769103338f, 0.768122029f, 0.767138912f, 0.766153990f,
+    0.765167266f, 0.764178741f, 0.763188417f, 0.762196298f,
+    0.761202385f, 0.760206682f, 0.759209189f, 0.758209910f,
+    0.757208847f, 0.756206001f, 0.755201377f, 0.754194975f,
+    0.753186799f, 0.752176850f, 0.751165132f, 0.750151646f,
+    0.749136395f, 0.748119380f, 0.747100606f, 0.746080074f,
+    0.745057785f, 0.744033744f, 0.743007952f, 0.741980412f,
+    0.740951125f, 0.739920095f, 0.738887324f, 0.737852815f,
+    0.736816569f, 0.735778589f, 0.734738878f, 0.733697438f,
+    0.732654272f, 0.731609381f, 0.730562769f, 0.729514438f,
+    0.728464390f, 0.727412629f, 0.726359155f, 0.725303972f,
+    0.724247083f, 0.723188489f, 0.722128194f, 0.721066199f,
+    0.720002508f, 0.718937122f, 0.717870045f, 0.716801279f,
+    0.715730825f, 0.714658688f, 0.713584869f, 0.712509371f,
+    0.711432196f, 0.710353347f, 0.709272826f, 0.708190637f,
+    0.707106781f, 0.706021261f, 0.704934080f, 0.703845241f,
+    0.702754744f, 0.701662595f, 0.700568794f, 0.699473345f,
+    0.698376249f, 0.697277511f, 0.696177131f, 0.695075114f,
+    0.693971461f, 0.692866175f, 0.691759258f, 0.690650714f,
+    0.689540545f, 0.688428753f, 0.687315341f, 0.686200312f,
+    0.685083668f, 0.683965412f, 0.682845546f, 0.681724074f,
+    0.680600998f, 0.679476320f, 0.678350043f, 0.677222170f,
+    0.676092704f, 0.674961646f, 0.673829000f, 0.672694769f,
+    0.671558955f, 0.670421560f, 0.669282588f, 0.668142041f,
+    0.666999922f, 0.665856234f, 0.664710978f, 0.663564159f,
+    0.662415778f, 0.661265838f, 0.660114342f, 0.658961293f,
+    0.657806693f, 0.656650546f, 0.655492853f, 0.654333618f,
+    0.653172843f, 0.652010531f, 0.650846685f, 0.649681307f,
+    0.648514401f, 0.647345969f, 0.646176013f, 0.645004537f,
+    0.643831543f, 0.642657034f, 0.641481013f, 0.640303482f,
+    0.639124445f, 0.637943904f, 0.636761861f, 0.635578320f,
+    0.634393284f, 0.633206755f, 0.632018736f, 0.630829230f,
+    0.629638239f, 0.628445767f, 0.627251815f, 0.626056388f,
+    0.624859488f, 0.623661118f, 0.622461279f, 0.621259977f,
+    0.620057212f, 0.618852988f, 0.617647308f, 0.616440175f,
+    0.615231591f, 0.614021559f, 0.612810082f, 0.611597164f,
+    0.610382806f, 0.609167012f, 0.607949785f, 0.606731127f,
+    0.605511041f, 0.604289531f, 0.603066599f, 0.601842247f,
+    0.600616479f, 0.599389298f, 0.598160707f, 0.596930708f,
+    0.595699304f, 0.594466499f, 0.593232295f, 0.591996695f,
+    0.590759702f, 0.589521319f, 0.588281548f, 0.587040394f,
+    0.585797857f, 0.584553943f, 0.583308653f, 0.582061990f,
+    0.580813958f, 0.579564559f, 0.578313796f, 0.577061673f,
+    0.575808191f, 0.574553355f, 0.573297167f, 0.572039629f,
+    0.570780746f, 0.569520519f, 0.568258953f, 0.566996049f,
+    0.565731811f, 0.564466242f, 0.563199344f, 0.561931121f,
+    0.560661576f, 0.559390712f, 0.558118531f, 0.556845037f,
+    0.555570233f, 0.554294121f, 0.553016706f, 0.551737988f,
+    0.550457973f, 0.549176662f, 0.547894059f, 0.546610167f,
+    0.545324988f, 0.544038527f, 0.542750785f, 0.541461766f,
+    0.540171473f, 0.538879909f, 0.537587076f, 0.536292979f,
+    0.534997620f, 0.533701002f, 0.532403128f, 0.531104001f,
+    0.529803625f, 0.528502002f, 0.527199135f, 0.525895027f,
+    0.524589683f, 0.523283103f, 0.521975293f, 0.520666254f,
+    0.519355990f, 0.518044504f, 0.516731799f, 0.515417878f,
+    0.514102744f, 0.512786401f, 0.511468850f, 0.510150097f,
+    0.508830143f, 0.507508991f, 0.506186645f, 0.504863109f,
+    0.503538384f, 0.502212474f, 0.500885383f, 0.499557113f,
+    0.498227667f, 0.496897049f, 0.495565262f, 0.494232309f,
+    0.492898192f, 0.491562916f, 0.490226483f, 0.488888897f,
+    0.487550160f, 0.486210276f, 0.484869248f, 0.483527079f,
+    0.482183772f, 0.480839331f, 0.479493758f, 0.478147056f,
+    0.476799230f, 0.475450282f, 0.474100215f, 0.472749032f,
+    0.471396737f, 0.470043332f, 0.468688822f, 0.467333209f,
+    0.465976496f, 0.464618686f, 0.463259784f, 0.461899791f,
+    0.460538711f, 0.459176548f, 0.457813304f, 0.456448982f,
+    0.455083587f, 0.453717121f, 0.452349587f, 0.450980989f,
+    0.449611330f, 0.448240612f, 0.446868840f, 0.445496017f,
+    0.444122145f, 0.442747228f, 0.441371269f, 0.439994271f,
+    0.438616239f, 0.437237174f, 0.435857080f, 0.434475961f,
+    0.433093819f, 0.431710658f, 0.430326481f, 0.428941292f,
+    0.427555093f, 0.426167889f, 0.424779681f, 0.423390474f,
+    0.422000271f, 0.420609074f, 0.419216888f, 0.417823716f,
+    0.416429560f, 0.415034424f, 0.413638312f, 0.412241227f,
+    0.410843171f, 0.409444149f, 0.408044163f, 0.406643217f,
+    0.405241314f, 0.403838458f, 0.402434651f, 0.401029897f,
+    0.399624200f, 0.398217562f, 0.396809987f, 0.395401479f,
+    0.393992040f, 0.392581674f, 0.391170384f, 0.389758174f,
+    0.388345047f, 0.386931006f, 0.385516054f, 0.384100195f,
+    0.382683432f, 0.381265769f, 0.379847209f, 0.378427755f,
+    0.377007410f, 0.375586178f, 0.374164063f, 0.372741067f,
+    0.371317194f, 0.369892447f, 0.368466830f, 0.367040346f,
+    0.365612998f, 0.364184790f, 0.362755724f, 0.361325806f,
+    0.359895037f, 0.358463421f, 0.357030961f, 0.355597662f,
+    0.354163525f, 0.352728556f, 0.351292756f, 0.349856130f,
+    0.348418680f, 0.346980411f, 0.345541325f, 0.344101426f,
+    0.342660717f, 0.341219202f, 0.339776884f, 0.338333767f,
+    0.336889853f, 0.335445147f, 0.333999651f, 0.332553370f,
+    0.331106306f, 0.329658463f, 0.328209844f, 0.326760452f,
+    0.325310292f, 0.323859367f, 0.322407679f, 0.320955232f,
+    0.319502031f, 0.318048077f, 0.316593376f, 0.315137929f,
+    0.313681740f, 0.312224814f, 0.310767153f, 0.309308760f,
+    0.307849640f, 0.306389795f, 0.304929230f, 0.303467947f,
+    0.302005949f, 0.300543241f, 0.299079826f, 0.297615707f,
+    0.296150888f, 0.294685372f, 0.293219163f, 0.291752263f,
+    0.290284677f, 0.288816408f, 0.287347460f, 0.285877835f,
+    0.284407537f, 0.282936570f, 0.281464938f, 0.279992643f,
+    0.278519689f, 0.277046080f, 0.275571819f, 0.274096910f,
+    0.272621355f, 0.271145160f, 0.269668326f, 0.268190857f,
+    0.266712757f, 0.265234030f, 0.263754679f, 0.262274707f,
+    0.260794118f, 0.259312915f, 0.257831102f, 0.256348682f,
+    0.254865660f, 0.253382037f, 0.251897818f, 0.250413007f,
+    0.248927606f, 0.247441619f, 0.245955050f, 0.244467903f,
+    0.242980180f, 0.241491885f, 0.240003022f, 0.238513595f,
+    0.237023606f, 0.235533059f, 0.234041959f, 0.232550307f,
+    0.231058108f, 0.229565366f, 0.228072083f, 0.226578264f,
+    0.225083911f, 0.223589029f, 0.222093621f, 0.220597690f,
+    0.219101240f, 0.217604275f, 0.216106797f, 0.214608811f,
+    0.213110320f, 0.211611327f, 0.210111837f, 0.208611852f,
+    0.207111376f, 0.205610413f, 0.204108966f, 0.202607039f,
+    0.201104635f, 0.199601758f, 0.198098411f, 0.196594598f,
+    0.195090322f, 0.193585587f, 0.192080397f, 0.190574755f,
+    0.189068664f, 0.187562129f, 0.186055152f, 0.184547737f,
+    0.183039888f, 0.181531608f, 0.180022901f, 0.178513771f,
+    0.177004220f, 0.175494253f, 0.173983873f, 0.172473084f,
+    0.170961889f, 0.169450291f, 0.167938295f, 0.166425904f,
+    0.164913120f, 0.163399949f, 0.161886394f, 0.160372457f,
+    0.158858143f, 0.157343456f, 0.155828398f, 0.154312973f,
+    0.152797185f, 0.151281038f, 0.149764535f, 0.148247679f,
+    0.146730474f, 0.145212925f, 0.143695033f, 0.142176804f,
+    0.140658239f, 0.139139344f, 0.137620122f, 0.136100575f,
+    0.134580709f, 0.133060525f, 0.131540029f, 0.130019223f,
+    0.128498111f, 0.126976696f, 0.125454983f, 0.123932975f,
+    0.122410675f, 0.120888087f, 0.119365215f, 0.117842062f,
+    0.116318631f, 0.114794927f, 0.113270952f, 0.111746711f,
+    0.110222207f, 0.108697444f, 0.107172425f, 0.105647154f,
+    0.104121634f, 0.102595869f, 0.101069863f, 0.099543619f,
+    0.098017140f, 0.096490431f, 0.094963495f, 0.093436336f,
+    0.091908956f, 0.090381361f, 0.088853553f, 0.087325535f,
+    0.085797312f, 0.084268888f, 0.082740265f, 0.081211447f,
+    0.079682438f, 0.078153242f, 0.076623861f, 0.075094301f,
+    0.073564564f, 0.072034653f, 0.070504573f, 0.068974328f,
+    0.067443920f, 0.065913353f, 0.064382631f, 0.062851758f,
+    0.061320736f, 0.059789571f, 0.058258265f, 0.056726821f,
+    0.055195244f, 0.053663538f, 0.052131705f, 0.050599749f,
+    0.049067674f, 0.047535484f, 0.046003182f, 0.044470772f,
+    0.042938257f, 0.041405641f, 0.039872928f, 0.038340120f,
+    0.036807223f, 0.035274239f, 0.033741172f, 0.032208025f,
+    0.030674803f, 0.029141509f, 0.027608146f, 0.026074718f,
+    0.024541229f, 0.023007681f, 0.021474080f, 0.019940429f,
+    0.018406730f, 0.016872988f, 0.015339206f, 0.013805389f,
+    0.012271538f, 0.010737659f, 0.009203755f, 0.007669829f,
+    0.006135885f, 0.004601926f, 0.003067957f, 0.001533980f,
+    0.000000000f
+};
+
+const q15_t twiddleCoefQuarter_16_q15[5] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_16_q15) = {
+    0x7FFF, 0x7641, 0x5A82, 0x30FB, 0x0000
+};
+
+const q15_t twiddleCoefQuarter_32_q15[9] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_32_q15) = {
+    0x7FFF, 0x7D8A, 0x7641, 0x6A6D, 0x5A82, 0x471C, 0x30FB, 0x18F8,
+    0x0000
+};
+
+const q15_t twiddleCoefQuarter_64_q15[17] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_64_q15) = {
+    0x7FFF, 0x7F62, 0x7D8A, 0x7A7D, 0x7641, 0x70E2, 0x6A6D, 0x62F2,
+    0x5A82, 0x5133, 0x471C, 0x3C56, 0x30FB, 0x2528, 0x18F8, 0x0C8B,
+    0x0000
+};
+
+const q15_t twiddleCoefQuarter_128_q15[33] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_128_q15) = {
+    0x7FFF, 0x7FD8, 0x7F62, 0x7E9D, 0x7D8A, 0x7C29, 0x7A7D, 0x7884,
+    0x7641, 0x73B5, 0x70E2, 0x6DCA, 0x6A6D, 0x66CF, 0x62F2, 0x5ED7,
+    0x5A82, 0x55F5, 0x5133, 0x4C3F, 0x471C, 0x41CE, 0x3C56, 0x36BA,
+    0x30FB, 0x2B1F, 0x2528, 0x1F19, 0x18F8, 0x12C8, 0x0C8B, 0x0647,
+    0x0000
+};
+
+const q15_t twiddleCoefQuarter_256_q15[65] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_256_q15) = {
+    0x7FFF, 0x7FF6, 0x7FD8, 0x7FA7, 0x7F62, 0x7F09, 0x7E9D, 0x7E1D,
+    0x7D8A, 0x7CE3, 0x7C29, 0x7B5D, 0x7A7D, 0x798A, 0x7884, 0x776C,
+    0x7641, 0x7504, 0x73B5, 0x7255, 0x70E2, 0x6F5F, 0x6DCA, 0x6C24,
+    0x6A6D, 0x68A6, 0x66CF, 0x64E8, 0x62F2, 0x60EC, 0x5ED7, 0x5CB4,
+    0x5A82, 0x5842, 0x55F5, 0x539B, 0x5133, 0x4EBF, 0x4C3F, 0x49B4,
+    0x471C, 0x447A, 0x41CE, 0x3F17, 0x3C56, 0x398C, 0x36BA, 0x33DE,
+    0x30FB, 0x2E11, 0x2B1F, 0x2826, 0x2528, 0x2223, 0x1F19, 0x1C0B,
+    0x18F8, 0x15E2, 0x12C8, 0x0FAB, 0x0C8B, 0x096A, 0x0647, 0x0324,
+    0x0000
+};
+
+const q15_t twiddleCoefQuarter_512_q15[129] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_512_q15) = {
+    0x7FFF, 0x7FFD, 0x7FF6, 0x7FE9, 0x7FD8, 0x7FC2, 0x7FA7, 0x7F87,
+    0x7F62, 0x7F38, 0x7F09, 0x7ED5, 0x7E9D, 0x7E5F, 0x7E1D, 0x7DD6,
+    0x7D8A, 0x7D39, 0x7CE3, 0x7C89, 0x7C29, 0x7BC5, 0x7B5D, 0x7AEF,
+    0x7A7D, 0x7A05, 0x798A, 0x7909, 0x7884, 0x77FA, 0x776C, 0x76D9,
+    0x7641, 0x75A5, 0x7504, 0x745F, 0x73B5, 0x7307, 0x7255, 0x719E,
+    0x70E2, 0x7023, 0x6F5F, 0x6E96, 0x6DCA, 0x6CF9, 0x6C24, 0x6B4A,
+    0x6A6D, 0x698C, 0x68A6, 0x67BD, 0x66CF, 0x65DD, 0x64E8, 0x63EF,
+    0x62F2, 0x61F1, 0x60EC, 0x5FE3, 0x5ED7, 0x5DC7, 0x5CB4, 0x5B9D,
+    0x5A82, 0x5964, 0x5842, 0x571D, 0x55F5, 0x54CA, 0x539B, 0x5269,
+    0x5133, 0x4FFB, 0x4EBF, 0x4D81, 0x4C3F, 0x4AFB, 0x49B4, 0x4869,
+    0x471C, 0x45CD, 0x447A, 0x4325, 0x41CE, 0x4073, 0x3F17, 0x3DB8,
+    0x3C56, 0x3AF2, 0x398C, 0x3824, 0x36BA, 0x354D, 0x33DE, 0x326E,
+    0x30FB, 0x2F87, 0x2E11, 0x2C98, 0x2B1F, 0x29A3, 0x2826, 0x26A8,
+    0x2528, 0x23A6, 0x2223, 0x209F, 0x1F19, 0x1D93, 0x1C0B, 0x1A82,
+    0x18F8, 0x176D, 0x15E2, 0x1455, 0x12C8, 0x1139, 0x0FAB, 0x0E1B,
+    0x0C8B, 0x0AFB, 0x096A, 0x07D9, 0x0647, 0x04B6, 0x0324, 0x0192,
+    0x0000
+};
+
+const q15_t twiddleCoefQuarter_1024_q15[257] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_1024_q15) = {
+    0x7FFF, 0x7FFF, 0x7FFD, 0x7FFA, 0x7FF6, 0x7FF0, 0x7FE9, 0x7FE1,
+    0x7FD8, 0x7FCE, 0x7FC2, 0x7FB5, 0x7FA7, 0x7F97, 0x7F87, 0x7F75,
+    0x7F62, 0x7F4D, 0x7F38, 0x7F21, 0x7F09, 0x7EF0, 0x7ED5, 0x7EBA,
+    0x7E9D, 0x7E7F, 0x7E5F, 0x7E3F, 0x7E1D, 0x7DFA, 0x7DD6, 0x7DB0,
+    0x7D8A, 0x7D62, 0x7D39, 0x7D0F, 0x7CE3, 0x7CB7, 0x7C89, 0x7C5A,
+    0x7C29, 0x7BF8, 0x7BC5, 0x7B92, 0x7B5D, 0x7B26, 0x7AEF, 0x7AB6,
+    0x7A7D, 0x7A42, 0x7A05, 0x79C8, 0x798A, 0x794A, 0x7909, 0x78C7,
+    0x7884, 0x7840, 0x77FA, 0x77B4, 0x776C, 0x7723, 0x76D9, 0x768E,
+    0x7641, 0x75F4, 0x75A5, 0x7555, 0x7504, 0x74B2, 0x745F, 0x740B,
+    0x73B5, 0x735F, 0x7307, 0x72AF, 0x7255, 0x71FA, 0x719E, 0x7141,
+    0x70E2, 0x7083, 0x7023, 0x6FC1, 0x6F5F, 0x6EFB, 0x6E96, 0x6E30,
+    0x6DCA, 0x6D62, 0x6CF9, 0x6C8F, 0x6C24, 0x6BB8, 0x6B4A, 0x6ADC,
+    0x6A6D, 0x69FD, 0x698C, 0x6919, 0x68A6, 0x6832, 0x67BD, 0x6746,
+    0x66CF, 0x6657, 0x65DD, 0x6563, 0x64E8, 0x646C, 0x63EF, 0x6371,
+    0x62F2, 0x6271, 0x61F1, 0x616F, 0x60EC, 0x6068, 0x5FE3, 0x5F5E,
+    0x5ED7, 0x5E50, 0x5DC7, 0x5D3E, 0x5CB4, 0x5C29, 0x5B9D, 0x5B10,
+    0x5A82, 0x59F3, 0x5964, 0x58D4, 0x5842, 0x57B0, 0x571D, 0x568A,
+    0x55F5, 0x5560, 0x54CA, 0x5433, 0x539B, 0x5302, 0x5269, 0x51CE,
+    0x5133, 0x5097, 0x4FFB, 0x4F5E, 0x4EBF, 0x4E21, 0x4D81, 0x4CE1,
+    0x4C3F, 0x4B9E, 0x4AFB, 0x4A58, 0x49B4, 0x490F, 0x4869, 0x47C3,
+    0x471C, 0x4675, 0x45CD, 0x4524, 0x447A, 0x43D0, 0x4325, 0x427A,
+    0x41CE, 0x4121, 0x4073, 0x3FC5, 0x3F17, 0x3E68, 0x3DB8, 0x3D07,
+    0x3C56, 0x3BA5, 0x3AF2, 0x3A40, 0x398C, 0x38D8, 0x3824, 0x376F,
+    0x36BA, 0x3604, 0x354D, 0x3496, 0x33DE, 0x3326, 0x326E, 0x31B5,
+    0x30FB, 0x3041, 0x2F87, 0x2ECC, 0x2E11, 0x2D55, 0x2C98, 0x2BDC,
+    0x2B1F, 0x2A61, 0x29A3, 0x28E5, 0x2826, 0x2767, 0x26A8, 0x25E8,
+    0x2528, 0x2467, 0x23A6, 0x22E5, 0x2223, 0x2161, 0x209F, 0x1FDC,
+    0x1F19, 0x1E56, 0x1D93, 0x1CCF, 0x1C0B, 0x1B47, 0x1A82, 0x19BD,
+    0x18F8, 0x1833, 0x176D, 0x16A8, 0x15E2, 0x151B, 0x1455, 0x138E,
+    0x12C8, 0x1201, 0x1139, 0x1072, 0x0FAB, 0x0EE3, 0x0E1B, 0x0D53,
+    0x0C8B, 0x0BC3, 0x0AFB, 0x0A33, 0x096A, 0x08A2, 0x07D9, 0x0710,
+    0x0647, 0x057F, 0x04B6, 0x03ED, 0x0324, 0x025B, 0x0192, 0x00C9,
+    0x0000
+};
+
+const q15_t twiddleCoefQuarter_2048_q15[513] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_2048_q15) = {
+    0x7FFF, 0x7FFF, 0x7FFF, 0x7FFE, 0x7FFD, 0x7FFC, 0x7FFA, 0x7FF8,
+    0x7FF6, 0x7FF3, 0x7FF0, 0x7FED, 0x7FE9, 0x7FE5, 0x7FE1, 0x7FDD,
+    0x7FD8, 0x7FD3, 0x7FCE, 0x7FC8, 0x7FC2, 0x7FBC, 0x7FB5, 0x7FAE,
+    0x7FA7, 0x7F9F, 0x7F97, 0x7F8F, 0x7F87, 0x7F7E, 0x7F75, 0x7F6B,
+    0x7F62, 0x7F58, 0x7F4D, 0x7F43, 0x7F38, 0x7F2D, 0x7F21, 0x7F15,
+    0x7F09, 0x7EFD, 0x7EF0, 0x7EE3, 0x7ED5, 0x7EC8, 0x7EBA, 0x7EAB,
+    0x7E9D, 0x7E8E, 0x7E7F, 0x7E6F, 0x7E5F, 0x7E4F, 0x7E3F, 0x7E2E,
+    0x7E1D, 0x7E0C, 0x7DFA, 0x7DE8, 0x7DD6, 0x7DC3, 0x7DB0, 0x7D9D,
+    0x7D8A, 0x7D76, 0x7D62, 0x7D4E, 0x7D39, 0x7D24, 0x7D0F, 0x7CF9,
+    0x7CE3, 0x7CCD, 0x7CB7, 0x7CA0, 0x7C89, 0x7C71, 0x7C5A, 0x7C42,
+    0x7C29, 0x7C11, 0x7BF8, 0x7BDF, 0x7BC5, 0x7BAC, 0x7B92, 0x7B77,
+    0x7B5D, 0x7B42, 0x7B26, 0x7B0B, 0x7AEF, 0x7AD3, 0x7AB6, 0x7A9A,
+    0x7A7D, 0x7A5F, 0x7A42, 0x7A24, 0x7A05, 0x79E7, 0x79C8, 0x79A9,
+    0x798A, 0x796A, 0x794A, 0x792A, 0x7909, 0x78E8, 0x78C7, 0x78A6,
+    0x7884, 0x7862, 0x7840, 0x781D, 0x77FA, 0x77D7, 0x77B4, 0x7790,
+    0x776C, 0x7747, 0x7723, 0x76FE, 0x76D9, 0x76B3, 0x768E, 0x7668,
+    0x7641, 0x761B, 0x75F4, 0x75CC, 0x75A5, 0x757D, 0x7555, 0x752D,
+    0x7504, 0x74DB, 0x74B2, 0x7489, 0x745F, 0x7435, 0x740B, 0x73E0,
+    0x73B5, 0x738A, 0x735F, 0x7333, 0x7307, 0x72DB, 0x72AF, 0x7282,
+    0x7255, 0x7227, 0x71FA, 0x71CC, 0x719E, 0x716F, 0x7141, 0x7112,
+    0x70E2, 0x70B3, 0x7083, 0x7053, 0x7023, 0x6FF2, 0x6FC1, 0x6F90,
+    0x6F5F, 0x6F2D, 0x6EFB, 0x6EC9, 0x6E96, 0x6E63, 0x6E30, 0x6DFD,
+    0x6DCA, 0x6D96, 0x6D62, 0x6D2D, 0x6CF9, 0x6CC4, 0x6C8F, 0x6C59,
+    0x6C24, 0x6BEE, 0x6BB8, 0x6B81, 0x6B4A, 0x6B13, 0x6ADC, 0x6AA5,
+    0x6A6D, 0x6A35, 0x69FD, 0x69C4, 0x698C, 0x6953, 0x6919, 0x68E0,
+    0x68A6, 0x686C, 0x6832, 0x67F7, 0x67BD, 0x6782, 0x6746, 0x670B,
+    0x66CF, 0x6693, 0x6657, 0x661A, 0x65DD, 0x65A0, 0x6563, 0x6526,
+    0x64E8, 0x64AA, 0x646C, 0x642D, 0x63EF, 0x63B0, 0x6371, 0x6331,
+    0x62F2, 0x62B2, 0x6271, 0x6231, 0x61F1, 0x61B0, 0x616F, 0x612D,
+    0x60EC, 0x60AA, 0x6068, 0x6026, 0x5FE3, 0x5FA0, 0x5F5E, 0x5F1A,
+    0x5ED7, 0x5E93, 0x5E50, 0x5E0B, 0x5DC7, 0x5D83, 0x5D3E, 0x5CF9,
+    0x5CB4, 0x5C6E, 0x5C29, 0x5BE3, 0x5B9D, 0x5B56, 0x5B10, 0x5AC9,
+    0x5A82, 0x5A3B, 0x59F3, 0x59AC, 0x5964, 0x591C, 0x58D4, 0x588B,
+    0x5842, 0x57F9, 0x57B0, 0x5767, 0x571D, 0x56D4, 0x568A, 0x5640,
+    0x55F5, 0x55AB, 0x5560, 0x5515, 0x54CA, 0x547E, 0x5433, 0x53E7,
+    0x539B, 0x534E, 0x5302, 0x52B5, 0x5269, 0x521C, 0x51CE, 0x5181,
+    0x5133, 0x50E5, 0x5097, 0x5049, 0x4FFB, 0x4FAC, 0x4F5E, 0x4F0F,
+    0x4EBF, 0x4E70, 0x4E21, 0x4DD1, 0x4D81, 0x4D31, 0x4CE1, 0x4C90,
+    0x4C3F, 0x4BEF, 0x4B9E, 0x4B4C, 0x4AFB, 0x4AA9, 0x4A58, 0x4A06,
+    0x49B4, 0x4961, 0x490F, 0x48BC, 0x4869, 0x4816, 0x47C3, 0x4770,
+    0x471C, 0x46C9, 0x4675, 0x4621, 0x45CD, 0x4578, 0x4524, 0x44CF,
+    0x447A, 0x4425, 0x43D0, 0x437B, 0x4325, 0x42D0, 0x427A, 0x4224,
+    0x41CE, 0x4177, 0x4121, 0x40CA, 0x4073, 0x401D, 0x3FC5, 0x3F6E,
+    0x3F17, 0x3EBF, 0x3E68, 0x3E10, 0x3DB8, 0x3D60, 0x3D07, 0x3CAF,
+    0x3C56, 0x3BFD, 0x3BA5, 0x3B4C, 0x3AF2, 0x3A99, 0x3A40, 0x39E6,
+    0x398C, 0x3932, 0x38D8, 0x387E, 0x3824, 0x37CA, 0x376F, 0x3714,
+    0x36BA, 0x365F, 0x3604, 0x35A8, 0x354D, 0x34F2, 0x3496, 0x343A,
+    0x33DE, 0x3382, 0x3326, 0x32CA, 0x326E, 0x3211, 0x31B5, 0x3158,
+    0x30FB, 0x309E, 0x3041, 0x2FE4, 0x2F87, 0x2F29, 0x2ECC, 0x2E6E,
+    0x2E11, 0x2DB3, 0x2D55, 0x2CF7, 0x2C98, 0x2C3A, 0x2BDC, 0x2B7D,
+    0x2B1F, 0x2AC0, 0x2A61, 0x2A02, 0x29A3, 0x2944, 0x28E5, 0x2886,
+    0x2826, 0x27C7, 0x2767, 0x2707, 0x26A8, 0x2648, 0x25E8, 0x2588,
+    0x2528, 0x24C7, 0x2467, 0x2407, 0x23A6, 0x2345, 0x22E5, 0x2284,
+    0x2223, 0x21C2, 0x2161, 0x2100, 0x209F, 0x203E, 0x1FDC, 0x1F7B,
+    0x1F19, 0x1EB8, 0x1E56, 0x1DF5, 0x1D93, 0x1D31, 0x1CCF, 0x1C6D,
+    0x1C0B, 0x1BA9, 0x1B47, 0x1AE4, 0x1A82, 0x1A20, 0x19BD, 0x195B,
+    0x18F8, 0x1896, 0x1833, 0x17D0, 0x176D, 0x170A, 0x16A8, 0x1645,
+    0x15E2, 0x157F, 0x151B, 0x14B8, 0x1455, 0x13F2, 0x138E, 0x132B,
+    0x12C8, 0x1264, 0x1201, 0x119D, 0x1139, 0x10D6, 0x1072, 0x100E,
+    0x0FAB, 0x0F47, 0x0EE3, 0x0E7F, 0x0E1B, 0x0DB7, 0x0D53, 0x0CEF,
+    0x0C8B, 0x0C27, 0x0BC3, 0x0B5F, 0x0AFB, 0x0A97, 0x0A33, 0x09CE,
+    0x096A, 0x0906, 0x08A2, 0x083D, 0x07D9, 0x0775, 0x0710, 0x06AC,
+    0x0647, 0x05E3, 0x057F, 0x051A, 0x04B6, 0x0451, 0x03ED, 0x0388,
+    0x0324, 0x02BF, 0x025B, 0x01F6, 0x0192, 0x012D, 0x00C9, 0x0064,
+    0x0000
+};
+
+const q15_t twiddleCoefQuarter_4096_q15[1025] RISCV_DSP_FASTDATA(TWIDDLE, twiddleCoefQuarter_4096_q15) = {
+    0x7FFF, 0x7FFF, 0x7FFF, 0x7FFF, 0x7FFF, 0x7FFF, 0x7FFE, 0x7FFE,
+    0x7FFD, 0x7FFC, 0x7FFC, 0x7FFB, 0x7FFA, 0x7FF9, 0x7FF8, 0x7FF7,
+    0x7FF6, 0x7FF4, 0x7FF3, 0x7FF2, 0x7FF0, 0x7FEE, 0x7FED, 0x7FEB,
+    0x7FE9, 0x7FE7, 0x7FE5, 0x7FE3, 0x7FE1, 0x7FDF, 0x7FDD, 0x7FDA,
+    0x7FD8, 0x7FD6, 0x7FD3, 0x7FD0, 0x7FCE, 0x7FCB, 0x7FC8, 0x7FC5,
+    0x7FC2, 0x7FBF, 0x7FBC, 0x7FB8, 0x7FB5, 0x7FB1, 0x7FAE, 0x7FAA,
+    0x7FA7, 0x7FA3, 0x7F9F, 0x7F9B, 0x7F97, 0x7F93, 0x7F8F, 0x7F8B,
+    0x7F87, 0x7F82, 0x7F7E, 0x7F79, 0x7F75, 0x7F70, 0x7F6B, 0x7F67,
+    0x7F62, 0x7F5D, 0x7F58, 0x7F53, 0x7F4D, 0x7F48, 0x7F43, 0x7F3D,
+    0x7F38, 0x7F32, 0x7F2D, 0x7F27, 0x7F21, 0x7F1B, 0x7F15, 0x7F0F,
+    0x7F09, 0x7F03, 0x7EFD, 0x7EF6, 0x7EF0, 0x7EE9, 0x7EE3, 0x7EDC,
+    0x7ED5, 0x7ECF, 0x7EC8, 0x7EC1, 0x7EBA, 0x7EB3, 0x7EAB, 0x7EA4,
+    0x7E9D, 0x7E95, 0x7E8E, 0x7E86, 0x7E7F, 0x7E77, 0x7E6F, 0x7E67,
+    0x7E5F, 0x7E57, 0x7E4F, 0x7E47, 0x7E3F, 0x7E37, 0x7E2E, 0x7E26,
+    0x7E1D, 0x7E14, 0x7E0C, 0x7E03, 0x7DFA, 0x7DF1, 0x7DE8, 0x7DDF,
+    0x7DD6, 0x7DCD, 0x7DC3, 0x7DBA, 0x7DB0, 0x7DA7, 0x7D9D, 0x7D94,
+    0x7D8A, 0x7D80, 0x7D76, 0x7D6C, 0x7D62, 0x7D58, 0x7D4E, 0x7D43,
+    0x7D39, 0x7D2F, 0x7D24, 0x7D19, 0x7D0F, 0x7D04, 0x7CF9, 0x7CEE,
+    0x7CE3, 0x7CD8, 0x7CCD, 0x7CC2, 0x7CB7, 0x7CAB, 0x7CA0, 0x7C94,
+    0x7C89, 0x7C7D, 0x7C71, 0x7C66, 0x7C5A, 0x7C4E, 0x7C42, 0x7C36,
+    0x7C29, 0x7C1D, 0x7C11, 0x7C05, 0x7BF8, 0x7BEB, 0x7BDF, 0x7BD2,
+    0x7BC5, 0x7BB9, 0x7BAC, 0x7B9F, 0x7B92, 0x7B84, 0x7B77, 0x7B6A,
+    0x7B5D, 0x7B4F, 0x7B42, 0x7B34, 0x7B26, 0x7B19, 0x7B0B, 0x7AFD,
+    0x7AEF, 0x7AE1, 0x7AD3, 0x7AC5, 0x7AB6, 0x7AA8, 0x7A9A, 0x7A8B,
+    0x7A7D, 0x7A6E, 0x7A5F, 0x7A50, 0x7A42, 0x7A33, 0x7A24, 0x7A15,
+    0x7A05, 0x79F6, 0x79E7, 0x79D8, 0x79C8, 0x79B9, 0x79A9, 0x7999,
+    0x798A, 0x797A, 0x796A, 0x795A, 0x794A, 0x793A, 0x792A, 0x7919,
+    0x7909, 0x78F9, 0x78E8, 0x78D8, 0x78C7, 0x78B6, 0x78A6, 0x7895,
+    0x7884, 0x7873, 0x7862, 0x7851, 0x7840, 0x782E, 0x781D, 0x780C,
+    0x77FA, 0x77E9, 0x77D7, 0x77C5, 0x77B4, 0x77A2, 0x7790, 0x777E,
+    0x776C, 0x775A, 0x7747, 0x7735, 0x7723, 0x7710, 0x76FE, 0x76EB,
+    0x76D9, 0x76C6, 0x76B3, 0x76A0, 0x768E, 0x767B, 0x7668, 0x7654,
+    0x7641, 0x762E, 0x761B, 0x7607, 0x75F4, 0x75E0, 0x75CC, 0x75B9,
+    0x75A5, 0x7591, 0x757D, 0x7569, 0x7555, 0x7541, 0x752D, 0x7519,
+    0x7504, 0x74F0, 0x74DB, 0x74C7, 0x74B2, 0x749E, 0x7489, 0x7474,
+    0x745F, 0x744A, 0x7435, 0x7420, 0x740B, 0x73F6, 0x73E0, 0x73CB,
+    0x73B5, 0x73A0, 0x738A, 0x7375, 0x735F, 0x7349, 0x7333, 0x731D,
+    0x7307, 0x72F1, 0x72DB, 0x72C5, 0x72AF, 0x7298, 0x7282, 0x726B,
+    0x7255, 0x723E, 0x7227, 0x7211, 0x71FA, 0x71E3, 0x71CC, 0x71B5,
+    0x719E, 0x7186, 0x716F, 0x7158, 0x7141, 0x7129, 0x7112, 0x70FA,
+    0x70E2, 0x70CB, 0x70B3, 0x709B, 0x7083, 0x706B, 0x7053, 0x703B,
+    0x7023, 0x700A, 0x6FF2, 0x6FDA, 0x6FC1, 0x6FA9, 0x6F90, 0x6F77,
+    0x6F5F, 0x6F46, 0x6F2D, 0x6F14, 0x6EFB, 0x6EE2, 0x6EC9, 0x6EAF,
+    0x6E96, 0x6E7D, 0x6E63, 0x6E4A, 0x6E30, 0x6E17, 0x6DFD, 0x6DE3,
+    0x6DCA, 0x6DB0, 0x6D96, 0x6D7C, 0x6D62, 0x6D48, 0x6D2D, 0x6D13,
+    0x6CF9, 0x6CDE, 0x6CC4, 0x6CA9, 0x6C8F, 0x6C74, 0x6C59, 0x6C3F,
+    0x6C24, 0x6C09, 0x6BEE, 0x6BD3, 0x6BB8, 0x6B9C, 0x6B81, 0x6B66,
+    0x6B4A, 0x6B2F, 0x6B13, 0x6AF8, 0x6ADC, 0x6AC1, 0x6AA5, 0x6A89,
+    0x6A6D, 0x6A51, 0x6A35, 0x6A19, 0x69FD, 0x69E1, 0x69C4, 0x69A8,
+    0x698C, 0x696F, 0x6953, 0x6936, 0x6919, 0x68FD, 0x68E0, 0x68C3,
+    0x68A6, 0x6889, 0x686C, 0x684F, 0x6832, 0x6815, 0x67F7, 0x67DA,
+    0x67BD, 0x679F, 0x6782, 0x6764, 0x6746, 0x6729, 0x670B, 0x66ED,
+    0x66CF, 0x66B1, 0x6693, 0x6675, 0x6657, 0x6639, 0x661A, 0x65FC,
+    0x65DD, 0x65BF, 0x65A0, 0x6582, 0x6563, 0x6545, 0x6526, 0x6507,
+    0x64E8, 0x64C9, 0x64AA, 0x648B, 0x646C, 0x644D, 0x642D, 0x640E,
+    0x63EF, 0x63CF, 0x63B0, 0x6390, 0x6371, 0x6351, 0x6331, 0x6311,
+    0x62F2, 0x62D2, 0x62B2, 0x6292, 0x6271, 0x6251, 0x6231, 0x6211,
+    0x61F1, 0x61D0, 0x61B0, 0x618F, 0x616F, 0x614E, 0x612D, 0x610D,
+    0x60EC, 0x60CB, 0x60AA, 0x6089, 0x6068, 0x6047, 0x6026, 0x6004,
+    0x5FE3, 0x5FC2, 0x5FA0, 0x5F7F, 0x5F5E, 0x5F3C, 0x5F1A, 0x5EF9,
+    0x5ED7, 0x5EB5, 0x5E93, 0x5E71, 0x5E50, 0x5E2D, 0x5E0B, 0x5DE9,
+    0x5DC7, 0x5DA5, 0x5D83, 0x5D60, 0x5D3E, 0x5D1B, 0x5CF9, 0x5CD6,
+    0x5CB4, 0x5C91, 0x5C6E, 0x5C4B, 0x5C29, 0x5C06, 0x5BE3, 0x5BC0,
+    0x5B9D, 0x5B79, 0x5B56, 0x5B33, 0x5B10, 0x5AEC, 0x5AC9, 0x5AA5,
+    0x5A82, 0x5A5E, 0x5A3B, 0x5A17, 0x59F3, 0x59D0, 0x59AC, 0x5988,
+    0x5964, 0x5940, 0x591C, 0x58F8, 0x58D4, 0x58AF, 0x588B, 0x5867,
+    0x5842, 0x581E, 0x57F9, 0x57D5, 0x57B0, 0x578C, 0x5767, 0x5742,
+    0x571D, 0x56F9, 0x56D4, 0x56AF, 0x568A, 0x5665, 0x5640, 0x561A,
+    0x55F5, 0x55D0, 0x55AB, 0x5585, 0x5560, 0x553A, 0x5515, 0x54EF,
+    0x54CA, 0x54A4, 0x547E, 0x5458, 0x5433, 0x540D, 0x53E7, 0x53C1,
+    0x539B, 0x5375, 0x534E, 0x5328, 0x5302, 0x52DC, 0x52B5, 0x528F,
+    0x5269, 0x5242, 0x521C, 0x51F5, 0x51CE, 0x51A8, 0x5181, 0x515A,
+    0x5133, 0x510C, 0x50E5, 0x50BF, 0x5097, 0x5070, 0x5049, 0x5022,
+    0x4FFB, 0x4FD4, 0x4FAC, 0x4F85, 0x4F5E, 0x4F36, 0x4F0F, 0x4EE7,
+    0x4EBF, 0x4E98, 0x4E70, 0x4E48, 0x4E21, 0x4DF9, 0x4DD1, 0x4DA9,
+    0x4D81, 0x4D59, 0x4D31, 0x4D09, 0x4CE1, 0x4CB8, 0x4C90, 0x4C68,
+    0x4C3F, 0x4C17, 0x4BEF, 0x4BC6, 0x4B9E, 0x4B75, 0x4B4C, 0x4B24,
+    0x4AFB, 0x4AD2, 0x4AA9, 0x4A81, 0x4A58, 0x4A2F, 0x4A06, 0x49DD,
+    0x49B4, 0x498A, 0x4961, 0x4938, 0x490F, 0x48E6, 0x48BC, 0x4893,
+    0x4869, 0x4840, 0x4816, 0x47ED, 0x47C3, 0x479A, 0x4770, 0x4746,
+    0x471C, 0x46F3, 0x46C9, 0x469F, 0x4675, 0x464B, 0x4621, 0x45F7,
+    0x45CD, 0x45A3, 0x4578, 0x454E, 0x4524, 0x44FA, 0x44CF, 0x44A5,
+    0x447A, 0x4450, 0x4425, 0x43FB, 0x43D0, 0x43A5, 0x437B, 0x4350,
+    0x4325, 0x42FA, 0x42D0, 0x42A5, 0x427A, 0x424F, 0x4224, 0x41F9,
+    0x41CE, 0x41A2, 0x4177, 0x414C, 0x4121, 0x40F6, 0x40CA, 0x409F,
+    0x4073, 0x4048, 0x401D, 0x3FF1, 0x3FC5, 0x3F9A, 0x3F6E, 0x3F43,
+    0x3F17, 0x3EEB, 0x3EBF, 0x3E93, 0x3E68, 0x3E3C, 0x3E10, 0x3DE4,
+    0x3DB8, 0x3D8C, 0x3D60, 0x3D33, 0x3D07, 0x3CDB, 0x3CAF, 0x3C83,
+    0x3C56, 0x3C2A, 0x3BFD, 0x3BD1, 0x3BA5, 0x3B78, 0x3B4C, 0x3B1F,
+    0x3AF2, 0x3AC6, 0x3A99, 0x3A6C, 0x3A40, 0x3A13, 0x39E6, 0x39B9,
+    0x398C, 0x395F, 0x3932, 0x3906, 0x38D8, 0x38AB, 0x387E, 0x3851,
+    0x3824, 0x37F7, 0x37CA, 0x379C, 0x376F, 0x3742, 0x3714, 0x36E7,
+    0x36BA, 0x368C, 0x365F, 0x3631, 0x3604, 0x35D6, 0x35A8, 0x357B,
+    0x354D, 0x351F, 0x34F2, 0x34C4, 0x3496, 0x3468, 0x343A, 0x340C,
+    0x33DE, 0x33B0, 0x3382, 0x3354, 0x3326, 0x32F8, 0x32CA, 0x329C,
+    0x326E, 0x3240, 0x3211, 0x31E3, 0x31B5, 0x3186, 0x3158, 0x312A,
+    0x30FB, 0x30CD, 0x309E, 0x3070, 0x3041, 0x3013, 0x2FE4, 0x2FB5,
+    0x2F87, 0x2F58, 0x2F29, 0x2EFB, 0x2ECC, 0x2E9D, 0x2E6E, 0x2E3F,
+    0x2E11, 0x2DE2, 0x2DB3, 0x2D84, 0x2D55, 0x2D26, 0x2CF7, 0x2CC8,
+    0x2C98, 0x2C69, 0x2C3A, 0x2C0B, 0x2BDC, 0x2BAD, 0x2B7D, 0x2B4E,
+    0x2B1F, 0x2AEF, 0x2AC0, 0x2A91, 0x2A61, 0x2A32, 0x2A02, 0x29D3,
+    0x29A3, 0x2974, 0x2944, 0x2915, 0x28E5, 0x28B5, 0x2886, 0x2856,
+    0x2826, 0x27F6, 0x27C7, 0x2797, 0x2767, 0x2737, 0x2707, 0x26D8,
+    0x26A8, 0x2678, 0x2648, 0x2618, 0x25E8, 0x25B8, 0x2588, 0x2558,
+    0x2528, 0x24F7, 0x24C7, 0x2497, 0x2467, 0x2437, 0x2407, 0x23D6,
+    0x23A6, 0x2376, 0x2345, 0x2315, 0x22E5, 0x22B4, 0x2284, 0x2254,
+    0x2223, 0x21F3, 0x21C2, 0x2192, 0x2161, 0x2131, 0x2100, 0x20D0,
+    0x209F, 0x206E, 0x203E, 0x200D, 0x1FDC, 0x1FAC, 0x1F7B, 0x1F4A,
+    0x1F19, 0x1EE9, 0x1EB8, 0x1E87, 0x1E56, 0x1E25, 0x1DF5, 0x1DC4,
+    0x1D93, 0x1D62, 0x1D31, 0x1D00, 0x1CCF, 0x1C9E, 0x1C6D, 0x1C3C,
+    0x1C0B, 0x1BDA, 0x1BA9, 0x1B78, 0x1B47, 0x1B16, 0x1AE4, 0x1AB3,
+    0x1A82, 0x1A51, 0x1A20, 0x19EF, 0x19BD, 0x198C, 0x195B, 0x192A,
+    0x18F8, 0x18C7, 0x1896, 0x1864, 0x1833, 0x1802, 0x17D0, 0x179F,
+    0x176D, 0x173C, 0x170A, 0x16D9, 0x16A8, 0x1676, 0x1645, 0x1613,
+    0x15E2, 0x15B0, 0x157F, 0x154D, 0x151B, 0x14EA, 0x14B8, 0x1487,
+    0x1455, 0x1423, 0x13F2, 0x13C0, 0x138E, 0x135D, 0x132B, 0x12F9,
+    0x12C8, 0x1296, 0x1264, 0x1232, 0x1201, 0x11CF, 0x119D, 0x116B,
+    0x1139, 0x1108, 0x10D6, 0x10A4, 0x1072, 0x1040, 0x100E, 0x0FDD,
+    0x0FAB, 0x0F79, 0x0F47, 0x0F15, 0x0EE3, 0x0EB1, 0x0E7F, 0x0E4D,
+    0x0E1B, 0x0DE9, 0x0DB7, 0x0D85, 0x0D53, 0x0D21, 0x0CEF, 0x0CBD,
+    0x0C8B, 0x0C59, 0x0C27, 0x0BF5, 0x0BC3, 0x0B91, 0x0B5F, 0x0B2D,
+    0x0AFB, 0x0AC9, 0x0A97, 0x0A65, 0x0A33, 0x0A00, 0x09CE, 0x099C,
+    0x096A, 0x0938, 0x0906, 0x08D4, 0x08A2, 0x086F, 0x083D, 0x080B,
+    0x07D9, 0x07A7, 0x0775, 0x0742, 0x0710, 0x06DE, 0x06AC, 0x067A,
+    0x0647, 0x0615, 0x05E3, 0x05B1, 0x057F, 0x054C, 0x051A, 0x04E8,
+    0x04B6, 0x0483, 0x0451, 0x041F, 0x03ED, 0x03BA, 0x0388, 0x0356,
+    0x0324, 0x02F1, 0x02BF, 0x028D, 0x025B, 0x0228, 0x01F6, 0x01C4,
+    0x0192, 0x015F, 0x012D, 0x00FB, 0x00C9, 0x0096, 0x0064, 0x0032,
+    0x0000
+};
+#endif /* !defined (RISCV_DSP_FFT_TABLES_GENERATED) */
+
 
 /**   
  * \par    
@@ -26987,7 +32073,7 @@ const float32_t twiddleCoef_rfft_4096[4096] = {
  * where pi value is  3.14159265358979    
  */
 
-const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1] = {
+const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1] RISCV_DSP_FASTDATA(SINE, sinTable_f32) = {
    0.00000000f, 0.01227154f, 0.02454123f, 0.03680722f, 0.04906767f, 0.06132074f,
    0.07356456f, 0.08579731f, 0.09801714f, 0.11022221f, 0.12241068f, 0.13458071f,
    0.14673047f, 0.15885814f, 0.17096189f, 0.18303989f, 0.19509032f, 0.20711138f,
@@ -27102,7 +32188,7 @@ const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1] = {
  * Finally, round to the nearest integer value:
  * 	sinTable[i] += (sinTable[i] > 0 ? 0.5 :-0.5);    
  */
-const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1] = {
+const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1] RISCV_DSP_FASTDATA(SINE, sinTable_q31) = {
    0x00000000, 0x01921D20, 0x03242ABF, 0x04B6195D, 0x0647D97C, 0x07D95B9E, 
    0x096A9049, 0x0AFB6805, 0x0C8BD35E, 0x0E1BC2E4, 0x0FAB272B, 0x1139F0CF, 
    0x12C8106F, 0x145576B1, 0x15E21445, 0x176DD9DE, 0x18F8B83C, 0x1A82A026, 
@@ -27209,7 +32295,7 @@ const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1] = {
  * Finally, round to the nearest integer value:
  * 	sinTable[i] += (sinTable[i] > 0 ? 0.5 :-0.5);    
  */
-const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1] = {
+const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1] RISCV_DSP_FASTDATA(SINE, sinTable_q15) = {
    0x0000, 0x0192, 0x0324, 0x04B6, 0x0648, 0x07D9, 0x096B, 0x0AFB, 0x0C8C, 0x0E1C, 0x0FAB, 0x113A, 0x12C8,
    0x1455, 0x15E2, 0x176E, 0x18F9, 0x1A83, 0x1C0C, 0x1D93, 0x1F1A, 0x209F, 0x2224, 0x23A7, 0x2528, 0x26A8,
    0x2827, 0x29A4, 0x2B1F, 0x2C99, 0x2E11, 0x2F87, 0x30FC, 0x326E, 0x33DF, 0x354E, 0x36BA, 0x3825, 0x398D,
@@ -27251,3 +32337,128 @@ const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1] = {
    0xE3F4, 0xE57D, 0xE707, 0xE892, 0xEA1E, 0xEBAB, 0xED38, 0xEEC6, 0xF055, 0xF1E4, 0xF374, 0xF505, 0xF695,
    0xF827, 0xF9B8, 0xFB4A, 0xFCDC, 0xFE6E, 0x0000
 };
+
+/**
+ * \par
+ * Quarter-wave sine tables of the RISCV_MATH_SIN_COS_TABLE64 tier of riscv_sin_f32(), riscv_sin_q31()
+ * and the other sine and cosine functions, 64 intervals of a quarter wave and the 2 points past it
+ * that the quadratic interpolation of the last interval reads:
+ * <pre>
+ * for(n = 0; n < (64 + 3); n++)
+ * {
+ *	sinTable[n] = sin(pi*n/128);
+ * } </pre>
+ * The Q31 values are rounded and saturated to 0x7FFFFFFF.
+ */
+const float32_t sinTableQuarter64_f32[FAST_MATH_QUARTER_TABLE_SIZE + 3] RISCV_DSP_FASTDATA(SINE, sinTableQuarter64_f32) = {
+   0.000000000f, 0.024541229f, 0.049067674f, 0.073564564f, 0.098017140f, 0.122410675f,
+   0.146730474f, 0.170961889f, 0.195090322f, 0.219101240f, 0.242980180f, 0.266712757f,
+   0.290284677f, 0.313681740f, 0.336889853f, 0.359895037f, 0.382683432f, 0.405241314f,
+   0.427555093f, 0.449611330f, 0.471396737f, 0.492898192f, 0.514102744f, 0.534997620f,
+   0.555570233f, 0.575808191f, 0.595699304f, 0.615231591f, 0.634393284f, 0.653172843f,
+   0.671558955f, 0.689540545f, 0.707106781f, 0.724247083f, 0.740951125f, 0.757208847f,
+   0.773010453f, 0.788346428f, 0.803207531f, 0.817584813f, 0.831469612f, 0.844853565f,
+   0.857728610f, 0.870086991f, 0.881921264f, 0.893224301f, 0.903989293f, 0.914209756f,
+   0.923879533f, 0.932992799f, 0.941544065f, 0.949528181f, 0.956940336f, 0.963776066f,
+   0.970031253f, 0.975702130f, 0.980785280f, 0.985277642f, 0.989176510f, 0.992479535f,
+   0.995184727f, 0.997290457f, 0.998795456f, 0.999698819f, 1.000000000f, 0.999698819f,
+   0.998795456f
+};
+
+const q31_t sinTableQuarter64_q31[FAST_MATH_QUARTER_TABLE_SIZE + 3] RISCV_DSP_FASTDATA(SINE, sinTableQuarter64_q31) = {
+   0x00000000, 0x03242ABF, 0x0647D97C, 0x096A9049, 0x0C8BD35E, 0x0FAB272B,
+   0x12C8106F, 0x15E21445, 0x18F8B83C, 0x1C0B826A, 0x1F19F97B, 0x2223A4C5,
+   0x25280C5E, 0x2826B928, 0x2B1F34EB, 0x2E110A62, 0x30FBC54D, 0x33DEF287,
+   0x36BA2014, 0x398CDD32, 0x3C56BA70, 0x3F1749B8, 0x41CE1E65, 0x447ACD50,
+   0x471CECE7, 0x49B41533, 0x4C3FDFF4, 0x4EBFE8A5, 0x5133CC94, 0x539B2AF0,
+   0x55F5A4D2, 0x5842DD54, 0x5A82799A, 0x5CB420E0, 0x5ED77C8A, 0x60EC3830,
+   0x62F201AC, 0x64E88926, 0x66CF8120, 0x68A69E81, 0x6A6D98A4, 0x6C242960,
+   0x6DCA0D14, 0x6F5F02B2, 0x70E2CBC6, 0x72552C85, 0x73B5EBD1, 0x7504D345,
+   0x7641AF3D, 0x776C4EDB, 0x78848414, 0x798A23B1, 0x7A7D055B, 0x7B5D039E,
+   0x7C29FBEE, 0x7CE3CEB2, 0x7D8A5F40, 0x7E1D93EA, 0x7E9D55FC, 0x7F0991C4,
+   0x7F62368F, 0x7FA736B4, 0x7FD8878E, 0x7FF62182, 0x7FFFFFFF, 0x7FF62182,
+   0x7FD8878E
+};
+
+/**
+ * \par
+ * Initial guesses of 1/sqrt(x) for riscv_sqrt_q15() and riscv_sqrt_q31() in Q14 (2.14 format),
+ * for the normalized inputs x in [0.25 1).  Entry n covers x in [(n+16)/64 (n+17)/64)
+ * and holds the value in the middle of the interval:
+ * <pre>
+ * for(n = 0; n < 48; n++)
+ * {
+ *	invSqrtTable[n] = round(16384 / sqrt((n + 16.5) / 64));
+ * } </pre>
+ */
+const q15_t invSqrtTable_q15[48] = {
+   0x7E0C, 0x7A64, 0x770A, 0x73F2, 0x7115, 0x6E6C, 0x6BF0, 0x699E, 0x6771, 0x6564, 0x6376, 0x61A2,
+   0x5FE8, 0x5E44, 0x5CB5, 0x5B3A, 0x59D0, 0x5876, 0x572B, 0x55EF, 0x54BF, 0x539C, 0x5284, 0x5177,
+   0x5074, 0x4F7A, 0x4E8A, 0x4DA1, 0x4CC1, 0x4BE7, 0x4B15, 0x4A4A, 0x4985, 0x48C6, 0x480C, 0x4758,
+   0x46AA, 0x4600, 0x455B, 0x44BA, 0x441E, 0x4385, 0x42F1, 0x4260, 0x41D3, 0x414A, 0x40C3, 0x4040
+};
+
+/**
+ * \par
+ * CORDIC angles atan(2^-n) for riscv_atan2_q15() and riscv_atan2_q31(), in Q29 (2.29 format):
+ * <pre>
+ * for(n = 0; n < 31; n++)
+ * {
+ *	atanTable[n] = round(atan(pow(2, -n)) * pow(2, 29));
+ * } </pre>
+ */
+const q31_t atanTable_q31[31] = {
+   0x1921FB54, 0x0ED63383, 0x07D6DD7E, 0x03FAB753, 0x01FF55BB, 0x00FFEAAE,
+   0x007FFD55, 0x003FFFAB, 0x001FFFF5, 0x000FFFFF, 0x00080000, 0x00040000,
+   0x00020000, 0x00010000, 0x00008000, 0x00004000, 0x00002000, 0x00001000,
+   0x00000800, 0x00000400, 0x00000200, 0x00000100, 0x00000080, 0x00000040,
+   0x00000020, 0x00000010, 0x00000008, 0x00000004, 0x00000002, 0x00000001,
+   0x00000000
+};
+
+/**
+ * \par
+ * Tables for riscv_vlog_q15() and riscv_vlog_q31().  A normalized input m in [1 2) is multiplied by
+ * the reciprocal of the middle of its interval, in Q31, so that the product is within 1/64 of one:
+ * <pre>
+ * for(n = 0; n < 32; n++)
+ * {
+ *	logRecipTable[n] = round(pow(2, 31) / (1 + (n + 0.5) / 32));
+ *	logTable[n]      = round(log(1 + (n + 0.5) / 32) * pow(2, 31));
+ * } </pre>
+ */
+const q31_t logRecipTable_q31[32] = {
+   0x7E07E07E, 0x7A44C6B0, 0x76B981DB, 0x73615A24, 0x70381C0E, 0x6D3A06D4,
+   0x6A63BD82, 0x67B23A54, 0x6522C3F3, 0x62B2E43E, 0x60606060, 0x5E293206,
+   0x5C0B8170, 0x5A05A05A, 0x58160581, 0x563B48C2, 0x54741FAC, 0x52BF5A81,
+   0x511BE196, 0x4F88B2F4, 0x4E04E04E, 0x4C8F8D29, 0x4B27ED36, 0x49CD42E2,
+   0x487EDE05, 0x473C1AB7, 0x46046046, 0x44D72045, 0x43B3D5B0, 0x429A042A,
+   0x4189374C, 0x40810204
+};
+
+const q31_t logTable_q31[32] = {
+   0x01FC0A8B, 0x05DD163E, 0x09A0EBCB, 0x0D49369D, 0x10D77E7D, 0x144D2B6D,
+   0x17AB8902, 0x1AF3C94F, 0x1E27076E, 0x214649C5, 0x245283F8, 0x274C98AB,
+   0x2A355B0E, 0x2D0D903D, 0x2FD5F077, 0x328F2838, 0x3539D935, 0x37D69B3B,
+   0x3A65FCFC, 0x3CE884C4, 0x3F5EB11F, 0x41C8F970, 0x4427CE79, 0x467B9AD2,
+   0x48C4C35F, 0x4B03A7B5, 0x4D38A276, 0x4F6409AA, 0x51862F08, 0x539F6047,
+   0x55AFE757, 0x57B80AA5
+};
+
+/**
+ * \par
+ * Table for riscv_vexp_q15() and riscv_vexp_q31(), in Q30 (2.30 format):
+ * <pre>
+ * for(n = 0; n < 32; n++)
+ * {
+ *	exp2Table[n] = round(pow(2, -n / 32.0) * pow(2, 30));
+ * } </pre>
+ */
+const q31_t exp2Table_q31[32] = {
+   0x40000000, 0x3EA0ECB7, 0x3D495F45, 0x3BF92E67, 0x3AB031BA, 0x396E41BA,
+   0x383337BB, 0x36FEEDE6, 0x35D13F33, 0x34AA0764, 0x33892305, 0x326E6F62,
+   0x3159CA84, 0x304B1333, 0x2F4228E8, 0x2E3EEBD2, 0x2D413CCD, 0x2C48FD60,
+   0x2B560FBB, 0x2A6856AD, 0x297FB5AA, 0x289C10C1, 0x27BD4C98, 0x26E34E6E,
+   0x260DFC14, 0x253D3BEA, 0x2470F4DD, 0x23A90E63, 0x22E57079, 0x222603A0,
+   0x216AB0DA, 0x20B361A6
+};
@@ -46,113 +46,167 @@
 
 //Floating-point structs
 
+#if RISCV_DSP_FFT_LEN(16)
 const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len16 = {
-	16, twiddleCoef_16, riscvBitRevIndexTable16, RISCVBITREVINDEXTABLE__16_TABLE_LENGTH
+	16, RISCV_CFFT_TWIDDLE_F32(16), riscvBitRevIndexTable16, RISCVBITREVINDEXTABLE__16_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(32)
 const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len32 = {
-	32, twiddleCoef_32, riscvBitRevIndexTable32, RISCVBITREVINDEXTABLE__32_TABLE_LENGTH
+	32, RISCV_CFFT_TWIDDLE_F32(32), riscvBitRevIndexTable32, RISCVBITREVINDEXTABLE__32_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(64)
 const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len64 = {
-	64, twiddleCoef_64, riscvBitRevIndexTable64, RISCVBITREVINDEXTABLE__64_TABLE_LENGTH
+	64, RISCV_CFFT_TWIDDLE_F32(64), riscvBitRevIndexTable64, RISCVBITREVINDEXTABLE__64_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(128)
 const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len128 = {
-	128, twiddleCoef_128, riscvBitRevIndexTable128, RISCVBITREVINDEXTABLE_128_TABLE_LENGTH
+	128, RISCV_CFFT_TWIDDLE_F32(128), riscvBitRevIndexTable128, RISCVBITREVINDEXTABLE_128_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(256)
 const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len256 = {
-	256, twiddleCoef_256, riscvBitRevIndexTable256, RISCVBITREVINDEXTABLE_256_TABLE_LENGTH
+	256, RISCV_CFFT_TWIDDLE_F32(256), riscvBitRevIndexTable256, RISCVBITREVINDEXTABLE_256_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(512)
 const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len512 = {
-	512, twiddleCoef_512, riscvBitRevIndexTable512, RISCVBITREVINDEXTABLE_512_TABLE_LENGTH
+	512, RISCV_CFFT_TWIDDLE_F32(512), riscvBitRevIndexTable512, RISCVBITREVINDEXTABLE_512_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(1024)
 const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len1024 = {
-	1024, twiddleCoef_1024, riscvBitRevIndexTable1024, RISCVBITREVINDEXTABLE1024_TABLE_LENGTH
+	1024, RISCV_CFFT_TWIDDLE_F32(1024), riscvBitRevIndexTable1024, RISCVBITREVINDEXTABLE1024_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(2048)
 const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len2048 = {
-	2048, twiddleCoef_2048, riscvBitRevIndexTable2048, RISCVBITREVINDEXTABLE2048_TABLE_LENGTH
+	2048, RISCV_CFFT_TWIDDLE_F32(2048), riscvBitRevIndexTable2048, RISCVBITREVINDEXTABLE2048_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(4096)
 const riscv_cfft_instance_f32 riscv_cfft_sR_f32_len4096 = {
-	4096, twiddleCoef_4096, riscvBitRevIndexTable4096, RISCVBITREVINDEXTABLE4096_TABLE_LENGTH
+	4096, RISCV_CFFT_TWIDDLE_F32(4096), riscvBitRevIndexTable4096, RISCVBITREVINDEXTABLE4096_TABLE_LENGTH
 };
+#endif
 
 //Fixed-point structs
 
+#if RISCV_DSP_FFT_LEN(16)
 const riscv_cfft_instance_q31 riscv_cfft_sR_q31_len16 = {
 	16, twiddleCoef_16_q31, riscvBitRevIndexTable_fixed_16, RISCVBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(32)
 const riscv_cfft_instance_q31 riscv_cfft_sR_q31_len32 = {
 	32, twiddleCoef_32_q31, riscvBitRevIndexTable_fixed_32, RISCVBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(64)
 const riscv_cfft_instance_q31 riscv_cfft_sR_q31_len64 = {
 	64, twiddleCoef_64_q31, riscvBitRevIndexTable_fixed_64, RISCVBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(128)
 const riscv_cfft_instance_q31 riscv_cfft_sR_q31_len128 = {
 	128, twiddleCoef_128_q31, riscvBitRevIndexTable_fixed_128, RISCVBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(256)
 const riscv_cfft_instance_q31 riscv_cfft_sR_q31_len256 = {
 	256, twiddleCoef_256_q31, riscvBitRevIndexTable_fixed_256, RISCVBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(512)
 const riscv_cfft_instance_q31 riscv_cfft_sR_q31_len512 = {
 	512, twiddleCoef_512_q31, riscvBitRevIndexTable_fixed_512, RISCVBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(1024)
 const riscv_cfft_instance_q31 riscv_cfft_sR_q31_len1024 = {
 	1024, twiddleCoef_1024_q31, riscvBitRevIndexTable_fixed_1024, RISCVBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(2048)
 const riscv_cfft_instance_q31 riscv_cfft_sR_q31_len2048 = {
 	2048, twiddleCoef_2048_q31, riscvBitRevIndexTable_fixed_2048, RISCVBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(4096)
 const riscv_cfft_instance_q31 riscv_cfft_sR_q31_len4096 = {
 	4096, twiddleCoef_4096_q31, riscvBitRevIndexTable_fixed_4096, RISCVBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
 };
+#endif
 
 
+#if RISCV_DSP_FFT_LEN(16)
 const riscv_cfft_instance_q15 riscv_cfft_sR_q15_len16 = {
-	16, twiddleCoef_16_q15, riscvBitRevIndexTable_fixed_16, RISCVBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH
+	16, RISCV_CFFT_TWIDDLE_Q15(16), riscvBitRevIndexTable_fixed_16, RISCVBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(32)
 const riscv_cfft_instance_q15 riscv_cfft_sR_q15_len32 = {
-	32, twiddleCoef_32_q15, riscvBitRevIndexTable_fixed_32, RISCVBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH
+	32, RISCV_CFFT_TWIDDLE_Q15(32), riscvBitRevIndexTable_fixed_32, RISCVBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(64)
 const riscv_cfft_instance_q15 riscv_cfft_sR_q15_len64 = {
-	64, twiddleCoef_64_q15, riscvBitRevIndexTable_fixed_64, RISCVBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH
+	64, RISCV_CFFT_TWIDDLE_Q15(64), riscvBitRevIndexTable_fixed_64, RISCVBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(128)
 const riscv_cfft_instance_q15 riscv_cfft_sR_q15_len128 = {
-	128, twiddleCoef_128_q15, riscvBitRevIndexTable_fixed_128, RISCVBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH
+	128, RISCV_CFFT_TWIDDLE_Q15(128), riscvBitRevIndexTable_fixed_128, RISCVBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(256)
 const riscv_cfft_instance_q15 riscv_cfft_sR_q15_len256 = {
-	256, twiddleCoef_256_q15, riscvBitRevIndexTable_fixed_256, RISCVBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH
+	256, RISCV_CFFT_TWIDDLE_Q15(256), riscvBitRevIndexTable_fixed_256, RISCVBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(512)
 const riscv_cfft_instance_q15 riscv_cfft_sR_q15_len512 = {
-	512, twiddleCoef_512_q15, riscvBitRevIndexTable_fixed_512, RISCVBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH
+	512, RISCV_CFFT_TWIDDLE_Q15(512), riscvBitRevIndexTable_fixed_512, RISCVBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(1024)
 const riscv_cfft_instance_q15 riscv_cfft_sR_q15_len1024 = {
-	1024, twiddleCoef_1024_q15, riscvBitRevIndexTable_fixed_1024, RISCVBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
+	1024, RISCV_CFFT_TWIDDLE_Q15(1024), riscvBitRevIndexTable_fixed_1024, RISCVBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(2048)
 const riscv_cfft_instance_q15 riscv_cfft_sR_q15_len2048 = {
-	2048, twiddleCoef_2048_q15, riscvBitRevIndexTable_fixed_2048, RISCVBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
+	2048, RISCV_CFFT_TWIDDLE_Q15(2048), riscvBitRevIndexTable_fixed_2048, RISCVBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
 };
+#endif
 
+#if RISCV_DSP_FFT_LEN(4096)
 const riscv_cfft_instance_q15 riscv_cfft_sR_q15_len4096 = {
-	4096, twiddleCoef_4096_q15, riscvBitRevIndexTable_fixed_4096, RISCVBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
+	4096, RISCV_CFFT_TWIDDLE_Q15(4096), riscvBitRevIndexTable_fixed_4096, RISCVBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
 };
+#endif
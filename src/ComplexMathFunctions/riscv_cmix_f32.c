@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmix_f32.c
+*
+* Description:  Floating-point complex mixer with a built-in oscillator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup CmplxMix Complex Mixer
+ *
+ * Multiplies a complex vector by the local oscillator <code>exp(j*phi[n])</code>:
+ * <pre>
+ *    pDst[2n+0] = pSrc[2n+0] * cos(phi[n]) - pSrc[2n+1] * sin(phi[n])
+ *    pDst[2n+1] = pSrc[2n+0] * sin(phi[n]) + pSrc[2n+1] * cos(phi[n])
+ * </pre>
+ * The phase <code>phi[n]</code> is the phase accumulator of an NCO instance, initialized with
+ * riscv_nco_init_f32(), riscv_nco_init_q31() or riscv_nco_init_q15(), and continues across calls.
+ * A negative phase increment shifts the spectrum down, as for the conversion to baseband.
+ * \par
+ * The oscillator values are computed per sample as in riscv_nco_f32(), riscv_nco_q31() and
+ * riscv_nco_q15(), so no table of oscillator values is needed.  The result is the same as the
+ * complex multiplication of the input by the NCO outputs.
+ * \par
+ * The input and output are interleaved (real, imag) pairs and the functions work in place.
+ */
+
+/**
+ * @addtogroup CmplxMix
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex mixer.
+ * @param[in,out] *S           points to an instance of the floating-point NCO structure.
+ * @param[in]     *pSrc        points to the complex input vector.
+ * @param[out]    *pDst        points to the complex output vector.
+ * @param[in]     numSamples   number of complex samples in the vectors.
+ * @return none.
+ */
+
+void riscv_cmix_f32(
+  riscv_nco_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmix_f32);
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  uint32_t index;                                /* Table index */
+  float32_t fract;                               /* Interpolation fraction */
+  float32_t loSin, loCos;                        /* Local oscillator */
+  float32_t re, im;                              /* Input sample */
+
+  while(numSamples > 0u)
+  {
+    /* Local oscillator, as riscv_nco_f32() */
+    fract = (float32_t) (phase & 0x007FFFFFu) * 1.1920928955078125e-7f;
+    index = phase >> 23u;
+    loSin = (1.0f - fract) * sinTable_f32[index] + fract * sinTable_f32[index + 1];
+    index = (phase + 0x40000000u) >> 23u;
+    loCos = (1.0f - fract) * sinTable_f32[index] + fract * sinTable_f32[index + 1];
+
+    re = *pSrc++;
+    im = *pSrc++;
+    *pDst++ = (re * loCos) - (im * loSin);
+    *pDst++ = (re * loSin) + (im * loCos);
+
+    phase += phaseInc;
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+
+  S->phase = phase;
+}
+
+/**
+ * @} end of CmplxMix group
+ */
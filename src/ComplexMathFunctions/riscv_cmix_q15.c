@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmix_q15.c
+*
+* Description:  Q15 complex mixer with a built-in oscillator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxMix
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex mixer.
+ * @param[in,out] *S           points to an instance of the Q15 NCO structure.
+ * @param[in]     *pSrc        points to the complex input vector.
+ * @param[out]    *pDst        points to the complex output vector.
+ * @param[in]     numSamples   number of complex samples in the vectors.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are summed in 2.30 format and the sums saturated to 1.15 format.  An oscillator
+ * sine of 0x8000 is negated to 0x7FFF.
+ * \par
+ * With the DSP extension each output is one <code>pv.dotsp.h</code> of the (real, imag) input
+ * pair with the packed oscillator values.  The magnitude of the oscillator is at most one, so
+ * the sums fit in 32 bits.
+ */
+
+void riscv_cmix_q15(
+  riscv_nco_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmix_q15);
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  uint32_t index;                                /* Table index */
+  q31_t fract;                                   /* Interpolation fraction in 1.15 format */
+  q31_t a;                                       /* Table value below the phase */
+  q31_t loSin, loCos, loNegSin;                  /* Local oscillator */
+  q31_t re, im;                                  /* Output sums in 2.30 format */
+#if defined (USE_DSP_RISCV)
+  shortV x;                                      /* Input (real, imag) pair */
+#endif
+
+  while(numSamples > 0u)
+  {
+    /* Local oscillator, as riscv_nco_q15() */
+    fract = (q31_t) ((phase >> 8u) & 0x7FFFu);
+    index = phase >> 23u;
+    a = sinTable_q15[index];
+    loSin = a + ((((q31_t) sinTable_q15[index + 1] - a) * fract) >> 15);
+    index = (phase + 0x40000000u) >> 23u;
+    a = sinTable_q15[index];
+    loCos = a + ((((q31_t) sinTable_q15[index + 1] - a) * fract) >> 15);
+    loNegSin = __SSAT(-loSin, 16);
+
+#if defined (USE_DSP_RISCV)
+    x = *(shortV *) pSrc;
+    pSrc += 2;
+    re = dotpv2(x, pack2(loCos, loNegSin));
+    im = dotpv2(x, pack2(loSin, loCos));
+    *pDst++ = (q15_t) clip(re >> 15, -32768, 32767);
+    *pDst++ = (q15_t) clip(im >> 15, -32768, 32767);
+#else
+    re = ((q31_t) pSrc[0] * loCos) + ((q31_t) pSrc[1] * loNegSin);
+    im = ((q31_t) pSrc[0] * loSin) + ((q31_t) pSrc[1] * loCos);
+    pSrc += 2;
+    *pDst++ = (q15_t) __SSAT(re >> 15, 16);
+    *pDst++ = (q15_t) __SSAT(im >> 15, 16);
+#endif
+
+    phase += phaseInc;
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+
+  S->phase = phase;
+}
+
+/**
+ * @} end of CmplxMix group
+ */
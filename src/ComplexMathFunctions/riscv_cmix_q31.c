@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmix_q31.c
+*
+* Description:  Q31 complex mixer with a built-in oscillator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxMix
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex mixer.
+ * @param[in,out] *S           points to an instance of the Q31 NCO structure.
+ * @param[in]     *pSrc        points to the complex input vector.
+ * @param[out]    *pDst        points to the complex output vector.
+ * @param[in]     numSamples   number of complex samples in the vectors.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are summed in 2.62 format and the sums saturated to 1.31 format.
+ */
+
+void riscv_cmix_q31(
+  riscv_nco_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmix_q31);
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  uint32_t index;                                /* Table index */
+  q31_t fract;                                   /* Interpolation fraction in 1.31 format */
+  q31_t a, b;                                    /* Two nearest table values */
+  q31_t loSin, loCos;                            /* Local oscillator */
+  q31_t re, im;                                  /* Input sample */
+
+  while(numSamples > 0u)
+  {
+    /* Local oscillator, as riscv_nco_q31() */
+    fract = (q31_t) ((phase & 0x007FFFFFu) << 8u);
+    index = phase >> 23u;
+    a = sinTable_q31[index];
+    b = sinTable_q31[index + 1];
+    loSin = (q31_t) (((0x80000000LL - fract) * a) >> 32);
+    loSin = (q31_t) ((((q63_t) loSin << 32) + ((q63_t) fract * b)) >> 32);
+    loSin = (q31_t) ((uint32_t) loSin << 1);
+    index = (phase + 0x40000000u) >> 23u;
+    a = sinTable_q31[index];
+    b = sinTable_q31[index + 1];
+    loCos = (q31_t) (((0x80000000LL - fract) * a) >> 32);
+    loCos = (q31_t) ((((q63_t) loCos << 32) + ((q63_t) fract * b)) >> 32);
+    loCos = (q31_t) ((uint32_t) loCos << 1);
+
+    re = *pSrc++;
+    im = *pSrc++;
+    *pDst++ = clip_q63_to_q31((((q63_t) re * loCos) - ((q63_t) im * loSin)) >> 31);
+    *pDst++ = clip_q63_to_q31((((q63_t) re * loSin) + ((q63_t) im * loCos)) >> 31);
+
+    phase += phaseInc;
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+
+  S->phase = phase;
+}
+
+/**
+ * @} end of CmplxMix group
+ */
@@ -86,6 +86,7 @@ void riscv_cmplx_conj_f32(
   float32_t * pDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_conj_f32);
   uint32_t blkCnt;                               /* loop counter */
   blkCnt = numSamples;
   while(blkCnt > 0u)
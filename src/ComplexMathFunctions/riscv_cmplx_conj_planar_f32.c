@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_conj_planar_f32.c
+*
+* Description:  Floating-point complex conjugate on planar data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_conj
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex conjugate on planar data.
+ * @param  *pSrcRe points to the real parts of the input
+ * @param  *pSrcIm points to the imaginary parts of the input
+ * @param  *pDstRe points to the real parts of the output, may be <code>pSrcRe</code>
+ * @param  *pDstIm points to the imaginary parts of the output, may be <code>pSrcIm</code>
+ * @param  numSamples number of complex samples
+ * @return none.
+ *
+ * \par
+ * The real parts are copied unless <code>pDstRe</code> is <code>pSrcRe</code>.
+ */
+
+void riscv_cmplx_conj_planar_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_conj_planar_f32);
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(pDstRe != pSrcRe)
+  {
+    memcpy(pDstRe, pSrcRe, numSamples * sizeof(float32_t));
+  }
+
+  blkCnt = numSamples;
+
+  while(blkCnt > 0u)
+  {
+    /* realOut + j (imagOut) = realIn + j (-1) imagIn */
+    *pDstIm++ = -*pSrcIm++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_conj group
+ */
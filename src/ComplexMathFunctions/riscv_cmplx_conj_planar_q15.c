@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_conj_planar_q15.c
+*
+* Description:  Q15 complex conjugate on planar data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_conj
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex conjugate on planar data.
+ * @param  *pSrcRe points to the real parts of the input
+ * @param  *pSrcIm points to the imaginary parts of the input
+ * @param  *pDstRe points to the real parts of the output, may be <code>pSrcRe</code>
+ * @param  *pDstIm points to the imaginary parts of the output, may be <code>pSrcIm</code>
+ * @param  numSamples number of complex samples
+ * @return none.
+ *
+ * \par
+ * The real parts are copied unless <code>pDstRe</code> is <code>pSrcRe</code>.
+ * Saturated to 0x7FFF for an imaginary part of 0x8000, as riscv_cmplx_conj_q15().
+ * With the DSP extension two imaginary parts are negated per <code>pv.max.h</code> and negation.
+ */
+
+void riscv_cmplx_conj_planar_q15(
+  q15_t * pSrcRe,
+  q15_t * pSrcIm,
+  q15_t * pDstRe,
+  q15_t * pDstIm,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_conj_planar_q15);
+  q15_t in;                                      /* Imaginary input */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(pDstRe != pSrcRe)
+  {
+    memcpy(pDstRe, pSrcRe, numSamples * sizeof(q15_t));
+  }
+
+#if defined (USE_DSP_RISCV)
+  shortV minV = { -32767, -32767 };              /* 0x8000 negates to 0x7FFF */
+
+  for (blkCnt = numSamples >> 1u; blkCnt > 0u; blkCnt--)
+  {
+    *(shortV *) pDstIm = neg2(max2(*(shortV *) pSrcIm, minV));
+    pSrcIm += 2;
+    pDstIm += 2;
+  }
+
+  blkCnt = numSamples & 0x1u;
+#else
+  blkCnt = numSamples;
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* realOut + j (imagOut) = realIn + j (-1) imagIn */
+    in = *pSrcIm++;
+    *pDstIm++ = (in == (q15_t) 0x8000) ? 0x7fff : -in;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_conj group
+ */
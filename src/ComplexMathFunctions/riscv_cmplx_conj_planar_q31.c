@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_conj_planar_q31.c
+*
+* Description:  Q31 complex conjugate on planar data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_conj
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex conjugate on planar data.
+ * @param  *pSrcRe points to the real parts of the input
+ * @param  *pSrcIm points to the imaginary parts of the input
+ * @param  *pDstRe points to the real parts of the output, may be <code>pSrcRe</code>
+ * @param  *pDstIm points to the imaginary parts of the output, may be <code>pSrcIm</code>
+ * @param  numSamples number of complex samples
+ * @return none.
+ *
+ * \par
+ * The real parts are copied unless <code>pDstRe</code> is <code>pSrcRe</code>.
+ * Saturated to 0x7FFFFFFF for an imaginary part of 0x80000000, as riscv_cmplx_conj_q31().
+ */
+
+void riscv_cmplx_conj_planar_q31(
+  q31_t * pSrcRe,
+  q31_t * pSrcIm,
+  q31_t * pDstRe,
+  q31_t * pDstIm,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_conj_planar_q31);
+  q31_t in;                                      /* Imaginary input */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(pDstRe != pSrcRe)
+  {
+    memcpy(pDstRe, pSrcRe, numSamples * sizeof(q31_t));
+  }
+
+  blkCnt = numSamples;
+
+  while(blkCnt > 0u)
+  {
+    /* realOut + j (imagOut) = realIn + j (-1) imagIn */
+    in = *pSrcIm++;
+    *pDstIm++ = (in == INT32_MIN) ? INT32_MAX : -in;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_conj group
+ */
@@ -69,6 +69,7 @@ void riscv_cmplx_conj_q15(
   q15_t * pDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_conj_q15);
 
   q15_t in;
   q31_t out;
@@ -68,6 +68,7 @@ void riscv_cmplx_conj_q31(
   q31_t * pDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_conj_q31);
   uint32_t blkCnt;                               /* loop counter */
   q31_t in;                                      /* Input value */
   blkCnt = numSamples;
@@ -94,6 +94,7 @@ void riscv_cmplx_dot_prod_f32(
   float32_t * realResult,
   float32_t * imagResult)
 {
+  RISCV_PROFILE(riscv_cmplx_dot_prod_f32);
   float32_t real_sum = 0.0f, imag_sum = 0.0f;    /* Temporary result storage */
   float32_t a0,b0,c0,d0;
   while(numSamples > 0u)
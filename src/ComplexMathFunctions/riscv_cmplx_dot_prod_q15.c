@@ -76,6 +76,7 @@ void riscv_cmplx_dot_prod_q15(
   q31_t * realResult,
   q31_t * imagResult)
 {
+  RISCV_PROFILE(riscv_cmplx_dot_prod_q15);
   q63_t real_sum = 0, imag_sum = 0;              /* Temporary result storage */
   q15_t a0,b0,c0,d0;
 
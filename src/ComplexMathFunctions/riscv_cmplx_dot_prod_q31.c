@@ -68,6 +68,11 @@
  * Additions are nonsaturating and no overflow will occur as long as <code>numSamples</code> is less than 32768.    
  * The return results <code>realResult</code> and <code>imagResult</code> are in 16.48 format.    
  * Input down scaling is not required.    
+ * \par
+ * With the DSP extension the two products of the real part, and those of the imaginary part, are
+ * combined in 2.62 format before the shift, which halves the 64-bit shifts and additions.  The
+ * results may differ by one LSB per sample from the plain C path, and the combination wraps when
+ * both products are 1.0, as in <code>(-1 - 1j) * (-1 - 1j)</code>.
  */
 
 void riscv_cmplx_dot_prod_q31(
@@ -77,9 +82,28 @@ void riscv_cmplx_dot_prod_q31(
   q63_t * realResult,
   q63_t * imagResult)
 {
+  RISCV_PROFILE(riscv_cmplx_dot_prod_q31);
   q63_t real_sum = 0, imag_sum = 0;              /* Temporary result storage */
   q31_t a0,b0,c0,d0;
-  /* Run the below code for Cortex-M0 */
+
+
+#if defined (USE_DSP_RISCV)
+
+  while(numSamples > 0u)
+  {
+    a0 = *pSrcA++;
+    b0 = *pSrcA++;
+    c0 = *pSrcB++;
+    d0 = *pSrcB++;
+
+    real_sum += (((q63_t) a0 * c0) - ((q63_t) b0 * d0)) >> 14;
+    imag_sum += (((q63_t) a0 * d0) + ((q63_t) b0 * c0)) >> 14;
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+
+#else
 
   while(numSamples > 0u)
   {
@@ -97,6 +121,8 @@ void riscv_cmplx_dot_prod_q31(
       numSamples--;
   }
 
+#endif /* #if defined (USE_DSP_RISCV) */
+
   /* Store the real and imaginary results in 16.48 format  */
   *realResult = real_sum;
   *imagResult = imag_sum;
@@ -0,0 +1,59 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_mag_approx_f32.c
+*
+* Description:  Floating-point complex magnitude by alpha-max-plus-beta-min.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <math.h>
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag
+ * @{
+ */
+
+/**
+ * @brief Floating-point complex magnitude, alpha-max-plus-beta-min approximation.
+ * @param[in]       *pSrc points to complex input buffer
+ * @param[out]      *pDst points to real output buffer
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * \par
+ * <code>max(hi, 0.875 * hi + 0.5 * lo)</code> of the larger and the smaller absolute part, as
+ * riscv_cmplx_mag_approx_q15(): 3.0% below to 0.8% above the magnitude, without the square root.
+ */
+
+void riscv_cmplx_mag_approx_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_mag_approx_f32);
+  float32_t real, imag, hi, lo, est;             /* Absolute values and estimate */
+
+  while(numSamples > 0u)
+  {
+    real = fabsf(*pSrc++);
+    imag = fabsf(*pSrc++);
+
+    hi = (real > imag) ? real : imag;
+    lo = (real > imag) ? imag : real;
+    est = (0.875f * hi) + (0.5f * lo);
+    *pDst++ = (est > hi) ? est : hi;
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag group
+ */
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_mag_approx_q15.c
+*
+* Description:  Q15 complex magnitude by alpha-max-plus-beta-min.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex magnitude, alpha-max-plus-beta-min approximation.
+ * @param  *pSrc points to the complex input vector
+ * @param  *pDst points to the real output vector
+ * @param  numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * \par
+ * For envelopes and detection thresholds that tolerate a few percent of error, the square root
+ * is replaced by <code>max(hi, 7/8 * hi + 1/2 * lo)</code>, with <code>hi</code> and <code>lo</code>
+ * the larger and the smaller of <code>|real|</code> and <code>|imag|</code>: shifts, additions and
+ * comparisons only.  The result is 3.0% below to 0.8% above the magnitude.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The output is in 2.14 format, as riscv_cmplx_mag_q15().  An input of 0x8000 is taken as 0x8001.
+ * With the DSP extension two samples are processed per pass with the packed abs, max, min and
+ * shifts; the results are the same.
+ */
+
+void riscv_cmplx_mag_approx_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_mag_approx_q15);
+  q31_t real, imag, hi, lo, est;                 /* Absolute values and estimate */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+  shortV minV = { -32767, -32767 };              /* Lower bound of the inputs */
+  shortV even = { 0, 2 };                        /* Shuffle masks for the real and imaginary parts */
+  shortV odd = { 1, 3 };
+  shortV one = { 1, 1 }, two = { 2, 2 }, three = { 3, 3 };
+  shortV x0, x1, hiV, loV, estV;
+
+  for (blkCnt = numSamples >> 1u; blkCnt > 0u; blkCnt--)
+  {
+    x0 = abs2(max2(*(shortV *) pSrc, minV));
+    x1 = abs2(max2(*(shortV *) (pSrc + 2), minV));
+    pSrc += 4;
+
+    /* Larger and smaller part of both samples, the larger one in 2.14 */
+    hiV = shufflev4(x0, x1, even);
+    loV = shufflev4(x0, x1, odd);
+    estV = max2(hiV, loV);
+    loV = min2(hiV, loV);
+    hiV = sra2(estV, one);
+
+    estV = add2v(sub2(hiV, sra2(hiV, three)), sra2(loV, two));
+    *(shortV *) pDst = max2(hiV, estV);
+    pDst += 2;
+  }
+
+  blkCnt = numSamples & 0x1u;
+#else
+  blkCnt = numSamples;
+#endif
+
+  while(blkCnt > 0u)
+  {
+    real = *pSrc++;
+    imag = *pSrc++;
+    real = (real < 0) ? ((real == -32768) ? 32767 : -real) : real;
+    imag = (imag < 0) ? ((imag == -32768) ? 32767 : -imag) : imag;
+
+    hi = ((real > imag) ? real : imag) >> 1;
+    lo = (real > imag) ? imag : real;
+
+    /* 7/8 * hi + 1/2 * lo, in 2.14 format */
+    est = (hi - (hi >> 3)) + (lo >> 2);
+    *pDst++ = (q15_t) ((est > hi) ? est : hi);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag group
+ */
@@ -90,19 +90,24 @@ void riscv_cmplx_mag_f32(
   float32_t * pDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_mag_f32);
   float32_t realIn, imagIn;                      /* Temporary variables to hold input values */
-  while(numSamples > 0u)
+  float32_t *pOut = pDst;                        /* Output pointer */
+  uint32_t blkCnt = numSamples;                  /* loop counter */
+
+  while(blkCnt > 0u)
   {
-    /* out = sqrt((real * real) + (imag * imag)) */
+    /* out = (real * real) + (imag * imag) */
     realIn = *pSrc++;
     imagIn = *pSrc++;
-    /* store the result in the destination buffer. */
-    riscv_sqrt_f32((realIn * realIn) + (imagIn * imagIn), pDst++);
+    *pOut++ = (realIn * realIn) + (imagIn * imagIn);
 
     /* Decrement the loop counter */
-    numSamples--;
+    blkCnt--;
   }
 
+  /* out = sqrt(out), in place, as one block */
+  riscv_sqrt_vec_f32(pDst, pDst, numSamples);
 
 }
 
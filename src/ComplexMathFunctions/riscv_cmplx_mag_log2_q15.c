@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_mag_log2_q15.c
+*
+* Description:  Base-2 logarithm of the Q15 complex magnitude.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag
+ * @{
+ */
+
+/**
+ * @brief  Base-2 logarithm of the Q15 complex magnitude.
+ * @param  *pSrc points to the complex input vector
+ * @param  *pDst points to the real output vector
+ * @param  numSamples number of complex samples in the input vector
+ * @return none.
+ *
+ * \par
+ * <code>pDst[n] = log2(sqrt(real^2 + imag^2))</code> for level meters, envelopes in dB and
+ * CFAR thresholds, without a square root or a logarithm call.  The integer part is the position
+ * of the leading one of <code>real^2 + imag^2</code>, the fraction is the 10 bits that follow it
+ * with a parabolic correction, so the error is below 0.006 (0.04 dB).  Multiply by 6.0206 for dB
+ * relative to full scale.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The output is in 6.10 format, from -15.0 for one LSB to 0.5 for <code>(-1, -1)</code>.  A zero
+ * input gives 0x8000.  With the DSP extension the sum of squares is one packed dot product and the
+ * leading one is found by <code>p.fl1</code>; the results are the same.
+ */
+
+void riscv_cmplx_mag_log2_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_mag_log2_q15);
+  uint32_t power;                                /* real^2 + imag^2 in 2.30 format */
+  q31_t e, frac;                                 /* Integer and fractional part of log2(power) */
+#if !defined (USE_DSP_RISCV)
+  q31_t real, imag;
+#endif
+
+  while(numSamples > 0u)
+  {
+#if defined (USE_DSP_RISCV)
+    power = (uint32_t) dotpv2(*(shortV *) pSrc, *(shortV *) pSrc);
+    pSrc += 2;
+#else
+    real = *pSrc++;
+    imag = *pSrc++;
+    power = (uint32_t) (real * real) + (uint32_t) (imag * imag);
+#endif
+
+    if(power == 0u)
+    {
+      *pDst++ = (q15_t) 0x8000;
+    }
+    else
+    {
+#if defined (USE_DSP_RISCV)
+      e = fl1(power);
+#else
+      e = 31 - (q31_t) __CLZ((q31_t) power);
+#endif
+
+      /* 10 bits after the leading one, log2(1 + f) ~ f + 0.3466 * f * (1 - f) */
+      frac = (q31_t) (((power << (31 - e)) >> 21) & 0x3FFu);
+      frac += (((frac * (1024 - frac)) >> 10) * 355) >> 10;
+
+      /* log2(power) - 30, halved for the magnitude */
+      *pDst++ = (q15_t) ((((e - 30) << 10) + frac) >> 1);
+    }
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag group
+ */
@@ -0,0 +1,60 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_mag_planar_f32.c
+*
+* Description:  Floating-point complex magnitude on planar data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex magnitude on planar data.
+ * @param  *pSrcRe points to the real parts of the input
+ * @param  *pSrcIm points to the imaginary parts of the input
+ * @param  *pDst points to the real output vector
+ * @param  numSamples number of complex samples
+ * @return none.
+ *
+ * \par
+ * The squares are written to <code>pDst</code> and their square roots taken in place in one block.
+ */
+
+void riscv_cmplx_mag_planar_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_mag_planar_f32);
+  float32_t real, imag;                          /* Real and imaginary input */
+  float32_t *pOut = pDst;                        /* Output pointer */
+  uint32_t blkCnt = numSamples;                  /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    real = *pSrcRe++;
+    imag = *pSrcIm++;
+    *pOut++ = (real * real) + (imag * imag);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* out = sqrt(out), in place, as one block */
+  riscv_sqrt_vec_f32(pDst, pDst, numSamples);
+}
+
+/**
+ * @} end of cmplx_mag group
+ */
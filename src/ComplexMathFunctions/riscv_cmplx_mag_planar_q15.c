@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_mag_planar_q15.c
+*
+* Description:  Q15 complex magnitude on planar data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex magnitude on planar data.
+ * @param  *pSrcRe points to the real parts of the input
+ * @param  *pSrcIm points to the imaginary parts of the input
+ * @param  *pDst points to the real output vector
+ * @param  numSamples number of complex samples
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The output is in 2.14 format, as riscv_cmplx_mag_q15().
+ * With the DSP extension each sample is one <code>pv.dotsp.h</code> of its real and imaginary part,
+ * paired from the two planes by one shuffle per sample.  The sum is read unsigned, so a sample
+ * of 0x8000 + j0x8000 gives 0x4000 as in the scalar code.
+ *
+ * \par
+ * The squares are written to <code>pDst</code> and their square roots taken in place in one block.
+ */
+
+void riscv_cmplx_mag_planar_q15(
+  q15_t * pSrcRe,
+  q15_t * pSrcIm,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_mag_planar_q15);
+  q15_t real, imag;                              /* Real and imaginary input */
+  q15_t *pOut = pDst;                            /* Output pointer */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+  shortV even = { 0, 2 };                        /* Shuffle masks for the (real, imag) pairs */
+  shortV odd = { 1, 3 };
+  shortV re, im, z;
+
+  for (blkCnt = numSamples >> 1u; blkCnt > 0u; blkCnt--)
+  {
+    re = *(shortV *) pSrcRe;
+    im = *(shortV *) pSrcIm;
+    pSrcRe += 2;
+    pSrcIm += 2;
+
+    z = shufflev4(re, im, even);
+    *pOut++ = (q15_t) (((uint32_t) dotpv2(z, z)) >> 17);
+    z = shufflev4(re, im, odd);
+    *pOut++ = (q15_t) (((uint32_t) dotpv2(z, z)) >> 17);
+  }
+
+  blkCnt = numSamples & 0x1u;
+#else
+  blkCnt = numSamples;
+#endif
+
+  while(blkCnt > 0u)
+  {
+    real = *pSrcRe++;
+    imag = *pSrcIm++;
+    /* 3.13 format */
+    *pOut++ = (q15_t) (((q63_t) ((q31_t) real * real) + ((q31_t) imag * imag)) >> 17);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* out = sqrt(out) in 2.14 format, in place, as one block */
+  riscv_sqrt_vec_q15(pDst, pDst, numSamples);
+}
+
+/**
+ * @} end of cmplx_mag group
+ */
@@ -0,0 +1,65 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_mag_planar_q31.c
+*
+* Description:  Q31 complex magnitude on planar data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex magnitude on planar data.
+ * @param  *pSrcRe points to the real parts of the input
+ * @param  *pSrcIm points to the imaginary parts of the input
+ * @param  *pDst points to the real output vector
+ * @param  numSamples number of complex samples
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The output is in 2.30 format, as riscv_cmplx_mag_q31().
+ *
+ * \par
+ * The squares are written to <code>pDst</code> and their square roots taken in place in one block.
+ */
+
+void riscv_cmplx_mag_planar_q31(
+  q31_t * pSrcRe,
+  q31_t * pSrcIm,
+  q31_t * pDst,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_mag_planar_q31);
+  q31_t real, imag;                              /* Real and imaginary input */
+  q31_t *pOut = pDst;                            /* Output pointer */
+  uint32_t blkCnt = numSamples;                  /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    real = *pSrcRe++;
+    imag = *pSrcIm++;
+    /* 3.29 format */
+    *pOut++ = (q31_t) (((q63_t) real * real) >> 33) + (q31_t) (((q63_t) imag * imag) >> 33);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* out = sqrt(out) in 2.30 format, in place, as one block */
+  riscv_sqrt_vec_q31(pDst, pDst, numSamples);
+}
+
+/**
+ * @} end of cmplx_mag group
+ */
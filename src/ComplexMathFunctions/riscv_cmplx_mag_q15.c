@@ -69,6 +69,7 @@ void riscv_cmplx_mag_q15(
   q15_t * pDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_mag_q15);
   q31_t acc0, acc1;                              /* Accumulators */
   q15_t real, imag;                              /* Temporary variables to hold input values */
 #if defined (USE_DSP_RISCV)
@@ -41,6 +41,7 @@
 * ---------------------------------------------------------------------------- */
 
 #include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
 
 /**        
  * @ingroup groupCmplxMath        
@@ -51,6 +52,44 @@
  * @{        
  */
 
+/*
+* Square root of riscv_sqrt_q31(), bit for bit, inlined into the loop: the sum of squares is never
+* negative, so the sign test, the status and the call are left out.
+*/
+
+static __inline q31_t riscv_cmplx_mag_sqrt_q31(
+  q31_t number)
+{
+  q31_t temp1, var1, signBits1, half;
+  uint32_t i;
+
+  if(number == 0)
+  {
+    return (0);
+  }
+
+  /* Even normalization shift, so that the root only needs half of it */
+  signBits1 = (__CLZ(number) - 1) & ~1;
+  number = number << signBits1;
+  half = number >> 1;
+  temp1 = number;
+
+  /* 1/sqrt(number) in 2.30 format, table guess and three Newton-Raphson iterations */
+  var1 = (q31_t) invSqrtTable_q15[(number >> 25) - 16] << 16;
+  for (i = 0u; i < 3u; i++)
+  {
+    var1 = ((q31_t) ((q63_t) var1 * (0x30000000 -
+                                     ((q31_t)
+                                      ((((q31_t)
+                                         (((q63_t) var1 * var1) >> 31)) *
+                                        (q63_t) half) >> 31))) >> 31)) << 2;
+  }
+
+  var1 = ((q31_t) (((q63_t) temp1 * var1) >> 31)) << 1;
+
+  return (var1 >> (signBits1 / 2));
+}
+
 /**        
  * @brief  Q31 complex magnitude        
  * @param  *pSrc points to the complex input vector        
@@ -62,6 +101,7 @@
  * \par        
  * The function implements 1.31 by 1.31 multiplications and finally output is converted into 2.30 format.        
  * Input down scaling is not required.        
+ * The square root is the integer Newton-Raphson one of riscv_sqrt_q31(), inlined.
  */
 
 void riscv_cmplx_mag_q31(
@@ -69,6 +109,7 @@ void riscv_cmplx_mag_q31(
   q31_t * pDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_mag_q31);
   q31_t real, imag;                              /* Temporary variables to hold input values */
   q31_t acc0, acc1;                              /* Accumulators */
   uint32_t blkCnt;                               /* loop counter */
@@ -83,7 +124,7 @@ void riscv_cmplx_mag_q31(
     acc0 = (q31_t) (((q63_t) real * real) >> 33);
     acc1 = (q31_t) (((q63_t) imag * imag) >> 33);
     /* store the result in 2.30 format in the destination buffer. */
-    riscv_sqrt_q31(acc0 + acc1, pDst++);
+    *pDst++ = riscv_cmplx_mag_sqrt_q31(acc0 + acc1);
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -88,6 +88,7 @@ void riscv_cmplx_mag_squared_f32(
   float32_t * pDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_mag_squared_f32);
   float32_t real, imag;                          /* Temporary variables to store real and imaginary values */
   uint32_t blkCnt;                               /* loop counter */
 
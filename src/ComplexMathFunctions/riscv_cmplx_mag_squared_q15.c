@@ -61,6 +61,9 @@
  * <b>Scaling and Overflow Behavior:</b>    
  * \par    
  * The function implements 1.15 by 1.15 multiplications and finally output is converted into 3.13 format.    
+ * \par
+ * With the xpulp extensions the squares of the real and imaginary parts are summed with one
+ * <code>pv.dotsp.h</code>, whose 32-bit sum wraps when both parts are -1.0.
  */
 
 void riscv_cmplx_mag_squared_q15(
@@ -68,6 +71,7 @@ void riscv_cmplx_mag_squared_q15(
   q15_t * pDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_mag_squared_q15);
   q31_t acc0, acc1;                              /* Accumulators */
 
   q15_t real, imag;                              /* Temporary variables to store real and imaginary values */
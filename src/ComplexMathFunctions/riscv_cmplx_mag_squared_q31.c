@@ -63,6 +63,9 @@
  * \par    
  * The function implements 1.31 by 1.31 multiplications and finally output is converted into 3.29 format.    
  * Input down scaling is not required.    
+ * \par
+ * With the DSP extension the upper words of the two squares are added and halved with rounding,
+ * one shift instead of two, so the outputs may differ by one LSB from the plain C path.
  */
 
 void riscv_cmplx_mag_squared_q31(
@@ -70,7 +73,25 @@ void riscv_cmplx_mag_squared_q31(
   q31_t * pDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_mag_squared_q31);
   q31_t real, imag;                              /* Temporary variables to store real and imaginary values */
+#if defined (USE_DSP_RISCV)
+  uint32_t acc0, acc1;                           /* Upper words of the squares */
+
+  while(numSamples > 0u)
+  {
+    /* out = ((real * real) + (imag * imag)) */
+    real = *pSrc++;
+    imag = *pSrc++;
+    acc0 = (uint32_t) (((q63_t) real * real) >> 32);
+    acc1 = (uint32_t) (((q63_t) imag * imag) >> 32);
+    /* The squares are at most 2^30 each, so the unsigned sum cannot wrap */
+    *pDst++ = (q31_t) ((acc0 + acc1 + 1u) >> 1);
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+#else
   q31_t acc0, acc1;                              /* Accumulators */
 
   while(numSamples > 0u)
@@ -86,6 +107,7 @@ void riscv_cmplx_mag_squared_q31(
     /* Decrement the loop counter */
     numSamples--;
   }
+#endif /* #if defined (USE_DSP_RISCV) */
 
 }
 
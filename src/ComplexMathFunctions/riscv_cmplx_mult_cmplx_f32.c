@@ -88,6 +88,7 @@ void riscv_cmplx_mult_cmplx_f32(
   float32_t * pDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_mult_cmplx_f32);
   float32_t a1, b1, c1, d1;                      /* Temporary variables to store real and imaginary values */
   uint32_t blkCnt;                               /* loop counters */
   blkCnt = numSamples;
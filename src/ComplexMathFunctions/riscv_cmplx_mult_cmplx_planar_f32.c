@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_mult_cmplx_planar_f32.c
+*
+* Description:  Floating-point complex-by-complex multiplication on planar data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxByCmplxMult
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex-by-complex multiplication on planar data.
+ * @param  *pSrcARe points to the real parts of the first input
+ * @param  *pSrcAIm points to the imaginary parts of the first input
+ * @param  *pSrcBRe points to the real parts of the second input
+ * @param  *pSrcBIm points to the imaginary parts of the second input
+ * @param  *pDstRe points to the real parts of the output
+ * @param  *pDstIm points to the imaginary parts of the output
+ * @param  numSamples number of complex samples in each vector
+ * @return none.
+ */
+
+void riscv_cmplx_mult_cmplx_planar_f32(
+  float32_t * pSrcARe,
+  float32_t * pSrcAIm,
+  float32_t * pSrcBRe,
+  float32_t * pSrcBIm,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_mult_cmplx_planar_f32);
+  float32_t a, b, c, d;                          /* Real and imaginary parts of A and B */
+
+  while(numSamples > 0u)
+  {
+    /* C = (a * c - b * d) + j (a * d + b * c) */
+    a = *pSrcARe++;
+    b = *pSrcAIm++;
+    c = *pSrcBRe++;
+    d = *pSrcBIm++;
+
+    *pDstRe++ = (a * c) - (b * d);
+    *pDstIm++ = (a * d) + (b * c);
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+}
+
+/**
+ * @} end of CmplxByCmplxMult group
+ */
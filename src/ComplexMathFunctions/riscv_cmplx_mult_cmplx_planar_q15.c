@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_mult_cmplx_planar_q15.c
+*
+* Description:  Q15 complex-by-complex multiplication on planar data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxByCmplxMult
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex-by-complex multiplication on planar data.
+ * @param  *pSrcARe points to the real parts of the first input
+ * @param  *pSrcAIm points to the imaginary parts of the first input
+ * @param  *pSrcBRe points to the real parts of the second input
+ * @param  *pSrcBIm points to the imaginary parts of the second input
+ * @param  *pDstRe points to the real parts of the output
+ * @param  *pDstIm points to the imaginary parts of the output
+ * @param  numSamples number of complex samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The output is in 3.13 format, as riscv_cmplx_mult_cmplx_q15().
+ */
+
+void riscv_cmplx_mult_cmplx_planar_q15(
+  q15_t * pSrcARe,
+  q15_t * pSrcAIm,
+  q15_t * pSrcBRe,
+  q15_t * pSrcBIm,
+  q15_t * pDstRe,
+  q15_t * pDstIm,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_mult_cmplx_planar_q15);
+  q15_t a, b, c, d;                              /* Real and imaginary parts of A and B */
+
+  while(numSamples > 0u)
+  {
+    /* C = (a * c - b * d) + j (a * d + b * c) */
+    a = *pSrcARe++;
+    b = *pSrcAIm++;
+    c = *pSrcBRe++;
+    d = *pSrcBIm++;
+
+#if defined (USE_DSP_RISCV)
+    *pDstRe++ = (q15_t) ((q31_t) mulsN(a, c, 17) - (q31_t) mulsN(b, d, 17));
+    *pDstIm++ = (q15_t) ((q31_t) mulsN(a, d, 17) + (q31_t) mulsN(b, c, 17));
+#else
+    *pDstRe++ = (q15_t) ((((q31_t) a * c) >> 17) - (((q31_t) b * d) >> 17));
+    *pDstIm++ = (q15_t) ((((q31_t) a * d) >> 17) + (((q31_t) b * c) >> 17));
+#endif
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+}
+
+/**
+ * @} end of CmplxByCmplxMult group
+ */
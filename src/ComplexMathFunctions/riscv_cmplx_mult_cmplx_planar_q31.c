@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_mult_cmplx_planar_q31.c
+*
+* Description:  Q31 complex-by-complex multiplication on planar data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxByCmplxMult
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex-by-complex multiplication on planar data.
+ * @param  *pSrcARe points to the real parts of the first input
+ * @param  *pSrcAIm points to the imaginary parts of the first input
+ * @param  *pSrcBRe points to the real parts of the second input
+ * @param  *pSrcBIm points to the imaginary parts of the second input
+ * @param  *pDstRe points to the real parts of the output
+ * @param  *pDstIm points to the imaginary parts of the output
+ * @param  numSamples number of complex samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The output is in 3.29 format, as riscv_cmplx_mult_cmplx_q31().
+ */
+
+void riscv_cmplx_mult_cmplx_planar_q31(
+  q31_t * pSrcARe,
+  q31_t * pSrcAIm,
+  q31_t * pSrcBRe,
+  q31_t * pSrcBIm,
+  q31_t * pDstRe,
+  q31_t * pDstIm,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_mult_cmplx_planar_q31);
+  q31_t a, b, c, d;                              /* Real and imaginary parts of A and B */
+
+  while(numSamples > 0u)
+  {
+    /* C = (a * c - b * d) + j (a * d + b * c) */
+    a = *pSrcARe++;
+    b = *pSrcAIm++;
+    c = *pSrcBRe++;
+    d = *pSrcBIm++;
+
+#if defined (USE_DSP_RISCV)
+    *pDstRe++ = subnr((q31_t) (((q63_t) a * c) >> 32), (q31_t) (((q63_t) b * d) >> 32), 1, 1);
+    *pDstIm++ = addnr((q31_t) (((q63_t) a * d) >> 32), (q31_t) (((q63_t) b * c) >> 32), 1, 1);
+#else
+    *pDstRe++ = ((q31_t) (((q63_t) a * c) >> 32) >> 1) - ((q31_t) (((q63_t) b * d) >> 32) >> 1);
+    *pDstIm++ = ((q31_t) (((q63_t) a * d) >> 32) >> 1) + ((q31_t) (((q63_t) b * c) >> 32) >> 1);
+#endif
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+}
+
+/**
+ * @} end of CmplxByCmplxMult group
+ */
@@ -70,6 +70,7 @@ void riscv_cmplx_mult_cmplx_q15(
   q15_t * pDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_mult_cmplx_q15);
   q15_t a, b, c, d;                              /* Temporary variables to store real and imaginary values */
 #if defined (USE_DSP_RISCV)
 
@@ -64,6 +64,11 @@
  * \par    
  * The function implements 1.31 by 1.31 multiplications and finally output is converted into 3.29 format.    
  * Input down scaling is not required.    
+ * \par
+ * With the DSP extension the upper words of the products are combined and halved by one rounding
+ * <code>p.addRN</code> or <code>p.subRN</code> instead of two truncating shifts, so the outputs may
+ * differ by one LSB from the plain C path.  The sum wraps when both products of the real or of the
+ * imaginary part are 1.0, as in <code>(-1 - 1j) * (-1 - 1j)</code>.
  */
 
 void riscv_cmplx_mult_cmplx_q31(
@@ -72,8 +77,54 @@ void riscv_cmplx_mult_cmplx_q31(
   q31_t * pDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_mult_cmplx_q31);
   q31_t a, b, c, d;                              /* Temporary variables to store real and imaginary values */
   uint32_t blkCnt;                               /* loop counters */
+
+#if defined (USE_DSP_RISCV)
+
+  q31_t a1, b1, c1, d1;                          /* Second sample of a pass */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    a = pSrcA[0];
+    b = pSrcA[1];
+    a1 = pSrcA[2];
+    b1 = pSrcA[3];
+    c = pSrcB[0];
+    d = pSrcB[1];
+    c1 = pSrcB[2];
+    d1 = pSrcB[3];
+    pSrcA += 4;
+    pSrcB += 4;
+
+    /* mulh gives the 2.30 upper words, subRN/addRN the rounded 3.29 sums */
+    pDst[0] = subnr((q31_t) (((q63_t) a * c) >> 32), (q31_t) (((q63_t) b * d) >> 32), 1, 1);
+    pDst[1] = addnr((q31_t) (((q63_t) a * d) >> 32), (q31_t) (((q63_t) b * c) >> 32), 1, 1);
+    pDst[2] = subnr((q31_t) (((q63_t) a1 * c1) >> 32), (q31_t) (((q63_t) b1 * d1) >> 32), 1, 1);
+    pDst[3] = addnr((q31_t) (((q63_t) a1 * d1) >> 32), (q31_t) (((q63_t) b1 * c1) >> 32), 1, 1);
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  if((numSamples & 0x1u) != 0u)
+  {
+    a = pSrcA[0];
+    b = pSrcA[1];
+    c = pSrcB[0];
+    d = pSrcB[1];
+
+    pDst[0] = subnr((q31_t) (((q63_t) a * c) >> 32), (q31_t) (((q63_t) b * d) >> 32), 1, 1);
+    pDst[1] = addnr((q31_t) (((q63_t) a * d) >> 32), (q31_t) (((q63_t) b * c) >> 32), 1, 1);
+  }
+
+#else
+
   q31_t mul1, mul2, mul3, mul4;
   q31_t out1, out2;
 
@@ -171,6 +222,8 @@ void riscv_cmplx_mult_cmplx_q31(
     blkCnt--;
   }
 
+#endif /* #if defined (USE_DSP_RISCV) */
+
 }
 
 /**    
@@ -90,6 +90,7 @@ void riscv_cmplx_mult_real_f32(
   float32_t * pCmplxDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_mult_real_f32);
   float32_t in;                                  /* Temporary variable to store input value */
   uint32_t blkCnt;                               /* loop counters */
   blkCnt = numSamples;
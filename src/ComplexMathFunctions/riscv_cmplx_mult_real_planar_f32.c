@@ -0,0 +1,56 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_mult_real_planar_f32.c
+*
+* Description:  Floating-point complex-by-real multiplication on planar data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxByRealMult
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex-by-real multiplication on planar data.
+ * @param  *pSrcRe points to the real parts of the complex input
+ * @param  *pSrcIm points to the imaginary parts of the complex input
+ * @param  *pSrcReal points to the real input
+ * @param  *pDstRe points to the real parts of the output
+ * @param  *pDstIm points to the imaginary parts of the output
+ * @param  numSamples number of samples in each vector
+ * @return none.
+ */
+
+void riscv_cmplx_mult_real_planar_f32(
+  float32_t * pSrcRe,
+  float32_t * pSrcIm,
+  float32_t * pSrcReal,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_mult_real_planar_f32);
+  float32_t in;                                  /* Real input */
+
+  while(numSamples > 0u)
+  {
+    in = *pSrcReal++;
+    *pDstRe++ = *pSrcRe++ * in;
+    *pDstIm++ = *pSrcIm++ * in;
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+}
+
+/**
+ * @} end of CmplxByRealMult group
+ */
@@ -0,0 +1,65 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_mult_real_planar_q15.c
+*
+* Description:  Q15 complex-by-real multiplication on planar data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxByRealMult
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex-by-real multiplication on planar data.
+ * @param  *pSrcRe points to the real parts of the complex input
+ * @param  *pSrcIm points to the imaginary parts of the complex input
+ * @param  *pSrcReal points to the real input
+ * @param  *pDstRe points to the real parts of the output
+ * @param  *pDstIm points to the imaginary parts of the output
+ * @param  numSamples number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The results are saturated, as riscv_cmplx_mult_real_q15().
+ */
+
+void riscv_cmplx_mult_real_planar_q15(
+  q15_t * pSrcRe,
+  q15_t * pSrcIm,
+  q15_t * pSrcReal,
+  q15_t * pDstRe,
+  q15_t * pDstIm,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_mult_real_planar_q15);
+  q15_t in;                                      /* Real input */
+
+  while(numSamples > 0u)
+  {
+    in = *pSrcReal++;
+#if defined (USE_DSP_RISCV)
+    *pDstRe++ = (q15_t) clip(mulsN(*pSrcRe++, in, 15), -32768, 32767);
+    *pDstIm++ = (q15_t) clip(mulsN(*pSrcIm++, in, 15), -32768, 32767);
+#else
+    *pDstRe++ = (q15_t) __SSAT((((q31_t) *pSrcRe++ * in) >> 15), 16);
+    *pDstIm++ = (q15_t) __SSAT((((q31_t) *pSrcIm++ * in) >> 15), 16);
+#endif
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+}
+
+/**
+ * @} end of CmplxByRealMult group
+ */
@@ -0,0 +1,60 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_mult_real_planar_q31.c
+*
+* Description:  Q31 complex-by-real multiplication on planar data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxByRealMult
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex-by-real multiplication on planar data.
+ * @param  *pSrcRe points to the real parts of the complex input
+ * @param  *pSrcIm points to the imaginary parts of the complex input
+ * @param  *pSrcReal points to the real input
+ * @param  *pDstRe points to the real parts of the output
+ * @param  *pDstIm points to the imaginary parts of the output
+ * @param  numSamples number of samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The results are saturated, as riscv_cmplx_mult_real_q31().
+ */
+
+void riscv_cmplx_mult_real_planar_q31(
+  q31_t * pSrcRe,
+  q31_t * pSrcIm,
+  q31_t * pSrcReal,
+  q31_t * pDstRe,
+  q31_t * pDstIm,
+  uint32_t numSamples)
+{
+  RISCV_PROFILE(riscv_cmplx_mult_real_planar_q31);
+  q31_t in;                                      /* Real input */
+
+  while(numSamples > 0u)
+  {
+    in = *pSrcReal++;
+    *pDstRe++ = (q31_t) clip_q63_to_q31(((q63_t) *pSrcRe++ * in) >> 31);
+    *pDstIm++ = (q31_t) clip_q63_to_q31(((q63_t) *pSrcIm++ * in) >> 31);
+
+    /* Decrement the loop counter */
+    numSamples--;
+  }
+}
+
+/**
+ * @} end of CmplxByRealMult group
+ */
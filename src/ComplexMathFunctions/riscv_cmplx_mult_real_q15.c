@@ -72,6 +72,7 @@ void riscv_cmplx_mult_real_q15(
   q15_t * pCmplxDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_mult_real_q15);
   q15_t in;                                      /* Temporary variable to store input value */
 
 #if defined (USE_DSP_RISCV)
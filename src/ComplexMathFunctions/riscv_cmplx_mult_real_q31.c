@@ -72,6 +72,7 @@ void riscv_cmplx_mult_real_q31(
   q31_t * pCmplxDst,
   uint32_t numSamples)
 {
+  RISCV_PROFILE(riscv_cmplx_mult_real_q31);
   q31_t inA1;                                    /* Temporary variable to store input value */
   while(numSamples > 0u)
   {
@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_foc_step_f32.c
+*
+* Description:  Floating-point field-oriented control step, Clarke,
+*               Park, PID, inverse Park and inverse Clarke in one call.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Floating-point field-oriented control step.
+ * @param[in,out] *S      points to an instance of the floating-point FOC structure.
+ * @param[in]     Ia      measured phase current a.
+ * @param[in]     Ib      measured phase current b.
+ * @param[in]     theta   rotor flux angle in degrees.
+ * @param[in]     IdRef   reference of the d current.
+ * @param[in]     IqRef   reference of the q current.
+ * @param[out]    *pVa    points to the phase voltage a.
+ * @param[out]    *pVb    points to the phase voltage b.
+ * @return none.
+ */
+
+void riscv_foc_step_f32(
+  riscv_foc_instance_f32 * S,
+  float32_t Ia,
+  float32_t Ib,
+  float32_t theta,
+  float32_t IdRef,
+  float32_t IqRef,
+  float32_t * pVa,
+  float32_t * pVb)
+{
+  RISCV_PROFILE(riscv_foc_step_f32);
+  float32_t sinVal, cosVal;                      /* Sine and cosine of the rotor angle */
+  float32_t Ibeta;                               /* Stator current, Ialpha = Ia */
+  float32_t Id, Iq;                              /* Rotor current */
+  float32_t Vd, Vq;                              /* Rotor voltage */
+  float32_t Valpha, Vbeta;                       /* Stator voltage */
+
+  riscv_sin_cos_f32(theta, &sinVal, &cosVal);
+
+  /* Ibeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+  Ibeta = (float32_t) 0.57735026919 * Ia + (float32_t) 1.15470053838 * Ib;
+
+  /* Id = Ialpha * cosVal + Ibeta * sinVal, Iq = - Ialpha * sinVal + Ibeta * cosVal */
+  Id = Ia * cosVal + Ibeta * sinVal;
+  Iq = -Ia * sinVal + Ibeta * cosVal;
+
+  S->Id = Id;
+  S->Iq = Iq;
+
+  /* Current controllers */
+  Vd = riscv_pid_f32(&S->pidD, IdRef - Id);
+  Vq = riscv_pid_f32(&S->pidQ, IqRef - Iq);
+
+  /* Valpha = Vd * cosVal - Vq * sinVal, Vbeta = Vd * sinVal + Vq * cosVal */
+  Valpha = Vd * cosVal - Vq * sinVal;
+  Vbeta = Vd * sinVal + Vq * cosVal;
+
+  /* Va = Valpha, Vb = -(1/2) * Valpha + (sqrt(3)/2) * Vbeta */
+  *pVa = Valpha;
+  *pVb = (float32_t) -0.5 * Valpha + (float32_t) 0.8660254039 * Vbeta;
+}
+
+/**
+ * @} end of FOC group
+ */
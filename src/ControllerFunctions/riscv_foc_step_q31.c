@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_foc_step_q31.c
+*
+* Description:  Q31 field-oriented control step, Clarke, Park, PID,
+*               inverse Park and inverse Clarke transforms in one call.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup FOC Field-Oriented Control Step
+ *
+ * One step of the current loop of a field-oriented motor controller:
+ * <pre>
+ *    Ialpha, Ibeta = clarke(Ia, Ib)
+ *    Id, Iq        = park(Ialpha, Ibeta, sin(theta), cos(theta))
+ *    Vd            = pid(pidD, IdRef - Id)
+ *    Vq            = pid(pidQ, IqRef - Iq)
+ *    Valpha, Vbeta = inv_park(Vd, Vq, sin(theta), cos(theta))
+ *    Va, Vb        = inv_clarke(Valpha, Vbeta)
+ * </pre>
+ * The functions compute the sine and cosine once and keep all intermediate values in local
+ * variables, where the separate clarke, park, PID and inverse functions pass them through pointers.
+ * The measured <code>Id</code> and <code>Iq</code> are stored in the instance for monitoring.
+ * \par
+ * The controllers <code>pidD</code> and <code>pidQ</code> in the instance are set up with
+ * riscv_pid_init_f32() or riscv_pid_init_q31() like stand-alone controllers.
+ */
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Q31 field-oriented control step.
+ * @param[in,out] *S      points to an instance of the Q31 FOC structure.
+ * @param[in]     Ia      measured phase current a.
+ * @param[in]     Ib      measured phase current b.
+ * @param[in]     theta   rotor flux angle, [-1 0.9999] maps to [-180 180) degrees.
+ * @param[in]     IdRef   reference of the d current.
+ * @param[in]     IqRef   reference of the q current.
+ * @param[out]    *pVa    points to the phase voltage a.
+ * @param[out]    *pVb    points to the phase voltage b.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are truncated to 1.31 format as in riscv_clarke_q31(), riscv_park_q31(), riscv_inv_park_q31()
+ * and riscv_inv_clarke_q31(), and the controllers behave as riscv_pid_q31().  The sums of two products
+ * and the errors <code>IdRef - Id</code> and <code>IqRef - Iq</code> are saturated to 1.31 format,
+ * so the result equals the chain of the separate functions as long as none of them overflows.
+ */
+
+void riscv_foc_step_q31(
+  riscv_foc_instance_q31 * S,
+  q31_t Ia,
+  q31_t Ib,
+  q31_t theta,
+  q31_t IdRef,
+  q31_t IqRef,
+  q31_t * pVa,
+  q31_t * pVb)
+{
+  RISCV_PROFILE(riscv_foc_step_q31);
+  q31_t sinVal, cosVal;                          /* Sine and cosine of the rotor angle */
+  q31_t Ibeta;                                   /* Stator current, Ialpha = Ia */
+  q31_t Id, Iq;                                  /* Rotor current */
+  q31_t Vd, Vq;                                  /* Rotor voltage */
+  q31_t Valpha, Vbeta;                           /* Stator voltage */
+
+  riscv_sin_cos_q31(theta, &sinVal, &cosVal);
+
+  /* Ibeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+  Ibeta = clip_q63_to_q31((q63_t) (q31_t) (((q63_t) Ia * 0x24F34E8B) >> 30) +
+                          (q31_t) (((q63_t) Ib * 0x49E69D16) >> 30));
+
+  /* Id = Ialpha * cosVal + Ibeta * sinVal, Iq = - Ialpha * sinVal + Ibeta * cosVal */
+  Id = clip_q63_to_q31((q63_t) (q31_t) (((q63_t) Ia * cosVal) >> 31) +
+                       (q31_t) (((q63_t) Ibeta * sinVal) >> 31));
+  Iq = clip_q63_to_q31((q63_t) (q31_t) (((q63_t) Ibeta * cosVal) >> 31) -
+                       (q31_t) (((q63_t) Ia * sinVal) >> 31));
+
+  S->Id = Id;
+  S->Iq = Iq;
+
+  /* Current controllers */
+  Vd = riscv_pid_q31(&S->pidD, clip_q63_to_q31((q63_t) IdRef - Id));
+  Vq = riscv_pid_q31(&S->pidQ, clip_q63_to_q31((q63_t) IqRef - Iq));
+
+  /* Valpha = Vd * cosVal - Vq * sinVal, Vbeta = Vd * sinVal + Vq * cosVal */
+  Valpha = clip_q63_to_q31((q63_t) (q31_t) (((q63_t) Vd * cosVal) >> 31) -
+                           (q31_t) (((q63_t) Vq * sinVal) >> 31));
+  Vbeta = clip_q63_to_q31((q63_t) (q31_t) (((q63_t) Vq * cosVal) >> 31) +
+                          (q31_t) (((q63_t) Vd * sinVal) >> 31));
+
+  /* Va = Valpha, Vb = -(1/2) * Valpha + (sqrt(3)/2) * Vbeta */
+  *pVa = Valpha;
+  *pVb = clip_q63_to_q31((q63_t) (q31_t) (((q63_t) Vbeta * 0x6ED9EBA1) >> 31) -
+                         (q31_t) (((q63_t) Valpha * 0x40000000) >> 31));
+}
+
+/**
+ * @} end of FOC group
+ */
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pid_batch_f32.c
+*
+* Description:  Process function for a batch of floating-point PID
+*               controllers.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Process function for a batch of floating-point PID controllers.
+ * @param[in]  *S     points to an instance of the floating-point PID batch structure.
+ * @param[in]  *pSrc  points to the <code>numLoops</code> inputs, one per controller.
+ * @param[out] *pDst  points to the <code>numLoops</code> outputs, one per controller, may be equal to <code>pSrc</code>.
+ * @return none.
+ *
+ * \par
+ * Without limits the output of controller <code>k</code> equals the output of riscv_pid_f32() with the same gains.
+ */
+
+void riscv_pid_batch_f32(
+  const riscv_pid_batch_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_pid_batch_f32);
+  uint32_t numLoops = S->numLoops;               /* Number of controllers */
+  const float32_t *pA0 = S->pCoeffs;             /* Derived gains */
+  const float32_t *pA1 = pA0 + numLoops;
+  const float32_t *pA2 = pA1 + numLoops;
+  float32_t *pX1 = S->pState;                    /* States x[n-1], x[n-2] and y[n-1] */
+  float32_t *pX2 = pX1 + numLoops;
+  float32_t *pY = pX2 + numLoops;
+  const float32_t *pLimits = S->pLimits;         /* Output limits */
+  float32_t in, out;
+  uint32_t k;                                    /* loop counter */
+
+  for (k = 0u; k < numLoops; k++)
+  {
+    in = pSrc[k];
+
+    /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]  */
+    out = (pA0[k] * in) + (pA1[k] * pX1[k]) + (pA2[k] * pX2[k]) + pY[k];
+
+    /* Clamp before the output becomes y[n-1], which is the anti-windup */
+    if(pLimits != NULL)
+    {
+      if(out < pLimits[2u * k])
+      {
+        out = pLimits[2u * k];
+      }
+      else if(out > pLimits[(2u * k) + 1u])
+      {
+        out = pLimits[(2u * k) + 1u];
+      }
+    }
+
+    /* Update state */
+    pX2[k] = pX1[k];
+    pX1[k] = in;
+    pY[k] = out;
+
+    pDst[k] = out;
+  }
+}
+
+/**
+ * @} end of PID group
+ */
@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pid_batch_init_f32.c
+*
+* Description:  Initialization function for a batch of floating-point
+*               PID controllers.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for a batch of floating-point PID controllers.
+ * @param[in,out] *S              points to an instance of the floating-point PID batch structure.
+ * @param[in]     numLoops        number of controllers.
+ * @param[in]     *pKp            points to the <code>numLoops</code> proportional gains.
+ * @param[in]     *pKi            points to the <code>numLoops</code> integral gains.
+ * @param[in]     *pKd            points to the <code>numLoops</code> derivative gains.
+ * @param[out]    *pCoeffs        points to a buffer of <code>3*numLoops</code> words that receives the derived gains.
+ * @param[in]     *pState         points to a buffer of <code>3*numLoops</code> words for the states.
+ * @param[in]     *pLimits        points to <code>numLoops</code> pairs {lower, upper} of output limits, or NULL.
+ * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state 1 = reset the state.
+ * @return none.
+ *
+ * \par
+ * The derived gains are computed as in riscv_pid_init_f32().  The gains may be changed by calling the
+ * function again with <code>resetStateFlag</code> 0.
+ */
+
+void riscv_pid_batch_init_f32(
+  riscv_pid_batch_instance_f32 * S,
+  uint16_t numLoops,
+  const float32_t * pKp,
+  const float32_t * pKi,
+  const float32_t * pKd,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pLimits,
+  int32_t resetStateFlag)
+{
+  RISCV_PROFILE(riscv_pid_batch_init_f32);
+  uint32_t k;                                    /* loop counter */
+
+  for (k = 0u; k < numLoops; k++)
+  {
+    /* Derived coefficients A0, A1 and A2 */
+    pCoeffs[k] = pKp[k] + pKi[k] + pKd[k];
+    pCoeffs[numLoops + k] = (-pKp[k]) - ((float32_t) 2.0 * pKd[k]);
+    pCoeffs[(2u * numLoops) + k] = pKd[k];
+  }
+
+  S->numLoops = numLoops;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pLimits = pLimits;
+
+  /* Check whether state needs reset or not */
+  if(resetStateFlag)
+  {
+    riscv_pid_batch_reset_f32(S);
+  }
+}
+
+/**
+ * @} end of PID group
+ */
@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pid_batch_init_q15.c
+*
+* Description:  Initialization function for a batch of Q15 PID
+*               controllers.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for a batch of Q15 PID controllers.
+ * @param[in,out] *S              points to an instance of the Q15 PID batch structure.
+ * @param[in]     numLoops        number of controllers.
+ * @param[in]     *pKp            points to the <code>numLoops</code> proportional gains.
+ * @param[in]     *pKi            points to the <code>numLoops</code> integral gains.
+ * @param[in]     *pKd            points to the <code>numLoops</code> derivative gains.
+ * @param[out]    *pCoeffs        points to a buffer of <code>3*numLoops</code> values that receives the derived gains.
+ * @param[in]     *pState         points to a buffer of <code>3*numLoops</code> values for the states.
+ * @param[in]     *pLimits        points to <code>numLoops</code> pairs {lower, upper} of output limits, or NULL.
+ * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state 1 = reset the state.
+ * @return none.
+ *
+ * \par
+ * The derived gains are computed and saturated as in riscv_pid_init_q15().  <code>pCoeffs</code> and
+ * <code>pState</code> must be 4-byte aligned, the pairs {A1, A2} and {x[n-1], x[n-2]} are loaded as one word.
+ */
+
+void riscv_pid_batch_init_q15(
+  riscv_pid_batch_instance_q15 * S,
+  uint16_t numLoops,
+  const q15_t * pKp,
+  const q15_t * pKi,
+  const q15_t * pKd,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  q15_t * pLimits,
+  int32_t resetStateFlag)
+{
+  RISCV_PROFILE(riscv_pid_batch_init_q15);
+  q31_t temp;                                    /*to store the sum */
+  uint32_t k;                                    /* loop counter */
+
+  for (k = 0u; k < numLoops; k++)
+  {
+#if defined (USE_DSP_RISCV)
+    temp = pKp[k] + pKi[k] + pKd[k];
+    pCoeffs[(2u * numLoops) + k] = (q15_t) clip(temp, -32768, 32767);
+    temp = -(pKd[k] + pKd[k] + pKp[k]);
+    *(shortV *) (pCoeffs + (2u * k)) = pack2(clip(temp, -32768, 32767), pKd[k]);
+#else
+    /* Derived coefficient A0 */
+    temp = pKp[k] + pKi[k] + pKd[k];
+    pCoeffs[(2u * numLoops) + k] = (q15_t) __SSAT(temp, 16);
+
+    /* Derived coefficients A1 and A2 */
+    temp = -(pKd[k] + pKd[k] + pKp[k]);
+    pCoeffs[2u * k] = (q15_t) __SSAT(temp, 16);
+    pCoeffs[(2u * k) + 1u] = pKd[k];
+#endif
+  }
+
+  S->numLoops = numLoops;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pLimits = pLimits;
+
+  /* Check whether state needs reset or not */
+  if(resetStateFlag)
+  {
+    riscv_pid_batch_reset_q15(S);
+  }
+}
+
+/**
+ * @} end of PID group
+ */
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pid_batch_init_q31.c
+*
+* Description:  Initialization function for a batch of Q31 PID
+*               controllers.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for a batch of Q31 PID controllers.
+ * @param[in,out] *S              points to an instance of the Q31 PID batch structure.
+ * @param[in]     numLoops        number of controllers.
+ * @param[in]     *pKp            points to the <code>numLoops</code> proportional gains.
+ * @param[in]     *pKi            points to the <code>numLoops</code> integral gains.
+ * @param[in]     *pKd            points to the <code>numLoops</code> derivative gains.
+ * @param[out]    *pCoeffs        points to a buffer of <code>3*numLoops</code> words that receives the derived gains.
+ * @param[in]     *pState         points to a buffer of <code>3*numLoops</code> words for the states.
+ * @param[in]     *pLimits        points to <code>numLoops</code> pairs {lower, upper} of output limits, or NULL.
+ * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state 1 = reset the state.
+ * @return none.
+ *
+ * \par
+ * The derived gains are computed and saturated as in riscv_pid_init_q31().
+ */
+
+void riscv_pid_batch_init_q31(
+  riscv_pid_batch_instance_q31 * S,
+  uint16_t numLoops,
+  const q31_t * pKp,
+  const q31_t * pKi,
+  const q31_t * pKd,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pLimits,
+  int32_t resetStateFlag)
+{
+  RISCV_PROFILE(riscv_pid_batch_init_q31);
+  q31_t temp;
+  uint32_t k;                                    /* loop counter */
+
+  for (k = 0u; k < numLoops; k++)
+  {
+    /* Derived coefficient A0 */
+    temp = clip_q63_to_q31((q63_t) pKp[k] + pKi[k]);
+    pCoeffs[k] = clip_q63_to_q31((q63_t) temp + pKd[k]);
+
+    /* Derived coefficient A1 */
+    temp = clip_q63_to_q31((q63_t) pKd[k] + pKd[k]);
+    pCoeffs[numLoops + k] = -clip_q63_to_q31((q63_t) temp + pKp[k]);
+
+    /* Derived coefficient A2 */
+    pCoeffs[(2u * numLoops) + k] = pKd[k];
+  }
+
+  S->numLoops = numLoops;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pLimits = pLimits;
+
+  /* Check whether state needs reset or not */
+  if(resetStateFlag)
+  {
+    riscv_pid_batch_reset_q31(S);
+  }
+}
+
+/**
+ * @} end of PID group
+ */
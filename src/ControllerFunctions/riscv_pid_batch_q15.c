@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pid_batch_q15.c
+*
+* Description:  Process function for a batch of Q15 PID controllers.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Process function for a batch of Q15 PID controllers.
+ * @param[in]  *S     points to an instance of the Q15 PID batch structure.
+ * @param[in]  *pSrc  points to the <code>numLoops</code> inputs, one per controller.
+ * @param[out] *pDst  points to the <code>numLoops</code> outputs, one per controller, may be equal to <code>pSrc</code>.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The accumulation and saturation follow riscv_pid_q15(), so without limits the output of controller
+ * <code>k</code> equals the output of riscv_pid_q15() with the same gains.
+ * With the DSP extension the contribution of <code>x[n-1]</code> and <code>x[n-2]</code> is one
+ * <code>dotpv2</code> of the pairs {A1, A2} and {x[n-1], x[n-2]}, and the updated pair is written back
+ * with one store.
+ */
+
+void riscv_pid_batch_q15(
+  const riscv_pid_batch_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_pid_batch_q15);
+  uint32_t numLoops = S->numLoops;               /* Number of controllers */
+  const q15_t *pA12 = S->pCoeffs;                /* Pairs {A1, A2} */
+  const q15_t *pA0 = pA12 + (2u * numLoops);     /* Derived gains A0 */
+  q15_t *pX = S->pState;                         /* Pairs {x[n-1], x[n-2]} */
+  q15_t *pY = pX + (2u * numLoops);              /* Previous outputs y[n-1] */
+  const q15_t *pLimits = S->pLimits;             /* Output limits */
+  q63_t acc;                                     /* Accumulator */
+  q15_t in, out;
+  uint32_t k;                                    /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+
+  shortV VectState;                              /* {x[n-1], x[n-2]} */
+
+  for (k = 0u; k < numLoops; k++)
+  {
+    in = pSrc[k];
+    VectState = *(shortV *) (pX + (2u * k));
+
+    /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] + y[n-1] */
+    acc = (q31_t) pA0[k] * in;
+    acc += dotpv2(*(shortV *) (pA12 + (2u * k)), VectState);
+    acc += (q31_t) pY[k] << 15;
+
+    out = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Clamp before the output becomes y[n-1], which is the anti-windup */
+    if(pLimits != NULL)
+    {
+      if(out < pLimits[2u * k])
+      {
+        out = pLimits[2u * k];
+      }
+      else if(out > pLimits[(2u * k) + 1u])
+      {
+        out = pLimits[(2u * k) + 1u];
+      }
+    }
+
+    /* Update state */
+    *(shortV *) (pX + (2u * k)) = pack2(in, VectState[0]);
+    pY[k] = out;
+
+    pDst[k] = out;
+  }
+
+#else
+
+  q15_t x1;                                      /* x[n-1] */
+
+  for (k = 0u; k < numLoops; k++)
+  {
+    in = pSrc[k];
+    x1 = pX[2u * k];
+
+    /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] + y[n-1] */
+    acc = (q31_t) pA0[k] * in;
+    acc += (q31_t) pA12[2u * k] * x1;
+    acc += (q31_t) pA12[(2u * k) + 1u] * pX[(2u * k) + 1u];
+    acc += (q31_t) pY[k] << 15;
+
+    /* saturate the output */
+    out = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Clamp before the output becomes y[n-1], which is the anti-windup */
+    if(pLimits != NULL)
+    {
+      if(out < pLimits[2u * k])
+      {
+        out = pLimits[2u * k];
+      }
+      else if(out > pLimits[(2u * k) + 1u])
+      {
+        out = pLimits[(2u * k) + 1u];
+      }
+    }
+
+    /* Update state */
+    pX[(2u * k) + 1u] = x1;
+    pX[2u * k] = in;
+    pY[k] = out;
+
+    pDst[k] = out;
+  }
+
+#endif
+}
+
+/**
+ * @} end of PID group
+ */
@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pid_batch_q31.c
+*
+* Description:  Process function for a batch of Q31 PID controllers.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Process function for a batch of Q31 PID controllers.
+ * @param[in]  *S     points to an instance of the Q31 PID batch structure.
+ * @param[in]  *pSrc  points to the <code>numLoops</code> inputs, one per controller.
+ * @param[out] *pDst  points to the <code>numLoops</code> outputs, one per controller, may be equal to <code>pSrc</code>.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are accumulated in a 64-bit accumulator in 2.62 format as in riscv_pid_q31().
+ * Unlike riscv_pid_q31(), the sum of the truncated accumulator and <code>y[n-1]</code> is saturated to
+ * 1.31 format instead of wrapping around, so an output at full scale stays there.
+ */
+
+void riscv_pid_batch_q31(
+  const riscv_pid_batch_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst)
+{
+  RISCV_PROFILE(riscv_pid_batch_q31);
+  uint32_t numLoops = S->numLoops;               /* Number of controllers */
+  const q31_t *pA0 = S->pCoeffs;                 /* Derived gains */
+  const q31_t *pA1 = pA0 + numLoops;
+  const q31_t *pA2 = pA1 + numLoops;
+  q31_t *pX1 = S->pState;                        /* States x[n-1], x[n-2] and y[n-1] */
+  q31_t *pX2 = pX1 + numLoops;
+  q31_t *pY = pX2 + numLoops;
+  const q31_t *pLimits = S->pLimits;             /* Output limits */
+  q63_t acc;                                     /* Accumulator */
+  q31_t in, out;
+  uint32_t k;                                    /* loop counter */
+
+  for (k = 0u; k < numLoops; k++)
+  {
+    in = pSrc[k];
+
+    /* acc = A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+    acc = (q63_t) pA0[k] * in;
+    acc += (q63_t) pA1[k] * pX1[k];
+    acc += (q63_t) pA2[k] * pX2[k];
+
+    /* convert output to 1.31 format and add y[n-1] */
+    out = clip_q63_to_q31((acc >> 31u) + pY[k]);
+
+    /* Clamp before the output becomes y[n-1], which is the anti-windup */
+    if(pLimits != NULL)
+    {
+      if(out < pLimits[2u * k])
+      {
+        out = pLimits[2u * k];
+      }
+      else if(out > pLimits[(2u * k) + 1u])
+      {
+        out = pLimits[(2u * k) + 1u];
+      }
+    }
+
+    /* Update state */
+    pX2[k] = pX1[k];
+    pX1[k] = in;
+    pY[k] = out;
+
+    pDst[k] = out;
+  }
+}
+
+/**
+ * @} end of PID group
+ */
@@ -0,0 +1,39 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pid_batch_reset_q15.c
+*
+* Description:  Reset function for a batch of Q15 PID controllers.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Reset function for a batch of Q15 PID controllers.
+ * @param[in] *S  points to an instance of the Q15 PID batch structure.
+ * @return none.
+ * \par Description:
+ * The function resets the states of all controllers to zeros.
+ */
+
+void riscv_pid_batch_reset_q15(
+  const riscv_pid_batch_instance_q15 * S)
+{
+  RISCV_PROFILE(riscv_pid_batch_reset_q15);
+  /* Reset state to zero, 3 samples per controller */
+  memset(S->pState, 0, 3u * S->numLoops * sizeof(q15_t));
+}
+
+/**
+ * @} end of PID group
+ */
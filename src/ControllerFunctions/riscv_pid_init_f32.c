@@ -65,6 +65,7 @@ void riscv_pid_init_f32(
   riscv_pid_instance_f32 * S,
   int32_t resetStateFlag)
 {
+  RISCV_PROFILE(riscv_pid_init_f32);
 
   /* Derived coefficient A0 */
   S->A0 = S->Kp + S->Ki + S->Kd;
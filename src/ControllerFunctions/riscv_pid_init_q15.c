@@ -64,6 +64,7 @@ void riscv_pid_init_q15(
   riscv_pid_instance_q15 * S,
   int32_t resetStateFlag)
 {
+  RISCV_PROFILE(riscv_pid_init_q15);
   q31_t temp;                                    /*to store the sum */
   /* Derived coefficient A0 */
 #if defined (USE_DSP_RISCV)
@@ -64,6 +64,7 @@ void riscv_pid_init_q31(
   riscv_pid_instance_q31 * S,
   int32_t resetStateFlag)
 {
+  RISCV_PROFILE(riscv_pid_init_q31);
   q31_t temp;
 
   /* Derived coefficient A0 */
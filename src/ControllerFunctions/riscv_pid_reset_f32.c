@@ -57,6 +57,7 @@
 void riscv_pid_reset_f32(
   riscv_pid_instance_f32 * S)
 {
+  RISCV_PROFILE(riscv_pid_reset_f32);
 
   /* Clear the state buffer.  The size will be always 3 samples */
   memset(S->state, 0, 3u * sizeof(float32_t));
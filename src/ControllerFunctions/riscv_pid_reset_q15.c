@@ -57,6 +57,7 @@
 void riscv_pid_reset_q15(
   riscv_pid_instance_q15 * S)
 {
+  RISCV_PROFILE(riscv_pid_reset_q15);
   /* Reset state to zero, The size will be always 3 samples */
   memset(S->state, 0, 3u * sizeof(q15_t));
 }
@@ -57,6 +57,7 @@
 void riscv_pid_reset_q31(
   riscv_pid_instance_q31 * S)
 {
+  RISCV_PROFILE(riscv_pid_reset_q31);
 
   /* Clear the state buffer.  The size will be always 3 samples */
   memset(S->state, 0, 3u * sizeof(q31_t));
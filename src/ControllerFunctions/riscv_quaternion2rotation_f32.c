@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_quaternion2rotation_f32.c
+*
+* Description:  Floating-point conversion of quaternions to rotation matrices.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point conversion of unit quaternions to 3x3 rotation matrices.
+ * @param[in]       *pQuat points to the unit quaternions
+ * @param[out]      *pDst points to the 9 arrays of <code>numQuaternions</code> matrix elements
+ * @param[in]       numQuaternions number of quaternions
+ * @return none.
+ *
+ * \par
+ * Array <code>3 r + c</code> of <code>pDst</code> holds element <code>(r, c)</code> of every matrix,
+ * the matrix rotates a column vector like riscv_quaternion_rotate_f32().
+ */
+
+void riscv_quaternion2rotation_f32(
+  const float32_t * pQuat,
+  float32_t * pDst,
+  uint32_t numQuaternions)
+{
+  RISCV_PROFILE(riscv_quaternion2rotation_f32);
+  const uint32_t n = numQuaternions;
+  float32_t w, x, y, z;                          /* Quaternion */
+  float32_t xx, yy, zz, xy, xz, yz, wx, wy, wz;  /* Products */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < n; i++)
+  {
+    w = pQuat[i];
+    x = pQuat[n + i];
+    y = pQuat[2u * n + i];
+    z = pQuat[3u * n + i];
+
+    xx = x * x;
+    yy = y * y;
+    zz = z * z;
+    xy = x * y;
+    xz = x * z;
+    yz = y * z;
+    wx = w * x;
+    wy = w * y;
+    wz = w * z;
+
+    pDst[i] = 1.0f - (2.0f * (yy + zz));
+    pDst[n + i] = 2.0f * (xy - wz);
+    pDst[2u * n + i] = 2.0f * (xz + wy);
+    pDst[3u * n + i] = 2.0f * (xy + wz);
+    pDst[4u * n + i] = 1.0f - (2.0f * (xx + zz));
+    pDst[5u * n + i] = 2.0f * (yz - wx);
+    pDst[6u * n + i] = 2.0f * (xz - wy);
+    pDst[7u * n + i] = 2.0f * (yz + wx);
+    pDst[8u * n + i] = 1.0f - (2.0f * (xx + yy));
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_quaternion2rotation_q31.c
+*
+* Description:  Q31 conversion of quaternions to rotation matrices.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Q31 conversion of unit quaternions to 3x3 rotation matrices.
+ * @param[in]       *pQuat points to the unit quaternions
+ * @param[out]      *pDst points to the 9 arrays of <code>numQuaternions</code> matrix elements
+ * @param[in]       numQuaternions number of quaternions
+ * @return none.
+ *
+ * \par
+ * Array <code>3 r + c</code> of <code>pDst</code> holds element <code>(r, c)</code> of every matrix,
+ * the matrix rotates a column vector like riscv_quaternion_rotate_q31().
+ * \par
+ * The elements are computed from 4.60 products in 64-bit and saturated to 1.31, so an element
+ * of 1.0 is returned as 0x7FFFFFFF.
+ */
+
+void riscv_quaternion2rotation_q31(
+  const q31_t * pQuat,
+  q31_t * pDst,
+  uint32_t numQuaternions)
+{
+  RISCV_PROFILE(riscv_quaternion2rotation_q31);
+  const uint32_t n = numQuaternions;
+  q63_t w, x, y, z;                              /* Quaternion */
+  q63_t xx, yy, zz, xy, xz, yz, wx, wy, wz;      /* Products in 4.60 */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < n; i++)
+  {
+    w = pQuat[i];
+    x = pQuat[n + i];
+    y = pQuat[2u * n + i];
+    z = pQuat[3u * n + i];
+
+    xx = (x * x) >> 2;
+    yy = (y * y) >> 2;
+    zz = (z * z) >> 2;
+    xy = (x * y) >> 2;
+    xz = (x * z) >> 2;
+    yz = (y * z) >> 2;
+    wx = (w * x) >> 2;
+    wy = (w * y) >> 2;
+    wz = (w * z) >> 2;
+
+    pDst[i] = clip_q63_to_q31(0x80000000LL - ((yy + zz) >> 28));
+    pDst[n + i] = clip_q63_to_q31((xy - wz) >> 28);
+    pDst[2u * n + i] = clip_q63_to_q31((xz + wy) >> 28);
+    pDst[3u * n + i] = clip_q63_to_q31((xy + wz) >> 28);
+    pDst[4u * n + i] = clip_q63_to_q31(0x80000000LL - ((xx + zz) >> 28));
+    pDst[5u * n + i] = clip_q63_to_q31((yz - wx) >> 28);
+    pDst[6u * n + i] = clip_q63_to_q31((xz - wy) >> 28);
+    pDst[7u * n + i] = clip_q63_to_q31((yz + wx) >> 28);
+    pDst[8u * n + i] = clip_q63_to_q31(0x80000000LL - ((xx + yy) >> 28));
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
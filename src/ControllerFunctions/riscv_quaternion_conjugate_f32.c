@@ -0,0 +1,55 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_quaternion_conjugate_f32.c
+*
+* Description:  Floating-point conjugate of quaternions.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point conjugate of quaternions.
+ * @param[in]       *pSrc points to the quaternions
+ * @param[out]      *pDst points to the conjugates <code>w - x i - y j - z k</code>
+ * @param[in]       numQuaternions number of quaternions
+ * @return none.
+ *
+ * \par
+ * The conjugate of a unit quaternion is its inverse, the opposite rotation.
+ * <code>pDst</code> may be the same buffer as <code>pSrc</code>.
+ */
+
+void riscv_quaternion_conjugate_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numQuaternions)
+{
+  RISCV_PROFILE(riscv_quaternion_conjugate_f32);
+  uint32_t i;                                    /* loop counter */
+
+  if(pDst != pSrc)
+  {
+    memcpy(pDst, pSrc, numQuaternions * sizeof(float32_t));
+  }
+
+  /* The x, y and z arrays follow each other */
+  for (i = numQuaternions; i < 4u * numQuaternions; i++)
+  {
+    pDst[i] = -pSrc[i];
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
@@ -0,0 +1,56 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_quaternion_conjugate_q31.c
+*
+* Description:  Q31 conjugate of quaternions.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Q31 conjugate of quaternions.
+ * @param[in]       *pSrc points to the quaternions
+ * @param[out]      *pDst points to the conjugates <code>w - x i - y j - z k</code>
+ * @param[in]       numQuaternions number of quaternions
+ * @return none.
+ *
+ * \par
+ * The conjugate of a unit quaternion is its inverse, the opposite rotation.  The negation
+ * saturates -1.0 (0x80000000) to 0x7FFFFFFF.
+ * <code>pDst</code> may be the same buffer as <code>pSrc</code>.
+ */
+
+void riscv_quaternion_conjugate_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numQuaternions)
+{
+  RISCV_PROFILE(riscv_quaternion_conjugate_q31);
+  uint32_t i;                                    /* loop counter */
+
+  if(pDst != pSrc)
+  {
+    memcpy(pDst, pSrc, numQuaternions * sizeof(q31_t));
+  }
+
+  /* The x, y and z arrays follow each other */
+  for (i = numQuaternions; i < 4u * numQuaternions; i++)
+  {
+    pDst[i] = (pSrc[i] == INT32_MIN) ? INT32_MAX : -pSrc[i];
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
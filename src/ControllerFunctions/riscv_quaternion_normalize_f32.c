@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_quaternion_normalize_f32.c
+*
+* Description:  Floating-point normalization of quaternions.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* 1/sqrt(x) from the exponent halving seed and two Newton steps, relative error below 5e-6 */
+static inline float32_t riscv_quaternion_invsqrt_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    uint32_t i;
+  } u;
+  float32_t half = 0.5f * x;
+  float32_t y;
+
+  u.f = x;
+  u.i = 0x5F3759DFu - (u.i >> 1);
+  y = u.f;
+  y = y * (1.5f - (half * y * y));
+  y = y * (1.5f - (half * y * y));
+
+  return (y);
+}
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point normalization of quaternions.
+ * @param[in]       *pSrc points to the quaternions
+ * @param[out]      *pDst points to the unit quaternions
+ * @param[in]       numQuaternions number of quaternions
+ * @return none.
+ *
+ * \par
+ * Every quaternion is scaled by <code>1/sqrt(w^2 + x^2 + y^2 + z^2)</code>, computed with the
+ * fast inverse square root: a seed from the bits of the squared norm and two Newton steps,
+ * four multiplications and no division or <code>fsqrt.s</code>.  The norm of the result is 1 to
+ * within 5e-6.  A zero quaternion stays zero.  <code>pDst</code> may be the same buffer as
+ * <code>pSrc</code>.
+ */
+
+void riscv_quaternion_normalize_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numQuaternions)
+{
+  RISCV_PROFILE(riscv_quaternion_normalize_f32);
+  const uint32_t n = numQuaternions;
+  float32_t w, x, y, z, scale;                   /* Components and 1/norm */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < n; i++)
+  {
+    w = pSrc[i];
+    x = pSrc[n + i];
+    y = pSrc[2u * n + i];
+    z = pSrc[3u * n + i];
+
+    scale = riscv_quaternion_invsqrt_f32((w * w) + (x * x) + (y * y) + (z * z));
+
+    pDst[i] = w * scale;
+    pDst[n + i] = x * scale;
+    pDst[2u * n + i] = y * scale;
+    pDst[3u * n + i] = z * scale;
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_quaternion_normalize_q31.c
+*
+* Description:  Q31 normalization of quaternions.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/* One Newton step of y = 1/sqrt(x), y in 2.30 and half = x/2 in 1.31, as in riscv_sqrt_q31() */
+#define RISCV_QUATERNION_INVSQRT_STEP(y, half) \
+  ((q31_t) (((q63_t) (y) * (0x30000000 - (q31_t) (((q63_t) (q31_t) (((q63_t) (y) * (y)) >> 31) * (half)) >> 31))) >> 31) << 2)
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Q31 normalization of quaternions.
+ * @param[in]       *pSrc points to the quaternions
+ * @param[out]      *pDst points to the unit quaternions
+ * @param[in]       numQuaternions number of quaternions
+ * @return none.
+ *
+ * \par
+ * The squared norm is summed in 4.60 format in a 64-bit accumulator and scaled by an even power
+ * of two to [0.25, 1).  Its inverse square root is seeded from the table of riscv_sqrt_q31() and
+ * refined with three Newton steps of 64-bit integer products, then every component is multiplied
+ * by it and saturated to 1.31, so a unit quaternion has a component of 0x7FFFFFFF at most.
+ * \par
+ * A quaternion whose squared norm is below 2^-60 is set to zero.  <code>pDst</code> may be the
+ * same buffer as <code>pSrc</code>.
+ */
+
+void riscv_quaternion_normalize_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numQuaternions)
+{
+  RISCV_PROFILE(riscv_quaternion_normalize_q31);
+  const uint32_t n = numQuaternions;
+  q63_t w, x, y, z;                              /* Components */
+  uint64_t norm;                                 /* Squared norm in 4.60 */
+  q31_t number, half, scale;                     /* Scaled squared norm and its 1/sqrt in 2.30 */
+  uint32_t i, shift;
+
+  for (i = 0u; i < n; i++)
+  {
+    w = pSrc[i];
+    x = pSrc[n + i];
+    y = pSrc[2u * n + i];
+    z = pSrc[3u * n + i];
+
+    norm = (uint64_t) (((w * w) >> 2) + ((x * x) >> 2) + ((y * y) >> 2) + ((z * z) >> 2));
+
+    if(norm == 0u)
+    {
+      pDst[i] = 0;
+      pDst[n + i] = 0;
+      pDst[2u * n + i] = 0;
+      pDst[3u * n + i] = 0;
+      continue;
+    }
+
+    /* norm 4^(shift/2) in [2^60, 2^62), that is [0.25, 1) in 2.62 */
+    for (shift = 0u; norm < ((uint64_t) 1u << 60); shift += 2u)
+    {
+      norm <<= 2u;
+    }
+
+    number = (q31_t) (norm >> 31);
+    half = number >> 1;
+    scale = (q31_t) invSqrtTable_q15[(number >> 25) - 16] << 16;
+    scale = RISCV_QUATERNION_INVSQRT_STEP(scale, half);
+    scale = RISCV_QUATERNION_INVSQRT_STEP(scale, half);
+    scale = RISCV_QUATERNION_INVSQRT_STEP(scale, half);
+
+    /* 1/norm = scale 2^(shift/2 - 1) */
+    shift = 31u - (shift >> 1);
+    pDst[i] = clip_q63_to_q31((w * scale) >> shift);
+    pDst[n + i] = clip_q63_to_q31((x * scale) >> shift);
+    pDst[2u * n + i] = clip_q63_to_q31((y * scale) >> shift);
+    pDst[3u * n + i] = clip_q63_to_q31((z * scale) >> shift);
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
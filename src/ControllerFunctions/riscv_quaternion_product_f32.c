@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_quaternion_product_f32.c
+*
+* Description:  Floating-point Hamilton product of quaternions.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup QuatMath Quaternion Math
+ *
+ * Batched quaternion kernels for attitude estimation, such as the Madgwick and Mahony filters.
+ * \par
+ * The quaternions <code>q = w + x i + y j + z k</code> are stored in structure-of-arrays layout,
+ * like the vectors of riscv_mat_vec_mult_soa_f32(): <code>numQuaternions</code> values of
+ * <code>w</code>, followed by the values of <code>x</code>, <code>y</code> and <code>z</code>.
+ * The 3-vectors of riscv_quaternion_rotate_f32() use the same layout with three arrays, and the
+ * rotation matrices of riscv_quaternion2rotation_f32() nine arrays, one per element in row-major
+ * order.  Every loop then handles one quaternion per iteration with unit-stride loads, and many
+ * orientations are processed per call.
+ * \par
+ * The Q31 kernels take the components in 1.31 format.  The rotation kernels expect unit
+ * quaternions, normalize them first with riscv_quaternion_normalize_f32() or _q31().
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point Hamilton product of quaternions.
+ * @param[in]       *pSrcA points to the first quaternions
+ * @param[in]       *pSrcB points to the second quaternions
+ * @param[out]      *pDst points to the products <code>a b</code>
+ * @param[in]       numQuaternions number of quaternions
+ * @return none.
+ *
+ * \par
+ * <code>pDst</code> may be the same buffer as <code>pSrcA</code> or <code>pSrcB</code>.
+ */
+
+void riscv_quaternion_product_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t numQuaternions)
+{
+  RISCV_PROFILE(riscv_quaternion_product_f32);
+  const uint32_t n = numQuaternions;
+  float32_t aw, ax, ay, az, bw, bx, by, bz;      /* Components */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < n; i++)
+  {
+    aw = pSrcA[i];
+    ax = pSrcA[n + i];
+    ay = pSrcA[2u * n + i];
+    az = pSrcA[3u * n + i];
+    bw = pSrcB[i];
+    bx = pSrcB[n + i];
+    by = pSrcB[2u * n + i];
+    bz = pSrcB[3u * n + i];
+
+    pDst[i] = (aw * bw) - (ax * bx) - (ay * by) - (az * bz);
+    pDst[n + i] = (aw * bx) + (ax * bw) + (ay * bz) - (az * by);
+    pDst[2u * n + i] = (aw * by) - (ax * bz) + (ay * bw) + (az * bx);
+    pDst[3u * n + i] = (aw * bz) + (ax * by) - (ay * bx) + (az * bw);
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_quaternion_product_q31.c
+*
+* Description:  Q31 Hamilton product of quaternions.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Q31 Hamilton product of quaternions.
+ * @param[in]       *pSrcA points to the first quaternions
+ * @param[in]       *pSrcB points to the second quaternions
+ * @param[out]      *pDst points to the products <code>a b</code>
+ * @param[in]       numQuaternions number of quaternions
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 2.62 products are shifted to 4.60 and the four terms of each component summed in a
+ * 64-bit accumulator, which cannot overflow.  The components are saturated to 1.31.
+ * \par
+ * <code>pDst</code> may be the same buffer as <code>pSrcA</code> or <code>pSrcB</code>.
+ */
+
+void riscv_quaternion_product_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t numQuaternions)
+{
+  RISCV_PROFILE(riscv_quaternion_product_q31);
+  const uint32_t n = numQuaternions;
+  q63_t aw, ax, ay, az;                          /* Components of a */
+  q31_t bw, bx, by, bz;                          /* Components of b */
+  q63_t acc;                                     /* Accumulator in 4.60 */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < n; i++)
+  {
+    aw = pSrcA[i];
+    ax = pSrcA[n + i];
+    ay = pSrcA[2u * n + i];
+    az = pSrcA[3u * n + i];
+    bw = pSrcB[i];
+    bx = pSrcB[n + i];
+    by = pSrcB[2u * n + i];
+    bz = pSrcB[3u * n + i];
+
+    acc = ((aw * bw) >> 2) - ((ax * bx) >> 2) - ((ay * by) >> 2) - ((az * bz) >> 2);
+    pDst[i] = clip_q63_to_q31(acc >> 29);
+    acc = ((aw * bx) >> 2) + ((ax * bw) >> 2) + ((ay * bz) >> 2) - ((az * by) >> 2);
+    pDst[n + i] = clip_q63_to_q31(acc >> 29);
+    acc = ((aw * by) >> 2) - ((ax * bz) >> 2) + ((ay * bw) >> 2) + ((az * bx) >> 2);
+    pDst[2u * n + i] = clip_q63_to_q31(acc >> 29);
+    acc = ((aw * bz) >> 2) + ((ax * by) >> 2) - ((ay * bx) >> 2) + ((az * bw) >> 2);
+    pDst[3u * n + i] = clip_q63_to_q31(acc >> 29);
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_quaternion_rotate_f32.c
+*
+* Description:  Floating-point rotation of vectors by quaternions.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Floating-point rotation of 3-vectors by unit quaternions.
+ * @param[in]       *pQuat points to the unit quaternions
+ * @param[in]       *pSrc points to the 3 arrays of <code>numQuaternions</code> input components
+ * @param[out]      *pDst points to the 3 arrays of <code>numQuaternions</code> rotated components
+ * @param[in]       numQuaternions number of quaternions and of vectors
+ * @return none.
+ *
+ * \par
+ * Vector <code>i</code> is rotated by quaternion <code>i</code>, <code>v' = q v q*</code>.  With
+ * <code>u = (x, y, z)</code> and <code>t = 2 u x v</code> this is <code>v' = v + w t + u x t</code>,
+ * 15 multiplications instead of the 27 of the rotation matrix.  <code>pDst</code> may be the same
+ * buffer as <code>pSrc</code>.
+ */
+
+void riscv_quaternion_rotate_f32(
+  const float32_t * pQuat,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numQuaternions)
+{
+  RISCV_PROFILE(riscv_quaternion_rotate_f32);
+  const uint32_t n = numQuaternions;
+  float32_t w, x, y, z;                          /* Quaternion */
+  float32_t vx, vy, vz, tx, ty, tz;              /* Vector and 2 u x v */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < n; i++)
+  {
+    w = pQuat[i];
+    x = pQuat[n + i];
+    y = pQuat[2u * n + i];
+    z = pQuat[3u * n + i];
+    vx = pSrc[i];
+    vy = pSrc[n + i];
+    vz = pSrc[2u * n + i];
+
+    tx = 2.0f * ((y * vz) - (z * vy));
+    ty = 2.0f * ((z * vx) - (x * vz));
+    tz = 2.0f * ((x * vy) - (y * vx));
+
+    pDst[i] = vx + (w * tx) + ((y * tz) - (z * ty));
+    pDst[n + i] = vy + (w * ty) + ((z * tx) - (x * tz));
+    pDst[2u * n + i] = vz + (w * tz) + ((x * ty) - (y * tx));
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_quaternion_rotate_q31.c
+*
+* Description:  Q31 rotation of vectors by quaternions.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup QuatMath
+ * @{
+ */
+
+/**
+ * @brief Q31 rotation of 3-vectors by unit quaternions.
+ * @param[in]       *pQuat points to the unit quaternions
+ * @param[in]       *pSrc points to the 3 arrays of <code>numQuaternions</code> input components
+ * @param[out]      *pDst points to the 3 arrays of <code>numQuaternions</code> rotated components
+ * @param[in]       numQuaternions number of quaternions and of vectors
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Vector <code>i</code> is rotated by quaternion <code>i</code> through the rotation matrix of the
+ * quaternion, built in 2.30 format from 4.60 products so that its diagonal can hold 1.0.  Each
+ * output component sums three 3.61 products in a 64-bit accumulator and is saturated to 1.31.
+ * <code>pDst</code> may be the same buffer as <code>pSrc</code>.
+ */
+
+void riscv_quaternion_rotate_q31(
+  const q31_t * pQuat,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numQuaternions)
+{
+  RISCV_PROFILE(riscv_quaternion_rotate_q31);
+  const uint32_t n = numQuaternions;
+  q63_t w, x, y, z;                              /* Quaternion */
+  q63_t xx, yy, zz, xy, xz, yz, wx, wy, wz;      /* Products in 4.60 */
+  q63_t r00, r01, r02, r10, r11, r12, r20, r21, r22;  /* Rotation matrix in 2.30 */
+  q31_t vx, vy, vz;                              /* Vector */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < n; i++)
+  {
+    w = pQuat[i];
+    x = pQuat[n + i];
+    y = pQuat[2u * n + i];
+    z = pQuat[3u * n + i];
+    vx = pSrc[i];
+    vy = pSrc[n + i];
+    vz = pSrc[2u * n + i];
+
+    xx = (x * x) >> 2;
+    yy = (y * y) >> 2;
+    zz = (z * z) >> 2;
+    xy = (x * y) >> 2;
+    xz = (x * z) >> 2;
+    yz = (y * z) >> 2;
+    wx = (w * x) >> 2;
+    wy = (w * y) >> 2;
+    wz = (w * z) >> 2;
+
+    /* 1 - 2 (yy + zz) and 2 (xy - wz) in 2.30 */
+    r00 = 0x40000000 - ((yy + zz) >> 29);
+    r01 = (xy - wz) >> 29;
+    r02 = (xz + wy) >> 29;
+    r10 = (xy + wz) >> 29;
+    r11 = 0x40000000 - ((xx + zz) >> 29);
+    r12 = (yz - wx) >> 29;
+    r20 = (xz - wy) >> 29;
+    r21 = (yz + wx) >> 29;
+    r22 = 0x40000000 - ((xx + yy) >> 29);
+
+    pDst[i] = clip_q63_to_q31(((r00 * vx) + (r01 * vy) + (r02 * vz)) >> 30);
+    pDst[n + i] = clip_q63_to_q31(((r10 * vx) + (r11 * vy) + (r12 * vz)) >> 30);
+    pDst[2u * n + i] = clip_q63_to_q31(((r20 * vx) + (r21 * vy) + (r22 * vz)) >> 30);
+  }
+}
+
+/**
+ * @} end of QuatMath group
+ */
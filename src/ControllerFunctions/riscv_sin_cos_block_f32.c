@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sin_cos_block_f32.c
+*
+* Description:  Sine and cosine of a block of floating-point angles in degrees.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup SinCos
+ * @{
+ */
+
+/**
+ * @brief  Floating-point sine and cosine of a block of angles.
+ * @param[in]  *pTheta    points to the input angles in degrees.
+ * @param[out] *pSinVal   points to the sine outputs.
+ * @param[out] *pCosVal   points to the cosine outputs.
+ * @param[in]  blockSize  number of angles to process.
+ * @return none.
+ *
+ * \par
+ * The function uses the table and the cubic interpolation of riscv_sin_cos_f32(), but the
+ * index, the fraction and the interpolation weights of every angle are computed once and
+ * applied to both outputs.  With <code>t</code> the fraction and <code>dn = 2*pi/512</code>
+ * the table spacing, the weights are
+ * <pre>
+ *     w1 = 3*t^2 - 2*t^3,   w2 = dn*(t^3 - 2*t^2 + t),   w3 = dn*(t^3 - t^2)
+ * </pre>
+ * and, with <code>s0, s1</code> the two nearest sine entries and <code>c0, c1</code> the two
+ * nearest cosine entries,
+ * <pre>
+ *     sin = s0 + w1*(s1 - s0) + w2*c0 + w3*c1
+ *     cos = c0 + w1*(c1 - c0) - w2*s0 - w3*s1
+ * </pre>
+ * so the four table values are read once for both outputs.  The results agree with
+ * riscv_sin_cos_f32() to within the float rounding.
+ */
+
+void riscv_sin_cos_block_f32(
+  float32_t * pTheta,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_sin_cos_block_f32);
+  float32_t in, findex;                          /* Normalized input and table position */
+  float32_t t, t2, t3;                           /* Fraction and its powers */
+  float32_t w1, w2, w3;                          /* Interpolation weights */
+  float32_t s0, s1, c0, c1;                      /* Nearest sine and cosine values */
+  uint32_t index, indexS, indexC;                /* Table indices */
+  int32_t n;
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Scale the input to turns and map it to [0 1] */
+    in = *pTheta++ * 0.00277777777778f;
+    n = (int32_t) in;
+    if(in < 0.0f)
+    {
+      n--;
+    }
+    in = in - (float32_t) n;
+
+    /* The fraction is taken before the wrap so that in = 1.0f gives t = 0 */
+    findex = (float32_t) FAST_MATH_TABLE_SIZE * in;
+    index = (uint32_t) findex;
+    t = findex - (float32_t) index;
+    indexS = index & 0x1ffu;
+    indexC = (indexS + (FAST_MATH_TABLE_SIZE / 4)) & 0x1ffu;
+
+    t2 = t * t;
+    t3 = t2 * t;
+    w1 = (3.0f * t2) - (2.0f * t3);
+    w2 = 0.0122718463030f * ((t3 - (2.0f * t2)) + t);
+    w3 = 0.0122718463030f * (t3 - t2);
+
+    s0 = sinTable_f32[indexS];
+    s1 = sinTable_f32[indexS + 1u];
+    c0 = sinTable_f32[indexC];
+    c1 = sinTable_f32[indexC + 1u];
+
+    *pSinVal++ = s0 + (w1 * (s1 - s0)) + (w2 * c0) + (w3 * c1);
+    *pCosVal++ = c0 + (w1 * (c1 - c0)) - (w2 * s0) - (w3 * s1);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of SinCos group
+ */
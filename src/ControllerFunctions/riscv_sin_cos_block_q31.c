@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sin_cos_block_q31.c
+*
+* Description:  Sine and cosine of a block of Q31 angles.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup SinCos
+ * @{
+ */
+
+/**
+ * @brief  Q31 sine and cosine of a block of angles.
+ * @param[in]  *pTheta    points to the input angles, [-1 0.9999] maps to [-180 180) degrees.
+ * @param[out] *pSinVal   points to the sine outputs.
+ * @param[out] *pCosVal   points to the cosine outputs.
+ * @param[in]  blockSize  number of angles to process.
+ * @return none.
+ *
+ * \par
+ * The function evaluates the weights of riscv_sin_cos_block_f32() in integer arithmetic only:
+ * the top 9 bits of the angle are the table index and the remaining 23 bits the fraction, as in
+ * riscv_sin_cos_q31().  The weights are kept in 1.31 format and the products are summed in a
+ * 64-bit accumulator that is rounded to 1.31 and saturated.  An angle in degrees is converted
+ * to this format as <code>degrees/180</code> in 1.31 format.
+ * The error compared with the exact sine and cosine is below 3 LSB.
+ */
+
+void riscv_sin_cos_block_q31(
+  q31_t * pTheta,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_sin_cos_block_q31);
+  q31_t t, t2, t3;                               /* Fraction and its powers in 1.31 format */
+  q31_t w1, w2, w3;                              /* Interpolation weights */
+  q31_t s0, s1, c0, c1;                          /* Nearest sine and cosine values */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t theta, indexS, indexC;                /* Angle and table indices */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    theta = (uint32_t) *pTheta++;
+    indexS = theta >> CONTROLLER_Q31_SHIFT;
+    indexC = (indexS + (FAST_MATH_TABLE_SIZE / 4)) & 0x1ffu;
+    t = (q31_t) ((theta << 9) >> 1);
+
+    t2 = (q31_t) (((q63_t) t * t) >> 31);
+    t3 = (q31_t) (((q63_t) t2 * t) >> 31);
+    w1 = clip_q63_to_q31((3 * (q63_t) t2) - (2 * (q63_t) t3));
+
+    /* 2*pi/512 in 1.31 format */
+    w2 = (q31_t) (((((q63_t) t3 - (2 * (q63_t) t2)) + t) * 0x1921FB5) >> 31);
+    w3 = (q31_t) ((((q63_t) t3 - t2) * 0x1921FB5) >> 31);
+
+    s0 = sinTable_q31[indexS];
+    s1 = sinTable_q31[indexS + 1u];
+    c0 = sinTable_q31[indexC];
+    c1 = sinTable_q31[indexC + 1u];
+
+    acc = ((q63_t) s0 << 31) + ((q63_t) w1 * (s1 - s0)) + ((q63_t) w2 * c0) + ((q63_t) w3 * c1);
+    *pSinVal++ = clip_q63_to_q31((acc + 0x40000000) >> 31);
+
+    acc = ((q63_t) c0 << 31) + ((q63_t) w1 * (c1 - c0)) - ((q63_t) w2 * s0) - ((q63_t) w3 * s1);
+    *pCosVal++ = clip_q63_to_q31((acc + 0x40000000) >> 31);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of SinCos group
+ */
@@ -68,6 +68,11 @@
  *  -# Sine value is computed as <code> *psinVal = y0 + (fract * (y1 - y0))</code>.    
  *  -# Fetch the value corresponding to \c index from cosine table to \c y0 and also value from \c index+1 to \c y1.      
  *  -# Cosine value is computed as <code> *pcosVal = y0 + (fract * (y1 - y0))</code>.    
+ *
+ * \par
+ * Built with RISCV_MATH_SIN_COS_TABLE64 or RISCV_MATH_SIN_COS_POLY (CMake RISCV_DSP_SIN_COS) the
+ * functions use a 64-interval quarter-wave table with quadratic interpolation or a minimax
+ * polynomial instead, see FAST_MATH_TABLE_SIZE in riscv_math.h for the error and cost of each tier.
  */
 
  /**    
@@ -88,6 +93,23 @@ void riscv_sin_cos_f32(
   float32_t * pSinVal,
   float32_t * pCosVal)
 {
+  RISCV_PROFILE(riscv_sin_cos_f32);
+#if defined (RISCV_MATH_SIN_COS_POLY) || defined (RISCV_MATH_SIN_COS_TABLE64)
+  float32_t in;                                  /* Input in turns */
+  int32_t n;
+
+  /* Scale the input to turns and map it to [0 1] */
+  in = theta * 0.00277777777778f;
+  n = (int32_t) in;
+  if(in < 0.0f)
+  {
+    n--;
+  }
+  in = in - (float32_t) n;
+
+  *pSinVal = riscv_sin_tier_f32(in);
+  *pCosVal = riscv_sin_tier_f32(in + 0.25f);
+#else
   float32_t fract, in;                             /* Temporary variables for input, output */
   uint16_t indexS, indexC;                         /* Index variable */
   float32_t f1, f2, d1, d2;                        /* Two nearest output values */
@@ -111,6 +133,9 @@ void riscv_sin_cos_f32(
 
   /* Calculation of index of the table */
   findex = (float32_t) FAST_MATH_TABLE_SIZE * in;
+  if (findex >= 512.0f) {
+    findex -= 512.0f;
+  }
   indexS = ((uint16_t)findex) & 0x1ff;
   indexC = (indexS + (FAST_MATH_TABLE_SIZE / 4)) & 0x1ff;
 
@@ -145,6 +170,7 @@ void riscv_sin_cos_f32(
   
   /* Calculation of sine value */
   *pSinVal = fract*temp + f1;
+#endif
 }
 /**    
  * @} end of SinCos group    
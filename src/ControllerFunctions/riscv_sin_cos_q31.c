@@ -68,6 +68,12 @@ void riscv_sin_cos_q31(
   q31_t * pSinVal,
   q31_t * pCosVal)
 {
+  RISCV_PROFILE(riscv_sin_cos_q31);
+#if defined (RISCV_MATH_SIN_COS_POLY) || defined (RISCV_MATH_SIN_COS_TABLE64)
+  /* The Q31 angle in [-180 180) degrees is the phase in Q32 turns */
+  *pSinVal = riscv_sin_tier_q31((uint32_t) theta);
+  *pCosVal = riscv_sin_tier_q31((uint32_t) theta + 0x40000000u);
+#else
   q31_t fract;                                 /* Temporary variables for input, output */
   uint16_t indexS, indexC;                     /* Index variable */
   q31_t f1, f2, d1, d2;                        /* Two nearest output values */
@@ -84,8 +90,8 @@ void riscv_sin_cos_q31(
   /* Read two nearest values of input value from the cos & sin tables */
   f1 = sinTable_q31[indexC+0];
   f2 = sinTable_q31[indexC+1];
-  d1 = -sinTable_q31[indexS+0];
-  d2 = -sinTable_q31[indexS+1];
+  d1 = clip_q63_to_q31(-(q63_t) sinTable_q31[indexS+0]);
+  d2 = clip_q63_to_q31(-(q63_t) sinTable_q31[indexS+1]);
 
   Dn = 0x1921FB5; // delta between the two points (fixed), in this case 2*pi/FAST_MATH_TABLE_SIZE
   Df = f2 - f1; // delta between the values of the functions
@@ -117,6 +123,7 @@ void riscv_sin_cos_q31(
   
   /* Calculation of sine value */
   *pSinVal = clip_q63_to_q31((temp >> 31) + (q63_t)f1);
+#endif
 }
 
 /**    
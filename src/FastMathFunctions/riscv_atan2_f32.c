@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_atan2_f32.c
+*
+* Description:  Fast four-quadrant arc tangent for floating-point data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup atan2 Arc Tangent
+ *
+ * Computes the angle of the point <code>(x, y)</code>, <code>atan2(y, x)</code>, in the range
+ * <code>[-pi pi]</code>.
+ * \par
+ * The floating-point version reduces the ratio of the smaller to the larger magnitude to [0 1],
+ * evaluates a degree 9 odd polynomial for <code>atan()</code> on it and maps the result back
+ * to the octant of the input.  The absolute error is below 1.5e-5 radians.
+ * \par
+ * The Q15 and Q31 versions use the CORDIC vectoring algorithm with the table atanTable_q31,
+ * with shifts and additions only.  The inputs are scaled to a common range first, so only the
+ * ratio of <code>x</code> and <code>y</code> matters.  The result is in radians in Q2.13
+ * (2.13 format) for Q15 and in Q2.29 (2.29 format) for Q31, with an absolute error below 1 LSB
+ * for Q15 and 16 LSB (3e-8 radians) for Q31.
+ * \par
+ * <code>atan2(0, 0)</code> is undefined.  The functions return 0 and RISCV_MATH_ARGUMENT_ERROR.
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief  Fast four-quadrant arc tangent for floating-point data.
+ * @param[in]  y         ordinate of the point.
+ * @param[in]  x         abscissa of the point.
+ * @param[out] *pResult  angle in radians.
+ * @return The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if both inputs are 0.
+ */
+
+riscv_status riscv_atan2_f32(
+  float32_t y,
+  float32_t x,
+  float32_t * pResult)
+{
+  RISCV_PROFILE(riscv_atan2_f32);
+  float32_t ax = fabsf(x), ay = fabsf(y);        /* Magnitudes of the inputs */
+  float32_t t, t2, r;
+
+  if((ax == 0.0f) && (ay == 0.0f))
+  {
+    *pResult = 0.0f;
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Reduce to the first octant, t in [0 1] */
+  t = (ay > ax) ? (ax / ay) : (ay / ax);
+  t2 = t * t;
+
+  /* Odd minimax polynomial of atan(t) */
+  r = t * (0.9998660f + t2 * (-0.3302995f + t2 * (0.1801410f + t2 * (-0.0851330f + t2 * 0.0208351f))));
+
+  /* Back to the quadrant of (x, y) */
+  if(ay > ax)
+  {
+    r = 1.57079632679f - r;
+  }
+
+  if(x < 0.0f)
+  {
+    r = 3.14159265359f - r;
+  }
+
+  *pResult = (y < 0.0f) ? -r : r;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Fast four-quadrant arc tangent of a floating-point vector.
+ * @param[in]  *pSrcY     points to the ordinates.
+ * @param[in]  *pSrcX     points to the abscissas.
+ * @param[out] *pDst      points to the angles in radians.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * Computes <code>riscv_atan2_f32(pSrcY[n], pSrcX[n], &pDst[n])</code>.
+ */
+
+void riscv_atan2_vec_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_atan2_vec_f32);
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    (void) riscv_atan2_f32(*pSrcY++, *pSrcX++, pDst++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
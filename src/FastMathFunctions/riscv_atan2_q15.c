@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_atan2_q15.c
+*
+* Description:  Fast four-quadrant arc tangent for Q15 data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief  Fast four-quadrant arc tangent for Q15 data.
+ * @param[in]  y         ordinate of the point.
+ * @param[in]  x         abscissa of the point.
+ * @param[out] *pResult  angle in radians in 2.13 format.
+ * @return The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if both inputs are 0.
+ *
+ * \par
+ * The iterations run in 32-bit arithmetic as in riscv_atan2_q31(), 16 of them are enough
+ * for the resolution of the 2.13 result.
+ */
+
+riscv_status riscv_atan2_q15(
+  q15_t y,
+  q15_t x,
+  q15_t * pResult)
+{
+  RISCV_PROFILE(riscv_atan2_q15);
+  uint32_t ax, ay, m;                            /* Magnitudes of the inputs */
+  q31_t xs, ys, xt;                              /* CORDIC vector */
+  q31_t z = 0;                                   /* Angle accumulator in 2.29 format */
+  uint32_t shift;
+  uint32_t i;
+
+  ax = (x < 0) ? (0u - (uint32_t) x) : (uint32_t) x;
+  ay = (y < 0) ? (0u - (uint32_t) y) : (uint32_t) y;
+  m = ax | ay;
+
+  if(m == 0u)
+  {
+    *pResult = 0;
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Normalize the larger magnitude to [2^28 2^29) */
+  shift = __CLZ((q31_t) m) - 3u;
+  ax <<= shift;
+  ay <<= shift;
+
+  xs = (q31_t) ax;
+  ys = (y < 0) ? -(q31_t) ay : (q31_t) ay;
+
+  /* Rotate the left half-plane by pi */
+  if(x < 0)
+  {
+    z = (ys >= 0) ? 0x6487ED51 : -0x6487ED51;
+    ys = -ys;
+  }
+
+  for (i = 0u; i < 16u; i++)
+  {
+    xt = xs;
+
+    if(ys > 0)
+    {
+      xs += ys >> i;
+      ys -= xt >> i;
+      z += atanTable_q31[i];
+    }
+    else
+    {
+      xs -= ys >> i;
+      ys += xt >> i;
+      z -= atanTable_q31[i];
+    }
+  }
+
+  /* Round to 2.13 format */
+  *pResult = (q15_t) ((z + 0x8000) >> 16);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Fast four-quadrant arc tangent of a Q15 vector.
+ * @param[in]  *pSrcY     points to the ordinates.
+ * @param[in]  *pSrcX     points to the abscissas.
+ * @param[out] *pDst      points to the angles in radians in 2.13 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ */
+
+void riscv_atan2_vec_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_atan2_vec_q15);
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    (void) riscv_atan2_q15(*pSrcY++, *pSrcX++, pDst++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
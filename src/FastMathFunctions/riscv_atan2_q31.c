@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_atan2_q31.c
+*
+* Description:  Fast four-quadrant arc tangent for Q31 data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief  Fast four-quadrant arc tangent for Q31 data.
+ * @param[in]  y         ordinate of the point.
+ * @param[in]  x         abscissa of the point.
+ * @param[out] *pResult  angle in radians in 2.29 format.
+ * @return The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if both inputs are 0.
+ *
+ * \par
+ * The CORDIC iterations need two guard bits for the gain of about 1.65 and the
+ * pre-rotation, so the larger magnitude is normalized to [2^28 2^29) first.
+ */
+
+riscv_status riscv_atan2_q31(
+  q31_t y,
+  q31_t x,
+  q31_t * pResult)
+{
+  RISCV_PROFILE(riscv_atan2_q31);
+  uint32_t ax, ay, m;                            /* Magnitudes of the inputs */
+  q31_t xs, ys, xt;                              /* CORDIC vector */
+  q31_t z = 0;                                   /* Angle accumulator */
+  int32_t shift;
+  uint32_t i;
+
+  ax = (x < 0) ? (0u - (uint32_t) x) : (uint32_t) x;
+  ay = (y < 0) ? (0u - (uint32_t) y) : (uint32_t) y;
+  m = ax | ay;
+
+  if(m == 0u)
+  {
+    *pResult = 0;
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Normalize the larger magnitude to [2^28 2^29) */
+  shift = (int32_t) __CLZ((q31_t) m) - 3;
+  if(shift >= 0)
+  {
+    ax <<= shift;
+    ay <<= shift;
+  }
+  else
+  {
+    ax >>= -shift;
+    ay >>= -shift;
+  }
+
+  xs = (q31_t) ax;
+  ys = (y < 0) ? -(q31_t) ay : (q31_t) ay;
+
+  /* Rotate the left half-plane by pi */
+  if(x < 0)
+  {
+    z = (ys >= 0) ? 0x6487ED51 : -0x6487ED51;
+    ys = -ys;
+  }
+
+  for (i = 0u; i < 31u; i++)
+  {
+    xt = xs;
+
+    if(ys > 0)
+    {
+      xs += ys >> i;
+      ys -= xt >> i;
+      z += atanTable_q31[i];
+    }
+    else
+    {
+      xs -= ys >> i;
+      ys += xt >> i;
+      z -= atanTable_q31[i];
+    }
+  }
+
+  *pResult = z;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Fast four-quadrant arc tangent of a Q31 vector.
+ * @param[in]  *pSrcY     points to the ordinates.
+ * @param[in]  *pSrcX     points to the abscissas.
+ * @param[out] *pDst      points to the angles in radians in 2.29 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ */
+
+void riscv_atan2_vec_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_atan2_vec_q31);
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    (void) riscv_atan2_q31(*pSrcY++, *pSrcX++, pDst++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
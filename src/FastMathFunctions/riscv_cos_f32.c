@@ -68,6 +68,11 @@
  *    b=Table[index+0];
  *    c=Table[index+1];
  * </pre>
+ *
+ * \par
+ * Built with RISCV_MATH_SIN_COS_TABLE64 or RISCV_MATH_SIN_COS_POLY (CMake RISCV_DSP_SIN_COS) the
+ * functions use a 64-interval quarter-wave table with quadratic interpolation or a minimax
+ * polynomial instead, see FAST_MATH_TABLE_SIZE in riscv_math.h for the error and cost of each tier.
  */
 
  /**
@@ -84,6 +89,21 @@
 float32_t riscv_cos_f32(
   float32_t x)
 {
+  RISCV_PROFILE(riscv_cos_f32);
+#if defined (RISCV_MATH_SIN_COS_POLY) || defined (RISCV_MATH_SIN_COS_TABLE64)
+  float32_t in;                                  /* Input in turns */
+  int32_t n;
+
+  /* Scale the input to turns, add 0.25 (pi/2) and map it to [0 1] */
+  in = x * 0.159154943092f + 0.25f;
+  n = (int32_t) in;
+  if(in < 0.0f)
+  {
+    n--;
+  }
+
+  return (riscv_sin_tier_f32(in - (float32_t) n));
+#else
   float32_t cosVal, fract, in;                   /* Temporary variables for input, output */
   uint16_t index;                                /* Index variable */
   float32_t a, b;                                /* Two nearest output values */
@@ -108,6 +128,9 @@ float32_t riscv_cos_f32(
 
   /* Calculation of index of the table */
   findex = (float32_t) FAST_MATH_TABLE_SIZE * in;
+  if (findex >= 512.0f) {
+    findex -= 512.0f;
+  }
   index = ((uint16_t)findex) & 0x1ff;
 
   /* fractional value calculation */
@@ -122,6 +145,7 @@ float32_t riscv_cos_f32(
 
   /* Return the output value */
   return (cosVal);
+#endif
 }
 
 /**
@@ -64,6 +64,14 @@
 q15_t riscv_cos_q15(
   q15_t x)
 {
+  RISCV_PROFILE(riscv_cos_q15);
+#if defined (RISCV_MATH_SIN_COS_POLY) || defined (RISCV_MATH_SIN_COS_TABLE64)
+  /* add 0.25 (pi/2) to the phase of the sine */
+  q31_t y = riscv_sin_tier_q31(((uint32_t) x << 17) + 0x40000000u);
+
+  /* Round the Q31 cosine to Q15 */
+  return (clip_q31_to_q15((q31_t) (((q63_t) y + 0x8000) >> 16)));
+#else
   q15_t cosVal;                                  /* Temporary variables for input, output */
   int32_t index;                                 /* Index variables */
   q15_t a, b;                                    /* Four nearest output values */
@@ -91,6 +99,7 @@ q15_t riscv_cos_q15(
   cosVal = (q15_t)((((q31_t)cosVal << 16) + ((q31_t)fract*b)) >> 16);
 
   return cosVal << 1;
+#endif
 }
 
 /**
@@ -64,6 +64,11 @@
 q31_t riscv_cos_q31(
   q31_t x)
 {
+  RISCV_PROFILE(riscv_cos_q31);
+#if defined (RISCV_MATH_SIN_COS_POLY) || defined (RISCV_MATH_SIN_COS_TABLE64)
+  /* add 0.25 (pi/2) to the phase of the sine */
+  return (riscv_sin_tier_q31(((uint32_t) x << 1) + 0x40000000u));
+#else
   q31_t cosVal;                                  /* Temporary variables for input, output */
   int32_t index;                                 /* Index variables */
   q31_t a, b;                                    /* Four nearest output values */
@@ -93,6 +98,7 @@ q31_t riscv_cos_q31(
   cosVal = (q31_t)((((q63_t)cosVal << 32) + ((q63_t)fract*b)) >> 32);
   //printf("cosVal2= %X\n",cosVal);
   return cosVal << 1;
+#endif
 }
 
 /**
@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_nco_f32.c
+*
+* Description:  Floating-point numerically controlled oscillator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup NCO Numerically Controlled Oscillator
+ *
+ * These functions generate blocks of <code>sin(phi[n])</code> and <code>cos(phi[n])</code> with
+ * <pre>
+ *    phi[n] = startPhase + n * phaseInc
+ * </pre>
+ * for oscillators and mixers, with the table of riscv_sin_f32(), riscv_sin_q15() and riscv_sin_q31().
+ * \par
+ * The phase is held in a 32-bit unsigned accumulator where the full range is one turn, so
+ * the accumulation wraps around at <code>2*pi</code> by itself and no range reduction is needed
+ * per sample.  The upper 9 bits of the accumulator select the table entry and the lower 23 bits
+ * are the fraction for the linear interpolation.
+ * \par
+ * The initialization functions convert the start phase and the phase increment, a frequency
+ * <code>f</code> at a sample rate <code>fs</code> is the increment <code>2*pi*f/fs</code>.
+ * The phase continues across calls of the processing functions.
+ * \par
+ * <code>pSin</code> or <code>pCos</code> may be NULL when only one of the outputs is needed.
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/*
+* @brief  Generates a block of sine values from the phase accumulator.
+* @param[in]  phase      phase of the first sample, plus the offset of the output.
+* @param[in]  phaseInc   phase increment per sample.
+* @param[out] *pDst      points to the output block.
+* @param[in]  blockSize  number of samples.
+*/
+
+static void riscv_nco_block_f32(
+  uint32_t phase,
+  uint32_t phaseInc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t index;                                /* Table index */
+  float32_t fract;                               /* Interpolation fraction */
+
+  while(blockSize > 0u)
+  {
+    index = phase >> 23u;
+    fract = (float32_t) (phase & 0x007FFFFFu) * 1.1920928955078125e-7f;
+
+    *pDst++ = (1.0f - fract) * sinTable_f32[index] + fract * sinTable_f32[index + 1];
+
+    phase += phaseInc;
+
+    /* Decrement the loop counter */
+    blockSize--;
+  }
+}
+
+/**
+ * @brief Processing function for the floating-point NCO.
+ * @param[in,out] *S         points to an instance of the floating-point NCO structure.
+ * @param[out]    *pSin      points to the block of sine values, or NULL.
+ * @param[out]    *pCos      points to the block of cosine values, or NULL.
+ * @param[in]     blockSize  number of samples to generate.
+ * @return none.
+ */
+
+void riscv_nco_f32(
+  riscv_nco_instance_f32 * S,
+  float32_t * pSin,
+  float32_t * pCos,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_nco_f32);
+  if(pSin != NULL)
+  {
+    riscv_nco_block_f32(S->phase, S->phaseInc, pSin, blockSize);
+  }
+
+  /* A quarter turn ahead of the sine */
+  if(pCos != NULL)
+  {
+    riscv_nco_block_f32(S->phase + 0x40000000u, S->phaseInc, pCos, blockSize);
+  }
+
+  S->phase += blockSize * S->phaseInc;
+}
+
+/**
+ * @} end of NCO group
+ */
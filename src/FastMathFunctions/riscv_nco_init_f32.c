@@ -0,0 +1,64 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_nco_init_f32.c
+*
+* Description:  Initialization function for the floating-point NCO.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/*
+* @brief  Converts an angle in radians to the 32-bit phase format.
+*/
+
+static uint32_t riscv_nco_phase_f32(
+  float32_t x)
+{
+  float32_t turns;
+  int32_t n;
+
+  /* Keep the fraction of a turn, negative angles included */
+  turns = x * 0.159154943092f;
+  n = (int32_t) turns;
+  if(turns < 0.0f)
+  {
+    n--;
+  }
+  turns = (turns - (float32_t) n) * 4294967296.0f;
+
+  /* The fraction may round up to one turn */
+  return ((turns >= 4294967296.0f) ? 0u : (uint32_t) turns);
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point NCO.
+ * @param[in,out] *S          points to an instance of the floating-point NCO structure.
+ * @param[in]     startPhase  phase of the first sample in radians.
+ * @param[in]     phaseInc    phase increment per sample in radians, may be negative.
+ * @return none.
+ */
+
+void riscv_nco_init_f32(
+  riscv_nco_instance_f32 * S,
+  float32_t startPhase,
+  float32_t phaseInc)
+{
+  RISCV_PROFILE(riscv_nco_init_f32);
+  S->phase = riscv_nco_phase_f32(startPhase);
+  S->phaseInc = riscv_nco_phase_f32(phaseInc);
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,45 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_nco_init_q15.c
+*
+* Description:  Initialization function for the Q15 NCO.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 NCO.
+ * @param[in,out] *S          points to an instance of the Q15 NCO structure.
+ * @param[in]     startPhase  phase of the first sample, scaled as the input of riscv_sin_q15().
+ * @param[in]     phaseInc    phase increment per sample in Q31, scaled as the input of riscv_sin_q31(), may be negative.
+ * @return none.
+ *
+ * \par
+ * The increment is given in Q31 because a Q15 increment limits the frequency resolution
+ * to <code>fs/32768</code>.
+ */
+
+void riscv_nco_init_q15(
+  riscv_nco_instance_q15 * S,
+  q15_t startPhase,
+  q31_t phaseInc)
+{
+  RISCV_PROFILE(riscv_nco_init_q15);
+  S->phase = (uint32_t) (uint16_t) startPhase << 17u;
+  S->phaseInc = (uint32_t) phaseInc << 1u;
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,42 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_nco_init_q31.c
+*
+* Description:  Initialization function for the Q31 NCO.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 NCO.
+ * @param[in,out] *S          points to an instance of the Q31 NCO structure.
+ * @param[in]     startPhase  phase of the first sample, scaled as the input of riscv_sin_q31().
+ * @param[in]     phaseInc    phase increment per sample, same scaling, may be negative.
+ * @return none.
+ */
+
+void riscv_nco_init_q31(
+  riscv_nco_instance_q31 * S,
+  q31_t startPhase,
+  q31_t phaseInc)
+{
+  RISCV_PROFILE(riscv_nco_init_q31);
+  /* [0 +1) is one turn, the accumulator uses the full 32 bits */
+  S->phase = (uint32_t) startPhase << 1u;
+  S->phaseInc = (uint32_t) phaseInc << 1u;
+}
+
+/**
+ * @} end of NCO group
+ */
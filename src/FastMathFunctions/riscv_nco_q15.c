@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_nco_q15.c
+*
+* Description:  Q15 numerically controlled oscillator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/*
+* @brief  Generates a block of sine values from the phase accumulator.
+* @param[in]  phase      phase of the first sample, plus the offset of the output.
+* @param[in]  phaseInc   phase increment per sample.
+* @param[out] *pDst      points to the output block.
+* @param[in]  blockSize  number of samples.
+*/
+
+static void riscv_nco_block_q15(
+  uint32_t phase,
+  uint32_t phaseInc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t index;                                /* Table index */
+  q31_t fract;                                   /* Interpolation fraction in 1.15 format */
+  q31_t a;                                       /* Table value below the phase */
+
+  while(blockSize > 0u)
+  {
+    index = phase >> 23u;
+    fract = (q31_t) ((phase >> 8u) & 0x7FFFu);
+    a = sinTable_q15[index];
+
+    /* The step between two table entries is small, so the product fits in 32 bits */
+    *pDst++ = (q15_t) (a + ((((q31_t) sinTable_q15[index + 1] - a) * fract) >> 15));
+
+    phase += phaseInc;
+
+    /* Decrement the loop counter */
+    blockSize--;
+  }
+}
+
+/**
+ * @brief Processing function for the Q15 NCO.
+ * @param[in,out] *S         points to an instance of the Q15 NCO structure.
+ * @param[out]    *pSin      points to the block of sine values, or NULL.
+ * @param[out]    *pCos      points to the block of cosine values, or NULL.
+ * @param[in]     blockSize  number of samples to generate.
+ * @return none.
+ *
+ * \par
+ * The interpolation uses 15 fraction bits of the phase instead of the 6 bits of riscv_sin_q15(),
+ * so the output can differ from riscv_sin_q15() of the truncated phase by a few LSB.
+ */
+
+void riscv_nco_q15(
+  riscv_nco_instance_q15 * S,
+  q15_t * pSin,
+  q15_t * pCos,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_nco_q15);
+  if(pSin != NULL)
+  {
+    riscv_nco_block_q15(S->phase, S->phaseInc, pSin, blockSize);
+  }
+
+  /* A quarter turn ahead of the sine */
+  if(pCos != NULL)
+  {
+    riscv_nco_block_q15(S->phase + 0x40000000u, S->phaseInc, pCos, blockSize);
+  }
+
+  S->phase += blockSize * S->phaseInc;
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_nco_q31.c
+*
+* Description:  Q31 numerically controlled oscillator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/*
+* @brief  Generates a block of sine values from the phase accumulator.
+* @param[in]  phase      phase of the first sample, plus the offset of the output.
+* @param[in]  phaseInc   phase increment per sample.
+* @param[out] *pDst      points to the output block.
+* @param[in]  blockSize  number of samples.
+*/
+
+static void riscv_nco_block_q31(
+  uint32_t phase,
+  uint32_t phaseInc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t index;                                /* Table index */
+  q31_t fract;                                   /* Interpolation fraction in 1.31 format */
+  q31_t a, b;                                    /* Two nearest table values */
+  q31_t sinVal;
+
+  while(blockSize > 0u)
+  {
+    index = phase >> 23u;
+    fract = (q31_t) ((phase & 0x007FFFFFu) << 8u);
+    a = sinTable_q31[index];
+    b = sinTable_q31[index + 1];
+
+    /* Linear interpolation process, as riscv_sin_q31() */
+    sinVal = (q31_t) (((0x80000000LL - fract) * a) >> 32);
+    sinVal = (q31_t) ((((q63_t) sinVal << 32) + ((q63_t) fract * b)) >> 32);
+    *pDst++ = (q31_t) ((uint32_t) sinVal << 1);
+
+    phase += phaseInc;
+
+    /* Decrement the loop counter */
+    blockSize--;
+  }
+}
+
+/**
+ * @brief Processing function for the Q31 NCO.
+ * @param[in,out] *S         points to an instance of the Q31 NCO structure.
+ * @param[out]    *pSin      points to the block of sine values, or NULL.
+ * @param[out]    *pCos      points to the block of cosine values, or NULL.
+ * @param[in]     blockSize  number of samples to generate.
+ * @return none.
+ */
+
+void riscv_nco_q31(
+  riscv_nco_instance_q31 * S,
+  q31_t * pSin,
+  q31_t * pCos,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_nco_q31);
+  if(pSin != NULL)
+  {
+    riscv_nco_block_q31(S->phase, S->phaseInc, pSin, blockSize);
+  }
+
+  /* A quarter turn ahead of the sine */
+  if(pCos != NULL)
+  {
+    riscv_nco_block_q31(S->phase + 0x40000000u, S->phaseInc, pCos, blockSize);
+  }
+
+  S->phase += blockSize * S->phaseInc;
+}
+
+/**
+ * @} end of NCO group
+ */
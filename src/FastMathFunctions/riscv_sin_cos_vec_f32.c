@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sin_cos_vec_f32.c
+*
+* Description:  Block sine and cosine of floating-point vectors.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/*
+* @brief  Table lookup of a phase in turns.
+* @param[in]  in  phase, in turns, of any sign.
+* @return     sine of the phase.
+*/
+
+static inline float32_t riscv_sin_turns_f32(
+  float32_t in)
+{
+  float32_t findex, fract;
+  int32_t n;
+  uint32_t index;
+
+  /* Map the input to [0 1) */
+  n = (int32_t) in;
+  if(in < 0.0f)
+  {
+    n--;
+  }
+
+  findex = (float32_t) FAST_MATH_TABLE_SIZE * (in - (float32_t) n);
+  index = (uint32_t) findex;
+
+  /* in - n may round up to 1.0 */
+  if(index >= FAST_MATH_TABLE_SIZE)
+  {
+    index -= FAST_MATH_TABLE_SIZE;
+    findex -= (float32_t) FAST_MATH_TABLE_SIZE;
+  }
+
+  fract = findex - (float32_t) index;
+
+  return ((1.0f - fract) * sinTable_f32[index] + fract * sinTable_f32[index + 1]);
+}
+
+/*
+* @brief  Sine of a block of angles advanced by a fraction of a turn.
+* @param[in]  *pSrc      points to the angles in radians.
+* @param[out] *pDst      points to the results.
+* @param[in]  offset     phase offset in turns, 0 for sine and 0.25 for cosine.
+* @param[in]  blockSize  number of samples.
+*/
+
+static void riscv_sin_vec_offset_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  float32_t offset,
+  uint32_t blockSize)
+{
+  float32_t in0, in1;                            /* Phases in turns */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Two samples per iteration, the lookups of the pair do not depend on each other */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    in0 = pSrc[0] * 0.159154943092f + offset;
+    in1 = pSrc[1] * 0.159154943092f + offset;
+    pSrc += 2;
+
+    pDst[0] = riscv_sin_turns_f32(in0);
+    pDst[1] = riscv_sin_turns_f32(in1);
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  if((blockSize & 1u) != 0u)
+  {
+    *pDst = riscv_sin_turns_f32(*pSrc * 0.159154943092f + offset);
+  }
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup sin
+ * @{
+ */
+
+/**
+ * @brief  Sine of a floating-point vector.
+ * @param[in]  *pSrc      points to the input vector, angles in radians.
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * Computes <code>pDst[n] = riscv_sin_f32(pSrc[n])</code> with the table and interpolation of
+ * riscv_sin_f32(), without the call per sample.  Two samples are computed per iteration.
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+ */
+
+void riscv_sin_vec_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_sin_vec_f32);
+  riscv_sin_vec_offset_f32(pSrc, pDst, 0.0f, blockSize);
+}
+
+/**
+ * @} end of sin group
+ */
+
+/**
+ * @addtogroup cos
+ * @{
+ */
+
+/**
+ * @brief  Cosine of a floating-point vector.
+ * @param[in]  *pSrc      points to the input vector, angles in radians.
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * Computes <code>pDst[n] = riscv_cos_f32(pSrc[n])</code>, two samples per iteration.
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+ */
+
+void riscv_cos_vec_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cos_vec_f32);
+  riscv_sin_vec_offset_f32(pSrc, pDst, 0.25f, blockSize);
+}
+
+/**
+ * @} end of cos group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sin_cos_vec_q15.c
+*
+* Description:  Block sine and cosine of Q15 vectors.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/*
+* @brief  Table lookup of a phase in [0 +1).
+* @param[in]  x  phase, 0 to 0x7FFF.
+* @return     sine of the phase, as riscv_sin_q15().
+*/
+
+static inline q15_t riscv_sin_phase_q15(
+  uint32_t x)
+{
+  uint32_t index = x >> FAST_MATH_Q15_SHIFT;     /* Table index */
+  q15_t fract;                                   /* Fractional part of the index */
+  q15_t sinVal;
+
+  fract = (q15_t) ((x - (index << FAST_MATH_Q15_SHIFT)) << 9);
+
+  /* Linear interpolation process */
+  sinVal = (q15_t) (((q31_t) (0x8000 - fract) * sinTable_q15[index]) >> 16);
+  sinVal = (q15_t) ((((q31_t) sinVal << 16) + ((q31_t) fract * sinTable_q15[index + 1])) >> 16);
+
+  return ((q15_t) (sinVal << 1));
+}
+
+/*
+* @brief  Sine of a block of phases advanced by a fraction of a turn.
+* @param[in]  *pSrc      points to the phases.
+* @param[out] *pDst      points to the results.
+* @param[in]  offset     phase offset, 0 for sine and 0x2000 for cosine.
+* @param[in]  blockSize  number of samples.
+*/
+
+static void riscv_sin_vec_offset_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t offset,
+  uint32_t blockSize)
+{
+  uint32_t x0, x1;                               /* Phases */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Two samples per iteration, the lookups of the pair do not depend on each other */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* The mask wraps the phase to [0 +1) */
+    x0 = ((uint32_t) pSrc[0] + offset) & 0x7FFFu;
+    x1 = ((uint32_t) pSrc[1] + offset) & 0x7FFFu;
+    pSrc += 2;
+
+    pDst[0] = riscv_sin_phase_q15(x0);
+    pDst[1] = riscv_sin_phase_q15(x1);
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  if((blockSize & 1u) != 0u)
+  {
+    *pDst = riscv_sin_phase_q15(((uint32_t) *pSrc + offset) & 0x7FFFu);
+  }
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup sin
+ * @{
+ */
+
+/**
+ * @brief  Sine of a Q15 vector.
+ * @param[in]  *pSrc      points to the input vector, scaled angles as for riscv_sin_q15().
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * Computes <code>pDst[n] = riscv_sin_q15(pSrc[n])</code>, two samples per iteration.
+ * Negative inputs wrap around, <code>-x</code> is the angle <code>1-x</code>.
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+ */
+
+void riscv_sin_vec_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_sin_vec_q15);
+  riscv_sin_vec_offset_q15(pSrc, pDst, 0u, blockSize);
+}
+
+/**
+ * @} end of sin group
+ */
+
+/**
+ * @addtogroup cos
+ * @{
+ */
+
+/**
+ * @brief  Cosine of a Q15 vector.
+ * @param[in]  *pSrc      points to the input vector, scaled angles as for riscv_cos_q15().
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * Computes <code>pDst[n] = riscv_cos_q15(pSrc[n])</code>, two samples per iteration.
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+ */
+
+void riscv_cos_vec_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cos_vec_q15);
+  riscv_sin_vec_offset_q15(pSrc, pDst, 0x2000u, blockSize);
+}
+
+/**
+ * @} end of cos group
+ */
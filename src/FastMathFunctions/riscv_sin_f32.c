@@ -70,6 +70,11 @@
  *    b=Table[index+0];
  *    c=Table[index+1];
  * </pre>
+ *
+ * \par
+ * Built with RISCV_MATH_SIN_COS_TABLE64 or RISCV_MATH_SIN_COS_POLY (CMake RISCV_DSP_SIN_COS) the
+ * functions use a 64-interval quarter-wave table with quadratic interpolation or a minimax
+ * polynomial instead, see FAST_MATH_TABLE_SIZE in riscv_math.h for the error and cost of each tier.
  */
 
 /**
@@ -86,6 +91,21 @@
 float32_t riscv_sin_f32(
   float32_t x)
 {
+  RISCV_PROFILE(riscv_sin_f32);
+#if defined (RISCV_MATH_SIN_COS_POLY) || defined (RISCV_MATH_SIN_COS_TABLE64)
+  float32_t in;                                  /* Input in turns */
+  int32_t n;
+
+  /* Scale the input to turns and map it to [0 1] */
+  in = x * 0.159154943092f;
+  n = (int32_t) in;
+  if(x < 0.0f)
+  {
+    n--;
+  }
+
+  return (riscv_sin_tier_f32(in - (float32_t) n));
+#else
   float32_t sinVal, fract, in;                           /* Temporary variables for input, output */
   uint16_t index;                                        /* Index variable */
   float32_t a, b;                                        /* Two nearest output values */
@@ -128,6 +148,7 @@ float32_t riscv_sin_f32(
 
   /* Return the output value */
   return (sinVal);
+#endif
 }
 
 /**
@@ -63,6 +63,13 @@
 q15_t riscv_sin_q15(
   q15_t x)
 {
+  RISCV_PROFILE(riscv_sin_q15);
+#if defined (RISCV_MATH_SIN_COS_POLY) || defined (RISCV_MATH_SIN_COS_TABLE64)
+  q31_t y = riscv_sin_tier_q31((uint32_t) x << 17);
+
+  /* Round the Q31 sine to Q15 */
+  return (clip_q31_to_q15((q31_t) (((q63_t) y + 0x8000) >> 16)));
+#else
   q15_t sinVal;                                  /* Temporary variables for input, output */
   int32_t index;                                 /* Index variables */
   q15_t a, b;                                    /* Four nearest output values */
@@ -83,6 +90,7 @@ q15_t riscv_sin_q15(
   sinVal = (q15_t)((((q31_t)sinVal << 16) + ((q31_t)fract*b)) >> 16);
 
   return sinVal << 1;
+#endif
 }
 
 /**    
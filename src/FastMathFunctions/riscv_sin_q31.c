@@ -62,6 +62,10 @@
 q31_t riscv_sin_q31(
   q31_t x)
 {
+  RISCV_PROFILE(riscv_sin_q31);
+#if defined (RISCV_MATH_SIN_COS_POLY) || defined (RISCV_MATH_SIN_COS_TABLE64)
+  return (riscv_sin_tier_q31((uint32_t) x << 1));
+#else
   q31_t sinVal;                                  /* Temporary variables for input, output */
   int32_t index;                                 /* Index variables */
   q31_t a, b;                                    /* Four nearest output values */
@@ -85,6 +89,7 @@ q31_t riscv_sin_q31(
   sinVal = (q31_t)((((q63_t)sinVal << 32) + ((q63_t)fract*b)) >> 32);
   //printf("sinVal2= %X\n",sinVal);
   return sinVal << 1;
+#endif
 }
 
 /**    
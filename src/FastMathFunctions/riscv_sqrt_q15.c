@@ -59,20 +59,18 @@
    * @return The function returns ARM_MATH_SUCCESS if the input value is positive
    * and ARM_MATH_ARGUMENT_ERROR if the input is negative.  For
    * negative inputs, the function returns *pOut = 0.
+   *
+   * \par
+   * The initial guess of the inverse square root is read from invSqrtTable_q15 in 2.14 format,
+   * so the function does not need floating-point support.
    */
 
 riscv_status riscv_sqrt_q15(
   q15_t in,
   q15_t * pOut)
 {
+  RISCV_PROFILE(riscv_sqrt_q15);
   q15_t number, temp1, var1, signBits1, half;
-  q31_t bits_val1;
-  float32_t temp_float1;
-  union
-  {
-    q31_t fracval;
-    float32_t floatval;
-  } tempconv;
 
   number = in;
 
@@ -96,18 +94,8 @@ riscv_status riscv_sqrt_q15(
     /* Store the number for later use */
     temp1 = number;
 
-    /* Convert to float */
-    temp_float1 = number * 3.051757812500000e-005f;
-    /*Store as integer */
-    tempconv.floatval = temp_float1;
-    bits_val1 = tempconv.fracval;
-    /* Subtract the shifted value from the magic number to give intial guess */
-    bits_val1 = 0x5f3759df - (bits_val1 >> 1);  /* gives initial guess */
-    /* Store as float */
-    tempconv.fracval = bits_val1;
-    temp_float1 = tempconv.floatval;
-    /* Convert to integer format */
-    var1 = (q31_t) (temp_float1 * 16384);
+    /* Initial guess of 1/sqrt(number) in 2.14 format from the leading bits */
+    var1 = invSqrtTable_q15[(number >> 9) - 16];
 
 
 /*
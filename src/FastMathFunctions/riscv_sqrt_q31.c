@@ -58,19 +58,18 @@
  * @return The function returns ARM_MATH_SUCCESS if the input value is positive
  * and ARM_MATH_ARGUMENT_ERROR if the input is negative.  For
  * negative inputs, the function returns *pOut = 0.
+ *
+ * \par
+ * The seed comes from the same table as riscv_sqrt_q15(), widened to 2.30 format, and the three
+ * iterations use 64-bit integer products only.
  */
 
 riscv_status riscv_sqrt_q31(
   q31_t in,
   q31_t * pOut)
 {
-  q31_t number, temp1, bits_val1, var1, signBits1, half;
-  float32_t temp_float1;
-  union
-  {
-      q31_t fracval;
-      float32_t floatval;
-  } tempconv;
+  RISCV_PROFILE(riscv_sqrt_q31);
+  q31_t number, temp1, var1, signBits1, half;
 
   number = in;
 
@@ -94,18 +93,8 @@ riscv_status riscv_sqrt_q31(
     /* Store the number for later use */
     temp1 = number;
 
-    /*Convert to float */
-    temp_float1 = number * 4.6566128731e-010f;
-    /*Store as integer */
-    tempconv.floatval = temp_float1;
-    bits_val1 = tempconv.fracval;
-    /* Subtract the shifted value from the magic number to give intial guess */
-    bits_val1 = 0x5f3759df - (bits_val1 >> 1);  /* gives initial guess */
-    /* Store as float */
-    tempconv.fracval = bits_val1;
-    temp_float1 = tempconv.floatval;
-    /* Convert to integer format */
-    var1 = (q31_t) (temp_float1 * 1073741824);
+    /* Initial guess of 1/sqrt(number) in 2.30 format from the leading bits */
+    var1 = (q31_t) invSqrtTable_q15[(number >> 25) - 16] << 16;
 
     /* 1st iteration */
     var1 = ((q31_t) ((q63_t) var1 * (0x30000000 -
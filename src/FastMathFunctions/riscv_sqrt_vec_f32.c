@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sqrt_vec_f32.c
+*
+* Description:  Square root of a floating-point vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup SQRT
+ * @{
+ */
+
+/**
+ * @brief  Square root of a floating-point vector.
+ * @param[in]  *pSrc      points to the input vector.
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * Computes <code>pDst[n]</code> as riscv_sqrt_f32() of <code>pSrc[n]</code>, negative inputs give 0.
+ * Two samples are computed per iteration, so that with the F extension the second
+ * <code>fsqrt.s</code> is issued while the first one is still in flight.
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+ */
+
+void riscv_sqrt_vec_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_sqrt_vec_f32);
+  float32_t in0, in1;                            /* Input values */
+  uint32_t blkCnt;                               /* loop counter */
+
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    in0 = pSrc[0];
+    in1 = pSrc[1];
+    pSrc += 2;
+
+    (void) riscv_sqrt_f32(in0, &pDst[0]);
+    (void) riscv_sqrt_f32(in1, &pDst[1]);
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  if((blockSize & 1u) != 0u)
+  {
+    (void) riscv_sqrt_f32(*pSrc, pDst);
+  }
+}
+
+/**
+ * @} end of SQRT group
+ */
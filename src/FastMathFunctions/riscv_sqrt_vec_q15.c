@@ -0,0 +1,52 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sqrt_vec_q15.c
+*
+* Description:  Square root of a Q15 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup SQRT
+ * @{
+ */
+
+/**
+ * @brief  Square root of a Q15 vector.
+ * @param[in]  *pSrc      points to the input vector, values in the range [0 +1) or 0x0000 to 0x7FFF.
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * Computes <code>pDst[n]</code> as riscv_sqrt_q15() of <code>pSrc[n]</code>, negative inputs give 0.
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+ */
+
+void riscv_sqrt_vec_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_sqrt_vec_q15);
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    (void) riscv_sqrt_q15(*pSrc++, pDst++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of SQRT group
+ */
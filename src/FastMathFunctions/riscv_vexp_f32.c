@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_vexp_f32.c
+*
+* Description:  Fast exponential of a floating-point vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vexp Vector Exponential
+ *
+ * Computes <code>pDst[n] = exp(pSrc[n])</code> for softmax, envelope and dB to linear conversions,
+ * without the library expf().
+ * \par
+ * The fixed-point versions cover <code>x <= 0</code>, where the result fits the output format:
+ * the Q31 input is in 5.26 format and the Q15 input in 4.11 format, the output formats of
+ * riscv_vlog_q31() and riscv_vlog_q15().  Positive inputs saturate.
+ */
+
+/**
+ * @addtogroup vexp
+ * @{
+ */
+
+/**
+ * @brief  Fast exponential of a floating-point vector.
+ * @param[in]  *pSrc      points to the input vector.
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * The input is split into <code>k*log(2) + r</code> with <code>|r| <= log(2)/2</code>,
+ * <code>exp(r)</code> is a degree 6 polynomial and <code>2^k</code> is built in the exponent field.
+ * The relative error is below 3e-7.  Results below the smallest normal number are flushed to 0
+ * and results above the largest one give infinity.
+ */
+
+void riscv_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_vexp_f32);
+  float32_t x, r, p;                             /* Input, reduced argument, polynomial */
+  int32_t k;                                     /* Exponent of the result */
+  union
+  {
+    uint32_t bits;
+    float32_t value;
+  } scale;
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pSrc++;
+
+    if(x < -87.3365447f)
+    {
+      *pDst++ = 0.0f;
+    }
+    else if(x > 88.7228391f)
+    {
+      *pDst++ = INFINITY;
+    }
+    else
+    {
+      /* k = round(x / log(2)), log(2) in two parts so that r is exact */
+      k = (int32_t) ((x * 1.44269504089f) + ((x < 0.0f) ? -0.5f : 0.5f));
+      r = (x - ((float32_t) k * 0.693145751953125f)) - ((float32_t) k * 1.428606820309e-6f);
+
+      p = 1.0f + r * (1.0f + r * (0.5f + r * (0.166666667f + r * (0.0416666667f + r * (0.00833333333f + r * 0.00138888889f)))));
+
+      /* 2^128 is not a float, scale by 2^127 and double */
+      if(k > 127)
+      {
+        scale.bits = (uint32_t) (k + 126) << 23;
+        p *= 2.0f;
+      }
+      else
+      {
+        scale.bits = (uint32_t) (k + 127) << 23;
+      }
+
+      *pDst++ = p * scale.value;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vexp group
+ */
@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_vexp_q15.c
+*
+* Description:  Fast exponential of a Q15 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vexp
+ * @{
+ */
+
+/**
+ * @brief  Fast exponential of a Q15 vector.
+ * @param[in]  *pSrc      points to the input vector in 4.11 format, the output format of riscv_vlog_q15().
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * The samples are widened to 5.26 format in groups of 16 and processed with riscv_vexp_q31(),
+ * the result is rounded to Q15 and is within 1 LSB.  Inputs <code>>= 0</code> saturate to 0x7FFF.
+ */
+
+void riscv_vexp_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_vexp_q15);
+  q31_t buf[16];                                 /* 5.26 copy of a group of samples */
+  uint32_t blkCnt, i;                            /* loop counters */
+
+  while(blockSize > 0u)
+  {
+    blkCnt = (blockSize < 16u) ? blockSize : 16u;
+
+    for (i = 0u; i < blkCnt; i++)
+    {
+      buf[i] = (q31_t) pSrc[i] << 15;
+    }
+
+    riscv_vexp_q31(buf, buf, blkCnt);
+
+    /* Q31 to Q15 with rounding and saturation */
+    for (i = 0u; i < blkCnt; i++)
+    {
+      pDst[i] = (q15_t) __SSAT((buf[i] >> 16) + ((buf[i] >> 15) & 1), 16);
+    }
+
+    pSrc += blkCnt;
+    pDst += blkCnt;
+    blockSize -= blkCnt;
+  }
+}
+
+/**
+ * @} end of vexp group
+ */
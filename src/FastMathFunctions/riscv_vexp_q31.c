@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_vexp_q31.c
+*
+* Description:  Fast exponential of a Q31 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vexp
+ * @{
+ */
+
+/**
+ * @brief  Fast exponential of a Q31 vector.
+ * @param[in]  *pSrc      points to the input vector in 5.26 format, the output format of riscv_vlog_q31().
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * <code>exp(x)</code> is computed as <code>2^-w</code> with <code>w = -x*log2(e)</code>.
+ * The integer part of <code>w</code> is a shift, the five leading fraction bits select an entry of
+ * exp2Table_q31 and the remaining fraction <code>g < 1/32</code> is evaluated with a degree 4
+ * polynomial of <code>exp(-g*log(2))</code>.
+ * The absolute error is below 4 LSB.  Inputs <code>>= 0</code> saturate to 0x7FFFFFFF.
+ */
+
+void riscv_vexp_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_vexp_q31);
+  q31_t x, t, p;                                 /* Input, reduced argument, polynomial */
+  q63_t acc;                                     /* Accumulator */
+  uint64_t w;                                    /* -x*log2(e) in 8.56 format */
+  uint32_t k, j;                                 /* Integer part of w and table index */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pSrc++;
+
+    if(x >= 0)
+    {
+      *pDst++ = 0x7FFFFFFF;
+    }
+    else
+    {
+      /* log2(e) in 2.30 format */
+      w = (uint64_t) (0u - (uint32_t) x) * 0x5C551D95u;
+      k = (uint32_t) (w >> 56);
+
+      if(k > 31u)
+      {
+        *pDst++ = 0;
+      }
+      else
+      {
+        j = (uint32_t) (w >> 51) & 31u;
+
+        /* t = g * log(2) in 1.31 format */
+        t = (q31_t) (((q63_t) ((w >> 25) & 0x03FFFFFFu) * 0x58B90BFC) >> 31);
+
+        /* exp(-t) = 1 - t * (1 - t * (1/2 - t * (1/6 - t/24))), the last step in 2.30 format */
+        p = 0x15555555 - (q31_t) (((q63_t) t * 0x05555555) >> 31);
+        p = 0x40000000 - (q31_t) (((q63_t) t * p) >> 31);
+        p = 0x7FFFFFFF - (q31_t) (((q63_t) t * p) >> 31);
+        p = 0x40000000 - (q31_t) (((q63_t) t * p) >> 32);
+
+        /* 2.30 times 2.30, down to 1.31 and by 2^-k with rounding */
+        acc = (q63_t) exp2Table_q31[j] * p;
+        acc = (acc + ((q63_t) 1 << (28u + k))) >> (29u + k);
+        *pDst++ = (acc > 0x7FFFFFFF) ? 0x7FFFFFFF : (q31_t) acc;
+      }
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vexp group
+ */
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_vinverse_f32.c
+*
+* Description:  Fast reciprocal of a floating-point vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vinverse Vector Reciprocal
+ *
+ * Computes <code>pDst[n] = 1/pSrc[n]</code>.
+ * \par
+ * The floating-point version needs no divider.  The Q15 and Q31 versions apply riscv_recip_q15()
+ * and riscv_recip_q31() to a block.  They return the mantissa of the reciprocal together with a
+ * shift, as those functions do:
+ * <pre>
+ *     1/pSrc[n] = pDst[n] * 2^pShift[n]
+ * </pre>
+ * where <code>pSrc[n]</code> and <code>pDst[n]</code> are read as fractional values.
+ */
+
+/**
+ * @addtogroup vinverse
+ * @{
+ */
+
+/**
+ * @brief  Fast reciprocal of a floating-point vector.
+ * @param[in]  *pSrc      points to the input vector.
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * An initial guess is obtained by subtracting the bit pattern of the input from a constant and is
+ * refined with three Newton-Raphson steps <code>r = r*(2 - x*r)</code>, three multiplications and
+ * one subtraction per step.  The relative error is below 2e-7 for normal nonzero inputs, zero,
+ * denormal and infinite inputs are not supported.
+ */
+
+void riscv_vinverse_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_vinverse_f32);
+  float32_t x;                                   /* Input */
+  union
+  {
+    uint32_t bits;
+    float32_t value;
+  } r;                                           /* Estimate of 1/x */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pSrc++;
+    r.value = x;
+    r.bits = 0x7EF311C3u - r.bits;
+
+    r.value = r.value * (2.0f - (x * r.value));
+    r.value = r.value * (2.0f - (x * r.value));
+    r.value = r.value * (2.0f - (x * r.value));
+
+    *pDst++ = r.value;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vinverse group
+ */
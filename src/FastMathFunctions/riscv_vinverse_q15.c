@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_vinverse_q15.c
+*
+* Description:  Reciprocal of a Q15 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vinverse
+ * @{
+ */
+
+/**
+ * @brief  Reciprocal of a Q15 vector.
+ * @param[in]  *pSrc      points to the input vector.
+ * @param[out] *pDst      points to the mantissas of the reciprocals.
+ * @param[out] *pShift    points to the shifts of the reciprocals.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * riscv_recip_q15() with riscvRecipTableQ15 is applied to the magnitude of every sample and the sign
+ * is restored afterwards.  An input of 0 gives the largest value, <code>0x7FFF</code> with shift 15.
+ */
+
+void riscv_vinverse_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint8_t * pShift,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_vinverse_q15);
+  q15_t in, mag, out;                            /* Input, its magnitude and mantissa of the reciprocal */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(in == 0)
+    {
+      *pDst++ = 0x7FFF;
+      *pShift++ = 15;
+    }
+    else
+    {
+      /* The table covers positive inputs only, the most negative value saturates */
+      mag = (in > 0) ? in : ((in == (q15_t) 0x8000) ? 0x7FFF : -in);
+      *pShift++ = (uint8_t) riscv_recip_q15(mag, &out, (q15_t *) riscvRecipTableQ15);
+      *pDst++ = (in > 0) ? out : -out;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vinverse group
+ */
@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_vinverse_q31.c
+*
+* Description:  Reciprocal of a Q31 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vinverse
+ * @{
+ */
+
+/**
+ * @brief  Reciprocal of a Q31 vector.
+ * @param[in]  *pSrc      points to the input vector.
+ * @param[out] *pDst      points to the mantissas of the reciprocals.
+ * @param[out] *pShift    points to the shifts of the reciprocals.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * riscv_recip_q31() with riscvRecipTableQ31 is applied to the magnitude of every sample and the sign
+ * is restored afterwards.  An input of 0 gives the largest value, <code>0x7FFFFFFF</code> with shift 31.
+ */
+
+void riscv_vinverse_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint8_t * pShift,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_vinverse_q31);
+  q31_t in, mag, out;                            /* Input, its magnitude and mantissa of the reciprocal */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(in == 0)
+    {
+      *pDst++ = 0x7FFFFFFF;
+      *pShift++ = 31;
+    }
+    else
+    {
+      /* The table covers positive inputs only, the most negative value saturates */
+      mag = (in > 0) ? in : ((in == (q31_t) 0x80000000) ? 0x7FFFFFFF : -in);
+      *pShift++ = (uint8_t) riscv_recip_q31(mag, &out, (q31_t *) riscvRecipTableQ31);
+      *pDst++ = (in > 0) ? out : -out;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vinverse group
+ */
@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_vlog_f32.c
+*
+* Description:  Fast natural logarithm of a floating-point vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vlog Vector Logarithm
+ *
+ * Computes <code>pDst[n] = log(pSrc[n])</code>, the natural logarithm, for dB conversions and
+ * log-mel features, without the library logf().
+ * \par
+ * The Q31 output is in 5.26 format and the Q15 output in 4.11 format, which covers the
+ * logarithm of the smallest positive input.
+ */
+
+/**
+ * @addtogroup vlog
+ * @{
+ */
+
+/**
+ * @brief  Fast natural logarithm of a floating-point vector.
+ * @param[in]  *pSrc      points to the input vector.
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * The input is split into <code>m*2^e</code> with <code>m</code> in [sqrt(1/2) sqrt(2)) from its
+ * exponent field and
+ * <pre>
+ *     log(m) = 2*s*(1 + s^2/3 + s^4/5 + s^6/7 + s^8/9),  s = (m-1)/(m+1)
+ * </pre>
+ * The absolute error is below 1e-7 for inputs in [0.6 1.6] and 1.5 ulp of the result elsewhere.  0 gives minus infinity and negative inputs give NaN.
+ */
+
+void riscv_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_vlog_f32);
+  float32_t m, s, s2, p;                         /* Mantissa, reduced argument, polynomial */
+  int32_t e;                                     /* Exponent of the input */
+  union
+  {
+    uint32_t bits;
+    float32_t value;
+  } in;
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in.value = *pSrc++;
+
+    if(in.value <= 0.0f)
+    {
+      *pDst++ = (in.value == 0.0f) ? -INFINITY : NAN;
+    }
+    else
+    {
+      e = -127;
+
+      /* Denormal inputs are normalized first */
+      if((in.bits >> 23) == 0u)
+      {
+        in.value *= 8388608.0f;
+        e -= 23;
+      }
+
+      e += (int32_t) (in.bits >> 23);
+      in.bits = (in.bits & 0x007FFFFFu) | 0x3F800000u;
+      m = in.value;
+
+      if(m > 1.41421356f)
+      {
+        m *= 0.5f;
+        e++;
+      }
+
+      s = (m - 1.0f) / (m + 1.0f);
+      s2 = s * s;
+      p = 2.0f * s * (1.0f + s2 * (0.333333333f + s2 * (0.2f + s2 * (0.142857143f + s2 * 0.111111111f))));
+
+      /* e*log(2) in two parts */
+      *pDst++ = ((float32_t) e * 0.693145751953125f) + (((float32_t) e * 1.428606820309e-6f) + p);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vlog group
+ */
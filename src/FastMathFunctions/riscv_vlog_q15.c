@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_vlog_q15.c
+*
+* Description:  Fast natural logarithm of a Q15 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vlog
+ * @{
+ */
+
+/**
+ * @brief  Fast natural logarithm of a Q15 vector.
+ * @param[in]  *pSrc      points to the input vector, values in the range (0 +1).
+ * @param[out] *pDst      points to the output vector in 4.11 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * The samples are widened to Q31 in groups of 16 and processed with riscv_vlog_q31(), so the
+ * result is the 5.26 value of riscv_vlog_q31() rounded to 4.11 format, within 1 LSB.
+ * Inputs <code><= 0</code> give 0x8000.
+ */
+
+void riscv_vlog_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_vlog_q15);
+  q31_t buf[16];                                 /* Q31 copy of a group of samples */
+  uint32_t blkCnt, i;                            /* loop counters */
+
+  while(blockSize > 0u)
+  {
+    blkCnt = (blockSize < 16u) ? blockSize : 16u;
+
+    for (i = 0u; i < blkCnt; i++)
+    {
+      buf[i] = (q31_t) pSrc[i] << 16;
+    }
+
+    riscv_vlog_q31(buf, buf, blkCnt);
+
+    /* 5.26 to 4.11 with rounding, the result is at least log(2^-15) */
+    for (i = 0u; i < blkCnt; i++)
+    {
+      pDst[i] = (buf[i] == INT32_MIN) ? (q15_t) 0x8000 : (q15_t) ((buf[i] + 0x4000) >> 15);
+    }
+
+    pSrc += blkCnt;
+    pDst += blkCnt;
+    blockSize -= blkCnt;
+  }
+}
+
+/**
+ * @} end of vlog group
+ */
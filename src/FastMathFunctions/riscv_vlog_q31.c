@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_vlog_q31.c
+*
+* Description:  Fast natural logarithm of a Q31 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vlog
+ * @{
+ */
+
+/**
+ * @brief  Fast natural logarithm of a Q31 vector.
+ * @param[in]  *pSrc      points to the input vector, values in the range (0 +1).
+ * @param[out] *pDst      points to the output vector in 5.26 format.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * \par
+ * The input is normalized with __CLZ() to <code>m*2^-e</code>, <code>m</code> in [1 2).
+ * <code>m</code> is then multiplied by the entry of logRecipTable_q31 selected by its five leading
+ * fraction bits, which leaves a product <code>1+v</code> with <code>|v| <= 1/64</code>, and
+ * <pre>
+ *     log(x) = logTable_q31[i] + v - v^2/2 + v^3/3 - v^4/4 - e*log(2)
+ * </pre>
+ * The absolute error is below 2 LSB of the 5.26 result.  Inputs <code><= 0</code> give 0x80000000.
+ */
+
+void riscv_vlog_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_vlog_q31);
+  q31_t x, v, p;                                 /* Normalized input, reduced argument, polynomial */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t n, i;                                 /* Normalization shift and table index */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pSrc++;
+
+    if(x <= 0)
+    {
+      *pDst++ = INT32_MIN;
+    }
+    else
+    {
+      /* x << n is m in 2.30 format, m in [1 2) */
+      n = __CLZ(x) - 1u;
+      x <<= n;
+      i = ((uint32_t) x >> 25) & 31u;
+
+      /* v = m * c - 1, in 1.31 format */
+      acc = (q63_t) x * logRecipTable_q31[i];
+      v = (q31_t) ((acc - ((q63_t) 1 << 61)) >> 30);
+
+      /* log(1 + v) = v + v * (v * (-1/2 + v * (1/3 - v/4))) */
+      p = 0x2AAAAAAB - (q31_t) (((q63_t) v * 0x20000000) >> 31);
+      p = (q31_t) (((q63_t) v * p) >> 31) - 0x40000000;
+      p = (q31_t) (((q63_t) v * p) >> 31);
+      p = v + (q31_t) (((q63_t) v * p) >> 31);
+
+      /* Add the table value and the exponent, x was (m/2) * 2^-n, round to 5.26 */
+      acc = ((q63_t) logTable_q31[i] + p) - ((q63_t) (n + 1u) * 0x58B90BFC);
+      *pDst++ = (q31_t) ((acc + 16) >> 5);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vlog group
+ */
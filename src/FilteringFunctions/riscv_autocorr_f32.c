@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_autocorr_f32.c
+*
+* Description:  Autocorrelation of a floating-point sequence at lags 0 to maxLag.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LPC
+ * @{
+ */
+
+/**
+ * @brief Autocorrelation of a floating-point sequence.
+ * @param[in]  *pSrc    points to the input sequence.
+ * @param[in]  srcLen   length of the input sequence.
+ * @param[out] *pDst    points to the <code>maxLag+1</code> output values.
+ * @param[in]  maxLag   last lag to compute, less than <code>srcLen</code>.
+ * @return none.
+ *
+ * \par
+ * <pre>
+ *    pDst[l] = pSrc[0] * pSrc[l] + pSrc[1] * pSrc[l+1] + ... + pSrc[srcLen-1-l] * pSrc[srcLen-1]
+ * </pre>
+ * Only the lags the predictor needs are computed, where riscv_correlate_f32() computes all
+ * <code>2*srcLen-1</code> of them.
+ */
+
+void riscv_autocorr_f32(
+  const float32_t * pSrc,
+  uint32_t srcLen,
+  float32_t * pDst,
+  uint32_t maxLag)
+{
+  RISCV_PROFILE(riscv_autocorr_f32);
+  const float32_t *px, *py;                      /* Sequence and its copy shifted by the lag */
+  float32_t sum0, sum1;                          /* Accumulators */
+  uint32_t l, k;                                 /* Loop counters */
+
+  for (l = 0u; l <= maxLag; l++)
+  {
+    px = pSrc;
+    py = pSrc + l;
+    sum0 = 0.0f;
+    sum1 = 0.0f;
+
+    /* Loop unrolling.  Compute 4 MACs at a time in two accumulators. */
+    k = (srcLen - l) >> 2u;
+
+    while(k > 0u)
+    {
+      sum0 += px[0] * py[0];
+      sum1 += px[1] * py[1];
+      sum0 += px[2] * py[2];
+      sum1 += px[3] * py[3];
+
+      px += 4;
+      py += 4;
+      k--;
+    }
+
+    /* Remaining MACs */
+    k = (srcLen - l) % 0x4u;
+
+    while(k > 0u)
+    {
+      sum0 += *px++ * *py++;
+      k--;
+    }
+
+    *pDst++ = sum0 + sum1;
+  }
+}
+
+/**
+ * @} end of LPC group
+ */
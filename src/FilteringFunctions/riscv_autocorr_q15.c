@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_autocorr_q15.c
+*
+* Description:  Normalized autocorrelation of a Q15 sequence at lags 0 to maxLag.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LPC
+ * @{
+ */
+
+/**
+ * @brief Normalized autocorrelation of a Q15 sequence.
+ * @param[in]  *pSrc    points to the input sequence, 4-byte aligned.
+ * @param[in]  srcLen   length of the input sequence.
+ * @param[out] *pDst    points to the <code>maxLag+1</code> output values.
+ * @param[in]  maxLag   last lag to compute, less than <code>srcLen</code>.
+ * @return the exponent of the output, <code>pDst[l]</code> is the autocorrelation at lag l times <code>2^shift</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 2.30 products are accumulated in 64 bits, so no sum can overflow.  The sums are then shifted together
+ * so that <code>pDst[0]</code> lies in [0.5, 1) in 1.31 format and truncated; the other lags are not larger
+ * than lag 0 in magnitude.  The returned exponent undoes the shift, it does not matter to
+ * riscv_levinson_durbin_q15(), which only sees ratios of the lags.  A silent input returns zeros and 0.
+ * \par
+ * With <code>USE_DSP_RISCV</code> the MACs run on pairs of samples with the dot product instructions.
+ * Odd lags build the shifted pairs from two aligned loads with one shuffle, so no load is unaligned.
+ */
+
+int32_t riscv_autocorr_q15(
+  const q15_t * pSrc,
+  uint32_t srcLen,
+  q31_t * pDst,
+  uint32_t maxLag)
+{
+  RISCV_PROFILE(riscv_autocorr_q15);
+  const q15_t *px, *py;                          /* Sequence and its copy shifted by the lag */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t shift = 0u;                           /* Normalization of the sums */
+  uint32_t hi;
+  uint32_t l, k;                                 /* Loop counters */
+#if defined (USE_DSP_RISCV)
+  shortV odd = { 1, 2 };                         /* Pair straddling two aligned pairs */
+  shortV y0, y1;
+#endif
+
+  for (l = 0u; l <= maxLag; l++)
+  {
+    px = pSrc;
+    py = pSrc + l;
+    sum = 0;
+
+#if defined (USE_DSP_RISCV)
+
+    if((l & 1u) == 0u)
+    {
+      k = (srcLen - l) >> 1u;
+
+      while(k > 0u)
+      {
+        sum += dotpv2(*(shortV *) px, *(shortV *) py);
+        px += 2;
+        py += 2;
+        k--;
+      }
+
+      k = (srcLen - l) & 1u;
+    }
+    else
+    {
+      /* (py[0], py[1]) from the pairs at py - 1 and py + 1, the last load stays inside the input */
+      k = (srcLen - l - 1u) >> 1u;
+      y0 = *(shortV *) (py - 1);
+
+      while(k > 0u)
+      {
+        y1 = *(shortV *) (py + 1);
+        sum += dotpv2(*(shortV *) px, shufflev4(y0, y1, odd));
+        y0 = y1;
+        px += 2;
+        py += 2;
+        k--;
+      }
+
+      k = (srcLen - l) - (((srcLen - l - 1u) >> 1u) << 1u);
+    }
+
+#else
+
+    k = srcLen - l;
+
+#endif
+
+    while(k > 0u)
+    {
+      sum += (q31_t) *px++ * *py++;
+      k--;
+    }
+
+    /* Lag 0 is the largest and sets the shift */
+    if(l == 0u)
+    {
+      if(sum == 0)
+      {
+        memset(pDst, 0, (maxLag + 1u) * sizeof(q31_t));
+        return (0);
+      }
+
+      hi = (uint32_t) ((uint64_t) sum >> 32);
+      shift = (hi != 0u) ? (__CLZ(hi) - 1u) : (31u + __CLZ((uint32_t) sum));
+    }
+
+    *pDst++ = (q31_t) ((sum << shift) >> 32);
+  }
+
+  /* 2.30 sums shifted left by shift and truncated to 1.31 */
+  return ((int32_t) shift - 33);
+}
+
+/**
+ * @} end of LPC group
+ */
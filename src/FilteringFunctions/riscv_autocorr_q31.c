@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_autocorr_q31.c
+*
+* Description:  Normalized autocorrelation of a Q31 sequence at lags 0 to maxLag.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LPC
+ * @{
+ */
+
+/**
+ * @brief Normalized autocorrelation of a Q31 sequence.
+ * @param[in]  *pSrc    points to the input sequence.
+ * @param[in]  srcLen   length of the input sequence.
+ * @param[out] *pDst    points to the <code>maxLag+1</code> output values.
+ * @param[in]  maxLag   last lag to compute, less than <code>srcLen</code>.
+ * @return the exponent of the output, <code>pDst[l]</code> is the autocorrelation at lag l times <code>2^shift</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 2.62 products are shifted right by <code>ceil(log2(srcLen+1))</code> bits before they are accumulated
+ * in 64 bits, which leaves room for the sum of all of them.  The sums are then normalized as in
+ * riscv_autocorr_q15(): <code>pDst[0]</code> lies in [0.5, 1) in 1.31 format and the returned exponent
+ * undoes the scaling.  A silent input returns zeros and 0.
+ */
+
+int32_t riscv_autocorr_q31(
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  q31_t * pDst,
+  uint32_t maxLag)
+{
+  RISCV_PROFILE(riscv_autocorr_q31);
+  const q31_t *px, *py;                          /* Sequence and its copy shifted by the lag */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t guard = 32u - __CLZ(srcLen);          /* Guard bits of the accumulator */
+  uint32_t shift = 0u;                           /* Normalization of the sums */
+  uint32_t hi;
+  uint32_t l, k;                                 /* Loop counters */
+
+  for (l = 0u; l <= maxLag; l++)
+  {
+    px = pSrc;
+    py = pSrc + l;
+    sum = 0;
+
+    /* Loop unrolling.  Compute 4 MACs at a time. */
+    k = (srcLen - l) >> 2u;
+
+    while(k > 0u)
+    {
+      sum += ((q63_t) px[0] * py[0]) >> guard;
+      sum += ((q63_t) px[1] * py[1]) >> guard;
+      sum += ((q63_t) px[2] * py[2]) >> guard;
+      sum += ((q63_t) px[3] * py[3]) >> guard;
+
+      px += 4;
+      py += 4;
+      k--;
+    }
+
+    /* Remaining MACs */
+    k = (srcLen - l) % 0x4u;
+
+    while(k > 0u)
+    {
+      sum += ((q63_t) *px++ * *py++) >> guard;
+      k--;
+    }
+
+    /* Lag 0 is the largest and sets the shift */
+    if(l == 0u)
+    {
+      if(sum == 0)
+      {
+        memset(pDst, 0, (maxLag + 1u) * sizeof(q31_t));
+        return (0);
+      }
+
+      hi = (uint32_t) ((uint64_t) sum >> 32);
+      shift = (hi != 0u) ? (__CLZ(hi) - 1u) : (31u + __CLZ((uint32_t) sum));
+    }
+
+    *pDst++ = (q31_t) ((sum << shift) >> 32);
+  }
+
+  /* 2.62 sums shifted right by guard, left by shift and truncated to 1.31 */
+  return ((int32_t) shift - (int32_t) guard - 1);
+}
+
+/**
+ * @} end of LPC group
+ */
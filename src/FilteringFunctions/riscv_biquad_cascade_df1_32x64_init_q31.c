@@ -91,6 +91,7 @@ void riscv_biquad_cas_df1_32x64_init_q31(
   q63_t * pState,
   uint8_t postShift)
 {
+  RISCV_PROFILE(riscv_biquad_cas_df1_32x64_init_q31);
   /* Assign filter stages */
   S->numStages = numStages;
 
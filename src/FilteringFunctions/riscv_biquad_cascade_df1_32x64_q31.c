@@ -192,22 +192,99 @@ void riscv_biquad_cas_df1_32x64_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_biquad_cas_df1_32x64_q31);
   q31_t *pIn = pSrc;                             /*  input pointer initialization  */
   q31_t *pOut = pDst;                            /*  output pointer initialization */
   q63_t *pState = S->pState;                     /*  state pointer initialization  */
   q31_t *pCoeffs = S->pCoeffs;                   /*  coeff pointer initialization  */
   q63_t acc;                                     /*  accumulator                   */
   q31_t Xn1, Xn2;                                /*  Input Filter state variables        */
-  q63_t Yn1, Yn2;                                /*  Output Filter state variables        */
   q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
   q31_t Xn;                                      /*  temporary input               */
   int32_t shift = (int32_t) S->postShift + 1;    /*  Shift to be applied to the output */
   uint32_t sample, stage = S->numStages;         /*  loop counters                     */
+
+#if defined (USE_DSP_RISCV)
+
+  q31_t Yn1_h, Yn2_h;                            /*  High words of the output state variables */
+  uint32_t Yn1_l, Yn2_l;                         /*  Low words of the output state variables  */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* Reading the state values, the 1.63 output states are split in two words */
+    Xn1 = (q31_t) pState[0];
+    Xn2 = (q31_t) pState[1];
+    Yn1_h = (q31_t) (pState[2] >> 32);
+    Yn1_l = (uint32_t) pState[2];
+    Yn2_h = (q31_t) (pState[3] >> 32);
+    Yn2_l = (uint32_t) pState[3];
+
+    sample = blockSize;
+
+    while(sample > 0u)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2], 32x32 products (mul, mulh) */
+      acc = (q63_t) Xn *b0;
+      acc += (q63_t) Xn1 *b1;
+      acc += (q63_t) Xn2 *b2;
+
+      /* acc += a1 * y[n-1] + a2 * y[n-2], the 64x32 products of mult32x64() are split into  */
+      /* the high word times a (mul, mulh) and the low word times a, of which only the high */
+      /* half is kept (mulhsu).  No 64x64 multiplication is left for the runtime library.  */
+      acc += (q63_t) Yn1_h *a1;
+      acc += (q63_t) Yn2_h *a2;
+      acc += ((q63_t) a1 * Yn1_l) >> 32;
+      acc += ((q63_t) a2 * Yn2_l) >> 32;
+
+      /* Every time after the output is computed state should be updated. */
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2_h = Yn1_h;
+      Yn2_l = Yn1_l;
+
+      /* The result is converted to 1.63 */
+      acc = acc << shift;
+      Yn1_h = (q31_t) (acc >> 32);
+      Yn1_l = (uint32_t) acc;
+
+      /* The high word of the 1.63 state is the output in 1.31 format */
+      *pOut++ = Yn1_h;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /*  The first stage output is given as input to the second stage. */
+    pIn = pDst;
+
+    /* Reset to destination buffer working pointer */
+    pOut = pDst;
+
+    /*  Store the updated state variables back into the pState array */
+    *pState++ = (q63_t) Xn1;
+    *pState++ = (q63_t) Xn2;
+    *pState++ = (q63_t) (((uint64_t) (uint32_t) Yn1_h << 32) | Yn1_l);
+    *pState++ = (q63_t) (((uint64_t) (uint32_t) Yn2_h << 32) | Yn2_l);
+
+  } while(--stage);
+
+#else
+
+  q63_t Yn1, Yn2;                                /*  Output Filter state variables        */
   q31_t acc_l, acc_h;                            /*  temporary output               */
   uint32_t uShift = ((uint32_t) S->postShift + 1u);
   uint32_t lShift = 32u - uShift;                /*  Shift to be applied to the output */
 
-
   do
   {
     /* Reading the coefficients */
@@ -295,6 +372,7 @@ void riscv_biquad_cas_df1_32x64_q31(
 
   } while(--stage);
 
+#endif /* #if defined (USE_DSP_RISCV) */
 }
 
   /**    
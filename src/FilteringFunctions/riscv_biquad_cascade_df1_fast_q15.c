@@ -80,6 +80,9 @@ void riscv_biquad_cascade_df1_fast_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_biquad_cascade_df1_fast_q15);
+  RISCV_SAT_STATS(riscv_biquad_cascade_df1_fast_q15, 16);
+#if defined (USE_DSP_RISCV)
   q15_t *pIn = pSrc;                             /*  Source pointer                               */
   q15_t *pOut = pDst;                            /*  Destination pointer                          */
   q31_t in;                                      /*  Temporary variable to hold input value       */
@@ -127,7 +130,7 @@ void riscv_biquad_cascade_df1_fast_q15(
       acc = (q31_t) b0 *Xn;
       acc = sumdotpv2(*VectInA,*VectInC,acc);
       acc = sumdotpv2(*VectInB,*VectInD,acc);
-      acc = clip((acc >> shift), -32768,32767 );
+      acc = clip(RISCV_SAT(acc >> shift), -32768,32767 );
 
       /* Every time after the output is computed state should be updated. */
       /* The states should be updated as:  */
@@ -160,8 +163,85 @@ void riscv_biquad_cascade_df1_fast_q15(
 
   } while(--stage);
 
+#else
 
+  q15_t *pIn = pSrc;                             /*  Source pointer                               */
+  q15_t *pOut = pDst;                            /*  Destination pointer                          */
+  q15_t b0, b1, b2, a1, a2;                      /*  Filter coefficients                          */
+  q15_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables                       */
+  q15_t Xn;                                      /*  temporary input                              */
+  q31_t acc;                                     /*  Accumulator                                  */
+  int32_t shift = (int32_t) (15 - S->postShift); /*  Post shift                                   */
+  q15_t *pState = S->pState;                     /*  State pointer                                */
+  q15_t *pCoeffs = S->pCoeffs;                   /*  Coefficient pointer                          */
+  uint32_t sample, stage = S->numStages;         /*  Stage loop counter                           */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    pCoeffs++;  // skip the 0 coefficient
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* Reading the state values */
+    Xn1 = pState[0];
+    Xn2 = pState[1];
+    Yn1 = pState[2];
+    Yn2 = pState[3];
+
+    /*      The variables acc holds the output value that is computed:         
+     *    acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]         
+     */
+
+    sample = blockSize;
+
+    while(sample > 0u)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      acc = (q31_t) b0 *Xn;
+      acc += (q31_t) b1 *Xn1;
+      acc += (q31_t) b2 *Xn2;
+      acc += (q31_t) a1 *Yn1;
+      acc += (q31_t) a2 *Yn2;
+
+      /* The result is converted to 1.15 */
+      acc = __SSAT(RISCV_SAT(acc >> shift), 16);
+
+      /* Every time after the output is computed state should be updated. */
+      Xn2 = Xn1;
+      Xn1 = Xn;
+      Yn2 = Yn1;
+      Yn1 = (q15_t) acc;
+
+      /* Store the output in the destination buffer. */
+      *pOut++ = (q15_t) acc;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    /* Reset to destination pointer */
+    pOut = pDst;
+
+    /*  Store the updated state variables back into the pState array */
+    *pState++ = Xn1;
+    *pState++ = Xn2;
+    *pState++ = Yn1;
+    *pState++ = Yn2;
+
+  } while(--stage);
 
+#endif
 }
 
 
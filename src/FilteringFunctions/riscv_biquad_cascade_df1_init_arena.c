@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_cascade_df1_init_arena.c
+*
+* Description:  Biquad cascade DF1 instances with the state buffer taken
+*               from an arena.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief  Size of the state buffer of the floating-point Biquad cascade filter.
+ * @param[in]  numStages  number of 2nd order stages in the filter.
+ * @return     bytes the state takes from the arena, <code>4*numStages</code> values.
+ */
+
+uint32_t riscv_biquad_cascade_df1_get_buffer_size_f32(
+  uint8_t numStages)
+{
+  return (RISCV_DSP_ARENA_ROUND((4u * (uint32_t) numStages) * sizeof(float32_t)));
+}
+
+/**
+ * @brief  Initialization function for the floating-point Biquad cascade filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the floating-point Biquad cascade filter structure.
+ * @param[in]     numStages number of 2nd order stages in the filter.
+ * @param[in]     *pCoeffs  points to the filter coefficients.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_biquad_cascade_df1_get_buffer_size_f32() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_biquad_cascade_df1_init_arena_f32(
+  riscv_biquad_casd_df1_inst_f32 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_df1_init_arena_f32);
+  float32_t *pState = (float32_t *) riscv_dsp_arena_alloc(pArena, riscv_biquad_cascade_df1_get_buffer_size_f32(numStages));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_biquad_cascade_df1_init_f32(S, numStages, pCoeffs, pState);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q31 Biquad cascade filter.
+ * @param[in]  numStages  number of 2nd order stages in the filter.
+ * @return     bytes the state takes from the arena, <code>4*numStages</code> values.
+ */
+
+uint32_t riscv_biquad_cascade_df1_get_buffer_size_q31(
+  uint8_t numStages)
+{
+  return (RISCV_DSP_ARENA_ROUND((4u * (uint32_t) numStages) * sizeof(q31_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q31 Biquad cascade filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q31 Biquad cascade filter structure.
+ * @param[in]     numStages number of 2nd order stages in the filter.
+ * @param[in]     *pCoeffs  points to the filter coefficients.
+ * @param[in]     postShift shift to be applied to the output.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_biquad_cascade_df1_get_buffer_size_q31() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_biquad_cascade_df1_init_arena_q31(
+  riscv_biquad_casd_df1_inst_q31 * S,
+  uint8_t numStages,
+  q31_t * pCoeffs,
+  int8_t postShift,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_df1_init_arena_q31);
+  q31_t *pState = (q31_t *) riscv_dsp_arena_alloc(pArena, riscv_biquad_cascade_df1_get_buffer_size_q31(numStages));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_biquad_cascade_df1_init_q31(S, numStages, pCoeffs, pState, postShift);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q15 Biquad cascade filter.
+ * @param[in]  numStages  number of 2nd order stages in the filter.
+ * @return     bytes the state takes from the arena, <code>4*numStages</code> values.
+ */
+
+uint32_t riscv_biquad_cascade_df1_get_buffer_size_q15(
+  uint8_t numStages)
+{
+  return (RISCV_DSP_ARENA_ROUND((4u * (uint32_t) numStages) * sizeof(q15_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q15 Biquad cascade filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q15 Biquad cascade filter structure.
+ * @param[in]     numStages number of 2nd order stages in the filter.
+ * @param[in]     *pCoeffs  points to the filter coefficients.
+ * @param[in]     postShift shift to be applied to the output.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_biquad_cascade_df1_get_buffer_size_q15() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_biquad_cascade_df1_init_arena_q15(
+  riscv_biquad_casd_df1_inst_q15 * S,
+  uint8_t numStages,
+  q15_t * pCoeffs,
+  int8_t postShift,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_df1_init_arena_q15);
+  q15_t *pState = (q15_t *) riscv_dsp_arena_alloc(pArena, riscv_biquad_cascade_df1_get_buffer_size_q15(numStages));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_biquad_cascade_df1_init_q15(S, numStages, pCoeffs, pState, postShift);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -93,6 +93,7 @@ void riscv_biquad_cascade_df1_init_f32(
   float32_t * pCoeffs,
   float32_t * pState)
 {
+  RISCV_PROFILE(riscv_biquad_cascade_df1_init_f32);
   /* Assign filter stages */
   S->numStages = numStages;
 
@@ -92,6 +92,7 @@ void riscv_biquad_cascade_df1_init_q15(
   q15_t * pState,
   int8_t postShift)
 {
+  RISCV_PROFILE(riscv_biquad_cascade_df1_init_q15);
   /* Assign filter stages */
   S->numStages = numStages;
 
@@ -52,6 +52,196 @@
  * @{    
  */
 
+#if defined (USE_DSP_RISCV)
+
+/*
+* @brief  Filters one sample through one stage.
+* @param[in]     b0      coefficient b0 of the stage.
+* @param[in]     b1b2    coefficients b1, b2 of the stage.
+* @param[in]     a1a2    coefficients a1, a2 of the stage.
+* @param[in,out] *Xn12   state variables x[n-1], x[n-2] of the stage.
+* @param[in,out] *Yn12   state variables y[n-1], y[n-2] of the stage.
+* @param[in]     Xn      input sample.
+* @param[in]     shift   right shift of the accumulator.
+* @return        output sample.
+*/
+
+static inline q15_t riscv_biquad_df1_stage_q15(
+  q15_t b0,
+  shortV b1b2,
+  shortV a1a2,
+  shortV * Xn12,
+  shortV * Yn12,
+  q15_t Xn,
+  int32_t shift)
+{
+  q63_t acc;                                     /*  Accumulator                                  */
+
+  /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+  acc = (q31_t) b0 *Xn;
+  acc += dotpv2(b1b2, *Xn12);
+  acc += dotpv2(a1a2, *Yn12);
+  acc = clip(RISCV_SAT(acc >> shift), -32768, 32767);
+
+  /* Xn2 = Xn1, Xn1 = Xn, Yn2 = Yn1, Yn1 = acc */
+  *Xn12 = pack2(Xn, (*Xn12)[0]);
+  *Yn12 = pack2(acc, (*Yn12)[0]);
+
+  return ((q15_t) acc);
+}
+
+#else
+
+/*
+* @brief  Filters one sample through one stage.
+* @param[in]     b0, b1, b2, a1, a2      coefficients of the stage.
+* @param[in,out] *Xn1, *Xn2, *Yn1, *Yn2  state variables of the stage.
+* @param[in]     Xn                      input sample.
+* @param[in]     shift                   right shift of the accumulator.
+* @return        output sample.
+*/
+
+static inline q15_t riscv_biquad_df1_stage_q15(
+  q15_t b0,
+  q15_t b1,
+  q15_t b2,
+  q15_t a1,
+  q15_t a2,
+  q15_t * Xn1,
+  q15_t * Xn2,
+  q15_t * Yn1,
+  q15_t * Yn2,
+  q15_t Xn,
+  int32_t shift)
+{
+  q63_t acc;                                     /*  Accumulator                                  */
+
+  /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+  acc = (q31_t) b0 *Xn;
+  acc += (q31_t) b1 **Xn1;
+  acc += (q31_t) b2 **Xn2;
+  acc += (q31_t) a1 **Yn1;
+  acc += (q31_t) a2 **Yn2;
+
+  /* The result is converted to 1.15 */
+  acc = __SSAT(RISCV_SAT(acc >> shift), 16);
+
+  /* Xn2 = Xn1, Xn1 = Xn, Yn2 = Yn1, Yn1 = acc */
+  *Xn2 = *Xn1;
+  *Xn1 = Xn;
+  *Yn2 = *Yn1;
+  *Yn1 = (q15_t) acc;
+
+  return ((q15_t) acc);
+}
+
+#endif /* #if defined (USE_DSP_RISCV) */
+
+/*
+* @brief  Filters a block through four stages in one pass.
+* @param[in]     *pCoeffs  points to the 24 coefficients of the four stages.
+* @param[in,out] *pState   points to the 16 state variables of the four stages.
+* @param[in]     *pIn      points to the block of input data.
+* @param[out]    *pOut     points to the block of output data, may be equal to pIn.
+* @param[in]     blockSize number of samples to process.
+* @param[in]     shift     right shift of the accumulator.
+*
+* The coefficients and state variables of the four stages are held in registers and every sample
+* goes through the four stages before the next one is read, so the intermediate results are
+* never written to memory.
+*/
+
+static void riscv_biquad_cascade_df1_4_q15(
+  const q15_t * pCoeffs,
+  q15_t * pState,
+  const q15_t * pIn,
+  q15_t * pOut,
+  uint32_t blockSize,
+  int32_t shift)
+{
+  q15_t Xn;                                      /*  temporary input               */
+  uint32_t sample;                               /*  loop counter                  */
+
+#if defined (USE_DSP_RISCV)
+
+  /* Coefficients {b0, 0, b1, b2, a1, a2} and states {Xn1, Xn2, Yn1, Yn2} of every stage */
+  q15_t b10 = pCoeffs[0], b20 = pCoeffs[6], b30 = pCoeffs[12], b40 = pCoeffs[18];
+  shortV b1b = *(shortV *) (pCoeffs + 2), b1a = *(shortV *) (pCoeffs + 4);
+  shortV b2b = *(shortV *) (pCoeffs + 8), b2a = *(shortV *) (pCoeffs + 10);
+  shortV b3b = *(shortV *) (pCoeffs + 14), b3a = *(shortV *) (pCoeffs + 16);
+  shortV b4b = *(shortV *) (pCoeffs + 20), b4a = *(shortV *) (pCoeffs + 22);
+  shortV x1 = *(shortV *) pState, y1 = *(shortV *) (pState + 2);
+  shortV x2 = *(shortV *) (pState + 4), y2 = *(shortV *) (pState + 6);
+  shortV x3 = *(shortV *) (pState + 8), y3 = *(shortV *) (pState + 10);
+  shortV x4 = *(shortV *) (pState + 12), y4 = *(shortV *) (pState + 14);
+
+  for (sample = blockSize; sample > 0u; sample--)
+  {
+    Xn = *pIn++;
+
+    Xn = riscv_biquad_df1_stage_q15(b10, b1b, b1a, &x1, &y1, Xn, shift);
+    Xn = riscv_biquad_df1_stage_q15(b20, b2b, b2a, &x2, &y2, Xn, shift);
+    Xn = riscv_biquad_df1_stage_q15(b30, b3b, b3a, &x3, &y3, Xn, shift);
+    Xn = riscv_biquad_df1_stage_q15(b40, b4b, b4a, &x4, &y4, Xn, shift);
+
+    *pOut++ = Xn;
+  }
+
+  /*  Store the updated state variables back into the pState array */
+  *(shortV *) pState = x1;
+  *(shortV *) (pState + 2) = y1;
+  *(shortV *) (pState + 4) = x2;
+  *(shortV *) (pState + 6) = y2;
+  *(shortV *) (pState + 8) = x3;
+  *(shortV *) (pState + 10) = y3;
+  *(shortV *) (pState + 12) = x4;
+  *(shortV *) (pState + 14) = y4;
+
+#else
+
+  /* Coefficients {b0, 0, b1, b2, a1, a2} and states {Xn1, Xn2, Yn1, Yn2} of every stage */
+  q15_t b10 = pCoeffs[0], b11 = pCoeffs[2], b12 = pCoeffs[3], a11 = pCoeffs[4], a12 = pCoeffs[5];
+  q15_t b20 = pCoeffs[6], b21 = pCoeffs[8], b22 = pCoeffs[9], a21 = pCoeffs[10], a22 = pCoeffs[11];
+  q15_t b30 = pCoeffs[12], b31 = pCoeffs[14], b32 = pCoeffs[15], a31 = pCoeffs[16], a32 = pCoeffs[17];
+  q15_t b40 = pCoeffs[18], b41 = pCoeffs[20], b42 = pCoeffs[21], a41 = pCoeffs[22], a42 = pCoeffs[23];
+  q15_t X11 = pState[0], X12 = pState[1], Y11 = pState[2], Y12 = pState[3];
+  q15_t X21 = pState[4], X22 = pState[5], Y21 = pState[6], Y22 = pState[7];
+  q15_t X31 = pState[8], X32 = pState[9], Y31 = pState[10], Y32 = pState[11];
+  q15_t X41 = pState[12], X42 = pState[13], Y41 = pState[14], Y42 = pState[15];
+
+  for (sample = blockSize; sample > 0u; sample--)
+  {
+    Xn = *pIn++;
+
+    Xn = riscv_biquad_df1_stage_q15(b10, b11, b12, a11, a12, &X11, &X12, &Y11, &Y12, Xn, shift);
+    Xn = riscv_biquad_df1_stage_q15(b20, b21, b22, a21, a22, &X21, &X22, &Y21, &Y22, Xn, shift);
+    Xn = riscv_biquad_df1_stage_q15(b30, b31, b32, a31, a32, &X31, &X32, &Y31, &Y32, Xn, shift);
+    Xn = riscv_biquad_df1_stage_q15(b40, b41, b42, a41, a42, &X41, &X42, &Y41, &Y42, Xn, shift);
+
+    *pOut++ = Xn;
+  }
+
+  /*  Store the updated state variables back into the pState array */
+  pState[0] = X11;
+  pState[1] = X12;
+  pState[2] = Y11;
+  pState[3] = Y12;
+  pState[4] = X21;
+  pState[5] = X22;
+  pState[6] = Y21;
+  pState[7] = Y22;
+  pState[8] = X31;
+  pState[9] = X32;
+  pState[10] = Y31;
+  pState[11] = Y32;
+  pState[12] = X41;
+  pState[13] = X42;
+  pState[14] = Y41;
+  pState[15] = Y42;
+
+#endif /* #if defined (USE_DSP_RISCV) */
+}
+
 /**    
  * @brief Processing function for the Q15 Biquad cascade filter.    
  * @param[in]  *S points to an instance of the Q15 Biquad cascade structure.    
@@ -72,112 +262,75 @@
  *    
  * \par    
  * Refer to the function <code>riscv_biquad_cascade_df1_fast_q15()</code> for a faster but less precise implementation of this filter for Cortex-M3 and Cortex-M4.    
+ *
+ * \par
+ * Groups of four stages are run in one pass: every sample goes through the four stages with their
+ * coefficients and state variables held in registers, so an 8 stage filter reads and writes the
+ * block twice instead of eight times.  The remaining <code>numStages%4</code> stages take one pass each.
+ * The output is identical to filtering the stages one after the other.
  */
 
+RISCV_DSP_FASTCODE(riscv_biquad_cascade_df1_q15)
 void riscv_biquad_cascade_df1_q15(
   const riscv_biquad_casd_df1_inst_q15 * S,
   q15_t * pSrc,
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_biquad_cascade_df1_q15);
+  RISCV_SAT_STATS(riscv_biquad_cascade_df1_q15, 16);
   q15_t *pIn = pSrc;                             /*  Source pointer                               */
   q15_t *pOut = pDst;                            /*  Destination pointer                          */
-  q15_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
-  q15_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables        */
   q15_t Xn;                                      /*  temporary input               */
-  q63_t acc;                                     /*  Accumulator                                  */
   int32_t shift = (15 - (int32_t)S->postShift); /*  Post shift                                   */
   q15_t *pState = S->pState;                     /*  State pointer                                */
   q15_t *pCoeffs = S->pCoeffs;                   /*  Coefficient pointer                          */
   uint32_t sample, stage = (uint32_t)S->numStages;     /*  Stage loop counter                           */
 #if defined (USE_DSP_RISCV)
+  q15_t b0;                                      /*  Filter coefficient b0         */
+  shortV b1b2, a1a2;                             /*  Filter coefficient pairs      */
+  shortV Xn12, Yn12;                             /*  Filter state variable pairs   */
+#else
+  q15_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+  q15_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables        */
+#endif
 
-  shortV *VectInA;
-  shortV *VectInB;
-  shortV *VectInC;
-  shortV *VectInD;
-  shortV *VectInb0;
-  do
+  /* Groups of four stages are run in one pass over the block */
+  while(stage >= 4u)
   {
-    /* Reading the coefficients */
-
-    b0 = *pCoeffs++;
-    pCoeffs++;  // skip the 0 coefficient
-    VectInA = (shortV*)pCoeffs; /*b1 b2*/
-    pCoeffs+=2;
-    VectInB = (shortV*)pCoeffs; /*a1 a2*/
-    pCoeffs+=2;
-    /* Reading the state values */
-    VectInC = (shortV*)pState; /*Xn1 Xn2*/
-    VectInD = (shortV*)(pState+2); /*Yn1 Yn2*/
-
-    /*      The variables acc holds the output value that is computed:         
-     *    acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]         
-     */
-
-    sample = blockSize;
-
-    while(sample > 0u)
-    {
-      /* Read the input */
-      Xn = *pIn++;
+    riscv_biquad_cascade_df1_4_q15(pCoeffs, pState, pIn, pOut, blockSize, shift);
 
-      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
-      /* acc =  b0 * x[n] */
-      acc = (q31_t) b0 *Xn;
-      acc += dotpv2(*VectInA,*VectInC);
-      acc += dotpv2(*VectInB,*VectInD);
-      acc =clip((acc >> shift), -32768,32767);
-
-      /* Every time after the output is computed state should be updated. */
-      /* The states should be updated as:  */
-      /* Xn2 = Xn1    */
-      /* Xn1 = Xn     */
-      /* Yn2 = Yn1    */
-      /* Yn1 = acc    */
-      (*VectInC) = pack2(Xn,(*VectInC)[0]);
-      (*VectInD) = pack2(acc,(*VectInD)[0]);
-      /* Store the output in the destination buffer. */
-      *pOut++ = (q15_t) acc;
+    pCoeffs += 24u;
+    pState += 16u;
 
-      /* decrement the loop counter */
-      sample--;
-    }
-
-    /*  The first stage goes from the input buffer to the output buffer. */
     /*  Subsequent stages occur in-place in the output buffer */
     pIn = pDst;
 
-    /* Reset to destination pointer */
-    pOut = pDst;
-
-    /*  Store the updated state variables back into the pState array */
-    *(shortV*)pState = *VectInC;
-    pState+=2;
-    *(shortV*)pState = *VectInD;
-    pState+=2;
+    stage -= 4u;
+  }
 
-  } while(--stage);
-#else
-  do
+  /* Remaining stages, one pass each */
+  while(stage > 0u)
   {
-    /* Reading the coefficients */
-    b0 = *pCoeffs++;
-    pCoeffs++;  // skip the 0 coefficient
-    b1 = *pCoeffs++;
-    b2 = *pCoeffs++;
-    a1 = *pCoeffs++;
-    a2 = *pCoeffs++;
-
-    /* Reading the state values */
+    /* Reading the coefficients and the state values */
+#if defined (USE_DSP_RISCV)
+    b0 = pCoeffs[0];
+    b1b2 = *(shortV *) (pCoeffs + 2);
+    a1a2 = *(shortV *) (pCoeffs + 4);
+    Xn12 = *(shortV *) pState;
+    Yn12 = *(shortV *) (pState + 2);
+#else
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[2];
+    b2 = pCoeffs[3];
+    a1 = pCoeffs[4];
+    a2 = pCoeffs[5];
     Xn1 = pState[0];
     Xn2 = pState[1];
     Yn1 = pState[2];
     Yn2 = pState[3];
-
-    /*      The variables acc holds the output value that is computed:         
-     *    acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]         
-     */
+#endif
+    pCoeffs += 6u;
 
     sample = blockSize;
 
@@ -186,35 +339,12 @@ void riscv_biquad_cascade_df1_q15(
       /* Read the input */
       Xn = *pIn++;
 
-      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
-      /* acc =  b0 * x[n] */
-      acc = (q31_t) b0 *Xn;
-
-      /* acc +=  b1 * x[n-1] */
-      acc += (q31_t) b1 *Xn1;
-      /* acc +=  b[2] * x[n-2] */
-      acc += (q31_t) b2 *Xn2;
-      /* acc +=  a1 * y[n-1] */
-      acc += (q31_t) a1 *Yn1;
-      /* acc +=  a2 * y[n-2] */
-      acc += (q31_t) a2 *Yn2;
-
-      /* The result is converted to 1.31  */
-      acc = __SSAT((acc >> shift), 16);
-
-      /* Every time after the output is computed state should be updated. */
-      /* The states should be updated as:  */
-      /* Xn2 = Xn1    */
-      /* Xn1 = Xn     */
-      /* Yn2 = Yn1    */
-      /* Yn1 = acc    */
-      Xn2 = Xn1;
-      Xn1 = Xn;
-      Yn2 = Yn1;
-      Yn1 = (q15_t) acc;
-
       /* Store the output in the destination buffer. */
-      *pOut++ = (q15_t) acc;
+#if defined (USE_DSP_RISCV)
+      *pOut++ = riscv_biquad_df1_stage_q15(b0, b1b2, a1a2, &Xn12, &Yn12, Xn, shift);
+#else
+      *pOut++ = riscv_biquad_df1_stage_q15(b0, b1, b2, a1, a2, &Xn1, &Xn2, &Yn1, &Yn2, Xn, shift);
+#endif
 
       /* decrement the loop counter */
       sample--;
@@ -228,15 +358,20 @@ void riscv_biquad_cascade_df1_q15(
     pOut = pDst;
 
     /*  Store the updated state variables back into the pState array */
-    *pState++ = Xn1;
-    *pState++ = Xn2;
-    *pState++ = Yn1;
-    *pState++ = Yn2;
-
-  } while(--stage);
+#if defined (USE_DSP_RISCV)
+    *(shortV *) pState = Xn12;
+    *(shortV *) (pState + 2) = Yn12;
+#else
+    pState[0] = Xn1;
+    pState[1] = Xn2;
+    pState[2] = Yn1;
+    pState[3] = Yn2;
 #endif
-}
+    pState += 4u;
 
+    stage--;
+  }
+}
 
 /**    
  * @} end of BiquadCascadeDF1 group    
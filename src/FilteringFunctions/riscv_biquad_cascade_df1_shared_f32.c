@@ -0,0 +1,53 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_cascade_df1_shared_f32.c
+*
+* Description:  floating-point Biquad cascade DF1 filter running one stream of
+*               shared coefficients.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief  Processing function for one stream of a shared floating-point Biquad cascade filter.
+ * @param[in,out] *T         points to the state of the stream.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return        none.
+ *
+ * \par
+ * Runs riscv_biquad_cascade_df1_f32() like riscv_biquad_cascade_df1_shared_q15() does for Q15.
+ */
+
+void riscv_biquad_cascade_df1_shared_f32(
+  riscv_biquad_casd_df1_shared_state_f32 * T,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_df1_shared_f32);
+  const riscv_biquad_casd_df1_shared_coefs_f32 *C = T->pCoefs;
+  riscv_biquad_casd_df1_inst_f32 local;         /* Instance of the call */
+
+  local.numStages = C->numStages;
+  local.pState = T->pState;
+  local.pCoeffs = (float32_t *) C->pCoeffs;         /* read only by the kernels */
+
+  riscv_biquad_cascade_df1_f32(&local, pSrc, pDst, blockSize);
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
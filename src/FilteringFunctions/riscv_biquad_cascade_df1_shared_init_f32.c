@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_cascade_df1_shared_init_f32.c
+*
+* Description:  Initialization of the shared coefficients and of the
+*               streams of a floating-point Biquad cascade DF1 filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the shared coefficients of a floating-point Biquad cascade filter.
+ * @param[out] *C         points to the shared coefficients.
+ * @param[in]  numStages  number of 2nd order stages in the filter.
+ * @param[in]  *pCoeffs   points to the <code>5*numStages</code> coefficients, ordered as for riscv_biquad_cascade_df1_init_f32().
+ * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numStages is 0.
+ *
+ * \par
+ * See riscv_biquad_cascade_df1_shared_coefs_init_q15() for the sharing rules.
+ */
+
+riscv_status riscv_biquad_cascade_df1_shared_coefs_init_f32(
+  riscv_biquad_casd_df1_shared_coefs_f32 * C,
+  uint8_t numStages,
+  const float32_t * pCoeffs)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_df1_shared_coefs_init_f32);
+
+  if(numStages == 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  C->numStages = numStages;
+  C->pCoeffs = pCoeffs;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Initialization function for one stream of a shared floating-point Biquad cascade filter.
+ * @param[out] *T       points to the state of the stream.
+ * @param[in]  *C       points to the shared coefficients.
+ * @param[in]  *pState  points to the state buffer of the stream, of length <code>4*numStages</code>.
+ * @return     none.
+ */
+
+void riscv_biquad_cascade_df1_shared_state_init_f32(
+  riscv_biquad_casd_df1_shared_state_f32 * T,
+  const riscv_biquad_casd_df1_shared_coefs_f32 * C,
+  float32_t * pState)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_df1_shared_state_init_f32);
+
+  /* Clear the state buffer, its size is 4 * numStages */
+  memset(pState, 0, (4u * (uint32_t) C->numStages) * sizeof(float32_t));
+
+  T->pCoefs = C;
+  T->pState = pState;
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_cascade_df1_shared_init_q31.c
+*
+* Description:  Initialization of the shared coefficients and of the
+*               streams of a Q31 Biquad cascade DF1 filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the shared coefficients of a Q31 Biquad cascade filter.
+ * @param[out] *C         points to the shared coefficients.
+ * @param[in]  numStages  number of 2nd order stages in the filter.
+ * @param[in]  *pCoeffs   points to the <code>5*numStages</code> coefficients, ordered as for riscv_biquad_cascade_df1_init_q31().
+ * @param[in]  postShift  shift applied to each output sample, as for riscv_biquad_cascade_df1_init_q31().
+ * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numStages is 0.
+ *
+ * \par
+ * See riscv_biquad_cascade_df1_shared_coefs_init_q15() for the sharing rules.
+ */
+
+riscv_status riscv_biquad_cascade_df1_shared_coefs_init_q31(
+  riscv_biquad_casd_df1_shared_coefs_q31 * C,
+  uint8_t numStages,
+  const q31_t * pCoeffs,
+  int8_t postShift)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_df1_shared_coefs_init_q31);
+
+  if(numStages == 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  C->numStages = numStages;
+  C->pCoeffs = pCoeffs;
+  C->postShift = postShift;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Initialization function for one stream of a shared Q31 Biquad cascade filter.
+ * @param[out] *T       points to the state of the stream.
+ * @param[in]  *C       points to the shared coefficients.
+ * @param[in]  *pState  points to the state buffer of the stream, of length <code>4*numStages</code>.
+ * @return     none.
+ */
+
+void riscv_biquad_cascade_df1_shared_state_init_q31(
+  riscv_biquad_casd_df1_shared_state_q31 * T,
+  const riscv_biquad_casd_df1_shared_coefs_q31 * C,
+  q31_t * pState)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_df1_shared_state_init_q31);
+
+  /* Clear the state buffer, its size is 4 * numStages */
+  memset(pState, 0, (4u * (uint32_t) C->numStages) * sizeof(q31_t));
+
+  T->pCoefs = C;
+  T->pState = pState;
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
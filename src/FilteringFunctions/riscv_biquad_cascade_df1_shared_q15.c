@@ -0,0 +1,57 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_cascade_df1_shared_q15.c
+*
+* Description:  Q15 Biquad cascade DF1 filter running one stream of
+*               shared coefficients.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief  Processing function for one stream of a shared Q15 Biquad cascade filter.
+ * @param[in,out] *T         points to the state of the stream.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return        none.
+ *
+ * \par
+ * Runs riscv_biquad_cascade_df1_q15() on an instance assembled on the stack from the shared
+ * coefficients and the state of <code>T</code>, so the outputs are the same.  Only
+ * <code>T->pState</code> is written: streams with their own state can call it at the same time on
+ * one riscv_biquad_casd_df1_shared_coefs_q15.
+ */
+
+void riscv_biquad_cascade_df1_shared_q15(
+  riscv_biquad_casd_df1_shared_state_q15 * T,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_df1_shared_q15);
+  const riscv_biquad_casd_df1_shared_coefs_q15 *C = T->pCoefs;
+  riscv_biquad_casd_df1_inst_q15 local;         /* Instance of the call */
+
+  local.numStages = C->numStages;
+  local.pState = T->pState;
+  local.pCoeffs = (q15_t *) C->pCoeffs;         /* read only by the kernels */
+  local.postShift = C->postShift;
+
+  riscv_biquad_cascade_df1_q15(&local, pSrc, pDst, blockSize);
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -143,6 +143,92 @@
 * @{       
 */
 
+/*
+* @brief  Filters one sample through one stage.
+* @param[in]     b0, b1, b2, a1, a2  coefficients of the stage.
+* @param[in,out] *d1, *d2            state variables of the stage.
+* @param[in]     Xn1                 input sample.
+* @return        output sample.
+*/
+
+static inline float32_t riscv_biquad_df2T_stage_f32(
+float32_t b0,
+float32_t b1,
+float32_t b2,
+float32_t a1,
+float32_t a2,
+float32_t * d1,
+float32_t * d2,
+float32_t Xn1)
+{
+   float32_t acc1;
+
+   /* y[n] = b0 * x[n] + d1 */
+   acc1 = (b0 * Xn1) + *d1;
+
+   /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+   *d1 = ((b1 * Xn1) + (a1 * acc1)) + *d2;
+
+   /* d2 = b2 * x[n] + a2 * y[n] */
+   *d2 = (b2 * Xn1) + (a2 * acc1);
+
+   return (acc1);
+}
+
+/*
+* @brief  Filters a block through four stages in one pass.
+* @param[in]     *pCoeffs  points to the 20 coefficients of the four stages.
+* @param[in,out] *pState   points to the 8 state variables of the four stages.
+* @param[in]     *pIn      points to the block of input data.
+* @param[out]    *pOut     points to the block of output data, may be equal to pIn.
+* @param[in]     blockSize number of samples to process.
+*
+* The coefficients and state variables of the four stages are held in registers and every sample
+* goes through the four stages before the next one is read, so the intermediate results are
+* never written to memory.
+*/
+
+static void riscv_biquad_cascade_df2T_4_f32(
+const float32_t * pCoeffs,
+float32_t * pState,
+const float32_t * pIn,
+float32_t * pOut,
+uint32_t blockSize)
+{
+   float32_t b10 = pCoeffs[0], b11 = pCoeffs[1], b12 = pCoeffs[2], a11 = pCoeffs[3], a12 = pCoeffs[4];
+   float32_t b20 = pCoeffs[5], b21 = pCoeffs[6], b22 = pCoeffs[7], a21 = pCoeffs[8], a22 = pCoeffs[9];
+   float32_t b30 = pCoeffs[10], b31 = pCoeffs[11], b32 = pCoeffs[12], a31 = pCoeffs[13], a32 = pCoeffs[14];
+   float32_t b40 = pCoeffs[15], b41 = pCoeffs[16], b42 = pCoeffs[17], a41 = pCoeffs[18], a42 = pCoeffs[19];
+   float32_t d11 = pState[0], d12 = pState[1];    /*  state variables           */
+   float32_t d21 = pState[2], d22 = pState[3];
+   float32_t d31 = pState[4], d32 = pState[5];
+   float32_t d41 = pState[6], d42 = pState[7];
+   float32_t Xn1;                                 /*  temporary input           */
+   uint32_t sample;                               /*  loop counter              */
+
+   for (sample = blockSize; sample > 0u; sample--)
+   {
+      Xn1 = *pIn++;
+
+      Xn1 = riscv_biquad_df2T_stage_f32(b10, b11, b12, a11, a12, &d11, &d12, Xn1);
+      Xn1 = riscv_biquad_df2T_stage_f32(b20, b21, b22, a21, a22, &d21, &d22, Xn1);
+      Xn1 = riscv_biquad_df2T_stage_f32(b30, b31, b32, a31, a32, &d31, &d32, Xn1);
+      Xn1 = riscv_biquad_df2T_stage_f32(b40, b41, b42, a41, a42, &d41, &d42, Xn1);
+
+      *pOut++ = Xn1;
+   }
+
+   /* Store the updated state variables back into the state array */
+   pState[0] = d11;
+   pState[1] = d12;
+   pState[2] = d21;
+   pState[3] = d22;
+   pState[4] = d31;
+   pState[5] = d32;
+   pState[6] = d41;
+   pState[7] = d42;
+}
+
 /**      
 * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.      
 * @param[in]  *S        points to an instance of the filter data structure.      
@@ -150,27 +236,49 @@
 * @param[out] *pDst     points to the block of output data      
 * @param[in]  blockSize number of samples to process.      
 * @return none.      
+*
+* \par
+* Groups of four stages are run in one pass: every sample goes through the four stages with their
+* coefficients and state variables held in registers, so an 8 stage filter reads and writes the
+* block twice instead of eight times.  The remaining <code>numStages%4</code> stages take one pass each.
+* The output is identical to filtering the stages one after the other.
 */
 
 
+RISCV_DSP_FASTCODE(riscv_biquad_cascade_df2T_f32)
 void riscv_biquad_cascade_df2T_f32(
 const riscv_biquad_cascade_df2T_instance_f32 * S,
 float32_t * pSrc,
 float32_t * pDst,
 uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_biquad_cascade_df2T_f32);
 
    float32_t *pIn = pSrc;                         /*  source pointer            */
    float32_t *pOut = pDst;                        /*  destination pointer       */
    float32_t *pState = S->pState;                 /*  State pointer             */
    float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
-   float32_t acc1;                                /*  accumulator               */
    float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
    float32_t Xn1;                                 /*  temporary input           */
    float32_t d1, d2;                              /*  state variables           */
    uint32_t sample, stage = S->numStages;         /*  loop counters             */
 
-   do
+   /* Groups of four stages are run in one pass over the block */
+   while(stage >= 4u)
+   {
+      riscv_biquad_cascade_df2T_4_f32(pCoeffs, pState, pIn, pOut, blockSize);
+
+      pCoeffs += 20u;
+      pState += 8u;
+
+      /* The current stage input is given as the output to the next stage */
+      pIn = pDst;
+
+      stage -= 4u;
+   }
+
+   /* Remaining stages, one pass each */
+   while(stage > 0u)
    {
       /* Reading the coefficients */
       b0 = *pCoeffs++;
@@ -183,7 +291,6 @@ uint32_t blockSize)
       d1 = pState[0];
       d2 = pState[1];
 
-
       sample = blockSize;
 
       while(sample > 0u)
@@ -191,18 +298,8 @@ uint32_t blockSize)
          /* Read the input */
          Xn1 = *pIn++;
 
-         /* y[n] = b0 * x[n] + d1 */
-         acc1 = (b0 * Xn1) + d1;
-
-         /* Store the result in the accumulator in the destination buffer. */
-         *pOut++ = acc1;
-
-         /* Every time after the output is computed state should be updated. */
-         /* d1 = b1 * x[n] + a1 * y[n] + d2 */
-         d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
-
-         /* d2 = b2 * x[n] + a2 * y[n] */
-         d2 = (b2 * Xn1) + (a2 * acc1);
+         /* Store the result in the destination buffer. */
+         *pOut++ = riscv_biquad_df2T_stage_f32(b0, b1, b2, a1, a2, &d1, &d2, Xn1);
 
          /* decrement the loop counter */
          sample--;
@@ -220,12 +317,10 @@ uint32_t blockSize)
 
       /* decrement the loop counter */
       stage--;
-
-   } while(stage > 0u);
+   }
 	
 }
 
-
 /**       
    * @} end of BiquadCascadeDF2T group       
    */
@@ -159,6 +159,7 @@ float64_t * pSrc,
 float64_t * pDst,
 uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_biquad_cascade_df2T_f64);
 
    float64_t *pIn = pSrc;                         /*  source pointer            */
    float64_t *pOut = pDst;                        /*  destination pointer       */
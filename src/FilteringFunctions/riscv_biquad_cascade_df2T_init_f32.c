@@ -86,6 +86,7 @@ void riscv_biquad_cascade_df2T_init_f32(
   float32_t * pCoeffs,
   float32_t * pState)
 {
+  RISCV_PROFILE(riscv_biquad_cascade_df2T_init_f32);
   /* Assign filter stages */
   S->numStages = numStages;
 
@@ -86,6 +86,7 @@ void riscv_biquad_cascade_df2T_init_f64(
   float64_t * pCoeffs,
   float64_t * pState)
 {
+  RISCV_PROFILE(riscv_biquad_cascade_df2T_init_f64);
   /* Assign filter stages */
   S->numStages = numStages;
 
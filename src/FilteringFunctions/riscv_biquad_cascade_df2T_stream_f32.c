@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_cascade_df2T_stream_f32.c
+*
+* Description:  Floating-point transposed direct form II Biquad cascade filter streamed from L2 through tiles in L1.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/*
+* @brief  Filters one tile.
+*/
+
+static void riscv_biquad_cascade_df2T_stream_f32_tile(
+  void * arg,
+  void * pIn,
+  void * pOut,
+  uint32_t blockSize)
+{
+  riscv_biquad_cascade_df2T_f32((const riscv_biquad_cascade_df2T_instance_f32 *) arg, (float32_t *) pIn, (float32_t *) pOut, blockSize);
+}
+
+/**
+ * @brief Floating-point transposed direct form II Biquad cascade filter streamed from L2 through tiles in L1.
+ * @param[in]  *D         points to the DMA hook.
+ * @param[in]  *S         points to an instance of the Floating-point transposed direct form II Biquad cascade filter structure.
+ * @param[in]  *pSrc      points to the input samples in L2.
+ * @param[out] *pDst      points to the output samples in L2, may be <code>pSrc</code>.
+ * @param[in]  length     number of samples to process.
+ * @param[in]  tileSize   number of samples processed per call of riscv_biquad_cascade_df2T_f32().
+ * @param[in]  *pL1       points to a buffer of <code>4*tileSize</code> samples in L1.
+ * @return none.
+ *
+ * \par
+ * The function calls riscv_biquad_cascade_df2T_f32() on tiles of <code>tileSize</code> samples that riscv_stream_process()
+ * moves between L2 and <code>pL1</code>.
+ * <code>S</code>, its state of 2*numStages samples and coefficients, should be in L1 as well.
+ * The output equals the one of riscv_biquad_cascade_df2T_f32() on the whole vector.
+ */
+
+void riscv_biquad_cascade_df2T_stream_f32(
+  const riscv_dma_instance * D,
+  const riscv_biquad_cascade_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t length,
+  uint32_t tileSize,
+  float32_t * pL1)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_df2T_stream_f32);
+  riscv_stream_process(D, riscv_biquad_cascade_df2T_stream_f32_tile, (void *) S, pSrc, pDst, length, sizeof(float32_t), tileSize, pL1);
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,198 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_cascade_multichan_df2T_f32.c
+*
+* Description:  Processing function for the floating-point multi-channel
+*               transposed direct form II Biquad cascade filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @addtogroup BiquadCascadeDF2T
+* @{
+*/
+
+/*
+* @brief  Filters four channels through one stage.
+* @param[in]     *pCoeffs   points to the coefficients b0, b1, b2, a1, a2 of the stage.
+* @param[in,out] *pState    points to the state variables {d1, d2} of the four channels.
+* @param[in]     *pIn       points to the first sample of the first channel.
+* @param[out]    *pOut      points to the first output of the first channel, may be equal to pIn.
+* @param[in]     numChans   distance between two samples of a channel.
+* @param[in]     blockSize  number of samples per channel to process.
+*/
+
+static void riscv_biquad_multichan_df2T_4_f32(
+const float32_t * pCoeffs,
+float32_t * pState,
+const float32_t * pIn,
+float32_t * pOut,
+uint32_t numChans,
+uint32_t blockSize)
+{
+   float32_t b0 = pCoeffs[0], b1 = pCoeffs[1], b2 = pCoeffs[2];  /*  Filter coefficients       */
+   float32_t a1 = pCoeffs[3], a2 = pCoeffs[4];
+   float32_t d1a = pState[0], d2a = pState[1];    /*  state variables           */
+   float32_t d1b = pState[2], d2b = pState[3];
+   float32_t d1c = pState[4], d2c = pState[5];
+   float32_t d1d = pState[6], d2d = pState[7];
+   float32_t Xn1a, Xn1b, Xn1c, Xn1d;              /*  temporary inputs          */
+   float32_t acc1a, acc1b, acc1c, acc1d;          /*  accumulators              */
+   uint32_t sample;                               /*  loop counter              */
+
+   for (sample = blockSize; sample > 0u; sample--)
+   {
+      /* Read the inputs of the four channels */
+      Xn1a = pIn[0];
+      Xn1b = pIn[1];
+      Xn1c = pIn[2];
+      Xn1d = pIn[3];
+      pIn += numChans;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc1a = (b0 * Xn1a) + d1a;
+      acc1b = (b0 * Xn1b) + d1b;
+      acc1c = (b0 * Xn1c) + d1c;
+      acc1d = (b0 * Xn1d) + d1d;
+
+      pOut[0] = acc1a;
+      pOut[1] = acc1b;
+      pOut[2] = acc1c;
+      pOut[3] = acc1d;
+      pOut += numChans;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1a = ((b1 * Xn1a) + (a1 * acc1a)) + d2a;
+      d1b = ((b1 * Xn1b) + (a1 * acc1b)) + d2b;
+      d1c = ((b1 * Xn1c) + (a1 * acc1c)) + d2c;
+      d1d = ((b1 * Xn1d) + (a1 * acc1d)) + d2d;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2a = (b2 * Xn1a) + (a2 * acc1a);
+      d2b = (b2 * Xn1b) + (a2 * acc1b);
+      d2c = (b2 * Xn1c) + (a2 * acc1c);
+      d2d = (b2 * Xn1d) + (a2 * acc1d);
+   }
+
+   /* Store the updated state variables back into the state array */
+   pState[0] = d1a;
+   pState[1] = d2a;
+   pState[2] = d1b;
+   pState[3] = d2b;
+   pState[4] = d1c;
+   pState[5] = d2c;
+   pState[6] = d1d;
+   pState[7] = d2d;
+}
+
+/**
+* @brief Processing function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+* @param[in]  *S        points to an instance of the filter data structure.
+* @param[in]  *pSrc     points to the block of interleaved input data.
+* @param[out] *pDst     points to the block of interleaved output data.
+* @param[in]  blockSize number of samples per channel to process.
+* @return none.
+*
+* \par
+* The function filters <code>numChannels</code> channels with the same coefficients, as riscv_biquad_cascade_df2T_f32()
+* filters one and riscv_biquad_cascade_stereo_df2T_f32() filters two.
+* <code>pSrc</code> and <code>pDst</code> hold <code>blockSize</code> frames of <code>numChannels</code> interleaved samples:
+* <pre>
+*     {x0[0], x1[0], ..., x(numChannels-1)[0], x0[1], x1[1], ...}
+* </pre>
+* Each stage filters four channels at a time so that the coefficients are loaded once for four channels and the four
+* independent recursions can overlap.  Remaining channels are filtered one at a time.
+* The output of every channel is identical to riscv_biquad_cascade_df2T_f32() on that channel alone.
+*/
+
+void riscv_biquad_cascade_multichan_df2T_f32(
+const riscv_biquad_cascade_multichan_df2T_instance_f32 * S,
+float32_t * pSrc,
+float32_t * pDst,
+uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_multichan_df2T_f32);
+   float32_t *pIn = pSrc;                         /*  source pointer            */
+   float32_t *pState = S->pState;                 /*  State pointer             */
+   float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+   const float32_t *px;                           /*  input working pointer     */
+   float32_t *py;                                 /*  output working pointer    */
+   float32_t acc1;                                /*  accumulator               */
+   float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+   float32_t Xn1;                                 /*  temporary input           */
+   float32_t d1, d2;                              /*  state variables           */
+   uint32_t numChans = S->numChannels;            /*  number of channels        */
+   uint32_t sample, ch, stage = S->numStages;     /*  loop counters             */
+
+   do
+   {
+      ch = 0u;
+
+      /* Four channels at a time */
+      for (; (ch + 4u) <= numChans; ch += 4u)
+      {
+         riscv_biquad_multichan_df2T_4_f32(pCoeffs, pState + (2u * ch), pIn + ch, pDst + ch, numChans, blockSize);
+      }
+
+      /* Remaining channels */
+      for (; ch < numChans; ch++)
+      {
+         /* Reading the coefficients */
+         b0 = pCoeffs[0];
+         b1 = pCoeffs[1];
+         b2 = pCoeffs[2];
+         a1 = pCoeffs[3];
+         a2 = pCoeffs[4];
+
+         /*Reading the state values */
+         d1 = pState[2u * ch];
+         d2 = pState[(2u * ch) + 1u];
+
+         px = pIn + ch;
+         py = pDst + ch;
+
+         for (sample = blockSize; sample > 0u; sample--)
+         {
+            Xn1 = *px;
+            px += numChans;
+
+            /* y[n] = b0 * x[n] + d1 */
+            acc1 = (b0 * Xn1) + d1;
+
+            *py = acc1;
+            py += numChans;
+
+            /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+            d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+
+            /* d2 = b2 * x[n] + a2 * y[n] */
+            d2 = (b2 * Xn1) + (a2 * acc1);
+         }
+
+         /* Store the updated state variables back into the state array */
+         pState[2u * ch] = d1;
+         pState[(2u * ch) + 1u] = d2;
+      }
+
+      pCoeffs += 5u;
+      pState += 2u * numChans;
+
+      /* The current stage input is given as the output to the next stage */
+      pIn = pDst;
+
+      /* decrement the loop counter */
+      stage--;
+
+   } while(stage > 0u);
+}
+
+/**
+* @} end of BiquadCascadeDF2T group
+*/
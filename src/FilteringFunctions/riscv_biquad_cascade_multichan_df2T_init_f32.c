@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_cascade_multichan_df2T_init_f32.c
+*
+* Description:  Initialization function for the floating-point multi-channel
+*               transposed direct form II Biquad cascade filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+ * @param[in,out] *S           points to an instance of the filter data structure.
+ * @param[in]     numStages    number of 2nd order stages in the filter.
+ * @param[in]     numChannels  number of interleaved channels.
+ * @param[in]     *pCoeffs     points to the filter coefficients, shared by all channels.
+ * @param[in]     *pState      points to the state buffer.
+ * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+ * <code>numStages</code> or <code>numChannels</code> is 0.
+ *
+ * <b>Coefficient and State Ordering:</b>
+ * \par
+ * The coefficients are stored in the array <code>pCoeffs</code> in the order of riscv_biquad_cascade_df2T_init_f32():
+ * <pre>
+ *     {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}
+ * </pre>
+ * \par
+ * Each Biquad stage has 2 state variables <code>d1</code> and <code>d2</code> for each channel.
+ * The state variables of stage 1 are first, channel by channel, then the state variables of stage 2, and so on:
+ * <pre>
+ *     {d11 d12 of channel 0, d11 d12 of channel 1, ..., d21 d22 of channel 0, ...}
+ * </pre>
+ * The state array has a total length of <code>2*numStages*numChannels</code> values and is cleared.
+ */
+
+riscv_status riscv_biquad_cascade_multichan_df2T_init_f32(
+  riscv_biquad_cascade_multichan_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_multichan_df2T_init_f32);
+  if((numStages == 0u) || (numChannels == 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numStages = numStages;
+  S->numChannels = numChannels;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* Clear state buffer and size is always 2 * numStages * numChannels */
+  memset(pState, 0, (2u * (uint32_t) numStages * numChannels) * sizeof(float32_t));
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_cascade_multichan_df2T_q31.c
+*
+* Description:  Processing function for the Q31 multi-channel transposed
+*               direct form II Biquad cascade filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @addtogroup BiquadCascadeDF2T
+* @{
+*/
+
+/*
+* @brief  Filters four channels through one stage.
+* @param[in]     *pCoeffs   points to the coefficients b0, b1, b2, a1, a2 of the stage.
+* @param[in,out] *pState    points to the state variables {d1, d2} of the four channels.
+* @param[in]     *pIn       points to the first sample of the first channel.
+* @param[out]    *pOut      points to the first output of the first channel, may be equal to pIn.
+* @param[in]     numChans   distance between two samples of a channel.
+* @param[in]     blockSize  number of samples per channel to process.
+* @param[in]     shift      right shift from the 2.62 accumulator to the 1.31 output.
+*/
+
+static void riscv_biquad_multichan_df2T_4_q31(
+const q31_t * pCoeffs,
+q63_t * pState,
+const q31_t * pIn,
+q31_t * pOut,
+uint32_t numChans,
+uint32_t blockSize,
+uint32_t shift)
+{
+   q31_t b0 = pCoeffs[0], b1 = pCoeffs[1], b2 = pCoeffs[2];  /*  Filter coefficients       */
+   q31_t a1 = pCoeffs[3], a2 = pCoeffs[4];
+   q63_t d1a = pState[0], d2a = pState[1];        /*  state variables           */
+   q63_t d1b = pState[2], d2b = pState[3];
+   q63_t d1c = pState[4], d2c = pState[5];
+   q63_t d1d = pState[6], d2d = pState[7];
+   q31_t Xn1a, Xn1b, Xn1c, Xn1d;                  /*  temporary inputs          */
+   q31_t Yna, Ynb, Ync, Ynd;                      /*  outputs                   */
+   uint32_t sample;                               /*  loop counter              */
+
+   for (sample = blockSize; sample > 0u; sample--)
+   {
+      /* Read the inputs of the four channels */
+      Xn1a = pIn[0];
+      Xn1b = pIn[1];
+      Xn1c = pIn[2];
+      Xn1d = pIn[3];
+      pIn += numChans;
+
+      /* y[n] = b0 * x[n] + d1 */
+      Yna = (q31_t) ((((q63_t) b0 * Xn1a) + d1a) >> shift);
+      Ynb = (q31_t) ((((q63_t) b0 * Xn1b) + d1b) >> shift);
+      Ync = (q31_t) ((((q63_t) b0 * Xn1c) + d1c) >> shift);
+      Ynd = (q31_t) ((((q63_t) b0 * Xn1d) + d1d) >> shift);
+
+      pOut[0] = Yna;
+      pOut[1] = Ynb;
+      pOut[2] = Ync;
+      pOut[3] = Ynd;
+      pOut += numChans;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1a = ((q63_t) b1 * Xn1a) + ((q63_t) a1 * Yna) + d2a;
+      d1b = ((q63_t) b1 * Xn1b) + ((q63_t) a1 * Ynb) + d2b;
+      d1c = ((q63_t) b1 * Xn1c) + ((q63_t) a1 * Ync) + d2c;
+      d1d = ((q63_t) b1 * Xn1d) + ((q63_t) a1 * Ynd) + d2d;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2a = ((q63_t) b2 * Xn1a) + ((q63_t) a2 * Yna);
+      d2b = ((q63_t) b2 * Xn1b) + ((q63_t) a2 * Ynb);
+      d2c = ((q63_t) b2 * Xn1c) + ((q63_t) a2 * Ync);
+      d2d = ((q63_t) b2 * Xn1d) + ((q63_t) a2 * Ynd);
+   }
+
+   /* Store the updated state variables back into the state array */
+   pState[0] = d1a;
+   pState[1] = d2a;
+   pState[2] = d1b;
+   pState[3] = d2b;
+   pState[4] = d1c;
+   pState[5] = d2c;
+   pState[6] = d1d;
+   pState[7] = d2d;
+}
+
+/**
+* @brief Processing function for the Q31 multi-channel transposed direct form II Biquad cascade filter.
+* @param[in]  *S        points to an instance of the filter data structure.
+* @param[in]  *pSrc     points to the block of interleaved input data.
+* @param[out] *pDst     points to the block of interleaved output data.
+* @param[in]  blockSize number of samples per channel to process.
+* @return none.
+*
+* \par
+* The channel layout and the processing order are those of riscv_biquad_cascade_multichan_df2T_f32().
+*
+* <b>Scaling and Overflow Behavior:</b>
+* \par
+* The coefficients are in 1.31 format, scaled by <code>2^-postShift</code> as for riscv_biquad_cascade_df1_q31().
+* The state variables <code>d1</code> and <code>d2</code> hold the sums of 2.62 products in 64 bits, which gives them the wide
+* dynamic range the transposed structure needs.  The output <code>b0 * x[n] + d1</code> is shifted right by
+* <code>31-postShift</code> bits and truncated to 1.31 format without saturation, so the filter has to be scaled such that
+* the output stays in range.
+*/
+
+void riscv_biquad_cascade_multichan_df2T_q31(
+const riscv_biquad_cascade_multichan_df2T_instance_q31 * S,
+q31_t * pSrc,
+q31_t * pDst,
+uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_multichan_df2T_q31);
+   q31_t *pIn = pSrc;                             /*  source pointer            */
+   q63_t *pState = S->pState;                     /*  State pointer             */
+   q31_t *pCoeffs = S->pCoeffs;                   /*  coefficient pointer       */
+   const q31_t *px;                               /*  input working pointer     */
+   q31_t *py;                                     /*  output working pointer    */
+   q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients       */
+   q31_t Xn1, Yn;                                 /*  temporary input and output */
+   q63_t d1, d2;                                  /*  state variables           */
+   uint32_t shift = 31u - (uint32_t) S->postShift;  /*  output shift            */
+   uint32_t numChans = S->numChannels;            /*  number of channels        */
+   uint32_t sample, ch, stage = S->numStages;     /*  loop counters             */
+
+   do
+   {
+      ch = 0u;
+
+      /* Four channels at a time */
+      for (; (ch + 4u) <= numChans; ch += 4u)
+      {
+         riscv_biquad_multichan_df2T_4_q31(pCoeffs, pState + (2u * ch), pIn + ch, pDst + ch, numChans, blockSize, shift);
+      }
+
+      /* Remaining channels */
+      for (; ch < numChans; ch++)
+      {
+         /* Reading the coefficients */
+         b0 = pCoeffs[0];
+         b1 = pCoeffs[1];
+         b2 = pCoeffs[2];
+         a1 = pCoeffs[3];
+         a2 = pCoeffs[4];
+
+         /*Reading the state values */
+         d1 = pState[2u * ch];
+         d2 = pState[(2u * ch) + 1u];
+
+         px = pIn + ch;
+         py = pDst + ch;
+
+         for (sample = blockSize; sample > 0u; sample--)
+         {
+            Xn1 = *px;
+            px += numChans;
+
+            /* y[n] = b0 * x[n] + d1 */
+            Yn = (q31_t) ((((q63_t) b0 * Xn1) + d1) >> shift);
+
+            *py = Yn;
+            py += numChans;
+
+            /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+            d1 = ((q63_t) b1 * Xn1) + ((q63_t) a1 * Yn) + d2;
+
+            /* d2 = b2 * x[n] + a2 * y[n] */
+            d2 = ((q63_t) b2 * Xn1) + ((q63_t) a2 * Yn);
+         }
+
+         /* Store the updated state variables back into the state array */
+         pState[2u * ch] = d1;
+         pState[(2u * ch) + 1u] = d2;
+      }
+
+      pCoeffs += 5u;
+      pState += 2u * numChans;
+
+      /* The current stage input is given as the output to the next stage */
+      pIn = pDst;
+
+      /* decrement the loop counter */
+      stage--;
+
+   } while(stage > 0u);
+}
+
+/**
+* @} end of BiquadCascadeDF2T group
+*/
@@ -0,0 +1,58 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_cascade_stereo_df1_init_q15.c
+*
+* Description:  Initialization function for the Q15 direct form I Biquad
+*               cascade filter of interleaved stereo data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 Biquad cascade filter of stereo data.
+ * @param[in,out] *S           points to an instance of the stereo Q15 Biquad cascade structure.
+ * @param[in]     numStages    number of 2nd order stages in the filter.
+ * @param[in]     *pCoeffs     points to the filter coefficients, 4-byte aligned.
+ * @param[in]     *pState      points to the state buffer of <code>8*numStages</code> values, 4-byte aligned.
+ * @param[in]     postShift    shift to be applied to the accumulator result.
+ * @return        none
+ *
+ * \par
+ * The coefficients are those of riscv_biquad_cascade_df1_init_q15(), <code>{b10, 0, b11, b12, a11, a12, ...}</code>,
+ * and apply to both channels.  Each stage has the four state variables <code>{x[n-1], x[n-2], y[n-1], y[n-2]}</code>
+ * of the left channel followed by those of the right channel.
+ */
+
+void riscv_biquad_cascade_stereo_df1_init_q15(
+  riscv_biquad_cascade_stereo_df1_instance_q15 * S,
+  uint8_t numStages,
+  const q15_t * pCoeffs,
+  q15_t * pState,
+  int8_t postShift)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_stereo_df1_init_q15);
+
+  S->numStages = numStages;
+  S->postShift = postShift;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear the state buffer of 8 * numStages values */
+  memset(pState, 0, (8u * (uint32_t) numStages) * sizeof(q15_t));
+
+  S->pState = pState;
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,209 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_cascade_stereo_df1_q15.c
+*
+* Description:  Processing function for the Q15 direct form I Biquad
+*               cascade filter of interleaved stereo data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+#if defined (USE_DSP_RISCV)
+
+/*
+* @brief  Filters one sample of one channel through one stage.
+* @param[in]     b0      coefficient b0 of the stage.
+* @param[in]     b1b2    coefficients b1, b2 of the stage.
+* @param[in]     a1a2    coefficients a1, a2 of the stage.
+* @param[in,out] *Xn12   state variables x[n-1], x[n-2] of the channel.
+* @param[in,out] *Yn12   state variables y[n-1], y[n-2] of the channel.
+* @param[in]     Xn      input sample.
+* @param[in]     shift   right shift of the accumulator.
+* @return        output sample.
+*/
+
+static inline q15_t riscv_biquad_stereo_df1_stage_q15(
+  q15_t b0,
+  shortV b1b2,
+  shortV a1a2,
+  shortV * Xn12,
+  shortV * Yn12,
+  q15_t Xn,
+  int32_t shift)
+{
+  q63_t acc;                                     /*  Accumulator                                  */
+
+  /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+  acc = (q31_t) b0 *Xn;
+  acc += dotpv2(b1b2, *Xn12);
+  acc += dotpv2(a1a2, *Yn12);
+  acc = clip(RISCV_SAT(acc >> shift), -32768, 32767);
+
+  /* Xn2 = Xn1, Xn1 = Xn, Yn2 = Yn1, Yn1 = acc */
+  *Xn12 = pack2(Xn, (*Xn12)[0]);
+  *Yn12 = pack2(acc, (*Yn12)[0]);
+
+  return ((q15_t) acc);
+}
+
+#endif /* #if defined (USE_DSP_RISCV) */
+
+/**
+ * @brief Processing function for the Q15 Biquad cascade filter of stereo data.
+ * @param[in]  *S         points to an instance of the stereo Q15 Biquad cascade structure.
+ * @param[in]  *pSrc      points to the block of interleaved input pairs {left, right}, 4-byte aligned.
+ * @param[out] *pDst      points to the block of interleaved output pairs, 4-byte aligned, may be equal to pSrc.
+ * @param[in]  blockSize  number of sample pairs to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each channel is computed as by riscv_biquad_cascade_df1_q15(): the 2.30 products are accumulated in
+ * 64 bits, shifted by <code>postShift</code> and saturated to 1.15 format.  The output of each channel
+ * is identical to a call of riscv_biquad_cascade_df1_q15() on that channel alone with the same
+ * coefficients.
+ * \par
+ * Both channels share the coefficients, which are read once per stage and held in registers, and one
+ * loop.  With <code>USE_DSP_RISCV</code> the pair of samples is read and the pair of outputs written as one
+ * word and each channel takes one multiplication and two dual 16-bit dot products per stage; there is
+ * no deinterleaving and no second pass over the block as with two mono filters.
+ */
+
+void riscv_biquad_cascade_stereo_df1_q15(
+  const riscv_biquad_cascade_stereo_df1_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_biquad_cascade_stereo_df1_q15);
+  RISCV_SAT_STATS(riscv_biquad_cascade_stereo_df1_q15, 16);
+  q15_t *pIn = pSrc;                             /*  Source pointer                               */
+  q15_t *pOut = pDst;                            /*  Destination pointer                          */
+  int32_t shift = (15 - (int32_t) S->postShift); /*  Post shift                                   */
+  q15_t *pState = S->pState;                     /*  State pointer                                */
+  const q15_t *pCoeffs = S->pCoeffs;             /*  Coefficient pointer                          */
+  uint32_t sample, stage = S->numStages;         /*  Loop counters                                */
+#if defined (USE_DSP_RISCV)
+  q15_t b0;                                      /*  Filter coefficient b0                        */
+  shortV b1b2, a1a2;                             /*  Filter coefficient pairs                     */
+  shortV XL, YL, XR, YR;                         /*  State variable pairs of the two channels     */
+  shortV in;                                     /*  Pair of input samples                        */
+  q15_t outL, outR;
+#else
+  q15_t b0, b1, b2, a1, a2;                      /*  Filter coefficients                          */
+  q15_t XL1, XL2, YL1, YL2;                      /*  State variables of the left channel          */
+  q15_t XR1, XR2, YR1, YR2;                      /*  State variables of the right channel         */
+  q15_t Xn;
+  q63_t acc;                                     /*  Accumulator                                  */
+#endif
+
+  while(stage > 0u)
+  {
+    /* Reading the coefficients and the state values */
+#if defined (USE_DSP_RISCV)
+    b0 = pCoeffs[0];
+    b1b2 = *(shortV *) (pCoeffs + 2);
+    a1a2 = *(shortV *) (pCoeffs + 4);
+    XL = *(shortV *) pState;
+    YL = *(shortV *) (pState + 2);
+    XR = *(shortV *) (pState + 4);
+    YR = *(shortV *) (pState + 6);
+#else
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[2];
+    b2 = pCoeffs[3];
+    a1 = pCoeffs[4];
+    a2 = pCoeffs[5];
+    XL1 = pState[0];
+    XL2 = pState[1];
+    YL1 = pState[2];
+    YL2 = pState[3];
+    XR1 = pState[4];
+    XR2 = pState[5];
+    YR1 = pState[6];
+    YR2 = pState[7];
+#endif
+    pCoeffs += 6u;
+
+    for (sample = blockSize; sample > 0u; sample--)
+    {
+#if defined (USE_DSP_RISCV)
+      in = *(shortV *) pIn;
+      pIn += 2;
+
+      outL = riscv_biquad_stereo_df1_stage_q15(b0, b1b2, a1a2, &XL, &YL, in[0], shift);
+      outR = riscv_biquad_stereo_df1_stage_q15(b0, b1b2, a1a2, &XR, &YR, in[1], shift);
+
+      *(shortV *) pOut = pack2(outL, outR);
+      pOut += 2;
+#else
+      /* Left channel */
+      Xn = *pIn++;
+      acc = (q31_t) b0 * Xn;
+      acc += (q31_t) b1 * XL1;
+      acc += (q31_t) b2 * XL2;
+      acc += (q31_t) a1 * YL1;
+      acc += (q31_t) a2 * YL2;
+      acc = __SSAT(RISCV_SAT(acc >> shift), 16);
+      XL2 = XL1;
+      XL1 = Xn;
+      YL2 = YL1;
+      YL1 = (q15_t) acc;
+      *pOut++ = (q15_t) acc;
+
+      /* Right channel */
+      Xn = *pIn++;
+      acc = (q31_t) b0 * Xn;
+      acc += (q31_t) b1 * XR1;
+      acc += (q31_t) b2 * XR2;
+      acc += (q31_t) a1 * YR1;
+      acc += (q31_t) a2 * YR2;
+      acc = __SSAT(RISCV_SAT(acc >> shift), 16);
+      XR2 = XR1;
+      XR1 = Xn;
+      YR2 = YR1;
+      YR1 = (q15_t) acc;
+      *pOut++ = (q15_t) acc;
+#endif
+    }
+
+    /*  Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+    pOut = pDst;
+
+    /*  Store the updated state variables back into the pState array */
+#if defined (USE_DSP_RISCV)
+    *(shortV *) pState = XL;
+    *(shortV *) (pState + 2) = YL;
+    *(shortV *) (pState + 4) = XR;
+    *(shortV *) (pState + 6) = YR;
+#else
+    pState[0] = XL1;
+    pState[1] = XL2;
+    pState[2] = YL1;
+    pState[3] = YL2;
+    pState[4] = XR1;
+    pState[5] = XR2;
+    pState[6] = YR1;
+    pState[7] = YR2;
+#endif
+    pState += 8u;
+
+    stage--;
+  }
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
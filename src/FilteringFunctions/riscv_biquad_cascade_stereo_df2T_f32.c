@@ -159,6 +159,7 @@ float32_t * pSrc,
 float32_t * pDst,
 uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_biquad_cascade_stereo_df2T_f32);
 
     float32_t *pIn = pSrc;                         /*  source pointer            */
     float32_t *pOut = pDst;                        /*  destination pointer       */
@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_design_f32.c
+*
+* Description:  Audio EQ Cookbook design of floating-point Biquad
+*               coefficients.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FilterDesign
+ * @{
+ */
+
+/* ln(10)/80, exp(gainDb*RISCV_BIQUAD_DESIGN_DB) is the square root of the cookbook A */
+#define RISCV_BIQUAD_DESIGN_DB  0.028782314f
+
+/**
+* @brief  Audio EQ Cookbook design of one floating-point Biquad stage.
+* @param[in]  type      response of the stage.
+* @param[in]  freq      cut-off, centre or shelf mid-point frequency.
+* @param[in]  q         quality factor, 0.7071 for a Butterworth lowpass or highpass.
+* @param[in]  gainDb    gain of the peaking and shelving responses in dB, ignored by the others.
+* @param[out] *pCoeffs  points to the 5 coefficients of the stage.
+* @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>freq</code> is not in
+* <code>(0, 0.5)</code> or <code>q</code> is not positive.
+*
+* \par
+* The coefficients are the ones of the Audio EQ Cookbook by R. Bristow-Johnson, divided by
+* <code>a0</code> and stored in the order of riscv_biquad_cascade_df2T_init_f32():
+* <pre>
+*     {b0, b1, b2, -a1, -a2}
+* </pre>
+* The feedback coefficients are negated because the Biquad filters add <code>a1*y[n-1]</code> and
+* <code>a2*y[n-2]</code>.  The stage <code>k</code> of a cascade is designed into
+* <code>pCoeffs + 5*k</code>.  The bandpass response has a peak gain of 0 dB, the shelving
+* responses use the slope of the quality factor <code>q</code>.
+*/
+
+riscv_status riscv_biquad_design_f32(
+  riscv_biquad_design_type type,
+  float32_t freq,
+  float32_t q,
+  float32_t gainDb,
+  float32_t * pCoeffs)
+{
+  RISCV_PROFILE(riscv_biquad_design_f32);
+  float32_t w0 = 2.0f * PI * freq;               /* Angular frequency */
+  float32_t cs = riscv_cos_f32(w0);
+  float32_t alpha = riscv_sin_f32(w0) / (2.0f * q);
+  float32_t a, sqrtA, x;                         /* Cookbook A and its square root */
+  float32_t b0, b1, b2, a0, a1, a2;
+
+  if((freq <= 0.0f) || (freq >= 0.5f) || (q <= 0.0f))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  x = gainDb * RISCV_BIQUAD_DESIGN_DB;
+  riscv_vexp_f32(&x, &sqrtA, 1u);
+  a = sqrtA * sqrtA;
+
+  a0 = 1.0f + alpha;
+  a1 = -2.0f * cs;
+  a2 = 1.0f - alpha;
+
+  switch (type)
+  {
+    case RISCV_BIQUAD_DESIGN_LOWPASS:
+      b1 = 1.0f - cs;
+      b0 = 0.5f * b1;
+      b2 = b0;
+      break;
+
+    case RISCV_BIQUAD_DESIGN_HIGHPASS:
+      b1 = -(1.0f + cs);
+      b0 = -0.5f * b1;
+      b2 = b0;
+      break;
+
+    case RISCV_BIQUAD_DESIGN_BANDPASS:
+      b0 = alpha;
+      b1 = 0.0f;
+      b2 = -alpha;
+      break;
+
+    case RISCV_BIQUAD_DESIGN_NOTCH:
+      b0 = 1.0f;
+      b1 = a1;
+      b2 = 1.0f;
+      break;
+
+    case RISCV_BIQUAD_DESIGN_PEAKING:
+      b0 = 1.0f + (alpha * a);
+      b1 = a1;
+      b2 = 1.0f - (alpha * a);
+      a0 = 1.0f + (alpha / a);
+      a2 = 1.0f - (alpha / a);
+      break;
+
+    case RISCV_BIQUAD_DESIGN_LOWSHELF:
+      x = 2.0f * sqrtA * alpha;
+      b0 = a * (((a + 1.0f) - ((a - 1.0f) * cs)) + x);
+      b1 = 2.0f * a * ((a - 1.0f) - ((a + 1.0f) * cs));
+      b2 = a * (((a + 1.0f) - ((a - 1.0f) * cs)) - x);
+      a0 = ((a + 1.0f) + ((a - 1.0f) * cs)) + x;
+      a1 = -2.0f * ((a - 1.0f) + ((a + 1.0f) * cs));
+      a2 = ((a + 1.0f) + ((a - 1.0f) * cs)) - x;
+      break;
+
+    case RISCV_BIQUAD_DESIGN_HIGHSHELF:
+      x = 2.0f * sqrtA * alpha;
+      b0 = a * (((a + 1.0f) + ((a - 1.0f) * cs)) + x);
+      b1 = -2.0f * a * ((a - 1.0f) + ((a + 1.0f) * cs));
+      b2 = a * (((a + 1.0f) + ((a - 1.0f) * cs)) - x);
+      a0 = ((a + 1.0f) - ((a - 1.0f) * cs)) + x;
+      a1 = 2.0f * ((a - 1.0f) - ((a + 1.0f) * cs));
+      a2 = ((a + 1.0f) - ((a - 1.0f) * cs)) - x;
+      break;
+
+    default:
+      return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  Normalized by a0, feedback negated for the Biquad filters */
+  x = 1.0f / a0;
+  pCoeffs[0] = b0 * x;
+  pCoeffs[1] = b1 * x;
+  pCoeffs[2] = b2 * x;
+  pCoeffs[3] = -a1 * x;
+  pCoeffs[4] = -a2 * x;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of FilterDesign group
+*/
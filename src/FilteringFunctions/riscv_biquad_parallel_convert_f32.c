@@ -0,0 +1,252 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_parallel_convert_f32.c
+*
+* Description:  Partial fraction expansion of a biquad cascade into parallel sections.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadParallel
+ * @{
+ */
+
+typedef struct
+{
+  double re;
+  double im;
+} riscv_biquad_parallel_cplx;
+
+static riscv_biquad_parallel_cplx riscv_biquad_parallel_mul(
+  riscv_biquad_parallel_cplx a,
+  riscv_biquad_parallel_cplx b)
+{
+  riscv_biquad_parallel_cplx r;
+
+  r.re = (a.re * b.re) - (a.im * b.im);
+  r.im = (a.re * b.im) + (a.im * b.re);
+
+  return (r);
+}
+
+static riscv_biquad_parallel_cplx riscv_biquad_parallel_div(
+  riscv_biquad_parallel_cplx a,
+  riscv_biquad_parallel_cplx b)
+{
+  riscv_biquad_parallel_cplx r;
+  double den = (b.re * b.re) + (b.im * b.im);
+
+  r.re = ((a.re * b.re) + (a.im * b.im)) / den;
+  r.im = ((a.im * b.re) - (a.re * b.im)) / den;
+
+  return (r);
+}
+
+/*
+* @brief  Value of c0 + c1*w + c2*w^2 at w.
+*/
+
+static riscv_biquad_parallel_cplx riscv_biquad_parallel_poly(
+  double c0,
+  double c1,
+  double c2,
+  riscv_biquad_parallel_cplx w)
+{
+  riscv_biquad_parallel_cplx r;
+
+  /* (c2*w + c1)*w + c0 */
+  r.re = (c2 * w.re) + c1;
+  r.im = c2 * w.im;
+  r = riscv_biquad_parallel_mul(r, w);
+  r.re += c0;
+
+  return (r);
+}
+
+/*
+* @brief  Numerator of the partial fraction of stage k at the pole w, N(w) / prod_{j!=k} D_j(w).
+* @return 0, or 1 when another stage has the same pole.
+*/
+
+static uint32_t riscv_biquad_parallel_residue(
+  const float32_t * pCascade,
+  uint32_t numStages,
+  uint32_t k,
+  riscv_biquad_parallel_cplx w,
+  riscv_biquad_parallel_cplx * pRes)
+{
+  riscv_biquad_parallel_cplx num = { 1.0, 0.0 }, den = { 1.0, 0.0 }, d;
+  const float32_t *c;
+  uint32_t j;
+
+  for (j = 0u; j < numStages; j++)
+  {
+    c = pCascade + (5u * j);
+    num = riscv_biquad_parallel_mul(num, riscv_biquad_parallel_poly(c[0], c[1], c[2], w));
+    if(j != k)
+    {
+      d = riscv_biquad_parallel_poly(1.0, -(double) c[3], -(double) c[4], w);
+      if(((d.re * d.re) + (d.im * d.im)) < 1e-24)
+      {
+        return (1u);
+      }
+      den = riscv_biquad_parallel_mul(den, d);
+    }
+  }
+
+  *pRes = riscv_biquad_parallel_div(num, den);
+
+  return (0u);
+}
+
+/**
+ * @brief  Converts the coefficients of a biquad cascade to the parallel form.
+ * @param[in]   *pCascade   points to the <code>5*numStages</code> coefficients <code>{b0, b1, b2, a1, a2}</code>
+ *                          of the stages, as for riscv_biquad_cascade_df2T_init_f32().
+ * @param[in]   numStages   number of stages.
+ * @param[out]  *pCoeffs    points to the <code>4*numStages</code> coefficients of the sections.
+ * @param[out]  *pDirect    points to the direct gain <code>d0</code>.
+ * @return      RISCV_MATH_SUCCESS, RISCV_MATH_ARGUMENT_ERROR if a stage has no pole or the numerator has a
+ *              higher degree than the denominator, or RISCV_MATH_SINGULAR if two poles coincide.
+ *
+ * \par
+ * Section k keeps the poles of stage k, <code>a1k</code> and <code>a2k</code> are copied.  For the two
+ * poles <code>w1</code>, <code>w2</code> of <code>1 - a1k w - a2k w^2</code>, with <code>w = z^-1</code>,
+ * the numerator <code>b0k + b1k w</code> of the section is the line through the residues
+ * <code>N(wi) / prod_{j!=k} D_j(wi)</code>, with <code>N</code> the product of the numerators of all
+ * stages; a first order stage, <code>a2k = 0</code>, gets <code>b1k = 0</code>.  When the numerator and
+ * the denominator of the cascade have the same degree in <code>w</code>, <code>d0</code> is the ratio of
+ * their leading coefficients, otherwise it is 0.  The arithmetic is in double precision.
+ */
+
+riscv_status riscv_biquad_parallel_convert_f32(
+  const float32_t * pCascade,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pDirect)
+{
+  RISCV_PROFILE(riscv_biquad_parallel_convert_f32);
+  riscv_biquad_parallel_cplx w1, w2, r1, r2, c1;
+  double a1, a2, disc, q, leadNum = 1.0, leadDen = 1.0;
+  uint32_t degNum = 0u, degDen = 0u;
+  const float32_t *c;
+  uint32_t k;
+
+  /* Degrees and leading coefficients of the numerator and denominator in w */
+  for (k = 0u; k < numStages; k++)
+  {
+    c = pCascade + (5u * k);
+    if(c[4] != 0.0f)
+    {
+      degDen += 2u;
+      leadDen *= -(double) c[4];
+    }
+    else if(c[3] != 0.0f)
+    {
+      degDen += 1u;
+      leadDen *= -(double) c[3];
+    }
+    else
+    {
+      return (RISCV_MATH_ARGUMENT_ERROR);
+    }
+
+    if(c[2] != 0.0f)
+    {
+      degNum += 2u;
+      leadNum *= c[2];
+    }
+    else if(c[1] != 0.0f)
+    {
+      degNum += 1u;
+      leadNum *= c[1];
+    }
+    else
+    {
+      leadNum *= c[0];
+    }
+  }
+
+  if(degNum > degDen)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+  *pDirect = (degNum == degDen) ? (float32_t) (leadNum / leadDen) : 0.0f;
+
+  for (k = 0u; k < numStages; k++)
+  {
+    c = pCascade + (5u * k);
+    a1 = c[3];
+    a2 = c[4];
+
+    if(a2 == 0.0)
+    {
+      /* One pole at w = 1/a1 */
+      w1.re = 1.0 / a1;
+      w1.im = 0.0;
+      if(riscv_biquad_parallel_residue(pCascade, numStages, k, w1, &r1) != 0u)
+      {
+        return (RISCV_MATH_SINGULAR);
+      }
+      pCoeffs[0] = (float32_t) r1.re;
+      pCoeffs[1] = 0.0f;
+    }
+    else
+    {
+      /* Roots of a2 w^2 + a1 w - 1 */
+      disc = (a1 * a1) + (4.0 * a2);
+      if(fabs(disc) < (1e-12 * ((a1 * a1) + fabs(a2))))
+      {
+        return (RISCV_MATH_SINGULAR);
+      }
+      if(disc > 0.0)
+      {
+        /* Without the cancellation of the textbook formula */
+        q = -0.5 * (a1 + ((a1 >= 0.0) ? sqrt(disc) : -sqrt(disc)));
+        w1.re = q / a2;
+        w2.re = -1.0 / q;
+        w1.im = 0.0;
+        w2.im = 0.0;
+      }
+      else
+      {
+        w1.re = -a1 / (2.0 * a2);
+        w1.im = sqrt(-disc) / (2.0 * a2);
+        w2.re = w1.re;
+        w2.im = -w1.im;
+      }
+
+      if((riscv_biquad_parallel_residue(pCascade, numStages, k, w1, &r1) != 0u) ||
+         (riscv_biquad_parallel_residue(pCascade, numStages, k, w2, &r2) != 0u))
+      {
+        return (RISCV_MATH_SINGULAR);
+      }
+
+      /* c1 = (r2 - r1)/(w2 - w1), c0 = r1 - c1*w1, both real */
+      c1.re = r2.re - r1.re;
+      c1.im = r2.im - r1.im;
+      w2.re -= w1.re;
+      w2.im -= w1.im;
+      c1 = riscv_biquad_parallel_div(c1, w2);
+      pCoeffs[1] = (float32_t) c1.re;
+      pCoeffs[0] = (float32_t) (r1.re - riscv_biquad_parallel_mul(c1, w1).re);
+    }
+
+    pCoeffs[2] = c[3];
+    pCoeffs[3] = c[4];
+    pCoeffs += 4u;
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of BiquadParallel group
+ */
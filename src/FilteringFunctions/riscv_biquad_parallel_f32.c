@@ -0,0 +1,204 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_parallel_f32.c
+*
+* Description:  Floating-point parallel-form IIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup BiquadParallel Parallel-Form IIR Filters
+ *
+ * The transfer function of a cascade of biquads is split into partial fractions, a direct gain and one
+ * section per pair of poles, and the outputs of the sections are added:
+ * <pre>
+ *     H(z) = d0 + sum_k (b0k + b1k z^-1) / (1 - a1k z^-1 - a2k z^-2)
+ * </pre>
+ * Every section filters the input on its own, so unlike the stages of riscv_biquad_cascade_df2T_f32()
+ * the sections have no dependencies between them: the floating-point functions run four of them
+ * side by side to fill the FPU pipeline, the Q15 functions form the products of a section with two
+ * dot products, and riscv_biquad_parallel_par_f32() splits the sections across the cluster cores.
+ * \par
+ * The coefficients of section k are <code>{b0k, b1k, a1k, a2k}</code>, with the feedback coefficients
+ * signed as in riscv_biquad_cascade_df2T_f32().  riscv_biquad_parallel_convert_f32() computes them
+ * and <code>d0</code> from the coefficients of a cascade.  The floating-point sections are transposed
+ * direct form II with the states <code>{d1k, d2k}</code>:
+ * <pre>
+ *     y[n] = b0 * x[n] + d1
+ *     d1 = b1 * x[n] + a1 * y[n] + d2
+ *     d2 = a2 * y[n]
+ * </pre>
+ * \par
+ * The partial fractions of a filter with poles close to each other have large coefficients that cancel
+ * in the sum, a narrow high-order filter loses more precision in the parallel form than in the cascade.
+ */
+
+/**
+ * @addtogroup BiquadParallel
+ * @{
+ */
+
+/*
+* @brief  Adds the outputs of four sections to a block.
+* @param[in]     *pCoeffs  points to the 16 coefficients of the four sections.
+* @param[in,out] *pState   points to the 8 state variables of the four sections.
+* @param[in]     *pIn      points to the block of input data.
+* @param[in,out] *pOut     points to the block of output data.
+* @param[in]     blockSize number of samples to process.
+*
+* The four recursions are independent and interleaved, the FPU works on one while the others wait
+* for their results.
+*/
+
+static void riscv_biquad_parallel_4_f32(
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  const float32_t * pIn,
+  float32_t * pOut,
+  uint32_t blockSize)
+{
+  float32_t b10 = pCoeffs[0], b11 = pCoeffs[1], a11 = pCoeffs[2], a12 = pCoeffs[3];
+  float32_t b20 = pCoeffs[4], b21 = pCoeffs[5], a21 = pCoeffs[6], a22 = pCoeffs[7];
+  float32_t b30 = pCoeffs[8], b31 = pCoeffs[9], a31 = pCoeffs[10], a32 = pCoeffs[11];
+  float32_t b40 = pCoeffs[12], b41 = pCoeffs[13], a41 = pCoeffs[14], a42 = pCoeffs[15];
+  float32_t d11 = pState[0], d12 = pState[1], d21 = pState[2], d22 = pState[3];
+  float32_t d31 = pState[4], d32 = pState[5], d41 = pState[6], d42 = pState[7];
+  float32_t Xn, y1, y2, y3, y4;
+  uint32_t sample;
+
+  for (sample = blockSize; sample > 0u; sample--)
+  {
+    Xn = *pIn++;
+
+    y1 = (b10 * Xn) + d11;
+    y2 = (b20 * Xn) + d21;
+    y3 = (b30 * Xn) + d31;
+    y4 = (b40 * Xn) + d41;
+
+    d11 = ((b11 * Xn) + (a11 * y1)) + d12;
+    d21 = ((b21 * Xn) + (a21 * y2)) + d22;
+    d31 = ((b31 * Xn) + (a31 * y3)) + d32;
+    d41 = ((b41 * Xn) + (a41 * y4)) + d42;
+
+    d12 = a12 * y1;
+    d22 = a22 * y2;
+    d32 = a32 * y3;
+    d42 = a42 * y4;
+
+    *pOut++ += (y1 + y2) + (y3 + y4);
+  }
+
+  pState[0] = d11;
+  pState[1] = d12;
+  pState[2] = d21;
+  pState[3] = d22;
+  pState[4] = d31;
+  pState[5] = d32;
+  pState[6] = d41;
+  pState[7] = d42;
+}
+
+/*
+* @brief  Adds the output of one section to a block.
+*/
+
+static void riscv_biquad_parallel_1_f32(
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  const float32_t * pIn,
+  float32_t * pOut,
+  uint32_t blockSize)
+{
+  float32_t b0 = pCoeffs[0], b1 = pCoeffs[1], a1 = pCoeffs[2], a2 = pCoeffs[3];
+  float32_t d1 = pState[0], d2 = pState[1];
+  float32_t Xn, y;
+  uint32_t sample;
+
+  for (sample = blockSize; sample > 0u; sample--)
+  {
+    Xn = *pIn++;
+    y = (b0 * Xn) + d1;
+    d1 = ((b1 * Xn) + (a1 * y)) + d2;
+    d2 = a2 * y;
+    *pOut++ += y;
+  }
+
+  pState[0] = d1;
+  pState[1] = d2;
+}
+
+/**
+ * @brief  Adds the outputs of a range of sections of a floating-point parallel-form IIR filter to a block.
+ * @param[in]     *S           points to an instance of the floating-point parallel-form structure.
+ * @param[in]     firstStage   first section to run.
+ * @param[in]     numStages    number of sections to run.
+ * @param[in]     *pSrc        points to the block of input data.
+ * @param[in,out] *pDst        points to the block the outputs of the sections are added to.
+ * @param[in]     blockSize    number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The building block of riscv_biquad_parallel_f32() and riscv_biquad_parallel_par_f32(); the direct
+ * gain is not applied.
+ */
+
+void riscv_biquad_parallel_stages_f32(
+  const riscv_biquad_parallel_instance_f32 * S,
+  uint32_t firstStage,
+  uint32_t numStages,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float32_t *pCoeffs = S->pCoeffs + (4u * firstStage);
+  float32_t *pState = S->pState + (2u * firstStage);
+
+  while(numStages >= 4u)
+  {
+    riscv_biquad_parallel_4_f32(pCoeffs, pState, pSrc, pDst, blockSize);
+    pCoeffs += 16u;
+    pState += 8u;
+    numStages -= 4u;
+  }
+
+  while(numStages > 0u)
+  {
+    riscv_biquad_parallel_1_f32(pCoeffs, pState, pSrc, pDst, blockSize);
+    pCoeffs += 4u;
+    pState += 2u;
+    numStages--;
+  }
+}
+
+/**
+ * @brief  Processing function for the floating-point parallel-form IIR filter.
+ * @param[in]     *S         points to an instance of the floating-point parallel-form structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data, not overlapping <code>pSrc</code>.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void riscv_biquad_parallel_f32(
+  const riscv_biquad_parallel_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_biquad_parallel_f32);
+
+  /* Direct path, then the sections */
+  riscv_scale_f32((float32_t *) pSrc, S->direct, pDst, blockSize);
+  riscv_biquad_parallel_stages_f32(S, 0u, S->numStages, pSrc, pDst, blockSize);
+}
+
+/**
+ * @} end of BiquadParallel group
+ */
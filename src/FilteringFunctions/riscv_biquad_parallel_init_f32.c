@@ -0,0 +1,50 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_parallel_init_f32.c
+*
+* Description:  Initialization function for the floating-point parallel-form IIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadParallel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point parallel-form IIR filter.
+ * @param[out]    *S          points to an instance of the floating-point parallel-form structure.
+ * @param[in]     numStages   number of second order sections.
+ * @param[in]     *pCoeffs    points to the <code>4*numStages</code> coefficients of the sections.
+ * @param[in]     direct      direct gain <code>d0</code>.
+ * @param[in]     *pState     points to the state buffer of <code>2*numStages</code> values.
+ * @return none.
+ */
+
+void riscv_biquad_parallel_init_f32(
+  riscv_biquad_parallel_instance_f32 * S,
+  uint8_t numStages,
+  const float32_t * pCoeffs,
+  float32_t direct,
+  float32_t * pState)
+{
+  RISCV_PROFILE(riscv_biquad_parallel_init_f32);
+
+  S->numStages = numStages;
+  S->pCoeffs = pCoeffs;
+  S->direct = direct;
+
+  memset(pState, 0, (2u * (uint32_t) numStages) * sizeof(float32_t));
+  S->pState = pState;
+}
+
+/**
+ * @} end of BiquadParallel group
+ */
@@ -0,0 +1,58 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_parallel_init_q15.c
+*
+* Description:  Initialization function for the Q15 parallel-form IIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadParallel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 parallel-form IIR filter.
+ * @param[out]    *S          points to an instance of the Q15 parallel-form structure.
+ * @param[in]     numStages   number of second order sections.
+ * @param[in]     *pCoeffs    points to the <code>4*numStages</code> coefficients of the sections, word aligned.
+ * @param[in]     direct      direct gain <code>d0</code>, scaled as the coefficients.
+ * @param[in]     *pState     points to the state buffer of <code>2*numStages+2</code> values, word aligned.
+ * @param[in]     postShift   shift to be applied to the accumulators.
+ * @return none.
+ *
+ * \par
+ * The coefficients and the direct gain are in 1.15 format divided by <code>2^postShift</code>, as for
+ * riscv_biquad_cascade_df1_init_q15().  The state holds <code>{x[n-1], 0}</code> followed by
+ * <code>{y[n-1], y[n-2]}</code> of every section.
+ */
+
+void riscv_biquad_parallel_init_q15(
+  riscv_biquad_parallel_instance_q15 * S,
+  uint8_t numStages,
+  const q15_t * pCoeffs,
+  q15_t direct,
+  q15_t * pState,
+  int8_t postShift)
+{
+  RISCV_PROFILE(riscv_biquad_parallel_init_q15);
+
+  S->numStages = numStages;
+  S->postShift = postShift;
+  S->pCoeffs = pCoeffs;
+  S->direct = direct;
+
+  memset(pState, 0, (2u * (uint32_t) numStages + 2u) * sizeof(q15_t));
+  S->pState = pState;
+}
+
+/**
+ * @} end of BiquadParallel group
+ */
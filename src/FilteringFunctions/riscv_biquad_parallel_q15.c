@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_parallel_q15.c
+*
+* Description:  Q15 parallel-form IIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadParallel
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 parallel-form IIR filter.
+ * @param[in]     *S         points to an instance of the Q15 parallel-form structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The Q15 sections are direct form I and share the input state <code>x[n-1]</code>:
+ * <pre>
+ *     y[n] = b0 * x[n] + b1 * x[n-1] + a1 * y[n-1] + a2 * y[n-2]
+ * </pre>
+ * With <code>USE_DSP_RISCV</code> the input pair <code>{x[n], x[n-1]}</code> is packed once per sample
+ * and every section is two dot products, with <code>{b0, b1}</code> and with <code>{a1, a2}</code> on its
+ * output pair.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products of a section are accumulated in 64 bits, shifted by <code>15-postShift</code> bits and
+ * the section output saturated to 1.15 format, as in riscv_biquad_cascade_df1_q15().  The output is the
+ * sum of the accumulators of the sections and of <code>direct*x[n]</code> before the shift, saturated
+ * to 1.15 format; a section output may be larger than the filter output, scale the input down when
+ * one of them saturates.
+ */
+
+void riscv_biquad_parallel_q15(
+  const riscv_biquad_parallel_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_biquad_parallel_q15);
+  const q15_t *pCoeffs;                          /* Coefficients of the current section */
+  q15_t *pState;                                 /* Output states of the current section */
+  uint32_t numStages = S->numStages;
+  int32_t shift = 15 - (int32_t) S->postShift;
+  q31_t direct = S->direct;
+  q15_t Xn, Xn1 = S->pState[0];
+  q63_t acc, sum;
+  uint32_t sample, stage;
+
+#if defined (USE_DSP_RISCV)
+  shortV x01, y12;
+
+  for (sample = blockSize; sample > 0u; sample--)
+  {
+    Xn = *pSrc++;
+    x01 = pack2(Xn, Xn1);
+    pCoeffs = S->pCoeffs;
+    pState = S->pState + 2;
+    sum = direct * Xn;
+
+    for (stage = numStages; stage > 0u; stage--)
+    {
+      /* acc = b0 * x[n] + b1 * x[n-1] + a1 * y[n-1] + a2 * y[n-2] */
+      y12 = *(shortV *) pState;
+      acc = dotpv2(*(shortV *) pCoeffs, x01);
+      acc += dotpv2(*(shortV *) (pCoeffs + 2), y12);
+      sum += acc;
+
+      *(shortV *) pState = pack2(clip((acc >> shift), -32768, 32767), y12[0]);
+      pCoeffs += 4;
+      pState += 2;
+    }
+
+    acc = sum >> shift;
+    *pDst++ = (q15_t) ((acc > 0x7FFF) ? 0x7FFF : ((acc < -0x8000) ? -0x8000 : acc));
+    Xn1 = Xn;
+  }
+#else
+  for (sample = blockSize; sample > 0u; sample--)
+  {
+    Xn = *pSrc++;
+    pCoeffs = S->pCoeffs;
+    pState = S->pState + 2;
+    sum = direct * Xn;
+
+    for (stage = numStages; stage > 0u; stage--)
+    {
+      /* acc = b0 * x[n] + b1 * x[n-1] + a1 * y[n-1] + a2 * y[n-2] */
+      acc = (q31_t) pCoeffs[0] * Xn;
+      acc += (q31_t) pCoeffs[1] * Xn1;
+      acc += (q31_t) pCoeffs[2] * pState[0];
+      acc += (q31_t) pCoeffs[3] * pState[1];
+      sum += acc;
+
+      pState[1] = pState[0];
+      pState[0] = (q15_t) __SSAT((acc >> shift), 16);
+      pCoeffs += 4;
+      pState += 2;
+    }
+
+    acc = sum >> shift;
+    *pDst++ = (q15_t) ((acc > 0x7FFF) ? 0x7FFF : ((acc < -0x8000) ? -0x8000 : acc));
+    Xn1 = Xn;
+  }
+#endif
+
+  S->pState[0] = Xn1;
+}
+
+/**
+ * @} end of BiquadParallel group
+ */
@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfir_f32.c
+*
+* Description:  Floating-point FIR filter for complex signals.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup CFIR Complex FIR Filters
+ *
+ * FIR filters for complex signals given as interleaved (real, imag) pairs, such as the I/Q
+ * samples of a baseband receiver:
+ * <pre>
+ *    y[n] = b[0] * x[n] + b[1] * x[n-1] + ... + b[numTaps-1] * x[n-numTaps+1]
+ * </pre>
+ * with complex <code>x</code> and <code>y</code>.  The taps <code>b</code> are either
+ * <code>numTaps</code> real values, applied to the real and the imaginary part alike, or
+ * <code>numTaps</code> complex values as interleaved (real, imag) pairs, for filters with
+ * an asymmetric frequency response.  Both are stored in time reversed order, as for the
+ * real FIR filters.
+ * \par
+ * One call replaces two calls of the real FIR filter on the deinterleaved real and imaginary
+ * parts for real taps, and four calls for complex taps, and needs neither the deinterleaving
+ * nor the interleaving of the result.
+ * \par
+ * The state array holds <code>2*(numTaps+blockSize-1)</code> values, the last
+ * <code>numTaps-1</code> complex input samples of the previous call followed by the
+ * <code>blockSize</code> samples of the current one.  <code>blockSize</code> is the number of
+ * complex samples processed per call.
+ */
+
+/**
+ * @addtogroup CFIR
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point complex FIR filter.
+ * @param[in]  *S          points to an instance of the floating-point complex FIR structure.
+ * @param[in]  *pSrc       points to the block of complex input samples.
+ * @param[out] *pDst       points to the block of complex output samples.
+ * @param[in]  blockSize   number of complex samples to process.
+ * @return none.
+ */
+
+void riscv_cfir_f32(
+  const riscv_cfir_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cfir_f32);
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px;                                 /* Temporary pointer for state buffer */
+  float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
+  float32_t accRe, accIm;                        /* Accumulators */
+  float32_t xRe, xIm, bRe, bIm;                  /* State and coefficient values */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (2u * (numTaps - 1u));
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy one complex sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    accRe = 0.0f;
+    accIm = 0.0f;
+    px = pState;
+    pb = S->pCoeffs;
+    tapCnt = numTaps;
+
+    if(S->cmplxCoeffs != 0u)
+    {
+      do
+      {
+        /* acc += (xRe + j xIm) * (bRe + j bIm) */
+        xRe = *px++;
+        xIm = *px++;
+        bRe = *pb++;
+        bIm = *pb++;
+        accRe += (xRe * bRe) - (xIm * bIm);
+        accIm += (xRe * bIm) + (xIm * bRe);
+        tapCnt--;
+      } while(tapCnt > 0u);
+    }
+    else
+    {
+      do
+      {
+        /* acc += (xRe + j xIm) * bRe */
+        bRe = *pb++;
+        accRe += *px++ * bRe;
+        accIm += *px++ * bRe;
+        tapCnt--;
+      } while(tapCnt > 0u);
+    }
+
+    *pDst++ = accRe;
+    *pDst++ = accIm;
+
+    /* Advance the state pointer by one complex sample */
+    pState += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 complex samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+  tapCnt = 2u * (numTaps - 1u);
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+}
+
+/**
+ * @} end of CFIR group
+ */
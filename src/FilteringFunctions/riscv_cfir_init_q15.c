@@ -0,0 +1,64 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfir_init_q15.c
+*
+* Description:  Q15 complex FIR filter initialization function.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CFIR
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 complex FIR filter.
+ * @param[in,out] *S            points to an instance of the Q15 complex FIR structure.
+ * @param[in]     numTaps       number of filter taps.
+ * @param[in]     *pCoeffs      points to the taps, numTaps real values or numTaps (real, imag) pairs.
+ * @param[in]     *pState       points to the state buffer of 2*(numTaps+blockSize-1) values.
+ * @param[in]     blockSize     number of complex samples processed per call.
+ * @param[in]     cmplxCoeffs   0 for real taps, 1 for complex taps.
+ * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>numTaps</code> is 0.
+ *
+ * \par
+ * The taps are stored in time reversed order, <code>{b[numTaps-1], b[numTaps-2], ..., b[0]}</code>.
+ * The state buffer is cleared.
+ */
+
+riscv_status riscv_cfir_init_q15(
+  riscv_cfir_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize,
+  uint8_t cmplxCoeffs)
+{
+  RISCV_PROFILE(riscv_cfir_init_q15);
+
+  if(numTaps == 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numTaps = numTaps;
+  S->cmplxCoeffs = (cmplxCoeffs != 0u) ? 1u : 0u;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear the state buffer, numTaps - 1 previous and blockSize new complex samples */
+  memset(pState, 0, 2u * (numTaps + (blockSize - 1u)) * sizeof(q15_t));
+  S->pState = pState;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of CFIR group
+ */
@@ -0,0 +1,227 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfir_q15.c
+*
+* Description:  Q15 FIR filter for complex signals.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CFIR
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 complex FIR filter.
+ * @param[in]  *S          points to an instance of the Q15 complex FIR structure.
+ * @param[in]  *pSrc       points to the block of complex input samples.
+ * @param[out] *pDst       points to the block of complex output samples.
+ * @param[in]  blockSize   number of complex samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * As riscv_fir_q15(), the products are summed in 64-bit accumulators in 34.30 format and the
+ * sums saturated to 1.15 format.
+ * \par
+ * With the DSP extension two outputs are computed per pass on the packed (real, imag) pairs:
+ * - real taps: the real parts and the imaginary parts of two consecutive samples are paired
+ *   by shuffles and multiplied with two taps per <code>pv.dotsp.h</code>;
+ * - complex taps: the imaginary part is one <code>pv.dotsp.h</code> of the sample with
+ *   (imag, real) of the tap, the real part one <code>pv.dotsp.h</code> with the tap minus
+ *   twice the product of the imaginary parts, summed apart.
+ * \par
+ * As in riscv_fir_q15(), the 32-bit sum of the two products of one <code>pv.dotsp.h</code>
+ * wraps when both products are 0x8000 * 0x8000.  The state buffer and <code>pCoeffs</code>
+ * must be 32-bit aligned.
+ */
+
+void riscv_cfir_q15(
+  const riscv_cfir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cfir_q15);
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px;                                     /* Temporary pointer for state buffer */
+  q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+  q63_t accRe, accIm;                            /* Accumulators */
+  q31_t xRe, xIm, bRe, bIm;                      /* State and coefficient values */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (2u * (numTaps - 1u));
+
+#if defined (USE_DSP_RISCV)
+  shortV even = { 0, 2 };                        /* Real parts of two samples */
+  shortV odd = { 1, 3 };                         /* Imaginary parts of two samples */
+  shortV swap = { 1, 0 };                        /* (imag, real) of a tap */
+  shortV x0, x1, x2, c, cs;
+  q63_t acc0Re, acc0Im, acc1Re, acc1Im;
+  q63_t acc0Cross, acc1Cross;                    /* Products of the imaginary parts */
+
+  for (blkCnt = blockSize >> 1u; blkCnt > 0u; blkCnt--)
+  {
+    /* Copy two complex samples into the state buffer */
+    *(shortV *) pStateCurnt = *(shortV *) pSrc;
+    *(shortV *) (pStateCurnt + 2) = *(shortV *) (pSrc + 2);
+    pStateCurnt += 4;
+    pSrc += 4;
+
+    acc0Re = 0;
+    acc0Im = 0;
+    acc1Re = 0;
+    acc1Im = 0;
+    acc0Cross = 0;
+    acc1Cross = 0;
+    px = pState;
+    pb = S->pCoeffs;
+
+    /* x0 is the sample of the first output for the current tap, x1 the one of the second */
+    x0 = *(shortV *) px;
+    px += 2;
+
+    if(S->cmplxCoeffs != 0u)
+    {
+      for (tapCnt = numTaps; tapCnt > 0u; tapCnt--)
+      {
+        c = *(shortV *) pb;
+        pb += 2;
+        cs = shufflev4(c, c, swap);
+        x1 = *(shortV *) px;
+        px += 2;
+
+        /* re = (xRe * bRe + xIm * bIm) - 2 * xIm * bIm, im = xRe * bIm + xIm * bRe */
+        acc0Re += dotpv2(x0, c);
+        acc0Cross += (q31_t) x0[1] * c[1];
+        acc0Im += dotpv2(x0, cs);
+        acc1Re += dotpv2(x1, c);
+        acc1Cross += (q31_t) x1[1] * c[1];
+        acc1Im += dotpv2(x1, cs);
+        x0 = x1;
+      }
+
+      acc0Re -= 2 * acc0Cross;
+      acc1Re -= 2 * acc1Cross;
+    }
+    else
+    {
+      for (tapCnt = numTaps >> 1u; tapCnt > 0u; tapCnt--)
+      {
+        /* Two taps b[k], b[k+1] */
+        c = *(shortV *) pb;
+        pb += 2;
+        x1 = *(shortV *) px;
+        x2 = *(shortV *) (px + 2);
+        px += 4;
+
+        acc0Re += dotpv2(shufflev4(x0, x1, even), c);
+        acc0Im += dotpv2(shufflev4(x0, x1, odd), c);
+        acc1Re += dotpv2(shufflev4(x1, x2, even), c);
+        acc1Im += dotpv2(shufflev4(x1, x2, odd), c);
+        x0 = x2;
+      }
+
+      if((numTaps & 0x1u) != 0u)
+      {
+        bRe = *pb;
+        x1 = *(shortV *) px;
+
+        acc0Re += (q31_t) x0[0] * bRe;
+        acc0Im += (q31_t) x0[1] * bRe;
+        acc1Re += (q31_t) x1[0] * bRe;
+        acc1Im += (q31_t) x1[1] * bRe;
+      }
+    }
+
+    *pDst++ = (q15_t) clip(acc0Re >> 15, -32768, 32767);
+    *pDst++ = (q15_t) clip(acc0Im >> 15, -32768, 32767);
+    *pDst++ = (q15_t) clip(acc1Re >> 15, -32768, 32767);
+    *pDst++ = (q15_t) clip(acc1Im >> 15, -32768, 32767);
+
+    /* Advance the state pointer by two complex samples */
+    pState += 4;
+  }
+
+  blkCnt = blockSize & 0x1u;
+#else
+  blkCnt = blockSize;
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* Copy one complex sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    accRe = 0;
+    accIm = 0;
+    px = pState;
+    pb = S->pCoeffs;
+    tapCnt = numTaps;
+
+    if(S->cmplxCoeffs != 0u)
+    {
+      do
+      {
+        /* acc += (xRe + j xIm) * (bRe + j bIm) */
+        xRe = *px++;
+        xIm = *px++;
+        bRe = *pb++;
+        bIm = *pb++;
+        accRe += (xRe * bRe);
+        accRe -= (xIm * bIm);
+        accIm += (xRe * bIm);
+        accIm += (xIm * bRe);
+        tapCnt--;
+      } while(tapCnt > 0u);
+    }
+    else
+    {
+      do
+      {
+        /* acc += (xRe + j xIm) * bRe */
+        bRe = *pb++;
+        accRe += (q31_t) *px++ * bRe;
+        accIm += (q31_t) *px++ * bRe;
+        tapCnt--;
+      } while(tapCnt > 0u);
+    }
+
+    /* The results are in 34.30 format.  Convert to 1.15 with saturation */
+    *pDst++ = (q15_t) __SSAT((accRe >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((accIm >> 15), 16);
+
+    /* Advance the state pointer by one complex sample */
+    pState += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 complex samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+  tapCnt = 2u * (numTaps - 1u);
+
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+}
+
+/**
+ * @} end of CFIR group
+ */
@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cic_decimate_init_q31.c
+*
+* Description:  Initialization function for the Q31 CIC decimator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 CIC decimator.
+ * @param[in,out] *S          points to an instance of the Q31 CIC decimator structure.
+ * @param[in]     numStages   order N of the filter, 1 to RISCV_CIC_MAX_STAGES.
+ * @param[in]     diffDelay   differential delay M of the combs, 1 or 2.
+ * @param[in]     R           decimation factor.
+ * @param[in]     *pState     points to the state buffer of <code>numStages*(1+diffDelay)</code> words.
+ * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if a parameter is out of range or the
+ *                registers would grow by more than 32 bits.
+ */
+
+riscv_status riscv_cic_decimate_init_q31(
+  riscv_cic_decimate_instance_q31 * S,
+  uint8_t numStages,
+  uint8_t diffDelay,
+  uint16_t R,
+  q63_t * pState)
+{
+  RISCV_PROFILE(riscv_cic_decimate_init_q31);
+  uint64_t gain = 1u;
+  uint32_t growth = 0u;
+  uint32_t k;
+
+  if((numStages == 0u) || (numStages > RISCV_CIC_MAX_STAGES) ||
+     (diffDelay == 0u) || (diffDelay > 2u) || (R == 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Gain (R*M)^N, the loop stops once past the limit so that it cannot overflow */
+  for (k = 0u; (k < numStages) && (gain <= ((uint64_t) 1u << 32)); k++)
+  {
+    gain *= (uint64_t) R * diffDelay;
+  }
+
+  /* Bit growth ceil(log2(gain)) */
+  while(((uint64_t) 1u << growth) < gain)
+  {
+    growth++;
+  }
+
+  if(growth > 32)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numStages = numStages;
+  S->diffDelay = diffDelay;
+  S->R = R;
+  S->phase = 0u;
+  S->shift = (uint8_t) growth;
+
+  /* Clear the integrators and the comb delays */
+  memset(pState, 0, numStages * (1u + diffDelay) * sizeof(q63_t));
+
+  S->pState = pState;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of CIC group
+ */
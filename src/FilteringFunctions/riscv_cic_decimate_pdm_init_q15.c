@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cic_decimate_pdm_init_q15.c
+*
+* Description:  Initialization function for the CIC decimator of PDM
+*               bitstreams.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the CIC decimator of PDM bitstreams.
+ * @param[in,out] *S          points to an instance of the PDM CIC decimator structure.
+ * @param[in]     numStages   order N of the filter, 1 to RISCV_CIC_MAX_STAGES.
+ * @param[in]     diffDelay   differential delay M of the combs, 1 or 2.
+ * @param[in]     R           decimation factor in bits, a multiple of 8.
+ * @param[out]    *pLut       points to the tables of <code>256*numStages</code> values the function fills.
+ * @param[in]     *pState     points to the state buffer of <code>numStages*(2+diffDelay)-1</code> words.
+ * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if a parameter is out of range or the
+ *                gain <code>(R*M)^N</code> exceeds 2^31.
+ *
+ * \par
+ * Table <code>j</code> holds, for every byte, the contribution of its bits to the first factor
+ * <code>(1 + z^-1 + ... + z^-7)^N</code> of the filter when the byte is <code>j</code> bytes old.
+ * Instances of the same order can share the tables.
+ */
+
+riscv_status riscv_cic_decimate_pdm_init_q15(
+  riscv_cic_decimate_pdm_instance_q15 * S,
+  uint8_t numStages,
+  uint8_t diffDelay,
+  uint16_t R,
+  uint16_t * pLut,
+  q31_t * pState)
+{
+  RISCV_PROFILE(riscv_cic_decimate_pdm_init_q15);
+  uint16_t coeffs[8u * RISCV_CIC_MAX_STAGES];     /* (1 + ... + z^-7)^N, zero padded */
+  uint64_t gain = 1u;
+  uint32_t growth = 0u;
+  uint32_t i, j, k, b, sum;
+
+  if((numStages == 0u) || (numStages > RISCV_CIC_MAX_STAGES) ||
+     (diffDelay == 0u) || (diffDelay > 2u) || (R == 0u) || ((R & 7u) != 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Gain (R*M)^N, the loop stops once past the limit so that it cannot overflow */
+  for (k = 0u; (k < numStages) && (gain <= ((uint64_t) 1u << 31)); k++)
+  {
+    gain *= (uint64_t) R * diffDelay;
+  }
+
+  /* Bit growth ceil(log2(gain)) */
+  while(((uint64_t) 1u << growth) < gain)
+  {
+    growth++;
+  }
+
+  if(growth > 31u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Coefficients of the first factor by repeated convolution with the boxcar of 8 */
+  memset(coeffs, 0, sizeof(coeffs));
+  coeffs[0] = 1u;
+  for (k = 0u; k < numStages; k++)
+  {
+    for (i = 8u * numStages - 1u; i > 0u; i--)
+    {
+      sum = 0u;
+      for (j = 0u; (j < 8u) && (j <= i); j++)
+      {
+        sum += coeffs[i - j];
+      }
+      coeffs[i] = (uint16_t) sum;
+    }
+  }
+
+  /* Bit 0 of a byte is its latest sample, bit 7 its earliest */
+  for (j = 0u; j < numStages; j++)
+  {
+    for (b = 0u; b < 256u; b++)
+    {
+      sum = 0u;
+      for (i = 0u; i < 8u; i++)
+      {
+        if((b >> i) & 1u)
+        {
+          sum += coeffs[8u * j + i];
+        }
+      }
+      pLut[256u * j + b] = (uint16_t) sum;
+    }
+  }
+
+  S->numStages = numStages;
+  S->diffDelay = diffDelay;
+  S->R = R;
+  S->phase = 0u;
+  S->shift = (uint8_t) growth;
+  S->pLut = pLut;
+
+  /* Clear the integrators, the comb delays and the previous bytes */
+  memset(pState, 0, (numStages * (2u + diffDelay) - 1u) * sizeof(q31_t));
+
+  S->pState = pState;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of CIC group
+ */
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cic_decimate_pdm_q15.c
+*
+* Description:  CIC decimator from a PDM bitstream to Q15 PCM.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the CIC decimator of PDM bitstreams.
+ * @param[in,out] *S          points to an instance of the PDM CIC decimator structure.
+ * @param[in]     *pSrc       points to the bitstream, eight samples per byte with the earliest in bit 7.
+ * @param[out]    *pDst       points to the block of output samples, room for
+ *                            <code>(8*numBytes + R - 1) / R</code> values.
+ * @param[in]     numBytes    number of input bytes to process.
+ * @return        number of output samples written.
+ *
+ * \par
+ * A bit of 1 is the sample +1, a bit of 0 the sample -1.  The filter factors into
+ * <pre>
+ *    H(z) = (1 + z^-1 + ... + z^-7)^N * ((1 - z^(-R*M)) / (1 - z^(-8)))^N
+ * </pre>
+ * The first factor at the byte rate is a sum of <code>N</code> table lookups, one for the byte
+ * and one for each of the <code>N-1</code> bytes before it, with the tables of
+ * riscv_cic_decimate_pdm_init_q15().  The second factor is a CIC filter of the same order
+ * running at the byte rate with the decimation factor <code>R/8</code>, so the integrators run
+ * once per byte instead of once per bit.  The outputs are bit-exact with a CIC decimator of
+ * the bits.
+ * \par
+ * The output is <code>(2*y - G) * 2^15 / 2^B</code> for the filter output <code>y</code> of the
+ * bits taken as 0 and 1, the gain <code>G</code> and the growth <code>B</code>, saturated to Q15.
+ * A DC input of all ones gives 0x7FFF when <code>R*M</code> is a power of two.
+ * After the init the filter holds bits of 0, so the first outputs ramp from -1.0.
+ */
+
+uint32_t riscv_cic_decimate_pdm_q15(
+  riscv_cic_decimate_pdm_instance_q15 * S,
+  const uint8_t * pSrc,
+  q15_t * pDst,
+  uint32_t numBytes)
+{
+  RISCV_PROFILE(riscv_cic_decimate_pdm_q15);
+  uint32_t *pInteg = (uint32_t *) S->pState;      /* Integrators */
+  uint32_t *pComb = pInteg + S->numStages;       /* Comb delays, M per stage */
+  uint32_t *pPrev = pComb + (S->numStages * S->diffDelay);  /* Previous bytes, latest first */
+  const uint16_t *pLut = S->pLut;
+  uint32_t numStages = S->numStages;
+  uint32_t D = (uint32_t) S->R >> 3;             /* Decimation factor at the byte rate */
+  uint32_t phase = S->phase;
+  uint64_t gain = 1u;
+  uint32_t v, y, k, in;
+  int32_t shift = (int32_t) S->shift - 15;
+  q63_t out;
+  uint32_t outCnt = 0u;
+
+  for (k = 0u; k < numStages; k++)
+  {
+    gain *= (uint64_t) S->R * S->diffDelay;
+  }
+
+  while(numBytes > 0u)
+  {
+    /* First factor, the tables of the byte and of the N-1 bytes before it */
+    in = *pSrc++;
+    v = pLut[in];
+    for (k = 1u; k < numStages; k++)
+    {
+      v += pLut[256u * k + pPrev[k - 1u]];
+    }
+
+    for (k = numStages - 1u; k > 1u; k--)
+    {
+      pPrev[k - 1u] = pPrev[k - 2u];
+    }
+    if(numStages > 1u)
+    {
+      pPrev[0] = in;
+    }
+
+    /* Integrators at the byte rate */
+    for (k = 0u; k < numStages; k++)
+    {
+      v += pInteg[k];
+      pInteg[k] = v;
+    }
+
+    if(++phase == D)
+    {
+      phase = 0u;
+
+      /* Combs at the output rate */
+      if(S->diffDelay == 1u)
+      {
+        for (k = 0u; k < numStages; k++)
+        {
+          y = v - pComb[k];
+          pComb[k] = v;
+          v = y;
+        }
+      }
+      else
+      {
+        for (k = 0u; k < numStages; k++)
+        {
+          y = v - pComb[2u * k + 1u];
+          pComb[2u * k + 1u] = pComb[2u * k];
+          pComb[2u * k] = v;
+          v = y;
+        }
+      }
+
+      /* v is 0 to G, map the bits to -1 and +1 and scale to Q15 */
+      out = 2 * (q63_t) v - (q63_t) gain;
+      out = (shift >= 0) ? (out >> shift) : (out * ((q63_t) 1 << -shift));
+      *pDst++ = (q15_t) __SSAT((q31_t) out, 16);
+      outCnt++;
+    }
+
+    /* Decrement the loop counter */
+    numBytes--;
+  }
+
+  S->phase = (uint16_t) phase;
+
+  return (outCnt);
+}
+
+/**
+ * @} end of CIC group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cic_decimate_q15.c
+*
+* Description:  Q15 cascaded integrator-comb decimator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup CIC Cascaded Integrator-Comb Filters
+ *
+ * Multiplierless filters for rate changes by large factors, such as the decimation of the
+ * bitstream of a PDM microphone by 64 or 128.  A CIC filter of order <code>N</code>, rate
+ * change <code>R</code> and differential delay <code>M</code> has the response
+ * <pre>
+ *    H(z) = ((1 - z^(-R*M)) / (1 - z^(-1)))^N
+ * </pre>
+ * built from <code>N</code> integrators at the high rate and <code>N</code> combs
+ * <code>1 - z^(-M)</code> at the low rate.  Only additions are needed, and the cost does not
+ * depend on <code>R</code>, where an FIR decimator needs a number of taps proportional to it.
+ * \par
+ * The droop of the passband and the weak attenuation near the aliased bands are corrected
+ * by a short FIR filter at the low rate, for example a riscv_fir_decimate_q15() by 2.
+ * \par
+ * The gain of the decimator is <code>G = (R*M)^N</code> and the registers grow by
+ * <code>B = ceil(log2(G))</code> bits.  The registers use wrapping two's complement arithmetic,
+ * which gives the exact result as long as the output fits.  The outputs are shifted right by
+ * <code>B</code>, which normalizes the gain to one when <code>R*M</code> is a power of two
+ * and to <code>G/2^B</code> otherwise.  The interpolator has the gain
+ * <code>(R*M)^N/R</code>, normalized the same way.
+ * \par
+ * The Q15 filters run in 32-bit registers and support a growth of 16 bits, the Q31 filters
+ * run in 64-bit registers and support 32 bits, for example <code>N = 4</code> and
+ * <code>R*M = 16</code> in Q15 or <code>R*M = 256</code> in Q31.  The order is 1 to
+ * <code>RISCV_CIC_MAX_STAGES</code>, the differential delay 1 or 2.
+ * \par
+ * riscv_cic_decimate_pdm_q15() takes the 1-bit samples of a PDM bitstream eight per byte and
+ * processes a byte at a time, see there.
+ * \par
+ * The decimators keep the position within the current output period in the instance, so
+ * blocks of any length can be passed and the functions return the number of outputs written.
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 CIC decimator.
+ * @param[in,out] *S          points to an instance of the Q15 CIC decimator structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of output samples, room for
+ *                            <code>(blockSize + R - 1) / R</code> values.
+ * @param[in]     blockSize   number of input samples to process.
+ * @return        number of output samples written.
+ */
+
+uint32_t riscv_cic_decimate_q15(
+  riscv_cic_decimate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cic_decimate_q15);
+  uint32_t *pInteg = (uint32_t *) S->pState;      /* Integrators */
+  uint32_t *pComb = pInteg + S->numStages;       /* Comb delays, M per stage */
+  uint32_t numStages = S->numStages;
+  uint32_t phase = S->phase;
+  uint32_t v, y, k;
+  uint32_t outCnt = 0u;
+
+  while(blockSize > 0u)
+  {
+    /* Integrators at the input rate */
+    v = (uint32_t) (q31_t) *pSrc++;
+    for (k = 0u; k < numStages; k++)
+    {
+      v += pInteg[k];
+      pInteg[k] = v;
+    }
+
+    if(++phase == S->R)
+    {
+      phase = 0u;
+
+      /* Combs at the output rate */
+      if(S->diffDelay == 1u)
+      {
+        for (k = 0u; k < numStages; k++)
+        {
+          y = v - pComb[k];
+          pComb[k] = v;
+          v = y;
+        }
+      }
+      else
+      {
+        for (k = 0u; k < numStages; k++)
+        {
+          y = v - pComb[2u * k + 1u];
+          pComb[2u * k + 1u] = pComb[2u * k];
+          pComb[2u * k] = v;
+          v = y;
+        }
+      }
+
+      *pDst++ = (q15_t) ((q31_t) v >> S->shift);
+      outCnt++;
+    }
+
+    /* Decrement the loop counter */
+    blockSize--;
+  }
+
+  S->phase = (uint16_t) phase;
+
+  return (outCnt);
+}
+
+/**
+ * @} end of CIC group
+ */
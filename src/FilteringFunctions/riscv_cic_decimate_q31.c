@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cic_decimate_q31.c
+*
+* Description:  Q31 cascaded integrator-comb decimator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 CIC decimator.
+ * @param[in,out] *S          points to an instance of the Q31 CIC decimator structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of output samples, room for
+ *                            <code>(blockSize + R - 1) / R</code> values.
+ * @param[in]     blockSize   number of input samples to process.
+ * @return        number of output samples written.
+ */
+
+uint32_t riscv_cic_decimate_q31(
+  riscv_cic_decimate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cic_decimate_q31);
+  uint64_t *pInteg = (uint64_t *) S->pState;      /* Integrators */
+  uint64_t *pComb = pInteg + S->numStages;       /* Comb delays, M per stage */
+  uint32_t numStages = S->numStages;
+  uint32_t phase = S->phase;
+  uint64_t v, y;
+  uint32_t k;
+  uint32_t outCnt = 0u;
+
+  while(blockSize > 0u)
+  {
+    /* Integrators at the input rate */
+    v = (uint64_t) (q63_t) *pSrc++;
+    for (k = 0u; k < numStages; k++)
+    {
+      v += pInteg[k];
+      pInteg[k] = v;
+    }
+
+    if(++phase == S->R)
+    {
+      phase = 0u;
+
+      /* Combs at the output rate */
+      if(S->diffDelay == 1u)
+      {
+        for (k = 0u; k < numStages; k++)
+        {
+          y = v - pComb[k];
+          pComb[k] = v;
+          v = y;
+        }
+      }
+      else
+      {
+        for (k = 0u; k < numStages; k++)
+        {
+          y = v - pComb[2u * k + 1u];
+          pComb[2u * k + 1u] = pComb[2u * k];
+          pComb[2u * k] = v;
+          v = y;
+        }
+      }
+
+      *pDst++ = (q31_t) ((q63_t) v >> S->shift);
+      outCnt++;
+    }
+
+    /* Decrement the loop counter */
+    blockSize--;
+  }
+
+  S->phase = (uint16_t) phase;
+
+  return (outCnt);
+}
+
+/**
+ * @} end of CIC group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cic_interpolate_q15.c
+*
+* Description:  Q15 cascaded integrator-comb interpolator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 CIC interpolator.
+ * @param[in]     *S          points to an instance of the Q15 CIC interpolator structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of <code>blockSize*R</code> output samples.
+ * @param[in]     blockSize   number of input samples to process.
+ *
+ * \par
+ * The combs run once per input, the integrators R times on the input followed by R-1 zeros.
+ */
+
+void riscv_cic_interpolate_q15(
+  const riscv_cic_interpolate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cic_interpolate_q15);
+  uint32_t *pComb = (uint32_t *) S->pState;                  /* Comb delays, M per stage */
+  uint32_t *pInteg = pComb + (S->numStages * S->diffDelay);  /* Integrators */
+  uint32_t numStages = S->numStages;
+  uint32_t v, y;
+  uint32_t k, r;
+
+  while(blockSize > 0u)
+  {
+    /* Combs at the input rate */
+    v = (uint32_t) (q31_t) *pSrc++;
+    if(S->diffDelay == 1u)
+    {
+      for (k = 0u; k < numStages; k++)
+      {
+        y = v - pComb[k];
+        pComb[k] = v;
+        v = y;
+      }
+    }
+    else
+    {
+      for (k = 0u; k < numStages; k++)
+      {
+        y = v - pComb[2u * k + 1u];
+        pComb[2u * k + 1u] = pComb[2u * k];
+        pComb[2u * k] = v;
+        v = y;
+      }
+    }
+
+    /* Integrators at the output rate, fed with the comb output and R-1 zeros */
+    for (r = 0u; r < S->R; r++)
+    {
+      for (k = 0u; k < numStages; k++)
+      {
+        v += pInteg[k];
+        pInteg[k] = v;
+      }
+
+      *pDst++ = (q15_t) ((q31_t) v >> S->shift);
+
+      /* Zero input for the remaining R-1 outputs */
+      v = 0u;
+    }
+
+    /* Decrement the loop counter */
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of CIC group
+ */
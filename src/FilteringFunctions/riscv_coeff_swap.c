@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_coeff_swap.c
+*
+* Description:  Double-buffered coefficient banks that filters take over
+*               at a block boundary, with an optional crossfade.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup CoeffSwap Coefficient Hot-Swap
+ *
+ * Running the init function of a filter again to change its response clears the state and clicks, and
+ * pointing <code>pCoeffs</code> at a new array while the filter runs in another context races with it.
+ * A coefficient swap instance holds two banks of coefficients instead: the filter runs one, the control
+ * code writes the other and publishes it, and the filter takes it over at the start of its next block
+ * without touching its state.
+ *
+ * \par
+ * The control side calls riscv_coeff_swap_edit() to get the bank it may write, fills it and calls
+ * riscv_coeff_swap_publish().  riscv_coeff_swap_edit() returns NULL while a published bank has not been
+ * taken yet or the previous bank is still in use by a crossfade.  The filter side calls the swap variant
+ * of its processing function, riscv_fir_swap_f32(), riscv_fir_swap_q15() or
+ * riscv_biquad_cascade_df2T_swap_f32(), which costs one branch per block while nothing is pending.
+ *
+ * \par Crossfade
+ * With a nonzero <code>fadeLength</code> the outgoing filter keeps running on a copy of the state for
+ * <code>fadeLength</code> samples after a swap, and the output fades linearly from its output to the output
+ * of the incoming filter.  For FIR filters this is the same as interpolating the coefficients sample by
+ * sample, for recursive filters it also hides the transient of the new coefficients acting on the old
+ * state.  The fade needs a state buffer and a scratch buffer of <code>blockSize</code> outputs, the sizes
+ * are those of the filter it belongs to.
+ *
+ * \par
+ * Each field of the instance is written by one side only, so the control code may run in an interrupt
+ * handler, on another core or in the main loop while the filter runs in an interrupt handler.
+ */
+
+/**
+ * @addtogroup CoeffSwap
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the coefficient swap.
+ * @param[out] *S           points to an instance of the coefficient swap structure.
+ * @param[in]  *pBankA      points to the coefficients the filter was initialized with.
+ * @param[in]  *pBankB      points to the second bank, of the same size.
+ * @param[in]  fadeLength   number of samples of the crossfade after a swap, 0 to switch at the block boundary.
+ * @param[in]  *pFadeState  points to the state buffer of the outgoing filter, the size of the filter state.
+ * @param[in]  *pFadeOut    points to the scratch buffer of <code>blockSize</code> outputs of the outgoing filter.
+ * @return none.
+ *
+ * \par
+ * The crossfade is disabled if <code>pFadeState</code> or <code>pFadeOut</code> is NULL.
+ */
+
+void riscv_coeff_swap_init(
+  riscv_coeff_swap_instance * S,
+  void * pBankA,
+  void * pBankB,
+  uint16_t fadeLength,
+  void * pFadeState,
+  void * pFadeOut)
+{
+  RISCV_PROFILE(riscv_coeff_swap_init);
+
+  S->pBank[0] = pBankA;
+  S->pBank[1] = pBankB;
+  S->pFadeState = pFadeState;
+  S->pFadeOut = pFadeOut;
+  S->fadeLength = ((pFadeState == NULL) || (pFadeOut == NULL)) ? 0u : fadeLength;
+  S->fadeCount = 0u;
+  S->active = 0u;
+  S->pending = 0u;
+}
+
+/**
+ * @brief  Bank the control side may write.
+ * @param[in]  *S  points to an instance of the coefficient swap structure.
+ * @return     points to the bank the filter does not use, or NULL while a swap is pending or a crossfade runs.
+ */
+
+void * riscv_coeff_swap_edit(
+  const riscv_coeff_swap_instance * S)
+{
+  if((S->pending | S->fadeCount) != 0u)
+  {
+    return (NULL);
+  }
+
+  return (S->pBank[S->active ^ 1u]);
+}
+
+/**
+ * @brief  Hands the bank returned by riscv_coeff_swap_edit() to the filter.
+ * @param[in,out] *S  points to an instance of the coefficient swap structure.
+ * @return none.
+ *
+ * \par
+ * The fence orders the writes of the coefficients before the flag, also for a filter on another core.
+ */
+
+void riscv_coeff_swap_publish(
+  riscv_coeff_swap_instance * S)
+{
+  __sync_synchronize();
+  S->pending = 1u;
+}
+
+/**
+ * @brief  Takes over the published bank, called by the filter side at the start of a block.
+ * @param[in,out] *S  points to an instance of the coefficient swap structure.
+ * @return     points to the bank the filter runs from now on.
+ *
+ * \par
+ * Starts the crossfade, the outgoing bank is <code>S->pBank[S->active ^ 1]</code> until it ends.
+ */
+
+void * riscv_coeff_swap_take(
+  riscv_coeff_swap_instance * S)
+{
+  __sync_synchronize();
+  S->active ^= 1u;
+  S->fadeCount = S->fadeLength;
+  S->pending = 0u;
+
+  return (S->pBank[S->active]);
+}
+
+/**
+ * @} end of CoeffSwap group
+ */
@@ -0,0 +1,328 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_conv2d_f32.c
+*
+* Description:  Floating-point 2D convolution and correlation of small images.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Conv2D 2D Convolution and Correlation
+ *
+ * These functions filter an image of <code>srcRows</code> x <code>srcCols</code> samples with a kernel of
+ * <code>kRows</code> x <code>kCols</code> samples, both stored row by row, for example for edge detection or
+ * template matching on camera frames.  Only the outputs where the kernel lies completely inside the image are
+ * computed, so the output image has <code>(srcRows-kRows+1)</code> x <code>(srcCols-kCols+1)</code> samples.
+ * The correlation is
+ * <pre>
+ *    y[r][c] = sum_i sum_j  h[i][j] * x[r+i][c+j],     i = 0..kRows-1,  j = 0..kCols-1
+ * </pre>
+ * and the convolution is the correlation with the kernel rotated by 180 degrees,
+ * <code>h[kRows-1-i][kCols-1-j]</code>.  The convolution functions rotate the kernel into a local buffer of
+ * RISCV_CONV2D_MAX_KERNEL samples, larger kernels can use the correlation functions with a rotated copy.
+ * \par
+ * 3x3 and 5x5 kernels have dedicated code that keeps the whole kernel in registers and computes two output
+ * rows at a time, so that every input row loaded in the middle of the window serves both rows.  In the
+ * USE_DSP_RISCV build the Q7 version uses sumdotpv4 on four samples of a row and the Q15 version dotpv2 on
+ * two samples.  The working set of a pair of output rows is <code>kRows+1</code> input rows, a few hundred
+ * bytes for a 96 pixels wide frame.  Other kernel sizes use one output at a time with the same SIMD
+ * instructions on the kernel rows.
+ * \par
+ * Calling riscv_conv_q15() on every row instead spends most of the work on the ramp phases of the short
+ * kernel rows and needs an extra pass to add the row results.
+ */
+
+/**
+ * @addtogroup Conv2D
+ * @{
+ */
+
+/*
+* @brief  Computes one output of the 2D correlation.
+* @param[in]  *px      points to the top left input sample of the window.
+* @param[in]  srcCols  number of columns of the image.
+* @param[in]  *pk      points to the kernel.
+* @param[in]  kRows    number of rows of the kernel.
+* @param[in]  kCols    number of columns of the kernel.
+* @return     output sample.
+*/
+
+static float32_t riscv_correlate2d_1_f32(
+  const float32_t * px,
+  uint32_t srcCols,
+  const float32_t * pk,
+  uint32_t kRows,
+  uint32_t kCols)
+{
+  float32_t sum = 0.0f;                          /* Accumulator */
+  uint32_t i, j;                                 /* Loop counters */
+
+  for (i = 0u; i < kRows; i++)
+  {
+    for (j = 0u; j < kCols; j++)
+    {
+      sum += px[j] * pk[j];
+    }
+
+    px += srcCols;
+    pk += kCols;
+  }
+
+  return (sum);
+}
+
+/*
+* @brief  3x3 correlation of pairs of output rows.
+* @param[in]  *pSrc    points to the image.
+* @param[in]  srcCols  number of columns of the image.
+* @param[in]  *pk      points to the 3x3 kernel.
+* @param[out] *pDst    points to the output image.
+* @param[in]  outRows  number of output rows.
+* @param[in]  outCols  number of output columns.
+* @return     number of output rows computed, outRows rounded down to an even value.
+*
+* The window slides along the four input rows of a pair, every output column loads one new column of four
+* samples.
+*/
+
+static uint32_t riscv_correlate2d_3x3_f32(
+  const float32_t * pSrc,
+  uint32_t srcCols,
+  const float32_t * pk,
+  float32_t * pDst,
+  uint32_t outRows,
+  uint32_t outCols)
+{
+  const float32_t *px;                           /* Input column pointer */
+  float32_t *pOut;                               /* Output pointer */
+  float32_t k00 = pk[0], k01 = pk[1], k02 = pk[2];  /* Kernel */
+  float32_t k10 = pk[3], k11 = pk[4], k12 = pk[5];
+  float32_t k20 = pk[6], k21 = pk[7], k22 = pk[8];
+  float32_t a0, a1, a2, a3;                      /* Column c of the input rows */
+  float32_t b0, b1, b2, b3;                      /* Column c + 1 of the input rows */
+  float32_t d0, d1, d2, d3;                      /* Column c + 2 of the input rows */
+  uint32_t r, c;                                 /* Loop counters */
+
+  for (r = 0u; (r + 2u) <= outRows; r += 2u)
+  {
+    px = pSrc + (r * srcCols);
+    pOut = pDst + (r * outCols);
+
+    a0 = px[0];
+    a1 = px[srcCols];
+    a2 = px[2u * srcCols];
+    a3 = px[3u * srcCols];
+    b0 = px[1];
+    b1 = px[srcCols + 1u];
+    b2 = px[(2u * srcCols) + 1u];
+    b3 = px[(3u * srcCols) + 1u];
+    px += 2;
+
+    for (c = 0u; c < outCols; c++)
+    {
+      d0 = px[0];
+      d1 = px[srcCols];
+      d2 = px[2u * srcCols];
+      d3 = px[3u * srcCols];
+      px++;
+
+      pOut[c] = (a0 * k00) + (b0 * k01) + (d0 * k02) +
+                (a1 * k10) + (b1 * k11) + (d1 * k12) +
+                (a2 * k20) + (b2 * k21) + (d2 * k22);
+      pOut[outCols + c] = (a1 * k00) + (b1 * k01) + (d1 * k02) +
+                          (a2 * k10) + (b2 * k11) + (d2 * k12) +
+                          (a3 * k20) + (b3 * k21) + (d3 * k22);
+
+      a0 = b0;
+      a1 = b1;
+      a2 = b2;
+      a3 = b3;
+      b0 = d0;
+      b1 = d1;
+      b2 = d2;
+      b3 = d3;
+    }
+  }
+
+  return (r);
+}
+
+/*
+* @brief  5x5 correlation of pairs of output rows.
+* @param[in]  *pSrc    points to the image.
+* @param[in]  srcCols  number of columns of the image.
+* @param[in]  *pk      points to the 5x5 kernel.
+* @param[out] *pDst    points to the output image.
+* @param[in]  outRows  number of output rows.
+* @param[in]  outCols  number of output columns.
+* @return     number of output rows computed, outRows rounded down to an even value.
+*
+* The two output rows of a pair share the loads of the four input rows in the middle.
+*/
+
+static uint32_t riscv_correlate2d_5x5_f32(
+  const float32_t * pSrc,
+  uint32_t srcCols,
+  const float32_t * pk,
+  float32_t * pDst,
+  uint32_t outRows,
+  uint32_t outCols)
+{
+  const float32_t *px;                           /* Top left input sample of the window */
+  const float32_t *pb;                           /* Kernel row pointer */
+  float32_t *pOut;                               /* Output pointer */
+  float32_t x0, x1, x2, x3, x4;                  /* Input samples */
+  float32_t acc0, acc1;                          /* Accumulators */
+  uint32_t r, c, i;                              /* Loop counters */
+
+  for (r = 0u; (r + 2u) <= outRows; r += 2u)
+  {
+    pOut = pDst + (r * outCols);
+
+    for (c = 0u; c < outCols; c++)
+    {
+      px = pSrc + (r * srcCols) + c;
+      pb = pk;
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+
+      /* Input row i feeds kernel row i of the first output and row i - 1 of the second */
+      for (i = 0u; i < 6u; i++)
+      {
+        x0 = px[0];
+        x1 = px[1];
+        x2 = px[2];
+        x3 = px[3];
+        x4 = px[4];
+        px += srcCols;
+
+        if(i > 0u)
+        {
+          acc1 += (x0 * pb[-5]) + (x1 * pb[-4]) + (x2 * pb[-3]) + (x3 * pb[-2]) + (x4 * pb[-1]);
+        }
+
+        if(i < 5u)
+        {
+          acc0 += (x0 * pb[0]) + (x1 * pb[1]) + (x2 * pb[2]) + (x3 * pb[3]) + (x4 * pb[4]);
+        }
+
+        pb += 5;
+      }
+
+      pOut[c] = acc0;
+      pOut[outCols + c] = acc1;
+    }
+  }
+
+  return (r);
+}
+
+/**
+ * @brief 2D correlation of a floating-point image with a floating-point kernel.
+ * @param[in]  *pSrc     points to the image, stored row by row.
+ * @param[in]  srcRows   number of rows of the image.
+ * @param[in]  srcCols   number of columns of the image.
+ * @param[in]  *pKernel  points to the kernel, stored row by row.
+ * @param[in]  kRows     number of rows of the kernel.
+ * @param[in]  kCols     number of columns of the kernel.
+ * @param[out] *pDst     points to the output image of <code>(srcRows-kRows+1)*(srcCols-kCols+1)</code> words.
+ * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the kernel is empty or larger than the image.
+
+ */
+
+riscv_status riscv_correlate2d_f32(
+  float32_t * pSrc,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  float32_t * pKernel,
+  uint16_t kRows,
+  uint16_t kCols,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_correlate2d_f32);
+  uint32_t outRows, outCols;                     /* Size of the output image */
+  uint32_t r = 0u, c;                            /* Loop counters */
+
+  if((kRows == 0u) || (kCols == 0u) || (kRows > srcRows) || (kCols > srcCols))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  outRows = (uint32_t) (srcRows - kRows) + 1u;
+  outCols = (uint32_t) (srcCols - kCols) + 1u;
+
+  if((kRows == 3u) && (kCols == 3u))
+  {
+    r = riscv_correlate2d_3x3_f32(pSrc, srcCols, pKernel, pDst, outRows, outCols);
+  }
+  else if((kRows == 5u) && (kCols == 5u))
+  {
+    r = riscv_correlate2d_5x5_f32(pSrc, srcCols, pKernel, pDst, outRows, outCols);
+  }
+
+  /* Other kernel sizes and the last row of an odd number of output rows */
+  for (; r < outRows; r++)
+  {
+    for (c = 0u; c < outCols; c++)
+    {
+      pDst[(r * outCols) + c] = riscv_correlate2d_1_f32(pSrc + (r * srcCols) + c, srcCols, pKernel, kRows, kCols);
+    }
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief 2D convolution of a floating-point image with a floating-point kernel.
+ * @param[in]  *pSrc     points to the image, stored row by row.
+ * @param[in]  srcRows   number of rows of the image.
+ * @param[in]  srcCols   number of columns of the image.
+ * @param[in]  *pKernel  points to the kernel, stored row by row.
+ * @param[in]  kRows     number of rows of the kernel.
+ * @param[in]  kCols     number of columns of the kernel.
+ * @param[out] *pDst     points to the output image of <code>(srcRows-kRows+1)*(srcCols-kCols+1)</code> words.
+ * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the kernel is empty, larger than the image or
+ * has more than RISCV_CONV2D_MAX_KERNEL samples.
+ *
+ * \par
+ * The function rotates the kernel by 180 degrees and calls riscv_correlate2d_f32().
+ */
+
+riscv_status riscv_conv2d_f32(
+  float32_t * pSrc,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  float32_t * pKernel,
+  uint16_t kRows,
+  uint16_t kCols,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_conv2d_f32);
+  float32_t kernel[RISCV_CONV2D_MAX_KERNEL];     /* Rotated kernel */
+  uint32_t numK = (uint32_t) kRows * kCols;      /* Number of kernel samples */
+  uint32_t n;                                    /* Loop counter */
+
+  if(numK > RISCV_CONV2D_MAX_KERNEL)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Reversing the row by row array flips both the rows and the columns */
+  for (n = 0u; n < numK; n++)
+  {
+    kernel[n] = pKernel[(numK - 1u) - n];
+  }
+
+  return (riscv_correlate2d_f32(pSrc, srcRows, srcCols, kernel, kRows, kCols, pDst));
+}
+
+/**
+ * @} end of Conv2D group
+ */
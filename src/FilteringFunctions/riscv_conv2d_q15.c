@@ -0,0 +1,322 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_conv2d_q15.c
+*
+* Description:  Q15 2D convolution and correlation of small images.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv2D
+ * @{
+ */
+
+/*
+* @brief  Computes one output of the 2D correlation.
+* @param[in]  *px      points to the top left input sample of the window.
+* @param[in]  srcCols  number of columns of the image.
+* @param[in]  *pk      points to the kernel.
+* @param[in]  kRows    number of rows of the kernel.
+* @param[in]  kCols    number of columns of the kernel.
+* @return     output sample.
+*/
+
+static q15_t riscv_correlate2d_1_q15(
+  const q15_t * px,
+  uint32_t srcCols,
+  const q15_t * pk,
+  uint32_t kRows,
+  uint32_t kCols)
+{
+  q63_t sum = 0;                                 /* Accumulator */
+  uint32_t i, j;                                 /* Loop counters */
+
+  for (i = 0u; i < kRows; i++)
+  {
+    j = 0u;
+
+#if defined (USE_DSP_RISCV)
+
+    /* Two samples of the kernel row at a time */
+    for (; (j + 2u) <= kCols; j += 2u)
+    {
+      sum += dotpv2(*(shortV *) (px + j), *(shortV *) (pk + j));
+    }
+
+#endif
+
+    for (; j < kCols; j++)
+    {
+      sum += (q31_t) px[j] * pk[j];
+    }
+
+    px += srcCols;
+    pk += kCols;
+  }
+
+  /* The result is in 34.30 format.  Convert to 1.15 with saturation. */
+  return ((q15_t) __SSAT(sum >> 15u, 16u));
+}
+
+#if defined (USE_DSP_RISCV)
+
+/*
+* @brief  3x3 correlation of pairs of output rows.
+* @param[in]  *pSrc    points to the image.
+* @param[in]  srcCols  number of columns of the image.
+* @param[in]  *pk      points to the 3x3 kernel.
+* @param[out] *pDst    points to the output image.
+* @param[in]  outRows  number of output rows.
+* @param[in]  outCols  number of output columns.
+* @return     number of output rows computed, outRows rounded down to an even value.
+*
+* Every kernel row is split into one dotpv2 and one multiply-accumulate.  The two output rows of a pair
+* share the loads of the two input rows in the middle.
+*/
+
+static uint32_t riscv_correlate2d_3x3_q15(
+  const q15_t * pSrc,
+  uint32_t srcCols,
+  const q15_t * pk,
+  q15_t * pDst,
+  uint32_t outRows,
+  uint32_t outCols)
+{
+  const q15_t *px;                               /* Top left input sample of the window */
+  q15_t *pOut;                                   /* Output pointer */
+  shortV k0, k1, k2;                             /* First two samples of the kernel rows */
+  q31_t k02 = pk[2], k12 = pk[5], k22 = pk[8];   /* Last sample of the kernel rows */
+  shortV x0, x1, x2, x3;                         /* Input samples */
+  q31_t x02, x12, x22, x32;                      /* Input samples */
+  q63_t acc0, acc1;                              /* Accumulators */
+  uint32_t r, c;                                 /* Loop counters */
+
+  k0 = pack2(pk[0], pk[1]);
+  k1 = pack2(pk[3], pk[4]);
+  k2 = pack2(pk[6], pk[7]);
+
+  for (r = 0u; (r + 2u) <= outRows; r += 2u)
+  {
+    pOut = pDst + (r * outCols);
+
+    for (c = 0u; c < outCols; c++)
+    {
+      px = pSrc + (r * srcCols) + c;
+
+      x0 = *(shortV *) px;
+      x02 = px[2];
+      x1 = *(shortV *) (px + srcCols);
+      x12 = px[srcCols + 2u];
+      x2 = *(shortV *) (px + (2u * srcCols));
+      x22 = px[(2u * srcCols) + 2u];
+      x3 = *(shortV *) (px + (3u * srcCols));
+      x32 = px[(3u * srcCols) + 2u];
+
+      acc0 = (q63_t) dotpv2(x0, k0) + dotpv2(x1, k1) + dotpv2(x2, k2);
+      acc1 = (q63_t) dotpv2(x1, k0) + dotpv2(x2, k1) + dotpv2(x3, k2);
+      acc0 += (x02 * k02) + (q63_t) (x12 * k12) + (x22 * k22);
+      acc1 += (x12 * k02) + (q63_t) (x22 * k12) + (x32 * k22);
+
+      pOut[c] = (q15_t) __SSAT(acc0 >> 15u, 16u);
+      pOut[outCols + c] = (q15_t) __SSAT(acc1 >> 15u, 16u);
+    }
+  }
+
+  return (r);
+}
+
+/*
+* @brief  5x5 correlation of pairs of output rows.
+* @param[in]  *pSrc    points to the image.
+* @param[in]  srcCols  number of columns of the image.
+* @param[in]  *pk      points to the 5x5 kernel.
+* @param[out] *pDst    points to the output image.
+* @param[in]  outRows  number of output rows.
+* @param[in]  outCols  number of output columns.
+* @return     number of output rows computed, outRows rounded down to an even value.
+*
+* Every kernel row is split into two dotpv2 and one multiply-accumulate.  The two output rows of a pair
+* share the loads of the four input rows in the middle.
+*/
+
+static uint32_t riscv_correlate2d_5x5_q15(
+  const q15_t * pSrc,
+  uint32_t srcCols,
+  const q15_t * pk,
+  q15_t * pDst,
+  uint32_t outRows,
+  uint32_t outCols)
+{
+  const q15_t *px;                               /* Top left input sample of the window */
+  q15_t *pOut;                                   /* Output pointer */
+  shortV ka[5], kb[5];                           /* Samples 0, 1 and 2, 3 of the kernel rows */
+  q31_t k4[5];                                   /* Last sample of the kernel rows */
+  shortV xa, xb;                                 /* Input samples */
+  q31_t x4;                                      /* Input sample */
+  q63_t acc0, acc1;                              /* Accumulators */
+  uint32_t r, c, i;                              /* Loop counters */
+
+  for (i = 0u; i < 5u; i++)
+  {
+    ka[i] = pack2(pk[5u * i], pk[(5u * i) + 1u]);
+    kb[i] = pack2(pk[(5u * i) + 2u], pk[(5u * i) + 3u]);
+    k4[i] = pk[(5u * i) + 4u];
+  }
+
+  for (r = 0u; (r + 2u) <= outRows; r += 2u)
+  {
+    pOut = pDst + (r * outCols);
+
+    for (c = 0u; c < outCols; c++)
+    {
+      px = pSrc + (r * srcCols) + c;
+
+      /* Input row 0 only feeds the first output, input row 5 only the second */
+      acc0 = (q63_t) dotpv2(*(shortV *) px, ka[0]) + dotpv2(*(shortV *) (px + 2), kb[0]);
+      acc0 += (q31_t) px[4] * k4[0];
+      acc1 = 0;
+
+      for (i = 1u; i < 5u; i++)
+      {
+        px += srcCols;
+        xa = *(shortV *) px;
+        xb = *(shortV *) (px + 2);
+        x4 = px[4];
+        acc0 += (q63_t) dotpv2(xa, ka[i]) + dotpv2(xb, kb[i]) + (x4 * k4[i]);
+        acc1 += (q63_t) dotpv2(xa, ka[i - 1u]) + dotpv2(xb, kb[i - 1u]) + (x4 * k4[i - 1u]);
+      }
+
+      px += srcCols;
+      acc1 += (q63_t) dotpv2(*(shortV *) px, ka[4]) + dotpv2(*(shortV *) (px + 2), kb[4]);
+      acc1 += (q31_t) px[4] * k4[4];
+
+      pOut[c] = (q15_t) __SSAT(acc0 >> 15u, 16u);
+      pOut[outCols + c] = (q15_t) __SSAT(acc1 >> 15u, 16u);
+    }
+  }
+
+  return (r);
+}
+
+#endif /* #if defined (USE_DSP_RISCV) */
+
+/**
+ * @brief 2D correlation of a Q15 image with a Q15 kernel.
+ * @param[in]  *pSrc     points to the image, stored row by row.
+ * @param[in]  srcRows   number of rows of the image.
+ * @param[in]  srcCols   number of columns of the image.
+ * @param[in]  *pKernel  points to the kernel, stored row by row.
+ * @param[in]  kRows     number of rows of the kernel.
+ * @param[in]  kCols     number of columns of the kernel.
+ * @param[out] *pDst     points to the output image of <code>(srcRows-kRows+1)*(srcCols-kCols+1)</code> samples.
+ * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the kernel is empty or larger than the image.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * Both inputs are in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * There is no risk of internal overflow with this approach.  The accumulator is truncated to 34.15 format
+ * by discarding the low 15 bits and then saturated to 1.15 format.
+ */
+
+riscv_status riscv_correlate2d_q15(
+  q15_t * pSrc,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  q15_t * pKernel,
+  uint16_t kRows,
+  uint16_t kCols,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_correlate2d_q15);
+  uint32_t outRows, outCols;                     /* Size of the output image */
+  uint32_t r = 0u, c;                            /* Loop counters */
+
+  if((kRows == 0u) || (kCols == 0u) || (kRows > srcRows) || (kCols > srcCols))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  outRows = (uint32_t) (srcRows - kRows) + 1u;
+  outCols = (uint32_t) (srcCols - kCols) + 1u;
+
+#if defined (USE_DSP_RISCV)
+
+  if((kRows == 3u) && (kCols == 3u))
+  {
+    r = riscv_correlate2d_3x3_q15(pSrc, srcCols, pKernel, pDst, outRows, outCols);
+  }
+  else if((kRows == 5u) && (kCols == 5u))
+  {
+    r = riscv_correlate2d_5x5_q15(pSrc, srcCols, pKernel, pDst, outRows, outCols);
+  }
+
+#endif
+
+  /* Other kernel sizes and the last row of an odd number of output rows */
+  for (; r < outRows; r++)
+  {
+    for (c = 0u; c < outCols; c++)
+    {
+      pDst[(r * outCols) + c] = riscv_correlate2d_1_q15(pSrc + (r * srcCols) + c, srcCols, pKernel, kRows, kCols);
+    }
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief 2D convolution of a Q15 image with a Q15 kernel.
+ * @param[in]  *pSrc     points to the image, stored row by row.
+ * @param[in]  srcRows   number of rows of the image.
+ * @param[in]  srcCols   number of columns of the image.
+ * @param[in]  *pKernel  points to the kernel, stored row by row.
+ * @param[in]  kRows     number of rows of the kernel.
+ * @param[in]  kCols     number of columns of the kernel.
+ * @param[out] *pDst     points to the output image of <code>(srcRows-kRows+1)*(srcCols-kCols+1)</code> samples.
+ * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the kernel is empty, larger than the image or
+ * has more than RISCV_CONV2D_MAX_KERNEL samples.
+ *
+ * \par
+ * The function rotates the kernel by 180 degrees and calls riscv_correlate2d_q15(), with the same scaling.
+ */
+
+riscv_status riscv_conv2d_q15(
+  q15_t * pSrc,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  q15_t * pKernel,
+  uint16_t kRows,
+  uint16_t kCols,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_conv2d_q15);
+  q15_t kernel[RISCV_CONV2D_MAX_KERNEL];         /* Rotated kernel */
+  uint32_t numK = (uint32_t) kRows * kCols;      /* Number of kernel samples */
+  uint32_t n;                                    /* Loop counter */
+
+  if(numK > RISCV_CONV2D_MAX_KERNEL)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Reversing the row by row array flips both the rows and the columns */
+  for (n = 0u; n < numK; n++)
+  {
+    kernel[n] = pKernel[(numK - 1u) - n];
+  }
+
+  return (riscv_correlate2d_q15(pSrc, srcRows, srcCols, kernel, kRows, kCols, pDst));
+}
+
+/**
+ * @} end of Conv2D group
+ */
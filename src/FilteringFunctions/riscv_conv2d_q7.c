@@ -0,0 +1,322 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_conv2d_q7.c
+*
+* Description:  Q7 2D convolution and correlation of small images.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv2D
+ * @{
+ */
+
+/*
+* @brief  Computes one output of the 2D correlation.
+* @param[in]  *px      points to the top left input sample of the window.
+* @param[in]  srcCols  number of columns of the image.
+* @param[in]  *pk      points to the kernel.
+* @param[in]  kRows    number of rows of the kernel.
+* @param[in]  kCols    number of columns of the kernel.
+* @return     output sample.
+*/
+
+static q7_t riscv_correlate2d_1_q7(
+  const q7_t * px,
+  uint32_t srcCols,
+  const q7_t * pk,
+  uint32_t kRows,
+  uint32_t kCols)
+{
+  q31_t sum = 0;                                 /* Accumulator */
+  uint32_t i, j;                                 /* Loop counters */
+
+  for (i = 0u; i < kRows; i++)
+  {
+    j = 0u;
+
+#if defined (USE_DSP_RISCV)
+
+    /* Four samples of the kernel row at a time */
+    for (; (j + 4u) <= kCols; j += 4u)
+    {
+      sum = sumdotpv4(*(charV *) (px + j), *(charV *) (pk + j), sum);
+    }
+
+#endif
+
+    for (; j < kCols; j++)
+    {
+      sum += (q15_t) px[j] * pk[j];
+    }
+
+    px += srcCols;
+    pk += kCols;
+  }
+
+  /* The result is in 2.14 format.  Convert to 1.7 with saturation. */
+  return ((q7_t) __SSAT(sum >> 7u, 8u));
+}
+
+#if defined (USE_DSP_RISCV)
+
+/*
+* @brief  3x3 correlation of pairs of output rows.
+* @param[in]  *pSrc    points to the image.
+* @param[in]  srcCols  number of columns of the image.
+* @param[in]  *pk      points to the 3x3 kernel.
+* @param[out] *pDst    points to the output image.
+* @param[in]  outRows  number of output rows.
+* @param[in]  outCols  number of output columns.
+* @return     number of output rows computed, outRows rounded down to an even value.
+*
+* Every kernel row is padded to four samples with a zero so that one sumdotpv4 covers it.  The two output
+* rows of a pair share the loads of the three input rows in the middle.
+*/
+
+static uint32_t riscv_correlate2d_3x3_q7(
+  const q7_t * pSrc,
+  uint32_t srcCols,
+  const q7_t * pk,
+  q7_t * pDst,
+  uint32_t outRows,
+  uint32_t outCols)
+{
+  const q7_t *px;                                /* Top left input sample of the window */
+  q7_t *pOut;                                    /* Output pointer */
+  charV k0, k1, k2;                              /* Kernel rows */
+  charV x0, x1, x2, x3;                          /* Input rows */
+  q31_t acc0, acc1;                              /* Accumulators */
+  uint32_t r, c;                                 /* Loop counters */
+
+  k0 = pack4(pk[0], pk[1], pk[2], 0);
+  k1 = pack4(pk[3], pk[4], pk[5], 0);
+  k2 = pack4(pk[6], pk[7], pk[8], 0);
+
+  for (r = 0u; (r + 2u) <= outRows; r += 2u)
+  {
+    px = pSrc + (r * srcCols);
+    pOut = pDst + (r * outCols);
+
+    /* The loads of four samples stay in the image up to the last but one column */
+    for (c = 0u; c < (outCols - 1u); c++)
+    {
+      x0 = *(charV *) (px + c);
+      x1 = *(charV *) (px + srcCols + c);
+      x2 = *(charV *) (px + (2u * srcCols) + c);
+      x3 = *(charV *) (px + (3u * srcCols) + c);
+
+      acc0 = dotpv4(x0, k0);
+      acc1 = dotpv4(x1, k0);
+      acc0 = sumdotpv4(x1, k1, acc0);
+      acc1 = sumdotpv4(x2, k1, acc1);
+      acc0 = sumdotpv4(x2, k2, acc0);
+      acc1 = sumdotpv4(x3, k2, acc1);
+
+      pOut[c] = (q7_t) __SSAT(acc0 >> 7u, 8u);
+      pOut[outCols + c] = (q7_t) __SSAT(acc1 >> 7u, 8u);
+    }
+
+    pOut[c] = riscv_correlate2d_1_q7(px + c, srcCols, pk, 3u, 3u);
+    pOut[outCols + c] = riscv_correlate2d_1_q7(px + srcCols + c, srcCols, pk, 3u, 3u);
+  }
+
+  return (r);
+}
+
+/*
+* @brief  5x5 correlation of pairs of output rows.
+* @param[in]  *pSrc    points to the image.
+* @param[in]  srcCols  number of columns of the image.
+* @param[in]  *pk      points to the 5x5 kernel.
+* @param[out] *pDst    points to the output image.
+* @param[in]  outRows  number of output rows.
+* @param[in]  outCols  number of output columns.
+* @return     number of output rows computed, outRows rounded down to an even value.
+*
+* Every kernel row is split into one sumdotpv4 and one multiply-accumulate.  The two output rows of a pair
+* share the loads of the five input rows in the middle.
+*/
+
+static uint32_t riscv_correlate2d_5x5_q7(
+  const q7_t * pSrc,
+  uint32_t srcCols,
+  const q7_t * pk,
+  q7_t * pDst,
+  uint32_t outRows,
+  uint32_t outCols)
+{
+  const q7_t *px;                                /* Top left input sample of the window */
+  q7_t *pOut;                                    /* Output pointer */
+  charV k[5];                                    /* First four samples of the kernel rows */
+  q31_t k4[5];                                   /* Last sample of the kernel rows */
+  charV x;                                       /* Input samples */
+  q31_t x4;                                      /* Input sample */
+  q31_t acc0, acc1;                              /* Accumulators */
+  uint32_t r, c, i;                              /* Loop counters */
+
+  for (i = 0u; i < 5u; i++)
+  {
+    k[i] = pack4(pk[5u * i], pk[(5u * i) + 1u], pk[(5u * i) + 2u], pk[(5u * i) + 3u]);
+    k4[i] = pk[(5u * i) + 4u];
+  }
+
+  for (r = 0u; (r + 2u) <= outRows; r += 2u)
+  {
+    pOut = pDst + (r * outCols);
+
+    for (c = 0u; c < outCols; c++)
+    {
+      px = pSrc + (r * srcCols) + c;
+
+      /* Input row 0 only feeds the first output, input row 5 only the second */
+      x = *(charV *) px;
+      acc0 = sumdotpv4(x, k[0], (q31_t) px[4] * k4[0]);
+      acc1 = 0;
+
+      for (i = 1u; i < 5u; i++)
+      {
+        px += srcCols;
+        x = *(charV *) px;
+        x4 = px[4];
+        acc0 = sumdotpv4(x, k[i], acc0);
+        acc1 = sumdotpv4(x, k[i - 1u], acc1);
+        acc0 += x4 * k4[i];
+        acc1 += x4 * k4[i - 1u];
+      }
+
+      px += srcCols;
+      acc1 = sumdotpv4(*(charV *) px, k[4], acc1);
+      acc1 += (q31_t) px[4] * k4[4];
+
+      pOut[c] = (q7_t) __SSAT(acc0 >> 7u, 8u);
+      pOut[outCols + c] = (q7_t) __SSAT(acc1 >> 7u, 8u);
+    }
+  }
+
+  return (r);
+}
+
+#endif /* #if defined (USE_DSP_RISCV) */
+
+/**
+ * @brief 2D correlation of a Q7 image with a Q7 kernel.
+ * @param[in]  *pSrc     points to the image, stored row by row.
+ * @param[in]  srcRows   number of rows of the image.
+ * @param[in]  srcCols   number of columns of the image.
+ * @param[in]  *pKernel  points to the kernel, stored row by row.
+ * @param[in]  kRows     number of rows of the kernel.
+ * @param[in]  kCols     number of columns of the kernel.
+ * @param[out] *pDst     points to the output image of <code>(srcRows-kRows+1)*(srcCols-kCols+1)</code> samples.
+ * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the kernel is empty or larger than the image.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 32-bit internal accumulator.
+ * Both inputs are in 1.7 format and multiplications yield a 2.14 result.
+ * The 2.14 intermediate results are accumulated in a 32-bit accumulator in 18.14 format.
+ * This approach provides 17 guard bits and there is no risk of overflow as long as the kernel has fewer than
+ * 131072 samples.  The 18.14 result is then truncated to 18.7 format by discarding the low 7 bits and then
+ * saturated to 1.7 format.
+ */
+
+riscv_status riscv_correlate2d_q7(
+  q7_t * pSrc,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  q7_t * pKernel,
+  uint16_t kRows,
+  uint16_t kCols,
+  q7_t * pDst)
+{
+  RISCV_PROFILE(riscv_correlate2d_q7);
+  uint32_t outRows, outCols;                     /* Size of the output image */
+  uint32_t r = 0u, c;                            /* Loop counters */
+
+  if((kRows == 0u) || (kCols == 0u) || (kRows > srcRows) || (kCols > srcCols))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  outRows = (uint32_t) (srcRows - kRows) + 1u;
+  outCols = (uint32_t) (srcCols - kCols) + 1u;
+
+#if defined (USE_DSP_RISCV)
+
+  if((kRows == 3u) && (kCols == 3u))
+  {
+    r = riscv_correlate2d_3x3_q7(pSrc, srcCols, pKernel, pDst, outRows, outCols);
+  }
+  else if((kRows == 5u) && (kCols == 5u))
+  {
+    r = riscv_correlate2d_5x5_q7(pSrc, srcCols, pKernel, pDst, outRows, outCols);
+  }
+
+#endif
+
+  /* Other kernel sizes and the last row of an odd number of output rows */
+  for (; r < outRows; r++)
+  {
+    for (c = 0u; c < outCols; c++)
+    {
+      pDst[(r * outCols) + c] = riscv_correlate2d_1_q7(pSrc + (r * srcCols) + c, srcCols, pKernel, kRows, kCols);
+    }
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief 2D convolution of a Q7 image with a Q7 kernel.
+ * @param[in]  *pSrc     points to the image, stored row by row.
+ * @param[in]  srcRows   number of rows of the image.
+ * @param[in]  srcCols   number of columns of the image.
+ * @param[in]  *pKernel  points to the kernel, stored row by row.
+ * @param[in]  kRows     number of rows of the kernel.
+ * @param[in]  kCols     number of columns of the kernel.
+ * @param[out] *pDst     points to the output image of <code>(srcRows-kRows+1)*(srcCols-kCols+1)</code> samples.
+ * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the kernel is empty, larger than the image or
+ * has more than RISCV_CONV2D_MAX_KERNEL samples.
+ *
+ * \par
+ * The function rotates the kernel by 180 degrees and calls riscv_correlate2d_q7(), with the same scaling.
+ */
+
+riscv_status riscv_conv2d_q7(
+  q7_t * pSrc,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  q7_t * pKernel,
+  uint16_t kRows,
+  uint16_t kCols,
+  q7_t * pDst)
+{
+  RISCV_PROFILE(riscv_conv2d_q7);
+  q7_t kernel[RISCV_CONV2D_MAX_KERNEL];          /* Rotated kernel */
+  uint32_t numK = (uint32_t) kRows * kCols;      /* Number of kernel samples */
+  uint32_t n;                                    /* Loop counter */
+
+  if(numK > RISCV_CONV2D_MAX_KERNEL)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Reversing the row by row array flips both the rows and the columns */
+  for (n = 0u; n < numK; n++)
+  {
+    kernel[n] = pKernel[(numK - 1u) - n];
+  }
+
+  return (riscv_correlate2d_q7(pSrc, srcRows, srcCols, kernel, kRows, kCols, pDst));
+}
+
+/**
+ * @} end of Conv2D group
+ */
@@ -130,6 +130,7 @@ void riscv_conv_f32(
   uint32_t srcBLen,
   float32_t * pDst)
 {
+  RISCV_PROFILE(riscv_conv_f32);
 
   float32_t *pIn1 = pSrcA;                       /* inputA pointer */
   float32_t *pIn2 = pSrcB;                       /* inputB pointer */
@@ -85,6 +85,7 @@ void riscv_conv_fast_q31(
   uint32_t srcBLen,
   q31_t * pDst)
 {
+  RISCV_PROFILE(riscv_conv_fast_q31);
   q31_t *pIn1;                                   /* inputA pointer */
   q31_t *pIn2;                                   /* inputB pointer */
   q31_t *pOut = pDst;                            /* output pointer */
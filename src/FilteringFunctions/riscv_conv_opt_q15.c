@@ -58,8 +58,8 @@
  * @param[in] *pSrcB points to the second input sequence.    
  * @param[in] srcBLen length of the second input sequence.    
  * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.    
- * @param[in]  *pScratch1 points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.    
- * @param[in]  *pScratch2 points to scratch buffer of size min(srcALen, srcBLen).    
+ * @param[in]  *pScratch1 points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2, or NULL for the scratch pool.
+ * @param[in]  *pScratch2 points to scratch buffer of size min(srcALen, srcBLen), or NULL for the scratch pool.
  * @return none.    
  *    
  * \par Restrictions    
@@ -93,6 +93,28 @@ void riscv_conv_opt_q15(
   q15_t * pScratch1,
   q15_t * pScratch2)
 {
+  RISCV_PROFILE(riscv_conv_opt_q15);
+#if defined (USE_DSP_RISCV)
+  uint32_t scratchMark = riscv_dsp_scratch_mark(); /* scratch pool depth on entry */
+
+  /* Scratch buffers from the scratch pool when the caller passes none */
+  if(pScratch1 == NULL)
+  {
+    pScratch1 = (q15_t *) riscv_dsp_scratch_push((srcALen + srcBLen + ((srcALen < srcBLen) ? srcALen : srcBLen) - 2u) *
+                                                 sizeof(q15_t));
+  }
+
+  if(pScratch2 == NULL)
+  {
+    pScratch2 = (q15_t *) riscv_dsp_scratch_push(((srcALen < srcBLen) ? srcALen : srcBLen) * sizeof(q15_t));
+  }
+
+  if((pScratch1 == NULL) || (pScratch2 == NULL))
+  {
+    riscv_dsp_scratch_pop(scratchMark);
+    return;
+  }
+
   q63_t acc0, acc1, acc2, acc3;                  /* Accumulator */
   q31_t x1, x2, x3;                              /* Temporary variables to hold state and coefficient values */
   q31_t y1, y2;                                  /* State variables */
@@ -362,6 +384,37 @@ void riscv_conv_opt_q15(
 
   }
 
+  riscv_dsp_scratch_pop(scratchMark);
+
+#else
+
+  q15_t *pIn1 = pSrcA;                           /* inputA pointer */
+  q15_t *pIn2 = pSrcB;                           /* inputB pointer */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t i, j;                                 /* loop counters */
+
+  /* Loop to calculate output of convolution for output length number of times */
+  for (i = 0; i < (srcALen + srcBLen - 1); i++)
+  {
+    /* Initialize sum with zero to carry on MAC operations */
+    sum = 0;
+
+    /* Loop to perform MAC operations according to convolution equation */
+    for (j = 0; j <= i; j++)
+    {
+      /* Check the array limitations */
+      if(((i - j) < srcBLen) && (j < srcALen))
+      {
+        /* z[i] += x[i-j] * y[j] */
+        sum += (q31_t) pIn1[j] * (pIn2[i - j]);
+      }
+    }
+
+    /* Store the output in the destination buffer */
+    pDst[i] = (q15_t) __SSAT((sum >> 15u), 16u);
+  }
+
+#endif
 }
 
 
@@ -58,8 +58,8 @@
  * @param[in] *pSrcB points to the second input sequence.    
  * @param[in] srcBLen length of the second input sequence.    
  * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.    
- * @param[in]  *pScratch1 points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.   
- * @param[in]  *pScratch2 points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen).   
+ * @param[in]  *pScratch1 points to scratch buffer(of type q15_t) of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2, or NULL for the scratch pool.
+ * @param[in]  *pScratch2 points to scratch buffer (of type q15_t) of size min(srcALen, srcBLen), or NULL for the scratch pool.
  * @return none.    
  *    
  * \par Restrictions    
@@ -87,6 +87,28 @@ void riscv_conv_opt_q7(
   q15_t * pScratch1,
   q15_t * pScratch2)
 {
+  RISCV_PROFILE(riscv_conv_opt_q7);
+#if defined (USE_DSP_RISCV)
+
+  uint32_t scratchMark = riscv_dsp_scratch_mark(); /* scratch pool depth on entry */
+
+  /* Scratch buffers from the scratch pool when the caller passes none */
+  if(pScratch1 == NULL)
+  {
+    pScratch1 = (q15_t *) riscv_dsp_scratch_push((srcALen + srcBLen + ((srcALen < srcBLen) ? srcALen : srcBLen) - 2u) *
+                                                 sizeof(q15_t));
+  }
+
+  if(pScratch2 == NULL)
+  {
+    pScratch2 = (q15_t *) riscv_dsp_scratch_push(((srcALen < srcBLen) ? srcALen : srcBLen) * sizeof(q15_t));
+  }
+
+  if((pScratch1 == NULL) || (pScratch2 == NULL))
+  {
+    riscv_dsp_scratch_pop(scratchMark);
+    return;
+  }
 
   q15_t *pScr2, *pScr1;                          /* Intermediate pointers for scratch pointers */
   q15_t x4;                                      /* Temporary input variable */
@@ -378,6 +400,37 @@ void riscv_conv_opt_q7(
 
   }
 
+  riscv_dsp_scratch_pop(scratchMark);
+
+#else
+
+  q7_t *pIn1 = pSrcA;                            /* inputA pointer */
+  q7_t *pIn2 = pSrcB;                            /* inputB pointer */
+  q31_t sum;                                     /* Accumulator */
+  uint32_t i, j;                                 /* loop counters */
+
+  /* Loop to calculate output of convolution for output length number of times */
+  for (i = 0; i < (srcALen + srcBLen - 1); i++)
+  {
+    /* Initialize sum with zero to carry on MAC operations */
+    sum = 0;
+
+    /* Loop to perform MAC operations according to convolution equation */
+    for (j = 0; j <= i; j++)
+    {
+      /* Check the array limitations */
+      if(((i - j) < srcBLen) && (j < srcALen))
+      {
+        /* z[i] += x[i-j] * y[j] */
+        sum += (q15_t) pIn1[j] * (pIn2[i - j]);
+      }
+    }
+
+    /* Store the output in the destination buffer */
+    pDst[i] = (q7_t) __SSAT((sum >> 7u), 8u);
+  }
+
+#endif
 }
 
 
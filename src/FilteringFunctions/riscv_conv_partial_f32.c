@@ -103,6 +103,7 @@ riscv_status riscv_conv_partial_f32(
   uint32_t firstIndex,
   uint32_t numPoints)
 {
+  RISCV_PROFILE(riscv_conv_partial_f32);
 
   float32_t *pIn1 = pSrcA;                       /* inputA pointer */
   float32_t *pIn2 = pSrcB;                       /* inputB pointer */
@@ -75,6 +75,8 @@ riscv_status riscv_conv_partial_fast_q15(
   uint32_t firstIndex,
   uint32_t numPoints)
 {
+  RISCV_PROFILE(riscv_conv_partial_fast_q15);
+#if defined (USE_DSP_RISCV)
 
   q15_t *pIn1;                                   /* inputA pointer               */
   q15_t *pIn2;                                   /* inputB pointer               */
@@ -286,12 +288,13 @@ riscv_status riscv_conv_partial_fast_q15(
     /* Working pointer of inputA */
     if((int32_t)firstIndex - (int32_t)srcBLen + 1 > 0)
     {
-      px = pIn1 + firstIndex - srcBLen + 1;
+      pSrc1 = pIn1 + firstIndex - srcBLen + 1;
     }
     else
     {
-      px = pIn1;
+      pSrc1 = pIn1;
     }
+    px = pSrc1;
 
     /* Working pointer of inputB */
     pSrc2 = pIn2 + (srcBLen - 1u);
@@ -315,185 +318,80 @@ riscv_status riscv_conv_partial_fast_q15(
 
       while(blkCnt > 0u)
       {
-      py = py - 1u;
-
         /* Set all accumulators to zero */
         acc0 = 0;
         acc1 = 0;
         acc2 = 0;
         acc3 = 0;
 
-      /* read x[0], x[1] samples */
-        a = *px++;
-        b = *px++;
-
-	VectInA[0] = a; /*x0*/
-	VectInA[1] = b; /*x1*/
-	a = *px;
-	VectInB[0] = b; /*x1*/
-	VectInB[1] = a; /*x2*/
-
-      /* Apply loop unrolling and compute 4 MACs simultaneously. */
-      k = srcBLen >> 2u;
-
-      /* First part of the processing with loop unrolling.  Compute 4 MACs at a time.   
-       ** a second loop below computes MACs for the remaining 1 to 3 samples. */
-      do
-      {
-        /* Read the last two inputB samples using SIMD:   
-         * y[srcBLen - 1] and y[srcBLen - 2] */
-        a = *py;
-        b = *(py+1);
-        py -= 2;
-        VectInC[0] = a; /*y[srcBLen - 1]*/
-        VectInC[1] = b; /*y[srcBLen - 2] */
-
-        /* acc0 +=  x[0] * y[srcBLen - 1] + x[1] * y[srcBLen - 2] */
-        acc0 = sumdotpv2(VectInA, VectInC, acc0);
-
-        /* acc1 +=  x[1] * y[srcBLen - 1] + x[2] * y[srcBLen - 2] */
-        acc1 = sumdotpv2(VectInB, VectInC, acc1);
-
-        a = *px;
-        b = *(px + 1);
-
-        VectInD[0] = a; /*x2*/
-        VectInD[1] = b; /*x3*/
-        a = *(px + 2);
-        VectInE[0] = b; /*x3*/
-        VectInE[1] = a; /*x4*/
-        /* acc2 +=  x[2] * y[srcBLen - 1] + x[3] * y[srcBLen - 2] */
-        acc2 = sumdotpv2(VectInD, VectInC, acc2);
-
-        /* acc3 +=  x[3] * y[srcBLen - 1] + x[4] * y[srcBLen - 2] */
-        acc3 = sumdotpv2(VectInE, VectInC, acc3);
-
-        /* Read y[srcBLen - 3] and y[srcBLen - 4] */
-        a = *py;
-        b = *(py+1);
-        py -= 2;
-        VectInC[0] = a; /*y[srcBLen - 3]*/
-        VectInC[1] = b; /*y[srcBLen - 4] */
-
-        /* acc0 +=  x[2] * y[srcBLen - 3] + x[3] * y[srcBLen - 4] */
-        acc0 = sumdotpv2(VectInD, VectInC, acc0);
-
-        /* acc1 +=  x[3] * y[srcBLen - 3] + x[4] * y[srcBLen - 4] */
-        acc1 = sumdotpv2(VectInE, VectInC, acc1);
-
-        /* Read x[4], x[5], x[6] */
-        a = *(px + 2);
-        b = *(px + 3);
-
-        VectInA[0] = a; /*x4*/
-        VectInA[1] = b; /*x5*/
-        a = *(px + 4);
-        VectInB[0] = b; /*x5*/
-        VectInB[1] = a; /*x6*/
-
-        px += 4u;
-
-        /* acc2 +=  x[4] * y[srcBLen - 3] + x[5] * y[srcBLen - 4] */
-        acc2 = sumdotpv2(VectInA, VectInC, acc2);
-
-        /* acc3 +=  x[5] * y[srcBLen - 3] + x[6] * y[srcBLen - 4] */
-        acc3 = sumdotpv2(VectInB, VectInC, acc3);
-
-      } while(--k);
-
-      /* For the next MAC operations, SIMD is not used   
-       * So, the 16 bit pointer if inputB, py is updated */
-
-      /* If the srcBLen is not a multiple of 4, compute any remaining MACs here.   
-       ** No loop unrolling is used. */
-      k = srcBLen % 0x4u;
-
-      if(k == 1u)
-      {
-        /* Read y[srcBLen - 5] */
-     
-        VectInC[0] = VectInC[1]; 
-        VectInC[1] = 0;
-        /* Read x[7] */
-        a = *px;
-        b = *(px+1);
-        px++;
-
-        VectInD[0] = a; /*x6*/
-        VectInD[1] = b; /*7*/
-
-        acc0 = sumdotpv2(VectInA, VectInC, acc0);
-        acc1 = sumdotpv2(VectInB, VectInC, acc1);
-        acc2 = sumdotpv2(VectInB, VectInC, acc2);
-        acc3 = sumdotpv2(VectInD, VectInC, acc3);
-      }
-
-      if(k == 2u)
-      {
-        /* Read y[srcBLen - 5], y[srcBLen - 6] */
-        a = *py;
-        b = *(py+1);
-        VectInC[0] = a; 
-        VectInC[1] = b;
-
-        /* Read x[7], x[8], x[9] */
-        a = *px;
-        b = *(px + 1);
-        VectInE[0] = a; /*x7*/
-        VectInE[1] = b; /*x8*/
-        a = *(px + 2);
-        VectInD[0] = b; /*x8*/
-        VectInD[1] = a; /*x9*/
-        px += 2u;
-
-        /* Perform the multiply-accumulates */
-        acc0 = sumdotpv2(VectInA, VectInC, acc0);
-        acc1 = sumdotpv2(VectInB, VectInC, acc1);
-        acc2 = sumdotpv2(VectInE, VectInC, acc2);
-        acc3 = sumdotpv2(VectInD, VectInC, acc3);
-      }
+        /* Apply loop unrolling and compute 4 MACs simultaneously. */
+        k = srcBLen >> 2u;
 
-      if(k == 3u)
-      {
-        /* Read y[srcBLen - 5], y[srcBLen - 6] */
-        a = *py;
-        b = *(py+1);
-        VectInC[0] = a; 
-        VectInC[1] = b;
-
-        /* Read x[7], x[8], x[9] */
-        a = *px;
-        b = *(px + 1);
-
-        VectInE[0] = a; /*x7*/
-        VectInE[1] = b; /*x8*/
-        a = *(px + 2);
-        VectInD[0] = b; /*x8*/
-        VectInD[1] = a; /*x9*/
+        /* First part of the processing with loop unrolling.  Compute 4 MACs at a time.   
+         ** a second loop below computes MACs for the remaining 1 to 3 samples. */
+        do
+        {
+          /* Read y[srcBLen - 1], y[srcBLen - 2] in reversed order */
+          VectInC = pack2(*py, *(py - 1));
+
+          /* Read x[0], x[1] and x[1], x[2] */
+          VectInA = *(shortV*)px;
+          VectInB = *(shortV*)(px + 1);
+
+          /* Read x[2], x[3] and x[3], x[4] */
+          VectInD = *(shortV*)(px + 2);
+          VectInE = *(shortV*)(px + 3);
+
+          /* acc0 +=  x[0] * y[srcBLen - 1] + x[1] * y[srcBLen - 2] */
+          acc0 = sumdotpv2(VectInA, VectInC, acc0);
+          /* acc1 +=  x[1] * y[srcBLen - 1] + x[2] * y[srcBLen - 2] */
+          acc1 = sumdotpv2(VectInB, VectInC, acc1);
+          /* acc2 +=  x[2] * y[srcBLen - 1] + x[3] * y[srcBLen - 2] */
+          acc2 = sumdotpv2(VectInD, VectInC, acc2);
+          /* acc3 +=  x[3] * y[srcBLen - 1] + x[4] * y[srcBLen - 2] */
+          acc3 = sumdotpv2(VectInE, VectInC, acc3);
+
+          /* Read y[srcBLen - 3], y[srcBLen - 4] in reversed order */
+          VectInC = pack2(*(py - 2), *(py - 3));
+          py -= 4u;
+
+          /* Read x[4], x[5] and x[5], x[6] */
+          VectInA = *(shortV*)(px + 4);
+          VectInB = *(shortV*)(px + 5);
+
+          /* acc0 +=  x[2] * y[srcBLen - 3] + x[3] * y[srcBLen - 4] */
+          acc0 = sumdotpv2(VectInD, VectInC, acc0);
+          /* acc1 +=  x[3] * y[srcBLen - 3] + x[4] * y[srcBLen - 4] */
+          acc1 = sumdotpv2(VectInE, VectInC, acc1);
+          /* acc2 +=  x[4] * y[srcBLen - 3] + x[5] * y[srcBLen - 4] */
+          acc2 = sumdotpv2(VectInA, VectInC, acc2);
+          /* acc3 +=  x[5] * y[srcBLen - 3] + x[6] * y[srcBLen - 4] */
+          acc3 = sumdotpv2(VectInB, VectInC, acc3);
+
+          px += 4u;
+
+        } while(--k);
 
-        /* Perform the multiply-accumulates */
-        acc0 = sumdotpv2(VectInA, VectInC, acc0);
-        acc1 = sumdotpv2(VectInB, VectInC, acc1);
-        acc2 = sumdotpv2(VectInE, VectInC, acc2);
-        acc3 = sumdotpv2(VectInD, VectInC, acc3);
-                VectInC[0] = VectInC[1]; 
-                VectInC[1] = 0;
+        /* If the srcBLen is not a multiple of 4, compute any remaining MACs here.   
+         ** No loop unrolling is used. */
+        k = srcBLen % 0x4u;
 
-        /* Read x[10] */
-        a = *(px+2);
-        b = *(px+3);
+        while(k > 0u)
+        {
+          /* Read y[srcBLen - 5] */
+          c0 = *py--;
 
-        VectInE[0] = a; /*x9*/
-        VectInE[1] = b; /*x10*/
+          /* Perform the multiply-accumulates */
+          acc0 = mac(*px, c0, acc0);
+          acc1 = mac(*(px + 1), c0, acc1);
+          acc2 = mac(*(px + 2), c0, acc2);
+          acc3 = mac(*(px + 3), c0, acc3);
 
-        px += 3u;
+          px++;
 
-        /* Perform the multiply-accumulates */
-        acc0 = sumdotpv2(VectInB, VectInC, acc0);
-        acc1 = sumdotpv2(VectInD, VectInC, acc1);
-        acc2 = sumdotpv2(VectInD, VectInC, acc2);
-        acc3 = sumdotpv2(VectInE, VectInC, acc3);
-      }
+          /* Decrement the loop counter */
+          k--;
+        }
 
       /* Store the results in the accumulators in the destination buffer. */
 	/**pOut++ = (q15_t)(acc0 >> 15);
@@ -508,7 +406,7 @@ riscv_status riscv_conv_partial_fast_q15(
         count += 4u;
 
         /* Update the inputA and inputB pointers for next MAC calculation */
-        px = pIn1 + count;
+        px = pSrc1 + count;
         py = pSrc2;
 
         /* Decrement the loop counter */
@@ -559,7 +457,7 @@ riscv_status riscv_conv_partial_fast_q15(
         count++;
 
         /* Update the inputA and inputB pointers for next MAC calculation */
-        px = pIn1 + count;
+        px = pSrc1 + count;
         py = pSrc2;
 
         /* Decrement the loop counter */
@@ -595,7 +493,7 @@ riscv_status riscv_conv_partial_fast_q15(
         count++;
 
         /* Update the inputA and inputB pointers for next MAC calculation */
-        px = pIn1 + count;
+        px = pSrc1 + count;
         py = pSrc2;
 
         /* Decrement the loop counter */
@@ -617,10 +515,13 @@ riscv_status riscv_conv_partial_fast_q15(
 
     /* In this stage the MAC operations are decreased by 1 for every iteration.   
        The count variable holds the number of MAC operations performed */
-    count = srcBLen - 1u;
+    /* Stage3 starts at the output sample srcALen, or at firstIndex   
+     * when the requested range begins inside stage3 */
+    j = ((int32_t) firstIndex > (int32_t) srcALen) ? firstIndex : srcALen;
+    count = (srcALen + srcBLen - 1u) - j;
 
     /* Working pointer of inputA */
-    pSrc1 = (pIn1 + srcALen) - (srcBLen - 1u);
+    pSrc1 = pIn1 + (j - (srcBLen - 1u));
     px = pSrc1;
 
     /* Working pointer of inputB */
@@ -734,6 +635,50 @@ riscv_status riscv_conv_partial_fast_q15(
   /* Return to application */
   return (status);
 
+#else
+
+  q15_t *pIn1 = pSrcA;                           /* inputA pointer */
+  q15_t *pIn2 = pSrcB;                           /* inputB pointer */
+  q31_t sum;                                     /* Accumulator */
+  uint32_t i, j;                                 /* loop counters */
+  riscv_status status;                           /* status of Partial convolution */
+
+  /* Check for range of output samples to be calculated */
+  if((firstIndex + numPoints) > ((srcALen + (srcBLen - 1u))))
+  {
+    /* Set status as RISCV_MATH_ARGUMENT_ERROR */
+    status = RISCV_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Loop to calculate convolution for output length number of values */
+    for (i = firstIndex; i <= (firstIndex + numPoints - 1); i++)
+    {
+      /* Initialize sum with zero to carry on MAC operations */
+      sum = 0;
+
+      /* Loop to perform MAC operations according to convolution equation */
+      for (j = 0; j <= i; j++)
+      {
+        /* Check the array limitations */
+        if(((i - j) < srcBLen) && (j < srcALen))
+        {
+          /* z[i] += x[i-j] * y[j] */
+          sum += ((q31_t) pIn1[j] * (pIn2[i - j]));
+        }
+      }
+
+      /* Store the output in the destination buffer */
+      pDst[i] = (q15_t) __SSAT((sum >> 15u), 16u);
+    }
+    /* set status as RISCV_MATH_SUCCESS as there are no argument errors */
+    status = RISCV_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+
+#endif
 }
 
 /**   
@@ -75,6 +75,7 @@ riscv_status riscv_conv_partial_fast_q31(
   uint32_t firstIndex,
   uint32_t numPoints)
 {
+  RISCV_PROFILE(riscv_conv_partial_fast_q31);
   q31_t *pIn1;                                   /* inputA pointer               */
   q31_t *pIn2;                                   /* inputB pointer               */
   q31_t *pOut = pDst;                            /* output pointer               */
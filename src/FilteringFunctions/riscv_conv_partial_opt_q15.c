@@ -60,9 +60,10 @@
  * @param[out]      *pDst points to the location where the output result is written.    
  * @param[in]       firstIndex is the first output sample to start with.    
  * @param[in]       numPoints is the number of output points to be computed.    
- * @param[in]       *pScratch1 points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.   
- * @param[in]       *pScratch2 points to scratch buffer of size min(srcALen, srcBLen).   
- * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].    
+ * @param[in]       *pScratch1 points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2, or NULL for the scratch pool.
+ * @param[in]       *pScratch2 points to scratch buffer of size min(srcALen, srcBLen), or NULL for the scratch pool.
+ * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2],
+ * or RISCV_MATH_LENGTH_ERROR if a scratch buffer is NULL and the scratch pool is too small.
  *    
  * \par Restrictions    
  *  If the silicon does not support unaligned memory access enable the macro UNALIGNED_SUPPORT_DISABLE    
@@ -85,6 +86,28 @@ riscv_status riscv_conv_partial_opt_q15(
   q15_t * pScratch1,
   q15_t * pScratch2)
 {
+  RISCV_PROFILE(riscv_conv_partial_opt_q15);
+#if defined (USE_DSP_RISCV)
+
+  uint32_t scratchMark = riscv_dsp_scratch_mark(); /* scratch pool depth on entry */
+
+  /* Scratch buffers from the scratch pool when the caller passes none */
+  if(pScratch1 == NULL)
+  {
+    pScratch1 = (q15_t *) riscv_dsp_scratch_push((srcALen + srcBLen + ((srcALen < srcBLen) ? srcALen : srcBLen) - 2u) *
+                                                 sizeof(q15_t));
+  }
+
+  if(pScratch2 == NULL)
+  {
+    pScratch2 = (q15_t *) riscv_dsp_scratch_push(((srcALen < srcBLen) ? srcALen : srcBLen) * sizeof(q15_t));
+  }
+
+  if((pScratch1 == NULL) || (pScratch2 == NULL))
+  {
+    riscv_dsp_scratch_pop(scratchMark);
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
 
   q15_t *pOut = pDst;                            /* output pointer */
   q15_t *pScr1 = pScratch1;                      /* Temporary pointer for scratch1 */
@@ -358,8 +381,55 @@ riscv_status riscv_conv_partial_opt_q15(
 
   }
 
+  riscv_dsp_scratch_pop(scratchMark);
+
+  /* Return to application */
+  return (status);
+
+#else
+
+  q15_t *pIn1 = pSrcA;                           /* inputA pointer */
+  q15_t *pIn2 = pSrcB;                           /* inputB pointer */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t i, j;                                 /* loop counters */
+  riscv_status status;                           /* status of Partial convolution */
+
+  /* Check for range of output samples to be calculated */
+  if((firstIndex + numPoints) > ((srcALen + (srcBLen - 1u))))
+  {
+    /* Set status as RISCV_MATH_ARGUMENT_ERROR */
+    status = RISCV_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Loop to calculate convolution for output length number of values */
+    for (i = firstIndex; i <= (firstIndex + numPoints - 1); i++)
+    {
+      /* Initialize sum with zero to carry on MAC operations */
+      sum = 0;
+
+      /* Loop to perform MAC operations according to convolution equation */
+      for (j = 0; j <= i; j++)
+      {
+        /* Check the array limitations */
+        if(((i - j) < srcBLen) && (j < srcALen))
+        {
+          /* z[i] += x[i-j] * y[j] */
+          sum += ((q31_t) pIn1[j] * (pIn2[i - j]));
+        }
+      }
+
+      /* Store the output in the destination buffer */
+      pDst[i] = (q15_t) __SSAT((sum >> 15u), 16u);
+    }
+    /* set status as RISCV_MATH_SUCCESS as there are no argument errors */
+    status = RISCV_MATH_SUCCESS;
+  }
+
   /* Return to application */
   return (status);
+
+#endif
 }
 
 
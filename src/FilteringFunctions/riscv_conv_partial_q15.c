@@ -79,6 +79,7 @@ riscv_status riscv_conv_partial_q15(
   uint32_t firstIndex,
   uint32_t numPoints)
 {
+  RISCV_PROFILE(riscv_conv_partial_q15);
 
 #if defined (USE_DSP_RISCV)
   q15_t *pIn1;                                   /* inputA pointer               */
@@ -74,6 +74,7 @@ riscv_status riscv_conv_partial_q31(
   uint32_t firstIndex,
   uint32_t numPoints)
 {
+  RISCV_PROFILE(riscv_conv_partial_q31);
 
   q31_t *pIn1 = pSrcA;                           /* inputA pointer */
   q31_t *pIn2 = pSrcB;                           /* inputB pointer */
@@ -84,6 +84,7 @@ void riscv_conv_q31(
   uint32_t srcBLen,
   q31_t * pDst)
 {
+  RISCV_PROFILE(riscv_conv_q31);
 
   q31_t *pIn1 = pSrcA;                           /* input pointer */
   q31_t *pIn2 = pSrcB;                           /* coefficient pointer */
@@ -82,6 +82,7 @@ void riscv_conv_q7(
   uint32_t srcBLen,
   q7_t * pDst)
 {
+  RISCV_PROFILE(riscv_conv_q7);
 
                                 /* loop counter */
 #if defined (USE_DSP_RISCV)
@@ -92,10 +93,8 @@ void riscv_conv_q7(
   q7_t *px;                                      /* Intermediate inputA pointer */
   q7_t *py;                                      /* Intermediate inputB pointer */
   q7_t *pSrc1, *pSrc2;                           /* Intermediate pointers */
-  q7_t x0, x1, x2, x3, c0, c1;                   /* Temporary variables to hold state and coefficient values */
+  q7_t x0, x1, x2, x3, c0;                       /* Temporary variables to hold state and coefficient values */
   q31_t sum, acc0, acc1, acc2, acc3;             /* Accumulator */
-  q31_t input1, input2;                          /* Temporary input variables */
-  q15_t in1, in2,in3,in4;                                /* Temporary input variables */
   uint32_t j, k, count, blkCnt, blockSize1, blockSize2, blockSize3;     /* loop counter */
   charV VectInacc0A;
   charV VectInacc1A;
@@ -104,6 +103,9 @@ void riscv_conv_q7(
   charV VectInB;
   charV *VectInC;
   charV VectInD;
+  charV rev = {3, 2, 1, 0};                     /* byte reversal of a word of y */
+  charV win1 = {1, 2, 3, 5};                    /* x[1] to x[4] out of x[0..3] and x[3..6] */
+  charV win2 = {2, 3, 5, 6};                    /* x[2] to x[5] out of x[0..3] and x[3..6] */
   /* The algorithm implementation is based on the lengths of the inputs. */
   /* srcB is always made to slide across srcA. */
   /* So srcBLen is always considered as shorter or equal to srcALen */
@@ -184,16 +186,11 @@ void riscv_conv_q7(
     while(k > 0u)
     {
 
-      in1 = (q15_t) * py--;
-      in2 = (q15_t) * py--;
-      in3 = (q15_t) * py--;
-      in4 = (q15_t) * py--;
-      VectInD[0] = in1;
-      VectInD[1] = in2;
-      VectInD[2] = in3;
-      VectInD[3] = in4;
-      VectInC= (charV*)px;
-      px+=4;
+      /* y[n] to y[n - 3], reversed into the order of x */
+      VectInD = shuffleb(*(charV *) (py - 3), rev);
+      py -= 4;
+      VectInC = (charV *) px;
+      px += 4;
       sum = sumdotpv4(*VectInC, VectInD, sum);
       /* Decrement the loop counter */
       k--;
@@ -266,124 +263,42 @@ void riscv_conv_q7(
       acc2 = 0;
       acc3 = 0;
 
-      /* read x[0], x[1], x[2] samples */
-      x0 = *(px++);
-      x1 = *(px++);
-      x2 = *(px++);
-
-      /* Apply loop unrolling and compute 4 MACs simultaneously. */
+      /* Apply loop unrolling and compute 4 MACs of each of the 4 outputs at a time.
+       ** The outputs start at x[0], x[1], x[2] and x[3]: two word loads hold x[0] to x[3]
+       ** and x[3] to x[6], the windows in between are shuffled from them. */
       k = srcBLen >> 2u;
 
-      /* First part of the processing with loop unrolling.  Compute 4 MACs at a time.   
-       ** a second loop below computes MACs for the remaining 1 to 3 samples. */
       do
       {
-        /* Read y[srcBLen - 1] sample */
-        c0 = *(py--);
-        /* Read y[srcBLen - 2] sample */
-        c1 = *(py--);
-
-        /* Read x[3] sample */
-        x3 = *(px++);
+        /* y[srcBLen - 1] to y[srcBLen - 4], reversed into the order of x */
+        VectInB = shuffleb(*(charV *) (py - 3), rev);
+        py -= 4;
 
-        /* x[0] and x[1] are packed */
-        in1 = (q15_t) x0;
-        in2 = (q15_t) x1;
-        in3 = (q15_t) c0;
-        in4 = (q15_t) c1;
+        /* x[0] to x[3] and x[3] to x[6] */
+        VectInacc0A = *(charV *) px;
+        VectInacc3A = *(charV *) (px + 3);
+        px += 4;
 
-        VectInacc0A[0] = in1;
-        VectInacc0A[1] = in2;
-        VectInB[0] = in3;
-        VectInB[1] = in4;
+        /* x[1] to x[4] and x[2] to x[5] */
+        VectInacc1A = shuffle2b(VectInacc0A, VectInacc3A, win1);
+        VectInacc2A = shuffle2b(VectInacc0A, VectInacc3A, win2);
 
-        /* x[1] and x[2] are packed */
-        in1 = (q15_t) x1;
-        in2 = (q15_t) x2;
-        VectInacc1A[0] = in1;
-        VectInacc1A[1] = in2;
-
-
-        /* x[2] and x[3] are packed */
-        in1 = (q15_t) x2;
-        in2 = (q15_t) x3;
-        VectInacc2A[0] = in1;
-        VectInacc2A[1] = in2;
-
-
-
-        /* Read x[4] sample */
-        x0 = *(px++);
-
-        /* x[3] and x[4] are packed */
-        in1 = (q15_t) x3;
-        in2 = (q15_t) x0;
-
-        VectInacc3A[0] = in1;
-        VectInacc3A[1] = in2;
-
-        /* acc3 += x[3] * y[srcBLen - 1] + x[4] * y[srcBLen - 2]  */
-        /*acc3 = sumdotpv2(VectInA, VectInB, acc3);*/
-
-        /* Read y[srcBLen - 3] sample */
-        c0 = *(py--);
-        /* Read y[srcBLen - 4] sample */
-        c1 = *(py--);
-
-        /* Read x[5] sample */
-        x1 = *(px++);
-
-        /* x[2] and x[3] are packed */
-        in1 = (q15_t) x2;
-        in2 = (q15_t) x3;
-        VectInacc0A[2] = in1;
-        VectInacc0A[3] = in2;
-
-
-        /* y[srcBLen - 3] and y[srcBLen - 4] are packed */
-        in3 = (q15_t) c0;
-        in4 = (q15_t) c1;
-
-        VectInB[2] = in3;
-        VectInB[3] = in4;
-        /* acc0 += x[2] * y[srcBLen - 3] + x[3] * y[srcBLen - 4]  */
+        /* acc0 += x[0] * y[srcBLen - 1] + ... + x[3] * y[srcBLen - 4] */
         acc0 = sumdotpv4(VectInacc0A, VectInB, acc0);
-
-        /* x[3] and x[4] are packed */
-        in1 = (q15_t) x3;
-        in2 = (q15_t) x0;
-        VectInacc1A[2] = in1;
-        VectInacc1A[3] = in2;
-
-
-        /* acc1 += x[3] * y[srcBLen - 3] + x[4] * y[srcBLen - 4]  */
+        /* acc1 += x[1] * y[srcBLen - 1] + ... + x[4] * y[srcBLen - 4] */
         acc1 = sumdotpv4(VectInacc1A, VectInB, acc1);
-
-        /* x[4] and x[5] are packed */
-        in1 = (q15_t) x0;
-        in2 = (q15_t) x1;
-        VectInacc2A[2] = in1;
-        VectInacc2A[3] = in2;
-
-
-        /* acc2 += x[4] * y[srcBLen - 3] + x[5] * y[srcBLen - 4]  */
+        /* acc2 += x[2] * y[srcBLen - 1] + ... + x[5] * y[srcBLen - 4] */
         acc2 = sumdotpv4(VectInacc2A, VectInB, acc2);
-
-        /* Read x[6] sample */
-        x2 = *(px++);
-
-        /* x[5] and x[6] are packed */
-        in1 = (q15_t) x1;
-        in2 = (q15_t) x2;
-        VectInacc3A[2] = in1;
-        VectInacc3A[3] = in2;
-
-
-        /* acc3 += x[5] * y[srcBLen - 3] + x[6] * y[srcBLen - 4]  */
+        /* acc3 += x[3] * y[srcBLen - 1] + ... + x[6] * y[srcBLen - 4] */
         acc3 = sumdotpv4(VectInacc3A, VectInB, acc3);
 
       } while(--k);
 
+      /* read x[0], x[1], x[2] samples of the remaining MACs */
+      x0 = *(px++);
+      x1 = *(px++);
+      x2 = *(px++);
+
       /* If the srcBLen is not a multiple of 4, compute any remaining MACs here.   
        ** No loop unrolling is used. */
       k = srcBLen % 0x4u;
@@ -449,16 +364,11 @@ void riscv_conv_q7(
        ** a second loop below computes MACs for the remaining 1 to 3 samples. */
       while(k > 0u)
       {
-      in1 = (q15_t) * py--;
-      in2 = (q15_t) * py--;
-      in3 = (q15_t) * py--;
-      in4 = (q15_t) * py--;
-      VectInD[0] = in1;
-      VectInD[1] = in2;
-      VectInD[2] = in3;
-      VectInD[3] = in4;
-      VectInC= (charV*)px;
-      px+=4;
+      /* y[n] to y[n - 3], reversed into the order of x */
+      VectInD = shuffleb(*(charV *) (py - 3), rev);
+      py -= 4;
+      VectInC = (charV *) px;
+      px += 4;
       sum = sumdotpv4(*VectInC, VectInD, sum);
         /* Decrement the loop counter */
         k--;
@@ -569,16 +479,11 @@ void riscv_conv_q7(
     while(k > 0u)
     {
       /* Reading two inputs, x[srcALen - srcBLen + 1] and x[srcALen - srcBLen + 2] of SrcA buffer and packing */
-        in1 = (q15_t) * py--;
-        in2 = (q15_t) * py--;
-        in3 = (q15_t) * py--;
-        in4 = (q15_t) * py--;
-        VectInD[0] = in1;
-        VectInD[1] = in2;
-        VectInD[2] = in3;
-        VectInD[3] = in4;
-        VectInC= (charV*)px;
-        px+=4;
+        /* y[n] to y[n - 3], reversed into the order of x */
+        VectInD = shuffleb(*(charV *) (py - 3), rev);
+        py -= 4;
+        VectInC = (charV *) px;
+        px += 4;
         sum = sumdotpv4(*VectInC, VectInD, sum);
       /* Decrement the loop counter */
       k--;
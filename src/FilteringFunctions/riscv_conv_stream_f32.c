@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_conv_stream_f32.c
+*
+* Description:  Floating-point convolution of an unbounded input stream.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Conv_Stream Streaming Convolution
+ *
+ * These functions convolve a fixed sequence <code>pSrcB</code> of length <code>srcBLen</code> with an input
+ * stream that arrives in blocks of any size.  The concatenation of all outputs, followed by the output of the
+ * flush function, equals the output of riscv_conv_f32() with the concatenation of all input blocks as the
+ * first sequence:
+ * <pre>
+ *    y[n] = x[n] * b[0] + x[n-1] * b[1] + ... + x[n-srcBLen+1] * b[srcBLen-1]
+ * </pre>
+ * Every call returns as many outputs as it takes inputs.  The last <code>srcBLen-1</code> inputs stay in the
+ * state of the instance and contribute to the outputs of the next call, so a block boundary costs nothing
+ * and the blocks need not be glued together with riscv_conv_partial_f32().
+ * \par
+ * The instance holds a FIR filter with the time reversed sequence as coefficients, and the outputs are
+ * computed with riscv_fir_f32(), riscv_fir_q31() or riscv_fir_q15().  The FIR functions only compute the
+ * steady state phase of the convolution, since the state already holds the previous inputs, so the ramp-up
+ * phase of riscv_conv_f32() is not repeated for every block.  Blocks longer than the <code>blockSize</code>
+ * given to the initialization function are processed in pieces of <code>blockSize</code> samples.
+ * \par
+ * At the end of the stream, the flush function returns the last <code>srcBLen-1</code> outputs, the ramp-down
+ * phase of riscv_conv_f32(), and clears the state so that the instance can start a new stream.
+ * \par
+ * The initialization functions copy <code>pSrcB</code> in time reversed order to <code>pCoeffs</code>, which
+ * must stay valid as long as the instance is used.  The Q15 version pads the sequence to an even length with
+ * a leading zero, as riscv_fir_q15() requires, so <code>pCoeffs</code> is of length <code>srcBLen+1</code> when
+ * <code>srcBLen</code> is odd.  <code>pState</code> is of length <code>numTaps+blockSize-1</code>, where
+ * <code>numTaps</code> is the length of <code>pCoeffs</code>.
+ * \par Fixed-Point Behavior
+ * The Q31 and Q15 versions have the scaling of riscv_fir_q31() and riscv_fir_q15(), which use a 64-bit
+ * accumulator like riscv_conv_q31() and riscv_conv_q15().
+ */
+
+/**
+ * @addtogroup Conv_Stream
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point streaming convolution.
+ * @param[in,out] *S      points to an instance of the floating-point streaming convolution structure.
+ * @param[in]     *pSrc   points to the block of input data.
+ * @param[out]    *pDst   points to the block of <code>srcLen</code> output values.
+ * @param[in]     srcLen  number of input samples, any value.
+ * @return none.
+ */
+
+void riscv_conv_stream_f32(
+  riscv_conv_stream_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t srcLen)
+{
+  RISCV_PROFILE(riscv_conv_stream_f32);
+  uint32_t blkLen;                               /* Length of the current piece */
+
+  while(srcLen > 0u)
+  {
+    blkLen = (srcLen < S->blockSize) ? srcLen : S->blockSize;
+
+    riscv_fir_f32(&S->Sfir, pSrc, pDst, blkLen);
+
+    pSrc += blkLen;
+    pDst += blkLen;
+    srcLen -= blkLen;
+  }
+}
+
+/**
+ * @brief Flush function for the floating-point streaming convolution.
+ * @param[in,out] *S     points to an instance of the floating-point streaming convolution structure.
+ * @param[out]    *pDst  points to the block of <code>srcBLen-1</code> output values.
+ * @return none.
+ *
+ * \par
+ * The outputs are those of <code>srcBLen-1</code> zero input samples.  The state is cleared afterwards.
+ */
+
+void riscv_conv_stream_flush_f32(
+  riscv_conv_stream_instance_f32 * S,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_conv_stream_flush_f32);
+  float32_t *pState = S->Sfir.pState;            /* Last numTaps - 1 inputs, oldest first */
+  const float32_t *pCoeffs = S->Sfir.pCoeffs;    /* Time reversed sequence */
+  const float32_t *px, *pb;                      /* State and coefficient pointers */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t numTaps = S->Sfir.numTaps;            /* Length of the coefficient array */
+  uint32_t j, k;                                 /* Loop counters */
+
+  /* Output j of the ramp-down only sees the state samples j .. numTaps - 2 */
+  for (j = 0u; j < (S->srcBLen - 1u); j++)
+  {
+    px = pState + j;
+    pb = pCoeffs;
+    sum = 0.0f;
+
+    for (k = (numTaps - 1u) - j; k > 0u; k--)
+    {
+      sum += *px++ * *pb++;
+    }
+
+    pDst[j] = sum;
+  }
+
+  memset(pState, 0, (numTaps - 1u) * sizeof(float32_t));
+}
+
+/**
+ * @} end of Conv_Stream group
+ */
@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_conv_stream_init_f32.c
+*
+* Description:  Initialization function for the floating-point streaming
+*               convolution.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv_Stream
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point streaming convolution.
+ * @param[in,out] *S          points to an instance of the floating-point streaming convolution structure.
+ * @param[in]     *pSrcB      points to the fixed sequence.
+ * @param[in]     srcBLen     length of the fixed sequence.
+ * @param[out]    *pCoeffs    points to a buffer of <code>srcBLen</code> words that receives the time reversed sequence.
+ * @param[in]     *pState     points to the state buffer of <code>srcBLen+blockSize-1</code> words.
+ * @param[in]     blockSize   maximum number of samples that riscv_fir_f32() processes at a time.
+ * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+ * <code>srcBLen</code> or <code>blockSize</code> is 0.
+ */
+
+riscv_status riscv_conv_stream_init_f32(
+  riscv_conv_stream_instance_f32 * S,
+  float32_t * pSrcB,
+  uint16_t srcBLen,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_conv_stream_init_f32);
+  uint32_t k;
+
+  if((srcBLen == 0u) || (blockSize == 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* riscv_fir_f32() multiplies pCoeffs[0] with the oldest sample */
+  for (k = 0u; k < srcBLen; k++)
+  {
+    pCoeffs[k] = pSrcB[(srcBLen - 1u) - k];
+  }
+
+  S->srcBLen = srcBLen;
+  S->blockSize = blockSize;
+
+  riscv_fir_init_f32(&S->Sfir, srcBLen, pCoeffs, pState, blockSize);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Conv_Stream group
+ */
@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_conv_stream_init_q15.c
+*
+* Description:  Initialization function for the Q15 streaming
+*               convolution.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv_Stream
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 streaming convolution.
+ * @param[in,out] *S          points to an instance of the Q15 streaming convolution structure.
+ * @param[in]     *pSrcB      points to the fixed sequence.
+ * @param[in]     srcBLen     length of the fixed sequence.
+ * @param[out]    *pCoeffs    points to a buffer of <code>numTaps</code> samples that receives the time reversed sequence,
+ * <code>numTaps</code> is <code>srcBLen</code> rounded up to an even value.
+ * @param[in]     *pState     points to the state buffer of <code>numTaps+blockSize-1</code> samples.
+ * @param[in]     blockSize   maximum number of samples that riscv_fir_q15() processes at a time.
+ * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+ * <code>srcBLen</code> or <code>blockSize</code> is 0 or <code>srcBLen</code> is 65535.
+ */
+
+riscv_status riscv_conv_stream_init_q15(
+  riscv_conv_stream_instance_q15 * S,
+  q15_t * pSrcB,
+  uint16_t srcBLen,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_conv_stream_init_q15);
+  uint32_t numTaps = (srcBLen + 1u) & ~1u;       /* Even length of the coefficient array */
+  uint32_t k;
+
+  if((srcBLen == 0u) || (numTaps > 0xFFFFu) || (blockSize == 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* riscv_fir_q15() multiplies pCoeffs[0] with the oldest sample, an odd
+   * sequence gets a leading zero that multiplies a sample older than all taps */
+  pCoeffs[0] = 0;
+  for (k = 0u; k < srcBLen; k++)
+  {
+    pCoeffs[(numTaps - 1u) - k] = pSrcB[k];
+  }
+
+  S->srcBLen = srcBLen;
+  S->blockSize = blockSize;
+
+  return (riscv_fir_init_q15(&S->Sfir, (uint16_t) numTaps, pCoeffs, pState, blockSize));
+}
+
+/**
+ * @} end of Conv_Stream group
+ */
@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_conv_stream_init_q31.c
+*
+* Description:  Initialization function for the Q31 streaming
+*               convolution.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv_Stream
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 streaming convolution.
+ * @param[in,out] *S          points to an instance of the Q31 streaming convolution structure.
+ * @param[in]     *pSrcB      points to the fixed sequence.
+ * @param[in]     srcBLen     length of the fixed sequence.
+ * @param[out]    *pCoeffs    points to a buffer of <code>srcBLen</code> words that receives the time reversed sequence.
+ * @param[in]     *pState     points to the state buffer of <code>srcBLen+blockSize-1</code> words.
+ * @param[in]     blockSize   maximum number of samples that riscv_fir_q31() processes at a time.
+ * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+ * <code>srcBLen</code> or <code>blockSize</code> is 0.
+ */
+
+riscv_status riscv_conv_stream_init_q31(
+  riscv_conv_stream_instance_q31 * S,
+  q31_t * pSrcB,
+  uint16_t srcBLen,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_conv_stream_init_q31);
+  uint32_t k;
+
+  if((srcBLen == 0u) || (blockSize == 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* riscv_fir_q31() multiplies pCoeffs[0] with the oldest sample */
+  for (k = 0u; k < srcBLen; k++)
+  {
+    pCoeffs[k] = pSrcB[(srcBLen - 1u) - k];
+  }
+
+  S->srcBLen = srcBLen;
+  S->blockSize = blockSize;
+
+  riscv_fir_init_q31(&S->Sfir, srcBLen, pCoeffs, pState, blockSize);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Conv_Stream group
+ */
@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_conv_stream_q31.c
+*
+* Description:  Q31 convolution of an unbounded input stream.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Conv_Stream
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 streaming convolution.
+ * @param[in,out] *S      points to an instance of the Q31 streaming convolution structure.
+ * @param[in]     *pSrc   points to the block of input data.
+ * @param[out]    *pDst   points to the block of <code>srcLen</code> output values.
+ * @param[in]     srcLen  number of input samples, any value.
+ * @return none.
+ */
+
+void riscv_conv_stream_q31(
+  riscv_conv_stream_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t srcLen)
+{
+  RISCV_PROFILE(riscv_conv_stream_q31);
+  uint32_t blkLen;                               /* Length of the current piece */
+
+  while(srcLen > 0u)
+  {
+    blkLen = (srcLen < S->blockSize) ? srcLen : S->blockSize;
+
+    riscv_fir_q31(&S->Sfir, pSrc, pDst, blkLen);
+
+    pSrc += blkLen;
+    pDst += blkLen;
+    srcLen -= blkLen;
+  }
+}
+
+/**
+ * @brief Flush function for the Q31 streaming convolution.
+ * @param[in,out] *S     points to an instance of the Q31 streaming convolution structure.
+ * @param[out]    *pDst  points to the block of <code>srcBLen-1</code> output values.
+ * @return none.
+ *
+ * \par
+ * The outputs are those of <code>srcBLen-1</code> zero input samples, with the scaling of riscv_fir_q31().  The state is cleared afterwards.
+ */
+
+void riscv_conv_stream_flush_q31(
+  riscv_conv_stream_instance_q31 * S,
+  q31_t * pDst)
+{
+  RISCV_PROFILE(riscv_conv_stream_flush_q31);
+  q31_t *pState = S->Sfir.pState;                /* Last numTaps - 1 inputs, oldest first */
+  const q31_t *pCoeffs = S->Sfir.pCoeffs;        /* Time reversed sequence */
+  const q31_t *px, *pb;                          /* State and coefficient pointers */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t numTaps = S->Sfir.numTaps;            /* Length of the coefficient array */
+  uint32_t j, k;                                 /* Loop counters */
+
+  /* Output j of the ramp-down only sees the state samples j .. numTaps - 2 */
+  for (j = 0u; j < (S->srcBLen - 1u); j++)
+  {
+    px = pState + j;
+    pb = pCoeffs;
+    sum = 0;
+
+    for (k = (numTaps - 1u) - j; k > 0u; k--)
+    {
+      sum += (q63_t) *px++ * *pb++;
+    }
+
+    pDst[j] = (q31_t) (sum >> 31);
+  }
+
+  memset(pState, 0, (numTaps - 1u) * sizeof(q31_t));
+}
+
+/**
+ * @} end of Conv_Stream group
+ */
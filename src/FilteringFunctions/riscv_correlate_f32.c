@@ -122,6 +122,7 @@ void riscv_correlate_f32(
   uint32_t srcBLen,
   float32_t * pDst)
 {
+  RISCV_PROFILE(riscv_correlate_f32);
 
 
 
@@ -194,7 +195,7 @@ void riscv_correlate_f32(
       if((((i - j) < srcBLen) && (j < srcALen)))
       {
         /* z[i] += x[i-j] * y[j] */
-        sum += pIn1[j] * pIn2[-((int32_t) i - j)];
+        sum += pIn1[j] * pIn2[-((int32_t) i - (int32_t) j)];
       }
     }
     /* Store the output in the destination buffer */
@@ -87,6 +87,7 @@ void riscv_correlate_fast_q31(
   uint32_t srcBLen,
   q31_t * pDst)
 {
+  RISCV_PROFILE(riscv_correlate_fast_q31);
   q31_t *pIn1;                                   /* inputA pointer               */
   q31_t *pIn2;                                   /* inputB pointer               */
   q31_t *pOut = pDst;                            /* output pointer               */
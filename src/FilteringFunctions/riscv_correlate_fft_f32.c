@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_correlate_fft_f32.c
+*
+* Description:  Correlation of floating-point sequences with a direct or
+*               a real FFT based path chosen by size.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Corr
+ * @{
+ */
+
+/**
+* @brief  FFT length used by riscv_correlate_fft_f32() and riscv_correlate_fft_q31().
+* @param[in]  srcALen  length of the first input sequence.
+* @param[in]  srcBLen  length of the second input sequence.
+* @return     length of the real FFT, or 0 if the functions use the direct path.
+*
+* The FFT length is the smallest power of two of at least <code>srcALen+srcBLen-1</code> points, from 32 to 4096.
+* The direct path costs about <code>srcALen*srcBLen</code> multiply-accumulates and the FFT path about
+* <code>RISCV_CORRELATE_FFT_RATIO*fftLen*log2(fftLen)</code>, the FFT path is taken when it is the cheaper one.
+* \par
+* The scratch buffer of the correlation functions is of length <code>3*fftLen</code> words.
+*/
+
+uint32_t riscv_correlate_fft_length(
+  uint32_t srcALen,
+  uint32_t srcBLen)
+{
+  RISCV_PROFILE(riscv_correlate_fft_length);
+  uint32_t outLen = (srcALen + srcBLen) - 1u;    /* Length of the full correlation */
+  uint32_t fftLen = 32u, logLen = 5u;
+
+  if((srcALen == 0u) || (srcBLen == 0u))
+  {
+    return (0u);
+  }
+
+  while(fftLen < outLen)
+  {
+    fftLen <<= 1u;
+    logLen++;
+  }
+
+  /*  Longer correlations are beyond the real FFT, short ones are faster direct */
+  if((fftLen > 4096u) || ((srcALen * srcBLen) <= (RISCV_CORRELATE_FFT_RATIO * fftLen * logLen)))
+  {
+    return (0u);
+  }
+
+  return (fftLen);
+}
+
+/*
+* @brief  Circular correlation of the two zero padded sequences.
+* @param[in]     fftLen     length of the real FFT.
+* @param[in,out] *pScratch  points to a buffer of <code>3*fftLen</code> words, a and b are zero padded in the first two thirds.
+* @return        points to the circular correlation r, lag l is at <code>r[l]</code> and lag -l at <code>r[fftLen-l]</code>.
+*
+* This function is also used by riscv_correlate_fft_q31().
+*/
+
+float32_t * riscv_correlate_fft_core_f32(
+  uint32_t fftLen,
+  float32_t * pScratch)
+{
+  riscv_rfft_fast_instance_f32 S;                /* Real FFT instance */
+  float32_t *pA = pScratch;                      /* Work buffers */
+  float32_t *pB = pA + fftLen;
+  float32_t *pC = pB + fftLen;
+  float32_t ar, ai, br, bi;                      /* Temporary variables */
+  uint32_t k;                                    /* Loop counter */
+
+  riscv_rfft_fast_init_f32(&S, (uint16_t) fftLen);
+
+  /*  The real FFT overwrites its input: A goes to pC, B to pA */
+  riscv_rfft_fast_f32(&S, pA, pC, 0u);
+  riscv_rfft_fast_f32(&S, pB, pA, 0u);
+
+  /*  A * conj(B), DC and Nyquist bins are real and packed in the first pair */
+  pB[0] = pC[0] * pA[0];
+  pB[1] = pC[1] * pA[1];
+
+  for (k = 2u; k < fftLen; k += 2u)
+  {
+    ar = pC[k];
+    ai = pC[k + 1u];
+    br = pA[k];
+    bi = pA[k + 1u];
+
+    pB[k] = (ar * br) + (ai * bi);
+    pB[k + 1u] = (ai * br) - (ar * bi);
+  }
+
+  riscv_rfft_fast_f32(&S, pB, pC, 1u);
+
+  return (pC);
+}
+
+/**
+* @brief Correlation of floating-point sequences, with an FFT path for long sequences.
+* @param[in]  *pSrcA     points to the first input sequence.
+* @param[in]  srcALen    length of the first input sequence.
+* @param[in]  *pSrcB     points to the second input sequence.
+* @param[in]  srcBLen    length of the second input sequence.
+* @param[out] *pDst      points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.
+* @param[in]  *pScratch  points to a scratch buffer of <code>3*riscv_correlate_fft_length(srcALen, srcBLen)</code> words.
+* @return none.
+*
+* The output equals the output of riscv_correlate_f32(), to the rounding of the FFTs, and the same entries
+* of <code>pDst</code> are written.  When riscv_correlate_fft_length() returns 0 the function calls
+* riscv_correlate_f32() and <code>pScratch</code> is not used.
+* \par
+* Otherwise both sequences are zero padded to <code>fftLen</code> points and transformed with riscv_rfft_fast_f32(),
+* the spectrum of <code>pSrcA</code> is multiplied by the conjugate spectrum of <code>pSrcB</code> and transformed back.
+* For 2048 samples against 1024 the FFT path takes three real FFTs of 4096 points instead of two million multiply-accumulates.
+*/
+
+void riscv_correlate_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch)
+{
+  RISCV_PROFILE(riscv_correlate_fft_f32);
+  uint32_t fftLen = riscv_correlate_fft_length(srcALen, srcBLen);
+  uint32_t mid;                                  /* Output index of lag 0 */
+  float32_t *pR;                                 /* Circular correlation */
+
+  if(fftLen == 0u)
+  {
+    riscv_correlate_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+    return;
+  }
+
+  riscv_copy_f32(pSrcA, pScratch, srcALen);
+  riscv_fill_f32(0.0f, pScratch + srcALen, fftLen - srcALen);
+  riscv_copy_f32(pSrcB, pScratch + fftLen, srcBLen);
+  riscv_fill_f32(0.0f, pScratch + fftLen + srcBLen, fftLen - srcBLen);
+
+  pR = riscv_correlate_fft_core_f32(fftLen, pScratch);
+
+  /*  Lag l of sum a[n] * b[n-l] is output max(srcALen, srcBLen) - 1 + l, for l = -(srcBLen-1) ... srcALen-1 */
+  mid = ((srcALen > srcBLen) ? srcALen : srcBLen) - 1u;
+
+  riscv_copy_f32(pR + (fftLen - (srcBLen - 1u)), pDst + (mid - (srcBLen - 1u)), srcBLen - 1u);
+  riscv_copy_f32(pR, pDst + mid, srcALen);
+}
+
+/**
+* @} end of Corr group
+*/
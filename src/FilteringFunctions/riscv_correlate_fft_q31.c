@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_correlate_fft_q31.c
+*
+* Description:  Correlation of Q31 sequences with a direct or a real FFT
+*               based path chosen by size.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+extern float32_t * riscv_correlate_fft_core_f32(
+  uint32_t fftLen,
+  float32_t * pScratch);
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Corr
+ * @{
+ */
+
+/**
+* @brief Correlation of Q31 sequences, with an FFT path for long sequences.
+* @param[in]  *pSrcA     points to the first input sequence.
+* @param[in]  srcALen    length of the first input sequence.
+* @param[in]  *pSrcB     points to the second input sequence.
+* @param[in]  srcBLen    length of the second input sequence.
+* @param[out] *pDst      points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.
+* @param[in]  *pScratch  points to a floating-point scratch buffer of <code>3*riscv_correlate_fft_length(srcALen, srcBLen)</code> words.
+* @return none.
+*
+* The function chooses the path as riscv_correlate_fft_f32().  When riscv_correlate_fft_length() returns 0
+* it calls riscv_correlate_q31() and <code>pScratch</code> is not used.
+*
+* <b>Scaling and Overflow Behavior:</b>
+* \par
+* On the FFT path the inputs are converted to floating-point and correlated by riscv_correlate_fft_f32(),
+* so the accuracy is the 24-bit mantissa of float32_t rather than the 64-bit accumulator of riscv_correlate_q31().
+* The output is converted back to 1.31 format and saturated, where riscv_correlate_q31() wraps around.
+*/
+
+void riscv_correlate_fft_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  float32_t * pScratch)
+{
+  RISCV_PROFILE(riscv_correlate_fft_q31);
+  uint32_t fftLen = riscv_correlate_fft_length(srcALen, srcBLen);
+  uint32_t mid;                                  /* Output index of lag 0 */
+  float32_t *pR;                                 /* Circular correlation */
+
+  if(fftLen == 0u)
+  {
+    riscv_correlate_q31(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+    return;
+  }
+
+  riscv_q31_to_float(pSrcA, pScratch, srcALen);
+  riscv_fill_f32(0.0f, pScratch + srcALen, fftLen - srcALen);
+  riscv_q31_to_float(pSrcB, pScratch + fftLen, srcBLen);
+  riscv_fill_f32(0.0f, pScratch + fftLen + srcBLen, fftLen - srcBLen);
+
+  pR = riscv_correlate_fft_core_f32(fftLen, pScratch);
+
+  /*  Lag l of sum a[n] * b[n-l] is output max(srcALen, srcBLen) - 1 + l, for l = -(srcBLen-1) ... srcALen-1 */
+  mid = ((srcALen > srcBLen) ? srcALen : srcBLen) - 1u;
+
+  riscv_float_to_q31(pR + (fftLen - (srcBLen - 1u)), pDst + (mid - (srcBLen - 1u)), srcBLen - 1u);
+  riscv_float_to_q31(pR, pDst + mid, srcALen);
+}
+
+/**
+* @} end of Corr group
+*/
@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_correlate_partial_f32.c
+*
+* Description:  Partial correlation of floating-point sequences over a range of lags.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup PartialCorr Partial Correlation
+ *
+ * Partial Correlation computes only a range of lags of riscv_correlate_f32(), for example a few lags around zero for delay tracking.
+ * Lag <code>l</code> is the output <code>max(srcALen, srcBLen) - 1 + l</code> of the full correlation:
+ * <pre>
+ *    r[l] = sum of pSrcA[n] * pSrcB[n - l],   n = max(0, l) ... min(srcALen, srcBLen + l) - 1
+ * </pre>
+ * Each function has two additional arguments.
+ * <code>firstLag</code> specifies the first lag and <code>numLags</code> is the number of lags to compute,
+ * the output array <code>pDst</code> contains <code>r[firstLag], ..., r[firstLag+numLags-1]</code>.
+ * \par
+ * Every lag is one dot product of the overlapping parts of the two sequences, so the cost is the sum of the overlaps
+ * of the requested lags and the ramp-up and ramp-down phases of the full correlation are not computed.
+ * \par
+ * The allowable range of lags is [-(srcBLen-1) srcALen-1].
+ * If the requested lags do not fall in this range then the functions return RISCV_MATH_ARGUMENT_ERROR.
+ * Otherwise the functions return RISCV_MATH_SUCCESS.
+ * \note Refer riscv_correlate_f32() for details on fixed point behavior.
+ */
+
+/**
+ * @addtogroup PartialCorr
+ * @{
+ */
+
+/**
+ * @brief Partial correlation of floating-point sequences.
+ * @param[in]  *pSrcA   points to the first input sequence.
+ * @param[in]  srcALen  length of the first input sequence.
+ * @param[in]  *pSrcB   points to the second input sequence.
+ * @param[in]  srcBLen  length of the second input sequence.
+ * @param[out] *pDst    points to the block of <code>numLags</code> output values.
+ * @param[in]  firstLag first lag to compute.
+ * @param[in]  numLags  number of lags to compute.
+ * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested lags are not in the range [-(srcBLen-1) srcALen-1].
+ */
+
+riscv_status riscv_correlate_partial_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  int32_t firstLag,
+  uint32_t numLags)
+{
+  RISCV_PROFILE(riscv_correlate_partial_f32);
+  float32_t *px, *py;                            /* Overlapping parts of the inputs */
+  float32_t sum;                                 /* Accumulator */
+  int32_t lag;                                   /* Current lag */
+  uint32_t nStart, nEnd;                         /* Overlap of the inputs at the current lag */
+  uint32_t i, k;                                 /* Loop counters */
+
+  /* Check for range of lags to be calculated */
+  if((firstLag < (1 - (int32_t) srcBLen)) || (firstLag > (int32_t) srcALen) ||
+     (numLags > (uint32_t) ((int32_t) srcALen - firstLag)))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < numLags; i++)
+  {
+    lag = firstLag + (int32_t) i;
+
+    /* r[lag] = pSrcA[nStart] * pSrcB[nStart - lag] + ... + pSrcA[nEnd - 1] * pSrcB[nEnd - 1 - lag] */
+    nStart = (lag > 0) ? (uint32_t) lag : 0u;
+    nEnd = (((int32_t) srcBLen + lag) < (int32_t) srcALen) ? (uint32_t) ((int32_t) srcBLen + lag) : srcALen;
+
+    px = pSrcA + nStart;
+    py = pSrcB + ((int32_t) nStart - lag);
+    sum = 0.0f;
+
+    /* Loop unrolling.  Compute 4 MACs at a time. */
+    k = (nEnd - nStart) >> 2u;
+
+    while(k > 0u)
+    {
+      sum += px[0] * py[0];
+      sum += px[1] * py[1];
+      sum += px[2] * py[2];
+      sum += px[3] * py[3];
+      px += 4;
+      py += 4;
+      k--;
+    }
+
+    /* Remaining MACs */
+    k = (nEnd - nStart) % 0x4u;
+
+    while(k > 0u)
+    {
+      sum += *px++ * *py++;
+      k--;
+    }
+
+    *pDst++ = sum;
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of PartialCorr group
+ */
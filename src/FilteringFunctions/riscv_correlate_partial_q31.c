@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_correlate_partial_q31.c
+*
+* Description:  Partial correlation of Q31 sequences over a range of lags.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup PartialCorr
+ * @{
+ */
+
+/**
+ * @brief Partial correlation of Q31 sequences.
+ * @param[in]  *pSrcA   points to the first input sequence.
+ * @param[in]  srcALen  length of the first input sequence.
+ * @param[in]  *pSrcB   points to the second input sequence.
+ * @param[in]  srcBLen  length of the second input sequence.
+ * @param[out] *pDst    points to the block of <code>numLags</code> output values.
+ * @param[in]  firstLag first lag to compute.
+ * @param[in]  numLags  number of lags to compute.
+ * @return  Returns either RISCV_MATH_SUCCESS if the function completed correctly or RISCV_MATH_ARGUMENT_ERROR if the requested lags are not in the range [-(srcBLen-1) srcALen-1].
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * As riscv_correlate_q31(), the function uses a 64-bit internal accumulator in 2.62 format with a single guard bit,
+ * the accumulator is right shifted by 31 bits and truncated to 1.31 format.
+ * Scale down one of the inputs by 1/min(srcALen, srcBLen) to avoid overflows.
+ */
+
+riscv_status riscv_correlate_partial_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  int32_t firstLag,
+  uint32_t numLags)
+{
+  RISCV_PROFILE(riscv_correlate_partial_q31);
+  q31_t *px, *py;                                /* Overlapping parts of the inputs */
+  q63_t sum;                                     /* Accumulator */
+  int32_t lag;                                   /* Current lag */
+  uint32_t nStart, nEnd;                         /* Overlap of the inputs at the current lag */
+  uint32_t i, k;                                 /* Loop counters */
+
+  /* Check for range of lags to be calculated */
+  if((firstLag < (1 - (int32_t) srcBLen)) || (firstLag > (int32_t) srcALen) ||
+     (numLags > (uint32_t) ((int32_t) srcALen - firstLag)))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < numLags; i++)
+  {
+    lag = firstLag + (int32_t) i;
+
+    /* r[lag] = pSrcA[nStart] * pSrcB[nStart - lag] + ... + pSrcA[nEnd - 1] * pSrcB[nEnd - 1 - lag] */
+    nStart = (lag > 0) ? (uint32_t) lag : 0u;
+    nEnd = (((int32_t) srcBLen + lag) < (int32_t) srcALen) ? (uint32_t) ((int32_t) srcBLen + lag) : srcALen;
+
+    px = pSrcA + nStart;
+    py = pSrcB + ((int32_t) nStart - lag);
+    sum = 0;
+
+    /* Loop unrolling.  Compute 4 MACs at a time. */
+    k = (nEnd - nStart) >> 2u;
+
+    while(k > 0u)
+    {
+      sum += (q63_t) px[0] * py[0];
+      sum += (q63_t) px[1] * py[1];
+      sum += (q63_t) px[2] * py[2];
+      sum += (q63_t) px[3] * py[3];
+      px += 4;
+      py += 4;
+      k--;
+    }
+
+    /* Remaining MACs */
+    k = (nEnd - nStart) % 0x4u;
+
+    while(k > 0u)
+    {
+      sum += (q63_t) *px++ * *py++;
+      k--;
+    }
+
+    *pDst++ = (q31_t) (sum >> 31u);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of PartialCorr group
+ */
@@ -70,6 +70,11 @@
  * This approach provides 33 guard bits and there is no risk of overflow.   
  * The 34.30 result is then truncated to 34.15 format by discarding the low 15 bits and then saturated to 1.15 format.   
  *   
+ * \par
+ * With the xpulp extensions the products are summed by pairs with <code>pv.dotsp.h</code>, whose
+ * 32-bit sum wraps when both products are 0x8000 * 0x8000, that is when two consecutive
+ * samples of both inputs that are multiplied together are all -1.0.
+ *
  * \par   
  * Refer to <code>riscv_correlate_fast_q15()</code> for a faster but less precise version of this function for Cortex-M3 and Cortex-M4. 
  *
@@ -85,6 +90,7 @@ void riscv_correlate_q15(
   uint32_t srcBLen,
   q15_t * pDst)
 {
+  RISCV_PROFILE(riscv_correlate_q15);
 #if defined (USE_DSP_RISCV)
   q15_t *pIn1;                                   /* inputA pointer               */
   q15_t *pIn2;                                   /* inputB pointer               */
@@ -93,15 +99,14 @@ void riscv_correlate_q15(
   q15_t *px;                                     /* Intermediate inputA pointer  */
   q15_t *py;                                     /* Intermediate inputB pointer  */
   q15_t *pSrc1;                                  /* Intermediate pointers        */
-  q31_t x0, x1, x2, x3, c0;                      /* temporary variables for holding input and coefficient values */
   uint32_t j, k = 0u, count, blkCnt, outBlockSize, blockSize1, blockSize2, blockSize3;  /* loop counter                 */
   int32_t inc = 1;                               /* Destination address modifier */
-  q15_t a, b;
-  shortV VectInA;
-  shortV VectInB;
-  shortV VectInC;
-  shortV VectInD;
-  shortV VectInE;
+  uint32_t tapPairs;                             /* Taps of stage2 computed by pairs */
+  uint32_t offset;                               /* Sample offset of the inputA windows in their words */
+  shortV w0, w1, w2;                             /* Aligned pairs of inputA */
+  shortV xA, xB, xD, xE, c0;                     /* inputA pairs of the four outputs and inputB pair */
+  shortV evenSel, oddSel;                        /* Pairs at the window and one sample after it */
+  q15_t c;                                       /* inputB sample */
   /* The algorithm implementation is based on the lengths of the inputs. */
   /* srcB is always made to slide across srcA. */
   /* So srcBLen is always considered as shorter or equal to srcALen */
@@ -281,6 +286,17 @@ void riscv_correlate_q15(
     /* Loop unroll over blockSize2, by 4 */
     blkCnt = blockSize2 >> 2u;
 
+    /* The windows of four outputs start 4 samples apart, so all of them are at the same offset in
+     * their word.  Each pair of inputA is taken from two aligned loads with one shuffle, the pair at
+     * the window with evenSel and the pair one sample later with oddSel, as in riscv_fir_q15(). */
+    offset = ((uintptr_t) pIn1 & 2u) >> 1u;
+    evenSel = pack2(offset, offset + 1u);
+    oddSel = pack2(offset + 1u, offset + 2u);
+
+    /* Pairs of taps, which read inputA no further than the last sample of the four windows.
+     * The remaining 1 or 2 taps are computed one by one. */
+    tapPairs = (srcBLen - 1u) >> 1u;
+
     while(blkCnt > 0u)
     {
       /* Set all accumulators to zero */
@@ -289,208 +305,79 @@ void riscv_correlate_q15(
       acc2 = 0;
       acc3 = 0;
 
-      /* read x[0], x[1], x[2] samples */
-      a = *px;
-      b = *(px + 1);
+      /* Aligned pointer to the word holding x[count] */
+      px = (pIn1 + count) - offset;
 
-      VectInA[0] = a; /*x0*/
-      VectInA[1] = b; /*x1*/
-      a = *px;
-      VectInB[0] = b; /*x1*/
-      VectInB[1] = a; /*x2*/
+      /* Working pointer of inputB, y[0] */
+      py = pIn2;
 
-      px += 2u;
+      /* Read x[count], x[count + 1] and x[count + 1], x[count + 2] */
+      w0 = *(shortV *) px;
+      w1 = *(shortV *) (px + 2);
+      xA = shufflev4(w0, w1, evenSel);
+      xB = shufflev4(w0, w1, oddSel);
 
-      /* Apply loop unrolling and compute 4 MACs simultaneously. */
-      k = srcBLen >> 2u;
+      k = tapPairs;
 
-      /* First part of the processing with loop unrolling.  Compute 4 MACs at a time.   
-       ** a second loop below computes MACs for the remaining 1 to 3 samples. */
-      do
-      {
-        /* Read the first two inputB samples using SIMD:   
-         * y[0] and y[1] */
-        a = *py;
-        b = *(py + 1);
-
-        VectInC[0] = a; /*y[srcBLen - 1]*/
-        VectInC[1] = b; /*y[srcBLen - 2] */
-
-        /* acc0 +=  x[0] * y[0] + x[1] * y[1] */
-        acc0 += dotpv2(VectInA, VectInC);
-
-        /* acc1 +=  x[1] * y[0] + x[2] * y[1] */
-        acc1 += dotpv2(VectInB, VectInC);
-
-        /* Read x[2], x[3], x[4] */
-        a = *px;
-        b = *(px + 1);
-
-        VectInD[0] = a; /*x2*/
-        VectInD[1] = b; /*x3*/
-        a = *(px + 2);
-        VectInE[0] = b; /*x3*/
-        VectInE[1] = a; /*x4*/
-        /* acc2 +=  x[2] * y[0] + x[3] * y[1] */
-        acc2 += dotpv2(VectInD, VectInC);
-
-        /* acc3 +=  x[3] * y[0] + x[4] * y[1] */
-        acc3 += dotpv2(VectInE, VectInC);
-
-        /* Read y[2] and y[3] */
-        a = *(py + 2);
-        b = *(py + 3);
-        VectInC[0] = a; /*y[srcBLen - 3]*/
-        VectInC[1] = b; /*y[srcBLen - 4] */
-        py += 4u;
-	
-        /* acc0 +=  x[2] * y[2] + x[3] * y[3] */
-        acc0 += dotpv2(VectInD, VectInC);
-
-        /* acc1 +=  x[3] * y[2] + x[4] * y[3] */
-        acc1 += dotpv2(VectInE, VectInC);
-
-        /* Read x[4], x[5], x[6] */
-        a = *(px + 2);
-        b = *(px + 3);
-
-        VectInA[0] = a; /*x4*/
-        VectInA[1] = b; /*x5*/
-        a = *(px + 4);
-        VectInB[0] = b; /*x5*/
-        VectInB[1] = a; /*x6*/
-        px += 4u;
-
-        /* acc2 +=  x[4] * y[2] + x[5] * y[3] */
-        acc2 += dotpv2(VectInA, VectInC);
-
-        /* acc3 +=  x[5] * y[2] + x[6] * y[3] */
-        acc3 += dotpv2(VectInB, VectInC);
-
-      } while(--k);
-
-      /* For the next MAC operations, SIMD is not used   
-       * So, the 16 bit pointer if inputB, py is updated */
-
-      /* If the srcBLen is not a multiple of 4, compute any remaining MACs here.   
-       ** No loop unrolling is used. */
-      k = srcBLen % 0x4u;
-
-      if(k == 1u)
+      while(k > 0u)
       {
-        /* Read y[4] */
-        VectInC[0] = VectInC[1]; 
-        VectInC[1] = 0;
-        /* Read x[7] */
-        a = *px;
-        b = *(px + 1);
-
-        px++;;
-
-        VectInD[0] = a; /*x6*/
-        VectInD[1] = b; /*7*/
-        px++;
-
+        /* Read y[i], y[i + 1] */
+        c0 = pack2(py[0], py[1]);
+        py += 2;
+        /* Read x[count + i + 2], x[count + i + 3] and x[count + i + 3], x[count + i + 4] */
+        w2 = *(shortV *) (px + 4);
+        xD = shufflev4(w1, w2, evenSel);
+        xE = shufflev4(w1, w2, oddSel);
         /* Perform the multiply-accumulates */
-        acc0 += dotpv2(VectInA, VectInC);
-        acc1 += dotpv2(VectInB, VectInC);
-        acc2 += dotpv2(VectInB, VectInC);
-        acc3 += dotpv2(VectInD, VectInC);
-      }
-
-      if(k == 2u)
-      {
-        /* Read y[4], y[5] */
-        a = *py;
-        b = *(py + 1);
-        VectInC[0] = a; 
-        VectInC[1] = b;
-        /* Read x[7], x[8], x[9] */
-        a = *px;
-        b = *(px + 1);
-
-        VectInE[0] = a; /*x7*/
-        VectInE[1] = b; /*x8*/
-        a = *(px + 2);
-        VectInD[0] = b; /*x8*/
-        VectInD[1] = a; /*x9*/
+        acc0 += dotpv2(xA, c0);
+        acc1 += dotpv2(xB, c0);
+        acc2 += dotpv2(xD, c0);
+        acc3 += dotpv2(xE, c0);
+        /* The windows move by two samples */
+        xA = xD;
+        xB = xE;
+        w1 = w2;
         px += 2u;
 
-        /* Perform the multiply-accumulates */
-        acc0 += dotpv2(VectInA, VectInC);
-        acc1 += dotpv2(VectInB, VectInC);
-        acc2 += dotpv2(VectInE, VectInC);
-        acc3 += dotpv2(VectInD, VectInC);
+        /* Decrement the loop counter */
+        k--;
       }
 
-      if(k == 3u)
-      {
-        /* Read y[4], y[5] */
-        a = *py;
-        b = *(py + 1);
-
-        VectInC[0] = a; 
-        VectInC[1] = b;
-        py += 2u;
-
-        /* Read x[7], x[8], x[9] */
-        a = *px;
-        b = *(px + 1);
-
-        VectInE[0] = a; /*x7*/
-        VectInE[1] = b; /*x8*/
-        a = *(px + 2);
-        VectInD[0] = b; /*x8*/
-        VectInD[1] = a; /*x9*/
-        /* Perform the multiply-accumulates */
-        acc0 += dotpv2(VectInA, VectInC);
-        acc1 += dotpv2(VectInB, VectInC);
-        acc2 += dotpv2(VectInE, VectInC);
-        acc3 += dotpv2(VectInD, VectInC);
+      /* Compute the remaining 1 or 2 taps */
+      px = pIn1 + (count + (tapPairs << 1u));
+      k = srcBLen - (tapPairs << 1u);
 
-        VectInC[0] = VectInC[1]; 
-        VectInC[1] = 0;
-
-        /* Read x[10] */
-        b = *(px + 3);
-
-        VectInE[0] = a; /*x9*/
-        VectInE[1] = b; /*x10*/
-        px += 3u;
+      while(k > 0u)
+      {
+        c = *py++;
+        acc0 += (q31_t) px[0] * c;
+        acc1 += (q31_t) px[1] * c;
+        acc2 += (q31_t) px[2] * c;
+        acc3 += (q31_t) px[3] * c;
+        px++;
 
-        /* Perform the multiply-accumulates */
-        acc0 += dotpv2(VectInB, VectInC);
-        acc1 += dotpv2(VectInD, VectInC);
-        acc2 += dotpv2(VectInD, VectInC);
-        acc3 += dotpv2(VectInE, VectInC);
+        /* Decrement the loop counter */
+        k--;
       }
 
-      /* Store the result in the accumulator in the destination buffer. */
-      /**pOut = (q15_t) (acc0 >> 15);*/
+      /* Store the results in the accumulators in the destination buffer.
+       * The destination pointer is updated according to the address modifier, inc */
       *pOut = (q15_t) __SSAT((acc0 >> 15u), 16u);
-      /* Destination pointer is updated according to the address modifier, inc */
       pOut += inc;
-
-     /**pOut = (q15_t) (acc1 >> 15);*/
       *pOut = (q15_t) __SSAT((acc1 >> 15u), 16u);
       pOut += inc;
-
-     /* *pOut = (q15_t) (acc2 >> 15);*/
       *pOut = (q15_t) __SSAT((acc2 >> 15u), 16u);
       pOut += inc;
-
-    /*  *pOut = (q15_t) (acc3 >> 15);*/
       *pOut = (q15_t) __SSAT((acc3 >> 15u), 16u);
       pOut += inc;
 
-      /* Increment the pointer pIn1 index, count by 1 */
+      /* Increment the pointer pIn1 index, count by 4 */
       count += 4u;
 
       /* Update the inputA and inputB pointers for next MAC calculation */
       px = pIn1 + count;
       py = pIn2;
 
-
       /* Decrement the loop counter */
       blkCnt--;
     }
@@ -741,7 +628,7 @@ void riscv_correlate_q15(
       if((((i - j) < srcBLen) && (j < srcALen)))
       {
         /* z[i] += x[i-j] * y[j] */
-        sum += ((q31_t) pIn1[j] * pIn2[-((int32_t) i - j)]);
+        sum += ((q31_t) pIn1[j] * pIn2[-((int32_t) i - (int32_t) j)]);
       }
     }
     /* Store the output in the destination buffer */
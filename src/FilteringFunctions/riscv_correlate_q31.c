@@ -84,6 +84,7 @@ void riscv_correlate_q31(
   uint32_t srcBLen,
   q31_t * pDst)
 {
+  RISCV_PROFILE(riscv_correlate_q31);
 
   q31_t *pIn1 = pSrcA;                           /* inputA pointer               */
   q31_t *pIn2 = pSrcB + (srcBLen - 1u);          /* inputB pointer               */
@@ -154,7 +155,7 @@ void riscv_correlate_q31(
       if((((i - j) < srcBLen) && (j < srcALen)))
       {
         /* z[i] += x[i-j] * y[j] */
-        sum += ((q63_t) pIn1[j] * pIn2[-((int32_t) i - j)]);
+        sum += ((q63_t) pIn1[j] * pIn2[-((int32_t) i - (int32_t) j)]);
       }
     }
     /* Store the output in the destination buffer */
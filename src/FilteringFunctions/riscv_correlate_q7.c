@@ -82,6 +82,7 @@ void riscv_correlate_q7(
   uint32_t srcBLen,
   q7_t * pDst)
 {
+  RISCV_PROFILE(riscv_correlate_q7);
 
 
 
@@ -96,9 +97,7 @@ void riscv_correlate_q7(
   q7_t *py;                                      /* Intermediate inputB pointer  */
   q7_t *pSrc1;                                   /* Intermediate pointers        */
   q31_t sum, acc0, acc1, acc2, acc3;             /* Accumulators                  */
-  q31_t input1, input2;                          /* temporary variables */
-  q15_t in1, in2, in3, in4;                                /* temporary variables */
-  q7_t x0, x1, x2, x3, c0, c1;                   /* temporary variables for holding input and coefficient values */
+  q7_t x0, x1, x2, x3, c0;                       /* temporary variables for holding input and coefficient values */
   uint32_t j, k = 0u, count, blkCnt, outBlockSize, blockSize1, blockSize2, blockSize3;  /* loop counter                 */
   int32_t inc = 1;
   charV VectInacc0A;
@@ -108,6 +107,8 @@ void riscv_correlate_q7(
   charV *VectInB;
   charV *VectInC;
   charV *VectInD;
+  charV win1 = {1, 2, 3, 5};                    /* x[1] to x[4] out of x[0..3] and x[3..6] */
+  charV win2 = {2, 3, 5, 6};                    /* x[2] to x[5] out of x[0..3] and x[3..6] */
 
 
   /* The algorithm implementation is based on the lengths of the inputs. */
@@ -295,97 +296,42 @@ void riscv_correlate_q7(
       acc2 = 0;
       acc3 = 0;
 
-      /* read x[0], x[1], x[2] samples */
-      x0 = *px++;
-      x1 = *px++;
-      x2 = *px++;
-
-      /* Apply loop unrolling and compute 4 MACs simultaneously. */
+      /* Apply loop unrolling and compute 4 MACs of each of the 4 outputs at a time.
+       ** The outputs start at x[0], x[1], x[2] and x[3]: two word loads hold x[0] to x[3]
+       ** and x[3] to x[6], the windows in between are shuffled from them. */
       k = srcBLen >> 2u;
 
-      /* First part of the processing with loop unrolling.  Compute 4 MACs at a time.   
-       ** a second loop below computes MACs for the remaining 1 to 3 samples. */
       do
       {
+        /* y[0] to y[3] */
+        VectInB = (charV *) py;
+        py += 4;
 
-        /* Read x[3] sample */
-        x3 = *px++;
-
-        /* x[0] and x[1] are packed */
-        in1 = (q15_t) x0;
-        in2 = (q15_t) x1;
-
-        VectInB = (charV*)py;
-        py+=4;
-         /*input2 = ((q31_t) in1 & 0x0000FFFF) | ((q31_t) in2 << 16);*/
-        VectInacc0A[0] = in1;
-        VectInacc0A[1] = in2;
-
-        /* x[1] and x[2] are packed */
-        in1 = (q15_t) x1;
-        in2 = (q15_t) x2;
-        VectInacc1A[0] = in1;
-        VectInacc1A[1] = in2;
-        /* x[2] and x[3] are packed */
-        in1 = (q15_t) x2;
-        in2 = (q15_t) x3;
-        VectInacc2A[0] = in1;
-        VectInacc2A[1] = in2;
-
-        /* Read x[4] sample */
-        x0 = *(px++);
-
-        /* x[3] and x[4] are packed */
-        in1 = (q15_t) x3;
-        in2 = (q15_t) x0;
-        VectInacc3A[0] = in1;
-        VectInacc3A[1] = in2;
-
+        /* x[0] to x[3] and x[3] to x[6] */
+        VectInacc0A = *(charV *) px;
+        VectInacc3A = *(charV *) (px + 3);
+        px += 4;
 
-        x1 = *px++;
-
-        /* x[2] and x[3] are packed */
-        in1 = (q15_t) x2;
-        in2 = (q15_t) x3;
-        VectInacc0A[2] = in1;
-        VectInacc0A[3] = in2;
-
-
-        /* y[2] and y[3] are packed */
-
-        /* acc0 += x[2] * y[2] + x[3] * y[3]  */
+        /* x[1] to x[4] and x[2] to x[5] */
+        VectInacc1A = shuffle2b(VectInacc0A, VectInacc3A, win1);
+        VectInacc2A = shuffle2b(VectInacc0A, VectInacc3A, win2);
 
+        /* acc0 += x[0] * y[0] + ... + x[3] * y[3] */
         acc0 = sumdotpv4(VectInacc0A, *VectInB, acc0);
-        /* x[3] and x[4] are packed */
-        in1 = (q15_t) x3;
-        in2 = (q15_t) x0;
-        VectInacc1A[2] = in1;
-        VectInacc1A[3] = in2;
-
-
-        /* acc1 += x[3] * y[2] + x[4] * y[3]  */
-
+        /* acc1 += x[1] * y[0] + ... + x[4] * y[3] */
         acc1 = sumdotpv4(VectInacc1A, *VectInB, acc1);
-        /* x[4] and x[5] are packed */
-        in1 = (q15_t) x0;
-        in2 = (q15_t) x1;
-        VectInacc2A[2] = in1;
-        VectInacc2A[3] = in2;
-        /* acc2 += x[4] * y[2] + x[5] * y[3]  */
+        /* acc2 += x[2] * y[0] + ... + x[5] * y[3] */
         acc2 = sumdotpv4(VectInacc2A, *VectInB, acc2);
-        /* Read x[6] sample */
-        x2 = *px++;
-
-        /* x[5] and x[6] are packed */
-        in1 = (q15_t) x1;
-        in2 = (q15_t) x2;
-        VectInacc3A[2] = in1;
-        VectInacc3A[3] = in2;
-
-        /* acc3 += x[5] * y[2] + x[6] * y[3]  */
+        /* acc3 += x[3] * y[0] + ... + x[6] * y[3] */
         acc3 = sumdotpv4(VectInacc3A, *VectInB, acc3);
+
       } while(--k);
 
+      /* read x[0], x[1], x[2] samples of the remaining MACs */
+      x0 = *(px++);
+      x1 = *(px++);
+      x2 = *(px++);
+
       /* If the srcBLen is not a multiple of 4, compute any remaining MACs here.   
        ** No loop unrolling is used. */
       k = srcBLen % 0x4u;
@@ -683,7 +629,7 @@ void riscv_correlate_q7(
       if((((i - j) < srcBLen) && (j < srcALen)))
       {
         /* z[i] += x[i-j] * y[j] */
-        sum += ((q15_t) pIn1[j] * pIn2[-((int32_t) i - j)]);
+        sum += ((q15_t) pIn1[j] * pIn2[-((int32_t) i - (int32_t) j)]);
       }
     }
     /* Store the output in the destination buffer */
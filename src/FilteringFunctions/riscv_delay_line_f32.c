@@ -0,0 +1,165 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_delay_line_f32.c
+*
+* Description:  Floating-point delay line with Farrow fractional taps.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup DelayLine Fractional Delay Line
+ *
+ * \par
+ * A delay line keeps the last <code>length</code> input samples and reads them back through taps of any
+ * real delay, as needed for the steering of a delay-and-sum beamformer, chorus and flanger effects or
+ * the alignment of sensor channels.  riscv_delay_line_write_f32() appends a block and
+ * riscv_delay_line_read_f32() reads the same block back through <code>numTaps</code> taps:
+ * <pre>
+ *     pDst[n] = sum gain_t * x(T + n - delay_t(n))
+ * </pre>
+ * where <code>T</code> is the time of the first sample of the block.  The delay of a tap ramps linearly
+ * from <code>delay</code> to <code>target</code> over the block, so steering updates cause no
+ * discontinuities; after the read <code>delay</code> equals <code>target</code>.
+ *
+ * \par
+ * Fractional delays use cubic Lagrange interpolation on the four samples around the delay, evaluated in
+ * the Farrow structure: three fixed 4-tap filters give the polynomial coefficients
+ * <pre>
+ *     c0 = x[0]
+ *     c1 = -x[-1]/3 - x[0]/2 + x[1] - x[2]/6
+ *     c2 = (x[-1] + x[1])/2 - x[0]
+ *     c3 = (x[0] - x[1])/2 + (x[2] - x[-1])/6
+ * </pre>
+ * where <code>x[k]</code> is the sample <code>k</code> steps older than the integer part of the delay, and
+ * the output is <code>((c3*f + c2)*f + c1)*f + c0</code> for the fraction <code>f</code>.  Integer delays
+ * return the stored samples unchanged.
+ *
+ * \par
+ * Every sample is written twice, at its slot and at its slot plus <code>length</code>, so the four samples
+ * of a tap are always contiguous.  The delays of all taps must stay within
+ * <code>[1, length - blockSize - 3]</code>.
+ *
+ * \par
+ * The Q15 line takes delays in 16.15 format and Farrow filters in Q14.  With the DSP extension each of them
+ * is a <code>dotp2</code> and a <code>sumdotp2</code> over the samples loaded as two pairs.
+ */
+
+/**
+ * @addtogroup DelayLine
+ * @{
+ */
+
+/**
+ * @brief  Appends a block of samples to the floating-point fractional delay line.
+ * @param[in,out] *S          points to an instance of the floating-point delay line structure.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[in]     blockSize   number of samples to append.
+ * @return none.
+ */
+
+void riscv_delay_line_write_f32(
+  riscv_delay_line_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_delay_line_write_f32);
+  float32_t *pState = S->pState;                 /* State pointer */
+  uint32_t len = S->length;                      /* Length of the circular buffer */
+  uint32_t wrIndex = S->writeIndex;              /* Write index of the circular buffer */
+  float32_t x;
+  uint32_t n;
+
+  /* Write the new samples and their mirror copies */
+  for (n = 0u; n < blockSize; n++)
+  {
+    x = pSrc[n];
+    pState[wrIndex] = x;
+    pState[wrIndex + len] = x;
+
+    wrIndex++;
+    if(wrIndex == len)
+    {
+      wrIndex = 0u;
+    }
+  }
+
+  S->writeIndex = (uint16_t) wrIndex;
+}
+
+/**
+ * @brief  Reads the last block written to the floating-point fractional delay line through a set of taps.
+ * @param[in]     *S          points to an instance of the floating-point delay line structure.
+ * @param[in,out] *pTaps      points to the taps, their delays move to their targets.
+ * @param[in]     numTaps     number of taps.
+ * @param[out]    *pDst       points to the block of output data, the weighted sum of the taps.
+ * @param[in]     blockSize   number of samples to read, the size of the last block written.
+ * @return none.
+ */
+
+void riscv_delay_line_read_f32(
+  const riscv_delay_line_instance_f32 * S,
+  riscv_delay_line_tap_f32 * pTaps,
+  uint16_t numTaps,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_delay_line_read_f32);
+  const float32_t *pX;                           /* Oldest of the four samples of a tap */
+  float32_t d, step, gain, f;                    /* Delay, its increment, weight and fraction */
+  float32_t xm, x0, x1, x2;                      /* Samples x[-1] to x[2] around the delay */
+  float32_t c1, c2, c3, y;                       /* Farrow coefficients and interpolated sample */
+  uint32_t len = S->length;                      /* Length of the circular buffer */
+  uint32_t first;                                /* Slot of the first sample of the block */
+  uint32_t pos, i, n, t;
+
+  first = (S->writeIndex + len) - blockSize;
+  first = (first >= len) ? first - len : first;
+
+  for (t = 0u; t < numTaps; t++)
+  {
+    d = pTaps[t].delay;
+    step = (pTaps[t].target - d) / (float32_t) blockSize;
+    gain = pTaps[t].gain;
+
+    for (n = 0u; n < blockSize; n++)
+    {
+      i = (uint32_t) d;
+      f = d - (float32_t) i;
+
+      /* Slot of the sample i + 2 older than the output sample */
+      pos = ((first + n) + len) - (i + 2u);
+      pos = (pos >= len) ? pos - len : pos;
+      pos = (pos >= len) ? pos - len : pos;
+      pX = S->pState + pos;
+
+      x2 = pX[0];
+      x1 = pX[1];
+      x0 = pX[2];
+      xm = pX[3];
+
+      /* Farrow filters of the cubic Lagrange interpolator */
+      c1 = (x1 - (0.5f * x0)) - (0.333333333f * xm) - (0.166666667f * x2);
+      c2 = (0.5f * (xm + x1)) - x0;
+      c3 = (0.5f * (x0 - x1)) + (0.166666667f * (x2 - xm));
+
+      y = (((((c3 * f) + c2) * f) + c1) * f) + x0;
+
+      pDst[n] = (t == 0u) ? gain * y : pDst[n] + (gain * y);
+
+      d += step;
+    }
+
+    pTaps[t].delay = pTaps[t].target;
+  }
+}
+
+/**
+ * @} end of DelayLine group
+ */
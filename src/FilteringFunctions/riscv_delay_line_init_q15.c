@@ -0,0 +1,56 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_delay_line_init_q15.c
+*
+* Description:  Initialization function for the Q15 fractional delay line.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup DelayLine
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 fractional delay line.
+ * @param[out] *S       points to an instance of the Q15 delay line structure.
+ * @param[in]  length   number of samples the line holds, at least the largest delay plus the block size plus 3.
+ * @param[in]  *pState  points to the state buffer of <code>2*length</code> samples.
+ * @return     The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>length</code> is below 4.
+ *
+ * \par Description:
+ * The line is cleared, reads of delays beyond the samples written so far return zeros.
+ */
+
+riscv_status riscv_delay_line_init_q15(
+  riscv_delay_line_instance_q15 * S,
+  uint16_t length,
+  q15_t * pState)
+{
+  RISCV_PROFILE(riscv_delay_line_init_q15);
+
+  if(length < 4u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->length = length;
+  S->writeIndex = 0u;
+  S->pState = pState;
+
+  /*  Clear the buffer and its mirror */
+  riscv_fill_q15(0, pState, 2u * (uint32_t) length);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of DelayLine group
+ */
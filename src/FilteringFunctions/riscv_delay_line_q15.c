@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_delay_line_q15.c
+*
+* Description:  Q15 delay line with Farrow fractional taps.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* 1, 1/2, 1/3 and 1/6 in Q14, the weights of the Farrow filters */
+#define RISCV_FARROW_ONE_Q14    16384
+#define RISCV_FARROW_HALF_Q14   8192
+#define RISCV_FARROW_THIRD_Q14  5461
+#define RISCV_FARROW_SIXTH_Q14  2731
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup DelayLine
+ * @{
+ */
+
+/**
+ * @brief  Appends a block of samples to the Q15 fractional delay line.
+ * @param[in,out] *S          points to an instance of the Q15 delay line structure.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[in]     blockSize   number of samples to append.
+ * @return none.
+ */
+
+void riscv_delay_line_write_q15(
+  riscv_delay_line_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_delay_line_write_q15);
+  q15_t *pState = S->pState;                     /* State pointer */
+  uint32_t len = S->length;                      /* Length of the circular buffer */
+  uint32_t wrIndex = S->writeIndex;              /* Write index of the circular buffer */
+  q15_t x;
+  uint32_t n;
+
+  /* Write the new samples and their mirror copies */
+  for (n = 0u; n < blockSize; n++)
+  {
+    x = pSrc[n];
+    pState[wrIndex] = x;
+    pState[wrIndex + len] = x;
+
+    wrIndex++;
+    if(wrIndex == len)
+    {
+      wrIndex = 0u;
+    }
+  }
+
+  S->writeIndex = (uint16_t) wrIndex;
+}
+
+/**
+ * @brief  Reads the last block written to the Q15 fractional delay line through a set of taps.
+ * @param[in]     *S          points to an instance of the Q15 delay line structure.
+ * @param[in,out] *pTaps      points to the taps, their delays move to their targets.
+ * @param[in]     numTaps     number of taps.
+ * @param[out]    *pDst       points to the block of output data, the weighted sum of the taps.
+ * @param[in]     blockSize   number of samples to read, the size of the last block written.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The Farrow filters accumulate Q15 samples times Q14 weights in 32 bits and keep the coefficients in Q15,
+ * the polynomial in the 15-bit fraction is evaluated with 64-bit products.  The weighted taps are added to
+ * the output one after the other with saturation to Q15.
+ */
+
+void riscv_delay_line_read_q15(
+  const riscv_delay_line_instance_q15 * S,
+  riscv_delay_line_tap_q15 * pTaps,
+  uint16_t numTaps,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_delay_line_read_q15);
+  const q15_t *pX;                               /* Oldest of the four samples of a tap */
+  q31_t d, step, f;                              /* Delay, its increment and fraction */
+  q31_t c1, c2, c3, y;                           /* Farrow coefficients and interpolated sample */
+  q15_t gain;                                    /* Weight of the tap */
+  uint32_t len = S->length;                      /* Length of the circular buffer */
+  uint32_t first;                                /* Slot of the first sample of the block */
+  uint32_t pos, i, n, t;
+
+#if defined (USE_DSP_RISCV)
+  shortV VectOld, VectNew;                       /* Samples x[2] x[1] and x[0] x[-1] */
+  shortV c1Old = pack2(-RISCV_FARROW_SIXTH_Q14, RISCV_FARROW_ONE_Q14);
+  shortV c1New = pack2(-RISCV_FARROW_HALF_Q14, -RISCV_FARROW_THIRD_Q14);
+  shortV c2Old = pack2(0, RISCV_FARROW_HALF_Q14);
+  shortV c2New = pack2(-RISCV_FARROW_ONE_Q14, RISCV_FARROW_HALF_Q14);
+  shortV c3Old = pack2(RISCV_FARROW_SIXTH_Q14, -RISCV_FARROW_HALF_Q14);
+  shortV c3New = pack2(RISCV_FARROW_HALF_Q14, -RISCV_FARROW_SIXTH_Q14);
+#else
+  q31_t xm, x0, x1, x2;                          /* Samples x[-1] to x[2] around the delay */
+#endif
+
+  first = (S->writeIndex + len) - blockSize;
+  first = (first >= len) ? first - len : first;
+
+  for (t = 0u; t < numTaps; t++)
+  {
+    d = pTaps[t].delay;
+    step = (pTaps[t].target - d) / (q31_t) blockSize;
+    gain = pTaps[t].gain;
+
+    for (n = 0u; n < blockSize; n++)
+    {
+      i = (uint32_t) d >> 15u;
+      f = d & 0x7FFF;
+
+      /* Slot of the sample i + 2 older than the output sample */
+      pos = ((first + n) + len) - (i + 2u);
+      pos = (pos >= len) ? pos - len : pos;
+      pos = (pos >= len) ? pos - len : pos;
+      pX = S->pState + pos;
+
+      /* Farrow filters of the cubic Lagrange interpolator, Q15 times Q14 */
+#if defined (USE_DSP_RISCV)
+
+      VectOld = *(shortV *) pX;
+      VectNew = *(shortV *) (pX + 2);
+
+      c1 = sumdotpv2(VectNew, c1New, dotpv2(VectOld, c1Old)) >> 14;
+      c2 = sumdotpv2(VectNew, c2New, dotpv2(VectOld, c2Old)) >> 14;
+      c3 = sumdotpv2(VectNew, c3New, dotpv2(VectOld, c3Old)) >> 14;
+
+#else
+
+      x2 = pX[0];
+      x1 = pX[1];
+      x0 = pX[2];
+      xm = pX[3];
+
+      c1 = ((RISCV_FARROW_ONE_Q14 * x1) - (RISCV_FARROW_HALF_Q14 * x0) -
+            (RISCV_FARROW_THIRD_Q14 * xm) - (RISCV_FARROW_SIXTH_Q14 * x2)) >> 14;
+      c2 = ((RISCV_FARROW_HALF_Q14 * (xm + x1)) - (RISCV_FARROW_ONE_Q14 * x0)) >> 14;
+      c3 = ((RISCV_FARROW_HALF_Q14 * (x0 - x1)) + (RISCV_FARROW_SIXTH_Q14 * (x2 - xm))) >> 14;
+
+#endif
+
+      y = (q31_t) (((q63_t) c3 * f) >> 15) + c2;
+      y = (q31_t) (((q63_t) y * f) >> 15) + c1;
+      y = (q31_t) (((q63_t) y * f) >> 15) + pX[2];
+      y = (y * gain) >> 15;
+
+      pDst[n] = (q15_t) __SSAT((t == 0u) ? y : pDst[n] + y, 16);
+
+      d += step;
+    }
+
+    pTaps[t].delay = pTaps[t].target;
+  }
+}
+
+/**
+ * @} end of DelayLine group
+ */
@@ -0,0 +1,177 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dynamics_f32.c
+*
+* Description:  Floating-point dynamics processor: envelope follower,
+*               compressor, limiter and AGC.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Dynamics Dynamics Processing
+ *
+ * Compressor, limiter and automatic gain control in one block.  Each call walks the input once per
+ * sub-block of RISCV_DYNAMICS_SUBBLOCK samples and does, for that sub-block:
+ *
+ * - level detection: the largest magnitude (RISCV_DYNAMICS_PEAK) or the mean square (RISCV_DYNAMICS_RMS);
+ * - envelope following: <code>env += c * (level - env)</code> with the attack coefficient when the level
+ *   rises and the release coefficient when it falls;
+ * - gain computation in the logarithmic domain:
+ * <pre>
+ *     g = makeupGain * min(maxGain, (threshold / env)^(1 - 1/ratio))
+ * </pre>
+ *   with the magnitude envelope, the square root of the mean square one;
+ * - gain application: the gain ramps linearly from the previous value to <code>g</code> over the sub-block
+ *   and multiplies the input delayed by <code>lookahead</code> samples.
+ *
+ * \par
+ * The parameters select the function:
+ * - compressor: <code>threshold</code>, <code>ratio</code> above 1, <code>maxGain = 1</code>;
+ * - limiter: <code>ratio = 0</code> (infinite), <code>maxGain = 1</code>, peak detector, attack time 0 and a
+ *   <code>lookahead</code> of at least RISCV_DYNAMICS_SUBBLOCK, so the gain has fallen when a peak leaves the
+ *   delay line;
+ * - AGC: <code>threshold</code> is the target level, <code>ratio = 0</code> and <code>maxGain</code> bounds the
+ *   amplification of quiet input.
+ *
+ * \par
+ * Attack and release times are the time constants of the envelope in samples.  They are converted to one-pole
+ * coefficients for one update per sub-block, so times shorter than RISCV_DYNAMICS_SUBBLOCK act as 0.
+ * The logarithm and exponential of the gain computer are those of riscv_vlog_f32() and riscv_vexp_f32(),
+ * respectively riscv_vlog_q31() and riscv_vexp_q31(), once per sub-block.
+ *
+ * \par
+ * The Q15 processor keeps the envelope in Q31 and the gain in 8.23 format, so
+ * <code>maxGain * makeupGain</code> must stay below 256.  With the DSP extension its peak detector takes the
+ * largest and smallest sample of each sub-block with <code>max2</code> and <code>min2</code> and the mean
+ * square detector uses <code>dotp2</code>, <code>pSrc</code> must then be 4-byte aligned.
+ */
+
+/**
+ * @addtogroup Dynamics
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point dynamics processor.
+ * @param[in,out] *S          points to an instance of the floating-point dynamics structure.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[out]    *pDst       points to the block of output data, may be <code>pSrc</code>.
+ * @param[in]     blockSize   number of samples to process.
+ * @return none.
+ */
+
+void riscv_dynamics_f32(
+  riscv_dynamics_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_dynamics_f32);
+  float32_t *pIn = pSrc;                         /* Input pointer */
+  float32_t *pOut = pDst;                        /* Output pointer */
+  float32_t *pDelay = S->pDelay;                 /* Lookahead delay line */
+  float32_t env = S->env;                        /* Envelope */
+  float32_t gain = S->gain;                      /* Gain of the last output sample */
+  float32_t level, target, step, logGain, x, y;  /* Detector, gain computer and ramp */
+  uint32_t lookahead = S->lookahead;             /* Length of the delay line */
+  uint32_t idx = S->delayIndex;                  /* Oldest sample of the delay line */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+  uint32_t n, k;                                 /* Sub-block length and index */
+
+  while(blkCnt > 0u)
+  {
+    n = (blkCnt < RISCV_DYNAMICS_SUBBLOCK) ? blkCnt : RISCV_DYNAMICS_SUBBLOCK;
+
+    /* Level of the sub-block */
+    level = 0.0f;
+
+    if(S->detector == RISCV_DYNAMICS_PEAK)
+    {
+      for (k = 0u; k < n; k++)
+      {
+        x = fabsf(pIn[k]);
+        level = (x > level) ? x : level;
+      }
+    }
+    else
+    {
+      for (k = 0u; k < n; k++)
+      {
+        level += pIn[k] * pIn[k];
+      }
+      level /= (float32_t) n;
+    }
+
+    /* Envelope, attack while the level rises */
+    env += ((level > env) ? S->attackCoef : S->releaseCoef) * (level - env);
+
+    /* Gain computer, levels below 1e-30 (denormals included) take the largest gain */
+    if(env > 1.0e-30f)
+    {
+      riscv_vlog_f32(&env, &logGain, 1u);
+
+      if(S->detector == RISCV_DYNAMICS_RMS)
+      {
+        logGain *= 0.5f;
+      }
+
+      logGain = S->slope * (S->thresholdLog - logGain);
+      logGain = (logGain < S->maxGainLog) ? logGain : S->maxGainLog;
+    }
+    else
+    {
+      logGain = S->maxGainLog;
+    }
+
+    logGain += S->makeupLog;
+    riscv_vexp_f32(&logGain, &target, 1u);
+
+    /* Gain ramp over the sub-block, applied to the delayed input */
+    step = (target - gain) / (float32_t) n;
+
+    if(lookahead == 0u)
+    {
+      for (k = 0u; k < n; k++)
+      {
+        gain += step;
+        pOut[k] = pIn[k] * gain;
+      }
+    }
+    else
+    {
+      for (k = 0u; k < n; k++)
+      {
+        gain += step;
+        x = pIn[k];
+        y = pDelay[idx];
+        pDelay[idx] = x;
+        pOut[k] = y * gain;
+
+        idx = (idx + 1u == lookahead) ? 0u : idx + 1u;
+      }
+    }
+
+    gain = target;
+    pIn += n;
+    pOut += n;
+
+    /* Decrement the loop counter */
+    blkCnt -= n;
+  }
+
+  S->env = env;
+  S->gain = gain;
+  S->delayIndex = (uint16_t) idx;
+}
+
+/**
+ * @} end of Dynamics group
+ */
@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dynamics_init_f32.c
+*
+* Description:  Initialization function for the floating-point dynamics
+*               processor.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Dynamics
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point dynamics processor.
+ * @param[out] *S            points to an instance of the floating-point dynamics structure.
+ * @param[in]  detector      level detector.
+ * @param[in]  threshold     level above which the gain falls, the target level of an AGC.
+ * @param[in]  ratio         compression ratio, 1 or more, 0 for an infinite ratio.
+ * @param[in]  maxGain       largest gain before makeup, 1 for a compressor or limiter.
+ * @param[in]  makeupGain    gain applied on top of the computed one.
+ * @param[in]  attackTime    time constant of the envelope when the level rises, in samples.
+ * @param[in]  releaseTime   time constant of the envelope when the level falls, in samples.
+ * @param[in]  lookahead     delay of the output in samples.
+ * @param[in]  *pDelay       points to the delay line of <code>lookahead</code> samples, NULL if it is 0.
+ * @return     The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if a level or gain is not
+ * positive, <code>ratio</code> is between 0 and 1, a time is negative or the delay line is missing.
+ *
+ * \par Description:
+ * The envelope and the delay line are cleared and the gain starts at <code>maxGain * makeupGain</code>,
+ * the gain of silence.  See the \ref Dynamics group for the parameters of a compressor, limiter and AGC.
+ */
+
+riscv_status riscv_dynamics_init_f32(
+  riscv_dynamics_instance_f32 * S,
+  riscv_dynamics_detector detector,
+  float32_t threshold,
+  float32_t ratio,
+  float32_t maxGain,
+  float32_t makeupGain,
+  float32_t attackTime,
+  float32_t releaseTime,
+  uint16_t lookahead,
+  float32_t * pDelay)
+{
+  RISCV_PROFILE(riscv_dynamics_init_f32);
+
+  if(((detector != RISCV_DYNAMICS_PEAK) && (detector != RISCV_DYNAMICS_RMS)) ||
+     (threshold <= 0.0f) || (maxGain <= 0.0f) || (makeupGain <= 0.0f) ||
+     ((ratio != 0.0f) && (ratio < 1.0f)) || (attackTime < 0.0f) || (releaseTime < 0.0f) ||
+     ((lookahead != 0u) && (pDelay == NULL)))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->detector = detector;
+  S->lookahead = lookahead;
+  S->delayIndex = 0u;
+
+  /*  One-pole coefficients for one envelope update per sub-block */
+  S->attackCoef = (attackTime > 0.0f) ? 1.0f - expf(-(float32_t) RISCV_DYNAMICS_SUBBLOCK / attackTime) : 1.0f;
+  S->releaseCoef = (releaseTime > 0.0f) ? 1.0f - expf(-(float32_t) RISCV_DYNAMICS_SUBBLOCK / releaseTime) : 1.0f;
+
+  S->thresholdLog = logf(threshold);
+  S->slope = (ratio == 0.0f) ? 1.0f : 1.0f - 1.0f / ratio;
+  S->maxGainLog = logf(maxGain);
+  S->makeupLog = logf(makeupGain);
+
+  S->env = 0.0f;
+  S->gain = maxGain * makeupGain;
+  S->pDelay = pDelay;
+
+  /*  Clear the delay line */
+  if(lookahead != 0u)
+  {
+    riscv_fill_f32(0.0f, pDelay, lookahead);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Dynamics group
+ */
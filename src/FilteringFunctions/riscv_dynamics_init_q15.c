@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dynamics_init_q15.c
+*
+* Description:  Initialization function for the Q15 dynamics processor.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/* x * 2^scale rounded, saturated to Q31 */
+static q31_t riscv_dynamics_fixed(
+  float64_t x,
+  float64_t scale)
+{
+  x = floor(x * scale + 0.5);
+
+  return ((x >= 2147483647.0) ? 0x7FFFFFFF : (q31_t) x);
+}
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Dynamics
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 dynamics processor.
+ * @param[out] *S            points to an instance of the Q15 dynamics structure.
+ * @param[in]  detector      level detector.
+ * @param[in]  threshold     level above which the gain falls, the target level of an AGC, relative to full scale.
+ * @param[in]  ratio         compression ratio, 1 or more, 0 for an infinite ratio.
+ * @param[in]  maxGain       largest gain before makeup, 1 for a compressor or limiter.
+ * @param[in]  makeupGain    gain applied on top of the computed one.
+ * @param[in]  attackTime    time constant of the envelope when the level rises, in samples.
+ * @param[in]  releaseTime   time constant of the envelope when the level falls, in samples.
+ * @param[in]  lookahead     delay of the output in samples.
+ * @param[in]  *pDelay       points to the delay line of <code>lookahead</code> samples, NULL if it is 0.
+ * @return     The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>threshold</code> is
+ * above 1, it or a gain is not above 2^-31, <code>maxGain * makeupGain</code> is 256 or more,
+ * <code>ratio</code> is between 0 and 1, a time is negative or the delay line is missing.
+ *
+ * \par Description:
+ * The envelope and the delay line are cleared and the gain starts at <code>maxGain * makeupGain</code>,
+ * the gain of silence.  Only the initialization uses floating-point arithmetic.
+ */
+
+riscv_status riscv_dynamics_init_q15(
+  riscv_dynamics_instance_q15 * S,
+  riscv_dynamics_detector detector,
+  float32_t threshold,
+  float32_t ratio,
+  float32_t maxGain,
+  float32_t makeupGain,
+  float32_t attackTime,
+  float32_t releaseTime,
+  uint16_t lookahead,
+  q15_t * pDelay)
+{
+  RISCV_PROFILE(riscv_dynamics_init_q15);
+  float64_t coef;
+
+  if(((detector != RISCV_DYNAMICS_PEAK) && (detector != RISCV_DYNAMICS_RMS)) ||
+     (threshold <= 4.6566129e-10f) || (threshold > 1.0f) ||
+     (maxGain <= 4.6566129e-10f) || (makeupGain <= 4.6566129e-10f) ||
+     ((float64_t) maxGain * makeupGain >= 256.0) ||
+     ((ratio != 0.0f) && (ratio < 1.0f)) || (attackTime < 0.0f) || (releaseTime < 0.0f) ||
+     ((lookahead != 0u) && (pDelay == NULL)))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->detector = detector;
+  S->lookahead = lookahead;
+  S->delayIndex = 0u;
+
+  /*  One-pole coefficients for one envelope update per sub-block, in Q31 */
+  coef = (attackTime > 0.0f) ? 1.0 - exp(-(float64_t) RISCV_DYNAMICS_SUBBLOCK / attackTime) : 1.0;
+  S->attackCoef = riscv_dynamics_fixed(coef, 2147483648.0);
+  coef = (releaseTime > 0.0f) ? 1.0 - exp(-(float64_t) RISCV_DYNAMICS_SUBBLOCK / releaseTime) : 1.0;
+  S->releaseCoef = riscv_dynamics_fixed(coef, 2147483648.0);
+
+  /*  Logarithms in 5.26 format, the slope in Q31 */
+  S->thresholdLog = riscv_dynamics_fixed(log((float64_t) threshold), 67108864.0);
+  S->slope = riscv_dynamics_fixed((ratio == 0.0f) ? 1.0 : 1.0 - 1.0 / ratio, 2147483648.0);
+  S->maxGainLog = riscv_dynamics_fixed(log((float64_t) maxGain), 67108864.0);
+  S->makeupLog = riscv_dynamics_fixed(log((float64_t) makeupGain), 67108864.0);
+
+  S->env = 0;
+  S->gain = riscv_dynamics_fixed((float64_t) maxGain * makeupGain, 8388608.0);
+  S->pDelay = pDelay;
+
+  /*  Clear the delay line */
+  if(lookahead != 0u)
+  {
+    riscv_fill_q15(0, pDelay, lookahead);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Dynamics group
+ */
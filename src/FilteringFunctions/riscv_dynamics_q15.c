@@ -0,0 +1,207 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dynamics_q15.c
+*
+* Description:  Q15 dynamics processor: envelope follower, compressor,
+*               limiter and AGC.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* 8*log(2) in 5.26 format, the exponent that moves a Q31 gain to 8.23 format */
+#define RISCV_DYNAMICS_LOG256_Q26  0x162E42FF
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Dynamics
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 dynamics processor.
+ * @param[in,out] *S          points to an instance of the Q15 dynamics structure.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[out]    *pDst       points to the block of output data, may be <code>pSrc</code>.
+ * @param[in]     blockSize   number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The peak level is the magnitude in Q31, the mean square level the sum of the Q30 squares divided by 8 and
+ * by the sub-block length, in Q31.  The outputs are the products of the delayed inputs and the 8.23 gain,
+ * saturated to Q15.
+ */
+
+void riscv_dynamics_q15(
+  riscv_dynamics_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_dynamics_q15);
+  q15_t *pIn = pSrc;                             /* Input pointer */
+  q15_t *pOut = pDst;                            /* Output pointer */
+  q15_t *pDelay = S->pDelay;                     /* Lookahead delay line */
+  q31_t env = S->env;                            /* Envelope in Q31 */
+  q31_t gain = S->gain;                          /* Gain of the last output sample in 8.23 format */
+  q31_t level, target, step, logGain, hi, lo;    /* Detector, gain computer and ramp */
+  q15_t x, y;                                    /* Input and delayed sample */
+  uint32_t sum;                                  /* Sum of the squares divided by 8 */
+  uint32_t lookahead = S->lookahead;             /* Length of the delay line */
+  uint32_t idx = S->delayIndex;                  /* Oldest sample of the delay line */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+  uint32_t n, k;                                 /* Sub-block length and index */
+
+#if defined (USE_DSP_RISCV)
+  shortV VectIn, VectMax, VectMin;               /* Input pair and per lane extremes */
+#endif
+
+  while(blkCnt > 0u)
+  {
+    n = (blkCnt < RISCV_DYNAMICS_SUBBLOCK) ? blkCnt : RISCV_DYNAMICS_SUBBLOCK;
+
+    /* Level of the sub-block */
+    if(S->detector == RISCV_DYNAMICS_PEAK)
+    {
+#if defined (USE_DSP_RISCV)
+
+      /* Largest and smallest sample of two lanes, abs2 would wrap -32768 */
+      VectMax = pack2(0, 0);
+      VectMin = VectMax;
+
+      for (k = 0u; k + 1u < n; k += 2u)
+      {
+        VectIn = *(shortV *) (pIn + k);
+        VectMax = max2(VectMax, VectIn);
+        VectMin = min2(VectMin, VectIn);
+      }
+
+      hi = (VectMax[0] > VectMax[1]) ? VectMax[0] : VectMax[1];
+      lo = (VectMin[0] < VectMin[1]) ? VectMin[0] : VectMin[1];
+
+      if((n & 1u) != 0u)
+      {
+        x = pIn[n - 1u];
+        hi = (x > hi) ? x : hi;
+        lo = (x < lo) ? x : lo;
+      }
+
+#else
+
+      hi = 0;
+      lo = 0;
+
+      for (k = 0u; k < n; k++)
+      {
+        x = pIn[k];
+        hi = (x > hi) ? x : hi;
+        lo = (x < lo) ? x : lo;
+      }
+
+#endif
+
+      level = (hi > -lo) ? hi : -lo;
+      level = ((level > 0x7FFF) ? 0x7FFF : level) << 16;
+    }
+    else
+    {
+      sum = 0u;
+
+#if defined (USE_DSP_RISCV)
+
+      for (k = 0u; k + 1u < n; k += 2u)
+      {
+        VectIn = *(shortV *) (pIn + k);
+        sum += (uint32_t) dotpv2(VectIn, VectIn) >> 3u;
+      }
+
+#else
+
+      for (k = 0u; k + 1u < n; k += 2u)
+      {
+        sum += ((uint32_t) ((q31_t) pIn[k] * pIn[k]) + (uint32_t) ((q31_t) pIn[k + 1u] * pIn[k + 1u])) >> 3u;
+      }
+
+#endif
+
+      if((n & 1u) != 0u)
+      {
+        sum += (uint32_t) ((q31_t) pIn[n - 1u] * pIn[n - 1u]) >> 3u;
+      }
+
+      /* Mean square in Q31, sum is at most 2^30 */
+      sum = ((sum << 1u) / n) << 3u;
+      level = (sum > 0x7FFFFFFFu) ? 0x7FFFFFFF : (q31_t) sum;
+    }
+
+    /* Envelope, attack while the level rises */
+    env += (q31_t) (((q63_t) (level - env) * ((level > env) ? S->attackCoef : S->releaseCoef)) >> 31);
+
+    /* Gain computer in 5.26 format, a zero envelope takes the largest gain */
+    if(env > 0)
+    {
+      riscv_vlog_q31(&env, &logGain, 1u);
+
+      if(S->detector == RISCV_DYNAMICS_RMS)
+      {
+        logGain >>= 1;
+      }
+
+      logGain = (q31_t) (((q63_t) (S->thresholdLog - logGain) * S->slope) >> 31);
+      logGain = (logGain < S->maxGainLog) ? logGain : S->maxGainLog;
+    }
+    else
+    {
+      logGain = S->maxGainLog;
+    }
+
+    /* exp(logGain) in 8.23 format is exp(logGain - 8*log(2)) in Q31 */
+    logGain += S->makeupLog - RISCV_DYNAMICS_LOG256_Q26;
+    riscv_vexp_q31(&logGain, &target, 1u);
+
+    /* Gain ramp over the sub-block, applied to the delayed input */
+    step = (target - gain) / (q31_t) n;
+
+    if(lookahead == 0u)
+    {
+      for (k = 0u; k < n; k++)
+      {
+        gain += step;
+        pOut[k] = (q15_t) __SSAT((q31_t) (((q63_t) pIn[k] * gain) >> 23), 16);
+      }
+    }
+    else
+    {
+      for (k = 0u; k < n; k++)
+      {
+        gain += step;
+        x = pIn[k];
+        y = pDelay[idx];
+        pDelay[idx] = x;
+        pOut[k] = (q15_t) __SSAT((q31_t) (((q63_t) y * gain) >> 23), 16);
+
+        idx = (idx + 1u == lookahead) ? 0u : idx + 1u;
+      }
+    }
+
+    gain = target;
+    pIn += n;
+    pOut += n;
+
+    /* Decrement the loop counter */
+    blkCnt -= n;
+  }
+
+  S->env = env;
+  S->gain = gain;
+  S->delayIndex = (uint16_t) idx;
+}
+
+/**
+ * @} end of Dynamics group
+ */
@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_exp_smooth_f32.c
+*
+* Description:  Floating-point bank of exponential smoothers.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup ExpSmooth Exponential Smoothing
+ *
+ * A bank of <code>numChannels</code> one-pole lowpass filters with the same smoothing factor
+ * <code>alpha</code>, the exponentially weighted moving average of every channel:
+ * <pre>
+ *     y[c] = y[c] + alpha * (x[c] - y[c]) = (1 - alpha) * y[c] + alpha * x[c]
+ * </pre>
+ * The input is <code>blockSize</code> frames of <code>numChannels</code> interleaved samples, one per
+ * channel, such as the bins of successive spectra or the channels of a sensor array; the output has
+ * the same layout and the last frame of it stays in <code>pState</code>, which the initialization
+ * functions clear.  The time constant is about <code>1/alpha</code> frames.
+ * \par
+ * The channels are independent, so the Q15 function smooths two channels at once with
+ * <code>USE_DSP_RISCV</code>: the pair of states and the pair of inputs are shuffled into one
+ * <code>(y, x)</code> pair per channel, each weighted by <code>(1-alpha, alpha)</code> in one dot
+ * product, and the two results packed back.
+ */
+
+/**
+ * @addtogroup ExpSmooth
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point exponential smoothers.
+ * @param[in,out] *S         points to an instance of the floating-point exponential smoothing structure.
+ * @param[in]     *pSrc      points to <code>blockSize</code> frames of <code>numChannels</code> samples.
+ * @param[out]    *pDst      points to <code>blockSize</code> frames of <code>numChannels</code> samples.
+ * @param[in]     blockSize  number of frames to process.
+ * @return none.
+ */
+
+void riscv_exp_smooth_f32(
+  const riscv_exp_smooth_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_exp_smooth_f32);
+  float32_t *pState = S->pState;                 /* Last output of every channel */
+  uint32_t numChannels = S->numChannels;
+  float32_t alpha = S->alpha;
+  float32_t y;
+  uint32_t c, blkCnt;
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    for (c = 0u; c < numChannels; c++)
+    {
+      y = pState[c];
+      y += alpha * (*pSrc++ - y);
+      pState[c] = y;
+      *pDst++ = y;
+    }
+  }
+}
+
+/**
+ * @} end of ExpSmooth group
+ */
@@ -0,0 +1,55 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_exp_smooth_init_f32.c
+*
+* Description:  Initialization function for the floating-point exponential smoothers.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ExpSmooth
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point exponential smoothers.
+ * @param[out]    *S            points to an instance of the floating-point exponential smoothing structure.
+ * @param[in]     numChannels   number of channels.
+ * @param[in]     alpha         smoothing factor, in (0, 1].
+ * @param[in]     *pState       points to the state buffer of <code>numChannels</code> values.
+ * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR if <code>numChannels</code>
+ *                is 0 or <code>alpha</code> is out of range.
+ */
+
+riscv_status riscv_exp_smooth_init_f32(
+  riscv_exp_smooth_instance_f32 * S,
+  uint16_t numChannels,
+  float32_t alpha,
+  float32_t * pState)
+{
+  RISCV_PROFILE(riscv_exp_smooth_init_f32);
+
+  if((numChannels == 0u) || !(alpha > 0.0f) || (alpha > 1.0f))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  memset(pState, 0, numChannels * sizeof(float32_t));
+
+  S->numChannels = numChannels;
+  S->alpha = alpha;
+  S->pState = pState;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ExpSmooth group
+ */
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_exp_smooth_q15.c
+*
+* Description:  Q15 bank of exponential smoothers.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ExpSmooth
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 exponential smoothers.
+ * @param[in,out] *S         points to an instance of the Q15 exponential smoothing structure.
+ * @param[in]     *pSrc      points to <code>blockSize</code> frames of <code>numChannels</code> samples.
+ * @param[out]    *pDst      points to <code>blockSize</code> frames of <code>numChannels</code> samples.
+ * @param[in]     blockSize  number of frames to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * <code>(1-alpha)*y[c] + alpha*x[c]</code> is accumulated in 2.30 format, rounded and shifted back
+ * to 1.15 format; the output lies between the input and the state and cannot overflow.  A state within
+ * <code>0.5/alpha</code> LSBs of a constant input stays where it is, use the Q31 smoothers for long time
+ * constants.
+ * \par
+ * With <code>USE_DSP_RISCV</code> the buffers are word aligned, and an even <code>numChannels</code> keeps
+ * every frame aligned.
+ */
+
+void riscv_exp_smooth_q15(
+  const riscv_exp_smooth_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_exp_smooth_q15);
+  q15_t *pState = S->pState;                     /* Last output of every channel */
+  uint32_t numChannels = S->numChannels;
+  q31_t alpha = S->alpha;
+  q31_t beta = 0x8000 - alpha;                   /* 1 - alpha */
+  uint32_t c, blkCnt;
+
+#if defined (USE_DSP_RISCV)
+  shortV lo = { 0, 2 };                          /* (y, x) of the first channel of a pair */
+  shortV hi = { 1, 3 };                          /* (y, x) of the second */
+  shortV coef = pack2(beta, alpha);
+  shortV y, x;
+  q31_t y0, y1;
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    /* Two channels per step */
+    for (c = 0u; (c + 1u) < numChannels; c += 2u)
+    {
+      y = *(shortV *) &pState[c];
+      x = *(shortV *) pSrc;
+      pSrc += 2;
+
+      y0 = sumdotpv2(shufflev4(y, x, lo), coef, 0x4000) >> 15;
+      y1 = sumdotpv2(shufflev4(y, x, hi), coef, 0x4000) >> 15;
+      y = pack2(y0, y1);
+
+      *(shortV *) &pState[c] = y;
+      *(shortV *) pDst = y;
+      pDst += 2;
+    }
+
+    if(c < numChannels)
+    {
+      pState[c] = (q15_t) ((((q31_t) pState[c] * beta) + ((q31_t) *pSrc++ * alpha) + 0x4000) >> 15);
+      *pDst++ = pState[c];
+    }
+  }
+#else
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    for (c = 0u; c < numChannels; c++)
+    {
+      pState[c] = (q15_t) ((((q31_t) pState[c] * beta) + ((q31_t) *pSrc++ * alpha) + 0x4000) >> 15);
+      *pDst++ = pState[c];
+    }
+  }
+#endif
+}
+
+/**
+ * @} end of ExpSmooth group
+ */
@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_exp_smooth_q31.c
+*
+* Description:  Q31 bank of exponential smoothers.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ExpSmooth
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 exponential smoothers.
+ * @param[in,out] *S         points to an instance of the Q31 exponential smoothing structure.
+ * @param[in]     *pSrc      points to <code>blockSize</code> frames of <code>numChannels</code> samples.
+ * @param[out]    *pDst      points to <code>blockSize</code> frames of <code>numChannels</code> samples.
+ * @param[in]     blockSize  number of frames to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The difference <code>x[c]-y[c]</code> is taken in 64 bits, multiplied by <code>alpha</code> and rounded
+ * back to 1.31 format; the output lies between the input and the state and cannot overflow.  A state
+ * within <code>0.5/alpha</code> LSBs of a constant input stays where it is.
+ */
+
+void riscv_exp_smooth_q31(
+  const riscv_exp_smooth_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_exp_smooth_q31);
+  q31_t *pState = S->pState;                     /* Last output of every channel */
+  uint32_t numChannels = S->numChannels;
+  q63_t alpha = S->alpha;
+  q31_t y;
+  uint32_t c, blkCnt;
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    for (c = 0u; c < numChannels; c++)
+    {
+      y = pState[c];
+      y += (q31_t) (((((q63_t) *pSrc++ - y) * alpha) + 0x40000000) >> 31);
+      pState[c] = y;
+      *pDst++ = y;
+    }
+  }
+}
+
+/**
+ * @} end of ExpSmooth group
+ */
@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_circ_f32.c
+*
+* Description:  Floating-point FIR filter with a circular, mirrored state buffer.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/*
+* @brief  Filters four output samples.
+* @param[in]  *pCoeffs  points to the coefficients.
+* @param[in]  numTaps   number of taps.
+* @param[in]  *pX       points to the oldest state sample of the first output.
+* @param[out] *pD       points to the four outputs.
+*/
+
+static void riscv_fir_circ_4_f32(
+  const float32_t * pCoeffs,
+  uint32_t numTaps,
+  const float32_t * pX,
+  float32_t * pD)
+{
+  float32_t c, x0, x1, x2, x3;                   /* Coefficient and state samples */
+  float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;  /* Accumulators */
+  uint32_t tapCnt;
+
+  x0 = *pX++;
+  x1 = *pX++;
+  x2 = *pX++;
+
+  for (tapCnt = numTaps; tapCnt > 0u; tapCnt--)
+  {
+    c = *pCoeffs++;
+    x3 = *pX++;
+
+    acc0 += x0 * c;
+    acc1 += x1 * c;
+    acc2 += x2 * c;
+    acc3 += x3 * c;
+
+    x0 = x1;
+    x1 = x2;
+    x2 = x3;
+  }
+
+  pD[0] = acc0;
+  pD[1] = acc1;
+  pD[2] = acc2;
+  pD[3] = acc3;
+}
+
+/*
+* @brief  Filters one output sample.
+*/
+
+static float32_t riscv_fir_circ_1_f32(
+  const float32_t * pCoeffs,
+  uint32_t numTaps,
+  const float32_t * pX)
+{
+  float32_t acc = 0.0f;                          /* Accumulator */
+  uint32_t tapCnt;
+
+  for (tapCnt = numTaps; tapCnt > 0u; tapCnt--)
+  {
+    acc += *pX++ * *pCoeffs++;
+  }
+
+  return (acc);
+}
+
+/**
+* @brief  Processing function for the floating-point FIR filter with a circular state buffer.
+* @param[in,out] *S         points to an instance of the floating-point circular FIR structure.
+* @param[in]     *pSrc      points to the block of input data.
+* @param[out]    *pDst      points to the block of output data.
+* @param[in]     blockSize  number of samples to process, at most the <code>blockSize</code> given to riscv_fir_circ_init_f32().
+* @return none.
+*
+* \par
+* The output equals the output of riscv_fir_f32() with the same coefficients.
+* Instead of moving the last <code>numTaps-1</code> samples to the start of the state buffer after every block,
+* the function writes every new sample twice, at <code>stateIndex</code> and <code>stateIndex+stateLength</code>.
+* The window of every block is then a contiguous run of the buffer and only <code>stateIndex</code> advances,
+* which saves most of the state update when <code>numTaps</code> is large compared to <code>blockSize</code>.
+*/
+
+void riscv_fir_circ_f32(
+  riscv_fir_circ_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_circ_f32);
+  float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+  const float32_t *pX;                           /* Oldest state sample of the block */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
+  uint32_t stateLen = S->stateLength;            /* Length of the circular buffer */
+  uint32_t wrIndex = S->stateIndex;              /* Write index of the circular buffer */
+  uint32_t start, n;
+
+  /* The window of the block starts numTaps - 1 samples before the new input */
+  start = (wrIndex + stateLen) - (numTaps - 1u);
+  if(start >= stateLen)
+  {
+    start -= stateLen;
+  }
+
+  /* Write the new samples and their mirror copies */
+  for (n = 0u; n < blockSize; n++)
+  {
+    pState[wrIndex] = pSrc[n];
+    pState[wrIndex + stateLen] = pSrc[n];
+
+    wrIndex++;
+    if(wrIndex == stateLen)
+    {
+      wrIndex = 0u;
+    }
+  }
+
+  S->stateIndex = wrIndex;
+
+  pX = pState + start;
+  n = 0u;
+
+  for (; (n + 4u) <= blockSize; n += 4u)
+  {
+    riscv_fir_circ_4_f32(pCoeffs, numTaps, pX + n, pDst + n);
+  }
+
+  for (; n < blockSize; n++)
+  {
+    pDst[n] = riscv_fir_circ_1_f32(pCoeffs, numTaps, pX + n);
+  }
+}
+
+/**
+* @} end of FIR group
+*/
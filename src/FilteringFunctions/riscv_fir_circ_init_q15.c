@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_circ_init_q15.c
+*
+* Description:  Initialization function for the Q15 FIR filter with a
+*               circular, mirrored state buffer.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q15 FIR filter with a circular state buffer.
+* @param[in,out] *S         points to an instance of the Q15 circular FIR structure.
+* @param[in]     numTaps    number of filter coefficients in the filter, even and greater than or equal to 4.
+* @param[in]     *pCoeffs   points to the filter coefficients.
+* @param[in]     *pState    points to the state buffer.
+* @param[in]     blockSize  maximum number of samples processed per call.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>numTaps</code> is not even and greater than or equal to 4.
+*
+* <b>Description:</b>
+* \par
+* <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+* as for riscv_fir_init_q15():
+* <pre>
+*    {b[numTaps-1], b[numTaps-2], ..., b[1], b[0]}
+* </pre>
+* \par
+* <code>pState</code> is of length <code>2*(numTaps+blockSize-1)</code> and is cleared.
+* The second half mirrors the first one.
+*/
+
+riscv_status riscv_fir_circ_init_q15(
+  riscv_fir_circ_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_circ_init_q15);
+  if((numTaps < 4u) || ((numTaps & 1u) != 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numTaps = numTaps;
+  S->stateIndex = 0u;
+  S->stateLength = (uint32_t) numTaps + blockSize - 1u;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* Clear the circular buffer and its mirror */
+  memset(pState, 0, 2u * S->stateLength * sizeof(q15_t));
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of FIR group
+*/
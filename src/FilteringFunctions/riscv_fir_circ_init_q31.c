@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_circ_init_q31.c
+*
+* Description:  Initialization function for the Q31 FIR filter with a
+*               circular, mirrored state buffer.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q31 FIR filter with a circular state buffer.
+* @param[in,out] *S         points to an instance of the Q31 circular FIR structure.
+* @param[in]     numTaps    number of filter coefficients in the filter, greater than 0.
+* @param[in]     *pCoeffs   points to the filter coefficients.
+* @param[in]     *pState    points to the state buffer.
+* @param[in]     blockSize  maximum number of samples processed per call.
+* @return        none.
+*
+* <b>Description:</b>
+* \par
+* <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+* as for riscv_fir_init_q31():
+* <pre>
+*    {b[numTaps-1], b[numTaps-2], ..., b[1], b[0]}
+* </pre>
+* \par
+* <code>pState</code> is of length <code>2*(numTaps+blockSize-1)</code> and is cleared.
+* The second half mirrors the first one.
+*/
+
+void riscv_fir_circ_init_q31(
+  riscv_fir_circ_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_circ_init_q31);
+  S->numTaps = numTaps;
+  S->stateIndex = 0u;
+  S->stateLength = (uint32_t) numTaps + blockSize - 1u;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* Clear the circular buffer and its mirror */
+  memset(pState, 0, 2u * S->stateLength * sizeof(q31_t));
+}
+
+/**
+* @} end of FIR group
+*/
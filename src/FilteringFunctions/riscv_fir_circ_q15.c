@@ -0,0 +1,185 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_circ_q15.c
+*
+* Description:  Q15 FIR filter with a circular, mirrored state buffer.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+#if defined (USE_DSP_RISCV)
+
+/*
+* @brief  Filters four output samples.
+* @param[in]  *pCoeffs  points to the coefficients.
+* @param[in]  numTaps   number of taps, even.
+* @param[in]  *pX       points to the oldest state sample of the first output.
+* @param[out] *pD       points to the four outputs.
+*/
+
+static void riscv_fir_circ_4_q15(
+  const q15_t * pCoeffs,
+  uint32_t numTaps,
+  const q15_t * pX,
+  q15_t * pD)
+{
+  shortV c, x0, x1, x2, x3;                      /* Coefficient pair and state pairs */
+  q63_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;  /* Accumulators */
+  uint32_t tapCnt;
+
+  x0 = *(shortV *) pX;
+  x1 = *(shortV *) (pX + 1);
+  pX += 2;
+
+  for (tapCnt = numTaps >> 1; tapCnt > 0u; tapCnt--)
+  {
+    c = *(shortV *) pCoeffs;
+    pCoeffs += 2;
+
+    x2 = *(shortV *) pX;
+    x3 = *(shortV *) (pX + 1);
+    pX += 2;
+
+    acc0 += dotpv2(x0, c);
+    acc1 += dotpv2(x1, c);
+    acc2 += dotpv2(x2, c);
+    acc3 += dotpv2(x3, c);
+
+    x0 = x2;
+    x1 = x3;
+  }
+
+  /* The results are in 2.30 format.  Convert to 1.15 with saturation. */
+  pD[0] = (q15_t) __SSAT((acc0 >> 15), 16);
+  pD[1] = (q15_t) __SSAT((acc1 >> 15), 16);
+  pD[2] = (q15_t) __SSAT((acc2 >> 15), 16);
+  pD[3] = (q15_t) __SSAT((acc3 >> 15), 16);
+}
+
+#endif /* #if defined (USE_DSP_RISCV) */
+
+/*
+* @brief  Filters one output sample.
+*/
+
+static q15_t riscv_fir_circ_1_q15(
+  const q15_t * pCoeffs,
+  uint32_t numTaps,
+  const q15_t * pX)
+{
+  q63_t acc = 0;                                 /* Accumulator */
+  uint32_t tapCnt;
+
+#if defined (USE_DSP_RISCV)
+
+  for (tapCnt = numTaps >> 1; tapCnt > 0u; tapCnt--)
+  {
+    acc += dotpv2(*(shortV *) pX, *(shortV *) pCoeffs);
+    pX += 2;
+    pCoeffs += 2;
+  }
+
+#else
+
+  for (tapCnt = numTaps; tapCnt > 0u; tapCnt--)
+  {
+    acc += (q31_t) *pX++ * *pCoeffs++;
+  }
+
+#endif
+
+  return ((q15_t) __SSAT((acc >> 15), 16));
+}
+
+/**
+* @brief  Processing function for the Q15 FIR filter with a circular state buffer.
+* @param[in,out] *S         points to an instance of the Q15 circular FIR structure.
+* @param[in]     *pSrc      points to the block of input data.
+* @param[out]    *pDst      points to the block of output data.
+* @param[in]     blockSize  number of samples to process, at most the <code>blockSize</code> given to riscv_fir_circ_init_q15().
+* @return none.
+*
+* \par
+* The output equals the output of riscv_fir_q15() with the same coefficients.
+* Instead of moving the last <code>numTaps-1</code> samples to the start of the state buffer after every block,
+* the function writes every new sample twice, at <code>stateIndex</code> and <code>stateIndex+stateLength</code>.
+* The window of every block is then a contiguous run of the buffer and only <code>stateIndex</code> advances,
+* which saves most of the state update when <code>numTaps</code> is large compared to <code>blockSize</code>.
+*
+* <b>Scaling and Overflow Behavior:</b>
+* \par
+* The function uses a 64-bit internal accumulator, as riscv_fir_q15().
+* Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+* After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits
+* and saturated to 1.15 format.
+*/
+
+void riscv_fir_circ_q15(
+  riscv_fir_circ_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_circ_q15);
+  q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;             /* Coefficient pointer */
+  const q15_t *pX;                               /* Oldest state sample of the block */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
+  uint32_t stateLen = S->stateLength;            /* Length of the circular buffer */
+  uint32_t wrIndex = S->stateIndex;              /* Write index of the circular buffer */
+  uint32_t start, n;
+
+  /* The window of the block starts numTaps - 1 samples before the new input */
+  start = (wrIndex + stateLen) - (numTaps - 1u);
+  if(start >= stateLen)
+  {
+    start -= stateLen;
+  }
+
+  /* Write the new samples and their mirror copies */
+  for (n = 0u; n < blockSize; n++)
+  {
+    pState[wrIndex] = pSrc[n];
+    pState[wrIndex + stateLen] = pSrc[n];
+
+    wrIndex++;
+    if(wrIndex == stateLen)
+    {
+      wrIndex = 0u;
+    }
+  }
+
+  S->stateIndex = wrIndex;
+
+  pX = pState + start;
+  n = 0u;
+
+#if defined (USE_DSP_RISCV)
+
+  for (; (n + 4u) <= blockSize; n += 4u)
+  {
+    riscv_fir_circ_4_q15(pCoeffs, numTaps, pX + n, pDst + n);
+  }
+
+#endif
+
+  for (; n < blockSize; n++)
+  {
+    pDst[n] = riscv_fir_circ_1_q15(pCoeffs, numTaps, pX + n);
+  }
+}
+
+/**
+* @} end of FIR group
+*/
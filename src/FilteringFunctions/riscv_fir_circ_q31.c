@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_circ_q31.c
+*
+* Description:  Q31 FIR filter with a circular, mirrored state buffer.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/*
+* @brief  Filters four output samples.
+* @param[in]  *pCoeffs  points to the coefficients.
+* @param[in]  numTaps   number of taps.
+* @param[in]  *pX       points to the oldest state sample of the first output.
+* @param[out] *pD       points to the four outputs.
+*/
+
+static void riscv_fir_circ_4_q31(
+  const q31_t * pCoeffs,
+  uint32_t numTaps,
+  const q31_t * pX,
+  q31_t * pD)
+{
+  q31_t c, x0, x1, x2, x3;                       /* Coefficient and state samples */
+  q63_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;  /* Accumulators */
+  uint32_t tapCnt;
+
+  x0 = *pX++;
+  x1 = *pX++;
+  x2 = *pX++;
+
+  for (tapCnt = numTaps; tapCnt > 0u; tapCnt--)
+  {
+    c = *pCoeffs++;
+    x3 = *pX++;
+
+    acc0 += (q63_t) x0 * c;
+    acc1 += (q63_t) x1 * c;
+    acc2 += (q63_t) x2 * c;
+    acc3 += (q63_t) x3 * c;
+
+    x0 = x1;
+    x1 = x2;
+    x2 = x3;
+  }
+
+  /* Convert the 2.62 results to 1.31 */
+  pD[0] = (q31_t) (acc0 >> 31);
+  pD[1] = (q31_t) (acc1 >> 31);
+  pD[2] = (q31_t) (acc2 >> 31);
+  pD[3] = (q31_t) (acc3 >> 31);
+}
+
+/*
+* @brief  Filters one output sample.
+*/
+
+static q31_t riscv_fir_circ_1_q31(
+  const q31_t * pCoeffs,
+  uint32_t numTaps,
+  const q31_t * pX)
+{
+  q63_t acc = 0;                                 /* Accumulator */
+  uint32_t tapCnt;
+
+  for (tapCnt = numTaps; tapCnt > 0u; tapCnt--)
+  {
+    acc += (q63_t) *pX++ * *pCoeffs++;
+  }
+
+  return ((q31_t) (acc >> 31));
+}
+
+/**
+* @brief  Processing function for the Q31 FIR filter with a circular state buffer.
+* @param[in,out] *S         points to an instance of the Q31 circular FIR structure.
+* @param[in]     *pSrc      points to the block of input data.
+* @param[out]    *pDst      points to the block of output data.
+* @param[in]     blockSize  number of samples to process, at most the <code>blockSize</code> given to riscv_fir_circ_init_q31().
+* @return none.
+*
+* \par
+* The output equals the output of riscv_fir_q31() with the same coefficients.
+* Instead of moving the last <code>numTaps-1</code> samples to the start of the state buffer after every block,
+* the function writes every new sample twice, at <code>stateIndex</code> and <code>stateIndex+stateLength</code>.
+* The window of every block is then a contiguous run of the buffer and only <code>stateIndex</code> advances,
+* which saves most of the state update when <code>numTaps</code> is large compared to <code>blockSize</code>.
+*
+* <b>Scaling and Overflow Behavior:</b>
+* \par
+* The function uses a 64-bit internal accumulator, as riscv_fir_q31().
+* The accumulator has a 2.62 format and provides only a single guard bit, the input signal must be scaled down
+* by log2(numTaps) bits to avoid overflows.  The result is the accumulator shifted right by 31 bits.
+*/
+
+void riscv_fir_circ_q31(
+  riscv_fir_circ_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_circ_q31);
+  q31_t *pState = S->pState;                     /* State pointer */
+  const q31_t *pCoeffs = S->pCoeffs;             /* Coefficient pointer */
+  const q31_t *pX;                               /* Oldest state sample of the block */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
+  uint32_t stateLen = S->stateLength;            /* Length of the circular buffer */
+  uint32_t wrIndex = S->stateIndex;              /* Write index of the circular buffer */
+  uint32_t start, n;
+
+  /* The window of the block starts numTaps - 1 samples before the new input */
+  start = (wrIndex + stateLen) - (numTaps - 1u);
+  if(start >= stateLen)
+  {
+    start -= stateLen;
+  }
+
+  /* Write the new samples and their mirror copies */
+  for (n = 0u; n < blockSize; n++)
+  {
+    pState[wrIndex] = pSrc[n];
+    pState[wrIndex + stateLen] = pSrc[n];
+
+    wrIndex++;
+    if(wrIndex == stateLen)
+    {
+      wrIndex = 0u;
+    }
+  }
+
+  S->stateIndex = wrIndex;
+
+  pX = pState + start;
+  n = 0u;
+
+  for (; (n + 4u) <= blockSize; n += 4u)
+  {
+    riscv_fir_circ_4_q31(pCoeffs, numTaps, pX + n, pDst + n);
+  }
+
+  for (; n < blockSize; n++)
+  {
+    pDst[n] = riscv_fir_circ_1_q31(pCoeffs, numTaps, pX + n);
+  }
+}
+
+/**
+* @} end of FIR group
+*/
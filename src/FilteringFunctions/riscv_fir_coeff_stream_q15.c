@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_coeff_stream_q15.c
+*
+* Description:  Q15 FIR filter with the coefficients and the state
+*               streamed from flash or L2 through tiles in L1.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Streaming
+ * @{
+ */
+
+/**
+ * @brief  Q15 FIR filter with the coefficients streamed through tiles in L1.
+ * @param[in]  *D          points to the DMA hook.
+ * @param[in]  *S          points to an instance of the Q15 FIR filter structure, its coefficients in flash or L2 and its state in L2.
+ * @param[in]  *pSrc       points to the block of input samples.
+ * @param[out] *pDst       points to the block of output samples.
+ * @param[in]  blockSize   number of samples to process, at most the <code>blockSize</code> of riscv_fir_init_q15().
+ * @param[in]  tileTaps    number of coefficients per transfer, the last tile may be shorter.
+ * @param[in]  *pL1        points to RISCV_FIR_COEFF_STREAM_L1_SIZE(tileTaps, blockSize) samples in L1.
+ * @param[out] *pAcc       points to <code>blockSize</code> accumulators in L1.
+ * @return none.
+ *
+ * \par
+ * For filters whose coefficients do not fit in L1, unlike riscv_fir_stream_q15() which streams the
+ * signal and keeps the coefficients in L1.  The taps are split in tiles of <code>tileTaps</code>; for
+ * every tile the DMA brings its coefficients and the <code>tileTaps+blockSize-1</code> state samples
+ * it multiplies, and every output adds the dot product of the tile to its accumulator.  The next tile
+ * is fetched while this one is computed, two tiles of coefficients and samples are used in turn.
+ * \par
+ * The products are summed exactly in the 64-bit accumulators, so the output is the one of
+ * riscv_fir_q15(): the sum truncated to 34.15 and saturated to 1.15.  The input block is copied into
+ * the state with the DMA and the state is shifted by <code>blockSize</code> samples in L2 with memmove.
+ */
+
+void riscv_fir_coeff_stream_q15(
+  const riscv_dma_instance * D,
+  const riscv_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize,
+  uint16_t tileTaps,
+  q15_t * pL1,
+  q63_t * pAcc)
+{
+  RISCV_PROFILE(riscv_fir_coeff_stream_q15);
+  q15_t *pState = S->pState;                     /* State in L2 */
+  const q15_t *pCoeffs = S->pCoeffs;             /* Coefficients in flash or L2 */
+  uint32_t numTaps = S->numTaps;
+  uint32_t windowSize = (uint32_t) tileTaps + blockSize - 1u;
+  uint32_t numTiles = (numTaps + tileTaps - 1u) / tileTaps;
+  q15_t *pTileCoeffs[2], *pTileState[2];         /* Tiles in L1 */
+  uint32_t id[2];                                /* Transfer identifiers */
+  uint32_t t, b, n, i;
+  q63_t sum;
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  pTileCoeffs[0] = pL1;
+  pTileState[0] = pTileCoeffs[0] + tileTaps;
+  pTileCoeffs[1] = pTileState[0] + windowSize;
+  pTileState[1] = pTileCoeffs[1] + tileTaps;
+
+  /* New samples after the numTaps-1 previous ones */
+  D->wait(D->ctx, D->start(D->ctx, pState + (numTaps - 1u), pSrc, blockSize * sizeof(q15_t), 1u, 0u, 0u));
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    pAcc[i] = 0;
+  }
+
+  n = (numTaps < tileTaps) ? numTaps : tileTaps;
+  (void) D->start(D->ctx, pTileCoeffs[0], pCoeffs, n * sizeof(q15_t), 1u, 0u, 0u);
+  id[0] = D->start(D->ctx, pTileState[0], pState, (n + blockSize - 1u) * sizeof(q15_t), 1u, 0u, 0u);
+
+  for (t = 0u; t < numTiles; t++)
+  {
+    b = t & 1u;
+    n = ((numTaps - (t * tileTaps)) < tileTaps) ? (numTaps - (t * tileTaps)) : tileTaps;
+
+    D->wait(D->ctx, id[b]);
+
+    /* Fetch the coefficients and samples of the next taps while this tile is computed */
+    if((t + 1u) < numTiles)
+    {
+      uint32_t next = numTaps - ((t + 1u) * tileTaps);
+
+      next = (next < tileTaps) ? next : tileTaps;
+      (void) D->start(D->ctx, pTileCoeffs[b ^ 1u], pCoeffs + ((t + 1u) * tileTaps),
+                      next * sizeof(q15_t), 1u, 0u, 0u);
+      id[b ^ 1u] = D->start(D->ctx, pTileState[b ^ 1u], pState + ((t + 1u) * tileTaps),
+                            (next + blockSize - 1u) * sizeof(q15_t), 1u, 0u, 0u);
+    }
+
+    /* acc[i] += b[numTaps-1-k] * x[i+k] over the taps k of the tile */
+    for (i = 0u; i < blockSize; i++)
+    {
+      riscv_dot_prod_q15(pTileState[b] + i, pTileCoeffs[b], n, &sum);
+      pAcc[i] += sum;
+    }
+  }
+
+  /* 34.30 to 1.15 with saturation */
+  for (i = 0u; i < blockSize; i++)
+  {
+    pDst[i] = (q15_t) __SSAT((pAcc[i] >> 15), 16);
+  }
+
+  /* Keep the last numTaps-1 samples for the next block */
+  memmove(pState, pState + blockSize, (numTaps - 1u) * sizeof(q15_t));
+}
+
+/**
+ * @} end of Streaming group
+ */
@@ -85,6 +85,7 @@ void riscv_fir_decimate_fast_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_decimate_fast_q15);
   q15_t *pState = S->pState;                     /* State pointer */
   q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
   q15_t *pStateCurnt;                            /* Points to the current sample of the state */
@@ -321,6 +322,7 @@ void riscv_fir_decimate_fast_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_decimate_fast_q15);
   q15_t *pState = S->pState;                     /* State pointer */
   q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
   q15_t *pStateCurnt;                            /* Points to the current sample of the state */
@@ -81,6 +81,7 @@ void riscv_fir_decimate_fast_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_decimate_fast_q31);
   q31_t *pState = S->pState;                     /* State pointer */
   q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
   q31_t *pStateCurnt;                            /* Points to the current sample of the state */
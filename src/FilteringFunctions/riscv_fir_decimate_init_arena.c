@@ -0,0 +1,195 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_decimate_init_arena.c
+*
+* Description:  FIR decimator instances with the state buffer taken from an
+*               arena.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_decimate
+ * @{
+ */
+
+/**
+ * @brief  Size of the state buffer of the floating-point FIR decimator.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of input samples processed per call.
+ * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+ */
+
+uint32_t riscv_fir_decimate_get_buffer_size_f32(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  return (RISCV_DSP_ARENA_ROUND(((uint32_t) numTaps + blockSize - 1u) * sizeof(float32_t)));
+}
+
+/**
+ * @brief  Initialization function for the floating-point FIR decimator with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the floating-point FIR decimator structure.
+ * @param[in]     numTaps   number of filter coefficients.
+ * @param[in]     M         decimation factor.
+ * @param[in]     *pCoeffs  points to the filter coefficients.
+ * @param[in]     blockSize number of input samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_decimate_get_buffer_size_f32() bytes free,
+ * otherwise the status of riscv_fir_decimate_init_f32().
+ */
+
+riscv_status riscv_fir_decimate_init_arena_f32(
+  riscv_fir_decimate_instance_f32 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  float32_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_fir_decimate_init_arena_f32);
+  uint32_t used = pArena->used;
+  float32_t *pState;
+  riscv_status status;
+
+  pState = (float32_t *) riscv_dsp_arena_alloc(pArena, riscv_fir_decimate_get_buffer_size_f32(numTaps, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  status = riscv_fir_decimate_init_f32(S, numTaps, M, pCoeffs, pState, blockSize);
+
+  /*  Give the state back if the parameters are rejected */
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    pArena->used = used;
+  }
+
+  return (status);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q31 FIR decimator.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of input samples processed per call.
+ * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+ */
+
+uint32_t riscv_fir_decimate_get_buffer_size_q31(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  return (RISCV_DSP_ARENA_ROUND(((uint32_t) numTaps + blockSize - 1u) * sizeof(q31_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q31 FIR decimator with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q31 FIR decimator structure.
+ * @param[in]     numTaps   number of filter coefficients.
+ * @param[in]     M         decimation factor.
+ * @param[in]     *pCoeffs  points to the filter coefficients.
+ * @param[in]     blockSize number of input samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_decimate_get_buffer_size_q31() bytes free,
+ * otherwise the status of riscv_fir_decimate_init_q31().
+ */
+
+riscv_status riscv_fir_decimate_init_arena_q31(
+  riscv_fir_decimate_instance_q31 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  q31_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_fir_decimate_init_arena_q31);
+  uint32_t used = pArena->used;
+  q31_t *pState;
+  riscv_status status;
+
+  pState = (q31_t *) riscv_dsp_arena_alloc(pArena, riscv_fir_decimate_get_buffer_size_q31(numTaps, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  status = riscv_fir_decimate_init_q31(S, numTaps, M, pCoeffs, pState, blockSize);
+
+  /*  Give the state back if the parameters are rejected */
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    pArena->used = used;
+  }
+
+  return (status);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q15 FIR decimator.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of input samples processed per call.
+ * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+ */
+
+uint32_t riscv_fir_decimate_get_buffer_size_q15(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  return (RISCV_DSP_ARENA_ROUND(((uint32_t) numTaps + blockSize - 1u) * sizeof(q15_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q15 FIR decimator with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q15 FIR decimator structure.
+ * @param[in]     numTaps   number of filter coefficients.
+ * @param[in]     M         decimation factor.
+ * @param[in]     *pCoeffs  points to the filter coefficients.
+ * @param[in]     blockSize number of input samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_decimate_get_buffer_size_q15() bytes free,
+ * otherwise the status of riscv_fir_decimate_init_q15().
+ */
+
+riscv_status riscv_fir_decimate_init_arena_q15(
+  riscv_fir_decimate_instance_q15 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  q15_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_fir_decimate_init_arena_q15);
+  uint32_t used = pArena->used;
+  q15_t *pState;
+  riscv_status status;
+
+  pState = (q15_t *) riscv_dsp_arena_alloc(pArena, riscv_fir_decimate_get_buffer_size_q15(numTaps, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  status = riscv_fir_decimate_init_q15(S, numTaps, M, pCoeffs, pState, blockSize);
+
+  /*  Give the state back if the parameters are rejected */
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    pArena->used = used;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR_decimate group
+ */
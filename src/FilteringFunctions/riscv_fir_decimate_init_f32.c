@@ -82,6 +82,7 @@ riscv_status riscv_fir_decimate_init_f32(
   float32_t * pState,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_decimate_init_f32);
   riscv_status status;
 
   /* The size of the input block must be a multiple of the decimation factor */
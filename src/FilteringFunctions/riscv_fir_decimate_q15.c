@@ -79,6 +79,7 @@ void riscv_fir_decimate_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_decimate_q15);
 
 #if defined (USE_DSP_RISCV)
   q15_t *pState = S->pState;                     /* State pointer */
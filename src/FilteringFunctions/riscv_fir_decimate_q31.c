@@ -77,6 +77,7 @@ void riscv_fir_decimate_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_decimate_q31);
   q31_t *pState = S->pState;                     /* State pointer */
   q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
   q31_t *pStateCurnt;                            /* Points to the current sample of the state */
@@ -84,6 +85,10 @@ void riscv_fir_decimate_q31(
   q31_t *px;                                     /* Temporary pointers for state buffer */
   q31_t *pb;                                     /* Temporary pointers for coefficient buffer */
   q63_t sum0;                                    /* Accumulator */
+#if defined (USE_DSP_RISCV)
+  q31_t *px1, *px2, *px3;                        /* State pointers of the second to fourth output */
+  q63_t sum1, sum2, sum3;                        /* Accumulators of the second to fourth output */
+#endif
   uint32_t numTaps = S->numTaps;                 /* Number of taps */
   uint32_t i, tapCnt, blkCnt, outBlockSize = blockSize / S->M;  /* Loop counters */
 
@@ -95,9 +100,70 @@ void riscv_fir_decimate_q31(
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = S->pState + (numTaps - 1u);
 
+#if defined (USE_DSP_RISCV)
+
+  /* Compute 4 outputs at a time, M samples apart in the state buffer, so that each
+   * coefficient is loaded once for four multiply-accumulates. */
+  blkCnt = outBlockSize >> 2;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy 4 times the decimation factor number of new input samples into the state buffer */
+    i = 4u * S->M;
+
+    do
+    {
+      *pStateCurnt++ = *pSrc++;
+
+    } while(--i);
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+    px = pState;
+    px1 = px + S->M;
+    px2 = px1 + S->M;
+    px3 = px2 + S->M;
+
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+
+    while(tapCnt > 0u)
+    {
+      c0 = *pb++;
+
+      sum0 += (q63_t) *px++ * c0;
+      sum1 += (q63_t) *px1++ * c0;
+      sum2 += (q63_t) *px2++ * c0;
+      sum3 += (q63_t) *px3++ * c0;
+
+      tapCnt--;
+    }
+
+    /* Advance the state pointer by 4 times the decimation factor */
+    pState = pState + (4u * S->M);
+
+    *pDst++ = (q31_t) (sum0 >> 31);
+    *pDst++ = (q31_t) (sum1 >> 31);
+    *pDst++ = (q31_t) (sum2 >> 31);
+    *pDst++ = (q31_t) (sum3 >> 31);
+
+    blkCnt--;
+  }
+
+  /* The remaining 0 to 3 outputs one at a time */
+  blkCnt = outBlockSize & 3u;
+
+#else
+
   /* Total number of output samples to be computed */
   blkCnt = outBlockSize;
 
+#endif /* #if defined (USE_DSP_RISCV) */
+
   while(blkCnt > 0u)
   {
     /* Copy decimation factor number of new input samples into the state buffer */
@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_design_f32.c
+*
+* Description:  Windowed-sinc design of floating-point FIR coefficients.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FilterDesign Filter Design
+ *
+ * \par
+ * The design functions compute filter coefficients on the device, for products that retune their
+ * filters at run time, directly in the layout the filter init functions take:
+ * - riscv_fir_design_f32() computes windowed-sinc lowpass, highpass, bandpass and bandstop FIR
+ *   filters for riscv_fir_init_f32() and the other floating-point FIR filters,
+ * - riscv_biquad_design_f32() computes one second order section of the Audio EQ Cookbook (RBJ)
+ *   for riscv_biquad_cascade_df2T_init_f32() and riscv_biquad_cascade_df1_init_f32().
+ * \par
+ * The sines and cosines come from riscv_sin_f32() and riscv_cos_f32(), the gains from
+ * riscv_vexp_f32(), so no function of the C library is called.  Frequencies are normalized to the
+ * sample rate, <code>0 < f < 0.5</code>.
+ * \par
+ * Fixed-point coefficients are converted from the floating-point ones with riscv_float_to_q31()
+ * or riscv_float_to_q15().
+ */
+
+/**
+ * @addtogroup FilterDesign
+ * @{
+ */
+
+/**
+* @brief  Tap n of the windowed ideal lowpass filter of cut-off fc.
+*/
+
+static float32_t riscv_fir_design_tap_f32(
+  uint32_t n,
+  uint32_t numTaps,
+  float32_t fc,
+  const float32_t * pWindow)
+{
+  float32_t m = (float32_t) n - (0.5f * (float32_t) (numTaps - 1u));   /* Distance to the centre */
+  float32_t h, w;
+
+  h = (m == 0.0f) ? (2.0f * fc) : (riscv_sin_f32(2.0f * PI * fc * m) / (PI * m));
+
+  if(pWindow != NULL)
+  {
+    w = pWindow[n];
+  }
+  else if(numTaps > 1u)
+  {
+    /*  Hamming window */
+    w = 0.54f - (0.46f * riscv_cos_f32((2.0f * PI * (float32_t) n) / (float32_t) (numTaps - 1u)));
+  }
+  else
+  {
+    w = 1.0f;
+  }
+
+  return (h * w);
+}
+
+/**
+* @brief  Adds scale times the windowed lowpass filter of cut-off fc and unity gain at DC to pDst.
+*/
+
+static void riscv_fir_design_lowpass_f32(
+  uint32_t numTaps,
+  float32_t fc,
+  const float32_t * pWindow,
+  float32_t scale,
+  float32_t * pDst)
+{
+  uint32_t half = numTaps / 2u;                  /* Taps on either side of the centre */
+  uint32_t n;
+  float32_t sum = 0.0f, h;
+
+  /*  The taps are symmetric, only the first half is computed */
+  for (n = 0u; n < half; n++)
+  {
+    sum += riscv_fir_design_tap_f32(n, numTaps, fc, pWindow);
+  }
+  sum *= 2.0f;
+  if((numTaps & 1u) != 0u)
+  {
+    sum += riscv_fir_design_tap_f32(half, numTaps, fc, pWindow);
+  }
+
+  scale /= sum;
+
+  for (n = 0u; n < half; n++)
+  {
+    h = scale * riscv_fir_design_tap_f32(n, numTaps, fc, pWindow);
+    pDst[n] += h;
+    pDst[numTaps - 1u - n] += h;
+  }
+  if((numTaps & 1u) != 0u)
+  {
+    pDst[half] += scale * riscv_fir_design_tap_f32(half, numTaps, fc, pWindow);
+  }
+}
+
+/**
+* @brief  Windowed-sinc design of a floating-point FIR filter.
+* @param[in]  type      response of the filter.
+* @param[in]  numTaps   number of filter coefficients, odd for the highpass and bandstop responses.
+* @param[in]  f1        cut-off frequency, lower edge of the band for the band responses.
+* @param[in]  f2        upper edge of the band, ignored by the lowpass and highpass responses.
+* @param[in]  *pWindow  points to a window of <code>numTaps</code> values, or NULL for a Hamming window.
+* @param[out] *pCoeffs  points to the <code>numTaps</code> filter coefficients.
+* @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the frequencies are not
+* <code>0 < f1 < f2 < 0.5</code> or <code>numTaps</code> is not supported.
+*
+* \par
+* The lowpass response is the ideal lowpass <code>2*f1*sinc(2*f1*(n-(numTaps-1)/2))</code> times
+* the window, scaled to unity gain at DC.  The highpass response is a unit impulse minus the
+* lowpass, the bandpass response the difference of the lowpass responses of <code>f2</code> and
+* <code>f1</code> and the bandstop response a unit impulse minus the bandpass.  The frequencies are
+* the -6 dB points.
+* \par
+* The coefficients are symmetric, so they are also in the time reversed order of
+* riscv_fir_init_f32().  Precomputed window tables save the cosines of the default window; the
+* window is applied as given, it should be symmetric too.
+*/
+
+riscv_status riscv_fir_design_f32(
+  riscv_fir_design_type type,
+  uint16_t numTaps,
+  float32_t f1,
+  float32_t f2,
+  const float32_t * pWindow,
+  float32_t * pCoeffs)
+{
+  RISCV_PROFILE(riscv_fir_design_f32);
+  uint32_t centre = ((uint32_t) numTaps - 1u) / 2u;  /* Tap of the unit impulse */
+  uint32_t band = ((type == RISCV_FIR_DESIGN_BANDPASS) || (type == RISCV_FIR_DESIGN_BANDSTOP)) ? 1u : 0u;
+  uint32_t inverted = ((type == RISCV_FIR_DESIGN_HIGHPASS) || (type == RISCV_FIR_DESIGN_BANDSTOP)) ? 1u : 0u;
+
+  if((numTaps == 0u) || (f1 <= 0.0f) || (f1 >= 0.5f) ||
+     ((band != 0u) && ((f2 <= f1) || (f2 >= 0.5f))) ||
+     ((inverted != 0u) && ((numTaps & 1u) == 0u)))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  riscv_fill_f32(0.0f, pCoeffs, numTaps);
+
+  if(band != 0u)
+  {
+    riscv_fir_design_lowpass_f32(numTaps, f2, pWindow, 1.0f, pCoeffs);
+    riscv_fir_design_lowpass_f32(numTaps, f1, pWindow, -1.0f, pCoeffs);
+  }
+  else
+  {
+    riscv_fir_design_lowpass_f32(numTaps, f1, pWindow, 1.0f, pCoeffs);
+  }
+
+  /*  Spectral inversion, numTaps is odd */
+  if(inverted != 0u)
+  {
+    riscv_negate_f32(pCoeffs, pCoeffs, numTaps);
+    pCoeffs[centre] += 1.0f;
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of FilterDesign group
+*/
@@ -131,17 +131,31 @@
 * @param[in]  blockSize number of samples to process per call.  
 * @return     none.  
 *  
+* \par
+* With USE_DSP_RISCV four outputs are computed per pass instead of eight: the state samples rotate through
+* four registers, every load goes through the post-incremented state or coefficient pointer and every loop
+* is a counted loop without exits, the form the PULP compiler maps to lp.setup hardware loops of
+* post-increment loads.  The taps of each output are summed in the same order in both builds.
 */
 
 
 
 
+RISCV_DSP_FASTCODE(riscv_fir_f32)
 void riscv_fir_f32(
 const riscv_fir_instance_f32 * S,
 float32_t * pSrc,
 float32_t * pDst,
 uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_f32);
+
+  /* Kernel specialized for numTaps, see riscv_fir_fixed.h */
+  if(S->pKernel != NULL)
+  {
+    S->pKernel(S, pSrc, pDst, blockSize);
+    return;
+  }
    float32_t *pState = S->pState;                 /* State pointer */
    float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
    float32_t *pStateCurnt;                        /* Points to the current sample of the state */
@@ -164,6 +178,91 @@ uint32_t blockSize)
     *    acc2 =  b[numTaps-1] * x[n-numTaps+1] + b[numTaps-2] * x[n-numTaps] +   b[numTaps-3] * x[n-numTaps-1] +...+ b[0] * x[2]  
     *    acc3 =  b[numTaps-1] * x[n-numTaps+2] + b[numTaps-2] * x[n-numTaps+1] + b[numTaps-3] * x[n-numTaps]   +...+ b[0] * x[3]  
     */
+#if defined (USE_DSP_RISCV)
+
+   /* Four outputs per pass, acc0 ... acc3 hold y[n] ... y[n+3] */
+   for (blkCnt = blockSize >> 2u; blkCnt > 0u; blkCnt--)
+   {
+      /* Copy four new input samples into the state buffer */
+      *pStateCurnt++ = *pSrc++;
+      *pStateCurnt++ = *pSrc++;
+      *pStateCurnt++ = *pSrc++;
+      *pStateCurnt++ = *pSrc++;
+
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      px = pState;
+      pb = pCoeffs;
+
+      /* x0 ... x2 hold the oldest samples of the window of the next tap */
+      x0 = *px++;
+      x1 = *px++;
+      x2 = *px++;
+
+      /* Four taps per iteration, the registers rotate so that no sample is moved */
+      for (tapCnt = numTaps >> 2u; tapCnt > 0u; tapCnt--)
+      {
+         c0 = *pb++;
+         x3 = *px++;
+         acc0 += x0 * c0;
+         acc1 += x1 * c0;
+         acc2 += x2 * c0;
+         acc3 += x3 * c0;
+
+         c0 = *pb++;
+         x0 = *px++;
+         acc0 += x1 * c0;
+         acc1 += x2 * c0;
+         acc2 += x3 * c0;
+         acc3 += x0 * c0;
+
+         c0 = *pb++;
+         x1 = *px++;
+         acc0 += x2 * c0;
+         acc1 += x3 * c0;
+         acc2 += x0 * c0;
+         acc3 += x1 * c0;
+
+         c0 = *pb++;
+         x2 = *px++;
+         acc0 += x3 * c0;
+         acc1 += x0 * c0;
+         acc2 += x1 * c0;
+         acc3 += x2 * c0;
+      }
+
+      /* Remaining 0 to 3 taps */
+      for (tapCnt = numTaps & 3u; tapCnt > 0u; tapCnt--)
+      {
+         c0 = *pb++;
+         x3 = *px++;
+         acc0 += x0 * c0;
+         acc1 += x1 * c0;
+         acc2 += x2 * c0;
+         acc3 += x3 * c0;
+
+         x0 = x1;
+         x1 = x2;
+         x2 = x3;
+      }
+
+      /* Advance the state pointer by 4 to process the next group of 4 samples */
+      pState = pState + 4;
+
+      *pDst++ = acc0;
+      *pDst++ = acc1;
+      *pDst++ = acc2;
+      *pDst++ = acc3;
+   }
+
+   /* Remaining 0 to 3 output samples */
+   blkCnt = blockSize & 3u;
+
+#else
+
    blkCnt = blockSize >> 3;
 
    /* First part of the processing with loop unrolling.  Compute 8 outputs at a time.  
@@ -497,6 +596,8 @@ uint32_t blockSize)
    ** No loop unrolling is used. */
    blkCnt = blockSize % 0x8u;
 
+#endif
+
    while(blkCnt > 0u)
    {
       /* Copy one sample at a time into state buffer */
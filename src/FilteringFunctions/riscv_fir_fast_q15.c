@@ -77,6 +77,9 @@ void riscv_fir_fast_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_fast_q15);
+  RISCV_SAT_STATS(riscv_fir_fast_q15, 16);
+#if defined (USE_DSP_RISCV)
   q15_t *pState = S->pState;                     /* State pointer */
   q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
   q15_t *pStateCurnt;                            /* Points to the current sample of the state */
@@ -215,14 +218,14 @@ void riscv_fir_fast_q15(
     /* The results in the 4 accumulators are in 2.30 format.  Convert to 1.15 with saturation.       
      ** Then store the 4 outputs in the destination buffer. */
 /*
-    *pDst++ = (q15_t) (clip((acc0 >> 15), -32768,32767));
-    *pDst++ = (q15_t) (clip((acc1 >> 15), -32768,32767));
-    *pDst++ = (q15_t) (clip((acc2 >> 15), -32768,32767));
-    *pDst++ = (q15_t) (clip((acc3 >> 15), -32768,32767));
+    *pDst++ = (q15_t) (clip(RISCV_SAT(acc0 >> 15), -32768,32767));
+    *pDst++ = (q15_t) (clip(RISCV_SAT(acc1 >> 15), -32768,32767));
+    *pDst++ = (q15_t) (clip(RISCV_SAT(acc2 >> 15), -32768,32767));
+    *pDst++ = (q15_t) (clip(RISCV_SAT(acc3 >> 15), -32768,32767));
 */
-    *(shortV*)pDst =  pack2(clip((acc0 >> 15), -32768,32767) , clip((acc1 >> 15), -32768,32767) );
+    *(shortV*)pDst =  pack2(clip(RISCV_SAT(acc0 >> 15), -32768,32767) , clip(RISCV_SAT(acc1 >> 15), -32768,32767) );
     pDst+=2;
-    *(shortV*)pDst =  pack2(clip((acc2 >> 15), -32768,32767) , clip((acc3 >> 15), -32768,32767) );
+    *(shortV*)pDst =  pack2(clip(RISCV_SAT(acc2 >> 15), -32768,32767) , clip(RISCV_SAT(acc3 >> 15), -32768,32767) );
     pDst+=2;
     /* Advance the state pointer by 4 to process the next group of 4 samples */
     pState = pState + 4u;
@@ -260,7 +263,7 @@ void riscv_fir_fast_q15(
 
     /* The result is in 2.30 format.  Convert to 1.15 with saturation.      
      ** Then store the output in the destination buffer. */
-    *pDst++ = (q15_t) (clip((acc0 >> 15), -32768,32767));
+    *pDst++ = (q15_t) (clip(RISCV_SAT(acc0 >> 15), -32768,32767));
     /* Advance state pointer by 1 for the next sample */
     pState = pState + 1u;
     /* Decrement the loop counter */
@@ -301,6 +304,79 @@ void riscv_fir_fast_q15(
     tapCnt--;
   }
 
+#else
+
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px;                                     /* Temporary pointer for state buffer */
+  q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+  q31_t acc;                                     /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1u)]);
+
+  /* Initialize blkCnt with blockSize */
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy one sample at a time into state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set the accumulator to zero */
+    acc = 0;
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize Coefficient pointer */
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+
+    /* Perform the multiply-accumulates */
+    do
+    {
+      /* acc =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + b[numTaps-3] * x[n-numTaps-3] +...+ b[0] * x[0] */
+      acc += (q31_t) * px++ * *pb++;
+      tapCnt--;
+    } while(tapCnt > 0u);
+
+    /* The result is in 2.30 format.  Convert to 1.15 with saturation.
+     ** Then store the output in the destination buffer. */
+    *pDst++ = (q15_t) __SSAT(RISCV_SAT(acc >> 15), 16);
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1;
+
+    /* Decrement the samples loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the satrt of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Copy numTaps number of values */
+  tapCnt = (numTaps - 1u);
+
+  /* copy data */
+  while(tapCnt > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    tapCnt--;
+  }
+
+#endif
 }
 
 /**    
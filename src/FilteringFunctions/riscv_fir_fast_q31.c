@@ -79,6 +79,7 @@ void riscv_fir_fast_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_fast_q31);
   q31_t *pState = S->pState;                     /* State pointer */
   q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
   q31_t *pStateCurnt;                            /* Points to the current sample of the state */
@@ -94,6 +95,8 @@ void riscv_fir_fast_q31(
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = &(S->pState[(numTaps - 1u)]);
 
+#if defined (RISCV_MATH_LOOPUNROLL)
+
   /* Apply loop unrolling and compute 4 output values simultaneously.    
    * The variables acc0 ... acc3 hold output values that are being computed:    
    *    
@@ -245,6 +248,13 @@ void riscv_fir_fast_q31(
    ** No loop unrolling is used. */
   blkCnt = blockSize % 4u;
 
+#else
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (RISCV_MATH_LOOPUNROLL) */
+
   while(blkCnt > 0u)
   {
     /* Copy one sample at a time into state buffer */
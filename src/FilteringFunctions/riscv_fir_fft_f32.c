@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_fft_f32.c
+*
+* Description:  Floating-point fast convolution FIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_FFT Fast Convolution FIR Filter
+ *
+ * \par
+ * The fast convolution FIR filter computes the same output as riscv_fir_f32() with real FFTs,
+ * which pays off for long filters: riscv_fir_f32() costs <code>numTaps</code> multiply-accumulates
+ * per sample, the fast convolution filter a few FFT operations per sample plus
+ * <code>numTaps/blockSize</code> complex multiplications per frequency bin.
+ * \par Algorithm
+ * The filter uses uniformly partitioned overlap-save convolution.  The impulse response is split
+ * into <code>numPartitions</code> partitions of <code>blockSize</code> taps and the spectrum
+ * <code>H[p]</code> of every partition, zero padded to <code>2*blockSize</code> points, is computed
+ * with riscv_rfft_fast_f32() at the initialization.  For every partition of <code>blockSize</code>
+ * input samples the filter
+ * - computes the spectrum <code>X[t]</code> of the last <code>2*blockSize</code> input samples and
+ *   stores it in a frequency-domain delay line that holds the last <code>numPartitions</code> spectra,
+ * - accumulates <code>Y = X[t]*H[0] + X[t-1]*H[1] + ... + X[t-numPartitions+1]*H[numPartitions-1]</code>
+ *   with riscv_cmplx_mult_cmplx_f32() and riscv_add_f32(),
+ * - returns the last <code>blockSize</code> samples of the inverse real FFT of <code>Y</code>.
+ * \par
+ * The output has no extra delay: the output of a partition depends on its own input samples, as
+ * with riscv_fir_f32().  A shorter <code>blockSize</code> reduces the work per call, a longer
+ * <code>blockSize</code> reduces the work per sample.  For 512 to 1024 taps, a
+ * <code>blockSize</code> of 64 to 256 is a good start.
+ * \par
+ * The Q31 filter converts the input to floating-point and uses the same floating-point engine,
+ * the output is converted back to Q31 with saturation.
+ * \par Instance Structure
+ * The coefficient spectra, the delay line and the work buffers are all stored in the state buffer.
+ * A separate instance structure must be defined for each filter.
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+* @brief  Filters one partition of the fast convolution FIR filter.
+* @param[in,out] *S points to an instance of the floating-point fast convolution FIR structure.
+* @return none.
+*
+* The new <code>blockSize</code> input samples must be stored in the second half of the input
+* buffer, the output samples are returned in the second half of the last work buffer.
+* This function is also used by riscv_fir_fft_q31().
+*/
+
+void riscv_fir_fft_partition_f32(
+  riscv_fir_fft_instance_f32 * S)
+{
+  uint32_t blockSize = S->blockSize;             /* Partition length */
+  uint32_t fftLen = 2u * blockSize;              /* Length of the real FFT */
+  uint32_t numPartitions = S->numPartitions;
+  uint32_t slot = S->fdlIndex;                   /* Delay line slot of the new spectrum */
+  uint32_t p;
+  const float32_t *pH = S->pState;               /* Partition spectra */
+  float32_t *pFdl = S->pState + (numPartitions * fftLen);  /* Frequency-domain delay line */
+  float32_t *pIn = pFdl + (numPartitions * fftLen);        /* Input of the last two partitions */
+  float32_t *pAcc = pIn + fftLen;                /* Spectrum of the output */
+  float32_t *pScratch = pAcc + fftLen;           /* Work buffer */
+  float32_t *pX, *pY;
+
+  /*  Spectrum of the last 2*blockSize input samples, the real FFT overwrites its input */
+  riscv_copy_f32(pIn, pScratch, fftLen);
+  riscv_rfft_fast_f32(&S->Srfft, pScratch, pFdl + (slot * fftLen), 0u);
+
+  /*  Keep the new samples for the next partition */
+  riscv_copy_f32(pIn + blockSize, pIn, blockSize);
+
+  /*  Y = sum of X[t-p] * H[p] */
+  for (p = 0u; p < numPartitions; p++)
+  {
+    pX = pFdl + (slot * fftLen);
+    pY = (p == 0u) ? pAcc : pScratch;
+
+    riscv_cmplx_mult_cmplx_f32(pX, (float32_t *) pH, pY, blockSize);
+
+    /*  DC and Nyquist bins are real and packed in the first pair */
+    pY[0] = pX[0] * pH[0];
+    pY[1] = pX[1] * pH[1];
+
+    if(p != 0u)
+    {
+      riscv_add_f32(pAcc, pScratch, pAcc, fftLen);
+    }
+
+    pH += fftLen;
+    slot = (slot == 0u) ? (numPartitions - 1u) : (slot - 1u);
+  }
+
+  /*  The next spectrum replaces the oldest one */
+  slot = (uint32_t) S->fdlIndex + 1u;
+  S->fdlIndex = (uint16_t) ((slot == numPartitions) ? 0u : slot);
+
+  /*  Overlap-save: only the second half of the circular convolution is kept */
+  riscv_rfft_fast_f32(&S->Srfft, pAcc, pScratch, 1u);
+}
+
+/**
+* @brief  Processing function for the floating-point fast convolution FIR filter.
+* @param[in,out] *S          points to an instance of the floating-point fast convolution FIR structure.
+* @param[in]     *pSrc       points to the block of input data.
+* @param[out]    *pDst       points to the block of output data.
+* @param[in]     blockSize   number of samples to process, a multiple of the <code>blockSize</code> given to riscv_fir_fft_init_f32().
+* @return none.
+*
+* The output equals the output of riscv_fir_f32() with the same coefficients, to the rounding of the FFTs.
+* <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+*/
+
+void riscv_fir_fft_f32(
+  riscv_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_fft_f32);
+  uint32_t partLen = S->blockSize;               /* Partition length */
+  float32_t *pIn;                                /* New half of the input buffer */
+  float32_t *pOut;                               /* Output half of the last work buffer */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  pIn = S->pState + ((2u * (uint32_t) S->numPartitions + 1u) * 2u * partLen) - partLen;
+  pOut = pIn + (4u * partLen);
+
+  for (blkCnt = blockSize / partLen; blkCnt > 0u; blkCnt--)
+  {
+    riscv_copy_f32(pSrc, pIn, partLen);
+
+    riscv_fir_fft_partition_f32(S);
+
+    riscv_copy_f32(pOut, pDst, partLen);
+
+    pSrc += partLen;
+    pDst += partLen;
+  }
+}
+
+/**
+* @} end of FIR_FFT group
+*/
@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_fft_init_f32.c
+*
+* Description:  Initialization function for the floating-point fast
+*               convolution FIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point fast convolution FIR filter.
+* @param[in,out] *S         points to an instance of the floating-point fast convolution FIR structure.
+* @param[in]     numTaps    number of filter coefficients in the filter.
+* @param[in]     *pCoeffs   points to the filter coefficients, in the order of riscv_fir_init_f32().
+* @param[in]     *pState    points to the state buffer.
+* @param[in]     blockSize  length of a partition, a power of two from 16 to 2048.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>numTaps</code> is 0 or <code>blockSize</code> is not supported.
+*
+* <b>Description:</b>
+* \par
+* <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+* <pre>
+*    {b[numTaps-1], b[numTaps-2], ..., b[1], b[0]}
+* </pre>
+* The coefficients are split into <code>numPartitions = ceil(numTaps/blockSize)</code> partitions
+* and their spectra are stored in <code>pState</code>, so <code>pCoeffs</code> is not used after
+* the initialization.
+* \par
+* <code>pState</code> is of length <code>2*blockSize*(2*numPartitions+3)</code> words and holds the
+* spectra of the partitions, the frequency-domain delay line of the input spectra, the input of the
+* last two partitions and two work buffers.  The delay line and the input are cleared.
+*/
+
+riscv_status riscv_fir_fft_init_f32(
+  riscv_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_fft_init_f32);
+  float32_t *pH, *pFdl, *pAcc;                   /* Partition spectra, delay line and work buffer */
+  uint32_t fftLen = 2u * blockSize;              /* Length of the real FFT */
+  uint32_t numPartitions, p, i, n;
+  riscv_status status;
+
+  if((numTaps == 0u) || (blockSize < 16u) || (blockSize > 2048u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  The real FFT init rejects the lengths that are not a power of two */
+  status = riscv_rfft_fast_init_f32(&S->Srfft, (uint16_t) fftLen);
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  numPartitions = (numTaps + blockSize - 1u) / blockSize;
+
+  S->numTaps = numTaps;
+  S->blockSize = (uint16_t) blockSize;
+  S->numPartitions = (uint16_t) numPartitions;
+  S->fdlIndex = 0u;
+  S->pState = pState;
+
+  pH = pState;
+  pFdl = pH + (numPartitions * fftLen);
+  pAcc = pFdl + (numPartitions * fftLen) + fftLen;
+
+  /*  Spectrum of every partition b[p*blockSize] ... b[p*blockSize+blockSize-1], zero padded to fftLen.
+   *  pCoeffs is only read here, before the delay line is cleared. */
+  for (p = 0u; p < numPartitions; p++)
+  {
+    for (i = 0u; i < blockSize; i++)
+    {
+      n = (p * blockSize) + i;
+      pAcc[i] = (n < numTaps) ? pCoeffs[numTaps - 1u - n] : 0.0f;
+    }
+    riscv_fill_f32(0.0f, pAcc + blockSize, blockSize);
+
+    riscv_rfft_fast_f32(&S->Srfft, pAcc, pH, 0u);
+    pH += fftLen;
+  }
+
+  /*  Clear the delay line and the input */
+  riscv_fill_f32(0.0f, pFdl, (numPartitions + 1u) * fftLen);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of FIR_FFT group
+*/
@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_fft_init_q31.c
+*
+* Description:  Initialization function for the Q31 fast convolution
+*               FIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q31 fast convolution FIR filter.
+* @param[in,out] *S         points to an instance of the Q31 fast convolution FIR structure.
+* @param[in]     numTaps    number of filter coefficients in the filter.
+* @param[in]     *pCoeffs   points to the filter coefficients, in the order of riscv_fir_init_q31().
+* @param[in]     *pState    points to the state buffer.
+* @param[in]     blockSize  length of a partition, a power of two from 16 to 2048.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>numTaps</code> is 0 or <code>blockSize</code> is not supported.
+*
+* <b>Description:</b>
+* \par
+* The coefficients are converted to floating-point and the filter is set up as with riscv_fir_fft_init_f32(),
+* <code>pState</code> is a floating-point buffer of the same length <code>2*blockSize*(2*numPartitions+3)</code>.
+*/
+
+riscv_status riscv_fir_fft_init_q31(
+  riscv_fir_fft_instance_q31 * S,
+  uint16_t numTaps,
+  const q31_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_fft_init_q31);
+  uint32_t numPartitions;
+
+  if((numTaps == 0u) || (blockSize < 16u) || (blockSize > 2048u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  The converted coefficients are kept in the delay line, which riscv_fir_fft_init_f32()
+   *  only clears after it has computed the spectra of the partitions */
+  numPartitions = (numTaps + blockSize - 1u) / blockSize;
+  riscv_q31_to_float((q31_t *) pCoeffs, pState + (numPartitions * 2u * blockSize), numTaps);
+
+  return (riscv_fir_fft_init_f32(&S->Sfft, numTaps, pState + (numPartitions * 2u * blockSize), pState, blockSize));
+}
+
+/**
+* @} end of FIR_FFT group
+*/
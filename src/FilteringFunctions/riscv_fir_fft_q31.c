@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_fft_q31.c
+*
+* Description:  Q31 fast convolution FIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+extern void riscv_fir_fft_partition_f32(
+  riscv_fir_fft_instance_f32 * S);
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+* @brief  Processing function for the Q31 fast convolution FIR filter.
+* @param[in,out] *S          points to an instance of the Q31 fast convolution FIR structure.
+* @param[in]     *pSrc       points to the block of input data.
+* @param[out]    *pDst       points to the block of output data.
+* @param[in]     blockSize   number of samples to process, a multiple of the <code>blockSize</code> given to riscv_fir_fft_init_q31().
+* @return none.
+*
+* <b>Scaling and Overflow Behavior:</b>
+* \par
+* The input is converted to floating-point and filtered by the floating-point engine, so the accuracy is the
+* 24-bit mantissa of float32_t rather than the 64-bit accumulator of riscv_fir_q31().
+* The output is converted back to Q31 and saturated.
+* <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+*/
+
+void riscv_fir_fft_q31(
+  riscv_fir_fft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_fft_q31);
+  uint32_t partLen = S->Sfft.blockSize;          /* Partition length */
+  float32_t *pIn;                                /* New half of the input buffer */
+  float32_t *pOut;                               /* Output half of the last work buffer */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  pIn = S->Sfft.pState + ((2u * (uint32_t) S->Sfft.numPartitions + 1u) * 2u * partLen) - partLen;
+  pOut = pIn + (4u * partLen);
+
+  for (blkCnt = blockSize / partLen; blkCnt > 0u; blkCnt--)
+  {
+    riscv_q31_to_float(pSrc, pIn, partLen);
+
+    riscv_fir_fft_partition_f32(&S->Sfft);
+
+    riscv_float_to_q31(pOut, pDst, partLen);
+
+    pSrc += partLen;
+    pDst += partLen;
+  }
+}
+
+/**
+* @} end of FIR_FFT group
+*/
@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_fixed.c
+*
+* Description:  FIR kernels specialized for the tap counts the library is
+*               configured with, and their lookup by the init functions.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_fir_fixed.h>
+
+/*
+* RISCV_FIR_FIXED_TAPS(X) expands X(numTaps) for every specialized tap
+* count.  CMake writes it from RISCV_DSP_FIR_FIXED_TAPS into the header
+* named by RISCV_FIR_FIXED_CONFIG, without it no kernel is specialized.
+*/
+#if defined (RISCV_FIR_FIXED_CONFIG)
+#include RISCV_FIR_FIXED_CONFIG
+#endif
+
+#ifndef RISCV_FIR_FIXED_TAPS
+#define RISCV_FIR_FIXED_TAPS(X)
+#endif
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+#define RISCV_FIR_FIXED_DEFINE(N)                                                  \
+  static RISCV_FIR_FIXED_F32(riscv_fir_fixed_##N##_f32, N##u, S->pCoeffs)          \
+  static RISCV_FIR_FIXED_Q31(riscv_fir_fixed_##N##_q31, N##u, S->pCoeffs)          \
+  static RISCV_FIR_FIXED_Q15(riscv_fir_fixed_##N##_q15, N##u, S->pCoeffs)
+
+RISCV_FIR_FIXED_TAPS(RISCV_FIR_FIXED_DEFINE)
+
+#define RISCV_FIR_FIXED_CASE_F32(N)  case N##u: kernel = riscv_fir_fixed_##N##_f32; break;
+#define RISCV_FIR_FIXED_CASE_Q31(N)  case N##u: kernel = riscv_fir_fixed_##N##_q31; break;
+#define RISCV_FIR_FIXED_CASE_Q15(N)  case N##u: kernel = riscv_fir_fixed_##N##_q15; break;
+
+/**
+ * @brief  Specialized floating-point kernel for a tap count.
+ * @param[in]  numTaps  number of filter coefficients.
+ * @return     the kernel, or NULL if the library has none for <code>numTaps</code>.
+ */
+
+riscv_fir_kernel_f32 riscv_fir_fixed_find_f32(
+  uint16_t numTaps)
+{
+  RISCV_PROFILE(riscv_fir_fixed_find_f32);
+  riscv_fir_kernel_f32 kernel = NULL;
+
+  switch (numTaps)
+  {
+    RISCV_FIR_FIXED_TAPS(RISCV_FIR_FIXED_CASE_F32)
+    default:
+      break;
+  }
+
+  return (kernel);
+}
+
+/**
+ * @brief  Specialized Q31 kernel for a tap count.
+ * @param[in]  numTaps  number of filter coefficients.
+ * @return     the kernel, or NULL if the library has none for <code>numTaps</code>.
+ */
+
+riscv_fir_kernel_q31 riscv_fir_fixed_find_q31(
+  uint16_t numTaps)
+{
+  RISCV_PROFILE(riscv_fir_fixed_find_q31);
+  riscv_fir_kernel_q31 kernel = NULL;
+
+  switch (numTaps)
+  {
+    RISCV_FIR_FIXED_TAPS(RISCV_FIR_FIXED_CASE_Q31)
+    default:
+      break;
+  }
+
+  return (kernel);
+}
+
+/**
+ * @brief  Specialized Q15 kernel for a tap count.
+ * @param[in]  numTaps  number of filter coefficients.
+ * @return     the kernel, or NULL if the library has none for <code>numTaps</code>.
+ */
+
+riscv_fir_kernel_q15 riscv_fir_fixed_find_q15(
+  uint16_t numTaps)
+{
+  RISCV_PROFILE(riscv_fir_fixed_find_q15);
+  riscv_fir_kernel_q15 kernel = NULL;
+
+  switch (numTaps)
+  {
+    RISCV_FIR_FIXED_TAPS(RISCV_FIR_FIXED_CASE_Q15)
+    default:
+      break;
+  }
+
+  return (kernel);
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_halfband_decimate_f32.c
+*
+* Description:  Floating-point half-band FIR decimator by 2.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_halfband Half-Band FIR Decimator and Interpolator
+ *
+ * Specializations of the FIR decimator and interpolator for the factor 2 and half-band filters.
+ * A half-band filter of <code>numTaps = 4*K-1</code> taps is symmetric and every other tap
+ * except the center one is zero:
+ * <pre>
+ *    h[C] = center,  h[C-2*j] = h[C+2*j] = 0 for j = 1 ... K-1,  C = (numTaps-1)/2
+ * </pre>
+ * The filters skip the zero taps and add the two samples of a symmetric pair before the
+ * multiplication, so that an output of the decimator costs <code>K+1</code> multiplications
+ * where riscv_fir_decimate_f32() with <code>M = 2</code> spends <code>numTaps</code>, about a
+ * quarter.  The interpolator computes its two phases with <code>K</code> multiplications and with
+ * one, against <code>2*K</code> each in riscv_fir_interpolate_f32().
+ * \par
+ * <code>pCoeffs</code> holds only the taps that are not zero, the <code>K</code> taps
+ * <code>h[0], h[2], ..., h[C-1]</code> of the first half followed by the center tap
+ * <code>h[C]</code>, <code>(numTaps+5)/4</code> values.  For the full set of coefficients of the
+ * general functions these are <code>pCoeffs[2*k]</code> and <code>pCoeffs[C]</code>.
+ * \par
+ * The outputs are those of riscv_fir_decimate_X() with <code>M = 2</code> and of
+ * riscv_fir_interpolate_X() with <code>L = 2</code> for the full coefficients, in the same order,
+ * and the state buffers have the same length.  The Q15 and Q31 outputs are bit-exact with those
+ * functions, the floating-point ones differ by the rounding of the pair sums.  As for
+ * riscv_fir_interpolate_X() the coefficients carry the gain of the interpolator, a half-band
+ * designed for a gain of 1 gives outputs of half the amplitude of the input.
+ * \par
+ * The xpulp path of the Q15 decimator gathers the even samples of two outputs with shuffles and
+ * multiplies two taps per <code>pv.dotsp.h</code>, the one of the Q15 interpolator two taps of a
+ * half per <code>pv.dotsp.h</code>.  As in riscv_fir_q15() the 32-bit sum of one
+ * <code>pv.dotsp.h</code> wraps when both of its products are <code>0x8000 * 0x8000</code>.
+ */
+
+/**
+ * @addtogroup FIR_halfband
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point half-band FIR decimator.
+ * @param[in]     *S          points to an instance of the floating-point half-band FIR structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of <code>blockSize/2</code> output samples.
+ * @param[in]     blockSize   number of input samples to process, even.
+ */
+
+void riscv_fir_halfband_decimate_f32(
+  const riscv_fir_halfband_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_halfband_decimate_f32);
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pe;                            /* First and last sample of the window */
+  float32_t acc;                                 /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps */
+  uint32_t numPairs = (numTaps + 1u) >> 2u;      /* Symmetric pairs of taps that are not zero */
+  uint32_t center = (numTaps - 1u) >> 1u;        /* Offset of the center tap */
+  uint32_t i, k, blkCnt;                         /* Loop counters */
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - 1u);
+
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy 2 new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0.0f;
+
+    /* The taps of a symmetric pair share their multiplication, the zero taps are skipped */
+    px = pState;
+    pe = pState + (numTaps - 1u);
+    for (k = 0u; k < numPairs; k++)
+    {
+      acc += pCoeffs[k] * (*px + *pe);
+      px += 2;
+      pe -= 2;
+    }
+
+    /* Center tap */
+    acc += pCoeffs[numPairs] * pState[center];
+
+    *pDst++ = acc;
+
+    /* Advance the state pointer by the decimation factor */
+    pState = pState + 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  i = numTaps - 1u;
+
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+}
+
+/**
+ * @} end of FIR_halfband group
+ */
@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_halfband_decimate_init_q15.c
+*
+* Description:  Initialization function for the Q15 half-band FIR decimator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_halfband
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 half-band FIR decimator.
+ * @param[in,out] *S          points to an instance of the Q15 half-band FIR structure.
+ * @param[in]     numTaps     length of the half-band filter, <code>4*K-1</code>.
+ * @param[in]     *pCoeffs    points to the <code>(numTaps+5)/4</code> taps that are not zero, the first half
+ *                            followed by the center tap.
+ * @param[in]     *pState     points to the state buffer of <code>numTaps+blockSize-1</code> samples.
+ * @param[in]     blockSize   number of input samples to process per call.
+ * @return        RISCV_MATH_SUCCESS, RISCV_MATH_ARGUMENT_ERROR if <code>numTaps</code> is not of the
+ *                form <code>4*K-1</code>, or RISCV_MATH_LENGTH_ERROR if <code>blockSize</code> is odd.
+ */
+
+riscv_status riscv_fir_halfband_decimate_init_q15(
+  riscv_fir_halfband_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_halfband_decimate_init_q15);
+
+  if((numTaps & 3u) != 3u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The size of the input block must be a multiple of the decimation factor */
+  if((blockSize & 1u) != 0u)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  S->numTaps = numTaps;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear the state buffer */
+  memset(pState, 0, (numTaps + blockSize - 1u) * sizeof(q15_t));
+
+  S->pState = pState;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_halfband group
+ */
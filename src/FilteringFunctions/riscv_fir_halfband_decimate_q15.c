@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_halfband_decimate_q15.c
+*
+* Description:  Q15 half-band FIR decimator by 2.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_halfband
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 half-band FIR decimator.
+ * @param[in]     *S          points to an instance of the Q15 half-band FIR structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of <code>blockSize/2</code> output samples.
+ * @param[in]     blockSize   number of input samples to process, even.
+ * \par
+ * The products are accumulated in 64 bits and the output is truncated to 1.15 and saturated,
+ * as in riscv_fir_decimate_q15().
+ */
+
+void riscv_fir_halfband_decimate_q15(
+  const riscv_fir_halfband_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_halfband_decimate_q15);
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pe;                                /* First and last sample of the window */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps */
+  uint32_t numPairs = (numTaps + 1u) >> 2u;      /* Symmetric pairs of taps that are not zero */
+  uint32_t center = (numTaps - 1u) >> 1u;        /* Offset of the center tap */
+  uint32_t i, k, blkCnt;                         /* Loop counters */
+#if defined (USE_DSP_RISCV)
+  shortV even = { 0, 2 };                        /* Even samples of two pairs */
+  shortV swap = { 1, 0 };                        /* Taps of the second half */
+  shortV x0, x1, x2, y0, y1, y2, c, cs;
+  q63_t acc1;
+#endif
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - 1u);
+
+#if defined (USE_DSP_RISCV)
+
+  /* Two outputs per pass, the windows start at px and at px + 2 */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy 4 new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0;
+    acc1 = 0;
+
+    px = pState;
+    pe = pState + (numTaps - 1u);
+
+    /* Samples px[2k] of the first half and pe[-2k] of the second, from both ends inward */
+    x0 = *(shortV *) px;
+    y1 = *(shortV *) pe;
+    y2 = *(shortV *) (pe + 2);
+
+    for (k = 0u; (k + 1u) < numPairs; k += 2u)
+    {
+      c = *(shortV *) (pCoeffs + k);
+      cs = shufflev4(c, c, swap);
+
+      /* (px[2k], px[2k+2]) and (px[2k+2], px[2k+4]) with the taps k and k+1 */
+      x1 = *(shortV *) (px + (2u * k) + 2u);
+      x2 = *(shortV *) (px + (2u * k) + 4u);
+      acc += dotpv2(shufflev4(x0, x1, even), c);
+      acc1 += dotpv2(shufflev4(x1, x2, even), c);
+      x0 = x2;
+
+      /* (pe[-2k-2], pe[-2k]) and (pe[-2k], pe[-2k+2]) with the taps k+1 and k */
+      y0 = *(shortV *) (pe - (2u * k) - 2u);
+      acc += dotpv2(shufflev4(y0, y1, even), cs);
+      acc1 += dotpv2(shufflev4(y1, y2, even), cs);
+      y2 = y0;
+      y1 = *(shortV *) (pe - (2u * k) - 4u);
+    }
+
+    /* Last pair of an odd number of pairs */
+    if(k < numPairs)
+    {
+      acc += (q63_t) pCoeffs[k] * ((q31_t) px[2u * k] + pe[-(int32_t) (2u * k)]);
+      acc1 += (q63_t) pCoeffs[k] * ((q31_t) px[(2u * k) + 2u] + pe[2 - (int32_t) (2u * k)]);
+    }
+
+    /* Center tap */
+    acc += (q31_t) pCoeffs[numPairs] * px[center];
+    acc1 += (q31_t) pCoeffs[numPairs] * px[center + 2u];
+
+    *pDst++ = (q15_t) (__SSAT((acc >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((acc1 >> 15), 16));
+
+    /* Advance the state pointer by two outputs */
+    pState = pState + 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Remaining output of an odd number of outputs */
+  blkCnt = (blockSize >> 1u) & 1u;
+
+#else
+
+  blkCnt = blockSize >> 1u;
+
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* Copy 2 new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0;
+
+    /* The taps of a symmetric pair share their multiplication, the zero taps are skipped */
+    px = pState;
+    pe = pState + (numTaps - 1u);
+    for (k = 0u; k < numPairs; k++)
+    {
+      acc += (q63_t) pCoeffs[k] * ((q31_t) *px + *pe);
+      px += 2;
+      pe -= 2;
+    }
+
+    /* Center tap */
+    acc += (q31_t) pCoeffs[numPairs] * pState[center];
+
+    *pDst++ = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Advance the state pointer by the decimation factor */
+    pState = pState + 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  i = numTaps - 1u;
+
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+}
+
+/**
+ * @} end of FIR_halfband group
+ */
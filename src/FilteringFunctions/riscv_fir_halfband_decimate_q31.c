@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_halfband_decimate_q31.c
+*
+* Description:  Q31 half-band FIR decimator by 2.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_halfband
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 half-band FIR decimator.
+ * @param[in]     *S          points to an instance of the Q31 half-band FIR structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of <code>blockSize/2</code> output samples.
+ * @param[in]     blockSize   number of input samples to process, even.
+ * \par
+ * The products are accumulated in 64 bits and the output is truncated to 1.31, as in
+ * riscv_fir_decimate_q31().  Like there the accumulator can overflow when the pair sums of
+ * full scale samples meet taps close to -1.0.
+ */
+
+void riscv_fir_halfband_decimate_q31(
+  const riscv_fir_halfband_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_halfband_decimate_q31);
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t *px, *pe;                                /* First and last sample of the window */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps */
+  uint32_t numPairs = (numTaps + 1u) >> 2u;      /* Symmetric pairs of taps that are not zero */
+  uint32_t center = (numTaps - 1u) >> 1u;        /* Offset of the center tap */
+  uint32_t i, k, blkCnt;                         /* Loop counters */
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - 1u);
+
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy 2 new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0;
+
+    /* The taps of a symmetric pair share their multiplication, the zero taps are skipped */
+    px = pState;
+    pe = pState + (numTaps - 1u);
+    for (k = 0u; k < numPairs; k++)
+    {
+      acc += ((q63_t) *px + *pe) * pCoeffs[k];
+      px += 2;
+      pe -= 2;
+    }
+
+    /* Center tap */
+    acc += (q63_t) pCoeffs[numPairs] * pState[center];
+
+    *pDst++ = (q31_t) (acc >> 31);
+
+    /* Advance the state pointer by the decimation factor */
+    pState = pState + 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  i = numTaps - 1u;
+
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+}
+
+/**
+ * @} end of FIR_halfband group
+ */
@@ -0,0 +1,60 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_halfband_interpolate_init_f32.c
+*
+* Description:  Initialization function for the floating-point half-band FIR interpolator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_halfband
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point half-band FIR interpolator.
+ * @param[in,out] *S          points to an instance of the floating-point half-band FIR structure.
+ * @param[in]     numTaps     length of the half-band filter, <code>4*K-1</code>.
+ * @param[in]     *pCoeffs    points to the <code>(numTaps+5)/4</code> taps that are not zero, the first half
+ *                            followed by the center tap.
+ * @param[in]     *pState     points to the state buffer of <code>(numTaps+1)/2+blockSize-1</code> samples.
+ * @param[in]     blockSize   number of input samples to process per call.
+ * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>numTaps</code> is not of the
+ *                form <code>4*K-1</code>.
+ */
+
+riscv_status riscv_fir_halfband_interpolate_init_f32(
+  riscv_fir_halfband_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_halfband_interpolate_init_f32);
+
+  if((numTaps & 3u) != 3u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numTaps = numTaps;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear the state buffer */
+  memset(pState, 0, (((numTaps + 1u) >> 1u) + blockSize - 1u) * sizeof(float32_t));
+
+  S->pState = pState;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_halfband group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_halfband_interpolate_q15.c
+*
+* Description:  Q15 half-band FIR interpolator by 2.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_halfband
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 half-band FIR interpolator.
+ * @param[in]     *S          points to an instance of the Q15 half-band FIR structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of <code>2*blockSize</code> output samples.
+ * @param[in]     blockSize   number of input samples to process.
+ *
+ * \par
+ * The first output of an input is the center tap times the input <code>K-1</code> samples back,
+ * the second the sum over the symmetric pairs.
+ * \par
+ * The products are accumulated in 64 bits and the outputs are truncated to 1.15 and saturated,
+ * as in riscv_fir_interpolate_q15().
+ */
+
+void riscv_fir_halfband_interpolate_q15(
+  const riscv_fir_halfband_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_halfband_interpolate_q15);
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pe;                                /* First and last sample of the window */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t numPairs = (S->numTaps + 1u) >> 2u;   /* Symmetric pairs of taps that are not zero */
+  uint32_t phaseLen = 2u * numPairs;             /* Length of the phase of the pairs */
+  uint32_t i, k, blkCnt;                         /* Loop counters */
+#if defined (USE_DSP_RISCV)
+  shortV swap = { 1, 0 };                        /* Taps of the second half */
+  shortV c;
+#endif
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1u);
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy the new input sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Phase of the center tap, a delay of K-1 samples */
+    *pDst++ = (q15_t) (__SSAT((((q31_t) pCoeffs[numPairs] * pState[numPairs - 1u]) >> 15), 16));
+
+    acc = 0;
+
+    px = pState;
+    pe = pState + (phaseLen - 1u);
+
+#if defined (USE_DSP_RISCV)
+
+    /* Taps k and k+1 with (px[k], px[k+1]), taps k+1 and k with (pe[-k-1], pe[-k]) */
+    for (k = 0u; (k + 1u) < numPairs; k += 2u)
+    {
+      c = *(shortV *) (pCoeffs + k);
+      acc += dotpv2(*(shortV *) px, c);
+      acc += dotpv2(*(shortV *) (pe - 1), shufflev4(c, c, swap));
+      px += 2;
+      pe -= 2;
+    }
+
+    /* Last pair of an odd number of pairs */
+    if(k < numPairs)
+    {
+      acc += (q63_t) pCoeffs[k] * ((q31_t) *px + *pe);
+    }
+
+#else
+
+    /* The taps of a symmetric pair share their multiplication */
+    for (k = 0u; k < numPairs; k++)
+    {
+      acc += (q63_t) pCoeffs[k] * ((q31_t) *px + *pe);
+      px++;
+      pe--;
+    }
+
+#endif
+
+    *pDst++ = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Advance the state pointer by one input */
+    pState = pState + 1u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last phaseLen - 1 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  i = phaseLen - 1u;
+
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+}
+
+/**
+ * @} end of FIR_halfband group
+ */
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_halfband_interpolate_q31.c
+*
+* Description:  Q31 half-band FIR interpolator by 2.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_halfband
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 half-band FIR interpolator.
+ * @param[in]     *S          points to an instance of the Q31 half-band FIR structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of <code>2*blockSize</code> output samples.
+ * @param[in]     blockSize   number of input samples to process.
+ *
+ * \par
+ * The first output of an input is the center tap times the input <code>K-1</code> samples back,
+ * the second the sum over the symmetric pairs.
+ * \par
+ * The products are accumulated in 64 bits and the outputs are truncated to 1.31, as in
+ * riscv_fir_interpolate_q31().
+ */
+
+void riscv_fir_halfband_interpolate_q31(
+  const riscv_fir_halfband_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_halfband_interpolate_q31);
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t *px, *pe;                                /* First and last sample of the window */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t numPairs = (S->numTaps + 1u) >> 2u;   /* Symmetric pairs of taps that are not zero */
+  uint32_t phaseLen = 2u * numPairs;             /* Length of the phase of the pairs */
+  uint32_t i, k, blkCnt;                         /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1u);
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy the new input sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Phase of the center tap, a delay of K-1 samples */
+    *pDst++ = (q31_t) (((q63_t) pCoeffs[numPairs] * pState[numPairs - 1u]) >> 31);
+
+    acc = 0;
+
+    px = pState;
+    pe = pState + (phaseLen - 1u);
+
+    /* The taps of a symmetric pair share their multiplication */
+    for (k = 0u; k < numPairs; k++)
+    {
+      acc += ((q63_t) *px + *pe) * pCoeffs[k];
+      px++;
+      pe--;
+    }
+
+    *pDst++ = (q31_t) (acc >> 31);
+
+    /* Advance the state pointer by one input */
+    pState = pState + 1u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last phaseLen - 1 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  i = phaseLen - 1u;
+
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+}
+
+/**
+ * @} end of FIR_halfband group
+ */
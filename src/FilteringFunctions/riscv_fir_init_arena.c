@@ -0,0 +1,214 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_init_arena.c
+*
+* Description:  FIR filter instances with the state buffer taken from an
+*               arena.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Size of the state buffer of the floating-point FIR filter.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+ */
+
+uint32_t riscv_fir_get_buffer_size_f32(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  return (RISCV_DSP_ARENA_ROUND(((uint32_t) numTaps + blockSize - 1u) * sizeof(float32_t)));
+}
+
+/**
+ * @brief  Initialization function for the floating-point FIR filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the floating-point FIR filter structure.
+ * @param[in]     numTaps   number of filter coefficients.
+ * @param[in]     *pCoeffs  points to the filter coefficients.
+ * @param[in]     blockSize number of samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_get_buffer_size_f32() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_fir_init_arena_f32(
+  riscv_fir_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_fir_init_arena_f32);
+  float32_t *pState = (float32_t *) riscv_dsp_arena_alloc(pArena, riscv_fir_get_buffer_size_f32(numTaps, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_fir_init_f32(S, numTaps, pCoeffs, pState, blockSize);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q31 FIR filter.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+ */
+
+uint32_t riscv_fir_get_buffer_size_q31(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  return (RISCV_DSP_ARENA_ROUND(((uint32_t) numTaps + blockSize - 1u) * sizeof(q31_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q31 FIR filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q31 FIR filter structure.
+ * @param[in]     numTaps   number of filter coefficients.
+ * @param[in]     *pCoeffs  points to the filter coefficients.
+ * @param[in]     blockSize number of samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_get_buffer_size_q31() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_fir_init_arena_q31(
+  riscv_fir_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_fir_init_arena_q31);
+  q31_t *pState = (q31_t *) riscv_dsp_arena_alloc(pArena, riscv_fir_get_buffer_size_q31(numTaps, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_fir_init_q31(S, numTaps, pCoeffs, pState, blockSize);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q15 FIR filter.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     bytes the state takes from the arena, <code>numTaps+blockSize</code> samples.
+ */
+
+uint32_t riscv_fir_get_buffer_size_q15(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  return (RISCV_DSP_ARENA_ROUND(((uint32_t) numTaps + blockSize) * sizeof(q15_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q15 FIR filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q15 FIR filter structure.
+ * @param[in]     numTaps   number of filter coefficients.
+ * @param[in]     *pCoeffs  points to the filter coefficients.
+ * @param[in]     blockSize number of samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_get_buffer_size_q15() bytes free,
+ * otherwise the status of riscv_fir_init_q15().
+ */
+
+riscv_status riscv_fir_init_arena_q15(
+  riscv_fir_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_fir_init_arena_q15);
+  uint32_t used = pArena->used;
+  q15_t *pState;
+  riscv_status status;
+
+  pState = (q15_t *) riscv_dsp_arena_alloc(pArena, riscv_fir_get_buffer_size_q15(numTaps, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  status = riscv_fir_init_q15(S, numTaps, pCoeffs, pState, blockSize);
+
+  /*  Give the state back if the parameters are rejected */
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    pArena->used = used;
+  }
+
+  return (status);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q7 FIR filter.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+ */
+
+uint32_t riscv_fir_get_buffer_size_q7(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  return (RISCV_DSP_ARENA_ROUND(((uint32_t) numTaps + blockSize - 1u) * sizeof(q7_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q7 FIR filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q7 FIR filter structure.
+ * @param[in]     numTaps   number of filter coefficients.
+ * @param[in]     *pCoeffs  points to the filter coefficients.
+ * @param[in]     blockSize number of samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_get_buffer_size_q7() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_fir_init_arena_q7(
+  riscv_fir_instance_q7 * S,
+  uint16_t numTaps,
+  q7_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_fir_init_arena_q7);
+  q7_t *pState = (q7_t *) riscv_dsp_arena_alloc(pArena, riscv_fir_get_buffer_size_q7(numTaps, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_fir_init_q7(S, numTaps, pCoeffs, pState, blockSize);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR group
+ */
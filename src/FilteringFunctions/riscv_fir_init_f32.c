@@ -70,6 +70,10 @@
  * \par    
  * <code>pState</code> points to the array of state variables.    
  * <code>pState</code> is of length <code>numTaps+blockSize-1</code> samples, where <code>blockSize</code> is the number of input samples processed by each call to <code>riscv_fir_f32()</code>.    
+ * \par
+ * If the library was built with a kernel specialized for <code>numTaps</code> (CMake cache variable
+ * <code>RISCV_DSP_FIR_FIXED_TAPS</code>, see riscv_fir_fixed.h), it is stored in <code>S->pKernel</code> and
+ * riscv_fir_f32() runs it instead of the generic loops.  Otherwise <code>S->pKernel</code> is NULL.
  */
 
 void riscv_fir_init_f32(
@@ -79,6 +83,7 @@ void riscv_fir_init_f32(
   float32_t * pState,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_init_f32);
   /* Assign filter taps */
   S->numTaps = numTaps;
 
@@ -91,6 +96,9 @@ void riscv_fir_init_f32(
   /* Assign state pointer */
   S->pState = pState;
 
+  /* Kernel specialized for numTaps, if the library has one */
+  S->pKernel = riscv_fir_fixed_find_f32(numTaps);
+
 }
 
 /**    
@@ -87,6 +87,10 @@
  * \par    
  * <code>pState</code> points to the array of state variables.    
  * <code>pState</code> is of length <code>numTaps+blockSize</code>, when running on Cortex-M4 and Cortex-M3  and is of length <code>numTaps+blockSize-1</code>, when running on Cortex-M0 where <code>blockSize</code> is the number of input samples processed by each call to <code>riscv_fir_q15()</code>.    
+ * \par
+ * If the library was built with a kernel specialized for <code>numTaps</code> (CMake cache variable
+ * <code>RISCV_DSP_FIR_FIXED_TAPS</code>, see riscv_fir_fixed.h), it is stored in <code>S->pKernel</code> and
+ * riscv_fir_q15() runs it instead of the generic loops.  Otherwise <code>S->pKernel</code> is NULL.
  */
 
 riscv_status riscv_fir_init_q15(
@@ -96,6 +100,7 @@ riscv_status riscv_fir_init_q15(
   q15_t * pState,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_init_q15);
   riscv_status status;
 
 
@@ -113,6 +118,9 @@ riscv_status riscv_fir_init_q15(
   /* Assign state pointer */
   S->pState = pState;
 
+  /* Kernel specialized for numTaps, if the library has one */
+  S->pKernel = riscv_fir_fixed_find_q15(numTaps);
+
   status = RISCV_MATH_SUCCESS;
 
   return (status);
@@ -76,6 +76,7 @@ void riscv_fir_init_q7(
   q7_t * pState,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_init_q7);
 
   /* Assign filter taps */
   S->numTaps = numTaps;
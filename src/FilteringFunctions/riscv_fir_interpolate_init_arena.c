@@ -0,0 +1,234 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_interpolate_init_arena.c
+*
+* Description:  FIR interpolator instances with the state buffer taken from
+*               an arena.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Interpolate
+ * @{
+ */
+
+/**
+ * @brief  Size of the state buffer of the floating-point FIR interpolator.
+ * @param[in]  L          upsample factor.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of input samples processed per call.
+ * @return     bytes the state takes from the arena, <code>(numTaps/L)+blockSize-1</code> samples, 0 if L is 0.
+ */
+
+uint32_t riscv_fir_interpolate_get_buffer_size_f32(
+  uint8_t L,
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  if(L == 0u)
+  {
+    return (0u);
+  }
+
+  return (RISCV_DSP_ARENA_ROUND((((uint32_t) numTaps / L) + blockSize - 1u) * sizeof(float32_t)));
+}
+
+/**
+ * @brief  Initialization function for the floating-point FIR interpolator with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the floating-point FIR interpolator structure.
+ * @param[in]     L         upsample factor.
+ * @param[in]     numTaps   number of filter coefficients.
+ * @param[in]     *pCoeffs  points to the filter coefficients.
+ * @param[in]     blockSize number of input samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_interpolate_get_buffer_size_f32() bytes free,
+ * otherwise the status of riscv_fir_interpolate_init_f32().
+ */
+
+riscv_status riscv_fir_interpolate_init_arena_f32(
+  riscv_fir_interpolate_instance_f32 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_fir_interpolate_init_arena_f32);
+  uint32_t used = pArena->used;
+  float32_t *pState;
+  riscv_status status;
+
+  /*  The division of riscv_fir_interpolate_get_buffer_size_f32() needs L > 0 */
+  if(L == 0u)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  pState = (float32_t *) riscv_dsp_arena_alloc(pArena, riscv_fir_interpolate_get_buffer_size_f32(L, numTaps, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  status = riscv_fir_interpolate_init_f32(S, L, numTaps, pCoeffs, pState, blockSize);
+
+  /*  Give the state back if the parameters are rejected */
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    pArena->used = used;
+  }
+
+  return (status);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q31 FIR interpolator.
+ * @param[in]  L          upsample factor.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of input samples processed per call.
+ * @return     bytes the state takes from the arena, <code>(numTaps/L)+blockSize-1</code> samples, 0 if L is 0.
+ */
+
+uint32_t riscv_fir_interpolate_get_buffer_size_q31(
+  uint8_t L,
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  if(L == 0u)
+  {
+    return (0u);
+  }
+
+  return (RISCV_DSP_ARENA_ROUND((((uint32_t) numTaps / L) + blockSize - 1u) * sizeof(q31_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q31 FIR interpolator with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q31 FIR interpolator structure.
+ * @param[in]     L         upsample factor.
+ * @param[in]     numTaps   number of filter coefficients.
+ * @param[in]     *pCoeffs  points to the filter coefficients.
+ * @param[in]     blockSize number of input samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_interpolate_get_buffer_size_q31() bytes free,
+ * otherwise the status of riscv_fir_interpolate_init_q31().
+ */
+
+riscv_status riscv_fir_interpolate_init_arena_q31(
+  riscv_fir_interpolate_instance_q31 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_fir_interpolate_init_arena_q31);
+  uint32_t used = pArena->used;
+  q31_t *pState;
+  riscv_status status;
+
+  /*  The division of riscv_fir_interpolate_get_buffer_size_q31() needs L > 0 */
+  if(L == 0u)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  pState = (q31_t *) riscv_dsp_arena_alloc(pArena, riscv_fir_interpolate_get_buffer_size_q31(L, numTaps, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  status = riscv_fir_interpolate_init_q31(S, L, numTaps, pCoeffs, pState, blockSize);
+
+  /*  Give the state back if the parameters are rejected */
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    pArena->used = used;
+  }
+
+  return (status);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q15 FIR interpolator.
+ * @param[in]  L          upsample factor.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of input samples processed per call.
+ * @return     bytes the state takes from the arena, <code>(numTaps/L)+blockSize-1</code> samples, 0 if L is 0.
+ */
+
+uint32_t riscv_fir_interpolate_get_buffer_size_q15(
+  uint8_t L,
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  if(L == 0u)
+  {
+    return (0u);
+  }
+
+  return (RISCV_DSP_ARENA_ROUND((((uint32_t) numTaps / L) + blockSize - 1u) * sizeof(q15_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q15 FIR interpolator with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q15 FIR interpolator structure.
+ * @param[in]     L         upsample factor.
+ * @param[in]     numTaps   number of filter coefficients.
+ * @param[in]     *pCoeffs  points to the filter coefficients.
+ * @param[in]     blockSize number of input samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_interpolate_get_buffer_size_q15() bytes free,
+ * otherwise the status of riscv_fir_interpolate_init_q15().
+ */
+
+riscv_status riscv_fir_interpolate_init_arena_q15(
+  riscv_fir_interpolate_instance_q15 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_fir_interpolate_init_arena_q15);
+  uint32_t used = pArena->used;
+  q15_t *pState;
+  riscv_status status;
+
+  /*  The division of riscv_fir_interpolate_get_buffer_size_q15() needs L > 0 */
+  if(L == 0u)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  pState = (q15_t *) riscv_dsp_arena_alloc(pArena, riscv_fir_interpolate_get_buffer_size_q15(L, numTaps, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  status = riscv_fir_interpolate_init_q15(S, L, numTaps, pCoeffs, pState, blockSize);
+
+  /*  Give the state back if the parameters are rejected */
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    pArena->used = used;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR_Interpolate group
+ */
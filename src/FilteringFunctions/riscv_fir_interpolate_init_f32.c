@@ -83,6 +83,7 @@ riscv_status riscv_fir_interpolate_init_f32(
   float32_t * pState,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_interpolate_init_f32);
   riscv_status status;
 
   /* The filter length must be a multiple of the interpolation factor */
@@ -83,6 +83,7 @@ riscv_status riscv_fir_interpolate_init_q15(
   q15_t * pState,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_interpolate_init_q15);
   riscv_status status;
 
   /* The filter length must be a multiple of the interpolation factor */
@@ -84,6 +84,7 @@ riscv_status riscv_fir_interpolate_init_q31(
   q31_t * pState,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_interpolate_init_q31);
   riscv_status status;
 
   /* The filter length must be a multiple of the interpolation factor */
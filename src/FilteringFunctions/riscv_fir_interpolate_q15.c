@@ -75,6 +75,7 @@ void riscv_fir_interpolate_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_interpolate_q15);
 
   q15_t *pState = S->pState;                     /* State pointer                                            */
   q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer                                      */
@@ -84,15 +85,120 @@ void riscv_fir_interpolate_q15(
   q15_t x0, c0;                                  /* Temporary variables to hold state and coefficient values */
   uint32_t i, blkCnt, tapCnt;                    /* Loop counters                                            */
   uint16_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+#if defined (USE_DSP_RISCV)
+  q15_t *px;                                     /* Temporary pointer for state buffer */
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators of four input samples */
+  shortV VectInA, VectInB, VectInC, VectInD, VectInE;  /* Packed state and coefficient pairs */
+  uint32_t L = S->L;                             /* Interpolation factor */
+#endif
 
 
   /* S->pState buffer contains previous frame (phaseLen - 1) samples */
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = S->pState + (phaseLen - 1u);
 
+#if defined (USE_DSP_RISCV)
+
+  /* Compute every phase for 4 input samples at a time.  The coefficients of a phase are
+   * L apart, two of them are packed once and used by the dotpv2 of the four outputs:
+   *
+   *    acc0 += b[k*L+i-1] * x[k]   + b[(k+1)*L+i-1] * x[k+1]
+   *    acc1 += b[k*L+i-1] * x[k+1] + b[(k+1)*L+i-1] * x[k+2]
+   *    acc2 += b[k*L+i-1] * x[k+2] + b[(k+1)*L+i-1] * x[k+3]
+   *    acc3 += b[k*L+i-1] * x[k+3] + b[(k+1)*L+i-1] * x[k+4]
+   *
+   * and the state pairs of acc2 and acc3 are those of acc0 and acc1 in the next step. */
+  blkCnt = blockSize >> 2;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy four new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    i = L;
+
+    while(i > 0u)
+    {
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      px = pState;
+      ptr2 = pCoeffs + (i - 1u);
+
+      /* Read x[0], x[1] and x[1], x[2] */
+      VectInA = *(shortV *) px;
+      VectInB = *(shortV *) (px + 1u);
+      px += 2u;
+
+      /* Two taps at a time */
+      tapCnt = (uint32_t) phaseLen >> 1;
+
+      while(tapCnt > 0u)
+      {
+        VectInC = pack2(ptr2[0], ptr2[L]);
+        ptr2 += 2u * L;
+
+        /* Read x[k+2], x[k+3] and x[k+3], x[k+4] */
+        VectInD = *(shortV *) px;
+        VectInE = *(shortV *) (px + 1u);
+        px += 2u;
+
+        acc0 += dotpv2(VectInA, VectInC);
+        acc1 += dotpv2(VectInB, VectInC);
+        acc2 += dotpv2(VectInD, VectInC);
+        acc3 += dotpv2(VectInE, VectInC);
+
+        VectInA = VectInD;
+        VectInB = VectInE;
+
+        tapCnt--;
+      }
+
+      /* The last tap of an odd phase length */
+      if((phaseLen & 1u) != 0u)
+      {
+        c0 = *ptr2;
+
+        acc0 += (q31_t) px[-2] * c0;
+        acc1 += (q31_t) px[-1] * c0;
+        acc2 += (q31_t) px[0] * c0;
+        acc3 += (q31_t) px[1] * c0;
+      }
+
+      /* Output L - i of each of the four input samples, converted to 1.15 with saturation */
+      pDst[0] = (q15_t) (__SSAT((acc0 >> 15), 16));
+      pDst[L] = (q15_t) (__SSAT((acc1 >> 15), 16));
+      pDst[2u * L] = (q15_t) (__SSAT((acc2 >> 15), 16));
+      pDst[3u * L] = (q15_t) (__SSAT((acc3 >> 15), 16));
+      pDst++;
+
+      i--;
+    }
+
+    /* Skip the outputs of the other three input samples */
+    pDst += 3u * L;
+
+    /* Advance the state pointer by 4 to process the next group of 4 samples */
+    pState = pState + 4;
+
+    blkCnt--;
+  }
+
+  /* The remaining 0 to 3 input samples one at a time */
+  blkCnt = blockSize & 3u;
+
+#else
+
   /* Total number of intput samples */
   blkCnt = blockSize;
 
+#endif /* #if defined (USE_DSP_RISCV) */
+
   /* Loop over the blockSize. */
   while(blkCnt > 0u)
   {
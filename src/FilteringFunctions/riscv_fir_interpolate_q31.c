@@ -75,6 +75,7 @@ void riscv_fir_interpolate_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_interpolate_q31);
   q31_t *pState = S->pState;                     /* State pointer */
   q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
   q31_t *pStateCurnt;                            /* Points to the current sample of the state */
@@ -86,15 +87,98 @@ void riscv_fir_interpolate_q31(
   q31_t x0, c0;                                  /* Temporary variables to hold state and coefficient values */
   uint32_t i, blkCnt;                            /* Loop counters */
   uint16_t phaseLen = S->phaseLength, tapCnt;    /* Length of each polyphase filter component */
+#if defined (USE_DSP_RISCV) && defined (RISCV_MATH_LOOPUNROLL)
+  q31_t x1, x2, x3;                              /* Temporary variables to hold state values */
+  q63_t sum1, sum2, sum3;                        /* Accumulators of the next three input samples */
+  uint32_t L = S->L;                             /* Interpolation factor */
+#endif
 
 
   /* S->pState buffer contains previous frame (phaseLen - 1) samples */
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = S->pState + ((q31_t) phaseLen - 1);
 
+#if defined (USE_DSP_RISCV) && defined (RISCV_MATH_LOOPUNROLL)
+
+  /* Compute every phase for 4 input samples at a time, so that each coefficient is
+   * loaded once for the four outputs of the phase and each state sample once per tap. */
+  blkCnt = blockSize >> 2;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy four new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    i = L;
+
+    while(i > 0u)
+    {
+      sum = 0;
+      sum1 = 0;
+      sum2 = 0;
+      sum3 = 0;
+
+      ptr1 = pState;
+      ptr2 = pCoeffs + (i - 1u);
+
+      /* Read the first three samples, each tap reads one more */
+      x0 = *ptr1++;
+      x1 = *ptr1++;
+      x2 = *ptr1++;
+
+      tapCnt = phaseLen;
+
+      while(tapCnt > 0u)
+      {
+        c0 = *ptr2;
+        ptr2 += L;
+
+        x3 = *ptr1++;
+
+        sum += (q63_t) x0 * c0;
+        sum1 += (q63_t) x1 * c0;
+        sum2 += (q63_t) x2 * c0;
+        sum3 += (q63_t) x3 * c0;
+
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+
+        tapCnt--;
+      }
+
+      /* Output L - i of each of the four input samples */
+      pDst[0] = (q31_t) (sum >> 31);
+      pDst[L] = (q31_t) (sum1 >> 31);
+      pDst[2u * L] = (q31_t) (sum2 >> 31);
+      pDst[3u * L] = (q31_t) (sum3 >> 31);
+      pDst++;
+
+      i--;
+    }
+
+    /* Skip the outputs of the other three input samples */
+    pDst += 3u * L;
+
+    /* Advance the state pointer by 4 to process the next group of 4 samples */
+    pState = pState + 4;
+
+    blkCnt--;
+  }
+
+  /* The remaining 0 to 3 input samples one at a time */
+  blkCnt = blockSize & 3u;
+
+#else
+
   /* Total number of intput samples */
   blkCnt = blockSize;
 
+#endif /* #if defined (USE_DSP_RISCV) && defined (RISCV_MATH_LOOPUNROLL) */
+
   /* Loop over the blockSize. */
   while(blkCnt > 0u)
   {
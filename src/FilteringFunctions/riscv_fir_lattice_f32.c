@@ -136,6 +136,7 @@ void riscv_fir_lattice_f32(
   float32_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_lattice_f32);
   float32_t *pState;                             /* State pointer */
   float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
   float32_t *px;                                 /* temporary state pointer */
@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_lattice_init_arena.c
+*
+* Description:  FIR lattice filter instances with the state buffer taken
+*               from an arena.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Lattice
+ * @{
+ */
+
+/**
+ * @brief  Size of the state buffer of the floating-point FIR lattice filter.
+ * @param[in]  numStages  number of filter stages.
+ * @return     bytes the state takes from the arena, <code>numStages</code> samples.
+ */
+
+uint32_t riscv_fir_lattice_get_buffer_size_f32(
+  uint16_t numStages)
+{
+  return (RISCV_DSP_ARENA_ROUND((uint32_t) numStages * sizeof(float32_t)));
+}
+
+/**
+ * @brief  Initialization function for the floating-point FIR lattice filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the floating-point FIR lattice filter structure.
+ * @param[in]     numStages number of filter stages.
+ * @param[in]     *pCoeffs  points to the coefficient buffer.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_lattice_get_buffer_size_f32() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_fir_lattice_init_arena_f32(
+  riscv_fir_lattice_instance_f32 * S,
+  uint16_t numStages,
+  float32_t * pCoeffs,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_fir_lattice_init_arena_f32);
+  float32_t *pState = (float32_t *) riscv_dsp_arena_alloc(pArena, riscv_fir_lattice_get_buffer_size_f32(numStages));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_fir_lattice_init_f32(S, numStages, pCoeffs, pState);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q31 FIR lattice filter.
+ * @param[in]  numStages  number of filter stages.
+ * @return     bytes the state takes from the arena, <code>numStages</code> samples.
+ */
+
+uint32_t riscv_fir_lattice_get_buffer_size_q31(
+  uint16_t numStages)
+{
+  return (RISCV_DSP_ARENA_ROUND((uint32_t) numStages * sizeof(q31_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q31 FIR lattice filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q31 FIR lattice filter structure.
+ * @param[in]     numStages number of filter stages.
+ * @param[in]     *pCoeffs  points to the coefficient buffer.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_lattice_get_buffer_size_q31() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_fir_lattice_init_arena_q31(
+  riscv_fir_lattice_instance_q31 * S,
+  uint16_t numStages,
+  q31_t * pCoeffs,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_fir_lattice_init_arena_q31);
+  q31_t *pState = (q31_t *) riscv_dsp_arena_alloc(pArena, riscv_fir_lattice_get_buffer_size_q31(numStages));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_fir_lattice_init_q31(S, numStages, pCoeffs, pState);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q15 FIR lattice filter.
+ * @param[in]  numStages  number of filter stages.
+ * @return     bytes the state takes from the arena, <code>numStages</code> samples.
+ */
+
+uint32_t riscv_fir_lattice_get_buffer_size_q15(
+  uint16_t numStages)
+{
+  return (RISCV_DSP_ARENA_ROUND((uint32_t) numStages * sizeof(q15_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q15 FIR lattice filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q15 FIR lattice filter structure.
+ * @param[in]     numStages number of filter stages.
+ * @param[in]     *pCoeffs  points to the coefficient buffer.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_fir_lattice_get_buffer_size_q15() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_fir_lattice_init_arena_q15(
+  riscv_fir_lattice_instance_q15 * S,
+  uint16_t numStages,
+  q15_t * pCoeffs,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_fir_lattice_init_arena_q15);
+  q15_t *pState = (q15_t *) riscv_dsp_arena_alloc(pArena, riscv_fir_lattice_get_buffer_size_q15(numStages));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_fir_lattice_init_q15(S, numStages, pCoeffs, pState);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_Lattice group
+ */
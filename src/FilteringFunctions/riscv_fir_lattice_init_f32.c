@@ -66,6 +66,7 @@ void riscv_fir_lattice_init_f32(
   float32_t * pCoeffs,
   float32_t * pState)
 {
+  RISCV_PROFILE(riscv_fir_lattice_init_f32);
   /* Assign filter taps */
   S->numStages = numStages;
 
@@ -66,6 +66,7 @@ void riscv_fir_lattice_init_q15(
   q15_t * pCoeffs,
   q15_t * pState)
 {
+  RISCV_PROFILE(riscv_fir_lattice_init_q15);
   /* Assign filter taps */
   S->numStages = numStages;
 
@@ -66,6 +66,7 @@ void riscv_fir_lattice_init_q31(
   q31_t * pCoeffs,
   q31_t * pState)
 {
+  RISCV_PROFILE(riscv_fir_lattice_init_q31);
   /* Assign filter taps */
   S->numStages = numStages;
 
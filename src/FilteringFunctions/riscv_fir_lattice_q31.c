@@ -71,6 +71,7 @@ void riscv_fir_lattice_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_lattice_q31);
   q31_t *pState;                                 /* State pointer */
   q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
   q31_t *px;                                     /* temporary state pointer */
@@ -0,0 +1,230 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_multichan_f32.c
+*
+* Description:  Floating-point FIR filter for several channels sharing
+*               one set of coefficients.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_MULTICHAN
+ * @{
+ */
+
+/*
+* @brief  Filters four output samples of two channels.
+* @param[in]  *pCoeffs  points to the coefficients.
+* @param[in]  numTaps   number of taps.
+* @param[in]  *pXa      points to the oldest state sample of the outputs of channel a.
+* @param[in]  *pXb      points to the oldest state sample of the outputs of channel b.
+* @param[out] *pDa      points to the four outputs of channel a.
+* @param[out] *pDb      points to the four outputs of channel b.
+*/
+
+static void riscv_fir_multichan_4x2_f32(
+  const float32_t * pCoeffs,
+  uint32_t numTaps,
+  const float32_t * pXa,
+  const float32_t * pXb,
+  float32_t * pDa,
+  float32_t * pDb)
+{
+  float32_t c, xa0, xa1, xa2, xa3, xb0, xb1, xb2, xb3;  /* Coefficient and state samples */
+  float32_t acca0 = 0.0f, acca1 = 0.0f, acca2 = 0.0f, acca3 = 0.0f;  /* Accumulators of channel a */
+  float32_t accb0 = 0.0f, accb1 = 0.0f, accb2 = 0.0f, accb3 = 0.0f;  /* Accumulators of channel b */
+  uint32_t tapCnt;
+
+  xa0 = *pXa++;
+  xa1 = *pXa++;
+  xa2 = *pXa++;
+  xb0 = *pXb++;
+  xb1 = *pXb++;
+  xb2 = *pXb++;
+
+  for (tapCnt = numTaps; tapCnt > 0u; tapCnt--)
+  {
+    /* One coefficient load serves eight multiply-accumulates */
+    c = *pCoeffs++;
+    xa3 = *pXa++;
+    xb3 = *pXb++;
+
+    acca0 += xa0 * c;
+    acca1 += xa1 * c;
+    acca2 += xa2 * c;
+    acca3 += xa3 * c;
+    accb0 += xb0 * c;
+    accb1 += xb1 * c;
+    accb2 += xb2 * c;
+    accb3 += xb3 * c;
+
+    xa0 = xa1;
+    xa1 = xa2;
+    xa2 = xa3;
+    xb0 = xb1;
+    xb1 = xb2;
+    xb2 = xb3;
+  }
+
+  pDa[0] = acca0;
+  pDa[1] = acca1;
+  pDa[2] = acca2;
+  pDa[3] = acca3;
+  pDb[0] = accb0;
+  pDb[1] = accb1;
+  pDb[2] = accb2;
+  pDb[3] = accb3;
+}
+
+/*
+* @brief  Filters four output samples of one channel.
+*/
+
+static void riscv_fir_multichan_4x1_f32(
+  const float32_t * pCoeffs,
+  uint32_t numTaps,
+  const float32_t * pX,
+  float32_t * pD)
+{
+  float32_t c, x0, x1, x2, x3;                   /* Coefficient and state samples */
+  float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;  /* Accumulators */
+  uint32_t tapCnt;
+
+  x0 = *pX++;
+  x1 = *pX++;
+  x2 = *pX++;
+
+  for (tapCnt = numTaps; tapCnt > 0u; tapCnt--)
+  {
+    c = *pCoeffs++;
+    x3 = *pX++;
+
+    acc0 += x0 * c;
+    acc1 += x1 * c;
+    acc2 += x2 * c;
+    acc3 += x3 * c;
+
+    x0 = x1;
+    x1 = x2;
+    x2 = x3;
+  }
+
+  pD[0] = acc0;
+  pD[1] = acc1;
+  pD[2] = acc2;
+  pD[3] = acc3;
+}
+
+/*
+* @brief  Filters one output sample of one channel.
+*/
+
+static float32_t riscv_fir_multichan_1x1_f32(
+  const float32_t * pCoeffs,
+  uint32_t numTaps,
+  const float32_t * pX)
+{
+  float32_t acc = 0.0f;                          /* Accumulator */
+  uint32_t tapCnt;
+
+  for (tapCnt = numTaps; tapCnt > 0u; tapCnt--)
+  {
+    acc += *pX++ * *pCoeffs++;
+  }
+
+  return (acc);
+}
+
+/**
+* @brief  Processing function for the floating-point multi-channel FIR filter.
+* @param[in]  *S         points to an instance of the floating-point multi-channel FIR structure.
+* @param[in]  *pSrc      points to the <code>numChannels</code> input blocks.
+* @param[out] *pDst      points to the <code>numChannels</code> output blocks.
+* @param[in]  blockSize  number of samples per channel to process, at most the <code>blockSize</code> given to riscv_fir_multichan_init_f32().
+* @return none.
+*/
+
+void riscv_fir_multichan_f32(
+  const riscv_fir_multichan_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_multichan_f32);
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
+  uint32_t stride = S->stateStride;              /* Distance between two state buffers */
+  float32_t *pStateA, *pStateB;                  /* State buffers of a channel pair */
+  float32_t *pDstA, *pDstB;                      /* Output blocks of a channel pair */
+  float32_t *pS, *pIn;                           /* Copy pointers */
+  uint32_t ch, n, i;                             /* Loop counters */
+
+  /* Append the new input of every channel to its state, after the previous numTaps-1 samples */
+  pIn = pSrc;
+  for (ch = 0u; ch < S->numChannels; ch++)
+  {
+    pS = S->pState + (ch * stride) + (numTaps - 1u);
+    for (i = 0u; i < blockSize; i++)
+    {
+      pS[i] = *pIn++;
+    }
+  }
+
+  /* Two channels at a time share every coefficient load */
+  for (ch = 0u; (ch + 1u) < S->numChannels; ch += 2u)
+  {
+    pStateA = S->pState + (ch * stride);
+    pStateB = pStateA + stride;
+    pDstA = pDst + (ch * blockSize);
+    pDstB = pDstA + blockSize;
+
+    for (n = 0u; (n + 4u) <= blockSize; n += 4u)
+    {
+      riscv_fir_multichan_4x2_f32(pCoeffs, numTaps, pStateA + n, pStateB + n, pDstA + n, pDstB + n);
+    }
+
+    for (; n < blockSize; n++)
+    {
+      pDstA[n] = riscv_fir_multichan_1x1_f32(pCoeffs, numTaps, pStateA + n);
+      pDstB[n] = riscv_fir_multichan_1x1_f32(pCoeffs, numTaps, pStateB + n);
+    }
+  }
+
+  /* Last channel of an odd number of channels */
+  if(ch < S->numChannels)
+  {
+    pStateA = S->pState + (ch * stride);
+    pDstA = pDst + (ch * blockSize);
+
+    for (n = 0u; (n + 4u) <= blockSize; n += 4u)
+    {
+      riscv_fir_multichan_4x1_f32(pCoeffs, numTaps, pStateA + n, pDstA + n);
+    }
+
+    for (; n < blockSize; n++)
+    {
+      pDstA[n] = riscv_fir_multichan_1x1_f32(pCoeffs, numTaps, pStateA + n);
+    }
+  }
+
+  /* Keep the last numTaps-1 samples of every channel for the next call */
+  for (ch = 0u; ch < S->numChannels; ch++)
+  {
+    pS = S->pState + (ch * stride);
+    for (i = 0u; i < (numTaps - 1u); i++)
+    {
+      pS[i] = pS[i + blockSize];
+    }
+  }
+}
+
+/**
+* @} end of FIR_MULTICHAN group
+*/
@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_multichan_init_q15.c
+*
+* Description:  Initialization function for the Q15 multi-channel FIR
+*               filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_MULTICHAN
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q15 multi-channel FIR filter.
+* @param[in,out] *S           points to an instance of the Q15 multi-channel FIR structure.
+* @param[in]     numTaps      number of filter coefficients in the filter, even and greater than or equal to 4.
+* @param[in]     numChannels  number of channels.
+* @param[in]     *pCoeffs     points to the filter coefficients, shared by all channels.
+* @param[in]     *pState      points to the state buffers.
+* @param[in]     blockSize    maximum number of samples per channel processed per call.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>numTaps</code> is not even and greater than or equal to 4 or <code>numChannels</code> is 0.
+*
+* <b>Description:</b>
+* \par
+* <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+* as for riscv_fir_init_q15():
+* <pre>
+*    {b[numTaps-1], b[numTaps-2], ..., b[1], b[0]}
+* </pre>
+* \par
+* <code>pState</code> is of length <code>numChannels*(numTaps+blockSize-1)</code> and is cleared.
+*/
+
+riscv_status riscv_fir_multichan_init_q15(
+  riscv_fir_multichan_instance_q15 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_multichan_init_q15);
+  if((numTaps < 4u) || ((numTaps & 1u) != 0u) || (numChannels == 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numTaps = numTaps;
+  S->numChannels = numChannels;
+  S->stateStride = (uint32_t) numTaps + blockSize - 1u;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* Clear the state buffers */
+  memset(pState, 0, numChannels * S->stateStride * sizeof(q15_t));
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of FIR_MULTICHAN group
+*/
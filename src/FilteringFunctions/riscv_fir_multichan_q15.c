@@ -0,0 +1,321 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_multichan_q15.c
+*
+* Description:  Q15 FIR filter for several channels sharing one set of
+*               coefficients.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_MULTICHAN Multi-channel FIR Filter
+ *
+ * \par
+ * The multi-channel FIR filter applies the same FIR filter to <code>numChannels</code> independent
+ * signals, for example the channels of a microphone array.  Every channel has its own state buffer,
+ * the coefficients are shared.  The output of a channel equals the output of riscv_fir_q15() or
+ * riscv_fir_f32() with the same coefficients.
+ * \par
+ * The channels are filtered two at a time: every coefficient, or coefficient pair with USE_DSP_RISCV,
+ * is loaded once for four output samples of both channels, instead of once per channel.
+ * \par
+ * The input and output blocks of the channels are stored back to back:
+ * channel c uses the <code>blockSize</code> samples starting at <code>pSrc + c*blockSize</code> and
+ * <code>pDst + c*blockSize</code>.
+ * The state buffers are stored back to back in <code>pState</code>, each of length
+ * <code>numTaps+blockSize-1</code>.
+ */
+
+/**
+ * @addtogroup FIR_MULTICHAN
+ * @{
+ */
+
+#if defined (USE_DSP_RISCV)
+
+/*
+* @brief  Filters four output samples of two channels.
+* @param[in]  *pCoeffs  points to the coefficients.
+* @param[in]  numTaps   number of taps, even.
+* @param[in]  *pXa      points to the oldest state sample of the outputs of channel a.
+* @param[in]  *pXb      points to the oldest state sample of the outputs of channel b.
+* @param[out] *pDa      points to the four outputs of channel a.
+* @param[out] *pDb      points to the four outputs of channel b.
+*
+* Output j of a channel is the sum of b[numTaps-1-t] * x[j+t], every coefficient pair is
+* used for the state pairs at offsets 2i, 2i+1, 2i+2 and 2i+3 of both channels.
+*/
+
+static void riscv_fir_multichan_4x2_q15(
+  const q15_t * pCoeffs,
+  uint32_t numTaps,
+  const q15_t * pXa,
+  const q15_t * pXb,
+  q15_t * pDa,
+  q15_t * pDb)
+{
+  shortV c, xa0, xa1, xa2, xa3, xb0, xb1, xb2, xb3;  /* Coefficient pair and state pairs */
+  q63_t acca0 = 0, acca1 = 0, acca2 = 0, acca3 = 0;  /* Accumulators of channel a */
+  q63_t accb0 = 0, accb1 = 0, accb2 = 0, accb3 = 0;  /* Accumulators of channel b */
+  uint32_t tapCnt;
+
+  xa0 = *(shortV *) pXa;
+  xa1 = *(shortV *) (pXa + 1);
+  xb0 = *(shortV *) pXb;
+  xb1 = *(shortV *) (pXb + 1);
+  pXa += 2;
+  pXb += 2;
+
+  for (tapCnt = numTaps >> 1; tapCnt > 0u; tapCnt--)
+  {
+    /* One coefficient pair load serves eight dot products */
+    c = *(shortV *) pCoeffs;
+    pCoeffs += 2;
+
+    xa2 = *(shortV *) pXa;
+    xa3 = *(shortV *) (pXa + 1);
+    xb2 = *(shortV *) pXb;
+    xb3 = *(shortV *) (pXb + 1);
+    pXa += 2;
+    pXb += 2;
+
+    acca0 += dotpv2(xa0, c);
+    acca1 += dotpv2(xa1, c);
+    acca2 += dotpv2(xa2, c);
+    acca3 += dotpv2(xa3, c);
+    accb0 += dotpv2(xb0, c);
+    accb1 += dotpv2(xb1, c);
+    accb2 += dotpv2(xb2, c);
+    accb3 += dotpv2(xb3, c);
+
+    xa0 = xa2;
+    xa1 = xa3;
+    xb0 = xb2;
+    xb1 = xb3;
+  }
+
+  /* The results are in 2.30 format.  Convert to 1.15 with saturation. */
+  pDa[0] = (q15_t) __SSAT((acca0 >> 15), 16);
+  pDa[1] = (q15_t) __SSAT((acca1 >> 15), 16);
+  pDa[2] = (q15_t) __SSAT((acca2 >> 15), 16);
+  pDa[3] = (q15_t) __SSAT((acca3 >> 15), 16);
+  pDb[0] = (q15_t) __SSAT((accb0 >> 15), 16);
+  pDb[1] = (q15_t) __SSAT((accb1 >> 15), 16);
+  pDb[2] = (q15_t) __SSAT((accb2 >> 15), 16);
+  pDb[3] = (q15_t) __SSAT((accb3 >> 15), 16);
+}
+
+/*
+* @brief  Filters four output samples of one channel.
+*/
+
+static void riscv_fir_multichan_4x1_q15(
+  const q15_t * pCoeffs,
+  uint32_t numTaps,
+  const q15_t * pX,
+  q15_t * pD)
+{
+  shortV c, x0, x1, x2, x3;                      /* Coefficient pair and state pairs */
+  q63_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;  /* Accumulators */
+  uint32_t tapCnt;
+
+  x0 = *(shortV *) pX;
+  x1 = *(shortV *) (pX + 1);
+  pX += 2;
+
+  for (tapCnt = numTaps >> 1; tapCnt > 0u; tapCnt--)
+  {
+    c = *(shortV *) pCoeffs;
+    pCoeffs += 2;
+
+    x2 = *(shortV *) pX;
+    x3 = *(shortV *) (pX + 1);
+    pX += 2;
+
+    acc0 += dotpv2(x0, c);
+    acc1 += dotpv2(x1, c);
+    acc2 += dotpv2(x2, c);
+    acc3 += dotpv2(x3, c);
+
+    x0 = x2;
+    x1 = x3;
+  }
+
+  pD[0] = (q15_t) __SSAT((acc0 >> 15), 16);
+  pD[1] = (q15_t) __SSAT((acc1 >> 15), 16);
+  pD[2] = (q15_t) __SSAT((acc2 >> 15), 16);
+  pD[3] = (q15_t) __SSAT((acc3 >> 15), 16);
+}
+
+#endif /* #if defined (USE_DSP_RISCV) */
+
+/*
+* @brief  Filters one output sample of one channel.
+*/
+
+static q15_t riscv_fir_multichan_1x1_q15(
+  const q15_t * pCoeffs,
+  uint32_t numTaps,
+  const q15_t * pX)
+{
+  q63_t acc = 0;                                 /* Accumulator */
+  uint32_t tapCnt;
+
+#if defined (USE_DSP_RISCV)
+
+  for (tapCnt = numTaps >> 1; tapCnt > 0u; tapCnt--)
+  {
+    acc += dotpv2(*(shortV *) pX, *(shortV *) pCoeffs);
+    pX += 2;
+    pCoeffs += 2;
+  }
+
+#else
+
+  for (tapCnt = numTaps; tapCnt > 0u; tapCnt--)
+  {
+    acc += (q31_t) *pX++ * *pCoeffs++;
+  }
+
+#endif
+
+  return ((q15_t) __SSAT((acc >> 15), 16));
+}
+
+/**
+* @brief  Processing function for the Q15 multi-channel FIR filter.
+* @param[in]  *S         points to an instance of the Q15 multi-channel FIR structure.
+* @param[in]  *pSrc      points to the <code>numChannels</code> input blocks.
+* @param[out] *pDst      points to the <code>numChannels</code> output blocks.
+* @param[in]  blockSize  number of samples per channel to process, at most the <code>blockSize</code> given to riscv_fir_multichan_init_q15().
+* @return none.
+*
+* <b>Scaling and Overflow Behavior:</b>
+* \par
+* The function uses a 64-bit internal accumulator per output, as riscv_fir_q15().
+* Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+* After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits
+* and saturated to 1.15 format.
+*/
+
+void riscv_fir_multichan_q15(
+  const riscv_fir_multichan_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_multichan_q15);
+  const q15_t *pCoeffs = S->pCoeffs;             /* Coefficient pointer */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
+  uint32_t stride = S->stateStride;              /* Distance between two state buffers */
+  q15_t *pStateA, *pStateB;                      /* State buffers of a channel pair */
+  q15_t *pDstA, *pDstB;                          /* Output blocks of a channel pair */
+  q15_t *pS, *pIn;                               /* Copy pointers */
+  uint32_t ch, n, i;                             /* Loop counters */
+#if !defined (USE_DSP_RISCV)
+  const q15_t *pxA, *pxB, *pb;                   /* State and coefficient pointers */
+  q63_t accA, accB;                              /* Accumulators of the channel pair */
+  q15_t c;                                       /* Coefficient */
+#endif
+
+  /* Append the new input of every channel to its state, after the previous numTaps-1 samples */
+  pIn = pSrc;
+  for (ch = 0u; ch < S->numChannels; ch++)
+  {
+    pS = S->pState + (ch * stride) + (numTaps - 1u);
+    for (i = 0u; i < blockSize; i++)
+    {
+      pS[i] = *pIn++;
+    }
+  }
+
+  /* Two channels at a time share every coefficient load */
+  for (ch = 0u; (ch + 1u) < S->numChannels; ch += 2u)
+  {
+    pStateA = S->pState + (ch * stride);
+    pStateB = pStateA + stride;
+    pDstA = pDst + (ch * blockSize);
+    pDstB = pDstA + blockSize;
+    n = 0u;
+
+#if defined (USE_DSP_RISCV)
+
+    for (; (n + 4u) <= blockSize; n += 4u)
+    {
+      riscv_fir_multichan_4x2_q15(pCoeffs, numTaps, pStateA + n, pStateB + n, pDstA + n, pDstB + n);
+    }
+
+#else
+
+    for (; n < blockSize; n++)
+    {
+      accA = 0;
+      accB = 0;
+      pxA = pStateA + n;
+      pxB = pStateB + n;
+      pb = pCoeffs;
+
+      for (i = numTaps; i > 0u; i--)
+      {
+        /* One coefficient load serves both channels */
+        c = *pb++;
+        accA += (q31_t) *pxA++ * c;
+        accB += (q31_t) *pxB++ * c;
+      }
+
+      pDstA[n] = (q15_t) __SSAT((accA >> 15), 16);
+      pDstB[n] = (q15_t) __SSAT((accB >> 15), 16);
+    }
+
+#endif
+
+    for (; n < blockSize; n++)
+    {
+      pDstA[n] = riscv_fir_multichan_1x1_q15(pCoeffs, numTaps, pStateA + n);
+      pDstB[n] = riscv_fir_multichan_1x1_q15(pCoeffs, numTaps, pStateB + n);
+    }
+  }
+
+  /* Last channel of an odd number of channels */
+  if(ch < S->numChannels)
+  {
+    pStateA = S->pState + (ch * stride);
+    pDstA = pDst + (ch * blockSize);
+    n = 0u;
+
+#if defined (USE_DSP_RISCV)
+
+    for (; (n + 4u) <= blockSize; n += 4u)
+    {
+      riscv_fir_multichan_4x1_q15(pCoeffs, numTaps, pStateA + n, pDstA + n);
+    }
+
+#endif
+
+    for (; n < blockSize; n++)
+    {
+      pDstA[n] = riscv_fir_multichan_1x1_q15(pCoeffs, numTaps, pStateA + n);
+    }
+  }
+
+  /* Keep the last numTaps-1 samples of every channel for the next call */
+  for (ch = 0u; ch < S->numChannels; ch++)
+  {
+    pS = S->pState + (ch * stride);
+    for (i = 0u; i < (numTaps - 1u); i++)
+    {
+      pS[i] = pS[i + blockSize];
+    }
+  }
+}
+
+/**
+* @} end of FIR_MULTICHAN group
+*/
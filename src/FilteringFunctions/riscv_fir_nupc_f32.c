@@ -0,0 +1,208 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_nupc_f32.c
+*
+* Description:  Floating-point non-uniformly partitioned convolution FIR
+*               filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_NUPC Non-uniformly Partitioned Convolution FIR Filter
+ *
+ * \par
+ * The non-uniformly partitioned convolution filter computes the output of riscv_fir_f32() for
+ * impulse responses of thousands of taps with the latency of one short block, for reverberation
+ * and room correction.  riscv_fir_fft_f32() has the latency of its partition length and the work
+ * of its partitions grows with <code>numTaps/blockSize</code>, the non-uniform filter keeps short
+ * partitions at the start of the response, where the latency matters, and long ones in the tail.
+ * \par Algorithm
+ * With the block length <code>B</code> given to riscv_fir_nupc_init_f32() the impulse response is
+ * split into
+ * - a head of the taps <code>0 ... 2*B-1</code>, filtered in direct form with riscv_fir_f32(),
+ * - segments <code>j = 0, 1, ...</code> of partition length <code>N = B*2^j</code> that cover the
+ *   taps <code>2*N ... 4*N-1</code>, two partitions each,
+ * - a last segment that covers the rest of the taps, with partitions of at most 2048 taps.
+ * \par
+ * Every segment is a uniformly partitioned overlap-save filter as in riscv_fir_fft_f32() that
+ * transforms a block of <code>N</code> input samples while the next <code>N</code> samples
+ * arrive and returns its output while the block after it arrives, which the offset of its taps,
+ * <code>2*N</code>, compensates.  The output has no extra delay compared with riscv_fir_f32().
+ * \par
+ * The work of a segment is spread over the <code>N/B</code> calls of its period: the forward real
+ * FFT runs in the call <code>N/(4*B)-1</code> of the period, the inverse real FFT half a period
+ * later and the products with the partition spectra in the calls between them.  The transforms of
+ * the segments of <code>N >= 4*B</code> then fall into different calls, so every call runs the
+ * head, the transforms of the two shortest segments and at most one transform of a longer segment,
+ * instead of all transforms in the call that ends the period of the longest segment.
+ * \par
+ * For 10000 taps and <code>B = 32</code> the head has 64 taps and seven segments of 32 to 2048
+ * taps per partition cover the rest.
+ * \par Instance Structure
+ * The spectra, delay lines, input history and work buffers are stored in the state buffer, whose
+ * length riscv_fir_nupc_state_len_f32() returns.  A separate instance structure must be defined for
+ * each filter.
+ */
+
+/**
+ * @addtogroup FIR_NUPC
+ * @{
+ */
+
+/**
+* @brief  Runs the part of the work of one segment that falls into the current call.
+* @param[in,out] *S     points to an instance of the floating-point non-uniformly partitioned convolution FIR structure.
+* @param[in,out] *Sseg  points to the segment.
+* @param[in,out] *pDst  points to the output of the call, the output of the segment is added.
+* @return none.
+*
+* The state of a segment has the layout of riscv_fir_fft_f32(), the input buffer of two partitions
+* holds the two output blocks instead: the block the current period returns and the block the
+* inverse FFT of the current period writes.  The input comes from the history shared by the segments.
+*/
+
+static void riscv_fir_nupc_segment_f32(
+  const riscv_fir_nupc_instance_f32 * S,
+  riscv_fir_fft_instance_f32 * Sseg,
+  float32_t * pDst)
+{
+  uint32_t B = S->blockSize;                     /* Samples per call */
+  uint32_t N = Sseg->blockSize;                  /* Partition length of the segment */
+  uint32_t fftLen = 2u * N;                      /* Length of the real FFT */
+  uint32_t numPartitions = Sseg->numPartitions;
+  uint32_t numSlots = N / B;                     /* Calls per period */
+  uint32_t slotIndex = S->count & (numSlots - 1u);   /* Call within the period */
+  uint32_t parity = (S->count / numSlots) & 1u;  /* Output block of the period */
+  uint32_t fftSlot, ifftSlot, macFirst, macSlots;
+  uint32_t p, pStart, pEnd, slot, start, n;
+  const float32_t *pH = Sseg->pState;            /* Partition spectra */
+  float32_t *pFdl = Sseg->pState + (numPartitions * fftLen);   /* Frequency-domain delay line */
+  float32_t *pOut = pFdl + (numPartitions * fftLen);           /* Two output blocks */
+  float32_t *pAcc = pOut + fftLen;               /* Spectrum of the output */
+  float32_t *pScratch = pAcc + fftLen;           /* Work buffer */
+  float32_t *pX, *pY;
+
+  /*  Output of the block before last */
+  riscv_add_f32(pDst, pOut + (parity * N) + (slotIndex * B), pDst, B);
+
+  fftSlot = (numSlots >= 4u) ? ((numSlots / 4u) - 1u) : 0u;
+  ifftSlot = fftSlot + (numSlots / 2u);
+  macFirst = (numSlots >= 4u) ? (fftSlot + 1u) : fftSlot;
+  macSlots = (numSlots >= 4u) ? ((numSlots / 2u) - 1u) : (ifftSlot - fftSlot + 1u);
+
+  if(slotIndex == fftSlot)
+  {
+    /*  Spectrum of the 2*N input samples up to the start of the period, slotIndex+1 calls back */
+    start = (S->ringIndex + (2u * S->ringLen) - ((slotIndex + 1u) * B) - fftLen) % S->ringLen;
+    n = S->ringLen - start;
+    if(n >= fftLen)
+    {
+      riscv_copy_f32(S->pRing + start, pScratch, fftLen);
+    }
+    else
+    {
+      riscv_copy_f32(S->pRing + start, pScratch, n);
+      riscv_copy_f32(S->pRing, pScratch + n, fftLen - n);
+    }
+    riscv_rfft_fast_f32(&Sseg->Srfft, pScratch, pFdl + ((uint32_t) Sseg->fdlIndex * fftLen), 0u);
+  }
+
+  if((slotIndex >= macFirst) && (slotIndex < (macFirst + macSlots)))
+  {
+    /*  Partitions pStart ... pEnd-1 of Y = sum of X[t-p] * H[p] */
+    n = slotIndex - macFirst;
+    pStart = ((n * numPartitions) + macSlots - 1u) / macSlots;
+    pEnd = (((n + 1u) * numPartitions) + macSlots - 1u) / macSlots;
+
+    for (p = pStart; p < pEnd; p++)
+    {
+      slot = ((uint32_t) Sseg->fdlIndex + numPartitions - p) % numPartitions;
+      pX = pFdl + (slot * fftLen);
+      pY = (p == 0u) ? pAcc : pScratch;
+
+      riscv_cmplx_mult_cmplx_f32(pX, (float32_t *) (pH + (p * fftLen)), pY, N);
+
+      /*  DC and Nyquist bins are real and packed in the first pair */
+      pY[0] = pX[0] * pH[p * fftLen];
+      pY[1] = pX[1] * pH[(p * fftLen) + 1u];
+
+      if(p != 0u)
+      {
+        riscv_add_f32(pAcc, pScratch, pAcc, fftLen);
+      }
+    }
+  }
+
+  if(slotIndex == ifftSlot)
+  {
+    /*  The next spectrum replaces the oldest one */
+    slot = (uint32_t) Sseg->fdlIndex + 1u;
+    Sseg->fdlIndex = (uint16_t) ((slot == numPartitions) ? 0u : slot);
+
+    /*  Overlap-save: the second half is the output of the next period */
+    riscv_rfft_fast_f32(&Sseg->Srfft, pAcc, pScratch, 1u);
+    riscv_copy_f32(pScratch + N, pOut + ((parity ^ 1u) * N), N);
+  }
+}
+
+/**
+* @brief  Processing function for the floating-point non-uniformly partitioned convolution FIR filter.
+* @param[in,out] *S          points to an instance of the floating-point non-uniformly partitioned convolution FIR structure.
+* @param[in]     *pSrc       points to the block of input data.
+* @param[out]    *pDst       points to the block of output data.
+* @param[in]     blockSize   number of samples to process, a multiple of the <code>blockSize</code> given to riscv_fir_nupc_init_f32().
+* @return none.
+*
+* The output equals the output of riscv_fir_f32() with the same coefficients, to the rounding of the FFTs.
+* The work is spread evenly over the calls when every call passes the <code>blockSize</code> of the
+* initialization.  <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+*/
+
+void riscv_fir_nupc_f32(
+  riscv_fir_nupc_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_nupc_f32);
+  uint32_t B = S->blockSize;                     /* Samples per call */
+  uint32_t blkCnt, j;                            /* Loop counters */
+
+  for (blkCnt = blockSize / B; blkCnt > 0u; blkCnt--)
+  {
+    /*  Input history of the segments, before pDst may overwrite pSrc */
+    if(S->numSegments != 0u)
+    {
+      riscv_copy_f32(pSrc, S->pRing + S->ringIndex, B);
+      S->ringIndex += B;
+      if(S->ringIndex == S->ringLen)
+      {
+        S->ringIndex = 0u;
+      }
+    }
+
+    /*  Taps 0 ... 2*B-1 in direct form */
+    riscv_fir_f32(&S->Shead, pSrc, pDst, B);
+
+    for (j = 0u; j < S->numSegments; j++)
+    {
+      riscv_fir_nupc_segment_f32(S, &S->Sseg[j], pDst);
+    }
+
+    S->count++;
+
+    pSrc += B;
+    pDst += B;
+  }
+}
+
+/**
+* @} end of FIR_NUPC group
+*/
@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_nupc_init_f32.c
+*
+* Description:  Initialization function for the floating-point non-uniformly
+*               partitioned convolution FIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_NUPC
+ * @{
+ */
+
+/* Longest partition, the real FFT of riscv_rfft_fast_f32() has at most 4096 points */
+#define RISCV_FIR_NUPC_MAX_PARTITION  2048u
+
+/**
+* @brief  Number of taps of the segment of partition length N, 0 past the last segment.
+*/
+
+static uint32_t riscv_fir_nupc_segment_taps(
+  uint32_t numTaps,
+  uint32_t N,
+  uint32_t j)
+{
+  if(numTaps <= (2u * N))
+  {
+    return (0u);
+  }
+
+  /*  The last segment covers the rest */
+  if((numTaps <= (4u * N)) || (N == RISCV_FIR_NUPC_MAX_PARTITION) || (j == (RISCV_FIR_NUPC_MAX_SEGMENTS - 1u)))
+  {
+    return (numTaps - (2u * N));
+  }
+
+  return (2u * N);
+}
+
+/**
+* @brief  Length of the state buffer of the floating-point non-uniformly partitioned convolution FIR filter.
+* @param[in]  numTaps    number of filter coefficients in the filter.
+* @param[in]  blockSize  samples per call, a power of two from 16 to 2048.
+* @return     the length of <code>pState</code> in words.
+*/
+
+uint32_t riscv_fir_nupc_state_len_f32(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  uint32_t headTaps = (numTaps < (2u * blockSize)) ? numTaps : (2u * blockSize);
+  uint32_t len = headTaps + blockSize - 1u;      /* State of the head */
+  uint32_t N = blockSize;
+  uint32_t j, taps, numPartitions;
+  uint32_t numSegments = 0u;
+
+  for (j = 0u; j < RISCV_FIR_NUPC_MAX_SEGMENTS; j++)
+  {
+    taps = riscv_fir_nupc_segment_taps(numTaps, N, j);
+    if(taps == 0u)
+    {
+      break;
+    }
+
+    numPartitions = (taps + N - 1u) / N;
+    len += 2u * N * ((2u * numPartitions) + 3u);
+    numSegments++;
+
+    if(((2u * N) + taps) >= numTaps)
+    {
+      break;
+    }
+    N *= 2u;
+  }
+
+  /*  Input history of three partitions of the last segment */
+  if(numSegments != 0u)
+  {
+    len += 3u * N;
+  }
+
+  return (len);
+}
+
+/**
+* @brief  Initialization function for the floating-point non-uniformly partitioned convolution FIR filter.
+* @param[in,out] *S         points to an instance of the floating-point non-uniformly partitioned convolution FIR structure.
+* @param[in]     numTaps    number of filter coefficients in the filter.
+* @param[in]     *pCoeffs   points to the filter coefficients, in the order of riscv_fir_init_f32().
+* @param[in]     *pState    points to the state buffer of riscv_fir_nupc_state_len_f32() words.
+* @param[in]     blockSize  samples per call, a power of two from 16 to 2048.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>numTaps</code> is 0 or <code>blockSize</code> is not supported.
+*
+* <b>Description:</b>
+* \par
+* <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+* <pre>
+*    {b[numTaps-1], b[numTaps-2], ..., b[1], b[0]}
+* </pre>
+* The head filter reads its <code>2*blockSize</code> coefficients from <code>pCoeffs</code> at every call,
+* the spectra of the segments are computed into <code>pState</code> with riscv_fir_fft_init_f32().
+* \par
+* <code>pState</code> holds the state of the head, the state of every segment in the layout of
+* riscv_fir_fft_init_f32() and the input history of the segments, which are cleared.
+*/
+
+riscv_status riscv_fir_nupc_init_f32(
+  riscv_fir_nupc_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_nupc_init_f32);
+  uint32_t headTaps;                             /* Taps filtered in direct form */
+  uint32_t N = blockSize;                        /* Partition length of the segment */
+  uint32_t j, taps, numPartitions;
+
+  if((numTaps == 0u) || (blockSize < 16u) || (blockSize > RISCV_FIR_NUPC_MAX_PARTITION) ||
+     ((blockSize & (blockSize - 1u)) != 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  headTaps = (numTaps < (2u * blockSize)) ? numTaps : (2u * blockSize);
+
+  S->numTaps = numTaps;
+  S->blockSize = (uint16_t) blockSize;
+  S->numSegments = 0u;
+  S->count = 0u;
+  S->ringIndex = 0u;
+  S->ringLen = 0u;
+
+  /*  b[0] ... b[headTaps-1] are the last coefficients of the time reversed order */
+  riscv_fir_init_f32(&S->Shead, (uint16_t) headTaps, pCoeffs + numTaps - headTaps, pState, blockSize);
+  pState += headTaps + blockSize - 1u;
+
+  for (j = 0u; j < RISCV_FIR_NUPC_MAX_SEGMENTS; j++)
+  {
+    taps = riscv_fir_nupc_segment_taps(numTaps, N, j);
+    if(taps == 0u)
+    {
+      break;
+    }
+
+    /*  Taps b[2*N] ... b[2*N+taps-1] */
+    (void) riscv_fir_fft_init_f32(&S->Sseg[j], (uint16_t) taps, pCoeffs + numTaps - (2u * N) - taps, pState, N);
+    numPartitions = (taps + N - 1u) / N;
+    pState += 2u * N * ((2u * numPartitions) + 3u);
+    S->numSegments++;
+
+    if(((2u * N) + taps) >= numTaps)
+    {
+      break;
+    }
+    N *= 2u;
+  }
+
+  if(S->numSegments != 0u)
+  {
+    S->ringLen = 3u * N;
+    S->pRing = pState;
+    riscv_fill_f32(0.0f, S->pRing, S->ringLen);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of FIR_NUPC group
+*/
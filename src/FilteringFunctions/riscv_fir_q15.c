@@ -61,8 +61,11 @@
  *   
  *   
  * \par Restrictions   
- *  If the silicon does not support unaligned memory access enable the macro UNALIGNED_SUPPORT_DISABLE   
- *	In this case input, output, state buffers should be aligned by 32-bit   
+ *  The xpulp version reads the state windows with aligned word loads and shuffles whatever the
+ *  alignment of the input and state buffers, and the coefficients as words: keep them 32-bit aligned.
+ *  The first and last word of every window are read by halfwords, and the state and the input are
+ *  copied with riscv_copy_q15(), so no sample outside the <code>numTaps+blockSize-1</code> state
+ *  or <code>pSrc</code> is read.
  *   
  * <b>Scaling and Overflow Behavior:</b>       
  * \par       
@@ -73,37 +76,56 @@
  * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.       
  * Lastly, the accumulator is saturated to yield a result in 1.15 format.       
  *       
+ * \par
+ * With the xpulp extensions the products are summed by pairs with <code>pv.dotsp.h</code>, whose
+ * 32-bit sum wraps when both products are 0x8000 * 0x8000, that is when two consecutive
+ * coefficients and the two state samples they multiply are all -1.0.
+ *
  * \par       
  * Refer to the function <code>riscv_fir_fast_q15()</code> for a faster but less precise implementation of this function.       
  */
 
 
+RISCV_DSP_FASTCODE(riscv_fir_q15)
 void riscv_fir_q15(
   const riscv_fir_instance_q15 * S,
   q15_t * pSrc,
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_q15);
+
+  /* Kernel specialized for numTaps, see riscv_fir_fixed.h */
+  if(S->pKernel != NULL)
+  {
+    S->pKernel(S, pSrc, pDst, blockSize);
+    return;
+  }
 
 #if defined (USE_DSP_RISCV)
 
   q15_t *pState = S->pState;                     /* State pointer */
   q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
-  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
   q15_t *px1;                                    /* Temporary q15 pointer for state buffer */
   q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
-  q31_t x0, x1, x2, x3, c0;                      /* Temporary variables to hold SIMD state and coefficient values */
   q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
   uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
   uint32_t tapCnt, blkCnt;                       /* Loop counters */
-  shortV *VectInA = NULL; /*compiler generates unreasonable  warning here, although it is initialized later*/
-  shortV *VectInB;
-  shortV *VectInC;
-  shortV *VectInD;
-  shortV *VectInE;
-  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
-  /* pStateCurnt points to the location where the new input data should be written */
-  pStateCurnt = &(S->pState[(numTaps - 1u)]);
+  uint32_t offset;                               /* Sample offset of the state windows in their words */
+  shortV w0, w1, w2;                             /* Aligned pairs of the state */
+  shortV xA, xB, xD, xE, c0;                     /* State pairs of the four outputs and coefficient pair */
+  shortV evenSel, oddSel;                        /* Pairs at the window and one sample after it */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples.
+   * The new input samples are copied after them, word accesses whatever the alignment. */
+  riscv_copy_q15(pSrc, &(S->pState[(numTaps - 1u)]), blockSize);
+
+  /* The windows of four outputs start 4 samples apart, so all of them are at the same offset in
+   * their word.  Each state pair is taken from two aligned loads with one shuffle, the pair at the
+   * window with evenSel and the pair one sample later with oddSel, so no load is misaligned. */
+  offset = ((uintptr_t) pState & 2u) >> 1u;
+  evenSel = pack2(offset, offset + 1u);
+  oddSel = pack2(offset + 1u, offset + 2u);
 
   /* Apply loop unrolling and compute 4 output values simultaneously.       
    * The variables acc0 ... acc3 hold output values that are being computed:       
@@ -120,95 +142,65 @@ void riscv_fir_q15(
    ** a second loop below computes the remaining 1 to 3 samples. */
   while(blkCnt > 0u)
   {
-    /* Copy four new input samples into the state buffer.       
-     ** Use 32-bit SIMD to move the 16-bit data.  Only requires two copies. */
-    *(shortV*)pStateCurnt =*(shortV*)pSrc;
-    pStateCurnt+=2;
-    pSrc+=2;
-    *(shortV*)pStateCurnt =*(shortV*)pSrc;
-    pStateCurnt+=2;
-    pSrc+=2;
-
     /* Set all accumulators to zero */
     acc0 = 0;
     acc1 = 0;
     acc2 = 0;
     acc3 = 0;
 
-    /* Initialize state pointer of type q15 */
-    px1 = pState;
+    /* Aligned pointer to the second word of the window */
+    px1 = pState + (2u - offset);
 
     /* Initialize coeff pointer of type q31 */
     pb = pCoeffs;
 
+    /* Read the first two samples from the state buffer:  x[n-N], x[n-N-1],
+     * and the second and third: x[n-N-1], x[n-N-2].  The first word is read by halfwords, so
+     * the sample before the state is not read when the state is one sample off a word. */
+    w0 = pack2(pState[0], pState[1u - offset]);
+    w1 = *(shortV *) px1;
+    xA = shufflev4(w0, w1, evenSel);
+    xB = shufflev4(w0, w1, oddSel);
 
-    /* Read the first two samples from the state buffer:  x[n-N], x[n-N-1] */
-    VectInA = (shortV*)(px1);
-    /* Read the third and forth samples from the state buffer: x[n-N-1], x[n-N-2] */
-    VectInB = (shortV*)(px1+1u);
-    px1 += 2u;
-
-    /* Loop over the number of taps.  Unroll by a factor of 4.       
-     ** Repeat until we've computed numTaps-4 coefficients. */
-    tapCnt = numTaps >> 2;
+    /* Loop over the pairs of taps but the last one.  Each pair reads one more word of the window. */
+    tapCnt = (numTaps >> 1) - 1u;
 
     while(tapCnt > 0u)
     {
-      /* Read the first two coefficients using SIMD:  b[N] and b[N-1] coefficients */
-      VectInC = (shortV*)pb;
-      pb+=2;
+      /* Read two coefficients using SIMD:  b[N] and b[N-1] */
+      c0 = *(shortV *) pb;
+      pb += 2;
       /* acc0 +=  b[N] * x[n-N] + b[N-1] * x[n-N-1] */
-      acc0 += dotpv2(*VectInA,*VectInC);
+      acc0 += dotpv2(xA, c0);
       /* acc1 +=  b[N] * x[n-N-1] + b[N-1] * x[n-N-2] */
-      acc1 += dotpv2(*VectInB,*VectInC);
-      /* Read state x[n-N-2], x[n-N-3] */
-      VectInD = (shortV*)px1; 
-      /* Read state x[n-N-3], x[n-N-4] */
-      VectInE = (shortV*)(px1+1u);
+      acc1 += dotpv2(xB, c0);
+      /* Read state x[n-N-2], x[n-N-3] and x[n-N-3], x[n-N-4] */
+      w2 = *(shortV *) (px1 + 2u);
+      xD = shufflev4(w1, w2, evenSel);
+      xE = shufflev4(w1, w2, oddSel);
       /* acc2 +=  b[N] * x[n-N-2] + b[N-1] * x[n-N-3] */
-      acc2 += dotpv2(*VectInD,*VectInC);
+      acc2 += dotpv2(xD, c0);
       /* acc3 +=  b[N] * x[n-N-3] + b[N-1] * x[n-N-4] */
-      acc3 += dotpv2(*VectInE,*VectInC);
-      /* Read coefficients b[N-2], b[N-3] */
-      VectInC = (shortV*)pb;
-      pb+=2;
-      /* acc0 +=  b[N-2] * x[n-N-2] + b[N-3] * x[n-N-3] */
-      acc0 += dotpv2(*VectInD,*VectInC);
-      /* acc1 +=  b[N-2] * x[n-N-3] + b[N-3] * x[n-N-4] */
-      acc1 += dotpv2(*VectInE,*VectInC);
-      /* Read state x[n-N-4], x[n-N-5] */
-      VectInA = (shortV*)(px1+2u);
-      /* Read state x[n-N-5], x[n-N-6] */
-      VectInB = (shortV*)(px1+3u);
-      /* acc2 +=  b[N-2] * x[n-N-4] + b[N-3] * x[n-N-5] */
-      acc2 += dotpv2(*VectInA,*VectInC);
-      /* acc3 +=  b[N-2] * x[n-N-5] + b[N-3] * x[n-N-6] */
-      acc3 += dotpv2(*VectInB,*VectInC);
-      px1 += 4u;
+      acc3 += dotpv2(xE, c0);
+      /* The windows move by two samples */
+      xA = xD;
+      xB = xE;
+      w1 = w2;
+      px1 += 2u;
 
       tapCnt--;
-
     }
 
-
-    /* If the filter length is not a multiple of 4, compute the remaining filter taps.       
-     ** This is always be 2 taps since the filter length is even. */
-    if((numTaps & 0x3u) != 0u)
-    {
-      /* Read 2 coefficients */
-      VectInC = (shortV*)pb;
-      pb+=2;
-      /* Fetch 4 state variables */
-      VectInD = (shortV*)px1;
-      VectInE = (shortV*)(px1+1u);
-      /* Perform the multiply-accumulates */
-      acc0 += dotpv2(*VectInA,*VectInC);
-      px1 += 2u;
-
-      acc1 += dotpv2(*VectInB,*VectInC);
-      acc2 += dotpv2(*VectInD,*VectInC);
-      acc3 += dotpv2(*VectInE,*VectInC);
-    }
+    /* Last pair of taps.  Its word is read by halfwords, so the sample after the state is not
+     * read when the state is on a word boundary. */
+    c0 = *(shortV *) pb;
+    w2 = pack2(px1[2], px1[2u + offset]);
+    xD = shufflev4(w1, w2, evenSel);
+    xE = shufflev4(w1, w2, oddSel);
+    acc0 += dotpv2(xA, c0);
+    acc1 += dotpv2(xB, c0);
+    acc2 += dotpv2(xD, c0);
+    acc3 += dotpv2(xE, c0);
 
     /* The results in the 4 accumulators are in 2.30 format.  Convert to 1.15 with saturation.       
      ** Then store the 4 outputs in the destination buffer. */
@@ -227,34 +219,11 @@ void riscv_fir_q15(
   }
 
   /* If the blockSize is not a multiple of 4, compute any remaining output samples here.       
-   ** No loop unrolling is used. */
+   ** The window moves by one sample, the dot product realigns it. */
   blkCnt = blockSize % 0x4u;
   while(blkCnt > 0u)
   {
-    /* Copy two samples into state buffer */
-    *pStateCurnt++ = *pSrc++;
-
-    /* Set the accumulator to zero */
-    acc0 = 0;
-
-    /* Initialize state pointer of type q15 */
-    px1 = pState;
-
-    /* Initialize coeff pointer of type q31 */
-    pb = pCoeffs;
-
-    tapCnt = numTaps >> 1;
-
-    do
-    {
-      VectInC = (shortV*)pb;
-      pb+=2;
-      VectInD = (shortV*)px1;
-      px1+=2;
-      acc0 += dotpv2(*VectInA,*VectInC);
-      tapCnt--;
-    }
-    while(tapCnt > 0u);
+    riscv_dot_prod_q15(pState, pCoeffs, numTaps, &acc0);
 
     /* The result is in 2.30 format.  Convert to 1.15 with saturation.       
      ** Then store the output in the destination buffer. */
@@ -268,40 +237,9 @@ void riscv_fir_q15(
   }
 
   /* Processing is complete.       
-   ** Now copy the last numTaps - 1 samples to the satrt of the state buffer.       
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.       
    ** This prepares the state buffer for the next function call. */
-
-  /* Points to the start of the state buffer */
-  pStateCurnt = S->pState;
-
-  /* Calculation of count for copying integer writes */
-  tapCnt = (numTaps - 1u) >> 2;
-
-  while(tapCnt > 0u)
-  {
-
-    /* Copy state values to start of state buffer */
-    *(shortV*)pStateCurnt =*(shortV*)pState;
-    pStateCurnt+=2;
-    pSrc+=2;
-    *(shortV*)pStateCurnt =*(shortV*)pState;
-    pStateCurnt+=2;
-    pSrc+=2;
-    tapCnt--;
-
-  }
-
-  /* Calculation of count for remaining q15_t data */
-  tapCnt = (numTaps - 1u) % 0x4u;
-
-  /* copy remaining data */
-  while(tapCnt > 0u)
-  {
-    *pStateCurnt++ = *pState++;
-
-    /* Decrement the loop counter */
-    tapCnt--;
-  }
+  riscv_copy_q15(pState, S->pState, numTaps - 1u);
 
 #else
 
@@ -71,18 +71,28 @@
  * Refer to the function <code>riscv_fir_fast_q31()</code> for a faster but less precise implementation of this filter for Cortex-M3 and Cortex-M4.    
  */
 
+RISCV_DSP_FASTCODE(riscv_fir_q31)
 void riscv_fir_q31(
   const riscv_fir_instance_q31 * S,
   q31_t * pSrc,
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_q31);
+
+  /* Kernel specialized for numTaps, see riscv_fir_fixed.h */
+  if(S->pKernel != NULL)
+  {
+    S->pKernel(S, pSrc, pDst, blockSize);
+    return;
+  }
   q31_t *pState = S->pState;                     /* State pointer */
   q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
   q31_t *pStateCurnt;                            /* Points to the current sample of the state */
-
-
-
+#if defined (USE_DSP_RISCV) && defined (RISCV_MATH_LOOPUNROLL)
+  q31_t x0, x1, x2, x3, c0;                      /* Temporary variables to hold state and coefficient values */
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators of four outputs */
+#endif
   q31_t *px;                                     /* Temporary pointer for state */
   q31_t *pb;                                     /* Temporary pointer for coefficient buffer */
   q63_t acc;                                     /* Accumulator */
@@ -93,9 +103,81 @@ void riscv_fir_q31(
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = &(S->pState[(numTaps - 1u)]);
 
+#if defined (USE_DSP_RISCV) && defined (RISCV_MATH_LOOPUNROLL)
+
+  /* Compute 4 outputs at a time, so that each coefficient is loaded once for four
+   * multiply-accumulates and each state sample once per tap:
+   *
+   *    acc0 =  b[numTaps-1] * x[n-numTaps-1] + ... + b[0] * x[0]
+   *    acc1 =  b[numTaps-1] * x[n-numTaps]   + ... + b[0] * x[1]
+   *    acc2 =  b[numTaps-1] * x[n-numTaps+1] + ... + b[0] * x[2]
+   *    acc3 =  b[numTaps-1] * x[n-numTaps+2] + ... + b[0] * x[3]
+   *
+   * The products are the same 2.62 values as below (mul, mulh), so are the outputs. */
+  blkCnt = blockSize >> 2;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy four new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+    px = pState;
+    pb = pCoeffs;
+
+    /* Read the first three samples, each tap reads one more */
+    x0 = *px++;
+    x1 = *px++;
+    x2 = *px++;
+
+    i = numTaps;
+
+    do
+    {
+      c0 = *pb++;
+      x3 = *px++;
+
+      acc0 += (q63_t) x0 * c0;
+      acc1 += (q63_t) x1 * c0;
+      acc2 += (q63_t) x2 * c0;
+      acc3 += (q63_t) x3 * c0;
+
+      x0 = x1;
+      x1 = x2;
+      x2 = x3;
+
+      i--;
+    } while(i > 0u);
+
+    /* The results are in 2.62 format, convert to 1.31 */
+    *pDst++ = (q31_t) (acc0 >> 31u);
+    *pDst++ = (q31_t) (acc1 >> 31u);
+    *pDst++ = (q31_t) (acc2 >> 31u);
+    *pDst++ = (q31_t) (acc3 >> 31u);
+
+    /* Advance the state pointer by 4 to process the next group of 4 samples */
+    pState = pState + 4;
+
+    blkCnt--;
+  }
+
+  /* The remaining 0 to 3 outputs one at a time */
+  blkCnt = blockSize & 3u;
+
+#else
+
   /* Initialize blkCnt with blockSize */
   blkCnt = blockSize;
 
+#endif /* #if defined (USE_DSP_RISCV) && defined (RISCV_MATH_LOOPUNROLL) */
+
   while(blkCnt > 0u)
   {
     /* Copy one sample at a time into state buffer */
@@ -74,23 +74,21 @@ void riscv_fir_q7(
   q7_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_q7);
 
 #if defined (USE_DSP_RISCV)
   q7_t *pState = S->pState;                      /* State pointer */
   q7_t *pCoeffs = S->pCoeffs;                    /* Coefficient pointer */
   q7_t *pStateCurnt;                             /* Points to the current sample of the state */
-  q7_t x0, x1=0, x2=0, x3=0,x4=0,x5=0,x6=0;      /* Temporary variables to hold state */
-  q7_t c0;                                       /* Temporary variable to hold coefficient value */
   q7_t *px;                                      /* Temporary pointer for state */
   q7_t *pb;                                      /* Temporary pointer for coefficient buffer */
+  q7_t c0;                                       /* Temporary variable to hold coefficient value */
   q31_t acc0, acc1, acc2, acc3;                  /* Accumulators */
   uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
   uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
-  charV VectInACC0;
-  charV VectInACC1;
-  charV VectInACC2;
-  charV VectInACC3;
-  charV *VectInC0;
+  charV VectInC;                                 /* Four coefficients */
+  charV VectInX0, VectInX1, VectInX2, VectInX3;  /* Four state samples of each output */
+
   /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = &(S->pState[(numTaps - 1u)]);
@@ -102,6 +100,9 @@ void riscv_fir_q7(
    *    acc1 =  b[numTaps-1] * x[n-numTaps] +   b[numTaps-2] * x[n-numTaps-1] + b[numTaps-3] * x[n-numTaps-2] +...+ b[0] * x[1]    
    *    acc2 =  b[numTaps-1] * x[n-numTaps+1] + b[numTaps-2] * x[n-numTaps] +   b[numTaps-3] * x[n-numTaps-1] +...+ b[0] * x[2]    
    *    acc3 =  b[numTaps-1] * x[n-numTaps+2] + b[numTaps-2] * x[n-numTaps+1] + b[numTaps-3] * x[n-numTaps]   +...+ b[0] * x[3]    
+   *
+   * Every loop iteration loads four packed coefficients and the four packed state samples
+   * of each output, starting at px, px+1, px+2 and px+3, and performs 16 MACs with four sumdotpv4.
    */
   blkCnt = blockSize >> 2;
 
@@ -125,65 +126,44 @@ void riscv_fir_q7(
     /* Initialize coefficient pointer */
     pb = pCoeffs;
 
-    /* Read the first three samples from the state buffer:    
-     *  x[n-numTaps], x[n-numTaps-1], x[n-numTaps-2] */
-    x0 = *(px++);
-    x1 = *(px++);
-    x2 = *(px++);
-
     /* Loop unrolling.  Process 4 taps at a time. */
     tapCnt = numTaps >> 2;
-    i = tapCnt;
 
-    while(i > 0u)
+    while(tapCnt > 0u)
     {
-      x3 = *px;
-      x4 = *(px + 1u);  
-      x5 = *(px + 2u); 
-      x6 = *(px + 3u); 
-      VectInC0 = (charV*)pb;
-      VectInACC0 = pack4(x0,x1,x2,x3);
-      VectInACC1 = pack4(x1,x2,x3,x4);
-      VectInACC2 = pack4(x2,x3,x4,x5);
-      VectInACC3 = pack4(x3,x4,x5,x6);
-
-      acc0 = sumdotpv4(VectInACC0,*VectInC0,acc0);
-      acc1 = sumdotpv4(VectInACC1,*VectInC0,acc1);
-      acc2 = sumdotpv4(VectInACC2,*VectInC0,acc2);
-      acc3 = sumdotpv4(VectInACC3,*VectInC0,acc3);
-
-      /* update coefficient pointer */
+      /* Read b[numTaps-1], ..., b[numTaps-4] and the state samples of the four outputs */
+      VectInC = *(charV*)pb;
+      VectInX0 = *(charV*)px;
+      VectInX1 = *(charV*)(px + 1);
+      VectInX2 = *(charV*)(px + 2);
+      VectInX3 = *(charV*)(px + 3);
+
+      acc0 = sumdotpv4(VectInX0,VectInC,acc0);
+      acc1 = sumdotpv4(VectInX1,VectInC,acc1);
+      acc2 = sumdotpv4(VectInX2,VectInC,acc2);
+      acc3 = sumdotpv4(VectInX3,VectInC,acc3);
+
+      /* update coefficient and state pointers */
       pb += 4u;
       px += 4u;
-      
+
       /* Decrement the loop counter */
-      i--;
+      tapCnt--;
     }
 
     /* If the filter length is not a multiple of 4, compute the remaining filter taps */
-    x0 = x4;
-    x1 = x5;
-    x2 = x6;
-
-    i = numTaps - (tapCnt * 4u);
+    i = numTaps & 0x3u;
     while(i > 0u)
     {
       /* Read coefficients */
       c0 = *(pb++);
 
-      /* Fetch 1 state variable */
-      x3 = *(px++);
-
       /* Perform the multiply-accumulates */
-      acc0 = mac(x0 , c0,acc0);
-      acc1 = mac( x1 , c0,acc1);
-      acc2 = mac( x2 , c0,acc2); 
-      acc3 = mac( x3 , c0,acc3);
-
-      /* Reuse the present sample states for next sample */
-      x0 = x1;
-      x1 = x2;
-      x2 = x3;
+      acc0 = mac(px[0], c0, acc0);
+      acc1 = mac(px[1], c0, acc1);
+      acc2 = mac(px[2], c0, acc2);
+      acc3 = mac(px[3], c0, acc3);
+      px++;
 
       /* Decrement the loop counter */
       i--;
@@ -192,7 +172,7 @@ void riscv_fir_q7(
     /* Advance the state pointer by 4 to process the next group of 4 samples */
     pState = pState + 4;
 
-    /* The results in the 4 accumulators are in 2.62 format.  Convert to 1.31    
+    /* The results in the 4 accumulators are in 18.14 format.  Convert to 1.7 with saturation.    
      ** Then store the 4 outputs in the destination buffer. */
     acc0 = clip((acc0 >> 7u), -128,127);
     acc1 = clip((acc1 >> 7u),-128,127);
@@ -223,14 +203,22 @@ void riscv_fir_q7(
     /* Initialize Coefficient pointer */
     pb = (pCoeffs);
 
-    i = numTaps;
+    /* Perform the multiply-accumulates, 4 taps at a time */
+    tapCnt = numTaps >> 2;
+    while(tapCnt > 0u)
+    {
+      acc0 = sumdotpv4(*(charV*)px,*(charV*)pb,acc0);
+      px += 4u;
+      pb += 4u;
+      tapCnt--;
+    }
 
-    /* Perform the multiply-accumulates */
-    do
+    i = numTaps & 0x3u;
+    while(i > 0u)
     {
-      acc0 += (q15_t) * (px++) * (*(pb++));
+      acc0 = mac(*(px++), *(pb++), acc0);
       i--;
-    } while(i > 0u);
+    }
 
     /* The result is in 2.14 format.  Convert to 1.7    
      ** Then store the output in the destination buffer. */
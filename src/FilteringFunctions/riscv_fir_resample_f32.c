@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_resample_f32.c
+*
+* Description:  Floating-point polyphase FIR sample rate converter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Sample Rate Converter
+ *
+ * These functions change the sample rate by the rational factor <code>L/M</code>, for example
+ * 16 kHz to 12 kHz with <code>L=3</code>, <code>M=4</code>.
+ * Conceptually they are equivalent to riscv_fir_interpolate_f32() with the upsample factor <code>L</code>
+ * followed by a decimation by <code>M</code> without filter, i.e. riscv_fir_decimate_f32() with the single
+ * coefficient 1.  Output <code>m</code> is output <code>m*M+M-1</code> of the interpolator.
+ * \par
+ * Instead of computing all <code>L</code> interpolator outputs and discarding <code>M-1</code> of every
+ * <code>M</code>, the functions only evaluate the polyphase branch of every remaining output:
+ * <pre>
+ *    t    = m*M + M-1
+ *    n    = t / L,  p = t % L
+ *    y[m] = b[p] * x[n] + b[L+p] * x[n-1] + ... + b[L*(phaseLength-1)+p] * x[n-phaseLength+1]
+ * </pre>
+ * Outputs <code>m</code> and <code>m+L</code> use the same branch <code>p</code> with the input advanced by
+ * <code>M</code> samples, so the functions compute the outputs <code>m</code>, <code>m+L</code>,
+ * <code>m+2L</code> and <code>m+3L</code> together and every coefficient is loaded once for four outputs.
+ * \par
+ * <code>pSrc</code> points to an array of <code>blockSize</code> input values and
+ * <code>pDst</code> points to an array of <code>blockSize*L/M</code> output values.
+ * <code>blockSize*L</code> must be a multiple of <code>M</code> and this is checked by the initialization functions.
+ * \par
+ * The initialization functions take the prototype filter of <code>numTaps</code> coefficients in the time
+ * reversed order of riscv_fir_interpolate_init_f32(), <code>numTaps</code> must be a multiple of <code>L</code>:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], ..., b[1], b[0]}
+ * </pre>
+ * and copy it to <code>pPhaseCoeffs</code> with the <code>phaseLength</code> coefficients of each branch stored
+ * contiguously, in the order of riscv_fir_f32().
+ * The Q15 version pads each branch to an even length with a zero coefficient so that it can use the pair loads of
+ * riscv_fir_q15().
+ * \par
+ * <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>,
+ * with the same layout as the state of riscv_fir_interpolate_f32().
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/*
+* @brief  Computes four outputs of one polyphase branch.
+* @param[in]  *pCoeffs   points to the coefficients of the branch.
+* @param[in]  phaseLen   number of coefficients of the branch.
+* @param[in]  *pX        points to the oldest state sample of the first output.
+* @param[in]  M          distance between the state samples of two outputs.
+* @param[out] *pOut      points to the first output.
+* @param[in]  outStride  distance between two outputs.
+*/
+
+static void riscv_fir_resample_4_f32(
+  const float32_t * pCoeffs,
+  uint32_t phaseLen,
+  const float32_t * pX,
+  uint32_t M,
+  float32_t * pOut,
+  uint32_t outStride)
+{
+  const float32_t *px0 = pX;                     /* Windows of the four outputs */
+  const float32_t *px1 = pX + M;
+  const float32_t *px2 = pX + (2u * M);
+  const float32_t *px3 = pX + (3u * M);
+  float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;  /* Accumulators */
+  float32_t c;                                   /* Coefficient */
+  uint32_t tapCnt;
+
+  for (tapCnt = phaseLen; tapCnt > 0u; tapCnt--)
+  {
+    /* One coefficient load serves the four outputs */
+    c = *pCoeffs++;
+    acc0 += *px0++ * c;
+    acc1 += *px1++ * c;
+    acc2 += *px2++ * c;
+    acc3 += *px3++ * c;
+  }
+
+  pOut[0] = acc0;
+  pOut[outStride] = acc1;
+  pOut[2u * outStride] = acc2;
+  pOut[3u * outStride] = acc3;
+}
+
+/**
+ * @brief Processing function for the floating-point FIR sample rate converter.
+ * @param[in]  *S         points to an instance of the floating-point FIR sample rate converter structure.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[out] *pDst      points to the block of <code>blockSize*L/M</code> output values.
+ * @param[in]  blockSize  number of input samples to process per call, as given to riscv_fir_resample_init_f32().
+ * @return none.
+ */
+
+void riscv_fir_resample_f32(
+  const riscv_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_resample_f32);
+  float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;         /* Polyphase coefficient pointer */
+  const float32_t *pb, *px;                      /* Coefficient and state pointers */
+  float32_t acc;                                 /* Accumulator */
+  uint32_t L = S->L, M = S->M;                   /* Upsample and downsample factors */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t numOut = (blockSize * L) / M;         /* Number of output samples */
+  uint32_t nStep = M / L, pStep = M % L;         /* Input and phase advance between two outputs */
+  uint32_t n, p, nj, pj;                         /* Newest input sample and branch of an output */
+  uint32_t m, j, i, tapCnt;                      /* Loop counters */
+
+  /* Append the new input to the previous phaseLen - 1 samples */
+  for (i = 0u; i < blockSize; i++)
+  {
+    pState[(phaseLen - 1u) + i] = pSrc[i];
+  }
+
+  /* Output 0 is interpolator output M - 1 */
+  n = (M - 1u) / L;
+  p = (M - 1u) % L;
+
+  /* Outputs m + j + r*L, r = 0..3, of every branch share the coefficient loads */
+  for (m = 0u; (m + (4u * L)) <= numOut; m += 4u * L)
+  {
+    nj = n;
+    pj = p;
+
+    for (j = 0u; j < L; j++)
+    {
+      riscv_fir_resample_4_f32(pCoeffs + (pj * phaseLen), phaseLen, pState + nj, M, pDst + m + j, L);
+
+      nj += nStep;
+      pj += pStep;
+      if(pj >= L)
+      {
+        pj -= L;
+        nj++;
+      }
+    }
+
+    n += 4u * M;
+  }
+
+  /* Remaining outputs, one at a time */
+  for (; m < numOut; m++)
+  {
+    pb = pCoeffs + (p * phaseLen);
+    px = pState + n;
+    acc = 0.0f;
+
+    for (tapCnt = phaseLen; tapCnt > 0u; tapCnt--)
+    {
+      acc += *px++ * *pb++;
+    }
+
+    pDst[m] = acc;
+
+    n += nStep;
+    p += pStep;
+    if(p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Keep the last phaseLen - 1 samples for the next call */
+  for (i = 0u; i < (phaseLen - 1u); i++)
+  {
+    pState[i] = pState[i + blockSize];
+  }
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
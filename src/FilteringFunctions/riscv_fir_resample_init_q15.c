@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_resample_init_q15.c
+*
+* Description:  Initialization function for the Q15 polyphase
+*               FIR sample rate converter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 FIR sample rate converter.
+ * @param[in,out] *S             points to an instance of the Q15 FIR sample rate converter structure.
+ * @param[in]     L              upsample factor.
+ * @param[in]     M              downsample factor.
+ * @param[in]     numTaps        number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs       points to the filter coefficients, in the order of riscv_fir_interpolate_init_q15().
+ * @param[out]    *pPhaseCoeffs  points to a buffer of <code>L*phaseLength</code> words that receives the polyphase coefficients.
+ * @param[in]     *pState        points to the state buffer.
+ * @param[in]     blockSize      number of input samples to process per call.
+ * @return        The function returns RISCV_MATH_SUCCESS if initialization is successful, RISCV_MATH_ARGUMENT_ERROR if
+ * <code>L</code> or <code>M</code> is 0, or RISCV_MATH_LENGTH_ERROR if <code>numTaps</code> is not a nonzero multiple
+ * of <code>L</code> or <code>blockSize*L</code> is not a multiple of <code>M</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pPhaseCoeffs</code> must stay valid as long as the instance is used, <code>pCoeffs</code> is no longer needed.
+ * \par
+ * <code>phaseLength</code> is <code>numTaps/L</code> rounded up to an even number, an odd branch length is padded
+ * with a leading zero coefficient for the coefficient pair loads of the processing function.
+ * \par
+ * <code>pState</code> is of length <code>phaseLength+blockSize-1</code> words.
+ */
+
+riscv_status riscv_fir_resample_init_q15(
+  riscv_fir_resample_instance_q15 * S,
+  uint8_t L,
+  uint8_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pPhaseCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_resample_init_q15);
+  uint32_t phaseLen, pad, p, k;
+
+  if((L == 0u) || (M == 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  if((numTaps == 0u) || ((numTaps % L) != 0u) || (((blockSize * L) % M) != 0u))
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  /* Pad odd branches to an even length */
+  pad = (numTaps / L) & 1u;
+  phaseLen = (numTaps / L) + pad;
+
+  /* Branch p holds 0 when padded, then b[p + L*(numTaps/L-1)], ..., b[p + L], b[p] */
+  for (p = 0u; p < L; p++)
+  {
+    pPhaseCoeffs[p * phaseLen] = 0;
+
+    for (k = pad; k < phaseLen; k++)
+    {
+      pPhaseCoeffs[(p * phaseLen) + k] = pCoeffs[((L - 1u) - p) + ((k - pad) * L)];
+    }
+  }
+
+  S->L = L;
+  S->M = M;
+  S->phaseLength = (uint16_t) phaseLen;
+  S->pCoeffs = pPhaseCoeffs;
+  S->pState = pState;
+
+  /* Clear state buffer and size of buffer is always phaseLength + blockSize - 1 */
+  memset(pState, 0, (blockSize + (phaseLen - 1u)) * sizeof(q15_t));
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,217 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_resample_q15.c
+*
+* Description:  Q15 polyphase FIR sample rate converter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/*
+* @brief  Computes four outputs of one polyphase branch.
+* @param[in]  *pCoeffs   points to the coefficients of the branch.
+* @param[in]  phaseLen   number of coefficients of the branch, even.
+* @param[in]  *pX        points to the oldest state sample of the first output.
+* @param[in]  M          distance between the state samples of two outputs.
+* @param[out] *pOut      points to the first output.
+* @param[in]  outStride  distance between two outputs.
+*/
+
+static void riscv_fir_resample_4_q15(
+  const q15_t * pCoeffs,
+  uint32_t phaseLen,
+  const q15_t * pX,
+  uint32_t M,
+  q15_t * pOut,
+  uint32_t outStride)
+{
+  const q15_t *px0 = pX;                         /* Windows of the four outputs */
+  const q15_t *px1 = pX + M;
+  const q15_t *px2 = pX + (2u * M);
+  const q15_t *px3 = pX + (3u * M);
+  q63_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;  /* Accumulators */
+  uint32_t tapCnt;
+
+#if defined (USE_DSP_RISCV)
+
+  shortV c;                                      /* Coefficient pair */
+
+  for (tapCnt = phaseLen >> 1; tapCnt > 0u; tapCnt--)
+  {
+    /* One coefficient pair load serves the four outputs */
+    c = *(shortV *) pCoeffs;
+    pCoeffs += 2;
+    acc0 += dotpv2(*(shortV *) px0, c);
+    acc1 += dotpv2(*(shortV *) px1, c);
+    acc2 += dotpv2(*(shortV *) px2, c);
+    acc3 += dotpv2(*(shortV *) px3, c);
+    px0 += 2;
+    px1 += 2;
+    px2 += 2;
+    px3 += 2;
+  }
+
+  pOut[0] = (q15_t) (clip((acc0 >> 15), -32768, 32767));
+  pOut[outStride] = (q15_t) (clip((acc1 >> 15), -32768, 32767));
+  pOut[2u * outStride] = (q15_t) (clip((acc2 >> 15), -32768, 32767));
+  pOut[3u * outStride] = (q15_t) (clip((acc3 >> 15), -32768, 32767));
+
+#else
+
+  q15_t c;                                       /* Coefficient */
+
+  for (tapCnt = phaseLen; tapCnt > 0u; tapCnt--)
+  {
+    /* One coefficient load serves the four outputs */
+    c = *pCoeffs++;
+    acc0 += (q31_t) *px0++ * c;
+    acc1 += (q31_t) *px1++ * c;
+    acc2 += (q31_t) *px2++ * c;
+    acc3 += (q31_t) *px3++ * c;
+  }
+
+  pOut[0] = (q15_t) (__SSAT((acc0 >> 15), 16));
+  pOut[outStride] = (q15_t) (__SSAT((acc1 >> 15), 16));
+  pOut[2u * outStride] = (q15_t) (__SSAT((acc2 >> 15), 16));
+  pOut[3u * outStride] = (q15_t) (__SSAT((acc3 >> 15), 16));
+
+#endif
+}
+
+/*
+* @brief  Computes one output of one polyphase branch.
+* @param[in]  *pCoeffs   points to the coefficients of the branch.
+* @param[in]  phaseLen   number of coefficients of the branch, even.
+* @param[in]  *pX        points to the oldest state sample of the output.
+* @return     output sample.
+*/
+
+static q15_t riscv_fir_resample_1_q15(
+  const q15_t * pCoeffs,
+  uint32_t phaseLen,
+  const q15_t * pX)
+{
+  q63_t acc = 0;                                 /* Accumulator */
+  uint32_t tapCnt;
+
+#if defined (USE_DSP_RISCV)
+
+  for (tapCnt = phaseLen >> 1; tapCnt > 0u; tapCnt--)
+  {
+    acc += dotpv2(*(shortV *) pX, *(shortV *) pCoeffs);
+    pX += 2;
+    pCoeffs += 2;
+  }
+
+#else
+
+  for (tapCnt = phaseLen; tapCnt > 0u; tapCnt--)
+  {
+    acc += (q31_t) *pX++ * *pCoeffs++;
+  }
+
+#endif
+
+  return ((q15_t) __SSAT((acc >> 15), 16));
+}
+
+/**
+ * @brief Processing function for the Q15 FIR sample rate converter.
+ * @param[in]  *S         points to an instance of the Q15 FIR sample rate converter structure.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[out] *pDst      points to the block of <code>blockSize*L/M</code> output values.
+ * @param[in]  blockSize  number of input samples to process per call, as given to riscv_fir_resample_init_q15().
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator, as riscv_fir_q15().
+ * Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+ * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+ * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+ * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ */
+
+void riscv_fir_resample_q15(
+  const riscv_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_resample_q15);
+  q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pCoeffs = S->pCoeffs;             /* Polyphase coefficient pointer */
+  uint32_t L = S->L, M = S->M;                   /* Upsample and downsample factors */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t numOut = (blockSize * L) / M;         /* Number of output samples */
+  uint32_t nStep = M / L, pStep = M % L;         /* Input and phase advance between two outputs */
+  uint32_t n, p, nj, pj;                         /* Newest input sample and branch of an output */
+  uint32_t m, j, i;                              /* Loop counters */
+
+  /* Append the new input to the previous phaseLen - 1 samples */
+  for (i = 0u; i < blockSize; i++)
+  {
+    pState[(phaseLen - 1u) + i] = pSrc[i];
+  }
+
+  /* Output 0 is interpolator output M - 1 */
+  n = (M - 1u) / L;
+  p = (M - 1u) % L;
+
+  /* Outputs m + j + r*L, r = 0..3, of every branch share the coefficient loads */
+  for (m = 0u; (m + (4u * L)) <= numOut; m += 4u * L)
+  {
+    nj = n;
+    pj = p;
+
+    for (j = 0u; j < L; j++)
+    {
+      riscv_fir_resample_4_q15(pCoeffs + (pj * phaseLen), phaseLen, pState + nj, M, pDst + m + j, L);
+
+      nj += nStep;
+      pj += pStep;
+      if(pj >= L)
+      {
+        pj -= L;
+        nj++;
+      }
+    }
+
+    n += 4u * M;
+  }
+
+  /* Remaining outputs, one at a time */
+  for (; m < numOut; m++)
+  {
+    pDst[m] = riscv_fir_resample_1_q15(pCoeffs + (p * phaseLen), phaseLen, pState + n);
+
+    n += nStep;
+    p += pStep;
+    if(p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Keep the last phaseLen - 1 samples for the next call */
+  for (i = 0u; i < (phaseLen - 1u); i++)
+  {
+    pState[i] = pState[i + blockSize];
+  }
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
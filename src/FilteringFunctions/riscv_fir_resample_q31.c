@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_resample_q31.c
+*
+* Description:  Q31 polyphase FIR sample rate converter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/*
+* @brief  Computes four outputs of one polyphase branch.
+* @param[in]  *pCoeffs   points to the coefficients of the branch.
+* @param[in]  phaseLen   number of coefficients of the branch.
+* @param[in]  *pX        points to the oldest state sample of the first output.
+* @param[in]  M          distance between the state samples of two outputs.
+* @param[out] *pOut      points to the first output.
+* @param[in]  outStride  distance between two outputs.
+*/
+
+static void riscv_fir_resample_4_q31(
+  const q31_t * pCoeffs,
+  uint32_t phaseLen,
+  const q31_t * pX,
+  uint32_t M,
+  q31_t * pOut,
+  uint32_t outStride)
+{
+  const q31_t *px0 = pX;                         /* Windows of the four outputs */
+  const q31_t *px1 = pX + M;
+  const q31_t *px2 = pX + (2u * M);
+  const q31_t *px3 = pX + (3u * M);
+  q63_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;  /* Accumulators */
+  q31_t c;                                       /* Coefficient */
+  uint32_t tapCnt;
+
+  for (tapCnt = phaseLen; tapCnt > 0u; tapCnt--)
+  {
+    /* One coefficient load serves the four outputs */
+    c = *pCoeffs++;
+    acc0 += (q63_t) *px0++ * c;
+    acc1 += (q63_t) *px1++ * c;
+    acc2 += (q63_t) *px2++ * c;
+    acc3 += (q63_t) *px3++ * c;
+  }
+
+  /* Convert the 2.62 results to 1.31 */
+  pOut[0] = (q31_t) (acc0 >> 31);
+  pOut[outStride] = (q31_t) (acc1 >> 31);
+  pOut[2u * outStride] = (q31_t) (acc2 >> 31);
+  pOut[3u * outStride] = (q31_t) (acc3 >> 31);
+}
+
+/**
+ * @brief Processing function for the Q31 FIR sample rate converter.
+ * @param[in]  *S         points to an instance of the Q31 FIR sample rate converter structure.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[out] *pDst      points to the block of <code>blockSize*L/M</code> output values.
+ * @param[in]  blockSize  number of input samples to process per call, as given to riscv_fir_resample_init_q31().
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using an internal 64-bit accumulator, as riscv_fir_interpolate_q31().
+ * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+ * Thus, if the accumulator result overflows it wraps around rather than clip.
+ * In order to avoid overflows completely the input signal must be scaled down by <code>1/(numTaps/L)</code>.
+ * After all multiply-accumulates are performed, the low 31 bits of the 2.62 accumulator are discarded to yield a 1.31 result.
+ */
+
+void riscv_fir_resample_q31(
+  const riscv_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_resample_q31);
+  q31_t *pState = S->pState;                     /* State pointer */
+  const q31_t *pCoeffs = S->pCoeffs;             /* Polyphase coefficient pointer */
+  const q31_t *pb, *px;                          /* Coefficient and state pointers */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t L = S->L, M = S->M;                   /* Upsample and downsample factors */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t numOut = (blockSize * L) / M;         /* Number of output samples */
+  uint32_t nStep = M / L, pStep = M % L;         /* Input and phase advance between two outputs */
+  uint32_t n, p, nj, pj;                         /* Newest input sample and branch of an output */
+  uint32_t m, j, i, tapCnt;                      /* Loop counters */
+
+  /* Append the new input to the previous phaseLen - 1 samples */
+  for (i = 0u; i < blockSize; i++)
+  {
+    pState[(phaseLen - 1u) + i] = pSrc[i];
+  }
+
+  /* Output 0 is interpolator output M - 1 */
+  n = (M - 1u) / L;
+  p = (M - 1u) % L;
+
+  /* Outputs m + j + r*L, r = 0..3, of every branch share the coefficient loads */
+  for (m = 0u; (m + (4u * L)) <= numOut; m += 4u * L)
+  {
+    nj = n;
+    pj = p;
+
+    for (j = 0u; j < L; j++)
+    {
+      riscv_fir_resample_4_q31(pCoeffs + (pj * phaseLen), phaseLen, pState + nj, M, pDst + m + j, L);
+
+      nj += nStep;
+      pj += pStep;
+      if(pj >= L)
+      {
+        pj -= L;
+        nj++;
+      }
+    }
+
+    n += 4u * M;
+  }
+
+  /* Remaining outputs, one at a time */
+  for (; m < numOut; m++)
+  {
+    pb = pCoeffs + (p * phaseLen);
+    px = pState + n;
+    acc = 0;
+
+    for (tapCnt = phaseLen; tapCnt > 0u; tapCnt--)
+    {
+      acc += (q63_t) *px++ * *pb++;
+    }
+
+    pDst[m] = (q31_t) (acc >> 31);
+
+    n += nStep;
+    p += pStep;
+    if(p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Keep the last phaseLen - 1 samples for the next call */
+  for (i = 0u; i < (phaseLen - 1u); i++)
+  {
+    pState[i] = pState[i + blockSize];
+  }
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
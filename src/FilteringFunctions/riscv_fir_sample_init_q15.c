@@ -0,0 +1,60 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_sample_init_q15.c
+*
+* Description:  Initialization function for the Q15 single-sample FIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 single-sample FIR filter.
+ * @param[out]    *S         points to an instance of the Q15 single-sample FIR structure.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs   points to the filter coefficients, 32-bit aligned.
+ * @param[in]     *pState    points to the state buffer of <code>2*numTaps</code> values, 32-bit aligned.
+ * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR if <code>numTaps</code> is 0.
+ *
+ * \par
+ * The coefficients are in the time reversed order of riscv_fir_init_q15() and the state is cleared to
+ * zero.  Unlike the block filter the state does not depend on a block size, riscv_fir_sample_q15() always
+ * processes one sample.
+ */
+
+riscv_status riscv_fir_sample_init_q15(
+  riscv_fir_sample_instance_q15 * S,
+  uint16_t numTaps,
+  const q15_t * pCoeffs,
+  q15_t * pState)
+{
+  RISCV_PROFILE(riscv_fir_sample_init_q15);
+
+  if(numTaps == 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  memset(pState, 0, 2u * numTaps * sizeof(q15_t));
+
+  S->numTaps = numTaps;
+  S->stateIndex = 0u;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_shared_init_q31.c
+*
+* Description:  Initialization of the shared coefficients and of the
+*               streams of a Q31 FIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the shared coefficients of a Q31 FIR filter.
+ * @param[out] *C        points to the shared coefficients.
+ * @param[in]  numTaps   number of filter coefficients in the filter.
+ * @param[in]  *pCoeffs  points to the coefficients, in time reversed order as for riscv_fir_init_q31().
+ * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if numTaps is 0.
+ *
+ * \par
+ * See riscv_fir_shared_coefs_init_q15() for the sharing rules.
+ */
+
+riscv_status riscv_fir_shared_coefs_init_q31(
+  riscv_fir_shared_coefs_q31 * C,
+  uint16_t numTaps,
+  const q31_t * pCoeffs)
+{
+  RISCV_PROFILE(riscv_fir_shared_coefs_init_q31);
+
+  if(numTaps == 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  C->numTaps = numTaps;
+  C->pCoeffs = pCoeffs;
+
+  /* Kernel specialized for numTaps, if the library has one */
+  C->pKernel = riscv_fir_fixed_find_q31(numTaps);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Initialization function for one stream of a shared Q31 FIR filter.
+ * @param[out] *T         points to the state of the stream.
+ * @param[in]  *C         points to the shared coefficients.
+ * @param[in]  *pState    points to the state buffer of the stream, of length <code>numTaps+blockSize-1</code>.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     none.
+ */
+
+void riscv_fir_shared_state_init_q31(
+  riscv_fir_shared_state_q31 * T,
+  const riscv_fir_shared_coefs_q31 * C,
+  q31_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_shared_state_init_q31);
+
+  /* Clear the state buffer, its size is numTaps + blockSize - 1 */
+  memset(pState, 0, (C->numTaps + (blockSize - 1u)) * sizeof(q31_t));
+
+  T->pCoefs = C;
+  T->pState = pState;
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,55 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_shared_q15.c
+*
+* Description:  Q15 FIR filter running one stream of shared coefficients.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Processing function for one stream of a shared Q15 FIR filter.
+ * @param[in,out] *T         points to the state of the stream.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return        none.
+ *
+ * \par
+ * Runs riscv_fir_q15() on an instance assembled on the stack from the shared coefficients and the
+ * state of <code>T</code>, so the outputs are the same.  Only <code>T->pState</code> is written:
+ * streams with their own state can call it at the same time on one riscv_fir_shared_coefs_q15.
+ */
+
+void riscv_fir_shared_q15(
+  riscv_fir_shared_state_q15 * T,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_shared_q15);
+  const riscv_fir_shared_coefs_q15 *C = T->pCoefs;
+  riscv_fir_instance_q15 local;                  /* Instance of the call */
+
+  local.numTaps = C->numTaps;
+  local.pState = T->pState;
+  local.pCoeffs = (q15_t *) C->pCoeffs;         /* read only by the kernels */
+  local.pKernel = C->pKernel;
+
+  riscv_fir_q15(&local, pSrc, pDst, blockSize);
+}
+
+/**
+ * @} end of FIR group
+ */
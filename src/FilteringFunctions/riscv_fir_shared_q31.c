@@ -0,0 +1,53 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_shared_q31.c
+*
+* Description:  Q31 FIR filter running one stream of shared coefficients.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Processing function for one stream of a shared Q31 FIR filter.
+ * @param[in,out] *T         points to the state of the stream.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return        none.
+ *
+ * \par
+ * Runs riscv_fir_q31() like riscv_fir_shared_q15() does for Q15.
+ */
+
+void riscv_fir_shared_q31(
+  riscv_fir_shared_state_q31 * T,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_shared_q31);
+  const riscv_fir_shared_coefs_q31 *C = T->pCoefs;
+  riscv_fir_instance_q31 local;                  /* Instance of the call */
+
+  local.numTaps = C->numTaps;
+  local.pState = T->pState;
+  local.pCoeffs = (q31_t *) C->pCoeffs;         /* read only by the kernels */
+  local.pKernel = C->pKernel;
+
+  riscv_fir_q31(&local, pSrc, pDst, blockSize);
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -117,7 +117,7 @@
  * @param[in]  *S          points to an instance of the floating-point sparse FIR structure.   
  * @param[in]  *pSrc       points to the block of input data.   
  * @param[out] *pDst       points to the block of output data   
- * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.   
+ * @param[in]  *pScratchIn points to a temporary buffer of size blockSize, not used, may be NULL.
  * @param[in]  blockSize   number of input samples to process per call.   
  * @return none.   
  */
@@ -129,152 +129,100 @@ void riscv_fir_sparse_f32(
   float32_t * pScratchIn,
   uint32_t blockSize)
 {
-
+  RISCV_PROFILE(riscv_fir_sparse_f32);
   float32_t *pState = S->pState;                 /* State pointer */
-  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
-  float32_t *px;                                 /* Scratch buffer pointer */
-  float32_t *py = pState;                        /* Temporary pointers for state buffer */
-  float32_t *pb = pScratchIn;                    /* Temporary pointers for scratch buffer */
-  float32_t *pOut;                               /* Destination pointer */
-  int32_t *pTapDelay = S->pTapDelay;             /* Pointer to the array containing offset of the non-zero tap values. */
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+  const int32_t *pTapDelay = S->pTapDelay;       /* Pointer to the array containing offset of the non-zero tap values. */
   uint32_t delaySize = S->maxDelay + blockSize;  /* state length */
-  uint16_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter  */
-  int32_t readIndex;                             /* Read index of the state buffer */
-  uint32_t tapCnt, blkCnt;                       /* loop counters */
-  float32_t coeff = *pCoeffs++;                  /* Read the first coefficient value */
-
-
+  uint16_t numTaps = S->numTaps;                 /* Filter order */
+  const float32_t *px;                           /* Pointer to four state samples */
+  float32_t x0, x1, x2, x3, coeff;               /* State samples and coefficient */
+  float32_t acc0, acc1, acc2, acc3;              /* Accumulators */
+  int32_t base, readIndex;                       /* Read indices of the state buffer */
+  uint32_t tapCnt, j;                            /* loop counters */
 
   /* BlockSize of Input samples are copied into the state buffer */
   /* StateIndex points to the starting position to write in the state buffer */
-  riscv_circularWrite_f32((int32_t *) py, delaySize, &S->stateIndex, 1,
+  riscv_circularWrite_f32((int32_t *) pState, (int32_t) delaySize, &S->stateIndex, 1,
                         (int32_t *) pSrc, 1, blockSize);
 
+  /* Position of the first new sample in the state buffer, before the wraparound */
+  base = (int32_t) S->stateIndex - (int32_t) blockSize;
 
-  /* Read Index, from where the state buffer should be read, is calculated. */
-  readIndex = ((int32_t) S->stateIndex - (int32_t) blockSize) - *pTapDelay++;
-
-  /* Wraparound of readIndex */
-  if(readIndex < 0)
-  {
-    readIndex += (int32_t) delaySize;
-  }
-
-  /* Working pointer for state buffer is updated */
-  py = pState;
-
-  /* blockSize samples are read from the state buffer */
-  riscv_circularRead_f32((int32_t *) py, delaySize, &readIndex, 1,
-                       (int32_t *) pb, (int32_t *) pb, blockSize, 1,
-                       blockSize);
-
-  /* Working pointer for the scratch buffer */
-  px = pb;
-
-  /* Working pointer for destination buffer */
-  pOut = pDst;
-
-  blkCnt = blockSize;
-
-  while(blkCnt > 0u)
+  /* Four outputs at a time are accumulated in registers over all taps.
+   * The delayed samples are read directly from the state buffer, one wraparound check per tap. */
+  for (j = 0u; (j + 4u) <= blockSize; j += 4u)
   {
-    /* Perform Multiplications and store in destination buffer */
-    *pOut++ = *px++ * coeff;
-
-    /* Decrement the loop counter */
-    blkCnt--;
-  }
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+    acc2 = 0.0f;
+    acc3 = 0.0f;
 
-  /* Load the coefficient value and           
-   * increment the coefficient buffer for the next set of state values */
-  coeff = *pCoeffs++;
-
-  /* Read Index, from where the state buffer should be read, is calculated. */
-  readIndex = ((int32_t) S->stateIndex - (int32_t) blockSize) - *pTapDelay++;
+    for (tapCnt = 0u; tapCnt < numTaps; tapCnt++)
+    {
+      coeff = pCoeffs[tapCnt];
+
+      /* Read Index, from where the state buffer should be read, is calculated. */
+      readIndex = (base + (int32_t) j) - pTapDelay[tapCnt];
+
+      /* Wraparound of readIndex */
+      if(readIndex < 0)
+      {
+        readIndex += (int32_t) delaySize;
+      }
+
+      if(readIndex <= ((int32_t) delaySize - 4))
+      {
+        px = pState + readIndex;
+        x0 = px[0];
+        x1 = px[1];
+        x2 = px[2];
+        x3 = px[3];
+      }
+      else
+      {
+        /* The four samples wrap around the end of the state buffer */
+        x0 = pState[readIndex];
+        readIndex = ((readIndex + 1) == (int32_t) delaySize) ? 0 : (readIndex + 1);
+        x1 = pState[readIndex];
+        readIndex = ((readIndex + 1) == (int32_t) delaySize) ? 0 : (readIndex + 1);
+        x2 = pState[readIndex];
+        readIndex = ((readIndex + 1) == (int32_t) delaySize) ? 0 : (readIndex + 1);
+        x3 = pState[readIndex];
+      }
+
+      acc0 += x0 * coeff;
+      acc1 += x1 * coeff;
+      acc2 += x2 * coeff;
+      acc3 += x3 * coeff;
+    }
 
-  /* Wraparound of readIndex */
-  if(readIndex < 0)
-  {
-    readIndex += (int32_t) delaySize;
+    pDst[j] = acc0;
+    pDst[j + 1u] = acc1;
+    pDst[j + 2u] = acc2;
+    pDst[j + 3u] = acc3;
   }
 
-  /* Loop over the number of taps. */
-  tapCnt = (uint32_t) numTaps - 2u;
-
-  while(tapCnt > 0u)
+  /* Remaining 1 to 3 outputs */
+  for (; j < blockSize; j++)
   {
+    acc0 = 0.0f;
 
-    /* Working pointer for state buffer is updated */
-    py = pState;
-
-    /* blockSize samples are read from the state buffer */
-    riscv_circularRead_f32((int32_t *) py, delaySize, &readIndex, 1,
-                         (int32_t *) pb, (int32_t *) pb, blockSize, 1,
-                         blockSize);
-
-    /* Working pointer for the scratch buffer */
-    px = pb;
-
-    /* Working pointer for destination buffer */
-    pOut = pDst;
-
-    blkCnt = blockSize;
-
-    while(blkCnt > 0u)
+    for (tapCnt = 0u; tapCnt < numTaps; tapCnt++)
     {
-      /* Perform Multiply-Accumulate */
-      *pOut++ += *px++ * coeff;
-
-      /* Decrement the loop counter */
-      blkCnt--;
-    }
-
-    /* Load the coefficient value and           
-     * increment the coefficient buffer for the next set of state values */
-    coeff = *pCoeffs++;
+      coeff = pCoeffs[tapCnt];
 
-    /* Read Index, from where the state buffer should be read, is calculated. */
-    readIndex =
-      ((int32_t) S->stateIndex - (int32_t) blockSize) - *pTapDelay++;
+      readIndex = (base + (int32_t) j) - pTapDelay[tapCnt];
+      if(readIndex < 0)
+      {
+        readIndex += (int32_t) delaySize;
+      }
 
-    /* Wraparound of readIndex */
-    if(readIndex < 0)
-    {
-      readIndex += (int32_t) delaySize;
+      acc0 += pState[readIndex] * coeff;
     }
 
-    /* Decrement the tap loop counter */
-    tapCnt--;
+    pDst[j] = acc0;
   }
-	
-	/* Compute last tap without the final read of pTapDelay */	
-	
-	/* Working pointer for state buffer is updated */
-	py = pState;
-
-	/* blockSize samples are read from the state buffer */
-	riscv_circularRead_f32((int32_t *) py, delaySize, &readIndex, 1,
-											 (int32_t *) pb, (int32_t *) pb, blockSize, 1,
-											 blockSize);
-
-	/* Working pointer for the scratch buffer */
-	px = pb;
-
-	/* Working pointer for destination buffer */
-	pOut = pDst;
-
-	blkCnt = blockSize;
-
-	while(blkCnt > 0u)
-	{
-		/* Perform Multiply-Accumulate */
-		*pOut++ += *px++ * coeff;
-
-		/* Decrement the loop counter */
-		blkCnt--;
-	}
-
-
 }
 
 /**    
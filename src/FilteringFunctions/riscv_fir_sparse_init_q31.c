@@ -80,6 +80,7 @@ void riscv_fir_sparse_init_q31(
   uint16_t maxDelay,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_sparse_init_q31);
   /* Assign filter taps */
   S->numTaps = numTaps;
 
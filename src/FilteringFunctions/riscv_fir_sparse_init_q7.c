@@ -81,6 +81,7 @@ void riscv_fir_sparse_init_q7(
   uint16_t maxDelay,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_sparse_init_q7);
   /* Assign filter taps */
   S->numTaps = numTaps;
 
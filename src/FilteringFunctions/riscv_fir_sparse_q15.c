@@ -51,8 +51,8 @@
  * @param[in]  *S           points to an instance of the Q15 sparse FIR structure.   
  * @param[in]  *pSrc        points to the block of input data.   
  * @param[out] *pDst        points to the block of output data   
- * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.   
- * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.   
+ * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize, not used, may be NULL.
+ * @param[in]  *pScratchOut points to a temporary buffer of size blockSize, not used, may be NULL.
  * @param[in]  blockSize    number of input samples to process per call.   
  * @return none.   
  *    
@@ -75,385 +75,105 @@ void riscv_fir_sparse_q15(
   q31_t * pScratchOut,
   uint32_t blockSize)
 {
-
+  RISCV_PROFILE(riscv_fir_sparse_q15);
   q15_t *pState = S->pState;                     /* State pointer */
-  q15_t *pIn = pSrc;                             /* Working pointer for input */
-  q15_t *pOut = pDst;                            /* Working pointer for output */
-  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
-  q15_t *px;                                     /* Temporary pointers for scratch buffer */
-  q15_t *pb = pScratchIn;                        /* Temporary pointers for scratch buffer */
-  q15_t *py = pState;                            /* Temporary pointers for state buffer */
-  int32_t *pTapDelay = S->pTapDelay;             /* Pointer to the array containing offset of the non-zero tap values. */
+  const q15_t *pCoeffs = S->pCoeffs;             /* Coefficient pointer */
+  const int32_t *pTapDelay = S->pTapDelay;       /* Pointer to the array containing offset of the non-zero tap values. */
   uint32_t delaySize = S->maxDelay + blockSize;  /* state length */
   uint16_t numTaps = S->numTaps;                 /* Filter order */
-  int32_t readIndex;                             /* Read index of the state buffer */
-  uint32_t tapCnt, blkCnt;                       /* loop counters */
-  q15_t coeff = *pCoeffs++;                      /* Read the first coefficient value */
-  q31_t *pScr2 = pScratchOut;                    /* Working pointer for pScratchOut */
-
-#if defined (USE_DSP_RISCV)
-
-  q31_t in1, in2;                                /* Temporary variables */
-
+  const q15_t *px;                               /* Pointer to four state samples */
+  q15_t x0, x1, x2, x3, coeff;                   /* State samples and coefficient */
+  q31_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  int32_t base, readIndex;                       /* Read indices of the state buffer */
+  uint32_t tapCnt, j;                            /* loop counters */
 
   /* BlockSize of Input samples are copied into the state buffer */
   /* StateIndex points to the starting position to write in the state buffer */
-  riscv_circularWrite_q15(py, delaySize, &S->stateIndex, 1, pIn, 1, blockSize);
-
-  /* Loop over the number of taps. */
-  tapCnt = numTaps;
-
-  /* Read Index, from where the state buffer should be read, is calculated. */
-  readIndex = (S->stateIndex - blockSize) - *pTapDelay++;
-
-  /* Wraparound of readIndex */
-  if(readIndex < 0)
-  {
-    readIndex += (int32_t) delaySize;
-  }
-
-  /* Working pointer for state buffer is updated */
-  py = pState;
-
-  /* blockSize samples are read from the state buffer */
-  riscv_circularRead_q15(py, delaySize, &readIndex, 1,
-                       pb, pb, blockSize, 1, blockSize);
-
-  /* Working pointer for the scratch buffer of state values */
-  px = pb;
-
-  /* Working pointer for scratch buffer of output values */
-  pScratchOut = pScr2;
+  riscv_circularWrite_q15(pState, (int32_t) delaySize, &S->stateIndex, 1, pSrc, 1, blockSize);
 
-  /* Loop over the blockSize. Unroll by a factor of 4.    
-   * Compute 4 multiplications at a time. */
-  blkCnt = blockSize >> 2;
+  /* Position of the first new sample in the state buffer, before the wraparound */
+  base = (int32_t) S->stateIndex - (int32_t) blockSize;
 
-  while(blkCnt > 0u)
+  /* Four outputs at a time are accumulated in registers over all taps.
+   * The delayed samples are read directly from the state buffer, one wraparound check per tap. */
+  for (j = 0u; (j + 4u) <= blockSize; j += 4u)
   {
-    /* Perform multiplication and store in the scratch buffer */
-    *pScratchOut++ = ((q31_t) * px++ * coeff);
-    *pScratchOut++ = ((q31_t) * px++ * coeff);
-    *pScratchOut++ = ((q31_t) * px++ * coeff);
-    *pScratchOut++ = ((q31_t) * px++ * coeff);
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
 
-    /* Decrement the loop counter */
-    blkCnt--;
-  }
-
-  /* If the blockSize is not a multiple of 4,    
-   * compute the remaining samples */
-  blkCnt = blockSize % 0x4u;
-
-  while(blkCnt > 0u)
-  {
-    /* Perform multiplication and store in the scratch buffer */
-    *pScratchOut++ = ((q31_t) * px++ * coeff);
-
-    /* Decrement the loop counter */
-    blkCnt--;
-  }
-
-  /* Load the coefficient value and    
-   * increment the coefficient buffer for the next set of state values */
-  coeff = *pCoeffs++;
-
-  /* Read Index, from where the state buffer should be read, is calculated. */
-  readIndex = (S->stateIndex - blockSize) - *pTapDelay++;
-
-  /* Wraparound of readIndex */
-  if(readIndex < 0)
-  {
-    readIndex += (int32_t) delaySize;
-  }
-
-  /* Loop over the number of taps. */
-  tapCnt = (uint32_t) numTaps - 2u;
-
-  while(tapCnt > 0u)
-  {
-    /* Working pointer for state buffer is updated */
-    py = pState;
-
-    /* blockSize samples are read from the state buffer */
-    riscv_circularRead_q15(py, delaySize, &readIndex, 1,
-                         pb, pb, blockSize, 1, blockSize);
-
-    /* Working pointer for the scratch buffer of state values */
-    px = pb;
-
-    /* Working pointer for scratch buffer of output values */
-    pScratchOut = pScr2;
-
-    /* Loop over the blockSize. Unroll by a factor of 4.    
-     * Compute 4 MACS at a time. */
-    blkCnt = blockSize >> 2;
-
-    while(blkCnt > 0u)
-    {
-      /* Perform Multiply-Accumulate */
-     /* *pScratchOut++ += (q31_t) * px++ * coeff;
-      *pScratchOut++ += (q31_t) * px++ * coeff;
-      *pScratchOut++ += (q31_t) * px++ * coeff;
-      *pScratchOut++ += (q31_t) * px++ * coeff;*/
-      *pScratchOut = mac((int)(*px++),coeff,*pScratchOut);
-      pScratchOut++;
-      *pScratchOut = mac((int)(*px++),coeff,*pScratchOut);
-      pScratchOut++;
-      *pScratchOut = mac((int)(*px++),coeff,*pScratchOut);
-      pScratchOut++;
-      *pScratchOut = mac((int)(*px++),coeff,*pScratchOut);
-      pScratchOut++;
-
-      /* Decrement the loop counter */
-      blkCnt--;
-    }
-
-    /* If the blockSize is not a multiple of 4,    
-     * compute the remaining samples */
-    blkCnt = blockSize % 0x4u;
-
-    while(blkCnt > 0u)
+    for (tapCnt = 0u; tapCnt < numTaps; tapCnt++)
     {
-      /* Perform Multiply-Accumulate */
-      *pScratchOut++ += (q31_t) * px++ * coeff;
-
-      /* Decrement the loop counter */
-      blkCnt--;
+      coeff = pCoeffs[tapCnt];
+
+      /* Read Index, from where the state buffer should be read, is calculated. */
+      readIndex = (base + (int32_t) j) - pTapDelay[tapCnt];
+
+      /* Wraparound of readIndex */
+      if(readIndex < 0)
+      {
+        readIndex += (int32_t) delaySize;
+      }
+
+      if(readIndex <= ((int32_t) delaySize - 4))
+      {
+        px = pState + readIndex;
+        x0 = px[0];
+        x1 = px[1];
+        x2 = px[2];
+        x3 = px[3];
+      }
+      else
+      {
+        /* The four samples wrap around the end of the state buffer */
+        x0 = pState[readIndex];
+        readIndex = ((readIndex + 1) == (int32_t) delaySize) ? 0 : (readIndex + 1);
+        x1 = pState[readIndex];
+        readIndex = ((readIndex + 1) == (int32_t) delaySize) ? 0 : (readIndex + 1);
+        x2 = pState[readIndex];
+        readIndex = ((readIndex + 1) == (int32_t) delaySize) ? 0 : (readIndex + 1);
+        x3 = pState[readIndex];
+      }
+
+      acc0 += (q31_t) x0 * coeff;
+      acc1 += (q31_t) x1 * coeff;
+      acc2 += (q31_t) x2 * coeff;
+      acc3 += (q31_t) x3 * coeff;
     }
 
-    /* Load the coefficient value and    
-     * increment the coefficient buffer for the next set of state values */
-    coeff = *pCoeffs++;
-
-    /* Read Index, from where the state buffer should be read, is calculated. */
-    readIndex = (S->stateIndex - blockSize) - *pTapDelay++;
-
-    /* Wraparound of readIndex */
-    if(readIndex < 0)
-    {
-      readIndex += (int32_t) delaySize;
-    }
-
-    /* Decrement the tap loop counter */
-    tapCnt--;
-  }
-	
-	/* Compute last tap without the final read of pTapDelay */		
-
-	/* Working pointer for state buffer is updated */
-	py = pState;
-
-	/* blockSize samples are read from the state buffer */
-	riscv_circularRead_q15(py, delaySize, &readIndex, 1,
-											 pb, pb, blockSize, 1, blockSize);
-
-	/* Working pointer for the scratch buffer of state values */
-	px = pb;
-
-	/* Working pointer for scratch buffer of output values */
-	pScratchOut = pScr2;
-
-	/* Loop over the blockSize. Unroll by a factor of 4.    
-	 * Compute 4 MACS at a time. */
-	blkCnt = blockSize >> 2;
-
-	while(blkCnt > 0u)
-	{
-
-                *pScratchOut = mac((int)(*px++),coeff,*pScratchOut);
-                pScratchOut++;
-                *pScratchOut = mac((int)(*px++),coeff,*pScratchOut);
-                pScratchOut++;
-                *pScratchOut = mac((int)(*px++),coeff,*pScratchOut);
-                pScratchOut++;
-                *pScratchOut = mac((int)(*px++),coeff,*pScratchOut);
-                pScratchOut++;
-		/* Decrement the loop counter */
-		blkCnt--;
-	}
-
-	/* If the blockSize is not a multiple of 4,    
-	 * compute the remaining samples */
-	blkCnt = blockSize % 0x4u;
-
-	while(blkCnt > 0u)
-	{
-		/* Perform Multiply-Accumulate */
-		*pScratchOut++ += (q31_t) * px++ * coeff;
-
-		/* Decrement the loop counter */
-		blkCnt--;
-	}
-
-  /* All the output values are in pScratchOut buffer.    
-     Convert them into 1.15 format, saturate and store in the destination buffer. */
-  /* Loop over the blockSize. */
-  blkCnt = blockSize >> 2;
-
-  while(blkCnt > 0u)
-  {
-    in1 = *pScr2++;
-    in2 = *pScr2++;
-    *(shortV*)pOut = pack2(clip(in1 >> 15,-32768,32767),clip(in2 >> 15,-32768,32767));
-    pOut+=2;
-    in1 = *pScr2++;
-    in2 = *pScr2++;
-    *(shortV*)pOut = pack2(clip(in1 >> 15,-32768,32767),clip(in2 >> 15,-32768,32767));
-    pOut+=2;
-
-    blkCnt--;
-
-  }
-
-  /* If the blockSize is not a multiple of 4,    
-     remaining samples are processed in the below loop */
-  blkCnt = blockSize % 0x4u;
-
-  while(blkCnt > 0u)
-  {
-    *pOut++ = (q15_t) clip(*pScr2++ >> 15,-32768,32767);
-    blkCnt--;
-  }
-
+    /* The accumulators are in 2.30 format, convert them to 1.15 with saturation */
+#if defined (USE_DSP_RISCV)
+    *(shortV *) (pDst + j) = pack2(clip(acc0 >> 15, -32768, 32767), clip(acc1 >> 15, -32768, 32767));
+    *(shortV *) (pDst + j + 2u) = pack2(clip(acc2 >> 15, -32768, 32767), clip(acc3 >> 15, -32768, 32767));
 #else
-
-  /* BlockSize of Input samples are copied into the state buffer */
-  /* StateIndex points to the starting position to write in the state buffer */
-  riscv_circularWrite_q15(py, delaySize, &S->stateIndex, 1, pIn, 1, blockSize);
-
-  /* Loop over the number of taps. */
-  tapCnt = numTaps;
-
-  /* Read Index, from where the state buffer should be read, is calculated. */
-  readIndex = (S->stateIndex - blockSize) - *pTapDelay++;
-
-  /* Wraparound of readIndex */
-  if(readIndex < 0)
-  {
-    readIndex += (int32_t) delaySize;
-  }
-
-  /* Working pointer for state buffer is updated */
-  py = pState;
-
-  /* blockSize samples are read from the state buffer */
-  riscv_circularRead_q15(py, delaySize, &readIndex, 1,
-                       pb, pb, blockSize, 1, blockSize);
-
-  /* Working pointer for the scratch buffer of state values */
-  px = pb;
-
-  /* Working pointer for scratch buffer of output values */
-  pScratchOut = pScr2;
-
-  blkCnt = blockSize;
-
-  while(blkCnt > 0u)
-  {
-    /* Perform multiplication and store in the scratch buffer */
-    *pScratchOut++ = ((q31_t) * px++ * coeff);
-
-    /* Decrement the loop counter */
-    blkCnt--;
-  }
-
-  /* Load the coefficient value and           
-   * increment the coefficient buffer for the next set of state values */
-  coeff = *pCoeffs++;
-
-  /* Read Index, from where the state buffer should be read, is calculated. */
-  readIndex = (S->stateIndex - blockSize) - *pTapDelay++;
-
-  /* Wraparound of readIndex */
-  if(readIndex < 0)
-  {
-    readIndex += (int32_t) delaySize;
+    pDst[j] = (q15_t) __SSAT(acc0 >> 15, 16);
+    pDst[j + 1u] = (q15_t) __SSAT(acc1 >> 15, 16);
+    pDst[j + 2u] = (q15_t) __SSAT(acc2 >> 15, 16);
+    pDst[j + 3u] = (q15_t) __SSAT(acc3 >> 15, 16);
+#endif
   }
 
-  /* Loop over the number of taps. */
-  tapCnt = (uint32_t) numTaps - 2u;
-
-  while(tapCnt > 0u)
+  /* Remaining 1 to 3 outputs */
+  for (; j < blockSize; j++)
   {
-    /* Working pointer for state buffer is updated */
-    py = pState;
-
-    /* blockSize samples are read from the state buffer */
-    riscv_circularRead_q15(py, delaySize, &readIndex, 1,
-                         pb, pb, blockSize, 1, blockSize);
-
-    /* Working pointer for the scratch buffer of state values */
-    px = pb;
-
-    /* Working pointer for scratch buffer of output values */
-    pScratchOut = pScr2;
+    acc0 = 0;
 
-    blkCnt = blockSize;
-
-    while(blkCnt > 0u)
+    for (tapCnt = 0u; tapCnt < numTaps; tapCnt++)
     {
-      /* Perform Multiply-Accumulate */
-      *pScratchOut++ += (q31_t) * px++ * coeff;
-
-      /* Decrement the loop counter */
-      blkCnt--;
-    }
+      coeff = pCoeffs[tapCnt];
 
-    /* Load the coefficient value and           
-     * increment the coefficient buffer for the next set of state values */
-    coeff = *pCoeffs++;
+      readIndex = (base + (int32_t) j) - pTapDelay[tapCnt];
+      if(readIndex < 0)
+      {
+        readIndex += (int32_t) delaySize;
+      }
 
-    /* Read Index, from where the state buffer should be read, is calculated. */
-    readIndex = (S->stateIndex - blockSize) - *pTapDelay++;
-
-    /* Wraparound of readIndex */
-    if(readIndex < 0)
-    {
-      readIndex += (int32_t) delaySize;
+      acc0 += (q31_t) pState[readIndex] * coeff;
     }
 
-    /* Decrement the tap loop counter */
-    tapCnt--;
+    pDst[j] = (q15_t) __SSAT(acc0 >> 15, 16);
   }
-	
-	/* Compute last tap without the final read of pTapDelay */	
-	
-	/* Working pointer for state buffer is updated */
-	py = pState;
-
-	/* blockSize samples are read from the state buffer */
-	riscv_circularRead_q15(py, delaySize, &readIndex, 1,
-											 pb, pb, blockSize, 1, blockSize);
-
-	/* Working pointer for the scratch buffer of state values */
-	px = pb;
-
-	/* Working pointer for scratch buffer of output values */
-	pScratchOut = pScr2;
-
-	blkCnt = blockSize;
-
-	while(blkCnt > 0u)
-	{
-		/* Perform Multiply-Accumulate */
-		*pScratchOut++ += (q31_t) * px++ * coeff;
-
-		/* Decrement the loop counter */
-		blkCnt--;
-	}
-
-  /* All the output values are in pScratchOut buffer.       
-     Convert them into 1.15 format, saturate and store in the destination buffer. */
-  /* Loop over the blockSize. */
-  blkCnt = blockSize;
-
-  while(blkCnt > 0u)
-  {
-    *pOut++ = (q15_t) __SSAT(*pScr2++ >> 15, 16);
-    blkCnt--;
-  }
-#endif
 }
 
 /**    
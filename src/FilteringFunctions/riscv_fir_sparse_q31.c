@@ -52,7 +52,7 @@
  * @param[in]  *S          points to an instance of the Q31 sparse FIR structure.   
  * @param[in]  *pSrc       points to the block of input data.   
  * @param[out] *pDst       points to the block of output data   
- * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.   
+ * @param[in]  *pScratchIn points to a temporary buffer of size blockSize, not used, may be NULL.
  * @param[in]  blockSize   number of input samples to process per call.   
  * @return none.   
  *    
@@ -72,169 +72,101 @@ void riscv_fir_sparse_q31(
   q31_t * pScratchIn,
   uint32_t blockSize)
 {
-
+  RISCV_PROFILE(riscv_fir_sparse_q31);
   q31_t *pState = S->pState;                     /* State pointer */
-  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
-  q31_t *px;                                     /* Scratch buffer pointer */
-  q31_t *py = pState;                            /* Temporary pointers for state buffer */
-  q31_t *pb = pScratchIn;                        /* Temporary pointers for scratch buffer */
-  q31_t *pOut;                                   /* Destination pointer */
-  q63_t out;                                     /* Temporary output variable */
-  int32_t *pTapDelay = S->pTapDelay;             /* Pointer to the array containing offset of the non-zero tap values. */
+  const q31_t *pCoeffs = S->pCoeffs;             /* Coefficient pointer */
+  const int32_t *pTapDelay = S->pTapDelay;       /* Pointer to the array containing offset of the non-zero tap values. */
   uint32_t delaySize = S->maxDelay + blockSize;  /* state length */
   uint16_t numTaps = S->numTaps;                 /* Filter order */
-  int32_t readIndex;                             /* Read index of the state buffer */
-  uint32_t tapCnt, blkCnt;                       /* loop counters */
-  q31_t coeff = *pCoeffs++;                      /* Read the first coefficient value */
-  q31_t in;
-
+  const q31_t *px;                               /* Pointer to four state samples */
+  q31_t x0, x1, x2, x3, coeff;                   /* State samples and coefficient */
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  int32_t base, readIndex;                       /* Read indices of the state buffer */
+  uint32_t tapCnt, j;                            /* loop counters */
 
   /* BlockSize of Input samples are copied into the state buffer */
   /* StateIndex points to the starting position to write in the state buffer */
-  riscv_circularWrite_f32((int32_t *) py, delaySize, &S->stateIndex, 1,
+  riscv_circularWrite_f32((int32_t *) pState, (int32_t) delaySize, &S->stateIndex, 1,
                         (int32_t *) pSrc, 1, blockSize);
 
-  /* Read Index, from where the state buffer should be read, is calculated. */
-  readIndex = (int32_t) (S->stateIndex - blockSize) - *pTapDelay++;
-
-  /* Wraparound of readIndex */
-  if(readIndex < 0)
-  {
-    readIndex += (int32_t) delaySize;
-  }
-
-  /* Working pointer for state buffer is updated */
-  py = pState;
-
-  /* blockSize samples are read from the state buffer */
-  riscv_circularRead_f32((int32_t *) py, delaySize, &readIndex, 1,
-                       (int32_t *) pb, (int32_t *) pb, blockSize, 1,
-                       blockSize);
-
-  /* Working pointer for the scratch buffer of state values */
-  px = pb;
-
-  /* Working pointer for scratch buffer of output values */
-  pOut = pDst;
-
-  blkCnt = blockSize;
+  /* Position of the first new sample in the state buffer, before the wraparound */
+  base = (int32_t) S->stateIndex - (int32_t) blockSize;
 
-  while(blkCnt > 0u)
+  /* Four outputs at a time are accumulated in registers over all taps.
+   * The delayed samples are read directly from the state buffer, one wraparound check per tap. */
+  for (j = 0u; (j + 4u) <= blockSize; j += 4u)
   {
-    /* Perform Multiplications and store in the destination buffer */
-    *pOut++ = (q31_t) (((q63_t) * px++ * coeff) >> 32);
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
 
-    /* Decrement the loop counter */
-    blkCnt--;
-  }
-
-  /* Load the coefficient value and           
-   * increment the coefficient buffer for the next set of state values */
-  coeff = *pCoeffs++;
-
-  /* Read Index, from where the state buffer should be read, is calculated. */
-  readIndex = (int32_t) (S->stateIndex - blockSize) - *pTapDelay++;
+    for (tapCnt = 0u; tapCnt < numTaps; tapCnt++)
+    {
+      coeff = pCoeffs[tapCnt];
+
+      /* Read Index, from where the state buffer should be read, is calculated. */
+      readIndex = (base + (int32_t) j) - pTapDelay[tapCnt];
+
+      /* Wraparound of readIndex */
+      if(readIndex < 0)
+      {
+        readIndex += (int32_t) delaySize;
+      }
+
+      if(readIndex <= ((int32_t) delaySize - 4))
+      {
+        px = pState + readIndex;
+        x0 = px[0];
+        x1 = px[1];
+        x2 = px[2];
+        x3 = px[3];
+      }
+      else
+      {
+        /* The four samples wrap around the end of the state buffer */
+        x0 = pState[readIndex];
+        readIndex = ((readIndex + 1) == (int32_t) delaySize) ? 0 : (readIndex + 1);
+        x1 = pState[readIndex];
+        readIndex = ((readIndex + 1) == (int32_t) delaySize) ? 0 : (readIndex + 1);
+        x2 = pState[readIndex];
+        readIndex = ((readIndex + 1) == (int32_t) delaySize) ? 0 : (readIndex + 1);
+        x3 = pState[readIndex];
+      }
+
+      acc0 += ((q63_t) x0 * coeff) >> 32;
+      acc1 += ((q63_t) x1 * coeff) >> 32;
+      acc2 += ((q63_t) x2 * coeff) >> 32;
+      acc3 += ((q63_t) x3 * coeff) >> 32;
+    }
 
-  /* Wraparound of readIndex */
-  if(readIndex < 0)
-  {
-    readIndex += (int32_t) delaySize;
+    /* The accumulators are in 2.30 format, convert them to 1.31 */
+    pDst[j] = ((q31_t) acc0) << 1;
+    pDst[j + 1u] = ((q31_t) acc1) << 1;
+    pDst[j + 2u] = ((q31_t) acc2) << 1;
+    pDst[j + 3u] = ((q31_t) acc3) << 1;
   }
 
-  /* Loop over the number of taps. */
-  tapCnt = (uint32_t) numTaps - 2u;
-
-  while(tapCnt > 0u)
+  /* Remaining 1 to 3 outputs */
+  for (; j < blockSize; j++)
   {
-    /* Working pointer for state buffer is updated */
-    py = pState;
-
-    /* blockSize samples are read from the state buffer */
-    riscv_circularRead_f32((int32_t *) py, delaySize, &readIndex, 1,
-                         (int32_t *) pb, (int32_t *) pb, blockSize, 1,
-                         blockSize);
-
-    /* Working pointer for the scratch buffer of state values */
-    px = pb;
-
-    /* Working pointer for scratch buffer of output values */
-    pOut = pDst;
+    acc0 = 0;
 
-    blkCnt = blockSize;
-
-    while(blkCnt > 0u)
+    for (tapCnt = 0u; tapCnt < numTaps; tapCnt++)
     {
-      /* Perform Multiply-Accumulate */
-      out = *pOut;
-      out += ((q63_t) * px++ * coeff) >> 32;
-      *pOut++ = (q31_t) (out);
-
-      /* Decrement the loop counter */
-      blkCnt--;
-    }
+      coeff = pCoeffs[tapCnt];
 
-    /* Load the coefficient value and           
-     * increment the coefficient buffer for the next set of state values */
-    coeff = *pCoeffs++;
+      readIndex = (base + (int32_t) j) - pTapDelay[tapCnt];
+      if(readIndex < 0)
+      {
+        readIndex += (int32_t) delaySize;
+      }
 
-    /* Read Index, from where the state buffer should be read, is calculated. */
-    readIndex = (int32_t) (S->stateIndex - blockSize) - *pTapDelay++;
-
-    /* Wraparound of readIndex */
-    if(readIndex < 0)
-    {
-      readIndex += (int32_t) delaySize;
+      acc0 += ((q63_t) pState[readIndex] * coeff) >> 32;
     }
 
-    /* Decrement the tap loop counter */
-    tapCnt--;
+    pDst[j] = ((q31_t) acc0) << 1;
   }
-	
-	/* Compute last tap without the final read of pTapDelay */	
-	
-	/* Working pointer for state buffer is updated */
-	py = pState;
-
-	/* blockSize samples are read from the state buffer */
-	riscv_circularRead_f32((int32_t *) py, delaySize, &readIndex, 1,
-											 (int32_t *) pb, (int32_t *) pb, blockSize, 1,
-											 blockSize);
-
-	/* Working pointer for the scratch buffer of state values */
-	px = pb;
-
-	/* Working pointer for scratch buffer of output values */
-	pOut = pDst;
-
-	blkCnt = blockSize;
-
-	while(blkCnt > 0u)
-	{
-		/* Perform Multiply-Accumulate */
-		out = *pOut;
-		out += ((q63_t) * px++ * coeff) >> 32;
-		*pOut++ = (q31_t) (out);
-
-		/* Decrement the loop counter */
-		blkCnt--;
-	}
-
-  /* Working output pointer is updated */
-  pOut = pDst;
-
-  /* Output is converted into 1.31 format. */
-  blkCnt = blockSize;
-
-  while(blkCnt > 0u)
-  {
-    in = *pOut << 1;
-    *pOut++ = in;
-
-    /* Decrement the loop counter */
-    blkCnt--;
-  }
-
-
 }
 
 /**    
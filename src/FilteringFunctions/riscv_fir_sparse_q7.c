@@ -57,8 +57,8 @@
  * @param[in]  *S           points to an instance of the Q7 sparse FIR structure.   
  * @param[in]  *pSrc        points to the block of input data.   
  * @param[out] *pDst        points to the block of output data   
- * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.   
- * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.   
+ * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize, not used with USE_DSP_RISCV, or NULL for the scratch pool.
+ * @param[in]  *pScratchOut points to a temporary buffer of size blockSize, or NULL for the scratch pool.
  * @param[in]  blockSize    number of input samples to process per call.   
  * @return none.   
  *    
@@ -80,218 +80,121 @@ void riscv_fir_sparse_q7(
   q31_t * pScratchOut,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fir_sparse_q7);
+  uint32_t scratchMark = riscv_dsp_scratch_mark(); /* scratch pool depth on entry */
+
+  /* Scratch buffers from the scratch pool when the caller passes none */
+  if(pScratchOut == NULL)
+  {
+    pScratchOut = (q31_t *) riscv_dsp_scratch_push(blockSize * sizeof(q31_t));
+  }
+
+#if defined (USE_DSP_RISCV)
+  if(pScratchOut == NULL)
+  {
+    return;
+  }
+#else
+  if(pScratchIn == NULL)
+  {
+    pScratchIn = (q7_t *) riscv_dsp_scratch_push(blockSize * sizeof(q7_t));
+  }
+
+  if((pScratchIn == NULL) || (pScratchOut == NULL))
+  {
+    riscv_dsp_scratch_pop(scratchMark);
+    return;
+  }
+#endif
 
   q7_t *pState = S->pState;                      /* State pointer */
   q7_t *pCoeffs = S->pCoeffs;                    /* Coefficient pointer */
-  q7_t *px;                                      /* Scratch buffer pointer */
-  q7_t *py = pState;                             /* Temporary pointers for state buffer */
-  q7_t *pb = pScratchIn;                         /* Temporary pointers for scratch buffer */
   q7_t *pOut = pDst;                             /* Destination pointer */
   int32_t *pTapDelay = S->pTapDelay;             /* Pointer to the array containing offset of the non-zero tap values. */
   uint32_t delaySize = S->maxDelay + blockSize;  /* state length */
   uint16_t numTaps = S->numTaps;                 /* Filter order */
-  int32_t readIndex;                             /* Read index of the state buffer */
-  uint32_t tapCnt, blkCnt;                       /* loop counters */
-  q7_t coeff = *pCoeffs++;                       /* Read the coefficient value */
+  uint32_t blkCnt;                               /* loop counters */
   q31_t *pScr2 = pScratchOut;                    /* Working pointer for scratch buffer of output values */
-  q31_t in;
-
-
 
 #if defined (USE_DSP_RISCV)
 
   q7_t in1, in2, in3, in4;
+  q7_t *px0, *px1, *px2, *px3;                   /* Delayed samples of a group of four taps */
+  int32_t readIndex[4];                          /* Read indices of the four taps */
+  q7_t coeff[4];                                 /* Coefficients of the four taps */
+  charV VectInC;                                 /* Packed coefficients of the four taps */
+  uint32_t tap, k, j, n, run;                    /* Loop counters */
 
   /* BlockSize of Input samples are copied into the state buffer */
   /* StateIndex points to the starting position to write in the state buffer */
-  riscv_circularWrite_q7(py, (int32_t) delaySize, &S->stateIndex, 1, pSrc, 1,
+  riscv_circularWrite_q7(pState, (int32_t) delaySize, &S->stateIndex, 1, pSrc, 1,
                        blockSize);
 
-  /* Loop over the number of taps. */
-  tapCnt = numTaps;
-
-  /* Read Index, from where the state buffer should be read, is calculated. */
-  readIndex = ((int32_t) S->stateIndex - (int32_t) blockSize) - *pTapDelay++;
-
-  /* Wraparound of readIndex */
-  if(readIndex < 0)
-  {
-    readIndex += (int32_t) delaySize;
-  }
-
-  /* Working pointer for state buffer is updated */
-  py = pState;
-
-  /* blockSize samples are read from the state buffer */
-  riscv_circularRead_q7(py, (int32_t) delaySize, &readIndex, 1, pb, pb,
-                      (int32_t) blockSize, 1, blockSize);
-
-  /* Working pointer for the scratch buffer of state values */
-  px = pb;
-
-  /* Working pointer for scratch buffer of output values */
-  pScratchOut = pScr2;
-
-  /* Loop over the blockSize. Unroll by a factor of 4.    
-   * Compute 4 multiplications at a time. */
-  blkCnt = blockSize >> 2;
-
-  while(blkCnt > 0u)
-  {
-    /* Perform multiplication and store in the scratch buffer */
-    *pScratchOut++ = ((q31_t) * px++ * coeff);
-    *pScratchOut++ = ((q31_t) * px++ * coeff);
-    *pScratchOut++ = ((q31_t) * px++ * coeff);
-    *pScratchOut++ = ((q31_t) * px++ * coeff);
-
-    /* Decrement the loop counter */
-    blkCnt--;
-  }
-
-  /* If the blockSize is not a multiple of 4,    
-   * compute the remaining samples */
-  blkCnt = blockSize % 0x4u;
-
-  while(blkCnt > 0u)
+  /* The taps are processed in groups of four: the delayed samples of the four taps are read directly
+   * from the state buffer, packed and multiplied with the packed coefficients with one sumdotpv4.
+   * pScratchIn is not used. */
+  for (tap = 0u; tap < numTaps; tap += 4u)
   {
-    /* Perform multiplication and store in the scratch buffer */
-    *pScratchOut++ = ((q31_t) * px++ * coeff);
-
-    /* Decrement the loop counter */
-    blkCnt--;
-  }
-
-  /* Load the coefficient value and    
-   * increment the coefficient buffer for the next set of state values */
-  coeff = *pCoeffs++;
-
-  /* Read Index, from where the state buffer should be read, is calculated. */
-  readIndex = ((int32_t) S->stateIndex - (int32_t) blockSize) - *pTapDelay++;
-
-  /* Wraparound of readIndex */
-  if(readIndex < 0)
-  {
-    readIndex += (int32_t) delaySize;
-  }
-
-  /* Loop over the number of taps. */
-  tapCnt = (uint32_t) numTaps - 2u;
-
-  while(tapCnt > 0u)
-  {
-    /* Working pointer for state buffer is updated */
-    py = pState;
-
-    /* blockSize samples are read from the state buffer */
-    riscv_circularRead_q7(py, (int32_t) delaySize, &readIndex, 1, pb, pb,
-                        (int32_t) blockSize, 1, blockSize);
-
-    /* Working pointer for the scratch buffer of state values */
-    px = pb;
-
-    /* Working pointer for scratch buffer of output values */
-    pScratchOut = pScr2;
-
-    /* Loop over the blockSize. Unroll by a factor of 4.    
-     * Compute 4 MACS at a time. */
-    blkCnt = blockSize >> 2;
-
-    while(blkCnt > 0u)
+    /* Missing taps of the last group read the samples of the first tap with a zero coefficient */
+    for (k = 0u; k < 4u; k++)
     {
-      /* Perform Multiply-Accumulate */
-      in = *pScratchOut + ((q31_t) * px++ * coeff);
-      *pScratchOut++ = in;
-      in = *pScratchOut + ((q31_t) * px++ * coeff);
-      *pScratchOut++ = in;
-      in = *pScratchOut + ((q31_t) * px++ * coeff);
-      *pScratchOut++ = in;
-      in = *pScratchOut + ((q31_t) * px++ * coeff);
-      *pScratchOut++ = in;
-
-      /* Decrement the loop counter */
-      blkCnt--;
-    }
+      j = ((tap + k) < numTaps) ? (tap + k) : tap;
+      coeff[k] = ((tap + k) < numTaps) ? pCoeffs[j] : 0;
 
-    /* If the blockSize is not a multiple of 4,    
-     * compute the remaining samples */
-    blkCnt = blockSize % 0x4u;
+      /* Read Index, from where the state buffer should be read, is calculated. */
+      readIndex[k] = ((int32_t) S->stateIndex - (int32_t) blockSize) - pTapDelay[j];
 
-    while(blkCnt > 0u)
-    {
-      /* Perform Multiply-Accumulate */
-      in = *pScratchOut + ((q31_t) * px++ * coeff);
-      *pScratchOut++ = in;
-
-      /* Decrement the loop counter */
-      blkCnt--;
+      /* Wraparound of readIndex */
+      if(readIndex[k] < 0)
+      {
+        readIndex[k] += (int32_t) delaySize;
+      }
     }
 
-    /* Load the coefficient value and    
-     * increment the coefficient buffer for the next set of state values */
-    coeff = *pCoeffs++;
-
-    /* Read Index, from where the state buffer should be read, is calculated. */
-    readIndex = ((int32_t) S->stateIndex -
-                 (int32_t) blockSize) - *pTapDelay++;
+    VectInC = pack4(coeff[0], coeff[1], coeff[2], coeff[3]);
 
-    /* Wraparound of readIndex */
-    if(readIndex < 0)
+    for (j = 0u; j < blockSize; j += run)
     {
-      readIndex += (int32_t) delaySize;
+      /* Longest run of outputs before one of the four reads wraps around */
+      run = blockSize - j;
+      for (k = 0u; k < 4u; k++)
+      {
+        if((delaySize - (uint32_t) readIndex[k]) < run)
+        {
+          run = delaySize - (uint32_t) readIndex[k];
+        }
+      }
+
+      px0 = pState + readIndex[0];
+      px1 = pState + readIndex[1];
+      px2 = pState + readIndex[2];
+      px3 = pState + readIndex[3];
+
+      if(tap == 0u)
+      {
+        for (n = 0u; n < run; n++)
+        {
+          pScratchOut[j + n] = dotpv4(pack4(px0[n], px1[n], px2[n], px3[n]), VectInC);
+        }
+      }
+      else
+      {
+        for (n = 0u; n < run; n++)
+        {
+          pScratchOut[j + n] = sumdotpv4(pack4(px0[n], px1[n], px2[n], px3[n]), VectInC, pScratchOut[j + n]);
+        }
+      }
+
+      for (k = 0u; k < 4u; k++)
+      {
+        readIndex[k] += (int32_t) run;
+        if(readIndex[k] == (int32_t) delaySize)
+        {
+          readIndex[k] = 0;
+        }
+      }
     }
-
-    /* Decrement the tap loop counter */
-    tapCnt--;
   }
-	
-	/* Compute last tap without the final read of pTapDelay */	
-	
-	/* Working pointer for state buffer is updated */
-	py = pState;
-
-	/* blockSize samples are read from the state buffer */
-	riscv_circularRead_q7(py, (int32_t) delaySize, &readIndex, 1, pb, pb,
-											(int32_t) blockSize, 1, blockSize);
-
-	/* Working pointer for the scratch buffer of state values */
-	px = pb;
-
-	/* Working pointer for scratch buffer of output values */
-	pScratchOut = pScr2;
-
-	/* Loop over the blockSize. Unroll by a factor of 4.    
-	 * Compute 4 MACS at a time. */
-	blkCnt = blockSize >> 2;
-
-	while(blkCnt > 0u)
-	{
-		/* Perform Multiply-Accumulate */
-		in = *pScratchOut + ((q31_t) * px++ * coeff);
-		*pScratchOut++ = in;
-		in = *pScratchOut + ((q31_t) * px++ * coeff);
-		*pScratchOut++ = in;
-		in = *pScratchOut + ((q31_t) * px++ * coeff);
-		*pScratchOut++ = in;
-		in = *pScratchOut + ((q31_t) * px++ * coeff);
-		*pScratchOut++ = in;
-
-		/* Decrement the loop counter */
-		blkCnt--;
-	}
-
-	/* If the blockSize is not a multiple of 4,    
-	 * compute the remaining samples */
-	blkCnt = blockSize % 0x4u;
-
-	while(blkCnt > 0u)
-	{
-		/* Perform Multiply-Accumulate */
-		in = *pScratchOut + ((q31_t) * px++ * coeff);
-		*pScratchOut++ = in;
-
-		/* Decrement the loop counter */
-		blkCnt--;
-	}
 
   /* All the output values are in pScratchOut buffer.    
      Convert them into 1.15 format, saturate and store in the destination buffer. */
@@ -325,6 +228,14 @@ void riscv_fir_sparse_q7(
 
 #else
 
+  q7_t *px;                                      /* Scratch buffer pointer */
+  q7_t *py = pState;                             /* Temporary pointers for state buffer */
+  q7_t *pb = pScratchIn;                         /* Temporary pointers for scratch buffer */
+  int32_t readIndex;                             /* Read index of the state buffer */
+  uint32_t tapCnt;                               /* loop counters */
+  q7_t coeff = *pCoeffs++;                       /* Read the coefficient value */
+  q31_t in;
+
 
   /* BlockSize of Input samples are copied into the state buffer */
   /* StateIndex points to the starting position to write in the state buffer */
@@ -471,6 +382,8 @@ void riscv_fir_sparse_q7(
     blkCnt--;
   }
 #endif
+
+  riscv_dsp_scratch_pop(scratchMark);
 }
 
 /**    
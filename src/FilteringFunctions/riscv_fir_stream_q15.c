@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_stream_q15.c
+*
+* Description:  Q15 FIR filter streamed from L2 through tiles in L1.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/*
+* @brief  Filters one tile.
+*/
+
+static void riscv_fir_stream_q15_tile(
+  void * arg,
+  void * pIn,
+  void * pOut,
+  uint32_t blockSize)
+{
+  riscv_fir_q15((const riscv_fir_instance_q15 *) arg, (q15_t *) pIn, (q15_t *) pOut, blockSize);
+}
+
+/**
+ * @brief Q15 FIR filter streamed from L2 through tiles in L1.
+ * @param[in]  *D         points to the DMA hook.
+ * @param[in]  *S         points to an instance of the Q15 FIR filter structure, initialized with <code>blockSize = tileSize</code>.
+ * @param[in]  *pSrc      points to the input samples in L2.
+ * @param[out] *pDst      points to the output samples in L2, may be <code>pSrc</code>.
+ * @param[in]  length     number of samples to process.
+ * @param[in]  tileSize   number of samples processed per call of riscv_fir_q15().
+ * @param[in]  *pL1       points to a buffer of <code>4*tileSize</code> samples in L1.
+ * @return none.
+ *
+ * \par
+ * The function calls riscv_fir_q15() on tiles of <code>tileSize</code> samples that riscv_stream_process()
+ * moves between L2 and <code>pL1</code>.
+ * <code>S</code>, its state of numTaps+tileSize-1 samples and coefficients, should be in L1 as well.
+ * The output equals the one of riscv_fir_q15() on the whole vector.
+ * <code>tileSize</code> should be even and <code>pL1</code> 4-byte aligned in the USE_DSP_RISCV build.
+ */
+
+void riscv_fir_stream_q15(
+  const riscv_dma_instance * D,
+  const riscv_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t length,
+  uint32_t tileSize,
+  q15_t * pL1)
+{
+  RISCV_PROFILE(riscv_fir_stream_q15);
+  riscv_stream_process(D, riscv_fir_stream_q15_tile, (void *) S, pSrc, pDst, length, sizeof(q15_t), tileSize, pL1);
+}
+
+/**
+ * @} end of FIR group
+ */
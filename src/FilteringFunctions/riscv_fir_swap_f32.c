@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_swap_f32.c
+*
+* Description:  Floating-point FIR filter that takes over published
+*               coefficient banks.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CoeffSwap
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point FIR filter with coefficient swap.
+ * @param[in,out] *S          points to an instance of the floating-point FIR structure.
+ * @param[in,out] *pSwap      points to the coefficient swap instance of the filter.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[out]    *pDst       points to the block of output data.
+ * @param[in]     blockSize   number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The fade state buffer of <code>pSwap</code> is of length <code>numTaps+blockSize-1</code>.
+ */
+
+void riscv_fir_swap_f32(
+  riscv_fir_instance_f32 * S,
+  riscv_coeff_swap_instance * pSwap,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_swap_f32);
+  riscv_fir_instance_f32 fade;                   /* Outgoing filter of the crossfade */
+  float32_t *pOld = (float32_t *) pSwap->pFadeOut; /* Outputs of the outgoing filter */
+  float32_t gain, step;                          /* Crossfade gain of the incoming filter */
+  uint32_t n, fadeCnt;                           /* Loop counters */
+
+  /* One branch per block while no swap is pending and no crossfade runs */
+  if((pSwap->pending | pSwap->fadeCount) == 0u)
+  {
+    riscv_fir_f32(S, pSrc, pDst, blockSize);
+    return;
+  }
+
+  if(pSwap->pending != 0u)
+  {
+    S->pCoeffs = (float32_t *) riscv_coeff_swap_take(pSwap);
+
+    /* The outgoing filter starts from the input history of the filter */
+    if(pSwap->fadeCount != 0u)
+    {
+      riscv_copy_f32(S->pState, (float32_t *) pSwap->pFadeState, S->numTaps - 1u);
+    }
+  }
+
+  if(pSwap->fadeCount != 0u)
+  {
+    fade = *S;
+    fade.pCoeffs = (float32_t *) pSwap->pBank[pSwap->active ^ 1u];
+    fade.pState = (float32_t *) pSwap->pFadeState;
+    riscv_fir_f32(&fade, pSrc, pOld, blockSize);
+  }
+
+  riscv_fir_f32(S, pSrc, pDst, blockSize);
+
+  if(pSwap->fadeCount == 0u)
+  {
+    return;
+  }
+
+  /* Linear crossfade from the outgoing to the incoming outputs */
+  fadeCnt = (pSwap->fadeCount < blockSize) ? pSwap->fadeCount : blockSize;
+  step = 1.0f / (float32_t) pSwap->fadeLength;
+  gain = (float32_t) (pSwap->fadeLength - pSwap->fadeCount) * step;
+
+  for (n = 0u; n < fadeCnt; n++)
+  {
+    gain += step;
+    pDst[n] = pOld[n] + ((pDst[n] - pOld[n]) * gain);
+  }
+
+  pSwap->fadeCount -= (uint16_t) fadeCnt;
+}
+
+/**
+ * @} end of CoeffSwap group
+ */
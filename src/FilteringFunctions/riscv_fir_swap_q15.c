@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_swap_q15.c
+*
+* Description:  Q15 FIR filter that takes over published coefficient
+*               banks.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CoeffSwap
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 FIR filter with coefficient swap.
+ * @param[in,out] *S          points to an instance of the Q15 FIR structure.
+ * @param[in,out] *pSwap      points to the coefficient swap instance of the filter.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[out]    *pDst       points to the block of output data.
+ * @param[in]     blockSize   number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The fade state buffer of <code>pSwap</code> is of length <code>numTaps+blockSize</code>.  The crossfade
+ * gain is computed in Q15 for every sample, the blend of the two outputs cannot overflow.
+ */
+
+void riscv_fir_swap_q15(
+  riscv_fir_instance_q15 * S,
+  riscv_coeff_swap_instance * pSwap,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_swap_q15);
+  riscv_fir_instance_q15 fade;                   /* Outgoing filter of the crossfade */
+  q15_t *pOld = (q15_t *) pSwap->pFadeOut;       /* Outputs of the outgoing filter */
+  uint32_t done;                                 /* Samples of the crossfade done before the block */
+  uint32_t n, fadeCnt;                           /* Loop counters */
+  q31_t gain;                                    /* Crossfade gain of the incoming filter, 0 to 32768 */
+
+  /* One branch per block while no swap is pending and no crossfade runs */
+  if((pSwap->pending | pSwap->fadeCount) == 0u)
+  {
+    riscv_fir_q15(S, pSrc, pDst, blockSize);
+    return;
+  }
+
+  if(pSwap->pending != 0u)
+  {
+    S->pCoeffs = (q15_t *) riscv_coeff_swap_take(pSwap);
+
+    /* The outgoing filter starts from the input history of the filter */
+    if(pSwap->fadeCount != 0u)
+    {
+      riscv_copy_q15(S->pState, (q15_t *) pSwap->pFadeState, S->numTaps - 1u);
+    }
+  }
+
+  if(pSwap->fadeCount != 0u)
+  {
+    fade = *S;
+    fade.pCoeffs = (q15_t *) pSwap->pBank[pSwap->active ^ 1u];
+    fade.pState = (q15_t *) pSwap->pFadeState;
+    riscv_fir_q15(&fade, pSrc, pOld, blockSize);
+  }
+
+  riscv_fir_q15(S, pSrc, pDst, blockSize);
+
+  if(pSwap->fadeCount == 0u)
+  {
+    return;
+  }
+
+  /* Linear crossfade from the outgoing to the incoming outputs */
+  fadeCnt = (pSwap->fadeCount < blockSize) ? pSwap->fadeCount : blockSize;
+  done = (uint32_t) pSwap->fadeLength - pSwap->fadeCount;
+
+  for (n = 0u; n < fadeCnt; n++)
+  {
+    gain = (q31_t) (((done + n + 1u) << 15) / pSwap->fadeLength);
+    pDst[n] = (q15_t) (pOld[n] + ((((q31_t) pDst[n] - pOld[n]) * gain) >> 15));
+  }
+
+  pSwap->fadeCount -= (uint16_t) fadeCnt;
+}
+
+/**
+ * @} end of CoeffSwap group
+ */
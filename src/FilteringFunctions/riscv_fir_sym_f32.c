@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_sym_f32.c
+*
+* Description:  Floating-point symmetric FIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_sym Symmetric FIR Filters
+ *
+ * Linear-phase FIR filters with symmetric taps, <code>b[k] = b[numTaps-1-k]</code>.  The two
+ * samples that meet the same tap are added first and multiplied once,
+ * <pre>
+ *    y[n] = b[0] * (x[n] + x[n-numTaps+1]) + b[1] * (x[n-1] + x[n-numTaps+2]) + ...
+ * </pre>
+ * which halves the multiplications of riscv_fir_f32() and the coefficient memory.
+ * <code>pCoeffs</code> holds the first <code>(numTaps+1)/2</code> taps, including the center tap
+ * of an odd length.  The state buffer is that of riscv_fir_f32(), <code>numTaps+blockSize-1</code>
+ * samples, and the outputs are those of riscv_fir_X() with the full set of taps.  The Q15 and Q31
+ * outputs are bit-exact with riscv_fir_q15() and riscv_fir_q31(), the floating-point ones differ
+ * by the rounding of the pair sums.
+ * \par
+ * The xpulp path of the Q15 filter computes two outputs per pass.  It does not add the samples
+ * in the 16-bit lanes, where the sums would overflow and the samples of the second half have to
+ * be swapped first, but multiplies a coefficient pair with the samples of the first half and the
+ * swapped pair with those of the second half, two <code>pv.dotsp.h</code> for four taps.  Each pair
+ * is loaded once for both outputs.
+ */
+
+/**
+ * @addtogroup FIR_sym
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point symmetric FIR filter.
+ * @param[in]     *S          points to an instance of the floating-point symmetric FIR structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of output samples.
+ * @param[in]     blockSize   number of samples to process.
+ */
+
+void riscv_fir_sym_f32(
+  const riscv_fir_sym_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_sym_f32);
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pe;                            /* First and last sample of the window */
+  float32_t acc;                                 /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps */
+  uint32_t numPairs = numTaps >> 1u;             /* Symmetric pairs of taps */
+  uint32_t k, blkCnt;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - 1u);
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy one sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0.0f;
+
+    /* The samples of a symmetric pair share their multiplication */
+    px = pState;
+    pe = pState + (numTaps - 1u);
+    for (k = 0u; k < numPairs; k++)
+    {
+      acc += pCoeffs[k] * (*px + *pe);
+      px++;
+      pe--;
+    }
+
+    /* Center tap of an odd length */
+    if((numTaps & 1u) != 0u)
+    {
+      acc += pCoeffs[numPairs] * *px;
+    }
+
+    *pDst++ = acc;
+
+    /* Advance the state pointer by one sample */
+    pState = pState + 1u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  k = numTaps - 1u;
+
+  while(k > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    k--;
+  }
+}
+
+/**
+ * @} end of FIR_sym group
+ */
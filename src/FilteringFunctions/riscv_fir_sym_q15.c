@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_sym_q15.c
+*
+* Description:  Q15 symmetric FIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_sym
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 symmetric FIR filter.
+ * @param[in]     *S          points to an instance of the Q15 symmetric FIR structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of output samples.
+ * @param[in]     blockSize   number of samples to process.
+ * \par
+ * The products are accumulated in 64 bits and the output is truncated to 1.15 and saturated,
+ * as in riscv_fir_q15().
+ */
+
+void riscv_fir_sym_q15(
+  const riscv_fir_sym_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_sym_q15);
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pe;                                /* First and last sample of the window */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps */
+  uint32_t numPairs = numTaps >> 1u;             /* Symmetric pairs of taps */
+  uint32_t k, blkCnt;                            /* Loop counters */
+#if defined (USE_DSP_RISCV)
+  shortV swap = { 1, 0 };                        /* Taps of the second half */
+  shortV c, cs;
+  q63_t acc1;
+#endif
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - 1u);
+
+#if defined (USE_DSP_RISCV)
+
+  /* Two outputs per pass, the windows start at px and at px + 1 */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy 2 new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0;
+    acc1 = 0;
+
+    px = pState;
+    pe = pState + (numTaps - 1u);
+
+    /* Taps k and k+1 with (px[k], px[k+1]), taps k+1 and k with (pe[-k-1], pe[-k]) */
+    for (k = 0u; (k + 1u) < numPairs; k += 2u)
+    {
+      c = *(shortV *) (pCoeffs + k);
+      cs = shufflev4(c, c, swap);
+      acc += dotpv2(*(shortV *) (px + k), c);
+      acc1 += dotpv2(*(shortV *) (px + k + 1), c);
+      acc += dotpv2(*(shortV *) (pe - k - 1), cs);
+      acc1 += dotpv2(*(shortV *) (pe - k), cs);
+    }
+
+    /* Last pair of an odd number of pairs */
+    if(k < numPairs)
+    {
+      acc += (q63_t) pCoeffs[k] * ((q31_t) px[k] + pe[-(int32_t) k]);
+      acc1 += (q63_t) pCoeffs[k] * ((q31_t) px[k + 1u] + pe[1 - (int32_t) k]);
+    }
+
+    /* Center tap of an odd length */
+    if((numTaps & 1u) != 0u)
+    {
+      acc += (q31_t) pCoeffs[numPairs] * px[numPairs];
+      acc1 += (q31_t) pCoeffs[numPairs] * px[numPairs + 1u];
+    }
+
+    *pDst++ = (q15_t) (__SSAT((acc >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((acc1 >> 15), 16));
+
+    /* Advance the state pointer by two samples */
+    pState = pState + 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Remaining output of an odd block size */
+  blkCnt = blockSize & 1u;
+
+#else
+
+  blkCnt = blockSize;
+
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* Copy one sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0;
+
+    /* The samples of a symmetric pair share their multiplication */
+    px = pState;
+    pe = pState + (numTaps - 1u);
+    for (k = 0u; k < numPairs; k++)
+    {
+      acc += (q63_t) pCoeffs[k] * ((q31_t) *px + *pe);
+      px++;
+      pe--;
+    }
+
+    /* Center tap of an odd length */
+    if((numTaps & 1u) != 0u)
+    {
+      acc += (q31_t) pCoeffs[numPairs] * *px;
+    }
+
+    *pDst++ = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Advance the state pointer by one sample */
+    pState = pState + 1u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  k = numTaps - 1u;
+
+  while(k > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    k--;
+  }
+}
+
+/**
+ * @} end of FIR_sym group
+ */
@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_sym_q31.c
+*
+* Description:  Q31 symmetric FIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_sym
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 symmetric FIR filter.
+ * @param[in]     *S          points to an instance of the Q31 symmetric FIR structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of output samples.
+ * @param[in]     blockSize   number of samples to process.
+ * \par
+ * The products are accumulated in 64 bits and the output is truncated to 1.31, as in
+ * riscv_fir_q31().  Like there the accumulator can overflow for full scale samples and taps
+ * close to -1.0.
+ */
+
+void riscv_fir_sym_q31(
+  const riscv_fir_sym_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_fir_sym_q31);
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t *px, *pe;                                /* First and last sample of the window */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps */
+  uint32_t numPairs = numTaps >> 1u;             /* Symmetric pairs of taps */
+  uint32_t k, blkCnt;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - 1u);
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy one sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0;
+
+    /* The samples of a symmetric pair share their multiplication */
+    px = pState;
+    pe = pState + (numTaps - 1u);
+    for (k = 0u; k < numPairs; k++)
+    {
+      acc += ((q63_t) *px + *pe) * pCoeffs[k];
+      px++;
+      pe--;
+    }
+
+    /* Center tap of an odd length */
+    if((numTaps & 1u) != 0u)
+    {
+      acc += (q63_t) pCoeffs[numPairs] * *px;
+    }
+
+    *pDst++ = (q31_t) (acc >> 31);
+
+    /* Advance the state pointer by one sample */
+    pState = pState + 1u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  k = numTaps - 1u;
+
+  while(k > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    k--;
+  }
+}
+
+/**
+ * @} end of FIR_sym group
+ */
@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_hilbert_design_f32.c
+*
+* Description:  Windowed design of the FIR Hilbert transformer taps.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Hilbert
+ * @{
+ */
+
+/**
+* @brief  Windowed design of a FIR Hilbert transformer.
+* @param[in]  numTaps   length of the filter, <code>4*K-1</code>.
+* @param[out] *pCoeffs  points to the <code>(numTaps+1)/4</code> taps of the first half that are not zero.
+* @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>numTaps</code> is not
+* <code>4*K-1</code>.
+*
+* \par
+* The tap at the odd distance <code>m</code> from the center <code>c = (numTaps-1)/2</code> is the
+* ideal <code>2/(pi*m)</code> times a Blackman window of <code>numTaps+2</code> points, whose ends
+* fall just outside the filter so that the outer taps are not zero.  <code>pCoeffs[k]</code> is the
+* tap at <code>m = c-2k</code>, the layout of riscv_hilbert_init_f32().  The cosines come from
+* riscv_cos_f32().
+*/
+
+riscv_status riscv_hilbert_design_f32(
+  uint16_t numTaps,
+  float32_t * pCoeffs)
+{
+  RISCV_PROFILE(riscv_hilbert_design_f32);
+  uint32_t numPairs = ((uint32_t) numTaps + 1u) >> 2u;   /* Taps that are not zero */
+  uint32_t center = ((uint32_t) numTaps - 1u) >> 1u;     /* Offset of the center tap */
+  float32_t m, a, w;
+  uint32_t k;
+
+  if((numTaps & 3u) != 3u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0u; k < numPairs; k++)
+  {
+    m = (float32_t) (center - (2u * k));
+
+    /*  Blackman window centred on the middle tap */
+    a = (PI * m) / (float32_t) (center + 1u);
+    w = 0.42f + (0.5f * riscv_cos_f32(a)) + (0.08f * riscv_cos_f32(2.0f * a));
+
+    pCoeffs[k] = (2.0f * w) / (PI * m);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of Hilbert group
+*/
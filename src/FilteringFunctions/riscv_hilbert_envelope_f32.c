@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_hilbert_envelope_f32.c
+*
+* Description:  Envelope and instantaneous phase of a floating-point signal
+*               through the FIR Hilbert transformer.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Hilbert
+ * @{
+ */
+
+/**
+ * @brief  Envelope and instantaneous phase of a floating-point signal.
+ * @param[in]     *S          points to an instance of the floating-point Hilbert transformer structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pEnv       points to the block of envelope samples <code>|I + jQ|</code>.
+ * @param[out]    *pPhase     points to the block of phases <code>atan2(Q, I)</code> in radians, or NULL.
+ * @param[in]     blockSize   number of samples to process.
+ * \par
+ * The outputs are those of riscv_hilbert_f32() passed through riscv_sqrt_f32() and
+ * riscv_atan2_f32(), delayed like <code>I</code> by <code>(numTaps-1)/2</code> samples.  The phase of
+ * a zero sample is 0.
+ */
+
+void riscv_hilbert_envelope_f32(
+  const riscv_hilbert_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pEnv,
+  float32_t * pPhase,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_hilbert_envelope_f32);
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pe;                            /* First and last sample of the window */
+  float32_t acc, in;                             /* Q and I of the analytic signal */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps */
+  uint32_t numPairs = (numTaps + 1u) >> 2u;      /* Antisymmetric pairs of taps that are not zero */
+  uint32_t center = (numTaps - 1u) >> 1u;        /* Offset of the center tap */
+  uint32_t k, blkCnt;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - 1u);
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy one sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0.0f;
+
+    px = pState;
+    pe = pState + (numTaps - 1u);
+    for (k = 0u; k < numPairs; k++)
+    {
+      acc += pCoeffs[k] * (*px - *pe);
+      px += 2;
+      pe -= 2;
+    }
+
+    in = pState[center];
+
+    /* Magnitude and angle of I + jQ */
+    (void) riscv_sqrt_f32((in * in) + (acc * acc), pEnv++);
+
+    if(pPhase != NULL)
+    {
+      (void) riscv_atan2_f32(acc, in, pPhase++);
+    }
+
+    /* Advance the state pointer by one sample */
+    pState = pState + 1u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  k = numTaps - 1u;
+
+  while(k > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    k--;
+  }
+}
+
+/**
+ * @} end of Hilbert group
+ */
@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_hilbert_envelope_q15.c
+*
+* Description:  Envelope and instantaneous phase of a Q15 signal through
+*               the FIR Hilbert transformer.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Hilbert
+ * @{
+ */
+
+/**
+ * @brief  Envelope and instantaneous phase of a Q15 signal.
+ * @param[in]     *S          points to an instance of the Q15 Hilbert transformer structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pEnv       points to the block of envelope samples <code>|I + jQ|</code> in 2.14 format.
+ * @param[out]    *pPhase     points to the block of phases <code>atan2(Q, I)</code> in radians in 2.13 format, or NULL.
+ * @param[in]     blockSize   number of samples to process.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * <code>Q</code> is computed as in riscv_hilbert_q15(), truncated to 1.15 and saturated.  The
+ * envelope is that of riscv_cmplx_mag_q15() for <code>I + jQ</code>, in 2.14 format, and the phase
+ * that of riscv_atan2_q15(), 0 for a zero sample.  Both are delayed like <code>I</code> by
+ * <code>(numTaps-1)/2</code> samples.
+ */
+
+void riscv_hilbert_envelope_q15(
+  const riscv_hilbert_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pEnv,
+  q15_t * pPhase,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_hilbert_envelope_q15);
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pe;                                /* First and last sample of the window */
+  q63_t acc;                                     /* Accumulator */
+  q15_t in, quad;                                /* I and Q of the analytic signal */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps */
+  uint32_t numPairs = (numTaps + 1u) >> 2u;      /* Antisymmetric pairs of taps that are not zero */
+  uint32_t center = (numTaps - 1u) >> 1u;        /* Offset of the center tap */
+  uint32_t k, blkCnt;                            /* Loop counters */
+#if defined (USE_DSP_RISCV)
+  shortV even = { 0, 2 };                        /* Even samples of two pairs */
+  shortV odd = { 1, 3 };                         /* Odd samples of two pairs */
+  shortV swap = { 1, 0 };                        /* Taps of the second half */
+  shortV x0, x1, y0, y1, c, cs, v;
+  q63_t acc1;
+  q15_t quad1;
+#endif
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - 1u);
+
+#if defined (USE_DSP_RISCV)
+
+  /* Two outputs per pass, the windows start at px and at px + 1 */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy 2 new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0;
+    acc1 = 0;
+
+    px = pState;
+    pe = pState + (numTaps - 1u);
+
+    for (k = 0u; (k + 1u) < numPairs; k += 2u)
+    {
+      c = *(shortV *) (pCoeffs + k);
+      cs = shufflev4(c, c, swap);
+
+      x0 = *(shortV *) (px + (2u * k));
+      x1 = *(shortV *) (px + (2u * k) + 2u);
+      acc += dotpv2(shufflev4(x0, x1, even), c);
+      acc1 += dotpv2(shufflev4(x0, x1, odd), c);
+
+      y0 = *(shortV *) (pe - (2u * k) - 2u);
+      y1 = *(shortV *) (pe - (2u * k));
+      acc -= dotpv2(shufflev4(y0, y1, even), cs);
+      acc1 -= dotpv2(shufflev4(y0, y1, odd), cs);
+    }
+
+    /* Last pair of an odd number of pairs */
+    if(k < numPairs)
+    {
+      acc += (q63_t) pCoeffs[k] * ((q31_t) px[2u * k] - pe[-(int32_t) (2u * k)]);
+      acc1 += (q63_t) pCoeffs[k] * ((q31_t) px[(2u * k) + 1u] - pe[1 - (int32_t) (2u * k)]);
+    }
+
+    quad = (q15_t) (__SSAT((acc >> 15), 16));
+    quad1 = (q15_t) (__SSAT((acc1 >> 15), 16));
+
+    /* Magnitudes of the two samples, I*I + Q*Q with one pv.dotsp.h each */
+    v = pack2(px[center], quad);
+    riscv_sqrt_q15((q15_t) (((q63_t) dotpv2(v, v)) >> 17), pEnv++);
+    v = pack2(px[center + 1u], quad1);
+    riscv_sqrt_q15((q15_t) (((q63_t) dotpv2(v, v)) >> 17), pEnv++);
+
+    if(pPhase != NULL)
+    {
+      (void) riscv_atan2_q15(quad, px[center], pPhase++);
+      (void) riscv_atan2_q15(quad1, px[center + 1u], pPhase++);
+    }
+
+    /* Advance the state pointer by two samples */
+    pState = pState + 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Remaining output of an odd block size */
+  blkCnt = blockSize & 1u;
+
+#else
+
+  blkCnt = blockSize;
+
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* Copy one sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0;
+
+    px = pState;
+    pe = pState + (numTaps - 1u);
+    for (k = 0u; k < numPairs; k++)
+    {
+      acc += (q63_t) pCoeffs[k] * ((q31_t) *px - *pe);
+      px += 2;
+      pe -= 2;
+    }
+
+    quad = (q15_t) (__SSAT((acc >> 15), 16));
+    in = pState[center];
+
+    /* Magnitude in 2.14 format and angle of I + jQ */
+    riscv_sqrt_q15((q15_t) ((((q63_t) in * in) + ((q31_t) quad * quad)) >> 17), pEnv++);
+
+    if(pPhase != NULL)
+    {
+      (void) riscv_atan2_q15(quad, in, pPhase++);
+    }
+
+    /* Advance the state pointer by one sample */
+    pState = pState + 1u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  k = numTaps - 1u;
+
+  while(k > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    k--;
+  }
+}
+
+/**
+ * @} end of Hilbert group
+ */
@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_hilbert_f32.c
+*
+* Description:  Floating-point FIR Hilbert transformer.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Hilbert Hilbert Transformer
+ *
+ * FIR Hilbert transformers and the analytic signal <code>I + jQ</code> of a real input, for the
+ * envelope and the instantaneous phase of a signal without the forward real FFT, the zeroed
+ * negative bins, the inverse complex FFT and the complex magnitude of the FFT method.
+ * \par
+ * The ideal Hilbert transformer has the taps <code>2/(pi*m)</code> at the odd distances
+ * <code>m</code> from the center and 0 at the even ones, and it is antisymmetric.  A filter of
+ * <code>numTaps = 4*K-1</code> taps, with the center <code>c = (numTaps-1)/2</code>, has
+ * <code>K = (numTaps+1)/4</code> different taps that are not zero, and each of them meets the
+ * difference of two samples,
+ * <pre>
+ *    Q[n] = g[0] * (x[n-2c] - x[n]) + g[1] * (x[n-2c+2] - x[n-2]) + ... + g[K-1] * (x[n-c-1] - x[n-c+1])
+ *    I[n] = x[n-c]
+ * </pre>
+ * which is <code>K</code> multiplications per output instead of the <code>numTaps</code> of
+ * riscv_fir_f32().  <code>pCoeffs</code> holds <code>g</code>, the taps 0, 2, 4, ... of the first
+ * half in the order of riscv_fir_init_f32(); the outputs <code>Q</code> are those of riscv_fir_X()
+ * with the full set of taps.  <code>I</code> is the input delayed by <code>c</code> samples, the
+ * group delay of the filter, so that <code>I</code> and <code>Q</code> are in phase.  The state
+ * buffer is that of riscv_fir_f32(), <code>numTaps+blockSize-1</code> samples.
+ * \par
+ * riscv_hilbert_design_f32() computes <code>g</code>; the Q15 taps are converted from them with
+ * riscv_float_to_q15().  The passband is that of the window, about <code>4/numTaps</code> of the
+ * sample rate away from DC and Nyquist.
+ * \par
+ * riscv_hilbert_envelope_f32() and riscv_hilbert_envelope_q15() run the filter and turn each
+ * <code>I + jQ</code> into its magnitude and, optionally, its angle in one pass, so the analytic
+ * signal is never stored.
+ * \par
+ * The xpulp path of the Q15 filter computes two outputs per pass.  The first output uses the
+ * samples of even offsets in the window and the second those of odd offsets, so each pair of
+ * samples is loaded once and split into both with <code>pv.shuffle2.h</code> before two
+ * <code>pv.dotsp.h</code>.
+ */
+
+/**
+ * @addtogroup Hilbert
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point FIR Hilbert transformer.
+ * @param[in]     *S          points to an instance of the floating-point Hilbert transformer structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of outputs <code>Q</code>.
+ * @param[out]    *pReal      points to the block of outputs <code>I</code>, the delayed input, or NULL.
+ * @param[in]     blockSize   number of samples to process.
+ */
+
+void riscv_hilbert_f32(
+  const riscv_hilbert_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pReal,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_hilbert_f32);
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pe;                            /* First and last sample of the window */
+  float32_t acc;                                 /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps */
+  uint32_t numPairs = (numTaps + 1u) >> 2u;      /* Antisymmetric pairs of taps that are not zero */
+  uint32_t center = (numTaps - 1u) >> 1u;        /* Offset of the center tap */
+  uint32_t k, blkCnt;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - 1u);
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy one sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0.0f;
+
+    /* The samples of an antisymmetric pair share their multiplication, the zero taps are skipped */
+    px = pState;
+    pe = pState + (numTaps - 1u);
+    for (k = 0u; k < numPairs; k++)
+    {
+      acc += pCoeffs[k] * (*px - *pe);
+      px += 2;
+      pe -= 2;
+    }
+
+    *pDst++ = acc;
+
+    if(pReal != NULL)
+    {
+      *pReal++ = pState[center];
+    }
+
+    /* Advance the state pointer by one sample */
+    pState = pState + 1u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  k = numTaps - 1u;
+
+  while(k > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    k--;
+  }
+}
+
+/**
+ * @} end of Hilbert group
+ */
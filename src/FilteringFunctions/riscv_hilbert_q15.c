@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_hilbert_q15.c
+*
+* Description:  Q15 FIR Hilbert transformer.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Hilbert
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 FIR Hilbert transformer.
+ * @param[in]     *S          points to an instance of the Q15 Hilbert transformer structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of outputs <code>Q</code>.
+ * @param[out]    *pReal      points to the block of outputs <code>I</code>, the delayed input, or NULL.
+ * @param[in]     blockSize   number of samples to process.
+ * \par
+ * The products are accumulated in 64 bits and the output is truncated to 1.15 and saturated,
+ * as in riscv_fir_q15().  The state buffer should be 4-byte aligned for the xpulp path.
+ */
+
+void riscv_hilbert_q15(
+  const riscv_hilbert_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  q15_t * pReal,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_hilbert_q15);
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pe;                                /* First and last sample of the window */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps */
+  uint32_t numPairs = (numTaps + 1u) >> 2u;      /* Antisymmetric pairs of taps that are not zero */
+  uint32_t center = (numTaps - 1u) >> 1u;        /* Offset of the center tap */
+  uint32_t k, blkCnt;                            /* Loop counters */
+#if defined (USE_DSP_RISCV)
+  shortV even = { 0, 2 };                        /* Even samples of two pairs */
+  shortV odd = { 1, 3 };                         /* Odd samples of two pairs */
+  shortV swap = { 1, 0 };                        /* Taps of the second half */
+  shortV x0, x1, y0, y1, c, cs;
+  q63_t acc1;
+#endif
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - 1u);
+
+#if defined (USE_DSP_RISCV)
+
+  /* Two outputs per pass, the windows start at px and at px + 1 */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy 2 new input samples into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0;
+    acc1 = 0;
+
+    px = pState;
+    pe = pState + (numTaps - 1u);
+
+    for (k = 0u; (k + 1u) < numPairs; k += 2u)
+    {
+      c = *(shortV *) (pCoeffs + k);
+      cs = shufflev4(c, c, swap);
+
+      /* (px[2k], px[2k+2]) for the first output, (px[2k+1], px[2k+3]) for the second */
+      x0 = *(shortV *) (px + (2u * k));
+      x1 = *(shortV *) (px + (2u * k) + 2u);
+      acc += dotpv2(shufflev4(x0, x1, even), c);
+      acc1 += dotpv2(shufflev4(x0, x1, odd), c);
+
+      /* (pe[-2k-2], pe[-2k]) and (pe[-2k-1], pe[-2k+1]) with the taps k+1 and k, subtracted */
+      y0 = *(shortV *) (pe - (2u * k) - 2u);
+      y1 = *(shortV *) (pe - (2u * k));
+      acc -= dotpv2(shufflev4(y0, y1, even), cs);
+      acc1 -= dotpv2(shufflev4(y0, y1, odd), cs);
+    }
+
+    /* Last pair of an odd number of pairs */
+    if(k < numPairs)
+    {
+      acc += (q63_t) pCoeffs[k] * ((q31_t) px[2u * k] - pe[-(int32_t) (2u * k)]);
+      acc1 += (q63_t) pCoeffs[k] * ((q31_t) px[(2u * k) + 1u] - pe[1 - (int32_t) (2u * k)]);
+    }
+
+    *pDst++ = (q15_t) (__SSAT((acc >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((acc1 >> 15), 16));
+
+    if(pReal != NULL)
+    {
+      *pReal++ = px[center];
+      *pReal++ = px[center + 1u];
+    }
+
+    /* Advance the state pointer by two samples */
+    pState = pState + 2u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Remaining output of an odd block size */
+  blkCnt = blockSize & 1u;
+
+#else
+
+  blkCnt = blockSize;
+
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* Copy one sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    acc = 0;
+
+    /* The samples of an antisymmetric pair share their multiplication, the zero taps are skipped */
+    px = pState;
+    pe = pState + (numTaps - 1u);
+    for (k = 0u; k < numPairs; k++)
+    {
+      acc += (q63_t) pCoeffs[k] * ((q31_t) *px - *pe);
+      px += 2;
+      pe -= 2;
+    }
+
+    *pDst++ = (q15_t) (__SSAT((acc >> 15), 16));
+
+    if(pReal != NULL)
+    {
+      *pReal++ = pState[center];
+    }
+
+    /* Advance the state pointer by one sample */
+    pState = pState + 1u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - 1 samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  k = numTaps - 1u;
+
+  while(k > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    k--;
+  }
+}
+
+/**
+ * @} end of Hilbert group
+ */
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_iir_halfband_decimate_f32.c
+*
+* Description:  Floating-point polyphase allpass IIR half-band decimator by 2.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup IIR_halfband IIR Half-Band Decimator and Interpolator
+ *
+ * Rate changes by 2 with a half-band filter made of two branches of first-order allpass sections,
+ * for uses where the phase need not be linear.  With the allpass sections
+ * <pre>
+ *    A(z) = (a + z^-2) / (1 + a * z^-2)
+ * </pre>
+ * the filter is
+ * <pre>
+ *    H(z) = (A0(z) + z^-1 * A1(z)) / 2
+ * </pre>
+ * where the branch <code>A0</code> chains the sections of the coefficients
+ * <code>pCoeffs[0], pCoeffs[2], ...</code> and <code>A1</code> those of
+ * <code>pCoeffs[1], pCoeffs[3], ...</code>.  Both branches run at the low rate, the decimator
+ * feeds the odd input samples to <code>A0</code> and the even ones to <code>A1</code> and averages
+ * the branches, the interpolator feeds each input to both branches and outputs <code>A0</code>
+ * then <code>A1</code>.  A section is
+ * <pre>
+ *    y[n] = a * (x[n] - y[n-1]) + x[n-1]
+ * </pre>
+ * one multiplication, so that an output of the decimator and a pair of outputs of the interpolator
+ * cost <code>numCoefs</code> multiplications, 3 to 8 for the usual designs, where a FIR half-band
+ * of the same attenuation needs several tens of taps.
+ * \par
+ * riscv_iir_halfband_design_f32() computes the coefficients of an elliptic half-band for a given
+ * number of coefficients and width of the transition band around a quarter of the high rate:
+ * 4 coefficients give 70 dB of stopband attenuation with a transition of 0.1 of the high rate,
+ * 8 coefficients give 69 dB with 0.01.  The coefficients lie between 0 and 1.
+ * \par
+ * The filters take one or two interleaved channels.  A frame is one sample of each channel,
+ * <code>blockSize</code> counts frames, and the decimator needs an even number of them.  The
+ * state holds <code>numCoefs+2</code> samples per channel, the last input and the last output of
+ * every section.
+ * \par
+ * The Q15 filters saturate the output of every section; the xpulp path runs two sections per
+ * step in the two 16-bit lanes of a word, the two branches of one channel or the same branch of
+ * two channels, with one <code>pv.dotsp.h</code> per lane.  The Q15 state buffer must then be
+ * 32-bit aligned.
+ */
+
+/**
+ * @addtogroup IIR_halfband
+ * @{
+ */
+
+/*
+* @brief  Runs one sample through the sections of a branch.
+* @param[in]     *pCoeffs      points to the first coefficient of the branch, the next ones follow at a stride of 2.
+* @param[in,out] *pState       points to the state of the branch, at a stride of 2.
+* @param[in]     numSections   number of sections of the branch.
+* @param[in]     in            input sample.
+* @return        output sample.
+*/
+
+static inline float32_t riscv_iir_halfband_branch_f32(
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t numSections,
+  float32_t in)
+{
+  float32_t prev;                                /* Previous input of the section */
+
+  while(numSections > 0u)
+  {
+    /* y[n] = a * (x[n] - y[n-1]) + x[n-1], y[n-1] is the previous input of the next section */
+    prev = pState[0];
+    pState[0] = in;
+    in = (*pCoeffs * (in - pState[2])) + prev;
+
+    pCoeffs += 2;
+    pState += 2;
+    numSections--;
+  }
+
+  pState[0] = in;
+
+  return (in);
+}
+
+/**
+ * @brief  Processing function for the floating-point IIR half-band decimator.
+ * @param[in]     *S          points to an instance of the floating-point IIR half-band structure.
+ * @param[in]     *pSrc       points to the block of input frames.
+ * @param[out]    *pDst       points to the block of <code>blockSize/2</code> output frames.
+ * @param[in]     blockSize   number of input frames to process, even.
+ */
+
+void riscv_iir_halfband_decimate_f32(
+  const riscv_iir_halfband_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_iir_halfband_decimate_f32);
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+  uint32_t numChannels = S->numChannels;         /* Interleaved channels */
+  uint32_t numSections0 = (S->numCoefs + 1u) >> 1u;  /* Sections of the branches */
+  uint32_t numSections1 = S->numCoefs >> 1u;
+  float32_t *pState0 = S->pState;                /* State of the branches, see riscv_iir_halfband_init_f32() */
+  float32_t *pState1 = (numChannels == 1u) ? (S->pState + 1) : (S->pState + (2u * (numSections0 + 1u)));
+  float32_t y0, y1;
+  uint32_t blkCnt, ch;
+
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      /* The odd sample through A0, the even one through A1 */
+      y0 = riscv_iir_halfband_branch_f32(pCoeffs, pState0 + ch, numSections0, pSrc[numChannels + ch]);
+      y1 = riscv_iir_halfband_branch_f32(pCoeffs + 1, pState1 + ch, numSections1, pSrc[ch]);
+
+      *pDst++ = 0.5f * (y0 + y1);
+    }
+
+    pSrc += 2u * numChannels;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of IIR_halfband group
+ */
@@ -0,0 +1,218 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_iir_halfband_decimate_q15.c
+*
+* Description:  Q15 polyphase allpass IIR half-band decimator by 2.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup IIR_halfband
+ * @{
+ */
+
+/*
+* @brief  Runs one sample through the sections of a branch.
+* @param[in]     *pCoeffs      points to the first coefficient of the branch, the next ones follow at a stride of 2.
+* @param[in,out] *pState       points to the state of the branch, at a stride of 2.
+* @param[in]     numSections   number of sections of the branch.
+* @param[in]     in            input sample.
+* @return        output sample, stored after the state of the last section.
+*/
+
+static inline q15_t riscv_iir_halfband_branch_q15(
+  const q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t numSections,
+  q15_t in)
+{
+  q31_t prev;                                    /* Previous input of the section */
+
+  while(numSections > 0u)
+  {
+    /* y[n] = a * (x[n] - y[n-1]) + x[n-1], y[n-1] is the previous input of the next section */
+    prev = pState[0];
+    pState[0] = in;
+    in = (q15_t) __SSAT((((q31_t) *pCoeffs * ((q31_t) in - pState[2])) >> 15) + prev, 16);
+
+    pCoeffs += 2;
+    pState += 2;
+    numSections--;
+  }
+
+  pState[0] = in;
+
+  return (in);
+}
+
+#if defined (USE_DSP_RISCV)
+
+/*
+* @brief  Runs two samples through the sections of two branches held in the lanes of a word.
+* @param[in]     *pCoef0       points to the {a, -a} pair of the first section of lane 0, the next ones follow at a stride of 2.
+* @param[in]     *pCoef1       points to the {a, -a} pair of the first section of lane 1, at a stride of 2.
+* @param[in,out] *pState       points to the state words of the lanes, at a stride of 2 samples.
+* @param[in]     numSections   number of sections.
+* @param[in]     in            input samples of the two lanes.
+* @return        output samples, which the caller stores after the state of the last section.
+*/
+
+static inline shortV riscv_iir_halfband_lanes_q15(
+  const shortV * pCoef0,
+  const shortV * pCoef1,
+  q15_t * pState,
+  uint32_t numSections,
+  shortV in)
+{
+  shortV sel0 = { 0, 2 };                        /* {x[n], y[n-1]} of lane 0 */
+  shortV sel1 = { 1, 3 };                        /* {x[n], y[n-1]} of lane 1 */
+  shortV prev, last;
+  q31_t y0, y1;
+
+  while(numSections > 0u)
+  {
+    prev = *(shortV *) pState;
+    last = *(shortV *) (pState + 2);
+    *(shortV *) pState = in;
+
+    /* a * x[n] - a * y[n-1] + x[n-1] in each lane */
+    y0 = (dotpv2(shufflev4(in, last, sel0), *pCoef0) >> 15) + prev[0];
+    y1 = (dotpv2(shufflev4(in, last, sel1), *pCoef1) >> 15) + prev[1];
+    in = pack2(clip(y0, -32768, 32767), clip(y1, -32768, 32767));
+
+    pCoef0 += 2;
+    pCoef1 += 2;
+    pState += 2;
+    numSections--;
+  }
+
+  return (in);
+}
+
+#endif /* #if defined (USE_DSP_RISCV) */
+
+/**
+ * @brief  Processing function for the Q15 IIR half-band decimator.
+ * @param[in]     *S          points to an instance of the Q15 IIR half-band structure.
+ * @param[in]     *pSrc       points to the block of input frames.
+ * @param[out]    *pDst       points to the block of <code>blockSize/2</code> output frames.
+ * @param[in]     blockSize   number of input frames to process, even.
+ * \par
+ * A section computes <code>a * (x[n] - y[n-1])</code> in 32 bits, truncates it to 1.15 and
+ * saturates its output; the average of the branches is truncated.  The xpulp path gives the same
+ * outputs.  It runs the two branches in the two lanes of a word for one channel, and the same
+ * branch of both channels for two, where <code>pSrc</code> and <code>pDst</code> must be 32-bit
+ * aligned.
+ */
+
+void riscv_iir_halfband_decimate_q15(
+  const riscv_iir_halfband_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_iir_halfband_decimate_q15);
+  const q15_t *pCoeffs = S->pCoeffs;             /* Coefficient pointer */
+  uint32_t numChannels = S->numChannels;         /* Interleaved channels */
+  uint32_t numSections0 = (S->numCoefs + 1u) >> 1u;  /* Sections of the branches */
+  uint32_t numSections1 = S->numCoefs >> 1u;
+  q15_t *pState0 = S->pState;                    /* State of the branches, see riscv_iir_halfband_init_q15() */
+  q15_t *pState1 = (numChannels == 1u) ? (S->pState + 1) : (S->pState + (2u * (numSections0 + 1u)));
+  uint32_t blkCnt;                               /* Loop counter */
+#if defined (USE_DSP_RISCV)
+  shortV coefs[RISCV_IIR_HALFBAND_MAX_COEFS];    /* {a, -a} of every section */
+  shortV y0, y1;
+  q31_t out0;
+  uint32_t k;
+#else
+  q31_t y0, y1;
+  uint32_t ch;
+#endif
+
+  blkCnt = blockSize >> 1u;
+
+#if defined (USE_DSP_RISCV)
+
+  for (k = 0u; k < S->numCoefs; k++)
+  {
+    coefs[k] = pack2(pCoeffs[k], -pCoeffs[k]);
+  }
+
+  if(numChannels == 1u)
+  {
+    while(blkCnt > 0u)
+    {
+      /* {x[2n+1], x[2n]}, branch 0 in lane 0 and branch 1 in lane 1 */
+      y0 = riscv_iir_halfband_lanes_q15(coefs, coefs + 1, pState0, numSections1,
+                                        pack2(pSrc[1], pSrc[0]));
+
+      /* Last section of branch 0 when it has one more */
+      if(numSections0 != numSections1)
+      {
+        pState1[2u * numSections1] = y0[1];
+        out0 = riscv_iir_halfband_branch_q15(pCoeffs + (2u * numSections1), pState0 + (2u * numSections1), 1u, y0[0]);
+      }
+      else
+      {
+        *(shortV *) (pState0 + (2u * numSections1)) = y0;
+        out0 = y0[0];
+      }
+
+      *pDst++ = (q15_t) ((out0 + y0[1]) >> 1);
+      pSrc += 2;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while(blkCnt > 0u)
+    {
+      /* The channels in the lanes, odd frame through branch 0, even frame through branch 1 */
+      y0 = riscv_iir_halfband_lanes_q15(coefs, coefs, pState0, numSections0, *(shortV *) (pSrc + 2));
+      *(shortV *) (pState0 + (2u * numSections0)) = y0;
+      y1 = riscv_iir_halfband_lanes_q15(coefs + 1, coefs + 1, pState1, numSections1, *(shortV *) pSrc);
+      *(shortV *) (pState1 + (2u * numSections1)) = y1;
+
+      *(shortV *) pDst = pack2(((q31_t) y0[0] + y1[0]) >> 1, ((q31_t) y0[1] + y1[1]) >> 1);
+      pSrc += 4;
+      pDst += 2;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+#else
+
+  while(blkCnt > 0u)
+  {
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      /* The odd sample through A0, the even one through A1 */
+      y0 = riscv_iir_halfband_branch_q15(pCoeffs, pState0 + ch, numSections0, pSrc[numChannels + ch]);
+      y1 = riscv_iir_halfband_branch_q15(pCoeffs + 1, pState1 + ch, numSections1, pSrc[ch]);
+
+      *pDst++ = (q15_t) ((y0 + y1) >> 1);
+    }
+
+    pSrc += 2u * numChannels;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#endif
+}
+
+/**
+ * @} end of IIR_halfband group
+ */
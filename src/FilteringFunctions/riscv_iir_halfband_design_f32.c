@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_iir_halfband_design_f32.c
+*
+* Description:  Allpass coefficients of an elliptic IIR half-band filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup IIR_halfband
+ * @{
+ */
+
+/**
+* @brief  Allpass coefficients of an elliptic IIR half-band filter.
+* @param[in]  numCoefs     number of coefficients, 1 to RISCV_IIR_HALFBAND_MAX_COEFS.
+* @param[in]  transition   width of the transition band as a fraction of the high rate, between 0 and 0.5.
+* @param[out] *pCoeffs     points to the <code>numCoefs</code> coefficients, in increasing order.
+* @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>numCoefs</code> or
+* <code>transition</code> is out of range.
+*
+* \par
+* The passband ends at <code>0.25-transition/2</code> of the high rate, the stopband starts at
+* <code>0.25+transition/2</code>, and the attenuation is the largest that the order
+* <code>2*numCoefs+1</code> reaches over this transition; the passband ripple is far below the
+* resolution of Q15.  The zeros of the elliptic filter come from the series of the theta functions
+* of the nome <code>q</code> of the transition, of which 8 terms are summed.  The tangent, sines and
+* cosines come from riscv_sin_f32() and riscv_cos_f32().
+*/
+
+riscv_status riscv_iir_halfband_design_f32(
+  uint8_t numCoefs,
+  float32_t transition,
+  float32_t * pCoeffs)
+{
+  RISCV_PROFILE(riscv_iir_halfband_design_f32);
+  float32_t order = (float32_t) ((2u * numCoefs) + 1u);  /* Order of the filter */
+  float32_t k, kk, e, e4, q, q4;                 /* Modulus, nome and its fourth root */
+  float32_t num, den, qn, qd, r, sign;           /* Theta function series */
+  float32_t a, w, x;
+  uint32_t n, i;
+
+  if((numCoefs == 0u) || (numCoefs > RISCV_IIR_HALFBAND_MAX_COEFS) || !(transition > 0.0f) || !(transition < 0.5f))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Squared modulus k of the elliptic filter */
+  a = (1.0f - (2.0f * transition)) * (PI / 4.0f);
+  k = riscv_sin_f32(a) / riscv_cos_f32(a);
+  k = k * k;
+
+  /* Nome q from the complementary modulus, q4 = q^(1/4) */
+  riscv_sqrt_f32(1.0f - (k * k), &kk);
+  riscv_sqrt_f32(kk, &kk);
+  e = (0.5f * (1.0f - kk)) / (1.0f + kk);
+  e4 = (e * e) * (e * e);
+  q = e * (1.0f + (e4 * (2.0f + (e4 * (15.0f + (150.0f * e4))))));
+  riscv_sqrt_f32(q, &q4);
+  riscv_sqrt_f32(q4, &q4);
+
+  for (n = 1u; n <= numCoefs; n++)
+  {
+    /* num = sum of (-1)^i q^(i*(i+1)) sin((2i+1) n pi / order), den = 1/2 + sum of (-1)^i q^(i*i) cos(2i n pi / order) */
+    num = 0.0f;
+    den = 0.5f;
+    sign = 1.0f;
+    qn = 1.0f;
+    qd = q;
+    r = q * q;
+
+    for (i = 0u; i < 8u; i++)
+    {
+      num += sign * qn * riscv_sin_f32(((float32_t) ((2u * i) + 1u) * (float32_t) n * PI) / order);
+      den -= sign * qd * riscv_cos_f32(((float32_t) (2u * (i + 1u)) * (float32_t) n * PI) / order);
+      sign = -sign;
+      qn *= r;
+      qd *= r * q;
+      r *= q * q;
+    }
+
+    /* Pole of the section n mapped to its allpass coefficient */
+    w = (num * q4) / den;
+    w = w * w;
+    riscv_sqrt_f32((1.0f - (w * k)) * (1.0f - (w / k)), &x);
+    x = x / (1.0f + w);
+
+    pCoeffs[n - 1u] = (1.0f - x) / (1.0f + x);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of IIR_halfband group
+*/
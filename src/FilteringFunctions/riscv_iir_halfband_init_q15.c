@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_iir_halfband_init_q15.c
+*
+* Description:  Q15 IIR half-band decimator and interpolator initialization function.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup IIR_halfband
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 IIR half-band decimator and interpolator.
+ * @param[in,out] *S            points to an instance of the Q15 IIR half-band structure.
+ * @param[in]     numCoefs      number of allpass coefficients, 1 to RISCV_IIR_HALFBAND_MAX_COEFS.
+ * @param[in]     numChannels   1, or 2 for interleaved stereo.
+ * @param[in]     *pCoeffs      points to the <code>numCoefs</code> coefficients, between 0 and 1.
+ * @param[in]     *pState       points to the state buffer of <code>numChannels*(numCoefs+2)</code> samples.
+ * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>numCoefs</code> or
+ *                <code>numChannels</code> is out of range.
+ *
+ * \par
+ * The state holds the last input of the first section and the last output of every section of
+ * the branches, the sample <code>j</code> of the branch <code>b</code> and channel <code>c</code> at
+ * <code>pState[2*j+b]</code> for one channel and at <code>pState[b*(numCoefs+2+(numCoefs&1))+2*j+c]</code>
+ * for two.  The decimator and the interpolator share the instance layout, but one instance is
+ * meant for one of them.
+ */
+
+riscv_status riscv_iir_halfband_init_q15(
+  riscv_iir_halfband_instance_q15 * S,
+  uint8_t numCoefs,
+  uint8_t numChannels,
+  const q15_t * pCoeffs,
+  q15_t * pState)
+{
+  RISCV_PROFILE(riscv_iir_halfband_init_q15);
+
+  if((numCoefs == 0u) || (numCoefs > RISCV_IIR_HALFBAND_MAX_COEFS) || (numChannels == 0u) || (numChannels > 2u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numCoefs = numCoefs;
+  S->numChannels = numChannels;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear the state buffer */
+  memset(pState, 0, (uint32_t) numChannels * (numCoefs + 2u) * sizeof(q15_t));
+
+  S->pState = pState;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of IIR_halfband group
+ */
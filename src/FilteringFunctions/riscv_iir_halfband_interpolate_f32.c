@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_iir_halfband_interpolate_f32.c
+*
+* Description:  Floating-point polyphase allpass IIR half-band interpolator by 2.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup IIR_halfband
+ * @{
+ */
+
+/*
+* @brief  Runs one sample through the sections of a branch, as in riscv_iir_halfband_decimate_f32.c.
+*/
+
+static inline float32_t riscv_iir_halfband_branch_f32(
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t numSections,
+  float32_t in)
+{
+  float32_t prev;                                /* Previous input of the section */
+
+  while(numSections > 0u)
+  {
+    /* y[n] = a * (x[n] - y[n-1]) + x[n-1], y[n-1] is the previous input of the next section */
+    prev = pState[0];
+    pState[0] = in;
+    in = (*pCoeffs * (in - pState[2])) + prev;
+
+    pCoeffs += 2;
+    pState += 2;
+    numSections--;
+  }
+
+  pState[0] = in;
+
+  return (in);
+}
+
+/**
+ * @brief  Processing function for the floating-point IIR half-band interpolator.
+ * @param[in]     *S          points to an instance of the floating-point IIR half-band structure.
+ * @param[in]     *pSrc       points to the block of input frames.
+ * @param[out]    *pDst       points to the block of <code>2*blockSize</code> output frames.
+ * @param[in]     blockSize   number of input frames to process.
+ * \par
+ * The output keeps the amplitude of the input, the gain 2 of the interpolation is built in.
+ */
+
+void riscv_iir_halfband_interpolate_f32(
+  const riscv_iir_halfband_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_iir_halfband_interpolate_f32);
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+  uint32_t numChannels = S->numChannels;         /* Interleaved channels */
+  uint32_t numSections0 = (S->numCoefs + 1u) >> 1u;  /* Sections of the branches */
+  uint32_t numSections1 = S->numCoefs >> 1u;
+  float32_t *pState0 = S->pState;                /* State of the branches, see riscv_iir_halfband_init_f32() */
+  float32_t *pState1 = (numChannels == 1u) ? (S->pState + 1) : (S->pState + (2u * (numSections0 + 1u)));
+  uint32_t blkCnt, ch;
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      /* A0 gives the even output, A1 the odd one */
+      pDst[ch] = riscv_iir_halfband_branch_f32(pCoeffs, pState0 + ch, numSections0, pSrc[ch]);
+      pDst[numChannels + ch] = riscv_iir_halfband_branch_f32(pCoeffs + 1, pState1 + ch, numSections1, pSrc[ch]);
+    }
+
+    pSrc += numChannels;
+    pDst += 2u * numChannels;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of IIR_halfband group
+ */
@@ -135,6 +135,7 @@ void riscv_iir_lattice_f32(
   float32_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_iir_lattice_f32);
   float32_t fcurr, fnext = 0, gcurr, gnext;      /* Temporary variables for lattice stages */
   float32_t acc;                                 /* Accumlator */
   uint32_t blkCnt, tapCnt;                       /* temporary variables for counts */
@@ -0,0 +1,165 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_iir_lattice_init_arena.c
+*
+* Description:  IIR lattice filter instances with the state buffer taken
+*               from an arena.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup IIR_Lattice
+ * @{
+ */
+
+/**
+ * @brief  Size of the state buffer of the floating-point IIR lattice filter.
+ * @param[in]  numStages  number of stages in the filter.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     bytes the state takes from the arena, <code>numStages+blockSize</code> samples.
+ */
+
+uint32_t riscv_iir_lattice_get_buffer_size_f32(
+  uint16_t numStages,
+  uint32_t blockSize)
+{
+  return (RISCV_DSP_ARENA_ROUND(((uint32_t) numStages + blockSize) * sizeof(float32_t)));
+}
+
+/**
+ * @brief  Initialization function for the floating-point IIR lattice filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the floating-point IIR lattice filter structure.
+ * @param[in]     numStages number of stages in the filter.
+ * @param[in]     *pkCoeffs points to the reflection coefficient buffer.
+ * @param[in]     *pvCoeffs points to the ladder coefficient buffer.
+ * @param[in]     blockSize number of samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_iir_lattice_get_buffer_size_f32() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_iir_lattice_init_arena_f32(
+  riscv_iir_lattice_instance_f32 * S,
+  uint16_t numStages,
+  float32_t * pkCoeffs,
+  float32_t * pvCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_iir_lattice_init_arena_f32);
+  float32_t *pState = (float32_t *) riscv_dsp_arena_alloc(pArena, riscv_iir_lattice_get_buffer_size_f32(numStages, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_iir_lattice_init_f32(S, numStages, pkCoeffs, pvCoeffs, pState, blockSize);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q31 IIR lattice filter.
+ * @param[in]  numStages  number of stages in the filter.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     bytes the state takes from the arena, <code>numStages+blockSize</code> samples.
+ */
+
+uint32_t riscv_iir_lattice_get_buffer_size_q31(
+  uint16_t numStages,
+  uint32_t blockSize)
+{
+  return (RISCV_DSP_ARENA_ROUND(((uint32_t) numStages + blockSize) * sizeof(q31_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q31 IIR lattice filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q31 IIR lattice filter structure.
+ * @param[in]     numStages number of stages in the filter.
+ * @param[in]     *pkCoeffs points to the reflection coefficient buffer.
+ * @param[in]     *pvCoeffs points to the ladder coefficient buffer.
+ * @param[in]     blockSize number of samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_iir_lattice_get_buffer_size_q31() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_iir_lattice_init_arena_q31(
+  riscv_iir_lattice_instance_q31 * S,
+  uint16_t numStages,
+  q31_t * pkCoeffs,
+  q31_t * pvCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_iir_lattice_init_arena_q31);
+  q31_t *pState = (q31_t *) riscv_dsp_arena_alloc(pArena, riscv_iir_lattice_get_buffer_size_q31(numStages, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_iir_lattice_init_q31(S, numStages, pkCoeffs, pvCoeffs, pState, blockSize);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q15 IIR lattice filter.
+ * @param[in]  numStages  number of stages in the filter.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     bytes the state takes from the arena, <code>numStages+blockSize</code> samples.
+ */
+
+uint32_t riscv_iir_lattice_get_buffer_size_q15(
+  uint16_t numStages,
+  uint32_t blockSize)
+{
+  return (RISCV_DSP_ARENA_ROUND(((uint32_t) numStages + blockSize) * sizeof(q15_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q15 IIR lattice filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q15 IIR lattice filter structure.
+ * @param[in]     numStages number of stages in the filter.
+ * @param[in]     *pkCoeffs points to the reflection coefficient buffer.
+ * @param[in]     *pvCoeffs points to the ladder coefficient buffer.
+ * @param[in]     blockSize number of samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_iir_lattice_get_buffer_size_q15() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_iir_lattice_init_arena_q15(
+  riscv_iir_lattice_instance_q15 * S,
+  uint16_t numStages,
+  q15_t * pkCoeffs,
+  q15_t * pvCoeffs,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_iir_lattice_init_arena_q15);
+  q15_t *pState = (q15_t *) riscv_dsp_arena_alloc(pArena, riscv_iir_lattice_get_buffer_size_q15(numStages, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_iir_lattice_init_q15(S, numStages, pkCoeffs, pvCoeffs, pState, blockSize);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of IIR_Lattice group
+ */
@@ -70,6 +70,7 @@ void riscv_iir_lattice_init_q15(
   q15_t * pState,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_iir_lattice_init_q15);
   /* Assign filter taps */
   S->numStages = numStages;
 
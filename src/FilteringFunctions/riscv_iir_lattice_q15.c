@@ -76,186 +76,170 @@ void riscv_iir_lattice_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_iir_lattice_q15);
 
 
 
 #if defined (USE_DSP_RISCV)
 
-  q31_t fcurr, fnext, gcurr = 0, gnext;          /* Temporary variables for lattice stages */
-  q15_t gnext1, gnext2;                          /* Temporary variables for lattice stages */
+  q31_t fcurr1, fcurr2, gcurr;                   /* Temporary variables for lattice stages */
+  q31_t gnext1, gnext2, gnext3, gnext4;          /* Temporary variables for lattice stages */
+  q31_t k1, k2, kPrev;                           /* Reflection coefficients */
   uint32_t stgCnt;                               /* Temporary variables for counts */
-  q63_t acc;                                     /* Accumlator */
+  q63_t acc1, acc2;                              /* Accumlators */
   uint32_t blkCnt, tapCnt;                       /* Temporary variables for counts */
-  q15_t *px1, *px2, *pk, *pv;                    /* temporary pointers for state and coef */
+  q15_t *px, *pk, *pv;                           /* temporary pointers for state and coef */
   uint32_t numStages = S->numStages;             /* number of stages */
   q15_t *pState;                                 /* State pointer */
   q15_t *pStateCurnt;                            /* State current pointer */
-  q15_t out;                                     /* Temporary variable for output */
-  q31_t v;                                       /* Temporary variable for ladder coefficient */
-  q15_t v1, v2;
-  shortV VectInA;
-  shortV VectInB;
 
-  blkCnt = blockSize;
+  blkCnt = blockSize >> 1u;
 
   pState = &S->pState[0];
 
-  /* Sample processing */
+  /* Two samples are in flight.  Sample n+1 runs one stage behind sample n, because    
+   ** its stage m reads gN-m-1(n) that sample n computes in its stage m+1.  The values    
+   ** of sample n are passed on in registers and only those of sample n+1 are written    
+   ** to the state, every coefficient is loaded once for both samples.  mulsN does the    
+   ** 16x16 multiply and the shift by 15 of each product in one instruction. */
   while(blkCnt > 0u)
   {
-    /* Read Sample from input buffer */
-    /* fN(n) = x(n) */
-    fcurr = *pSrc++;
-
-    /* Initialize state read pointer */
-    px1 = pState;
-    /* Initialize state write pointer */
-    px2 = pState;
-    /* Set accumulator to zero */
-    acc = 0;
+    /* fN(n) = x(n), fN(n+1) = x(n+1) */
+    fcurr1 = *pSrc++;
+    fcurr2 = *pSrc++;
+
+    /* Initialize state pointer */
+    px = pState;
+    /* Set accumulators to zero */
+    acc1 = 0;
+    acc2 = 0;
     /* Initialize Ladder coeff pointer */
     pv = &S->pvCoeffs[0];
     /* Initialize Reflection coeff pointer */
     pk = &S->pkCoeffs[0];
 
-
-    /* Process sample for first tap */
-    gcurr = *px1++;
+    /* Process sample n for first tap */
+    k1 = *pk++;
+    gcurr = *px++;
     /* fN-1(n) = fN(n) - kN * gN-1(n-1) */
-    fnext = fcurr - (((q31_t) gcurr * (*pk)) >> 15);
-    fnext = clip(fnext, -32768,32767);
+    fcurr1 = clip(fcurr1 - mulsN(gcurr, k1, 15), -32768, 32767);
     /* gN(n) = kN * fN-1(n) + gN-1(n-1) */
-    gnext = (((q31_t) fnext * (*pk++)) >> 15) + gcurr; 
-    gnext = clip(gnext,-32768,32767);
-    /* write gN(n) into state for next sample processing */
-    *px2++ = (q15_t) gnext;
+    gnext1 = clip(mulsN(fcurr1, k1, 15) + gcurr, -32768, 32767);
     /* y(n) += gN(n) * vN  */
-    acc += (q31_t) ((gnext * (*pv++)));
+    acc1 += (q31_t) (gnext1 * (*pv));
+    kPrev = k1;
 
-
-    /* Update f values for next coefficient processing */
-    fcurr = fnext;
-
-    /* Loop unrolling.  Process 4 taps at a time. */
-    tapCnt = (numStages - 1u) >> 2;
+    /* Next two taps of sample n and the two taps before of sample n+1 */
+    tapCnt = (numStages - 1u) >> 1u;
 
     while(tapCnt > 0u)
     {
+      k1 = *pk++;
+      k2 = *pk++;
 
-      /* Process sample for 2nd, 6th ...taps */
-      /* Read gN-2(n-1) from state buffer */
-      gcurr = *px1++;
-      /* Process sample for 2nd, 6th .. taps */
-      /* fN-2(n) = fN-1(n) - kN-1 * gN-2(n-1) */
-      fnext = fcurr - (((q31_t) gcurr * (*pk)) >> 15);
-      fnext = clip(fnext, -32768,32767);
-      /* gN-1(n) = kN-1 * fN-2(n) + gN-2(n-1) */
-      gnext = (((q31_t) fnext * (*pk++)) >> 15) + gcurr;
-      gnext1 = (q15_t) clip(gnext, -32768,32767);
-      /* write gN-1(n) into state */
-      *px2++ = (q15_t) gnext1;
-
-
-      /* Process sample for 3nd, 7th ...taps */
-      /* Read gN-3(n-1) from state */
-      gcurr = *px1++;
-      /* Process sample for 3rd, 7th .. taps */
-      /* fN-3(n) = fN-2(n) - kN-2 * gN-3(n-1) */
-      fcurr = fnext - (((q31_t) gcurr * (*pk)) >> 15);
-      fcurr = clip(fcurr, -32768,32767);
-      /* gN-2(n) = kN-2 * fN-3(n) + gN-3(n-1) */
-      gnext = (((q31_t) fcurr * (*pk++)) >> 15) + gcurr;
-      gnext2 = (q15_t) clip(gnext, -32768,32767);
-      /* write gN-2(n) into state */
-      *px2++ = (q15_t) gnext2;
-      VectInA = *(shortV*)pv; 
-      pv+=2;
-      VectInB = pack2(gnext1,gnext2);
-
-
-
-      /* y(n) += gN-1(n) * vN-1  */
-      /* process for gN-5(n) * vN-5, gN-9(n) * vN-9 ... */
-      /* y(n) += gN-2(n) * vN-2  */
-      /* process for gN-6(n) * vN-6, gN-10(n) * vN-10 ... */
-      acc += dotpv2(VectInA,VectInB);
-
-      /* Process sample for 4th, 8th ...taps */
-      /* Read gN-4(n-1) from state */
-      gcurr = *px1++;
-      /* Process sample for 4th, 8th .. taps */
-      /* fN-4(n) = fN-3(n) - kN-3 * gN-4(n-1) */
-      fnext = fcurr - (((q31_t) gcurr * (*pk)) >> 15);
-      fnext = clip(fnext,  -32768,32767);
-      /* gN-3(n) = kN-3 * fN-1(n) + gN-1(n-1) */
-      gnext = (((q31_t) fnext * (*pk++)) >> 15) + gcurr;
-      gnext1 = (q15_t) clip(gnext,  -32768,32767);
-      /* write  gN-3(n) for the next sample process */
-      *px2++ = (q15_t) gnext1;
-
-
-      /* Process sample for 5th, 9th ...taps */
-      /* Read gN-5(n-1) from state */
-      gcurr = *px1++;
-      /* Process sample for 5th, 9th .. taps */
-      /* fN-5(n) = fN-4(n) - kN-4 * gN-5(n-1) */
-      fcurr = fnext - (((q31_t) gcurr * (*pk)) >> 15);
-      fcurr = clip(fcurr, -32768,32767);
-      /* gN-4(n) = kN-4 * fN-5(n) + gN-5(n-1) */
-      gnext = (((q31_t) fcurr * (*pk++)) >> 15) + gcurr;
-      gnext2 = (q15_t) clip(gnext,  -32768,32767);
-      /* write      gN-4(n) for the next sample process */
-      *px2++ = (q15_t) gnext2;
-
-      /* Read vN-3 and vN-4 at a time */
-      VectInA = *(shortV*)pv; 
-      pv+=2;
-      VectInB = pack2(gnext1,gnext2);
-
-
-      /* y(n) += gN-4(n) * vN-4  */
-      /* process for gN-8(n) * vN-8, gN-12(n) * vN-12 ... */
-      /* y(n) += gN-3(n) * vN-3  */
-      /* process for gN-7(n) * vN-7, gN-11(n) * vN-11 ... */
-      acc += dotpv2(VectInA,VectInB);
-      tapCnt--;
+      /* Sample n, tap m: gN-m(n-1) from state */
+      gcurr = px[0];
+      fcurr1 = clip(fcurr1 - mulsN(gcurr, k1, 15), -32768, 32767);
+      gnext1 = clip(mulsN(fcurr1, k1, 15) + gcurr, -32768, 32767);
 
-    }
+      /* Sample n+1, tap m-1: gN-m(n) from sample n */
+      fcurr2 = clip(fcurr2 - mulsN(gnext1, kPrev, 15), -32768, 32767);
+      gnext3 = clip(mulsN(fcurr2, kPrev, 15) + gnext1, -32768, 32767);
 
-    fnext = fcurr;
+      /* Sample n, tap m+1 */
+      gcurr = px[1];
+      fcurr1 = clip(fcurr1 - mulsN(gcurr, k2, 15), -32768, 32767);
+      gnext2 = clip(mulsN(fcurr1, k2, 15) + gcurr, -32768, 32767);
 
-    /* If the filter length is not a multiple of 4, compute the remaining filter taps */
-    tapCnt = (numStages - 1u) % 0x4u;
+      /* Sample n+1, tap m */
+      fcurr2 = clip(fcurr2 - mulsN(gnext2, k1, 15), -32768, 32767);
+      gnext4 = clip(mulsN(fcurr2, k1, 15) + gnext2, -32768, 32767);
 
-    while(tapCnt > 0u)
-    {
-      gcurr = *px1++;
-      /* Process sample for last taps */
-      fnext = fcurr - (((q31_t) gcurr * (*pk)) >> 15);
-      fnext = clip(fnext,-32768,32767);
-      gnext = (((q31_t) fnext * (*pk++)) >> 15) + gcurr;
-      gnext = clip(gnext,-32768,32767);
-      /* Output samples for last taps */
-      acc += (q31_t) (((q31_t) gnext * (*pv++)));
-      *px2++ = (q15_t) gnext;
-      fcurr = fnext;
+      /* write the two g values of sample n+1 into state for next sample processing */
+      *(shortV*)px = pack2(gnext3, gnext4);
+      px += 2;
+
+      /* y(n) += gN-m(n) * vN-m + gN-m-1(n) * vN-m-1, y(n+1) one tap behind */
+      acc1 += dotpv2(pack2(gnext1, gnext2), *(shortV*)(pv + 1));
+      acc2 += dotpv2(pack2(gnext3, gnext4), *(shortV*)pv);
+      pv += 2;
 
+      kPrev = k2;
       tapCnt--;
     }
 
-    /* y(n) += g0(n) * v0 */
-    acc += (q31_t) (((q31_t) fnext * (*pv++)));
+    /* If numStages - 1 is odd, process the remaining tap of sample n */
+    if(((numStages - 1u) & 1u) != 0u)
+    {
+      k1 = *pk++;
+      gcurr = *px;
+      fcurr1 = clip(fcurr1 - mulsN(gcurr, k1, 15), -32768, 32767);
+      gnext1 = clip(mulsN(fcurr1, k1, 15) + gcurr, -32768, 32767);
 
-    out = (q15_t) clip(acc >> 15, -32768,32767);
-    *px2++ = (q15_t) fnext;
+      fcurr2 = clip(fcurr2 - mulsN(gnext1, kPrev, 15), -32768, 32767);
+      gnext3 = clip(mulsN(fcurr2, kPrev, 15) + gnext1, -32768, 32767);
+      *px++ = (q15_t) gnext3;
+
+      acc1 += (q31_t) (gnext1 * pv[1]);
+      acc2 += (q31_t) (gnext3 * pv[0]);
+      pv++;
+
+      kPrev = k1;
+    }
+
+    /* Last tap of sample n+1, it reads g0(n) = f0(n) */
+    fcurr2 = clip(fcurr2 - mulsN(fcurr1, kPrev, 15), -32768, 32767);
+    gnext3 = clip(mulsN(fcurr2, kPrev, 15) + fcurr1, -32768, 32767);
+    *px++ = (q15_t) gnext3;
+    acc2 += (q31_t) (gnext3 * (*pv++));
+
+    /* y(n) += g0(n) * v0 */
+    acc1 += (q31_t) (fcurr1 * (*pv));
+    acc2 += (q31_t) (fcurr2 * (*pv));
+    *px = (q15_t) fcurr2;
 
     /* write out into pDst */
-    *pDst++ = out;
+    *(shortV*)pDst = pack2(clip(acc1 >> 15, -32768, 32767), clip(acc2 >> 15, -32768, 32767));
+    pDst += 2;
 
-    /* Advance the state pointer by 4 to process the next group of 4 samples */
-    pState = pState + 1u;
+    /* Advance the state pointer by 2 to process the next two samples */
+    pState = pState + 2u;
     blkCnt--;
+  }
+
+  /* If the blockSize is odd, compute the last output sample here */
+  if((blockSize & 1u) != 0u)
+  {
+    fcurr1 = *pSrc++;
+
+    px = pState;
+    acc1 = 0;
+    pv = &S->pvCoeffs[0];
+    pk = &S->pkCoeffs[0];
 
+    tapCnt = numStages;
+
+    while(tapCnt > 0u)
+    {
+      k1 = *pk++;
+      gcurr = *px;
+      /* fN-1(n) = fN(n) - kN * gN-1(n-1) */
+      fcurr1 = clip(fcurr1 - mulsN(gcurr, k1, 15), -32768, 32767);
+      /* gN(n) = kN * fN-1(n) + gN-1(n-1) */
+      gnext1 = clip(mulsN(fcurr1, k1, 15) + gcurr, -32768, 32767);
+      /* y(n) += gN(n) * vN */
+      acc1 += (q31_t) (gnext1 * (*pv++));
+      /* write gN(n) into state for next sample processing */
+      *px++ = (q15_t) gnext1;
+
+      tapCnt--;
+    }
+
+    /* y(n) += g0(n) * v0 */
+    acc1 += (q31_t) (fcurr1 * (*pv));
+    *px = (q15_t) fcurr1;
+
+    *pDst++ = (q15_t) clip(acc1 >> 15, -32768, 32767);
   }
 
   /* Processing is complete. Now copy last S->numStages samples to start of the buffer    
@@ -272,7 +256,7 @@ void riscv_iir_lattice_q15(
     *(shortV*)pStateCurnt = *(shortV*)pState;
     *(shortV*)(pStateCurnt+2) = *(shortV*)(pState+2);
     pStateCurnt+=4;
-    pStateCurnt+=4;
+    pState+=4;
     /* Decrement the loop counter */
     stgCnt--;
 
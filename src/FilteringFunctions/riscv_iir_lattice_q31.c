@@ -51,6 +51,30 @@
  * @{    
  */
 
+#if defined (USE_DSP_RISCV)
+
+/* a + b and a - b saturated to Q31 with 32-bit arithmetic, the same results as
+   clip_q63_to_q31() of the 64-bit sum and difference */
+static inline q31_t riscv_iir_lattice_qadd_q31(
+  q31_t a,
+  q31_t b)
+{
+  q31_t sum = (q31_t) ((uint32_t) a + (uint32_t) b);
+
+  return (((a ^ sum) & (b ^ sum)) < 0) ? (0x7FFFFFFF ^ (a >> 31)) : sum;
+}
+
+static inline q31_t riscv_iir_lattice_qsub_q31(
+  q31_t a,
+  q31_t b)
+{
+  q31_t diff = (q31_t) ((uint32_t) a - (uint32_t) b);
+
+  return (((a ^ b) & (a ^ diff)) < 0) ? (0x7FFFFFFF ^ (a >> 31)) : diff;
+}
+
+#endif /* #if defined (USE_DSP_RISCV) */
+
 /**    
  * @brief Processing function for the Q31 IIR lattice filter.    
  * @param[in] *S points to an instance of the Q31 IIR lattice structure.    
@@ -75,6 +99,7 @@ void riscv_iir_lattice_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_iir_lattice_q31);
   q31_t fcurr, fnext = 0, gcurr = 0, gnext;      /* Temporary variables for lattice stages */
   q63_t acc;                                     /* Accumlator */
   uint32_t blkCnt, tapCnt;                       /* Temporary variables for counts */
@@ -82,6 +107,9 @@ void riscv_iir_lattice_q31(
   uint32_t numStages = S->numStages;             /* number of stages */
   q31_t *pState;                                 /* State pointer */
   q31_t *pStateCurnt;                            /* State current pointer */
+#if defined (USE_DSP_RISCV)
+  q31_t k;                                       /* Reflection coefficient */
+#endif
 
   blkCnt = blockSize;
 
@@ -108,6 +136,35 @@ void riscv_iir_lattice_q31(
 
     tapCnt = numStages;
 
+#if defined (USE_DSP_RISCV)
+
+    /* Each stage loads its reflection coefficient once and overwrites its state in place,
+     * the saturations are done in 32 bits */
+    while(tapCnt > 0u)
+    {
+      gcurr = *px1;
+      k = *pk++;
+
+      /* fN-1(n) = fN(n) - kN * gN-1(n-1) */
+      fnext = riscv_iir_lattice_qsub_q31(fcurr, (q31_t) (((q63_t) gcurr * k) >> 31));
+
+      /* gN(n) = kN * fN-1(n) + gN-1(n-1) */
+      gnext = riscv_iir_lattice_qadd_q31(gcurr, (q31_t) (((q63_t) fnext * k) >> 31));
+
+      /* y(n) += gN(n) * vN  */
+      acc += ((q63_t) gnext * *pv++);
+
+      *px1++ = gnext;
+
+      fcurr = fnext;
+
+      tapCnt--;
+    }
+
+    px2 = px1;
+
+#else
+
     while(tapCnt > 0u)
     {
       gcurr = *px1++;
@@ -131,6 +188,8 @@ void riscv_iir_lattice_q31(
       tapCnt--;
     }
 
+#endif /* #if defined (USE_DSP_RISCV) */
+
     /* y(n) += g0(n) * v0 */
     acc += (q63_t) fnext *(
   *pv++);
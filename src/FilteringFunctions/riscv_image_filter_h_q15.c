@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_image_filter_h_q15.c
+*
+* Description:  Horizontal pass of a separable filter of a Q15 image.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ImageFilt
+ * @{
+ */
+
+/**
+ * @brief  Horizontal pass of a separable filter of a Q15 image.
+ * @param[in]  *pSrc       points to the image of <code>numRows x numCols</code> pixels.
+ * @param[in]  numRows     number of rows of the image.
+ * @param[in]  numCols     number of columns of the image.
+ * @param[in]  *pCoeffs    points to the <code>numTaps</code> taps.
+ * @param[in]  numTaps     number of taps, at most <code>numCols</code>.
+ * @param[in]  postShift   right shift of the sums.
+ * @param[out] *pDst       points to the output of <code>numRows x (numCols-numTaps+1)</code> pixels.
+ *
+ * \par
+ * The products are accumulated in 32 bits, the sum of <code>|pCoeffs[k]|</code> times the
+ * largest pixel must fit, as in riscv_conv_fast_q15().
+ */
+
+void riscv_image_filter_h_q15(
+  const q15_t * pSrc,
+  uint16_t numRows,
+  uint16_t numCols,
+  const q15_t * pCoeffs,
+  uint16_t numTaps,
+  uint8_t postShift,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_image_filter_h_q15);
+  uint32_t outCols = (uint32_t) numCols - numTaps + 1u;
+  const q15_t *px;                               /* Window of the output */
+  q31_t acc;                                     /* Accumulator */
+  uint32_t r, c, k;
+
+  for (r = 0u; r < numRows; r++)
+  {
+    for (c = 0u; c < outCols; c++)
+    {
+      px = pSrc + c;
+      acc = 0;
+      k = 0u;
+
+#if defined (USE_DSP_RISCV)
+      /* Two taps per pv.sdotsp.h */
+      for (; (k + 1u) < numTaps; k += 2u)
+      {
+        acc = sumdotpv2(*(shortV *) (px + k), *(shortV *) (pCoeffs + k), acc);
+      }
+#endif
+
+      for (; k < numTaps; k++)
+      {
+        acc += (q31_t) pCoeffs[k] * px[k];
+      }
+
+      *pDst++ = (q15_t) __SSAT(acc >> postShift, 16);
+    }
+
+    pSrc += numCols;
+  }
+}
+
+/**
+ * @} end of ImageFilt group
+ */
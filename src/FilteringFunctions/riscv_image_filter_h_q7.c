@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_image_filter_h_q7.c
+*
+* Description:  Horizontal pass of a separable filter of a Q7 image.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ImageFilt
+ * @{
+ */
+
+/**
+ * @brief  Horizontal pass of a separable filter of a Q7 image.
+ * @param[in]  *pSrc       points to the image of <code>numRows x numCols</code> pixels.
+ * @param[in]  numRows     number of rows of the image.
+ * @param[in]  numCols     number of columns of the image.
+ * @param[in]  *pCoeffs    points to the <code>numTaps</code> taps.
+ * @param[in]  numTaps     number of taps, at most <code>numCols</code>.
+ * @param[in]  postShift   right shift of the sums.
+ * @param[out] *pDst       points to the output of <code>numRows x (numCols-numTaps+1)</code> pixels.
+ *
+ * \par
+ * The products are accumulated in 32 bits, which do not overflow for up to 2^17 taps.
+ */
+
+void riscv_image_filter_h_q7(
+  const q7_t * pSrc,
+  uint16_t numRows,
+  uint16_t numCols,
+  const q7_t * pCoeffs,
+  uint16_t numTaps,
+  uint8_t postShift,
+  q7_t * pDst)
+{
+  RISCV_PROFILE(riscv_image_filter_h_q7);
+  uint32_t outCols = (uint32_t) numCols - numTaps + 1u;
+  const q7_t *px;                               /* Window of the output */
+  q31_t acc;                                     /* Accumulator */
+  uint32_t r, c, k;
+
+  for (r = 0u; r < numRows; r++)
+  {
+    for (c = 0u; c < outCols; c++)
+    {
+      px = pSrc + c;
+      acc = 0;
+      k = 0u;
+
+#if defined (USE_DSP_RISCV)
+      /* Four taps per pv.sdotsp.b */
+      for (; (k + 3u) < numTaps; k += 4u)
+      {
+        acc = sumdotpv4(*(charV *) (px + k), *(charV *) (pCoeffs + k), acc);
+      }
+#endif
+
+      for (; k < numTaps; k++)
+      {
+        acc += (q31_t) pCoeffs[k] * px[k];
+      }
+
+      *pDst++ = (q7_t) __SSAT(acc >> postShift, 8);
+    }
+
+    pSrc += numCols;
+  }
+}
+
+/**
+ * @} end of ImageFilt group
+ */
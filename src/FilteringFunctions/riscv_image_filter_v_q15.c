@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_image_filter_v_q15.c
+*
+* Description:  Vertical pass of a separable filter of a Q15 image.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ImageFilt
+ * @{
+ */
+
+/**
+ * @brief  Vertical pass of a separable filter of a Q15 image.
+ * @param[in]  *pSrc       points to the image of <code>numRows x numCols</code> pixels.
+ * @param[in]  numRows     number of rows of the image.
+ * @param[in]  numCols     number of columns of the image.
+ * @param[in]  *pCoeffs    points to the <code>numTaps</code> taps.
+ * @param[in]  numTaps     number of taps, at most <code>numRows</code>.
+ * @param[in]  postShift   right shift of the sums.
+ * @param[out] *pDst       points to the output of <code>(numRows-numTaps+1) x numCols</code> pixels.
+ *
+ * \par
+ * The products are accumulated in 32 bits, the sum of <code>|pCoeffs[k]|</code> times the
+ * largest pixel must fit, as in riscv_conv_fast_q15().
+ */
+
+void riscv_image_filter_v_q15(
+  const q15_t * pSrc,
+  uint16_t numRows,
+  uint16_t numCols,
+  const q15_t * pCoeffs,
+  uint16_t numTaps,
+  uint8_t postShift,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_image_filter_v_q15);
+  uint32_t outRows = (uint32_t) numRows - numTaps + 1u;
+  uint32_t strip, stripEnd;                      /* Columns of the strip */
+  const q15_t *px;                               /* Top pixel of the column */
+  q31_t acc;                                     /* Accumulator */
+  uint32_t r, c, k;
+#if defined (USE_DSP_RISCV)
+  shortV lo = { 0, 2 };                          /* Left column of two rows */
+  shortV hi = { 1, 3 };                          /* Right column of two rows */
+  shortV a, b, h;
+  q31_t acc1;
+#endif
+
+  for (strip = 0u; strip < numCols; strip += RISCV_IMAGE_STRIP)
+  {
+    stripEnd = (strip + RISCV_IMAGE_STRIP < numCols) ? (strip + RISCV_IMAGE_STRIP) : numCols;
+
+    for (r = 0u; r < outRows; r++)
+    {
+      c = strip;
+
+#if defined (USE_DSP_RISCV)
+      /* Two columns per pass, two rows per pv.sdotsp.h */
+      for (; (c + 1u) < stripEnd; c += 2u)
+      {
+        px = pSrc + (r * numCols) + c;
+        acc = 0;
+        acc1 = 0;
+
+        for (k = 0u; (k + 1u) < numTaps; k += 2u)
+        {
+          a = *(shortV *) px;
+          b = *(shortV *) (px + numCols);
+          h = pack2(pCoeffs[k], pCoeffs[k + 1u]);
+          acc = sumdotpv2(shufflev4(a, b, lo), h, acc);
+          acc1 = sumdotpv2(shufflev4(a, b, hi), h, acc1);
+          px += 2u * numCols;
+        }
+
+        if(k < numTaps)
+        {
+          acc += (q31_t) pCoeffs[k] * px[0];
+          acc1 += (q31_t) pCoeffs[k] * px[1];
+        }
+
+        pDst[(r * numCols) + c] = (q15_t) __SSAT(acc >> postShift, 16);
+        pDst[(r * numCols) + c + 1u] = (q15_t) __SSAT(acc1 >> postShift, 16);
+      }
+#endif
+
+      for (; c < stripEnd; c++)
+      {
+        px = pSrc + (r * numCols) + c;
+        acc = 0;
+
+        for (k = 0u; k < numTaps; k++)
+        {
+          acc += (q31_t) pCoeffs[k] * *px;
+          px += numCols;
+        }
+
+        pDst[(r * numCols) + c] = (q15_t) __SSAT(acc >> postShift, 16);
+      }
+    }
+  }
+}
+
+/**
+ * @} end of ImageFilt group
+ */
@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_image_filter_v_q7.c
+*
+* Description:  Vertical pass of a separable filter of a Q7 image.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ImageFilt
+ * @{
+ */
+
+/**
+ * @brief  Vertical pass of a separable filter of a Q7 image.
+ * @param[in]  *pSrc       points to the image of <code>numRows x numCols</code> pixels.
+ * @param[in]  numRows     number of rows of the image.
+ * @param[in]  numCols     number of columns of the image.
+ * @param[in]  *pCoeffs    points to the <code>numTaps</code> taps.
+ * @param[in]  numTaps     number of taps, at most <code>numRows</code>.
+ * @param[in]  postShift   right shift of the sums.
+ * @param[out] *pDst       points to the output of <code>(numRows-numTaps+1) x numCols</code> pixels.
+ *
+ * \par
+ * The products are accumulated in 32 bits, which do not overflow for up to 2^17 taps.
+ */
+
+void riscv_image_filter_v_q7(
+  const q7_t * pSrc,
+  uint16_t numRows,
+  uint16_t numCols,
+  const q7_t * pCoeffs,
+  uint16_t numTaps,
+  uint8_t postShift,
+  q7_t * pDst)
+{
+  RISCV_PROFILE(riscv_image_filter_v_q7);
+  uint32_t outRows = (uint32_t) numRows - numTaps + 1u;
+  uint32_t strip, stripEnd;                      /* Columns of the strip */
+  const q7_t *px;                                /* Top pixel of the column */
+  q31_t acc;                                     /* Accumulator */
+  uint32_t r, c, k, i;
+#if defined (USE_DSP_RISCV)
+  charV even = { 0, 4, 1, 5 };                   /* Columns 0 and 1 of two rows */
+  charV odd = { 2, 6, 3, 7 };                    /* Columns 2 and 3 of two rows */
+  charV first = { 0, 1, 4, 5 };                  /* First column of two pairs of rows */
+  charV second = { 2, 3, 6, 7 };                 /* Second column of two pairs of rows */
+  charV a, b, d, e, ab, de, h;
+  q31_t acc1, acc2, acc3;
+#endif
+
+  for (strip = 0u; strip < numCols; strip += RISCV_IMAGE_STRIP)
+  {
+    stripEnd = (strip + RISCV_IMAGE_STRIP < numCols) ? (strip + RISCV_IMAGE_STRIP) : numCols;
+
+    for (r = 0u; r < outRows; r++)
+    {
+      c = strip;
+
+#if defined (USE_DSP_RISCV)
+      /* Four columns per pass, the 4x4 block of four rows is transposed into the columns */
+      for (; (c + 3u) < stripEnd; c += 4u)
+      {
+        px = pSrc + (r * numCols) + c;
+        acc = 0;
+        acc1 = 0;
+        acc2 = 0;
+        acc3 = 0;
+
+        for (k = 0u; (k + 3u) < numTaps; k += 4u)
+        {
+          a = *(charV *) px;
+          b = *(charV *) (px + numCols);
+          d = *(charV *) (px + (2u * numCols));
+          e = *(charV *) (px + (3u * numCols));
+          h = *(charV *) (pCoeffs + k);
+
+          ab = shuffle2b(a, b, even);
+          de = shuffle2b(d, e, even);
+          acc = sumdotpv4(shuffle2b(ab, de, first), h, acc);
+          acc1 = sumdotpv4(shuffle2b(ab, de, second), h, acc1);
+
+          ab = shuffle2b(a, b, odd);
+          de = shuffle2b(d, e, odd);
+          acc2 = sumdotpv4(shuffle2b(ab, de, first), h, acc2);
+          acc3 = sumdotpv4(shuffle2b(ab, de, second), h, acc3);
+
+          px += 4u * numCols;
+        }
+
+        for (; k < numTaps; k++)
+        {
+          acc += (q31_t) pCoeffs[k] * px[0];
+          acc1 += (q31_t) pCoeffs[k] * px[1];
+          acc2 += (q31_t) pCoeffs[k] * px[2];
+          acc3 += (q31_t) pCoeffs[k] * px[3];
+          px += numCols;
+        }
+
+        i = (r * numCols) + c;
+        pDst[i] = (q7_t) __SSAT(acc >> postShift, 8);
+        pDst[i + 1u] = (q7_t) __SSAT(acc1 >> postShift, 8);
+        pDst[i + 2u] = (q7_t) __SSAT(acc2 >> postShift, 8);
+        pDst[i + 3u] = (q7_t) __SSAT(acc3 >> postShift, 8);
+      }
+#endif
+
+      for (; c < stripEnd; c++)
+      {
+        px = pSrc + (r * numCols) + c;
+        acc = 0;
+
+        for (k = 0u; k < numTaps; k++)
+        {
+          acc += (q31_t) pCoeffs[k] * *px;
+          px += numCols;
+        }
+
+        i = (r * numCols) + c;
+        pDst[i] = (q7_t) __SSAT(acc >> postShift, 8);
+      }
+    }
+  }
+}
+
+/**
+ * @} end of ImageFilt group
+ */
@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_integral_box_q31.c
+*
+* Description:  Sums of all the boxes of one size from an integral image.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ImageFilt
+ * @{
+ */
+
+/**
+ * @brief  Sums of all the boxes of one size from an integral image.
+ * @param[in]  *pIntegral  points to the integral image of a <code>numRows x numCols</code> image.
+ * @param[in]  numRows     number of rows of the image.
+ * @param[in]  numCols     number of columns of the image.
+ * @param[in]  boxRows     height of the boxes, at most <code>numRows</code>.
+ * @param[in]  boxCols     width of the boxes, at most <code>numCols</code>.
+ * @param[out] *pDst       points to the <code>(numRows-boxRows+1) x (numCols-boxCols+1)</code> sums.
+ *
+ * \par
+ * <code>pDst[r][c]</code> is the sum of the box whose top left pixel is <code>(r, c)</code>,
+ * riscv_integral_box_sum() of every position.  Each sum is two subtractions of two rows of the
+ * integral image, the rows <code>r</code> and <code>r+boxRows</code>, read once from left to right.
+ */
+
+void riscv_integral_box_q31(
+  const q31_t * pIntegral,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint16_t boxRows,
+  uint16_t boxCols,
+  q31_t * pDst)
+{
+  RISCV_PROFILE(riscv_integral_box_q31);
+  uint32_t stride = (uint32_t) numCols + 1u;     /* Words per row of the integral image */
+  uint32_t outRows = (uint32_t) numRows - boxRows + 1u;
+  uint32_t outCols = (uint32_t) numCols - boxCols + 1u;
+  const q31_t *pTop, *pBottom;                   /* Rows above and at the bottom of the boxes */
+  uint32_t r, c;
+
+  for (r = 0u; r < outRows; r++)
+  {
+    pTop = pIntegral + (r * stride);
+    pBottom = pTop + ((uint32_t) boxRows * stride);
+
+    /* Bottom right - top right - bottom left + top left */
+    for (c = 0u; c < outCols; c++)
+    {
+      *pDst++ = (pBottom[c + boxCols] - pTop[c + boxCols]) - (pBottom[c] - pTop[c]);
+    }
+  }
+}
+
+/**
+ * @} end of ImageFilt group
+ */
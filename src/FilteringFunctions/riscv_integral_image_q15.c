@@ -0,0 +1,61 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_integral_image_q15.c
+*
+* Description:  Integral image of a Q15 image.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ImageFilt
+ * @{
+ */
+
+/**
+ * @brief  Integral image of a Q15 image.
+ * @param[in]  *pSrc     points to the image of <code>numRows x numCols</code> pixels.
+ * @param[in]  numRows   number of rows of the image.
+ * @param[in]  numCols   number of columns of the image.
+ * @param[out] *pDst     points to the integral image of <code>(numRows+1) x (numCols+1)</code> words.
+ */
+
+void riscv_integral_image_q15(
+  const q15_t * pSrc,
+  uint16_t numRows,
+  uint16_t numCols,
+  q31_t * pDst)
+{
+  RISCV_PROFILE(riscv_integral_image_q15);
+  uint32_t stride = (uint32_t) numCols + 1u;     /* Words per row of the integral image */
+  q31_t *pAbove;                                 /* Row above in the integral image */
+  q31_t rowSum;                                  /* Sum of the row up to the current column */
+  uint32_t r, c;
+
+  /* Row and column of zeros */
+  memset(pDst, 0, stride * sizeof(q31_t));
+
+  for (r = 0u; r < numRows; r++)
+  {
+    pAbove = pDst;
+    pDst += stride;
+    pDst[0] = 0;
+    rowSum = 0;
+
+    for (c = 0u; c < numCols; c++)
+    {
+      rowSum += *pSrc++;
+      pDst[c + 1u] = pAbove[c + 1u] + rowSum;
+    }
+  }
+}
+
+/**
+ * @} end of ImageFilt group
+ */
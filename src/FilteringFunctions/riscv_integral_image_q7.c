@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_integral_image_q7.c
+*
+* Description:  Integral image of a Q7 image.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup ImageFilt Image Filters
+ *
+ * Box sums and separable filters of small images stored row by row, <code>numRows</code> rows
+ * of <code>numCols</code> pixels.
+ * \par
+ * The integral image of riscv_integral_image_q7() and riscv_integral_image_q15() has
+ * <code>(numRows+1) x (numCols+1)</code> words, a row and a column of zeros followed by
+ * <pre>
+ *    I[r+1][c+1] = sum of pSrc[i][j] for i <= r, j <= c
+ * </pre>
+ * so that the sum of any box is four reads, riscv_integral_box_sum(), whatever its size.
+ * riscv_integral_box_q31() computes the sums of all the boxes of one size, the sliding
+ * window of a feature extractor.  The sums are 32 bits: Q7 images of up to 2^24 pixels and
+ * Q15 images of up to 2^16 pixels cannot overflow.
+ * \par
+ * A 2D filter whose kernel is the outer product of two 1D kernels, a box or a Gaussian,
+ * runs as a horizontal pass riscv_image_filter_h_q7() along the rows and a vertical pass
+ * riscv_image_filter_v_q7() along the columns, <code>2*numTaps</code> instead of
+ * <code>numTaps^2</code> multiplications per pixel.  The passes compute the valid part of the
+ * filter, the horizontal one drops <code>numTaps-1</code> columns and the vertical one
+ * <code>numTaps-1</code> rows:
+ * <pre>
+ *    h: pDst[r][c] = (sum of pCoeffs[k] * pSrc[r][c+k]) >> postShift,   0 <= c <= numCols-numTaps
+ *    v: pDst[r][c] = (sum of pCoeffs[k] * pSrc[r+k][c]) >> postShift,   0 <= r <= numRows-numTaps
+ * </pre>
+ * The sums are accumulated in 32 bits, truncated by <code>postShift</code> and saturated.  A
+ * Gaussian with the binomial taps 1 4 6 4 1 and <code>postShift</code> 4 has a unity gain.
+ * \par
+ * The vertical pass walks down the image in strips of RISCV_IMAGE_STRIP columns, so the
+ * <code>numTaps</code> rows of a strip that one output row reads are read again by the next ones
+ * while they are still close in the cache.  With <code>USE_DSP_RISCV</code> it computes 4 Q7 or
+ * 2 Q15 columns at once: the pixels of <code>numTaps</code> rows are loaded as words, transposed
+ * with <code>pv.shuffle2</code> into the column vectors and multiplied with the taps by
+ * <code>pv.sdotsp</code>.  The horizontal pass multiplies 4 Q7 or 2 Q15 taps with one
+ * <code>pv.sdotsp</code>.  Rows should be 4-byte aligned, <code>numCols</code> a multiple of 4
+ * for Q7 and 2 for Q15.
+ */
+
+/**
+ * @addtogroup ImageFilt
+ * @{
+ */
+
+/**
+ * @brief  Integral image of a Q7 image.
+ * @param[in]  *pSrc     points to the image of <code>numRows x numCols</code> pixels.
+ * @param[in]  numRows   number of rows of the image.
+ * @param[in]  numCols   number of columns of the image.
+ * @param[out] *pDst     points to the integral image of <code>(numRows+1) x (numCols+1)</code> words.
+ */
+
+void riscv_integral_image_q7(
+  const q7_t * pSrc,
+  uint16_t numRows,
+  uint16_t numCols,
+  q31_t * pDst)
+{
+  RISCV_PROFILE(riscv_integral_image_q7);
+  uint32_t stride = (uint32_t) numCols + 1u;     /* Words per row of the integral image */
+  q31_t *pAbove;                                 /* Row above in the integral image */
+  q31_t rowSum;                                  /* Sum of the row up to the current column */
+  uint32_t r, c;
+
+  /* Row and column of zeros */
+  memset(pDst, 0, stride * sizeof(q31_t));
+
+  for (r = 0u; r < numRows; r++)
+  {
+    pAbove = pDst;
+    pDst += stride;
+    pDst[0] = 0;
+    rowSum = 0;
+
+    for (c = 0u; c < numCols; c++)
+    {
+      rowSum += *pSrc++;
+      pDst[c + 1u] = pAbove[c + 1u] + rowSum;
+    }
+  }
+}
+
+/**
+ * @} end of ImageFilt group
+ */
@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_levinson_durbin_f32.c
+*
+* Description:  Floating-point Levinson-Durbin recursion for linear prediction.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup LPC Linear Prediction
+ *
+ * \par
+ * Linear prediction analysis in two steps: the autocorrelation of a frame at the lags 0 to
+ * <code>order</code>, and the Levinson-Durbin recursion that solves the normal equations for the
+ * reflection coefficients of the lattice filters and the coefficients of the prediction error filter
+ * <pre>
+ *    A(z) = 1 + a1 * z^-1 + a2 * z^-2 + ... + ap * z^-p
+ * </pre>
+ * \par
+ * The reflection coefficients <code>{k1, k2, ..., kp}</code> are in the order and format of the
+ * lattice instances of the same type: riscv_fir_lattice_init_f32(), riscv_fir_lattice_init_q15() and
+ * riscv_fir_lattice_init_q31() take them as they are and filter a frame into its prediction error.
+ * The IIR lattice filters store them time-reversed, <code>{kp, ..., k1}</code>; with the ladder
+ * coefficients <code>{0, ..., 0, 1}</code> they run the all-pole synthesis filter 1/A(z).
+ * \par
+ * riscv_autocorr_q15() and riscv_autocorr_q31() return the lags normalized to the full 1.31 range, the
+ * format riscv_levinson_durbin_q15() and riscv_levinson_durbin_q31() take; the recursion runs in 32-bit
+ * fixed point with 64-bit accumulators and one division per order, without any floating-point code.
+ * A window on the frame and a lag window or white noise correction on the autocorrelation, applied
+ * before the recursion, are left to the application.
+ */
+
+/**
+ * @addtogroup LPC
+ * @{
+ */
+
+/**
+ * @brief Floating-point Levinson-Durbin recursion.
+ * @param[in]  *pR     points to the autocorrelation at the lags 0 to <code>order</code>.
+ * @param[in]  order   order p of the predictor.
+ * @param[out] *pK     points to the <code>order</code> reflection coefficients <code>{k1, ..., kp}</code>.
+ * @param[out] *pA     points to the <code>order</code> coefficients <code>{a1, ..., ap}</code> of A(z).
+ * @param[out] *pErr   points to the energy of the prediction error, in the scale of <code>pR</code>.
+ * @return RISCV_MATH_SUCCESS, or RISCV_MATH_SINGULAR if the autocorrelation is not positive definite.
+ *
+ * \par
+ * A reflection coefficient of magnitude 1 or more, or a lag 0 that is not positive, stops the
+ * recursion: the remaining reflection coefficients and predictor coefficients are set to 0, so the
+ * lattice filters still run the predictor of the orders that were solved.
+ */
+
+riscv_status riscv_levinson_durbin_f32(
+  const float32_t * pR,
+  uint32_t order,
+  float32_t * pK,
+  float32_t * pA,
+  float32_t * pErr)
+{
+  RISCV_PROFILE(riscv_levinson_durbin_f32);
+  float32_t err = pR[0];                         /* Prediction error energy */
+  float32_t acc, k, ai, aj;
+  uint32_t m, i, j;
+  riscv_status status = RISCV_MATH_SUCCESS;
+
+  for (m = 0u; m < order; m++)
+  {
+    /* acc = r[m+1] + a1 * r[m] + ... + am * r[1] */
+    acc = pR[m + 1u];
+    for (i = 0u; i < m; i++)
+    {
+      acc += pA[i] * pR[m - i];
+    }
+
+    k = (err > 0.0f) ? (-acc / err) : 1.0f;
+    if((k >= 1.0f) || (k <= -1.0f))
+    {
+      status = RISCV_MATH_SINGULAR;
+      break;
+    }
+
+    /* a_i += k * a_(m+1-i), both ends of a pair at once so no copy is needed */
+    for (i = 0u; ((2u * i) + 1u) < m; i++)
+    {
+      j = m - 1u - i;
+      ai = pA[i];
+      aj = pA[j];
+      pA[i] = ai + (k * aj);
+      pA[j] = aj + (k * ai);
+    }
+    if((m & 1u) != 0u)
+    {
+      pA[m >> 1u] += k * pA[m >> 1u];
+    }
+
+    pA[m] = k;
+    pK[m] = k;
+    err *= 1.0f - (k * k);
+  }
+
+  for (; m < order; m++)
+  {
+    pA[m] = 0.0f;
+    pK[m] = 0.0f;
+  }
+
+  *pErr = err;
+
+  return (status);
+}
+
+/**
+ * @} end of LPC group
+ */
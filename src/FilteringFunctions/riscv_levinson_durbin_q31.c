@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_levinson_durbin_q31.c
+*
+* Description:  Q31 Levinson-Durbin recursion for linear prediction.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LPC
+ * @{
+ */
+
+/**
+ * @brief Q31 Levinson-Durbin recursion.
+ * @param[in]  *pR     points to the autocorrelation at the lags 0 to <code>order</code>, as riscv_autocorr_q31() returns it.
+ * @param[in]  order   order p of the predictor.
+ * @param[out] *pK     points to the <code>order</code> reflection coefficients <code>{k1, ..., kp}</code> in 1.31 format.
+ * @param[out] *pA     points to the <code>order</code> coefficients <code>{a1, ..., ap}</code> of A(z) in 5.27 format.
+ * @param[out] *pErr   points to the energy of the prediction error, in the scale of <code>pR</code>.
+ * @return RISCV_MATH_SUCCESS, or RISCV_MATH_SINGULAR if the autocorrelation is not positive definite.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The recursion keeps the predictor coefficients in 5.27 format, magnitudes up to 16, and accumulates
+ * the products with the lags in 64 bits.  Each order divides the 64-bit accumulator by the error
+ * energy once for the reflection coefficient in full 1.31 precision.  The coefficient updates
+ * saturate.  As riscv_levinson_durbin_f32(), a reflection coefficient of magnitude 1 or more stops the recursion and zeroes the remaining ones.
+ */
+
+riscv_status riscv_levinson_durbin_q31(
+  const q31_t * pR,
+  uint32_t order,
+  q31_t * pK,
+  q31_t * pA,
+  q31_t * pErr)
+{
+  RISCV_PROFILE(riscv_levinson_durbin_q31);
+  q31_t err = pR[0];                             /* Prediction error energy */
+  q63_t acc, lim;
+  q31_t k, k2, ai, aj;
+  uint32_t m, i, j;
+  riscv_status status = RISCV_MATH_SUCCESS;
+
+  for (m = 0u; m < order; m++)
+  {
+    /* acc = r[m+1] + a1 * r[m] + ... + am * r[1], in units of 2^-27 */
+    acc = (q63_t) pR[m + 1u] << 27;
+    for (i = 0u; i < m; i++)
+    {
+      acc += (q63_t) pA[i] * pR[m - i];
+    }
+
+    /* k = -acc / err must have a magnitude below 1 */
+    lim = (q63_t) err << 27;
+    if((err <= 0) || (acc >= lim) || (acc <= -lim))
+    {
+      status = RISCV_MATH_SINGULAR;
+      break;
+    }
+    k = (q31_t) -((acc << 4) / err);
+
+    /* a_i += k * a_(m+1-i), both ends of a pair at once so no copy is needed */
+    for (i = 0u; ((2u * i) + 1u) < m; i++)
+    {
+      j = m - 1u - i;
+      ai = pA[i];
+      aj = pA[j];
+      pA[i] = clip_q63_to_q31((q63_t) ai + (((q63_t) k * aj) >> 31));
+      pA[j] = clip_q63_to_q31((q63_t) aj + (((q63_t) k * ai) >> 31));
+    }
+    if((m & 1u) != 0u)
+    {
+      ai = pA[m >> 1u];
+      pA[m >> 1u] = clip_q63_to_q31((q63_t) ai + (((q63_t) k * ai) >> 31));
+    }
+
+    pA[m] = k >> 4;
+    pK[m] = k;
+
+    /* err *= 1 - k^2 */
+    k2 = (q31_t) (((q63_t) k * k) >> 31);
+    err -= (q31_t) (((q63_t) err * k2) >> 31);
+  }
+
+  for (; m < order; m++)
+  {
+    pA[m] = 0;
+    pK[m] = 0;
+  }
+
+  *pErr = err;
+
+  return (status);
+}
+
+/**
+ * @} end of LPC group
+ */
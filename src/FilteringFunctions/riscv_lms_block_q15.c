@@ -0,0 +1,299 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_lms_block_q15.c
+*
+* Description:  Processing function for the Q15 block LMS filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LMS
+ * @{
+ */
+
+/**
+* @brief  Filter pass of the Q15 block LMS filters.
+* @param[in]  *pCoeffs   points to the coefficients.
+* @param[in]  numTaps    number of filter coefficients.
+* @param[in]  *pState    points to the oldest state sample of the first output.
+* @param[out] *pOut      points to the block of output data.
+* @param[in]  blockSize  number of samples to process.
+* @param[in]  postShift  bit shift applied to coefficients.
+* @return none.
+*
+* All outputs of the block are computed with the same coefficients, four at a time so that every
+* coefficient pair is loaded once for four outputs.  This function is also used by riscv_lms_norm_block_q15().
+*/
+
+void riscv_lms_block_filter_q15(
+  const q15_t * pCoeffs,
+  uint32_t numTaps,
+  const q15_t * pState,
+  q15_t * pOut,
+  uint32_t blockSize,
+  uint32_t postShift)
+{
+  RISCV_PROFILE(riscv_lms_block_filter_q15);
+  const q15_t *px, *pb;                          /* Temporary pointers for state and coefficient buffers */
+  q63_t acc0;                                    /* Accumulator */
+  q31_t acc_l, acc_h;
+  int32_t lShift = (15 - (int32_t) postShift);   /*  Post shift  */
+  int32_t uShift = (32 - lShift);
+  uint32_t tapCnt, n = 0u;                       /* Loop counters */
+#if defined (USE_DSP_RISCV)
+  q63_t acc1, acc2, acc3;                        /* Accumulators of the other three outputs */
+  shortV c;                                      /* Coefficient pair */
+
+  for (; (n + 4u) <= blockSize; n += 4u)
+  {
+    px = pState + n;
+    pb = pCoeffs;
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+    for (tapCnt = numTaps >> 1u; tapCnt > 0u; tapCnt--)
+    {
+      c = *(shortV *) pb;
+      pb += 2;
+
+      acc0 += dotpv2(*(shortV *) px, c);
+      acc1 += dotpv2(*(shortV *) (px + 1), c);
+      acc2 += dotpv2(*(shortV *) (px + 2), c);
+      acc3 += dotpv2(*(shortV *) (px + 3), c);
+      px += 2;
+    }
+
+    if((numTaps & 1u) != 0u)
+    {
+      acc0 += (q31_t) px[0] * *pb;
+      acc1 += (q31_t) px[1] * *pb;
+      acc2 += (q31_t) px[2] * *pb;
+      acc3 += (q31_t) px[3] * *pb;
+    }
+
+    /* Apply the shift to the lower and upper part of each accumulator and saturate to 1.15 format */
+    acc_l = acc0 & 0xffffffff;
+    acc_h = (acc0 >> 32) & 0xffffffff;
+    pOut[n] = (q15_t) clip((q31_t) ((uint32_t) acc_l >> lShift | acc_h << uShift), -32768, 32767);
+    acc_l = acc1 & 0xffffffff;
+    acc_h = (acc1 >> 32) & 0xffffffff;
+    pOut[n + 1u] = (q15_t) clip((q31_t) ((uint32_t) acc_l >> lShift | acc_h << uShift), -32768, 32767);
+    acc_l = acc2 & 0xffffffff;
+    acc_h = (acc2 >> 32) & 0xffffffff;
+    pOut[n + 2u] = (q15_t) clip((q31_t) ((uint32_t) acc_l >> lShift | acc_h << uShift), -32768, 32767);
+    acc_l = acc3 & 0xffffffff;
+    acc_h = (acc3 >> 32) & 0xffffffff;
+    pOut[n + 3u] = (q15_t) clip((q31_t) ((uint32_t) acc_l >> lShift | acc_h << uShift), -32768, 32767);
+  }
+
+#endif
+
+  /* Remaining outputs, one at a time */
+  for (; n < blockSize; n++)
+  {
+    px = pState + n;
+    pb = pCoeffs;
+    acc0 = 0;
+
+    for (tapCnt = numTaps; tapCnt > 0u; tapCnt--)
+    {
+      acc0 += (q63_t) ((q31_t) (*px++) * (*pb++));
+    }
+
+    acc_l = acc0 & 0xffffffff;
+    acc_h = (acc0 >> 32) & 0xffffffff;
+    pOut[n] = (q15_t) __SSAT((q31_t) ((uint32_t) acc_l >> lShift | acc_h << uShift), 16);
+  }
+}
+
+/*
+* @brief  Adds the scaled gradient of one tap to its coefficient.
+* @param[in]  coef  coefficient, in 1.15 format.
+* @param[in]  grad  gradient, sum of 2.30 products.
+* @param[in]  mu    step size, in 1.15 format.
+* @return     updated coefficient, saturated to 1.15 format.
+*/
+
+static inline q15_t riscv_lms_block_step_q15(
+  q15_t coef,
+  q63_t grad,
+  q15_t mu)
+{
+  /* 2.30 gradient times the 1.15 step size, back to 1.15 */
+  grad = ((grad >> 15) * mu) >> 15;
+
+  /* Limit the step to the range of two coefficients before the saturating add */
+  if(grad > 0xFFFF)
+  {
+    grad = 0xFFFF;
+  }
+  else if(grad < -0x10000)
+  {
+    grad = -0x10000;
+  }
+
+  return ((q15_t) __SSAT((q31_t) coef + (q31_t) grad, 16));
+}
+
+/**
+* @brief  Coefficient update of the Q15 block LMS filters.
+* @param[in,out] *pCoeffs   points to the coefficients.
+* @param[in]     numTaps    number of filter coefficients.
+* @param[in]     *pState    points to the oldest state sample of the first sample of the block.
+* @param[in]     *pErr      points to the errors of the block.
+* @param[in]     blockSize  number of samples of the block.
+* @param[in]     mu         step size, in 1.15 format.
+* @return none.
+*
+* Every coefficient is updated once with the gradient of the whole block:
+* <pre>
+*     b[k] = b[k] + mu * (e[0] * x[k] + e[1] * x[k+1] + ... + e[blockSize-1] * x[k+blockSize-1])
+* </pre>
+* The gradient is accumulated in 64 bits and the update is saturated to 1.15 format.
+* In the DSP build four coefficients are updated at a time so that every error pair is loaded once for four taps.
+* This function is also used by riscv_lms_norm_block_q15().
+*/
+
+void riscv_lms_block_update_q15(
+  q15_t * pCoeffs,
+  uint32_t numTaps,
+  const q15_t * pState,
+  const q15_t * pErr,
+  uint32_t blockSize,
+  q15_t mu)
+{
+  RISCV_PROFILE(riscv_lms_block_update_q15);
+  const q15_t *px, *pe;                          /* Temporary pointers for state and error buffers */
+  q63_t acc0;                                    /* Gradient */
+  uint32_t k = 0u, n;                            /* Loop counters */
+#if defined (USE_DSP_RISCV)
+  q63_t acc1, acc2, acc3;                        /* Gradients of the other three taps */
+  shortV e;                                      /* Error pair */
+
+  for (; (k + 4u) <= numTaps; k += 4u)
+  {
+    px = pState + k;
+    pe = pErr;
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+    for (n = blockSize >> 1u; n > 0u; n--)
+    {
+      e = *(shortV *) pe;
+      pe += 2;
+
+      acc0 += dotpv2(*(shortV *) px, e);
+      acc1 += dotpv2(*(shortV *) (px + 1), e);
+      acc2 += dotpv2(*(shortV *) (px + 2), e);
+      acc3 += dotpv2(*(shortV *) (px + 3), e);
+      px += 2;
+    }
+
+    if((blockSize & 1u) != 0u)
+    {
+      acc0 += (q31_t) px[0] * *pe;
+      acc1 += (q31_t) px[1] * *pe;
+      acc2 += (q31_t) px[2] * *pe;
+      acc3 += (q31_t) px[3] * *pe;
+    }
+
+    pCoeffs[k] = riscv_lms_block_step_q15(pCoeffs[k], acc0, mu);
+    pCoeffs[k + 1u] = riscv_lms_block_step_q15(pCoeffs[k + 1u], acc1, mu);
+    pCoeffs[k + 2u] = riscv_lms_block_step_q15(pCoeffs[k + 2u], acc2, mu);
+    pCoeffs[k + 3u] = riscv_lms_block_step_q15(pCoeffs[k + 3u], acc3, mu);
+  }
+
+#endif
+
+  /* Remaining taps, one at a time */
+  for (; k < numTaps; k++)
+  {
+    px = pState + k;
+    pe = pErr;
+    acc0 = 0;
+
+    for (n = blockSize; n > 0u; n--)
+    {
+      acc0 += (q31_t) (*px++) * (*pe++);
+    }
+
+    pCoeffs[k] = riscv_lms_block_step_q15(pCoeffs[k], acc0, mu);
+  }
+}
+
+/**
+ * @brief Processing function for the Q15 block LMS filter.
+ * @param[in] *S points to an instance of the Q15 LMS filter structure, initialized with riscv_lms_init_q15().
+ * @param[in] *pSrc points to the block of input data.
+ * @param[in] *pRef points to the block of reference data.
+ * @param[out] *pOut points to the block of output data.
+ * @param[out] *pErr points to the block of error data.
+ * @param[in] blockSize number of samples to process, at most the <code>blockSize</code> given to riscv_lms_init_q15().
+ * @return none.
+ *
+ * \par
+ * riscv_lms_q15() updates the coefficients after every sample and walks the coefficients twice per sample.
+ * The block LMS filter computes the outputs and errors of the whole block with the same coefficients and then
+ * updates every coefficient once with the gradient accumulated over the block, see riscv_lms_block_update_q15().
+ * Each call is one block, so the update rate is chosen with <code>blockSize</code>.
+ * For the same <code>mu</code> the block filter adapts <code>blockSize</code> times slower per sample and
+ * tolerates a step size up to <code>blockSize</code> times larger.
+ *
+ * \par Scaling and Overflow Behavior:
+ * The output is computed as in riscv_lms_q15(), with a 64-bit accumulator truncated by <code>15-postShift</code>
+ * bits and saturated to 1.15 format.  The gradient is accumulated in 64 bits, scaled by <code>mu</code> and
+ * the updated coefficients are saturated to 1.15 format.
+ */
+
+void riscv_lms_block_q15(
+  const riscv_lms_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pRef,
+  q15_t * pOut,
+  q15_t * pErr,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_lms_block_q15);
+  q15_t *pState = S->pState;                     /* State pointer */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t i;                                    /* Loop counter */
+
+  /* Append the new block to the previous numTaps - 1 samples */
+  for (i = 0u; i < blockSize; i++)
+  {
+    pState[(numTaps - 1u) + i] = pSrc[i];
+  }
+
+  /* Outputs of the block with the current coefficients */
+  riscv_lms_block_filter_q15(S->pCoeffs, numTaps, pState, pOut, blockSize, S->postShift);
+
+  /* Compute and store error */
+  for (i = 0u; i < blockSize; i++)
+  {
+    pErr[i] = pRef[i] - pOut[i];
+  }
+
+  /* One coefficient update for the whole block */
+  riscv_lms_block_update_q15(S->pCoeffs, numTaps, pState, pErr, blockSize, S->mu);
+
+  /* Keep the last numTaps - 1 samples for the next call */
+  for (i = 0u; i < (numTaps - 1u); i++)
+  {
+    pState[i] = pState[i + blockSize];
+  }
+}
+
+/**
+ * @} end of LMS group
+ */
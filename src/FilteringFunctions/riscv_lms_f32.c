@@ -188,6 +188,7 @@ void riscv_lms_f32(
   float32_t * pErr,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_lms_f32);
   float32_t *pState = S->pState;                 /* State pointer */
   float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
   float32_t *pStateCurnt;                        /* Points to the current sample of the state */
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_lms_fdaf_f32.c
+*
+* Description:  Floating-point frequency-domain block LMS filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LMS
+ * @{
+ */
+
+/**
+* @brief  Processing function for the floating-point frequency-domain LMS filter.
+* @param[in,out] *S          points to an instance of the floating-point frequency-domain LMS filter structure.
+* @param[in]     *pSrc       points to the block of input data.
+* @param[in]     *pRef       points to the block of reference data.
+* @param[out]    *pOut       points to the block of output data.
+* @param[out]    *pErr       points to the block of error data.
+* @param[in]     blockSize   number of samples to process, a multiple of <code>numTaps</code>.
+* @return none.
+*
+* \par Description:
+* The filter is a constrained frequency-domain adaptive filter (FDAF) with the block length equal to
+* <code>numTaps</code> and real FFTs of <code>2*numTaps</code> points.  For every block of <code>numTaps</code> samples:
+* <pre>
+*    X    = FFT of the last 2*numTaps input samples
+*    y    = last numTaps samples of IFFT(X * W)                     (overlap-save filter)
+*    e    = d - y
+*    E    = FFT of {numTaps zeros, e}
+*    P[k] = beta * P[k] + (1 - beta) * |X[k]|^2
+*    g    = first numTaps samples of IFFT(conj(X) * E * mu / (P + delta))
+*    W    = W + FFT of {g, numTaps zeros}                          (gradient constraint)
+* </pre>
+* The coefficients are only updated once per block, so for the same <code>mu</code> the filter converges
+* like a block LMS filter, while the per-bin power normalization makes the convergence of the bins independent
+* of the input spectrum.  <code>delta</code> keeps the step finite for silent bins and is <code>2*numTaps*1e-6</code>,
+* the power of a white input at -60 dB full scale.
+* \par
+* The cost per sample is five real FFTs of <code>2*numTaps</code> points divided by <code>numTaps</code>,
+* against <code>2*numTaps</code> multiply-accumulates of riscv_lms_f32(), which makes the function faster
+* from a few tens of taps upwards.
+*/
+
+void riscv_lms_fdaf_f32(
+  riscv_lms_fdaf_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_lms_fdaf_f32);
+  uint32_t N = S->numTaps;                       /* Block length */
+  uint32_t fftLen = 2u * N;                      /* Length of the real FFT */
+  float32_t *pW = S->pState;                     /* Weight spectrum */
+  float32_t *pX = pW + fftLen;                   /* Input spectrum */
+  float32_t *pIn = pX + fftLen;                  /* Last 2*N input samples */
+  float32_t *pA = pIn + fftLen;                  /* Work buffers */
+  float32_t *pB = pA + fftLen;
+  float32_t *pP = pB + fftLen;                   /* Power estimate of bins 0..N */
+  float32_t mu = S->mu;                          /* Adaptive factor */
+  float32_t beta = S->beta;                      /* Smoothing factor of the power estimate */
+  float32_t alpha = 1.0f - beta;
+  float32_t delta = (float32_t) fftLen * 1.0e-6f;  /* Regularization of the step */
+  float32_t xr, xi, er, ei, w;                   /* Temporary variables */
+  uint32_t blkCnt, i, k;                         /* Loop counters */
+
+  for (blkCnt = blockSize / N; blkCnt > 0u; blkCnt--)
+  {
+    /*  Spectrum of the last 2*N input samples, the real FFT overwrites its input */
+    riscv_copy_f32(pSrc, pIn + N, N);
+    riscv_copy_f32(pIn, pA, fftLen);
+    riscv_rfft_fast_f32(&S->Srfft, pA, pX, 0u);
+
+    /*  Y = X * W, DC and Nyquist bins are real and packed in the first pair */
+    riscv_cmplx_mult_cmplx_f32(pX, pW, pA, N);
+    pA[0] = pX[0] * pW[0];
+    pA[1] = pX[1] * pW[1];
+    riscv_rfft_fast_f32(&S->Srfft, pA, pB, 1u);
+
+    /*  Overlap-save: the second half is the output */
+    for (i = 0u; i < N; i++)
+    {
+      pOut[i] = pB[N + i];
+      pErr[i] = pRef[i] - pB[N + i];
+    }
+
+    /*  Spectrum of the error, preceded by N zeros */
+    riscv_fill_f32(0.0f, pA, N);
+    riscv_copy_f32(pErr, pA + N, N);
+    riscv_rfft_fast_f32(&S->Srfft, pA, pB, 0u);
+
+    /*  Normalized gradient mu * conj(X) * E / (P + delta) */
+    xr = pX[0];
+    xi = pX[1];
+    pP[0] = (beta * pP[0]) + (alpha * (xr * xr));
+    pP[N] = (beta * pP[N]) + (alpha * (xi * xi));
+    pA[0] = (mu * xr * pB[0]) / (pP[0] + delta);
+    pA[1] = (mu * xi * pB[1]) / (pP[N] + delta);
+
+    for (k = 1u; k < N; k++)
+    {
+      xr = pX[2u * k];
+      xi = pX[(2u * k) + 1u];
+      er = pB[2u * k];
+      ei = pB[(2u * k) + 1u];
+
+      pP[k] = (beta * pP[k]) + (alpha * ((xr * xr) + (xi * xi)));
+      w = mu / (pP[k] + delta);
+
+      pA[2u * k] = ((xr * er) + (xi * ei)) * w;
+      pA[(2u * k) + 1u] = ((xr * ei) - (xi * er)) * w;
+    }
+
+    /*  Constrain the gradient to N taps and add it to the weights */
+    riscv_rfft_fast_f32(&S->Srfft, pA, pB, 1u);
+    riscv_fill_f32(0.0f, pB + N, N);
+    riscv_rfft_fast_f32(&S->Srfft, pB, pA, 0u);
+    riscv_add_f32(pW, pA, pW, fftLen);
+
+    /*  Keep the new samples for the next block */
+    riscv_copy_f32(pIn + N, pIn, N);
+
+    pSrc += N;
+    pRef += N;
+    pOut += N;
+    pErr += N;
+  }
+}
+
+/**
+* @} end of LMS group
+*/
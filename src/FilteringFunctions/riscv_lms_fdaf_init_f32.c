@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_lms_fdaf_init_f32.c
+*
+* Description:  Initialization function for the floating-point
+*               frequency-domain block LMS filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LMS
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point frequency-domain LMS filter.
+* @param[in,out] *S         points to an instance of the floating-point frequency-domain LMS filter structure.
+* @param[in]     numTaps    number of filter coefficients and block length, a power of two from 16 to 2048.
+* @param[in]     *pCoeffs   points to the initial filter coefficients, in the order of riscv_lms_init_f32().
+* @param[in]     *pState    points to the state buffer.
+* @param[in]     mu         step size that controls filter coefficient updates.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>numTaps</code> is not supported.
+*
+* <b>Description:</b>
+* \par
+* <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+* <pre>
+*    {b[numTaps-1], b[numTaps-2], ..., b[1], b[0]}
+* </pre>
+* Their spectrum is stored in <code>pState</code> and adapted there, so <code>pCoeffs</code> is not used
+* after the initialization.  The time-domain coefficients are the first <code>numTaps</code> samples of
+* the inverse real FFT of the first <code>2*numTaps</code> words of <code>pState</code>.
+* \par
+* <code>pState</code> is of length <code>11*numTaps+1</code> words and holds the weight spectrum, the input
+* spectrum, the last <code>2*numTaps</code> input samples, two work buffers and the power estimate.
+* The input and the power estimate are cleared.
+* \par
+* The smoothing factor <code>beta</code> of the power estimate is set to 0.9 and may be changed in the
+* instance after the initialization.
+*/
+
+riscv_status riscv_lms_fdaf_init_f32(
+  riscv_lms_fdaf_instance_f32 * S,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t mu)
+{
+  RISCV_PROFILE(riscv_lms_fdaf_init_f32);
+  uint32_t fftLen = 2u * (uint32_t) numTaps;     /* Length of the real FFT */
+  float32_t *pIn, *pA;                           /* Input and work buffer */
+  uint32_t i;
+  riscv_status status;
+
+  if((numTaps < 16u) || (numTaps > 2048u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  The real FFT init rejects the lengths that are not a power of two */
+  status = riscv_rfft_fast_init_f32(&S->Srfft, (uint16_t) fftLen);
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numTaps = numTaps;
+  S->mu = mu;
+  S->beta = 0.9f;
+  S->pState = pState;
+
+  pIn = pState + (2u * fftLen);
+  pA = pIn + fftLen;
+
+  /*  Spectrum of b[0] ... b[numTaps-1], zero padded to fftLen */
+  for (i = 0u; i < numTaps; i++)
+  {
+    pA[i] = pCoeffs[numTaps - 1u - i];
+  }
+  riscv_fill_f32(0.0f, pA + numTaps, numTaps);
+
+  riscv_rfft_fast_f32(&S->Srfft, pA, pState, 0u);
+
+  /*  Clear the input and the power estimate */
+  riscv_fill_f32(0.0f, pIn, fftLen);
+  riscv_fill_f32(0.0f, pA + (2u * fftLen), numTaps + 1u);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of LMS group
+*/
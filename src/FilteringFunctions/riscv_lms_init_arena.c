@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_lms_init_arena.c
+*
+* Description:  LMS filter instances with the state buffer taken from
+*               an arena.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LMS
+ * @{
+ */
+
+/**
+ * @brief  Size of the state buffer of the floating-point LMS filter.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+ */
+
+uint32_t riscv_lms_get_buffer_size_f32(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  return (RISCV_DSP_ARENA_ROUND(((uint32_t) numTaps + blockSize - 1u) * sizeof(float32_t)));
+}
+
+/**
+ * @brief  Initialization function for the floating-point LMS filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the floating-point LMS filter structure.
+ * @param[in]     numTaps   number of filter coefficients.
+ * @param[in]     *pCoeffs  points to the coefficient buffer.
+ * @param[in]     mu        step size that controls filter coefficient updates.
+ * @param[in]     blockSize number of samples processed per call.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_lms_get_buffer_size_f32() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_lms_init_arena_f32(
+  riscv_lms_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t mu,
+  uint32_t blockSize,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_lms_init_arena_f32);
+  float32_t *pState = (float32_t *) riscv_dsp_arena_alloc(pArena, riscv_lms_get_buffer_size_f32(numTaps, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_lms_init_f32(S, numTaps, pCoeffs, pState, mu, blockSize);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q31 LMS filter.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+ */
+
+uint32_t riscv_lms_get_buffer_size_q31(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  return (RISCV_DSP_ARENA_ROUND(((uint32_t) numTaps + blockSize - 1u) * sizeof(q31_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q31 LMS filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q31 LMS filter structure.
+ * @param[in]     numTaps   number of filter coefficients.
+ * @param[in]     *pCoeffs  points to the coefficient buffer.
+ * @param[in]     mu        step size that controls filter coefficient updates.
+ * @param[in]     blockSize number of samples processed per call.
+ * @param[in]     postShift bit shift applied to coefficients.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_lms_get_buffer_size_q31() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_lms_init_arena_q31(
+  riscv_lms_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t mu,
+  uint32_t blockSize,
+  uint32_t postShift,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_lms_init_arena_q31);
+  q31_t *pState = (q31_t *) riscv_dsp_arena_alloc(pArena, riscv_lms_get_buffer_size_q31(numTaps, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_lms_init_q31(S, numTaps, pCoeffs, pState, mu, blockSize, postShift);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Size of the state buffer of the Q15 LMS filter.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     bytes the state takes from the arena, <code>numTaps+blockSize-1</code> samples.
+ */
+
+uint32_t riscv_lms_get_buffer_size_q15(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  return (RISCV_DSP_ARENA_ROUND(((uint32_t) numTaps + blockSize - 1u) * sizeof(q15_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q15 LMS filter with the state taken from an arena.
+ * @param[out]    *S        points to an instance of the Q15 LMS filter structure.
+ * @param[in]     numTaps   number of filter coefficients.
+ * @param[in]     *pCoeffs  points to the coefficient buffer.
+ * @param[in]     mu        step size that controls filter coefficient updates.
+ * @param[in]     blockSize number of samples processed per call.
+ * @param[in]     postShift bit shift applied to coefficients.
+ * @param[in,out] *pArena   points to the arena the state buffer is taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena has less than riscv_lms_get_buffer_size_q15() bytes free,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_lms_init_arena_q15(
+  riscv_lms_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t mu,
+  uint32_t blockSize,
+  uint32_t postShift,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_lms_init_arena_q15);
+  q15_t *pState = (q15_t *) riscv_dsp_arena_alloc(pArena, riscv_lms_get_buffer_size_q15(numTaps, blockSize));
+
+  if(pState == NULL)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  riscv_lms_init_q15(S, numTaps, pCoeffs, pState, mu, blockSize, postShift);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of LMS group
+ */
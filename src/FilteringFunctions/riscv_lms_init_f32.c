@@ -76,6 +76,7 @@ void riscv_lms_init_f32(
   float32_t mu,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_lms_init_f32);
   /* Assign filter taps */
   S->numTaps = numTaps;
 
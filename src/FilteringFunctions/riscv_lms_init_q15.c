@@ -82,6 +82,7 @@ void riscv_lms_init_q15(
   uint32_t blockSize,
   uint32_t postShift)
 {
+  RISCV_PROFILE(riscv_lms_init_q15);
   /* Assign filter taps */
   S->numTaps = numTaps;
 
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_lms_norm_block_q15.c
+*
+* Description:  Processing function for the Q15 block normalized LMS filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LMS_NORM
+ * @{
+ */
+
+/**
+* @brief Processing function for the Q15 block normalized LMS filter.
+* @param[in,out] *S points to an instance of the Q15 normalized LMS filter structure, initialized with riscv_lms_norm_init_q15().
+* @param[in] *pSrc points to the block of input data.
+* @param[in] *pRef points to the block of reference data.
+* @param[out] *pOut points to the block of output data.
+* @param[out] *pErr points to the block of error data.
+* @param[in] blockSize number of samples to process, at most the <code>blockSize</code> given to riscv_lms_norm_init_q15().
+* @return none.
+*
+* \par
+* The block variant of riscv_lms_norm_q15(), in the same way as riscv_lms_block_q15() is the block variant of riscv_lms_q15().
+* The outputs and errors of the whole block are computed with the same coefficients, then every coefficient is updated once
+* with the gradient of the block and the step size
+* <pre>
+*     mu / (energy + DELTA_Q15)
+* </pre>
+* where <code>energy</code> is the energy of the last <code>numTaps</code> input samples at the end of the block.
+* The energy is tracked sample by sample as in riscv_lms_norm_q15(), so both functions can be mixed on one instance.
+*
+* <b>Scaling and Overflow Behavior:</b>
+* \par
+* The output is computed as in riscv_lms_norm_q15(), with a 64-bit accumulator truncated to 1.15 format and saturated.
+* The normalized step size is saturated to 1.15 format, the gradient is accumulated in 64 bits and the updated
+* coefficients are saturated to 1.15 format.
+*/
+
+void riscv_lms_norm_block_q15(
+  riscv_lms_norm_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pRef,
+  q15_t * pOut,
+  q15_t * pErr,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_lms_norm_block_q15);
+  q15_t *pState = S->pState;                     /* State pointer */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  q31_t energy = S->energy;                      /* Energy of the input */
+  q15_t x0 = S->x0;                              /* Oldest sample of the energy window */
+  q15_t in;                                      /* Input sample */
+  q15_t oneByEnergy;                             /* Reciprocal of energy */
+  q15_t postShift;                               /* Post shift to be applied to weight after reciprocal calculation */
+  q15_t w;                                       /* Normalized step size */
+  uint32_t i;                                    /* Loop counter */
+
+  /* Append the new block to the previous numTaps - 1 samples and update the energy calculation */
+  for (i = 0u; i < blockSize; i++)
+  {
+    in = pSrc[i];
+    pState[(numTaps - 1u) + i] = in;
+
+    energy -= (((q31_t) x0 * (x0)) >> 15);
+    energy += (((q31_t) in * (in)) >> 15);
+
+    x0 = pState[i];
+  }
+
+  /* Outputs of the block with the current coefficients */
+  riscv_lms_block_filter_q15(S->pCoeffs, numTaps, pState, pOut, blockSize, S->postShift);
+
+  /* Compute and store error */
+  for (i = 0u; i < blockSize; i++)
+  {
+    pErr[i] = pRef[i] - pOut[i];
+  }
+
+  /* Calculation of mu * (1/energy) value */
+  postShift = riscv_recip_q15((q15_t) energy + DELTA_Q15, &oneByEnergy, S->recipTable);
+  w = (q15_t) __SSAT(((q31_t) S->mu * oneByEnergy) >> (15 - postShift), 16);
+
+  /* One coefficient update for the whole block */
+  riscv_lms_block_update_q15(S->pCoeffs, numTaps, pState, pErr, blockSize, w);
+
+  /* Save energy and x0 values for the next frame */
+  S->energy = (q15_t) energy;
+  S->x0 = x0;
+
+  /* Keep the last numTaps - 1 samples for the next call */
+  for (i = 0u; i < (numTaps - 1u); i++)
+  {
+    pState[i] = pState[i + blockSize];
+  }
+}
+
+/**
+ * @} end of LMS_NORM group
+ */
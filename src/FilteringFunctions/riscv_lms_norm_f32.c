@@ -180,6 +180,7 @@ void riscv_lms_norm_f32(
   float32_t * pErr,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_lms_norm_f32);
   float32_t *pState = S->pState;                 /* State pointer */
   float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
   float32_t *pStateCurnt;                        /* Points to the current sample of the state */
@@ -80,6 +80,7 @@ void riscv_lms_norm_init_q15(
   uint32_t blockSize,
   uint8_t postShift)
 {
+  RISCV_PROFILE(riscv_lms_norm_init_q15);
   /* Assign filter taps */
   S->numTaps = numTaps;
 
@@ -79,6 +79,7 @@ void riscv_lms_norm_init_q31(
   uint32_t blockSize,
   uint8_t postShift)
 {
+  RISCV_PROFILE(riscv_lms_norm_init_q31);
   /* Assign filter taps */
   S->numTaps = numTaps;
 
@@ -86,6 +86,7 @@ void riscv_lms_norm_q15(
   q15_t * pErr,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_lms_norm_q15);
   q15_t *pState = S->pState;                     /* State pointer */
   q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
   q15_t *pStateCurnt;                            /* Points to the current sample of the state */
@@ -277,7 +278,7 @@ void riscv_lms_norm_q15(
     *(shortV*)pStateCurnt = *(shortV*)pState;
     *(shortV*)(pStateCurnt+2) = *(shortV*)(pState+2);
     pStateCurnt+=4;
-    pStateCurnt+=4;
+    pState+=4;
     tapCnt--;
 
   }
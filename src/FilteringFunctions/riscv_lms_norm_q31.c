@@ -87,6 +87,7 @@ void riscv_lms_norm_q31(
   q31_t * pErr,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_lms_norm_q31);
   q31_t *pState = S->pState;                     /* State pointer */
   q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
   q31_t *pStateCurnt;                            /* Points to the current sample of the state */
@@ -117,9 +118,114 @@ void riscv_lms_norm_q31(
   /* Loop over blockSize number of values */
   blkCnt = blockSize;
 
+#if defined (USE_DSP_RISCV)
 
+  /* The filter pass of a sample is fused with the coefficient update of the previous one:
+   * each coefficient is multiplied with x[n+1+k] right after it is updated with x[n+k], so
+   * pCoeffs and pState are swept once per sample instead of twice.  The coefficients and the
+   * accumulators take the same values as in two passes, so do the outputs. */
+  if(blkCnt > 0u)
+  {
+    /* Copy the new input sample into the state buffer */
+    *pStateCurnt++ = *pSrc;
+
+    /* Read the sample from input buffer */
+    in = *pSrc++;
+
+    /* Update the energy calculation */
+    energy = (q31_t) ((((q63_t) energy << 32) -
+                       (((q63_t) x0 * x0) << 1)) >> 32);
+    energy = (q31_t) (((((q63_t) in * in) << 1) + (energy << 32)) >> 32);
+
+    px = pState;
+    pb = pCoeffs;
+    acc = 0;
+
+    tapCnt = numTaps;
+
+    while (tapCnt > 0u)
+    {
+      acc += ((q63_t) (*px++)) * (*pb++);
+
+      tapCnt--;
+    }
+  }
+
+  while (blkCnt > 0u)
+  {
+    /* Converting the result to 1.31 format */
+    acc_l = acc & 0xffffffff;
+    acc_h = (acc >> 32) & 0xffffffff;
+    acc = (uint32_t) acc_l >> lShift | acc_h << uShift;
+
+    /* Store the result from accumulator into the destination buffer. */
+    *pOut++ = (q31_t) acc;
+
+    /* Compute and store error */
+    d = *pRef++;
+
+    e = d - (q31_t) acc;
+    *pErr++ = e;
+
+    /* Calculates the reciprocal of energy */
+    postShift = riscv_recip_q31(energy + DELTA_Q31,
+                              &oneByEnergy, &S->recipTable[0]);
+    /* Calculation of product of (e * mu) */
+    errorXmu = (q31_t) (((q63_t) e * mu) >> 31);
+    /* Weighting factor for the normalized version */
+    w = clip_q63_to_q31(((q63_t) errorXmu * oneByEnergy) >> (31 - postShift));
+
+    px = pState;
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+
+    /* Read the sample leaving the state, advance state pointer by 1 for the next sample */
+    x0 = *pState;
+    pState = pState + 1;
+
+    blkCnt--;
+
+    if(blkCnt > 0u)
+    {
+      /* Copy the next input sample into the state buffer */
+      *pStateCurnt++ = *pSrc;
+
+      in = *pSrc++;
+
+      energy = (q31_t) ((((q63_t) energy << 32) -
+                         (((q63_t) x0 * x0) << 1)) >> 32);
+      energy = (q31_t) (((((q63_t) in * in) << 1) + (energy << 32)) >> 32);
+
+      acc = 0;
 
-  /* Run the below code for Cortex-M4 and Cortex-M3 */
+      while (tapCnt > 0u)
+      {
+        /* Update b[k] with x[n+k], then px points to x[n+1+k] */
+        coef = (q31_t) (((q63_t) w * (*px++)) >> (32));
+        coef = clip_q63_to_q31((q63_t) * pb + (coef << 1u));
+        *pb++ = coef;
+
+        acc += ((q63_t) (*px)) * coef;
+
+        tapCnt--;
+      }
+    }
+    else
+    {
+      /* Update only, after the last sample of the block */
+      while (tapCnt > 0u)
+      {
+        coef = (q31_t) (((q63_t) w * (*px++)) >> (32));
+        *pb = clip_q63_to_q31((q63_t) * pb + (coef << 1u));
+        pb++;
+
+        tapCnt--;
+      }
+    }
+  }
+
+#else
 
   while (blkCnt > 0u)
   {
@@ -258,6 +364,8 @@ void riscv_lms_norm_q31(
     blkCnt--;
   }
 
+#endif /* #if defined (USE_DSP_RISCV) */
+
   /* Save energy and x0 values for the next frame */
   S->energy = (q31_t) energy;
   S->x0 = x0;
@@ -81,6 +81,7 @@ void riscv_lms_q15(
   q15_t * pErr,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_lms_q15);
   q15_t *pState = S->pState;                     /* State pointer */
   uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
   q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
@@ -237,7 +238,7 @@ void riscv_lms_q15(
     *(shortV*)pStateCurnt = *(shortV*)pState;
     *(shortV*)(pStateCurnt+2) = *(shortV*)(pState+2);
     pStateCurnt+=4;
-    pStateCurnt+=4;
+    pState+=4;
     tapCnt--;
 
   }
@@ -84,6 +84,7 @@ void riscv_lms_q31(
   q31_t * pErr,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_lms_q31);
   q31_t *pState = S->pState;                     /* State pointer */
   uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
   q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
@@ -107,6 +108,89 @@ void riscv_lms_q31(
   /* Initializing blkCnt with blockSize */
   blkCnt = blockSize;
 
+#if defined (USE_DSP_RISCV)
+
+  /* The filter pass of a sample is fused with the coefficient update of the previous one:
+   * each coefficient is multiplied with x[n+1+k] right after it is updated with x[n+k], so
+   * pCoeffs and pState are swept once per sample instead of twice.  The coefficients and the
+   * accumulators take the same values as in two passes, so do the outputs. */
+  if(blkCnt > 0u)
+  {
+    /* Copy the new input sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    px = pState;
+    pb = pCoeffs;
+    acc = 0;
+
+    tapCnt = numTaps;
+
+    while(tapCnt > 0u)
+    {
+      acc += ((q63_t) (*px++)) * (*pb++);
+
+      tapCnt--;
+    }
+  }
+
+  while(blkCnt > 0u)
+  {
+    /* Converting the result to 1.31 format */
+    acc_l = acc & 0xffffffff;
+    acc_h = (acc >> 32) & 0xffffffff;
+    acc = (uint32_t) acc_l >> lShift | acc_h << uShift;
+    *pOut++ = (q31_t) acc;
+
+    /* Compute and store error */
+    e = *pRef++ - (q31_t) acc;
+
+    *pErr++ = (q31_t) e;
+
+    /* Weighting factor for the LMS version */
+    alpha = (q31_t) (((q63_t) e * mu) >> 31);
+
+    /* Advance state pointer by 1 for the next sample */
+    px = pState++;
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+
+    blkCnt--;
+
+    if(blkCnt > 0u)
+    {
+      /* Copy the next input sample into the state buffer */
+      *pStateCurnt++ = *pSrc++;
+
+      acc = 0;
+
+      while(tapCnt > 0u)
+      {
+        /* Update b[k] with x[n+k], then px points to x[n+1+k] */
+        coef = (q31_t) (((q63_t) alpha * (*px++)) >> (32));
+        coef = clip_q63_to_q31((q63_t) * pb + (coef << 1u));
+        *pb++ = coef;
+
+        acc += ((q63_t) (*px)) * coef;
+
+        tapCnt--;
+      }
+    }
+    else
+    {
+      /* Update only, after the last sample of the block */
+      while(tapCnt > 0u)
+      {
+        coef = (q31_t) (((q63_t) alpha * (*px++)) >> (32));
+        *pb = clip_q63_to_q31((q63_t) * pb + (coef << 1u));
+        pb++;
+
+        tapCnt--;
+      }
+    }
+  }
+
+#else
 
   while(blkCnt > 0u)
   {
@@ -176,6 +260,8 @@ void riscv_lms_q31(
     blkCnt--;
   }
 
+#endif /* #if defined (USE_DSP_RISCV) */
+
   /* Processing is complete. Now copy the last numTaps - 1 samples to the     
      start of the state buffer. This prepares the state buffer for the   
      next function call. */
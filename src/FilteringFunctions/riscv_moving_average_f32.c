@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_moving_average_f32.c
+*
+* Description:  Floating-point moving average filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup MovingAverage Moving Average
+ *
+ * Output <code>n</code> is the mean of the last <code>windowLength</code> input samples
+ * <pre>
+ *     y[n] = (x[n] + x[n-1] + ... + x[n-windowLength+1]) / windowLength
+ * </pre>
+ * the boxcar FIR filter, with the samples before the first call zero.  Instead of
+ * <code>windowLength</code> MACs per sample the filter keeps the sum of the window and the window
+ * itself in the circular buffer <code>pState</code>: every sample is added to the sum and the sample
+ * it replaces in the buffer subtracted, so the cost does not depend on <code>windowLength</code>.
+ * \par
+ * The Q15 and Q31 sums are exact, in 32 and 64 bits, and do not drift however long the filter runs.
+ * The mean is the sum times a reciprocal of <code>windowLength</code> computed by the initialization
+ * function, rounded to within one LSB.  The floating-point sum is computed again from the window
+ * every time the buffer wraps, which bounds the rounding error that adding and subtracting leaves.
+ */
+
+/**
+ * @addtogroup MovingAverage
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point moving average filter.
+ * @param[in,out] *S         points to an instance of the floating-point moving average structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void riscv_moving_average_f32(
+  riscv_moving_average_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_moving_average_f32);
+  float32_t *pState = S->pState;                 /* Window samples */
+  uint32_t winLen = S->windowLength;             /* Window length */
+  uint32_t slot = S->stateIndex;                 /* Slot of the oldest sample */
+  float32_t sum = S->sum;                        /* Sum of the window */
+  float32_t recip = S->recip;                    /* 1/windowLength */
+  float32_t in;
+  uint32_t i, blkCnt;
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    /* Replace the oldest sample in the sum and the window */
+    in = *pSrc++;
+    sum += in - pState[slot];
+    pState[slot] = in;
+    *pDst++ = sum * recip;
+
+    slot++;
+    if(slot == winLen)
+    {
+      slot = 0u;
+
+      /* Sum the window again, the running sum only carries rounding error */
+      for (i = 0u, sum = 0.0f; i < winLen; i++)
+      {
+        sum += pState[i];
+      }
+    }
+  }
+
+  S->stateIndex = (uint16_t) slot;
+  S->sum = sum;
+}
+
+/**
+ * @} end of MovingAverage group
+ */
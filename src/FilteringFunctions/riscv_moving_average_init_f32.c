@@ -0,0 +1,57 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_moving_average_init_f32.c
+*
+* Description:  Initialization function for the floating-point moving average filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MovingAverage
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point moving average filter.
+ * @param[out]    *S             points to an instance of the floating-point moving average structure.
+ * @param[in]     windowLength   number of samples in the window.
+ * @param[in]     *pState        points to the window buffer of <code>windowLength</code> values.
+ * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR if <code>windowLength</code> is 0.
+ *
+ * \par
+ * The window and its sum are cleared to zero, as the state of riscv_fir_f32().
+ */
+
+riscv_status riscv_moving_average_init_f32(
+  riscv_moving_average_instance_f32 * S,
+  uint16_t windowLength,
+  float32_t * pState)
+{
+  RISCV_PROFILE(riscv_moving_average_init_f32);
+
+  if(windowLength == 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  memset(pState, 0, windowLength * sizeof(float32_t));
+
+  S->windowLength = windowLength;
+  S->stateIndex = 0u;
+  S->pState = pState;
+  S->sum = 0.0f;
+  S->recip = 1.0f / (float32_t) windowLength;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MovingAverage group
+ */
@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_moving_average_init_q31.c
+*
+* Description:  Initialization function for the Q31 moving average filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MovingAverage
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 moving average filter.
+ * @param[out]    *S             points to an instance of the Q31 moving average structure.
+ * @param[in]     windowLength   number of samples in the window.
+ * @param[in]     *pState        points to the window buffer of <code>windowLength</code> values.
+ * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR if <code>windowLength</code> is 0.
+ *
+ * \par
+ * The window and its sum are cleared to zero, as the state of riscv_fir_q31().  The reciprocal is
+ * <code>2^postShift/windowLength</code> rounded, with <code>postShift = 31 + ceil(log2(windowLength))</code>
+ * so that it has 32 significant bits for every window length.
+ */
+
+riscv_status riscv_moving_average_init_q31(
+  riscv_moving_average_instance_q31 * S,
+  uint16_t windowLength,
+  q31_t * pState)
+{
+  RISCV_PROFILE(riscv_moving_average_init_q31);
+  uint32_t bits = 0u;
+
+  if(windowLength == 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  memset(pState, 0, windowLength * sizeof(q31_t));
+
+  S->windowLength = windowLength;
+  S->stateIndex = 0u;
+  S->pState = pState;
+
+  /* 2^31 <= recip < 2^32 */
+  while((1u << bits) < windowLength)
+  {
+    bits++;
+  }
+
+  S->sum = 0;
+  S->postShift = (uint8_t) (31u + bits);
+  S->recip = (uint32_t) ((((uint64_t) 1 << S->postShift) + (windowLength >> 1u)) / windowLength);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MovingAverage group
+ */
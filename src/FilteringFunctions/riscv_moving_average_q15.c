@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_moving_average_q15.c
+*
+* Description:  Q15 moving average filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MovingAverage
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 moving average filter.
+ * @param[in,out] *S         points to an instance of the Q15 moving average structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum of up to 65535 samples is exact in a 32-bit accumulator.  It is multiplied by the reciprocal
+ * <code>recip = 2^postShift/windowLength</code> in a 64-bit product, rounded and shifted by
+ * <code>postShift</code> bits, and the result saturates to 1.15 format.
+ */
+
+void riscv_moving_average_q15(
+  riscv_moving_average_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_moving_average_q15);
+  q15_t *pState = S->pState;                     /* Window samples */
+  uint32_t winLen = S->windowLength;             /* Window length */
+  uint32_t slot = S->stateIndex;                 /* Slot of the oldest sample */
+  q31_t sum = S->sum;                            /* Sum of the window */
+  q63_t recip = (q63_t) S->recip;                /* 2^postShift/windowLength */
+  uint32_t postShift = S->postShift;
+  q63_t round = (q63_t) 1 << (postShift - 1u);
+  q15_t in;
+  uint32_t blkCnt;
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    /* Replace the oldest sample in the sum and the window */
+    in = *pSrc++;
+    sum += (q31_t) in - pState[slot];
+    pState[slot] = in;
+    *pDst++ = (q15_t) __SSAT((q31_t) ((((q63_t) sum * recip) + round) >> postShift), 16);
+
+    slot++;
+    if(slot == winLen)
+    {
+      slot = 0u;
+    }
+  }
+
+  S->stateIndex = (uint16_t) slot;
+  S->sum = sum;
+}
+
+/**
+ * @} end of MovingAverage group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_moving_average_q31.c
+*
+* Description:  Q31 moving average filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MovingAverage
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 moving average filter.
+ * @param[in,out] *S         points to an instance of the Q31 moving average structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum of up to 65535 samples is exact in a 64-bit accumulator, below 2^47 in magnitude.  Its
+ * product with the 32-bit reciprocal <code>recip = 2^postShift/windowLength</code> is formed from the
+ * two halves of the sum, 16 bits below the binary point of the exact product are kept for the rounding,
+ * and the result saturates to 1.31 format.
+ */
+
+void riscv_moving_average_q31(
+  riscv_moving_average_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_moving_average_q31);
+  q31_t *pState = S->pState;                     /* Window samples */
+  uint32_t winLen = S->windowLength;             /* Window length */
+  uint32_t slot = S->stateIndex;                 /* Slot of the oldest sample */
+  q63_t sum = S->sum;                            /* Sum of the window */
+  uint64_t recip = S->recip;                     /* 2^postShift/windowLength */
+  uint32_t postShift = S->postShift - 16u;       /* Shift after the 16 bits dropped below */
+  q63_t round = (q63_t) 1 << (postShift - 1u);
+  q63_t acc;
+  q31_t in;
+  uint32_t blkCnt;
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    /* Replace the oldest sample in the sum and the window */
+    in = *pSrc++;
+    sum += (q63_t) in - pState[slot];
+    pState[slot] = in;
+
+    /* (sum*recip)>>16 from the signed upper and unsigned lower word of the sum */
+    acc = ((sum >> 32) * (q63_t) recip) * 65536;
+    acc += (q63_t) ((((uint64_t) (uint32_t) sum) * recip) >> 16);
+    *pDst++ = clip_q63_to_q31((acc + round) >> postShift);
+
+    slot++;
+    if(slot == winLen)
+    {
+      slot = 0u;
+    }
+  }
+
+  S->stateIndex = (uint16_t) slot;
+  S->sum = sum;
+}
+
+/**
+ * @} end of MovingAverage group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pfb_analysis_f32.c
+*
+* Description:  Floating-point polyphase analysis filter bank.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup PFB Polyphase Filter Banks
+ *
+ * Uniform, critically sampled DFT filter banks of <code>M</code> channels in the polyphase
+ * structure.  The analysis bank splits a real signal into <code>M</code> complex channels at
+ * <code>1/M</code> of the input rate, the synthesis bank adds <code>M</code> channels back into a
+ * real signal.  Both derive the channel filters from one real prototype <code>h</code> of
+ * <code>numTaps = M*P</code> taps:
+ * <pre>
+ *    h_k[i] = h[i] * exp(j*2*pi*k*i/M),  k = 0 ... M-1
+ * </pre>
+ * The analysis output <code>n</code> of channel <code>k</code> is the output of
+ * <code>h_k</code> at the last sample of the input block <code>n</code>,
+ * <pre>
+ *    y_k[n] = sum_i h_k[i] * x[n*M + M-1 - i]
+ * </pre>
+ * computed as <code>M</code> branch filters of <code>P</code> taps, one per polyphase component of
+ * <code>h</code>, followed by one transform of length <code>M</code>.  The synthesis bank filters
+ * the channel vectors with <code>g_k[i] = g[i]*exp(j*2*pi*k*(i+1)/M)/M</code>, which gives the
+ * sample <code>r</code> of the output block <code>n</code> as
+ * <pre>
+ *    x'[n*M + r] = sum_q g[q*M + r] * Re(u[n-q][(r+1) mod M]),  u[n] = IDFT(y[n]),  r = 0 ... M-1
+ * </pre>
+ * again with <code>M</code> branch filters after one inverse transform.  With <code>P = 1</code> and
+ * a rectangular prototype of ones the synthesis bank reproduces the input of the analysis bank
+ * block for block, longer prototypes with polyphase components of constant product
+ * <code>E_m(z)*G_m(z)</code> reconstruct it with a delay.
+ * \par
+ * The filter state is the prototype and <code>numTaps</code> samples for the whole bank, rather
+ * than a state of a full-length filter per channel, and each block takes one transform for all
+ * channels.  The analysis bank writes the branch outputs directly into the output block and
+ * transforms it in place, the synthesis bank needs a scratch buffer of <code>2*M</code> values for the
+ * transform so that it does not overwrite its input.  The transforms are riscv_cfft_f32() and
+ * riscv_cfft_q15() with the instance given to the init function, <code>M</code> is its length and
+ * a power of two.
+ * \par
+ * The output block of the analysis bank holds <code>blockSize/M</code> vectors of <code>M</code>
+ * interleaved complex channel values, channel 0 first, the input block of the synthesis bank is of
+ * the same layout.  For a real input the channels <code>k</code> and <code>M-k</code> are complex
+ * conjugates.
+ * \par
+ * The Q15 banks inherit the scaling of riscv_cfft_q15(): the analysis channels are divided by
+ * <code>M</code>, and the synthesis bank, whose inverse transform divides by <code>M</code> as the
+ * definition above does, reconstructs at <code>1/M</code> of the input level.  The branch filters
+ * accumulate in 64 bits and saturate to Q15 before the transform.
+ */
+
+/**
+ * @addtogroup PFB
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point polyphase analysis filter bank.
+ * @param[in]     *S          points to an instance of the floating-point analysis filter bank structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to <code>blockSize/M</code> vectors of M complex channel values.
+ * @param[in]     blockSize   number of input samples to process, a multiple of M.
+ */
+
+void riscv_pfb_analysis_f32(
+  const riscv_pfb_analysis_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_pfb_analysis_f32);
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *pLast;                              /* Latest sample of the window */
+  float32_t acc;                                 /* Accumulator */
+  uint32_t numChannels = S->numChannels;         /* Number of channels M */
+  uint32_t numTaps = S->numTaps;                 /* Length of the prototype filter */
+  uint32_t i, m, p, blkCnt;                      /* Loop counters */
+
+  /* S->pState buffer contains previous frame (numTaps - M) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - numChannels);
+
+  blkCnt = blockSize / numChannels;
+
+  while(blkCnt > 0u)
+  {
+    /* Commutator, M new input samples */
+    i = numChannels;
+    do
+    {
+      *pStateCurnt++ = *pSrc++;
+    } while(--i);
+
+    pLast = pState + (numTaps - 1u);
+
+    /* Branch m filters the samples m, m+M, ... before the latest with the taps m, m+M, ... */
+    for (m = 0u; m < numChannels; m++)
+    {
+      acc = 0.0f;
+      for (p = m; p < numTaps; p += numChannels)
+      {
+        acc += pCoeffs[p] * pLast[-(int32_t) p];
+      }
+
+      /* Branch m goes to the bin -m modulo M, so that the forward transform
+         yields the channel k at the frequency +2*pi*k/M */
+      i = (numChannels - m) & (numChannels - 1u);
+      pDst[2u * i] = acc;
+      pDst[(2u * i) + 1u] = 0.0f;
+    }
+
+    riscv_cfft_f32(S->pCfft, pDst, 0u, 1u);
+
+    pDst += 2u * numChannels;
+
+    /* Advance the state pointer by a block */
+    pState = pState + numChannels;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - M samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  i = numTaps - numChannels;
+
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+}
+
+/**
+ * @} end of PFB group
+ */
@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pfb_analysis_init_f32.c
+*
+* Description:  Initialization function for the floating-point polyphase analysis filter bank.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup PFB
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point polyphase analysis filter bank.
+ * @param[in,out] *S          points to an instance of the floating-point analysis filter bank structure.
+ * @param[in]     *pCfft      points to the transform instance, its length is the number of channels M.
+ * @param[in]     numTaps     length of the prototype filter, a multiple of M.
+ * @param[in]     *pCoeffs    points to the <code>numTaps</code> taps of the prototype filter.
+ * @param[in]     *pState     points to the state buffer of <code>numTaps-M+blockSize</code> samples.
+ * @param[in]     blockSize   number of input samples to process per call, a multiple of M.
+ * @return        RISCV_MATH_SUCCESS, RISCV_MATH_ARGUMENT_ERROR if <code>numTaps</code> is not a nonzero
+ *                multiple of M, or RISCV_MATH_LENGTH_ERROR if <code>blockSize</code> is not a multiple of M.
+ */
+
+riscv_status riscv_pfb_analysis_init_f32(
+  riscv_pfb_analysis_instance_f32 * S,
+  const riscv_cfft_instance_f32 * pCfft,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_pfb_analysis_init_f32);
+  uint32_t numChannels = pCfft->fftLen;
+
+  if((numTaps == 0u) || ((numTaps % numChannels) != 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  if((blockSize % numChannels) != 0u)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  S->numChannels = (uint16_t) numChannels;
+  S->numTaps = numTaps;
+  S->pCoeffs = pCoeffs;
+  S->pCfft = pCfft;
+
+  /* Clear the state buffer, the history of numTaps - M samples and room for a block */
+  memset(pState, 0, ((numTaps - numChannels) + blockSize) * sizeof(float32_t));
+
+  S->pState = pState;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of PFB group
+ */
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pfb_analysis_q15.c
+*
+* Description:  Q15 polyphase analysis filter bank.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup PFB
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 polyphase analysis filter bank.
+ * @param[in]     *S          points to an instance of the Q15 analysis filter bank structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to <code>blockSize/M</code> vectors of M complex channel values.
+ * @param[in]     blockSize   number of input samples to process, a multiple of M.
+ *
+ * \par
+ * The channel values are the Q15 outputs of riscv_cfft_q15(), divided by M.
+ */
+
+void riscv_pfb_analysis_q15(
+  const riscv_pfb_analysis_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_pfb_analysis_q15);
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *pLast;                                  /* Latest sample of the window */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t numChannels = S->numChannels;         /* Number of channels M */
+  uint32_t numTaps = S->numTaps;                 /* Length of the prototype filter */
+  uint32_t i, m, p, blkCnt;                      /* Loop counters */
+
+  /* S->pState buffer contains previous frame (numTaps - M) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - numChannels);
+
+  blkCnt = blockSize / numChannels;
+
+  while(blkCnt > 0u)
+  {
+    /* Commutator, M new input samples */
+    i = numChannels;
+    do
+    {
+      *pStateCurnt++ = *pSrc++;
+    } while(--i);
+
+    pLast = pState + (numTaps - 1u);
+
+    /* Branch m filters the samples m, m+M, ... before the latest with the taps m, m+M, ... */
+    for (m = 0u; m < numChannels; m++)
+    {
+      acc = 0;
+      for (p = m; p < numTaps; p += numChannels)
+      {
+        acc += (q31_t) pCoeffs[p] * pLast[-(int32_t) p];
+      }
+
+      /* Branch m goes to the bin -m modulo M, so that the forward transform
+         yields the channel k at the frequency +2*pi*k/M */
+      i = (numChannels - m) & (numChannels - 1u);
+      pDst[2u * i] = (q15_t) __SSAT((acc >> 15), 16);
+      pDst[(2u * i) + 1u] = 0;
+    }
+
+    riscv_cfft_q15(S->pCfft, pDst, 0u, 1u);
+
+    pDst += 2u * numChannels;
+
+    /* Advance the state pointer by a block */
+    pState = pState + numChannels;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Copy the last numTaps - M samples to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  i = numTaps - numChannels;
+
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+}
+
+/**
+ * @} end of PFB group
+ */
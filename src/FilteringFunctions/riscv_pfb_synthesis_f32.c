@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pfb_synthesis_f32.c
+*
+* Description:  Floating-point polyphase synthesis filter bank.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup PFB
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point polyphase synthesis filter bank.
+ * @param[in,out] *S          points to an instance of the floating-point synthesis filter bank structure.
+ * @param[in]     *pSrc       points to <code>blockSize/M</code> vectors of M complex channel values.
+ * @param[out]    *pDst       points to the block of output samples.
+ * @param[in]     blockSize   number of output samples to compute, a multiple of M.
+ */
+
+void riscv_pfb_synthesis_f32(
+  riscv_pfb_synthesis_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_pfb_synthesis_f32);
+  float32_t *pState = S->pState;                 /* Branch inputs of the last P blocks */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pScratch = S->pScratch;             /* Transform buffer */
+  float32_t *pNew;                               /* Branch inputs of the current block */
+  uint32_t numChannels = S->numChannels;         /* Number of channels M */
+  uint32_t numBlocks = S->numTaps / S->numChannels;  /* Taps P of a branch */
+  uint32_t head = S->head;                       /* Ring slot of the current block */
+  uint32_t slot, q, r, blkCnt;                   /* Loop counters */
+
+  blkCnt = blockSize / numChannels;
+
+  while(blkCnt > 0u)
+  {
+    /* Inverse transform of the channel vector, in the scratch buffer to keep the input */
+    memcpy(pScratch, pSrc, 2u * numChannels * sizeof(float32_t));
+    pSrc += 2u * numChannels;
+
+    riscv_cfft_f32(S->pCfft, pScratch, 1u, 1u);
+
+    /* Real parts are the branch inputs, branch r takes the bin r+1 modulo M.  The
+       imaginary parts cancel when the channels k and M-k are conjugate */
+    pNew = pState + (head * numChannels);
+    for (r = 0u; r < numChannels; r++)
+    {
+      pNew[r] = pScratch[2u * ((r + 1u) & (numChannels - 1u))];
+    }
+
+    /* Branch r filters the inputs of the blocks n, n-1, ... with the taps r, r+M, ... */
+    for (r = 0u; r < numChannels; r++)
+    {
+      pDst[r] = pCoeffs[r] * pNew[r];
+    }
+
+    slot = head;
+    for (q = 1u; q < numBlocks; q++)
+    {
+      slot = (slot == 0u) ? (numBlocks - 1u) : (slot - 1u);
+      for (r = 0u; r < numChannels; r++)
+      {
+        pDst[r] += pCoeffs[(q * numChannels) + r] * pState[(slot * numChannels) + r];
+      }
+    }
+
+    pDst += numChannels;
+
+    /* The next block takes the slot after this one */
+    head = (head + 1u == numBlocks) ? 0u : (head + 1u);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->head = (uint16_t) head;
+}
+
+/**
+ * @} end of PFB group
+ */
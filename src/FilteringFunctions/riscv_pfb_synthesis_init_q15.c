@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pfb_synthesis_init_q15.c
+*
+* Description:  Initialization function for the Q15 polyphase synthesis filter bank.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup PFB
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 polyphase synthesis filter bank.
+ * @param[in,out] *S          points to an instance of the Q15 synthesis filter bank structure.
+ * @param[in]     *pCfft      points to the transform instance, its length is the number of channels M.
+ * @param[in]     numTaps     length of the prototype filter, a multiple of M.
+ * @param[in]     *pCoeffs    points to the <code>numTaps</code> taps of the prototype filter.
+ * @param[in]     *pState     points to the state buffer of <code>numTaps</code> values.
+ * @param[in]     *pScratch   points to a scratch buffer of <code>2*M</code> values.
+ * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>numTaps</code> is not a nonzero
+ *                multiple of M.
+ */
+
+riscv_status riscv_pfb_synthesis_init_q15(
+  riscv_pfb_synthesis_instance_q15 * S,
+  const riscv_cfft_instance_q15 * pCfft,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  q15_t * pScratch)
+{
+  RISCV_PROFILE(riscv_pfb_synthesis_init_q15);
+  uint32_t numChannels = pCfft->fftLen;
+
+  if((numTaps == 0u) || ((numTaps % numChannels) != 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numChannels = (uint16_t) numChannels;
+  S->numTaps = numTaps;
+  S->head = 0u;
+  S->pCoeffs = pCoeffs;
+  S->pScratch = pScratch;
+  S->pCfft = pCfft;
+
+  /* Clear the branch inputs of the last numTaps/M blocks */
+  memset(pState, 0, numTaps * sizeof(q15_t));
+
+  S->pState = pState;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of PFB group
+ */
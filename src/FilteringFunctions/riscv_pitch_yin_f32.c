@@ -0,0 +1,178 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pitch_yin_f32.c
+*
+* Description:  Floating-point YIN pitch estimator with a direct or a real
+*               FFT based difference function.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+extern float32_t * riscv_correlate_fft_core_f32(
+  uint32_t fftLen,
+  float32_t * pScratch);
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup PitchYIN YIN Pitch Estimator
+ *
+ * \par
+ * The YIN estimator finds the period of a frame from the difference function of a window of
+ * <code>windowLen</code> samples and its copy delayed by the lag
+ * <pre>
+ *    d(t) = sum((x[n] - x[n+t])^2, n=0..W-1) = e(0) + e(t) - 2 * r(t)
+ * </pre>
+ * where e(t) is the energy of the window starting at sample t and r(t) the correlation of the two
+ * windows.  The cumulative mean normalized difference <code>d'(t) = t * d(t) / sum(d(1..t))</code> is
+ * 1 on average and dips towards 0 at the multiples of the period.  The period is the first lag from
+ * <code>minLag</code> on where d' is below the threshold, followed down to its local minimum and refined
+ * by a parabola through d at the neighbouring lags.  A frame where d' never falls below the threshold is
+ * unvoiced; the functions return 0 and the smallest d' as its aperiodicity.
+ * \par
+ * A frame is <code>windowLen+maxLag</code> samples.  The range of lags sets the range of pitches,
+ * <code>fs/maxLag</code> to <code>fs/minLag</code>.  d is computed from lag 1 even when
+ * <code>minLag</code> is larger, since the cumulative mean of d' runs over every lag; the lags under
+ * <code>minLag</code> are only excluded from the search.  A threshold from 0.1 to 0.2 is usual.
+ * \par
+ * The energies follow the delayed window with one update per lag, so each lag costs the
+ * <code>windowLen</code> MACs of r(t) only.  The floating-point estimator takes r from one real FFT
+ * correlation when a scratch buffer is given and the window and lag range are long enough for it to
+ * be cheaper, see riscv_pitch_yin_init_f32().  The Q15 estimator computes r directly with the dual
+ * 16-bit dot products, like riscv_autocorr_q15().
+ */
+
+/**
+ * @addtogroup PitchYIN
+ * @{
+ */
+
+/**
+ * @brief Floating-point YIN pitch estimator.
+ * @param[in]  *S              points to an instance of the floating-point YIN structure.
+ * @param[in]  *pSrc           points to the frame of <code>windowLen+maxLag</code> samples.
+ * @param[out] *pAperiodicity  d' at the period, or the smallest d' of an unvoiced frame, may be NULL.
+ * @return the period in samples, with a fractional part, or 0 if the frame is unvoiced.
+ */
+
+float32_t riscv_pitch_yin_f32(
+  const riscv_pitch_yin_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pAperiodicity)
+{
+  RISCV_PROFILE(riscv_pitch_yin_f32);
+  uint32_t windowLen = S->windowLen;             /* Window length */
+  uint32_t maxLag = S->maxLag;                   /* Last lag */
+  uint32_t fftLen = S->fftLen;                   /* Real FFT length, 0 for the direct path */
+  float32_t *pDiff = S->pDiff;                   /* Difference function */
+  float32_t *pScratch = S->pScratch;
+  const float32_t *pR = NULL;                    /* Correlation of the FFT path */
+  float32_t e0, e, r, d;                         /* Energies, correlation and difference */
+  float32_t cum = 0.0f;                          /* Sum of d over the lags so far */
+  float32_t cmnd, next, best = 1.0f;             /* Normalized differences */
+  float32_t dm, dp, den, delta = 0.0f;           /* Parabolic refinement */
+  uint32_t tau, found = 0u;
+
+  riscv_power_f32((float32_t *) pSrc, windowLen, &e0);
+
+  if(fftLen != 0u)
+  {
+    /* Frame and window zero padded to the FFT length */
+    riscv_copy_f32((float32_t *) pSrc, pScratch, windowLen + maxLag);
+    riscv_fill_f32(0.0f, pScratch + windowLen + maxLag, fftLen - (windowLen + maxLag));
+    riscv_copy_f32((float32_t *) pSrc, pScratch + fftLen, windowLen);
+    riscv_fill_f32(0.0f, pScratch + fftLen + windowLen, fftLen - windowLen);
+    pR = riscv_correlate_fft_core_f32(fftLen, pScratch);
+  }
+
+  /* Difference function, the energy of the delayed window updated one sample at a time */
+  e = e0;
+  pDiff[0] = 0.0f;
+
+  for (tau = 1u; tau <= maxLag; tau++)
+  {
+    e += (pSrc[windowLen + tau - 1u] * pSrc[windowLen + tau - 1u]) - (pSrc[tau - 1u] * pSrc[tau - 1u]);
+
+    if(pR != NULL)
+    {
+      r = pR[tau];
+    }
+    else
+    {
+      riscv_dot_prod_f32((float32_t *) pSrc, (float32_t *) pSrc + tau, windowLen, &r);
+    }
+
+    d = (e0 + e) - (2.0f * r);
+    pDiff[tau] = (d > 0.0f) ? d : 0.0f;
+  }
+
+  /* First dip of the cumulative mean normalized difference under the threshold */
+  for (tau = 1u; tau <= maxLag; tau++)
+  {
+    cum += pDiff[tau];
+
+    if(tau < S->minLag)
+    {
+      continue;
+    }
+
+    cmnd = (cum > 0.0f) ? ((pDiff[tau] * (float32_t) tau) / cum) : 1.0f;
+    best = (cmnd < best) ? cmnd : best;
+
+    if(cmnd < S->threshold)
+    {
+      /* Follow it down to the local minimum */
+      while(tau < maxLag)
+      {
+        cum += pDiff[tau + 1u];
+        next = (cum > 0.0f) ? ((pDiff[tau + 1u] * (float32_t) (tau + 1u)) / cum) : 1.0f;
+
+        if(next >= cmnd)
+        {
+          break;
+        }
+
+        cmnd = next;
+        tau++;
+      }
+
+      best = cmnd;
+      found = 1u;
+      break;
+    }
+  }
+
+  if(pAperiodicity != NULL)
+  {
+    *pAperiodicity = best;
+  }
+
+  if(found == 0u)
+  {
+    return (0.0f);
+  }
+
+  /* Vertex of the parabola through d at tau-1, tau and tau+1 */
+  if(tau < maxLag)
+  {
+    dm = pDiff[tau - 1u];
+    dp = pDiff[tau + 1u];
+    den = dm - (2.0f * pDiff[tau]) + dp;
+
+    if(den > 0.0f)
+    {
+      delta = (0.5f * (dm - dp)) / den;
+      delta = (delta > 0.5f) ? 0.5f : ((delta < -0.5f) ? -0.5f : delta);
+    }
+  }
+
+  return ((float32_t) tau + delta);
+}
+
+/**
+ * @} end of PitchYIN group
+ */
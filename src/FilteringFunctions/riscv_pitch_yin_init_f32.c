@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pitch_yin_init_f32.c
+*
+* Description:  Initialization function for the floating-point YIN pitch
+*               estimator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup PitchYIN
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point YIN pitch estimator.
+ * @param[out]    *S          points to an instance of the floating-point YIN structure.
+ * @param[in]     windowLen   length of the window compared with its delayed copy.
+ * @param[in]     minLag      shortest period searched, at least 2.
+ * @param[in]     maxLag      longest period searched.
+ * @param[in]     threshold   threshold of the normalized difference.
+ * @param[in]     *pDiff      points to a buffer of <code>maxLag+1</code> values.
+ * @param[in]     *pScratch   points to a scratch buffer of <code>3*fftLen</code> words, or NULL for the direct path.
+ * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR if <code>windowLen</code>
+ *                is 0 or the lag range is empty or starts under 2.
+ *
+ * \par
+ * fftLen is the smallest power of two of at least <code>windowLen+maxLag</code> points, from 32 to 4096.
+ * The FFT path is taken when a scratch buffer is given and the <code>windowLen*maxLag</code> MACs of the
+ * direct path are more than <code>RISCV_CORRELATE_FFT_RATIO*fftLen*log2(fftLen)</code>, the rule of
+ * riscv_correlate_fft_length(); <code>S->fftLen</code> is 0 otherwise.
+ */
+
+riscv_status riscv_pitch_yin_init_f32(
+  riscv_pitch_yin_instance_f32 * S,
+  uint16_t windowLen,
+  uint16_t minLag,
+  uint16_t maxLag,
+  float32_t threshold,
+  float32_t * pDiff,
+  float32_t * pScratch)
+{
+  RISCV_PROFILE(riscv_pitch_yin_init_f32);
+  uint32_t fftLen = 32u, logLen = 5u;
+
+  if((windowLen == 0u) || (minLag < 2u) || (minLag > maxLag))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  while(fftLen < ((uint32_t) windowLen + maxLag))
+  {
+    fftLen <<= 1u;
+    logLen++;
+  }
+
+  /* Short windows and lag ranges are faster direct */
+  if((pScratch == NULL) || (fftLen > 4096u) ||
+     (((uint32_t) windowLen * maxLag) <= (RISCV_CORRELATE_FFT_RATIO * fftLen * logLen)))
+  {
+    fftLen = 0u;
+  }
+
+  S->windowLen = windowLen;
+  S->minLag = minLag;
+  S->maxLag = maxLag;
+  S->fftLen = (uint16_t) fftLen;
+  S->threshold = threshold;
+  S->pDiff = pDiff;
+  S->pScratch = pScratch;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of PitchYIN group
+ */
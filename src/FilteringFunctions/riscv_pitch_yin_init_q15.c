@@ -0,0 +1,59 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pitch_yin_init_q15.c
+*
+* Description:  Initialization function for the Q15 YIN pitch estimator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup PitchYIN
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 YIN pitch estimator.
+ * @param[out]    *S          points to an instance of the Q15 YIN structure.
+ * @param[in]     windowLen   length of the window compared with its delayed copy.
+ * @param[in]     minLag      shortest period searched, at least 2.
+ * @param[in]     maxLag      longest period searched, less than 32768.
+ * @param[in]     threshold   threshold of the normalized difference in 1.15 format.
+ * @param[in]     *pDiff      points to a buffer of <code>maxLag+1</code> values.
+ * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR if <code>windowLen</code>
+ *                is 0 or the lag range is empty or out of range.
+ */
+
+riscv_status riscv_pitch_yin_init_q15(
+  riscv_pitch_yin_instance_q15 * S,
+  uint16_t windowLen,
+  uint16_t minLag,
+  uint16_t maxLag,
+  q15_t threshold,
+  q31_t * pDiff)
+{
+  RISCV_PROFILE(riscv_pitch_yin_init_q15);
+
+  if((windowLen == 0u) || (minLag < 2u) || (minLag > maxLag) || (maxLag > 0x7FFFu))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->windowLen = windowLen;
+  S->minLag = minLag;
+  S->maxLag = maxLag;
+  S->threshold = threshold;
+  S->pDiff = pDiff;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of PitchYIN group
+ */
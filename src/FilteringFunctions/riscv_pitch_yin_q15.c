@@ -0,0 +1,231 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pitch_yin_q15.c
+*
+* Description:  Q15 YIN pitch estimator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* Sum of px[n] * px[n+lag] for n < numSamples in 2.30 format, accumulated in 64 bits */
+static q63_t riscv_pitch_yin_dot_q15(
+  const q15_t * px,
+  uint32_t lag,
+  uint32_t numSamples)
+{
+  const q15_t *py = px + lag;                    /* Window delayed by the lag */
+  q63_t sum = 0;                                 /* Accumulator */
+  uint32_t k;                                    /* Loop counter */
+#if defined (USE_DSP_RISCV)
+  shortV odd = { 1, 2 };                         /* Pair straddling two aligned pairs */
+  shortV y0, y1;
+
+  if((lag & 1u) == 0u)
+  {
+    k = numSamples >> 1u;
+
+    while(k > 0u)
+    {
+      sum += dotpv2(*(shortV *) px, *(shortV *) py);
+      px += 2;
+      py += 2;
+      k--;
+    }
+
+    k = numSamples & 1u;
+  }
+  else
+  {
+    /* (py[0], py[1]) from the pairs at py - 1 and py + 1, the last load stays inside the frame */
+    k = (numSamples - 1u) >> 1u;
+    y0 = *(shortV *) (py - 1);
+
+    while(k > 0u)
+    {
+      y1 = *(shortV *) (py + 1);
+      sum += dotpv2(*(shortV *) px, shufflev4(y0, y1, odd));
+      y0 = y1;
+      px += 2;
+      py += 2;
+      k--;
+    }
+
+    k = numSamples - (((numSamples - 1u) >> 1u) << 1u);
+  }
+
+#else
+
+  k = numSamples;
+
+#endif
+
+  while(k > 0u)
+  {
+    sum += (q31_t) *px++ * *py++;
+    k--;
+  }
+
+  return (sum);
+}
+
+/* num / den in 1.15 format for 0 <= num, saturated to 0x7FFF, with a 32-bit division */
+static q15_t riscv_pitch_yin_ratio_q15(
+  q63_t num,
+  q63_t den)
+{
+  uint32_t hi, q;
+  int32_t shift;
+
+  if(num >= den)
+  {
+    return (0x7FFF);
+  }
+
+  /* den normalized to [2^30, 2^31), num < den follows it */
+  hi = (uint32_t) ((uint64_t) den >> 32);
+  shift = (hi != 0u) ? (33 - (int32_t) __CLZ(hi)) : (1 - (int32_t) __CLZ((uint32_t) den));
+
+  if(shift > 0)
+  {
+    num >>= shift;
+    den >>= shift;
+  }
+  else
+  {
+    num <<= -shift;
+    den <<= -shift;
+  }
+
+  q = (uint32_t) num / ((uint32_t) den >> 15);
+
+  return ((q > 0x7FFFu) ? 0x7FFF : (q15_t) q);
+}
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup PitchYIN
+ * @{
+ */
+
+/**
+ * @brief Q15 YIN pitch estimator.
+ * @param[in]  *S              points to an instance of the Q15 YIN structure.
+ * @param[in]  *pSrc           points to the frame of <code>windowLen+maxLag</code> samples, 4-byte aligned.
+ * @param[out] *pAperiodicity  d' at the period in 1.15 format, or the smallest d' of an unvoiced frame, may be NULL.
+ * @return the period in samples in 16.16 format, or 0 if the frame is unvoiced.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The energies and correlations are 2.30 sums accumulated in 64 bits.  Each d(t) is shifted right by
+ * <code>33-clz(windowLen)</code> bits into a 32-bit value that cannot overflow, the small differences
+ * near the period keep about 30 - log2(windowLen) fractional bits.  The normalized difference d' is
+ * saturated to 1, the threshold and the aperiodicity are in 1.15 format.
+ * \par
+ * With <code>USE_DSP_RISCV</code> the correlation at each lag runs on pairs of samples with the dot
+ * product instructions, odd lags build the delayed pairs from aligned loads with one shuffle.
+ */
+
+q31_t riscv_pitch_yin_q15(
+  const riscv_pitch_yin_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pAperiodicity)
+{
+  RISCV_PROFILE(riscv_pitch_yin_q15);
+  uint32_t windowLen = S->windowLen;             /* Window length */
+  uint32_t maxLag = S->maxLag;                   /* Last lag */
+  uint32_t shift = 33u - __CLZ(windowLen);       /* Scaling of d to 32 bits */
+  q31_t *pDiff = S->pDiff;                       /* Difference function */
+  q63_t e0, e, d;                                /* Energies and difference */
+  q63_t cum = 0;                                 /* Sum of d over the lags so far */
+  q63_t dm, dp, den, delta = 0;                  /* Parabolic refinement */
+  q15_t cmnd, next, best = 0x7FFF;               /* Normalized differences */
+  uint32_t tau, found = 0u;
+  q31_t a, b;
+
+  e0 = riscv_pitch_yin_dot_q15(pSrc, 0u, windowLen);
+
+  /* Difference function, the energy of the delayed window updated one sample at a time */
+  e = e0;
+  pDiff[0] = 0;
+
+  for (tau = 1u; tau <= maxLag; tau++)
+  {
+    a = pSrc[windowLen + tau - 1u];
+    b = pSrc[tau - 1u];
+    e += (q63_t) ((a * a) - (b * b));
+
+    d = (e0 + e) - 2 * riscv_pitch_yin_dot_q15(pSrc, tau, windowLen);
+    pDiff[tau] = (d > 0) ? (q31_t) (d >> shift) : 0;
+  }
+
+  /* First dip of the cumulative mean normalized difference under the threshold */
+  for (tau = 1u; tau <= maxLag; tau++)
+  {
+    cum += pDiff[tau];
+
+    if(tau < S->minLag)
+    {
+      continue;
+    }
+
+    cmnd = riscv_pitch_yin_ratio_q15((q63_t) pDiff[tau] * tau, cum);
+    best = (cmnd < best) ? cmnd : best;
+
+    if(cmnd < S->threshold)
+    {
+      /* Follow it down to the local minimum */
+      while(tau < maxLag)
+      {
+        cum += pDiff[tau + 1u];
+        next = riscv_pitch_yin_ratio_q15((q63_t) pDiff[tau + 1u] * (tau + 1u), cum);
+
+        if(next >= cmnd)
+        {
+          break;
+        }
+
+        cmnd = next;
+        tau++;
+      }
+
+      best = cmnd;
+      found = 1u;
+      break;
+    }
+  }
+
+  if(pAperiodicity != NULL)
+  {
+    *pAperiodicity = best;
+  }
+
+  if(found == 0u)
+  {
+    return (0);
+  }
+
+  /* Vertex of the parabola through d at tau-1, tau and tau+1, in 16.16 format */
+  if(tau < maxLag)
+  {
+    dm = pDiff[tau - 1u];
+    dp = pDiff[tau + 1u];
+    den = dm - 2 * (q63_t) pDiff[tau] + dp;
+
+    if(den > 0)
+    {
+      delta = ((dm - dp) << 15) / den;
+      delta = (delta > 32768) ? 32768 : ((delta < -32768) ? -32768 : delta);
+    }
+  }
+
+  return ((q31_t) (((q63_t) tau << 16) + delta));
+}
+
+/**
+ * @} end of PitchYIN group
+ */
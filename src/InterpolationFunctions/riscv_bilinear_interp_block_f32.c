@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_bilinear_interp_block_f32.c
+*
+* Description:  Floating-point bilinear interpolation of a block of
+*               points.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup BilinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Floating-point bilinear interpolation of a block of points.
+ * @param[in]  *S         points to an instance of the interpolation structure.
+ * @param[in]  *pX        points to the column coordinates of the points.
+ * @param[in]  *pY        points to the row coordinates of the points.
+ * @param[out] *pDst      points to the interpolated outputs.
+ * @param[in]  blockSize  number of points.
+ * @return none.
+ */
+
+void riscv_bilinear_interp_block_f32(
+  const riscv_bilinear_interp_instance_f32 * S,
+  float32_t * pX,
+  float32_t * pY,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_bilinear_interp_block_f32);
+  const float32_t *pData = S->pData;             /* pointer to the table */
+  const float32_t *p;                            /* Nearest table value */
+  int32_t numCols = S->numCols, numRows = S->numRows;
+  float32_t X, Y, xdiff, ydiff;                  /* Point and its fractional parts */
+  float32_t top, bottom;                         /* Interpolated rows */
+  int32_t xIndex, yIndex, xNext, yNext;          /* Indices and offsets of the neighbours */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    X = *pX++;
+    Y = *pY++;
+    xIndex = (int32_t) X;
+    yIndex = (int32_t) Y;
+
+    /* Returns zero output when values are outside table boundary */
+    if((X < 0.0f) || (Y < 0.0f) || (xIndex >= numCols) || (yIndex >= numRows))
+    {
+      *pDst++ = 0.0f;
+    }
+    else
+    {
+      /* The last column and row are their own neighbours */
+      xNext = (xIndex < (numCols - 1)) ? 1 : 0;
+      yNext = (yIndex < (numRows - 1)) ? numCols : 0;
+
+      p = pData + xIndex + (yIndex * numCols);
+      xdiff = X - (float32_t) xIndex;
+      ydiff = Y - (float32_t) yIndex;
+
+      top = p[0] + (xdiff * (p[xNext] - p[0]));
+      bottom = p[yNext] + (xdiff * (p[yNext + xNext] - p[yNext]));
+      *pDst++ = top + (ydiff * (bottom - top));
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BilinearInterpolate group
+ */
@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_bilinear_interp_block_q15.c
+*
+* Description:  Q15 bilinear interpolation of a block of points.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup BilinearInterpolate
+ * @{
+ */
+
+/*
+* @brief  ((a << 15) + f * (b - a)) >> 15 with the fraction f in 1.15 format.
+*/
+
+static q15_t riscv_bilinear_lerp_q15(
+  q15_t a,
+  q15_t b,
+  q31_t f)
+{
+#if defined (USE_DSP_RISCV)
+  return ((q15_t) (sumdotpv2(pack2(b, a), pack2(f, -f), (q31_t) a << 15) >> 15));
+#else
+  return ((q15_t) ((((q31_t) a << 15) + (f * (b - a))) >> 15));
+#endif
+}
+
+/**
+ * @brief  Q15 bilinear interpolation of a block of points.
+ * @param[in]  *S         points to an instance of the interpolation structure.
+ * @param[in]  *pX        points to the column coordinates of the points in 12.20 format.
+ * @param[in]  *pY        points to the row coordinates of the points in 12.20 format.
+ * @param[out] *pDst      points to the interpolated outputs.
+ * @param[in]  blockSize  number of points.
+ * @return none.
+ *
+ * \par
+ * The fractions are truncated to 15 bits and the point is interpolated as two rows and the column
+ * between them, each step in the form of riscv_linear_interp_block_q15().  With the DSP extension
+ * every step is one <code>sumdotpv2</code>.
+ */
+
+void riscv_bilinear_interp_block_q15(
+  const riscv_bilinear_interp_instance_q15 * S,
+  q31_t * pX,
+  q31_t * pY,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_bilinear_interp_block_q15);
+  const q15_t *pData = S->pData;                 /* pointer to the table */
+  const q15_t *p;                                /* Nearest table value */
+  uint32_t numCols = S->numCols, numRows = S->numRows;
+  q31_t X, Y, xfract, yfract;                    /* Point and its fractional parts in 1.15 format */
+  q15_t top, bottom;                             /* Interpolated rows */
+  uint32_t xIndex, yIndex, xNext, yNext;         /* Indices and offsets of the neighbours */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    X = *pX++;
+    Y = *pY++;
+    xIndex = (uint32_t) X >> 20;
+    yIndex = (uint32_t) Y >> 20;
+
+    /* Returns zero output when values are outside table boundary */
+    if((X < 0) || (Y < 0) || (xIndex >= numCols) || (yIndex >= numRows))
+    {
+      *pDst++ = 0;
+    }
+    else
+    {
+      /* The last column and row are their own neighbours */
+      xNext = (xIndex < (numCols - 1u)) ? 1u : 0u;
+      yNext = (yIndex < (numRows - 1u)) ? numCols : 0u;
+
+      p = pData + xIndex + (yIndex * numCols);
+      xfract = (X >> 5) & 0x7FFF;
+      yfract = (Y >> 5) & 0x7FFF;
+
+      top = riscv_bilinear_lerp_q15(p[0], p[xNext], xfract);
+      bottom = riscv_bilinear_lerp_q15(p[yNext], p[yNext + xNext], xfract);
+      *pDst++ = riscv_bilinear_lerp_q15(top, bottom, yfract);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BilinearInterpolate group
+ */
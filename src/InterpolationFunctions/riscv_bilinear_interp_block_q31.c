@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_bilinear_interp_block_q31.c
+*
+* Description:  Q31 bilinear interpolation of a block of points.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup BilinearInterpolate
+ * @{
+ */
+
+/*
+* @brief  a + f * (b - a) with the fraction f in 1.31 format.
+*/
+
+static q31_t riscv_bilinear_lerp_q31(
+  q31_t a,
+  q31_t b,
+  q31_t f)
+{
+  return ((q31_t) (a + ((((q63_t) b - a) * f) >> 31)));
+}
+
+/**
+ * @brief  Q31 bilinear interpolation of a block of points.
+ * @param[in]  *S         points to an instance of the interpolation structure.
+ * @param[in]  *pX        points to the column coordinates of the points in 12.20 format.
+ * @param[in]  *pY        points to the row coordinates of the points in 12.20 format.
+ * @param[out] *pDst      points to the interpolated outputs.
+ * @param[in]  blockSize  number of points.
+ * @return none.
+ *
+ * \par
+ * The fractions are used in 1.31 format and the products of the differences with the fractions
+ * in 64 bits, so the result is within one LSB of the exact interpolation.
+ */
+
+void riscv_bilinear_interp_block_q31(
+  const riscv_bilinear_interp_instance_q31 * S,
+  q31_t * pX,
+  q31_t * pY,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_bilinear_interp_block_q31);
+  const q31_t *pData = S->pData;                 /* pointer to the table */
+  const q31_t *p;                                /* Nearest table value */
+  uint32_t numCols = S->numCols, numRows = S->numRows;
+  q31_t X, Y, xfract, yfract;                    /* Point and its fractional parts */
+  q31_t top, bottom;                             /* Interpolated rows */
+  uint32_t xIndex, yIndex, xNext, yNext;         /* Indices and offsets of the neighbours */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    X = *pX++;
+    Y = *pY++;
+    xIndex = (uint32_t) X >> 20;
+    yIndex = (uint32_t) Y >> 20;
+
+    /* Returns zero output when values are outside table boundary */
+    if((X < 0) || (Y < 0) || (xIndex >= numCols) || (yIndex >= numRows))
+    {
+      *pDst++ = 0;
+    }
+    else
+    {
+      /* The last column and row are their own neighbours */
+      xNext = (xIndex < (numCols - 1u)) ? 1u : 0u;
+      yNext = (yIndex < (numRows - 1u)) ? numCols : 0u;
+
+      p = pData + xIndex + (yIndex * numCols);
+      xfract = (X & 0x000FFFFF) << 11;
+      yfract = (Y & 0x000FFFFF) << 11;
+
+      top = riscv_bilinear_lerp_q31(p[0], p[xNext], xfract);
+      bottom = riscv_bilinear_lerp_q31(p[yNext], p[yNext + xNext], xfract);
+      *pDst++ = riscv_bilinear_lerp_q31(top, bottom, yfract);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BilinearInterpolate group
+ */
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_bilinear_interp_block_q7.c
+*
+* Description:  Q7 bilinear interpolation of a block of points.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup BilinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Q7 bilinear interpolation of a block of points.
+ * @param[in]  *S         points to an instance of the interpolation structure.
+ * @param[in]  *pX        points to the column coordinates of the points in 12.20 format.
+ * @param[in]  *pY        points to the row coordinates of the points in 12.20 format.
+ * @param[out] *pDst      points to the interpolated outputs.
+ * @param[in]  blockSize  number of points.
+ * @return none.
+ *
+ * \par
+ * The interpolation is computed as in riscv_bilinear_interp_block_q15() with 15-bit fractions.
+ * The interpolated rows are kept in 8.15 format, so only the final result is truncated to 1.7 format.
+ */
+
+void riscv_bilinear_interp_block_q7(
+  const riscv_bilinear_interp_instance_q7 * S,
+  q31_t * pX,
+  q31_t * pY,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_bilinear_interp_block_q7);
+  const q7_t *pData = S->pData;                  /* pointer to the table */
+  const q7_t *p;                                 /* Nearest table value */
+  uint32_t numCols = S->numCols, numRows = S->numRows;
+  q31_t X, Y, xfract, yfract;                    /* Point and its fractional parts in 1.15 format */
+  q31_t top, bottom;                             /* Interpolated rows in 8.15 format */
+  uint32_t xIndex, yIndex, xNext, yNext;         /* Indices and offsets of the neighbours */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    X = *pX++;
+    Y = *pY++;
+    xIndex = (uint32_t) X >> 20;
+    yIndex = (uint32_t) Y >> 20;
+
+    /* Returns zero output when values are outside table boundary */
+    if((X < 0) || (Y < 0) || (xIndex >= numCols) || (yIndex >= numRows))
+    {
+      *pDst++ = 0;
+    }
+    else
+    {
+      /* The last column and row are their own neighbours */
+      xNext = (xIndex < (numCols - 1u)) ? 1u : 0u;
+      yNext = (yIndex < (numRows - 1u)) ? numCols : 0u;
+
+      p = pData + xIndex + (yIndex * numCols);
+      xfract = (X >> 5) & 0x7FFF;
+      yfract = (Y >> 5) & 0x7FFF;
+
+      top = ((q31_t) p[0] << 15) + (xfract * (p[xNext] - p[0]));
+      bottom = ((q31_t) p[yNext] << 15) + (xfract * (p[yNext + xNext] - p[yNext]));
+
+      /* top + yfract * (bottom - top) in 8.30 format, converted to 1.7 */
+      *pDst++ = (q7_t) ((((q63_t) top << 15) + ((q63_t) yfract * (bottom - top))) >> 30);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of BilinearInterpolate group
+ */
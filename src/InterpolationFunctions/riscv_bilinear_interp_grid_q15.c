@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_bilinear_interp_grid_q15.c
+*
+* Description:  Q15 bilinear interpolation on a uniform grid of points.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup BilinearInterpolate
+ * @{
+ */
+
+/*
+* @brief  ((a << 15) + f * (b - a)) >> 15 with the fraction f in 1.15 format.
+*/
+
+static q15_t riscv_bilinear_grid_lerp_q15(
+  q15_t a,
+  q15_t b,
+  q31_t f)
+{
+#if defined (USE_DSP_RISCV)
+  return ((q15_t) (sumdotpv2(pack2(b, a), pack2(f, -f), (q31_t) a << 15) >> 15));
+#else
+  return ((q15_t) ((((q31_t) a << 15) + (f * (b - a))) >> 15));
+#endif
+}
+
+/**
+ * @brief  Q15 bilinear interpolation on the grid of points (x + i*xStep, y + j*yStep).
+ * @param[in]  *S      points to an instance of the interpolation structure.
+ * @param[in]  x       column coordinate of the first point in 12.20 format.
+ * @param[in]  xStep   distance between two columns of the grid in 12.20 format.
+ * @param[in]  numX    number of columns of the grid.
+ * @param[in]  y       row coordinate of the first point in 12.20 format.
+ * @param[in]  yStep   distance between two rows of the grid in 12.20 format.
+ * @param[in]  numY    number of rows of the grid.
+ * @param[out] *pDst   points to the <code>numX*numY</code> outputs, in row order.
+ * @return none.
+ *
+ * \par
+ * The outputs equal the ones of riscv_bilinear_interp_block_q15() for the same points, for example to
+ * resize an image with <code>xStep = (srcCols << 20) / dstCols</code>.  The row of the table and
+ * <code>yfract</code> are computed once per row of the grid instead of once per point.
+ */
+
+void riscv_bilinear_interp_grid_q15(
+  const riscv_bilinear_interp_instance_q15 * S,
+  q31_t x,
+  q31_t xStep,
+  uint32_t numX,
+  q31_t y,
+  q31_t yStep,
+  uint32_t numY,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_bilinear_interp_grid_q15);
+  const q15_t *pRow;                             /* First table value of the row */
+  const q15_t *p;                                /* Nearest table value */
+  uint32_t numCols = S->numCols, numRows = S->numRows;
+  q31_t X, xfract, yfract;                       /* Point and the fractional parts in 1.15 format */
+  q15_t top, bottom;                             /* Interpolated rows */
+  uint32_t xIndex, yIndex, xNext, yNext;         /* Indices and offsets of the neighbours */
+  uint32_t i, j;                                 /* loop counters */
+
+  for (j = 0u; j < numY; j++)
+  {
+    yIndex = (uint32_t) y >> 20;
+
+    if((y < 0) || (yIndex >= numRows))
+    {
+      /* Returns zero output when values are outside table boundary */
+      memset(pDst, 0, numX * sizeof(q15_t));
+      pDst += numX;
+    }
+    else
+    {
+      pRow = S->pData + (yIndex * numCols);
+      yNext = (yIndex < (numRows - 1u)) ? numCols : 0u;
+      yfract = (y >> 5) & 0x7FFF;
+      X = x;
+
+      for (i = 0u; i < numX; i++)
+      {
+        xIndex = (uint32_t) X >> 20;
+
+        if((X < 0) || (xIndex >= numCols))
+        {
+          *pDst++ = 0;
+        }
+        else
+        {
+          xNext = (xIndex < (numCols - 1u)) ? 1u : 0u;
+          p = pRow + xIndex;
+          xfract = (X >> 5) & 0x7FFF;
+
+          top = riscv_bilinear_grid_lerp_q15(p[0], p[xNext], xfract);
+          bottom = riscv_bilinear_grid_lerp_q15(p[yNext], p[yNext + xNext], xfract);
+          *pDst++ = riscv_bilinear_grid_lerp_q15(top, bottom, yfract);
+        }
+
+        X += xStep;
+      }
+    }
+
+    y += yStep;
+  }
+}
+
+/**
+ * @} end of BilinearInterpolate group
+ */
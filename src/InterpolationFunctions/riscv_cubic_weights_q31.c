@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cubic_weights_q31.c
+*
+* Description:  Weights of the 4-point Catmull-Rom and Lagrange
+*               interpolators in fixed-point.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup FractionalDelay
+ * @{
+ */
+
+/**
+ * @brief  Weights of a 4-point cubic interpolator in 2.30 format.
+ * @param[in]  type       interpolation polynomial.
+ * @param[in]  t          position between the two middle points in 2.30 format, from 0 to 0x40000000.
+ * @param[out] *pWeights  points to the four weights in 2.30 format, oldest point first.
+ * @return     The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>type</code> is unknown
+ * or <code>t</code> is outside of the range.
+ *
+ * \par
+ * The interpolated value at <code>p1 + t*(p2 - p1)</code> is
+ * <code>w[0]*p0 + w[1]*p1 + w[2]*p2 + w[3]*p3</code>.
+ * The powers of <code>t</code> are truncated to 30 fractional bits and the weights are exact
+ * at <code>t = 0</code> and <code>t = 1</code>.
+ */
+
+riscv_status riscv_cubic_weights_q31(
+  riscv_cubic_interp_type type,
+  q31_t t,
+  q31_t * pWeights)
+{
+  RISCV_PROFILE(riscv_cubic_weights_q31);
+  q63_t one = 0x40000000;                        /* 1.0 in 2.30 format */
+  q63_t t1 = t, t2, t3;                          /* Powers of t in 2.30 format */
+
+  if((t < 0) || (t > 0x40000000))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  t2 = (t1 * t1) >> 30;
+  t3 = (t2 * t1) >> 30;
+
+  if(type == RISCV_CUBIC_CATMULL_ROM)
+  {
+    pWeights[0] = (q31_t) (((2 * t2) - t3 - t1) / 2);
+    pWeights[1] = (q31_t) (((3 * t3) - (5 * t2) + (2 * one)) / 2);
+    pWeights[2] = (q31_t) (((4 * t2) - (3 * t3) + t1) / 2);
+    pWeights[3] = (q31_t) ((t3 - t2) / 2);
+  }
+  else if(type == RISCV_CUBIC_LAGRANGE)
+  {
+    /* Lagrange polynomials of the points -1, 0, 1, 2 */
+    pWeights[0] = (q31_t) (((3 * t2) - t3 - (2 * t1)) / 6);
+    pWeights[1] = (q31_t) ((t3 - (2 * t2) - t1 + (2 * one)) / 2);
+    pWeights[2] = (q31_t) ((t2 - t3 + (2 * t1)) / 2);
+    pWeights[3] = (q31_t) ((t3 - t1) / 6);
+  }
+  else
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FractionalDelay group
+ */
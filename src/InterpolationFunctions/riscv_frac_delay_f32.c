@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_frac_delay_f32.c
+*
+* Description:  Floating-point fractional delay with a 4-point cubic interpolator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup FractionalDelay
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point fractional delay.
+ * @param[in]  *S         points to an instance of the floating-point fractional delay structure.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[out] *pDst      points to the block of output data.
+ * @param[in]  blockSize  number of samples to process.
+ * @return none.
+ */
+
+void riscv_frac_delay_f32(
+  const riscv_frac_delay_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_frac_delay_f32);
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t w0 = S->weights[0], w1 = S->weights[1];  /* Interpolation weights */
+  float32_t w2 = S->weights[2], w3 = S->weights[3];
+  float32_t *px = pState;                        /* Oldest sample of the output */
+  float32_t x0, x1, x2, x3;                      /* Samples of the window */
+  uint32_t blkCnt = blockSize, i;                /* loop counters */
+
+  /* Append the new input to the previous 3 samples */
+  memcpy(pState + 3, pSrc, blockSize * sizeof(float32_t));
+
+  x0 = px[0];
+  x1 = px[1];
+  x2 = px[2];
+  px += 3;
+
+  while(blkCnt > 0u)
+  {
+    /* The window slides by one sample, only the newest one is loaded */
+    x3 = *px++;
+    *pDst++ = (x0 * w0) + (x1 * w1) + (x2 * w2) + (x3 * w3);
+
+    x0 = x1;
+    x1 = x2;
+    x2 = x3;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Keep the last 3 samples for the next call */
+  for (i = 0u; i < 3u; i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+}
+
+/**
+ * @} end of FractionalDelay group
+ */
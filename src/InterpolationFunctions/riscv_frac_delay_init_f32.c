@@ -0,0 +1,51 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_frac_delay_init_f32.c
+*
+* Description:  Initialization function for the floating-point fractional delay.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup FractionalDelay
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point fractional delay.
+ * @param[out] *S         points to an instance of the floating-point fractional delay structure.
+ * @param[in]  type       interpolation polynomial.
+ * @param[in]  fract      fractional part of the delay, from 0 to less than 1.
+ * @param[in]  *pState    points to the state buffer of <code>blockSize+3</code> samples.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     The function returns RISCV_MATH_SUCCESS if initialization is successful, or RISCV_MATH_ARGUMENT_ERROR
+ * if <code>type</code> is unknown or <code>fract</code> is outside of the range.
+ */
+
+riscv_status riscv_frac_delay_init_f32(
+  riscv_frac_delay_instance_f32 * S,
+  riscv_cubic_interp_type type,
+  float32_t fract,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_frac_delay_init_f32);
+  S->type = type;
+  S->pState = pState;
+
+  /* Clear state buffer, the size is always blockSize + 3 */
+  memset(pState, 0, (blockSize + 3u) * sizeof(float32_t));
+
+  return (riscv_frac_delay_set_f32(S, fract));
+}
+
+/**
+ * @} end of FractionalDelay group
+ */
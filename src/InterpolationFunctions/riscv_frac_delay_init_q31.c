@@ -0,0 +1,51 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_frac_delay_init_q31.c
+*
+* Description:  Initialization function for the Q31 fractional delay.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup FractionalDelay
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 fractional delay.
+ * @param[out] *S         points to an instance of the Q31 fractional delay structure.
+ * @param[in]  type       interpolation polynomial.
+ * @param[in]  fract      fractional part of the delay in 1.31 format, from 0 to 0x7FFFFFFF.
+ * @param[in]  *pState    points to the state buffer of <code>blockSize+3</code> samples.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     The function returns RISCV_MATH_SUCCESS if initialization is successful, or RISCV_MATH_ARGUMENT_ERROR
+ * if <code>type</code> is unknown or <code>fract</code> is negative.
+ */
+
+riscv_status riscv_frac_delay_init_q31(
+  riscv_frac_delay_instance_q31 * S,
+  riscv_cubic_interp_type type,
+  q31_t fract,
+  q31_t * pState,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_frac_delay_init_q31);
+  S->type = type;
+  S->pState = pState;
+
+  /* Clear state buffer, the size is always blockSize + 3 */
+  memset(pState, 0, (blockSize + 3u) * sizeof(q31_t));
+
+  return (riscv_frac_delay_set_q31(S, fract));
+}
+
+/**
+ * @} end of FractionalDelay group
+ */
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_frac_delay_q15.c
+*
+* Description:  Q15 fractional delay with a 4-point cubic interpolator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @defgroup FractionalDelay Fractional Delay
+ *
+ * These functions delay a signal by <code>1 + fract</code> samples, <code>0 <= fract < 1</code>,
+ * by interpolating between the input samples with a third order polynomial through four of them:
+ * <pre>
+ *     y[n] = w[0] * x[n-3] + w[1] * x[n-2] + w[2] * x[n-1] + w[3] * x[n]
+ * </pre>
+ * The weights are the ones of riscv_cubic_weights_q31() at <code>t = 1 - fract</code> between
+ * <code>x[n-2]</code> and <code>x[n-1]</code>.  Longer delays add the integer part with a delay
+ * line, for example a circular buffer, in front of the filter.
+ *
+ * \par
+ * Two polynomials are supported:
+ * - RISCV_CUBIC_CATMULL_ROM: the Catmull-Rom spline, with a continuous first derivative of the interpolated signal.
+ * - RISCV_CUBIC_LAGRANGE: the third order Lagrange polynomial, with the flattest frequency response at low frequencies.
+ *
+ * \par
+ * Both reproduce the input exactly for <code>fract = 0</code>.  The weights are computed by the
+ * initialization functions and by riscv_frac_delay_set_f32(), riscv_frac_delay_set_q31() and
+ * riscv_frac_delay_set_q15(), which keep the state so the delay can be changed between two blocks.
+ *
+ * \par
+ * <code>pState</code> points to a state array of size <code>blockSize + 3</code>, laid out as the
+ * state of the FIR filters, and <code>blockSize</code> is at most the value given to the initialization function.
+ * The fixed-point weights are in 2.14 (Q15) and 2.30 (Q31) format and the results are saturated,
+ * since both polynomials overshoot between samples of opposite sign.
+ */
+
+/**
+ * @addtogroup FractionalDelay
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q15 fractional delay.
+ * @param[in]  *S         points to an instance of the Q15 fractional delay structure.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[out] *pDst      points to the block of output data.
+ * @param[in]  blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The products are accumulated in 32 bits in 3.29 format, shifted to 1.15 format and saturated.
+ * Rounding the weights to 2.14 format keeps the result within a few LSB of the exact interpolation.
+ * With the DSP extension two outputs are computed together from aligned sample pairs: the
+ * even output with the weight pairs {w0, w1}, {w2, w3} and the odd one with {0, w0}, {w1, w2}, {w3, 0},
+ * five <code>dotpv2</code> in total.  The odd output of the last pair of an even block would
+ * read one sample past the state, so the scalar loop computes the last two outputs of an even block.
+ */
+
+void riscv_frac_delay_q15(
+  const riscv_frac_delay_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_frac_delay_q15);
+  q15_t *pState = S->pState;                     /* State pointer */
+  const q15_t *w = S->weights;                   /* Interpolation weights in 2.14 format */
+  q15_t *px = pState;                            /* Oldest sample of the output */
+  q31_t acc;                                     /* Accumulator */
+  uint32_t blkCnt, i;                            /* loop counters */
+
+#if defined (USE_DSP_RISCV)
+
+  shortV x0, x1, x2;                             /* Sample pairs */
+  shortV w01 = pack2(w[0], w[1]), w23 = pack2(w[2], w[3]);
+  shortV w_0 = pack2(0, w[0]), w12 = pack2(w[1], w[2]), w3_ = pack2(w[3], 0);
+  q31_t acc1;                                    /* Accumulator of the odd output */
+
+#endif
+
+  /* Append the new input to the previous 3 samples */
+  memcpy(pState + 3, pSrc, blockSize * sizeof(q15_t));
+
+#if defined (USE_DSP_RISCV)
+
+  /* Pairs whose samples all lie within the state, at most (blockSize - 1) / 2 */
+  blkCnt = (blockSize > 0u) ? ((blockSize - 1u) >> 1u) : 0u;
+  i = blockSize - (blkCnt << 1u);
+
+  while(blkCnt > 0u)
+  {
+    x0 = *(shortV *) px;
+    x1 = *(shortV *) (px + 2);
+    x2 = *(shortV *) (px + 4);
+
+    acc = sumdotpv2(x1, w23, dotpv2(x0, w01));
+    acc1 = sumdotpv2(x2, w3_, sumdotpv2(x1, w12, dotpv2(x0, w_0)));
+
+    *pDst++ = (q15_t) __SSAT(acc >> 14, 16);
+    *pDst++ = (q15_t) __SSAT(acc1 >> 14, 16);
+    px += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = i;
+
+#else
+
+  blkCnt = blockSize;
+
+#endif
+
+  while(blkCnt > 0u)
+  {
+    acc = ((q31_t) px[0] * w[0]) + ((q31_t) px[1] * w[1]) + ((q31_t) px[2] * w[2]) + ((q31_t) px[3] * w[3]);
+    *pDst++ = (q15_t) __SSAT(acc >> 14, 16);
+    px++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Keep the last 3 samples for the next call */
+  for (i = 0u; i < 3u; i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+}
+
+/**
+ * @} end of FractionalDelay group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_frac_delay_q31.c
+*
+* Description:  Q31 fractional delay with a 4-point cubic interpolator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup FractionalDelay
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 fractional delay.
+ * @param[in]  *S         points to an instance of the Q31 fractional delay structure.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[out] *pDst      points to the block of output data.
+ * @param[in]  blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The products are accumulated in 64 bits in 3.61 format, shifted to 1.31 format and saturated.
+ */
+
+void riscv_frac_delay_q31(
+  const riscv_frac_delay_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_frac_delay_q31);
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t w0 = S->weights[0], w1 = S->weights[1];  /* Interpolation weights in 2.30 format */
+  q31_t w2 = S->weights[2], w3 = S->weights[3];
+  q31_t *px = pState;                            /* Oldest sample of the output */
+  q31_t x0, x1, x2, x3;                          /* Samples of the window */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t blkCnt = blockSize, i;                /* loop counters */
+
+  /* Append the new input to the previous 3 samples */
+  memcpy(pState + 3, pSrc, blockSize * sizeof(q31_t));
+
+  x0 = px[0];
+  x1 = px[1];
+  x2 = px[2];
+  px += 3;
+
+  while(blkCnt > 0u)
+  {
+    /* The window slides by one sample, only the newest one is loaded */
+    x3 = *px++;
+    acc = ((q63_t) x0 * w0) + ((q63_t) x1 * w1) + ((q63_t) x2 * w2) + ((q63_t) x3 * w3);
+    *pDst++ = clip_q63_to_q31(acc >> 30);
+
+    x0 = x1;
+    x1 = x2;
+    x2 = x3;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Keep the last 3 samples for the next call */
+  for (i = 0u; i < 3u; i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+}
+
+/**
+ * @} end of FractionalDelay group
+ */
@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_frac_delay_set_f32.c
+*
+* Description:  Sets the fraction of the floating-point fractional delay.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup FractionalDelay
+ * @{
+ */
+
+/**
+ * @brief  Sets the fraction of the floating-point fractional delay.
+ * @param[in,out] *S     points to an instance of the floating-point fractional delay structure.
+ * @param[in]     fract  fractional part of the delay, from 0 to less than 1.
+ * @return        The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if
+ * <code>fract</code> is outside of the range or the interpolation type is unknown.
+ *
+ * \par
+ * Only the weights change and the state is kept.
+ */
+
+riscv_status riscv_frac_delay_set_f32(
+  riscv_frac_delay_instance_f32 * S,
+  float32_t fract)
+{
+  RISCV_PROFILE(riscv_frac_delay_set_f32);
+  float32_t t = 1.0f - fract;                    /* Position between the two middle samples */
+  float32_t t2 = t * t, t3 = t2 * t;             /* Powers of t */
+
+  if(!((fract >= 0.0f) && (fract < 1.0f)))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  if(S->type == RISCV_CUBIC_CATMULL_ROM)
+  {
+    S->weights[0] = 0.5f * ((2.0f * t2) - t3 - t);
+    S->weights[1] = 0.5f * ((3.0f * t3) - (5.0f * t2) + 2.0f);
+    S->weights[2] = 0.5f * ((4.0f * t2) - (3.0f * t3) + t);
+    S->weights[3] = 0.5f * (t3 - t2);
+  }
+  else if(S->type == RISCV_CUBIC_LAGRANGE)
+  {
+    /* Lagrange polynomials of the points -1, 0, 1, 2 */
+    S->weights[0] = ((3.0f * t2) - t3 - (2.0f * t)) / 6.0f;
+    S->weights[1] = 0.5f * (t3 - (2.0f * t2) - t + 2.0f);
+    S->weights[2] = 0.5f * (t2 - t3 + (2.0f * t));
+    S->weights[3] = (t3 - t) / 6.0f;
+  }
+  else
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FractionalDelay group
+ */
@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_frac_delay_set_q15.c
+*
+* Description:  Sets the fraction of the Q15 fractional delay.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup FractionalDelay
+ * @{
+ */
+
+/**
+ * @brief  Sets the fraction of the Q15 fractional delay.
+ * @param[in,out] *S     points to an instance of the Q15 fractional delay structure.
+ * @param[in]     fract  fractional part of the delay in 1.15 format, from 0 to 0x7FFF.
+ * @return        The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if
+ * <code>fract</code> is negative or the interpolation type is unknown.
+ *
+ * \par
+ * Only the weights change, the state is kept, so the delay can be modulated between two calls
+ * of riscv_frac_delay_q15().  The weights are computed in 2.30 format and rounded to 2.14.
+ */
+
+riscv_status riscv_frac_delay_set_q15(
+  riscv_frac_delay_instance_q15 * S,
+  q15_t fract)
+{
+  RISCV_PROFILE(riscv_frac_delay_set_q15);
+  q31_t w[4];                                    /* Weights in 2.30 format */
+  uint32_t i;
+
+  if(fract < 0)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Position between the two middle samples, counted from the older one, in 2.30 format */
+  if(riscv_cubic_weights_q31(S->type, ((q31_t) 0x8000 - fract) << 15, w) != RISCV_MATH_SUCCESS)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < 4u; i++)
+  {
+    S->weights[i] = (q15_t) ((w[i] + 0x8000) >> 16);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FractionalDelay group
+ */
@@ -0,0 +1,49 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_frac_delay_set_q31.c
+*
+* Description:  Sets the fraction of the Q31 fractional delay.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup FractionalDelay
+ * @{
+ */
+
+/**
+ * @brief  Sets the fraction of the Q31 fractional delay.
+ * @param[in,out] *S     points to an instance of the Q31 fractional delay structure.
+ * @param[in]     fract  fractional part of the delay in 1.31 format, from 0 to 0x7FFFFFFF.
+ * @return        The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if
+ * <code>fract</code> is negative or the interpolation type is unknown.
+ *
+ * \par
+ * Only the weights change and the state is kept.  The lowest bit of <code>fract</code> is dropped,
+ * the position of the interpolator has 30 fractional bits.
+ */
+
+riscv_status riscv_frac_delay_set_q31(
+  riscv_frac_delay_instance_q31 * S,
+  q31_t fract)
+{
+  RISCV_PROFILE(riscv_frac_delay_set_q31);
+  if(fract < 0)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Position between the two middle samples, counted from the older one, in 2.30 format */
+  return (riscv_cubic_weights_q31(S->type, (q31_t) ((0x80000000u - (uint32_t) fract) >> 1), S->weights));
+}
+
+/**
+ * @} end of FractionalDelay group
+ */
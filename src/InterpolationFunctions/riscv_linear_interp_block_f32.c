@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_linear_interp_block_f32.c
+*
+* Description:  Floating-point linear interpolation of a block of points.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Floating-point linear interpolation of a block of points.
+ * @param[in]  *S         points to an instance of the floating-point Linear Interpolation structure.
+ * @param[in]  *pX        points to the input points.
+ * @param[out] *pDst      points to the interpolated outputs.
+ * @param[in]  blockSize  number of points.
+ * @return none.
+ *
+ * \par
+ * The reciprocal of <code>xSpacing</code> is computed once for the block, so every point costs a
+ * multiplication instead of the division of riscv_linear_interp_f32().  Points below the table return
+ * the first value and points at or above the last table entry return the last value.
+ */
+
+void riscv_linear_interp_block_f32(
+  const riscv_linear_interp_instance_f32 * S,
+  float32_t * pX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_linear_interp_block_f32);
+  const float32_t *pYData = S->pYData;           /* pointer to output table */
+  float32_t x1 = S->x1;                          /* First input value of the table */
+  float32_t invSpacing = 1.0f / S->xSpacing;     /* Reciprocal of the spacing between input values */
+  float32_t first = pYData[0];                   /* Outputs outside of the table */
+  float32_t last = pYData[S->nValues - 1u];
+  int32_t lastIndex = (int32_t) S->nValues - 1;
+  float32_t t, fract, y0;
+  int32_t i;                                     /* Index variable */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    /* Position in the table in units of xSpacing */
+    t = (*pX++ - x1) * invSpacing;
+    i = (int32_t) t;
+
+    if(t < 0.0f)
+    {
+      *pDst++ = first;
+    }
+    else if(i >= lastIndex)
+    {
+      *pDst++ = last;
+    }
+    else
+    {
+      fract = t - (float32_t) i;
+      y0 = pYData[i];
+      *pDst++ = y0 + (fract * (pYData[i + 1] - y0));
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
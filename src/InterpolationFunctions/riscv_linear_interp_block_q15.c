@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_linear_interp_block_q15.c
+*
+* Description:  Q15 linear interpolation of a block of points.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Q15 linear interpolation of a block of points.
+ * @param[in]  *pYData    points to the Q15 table.
+ * @param[in]  nValues    number of table values.
+ * @param[in]  *pX        points to the input points in 12.20 format.
+ * @param[out] *pDst      points to the interpolated outputs.
+ * @param[in]  blockSize  number of points.
+ * @return none.
+ *
+ * \par
+ * The fraction is truncated to 15 bits <code>f</code> and the output is
+ * <code>((y0 << 15) + f * (y1 - y0)) >> 15</code>.  This is exact for the truncated fraction
+ * and may differ from riscv_linear_interp_q15() by one LSB.
+ * With the DSP extension the product is one <code>sumdotpv2</code> of the pair {y1, y0}
+ * with the weights {f, -f}.
+ */
+
+void riscv_linear_interp_block_q15(
+  const q15_t * pYData,
+  uint32_t nValues,
+  q31_t * pX,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_linear_interp_block_q15);
+  q31_t x;                                       /* Input point */
+  q31_t fract;                                   /* fractional part in 1.15 format */
+  q15_t y0, y1;                                  /* Nearest output values */
+  uint32_t index;                                /* Index to read nearest output values */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pX++;
+    index = (uint32_t) x >> 20;
+
+    if(x < 0)
+    {
+      *pDst++ = pYData[0];
+    }
+    else if(index >= (nValues - 1u))
+    {
+      *pDst++ = pYData[nValues - 1u];
+    }
+    else
+    {
+      fract = (x >> 5) & 0x7FFF;
+      y0 = pYData[index];
+      y1 = pYData[index + 1u];
+
+#if defined (USE_DSP_RISCV)
+      *pDst++ = (q15_t) (sumdotpv2(pack2(y1, y0), pack2(fract, -fract), (q31_t) y0 << 15) >> 15);
+#else
+      *pDst++ = (q15_t) ((((q31_t) y0 << 15) + (fract * (y1 - y0))) >> 15);
+#endif
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_linear_interp_block_q31.c
+*
+* Description:  Q31 linear interpolation of a block of points.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Q31 linear interpolation of a block of points.
+ * @param[in]  *pYData    points to the Q31 table.
+ * @param[in]  nValues    number of table values.
+ * @param[in]  *pX        points to the input points in 12.20 format.
+ * @param[out] *pDst      points to the interpolated outputs.
+ * @param[in]  blockSize  number of points.
+ * @return none.
+ *
+ * \par
+ * Points inside of the table are interpolated as in riscv_linear_interp_q31().
+ */
+
+void riscv_linear_interp_block_q31(
+  const q31_t * pYData,
+  uint32_t nValues,
+  q31_t * pX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_linear_interp_block_q31);
+  q31_t x, y;                                    /* Input point and output */
+  q31_t fract;                                   /* fractional part */
+  uint32_t index;                                /* Index to read nearest output values */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pX++;
+    index = (uint32_t) x >> 20;
+
+    if(x < 0)
+    {
+      y = pYData[0];
+    }
+    else if(index >= (nValues - 1u))
+    {
+      y = pYData[nValues - 1u];
+    }
+    else
+    {
+      /* shift left by 11 to keep fract in 1.31 format */
+      fract = (x & 0x000FFFFF) << 11;
+
+      /* y0 * (1-fract) + y1 * fract in 2.30 format */
+      y = ((q31_t) ((q63_t) pYData[index] * (0x7FFFFFFF - fract) >> 32));
+      y += ((q31_t) (((q63_t) pYData[index + 1u] * fract) >> 32));
+
+      /* Convert y to 1.31 format */
+      y <<= 1u;
+    }
+
+    *pDst++ = y;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
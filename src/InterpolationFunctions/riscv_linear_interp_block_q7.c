@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_linear_interp_block_q7.c
+*
+* Description:  Q7 linear interpolation of a block of points.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Q7 linear interpolation of a block of points.
+ * @param[in]  *pYData    points to the Q7 table.
+ * @param[in]  nValues    number of table values.
+ * @param[in]  *pX        points to the input points in 12.20 format.
+ * @param[out] *pDst      points to the interpolated outputs.
+ * @param[in]  blockSize  number of points.
+ * @return none.
+ *
+ * \par
+ * The outputs equal the ones of riscv_linear_interp_q7().
+ */
+
+void riscv_linear_interp_block_q7(
+  const q7_t * pYData,
+  uint32_t nValues,
+  q31_t * pX,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_linear_interp_block_q7);
+  q31_t x;                                       /* Input point */
+  q31_t fract;                                   /* fractional part */
+  uint32_t index;                                /* Index to read nearest output values */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    x = *pX++;
+    index = (uint32_t) x >> 20;
+
+    if(x < 0)
+    {
+      *pDst++ = pYData[0];
+    }
+    else if(index >= (nValues - 1u))
+    {
+      *pDst++ = pYData[nValues - 1u];
+    }
+    else
+    {
+      fract = (x & 0x000FFFFF);
+
+      /* y0 * (1-fract) + y1 * fract in 13.27 format, converted to 1.7 */
+      *pDst++ = (q7_t) (((pYData[index] * (0xFFFFF - fract)) + (pYData[index + 1u] * fract)) >> 20u);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
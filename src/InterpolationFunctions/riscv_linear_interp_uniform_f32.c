@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_linear_interp_uniform_f32.c
+*
+* Description:  Floating-point linear interpolation on a uniform grid
+*               of points.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Floating-point linear interpolation at the points x, x+step, x+2*step, ...
+ * @param[in]  *S         points to an instance of the floating-point Linear Interpolation structure.
+ * @param[in]  x          first point.
+ * @param[in]  step       distance between two points.
+ * @param[out] *pDst      points to the interpolated outputs.
+ * @param[in]  blockSize  number of points.
+ * @return none.
+ *
+ * \par
+ * The outputs equal the ones of riscv_linear_interp_block_f32() for the same points up to rounding.
+ * Point <code>n</code> is located in the table as <code>t0 + n*dt</code>, so the only work per point
+ * is one multiply-add, the conversion to the index and the interpolation itself.
+ */
+
+void riscv_linear_interp_uniform_f32(
+  const riscv_linear_interp_instance_f32 * S,
+  float32_t x,
+  float32_t step,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_linear_interp_uniform_f32);
+  const float32_t *pYData = S->pYData;           /* pointer to output table */
+  float32_t invSpacing = 1.0f / S->xSpacing;     /* Reciprocal of the spacing between input values */
+  float32_t t0 = (x - S->x1) * invSpacing;       /* Position of the first point in the table */
+  float32_t dt = step * invSpacing;              /* Distance between two points in the table */
+  float32_t first = pYData[0];                   /* Outputs outside of the table */
+  float32_t last = pYData[S->nValues - 1u];
+  int32_t lastIndex = (int32_t) S->nValues - 1;
+  float32_t t, fract, y0;
+  int32_t i;                                     /* Index variable */
+  uint32_t n;                                    /* loop counter */
+
+  for (n = 0u; n < blockSize; n++)
+  {
+    t = t0 + ((float32_t) n * dt);
+    i = (int32_t) t;
+
+    if(t < 0.0f)
+    {
+      pDst[n] = first;
+    }
+    else if(i >= lastIndex)
+    {
+      pDst[n] = last;
+    }
+    else
+    {
+      fract = t - (float32_t) i;
+      y0 = pYData[i];
+      pDst[n] = y0 + (fract * (pYData[i + 1] - y0));
+    }
+  }
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_spline_f32.c
+*
+* Description:  Floating-point cubic spline interpolation of a block of points.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup SplineInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Floating-point cubic spline interpolation of a block of points.
+ * @param[in]  *S         points to an instance of the spline structure initialized by riscv_spline_init_f32().
+ * @param[in]  *pXq       points to the points.
+ * @param[out] *pDst      points to the interpolated outputs.
+ * @param[in]  blockSize  number of points.
+ * @return none.
+ *
+ * \par
+ * The points may be in any order.  The search for the interval starts from the interval of the
+ * previous point, so increasing or slowly changing points cost a few compares each.
+ */
+
+void riscv_spline_f32(
+  const riscv_spline_instance_f32 * S,
+  float32_t * pXq,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_spline_f32);
+  const float32_t *pX = S->pX;                   /* Abscissas */
+  const float32_t *pY = S->pY;                   /* Values */
+  const float32_t *pC;                           /* Coefficients of the interval */
+  uint32_t last = S->nValues - 1u;               /* Index of the last point */
+  uint32_t seg = 0u;                             /* Interval of the previous point */
+  float32_t xq, t;                               /* Point and its offset in the interval */
+  float32_t h, slopeEnd;                         /* Width of and slope at the end of the last interval */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  pC = S->pCoeffs + (3u * (last - 1u));
+  h = pX[last] - pX[last - 1u];
+  slopeEnd = pC[0] + (h * ((2.0f * pC[1]) + (3.0f * h * pC[2])));
+
+  while(blkCnt > 0u)
+  {
+    xq = *pXq++;
+
+    if(xq < pX[0])
+    {
+      *pDst++ = pY[0] + (S->pCoeffs[0] * (xq - pX[0]));
+    }
+    else if(xq >= pX[last])
+    {
+      *pDst++ = pY[last] + (slopeEnd * (xq - pX[last]));
+    }
+    else
+    {
+      /* pX[seg] <= xq < pX[seg + 1] */
+      while(xq >= pX[seg + 1u])
+      {
+        seg++;
+      }
+
+      while(xq < pX[seg])
+      {
+        seg--;
+      }
+
+      pC = S->pCoeffs + (3u * seg);
+      t = xq - pX[seg];
+      *pDst++ = pY[seg] + (t * (pC[0] + (t * (pC[1] + (t * pC[2])))));
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of SplineInterpolate group
+ */
@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_spline_init_f32.c
+*
+* Description:  Initialization function for the floating-point cubic
+*               spline interpolation.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @defgroup SplineInterpolate Cubic Spline Interpolation
+ *
+ * Cubic spline interpolation fits a third order polynomial between every two neighbouring
+ * points of a table, with the first and second derivatives continuous at the points.
+ * This gives a smooth curve from far fewer points than linear interpolation needs for the
+ * same error, for example to linearize a sensor from its calibration points.
+ *
+ * \par Algorithm:
+ * The table holds <code>nValues</code> points <code>(x[i], y[i])</code> with strictly increasing
+ * <code>x[i]</code>, they do not need to be equally spaced.  On interval <code>i</code>:
+ * <pre>
+ *     y = y[i] + b[i]*t + c[i]*t^2 + d[i]*t^3,   t = x - x[i],   x[i] <= x < x[i+1]
+ * </pre>
+ * riscv_spline_init_f32() solves the tridiagonal system for the second derivatives
+ * <code>M[i]</code> at the points once and stores <code>b[i]</code>, <code>c[i]</code> and
+ * <code>d[i]</code> of every interval.  riscv_spline_f32() then costs a search for the interval
+ * and three multiply-adds per point.
+ *
+ * \par End Conditions:
+ * The system leaves two degrees of freedom, set by the end condition:
+ * - RISCV_SPLINE_NATURAL: <code>M[0] = M[nValues-1] = 0</code>, the curve is straight at the ends.
+ * - RISCV_SPLINE_PARABOLIC_RUNOUT: <code>M[0] = M[1]</code> and <code>M[nValues-1] = M[nValues-2]</code>,
+ *   the first and last intervals are parabolas.
+ *
+ * \par
+ * Points below <code>x[0]</code> or above <code>x[nValues-1]</code> are extrapolated with the
+ * straight line that has the slope of the spline at that end.
+ */
+
+/**
+ * @addtogroup SplineInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point cubic spline interpolation.
+ * @param[out] *S            points to an instance of the spline structure.
+ * @param[in]  type          end condition of the spline.
+ * @param[in]  *pX           points to the <code>nValues</code> abscissas, strictly increasing.
+ * @param[in]  *pY           points to the <code>nValues</code> values.
+ * @param[in]  nValues       number of points, at least 2.
+ * @param[out] *pCoeffs      points to a buffer of <code>3*(nValues-1)</code> words that receives the coefficients.
+ * @param[in]  *pTempBuffer  points to a scratch buffer of <code>2*nValues-1</code> words.
+ * @return     The function returns RISCV_MATH_SUCCESS if initialization is successful, RISCV_MATH_LENGTH_ERROR if
+ * <code>nValues</code> is less than 2, or RISCV_MATH_ARGUMENT_ERROR if <code>type</code> is unknown or the
+ * abscissas are not strictly increasing.
+ *
+ * \par
+ * <code>pX</code>, <code>pY</code> and <code>pCoeffs</code> must stay valid as long as the instance is used,
+ * <code>pTempBuffer</code> is only used during the call.  With two points the spline is a straight line.
+ */
+
+riscv_status riscv_spline_init_f32(
+  riscv_spline_instance_f32 * S,
+  riscv_spline_type type,
+  float32_t * pX,
+  float32_t * pY,
+  uint32_t nValues,
+  float32_t * pCoeffs,
+  float32_t * pTempBuffer)
+{
+  RISCV_PROFILE(riscv_spline_init_f32);
+  float32_t *pM = pTempBuffer;                   /* Second derivatives at the points */
+  float32_t *pCp = pTempBuffer + nValues;        /* Modified superdiagonal of the elimination */
+  float32_t hPrev, h, sPrev, s;                  /* Interval widths and slopes */
+  float32_t diag, den;                           /* Diagonal element and pivot */
+  uint32_t i;                                    /* loop counter */
+
+  if(nValues < 2u)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  if((type != RISCV_SPLINE_NATURAL) && (type != RISCV_SPLINE_PARABOLIC_RUNOUT))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < (nValues - 1u); i++)
+  {
+    if(!(pX[i + 1u] > pX[i]))
+    {
+      return (RISCV_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  pM[0] = 0.0f;
+  pM[nValues - 1u] = 0.0f;
+
+  /* Forward elimination of row i, i = 1..nValues-2:
+   * h[i-1]*M[i-1] + 2*(h[i-1]+h[i])*M[i] + h[i]*M[i+1] = 6*(s[i] - s[i-1]) */
+  hPrev = pX[1] - pX[0];
+  sPrev = (pY[1] - pY[0]) / hPrev;
+
+  for (i = 1u; i < (nValues - 1u); i++)
+  {
+    h = pX[i + 1u] - pX[i];
+    s = (pY[i + 1u] - pY[i]) / h;
+    diag = 2.0f * (hPrev + h);
+
+    if(type == RISCV_SPLINE_PARABOLIC_RUNOUT)
+    {
+      /* M[0] = M[1] and M[nValues-1] = M[nValues-2] fold into the diagonal */
+      if(i == 1u)
+      {
+        diag += hPrev;
+      }
+
+      if(i == (nValues - 2u))
+      {
+        diag += h;
+      }
+    }
+
+    if(i == 1u)
+    {
+      den = diag;
+      pM[i] = (6.0f * (s - sPrev)) / den;
+    }
+    else
+    {
+      den = diag - (hPrev * pCp[i - 1u]);
+      pM[i] = ((6.0f * (s - sPrev)) - (hPrev * pM[i - 1u])) / den;
+    }
+
+    pCp[i] = h / den;
+    hPrev = h;
+    sPrev = s;
+  }
+
+  /* Back substitution */
+  for (i = nValues - 2u; i > 1u; i--)
+  {
+    pM[i - 1u] -= pCp[i - 1u] * pM[i];
+  }
+
+  if((type == RISCV_SPLINE_PARABOLIC_RUNOUT) && (nValues > 2u))
+  {
+    pM[0] = pM[1];
+    pM[nValues - 1u] = pM[nValues - 2u];
+  }
+
+  /* Polynomial coefficients b, c, d of every interval */
+  for (i = 0u; i < (nValues - 1u); i++)
+  {
+    h = pX[i + 1u] - pX[i];
+    pCoeffs[3u * i] = ((pY[i + 1u] - pY[i]) / h) - ((h * ((2.0f * pM[i]) + pM[i + 1u])) / 6.0f);
+    pCoeffs[(3u * i) + 1u] = 0.5f * pM[i];
+    pCoeffs[(3u * i) + 2u] = (pM[i + 1u] - pM[i]) / (6.0f * h);
+  }
+
+  S->type = type;
+  S->pX = pX;
+  S->pY = pY;
+  S->nValues = nValues;
+  S->pCoeffs = pCoeffs;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SplineInterpolate group
+ */
@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_kalman_init_f32.c
+*
+* Description:  Floating-point Kalman filter initialization function.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Kalman filter.
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in]     numStates number of states N.
+ * @param[in,out] *pState points to the N elements of the state estimate x, initialized by the caller.
+ * @param[in,out] *pP points to the N x N covariance matrix structure P, only the upper triangle is used.
+ * @param[in]     *pF points to the N x N state transition matrix structure F.
+ * @param[in]     *pQ points to the N x N process noise covariance matrix structure Q, or NULL for none.
+ * @param[in]     *pWork points to a work buffer of <code>N*(N+1)</code> words.
+ * @return The function returns <code>RISCV_MATH_SIZE_MISMATCH</code> if a matrix is not N x N,
+ * otherwise <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The filter keeps pointers to the state, the matrices and the work buffer, which must outlive it.
+ * F and Q may be changed between calls, for example for a time-varying sampling interval.
+ */
+
+riscv_status riscv_kalman_init_f32(
+  riscv_kalman_instance_f32 * S,
+  uint16_t numStates,
+  float32_t * pState,
+  riscv_matrix_instance_f32 * pP,
+  const riscv_matrix_instance_f32 * pF,
+  const riscv_matrix_instance_f32 * pQ,
+  float32_t * pWork)
+{
+  RISCV_PROFILE(riscv_kalman_init_f32);
+
+  if((pP->numRows != numStates) || (pP->numCols != numStates) ||
+     (pF->numRows != numStates) || (pF->numCols != numStates) ||
+     ((pQ != NULL) && ((pQ->numRows != numStates) || (pQ->numCols != numStates))))
+  {
+    return (RISCV_MATH_SIZE_MISMATCH);
+  }
+
+  S->numStates = numStates;
+  S->pState = pState;
+  S->pP = pP;
+  S->pF = pF;
+  S->pQ = pQ;
+  S->pWork = pWork;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Kalman group
+ */
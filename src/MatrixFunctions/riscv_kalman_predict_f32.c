@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_kalman_predict_f32.c
+*
+* Description:  Floating-point Kalman filter time update.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup Kalman Kalman Filter
+ *
+ * Linear Kalman filter with the state estimate <code>x</code> and its covariance <code>P</code>:
+ * <pre>
+ *    predict:  x = F * x + u               P = F * P * F^T + Q
+ *    update:   s = h * P * h^T + r         K = P * h^T / s
+ *              x = x + K * (z - h * x)     P = (I - K * h) * P * (I - K * h)^T + K * r * K^T
+ * </pre>
+ * \par
+ * The measurements are processed one scalar at a time, each row <code>h</code> of the measurement
+ * matrix with its own variance <code>r</code>.  For a diagonal measurement covariance this gives the
+ * same result as the update with the whole measurement vector, and the innovation covariance
+ * <code>s</code> is a scalar, so no matrix is inverted.  Correlated measurement noise must be
+ * decorrelated first, for example with the Cholesky factor of its covariance.
+ * \par
+ * <code>P</code> is symmetric and both functions update it in place and compute only its upper
+ * triangle, the lower triangle of <code>pP</code> holds no valid data.  The covariance update is the
+ * Joseph form, written symmetrically as
+ * <pre>
+ *    P = P - K * (P * h^T)^T - (P * h^T) * K^T + s * K * K^T
+ * </pre>
+ * which keeps <code>P</code> symmetric by construction.
+ * \par
+ * A time update costs <code>2 * N^3</code> multiply-accumulates with riscv_mat_mult_f32() and
+ * riscv_dot_prod_f32(), a scalar measurement <code>O(N^2)</code>, and zeros of <code>h</code> are skipped.
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Floating-point Kalman filter time update.
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in]     *pControl points to the N elements of the control input <code>u = B * u'</code>, or NULL for none.
+ * @return none.
+ */
+
+void riscv_kalman_predict_f32(
+  const riscv_kalman_instance_f32 * S,
+  const float32_t * pControl)
+{
+  RISCV_PROFILE(riscv_kalman_predict_f32);
+  float32_t *pP = S->pP->pData;                  /* covariance data pointer */
+  float32_t *pF = S->pF->pData;                  /* transition data pointer */
+  float32_t *pT = S->pWork;                      /* F * P */
+  float32_t *pX = S->pState;                     /* state pointer */
+  float32_t sum;                                 /* accumulator */
+  uint32_t n = S->numStates;                     /* number of states */
+  uint32_t i, j;                                 /* loop counters */
+  riscv_matrix_instance_f32 T;                   /* F * P matrix structure */
+
+  /* x = F * x + u */
+  riscv_mat_vec_mult_f32(S->pF, pX, pT);
+
+  for (i = 0u; i < n; i++)
+  {
+    pX[i] = (pControl != NULL) ? (pT[i] + pControl[i]) : pT[i];
+  }
+
+  /* Complete P from its upper triangle */
+  for (i = 1u; i < n; i++)
+  {
+    for (j = 0u; j < i; j++)
+    {
+      pP[(i * n) + j] = pP[(j * n) + i];
+    }
+  }
+
+  riscv_mat_init_f32(&T, (uint16_t) n, (uint16_t) n, pT);
+  riscv_mat_mult_f32(S->pF, S->pP, &T);
+
+  /* Upper triangle of (F * P) * F^T + Q, row i of F * P with row j of F */
+  for (i = 0u; i < n; i++)
+  {
+    for (j = i; j < n; j++)
+    {
+      riscv_dot_prod_f32(pT + (i * n), pF + (j * n), n, &sum);
+
+      if(S->pQ != NULL)
+      {
+        sum += S->pQ->pData[(i * n) + j];
+      }
+
+      pP[(i * n) + j] = sum;
+    }
+  }
+}
+
+/**
+ * @} end of Kalman group
+ */
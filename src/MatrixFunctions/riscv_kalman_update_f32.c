@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_kalman_update_f32.c
+*
+* Description:  Floating-point Kalman filter measurement update with
+*               sequential scalar measurements.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Floating-point Kalman filter update with one scalar measurement.
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in]     *pH points to the N elements of the measurement row h.
+ * @param[in]     z measurement.
+ * @param[in]     r variance of the measurement noise.
+ * @return The function returns <code>RISCV_MATH_SINGULAR</code> and leaves the filter unchanged if the
+ * innovation variance <code>h * P * h^T + r</code> is not positive, otherwise <code>RISCV_MATH_SUCCESS</code>.
+ */
+
+riscv_status riscv_kalman_update_scalar_f32(
+  const riscv_kalman_instance_f32 * S,
+  const float32_t * pH,
+  float32_t z,
+  float32_t r)
+{
+  RISCV_PROFILE(riscv_kalman_update_scalar_f32);
+  float32_t *pP = S->pP->pData;                  /* covariance data pointer */
+  float32_t *pX = S->pState;                     /* state pointer */
+  float32_t *pPh = S->pWork;                     /* P * h^T */
+  float32_t *pK = S->pWork + S->numStates;       /* gain */
+  float32_t s, e, h, sum, ki, phi;               /* innovation variance and innovation */
+  uint32_t n = S->numStates;                     /* number of states */
+  uint32_t i, k;                                 /* loop counters */
+
+  /* P * h^T from the upper triangle of P, and the innovation z - h * x */
+  for (i = 0u; i < n; i++)
+  {
+    pPh[i] = 0.0f;
+  }
+
+  e = z;
+
+  for (k = 0u; k < n; k++)
+  {
+    h = pH[k];
+
+    if(h != 0.0f)
+    {
+      /* column k of P is row k above the diagonal */
+      for (i = 0u; i < k; i++)
+      {
+        pPh[i] += pP[(i * n) + k] * h;
+      }
+
+      for (i = k; i < n; i++)
+      {
+        pPh[i] += pP[(k * n) + i] * h;
+      }
+
+      e -= h * pX[k];
+    }
+  }
+
+  s = r;
+
+  for (k = 0u; k < n; k++)
+  {
+    s += pH[k] * pPh[k];
+  }
+
+  if(!(s > 0.0f))
+  {
+    return (RISCV_MATH_SINGULAR);
+  }
+
+  sum = 1.0f / s;
+
+  for (i = 0u; i < n; i++)
+  {
+    pK[i] = pPh[i] * sum;
+    pX[i] += pK[i] * e;
+  }
+
+  /* Joseph form on the upper triangle */
+  for (i = 0u; i < n; i++)
+  {
+    ki = pK[i];
+    phi = pPh[i];
+
+    for (k = i; k < n; k++)
+    {
+      pP[(i * n) + k] -= (ki * pPh[k]) + (phi * pK[k]) - (s * ki * pK[k]);
+    }
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Floating-point Kalman filter update with a measurement vector.
+ * @param[in,out] *S points to an instance of the floating-point Kalman filter structure.
+ * @param[in]     *pH points to the M x N measurement matrix structure H.
+ * @param[in]     *pZ points to the M measurements.
+ * @param[in]     *pR points to the M variances of the measurement noise, the diagonal of R.
+ * @return The function returns <code>RISCV_MATH_SIZE_MISMATCH</code> if H does not have N columns,
+ * <code>RISCV_MATH_SINGULAR</code> if an innovation variance is not positive, otherwise
+ * <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The rows of H are applied one after the other with riscv_kalman_update_scalar_f32().  A row whose
+ * innovation variance is not positive is skipped, the others are still applied.
+ */
+
+riscv_status riscv_kalman_update_f32(
+  const riscv_kalman_instance_f32 * S,
+  const riscv_matrix_instance_f32 * pH,
+  const float32_t * pZ,
+  const float32_t * pR)
+{
+  RISCV_PROFILE(riscv_kalman_update_f32);
+  riscv_status status = RISCV_MATH_SUCCESS;      /* status of the updates */
+  uint32_t m;                                    /* loop counter */
+
+  if(pH->numCols != S->numStates)
+  {
+    return (RISCV_MATH_SIZE_MISMATCH);
+  }
+
+  for (m = 0u; m < pH->numRows; m++)
+  {
+    if(riscv_kalman_update_scalar_f32(S, pH->pData + (m * S->numStates), pZ[m], pR[m]) != RISCV_MATH_SUCCESS)
+    {
+      status = RISCV_MATH_SINGULAR;
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,158 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_cholesky_f32.c
+*
+* Description:  Floating-point Cholesky decomposition.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixChol Cholesky Decomposition
+ *
+ * Computes the Cholesky decomposition of a symmetric positive definite matrix.
+ *
+ * The lower triangular matrix <code>L</code> with a positive diagonal is computed such that
+ * <pre>
+ *    A = L * L^T
+ * </pre>
+ * Only the lower triangle of <code>A</code> is read.
+ * The decomposition takes about <code>n^3/6</code> multiply-accumulates, a sixth of the Gauss-Jordan
+ * inversion of riscv_mat_inverse_f32(), and together with riscv_mat_cholesky_solve_f32() it lets the
+ * application solve <code>A * X = B</code> without forming the inverse of <code>A</code>.
+ *
+ * \par Algorithm
+ * The rows of <code>L</code> are computed one after the other (Cholesky-Banachiewicz):
+ * <pre>
+ *    L[i][j] = (A[i][j] - sum(L[i][k] * L[j][k], k = 0..j-1)) / L[j][j],    j < i
+ *    L[i][i] = sqrt(A[i][i] - sum(L[i][k]^2, k = 0..i-1))
+ * </pre>
+ * so every sum is a dot product of two contiguous rows.
+ * If the argument of a square root is not positive, the matrix is not positive definite and the
+ * functions return <code>RISCV_MATH_DECOMPOSITION_FAILURE</code>.
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/*
+* @brief  Subtracts the dot product of two rows from a value.
+*/
+
+static float32_t riscv_mat_chol_dot_f32(
+  float32_t sum,
+  const float32_t * pA,
+  const float32_t * pB,
+  uint32_t len)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+  for (blkCnt = len >> 2u; blkCnt > 0u; blkCnt--)
+  {
+    sum -= pA[0] * pB[0];
+    sum -= pA[1] * pB[1];
+    sum -= pA[2] * pB[2];
+    sum -= pA[3] * pB[3];
+    pA += 4;
+    pB += 4;
+  }
+
+  for (blkCnt = len & 3u; blkCnt > 0u; blkCnt--)
+  {
+    sum -= *pA++ * *pB++;
+  }
+
+  return (sum);
+}
+
+/**
+ * @brief Floating-point Cholesky decomposition.
+ * @param[in]       *pSrc points to the instance of the input symmetric positive definite matrix structure.
+ * @param[out]      *pDst points to the instance of the output lower triangular matrix structure.
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If the input matrix is not positive definite, then the function returns
+ * <code>RISCV_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The upper triangle of <code>pDst</code> is set to zero.
+ * <code>pDst</code> may be the same matrix as <code>pSrc</code>, the decomposition is then computed in place.
+ */
+
+riscv_status riscv_mat_cholesky_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pDst)
+{
+  RISCV_PROFILE(riscv_mat_cholesky_f32);
+  const float32_t *pA = pSrc->pData;             /* input data matrix pointer */
+  float32_t *pL = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pLi;                                /* row i of the output */
+  const float32_t *pLj;                          /* row j of the output */
+  float32_t sum;                                 /* accumulator */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j;                                 /* loop counters */
+  riscv_status status;                             /* status of the decomposition */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    status = RISCV_MATH_SUCCESS;
+
+    for (i = 0u; (i < n) && (status == RISCV_MATH_SUCCESS); i++)
+    {
+      pLi = pL + (i * n);
+
+      /* Elements left of the diagonal, A[i][j] is read before L[i][j] overwrites it */
+      for (j = 0u; j < i; j++)
+      {
+        pLj = pL + (j * n);
+        sum = riscv_mat_chol_dot_f32(pA[(i * n) + j], pLi, pLj, j);
+        pLi[j] = sum / pLj[j];
+      }
+
+      /* Diagonal element */
+      sum = riscv_mat_chol_dot_f32(pA[(i * n) + i], pLi, pLi, i);
+
+      /* Also rejects a NaN */
+      if(sum > 0.0f)
+      {
+        pLi[i] = sqrtf(sum);
+      }
+      else
+      {
+        status = RISCV_MATH_DECOMPOSITION_FAILURE;
+      }
+
+      /* Upper triangle */
+      for (j = i + 1u; j < n; j++)
+      {
+        pLi[j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
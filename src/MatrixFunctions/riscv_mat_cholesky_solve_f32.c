@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_cholesky_solve_f32.c
+*
+* Description:  Floating-point symmetric positive definite linear solver.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point symmetric positive definite linear solver.
+ * @param[in]       *pSrcA points to the instance of the symmetric positive definite matrix structure A.
+ * @param[in]       *pSrcB points to the instance of the right-hand side matrix structure B.
+ * @param[out]      *pL points to the instance of the matrix structure that receives the Cholesky factor of A, it may be the same as <code>pSrcA</code>.
+ * @param[out]      *pDst points to the instance of the solution matrix structure X, it may be the same as <code>pSrcB</code>.
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if the sizes of the matrices do not match,
+ * <code>RISCV_MATH_DECOMPOSITION_FAILURE</code> if A is not positive definite,
+ * or <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The function solves <code>A * X = B</code> as <code>L * Y = B</code> with riscv_mat_solve_lower_triangular_f32()
+ * and <code>L^T * X = Y</code> in place, after <code>A = L * L^T</code> with riscv_mat_cholesky_f32().
+ * The transpose of <code>L</code> is never formed, the back substitution reads <code>L</code> by columns.
+ * <code>pL</code> holds the Cholesky factor on return, so further right-hand sides can be solved with the two
+ * substitutions only.
+ */
+
+riscv_status riscv_mat_cholesky_solve_f32(
+  const riscv_matrix_instance_f32 * pSrcA,
+  const riscv_matrix_instance_f32 * pSrcB,
+  riscv_matrix_instance_f32 * pL,
+  riscv_matrix_instance_f32 * pDst)
+{
+  RISCV_PROFILE(riscv_mat_cholesky_solve_f32);
+  const float32_t *pA;                           /* Cholesky factor pointer */
+  float32_t *pXi;                                /* row i of the solution */
+  const float32_t *pXk;                          /* row k of the solution */
+  float32_t a, invDiag;                          /* element and inverted diagonal element of column i */
+  uint32_t n, numCols;                           /* size of the system and number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+  riscv_status status;                             /* status of the solver */
+
+  /* A = L * L^T */
+  status = riscv_mat_cholesky_f32(pSrcA, pL);
+
+  /* L * Y = B */
+  if(status == RISCV_MATH_SUCCESS)
+  {
+    status = riscv_mat_solve_lower_triangular_f32(pL, pSrcB, pDst);
+  }
+
+  /* L^T * X = Y, the diagonal of L is positive */
+  if(status == RISCV_MATH_SUCCESS)
+  {
+    pA = pL->pData;
+    n = pL->numRows;
+    numCols = pDst->numCols;
+
+    for (i = n; i > 0u; )
+    {
+      i--;
+      pXi = pDst->pData + (i * numCols);
+
+      /* Row i of L^T is column i of L */
+      for (k = i + 1u; k < n; k++)
+      {
+        a = pA[(k * n) + i];
+        pXk = pDst->pData + (k * numCols);
+
+        for (c = 0u; c < numCols; c++)
+        {
+          pXi[c] -= a * pXk[c];
+        }
+      }
+
+      invDiag = 1.0f / pA[(i * n) + i];
+
+      for (c = 0u; c < numCols; c++)
+      {
+        pXi[c] *= invDiag;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
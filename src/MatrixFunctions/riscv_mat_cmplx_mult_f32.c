@@ -77,6 +77,7 @@ riscv_status riscv_mat_cmplx_mult_f32(
   const riscv_matrix_instance_f32 * pSrcB,
   riscv_matrix_instance_f32 * pDst)
 {
+  RISCV_PROFILE(riscv_mat_cmplx_mult_f32);
   float32_t *pIn1 = pSrcA->pData;                /* input data matrix pointer A */
   float32_t *pIn2 = pSrcB->pData;                /* input data matrix pointer B */
   float32_t *pInA = pSrcA->pData;                /* input data matrix pointer A  */
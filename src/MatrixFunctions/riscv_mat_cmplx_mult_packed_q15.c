@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_cmplx_mult_packed_q15.c
+*
+* Description:  Q15 complex matrix multiplication with a packed right-hand
+*               matrix.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup CmplxMatrixMult
+ * @{
+ */
+
+/*
+* @brief  Dot product of a complex element of A with a prepared pair of B.
+*/
+
+static q63_t riscv_mat_cmplx_dot2_q15(
+  const q15_t * pa,
+  const q15_t * pb)
+{
+#if defined (USE_DSP_RISCV)
+
+  return ((q63_t) dotpv2(*(shortV *) pa, *(shortV *) pb));
+
+#else
+
+  return (((q63_t) pa[0] * pb[0]) + ((q31_t) pa[1] * pb[1]));
+
+#endif
+}
+
+/**
+ * @brief Q15 complex matrix multiplication with a packed right-hand matrix.
+ * @param[in]       *pSrcA points to the first input complex matrix structure
+ * @param[in]       *pSrcB points to the second input complex matrix, packed by riscv_mat_cmplx_pack_q15()
+ * @param[out]      *pDst points to output complex matrix structure
+ * @return     		The function returns either
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * Every element of A is loaded once as a (re,im) word for two columns of B, and each complex MAC is the two
+ * dotpv2 of riscv_mat_cmplx_pack_q15() in the USE_DSP_RISCV build.  The data of A and the packed data
+ * must be word aligned.  When B is used for several products, for example the channel matrix of a
+ * beamformer applied to many symbols, it is packed once instead of being transposed on every call.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using a 64-bit internal accumulator, as riscv_mat_cmplx_mult_q15().
+ * The 34.30 result is truncated to 34.15 format by discarding the low 15 bits and then saturated to
+ * 1.15 format.
+ */
+
+riscv_status riscv_mat_cmplx_mult_packed_q15(
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_packed_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst)
+{
+  RISCV_PROFILE(riscv_mat_cmplx_mult_packed_q15);
+  const q15_t *pA;                               /* Element of the row of A */
+  const q15_t *pB0, *pB1;                        /* Packed columns of B */
+  q15_t *pOut = pDst->pData;                     /* Output pointer */
+  q63_t re0, im0, re1, im1;                      /* Accumulators */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t i, n, k;                              /* loop counters */
+  riscv_status status;                             /* status of matrix multiplication */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    for (i = 0u; i < numRowsA; i++)
+    {
+      pB0 = pSrcB->pData;
+
+      /* Two columns of B at a time */
+      for (n = 0u; (n + 2u) <= numColsB; n += 2u)
+      {
+        pA = pSrcA->pData + (2u * i * numColsA);
+        pB1 = pB0 + (4u * numColsA);
+        re0 = 0;
+        im0 = 0;
+        re1 = 0;
+        im1 = 0;
+
+        for (k = numColsA; k > 0u; k--)
+        {
+          re0 += riscv_mat_cmplx_dot2_q15(pA, pB0);
+          im0 += riscv_mat_cmplx_dot2_q15(pA, pB0 + 2);
+          re1 += riscv_mat_cmplx_dot2_q15(pA, pB1);
+          im1 += riscv_mat_cmplx_dot2_q15(pA, pB1 + 2);
+          pA += 2;
+          pB0 += 4;
+          pB1 += 4;
+        }
+
+        pOut[0] = (q15_t) __SSAT((re0 >> 15), 16);
+        pOut[1] = (q15_t) __SSAT((im0 >> 15), 16);
+        pOut[2] = (q15_t) __SSAT((re1 >> 15), 16);
+        pOut[3] = (q15_t) __SSAT((im1 >> 15), 16);
+        pOut += 4;
+
+        /* pB0 has reached column n + 1, skip it */
+        pB0 = pB1;
+      }
+
+      /* Last column of an odd number of columns */
+      if(n < numColsB)
+      {
+        pA = pSrcA->pData + (2u * i * numColsA);
+        re0 = 0;
+        im0 = 0;
+
+        for (k = numColsA; k > 0u; k--)
+        {
+          re0 += riscv_mat_cmplx_dot2_q15(pA, pB0);
+          im0 += riscv_mat_cmplx_dot2_q15(pA, pB0 + 2);
+          pA += 2;
+          pB0 += 4;
+        }
+
+        pOut[0] = (q15_t) __SSAT((re0 >> 15), 16);
+        pOut[1] = (q15_t) __SSAT((im0 >> 15), 16);
+        pOut += 2;
+      }
+    }
+
+    /* set status as RISCV_MATH_SUCCESS */
+    status = RISCV_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of CmplxMatrixMult group
+ */
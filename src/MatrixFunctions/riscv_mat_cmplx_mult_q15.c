@@ -82,6 +82,12 @@
  * 1.15 format.
  *
  * \par
+ * In the USE_DSP_RISCV build B is packed into <code>pScratch</code> by riscv_mat_cmplx_pack_q15() and the product
+ * is computed by riscv_mat_cmplx_mult_packed_q15(), so <code>pScratch</code> must hold
+ * <code>4*numRowsB*numColsB</code> elements, <code>2*numRowsB*numColsB</code> otherwise.
+ * Call the two functions directly to pack a constant B only once.
+ *
+ * \par
  * Refer to <code>riscv_mat_mult_fast_q15()</code> for a faster but less precise version of this function.
  *
  */
@@ -95,6 +101,12 @@ riscv_status riscv_mat_cmplx_mult_q15(
   riscv_matrix_instance_q15 * pDst,
   q15_t * pScratch)
 {
+  RISCV_PROFILE(riscv_mat_cmplx_mult_q15);
+  riscv_status status;                             /* status of matrix multiplication */
+
+#if defined (USE_DSP_RISCV)
+  riscv_matrix_packed_instance_q15 packedB;      /* B in the layout of riscv_mat_cmplx_pack_q15() */
+#else
   /* accumulator */
   q15_t *pSrcBT = pScratch;                      /* input data matrix pointer for transpose */
   q15_t *pInA = pSrcA->pData;                    /* input data matrix pointer A of Q15 type */
@@ -105,12 +117,13 @@ riscv_status riscv_mat_cmplx_mult_q15(
   uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
   uint16_t numRowsB = pSrcB->numRows;            /* number of rows of input matrix A    */
   uint16_t col, i = 0u, row = numRowsB, colCnt;  /* loop counters */
-  riscv_status status;                             /* status of matrix multiplication */
   q63_t sumReal, sumImag;
 
 
   q15_t in;                                      /* Temporary variable to hold the input value */
   q15_t a, b, c, d;
+#endif
+
 #ifdef RISCV_MATH_MATRIX_CHECK
   /* Check for matrix mismatch condition */
   if ((pSrcA->numCols != pSrcB->numRows) ||
@@ -122,156 +135,12 @@ riscv_status riscv_mat_cmplx_mult_q15(
   else
 #endif
 #if defined (USE_DSP_RISCV)
-{
-    shortV VectInA;
-    shortV VectInB; 
-    /* Matrix transpose */
-    do
-    {
-
-      /* The pointer px is set to starting address of the column being processed */
-      px = pSrcBT + i;
-
-
-      col = numColsB;
-
-      while (col > 0u)
-      {
-        /* Read two elements from the row */
-        *(shortV*)px = *(shortV*)pInB;
-        pInB+=2;
-        /* Update the pointer px to point to the next row of the transposed matrix */
-        px += numRowsB * 2;
-
-        /* Decrement the column loop counter */
-        col--;
-      }
-
-      i = i + 2u;
-
-      /* Decrement the row loop counter */
-      row--;
-
-    } while (row > 0u);
-
-    /* Reset the variables for the usage in the following multiplication process */
-    row = numRowsA;
-    i = 0u;
-    px = pDst->pData;
-
-    /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
-    /* row loop */
-    do
-    {
-      /* For every row wise process, the column loop counter is to be initiated */
-      col = numColsB;
-
-      /* For every row wise process, the pIn2 pointer is set
-       ** to the starting address of the transposed pSrcB data */
-      pInB = pSrcBT;
-
-      /* column loop */
-      do
-      {
-        /* Set the variable sum, that acts as accumulator, to zero */
-        sumReal = 0;
-        sumImag = 0;
-
-        /* Apply loop unrolling and compute 2 MACs simultaneously. */
-        colCnt = numColsA >> 1;
-
-        /* Initiate the pointer pIn1 to point to the starting address of the column being processed */
-        pInA = pSrcA->pData + i * 2;
-
-
-        /* matrix multiplication */
-        while (colCnt > 0u)
-        {
-          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-
-
-
-          /* read real and imag values from pSrcA buffer */
-          VectInA = *(shortV*)pInA;
-          VectInA[1] = -VectInA[1];
-          VectInB = *(shortV*)pInB;
-
-          /* Multiply and Accumlates */
-          sumReal += dotpv2(VectInA,VectInB);
-          VectInA[1] =  -VectInA[1];
-          d = VectInB[0];
-          VectInB[0] = VectInB[1] ;
-          VectInB[1] = d;
-          sumImag += dotpv2(VectInA,VectInB);
-
-          /* read next real and imag values from pSrcA buffer */
-          VectInA = *(shortV*)(pInA+2);
-          VectInA[1] = -VectInA[1];
-          VectInB = *(shortV*)(pInB+2);
-
-          /* update pointer */
-          pInA += 4u;
-
-          /* Multiply and Accumlates */
-          sumReal += dotpv2(VectInA,VectInB);
-          VectInA[1] =  -VectInA[1];
-          d = VectInB[0];
-          VectInB[0] = VectInB[1] ;
-          VectInB[1] = d;
-          sumImag += dotpv2(VectInA,VectInB);
-          /* update pointer */
-          pInB += 4u;
-
-
-          /* Decrement the loop counter */
-          colCnt--;
-        }
-
-        /* process odd column samples */
-        if ((numColsA & 0x1u) > 0u)
-        {
-          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-
-
-
-          /* read real and imag values from pSrcA and pSrcB buffer */
-          a = *pInA++;
-          b = *pInA++;
-          c = *pInB++;
-          d = *pInB++;
-
-          /* Multiply and Accumlates */
-          VectInA[0] = a;
-          VectInA[1] = -b;
-          VectInB[0] = c;
-          VectInB[1] = d;
-          /* Multiply and Accumlates */
-          sumReal += dotpv2(VectInA,VectInB);
-          VectInA[1] = b;
-          VectInB[0] = d;
-          VectInB[1] = c;
-          sumImag += dotpv2(VectInA,VectInB);
-
-        }
-
-        /* Saturate and store the result in the destination buffer */
-        *px++ = (q15_t) (clip(sumReal >> 15, -32768,32767));
-        *px++ = (q15_t) (clip(sumImag >> 15,-32768,32767));
-        /* Decrement the column loop counter */
-        col--;
-
-      } while (col > 0u);
-
-      i = i + numColsA;
-
-      /* Decrement the row loop counter */
-      row--;
-
-    } while (row > 0u);
+  {
+    /* Transpose B once into (re,-im) and (im,re) words, every complex MAC is then two dotpv2 */
+    riscv_mat_cmplx_pack_q15(pSrcB, &packedB, pScratch);
 
-    /* set status as RISCV_MATH_SUCCESS */
-    status = RISCV_MATH_SUCCESS;
-}
+    status = riscv_mat_cmplx_mult_packed_q15(pSrcA, &packedB, pDst);
+  }
 #else
 
   {
@@ -78,6 +78,7 @@ riscv_status riscv_mat_cmplx_mult_q31(
   const riscv_matrix_instance_q31 * pSrcB,
   riscv_matrix_instance_q31 * pDst)
 {
+  RISCV_PROFILE(riscv_mat_cmplx_mult_q31);
   q31_t *pIn1 = pSrcA->pData;                    /* input data matrix pointer A */
   q31_t *pIn2 = pSrcB->pData;                    /* input data matrix pointer B */
   q31_t *pInA = pSrcA->pData;                    /* input data matrix pointer A  */
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_cmplx_pack_q15.c
+*
+* Description:  Packs a Q15 complex matrix for riscv_mat_cmplx_mult_packed_q15().
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup CmplxMatrixMult
+ * @{
+ */
+
+/**
+ * @brief Packs the right-hand Q15 complex matrix of riscv_mat_cmplx_mult_packed_q15().
+ * @param[in]  *pSrc   points to the complex matrix B of <code>numRows x numCols</code> elements.
+ * @param[out] *pDst   points to the packed matrix structure.
+ * @param[in]  *pData  points to a buffer of <code>4*numRows*numCols</code> elements that receives the packed data.
+ * @return none.
+ *
+ * \par
+ * The product of <code>a = (ar, ai)</code> and <code>b = (br, bi)</code> is
+ * <pre>
+ *    re = ar * br - ai * bi = (ar, ai) . (br, -bi)
+ *    im = ar * bi + ai * br = (ar, ai) . (bi,  br)
+ * </pre>
+ * so with both right-hand words prepared a complex MAC is two dotpv2 on the unmodified (re,im) word of A.
+ * The function stores B column after column, every element as the four values
+ * <pre>
+ *    br, -bi, bi, br
+ * </pre>
+ * <code>-bi</code> is saturated, so -32768 is stored as 32767.
+ * \par
+ * <code>pData</code> must stay valid as long as the packed matrix is used, <code>pSrc</code> is no longer needed.
+ */
+
+void riscv_mat_cmplx_pack_q15(
+  const riscv_matrix_instance_q15 * pSrc,
+  riscv_matrix_packed_instance_q15 * pDst,
+  q15_t * pData)
+{
+  RISCV_PROFILE(riscv_mat_cmplx_pack_q15);
+  const q15_t *pB;                               /* Element of B */
+  q15_t *pOut = pData;                           /* Packed data pointer */
+  uint32_t numRows = pSrc->numRows;              /* Number of rows of B */
+  uint32_t numCols = pSrc->numCols;              /* Number of columns of B */
+  uint32_t k, n;                                 /* Loop counters */
+
+  for (n = 0u; n < numCols; n++)
+  {
+    pB = pSrc->pData + (2u * n);
+
+    for (k = 0u; k < numRows; k++)
+    {
+      pOut[0] = pB[0];
+      pOut[1] = (q15_t) __SSAT(-(q31_t) pB[1], 16);
+      pOut[2] = pB[1];
+      pOut[3] = pB[0];
+      pOut += 4;
+      pB += 2u * numCols;
+    }
+  }
+
+  pDst->numRows = (uint16_t) numRows;
+  pDst->numCols = (uint16_t) numCols;
+  pDst->pData = pData;
+}
+
+/**
+ * @} end of CmplxMatrixMult group
+ */
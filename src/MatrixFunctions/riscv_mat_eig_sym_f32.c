@@ -0,0 +1,236 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_eig_sym_f32.c
+*
+* Description:  Floating-point eigen-decomposition of a symmetric matrix with
+*               cyclic Jacobi rotations.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixEig Eigenvalues and Singular Values
+ *
+ * Computes the decompositions
+ * <pre>
+ *    A = V * diag(lambda) * V^T      A symmetric N x N
+ *    A = U * diag(sigma) * V^T       A of M x N with M >= N
+ * </pre>
+ * for the subspace methods of sensor arrays (MUSIC, ESPRIT, PCA of a covariance matrix from
+ * riscv_covariance_f32()), on matrices of a few to a few tens of rows.  The eigenvalues and the
+ * singular values are sorted from the largest down, with the vectors in the same order: the first
+ * columns span the signal subspace, the last ones the noise subspace.
+ *
+ * \par Algorithm
+ * Both functions use cyclic Jacobi rotations, which are accurate, need no memory beyond the outputs
+ * and are simple enough for small matrices.  A sweep visits every pair <code>(p, q)</code> with
+ * <code>p < q</code>:
+ * - riscv_mat_eig_sym_f32() zeroes <code>a_pq</code> with the rotation <code>A = J^T * A * J</code>,
+ *   applied to rows <code>p</code> and <code>q</code>, then to the same columns.
+ * - riscv_mat_svd_f32() is the one-sided Jacobi method: it rotates columns <code>p</code> and
+ *   <code>q</code> of <code>U</code>, starting from <code>A</code>, until they are orthogonal.  The
+ *   singular values are the norms of the final columns.
+ * \par
+ * <code>tol</code> sets the early exit: a pair is skipped when its off-diagonal element, or the
+ * cosine of the angle between the two columns, is below <code>tol</code> relative to the matrix, and
+ * the functions return after the first sweep without a rotation.  Values near 1e-6 reach the
+ * accuracy of single precision in 5 to 8 sweeps for 4x4 to 16x16 matrices; larger values stop
+ * earlier with a coarser result.  The functions give up after RISCV_MAT_JACOBI_MAX_SWEEPS sweeps.
+ */
+
+/**
+ * @addtogroup MatrixEig
+ * @{
+ */
+
+/*
+* @brief  Applies a Jacobi rotation to two vectors, x = c x - s y, y = s x + c y.
+* @param[in,out] *pX      points to the first vector.
+* @param[in,out] *pY      points to the second vector.
+* @param[in]     stride   distance between two elements of a vector.
+* @param[in]     len      number of elements.
+* @param[in]     c        cosine of the rotation.
+* @param[in]     s        sine of the rotation.
+*/
+
+static void riscv_jacobi_rotate_f32(
+  float32_t * pX,
+  float32_t * pY,
+  uint32_t stride,
+  uint32_t len,
+  float32_t c,
+  float32_t s)
+{
+  float32_t x, y;                                /* Elements of the two vectors */
+  uint32_t k;                                    /* loop counter */
+
+  for (k = 0u; k < len; k++)
+  {
+    x = *pX;
+    y = *pY;
+    *pX = (c * x) - (s * y);
+    *pY = (s * x) + (c * y);
+    pX += stride;
+    pY += stride;
+  }
+}
+
+/**
+ * @brief Floating-point eigen-decomposition of a symmetric matrix.
+ * @param[in]       *pSrc points to the symmetric input matrix structure A, <code>N x N</code>
+ * @param[out]      *pDst points to the <code>N x N</code> work matrix structure, it may be the same as <code>pSrc</code>
+ * @param[out]      *pVec points to the <code>N x N</code> output matrix structure of the eigenvectors, one per column, or NULL
+ * @param[out]      *pVal points to the <code>N</code> eigenvalues, largest first
+ * @param[in]       tol relative threshold of the off-diagonal elements, for example 1e-6
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if A is not square or the sizes of the outputs do not match,
+ * <code>RISCV_MATH_DECOMPOSITION_FAILURE</code> if the rotations have not converged after
+ * RISCV_MAT_JACOBI_MAX_SWEEPS sweeps, otherwise <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * Only the symmetry of A is assumed, not its definiteness.  On return <code>pDst</code> holds the
+ * rotated matrix, diagonal up to <code>tol</code>, in the order of the rotations; the off-diagonal
+ * elements below <code>tol * ||A|| / N</code> are the ones left.  The eigenvectors are orthonormal,
+ * each one only unique up to its sign.
+ */
+
+riscv_status riscv_mat_eig_sym_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pDst,
+  riscv_matrix_instance_f32 * pVec,
+  float32_t * pVal,
+  float32_t tol)
+{
+  RISCV_PROFILE(riscv_mat_eig_sym_f32);
+  float32_t *pA = pDst->pData;                   /* Work matrix data pointer */
+  float32_t apq, theta, t, c, s;                 /* Element to zero and the rotation */
+  float32_t norm2 = 0.0f, thr, v;
+  uint32_t N = pSrc->numRows;                    /* size of the matrix */
+  uint32_t p, q, sweep, rotated, best;           /* loop counters */
+  riscv_status status;                             /* status of the decomposition */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numCols != N) || (pDst->numRows != N) || (pDst->numCols != N) ||
+     ((pVec != NULL) && ((pVec->numRows != N) || (pVec->numCols != N))))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    if(pA != pSrc->pData)
+    {
+      memcpy(pA, pSrc->pData, N * N * sizeof(float32_t));
+    }
+
+    if(pVec != NULL)
+    {
+      /* V = I */
+      memset(pVec->pData, 0, N * N * sizeof(float32_t));
+      for (p = 0u; p < N; p++)
+      {
+        pVec->pData[(p * N) + p] = 1.0f;
+      }
+    }
+
+    /* the Frobenius norm is kept by the rotations */
+    for (p = 0u; p < N * N; p++)
+    {
+      norm2 += pA[p] * pA[p];
+    }
+    thr = (tol * sqrtf(norm2)) / (float32_t) N;
+
+    status = RISCV_MATH_DECOMPOSITION_FAILURE;
+    for (sweep = 0u; sweep < RISCV_MAT_JACOBI_MAX_SWEEPS; sweep++)
+    {
+      rotated = 0u;
+
+      for (p = 0u; p + 1u < N; p++)
+      {
+        for (q = p + 1u; q < N; q++)
+        {
+          apq = pA[(p * N) + q];
+          if(fabsf(apq) <= thr)
+          {
+            continue;
+          }
+
+          /* t = tan(phi) of the smaller of the two angles that zero a_pq */
+          theta = (pA[(q * N) + q] - pA[(p * N) + p]) / (2.0f * apq);
+          t = 1.0f / (fabsf(theta) + sqrtf((theta * theta) + 1.0f));
+          t = (theta < 0.0f) ? -t : t;
+          c = 1.0f / sqrtf((t * t) + 1.0f);
+          s = t * c;
+
+          /* A = J^T * A on rows p and q, unit stride, then A * J on columns p and q */
+          riscv_jacobi_rotate_f32(pA + (p * N), pA + (q * N), 1u, N, c, s);
+          riscv_jacobi_rotate_f32(pA + p, pA + q, N, N, c, s);
+          pA[(p * N) + q] = 0.0f;
+          pA[(q * N) + p] = 0.0f;
+
+          /* V = V * J */
+          if(pVec != NULL)
+          {
+            riscv_jacobi_rotate_f32(pVec->pData + p, pVec->pData + q, N, N, c, s);
+          }
+
+          rotated++;
+        }
+      }
+
+      if(rotated == 0u)
+      {
+        status = RISCV_MATH_SUCCESS;
+        break;
+      }
+    }
+
+    for (p = 0u; p < N; p++)
+    {
+      pVal[p] = pA[(p * N) + p];
+    }
+
+    /* largest first, the eigenvectors follow their eigenvalue */
+    for (p = 0u; p + 1u < N; p++)
+    {
+      best = p;
+      for (q = p + 1u; q < N; q++)
+      {
+        best = (pVal[q] > pVal[best]) ? q : best;
+      }
+
+      if(best != p)
+      {
+        v = pVal[p];
+        pVal[p] = pVal[best];
+        pVal[best] = v;
+
+        if(pVec != NULL)
+        {
+          for (q = 0u; q < N; q++)
+          {
+            v = pVec->pData[(q * N) + p];
+            pVec->pData[(q * N) + p] = pVec->pData[(q * N) + best];
+            pVec->pData[(q * N) + best] = v;
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixEig group
+ */
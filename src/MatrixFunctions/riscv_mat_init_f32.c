@@ -75,6 +75,7 @@ void riscv_mat_init_f32(
   uint16_t nColumns,
   float32_t * pData)
 {
+  RISCV_PROFILE(riscv_mat_init_f32);
   /* Assign Number of Rows */
   S->numRows = nRows;
 
@@ -67,6 +67,7 @@ void riscv_mat_init_q15(
   uint16_t nColumns,
   q15_t * pData)
 {
+  RISCV_PROFILE(riscv_mat_init_q15);
   /* Assign Number of Rows */
   S->numRows = nRows;
 
@@ -71,6 +71,7 @@ void riscv_mat_init_q31(
   uint16_t nColumns,
   q31_t * pData)
 {
+  RISCV_PROFILE(riscv_mat_init_q31);
   /* Assign Number of Rows */
   S->numRows = nRows;
 
@@ -0,0 +1,247 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_inverse_batch_f32.c
+*
+* Description:  Fixed-size and batched floating-point matrix inverse.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixBatch
+ * @{
+ */
+
+/**
+ * @brief Floating-point 2x2 matrix inverse.
+ * @param[in]       *pSrc points to the 4 elements of the input matrix
+ * @param[out]      *pDst points to the 4 elements of the output matrix, it may be the same as <code>pSrc</code>
+ * @return     		The function returns
+ * <code>RISCV_MATH_SINGULAR</code> if the determinant is zero, otherwise <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The fixed-size functions use the adjugate matrix divided by the determinant instead of the Gauss-Jordan
+ * elimination of riscv_mat_inverse_f32().  Without pivoting they are less accurate for ill-conditioned
+ * matrices, which is acceptable for rotations and well-scaled transforms.
+ * If the determinant is zero, <code>pDst</code> is not written.
+ */
+
+riscv_status riscv_mat_inverse_2x2_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_inverse_2x2_f32);
+  float32_t a00 = pSrc[0], a01 = pSrc[1];        /* Elements of the input */
+  float32_t a10 = pSrc[2], a11 = pSrc[3];
+  float32_t det, invDet;                         /* Determinant and its inverse */
+
+  det = (a00 * a11) - (a01 * a10);
+
+  if(det == 0.0f)
+  {
+    return (RISCV_MATH_SINGULAR);
+  }
+
+  invDet = 1.0f / det;
+
+  pDst[0] = a11 * invDet;
+  pDst[1] = -a01 * invDet;
+  pDst[2] = -a10 * invDet;
+  pDst[3] = a00 * invDet;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief Floating-point 3x3 matrix inverse.
+ * @param[in]       *pSrc points to the 9 elements of the input matrix
+ * @param[out]      *pDst points to the 9 elements of the output matrix, it may be the same as <code>pSrc</code>
+ * @return     		The function returns
+ * <code>RISCV_MATH_SINGULAR</code> if the determinant is zero, otherwise <code>RISCV_MATH_SUCCESS</code>.
+ */
+
+riscv_status riscv_mat_inverse_3x3_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_inverse_3x3_f32);
+  float32_t a00 = pSrc[0], a01 = pSrc[1], a02 = pSrc[2];  /* Elements of the input */
+  float32_t a10 = pSrc[3], a11 = pSrc[4], a12 = pSrc[5];
+  float32_t a20 = pSrc[6], a21 = pSrc[7], a22 = pSrc[8];
+  float32_t c00, c01, c02;                       /* Cofactors of the first row */
+  float32_t det, invDet;                         /* Determinant and its inverse */
+
+  c00 = (a11 * a22) - (a12 * a21);
+  c01 = (a12 * a20) - (a10 * a22);
+  c02 = (a10 * a21) - (a11 * a20);
+
+  det = (a00 * c00) + (a01 * c01) + (a02 * c02);
+
+  if(det == 0.0f)
+  {
+    return (RISCV_MATH_SINGULAR);
+  }
+
+  invDet = 1.0f / det;
+
+  /* Transposed cofactor matrix divided by the determinant */
+  pDst[0] = c00 * invDet;
+  pDst[1] = ((a02 * a21) - (a01 * a22)) * invDet;
+  pDst[2] = ((a01 * a12) - (a02 * a11)) * invDet;
+  pDst[3] = c01 * invDet;
+  pDst[4] = ((a00 * a22) - (a02 * a20)) * invDet;
+  pDst[5] = ((a02 * a10) - (a00 * a12)) * invDet;
+  pDst[6] = c02 * invDet;
+  pDst[7] = ((a01 * a20) - (a00 * a21)) * invDet;
+  pDst[8] = ((a00 * a11) - (a01 * a10)) * invDet;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief Floating-point 4x4 matrix inverse.
+ * @param[in]       *pSrc points to the 16 elements of the input matrix
+ * @param[out]      *pDst points to the 16 elements of the output matrix, it may be the same as <code>pSrc</code>
+ * @return     		The function returns
+ * <code>RISCV_MATH_SINGULAR</code> if the determinant is zero, otherwise <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The cofactors are computed from the twelve 2x2 minors of the first two and the last two rows,
+ * which takes about 100 multiplications instead of the 4x4x8 row operations of the Gauss-Jordan method.
+ */
+
+riscv_status riscv_mat_inverse_4x4_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_inverse_4x4_f32);
+  float32_t a00 = pSrc[0], a01 = pSrc[1], a02 = pSrc[2], a03 = pSrc[3];  /* Elements of the input */
+  float32_t a10 = pSrc[4], a11 = pSrc[5], a12 = pSrc[6], a13 = pSrc[7];
+  float32_t a20 = pSrc[8], a21 = pSrc[9], a22 = pSrc[10], a23 = pSrc[11];
+  float32_t a30 = pSrc[12], a31 = pSrc[13], a32 = pSrc[14], a33 = pSrc[15];
+  float32_t s0, s1, s2, s3, s4, s5;              /* 2x2 minors of rows 0 and 1 */
+  float32_t c0, c1, c2, c3, c4, c5;              /* 2x2 minors of rows 2 and 3 */
+  float32_t det, invDet;                         /* Determinant and its inverse */
+
+  s0 = (a00 * a11) - (a10 * a01);
+  s1 = (a00 * a12) - (a10 * a02);
+  s2 = (a00 * a13) - (a10 * a03);
+  s3 = (a01 * a12) - (a11 * a02);
+  s4 = (a01 * a13) - (a11 * a03);
+  s5 = (a02 * a13) - (a12 * a03);
+
+  c0 = (a20 * a31) - (a30 * a21);
+  c1 = (a20 * a32) - (a30 * a22);
+  c2 = (a20 * a33) - (a30 * a23);
+  c3 = (a21 * a32) - (a31 * a22);
+  c4 = (a21 * a33) - (a31 * a23);
+  c5 = (a22 * a33) - (a32 * a23);
+
+  det = (s0 * c5) - (s1 * c4) + (s2 * c3) + (s3 * c2) - (s4 * c1) + (s5 * c0);
+
+  if(det == 0.0f)
+  {
+    return (RISCV_MATH_SINGULAR);
+  }
+
+  invDet = 1.0f / det;
+
+  pDst[0] = ((a11 * c5) - (a12 * c4) + (a13 * c3)) * invDet;
+  pDst[1] = ((a02 * c4) - (a01 * c5) - (a03 * c3)) * invDet;
+  pDst[2] = ((a31 * s5) - (a32 * s4) + (a33 * s3)) * invDet;
+  pDst[3] = ((a22 * s4) - (a21 * s5) - (a23 * s3)) * invDet;
+
+  pDst[4] = ((a12 * c2) - (a10 * c5) - (a13 * c1)) * invDet;
+  pDst[5] = ((a00 * c5) - (a02 * c2) + (a03 * c1)) * invDet;
+  pDst[6] = ((a32 * s2) - (a30 * s5) - (a33 * s1)) * invDet;
+  pDst[7] = ((a20 * s5) - (a22 * s2) + (a23 * s1)) * invDet;
+
+  pDst[8] = ((a10 * c4) - (a11 * c2) + (a13 * c0)) * invDet;
+  pDst[9] = ((a01 * c2) - (a00 * c4) - (a03 * c0)) * invDet;
+  pDst[10] = ((a30 * s4) - (a31 * s2) + (a33 * s0)) * invDet;
+  pDst[11] = ((a21 * s2) - (a20 * s4) - (a23 * s0)) * invDet;
+
+  pDst[12] = ((a11 * c1) - (a10 * c3) - (a12 * c0)) * invDet;
+  pDst[13] = ((a00 * c3) - (a01 * c1) + (a02 * c0)) * invDet;
+  pDst[14] = ((a31 * s1) - (a30 * s3) - (a32 * s0)) * invDet;
+  pDst[15] = ((a20 * s3) - (a21 * s1) + (a22 * s0)) * invDet;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief Batched floating-point matrix inverse.
+ * @param[in]       *pSrc points to the input matrices
+ * @param[out]      *pDst points to the output matrices, it may be the same as <code>pSrc</code>
+ * @param[in]       dim size of the matrices, 2, 3 or 4
+ * @param[in]       numMatrices number of matrices
+ * @return     		The function returns
+ * <code>RISCV_MATH_ARGUMENT_ERROR</code> if <code>dim</code> is not 2, 3 or 4,
+ * <code>RISCV_MATH_SINGULAR</code> if at least one of the matrices is singular, otherwise <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * A singular matrix does not stop the batch, the other matrices are still inverted and the output of the singular
+ * matrix is not written.
+ */
+
+riscv_status riscv_mat_inverse_batch_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint16_t dim,
+  uint32_t numMatrices)
+{
+  RISCV_PROFILE(riscv_mat_inverse_batch_f32);
+  uint32_t size = (uint32_t) dim * dim;          /* Elements per matrix */
+  uint32_t m;                                    /* Matrix counter */
+  riscv_status status = RISCV_MATH_SUCCESS;      /* status of the batch */
+
+  /* One loop per size, so that the fixed-size function can be inlined */
+  switch (dim)
+  {
+  case 2u:
+    for (m = 0u; m < numMatrices; m++)
+    {
+      if(riscv_mat_inverse_2x2_f32(pSrc + (m * size), pDst + (m * size)) != RISCV_MATH_SUCCESS)
+      {
+        status = RISCV_MATH_SINGULAR;
+      }
+    }
+    break;
+
+  case 3u:
+    for (m = 0u; m < numMatrices; m++)
+    {
+      if(riscv_mat_inverse_3x3_f32(pSrc + (m * size), pDst + (m * size)) != RISCV_MATH_SUCCESS)
+      {
+        status = RISCV_MATH_SINGULAR;
+      }
+    }
+    break;
+
+  case 4u:
+    for (m = 0u; m < numMatrices; m++)
+    {
+      if(riscv_mat_inverse_4x4_f32(pSrc + (m * size), pDst + (m * size)) != RISCV_MATH_SUCCESS)
+      {
+        status = RISCV_MATH_SINGULAR;
+      }
+    }
+    break;
+
+  default:
+    status = RISCV_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MatrixBatch group
+ */
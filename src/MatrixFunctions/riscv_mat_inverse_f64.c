@@ -55,8 +55,9 @@
  * is non-zero). The function checks that the input and output matrices are square and of the    
  * same size.    
  *    
- * Matrix inversion is numerically sensitive and the CMSIS DSP library only supports matrix    
- * inversion of floating-point matrices.    
+ * Matrix inversion is numerically sensitive.  The floating-point functions return the inverse in the    
+ * format of the input, riscv_mat_inverse_q31() and riscv_mat_inverse_q15() use integer arithmetic only    
+ * and return every column of the inverse as a block floating-point vector, see riscv_mat_solve_q31().    
  *    
  * \par Algorithm    
  * The Gauss-Jordan method is used to find the inverse.    
@@ -88,6 +89,7 @@ riscv_status riscv_mat_inverse_f64(
   const riscv_matrix_instance_f64 * pSrc,
   riscv_matrix_instance_f64 * pDst)
 {
+  RISCV_PROFILE(riscv_mat_inverse_f64);
   float64_t *pIn = pSrc->pData;                  /* input data matrix pointer */
   float64_t *pOut = pDst->pData;                 /* output data matrix pointer */
   float64_t *pInT1, *pInT2;                      /* Temporary input data matrix pointer */
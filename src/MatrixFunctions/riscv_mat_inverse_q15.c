@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_inverse_q15.c
+*
+* Description:  Q15 block floating-point matrix inverse.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixInv
+ * @{
+ */
+
+/**
+ * @brief Q15 matrix inverse with block floating-point scaling.
+ * @param[in]       *pSrc points to input matrix structure
+ * @param[out]      *pDst points to the mantissas of the inverse
+ * @param[out]      *pState points to a buffer of <code>2*numRows*numRows</code> words.
+ * @param[out]      *pExp points to the <code>numCols</code> exponents of the columns of the inverse
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If the input matrix is found to be singular (non-invertible), then the function returns
+ * <code>RISCV_MATH_SINGULAR</code>.  Otherwise, the function returns <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The function converts the input to Q31 in <code>pState</code>, inverts it with riscv_mat_inverse_q31()
+ * and truncates the normalized mantissas to 1.15 format, so the value of element <code>[i][c]</code> of
+ * the inverse is <code>pDst->pData[i * numCols + c] * 2^pExp[c]</code>.
+ */
+
+riscv_status riscv_mat_inverse_q15(
+  const riscv_matrix_instance_q15 * pSrc,
+  riscv_matrix_instance_q15 * pDst,
+  q31_t * pState,
+  int8_t * pExp)
+{
+  RISCV_PROFILE(riscv_mat_inverse_q15);
+  riscv_matrix_instance_q31 A, X;                /* Q31 copy of the input and inverse */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i;                                    /* loop counter */
+  riscv_status status;                             /* status of matrix inverse */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    riscv_mat_init_q31(&A, (uint16_t) n, (uint16_t) n, pState);
+    riscv_mat_init_q31(&X, (uint16_t) n, (uint16_t) n, pState + (n * n));
+
+    for (i = 0u; i < (n * n); i++)
+    {
+      A.pData[i] = (q31_t) pSrc->pData[i] << 16;
+    }
+
+    status = riscv_mat_inverse_q31(&A, &X, A.pData, pExp);
+
+    if(status == RISCV_MATH_SUCCESS)
+    {
+      for (i = 0u; i < (n * n); i++)
+      {
+        pDst->pData[i] = (q15_t) (X.pData[i] >> 16);
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixInv group
+ */
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_inverse_q31.c
+*
+* Description:  Q31 block floating-point matrix inverse.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixInv
+ * @{
+ */
+
+/**
+ * @brief Q31 matrix inverse with block floating-point scaling.
+ * @param[in]       *pSrc points to input matrix structure
+ * @param[out]      *pDst points to the mantissas of the inverse
+ * @param[out]      *pState points to a buffer of <code>numRows*numRows</code> words, it may be the data of <code>pSrc</code>.
+ * @param[out]      *pExp points to the <code>numCols</code> exponents of the columns of the inverse
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If the input matrix is found to be singular (non-invertible), then the function returns
+ * <code>RISCV_MATH_SINGULAR</code>.  Otherwise, the function returns <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The function solves <code>A * X = I</code> with riscv_mat_solve_q31(), so it uses integer arithmetic only.
+ * The value of element <code>[i][c]</code> of the inverse is <code>pDst->pData[i * numCols + c] * 2^pExp[c]</code>
+ * in 1.31 format.
+ */
+
+riscv_status riscv_mat_inverse_q31(
+  const riscv_matrix_instance_q31 * pSrc,
+  riscv_matrix_instance_q31 * pDst,
+  q31_t * pState,
+  int8_t * pExp)
+{
+  RISCV_PROFILE(riscv_mat_inverse_q31);
+  q31_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i;                                    /* loop counter */
+  riscv_status status;                             /* status of matrix inverse */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    /* The identity matrix, 0.5 * 2^1 */
+    memset(pOut, 0, n * n * sizeof(q31_t));
+
+    for (i = 0u; i < n; i++)
+    {
+      pOut[(i * n) + i] = 0x40000000;
+      pExp[i] = 1;
+    }
+
+    status = riscv_mat_solve_q31(pSrc, pDst, pDst, pState, pExp);
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixInv group
+ */
@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_ldlt_f32.c
+*
+* Description:  Floating-point LDL^T decomposition.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixLDLT LDL^T Decomposition
+ *
+ * Computes the LDL^T decomposition of a symmetric matrix.
+ *
+ * The unit lower triangular matrix <code>L</code> and the diagonal matrix <code>D</code> are computed such that
+ * <pre>
+ *    A = L * D * L^T
+ * </pre>
+ * Only the lower triangle of <code>A</code> is read and <code>D</code> is returned as a vector of its
+ * diagonal.  Unlike the Cholesky decomposition no square root is taken, which saves <code>n</code> calls
+ * to the square root on a core without a hardware square root, and the decomposition also exists for
+ * symmetric indefinite matrices whose leading principal minors are not zero.
+ *
+ * \par Algorithm
+ * The rows are computed one after the other without pivoting.  Row <code>i</code> first holds
+ * <code>W[i][j] = L[i][j] * D[j]</code>:
+ * <pre>
+ *    W[i][j] = A[i][j] - sum(W[i][k] * L[j][k], k = 0..j-1),    j < i
+ *    L[i][j] = W[i][j] / D[j]
+ *    D[i]    = A[i][i] - sum(W[i][k] * L[i][k], k = 0..i-1)
+ * </pre>
+ * which needs no buffer beyond the output.  If a <code>D[i]</code> is zero the decomposition does not exist
+ * without pivoting and the functions return <code>RISCV_MATH_DECOMPOSITION_FAILURE</code>.
+ * For a symmetric positive definite matrix all <code>D[i]</code> are positive and
+ * <code>L * sqrt(D)</code> is the Cholesky factor.
+ */
+
+/**
+ * @addtogroup MatrixLDLT
+ * @{
+ */
+
+/**
+ * @brief Floating-point LDL^T decomposition.
+ * @param[in]       *pSrc points to the instance of the input symmetric matrix structure.
+ * @param[out]      *pL points to the instance of the output unit lower triangular matrix structure.
+ * @param[out]      *pD points to the output vector of the <code>numRows</code> diagonal elements of D.
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If a diagonal element of D is zero, then the function returns
+ * <code>RISCV_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The diagonal of <code>pL</code> is set to one and its upper triangle to zero.
+ * <code>pL</code> may be the same matrix as <code>pSrc</code>, the decomposition is then computed in place.
+ */
+
+riscv_status riscv_mat_ldlt_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pL,
+  float32_t * pD)
+{
+  RISCV_PROFILE(riscv_mat_ldlt_f32);
+  const float32_t *pA = pSrc->pData;             /* input data matrix pointer */
+  float32_t *pLi;                                /* row i of the output */
+  const float32_t *pLj;                          /* row j of the output */
+  float32_t sum, w, l;                           /* accumulator and elements of row i */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  riscv_status status;                             /* status of the decomposition */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pL->numRows != pL->numCols)
+     || (pSrc->numRows != pL->numRows))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    status = RISCV_MATH_SUCCESS;
+
+    for (i = 0u; (i < n) && (status == RISCV_MATH_SUCCESS); i++)
+    {
+      pLi = pL->pData + (i * n);
+
+      /* W[i][j], A[i][j] is read before W[i][j] overwrites it */
+      for (j = 0u; j < i; j++)
+      {
+        pLj = pL->pData + (j * n);
+        sum = pA[(i * n) + j];
+
+        for (k = 0u; k < j; k++)
+        {
+          sum -= pLi[k] * pLj[k];
+        }
+
+        pLi[j] = sum;
+      }
+
+      /* D[i] and the final L[i][j] */
+      sum = pA[(i * n) + i];
+
+      for (k = 0u; k < i; k++)
+      {
+        w = pLi[k];
+        l = w / pD[k];
+        sum -= w * l;
+        pLi[k] = l;
+      }
+
+      if(sum == 0.0f)
+      {
+        status = RISCV_MATH_DECOMPOSITION_FAILURE;
+      }
+
+      pD[i] = sum;
+      pLi[i] = 1.0f;
+
+      /* Upper triangle */
+      for (j = i + 1u; j < n; j++)
+      {
+        pLi[j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixLDLT group
+ */
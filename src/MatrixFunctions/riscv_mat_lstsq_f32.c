@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_lstsq_f32.c
+*
+* Description:  Floating-point least-squares solver based on the QR
+*               decomposition.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Floating-point least-squares solver.
+ * @param[in]       *pSrcA points to the matrix structure A, <code>M x N</code> with <code>M >= N</code>
+ * @param[in]       *pSrcB points to the right-hand side matrix structure B, <code>M x K</code>
+ * @param[out]      *pR points to a matrix structure of size <code>M x N</code> that receives R, it may be the same as <code>pSrcA</code>
+ * @param[out]      *pState points to a buffer of <code>M*K</code> elements that receives <code>Q^T * B</code>, it may be the data of <code>pSrcB</code>
+ * @param[out]      *pDst points to the solution matrix structure X, <code>N x K</code>
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if the sizes of the matrices do not match,
+ * <code>RISCV_MATH_SINGULAR</code> if A does not have full column rank, otherwise <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * X minimizes the 2-norm of every column of <code>A * X - B</code>.  The rotations of riscv_mat_qr_f32() are
+ * applied to the rows of A and B together, so Q is never stored, then the upper <code>N x N</code> triangle of
+ * R is solved with riscv_mat_solve_upper_triangular_f32().
+ * Rows <code>N</code> to <code>M-1</code> of <code>pState</code> hold the residual in the rotated basis, the
+ * sum of their squares is the squared norm of <code>A * X - B</code>.
+ */
+
+riscv_status riscv_mat_lstsq_f32(
+  const riscv_matrix_instance_f32 * pSrcA,
+  const riscv_matrix_instance_f32 * pSrcB,
+  riscv_matrix_instance_f32 * pR,
+  float32_t * pState,
+  riscv_matrix_instance_f32 * pDst)
+{
+  RISCV_PROFILE(riscv_mat_lstsq_f32);
+  float32_t *pOut = pR->pData;                   /* R data pointer */
+  float32_t *pX, *pY;                            /* Rows to rotate */
+  float32_t a, b, r, c, s, x, y;                 /* Elements to rotate and the rotation */
+  uint32_t numRows = pSrcA->numRows;             /* M */
+  uint32_t numCols = pSrcA->numCols;             /* N */
+  uint32_t numRhs = pSrcB->numCols;              /* K */
+  uint32_t i, j, k;                              /* loop counters */
+  riscv_matrix_instance_f32 upper;               /* Upper N x N triangle of R */
+  riscv_matrix_instance_f32 rhs;                 /* Upper N x K block of Q^T * B */
+  riscv_status status;                             /* status of the solver */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((numRows < numCols) || (pSrcB->numRows != numRows) || (pR->numRows != numRows) || (pR->numCols != numCols) ||
+     (pDst->numRows != numCols) || (pDst->numCols != numRhs))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    if(pOut != pSrcA->pData)
+    {
+      memcpy(pOut, pSrcA->pData, numRows * numCols * sizeof(float32_t));
+    }
+
+    if(pState != pSrcB->pData)
+    {
+      memcpy(pState, pSrcB->pData, numRows * numRhs * sizeof(float32_t));
+    }
+
+    for (j = 0u; j < numCols; j++)
+    {
+      for (i = numRows - 1u; i > j; i--)
+      {
+        b = pOut[(i * numCols) + j];
+
+        if(b != 0.0f)
+        {
+          a = pOut[((i - 1u) * numCols) + j];
+          r = sqrtf((a * a) + (b * b));
+          c = a / r;
+          s = b / r;
+
+          pOut[((i - 1u) * numCols) + j] = r;
+          pOut[(i * numCols) + j] = 0.0f;
+
+          /* Rotate rows i - 1 and i of R, right of column j */
+          pX = pOut + ((i - 1u) * numCols);
+          pY = pOut + (i * numCols);
+          for (k = j + 1u; k < numCols; k++)
+          {
+            x = pX[k];
+            y = pY[k];
+            pX[k] = (c * x) + (s * y);
+            pY[k] = (c * y) - (s * x);
+          }
+
+          /* Rotate rows i - 1 and i of B */
+          pX = pState + ((i - 1u) * numRhs);
+          pY = pState + (i * numRhs);
+          for (k = 0u; k < numRhs; k++)
+          {
+            x = pX[k];
+            y = pY[k];
+            pX[k] = (c * x) + (s * y);
+            pY[k] = (c * y) - (s * x);
+          }
+        }
+      }
+    }
+
+    /* R[0:N][0:N] * X = (Q^T * B)[0:N][:], the row stride of R is N */
+    riscv_mat_init_f32(&upper, (uint16_t) numCols, (uint16_t) numCols, pOut);
+    riscv_mat_init_f32(&rhs, (uint16_t) numCols, (uint16_t) numRhs, pState);
+
+    status = riscv_mat_solve_upper_triangular_f32(&upper, &rhs, pDst);
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
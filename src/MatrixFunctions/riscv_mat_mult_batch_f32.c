@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_mult_batch_f32.c
+*
+* Description:  Fixed-size and batched floating-point matrix multiplication.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixBatch Small Matrix Functions
+ *
+ * Fully unrolled functions for 2x2, 3x3 and 4x4 floating-point matrices, and batch functions that apply them
+ * to an array of matrices, for example rotations in sensor fusion or transforms in graphics.
+ * At these sizes the size checks and loop setup of riscv_mat_mult_f32() and riscv_mat_inverse_f32()
+ * cost more than the arithmetic, so the functions take plain pointers to the elements instead of
+ * matrix instances and check nothing but the size argument of the batch functions.
+ * \par
+ * The matrices are stored row by row without padding, as in riscv_matrix_instance_f32, and the
+ * <code>numMatrices</code> matrices of a batch follow each other, matrix <code>m</code> of size
+ * <code>dim</code> starts at element <code>m*dim*dim</code>.
+ * \par
+ * riscv_mat_vec_mult_soa_f32() multiplies many vectors by one matrix.  The vectors are stored in
+ * structure-of-arrays layout, the <code>dim</code> components are separate arrays of
+ * <code>numVectors</code> elements, so that the matrix stays in registers and every component
+ * load serves <code>dim</code> multiply-accumulates.
+ */
+
+/**
+ * @addtogroup MatrixBatch
+ * @{
+ */
+
+/**
+ * @brief Floating-point 2x2 matrix multiplication.
+ * @param[in]       *pSrcA points to the 4 elements of the first input matrix
+ * @param[in]       *pSrcB points to the 4 elements of the second input matrix
+ * @param[out]      *pDst points to the 4 elements of the output matrix, it must not be one of the inputs
+ * @return none.
+ */
+
+void riscv_mat_mult_2x2_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_mult_2x2_f32);
+  float32_t b00 = pSrcB[0], b01 = pSrcB[1];      /* Elements of B */
+  float32_t b10 = pSrcB[2], b11 = pSrcB[3];
+
+  pDst[0] = (pSrcA[0] * b00) + (pSrcA[1] * b10);
+  pDst[1] = (pSrcA[0] * b01) + (pSrcA[1] * b11);
+  pDst[2] = (pSrcA[2] * b00) + (pSrcA[3] * b10);
+  pDst[3] = (pSrcA[2] * b01) + (pSrcA[3] * b11);
+}
+
+/**
+ * @brief Floating-point 3x3 matrix multiplication.
+ * @param[in]       *pSrcA points to the 9 elements of the first input matrix
+ * @param[in]       *pSrcB points to the 9 elements of the second input matrix
+ * @param[out]      *pDst points to the 9 elements of the output matrix, it must not be one of the inputs
+ * @return none.
+ */
+
+void riscv_mat_mult_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_mult_3x3_f32);
+  pDst[0] = (pSrcA[0] * pSrcB[0]) + (pSrcA[1] * pSrcB[3]) + (pSrcA[2] * pSrcB[6]);
+  pDst[1] = (pSrcA[0] * pSrcB[1]) + (pSrcA[1] * pSrcB[4]) + (pSrcA[2] * pSrcB[7]);
+  pDst[2] = (pSrcA[0] * pSrcB[2]) + (pSrcA[1] * pSrcB[5]) + (pSrcA[2] * pSrcB[8]);
+
+  pDst[3] = (pSrcA[3] * pSrcB[0]) + (pSrcA[4] * pSrcB[3]) + (pSrcA[5] * pSrcB[6]);
+  pDst[4] = (pSrcA[3] * pSrcB[1]) + (pSrcA[4] * pSrcB[4]) + (pSrcA[5] * pSrcB[7]);
+  pDst[5] = (pSrcA[3] * pSrcB[2]) + (pSrcA[4] * pSrcB[5]) + (pSrcA[5] * pSrcB[8]);
+
+  pDst[6] = (pSrcA[6] * pSrcB[0]) + (pSrcA[7] * pSrcB[3]) + (pSrcA[8] * pSrcB[6]);
+  pDst[7] = (pSrcA[6] * pSrcB[1]) + (pSrcA[7] * pSrcB[4]) + (pSrcA[8] * pSrcB[7]);
+  pDst[8] = (pSrcA[6] * pSrcB[2]) + (pSrcA[7] * pSrcB[5]) + (pSrcA[8] * pSrcB[8]);
+}
+
+/**
+ * @brief Floating-point 4x4 matrix multiplication.
+ * @param[in]       *pSrcA points to the 16 elements of the first input matrix
+ * @param[in]       *pSrcB points to the 16 elements of the second input matrix
+ * @param[out]      *pDst points to the 16 elements of the output matrix, it must not be one of the inputs
+ * @return none.
+ */
+
+void riscv_mat_mult_4x4_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_mult_4x4_f32);
+  pDst[0] = (pSrcA[0] * pSrcB[0]) + (pSrcA[1] * pSrcB[4]) + (pSrcA[2] * pSrcB[8]) + (pSrcA[3] * pSrcB[12]);
+  pDst[1] = (pSrcA[0] * pSrcB[1]) + (pSrcA[1] * pSrcB[5]) + (pSrcA[2] * pSrcB[9]) + (pSrcA[3] * pSrcB[13]);
+  pDst[2] = (pSrcA[0] * pSrcB[2]) + (pSrcA[1] * pSrcB[6]) + (pSrcA[2] * pSrcB[10]) + (pSrcA[3] * pSrcB[14]);
+  pDst[3] = (pSrcA[0] * pSrcB[3]) + (pSrcA[1] * pSrcB[7]) + (pSrcA[2] * pSrcB[11]) + (pSrcA[3] * pSrcB[15]);
+
+  pDst[4] = (pSrcA[4] * pSrcB[0]) + (pSrcA[5] * pSrcB[4]) + (pSrcA[6] * pSrcB[8]) + (pSrcA[7] * pSrcB[12]);
+  pDst[5] = (pSrcA[4] * pSrcB[1]) + (pSrcA[5] * pSrcB[5]) + (pSrcA[6] * pSrcB[9]) + (pSrcA[7] * pSrcB[13]);
+  pDst[6] = (pSrcA[4] * pSrcB[2]) + (pSrcA[5] * pSrcB[6]) + (pSrcA[6] * pSrcB[10]) + (pSrcA[7] * pSrcB[14]);
+  pDst[7] = (pSrcA[4] * pSrcB[3]) + (pSrcA[5] * pSrcB[7]) + (pSrcA[6] * pSrcB[11]) + (pSrcA[7] * pSrcB[15]);
+
+  pDst[8] = (pSrcA[8] * pSrcB[0]) + (pSrcA[9] * pSrcB[4]) + (pSrcA[10] * pSrcB[8]) + (pSrcA[11] * pSrcB[12]);
+  pDst[9] = (pSrcA[8] * pSrcB[1]) + (pSrcA[9] * pSrcB[5]) + (pSrcA[10] * pSrcB[9]) + (pSrcA[11] * pSrcB[13]);
+  pDst[10] = (pSrcA[8] * pSrcB[2]) + (pSrcA[9] * pSrcB[6]) + (pSrcA[10] * pSrcB[10]) + (pSrcA[11] * pSrcB[14]);
+  pDst[11] = (pSrcA[8] * pSrcB[3]) + (pSrcA[9] * pSrcB[7]) + (pSrcA[10] * pSrcB[11]) + (pSrcA[11] * pSrcB[15]);
+
+  pDst[12] = (pSrcA[12] * pSrcB[0]) + (pSrcA[13] * pSrcB[4]) + (pSrcA[14] * pSrcB[8]) + (pSrcA[15] * pSrcB[12]);
+  pDst[13] = (pSrcA[12] * pSrcB[1]) + (pSrcA[13] * pSrcB[5]) + (pSrcA[14] * pSrcB[9]) + (pSrcA[15] * pSrcB[13]);
+  pDst[14] = (pSrcA[12] * pSrcB[2]) + (pSrcA[13] * pSrcB[6]) + (pSrcA[14] * pSrcB[10]) + (pSrcA[15] * pSrcB[14]);
+  pDst[15] = (pSrcA[12] * pSrcB[3]) + (pSrcA[13] * pSrcB[7]) + (pSrcA[14] * pSrcB[11]) + (pSrcA[15] * pSrcB[15]);
+}
+
+/**
+ * @brief Batched floating-point matrix multiplication.
+ * @param[in]       *pSrcA points to the first input matrices
+ * @param[in]       *pSrcB points to the second input matrices
+ * @param[out]      *pDst points to the output matrices, they must not overlap the inputs
+ * @param[in]       dim size of the matrices, 2, 3 or 4
+ * @param[in]       numMatrices number of matrix products
+ * @return     		The function returns
+ * <code>RISCV_MATH_ARGUMENT_ERROR</code> if <code>dim</code> is not 2, 3 or 4, otherwise <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * Output matrix <code>m</code> is the product of input matrices <code>m</code> of <code>pSrcA</code> and
+ * <code>pSrcB</code>.
+ */
+
+riscv_status riscv_mat_mult_batch_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst,
+  uint16_t dim,
+  uint32_t numMatrices)
+{
+  RISCV_PROFILE(riscv_mat_mult_batch_f32);
+  uint32_t size = (uint32_t) dim * dim;          /* Elements per matrix */
+  uint32_t m;                                    /* Matrix counter */
+
+  /* One loop per size, so that the fixed-size function can be inlined */
+  switch (dim)
+  {
+  case 2u:
+    for (m = 0u; m < numMatrices; m++)
+    {
+      riscv_mat_mult_2x2_f32(pSrcA + (m * size), pSrcB + (m * size), pDst + (m * size));
+    }
+    break;
+
+  case 3u:
+    for (m = 0u; m < numMatrices; m++)
+    {
+      riscv_mat_mult_3x3_f32(pSrcA + (m * size), pSrcB + (m * size), pDst + (m * size));
+    }
+    break;
+
+  case 4u:
+    for (m = 0u; m < numMatrices; m++)
+    {
+      riscv_mat_mult_4x4_f32(pSrcA + (m * size), pSrcB + (m * size), pDst + (m * size));
+    }
+    break;
+
+  default:
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixBatch group
+ */
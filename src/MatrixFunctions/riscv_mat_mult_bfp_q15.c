@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_mult_bfp_q15.c
+*
+* Description:  Q15 matrix multiplication with a block floating-point result.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/*
+* @brief  Dot product of a row of A and a row of the transposed B.
+*/
+
+static q63_t riscv_mat_mult_bfp_dot_q15(
+  const q15_t * pA,
+  const q15_t * pBT,
+  uint32_t numColsA)
+{
+  q63_t sum = 0;                                 /* Accumulator */
+  uint32_t colCnt = numColsA;                    /* Loop counter */
+
+#if defined (USE_DSP_RISCV)
+
+  /* The rows are only word aligned when numColsA is even */
+  if((numColsA & 1u) == 0u)
+  {
+    for (colCnt = numColsA >> 1u; colCnt > 0u; colCnt--)
+    {
+      sum += dotpv2(*(shortV *) pA, *(shortV *) pBT);
+      pA += 2;
+      pBT += 2;
+    }
+  }
+
+#endif
+
+  for (; colCnt > 0u; colCnt--)
+  {
+    sum += (q31_t) *pA++ * *pBT++;
+  }
+
+  return (sum);
+}
+
+/**
+ * @brief Q15 matrix multiplication that scales the result to the range it needs.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @param[in]       *pState points to a scratch buffer of <code>numRowsB*numColsB</code> elements for the transpose of B
+ * @param[out]      *pExponent exponent of the result, <code>pDst * 2^(*pExponent)</code> is the product of the inputs
+ * @return     		The function returns either
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * riscv_mat_mult_q15() always keeps the 1.15 format of the inputs, so products of small elements lose
+ * their low bits and large sums saturate.  This function first bounds every output element by the
+ * largest absolute row sum of A times the largest magnitude of B and picks the smallest right shift of
+ * the 2.30 accumulators that brings this bound into 16 bits.  No output can saturate and the outputs use
+ * the whole range the bound allows.  With block floating-point inputs the exponent of the result is
+ * <code>exponentA + exponentB + *pExponent</code>.
+ * \par
+ * The bound costs one pass over A and B, which is small next to the multiplication.
+ * <code>*pExponent</code> is -15 when no scaling is needed, the result then equals the one of
+ * riscv_mat_mult_q15() times 2^15.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The products are accumulated in a 64-bit accumulator in 34.30 format and shifted right by
+ * <code>*pExponent + 15</code> bits, discarding the low bits.
+ * In the USE_DSP_RISCV build dotpv2 adds two products in 32 bits, as riscv_mat_mult_q15() does, which only
+ * overflows when both products are 0x8000 * 0x8000.  The pair loads are used when <code>numColsA</code> is
+ * even, the data of A and <code>pState</code> must be 4-byte aligned in this case.
+ */
+
+riscv_status riscv_mat_mult_bfp_q15(
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst,
+  q15_t * pState,
+  int16_t * pExponent)
+{
+  RISCV_PROFILE(riscv_mat_mult_bfp_q15);
+  riscv_matrix_instance_q15 BT;                  /* Transpose of B in pState */
+  const q15_t *pInA = pSrcA->pData;              /* input data matrix pointer A */
+  const q15_t *pInB = pSrcB->pData;              /* input data matrix pointer B */
+  q15_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t rowSum, maxRowSum = 0u, maxB = 0u;    /* Magnitude bounds of A and B */
+  uint64_t bound;                                /* Bound of the accumulators */
+  uint32_t shift = 0u;                           /* Shift of the accumulators */
+  uint32_t row, col, k;                          /* loop counters */
+  q31_t in;                                      /* Input value */
+  riscv_status status;                             /* status of matrix multiplication */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef RISCV_MATH_MATRIX_CHECK    */
+
+  {
+    /* Largest sum of |a(m,k)| over a row of A */
+    for (row = 0u; row < numRowsA; row++)
+    {
+      rowSum = 0u;
+
+      for (k = 0u; k < numColsA; k++)
+      {
+        in = *pInA++;
+        rowSum += (uint32_t) ((in < 0) ? -in : in);
+      }
+
+      maxRowSum = (rowSum > maxRowSum) ? rowSum : maxRowSum;
+    }
+
+    /* Largest |b(k,n)| */
+    for (k = (uint32_t) pSrcB->numRows * numColsB; k > 0u; k--)
+    {
+      in = *pInB++;
+      in = (in < 0) ? -in : in;
+      maxB = ((uint32_t) in > maxB) ? (uint32_t) in : maxB;
+    }
+
+    /* |c(m,n)| <= bound in 2.30 format, find the shift that keeps it below 0x8000 */
+    bound = (uint64_t) maxRowSum * maxB;
+
+    while((bound >> shift) > 0x7FFFu)
+    {
+      shift++;
+    }
+
+    /* Transpose B so that the dot products run over contiguous data */
+    riscv_mat_init_q15(&BT, (uint16_t) numColsB, (uint16_t) numColsA, pState);
+    riscv_mat_trans_q15(pSrcB, &BT);
+
+    pInA = pSrcA->pData;
+
+    for (row = 0u; row < numRowsA; row++)
+    {
+      for (col = 0u; col < numColsB; col++)
+      {
+        *pOut++ = (q15_t) __SSAT((riscv_mat_mult_bfp_dot_q15(pInA, pState + (col * numColsA), numColsA) >> shift), 16);
+      }
+
+      pInA += numColsA;
+    }
+
+    *pExponent = (int16_t) shift - 15;
+
+    /* Set status as RISCV_MATH_SUCCESS */
+    status = RISCV_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
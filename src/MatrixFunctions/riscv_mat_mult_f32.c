@@ -68,6 +68,103 @@
  * @{    
  */
 
+/*
+* @brief  Computes a block of RISCV_MAT_MULT_F32_TILE_ROWS x 2 outputs.
+* @param[in]  *pA        points to the first row of the block in matrix A.
+* @param[in]  *pB        points to the first column of the block in matrix B.
+* @param[out] *pC        points to the first output of the block.
+* @param[in]  numColsA   number of columns of A, the length of the dot products.
+* @param[in]  numColsB   number of columns of B and of the output.
+*
+* Every step of the inner loop loads one element of each row of A and two adjacent elements of a row of B
+* and updates all outputs of the block, which stay in registers.
+*/
+
+static void riscv_mat_mult_tile_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+  float32_t * pC,
+  uint32_t numColsA,
+  uint32_t numColsB)
+{
+  const float32_t *pA0 = pA;                     /* Rows of the block in matrix A */
+  const float32_t *pA1 = pA + numColsA;
+#if (RISCV_MAT_MULT_F32_TILE_ROWS == 4u)
+  const float32_t *pA2 = pA + (2u * numColsA);
+  const float32_t *pA3 = pA + (3u * numColsA);
+  float32_t a2, a3;                              /* Elements of A */
+  float32_t acc20 = 0.0f, acc21 = 0.0f, acc30 = 0.0f, acc31 = 0.0f;  /* Accumulators */
+#endif
+  float32_t a0, a1, b0, b1;                      /* Elements of A and B */
+  float32_t acc00 = 0.0f, acc01 = 0.0f, acc10 = 0.0f, acc11 = 0.0f;  /* Accumulators */
+  uint32_t colCnt;                               /* Loop counter */
+
+  for (colCnt = numColsA; colCnt > 0u; colCnt--)
+  {
+    b0 = pB[0];
+    b1 = pB[1];
+    pB += numColsB;
+
+    a0 = *pA0++;
+    a1 = *pA1++;
+    acc00 += a0 * b0;
+    acc01 += a0 * b1;
+    acc10 += a1 * b0;
+    acc11 += a1 * b1;
+
+#if (RISCV_MAT_MULT_F32_TILE_ROWS == 4u)
+    a2 = *pA2++;
+    a3 = *pA3++;
+    acc20 += a2 * b0;
+    acc21 += a2 * b1;
+    acc30 += a3 * b0;
+    acc31 += a3 * b1;
+#endif
+  }
+
+  pC[0] = acc00;
+  pC[1] = acc01;
+  pC += numColsB;
+  pC[0] = acc10;
+  pC[1] = acc11;
+#if (RISCV_MAT_MULT_F32_TILE_ROWS == 4u)
+  pC += numColsB;
+  pC[0] = acc20;
+  pC[1] = acc21;
+  pC += numColsB;
+  pC[0] = acc30;
+  pC[1] = acc31;
+#endif
+}
+
+/*
+* @brief  Computes one output.
+* @param[in]  *pA        points to the row of matrix A.
+* @param[in]  *pB        points to the column of matrix B.
+* @param[in]  numColsA   number of columns of A, the length of the dot product.
+* @param[in]  numColsB   number of columns of B.
+* @return     output element.
+*/
+
+static float32_t riscv_mat_mult_1_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+  uint32_t numColsA,
+  uint32_t numColsB)
+{
+  float32_t sum = 0.0f;                          /* Accumulator */
+  uint32_t colCnt;                               /* Loop counter */
+
+  for (colCnt = numColsA; colCnt > 0u; colCnt--)
+  {
+    /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
+    sum += *pA++ * *pB;
+    pB += numColsB;
+  }
+
+  return (sum);
+}
+
 /**    
  * @brief Floating-point matrix multiplication.    
  * @param[in]       *pSrcA points to the first input matrix structure    
@@ -75,25 +172,29 @@
  * @param[out]      *pDst points to output matrix structure    
  * @return     		The function returns either    
  * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.    
+ *
+ * \par
+ * The output is computed in blocks of RISCV_MAT_MULT_F32_TILE_ROWS rows by 2 columns, 4 by default or 2 when
+ * the macro is defined to 2u at compile time.  Each block keeps its outputs in registers, so every element of A
+ * is loaded once per pair of output columns and every element of B once per block of rows, instead of once per
+ * output element.  The rows and the column that do not fill a block are computed one output at a time.
+ * Every output is summed in the same order as before, so the results do not depend on the tile size.
  */
 
+RISCV_DSP_FASTCODE(riscv_mat_mult_f32)
 riscv_status riscv_mat_mult_f32(
   const riscv_matrix_instance_f32 * pSrcA,
   const riscv_matrix_instance_f32 * pSrcB,
   riscv_matrix_instance_f32 * pDst)
 {
-  float32_t *pIn1 = pSrcA->pData;                /* input data matrix pointer A */
-  float32_t *pIn2 = pSrcB->pData;                /* input data matrix pointer B */
-  float32_t *pInA = pSrcA->pData;                /* input data matrix pointer A  */
-  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
-  float32_t *px;                                 /* Temporary output data matrix pointer */
-  float32_t sum;                                 /* Accumulator */
-  uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
-  uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
-  uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
-
+  RISCV_PROFILE(riscv_mat_mult_f32);
+  float32_t *pInA = pSrcA->pData;                /* input data matrix pointer A */
   float32_t *pInB = pSrcB->pData;                /* input data matrix pointer B */
-  uint16_t col, i = 0u, row = numRowsA, colCnt;  /* loop counters */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t row = 0u, col, r;                     /* loop counters */
   riscv_status status;                             /* status of matrix multiplication */
 
 #ifdef RISCV_MATH_MATRIX_CHECK
@@ -110,61 +211,34 @@ riscv_status riscv_mat_mult_f32(
 #endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
 
   {
-    /* The following loop performs the dot-product of each row in pInA with each column in pInB */
-    /* row loop */
-    do
+    /* Blocks of RISCV_MAT_MULT_F32_TILE_ROWS rows */
+    for (; (row + RISCV_MAT_MULT_F32_TILE_ROWS) <= numRowsA; row += RISCV_MAT_MULT_F32_TILE_ROWS)
     {
-      /* Output pointer is set to starting address of the row being processed */
-      px = pOut + i;
-
-      /* For every row wise process, the column loop counter is to be initiated */
-      col = numColsB;
-
-      /* For every row wise process, the pIn2 pointer is set     
-       ** to the starting address of the pSrcB data */
-      pIn2 = pSrcB->pData;
-
-      /* column loop */
-      do
+      for (col = 0u; (col + 2u) <= numColsB; col += 2u)
       {
-        /* Set the variable sum, that acts as accumulator, to zero */
-        sum = 0.0f;
+        riscv_mat_mult_tile_f32(pInA + (row * numColsA), pInB + col, pOut + (row * numColsB) + col,
+                                numColsA, numColsB);
+      }
 
-        /* Initialize the pointer pIn1 to point to the starting address of the row being processed */
-        pIn1 = pInA;
-
-        /* Matrix A columns number of MAC operations are to be performed */
-        colCnt = numColsA;
-
-        while(colCnt > 0u)
+      /* Last column of an odd number of columns */
+      if(col < numColsB)
+      {
+        for (r = row; r < (row + RISCV_MAT_MULT_F32_TILE_ROWS); r++)
         {
-          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-          sum += *pIn1++ * (*pIn2);
-          pIn2 += numColsB;
-
-          /* Decrement the loop counter */
-          colCnt--;
+          pOut[(r * numColsB) + col] = riscv_mat_mult_1_f32(pInA + (r * numColsA), pInB + col, numColsA, numColsB);
         }
+      }
+    }
 
-        /* Store the result in the destination buffer */
-        *px++ = sum;
-
-        /* Decrement the column loop counter */
-        col--;
-
-        /* Update the pointer pIn2 to point to the  starting address of the next column */
-        pIn2 = pInB + (numColsB - col);
-
-      } while(col > 0u);
-
-      /* Update the pointer pInA to point to the  starting address of the next row */
-      i = i + numColsB;
-      pInA = pInA + numColsA;
-
-      /* Decrement the row loop counter */
-      row--;
+    /* Remaining rows */
+    for (; row < numRowsA; row++)
+    {
+      for (col = 0u; col < numColsB; col++)
+      {
+        pOut[(row * numColsB) + col] = riscv_mat_mult_1_f32(pInA + (row * numColsA), pInB + col, numColsA, numColsB);
+      }
+    }
 
-    } while(row > 0u);
     /* Set status as RISCV_MATH_SUCCESS */
     status = RISCV_MATH_SUCCESS;
   }
@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_mult_f64.c
+*
+* Description:  Double-precision floating-point matrix multiplication.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/*
+* @brief  Computes a block of 2 x 2 outputs.
+* @param[in]  *pA        points to the first row of the block in matrix A.
+* @param[in]  *pB        points to the first column of the block in matrix B.
+* @param[out] *pC        points to the first output of the block.
+* @param[in]  numColsA   number of columns of A, the length of the dot products.
+* @param[in]  numColsB   number of columns of B and of the output.
+*/
+static void riscv_mat_mult_tile_f64(
+  const float64_t * pA,
+  const float64_t * pB,
+  float64_t * pC,
+  uint32_t numColsA,
+  uint32_t numColsB)
+{
+  const float64_t *pA0 = pA;                     /* Rows of the block in matrix A */
+  const float64_t *pA1 = pA + numColsA;
+  float64_t a0, a1, b0, b1;                      /* Elements of A and B */
+  float64_t acc00 = 0.0, acc01 = 0.0, acc10 = 0.0, acc11 = 0.0;  /* Accumulators */
+  uint32_t colCnt;                               /* Loop counter */
+
+  for (colCnt = numColsA; colCnt > 0u; colCnt--)
+  {
+    b0 = pB[0];
+    b1 = pB[1];
+    pB += numColsB;
+    a0 = *pA0++;
+    a1 = *pA1++;
+
+    acc00 += a0 * b0;
+    acc01 += a0 * b1;
+    acc10 += a1 * b0;
+    acc11 += a1 * b1;
+  }
+
+  pC[0] = acc00;
+  pC[1] = acc01;
+  pC += numColsB;
+  pC[0] = acc10;
+  pC[1] = acc11;
+}
+
+/*
+* @brief  Computes one output.
+* @param[in]  *pA        points to the row of matrix A.
+* @param[in]  *pB        points to the column of matrix B.
+* @param[in]  numColsA   number of columns of A, the length of the dot product.
+* @param[in]  numColsB   number of columns of B.
+* @return     output element.
+*/
+static float64_t riscv_mat_mult_1_f64(
+  const float64_t * pA,
+  const float64_t * pB,
+  uint32_t numColsA,
+  uint32_t numColsB)
+{
+  float64_t sum = 0.0;                           /* Accumulator */
+  uint32_t colCnt;                               /* Loop counter */
+
+  for (colCnt = numColsA; colCnt > 0u; colCnt--)
+  {
+    /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
+    sum += *pA++ * *pB;
+    pB += numColsB;
+  }
+
+  return (sum);
+}
+
+/**
+ * @brief Double-precision floating-point matrix multiplication.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return     		The function returns either
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * The output is computed in blocks of 2 x 2, the rows and the column that do not fill a block one
+ * output at a time; every output is summed in column order.  A block holds four double accumulators,
+ * which stay in the FPU registers of a core with the D extension.
+ */
+
+riscv_status riscv_mat_mult_f64(
+  const riscv_matrix_instance_f64 * pSrcA,
+  const riscv_matrix_instance_f64 * pSrcB,
+  riscv_matrix_instance_f64 * pDst)
+{
+  RISCV_PROFILE(riscv_mat_mult_f64);
+  const float64_t *pInA = pSrcA->pData;          /* input data matrix pointer A */
+  const float64_t *pInB = pSrcB->pData;          /* input data matrix pointer B */
+  float64_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t row = 0u, col, r;                     /* loop counters */
+  riscv_status status;                           /* status of matrix multiplication */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+
+  {
+    /* Blocks of two rows */
+    for (; (row + 2u) <= numRowsA; row += 2u)
+    {
+      for (col = 0u; (col + 2u) <= numColsB; col += 2u)
+      {
+        riscv_mat_mult_tile_f64(pInA + (row * numColsA), pInB + col,
+                                pOut + (row * numColsB) + col, numColsA, numColsB);
+      }
+
+      /* Last column of an odd number of columns */
+      if(col < numColsB)
+      {
+        for (r = row; r < (row + 2u); r++)
+        {
+          pOut[(r * numColsB) + col] = riscv_mat_mult_1_f64(pInA + (r * numColsA), pInB + col, numColsA, numColsB);
+        }
+      }
+    }
+
+    /* Last row of an odd number of rows */
+    for (; row < numRowsA; row++)
+    {
+      for (col = 0u; col < numColsB; col++)
+      {
+        pOut[(row * numColsB) + col] = riscv_mat_mult_1_f64(pInA + (row * numColsA), pInB + col, numColsA, numColsB);
+      }
+    }
+
+    /* Set status as RISCV_MATH_SUCCESS */
+    status = RISCV_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
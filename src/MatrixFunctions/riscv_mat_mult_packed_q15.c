@@ -0,0 +1,228 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_mult_packed_q15.c
+*
+* Description:  Q15 matrix multiplication with a packed right-hand matrix.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/*
+* @brief  Dot product of two pairs of Q15 elements.
+*/
+
+static q63_t riscv_mat_dot2_q15(
+  const q15_t * pa,
+  const q15_t * pb)
+{
+#if defined (USE_DSP_RISCV)
+
+  return ((q63_t) dotpv2(*(shortV *) pa, *(shortV *) pb));
+
+#else
+
+  return (((q63_t) pa[0] * pb[0]) + ((q31_t) pa[1] * pb[1]));
+
+#endif
+}
+
+/*
+* @brief  Computes two rows by two columns of outputs.
+* @param[in]  *pA0      points to the first row of A.
+* @param[in]  *pA1      points to the second row of A.
+* @param[in]  *pb       points to the packed group of the two columns.
+* @param[in]  numColsA  number of columns of A.
+* @param[out] *pC0      points to the outputs of the first row.
+* @param[out] *pC1      points to the outputs of the second row.
+*
+* Every pair of A and every group of four packed elements feeds two outputs.
+*/
+
+static void riscv_mat_mult_packed_2x2_q15(
+  const q15_t * pA0,
+  const q15_t * pA1,
+  const q15_t * pb,
+  uint32_t numColsA,
+  q15_t * pC0,
+  q15_t * pC1)
+{
+  q63_t acc00 = 0, acc01 = 0, acc10 = 0, acc11 = 0;  /* Accumulators */
+  q31_t a0, a1;                                  /* Last element of an odd row */
+  uint32_t colCnt;                               /* Loop counter */
+
+  for (colCnt = numColsA >> 1u; colCnt > 0u; colCnt--)
+  {
+    /* c(m,n) += a(m,k) * b(k,n) + a(m,k+1) * b(k+1,n) */
+    acc00 += riscv_mat_dot2_q15(pA0, pb);
+    acc01 += riscv_mat_dot2_q15(pA0, pb + 2);
+    acc10 += riscv_mat_dot2_q15(pA1, pb);
+    acc11 += riscv_mat_dot2_q15(pA1, pb + 2);
+    pA0 += 2;
+    pA1 += 2;
+    pb += 4;
+  }
+
+  if((numColsA & 1u) != 0u)
+  {
+    a0 = *pA0;
+    a1 = *pA1;
+    acc00 += a0 * pb[0];
+    acc01 += a0 * pb[2];
+    acc10 += a1 * pb[0];
+    acc11 += a1 * pb[2];
+  }
+
+  /* Saturate and store the results in the destination buffer */
+  pC0[0] = (q15_t) __SSAT((acc00 >> 15), 16);
+  pC0[1] = (q15_t) __SSAT((acc01 >> 15), 16);
+  pC1[0] = (q15_t) __SSAT((acc10 >> 15), 16);
+  pC1[1] = (q15_t) __SSAT((acc11 >> 15), 16);
+}
+
+/*
+* @brief  Computes one output.
+* @param[in]  *pA       points to the row of A.
+* @param[in]  *pb       points to the first pair of the column in the packed data.
+* @param[in]  stride    distance between two pairs of the column, 4 in a group of two columns, 2 otherwise.
+* @param[in]  numColsA  number of columns of A.
+* @return     output element.
+*/
+
+static q15_t riscv_mat_mult_packed_1x1_q15(
+  const q15_t * pA,
+  const q15_t * pb,
+  uint32_t stride,
+  uint32_t numColsA)
+{
+  q63_t sum = 0;                                 /* Accumulator */
+  uint32_t colCnt;                               /* Loop counter */
+
+  for (colCnt = numColsA >> 1u; colCnt > 0u; colCnt--)
+  {
+    sum += riscv_mat_dot2_q15(pA, pb);
+    pA += 2;
+    pb += stride;
+  }
+
+  if((numColsA & 1u) != 0u)
+  {
+    sum += (q31_t) *pA * *pb;
+  }
+
+  return ((q15_t) __SSAT((sum >> 15), 16));
+}
+
+/**
+ * @brief Q15 matrix multiplication with a right-hand matrix packed by riscv_mat_pack_q15().
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the packed second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return     		The function returns either
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * The result and the scaling are those of riscv_mat_mult_q15() with the unpacked matrix, but no transpose
+ * and no scratch buffer are needed.  The outputs are computed in blocks of two rows by two columns, so every
+ * pair loaded from A or from the packed B serves two dot products.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using a 64-bit internal accumulator. The inputs to the
+ * multiplications are in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * The 34.30 result is then truncated to 34.15 format by discarding the low 15 bits and then saturated to
+ * 1.15 format.
+ * In the USE_DSP_RISCV build dotpv2 adds two products in 32 bits, as riscv_mat_mult_q15() does, which only
+ * overflows when both products are 0x8000 * 0x8000.
+ */
+
+riscv_status riscv_mat_mult_packed_q15(
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_packed_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst)
+{
+  RISCV_PROFILE(riscv_mat_mult_packed_q15);
+  const q15_t *pInA = pSrcA->pData;              /* input data matrix pointer A */
+  const q15_t *pInB = pSrcB->pData;              /* packed data pointer of B */
+  const q15_t *pb;                               /* Packed group pointer */
+  q15_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numPairsB = (numColsA + 1u) >> 1u;    /* number of row pairs of the packed matrix */
+  uint32_t row, col;                             /* loop counters */
+  riscv_status status;                             /* status of matrix multiplication */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef RISCV_MATH_MATRIX_CHECK    */
+
+  {
+    for (row = 0u; row < numRowsA; row += 2u)
+    {
+      pb = pInB;
+
+      for (col = 0u; (col + 2u) <= numColsB; col += 2u)
+      {
+        if((row + 1u) < numRowsA)
+        {
+          riscv_mat_mult_packed_2x2_q15(pInA, pInA + numColsA, pb, numColsA,
+                                        pOut + col, pOut + numColsB + col);
+        }
+        else
+        {
+          /* Last row of an odd number of rows */
+          pOut[col] = riscv_mat_mult_packed_1x1_q15(pInA, pb, 4u, numColsA);
+          pOut[col + 1u] = riscv_mat_mult_packed_1x1_q15(pInA, pb + 2, 4u, numColsA);
+        }
+
+        pb += 4u * numPairsB;
+      }
+
+      /* Last column of an odd number of columns */
+      if(col < numColsB)
+      {
+        pOut[col] = riscv_mat_mult_packed_1x1_q15(pInA, pb, 2u, numColsA);
+
+        if((row + 1u) < numRowsA)
+        {
+          pOut[numColsB + col] = riscv_mat_mult_packed_1x1_q15(pInA + numColsA, pb, 2u, numColsA);
+        }
+      }
+
+      pInA += 2u * numColsA;
+      pOut += 2u * numColsB;
+    }
+
+    /* Set status as RISCV_MATH_SUCCESS */
+    status = RISCV_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
@@ -57,9 +57,10 @@
  * @param[in]       *pSrcA points to the first input matrix structure    
  * @param[in]       *pSrcB points to the second input matrix structure    
  * @param[out]      *pDst points to output matrix structure    
- * @param[in]		*pState points to the array for storing intermediate results (Unused)  
+ * @param[in]		*pState points to the array of numRowsB*numColsB values for the transpose of B, or NULL for the scratch pool (unused without USE_DSP_RISCV)
  * @return     		The function returns either    
- * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.    
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking,
+ * or <code>RISCV_MATH_LENGTH_ERROR</code> if <code>pState</code> is NULL and the scratch pool is too small.
  *    
  * @details    
  * <b>Scaling and Overflow Behavior:</b>    
@@ -84,6 +85,7 @@ riscv_status riscv_mat_mult_q15(
   riscv_matrix_instance_q15 * pDst,
   q15_t * pState)
 {
+  RISCV_PROFILE(riscv_mat_mult_q15);
   q63_t sum;                                     /* accumulator */
 
 #if defined (USE_DSP_RISCV)
@@ -99,16 +101,28 @@ riscv_status riscv_mat_mult_q15(
   uint16_t numRowsB = pSrcB->numRows;            /* number of rows of input matrix A    */
   uint16_t col, i = 0u, row = numRowsB, colCnt;  /* loop counters */
   riscv_status status;                             /* status of matrix multiplication */
+  uint32_t scratchMark = riscv_dsp_scratch_mark(); /* scratch pool depth on entry */
 
 
 
-  q15_t in;                                      /* Temporary variable to hold the input value */
+  riscv_matrix_instance_q15 matBT;               /* Transpose of B */
   q15_t inA1, inB1, inA2, inB2;
 
   shortV *VectInA;
   shortV *VectInB;
 
 
+  /* Transposed B from the scratch pool when the caller passes no pState */
+  if(pSrcBT == NULL)
+  {
+    pSrcBT = (q15_t *) riscv_dsp_scratch_push((uint32_t) numRowsB * numColsB * sizeof(q15_t));
+  }
+
+  if(pSrcBT == NULL)
+  {
+    status = RISCV_MATH_LENGTH_ERROR;
+  }
+  else
 #ifdef RISCV_MATH_MATRIX_CHECK
   /* Check for matrix mismatch condition */
   if((pSrcA->numCols != pSrcB->numRows) ||
@@ -120,82 +134,9 @@ riscv_status riscv_mat_mult_q15(
   else
 #endif /*    #ifdef RISCV_MATH_MATRIX_CHECK    */
   {
-    /* Matrix transpose */
-    do
-    {
-      /* Apply loop unrolling and exchange the columns with row elements */
-      col = numColsB >> 2;
-
-      /* The pointer px is set to starting address of the column being processed */
-      px = pSrcBT + i;
-
-      /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.        
-       ** a second loop below computes the remaining 1 to 3 samples. */
-      while(col > 0u)
-      {
-
-        /* Read one element from the row */
-        in = *pInB++;
-
-        /* Store one element in the destination */
-        *px = in;
- 
-        /* Update the pointer px to point to the next row of the transposed matrix */
-        px += numRowsB;
-
-        /* Read one element from the row */
-        in = *pInB++;
-
-        /* Store one element in the destination */
-        *px = in;
- 
-        /* Update the pointer px to point to the next row of the transposed matrix */
-        px += numRowsB;
-
-        /* Read one element from the row */
-        in = *pInB++;
-
-        /* Store one element in the destination */
-        *px = in;
- 
-        /* Update the pointer px to point to the next row of the transposed matrix */
-        px += numRowsB;
-
-        /* Read one element from the row */
-        in = *pInB++;
-
-        /* Store one element in the destination */
-        *px = in;
- 
-        /* Update the pointer px to point to the next row of the transposed matrix */
-        px += numRowsB;
-
-       /* Decrement the column loop counter */
-        col--;
-      }
-
-      /* If the columns of pSrcB is not a multiple of 4, compute any remaining output samples here.        
-       ** No loop unrolling is used. */
-      col = numColsB % 0x4u;
-
-      while(col > 0u)
-      {
-        /* Read and store the input element in the destination */
-        *px = *pInB++;
-
-        /* Update the pointer px to point to the next row of the transposed matrix */
-        px += numRowsB;
-
-        /* Decrement the column loop counter */
-        col--;
-      }
-
-      i++;
-
-      /* Decrement the row loop counter */
-      row--;
-
-    } while(row > 0u);
+    /* Matrix transpose of B, two rows at a time with xpulp */
+    riscv_mat_init_q15(&matBT, numColsB, numRowsB, pSrcBT);
+    riscv_mat_trans_q15(pSrcB, &matBT);
 
     /* Reset the variables for the usage in the following multiplication process */
     row = numRowsA;
@@ -371,6 +312,10 @@ riscv_status riscv_mat_mult_q15(
     status = RISCV_MATH_SUCCESS;
   }
 
+#if defined (USE_DSP_RISCV)
+  riscv_dsp_scratch_pop(scratchMark);
+#endif
+
   /* Return to application */
   return (status);
 }
@@ -82,19 +82,27 @@ riscv_status riscv_mat_mult_q31(
   const riscv_matrix_instance_q31 * pSrcB,
   riscv_matrix_instance_q31 * pDst)
 {
+  RISCV_PROFILE(riscv_mat_mult_q31);
   q31_t *pIn1 = pSrcA->pData;                    /* input data matrix pointer A */
   q31_t *pIn2 = pSrcB->pData;                    /* input data matrix pointer B */
-  q31_t *pInA = pSrcA->pData;                    /* input data matrix pointer A */
   q31_t *pOut = pDst->pData;                     /* output data matrix pointer */
   q31_t *px;                                     /* Temporary output data matrix pointer */
-  q63_t sum;                                     /* Accumulator */
   uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A    */
   uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
   uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
-
-  q31_t *pInB = pSrcB->pData;                    /* input data matrix pointer B */
-  uint16_t col, i = 0u, row = numRowsA, colCnt;  /* loop counters */
+  uint16_t colCnt;                               /* loop counter */
   riscv_status status;                             /* status of matrix multiplication */
+#if defined (USE_DSP_RISCV)
+  q31_t *pA0, *pA1;                              /* rows of the tile in matrix A */
+  q31_t a0, a1, b0, b1;                          /* elements of A and B */
+  q63_t sum00, sum01, sum10, sum11;              /* Accumulators of the 2 x 2 tile */
+  uint32_t r, c, stepB;                          /* tile row and column, offset of the second column */
+#else
+  q31_t *pInA = pSrcA->pData;                    /* input data matrix pointer A */
+  q31_t *pInB = pSrcB->pData;                    /* input data matrix pointer B */
+  q63_t sum;                                     /* Accumulator */
+  uint16_t col, i = 0u, row = numRowsA;          /* loop counters */
+#endif
 
 
 #ifdef RISCV_MATH_MATRIX_CHECK
@@ -111,6 +119,71 @@ riscv_status riscv_mat_mult_q31(
 
   {
     /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
+#if defined (USE_DSP_RISCV)
+
+    /* 2 x 2 output tiles: each step loads two elements of a column of A and two of a row of B
+     * for four multiply-accumulates.  An odd last row or column is computed twice and
+     * stored once.  The sums are the same 2.62 values as below. */
+    for (r = 0u; r < numRowsA; r += 2u)
+    {
+      pA0 = pSrcA->pData + (r * numColsA);
+      pA1 = ((r + 1u) < numRowsA) ? (pA0 + numColsA) : pA0;
+
+      for (c = 0u; c < numColsB; c += 2u)
+      {
+        stepB = ((c + 1u) < numColsB) ? 1u : 0u;
+
+        pIn1 = pA0;
+        px = pA1;
+        pIn2 = pSrcB->pData + c;
+
+        sum00 = 0;
+        sum01 = 0;
+        sum10 = 0;
+        sum11 = 0;
+
+        colCnt = numColsA;
+
+        while(colCnt > 0u)
+        {
+          a0 = *pIn1++;
+          a1 = *px++;
+          b0 = pIn2[0];
+          b1 = pIn2[stepB];
+          pIn2 += numColsB;
+
+          sum00 += (q63_t) a0 * b0;
+          sum01 += (q63_t) a0 * b1;
+          sum10 += (q63_t) a1 * b0;
+          sum11 += (q63_t) a1 * b1;
+
+          colCnt--;
+        }
+
+        px = pOut + (r * numColsB) + c;
+
+        /* Convert the results from 2.62 to 1.31 format */
+        px[0] = clip_q63_to_q31(sum00 >> 31);
+
+        if(stepB != 0u)
+        {
+          px[1] = clip_q63_to_q31(sum01 >> 31);
+        }
+
+        if(pA1 != pA0)
+        {
+          px[numColsB] = clip_q63_to_q31(sum10 >> 31);
+
+          if(stepB != 0u)
+          {
+            px[numColsB + 1u] = clip_q63_to_q31(sum11 >> 31);
+          }
+        }
+      }
+    }
+
+#else
+
     /* row loop */
     do
     {
@@ -168,6 +241,8 @@ riscv_status riscv_mat_mult_q31(
 
     } while(row > 0u);
 
+#endif /* #if defined (USE_DSP_RISCV) */
+
     /* set status as RISCV_MATH_SUCCESS */
     status = RISCV_MATH_SUCCESS;
   }
@@ -0,0 +1,278 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_mult_q7.c
+*
+* Description:  Q7 matrix multiplication with fused requantization.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/*
+* @brief  Adds the dot product of four pairs of Q7 elements to an accumulator.
+*/
+
+static q31_t riscv_mat_dot4_q7(
+  const q7_t * pa,
+  const q7_t * pb,
+  q31_t acc)
+{
+#if defined (USE_DSP_RISCV)
+
+  return (sumdotpv4(*(charV *) pa, *(charV *) pb, acc));
+
+#else
+
+  return (acc + ((q15_t) pa[0] * pb[0]) + ((q15_t) pa[1] * pb[1]) +
+          ((q15_t) pa[2] * pb[2]) + ((q15_t) pa[3] * pb[3]));
+
+#endif
+}
+
+/*
+* @brief  Converts an accumulator to the Q7 output of a row.
+* @param[in]  acc       accumulator in 18.14 format.
+* @param[in]  *pRq      points to the requantization parameters, or NULL.
+* @param[in]  row       output row.
+* @return     output element.
+*/
+
+static q7_t riscv_mat_mult_requant_q7(
+  q31_t acc,
+  const riscv_mat_requant_q7 * pRq,
+  uint32_t row)
+{
+  q63_t y;                                       /* Requantized value */
+  uint32_t i, shift;
+
+  if(pRq == NULL)
+  {
+    /* Truncate the 18.14 result to 18.7 and saturate to 1.7 */
+    return ((q7_t) __SSAT((acc >> 7), 8));
+  }
+
+  i = (pRq->numMult > 1u) ? row : 0u;
+  shift = 31u + pRq->pShift[i];
+
+  /* Q31 multiplier, rounding right shift, then the output offset */
+  y = ((q63_t) acc * pRq->pMultiplier[i]) + ((q63_t) 1 << (shift - 1u));
+  y = (y >> shift) + pRq->offset;
+
+  return ((q7_t) __SSAT(clip_q63_to_q31(y), 8));
+}
+
+/*
+* @brief  Computes two rows by two columns of accumulators.
+* @param[in]  *pA0      points to the first row of A.
+* @param[in]  *pA1      points to the second row of A.
+* @param[in]  *pB0      points to the first row of the transposed B.
+* @param[in]  *pB1      points to the second row of the transposed B.
+* @param[in]  numColsA  number of columns of A.
+* @param[out] *pAcc     points to the four accumulators, row by row.
+*/
+
+static void riscv_mat_mult_2x2_q7(
+  const q7_t * pA0,
+  const q7_t * pA1,
+  const q7_t * pB0,
+  const q7_t * pB1,
+  uint32_t numColsA,
+  q31_t * pAcc)
+{
+  q31_t acc00 = 0, acc01 = 0, acc10 = 0, acc11 = 0;  /* Accumulators */
+  q31_t a0, a1;                                  /* Elements of A */
+  uint32_t colCnt;                               /* Loop counter */
+
+  /* Every group of four elements loaded from A or B serves two dot products */
+  for (colCnt = numColsA >> 2u; colCnt > 0u; colCnt--)
+  {
+    acc00 = riscv_mat_dot4_q7(pA0, pB0, acc00);
+    acc01 = riscv_mat_dot4_q7(pA0, pB1, acc01);
+    acc10 = riscv_mat_dot4_q7(pA1, pB0, acc10);
+    acc11 = riscv_mat_dot4_q7(pA1, pB1, acc11);
+    pA0 += 4;
+    pA1 += 4;
+    pB0 += 4;
+    pB1 += 4;
+  }
+
+  for (colCnt = numColsA & 3u; colCnt > 0u; colCnt--)
+  {
+    a0 = *pA0++;
+    a1 = *pA1++;
+    acc00 += a0 * *pB0;
+    acc01 += a0 * *pB1;
+    acc10 += a1 * *pB0++;
+    acc11 += a1 * *pB1++;
+  }
+
+  pAcc[0] = acc00;
+  pAcc[1] = acc01;
+  pAcc[2] = acc10;
+  pAcc[3] = acc11;
+}
+
+/*
+* @brief  Computes one accumulator.
+*/
+
+static q31_t riscv_mat_mult_1x1_q7(
+  const q7_t * pA,
+  const q7_t * pB,
+  uint32_t numColsA)
+{
+  q31_t acc = 0;                                 /* Accumulator */
+  uint32_t colCnt;                               /* Loop counter */
+
+  for (colCnt = numColsA >> 2u; colCnt > 0u; colCnt--)
+  {
+    acc = riscv_mat_dot4_q7(pA, pB, acc);
+    pA += 4;
+    pB += 4;
+  }
+
+  for (colCnt = numColsA & 3u; colCnt > 0u; colCnt--)
+  {
+    acc += (q15_t) *pA++ * *pB++;
+  }
+
+  return (acc);
+}
+
+/**
+ * @brief Q7 matrix multiplication with fused requantization.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @param[in]       *pRequant points to the requantization parameters, or NULL for the default scaling.
+ * @param[in]       *pState points to a buffer of <code>numRowsB*numColsB</code> elements for the transpose of B.
+ * @return     		The function returns either
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * The function multiplies 8-bit matrices directly, without widening them to Q15 first: B is transposed into
+ * <code>pState</code>, then every output is a dot product of a row of A and a row of the transpose that uses
+ * sumdotpv4 on four elements at a time in the USE_DSP_RISCV build.  The outputs are computed in blocks of two
+ * rows by two columns, so that every group of four elements loaded serves two dot products.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The products are accumulated in a 32-bit accumulator, which cannot overflow as long as
+ * <code>numColsA</code> is below 131072.
+ * \par
+ * With <code>pRequant</code> NULL, the inputs are in 1.7 format, the 18.14 accumulator is truncated to 18.7
+ * format by discarding the low 7 bits and saturated to 1.7 format, as in riscv_conv_q7().
+ * \par
+ * Otherwise the accumulator of output row <code>i</code> is requantized while it is stored:
+ * <pre>
+ *    y = round(acc * pMultiplier[i] / 2^(31 + pShift[i])) + offset
+ * </pre>
+ * saturated to [-128, 127].  With <code>numMult</code> equal to 1, <code>pMultiplier[0]</code> and
+ * <code>pShift[0]</code> are used for all rows (per-tensor), otherwise <code>numMult</code> must be the number
+ * of rows of A (per-row, for example one scale per output channel of a layer).
+ */
+
+riscv_status riscv_mat_mult_q7(
+  const riscv_matrix_instance_q7 * pSrcA,
+  const riscv_matrix_instance_q7 * pSrcB,
+  riscv_matrix_instance_q7 * pDst,
+  const riscv_mat_requant_q7 * pRequant,
+  q7_t * pState)
+{
+  RISCV_PROFILE(riscv_mat_mult_q7);
+  const q7_t *pInA = pSrcA->pData;               /* input data matrix pointer A */
+  const q7_t *pInB = pSrcB->pData;               /* input data matrix pointer B */
+  q7_t *pOut = pDst->pData;                      /* output data matrix pointer */
+  const q7_t *pB;                                /* Row of the transpose of B */
+  q31_t acc[4];                                  /* Accumulators of a block */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t row, col, k;                          /* loop counters */
+  riscv_status status;                             /* status of matrix multiplication */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols) ||
+     ((pRequant != NULL) && (pRequant->numMult != 1u) && (pRequant->numMult != pSrcA->numRows)))
+  {
+
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef RISCV_MATH_MATRIX_CHECK    */
+
+  {
+    /* Matrix transpose, column col of B becomes row col of pState */
+    for (k = 0u; k < numColsA; k++)
+    {
+      for (col = 0u; col < numColsB; col++)
+      {
+        pState[(col * numColsA) + k] = *pInB++;
+      }
+    }
+
+    for (row = 0u; (row + 2u) <= numRowsA; row += 2u)
+    {
+      pB = pState;
+
+      for (col = 0u; (col + 2u) <= numColsB; col += 2u)
+      {
+        riscv_mat_mult_2x2_q7(pInA, pInA + numColsA, pB, pB + numColsA, numColsA, acc);
+        pB += 2u * numColsA;
+
+        pOut[col] = riscv_mat_mult_requant_q7(acc[0], pRequant, row);
+        pOut[col + 1u] = riscv_mat_mult_requant_q7(acc[1], pRequant, row);
+        pOut[numColsB + col] = riscv_mat_mult_requant_q7(acc[2], pRequant, row + 1u);
+        pOut[numColsB + col + 1u] = riscv_mat_mult_requant_q7(acc[3], pRequant, row + 1u);
+      }
+
+      /* Last column of an odd number of columns */
+      if(col < numColsB)
+      {
+        pOut[col] = riscv_mat_mult_requant_q7(riscv_mat_mult_1x1_q7(pInA, pB, numColsA), pRequant, row);
+        pOut[numColsB + col] = riscv_mat_mult_requant_q7(riscv_mat_mult_1x1_q7(pInA + numColsA, pB, numColsA),
+                                                    pRequant, row + 1u);
+      }
+
+      pInA += 2u * numColsA;
+      pOut += 2u * numColsB;
+    }
+
+    /* Last row of an odd number of rows */
+    if(row < numRowsA)
+    {
+      pB = pState;
+
+      for (col = 0u; col < numColsB; col++)
+      {
+        pOut[col] = riscv_mat_mult_requant_q7(riscv_mat_mult_1x1_q7(pInA, pB, numColsA), pRequant, row);
+        pB += numColsA;
+      }
+    }
+
+    /* Set status as RISCV_MATH_SUCCESS */
+    status = RISCV_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_pack_q15.c
+*
+* Description:  Packs a Q15 matrix for riscv_mat_mult_packed_q15().
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Packs the right-hand Q15 matrix of riscv_mat_mult_packed_q15().
+ * @param[in]  *pSrc   points to the matrix B of <code>numRows x numCols</code> elements.
+ * @param[out] *pDst   points to the packed matrix structure.
+ * @param[in]  *pData  points to a buffer of <code>((numRows+1)&~1)*numCols</code> elements that receives the packed data.
+ * @return none.
+ *
+ * \par
+ * riscv_mat_mult_q15() transposes B into <code>pState</code> on every call before it can use dotpv2 on pairs
+ * of a row of A and a column of B.  When B is constant, for example the weights of a network layer, this
+ * function stores it once in the layout the SIMD loop of riscv_mat_mult_packed_q15() reads:
+ * with <code>K = (numRows+1)&~1</code>, columns <code>n</code> and <code>n+1</code> of B, <code>n</code> even,
+ * are stored as <code>K/2</code> groups of four elements
+ * <pre>
+ *    b(k,n), b(k+1,n), b(k,n+1), b(k+1,n+1),     k = 0, 2, 4, ..., K-2
+ * </pre>
+ * so one pair of a row of A is multiplied with two columns after two adjacent loads.  The last column of an
+ * odd number of columns is stored alone as <code>K/2</code> pairs <code>b(k,n), b(k+1,n)</code>.
+ * An odd number of rows is padded with a row of zeros.
+ * \par
+ * <code>pData</code> must stay valid as long as the packed matrix is used, <code>pSrc</code> is no longer needed.
+ */
+
+void riscv_mat_pack_q15(
+  const riscv_matrix_instance_q15 * pSrc,
+  riscv_matrix_packed_instance_q15 * pDst,
+  q15_t * pData)
+{
+  RISCV_PROFILE(riscv_mat_pack_q15);
+  const q15_t *pB = pSrc->pData;                 /* Matrix B */
+  q15_t *pOut = pData;                           /* Packed data pointer */
+  uint32_t numRows = pSrc->numRows;              /* Number of rows of B */
+  uint32_t numCols = pSrc->numCols;              /* Number of columns of B */
+  uint32_t k, n, c, j;                           /* Loop counters */
+  uint32_t width;                                /* Number of columns in the group */
+
+  for (n = 0u; n < numCols; n += width)
+  {
+    width = ((n + 2u) <= numCols) ? 2u : 1u;
+
+    for (k = 0u; k < numRows; k += 2u)
+    {
+      for (c = 0u; c < width; c++)
+      {
+        for (j = 0u; j < 2u; j++)
+        {
+          *pOut++ = ((k + j) < numRows) ? pB[((k + j) * numCols) + n + c] : 0;
+        }
+      }
+    }
+  }
+
+  pDst->numRows = (uint16_t) numRows;
+  pDst->numCols = (uint16_t) numCols;
+  pDst->pData = pData;
+}
+
+/**
+ * @} end of MatrixMult group
+ */
@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_pack_q4.c
+*
+* Description:  Packs a matrix of 4-bit weights for riscv_mat_vec_mult_q4_q7().
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Packs a matrix of 4-bit weights for riscv_mat_vec_mult_q4_q7().
+ * @param[in]  *pSrc   points to the matrix of <code>numRows x numCols</code> weights, one per byte, -8 to 7.
+ * @param[in]  *pZero  points to the <code>numRows</code> zero points of the rows, or NULL for symmetric weights.
+ * @param[in]  *pRq    points to the requantization parameters of the output, or NULL.
+ * @param[out] *pDst   points to the packed matrix structure.
+ * @param[in]  *pData  points to a buffer of <code>numRows*RISCV_MAT_Q4_ROW_BYTES(numCols)</code> bytes that receives the packed weights.
+ * @return none.
+ *
+ * \par
+ * Each row takes <code>RISCV_MAT_Q4_ROW_BYTES(numCols)</code> bytes, a whole number of words of eight
+ * weights.  Byte <code>k</code> of the word of weights <code>8g</code> to <code>8g+7</code> holds weight
+ * <code>8g+k</code> in its low nibble and weight <code>8g+4+k</code> in its high nibble, so two masks of the
+ * word give the two groups of four weights in the bytes sumdotpv4 reads, without a shuffle.  The weights
+ * are two's complement nibbles, the ones outside -8 to 7 are saturated and the padding of the last word
+ * is zero.
+ * \par
+ * The weight of row <code>r</code> is <code>(w - pZero[r])</code> times the scale of the row, which
+ * riscv_mat_vec_mult_q4_q7() applies with the per-row multipliers of <code>pRq</code>.  <code>pZero</code>,
+ * <code>pRq</code> and <code>pData</code> must stay valid as long as the packed matrix is used.
+ */
+
+void riscv_mat_pack_q4(
+  const riscv_matrix_instance_q7 * pSrc,
+  const int8_t * pZero,
+  const riscv_mat_requant_q7 * pRq,
+  riscv_matrix_instance_q4 * pDst,
+  uint8_t * pData)
+{
+  RISCV_PROFILE(riscv_mat_pack_q4);
+  const q7_t *pW = pSrc->pData;                  /* Unpacked weights */
+  uint8_t *pOut = pData;                         /* Packed data pointer */
+  uint32_t numRows = pSrc->numRows;              /* Number of rows */
+  uint32_t numCols = pSrc->numCols;              /* Number of columns */
+  uint32_t rowBytes = RISCV_MAT_Q4_ROW_BYTES(numCols);
+  uint32_t r, c, k;                              /* Loop counters */
+  q31_t w;
+
+  memset(pData, 0, numRows * rowBytes);
+
+  for (r = 0u; r < numRows; r++)
+  {
+    for (c = 0u; c < numCols; c++)
+    {
+      w = __SSAT(pW[(r * numCols) + c], 4);
+
+      /* byte k of the word of weight c, the high nibble for the last four of the word */
+      k = ((c >> 3u) << 2u) + (c & 3u);
+      pOut[k] |= (uint8_t) ((w & 0xF) << (c & 4u));
+    }
+    pOut += rowBytes;
+  }
+
+  pDst->numRows = (uint16_t) numRows;
+  pDst->numCols = (uint16_t) numCols;
+  pDst->pData = pData;
+  pDst->pZero = pZero;
+  pDst->pRq = pRq;
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_qr_f32.c
+*
+* Description:  Floating-point QR decomposition with Givens rotations.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixQR QR Decomposition
+ *
+ * Computes the decomposition
+ * <pre>
+ *    A = Q * R
+ * </pre>
+ * of an <code>M x N</code> matrix with <code>M >= N</code>, where <code>Q</code> is an orthogonal
+ * <code>M x M</code> matrix and <code>R</code> is an upper triangular <code>M x N</code> matrix.
+ * \par
+ * The least-squares solution of an overdetermined system <code>A * X = B</code> is the solution of the
+ * upper <code>N x N</code> triangle of <code>R * X = Q^T * B</code>.  Unlike the normal equations
+ * <code>A^T * A * X = A^T * B</code> this does not square the condition number of <code>A</code>, and
+ * riscv_mat_lstsq_f32() needs no temporary matrices besides <code>R</code> and a copy of <code>B</code>.
+ *
+ * \par Algorithm
+ * The elements below the diagonal are zeroed column by column, from the bottom row up, with Givens rotations
+ * of two adjacent rows:
+ * <pre>
+ *    r = sqrt(a^2 + b^2),  c = a / r,  s = b / r
+ *    [ c  s ] [ a ]   [ r ]
+ *    [-s  c ] [ b ] = [ 0 ]
+ * </pre>
+ * Each rotation only touches two rows, so no scratch memory is needed, and the same rotation applied to a new
+ * row and <code>R</code> updates the decomposition when a row is appended to <code>A</code>:
+ * riscv_mat_qr_update_f32() adds one equation to a recursive least-squares problem in <code>O(N^2)</code>
+ * operations, instead of decomposing or inverting the whole system again.
+ * \par
+ * The Q31 functions compute the rotations with CORDIC iterations, which need neither a division nor a square
+ * root.
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/*
+* @brief  Applies a Givens rotation to two vectors.
+* @param[in,out] *pX      points to the first vector.
+* @param[in,out] *pY      points to the second vector.
+* @param[in]     stride   distance between two elements of a vector.
+* @param[in]     len      number of elements.
+* @param[in]     c        cosine of the rotation.
+* @param[in]     s        sine of the rotation.
+*/
+
+static void riscv_givens_rotate_f32(
+  float32_t * pX,
+  float32_t * pY,
+  uint32_t stride,
+  uint32_t len,
+  float32_t c,
+  float32_t s)
+{
+  float32_t x, y;                                /* Elements of the two vectors */
+  uint32_t k;                                    /* loop counter */
+
+  for (k = 0u; k < len; k++)
+  {
+    x = *pX;
+    y = *pY;
+    *pX = (c * x) + (s * y);
+    *pY = (c * y) - (s * x);
+    pX += stride;
+    pY += stride;
+  }
+}
+
+/**
+ * @brief Floating-point QR decomposition.
+ * @param[in]       *pSrc points to the input matrix structure A, <code>M x N</code> with <code>M >= N</code>
+ * @param[out]      *pR points to the output upper triangular matrix structure R, <code>M x N</code>, it may be the same as <code>pSrc</code>
+ * @param[out]      *pQ points to the output orthogonal matrix structure Q, <code>M x M</code>, or NULL if Q is not needed
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if <code>M < N</code> or the sizes of the outputs do not match,
+ * otherwise <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The elements of R below the diagonal are set to zero.
+ * The decomposition is unique only up to the signs of the rows of R and the columns of Q, and the diagonal of R
+ * can contain negative elements.
+ */
+
+riscv_status riscv_mat_qr_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pR,
+  riscv_matrix_instance_f32 * pQ)
+{
+  RISCV_PROFILE(riscv_mat_qr_f32);
+  float32_t *pOut = pR->pData;                   /* R data pointer */
+  float32_t a, b, r, c, s;                       /* Elements to rotate and the rotation */
+  uint32_t numRows = pSrc->numRows;              /* M */
+  uint32_t numCols = pSrc->numCols;              /* N */
+  uint32_t i, j;                                 /* loop counters */
+  riscv_status status;                             /* status of the decomposition */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((numRows < numCols) || (pR->numRows != numRows) || (pR->numCols != numCols) ||
+     ((pQ != NULL) && ((pQ->numRows != numRows) || (pQ->numCols != numRows))))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    if(pOut != pSrc->pData)
+    {
+      memcpy(pOut, pSrc->pData, numRows * numCols * sizeof(float32_t));
+    }
+
+    if(pQ != NULL)
+    {
+      /* Q = I */
+      memset(pQ->pData, 0, numRows * numRows * sizeof(float32_t));
+      for (i = 0u; i < numRows; i++)
+      {
+        pQ->pData[(i * numRows) + i] = 1.0f;
+      }
+    }
+
+    for (j = 0u; j < numCols; j++)
+    {
+      /* Zero column j from the bottom row up to row j + 1 */
+      for (i = numRows - 1u; i > j; i--)
+      {
+        b = pOut[(i * numCols) + j];
+
+        if(b != 0.0f)
+        {
+          a = pOut[((i - 1u) * numCols) + j];
+          r = sqrtf((a * a) + (b * b));
+          c = a / r;
+          s = b / r;
+
+          pOut[((i - 1u) * numCols) + j] = r;
+          pOut[(i * numCols) + j] = 0.0f;
+
+          /* R = G * R on the remaining columns of rows i - 1 and i */
+          riscv_givens_rotate_f32(pOut + ((i - 1u) * numCols) + j + 1u, pOut + (i * numCols) + j + 1u, 1u,
+                                  numCols - j - 1u, c, s);
+
+          /* Q = Q * G^T on columns i - 1 and i */
+          if(pQ != NULL)
+          {
+            riscv_givens_rotate_f32(pQ->pData + (i - 1u), pQ->pData + i, numRows, numRows, c, s);
+          }
+        }
+      }
+    }
+
+    /* Set status as RISCV_MATH_SUCCESS */
+    status = RISCV_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
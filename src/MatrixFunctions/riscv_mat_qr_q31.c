@@ -0,0 +1,223 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_qr_q31.c
+*
+* Description:  Q31 QR decomposition with CORDIC Givens rotations.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/* Number of CORDIC iterations, the angle of the last one is 2^-29 */
+#define RISCV_GIVENS_ITERATIONS_Q31 30u
+
+/* 1/K in Q31, K = prod(sqrt(1 + 2^-2i), i = 0..29) is the gain of the iterations */
+#define RISCV_GIVENS_INV_GAIN_Q31 0x4DBA76D4
+
+/*
+* @brief  Computes the CORDIC rotation that zeroes the second of two elements.
+* @param[in,out] *pX      points to the first element, it receives the norm of the two elements.
+* @param[in,out] *pY      points to the second element, it is set to zero.
+* @return        directions of the iterations, bit 31 is set if the elements were negated first.
+*
+* The elements are multiplied by 1/K and converted to 2.30 format first, so the gain of the
+* iterations brings them back to their norm and the additions cannot overflow.
+*/
+
+static uint32_t riscv_givens_vector_q31(
+  q31_t * pX,
+  q31_t * pY)
+{
+  q31_t x, y, t;                                 /* Elements in 2.30 format */
+  uint32_t dirs = 0u;                            /* Directions of the iterations */
+  uint32_t i;                                    /* loop counter */
+
+  x = (q31_t) (((q63_t) *pX * RISCV_GIVENS_INV_GAIN_Q31) >> 32);
+  y = (q31_t) (((q63_t) *pY * RISCV_GIVENS_INV_GAIN_Q31) >> 32);
+
+  /* Rotate by 180 degrees into the right half plane */
+  if(x < 0)
+  {
+    x = -x;
+    y = -y;
+    dirs = 0x80000000u;
+  }
+
+  for (i = 0u; i < RISCV_GIVENS_ITERATIONS_Q31; i++)
+  {
+    t = x;
+    if(y >= 0)
+    {
+      x += y >> i;
+      y -= t >> i;
+      dirs |= 1u << i;
+    }
+    else
+    {
+      x -= y >> i;
+      y += t >> i;
+    }
+  }
+
+  *pX = clip_q63_to_q31((q63_t) x << 1);
+  *pY = 0;
+
+  return (dirs);
+}
+
+/*
+* @brief  Applies a CORDIC rotation to two vectors.
+* @param[in,out] *pX      points to the first vector.
+* @param[in,out] *pY      points to the second vector.
+* @param[in]     stride   distance between two elements of a vector.
+* @param[in]     len      number of elements.
+* @param[in]     dirs     directions returned by riscv_givens_vector_q31().
+*/
+
+static void riscv_givens_rotate_q31(
+  q31_t * pX,
+  q31_t * pY,
+  uint32_t stride,
+  uint32_t len,
+  uint32_t dirs)
+{
+  q31_t x, y, t;                                 /* Elements in 2.30 format */
+  uint32_t i, k;                                 /* loop counters */
+
+  for (k = 0u; k < len; k++)
+  {
+    x = (q31_t) (((q63_t) *pX * RISCV_GIVENS_INV_GAIN_Q31) >> 32);
+    y = (q31_t) (((q63_t) *pY * RISCV_GIVENS_INV_GAIN_Q31) >> 32);
+
+    if((dirs & 0x80000000u) != 0u)
+    {
+      x = -x;
+      y = -y;
+    }
+
+    for (i = 0u; i < RISCV_GIVENS_ITERATIONS_Q31; i++)
+    {
+      t = x;
+      if((dirs & (1u << i)) != 0u)
+      {
+        x += y >> i;
+        y -= t >> i;
+      }
+      else
+      {
+        x -= y >> i;
+        y += t >> i;
+      }
+    }
+
+    *pX = clip_q63_to_q31((q63_t) x << 1);
+    *pY = clip_q63_to_q31((q63_t) y << 1);
+    pX += stride;
+    pY += stride;
+  }
+}
+
+/**
+ * @brief Q31 QR decomposition.
+ * @param[in]       *pSrc points to the input matrix structure A, <code>M x N</code> with <code>M >= N</code>
+ * @param[out]      *pR points to the output upper triangular matrix structure R, <code>M x N</code>, it may be the same as <code>pSrc</code>
+ * @param[out]      *pQ points to the output orthogonal matrix structure Q, <code>M x M</code>, or NULL if Q is not needed
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if <code>M < N</code> or the sizes of the outputs do not match,
+ * otherwise <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The rotations use 30 CORDIC iterations of shifts and additions each instead of a square root and two
+ * divisions, the rotated elements are accurate to a few LSBs of 2.30 format.
+ * The function is the Q31 counterpart of riscv_mat_qr_f32() with the same layout of R and Q.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The rotations keep the 2-norm of every column, so the elements of R are bounded by the 2-norms of the
+ * columns of A and the elements of Q by 1.  Results that exceed the Q31 range are saturated, so A must be
+ * scaled such that all its columns have a 2-norm below 1.
+ */
+
+riscv_status riscv_mat_qr_q31(
+  const riscv_matrix_instance_q31 * pSrc,
+  riscv_matrix_instance_q31 * pR,
+  riscv_matrix_instance_q31 * pQ)
+{
+  RISCV_PROFILE(riscv_mat_qr_q31);
+  q31_t *pOut = pR->pData;                       /* R data pointer */
+  uint32_t numRows = pSrc->numRows;              /* M */
+  uint32_t numCols = pSrc->numCols;              /* N */
+  uint32_t dirs;                                 /* Directions of a rotation */
+  uint32_t i, j;                                 /* loop counters */
+  riscv_status status;                             /* status of the decomposition */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((numRows < numCols) || (pR->numRows != numRows) || (pR->numCols != numCols) ||
+     ((pQ != NULL) && ((pQ->numRows != numRows) || (pQ->numCols != numRows))))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    if(pOut != pSrc->pData)
+    {
+      memcpy(pOut, pSrc->pData, numRows * numCols * sizeof(q31_t));
+    }
+
+    if(pQ != NULL)
+    {
+      /* Q = I */
+      memset(pQ->pData, 0, numRows * numRows * sizeof(q31_t));
+      for (i = 0u; i < numRows; i++)
+      {
+        pQ->pData[(i * numRows) + i] = 0x7FFFFFFF;
+      }
+    }
+
+    for (j = 0u; j < numCols; j++)
+    {
+      /* Zero column j from the bottom row up to row j + 1 */
+      for (i = numRows - 1u; i > j; i--)
+      {
+        if(pOut[(i * numCols) + j] != 0)
+        {
+          dirs = riscv_givens_vector_q31(pOut + ((i - 1u) * numCols) + j, pOut + (i * numCols) + j);
+
+          /* R = G * R on the remaining columns of rows i - 1 and i */
+          riscv_givens_rotate_q31(pOut + ((i - 1u) * numCols) + j + 1u, pOut + (i * numCols) + j + 1u, 1u,
+                                  numCols - j - 1u, dirs);
+
+          /* Q = Q * G^T on columns i - 1 and i */
+          if(pQ != NULL)
+          {
+            riscv_givens_rotate_q31(pQ->pData + (i - 1u), pQ->pData + i, numRows, numRows, dirs);
+          }
+        }
+      }
+    }
+
+    /* Set status as RISCV_MATH_SUCCESS */
+    status = RISCV_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
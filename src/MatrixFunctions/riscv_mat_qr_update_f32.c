@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_qr_update_f32.c
+*
+* Description:  Floating-point Givens update of a QR decomposition for
+*               recursive least squares.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Floating-point QR update, appends one equation to a least-squares problem.
+ * @param[in,out]   *pR points to the upper triangular <code>N x N</code> matrix structure R
+ * @param[in,out]   *pZ points to the <code>N</code> elements of <code>Q^T * b</code>
+ * @param[in,out]   *pRow points to the <code>N</code> elements of the new row of A, it is overwritten
+ * @param[in]       rhs right-hand side of the new equation
+ * @param[in]       forget factor applied to R and <code>pZ</code> before the update, <code>sqrt(lambda)</code> for an exponential forgetting factor <code>lambda</code>, or 1
+ * @return none.
+ *
+ * \par
+ * The function keeps the square-root form of a recursive least-squares estimator: after the update
+ * <code>R^T * R</code> equals <code>forget^2 * R^T * R + row^T * row</code>, and the estimate is the solution
+ * of <code>R * x = z</code>, for example with riscv_mat_solve_upper_triangular_f32().
+ * <code>N</code> Givens rotations, one per element of the new row, take <code>O(N^2)</code> operations.
+ * \par
+ * Start with <code>R = delta * I</code> for a small regularization <code>delta</code> and <code>z = 0</code>, or with
+ * the R and the upper <code>N</code> elements of <code>Q^T * b</code> of a batch solution.
+ * Only the upper triangle of R is read and written.
+ */
+
+void riscv_mat_qr_update_f32(
+  riscv_matrix_instance_f32 * pR,
+  float32_t * pZ,
+  float32_t * pRow,
+  float32_t rhs,
+  float32_t forget)
+{
+  RISCV_PROFILE(riscv_mat_qr_update_f32);
+  float32_t *pIn = pR->pData;                    /* R data pointer */
+  float32_t *pRj;                                /* row j of R */
+  float32_t a, b, r, c, s, x, y;                 /* Elements to rotate and the rotation */
+  uint32_t n = pR->numRows;                      /* size of R */
+  uint32_t j, k;                                 /* loop counters */
+
+  if(forget != 1.0f)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      for (k = j; k < n; k++)
+      {
+        pIn[(j * n) + k] *= forget;
+      }
+
+      pZ[j] *= forget;
+    }
+  }
+
+  for (j = 0u; j < n; j++)
+  {
+    b = pRow[j];
+
+    if(b != 0.0f)
+    {
+      pRj = pIn + (j * n);
+      a = pRj[j];
+      r = sqrtf((a * a) + (b * b));
+      c = a / r;
+      s = b / r;
+
+      pRj[j] = r;
+      pRow[j] = 0.0f;
+
+      /* Rotate row j of R with the new row */
+      for (k = j + 1u; k < n; k++)
+      {
+        x = pRj[k];
+        y = pRow[k];
+        pRj[k] = (c * x) + (s * y);
+        pRow[k] = (c * y) - (s * x);
+      }
+
+      /* and element j of z with the right-hand side */
+      x = pZ[j];
+      pZ[j] = (c * x) + (s * rhs);
+      rhs = (c * rhs) - (s * x);
+    }
+  }
+}
+
+/**
+ * @} end of MatrixQR group
+ */
@@ -0,0 +1,198 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_qr_update_q31.c
+*
+* Description:  Q31 Givens update of a QR decomposition for
+*               recursive least squares.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/* Number of CORDIC iterations, the angle of the last one is 2^-29 */
+#define RISCV_GIVENS_ITERATIONS_Q31 30u
+
+/* 1/K in Q31, K = prod(sqrt(1 + 2^-2i), i = 0..29) is the gain of the iterations */
+#define RISCV_GIVENS_INV_GAIN_Q31 0x4DBA76D4
+
+/*
+* @brief  Computes the CORDIC rotation that zeroes the second of two elements.
+* @param[in,out] *pX      points to the first element, it receives the norm of the two elements.
+* @param[in,out] *pY      points to the second element, it is set to zero.
+* @return        directions of the iterations, bit 31 is set if the elements were negated first.
+*
+* The elements are multiplied by 1/K and converted to 2.30 format first, so the gain of the
+* iterations brings them back to their norm and the additions cannot overflow.
+*/
+
+static uint32_t riscv_givens_vector_q31(
+  q31_t * pX,
+  q31_t * pY)
+{
+  q31_t x, y, t;                                 /* Elements in 2.30 format */
+  uint32_t dirs = 0u;                            /* Directions of the iterations */
+  uint32_t i;                                    /* loop counter */
+
+  x = (q31_t) (((q63_t) *pX * RISCV_GIVENS_INV_GAIN_Q31) >> 32);
+  y = (q31_t) (((q63_t) *pY * RISCV_GIVENS_INV_GAIN_Q31) >> 32);
+
+  /* Rotate by 180 degrees into the right half plane */
+  if(x < 0)
+  {
+    x = -x;
+    y = -y;
+    dirs = 0x80000000u;
+  }
+
+  for (i = 0u; i < RISCV_GIVENS_ITERATIONS_Q31; i++)
+  {
+    t = x;
+    if(y >= 0)
+    {
+      x += y >> i;
+      y -= t >> i;
+      dirs |= 1u << i;
+    }
+    else
+    {
+      x -= y >> i;
+      y += t >> i;
+    }
+  }
+
+  *pX = clip_q63_to_q31((q63_t) x << 1);
+  *pY = 0;
+
+  return (dirs);
+}
+
+/*
+* @brief  Applies a CORDIC rotation to two vectors.
+* @param[in,out] *pX      points to the first vector.
+* @param[in,out] *pY      points to the second vector.
+* @param[in]     stride   distance between two elements of a vector.
+* @param[in]     len      number of elements.
+* @param[in]     dirs     directions returned by riscv_givens_vector_q31().
+*/
+
+static void riscv_givens_rotate_q31(
+  q31_t * pX,
+  q31_t * pY,
+  uint32_t stride,
+  uint32_t len,
+  uint32_t dirs)
+{
+  q31_t x, y, t;                                 /* Elements in 2.30 format */
+  uint32_t i, k;                                 /* loop counters */
+
+  for (k = 0u; k < len; k++)
+  {
+    x = (q31_t) (((q63_t) *pX * RISCV_GIVENS_INV_GAIN_Q31) >> 32);
+    y = (q31_t) (((q63_t) *pY * RISCV_GIVENS_INV_GAIN_Q31) >> 32);
+
+    if((dirs & 0x80000000u) != 0u)
+    {
+      x = -x;
+      y = -y;
+    }
+
+    for (i = 0u; i < RISCV_GIVENS_ITERATIONS_Q31; i++)
+    {
+      t = x;
+      if((dirs & (1u << i)) != 0u)
+      {
+        x += y >> i;
+        y -= t >> i;
+      }
+      else
+      {
+        x -= y >> i;
+        y += t >> i;
+      }
+    }
+
+    *pX = clip_q63_to_q31((q63_t) x << 1);
+    *pY = clip_q63_to_q31((q63_t) y << 1);
+    pX += stride;
+    pY += stride;
+  }
+}
+
+/**
+ * @brief Q31 QR update, appends one equation to a least-squares problem.
+ * @param[in,out]   *pR points to the upper triangular <code>N x N</code> matrix structure R
+ * @param[in,out]   *pZ points to the <code>N</code> elements of <code>Q^T * b</code>
+ * @param[in,out]   *pRow points to the <code>N</code> elements of the new row of A, it is overwritten
+ * @param[in]       rhs right-hand side of the new equation
+ * @param[in]       forget factor applied to R and <code>pZ</code> before the update in 1.31 format, <code>sqrt(lambda)</code> for an exponential forgetting factor <code>lambda</code>, or 0x7FFFFFFF for none
+ * @return none.
+ *
+ * \par
+ * The function is the Q31 counterpart of riscv_mat_qr_update_f32(), with the rotations of riscv_mat_qr_q31().
+ * With <code>forget</code> equal to 0x7FFFFFFF R and <code>pZ</code> are not scaled.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The elements of R are bounded by the 2-norms of the columns of the accumulated system, and those of
+ * <code>pZ</code> by the 2-norm of its right-hand side.  Elements that exceed the Q31 range are saturated,
+ * so the rows must be scaled such that the accumulated norms stay below 1, which a forgetting factor
+ * <code>lambda</code> ensures for rows and right-hand sides below <code>sqrt(1 - lambda)</code>.
+ */
+
+void riscv_mat_qr_update_q31(
+  riscv_matrix_instance_q31 * pR,
+  q31_t * pZ,
+  q31_t * pRow,
+  q31_t rhs,
+  q31_t forget)
+{
+  RISCV_PROFILE(riscv_mat_qr_update_q31);
+  q31_t *pIn = pR->pData;                        /* R data pointer */
+  q31_t *pRj;                                    /* row j of R */
+  uint32_t n = pR->numRows;                      /* size of R */
+  uint32_t dirs;                                 /* Directions of a rotation */
+  uint32_t j, k;                                 /* loop counters */
+
+  if(forget != 0x7FFFFFFF)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      for (k = j; k < n; k++)
+      {
+        pIn[(j * n) + k] = (q31_t) (((q63_t) pIn[(j * n) + k] * forget) >> 31);
+      }
+
+      pZ[j] = (q31_t) (((q63_t) pZ[j] * forget) >> 31);
+    }
+  }
+
+  for (j = 0u; j < n; j++)
+  {
+    if(pRow[j] != 0)
+    {
+      pRj = pIn + (j * n);
+
+      dirs = riscv_givens_vector_q31(pRj + j, pRow + j);
+
+      /* Rotate row j of R with the new row */
+      riscv_givens_rotate_q31(pRj + j + 1u, pRow + j + 1u, 1u, n - j - 1u, dirs);
+
+      /* and element j of z with the right-hand side */
+      riscv_givens_rotate_q31(pZ + j, &rhs, 1u, 1u, dirs);
+    }
+  }
+}
+
+/**
+ * @} end of MatrixQR group
+ */
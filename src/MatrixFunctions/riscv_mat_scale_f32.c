@@ -62,6 +62,10 @@
  * <pre>        
  *     scale = scaleFract * 2^shift.        
  * </pre>        
+ *
+ * \par In place operation
+ * Every output element is computed from the input element at the same index only,
+ * so <code>pDst</code> may have the same data as <code>pSrc</code> and the matrix is then scaled in place.
  */
 
 /**        
@@ -73,7 +77,7 @@
  * @brief Floating-point matrix scaling.        
  * @param[in]       *pSrc points to input matrix structure        
  * @param[in]       scale scale factor to be applied         
- * @param[out]      *pDst points to output matrix structure        
+ * @param[out]      *pDst points to output matrix structure, it may be the same as the input matrix
  * @return     		The function returns either <code>RISCV_MATH_SIZE_MISMATCH</code>         
  * or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.        
  *        
@@ -84,6 +88,7 @@ riscv_status riscv_mat_scale_f32(
   float32_t scale,
   riscv_matrix_instance_f32 * pDst)
 {
+  RISCV_PROFILE(riscv_mat_scale_f32);
   float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
   float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
   uint32_t numSamples;                           /* total number of elements in the matrix */
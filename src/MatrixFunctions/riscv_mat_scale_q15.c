@@ -56,7 +56,7 @@
  * @param[in]       *pSrc points to input matrix    
  * @param[in]       scaleFract fractional portion of the scale factor    
  * @param[in]       shift number of bits to shift the result by    
- * @param[out]      *pDst points to output matrix structure    
+ * @param[out]      *pDst points to output matrix structure, it may be the same as the input matrix
  * @return     		The function returns either    
  * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.    
  *    
@@ -73,6 +73,7 @@ riscv_status riscv_mat_scale_q15(
   int32_t shift,
   riscv_matrix_instance_q15 * pDst)
 {
+  RISCV_PROFILE(riscv_mat_scale_q15);
   q15_t *pIn = pSrc->pData;                      /* input data matrix pointer */
   q15_t *pOut = pDst->pData;                     /* output data matrix pointer */
   uint32_t numSamples;                           /* total number of elements in the matrix */
@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_solve_lower_triangular_f64.c
+*
+* Description:  Double-precision floating-point forward substitution.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSolve Linear System Solvers
+ *
+ * Solve the linear systems <code>A * X = B</code> for the <code>numRows</code> by <code>numCols</code>
+ * matrix <code>X</code>, one column of <code>X</code> for every column of <code>B</code>.
+ *
+ * riscv_mat_solve_lower_triangular_f64() and riscv_mat_solve_upper_triangular_f64() solve triangular
+ * systems by forward and back substitution.  Only the triangle of <code>A</code> that is named by the
+ * function is read.
+ * riscv_mat_cholesky_solve_f64() solves a symmetric positive definite system with the Cholesky
+ * decomposition followed by the two substitutions, which is both cheaper and numerically more stable
+ * than riscv_mat_inverse_f64() followed by riscv_mat_mult_f64().
+ *
+ * \par Algorithm
+ * Row <code>i</code> of <code>X</code> is computed as a whole:
+ * <pre>
+ *    X[i][:] = (B[i][:] - sum(A[i][k] * X[k][:], k < i)) / A[i][i]
+ * </pre>
+ * (<code>k > i</code> for the back substitution), so the inner loops run along the contiguous rows of
+ * <code>X</code> and the diagonal element is inverted once per row.
+ * Since row <code>i</code> of <code>B</code> is only read before row <code>i</code> of <code>X</code> is
+ * written, <code>pDst</code> may be the same matrix as <code>B</code>.
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Double-precision floating-point forward substitution.
+ * @param[in]       *pL points to the instance of the lower triangular matrix structure.
+ * @param[in]       *pSrc points to the instance of the right-hand side matrix structure B.
+ * @param[out]      *pDst points to the instance of the solution matrix structure X, it may be the same as <code>pSrc</code>.
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if <code>pL</code> is not square or if the sizes of the
+ * right-hand side and solution matrices do not match the number of rows of <code>pL</code>.
+ * If a diagonal element of <code>pL</code> is zero, then the function returns
+ * <code>RISCV_MATH_SINGULAR</code>.  Otherwise, the function returns <code>RISCV_MATH_SUCCESS</code>.
+ */
+
+riscv_status riscv_mat_solve_lower_triangular_f64(
+  const riscv_matrix_instance_f64 * pL,
+  const riscv_matrix_instance_f64 * pSrc,
+  riscv_matrix_instance_f64 * pDst)
+{
+  RISCV_PROFILE(riscv_mat_solve_lower_triangular_f64);
+  const float64_t *pA = pL->pData;               /* triangular matrix pointer */
+  const float64_t *pB = pSrc->pData;             /* right-hand side pointer */
+  float64_t *pX = pDst->pData;                   /* solution pointer */
+  float64_t *pXi;                                /* row i of the solution */
+  const float64_t *pXk;                          /* row k of the solution */
+  float64_t a, invDiag;                          /* element and inverted diagonal element of row i */
+  uint32_t n = pL->numRows;                      /* size of the system */
+  uint32_t numCols = pSrc->numCols;              /* number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+  riscv_status status;                             /* status of the substitution */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pL->numRows != pL->numCols) || (pSrc->numRows != pL->numRows)
+     || (pDst->numRows != pSrc->numRows) || (pDst->numCols != pSrc->numCols))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    status = RISCV_MATH_SUCCESS;
+
+    for (i = 0u; i < n; i++)
+    {
+      if(pA[(i * n) + i] == 0.0)
+      {
+        status = RISCV_MATH_SINGULAR;
+        break;
+      }
+
+      pXi = pX + (i * numCols);
+
+      /* X[i][:] = B[i][:] */
+      for (c = 0u; c < numCols; c++)
+      {
+        pXi[c] = pB[(i * numCols) + c];
+      }
+
+      /* X[i][:] -= A[i][k] * X[k][:] for the rows already solved */
+      for (k = 0u; k < i; k++)
+      {
+        a = pA[(i * n) + k];
+        pXk = pX + (k * numCols);
+
+        for (c = 0u; c < numCols; c++)
+        {
+          pXi[c] -= a * pXk[c];
+        }
+      }
+
+      invDiag = 1.0 / pA[(i * n) + i];
+
+      for (c = 0u; c < numCols; c++)
+      {
+        pXi[c] *= invDiag;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_solve_q15.c
+*
+* Description:  Q15 block floating-point linear system solver.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Q15 linear system solver with block floating-point scaling.
+ * @param[in]       *pSrcA points to the square input matrix structure A.
+ * @param[in]       *pSrcB points to the right-hand side matrix structure B.
+ * @param[out]      *pDst points to the mantissas of the solution X, it may be the same as <code>pSrcB</code>.
+ * @param[out]      *pState points to a buffer of <code>numRows*(numRows+numCols)</code> words.
+ * @param[in,out]   *pExp points to the <code>numCols</code> exponents of the columns of B on input, 0 for Q15 values,
+ * and of the columns of X on output.
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if <code>pSrcA</code> is not square or if the sizes of the
+ * right-hand side and solution matrices do not match the number of rows of <code>pSrcA</code>.
+ * If <code>pSrcA</code> is singular, then the function returns
+ * <code>RISCV_MATH_SINGULAR</code>.  Otherwise, the function returns <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The function converts A and B to Q31 in <code>pState</code>, solves the system with riscv_mat_solve_q31()
+ * and truncates the normalized mantissas of X to 1.15 format, so the value of element <code>X[i][c]</code> is
+ * <code>pDst->pData[i * numCols + c] * 2^pExp[c]</code>.
+ */
+
+riscv_status riscv_mat_solve_q15(
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst,
+  q31_t * pState,
+  int8_t * pExp)
+{
+  RISCV_PROFILE(riscv_mat_solve_q15);
+  riscv_matrix_instance_q31 A, X;                /* Q31 copies of A and B */
+  uint32_t n = pSrcA->numRows;                   /* size of the system */
+  uint32_t numCols = pSrcB->numCols;             /* number of right-hand sides */
+  uint32_t i;                                    /* loop counter */
+  riscv_status status;                             /* status of the solver */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numRows != pSrcA->numCols) || (pSrcB->numRows != pSrcA->numRows)
+     || (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    riscv_mat_init_q31(&A, (uint16_t) n, (uint16_t) n, pState);
+    riscv_mat_init_q31(&X, (uint16_t) n, (uint16_t) numCols, pState + (n * n));
+
+    for (i = 0u; i < (n * n); i++)
+    {
+      A.pData[i] = (q31_t) pSrcA->pData[i] << 16;
+    }
+
+    for (i = 0u; i < (n * numCols); i++)
+    {
+      X.pData[i] = (q31_t) pSrcB->pData[i] << 16;
+    }
+
+    status = riscv_mat_solve_q31(&A, &X, &X, A.pData, pExp);
+
+    if(status == RISCV_MATH_SUCCESS)
+    {
+      for (i = 0u; i < (n * numCols); i++)
+      {
+        pDst->pData[i] = (q15_t) (X.pData[i] >> 16);
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
@@ -0,0 +1,359 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_solve_q31.c
+*
+* Description:  Q31 block floating-point linear system solver.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/* Bound of the elements of the working matrices, one bit of headroom for a row operation */
+#define RISCV_SOLVE_LIMIT_Q31 0x40000000
+
+/*
+* @brief  Shifts a column of a matrix right.
+* @param[in,out] *pCol    points to the first element of the column.
+* @param[in]     stride   distance between two elements of the column.
+* @param[in]     len      number of elements.
+* @param[in]     shift    shift count.
+*/
+
+static void riscv_mat_solve_shift_q31(
+  q31_t * pCol,
+  uint32_t stride,
+  uint32_t len,
+  uint32_t shift)
+{
+  uint32_t i;
+
+  for (i = 0u; i < len; i++)
+  {
+    pCol[i * stride] >>= shift;
+  }
+}
+
+/*
+* @brief  Divides with a block floating-point result.
+* @param[in]  num      numerator.
+* @param[in]  den      denominator, nonzero.
+* @param[out] *pShift  receives the exponent s of the result.
+* @return     num / den * 2^(31 - s), below 2^30 in magnitude.
+*/
+
+static q31_t riscv_mat_solve_div_q31(
+  q63_t num,
+  q31_t den,
+  uint32_t * pShift)
+{
+  uint64_t un = (num < 0) ? (uint64_t) (-num) : (uint64_t) num;
+  uint64_t ud = (den < 0) ? (uint64_t) (-(q63_t) den) : (uint64_t) den;
+  uint64_t q;
+  uint32_t s = 0u;
+
+  /* Smallest s with |num / den| * 2^(31 - s) < 2^30 */
+  while((un << 1) >= (ud << s))
+  {
+    s++;
+  }
+
+  /* un < ud * 2^(s - 1), so the shifted numerator fits */
+  if(s <= 31u)
+  {
+    q = (un << (31u - s)) / ud;
+  }
+  else
+  {
+    q = (un >> (s - 31u)) / ud;
+  }
+
+  *pShift = s;
+
+  return (((num < 0) != (den < 0)) ? -(q31_t) q : (q31_t) q);
+}
+
+/**
+ * @brief Q31 linear system solver with block floating-point scaling.
+ * @param[in]       *pSrcA points to the square input matrix structure A.
+ * @param[in]       *pSrcB points to the right-hand side matrix structure B.
+ * @param[out]      *pDst points to the mantissas of the solution X, it may be the same as <code>pSrcB</code>.
+ * @param[out]      *pState points to a buffer of <code>numRows*numRows</code> words, it may be the data of <code>pSrcA</code>.
+ * @param[in,out]   *pExp points to the <code>numCols</code> exponents of the columns of B on input, 0 for Q31 values,
+ * and of the columns of X on output.
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if <code>pSrcA</code> is not square or if the sizes of the
+ * right-hand side and solution matrices do not match the number of rows of <code>pSrcA</code>.
+ * If <code>pSrcA</code> is singular, then the function returns
+ * <code>RISCV_MATH_SINGULAR</code>.  Otherwise, the function returns <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The function solves <code>A * X = B</code> by Gaussian elimination with partial pivoting followed by back
+ * substitution, in integer arithmetic only, so it avoids the software floating-point emulation of
+ * riscv_mat_inverse_f32() on cores without an FPU.  The elimination is applied to the copy of A in
+ * <code>pState</code> and to the copy of B in <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The solution of a Q31 system is generally not in the Q31 range, so every column of B and X is a block
+ * floating-point vector, the value of element <code>X[i][c]</code> is
+ * <pre>
+ *    pDst->pData[i * numCols + c] * 2^pExp[c]
+ * </pre>
+ * in 1.31 format.  The elements of the working matrices are kept below 0.5 in magnitude so that a row
+ * operation cannot overflow: an equation whose row of A would exceed 0.5 is halved, and a column of B or X
+ * that would exceed 0.5 is shifted right with its exponent incremented.  The multipliers of the
+ * elimination are bounded by 1 by the pivoting and are held in 2.30 format.  On return every nonzero
+ * column of X is normalized to a largest magnitude of at least 0.5.
+ * \par
+ * The results are truncated at every step, so the accuracy depends on the condition number of A.
+ */
+
+riscv_status riscv_mat_solve_q31(
+  const riscv_matrix_instance_q31 * pSrcA,
+  const riscv_matrix_instance_q31 * pSrcB,
+  riscv_matrix_instance_q31 * pDst,
+  q31_t * pState,
+  int8_t * pExp)
+{
+  RISCV_PROFILE(riscv_mat_solve_q31);
+  q31_t *pA = pState;                            /* working copy of A */
+  q31_t *pX = pDst->pData;                       /* working copy of B, then X */
+  q31_t *pAi, *pAj, *pXi, *pXj;                  /* rows i and j of the working copies */
+  q31_t piv, l, tmp;                             /* pivot, multiplier of row j, and temporary value */
+  q31_t a, maxA;                                 /* element and largest magnitude of a row or column */
+  q63_t acc;                                     /* accumulator */
+  uint32_t n = pSrcA->numRows;                   /* size of the system */
+  uint32_t numCols = pSrcB->numCols;             /* number of right-hand sides */
+  uint32_t i, j, k, c, p;                        /* loop counters and pivot row */
+  uint32_t shift;                                /* exponent of a quotient */
+  uint32_t rowOvf;                               /* row of A exceeds the bound */
+  riscv_status status;                             /* status of the solver */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numRows != pSrcA->numCols) || (pSrcB->numRows != pSrcA->numRows)
+     || (pDst->numRows != pSrcB->numRows) || (pDst->numCols != pSrcB->numCols))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    status = RISCV_MATH_SUCCESS;
+
+    if(pA != pSrcA->pData)
+    {
+      memcpy(pA, pSrcA->pData, n * n * sizeof(q31_t));
+    }
+
+    if(pX != pSrcB->pData)
+    {
+      memcpy(pX, pSrcB->pData, n * numCols * sizeof(q31_t));
+    }
+
+    /* Halve the equations with an element of A beyond the bound */
+    for (i = 0u; i < n; i++)
+    {
+      pAi = pA + (i * n);
+      rowOvf = 0u;
+
+      for (k = 0u; k < n; k++)
+      {
+        rowOvf |= ((pAi[k] >= RISCV_SOLVE_LIMIT_Q31) || (pAi[k] <= -RISCV_SOLVE_LIMIT_Q31)) ? 1u : 0u;
+      }
+
+      if(rowOvf != 0u)
+      {
+        riscv_mat_solve_shift_q31(pAi, 1u, n, 1u);
+        riscv_mat_solve_shift_q31(pX + (i * numCols), 1u, numCols, 1u);
+      }
+    }
+
+    /* Halve the columns of B with an element beyond the bound */
+    for (c = 0u; c < numCols; c++)
+    {
+      for (i = 0u; i < n; i++)
+      {
+        a = pX[(i * numCols) + c];
+
+        if((a >= RISCV_SOLVE_LIMIT_Q31) || (a <= -RISCV_SOLVE_LIMIT_Q31))
+        {
+          riscv_mat_solve_shift_q31(pX + c, numCols, n, 1u);
+          pExp[c]++;
+          break;
+        }
+      }
+    }
+
+    /* Gaussian elimination with partial pivoting */
+    for (j = 0u; j < n; j++)
+    {
+      /* Search the largest element of column j on or below the diagonal */
+      p = j;
+      maxA = 0;
+
+      for (i = j; i < n; i++)
+      {
+        a = pA[(i * n) + j];
+        a = (a < 0) ? -a : a;
+
+        if(a > maxA)
+        {
+          maxA = a;
+          p = i;
+        }
+      }
+
+      if(maxA == 0)
+      {
+        status = RISCV_MATH_SINGULAR;
+        break;
+      }
+
+      pAj = pA + (j * n);
+      pXj = pX + (j * numCols);
+
+      /* Exchange rows j and p */
+      if(p != j)
+      {
+        pAi = pA + (p * n);
+        pXi = pX + (p * numCols);
+
+        for (k = j; k < n; k++)
+        {
+          tmp = pAj[k];
+          pAj[k] = pAi[k];
+          pAi[k] = tmp;
+        }
+
+        for (c = 0u; c < numCols; c++)
+        {
+          tmp = pXj[c];
+          pXj[c] = pXi[c];
+          pXi[c] = tmp;
+        }
+      }
+
+      piv = pAj[j];
+
+      /* Eliminate column j from the rows below */
+      for (i = j + 1u; i < n; i++)
+      {
+        pAi = pA + (i * n);
+        pXi = pX + (i * numCols);
+
+        if(pAi[j] == 0)
+        {
+          continue;
+        }
+
+        /* l = A[i][j] / A[j][j] in 2.30 format, |l| <= 1 */
+        l = (q31_t) (((q63_t) pAi[j] << 30) / piv);
+        pAi[j] = 0;
+        rowOvf = 0u;
+
+        for (k = j + 1u; k < n; k++)
+        {
+          pAi[k] -= (q31_t) (((q63_t) pAj[k] * l) >> 30);
+          rowOvf |= ((pAi[k] >= RISCV_SOLVE_LIMIT_Q31) || (pAi[k] <= -RISCV_SOLVE_LIMIT_Q31)) ? 1u : 0u;
+        }
+
+        for (c = 0u; c < numCols; c++)
+        {
+          pXi[c] -= (q31_t) (((q63_t) pXj[c] * l) >> 30);
+
+          if((pXi[c] >= RISCV_SOLVE_LIMIT_Q31) || (pXi[c] <= -RISCV_SOLVE_LIMIT_Q31))
+          {
+            riscv_mat_solve_shift_q31(pX + c, numCols, n, 1u);
+            pExp[c]++;
+          }
+        }
+
+        if(rowOvf != 0u)
+        {
+          riscv_mat_solve_shift_q31(pAi + j + 1u, 1u, n - j - 1u, 1u);
+          riscv_mat_solve_shift_q31(pXi, 1u, numCols, 1u);
+        }
+      }
+    }
+
+    if(status == RISCV_MATH_SUCCESS)
+    {
+      /* Back substitution, one column of X at a time */
+      for (c = 0u; c < numCols; c++)
+      {
+        i = n;
+
+        while(i > 0u)
+        {
+          i--;
+          pAi = pA + (i * n);
+          acc = pX[(i * numCols) + c];
+
+          for (k = i + 1u; k < n; k++)
+          {
+            acc -= ((q63_t) pAi[k] * pX[(k * numCols) + c]) >> 31;
+          }
+
+          a = riscv_mat_solve_div_q31(acc, pAi[i], &shift);
+
+          /* Bring the rest of the column to the exponent of the quotient */
+          if(shift != 0u)
+          {
+            riscv_mat_solve_shift_q31(pX + c, numCols, n, shift);
+            pExp[c] += (int8_t) shift;
+          }
+
+          pX[(i * numCols) + c] = a;
+        }
+
+        /* Normalize the column */
+        maxA = 0;
+
+        for (i = 0u; i < n; i++)
+        {
+          a = pX[(i * numCols) + c];
+          a = (a < 0) ? -a : a;
+          maxA = (a > maxA) ? a : maxA;
+        }
+
+        if(maxA != 0)
+        {
+          shift = 0u;
+
+          while(maxA < RISCV_SOLVE_LIMIT_Q31)
+          {
+            maxA <<= 1;
+            shift++;
+          }
+
+          for (i = 0u; i < n; i++)
+          {
+            pX[(i * numCols) + c] <<= shift;
+          }
+
+          pExp[c] -= (int8_t) shift;
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
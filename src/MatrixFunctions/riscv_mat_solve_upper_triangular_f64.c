@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_solve_upper_triangular_f64.c
+*
+* Description:  Double-precision floating-point back substitution.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Double-precision floating-point back substitution.
+ * @param[in]       *pU points to the instance of the upper triangular matrix structure.
+ * @param[in]       *pSrc points to the instance of the right-hand side matrix structure B.
+ * @param[out]      *pDst points to the instance of the solution matrix structure X, it may be the same as <code>pSrc</code>.
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if <code>pU</code> is not square or if the sizes of the
+ * right-hand side and solution matrices do not match the number of rows of <code>pU</code>.
+ * If a diagonal element of <code>pU</code> is zero, then the function returns
+ * <code>RISCV_MATH_SINGULAR</code>.  Otherwise, the function returns <code>RISCV_MATH_SUCCESS</code>.
+ */
+
+riscv_status riscv_mat_solve_upper_triangular_f64(
+  const riscv_matrix_instance_f64 * pU,
+  const riscv_matrix_instance_f64 * pSrc,
+  riscv_matrix_instance_f64 * pDst)
+{
+  RISCV_PROFILE(riscv_mat_solve_upper_triangular_f64);
+  const float64_t *pA = pU->pData;               /* triangular matrix pointer */
+  const float64_t *pB = pSrc->pData;             /* right-hand side pointer */
+  float64_t *pX = pDst->pData;                   /* solution pointer */
+  float64_t *pXi;                                /* row i of the solution */
+  const float64_t *pXk;                          /* row k of the solution */
+  float64_t a, invDiag;                          /* element and inverted diagonal element of row i */
+  uint32_t n = pU->numRows;                      /* size of the system */
+  uint32_t numCols = pSrc->numCols;              /* number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+  riscv_status status;                             /* status of the substitution */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pU->numRows != pU->numCols) || (pSrc->numRows != pU->numRows)
+     || (pDst->numRows != pSrc->numRows) || (pDst->numCols != pSrc->numCols))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    status = RISCV_MATH_SUCCESS;
+
+    for (i = n; i > 0u; )
+    {
+      i--;
+
+      if(pA[(i * n) + i] == 0.0)
+      {
+        status = RISCV_MATH_SINGULAR;
+        break;
+      }
+
+      pXi = pX + (i * numCols);
+
+      /* X[i][:] = B[i][:] */
+      for (c = 0u; c < numCols; c++)
+      {
+        pXi[c] = pB[(i * numCols) + c];
+      }
+
+      /* X[i][:] -= A[i][k] * X[k][:] for the rows already solved */
+      for (k = i + 1u; k < n; k++)
+      {
+        a = pA[(i * n) + k];
+        pXk = pX + (k * numCols);
+
+        for (c = 0u; c < numCols; c++)
+        {
+          pXi[c] -= a * pXk[c];
+        }
+      }
+
+      invDiag = 1.0 / pA[(i * n) + i];
+
+      for (c = 0u; c < numCols; c++)
+      {
+        pXi[c] *= invDiag;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_sparse_block_vec_mult_f32.c
+*
+* Description:  Floating-point block sparse (BSR) matrix and vector
+*               multiplication.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Floating-point block sparse (BSR) matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input BSR matrix structure of 1x4 or 2x2 blocks
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> elements
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> elements
+ * @return none.
+ */
+
+void riscv_mat_sparse_block_vec_mult_f32(
+  const riscv_sparse_block_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_sparse_block_vec_mult_f32);
+  const float32_t *pInA = pSrcMat->pData;        /* block elements pointer */
+  const uint16_t *pCol = pSrcMat->pColIdx;       /* first column of the blocks pointer */
+  const uint32_t *pRowPtr = pSrcMat->pRowPtr;    /* block row offsets pointer */
+  const float32_t *px;                           /* Vector elements of a block */
+  float32_t acc0, acc1;                          /* Accumulators */
+  uint32_t numBlockRows = (uint32_t) pSrcMat->numRows / pSrcMat->blockRows;  /* number of block rows */
+  uint32_t row, cnt;                             /* loop counters */
+
+  if(pSrcMat->blockRows == 2u)
+  {
+    /* 2x2 blocks, the two elements of x of a block serve both rows */
+    for (row = 0u; row < numBlockRows; row++)
+    {
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+
+      for (cnt = pRowPtr[row + 1u] - pRowPtr[row]; cnt > 0u; cnt--)
+      {
+        px = pVec + *pCol++;
+        acc0 += (pInA[0] * px[0]) + (pInA[1] * px[1]);
+        acc1 += (pInA[2] * px[0]) + (pInA[3] * px[1]);
+        pInA += 4;
+      }
+
+      pDst[2u * row] = acc0;
+      pDst[(2u * row) + 1u] = acc1;
+    }
+  }
+  else
+  {
+    /* 1x4 blocks */
+    for (row = 0u; row < numBlockRows; row++)
+    {
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+
+      for (cnt = pRowPtr[row + 1u] - pRowPtr[row]; cnt > 0u; cnt--)
+      {
+        px = pVec + *pCol++;
+        acc0 += (pInA[0] * px[0]) + (pInA[1] * px[1]);
+        acc1 += (pInA[2] * px[2]) + (pInA[3] * px[3]);
+        pInA += 4;
+      }
+
+      pDst[row] = acc0 + acc1;
+    }
+  }
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
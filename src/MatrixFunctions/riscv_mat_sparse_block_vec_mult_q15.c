@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_sparse_block_vec_mult_q15.c
+*
+* Description:  Q15 block sparse (BSR) matrix and vector multiplication.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Q15 block sparse (BSR) matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input BSR matrix structure of 1x4 or 2x2 blocks
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> elements, word aligned
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> elements
+ * @return none.
+ *
+ * \par
+ * In the USE_DSP_RISCV build every row of a 2x2 block takes one dotpv2 with the pair of <code>x</code>
+ * of the block, and a 1x4 block takes two.  <code>pVec</code> and <code>pData</code> must be word aligned.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using a 64-bit internal accumulator, as riscv_mat_vec_mult_q15().
+ * The inputs are in 1.15 format and multiplications yield a 2.30 result, which is accumulated in 34.30 format.
+ * The result is truncated to 34.15 format by discarding the low 15 bits and then saturated to 1.15 format.
+ */
+
+void riscv_mat_sparse_block_vec_mult_q15(
+  const riscv_sparse_block_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_sparse_block_vec_mult_q15);
+  const q15_t *pInA = pSrcMat->pData;            /* block elements pointer */
+  const uint16_t *pCol = pSrcMat->pColIdx;       /* first column of the blocks pointer */
+  const uint32_t *pRowPtr = pSrcMat->pRowPtr;    /* block row offsets pointer */
+  const q15_t *px;                               /* Vector elements of a block */
+  q63_t acc0, acc1;                              /* Accumulators */
+  uint32_t numBlockRows = (uint32_t) pSrcMat->numRows / pSrcMat->blockRows;  /* number of block rows */
+  uint32_t row, cnt;                             /* loop counters */
+#if defined (USE_DSP_RISCV)
+  shortV x;                                      /* Pair of vector elements */
+#endif
+
+  if(pSrcMat->blockRows == 2u)
+  {
+    /* 2x2 blocks, the two elements of x of a block serve both rows */
+    for (row = 0u; row < numBlockRows; row++)
+    {
+      acc0 = 0;
+      acc1 = 0;
+
+      for (cnt = pRowPtr[row + 1u] - pRowPtr[row]; cnt > 0u; cnt--)
+      {
+        px = pVec + *pCol++;
+
+#if defined (USE_DSP_RISCV)
+
+        x = *(shortV *) px;
+        acc0 += dotpv2(*(shortV *) pInA, x);
+        acc1 += dotpv2(*(shortV *) (pInA + 2), x);
+
+#else
+
+        acc0 += (q31_t) pInA[0] * px[0];
+        acc0 += (q31_t) pInA[1] * px[1];
+        acc1 += (q31_t) pInA[2] * px[0];
+        acc1 += (q31_t) pInA[3] * px[1];
+
+#endif
+
+        pInA += 4;
+      }
+
+      pDst[2u * row] = (q15_t) __SSAT((acc0 >> 15), 16);
+      pDst[(2u * row) + 1u] = (q15_t) __SSAT((acc1 >> 15), 16);
+    }
+  }
+  else
+  {
+    /* 1x4 blocks */
+    for (row = 0u; row < numBlockRows; row++)
+    {
+      acc0 = 0;
+
+      for (cnt = pRowPtr[row + 1u] - pRowPtr[row]; cnt > 0u; cnt--)
+      {
+        px = pVec + *pCol++;
+
+#if defined (USE_DSP_RISCV)
+
+        acc0 += dotpv2(*(shortV *) pInA, *(shortV *) px);
+        acc0 += dotpv2(*(shortV *) (pInA + 2), *(shortV *) (px + 2));
+
+#else
+
+        acc0 += (q31_t) pInA[0] * px[0];
+        acc0 += (q31_t) pInA[1] * px[1];
+        acc0 += (q31_t) pInA[2] * px[2];
+        acc0 += (q31_t) pInA[3] * px[3];
+
+#endif
+
+        pInA += 4;
+      }
+
+      pDst[row] = (q15_t) __SSAT((acc0 >> 15), 16);
+    }
+  }
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
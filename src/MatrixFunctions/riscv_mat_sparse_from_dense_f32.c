@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_sparse_from_dense_f32.c
+*
+* Description:  Conversion of a floating-point dense matrix to the CSR and
+*               BSR sparse formats.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Converts a floating-point dense matrix to the CSR format.
+ * @param[in]       *pSrc points to the input dense matrix structure
+ * @param[in,out]   *pDst points to the CSR matrix structure, with <code>pRowPtr</code>, <code>pColIdx</code> and <code>pData</code> set by the caller
+ * @param[in]       maxNonZeros number of elements of the <code>pColIdx</code> and <code>pData</code> buffers
+ * @return The function returns RISCV_MATH_LENGTH_ERROR if the matrix has more than <code>maxNonZeros</code>
+ * nonzero elements, otherwise RISCV_MATH_SUCCESS.
+ *
+ * \par
+ * The function sets <code>numRows</code> and <code>numCols</code> of <code>pDst</code> and fills the
+ * <code>numRows+1</code> elements of <code>pRowPtr</code>.  The number of nonzero elements is
+ * <code>pDst->pRowPtr[numRows]</code>.
+ */
+
+riscv_status riscv_mat_sparse_from_dense_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_sparse_matrix_instance_f32 * pDst,
+  uint32_t maxNonZeros)
+{
+  RISCV_PROFILE(riscv_mat_sparse_from_dense_f32);
+  const float32_t *pIn = pSrc->pData;            /* input data matrix pointer */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint32_t numCols = pSrc->numCols;              /* number of columns of the matrix */
+  uint32_t nnz = 0u;                             /* number of nonzero elements */
+  uint32_t row, col;                             /* loop counters */
+
+  pDst->numRows = pSrc->numRows;
+  pDst->numCols = pSrc->numCols;
+  pDst->pRowPtr[0] = 0u;
+
+  for (row = 0u; row < numRows; row++)
+  {
+    for (col = 0u; col < numCols; col++)
+    {
+      if(*pIn != 0.0f)
+      {
+        if(nnz == maxNonZeros)
+        {
+          return (RISCV_MATH_LENGTH_ERROR);
+        }
+
+        pDst->pColIdx[nnz] = (uint16_t) col;
+        pDst->pData[nnz] = *pIn;
+        nnz++;
+      }
+
+      pIn++;
+    }
+
+    pDst->pRowPtr[row + 1u] = nnz;
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief Converts a floating-point dense matrix to the BSR format.
+ * @param[in]       *pSrc points to the input dense matrix structure
+ * @param[in,out]   *pDst points to the BSR matrix structure, with <code>blockRows</code>, <code>blockCols</code>, <code>pRowPtr</code>, <code>pColIdx</code> and <code>pData</code> set by the caller
+ * @param[in]       maxBlocks number of blocks of the <code>pColIdx</code> and <code>pData</code> buffers
+ * @return The function returns RISCV_MATH_ARGUMENT_ERROR if the block size is not 1x4 or 2x2,
+ * RISCV_MATH_SIZE_MISMATCH if the size of the matrix is not a multiple of the block size,
+ * RISCV_MATH_LENGTH_ERROR if the matrix has more than <code>maxBlocks</code> nonzero blocks, otherwise RISCV_MATH_SUCCESS.
+ *
+ * \par
+ * The function sets <code>numRows</code> and <code>numCols</code> of <code>pDst</code> and fills the
+ * <code>numRows/blockRows+1</code> elements of <code>pRowPtr</code>.  <code>pData</code> receives
+ * <code>4*maxBlocks</code> elements at most.
+ */
+
+riscv_status riscv_mat_sparse_block_from_dense_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_sparse_block_matrix_instance_f32 * pDst,
+  uint32_t maxBlocks)
+{
+  RISCV_PROFILE(riscv_mat_sparse_block_from_dense_f32);
+  const float32_t *pIn;                          /* input block pointer */
+  float32_t *pOut = pDst->pData;                 /* output block pointer */
+  uint32_t numRows = pSrc->numRows;              /* number of rows of the matrix */
+  uint32_t numCols = pSrc->numCols;              /* number of columns of the matrix */
+  uint32_t bRows = pDst->blockRows;              /* rows of a block */
+  uint32_t bCols = pDst->blockCols;              /* columns of a block */
+  uint32_t numBlocks = 0u;                       /* number of nonzero blocks */
+  uint32_t row, col, i, j;                       /* loop counters */
+  uint32_t nonZero;                              /* Block has a nonzero element */
+
+  if(!(((bRows == 1u) && (bCols == 4u)) || ((bRows == 2u) && (bCols == 2u))))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  if(((numRows % bRows) != 0u) || ((numCols % bCols) != 0u))
+  {
+    return (RISCV_MATH_SIZE_MISMATCH);
+  }
+
+  pDst->numRows = pSrc->numRows;
+  pDst->numCols = pSrc->numCols;
+  pDst->pRowPtr[0] = 0u;
+
+  for (row = 0u; row < numRows; row += bRows)
+  {
+    for (col = 0u; col < numCols; col += bCols)
+    {
+      pIn = pSrc->pData + (row * numCols) + col;
+      nonZero = 0u;
+
+      for (i = 0u; i < bRows; i++)
+      {
+        for (j = 0u; j < bCols; j++)
+        {
+          nonZero |= (pIn[(i * numCols) + j] != 0.0f) ? 1u : 0u;
+        }
+      }
+
+      if(nonZero != 0u)
+      {
+        if(numBlocks == maxBlocks)
+        {
+          return (RISCV_MATH_LENGTH_ERROR);
+        }
+
+        /* Copy the block in row major order */
+        for (i = 0u; i < bRows; i++)
+        {
+          for (j = 0u; j < bCols; j++)
+          {
+            *pOut++ = pIn[(i * numCols) + j];
+          }
+        }
+
+        pDst->pColIdx[numBlocks] = (uint16_t) col;
+        numBlocks++;
+      }
+    }
+
+    pDst->pRowPtr[(row / bRows) + 1u] = numBlocks;
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
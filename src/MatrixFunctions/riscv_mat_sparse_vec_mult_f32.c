@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_sparse_vec_mult_f32.c
+*
+* Description:  Floating-point sparse (CSR) matrix and vector multiplication.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSparse Sparse Matrix Vector Multiplication
+ *
+ * Multiplies a sparse matrix and a dense vector, <code>y = A * x</code>, for matrices where most elements are
+ * zero, such as pruned network layers or the adjacency matrices of graph filters.  Only the nonzero elements are
+ * stored and multiplied.
+ * \par
+ * The compressed sparse row (CSR) instance stores the <code>nnz</code> nonzero elements row by row in
+ * <code>pData</code>, their columns in <code>pColIdx</code> and in <code>pRowPtr</code> the offset of the first
+ * nonzero element of every row, with <code>pRowPtr[numRows] = nnz</code>.  For example
+ * <pre>
+ *        | 5 0 0 1 |
+ *    A = | 0 0 0 0 |    pRowPtr = {0, 2, 2, 4}
+ *        | 0 2 3 0 |    pColIdx = {0, 3, 1, 2}
+ *                       pData   = {5, 1, 2, 3}
+ * </pre>
+ * \par
+ * Every element of a CSR matrix needs its own gathered load of <code>x</code>, which rules out the pair loads of
+ * riscv_mat_vec_mult_q15().  The blocked (BSR) instance stores <code>blockRows x blockCols</code> blocks of
+ * 1x4 or 2x2 elements on an aligned grid instead, any block with a nonzero element is kept whole.
+ * <code>pRowPtr</code> holds the offsets in blocks of the <code>numRows/blockRows</code> block rows,
+ * <code>pColIdx</code> the first column of every block, a multiple of <code>blockCols</code>, and
+ * <code>pData</code> the elements of every block in row major order.  The elements of <code>x</code> of a block
+ * are then contiguous and, in the USE_DSP_RISCV build, the Q15 version multiplies them with
+ * dotpv2, which requires <code>pVec</code> to be word aligned.
+ * \par
+ * riscv_mat_sparse_from_dense_f32(), riscv_mat_sparse_from_dense_q15() and the block versions
+ * convert a dense matrix instance into buffers given by the caller in the CSR and BSR instance.
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Floating-point sparse (CSR) matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input CSR matrix structure
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> elements
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> elements
+ * @return none.
+ */
+
+void riscv_mat_sparse_vec_mult_f32(
+  const riscv_sparse_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_sparse_vec_mult_f32);
+  const float32_t *pInA = pSrcMat->pData;        /* nonzero elements pointer */
+  const uint16_t *pCol = pSrcMat->pColIdx;       /* column index pointer */
+  const uint32_t *pRowPtr = pSrcMat->pRowPtr;    /* row offsets pointer */
+  float32_t acc0, acc1;                          /* Accumulators */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t row, cnt;                             /* loop counters */
+
+  for (row = 0u; row < numRows; row++)
+  {
+    cnt = pRowPtr[row + 1u] - pRowPtr[row];
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+
+    /* Two nonzero elements at a time, with independent accumulators */
+    for (; cnt >= 2u; cnt -= 2u)
+    {
+      acc0 += pInA[0] * pVec[pCol[0]];
+      acc1 += pInA[1] * pVec[pCol[1]];
+      pInA += 2;
+      pCol += 2;
+    }
+
+    if(cnt != 0u)
+    {
+      acc0 += *pInA++ * pVec[*pCol++];
+    }
+
+    pDst[row] = acc0 + acc1;
+  }
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_sparse_vec_mult_q15.c
+*
+* Description:  Q15 sparse (CSR) matrix and vector multiplication.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Q15 sparse (CSR) matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input CSR matrix structure
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> elements
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> elements
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using a 64-bit internal accumulator, as riscv_mat_vec_mult_q15().
+ * The inputs are in 1.15 format and multiplications yield a 2.30 result, which is accumulated in 34.30 format.
+ * The result is truncated to 34.15 format by discarding the low 15 bits and then saturated to 1.15 format.
+ */
+
+void riscv_mat_sparse_vec_mult_q15(
+  const riscv_sparse_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_sparse_vec_mult_q15);
+  const q15_t *pInA = pSrcMat->pData;            /* nonzero elements pointer */
+  const uint16_t *pCol = pSrcMat->pColIdx;       /* column index pointer */
+  const uint32_t *pRowPtr = pSrcMat->pRowPtr;    /* row offsets pointer */
+  q63_t acc;                                     /* Accumulator */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t row, cnt;                             /* loop counters */
+
+  for (row = 0u; row < numRows; row++)
+  {
+    cnt = pRowPtr[row + 1u] - pRowPtr[row];
+    acc = 0;
+
+    for (; cnt >= 2u; cnt -= 2u)
+    {
+      acc += (q31_t) pInA[0] * pVec[pCol[0]];
+      acc += (q31_t) pInA[1] * pVec[pCol[1]];
+      pInA += 2;
+      pCol += 2;
+    }
+
+    if(cnt != 0u)
+    {
+      acc += (q31_t) *pInA++ * pVec[*pCol++];
+    }
+
+    pDst[row] = (q15_t) __SSAT((acc >> 15), 16);
+  }
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
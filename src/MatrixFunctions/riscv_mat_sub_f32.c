@@ -54,6 +54,11 @@
  * The functions check to make sure that        
  * <code>pSrcA</code>, <code>pSrcB</code>, and <code>pDst</code> have the same        
  * number of rows and columns.        
+ *
+ * \par In place operation
+ * Every output element is computed from the input elements at the same index only, before the next element
+ * is read, so <code>pDst</code> may have the same data as <code>pSrcA</code> or <code>pSrcB</code>,
+ * e.g. <code>riscv_mat_sub_f32(&A, &B, &A)</code> computes <code>A -= B</code> without a scratch matrix.
  */
 
 /**        
@@ -65,7 +70,7 @@
  * @brief Floating-point matrix subtraction        
  * @param[in]       *pSrcA points to the first input matrix structure        
  * @param[in]       *pSrcB points to the second input matrix structure        
- * @param[out]      *pDst points to output matrix structure        
+ * @param[out]      *pDst points to output matrix structure, it may be the same as an input matrix
  * @return     		The function returns either        
  * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.        
  */
@@ -75,6 +80,7 @@ riscv_status riscv_mat_sub_f32(
   const riscv_matrix_instance_f32 * pSrcB,
   riscv_matrix_instance_f32 * pDst)
 {
+  RISCV_PROFILE(riscv_mat_sub_f32);
   float32_t *pIn1 = pSrcA->pData;                /* input data matrix pointer A */
   float32_t *pIn2 = pSrcB->pData;                /* input data matrix pointer B */
   float32_t *pOut = pDst->pData;                 /* output data matrix pointer  */
@@ -55,7 +55,7 @@
  * @brief Q15 matrix subtraction.    
  * @param[in]       *pSrcA points to the first input matrix structure    
  * @param[in]       *pSrcB points to the second input matrix structure    
- * @param[out]      *pDst points to output matrix structure    
+ * @param[out]      *pDst points to output matrix structure, it may be the same as an input matrix
  * @return     		The function returns either    
  * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.    
  *    
@@ -70,6 +70,7 @@ riscv_status riscv_mat_sub_q15(
   const riscv_matrix_instance_q15 * pSrcB,
   riscv_matrix_instance_q15 * pDst)
 {
+  RISCV_PROFILE(riscv_mat_sub_q15);
   q15_t *pInA = pSrcA->pData;                    /* input data matrix pointer A */
   q15_t *pInB = pSrcB->pData;                    /* input data matrix pointer B */
   q15_t *pOut = pDst->pData;                     /* output data matrix pointer */
@@ -0,0 +1,228 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_svd_f32.c
+*
+* Description:  Floating-point singular value decomposition with one-sided
+*               Jacobi rotations.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixEig
+ * @{
+ */
+
+/*
+* @brief  Applies a Jacobi rotation to two columns, x = c x - s y, y = s x + c y.
+* @param[in,out] *pX      points to the first element of the first column.
+* @param[in,out] *pY      points to the first element of the second column.
+* @param[in]     stride   number of columns of the matrix.
+* @param[in]     len      number of rows.
+* @param[in]     c        cosine of the rotation.
+* @param[in]     s        sine of the rotation.
+*/
+
+static void riscv_jacobi_rotate_cols_f32(
+  float32_t * pX,
+  float32_t * pY,
+  uint32_t stride,
+  uint32_t len,
+  float32_t c,
+  float32_t s)
+{
+  float32_t x, y;                                /* Elements of the two columns */
+  uint32_t k;                                    /* loop counter */
+
+  for (k = 0u; k < len; k++)
+  {
+    x = *pX;
+    y = *pY;
+    *pX = (c * x) - (s * y);
+    *pY = (s * x) + (c * y);
+    pX += stride;
+    pY += stride;
+  }
+}
+
+/**
+ * @brief Floating-point singular value decomposition.
+ * @param[in]       *pSrc points to the input matrix structure A, <code>M x N</code> with <code>M >= N</code>
+ * @param[out]      *pU points to the <code>M x N</code> output matrix structure of the left singular vectors, it may be the same as <code>pSrc</code>
+ * @param[out]      *pSigma points to the <code>N</code> singular values, largest first
+ * @param[out]      *pV points to the <code>N x N</code> output matrix structure of the right singular vectors, or NULL
+ * @param[in]       tol relative threshold of the cosine between two columns, for example 1e-6
+ * @return     		The function returns
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> if <code>M < N</code> or the sizes of the outputs do not match,
+ * <code>RISCV_MATH_DECOMPOSITION_FAILURE</code> if the rotations have not converged after
+ * RISCV_MAT_JACOBI_MAX_SWEEPS sweeps, otherwise <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * This is the thin decomposition: <code>U</code> has as many columns as A, orthonormal except the
+ * columns of the zero singular values, which are not normalized.  The singular values are accurate
+ * relative to each one, not only to the largest, which the eigenvalues of <code>A^T * A</code> are not.
+ * A pair <code>(p, q)</code> is skipped when <code>|u_p . u_q| <= tol * ||u_p|| * ||u_q||</code>; the
+ * three sums are computed in one pass over the two columns.
+ */
+
+riscv_status riscv_mat_svd_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pU,
+  float32_t * pSigma,
+  riscv_matrix_instance_f32 * pV,
+  float32_t tol)
+{
+  RISCV_PROFILE(riscv_mat_svd_f32);
+  float32_t *pOut = pU->pData;                   /* U data pointer */
+  float32_t alpha, beta, gamma, x, y;            /* Norms and dot product of two columns */
+  float32_t zeta, t, c, s, v;                    /* The rotation */
+  uint32_t numRows = pSrc->numRows;              /* M */
+  uint32_t numCols = pSrc->numCols;              /* N */
+  uint32_t p, q, k, sweep, rotated, best;        /* loop counters */
+  riscv_status status;                             /* status of the decomposition */
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((numRows < numCols) || (pU->numRows != numRows) || (pU->numCols != numCols) ||
+     ((pV != NULL) && ((pV->numRows != numCols) || (pV->numCols != numCols))))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    if(pOut != pSrc->pData)
+    {
+      memcpy(pOut, pSrc->pData, numRows * numCols * sizeof(float32_t));
+    }
+
+    if(pV != NULL)
+    {
+      /* V = I */
+      memset(pV->pData, 0, numCols * numCols * sizeof(float32_t));
+      for (p = 0u; p < numCols; p++)
+      {
+        pV->pData[(p * numCols) + p] = 1.0f;
+      }
+    }
+
+    status = RISCV_MATH_DECOMPOSITION_FAILURE;
+    for (sweep = 0u; sweep < RISCV_MAT_JACOBI_MAX_SWEEPS; sweep++)
+    {
+      rotated = 0u;
+
+      for (p = 0u; p + 1u < numCols; p++)
+      {
+        for (q = p + 1u; q < numCols; q++)
+        {
+          alpha = 0.0f;
+          beta = 0.0f;
+          gamma = 0.0f;
+          for (k = 0u; k < numRows; k++)
+          {
+            x = pOut[(k * numCols) + p];
+            y = pOut[(k * numCols) + q];
+            alpha += x * x;
+            beta += y * y;
+            gamma += x * y;
+          }
+
+          if(fabsf(gamma) <= (tol * sqrtf(alpha * beta)))
+          {
+            continue;
+          }
+
+          /* rotation of the 2x2 Gram matrix [alpha gamma; gamma beta] to a diagonal */
+          zeta = (beta - alpha) / (2.0f * gamma);
+          t = 1.0f / (fabsf(zeta) + sqrtf((zeta * zeta) + 1.0f));
+          t = (zeta < 0.0f) ? -t : t;
+          c = 1.0f / sqrtf((t * t) + 1.0f);
+          s = t * c;
+
+          riscv_jacobi_rotate_cols_f32(pOut + p, pOut + q, numCols, numRows, c, s);
+          if(pV != NULL)
+          {
+            riscv_jacobi_rotate_cols_f32(pV->pData + p, pV->pData + q, numCols, numCols, c, s);
+          }
+
+          rotated++;
+        }
+      }
+
+      if(rotated == 0u)
+      {
+        status = RISCV_MATH_SUCCESS;
+        break;
+      }
+    }
+
+    /* sigma_j = ||u_j||, then u_j / sigma_j */
+    for (p = 0u; p < numCols; p++)
+    {
+      alpha = 0.0f;
+      for (k = 0u; k < numRows; k++)
+      {
+        alpha += pOut[(k * numCols) + p] * pOut[(k * numCols) + p];
+      }
+      pSigma[p] = sqrtf(alpha);
+
+      if(pSigma[p] > 0.0f)
+      {
+        v = 1.0f / pSigma[p];
+        for (k = 0u; k < numRows; k++)
+        {
+          pOut[(k * numCols) + p] *= v;
+        }
+      }
+    }
+
+    /* largest first, the columns of U and V follow their singular value */
+    for (p = 0u; p + 1u < numCols; p++)
+    {
+      best = p;
+      for (q = p + 1u; q < numCols; q++)
+      {
+        best = (pSigma[q] > pSigma[best]) ? q : best;
+      }
+
+      if(best != p)
+      {
+        v = pSigma[p];
+        pSigma[p] = pSigma[best];
+        pSigma[best] = v;
+
+        for (k = 0u; k < numRows; k++)
+        {
+          v = pOut[(k * numCols) + p];
+          pOut[(k * numCols) + p] = pOut[(k * numCols) + best];
+          pOut[(k * numCols) + best] = v;
+        }
+
+        if(pV != NULL)
+        {
+          for (k = 0u; k < numCols; k++)
+          {
+            v = pV->pData[(k * numCols) + p];
+            pV->pData[(k * numCols) + p] = pV->pData[(k * numCols) + best];
+            pV->pData[(k * numCols) + best] = v;
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixEig group
+ */
@@ -0,0 +1,164 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_syrk_f32.c
+*
+* Description:  Floating-point product of a matrix with its transpose.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSyrk Product of a Matrix with its Transpose
+ *
+ * Computes the symmetric matrix
+ * <pre>
+ *    C = A * A^T       (transFlag = 0, C is numRows x numRows)
+ *    C = A^T * A       (transFlag = 1, C is numCols x numCols)
+ * </pre>
+ * as the SYRK (symmetric rank-k) operation of BLAS, for example a covariance or a Gram matrix.
+ * Compared with riscv_mat_trans_f32() followed by riscv_mat_mult_f32(), no buffer is needed for the
+ * transpose of <code>A</code>, and since <code>C</code> is symmetric only its lower triangle, diagonal included,
+ * is computed, which is about half of the multiply-accumulates.
+ * \par
+ * With <code>fillFlag</code> set to 1 the lower triangle is copied to the upper triangle, with
+ * <code>fillFlag</code> set to 0 the upper triangle of <code>pDst</code> is not written.  The latter is enough
+ * for functions that only read the lower triangle, such as riscv_mat_cholesky_f32().
+ * \par
+ * Element <code>C[i][j]</code> is the dot product of rows <code>i</code> and <code>j</code> of <code>A</code> for
+ * <code>transFlag = 0</code> and of columns <code>i</code> and <code>j</code> for <code>transFlag = 1</code>.
+ * <code>pDst</code> must not have the same data as <code>pSrc</code>.
+ */
+
+/**
+ * @addtogroup MatrixSyrk
+ * @{
+ */
+
+/*
+* @brief  Dot product of two rows or columns.
+* @param[in]  *pA      points to the first element of the first vector.
+* @param[in]  *pB      points to the first element of the second vector.
+* @param[in]  stride   distance between two elements of a vector.
+* @param[in]  len      number of elements.
+* @return     dot product.
+*/
+
+static float32_t riscv_mat_syrk_dot_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+  uint32_t stride,
+  uint32_t len)
+{
+  float32_t sum = 0.0f;                          /* accumulator */
+  uint32_t blkCnt;                               /* loop counter */
+
+  for (blkCnt = len >> 2u; blkCnt > 0u; blkCnt--)
+  {
+    sum += pA[0] * pB[0];
+    sum += pA[stride] * pB[stride];
+    sum += pA[2u * stride] * pB[2u * stride];
+    sum += pA[3u * stride] * pB[3u * stride];
+    pA += 4u * stride;
+    pB += 4u * stride;
+  }
+
+  for (blkCnt = len & 3u; blkCnt > 0u; blkCnt--)
+  {
+    sum += *pA * *pB;
+    pA += stride;
+    pB += stride;
+  }
+
+  return (sum);
+}
+
+/**
+ * @brief Floating-point product of a matrix with its transpose.
+ * @param[in]       *pSrc points to the input matrix structure A
+ * @param[out]      *pDst points to the output matrix structure C
+ * @param[in]       transFlag 0 computes <code>A * A^T</code>, 1 computes <code>A^T * A</code>
+ * @param[in]       fillFlag 1 also writes the upper triangle of C, 0 only writes the lower triangle
+ * @return     		The function returns either
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+ */
+
+riscv_status riscv_mat_syrk_f32(
+  const riscv_matrix_instance_f32 * pSrc,
+  riscv_matrix_instance_f32 * pDst,
+  uint8_t transFlag,
+  uint8_t fillFlag)
+{
+  RISCV_PROFILE(riscv_mat_syrk_f32);
+  const float32_t *pIn = pSrc->pData;            /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  uint32_t n, len;                               /* size of C and length of the dot products */
+  uint32_t vecStep, stride;                      /* distance between two vectors and two elements */
+  uint32_t i, j;                                 /* loop counters */
+  riscv_status status;                             /* status of matrix multiplication */
+
+  if(transFlag == 0u)
+  {
+    /* Dot products of rows */
+    n = pSrc->numRows;
+    len = pSrc->numCols;
+    vecStep = pSrc->numCols;
+    stride = 1u;
+  }
+  else
+  {
+    /* Dot products of columns */
+    n = pSrc->numCols;
+    len = pSrc->numRows;
+    vecStep = 1u;
+    stride = pSrc->numCols;
+  }
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pDst->numRows != n) || (pDst->numCols != n))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    /* Lower triangle and diagonal */
+    for (i = 0u; i < n; i++)
+    {
+      for (j = 0u; j <= i; j++)
+      {
+        pOut[(i * n) + j] = riscv_mat_syrk_dot_f32(pIn + (i * vecStep), pIn + (j * vecStep), stride, len);
+      }
+    }
+
+    /* Mirror to the upper triangle */
+    if(fillFlag == 1u)
+    {
+      for (i = 0u; i < n; i++)
+      {
+        for (j = i + 1u; j < n; j++)
+        {
+          pOut[(i * n) + j] = pOut[(j * n) + i];
+        }
+      }
+    }
+
+    /* Set status as RISCV_MATH_SUCCESS */
+    status = RISCV_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSyrk group
+ */
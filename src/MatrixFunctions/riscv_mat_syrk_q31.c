@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_syrk_q31.c
+*
+* Description:  Q31 product of a matrix with its transpose.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSyrk
+ * @{
+ */
+
+/*
+* @brief  Dot product of two rows or columns.
+* @param[in]  *pA      points to the first element of the first vector.
+* @param[in]  *pB      points to the first element of the second vector.
+* @param[in]  stride   distance between two elements of a vector.
+* @param[in]  len      number of elements.
+* @return     dot product.
+*/
+
+static q63_t riscv_mat_syrk_dot_q31(
+  const q31_t * pA,
+  const q31_t * pB,
+  uint32_t stride,
+  uint32_t len)
+{
+  q63_t sum = 0;                                 /* accumulator */
+  uint32_t blkCnt;                               /* loop counter */
+
+  for (blkCnt = len >> 2u; blkCnt > 0u; blkCnt--)
+  {
+    sum += (q63_t) pA[0] * pB[0];
+    sum += (q63_t) pA[stride] * pB[stride];
+    sum += (q63_t) pA[2u * stride] * pB[2u * stride];
+    sum += (q63_t) pA[3u * stride] * pB[3u * stride];
+    pA += 4u * stride;
+    pB += 4u * stride;
+  }
+
+  for (blkCnt = len & 3u; blkCnt > 0u; blkCnt--)
+  {
+    sum += (q63_t) *pA * *pB;
+    pA += stride;
+    pB += stride;
+  }
+
+  return (sum);
+}
+
+/**
+ * @brief Q31 product of a matrix with its transpose.
+ * @param[in]       *pSrc points to the input matrix structure A
+ * @param[out]      *pDst points to the output matrix structure C
+ * @param[in]       transFlag 0 computes <code>A * A^T</code>, 1 computes <code>A^T * A</code>
+ * @param[in]       fillFlag 1 also writes the upper triangle of C, 0 only writes the lower triangle
+ * @return     		The function returns either
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking. *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using a 64-bit internal accumulator, as riscv_mat_mult_q31().
+ * The inputs are in 1.31 format and the products are accumulated in 2.62 format,
+ * the result is shifted right by 31 bits and saturated to 1.31 format.
+ * There is no saturation on intermediate additions, so the input must be scaled down by log2 of the length of
+ * the dot products (numCols for <code>transFlag = 0</code>, numRows for <code>transFlag = 1</code>) to avoid overflows.
+ */
+
+riscv_status riscv_mat_syrk_q31(
+  const riscv_matrix_instance_q31 * pSrc,
+  riscv_matrix_instance_q31 * pDst,
+  uint8_t transFlag,
+  uint8_t fillFlag)
+{
+  RISCV_PROFILE(riscv_mat_syrk_q31);
+  const q31_t *pIn = pSrc->pData;            /* input data matrix pointer */
+  q31_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  uint32_t n, len;                               /* size of C and length of the dot products */
+  uint32_t vecStep, stride;                      /* distance between two vectors and two elements */
+  q63_t sum;                                     /* accumulator */
+  uint32_t i, j;                                 /* loop counters */
+  riscv_status status;                             /* status of matrix multiplication */
+
+  if(transFlag == 0u)
+  {
+    /* Dot products of rows */
+    n = pSrc->numRows;
+    len = pSrc->numCols;
+    vecStep = pSrc->numCols;
+    stride = 1u;
+  }
+  else
+  {
+    /* Dot products of columns */
+    n = pSrc->numCols;
+    len = pSrc->numRows;
+    vecStep = 1u;
+    stride = pSrc->numCols;
+  }
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pDst->numRows != n) || (pDst->numCols != n))
+  {
+    /* Set status as RISCV_MATH_SIZE_MISMATCH */
+    status = RISCV_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
+  {
+    /* Lower triangle and diagonal */
+    for (i = 0u; i < n; i++)
+    {
+      for (j = 0u; j <= i; j++)
+      {
+        sum = riscv_mat_syrk_dot_q31(pIn + (i * vecStep), pIn + (j * vecStep), stride, len);
+        pOut[(i * n) + j] = (q31_t) clip_q63_to_q31(sum >> 31);
+      }
+    }
+
+    /* Mirror to the upper triangle */
+    if(fillFlag == 1u)
+    {
+      for (i = 0u; i < n; i++)
+      {
+        for (j = i + 1u; j < n; j++)
+        {
+          pOut[(i * n) + j] = pOut[(j * n) + i];
+        }
+      }
+    }
+
+    /* Set status as RISCV_MATH_SUCCESS */
+    status = RISCV_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSyrk group
+ */
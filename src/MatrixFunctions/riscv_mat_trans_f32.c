@@ -45,6 +45,10 @@
  *    
  * Tranposes a matrix.    
  * Transposing an <code>M x N</code> matrix flips it around the center diagonal and results in an <code>N x M</code> matrix.    
+ * \par
+ * A square matrix can be transposed in place by passing an output matrix with the same data as the input.
+ * The elements are then swapped across the diagonal, so no second buffer is needed.
+ * An in place transpose of a matrix that is not square returns <code>RISCV_MATH_SIZE_MISMATCH</code>.
  * \image html MatrixTranspose.gif "Transpose of a 3 x 3 matrix"    
  */
 
@@ -62,7 +66,7 @@
 /**    
   * @brief Floating-point matrix transpose.    
   * @param[in]  *pSrc points to the input matrix    
-  * @param[out] *pDst points to the output matrix    
+  * @param[out] *pDst points to the output matrix, it may have the same data as <code>pSrc</code> if the matrix is square    
   * @return 	The function returns either  <code>RISCV_MATH_SIZE_MISMATCH</code>    
   * or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.    
   */
@@ -72,6 +76,7 @@ riscv_status riscv_mat_trans_f32(
   const riscv_matrix_instance_f32 * pSrc,
   riscv_matrix_instance_f32 * pDst)
 {
+  RISCV_PROFILE(riscv_mat_trans_f32);
   float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
   float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
   float32_t *px;                                 /* Temporary output data matrix pointer */
@@ -79,6 +84,7 @@ riscv_status riscv_mat_trans_f32(
   uint16_t nColumns = pSrc->numCols;             /* number of columns */
 
   uint16_t col, i = 0u, row = nRows;             /* loop counters */
+  float32_t *pa, *pb, tmp;                       /* Elements swapped by the in place transpose */
   riscv_status status;                             /* status of matrix transpose  */
 
 
@@ -93,6 +99,36 @@ riscv_status riscv_mat_trans_f32(
   else
 #endif /*      #ifdef RISCV_MATH_MATRIX_CHECK    */
 
+  if(pIn == pOut)
+  {
+    /* In place transpose of a square matrix, swap the elements across the diagonal */
+    if(nRows != nColumns)
+    {
+      /* Set status as RISCV_MATH_SIZE_MISMATCH */
+      status = RISCV_MATH_SIZE_MISMATCH;
+    }
+    else
+    {
+      for (i = 0u; (i + 1u) < nRows; i++)
+      {
+        /* pa walks right along row i, pb walks down column i */
+        pa = pIn + (i * nRows) + i + 1u;
+        pb = pa + (nRows - 1u);
+
+        for (col = i + 1u; col < nRows; col++)
+        {
+          tmp = *pa;
+          *pa++ = *pb;
+          *pb = tmp;
+          pb += nRows;
+        }
+      }
+
+      /* Set status as RISCV_MATH_SUCCESS */
+      status = RISCV_MATH_SUCCESS;
+    }
+  }
+  else
   {
     /* Matrix transpose by exchanging the rows with columns */
     /* row loop     */
@@ -54,21 +54,35 @@
 /*    
  * @brief Q15 matrix transpose.    
  * @param[in]  *pSrc points to the input matrix    
- * @param[out] *pDst points to the output matrix    
+ * @param[out] *pDst points to the output matrix, it may have the same data as <code>pSrc</code> if the matrix is square    
  * @return 	The function returns either  <code>RISCV_MATH_SIZE_MISMATCH</code>    
  * or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.    
+ *
+ * \par
+ * With <code>USE_DSP_RISCV</code> a matrix with an even number of rows and columns, 4-byte aligned,
+ * is transposed in 2x2 blocks: one word load of two rows each, two <code>pv.shuffle2.h</code> and two
+ * word stores, half the loads and stores of the element by element copy.  riscv_mat_mult_q15() and
+ * riscv_mat_mult_fast_q15() transpose B with this function.
  */
 
 riscv_status riscv_mat_trans_q15(
   const riscv_matrix_instance_q15 * pSrc,
   riscv_matrix_instance_q15 * pDst)
 {
+  RISCV_PROFILE(riscv_mat_trans_q15);
   q15_t *pSrcA = pSrc->pData;                    /* input data matrix pointer */
   q15_t *pOut = pDst->pData;                     /* output data matrix pointer */
   uint16_t nRows = pSrc->numRows;                /* number of nRows */
   uint16_t nColumns = pSrc->numCols;             /* number of nColumns */
   uint16_t col, row = nRows, i = 0u;             /* row and column loop counters */
+  q15_t *pa, *pb, tmp;                           /* Elements swapped by the in place transpose */
   riscv_status status;                             /* status of matrix transpose */
+#if defined (USE_DSP_RISCV)
+  shortV lo = { 0, 2 };                          /* First column of two rows */
+  shortV hi = { 1, 3 };                          /* Second column of two rows */
+  shortV a, b;                                   /* Two elements of rows i and i+1 */
+  q15_t *pNext;                                  /* Row i+1 of the input */
+#endif
 
 #ifdef RISCV_MATH_MATRIX_CHECK
 
@@ -81,6 +95,65 @@ riscv_status riscv_mat_trans_q15(
   else
 #endif /*    #ifdef RISCV_MATH_MATRIX_CHECK    */
 
+  if(pSrcA == pOut)
+  {
+    /* In place transpose of a square matrix, swap the elements across the diagonal */
+    if(nRows != nColumns)
+    {
+      /* Set status as RISCV_MATH_SIZE_MISMATCH */
+      status = RISCV_MATH_SIZE_MISMATCH;
+    }
+    else
+    {
+      for (i = 0u; (i + 1u) < nRows; i++)
+      {
+        /* pa walks right along row i, pb walks down column i */
+        pa = pSrcA + (i * nRows) + i + 1u;
+        pb = pa + (nRows - 1u);
+
+        for (col = i + 1u; col < nRows; col++)
+        {
+          tmp = *pa;
+          *pa++ = *pb;
+          *pb = tmp;
+          pb += nRows;
+        }
+      }
+
+      /* Set status as RISCV_MATH_SUCCESS */
+      status = RISCV_MATH_SUCCESS;
+    }
+  }
+  else
+#if defined (USE_DSP_RISCV)
+  if(((nRows | nColumns) & 1u) == 0u)
+  {
+    /* 2x2 blocks: a word of row i and a word of row i+1 give a word of two columns */
+    for (i = 0u; i < nRows; i += 2u)
+    {
+      pNext = pSrcA + nColumns;
+      pOut = pDst->pData + i;
+
+      for (col = 0u; col < nColumns; col += 2u)
+      {
+        a = *(shortV *) pSrcA;
+        b = *(shortV *) pNext;
+        *(shortV *) pOut = shufflev4(a, b, lo);
+        *(shortV *) (pOut + nRows) = shufflev4(a, b, hi);
+        pSrcA += 2u;
+        pNext += 2u;
+        pOut += 2u * nRows;
+      }
+
+      /* Skip row i+1, already read */
+      pSrcA += nColumns;
+    }
+
+    /* set status as RISCV_MATH_SUCCESS */
+    status = RISCV_MATH_SUCCESS;
+  }
+  else
+#endif
   {
     /* Matrix transpose by exchanging the rows with columns */
     /* row loop     */
@@ -54,7 +54,7 @@
 /*    
   * @brief Q31 matrix transpose.    
   * @param[in]  *pSrc points to the input matrix    
-  * @param[out] *pDst points to the output matrix    
+  * @param[out] *pDst points to the output matrix, it may have the same data as <code>pSrc</code> if the matrix is square    
   * @return 	The function returns either  <code>RISCV_MATH_SIZE_MISMATCH</code>    
   * or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.    
  */
@@ -63,6 +63,7 @@ riscv_status riscv_mat_trans_q31(
   const riscv_matrix_instance_q31 * pSrc,
   riscv_matrix_instance_q31 * pDst)
 {
+  RISCV_PROFILE(riscv_mat_trans_q31);
   q31_t *pIn = pSrc->pData;                      /* input data matrix pointer  */
   q31_t *pOut = pDst->pData;                     /* output data matrix pointer  */
   q31_t *px;                                     /* Temporary output data matrix pointer */
@@ -70,6 +71,7 @@ riscv_status riscv_mat_trans_q31(
   uint16_t nColumns = pSrc->numCols;             /* number of nColumns  */
 
   uint16_t col, i = 0u, row = nRows;             /* loop counters */
+  q31_t *pa, *pb, tmp;                           /* Elements swapped by the in place transpose */
   riscv_status status;                             /* status of matrix transpose */
 
 
@@ -84,6 +86,36 @@ riscv_status riscv_mat_trans_q31(
   else
 #endif /*    #ifdef RISCV_MATH_MATRIX_CHECK    */
 
+  if(pIn == pOut)
+  {
+    /* In place transpose of a square matrix, swap the elements across the diagonal */
+    if(nRows != nColumns)
+    {
+      /* Set status as RISCV_MATH_SIZE_MISMATCH */
+      status = RISCV_MATH_SIZE_MISMATCH;
+    }
+    else
+    {
+      for (i = 0u; (i + 1u) < nRows; i++)
+      {
+        /* pa walks right along row i, pb walks down column i */
+        pa = pIn + (i * nRows) + i + 1u;
+        pb = pa + (nRows - 1u);
+
+        for (col = i + 1u; col < nRows; col++)
+        {
+          tmp = *pa;
+          *pa++ = *pb;
+          *pb = tmp;
+          pb += nRows;
+        }
+      }
+
+      /* Set status as RISCV_MATH_SUCCESS */
+      status = RISCV_MATH_SUCCESS;
+    }
+  }
+  else
   {
     /* Matrix transpose by exchanging the rows with columns */
     /* row loop     */
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_vec_mult_f32.c
+*
+* Description:  Floating-point matrix and vector multiplication.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixVectMult Matrix Vector Multiplication
+ *
+ * Multiplies a matrix and a vector, <code>y = A * x</code>.
+ * <code>pVec</code> holds <code>numCols</code> elements and <code>pDst</code> receives <code>numRows</code>
+ * elements.  The functions give the result of riscv_mat_mult_f32(), riscv_mat_mult_q31(), riscv_mat_mult_q15()
+ * with a matrix of one column, without the general code path and, for Q15, without the transpose of the
+ * right-hand matrix.
+ * \par
+ * Four rows of the matrix are processed together so that every element of <code>x</code> that is loaded
+ * serves four dot products.  In the USE_DSP_RISCV build the Q15 version loads pairs of elements and uses
+ * dotpv2, the Q7 version loads four elements and uses sumdotpv4.
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Floating-point matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> elements
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> elements
+ * @return none.
+ */
+
+void riscv_mat_vec_mult_f32(
+  const riscv_matrix_instance_f32 * pSrcMat,
+  float32_t * pVec,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_vec_mult_f32);
+  const float32_t *pInA = pSrcMat->pData;        /* input data matrix pointer */
+  const float32_t *pA0, *pA1, *pA2, *pA3;        /* Row pointers */
+  const float32_t *px;                           /* Vector pointer */
+  float32_t x;                                   /* Vector element */
+  float32_t acc0, acc1, acc2, acc3;              /* Accumulators */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row = 0u, colCnt;                     /* loop counters */
+
+  /* Four rows at a time */
+  for (; (row + 4u) <= numRows; row += 4u)
+  {
+    pA0 = pInA + (row * numCols);
+    pA1 = pA0 + numCols;
+    pA2 = pA1 + numCols;
+    pA3 = pA2 + numCols;
+    px = pVec;
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+    acc2 = 0.0f;
+    acc3 = 0.0f;
+
+    for (colCnt = numCols; colCnt > 0u; colCnt--)
+    {
+      x = *px++;
+      acc0 += *pA0++ * x;
+      acc1 += *pA1++ * x;
+      acc2 += *pA2++ * x;
+      acc3 += *pA3++ * x;
+    }
+
+    pDst[row] = acc0;
+    pDst[row + 1u] = acc1;
+    pDst[row + 2u] = acc2;
+    pDst[row + 3u] = acc3;
+  }
+
+  /* Remaining rows */
+  for (; row < numRows; row++)
+  {
+    pA0 = pInA + (row * numCols);
+    px = pVec;
+    acc0 = 0.0f;
+
+    for (colCnt = numCols; colCnt > 0u; colCnt--)
+    {
+      acc0 += *pA0++ * *px++;
+    }
+
+    pDst[row] = acc0;
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
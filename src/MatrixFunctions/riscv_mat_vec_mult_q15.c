@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_vec_mult_q15.c
+*
+* Description:  Q15 matrix and vector multiplication.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Q15 matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> elements
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> elements
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using a 64-bit internal accumulator, as riscv_mat_mult_q15().
+ * The inputs are in 1.15 format and multiplications yield a 2.30 result, which is accumulated in 34.30 format.
+ * The result is truncated to 34.15 format by discarding the low 15 bits and then saturated to 1.15 format.
+ */
+
+void riscv_mat_vec_mult_q15(
+  const riscv_matrix_instance_q15 * pSrcMat,
+  q15_t * pVec,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_vec_mult_q15);
+  const q15_t *pInA = pSrcMat->pData;            /* input data matrix pointer */
+  const q15_t *pA0, *pA1, *pA2, *pA3;            /* Row pointers */
+  const q15_t *px;                               /* Vector pointer */
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row = 0u, colCnt;                     /* loop counters */
+#if defined (USE_DSP_RISCV)
+  shortV x;                                      /* Pair of vector elements */
+#else
+  q31_t x;                                       /* Vector element */
+#endif
+
+  /* Four rows at a time */
+  for (; (row + 4u) <= numRows; row += 4u)
+  {
+    pA0 = pInA + (row * numCols);
+    pA1 = pA0 + numCols;
+    pA2 = pA1 + numCols;
+    pA3 = pA2 + numCols;
+    px = pVec;
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+#if defined (USE_DSP_RISCV)
+
+    /* One pair of x serves a pair of each of the four rows */
+    for (colCnt = numCols >> 1u; colCnt > 0u; colCnt--)
+    {
+      x = *(shortV *) px;
+      px += 2;
+      acc0 += dotpv2(*(shortV *) pA0, x);
+      acc1 += dotpv2(*(shortV *) pA1, x);
+      acc2 += dotpv2(*(shortV *) pA2, x);
+      acc3 += dotpv2(*(shortV *) pA3, x);
+      pA0 += 2;
+      pA1 += 2;
+      pA2 += 2;
+      pA3 += 2;
+    }
+
+    if((numCols & 1u) != 0u)
+    {
+      acc0 += (q31_t) *pA0 * *px;
+      acc1 += (q31_t) *pA1 * *px;
+      acc2 += (q31_t) *pA2 * *px;
+      acc3 += (q31_t) *pA3 * *px;
+    }
+
+#else
+
+    for (colCnt = numCols; colCnt > 0u; colCnt--)
+    {
+      x = *px++;
+      acc0 += *pA0++ * x;
+      acc1 += *pA1++ * x;
+      acc2 += *pA2++ * x;
+      acc3 += *pA3++ * x;
+    }
+
+#endif
+
+    /* Saturate and store the results in the destination buffer */
+    pDst[row] = (q15_t) __SSAT((acc0 >> 15), 16);
+    pDst[row + 1u] = (q15_t) __SSAT((acc1 >> 15), 16);
+    pDst[row + 2u] = (q15_t) __SSAT((acc2 >> 15), 16);
+    pDst[row + 3u] = (q15_t) __SSAT((acc3 >> 15), 16);
+  }
+
+  /* Remaining rows */
+  for (; row < numRows; row++)
+  {
+    pA0 = pInA + (row * numCols);
+    px = pVec;
+    acc0 = 0;
+    colCnt = numCols;
+
+#if defined (USE_DSP_RISCV)
+
+    for (; colCnt >= 2u; colCnt -= 2u)
+    {
+      acc0 += dotpv2(*(shortV *) pA0, *(shortV *) px);
+      pA0 += 2;
+      px += 2;
+    }
+
+#endif
+
+    for (; colCnt > 0u; colCnt--)
+    {
+      acc0 += (q31_t) *pA0++ * *px++;
+    }
+
+    pDst[row] = (q15_t) __SSAT((acc0 >> 15), 16);
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
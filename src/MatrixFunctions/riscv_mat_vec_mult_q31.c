@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_vec_mult_q31.c
+*
+* Description:  Q31 matrix and vector multiplication.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Q31 matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> elements
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> elements
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using a 64-bit internal accumulator, as riscv_mat_mult_q31().
+ * The inputs are in 1.31 format and multiplications yield a 2.62 result, which is accumulated in 2.62 format.
+ * The accumulator has no guard bits, so the inputs should be scaled down by log2(numCols) bits to avoid
+ * overflows.  The result is truncated to 2.31 format by discarding the low 31 bits and then saturated to
+ * 1.31 format.
+ */
+
+void riscv_mat_vec_mult_q31(
+  const riscv_matrix_instance_q31 * pSrcMat,
+  q31_t * pVec,
+  q31_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_vec_mult_q31);
+  const q31_t *pInA = pSrcMat->pData;            /* input data matrix pointer */
+  const q31_t *pA0, *pA1, *pA2, *pA3;            /* Row pointers */
+  const q31_t *px;                               /* Vector pointer */
+  q63_t x;                                       /* Vector element */
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row = 0u, colCnt;                     /* loop counters */
+
+  /* Four rows at a time */
+  for (; (row + 4u) <= numRows; row += 4u)
+  {
+    pA0 = pInA + (row * numCols);
+    pA1 = pA0 + numCols;
+    pA2 = pA1 + numCols;
+    pA3 = pA2 + numCols;
+    px = pVec;
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+    for (colCnt = numCols; colCnt > 0u; colCnt--)
+    {
+      x = *px++;
+      acc0 += *pA0++ * x;
+      acc1 += *pA1++ * x;
+      acc2 += *pA2++ * x;
+      acc3 += *pA3++ * x;
+    }
+
+    /* Convert the results from 2.62 to 1.31 format with saturation */
+    pDst[row] = (q31_t) clip_q63_to_q31(acc0 >> 31);
+    pDst[row + 1u] = (q31_t) clip_q63_to_q31(acc1 >> 31);
+    pDst[row + 2u] = (q31_t) clip_q63_to_q31(acc2 >> 31);
+    pDst[row + 3u] = (q31_t) clip_q63_to_q31(acc3 >> 31);
+  }
+
+  /* Remaining rows */
+  for (; row < numRows; row++)
+  {
+    pA0 = pInA + (row * numCols);
+    px = pVec;
+    acc0 = 0;
+
+    for (colCnt = numCols; colCnt > 0u; colCnt--)
+    {
+      acc0 += (q63_t) *pA0++ * *px++;
+    }
+
+    pDst[row] = (q31_t) clip_q63_to_q31(acc0 >> 31);
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
@@ -0,0 +1,218 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_vec_mult_q4_q7.c
+*
+* Description:  Multiplication of a Q7 vector by a matrix of packed 4-bit weights.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/*
+* @brief  Adds the products of eight packed weights with eight Q7 elements to an accumulator.
+* @param[in]  w     word of eight weights in the layout of riscv_mat_pack_q4().
+* @param[in]  *px   points to the eight elements.
+* @param[in]  acc   accumulator.
+* @return     acc plus 16 times the sum of the products.
+*/
+
+static q31_t riscv_mat_dot8_q4_q7(
+  uint32_t w,
+  const q7_t * px,
+  q31_t acc)
+{
+#if defined (USE_DSP_RISCV)
+
+  /* weights 0-3 and 4-7 in the high nibbles of the bytes, 16 times their value */
+  acc = sumdotpv4((charV) ((w << 4) & 0xF0F0F0F0u), *(charV *) px, acc);
+  return (sumdotpv4((charV) (w & 0xF0F0F0F0u), *(charV *) (px + 4), acc));
+
+#else
+
+  uint32_t k;
+
+  for (k = 0u; k < 4u; k++)
+  {
+    acc += (q31_t) (int8_t) ((w >> (8u * k)) << 4) * px[k];
+    acc += (q31_t) (int8_t) ((w >> (8u * k)) & 0xF0u) * px[k + 4u];
+  }
+
+  return (acc);
+
+#endif
+}
+
+/*
+* @brief  Converts the accumulator of a row to the Q7 output.
+* @param[in]  acc       sum of the products of the weights with the vector.
+* @param[in]  *pRq      points to the requantization parameters, or NULL.
+* @param[in]  row       output row.
+* @return     output element.
+*/
+
+static q7_t riscv_mat_vec_requant_q4_q7(
+  q31_t acc,
+  const riscv_mat_requant_q7 * pRq,
+  uint32_t row)
+{
+  q63_t y;                                       /* Requantized value */
+  uint32_t i, shift;
+
+  if(pRq == NULL)
+  {
+    /* 1.3 weights by 1.7 elements, truncate the 2.10 sum to 1.7 and saturate */
+    return ((q7_t) __SSAT((acc >> 3), 8));
+  }
+
+  i = (pRq->numMult > 1u) ? row : 0u;
+  shift = 31u + pRq->pShift[i];
+
+  /* Q31 multiplier, rounding right shift, then the output offset */
+  y = ((q63_t) acc * pRq->pMultiplier[i]) + ((q63_t) 1 << (shift - 1u));
+  y = (y >> shift) + pRq->offset;
+
+  return ((q7_t) __SSAT(clip_q63_to_q31(y), 8));
+}
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Multiplication of a Q7 vector by a matrix of packed 4-bit weights.
+ * @param[in]       *pSrcMat points to the matrix structure packed by riscv_mat_pack_q4()
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> elements, word aligned
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> elements
+ * @return none.
+ *
+ * \par
+ * The weights take half the memory of a Q7 matrix and half its bandwidth, the unpacking is done in
+ * registers: with the xpulp extensions a word of eight weights gives two vectors of four by a shift and
+ * two masks, each multiplied with four elements by one sumdotpv4.  Four rows share the loads of the vector.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum of <code>(w - pZero[r]) * x</code> over the row is exact in a 32-bit accumulator for fewer than
+ * 2^17 columns; the zero point is applied once per row with the sum of the vector.  The sum is then
+ * requantized to Q7 with the multiplier, shift and offset of <code>pRq</code> as in riscv_mat_mult_q7().
+ * Without requantization parameters the weights are in 1.3 format and the 2.10 sum is truncated to 1.7
+ * and saturated.
+ */
+
+void riscv_mat_vec_mult_q4_q7(
+  const riscv_matrix_instance_q4 * pSrcMat,
+  const q7_t * pVec,
+  q7_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_vec_mult_q4_q7);
+  const uint32_t *pW0, *pW1, *pW2, *pW3;         /* Row pointers, eight weights per word */
+  const q7_t *px;                                /* Vector pointer */
+  q31_t acc0, acc1, acc2, acc3;                  /* Accumulators, 16 times the sums */
+  q31_t sumX = 0;                                /* Sum of the vector for the zero points */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t rowWords = RISCV_MAT_Q4_ROW_BYTES(numCols) >> 2u;
+  uint32_t numGroups = numCols >> 3u;            /* whole words of eight weights */
+  uint32_t tail = numCols & 7u;                  /* weights of the last, partial word */
+  uint32_t row = 0u, g, k;                       /* loop counters */
+  q31_t lastW[2];                                /* last elements of the vector, zero padded */
+  q7_t *last = (q7_t *) lastW;
+
+  for (k = 0u; k < numCols; k++)
+  {
+    sumX += pVec[k];
+  }
+
+  /* the padding weights are zero, so are the padding elements */
+  for (k = 0u; k < 8u; k++)
+  {
+    last[k] = (k < tail) ? pVec[(numGroups << 3u) + k] : 0;
+  }
+
+  /* Four rows at a time */
+  for (; (row + 4u) <= numRows; row += 4u)
+  {
+    pW0 = (const uint32_t *) pSrcMat->pData + (row * rowWords);
+    pW1 = pW0 + rowWords;
+    pW2 = pW1 + rowWords;
+    pW3 = pW2 + rowWords;
+    px = pVec;
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+    for (g = numGroups; g > 0u; g--)
+    {
+      acc0 = riscv_mat_dot8_q4_q7(*pW0++, px, acc0);
+      acc1 = riscv_mat_dot8_q4_q7(*pW1++, px, acc1);
+      acc2 = riscv_mat_dot8_q4_q7(*pW2++, px, acc2);
+      acc3 = riscv_mat_dot8_q4_q7(*pW3++, px, acc3);
+      px += 8;
+    }
+
+    if(tail != 0u)
+    {
+      acc0 = riscv_mat_dot8_q4_q7(*pW0, last, acc0);
+      acc1 = riscv_mat_dot8_q4_q7(*pW1, last, acc1);
+      acc2 = riscv_mat_dot8_q4_q7(*pW2, last, acc2);
+      acc3 = riscv_mat_dot8_q4_q7(*pW3, last, acc3);
+    }
+
+    /* the products are multiples of 16, the shift is exact */
+    acc0 >>= 4;
+    acc1 >>= 4;
+    acc2 >>= 4;
+    acc3 >>= 4;
+
+    if(pSrcMat->pZero != NULL)
+    {
+      acc0 -= pSrcMat->pZero[row] * sumX;
+      acc1 -= pSrcMat->pZero[row + 1u] * sumX;
+      acc2 -= pSrcMat->pZero[row + 2u] * sumX;
+      acc3 -= pSrcMat->pZero[row + 3u] * sumX;
+    }
+
+    pDst[row] = riscv_mat_vec_requant_q4_q7(acc0, pSrcMat->pRq, row);
+    pDst[row + 1u] = riscv_mat_vec_requant_q4_q7(acc1, pSrcMat->pRq, row + 1u);
+    pDst[row + 2u] = riscv_mat_vec_requant_q4_q7(acc2, pSrcMat->pRq, row + 2u);
+    pDst[row + 3u] = riscv_mat_vec_requant_q4_q7(acc3, pSrcMat->pRq, row + 3u);
+  }
+
+  /* Remaining rows */
+  for (; row < numRows; row++)
+  {
+    pW0 = (const uint32_t *) pSrcMat->pData + (row * rowWords);
+    px = pVec;
+    acc0 = 0;
+
+    for (g = numGroups; g > 0u; g--)
+    {
+      acc0 = riscv_mat_dot8_q4_q7(*pW0++, px, acc0);
+      px += 8;
+    }
+
+    if(tail != 0u)
+    {
+      acc0 = riscv_mat_dot8_q4_q7(*pW0, last, acc0);
+    }
+
+    acc0 >>= 4;
+    if(pSrcMat->pZero != NULL)
+    {
+      acc0 -= pSrcMat->pZero[row] * sumX;
+    }
+
+    pDst[row] = riscv_mat_vec_requant_q4_q7(acc0, pSrcMat->pRq, row);
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_vec_mult_q7.c
+*
+* Description:  Q7 matrix and vector multiplication.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Q7 matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector of <code>numCols</code> elements
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> elements
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using a 32-bit internal accumulator.
+ * The inputs are in 1.7 format and multiplications yield a 2.14 result, which is accumulated in 18.14 format.
+ * There is no risk of overflow as long as numCols is below 131072.  The result is truncated to 18.7 format
+ * by discarding the low 7 bits and then saturated to 1.7 format.
+ */
+
+void riscv_mat_vec_mult_q7(
+  const riscv_matrix_instance_q7 * pSrcMat,
+  q7_t * pVec,
+  q7_t * pDst)
+{
+  RISCV_PROFILE(riscv_mat_vec_mult_q7);
+  const q7_t *pInA = pSrcMat->pData;             /* input data matrix pointer */
+  const q7_t *pA0, *pA1, *pA2, *pA3;             /* Row pointers */
+  const q7_t *px;                                /* Vector pointer */
+  q31_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  q31_t x;                                       /* Vector element */
+  uint32_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row = 0u, colCnt;                     /* loop counters */
+#if defined (USE_DSP_RISCV)
+  charV xV;                                      /* Four vector elements */
+#endif
+
+  /* Four rows at a time */
+  for (; (row + 4u) <= numRows; row += 4u)
+  {
+    pA0 = pInA + (row * numCols);
+    pA1 = pA0 + numCols;
+    pA2 = pA1 + numCols;
+    pA3 = pA2 + numCols;
+    px = pVec;
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+    colCnt = numCols;
+
+#if defined (USE_DSP_RISCV)
+
+    /* Four elements of x serve four elements of each of the four rows */
+    for (; colCnt >= 4u; colCnt -= 4u)
+    {
+      xV = *(charV *) px;
+      px += 4;
+      acc0 = sumdotpv4(*(charV *) pA0, xV, acc0);
+      acc1 = sumdotpv4(*(charV *) pA1, xV, acc1);
+      acc2 = sumdotpv4(*(charV *) pA2, xV, acc2);
+      acc3 = sumdotpv4(*(charV *) pA3, xV, acc3);
+      pA0 += 4;
+      pA1 += 4;
+      pA2 += 4;
+      pA3 += 4;
+    }
+
+#endif
+
+    for (; colCnt > 0u; colCnt--)
+    {
+      x = *px++;
+      acc0 += *pA0++ * x;
+      acc1 += *pA1++ * x;
+      acc2 += *pA2++ * x;
+      acc3 += *pA3++ * x;
+    }
+
+    /* Saturate and store the results in the destination buffer */
+    pDst[row] = (q7_t) __SSAT((acc0 >> 7), 8);
+    pDst[row + 1u] = (q7_t) __SSAT((acc1 >> 7), 8);
+    pDst[row + 2u] = (q7_t) __SSAT((acc2 >> 7), 8);
+    pDst[row + 3u] = (q7_t) __SSAT((acc3 >> 7), 8);
+  }
+
+  /* Remaining rows */
+  for (; row < numRows; row++)
+  {
+    pA0 = pInA + (row * numCols);
+    px = pVec;
+    acc0 = 0;
+    colCnt = numCols;
+
+#if defined (USE_DSP_RISCV)
+
+    for (; colCnt >= 4u; colCnt -= 4u)
+    {
+      acc0 = sumdotpv4(*(charV *) pA0, *(charV *) px, acc0);
+      pA0 += 4;
+      px += 4;
+    }
+
+#endif
+
+    for (; colCnt > 0u; colCnt--)
+    {
+      acc0 += (q15_t) *pA0++ * *px++;
+    }
+
+    pDst[row] = (q7_t) __SSAT((acc0 >> 7), 8);
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
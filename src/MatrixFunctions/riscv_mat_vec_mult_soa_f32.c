@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_vec_mult_soa_f32.c
+*
+* Description:  Floating-point transform of vectors in structure-of-arrays
+*               layout by a small matrix.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixBatch
+ * @{
+ */
+
+/**
+ * @brief Floating-point multiplication of vectors in structure-of-arrays layout by a small matrix.
+ * @param[in]       *pMat points to the <code>dim*dim</code> elements of the matrix
+ * @param[in]       *pSrc points to the input vectors, component <code>k</code> of vector <code>n</code> is <code>pSrc[k*numVectors+n]</code>
+ * @param[out]      *pDst points to the output vectors in the same layout, they must not overlap the input
+ * @param[in]       dim size of the matrix and the vectors, 2, 3 or 4
+ * @param[in]       numVectors number of vectors
+ * @return     		The function returns
+ * <code>RISCV_MATH_ARGUMENT_ERROR</code> if <code>dim</code> is not 2, 3 or 4, otherwise <code>RISCV_MATH_SUCCESS</code>.
+ *
+ * \par
+ * Output vector <code>n</code> is <code>pMat * x[n]</code>.  The matrix is loaded into registers once and
+ * every output component is written to its own array, so a 3x3 rotation of <code>numVectors</code> vectors
+ * takes 9 multiply-accumulates and 6 memory accesses per vector.
+ */
+
+riscv_status riscv_mat_vec_mult_soa_f32(
+  const float32_t * pMat,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint16_t dim,
+  uint32_t numVectors)
+{
+  RISCV_PROFILE(riscv_mat_vec_mult_soa_f32);
+  const float32_t *pX = pSrc;                    /* First component of the input */
+  const float32_t *pY = pSrc + numVectors;       /* Second component of the input */
+  float32_t *pOutX = pDst;                       /* First component of the output */
+  float32_t *pOutY = pDst + numVectors;          /* Second component of the output */
+  float32_t m00, m01, m02, m03, m10, m11, m12, m13;  /* Elements of the matrix */
+  float32_t m20, m21, m22, m23, m30, m31, m32, m33;
+  float32_t x, y, z, w;                          /* Components of a vector */
+  uint32_t n;                                    /* Vector counter */
+
+  switch (dim)
+  {
+  case 2u:
+    m00 = pMat[0];
+    m01 = pMat[1];
+    m10 = pMat[2];
+    m11 = pMat[3];
+
+    for (n = 0u; n < numVectors; n++)
+    {
+      x = pX[n];
+      y = pY[n];
+      pOutX[n] = (m00 * x) + (m01 * y);
+      pOutY[n] = (m10 * x) + (m11 * y);
+    }
+    break;
+
+  case 3u:
+    m00 = pMat[0];
+    m01 = pMat[1];
+    m02 = pMat[2];
+    m10 = pMat[3];
+    m11 = pMat[4];
+    m12 = pMat[5];
+    m20 = pMat[6];
+    m21 = pMat[7];
+    m22 = pMat[8];
+
+    for (n = 0u; n < numVectors; n++)
+    {
+      x = pX[n];
+      y = pY[n];
+      z = pSrc[(2u * numVectors) + n];
+      pOutX[n] = (m00 * x) + (m01 * y) + (m02 * z);
+      pOutY[n] = (m10 * x) + (m11 * y) + (m12 * z);
+      pDst[(2u * numVectors) + n] = (m20 * x) + (m21 * y) + (m22 * z);
+    }
+    break;
+
+  case 4u:
+    m00 = pMat[0];
+    m01 = pMat[1];
+    m02 = pMat[2];
+    m03 = pMat[3];
+    m10 = pMat[4];
+    m11 = pMat[5];
+    m12 = pMat[6];
+    m13 = pMat[7];
+    m20 = pMat[8];
+    m21 = pMat[9];
+    m22 = pMat[10];
+    m23 = pMat[11];
+    m30 = pMat[12];
+    m31 = pMat[13];
+    m32 = pMat[14];
+    m33 = pMat[15];
+
+    for (n = 0u; n < numVectors; n++)
+    {
+      x = pX[n];
+      y = pY[n];
+      z = pSrc[(2u * numVectors) + n];
+      w = pSrc[(3u * numVectors) + n];
+      pOutX[n] = (m00 * x) + (m01 * y) + (m02 * z) + (m03 * w);
+      pOutY[n] = (m10 * x) + (m11 * y) + (m12 * z) + (m13 * w);
+      pDst[(2u * numVectors) + n] = (m20 * x) + (m21 * y) + (m22 * z) + (m23 * w);
+      pDst[(3u * numVectors) + n] = (m30 * x) + (m31 * y) + (m32 * z) + (m33 * w);
+    }
+    break;
+
+  default:
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixBatch group
+ */
@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_vec_mult_stream_q15.c
+*
+* Description:  Q15 matrix vector multiplication with the matrix streamed
+*               from flash or L2 through tiles in L1.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Streaming
+ * @{
+ */
+
+/**
+ * @brief  Q15 matrix vector multiplication with the matrix streamed through tiles in L1.
+ * @param[in]  *D         points to the DMA hook.
+ * @param[in]  *pSrcMat   points to the matrix of <code>numRows x numCols</code>, its data in flash or L2.
+ * @param[in]  *pVec      points to the vector of <code>numCols</code> elements, in L1.
+ * @param[out] *pDst      points to the output vector of <code>numRows</code> elements.
+ * @param[in]  tileRows   number of matrix rows per transfer, the last tile may be shorter.
+ * @param[in]  *pL1       points to RISCV_MAT_VEC_STREAM_L1_SIZE(tileRows, numCols) elements in L1.
+ * @return none.
+ *
+ * \par
+ * The matrix is read once, so for a large weight matrix the cost is the transfer of the matrix,
+ * not the multiplication.  Two tiles of <code>tileRows</code> rows are used in turn: the DMA fetches
+ * the rows of tile <code>t+1</code> while riscv_mat_vec_mult_q15() runs on tile <code>t</code>.  The
+ * rows are independent, so the result is the one of riscv_mat_vec_mult_q15() on the whole matrix.
+ */
+
+void riscv_mat_vec_mult_stream_q15(
+  const riscv_dma_instance * D,
+  const riscv_matrix_instance_q15 * pSrcMat,
+  q15_t * pVec,
+  q15_t * pDst,
+  uint16_t tileRows,
+  q15_t * pL1)
+{
+  RISCV_PROFILE(riscv_mat_vec_mult_stream_q15);
+  const q15_t *pIn = pSrcMat->pData;
+  uint32_t numRows = pSrcMat->numRows;
+  uint32_t numCols = pSrcMat->numCols;
+  uint32_t tileSize = (uint32_t) tileRows * numCols;
+  uint32_t numTiles = (numRows + tileRows - 1u) / tileRows;
+  q15_t *pTile[2];                               /* Tiles in L1 */
+  uint32_t id[2];                                /* Transfer identifiers */
+  riscv_matrix_instance_q15 tile;
+  uint32_t t, b, n;
+
+  if(numTiles == 0u)
+  {
+    return;
+  }
+
+  pTile[0] = pL1;
+  pTile[1] = pL1 + tileSize;
+
+  n = (numRows < tileRows) ? numRows : tileRows;
+  id[0] = D->start(D->ctx, pTile[0], pIn, n * numCols * sizeof(q15_t), 1u, 0u, 0u);
+
+  for (t = 0u; t < numTiles; t++)
+  {
+    b = t & 1u;
+    n = ((numRows - (t * tileRows)) < tileRows) ? (numRows - (t * tileRows)) : tileRows;
+
+    D->wait(D->ctx, id[b]);
+
+    /* Fetch the next rows while this tile is multiplied */
+    if((t + 1u) < numTiles)
+    {
+      uint32_t next = numRows - ((t + 1u) * tileRows);
+
+      next = (next < tileRows) ? next : tileRows;
+      id[b ^ 1u] = D->start(D->ctx, pTile[b ^ 1u], pIn + ((t + 1u) * tileSize),
+                            next * numCols * sizeof(q15_t), 1u, 0u, 0u);
+    }
+
+    riscv_mat_init_q15(&tile, (uint16_t) n, (uint16_t) numCols, pTile[b]);
+    riscv_mat_vec_mult_q15(&tile, pVec, pDst + (t * tileRows));
+  }
+}
+
+/**
+ * @} end of Streaming group
+ */
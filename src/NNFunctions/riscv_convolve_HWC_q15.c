@@ -0,0 +1,245 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_convolve_HWC_q15.c
+*
+* Description:  Q15 convolution layer on HWC images, im2col and packed
+*               dot products with fused requantization.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+* Copies the receptive field of output pixel (ox, oy) to pCol in the order of the weights,
+* zeros for the padding.
+*/
+
+static void riscv_nn_im2col_q15(
+  const q15_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  uint32_t ox,
+  uint32_t oy,
+  q15_t * pCol)
+{
+  int32_t ix, iy;
+  uint32_t kx, ky;
+
+  for (ky = 0u; ky < dim_kernel; ky++)
+  {
+    iy = (int32_t) ((oy * stride) + ky) - (int32_t) padding;
+    for (kx = 0u; kx < dim_kernel; kx++)
+    {
+      ix = (int32_t) ((ox * stride) + kx) - (int32_t) padding;
+      if((iy < 0) || (iy >= (int32_t) dim_im_in) || (ix < 0) || (ix >= (int32_t) dim_im_in))
+      {
+        memset(pCol, 0, ch_im_in * sizeof(q15_t));
+      }
+      else
+      {
+        memcpy(pCol, Im_in + ((((uint32_t) iy * dim_im_in) + (uint32_t) ix) * ch_im_in), ch_im_in * sizeof(q15_t));
+      }
+      pCol += ch_im_in;
+    }
+  }
+}
+
+/*
+* Output channels of two pixels from their columns pCol0 and pCol0 + colLen, two filters at a time.
+*/
+
+static void riscv_nn_mat_mult_kernel_q15(
+  const q15_t * pWt,
+  const q15_t * pCol0,
+  uint16_t ch_im_out,
+  uint32_t colLen,
+  uint16_t bias_shift,
+  uint16_t out_shift,
+  const q15_t * bias,
+  q15_t * pOut0)
+{
+  const q15_t *pCol1 = pCol0 + colLen;           /* Column of the second pixel */
+  q15_t *pOut1 = pOut0 + ch_im_out;              /* Outputs of the second pixel */
+  const q15_t *pA0, *pA1, *pB0, *pB1;            /* Filter and column pointers */
+  q31_t sum00, sum01, sum10, sum11;              /* Accumulators, filter then pixel */
+  q31_t a0, a1, b0, b1;                          /* Weights and inputs */
+  uint32_t ch = 0u, colCnt;                      /* loop counters */
+#if defined (USE_DSP_RISCV)
+  shortV a0V, a1V, b0V, b1V;                      /* Two weights and inputs */
+#endif
+
+  /* Two filters at a time */
+  for (; (ch + 2u) <= ch_im_out; ch += 2u)
+  {
+    pA0 = pWt + (ch * colLen);
+    pA1 = pA0 + colLen;
+    pB0 = pCol0;
+    pB1 = pCol1;
+    sum00 = ((q31_t) bias[ch] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    sum01 = sum00;
+    sum10 = ((q31_t) bias[ch + 1u] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    sum11 = sum10;
+    colCnt = colLen;
+
+#if defined (USE_DSP_RISCV)
+
+    for (; colCnt >= 2u; colCnt -= 2u)
+    {
+      a0V = *(shortV *) pA0;
+      a1V = *(shortV *) pA1;
+      b0V = *(shortV *) pB0;
+      b1V = *(shortV *) pB1;
+      sum00 = sumdotpv2(a0V, b0V, sum00);
+      sum01 = sumdotpv2(a0V, b1V, sum01);
+      sum10 = sumdotpv2(a1V, b0V, sum10);
+      sum11 = sumdotpv2(a1V, b1V, sum11);
+      pA0 += 2;
+      pA1 += 2;
+      pB0 += 2;
+      pB1 += 2;
+    }
+
+#endif
+
+    for (; colCnt > 0u; colCnt--)
+    {
+      a0 = *pA0++;
+      a1 = *pA1++;
+      b0 = *pB0++;
+      b1 = *pB1++;
+      sum00 += a0 * b0;
+      sum01 += a0 * b1;
+      sum10 += a1 * b0;
+      sum11 += a1 * b1;
+    }
+
+    pOut0[ch] = (q15_t) __SSAT((sum00 >> out_shift), 16);
+    pOut1[ch] = (q15_t) __SSAT((sum01 >> out_shift), 16);
+    pOut0[ch + 1u] = (q15_t) __SSAT((sum10 >> out_shift), 16);
+    pOut1[ch + 1u] = (q15_t) __SSAT((sum11 >> out_shift), 16);
+  }
+
+  /* Odd number of filters */
+  if(ch < ch_im_out)
+  {
+    pA0 = pWt + (ch * colLen);
+    pB0 = pCol0;
+    pB1 = pCol1;
+    sum00 = ((q31_t) bias[ch] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    sum01 = sum00;
+    colCnt = colLen;
+
+#if defined (USE_DSP_RISCV)
+
+    for (; colCnt >= 2u; colCnt -= 2u)
+    {
+      a0V = *(shortV *) pA0;
+      sum00 = sumdotpv2(a0V, *(shortV *) pB0, sum00);
+      sum01 = sumdotpv2(a0V, *(shortV *) pB1, sum01);
+      pA0 += 2;
+      pB0 += 2;
+      pB1 += 2;
+    }
+
+#endif
+
+    for (; colCnt > 0u; colCnt--)
+    {
+      a0 = *pA0++;
+      sum00 += a0 * *pB0++;
+      sum01 += a0 * *pB1++;
+    }
+
+    pOut0[ch] = (q15_t) __SSAT((sum00 >> out_shift), 16);
+    pOut1[ch] = (q15_t) __SSAT((sum01 >> out_shift), 16);
+  }
+}
+
+/**
+ * @brief Q15 convolution layer on HWC images.
+ * @param[in]       *Im_in        points to the input image, <code>dim_im_in * dim_im_in * ch_im_in</code> elements.
+ * @param[in]       dim_im_in     width and height of the input image.
+ * @param[in]       ch_im_in      number of input channels.
+ * @param[in]       *wt           points to the weights, <code>ch_im_out * dim_kernel * dim_kernel * ch_im_in</code> elements.
+ * @param[in]       ch_im_out     number of output channels, filters.
+ * @param[in]       dim_kernel    width and height of the filters.
+ * @param[in]       padding       zero padding on every side of the input image.
+ * @param[in]       stride        distance between the receptive fields of neighboring output pixels.
+ * @param[in]       *bias         points to the <code>ch_im_out</code> biases.
+ * @param[in]       bias_shift    left shift of the bias before the accumulation.
+ * @param[in]       out_shift     right shift of the accumulator to the output format.
+ * @param[out]      *Im_out       points to the output image, <code>dim_im_out * dim_im_out * ch_im_out</code> elements.
+ * @param[in]       dim_im_out    width and height of the output image.
+ * @param[in]       *bufferA      points to a buffer of <code>2 * ch_im_in * dim_kernel * dim_kernel</code> elements.
+ * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>stride</code> is 0.
+ */
+
+riscv_status riscv_convolve_HWC_q15(
+  const q15_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  const q15_t * wt,
+  uint16_t ch_im_out,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  const q15_t * bias,
+  uint16_t bias_shift,
+  uint16_t out_shift,
+  q15_t * Im_out,
+  uint16_t dim_im_out,
+  q15_t * bufferA)
+{
+  RISCV_PROFILE(riscv_convolve_HWC_q15);
+  uint32_t colLen = (uint32_t) ch_im_in * dim_kernel * dim_kernel;    /* Length of a column */
+  q15_t *pCol = bufferA;                                              /* Next column */
+  q15_t *pOut = Im_out;                                               /* Next output pixel */
+  uint32_t ox, oy;                                                    /* Output pixel */
+
+  if(stride == 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (oy = 0u; oy < dim_im_out; oy++)
+  {
+    for (ox = 0u; ox < dim_im_out; ox++)
+    {
+      riscv_nn_im2col_q15(Im_in, dim_im_in, ch_im_in, dim_kernel, padding, stride, ox, oy, pCol);
+      pCol += colLen;
+
+      /* Two columns are ready */
+      if(pCol == (bufferA + (2u * colLen)))
+      {
+        riscv_nn_mat_mult_kernel_q15(wt, bufferA, ch_im_out, colLen, bias_shift, out_shift, bias, pOut);
+        pOut += 2u * ch_im_out;
+        pCol = bufferA;
+      }
+    }
+  }
+
+  /* Last column of an odd number of output pixels */
+  if(pCol != bufferA)
+  {
+    riscv_fully_connected_q15(bufferA, wt, (uint16_t) colLen, ch_im_out, bias_shift, out_shift, bias, pOut);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,269 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_convolve_HWC_q7.c
+*
+* Description:  Q7 convolution layer on HWC images, im2col and packed
+*               dot products with fused requantization.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @defgroup NNConv Convolution Layers
+ *
+ * Square convolution layers on square images stored in HWC order: pixel by pixel, row by row,
+ * with the channels of a pixel next to each other.  An output pixel (ox, oy) reads the input
+ * pixels (ox * stride - padding + kx, oy * stride - padding + ky) for kx, ky in
+ * [0, dim_kernel), pixels outside the image read as zero.
+ *
+ * \par
+ * riscv_convolve_HWC_q7() and riscv_convolve_HWC_q15() copy the receptive fields of two output
+ * pixels to <code>bufferA</code> (im2col) and multiply them with two filters at a time, so that
+ * every weight and every input loaded serves two products.  Their weights are ordered
+ * [ch_im_out][dim_kernel][dim_kernel][ch_im_in].
+ *
+ * \par
+ * riscv_depthwise_separable_conv_HWC_q7() and riscv_depthwise_separable_conv_HWC_q15() are the
+ * depthwise part of a depthwise separable convolution: output channel c only reads input
+ * channel c, with the weights ordered [dim_kernel][dim_kernel][ch_im_in].  The pointwise part
+ * is a 1x1 riscv_convolve_HWC_q7() or riscv_convolve_HWC_q15().
+ *
+ * \par
+ * The outputs are requantized as the fully-connected layer, see \ref NNFC.
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/*
+* Copies the receptive field of output pixel (ox, oy) to pCol in the order of the weights,
+* zeros for the padding.
+*/
+
+static void riscv_nn_im2col_q7(
+  const q7_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  uint32_t ox,
+  uint32_t oy,
+  q7_t * pCol)
+{
+  int32_t ix, iy;
+  uint32_t kx, ky;
+
+  for (ky = 0u; ky < dim_kernel; ky++)
+  {
+    iy = (int32_t) ((oy * stride) + ky) - (int32_t) padding;
+    for (kx = 0u; kx < dim_kernel; kx++)
+    {
+      ix = (int32_t) ((ox * stride) + kx) - (int32_t) padding;
+      if((iy < 0) || (iy >= (int32_t) dim_im_in) || (ix < 0) || (ix >= (int32_t) dim_im_in))
+      {
+        memset(pCol, 0, ch_im_in * sizeof(q7_t));
+      }
+      else
+      {
+        memcpy(pCol, Im_in + ((((uint32_t) iy * dim_im_in) + (uint32_t) ix) * ch_im_in), ch_im_in * sizeof(q7_t));
+      }
+      pCol += ch_im_in;
+    }
+  }
+}
+
+/*
+* Output channels of two pixels from their columns pCol0 and pCol0 + colLen, two filters at a time.
+*/
+
+static void riscv_nn_mat_mult_kernel_q7(
+  const q7_t * pWt,
+  const q7_t * pCol0,
+  uint16_t ch_im_out,
+  uint32_t colLen,
+  uint16_t bias_shift,
+  uint16_t out_shift,
+  const q7_t * bias,
+  q7_t * pOut0)
+{
+  const q7_t *pCol1 = pCol0 + colLen;            /* Column of the second pixel */
+  q7_t *pOut1 = pOut0 + ch_im_out;               /* Outputs of the second pixel */
+  const q7_t *pA0, *pA1, *pB0, *pB1;             /* Filter and column pointers */
+  q31_t sum00, sum01, sum10, sum11;              /* Accumulators, filter then pixel */
+  q31_t a0, a1, b0, b1;                          /* Weights and inputs */
+  uint32_t ch = 0u, colCnt;                      /* loop counters */
+#if defined (USE_DSP_RISCV)
+  charV a0V, a1V, b0V, b1V;                      /* Four weights and inputs */
+#endif
+
+  /* Two filters at a time */
+  for (; (ch + 2u) <= ch_im_out; ch += 2u)
+  {
+    pA0 = pWt + (ch * colLen);
+    pA1 = pA0 + colLen;
+    pB0 = pCol0;
+    pB1 = pCol1;
+    sum00 = ((q31_t) bias[ch] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    sum01 = sum00;
+    sum10 = ((q31_t) bias[ch + 1u] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    sum11 = sum10;
+    colCnt = colLen;
+
+#if defined (USE_DSP_RISCV)
+
+    for (; colCnt >= 4u; colCnt -= 4u)
+    {
+      a0V = *(charV *) pA0;
+      a1V = *(charV *) pA1;
+      b0V = *(charV *) pB0;
+      b1V = *(charV *) pB1;
+      sum00 = sumdotpv4(a0V, b0V, sum00);
+      sum01 = sumdotpv4(a0V, b1V, sum01);
+      sum10 = sumdotpv4(a1V, b0V, sum10);
+      sum11 = sumdotpv4(a1V, b1V, sum11);
+      pA0 += 4;
+      pA1 += 4;
+      pB0 += 4;
+      pB1 += 4;
+    }
+
+#endif
+
+    for (; colCnt > 0u; colCnt--)
+    {
+      a0 = *pA0++;
+      a1 = *pA1++;
+      b0 = *pB0++;
+      b1 = *pB1++;
+      sum00 += a0 * b0;
+      sum01 += a0 * b1;
+      sum10 += a1 * b0;
+      sum11 += a1 * b1;
+    }
+
+    pOut0[ch] = (q7_t) __SSAT((sum00 >> out_shift), 8);
+    pOut1[ch] = (q7_t) __SSAT((sum01 >> out_shift), 8);
+    pOut0[ch + 1u] = (q7_t) __SSAT((sum10 >> out_shift), 8);
+    pOut1[ch + 1u] = (q7_t) __SSAT((sum11 >> out_shift), 8);
+  }
+
+  /* Odd number of filters */
+  if(ch < ch_im_out)
+  {
+    pA0 = pWt + (ch * colLen);
+    pB0 = pCol0;
+    pB1 = pCol1;
+    sum00 = ((q31_t) bias[ch] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    sum01 = sum00;
+    colCnt = colLen;
+
+#if defined (USE_DSP_RISCV)
+
+    for (; colCnt >= 4u; colCnt -= 4u)
+    {
+      a0V = *(charV *) pA0;
+      sum00 = sumdotpv4(a0V, *(charV *) pB0, sum00);
+      sum01 = sumdotpv4(a0V, *(charV *) pB1, sum01);
+      pA0 += 4;
+      pB0 += 4;
+      pB1 += 4;
+    }
+
+#endif
+
+    for (; colCnt > 0u; colCnt--)
+    {
+      a0 = *pA0++;
+      sum00 += a0 * *pB0++;
+      sum01 += a0 * *pB1++;
+    }
+
+    pOut0[ch] = (q7_t) __SSAT((sum00 >> out_shift), 8);
+    pOut1[ch] = (q7_t) __SSAT((sum01 >> out_shift), 8);
+  }
+}
+
+/**
+ * @brief Q7 convolution layer on HWC images.
+ * @param[in]       *Im_in        points to the input image, <code>dim_im_in * dim_im_in * ch_im_in</code> elements.
+ * @param[in]       dim_im_in     width and height of the input image.
+ * @param[in]       ch_im_in      number of input channels.
+ * @param[in]       *wt           points to the weights, <code>ch_im_out * dim_kernel * dim_kernel * ch_im_in</code> elements.
+ * @param[in]       ch_im_out     number of output channels, filters.
+ * @param[in]       dim_kernel    width and height of the filters.
+ * @param[in]       padding       zero padding on every side of the input image.
+ * @param[in]       stride        distance between the receptive fields of neighboring output pixels.
+ * @param[in]       *bias         points to the <code>ch_im_out</code> biases.
+ * @param[in]       bias_shift    left shift of the bias before the accumulation.
+ * @param[in]       out_shift     right shift of the accumulator to the output format.
+ * @param[out]      *Im_out       points to the output image, <code>dim_im_out * dim_im_out * ch_im_out</code> elements.
+ * @param[in]       dim_im_out    width and height of the output image.
+ * @param[in]       *bufferA      points to a buffer of <code>2 * ch_im_in * dim_kernel * dim_kernel</code> elements.
+ * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>stride</code> is 0.
+ */
+
+riscv_status riscv_convolve_HWC_q7(
+  const q7_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  const q7_t * wt,
+  uint16_t ch_im_out,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  const q7_t * bias,
+  uint16_t bias_shift,
+  uint16_t out_shift,
+  q7_t * Im_out,
+  uint16_t dim_im_out,
+  q7_t * bufferA)
+{
+  RISCV_PROFILE(riscv_convolve_HWC_q7);
+  uint32_t colLen = (uint32_t) ch_im_in * dim_kernel * dim_kernel;    /* Length of a column */
+  q7_t *pCol = bufferA;                                               /* Next column */
+  q7_t *pOut = Im_out;                                                /* Next output pixel */
+  uint32_t ox, oy;                                                    /* Output pixel */
+
+  if(stride == 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (oy = 0u; oy < dim_im_out; oy++)
+  {
+    for (ox = 0u; ox < dim_im_out; ox++)
+    {
+      riscv_nn_im2col_q7(Im_in, dim_im_in, ch_im_in, dim_kernel, padding, stride, ox, oy, pCol);
+      pCol += colLen;
+
+      /* Two columns are ready */
+      if(pCol == (bufferA + (2u * colLen)))
+      {
+        riscv_nn_mat_mult_kernel_q7(wt, bufferA, ch_im_out, colLen, bias_shift, out_shift, bias, pOut);
+        pOut += 2u * ch_im_out;
+        pCol = bufferA;
+      }
+    }
+  }
+
+  /* Last column of an odd number of output pixels */
+  if(pCol != bufferA)
+  {
+    riscv_fully_connected_q7(bufferA, wt, (uint16_t) colLen, ch_im_out, bias_shift, out_shift, bias, pOut);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_depthwise_separable_conv_HWC_q15.c
+*
+* Description:  Q15 depthwise convolution layer on HWC images with fused
+*               requantization.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/**
+ * @brief Q15 depthwise convolution layer on HWC images.
+ * @param[in]       *Im_in        points to the input image, <code>dim_im_in * dim_im_in * ch_im_in</code> elements.
+ * @param[in]       dim_im_in     width and height of the input image.
+ * @param[in]       ch_im_in      number of input channels.
+ * @param[in]       *wt           points to the weights, <code>dim_kernel * dim_kernel * ch_im_in</code> elements.
+ * @param[in]       ch_im_out     number of output channels, equal to <code>ch_im_in</code>.
+ * @param[in]       dim_kernel    width and height of the filters.
+ * @param[in]       padding       zero padding on every side of the input image.
+ * @param[in]       stride        distance between the receptive fields of neighboring output pixels.
+ * @param[in]       *bias         points to the <code>ch_im_out</code> biases.
+ * @param[in]       bias_shift    left shift of the bias before the accumulation.
+ * @param[in]       out_shift     right shift of the accumulator to the output format.
+ * @param[out]      *Im_out       points to the output image, <code>dim_im_out * dim_im_out * ch_im_out</code> elements.
+ * @param[in]       dim_im_out    width and height of the output image.
+ * @param[in]       *bufferA      unused, for the signature of riscv_convolve_HWC_q15().
+ * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>ch_im_in</code> and
+ * <code>ch_im_out</code> differ or <code>stride</code> is 0.
+ *
+ * \par
+ * Every product belongs to a different output channel, which the packed dot products cannot
+ * sum separately, so both builds run the same loop: four channels per pass, which load their
+ * inputs and weights as neighbors, and padding pixels skipped instead of multiplied by zero.
+ */
+
+riscv_status riscv_depthwise_separable_conv_HWC_q15(
+  const q15_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  const q15_t * wt,
+  uint16_t ch_im_out,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  const q15_t * bias,
+  uint16_t bias_shift,
+  uint16_t out_shift,
+  q15_t * Im_out,
+  uint16_t dim_im_out,
+  q15_t * bufferA)
+{
+  RISCV_PROFILE(riscv_depthwise_separable_conv_HWC_q15);
+  const q15_t *pIn, *pW;                         /* Input pixel and weight pointers */
+  q15_t *pOut = Im_out;                          /* Next output pixel */
+  q31_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  int32_t ix, iy;                                /* Input pixel */
+  uint32_t ox, oy, kx, ky, ch;                   /* loop counters */
+
+  (void) bufferA;
+
+  if((ch_im_in != ch_im_out) || (stride == 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (oy = 0u; oy < dim_im_out; oy++)
+  {
+    for (ox = 0u; ox < dim_im_out; ox++)
+    {
+      /* Four channels at a time */
+      for (ch = 0u; (ch + 4u) <= ch_im_in; ch += 4u)
+      {
+        acc0 = ((q31_t) bias[ch] << bias_shift) + RISCV_NN_ROUND(out_shift);
+        acc1 = ((q31_t) bias[ch + 1u] << bias_shift) + RISCV_NN_ROUND(out_shift);
+        acc2 = ((q31_t) bias[ch + 2u] << bias_shift) + RISCV_NN_ROUND(out_shift);
+        acc3 = ((q31_t) bias[ch + 3u] << bias_shift) + RISCV_NN_ROUND(out_shift);
+
+        for (ky = 0u; ky < dim_kernel; ky++)
+        {
+          iy = (int32_t) ((oy * stride) + ky) - (int32_t) padding;
+          if((iy < 0) || (iy >= (int32_t) dim_im_in))
+          {
+            continue;
+          }
+          for (kx = 0u; kx < dim_kernel; kx++)
+          {
+            ix = (int32_t) ((ox * stride) + kx) - (int32_t) padding;
+            if((ix < 0) || (ix >= (int32_t) dim_im_in))
+            {
+              continue;
+            }
+            pIn = Im_in + ((((uint32_t) iy * dim_im_in) + (uint32_t) ix) * ch_im_in) + ch;
+            pW = wt + (((ky * dim_kernel) + kx) * ch_im_in) + ch;
+            acc0 += pIn[0] * pW[0];
+            acc1 += pIn[1] * pW[1];
+            acc2 += pIn[2] * pW[2];
+            acc3 += pIn[3] * pW[3];
+          }
+        }
+
+        pOut[ch] = (q15_t) __SSAT((acc0 >> out_shift), 16);
+        pOut[ch + 1u] = (q15_t) __SSAT((acc1 >> out_shift), 16);
+        pOut[ch + 2u] = (q15_t) __SSAT((acc2 >> out_shift), 16);
+        pOut[ch + 3u] = (q15_t) __SSAT((acc3 >> out_shift), 16);
+      }
+
+      /* Remaining channels */
+      for (; ch < ch_im_in; ch++)
+      {
+        acc0 = ((q31_t) bias[ch] << bias_shift) + RISCV_NN_ROUND(out_shift);
+
+        for (ky = 0u; ky < dim_kernel; ky++)
+        {
+          iy = (int32_t) ((oy * stride) + ky) - (int32_t) padding;
+          if((iy < 0) || (iy >= (int32_t) dim_im_in))
+          {
+            continue;
+          }
+          for (kx = 0u; kx < dim_kernel; kx++)
+          {
+            ix = (int32_t) ((ox * stride) + kx) - (int32_t) padding;
+            if((ix < 0) || (ix >= (int32_t) dim_im_in))
+            {
+              continue;
+            }
+            acc0 += Im_in[((((uint32_t) iy * dim_im_in) + (uint32_t) ix) * ch_im_in) + ch] *
+                    wt[(((ky * dim_kernel) + kx) * ch_im_in) + ch];
+          }
+        }
+
+        pOut[ch] = (q15_t) __SSAT((acc0 >> out_shift), 16);
+      }
+
+      pOut += ch_im_out;
+    }
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fully_connected_q15.c
+*
+* Description:  Q15 fully-connected layer with fused requantization.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNFC
+ * @{
+ */
+
+/**
+ * @brief Q15 fully-connected layer.
+ * @param[in]       *pV           points to the input vector of <code>dim_vec</code> elements.
+ * @param[in]       *pM           points to the weights, <code>num_of_rows</code> rows of <code>dim_vec</code> elements.
+ * @param[in]       dim_vec       length of the input vector.
+ * @param[in]       num_of_rows   number of rows of the weights and of outputs.
+ * @param[in]       bias_shift    left shift of the bias before the accumulation.
+ * @param[in]       out_shift     right shift of the accumulator to the output format.
+ * @param[in]       *bias         points to the <code>num_of_rows</code> biases.
+ * @param[out]      *pOut         points to the output vector of <code>num_of_rows</code> elements.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are 2.30 and the accumulator is 32 bits, as in CMSIS-NN: the weights and inputs
+ * of a layer must be scaled so that every partial sum stays within 32 bits.
+ */
+
+void riscv_fully_connected_q15(
+  const q15_t * pV,
+  const q15_t * pM,
+  uint16_t dim_vec,
+  uint16_t num_of_rows,
+  uint16_t bias_shift,
+  uint16_t out_shift,
+  const q15_t * bias,
+  q15_t * pOut)
+{
+  RISCV_PROFILE(riscv_fully_connected_q15);
+  const q15_t *pA0, *pA1, *pA2, *pA3;            /* Row pointers */
+  const q15_t *px;                               /* Input vector pointer */
+  q31_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  q31_t x;                                       /* Input element */
+  uint32_t row = 0u, colCnt;                     /* loop counters */
+#if defined (USE_DSP_RISCV)
+  shortV xV;                                     /* Two input elements */
+#endif
+
+  /* Four rows at a time */
+  for (; (row + 4u) <= num_of_rows; row += 4u)
+  {
+    pA0 = pM + (row * dim_vec);
+    pA1 = pA0 + dim_vec;
+    pA2 = pA1 + dim_vec;
+    pA3 = pA2 + dim_vec;
+    px = pV;
+    acc0 = ((q31_t) bias[row] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    acc1 = ((q31_t) bias[row + 1u] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    acc2 = ((q31_t) bias[row + 2u] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    acc3 = ((q31_t) bias[row + 3u] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    colCnt = dim_vec;
+
+#if defined (USE_DSP_RISCV)
+
+    /* Two inputs serve two weights of each of the four rows */
+    for (; colCnt >= 2u; colCnt -= 2u)
+    {
+      xV = *(shortV *) px;
+      px += 2;
+      acc0 = sumdotpv2(*(shortV *) pA0, xV, acc0);
+      acc1 = sumdotpv2(*(shortV *) pA1, xV, acc1);
+      acc2 = sumdotpv2(*(shortV *) pA2, xV, acc2);
+      acc3 = sumdotpv2(*(shortV *) pA3, xV, acc3);
+      pA0 += 2;
+      pA1 += 2;
+      pA2 += 2;
+      pA3 += 2;
+    }
+
+#endif
+
+    for (; colCnt > 0u; colCnt--)
+    {
+      x = *px++;
+      acc0 += *pA0++ * x;
+      acc1 += *pA1++ * x;
+      acc2 += *pA2++ * x;
+      acc3 += *pA3++ * x;
+    }
+
+    pOut[row] = (q15_t) __SSAT((acc0 >> out_shift), 16);
+    pOut[row + 1u] = (q15_t) __SSAT((acc1 >> out_shift), 16);
+    pOut[row + 2u] = (q15_t) __SSAT((acc2 >> out_shift), 16);
+    pOut[row + 3u] = (q15_t) __SSAT((acc3 >> out_shift), 16);
+  }
+
+  /* Remaining rows */
+  for (; row < num_of_rows; row++)
+  {
+    pA0 = pM + (row * dim_vec);
+    px = pV;
+    acc0 = ((q31_t) bias[row] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    colCnt = dim_vec;
+
+#if defined (USE_DSP_RISCV)
+
+    for (; colCnt >= 2u; colCnt -= 2u)
+    {
+      acc0 = sumdotpv2(*(shortV *) pA0, *(shortV *) px, acc0);
+      pA0 += 2;
+      px += 2;
+    }
+
+#endif
+
+    for (; colCnt > 0u; colCnt--)
+    {
+      acc0 += *pA0++ * *px++;
+    }
+
+    pOut[row] = (q15_t) __SSAT((acc0 >> out_shift), 16);
+  }
+}
+
+/**
+ * @} end of NNFC group
+ */
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fully_connected_q7.c
+*
+* Description:  Q7 fully-connected layer with fused requantization.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @defgroup NNFC Fully-connected Layer
+ *
+ * Computes <code>pOut = pM * pV + bias</code> for a weight matrix <code>pM</code> of
+ * <code>num_of_rows</code> rows of <code>dim_vec</code> weights, stored row by row.
+ *
+ * \par Requantization
+ * The products are accumulated in 32 bits, starting from <code>bias << bias_shift</code> plus
+ * half an output LSB (RISCV_NN_ROUND()); the sum is shifted right by <code>out_shift</code> and
+ * saturated to the output type.  The shifts follow from the fixed-point formats of the layer:
+ * with inputs in Qa, weights in Qb, bias in Qc and outputs in Qd,
+ * <code>bias_shift = a + b - c</code> and <code>out_shift = a + b - d</code>.
+ *
+ * \par
+ * With USE_DSP_RISCV four q7 weights, or two q15 weights, are multiplied and accumulated per
+ * instruction and four rows share every load of the input vector, instead of widening the q7
+ * data to q15 for riscv_mat_mult_fast_q15().
+ */
+
+/**
+ * @addtogroup NNFC
+ * @{
+ */
+
+/**
+ * @brief Q7 fully-connected layer.
+ * @param[in]       *pV           points to the input vector of <code>dim_vec</code> elements.
+ * @param[in]       *pM           points to the weights, <code>num_of_rows</code> rows of <code>dim_vec</code> elements.
+ * @param[in]       dim_vec       length of the input vector.
+ * @param[in]       num_of_rows   number of rows of the weights and of outputs.
+ * @param[in]       bias_shift    left shift of the bias before the accumulation.
+ * @param[in]       out_shift     right shift of the accumulator to the output format.
+ * @param[in]       *bias         points to the <code>num_of_rows</code> biases.
+ * @param[out]      *pOut         points to the output vector of <code>num_of_rows</code> elements.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 32-bit accumulator does not overflow for <code>dim_vec</code> below 131072 with a bias
+ * term below 2^30.
+ */
+
+void riscv_fully_connected_q7(
+  const q7_t * pV,
+  const q7_t * pM,
+  uint16_t dim_vec,
+  uint16_t num_of_rows,
+  uint16_t bias_shift,
+  uint16_t out_shift,
+  const q7_t * bias,
+  q7_t * pOut)
+{
+  RISCV_PROFILE(riscv_fully_connected_q7);
+  const q7_t *pA0, *pA1, *pA2, *pA3;             /* Row pointers */
+  const q7_t *px;                                /* Input vector pointer */
+  q31_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  q31_t x;                                       /* Input element */
+  uint32_t row = 0u, colCnt;                     /* loop counters */
+#if defined (USE_DSP_RISCV)
+  charV xV;                                      /* Four input elements */
+#endif
+
+  /* Four rows at a time */
+  for (; (row + 4u) <= num_of_rows; row += 4u)
+  {
+    pA0 = pM + (row * dim_vec);
+    pA1 = pA0 + dim_vec;
+    pA2 = pA1 + dim_vec;
+    pA3 = pA2 + dim_vec;
+    px = pV;
+    acc0 = ((q31_t) bias[row] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    acc1 = ((q31_t) bias[row + 1u] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    acc2 = ((q31_t) bias[row + 2u] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    acc3 = ((q31_t) bias[row + 3u] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    colCnt = dim_vec;
+
+#if defined (USE_DSP_RISCV)
+
+    /* Four inputs serve four weights of each of the four rows */
+    for (; colCnt >= 4u; colCnt -= 4u)
+    {
+      xV = *(charV *) px;
+      px += 4;
+      acc0 = sumdotpv4(*(charV *) pA0, xV, acc0);
+      acc1 = sumdotpv4(*(charV *) pA1, xV, acc1);
+      acc2 = sumdotpv4(*(charV *) pA2, xV, acc2);
+      acc3 = sumdotpv4(*(charV *) pA3, xV, acc3);
+      pA0 += 4;
+      pA1 += 4;
+      pA2 += 4;
+      pA3 += 4;
+    }
+
+#endif
+
+    for (; colCnt > 0u; colCnt--)
+    {
+      x = *px++;
+      acc0 += *pA0++ * x;
+      acc1 += *pA1++ * x;
+      acc2 += *pA2++ * x;
+      acc3 += *pA3++ * x;
+    }
+
+    pOut[row] = (q7_t) __SSAT((acc0 >> out_shift), 8);
+    pOut[row + 1u] = (q7_t) __SSAT((acc1 >> out_shift), 8);
+    pOut[row + 2u] = (q7_t) __SSAT((acc2 >> out_shift), 8);
+    pOut[row + 3u] = (q7_t) __SSAT((acc3 >> out_shift), 8);
+  }
+
+  /* Remaining rows */
+  for (; row < num_of_rows; row++)
+  {
+    pA0 = pM + (row * dim_vec);
+    px = pV;
+    acc0 = ((q31_t) bias[row] << bias_shift) + RISCV_NN_ROUND(out_shift);
+    colCnt = dim_vec;
+
+#if defined (USE_DSP_RISCV)
+
+    for (; colCnt >= 4u; colCnt -= 4u)
+    {
+      acc0 = sumdotpv4(*(charV *) pA0, *(charV *) px, acc0);
+      pA0 += 4;
+      px += 4;
+    }
+
+#endif
+
+    for (; colCnt > 0u; colCnt--)
+    {
+      acc0 += *pA0++ * *px++;
+    }
+
+    pOut[row] = (q7_t) __SSAT((acc0 >> out_shift), 8);
+  }
+}
+
+/**
+ * @} end of NNFC group
+ */
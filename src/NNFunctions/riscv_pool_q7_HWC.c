@@ -0,0 +1,185 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_pool_q7_HWC.c
+*
+* Description:  Q7 max and average pooling layers on HWC images.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @defgroup NNPool Pooling Layers
+ *
+ * Max and average of every channel over square windows of <code>dim_kernel</code> pixels of a
+ * square HWC image, see \ref NNConv for the layout and the window positions.  Padding pixels
+ * are left out: they do not take part in the maximum nor count for the average.
+ *
+ * \par
+ * With USE_DSP_RISCV max pooling compares four q7 channels, or two q15 channels, per
+ * instruction.
+ */
+
+/**
+ * @addtogroup NNPool
+ * @{
+ */
+
+/**
+ * @brief Q7 max pooling layer on HWC images.
+ * @param[in]       *Im_in        points to the input image, <code>dim_im_in * dim_im_in * ch_im_in</code> elements.
+ * @param[in]       dim_im_in     width and height of the input image.
+ * @param[in]       ch_im_in      number of channels.
+ * @param[in]       dim_kernel    width and height of the windows.
+ * @param[in]       padding       padding on every side of the input image.
+ * @param[in]       stride        distance between neighboring windows.
+ * @param[in]       dim_im_out    width and height of the output image.
+ * @param[out]      *Im_out       points to the output image, <code>dim_im_out * dim_im_out * ch_im_in</code> elements.
+ * @return none.
+ */
+
+void riscv_maxpool_q7_HWC(
+  const q7_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  uint16_t dim_im_out,
+  q7_t * Im_out)
+{
+  RISCV_PROFILE(riscv_maxpool_q7_HWC);
+  const q7_t *pIn;                               /* Input pixel pointer */
+  q7_t *pOut = Im_out;                           /* Output pixel pointer */
+  int32_t ix, iy;                                /* Input pixel */
+  uint32_t ox, oy, kx, ky, chCnt;                /* loop counters */
+  q7_t *pMax;                                    /* Running maxima */
+
+  for (oy = 0u; oy < dim_im_out; oy++)
+  {
+    for (ox = 0u; ox < dim_im_out; ox++)
+    {
+      memset(pOut, 0x80, ch_im_in * sizeof(q7_t));
+
+      for (ky = 0u; ky < dim_kernel; ky++)
+      {
+        iy = (int32_t) ((oy * stride) + ky) - (int32_t) padding;
+        if((iy < 0) || (iy >= (int32_t) dim_im_in))
+        {
+          continue;
+        }
+        for (kx = 0u; kx < dim_kernel; kx++)
+        {
+          ix = (int32_t) ((ox * stride) + kx) - (int32_t) padding;
+          if((ix < 0) || (ix >= (int32_t) dim_im_in))
+          {
+            continue;
+          }
+          pIn = Im_in + ((((uint32_t) iy * dim_im_in) + (uint32_t) ix) * ch_im_in);
+          pMax = pOut;
+          chCnt = ch_im_in;
+
+#if defined (USE_DSP_RISCV)
+
+          for (; chCnt >= 4u; chCnt -= 4u)
+          {
+            *(charV *) pMax = max4(*(charV *) pMax, *(charV *) pIn);
+            pMax += 4;
+            pIn += 4;
+          }
+
+#endif
+
+          for (; chCnt > 0u; chCnt--)
+          {
+            if(*pIn > *pMax)
+            {
+              *pMax = *pIn;
+            }
+            pMax++;
+            pIn++;
+          }
+        }
+      }
+
+      pOut += ch_im_in;
+    }
+  }
+}
+
+/**
+ * @brief Q7 average pooling layer on HWC images.
+ * @param[in]       *Im_in        points to the input image, <code>dim_im_in * dim_im_in * ch_im_in</code> elements.
+ * @param[in]       dim_im_in     width and height of the input image.
+ * @param[in]       ch_im_in      number of channels.
+ * @param[in]       dim_kernel    width and height of the windows.
+ * @param[in]       padding       padding on every side of the input image.
+ * @param[in]       stride        distance between neighboring windows.
+ * @param[in]       dim_im_out    width and height of the output image.
+ * @param[out]      *Im_out       points to the output image, <code>dim_im_out * dim_im_out * ch_im_in</code> elements.
+ * @return none.
+ *
+ * \par
+ * The sum of a window divided by its number of image pixels, rounded toward zero.
+ */
+
+void riscv_avepool_q7_HWC(
+  const q7_t * Im_in,
+  uint16_t dim_im_in,
+  uint16_t ch_im_in,
+  uint16_t dim_kernel,
+  uint16_t padding,
+  uint16_t stride,
+  uint16_t dim_im_out,
+  q7_t * Im_out)
+{
+  RISCV_PROFILE(riscv_avepool_q7_HWC);
+  const q7_t *pIn;                               /* Input pixel pointer */
+  q7_t *pOut = Im_out;                           /* Output pixel pointer */
+  int32_t ix, iy;                                /* Input pixel */
+  int32_t x0, x1, y0, y1;                        /* Window clipped to the image */
+  uint32_t ox, oy, x, y, ch;                     /* loop counters */
+  q31_t sum, count;                              /* Window sum and pixel count */
+
+  for (oy = 0u; oy < dim_im_out; oy++)
+  {
+    iy = (int32_t) (oy * stride) - (int32_t) padding;
+    y0 = (iy < 0) ? 0 : iy;
+    y1 = ((iy + (int32_t) dim_kernel) > (int32_t) dim_im_in) ? (int32_t) dim_im_in : (iy + (int32_t) dim_kernel);
+
+    for (ox = 0u; ox < dim_im_out; ox++)
+    {
+      ix = (int32_t) (ox * stride) - (int32_t) padding;
+      x0 = (ix < 0) ? 0 : ix;
+      x1 = ((ix + (int32_t) dim_kernel) > (int32_t) dim_im_in) ? (int32_t) dim_im_in : (ix + (int32_t) dim_kernel);
+      count = ((y1 > y0) && (x1 > x0)) ? ((y1 - y0) * (x1 - x0)) : 0;
+
+      for (ch = 0u; ch < ch_im_in; ch++)
+      {
+        sum = 0;
+        for (y = (uint32_t) y0; (int32_t) y < y1; y++)
+        {
+          pIn = Im_in + (((y * dim_im_in) + (uint32_t) x0) * ch_im_in) + ch;
+          for (x = (uint32_t) x0; (int32_t) x < x1; x++)
+          {
+            sum += *pIn;
+            pIn += ch_im_in;
+          }
+        }
+
+        pOut[ch] = (count > 0) ? (q7_t) (sum / count) : 0;
+      }
+
+      pOut += ch_im_in;
+    }
+  }
+}
+
+/**
+ * @} end of NNPool group
+ */
@@ -0,0 +1,58 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_relu_q15.c
+*
+* Description:  Q15 rectified linear unit, in place.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNAct
+ * @{
+ */
+
+/**
+ * @brief Q15 ReLU, in place.
+ * @param[in,out]   *data         points to the vector.
+ * @param[in]       size          number of elements.
+ * @return none.
+ */
+
+void riscv_relu_q15(
+  q15_t * data,
+  uint16_t size)
+{
+  RISCV_PROFILE(riscv_relu_q15);
+  q15_t *pIn = data;                             /* Vector pointer */
+  uint32_t blkCnt = size;                        /* loop counter */
+#if defined (USE_DSP_RISCV)
+  shortV zero = { 0, 0 };
+
+  for (; blkCnt >= 2u; blkCnt -= 2u)
+  {
+    *(shortV *) pIn = max2(*(shortV *) pIn, zero);
+    pIn += 2;
+  }
+
+#endif
+
+  for (; blkCnt > 0u; blkCnt--)
+  {
+    if(*pIn < 0)
+    {
+      *pIn = 0;
+    }
+    pIn++;
+  }
+}
+
+/**
+ * @} end of NNAct group
+ */
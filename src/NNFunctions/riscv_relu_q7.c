@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_relu_q7.c
+*
+* Description:  Q7 rectified linear unit, in place.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @defgroup NNAct Activation Functions
+ *
+ * riscv_relu_q7() and riscv_relu_q15() replace the negative elements of a vector by zero, in
+ * place; with USE_DSP_RISCV four q7 or two q15 elements per instruction.
+ *
+ * \par
+ * riscv_softmax_q7() and riscv_softmax_q15() approximate softmax with powers of two instead of
+ * e, as CMSIS-NN: <code>p_out[n] = 2^vec_in[n] / sum(2^vec_in[k])</code> with the inputs
+ * taken as integers.  Only the inputs within 8 (q7) or 16 (q15) of the largest one take part,
+ * the smaller ones contribute less than an output LSB and give 0.  The outputs are Q7 or Q15
+ * probabilities, saturated so that a single dominant input gives 127 or 32767.
+ */
+
+/**
+ * @addtogroup NNAct
+ * @{
+ */
+
+/**
+ * @brief Q7 ReLU, in place.
+ * @param[in,out]   *data         points to the vector.
+ * @param[in]       size          number of elements.
+ * @return none.
+ */
+
+void riscv_relu_q7(
+  q7_t * data,
+  uint16_t size)
+{
+  RISCV_PROFILE(riscv_relu_q7);
+  q7_t *pIn = data;                              /* Vector pointer */
+  uint32_t blkCnt = size;                        /* loop counter */
+#if defined (USE_DSP_RISCV)
+  charV zero = { 0, 0, 0, 0 };
+
+  for (; blkCnt >= 4u; blkCnt -= 4u)
+  {
+    *(charV *) pIn = max4(*(charV *) pIn, zero);
+    pIn += 4;
+  }
+
+#endif
+
+  for (; blkCnt > 0u; blkCnt--)
+  {
+    if(*pIn < 0)
+    {
+      *pIn = 0;
+    }
+    pIn++;
+  }
+}
+
+/**
+ * @} end of NNAct group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_softmax_q15.c
+*
+* Description:  Q15 softmax with powers of two.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNAct
+ * @{
+ */
+
+/**
+ * @brief Q15 softmax with powers of two.
+ * @param[in]       *vec_in       points to the input vector.
+ * @param[in]       dim_vec       number of elements.
+ * @param[out]      *p_out        points to the Q15 probabilities, <code>dim_vec</code> elements.
+ * @return none.
+ *
+ * \par
+ * One division per call: the outputs are the powers of two scaled by the reciprocal of their sum.
+ */
+
+void riscv_softmax_q15(
+  const q15_t * vec_in,
+  uint16_t dim_vec,
+  q15_t * p_out)
+{
+  RISCV_PROFILE(riscv_softmax_q15);
+  int32_t max = -32768, base, shift;             /* Largest input and the exponent base */
+  uint32_t sum = 0u, recip, out;                 /* Sum of the powers and its reciprocal */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < dim_vec; i++)
+  {
+    if(vec_in[i] > max)
+    {
+      max = vec_in[i];
+    }
+  }
+
+  /* 2^(x - base) for the inputs above base, at most 2^16 */
+  base = max - 16;
+  for (i = 0u; i < dim_vec; i++)
+  {
+    if(vec_in[i] > base)
+    {
+      sum += 1u << (uint32_t) (vec_in[i] - base);
+    }
+  }
+
+  /* sum >= 65536, so recip << shift stays within 2^31 */
+  recip = (sum != 0u) ? (0x80000000u / sum) : 0u;
+
+  for (i = 0u; i < dim_vec; i++)
+  {
+    shift = vec_in[i] - base;
+    if(shift > 0)
+    {
+      out = (recip << (uint32_t) shift) >> 16u;
+      p_out[i] = (q15_t) ((out > 32767u) ? 32767u : out);
+    }
+    else
+    {
+      p_out[i] = 0;
+    }
+  }
+}
+
+/**
+ * @} end of NNAct group
+ */
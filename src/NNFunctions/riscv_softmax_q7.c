@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_softmax_q7.c
+*
+* Description:  Q7 softmax with powers of two.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNAct
+ * @{
+ */
+
+/**
+ * @brief Q7 softmax with powers of two.
+ * @param[in]       *vec_in       points to the input vector.
+ * @param[in]       dim_vec       number of elements.
+ * @param[out]      *p_out        points to the Q7 probabilities, <code>dim_vec</code> elements.
+ * @return none.
+ *
+ * \par
+ * One division per call: the outputs are the powers of two scaled by the reciprocal of their sum.
+ */
+
+void riscv_softmax_q7(
+  const q7_t * vec_in,
+  uint16_t dim_vec,
+  q7_t * p_out)
+{
+  RISCV_PROFILE(riscv_softmax_q7);
+  int32_t max = -128, base, shift;               /* Largest input and the exponent base */
+  uint32_t sum = 0u, recip, out;                 /* Sum of the powers and its reciprocal */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < dim_vec; i++)
+  {
+    if(vec_in[i] > max)
+    {
+      max = vec_in[i];
+    }
+  }
+
+  /* 2^(x - base) for the inputs above base, at most 2^8 */
+  base = max - 8;
+  for (i = 0u; i < dim_vec; i++)
+  {
+    if(vec_in[i] > base)
+    {
+      sum += 1u << (uint32_t) (vec_in[i] - base);
+    }
+  }
+
+  /* sum >= 256, so recip << shift stays within 2^31 */
+  recip = (sum != 0u) ? (0x80000000u / sum) : 0u;
+
+  for (i = 0u; i < dim_vec; i++)
+  {
+    shift = vec_in[i] - base;
+    if(shift > 0)
+    {
+      out = (recip << (uint32_t) shift) >> 24u;
+      p_out[i] = (q7_t) ((out > 127u) ? 127u : out);
+    }
+    else
+    {
+      p_out[i] = 0;
+    }
+  }
+}
+
+/**
+ * @} end of NNAct group
+ */
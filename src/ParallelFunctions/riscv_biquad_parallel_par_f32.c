@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_biquad_parallel_par_f32.c
+*
+* Description:  Floating-point parallel-form IIR filter forked across the cluster cores.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupParallel
+ */
+
+/**
+ * @addtogroup ParallelFilters
+ * @{
+ */
+
+typedef struct
+{
+  const riscv_biquad_parallel_instance_f32 *S;
+  const float32_t *pSrc;
+  float32_t *pDst;
+  float32_t *pScratch;
+  uint32_t blockSize;
+} riscv_biquad_parallel_par_args_f32;
+
+/*
+* @brief  Runs the sections of one core, core 0 into the output and the others into the scratch.
+*/
+
+static void riscv_biquad_parallel_par_worker_f32(
+  void * arg,
+  uint32_t coreId,
+  uint32_t numCores)
+{
+  const riscv_biquad_parallel_par_args_f32 *a = (const riscv_biquad_parallel_par_args_f32 *) arg;
+  float32_t *pOut;
+  uint32_t first, count;
+
+  riscv_par_split(a->S->numStages, 4u, coreId, numCores, &first, &count);
+
+  if(coreId == 0u)
+  {
+    pOut = a->pDst;
+    riscv_scale_f32((float32_t *) a->pSrc, a->S->direct, pOut, a->blockSize);
+  }
+  else
+  {
+    pOut = a->pScratch + ((coreId - 1u) * a->blockSize);
+    riscv_fill_f32(0.0f, pOut, a->blockSize);
+  }
+
+  riscv_biquad_parallel_stages_f32(a->S, first, count, a->pSrc, pOut, a->blockSize);
+}
+
+/**
+ * @brief Floating-point parallel-form IIR filter forked across the cluster cores.
+ * @param[in]     *P         points to the parallel execution context.
+ * @param[in]     *S         points to an instance of the floating-point parallel-form structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data, not overlapping <code>pSrc</code>.
+ * @param[in]     blockSize  number of samples to process.
+ * @param[in]     *pScratch  points to a scratch buffer of <code>(numCores-1)*blockSize</code> samples.
+ * @return none.
+ *
+ * \par
+ * The sections are split into one group per core, in multiples of four.  Every core filters the whole
+ * block through its sections with their own states, core 0 adds its outputs to the direct path in
+ * <code>pDst</code> and the others to their part of <code>pScratch</code>, and the calling core adds
+ * the parts after the join.  The sums are taken in another order than in riscv_biquad_parallel_f32(),
+ * the outputs differ from it by the rounding.
+ */
+
+void riscv_biquad_parallel_par_f32(
+  const riscv_par_instance * P,
+  const riscv_biquad_parallel_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize,
+  float32_t * pScratch)
+{
+  RISCV_PROFILE(riscv_biquad_parallel_par_f32);
+  riscv_biquad_parallel_par_args_f32 args;
+  uint32_t core;
+
+  args.S = S;
+  args.pSrc = pSrc;
+  args.pDst = pDst;
+  args.pScratch = pScratch;
+  args.blockSize = blockSize;
+
+  P->fork(P->numCores, riscv_biquad_parallel_par_worker_f32, &args);
+
+  for (core = 1u; core < P->numCores; core++)
+  {
+    riscv_add_f32(pDst, pScratch + ((core - 1u) * blockSize), pDst, blockSize);
+  }
+}
+
+/**
+ * @} end of ParallelFilters group
+ */
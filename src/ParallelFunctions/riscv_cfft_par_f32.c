@@ -0,0 +1,218 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_par_f32.c
+*
+* Description:  Floating-point CFFT forked across the cluster cores.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupParallel
+ */
+
+/**
+ * @defgroup ParallelTransforms Parallel Complex FFT
+ *
+ * Complex FFT split into independent radix-8 butterflies and sub-transforms, see riscv_cfft_par_f32().
+ */
+
+/**
+ * @addtogroup ParallelTransforms
+ * @{
+ */
+
+typedef struct
+{
+  const riscv_cfft_par_instance_f32 *S;
+  float32_t *p1;
+  uint8_t ifftFlag;
+} riscv_cfft_par_args_f32;
+
+/*
+* @brief  First stage, radix-8 butterflies n of one core and the twiddle factors W_N^(n*q).
+*
+* Output q of butterfly n goes to sample n of sub-transform q.  The butterfly is a radix-2
+* stage followed by two radix-4 butterflies.  sg is -1 for the forward and +1 for the inverse
+* transform, which also scales by 1/8 so that the sub-transforms complete the 1/N scaling.
+*/
+
+static void riscv_cfft_par_stage1_f32(
+  void * arg,
+  uint32_t coreId,
+  uint32_t numCores)
+{
+  const riscv_cfft_par_args_f32 *a = (const riscv_cfft_par_args_f32 *) arg;
+  const float32_t *pIn;                          /* Input of the butterfly */
+  const float32_t *pW;                           /* Twiddle factors of the butterfly */
+  float32_t *pOut;                               /* Output of the butterfly */
+  float32_t xr[8], xi[8];                        /* Inputs, then outputs of the butterfly */
+  float32_t ur[4], ui[4], vr[4], vi[4];          /* Outputs of the radix-2 stage */
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+  float32_t tr, wr, wi;
+  float32_t sg = (a->ifftFlag != 0u) ? 1.0f : -1.0f;
+  float32_t scale = (a->ifftFlag != 0u) ? 0.125f : 1.0f;
+  float32_t c = 0.70710678118654752440f;
+  uint32_t M = a->S->fftLen >> 3u;
+  uint32_t first, count, n, p, k;
+
+  riscv_par_split(M, 1u, coreId, numCores, &first, &count);
+
+  for (n = first; n < (first + count); n++)
+  {
+    pIn = a->p1 + (2u * n);
+    for (p = 0u; p < 8u; p++)
+    {
+      xr[p] = pIn[2u * p * M] * scale;
+      xi[p] = pIn[(2u * p * M) + 1u] * scale;
+    }
+
+    /* Radix-2 stage, v[k] is multiplied by W_8^k */
+    for (k = 0u; k < 4u; k++)
+    {
+      ur[k] = xr[k] + xr[k + 4u];
+      ui[k] = xi[k] + xi[k + 4u];
+      vr[k] = xr[k] - xr[k + 4u];
+      vi[k] = xi[k] - xi[k + 4u];
+    }
+
+    tr = vr[1];
+    vr[1] = c * (tr - (sg * vi[1]));
+    vi[1] = c * (vi[1] + (sg * tr));
+    tr = vr[2];
+    vr[2] = -sg * vi[2];
+    vi[2] = sg * tr;
+    tr = vr[3];
+    vr[3] = c * (-tr - (sg * vi[3]));
+    vi[3] = c * (-vi[3] + (sg * tr));
+
+    /* Radix-4 butterflies, u gives the even and v the odd outputs */
+    t0r = ur[0] + ur[2];  t0i = ui[0] + ui[2];
+    t1r = ur[0] - ur[2];  t1i = ui[0] - ui[2];
+    t2r = ur[1] + ur[3];  t2i = ui[1] + ui[3];
+    t3r = -sg * (ui[1] - ui[3]);  t3i = sg * (ur[1] - ur[3]);
+    xr[0] = t0r + t2r;  xi[0] = t0i + t2i;
+    xr[4] = t0r - t2r;  xi[4] = t0i - t2i;
+    xr[2] = t1r + t3r;  xi[2] = t1i + t3i;
+    xr[6] = t1r - t3r;  xi[6] = t1i - t3i;
+
+    t0r = vr[0] + vr[2];  t0i = vi[0] + vi[2];
+    t1r = vr[0] - vr[2];  t1i = vi[0] - vi[2];
+    t2r = vr[1] + vr[3];  t2i = vi[1] + vi[3];
+    t3r = -sg * (vi[1] - vi[3]);  t3i = sg * (vr[1] - vr[3]);
+    xr[1] = t0r + t2r;  xi[1] = t0i + t2i;
+    xr[5] = t0r - t2r;  xi[5] = t0i - t2i;
+    xr[3] = t1r + t3r;  xi[3] = t1i + t3i;
+    xr[7] = t1r - t3r;  xi[7] = t1i - t3i;
+
+    /* Twiddle factors W_N^(n*q), conjugated for the forward transform */
+    pOut = a->S->pScratch + (2u * n);
+    pW = a->S->pTwiddle + (14u * n);
+    pOut[0] = xr[0];
+    pOut[1] = xi[0];
+
+    for (p = 1u; p < 8u; p++)
+    {
+      wr = pW[0];
+      wi = sg * pW[1];
+      pW += 2;
+      pOut[2u * p * M] = (xr[p] * wr) - (xi[p] * wi);
+      pOut[(2u * p * M) + 1u] = (xr[p] * wi) + (xi[p] * wr);
+    }
+  }
+}
+
+/*
+* @brief  Second stage, sub-transforms q of one core.
+*/
+
+static void riscv_cfft_par_stage2_f32(
+  void * arg,
+  uint32_t coreId,
+  uint32_t numCores)
+{
+  const riscv_cfft_par_args_f32 *a = (const riscv_cfft_par_args_f32 *) arg;
+  uint32_t M = a->S->fftLen >> 3u;
+  uint32_t first, count, q;
+
+  riscv_par_split(8u, 1u, coreId, numCores, &first, &count);
+
+  for (q = first; q < (first + count); q++)
+  {
+    riscv_cfft_f32(a->S->pSub, a->S->pScratch + (2u * q * M), a->ifftFlag, 1u);
+  }
+}
+
+/*
+* @brief  Third stage, bins 8k..8k+7 of one core.
+*/
+
+static void riscv_cfft_par_stage3_f32(
+  void * arg,
+  uint32_t coreId,
+  uint32_t numCores)
+{
+  const riscv_cfft_par_args_f32 *a = (const riscv_cfft_par_args_f32 *) arg;
+  const float32_t *pIn = a->S->pScratch;
+  float32_t *pOut = a->p1;
+  uint32_t M = a->S->fftLen >> 3u;
+  uint32_t first, count, k, q;
+
+  riscv_par_split(M, 1u, coreId, numCores, &first, &count);
+
+  for (k = first; k < (first + count); k++)
+  {
+    for (q = 0u; q < 8u; q++)
+    {
+      pOut[2u * ((8u * k) + q)] = pIn[2u * ((q * M) + k)];
+      pOut[(2u * ((8u * k) + q)) + 1u] = pIn[(2u * ((q * M) + k)) + 1u];
+    }
+  }
+}
+
+/**
+ * @brief Floating-point CFFT forked across the cluster cores.
+ * @param[in]      *P        points to the parallel execution context.
+ * @param[in]      *S        points to an instance of the parallel floating-point CFFT structure.
+ * @param[in, out] *p1       points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @return none.
+ *
+ * \par
+ * The stages of riscv_cfft_f32() depend on each other, a split of their butterflies would need a
+ * barrier after every stage.  The function instead splits the transform of length <code>N = 8*M</code>
+ * into three forks:
+ * <pre>
+ *    1. M radix-8 butterflies over x[n], x[n+M], ..., x[n+7M], multiplied by W_N^(n*q)
+ *    2. 8 independent riscv_cfft_f32() of length M, in natural order
+ *    3. X[8k+q] = output k of sub-transform q
+ * </pre>
+ * Every fork ends with the barrier of the join.  The output is in natural order, as riscv_cfft_f32() with
+ * <code>bitReverseFlag</code> set, and the inverse transform is scaled by <code>1/fftLen</code>.
+ * The sub-transforms work in the scratch buffer of <code>S</code>, so lengths up to 8 times the largest
+ * length of riscv_cfft_f32() are supported.
+ */
+
+void riscv_cfft_par_f32(
+  const riscv_par_instance * P,
+  const riscv_cfft_par_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag)
+{
+  RISCV_PROFILE(riscv_cfft_par_f32);
+  riscv_cfft_par_args_f32 args;
+
+  args.S = S;
+  args.p1 = p1;
+  args.ifftFlag = ifftFlag;
+
+  P->fork(P->numCores, riscv_cfft_par_stage1_f32, &args);
+  P->fork(P->numCores, riscv_cfft_par_stage2_f32, &args);
+  P->fork(P->numCores, riscv_cfft_par_stage3_f32, &args);
+}
+
+/**
+ * @} end of ParallelTransforms group
+ */
@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_par_init_f32.c
+*
+* Description:  Initialization function of the floating-point CFFT forked
+*               across the cluster cores.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupParallel
+ */
+
+/**
+ * @addtogroup ParallelTransforms
+ * @{
+ */
+
+/**
+ * @brief  Initialization function of the floating-point CFFT forked across the cluster cores.
+ * @param[out] *S        points to an instance of the parallel floating-point CFFT structure.
+ * @param[in]  fftLen    length of the FFT, 8 times the length of <code>pSub</code>.
+ * @param[in]  *pSub     points to the floating-point CFFT instance of length <code>fftLen/8</code>, e.g. riscv_cfft_sR_f32_len512.
+ * @param[out] *pTwiddle points to a buffer of RISCV_CFFT_PAR_TWIDDLE_SIZE(fftLen) words that receives the twiddle factors of the first stage.
+ * @param[in]  *pScratch points to a scratch buffer of <code>2*fftLen</code> words.
+ * @return     The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>fftLen</code>
+ * is not 8 times the length of <code>pSub</code>.
+ *
+ * \par
+ * The table holds <code>W_N^(n*q) = cos(2*pi*n*q/N) + j*sin(2*pi*n*q/N)</code> for
+ * <code>n = 0..fftLen/8-1</code> and <code>q = 1..7</code>, computed in double precision.
+ */
+
+riscv_status riscv_cfft_par_init_f32(
+  riscv_cfft_par_instance_f32 * S,
+  uint32_t fftLen,
+  const riscv_cfft_instance_f32 * pSub,
+  float32_t * pTwiddle,
+  float32_t * pScratch)
+{
+  RISCV_PROFILE(riscv_cfft_par_init_f32);
+  uint32_t M = fftLen >> 3u;                     /* Length of the sub-transforms */
+  uint32_t n, q;
+  double phi;
+
+  if(((fftLen & 7u) != 0u) || (pSub->fftLen != M))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (n = 0u; n < M; n++)
+  {
+    for (q = 1u; q < 8u; q++)
+    {
+      phi = (6.28318530717958647692 * (double) ((n * q) % fftLen)) / (double) fftLen;
+      *pTwiddle++ = (float32_t) cos(phi);
+      *pTwiddle++ = (float32_t) sin(phi);
+    }
+  }
+
+  S->fftLen = fftLen;
+  S->pSub = pSub;
+  S->pTwiddle = pTwiddle - (14u * M);
+  S->pScratch = pScratch;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ParallelTransforms group
+ */
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_conv_par_f32.c
+*
+* Description:  floating-point convolution forked across the cluster cores.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupParallel
+ */
+
+/**
+ * @addtogroup ParallelFilters
+ * @{
+ */
+
+typedef struct
+{
+  float32_t *pSrcA;
+  uint32_t srcALen;
+  float32_t *pSrcB;
+  uint32_t srcBLen;
+  float32_t *pDst;
+} riscv_conv_par_args_f32;
+
+/*
+* @brief  Computes the outputs of one core.
+*/
+
+static void riscv_conv_par_worker_f32(
+  void * arg,
+  uint32_t coreId,
+  uint32_t numCores)
+{
+  const riscv_conv_par_args_f32 *a = (const riscv_conv_par_args_f32 *) arg;
+  uint32_t first, count;
+
+  riscv_par_split((a->srcALen + a->srcBLen) - 1u, 1u, coreId, numCores, &first, &count);
+
+  if(count > 0u)
+  {
+    (void) riscv_conv_partial_f32(a->pSrcA, a->srcALen, a->pSrcB, a->srcBLen, a->pDst, first, count);
+  }
+}
+
+/**
+ * @brief floating-point convolution forked across the cluster cores.
+ * @param[in]  *P       points to the parallel execution context.
+ * @param[in]  *pSrcA   points to the first input sequence.
+ * @param[in]  srcALen  length of the first input sequence.
+ * @param[in]  *pSrcB   points to the second input sequence.
+ * @param[in]  srcBLen  length of the second input sequence.
+ * @param[out] *pDst    points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @return none.
+ *
+ * \par
+ * Every core computes a contiguous range of outputs with riscv_conv_partial_f32().  The
+ * scaling of the outputs is the one of riscv_conv_partial_f32() and riscv_conv_f32().
+ */
+
+void riscv_conv_par_f32(
+  const riscv_par_instance * P,
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_conv_par_f32);
+  riscv_conv_par_args_f32 args;
+
+  args.pSrcA = pSrcA;
+  args.srcALen = srcALen;
+  args.pSrcB = pSrcB;
+  args.srcBLen = srcBLen;
+  args.pDst = pDst;
+
+  P->fork(P->numCores, riscv_conv_par_worker_f32, &args);
+}
+
+/**
+ * @} end of ParallelFilters group
+ */
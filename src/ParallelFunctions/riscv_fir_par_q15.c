@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_par_q15.c
+*
+* Description:  Q15 FIR filter forked across the cluster cores.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupParallel
+ */
+
+/**
+ * @addtogroup ParallelFilters
+ * @{
+ */
+
+typedef struct
+{
+  const riscv_fir_instance_q15 *S;
+  q15_t *pSrc;
+  q15_t *pDst;
+  q15_t *pScratch;
+  uint32_t blockSize;
+} riscv_fir_par_args_q15;
+
+/*
+* @brief  Last numTaps-1 samples of the history followed by the first n inputs.
+*/
+
+static void riscv_fir_par_history_q15(
+  q15_t * pHist,
+  const q15_t * pState,
+  const q15_t * pSrc,
+  uint32_t histLen,
+  uint32_t n)
+{
+  if(n >= histLen)
+  {
+    memcpy(pHist, pSrc + (n - histLen), histLen * sizeof(q15_t));
+  }
+  else
+  {
+    memmove(pHist, pState + n, (histLen - n) * sizeof(q15_t));
+    memcpy(pHist + (histLen - n), pSrc, n * sizeof(q15_t));
+  }
+}
+
+/*
+* @brief  Filters the output block of one core with a private state.
+*/
+
+static void riscv_fir_par_worker_q15(
+  void * arg,
+  uint32_t coreId,
+  uint32_t numCores)
+{
+  const riscv_fir_par_args_q15 *a = (const riscv_fir_par_args_q15 *) arg;
+  riscv_fir_instance_q15 local;                   /* Instance of the core */
+  uint32_t numTaps = a->S->numTaps;
+  uint32_t first, count;
+
+  riscv_par_split(a->blockSize, RISCV_FIR_PAR_ALIGN, coreId, numCores, &first, &count);
+
+  if(count > 0u)
+  {
+    local.numTaps = a->S->numTaps;
+    local.pCoeffs = a->S->pCoeffs;
+    local.pKernel = a->S->pKernel;
+    local.pState = a->pScratch + (coreId * RISCV_FIR_PAR_STRIDE(numTaps, a->blockSize, numCores));
+
+    /* The window of the first output reaches numTaps - 1 samples back */
+    riscv_fir_par_history_q15(local.pState, a->S->pState, a->pSrc, numTaps - 1u, first);
+
+    riscv_fir_q15(&local, a->pSrc + first, a->pDst + first, count);
+  }
+}
+
+/**
+ * @brief Q15 FIR filter forked across the cluster cores.
+ * @param[in]     *P         points to the parallel execution context.
+ * @param[in,out] *S         points to an instance of the Q15 FIR structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @param[in]     *pScratch  points to a scratch buffer of RISCV_FIR_PAR_SCRATCH_SIZE(numTaps, blockSize, numCores) samples.
+ * @return none.
+ *
+ * \par
+ * The outputs are split into one block per core, aligned to RISCV_FIR_PAR_ALIGN samples.  Every
+ * core rebuilds the <code>numTaps-1</code> samples preceding its block from the state of
+ * <code>S</code> and <code>pSrc</code> in its part of <code>pScratch</code> and runs riscv_fir_q15()
+ * on it, so the outputs equal the ones of riscv_fir_q15().  The state of <code>S</code> is updated
+ * by the calling core after the join.
+ * <code>pScratch</code> must be 4-byte aligned in the USE_DSP_RISCV build.
+ */
+
+void riscv_fir_par_q15(
+  const riscv_par_instance * P,
+  const riscv_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize,
+  q15_t * pScratch)
+{
+  RISCV_PROFILE(riscv_fir_par_q15);
+  riscv_fir_par_args_q15 args;
+
+  args.S = S;
+  args.pSrc = pSrc;
+  args.pDst = pDst;
+  args.pScratch = pScratch;
+  args.blockSize = blockSize;
+
+  P->fork(P->numCores, riscv_fir_par_worker_q15, &args);
+
+  /* Keep the last numTaps - 1 samples for the next call */
+  riscv_fir_par_history_q15(S->pState, S->pState, pSrc, S->numTaps - 1u, blockSize);
+}
+
+/**
+ * @} end of ParallelFilters group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_mult_packed_par_q15.c
+*
+* Description:  Q15 matrix multiplication with a packed right-hand matrix
+*               forked across the cluster cores.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupParallel
+ */
+
+/**
+ * @addtogroup ParallelMatrix
+ * @{
+ */
+
+typedef struct
+{
+  const riscv_matrix_instance_q15 *pSrcA;
+  const riscv_matrix_packed_instance_q15 *pSrcB;
+  riscv_matrix_instance_q15 *pDst;
+} riscv_mat_mult_packed_par_args_q15;
+
+/*
+* @brief  Multiplies the rows of A of one core, in pairs of rows.
+*/
+
+static void riscv_mat_mult_packed_par_worker_q15(
+  void * arg,
+  uint32_t coreId,
+  uint32_t numCores)
+{
+  const riscv_mat_mult_packed_par_args_q15 *a = (const riscv_mat_mult_packed_par_args_q15 *) arg;
+  riscv_matrix_instance_q15 rowsA, rowsDst;  /* Rows of A and of the result of the core */
+  uint32_t first, count;
+
+  riscv_par_split(a->pSrcA->numRows, 2u, coreId, numCores, &first, &count);
+
+  if(count > 0u)
+  {
+    riscv_mat_init_q15(&rowsA, (uint16_t) count, a->pSrcA->numCols, a->pSrcA->pData + (first * a->pSrcA->numCols));
+    riscv_mat_init_q15(&rowsDst, (uint16_t) count, a->pDst->numCols, a->pDst->pData + (first * a->pDst->numCols));
+    (void) riscv_mat_mult_packed_q15(&rowsA, a->pSrcB, &rowsDst);
+  }
+}
+
+/**
+ * @brief Q15 matrix multiplication with a packed right-hand matrix forked across the cluster cores.
+ * @param[in]       *P     points to the parallel execution context.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure, packed by riscv_mat_pack_q15()
+ * @param[out]      *pDst  points to output matrix structure
+ * @return     The function returns either
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * riscv_mat_mult_q15() transposes B into its scratch buffer on every call, which would be done
+ * once per core.  The parallel version takes B packed once, e.g. outside of the loop, and every core
+ * multiplies a block of pairs of rows of <code>pSrcA</code> with riscv_mat_mult_packed_q15().
+ * The result equals the one of riscv_mat_mult_packed_q15().
+ */
+
+riscv_status riscv_mat_mult_packed_par_q15(
+  const riscv_par_instance * P,
+  const riscv_matrix_instance_q15 * pSrcA,
+  const riscv_matrix_packed_instance_q15 * pSrcB,
+  riscv_matrix_instance_q15 * pDst)
+{
+  RISCV_PROFILE(riscv_mat_mult_packed_par_q15);
+  riscv_mat_mult_packed_par_args_q15 args;
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    return (RISCV_MATH_SIZE_MISMATCH);
+  }
+#endif /*    #ifdef RISCV_MATH_MATRIX_CHECK    */
+
+  args.pSrcA = pSrcA;
+  args.pSrcB = pSrcB;
+  args.pDst = pDst;
+
+  P->fork(P->numCores, riscv_mat_mult_packed_par_worker_q15, &args);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ParallelMatrix group
+ */
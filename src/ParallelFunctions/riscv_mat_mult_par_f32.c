@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mat_mult_par_f32.c
+*
+* Description:  floating-point matrix multiplication forked across the cluster cores.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupParallel
+ */
+
+/**
+ * @defgroup ParallelMatrix Parallel Matrix Multiplication
+ *
+ * Matrix multiplications where every core computes a block of rows of the result with the
+ * single-core function.  The rows of A and of the result of a core are contiguous, so the
+ * cores only share B, which is read-only.
+ */
+
+/**
+ * @addtogroup ParallelMatrix
+ * @{
+ */
+
+typedef struct
+{
+  const riscv_matrix_instance_f32 *pSrcA;
+  const riscv_matrix_instance_f32 *pSrcB;
+  riscv_matrix_instance_f32 *pDst;
+} riscv_mat_mult_par_args_f32;
+
+/*
+* @brief  Multiplies the rows of A of one core.
+*/
+
+static void riscv_mat_mult_par_worker_f32(
+  void * arg,
+  uint32_t coreId,
+  uint32_t numCores)
+{
+  const riscv_mat_mult_par_args_f32 *a = (const riscv_mat_mult_par_args_f32 *) arg;
+  riscv_matrix_instance_f32 rowsA, rowsDst;  /* Rows of A and of the result of the core */
+  uint32_t first, count;
+
+  riscv_par_split(a->pSrcA->numRows, 1u, coreId, numCores, &first, &count);
+
+  if(count > 0u)
+  {
+    riscv_mat_init_f32(&rowsA, (uint16_t) count, a->pSrcA->numCols, a->pSrcA->pData + (first * a->pSrcA->numCols));
+    riscv_mat_init_f32(&rowsDst, (uint16_t) count, a->pDst->numCols, a->pDst->pData + (first * a->pDst->numCols));
+    (void) riscv_mat_mult_f32(&rowsA, a->pSrcB, &rowsDst);
+  }
+}
+
+/**
+ * @brief floating-point matrix multiplication forked across the cluster cores.
+ * @param[in]       *P     points to the parallel execution context.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst  points to output matrix structure
+ * @return     The function returns either
+ * <code>RISCV_MATH_SIZE_MISMATCH</code> or <code>RISCV_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * Every core multiplies a contiguous block of rows of <code>pSrcA</code> with riscv_mat_mult_f32(),
+ * the result equals the one of riscv_mat_mult_f32().
+ */
+
+riscv_status riscv_mat_mult_par_f32(
+  const riscv_par_instance * P,
+  const riscv_matrix_instance_f32 * pSrcA,
+  const riscv_matrix_instance_f32 * pSrcB,
+  riscv_matrix_instance_f32 * pDst)
+{
+  RISCV_PROFILE(riscv_mat_mult_par_f32);
+  riscv_mat_mult_par_args_f32 args;
+
+#ifdef RISCV_MATH_MATRIX_CHECK
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    return (RISCV_MATH_SIZE_MISMATCH);
+  }
+#endif /*    #ifdef RISCV_MATH_MATRIX_CHECK    */
+
+  args.pSrcA = pSrcA;
+  args.pSrcB = pSrcB;
+  args.pDst = pDst;
+
+  P->fork(P->numCores, riscv_mat_mult_par_worker_f32, &args);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ParallelMatrix group
+ */
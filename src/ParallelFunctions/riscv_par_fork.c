@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_par_fork.c
+*
+* Description:  Fork hook and work partitioning of the parallel functions.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupParallel
+ */
+
+/**
+ * @defgroup ParallelFork Fork and Work Partitioning
+ *
+ * The parallel functions run on PULP clusters where several cores share the TCDM.  They are
+ * written in the fork-join style of the cluster runtimes: the calling core forks a function on
+ * <code>numCores</code> cores, every core calls it with its own <code>coreId</code> and works on
+ * its part of the outputs, and the fork returns after all of them are done, so every fork ends
+ * with a barrier.  The library does not depend on a runtime, the fork is a hook of the
+ * riscv_par_instance structure.  On the PULP runtime it wraps the team fork:
+ * <pre>
+ *     static void team_entry(void *arg) { ... func(arg, rt_core_id(), numCores); }
+ *     static void cluster_fork(uint32_t numCores, riscv_par_func func, void *arg)
+ *     {
+ *       ...save func and arg...
+ *       rt_team_fork(numCores, team_entry, ...);
+ *     }
+ * </pre>
+ * With the default hook, riscv_par_fork_seq(), the cores are called one after the other on the
+ * calling core.  The results are the same as with the real fork, so the functions can be
+ * tested on a single core.
+ */
+
+/**
+ * @addtogroup ParallelFork
+ * @{
+ */
+
+/**
+ * @brief  Initialization function of the parallel execution context.
+ * @param[out] *P        points to an instance of the parallel execution structure.
+ * @param[in]  numCores  number of cores the functions are forked on.
+ * @param[in]  fork      fork function of the runtime, NULL for riscv_par_fork_seq().
+ * @return     The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if
+ * <code>numCores</code> is 0.
+ */
+
+riscv_status riscv_par_init(
+  riscv_par_instance * P,
+  uint32_t numCores,
+  riscv_par_fork_func fork)
+{
+  RISCV_PROFILE(riscv_par_init);
+  if(numCores == 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  P->numCores = numCores;
+  P->fork = (fork != NULL) ? fork : riscv_par_fork_seq;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Sequential fork, calls the function for every core in turn on the calling core.
+ * @param[in]  numCores  number of cores.
+ * @param[in]  func      function forked on the cores.
+ * @param[in]  *arg      argument of the function.
+ * @return none.
+ */
+
+void riscv_par_fork_seq(
+  uint32_t numCores,
+  riscv_par_func func,
+  void * arg)
+{
+  RISCV_PROFILE(riscv_par_fork_seq);
+  uint32_t coreId;
+
+  for (coreId = 0u; coreId < numCores; coreId++)
+  {
+    func(arg, coreId, numCores);
+  }
+}
+
+/**
+ * @brief  Part of a range of work items of one core.
+ * @param[in]  total     number of work items.
+ * @param[in]  align     granularity of the parts, the parts start at multiples of <code>align</code>.
+ * @param[in]  coreId    index of the core.
+ * @param[in]  numCores  number of cores.
+ * @param[out] *pFirst   first item of the core.
+ * @param[out] *pCount   number of items of the core, 0 if the core has no work.
+ * @return none.
+ *
+ * \par
+ * Every core but the last ones gets <code>ceil(total/numCores)</code> items rounded up to
+ * <code>align</code>, so the parts start where the unrolled loops of the single-core kernels
+ * start a new group and give the same results.
+ */
+
+void riscv_par_split(
+  uint32_t total,
+  uint32_t align,
+  uint32_t coreId,
+  uint32_t numCores,
+  uint32_t * pFirst,
+  uint32_t * pCount)
+{
+  RISCV_PROFILE(riscv_par_split);
+  uint32_t chunk = (total + numCores - 1u) / numCores;
+  uint32_t first;
+
+  chunk = ((chunk + align - 1u) / align) * align;
+  first = coreId * chunk;
+
+  if(first >= total)
+  {
+    *pFirst = total;
+    *pCount = 0u;
+  }
+  else
+  {
+    *pFirst = first;
+    *pCount = ((total - first) < chunk) ? (total - first) : chunk;
+  }
+}
+
+/**
+ * @} end of ParallelFork group
+ */
@@ -0,0 +1,134 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfar_ca_f32.c
+*
+* Description:  Floating-point cell-averaging CFAR threshold.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup CFAR Constant False Alarm Rate Detection
+ *
+ * A CFAR detector compares every cell of a power spectrum or range profile with a threshold taken from
+ * its neighbourhood, so the false alarm rate stays constant when the noise floor changes along the block.
+ * The training cells of cell <code>i</code> are the <code>numTrain</code> cells on each side of it after
+ * <code>numGuard</code> guard cells, which keep the target itself out of the estimate:
+ * <pre>
+ *     x[i-numGuard-numTrain] ... x[i-numGuard-1]    x[i+numGuard+1] ... x[i+numGuard+numTrain]
+ * </pre>
+ * Near the ends of the block only the training cells inside it are used.  The block has at least
+ * <code>2*numGuard+2</code> cells so that every cell has one, a cell without any gets the largest threshold.
+ * \par
+ * The cell-averaging detectors riscv_cfar_ca_f32() and riscv_cfar_ca_q15() set the threshold to
+ * <code>scale</code> times the mean of the training cells.  The sum of the training cells is kept as a
+ * running sum, two cells enter and two leave it per cell under test, so the cost does not depend on
+ * <code>numTrain</code>.
+ * \par
+ * The ordered-statistic detectors riscv_cfar_os_f32() and riscv_cfar_os_q15() set the threshold to
+ * <code>scale</code> times the training cell of order <code>rank</code>, which is not raised by a second
+ * target in the training cells as the mean is.  The training cells are kept sorted in <code>pScratch</code>;
+ * per cell under test two of them are replaced, each by a binary search and a move of the values between
+ * its old and new position.
+ * Where only <code>count</code> training cells are inside the block the order is scaled to
+ * <code>rank*count/(2*numTrain)</code>.
+ * \par
+ * riscv_find_peaks_f32() and riscv_find_peaks_q15() pick the local maxima above such a threshold.
+ * \par
+ * The inputs are powers or magnitudes, the detectors are also correct for negative values but the
+ * prefilter of riscv_find_peaks_q15() assumes non-negative ones.
+ */
+
+/**
+ * @addtogroup CFAR
+ * @{
+ */
+
+/**
+ * @brief  Floating-point cell-averaging CFAR threshold.
+ * @param[in]   *S           points to an instance of the floating-point CFAR structure.
+ * @param[in]   *pSrc        points to the input cells.
+ * @param[out]  *pThreshold  points to the threshold of every cell.
+ * @param[in]   blockSize    number of cells.
+ * @return none.
+ *
+ * \par
+ * The running sum is updated by adding and subtracting cells, its rounding error grows with the ratio of
+ * the largest cell to the noise floor; recompute in blocks when that ratio is large.
+ */
+
+void riscv_cfar_ca_f32(
+  const riscv_cfar_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pThreshold,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cfar_ca_f32);
+  uint32_t G = S->numGuard;
+  uint32_t T = S->numTrain;
+  uint32_t i, j;
+  uint32_t count = 0u, last = 0u;              /* training cells inside the block */
+  float32_t sum = 0.0f;                        /* sum of the training cells */
+  float32_t factor = 0.0f;                     /* scale/count */
+
+  /* leading training cells of cell 0 */
+  for (j = G + 1u; (j <= G + T) && (j < blockSize); j++)
+  {
+    sum += pSrc[j];
+    count++;
+  }
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    if(count != last)
+    {
+      /* divide only when a block edge changes the number of cells */
+      factor = S->scale / (float32_t) count;
+      last = count;
+    }
+
+    pThreshold[i] = (count > 0u) ? factor * sum : INFINITY;
+
+    if((i >= G + T) && ((i + G + T + 1u) < blockSize))
+    {
+      /* both windows inside the block */
+      sum += (pSrc[i + G + T + 1u] - pSrc[i + G + 1u]) + (pSrc[i - G] - pSrc[i - G - T]);
+    }
+    else
+    {
+      /* leading cell i+G+1 becomes a guard cell, i+G+T+1 enters */
+      if((i + G + 1u) < blockSize)
+      {
+        sum -= pSrc[i + G + 1u];
+        count--;
+      }
+      if((i + G + T + 1u) < blockSize)
+      {
+        sum += pSrc[i + G + T + 1u];
+        count++;
+      }
+
+      /* guard cell i-G enters the lagging cells, i-G-T leaves them */
+      if(i >= G)
+      {
+        sum += pSrc[i - G];
+        count++;
+      }
+      if(i >= G + T)
+      {
+        sum -= pSrc[i - G - T];
+        count--;
+      }
+    }
+  }
+}
+
+/**
+ * @} end of CFAR group
+ */
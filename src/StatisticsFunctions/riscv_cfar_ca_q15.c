@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfar_ca_q15.c
+*
+* Description:  Q15 cell-averaging CFAR threshold.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup CFAR
+ * @{
+ */
+
+/**
+ * @brief  Q15 cell-averaging CFAR threshold.
+ * @param[in]   *S           points to an instance of the Q15 CFAR structure.
+ * @param[in]   *pSrc        points to the input cells.
+ * @param[out]  *pThreshold  points to the threshold of every cell.
+ * @param[in]   blockSize    number of cells.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The running sum is exact in a 32-bit accumulator.  It is multiplied by <code>(scaleFract<<16)/count</code>,
+ * computed again only where the number of training cells changes, in a 64-bit product, rounded and shifted
+ * by <code>31-shift</code> bits, and the threshold saturates to 1.15 format.
+ */
+
+void riscv_cfar_ca_q15(
+  const riscv_cfar_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pThreshold,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cfar_ca_q15);
+  uint32_t G = S->numGuard;
+  uint32_t T = S->numTrain;
+  uint32_t i, j;
+  uint32_t count = 0u, last = 0u;              /* training cells inside the block */
+  uint32_t postShift = 31u - (uint32_t) ((int32_t) S->shift);
+  q31_t sum = 0;                               /* sum of the training cells */
+  q31_t factor = 0;                            /* scaleFract/count in 1.31 format */
+  q63_t acc;
+
+  /* leading training cells of cell 0 */
+  for (j = G + 1u; (j <= G + T) && (j < blockSize); j++)
+  {
+    sum += pSrc[j];
+    count++;
+  }
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    if(count != last)
+    {
+      /* divide only when a block edge changes the number of cells */
+      factor = (q31_t) (((q31_t) S->scaleFract << 16) / (q31_t) count);
+      last = count;
+    }
+
+    if(count > 0u)
+    {
+      acc = (((q63_t) sum * factor) + ((q63_t) 1 << (postShift - 1u))) >> postShift;
+      pThreshold[i] = (q15_t) ((acc > 0x7FFF) ? 0x7FFF : ((acc < -0x8000) ? -0x8000 : acc));
+    }
+    else
+    {
+      pThreshold[i] = 0x7FFF;
+    }
+
+    if((i >= G + T) && ((i + G + T + 1u) < blockSize))
+    {
+      /* both windows inside the block */
+      sum += ((q31_t) pSrc[i + G + T + 1u] - pSrc[i + G + 1u]) + ((q31_t) pSrc[i - G] - pSrc[i - G - T]);
+    }
+    else
+    {
+      /* leading cell i+G+1 becomes a guard cell, i+G+T+1 enters */
+      if((i + G + 1u) < blockSize)
+      {
+        sum -= pSrc[i + G + 1u];
+        count--;
+      }
+      if((i + G + T + 1u) < blockSize)
+      {
+        sum += pSrc[i + G + T + 1u];
+        count++;
+      }
+
+      /* guard cell i-G enters the lagging cells, i-G-T leaves them */
+      if(i >= G)
+      {
+        sum += pSrc[i - G];
+        count++;
+      }
+      if(i >= G + T)
+      {
+        sum -= pSrc[i - G - T];
+        count--;
+      }
+    }
+  }
+}
+
+/**
+ * @} end of CFAR group
+ */
@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfar_init_q15.c
+*
+* Description:  Initialization function for the Q15 CFAR detectors.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup CFAR
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 CFAR detectors.
+ * @param[out]    *S          points to an instance of the Q15 CFAR structure.
+ * @param[in]     numGuard    number of guard cells on each side of the cell under test.
+ * @param[in]     numTrain    number of training cells on each side, 1 or more.
+ * @param[in]     rank        rank of the OS-CFAR statistic among the <code>2*numTrain</code> training cells, 0 is the smallest.
+ * @param[in]     scaleFract  fractional part of the factor from the statistic of the training cells to the threshold.
+ * @param[in]     shift       number of bits to shift the factor, <code>scaleFract*2^shift</code>, from -15 to 15.
+ * @param[in]     *pScratch   points to a buffer of <code>2*numTrain</code> values for riscv_cfar_os_q15(), or NULL.
+ * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>numTrain</code> is 0 or
+ *                <code>rank</code> is not less than <code>2*numTrain</code>,
+ *                or <code>shift</code> is out of range.
+ */
+
+riscv_status riscv_cfar_init_q15(
+  riscv_cfar_instance_q15 * S,
+  uint16_t numGuard,
+  uint16_t numTrain,
+  uint16_t rank,
+  q15_t scaleFract,
+  int8_t shift,
+  q15_t * pScratch)
+{
+  RISCV_PROFILE(riscv_cfar_init_q15);
+
+  if((numTrain == 0u) || ((uint32_t) rank >= (2u * (uint32_t) numTrain)) || (shift < -15) || (shift > 15))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numGuard = numGuard;
+  S->numTrain = numTrain;
+  S->rank = rank;
+  S->scaleFract = scaleFract;
+  S->shift = shift;
+  S->pScratch = pScratch;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of CFAR group
+ */
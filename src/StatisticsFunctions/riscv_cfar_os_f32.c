@@ -0,0 +1,181 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfar_os_f32.c
+*
+* Description:  Floating-point ordered-statistic CFAR threshold.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup CFAR
+ * @{
+ */
+
+/*
+* @brief  Position of the first sorted value not less than x.
+*/
+
+static uint32_t riscv_cfar_search_f32(
+  const float32_t * pSort,
+  uint32_t n,
+  float32_t x)
+{
+  uint32_t lo = 0u, hi = n, mid;
+
+  while(lo < hi)
+  {
+    mid = (lo + hi) >> 1u;
+    if(pSort[mid] < x)
+    {
+      lo = mid + 1u;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  return (lo);
+}
+
+/*
+* @brief  Inserts x into the n sorted values.
+*/
+
+static void riscv_cfar_insert_f32(
+  float32_t * pSort,
+  uint32_t n,
+  float32_t x)
+{
+  uint32_t pos = riscv_cfar_search_f32(pSort, n, x);
+
+  memmove(&pSort[pos + 1u], &pSort[pos], (n - pos) * sizeof(float32_t));
+  pSort[pos] = x;
+}
+
+/*
+* @brief  Removes x, which is one of them, from the n sorted values.
+*/
+
+static void riscv_cfar_remove_f32(
+  float32_t * pSort,
+  uint32_t n,
+  float32_t x)
+{
+  uint32_t pos = riscv_cfar_search_f32(pSort, n, x);
+
+  memmove(&pSort[pos], &pSort[pos + 1u], (n - pos - 1u) * sizeof(float32_t));
+}
+
+/*
+* @brief  Replaces xOld, which is one of the n sorted values, with xNew.
+*         Only the values between the two positions move.
+*/
+
+static void riscv_cfar_replace_f32(
+  float32_t * pSort,
+  uint32_t n,
+  float32_t xOld,
+  float32_t xNew)
+{
+  uint32_t pos = riscv_cfar_search_f32(pSort, n, xOld);
+
+  while(((pos + 1u) < n) && (pSort[pos + 1u] < xNew))
+  {
+    pSort[pos] = pSort[pos + 1u];
+    pos++;
+  }
+  while((pos > 0u) && (pSort[pos - 1u] > xNew))
+  {
+    pSort[pos] = pSort[pos - 1u];
+    pos--;
+  }
+  pSort[pos] = xNew;
+}
+
+/**
+ * @brief  Floating-point ordered-statistic CFAR threshold.
+ * @param[in]   *S           points to an instance of the floating-point CFAR structure, with a scratch buffer.
+ * @param[in]   *pSrc        points to the input cells.
+ * @param[out]  *pThreshold  points to the threshold of every cell.
+ * @param[in]   blockSize    number of cells.
+ * @return none.
+ */
+
+void riscv_cfar_os_f32(
+  const riscv_cfar_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pThreshold,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cfar_os_f32);
+  uint32_t G = S->numGuard;
+  uint32_t T = S->numTrain;
+  uint32_t rank = S->rank;
+  float32_t *pSort = S->pScratch;              /* training cells in ascending order */
+  uint32_t i, j;
+  uint32_t count = 0u;                         /* training cells inside the block */
+
+  /* leading training cells of cell 0 */
+  for (j = G + 1u; (j <= G + T) && (j < blockSize); j++)
+  {
+    riscv_cfar_insert_f32(pSort, count, pSrc[j]);
+    count++;
+  }
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    if(count == 2u * T)
+    {
+      pThreshold[i] = S->scale * pSort[rank];
+    }
+    else
+    {
+      pThreshold[i] = (count > 0u) ? S->scale * pSort[(rank * count) / (2u * T)] : INFINITY;
+    }
+
+    if((i >= G + T) && ((i + G + T + 1u) < blockSize))
+    {
+      /* both windows inside the block, one cell enters each for one that leaves */
+      riscv_cfar_replace_f32(pSort, count, pSrc[i + G + 1u], pSrc[i + G + T + 1u]);
+      riscv_cfar_replace_f32(pSort, count, pSrc[i - G - T], pSrc[i - G]);
+    }
+    else
+    {
+      /* leading cell i+G+1 becomes a guard cell, i+G+T+1 enters */
+      if((i + G + 1u) < blockSize)
+      {
+        riscv_cfar_remove_f32(pSort, count, pSrc[i + G + 1u]);
+        count--;
+      }
+      if((i + G + T + 1u) < blockSize)
+      {
+        riscv_cfar_insert_f32(pSort, count, pSrc[i + G + T + 1u]);
+        count++;
+      }
+
+      /* guard cell i-G enters the lagging cells, i-G-T leaves them */
+      if(i >= G)
+      {
+        riscv_cfar_insert_f32(pSort, count, pSrc[i - G]);
+        count++;
+      }
+      if(i >= G + T)
+      {
+        riscv_cfar_remove_f32(pSort, count, pSrc[i - G - T]);
+        count--;
+      }
+    }
+  }
+}
+
+/**
+ * @} end of CFAR group
+ */
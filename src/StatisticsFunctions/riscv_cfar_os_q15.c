@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfar_os_q15.c
+*
+* Description:  Q15 ordered-statistic CFAR threshold.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup CFAR
+ * @{
+ */
+
+/*
+* @brief  Position of the first sorted value not less than x.
+*/
+
+static uint32_t riscv_cfar_search_q15(
+  const q15_t * pSort,
+  uint32_t n,
+  q15_t x)
+{
+  uint32_t lo = 0u, hi = n, mid;
+
+  while(lo < hi)
+  {
+    mid = (lo + hi) >> 1u;
+    if(pSort[mid] < x)
+    {
+      lo = mid + 1u;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  return (lo);
+}
+
+/*
+* @brief  Inserts x into the n sorted values.
+*/
+
+static void riscv_cfar_insert_q15(
+  q15_t * pSort,
+  uint32_t n,
+  q15_t x)
+{
+  uint32_t pos = riscv_cfar_search_q15(pSort, n, x);
+
+  memmove(&pSort[pos + 1u], &pSort[pos], (n - pos) * sizeof(q15_t));
+  pSort[pos] = x;
+}
+
+/*
+* @brief  Removes x, which is one of them, from the n sorted values.
+*/
+
+static void riscv_cfar_remove_q15(
+  q15_t * pSort,
+  uint32_t n,
+  q15_t x)
+{
+  uint32_t pos = riscv_cfar_search_q15(pSort, n, x);
+
+  memmove(&pSort[pos], &pSort[pos + 1u], (n - pos - 1u) * sizeof(q15_t));
+}
+
+/*
+* @brief  Replaces xOld, which is one of the n sorted values, with xNew.
+*         Only the values between the two positions move.
+*/
+
+static void riscv_cfar_replace_q15(
+  q15_t * pSort,
+  uint32_t n,
+  q15_t xOld,
+  q15_t xNew)
+{
+  uint32_t pos = riscv_cfar_search_q15(pSort, n, xOld);
+
+  while(((pos + 1u) < n) && (pSort[pos + 1u] < xNew))
+  {
+    pSort[pos] = pSort[pos + 1u];
+    pos++;
+  }
+  while((pos > 0u) && (pSort[pos - 1u] > xNew))
+  {
+    pSort[pos] = pSort[pos - 1u];
+    pos--;
+  }
+  pSort[pos] = xNew;
+}
+
+/**
+ * @brief  Q15 ordered-statistic CFAR threshold.
+ * @param[in]   *S           points to an instance of the Q15 CFAR structure, with a scratch buffer.
+ * @param[in]   *pSrc        points to the input cells.
+ * @param[out]  *pThreshold  points to the threshold of every cell.
+ * @param[in]   blockSize    number of cells.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The training cell of order <code>rank</code> is multiplied by <code>scaleFract</code>, rounded and shifted
+ * by <code>15-shift</code> bits, and the threshold saturates to 1.15 format.
+ */
+
+void riscv_cfar_os_q15(
+  const riscv_cfar_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pThreshold,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_cfar_os_q15);
+  uint32_t G = S->numGuard;
+  uint32_t T = S->numTrain;
+  uint32_t rank = S->rank;
+  q15_t *pSort = S->pScratch;              /* training cells in ascending order */
+  uint32_t i, j;
+  uint32_t count = 0u;                         /* training cells inside the block */
+  uint32_t postShift = 15u - (uint32_t) ((int32_t) S->shift);
+  q63_t round = ((q63_t) 1 << postShift) >> 1;
+  q15_t x;
+  q63_t acc;
+
+  /* leading training cells of cell 0 */
+  for (j = G + 1u; (j <= G + T) && (j < blockSize); j++)
+  {
+    riscv_cfar_insert_q15(pSort, count, pSrc[j]);
+    count++;
+  }
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    if(count > 0u)
+    {
+      x = (count == 2u * T) ? pSort[rank] : pSort[(rank * count) / (2u * T)];
+      acc = (((q63_t) S->scaleFract * x) + round) >> postShift;
+      pThreshold[i] = (q15_t) ((acc > 0x7FFF) ? 0x7FFF : ((acc < -0x8000) ? -0x8000 : acc));
+    }
+    else
+    {
+      pThreshold[i] = 0x7FFF;
+    }
+
+    if((i >= G + T) && ((i + G + T + 1u) < blockSize))
+    {
+      /* both windows inside the block, one cell enters each for one that leaves */
+      riscv_cfar_replace_q15(pSort, count, pSrc[i + G + 1u], pSrc[i + G + T + 1u]);
+      riscv_cfar_replace_q15(pSort, count, pSrc[i - G - T], pSrc[i - G]);
+    }
+    else
+    {
+      /* leading cell i+G+1 becomes a guard cell, i+G+T+1 enters */
+      if((i + G + 1u) < blockSize)
+      {
+        riscv_cfar_remove_q15(pSort, count, pSrc[i + G + 1u]);
+        count--;
+      }
+      if((i + G + T + 1u) < blockSize)
+      {
+        riscv_cfar_insert_q15(pSort, count, pSrc[i + G + T + 1u]);
+        count++;
+      }
+
+      /* guard cell i-G enters the lagging cells, i-G-T leaves them */
+      if(i >= G)
+      {
+        riscv_cfar_insert_q15(pSort, count, pSrc[i - G]);
+        count++;
+      }
+      if(i >= G + T)
+      {
+        riscv_cfar_remove_q15(pSort, count, pSrc[i - G - T]);
+        count--;
+      }
+    }
+  }
+}
+
+/**
+ * @} end of CFAR group
+ */
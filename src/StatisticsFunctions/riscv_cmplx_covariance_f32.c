@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_covariance_f32.c
+*
+* Description:  Sample covariance matrix of multi-channel complex floating-point data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* Updates element (r, c) with the sum re + j*im and element (c, r) with its conjugate */
+static void riscv_cmplx_covariance_store_f32(
+  float32_t * pCov,
+  uint32_t N,
+  uint32_t r,
+  uint32_t c,
+  float32_t re,
+  float32_t im,
+  float32_t lambda)
+{
+  float32_t *pU = pCov + 2u * (r * N + c);
+  float32_t *pL = pCov + 2u * (c * N + r);
+
+  if(lambda != 0.0f)
+  {
+    re += lambda * pU[0];
+    im += lambda * pU[1];
+  }
+  if(r == c)
+  {
+    /* the diagonal is real */
+    im = 0.0f;
+  }
+
+  pU[0] = re;
+  pU[1] = im;
+  pL[0] = re;
+  pL[1] = -im;
+}
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Covariance
+ * @{
+ */
+
+/**
+ * @brief Covariance matrix of floating-point complex channel-interleaved data.
+ * @param[in]       *pSrc points to <code>numSamples</code> frames of <code>numChannels</code> complex samples
+ * @param[in]       numChannels number of channels
+ * @param[in]       numSamples number of frames
+ * @param[in]       lambda forgetting factor applied to <code>pCov</code>, 0 to overwrite it
+ * @param[in,out]   *pCov points to the <code>numChannels*numChannels</code> complex matrix
+ * @return none.
+ *
+ * \par
+ * Element <code>(i, j)</code> is the sum of <code>x_i[n] * conj(x_j[n])</code>, the matrix is
+ * Hermitian with a real diagonal.
+ */
+
+void riscv_cmplx_covariance_f32(
+  const float32_t * pSrc,
+  uint16_t numChannels,
+  uint32_t numSamples,
+  float32_t lambda,
+  float32_t * pCov)
+{
+  RISCV_PROFILE(riscv_cmplx_covariance_f32);
+  const float32_t *pIn;
+  float32_t a0r, a0i, a1r, a1i;                  /* Samples of the two row channels */
+  float32_t b0r, b0i, b1r, b1i;                  /* Samples of the two column channels */
+  float32_t r00, r01, r10, r11;                  /* Real parts of the block */
+  float32_t i00, i01, i10, i11;                  /* Imaginary parts of the block */
+  uint32_t i, j, i1, j1, n;
+  uint32_t N = numChannels;
+
+  for (i = 0u; i < N; i += 2u)
+  {
+    /* an odd last channel is paired with itself, the extra sums are dropped */
+    i1 = (i + 1u < N) ? i + 1u : i;
+
+    for (j = i; j < N; j += 2u)
+    {
+      j1 = (j + 1u < N) ? j + 1u : j;
+      r00 = r01 = r10 = r11 = 0.0f;
+      i00 = i01 = i10 = i11 = 0.0f;
+      pIn = pSrc;
+
+      for (n = numSamples; n > 0u; n--)
+      {
+        a0r = pIn[2u * i];
+        a0i = pIn[2u * i + 1u];
+        a1r = pIn[2u * i1];
+        a1i = pIn[2u * i1 + 1u];
+        b0r = pIn[2u * j];
+        b0i = pIn[2u * j + 1u];
+        b1r = pIn[2u * j1];
+        b1i = pIn[2u * j1 + 1u];
+
+        /* a * conj(b) */
+        r00 += (a0r * b0r) + (a0i * b0i);
+        i00 += (a0i * b0r) - (a0r * b0i);
+        r01 += (a0r * b1r) + (a0i * b1i);
+        i01 += (a0i * b1r) - (a0r * b1i);
+        r10 += (a1r * b0r) + (a1i * b0i);
+        i10 += (a1i * b0r) - (a1r * b0i);
+        r11 += (a1r * b1r) + (a1i * b1i);
+        i11 += (a1i * b1r) - (a1r * b1i);
+        pIn += 2u * N;
+      }
+
+      riscv_cmplx_covariance_store_f32(pCov, N, i, j, r00, i00, lambda);
+      if(j1 != j)
+      {
+        riscv_cmplx_covariance_store_f32(pCov, N, i, j1, r01, i01, lambda);
+      }
+      if((i1 != i) && (j != i))
+      {
+        riscv_cmplx_covariance_store_f32(pCov, N, i1, j, r10, i10, lambda);
+      }
+      if((i1 != i) && (j1 != j))
+      {
+        riscv_cmplx_covariance_store_f32(pCov, N, i1, j1, r11, i11, lambda);
+      }
+    }
+  }
+}
+
+/**
+ * @} end of Covariance group
+ */
@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_covariance_q15.c
+*
+* Description:  Sample covariance matrix of multi-channel complex Q15 data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* lambda * c with lambda in 1.15 format, the high and low parts of c apart */
+static q63_t riscv_cmplx_covariance_scale_q15(
+  q63_t c,
+  q15_t lambda)
+{
+  return (((c >> 15) * lambda) + (((c & 0x7FFF) * lambda) >> 15));
+}
+
+/* Updates element (r, c) with the sum re + j*im and element (c, r) with its conjugate */
+static void riscv_cmplx_covariance_store_q15(
+  q63_t * pCov,
+  uint32_t N,
+  uint32_t r,
+  uint32_t c,
+  q63_t re,
+  q63_t im,
+  q15_t lambda)
+{
+  q63_t *pU = pCov + 2u * (r * N + c);
+  q63_t *pL = pCov + 2u * (c * N + r);
+
+  if(lambda == 0x7FFF)
+  {
+    re += pU[0];
+    im += pU[1];
+  }
+  else if(lambda != 0)
+  {
+    re += riscv_cmplx_covariance_scale_q15(pU[0], lambda);
+    im += riscv_cmplx_covariance_scale_q15(pU[1], lambda);
+  }
+  if(r == c)
+  {
+    /* the diagonal is real */
+    im = 0;
+  }
+
+  pU[0] = re;
+  pU[1] = im;
+  pL[0] = re;
+  pL[1] = -im;
+}
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Covariance
+ * @{
+ */
+
+/**
+ * @brief Covariance matrix of Q15 complex channel-interleaved data.
+ * @param[in]       *pSrc points to <code>numSamples</code> frames of <code>numChannels</code> complex samples
+ * @param[in]       numChannels number of channels
+ * @param[in]       numSamples number of frames
+ * @param[in]       lambda forgetting factor in 1.15 format applied to <code>pCov</code>, 0 to overwrite it
+ * @param[in,out]   *pCov points to the <code>numChannels*numChannels</code> complex matrix
+ * @return none.
+ *
+ * \par
+ * Element <code>(i, j)</code> is the sum of <code>x_i[n] * conj(x_j[n])</code>, the matrix is
+ * Hermitian with a real diagonal.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are in 2.30 format, summed in 64-bit accumulators.  The matrix is in 34.30
+ * format, exact for any practical <code>numSamples</code>.  <code>lambda</code> scales the
+ * previous matrix with truncation, 0x7FFF leaves it unscaled.
+ * \par
+ * With the xpulp extensions a complex sample is loaded as one word.  The real part of
+ * <code>a * conj(b)</code> is one dotpv2, the imaginary part <code>ai*br - ar*bi</code> is
+ * <code>(ar*bi + ai*br) - 2*ar*bi</code>, a dotpv2 with the swapped column sample and one
+ * multiplication.  The result is the same unless both parts of the two samples are -1.0, whose
+ * pair product 2.0 wraps in the 32-bit dotpv2.
+ */
+
+void riscv_cmplx_covariance_q15(
+  const q15_t * pSrc,
+  uint16_t numChannels,
+  uint32_t numSamples,
+  q15_t lambda,
+  q63_t * pCov)
+{
+  RISCV_PROFILE(riscv_cmplx_covariance_q15);
+  const q15_t *pIn;
+  q63_t r00, r01, r10, r11;                      /* Real parts of the block */
+  q63_t i00, i01, i10, i11;                      /* Imaginary parts of the block */
+#if defined (USE_DSP_RISCV)
+  shortV a0, a1, b0, b1;                         /* Samples of the row and column channels */
+  shortV b0s, b1s;                               /* Column samples with swapped parts */
+  shortV swap = { 1, 0 };
+  q63_t m00, m01, m10, m11;                      /* ar * bi of the block */
+#else
+  q31_t a0r, a0i, a1r, a1i;                      /* Samples of the two row channels */
+  q31_t b0r, b0i, b1r, b1i;                      /* Samples of the two column channels */
+#endif
+  uint32_t i, j, i1, j1, n;
+  uint32_t N = numChannels;
+
+  for (i = 0u; i < N; i += 2u)
+  {
+    /* an odd last channel is paired with itself, the extra sums are dropped */
+    i1 = (i + 1u < N) ? i + 1u : i;
+
+    for (j = i; j < N; j += 2u)
+    {
+      j1 = (j + 1u < N) ? j + 1u : j;
+      r00 = r01 = r10 = r11 = 0;
+      i00 = i01 = i10 = i11 = 0;
+      pIn = pSrc;
+
+#if defined (USE_DSP_RISCV)
+      m00 = m01 = m10 = m11 = 0;
+
+      for (n = numSamples; n > 0u; n--)
+      {
+        a0 = *(shortV *) (pIn + 2u * i);
+        a1 = *(shortV *) (pIn + 2u * i1);
+        b0 = *(shortV *) (pIn + 2u * j);
+        b1 = *(shortV *) (pIn + 2u * j1);
+        b0s = shufflev4(b0, b0, swap);
+        b1s = shufflev4(b1, b1, swap);
+
+        r00 += dotpv2(a0, b0);
+        r01 += dotpv2(a0, b1);
+        r10 += dotpv2(a1, b0);
+        r11 += dotpv2(a1, b1);
+        i00 += dotpv2(a0, b0s);
+        i01 += dotpv2(a0, b1s);
+        i10 += dotpv2(a1, b0s);
+        i11 += dotpv2(a1, b1s);
+        m00 += (q31_t) a0[0] * b0[1];
+        m01 += (q31_t) a0[0] * b1[1];
+        m10 += (q31_t) a1[0] * b0[1];
+        m11 += (q31_t) a1[0] * b1[1];
+        pIn += 2u * N;
+      }
+
+      i00 -= m00 << 1;
+      i01 -= m01 << 1;
+      i10 -= m10 << 1;
+      i11 -= m11 << 1;
+#else
+      for (n = numSamples; n > 0u; n--)
+      {
+        a0r = pIn[2u * i];
+        a0i = pIn[2u * i + 1u];
+        a1r = pIn[2u * i1];
+        a1i = pIn[2u * i1 + 1u];
+        b0r = pIn[2u * j];
+        b0i = pIn[2u * j + 1u];
+        b1r = pIn[2u * j1];
+        b1i = pIn[2u * j1 + 1u];
+
+        /* a * conj(b), each product in 2.30 */
+        r00 += (q63_t) (a0r * b0r) + (a0i * b0i);
+        i00 += (q63_t) (a0i * b0r) - (a0r * b0i);
+        r01 += (q63_t) (a0r * b1r) + (a0i * b1i);
+        i01 += (q63_t) (a0i * b1r) - (a0r * b1i);
+        r10 += (q63_t) (a1r * b0r) + (a1i * b0i);
+        i10 += (q63_t) (a1i * b0r) - (a1r * b0i);
+        r11 += (q63_t) (a1r * b1r) + (a1i * b1i);
+        i11 += (q63_t) (a1i * b1r) - (a1r * b1i);
+        pIn += 2u * N;
+      }
+#endif
+
+      riscv_cmplx_covariance_store_q15(pCov, N, i, j, r00, i00, lambda);
+      if(j1 != j)
+      {
+        riscv_cmplx_covariance_store_q15(pCov, N, i, j1, r01, i01, lambda);
+      }
+      if((i1 != i) && (j != i))
+      {
+        riscv_cmplx_covariance_store_q15(pCov, N, i1, j, r10, i10, lambda);
+      }
+      if((i1 != i) && (j1 != j))
+      {
+        riscv_cmplx_covariance_store_q15(pCov, N, i1, j1, r11, i11, lambda);
+      }
+    }
+  }
+}
+
+/**
+ * @} end of Covariance group
+ */
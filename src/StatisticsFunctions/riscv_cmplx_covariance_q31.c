@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cmplx_covariance_q31.c
+*
+* Description:  Sample covariance matrix of multi-channel complex Q31 data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* lambda * c with lambda in 1.31 format, the high and low parts of c apart */
+static q63_t riscv_cmplx_covariance_scale_q31(
+  q63_t c,
+  q31_t lambda)
+{
+  return (((c >> 31) * lambda) + (((c & 0x7FFFFFFF) * lambda) >> 31));
+}
+
+/* Updates element (r, c) with the sum re + j*im and element (c, r) with its conjugate */
+static void riscv_cmplx_covariance_store_q31(
+  q63_t * pCov,
+  uint32_t N,
+  uint32_t r,
+  uint32_t c,
+  q63_t re,
+  q63_t im,
+  q31_t lambda)
+{
+  q63_t *pU = pCov + 2u * (r * N + c);
+  q63_t *pL = pCov + 2u * (c * N + r);
+
+  if(lambda == 0x7FFFFFFF)
+  {
+    re += pU[0];
+    im += pU[1];
+  }
+  else if(lambda != 0)
+  {
+    re += riscv_cmplx_covariance_scale_q31(pU[0], lambda);
+    im += riscv_cmplx_covariance_scale_q31(pU[1], lambda);
+  }
+  if(r == c)
+  {
+    /* the diagonal is real */
+    im = 0;
+  }
+
+  pU[0] = re;
+  pU[1] = im;
+  pL[0] = re;
+  pL[1] = -im;
+}
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Covariance
+ * @{
+ */
+
+/**
+ * @brief Covariance matrix of Q31 complex channel-interleaved data.
+ * @param[in]       *pSrc points to <code>numSamples</code> frames of <code>numChannels</code> complex samples
+ * @param[in]       numChannels number of channels
+ * @param[in]       numSamples number of frames
+ * @param[in]       lambda forgetting factor in 1.31 format applied to <code>pCov</code>, 0 to overwrite it
+ * @param[in,out]   *pCov points to the <code>numChannels*numChannels</code> complex matrix
+ * @return none.
+ *
+ * \par
+ * Element <code>(i, j)</code> is the sum of <code>x_i[n] * conj(x_j[n])</code>, the matrix is
+ * Hermitian with a real diagonal.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each 2.62 product is truncated to 2.48 format, as in riscv_cmplx_dot_prod_q31(), and summed in
+ * 64-bit accumulators.  The matrix is in 16.48 format, there is no risk of overflow for fewer
+ * than 2^13 frames.  <code>lambda</code> scales the previous matrix with truncation, 0x7FFFFFFF
+ * leaves it unscaled.
+ */
+
+void riscv_cmplx_covariance_q31(
+  const q31_t * pSrc,
+  uint16_t numChannels,
+  uint32_t numSamples,
+  q31_t lambda,
+  q63_t * pCov)
+{
+  RISCV_PROFILE(riscv_cmplx_covariance_q31);
+  const q31_t *pIn;
+  q63_t a0r, a0i, a1r, a1i;                      /* Samples of the two row channels */
+  q63_t b0r, b0i, b1r, b1i;                      /* Samples of the two column channels */
+  q63_t r00, r01, r10, r11;                      /* Real parts of the block */
+  q63_t i00, i01, i10, i11;                      /* Imaginary parts of the block */
+  uint32_t i, j, i1, j1, n;
+  uint32_t N = numChannels;
+
+  for (i = 0u; i < N; i += 2u)
+  {
+    /* an odd last channel is paired with itself, the extra sums are dropped */
+    i1 = (i + 1u < N) ? i + 1u : i;
+
+    for (j = i; j < N; j += 2u)
+    {
+      j1 = (j + 1u < N) ? j + 1u : j;
+      r00 = r01 = r10 = r11 = 0;
+      i00 = i01 = i10 = i11 = 0;
+      pIn = pSrc;
+
+      for (n = numSamples; n > 0u; n--)
+      {
+        a0r = pIn[2u * i];
+        a0i = pIn[2u * i + 1u];
+        a1r = pIn[2u * i1];
+        a1i = pIn[2u * i1 + 1u];
+        b0r = pIn[2u * j];
+        b0i = pIn[2u * j + 1u];
+        b1r = pIn[2u * j1];
+        b1i = pIn[2u * j1 + 1u];
+
+        /* a * conj(b) */
+        r00 += ((a0r * b0r) >> 14u) + ((a0i * b0i) >> 14u);
+        i00 += ((a0i * b0r) >> 14u) - ((a0r * b0i) >> 14u);
+        r01 += ((a0r * b1r) >> 14u) + ((a0i * b1i) >> 14u);
+        i01 += ((a0i * b1r) >> 14u) - ((a0r * b1i) >> 14u);
+        r10 += ((a1r * b0r) >> 14u) + ((a1i * b0i) >> 14u);
+        i10 += ((a1i * b0r) >> 14u) - ((a1r * b0i) >> 14u);
+        r11 += ((a1r * b1r) >> 14u) + ((a1i * b1i) >> 14u);
+        i11 += ((a1i * b1r) >> 14u) - ((a1r * b1i) >> 14u);
+        pIn += 2u * N;
+      }
+
+      riscv_cmplx_covariance_store_q31(pCov, N, i, j, r00, i00, lambda);
+      if(j1 != j)
+      {
+        riscv_cmplx_covariance_store_q31(pCov, N, i, j1, r01, i01, lambda);
+      }
+      if((i1 != i) && (j != i))
+      {
+        riscv_cmplx_covariance_store_q31(pCov, N, i1, j, r10, i10, lambda);
+      }
+      if((i1 != i) && (j1 != j))
+      {
+        riscv_cmplx_covariance_store_q31(pCov, N, i1, j1, r11, i11, lambda);
+      }
+    }
+  }
+}
+
+/**
+ * @} end of Covariance group
+ */
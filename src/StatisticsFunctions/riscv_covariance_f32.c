@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_covariance_f32.c
+*
+* Description:  Sample covariance matrix of multi-channel floating-point data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Covariance Covariance Matrix
+ *
+ * Sample covariance, or correlation, matrix of <code>numChannels</code> channels, the input of
+ * beamformers (MVDR, MUSIC) and of principal component analysis.  The input holds
+ * <code>numSamples</code> frames of one sample per channel, channel-interleaved as a multichannel
+ * ADC or I2S TDM stream delivers them:
+ * <pre>
+ *     pSrc[n * numChannels + c]      sample n of channel c
+ *     pCov[i * numChannels + j] = lambda * pCov[i * numChannels + j] + sum_n x_i[n] * x_j[n]
+ * </pre>
+ * The complex functions take complex interleaved samples and form <code>x_i[n] * conj(x_j[n])</code>,
+ * the output is a <code>numChannels</code> by <code>numChannels</code> complex matrix.
+ * \par
+ * The functions make one pass over the data per 2x2 block of the upper triangle, four
+ * accumulators in registers for two channels against two others, so every sample is loaded
+ * <code>numChannels/2</code> times instead of <code>numChannels</code> times with one
+ * riscv_dot_prod_f32() per pair after a de-interleave.  The lower triangle is the mirror of
+ * the upper one, conjugated for the complex functions.
+ * \par
+ * <code>lambda</code> is the forgetting factor of a running estimate updated block by block:
+ * 0 computes the covariance of the block alone and does not read <code>pCov</code>, 1 (0x7FFF,
+ * 0x7FFFFFFF in fixed-point) accumulates without forgetting.  The functions do not remove the
+ * mean and do not divide by the number of samples; subtract the mean first with riscv_mean_f32()
+ * and riscv_offset_f32() per channel if the data is not zero-mean.
+ */
+
+/**
+ * @addtogroup Covariance
+ * @{
+ */
+
+/**
+ * @brief Covariance matrix of floating-point channel-interleaved data.
+ * @param[in]       *pSrc points to <code>numSamples</code> frames of <code>numChannels</code> samples
+ * @param[in]       numChannels number of channels
+ * @param[in]       numSamples number of frames
+ * @param[in]       lambda forgetting factor applied to <code>pCov</code>, 0 to overwrite it
+ * @param[in,out]   *pCov points to the <code>numChannels*numChannels</code> matrix
+ * @return none.
+ */
+
+void riscv_covariance_f32(
+  const float32_t * pSrc,
+  uint16_t numChannels,
+  uint32_t numSamples,
+  float32_t lambda,
+  float32_t * pCov)
+{
+  RISCV_PROFILE(riscv_covariance_f32);
+  const float32_t *pIn;
+  float32_t a0, a1, b0, b1;                      /* Samples of the two row and the two column channels */
+  float32_t s00, s01, s10, s11;                  /* Accumulators of the block */
+  float32_t c;
+  uint32_t i, j, i1, j1, n;
+  uint32_t N = numChannels;
+
+  for (i = 0u; i < N; i += 2u)
+  {
+    /* an odd last channel is paired with itself, the extra sums are dropped */
+    i1 = (i + 1u < N) ? i + 1u : i;
+
+    for (j = i; j < N; j += 2u)
+    {
+      j1 = (j + 1u < N) ? j + 1u : j;
+      s00 = s01 = s10 = s11 = 0.0f;
+      pIn = pSrc;
+
+      for (n = numSamples; n > 0u; n--)
+      {
+        a0 = pIn[i];
+        a1 = pIn[i1];
+        b0 = pIn[j];
+        b1 = pIn[j1];
+        s00 += a0 * b0;
+        s01 += a0 * b1;
+        s10 += a1 * b0;
+        s11 += a1 * b1;
+        pIn += N;
+      }
+
+      c = (lambda == 0.0f) ? s00 : lambda * pCov[i * N + j] + s00;
+      pCov[i * N + j] = c;
+      pCov[j * N + i] = c;
+      if(j1 != j)
+      {
+        c = (lambda == 0.0f) ? s01 : lambda * pCov[i * N + j1] + s01;
+        pCov[i * N + j1] = c;
+        pCov[j1 * N + i] = c;
+      }
+      if((i1 != i) && (j != i))
+      {
+        c = (lambda == 0.0f) ? s10 : lambda * pCov[i1 * N + j] + s10;
+        pCov[i1 * N + j] = c;
+        pCov[j * N + i1] = c;
+      }
+      if((i1 != i) && (j1 != j))
+      {
+        c = (lambda == 0.0f) ? s11 : lambda * pCov[i1 * N + j1] + s11;
+        pCov[i1 * N + j1] = c;
+        pCov[j1 * N + i1] = c;
+      }
+    }
+  }
+}
+
+/**
+ * @} end of Covariance group
+ */
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_covariance_q15.c
+*
+* Description:  Sample covariance matrix of multi-channel Q15 data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* lambda * c + s with lambda in 1.15 format, 0x7FFF taken as exactly 1 */
+static q63_t riscv_covariance_update_q15(
+  q63_t c,
+  q63_t s,
+  q15_t lambda)
+{
+  if(lambda == 0x7FFF)
+  {
+    return (c + s);
+  }
+
+  /* high and low parts of c apart, c * lambda does not fit in 64 bits */
+  return (((c >> 15) * lambda) + (((c & 0x7FFF) * lambda) >> 15) + s);
+}
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Covariance
+ * @{
+ */
+
+/**
+ * @brief Covariance matrix of Q15 channel-interleaved data.
+ * @param[in]       *pSrc points to <code>numSamples</code> frames of <code>numChannels</code> samples
+ * @param[in]       numChannels number of channels
+ * @param[in]       numSamples number of frames
+ * @param[in]       lambda forgetting factor in 1.15 format applied to <code>pCov</code>, 0 to overwrite it
+ * @param[in,out]   *pCov points to the <code>numChannels*numChannels</code> matrix
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are in 2.30 format, summed in 64-bit accumulators.  The matrix is in 34.30
+ * format, exact for any practical <code>numSamples</code>.  <code>lambda</code> scales the
+ * previous matrix with truncation, 0x7FFF leaves it unscaled.
+ * \par
+ * With the xpulp extensions and an even <code>numChannels</code> the samples of two channels are
+ * loaded as one word and each 2x2 block takes two dotpv2 and two multiplications per frame.  The
+ * result is the same unless the four samples of a block in one frame are all -1.0, whose pair
+ * product 2.0 wraps in the 32-bit dotpv2.
+ */
+
+void riscv_covariance_q15(
+  const q15_t * pSrc,
+  uint16_t numChannels,
+  uint32_t numSamples,
+  q15_t lambda,
+  q63_t * pCov)
+{
+  RISCV_PROFILE(riscv_covariance_q15);
+  const q15_t *pIn;
+  q63_t s00, s01, s10, s11;                      /* Accumulators of the block */
+  q63_t c;
+  uint32_t i, j, i1, j1, n;
+  uint32_t N = numChannels;
+#if defined (USE_DSP_RISCV)
+  shortV vecA, vecB;
+  shortV swap = { 1, 0 };
+  q63_t d, e;                                    /* s00 + s11 and s01 + s10 */
+#else
+  q31_t a0, a1, b0, b1;
+#endif
+
+  for (i = 0u; i < N; i += 2u)
+  {
+    /* an odd last channel is paired with itself, the extra sums are dropped */
+    i1 = (i + 1u < N) ? i + 1u : i;
+
+    for (j = i; j < N; j += 2u)
+    {
+      j1 = (j + 1u < N) ? j + 1u : j;
+      s00 = s01 = s10 = s11 = 0;
+      pIn = pSrc;
+
+#if defined (USE_DSP_RISCV)
+      if((N & 1u) == 0u)
+      {
+        d = e = 0;
+
+        for (n = numSamples; n > 0u; n--)
+        {
+          vecA = *(shortV *) (pIn + i);
+          vecB = *(shortV *) (pIn + j);
+          d += dotpv2(vecA, vecB);
+          e += dotpv2(vecA, shufflev4(vecB, vecB, swap));
+          s00 += (q31_t) vecA[0] * vecB[0];
+          s01 += (q31_t) vecA[0] * vecB[1];
+          pIn += N;
+        }
+
+        s11 = d - s00;
+        s10 = e - s01;
+      }
+      else
+      {
+        for (n = numSamples; n > 0u; n--)
+        {
+          s00 += (q31_t) pIn[i] * pIn[j];
+          s01 += (q31_t) pIn[i] * pIn[j1];
+          s10 += (q31_t) pIn[i1] * pIn[j];
+          s11 += (q31_t) pIn[i1] * pIn[j1];
+          pIn += N;
+        }
+      }
+#else
+      for (n = numSamples; n > 0u; n--)
+      {
+        a0 = pIn[i];
+        a1 = pIn[i1];
+        b0 = pIn[j];
+        b1 = pIn[j1];
+        s00 += (q63_t) (a0 * b0);
+        s01 += (q63_t) (a0 * b1);
+        s10 += (q63_t) (a1 * b0);
+        s11 += (q63_t) (a1 * b1);
+        pIn += N;
+      }
+#endif
+
+      c = (lambda == 0) ? s00 : riscv_covariance_update_q15(pCov[i * N + j], s00, lambda);
+      pCov[i * N + j] = c;
+      pCov[j * N + i] = c;
+      if(j1 != j)
+      {
+        c = (lambda == 0) ? s01 : riscv_covariance_update_q15(pCov[i * N + j1], s01, lambda);
+        pCov[i * N + j1] = c;
+        pCov[j1 * N + i] = c;
+      }
+      if((i1 != i) && (j != i))
+      {
+        c = (lambda == 0) ? s10 : riscv_covariance_update_q15(pCov[i1 * N + j], s10, lambda);
+        pCov[i1 * N + j] = c;
+        pCov[j * N + i1] = c;
+      }
+      if((i1 != i) && (j1 != j))
+      {
+        c = (lambda == 0) ? s11 : riscv_covariance_update_q15(pCov[i1 * N + j1], s11, lambda);
+        pCov[i1 * N + j1] = c;
+        pCov[j1 * N + i1] = c;
+      }
+    }
+  }
+}
+
+/**
+ * @} end of Covariance group
+ */
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_covariance_q31.c
+*
+* Description:  Sample covariance matrix of multi-channel Q31 data.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* lambda * c + s with lambda in 1.31 format, 0x7FFFFFFF taken as exactly 1 */
+static q63_t riscv_covariance_update_q31(
+  q63_t c,
+  q63_t s,
+  q31_t lambda)
+{
+  if(lambda == 0x7FFFFFFF)
+  {
+    return (c + s);
+  }
+
+  /* high and low parts of c apart, c * lambda does not fit in 64 bits */
+  return (((c >> 31) * lambda) + (((c & 0x7FFFFFFF) * lambda) >> 31) + s);
+}
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Covariance
+ * @{
+ */
+
+/**
+ * @brief Covariance matrix of Q31 channel-interleaved data.
+ * @param[in]       *pSrc points to <code>numSamples</code> frames of <code>numChannels</code> samples
+ * @param[in]       numChannels number of channels
+ * @param[in]       numSamples number of frames
+ * @param[in]       lambda forgetting factor in 1.31 format applied to <code>pCov</code>, 0 to overwrite it
+ * @param[in,out]   *pCov points to the <code>numChannels*numChannels</code> matrix
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 2.62 products are truncated to 2.48 format, as in riscv_dot_prod_q31(), and summed in
+ * 64-bit accumulators.  The matrix is in 16.48 format, there is no risk of overflow for fewer
+ * than 2^14 frames.  <code>lambda</code> scales the previous matrix with truncation, 0x7FFFFFFF
+ * leaves it unscaled.
+ */
+
+void riscv_covariance_q31(
+  const q31_t * pSrc,
+  uint16_t numChannels,
+  uint32_t numSamples,
+  q31_t lambda,
+  q63_t * pCov)
+{
+  RISCV_PROFILE(riscv_covariance_q31);
+  const q31_t *pIn;
+  q63_t a0, a1, b0, b1;                          /* Samples of the two row and the two column channels */
+  q63_t s00, s01, s10, s11;                      /* Accumulators of the block */
+  q63_t c;
+  uint32_t i, j, i1, j1, n;
+  uint32_t N = numChannels;
+
+  for (i = 0u; i < N; i += 2u)
+  {
+    /* an odd last channel is paired with itself, the extra sums are dropped */
+    i1 = (i + 1u < N) ? i + 1u : i;
+
+    for (j = i; j < N; j += 2u)
+    {
+      j1 = (j + 1u < N) ? j + 1u : j;
+      s00 = s01 = s10 = s11 = 0;
+      pIn = pSrc;
+
+      for (n = numSamples; n > 0u; n--)
+      {
+        a0 = pIn[i];
+        a1 = pIn[i1];
+        b0 = pIn[j];
+        b1 = pIn[j1];
+        s00 += (a0 * b0) >> 14u;
+        s01 += (a0 * b1) >> 14u;
+        s10 += (a1 * b0) >> 14u;
+        s11 += (a1 * b1) >> 14u;
+        pIn += N;
+      }
+
+      c = (lambda == 0) ? s00 : riscv_covariance_update_q31(pCov[i * N + j], s00, lambda);
+      pCov[i * N + j] = c;
+      pCov[j * N + i] = c;
+      if(j1 != j)
+      {
+        c = (lambda == 0) ? s01 : riscv_covariance_update_q31(pCov[i * N + j1], s01, lambda);
+        pCov[i * N + j1] = c;
+        pCov[j1 * N + i] = c;
+      }
+      if((i1 != i) && (j != i))
+      {
+        c = (lambda == 0) ? s10 : riscv_covariance_update_q31(pCov[i1 * N + j], s10, lambda);
+        pCov[i1 * N + j] = c;
+        pCov[j * N + i1] = c;
+      }
+      if((i1 != i) && (j1 != j))
+      {
+        c = (lambda == 0) ? s11 : riscv_covariance_update_q31(pCov[i1 * N + j1], s11, lambda);
+        pCov[i1 * N + j1] = c;
+        pCov[j1 * N + i1] = c;
+      }
+    }
+  }
+}
+
+/**
+ * @} end of Covariance group
+ */
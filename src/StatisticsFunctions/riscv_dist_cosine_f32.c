@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dist_cosine_f32.c
+*
+* Description:  Cosine similarity of a floating-point vector to many templates.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* Inserts similarity d of template index among the n most similar kept so far, most similar first */
+static void riscv_dist_keep_max_f32(
+  float32_t d,
+  uint32_t index,
+  uint32_t k,
+  uint32_t n,
+  float32_t * pDist,
+  uint32_t * pIndex)
+{
+  uint32_t j;
+
+  if(n == k)
+  {
+    if(d <= pDist[k - 1u])
+    {
+      return;
+    }
+    n--;
+  }
+
+  for (j = n; (j > 0u) && (pDist[j - 1u] < d); j--)
+  {
+    pDist[j] = pDist[j - 1u];
+    pIndex[j] = pIndex[j - 1u];
+  }
+
+  pDist[j] = d;
+  pIndex[j] = index;
+}
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Distance
+ * @{
+ */
+
+/**
+ * @brief Cosine similarity of a floating-point vector to every template, or to the k most similar.
+ * @param[in]       *pVec points to the vector of <code>dim</code> elements
+ * @param[in]       *pTemplates points to <code>numTemplates</code> templates of <code>dim</code> elements, one after the other
+ * @param[in]       dim number of elements of the vector and of each template
+ * @param[in]       numTemplates number of templates
+ * @param[in]       k number of most similar templates to keep, 0 for all the similarities
+ * @param[out]      *pDist points to the similarities, <code>numTemplates</code> of them or the <code>k</code> largest
+ * @param[out]      *pIndex points to the <code>k</code> indices of the most similar templates, unused when <code>k</code> is 0
+ * @return the number of similarities written.
+ *
+ * \par
+ * The similarity is <code>a.b / (|a| |b|)</code>, 0 when the vector or the template is 0.
+ */
+
+uint32_t riscv_dist_cosine_f32(
+  const float32_t * pVec,
+  const float32_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  float32_t * pDist,
+  uint32_t * pIndex)
+{
+  RISCV_PROFILE(riscv_dist_cosine_f32);
+  const float32_t *pA, *pB = pTemplates;         /* Vector and template */
+  float32_t aa = 0.0f, ab, bb;                   /* |a|^2, a.b and |b|^2 */
+  float32_t a, b, sim;
+  uint32_t t, blkCnt;                            /* Loop counters */
+
+  pA = pVec;
+  for (blkCnt = dim; blkCnt > 0u; blkCnt--)
+  {
+    a = *pA++;
+    aa += a * a;
+  }
+
+  for (t = 0u; t < numTemplates; t++)
+  {
+    pA = pVec;
+    ab = 0.0f;
+    bb = 0.0f;
+
+    for (blkCnt = dim; blkCnt > 0u; blkCnt--)
+    {
+      a = *pA++;
+      b = *pB++;
+      bb += b * b;
+      ab += a * b;
+    }
+
+    sim = ((aa > 0.0f) && (bb > 0.0f)) ? (ab / (sqrtf(aa) * sqrtf(bb))) : 0.0f;
+
+    if(k == 0u)
+    {
+      pDist[t] = sim;
+    }
+    else
+    {
+      riscv_dist_keep_max_f32(sim, t, k, (t < k) ? t : k, pDist, pIndex);
+    }
+  }
+
+  return ((k == 0u) || (numTemplates < k)) ? numTemplates : k;
+}
+
+/**
+ * @} end of Distance group
+ */
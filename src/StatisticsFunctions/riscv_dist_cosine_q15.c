@@ -0,0 +1,229 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dist_cosine_q15.c
+*
+* Description:  Cosine similarity of a Q15 vector to many templates.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* Inserts similarity d of template index among the n most similar kept so far, most similar first */
+static void riscv_dist_keep_max_q15(
+  q15_t d,
+  uint32_t index,
+  uint32_t k,
+  uint32_t n,
+  q15_t * pDist,
+  uint32_t * pIndex)
+{
+  uint32_t j;
+
+  if(n == k)
+  {
+    if(d <= pDist[k - 1u])
+    {
+      return;
+    }
+    n--;
+  }
+
+  for (j = n; (j > 0u) && (pDist[j - 1u] < d); j--)
+  {
+    pDist[j] = pDist[j - 1u];
+    pIndex[j] = pIndex[j - 1u];
+  }
+
+  pDist[j] = d;
+  pIndex[j] = index;
+}
+
+/* Integer square root, floor(sqrt(x)) */
+static uint32_t riscv_dist_isqrt_u32(
+  uint32_t x)
+{
+  uint32_t r = 0u, b = 1u << 30;
+
+  while(b > x)
+  {
+    b >>= 2u;
+  }
+
+  while(b != 0u)
+  {
+    if(x >= (r + b))
+    {
+      x -= r + b;
+      r = (r >> 1u) + b;
+    }
+    else
+    {
+      r >>= 1u;
+    }
+    b >>= 2u;
+  }
+
+  return (r);
+}
+
+/* Scales x > 0 by 4^s to 61 or 62 bits, returns its square root to 16 bits and adds s to *pShift */
+static uint32_t riscv_dist_norm_u64(
+  uint64_t x,
+  uint32_t * pShift)
+{
+  while(x < ((uint64_t) 1u << 60))
+  {
+    x <<= 2u;
+    (*pShift)++;
+  }
+
+  return (riscv_dist_isqrt_u32((uint32_t) (x >> 30u)) << 15u);
+}
+
+/* ab / (|a| |b|) in 1.15, |a| = sa / 2^shiftA and bb = |b|^2 */
+static q15_t riscv_dist_cosine_ratio_q15(
+  q63_t ab,
+  uint32_t sa,
+  uint32_t shiftA,
+  q63_t bb)
+{
+  uint32_t s = shiftA;
+  uint64_t den;
+  q63_t num;
+
+  if((sa == 0u) || (bb == 0))
+  {
+    return (0);
+  }
+
+  /* |ab| 2^s <= |a| |b| 2^s < 2^62 */
+  den = ((uint64_t) sa * riscv_dist_norm_u64((uint64_t) bb, &s)) >> 15u;
+  num = (ab * ((q63_t) 1 << s)) / (q63_t) den;
+
+  return ((num > 0x7FFF) ? 0x7FFF : ((num < -0x8000) ? -0x8000 : (q15_t) num));
+}
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Distance
+ * @{
+ */
+
+/**
+ * @brief Cosine similarity of a Q15 vector to every template, or to the k most similar.
+ * @param[in]       *pVec points to the vector of <code>dim</code> elements
+ * @param[in]       *pTemplates points to <code>numTemplates</code> templates of <code>dim</code> elements, one after the other
+ * @param[in]       dim number of elements of the vector and of each template
+ * @param[in]       numTemplates number of templates
+ * @param[in]       k number of most similar templates to keep, 0 for all the similarities
+ * @param[out]      *pDist points to the similarities, <code>numTemplates</code> of them or the <code>k</code> largest
+ * @param[out]      *pIndex points to the <code>k</code> indices of the most similar templates, unused when <code>k</code> is 0
+ * @return the number of similarities written.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * <code>a.b</code>, <code>|a|^2</code> and <code>|b|^2</code> are summed in 34.30 format in 64-bit
+ * accumulators, <code>|a|^2</code> and its square root once per call.  The similarity <code>a.b / (|a| |b|)</code> is
+ * computed with an integer square root and a 64-bit division, without floating-point, and is
+ * returned in 1.15 format, 1.0 saturated to 0x7FFF.  It is 0 when the vector or the template is 0.
+ * \par
+ * With the xpulp extensions the sums take two dotpv2 per pair of elements of the template.
+ */
+
+uint32_t riscv_dist_cosine_q15(
+  const q15_t * pVec,
+  const q15_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  q15_t * pDist,
+  uint32_t * pIndex)
+{
+  RISCV_PROFILE(riscv_dist_cosine_q15);
+  const q15_t *pA, *pB = pTemplates;             /* Vector and template */
+  q63_t aa = 0, ab, bb;                          /* |a|^2, a.b and |b|^2 */
+  q31_t a, b;
+  uint32_t sa = 0u, shiftA = 0u;                 /* |a| scaled by 2^shiftA */
+  q15_t sim;
+  uint32_t t, blkCnt;                            /* Loop counters */
+  pA = pVec;
+
+#if defined (USE_DSP_RISCV)
+  shortV vecA, vecB;
+
+  for (blkCnt = dim >> 1u; blkCnt > 0u; blkCnt--)
+  {
+    vecA = *(shortV *) pA;
+    aa += (uint32_t) dotpv2(vecA, vecA);
+    pA += 2;
+  }
+  blkCnt = dim & 1u;
+#else
+  blkCnt = dim;
+#endif
+
+  while(blkCnt > 0u)
+  {
+    a = *pA++;
+    aa += a * a;
+    blkCnt--;
+  }
+
+  if(aa != 0)
+  {
+    sa = riscv_dist_norm_u64((uint64_t) aa, &shiftA);
+  }
+
+  for (t = 0u; t < numTemplates; t++)
+  {
+    pA = pVec;
+    ab = 0;
+    bb = 0;
+
+#if defined (USE_DSP_RISCV)
+    for (blkCnt = dim >> 1u; blkCnt > 0u; blkCnt--)
+    {
+      vecA = *(shortV *) pA;
+      vecB = *(shortV *) pB;
+      /* |b|^2 is not negative, the unsigned view is exact up to 2.0 */
+      bb += (uint32_t) dotpv2(vecB, vecB);
+      ab += dotpv2(vecA, vecB);
+      pA += 2;
+      pB += 2;
+    }
+    blkCnt = dim & 1u;
+#else
+    blkCnt = dim;
+#endif
+
+    while(blkCnt > 0u)
+    {
+      a = *pA++;
+      b = *pB++;
+      bb += b * b;
+      ab += a * b;
+      blkCnt--;
+    }
+
+    sim = riscv_dist_cosine_ratio_q15(ab, sa, shiftA, bb);
+
+    if(k == 0u)
+    {
+      pDist[t] = sim;
+    }
+    else
+    {
+      riscv_dist_keep_max_q15(sim, t, k, (t < k) ? t : k, pDist, pIndex);
+    }
+  }
+
+  return ((k == 0u) || (numTemplates < k)) ? numTemplates : k;
+}
+
+/**
+ * @} end of Distance group
+ */
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dist_hamming_u32.c
+*
+* Description:  Hamming distance of a packed bit vector to many templates.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* Inserts distance d of template index among the n nearest kept so far, nearest first */
+static void riscv_dist_keep_u32(
+  uint32_t d,
+  uint32_t index,
+  uint32_t k,
+  uint32_t n,
+  uint32_t * pDist,
+  uint32_t * pIndex)
+{
+  uint32_t j;
+
+  if(n == k)
+  {
+    if(d >= pDist[k - 1u])
+    {
+      return;
+    }
+    n--;
+  }
+
+  for (j = n; (j > 0u) && (pDist[j - 1u] > d); j--)
+  {
+    pDist[j] = pDist[j - 1u];
+    pIndex[j] = pIndex[j - 1u];
+  }
+
+  pDist[j] = d;
+  pIndex[j] = index;
+}
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Distance
+ * @{
+ */
+
+/**
+ * @brief Hamming distance of a packed bit vector to every template, or to the k nearest.
+ * @param[in]       *pVec points to the vector of <code>numWords</code> 32-bit words
+ * @param[in]       *pTemplates points to <code>numTemplates</code> templates of <code>numWords</code> words, one after the other
+ * @param[in]       numWords number of words of the vector and of each template
+ * @param[in]       numTemplates number of templates
+ * @param[in]       k number of nearest templates to keep, 0 for all the distances
+ * @param[out]      *pDist points to the distances, <code>numTemplates</code> of them or the <code>k</code> smallest
+ * @param[out]      *pIndex points to the <code>k</code> indices of the nearest templates, unused when <code>k</code> is 0
+ * @return the number of distances written.
+ *
+ * \par
+ * The distance is the number of bits that differ, the population count of the exclusive or of
+ * every word.  Unused bits of the last word must be equal, 0 for instance, in the vector and the
+ * templates.  __builtin_popcount() maps to p.cnt with the xpulp extensions and to the libgcc
+ * bit count otherwise.
+ */
+
+uint32_t riscv_dist_hamming_u32(
+  const uint32_t * pVec,
+  const uint32_t * pTemplates,
+  uint32_t numWords,
+  uint32_t numTemplates,
+  uint32_t k,
+  uint32_t * pDist,
+  uint32_t * pIndex)
+{
+  RISCV_PROFILE(riscv_dist_hamming_u32);
+  const uint32_t *pA, *pB = pTemplates;          /* Vector and template */
+  uint32_t sum;                                  /* Accumulator */
+  uint32_t t, blkCnt;                            /* Loop counters */
+
+  for (t = 0u; t < numTemplates; t++)
+  {
+    pA = pVec;
+    sum = 0u;
+
+    for (blkCnt = numWords; blkCnt > 0u; blkCnt--)
+    {
+      sum += (uint32_t) __builtin_popcount(*pA++ ^ *pB++);
+    }
+
+    if(k == 0u)
+    {
+      pDist[t] = sum;
+    }
+    else
+    {
+      riscv_dist_keep_u32(sum, t, k, (t < k) ? t : k, pDist, pIndex);
+    }
+  }
+
+  return ((k == 0u) || (numTemplates < k)) ? numTemplates : k;
+}
+
+/**
+ * @} end of Distance group
+ */
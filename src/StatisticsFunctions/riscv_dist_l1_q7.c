@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dist_l1_q7.c
+*
+* Description:  Manhattan distance of a Q7 vector to many templates.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* Inserts distance d of template index among the n nearest kept so far, nearest first */
+static void riscv_dist_keep_q31(
+  q31_t d,
+  uint32_t index,
+  uint32_t k,
+  uint32_t n,
+  q31_t * pDist,
+  uint32_t * pIndex)
+{
+  uint32_t j;
+
+  if(n == k)
+  {
+    if(d >= pDist[k - 1u])
+    {
+      return;
+    }
+    n--;
+  }
+
+  for (j = n; (j > 0u) && (pDist[j - 1u] > d); j--)
+  {
+    pDist[j] = pDist[j - 1u];
+    pIndex[j] = pIndex[j - 1u];
+  }
+
+  pDist[j] = d;
+  pIndex[j] = index;
+}
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Distance
+ * @{
+ */
+
+/**
+ * @brief Manhattan distance of a Q7 vector to every template, or to the k nearest.
+ * @param[in]       *pVec points to the vector of <code>dim</code> elements
+ * @param[in]       *pTemplates points to <code>numTemplates</code> templates of <code>dim</code> elements, one after the other
+ * @param[in]       dim number of elements of the vector and of each template
+ * @param[in]       numTemplates number of templates
+ * @param[in]       k number of nearest templates to keep, 0 for all the distances
+ * @param[out]      *pDist points to the distances, <code>numTemplates</code> of them or the <code>k</code> smallest
+ * @param[out]      *pIndex points to the <code>k</code> indices of the nearest templates, unused when <code>k</code> is 0
+ * @return the number of distances written.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The absolute differences are in 2.7 format, summed in a 32-bit accumulator.  The distances are
+ * in 25.7 format, exact for any practical <code>dim</code>.
+ */
+
+uint32_t riscv_dist_l1_q7(
+  const q7_t * pVec,
+  const q7_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  q31_t * pDist,
+  uint32_t * pIndex)
+{
+  RISCV_PROFILE(riscv_dist_l1_q7);
+  const q7_t *pA, *pB = pTemplates;              /* Vector and template */
+  q31_t sum, diff;                               /* Accumulator and difference */
+  uint32_t t, blkCnt;                            /* Loop counters */
+
+  for (t = 0u; t < numTemplates; t++)
+  {
+    pA = pVec;
+    sum = 0;
+
+    /* Four elements per iteration, abs maps to p.abs with the xpulp extensions */
+    for (blkCnt = dim >> 2u; blkCnt > 0u; blkCnt--)
+    {
+      diff = (q31_t) *pA++ - *pB++;
+      sum += (diff < 0) ? -diff : diff;
+      diff = (q31_t) *pA++ - *pB++;
+      sum += (diff < 0) ? -diff : diff;
+      diff = (q31_t) *pA++ - *pB++;
+      sum += (diff < 0) ? -diff : diff;
+      diff = (q31_t) *pA++ - *pB++;
+      sum += (diff < 0) ? -diff : diff;
+    }
+    for (blkCnt = dim & 3u; blkCnt > 0u; blkCnt--)
+    {
+      diff = (q31_t) *pA++ - *pB++;
+      sum += (diff < 0) ? -diff : diff;
+    }
+
+    if(k == 0u)
+    {
+      pDist[t] = sum;
+    }
+    else
+    {
+      riscv_dist_keep_q31(sum, t, k, (t < k) ? t : k, pDist, pIndex);
+    }
+  }
+
+  return ((k == 0u) || (numTemplates < k)) ? numTemplates : k;
+}
+
+/**
+ * @} end of Distance group
+ */
@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dist_l2sq_q15.c
+*
+* Description:  Squared Euclidean distance of a Q15 vector to many templates.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* Inserts distance d of template index among the n nearest kept so far, nearest first */
+static void riscv_dist_keep_q63(
+  q63_t d,
+  uint32_t index,
+  uint32_t k,
+  uint32_t n,
+  q63_t * pDist,
+  uint32_t * pIndex)
+{
+  uint32_t j;
+
+  if(n == k)
+  {
+    if(d >= pDist[k - 1u])
+    {
+      return;
+    }
+    n--;
+  }
+
+  for (j = n; (j > 0u) && (pDist[j - 1u] > d); j--)
+  {
+    pDist[j] = pDist[j - 1u];
+    pIndex[j] = pIndex[j - 1u];
+  }
+
+  pDist[j] = d;
+  pIndex[j] = index;
+}
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Distance
+ * @{
+ */
+
+/**
+ * @brief Squared Euclidean distance of a Q15 vector to every template, or to the k nearest.
+ * @param[in]       *pVec points to the vector of <code>dim</code> elements
+ * @param[in]       *pTemplates points to <code>numTemplates</code> templates of <code>dim</code> elements, one after the other
+ * @param[in]       dim number of elements of the vector and of each template
+ * @param[in]       numTemplates number of templates
+ * @param[in]       k number of nearest templates to keep, 0 for all the distances
+ * @param[out]      *pDist points to the distances, <code>numTemplates</code> of them or the <code>k</code> smallest
+ * @param[out]      *pIndex points to the <code>k</code> indices of the nearest templates, unused when <code>k</code> is 0
+ * @return the number of distances written.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The differences are in 2.15 format and their squares in 3.30 format, summed in a 64-bit
+ * accumulator.  The distances are in 34.30 format, exact for any practical <code>dim</code>.
+ * \par
+ * With the xpulp extensions the distance is computed as <code>|b|^2 - 2 a.b + |a|^2</code>, two
+ * dotpv2 per pair of elements of the template, <code>|a|^2</code> once per call.  The result is the
+ * same unless two neighbouring elements of the vector and of a template are all -1.0, whose pair
+ * product 2.0 wraps in the 32-bit dotpv2.
+ */
+
+uint32_t riscv_dist_l2sq_q15(
+  const q15_t * pVec,
+  const q15_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  q63_t * pDist,
+  uint32_t * pIndex)
+{
+  RISCV_PROFILE(riscv_dist_l2sq_q15);
+  const q15_t *pA, *pB = pTemplates;             /* Vector and template */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t t, blkCnt;                            /* Loop counters */
+#if defined (USE_DSP_RISCV)
+  q63_t aa = 0, ab;                              /* |a|^2 and a.b */
+  shortV vecA, vecB;
+  q31_t a, b;
+
+  pA = pVec;
+  for (blkCnt = dim >> 1u; blkCnt > 0u; blkCnt--)
+  {
+    vecA = *(shortV *) pA;
+    aa += (uint32_t) dotpv2(vecA, vecA);
+    pA += 2;
+  }
+  if((dim & 1u) != 0u)
+  {
+    aa += (q31_t) *pA * *pA;
+  }
+#else
+  q31_t diff;
+#endif
+
+  for (t = 0u; t < numTemplates; t++)
+  {
+    pA = pVec;
+    sum = 0;
+
+#if defined (USE_DSP_RISCV)
+    ab = 0;
+
+    for (blkCnt = dim >> 1u; blkCnt > 0u; blkCnt--)
+    {
+      vecA = *(shortV *) pA;
+      vecB = *(shortV *) pB;
+      /* |b|^2 is not negative, the unsigned view is exact up to 2.0 */
+      sum += (uint32_t) dotpv2(vecB, vecB);
+      ab += dotpv2(vecA, vecB);
+      pA += 2;
+      pB += 2;
+    }
+    if((dim & 1u) != 0u)
+    {
+      a = *pA;
+      b = *pB++;
+      sum += b * b;
+      ab += a * b;
+    }
+
+    sum += aa - (ab << 1);
+#else
+    for (blkCnt = dim; blkCnt > 0u; blkCnt--)
+    {
+      /* (a - b)^2 in 3.30 */
+      diff = (q31_t) *pA++ - *pB++;
+      sum += (q63_t) diff * diff;
+    }
+#endif
+
+    if(k == 0u)
+    {
+      pDist[t] = sum;
+    }
+    else
+    {
+      riscv_dist_keep_q63(sum, t, k, (t < k) ? t : k, pDist, pIndex);
+    }
+  }
+
+  return ((k == 0u) || (numTemplates < k)) ? numTemplates : k;
+}
+
+/**
+ * @} end of Distance group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dist_l2sq_q7.c
+*
+* Description:  Squared Euclidean distance of a Q7 vector to many templates.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* Inserts distance d of template index among the n nearest kept so far, nearest first */
+static void riscv_dist_keep_q31(
+  q31_t d,
+  uint32_t index,
+  uint32_t k,
+  uint32_t n,
+  q31_t * pDist,
+  uint32_t * pIndex)
+{
+  uint32_t j;
+
+  if(n == k)
+  {
+    if(d >= pDist[k - 1u])
+    {
+      return;
+    }
+    n--;
+  }
+
+  for (j = n; (j > 0u) && (pDist[j - 1u] > d); j--)
+  {
+    pDist[j] = pDist[j - 1u];
+    pIndex[j] = pIndex[j - 1u];
+  }
+
+  pDist[j] = d;
+  pIndex[j] = index;
+}
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Distance
+ * @{
+ */
+
+/**
+ * @brief Squared Euclidean distance of a Q7 vector to every template, or to the k nearest.
+ * @param[in]       *pVec points to the vector of <code>dim</code> elements
+ * @param[in]       *pTemplates points to <code>numTemplates</code> templates of <code>dim</code> elements, one after the other
+ * @param[in]       dim number of elements of the vector and of each template
+ * @param[in]       numTemplates number of templates
+ * @param[in]       k number of nearest templates to keep, 0 for all the distances
+ * @param[out]      *pDist points to the distances, <code>numTemplates</code> of them or the <code>k</code> smallest
+ * @param[out]      *pIndex points to the <code>k</code> indices of the nearest templates, unused when <code>k</code> is 0
+ * @return the number of distances written.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The differences are in 2.7 format and their squares in 3.14 format, summed in a 32-bit
+ * accumulator.  The distances are in 18.14 format, exact for <code>dim</code> below 32768.
+ * \par
+ * With the xpulp extensions the distance is computed as <code>|b|^2 - 2 a.b + |a|^2</code>, two
+ * sumdotpv4 per four elements of the template, <code>|a|^2</code> once per call.
+ */
+
+uint32_t riscv_dist_l2sq_q7(
+  const q7_t * pVec,
+  const q7_t * pTemplates,
+  uint32_t dim,
+  uint32_t numTemplates,
+  uint32_t k,
+  q31_t * pDist,
+  uint32_t * pIndex)
+{
+  RISCV_PROFILE(riscv_dist_l2sq_q7);
+  const q7_t *pA, *pB = pTemplates;              /* Vector and template */
+  q31_t sum;                                     /* Accumulator */
+  uint32_t t, blkCnt;                            /* Loop counters */
+#if defined (USE_DSP_RISCV)
+  q31_t aa = 0, ab;                              /* |a|^2 and a.b */
+  charV vecA, vecB;
+
+  pA = pVec;
+  for (blkCnt = dim >> 2u; blkCnt > 0u; blkCnt--)
+  {
+    vecA = *(charV *) pA;
+    aa = sumdotpv4(vecA, vecA, aa);
+    pA += 4;
+  }
+  for (blkCnt = dim & 3u; blkCnt > 0u; blkCnt--)
+  {
+    aa = mac(*pA, *pA, aa);
+    pA++;
+  }
+#else
+  q31_t diff;
+#endif
+
+  for (t = 0u; t < numTemplates; t++)
+  {
+    pA = pVec;
+    sum = 0;
+
+#if defined (USE_DSP_RISCV)
+    ab = 0;
+
+    for (blkCnt = dim >> 2u; blkCnt > 0u; blkCnt--)
+    {
+      vecA = *(charV *) pA;
+      vecB = *(charV *) pB;
+      sum = sumdotpv4(vecB, vecB, sum);
+      ab = sumdotpv4(vecA, vecB, ab);
+      pA += 4;
+      pB += 4;
+    }
+    for (blkCnt = dim & 3u; blkCnt > 0u; blkCnt--)
+    {
+      sum = mac(*pB, *pB, sum);
+      ab = mac(*pA++, *pB++, ab);
+    }
+
+    sum += aa - (ab << 1);
+#else
+    for (blkCnt = dim; blkCnt > 0u; blkCnt--)
+    {
+      /* (a - b)^2 in 3.14 */
+      diff = (q31_t) *pA++ - *pB++;
+      sum += diff * diff;
+    }
+#endif
+
+    if(k == 0u)
+    {
+      pDist[t] = sum;
+    }
+    else
+    {
+      riscv_dist_keep_q31(sum, t, k, (t < k) ? t : k, pDist, pIndex);
+    }
+  }
+
+  return ((k == 0u) || (numTemplates < k)) ? numTemplates : k;
+}
+
+/**
+ * @} end of Distance group
+ */
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_find_peaks_f32.c
+*
+* Description:  Floating-point peak picking above a threshold.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup CFAR
+ * @{
+ */
+
+/**
+ * @brief  Floating-point peak picking above a threshold.
+ * @param[in]   *pSrc         points to the input cells.
+ * @param[in]   blockSize     number of cells.
+ * @param[in]   *pThreshold   points to the threshold of every cell, as from riscv_cfar_ca_f32(), or NULL.
+ * @param[in]   threshold     threshold of all cells when <code>pThreshold</code> is NULL.
+ * @param[in]   minDistance   least distance between two peaks, 0 or 1 for none.
+ * @param[out]  *pIndex       points to the indices of the peaks, in increasing order.
+ * @param[in]   maxPeaks      size of the <code>pIndex</code> buffer.
+ * @return the number of peaks written to <code>pIndex</code>.
+ *
+ * \par
+ * Cell <code>i</code> is a peak when <code>x[i-1] < x[i] >= x[i+1]</code> and <code>x[i]</code> is above
+ * its threshold, the first and last cells are never peaks.  The peaks are taken in order, a peak closer
+ * than <code>minDistance</code> to the last one kept replaces it if it is higher and is dropped otherwise.
+ * The search stops when <code>maxPeaks</code> peaks are kept and the next one is not close to the last.
+ */
+
+uint32_t riscv_find_peaks_f32(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  const float32_t * pThreshold,
+  float32_t threshold,
+  uint32_t minDistance,
+  uint32_t * pIndex,
+  uint32_t maxPeaks)
+{
+  RISCV_PROFILE(riscv_find_peaks_f32);
+  uint32_t numPeaks = 0u;
+  uint32_t i;
+  float32_t x;
+
+  for (i = 1u; (i + 1u) < blockSize; i++)
+  {
+    x = pSrc[i];
+    if(pThreshold != NULL)
+    {
+      threshold = pThreshold[i];
+    }
+
+    if((x > threshold) && (x > pSrc[i - 1u]) && (x >= pSrc[i + 1u]))
+    {
+      if((numPeaks > 0u) && ((i - pIndex[numPeaks - 1u]) < minDistance))
+      {
+        /* keep the higher of two close peaks */
+        if(x > pSrc[pIndex[numPeaks - 1u]])
+        {
+          pIndex[numPeaks - 1u] = i;
+        }
+      }
+      else
+      {
+        if(numPeaks == maxPeaks)
+        {
+          break;
+        }
+        pIndex[numPeaks++] = i;
+      }
+    }
+  }
+
+  return (numPeaks);
+}
+
+/**
+ * @} end of CFAR group
+ */
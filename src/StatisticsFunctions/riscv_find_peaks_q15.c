@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_find_peaks_q15.c
+*
+* Description:  Q15 peak picking above a threshold.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup CFAR
+ * @{
+ */
+
+/*
+* @brief  Tests cell i and adds it to the peaks.
+* @return 1 when the peak list is full and cell i is a peak that does not fit, 0 otherwise.
+*/
+
+static uint32_t riscv_find_peaks_cell_q15(
+  const q15_t * pSrc,
+  uint32_t i,
+  q15_t threshold,
+  uint32_t minDistance,
+  uint32_t * pIndex,
+  uint32_t * pNumPeaks,
+  uint32_t maxPeaks)
+{
+  q15_t x = pSrc[i];
+  uint32_t numPeaks = *pNumPeaks;
+
+  if((x > threshold) && (x > pSrc[i - 1u]) && (x >= pSrc[i + 1u]))
+  {
+    if((numPeaks > 0u) && ((i - pIndex[numPeaks - 1u]) < minDistance))
+    {
+      /* keep the higher of two close peaks */
+      if(x > pSrc[pIndex[numPeaks - 1u]])
+      {
+        pIndex[numPeaks - 1u] = i;
+      }
+    }
+    else
+    {
+      if(numPeaks == maxPeaks)
+      {
+        return (1u);
+      }
+      pIndex[numPeaks] = i;
+      *pNumPeaks = numPeaks + 1u;
+    }
+  }
+
+  return (0u);
+}
+
+/**
+ * @brief  Q15 peak picking above a threshold.
+ * @param[in]   *pSrc         points to the input cells.
+ * @param[in]   blockSize     number of cells.
+ * @param[in]   *pThreshold   points to the threshold of every cell, as from riscv_cfar_ca_q15(), or NULL.
+ * @param[in]   threshold     threshold of all cells when <code>pThreshold</code> is NULL.
+ * @param[in]   minDistance   least distance between two peaks, 0 or 1 for none.
+ * @param[out]  *pIndex       points to the indices of the peaks, in increasing order.
+ * @param[in]   maxPeaks      size of the <code>pIndex</code> buffer.
+ * @return the number of peaks written to <code>pIndex</code>.
+ *
+ * \par
+ * The peaks are those of riscv_find_peaks_f32().  With <code>USE_DSP_RISCV</code> two cells are tested at
+ * once: <code>max2</code> takes the larger of the neighbours and the threshold of both cells, and a pair
+ * whose cells are both below it is skipped without a branch per cell.  The difference is taken with
+ * <code>sub2</code> and does not wrap for the non-negative inputs and thresholds of a power spectrum;
+ * <code>pSrc</code> and <code>pThreshold</code> are word aligned.
+ */
+
+uint32_t riscv_find_peaks_q15(
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  const q15_t * pThreshold,
+  q15_t threshold,
+  uint32_t minDistance,
+  uint32_t * pIndex,
+  uint32_t maxPeaks)
+{
+  RISCV_PROFILE(riscv_find_peaks_q15);
+  uint32_t numPeaks = 0u;
+  uint32_t i = 1u;
+
+#if defined (USE_DSP_RISCV)
+  shortV odd = { 1, 2 };                         /* Pair straddling two aligned pairs */
+  shortV prev, cur, next;                        /* x[i-2..i-1], x[i..i+1], x[i+2..i+3] */
+  shortV thrV, diff;
+
+  if(blockSize >= 4u)
+  {
+    if(riscv_find_peaks_cell_q15(pSrc, 1u, (pThreshold != NULL) ? pThreshold[1] : threshold,
+                                 minDistance, pIndex, &numPeaks, maxPeaks) != 0u)
+    {
+      return (numPeaks);
+    }
+
+    thrV = pack2(threshold, threshold);
+    prev = *(shortV *) &pSrc[0];
+    cur = *(shortV *) &pSrc[2];
+
+    for (i = 2u; (i + 3u) < blockSize; i += 2u)
+    {
+      next = *(shortV *) &pSrc[i + 2u];
+      if(pThreshold != NULL)
+      {
+        thrV = *(shortV *) &pThreshold[i];
+      }
+
+      /* x[i] - max(x[i-1], x[i+1], thr), negative in both lanes for no peak */
+      diff = sub2(cur, max2(max2(shufflev4(prev, cur, odd), shufflev4(cur, next, odd)), thrV));
+      if((diff[0] >= 0) || (diff[1] >= 0))
+      {
+        if((riscv_find_peaks_cell_q15(pSrc, i, thrV[0], minDistance, pIndex, &numPeaks, maxPeaks) != 0u) ||
+           (riscv_find_peaks_cell_q15(pSrc, i + 1u, thrV[1], minDistance, pIndex, &numPeaks, maxPeaks) != 0u))
+        {
+          return (numPeaks);
+        }
+      }
+
+      prev = cur;
+      cur = next;
+    }
+  }
+#endif
+
+  for (; (i + 1u) < blockSize; i++)
+  {
+    if(riscv_find_peaks_cell_q15(pSrc, i, (pThreshold != NULL) ? pThreshold[i] : threshold,
+                                 minDistance, pIndex, &numPeaks, maxPeaks) != 0u)
+    {
+      break;
+    }
+  }
+
+  return (numPeaks);
+}
+
+/**
+ * @} end of CFAR group
+ */
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_histogram_f32.c
+*
+* Description:  Histogram of a floating-point vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Histogram Histogram
+ *
+ * Counts the samples of a vector that fall into each of <code>numBins</code> bins.
+ * Bin <code>i</code> holds the samples with <code>edge[i] <= x < edge[i+1]</code>,
+ * samples below the first or not below the last edge are not counted.
+ * The bin counts are cleared before the samples are counted.
+ * \par
+ * riscv_histogram_f32() and riscv_histogram_q15() take an array of <code>numBins+1</code>
+ * increasing edges and find the bin of every sample with a binary search,
+ * <code>log2(numBins)</code> comparisons per sample.
+ * \par
+ * riscv_histogram_uniform_f32() and riscv_histogram_uniform_q15() are the fast path for bins of equal width,
+ * the bin is computed directly from the sample with one multiplication (floating-point)
+ * or one shift (Q15, bin width <code>2^shift</code>).
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief Histogram of a floating-point vector with arbitrary bin edges.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       *pEdges points to the <code>numBins+1</code> increasing bin edges
+ * @param[in]       numBins number of bins
+ * @param[out]      *pHist points to the <code>numBins</code> bin counts
+ * @return none.
+ */
+
+void riscv_histogram_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pEdges,
+  uint16_t numBins,
+  uint32_t * pHist)
+{
+  RISCV_PROFILE(riscv_histogram_f32);
+  float32_t first = pEdges[0];                   /* Lower edge of the first bin */
+  float32_t last = pEdges[numBins];              /* Upper edge of the last bin */
+  float32_t in;                                  /* input value */
+  uint32_t lo, hi, mid;                          /* Search interval */
+  uint32_t blkCnt;                               /* loop counter */
+
+  memset(pHist, 0, numBins * sizeof(uint32_t));
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = *pSrc++;
+
+    if((in >= first) && (in < last))
+    {
+      /* Binary search for pEdges[lo] <= in < pEdges[lo + 1] */
+      lo = 0u;
+      hi = numBins;
+
+      while((hi - lo) > 1u)
+      {
+        mid = (lo + hi) >> 1u;
+
+        if(in < pEdges[mid])
+        {
+          hi = mid;
+        }
+        else
+        {
+          lo = mid;
+        }
+      }
+
+      pHist[lo]++;
+    }
+  }
+}
+
+/**
+ * @brief Histogram of a floating-point vector with uniform bins.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       minVal lower edge of the first bin
+ * @param[in]       maxVal upper edge of the last bin, greater than <code>minVal</code>
+ * @param[in]       numBins number of bins
+ * @param[out]      *pHist points to the <code>numBins</code> bin counts
+ * @return none.
+ *
+ * The bins have the width <code>(maxVal-minVal)/numBins</code>.
+ */
+
+void riscv_histogram_uniform_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t minVal,
+  float32_t maxVal,
+  uint16_t numBins,
+  uint32_t * pHist)
+{
+  RISCV_PROFILE(riscv_histogram_uniform_f32);
+  float32_t scale = (float32_t) numBins / (maxVal - minVal);  /* Bins per unit */
+  float32_t in;                                  /* input value */
+  uint32_t bin;                                  /* Bin of the sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+  memset(pHist, 0, numBins * sizeof(uint32_t));
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = *pSrc++;
+
+    if((in >= minVal) && (in < maxVal))
+    {
+      bin = (uint32_t) ((in - minVal) * scale);
+
+      /* The rounding of the scaling can move a sample just below maxVal past the last bin */
+      if(bin >= numBins)
+      {
+        bin = numBins - 1u;
+      }
+
+      pHist[bin]++;
+    }
+  }
+}
+
+/**
+ * @} end of Histogram group
+ */
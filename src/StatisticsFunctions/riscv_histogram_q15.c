@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_histogram_q15.c
+*
+* Description:  Histogram of a Q15 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief Histogram of a Q15 vector with arbitrary bin edges.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       *pEdges points to the <code>numBins+1</code> increasing bin edges
+ * @param[in]       numBins number of bins
+ * @param[out]      *pHist points to the <code>numBins</code> bin counts
+ * @return none.
+ */
+
+void riscv_histogram_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pEdges,
+  uint16_t numBins,
+  uint32_t * pHist)
+{
+  RISCV_PROFILE(riscv_histogram_q15);
+  q15_t first = pEdges[0];                       /* Lower edge of the first bin */
+  q15_t last = pEdges[numBins];                  /* Upper edge of the last bin */
+  q15_t in;                                      /* input value */
+  uint32_t lo, hi, mid;                          /* Search interval */
+  uint32_t blkCnt;                               /* loop counter */
+
+  memset(pHist, 0, numBins * sizeof(uint32_t));
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = *pSrc++;
+
+    if((in >= first) && (in < last))
+    {
+      /* Binary search for pEdges[lo] <= in < pEdges[lo + 1] */
+      lo = 0u;
+      hi = numBins;
+
+      while((hi - lo) > 1u)
+      {
+        mid = (lo + hi) >> 1u;
+
+        if(in < pEdges[mid])
+        {
+          hi = mid;
+        }
+        else
+        {
+          lo = mid;
+        }
+      }
+
+      pHist[lo]++;
+    }
+  }
+}
+
+/**
+ * @brief Histogram of a Q15 vector with uniform bins of width 2^shift.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       minVal lower edge of the first bin
+ * @param[in]       shift log2 of the bin width, from 0 to 16
+ * @param[in]       numBins number of bins
+ * @param[out]      *pHist points to the <code>numBins</code> bin counts
+ * @return none.
+ *
+ * Bin <code>i</code> holds the samples with <code>minVal + i*2^shift <= x < minVal + (i+1)*2^shift</code>,
+ * e.g. <code>minVal</code> = -32768, <code>shift</code> = 10 and <code>numBins</code> = 64 cover the full Q15 range.
+ */
+
+void riscv_histogram_uniform_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t minVal,
+  uint8_t shift,
+  uint16_t numBins,
+  uint32_t * pHist)
+{
+  RISCV_PROFILE(riscv_histogram_uniform_q15);
+  q31_t offset;                                  /* Distance to the lower edge */
+  uint32_t bin;                                  /* Bin of the sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+  memset(pHist, 0, numBins * sizeof(uint32_t));
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    offset = (q31_t) *pSrc++ - minVal;
+
+    /* Samples below minVal wrap to a bin of at least 0xFFFF, one comparison checks both edges */
+    bin = ((uint32_t) offset) >> shift;
+
+    if(bin < numBins)
+    {
+      pHist[bin]++;
+    }
+  }
+}
+
+/**
+ * @} end of Histogram group
+ */
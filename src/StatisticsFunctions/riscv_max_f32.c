@@ -75,6 +75,7 @@ void riscv_max_f32(
   float32_t * pResult,
   uint32_t * pIndex)
 {
+  RISCV_PROFILE(riscv_max_f32);
   float32_t maxVal1, out;                        /* Temporary variables to store the output value. */
   uint32_t blkCnt, outIndex;                     /* loop counter */
 
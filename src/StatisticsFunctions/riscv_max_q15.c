@@ -59,6 +59,11 @@
  * @param[out]      *pResult maximum value returned here    
  * @param[out]      *pIndex index of maximum value returned here    
  * @return none.    
+ *
+ * \par
+ * With the DSP extension the maximum is found with <code>max2</code> on two samples at a time
+ * and its first index is recovered with a scan that stops at the first match.
+ * <code>pSrc</code> must be 4-byte aligned in this case.
  */
 
 void riscv_max_q15(
@@ -67,9 +72,44 @@ void riscv_max_q15(
   q15_t * pResult,
   uint32_t * pIndex)
 {
+  RISCV_PROFILE(riscv_max_q15);
   q15_t maxVal1, out;                            /* Temporary variables to store the output value. */
   uint32_t blkCnt, outIndex;                     /* loop counter */
 
+#if defined (USE_DSP_RISCV)
+
+  shortV VectIn, VectMax;                        /* Input samples and per lane maxima */
+  q15_t *pIn = pSrc;                             /* input pointer */
+
+  /* Per lane maxima of two samples at a time */
+  out = *pSrc;
+  VectMax = pack2(out, out);
+
+  for (blkCnt = blockSize >> 1u; blkCnt > 0u; blkCnt--)
+  {
+    VectIn = *(shortV *) pIn;
+    VectMax = max2(VectMax, VectIn);
+    pIn += 2;
+  }
+
+  /* Maximum of the lanes and of the remaining samples */
+  out = (VectMax[0] > VectMax[1]) ? VectMax[0] : VectMax[1];
+
+  for (blkCnt = blockSize & 1u; blkCnt > 0u; blkCnt--)
+  {
+    maxVal1 = *pIn++;
+    out = (out > maxVal1) ? out : maxVal1;
+  }
+
+  /* Index of the first sample equal to the maximum */
+  outIndex = 0u;
+  while(pSrc[outIndex] != out)
+  {
+    outIndex++;
+  }
+
+#else
+
   blkCnt = (blockSize - 1u);
 
   /* Initialise the index value to zero. */
@@ -93,6 +133,8 @@ void riscv_max_q15(
 
   }
 
+#endif
+
   /* Store the maximum value and its index into destination pointers */
   *pResult = out;
   *pIndex = outIndex;
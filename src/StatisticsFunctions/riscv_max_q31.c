@@ -67,6 +67,7 @@ void riscv_max_q31(
   q31_t * pResult,
   uint32_t * pIndex)
 {
+  RISCV_PROFILE(riscv_max_q31);
   q31_t maxVal1, out;                            /* Temporary variables to store the output value. */
   uint32_t blkCnt, outIndex;                     /* loop counter */
 
@@ -59,6 +59,11 @@
  * @param[out]      *pResult maximum value returned here    
  * @param[out]      *pIndex index of maximum value returned here    
   * @return none.    
+ *
+ * \par
+ * With the DSP extension the maximum is found with <code>max4</code> on four samples at a time
+ * and its first index is recovered with a scan that stops at the first match.
+ * <code>pSrc</code> must be 4-byte aligned in this case.
  */
 
 void riscv_max_q7(
@@ -67,9 +72,46 @@ void riscv_max_q7(
   q7_t * pResult,
   uint32_t * pIndex)
 {
+  RISCV_PROFILE(riscv_max_q7);
   q7_t maxVal1, out;                             /* Temporary variables to store the output value. */
   uint32_t blkCnt, outIndex;                     /* loop counter */
 
+#if defined (USE_DSP_RISCV)
+
+  charV VectIn, VectMax;                         /* Input samples and per lane maxima */
+  q7_t *pIn = pSrc;                              /* input pointer */
+
+  /* Per lane maxima of four samples at a time */
+  out = *pSrc;
+  VectMax = pack4(out, out, out, out);
+
+  for (blkCnt = blockSize >> 2u; blkCnt > 0u; blkCnt--)
+  {
+    VectIn = *(charV *) pIn;
+    VectMax = max4(VectMax, VectIn);
+    pIn += 4;
+  }
+
+  /* Maximum of the lanes and of the remaining samples */
+  out = (VectMax[0] > VectMax[1]) ? VectMax[0] : VectMax[1];
+  maxVal1 = (VectMax[2] > VectMax[3]) ? VectMax[2] : VectMax[3];
+  out = (out > maxVal1) ? out : maxVal1;
+
+  for (blkCnt = blockSize & 3u; blkCnt > 0u; blkCnt--)
+  {
+    maxVal1 = *pIn++;
+    out = (out > maxVal1) ? out : maxVal1;
+  }
+
+  /* Index of the first sample equal to the maximum */
+  outIndex = 0u;
+  while(pSrc[outIndex] != out)
+  {
+    outIndex++;
+  }
+
+#else
+
   /* Initialise the index value to zero. */
   outIndex = 0u;
   /* Load first input value that act as reference value for comparision */
@@ -93,6 +135,8 @@ void riscv_max_q7(
 
   }
 
+#endif
+
   /* Store the maximum value and its index into destination pointers */
   *pResult = out;
   *pIndex = outIndex;
@@ -71,6 +71,10 @@
  * @param[in]       blockSize length of the input vector    
  * @param[out]      *pResult mean value returned here    
  * @return none.    
+ *
+ * \par
+ * The sum is split over four accumulators to keep the FPU pipeline busy, so the result can differ
+ * from a sequential sum in the last bits.
  */
 
 
@@ -79,20 +83,40 @@ void riscv_mean_f32(
   uint32_t blockSize,
   float32_t * pResult)
 {
+  RISCV_PROFILE(riscv_mean_f32);
   float32_t sum = 0.0f;                          /* Temporary result storage */
+  float32_t sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;  /* Partial sums */
   uint32_t blkCnt;                               /* loop counter */
-  /* Loop over blockSize number of values */
-  blkCnt = blockSize;
+
+  /* Four independent accumulators hide the latency of the FPU additions */
+  blkCnt = blockSize >> 2u;
 
   while(blkCnt > 0u)
   {
     /* C = (A[0] + A[1] + A[2] + ... + A[blockSize-1]) */
+    sum += pSrc[0];
+    sum1 += pSrc[1];
+    sum2 += pSrc[2];
+    sum3 += pSrc[3];
+    pSrc += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Remaining samples */
+  blkCnt = blockSize & 3u;
+
+  while(blkCnt > 0u)
+  {
     sum += *pSrc++;
 
     /* Decrement the loop counter */
     blkCnt--;
   }
 
+  sum += (sum1 + sum2) + sum3;
+
   /* C = (A[0] + A[1] + A[2] + ... + A[blockSize-1]) / blockSize  */
   /* Store the result to the destination */
   *pResult = sum / (float32_t) blockSize;
@@ -76,6 +76,7 @@ void riscv_mean_q15(
   uint32_t blockSize,
   q15_t * pResult)
 {
+  RISCV_PROFILE(riscv_mean_q15);
   q31_t sum = 0;                                 /* Temporary result storage */
   uint32_t blkCnt;                               /* loop counter */
 #if defined (USE_DSP_RISCV)
@@ -76,6 +76,7 @@ void riscv_mean_q31(
   uint32_t blockSize,
   q31_t * pResult)
 {
+  RISCV_PROFILE(riscv_mean_q31);
   q63_t sum = 0;                                 /* Temporary result storage */
   uint32_t blkCnt;                               /* loop counter */
 
@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_median_filter_init_q15.c
+*
+* Description:  Initialization function for the Q15 sliding median filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MedianFilter
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 sliding median filter.
+ * @param[out]    *S             points to an instance of the Q15 median filter structure.
+ * @param[in]     windowLength   number of samples in the window.
+ * @param[in]     *pState        points to the window buffer of <code>windowLength</code> values.
+ * @param[in]     *pHeap         points to a buffer of <code>windowLength</code> indices.
+ * @param[in]     *pPos          points to a buffer of <code>windowLength</code> indices.
+ * @return        The function returns RISCV_MATH_SUCCESS or RISCV_MATH_ARGUMENT_ERROR if <code>windowLength</code> is 0.
+ *
+ * \par
+ * The window is cleared to zero, as the state of riscv_fir_q15(), and the two heaps are built
+ * from the zero samples.
+ */
+
+riscv_status riscv_median_filter_init_q15(
+  riscv_median_filter_instance_q15 * S,
+  uint16_t windowLength,
+  q15_t * pState,
+  uint16_t * pHeap,
+  uint16_t * pPos)
+{
+  RISCV_PROFILE(riscv_median_filter_init_q15);
+  uint32_t i;
+
+  if(windowLength == 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Equal samples form valid heaps in any order */
+  for (i = 0u; i < windowLength; i++)
+  {
+    pState[i] = 0;
+    pHeap[i] = (uint16_t) i;
+    pPos[i] = (uint16_t) i;
+  }
+
+  S->windowLength = windowLength;
+  S->stateIndex = 0u;
+  S->pState = pState;
+  S->pHeap = pHeap;
+  S->pPos = pPos;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MedianFilter group
+ */
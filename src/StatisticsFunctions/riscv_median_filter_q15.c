@@ -0,0 +1,159 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_median_filter_q15.c
+*
+* Description:  Q15 sliding median filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup MedianFilter
+ * @{
+ */
+
+/*
+* @brief  Exchanges two heap positions and updates the positions of their slots.
+*/
+
+static void riscv_median_filter_swap(
+  uint16_t * pHeap,
+  uint16_t * pPos,
+  uint32_t a,
+  uint32_t b)
+{
+  uint16_t slot = pHeap[a];
+
+  pHeap[a] = pHeap[b];
+  pHeap[b] = slot;
+  pPos[pHeap[a]] = (uint16_t) a;
+  pPos[pHeap[b]] = (uint16_t) b;
+}
+
+/*
+* @brief  Restores one heap after the sample at heap position i has changed.
+* @param[in]     *pVal   points to the window samples.
+* @param[in,out] *pHeap  points to the heap slots.
+* @param[in,out] *pPos   points to the heap positions of the slots.
+* @param[in]     base    position of the root of the heap in pHeap.
+* @param[in]     size    number of samples of the heap.
+* @param[in]     i       position of the changed sample, relative to base.
+* @param[in]     isMax   1 for the max-heap, 0 for the min-heap.
+*/
+
+static void riscv_median_filter_fix_q15(
+  const q15_t * pVal,
+  uint16_t * pHeap,
+  uint16_t * pPos,
+  uint32_t base,
+  uint32_t size,
+  uint32_t i,
+  uint32_t isMax)
+{
+  q31_t sign = (isMax != 0u) ? 1 : -1;           /* Orders the min-heap as a max-heap of -x */
+  uint32_t parent, child;
+
+  /* Sift up */
+  while(i > 0u)
+  {
+    parent = (i - 1u) >> 1u;
+    if((sign * (q31_t) pVal[pHeap[base + i]]) <= (sign * (q31_t) pVal[pHeap[base + parent]]))
+    {
+      break;
+    }
+    riscv_median_filter_swap(pHeap, pPos, base + i, base + parent);
+    i = parent;
+  }
+
+  /* Sift down */
+  for (child = (2u * i) + 1u; child < size; child = (2u * i) + 1u)
+  {
+    if(((child + 1u) < size) && ((sign * (q31_t) pVal[pHeap[base + child + 1u]]) > (sign * (q31_t) pVal[pHeap[base + child]])))
+    {
+      child++;
+    }
+    if((sign * (q31_t) pVal[pHeap[base + child]]) <= (sign * (q31_t) pVal[pHeap[base + i]]))
+    {
+      break;
+    }
+    riscv_median_filter_swap(pHeap, pPos, base + i, base + child);
+    i = child;
+  }
+}
+
+/**
+ * @brief  Processing function for the Q15 sliding median filter.
+ * @param[in,out] *S         points to an instance of the Q15 median filter structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void riscv_median_filter_q15(
+  riscv_median_filter_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_median_filter_q15);
+  q15_t *pVal = S->pState;                   /* Window samples */
+  uint16_t *pHeap = S->pHeap;                    /* Heap slots */
+  uint16_t *pPos = S->pPos;                      /* Heap positions of the slots */
+  uint32_t winLen = S->windowLength;             /* Window length */
+  uint32_t numLow = (winLen + 1u) >> 1u;         /* Size of the max-heap */
+  uint32_t numHigh = winLen - numLow;            /* Size of the min-heap */
+  uint32_t slot = S->stateIndex;                 /* Slot of the oldest sample */
+  uint32_t pos, blkCnt;
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    /* Replace the oldest sample and restore its heap */
+    pVal[slot] = *pSrc++;
+    pos = pPos[slot];
+
+    if(pos < numLow)
+    {
+      riscv_median_filter_fix_q15(pVal, pHeap, pPos, 0u, numLow, pos, 1u);
+    }
+    else
+    {
+      riscv_median_filter_fix_q15(pVal, pHeap, pPos, numLow, numHigh, pos - numLow, 0u);
+    }
+
+    /* Exchange the roots if the new sample moved to the wrong side */
+    if((numHigh > 0u) && (pVal[pHeap[0]] > pVal[pHeap[numLow]]))
+    {
+      riscv_median_filter_swap(pHeap, pPos, 0u, numLow);
+      riscv_median_filter_fix_q15(pVal, pHeap, pPos, 0u, numLow, 0u, 1u);
+      riscv_median_filter_fix_q15(pVal, pHeap, pPos, numLow, numHigh, 0u, 0u);
+    }
+
+    if(numLow == numHigh)
+    {
+      *pDst++ = (q15_t) (((q31_t) pVal[pHeap[0]] + pVal[pHeap[numLow]]) >> 1);
+    }
+    else
+    {
+      *pDst++ = pVal[pHeap[0]];
+    }
+
+    slot++;
+    if(slot == winLen)
+    {
+      slot = 0u;
+    }
+  }
+
+  S->stateIndex = (uint16_t) slot;
+}
+
+/**
+ * @} end of MedianFilter group
+ */
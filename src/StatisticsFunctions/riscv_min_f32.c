@@ -76,6 +76,7 @@ void riscv_min_f32(
   float32_t * pResult,
   uint32_t * pIndex)
 {
+  RISCV_PROFILE(riscv_min_f32);
 
   float32_t minVal1, out;                        /* Temporary variables to store the output value. */
   uint32_t blkCnt, outIndex;                     /* loop counter */
@@ -61,6 +61,10 @@
  * @param[out]      *pIndex index of minimum value returned here    
  * @return none.    
  *    
+ * \par
+ * With the DSP extension the minimum is found with <code>min2</code> on two samples at a time
+ * and its first index is recovered with a scan that stops at the first match.
+ * <code>pSrc</code> must be 4-byte aligned in this case.
  */
 
 void riscv_min_q15(
@@ -69,9 +73,44 @@ void riscv_min_q15(
   q15_t * pResult,
   uint32_t * pIndex)
 {
+  RISCV_PROFILE(riscv_min_q15);
   q15_t minVal1, out;                            /* Temporary variables to store the output value. */
   uint32_t blkCnt, outIndex;                     /* loop counter */
 
+#if defined (USE_DSP_RISCV)
+
+  shortV VectIn, VectMin;                        /* Input samples and per lane minima */
+  q15_t *pIn = pSrc;                             /* input pointer */
+
+  /* Per lane minima of two samples at a time */
+  out = *pSrc;
+  VectMin = pack2(out, out);
+
+  for (blkCnt = blockSize >> 1u; blkCnt > 0u; blkCnt--)
+  {
+    VectIn = *(shortV *) pIn;
+    VectMin = min2(VectMin, VectIn);
+    pIn += 2;
+  }
+
+  /* Minimum of the lanes and of the remaining samples */
+  out = (VectMin[0] < VectMin[1]) ? VectMin[0] : VectMin[1];
+
+  for (blkCnt = blockSize & 1u; blkCnt > 0u; blkCnt--)
+  {
+    minVal1 = *pIn++;
+    out = (out < minVal1) ? out : minVal1;
+  }
+
+  /* Index of the first sample equal to the minimum */
+  outIndex = 0u;
+  while(pSrc[outIndex] != out)
+  {
+    outIndex++;
+  }
+
+#else
+
   blkCnt = (blockSize - 1u);
 
   /* Initialise the index value to zero. */
@@ -98,6 +137,8 @@ void riscv_min_q15(
 
 
 
+#endif
+
   /* Store the minimum value and its index into destination pointers */
   *pResult = out;
   *pIndex = outIndex;
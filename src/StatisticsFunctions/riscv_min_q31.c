@@ -69,6 +69,7 @@ void riscv_min_q31(
   q31_t * pResult,
   uint32_t * pIndex)
 {
+  RISCV_PROFILE(riscv_min_q31);
   q31_t minVal1, out;                            /* Temporary variables to store the output value. */
   uint32_t blkCnt, outIndex;                     /* loop counter */
 
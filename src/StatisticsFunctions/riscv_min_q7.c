@@ -60,6 +60,10 @@
  * @param[out]      *pIndex index of minimum value returned here    
  * @return none.    
  *    
+ * \par
+ * With the DSP extension the minimum is found with <code>min4</code> on four samples at a time
+ * and its first index is recovered with a scan that stops at the first match.
+ * <code>pSrc</code> must be 4-byte aligned in this case.
  */
 
 void riscv_min_q7(
@@ -68,11 +72,48 @@ void riscv_min_q7(
   q7_t * pResult,
   uint32_t * pIndex)
 {
+  RISCV_PROFILE(riscv_min_q7);
 
 
   q7_t minVal1, out;                             /* Temporary variables to store the output value. */
   uint32_t blkCnt, outIndex;                     /* loop counter */
 
+#if defined (USE_DSP_RISCV)
+
+  charV VectIn, VectMin;                         /* Input samples and per lane minima */
+  q7_t *pIn = pSrc;                              /* input pointer */
+
+  /* Per lane minima of four samples at a time */
+  out = *pSrc;
+  VectMin = pack4(out, out, out, out);
+
+  for (blkCnt = blockSize >> 2u; blkCnt > 0u; blkCnt--)
+  {
+    VectIn = *(charV *) pIn;
+    VectMin = min4(VectMin, VectIn);
+    pIn += 4;
+  }
+
+  /* Minimum of the lanes and of the remaining samples */
+  out = (VectMin[0] < VectMin[1]) ? VectMin[0] : VectMin[1];
+  minVal1 = (VectMin[2] < VectMin[3]) ? VectMin[2] : VectMin[3];
+  out = (out < minVal1) ? out : minVal1;
+
+  for (blkCnt = blockSize & 3u; blkCnt > 0u; blkCnt--)
+  {
+    minVal1 = *pIn++;
+    out = (out < minVal1) ? out : minVal1;
+  }
+
+  /* Index of the first sample equal to the minimum */
+  outIndex = 0u;
+  while(pSrc[outIndex] != out)
+  {
+    outIndex++;
+  }
+
+#else
+
   /* Initialise the index value to zero. */
   outIndex = 0u;
   /* Load first input value that act as reference value for comparision */
@@ -97,6 +138,8 @@ void riscv_min_q7(
 
   }
 
+#endif
+
   /* Store the minimum value and its index into destination pointers */
   *pResult = out;
   *pIndex = outIndex;
@@ -72,6 +72,8 @@
  * @param[out]      *pResult sum of the squares value returned here    
  * @return none.    
  *    
+ * \par
+ * The squares are accumulated in four partial sums that are added at the end.
  */
 
 
@@ -80,23 +82,46 @@ void riscv_power_f32(
   uint32_t blockSize,
   float32_t * pResult)
 {
+  RISCV_PROFILE(riscv_power_f32);
   float32_t sum = 0.0f;                          /* accumulator */
-  float32_t in;                                  /* Temporary variable to store input value */
+  float32_t in0, in1, in2, in3;                  /* input values */
+  float32_t sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;  /* Partial sums */
   uint32_t blkCnt;                               /* loop counter */
-  /* Loop over blockSize number of values */
-  blkCnt = blockSize;
+
+  /* Four independent accumulators hide the latency of the FPU additions */
+  blkCnt = blockSize >> 2u;
 
   while(blkCnt > 0u)
   {
     /* C = A[0] * A[0] + A[1] * A[1] + A[2] * A[2] + ... + A[blockSize-1] * A[blockSize-1] */
-    /* compute power and then store the result in a temporary variable, sum. */
-    in = *pSrc++;
-    sum += in * in;
+    in0 = pSrc[0];
+    in1 = pSrc[1];
+    in2 = pSrc[2];
+    in3 = pSrc[3];
+    sum += in0 * in0;
+    sum1 += in1 * in1;
+    sum2 += in2 * in2;
+    sum3 += in3 * in3;
+    pSrc += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Remaining samples */
+  blkCnt = blockSize & 3u;
+
+  while(blkCnt > 0u)
+  {
+    in0 = *pSrc++;
+    sum += in0 * in0;
 
     /* Decrement the loop counter */
     blkCnt--;
   }
 
+  sum += (sum1 + sum2) + sum3;
+
   /* Store the result to the destination */
   *pResult = sum;
 }
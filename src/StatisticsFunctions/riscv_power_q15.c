@@ -70,6 +70,9 @@
  * full precision of the intermediate multiplication is preserved.    
  * Finally, the return result is in 34.30 format.     
  *    
+ * \par
+ * With the xpulp extensions the products are summed by pairs with <code>pv.dotsp.h</code>, whose
+ * 32-bit sum wraps when both products are 0x8000 * 0x8000, that is when two consecutive input samples are -1.0.
  */
 
 void riscv_power_q15(
@@ -77,6 +80,7 @@ void riscv_power_q15(
   uint32_t blockSize,
   q63_t * pResult)
 {
+  RISCV_PROFILE(riscv_power_q15);
   q63_t sum = 0;                                 /* Temporary result storage */
   q15_t in;                                      /* Temporary variable to store input value */
   uint32_t blkCnt;                               /* loop counter */
@@ -78,6 +78,7 @@ void riscv_power_q31(
   uint32_t blockSize,
   q63_t * pResult)
 {
+  RISCV_PROFILE(riscv_power_q31);
   q63_t sum = 0;                                 /* Temporary result storage */
   q31_t in;
   uint32_t blkCnt;                               /* loop counter */
@@ -77,6 +77,7 @@ void riscv_power_q7(
   uint32_t blockSize,
   q31_t * pResult)
 {
+  RISCV_PROFILE(riscv_power_q7);
   q31_t sum = 0;                                 /* Temporary result storage */
   q7_t in;                                       /* Temporary variable to store input */
   uint32_t blkCnt;                               /* loop counter */
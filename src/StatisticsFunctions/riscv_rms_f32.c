@@ -73,6 +73,8 @@
  * @param[out]      *pResult rms value returned here    
  * @return none.    
  *    
+ * \par
+ * The squares are accumulated in four partial sums, as in riscv_power_f32().
  */
 
 void riscv_rms_f32(
@@ -80,24 +82,46 @@ void riscv_rms_f32(
   uint32_t blockSize,
   float32_t * pResult)
 {
+  RISCV_PROFILE(riscv_rms_f32);
   float32_t sum = 0.0f;                          /* Accumulator */
-  float32_t in;                                  /* Tempoprary variable to store input value */
+  float32_t in0, in1, in2, in3;                  /* input values */
+  float32_t sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;  /* Partial sums */
   uint32_t blkCnt;                               /* loop counter */
 
-  /* Loop over blockSize number of values */
-  blkCnt = blockSize;
+  /* Four independent accumulators hide the latency of the FPU additions */
+  blkCnt = blockSize >> 2u;
 
   while(blkCnt > 0u)
   {
     /* C = A[0] * A[0] + A[1] * A[1] + A[2] * A[2] + ... + A[blockSize-1] * A[blockSize-1] */
-    /* Compute sum of the squares and then store the results in a temporary variable, sum  */
-    in = *pSrc++;
-    sum += in * in;
+    in0 = pSrc[0];
+    in1 = pSrc[1];
+    in2 = pSrc[2];
+    in3 = pSrc[3];
+    sum += in0 * in0;
+    sum1 += in1 * in1;
+    sum2 += in2 * in2;
+    sum3 += in3 * in3;
+    pSrc += 4;
 
     /* Decrement the loop counter */
     blkCnt--;
   }
 
+  /* Remaining samples */
+  blkCnt = blockSize & 3u;
+
+  while(blkCnt > 0u)
+  {
+    in0 = *pSrc++;
+    sum += in0 * in0;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  sum += (sum1 + sum2) + sum3;
+
   /* Compute Rms and store the result in the destination */
   riscv_sqrt_f32(sum / (float32_t) blockSize, pResult);
 }
@@ -74,6 +74,7 @@ void riscv_rms_q15(
   uint32_t blockSize,
   q15_t * pResult)
 {
+  RISCV_PROFILE(riscv_rms_q15);
   q63_t sum = 0;                                 /* accumulator */
 
   q15_t in;                                      /* temporary variable to store the input value */
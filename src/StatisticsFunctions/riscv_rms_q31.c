@@ -77,6 +77,7 @@ void riscv_rms_q31(
   uint32_t blockSize,
   q31_t * pResult)
 {
+  RISCV_PROFILE(riscv_rms_q31);
   q63_t sum = 0;                                 /* accumulator */
   q31_t in;                                      /* Temporary variable to store the input */
   uint32_t blkCnt;                               /* loop counter */
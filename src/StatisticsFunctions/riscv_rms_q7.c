@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_rms_q7.c
+*
+* Description:  Root Mean Square of an array of Q7 type.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup RMS
+ * @{
+ */
+
+/**
+ * @brief Root Mean Square of the elements of a Q7 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult rms value returned here
+ * @return none.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using a 32-bit internal accumulator.
+ * The input is represented in 1.7 format.
+ * Intermediate multiplication yields a 2.14 format, and this
+ * result is added without saturation to an accumulator in 18.14 format.
+ * With 17 guard bits in the accumulator, there is no risk of overflow for up to
+ * 131072 samples, and the full precision of the intermediate multiplication is preserved.
+ * Finally, the 2.14 mean of the squares is shifted to 1.15 format and saturated,
+ * and its square root is returned in 1.15 format.
+ */
+
+void riscv_rms_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult)
+{
+  RISCV_PROFILE(riscv_rms_q7);
+
+  q31_t sum = 0;                                 /* accumulator */
+  uint32_t blkCnt;                               /* loop counter */
+  q7_t in;                                       /* temporary variable to store the input value */
+#if defined (USE_DSP_RISCV)
+  charV VectInA;                                 /* four input values */
+
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = A[0] * A[0] + A[1] * A[1] + A[2] * A[2] + A[3] * A[3] */
+    VectInA = *(charV *) pSrc;
+    sum = sumdotpv4(VectInA, VectInA, sum);
+    pSrc += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 3u;
+#else
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* C = (A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1]) */
+    in = *pSrc++;
+    sum += ((q15_t) in * in);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Mean of the squares in 1.15 format, its root to the destination */
+  riscv_sqrt_q15((q15_t) __SSAT((sum / (q31_t) blockSize) << 1, 16), pResult);
+}
+
+/**
+ * @} end of RMS group
+ */
@@ -0,0 +1,249 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_running_stats_f32.c
+*
+* Description:  Floating-point running mean and variance over a stream.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup RunningStats Running statistics
+ *
+ * Mean, variance and standard deviation of a stream that is processed block by block.
+ * riscv_var_f32() and riscv_std_f32() need the whole data set and subtract two large sums,
+ * these functions keep the number of samples <code>n</code>, their mean and the sum of
+ * the squared deviations from the mean <code>M2</code> in an instance structure instead.
+ * \par
+ * A block of <code>nb</code> samples is added by computing its own mean and <code>M2</code> in two
+ * passes over the block and combining them with the instance (Chan et al.):
+ * <pre>
+ *     delta = mean_b - mean_a
+ *     n     = n_a + n_b
+ *     mean  = mean_a + delta * n_b / n
+ *     M2    = M2_a + M2_b + delta^2 * n_a * n_b / n
+ * </pre>
+ * The update needs one division per block instead of one per sample as Welford's algorithm,
+ * and the inner loops are plain sums that can be unrolled.  Both terms of the update are
+ * non-negative, so there is no cancellation.
+ * \par
+ * riscv_running_stats_merge_f32() combines two instances in the same way, e.g. the
+ * statistics of two channels or of two halves of a data set.  riscv_running_stats_evict_f32()
+ * inverts the update to remove the oldest block of a sliding window, the caller passes the
+ * samples that were pushed before.  The eviction subtracts and the accuracy decreases when
+ * the variance of the remaining samples is much smaller than the one of the removed block.
+ * The rounding errors of the evictions accumulate, pushing the current window into a new instance
+ * from time to time bounds them.
+ * \par
+ * riscv_running_stats_get_f32() returns the estimates of riscv_mean_f32(), riscv_var_f32()
+ * and riscv_std_f32() of all samples in the instance, with <code>var = M2 / (n - 1)</code>.
+ */
+
+/**
+ * @addtogroup RunningStats
+ * @{
+ */
+
+/*
+* @brief  Mean and sum of squared deviations of a block.
+* @param[in]  *pSrc      points to the block.
+* @param[in]  blockSize  number of samples, nonzero.
+* @param[out] *pMean     mean of the block.
+* @param[out] *pM2       sum of the squared deviations from the mean.
+*/
+
+static void riscv_running_stats_block_f32(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pMean,
+  float32_t * pM2)
+{
+  float32_t sum0 = 0.0f, sum1 = 0.0f;            /* Accumulators */
+  float32_t mean, d0, d1;                        /* Mean and deviations */
+  uint32_t blkCnt;                               /* loop counter */
+  const float32_t *pIn = pSrc;                   /* input pointer */
+
+  /* First pass, sum of the samples */
+  for (blkCnt = blockSize >> 1u; blkCnt > 0u; blkCnt--)
+  {
+    sum0 += pIn[0];
+    sum1 += pIn[1];
+    pIn += 2;
+  }
+
+  if((blockSize & 1u) != 0u)
+  {
+    sum0 += *pIn;
+  }
+
+  mean = (sum0 + sum1) / (float32_t) blockSize;
+
+  /* Second pass, sum of the squared deviations */
+  sum0 = sum1 = 0.0f;
+  pIn = pSrc;
+
+  for (blkCnt = blockSize >> 1u; blkCnt > 0u; blkCnt--)
+  {
+    d0 = pIn[0] - mean;
+    d1 = pIn[1] - mean;
+    sum0 += d0 * d0;
+    sum1 += d1 * d1;
+    pIn += 2;
+  }
+
+  if((blockSize & 1u) != 0u)
+  {
+    d0 = *pIn - mean;
+    sum0 += d0 * d0;
+  }
+
+  *pMean = mean;
+  *pM2 = sum0 + sum1;
+}
+
+/*
+* @brief  Adds the statistics of a set of samples to an instance.
+*/
+
+static void riscv_running_stats_combine_f32(
+  riscv_running_stats_instance_f32 * S,
+  uint32_t countB,
+  float32_t meanB,
+  float32_t m2B)
+{
+  uint32_t countA = S->count;                    /* Samples of the instance */
+  uint32_t count = countA + countB;              /* Samples after the update */
+  float32_t delta, frac;
+
+  if(countB == 0u)
+  {
+    return;
+  }
+
+  delta = meanB - S->mean;
+  frac = (float32_t) countB / (float32_t) count;
+
+  S->mean += delta * frac;
+  S->m2 += m2B + ((delta * delta) * ((float32_t) countA * frac));
+  S->count = count;
+}
+
+/**
+ * @brief  Adds a block of samples to the floating-point running statistics.
+ * @param[in,out]   *S points to an instance of the floating-point running statistics structure
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples to add
+ * @return none.
+ */
+
+void riscv_running_stats_push_f32(
+  riscv_running_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_running_stats_push_f32);
+  float32_t mean, m2;                            /* Statistics of the block */
+
+  if(blockSize > 0u)
+  {
+    riscv_running_stats_block_f32(pSrc, blockSize, &mean, &m2);
+    riscv_running_stats_combine_f32(S, blockSize, mean, m2);
+  }
+}
+
+/**
+ * @brief  Removes a block of previously added samples from the floating-point running statistics.
+ * @param[in,out]   *S points to an instance of the floating-point running statistics structure
+ * @param[in]       *pSrc points to the block of samples to remove
+ * @param[in]       blockSize number of samples to remove
+ * @return none.
+ *
+ * The instance is reset when <code>blockSize</code> is not smaller than the number of samples of the instance.
+ */
+
+void riscv_running_stats_evict_f32(
+  riscv_running_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_running_stats_evict_f32);
+  float32_t meanB, m2B, delta, m2;               /* Statistics of the removed block */
+  uint32_t countA;                               /* Samples that remain */
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  if(blockSize >= S->count)
+  {
+    riscv_running_stats_init_f32(S);
+    return;
+  }
+
+  riscv_running_stats_block_f32(pSrc, blockSize, &meanB, &m2B);
+  countA = S->count - blockSize;
+
+  /* Mean of the remaining samples, then the update of riscv_running_stats_combine_f32() backwards */
+  S->mean += (S->mean - meanB) * ((float32_t) blockSize / (float32_t) countA);
+  delta = meanB - S->mean;
+  m2 = S->m2 - m2B - ((delta * delta) * (((float32_t) countA * (float32_t) blockSize) / (float32_t) S->count));
+
+  S->m2 = (m2 > 0.0f) ? m2 : 0.0f;
+  S->count = countA;
+}
+
+/**
+ * @brief  Merges two floating-point running statistics.
+ * @param[in,out]   *S points to the instance that receives the samples of <code>pSrc</code>
+ * @param[in]       *pSrc points to the instance to merge
+ * @return none.
+ */
+
+void riscv_running_stats_merge_f32(
+  riscv_running_stats_instance_f32 * S,
+  const riscv_running_stats_instance_f32 * pSrc)
+{
+  RISCV_PROFILE(riscv_running_stats_merge_f32);
+  riscv_running_stats_combine_f32(S, pSrc->count, pSrc->mean, pSrc->m2);
+}
+
+/**
+ * @brief  Mean, variance and standard deviation of the floating-point running statistics.
+ * @param[in]       *S points to an instance of the floating-point running statistics structure
+ * @param[out]      *pMean mean value returned here
+ * @param[out]      *pVar variance value returned here
+ * @param[out]      *pStd standard deviation value returned here
+ * @return none.
+ *
+ * The variance and standard deviation are 0 for less than two samples.
+ */
+
+void riscv_running_stats_get_f32(
+  const riscv_running_stats_instance_f32 * S,
+  float32_t * pMean,
+  float32_t * pVar,
+  float32_t * pStd)
+{
+  RISCV_PROFILE(riscv_running_stats_get_f32);
+  float32_t var = 0.0f;                          /* Temporary variance storage */
+
+  if(S->count > 1u)
+  {
+    var = S->m2 / (float32_t) (S->count - 1u);
+  }
+
+  *pMean = S->mean;
+  *pVar = var;
+  riscv_sqrt_f32(var, pStd);
+}
+
+/**
+ * @} end of RunningStats group
+ */
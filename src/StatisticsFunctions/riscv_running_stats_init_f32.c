@@ -0,0 +1,41 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_running_stats_init_f32.c
+*
+* Description:  Initialization function for the floating-point running
+*               statistics.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup RunningStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point running statistics.
+ * @param[out]      *S points to an instance of the floating-point running statistics structure
+ * @return none.
+ *
+ * The instance holds no samples after initialization.
+ */
+
+void riscv_running_stats_init_f32(
+  riscv_running_stats_instance_f32 * S)
+{
+  RISCV_PROFILE(riscv_running_stats_init_f32);
+  S->count = 0u;
+  S->mean = 0.0f;
+  S->m2 = 0.0f;
+}
+
+/**
+ * @} end of RunningStats group
+ */
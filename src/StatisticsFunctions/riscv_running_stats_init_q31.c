@@ -0,0 +1,40 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_running_stats_init_q31.c
+*
+* Description:  Initialization function for the Q31 running statistics.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup RunningStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 running statistics.
+ * @param[out]      *S points to an instance of the Q31 running statistics structure
+ * @return none.
+ *
+ * The instance holds no samples after initialization.
+ */
+
+void riscv_running_stats_init_q31(
+  riscv_running_stats_instance_q31 * S)
+{
+  RISCV_PROFILE(riscv_running_stats_init_q31);
+  S->count = 0u;
+  S->mean = 0;
+  S->m2 = 0;
+}
+
+/**
+ * @} end of RunningStats group
+ */
@@ -0,0 +1,243 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_running_stats_q31.c
+*
+* Description:  Q31 running mean and variance over a stream.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup RunningStats
+ * @{
+ */
+
+/*
+* @brief  Mean and sum of squared deviations of a block.
+* @param[in]  *pSrc      points to the block.
+* @param[in]  blockSize  number of samples, nonzero.
+* @param[out] *pMean     mean of the block in 1.31 format.
+* @param[out] *pM2       sum of the squared deviations from the mean in 18.46 format.
+*/
+
+static void riscv_running_stats_block_q31(
+  const q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pMean,
+  q63_t * pM2)
+{
+  q63_t sum0 = 0, sum1 = 0;                      /* Accumulators */
+  q31_t mean, d0, d1;                            /* Mean and deviations in 2.23 format */
+  uint32_t blkCnt;                               /* loop counter */
+  const q31_t *pIn = pSrc;                       /* input pointer */
+
+  /* First pass, sum of the samples in 33.31 format */
+  for (blkCnt = blockSize >> 1u; blkCnt > 0u; blkCnt--)
+  {
+    sum0 += pIn[0];
+    sum1 += pIn[1];
+    pIn += 2;
+  }
+
+  if((blockSize & 1u) != 0u)
+  {
+    sum0 += *pIn;
+  }
+
+  mean = (q31_t) ((sum0 + sum1) / (q63_t) blockSize);
+
+  /* Second pass, the deviations are downshifted to 2.23 and the squares accumulated in 18.46 */
+  sum0 = sum1 = 0;
+  pIn = pSrc;
+
+  for (blkCnt = blockSize >> 1u; blkCnt > 0u; blkCnt--)
+  {
+    d0 = (q31_t) (((q63_t) pIn[0] - mean) >> 8);
+    d1 = (q31_t) (((q63_t) pIn[1] - mean) >> 8);
+    sum0 += (q63_t) d0 * d0;
+    sum1 += (q63_t) d1 * d1;
+    pIn += 2;
+  }
+
+  if((blockSize & 1u) != 0u)
+  {
+    d0 = (q31_t) (((q63_t) *pIn - mean) >> 8);
+    sum0 += (q63_t) d0 * d0;
+  }
+
+  *pMean = mean;
+  *pM2 = sum0 + sum1;
+}
+
+/*
+* @brief  Correction term delta^2 * countA * countB / count of the update in 18.46 format.
+*/
+
+static q63_t riscv_running_stats_term_q31(
+  q63_t delta,
+  uint32_t countA,
+  uint32_t countB,
+  uint32_t count)
+{
+  q63_t d = delta >> 8;                          /* Difference of the means in 2.23 format */
+
+  /* countA * countB / count is at most min(countA, countB), the products cannot overflow */
+  return ((((d * d) / (q63_t) count) * (q63_t) countA) * (q63_t) countB);
+}
+
+/*
+* @brief  Adds the statistics of a set of samples to an instance.
+*/
+
+static void riscv_running_stats_combine_q31(
+  riscv_running_stats_instance_q31 * S,
+  uint32_t countB,
+  q31_t meanB,
+  q63_t m2B)
+{
+  uint32_t countA = S->count;                    /* Samples of the instance */
+  uint32_t count = countA + countB;              /* Samples after the update */
+  q63_t delta;                                   /* Difference of the means in 2.31 format */
+
+  if(countB == 0u)
+  {
+    return;
+  }
+
+  delta = (q63_t) meanB - S->mean;
+
+  S->mean += (q31_t) ((delta * (q63_t) countB) / (q63_t) count);
+  S->m2 += m2B + riscv_running_stats_term_q31(delta, countA, countB, count);
+  S->count = count;
+}
+
+/**
+ * @brief  Adds a block of samples to the Q31 running statistics.
+ * @param[in,out]   *S points to an instance of the Q31 running statistics structure
+ * @param[in]       *pSrc points to the block of input data
+ * @param[in]       blockSize number of samples to add
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The mean is kept in 1.31 format.  The deviations from the mean are downshifted by 8 bits to 2.23 format
+ * as in riscv_var_q31(), and their squares are accumulated in a 64-bit value in 18.46 format.
+ * A single squared deviation is below 2^2, so there is no risk of overflow while the instance holds
+ * less than 2^15 samples.
+ */
+
+void riscv_running_stats_push_q31(
+  riscv_running_stats_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_running_stats_push_q31);
+  q31_t mean;                                    /* Statistics of the block */
+  q63_t m2;
+
+  if(blockSize > 0u)
+  {
+    riscv_running_stats_block_q31(pSrc, blockSize, &mean, &m2);
+    riscv_running_stats_combine_q31(S, blockSize, mean, m2);
+  }
+}
+
+/**
+ * @brief  Removes a block of previously added samples from the Q31 running statistics.
+ * @param[in,out]   *S points to an instance of the Q31 running statistics structure
+ * @param[in]       *pSrc points to the block of samples to remove
+ * @param[in]       blockSize number of samples to remove
+ * @return none.
+ *
+ * The instance is reset when <code>blockSize</code> is not smaller than the number of samples of the instance.
+ */
+
+void riscv_running_stats_evict_q31(
+  riscv_running_stats_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_running_stats_evict_q31);
+  q31_t meanB;                                   /* Statistics of the removed block */
+  q63_t m2B, m2, delta;
+  uint32_t countA;                               /* Samples that remain */
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  if(blockSize >= S->count)
+  {
+    riscv_running_stats_init_q31(S);
+    return;
+  }
+
+  riscv_running_stats_block_q31(pSrc, blockSize, &meanB, &m2B);
+  countA = S->count - blockSize;
+
+  /* Mean of the remaining samples, then the update of riscv_running_stats_combine_q31() backwards */
+  delta = (q63_t) S->mean - meanB;
+  S->mean = clip_q63_to_q31(S->mean + ((delta * (q63_t) blockSize) / (q63_t) countA));
+  delta = (q63_t) meanB - S->mean;
+  m2 = S->m2 - m2B - riscv_running_stats_term_q31(delta, countA, blockSize, S->count);
+
+  S->m2 = (m2 > 0) ? m2 : 0;
+  S->count = countA;
+}
+
+/**
+ * @brief  Merges two Q31 running statistics.
+ * @param[in,out]   *S points to the instance that receives the samples of <code>pSrc</code>
+ * @param[in]       *pSrc points to the instance to merge
+ * @return none.
+ */
+
+void riscv_running_stats_merge_q31(
+  riscv_running_stats_instance_q31 * S,
+  const riscv_running_stats_instance_q31 * pSrc)
+{
+  RISCV_PROFILE(riscv_running_stats_merge_q31);
+  riscv_running_stats_combine_q31(S, pSrc->count, pSrc->mean, pSrc->m2);
+}
+
+/**
+ * @brief  Mean, variance and standard deviation of the Q31 running statistics.
+ * @param[in]       *S points to an instance of the Q31 running statistics structure
+ * @param[out]      *pMean mean value returned here
+ * @param[out]      *pVar variance value returned here
+ * @param[out]      *pStd standard deviation value returned here
+ * @return none.
+ *
+ * The 18.46 variance is right shifted by 15 bits to yield a 1.31 format value, as in riscv_var_q31().
+ * The variance and standard deviation are 0 for less than two samples.
+ */
+
+void riscv_running_stats_get_q31(
+  const riscv_running_stats_instance_q31 * S,
+  q31_t * pMean,
+  q31_t * pVar,
+  q31_t * pStd)
+{
+  RISCV_PROFILE(riscv_running_stats_get_q31);
+  q31_t var = 0;                                 /* Temporary variance storage */
+
+  if(S->count > 1u)
+  {
+    var = clip_q63_to_q31((S->m2 / (q63_t) (S->count - 1u)) >> 15);
+  }
+
+  *pMean = S->mean;
+  *pVar = var;
+  riscv_sqrt_q31(var, pStd);
+}
+
+/**
+ * @} end of RunningStats group
+ */
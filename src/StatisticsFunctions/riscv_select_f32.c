@@ -0,0 +1,217 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_select_f32.c
+*
+* Description:  Selection, median and percentile of a floating-point vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Median Median and percentiles
+ *
+ * riscv_select_f32() and riscv_select_q15() return the <code>k</code>-th smallest sample of a vector
+ * (<code>k</code> = 0 is the minimum) without sorting it.  They partition the vector in place around
+ * the median of three samples, as quicksort, but only continue with the part that holds rank
+ * <code>k</code>, which takes a linear time on average.  On return the vector is reordered so that
+ * the sample at index <code>k</code> is the result, no sample before it is greater and no sample
+ * after it is smaller.
+ * \par
+ * The median and percentile functions copy the input to <code>pScratch</code> and select from the copy,
+ * so the input is left unchanged.
+ * For an even <code>blockSize</code> the median is the mean of the two middle samples.
+ * The percentile <code>p</code> interpolates linearly between the samples of rank
+ * <code>floor(p*(blockSize-1))</code> and the next one:
+ * <pre>
+ *     pos    = p * (blockSize - 1)
+ *     result = x[floor(pos)] + (pos - floor(pos)) * (x[floor(pos) + 1] - x[floor(pos)])
+ * </pre>
+ * where <code>x</code> is the sorted input, so <code>p</code> = 0, 0.5 and 1 give the minimum, the median and
+ * the maximum.  The second sample is the minimum of the part after rank <code>floor(pos)</code> and costs
+ * no second selection.
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/**
+ * @brief k-th smallest element of a floating-point vector, in place.
+ * @param[in,out]   *pSrc points to the input vector, partially reordered on return
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       k rank of the element, less than <code>blockSize</code>
+ * @param[out]      *pResult k-th smallest value returned here
+ * @return none.
+ */
+
+void riscv_select_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pResult)
+{
+  RISCV_PROFILE(riscv_select_f32);
+  int32_t lo = 0, hi = (int32_t) blockSize - 1;  /* Part that holds rank k */
+  int32_t i, j, mid;                             /* Partition indices */
+  int32_t rank = (int32_t) k;                    /* Rank of the result */
+  float32_t pivot, temp;
+
+  while(lo < hi)
+  {
+    /* Order pSrc[lo] <= pSrc[mid] <= pSrc[hi] and take the middle one as pivot */
+    mid = lo + ((hi - lo) >> 1);
+
+    if(pSrc[mid] < pSrc[lo])
+    {
+      temp = pSrc[mid]; pSrc[mid] = pSrc[lo]; pSrc[lo] = temp;
+    }
+    if(pSrc[hi] < pSrc[lo])
+    {
+      temp = pSrc[hi]; pSrc[hi] = pSrc[lo]; pSrc[lo] = temp;
+    }
+    if(pSrc[hi] < pSrc[mid])
+    {
+      temp = pSrc[hi]; pSrc[hi] = pSrc[mid]; pSrc[mid] = temp;
+    }
+
+    pivot = pSrc[mid];
+    i = lo;
+    j = hi;
+
+    /* Hoare partition, [lo, j] <= pivot <= [i, hi] */
+    while(i <= j)
+    {
+      while(pSrc[i] < pivot)
+      {
+        i++;
+      }
+      while(pSrc[j] > pivot)
+      {
+        j--;
+      }
+      if(i <= j)
+      {
+        temp = pSrc[i]; pSrc[i] = pSrc[j]; pSrc[j] = temp;
+        i++;
+        j--;
+      }
+    }
+
+    if(rank <= j)
+    {
+      hi = j;
+    }
+    else if(rank >= i)
+    {
+      lo = i;
+    }
+    else
+    {
+      /* The samples between j and i are equal to the pivot */
+      break;
+    }
+  }
+
+  *pResult = pSrc[k];
+}
+
+/**
+ * @brief Median of a floating-point vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       *pScratch points to a buffer of <code>blockSize</code> values
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult median value returned here
+ * @return none.
+ */
+
+void riscv_median_f32(
+  float32_t * pSrc,
+  float32_t * pScratch,
+  uint32_t blockSize,
+  float32_t * pResult)
+{
+  RISCV_PROFILE(riscv_median_f32);
+  float32_t upper, lower;                        /* The two middle samples */
+  uint32_t i;
+
+  memcpy(pScratch, pSrc, blockSize * sizeof(float32_t));
+  riscv_select_f32(pScratch, blockSize, blockSize >> 1u, &upper);
+
+  if((blockSize & 1u) == 0u)
+  {
+    /* The lower middle sample is the maximum of the part before the upper one */
+    lower = pScratch[0];
+    for (i = 1u; i < (blockSize >> 1u); i++)
+    {
+      lower = (pScratch[i] > lower) ? pScratch[i] : lower;
+    }
+
+    upper = 0.5f * (lower + upper);
+  }
+
+  *pResult = upper;
+}
+
+/**
+ * @brief Percentile of a floating-point vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       *pScratch points to a buffer of <code>blockSize</code> values
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       p fraction of the samples below the result, from 0 to 1
+ * @param[out]      *pResult percentile value returned here
+ * @return none.
+ */
+
+void riscv_percentile_f32(
+  float32_t * pSrc,
+  float32_t * pScratch,
+  uint32_t blockSize,
+  float32_t p,
+  float32_t * pResult)
+{
+  RISCV_PROFILE(riscv_percentile_f32);
+  float32_t pos = p * (float32_t) (blockSize - 1u);  /* Fractional rank */
+  float32_t lower, upper, frac;                  /* Neighbouring samples and weight of the upper one */
+  uint32_t k, i;
+
+  /* Clamp the rank to the samples */
+  if(pos < 0.0f)
+  {
+    pos = 0.0f;
+  }
+
+  k = (uint32_t) pos;
+  if(k > (blockSize - 1u))
+  {
+    k = blockSize - 1u;
+  }
+  frac = pos - (float32_t) k;
+
+  memcpy(pScratch, pSrc, blockSize * sizeof(float32_t));
+  riscv_select_f32(pScratch, blockSize, k, &lower);
+
+  if((frac > 0.0f) && ((k + 1u) < blockSize))
+  {
+    /* The next sample is the minimum of the part after rank k */
+    upper = pScratch[k + 1u];
+    for (i = k + 2u; i < blockSize; i++)
+    {
+      upper = (pScratch[i] < upper) ? pScratch[i] : upper;
+    }
+
+    lower += frac * (upper - lower);
+  }
+
+  *pResult = lower;
+}
+
+/**
+ * @} end of Median group
+ */
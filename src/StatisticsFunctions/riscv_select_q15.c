@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_select_q15.c
+*
+* Description:  Selection, median and percentile of a Q15 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/**
+ * @brief k-th smallest element of a Q15 vector, in place.
+ * @param[in,out]   *pSrc points to the input vector, partially reordered on return
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       k rank of the element, less than <code>blockSize</code>
+ * @param[out]      *pResult k-th smallest value returned here
+ * @return none.
+ */
+
+void riscv_select_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pResult)
+{
+  RISCV_PROFILE(riscv_select_q15);
+  int32_t lo = 0, hi = (int32_t) blockSize - 1;  /* Part that holds rank k */
+  int32_t i, j, mid;                             /* Partition indices */
+  int32_t rank = (int32_t) k;                    /* Rank of the result */
+  q15_t pivot, temp;
+
+  while(lo < hi)
+  {
+    /* Order pSrc[lo] <= pSrc[mid] <= pSrc[hi] and take the middle one as pivot */
+    mid = lo + ((hi - lo) >> 1);
+
+    if(pSrc[mid] < pSrc[lo])
+    {
+      temp = pSrc[mid]; pSrc[mid] = pSrc[lo]; pSrc[lo] = temp;
+    }
+    if(pSrc[hi] < pSrc[lo])
+    {
+      temp = pSrc[hi]; pSrc[hi] = pSrc[lo]; pSrc[lo] = temp;
+    }
+    if(pSrc[hi] < pSrc[mid])
+    {
+      temp = pSrc[hi]; pSrc[hi] = pSrc[mid]; pSrc[mid] = temp;
+    }
+
+    pivot = pSrc[mid];
+    i = lo;
+    j = hi;
+
+    /* Hoare partition, [lo, j] <= pivot <= [i, hi] */
+    while(i <= j)
+    {
+      while(pSrc[i] < pivot)
+      {
+        i++;
+      }
+      while(pSrc[j] > pivot)
+      {
+        j--;
+      }
+      if(i <= j)
+      {
+        temp = pSrc[i]; pSrc[i] = pSrc[j]; pSrc[j] = temp;
+        i++;
+        j--;
+      }
+    }
+
+    if(rank <= j)
+    {
+      hi = j;
+    }
+    else if(rank >= i)
+    {
+      lo = i;
+    }
+    else
+    {
+      /* The samples between j and i are equal to the pivot */
+      break;
+    }
+  }
+
+  *pResult = pSrc[k];
+}
+
+/**
+ * @brief Median of a Q15 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       *pScratch points to a buffer of <code>blockSize</code> values
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult median value returned here
+ * @return none.
+ *
+ * The mean of the two middle samples of an even <code>blockSize</code> is truncated to 1.15 format.
+ */
+
+void riscv_median_q15(
+  q15_t * pSrc,
+  q15_t * pScratch,
+  uint32_t blockSize,
+  q15_t * pResult)
+{
+  RISCV_PROFILE(riscv_median_q15);
+  q15_t upper, lower;                            /* The two middle samples */
+  uint32_t i;
+
+  memcpy(pScratch, pSrc, blockSize * sizeof(q15_t));
+  riscv_select_q15(pScratch, blockSize, blockSize >> 1u, &upper);
+
+  if((blockSize & 1u) == 0u)
+  {
+    /* The lower middle sample is the maximum of the part before the upper one */
+    lower = pScratch[0];
+    for (i = 1u; i < (blockSize >> 1u); i++)
+    {
+      lower = (pScratch[i] > lower) ? pScratch[i] : lower;
+    }
+
+    upper = (q15_t) (((q31_t) lower + upper) >> 1);
+  }
+
+  *pResult = upper;
+}
+
+/**
+ * @brief Percentile of a Q15 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       *pScratch points to a buffer of <code>blockSize</code> values
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       p fraction of the samples below the result in 1.15 format, from 0 to 0x7FFF
+ * @param[out]      *pResult percentile value returned here
+ * @return none.
+ *
+ * The fractional rank <code>p*(blockSize-1)</code> is computed in 17.15 format and the interpolated
+ * result is truncated to 1.15 format.  <code>p</code> = 0x7FFF returns the maximum for a <code>blockSize</code>
+ * of at most 32768.
+ */
+
+void riscv_percentile_q15(
+  q15_t * pSrc,
+  q15_t * pScratch,
+  uint32_t blockSize,
+  q15_t p,
+  q15_t * pResult)
+{
+  RISCV_PROFILE(riscv_percentile_q15);
+  uint32_t pos;                                  /* Fractional rank in 17.15 format */
+  q15_t lower, upper;                            /* Neighbouring samples */
+  q31_t frac;                                    /* Weight of the upper sample in 1.15 format */
+  uint32_t k, i;
+
+  /* p = 0x7FFF is taken as 1 */
+  pos = (p >= 0x7FFF) ? ((blockSize - 1u) << 15) : ((uint32_t) ((p > 0) ? p : 0) * (blockSize - 1u));
+  k = pos >> 15;
+  frac = (q31_t) (pos & 0x7FFFu);
+
+  memcpy(pScratch, pSrc, blockSize * sizeof(q15_t));
+  riscv_select_q15(pScratch, blockSize, k, &lower);
+
+  if((frac > 0) && ((k + 1u) < blockSize))
+  {
+    /* The next sample is the minimum of the part after rank k */
+    upper = pScratch[k + 1u];
+    for (i = k + 2u; i < blockSize; i++)
+    {
+      upper = (pScratch[i] < upper) ? pScratch[i] : upper;
+    }
+
+    lower = (q15_t) (lower + ((((q31_t) upper - lower) * frac) >> 15));
+  }
+
+  *pResult = lower;
+}
+
+/**
+ * @} end of Median group
+ */
@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_spectral_features_f32.c
+*
+* Description:  Fused single-pass spectral features of a floating-point spectrum.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* Running sums kept for the rolloff search */
+#define RISCV_SPECTRAL_CHECKPOINTS 64u
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup AudioFeatures Audio features
+ *
+ * Per-frame features of audio classifiers.  riscv_spectral_features_f32() reads the magnitude
+ * spectrum of riscv_cmplx_mag_f32() or the power spectrum of riscv_cmplx_mag_squared_f32() once
+ * and derives the features selected by a mask of the <code>RISCV_SPECTRAL_*</code> flags from the
+ * sums of <code>X[k]</code>, <code>k*X[k]</code> and <code>k*k*X[k]</code>:
+ *
+ * <pre>
+ *     centroid = sum(k * X[k]) / sum(X[k])
+ *     spread   = sqrt(sum(k * k * X[k]) / sum(X[k]) - centroid * centroid)
+ *     rolloff  = first k with X[0] + ... + X[k] >= rolloff * sum(X[k])
+ *     flux     = sum((X[k] - Xprev[k])^2)
+ * </pre>
+ *
+ * The centroid, spread and rolloff are in bins, multiply them by <code>fs/fftLen</code> for Hz.
+ * The flux compares the frame with <code>pPrev</code> and leaves the frame there for the next
+ * call.  riscv_zcr_energy_q15() and riscv_zcr_energy_f32() count the sign changes of a frame and
+ * sum its squares in one pass; a zero counts as positive.  The zero crossing rate is
+ * <code>crossings/(blockSize-1)</code>.
+ */
+
+/**
+ * @addtogroup AudioFeatures
+ * @{
+ */
+
+/**
+ * @brief Fused spectral features of a magnitude or power spectrum.
+ * @param[in]       *pSpec points to the <code>numBins</code> magnitudes or powers
+ * @param[in,out]   *pPrev points to the previous spectrum, replaced by <code>pSpec</code>, used with RISCV_SPECTRAL_FLUX only
+ * @param[in]       numBins number of bins
+ * @param[in]       rolloff fraction of the sum for RISCV_SPECTRAL_ROLLOFF, 0 to 1
+ * @param[in]       flags RISCV_SPECTRAL_* mask of the features to compute
+ * @param[out]      *pResult features returned here, fields that are not selected are left unchanged
+ * @return none.
+ *
+ * \par
+ * The sum is always returned.  A spectrum whose sum is 0 has its centroid, spread and rolloff
+ * at 0.  The running sum is recorded every <code>numBins/64</code> bins during the pass, the
+ * rolloff search then only reads the bins of one of these steps again.
+ */
+
+void riscv_spectral_features_f32(
+  const float32_t * pSpec,
+  float32_t * pPrev,
+  uint32_t numBins,
+  float32_t rolloff,
+  uint32_t flags,
+  riscv_spectral_result_f32 * pResult)
+{
+  RISCV_PROFILE(riscv_spectral_features_f32);
+  float32_t checkpoint[RISCV_SPECTRAL_CHECKPOINTS]; /* Running sum before every step */
+  float32_t sum = 0.0f, sumK = 0.0f, sumK2 = 0.0f;  /* Moments */
+  float32_t flux = 0.0f;                         /* Squared distance */
+  float32_t k = 0.0f;                            /* Bin as a float */
+  float32_t x, d, kx, centroid, var, target;
+  const float32_t *pIn = pSpec;                  /* Input pointer */
+  float32_t *pOld = pPrev;                       /* Previous spectrum pointer */
+  uint32_t step = (numBins + RISCV_SPECTRAL_CHECKPOINTS - 1u) / RISCV_SPECTRAL_CHECKPOINTS;
+  uint32_t numSteps = 0u, first = 0u;            /* Steps of the pass */
+  uint32_t binCnt, i;                            /* Loop counters */
+
+  while(first < numBins)
+  {
+    checkpoint[numSteps++] = sum;
+    binCnt = ((numBins - first) < step) ? (numBins - first) : step;
+    first += binCnt;
+
+    if((flags & RISCV_SPECTRAL_FLUX) != 0u)
+    {
+      while(binCnt > 0u)
+      {
+        x = *pIn++;
+        kx = k * x;
+        sum += x;
+        sumK += kx;
+        sumK2 += k * kx;
+        k += 1.0f;
+
+        d = x - *pOld;
+        flux += d * d;
+        *pOld++ = x;
+
+        /* Decrement the loop counter */
+        binCnt--;
+      }
+    }
+    else
+    {
+      while(binCnt > 0u)
+      {
+        x = *pIn++;
+        kx = k * x;
+        sum += x;
+        sumK += kx;
+        sumK2 += k * kx;
+        k += 1.0f;
+
+        /* Decrement the loop counter */
+        binCnt--;
+      }
+    }
+  }
+
+  pResult->sum = sum;
+  centroid = (sum > 0.0f) ? (sumK / sum) : 0.0f;
+
+  if((flags & RISCV_SPECTRAL_CENTROID) != 0u)
+  {
+    pResult->centroid = centroid;
+  }
+
+  if((flags & RISCV_SPECTRAL_SPREAD) != 0u)
+  {
+    var = (sum > 0.0f) ? ((sumK2 / sum) - (centroid * centroid)) : 0.0f;
+    riscv_sqrt_f32((var > 0.0f) ? var : 0.0f, &pResult->spread);
+  }
+
+  if((flags & RISCV_SPECTRAL_ROLLOFF) != 0u)
+  {
+    target = rolloff * sum;
+    i = 0u;
+
+    if(target > 0.0f)
+    {
+      /* Last step that starts below the target, then the bins of that step */
+      while(((i + 1u) < numSteps) && (checkpoint[i + 1u] < target))
+      {
+        i++;
+      }
+
+      x = checkpoint[i];
+      i = i * step;
+      while((i + 1u) < numBins)
+      {
+        x += pSpec[i];
+        if(x >= target)
+        {
+          break;
+        }
+        i++;
+      }
+    }
+
+    pResult->rolloff = i;
+  }
+
+  if((flags & RISCV_SPECTRAL_FLUX) != 0u)
+  {
+    pResult->flux = flux;
+  }
+}
+
+/**
+ * @} end of AudioFeatures group
+ */
@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_stats_f32.c
+*
+* Description:  Fused single-pass statistics of a floating-point vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup FusedStats Fused statistics
+ *
+ * Computes several statistics of a vector in a single pass over the data.
+ * Calling riscv_mean_*(), riscv_var_*(), riscv_min_*() and riscv_max_*() one after the other reads
+ * the input once per function.  These functions read every sample once, accumulate the sum, the sum
+ * of squares and the extreme values together and derive the requested results from them:
+ *
+ * <pre>
+ *     mean  = sum / blockSize
+ *     var   = (sumOfSquares - sum * sum / blockSize) / (blockSize - 1)
+ *     std   = sqrt(var)
+ *     rms   = sqrt(sumOfSquares / blockSize)
+ *     power = sumOfSquares
+ * </pre>
+ *
+ * The results are selected with a mask of the <code>RISCV_STATS_*</code> flags and returned in
+ * a result structure, fields that are not selected are left unchanged.
+ * The indices are the ones of the first minimum and maximum value, as for riscv_min_*() and
+ * riscv_max_*().  <code>blockSize</code> must be at least 1, the variance of a single sample is 0.
+ * There are separate functions for Q15, Q31 and floating-point data types.
+ */
+
+/**
+ * @addtogroup FusedStats
+ * @{
+ */
+
+/**
+ * @brief Fused statistics of a floating-point vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       flags RISCV_STATS_* mask of the results to compute
+ * @param[out]      *pResult results returned here, fields that are not selected are left unchanged
+ * @return none.
+ *
+ * The results equal the ones of riscv_mean_f32(), riscv_var_f32(), riscv_std_f32(), riscv_rms_f32(),
+ * riscv_power_f32(), riscv_min_f32() and riscv_max_f32().
+ */
+
+void riscv_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t flags,
+  riscv_stats_result_f32 * pResult)
+{
+  RISCV_PROFILE(riscv_stats_f32);
+  float32_t sum = 0.0f;                          /* Temporary result storage */
+  float32_t sumOfSquares = 0.0f;                 /* Sum of squares */
+  float32_t var = 0.0f;                          /* Temporary variance storage */
+  float32_t minVal, maxVal;                      /* Extreme values */
+  float32_t in;                                  /* input value */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* Indices of the extreme values */
+  uint32_t i;                                    /* loop counter */
+
+  minVal = maxVal = pSrc[0];
+
+  /* Loop over blockSize number of values */
+  for (i = 0u; i < blockSize; i++)
+  {
+    in = *pSrc++;
+    sumOfSquares += in * in;
+    sum += in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+  }
+
+  if((flags & RISCV_STATS_MIN) != 0u)
+  {
+    pResult->min = minVal;
+    pResult->minIndex = minIndex;
+  }
+
+  if((flags & RISCV_STATS_MAX) != 0u)
+  {
+    pResult->max = maxVal;
+    pResult->maxIndex = maxIndex;
+  }
+
+  if((flags & RISCV_STATS_MEAN) != 0u)
+  {
+    pResult->mean = sum / (float32_t) blockSize;
+  }
+
+  if((flags & RISCV_STATS_POWER) != 0u)
+  {
+    pResult->power = sumOfSquares;
+  }
+
+  if((flags & RISCV_STATS_RMS) != 0u)
+  {
+    riscv_sqrt_f32(sumOfSquares / (float32_t) blockSize, &pResult->rms);
+  }
+
+  if((flags & (RISCV_STATS_VAR | RISCV_STATS_STD)) != 0u)
+  {
+    if(blockSize > 1u)
+    {
+      var = ((sumOfSquares - ((sum * sum) / (float32_t) blockSize)) / (float32_t) (blockSize - 1.0f));
+    }
+
+    if((flags & RISCV_STATS_VAR) != 0u)
+    {
+      pResult->var = var;
+    }
+
+    if((flags & RISCV_STATS_STD) != 0u)
+    {
+      riscv_sqrt_f32(var, &pResult->std);
+    }
+  }
+}
+
+/**
+ * @} end of FusedStats group
+ */
@@ -0,0 +1,220 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_stats_q15.c
+*
+* Description:  Fused single-pass statistics of a Q15 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup FusedStats
+ * @{
+ */
+
+/**
+ * @brief Fused statistics of a Q15 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       flags RISCV_STATS_* mask of the results to compute
+ * @param[out]      *pResult results returned here, fields that are not selected are left unchanged
+ * @return none.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The sum is accumulated in a 32-bit accumulator in 17.15 format and the sum of squares
+ * in a 64-bit accumulator in 34.30 format, as in riscv_mean_q15() and riscv_var_q15().
+ * Every result is derived from these two accumulators with the scaling of the corresponding
+ * function, so the results equal the ones of riscv_mean_q15(), riscv_var_q15(), riscv_std_q15(),
+ * riscv_rms_q15(), riscv_power_q15(), riscv_min_q15() and riscv_max_q15().
+ *
+ * \par
+ * With the DSP extension the samples are processed in pairs, the accumulators are updated
+ * with <code>dotpv2</code> and <code>sumdotpv2</code> and the extremes are tracked per lane
+ * with <code>max2</code> and <code>min2</code>.  The index of the first minimum and maximum
+ * is recovered afterwards with a scan that stops at the first match.
+ * <code>pSrc</code> must be 4-byte aligned in this case.
+ */
+
+void riscv_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t flags,
+  riscv_stats_result_q15 * pResult)
+{
+  RISCV_PROFILE(riscv_stats_q15);
+  q31_t sum = 0;                                 /* Accumulator */
+  q63_t sumOfSquares = 0;                        /* Accumulator */
+  q31_t meanOfSquares, squareOfMean;             /* square of mean and mean of square */
+  q15_t minVal, maxVal;                          /* Extreme values */
+  q15_t in;                                      /* input value */
+  q15_t *pIn = pSrc;                             /* input pointer */
+  uint32_t i;                                    /* loop counter */
+
+#if defined (USE_DSP_RISCV)
+
+  shortV VectIn, VectMin, VectMax;               /* Input pair and per lane extremes */
+  uint32_t blkCnt;                               /* loop counter */
+  shortV ones = pack2(1, 1);
+
+  minVal = maxVal = pSrc[0];
+  VectMin = VectMax = pack2(pSrc[0], pSrc[0]);
+
+  blkCnt = blockSize >> 1u;
+
+  if((flags & (RISCV_STATS_MIN | RISCV_STATS_MAX)) != 0u)
+  {
+    while(blkCnt > 0u)
+    {
+      VectIn = *(shortV *) pIn;
+      sumOfSquares += dotpv2(VectIn, VectIn);
+      sum = sumdotpv2(VectIn, ones, sum);
+      VectMax = max2(VectMax, VectIn);
+      VectMin = min2(VectMin, VectIn);
+      pIn += 2;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    minVal = (VectMin[0] < VectMin[1]) ? VectMin[0] : VectMin[1];
+    maxVal = (VectMax[0] > VectMax[1]) ? VectMax[0] : VectMax[1];
+  }
+  else
+  {
+    while(blkCnt > 0u)
+    {
+      VectIn = *(shortV *) pIn;
+      sumOfSquares += dotpv2(VectIn, VectIn);
+      sum = sumdotpv2(VectIn, ones, sum);
+      pIn += 2;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+
+  if((blockSize & 1u) != 0u)
+  {
+    in = *pIn;
+    sumOfSquares += ((q31_t) in * in);
+    sum += in;
+    minVal = (in < minVal) ? in : minVal;
+    maxVal = (in > maxVal) ? in : maxVal;
+  }
+
+  /* Recover the index of the first extreme value */
+  if((flags & RISCV_STATS_MIN) != 0u)
+  {
+    i = 0u;
+    while(pSrc[i] != minVal)
+    {
+      i++;
+    }
+
+    pResult->min = minVal;
+    pResult->minIndex = i;
+  }
+
+  if((flags & RISCV_STATS_MAX) != 0u)
+  {
+    i = 0u;
+    while(pSrc[i] != maxVal)
+    {
+      i++;
+    }
+
+    pResult->max = maxVal;
+    pResult->maxIndex = i;
+  }
+
+#else
+
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* Indices of the extreme values */
+
+  minVal = maxVal = pSrc[0];
+
+  /* Loop over blockSize number of values */
+  for (i = 0u; i < blockSize; i++)
+  {
+    in = *pIn++;
+    sumOfSquares += ((q31_t) in * in);
+    sum += in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+  }
+
+  if((flags & RISCV_STATS_MIN) != 0u)
+  {
+    pResult->min = minVal;
+    pResult->minIndex = minIndex;
+  }
+
+  if((flags & RISCV_STATS_MAX) != 0u)
+  {
+    pResult->max = maxVal;
+    pResult->maxIndex = maxIndex;
+  }
+
+#endif
+
+  if((flags & RISCV_STATS_MEAN) != 0u)
+  {
+    pResult->mean = (q15_t) (sum / (q31_t) blockSize);
+  }
+
+  if((flags & RISCV_STATS_POWER) != 0u)
+  {
+    pResult->power = sumOfSquares;
+  }
+
+  if((flags & RISCV_STATS_RMS) != 0u)
+  {
+    riscv_sqrt_q15((q15_t) __SSAT((sumOfSquares / (q63_t) blockSize) >> 15, 16), &pResult->rms);
+  }
+
+  if((flags & (RISCV_STATS_VAR | RISCV_STATS_STD)) != 0u)
+  {
+    if(blockSize == 1u)
+    {
+      meanOfSquares = squareOfMean = 0;
+    }
+    else
+    {
+      meanOfSquares = (q31_t) (sumOfSquares / (q63_t) (blockSize - 1u));
+      squareOfMean = (q31_t) ((q63_t) sum * sum / (q63_t) (blockSize * (blockSize - 1u)));
+    }
+
+    if((flags & RISCV_STATS_VAR) != 0u)
+    {
+      pResult->var = (q15_t) ((meanOfSquares - squareOfMean) >> 15);
+    }
+
+    if((flags & RISCV_STATS_STD) != 0u)
+    {
+      riscv_sqrt_q15((q15_t) __SSAT((meanOfSquares - squareOfMean) >> 15, 16), &pResult->std);
+    }
+  }
+}
+
+/**
+ * @} end of FusedStats group
+ */
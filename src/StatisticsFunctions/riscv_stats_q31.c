@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_stats_q31.c
+*
+* Description:  Fused single-pass statistics of a Q31 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup FusedStats
+ * @{
+ */
+
+/**
+ * @brief Fused statistics of a Q31 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       flags RISCV_STATS_* mask of the results to compute
+ * @param[out]      *pResult results returned here, fields that are not selected are left unchanged
+ * @return none.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The sum is accumulated in a 64-bit accumulator in 33.31 format, as in riscv_mean_q31().
+ * The squares are truncated to 2.48 format and accumulated in a 64-bit accumulator in 16.48 format,
+ * as in riscv_power_q31(), so there is no risk of overflow for a blockSize below 2^15.
+ *
+ * \par
+ * The mean, minimum, maximum and power equal the results of riscv_mean_q31(), riscv_min_q31(),
+ * riscv_max_q31() and riscv_power_q31().
+ * The variance and standard deviation are computed in the 18.46 format of riscv_var_q31()
+ * from the two accumulators, and the input must be scaled down by log2(blockSize)-8 bits as for
+ * riscv_var_q31().  The root mean square is computed from the 16.48 sum of squares and does not
+ * need the scaling of riscv_rms_q31().  These three results may differ from the ones of the
+ * individual functions in the least significant bits.
+ */
+
+void riscv_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t flags,
+  riscv_stats_result_q31 * pResult)
+{
+  RISCV_PROFILE(riscv_stats_q31);
+  q63_t sum = 0;                                 /* Accumulator */
+  q63_t sumOfSquares = 0;                        /* Accumulator */
+  q63_t meanOfSquares, squareOfMean;             /* square of mean and mean of square */
+  q63_t sum23;                                   /* sum in 41.23 format */
+  q31_t minVal, maxVal;                          /* Extreme values */
+  q31_t in;                                      /* input value */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* Indices of the extreme values */
+  uint32_t i;                                    /* loop counter */
+
+  minVal = maxVal = pSrc[0];
+
+  /* Loop over blockSize number of values */
+  for (i = 0u; i < blockSize; i++)
+  {
+    in = *pSrc++;
+    sumOfSquares += ((q63_t) in * in) >> 14u;
+    sum += in;
+
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = i;
+    }
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = i;
+    }
+  }
+
+  if((flags & RISCV_STATS_MIN) != 0u)
+  {
+    pResult->min = minVal;
+    pResult->minIndex = minIndex;
+  }
+
+  if((flags & RISCV_STATS_MAX) != 0u)
+  {
+    pResult->max = maxVal;
+    pResult->maxIndex = maxIndex;
+  }
+
+  if((flags & RISCV_STATS_MEAN) != 0u)
+  {
+    pResult->mean = (q31_t) (sum / (int32_t) blockSize);
+  }
+
+  if((flags & RISCV_STATS_POWER) != 0u)
+  {
+    pResult->power = sumOfSquares;
+  }
+
+  if((flags & RISCV_STATS_RMS) != 0u)
+  {
+    /* 16.48 mean of squares to 1.31 */
+    riscv_sqrt_q31(clip_q63_to_q31((sumOfSquares / (q63_t) blockSize) >> 17), &pResult->rms);
+  }
+
+  if((flags & (RISCV_STATS_VAR | RISCV_STATS_STD)) != 0u)
+  {
+    if(blockSize == 1u)
+    {
+      meanOfSquares = squareOfMean = 0;
+    }
+    else
+    {
+      /* Mean of squares in 18.46 format and square of the mean of the 1.23 inputs */
+      sum23 = sum >> 8;
+      meanOfSquares = (sumOfSquares >> 2) / (q63_t) (blockSize - 1u);
+      squareOfMean = sum23 * sum23 / (q63_t) (blockSize * (blockSize - 1u));
+    }
+
+    if((flags & RISCV_STATS_VAR) != 0u)
+    {
+      pResult->var = (q31_t) ((meanOfSquares - squareOfMean) >> 15);
+    }
+
+    if((flags & RISCV_STATS_STD) != 0u)
+    {
+      riscv_sqrt_q31((q31_t) ((meanOfSquares - squareOfMean) >> 15), &pResult->std);
+    }
+  }
+}
+
+/**
+ * @} end of FusedStats group
+ */
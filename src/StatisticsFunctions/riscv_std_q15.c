@@ -77,6 +77,7 @@ void riscv_std_q15(
   uint32_t blockSize,
   q15_t * pResult)
 {
+  RISCV_PROFILE(riscv_std_q15);
   q31_t sum = 0;                                 /* Accumulator */
   q31_t meanOfSquares, squareOfMean;             /* square of mean and mean of square */
   uint32_t blkCnt;                               /* loop counter */
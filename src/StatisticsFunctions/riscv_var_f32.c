@@ -76,6 +76,9 @@
  * @param[out]      *pResult variance value returned here    
  * @return none.    
  *    
+ * \par
+ * The sum and the sum of squares are each split over two accumulators, which lets the additions of
+ * consecutive samples overlap in the FPU pipeline.
  */
 
 
@@ -84,10 +87,12 @@ void riscv_var_f32(
   uint32_t blockSize,
   float32_t * pResult)
 {
+  RISCV_PROFILE(riscv_var_f32);
 
   float32_t sum = 0.0f;                          /* Temporary result storage */
   float32_t sumOfSquares = 0.0f;                 /* Sum of squares */
-  float32_t in;                                  /* input value */
+  float32_t in, in1;                             /* input values */
+  float32_t sum1 = 0.0f, sumOfSquares1 = 0.0f;   /* Partial sums */
   uint32_t blkCnt;                               /* loop counter */
   
   float32_t squareOfSum;                         /* Square of Sum */
@@ -98,26 +103,36 @@ void riscv_var_f32(
 		return;
 	}
 
-  /* Loop over blockSize number of values */
-  blkCnt = blockSize;
+  /* Two independent sums of each kind hide the latency of the FPU additions */
+  blkCnt = blockSize >> 1u;
 
   while(blkCnt > 0u)
   {
     /* C = (A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1]) */
-    /* Compute Sum of squares of the input samples     
-     * and then store the result in a temporary variable, sumOfSquares. */
-    in = *pSrc++;
-    sumOfSquares += in * in;
-
     /* C = (A[0] + A[1] + ... + A[blockSize-1]) */
-    /* Compute Sum of the input samples     
-     * and then store the result in a temporary variable, sum. */
+    in = pSrc[0];
+    in1 = pSrc[1];
+    sumOfSquares += in * in;
+    sumOfSquares1 += in1 * in1;
     sum += in;
+    sum1 += in1;
+    pSrc += 2;
 
     /* Decrement the loop counter */
     blkCnt--;
   }
 
+  /* Remaining sample */
+  if((blockSize & 1u) != 0u)
+  {
+    in = *pSrc;
+    sumOfSquares += in * in;
+    sum += in;
+  }
+
+  sum += sum1;
+  sumOfSquares += sumOfSquares1;
+
   /* Compute the square of sum */
   squareOfSum = ((sum * sum) / (float32_t) blockSize);
 
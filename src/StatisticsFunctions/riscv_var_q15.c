@@ -79,6 +79,7 @@ void riscv_var_q15(
   uint32_t blockSize,
   q15_t * pResult)
 {
+  RISCV_PROFILE(riscv_var_q15);
 
   q31_t sum = 0;                                 /* Accumulator */
   q31_t meanOfSquares, squareOfMean;             /* square of mean and mean of square */
@@ -82,6 +82,7 @@ void riscv_var_q31(
   uint32_t blockSize,
   q31_t * pResult)
 {
+  RISCV_PROFILE(riscv_var_q31);
   q63_t sum = 0;                                 /* Accumulator */
   q63_t meanOfSquares, squareOfMean;             /* square of mean and mean of square */
   q31_t in;                                      /* input value */
@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_var_q7.c
+*
+* Description:  Variance of an array of Q7 type.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup variance
+ * @{
+ */
+
+/**
+ * @brief Variance of the elements of a Q7 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult variance value returned here
+ * @return none.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using 32-bit internal accumulators.
+ * The input is represented in 1.7 format.
+ * Intermediate multiplication yields a 2.14 format, and this
+ * result is added without saturation to an accumulator in 18.14 format.
+ * With 17 guard bits in the accumulator, there is no risk of overflow for up to
+ * 131072 samples, and the full precision of the intermediate multiplication is preserved.
+ * Finally, the 2.14 variance is shifted to 1.15 format and saturated, which keeps
+ * 7 more bits than a result in Q7.
+ *
+ * \par
+ * With <code>USE_DSP_RISCV</code> four samples are squared and summed per
+ * sumdotpv4, the sum of the samples is a sumdotpv4 against ones.
+ */
+
+void riscv_var_q7(
+  q7_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pResult)
+{
+  RISCV_PROFILE(riscv_var_q7);
+
+  q31_t sum = 0;                                 /* Accumulator */
+  q31_t sumOfSquares = 0;                        /* Accumulator */
+  q31_t meanOfSquares, squareOfMean;             /* square of mean and mean of square */
+  uint32_t blkCnt;                               /* loop counter */
+  q7_t in;                                       /* input value */
+#if defined (USE_DSP_RISCV)
+  charV VectInA;                                 /* four input values */
+  charV ones = {1, 1, 1, 1};                     /* weights of the sum */
+#endif
+
+  if(blockSize <= 1u)
+  {
+    *pResult = 0;
+    return;
+  }
+
+#if defined (USE_DSP_RISCV)
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = A[0] * A[0] + A[1] * A[1] + A[2] * A[2] + A[3] * A[3] */
+    VectInA = *(charV *) pSrc;
+    sumOfSquares = sumdotpv4(VectInA, VectInA, sumOfSquares);
+
+    /* C = A[0] + A[1] + A[2] + A[3] */
+    sum = sumdotpv4(VectInA, ones, sum);
+    pSrc += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 3u;
+#else
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+#endif
+
+  while(blkCnt > 0u)
+  {
+    /* C = (A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1]) */
+    in = *pSrc++;
+    sumOfSquares += ((q15_t) in * in);
+
+    /* C = (A[0] + A[1] + A[2] + ... + A[blockSize-1]) */
+    sum += in;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Compute Mean of squares of the input samples, 2.14 */
+  meanOfSquares = sumOfSquares / (q31_t) (blockSize - 1u);
+
+  /* Compute square of mean, 2.14 */
+  squareOfMean = (q31_t) (((q63_t) sum * sum) / ((q63_t) blockSize * (blockSize - 1u)));
+
+  /* mean of the squares minus the square of the mean, in 1.15 */
+  *pResult = (q15_t) __SSAT((meanOfSquares - squareOfMean) << 1, 16);
+}
+
+/**
+ * @} end of variance group
+ */
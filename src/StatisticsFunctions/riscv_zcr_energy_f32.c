@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_zcr_energy_f32.c
+*
+* Description:  Zero crossings and energy of a floating-point frame.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup AudioFeatures
+ * @{
+ */
+
+/**
+ * @brief Zero crossings and energy of a floating-point frame.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector, at least 1
+ * @param[out]      *pCrossings number of sign changes between neighbouring samples returned here
+ * @param[out]      *pEnergy sum of squares returned here
+ * @return none.
+ *
+ * \par
+ * A sample is negative when it is below 0, <code>-0.0f</code> counts as positive.
+ */
+
+void riscv_zcr_energy_f32(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t * pCrossings,
+  float32_t * pEnergy)
+{
+  RISCV_PROFILE(riscv_zcr_energy_f32);
+  float32_t energy;                              /* Accumulator */
+  float32_t in;                                  /* Input value */
+  uint32_t crossings = 0u;                       /* Sign changes */
+  uint32_t neg, prevNeg;                         /* Signs of the sample and of the previous one */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  in = *pSrc++;
+  energy = in * in;
+  prevNeg = (in < 0.0f);
+
+  blkCnt = blockSize - 1u;
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    energy += in * in;
+    neg = (in < 0.0f);
+    crossings += neg ^ prevNeg;
+    prevNeg = neg;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  *pCrossings = crossings;
+  *pEnergy = energy;
+}
+
+/**
+ * @} end of AudioFeatures group
+ */
@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_zcr_energy_q15.c
+*
+* Description:  Zero crossings and energy of a Q15 frame.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup AudioFeatures
+ * @{
+ */
+
+/**
+ * @brief Zero crossings and energy of a Q15 frame.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector, at least 1
+ * @param[out]      *pCrossings number of sign changes between neighbouring samples returned here
+ * @param[out]      *pEnergy sum of squares in 34.30 format returned here
+ * @return none.
+ *
+ * \par
+ * The energy is the result of riscv_power_q15().  Two neighbours change sign when the sign bit
+ * of their exclusive or is set.  With the DSP extension a word of two samples and the pair that
+ * straddles it and the previous word are combined with one <code>pv.shuffle2.h</code>, the two
+ * sign bits of their exclusive or are spread with <code>pv.sra.h</code> and counted with one
+ * <code>sumdotpv2</code>, and the squares are summed with one <code>dotpv2</code>, whose 32-bit
+ * sum wraps when both samples of a word are -32768.  <code>pSrc</code> must be 4-byte aligned
+ * in this case.
+ */
+
+void riscv_zcr_energy_q15(
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t * pCrossings,
+  q63_t * pEnergy)
+{
+  RISCV_PROFILE(riscv_zcr_energy_q15);
+  q63_t energy;                                  /* Accumulator */
+  q15_t in, prev;                                /* Input value and the previous one */
+  uint32_t crossings = 0u;                       /* Sign changes */
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined (USE_DSP_RISCV)
+
+  shortV VectIn, VectPrev;                       /* Current and previous pair */
+  shortV straddle = { 1, 2 };                    /* {previous[1], current[0]} */
+  shortV sign = { 15, 15 };                      /* Spreads the sign bit over a lane */
+  shortV ones = { 1, 1 };
+  q31_t count;                                   /* Minus the number of sign changes */
+
+  if(blockSize < 2u)
+  {
+    in = *pSrc;
+    *pCrossings = 0u;
+    *pEnergy = (q31_t) in * in;
+    return;
+  }
+
+  VectPrev = *(const shortV *) pSrc;
+  energy = dotpv2(VectPrev, VectPrev);
+  count = ((VectPrev[0] ^ VectPrev[1]) < 0) ? -1 : 0;
+  pSrc += 2;
+
+  blkCnt = (blockSize >> 1u) - 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* Lane 0 compares x[2i-1] with x[2i], lane 1 x[2i] with x[2i+1] */
+    VectIn = *(const shortV *) pSrc;
+    count = sumdotpv2(sra2(shufflev4(VectPrev, VectIn, straddle) ^ VectIn, sign), ones, count);
+    energy += dotpv2(VectIn, VectIn);
+    VectPrev = VectIn;
+    pSrc += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  crossings = (uint32_t) -count;
+  prev = VectPrev[1];
+  blkCnt = blockSize & 1u;
+
+#else
+
+  prev = *pSrc++;
+  energy = (q31_t) prev * prev;
+
+  blkCnt = blockSize - 1u;
+
+#endif
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    energy += (q31_t) in * in;
+    crossings += (uint32_t) ((in ^ prev) < 0);
+    prev = in;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  *pCrossings = crossings;
+  *pEnergy = energy;
+}
+
+/**
+ * @} end of AudioFeatures group
+ */
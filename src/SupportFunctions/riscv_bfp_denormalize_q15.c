@@ -0,0 +1,56 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_bfp_denormalize_q15.c
+*
+* Description:  Converts a Q15 block floating-point vector to plain Q15.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup BFP
+ * @{
+ */
+
+/**
+ * @brief Converts a Q15 block floating-point vector to Q15 values.
+ * @param[in]       *pBlock points to the block
+ * @param[out]      *pDst points to the Q15 output vector of <code>pBlock->blockSize</code> values
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The mantissas are shifted by <code>exponent</code> with riscv_shift_q15(),
+ * results outside of the 1.15 range are saturated.
+ * Exponents beyond +/-15 give the same result as +/-15.
+ * <code>pDst</code> may be equal to <code>pBlock->pData</code>.
+ */
+
+void riscv_bfp_denormalize_q15(
+  const riscv_bfp_q15 * pBlock,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_bfp_denormalize_q15);
+  int32_t exponent = pBlock->exponent;           /* Shift of the block */
+
+  if(exponent > 15)
+  {
+    exponent = 15;
+  }
+  else if(exponent < -15)
+  {
+    exponent = -15;
+  }
+
+  riscv_shift_q15(pBlock->pData, (int8_t) exponent, pDst, pBlock->blockSize);
+}
+
+/**
+ * @} end of BFP group
+ */
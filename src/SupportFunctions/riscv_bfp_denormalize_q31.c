@@ -0,0 +1,56 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_bfp_denormalize_q31.c
+*
+* Description:  Converts a Q31 block floating-point vector to plain Q31.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup BFP
+ * @{
+ */
+
+/**
+ * @brief Converts a Q31 block floating-point vector to Q31 values.
+ * @param[in]       *pBlock points to the block
+ * @param[out]      *pDst points to the Q31 output vector of <code>pBlock->blockSize</code> values
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The mantissas are shifted by <code>exponent</code> with riscv_shift_q31(),
+ * results outside of the 1.31 range are saturated.
+ * Exponents beyond +/-31 give the same result as +/-31.
+ * <code>pDst</code> may be equal to <code>pBlock->pData</code>.
+ */
+
+void riscv_bfp_denormalize_q31(
+  const riscv_bfp_q31 * pBlock,
+  q31_t * pDst)
+{
+  RISCV_PROFILE(riscv_bfp_denormalize_q31);
+  int32_t exponent = pBlock->exponent;           /* Shift of the block */
+
+  if(exponent > 31)
+  {
+    exponent = 31;
+  }
+  else if(exponent < -31)
+  {
+    exponent = -31;
+  }
+
+  riscv_shift_q31(pBlock->pData, (int8_t) exponent, pDst, pBlock->blockSize);
+}
+
+/**
+ * @} end of BFP group
+ */
@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_bfp_normalize_q15.c
+*
+* Description:  Normalizes a Q15 block floating-point vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup BFP Block Floating-Point Normalization
+ *
+ * A block floating-point vector stores fixed-point mantissas that share one exponent,
+ * element <code>n</code> has the value
+ * <pre>
+ *     pData[n] * 2^exponent
+ * </pre>
+ * with <code>pData[n]</code> read as a 1.15 or 1.31 fraction.
+ * A chain of fixed-point kernels only keeps its precision when the data uses the full range of the
+ * format.  The normalize functions shift the mantissas left by the common headroom of the block,
+ * the number of redundant sign bits of the element with the largest magnitude, and lower the
+ * exponent by the same amount, the values of the block are unchanged.
+ * The denormalize functions return the plain fixed-point values of a block.
+ *
+ * \par
+ * The headroom is found without a comparison per element: <code>x ^ (x >> 15)</code> clears the
+ * redundant sign bits of <code>x</code>, and the OR of these words over the block has the
+ * headroom of the block as its number of leading zeros.  With the DSP extension the Q15
+ * function handles two elements per word with <code>pv.sra.h</code>.
+ *
+ * \par
+ * riscv_cfft_bfp_q15() and riscv_mat_mult_bfp_q15() keep the exponent up to date over a transform
+ * or a matrix product.
+ */
+
+/**
+ * @addtogroup BFP
+ * @{
+ */
+
+/**
+ * @brief Normalizes a Q15 block floating-point vector.
+ * @param[in,out]   *pBlock points to the block, the mantissas are shifted in place and the exponent is updated
+ * @return none.
+ *
+ * \par
+ * After the call the largest magnitude of the block is in [0.5, 1).
+ * A block where every mantissa is 0 or -1 is left unchanged.
+ * With the DSP extension <code>pBlock->pData</code> must be 4-byte aligned.
+ */
+
+void riscv_bfp_normalize_q15(
+  riscv_bfp_q15 * pBlock)
+{
+  RISCV_PROFILE(riscv_bfp_normalize_q15);
+  q15_t *pIn = pBlock->pData;                    /* Src pointer */
+  uint32_t acc = 0u;                             /* OR of the magnitudes */
+  uint32_t blkCnt;                               /* loop counter */
+  uint32_t shift;                                /* Headroom of the block */
+  q31_t in;                                      /* Input value */
+
+#if defined (USE_DSP_RISCV)
+
+  shortV VectIn;                                 /* Packed input */
+  shortV VectSign = pack2(15, 15);               /* Shift that gives the sign mask */
+  shortV VectAcc = pack2(0, 0);                  /* OR of the packed magnitudes */
+
+  /*loop Unrolling */
+  blkCnt = pBlock->blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    VectIn = *(shortV *) pIn;
+    VectAcc |= VectIn ^ sra2(VectIn, VectSign);
+    pIn += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  acc = (uint32_t) (VectAcc[0] | VectAcc[1]);
+
+  blkCnt = pBlock->blockSize % 0x2u;
+
+#else
+
+  blkCnt = pBlock->blockSize;
+
+#endif /* #if defined (USE_DSP_RISCV) */
+
+  while(blkCnt > 0u)
+  {
+    in = *pIn++;
+    acc |= (uint32_t) (in ^ (in >> 15));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* __CLZ() does not terminate for 0 */
+  if(acc != 0u)
+  {
+    shift = __CLZ(acc) - 17u;
+
+    if(shift != 0u)
+    {
+      riscv_shift_q15(pBlock->pData, (int8_t) shift, pBlock->pData, pBlock->blockSize);
+      pBlock->exponent -= (int16_t) shift;
+    }
+  }
+}
+
+/**
+ * @} end of BFP group
+ */
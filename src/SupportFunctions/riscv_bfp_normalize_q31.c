@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_bfp_normalize_q31.c
+*
+* Description:  Normalizes a Q31 block floating-point vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup BFP
+ * @{
+ */
+
+/**
+ * @brief Normalizes a Q31 block floating-point vector.
+ * @param[in,out]   *pBlock points to the block, the mantissas are shifted in place and the exponent is updated
+ * @return none.
+ *
+ * \par
+ * After the call the largest magnitude of the block is in [0.5, 1).
+ * A block where every mantissa is 0 or -1 is left unchanged.
+ */
+
+void riscv_bfp_normalize_q31(
+  riscv_bfp_q31 * pBlock)
+{
+  RISCV_PROFILE(riscv_bfp_normalize_q31);
+  q31_t *pIn = pBlock->pData;                    /* Src pointer */
+  uint32_t acc = 0u;                             /* OR of the magnitudes */
+  uint32_t blkCnt;                               /* loop counter */
+  uint32_t shift;                                /* Headroom of the block */
+  q31_t in1;                                     /* Input value */
+
+#if defined (USE_DSP_RISCV)
+
+  q31_t in2;                                     /* Second input value */
+
+  /*loop Unrolling */
+  blkCnt = pBlock->blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    in1 = *pIn++;
+    in2 = *pIn++;
+    acc |= (uint32_t) (in1 ^ (in1 >> 31)) | (uint32_t) (in2 ^ (in2 >> 31));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = pBlock->blockSize % 0x2u;
+
+#else
+
+  blkCnt = pBlock->blockSize;
+
+#endif /* #if defined (USE_DSP_RISCV) */
+
+  while(blkCnt > 0u)
+  {
+    in1 = *pIn++;
+    acc |= (uint32_t) (in1 ^ (in1 >> 31));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  if(acc != 0u)
+  {
+    shift = __CLZ(acc) - 1u;
+
+    if(shift != 0u)
+    {
+      riscv_shift_q31(pBlock->pData, (int8_t) shift, pBlock->pData, pBlock->blockSize);
+      pBlock->exponent -= (int16_t) shift;
+    }
+  }
+}
+
+/**
+ * @} end of BFP group
+ */
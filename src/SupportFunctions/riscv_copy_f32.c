@@ -78,14 +78,48 @@ void riscv_copy_f32(
   float32_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_copy_f32);
   uint32_t blkCnt;                               /* loop counter */
+
+#if defined (USE_DSP_RISCV) && defined (RISCV_MATH_LOOPUNROLL)
+
+  float32_t in1, in2, in3, in4;                  /* Temporary values */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = A */
+    /* Read four values before storing them so that the loads overlap */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+    pDst[0] = in1;
+    pDst[1] = in2;
+    pDst[2] = in3;
+    pDst[3] = in4;
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
   /* Loop over blockSize number of values */
   blkCnt = blockSize;
 
+#endif /* #if defined (USE_DSP_RISCV) && defined (RISCV_MATH_LOOPUNROLL) */
+
   while(blkCnt > 0u)
   {
     /* C = A */
-    /* Copy and then store the results in the destination buffer */
+    /* Copy and then store the value in the destination buffer */
     *pDst++ = *pSrc++;
 
     /* Decrement the loop counter */
@@ -56,7 +56,14 @@
  * @param[out]      *pDst points to output vector    
  * @param[in]       blockSize length of the input vector   
  * @return none.    
- *    
+ *
+ * \par
+ * With the DSP extension the samples are copied four at a time with word accesses once <code>pDst</code> is
+ * word aligned.  When <code>pSrc</code> is then one sample past a word boundary each stored pair is built from
+ * two aligned loads with one shuffle, so the buffers may have any alignment and no load is misaligned.  The
+ * first sample is read by halfword and the last 1 to 4 samples are copied one by one, so no sample outside
+ * <code>pSrc</code> is read.
+ * The samples are copied forward, so <code>pDst</code> may overlap <code>pSrc</code> from below.
  */
 
 void riscv_copy_q15(
@@ -64,27 +71,79 @@ void riscv_copy_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_copy_q15);
   uint32_t blkCnt;                               /* loop counter */
 #if defined (USE_DSP_RISCV)
-blkCnt = blockSize >>1;
+  uint32_t numSamples = blockSize;               /* Samples left to copy */
+  shortV in1, in2, in3;                          /* Packed samples */
+  shortV odd = { 1, 2 };                         /* Pair straddling two aligned pairs */
 
-  while(blkCnt > 0u)
+  /* Copy one sample when pDst is not word aligned */
+  if((numSamples > 0u) && (((uintptr_t) pDst & 2u) != 0u))
   {
-    /* C = A */
-    /* Copy and then store the results in the destination buffer */
-   *(shortV*)pDst =  *(shortV*)pSrc;
-   pDst+=2;
-   pSrc+=2;
+    *pDst++ = *pSrc++;
+    numSamples--;
+  }
 
-    /* Decrement the loop counter */
-    blkCnt--;
+  /* The word loop needs pSrc aligned as well */
+  if(((uintptr_t) pSrc & 2u) == 0u)
+  {
+    /*loop Unrolling */
+    blkCnt = numSamples >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* C = A */
+      /* Copy four samples with two word loads and two word stores */
+      in1 = *(shortV *) pSrc;
+      in2 = *(shortV *) (pSrc + 2);
+      *(shortV *) pDst = in1;
+      *(shortV *) (pDst + 2) = in2;
+      pDst += 4;
+      pSrc += 4;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    blkCnt = numSamples % 0x4u;
   }
-  blkCnt = blockSize % 0x2;
+  else
+  {
+    /* pSrc is one sample past a word boundary, each pair is built from two aligned loads.
+     * The loop stops while at least one sample is left, so its last load holds two samples of pSrc. */
+    blkCnt = (numSamples > 0u) ? ((numSamples - 1u) >> 2u) : 0u;
+
+    if(blkCnt > 0u)
+    {
+      /* Only the second half, pSrc[0], is used */
+      in1 = pack2(pSrc[0], pSrc[0]);
+    }
+
+    while(blkCnt > 0u)
+    {
+      /* C = A */
+      in2 = *(shortV *) (pSrc + 1);
+      in3 = *(shortV *) (pSrc + 3);
+      *(shortV *) pDst = shufflev4(in1, in2, odd);
+      *(shortV *) (pDst + 2) = shufflev4(in2, in3, odd);
+      in1 = in3;
+      pDst += 4;
+      pSrc += 4;
+      numSamples -= 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    blkCnt = numSamples;
+  }
+
   while(blkCnt > 0u)
   {
     /* C = A */
     /* Copy and then store the results in the destination buffer */
-   *pDst++ = *pSrc++;
+    *pDst++ = *pSrc++;
 
     /* Decrement the loop counter */
     blkCnt--;
@@ -57,7 +57,12 @@
  * @param[out]      *pDst points to output vector    
  * @param[in]       blockSize length of the input vector   
  * @return none.    
- *    
+ *
+ * \par
+ * With the DSP extension up to three samples are copied one by one until <code>pDst</code> is word aligned, and the
+ * rest eight at a time with word accesses.  When <code>pSrc</code> is then not aligned each stored word is built from
+ * two aligned loads with one shuffle, so the buffers may have any alignment and no load is misaligned; the aligned
+ * loads may read the other bytes of the words holding the first and last sample of <code>pSrc</code>.
  */
 
 void riscv_copy_q7(
@@ -65,22 +70,73 @@ void riscv_copy_q7(
   q7_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_copy_q7);
   uint32_t blkCnt;                               /* loop counter */
 #if defined (USE_DSP_RISCV)
-  blkCnt = blockSize >>2;
+  uint32_t numSamples = blockSize;               /* Samples left to copy */
+  charV in1, in2, in3, sel;                      /* Packed samples and the bytes to take */
+  uint32_t offset;                               /* Byte offset of pSrc in its word */
 
-  while(blkCnt > 0u)
+  /* Copy up to three samples until pDst is word aligned */
+  while((numSamples > 0u) && (((uintptr_t) pDst & 3u) != 0u))
   {
-    /* C = A */
-    /* Copy and then store the results in the destination buffer */
-   *(charV*)pDst =  *(charV*)pSrc;
-   pDst+=4;
-   pSrc+=4;
+    *pDst++ = *pSrc++;
+    numSamples--;
+  }
 
-    /* Decrement the loop counter */
-    blkCnt--;
+  /* The word loop needs pSrc aligned as well */
+  if(((uintptr_t) pSrc & 3u) == 0u)
+  {
+    /*loop Unrolling */
+    blkCnt = numSamples >> 3u;
+
+    while(blkCnt > 0u)
+    {
+      /* C = A */
+      /* Copy eight samples with two word loads and two word stores */
+      in1 = *(charV *) pSrc;
+      in2 = *(charV *) (pSrc + 4);
+      *(charV *) pDst = in1;
+      *(charV *) (pDst + 4) = in2;
+      pDst += 8;
+      pSrc += 8;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    blkCnt = numSamples % 0x8u;
   }
-  blkCnt = blockSize % 0x4;
+  else
+  {
+    /* Each four samples are bytes offset to offset+3 of two aligned words of pSrc */
+    blkCnt = numSamples >> 3u;
+    offset = (uintptr_t) pSrc & 3u;
+    sel = pack4(offset, offset + 1u, offset + 2u, offset + 3u);
+
+    if(blkCnt > 0u)
+    {
+      in1 = *(charV *) (pSrc - offset);
+    }
+
+    while(blkCnt > 0u)
+    {
+      /* C = A */
+      in2 = *(charV *) (pSrc - offset + 4);
+      in3 = *(charV *) (pSrc - offset + 8);
+      *(charV *) pDst = shuffle2b(in1, in2, sel);
+      *(charV *) (pDst + 4) = shuffle2b(in2, in3, sel);
+      in1 = in3;
+      pDst += 8;
+      pSrc += 8;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    blkCnt = numSamples % 0x8u;
+  }
+
   while(blkCnt > 0u)
   {
     /* C = A */
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_deinterleave_f32.c
+*
+* Description:  Splits interleaved floating-point frames into channel blocks.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Interleave Vector Interleave and Deinterleave
+ *
+ * Converts between interleaved multichannel data, such as an L/R audio buffer, and one
+ * contiguous block per channel.  With <code>numChannels</code> channels and
+ * <code>blockSize</code> frames the deinterleave functions compute
+ * <pre>
+ *     pDst[c*blockSize + n] = pSrc[n*numChannels + c],   0 <= c < numChannels,  0 <= n < blockSize.
+ * </pre>
+ * and the interleave functions the inverse.  The per-channel blocks can then be passed to
+ * riscv_scale_q15(), the filters and the other vector functions, which all assume unit
+ * stride, without a separate copy per channel.
+ *
+ * With the DSP extension the Q15 functions move two channels of two frames with two word
+ * loads, two <code>pv.shuffle2.h</code> and two word stores when <code>numChannels</code> and
+ * <code>blockSize</code> are even, which includes the stereo and the four channel layouts.
+ * The Q7 functions have the same kind of path for two and four channels when
+ * <code>blockSize</code> is a multiple of 4.  The buffers must be 4-byte aligned in these cases.
+ *
+ * The source and destination buffers must not overlap.
+ * There are separate functions for floating-point, Q7, Q15, and Q31 data types.
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Splits interleaved floating-point frames into one block per channel.
+ * @param[in]       *pSrc points to <code>blockSize*numChannels</code> interleaved samples
+ * @param[in]       numChannels number of channels of a frame
+ * @param[out]      *pDst points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+ * @param[in]       blockSize number of frames
+ * @return none.
+ */
+
+void riscv_deinterleave_f32(
+  float32_t * pSrc,
+  uint16_t numChannels,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_deinterleave_f32);
+  float32_t *pIn;                                /* Input pointer */
+  uint32_t ch, blkCnt;                           /* loop counters */
+
+  for (ch = 0u; ch < numChannels; ch++)
+  {
+    pIn = pSrc + ch;
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
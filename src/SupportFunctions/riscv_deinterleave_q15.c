@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_deinterleave_q15.c
+*
+* Description:  Splits interleaved Q15 frames into channel blocks.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Splits interleaved Q15 frames into one block per channel.
+ * @param[in]       *pSrc points to <code>blockSize*numChannels</code> interleaved samples
+ * @param[in]       numChannels number of channels of a frame
+ * @param[out]      *pDst points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+ * @param[in]       blockSize number of frames
+ * @return none.
+ */
+
+void riscv_deinterleave_q15(
+  q15_t * pSrc,
+  uint16_t numChannels,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_deinterleave_q15);
+  q15_t *pIn;                                    /* Input pointer */
+  uint32_t ch, blkCnt;                           /* loop counters */
+
+#if defined (USE_DSP_RISCV)
+
+  shortV frame0, frame1;                         /* Channels c, c+1 of two frames */
+  shortV even = { 0, 2 };                        /* Shuffle mask for channel c */
+  shortV odd = { 1, 3 };                         /* Shuffle mask for channel c+1 */
+  q15_t *pOut0, *pOut1;                          /* Output pointers */
+
+  if(((numChannels & 1u) == 0u) && ((blockSize & 1u) == 0u))
+  {
+    /* Channels c and c+1 share a word of every frame */
+    for (ch = 0u; ch < numChannels; ch += 2u)
+    {
+      pIn = pSrc + ch;
+      pOut0 = pDst + (ch * blockSize);
+      pOut1 = pOut0 + blockSize;
+
+      blkCnt = blockSize >> 1u;
+      while(blkCnt > 0u)
+      {
+        frame0 = *(shortV *) pIn;
+        frame1 = *(shortV *) (pIn + numChannels);
+        pIn += 2u * numChannels;
+
+        *(shortV *) pOut0 = shufflev4(frame0, frame1, even);
+        *(shortV *) pOut1 = shufflev4(frame0, frame1, odd);
+        pOut0 += 2;
+        pOut1 += 2;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+    }
+
+    return;
+  }
+
+#endif
+
+  for (ch = 0u; ch < numChannels; ch++)
+  {
+    pIn = pSrc + ch;
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
@@ -0,0 +1,58 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_deinterleave_q31.c
+*
+* Description:  Splits interleaved Q31 frames into channel blocks.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Splits interleaved Q31 frames into one block per channel.
+ * @param[in]       *pSrc points to <code>blockSize*numChannels</code> interleaved samples
+ * @param[in]       numChannels number of channels of a frame
+ * @param[out]      *pDst points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+ * @param[in]       blockSize number of frames
+ * @return none.
+ */
+
+void riscv_deinterleave_q31(
+  q31_t * pSrc,
+  uint16_t numChannels,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_deinterleave_q31);
+  q31_t *pIn;                                /* Input pointer */
+  uint32_t ch, blkCnt;                           /* loop counters */
+
+  for (ch = 0u; ch < numChannels; ch++)
+  {
+    pIn = pSrc + ch;
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
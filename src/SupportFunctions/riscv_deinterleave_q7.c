@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_deinterleave_q7.c
+*
+* Description:  Splits interleaved Q7 frames into channel blocks.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Splits interleaved Q7 frames into one block per channel.
+ * @param[in]       *pSrc points to <code>blockSize*numChannels</code> interleaved samples
+ * @param[in]       numChannels number of channels of a frame
+ * @param[out]      *pDst points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+ * @param[in]       blockSize number of frames
+ * @return none.
+ *
+ * \par
+ * The DSP path treats a word of four samples as two halfword pairs: <code>pv.shuffle2.h</code>
+ * gathers the pairs of one channel from two words and <code>pv.shuffle.b</code> reorders the
+ * bytes of a word from <code>a0 b0 a1 b1</code> to <code>a0 a1 b0 b1</code>.
+ */
+
+void riscv_deinterleave_q7(
+  q7_t * pSrc,
+  uint16_t numChannels,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_deinterleave_q7);
+  q7_t *pIn;                                     /* Input pointer */
+  uint32_t ch, blkCnt;                           /* loop counters */
+
+#if defined (USE_DSP_RISCV)
+
+  charV w0, w1, w2, w3;                          /* Four input words */
+  shortV s0, s1, s2, s3;                         /* Halfword pairs of one or two channels */
+  shortV even = { 0, 2 };                        /* Shuffle masks for the halfword pairs */
+  shortV odd = { 1, 3 };
+  charV pairs = { 0, 2, 1, 3 };                  /* a0 b0 a1 b1 -> a0 a1 b0 b1 */
+  q7_t *pOut = pDst;                             /* Output pointer */
+
+  if(((blockSize & 3u) == 0u) && (numChannels == 2u))
+  {
+    pIn = pSrc;
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* L0 R0 L1 R1 and L2 R2 L3 R3 to L0 L1 R0 R1 and L2 L3 R2 R3 */
+      w0 = shuffleb(*(charV *) pIn, pairs);
+      w1 = shuffleb(*(charV *) (pIn + 4), pairs);
+      pIn += 8;
+
+      *(shortV *) pOut = shufflev4((shortV) w0, (shortV) w1, even);
+      *(shortV *) (pOut + blockSize) = shufflev4((shortV) w0, (shortV) w1, odd);
+      pOut += 4;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    return;
+  }
+
+  if(((blockSize & 3u) == 0u) && (numChannels == 4u))
+  {
+    pIn = pSrc;
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* One frame a b c d per word, first the pairs a b and c d of two frames */
+      s0 = shufflev4(*(shortV *) pIn, *(shortV *) (pIn + 4), even);
+      s1 = shufflev4(*(shortV *) pIn, *(shortV *) (pIn + 4), odd);
+      s2 = shufflev4(*(shortV *) (pIn + 8), *(shortV *) (pIn + 12), even);
+      s3 = shufflev4(*(shortV *) (pIn + 8), *(shortV *) (pIn + 12), odd);
+      pIn += 16;
+
+      /* a0 b0 a1 b1 to a0 a1 b0 b1 */
+      w0 = shuffleb((charV) s0, pairs);
+      w1 = shuffleb((charV) s1, pairs);
+      w2 = shuffleb((charV) s2, pairs);
+      w3 = shuffleb((charV) s3, pairs);
+
+      *(shortV *) pOut = shufflev4((shortV) w0, (shortV) w2, even);
+      *(shortV *) (pOut + blockSize) = shufflev4((shortV) w0, (shortV) w2, odd);
+      *(shortV *) (pOut + (2u * blockSize)) = shufflev4((shortV) w1, (shortV) w3, even);
+      *(shortV *) (pOut + (3u * blockSize)) = shufflev4((shortV) w1, (shortV) w3, odd);
+      pOut += 4;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    return;
+  }
+
+#endif
+
+  for (ch = 0u; ch < numChannels; ch++)
+  {
+    pIn = pSrc + ch;
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      *pDst++ = *pIn;
+      pIn += numChannels;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dispatch.c
+*
+* Description:  Kernel table and entry points of riscv_cmsis_dsp_lib_dispatch.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_dispatch.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Dispatch Run-time Kernel Dispatch
+ *
+ * riscv_cmsis_dsp_lib_dispatch contains the hot Q15 and Q7 kernels of RISCV_DISPATCH_KERNELS twice, scalar
+ * and compiled with <code>USE_DSP_RISCV</code>, so that one firmware runs the xpulp kernels on RI5CY and the
+ * scalar ones on cores without the PULP extension.  The public name of each kernel calls the variant of
+ * the kernel table, which riscv_dispatch_init() fills once for the executing core.
+ *
+ * \par
+ * The entry points are tail calls through the table, one load and one indirect jump on top of the kernel.
+ * The profile records of RISCV_DSP_PROFILE belong to the variants, the entry points have none.
+ */
+
+/**
+ * @addtogroup Dispatch
+ * @{
+ */
+
+/* non-standard extensions bit of misa */
+#define RISCV_DISPATCH_MISA_X  (1u << 23)
+
+#define RISCV_DISPATCH_DECLARE(NAME, PARAMS, ARGS)                                 \
+  extern void NAME##_scalar PARAMS;                                                \
+  extern void NAME##_xpulp PARAMS;
+#define RISCV_DISPATCH_MEMBER(NAME, PARAMS, ARGS)  void (*NAME) PARAMS;
+#define RISCV_DISPATCH_SCALAR(NAME, PARAMS, ARGS)  NAME##_scalar,
+#define RISCV_DISPATCH_XPULP(NAME, PARAMS, ARGS)   NAME##_xpulp,
+#define RISCV_DISPATCH_ENTRY(NAME, PARAMS, ARGS)                                   \
+  void NAME PARAMS                                                                 \
+  {                                                                                \
+    riscv_dispatch_table_.NAME ARGS;                                               \
+  }
+
+RISCV_DISPATCH_KERNELS(RISCV_DISPATCH_DECLARE)
+
+typedef struct
+{
+  RISCV_DISPATCH_KERNELS(RISCV_DISPATCH_MEMBER)
+} riscv_dispatch_table;
+
+static const riscv_dispatch_table riscv_dispatch_scalar = { RISCV_DISPATCH_KERNELS(RISCV_DISPATCH_SCALAR) };
+static const riscv_dispatch_table riscv_dispatch_xpulp = { RISCV_DISPATCH_KERNELS(RISCV_DISPATCH_XPULP) };
+
+/* Kernels of the entry points, a copy rather than a pointer to one of the
+   tables above so that a call loads the function pointer directly */
+static riscv_dispatch_table riscv_dispatch_table_ = { RISCV_DISPATCH_KERNELS(RISCV_DISPATCH_SCALAR) };
+
+/**
+ * @brief  Variant the executing core supports, from the X bit of misa.
+ * @return RISCV_DISPATCH_XPULP when misa reports non-standard extensions, RISCV_DISPATCH_SCALAR otherwise.
+ *
+ * \par
+ * RI5CY sets the X bit, Ibex and Zero-riscy do not.  A core that does not implement misa reads 0 and gets
+ * the scalar kernels; riscv_dispatch_select() overrides the result on such cores.  Host builds always
+ * report RISCV_DISPATCH_SCALAR.
+ */
+
+riscv_dispatch_isa riscv_dispatch_detect(void)
+{
+#if defined (__riscv) && !defined (__linux__)
+  uint32_t misa;
+
+  __asm__ volatile ("csrr %0, 0x301" : "=r" (misa));
+
+  return ((misa & RISCV_DISPATCH_MISA_X) != 0u) ? RISCV_DISPATCH_XPULP : RISCV_DISPATCH_SCALAR;
+#else
+  return RISCV_DISPATCH_SCALAR;
+#endif
+}
+
+/**
+ * @brief  Points the dispatched kernels at the variant riscv_dispatch_detect() reports.
+ * @return the selected variant.
+ */
+
+riscv_dispatch_isa riscv_dispatch_init(void)
+{
+  riscv_dispatch_isa isa = riscv_dispatch_detect();
+
+  riscv_dispatch_select(isa);
+
+  return (isa);
+}
+
+/**
+ * @brief  Points the dispatched kernels at a variant, for cores whose misa does not tell.
+ * @param[in]  isa  variant to run, RISCV_DISPATCH_XPULP only on cores with the PULP extension.
+ *
+ * \par
+ * Not safe against kernels running concurrently on the same table, select before starting them.
+ */
+
+void riscv_dispatch_select(
+  riscv_dispatch_isa isa)
+{
+  riscv_dispatch_table_ = (isa == RISCV_DISPATCH_XPULP) ? riscv_dispatch_xpulp : riscv_dispatch_scalar;
+}
+
+RISCV_DISPATCH_KERNELS(RISCV_DISPATCH_ENTRY)
+
+/**
+ * @} end of Dispatch group
+ */
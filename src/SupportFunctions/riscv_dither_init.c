@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dither_init.c
+*
+* Description:  Initialization function of the dithered Q15 conversions.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Dither Dithered Conversion to Q15
+ *
+ * riscv_q31_to_q15() and riscv_float_to_q15() truncate, and the truncation error of a quiet or
+ * periodic audio signal is correlated with it: it is heard as distortion rather than noise.  The
+ * dithered conversions riscv_q31_to_q15_dither() and riscv_float_to_q15_dither() add TPDF dither
+ * of &plusmn;1 LSB of Q15 before rounding, which makes the error a steady noise independent of
+ * the signal, and can shape that noise out of the band where the ear is most sensitive with error
+ * feedback,
+ * <pre>
+ *    u[n] = x[n] - h1 * e[n-1] - h2 * e[n-2]
+ *    y[n] = round(u[n] + d[n])
+ *    e[n] = y[n] - u[n]
+ * </pre>
+ * so that <code>y = x + (1 - h1*z^-1 - h2*z^-2) e</code>.  The order 0 is plain TPDF dither, the order
+ * 1 the highpass <code>1 - z^-1</code> and the order 2 <code>(1 - z^-1)^2</code>, which move the
+ * noise towards the Nyquist frequency.  The outputs saturate to Q15, the error is that of the
+ * rounding before saturation so a clipped sample does not upset the feedback.
+ * \par
+ * The dither <code>d</code> is the sum of two uniform 8-bit values, in steps of 1/256 LSB.  One
+ * step of a xorshift32 generator gives the 4 bytes of two samples.  The conversion runs at
+ * 8 bits below the Q15 LSB in 32-bit integer arithmetic, for the Q31 and for the floating-point
+ * input.
+ * \par
+ * The samples may be interleaved channels; each channel has its own two past errors in the state
+ * buffer of <code>2*numChannels</code> words and <code>blockSize</code> is a multiple of
+ * <code>numChannels</code>.  The two samples of a pass are different channels, and so
+ * independent, whenever there is more than one, and with <code>USE_DSP_RISCV</code> they are
+ * saturated with <code>p.clip</code> and stored with one word write.
+ */
+
+/**
+ * @addtogroup Dither
+ * @{
+ */
+
+/**
+ * @brief  Initialization function of the dithered Q15 conversions.
+ * @param[out] *S           points to an instance of the dither structure.
+ * @param[in]  numChannels  number of interleaved channels.
+ * @param[in]  order        order of the noise shaping, 0, 1 or 2.
+ * @param[in]  seed         seed of the dither generator, 0 selects a default one.
+ * @param[in]  *pState      points to the state buffer of <code>2*numChannels</code> words.
+ * @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>numChannels</code> is 0 or
+ * <code>order</code> is greater than 2.
+ */
+
+riscv_status riscv_dither_init(
+  riscv_dither_instance * S,
+  uint16_t numChannels,
+  uint8_t order,
+  uint32_t seed,
+  q31_t * pState)
+{
+  RISCV_PROFILE(riscv_dither_init);
+
+  if((numChannels == 0u) || (order > 2u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numChannels = numChannels;
+  S->order = order;
+
+  /* 0 is the fixed point of xorshift32 */
+  S->seed = (seed != 0u) ? seed : 0x2545F491u;
+
+  /* No quantization error yet */
+  memset(pState, 0, 2u * numChannels * sizeof(q31_t));
+
+  S->pState = pState;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Dither group
+ */
@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dma_init.c
+*
+* Description:  DMA hook of the streaming functions and its memcpy default.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Streaming DMA Streaming
+ *
+ * On PULP targets the data often lives in a large, slow L2 while the kernels run from a small
+ * L1 TCDM of a few KB.  The streaming functions keep only tiles of the data in L1 and move
+ * them with a DMA while the kernel works on the previous tile: two input tiles and two output
+ * tiles are used in turn, so the transfer of tile <code>t+1</code> into L1 and the transfer
+ * of tile <code>t-1</code> back to L2 overlap with the processing of tile <code>t</code>.
+ *
+ * \par
+ * The DMA is a hook of riscv_dma_instance so that the library does not depend on a runtime.
+ * <code>start</code> queues a 2D transfer of <code>numRows</code> rows of <code>rowSize</code>
+ * bytes and returns an identifier, <code>wait</code> returns when the transfer of an identifier
+ * and all the transfers started before it are done, which is how the queue of the PULP cluster
+ * DMA behaves.  On the PULP runtime the hook wraps <code>plp_dma_memcpy_2d()</code> (or the
+ * 1D copy when <code>numRows</code> is 1) and <code>plp_dma_wait()</code>.  Without a hook the
+ * transfers are done with <code>memcpy</code>, which gives the same results on any target.
+ */
+
+/**
+ * @addtogroup Streaming
+ * @{
+ */
+
+/**
+ * @brief  Synchronous 2D copy with memcpy, the default DMA of riscv_dma_init().
+ * @param[in]  *ctx       unused.
+ * @param[out] *pDst      points to the first destination row.
+ * @param[in]  *pSrc      points to the first source row.
+ * @param[in]  rowSize    size of a row in bytes.
+ * @param[in]  numRows    number of rows.
+ * @param[in]  dstStride  distance between two destination rows in bytes.
+ * @param[in]  srcStride  distance between two source rows in bytes.
+ * @return     transfer identifier, always 0.
+ */
+
+uint32_t riscv_dma_start_memcpy(
+  void * ctx,
+  void * pDst,
+  const void * pSrc,
+  uint32_t rowSize,
+  uint32_t numRows,
+  uint32_t dstStride,
+  uint32_t srcStride)
+{
+  RISCV_PROFILE(riscv_dma_start_memcpy);
+  uint8_t *pD = (uint8_t *) pDst;
+  const uint8_t *pS = (const uint8_t *) pSrc;
+
+  (void) ctx;
+
+  while(numRows > 0u)
+  {
+    memcpy(pD, pS, rowSize);
+    pD += dstStride;
+    pS += srcStride;
+
+    /* Decrement the loop counter */
+    numRows--;
+  }
+
+  return (0u);
+}
+
+/**
+ * @brief  Wait of riscv_dma_start_memcpy(), the copies are already done.
+ * @param[in]  *ctx  unused.
+ * @param[in]  id    unused.
+ * @return none.
+ */
+
+void riscv_dma_wait_none(
+  void * ctx,
+  uint32_t id)
+{
+  RISCV_PROFILE(riscv_dma_wait_none);
+  (void) ctx;
+  (void) id;
+}
+
+/**
+ * @brief  Initialization function of the DMA hook.
+ * @param[out] *D     points to an instance of the DMA structure.
+ * @param[in]  start  function that queues a 2D transfer, NULL for riscv_dma_start_memcpy().
+ * @param[in]  wait   function that waits for a transfer, ignored when <code>start</code> is NULL.
+ * @param[in]  *ctx   context handed to <code>start</code> and <code>wait</code>.
+ * @return none.
+ */
+
+void riscv_dma_init(
+  riscv_dma_instance * D,
+  riscv_dma_start_func start,
+  riscv_dma_wait_func wait,
+  void * ctx)
+{
+  RISCV_PROFILE(riscv_dma_init);
+  if(start == NULL)
+  {
+    D->start = riscv_dma_start_memcpy;
+    D->wait = riscv_dma_wait_none;
+  }
+  else
+  {
+    D->start = start;
+    D->wait = wait;
+  }
+
+  D->ctx = ctx;
+}
+
+/**
+ * @} end of Streaming group
+ */
@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dsp_arena.c
+*
+* Description:  Arena allocator for the state and scratch buffers of
+*               the instance structures.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Arena Arena Allocation
+ *
+ * An arena is one block of memory that the <code>*_init_arena</code> functions carve the buffers of
+ * their instances from, instead of the caller declaring a state or scratch array for each instance
+ * from the sizes given in the documentation.  Each <code>*_get_buffer_size</code> function returns the
+ * exact number of bytes the matching <code>*_init_arena</code> function takes for persistent buffers and
+ * each <code>*_get_scratch_size</code> function the bytes of its scratch buffer, so an arena is the sum of
+ * the buffer sizes plus the largest scratch size.  riscv_dsp_arena_usage() measures the same once all
+ * instances have been built.
+ *
+ * \par Persistent and Scratch Buffers
+ * State that survives from one call to the next is taken from the start of the arena by
+ * riscv_dsp_arena_alloc(), one buffer after the other.  Scratch buffers, which only hold data
+ * during one call, come from riscv_dsp_arena_scratch() at the end of the arena.  All scratch
+ * buffers overlap: the scratch region is as large as the largest request and every request gets
+ * the end of it.  Instances whose scratch comes from the same arena must therefore never run at
+ * the same time, for example filters called one after the other by the same task.
+ *
+ * \par
+ * Every buffer starts at a multiple of RISCV_DSP_ARENA_ALIGN bytes, which suits the packed SIMD
+ * loads of the Q15 and Q7 kernels and the doubleword accesses of q63_t.  There is no function to
+ * free a single buffer, riscv_dsp_arena_reset() releases all of them.
+ */
+
+/**
+ * @addtogroup Arena
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the arena.
+ * @param[out] *A     points to an instance of the arena structure.
+ * @param[in]  *pMem  points to the memory of the arena.
+ * @param[in]  size   size of the memory in bytes.
+ * @return none.
+ *
+ * \par
+ * If <code>pMem</code> is not aligned to RISCV_DSP_ARENA_ALIGN bytes the bytes up to the next
+ * multiple are skipped, declaring the memory as an array of <code>uint64_t</code> avoids the loss.
+ */
+
+void riscv_dsp_arena_init(
+  riscv_dsp_arena * A,
+  void * pMem,
+  uint32_t size)
+{
+  RISCV_PROFILE(riscv_dsp_arena_init);
+  uint32_t skip = (uint32_t) (-(uintptr_t) pMem) & (RISCV_DSP_ARENA_ALIGN - 1u);
+
+  if(skip > size)
+  {
+    skip = size;
+  }
+
+  A->pBase = (uint8_t *) pMem + skip;
+  A->size = (size - skip) & ~(RISCV_DSP_ARENA_ALIGN - 1u);
+  A->used = 0u;
+  A->scratch = 0u;
+}
+
+/**
+ * @brief  Takes a persistent buffer from the start of the arena.
+ * @param[in,out] *A    points to an instance of the arena structure.
+ * @param[in]     size  size of the buffer in bytes.
+ * @return        pointer to the buffer, or NULL if the arena has not enough free memory.
+ */
+
+void * riscv_dsp_arena_alloc(
+  riscv_dsp_arena * A,
+  uint32_t size)
+{
+  RISCV_PROFILE(riscv_dsp_arena_alloc);
+  uint32_t bytes = RISCV_DSP_ARENA_ROUND(size);
+  void *p;
+
+  if((bytes < size) || (bytes > (A->size - A->used - A->scratch)))
+  {
+    return (NULL);
+  }
+
+  p = A->pBase + A->used;
+  A->used += bytes;
+
+  return (p);
+}
+
+/**
+ * @brief  Takes a scratch buffer from the shared region at the end of the arena.
+ * @param[in,out] *A    points to an instance of the arena structure.
+ * @param[in]     size  size of the buffer in bytes.
+ * @return        pointer to the buffer, or NULL if the arena has not enough free memory.
+ *
+ * \par
+ * The region grows towards the persistent buffers when a request is larger than all before it.
+ * The buffers returned earlier stay valid, they are the end of the larger region.
+ */
+
+void * riscv_dsp_arena_scratch(
+  riscv_dsp_arena * A,
+  uint32_t size)
+{
+  RISCV_PROFILE(riscv_dsp_arena_scratch);
+  uint32_t bytes = RISCV_DSP_ARENA_ROUND(size);
+
+  if((bytes < size) || (bytes > (A->size - A->used)))
+  {
+    return (NULL);
+  }
+
+  if(bytes > A->scratch)
+  {
+    A->scratch = bytes;
+  }
+
+  return (A->pBase + (A->size - bytes));
+}
+
+/**
+ * @brief  Number of bytes of the arena in use.
+ * @param[in] *A  points to an instance of the arena structure.
+ * @return    bytes of the persistent buffers and of the scratch region.
+ *
+ * \par
+ * After all instances have been initialized it is the smallest size of an aligned arena that
+ * holds them, which lets a build on the host size the arena of the target.
+ */
+
+uint32_t riscv_dsp_arena_usage(
+  const riscv_dsp_arena * A)
+{
+  return (A->used + A->scratch);
+}
+
+/**
+ * @brief  Releases all buffers of the arena.
+ * @param[in,out] *A  points to an instance of the arena structure.
+ * @return none.
+ *
+ * \par
+ * The instances built from the arena must not be used afterwards.
+ */
+
+void riscv_dsp_arena_reset(
+  riscv_dsp_arena * A)
+{
+  A->used = 0u;
+  A->scratch = 0u;
+}
+
+/**
+ * @} end of Arena group
+ */
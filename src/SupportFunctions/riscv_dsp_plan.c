@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dsp_plan.c
+*
+* Description:  Wisdom table and cycle counter of the kernel planner.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Planner Kernel Planner
+ *
+ * Several operations have more than one kernel and which one is fastest depends on the size and on where
+ * the coefficients, the state and the data are placed: riscv_fir_q15() with a kernel specialized for
+ * numTaps against riscv_fir_fast_q15(), riscv_fir_q31() against riscv_fir_fast_q31(), riscv_fir_f32()
+ * against the FFT convolution of riscv_fir_fft_f32().  A plan instance, riscv_fir_plan_instance_q15 for
+ * example, holds the kernel its initialization function chose, and riscv_fir_plan_q15() calls it through
+ * one function pointer, inlined at the call site, so a planned filter costs what the chosen kernel costs.
+ * \par
+ * With RISCV_DSP_PLAN_MEASURE the initialization function runs every candidate twice on the buffers it is
+ * given and keeps the one whose second run took the fewest cycles of the PULP cycle counter, the first run
+ * filling the instruction cache; the filters are then set back to their initial state.  Without it the
+ * plan takes the accurate, direct kernel.  riscv_fir_fast_q15() and riscv_fir_fast_q31() keep less
+ * headroom in their accumulators and are only candidates with RISCV_DSP_PLAN_ALLOW_FAST.  On other targets
+ * than RISC-V the counter reads 0, every candidate ties and the direct kernel is kept.
+ * \par Wisdom
+ * A wisdom table, riscv_dsp_wisdom, keeps the choice of every measured plan under the operation, the sizes
+ * and RISCV_DSP_PLAN_ALLOW_FAST.  A plan whose key is in the table takes its kernel without measuring, so
+ * a table saved after a measuring run, for example to flash, and given back to riscv_dsp_wisdom_init() at
+ * the next boot plans without timing anything.  The choice only holds for the memory placement it was
+ * measured with.
+ */
+
+/**
+ * @addtogroup Planner
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the wisdom table.
+ * @param[out] *W           points to an instance of the wisdom table.
+ * @param[in]  *pEntries    points to the entries, the first <code>numEntries</code> saved by an earlier run.
+ * @param[in]  numEntries   number of valid entries, 0 for an empty table.
+ * @param[in]  maxEntries   number of entries <code>pEntries</code> holds.
+ * @return none.
+ */
+
+void riscv_dsp_wisdom_init(
+  riscv_dsp_wisdom * W,
+  riscv_dsp_wisdom_entry * pEntries,
+  uint16_t numEntries,
+  uint16_t maxEntries)
+{
+  W->pEntries = pEntries;
+  W->numEntries = (numEntries < maxEntries) ? numEntries : maxEntries;
+  W->maxEntries = maxEntries;
+}
+
+/**
+ * @brief  Entry of the wisdom table for a plan.
+ * @param[in]  *W         points to an instance of the wisdom table.
+ * @param[in]  op         operation of the plan.
+ * @param[in]  size       first size of the plan, the number of taps of a filter.
+ * @param[in]  blockSize  second size of the plan, the block size of a filter.
+ * @param[in]  flags      flags of the plan, only RISCV_DSP_PLAN_ALLOW_FAST is part of the key.
+ * @return     points to the entry, or NULL if the table has none for the plan.
+ */
+
+const riscv_dsp_wisdom_entry * riscv_dsp_wisdom_find(
+  const riscv_dsp_wisdom * W,
+  riscv_dsp_plan_op op,
+  uint16_t size,
+  uint32_t blockSize,
+  uint32_t flags)
+{
+  const riscv_dsp_wisdom_entry *pEntry = W->pEntries;
+  uint32_t i;
+
+  flags &= RISCV_DSP_PLAN_ALLOW_FAST;
+
+  for (i = 0u; i < W->numEntries; i++)
+  {
+    if((pEntry->op == (uint8_t) op) && (pEntry->flags == flags) &&
+       (pEntry->size == size) && (pEntry->blockSize == blockSize))
+    {
+      return (pEntry);
+    }
+    pEntry++;
+  }
+
+  return (NULL);
+}
+
+/**
+ * @brief  Records the choice of a plan in the wisdom table.
+ * @param[in,out] *W         points to an instance of the wisdom table.
+ * @param[in]     op         operation of the plan.
+ * @param[in]     size       first size of the plan.
+ * @param[in]     blockSize  second size of the plan.
+ * @param[in]     flags      flags of the plan.
+ * @param[in]     variant    chosen kernel.
+ * @param[in]     cycles     cycles of one call of the chosen kernel.
+ * @return RISCV_MATH_LENGTH_ERROR if the table is full, otherwise RISCV_MATH_SUCCESS.
+ *
+ * \par
+ * An entry with the same key is overwritten.
+ */
+
+riscv_status riscv_dsp_wisdom_add(
+  riscv_dsp_wisdom * W,
+  riscv_dsp_plan_op op,
+  uint16_t size,
+  uint32_t blockSize,
+  uint32_t flags,
+  uint8_t variant,
+  uint32_t cycles)
+{
+  riscv_dsp_wisdom_entry *pEntry;
+
+  pEntry = (riscv_dsp_wisdom_entry *) riscv_dsp_wisdom_find(W, op, size, blockSize, flags);
+
+  if(pEntry == NULL)
+  {
+    if(W->numEntries >= W->maxEntries)
+    {
+      return (RISCV_MATH_LENGTH_ERROR);
+    }
+    pEntry = &W->pEntries[W->numEntries];
+    W->numEntries++;
+  }
+
+  pEntry->op = (uint8_t) op;
+  pEntry->flags = (uint8_t) (flags & RISCV_DSP_PLAN_ALLOW_FAST);
+  pEntry->variant = variant;
+  pEntry->size = size;
+  pEntry->blockSize = blockSize;
+  pEntry->cycles = cycles;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Cycle counter the planner times the candidates with.
+ * @return cycles since the counter started, 0 on other targets than RISC-V.
+ *
+ * \par
+ * Enables the cycle counter without touching the other events, so the counters of RISCV_DSP_PROFILE
+ * keep counting.
+ */
+
+uint32_t riscv_dsp_plan_cycles(
+  void)
+{
+#if defined (__riscv)
+  uint32_t cycles;
+
+  __asm__ volatile ("csrs 0x7A0, %0" : : "r" (0x1u));
+  __asm__ volatile ("csrs 0x7A1, %0" : : "r" (0x1u));
+  __asm__ volatile ("csrr %0, 0x780" : "=r" (cycles));
+
+  return (cycles);
+#else
+  return (0u);
+#endif
+}
+
+/**
+ * @} end of Planner group
+ */
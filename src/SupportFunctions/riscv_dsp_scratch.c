@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dsp_scratch.c
+*
+* Description:  Library-wide stack of scratch buffers for the kernels
+*               that take their work space as an argument.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup ScratchPool Scratch Pool
+ *
+ * Kernels that need work space for the duration of one call take it as an argument: the transposed
+ * matrix of riscv_mat_mult_q15(), the scratch buffers of riscv_conv_opt_q15() and riscv_correlate_opt_q15(),
+ * the output accumulators of riscv_fir_sparse_q7() and the state buffer of riscv_dct4_f32().  When such an
+ * argument is NULL the kernel pushes a buffer of the required size on the scratch pool instead and pops it
+ * before it returns, so one region registered with riscv_dsp_scratch_init() serves every kernel of a signal
+ * chain in place of one permanent buffer per call site.
+ *
+ * \par
+ * Buffers are pushed and popped like a stack, riscv_dsp_scratch_mark() and riscv_dsp_scratch_pop() also let
+ * an application hold scratch across several kernel calls.  riscv_dsp_scratch_peak() reports the largest
+ * depth the pool has reached, run the chain once with a generous region to size the final one.
+ *
+ * \par
+ * If the pool cannot hold the buffer a kernel needs, the kernel returns RISCV_MATH_LENGTH_ERROR or, if it
+ * has no status, returns without writing its output.  The pool is one static region: kernels that run at
+ * the same time on different cores or in an interrupt must be given their buffers explicitly.
+ */
+
+/**
+ * @addtogroup ScratchPool
+ * @{
+ */
+
+/* Region of the pool, the persistent buffers of the arena are the stack */
+static riscv_dsp_arena riscv_dsp_scratch_pool_ = { NULL, 0u, 0u, 0u };
+
+/* Largest depth of the stack since riscv_dsp_scratch_init() */
+static uint32_t riscv_dsp_scratch_peak_ = 0u;
+
+/**
+ * @brief  Registers the region of the scratch pool.
+ * @param[in]  *pMem  points to the region, or NULL to disable the pool.
+ * @param[in]  size   size of the region in bytes.
+ * @return none.
+ *
+ * \par
+ * Buffers pushed on a previous region must not be in use any more.
+ */
+
+void riscv_dsp_scratch_init(
+  void * pMem,
+  uint32_t size)
+{
+  RISCV_PROFILE(riscv_dsp_scratch_init);
+
+  if(pMem == NULL)
+  {
+    size = 0u;
+  }
+
+  riscv_dsp_arena_init(&riscv_dsp_scratch_pool_, pMem, size);
+  riscv_dsp_scratch_peak_ = 0u;
+}
+
+/**
+ * @brief  Pushes a buffer on the scratch pool.
+ * @param[in]  size  size of the buffer in bytes.
+ * @return     pointer to the buffer, aligned to RISCV_DSP_ARENA_ALIGN bytes, or NULL if the pool is too small.
+ */
+
+void * riscv_dsp_scratch_push(
+  uint32_t size)
+{
+  void *p = riscv_dsp_arena_alloc(&riscv_dsp_scratch_pool_, size);
+
+  if(riscv_dsp_scratch_pool_.used > riscv_dsp_scratch_peak_)
+  {
+    riscv_dsp_scratch_peak_ = riscv_dsp_scratch_pool_.used;
+  }
+
+  return (p);
+}
+
+/**
+ * @brief  Current depth of the scratch pool.
+ * @return     mark that riscv_dsp_scratch_pop() returns the pool to.
+ */
+
+uint32_t riscv_dsp_scratch_mark(
+  void)
+{
+  return (riscv_dsp_scratch_pool_.used);
+}
+
+/**
+ * @brief  Pops the buffers pushed since a mark.
+ * @param[in]  mark  depth returned by riscv_dsp_scratch_mark() before the buffers were pushed.
+ * @return none.
+ */
+
+void riscv_dsp_scratch_pop(
+  uint32_t mark)
+{
+  if(mark < riscv_dsp_scratch_pool_.used)
+  {
+    riscv_dsp_scratch_pool_.used = mark;
+  }
+}
+
+/**
+ * @brief  Largest depth the scratch pool reached since riscv_dsp_scratch_init().
+ * @return     bytes, the smallest region that serves the same calls.
+ */
+
+uint32_t riscv_dsp_scratch_peak(
+  void)
+{
+  return (riscv_dsp_scratch_peak_);
+}
+
+/**
+ * @} end of ScratchPool group
+ */
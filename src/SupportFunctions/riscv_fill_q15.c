@@ -57,7 +57,10 @@
  * @param[out]      *pDst points to output vector    
  * @param[in]       blockSize length of the output vector   
  * @return none.    
- *    
+ *
+ * \par
+ * With the DSP extension one sample is written first when <code>pDst</code> is not word aligned, and the rest
+ * four at a time with two word stores, so <code>pDst</code> may have any alignment.
  */
 
 void riscv_fill_q15(
@@ -65,21 +68,36 @@ void riscv_fill_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fill_q15);
   uint32_t blkCnt;                               /* loop counter */
 #if defined (USE_DSP_RISCV)
-  blkCnt = blockSize >>1;
-  shortV VectInA; 
-  VectInA = pack2(value,value);
+  uint32_t numSamples = blockSize;               /* Samples left to fill */
+  shortV VectInA = pack2(value, value);          /* Two copies of value */
+
+  /* Fill one sample when pDst is not word aligned */
+  if((numSamples > 0u) && (((uintptr_t) pDst & 2u) != 0u))
+  {
+    *pDst++ = value;
+    numSamples--;
+  }
+
+  /*loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
   while(blkCnt > 0u)
   {
-    /* C = A */
-    /* Copy and then store the results in the destination buffer */
-    *(shortV*)pDst = VectInA;
-    pDst+=2;
+    /* C = value */
+    /* Fill four samples with two word stores */
+    *(shortV *) pDst = VectInA;
+    *(shortV *) (pDst + 2) = VectInA;
+    pDst += 4;
+
     /* Decrement the loop counter */
     blkCnt--;
   }
-  blkCnt = blockSize % 0x02;
+
+  blkCnt = numSamples % 0x4u;
+
   while(blkCnt > 0u)
   {
     /* C = value */
@@ -65,13 +65,36 @@ void riscv_fill_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fill_q31);
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (USE_DSP_RISCV) && defined (RISCV_MATH_LOOPUNROLL)
 
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = value */
+    pDst[0] = value;
+    pDst[1] = value;
+    pDst[2] = value;
+    pDst[3] = value;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
 
   /* Loop over blockSize number of values */
   blkCnt = blockSize;
 
+#endif /* #if defined (USE_DSP_RISCV) && defined (RISCV_MATH_LOOPUNROLL) */
+
   while(blkCnt > 0u)
   {
     /* C = value */
@@ -57,7 +57,10 @@
  * @param[out]      *pDst points to output vector    
  * @param[in]       blockSize length of the output vector   
  * @return none.    
- *    
+ *
+ * \par
+ * With the DSP extension the samples before the first word boundary are written one by one and the rest
+ * eight at a time with two word stores, so <code>pDst</code> may have any alignment.
  */
 
 void riscv_fill_q7(
@@ -65,22 +68,36 @@ void riscv_fill_q7(
   q7_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_fill_q7);
   uint32_t blkCnt;                               /* loop counter */
   /* Loop over blockSize number of values */
 #if defined (USE_DSP_RISCV)
-  blkCnt = blockSize >> 2u;
-  charV VectInA; 
-  VectInA = pack4(value,value,value,value);
+  uint32_t numSamples = blockSize;               /* Samples left to fill */
+  charV VectInA = pack4(value, value, value, value);  /* Four copies of value */
+
+  /* Fill up to three samples until pDst is word aligned */
+  while((numSamples > 0u) && (((uintptr_t) pDst & 3u) != 0u))
+  {
+    *pDst++ = value;
+    numSamples--;
+  }
+
+  /*loop Unrolling */
+  blkCnt = numSamples >> 3u;
+
   while(blkCnt > 0u)
   {
     /* C = value */
-    /* Fill the value in the destination buffer */
-    *(charV*)pDst = VectInA;
-    pDst+=4;
+    /* Fill eight samples with two word stores */
+    *(charV *) pDst = VectInA;
+    *(charV *) (pDst + 4) = VectInA;
+    pDst += 8;
+
     /* Decrement the loop counter */
     blkCnt--;
   }
-  blkCnt = blockSize%0x04;
+
+  blkCnt = numSamples % 0x8u;
 
   while(blkCnt > 0u)
   {
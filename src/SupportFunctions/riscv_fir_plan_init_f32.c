@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_plan_init_f32.c
+*
+* Description:  Planner of the floating-point FIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Planner
+ * @{
+ */
+
+/**
+ * @brief  Chooses between the direct and the FFT convolution of a floating-point FIR filter.
+ * @param[out]    *P          points to an instance of the floating-point FIR plan.
+ * @param[in,out] *S          points to the direct filter, initialized by riscv_fir_init_f32().
+ * @param[in,out] *Sfft       points to the FFT convolution filter of the same coefficients, initialized by
+ * riscv_fir_fft_init_f32(), or NULL.
+ * @param[in]     *pSrc       points to <code>blockSize</code> input samples to measure with.
+ * @param[out]    *pDst       points to <code>blockSize</code> output samples to measure with.
+ * @param[in]     blockSize   number of samples of a call, at most the block size of the initialization.
+ * @param[in]     flags       RISCV_DSP_PLAN_MEASURE or 0.
+ * @param[in,out] *pWisdom    points to the wisdom table, or NULL.
+ * @return RISCV_MATH_ARGUMENT_ERROR if the wisdom table names a kernel that is not a candidate, otherwise
+ * RISCV_MATH_SUCCESS.
+ *
+ * \par
+ * The candidates are riscv_fir_f32(), RISCV_FIR_PLAN_DIRECT, and riscv_fir_fft_f32(), RISCV_FIR_PLAN_FFT,
+ * when <code>Sfft</code> has the same number of taps and <code>blockSize</code> is a multiple of its
+ * partition length.  Measuring overwrites <code>pDst</code> and clears the state of both filters; a full
+ * wisdom table does not record the choice.  <code>pSrc</code> and <code>pDst</code> are not used without
+ * RISCV_DSP_PLAN_MEASURE.
+ */
+
+riscv_status riscv_fir_plan_init_f32(
+  riscv_fir_plan_instance_f32 * P,
+  const riscv_fir_instance_f32 * S,
+  riscv_fir_fft_instance_f32 * Sfft,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize,
+  uint32_t flags,
+  riscv_dsp_wisdom * pWisdom)
+{
+  RISCV_PROFILE(riscv_fir_plan_init_f32);
+  const riscv_dsp_wisdom_entry *pEntry = NULL;
+  uint32_t variant = RISCV_FIR_PLAN_DIRECT;
+  uint32_t fftLen, cycles, direct;
+  uint8_t fftOk;
+
+  fftOk = (Sfft != NULL) && (Sfft->numTaps == S->numTaps) && (blockSize != 0u) &&
+          ((blockSize % Sfft->blockSize) == 0u);
+
+  if(pWisdom != NULL)
+  {
+    pEntry = riscv_dsp_wisdom_find(pWisdom, RISCV_DSP_PLAN_FIR_F32, S->numTaps, blockSize, flags);
+  }
+
+  if(pEntry != NULL)
+  {
+    variant = pEntry->variant;
+  }
+  else if((flags & RISCV_DSP_PLAN_MEASURE) != 0u)
+  {
+    /* the first call fills the instruction cache, the second is timed */
+    riscv_fir_f32(S, pSrc, pDst, blockSize);
+    cycles = riscv_dsp_plan_cycles();
+    riscv_fir_f32(S, pSrc, pDst, blockSize);
+    direct = riscv_dsp_plan_cycles() - cycles;
+    cycles = direct;
+
+    /* the history of the filter, as riscv_fir_init_f32() left it */
+    memset(S->pState, 0, (S->numTaps - 1u) * sizeof(float32_t));
+
+    if(fftOk)
+    {
+      riscv_fir_fft_f32(Sfft, pSrc, pDst, blockSize);
+      cycles = riscv_dsp_plan_cycles();
+      riscv_fir_fft_f32(Sfft, pSrc, pDst, blockSize);
+      cycles = riscv_dsp_plan_cycles() - cycles;
+
+      if(cycles < direct)
+      {
+        variant = RISCV_FIR_PLAN_FFT;
+      }
+      else
+      {
+        cycles = direct;
+      }
+
+      /* the delay line and the input, as riscv_fir_fft_init_f32() left them */
+      fftLen = 2u * Sfft->blockSize;
+      riscv_fill_f32(0.0f, Sfft->pState + (Sfft->numPartitions * fftLen), (Sfft->numPartitions + 1u) * fftLen);
+      Sfft->fdlIndex = 0u;
+    }
+
+    if(pWisdom != NULL)
+    {
+      (void) riscv_dsp_wisdom_add(pWisdom, RISCV_DSP_PLAN_FIR_F32, S->numTaps, blockSize, flags,
+                                  (uint8_t) variant, cycles);
+    }
+  }
+
+  if((variant != RISCV_FIR_PLAN_DIRECT) && ((variant != RISCV_FIR_PLAN_FFT) || !fftOk))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  P->pDirect = S;
+  P->pFft = (variant == RISCV_FIR_PLAN_FFT) ? Sfft : NULL;
+  P->variant = (uint8_t) variant;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Planner group
+ */
@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fir_plan_init_q15.c
+*
+* Description:  Planner of the Q15 FIR filter.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Planner
+ * @{
+ */
+
+/**
+ * @brief  Chooses the kernel of a Q15 FIR filter.
+ * @param[out]    *P          points to an instance of the Q15 FIR plan.
+ * @param[in,out] *S          points to the Q15 FIR filter, initialized by riscv_fir_init_q15().
+ * @param[in]     *pSrc       points to <code>blockSize</code> input samples to measure with.
+ * @param[out]    *pDst       points to <code>blockSize</code> output samples to measure with.
+ * @param[in]     blockSize   number of samples of a call, at most the block size of the initialization.
+ * @param[in]     flags       RISCV_DSP_PLAN_MEASURE and RISCV_DSP_PLAN_ALLOW_FAST, or 0.
+ * @param[in,out] *pWisdom    points to the wisdom table, or NULL.
+ * @return RISCV_MATH_ARGUMENT_ERROR if the wisdom table names a kernel that is not a candidate, otherwise
+ * RISCV_MATH_SUCCESS.
+ *
+ * \par
+ * The candidates are riscv_fir_q15(), RISCV_FIR_PLAN_DIRECT, and with RISCV_DSP_PLAN_ALLOW_FAST
+ * riscv_fir_fast_q15(), RISCV_FIR_PLAN_FAST.  Measuring overwrites <code>pDst</code> and clears the state
+ * of the filter; a full wisdom table does not record the choice.  <code>pSrc</code> and <code>pDst</code>
+ * are not used without RISCV_DSP_PLAN_MEASURE.
+ */
+
+riscv_status riscv_fir_plan_init_q15(
+  riscv_fir_plan_instance_q15 * P,
+  const riscv_fir_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize,
+  uint32_t flags,
+  riscv_dsp_wisdom * pWisdom)
+{
+  RISCV_PROFILE(riscv_fir_plan_init_q15);
+  static const riscv_fir_plan_func_q15 candidates[2] = { riscv_fir_q15, riscv_fir_fast_q15 };
+  uint32_t numCandidates = ((flags & RISCV_DSP_PLAN_ALLOW_FAST) != 0u) ? 2u : 1u;
+  const riscv_dsp_wisdom_entry *pEntry = NULL;
+  uint32_t variant = RISCV_FIR_PLAN_DIRECT;
+  uint32_t best = 0xFFFFFFFFu, cycles, i;
+
+  if(pWisdom != NULL)
+  {
+    pEntry = riscv_dsp_wisdom_find(pWisdom, RISCV_DSP_PLAN_FIR_Q15, S->numTaps, blockSize, flags);
+  }
+
+  if(pEntry != NULL)
+  {
+    variant = pEntry->variant;
+  }
+  else if((flags & RISCV_DSP_PLAN_MEASURE) != 0u)
+  {
+    for (i = 0u; i < numCandidates; i++)
+    {
+      /* the first call fills the instruction cache, the second is timed */
+      candidates[i](S, pSrc, pDst, blockSize);
+      cycles = riscv_dsp_plan_cycles();
+      candidates[i](S, pSrc, pDst, blockSize);
+      cycles = riscv_dsp_plan_cycles() - cycles;
+
+      if(cycles < best)
+      {
+        best = cycles;
+        variant = i;
+      }
+    }
+
+    /* the history of the filter, as riscv_fir_init_q15() left it */
+    memset(S->pState, 0, (S->numTaps - 1u) * sizeof(q15_t));
+
+    if(pWisdom != NULL)
+    {
+      (void) riscv_dsp_wisdom_add(pWisdom, RISCV_DSP_PLAN_FIR_Q15, S->numTaps, blockSize, flags,
+                                  (uint8_t) variant, best);
+    }
+  }
+
+  if(variant >= numCandidates)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  P->pFunc = candidates[variant];
+  P->pFilter = S;
+  P->variant = (uint8_t) variant;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Planner group
+ */
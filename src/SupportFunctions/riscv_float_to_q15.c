@@ -71,6 +71,8 @@
  * \note   
  * In order to apply rounding, the library should be rebuilt with the ROUNDING macro     
  * defined in the preprocessor section of project options.     
+ * \par
+ * With the DSP extension two results are packed and written with one word access, <code>pDst</code> must be 4-byte aligned.
  *    
  */
 
@@ -80,9 +82,57 @@ void riscv_float_to_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_float_to_q15);
   float32_t *pIn = pSrc;                         /* Src pointer */
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (USE_DSP_RISCV)
+
+  float32_t in1, in2;                            /* Scaled inputs */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = A * 32768 */
+    in1 = pIn[0] * 32768.0f;
+    in2 = pIn[1] * 32768.0f;
+
+#ifdef RISCV_MATH_ROUNDING
+
+    in1 += in1 > 0 ? 0.5f : -0.5f;
+    in2 += in2 > 0 ? 0.5f : -0.5f;
+
+#endif /*      #ifdef RISCV_MATH_ROUNDING        */
+
+    /* Saturate both results and store them with one word write */
+    *(shortV *) pDst = pack2(clip((q31_t) in1, -32768, 32767), clip((q31_t) in2, -32768, 32767));
+
+    pIn += 2;
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+
+  if(blkCnt > 0u)
+  {
+    in1 = *pIn * 32768.0f;
+
+#ifdef RISCV_MATH_ROUNDING
+
+    in1 += in1 > 0 ? 0.5f : -0.5f;
+
+#endif /*      #ifdef RISCV_MATH_ROUNDING        */
+
+    *pDst = (q15_t) clip((q31_t) in1, -32768, 32767);
+  }
+
+#else
+
 #ifdef RISCV_MATH_ROUNDING
 
   float32_t in;
@@ -100,20 +150,12 @@ void riscv_float_to_q15(
     in = *pIn++;
     in = (in * 32768.0f);
     in += in > 0 ? 0.5f : -0.5f;
-#if defined (USE_DSP_RISCV)
-    *pDst++ = (q15_t)clip((q31_t)(in), -32768,32767)
-#else
     *pDst++ = (q15_t) (__SSAT((q31_t) (in), 16));
-#endif
 #else
 
     /* C = A * 32768 */
     /* convert from float to q15 and then store the results in the destination buffer */
-#if defined (USE_DSP_RISCV)
-    *pDst++ = (q15_t) clip((q31_t) (*pIn++ * 32768.0f), -32768,32767);
-#else
     *pDst++ = (q15_t) __SSAT((q31_t) (*pIn++ * 32768.0f), 16);
-#endif
 
 #endif /*      #ifdef RISCV_MATH_ROUNDING        */
 
@@ -121,6 +163,7 @@ void riscv_float_to_q15(
     blkCnt--;
   }
 
+#endif /* #if defined (USE_DSP_RISCV) */
 
 }
 
@@ -76,6 +76,8 @@
  *   
  * \note In order to apply rounding, the library should be rebuilt with the ROUNDING macro     
  * defined in the preprocessor section of project options.     
+ * \par
+ * With the DSP extension the results are saturated before the conversion, so no 64-bit conversion is needed.
  */
 
 
@@ -84,9 +86,64 @@ void riscv_float_to_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_float_to_q31);
   float32_t *pIn = pSrc;                         /* Src pointer */
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (USE_DSP_RISCV)
+
+  float32_t in1, in2;                            /* Scaled inputs */
+
+  /* The saturation is done on the float value so that the conversion is a
+   * single 32-bit fcvt.w.s instead of a 64-bit conversion and clip */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = A * 2147483648 */
+    in1 = pIn[0] * 2147483648.0f;
+    in2 = pIn[1] * 2147483648.0f;
+
+#ifdef RISCV_MATH_ROUNDING
+
+    in1 += in1 > 0 ? 0.5f : -0.5f;
+    in2 += in2 > 0 ? 0.5f : -0.5f;
+
+#endif /*      #ifdef RISCV_MATH_ROUNDING        */
+
+    in1 = (in1 < -2147483648.0f) ? -2147483648.0f : in1;
+    in2 = (in2 < -2147483648.0f) ? -2147483648.0f : in2;
+
+    pDst[0] = (in1 < 2147483648.0f) ? (q31_t) in1 : 0x7FFFFFFF;
+    pDst[1] = (in2 < 2147483648.0f) ? (q31_t) in2 : 0x7FFFFFFF;
+
+    pIn += 2;
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+
+  if(blkCnt > 0u)
+  {
+    in1 = *pIn * 2147483648.0f;
+
+#ifdef RISCV_MATH_ROUNDING
+
+    in1 += in1 > 0 ? 0.5f : -0.5f;
+
+#endif /*      #ifdef RISCV_MATH_ROUNDING        */
+
+    in1 = (in1 < -2147483648.0f) ? -2147483648.0f : in1;
+    *pDst = (in1 < 2147483648.0f) ? (q31_t) in1 : 0x7FFFFFFF;
+  }
+
+#else
+
 #ifdef RISCV_MATH_ROUNDING
 
   float32_t in;
@@ -120,6 +177,8 @@ void riscv_float_to_q31(
     blkCnt--;
   }
 
+#endif /* #if defined (USE_DSP_RISCV) */
+
 }
 
 /**    
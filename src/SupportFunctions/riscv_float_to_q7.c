@@ -71,6 +71,8 @@
  * \note   
  * In order to apply rounding, the library should be rebuilt with the ROUNDING macro     
  * defined in the preprocessor section of project options.     
+ * \par
+ * With the DSP extension four results are packed and written with one word access, <code>pDst</code> must be 4-byte aligned.
  */
 
 
@@ -79,9 +81,65 @@ void riscv_float_to_q7(
   q7_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_float_to_q7);
   float32_t *pIn = pSrc;                         /* Src pointer */
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (USE_DSP_RISCV)
+
+  float32_t in1, in2, in3, in4;                  /* Scaled inputs */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = A * 128 */
+    in1 = pIn[0] * 128.0f;
+    in2 = pIn[1] * 128.0f;
+    in3 = pIn[2] * 128.0f;
+    in4 = pIn[3] * 128.0f;
+
+#ifdef RISCV_MATH_ROUNDING
+
+    in1 += in1 > 0 ? 0.5f : -0.5f;
+    in2 += in2 > 0 ? 0.5f : -0.5f;
+    in3 += in3 > 0 ? 0.5f : -0.5f;
+    in4 += in4 > 0 ? 0.5f : -0.5f;
+
+#endif /*      #ifdef RISCV_MATH_ROUNDING        */
+
+    /* Saturate the four results and store them with one word write */
+    *(charV *) pDst = pack4(clip((q31_t) in1, -128, 127), clip((q31_t) in2, -128, 127),
+                            clip((q31_t) in3, -128, 127), clip((q31_t) in4, -128, 127));
+
+    pIn += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    in1 = *pIn++ * 128.0f;
+
+#ifdef RISCV_MATH_ROUNDING
+
+    in1 += in1 > 0 ? 0.5f : -0.5f;
+
+#endif /*      #ifdef RISCV_MATH_ROUNDING        */
+
+    *pDst++ = (q7_t) clip((q31_t) in1, -128, 127);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
+
 #ifdef RISCV_MATH_ROUNDING
 
   float32_t in;
@@ -99,26 +157,20 @@ void riscv_float_to_q7(
     in = *pIn++;
     in = (in * 128.0f);
     in += in > 0 ? 0.5f : -0.5f;
-#if defined (USE_DSP_RISCV)
-    *pDst++ = (q7_t) clip((q31_t)(in), -128,127);
-#else
     *pDst++ = (q7_t) (__SSAT((q31_t) (in), 8));
-#endif
 #else
 
     /* C = A * 128 */
     /* convert from float to q7 and then store the results in the destination buffer */
-#if defined (USE_DSP_RISCV)
-    *pDst++ = (q7_t) clip((q31_t) (*pIn++ * 128.0f), -128,127);
-#else
     *pDst++ = (q7_t) __SSAT((q31_t) (*pIn++ * 128.0f), 8);
-#endif
+
 #endif /*      #ifdef RISCV_MATH_ROUNDING        */
 
     /* Decrement the loop counter */
     blkCnt--;
   }
 
+#endif /* #if defined (USE_DSP_RISCV) */
 
 }
 
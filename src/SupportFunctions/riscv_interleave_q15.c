@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_interleave_q15.c
+*
+* Description:  Merges Q15 channel blocks into interleaved frames.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Merges one Q15 block per channel into interleaved frames.
+ * @param[in]       *pSrc points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+ * @param[in]       numChannels number of channels of a frame
+ * @param[out]      *pDst points to <code>blockSize*numChannels</code> interleaved samples
+ * @param[in]       blockSize number of frames
+ * @return none.
+ */
+
+void riscv_interleave_q15(
+  q15_t * pSrc,
+  uint16_t numChannels,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_interleave_q15);
+  q15_t *pOut;                                   /* Output pointer */
+  uint32_t ch, blkCnt;                           /* loop counters */
+
+#if defined (USE_DSP_RISCV)
+
+  shortV chan0, chan1;                           /* Two frames of channels c and c+1 */
+  shortV even = { 0, 2 };                        /* Shuffle mask for the first frame */
+  shortV odd = { 1, 3 };                         /* Shuffle mask for the second frame */
+  q15_t *pIn0, *pIn1;                            /* Input pointers */
+
+  if(((numChannels & 1u) == 0u) && ((blockSize & 1u) == 0u))
+  {
+    for (ch = 0u; ch < numChannels; ch += 2u)
+    {
+      pIn0 = pSrc + (ch * blockSize);
+      pIn1 = pIn0 + blockSize;
+      pOut = pDst + ch;
+
+      blkCnt = blockSize >> 1u;
+      while(blkCnt > 0u)
+      {
+        chan0 = *(shortV *) pIn0;
+        chan1 = *(shortV *) pIn1;
+        pIn0 += 2;
+        pIn1 += 2;
+
+        *(shortV *) pOut = shufflev4(chan0, chan1, even);
+        *(shortV *) (pOut + numChannels) = shufflev4(chan0, chan1, odd);
+        pOut += 2u * numChannels;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+      }
+    }
+
+    return;
+  }
+
+#endif
+
+  for (ch = 0u; ch < numChannels; ch++)
+  {
+    pOut = pDst + ch;
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      *pOut = *pSrc++;
+      pOut += numChannels;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
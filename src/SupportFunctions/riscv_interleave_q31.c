@@ -0,0 +1,58 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_interleave_q31.c
+*
+* Description:  Merges Q31 channel blocks into interleaved frames.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Merges one Q31 block per channel into interleaved frames.
+ * @param[in]       *pSrc points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+ * @param[in]       numChannels number of channels of a frame
+ * @param[out]      *pDst points to <code>blockSize*numChannels</code> interleaved samples
+ * @param[in]       blockSize number of frames
+ * @return none.
+ */
+
+void riscv_interleave_q31(
+  q31_t * pSrc,
+  uint16_t numChannels,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_interleave_q31);
+  q31_t *pOut;                               /* Output pointer */
+  uint32_t ch, blkCnt;                           /* loop counters */
+
+  for (ch = 0u; ch < numChannels; ch++)
+  {
+    pOut = pDst + ch;
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      *pOut = *pSrc++;
+      pOut += numChannels;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
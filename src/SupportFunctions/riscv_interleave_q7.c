@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_interleave_q7.c
+*
+* Description:  Merges Q7 channel blocks into interleaved frames.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Merges one Q7 block per channel into interleaved frames.
+ * @param[in]       *pSrc points to <code>numChannels</code> blocks of <code>blockSize</code> samples
+ * @param[in]       numChannels number of channels of a frame
+ * @param[out]      *pDst points to <code>blockSize*numChannels</code> interleaved samples
+ * @param[in]       blockSize number of frames
+ * @return none.
+ *
+ * \par
+ * The DSP path runs the shuffles of riscv_deinterleave_q7() in the reverse order.
+ */
+
+void riscv_interleave_q7(
+  q7_t * pSrc,
+  uint16_t numChannels,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_interleave_q7);
+  q7_t *pOut;                                    /* Output pointer */
+  uint32_t ch, blkCnt;                           /* loop counters */
+
+#if defined (USE_DSP_RISCV)
+
+  shortV a, b, c, d;                             /* Four samples of each channel */
+  charV x0, x1, y0, y1;                          /* Interleaved pairs of channels */
+  shortV even = { 0, 2 };                        /* Shuffle masks for the halfword pairs */
+  shortV odd = { 1, 3 };
+  charV pairs = { 0, 2, 1, 3 };                  /* a0 a1 b0 b1 -> a0 b0 a1 b1 */
+  q7_t *pIn = pSrc;                              /* Input pointer */
+
+  if(((blockSize & 3u) == 0u) && (numChannels == 2u))
+  {
+    pOut = pDst;
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      a = *(shortV *) pIn;
+      b = *(shortV *) (pIn + blockSize);
+      pIn += 4;
+
+      *(charV *) pOut = shuffleb((charV) shufflev4(a, b, even), pairs);
+      *(charV *) (pOut + 4) = shuffleb((charV) shufflev4(a, b, odd), pairs);
+      pOut += 8;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    return;
+  }
+
+  if(((blockSize & 3u) == 0u) && (numChannels == 4u))
+  {
+    pOut = pDst;
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      a = *(shortV *) pIn;
+      b = *(shortV *) (pIn + blockSize);
+      c = *(shortV *) (pIn + (2u * blockSize));
+      d = *(shortV *) (pIn + (3u * blockSize));
+      pIn += 4;
+
+      /* a0 b0 a1 b1, a2 b2 a3 b3, c0 d0 c1 d1 and c2 d2 c3 d3 */
+      x0 = shuffleb((charV) shufflev4(a, b, even), pairs);
+      x1 = shuffleb((charV) shufflev4(a, b, odd), pairs);
+      y0 = shuffleb((charV) shufflev4(c, d, even), pairs);
+      y1 = shuffleb((charV) shufflev4(c, d, odd), pairs);
+
+      /* One frame per word */
+      *(shortV *) pOut = shufflev4((shortV) x0, (shortV) y0, even);
+      *(shortV *) (pOut + 4) = shufflev4((shortV) x0, (shortV) y0, odd);
+      *(shortV *) (pOut + 8) = shufflev4((shortV) x1, (shortV) y1, even);
+      *(shortV *) (pOut + 12) = shufflev4((shortV) x1, (shortV) y1, odd);
+      pOut += 16;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    return;
+  }
+
+#endif
+
+  for (ch = 0u; ch < numChannels; ch++)
+  {
+    pOut = pDst + ch;
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      *pOut = *pSrc++;
+      pOut += numChannels;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
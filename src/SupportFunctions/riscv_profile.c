@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_profile.c
+*
+* Description:  Per-kernel call count, cycle and stall table of the
+*               RISCV_DSP_PROFILE instrumentation.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Profile Kernel Profiling
+ *
+ * When the library is compiled with <code>RISCV_DSP_PROFILE</code> (CMake option of the same name) every
+ * public kernel starts with <code>RISCV_PROFILE(name)</code>, which counts the call and adds the cycles,
+ * instructions and stalls spent until the kernel returns to a record of the kernel.  The record is a static
+ * variable of the kernel, it gets its kernel ID, its index in the profile table, on the first call, so only
+ * the kernels a firmware actually runs take a slot of the RISCV_PROFILE_MAX_KERNELS of the table.  Without
+ * <code>RISCV_DSP_PROFILE</code> the macro is empty and the kernels are compiled exactly as before.
+ *
+ * \par
+ * The counters are the PULP performance counters: cycles, instructions, and as stalls the sum of the load
+ * use, jump register and instruction fetch stalls.  riscv_profile_reset() enables them without saturation,
+ * so they must not be reconfigured by the program while profiling, as the benchmark harness does.  The
+ * cycles of a kernel include the kernels it calls, riscv_rfft_fast_f32() counts the cycles of its
+ * riscv_cfft_f32().  The totals are 32-bit and wrap after 2^32 cycles.  On other targets only the calls
+ * are counted.
+ *
+ * \par
+ * The table is not protected against concurrent updates: with the parallel functions only the entry point
+ * called by the master core is recorded, the workers are not public kernels.
+ */
+
+/**
+ * @addtogroup Profile
+ * @{
+ */
+
+/* Registered records, kernel ID i is riscv_profile_table[i - 1] */
+static riscv_profile_entry * riscv_profile_table[RISCV_PROFILE_MAX_KERNELS];
+static uint32_t riscv_profile_count = 0u;
+
+/*
+* @brief  Reads the cycle, instruction and stall counters.
+*/
+
+static void riscv_profile_read(
+  riscv_profile_scope * pScope)
+{
+#if defined (__riscv)
+  uint32_t ld, jr, imiss;
+
+  __asm__ volatile ("csrr %0, 0x780" : "=r" (pScope->cycles));
+  __asm__ volatile ("csrr %0, 0x781" : "=r" (pScope->instr));
+  __asm__ volatile ("csrr %0, 0x782" : "=r" (ld));
+  __asm__ volatile ("csrr %0, 0x783" : "=r" (jr));
+  __asm__ volatile ("csrr %0, 0x784" : "=r" (imiss));
+
+  pScope->stalls = ld + jr + imiss;
+#else
+  pScope->cycles = 0u;
+  pScope->instr = 0u;
+  pScope->stalls = 0u;
+#endif
+}
+
+/**
+ * @brief  Start of a profiled kernel, registers its record on the first call.
+ * @param[in, out] *pEntry  points to the record of the kernel.
+ * @return     counters at the start of the kernel.
+ */
+
+riscv_profile_scope riscv_profile_enter(
+  riscv_profile_entry * pEntry)
+{
+  riscv_profile_scope scope;
+
+  if((pEntry->id == 0u) && (riscv_profile_count < RISCV_PROFILE_MAX_KERNELS))
+  {
+    riscv_profile_table[riscv_profile_count] = pEntry;
+    riscv_profile_count++;
+    pEntry->id = riscv_profile_count;
+  }
+
+  scope.pEntry = pEntry;
+  riscv_profile_read(&scope);
+
+  return (scope);
+}
+
+/**
+ * @brief  End of a profiled kernel, adds the counters since riscv_profile_enter() to its record.
+ * @param[in]  *pScope  points to the counters at the start of the kernel.
+ * @return none.
+ */
+
+void riscv_profile_exit(
+  riscv_profile_scope * pScope)
+{
+  riscv_profile_entry *pEntry = pScope->pEntry;
+  riscv_profile_scope now;
+
+  riscv_profile_read(&now);
+
+  pEntry->calls++;
+  pEntry->cycles += now.cycles - pScope->cycles;
+  pEntry->instr += now.instr - pScope->instr;
+  pEntry->stalls += now.stalls - pScope->stalls;
+}
+
+/**
+ * @brief  Clears the records of all kernels and starts the performance counters.
+ * @return none.
+ */
+
+void riscv_profile_reset(
+  void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < riscv_profile_count; i++)
+  {
+    riscv_profile_table[i]->calls = 0u;
+    riscv_profile_table[i]->cycles = 0u;
+    riscv_profile_table[i]->instr = 0u;
+    riscv_profile_table[i]->stalls = 0u;
+  }
+
+#if defined (__riscv)
+  /* Cycles, instructions, load, jump and fetch stalls, counting without saturation */
+  __asm__ volatile ("csrw 0x7A0, %0" : : "r" (0x1Fu));
+  __asm__ volatile ("csrw 0x7A1, %0" : : "r" (0x1u));
+#endif
+}
+
+/**
+ * @brief  Record of a kernel ID.
+ * @param[in]  id  kernel ID, 1 to the number of kernels called so far.
+ * @return     points to the record, or NULL if no kernel has this ID.
+ */
+
+const riscv_profile_entry * riscv_profile_get(
+  uint32_t id)
+{
+  if((id == 0u) || (id > riscv_profile_count))
+  {
+    return (NULL);
+  }
+
+  return (riscv_profile_table[id - 1u]);
+}
+
+/**
+ * @brief  Hands the record of every kernel called so far to a print function, in kernel ID order.
+ * @param[in]  func  function called once per record.
+ * @param[in]  *ctx  context handed to <code>func</code>.
+ * @return     number of records.
+ */
+
+uint32_t riscv_profile_dump(
+  riscv_profile_dump_func func,
+  void * ctx)
+{
+  uint32_t i;
+
+  for (i = 0u; i < riscv_profile_count; i++)
+  {
+    func(ctx, riscv_profile_table[i]);
+  }
+
+  return (riscv_profile_count);
+}
+
+/**
+ * @} end of Profile group
+ */
@@ -73,6 +73,8 @@
  * 	pDst[n] = (float32_t) pSrc[n] / 32768;   0 <= n < blockSize.    
  * </pre>    
  *   
+ * \par
+ * With the DSP extension two samples are read with one word access, <code>pSrc</code> must be 4-byte aligned.
  */
 
 
@@ -81,10 +83,42 @@ void riscv_q15_to_float(
   float32_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_q15_to_float);
   q15_t *pIn = pSrc;                             /* Src pointer */
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (USE_DSP_RISCV)
 
+  shortV VectIn;                                 /* Packed input samples */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = (float32_t) A / 32768 */
+    VectIn = *(shortV *) pIn;
+    pDst[0] = (float32_t) VectIn[0] * 3.0517578125e-05f;
+    pDst[1] = (float32_t) VectIn[1] * 3.0517578125e-05f;
+
+    pIn += 2;
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (float32_t) * pIn++ * 3.0517578125e-05f;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
 
   /* Loop over blockSize number of values */
   blkCnt = blockSize;
@@ -98,6 +132,8 @@ void riscv_q15_to_float(
     /* Decrement the loop counter */
     blkCnt--;
   }
+
+#endif /* #if defined (USE_DSP_RISCV) */
 }
 
 /**    
@@ -74,11 +74,39 @@ void riscv_q15_to_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_q15_to_q31);
   q15_t *pIn = pSrc;                             /* Src pointer */
   uint32_t blkCnt;                               /* loop counter */
+#if defined (USE_DSP_RISCV)
+  shortV in1, in2;                               /* two input values each */
+  shortV zero = {0, 0};                          /* low halfwords of the outputs */
+  shortV out0 = {0, 2};                          /* A[0] into the high halfword of a word */
+  shortV out1 = {0, 3};                          /* A[1] into the high halfword of a word */
 
+  /* Two outputs per word loaded, q15 << 16 only moves each halfword into the high halfword of a word */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    in1 = *(shortV *) pIn;
+    in2 = *(shortV *) (pIn + 2);
+    pIn += 4;
+
+    *(shortV *) pDst = shufflev4(zero, in1, out0);
+    *(shortV *) (pDst + 1) = shufflev4(zero, in1, out1);
+    *(shortV *) (pDst + 2) = shufflev4(zero, in2, out0);
+    *(shortV *) (pDst + 3) = shufflev4(zero, in2, out1);
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 3u;
+#else
   /* Loop over blockSize number of values */
   blkCnt = blockSize;
+#endif
 
   while(blkCnt > 0u)
   {
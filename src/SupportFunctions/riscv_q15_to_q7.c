@@ -75,6 +75,7 @@ void riscv_q15_to_q7(
   q7_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_q15_to_q7);
   q15_t *pIn = pSrc;                             /* Src pointer */
   uint32_t blkCnt;                               /* loop counter */
 #if defined (USE_DSP_RISCV)
@@ -92,6 +93,8 @@ void riscv_q15_to_q7(
       /* Decrement the loop counter */
       blkCnt--;
     }
+  /* The last sample of an odd block follows the pairs */
+  pIn = pSrc;
   blkCnt = blockSize % 0x2u;
 #else
   /* Loop over blockSize number of values */
@@ -70,6 +70,8 @@
  * 	pDst[n] = (float32_t) pSrc[n] / 2147483648;   0 <= n < blockSize.    
  * </pre>    
  *   
+ * \par
+ * The results do not depend on USE_DSP_RISCV, the DSP version multiplies by 2^-31 instead of dividing.
  */
 
 
@@ -78,11 +80,46 @@ void riscv_q31_to_float(
   float32_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_q31_to_float);
   q31_t *pIn = pSrc;                             /* Src pointer */
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (USE_DSP_RISCV)
+
+
+  /* Scaling by 2^-31 is exact, so multiplying gives the same result as the division */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = (float32_t) A / 2147483648 */
+    pDst[0] = (float32_t) pIn[0] * 4.656612873077393e-10f;
+    pDst[1] = (float32_t) pIn[1] * 4.656612873077393e-10f;
+
+    pIn += 2;
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x2u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (float32_t) * pIn++ * 4.656612873077393e-10f;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
+
   /* Loop over blockSize number of values */
   blkCnt = blockSize;
+
   while(blkCnt > 0u)
   {
     /* C = (float32_t) A / 2147483648 */
@@ -92,6 +129,8 @@ void riscv_q31_to_float(
     /* Decrement the loop counter */
     blkCnt--;
   }
+
+#endif /* #if defined (USE_DSP_RISCV) */
 }
 
 /**    
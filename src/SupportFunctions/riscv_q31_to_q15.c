@@ -74,6 +74,7 @@ void riscv_q31_to_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_q31_to_q15);
   q31_t *pIn = pSrc;                             /* Src pointer */
   uint32_t blkCnt;                               /* loop counter */
 #if defined (USE_DSP_RISCV)
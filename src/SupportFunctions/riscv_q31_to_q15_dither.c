@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_q31_to_q15_dither.c
+*
+* Description:  Converts a Q31 vector to Q15 with TPDF dither and noise
+*               shaping.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* One output, in is the sample with 8 bits below the Q15 LSB, pErr the two past errors of its channel */
+static inline q15_t riscv_q31_to_q15_dither_step(
+  q31_t in,
+  q31_t dither,
+  q31_t * pErr,
+  q31_t h1,
+  q31_t h2)
+{
+  q31_t u, y;
+
+  u = in - (h1 * pErr[0]) - (h2 * pErr[1]);
+  y = (u + dither + 128) >> 8;
+
+  pErr[1] = pErr[0];
+  pErr[0] = (y << 8) - u;
+
+#if defined (USE_DSP_RISCV)
+  return ((q15_t) clip(y, -32768, 32767));
+#else
+  return (clip_q31_to_q15(y));
+#endif
+}
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Dither
+ * @{
+ */
+
+/**
+ * @brief  Converts a Q31 vector to Q15 with TPDF dither and noise shaping.
+ * @param[in,out] *S          points to an instance of the dither structure.
+ * @param[in]     *pSrc       points to the Q31 input vector.
+ * @param[out]    *pDst       points to the Q15 output vector.
+ * @param[in]     blockSize   number of samples, a multiple of the number of channels.
+ * @return none.
+ *
+ * \par
+ * The outputs are rounded, not truncated as by riscv_q31_to_q15(), and saturated.  With
+ * <code>USE_DSP_RISCV</code> two results are packed and written with one word access,
+ * <code>pDst</code> must be 4-byte aligned.
+ */
+
+void riscv_q31_to_q15_dither(
+  riscv_dither_instance * S,
+  q31_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_q31_to_q15_dither);
+  q31_t *pIn = pSrc;                             /* Src pointer */
+  q31_t *pErr = S->pState;                       /* Past errors of the channels */
+  uint32_t numChannels = S->numChannels;
+  uint32_t rnd = S->seed;                        /* xorshift32 state */
+  q31_t h1, h2;                                  /* Noise shaping filter */
+  q15_t out1, out2;
+  uint32_t c = 0u;                               /* Channel of the next sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+  h1 = (S->order == 0u) ? 0 : ((S->order == 1u) ? 1 : 2);
+  h2 = (S->order == 2u) ? -1 : 0;
+
+  /* Two samples per pass, one step of the generator */
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    rnd ^= rnd << 13;
+    rnd ^= rnd >> 17;
+    rnd ^= rnd << 5;
+
+    /* TPDF dither of +-255/256 LSB from two bytes each */
+    out1 = riscv_q31_to_q15_dither_step(pIn[0] >> 8, (q31_t) ((rnd & 0xFFu) + ((rnd >> 8) & 0xFFu)) - 255,
+                                        pErr + (2u * c), h1, h2);
+    c = (c + 1u == numChannels) ? 0u : c + 1u;
+    out2 = riscv_q31_to_q15_dither_step(pIn[1] >> 8, (q31_t) (((rnd >> 16) & 0xFFu) + (rnd >> 24)) - 255,
+                                        pErr + (2u * c), h1, h2);
+    c = (c + 1u == numChannels) ? 0u : c + 1u;
+
+#if defined (USE_DSP_RISCV)
+    *(shortV *) pDst = pack2(out1, out2);
+#else
+    pDst[0] = out1;
+    pDst[1] = out2;
+#endif
+
+    pIn += 2;
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  if((blockSize & 1u) != 0u)
+  {
+    rnd ^= rnd << 13;
+    rnd ^= rnd >> 17;
+    rnd ^= rnd << 5;
+
+    *pDst = riscv_q31_to_q15_dither_step(*pIn >> 8, (q31_t) ((rnd & 0xFFu) + ((rnd >> 8) & 0xFFu)) - 255,
+                                         pErr + (2u * c), h1, h2);
+  }
+
+  S->seed = rnd;
+}
+
+/**
+ * @} end of Dither group
+ */
@@ -74,6 +74,7 @@ void riscv_q31_to_q7(
   q7_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_q31_to_q7);
   uint32_t blkCnt;                               /* loop counter */
   q31_t *pIn = pSrc;
 #if defined (USE_DSP_RISCV)
@@ -70,6 +70,8 @@
  * 	pDst[n] = (float32_t) pSrc[n] / 128;   0 <= n < blockSize.    
  * </pre>    
  *   
+ * \par
+ * With the DSP extension four samples are read with one word access, <code>pSrc</code> must be 4-byte aligned.
  */
 
 
@@ -78,9 +80,44 @@ void riscv_q7_to_float(
   float32_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_q7_to_float);
   q7_t *pIn = pSrc;                              /* Src pointer */
   uint32_t blkCnt;                               /* loop counter */
 
+#if defined (USE_DSP_RISCV)
+
+  charV VectIn;                                  /* Packed input samples */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* C = (float32_t) A / 128 */
+    VectIn = *(charV *) pIn;
+    pDst[0] = (float32_t) VectIn[0] * 0.0078125f;
+    pDst[1] = (float32_t) VectIn[1] * 0.0078125f;
+    pDst[2] = (float32_t) VectIn[2] * 0.0078125f;
+    pDst[3] = (float32_t) VectIn[3] * 0.0078125f;
+
+    pIn += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (float32_t) * pIn++ * 0.0078125f;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
 
   /* Loop over blockSize number of values */
   blkCnt = blockSize;
@@ -94,6 +131,8 @@ void riscv_q7_to_float(
     /* Decrement the loop counter */
     blkCnt--;
   }
+
+#endif /* #if defined (USE_DSP_RISCV) */
 }
 
 /**    
@@ -77,11 +77,36 @@ void riscv_q7_to_q15(
   q15_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_q7_to_q15);
   q7_t *pIn = pSrc;                              /* Src pointer */
   uint32_t blkCnt;                               /* loop counter */
+#if defined (USE_DSP_RISCV)
+  charV in;                                      /* four input values */
+  charV zero = {0, 0, 0, 0};                     /* low bytes of the outputs */
+  charV lo = {0, 4, 0, 5};                       /* A[0] and A[1] into the high bytes of two halfwords */
+  charV hi = {0, 6, 0, 7};                       /* A[2] and A[3] into the high bytes of two halfwords */
 
+  /* Four outputs per word loaded, q7 << 8 only moves each byte into the high byte of a halfword */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    in = *(charV *) pIn;
+    pIn += 4;
+
+    *(charV *) pDst = shuffle2b(zero, in, lo);
+    *(charV *) (pDst + 2) = shuffle2b(zero, in, hi);
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 3u;
+#else
   /* Loop over blockSize number of values */
   blkCnt = blockSize;
+#endif
   while(blkCnt > 0u)
   {
     /* C = (q15_t) A << 8 */
@@ -74,11 +74,40 @@ void riscv_q7_to_q31(
   q31_t * pDst,
   uint32_t blockSize)
 {
+  RISCV_PROFILE(riscv_q7_to_q31);
   q7_t *pIn = pSrc;                              /* Src pointer */
   uint32_t blkCnt;                               /* loop counter */
+#if defined (USE_DSP_RISCV)
+  charV in;                                      /* four input values */
+  charV zero = {0, 0, 0, 0};                     /* low bytes of the outputs */
+  charV out0 = {0, 0, 0, 4};                     /* A[0] into the high byte of a word */
+  charV out1 = {0, 0, 0, 5};                     /* A[1] into the high byte of a word */
+  charV out2 = {0, 0, 0, 6};                     /* A[2] into the high byte of a word */
+  charV out3 = {0, 0, 0, 7};                     /* A[3] into the high byte of a word */
 
+  /* Four outputs per word loaded, q7 << 24 only moves each byte into the high byte of a word */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    in = *(charV *) pIn;
+    pIn += 4;
+
+    *(charV *) pDst = shuffle2b(zero, in, out0);
+    *(charV *) (pDst + 1) = shuffle2b(zero, in, out1);
+    *(charV *) (pDst + 2) = shuffle2b(zero, in, out2);
+    *(charV *) (pDst + 3) = shuffle2b(zero, in, out3);
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 3u;
+#else
   /* Loop over blockSize number of values */
   blkCnt = blockSize;
+#endif
   while(blkCnt > 0u)
   {
     /* C = (q31_t) A << 24 */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_ringbuf_init.c
+*
+* Description:  Initialization function for the single-producer,
+*               single-consumer ring buffer.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup RingBuffer Ring Buffer
+ *
+ * A ring buffer of <code>length</code> elements of <code>elemSize</code> bytes that hands data
+ * from one producer to one consumer, for example from a sampling ISR to the processing task.
+ * It holds two free-running counters: <code>head</code>, the number of elements written so far,
+ * only changed by the producer, and <code>tail</code>, the number of elements read so far, only
+ * changed by the consumer.  Neither side needs a lock or has to disable interrupts, and
+ * <code>head - tail</code> is the number of elements in the buffer even after the counters wrap.
+ * <code>length</code> is a power of two so that the position of a counter is a mask.
+ *
+ * \par
+ * riscv_ringbuf_write() and riscv_ringbuf_read() copy a block in at most two
+ * <code>memcpy</code>, one up to the end of the memory and one from its start, instead of
+ * checking the wrap for every sample as riscv_circularWrite_f32() does.
+ *
+ * \par Zero-copy Access:
+ * riscv_ringbuf_write_span() returns the largest contiguous free region and
+ * riscv_ringbuf_read_span() the largest contiguous region of unread data, so a kernel such
+ * as riscv_fir_q15() can write its output directly into the buffer or read its input from it.
+ * riscv_ringbuf_write_commit() and riscv_ringbuf_read_commit() then publish the elements
+ * that were produced or consumed.  When the data wraps, a second span call returns the rest.
+ *
+ * \par
+ * The elements of a block are made visible before the counter that publishes them with
+ * RISCV_RINGBUF_BARRIER(), a compiler barrier by default, which is sufficient when both sides
+ * run on the same core.  If they run on different cores, define it as a <code>fence</code>.
+ * Each of the functions must only be called from its own side; riscv_ringbuf_init() is not
+ * safe to call while the buffer is in use.
+ */
+
+/**
+ * @addtogroup RingBuffer
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the ring buffer.
+ * @param[out] *S        points to an instance of the ring buffer structure.
+ * @param[in]  *pBuffer  points to the memory of <code>length*elemSize</code> bytes.
+ * @param[in]  length    number of elements, a power of two.
+ * @param[in]  elemSize  size of an element in bytes, for example <code>sizeof(q15_t)</code>.
+ * @return     The function returns RISCV_MATH_SUCCESS if initialization is successful, or RISCV_MATH_LENGTH_ERROR if
+ * <code>length</code> is not a power of two, greater than 2^31, or <code>elemSize</code> is 0.
+ *
+ * \par
+ * The buffer starts empty.  Every element of the buffer can be used, a full buffer holds
+ * <code>length</code> elements.
+ */
+
+riscv_status riscv_ringbuf_init(
+  riscv_ringbuf_instance * S,
+  void * pBuffer,
+  uint32_t length,
+  uint32_t elemSize)
+{
+  RISCV_PROFILE(riscv_ringbuf_init);
+  if((length == 0u) || ((length & (length - 1u)) != 0u) || (length > 0x80000000u) || (elemSize == 0u))
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  S->pBuffer = (uint8_t *) pBuffer;
+  S->length = length;
+  S->elemSize = elemSize;
+  S->head = 0u;
+  S->tail = 0u;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of RingBuffer group
+ */
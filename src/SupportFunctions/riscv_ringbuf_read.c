@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_ringbuf_read.c
+*
+* Description:  Consumer side of the single-producer, single-consumer
+*               ring buffer.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup RingBuffer
+ * @{
+ */
+
+/**
+ * @brief  Number of unread elements of the ring buffer, consumer side.
+ * @param[in]  *S  points to an instance of the ring buffer structure.
+ * @return     number of elements that can be read.
+ */
+
+uint32_t riscv_ringbuf_count(
+  const riscv_ringbuf_instance * S)
+{
+  RISCV_PROFILE(riscv_ringbuf_count);
+  return (S->head - S->tail);
+}
+
+/**
+ * @brief  Reads a block of elements from the ring buffer.
+ * @param[in,out] *S      points to an instance of the ring buffer structure.
+ * @param[out]    *pDst   points to the destination of the elements.
+ * @param[in]     count   number of elements to read.
+ * @return        number of elements read, less than <code>count</code> if the buffer holds fewer.
+ */
+
+uint32_t riscv_ringbuf_read(
+  riscv_ringbuf_instance * S,
+  void * pDst,
+  uint32_t count)
+{
+  RISCV_PROFILE(riscv_ringbuf_read);
+  uint32_t tail = S->tail;                       /* Only this side changes tail */
+  uint32_t pos = tail & (S->length - 1u);        /* Read position in the memory */
+  uint32_t first;                                /* Elements up to the end of the memory */
+  uint32_t avail = S->head - tail;
+  uint32_t elemSize = S->elemSize;
+
+  if(count > avail)
+  {
+    count = avail;
+  }
+
+  /* The elements are read after head shows them */
+  RISCV_RINGBUF_BARRIER();
+
+  first = S->length - pos;
+  if(first > count)
+  {
+    first = count;
+  }
+
+  memcpy(pDst, S->pBuffer + (pos * elemSize), first * elemSize);
+  memcpy((uint8_t *) pDst + (first * elemSize), S->pBuffer, (count - first) * elemSize);
+
+  /* Release the elements after they are read */
+  RISCV_RINGBUF_BARRIER();
+  S->tail = tail + count;
+
+  return (count);
+}
+
+/**
+ * @brief  Contiguous region of unread elements of the ring buffer.
+ * @param[in]  *S       points to an instance of the ring buffer structure.
+ * @param[out] *ppSpan  receives the address of the oldest unread element.
+ * @return     number of contiguous unread elements at <code>*ppSpan</code>, 0 if the buffer is empty.
+ *
+ * \par
+ * The region can be processed in place, riscv_ringbuf_read_commit() then releases the
+ * elements consumed.  If the data wraps around the end of the memory, the rest is returned
+ * by the next call after the commit.
+ */
+
+uint32_t riscv_ringbuf_read_span(
+  const riscv_ringbuf_instance * S,
+  void ** ppSpan)
+{
+  RISCV_PROFILE(riscv_ringbuf_read_span);
+  uint32_t tail = S->tail;
+  uint32_t pos = tail & (S->length - 1u);        /* Read position in the memory */
+  uint32_t avail = S->head - tail;
+  uint32_t first = S->length - pos;              /* Elements up to the end of the memory */
+
+  RISCV_RINGBUF_BARRIER();
+  *ppSpan = S->pBuffer + (pos * S->elemSize);
+
+  return ((avail < first) ? avail : first);
+}
+
+/**
+ * @brief  Releases elements read through riscv_ringbuf_read_span().
+ * @param[in,out] *S     points to an instance of the ring buffer structure.
+ * @param[in]     count  number of elements consumed, at most the span length.
+ * @return none.
+ */
+
+void riscv_ringbuf_read_commit(
+  riscv_ringbuf_instance * S,
+  uint32_t count)
+{
+  RISCV_PROFILE(riscv_ringbuf_read_commit);
+  RISCV_RINGBUF_BARRIER();
+  S->tail = S->tail + count;
+}
+
+/**
+ * @} end of RingBuffer group
+ */
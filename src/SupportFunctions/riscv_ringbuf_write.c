@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_ringbuf_write.c
+*
+* Description:  Producer side of the single-producer, single-consumer
+*               ring buffer.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup RingBuffer
+ * @{
+ */
+
+/**
+ * @brief  Number of free elements of the ring buffer, producer side.
+ * @param[in]  *S  points to an instance of the ring buffer structure.
+ * @return     number of elements that can be written.
+ */
+
+uint32_t riscv_ringbuf_space(
+  const riscv_ringbuf_instance * S)
+{
+  RISCV_PROFILE(riscv_ringbuf_space);
+  return (S->length - (S->head - S->tail));
+}
+
+/**
+ * @brief  Writes a block of elements to the ring buffer.
+ * @param[in,out] *S      points to an instance of the ring buffer structure.
+ * @param[in]     *pSrc   points to the elements to write.
+ * @param[in]     count   number of elements to write.
+ * @return        number of elements written, less than <code>count</code> if the buffer is full.
+ */
+
+uint32_t riscv_ringbuf_write(
+  riscv_ringbuf_instance * S,
+  const void * pSrc,
+  uint32_t count)
+{
+  RISCV_PROFILE(riscv_ringbuf_write);
+  uint32_t head = S->head;                       /* Only this side changes head */
+  uint32_t pos = head & (S->length - 1u);        /* Write position in the memory */
+  uint32_t first;                                /* Elements up to the end of the memory */
+  uint32_t space = S->length - (head - S->tail);
+  uint32_t elemSize = S->elemSize;
+
+  if(count > space)
+  {
+    count = space;
+  }
+
+  first = S->length - pos;
+  if(first > count)
+  {
+    first = count;
+  }
+
+  memcpy(S->pBuffer + (pos * elemSize), pSrc, first * elemSize);
+  memcpy(S->pBuffer, (const uint8_t *) pSrc + (first * elemSize), (count - first) * elemSize);
+
+  /* Publish the elements after they are stored */
+  RISCV_RINGBUF_BARRIER();
+  S->head = head + count;
+
+  return (count);
+}
+
+/**
+ * @brief  Contiguous free region of the ring buffer.
+ * @param[in]  *S       points to an instance of the ring buffer structure.
+ * @param[out] *ppSpan  receives the address of the first free element.
+ * @return     number of contiguous free elements at <code>*ppSpan</code>, 0 if the buffer is full.
+ *
+ * \par
+ * The region can be written in place, riscv_ringbuf_write_commit() then publishes the
+ * elements written.  If the free elements wrap around the end of the memory, the rest is
+ * returned by the next call after the commit.
+ */
+
+uint32_t riscv_ringbuf_write_span(
+  const riscv_ringbuf_instance * S,
+  void ** ppSpan)
+{
+  RISCV_PROFILE(riscv_ringbuf_write_span);
+  uint32_t head = S->head;
+  uint32_t pos = head & (S->length - 1u);        /* Write position in the memory */
+  uint32_t space = S->length - (head - S->tail);
+  uint32_t first = S->length - pos;              /* Elements up to the end of the memory */
+
+  *ppSpan = S->pBuffer + (pos * S->elemSize);
+
+  return ((space < first) ? space : first);
+}
+
+/**
+ * @brief  Publishes elements written through riscv_ringbuf_write_span().
+ * @param[in,out] *S     points to an instance of the ring buffer structure.
+ * @param[in]     count  number of elements written, at most the span length.
+ * @return none.
+ */
+
+void riscv_ringbuf_write_commit(
+  riscv_ringbuf_instance * S,
+  uint32_t count)
+{
+  RISCV_PROFILE(riscv_ringbuf_write_commit);
+  RISCV_RINGBUF_BARRIER();
+  S->head = S->head + count;
+}
+
+/**
+ * @} end of RingBuffer group
+ */
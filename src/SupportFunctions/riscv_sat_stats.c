@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sat_stats.c
+*
+* Description:  Per-kernel saturation count and peak table of the
+*               RISCV_DSP_SAT_STATS instrumentation.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup SatStats Saturation Statistics
+ *
+ * The fixed-point kernels saturate silently.  When the library is compiled with <code>RISCV_DSP_SAT_STATS</code>
+ * (CMake option of the same name) the saturating kernels below count, per kernel, the values they check
+ * against the limits of their output format, the values outside the limits, which they saturate, and the
+ * largest magnitude before saturation.  riscv_sat_stats_headroom() turns the peak into the number of bits
+ * the signal could grow, or by how many bits it overflowed, to choose the Q formats, scale factors and
+ * postShift values of a chain from the data of a real run.
+ *
+ * \par
+ * Instrumented kernels: riscv_add_q15(), riscv_add_q31(), riscv_sub_q15(), riscv_sub_q31(),
+ * riscv_scale_q15(), riscv_scale_q31(), riscv_shift_q15(), riscv_shift_q31(), riscv_fir_fast_q15(),
+ * riscv_biquad_cascade_df1_q15(), riscv_biquad_cascade_df1_fast_q15() and the stage outputs of
+ * riscv_cfft_scaled_q15().  riscv_cfft_q15() scales every stage and cannot saturate.  A right shift cannot
+ * saturate either, riscv_shift_q15() and riscv_shift_q31() only count the values of left shifts.
+ *
+ * \par
+ * As with RISCV_DSP_PROFILE, the record of a kernel is a static variable that takes a slot of the
+ * RISCV_SAT_STATS_MAX_KERNELS of the table on the first call, and the counts of a call are added to it
+ * when the kernel returns.  Values are counted for the innermost instrumented kernel running, a kernel
+ * called by another one has its own record.  Without <code>RISCV_DSP_SAT_STATS</code> the instrumentation is empty and the
+ * kernels are compiled exactly as before.  The counts are 32-bit, and the table is not protected against
+ * concurrent updates.
+ */
+
+/**
+ * @addtogroup SatStats
+ * @{
+ */
+
+/* Registered records, kernel ID i is riscv_sat_stats_table[i - 1] */
+static riscv_sat_stats_entry * riscv_sat_stats_table[RISCV_SAT_STATS_MAX_KERNELS];
+static uint32_t riscv_sat_stats_count = 0u;
+
+riscv_sat_stats_scope * riscv_sat_stats_current = NULL;
+
+/**
+ * @brief  Start of an instrumented kernel, registers its record on the first call.
+ * @param[in, out] *pEntry  points to the record of the kernel.
+ * @param[out]     *pScope  points to the counts of the call, which become riscv_sat_stats_current.
+ * @return none.
+ */
+
+void riscv_sat_stats_enter(
+  riscv_sat_stats_entry * pEntry,
+  riscv_sat_stats_scope * pScope)
+{
+  if((pEntry->id == 0u) && (riscv_sat_stats_count < RISCV_SAT_STATS_MAX_KERNELS))
+  {
+    riscv_sat_stats_table[riscv_sat_stats_count] = pEntry;
+    riscv_sat_stats_count++;
+    pEntry->id = riscv_sat_stats_count;
+  }
+
+  pScope->pEntry = pEntry;
+  pScope->pPrev = riscv_sat_stats_current;
+  pScope->max = ((q63_t) 1 << (pEntry->bits - 1u)) - 1;
+  pScope->values = 0u;
+  pScope->saturations = 0u;
+  pScope->peak = 0;
+
+  riscv_sat_stats_current = pScope;
+}
+
+/**
+ * @brief  End of an instrumented kernel, adds the counts of the call to its record and restores the counts of the caller.
+ * @param[in]  *pScope  points to the counts of the call.
+ * @return none.
+ */
+
+void riscv_sat_stats_exit(
+  riscv_sat_stats_scope * pScope)
+{
+  riscv_sat_stats_entry *pEntry = pScope->pEntry;
+
+  pEntry->calls++;
+  pEntry->values += pScope->values;
+  pEntry->saturations += pScope->saturations;
+  if(pScope->peak > pEntry->peak)
+  {
+    pEntry->peak = pScope->peak;
+  }
+
+  riscv_sat_stats_current = pScope->pPrev;
+}
+
+/**
+ * @brief  Clears the records of all kernels.
+ * @return none.
+ */
+
+void riscv_sat_stats_reset(
+  void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < riscv_sat_stats_count; i++)
+  {
+    riscv_sat_stats_table[i]->calls = 0u;
+    riscv_sat_stats_table[i]->values = 0u;
+    riscv_sat_stats_table[i]->saturations = 0u;
+    riscv_sat_stats_table[i]->peak = 0;
+  }
+}
+
+/**
+ * @brief  Record of a kernel ID.
+ * @param[in]  id  kernel ID, 1 to the number of kernels called so far.
+ * @return     points to the record, or NULL if no kernel has this ID.
+ */
+
+const riscv_sat_stats_entry * riscv_sat_stats_get(
+  uint32_t id)
+{
+  if((id == 0u) || (id > riscv_sat_stats_count))
+  {
+    return (NULL);
+  }
+
+  return (riscv_sat_stats_table[id - 1u]);
+}
+
+/**
+ * @brief  Hands the record of every kernel called so far to a print function, in kernel ID order.
+ * @param[in]  func  function called once per record.
+ * @param[in]  *ctx  context handed to <code>func</code>.
+ * @return     number of records.
+ */
+
+uint32_t riscv_sat_stats_dump(
+  riscv_sat_stats_dump_func func,
+  void * ctx)
+{
+  uint32_t i;
+
+  for (i = 0u; i < riscv_sat_stats_count; i++)
+  {
+    func(ctx, riscv_sat_stats_table[i]);
+  }
+
+  return (riscv_sat_stats_count);
+}
+
+/**
+ * @brief  Headroom of a kernel, in bits, between the peak of its values and the saturation limit.
+ * @param[in]  *pEntry  points to the record of the kernel.
+ * @return     number of bits the values could grow without saturating, negative when they saturated
+ *             by that many bits.
+ *
+ * \par
+ * The headroom is <code>bits - 1</code> minus the number of bits of the peak magnitude: a Q15 kernel whose
+ * largest value was 0x1234 has 2 bits of headroom, one that reached 0x12345 before saturating has -2.  A
+ * kernel that only saw zeros reports <code>bits - 1</code>.
+ */
+
+int32_t riscv_sat_stats_headroom(
+  const riscv_sat_stats_entry * pEntry)
+{
+  uint64_t peak = (uint64_t) pEntry->peak;
+  int32_t length = 0;
+
+  while(peak != 0u)
+  {
+    length++;
+    peak >>= 1u;
+  }
+
+  return ((int32_t) pEntry->bits - 1 - length);
+}
+
+/**
+ * @} end of SatStats group
+ */
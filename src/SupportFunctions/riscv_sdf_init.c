@@ -0,0 +1,431 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sdf_init.c
+*
+* Description:  Repetition vector, schedule and buffer sizes of a
+*               synchronous dataflow graph.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup SDF Synchronous Dataflow Graph
+ *
+ * A synchronous dataflow graph chains kernels without a frame buffer between every two of them.
+ * Each node wraps a kernel, for example riscv_fir_decimate_q15() on 64 input samples, and each edge
+ * declares how many elements a firing of its producer writes and a firing of its consumer reads.
+ * riscv_sdf_init() solves the balance equations <code>repeat[src]*produce = repeat[dst]*consume</code>
+ * of the edges for the smallest repetition vector, orders the firings of one period and sizes the
+ * buffer of each edge for that order; riscv_sdf_run() then only calls the kernels.
+ *
+ * \par
+ * A period ends with every edge empty.  Small rates let small chunks travel the whole chain while they
+ * are still in the data cache or in L1: the schedule fires the last node that has enough input,
+ * so data is consumed as soon as it is complete instead of a stage running over the whole frame.
+ * For a chain of riscv_fir_decimate_q15() by 4 on 64 samples, riscv_rfft_q15() of 128 points,
+ * riscv_cmplx_mag_q15() and riscv_max_q15() the period fires the decimator 8 times and the others
+ * once, and the edge from the decimator holds the 128 samples of the FFT, not the 512 of the frame.
+ *
+ * \par Zero-copy Edges
+ * A node gets pointers into the buffers of its edges and runs the kernel on them directly.  The edges are
+ * linear FIFOs rather than riscv_ringbuf_instance, so that the <code>consume</code> elements of a
+ * firing are always contiguous: the positions go back to the start whenever an edge runs empty, and the
+ * capacity of an edge is the largest position the schedule reaches.  It equals the larger rate when one rate
+ * divides the other, and grows to a multiple of both otherwise.
+ *
+ * \par Graph Rules
+ * Edges go from a node to a later one, so the order of the nodes is the order of the chain, and no node
+ * has more than RISCV_SDF_MAX_PORTS input or output edges.  The first node has no input; the nodes
+ * without input edges read the input of the graph and the nodes without output edges write its results,
+ * both through their argument.  Feedback edges with initial elements are not supported.
+ *
+ * \par Partitioning Across Cores
+ * With <code>numStages</code> greater than 1 the nodes are split into that many contiguous ranges of
+ * about equal <code>cost*repeat</code>, and riscv_sdf_run_par() runs each range on its own core, period
+ * <code>t-s</code> on core <code>s</code> in step <code>t</code>.  An edge from stage <code>s</code> to
+ * stage <code>d</code> holds a whole period in <code>d-s+1</code> copies so that the producer fills
+ * one copy while the consumer empties an older one.
+ */
+
+/**
+ * @addtogroup SDF
+ * @{
+ */
+
+static uint32_t riscv_sdf_gcd(
+  uint32_t a,
+  uint32_t b)
+{
+  uint32_t t;
+
+  while(b != 0u)
+  {
+    t = a % b;
+    a = b;
+    b = t;
+  }
+
+  return (a);
+}
+
+/*
+* @brief  Sets the repetitions of node to from those of node from, scaling all repetitions if they do not divide.
+*/
+
+static riscv_status riscv_sdf_balance(
+  uint32_t * pRepeat,
+  uint16_t numNodes,
+  uint32_t from,
+  uint32_t rateFrom,
+  uint32_t to,
+  uint32_t rateTo)
+{
+  uint64_t num = (uint64_t) pRepeat[from] * rateFrom;
+  uint32_t m = rateTo / riscv_sdf_gcd((uint32_t) (num % rateTo), rateTo);
+  uint32_t n;
+
+  for (n = 0u; (m > 1u) && (n < numNodes); n++)
+  {
+    if(((uint64_t) pRepeat[n] * m) > 0xFFFFFFFFu)
+    {
+      return (RISCV_MATH_SIZE_MISMATCH);
+    }
+
+    pRepeat[n] *= m;
+  }
+
+  num = (num * m) / rateTo;
+  if(num > 0xFFFFFFFFu)
+  {
+    return (RISCV_MATH_SIZE_MISMATCH);
+  }
+
+  pRepeat[to] = (uint32_t) num;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/*
+* @brief  Whether all input edges of node n hold the elements of a firing.
+*/
+
+static int32_t riscv_sdf_ready(
+  const riscv_sdf_instance * G,
+  uint32_t n)
+{
+  uint32_t k, e;
+
+  for (k = G->pPortIndex[2u * n]; k < G->pPortIndex[(2u * n) + 1u]; k++)
+  {
+    e = G->pPorts[k];
+    if((G->pFifo[e].write - G->pFifo[e].read) < G->pEdges[e].consume)
+    {
+      return (0);
+    }
+  }
+
+  return (1);
+}
+
+/**
+ * @brief  Initialization function of a synchronous dataflow graph.
+ * @param[out]    *G          points to an instance of the dataflow graph structure.
+ * @param[in]     *pNodes     points to the nodes, kept by the instance.
+ * @param[in]     numNodes    number of nodes.
+ * @param[in]     *pEdges     points to the edges, kept by the instance.
+ * @param[in]     numEdges    number of edges.
+ * @param[in]     numStages   number of pipeline stages for riscv_sdf_run_par(), 1 for riscv_sdf_run() only.
+ * @param[in,out] *pArena     points to the arena the schedule and the buffers are taken from.
+ * @return        RISCV_MATH_SUCCESS, RISCV_MATH_ARGUMENT_ERROR if the graph is not a connected chain of
+ * forward edges, RISCV_MATH_SIZE_MISMATCH if the rates have no periodic schedule, or
+ * RISCV_MATH_LENGTH_ERROR if the arena is too small.
+ *
+ * \par
+ * The repetition vector, the schedule, the stages and the edge buffers are all taken from the arena with
+ * riscv_dsp_arena_alloc(); the firing counts of the schedule construction use its scratch region.
+ * Initializing on the host with a large arena and reading riscv_dsp_arena_usage() gives the size of
+ * the arena of the target.  <code>G->pRepeat</code> and the <code>capacity</code> of <code>G->pFifo</code>
+ * report the repetition vector and the buffer sizes.  The stage of a node depends on the <code>cost</code>
+ * of the nodes, which can be left 0 for riscv_sdf_run().
+ */
+
+riscv_status riscv_sdf_init(
+  riscv_sdf_instance * G,
+  const riscv_sdf_node * pNodes,
+  uint16_t numNodes,
+  const riscv_sdf_edge * pEdges,
+  uint16_t numEdges,
+  uint16_t numStages,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_sdf_init);
+  const riscv_sdf_edge *e;
+  riscv_sdf_fifo *f;
+  uint32_t *pLeft;
+  uint16_t *pOrder;
+  uint64_t bytes, total, acc;
+  uint32_t n, i, k, s, g, len, changed;
+  riscv_status status;
+
+  if((numNodes == 0u) || (numStages == 0u) || (numStages > numNodes))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < numEdges; i++)
+  {
+    e = &pEdges[i];
+    if((e->src >= e->dst) || (e->dst >= numNodes) || (e->produce == 0u) || (e->consume == 0u) ||
+       (e->elemSize == 0u))
+    {
+      return (RISCV_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  G->pNodes = pNodes;
+  G->pEdges = pEdges;
+  G->numNodes = numNodes;
+  G->numEdges = numEdges;
+  G->numStages = numStages;
+  G->pRepeat = (uint32_t *) riscv_dsp_arena_alloc(pArena, numNodes * sizeof(uint32_t));
+  G->pStage = (uint16_t *) riscv_dsp_arena_alloc(pArena, numNodes * sizeof(uint16_t));
+  G->pPortIndex = (uint16_t *) riscv_dsp_arena_alloc(pArena, ((2u * numNodes) + 1u) * sizeof(uint16_t));
+  G->pPorts = (uint16_t *) riscv_dsp_arena_alloc(pArena, 2u * numEdges * sizeof(uint16_t));
+  G->pFifo = (riscv_sdf_fifo *) riscv_dsp_arena_alloc(pArena, numEdges * sizeof(riscv_sdf_fifo));
+  G->pStageFirst = (uint32_t *) riscv_dsp_arena_alloc(pArena, (numStages + 1u) * sizeof(uint32_t));
+
+  if((G->pRepeat == NULL) || (G->pStage == NULL) || (G->pPortIndex == NULL) || (G->pPorts == NULL) ||
+     (G->pFifo == NULL) || (G->pStageFirst == NULL))
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  /* inputs and then outputs of every node, in the order of the edges */
+  k = 0u;
+  for (n = 0u; n < numNodes; n++)
+  {
+    G->pPortIndex[2u * n] = (uint16_t) k;
+    for (i = 0u; i < numEdges; i++)
+    {
+      if(pEdges[i].dst == n)
+      {
+        G->pPorts[k++] = (uint16_t) i;
+      }
+    }
+
+    G->pPortIndex[(2u * n) + 1u] = (uint16_t) k;
+    for (i = 0u; i < numEdges; i++)
+    {
+      if(pEdges[i].src == n)
+      {
+        G->pPorts[k++] = (uint16_t) i;
+      }
+    }
+
+    if(((G->pPortIndex[(2u * n) + 1u] - G->pPortIndex[2u * n]) > RISCV_SDF_MAX_PORTS) ||
+       ((k - G->pPortIndex[(2u * n) + 1u]) > RISCV_SDF_MAX_PORTS))
+    {
+      return (RISCV_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  G->pPortIndex[2u * numNodes] = (uint16_t) k;
+
+  /* repetition vector, spread from node 0 over the edges */
+  for (n = 0u; n < numNodes; n++)
+  {
+    G->pRepeat[n] = 0u;
+  }
+
+  G->pRepeat[0] = 1u;
+  do
+  {
+    changed = 0u;
+    for (i = 0u; i < numEdges; i++)
+    {
+      e = &pEdges[i];
+      status = RISCV_MATH_SUCCESS;
+      if((G->pRepeat[e->src] != 0u) && (G->pRepeat[e->dst] == 0u))
+      {
+        status = riscv_sdf_balance(G->pRepeat, numNodes, e->src, e->produce, e->dst, e->consume);
+        changed = 1u;
+      }
+      else if((G->pRepeat[e->dst] != 0u) && (G->pRepeat[e->src] == 0u))
+      {
+        status = riscv_sdf_balance(G->pRepeat, numNodes, e->dst, e->consume, e->src, e->produce);
+        changed = 1u;
+      }
+
+      if(status != RISCV_MATH_SUCCESS)
+      {
+        return (status);
+      }
+    }
+  } while(changed != 0u);
+
+  g = 0u;
+  for (n = 0u; n < numNodes; n++)
+  {
+    if(G->pRepeat[n] == 0u)
+    {
+      return (RISCV_MATH_ARGUMENT_ERROR);
+    }
+
+    g = riscv_sdf_gcd(G->pRepeat[n], g);
+  }
+
+  for (i = 0u; i < numEdges; i++)
+  {
+    e = &pEdges[i];
+    if(((uint64_t) G->pRepeat[e->src] * e->produce) != ((uint64_t) G->pRepeat[e->dst] * e->consume))
+    {
+      return (RISCV_MATH_SIZE_MISMATCH);
+    }
+  }
+
+  total = 0u;
+  for (n = 0u; n < numNodes; n++)
+  {
+    G->pRepeat[n] /= g;
+    total += G->pRepeat[n];
+  }
+
+  if(total > 0xFFFFu)
+  {
+    return (RISCV_MATH_SIZE_MISMATCH);
+  }
+
+  len = (uint32_t) total;
+  G->pSchedule = (uint16_t *) riscv_dsp_arena_alloc(pArena, len * sizeof(uint16_t));
+  pLeft = (uint32_t *) riscv_dsp_arena_scratch(pArena, numNodes * sizeof(uint32_t));
+  if((G->pSchedule == NULL) || (pLeft == NULL))
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  /* contiguous stages of about equal cost, leaving at least one node for every later stage */
+  total = 0u;
+  for (n = 0u; n < numNodes; n++)
+  {
+    total += (uint64_t) G->pRepeat[n] * ((pNodes[n].cost != 0u) ? pNodes[n].cost : 1u);
+  }
+
+  s = 0u;
+  acc = 0u;
+  for (n = 0u; n < numNodes; n++)
+  {
+    G->pStage[n] = (uint16_t) s;
+    acc += (uint64_t) G->pRepeat[n] * ((pNodes[n].cost != 0u) ? pNodes[n].cost : 1u);
+    if(((s + 1u) < numStages) &&
+       (((acc * numStages) >= (total * (s + 1u))) || ((numNodes - 1u - n) == (numStages - 1u - s))))
+    {
+      s++;
+    }
+  }
+
+  /* one period, firing the last node that is ready and sizing the edges for that order */
+  for (i = 0u; i < numEdges; i++)
+  {
+    G->pFifo[i].capacity = 0u;
+    G->pFifo[i].read = 0u;
+    G->pFifo[i].write = 0u;
+    G->pFifo[i].copies = 1u;
+  }
+
+  for (n = 0u; n < numNodes; n++)
+  {
+    pLeft[n] = G->pRepeat[n];
+  }
+
+  for (k = 0u; k < len; k++)
+  {
+    n = numNodes;
+    do
+    {
+      if(n == 0u)
+      {
+        return (RISCV_MATH_SIZE_MISMATCH);
+      }
+
+      n--;
+    } while((pLeft[n] == 0u) || (riscv_sdf_ready(G, n) == 0));
+
+    for (i = G->pPortIndex[2u * n]; i < G->pPortIndex[(2u * n) + 1u]; i++)
+    {
+      f = &G->pFifo[G->pPorts[i]];
+      f->read += pEdges[G->pPorts[i]].consume;
+      if(f->read == f->write)
+      {
+        f->read = 0u;
+        f->write = 0u;
+      }
+    }
+
+    for (i = G->pPortIndex[(2u * n) + 1u]; i < G->pPortIndex[(2u * n) + 2u]; i++)
+    {
+      f = &G->pFifo[G->pPorts[i]];
+      f->write += pEdges[G->pPorts[i]].produce;
+      f->capacity = (f->write > f->capacity) ? f->write : f->capacity;
+    }
+
+    G->pSchedule[k] = (uint16_t) n;
+    pLeft[n]--;
+  }
+
+  /* edges between stages hold a whole period per period in flight */
+  for (i = 0u; i < numEdges; i++)
+  {
+    e = &pEdges[i];
+    f = &G->pFifo[i];
+    if(G->pStage[e->src] != G->pStage[e->dst])
+    {
+      f->copies = (uint32_t) G->pStage[e->dst] - G->pStage[e->src] + 1u;
+      f->capacity = G->pRepeat[e->src] * e->produce;
+    }
+
+    bytes = (uint64_t) f->copies * f->capacity * e->elemSize;
+    f->pBuffer = (bytes <= 0xFFFFFFFFu) ? (uint8_t *) riscv_dsp_arena_alloc(pArena, (uint32_t) bytes) : NULL;
+    if(f->pBuffer == NULL)
+    {
+      return (RISCV_MATH_LENGTH_ERROR);
+    }
+  }
+
+  /* firings grouped by stage, in schedule order within a stage */
+  G->pStageFirst[0] = 0u;
+  G->pStageFirst[numStages] = len;
+  if(numStages > 1u)
+  {
+    pOrder = (uint16_t *) riscv_dsp_arena_scratch(pArena, len * sizeof(uint16_t));
+    if(pOrder == NULL)
+    {
+      return (RISCV_MATH_LENGTH_ERROR);
+    }
+
+    memcpy(pOrder, G->pSchedule, len * sizeof(uint16_t));
+    k = 0u;
+    for (s = 0u; s < numStages; s++)
+    {
+      G->pStageFirst[s] = k;
+      for (i = 0u; i < len; i++)
+      {
+        if(G->pStage[pOrder[i]] == s)
+        {
+          G->pSchedule[k++] = pOrder[i];
+        }
+      }
+    }
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SDF group
+ */
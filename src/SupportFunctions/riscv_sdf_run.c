@@ -0,0 +1,205 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sdf_run.c
+*
+* Description:  Runs the schedule of a synchronous dataflow graph on one
+*               core or pipelined across the cluster cores.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup SDF
+ * @{
+ */
+
+typedef struct
+{
+  riscv_sdf_instance *G;
+  uint32_t numPeriods;
+  uint32_t step;
+} riscv_sdf_par_args;
+
+/*
+* @brief  Calls node n on its edges and moves their positions, period selects the copy of the edges between stages.
+*/
+
+static void riscv_sdf_fire(
+  riscv_sdf_instance * G,
+  uint32_t n,
+  uint32_t period)
+{
+  const void *pIn[RISCV_SDF_MAX_PORTS];
+  void *pOut[RISCV_SDF_MAX_PORTS];
+  const riscv_sdf_edge *e;
+  riscv_sdf_fifo *f;
+  uint32_t first = G->pPortIndex[2u * n];
+  uint32_t mid = G->pPortIndex[(2u * n) + 1u];
+  uint32_t last = G->pPortIndex[(2u * n) + 2u];
+  uint32_t k;
+
+  for (k = first; k < mid; k++)
+  {
+    e = &G->pEdges[G->pPorts[k]];
+    f = &G->pFifo[G->pPorts[k]];
+    pIn[k - first] = f->pBuffer + ((((period % f->copies) * f->capacity) + f->read) * e->elemSize);
+  }
+
+  for (k = mid; k < last; k++)
+  {
+    e = &G->pEdges[G->pPorts[k]];
+    f = &G->pFifo[G->pPorts[k]];
+    pOut[k - mid] = f->pBuffer + ((((period % f->copies) * f->capacity) + f->write) * e->elemSize);
+  }
+
+  G->pNodes[n].func(G->pNodes[n].arg, pIn, pOut);
+
+  for (k = first; k < mid; k++)
+  {
+    f = &G->pFifo[G->pPorts[k]];
+    f->read += G->pEdges[G->pPorts[k]].consume;
+    if((f->copies == 1u) && (f->read == f->write))
+    {
+      f->read = 0u;
+      f->write = 0u;
+    }
+  }
+
+  for (k = mid; k < last; k++)
+  {
+    G->pFifo[G->pPorts[k]].write += G->pEdges[G->pPorts[k]].produce;
+  }
+}
+
+/*
+* @brief  Runs the firings of one stage for one period.
+*/
+
+static void riscv_sdf_stage(
+  riscv_sdf_instance * G,
+  uint32_t stage,
+  uint32_t period)
+{
+  const riscv_sdf_edge *e;
+  uint32_t i;
+
+  /* a period fills and empties the edges between stages from their start,
+     each side resets only its own position */
+  for (i = 0u; i < G->numEdges; i++)
+  {
+    e = &G->pEdges[i];
+    if(G->pFifo[i].copies > 1u)
+    {
+      if(G->pStage[e->src] == stage)
+      {
+        G->pFifo[i].write = 0u;
+      }
+
+      if(G->pStage[e->dst] == stage)
+      {
+        G->pFifo[i].read = 0u;
+      }
+    }
+  }
+
+  for (i = G->pStageFirst[stage]; i < G->pStageFirst[stage + 1u]; i++)
+  {
+    riscv_sdf_fire(G, G->pSchedule[i], period);
+  }
+}
+
+/*
+* @brief  Core s runs stage s on period step-s, if that period is one of the call.
+*/
+
+static void riscv_sdf_par_worker(
+  void * arg,
+  uint32_t coreId,
+  uint32_t numCores)
+{
+  const riscv_sdf_par_args *a = (const riscv_sdf_par_args *) arg;
+
+  (void) numCores;
+
+  if((coreId < a->G->numStages) && (a->step >= coreId) && ((a->step - coreId) < a->numPeriods))
+  {
+    riscv_sdf_stage(a->G, coreId, a->step - coreId);
+  }
+}
+
+/**
+ * @brief  Runs periods of a synchronous dataflow graph on the calling core.
+ * @param[in,out] *G          points to an instance of the dataflow graph structure.
+ * @param[in]     numPeriods  number of periods.
+ * @return none.
+ *
+ * \par
+ * Each period calls every node the number of times of its entry in the repetition vector, in the order
+ * computed by riscv_sdf_init().  A partitioned graph runs its stages one after the other, with the same
+ * results as riscv_sdf_run_par().
+ */
+
+void riscv_sdf_run(
+  riscv_sdf_instance * G,
+  uint32_t numPeriods)
+{
+  RISCV_PROFILE(riscv_sdf_run);
+  uint32_t period, stage;
+
+  for (period = 0u; period < numPeriods; period++)
+  {
+    for (stage = 0u; stage < G->numStages; stage++)
+    {
+      riscv_sdf_stage(G, stage, period);
+    }
+  }
+}
+
+/**
+ * @brief  Runs periods of a synchronous dataflow graph as a pipeline, one stage per core.
+ * @param[in]     *P          points to the parallel execution context, at least <code>numStages</code> cores.
+ * @param[in,out] *G          points to an instance of the dataflow graph structure.
+ * @param[in]     numPeriods  number of periods.
+ * @return        RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the context has less cores than stages.
+ *
+ * \par
+ * The call forks <code>numPeriods+numStages-1</code> times; in step <code>t</code> core <code>s</code>
+ * runs stage <code>s</code> on period <code>t-s</code>, and the join of the fork is the only
+ * synchronization.  The pipeline fills and drains within the call, so a node sees the same periods in
+ * the same order as with riscv_sdf_run(), but nodes of different stages run at the same time and must
+ * not share state.  Cores beyond <code>numStages</code> stay idle.
+ */
+
+riscv_status riscv_sdf_run_par(
+  const riscv_par_instance * P,
+  riscv_sdf_instance * G,
+  uint32_t numPeriods)
+{
+  RISCV_PROFILE(riscv_sdf_run_par);
+  riscv_sdf_par_args args;
+
+  if(P->numCores < G->numStages)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  args.G = G;
+  args.numPeriods = numPeriods;
+
+  for (args.step = 0u; args.step < (numPeriods + G->numStages - 1u); args.step++)
+  {
+    P->fork(P->numCores, riscv_sdf_par_worker, &args);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SDF group
+ */
@@ -0,0 +1,234 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sort_f32.c
+*
+* Description:  Sorts a floating-point vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Sorting Vector Sorting and Top-k
+ *
+ * The sort functions write the <code>blockSize</code> samples of <code>pSrc</code> to
+ * <code>pDst</code> in ascending (RISCV_SORT_ASCENDING) or descending (RISCV_SORT_DESCENDING) order.
+ * When <code>pIndex</code> is not NULL, <code>pIndex[n]</code> receives the position in <code>pSrc</code>
+ * of <code>pDst[n]</code>.  The indices are 16 bits wide, so <code>blockSize</code> is at most 65536 when
+ * they are requested.
+ * \par
+ * Every type uses the algorithm that suits its range, with the comparisons written out for the type
+ * instead of going through a comparison callback:
+ * - riscv_sort_f32() runs a quicksort on <code>pDst</code> with the median of three samples as pivot.
+ *   It always continues with the smaller part, so the stack of pending parts stays below 32 entries,
+ *   and it finishes parts of up to RISCV_SORT_INSERTION_LENGTH samples with an insertion sort.
+ *   <code>pSrc</code> may be equal to <code>pDst</code>.  The order of equal samples is not kept.
+ *   The input must not contain NaN.
+ * - riscv_sort_q15() is a radix sort with two passes over the low and the high byte, which costs
+ *   <code>O(blockSize)</code> instead of <code>O(blockSize*log(blockSize))</code>.  The first pass
+ *   writes to <code>pScratch</code>, <code>blockSize</code> words that hold a sample and its index.
+ * - riscv_sort_q7() is a counting sort over the 256 values with one pass to count and one to write.
+ * - The radix and counting sorts are stable, equal samples keep the order of <code>pSrc</code>, and
+ *   <code>pSrc</code> must not overlap <code>pDst</code>.  Blocks of up to RISCV_SORT_INSERTION_LENGTH
+ *   samples use an insertion sort, which is faster than clearing the 256 counters.
+ *
+ * \par
+ * The top-k functions return the <code>k</code> largest samples of a vector in descending order
+ * without sorting the rest.  They keep the largest samples found so far in a min-heap of <code>k</code>
+ * entries in <code>pDst</code>, so a sample that is not larger than the root costs one comparison and
+ * the others <code>O(log(k))</code>, and finally sort the heap.  Of equal samples the first ones are
+ * kept.  <code>k</code> values above <code>blockSize</code> are reduced to <code>blockSize</code>.
+ */
+
+/**
+ * @addtogroup Sorting
+ * @{
+ */
+
+/*
+* @brief  Exchanges two samples and their indices.
+*/
+
+static void riscv_sort_swap_f32(
+  float32_t * pData,
+  uint16_t * pIndex,
+  int32_t a,
+  int32_t b)
+{
+  float32_t temp = pData[a];
+  uint16_t tempIndex;
+
+  pData[a] = pData[b];
+  pData[b] = temp;
+
+  if(pIndex != NULL)
+  {
+    tempIndex = pIndex[a];
+    pIndex[a] = pIndex[b];
+    pIndex[b] = tempIndex;
+  }
+}
+
+/*
+* @brief  Sorts pData[lo..hi] in ascending order by insertion.
+*/
+
+static void riscv_sort_insertion_f32(
+  float32_t * pData,
+  uint16_t * pIndex,
+  int32_t lo,
+  int32_t hi)
+{
+  float32_t in;                                  /* Sample to insert */
+  uint16_t inIndex = 0u;                         /* Its index */
+  int32_t i, j;
+
+  for (i = lo + 1; i <= hi; i++)
+  {
+    in = pData[i];
+    if(pIndex != NULL)
+    {
+      inIndex = pIndex[i];
+    }
+
+    for (j = i - 1; (j >= lo) && (pData[j] > in); j--)
+    {
+      pData[j + 1] = pData[j];
+      if(pIndex != NULL)
+      {
+        pIndex[j + 1] = pIndex[j];
+      }
+    }
+
+    pData[j + 1] = in;
+    if(pIndex != NULL)
+    {
+      pIndex[j + 1] = inIndex;
+    }
+  }
+}
+
+/**
+ * @brief Sorts a floating-point vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the sorted output vector, may be equal to <code>pSrc</code>
+ * @param[out]      *pIndex points to the positions in <code>pSrc</code> of the output samples, or NULL
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       dir RISCV_SORT_ASCENDING or RISCV_SORT_DESCENDING
+ * @return none.
+ */
+
+void riscv_sort_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint16_t * pIndex,
+  uint32_t blockSize,
+  riscv_sort_dir dir)
+{
+  RISCV_PROFILE(riscv_sort_f32);
+  int32_t stack[64];                             /* Pending parts, smaller part first */
+  int32_t top = 0;                               /* Number of stack entries */
+  int32_t lo = 0, hi = (int32_t) blockSize - 1;  /* Part being sorted */
+  int32_t i, j, mid;                             /* Partition indices */
+  float32_t pivot;
+  uint32_t n;
+
+  if(pDst != pSrc)
+  {
+    memcpy(pDst, pSrc, blockSize * sizeof(float32_t));
+  }
+
+  if(pIndex != NULL)
+  {
+    for (n = 0u; n < blockSize; n++)
+    {
+      pIndex[n] = (uint16_t) n;
+    }
+  }
+
+  while(blockSize > 1u)
+  {
+    while((hi - lo) >= RISCV_SORT_INSERTION_LENGTH)
+    {
+      /* Order pDst[lo] <= pDst[mid] <= pDst[hi] and take the middle one as pivot */
+      mid = lo + ((hi - lo) >> 1);
+
+      if(pDst[mid] < pDst[lo])
+      {
+        riscv_sort_swap_f32(pDst, pIndex, mid, lo);
+      }
+      if(pDst[hi] < pDst[lo])
+      {
+        riscv_sort_swap_f32(pDst, pIndex, hi, lo);
+      }
+      if(pDst[hi] < pDst[mid])
+      {
+        riscv_sort_swap_f32(pDst, pIndex, hi, mid);
+      }
+
+      pivot = pDst[mid];
+      i = lo;
+      j = hi;
+
+      /* Hoare partition, [lo, j] <= pivot <= [i, hi] */
+      while(i <= j)
+      {
+        while(pDst[i] < pivot)
+        {
+          i++;
+        }
+        while(pDst[j] > pivot)
+        {
+          j--;
+        }
+        if(i <= j)
+        {
+          riscv_sort_swap_f32(pDst, pIndex, i, j);
+          i++;
+          j--;
+        }
+      }
+
+      /* Keep the larger part for later and continue with the smaller one */
+      if((j - lo) < (hi - i))
+      {
+        stack[top++] = i;
+        stack[top++] = hi;
+        hi = j;
+      }
+      else
+      {
+        stack[top++] = lo;
+        stack[top++] = j;
+        lo = i;
+      }
+    }
+
+    riscv_sort_insertion_f32(pDst, pIndex, lo, hi);
+
+    if(top == 0)
+    {
+      break;
+    }
+
+    hi = stack[--top];
+    lo = stack[--top];
+  }
+
+  if(dir == RISCV_SORT_DESCENDING)
+  {
+    for (i = 0, j = (int32_t) blockSize - 1; i < j; i++, j--)
+    {
+      riscv_sort_swap_f32(pDst, pIndex, i, j);
+    }
+  }
+}
+
+/**
+ * @} end of Sorting group
+ */
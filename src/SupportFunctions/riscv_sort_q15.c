@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sort_q15.c
+*
+* Description:  Radix sort of a Q15 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sorting
+ * @{
+ */
+
+/**
+ * @brief Sorts a Q15 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the sorted output vector
+ * @param[out]      *pIndex points to the positions in <code>pSrc</code> of the output samples, or NULL
+ * @param[in]       *pScratch points to a buffer of <code>blockSize</code> words
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       dir RISCV_SORT_ASCENDING or RISCV_SORT_DESCENDING
+ * @return none.
+ *
+ * \par
+ * The samples are sorted as the unsigned keys <code>x ^ 0x8000</code>, or <code>x ^ 0x7FFF</code> in
+ * descending order, so that the unsigned order of the keys is the requested order of the samples.
+ * Every scratch word holds the key in the low half and the position in <code>pSrc</code> in the high half.
+ */
+
+void riscv_sort_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint16_t * pIndex,
+  uint32_t * pScratch,
+  uint32_t blockSize,
+  riscv_sort_dir dir)
+{
+  RISCV_PROFILE(riscv_sort_q15);
+  uint32_t count[256];                           /* Bucket counts, then bucket positions */
+  uint32_t flip = (dir == RISCV_SORT_DESCENDING) ? 0x7FFFu : 0x8000u;  /* Key of a sample is x ^ flip */
+  uint32_t key, word, pos, sum, i, j;
+  q15_t in;
+
+  if(blockSize <= RISCV_SORT_INSERTION_LENGTH)
+  {
+    /* Insertion sort on the keys, which keeps equal samples in order */
+    for (i = 0u; i < blockSize; i++)
+    {
+      key = (uint16_t) pSrc[i] ^ flip;
+
+      for (j = i; (j > 0u) && ((pScratch[j - 1u] & 0xFFFFu) > key); j--)
+      {
+        pScratch[j] = pScratch[j - 1u];
+      }
+
+      pScratch[j] = key | (i << 16);
+    }
+
+    for (i = 0u; i < blockSize; i++)
+    {
+      word = pScratch[i];
+      pDst[i] = (q15_t) ((word & 0xFFFFu) ^ flip);
+      if(pIndex != NULL)
+      {
+        pIndex[i] = (uint16_t) (word >> 16);
+      }
+    }
+
+    return;
+  }
+
+  /* First pass, stable scatter to pScratch by the low byte of the key */
+  memset(count, 0, sizeof(count));
+  for (i = 0u; i < blockSize; i++)
+  {
+    count[((uint16_t) pSrc[i] ^ flip) & 0xFFu]++;
+  }
+
+  for (i = 0u, sum = 0u; i < 256u; i++)
+  {
+    pos = count[i];
+    count[i] = sum;
+    sum += pos;
+  }
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    key = (uint16_t) pSrc[i] ^ flip;
+    pScratch[count[key & 0xFFu]++] = key | (i << 16);
+  }
+
+  /* Second pass, stable scatter to pDst by the high byte of the key */
+  memset(count, 0, sizeof(count));
+  for (i = 0u; i < blockSize; i++)
+  {
+    count[(pScratch[i] >> 8) & 0xFFu]++;
+  }
+
+  for (i = 0u, sum = 0u; i < 256u; i++)
+  {
+    pos = count[i];
+    count[i] = sum;
+    sum += pos;
+  }
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    word = pScratch[i];
+    pos = count[(word >> 8) & 0xFFu]++;
+    in = (q15_t) ((word & 0xFFFFu) ^ flip);
+    pDst[pos] = in;
+    if(pIndex != NULL)
+    {
+      pIndex[pos] = (uint16_t) (word >> 16);
+    }
+  }
+}
+
+/**
+ * @} end of Sorting group
+ */
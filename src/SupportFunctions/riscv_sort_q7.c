@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sort_q7.c
+*
+* Description:  Counting sort of a Q7 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sorting
+ * @{
+ */
+
+/**
+ * @brief Sorts a Q7 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the sorted output vector
+ * @param[out]      *pIndex points to the positions in <code>pSrc</code> of the output samples, or NULL
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       dir RISCV_SORT_ASCENDING or RISCV_SORT_DESCENDING
+ * @return none.
+ *
+ * \par
+ * Without <code>pIndex</code> the output is written as runs of equal values straight from the counts.
+ */
+
+void riscv_sort_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint16_t * pIndex,
+  uint32_t blockSize,
+  riscv_sort_dir dir)
+{
+  RISCV_PROFILE(riscv_sort_q7);
+  uint32_t count[256];                           /* Value counts, then positions */
+  uint32_t flip = (dir == RISCV_SORT_DESCENDING) ? 0x7Fu : 0x80u;  /* Key of a sample is x ^ flip */
+  uint32_t key, pos, sum, i, j;
+  q7_t in;
+
+  if(blockSize <= RISCV_SORT_INSERTION_LENGTH)
+  {
+    for (i = 0u; i < blockSize; i++)
+    {
+      in = pSrc[i];
+      key = (uint8_t) in ^ flip;
+
+      for (j = i; (j > 0u) && (((uint8_t) pDst[j - 1u] ^ flip) > key); j--)
+      {
+        pDst[j] = pDst[j - 1u];
+        if(pIndex != NULL)
+        {
+          pIndex[j] = pIndex[j - 1u];
+        }
+      }
+
+      pDst[j] = in;
+      if(pIndex != NULL)
+      {
+        pIndex[j] = (uint16_t) i;
+      }
+    }
+
+    return;
+  }
+
+  memset(count, 0, sizeof(count));
+  for (i = 0u; i < blockSize; i++)
+  {
+    count[(uint8_t) pSrc[i] ^ flip]++;
+  }
+
+  if(pIndex == NULL)
+  {
+    for (key = 0u; key < 256u; key++)
+    {
+      in = (q7_t) (key ^ flip);
+
+      for (j = count[key]; j > 0u; j--)
+      {
+        *pDst++ = in;
+      }
+    }
+
+    return;
+  }
+
+  for (i = 0u, sum = 0u; i < 256u; i++)
+  {
+    pos = count[i];
+    count[i] = sum;
+    sum += pos;
+  }
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    in = pSrc[i];
+    pos = count[(uint8_t) in ^ flip]++;
+    pDst[pos] = in;
+    pIndex[pos] = (uint16_t) i;
+  }
+}
+
+/**
+ * @} end of Sorting group
+ */
@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_stream_process.c
+*
+* Description:  Double-buffered processing of a vector in L2 through
+*               tiles in L1.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Streaming
+ * @{
+ */
+
+/**
+ * @brief  Processes a vector in L2 tile by tile in L1.
+ * @param[in]  *D         points to the DMA hook.
+ * @param[in]  func       function processing one tile, called with <code>arg</code>, the input and output tile and the number of elements.
+ * @param[in]  *arg       argument of <code>func</code>.
+ * @param[in]  *pSrc      points to the input vector of <code>length</code> elements.
+ * @param[out] *pDst      points to the output vector of <code>length</code> elements, may be <code>pSrc</code>.
+ * @param[in]  length     number of elements.
+ * @param[in]  elemSize   size of an element in bytes.
+ * @param[in]  tileSize   number of elements of a tile, the last tile may be shorter.
+ * @param[in]  *pL1       points to RISCV_STREAM_L1_SIZE(tileSize, elemSize) bytes in L1 for the four tiles.
+ * @return none.
+ *
+ * \par
+ * The tiles are processed in order, so <code>func</code> may keep a state from one tile to the next,
+ * as the filters do.  The input tiles start at <code>pL1</code> and <code>pL1+tileSize*elemSize</code>,
+ * followed by the two output tiles.
+ */
+
+void riscv_stream_process(
+  const riscv_dma_instance * D,
+  riscv_stream_func func,
+  void * arg,
+  const void * pSrc,
+  void * pDst,
+  uint32_t length,
+  uint32_t elemSize,
+  uint32_t tileSize,
+  void * pL1)
+{
+  RISCV_PROFILE(riscv_stream_process);
+  const uint8_t *pIn = (const uint8_t *) pSrc;
+  uint8_t *pOut = (uint8_t *) pDst;
+  uint8_t *pTileIn[2], *pTileOut[2];             /* Tiles in L1 */
+  uint32_t idIn[2], idOut[2] = {0u, 0u};         /* Transfer identifiers */
+  uint32_t tileBytes = tileSize * elemSize;
+  uint32_t numTiles = (length + tileSize - 1u) / tileSize;
+  uint32_t t, b, n;
+
+  if(numTiles == 0u)
+  {
+    return;
+  }
+
+  pTileIn[0] = (uint8_t *) pL1;
+  pTileIn[1] = pTileIn[0] + tileBytes;
+  pTileOut[0] = pTileIn[1] + tileBytes;
+  pTileOut[1] = pTileOut[0] + tileBytes;
+
+  n = (length < tileSize) ? length : tileSize;
+  idIn[0] = D->start(D->ctx, pTileIn[0], pIn, n * elemSize, 1u, 0u, 0u);
+
+  for (t = 0u; t < numTiles; t++)
+  {
+    b = t & 1u;
+    n = ((length - (t * tileSize)) < tileSize) ? (length - (t * tileSize)) : tileSize;
+
+    D->wait(D->ctx, idIn[b]);
+
+    /* Fetch the next tile while this one is processed */
+    if((t + 1u) < numTiles)
+    {
+      uint32_t next = length - ((t + 1u) * tileSize);
+
+      next = (next < tileSize) ? next : tileSize;
+      idIn[b ^ 1u] = D->start(D->ctx, pTileIn[b ^ 1u], pIn + ((t + 1u) * tileBytes), next * elemSize, 1u, 0u, 0u);
+    }
+
+    /* The output tile of t-2 must have left L1 */
+    if(t >= 2u)
+    {
+      D->wait(D->ctx, idOut[b]);
+    }
+
+    func(arg, pTileIn[b], pTileOut[b], n);
+
+    idOut[b] = D->start(D->ctx, pOut + (t * tileBytes), pTileOut[b], n * elemSize, 1u, 0u, 0u);
+  }
+
+  /* The last transfer was started after all the others */
+  D->wait(D->ctx, idOut[(numTiles - 1u) & 1u]);
+}
+
+/**
+ * @} end of Streaming group
+ */
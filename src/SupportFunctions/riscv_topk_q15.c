@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_topk_q15.c
+*
+* Description:  Largest k samples of a Q15 vector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sorting
+ * @{
+ */
+
+/*
+* @brief  Moves the sample at pos down the min-heap pData[0..len-1] to its place.
+*/
+
+static void riscv_topk_sift_q15(
+  q15_t * pData,
+  uint16_t * pIndex,
+  uint32_t pos,
+  uint32_t len)
+{
+  q15_t in = pData[pos];                         /* Sample that moves down */
+  uint16_t inIndex = (pIndex != NULL) ? pIndex[pos] : 0u;
+  uint32_t child;
+
+  while((child = (2u * pos) + 1u) < len)
+  {
+    /* Select the smaller child */
+    if(((child + 1u) < len) && (pData[child + 1u] < pData[child]))
+    {
+      child++;
+    }
+
+    if(pData[child] >= in)
+    {
+      break;
+    }
+
+    pData[pos] = pData[child];
+    if(pIndex != NULL)
+    {
+      pIndex[pos] = pIndex[child];
+    }
+
+    pos = child;
+  }
+
+  pData[pos] = in;
+  if(pIndex != NULL)
+  {
+    pIndex[pos] = inIndex;
+  }
+}
+
+/**
+ * @brief Largest k samples of a Q15 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       k number of samples to return
+ * @param[out]      *pDst points to the <code>k</code> largest samples, in descending order
+ * @param[out]      *pIndex points to the positions in <code>pSrc</code> of the output samples, or NULL
+ * @return none.
+ */
+
+void riscv_topk_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pDst,
+  uint16_t * pIndex)
+{
+  RISCV_PROFILE(riscv_topk_q15);
+  q15_t in, temp;                                /* Input sample and heap root */
+  uint16_t tempIndex;
+  uint32_t i;                                    /* loop counter */
+
+  if(k > blockSize)
+  {
+    k = blockSize;
+  }
+
+  if(k == 0u)
+  {
+    return;
+  }
+
+  /* Build the min-heap of the first k samples */
+  for (i = 0u; i < k; i++)
+  {
+    pDst[i] = pSrc[i];
+    if(pIndex != NULL)
+    {
+      pIndex[i] = (uint16_t) i;
+    }
+  }
+
+  for (i = k >> 1u; i > 0u; i--)
+  {
+    riscv_topk_sift_q15(pDst, pIndex, i - 1u, k);
+  }
+
+  /* A sample larger than the smallest kept one replaces it */
+  for (i = k; i < blockSize; i++)
+  {
+    in = pSrc[i];
+
+    if(in > pDst[0])
+    {
+      pDst[0] = in;
+      if(pIndex != NULL)
+      {
+        pIndex[0] = (uint16_t) i;
+      }
+
+      riscv_topk_sift_q15(pDst, pIndex, 0u, k);
+    }
+  }
+
+  /* Moving the root to the end of the shrinking heap orders pDst from the largest to the smallest */
+  for (i = k - 1u; i > 0u; i--)
+  {
+    temp = pDst[0];
+    pDst[0] = pDst[i];
+    pDst[i] = temp;
+
+    if(pIndex != NULL)
+    {
+      tempIndex = pIndex[0];
+      pIndex[0] = pIndex[i];
+      pIndex[i] = tempIndex;
+    }
+
+    riscv_topk_sift_q15(pDst, pIndex, 0u, i);
+  }
+}
+
+/**
+ * @} end of Sorting group
+ */
@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_viterbi_acs_q15.c
+*
+* Description:  Add-compare-select steps of the Q15 Viterbi decoder.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Viterbi
+ * @{
+ */
+
+/**
+ * @brief Add-compare-select steps of the Q15 Viterbi decoder.
+ * @param[in,out]  *S points to an instance of the Q15 Viterbi decoder.
+ * @param[in]      *pSrc points to <code>2*numSteps</code> soft bits, two per step.
+ * @param[in]      numSteps number of steps.
+ * @return RISCV_MATH_LENGTH_ERROR if the decisions buffer cannot hold <code>numSteps</code> more steps,
+ * otherwise RISCV_MATH_SUCCESS.
+ *
+ * \par
+ * The soft bits are used with 8 bits, their high byte.
+ */
+
+riscv_status riscv_viterbi_acs_q15(
+  riscv_viterbi_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t numSteps)
+{
+  RISCV_PROFILE(riscv_viterbi_acs_q15);
+  uint32_t numStates = S->numStates;             /* Number of states */
+  uint32_t half = numStates >> 1u;               /* Number of butterflies */
+  uint32_t words = RISCV_VITERBI_DECISION_WORDS(S->constraintLen);
+  const uint16_t *pIndex = (const uint16_t *) S->branch;
+  const q15_t *pOld;                             /* Path metrics of the previous step */
+  q15_t *pNew;                                   /* Path metrics of the step */
+  uint32_t *pDec;                                /* Survivor bits of the step */
+  uint32_t dec[2];
+  uint32_t step, j;                              /* Loop counters */
+  q31_t y0, y1;                                  /* 8-bit soft bits */
+#if defined (USE_DSP_RISCV)
+  shortV bmLo, bmHi, nbmLo, nbmHi;               /* bm and -bm of the indices 0, 1 and 2, 3 */
+  shortV bm2Lo, bm2Hi, nbm2Lo, nbm2Hi;           /* 2bm and -2bm */
+  shortV even = {0, 2};
+  shortV odd = {1, 3};
+  shortV zero = {0, 0};
+  shortV w0, w1, ev, od, idx, diff, mA, mB;
+  uint32_t bits;
+#else
+  q31_t lut[4], bm, ev, od, mA, mB;
+#endif
+
+  if((S->numSteps + numSteps) > S->maxSteps)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  for (step = 0u; step < numSteps; step++)
+  {
+    pOld = S->pMetrics + (((S->numSteps & 1u) != 0u) ? numStates : 0u);
+    pNew = S->pMetrics + (((S->numSteps & 1u) != 0u) ? 0u : numStates);
+    pDec = S->pDecisions + (S->numSteps * words);
+    y0 = pSrc[0] >> 8;
+    y1 = pSrc[1] >> 8;
+    pSrc += 2;
+    dec[0] = 0u;
+    dec[1] = 0u;
+
+#if defined (USE_DSP_RISCV)
+
+    /* index bit 0 inverts y0, bit 1 inverts y1 */
+    bmLo = pack2(y0 + y1, y1 - y0);
+    bmHi = pack2(y0 - y1, -y0 - y1);
+    nbmLo = neg2(bmLo);
+    nbmHi = neg2(bmHi);
+    bm2Lo = add2v(bmLo, bmLo);
+    bm2Hi = add2v(bmHi, bmHi);
+    nbm2Lo = neg2(bm2Lo);
+    nbm2Hi = neg2(bm2Hi);
+
+    for (j = 0u; j < half; j += 2u)
+    {
+      /* states 2j and 2j+1 of two butterflies */
+      w0 = *(shortV *) (pOld + (2u * j));
+      w1 = *(shortV *) (pOld + (2u * j) + 2u);
+      ev = shufflev4(w0, w1, even);
+      od = shufflev4(w0, w1, odd);
+      idx = *(shortV *) (pIndex + j);
+
+      /* the odd candidate minus the even one, modulo 2^16 */
+      diff = sub2(od, ev);
+      mA = max2(add2v(diff, shufflev4(nbm2Lo, nbm2Hi, idx)), zero);
+      mB = max2(add2v(diff, shufflev4(bm2Lo, bm2Hi, idx)), zero);
+
+      *(shortV *) (pNew + j) = add2v(add2v(ev, shufflev4(bmLo, bmHi, idx)), mA);
+      *(shortV *) (pNew + half + j) = add2v(add2v(ev, shufflev4(nbmLo, nbmHi, idx)), mB);
+
+      /* sign bits of -mA, one per halfword, gathered in 2 bits by the multiplication */
+      bits = ((((uint32_t) neg2(mA) >> 15) & 0x00010001u) * 0x00010002u) >> 16;
+      dec[j >> 5] |= (bits & 3u) << (j & 31u);
+      bits = ((((uint32_t) neg2(mB) >> 15) & 0x00010001u) * 0x00010002u) >> 16;
+      dec[(half + j) >> 5] |= (bits & 3u) << ((half + j) & 31u);
+    }
+
+#else
+
+    lut[0] = y0 + y1;
+    lut[1] = y1 - y0;
+    lut[2] = y0 - y1;
+    lut[3] = -y0 - y1;
+
+    for (j = 0u; j < half; j++)
+    {
+      bm = lut[pIndex[j]];
+      ev = pOld[2u * j];
+      od = pOld[(2u * j) + 1u];
+
+      /* the odd candidate minus the even one, modulo 2^16 */
+      mA = (q15_t) (od - ev - (2 * bm));
+      mB = (q15_t) (od - ev + (2 * bm));
+      mA = (mA > 0) ? mA : 0;
+      mB = (mB > 0) ? mB : 0;
+
+      pNew[j] = (q15_t) (ev + bm + mA);
+      pNew[half + j] = (q15_t) (ev - bm + mB);
+      dec[j >> 5] |= (uint32_t) (mA > 0) << (j & 31u);
+      dec[(half + j) >> 5] |= (uint32_t) (mB > 0) << ((half + j) & 31u);
+    }
+
+#endif
+
+    for (j = 0u; j < words; j++)
+    {
+      pDec[j] = dec[j];
+    }
+
+    S->numSteps++;
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Viterbi group
+ */
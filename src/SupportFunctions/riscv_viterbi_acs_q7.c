@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_viterbi_acs_q7.c
+*
+* Description:  Add-compare-select steps of the Q7 Viterbi decoder.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Viterbi Viterbi Decoder
+ *
+ * Soft-decision Viterbi decoder of rate 1/2 convolutional codes of constraint length 4 to 7, such as the
+ * K = 7 code with the polynomials 0171 and 0133 (octal) of IEEE 802.11, 802.15.4 and DVB:
+ * <pre>
+ *    riscv_viterbi_init_q7(&S, 7, 0171, 0133, metrics, decisions, maxSteps);
+ *    riscv_viterbi_acs_q7(&S, soft, numSteps);                  two soft bits per step, in one or more calls
+ *    riscv_viterbi_traceback_q7(&S, 0, bits);                   end state 0 after a tail of K-1 zeros
+ * </pre>
+ * The encoder shifts each input bit into bit K-1 of a K-bit register and outputs the parities of the
+ * register masked by the two polynomials.  A soft bit is positive for a 0 and negative for a 1, the BPSK
+ * mapping, and its magnitude is the confidence.
+ * \par
+ * riscv_viterbi_acs_q7() and riscv_viterbi_acs_q15() run the add-compare-select recursion over the
+ * <code>2^(K-1)</code> states by butterflies: states <code>2j</code> and <code>2j+1</code> lead to states
+ * <code>j</code> and <code>j+2^(K-2)</code>, the four branches carry only <code>+bm</code> or
+ * <code>-bm</code>, and <code>bm</code> is one of four sums <code>+-y0 +-y1</code> picked by a table made
+ * by the init function.  Each step writes one survivor bit per state, packed in words, and
+ * riscv_viterbi_traceback_q7() follows them back from the end state to output the decoded bits.
+ * \par
+ * The path metrics are kept modulo 2^8 or 2^16 and compared by their difference, so they never need
+ * to be renormalized: the Q7 decoder uses 3-bit soft decisions, the 3 high bits of each soft bit, and the
+ * Q15 decoder 8-bit ones, which keeps the spread of the metrics within half the range.  With the xpulp
+ * extensions a step processes 4 (Q7) or 2 (Q15) butterflies per instruction: one add4v and one max4
+ * select four new metrics from their two candidates.
+ */
+
+/**
+ * @addtogroup Viterbi
+ * @{
+ */
+
+/**
+ * @brief Add-compare-select steps of the Q7 Viterbi decoder.
+ * @param[in,out]  *S points to an instance of the Q7 Viterbi decoder.
+ * @param[in]      *pSrc points to <code>2*numSteps</code> soft bits, two per step.
+ * @param[in]      numSteps number of steps.
+ * @return RISCV_MATH_LENGTH_ERROR if the decisions buffer cannot hold <code>numSteps</code> more steps,
+ * otherwise RISCV_MATH_SUCCESS.
+ */
+
+riscv_status riscv_viterbi_acs_q7(
+  riscv_viterbi_instance_q7 * S,
+  const q7_t * pSrc,
+  uint32_t numSteps)
+{
+  RISCV_PROFILE(riscv_viterbi_acs_q7);
+  uint32_t numStates = S->numStates;             /* Number of states */
+  uint32_t half = numStates >> 1u;               /* Number of butterflies */
+  uint32_t words = RISCV_VITERBI_DECISION_WORDS(S->constraintLen);
+  const uint8_t *pIndex = (const uint8_t *) S->branch;
+  const q7_t *pOld;                              /* Path metrics of the previous step */
+  q7_t *pNew;                                    /* Path metrics of the step */
+  uint32_t *pDec;                                /* Survivor bits of the step */
+  uint32_t dec[2];
+  uint32_t step, j;                              /* Loop counters */
+  q31_t y0, y1;                                  /* 3-bit soft bits */
+#if defined (USE_DSP_RISCV)
+  charV lutBm, lutNbm, lut2Bm, lut2Nbm;          /* bm, -bm, 2bm and -2bm of the four indices */
+  charV even = {0, 2, 4, 6};
+  charV odd = {1, 3, 5, 7};
+  charV zero = {0, 0, 0, 0};
+  charV w0, w1, ev, od, idx, diff, mA, mB;
+  uint32_t bits;
+#else
+  q31_t lut[4], bm, ev, od, mA, mB;
+#endif
+
+  if((S->numSteps + numSteps) > S->maxSteps)
+  {
+    return (RISCV_MATH_LENGTH_ERROR);
+  }
+
+  for (step = 0u; step < numSteps; step++)
+  {
+    pOld = S->pMetrics + (((S->numSteps & 1u) != 0u) ? numStates : 0u);
+    pNew = S->pMetrics + (((S->numSteps & 1u) != 0u) ? 0u : numStates);
+    pDec = S->pDecisions + (S->numSteps * words);
+    y0 = pSrc[0] >> 5;
+    y1 = pSrc[1] >> 5;
+    pSrc += 2;
+    dec[0] = 0u;
+    dec[1] = 0u;
+
+#if defined (USE_DSP_RISCV)
+
+    /* index bit 0 inverts y0, bit 1 inverts y1 */
+    lutBm = pack4(y0 + y1, y1 - y0, y0 - y1, -y0 - y1);
+    lutNbm = neg4(lutBm);
+    lut2Bm = add4v(lutBm, lutBm);
+    lut2Nbm = neg4(lut2Bm);
+
+    for (j = 0u; j < half; j += 4u)
+    {
+      /* states 2j and 2j+1 of four butterflies */
+      w0 = *(charV *) (pOld + (2u * j));
+      w1 = *(charV *) (pOld + (2u * j) + 4u);
+      ev = shuffle2b(w0, w1, even);
+      od = shuffle2b(w0, w1, odd);
+      idx = *(charV *) (pIndex + j);
+
+      /* the odd candidate minus the even one, modulo 2^8 */
+      diff = add4v(od, neg4(ev));
+      mA = max4(add4v(diff, shuffleb(lut2Nbm, idx)), zero);
+      mB = max4(add4v(diff, shuffleb(lut2Bm, idx)), zero);
+
+      *(charV *) (pNew + j) = add4v(add4v(ev, shuffleb(lutBm, idx)), mA);
+      *(charV *) (pNew + half + j) = add4v(add4v(ev, shuffleb(lutNbm, idx)), mB);
+
+      /* sign bits of -mA, one per byte, gathered in 4 bits by the multiplication */
+      bits = ((((uint32_t) neg4(mA) >> 7) & 0x01010101u) * 0x01020408u) >> 24;
+      dec[j >> 5] |= bits << (j & 31u);
+      bits = ((((uint32_t) neg4(mB) >> 7) & 0x01010101u) * 0x01020408u) >> 24;
+      dec[(half + j) >> 5] |= bits << ((half + j) & 31u);
+    }
+
+#else
+
+    lut[0] = y0 + y1;
+    lut[1] = y1 - y0;
+    lut[2] = y0 - y1;
+    lut[3] = -y0 - y1;
+
+    for (j = 0u; j < half; j++)
+    {
+      bm = lut[pIndex[j]];
+      ev = pOld[2u * j];
+      od = pOld[(2u * j) + 1u];
+
+      /* the odd candidate minus the even one, modulo 2^8 */
+      mA = (q7_t) (od - ev - (2 * bm));
+      mB = (q7_t) (od - ev + (2 * bm));
+      mA = (mA > 0) ? mA : 0;
+      mB = (mB > 0) ? mB : 0;
+
+      pNew[j] = (q7_t) (ev + bm + mA);
+      pNew[half + j] = (q7_t) (ev - bm + mB);
+      dec[j >> 5] |= (uint32_t) (mA > 0) << (j & 31u);
+      dec[(half + j) >> 5] |= (uint32_t) (mB > 0) << ((half + j) & 31u);
+    }
+
+#endif
+
+    for (j = 0u; j < words; j++)
+    {
+      pDec[j] = dec[j];
+    }
+
+    S->numSteps++;
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Viterbi group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_viterbi_init_q7.c
+*
+* Description:  Initialization function of the Q7 Viterbi decoder.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Viterbi
+ * @{
+ */
+
+/**
+ * @brief Initialization function of the Q7 Viterbi decoder.
+ * @param[out]  *S points to an instance of the Q7 Viterbi decoder.
+ * @param[in]   constraintLen constraint length K of the code, 4 to 7.
+ * @param[in]   poly0 generator polynomial of the first code bit, bit K-1 for the newest input bit.
+ * @param[in]   poly1 generator polynomial of the second code bit.
+ * @param[in]   *pMetrics points to a buffer of <code>2*2^(K-1)</code> path metrics.
+ * @param[in]   *pDecisions points to a buffer of <code>maxSteps*RISCV_VITERBI_DECISION_WORDS(K)</code> words.
+ * @param[in]   maxSteps number of code bit pairs the decisions buffer holds.
+ * @return RISCV_MATH_ARGUMENT_ERROR if K is out of range or a polynomial does not use both the newest
+ * and the oldest bit, otherwise RISCV_MATH_SUCCESS.
+ *
+ * \par
+ * The encoder starts in state 0: the path metrics of the other states start 32 below.  Call the
+ * function again to decode a new frame.
+ */
+
+riscv_status riscv_viterbi_init_q7(
+  riscv_viterbi_instance_q7 * S,
+  uint8_t constraintLen,
+  uint32_t poly0,
+  uint32_t poly1,
+  q7_t * pMetrics,
+  uint32_t * pDecisions,
+  uint32_t maxSteps)
+{
+  RISCV_PROFILE(riscv_viterbi_init_q7);
+  uint32_t numStates, ends;
+  uint8_t *pIndex = (uint8_t *) S->branch;       /* one index per butterfly */
+  uint32_t j, r0, r1;
+
+  if((constraintLen < RISCV_VITERBI_MIN_K) || (constraintLen > RISCV_VITERBI_MAX_K))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  numStates = 1u << (constraintLen - 1u);
+  ends = 1u | numStates;                         /* oldest and newest bit of the register */
+
+  if(((poly0 & ends) != ends) || ((poly1 & ends) != ends))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->constraintLen = constraintLen;
+  S->numStates = (uint16_t) numStates;
+  S->pMetrics = pMetrics;
+  S->pDecisions = pDecisions;
+  S->maxSteps = maxSteps;
+  S->numSteps = 0u;
+
+  /* expected code bits of the branch of butterfly j from state 2j with input 0 */
+  for (j = 0u; j < (numStates >> 1u); j++)
+  {
+    r0 = __builtin_popcount((2u * j) & poly0) & 1u;
+    r1 = __builtin_popcount((2u * j) & poly1) & 1u;
+    pIndex[j] = (uint8_t) (r0 | (r1 << 1u));
+  }
+
+  for (j = 0u; j < numStates; j++)
+  {
+    pMetrics[j] = (j == 0u) ? 0 : -32;
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Viterbi group
+ */
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_viterbi_traceback_q7.c
+*
+* Description:  Traceback of the Q7 Viterbi decoder.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Viterbi
+ * @{
+ */
+
+/**
+ * @brief Traceback of the Q7 Viterbi decoder.
+ * @param[in]   *S points to an instance of the Q7 Viterbi decoder.
+ * @param[in]   endState state of the encoder after the last step, or -1 for the state of the best metric.
+ * @param[out]  *pDst points to <code>(numSteps+7)/8</code> bytes for the decoded bits, first bit in the MSB.
+ * @return RISCV_MATH_ARGUMENT_ERROR if <code>endState</code> is not a state, otherwise RISCV_MATH_SUCCESS.
+ *
+ * \par
+ * One bit is decoded per step since the last riscv_viterbi_init_q7(), the tail bits included.  A frame
+ * terminated by K-1 zero bits ends in state 0; -1 suits a frame without tail.
+ */
+
+riscv_status riscv_viterbi_traceback_q7(
+  const riscv_viterbi_instance_q7 * S,
+  int32_t endState,
+  uint8_t * pDst)
+{
+  RISCV_PROFILE(riscv_viterbi_traceback_q7);
+  uint32_t numStates = S->numStates;             /* Number of states */
+  uint32_t words = RISCV_VITERBI_DECISION_WORDS(S->constraintLen);
+  uint32_t msb = S->constraintLen - 2u;          /* Position of the newest input bit in a state */
+  const q7_t *pMetrics = S->pMetrics + (((S->numSteps & 1u) != 0u) ? numStates : 0u);
+  uint32_t state, d, t;
+
+  if(endState >= (int32_t) numStates)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  if(endState < 0)
+  {
+    /* largest metric, compared modulo 2^8 */
+    state = 0u;
+    for (t = 1u; t < numStates; t++)
+    {
+      if((q7_t) (pMetrics[t] - pMetrics[state]) > 0)
+      {
+        state = t;
+      }
+    }
+  }
+  else
+  {
+    state = (uint32_t) endState;
+  }
+
+  memset(pDst, 0, (S->numSteps + 7u) >> 3u);
+
+  for (t = S->numSteps; t > 0u; t--)
+  {
+    /* the newest bit of the state is the input of step t-1, the survivor bit the oldest of the previous state */
+    d = (S->pDecisions[((t - 1u) * words) + (state >> 5u)] >> (state & 31u)) & 1u;
+    pDst[(t - 1u) >> 3u] |= (uint8_t) ((state >> msb) << (7u - ((t - 1u) & 7u)));
+    state = ((state << 1u) | d) & (numStates - 1u);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Viterbi group
+ */
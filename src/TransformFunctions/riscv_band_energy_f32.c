@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_band_energy_f32.c
+*
+* Description:  Floating-point band energies of a real FFT spectrum.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup BandEnergy Band Energies of a Real Spectrum
+ *
+ * \par
+ * Voice activity detectors, noise suppressors and level meters reduce the spectrum of a frame to the
+ * energies of a few bands.  These functions take the output of the real FFT and sum
+ * <code>re^2 + im^2</code> over the bins of each band in one pass, without a magnitude buffer:
+ * <pre>
+ *     pDst[b] = sum |X[k]|^2,  pBandEdges[b] <= k < pBandEdges[b+1]
+ * </pre>
+ * \par
+ * <code>pBandEdges</code> holds <code>numBands+1</code> non-decreasing bin indices from 0 to
+ * <code>fftLen/2+1</code>, bin <code>fftLen/2</code> is the Nyquist bin.  Each bin counts once, the
+ * energy of the negative frequencies is not added.  The frame energy is the single band {0, fftLen/2+1}.
+ * \par
+ * riscv_band_energy_f32() reads the packed spectrum of riscv_rfft_fast_f32(), with the real values of DC
+ * and Nyquist in its first two words.  riscv_band_energy_q15() reads the interleaved spectrum of
+ * riscv_rfft_q15(), whose bin k is at <code>pSpec[2k]</code> and <code>pSpec[2k+1]</code>.  With the DSP
+ * extension the Q15 version takes each squared magnitude with one <code>dotp2</code>, <code>pSpec</code>
+ * must then be 4-byte aligned.
+ */
+
+/**
+ * @addtogroup BandEnergy
+ * @{
+ */
+
+/**
+ * @brief  Band energies of the spectrum of riscv_rfft_fast_f32().
+ * @param[in]  *pSpec       points to the packed spectrum of <code>fftLen</code> values.
+ * @param[in]  fftLen       length of the real FFT.
+ * @param[in]  *pBandEdges  points to the <code>numBands+1</code> band edges in bins.
+ * @param[in]  numBands     number of bands.
+ * @param[out] *pDst        points to the <code>numBands</code> energies.
+ * @return none.
+ */
+
+void riscv_band_energy_f32(
+  const float32_t * pSpec,
+  uint32_t fftLen,
+  const uint16_t * pBandEdges,
+  uint16_t numBands,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_band_energy_f32);
+  const float32_t *pIn;                          /* Bin pointer */
+  float32_t acc0, acc1;                          /* Accumulators of the even and odd bins */
+  float32_t re, im;                              /* Bin */
+  uint32_t nyq = fftLen >> 1u;                   /* Nyquist bin */
+  uint32_t first, last, binCnt;                  /* Bins of the band */
+  uint32_t band;                                 /* Loop counter */
+
+  for (band = 0u; band < numBands; band++)
+  {
+    first = pBandEdges[band];
+    last = pBandEdges[band + 1u];
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+
+    /* DC and Nyquist are packed in the first bin */
+    if((first == 0u) && (last > 0u))
+    {
+      acc0 = pSpec[0] * pSpec[0];
+      first = 1u;
+    }
+
+    if(last > nyq)
+    {
+      acc1 = pSpec[1] * pSpec[1];
+      last = nyq;
+    }
+
+    pIn = pSpec + (2u * first);
+    binCnt = (last > first) ? last - first : 0u;
+
+    /* Two bins per loop on independent accumulators */
+    while(binCnt > 1u)
+    {
+      re = pIn[0];
+      im = pIn[1];
+      acc0 += (re * re) + (im * im);
+
+      re = pIn[2];
+      im = pIn[3];
+      acc1 += (re * re) + (im * im);
+
+      pIn += 4u;
+      binCnt -= 2u;
+    }
+
+    if(binCnt > 0u)
+    {
+      re = pIn[0];
+      im = pIn[1];
+      acc0 += (re * re) + (im * im);
+    }
+
+    *pDst++ = acc0 + acc1;
+  }
+}
+
+/**
+ * @} end of BandEnergy group
+ */
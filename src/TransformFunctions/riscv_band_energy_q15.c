@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_band_energy_q15.c
+*
+* Description:  Q15 band energies of a real FFT spectrum.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup BandEnergy
+ * @{
+ */
+
+/**
+ * @brief  Band energies of the spectrum of riscv_rfft_q15().
+ * @param[in]  *pSpec       points to the interleaved spectrum, bins 0 to <code>fftLen/2</code>.
+ * @param[in]  fftLen       length of the real FFT.
+ * @param[in]  *pBandEdges  points to the <code>numBands+1</code> band edges in bins.
+ * @param[in]  numBands     number of bands.
+ * @param[out] *pDst        points to the <code>numBands</code> energies in 34.30 format.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The squares of the Q15 values are summed without loss in 64 bits, as in riscv_power_q15().
+ * The format of the spectrum, and so the scale of the energies, depends on <code>fftLen</code>,
+ * see riscv_rfft_q15().
+ */
+
+void riscv_band_energy_q15(
+  const q15_t * pSpec,
+  uint32_t fftLen,
+  const uint16_t * pBandEdges,
+  uint16_t numBands,
+  q63_t * pDst)
+{
+  RISCV_PROFILE(riscv_band_energy_q15);
+  const q15_t *pIn;                              /* Bin pointer */
+  q63_t acc;                                     /* Accumulator in 34.30 format */
+  uint32_t first, last, binCnt;                  /* Bins of the band */
+  uint32_t band;                                 /* Loop counter */
+  uint32_t nyq = fftLen >> 1u;                   /* Nyquist bin */
+
+#if defined (USE_DSP_RISCV)
+  shortV VectIn1, VectIn2;                       /* Two bins */
+#else
+  q15_t re, im;                                  /* Bin */
+#endif
+
+  for (band = 0u; band < numBands; band++)
+  {
+    first = pBandEdges[band];
+    last = pBandEdges[band + 1u];
+    last = (last > nyq + 1u) ? nyq + 1u : last;
+    binCnt = (last > first) ? last - first : 0u;
+    pIn = pSpec + (2u * first);
+    acc = 0;
+
+#if defined (USE_DSP_RISCV)
+
+    /* re^2 + im^2 of a bin is one dotp2, at most 2^31 as an unsigned value */
+    while(binCnt > 1u)
+    {
+      VectIn1 = *(shortV *) pIn;
+      VectIn2 = *(shortV *) (pIn + 2);
+      acc += (uint32_t) dotpv2(VectIn1, VectIn1);
+      acc += (uint32_t) dotpv2(VectIn2, VectIn2);
+      pIn += 4u;
+      binCnt -= 2u;
+    }
+
+    if(binCnt > 0u)
+    {
+      VectIn1 = *(shortV *) pIn;
+      acc += (uint32_t) dotpv2(VectIn1, VectIn1);
+    }
+
+#else
+
+    while(binCnt > 0u)
+    {
+      re = pIn[0];
+      im = pIn[1];
+      acc += (uint32_t) ((q31_t) re * re) + (uint32_t) ((q31_t) im * im);
+      pIn += 2u;
+      binCnt--;
+    }
+
+#endif
+
+    *pDst++ = acc;
+  }
+}
+
+/**
+ * @} end of BandEnergy group
+ */
@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_bitreversal2.c
+*
+* Description:  C version of riscv_bitreversal_32() and riscv_bitreversal_16()
+*               of riscv_bitreversal2.S, built instead of the assembly
+*               when the library is compiled for a host.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/*
+* @brief  In-place bit reversal function.
+* @param[in, out] *pSrc        points to the in-place buffer of unknown 32-bit data type.
+* @param[in]      bitRevLen    bit reversal table length
+* @param[in]      *pBitRevTab  points to bit reversal table.
+* @return none.
+*
+* The table holds pairs of byte offsets of complex values of two words, as read by the assembly.
+*/
+
+void riscv_bitreversal_32(
+  uint32_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTab)
+{
+  uint32_t a, b, i, tmp;
+
+  for (i = 0u; i < bitRevLen; i += 2u)
+  {
+    a = pBitRevTab[i] >> 2u;
+    b = pBitRevTab[i + 1u] >> 2u;
+
+    tmp = pSrc[a];
+    pSrc[a] = pSrc[b];
+    pSrc[b] = tmp;
+
+    tmp = pSrc[a + 1u];
+    pSrc[a + 1u] = pSrc[b + 1u];
+    pSrc[b + 1u] = tmp;
+  }
+}
+
+/*
+* @brief  In-place bit reversal function.
+* @param[in, out] *pSrc        points to the in-place buffer of unknown 16-bit data type.
+* @param[in]      bitRevLen    bit reversal table length
+* @param[in]      *pBitRevTab  points to bit reversal table.
+* @return none.
+*
+* The offsets of the table are halved, a complex value is one word.
+*/
+
+void riscv_bitreversal_16(
+  uint16_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTab)
+{
+  uint32_t *pWord = (uint32_t *) pSrc;
+  uint32_t a, b, i, tmp;
+
+  for (i = 0u; i < bitRevLen; i += 2u)
+  {
+    a = pBitRevTab[i] >> 3u;
+    b = pBitRevTab[i + 1u] >> 3u;
+
+    tmp = pWord[a];
+    pWord[a] = pWord[b];
+    pWord[b] = tmp;
+  }
+}
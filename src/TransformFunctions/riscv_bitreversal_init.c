@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_bitreversal_init.c
+*
+* Description:  Runtime generation of the bit reversal tables used by
+*               riscv_bitreversal_32() and riscv_bitreversal_16().
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/*
+* A table is a list of swaps that are applied in order, every swap is a
+* pair of byte offsets (index * 8) of two complex samples.  When position n
+* of the output has to receive the sample at position perm(n), every cycle
+* n -> perm(n) -> perm(perm(n)) -> ... -> n of length L is written as the
+* L-1 swaps (n, perm(n)), (perm(n), perm(perm(n))), and so on.  A cycle is
+* only written from its smallest position, which avoids a visited array.
+*/
+
+/*
+* @brief  Output permutation of riscv_cfft_f32().
+* @param[in]  n      position in natural order.
+* @param[in]  fftLen length of the FFT.
+* @return     position that holds bin n before the bit reversal.
+*
+* The radix8by2 (K = 2) and radix8by4 (K = 4) first stages leave K columns
+* of length M = fftLen/K, each of them a radix-8 FFT in digit reversed
+* order.  Butterfly m of the last stage of column c returns bin
+* K*(k*M/8 + digitrev8(m)) + c in output k.
+*/
+
+static uint32_t riscv_bitreversal_perm_f32(
+  uint32_t n,
+  uint32_t fftLen)
+{
+  uint32_t K, M, c, q, k, r, m, d;
+
+  /*  fftLen = 16, 128, 1024 use radix8by2, 32, 256, 2048 use radix8by4 */
+  if((fftLen & 0x0490u) != 0u)
+  {
+    K = 2u;
+  }
+  else if((fftLen & 0x0920u) != 0u)
+  {
+    K = 4u;
+  }
+  else
+  {
+    K = 1u;
+  }
+
+  M = fftLen / K;
+  c = n % K;
+  q = n / K;
+  k = q / (M / 8u);
+  r = q % (M / 8u);
+
+  /*  Reverse the radix-8 digits of r */
+  m = 0u;
+  for (d = 1u; d < (M / 8u); d <<= 3u)
+  {
+    m = (m << 3u) | (r & 7u);
+    r >>= 3u;
+  }
+
+  return ((c * M) + (8u * m) + k);
+}
+
+/*
+* @brief  Output permutation of riscv_cfft_q31() and riscv_cfft_q15().
+* @param[in]  n      position in natural order.
+* @param[in]  fftLen length of the FFT.
+* @return     position that holds bin n before the bit reversal.
+*
+* The radix-4 butterflies return their outputs in bit reversed order, so the
+* whole transform is in plain bit reversed order, radix4by2 lengths included.
+*/
+
+static uint32_t riscv_bitreversal_perm_fixed(
+  uint32_t n,
+  uint32_t fftLen)
+{
+  uint32_t r = 0u, b;
+
+  for (b = 1u; b < fftLen; b <<= 1u)
+  {
+    r = (r << 1u) | (n & 1u);
+    n >>= 1u;
+  }
+
+  return (r);
+}
+
+static uint16_t riscv_bitreversal_init(
+  uint16_t * pBitRevTable,
+  uint16_t fftLen,
+  uint32_t (*perm)(uint32_t n, uint32_t fftLen))
+{
+  uint32_t n, a, b;
+  uint16_t length = 0u;
+
+  for (n = 0u; n < fftLen; n++)
+  {
+    /*  Skip the cycle unless n is its smallest position */
+    a = perm(n, fftLen);
+    while(a > n)
+    {
+      a = perm(a, fftLen);
+    }
+
+    if(a == n)
+    {
+      b = perm(a, fftLen);
+      while(b != n)
+      {
+        pBitRevTable[length++] = (uint16_t) (a * 8u);
+        pBitRevTable[length++] = (uint16_t) (b * 8u);
+        a = b;
+        b = perm(a, fftLen);
+      }
+    }
+  }
+
+  return (length);
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+* @brief  Generates the bit reversal table of the floating-point CFFT.
+* @param[out]    *pBitRevTable points to the table, of the size given by the RISCVBITREVINDEXTABLE_* macros of riscv_common_tables.h.
+* @param[in]     fftLen        length of the FFT, a power of two from 16 to 4096.
+* @return        number of entries (bitRevLength) written to <code>pBitRevTable</code>.
+*
+* The table reorders the output of riscv_cfft_f32() in the same way as riscvBitRevIndexTable<fftLen>,
+* although the swaps may be listed in a different order.
+*/
+
+uint16_t riscv_bitreversal_init_f32(
+  uint16_t * pBitRevTable,
+  uint16_t fftLen)
+{
+  RISCV_PROFILE(riscv_bitreversal_init_f32);
+  return (riscv_bitreversal_init(pBitRevTable, fftLen, riscv_bitreversal_perm_f32));
+}
+
+/**
+* @brief  Generates the bit reversal table of the Q31 and Q15 CFFT.
+* @param[out]    *pBitRevTable points to the table, of the size given by the RISCVBITREVINDEXTABLE_FIXED_* macros of riscv_common_tables.h.
+* @param[in]     fftLen        length of the FFT, a power of two from 16 to 4096.
+* @return        number of entries (bitRevLength) written to <code>pBitRevTable</code>.
+*/
+
+uint16_t riscv_bitreversal_init_fixed(
+  uint16_t * pBitRevTable,
+  uint16_t fftLen)
+{
+  RISCV_PROFILE(riscv_bitreversal_init_fixed);
+  return (riscv_bitreversal_init(pBitRevTable, fftLen, riscv_bitreversal_perm_fixed));
+}
+
+/**
+* @} end of ComplexFFT group
+*/
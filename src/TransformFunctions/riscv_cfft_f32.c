@@ -47,7 +47,37 @@ extern void riscv_radix8_butterfly_f32(
     float32_t * pSrc,
     uint16_t fftLen,
     const float32_t * pCoef,
-    uint16_t twidCoefModifier);
+    uint16_t twidCoefModifier,
+    uint32_t mode,
+    float32_t scale);
+
+extern void riscv_radix8_butterfly_ordered_f32(
+    float32_t * pSrc,
+    float32_t * pDst,
+    uint16_t fftLen,
+    const float32_t * pCoef,
+    uint16_t twidCoefModifier,
+    uint16_t dstStride,
+    uint32_t mode,
+    float32_t scale);
+
+extern void riscv_radix8_butterfly_oop_f32(
+    const float32_t * pIn,
+    float32_t * pSrc,
+    uint16_t fftLen,
+    const float32_t * pCoef,
+    uint16_t twidCoefModifier,
+    uint32_t mode,
+    float32_t scale);
+
+extern void riscv_radix8_butterfly_batch_f32(
+    float32_t * pSrc,
+    uint16_t fftLen,
+    const float32_t * pCoef,
+    uint16_t twidCoefModifier,
+    uint16_t numBlocks,
+    uint32_t mode,
+    float32_t scale);
 
 extern void riscv_bitreversal_32(
     uint32_t * pSrc,
@@ -102,6 +132,13 @@ extern void riscv_bitreversal_32(
 * calculation.  The same data structure can be reused for multiple transforms
 * including mixing forward and inverse transforms.
 * \par
+* The inverse transform runs the forward butterflies with the real and imaginary parts
+* swapped: the first stage reads (imag, real) pairs, which turns every twiddle factor into
+* its conjugate, and the last stage writes the pairs back in (real, imag) order.  The
+* 1/fftLen scaling is folded into the first stage, so the inverse takes no pass over the
+* data beyond those of the forward transform.  <code>ifftFlag = RISCV_FFT_INVERSE_NOSCALE</code>
+* skips the scaling, for overlap-add or other processing that folds it into a window or gain.
+* \par
 * Earlier releases of the library provided separate radix-2 and radix-4
 * algorithms that operated on floating-point data.  These functions are still
 * provided but are deprecated.  The older functions are slower and less general
@@ -169,6 +206,10 @@ extern void riscv_bitreversal_32(
 * provided but are deprecated.  The older functions are slower and less general
 * than the new functions.
 * \par
+* riscv_cfft_q31() runs radix-8 stages, after a radix-2 or a radix-4 stage for the lengths that are not a
+* power of 8, so a 4096 point transform takes 4 passes over the data instead of 6.  The output keeps the
+* 1/fftLen scaling of the radix-4 stages it replaces.
+* \par
 * An example of initialization of the constants for the arm_cfft_q31 function follows:
 * \code
 * const static arm_cfft_instance_q31 *S;
@@ -203,50 +244,97 @@ extern void riscv_bitreversal_32(
 *       break;
 *   }
 * \endcode
+* \par Compact twiddle tables
+* When RISCV_MATH_COMPACT_TWIDDLE is defined (CMake option RISCV_DSP_COMPACT_TWIDDLE) the floating-point
+* and Q15 structures point to the quarter-wave tables twiddleCoefQuarter_*, which hold the
+* <code>fftLen/4+1</code> cos values of the first quadrant.  The kernels fold the sin values and the
+* other quadrants at every twiddle load, see riscv_twiddle_fold_f32() and riscv_twiddle_fold_q15().
+* The 4096 point tables shrink from 32 KB to 4 KB (floating-point) and from 12 KB to 2 KB (Q15),
+* tests/Benchmark_TransformFunctions14 measures the cycles this costs.  The floating-point results are
+* unchanged, the Q15 results may differ by a few LSB because the full Q15 tables truncate the negative
+* values.  The Q31 functions and the deprecated floating-point radix-2 and radix-4 functions keep the full tables.
 * 
 */
 
-void riscv_cfft_radix8by2_f32( riscv_cfft_instance_f32 * S, float32_t * p1) 
+/* Inputs of the first stage of an inverse transform, numPairs (real, imag) pairs swapped with */
+/* RISCV_RADIX8_SWAP_IN and scaled with RISCV_RADIX8_SCALE */
+static inline void riscv_cfft_inverse_input_f32( float32_t * pX, uint32_t numPairs, uint32_t mode, float32_t scale)
+{
+    float32_t t;
+    uint32_t i;
+
+    for ( i = 0u; i < 2u * numPairs; i += 2u )
+    {
+        if((mode & RISCV_RADIX8_SWAP_IN) != 0u)
+        {
+            t = pX[i];
+            pX[i] = pX[i + 1u];
+            pX[i + 1u] = t;
+        }
+        if((mode & RISCV_RADIX8_SCALE) != 0u)
+        {
+            pX[i] *= scale;
+            pX[i + 1u] *= scale;
+        }
+    }
+}
+
+/* Radix-2 first stage of riscv_cfft_radix8by2_f32, it reads from pIn, which may be equal to p1 */
+static void riscv_cfft_radix8by2_first_f32( const riscv_cfft_instance_f32 * S, const float32_t * pIn, float32_t * p1, uint32_t mode, float32_t scale) 
 {
     uint32_t    L  = S->fftLen;
-    float32_t * pCol1, * pCol2, * pMid1, * pMid2;
+    float32_t * pMid1, * pMid2;
     float32_t * p2 = p1 + L;
+    const float32_t * pIn1, * pIn2, * pInMid1, * pInMid2;
     const float32_t * tw = (float32_t *) S->pTwiddle;
     float32_t t1[4], t2[4], t3[4], t4[4], twR, twI;
     float32_t m0, m1, m2, m3;
     uint32_t l;
-
-    pCol1 = p1;
-    pCol2 = p2;
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+    uint32_t qLen = S->fftLen >> 2;
+    uint32_t ia = 0u;
+#endif
 
     //    Define new length
     L >>= 1;
     //    Initialize mid pointers
     pMid1 = p1 + L;
     pMid2 = p2 + L;
+    pIn1 = pIn;
+    pIn2 = pIn + S->fftLen;
+    pInMid1 = pIn1 + L;
+    pInMid2 = pIn2 + L;
 
     // do two dot Fourier transform
     for ( l = L >> 2; l > 0; l-- ) 
     {
-        t1[0] = p1[0];
-        t1[1] = p1[1];
-        t1[2] = p1[2];
-        t1[3] = p1[3];
-
-        t2[0] = p2[0];
-        t2[1] = p2[1];
-        t2[2] = p2[2];
-        t2[3] = p2[3];
-
-        t3[0] = pMid1[0];
-        t3[1] = pMid1[1];
-        t3[2] = pMid1[2];
-        t3[3] = pMid1[3];
-
-        t4[0] = pMid2[0];
-        t4[1] = pMid2[1];
-        t4[2] = pMid2[2];
-        t4[3] = pMid2[3];
+        t1[0] = pIn1[0];
+        t1[1] = pIn1[1];
+        t1[2] = pIn1[2];
+        t1[3] = pIn1[3];
+
+        t2[0] = pIn2[0];
+        t2[1] = pIn2[1];
+        t2[2] = pIn2[2];
+        t2[3] = pIn2[3];
+
+        t3[0] = pInMid1[0];
+        t3[1] = pInMid1[1];
+        t3[2] = pInMid1[2];
+        t3[3] = pInMid1[3];
+
+        t4[0] = pInMid2[0];
+        t4[1] = pInMid2[1];
+        t4[2] = pInMid2[2];
+        t4[3] = pInMid2[3];
+
+        if(mode != 0u)
+        {
+            riscv_cfft_inverse_input_f32( t1, 2u, mode, scale);
+            riscv_cfft_inverse_input_f32( t2, 2u, mode, scale);
+            riscv_cfft_inverse_input_f32( t3, 2u, mode, scale);
+            riscv_cfft_inverse_input_f32( t4, 2u, mode, scale);
+        }
 
         *p1++ = t1[0] + t2[0];
         *p1++ = t1[1] + t2[1];
@@ -268,8 +356,15 @@ void riscv_cfft_radix8by2_f32( riscv_cfft_instance_f32 * S, float32_t * p1)
         t4[2] = t4[2] - t3[2];
         t4[3] = t4[3] - t3[3];    // for col 2
 
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+        // the twiddle factors stay in the first quadrant
+        twR = tw[ia];
+        twI = tw[qLen - ia];
+        ia++;
+#else
         twR = *tw++;
         twI = *tw++;
+#endif
 
         // multiply by twiddle factors
         m0 = t2[0] * twR;
@@ -292,8 +387,14 @@ void riscv_cfft_radix8by2_f32( riscv_cfft_instance_f32 * S, float32_t * p1)
         *pMid2++ = m0 - m1;
         *pMid2++ = m2 + m3;
 
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+        twR = tw[ia];
+        twI = tw[qLen - ia];
+        ia++;
+#else
         twR = *tw++;
         twI = *tw++;
+#endif
         
         m0 = t2[2] * twR;
         m1 = t2[3] * twI;
@@ -310,36 +411,76 @@ void riscv_cfft_radix8by2_f32( riscv_cfft_instance_f32 * S, float32_t * p1)
         
         *pMid2++ = m0 - m1;
         *pMid2++ = m2 + m3;
+
+        pIn1 += 4;
+        pIn2 += 4;
+        pInMid1 += 4;
+        pInMid2 += 4;
     }
+}
+
+/* The first stage reads from pIn, which may be equal to p1. pDst == NULL keeps the columns in place, */
+/* otherwise the bins are written to pDst in natural order. mode and scale select the inverse, see */
+/* RISCV_RADIX8_SWAP_IN */
+void riscv_cfft_radix8by2_f32( riscv_cfft_instance_f32 * S, const float32_t * pIn, float32_t * p1, float32_t * pDst, uint32_t mode, float32_t scale) 
+{
+    uint32_t    L  = S->fftLen >> 1;
+    float32_t * pCol1 = p1;
+    float32_t * pCol2 = p1 + S->fftLen;
+
+    riscv_cfft_radix8by2_first_f32( S, pIn, p1, mode, scale);
 
-    // first col
-    riscv_radix8_butterfly_f32( pCol1, L, (float32_t *) S->pTwiddle, 2u);
-    // second col
-    riscv_radix8_butterfly_f32( pCol2, L, (float32_t *) S->pTwiddle, 2u);
+    // the columns only swap their output back
+    mode &= RISCV_RADIX8_SWAP_OUT;
+
+    if(pDst == NULL)
+    {
+        // first col
+        riscv_radix8_butterfly_f32( pCol1, L, (float32_t *) S->pTwiddle, 2u, mode, 1.0f);
+        // second col
+        riscv_radix8_butterfly_f32( pCol2, L, (float32_t *) S->pTwiddle, 2u, mode, 1.0f);
+    }
+    else
+    {
+        // first col holds the even bins, second col the odd bins
+        riscv_radix8_butterfly_ordered_f32( pCol1, pDst, L, (float32_t *) S->pTwiddle, 2u, 2u, mode, 1.0f);
+        riscv_radix8_butterfly_ordered_f32( pCol2, pDst + 2u, L, (float32_t *) S->pTwiddle, 2u, 2u, mode, 1.0f);
+    }
 }
 
-void riscv_cfft_radix8by4_f32( riscv_cfft_instance_f32 * S, float32_t * p1) 
+/* Radix-4 first stage of riscv_cfft_radix8by4_f32, it reads from pIn, which may be equal to p1 */
+static void riscv_cfft_radix8by4_first_f32( const riscv_cfft_instance_f32 * S, const float32_t * pIn, float32_t * p1, uint32_t mode, float32_t scale) 
 {
     uint32_t    L  = S->fftLen >> 1;
-    float32_t * pCol1, *pCol2, *pCol3, *pCol4, *pEnd1, *pEnd2, *pEnd3, *pEnd4;
+    float32_t *pEnd1, *pEnd2, *pEnd3, *pEnd4;
     const float32_t *tw2, *tw3, *tw4;
     float32_t * p2 = p1 + L;
     float32_t * p3 = p2 + L;
     float32_t * p4 = p3 + L;
-    float32_t t2[4], t3[4], t4[4], twR, twI;
+    const float32_t * pIn1, * pIn2, * pIn3, * pIn4, * pInEnd1, * pInEnd2, * pInEnd3, * pInEnd4;
+    float32_t x[8], y[8], t2[4], t3[4], t4[4], twR, twI;
     float32_t p1ap3_0, p1sp3_0, p1ap3_1, p1sp3_1;
     float32_t m0, m1, m2, m3;
     uint32_t l, twMod2, twMod3, twMod4;
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+    uint32_t qLen = S->fftLen >> 2;
+    uint32_t ia = 1u;
+#endif
 
-    pCol1 = p1;         // points to real values by default
-    pCol2 = p2;
-    pCol3 = p3;
-    pCol4 = p4;
     pEnd1 = p2 - 1;     // points to imaginary values by default
     pEnd2 = p3 - 1;
     pEnd3 = p4 - 1;
     pEnd4 = pEnd3 + L;
 
+    pIn1 = pIn;         // same layout for the input
+    pIn2 = pIn1 + L;
+    pIn3 = pIn2 + L;
+    pIn4 = pIn3 + L;
+    pInEnd1 = pIn2 - 1;
+    pInEnd2 = pIn3 - 1;
+    pInEnd3 = pIn4 - 1;
+    pInEnd4 = pInEnd3 + L;
+
     tw2 = tw3 = tw4 = (float32_t *) S->pTwiddle;
 
     L >>= 1;
@@ -351,23 +492,31 @@ void riscv_cfft_radix8by4_f32( riscv_cfft_instance_f32 * S, float32_t * p1)
     twMod4 = 6;
 
     // TOP
-    p1ap3_0 = p1[0] + p3[0];
-    p1sp3_0 = p1[0] - p3[0];
-    p1ap3_1 = p1[1] + p3[1];
-    p1sp3_1 = p1[1] - p3[1];
+    x[0] = pIn1[0];  x[1] = pIn1[1];
+    x[2] = pIn2[0];  x[3] = pIn2[1];
+    x[4] = pIn3[0];  x[5] = pIn3[1];
+    x[6] = pIn4[0];  x[7] = pIn4[1];
+    if(mode != 0u)
+    {
+        riscv_cfft_inverse_input_f32( x, 4u, mode, scale);
+    }
+    p1ap3_0 = x[0] + x[4];
+    p1sp3_0 = x[0] - x[4];
+    p1ap3_1 = x[1] + x[5];
+    p1sp3_1 = x[1] - x[5];
 
     // col 2
-    t2[0] = p1sp3_0 + p2[1] - p4[1];
-    t2[1] = p1sp3_1 - p2[0] + p4[0];
+    t2[0] = p1sp3_0 + x[3] - x[7];
+    t2[1] = p1sp3_1 - x[2] + x[6];
     // col 3
-    t3[0] = p1ap3_0 - p2[0] - p4[0];
-    t3[1] = p1ap3_1 - p2[1] - p4[1];
+    t3[0] = p1ap3_0 - x[2] - x[6];
+    t3[1] = p1ap3_1 - x[3] - x[7];
     // col 4
-    t4[0] = p1sp3_0 - p2[1] + p4[1];
-    t4[1] = p1sp3_1 + p2[0] - p4[0];
+    t4[0] = p1sp3_0 - x[3] + x[7];
+    t4[1] = p1sp3_1 + x[2] - x[6];
     // col 1
-    *p1++ = p1ap3_0 + p2[0] + p4[0];
-    *p1++ = p1ap3_1 + p2[1] + p4[1];
+    *p1++ = p1ap3_0 + x[2] + x[6];
+    *p1++ = p1ap3_1 + x[3] + x[7];
 
     // Twiddle factors are ones
     *p2++ = t2[0];
@@ -377,52 +526,79 @@ void riscv_cfft_radix8by4_f32( riscv_cfft_instance_f32 * S, float32_t * p1)
     *p4++ = t4[0];
     *p4++ = t4[1];
 
+#if !defined (RISCV_MATH_COMPACT_TWIDDLE)
     tw2 += twMod2;
     tw3 += twMod3;
     tw4 += twMod4;
+#endif
+
+    pIn1 += 2;
+    pIn2 += 2;
+    pIn3 += 2;
+    pIn4 += 2;
 
     for (l = (L - 2) >> 1; l > 0; l-- ) 
     {
         // TOP
-        p1ap3_0 = p1[0] + p3[0];
-        p1sp3_0 = p1[0] - p3[0];
-        p1ap3_1 = p1[1] + p3[1];
-        p1sp3_1 = p1[1] - p3[1];
+        x[0] = pIn1[0];  x[1] = pIn1[1];
+    x[2] = pIn2[0];  x[3] = pIn2[1];
+    x[4] = pIn3[0];  x[5] = pIn3[1];
+    x[6] = pIn4[0];  x[7] = pIn4[1];
+    if(mode != 0u)
+    {
+        riscv_cfft_inverse_input_f32( x, 4u, mode, scale);
+    }
+    p1ap3_0 = x[0] + x[4];
+        p1sp3_0 = x[0] - x[4];
+        p1ap3_1 = x[1] + x[5];
+        p1sp3_1 = x[1] - x[5];
         // col 2
-        t2[0] = p1sp3_0 + p2[1] - p4[1];
-        t2[1] = p1sp3_1 - p2[0] + p4[0];
+        t2[0] = p1sp3_0 + x[3] - x[7];
+        t2[1] = p1sp3_1 - x[2] + x[6];
         // col 3
-        t3[0] = p1ap3_0 - p2[0] - p4[0];
-        t3[1] = p1ap3_1 - p2[1] - p4[1];
+        t3[0] = p1ap3_0 - x[2] - x[6];
+        t3[1] = p1ap3_1 - x[3] - x[7];
         // col 4
-        t4[0] = p1sp3_0 - p2[1] + p4[1];
-        t4[1] = p1sp3_1 + p2[0] - p4[0];
+        t4[0] = p1sp3_0 - x[3] + x[7];
+        t4[1] = p1sp3_1 + x[2] - x[6];
         // col 1 - top
-        *p1++ = p1ap3_0 + p2[0] + p4[0];
-        *p1++ = p1ap3_1 + p2[1] + p4[1];
+        *p1++ = p1ap3_0 + x[2] + x[6];
+        *p1++ = p1ap3_1 + x[3] + x[7];
 
         // BOTTOM
-        p1ap3_1 = pEnd1[-1] + pEnd3[-1];
-        p1sp3_1 = pEnd1[-1] - pEnd3[-1];
-        p1ap3_0 = pEnd1[0] + pEnd3[0];
-        p1sp3_0 = pEnd1[0] - pEnd3[0];
+        y[0] = pInEnd1[-1];  y[1] = pInEnd1[0];
+    y[2] = pInEnd2[-1];  y[3] = pInEnd2[0];
+    y[4] = pInEnd3[-1];  y[5] = pInEnd3[0];
+    y[6] = pInEnd4[-1];  y[7] = pInEnd4[0];
+    if(mode != 0u)
+    {
+        riscv_cfft_inverse_input_f32( y, 4u, mode, scale);
+    }
+    p1ap3_1 = y[0] + y[4];
+        p1sp3_1 = y[0] - y[4];
+        p1ap3_0 = y[1] + y[5];
+        p1sp3_0 = y[1] - y[5];
         // col 2
-        t2[2] = pEnd2[0]  - pEnd4[0] + p1sp3_1;
-        t2[3] = pEnd1[0] - pEnd3[0] - pEnd2[-1] + pEnd4[-1];
+        t2[2] = y[3]  - y[7] + p1sp3_1;
+        t2[3] = y[1] - y[5] - y[2] + y[6];
         // col 3
-        t3[2] = p1ap3_1 - pEnd2[-1] - pEnd4[-1];
-        t3[3] = p1ap3_0 - pEnd2[0]  - pEnd4[0];
+        t3[2] = p1ap3_1 - y[2] - y[6];
+        t3[3] = p1ap3_0 - y[3]  - y[7];
         // col 4
-        t4[2] = pEnd2[0]  - pEnd4[0]  - p1sp3_1;
-        t4[3] = pEnd4[-1] - pEnd2[-1] - p1sp3_0;
+        t4[2] = y[3]  - y[7]  - p1sp3_1;
+        t4[3] = y[6] - y[2] - p1sp3_0;
         // col 1 - Bottom
-        *pEnd1-- = p1ap3_0 + pEnd2[0] + pEnd4[0];
-        *pEnd1-- = p1ap3_1 + pEnd2[-1] + pEnd4[-1];
+        *pEnd1-- = p1ap3_0 + y[3] + y[7];
+        *pEnd1-- = p1ap3_1 + y[2] + y[6];
 
         // COL 2
         // read twiddle factors
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+        riscv_twiddle_fold_f32(tw2, qLen, ia, &twR, &twI);
+#else
         twR = *tw2++;
         twI = *tw2++;
+#endif
         // multiply by twiddle factors
         //  let    Z1 = a + i(b),   Z2 = c + i(d)
         //   =>  Z1 * Z2  =  (a*c - b*d) + i(b*c + a*d)
@@ -447,9 +623,13 @@ void riscv_cfft_radix8by4_f32( riscv_cfft_instance_f32 * S, float32_t * p1)
         *pEnd2-- = m2 + m3;
 
         // COL 3
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+        riscv_twiddle_fold_f32(tw3, qLen, 2u * ia, &twR, &twI);
+#else
         twR = tw3[0];
         twI = tw3[1];
         tw3 += twMod3;
+#endif
         // Top
         m0 = t3[0] * twR;
         m1 = t3[1] * twI;
@@ -470,9 +650,14 @@ void riscv_cfft_radix8by4_f32( riscv_cfft_instance_f32 * S, float32_t * p1)
         *pEnd3-- = m3 - m2;
         
         // COL 4
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+        riscv_twiddle_fold_f32(tw4, qLen, 3u * ia, &twR, &twI);
+        ia++;
+#else
         twR = tw4[0];
         twI = tw4[1];
         tw4 += twMod4;
+#endif
         // Top
         m0 = t4[0] * twR;
         m1 = t4[1] * twI;
@@ -491,32 +676,53 @@ void riscv_cfft_radix8by4_f32( riscv_cfft_instance_f32 * S, float32_t * p1)
         
         *pEnd4-- = m0 - m1;
         *pEnd4-- = m2 + m3;
+
+        pIn1 += 2;
+        pIn2 += 2;
+        pIn3 += 2;
+        pIn4 += 2;
+        pInEnd1 -= 2;
+        pInEnd2 -= 2;
+        pInEnd3 -= 2;
+        pInEnd4 -= 2;
     }
 
     //MIDDLE
     // Twiddle factors are 
     //  1.0000  0.7071-0.7071i  -1.0000i  -0.7071-0.7071i
-    p1ap3_0 = p1[0] + p3[0];
-    p1sp3_0 = p1[0] - p3[0];
-    p1ap3_1 = p1[1] + p3[1];
-    p1sp3_1 = p1[1] - p3[1];
+    x[0] = pIn1[0];  x[1] = pIn1[1];
+    x[2] = pIn2[0];  x[3] = pIn2[1];
+    x[4] = pIn3[0];  x[5] = pIn3[1];
+    x[6] = pIn4[0];  x[7] = pIn4[1];
+    if(mode != 0u)
+    {
+        riscv_cfft_inverse_input_f32( x, 4u, mode, scale);
+    }
+    p1ap3_0 = x[0] + x[4];
+    p1sp3_0 = x[0] - x[4];
+    p1ap3_1 = x[1] + x[5];
+    p1sp3_1 = x[1] - x[5];
 
     // col 2
-    t2[0] = p1sp3_0 + p2[1] - p4[1];
-    t2[1] = p1sp3_1 - p2[0] + p4[0];
+    t2[0] = p1sp3_0 + x[3] - x[7];
+    t2[1] = p1sp3_1 - x[2] + x[6];
     // col 3
-    t3[0] = p1ap3_0 - p2[0] - p4[0];
-    t3[1] = p1ap3_1 - p2[1] - p4[1];
+    t3[0] = p1ap3_0 - x[2] - x[6];
+    t3[1] = p1ap3_1 - x[3] - x[7];
     // col 4
-    t4[0] = p1sp3_0 - p2[1] + p4[1];
-    t4[1] = p1sp3_1 + p2[0] - p4[0];
+    t4[0] = p1sp3_0 - x[3] + x[7];
+    t4[1] = p1sp3_1 + x[2] - x[6];
     // col 1 - Top
-    *p1++ = p1ap3_0 + p2[0] + p4[0];
-    *p1++ = p1ap3_1 + p2[1] + p4[1];
+    *p1++ = p1ap3_0 + x[2] + x[6];
+    *p1++ = p1ap3_1 + x[3] + x[7];
 
     // COL 2
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+    riscv_twiddle_fold_f32(tw2, qLen, ia, &twR, &twI);
+#else
     twR = tw2[0];
     twI = tw2[1];
+#endif
 
     m0 = t2[0] * twR;
     m1 = t2[1] * twI;
@@ -526,8 +732,12 @@ void riscv_cfft_radix8by4_f32( riscv_cfft_instance_f32 * S, float32_t * p1)
     *p2++ = m0 + m1;
     *p2++ = m2 - m3;
     // COL 3
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+    riscv_twiddle_fold_f32(tw3, qLen, 2u * ia, &twR, &twI);
+#else
     twR = tw3[0];
     twI = tw3[1];
+#endif
 
     m0 = t3[0] * twR;
     m1 = t3[1] * twI;
@@ -537,8 +747,12 @@ void riscv_cfft_radix8by4_f32( riscv_cfft_instance_f32 * S, float32_t * p1)
     *p3++ = m0 + m1;
     *p3++ = m2 - m3;
     // COL 4
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+    riscv_twiddle_fold_f32(tw4, qLen, 3u * ia, &twR, &twI);
+#else
     twR = tw4[0];
     twI = tw4[1];
+#endif
 
     m0 = t4[0] * twR;
     m1 = t4[1] * twI;
@@ -547,15 +761,57 @@ void riscv_cfft_radix8by4_f32( riscv_cfft_instance_f32 * S, float32_t * p1)
 
     *p4++ = m0 + m1;
     *p4++ = m2 - m3;
+}
+
+/* The first stage reads from pIn, which may be equal to p1. pDst == NULL keeps the columns in place, */
+/* otherwise the bins are written to pDst in natural order. mode and scale select the inverse, see */
+/* RISCV_RADIX8_SWAP_IN */
+void riscv_cfft_radix8by4_f32( riscv_cfft_instance_f32 * S, const float32_t * pIn, float32_t * p1, float32_t * pDst, uint32_t mode, float32_t scale) 
+{
+    uint32_t    L  = S->fftLen >> 2;
+    float32_t * pCol1 = p1;
+    float32_t * pCol2 = pCol1 + (S->fftLen >> 1);
+    float32_t * pCol3 = pCol2 + (S->fftLen >> 1);
+    float32_t * pCol4 = pCol3 + (S->fftLen >> 1);
 
-    // first col
-    riscv_radix8_butterfly_f32( pCol1, L, (float32_t *) S->pTwiddle, 4u);
-    // second col
-    riscv_radix8_butterfly_f32( pCol2, L, (float32_t *) S->pTwiddle, 4u);
-    // third col
-    riscv_radix8_butterfly_f32( pCol3, L, (float32_t *) S->pTwiddle, 4u);
-    // fourth col
-    riscv_radix8_butterfly_f32( pCol4, L, (float32_t *) S->pTwiddle, 4u);
+    riscv_cfft_radix8by4_first_f32( S, pIn, p1, mode, scale);
+
+    // the columns only swap their output back
+    mode &= RISCV_RADIX8_SWAP_OUT;
+
+    if(pDst == NULL)
+    {
+        // first col
+        riscv_radix8_butterfly_f32( pCol1, L, (float32_t *) S->pTwiddle, 4u, mode, 1.0f);
+        // second col
+        riscv_radix8_butterfly_f32( pCol2, L, (float32_t *) S->pTwiddle, 4u, mode, 1.0f);
+        // third col
+        riscv_radix8_butterfly_f32( pCol3, L, (float32_t *) S->pTwiddle, 4u, mode, 1.0f);
+        // fourth col
+        riscv_radix8_butterfly_f32( pCol4, L, (float32_t *) S->pTwiddle, 4u, mode, 1.0f);
+    }
+    else
+    {
+        // col c holds the bins 4k + c
+        riscv_radix8_butterfly_ordered_f32( pCol1, pDst, L, (float32_t *) S->pTwiddle, 4u, 4u, mode, 1.0f);
+        riscv_radix8_butterfly_ordered_f32( pCol2, pDst + 2u, L, (float32_t *) S->pTwiddle, 4u, 4u, mode, 1.0f);
+        riscv_radix8_butterfly_ordered_f32( pCol3, pDst + 4u, L, (float32_t *) S->pTwiddle, 4u, 4u, mode, 1.0f);
+        riscv_radix8_butterfly_ordered_f32( pCol4, pDst + 6u, L, (float32_t *) S->pTwiddle, 4u, 4u, mode, 1.0f);
+    }
+}
+
+/* Mode of the radix-8 kernels for ifftFlag */
+static uint32_t riscv_cfft_mode_f32( uint8_t ifftFlag)
+{
+    if(ifftFlag == 1u)
+    {
+        return (RISCV_RADIX8_SWAP_IN | RISCV_RADIX8_SWAP_OUT | RISCV_RADIX8_SCALE);
+    }
+    if(ifftFlag == RISCV_FFT_INVERSE_NOSCALE)
+    {
+        return (RISCV_RADIX8_SWAP_IN | RISCV_RADIX8_SWAP_OUT);
+    }
+    return 0u;
 }
 
 /**
@@ -568,7 +824,7 @@ void riscv_cfft_radix8by4_f32( riscv_cfft_instance_f32 * S, float32_t * p1)
 * @brief       Processing function for the floating-point complex FFT.
 * @param[in]      *S    points to an instance of the floating-point CFFT structure.  
 * @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.  
-* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.  
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform, RISCV_FFT_INVERSE_NOSCALE for the inverse without the 1/fftLen scaling.  
 * @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.  
 * @return none.  
 */
@@ -579,52 +835,203 @@ void riscv_cfft_f32(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag)
 {
-    uint32_t  L = S->fftLen, l;
-    float32_t invL, * pSrc;
+  RISCV_PROFILE(riscv_cfft_f32);
+    uint32_t  L = S->fftLen, mode;
+    float32_t invL;
 
-    if(ifftFlag == 1u)
-    {
-        /*  Conjugate input data  */
-        pSrc = p1 + 1;
-        for(l=0; l<L; l++) 
-        {
-            *pSrc = -*pSrc;
-            pSrc += 2;
-        }
-    }
+    mode = riscv_cfft_mode_f32( ifftFlag);
+    invL = ((mode & RISCV_RADIX8_SCALE) != 0u) ? 1.0f/(float32_t)L : 1.0f;
 
     switch (L) 
     {
     case 16: 
     case 128:
     case 1024:
-        riscv_cfft_radix8by2_f32  ( (riscv_cfft_instance_f32 *) S, p1);
+        riscv_cfft_radix8by2_f32  ( (riscv_cfft_instance_f32 *) S, p1, p1, NULL, mode, invL);
         break;
     case 32:
     case 256:
     case 2048:
-        riscv_cfft_radix8by4_f32  ( (riscv_cfft_instance_f32 *) S, p1);
+        riscv_cfft_radix8by4_f32  ( (riscv_cfft_instance_f32 *) S, p1, p1, NULL, mode, invL);
         break;
     case 64:
     case 512:
     case 4096:
-        riscv_radix8_butterfly_f32( p1, L, (float32_t *) S->pTwiddle, 1);
+        riscv_radix8_butterfly_f32( p1, L, (float32_t *) S->pTwiddle, 1, mode, invL);
         break;
     }  
 
     if( bitReverseFlag )
         riscv_bitreversal_32((uint32_t*)p1,S->bitRevLength,S->pBitRevTable);
+}
 
-    if(ifftFlag == 1u)
+/**   
+* @details   
+* @brief       Floating-point complex FFT with the output written in natural order.
+* @param[in]      *S    points to an instance of the floating-point CFFT structure.  
+* @param[in, out] *p1   points to the complex input buffer of size <code>2*fftLen</code>. It is used as work buffer and is overwritten.  
+* @param[out]     *pDst points to the complex output buffer of size <code>2*fftLen</code>.  
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform, RISCV_FFT_INVERSE_NOSCALE for the inverse without the 1/fftLen scaling.  
+* @return none.  
+*  
+* \par
+* Gives the same result as riscv_cfft_f32() with <code>bitReverseFlag=1</code>, but the last radix-8 stage    
+* writes its outputs straight to their bit reversed positions in <code>pDst</code>. This removes the    
+* separate riscv_bitreversal_32() pass over the whole buffer. <code>pDst</code> must not overlap <code>p1</code>.  
+*/
+
+void riscv_cfft_ordered_f32( 
+    const riscv_cfft_instance_f32 * S, 
+    float32_t * p1,
+    float32_t * pDst,
+    uint8_t ifftFlag)
+{
+  RISCV_PROFILE(riscv_cfft_ordered_f32);
+    uint32_t  L = S->fftLen, mode;
+    float32_t invL;
+
+    mode = riscv_cfft_mode_f32( ifftFlag);
+    invL = ((mode & RISCV_RADIX8_SCALE) != 0u) ? 1.0f/(float32_t)L : 1.0f;
+
+    switch (L) 
+    {
+    case 16: 
+    case 128:
+    case 1024:
+        riscv_cfft_radix8by2_f32  ( (riscv_cfft_instance_f32 *) S, p1, p1, pDst, mode, invL);
+        break;
+    case 32:
+    case 256:
+    case 2048:
+        riscv_cfft_radix8by4_f32  ( (riscv_cfft_instance_f32 *) S, p1, p1, pDst, mode, invL);
+        break;
+    case 64:
+    case 512:
+    case 4096:
+        riscv_radix8_butterfly_ordered_f32( p1, pDst, L, (float32_t *) S->pTwiddle, 1u, 1u, mode, invL);
+        break;
+    }  
+}
+
+/**   
+* @details   
+* @brief       Out-of-place processing function for the floating-point complex FFT.
+* @param[in]      *S    points to an instance of the floating-point CFFT structure.  
+* @param[in]      *pSrc points to the complex input buffer of size <code>2*fftLen</code>. It is not modified.  
+* @param[out]     *pDst points to the complex output buffer of size <code>2*fftLen</code>.  
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform, RISCV_FFT_INVERSE_NOSCALE for the inverse without the 1/fftLen scaling.  
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.  
+* @return none.  
+*  
+* \par
+* Gives the same result in <code>pDst</code> as copying <code>pSrc</code> to <code>pDst</code> and calling riscv_cfft_f32() on it.   
+* The first butterfly stage reads straight from <code>pSrc</code>, so no copy pass is needed.   
+* <code>pDst</code> must not overlap <code>pSrc</code>.  
+*/
+
+void riscv_cfft_oop_f32( 
+    const riscv_cfft_instance_f32 * S, 
+    const float32_t * pSrc,
+    float32_t * pDst,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+  RISCV_PROFILE(riscv_cfft_oop_f32);
+    uint32_t  L = S->fftLen, mode;
+    float32_t invL;
+
+    mode = riscv_cfft_mode_f32( ifftFlag);
+    invL = ((mode & RISCV_RADIX8_SCALE) != 0u) ? 1.0f/(float32_t)L : 1.0f;
+
+    switch (L) 
+    {
+    case 16: 
+    case 128:
+    case 1024:
+        riscv_cfft_radix8by2_f32  ( (riscv_cfft_instance_f32 *) S, pSrc, pDst, NULL, mode, invL);
+        break;
+    case 32:
+    case 256:
+    case 2048:
+        riscv_cfft_radix8by4_f32  ( (riscv_cfft_instance_f32 *) S, pSrc, pDst, NULL, mode, invL);
+        break;
+    case 64:
+    case 512:
+    case 4096:
+        riscv_radix8_butterfly_oop_f32( pSrc, pDst, L, (float32_t *) S->pTwiddle, 1, mode, invL);
+        break;
+    }  
+
+    if( bitReverseFlag )
+        riscv_bitreversal_32((uint32_t*)pDst,S->bitRevLength,S->pBitRevTable);
+}
+
+/**   
+* @details   
+* @brief       Processing function for several floating-point complex FFTs of the same length.
+* @param[in]      *S           points to an instance of the floating-point CFFT structure.  
+* @param[in, out] *p1          points to the complex data of all channels, stored back to back: channel <code>c</code> uses <code>p1[2*fftLen*c]</code> to <code>p1[2*fftLen*(c+1) - 1]</code>. The processing occurs in-place.  
+* @param[in]     numChannels    number of channels.  
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform, RISCV_FFT_INVERSE_NOSCALE for the inverse without the 1/fftLen scaling.  
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.  
+* @return none.  
+*  
+* \par
+* Gives the same result as calling riscv_cfft_f32() on every channel.   
+* The first radix-2 or radix-4 stage of the radix-8-by-2 and radix-8-by-4 lengths is run channel by channel,    
+* then every radix-8 stage is run over the columns of all channels before the next stage starts.    
+* The twiddle factors of a butterfly group are then loaded once for all channels, and the loop   
+* setup of a stage is paid once per call instead of once per channel.   
+*/
+
+void riscv_cfft_batch_f32( 
+    const riscv_cfft_instance_f32 * S, 
+    float32_t * p1,
+    uint16_t numChannels,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+  RISCV_PROFILE(riscv_cfft_batch_f32);
+    uint32_t  L = S->fftLen, c, mode;
+    float32_t invL;
+
+    mode = riscv_cfft_mode_f32( ifftFlag);
+    invL = ((mode & RISCV_RADIX8_SCALE) != 0u) ? 1.0f/(float32_t)L : 1.0f;
+
+    switch (L) 
+    {
+    case 16: 
+    case 128:
+    case 1024:
+        for(c=0; c<numChannels; c++)
+        {
+            riscv_cfft_radix8by2_first_f32( S, p1 + (2u * L * c), p1 + (2u * L * c), mode, invL);
+        }
+        // two columns per channel
+        riscv_radix8_butterfly_batch_f32( p1, L >> 1, (float32_t *) S->pTwiddle, 2u, 2u * numChannels, mode & RISCV_RADIX8_SWAP_OUT, 1.0f);
+        break;
+    case 32:
+    case 256:
+    case 2048:
+        for(c=0; c<numChannels; c++)
+        {
+            riscv_cfft_radix8by4_first_f32( S, p1 + (2u * L * c), p1 + (2u * L * c), mode, invL);
+        }
+        // four columns per channel
+        riscv_radix8_butterfly_batch_f32( p1, L >> 2, (float32_t *) S->pTwiddle, 4u, 4u * numChannels, mode & RISCV_RADIX8_SWAP_OUT, 1.0f);
+        break;
+    case 64:
+    case 512:
+    case 4096:
+        riscv_radix8_butterfly_batch_f32( p1, L, (float32_t *) S->pTwiddle, 1u, numChannels, mode, invL);
+        break;
+    }  
+
+    if( bitReverseFlag )
     {
-        invL = 1.0f/(float32_t)L;
-        /*  Conjugate and scale output data */
-        pSrc = p1;
-        for(l=0; l<L; l++) 
+        for(c=0; c<numChannels; c++)
         {
-            *pSrc++ *=   invL ;
-            *pSrc  = -(*pSrc) * invL;
-            pSrc++;
+            riscv_bitreversal_32((uint32_t*)(p1 + (2u * L * c)),S->bitRevLength,S->pBitRevTable);
         }
     }
 }
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_init_f32.c
+*
+* Description:  Initialization functions for the floating-point CFFT that build the
+*               twiddle factor and bit reversal tables at runtime.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point CFFT with tables computed at runtime.
+* @param[out]    *S             points to an instance of the floating-point CFFT structure.
+* @param[in]     fftLen         length of the FFT.
+* @param[out]    *pTwiddle      points to a buffer of <code>2*fftLen</code> words that receives the twiddle factors, <code>fftLen/4+1</code> words with RISCV_MATH_COMPACT_TWIDDLE.
+* @param[out]    *pBitRevTable  points to a buffer of RISCVBITREVINDEXTABLE_*_TABLE_LENGTH entries that receives the bit reversal table.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* The parameter <code>fftLen</code> specifies the length of the CFFT process. Supported FFT Lengths are 16, 32, 64, 128, 256, 512, 1024, 2048, 4096.
+* \par
+* Only the tables of the requested length are built, with the same contents as the twiddleCoef_* and riscvBitRevIndexTable*
+* tables of riscv_common_tables.c. A program that only uses runtime initialized instances does not link the constant tables.
+* Both buffers must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_cfft_runtime_init_f32(
+  riscv_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pBitRevTable)
+{
+  RISCV_PROFILE(riscv_cfft_runtime_init_f32);
+  uint32_t k;
+  float64_t phase;
+
+  if(((fftLen & (fftLen - 1u)) != 0u) || (fftLen < 16u) || (fftLen > 4096u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+  /*  Compute the quarter-wave table cos(2*pi*k/fftLen), k = 0..fftLen/4 */
+  for (k = 0u; k <= (fftLen >> 2u); k++)
+  {
+    phase = (6.283185307179586 * (float64_t) k) / (float64_t) fftLen;
+    pTwiddle[k] = (float32_t) cos(phase);
+  }
+#else
+  /*  Compute the twiddle factors cos(2*pi*k/fftLen), sin(2*pi*k/fftLen) */
+  for (k = 0u; k < fftLen; k++)
+  {
+    phase = (6.283185307179586 * (float64_t) k) / (float64_t) fftLen;
+    pTwiddle[2u * k] = (float32_t) cos(phase);
+    pTwiddle[(2u * k) + 1u] = (float32_t) sin(phase);
+  }
+#endif
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->pBitRevTable = pBitRevTable;
+  S->bitRevLength = riscv_bitreversal_init_f32(pBitRevTable, fftLen);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @brief  Initialization function for the floating-point CFFT with twiddle factors taken from a longer transform.
+* @param[out]    *S             points to an instance of the floating-point CFFT structure.
+* @param[in]     fftLen         length of the FFT.
+* @param[in]     *pMaster       points to an initialized instance of length <code>fftLen</code> or longer.
+* @param[out]    *pTwiddle      points to a buffer of <code>2*fftLen</code> words that receives the twiddle factors, <code>fftLen/4+1</code> words with RISCV_MATH_COMPACT_TWIDDLE.
+* @param[out]    *pBitRevTable  points to a buffer of RISCVBITREVINDEXTABLE_*_TABLE_LENGTH entries that receives the bit reversal table.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* Twiddle factor k of length <code>fftLen</code> is twiddle factor k*(pMaster->fftLen/fftLen) of the master instance,
+* so the twiddle factors are copied with that stride instead of being computed.
+* With one master instance for the longest transform, a shorter transform only adds its own tables in RAM.
+* When <code>fftLen</code> equals <code>pMaster->fftLen</code> the master twiddle table is used directly and <code>pTwiddle</code> is not accessed.
+*/
+
+riscv_status riscv_cfft_strided_init_f32(
+  riscv_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  const riscv_cfft_instance_f32 * pMaster,
+  float32_t * pTwiddle,
+  uint16_t * pBitRevTable)
+{
+  RISCV_PROFILE(riscv_cfft_strided_init_f32);
+  const float32_t * pSrc = pMaster->pTwiddle;
+  uint32_t stride, k;
+
+  if(((fftLen & (fftLen - 1u)) != 0u) || (fftLen < 16u) || (fftLen > pMaster->fftLen))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  stride = pMaster->fftLen / fftLen;
+
+  if(stride == 1u)
+  {
+    S->pTwiddle = pMaster->pTwiddle;
+  }
+  else
+  {
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+    /*  Copy every stride-th value of the master quarter-wave table */
+    for (k = 0u; k <= ((uint32_t) fftLen >> 2u); k++)
+    {
+      pTwiddle[k] = pSrc[0];
+      pSrc += stride;
+    }
+#else
+    /*  Copy every stride-th twiddle factor of the master table */
+    for (k = 0u; k < fftLen; k++)
+    {
+      pTwiddle[2u * k] = pSrc[0];
+      pTwiddle[(2u * k) + 1u] = pSrc[1];
+      pSrc += 2u * stride;
+    }
+#endif
+    S->pTwiddle = pTwiddle;
+  }
+
+  S->fftLen = fftLen;
+  S->pBitRevTable = pBitRevTable;
+  S->bitRevLength = riscv_bitreversal_init_f32(pBitRevTable, fftLen);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of ComplexFFT group
+*/
@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_init_q31.c
+*
+* Description:  Initialization functions for the Q31 CFFT that build the
+*               twiddle factor and bit reversal tables at runtime.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q31 CFFT with tables computed at runtime.
+* @param[out]    *S             points to an instance of the Q31 CFFT structure.
+* @param[in]     fftLen         length of the FFT.
+* @param[out]    *pTwiddle      points to a buffer of <code>3*fftLen/2</code> words that receives the twiddle factors.
+* @param[out]    *pBitRevTable  points to a buffer of RISCVBITREVINDEXTABLE_FIXED_*_TABLE_LENGTH entries that receives the bit reversal table.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* The parameter <code>fftLen</code> specifies the length of the CFFT process. Supported FFT Lengths are 16, 32, 64, 128, 256, 512, 1024, 2048, 4096.
+* \par
+* Only the tables of the requested length are built, with the same contents as the twiddleCoef_*_q31 and riscvBitRevIndexTable_fixed_*
+* tables of riscv_common_tables.c (the twiddle factors may differ by one LSB). A program that only uses runtime initialized instances does not link the constant tables.
+* Both buffers must stay valid as long as the instance is used.
+* \par
+* With RISCV_MATH_NOFPU the twiddle factors are copied from the constant table of the longest built length instead of being
+* computed in double precision, which links that table; longer lengths return RISCV_MATH_ARGUMENT_ERROR.
+*/
+
+riscv_status riscv_cfft_runtime_init_q31(
+  riscv_cfft_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddle,
+  uint16_t * pBitRevTable)
+{
+  RISCV_PROFILE(riscv_cfft_runtime_init_q31);
+  uint32_t k;
+#if defined (RISCV_MATH_NOFPU)
+  const q31_t * pSrc;
+  uint32_t stride;
+#else
+  float64_t phase;
+  float64_t val;
+#endif
+
+  if(((fftLen & (fftLen - 1u)) != 0u) || (fftLen < 16u) || (fftLen > 4096u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+#if defined (RISCV_MATH_NOFPU)
+  if(fftLen > RISCV_DSP_FFT_LEN_MAX)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  Copy every stride-th twiddle factor of the longest table */
+  stride = RISCV_DSP_FFT_LEN_MAX / fftLen;
+  pSrc = RISCV_DSP_FFT_TABLE(twiddleCoef_, RISCV_DSP_FFT_LEN_MAX, _q31);
+  for (k = 0u; k < ((3u * fftLen) / 4u); k++)
+  {
+    pTwiddle[2u * k] = pSrc[0];
+    pTwiddle[(2u * k) + 1u] = pSrc[1];
+    pSrc += 2u * stride;
+  }
+#else
+  /*  Compute the twiddle factors cos(2*pi*k/fftLen), sin(2*pi*k/fftLen) */
+  for (k = 0u; k < ((3u * fftLen) / 4u); k++)
+  {
+    phase = (6.283185307179586 * (float64_t) k) / (float64_t) fftLen;
+
+    /*  Truncate like the constant tables, 1.0 saturates to 2147483647 */
+    val = floor(cos(phase) * 2147483648.0);
+    pTwiddle[2u * k] = (q31_t) ((val > 2147483647.0) ? 2147483647.0 : val);
+    val = floor(sin(phase) * 2147483648.0);
+    pTwiddle[(2u * k) + 1u] = (q31_t) ((val > 2147483647.0) ? 2147483647.0 : val);
+  }
+#endif
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->pBitRevTable = pBitRevTable;
+  S->bitRevLength = riscv_bitreversal_init_fixed(pBitRevTable, fftLen);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @brief  Initialization function for the Q31 CFFT with twiddle factors taken from a longer transform.
+* @param[out]    *S             points to an instance of the Q31 CFFT structure.
+* @param[in]     fftLen         length of the FFT.
+* @param[in]     *pMaster       points to an initialized instance of length <code>fftLen</code> or longer.
+* @param[out]    *pTwiddle      points to a buffer of <code>3*fftLen/2</code> words that receives the twiddle factors.
+* @param[out]    *pBitRevTable  points to a buffer of RISCVBITREVINDEXTABLE_FIXED_*_TABLE_LENGTH entries that receives the bit reversal table.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* Twiddle factor k of length <code>fftLen</code> is twiddle factor k*(pMaster->fftLen/fftLen) of the master instance,
+* so the twiddle factors are copied with that stride instead of being computed.
+* With one master instance for the longest transform, a shorter transform only adds its own tables in RAM.
+* When <code>fftLen</code> equals <code>pMaster->fftLen</code> the master twiddle table is used directly and <code>pTwiddle</code> is not accessed.
+*/
+
+riscv_status riscv_cfft_strided_init_q31(
+  riscv_cfft_instance_q31 * S,
+  uint16_t fftLen,
+  const riscv_cfft_instance_q31 * pMaster,
+  q31_t * pTwiddle,
+  uint16_t * pBitRevTable)
+{
+  RISCV_PROFILE(riscv_cfft_strided_init_q31);
+  const q31_t * pSrc = pMaster->pTwiddle;
+  uint32_t stride, k;
+
+  if(((fftLen & (fftLen - 1u)) != 0u) || (fftLen < 16u) || (fftLen > pMaster->fftLen))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  stride = pMaster->fftLen / fftLen;
+
+  if(stride == 1u)
+  {
+    S->pTwiddle = pMaster->pTwiddle;
+  }
+  else
+  {
+    /*  Copy every stride-th twiddle factor of the master table */
+    for (k = 0u; k < ((3u * fftLen) / 4u); k++)
+    {
+      pTwiddle[2u * k] = pSrc[0];
+      pTwiddle[(2u * k) + 1u] = pSrc[1];
+      pSrc += 2u * stride;
+    }
+    S->pTwiddle = pTwiddle;
+  }
+
+  S->fftLen = fftLen;
+  S->pBitRevTable = pBitRevTable;
+  S->bitRevLength = riscv_bitreversal_init_fixed(pBitRevTable, fftLen);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of ComplexFFT group
+*/
@@ -0,0 +1,361 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_mixed_f32.c
+*
+* Description:  Mixed-radix (2, 3, 4, 5) floating-point complex FFT for
+*               lengths that are not a power of two.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/*
+* The transform is a decimation in time FFT that recurses over the stages
+* found by riscv_cfft_mixed_init_f32().  Every stage of radix p and length
+* p*m first transforms its p interleaved sub-sequences of length m into
+* consecutive blocks of the output and then combines them with m radix-p
+* butterflies, so the output is in natural order and no bit reversal is needed.
+*
+* The twiddle factor of index i is read with a conjugate multiplication from
+* pTw + i*twStep.  The forward transform starts at the beginning of the
+* table and steps forward, the inverse transform starts at entry fftLen and
+* steps backwards, which yields the conjugated twiddle factors.
+*/
+
+static void riscv_cfft_mixed_radix2_f32(
+  float32_t * pOut,
+  const float32_t * pTw,
+  int32_t twStep,
+  uint32_t m)
+{
+  float32_t * pOut2 = pOut + (2u * m);
+  const float32_t * pTw1 = pTw;
+  float32_t tr, ti;
+  uint32_t k = m;
+
+  do
+  {
+    tr = (pOut2[0] * pTw1[0]) + (pOut2[1] * pTw1[1]);
+    ti = (pOut2[1] * pTw1[0]) - (pOut2[0] * pTw1[1]);
+    pTw1 += twStep;
+
+    pOut2[0] = pOut[0] - tr;
+    pOut2[1] = pOut[1] - ti;
+    pOut[0] += tr;
+    pOut[1] += ti;
+
+    pOut += 2u;
+    pOut2 += 2u;
+  } while(--k);
+}
+
+static void riscv_cfft_mixed_radix3_f32(
+  float32_t * pOut,
+  const float32_t * pTw,
+  int32_t twStep,
+  uint32_t m)
+{
+  float32_t * pOut1 = pOut + (2u * m);
+  float32_t * pOut2 = pOut + (4u * m);
+  const float32_t * pTw1 = pTw;
+  const float32_t * pTw2 = pTw;
+  float32_t s1r, s1i, s2r, s2i, s3r, s3i, s0r, s0i;
+  /*  Imaginary part of the twiddle factor of index fftLen/3 */
+  float32_t epi3 = -pTw[((int32_t) m * twStep) + 1];
+  uint32_t k = m;
+
+  do
+  {
+    s1r = (pOut1[0] * pTw1[0]) + (pOut1[1] * pTw1[1]);
+    s1i = (pOut1[1] * pTw1[0]) - (pOut1[0] * pTw1[1]);
+    s2r = (pOut2[0] * pTw2[0]) + (pOut2[1] * pTw2[1]);
+    s2i = (pOut2[1] * pTw2[0]) - (pOut2[0] * pTw2[1]);
+    pTw1 += twStep;
+    pTw2 += 2 * twStep;
+
+    s3r = s1r + s2r;
+    s3i = s1i + s2i;
+    s0r = (s1r - s2r) * epi3;
+    s0i = (s1i - s2i) * epi3;
+
+    s1r = pOut[0] - (0.5f * s3r);
+    s1i = pOut[1] - (0.5f * s3i);
+    pOut[0] += s3r;
+    pOut[1] += s3i;
+
+    pOut1[0] = s1r - s0i;
+    pOut1[1] = s1i + s0r;
+    pOut2[0] = s1r + s0i;
+    pOut2[1] = s1i - s0r;
+
+    pOut += 2u;
+    pOut1 += 2u;
+    pOut2 += 2u;
+  } while(--k);
+}
+
+static void riscv_cfft_mixed_radix4_f32(
+  float32_t * pOut,
+  const float32_t * pTw,
+  int32_t twStep,
+  uint32_t m,
+  uint8_t ifftFlag)
+{
+  float32_t * pOut1 = pOut + (2u * m);
+  float32_t * pOut2 = pOut + (4u * m);
+  float32_t * pOut3 = pOut + (6u * m);
+  const float32_t * pTw1 = pTw;
+  const float32_t * pTw2 = pTw;
+  const float32_t * pTw3 = pTw;
+  float32_t s0r, s0i, s1r, s1i, s2r, s2i, s3r, s3i, s4r, s4i, s5r, s5i;
+  uint32_t k = m;
+
+  do
+  {
+    s0r = (pOut1[0] * pTw1[0]) + (pOut1[1] * pTw1[1]);
+    s0i = (pOut1[1] * pTw1[0]) - (pOut1[0] * pTw1[1]);
+    s1r = (pOut2[0] * pTw2[0]) + (pOut2[1] * pTw2[1]);
+    s1i = (pOut2[1] * pTw2[0]) - (pOut2[0] * pTw2[1]);
+    s2r = (pOut3[0] * pTw3[0]) + (pOut3[1] * pTw3[1]);
+    s2i = (pOut3[1] * pTw3[0]) - (pOut3[0] * pTw3[1]);
+    pTw1 += twStep;
+    pTw2 += 2 * twStep;
+    pTw3 += 3 * twStep;
+
+    s5r = pOut[0] - s1r;
+    s5i = pOut[1] - s1i;
+    s1r += pOut[0];
+    s1i += pOut[1];
+    s3r = s0r + s2r;
+    s3i = s0i + s2i;
+    s4r = s0r - s2r;
+    s4i = s0i - s2i;
+
+    pOut2[0] = s1r - s3r;
+    pOut2[1] = s1i - s3i;
+    pOut[0] = s1r + s3r;
+    pOut[1] = s1i + s3i;
+
+    /*  The inverse transform rotates by +j instead of -j */
+    if(ifftFlag == 1u)
+    {
+      pOut1[0] = s5r - s4i;
+      pOut1[1] = s5i + s4r;
+      pOut3[0] = s5r + s4i;
+      pOut3[1] = s5i - s4r;
+    }
+    else
+    {
+      pOut1[0] = s5r + s4i;
+      pOut1[1] = s5i - s4r;
+      pOut3[0] = s5r - s4i;
+      pOut3[1] = s5i + s4r;
+    }
+
+    pOut += 2u;
+    pOut1 += 2u;
+    pOut2 += 2u;
+    pOut3 += 2u;
+  } while(--k);
+}
+
+static void riscv_cfft_mixed_radix5_f32(
+  float32_t * pOut,
+  const float32_t * pTw,
+  int32_t twStep,
+  uint32_t m)
+{
+  float32_t * pOut1 = pOut + (2u * m);
+  float32_t * pOut2 = pOut + (4u * m);
+  float32_t * pOut3 = pOut + (6u * m);
+  float32_t * pOut4 = pOut + (8u * m);
+  const float32_t * pTw1 = pTw;
+  const float32_t * pTw2 = pTw;
+  const float32_t * pTw3 = pTw;
+  const float32_t * pTw4 = pTw;
+  float32_t s1r, s1i, s2r, s2i, s3r, s3i, s4r, s4i;
+  float32_t s5r, s5i, s6r, s6i, s7r, s7i, s8r, s8i, s9r, s9i, s10r, s10i;
+  /*  Twiddle factors of index fftLen/5 and 2*fftLen/5 */
+  float32_t yar = pTw[(int32_t) m * twStep];
+  float32_t yai = -pTw[((int32_t) m * twStep) + 1];
+  float32_t ybr = pTw[2 * (int32_t) m * twStep];
+  float32_t ybi = -pTw[(2 * (int32_t) m * twStep) + 1];
+  uint32_t k = m;
+
+  do
+  {
+    s1r = (pOut1[0] * pTw1[0]) + (pOut1[1] * pTw1[1]);
+    s1i = (pOut1[1] * pTw1[0]) - (pOut1[0] * pTw1[1]);
+    s2r = (pOut2[0] * pTw2[0]) + (pOut2[1] * pTw2[1]);
+    s2i = (pOut2[1] * pTw2[0]) - (pOut2[0] * pTw2[1]);
+    s3r = (pOut3[0] * pTw3[0]) + (pOut3[1] * pTw3[1]);
+    s3i = (pOut3[1] * pTw3[0]) - (pOut3[0] * pTw3[1]);
+    s4r = (pOut4[0] * pTw4[0]) + (pOut4[1] * pTw4[1]);
+    s4i = (pOut4[1] * pTw4[0]) - (pOut4[0] * pTw4[1]);
+    pTw1 += twStep;
+    pTw2 += 2 * twStep;
+    pTw3 += 3 * twStep;
+    pTw4 += 4 * twStep;
+
+    s7r = s1r + s4r;
+    s7i = s1i + s4i;
+    s10r = s1r - s4r;
+    s10i = s1i - s4i;
+    s8r = s2r + s3r;
+    s8i = s2i + s3i;
+    s9r = s2r - s3r;
+    s9i = s2i - s3i;
+
+    s5r = pOut[0] + (s7r * yar) + (s8r * ybr);
+    s5i = pOut[1] + (s7i * yar) + (s8i * ybr);
+    s6r = (s10i * yai) + (s9i * ybi);
+    s6i = -(s10r * yai) - (s9r * ybi);
+
+    s1r = pOut[0] + (s7r * ybr) + (s8r * yar);
+    s1i = pOut[1] + (s7i * ybr) + (s8i * yar);
+    s2r = (s9i * yai) - (s10i * ybi);
+    s2i = (s10r * ybi) - (s9r * yai);
+
+    pOut[0] += s7r + s8r;
+    pOut[1] += s7i + s8i;
+
+    pOut1[0] = s5r - s6r;
+    pOut1[1] = s5i - s6i;
+    pOut4[0] = s5r + s6r;
+    pOut4[1] = s5i + s6i;
+    pOut2[0] = s1r + s2r;
+    pOut2[1] = s1i + s2i;
+    pOut3[0] = s1r - s2r;
+    pOut3[1] = s1i - s2i;
+
+    pOut += 2u;
+    pOut1 += 2u;
+    pOut2 += 2u;
+    pOut3 += 2u;
+    pOut4 += 2u;
+  } while(--k);
+}
+
+/*
+* @brief  Processes one stage and, recursively, all the stages after it.
+* @param[out]     *pOut     points to the output block of the stage.
+* @param[in]      *pIn      points to the first input sample of the stage.
+* @param[in]      fstride   distance in samples between two inputs of the stage.
+* @param[in]      *pFactors points to the radix and sub-length of the stage.
+* @param[in]      *pTw      points to the twiddle factor of index 0.
+* @param[in]      twStep    step in words between two twiddle factors of the full length.
+* @param[in]      ifftFlag  selects the forward (0) or inverse (1) transform.
+* @return none.
+*/
+
+static void riscv_cfft_mixed_stage_f32(
+  float32_t * pOut,
+  const float32_t * pIn,
+  uint32_t fstride,
+  const uint16_t * pFactors,
+  const float32_t * pTw,
+  int32_t twStep,
+  uint8_t ifftFlag)
+{
+  float32_t * pOutBeg = pOut;
+  uint32_t p = pFactors[0];
+  uint32_t m = pFactors[1];
+  uint32_t k = p;
+
+  if(m == 1u)
+  {
+    /*  Last stage, gather the inputs */
+    do
+    {
+      pOut[0] = pIn[0];
+      pOut[1] = pIn[1];
+      pIn += 2u * fstride;
+      pOut += 2u;
+    } while(--k);
+  }
+  else
+  {
+    do
+    {
+      riscv_cfft_mixed_stage_f32(pOut, pIn, fstride * p, pFactors + 2u, pTw, twStep, ifftFlag);
+      pIn += 2u * fstride;
+      pOut += 2u * m;
+    } while(--k);
+  }
+
+  twStep *= (int32_t) fstride;
+
+  switch (p)
+  {
+  case 2u:
+    riscv_cfft_mixed_radix2_f32(pOutBeg, pTw, twStep, m);
+    break;
+  case 3u:
+    riscv_cfft_mixed_radix3_f32(pOutBeg, pTw, twStep, m);
+    break;
+  case 4u:
+    riscv_cfft_mixed_radix4_f32(pOutBeg, pTw, twStep, m, ifftFlag);
+    break;
+  default:
+    riscv_cfft_mixed_radix5_f32(pOutBeg, pTw, twStep, m);
+    break;
+  }
+}
+
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @addtogroup ComplexFFT
+* @{
+*/
+
+/**
+* @details
+* @brief       Processing function for the floating-point mixed-radix complex FFT.
+* @param[in]      *S        points to an instance of the floating-point mixed-radix CFFT structure.
+* @param[in]      *pSrc     points to the complex input buffer of size <code>2*fftLen</code>. It is not modified.
+* @param[out]     *pDst     points to the complex output buffer of size <code>2*fftLen</code>.
+* @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @return none.
+*
+* \par
+* Supports every length that is a product of the factors 2, 3 and 5, e.g. 60, 120, 240, 480 and 960,
+* which riscv_cfft_f32() can only reach by zero padding to the next power of two.
+* The output is in natural order and, like riscv_cfft_f32(), the inverse transform is scaled by <code>1/fftLen</code>.
+* <code>pDst</code> must not overlap <code>pSrc</code>.
+* \par
+* The instance is initialized with riscv_cfft_mixed_init_f32().
+*/
+
+void riscv_cfft_mixed_f32(
+  const riscv_cfft_mixed_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint8_t ifftFlag)
+{
+  RISCV_PROFILE(riscv_cfft_mixed_f32);
+  uint32_t L = S->fftLen, l;
+  float32_t invL;
+
+  if(ifftFlag == 1u)
+  {
+    riscv_cfft_mixed_stage_f32(pDst, pSrc, 1u, S->factors, S->pTwiddle + (2u * L), -2, ifftFlag);
+
+    invL = 1.0f / (float32_t) L;
+    for(l = 0u; l < (2u * L); l++)
+    {
+      pDst[l] *= invL;
+    }
+  }
+  else
+  {
+    riscv_cfft_mixed_stage_f32(pDst, pSrc, 1u, S->factors, S->pTwiddle, 2, ifftFlag);
+  }
+}
+
+/**
+* @} end of ComplexFFT group
+*/
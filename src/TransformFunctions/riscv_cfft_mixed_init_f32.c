@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_mixed_init_f32.c
+*
+* Description:  Initialization function for the floating-point mixed-radix
+*               complex FFT.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point mixed-radix complex FFT.
+* @param[out]    *S         points to an instance of the floating-point mixed-radix CFFT structure.
+* @param[in]     fftLen     length of the FFT.
+* @param[out]    *pTwiddle  points to a buffer of <code>2*(fftLen+1)</code> words that receives the twiddle factors.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>fftLen</code> is not a product of the factors 2, 3 and 5.
+*
+* \par Description:
+* \par
+* <code>fftLen</code> is split into radix-4, radix-2, radix-3 and radix-5 stages, e.g. 60 = 4*3*5 or 960 = 4*4*4*3*5.
+* The radix-4 stages are taken first so that a power of two length uses the same number of stages as riscv_cfft_radix4_f32().
+* \par
+* The twiddle factors are computed into <code>pTwiddle</code> for the requested length only,
+* <code>pTwiddle[2*k]</code> = cos(2*pi*k/fftLen) and <code>pTwiddle[2*k+1]</code> = sin(2*pi*k/fftLen) for k = 0, 1, ..., fftLen.
+* The last entry lets the inverse transform walk the table backwards, so the same table serves both directions.
+* The buffer must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_cfft_mixed_init_f32(
+  riscv_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle)
+{
+  RISCV_PROFILE(riscv_cfft_mixed_init_f32);
+  uint32_t n = fftLen, p = 4u, k;
+  uint16_t numStages = 0u;
+  float32_t phase;
+
+  if(fftLen < 2u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  Factorize fftLen, radix-4 first, then 2, 3 and 5 */
+  while(n > 1u)
+  {
+    while((n % p) != 0u)
+    {
+      switch (p)
+      {
+      case 4u:
+        p = 2u;
+        break;
+      case 2u:
+        p = 3u;
+        break;
+      case 3u:
+        p = 5u;
+        break;
+      default:
+        /*  fftLen has a prime factor other than 2, 3 and 5 */
+        return (RISCV_MATH_ARGUMENT_ERROR);
+      }
+    }
+
+    n /= p;
+    S->factors[2u * numStages] = (uint16_t) p;
+    S->factors[(2u * numStages) + 1u] = (uint16_t) n;
+    numStages++;
+  }
+
+  /*  Compute the twiddle factors for the requested length */
+  for (k = 0u; k <= fftLen; k++)
+  {
+    phase = (6.28318530717959f * (float32_t) k) / (float32_t) fftLen;
+    pTwiddle[2u * k] = cosf(phase);
+    pTwiddle[(2u * k) + 1u] = sinf(phase);
+  }
+
+  S->fftLen = fftLen;
+  S->numStages = numStages;
+  S->pTwiddle = pTwiddle;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of ComplexFFT group
+*/
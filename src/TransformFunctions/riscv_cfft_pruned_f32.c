@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_pruned_f32.c
+*
+* Description:  Floating-point complex FFT of a zero-padded input
+*               restricted to a range of output bins.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup PrunedCFFT Pruned Complex FFT
+ *
+ * The pruned CFFT computes bins <code>firstBin</code> to <code>firstBin+numBins-1</code>, modulo
+ * <code>fftLen</code>, of the forward fftLen-point CFFT of an input whose samples from
+ * <code>inputLen</code> on are zero.  Neither the zeros nor the bins outside the range are stored.
+ *
+ * \par
+ * The transform is split into Q-point sub-transforms, P = fftLen/Q, run by riscv_cfft_f32() or
+ * riscv_cfft_q15(), and the sub-transforms that only touch zeros or unwanted bins are skipped.
+ * <ul>
+ * <li>Input split, for inputLen <= Q: X[r+P*s] is bin s of the Q-point transform of
+ *     x[n]*W<sub>N</sub><sup>n*r</sup>.  Only the residues r of the wanted bins are transformed.</li>
+ * <li>Output split: X[k] is the sum over p of W<sub>N</sub><sup>p*k</sup> times bin k mod Q of the
+ *     Q-point transform of x[p+P*m].  Only the sequences with a nonzero sample are transformed, a
+ *     sequence with a single one needs no transform at all.</li>
+ * </ul>
+ * riscv_cfft_pruned_init_f32() and riscv_cfft_pruned_init_q15() choose Q and the split with the
+ * least estimated work for the scratch buffer at hand.  For fftLen = 1024 and inputLen = 200 the
+ * estimate is 80% of the work of the full transform for 64 bins, 70% for 32 bins and 50% for 8 bins;
+ * the fewer samples and bins, the larger the saving.
+ *
+ * \par
+ * The pruned transforms are forward only and output in natural order.  The Q15 output is scaled by
+ * 1/fftLen like the output of riscv_cfft_q15().
+ */
+
+/**
+ * @addtogroup PrunedCFFT
+ * @{
+ */
+
+/**
+* @brief  Pruned floating-point complex FFT.
+* @param[in]      *S     points to an instance of the pruned floating-point CFFT structure.
+* @param[in]      *pSrc  points to the <code>inputLen</code> complex input samples.
+* @param[out]     *pDst  points to the <code>numBins</code> complex output bins.
+* @return none.
+*/
+
+void riscv_cfft_pruned_f32(
+  const riscv_cfft_pruned_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_cfft_pruned_f32);
+  uint32_t fftLen = S->fftLen;
+  uint32_t inputLen = S->inputLen;
+  uint32_t firstBin = S->firstBin;
+  uint32_t numBins = S->numBins;
+  uint32_t subLen = S->pSub->fftLen;
+  uint32_t numSub = fftLen / subLen;           /* P */
+  uint32_t log2Sub = 31u - __CLZ(numSub);
+  uint32_t qLen = fftLen >> 2u;
+  float32_t *pBuf = S->pScratch;
+  const float32_t *pY;
+  uint32_t p, m, j, k, e, n, mask, len;
+  float32_t co, si, yr, yi, xr, xi;
+
+  if(S->outputSplit != 0u)
+  {
+    riscv_fill_f32(0.0f, pDst, 2u * numBins);
+
+    for (p = 0u; (p < numSub) && (p < inputLen); p++)
+    {
+      /*  Number of nonzero samples of x[p+P*m] */
+      len = ((inputLen - p) + numSub - 1u) >> log2Sub;
+
+      if(len > 1u)
+      {
+        for (m = 0u, n = p; m < len; m++, n += numSub)
+        {
+          pBuf[2u * m] = pSrc[2u * n];
+          pBuf[(2u * m) + 1u] = pSrc[(2u * n) + 1u];
+        }
+        riscv_fill_f32(0.0f, &pBuf[2u * len], 2u * (subLen - len));
+
+        riscv_cfft_f32(S->pSub, pBuf, 0u, 1u);
+        pY = pBuf;
+        mask = subLen - 1u;
+      }
+      else
+      {
+        /*  The transform of a single sample at m = 0 is that sample in every bin */
+        pY = &pSrc[2u * p];
+        mask = 0u;
+      }
+
+      /*  X[k] += W^(p*k) * Y[k mod Q] */
+      k = firstBin;
+      e = (p * firstBin) & (fftLen - 1u);
+      for (j = 0u; j < numBins; j++)
+      {
+        riscv_twiddle_fold_f32(S->pTwiddle, qLen, e, &co, &si);
+        yr = pY[2u * (k & mask)];
+        yi = pY[(2u * (k & mask)) + 1u];
+        pDst[2u * j] += (yr * co) + (yi * si);
+        pDst[(2u * j) + 1u] += (yi * co) - (yr * si);
+
+        k++;
+        e = (e + p) & (fftLen - 1u);
+      }
+    }
+  }
+  else
+  {
+    for (p = 0u; p < numSub; p++)
+    {
+      /*  First wanted bin of residue p, skip the residue if there is none */
+      j = (p - firstBin) & (numSub - 1u);
+      if(j >= numBins)
+      {
+        continue;
+      }
+
+      /*  x[n] * W^(n*p), zero padded to Q */
+      e = 0u;
+      for (n = 0u; n < inputLen; n++)
+      {
+        riscv_twiddle_fold_f32(S->pTwiddle, qLen, e, &co, &si);
+        xr = pSrc[2u * n];
+        xi = pSrc[(2u * n) + 1u];
+        pBuf[2u * n] = (xr * co) + (xi * si);
+        pBuf[(2u * n) + 1u] = (xi * co) - (xr * si);
+
+        e = (e + p) & (fftLen - 1u);
+      }
+      riscv_fill_f32(0.0f, &pBuf[2u * inputLen], 2u * (subLen - inputLen));
+
+      riscv_cfft_f32(S->pSub, pBuf, 0u, 1u);
+
+      /*  Bin p+P*s of the transform is bin s of the sub-transform */
+      for (; j < numBins; j += numSub)
+      {
+        k = ((firstBin + j) & (fftLen - 1u)) >> log2Sub;
+        pDst[2u * j] = pBuf[2u * k];
+        pDst[(2u * j) + 1u] = pBuf[(2u * k) + 1u];
+      }
+    }
+  }
+}
+
+/**
+* @} end of PrunedCFFT group
+*/
@@ -0,0 +1,188 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_pruned_init_f32.c
+*
+* Description:  Initialization function for the pruned floating-point
+*               complex FFT.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+#include <riscv_dsp/riscv_const_structs.h>
+
+extern uint16_t riscv_cfft_pruned_plan(
+  uint32_t fftLen,
+  uint32_t inputLen,
+  uint32_t numBins,
+  uint32_t maxSubLenIn,
+  uint32_t maxSubLenOut,
+  uint8_t * pOutputSplit);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup PrunedCFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the pruned floating-point CFFT.
+* @param[out]    *S           points to an instance of the pruned floating-point CFFT structure.
+* @param[in]     fftLen       length of the transform, a power of two from 16 to 4096.
+* @param[in]     inputLen     number of input samples, from 1 to <code>fftLen</code>; the samples after them are zero.
+* @param[in]     firstBin     first output bin, less than <code>fftLen</code>.
+* @param[in]     numBins      number of output bins, from 1 to <code>fftLen</code>.
+* @param[in]     *pScratch    points to the scratch buffer.
+* @param[in]     scratchLen   length of the scratch buffer in words, at least 32.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* a parameter is not a supported value or the scratch buffer is too short.
+*
+* \par Description:
+* The plan only considers sub-transforms of length Q with <code>2*Q <= scratchLen</code>; a scratch
+* buffer of <code>2*fftLen</code> words lets the planner choose freely.  The chosen length is
+* <code>S->pSub->fftLen</code>.  The scratch buffer must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_cfft_pruned_init_f32(
+  riscv_cfft_pruned_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t inputLen,
+  uint16_t firstBin,
+  uint16_t numBins,
+  float32_t * pScratch,
+  uint32_t scratchLen)
+{
+  RISCV_PROFILE(riscv_cfft_pruned_init_f32);
+  uint16_t subLen;
+  uint8_t outputSplit;
+
+  if(((fftLen & (fftLen - 1u)) != 0u) || (fftLen < 16u) || (fftLen > 4096u) ||
+     (inputLen == 0u) || (inputLen > fftLen) || (firstBin >= fftLen) ||
+     (numBins == 0u) || (numBins > fftLen))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  subLen = riscv_cfft_pruned_plan(fftLen, inputLen, numBins, scratchLen >> 1u, scratchLen >> 1u, &outputSplit);
+
+  /*  Initialise the sub-transform */
+  switch (subLen)
+  {
+#if RISCV_DSP_FFT_LEN(16)
+  case 16u:
+    S->pSub = &riscv_cfft_sR_f32_len16;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(32)
+  case 32u:
+    S->pSub = &riscv_cfft_sR_f32_len32;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(64)
+  case 64u:
+    S->pSub = &riscv_cfft_sR_f32_len64;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(128)
+  case 128u:
+    S->pSub = &riscv_cfft_sR_f32_len128;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(256)
+  case 256u:
+    S->pSub = &riscv_cfft_sR_f32_len256;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(512)
+  case 512u:
+    S->pSub = &riscv_cfft_sR_f32_len512;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(1024)
+  case 1024u:
+    S->pSub = &riscv_cfft_sR_f32_len1024;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(2048)
+  case 2048u:
+    S->pSub = &riscv_cfft_sR_f32_len2048;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(4096)
+  case 4096u:
+    S->pSub = &riscv_cfft_sR_f32_len4096;
+    break;
+#endif
+  default:
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  Initialise the twiddle factors of the full length */
+  switch (fftLen)
+  {
+#if RISCV_DSP_FFT_LEN(16)
+  case 16u:
+    S->pTwiddle = twiddleCoefQuarter_16;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(32)
+  case 32u:
+    S->pTwiddle = twiddleCoefQuarter_32;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(64)
+  case 64u:
+    S->pTwiddle = twiddleCoefQuarter_64;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(128)
+  case 128u:
+    S->pTwiddle = twiddleCoefQuarter_128;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(256)
+  case 256u:
+    S->pTwiddle = twiddleCoefQuarter_256;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(512)
+  case 512u:
+    S->pTwiddle = twiddleCoefQuarter_512;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(1024)
+  case 1024u:
+    S->pTwiddle = twiddleCoefQuarter_1024;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(2048)
+  case 2048u:
+    S->pTwiddle = twiddleCoefQuarter_2048;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(4096)
+  case 4096u:
+    S->pTwiddle = twiddleCoefQuarter_4096;
+    break;
+#endif
+  default:
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->fftLen = fftLen;
+  S->inputLen = inputLen;
+  S->firstBin = firstBin;
+  S->numBins = numBins;
+  S->outputSplit = outputSplit;
+  S->pScratch = pScratch;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of PrunedCFFT group
+*/
@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_pruned_init_q15.c
+*
+* Description:  Initialization function for the pruned Q15 complex
+*               FFT.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+#include <riscv_dsp/riscv_const_structs.h>
+
+extern uint16_t riscv_cfft_pruned_plan(
+  uint32_t fftLen,
+  uint32_t inputLen,
+  uint32_t numBins,
+  uint32_t maxSubLenIn,
+  uint32_t maxSubLenOut,
+  uint8_t * pOutputSplit);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup PrunedCFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the pruned Q15 CFFT.
+* @param[out]    *S           points to an instance of the pruned Q15 CFFT structure.
+* @param[in]     fftLen       length of the transform, a power of two from 16 to 4096.
+* @param[in]     inputLen     number of input samples, from 1 to <code>fftLen</code>; the samples after them are zero.
+* @param[in]     firstBin     first output bin, less than <code>fftLen</code>.
+* @param[in]     numBins      number of output bins, from 1 to <code>fftLen</code>.
+* @param[in]     *pScratch    points to the scratch buffer.
+* @param[in]     scratchLen   length of the scratch buffer in Q15 values, at least 32.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* a parameter is not a supported value or the scratch buffer is too short.
+*
+* \par Description:
+* The plan only considers sub-transforms of length Q that fit the scratch buffer, <code>2*Q</code>
+* values for the input split and <code>2*Q+4*numBins</code> for the output split, which also keeps
+* Q31 accumulators of the bins there; a word aligned buffer of <code>2*fftLen+4*numBins</code>
+* values lets the planner choose freely.  The chosen length is
+* <code>S->pSub->fftLen</code>.  The scratch buffer must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_cfft_pruned_init_q15(
+  riscv_cfft_pruned_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t inputLen,
+  uint16_t firstBin,
+  uint16_t numBins,
+  q15_t * pScratch,
+  uint32_t scratchLen)
+{
+  RISCV_PROFILE(riscv_cfft_pruned_init_q15);
+  uint32_t maxOut;
+  uint16_t subLen;
+  uint8_t outputSplit;
+
+  if(((fftLen & (fftLen - 1u)) != 0u) || (fftLen < 16u) || (fftLen > 4096u) ||
+     (inputLen == 0u) || (inputLen > fftLen) || (firstBin >= fftLen) ||
+     (numBins == 0u) || (numBins > fftLen))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  maxOut = (scratchLen > (4u * (uint32_t) numBins)) ? ((scratchLen - (4u * (uint32_t) numBins)) >> 1u) : 0u;
+  subLen = riscv_cfft_pruned_plan(fftLen, inputLen, numBins, scratchLen >> 1u, maxOut, &outputSplit);
+
+  /*  Initialise the sub-transform */
+  switch (subLen)
+  {
+#if RISCV_DSP_FFT_LEN(16)
+  case 16u:
+    S->pSub = &riscv_cfft_sR_q15_len16;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(32)
+  case 32u:
+    S->pSub = &riscv_cfft_sR_q15_len32;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(64)
+  case 64u:
+    S->pSub = &riscv_cfft_sR_q15_len64;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(128)
+  case 128u:
+    S->pSub = &riscv_cfft_sR_q15_len128;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(256)
+  case 256u:
+    S->pSub = &riscv_cfft_sR_q15_len256;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(512)
+  case 512u:
+    S->pSub = &riscv_cfft_sR_q15_len512;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(1024)
+  case 1024u:
+    S->pSub = &riscv_cfft_sR_q15_len1024;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(2048)
+  case 2048u:
+    S->pSub = &riscv_cfft_sR_q15_len2048;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(4096)
+  case 4096u:
+    S->pSub = &riscv_cfft_sR_q15_len4096;
+    break;
+#endif
+  default:
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  Initialise the twiddle factors of the full length */
+  switch (fftLen)
+  {
+#if RISCV_DSP_FFT_LEN(16)
+  case 16u:
+    S->pTwiddle = twiddleCoefQuarter_16_q15;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(32)
+  case 32u:
+    S->pTwiddle = twiddleCoefQuarter_32_q15;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(64)
+  case 64u:
+    S->pTwiddle = twiddleCoefQuarter_64_q15;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(128)
+  case 128u:
+    S->pTwiddle = twiddleCoefQuarter_128_q15;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(256)
+  case 256u:
+    S->pTwiddle = twiddleCoefQuarter_256_q15;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(512)
+  case 512u:
+    S->pTwiddle = twiddleCoefQuarter_512_q15;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(1024)
+  case 1024u:
+    S->pTwiddle = twiddleCoefQuarter_1024_q15;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(2048)
+  case 2048u:
+    S->pTwiddle = twiddleCoefQuarter_2048_q15;
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(4096)
+  case 4096u:
+    S->pTwiddle = twiddleCoefQuarter_4096_q15;
+    break;
+#endif
+  default:
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  S->fftLen = fftLen;
+  S->inputLen = inputLen;
+  S->firstBin = firstBin;
+  S->numBins = numBins;
+  S->outputSplit = outputSplit;
+  S->pScratch = pScratch;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of PrunedCFFT group
+*/
@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_pruned_plan.c
+*
+* Description:  Planner of the pruned complex FFT.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup PrunedCFFT
+ * @{
+ */
+
+/**
+* @brief  Chooses the sub-transform length and split of a pruned CFFT.
+* @param[in]     fftLen        length of the transform.
+* @param[in]     inputLen      number of nonzero input samples.
+* @param[in]     numBins       number of output bins.
+* @param[in]     maxSubLenIn   longest sub-transform the scratch buffer holds for the input split.
+* @param[in]     maxSubLenOut  longest sub-transform the scratch buffer holds for the output split.
+* @param[out]    *pOutputSplit receives 1 for the output split, 0 for the input split.
+* @return        length of the sub-transforms, 0 when none fits the scratch buffer.
+*
+* \par
+* The estimated work of Q-point sub-transforms is Q*log2(Q) per sub-transform plus the twiddle
+* products, 2*inputLen for an input split and 2*numBins for an output split.  The input split runs
+* min(fftLen/Q, numBins) sub-transforms and needs Q >= inputLen, the output split runs
+* min(fftLen/Q, inputLen).  Shared by the floating-point and Q15 initialization functions.
+*/
+
+uint16_t riscv_cfft_pruned_plan(
+  uint32_t fftLen,
+  uint32_t inputLen,
+  uint32_t numBins,
+  uint32_t maxSubLenIn,
+  uint32_t maxSubLenOut,
+  uint8_t * pOutputSplit)
+{
+  uint32_t subLen, numSub, cost;
+  uint32_t bestLen = 0u, bestCost = 0xFFFFFFFFu;
+  uint32_t log2Len = 4u;
+  uint8_t bestSplit = 0u;
+
+  for (subLen = 16u; subLen <= fftLen; subLen <<= 1u)
+  {
+    /*  Input split, one sub-transform per residue of the wanted bins */
+    if((subLen >= inputLen) && (subLen <= maxSubLenIn))
+    {
+      numSub = fftLen / subLen;
+      numSub = (numSub < numBins) ? numSub : numBins;
+      cost = numSub * ((subLen * log2Len) + (2u * inputLen));
+
+      if(cost < bestCost)
+      {
+        bestCost = cost;
+        bestLen = subLen;
+        bestSplit = 0u;
+      }
+    }
+
+    /*  Output split, one sub-transform per nonzero interleaved input sequence */
+    if(subLen <= maxSubLenOut)
+    {
+      numSub = fftLen / subLen;
+      numSub = (numSub < inputLen) ? numSub : inputLen;
+      cost = numSub * ((subLen * log2Len) + (2u * numBins));
+
+      if(cost < bestCost)
+      {
+        bestCost = cost;
+        bestLen = subLen;
+        bestSplit = 1u;
+      }
+    }
+
+    log2Len++;
+  }
+
+  *pOutputSplit = bestSplit;
+
+  return ((uint16_t) bestLen);
+}
+
+/**
+* @} end of PrunedCFFT group
+*/
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_pruned_q15.c
+*
+* Description:  Q15 complex FFT of a zero-padded input restricted to a
+*               range of output bins.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup PrunedCFFT
+ * @{
+ */
+
+/**
+* @brief  Pruned Q15 complex FFT.
+* @param[in]      *S     points to an instance of the pruned Q15 CFFT structure.
+* @param[in]      *pSrc  points to the <code>inputLen</code> complex input samples.
+* @param[out]     *pDst  points to the <code>numBins</code> complex output bins, scaled by 1/fftLen.
+* @return none.
+*
+* \par
+* The sub-transforms scale by 1/Q like riscv_cfft_q15(), the remaining 1/P is applied to the sum of
+* the twiddled sub-transform bins, which the output split accumulates in Q31.
+*/
+
+void riscv_cfft_pruned_q15(
+  const riscv_cfft_pruned_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_cfft_pruned_q15);
+  uint32_t fftLen = S->fftLen;
+  uint32_t inputLen = S->inputLen;
+  uint32_t firstBin = S->firstBin;
+  uint32_t numBins = S->numBins;
+  uint32_t subLen = S->pSub->fftLen;
+  uint32_t numSub = fftLen / subLen;           /* P */
+  uint32_t log2Sub = 31u - __CLZ(numSub);
+  uint32_t qLen = fftLen >> 2u;
+  q15_t *pBuf = S->pScratch;
+  q31_t *pAcc = (q31_t *) &S->pScratch[2u * subLen];
+  const q15_t *pY;
+  uint32_t p, m, j, k, e, n, mask, len, shift;
+  q15_t co, si;
+  q31_t yr, yi, xr, xi;
+
+  if(S->outputSplit != 0u)
+  {
+    riscv_fill_q31(0, pAcc, 2u * numBins);
+
+    for (p = 0u; (p < numSub) && (p < inputLen); p++)
+    {
+      /*  Number of nonzero samples of x[p+P*m] */
+      len = ((inputLen - p) + numSub - 1u) >> log2Sub;
+
+      if(len > 1u)
+      {
+        for (m = 0u, n = p; m < len; m++, n += numSub)
+        {
+          pBuf[2u * m] = pSrc[2u * n];
+          pBuf[(2u * m) + 1u] = pSrc[(2u * n) + 1u];
+        }
+        riscv_fill_q15(0, &pBuf[2u * len], 2u * (subLen - len));
+
+        riscv_cfft_q15(S->pSub, pBuf, 0u, 1u);
+        pY = pBuf;
+        mask = subLen - 1u;
+        shift = 0u;
+      }
+      else
+      {
+        /*  The transform of a single sample at m = 0 is that sample in every bin, scaled by 1/Q */
+        pY = &pSrc[2u * p];
+        mask = 0u;
+        shift = 31u - __CLZ(subLen);
+      }
+
+      /*  X[k] += W^(p*k) * Y[k mod Q] */
+      k = firstBin;
+      e = (p * firstBin) & (fftLen - 1u);
+      for (j = 0u; j < numBins; j++)
+      {
+        riscv_twiddle_fold_q15(S->pTwiddle, qLen, e, &co, &si);
+        yr = (q31_t) pY[2u * (k & mask)] >> shift;
+        yi = (q31_t) pY[(2u * (k & mask)) + 1u] >> shift;
+        pAcc[2u * j] += ((yr * co) + (yi * si)) >> 15;
+        pAcc[(2u * j) + 1u] += ((yi * co) - (yr * si)) >> 15;
+
+        k++;
+        e = (e + p) & (fftLen - 1u);
+      }
+    }
+
+    /*  Remaining 1/P scaling */
+    for (j = 0u; j < (2u * numBins); j++)
+    {
+      pDst[j] = clip_q31_to_q15(pAcc[j] >> log2Sub);
+    }
+  }
+  else
+  {
+    for (p = 0u; p < numSub; p++)
+    {
+      /*  First wanted bin of residue p, skip the residue if there is none */
+      j = (p - firstBin) & (numSub - 1u);
+      if(j >= numBins)
+      {
+        continue;
+      }
+
+      /*  x[n] * W^(n*p), zero padded to Q */
+      e = 0u;
+      for (n = 0u; n < inputLen; n++)
+      {
+        riscv_twiddle_fold_q15(S->pTwiddle, qLen, e, &co, &si);
+        xr = pSrc[2u * n];
+        xi = pSrc[(2u * n) + 1u];
+        pBuf[2u * n] = clip_q31_to_q15(((xr * co) + (xi * si)) >> 15);
+        pBuf[(2u * n) + 1u] = clip_q31_to_q15(((xi * co) - (xr * si)) >> 15);
+
+        e = (e + p) & (fftLen - 1u);
+      }
+      riscv_fill_q15(0, &pBuf[2u * inputLen], 2u * (subLen - inputLen));
+
+      riscv_cfft_q15(S->pSub, pBuf, 0u, 1u);
+
+      /*  Bin p+P*s of the transform is bin s of the sub-transform, remaining 1/P scaling */
+      for (; j < numBins; j += numSub)
+      {
+        k = ((firstBin + j) & (fftLen - 1u)) >> log2Sub;
+        pDst[2u * j] = (q15_t) (pBuf[2u * k] >> log2Sub);
+        pDst[(2u * j) + 1u] = (q15_t) (pBuf[(2u * k) + 1u] >> log2Sub);
+      }
+    }
+  }
+}
+
+/**
+* @} end of PrunedCFFT group
+*/
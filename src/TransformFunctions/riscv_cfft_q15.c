@@ -41,6 +41,7 @@
 * -------------------------------------------------------------------- */
 
 #include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
 
 extern void riscv_radix4_butterfly_q15(
     q15_t * pSrc,
@@ -54,6 +55,36 @@ extern void riscv_radix4_butterfly_inverse_q15(
     q15_t * pCoef,
     uint32_t twidCoefModifier);
 
+extern void riscv_radix4_butterfly_oop_q15(
+    const q15_t * pIn,
+    q15_t * pSrc,
+    uint32_t fftLen,
+    q15_t * pCoef,
+    uint32_t twidCoefModifier);
+
+extern void riscv_radix4_butterfly_inverse_oop_q15(
+    const q15_t * pIn,
+    q15_t * pSrc,
+    uint32_t fftLen,
+    q15_t * pCoef,
+    uint32_t twidCoefModifier);
+
+extern void riscv_radix4_butterfly_batch_q15(
+    const q15_t * pIn,
+    q15_t * pSrc,
+    uint32_t fftLen,
+    q15_t * pCoef,
+    uint32_t twidCoefModifier,
+    uint32_t numBlocks);
+
+extern void riscv_radix4_butterfly_inverse_batch_q15(
+    const q15_t * pIn,
+    q15_t * pSrc,
+    uint32_t fftLen,
+    q15_t * pCoef,
+    uint32_t twidCoefModifier,
+    uint32_t numBlocks);
+
 extern void riscv_bitreversal_16(
     uint16_t * pSrc,
     const uint16_t bitRevLen,
@@ -64,10 +95,29 @@ void riscv_cfft_radix4by2_q15(
     uint32_t fftLen,
     const q15_t * pCoef);
     
+void riscv_cfft_radix4by2_oop_q15(
+    const q15_t * pIn,
+    q15_t * pSrc,
+    uint32_t fftLen,
+    const q15_t * pCoef);
+    
 void riscv_cfft_radix4by2_inverse_q15(
     q15_t * pSrc,
     uint32_t fftLen,
     const q15_t * pCoef);
+    
+void riscv_cfft_radix4by2_inverse_oop_q15(
+    const q15_t * pIn,
+    q15_t * pSrc,
+    uint32_t fftLen,
+    const q15_t * pCoef);
+
+static void riscv_cfft_radix4by2_batch_q15(
+    q15_t * pSrc,
+    uint32_t fftLen,
+    const q15_t * pCoef,
+    uint32_t numChannels,
+    uint8_t ifftFlag);
 
 /**   
 * @ingroup groupTransforms   
@@ -94,6 +144,7 @@ void riscv_cfft_q15(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag)
 {
+  RISCV_PROFILE(riscv_cfft_q15);
     uint32_t L = S->fftLen;
 
     if(ifftFlag == 1u)
@@ -141,6 +192,177 @@ void riscv_cfft_q15(
         riscv_bitreversal_16((uint16_t*)p1,S->bitRevLength,S->pBitRevTable);    
 }
 
+/**   
+* @details   
+* @brief       Out-of-place processing function for the Q15 complex FFT.
+* @param[in]      *S    points to an instance of the Q15 CFFT structure.  
+* @param[in]      *pSrc points to the complex input buffer of size <code>2*fftLen</code>. It is not modified.  
+* @param[out]     *pDst points to the complex output buffer of size <code>2*fftLen</code>.  
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.  
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.  
+* @return none.  
+*  
+* \par
+* Gives the same result in <code>pDst</code> as copying <code>pSrc</code> to <code>pDst</code> and calling riscv_cfft_q15() on it.   
+* The first butterfly stage reads straight from <code>pSrc</code>, so no copy pass is needed. <code>pDst</code> must not   
+* overlap <code>pSrc</code>.  
+*/
+
+void riscv_cfft_oop_q15( 
+    const riscv_cfft_instance_q15 * S, 
+    const q15_t * pSrc,
+    q15_t * pDst,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+  RISCV_PROFILE(riscv_cfft_oop_q15);
+    uint32_t L = S->fftLen;
+
+    if(ifftFlag == 1u)
+    {
+        switch (L) 
+        {
+        case 16: 
+        case 64:
+        case 256:
+        case 1024:
+        case 4096:
+            riscv_radix4_butterfly_inverse_oop_q15  ( pSrc, pDst, L, (q15_t*)S->pTwiddle, 1 );
+            break;
+            
+        case 32:
+        case 128:
+        case 512:
+        case 2048:
+            riscv_cfft_radix4by2_inverse_oop_q15  ( pSrc, pDst, L, S->pTwiddle );
+            break;
+        }  
+    }
+    else
+    {
+        switch (L) 
+        {
+        case 16: 
+        case 64:
+        case 256:
+        case 1024:
+        case 4096:
+            riscv_radix4_butterfly_oop_q15  ( pSrc, pDst, L, (q15_t*)S->pTwiddle, 1 );
+            break;
+            
+        case 32:
+        case 128:
+        case 512:
+        case 2048:
+            riscv_cfft_radix4by2_oop_q15  ( pSrc, pDst, L, S->pTwiddle );
+            break;
+        }  
+    }
+    
+    if( bitReverseFlag )
+        riscv_bitreversal_16((uint16_t*)pDst,S->bitRevLength,S->pBitRevTable);
+}
+
+/**   
+* @details   
+* @brief       Processing function for several Q15 complex FFTs of the same length.
+* @param[in]      *S           points to an instance of the Q15 CFFT structure.  
+* @param[in, out] *p1          points to the complex data of all channels, stored back to back: channel <code>c</code> uses <code>p1[2*fftLen*c]</code> to <code>p1[2*fftLen*(c+1) - 1]</code>. The processing occurs in-place.  
+* @param[in]     numChannels    number of channels.  
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.  
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.  
+* @return none.  
+*  
+* \par
+* Gives the same result as calling riscv_cfft_q15() on every channel.   
+* Every butterfly stage is run over all channels before the next stage starts, so the twiddle   
+* factors of a butterfly are loaded once for all channels and the loop setup of a stage is paid   
+* once per call instead of once per channel.   
+*/
+
+void riscv_cfft_batch_q15( 
+    const riscv_cfft_instance_q15 * S, 
+    q15_t * p1,
+    uint16_t numChannels,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+  RISCV_PROFILE(riscv_cfft_batch_q15);
+    uint32_t L = S->fftLen, c;
+
+    switch (L) 
+    {
+    case 16: 
+    case 64:
+    case 256:
+    case 1024:
+    case 4096:
+        if(ifftFlag == 1u)
+        {
+            riscv_radix4_butterfly_inverse_batch_q15  ( p1, p1, L, (q15_t*)S->pTwiddle, 1, numChannels );
+        }
+        else
+        {
+            riscv_radix4_butterfly_batch_q15  ( p1, p1, L, (q15_t*)S->pTwiddle, 1, numChannels );
+        }
+        break;
+        
+    case 32:
+    case 128:
+    case 512:
+    case 2048:
+        riscv_cfft_radix4by2_batch_q15  ( p1, L, S->pTwiddle, numChannels, ifftFlag );
+        break;
+    }  
+    
+    if( bitReverseFlag )
+    {
+        for(c = 0; c < numChannels; c++)
+        {
+            riscv_bitreversal_16((uint16_t*)(p1 + (2u * L * c)),S->bitRevLength,S->pBitRevTable);
+        }
+    }
+}
+
+/**   
+* @details   
+* @brief       Processing function for the Q15 complex FFT of a block floating-point vector.
+* @param[in]      *S      points to an instance of the Q15 CFFT structure.  
+* @param[in, out] *pBlock points to the block, <code>pBlock->pData</code> holds <code>2*fftLen</code> values and <code>pBlock->blockSize</code> is <code>2*fftLen</code>. Processing occurs in-place.  
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.  
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.  
+* @return none.  
+*  
+* \par
+* riscv_cfft_q15() scales the data down by 2 or 4 in every stage so that full scale inputs cannot overflow.
+* With a small input the scaling shifts out most of the significant bits.  This function first
+* normalizes the block with riscv_bfp_normalize_q15(), so the transform always starts from a full scale
+* input, and then accounts for the scaling in the exponent.  The forward transform divides the DFT by
+* <code>fftLen</code>, so the exponent is raised by log2(<code>fftLen</code>).  The inverse transform already
+* includes the 1/<code>fftLen</code> of the inverse DFT and leaves the exponent as it is after the normalization.
+* \par
+* The butterflies are the ones of riscv_cfft_q15(), they always scale, so the function cannot skip the
+* scaling of a stage that would not overflow.
+*/
+
+void riscv_cfft_bfp_q15( 
+    const riscv_cfft_instance_q15 * S, 
+    riscv_bfp_q15 * pBlock,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+  RISCV_PROFILE(riscv_cfft_bfp_q15);
+    riscv_bfp_normalize_q15(pBlock);
+
+    riscv_cfft_q15(S, pBlock->pData, ifftFlag, bitReverseFlag);
+
+    if(ifftFlag == 0u)
+    {
+        /* fftLen is a power of two */
+        pBlock->exponent += (int16_t) (31u - __CLZ(S->fftLen));
+    }
+}
+
 /**    
 * @} end of ComplexFFT group    
 */
@@ -149,6 +371,16 @@ void riscv_cfft_radix4by2_q15(
     q15_t * pSrc,
     uint32_t fftLen,
     const q15_t * pCoef) 
+{    
+    riscv_cfft_radix4by2_oop_q15( pSrc, pSrc, fftLen, pCoef);
+}
+
+/* Same as riscv_cfft_radix4by2_q15, with the first stage reading from pIn; pIn may be equal to pSrc */
+void riscv_cfft_radix4by2_oop_q15(
+    const q15_t * pIn,
+    q15_t * pSrc,
+    uint32_t fftLen,
+    const q15_t * pCoef) 
 {    
     uint32_t i;
     uint32_t n2;
@@ -167,18 +399,22 @@ void riscv_cfft_radix4by2_q15(
     ia = 0;
     for (i = 0; i < n2; i++)
     {
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+        riscv_twiddle_fold_q15(pCoef, fftLen >> 2u, ia, &cosVal, &sinVal);
+#else
         cosVal = pCoef[ia * 2];
         sinVal = pCoef[(ia * 2) + 1];
+#endif
         ia++;
         
         l = i + n2;        
         
-        xt = (pSrc[2 * i] >> 1u) - (pSrc[2 * l] >> 1u);
-        pSrc[2 * i] = ((pSrc[2 * i] >> 1u) + (pSrc[2 * l] >> 1u)) >> 1u;
+        xt = (pIn[2 * i] >> 1u) - (pIn[2 * l] >> 1u);
+        pSrc[2 * i] = ((pIn[2 * i] >> 1u) + (pIn[2 * l] >> 1u)) >> 1u;
         
-        yt = (pSrc[2 * i + 1] >> 1u) - (pSrc[2 * l + 1] >> 1u);
+        yt = (pIn[2 * i + 1] >> 1u) - (pIn[2 * l + 1] >> 1u);
         pSrc[2 * i + 1] =
-        ((pSrc[2 * l + 1] >> 1u) + (pSrc[2 * i + 1] >> 1u)) >> 1u;
+        ((pIn[2 * l + 1] >> 1u) + (pIn[2 * i + 1] >> 1u)) >> 1u;
 
         pSrc[2u * l] = (((int16_t) (((q31_t) xt * cosVal) >> 16)) +
                   ((int16_t) (((q31_t) yt * sinVal) >> 16)));
@@ -227,6 +463,16 @@ void riscv_cfft_radix4by2_inverse_q15(
     q15_t * pSrc,
     uint32_t fftLen,
     const q15_t * pCoef) 
+{    
+    riscv_cfft_radix4by2_inverse_oop_q15( pSrc, pSrc, fftLen, pCoef);
+}
+
+/* Same as riscv_cfft_radix4by2_inverse_q15, with the first stage reading from pIn; pIn may be equal to pSrc */
+void riscv_cfft_radix4by2_inverse_oop_q15(
+    const q15_t * pIn,
+    q15_t * pSrc,
+    uint32_t fftLen,
+    const q15_t * pCoef) 
 {    
     uint32_t i;
     uint32_t n2;
@@ -241,17 +487,21 @@ void riscv_cfft_radix4by2_inverse_q15(
     ia = 0;
     for (i = 0; i < n2; i++)
     {
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+        riscv_twiddle_fold_q15(pCoef, fftLen >> 2u, ia, &cosVal, &sinVal);
+#else
         cosVal = pCoef[ia * 2];
         sinVal = pCoef[(ia * 2) + 1];
+#endif
         ia++;
         
         l = i + n2;
-        xt = (pSrc[2 * i] >> 1u) - (pSrc[2 * l] >> 1u);
-        pSrc[2 * i] = ((pSrc[2 * i] >> 1u) + (pSrc[2 * l] >> 1u)) >> 1u;
+        xt = (pIn[2 * i] >> 1u) - (pIn[2 * l] >> 1u);
+        pSrc[2 * i] = ((pIn[2 * i] >> 1u) + (pIn[2 * l] >> 1u)) >> 1u;
         
-        yt = (pSrc[2 * i + 1] >> 1u) - (pSrc[2 * l + 1] >> 1u);
+        yt = (pIn[2 * i + 1] >> 1u) - (pIn[2 * l + 1] >> 1u);
         pSrc[2 * i + 1] =
-          ((pSrc[2 * l + 1] >> 1u) + (pSrc[2 * i + 1] >> 1u)) >> 1u;
+          ((pIn[2 * l + 1] >> 1u) + (pIn[2 * i + 1] >> 1u)) >> 1u;
         
         pSrc[2u * l] = (((int16_t) (((q31_t) xt * cosVal) >> 16)) -
                         ((int16_t) (((q31_t) yt * sinVal) >> 16)));
@@ -285,3 +535,107 @@ void riscv_cfft_radix4by2_inverse_q15(
     }
 }
 
+/* Radix-2 first stage of every channel, then the radix-4 stages of all columns */
+static void riscv_cfft_radix4by2_batch_q15(
+    q15_t * pSrc,
+    uint32_t fftLen,
+    const q15_t * pCoef,
+    uint32_t numChannels,
+    uint8_t ifftFlag) 
+{    
+    uint32_t i, c;
+    uint32_t n2;
+    uint32_t total = fftLen * numChannels;
+    q15_t p0, p1, p2, p3;
+
+    uint32_t ia, l;
+    q15_t xt, yt, cosVal, sinVal;
+    q15_t *pS;
+#if defined (USE_DSP_RISCV)
+    shortV VectInB;
+    shortV *VectInC;
+#endif
+    n2 = fftLen >> 1; 
+
+    ia = 0;
+    for (i = 0; i < n2; i++)
+    {
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+        riscv_twiddle_fold_q15(pCoef, fftLen >> 2u, ia, &cosVal, &sinVal);
+#else
+        cosVal = pCoef[ia * 2];
+        sinVal = pCoef[(ia * 2) + 1];
+#endif
+        ia++;
+        
+        l = i + n2;        
+
+        /* The same butterfly of every channel */
+        for (c = 0; c < numChannels; c++)
+        {
+            pS = pSrc + (2u * fftLen * c);
+
+            xt = (pS[2 * i] >> 1u) - (pS[2 * l] >> 1u);
+            pS[2 * i] = ((pS[2 * i] >> 1u) + (pS[2 * l] >> 1u)) >> 1u;
+            
+            yt = (pS[2 * i + 1] >> 1u) - (pS[2 * l + 1] >> 1u);
+            pS[2 * i + 1] =
+            ((pS[2 * l + 1] >> 1u) + (pS[2 * i + 1] >> 1u)) >> 1u;
+
+            if(ifftFlag == 1u)
+            {
+                pS[2u * l] = (((int16_t) (((q31_t) xt * cosVal) >> 16)) -
+                              ((int16_t) (((q31_t) yt * sinVal) >> 16)));
+
+                pS[2u * l + 1u] = (((int16_t) (((q31_t) yt * cosVal) >> 16)) +
+                                   ((int16_t) (((q31_t) xt * sinVal) >> 16)));
+            }
+            else
+            {
+                pS[2u * l] = (((int16_t) (((q31_t) xt * cosVal) >> 16)) +
+                              ((int16_t) (((q31_t) yt * sinVal) >> 16)));
+
+                pS[2u * l + 1u] = (((int16_t) (((q31_t) yt * cosVal) >> 16)) -
+                                   ((int16_t) (((q31_t) xt * sinVal) >> 16)));
+            }
+        }
+    } 
+
+    // both columns of every channel
+    if(ifftFlag == 1u)
+    {
+        riscv_radix4_butterfly_inverse_batch_q15( pSrc, pSrc, n2, (q15_t*)pCoef, 2u, 2u * numChannels);
+    }
+    else
+    {
+        riscv_radix4_butterfly_batch_q15( pSrc, pSrc, n2, (q15_t*)pCoef, 2u, 2u * numChannels);
+    }
+
+#if defined (USE_DSP_RISCV)
+    VectInB = pack2(1,1);	
+#endif	
+    for (i = 0; i < total >> 1; i++)
+    {
+#if defined (USE_DSP_RISCV)
+        VectInC = (shortV*)(pSrc + 4*i);
+        *VectInC = sll2(*VectInC,VectInB);
+        VectInC = (shortV*)(pSrc + 4*i + 2);
+        *VectInC = sll2(*VectInC,VectInB);
+#else
+        p0 = pSrc[4*i+0];
+        p1 = pSrc[4*i+1];
+        p2 = pSrc[4*i+2];
+        p3 = pSrc[4*i+3];
+        
+        p0 <<= 1;
+        p1 <<= 1;
+        p2 <<= 1;
+        p3 <<= 1;
+        
+        pSrc[4*i+0] = p0;
+        pSrc[4*i+1] = p1;
+        pSrc[4*i+2] = p2;
+        pSrc[4*i+3] = p3;
+#endif
+    }
+}
@@ -42,32 +42,17 @@
 
 #include <riscv_dsp/riscv_math.h>
 
-extern void riscv_radix4_butterfly_q31(
+extern void riscv_cfft_radix8_q31(
+    const q31_t * pIn,
     q31_t * pSrc,
     uint32_t fftLen,
-    q31_t * pCoef,
-    uint32_t twidCoefModifier);
-
-extern void riscv_radix4_butterfly_inverse_q31(
-    q31_t * pSrc,
-    uint32_t fftLen,
-    q31_t * pCoef,
-    uint32_t twidCoefModifier);
+    const q31_t * pCoef,
+    uint8_t ifftFlag);
 
 extern void riscv_bitreversal_32(
     uint32_t * pSrc,
     const uint16_t bitRevLen,
     const uint16_t * pBitRevTable);
-    
-void riscv_cfft_radix4by2_q31(
-    q31_t * pSrc,
-    uint32_t fftLen,
-    const q31_t * pCoef);
-    
-void riscv_cfft_radix4by2_inverse_q31(
-    q31_t * pSrc,
-    uint32_t fftLen,
-    const q31_t * pCoef);
 
 /**   
 * @ingroup groupTransforms   
@@ -94,173 +79,45 @@ void riscv_cfft_q31(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag)
 {
-    uint32_t L = S->fftLen;
+  RISCV_PROFILE(riscv_cfft_q31);
 
-    if(ifftFlag == 1u)
-    {
-        switch (L) 
-        {
-        case 16: 
-        case 64:
-        case 256:
-        case 1024:
-        case 4096:
-            riscv_radix4_butterfly_inverse_q31  ( p1, L, (q31_t*)S->pTwiddle, 1 );
-            break;
-            
-        case 32:
-        case 128:
-        case 512:
-        case 2048:
-            riscv_cfft_radix4by2_inverse_q31  ( p1, L, S->pTwiddle );
-            break;
-        }  
-    }
-    else
-    {
-        switch (L) 
-        {
-        case 16: 
-        case 64:
-        case 256:
-        case 1024:
-        case 4096:
-            riscv_radix4_butterfly_q31  ( p1, L, (q31_t*)S->pTwiddle, 1 );
-            break;
-            
-        case 32:
-        case 128:
-        case 512:
-        case 2048:
-            riscv_cfft_radix4by2_q31  ( p1, L, S->pTwiddle );
-            break;
-        }  
-    }
+    riscv_cfft_radix8_q31( p1, p1, S->fftLen, S->pTwiddle, (ifftFlag == 1u) ? 1u : 0u );
     
     if( bitReverseFlag )
         riscv_bitreversal_32((uint32_t*)p1,S->bitRevLength,S->pBitRevTable);    
 }
 
-/**    
-* @} end of ComplexFFT group    
+/**   
+* @details   
+* @brief       Out-of-place processing function for the Q31 complex FFT.
+* @param[in]      *S    points to an instance of the Q31 CFFT structure.  
+* @param[in]      *pSrc points to the complex input buffer of size <code>2*fftLen</code>. It is not modified.  
+* @param[out]     *pDst points to the complex output buffer of size <code>2*fftLen</code>.  
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.  
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.  
+* @return none.  
+*  
+* \par
+* Gives the same result in <code>pDst</code> as copying <code>pSrc</code> to <code>pDst</code> and calling riscv_cfft_q31() on it.   
+* The first butterfly stage reads straight from <code>pSrc</code>, so no copy pass is needed. <code>pDst</code> must not   
+* overlap <code>pSrc</code>.  
 */
 
-void riscv_cfft_radix4by2_q31(
-    q31_t * pSrc,
-    uint32_t fftLen,
-    const q31_t * pCoef) 
-{    
-    uint32_t i, l;
-    uint32_t n2, ia;
-    q31_t xt, yt, cosVal, sinVal;
-    q31_t p0, p1;
-    
-    n2 = fftLen >> 1;    
-    ia = 0;
-    for (i = 0; i < n2; i++)
-    {
-        cosVal = pCoef[2*ia];
-        sinVal = pCoef[2*ia + 1];
-        ia++;
-        
-        l = i + n2;
-        xt = (pSrc[2 * i] >> 2) - (pSrc[2 * l] >> 2);
-        pSrc[2 * i] = (pSrc[2 * i] >> 2) + (pSrc[2 * l] >> 2);
-        
-        yt = (pSrc[2 * i + 1] >> 2) - (pSrc[2 * l + 1] >> 2);
-        pSrc[2 * i + 1] = (pSrc[2 * l + 1] >> 2) + (pSrc[2 * i + 1] >> 2);
-        
-        mult_32x32_keep32_R(p0, xt, cosVal);
-        mult_32x32_keep32_R(p1, yt, cosVal);
-        multAcc_32x32_keep32_R(p0, yt, sinVal); 
-        multSub_32x32_keep32_R(p1, xt, sinVal);
-        
-        pSrc[2u * l] = p0 << 1;
-        pSrc[2u * l + 1u] = p1 << 1;
-    
-    }
-
-    // first col
-    riscv_radix4_butterfly_q31( pSrc, n2, (q31_t*)pCoef, 2u);
-    // second col
-    riscv_radix4_butterfly_q31( pSrc + fftLen, n2, (q31_t*)pCoef, 2u);
-			
-    for (i = 0; i < fftLen >> 1; i++)
-    {
-        p0 = pSrc[4*i+0];
-        p1 = pSrc[4*i+1];
-        xt = pSrc[4*i+2];
-        yt = pSrc[4*i+3];
-        
-        p0 <<= 1;
-        p1 <<= 1;
-        xt <<= 1;
-        yt <<= 1;
-        
-        pSrc[4*i+0] = p0;
-        pSrc[4*i+1] = p1;
-        pSrc[4*i+2] = xt;
-        pSrc[4*i+3] = yt;
-    }
-
-}
+void riscv_cfft_oop_q31( 
+    const riscv_cfft_instance_q31 * S, 
+    const q31_t * pSrc,
+    q31_t * pDst,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+  RISCV_PROFILE(riscv_cfft_oop_q31);
 
-void riscv_cfft_radix4by2_inverse_q31(
-    q31_t * pSrc,
-    uint32_t fftLen,
-    const q31_t * pCoef) 
-{    
-    uint32_t i, l;
-    uint32_t n2, ia;
-    q31_t xt, yt, cosVal, sinVal;
-    q31_t p0, p1;
+    riscv_cfft_radix8_q31( pSrc, pDst, S->fftLen, S->pTwiddle, (ifftFlag == 1u) ? 1u : 0u );
     
-    n2 = fftLen >> 1;    
-    ia = 0;
-    for (i = 0; i < n2; i++)
-    {
-        cosVal = pCoef[2*ia];
-        sinVal = pCoef[2*ia + 1];
-        ia++;
-        
-        l = i + n2;
-        xt = (pSrc[2 * i] >> 2) - (pSrc[2 * l] >> 2);
-        pSrc[2 * i] = (pSrc[2 * i] >> 2) + (pSrc[2 * l] >> 2);
-        
-        yt = (pSrc[2 * i + 1] >> 2) - (pSrc[2 * l + 1] >> 2);
-        pSrc[2 * i + 1] = (pSrc[2 * l + 1] >> 2) + (pSrc[2 * i + 1] >> 2);
-        
-        mult_32x32_keep32_R(p0, xt, cosVal);
-        mult_32x32_keep32_R(p1, yt, cosVal);
-        multSub_32x32_keep32_R(p0, yt, sinVal); 
-        multAcc_32x32_keep32_R(p1, xt, sinVal);
-        
-        pSrc[2u * l] = p0 << 1;
-        pSrc[2u * l + 1u] = p1 << 1;
-    
-    }
-
-    // first col
-    riscv_radix4_butterfly_inverse_q31( pSrc, n2, (q31_t*)pCoef, 2u);
-    // second col
-    riscv_radix4_butterfly_inverse_q31( pSrc + fftLen, n2, (q31_t*)pCoef, 2u);
-			
-    for (i = 0; i < fftLen >> 1; i++)
-    {
-        p0 = pSrc[4*i+0];
-        p1 = pSrc[4*i+1];
-        xt = pSrc[4*i+2];
-        yt = pSrc[4*i+3];
-        
-        p0 <<= 1;
-        p1 <<= 1;
-        xt <<= 1;
-        yt <<= 1;
-        
-        pSrc[4*i+0] = p0;
-        pSrc[4*i+1] = p1;
-        pSrc[4*i+2] = xt;
-        pSrc[4*i+3] = yt;
-    }
+    if( bitReverseFlag )
+        riscv_bitreversal_32((uint32_t*)pDst,S->bitRevLength,S->pBitRevTable);
 }
 
+/**    
+* @} end of ComplexFFT group    
+*/
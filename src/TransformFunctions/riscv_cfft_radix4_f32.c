@@ -431,6 +431,7 @@ void riscv_cfft_radix4_f32(
 const riscv_cfft_radix4_instance_f32 * S,
 float32_t * pSrc)
 {
+  RISCV_PROFILE(riscv_cfft_radix4_f32);
 
    if(S->ifftFlag == 1u)
    {
@@ -82,6 +82,7 @@ riscv_status riscv_cfft_radix4_init_f32(
   uint8_t ifftFlag,
   uint8_t bitReverseFlag)
 {
+  RISCV_PROFILE(riscv_cfft_radix4_init_f32);
   /*  Initialise the default riscv status */
   riscv_status status = RISCV_MATH_SUCCESS;
 
@@ -82,12 +82,13 @@ riscv_status riscv_cfft_radix4_init_q15(
   uint8_t ifftFlag,
   uint8_t bitReverseFlag)
 {
+  RISCV_PROFILE(riscv_cfft_radix4_init_q15);
   /*  Initialise the default riscv status */
   riscv_status status = RISCV_MATH_SUCCESS;
   /*  Initialise the FFT length */
   S->fftLen = fftLen;
   /*  Initialise the Twiddle coefficient pointer */
-  S->pTwiddle = (q15_t *) twiddleCoef_4096_q15;
+  S->pTwiddle = (q15_t *) RISCV_CFFT_TWIDDLE_Q15(4096);
   /*  Initialise the Flag for selection of CFFT or CIFFT */
   S->ifftFlag = ifftFlag;
   /*  Initialise the Flag for calculation Bit reversal or not */
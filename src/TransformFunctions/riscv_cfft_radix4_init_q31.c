@@ -81,6 +81,7 @@ riscv_status riscv_cfft_radix4_init_q31(
   uint8_t ifftFlag,
   uint8_t bitReverseFlag)
 {
+  RISCV_PROFILE(riscv_cfft_radix4_init_q31);
   /*  Initialise the default riscv status */
   riscv_status status = RISCV_MATH_SUCCESS;
   /*  Initialise the FFT length */
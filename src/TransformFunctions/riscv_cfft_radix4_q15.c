@@ -42,6 +42,7 @@
 * -------------------------------------------------------------------- */
 
 #include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
 
 
 void riscv_radix4_butterfly_q15(
@@ -56,12 +57,80 @@ void riscv_radix4_butterfly_inverse_q15(
   q15_t * pCoef16,
   uint32_t twidCoefModifier);
 
+void riscv_radix4_butterfly_oop_q15(
+  const q15_t * pIn16,
+  q15_t * pSrc16,
+  uint32_t fftLen,
+  q15_t * pCoef16,
+  uint32_t twidCoefModifier);
+
+void riscv_radix4_butterfly_inverse_oop_q15(
+  const q15_t * pIn16,
+  q15_t * pSrc16,
+  uint32_t fftLen,
+  q15_t * pCoef16,
+  uint32_t twidCoefModifier);
+
+void riscv_radix4_butterfly_batch_q15(
+  const q15_t * pIn16,
+  q15_t * pSrc16,
+  uint32_t fftLen,
+  q15_t * pCoef16,
+  uint32_t twidCoefModifier,
+  uint32_t numBlocks);
+
+void riscv_radix4_butterfly_inverse_batch_q15(
+  const q15_t * pIn16,
+  q15_t * pSrc16,
+  uint32_t fftLen,
+  q15_t * pCoef16,
+  uint32_t twidCoefModifier,
+  uint32_t numBlocks);
+
 void riscv_bitreversal_q15(
   q15_t * pSrc,
   uint32_t fftLen,
   uint16_t bitRevFactor,
   uint16_t * pBitRevTab);
 
+/*    
+ * Twiddle factor k of the table of riscv_radix4_butterfly_q15(), k < 4*qLen.    
+ * With RISCV_MATH_COMPACT_TWIDDLE the table holds the qLen+1 values of the    
+ * first quadrant cos, and the pair is folded from it.    
+ */
+#if defined (USE_DSP_RISCV)
+static inline shortV riscv_radix4_twiddle_q15(
+  const q15_t * pCoef16,
+  uint32_t qLen,
+  uint32_t k)
+{
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+  q15_t co, si;
+
+  riscv_twiddle_fold_q15(pCoef16, qLen, k, &co, &si);
+
+  return (pack2(co, si));
+#else
+  return (((const shortV *) pCoef16)[k]);
+#endif
+}
+#else
+static inline void riscv_radix4_twiddle_co_si_q15(
+  const q15_t * pCoef16,
+  uint32_t qLen,
+  uint32_t k,
+  q15_t * pCo,
+  q15_t * pSi)
+{
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+  riscv_twiddle_fold_q15(pCoef16, qLen, k, pCo, pSi);
+#else
+  *pCo = pCoef16[2u * k];
+  *pSi = pCoef16[(2u * k) + 1u];
+#endif
+}
+#endif
+
 /**    
  * @ingroup groupTransforms    
  */
@@ -94,6 +163,7 @@ void riscv_cfft_radix4_q15(
   const riscv_cfft_radix4_instance_q15 * S,
   q15_t * pSrc)
 {
+  RISCV_PROFILE(riscv_cfft_radix4_q15);
   if(S->ifftFlag == 1u)
   {
     /*  Complex IFFT radix-4  */
@@ -167,16 +237,57 @@ void riscv_radix4_butterfly_q15(
   uint32_t fftLen,
   q15_t * pCoef16,
   uint32_t twidCoefModifier)
+{
+  riscv_radix4_butterfly_oop_q15(pSrc16, pSrc16, fftLen, pCoef16, twidCoefModifier);
+}
+
+/**    
+ * @brief  Q15 CFFT butterfly process of several transforms, reading the first stage inputs from a separate buffer.   
+ * @param[in]      *pIn16           points to the input buffer, only read by the first stage. It may be equal to pSrc16.   
+ * @param[out]     *pSrc16          points to the buffer that holds the result, of Q15 data type.   
+ * @param[in]      fftLen           length of the FFT.   
+ * @param[in]      *pCoef16         points to twiddle coefficient buffer.   
+ * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.   
+ * @param[in]      numBlocks        number of transforms of fftLen samples stored back to back in pIn16 and pSrc16.   
+ * @return none.   
+ *   
+ * Every stage runs a butterfly group over all blocks with the same twiddle factors,   
+ * so the twiddle loads and the loop setup of a stage are shared by the blocks.   
+ */
+
+RISCV_DSP_FASTCODE(riscv_radix4_butterfly_batch_q15)
+void riscv_radix4_butterfly_batch_q15(
+  const q15_t * pIn16,
+  q15_t * pSrc16,
+  uint32_t fftLen,
+  q15_t * pCoef16,
+  uint32_t twidCoefModifier,
+  uint32_t numBlocks)
 {
 #if defined (USE_DSP_RISCV)
 
-  q15_t R0, R1, S0, S1, T0, T1, U0, U1;
-  q15_t Co1, Si1, Co2, Si2, Co3, Si3, out1, out2;
+  shortV *pSi = (shortV *) pSrc16;               /* Complex samples as packed (real, imag) pairs */
+  const shortV *pIn = (const shortV *) pIn16;    /* First stage inputs as packed pairs */
+  shortV A, B, C, D;                             /* Butterfly inputs */
+  shortV R, S, T, Tj;                            /* Butterfly intermediate values */
+  shortV W1, W2, W3;                             /* Twiddle coefficients (co, si) */
+  shortV W1r, W2r, W3r;                          /* Rotated twiddle coefficients (-si, co) */
+  shortV one = { 1, 1 };                         /* Shift by 1 on both halves */
+  shortV two = { 2, 2 };                         /* Shift by 2 on both halves */
+  shortV rotJ = { 1, 2 };                        /* Shuffle mask for (T1, -T0) */
+  shortV rotW = { 3, 0 };                        /* Shuffle mask for (-si, co) */
+  shortV wMin = { -32767, -32767 };              /* Keeps -si in range for si = -1.0 */
   uint32_t n1, n2, ic, i0, i1, i2, i3, j, k;
-  shortV VectInA;
-  shortV VectInB;
-  shortV VectInC;
-  shortV VectInD;
+  uint32_t totalLen = fftLen * numBlocks;
+  uint32_t qLen = (fftLen * twidCoefModifier) >> 2u;   /* Quarter-wave length of the twiddle table */
+
+  /* Every complex sample is handled as one packed shortV, so the butterfly    
+   * sums are done with packed add/sub and the twiddle multiplies with dotpv2:    
+   * real' = (co * real + si * imag) >> 16, imag' = (-si * real + co * imag) >> 16.    
+   * The negated sine is limited to 0x7FFF, so twiddles with si = -1.0 can    
+   * differ from the scalar path by one LSB. The packed adds are not    
+   * saturating; the down scaling done in every stage keeps the sums in range    
+   * for inputs with a magnitude below 1.0. */
 
   /* Total process is divided into three stages */
 
@@ -192,8 +303,7 @@ void riscv_radix4_butterfly_q15(
   /* Index for twiddle coefficient */
   ic = 0u;
 
-  /* Index for input read and output write */
-  i0 = 0u;
+  /* Butterfly counter */
   j = n2;
 
   /* Input is in 1.15(q15) format */
@@ -201,156 +311,68 @@ void riscv_radix4_butterfly_q15(
   /*  start of first stage process */
   do
   {
-    /*  Butterfly implementation */
-
-    /*  index calculation for the input as, */
-    /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
-    i1 = i0 + n2;
-    i2 = i1 + n2;
-    i3 = i2 + n2;
-
-    /*  Reading i0, i0+fftLen/2 inputs */
-
-    /* input is down scale by 4 to avoid overflow */
-    /* Read ya (real), xa(imag) input */
-    T0 = pSrc16[i0 * 2u] >> 2u;
-    T1 = pSrc16[(i0 * 2u) + 1u] >> 2u;
-
-    /* input is down scale by 4 to avoid overflow */
-    /* Read yc (real), xc(imag) input */
-    S0 = pSrc16[i2 * 2u] >> 2u;
-    S1 = pSrc16[(i2 * 2u) + 1u] >> 2u;
-
-    /* R0 = (ya + yc) */
-    R0 = clip(T0 + S0, -32768,32767);
-    /* R1 = (xa + xc) */
-    R1 = clip(T1 + S1, -32768,32767);
-
-    /* S0 = (ya - yc) */
-    S0 = clip(T0 - S0, -32768,32767);
-    /* S1 = (xa - xc) */
-    S1 = clip(T1 - S1,-32768,32767);;
-
-    /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
-    /* input is down scale by 4 to avoid overflow */
-    /* Read yb (real), xb(imag) input */
-    T0 = pSrc16[i1 * 2u] >> 2u;
-    T1 = pSrc16[(i1 * 2u) + 1u] >> 2u;
-
-    /* input is down scale by 4 to avoid overflow */
-    /* Read yd (real), xd(imag) input */
-    U0 = pSrc16[i3 * 2u] >> 2u;
-    U1 = pSrc16[(i3 * 2u) + 1] >> 2u;
-
-    /* T0 = (yb + yd) */
-    T0 = clip(T0 + U0, -32768,32767);
-    /* T1 = (xb + xd) */
-    T1 = clip(T1 + U1, -32768,32767);
-
-    /*  writing the butterfly processed i0 sample */
-    /* ya' = ya + yb + yc + yd */
-    /* xa' = xa + xb + xc + xd */
-    pSrc16[i0 * 2u] = (R0 >> 1u) + (T0 >> 1u);
-    pSrc16[(i0 * 2u) + 1u] = (R1 >> 1u) + (T1 >> 1u);
-
-    /* R0 = (ya + yc) - (yb + yd) */
-    /* R1 = (xa + xc) - (xb + xd) */
-    R0 = clip(R0 - T0, -32768,32767);
-    R1 = clip(R1 - T1, -32768,32767);
-
-    /* co2 & si2 are read from Coefficient pointer */
-   // Co2 = pCoef16[2u * ic * 2u];
-   // Si2 = pCoef16[(2u * ic * 2u) + 1];
-    VectInA = *(shortV*)(pCoef16 + (2u * ic * 2u));
-    VectInB[0] = R0;
-    VectInB[1] = R1;
-    /* xc' = (xa-xb+xc-xd)* co2 + (ya-yb+yc-yd)* (si2) */
-   // out1 = (q15_t) ((Co2 * R0 + Si2 * R1) >> 16u);
-    /* yc' = (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2) */
-   // out2 = (q15_t) ((-Si2 * R0 + Co2 * R1) >> 16u);
-    out1 = dotpv2(VectInA,VectInB)>>16;
-    VectInB[0] = R1;
-    VectInB[1] = -R0;
-    out2 = dotpv2(VectInA,VectInB)>>16;
-
-    /*  Reading i0+fftLen/4 */
-    /* input is down scale by 4 to avoid overflow */
-    /* T0 = yb, T1 =  xb */
-    T0 = pSrc16[i1 * 2u] >> 2;
-    T1 = pSrc16[(i1 * 2u) + 1] >> 2;
-
-    /* writing the butterfly processed i0 + fftLen/4 sample */
-    /* writing output(xc', yc') in little endian format */
-    pSrc16[i1 * 2u] = out1;
-    pSrc16[(i1 * 2u) + 1] = out2;
-
-    /*  Butterfly calculations */
-    /* input is down scale by 4 to avoid overflow */
-    /* U0 = yd, U1 = xd */
-    U0 = pSrc16[i3 * 2u] >> 2;
-    U1 = pSrc16[(i3 * 2u) + 1] >> 2;
-    /* T0 = yb-yd */
-    T0 = clip(T0 - U0, -32768,32767);
-    /* T1 = xb-xd */
-    T1 = clip(T1 - U1, -32768,32767);
-
-    /* R1 = (ya-yc) + (xb- xd),  R0 = (xa-xc) - (yb-yd)) */
-    R0 = (q15_t) clip((q31_t) (S0 - T1), -32768,32767);
-    R1 = (q15_t) clip((q31_t) (S1 + T0), -32768,32767);
-
-    /* S1 = (ya-yc) - (xb- xd), S0 = (xa-xc) + (yb-yd)) */
-    S0 = (q15_t) clip(((q31_t) S0 + T1), -32768,32767);
-    S1 = (q15_t) clip(((q31_t) S1 - T0), -32768,32767);
-
     /* co1 & si1 are read from Coefficient pointer */
-  //  Co1 = pCoef16[ic * 2u];
- //   Si1 = pCoef16[(ic * 2u) + 1];
-    /*  Butterfly process for the i0+fftLen/2 sample */
-    /* xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1) */
-   // out1 = (q15_t) ((Si1 * S1 + Co1 * S0) >> 16);
-    /* yb' = (ya-xb-yc+xd)* co1 - (xa+yb-xc-yd)* (si1) */
-   // out2 = (q15_t) ((-Si1 * S0 + Co1 * S1) >> 16);
-
-
-
-    VectInA = *(shortV*)(pCoef16 + (ic * 2u));
-    VectInB[0] = S0;
-    VectInB[1] = S1;
-    out1 = dotpv2(VectInA,VectInB)>>16;
-    VectInB[0] = S1;
-    VectInB[1] = -S0;
-    out2 = dotpv2(VectInA,VectInB)>>16;
-
-    /* writing output(xb', yb') in little endian format */
-    pSrc16[i2 * 2u] = out1;
-    pSrc16[(i2 * 2u) + 1] = out2;
-
+    W1 = riscv_radix4_twiddle_q15(pCoef16, qLen, ic);
+    W1r = shufflev4(W1, neg2(max2(W1, wMin)), rotW);
+    /* co2 & si2 are read from Coefficient pointer */
+    W2 = riscv_radix4_twiddle_q15(pCoef16, qLen, 2u * ic);
+    W2r = shufflev4(W2, neg2(max2(W2, wMin)), rotW);
     /* Co3 & si3 are read from Coefficient pointer */
-   // Co3 = pCoef16[3u * (ic * 2u)];
-   // Si3 = pCoef16[(3u * (ic * 2u)) + 1];
-    /*  Butterfly process for the i0+3fftLen/4 sample */
-    /* xd' = (xa-yb-xc+yd)* Co3 + (ya+xb-yc-xd)* (si3) */
-  //  out1 = (q15_t) ((Si3 * R1 + Co3 * R0) >> 16u);
-    /* yd' = (ya+xb-yc-xd)* Co3 - (xa-yb-xc+yd)* (si3) */
- //   out2 = (q15_t) ((-Si3 * R0 + Co3 * R1) >> 16u);
-    /* writing output(xd', yd') in little endian format */
-
-    VectInA = *(shortV*)(pCoef16 + (ic * 2u * 3u));
-    VectInB[0] = R0;
-    VectInB[1] = R1;
-    out1 = dotpv2(VectInA,VectInB)>>16;
-    VectInB[0] = R1;
-    VectInB[1] = -R0;
-    out2 = dotpv2(VectInA,VectInB)>>16;
-
-    pSrc16[i3 * 2u] = out1;
-    pSrc16[(i3 * 2u) + 1] = out2;
+    W3 = riscv_radix4_twiddle_q15(pCoef16, qLen, 3u * ic);
+    W3r = shufflev4(W3, neg2(max2(W3, wMin)), rotW);
 
     /*  Twiddle coefficients index modifier */
     ic = ic + twidCoefModifier;
 
-    /*  Updating input index */
-    i0 = i0 + 1u;
+    /*  The same butterfly of every block */
+    for (i0 = n2 - j; i0 < totalLen; i0 += n1)
+    {
+      /*  Butterfly implementation */
+
+      /*  index calculation for the input as, */
+      /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
+      i1 = i0 + n2;
+      i2 = i1 + n2;
+      i3 = i2 + n2;
+
+      /* input is down scale by 4 to avoid overflow */
+      A = sra2(pIn[i0], two);
+      B = sra2(pIn[i1], two);
+      C = sra2(pIn[i2], two);
+      D = sra2(pIn[i3], two);
+
+      /* R = (a + c), S = (a - c), T = (b + d) */
+      R = add2v(A, C);
+      S = sub2(A, C);
+      T = add2v(B, D);
+
+      /*  writing the butterfly processed i0 sample */
+      /* a' = a + b + c + d */
+      pSi[i0] = add2v(sra2(R, one), sra2(T, one));
+
+      /* R = (a + c) - (b + d) */
+      R = sub2(R, T);
+
+      /* writing the butterfly processed i0 + fftLen/4 sample */
+      /* c' = (a - b + c - d) * W2 */
+      pSi[i1] = pack2(dotpv2(W2, R) >> 16, dotpv2(W2r, R) >> 16);
+
+      /* T = (b - d), Tj = -j * (b - d) */
+      T = sub2(B, D);
+      Tj = shufflev4(T, neg2(T), rotJ);
+
+      /* R = (a - c) + j * (b - d), S = (a - c) - j * (b - d) */
+      R = sub2(S, Tj);
+      S = add2v(S, Tj);
+
+      /*  Butterfly process for the i0+fftLen/2 sample */
+      /* b' = (a - j * b - c + j * d) * W1 */
+      pSi[i2] = pack2(dotpv2(W1, S) >> 16, dotpv2(W1r, S) >> 16);
+
+      /*  Butterfly process for the i0+3fftLen/4 sample */
+      /* d' = (a + j * b - c - j * d) * W3 */
+      pSi[i3] = pack2(dotpv2(W3, R) >> 16, dotpv2(W3r, R) >> 16);
+    }
 
   } while(--j);
   /* data is in 4.11(q11) format */
@@ -374,21 +396,18 @@ void riscv_radix4_butterfly_q15(
     for (j = 0u; j <= (n2 - 1u); j++)
     {
       /*  index calculation for the coefficients */
-    //  Co1 = pCoef16[ic * 2u];
-    //  Si1 = pCoef16[(ic * 2u) + 1u];
-    //  Co2 = pCoef16[2u * (ic * 2u)];
-    //  Si2 = pCoef16[(2u * (ic * 2u)) + 1u];
-      VectInC = *(shortV*)(pCoef16 + (ic * 2u));
-      VectInA = *(shortV*)(pCoef16 + (ic * 2u *2u));
-      VectInD = *(shortV*)(pCoef16 + (ic * 2u *3u));
-    //  Co3 = pCoef16[3u * (ic * 2u)];
-    //  Si3 = pCoef16[(3u * (ic * 2u)) + 1u];
+      W1 = riscv_radix4_twiddle_q15(pCoef16, qLen, ic);
+      W2 = riscv_radix4_twiddle_q15(pCoef16, qLen, 2u * ic);
+      W3 = riscv_radix4_twiddle_q15(pCoef16, qLen, 3u * ic);
+      W1r = shufflev4(W1, neg2(max2(W1, wMin)), rotW);
+      W2r = shufflev4(W2, neg2(max2(W2, wMin)), rotW);
+      W3r = shufflev4(W3, neg2(max2(W3, wMin)), rotW);
 
       /*  Twiddle coefficients index modifier */
       ic = ic + twidCoefModifier;
 
       /*  Butterfly implementation */
-      for (i0 = j; i0 < fftLen; i0 += n1)
+      for (i0 = j; i0 < totalLen; i0 += n1)
       {
         /*  index calculation for the input as, */
         /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
@@ -396,123 +415,42 @@ void riscv_radix4_butterfly_q15(
         i2 = i1 + n2;
         i3 = i2 + n2;
 
-        /*  Reading i0, i0+fftLen/2 inputs */
-        /* Read ya (real), xa(imag) input */
-        T0 = pSrc16[i0 * 2u];
-        T1 = pSrc16[(i0 * 2u) + 1u];
-
-        /* Read yc (real), xc(imag) input */
-        S0 = pSrc16[i2 * 2u];
-        S1 = pSrc16[(i2 * 2u) + 1u];
-
-        /* R0 = (ya + yc), R1 = (xa + xc) */
-        R0 = clip(T0 + S0, -32768,32767);
-        R1 = clip(T1 + S1, -32768,32767);
-
-        /* S0 = (ya - yc), S1 =(xa - xc) */
-        S0 = clip(T0 - S0,-32768,32767);
-        S1 = clip(T1 - S1, -32768,32767);;
-
-        /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
-        /* Read yb (real), xb(imag) input */
-        T0 = pSrc16[i1 * 2u];
-        T1 = pSrc16[(i1 * 2u) + 1u];
-
-        /* Read yd (real), xd(imag) input */
-        U0 = pSrc16[i3 * 2u];
-        U1 = pSrc16[(i3 * 2u) + 1u];
-
+        A = pSi[i0];
+        B = pSi[i1];
+        C = pSi[i2];
+        D = pSi[i3];
 
-        /* T0 = (yb + yd), T1 = (xb + xd) */
-        T0 = clip(T0 + U0,-32768,32767);
-        T1 = clip(T1 + U1, -32768,32767);
+        /* R = (a + c), S = (a - c), T = (b + d) */
+        R = add2v(A, C);
+        S = sub2(A, C);
+        T = add2v(B, D);
 
         /*  writing the butterfly processed i0 sample */
+        /* a' = a + b + c + d */
+        pSi[i0] = sra2(add2v(sra2(R, one), sra2(T, one)), one);
 
-        /* xa' = xa + xb + xc + xd */
-        /* ya' = ya + yb + yc + yd */
-        out1 = ((R0 >> 1u) + (T0 >> 1u)) >> 1u;
-        out2 = ((R1 >> 1u) + (T1 >> 1u)) >> 1u;
-
-        pSrc16[i0 * 2u] = out1;
-        pSrc16[(2u * i0) + 1u] = out2;
-
-        /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc) - (xb + xd) */
-        R0 = (R0 >> 1u) - (T0 >> 1u);
-        R1 = (R1 >> 1u) - (T1 >> 1u);
-
-        /* (ya-yb+yc-yd)* (si2) + (xa-xb+xc-xd)* co2 */
-      //  out1 = (q15_t) ((Co2 * R0 + Si2 * R1) >> 16u);
-
-        /* (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2) */
-     //   out2 = (q15_t) ((-Si2 * R0 + Co2 * R1) >> 16u);
-
-
-
-        VectInB[0] = R0;
-        VectInB[1] = R1;
-        out1 = dotpv2(VectInA,VectInB)>>16;
-        VectInB[0] = R1;
-        VectInB[1] = -R0;
-        out2 = dotpv2(VectInA,VectInB)>>16;
-
-        /*  Reading i0+3fftLen/4 */
-        /* Read yb (real), xb(imag) input */
-        T0 = pSrc16[i1 * 2u];
-        T1 = pSrc16[(i1 * 2u) + 1u];
-
-        /*  writing the butterfly processed i0 + fftLen/4 sample */
-        /* xc' = (xa-xb+xc-xd)* co2 + (ya-yb+yc-yd)* (si2) */
-        /* yc' = (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2) */
-        pSrc16[i1 * 2u] = out1;
-        pSrc16[(i1 * 2u) + 1u] = out2;
-
-        /*  Butterfly calculations */
-
-        /* Read yd (real), xd(imag) input */
-        U0 = pSrc16[i3 * 2u];
-        U1 = pSrc16[(i3 * 2u) + 1u];
+        /* R = (a + c) - (b + d) */
+        R = sub2(sra2(R, one), sra2(T, one));
 
-        /* T0 = yb-yd, T1 = xb-xd */
-        T0 = clip(T0 - U0, -32768,32767);
-        T1 = clip(T1 - U1, -32768,32767);
+        /* c' = (a - b + c - d) * W2 */
+        pSi[i1] = pack2(dotpv2(W2, R) >> 16, dotpv2(W2r, R) >> 16);
 
-        /* R0 = (ya-yc) + (xb- xd), R1 = (xa-xc) - (yb-yd)) */
-        R0 = (S0 >> 1u) - (T1 >> 1u);
-        R1 = (S1 >> 1u) + (T0 >> 1u);
+        /* T = (b - d), Tj = -j * (b - d) */
+        T = sra2(sub2(B, D), one);
+        Tj = shufflev4(T, neg2(T), rotJ);
 
-        /* S0 = (ya-yc) - (xb- xd), S1 = (xa-xc) + (yb-yd)) */
-        S0 = (S0 >> 1u) + (T1 >> 1u);
-        S1 = (S1 >> 1u) - (T0 >> 1u);
+        /* R = (a - c) + j * (b - d), S = (a - c) - j * (b - d) */
+        S = sra2(S, one);
+        R = sub2(S, Tj);
+        S = add2v(S, Tj);
 
         /*  Butterfly process for the i0+fftLen/2 sample */
-      //  out1 = (q15_t) ((Co1 * S0 + Si1 * S1) >> 16u);
-      //  out2 = (q15_t) ((-Si1 * S0 + Co1 * S1) >> 16u);
-        VectInB[0] = S0;
-        VectInB[1] = S1;
-        out1 = dotpv2(VectInC,VectInB)>>16;
-        VectInB[0] = S1;
-        VectInB[1] = -S0;
-        out2 = dotpv2(VectInC,VectInB)>>16;
-        /* xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1) */
-        /* yb' = (ya-xb-yc+xd)* co1 - (xa+yb-xc-yd)* (si1) */
-        pSrc16[i2 * 2u] = out1;
-        pSrc16[(i2 * 2u) + 1u] = out2;
+        /* b' = (a - j * b - c + j * d) * W1 */
+        pSi[i2] = pack2(dotpv2(W1, S) >> 16, dotpv2(W1r, S) >> 16);
 
         /*  Butterfly process for the i0+3fftLen/4 sample */
-        //out1 = (q15_t) ((Si3 * R1 + Co3 * R0) >> 16u);
-        //out2 = (q15_t) ((-Si3 * R0 + Co3 * R1) >> 16u);
-
-        VectInB[0] = R0;
-        VectInB[1] = R1;
-        out1 = dotpv2(VectInD,VectInB)>>16;
-        VectInB[0] = R1;
-        VectInB[1] = -R0;
-        out2 = dotpv2(VectInD,VectInB)>>16;
-        /* xd' = (xa-yb-xc+yd)* Co3 + (ya+xb-yc-xd)* (si3) */
-        /* yd' = (ya+xb-yc-xd)* Co3 - (xa-yb-xc+yd)* (si3) */
-        pSrc16[i3 * 2u] = out1;
-        pSrc16[(i3 * 2u) + 1u] = out2;
+        /* d' = (a + j * b - c - j * d) * W3 */
+        pSi[i3] = pack2(dotpv2(W3, R) >> 16, dotpv2(W3r, R) >> 16);
       }
     }
     /*  Twiddle coefficients index modifier */
@@ -533,7 +471,7 @@ void riscv_radix4_butterfly_q15(
   /* start of last stage process */
 
   /*  Butterfly implementation */
-  for (i0 = 0u; i0 <= (fftLen - n1); i0 += n1)
+  for (i0 = 0u; i0 <= (totalLen - n1); i0 += n1)
   {
     /*  index calculation for the input as, */
     /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
@@ -541,73 +479,36 @@ void riscv_radix4_butterfly_q15(
     i2 = i1 + n2;
     i3 = i2 + n2;
 
-    /*  Reading i0, i0+fftLen/2 inputs */
-    /* Read ya (real), xa(imag) input */
-    T0 = pSrc16[i0 * 2u];
-    T1 = pSrc16[(i0 * 2u) + 1u];
-
-    /* Read yc (real), xc(imag) input */
-    S0 = pSrc16[i2 * 2u];
-    S1 = pSrc16[(i2 * 2u) + 1u];
-
-    /* R0 = (ya + yc), R1 = (xa + xc) */
-    R0 = clip(T0 + S0, -32768,32767);
-    R1 = clip(T1 + S1, -32768,32767);
-
-    /* S0 = (ya - yc), S1 = (xa - xc) */
-    S0 = clip(T0 - S0, -32768,32767);
-    S1 = clip(T1 - S1, -32768,32767);
-
-    /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
-    /* Read yb (real), xb(imag) input */
-    T0 = pSrc16[i1 * 2u];
-    T1 = pSrc16[(i1 * 2u) + 1u];
-    /* Read yd (real), xd(imag) input */
-    U0 = pSrc16[i3 * 2u];
-    U1 = pSrc16[(i3 * 2u) + 1u];
+    A = pSi[i0];
+    B = pSi[i1];
+    C = pSi[i2];
+    D = pSi[i3];
 
-    /* T0 = (yb + yd), T1 = (xb + xd)) */
-    T0 = clip(T0 + U0, -32768,32767);
-    T1 = clip(T1 + U1, -32768,32767);
+    /* R = (a + c), S = (a - c), T = (b + d) */
+    R = add2v(A, C);
+    S = sub2(A, C);
+    T = add2v(B, D);
 
     /*  writing the butterfly processed i0 sample */
-    /* xa' = xa + xb + xc + xd */
-    /* ya' = ya + yb + yc + yd */
-    pSrc16[i0 * 2u] = (R0 >> 1u) + (T0 >> 1u);
-    pSrc16[(i0 * 2u) + 1u] = (R1 >> 1u) + (T1 >> 1u);
-
-    /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc) - (xb + xd) */
-    R0 = (R0 >> 1u) - (T0 >> 1u);
-    R1 = (R1 >> 1u) - (T1 >> 1u);
-    /* Read yb (real), xb(imag) input */
-    T0 = pSrc16[i1 * 2u];
-    T1 = pSrc16[(i1 * 2u) + 1u];
+    /* a' = a + b + c + d */
+    pSi[i0] = add2v(sra2(R, one), sra2(T, one));
 
     /*  writing the butterfly processed i0 + fftLen/4 sample */
-    /* xc' = (xa-xb+xc-xd) */
-    /* yc' = (ya-yb+yc-yd) */
-    pSrc16[i1 * 2u] = R0;
-    pSrc16[(i1 * 2u) + 1u] = R1;
+    /* c' = a - b + c - d */
+    pSi[i1] = sub2(sra2(R, one), sra2(T, one));
 
-    /* Read yd (real), xd(imag) input */
-    U0 = pSrc16[i3 * 2u];
-    U1 = pSrc16[(i3 * 2u) + 1u];
-    /* T0 = (yb - yd), T1 = (xb - xd)  */
-    T0 = clip(T0 - U0, -32768,32767);
-    T1 = clip(T1 - U1, -32768,32767);
+    /* T = (b - d), Tj = -j * (b - d) */
+    T = sra2(sub2(B, D), one);
+    Tj = shufflev4(T, neg2(T), rotJ);
+    S = sra2(S, one);
 
     /*  writing the butterfly processed i0 + fftLen/2 sample */
-    /* xb' = (xa+yb-xc-yd) */
-    /* yb' = (ya-xb-yc+xd) */
-    pSrc16[i2 * 2u] = (S0 >> 1u) + (T1 >> 1u);
-    pSrc16[(i2 * 2u) + 1u] = (S1 >> 1u) - (T0 >> 1u);
+    /* b' = a - j * b - c + j * d */
+    pSi[i2] = add2v(S, Tj);
 
     /*  writing the butterfly processed i0 + 3fftLen/4 sample */
-    /* xd' = (xa-yb-xc+yd) */
-    /* yd' = (ya+xb-yc-xd) */
-    pSrc16[i3 * 2u] = (S0 >> 1u) - (T1 >> 1u);
-    pSrc16[(i3 * 2u) + 1u] = (S1 >> 1u) + (T0 >> 1u);
-
+    /* d' = a + j * b - c - j * d */
+    pSi[i3] = sub2(S, Tj);
   }
 
   /* end of last stage process */
@@ -617,11 +518,12 @@ void riscv_radix4_butterfly_q15(
   /* output is in 7.9(q9) format for the 64 point  */
   /* output is in 5.11(q11) format for the 16 point  */
 
-
 #else
   q15_t R0, R1, S0, S1, T0, T1, U0, U1;
   q15_t Co1, Si1, Co2, Si2, Co3, Si3, out1, out2;
   uint32_t n1, n2, ic, i0, i1, i2, i3, j, k;
+  uint32_t totalLen = fftLen * numBlocks;
+  uint32_t qLen = (fftLen * twidCoefModifier) >> 2u;   /* Quarter-wave length of the twiddle table */
 
   /* Total process is divided into three stages */
 
@@ -637,8 +539,7 @@ void riscv_radix4_butterfly_q15(
   /* Index for twiddle coefficient */
   ic = 0u;
 
-  /* Index for input read and output write */
-  i0 = 0u;
+  /* Butterfly counter */
   j = n2;
 
   /* Input is in 1.15(q15) format */
@@ -646,131 +547,129 @@ void riscv_radix4_butterfly_q15(
   /*  start of first stage process */
   do
   {
-    /*  Butterfly implementation */
-
-    /*  index calculation for the input as, */
-    /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
-    i1 = i0 + n2;
-    i2 = i1 + n2;
-    i3 = i2 + n2;
-
-    /*  Reading i0, i0+fftLen/2 inputs */
-
-    /* input is down scale by 4 to avoid overflow */
-    /* Read ya (real), xa(imag) input */
-    T0 = pSrc16[i0 * 2u] >> 2u;
-    T1 = pSrc16[(i0 * 2u) + 1u] >> 2u;
-
-    /* input is down scale by 4 to avoid overflow */
-    /* Read yc (real), xc(imag) input */
-    S0 = pSrc16[i2 * 2u] >> 2u;
-    S1 = pSrc16[(i2 * 2u) + 1u] >> 2u;
-
-    /* R0 = (ya + yc) */
-    R0 = __SSAT(T0 + S0, 16u);
-    /* R1 = (xa + xc) */
-    R1 = __SSAT(T1 + S1, 16u);
-
-    /* S0 = (ya - yc) */
-    S0 = __SSAT(T0 - S0, 16);
-    /* S1 = (xa - xc) */
-    S1 = __SSAT(T1 - S1, 16);
-
-    /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
-    /* input is down scale by 4 to avoid overflow */
-    /* Read yb (real), xb(imag) input */
-    T0 = pSrc16[i1 * 2u] >> 2u;
-    T1 = pSrc16[(i1 * 2u) + 1u] >> 2u;
-
-    /* input is down scale by 4 to avoid overflow */
-    /* Read yd (real), xd(imag) input */
-    U0 = pSrc16[i3 * 2u] >> 2u;
-    U1 = pSrc16[(i3 * 2u) + 1] >> 2u;
-
-    /* T0 = (yb + yd) */
-    T0 = __SSAT(T0 + U0, 16u);
-    /* T1 = (xb + xd) */
-    T1 = __SSAT(T1 + U1, 16u);
-
-    /*  writing the butterfly processed i0 sample */
-    /* ya' = ya + yb + yc + yd */
-    /* xa' = xa + xb + xc + xd */
-    pSrc16[i0 * 2u] = (R0 >> 1u) + (T0 >> 1u);
-    pSrc16[(i0 * 2u) + 1u] = (R1 >> 1u) + (T1 >> 1u);
-
-    /* R0 = (ya + yc) - (yb + yd) */
-    /* R1 = (xa + xc) - (xb + xd) */
-    R0 = __SSAT(R0 - T0, 16u);
-    R1 = __SSAT(R1 - T1, 16u);
-
-    /* co2 & si2 are read from Coefficient pointer */
-    Co2 = pCoef16[2u * ic * 2u];
-    Si2 = pCoef16[(2u * ic * 2u) + 1];
-
-    /* xc' = (xa-xb+xc-xd)* co2 + (ya-yb+yc-yd)* (si2) */
-    out1 = (q15_t) ((Co2 * R0 + Si2 * R1) >> 16u);
-    /* yc' = (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2) */
-    out2 = (q15_t) ((-Si2 * R0 + Co2 * R1) >> 16u);
-
-    /*  Reading i0+fftLen/4 */
-    /* input is down scale by 4 to avoid overflow */
-    /* T0 = yb, T1 =  xb */
-    T0 = pSrc16[i1 * 2u] >> 2;
-    T1 = pSrc16[(i1 * 2u) + 1] >> 2;
-
-    /* writing the butterfly processed i0 + fftLen/4 sample */
-    /* writing output(xc', yc') in little endian format */
-    pSrc16[i1 * 2u] = out1;
-    pSrc16[(i1 * 2u) + 1] = out2;
-
-    /*  Butterfly calculations */
-    /* input is down scale by 4 to avoid overflow */
-    /* U0 = yd, U1 = xd */
-    U0 = pSrc16[i3 * 2u] >> 2;
-    U1 = pSrc16[(i3 * 2u) + 1] >> 2;
-    /* T0 = yb-yd */
-    T0 = __SSAT(T0 - U0, 16);
-    /* T1 = xb-xd */
-    T1 = __SSAT(T1 - U1, 16);
-
-    /* R1 = (ya-yc) + (xb- xd),  R0 = (xa-xc) - (yb-yd)) */
-    R0 = (q15_t) __SSAT((q31_t) (S0 - T1), 16);
-    R1 = (q15_t) __SSAT((q31_t) (S1 + T0), 16);
-
-    /* S1 = (ya-yc) - (xb- xd), S0 = (xa-xc) + (yb-yd)) */
-    S0 = (q15_t) __SSAT(((q31_t) S0 + T1), 16u);
-    S1 = (q15_t) __SSAT(((q31_t) S1 - T0), 16u);
-
     /* co1 & si1 are read from Coefficient pointer */
-    Co1 = pCoef16[ic * 2u];
-    Si1 = pCoef16[(ic * 2u) + 1];
-    /*  Butterfly process for the i0+fftLen/2 sample */
-    /* xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1) */
-    out1 = (q15_t) ((Si1 * S1 + Co1 * S0) >> 16);
-    /* yb' = (ya-xb-yc+xd)* co1 - (xa+yb-xc-yd)* (si1) */
-    out2 = (q15_t) ((-Si1 * S0 + Co1 * S1) >> 16);
-
-    /* writing output(xb', yb') in little endian format */
-    pSrc16[i2 * 2u] = out1;
-    pSrc16[(i2 * 2u) + 1] = out2;
-
+    riscv_radix4_twiddle_co_si_q15(pCoef16, qLen, ic, &Co1, &Si1);
+    /* co2 & si2 are read from Coefficient pointer */
+    riscv_radix4_twiddle_co_si_q15(pCoef16, qLen, 2u * ic, &Co2, &Si2);
     /* Co3 & si3 are read from Coefficient pointer */
-    Co3 = pCoef16[3u * (ic * 2u)];
-    Si3 = pCoef16[(3u * (ic * 2u)) + 1];
-    /*  Butterfly process for the i0+3fftLen/4 sample */
-    /* xd' = (xa-yb-xc+yd)* Co3 + (ya+xb-yc-xd)* (si3) */
-    out1 = (q15_t) ((Si3 * R1 + Co3 * R0) >> 16u);
-    /* yd' = (ya+xb-yc-xd)* Co3 - (xa-yb-xc+yd)* (si3) */
-    out2 = (q15_t) ((-Si3 * R0 + Co3 * R1) >> 16u);
-    /* writing output(xd', yd') in little endian format */
-    pSrc16[i3 * 2u] = out1;
-    pSrc16[(i3 * 2u) + 1] = out2;
+    riscv_radix4_twiddle_co_si_q15(pCoef16, qLen, 3u * ic, &Co3, &Si3);
 
     /*  Twiddle coefficients index modifier */
     ic = ic + twidCoefModifier;
 
-    /*  Updating input index */
-    i0 = i0 + 1u;
+    /*  The same butterfly of every block */
+    for (i0 = n2 - j; i0 < totalLen; i0 += n1)
+    {
+      /*  Butterfly implementation */
+
+      /*  index calculation for the input as, */
+      /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
+      i1 = i0 + n2;
+      i2 = i1 + n2;
+      i3 = i2 + n2;
+
+      /*  Reading i0, i0+fftLen/2 inputs */
+
+      /* input is down scale by 4 to avoid overflow */
+      /* Read ya (real), xa(imag) input */
+      T0 = pIn16[i0 * 2u] >> 2u;
+      T1 = pIn16[(i0 * 2u) + 1u] >> 2u;
+
+      /* input is down scale by 4 to avoid overflow */
+      /* Read yc (real), xc(imag) input */
+      S0 = pIn16[i2 * 2u] >> 2u;
+      S1 = pIn16[(i2 * 2u) + 1u] >> 2u;
+
+      /* R0 = (ya + yc) */
+      R0 = __SSAT(T0 + S0, 16u);
+      /* R1 = (xa + xc) */
+      R1 = __SSAT(T1 + S1, 16u);
+
+      /* S0 = (ya - yc) */
+      S0 = __SSAT(T0 - S0, 16);
+      /* S1 = (xa - xc) */
+      S1 = __SSAT(T1 - S1, 16);
+
+      /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
+      /* input is down scale by 4 to avoid overflow */
+      /* Read yb (real), xb(imag) input */
+      T0 = pIn16[i1 * 2u] >> 2u;
+      T1 = pIn16[(i1 * 2u) + 1u] >> 2u;
+
+      /* input is down scale by 4 to avoid overflow */
+      /* Read yd (real), xd(imag) input */
+      U0 = pIn16[i3 * 2u] >> 2u;
+      U1 = pIn16[(i3 * 2u) + 1] >> 2u;
+
+      /* T0 = (yb + yd) */
+      T0 = __SSAT(T0 + U0, 16u);
+      /* T1 = (xb + xd) */
+      T1 = __SSAT(T1 + U1, 16u);
+
+      /*  writing the butterfly processed i0 sample */
+      /* ya' = ya + yb + yc + yd */
+      /* xa' = xa + xb + xc + xd */
+      pSrc16[i0 * 2u] = (R0 >> 1u) + (T0 >> 1u);
+      pSrc16[(i0 * 2u) + 1u] = (R1 >> 1u) + (T1 >> 1u);
+
+      /* R0 = (ya + yc) - (yb + yd) */
+      /* R1 = (xa + xc) - (xb + xd) */
+      R0 = __SSAT(R0 - T0, 16u);
+      R1 = __SSAT(R1 - T1, 16u);
+
+      /* xc' = (xa-xb+xc-xd)* co2 + (ya-yb+yc-yd)* (si2) */
+      out1 = (q15_t) ((Co2 * R0 + Si2 * R1) >> 16u);
+      /* yc' = (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2) */
+      out2 = (q15_t) ((-Si2 * R0 + Co2 * R1) >> 16u);
+
+      /*  Reading i0+fftLen/4 */
+      /* input is down scale by 4 to avoid overflow */
+      /* T0 = yb, T1 =  xb */
+      T0 = pIn16[i1 * 2u] >> 2;
+      T1 = pIn16[(i1 * 2u) + 1] >> 2;
+
+      /* writing the butterfly processed i0 + fftLen/4 sample */
+      /* writing output(xc', yc') in little endian format */
+      pSrc16[i1 * 2u] = out1;
+      pSrc16[(i1 * 2u) + 1] = out2;
+
+      /*  Butterfly calculations */
+      /* input is down scale by 4 to avoid overflow */
+      /* U0 = yd, U1 = xd */
+      U0 = pIn16[i3 * 2u] >> 2;
+      U1 = pIn16[(i3 * 2u) + 1] >> 2;
+      /* T0 = yb-yd */
+      T0 = __SSAT(T0 - U0, 16);
+      /* T1 = xb-xd */
+      T1 = __SSAT(T1 - U1, 16);
+
+      /* R1 = (ya-yc) + (xb- xd),  R0 = (xa-xc) - (yb-yd)) */
+      R0 = (q15_t) __SSAT((q31_t) (S0 - T1), 16);
+      R1 = (q15_t) __SSAT((q31_t) (S1 + T0), 16);
+
+      /* S1 = (ya-yc) - (xb- xd), S0 = (xa-xc) + (yb-yd)) */
+      S0 = (q15_t) __SSAT(((q31_t) S0 + T1), 16u);
+      S1 = (q15_t) __SSAT(((q31_t) S1 - T0), 16u);
+
+      /*  Butterfly process for the i0+fftLen/2 sample */
+      /* xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1) */
+      out1 = (q15_t) ((Si1 * S1 + Co1 * S0) >> 16);
+      /* yb' = (ya-xb-yc+xd)* co1 - (xa+yb-xc-yd)* (si1) */
+      out2 = (q15_t) ((-Si1 * S0 + Co1 * S1) >> 16);
+
+      /* writing output(xb', yb') in little endian format */
+      pSrc16[i2 * 2u] = out1;
+      pSrc16[(i2 * 2u) + 1] = out2;
+
+      /*  Butterfly process for the i0+3fftLen/4 sample */
+      /* xd' = (xa-yb-xc+yd)* Co3 + (ya+xb-yc-xd)* (si3) */
+      out1 = (q15_t) ((Si3 * R1 + Co3 * R0) >> 16u);
+      /* yd' = (ya+xb-yc-xd)* Co3 - (xa-yb-xc+yd)* (si3) */
+      out2 = (q15_t) ((-Si3 * R0 + Co3 * R1) >> 16u);
+      /* writing output(xd', yd') in little endian format */
+      pSrc16[i3 * 2u] = out1;
+      pSrc16[(i3 * 2u) + 1] = out2;
+    }
 
   } while(--j);
   /* data is in 4.11(q11) format */
@@ -794,18 +693,15 @@ void riscv_radix4_butterfly_q15(
     for (j = 0u; j <= (n2 - 1u); j++)
     {
       /*  index calculation for the coefficients */
-      Co1 = pCoef16[ic * 2u];
-      Si1 = pCoef16[(ic * 2u) + 1u];
-      Co2 = pCoef16[2u * (ic * 2u)];
-      Si2 = pCoef16[(2u * (ic * 2u)) + 1u];
-      Co3 = pCoef16[3u * (ic * 2u)];
-      Si3 = pCoef16[(3u * (ic * 2u)) + 1u];
+      riscv_radix4_twiddle_co_si_q15(pCoef16, qLen, ic, &Co1, &Si1);
+      riscv_radix4_twiddle_co_si_q15(pCoef16, qLen, 2u * ic, &Co2, &Si2);
+      riscv_radix4_twiddle_co_si_q15(pCoef16, qLen, 3u * ic, &Co3, &Si3);
 
       /*  Twiddle coefficients index modifier */
       ic = ic + twidCoefModifier;
 
       /*  Butterfly implementation */
-      for (i0 = j; i0 < fftLen; i0 += n1)
+      for (i0 = j; i0 < totalLen; i0 += n1)
       {
         /*  index calculation for the input as, */
         /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
@@ -931,7 +827,7 @@ void riscv_radix4_butterfly_q15(
   /* start of last stage process */
 
   /*  Butterfly implementation */
-  for (i0 = 0u; i0 <= (fftLen - n1); i0 += n1)
+  for (i0 = 0u; i0 <= (totalLen - n1); i0 += n1)
   {
     /*  index calculation for the input as, */
     /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
@@ -1017,10 +913,30 @@ void riscv_radix4_butterfly_q15(
 #endif
 }
 
-
 /**    
- * @brief  Core function for the Q15 CIFFT butterfly process.   
- * @param[in, out] *pSrc16          points to the in-place buffer of Q15 data type.   
+ * @brief  Q15 CFFT butterfly process reading the first stage inputs from a separate buffer.   
+ * @param[in]      *pIn16           points to the input buffer, only read by the first stage. It may be equal to pSrc16.   
+ * @param[out]     *pSrc16          points to the buffer that holds the result, of Q15 data type.   
+ * @param[in]      fftLen           length of the FFT.   
+ * @param[in]      *pCoef16         points to twiddle coefficient buffer.   
+ * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.   
+ * @return none.   
+ */
+
+void riscv_radix4_butterfly_oop_q15(
+  const q15_t * pIn16,
+  q15_t * pSrc16,
+  uint32_t fftLen,
+  q15_t * pCoef16,
+  uint32_t twidCoefModifier)
+{
+  riscv_radix4_butterfly_batch_q15(pIn16, pSrc16, fftLen, pCoef16, twidCoefModifier, 1u);
+}
+
+
+/**    
+ * @brief  Core function for the Q15 CIFFT butterfly process.   
+ * @param[in, out] *pSrc16          points to the in-place buffer of Q15 data type.   
  * @param[in]      fftLen           length of the FFT.   
  * @param[in]      *pCoef16         points to twiddle coefficient buffer.   
  * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.   
@@ -1073,15 +989,59 @@ void riscv_radix4_butterfly_inverse_q15(
   q15_t * pCoef16,
   uint32_t twidCoefModifier)
 {
+  riscv_radix4_butterfly_inverse_oop_q15(pSrc16, pSrc16, fftLen, pCoef16, twidCoefModifier);
+}
+
+/**    
+ * @brief  Q15 CIFFT butterfly process of several transforms, reading the first stage inputs from a separate buffer.   
+ * @param[in]      *pIn16           points to the input buffer, only read by the first stage. It may be equal to pSrc16.   
+ * @param[out]     *pSrc16          points to the buffer that holds the result, of Q15 data type.   
+ * @param[in]      fftLen           length of the FFT.   
+ * @param[in]      *pCoef16         points to twiddle coefficient buffer.   
+ * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.   
+ * @param[in]      numBlocks        number of transforms of fftLen samples stored back to back in pIn16 and pSrc16.   
+ * @return none.   
+ *   
+ * Every stage runs a butterfly group over all blocks with the same twiddle factors,   
+ * so the twiddle loads and the loop setup of a stage are shared by the blocks.   
+ */
+
+RISCV_DSP_FASTCODE(riscv_radix4_butterfly_inverse_batch_q15)
+void riscv_radix4_butterfly_inverse_batch_q15(
+  const q15_t * pIn16,
+  q15_t * pSrc16,
+  uint32_t fftLen,
+  q15_t * pCoef16,
+  uint32_t twidCoefModifier,
+  uint32_t numBlocks)
+{
 
 #if defined (USE_DSP_RISCV)
-  q15_t R0, R1, S0, S1, T0, T1, U0, U1;
-  q15_t Co1, Si1, Co2, Si2, Co3, Si3, out1, out2;
+
+  shortV *pSi = (shortV *) pSrc16;               /* Complex samples as packed (real, imag) pairs */
+  const shortV *pIn = (const shortV *) pIn16;    /* First stage inputs as packed pairs */
+  shortV A, B, C, D;                             /* Butterfly inputs */
+  shortV R, S, T, Tj;                            /* Butterfly intermediate values */
+  shortV W1, W2, W3;                             /* Twiddle coefficients (co, si) */
+  shortV W1c, W2c, W3c;                          /* Conjugated twiddle coefficients (co, -si) */
+  shortV W1s, W2s, W3s;                          /* Swapped twiddle coefficients (si, co) */
+  shortV one = { 1, 1 };                         /* Shift by 1 on both halves */
+  shortV two = { 2, 2 };                         /* Shift by 2 on both halves */
+  shortV rotJ = { 1, 2 };                        /* Shuffle mask for (T1, -T0) */
+  shortV conjW = { 0, 3 };                       /* Shuffle mask for (co, -si) */
+  shortV swapW = { 1, 0 };                       /* Shuffle mask for (si, co) */
+  shortV wMin = { -32767, -32767 };              /* Keeps -si in range for si = -1.0 */
   uint32_t n1, n2, ic, i0, i1, i2, i3, j, k;
-  shortV VectInA;
-  shortV VectInB;
-  shortV VectInC;
-  shortV VectInD;
+  uint32_t totalLen = fftLen * numBlocks;
+  uint32_t qLen = (fftLen * twidCoefModifier) >> 2u;   /* Quarter-wave length of the twiddle table */
+
+  /* Every complex sample is handled as one packed shortV, so the butterfly    
+   * sums are done with packed add/sub and the twiddle multiplies with dotpv2:    
+   * real' = (co * real - si * imag) >> 16, imag' = (si * real + co * imag) >> 16.    
+   * The negated sine is limited to 0x7FFF, so twiddles with si = -1.0 can    
+   * differ from the scalar path by one LSB. The packed adds are not    
+   * saturating; the down scaling done in every stage keeps the sums in range    
+   * for inputs with a magnitude below 1.0. */
 
   /* Total process is divided into three stages */
 
@@ -1097,165 +1057,87 @@ void riscv_radix4_butterfly_inverse_q15(
   /* Index for twiddle coefficient */
   ic = 0u;
 
-  /* Index for input read and output write */
-  i0 = 0u;
-
+  /* Butterfly counter */
   j = n2;
 
   /* Input is in 1.15(q15) format */
 
-
   /*  Start of first stage process */
   do
   {
-    /*  Butterfly implementation */
-
-    /*  index calculation for the input as, */
-    /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
-    i1 = i0 + n2;
-    i2 = i1 + n2;
-    i3 = i2 + n2;
-
-    /*  Reading i0, i0+fftLen/2 inputs */
-    /* input is down scale by 4 to avoid overflow */
-    /* Read ya (real), xa(imag) input */
-    T0 = pSrc16[i0 * 2u] >> 2u;
-    T1 = pSrc16[(i0 * 2u) + 1u] >> 2u;
-    /* input is down scale by 4 to avoid overflow */
-    /* Read yc (real), xc(imag) input */
-    S0 = pSrc16[i2 * 2u] >> 2u;
-    S1 = pSrc16[(i2 * 2u) + 1u] >> 2u;
-
-
-    /* R0 = (ya + yc), R1 = (xa + xc) */
-    R0 = clip(T0 + S0, -32768,32767);;
-    R1 = clip(T1 + S1,  -32768,32767);
-    /* S0 = (ya - yc), S1 = (xa - xc) */
-    S0 = clip(T0 - S0,  -32768,32767);
-    S1 = clip(T1 - S1, -32768,32767);
-
-    /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
-    /* input is down scale by 4 to avoid overflow */
-    /* Read yb (real), xb(imag) input */
-    T0 = pSrc16[i1 * 2u] >> 2u;
-    T1 = pSrc16[(i1 * 2u) + 1u] >> 2u;
-    /* Read yd (real), xd(imag) input */
-    /* input is down scale by 4 to avoid overflow */
-    U0 = pSrc16[i3 * 2u] >> 2u;
-    U1 = pSrc16[(i3 * 2u) + 1u] >> 2u;
-
-    /* T0 = (yb + yd), T1 = (xb + xd) */
-    T0 = clip(T0 + U0,  -32768,32767);
-    T1 = clip(T1 + U1, -32768,32767);
-
-    /*  writing the butterfly processed i0 sample */
-    /* xa' = xa + xb + xc + xd */
-    /* ya' = ya + yb + yc + yd */
-    pSrc16[i0 * 2u] = (R0 >> 1u) + (T0 >> 1u);
-    pSrc16[(i0 * 2u) + 1u] = (R1 >> 1u) + (T1 >> 1u);
-
-    /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc)- (xb + xd) */
-    R0 = clip(R0 - T0,  -32768,32767);
-    R1 = clip(R1 - T1,  -32768,32767);
-    /* co2 & si2 are read from Coefficient pointer */
-  //  Co2 = pCoef16[2u * ic * 2u];
-  //  Si2 = pCoef16[(2u * ic * 2u) + 1u];
-    /* xc' = (xa-xb+xc-xd)* co2 - (ya-yb+yc-yd)* (si2) */
-  //  out1 = (q15_t) ((Co2 * R0 - Si2 * R1) >> 16u);
-    /* yc' = (ya-yb+yc-yd)* co2 + (xa-xb+xc-xd)* (si2) */
-   // out2 = (q15_t) ((Si2 * R0 + Co2 * R1) >> 16u);
-
-    VectInA = *(shortV*)(pCoef16 + (ic * 2u * 2u));
-    VectInB[0] = R0;
-    VectInB[1] = -R1;
-    out1 = dotpv2(VectInA,VectInB)>>16;
-    VectInB[0] = R1;
-    VectInB[1] = R0;
-    out2 = dotpv2(VectInA,VectInB)>>16;
-
-    /*  Reading i0+fftLen/4 */
-    /* input is down scale by 4 to avoid overflow */
-    /* T0 = yb, T1 = xb */
-    T0 = pSrc16[i1 * 2u] >> 2u;
-    T1 = pSrc16[(i1 * 2u) + 1u] >> 2u;
-
-    /* writing the butterfly processed i0 + fftLen/4 sample */
-    /* writing output(xc', yc') in little endian format */
-    pSrc16[i1 * 2u] = out1;
-    pSrc16[(i1 * 2u) + 1u] = out2;
-
-    /*  Butterfly calculations */
-    /* input is down scale by 4 to avoid overflow */
-    /* U0 = yd, U1 = xd) */
-    U0 = pSrc16[i3 * 2u] >> 2u;
-    U1 = pSrc16[(i3 * 2u) + 1u] >> 2u;
-
-    /* T0 = yb-yd, T1 = xb-xd) */
-    T0 = clip(T0 - U0,  -32768,32767);
-    T1 = clip(T1 - U1,  -32768,32767);
-    /* R0 = (ya-yc) - (xb- xd) , R1 = (xa-xc) + (yb-yd) */
-    R0 = (q15_t) clip((q31_t) (S0 + T1), -32768,32767);
-    R1 = (q15_t) clip((q31_t) (S1 - T0),  -32768,32767);
-    /* S = (ya-yc) + (xb- xd), S1 = (xa-xc) - (yb-yd) */
-    S0 = (q15_t) clip((q31_t) (S0 - T1),  -32768,32767);
-    S1 = (q15_t) clip((q31_t) (S1 + T0),  -32768,32767);
-
     /* co1 & si1 are read from Coefficient pointer */
-   // Co1 = pCoef16[ic * 2u];
-   // Si1 = pCoef16[(ic * 2u) + 1u];
-    /*  Butterfly process for the i0+fftLen/2 sample */
-    /* xb' = (xa-yb-xc+yd)* co1 - (ya+xb-yc-xd)* (si1) */
-  //  out1 = (q15_t) ((Co1 * S0 - Si1 * S1) >> 16u);
-    /* yb' = (ya+xb-yc-xd)* co1 + (xa-yb-xc+yd)* (si1) */
-  //  out2 = (q15_t) ((Si1 * S0 + Co1 * S1) >> 16u);
-
-    VectInA = *(shortV*)(pCoef16 + (ic * 2u ));
-    VectInB[0] = S0;
-    VectInB[1] = -S1;
-    out1 = dotpv2(VectInA,VectInB)>>16;
-    VectInB[0] = S1;
-    VectInB[1] = S0;
-    out2 = dotpv2(VectInA,VectInB)>>16;
-
-    /* writing output(xb', yb') in little endian format */
-    pSrc16[i2 * 2u] = out1;
-    pSrc16[(i2 * 2u) + 1u] = out2;
-
+    W1 = riscv_radix4_twiddle_q15(pCoef16, qLen, ic);
+    W1c = shufflev4(W1, neg2(max2(W1, wMin)), conjW);
+    W1s = shufflev4(W1, W1, swapW);
+    /* co2 & si2 are read from Coefficient pointer */
+    W2 = riscv_radix4_twiddle_q15(pCoef16, qLen, 2u * ic);
+    W2c = shufflev4(W2, neg2(max2(W2, wMin)), conjW);
+    W2s = shufflev4(W2, W2, swapW);
     /* Co3 & si3 are read from Coefficient pointer */
-    //Co3 = pCoef16[3u * ic * 2u];
-    //Si3 = pCoef16[(3u * ic * 2u) + 1u];
-    /*  Butterfly process for the i0+3fftLen/4 sample */
-    /* xd' = (xa+yb-xc-yd)* Co3 - (ya-xb-yc+xd)* (si3) */
-    //out1 = (q15_t) ((Co3 * R0 - Si3 * R1) >> 16u);
-    /* yd' = (ya-xb-yc+xd)* Co3 + (xa+yb-xc-yd)* (si3) */
-    //out2 = (q15_t) ((Si3 * R0 + Co3 * R1) >> 16u);
-
-    VectInA = *(shortV*)(pCoef16 + (ic * 2u * 3u ));
-    VectInB[0] = R0;
-    VectInB[1] = -R1;
-    out1 = dotpv2(VectInA,VectInB)>>16;
-    VectInB[0] = R1;
-    VectInB[1] = R0;
-    out2 = dotpv2(VectInA,VectInB)>>16;
-
-    /* writing output(xd', yd') in little endian format */
-    pSrc16[i3 * 2u] = out1;
-    pSrc16[(i3 * 2u) + 1u] = out2;
+    W3 = riscv_radix4_twiddle_q15(pCoef16, qLen, 3u * ic);
+    W3c = shufflev4(W3, neg2(max2(W3, wMin)), conjW);
+    W3s = shufflev4(W3, W3, swapW);
 
     /*  Twiddle coefficients index modifier */
     ic = ic + twidCoefModifier;
 
-    /*  Updating input index */
-    i0 = i0 + 1u;
-
-  } while(--j);
+    /*  The same butterfly of every block */
+    for (i0 = n2 - j; i0 < totalLen; i0 += n1)
+    {
+      /*  Butterfly implementation */
 
-  /*  End of first stage process */
+      /*  index calculation for the input as, */
+      /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
+      i1 = i0 + n2;
+      i2 = i1 + n2;
+      i3 = i2 + n2;
+
+      /* input is down scale by 4 to avoid overflow */
+      A = sra2(pIn[i0], two);
+      B = sra2(pIn[i1], two);
+      C = sra2(pIn[i2], two);
+      D = sra2(pIn[i3], two);
+
+      /* R = (a + c), S = (a - c), T = (b + d) */
+      R = add2v(A, C);
+      S = sub2(A, C);
+      T = add2v(B, D);
+
+      /*  writing the butterfly processed i0 sample */
+      /* a' = a + b + c + d */
+      pSi[i0] = add2v(sra2(R, one), sra2(T, one));
+
+      /* R = (a + c) - (b + d) */
+      R = sub2(R, T);
+
+      /* writing the butterfly processed i0 + fftLen/4 sample */
+      /* c' = (a - b + c - d) * W2 */
+      pSi[i1] = pack2(dotpv2(W2c, R) >> 16, dotpv2(W2s, R) >> 16);
+
+      /* T = (b - d), Tj = -j * (b - d) */
+      T = sub2(B, D);
+      Tj = shufflev4(T, neg2(T), rotJ);
+
+      /* R = (a - c) - j * (b - d), S = (a - c) + j * (b - d) */
+      R = add2v(S, Tj);
+      S = sub2(S, Tj);
+
+      /*  Butterfly process for the i0+fftLen/2 sample */
+      /* b' = (a + j * b - c - j * d) * W1 */
+      pSi[i2] = pack2(dotpv2(W1c, S) >> 16, dotpv2(W1s, S) >> 16);
+
+      /*  Butterfly process for the i0+3fftLen/4 sample */
+      /* d' = (a - j * b - c + j * d) * W3 */
+      pSi[i3] = pack2(dotpv2(W3c, R) >> 16, dotpv2(W3s, R) >> 16);
+    }
 
+  } while(--j);
   /* data is in 4.11(q11) format */
 
+  /* end of first stage process */
 
-  /*  Start of Middle stage process */
+
+  /* start of middle stage process */
 
   /*  Twiddle coefficients index modifier */
   twidCoefModifier <<= 2u;
@@ -1271,20 +1153,21 @@ void riscv_radix4_butterfly_inverse_q15(
     for (j = 0u; j <= (n2 - 1u); j++)
     {
       /*  index calculation for the coefficients */
-     /* Co1 = pCoef16[ic * 2u];
-      Si1 = pCoef16[(ic * 2u) + 1u];
-      Co2 = pCoef16[2u * ic * 2u];
-      Si2 = pCoef16[2u * ic * 2u + 1u];
-      Co3 = pCoef16[3u * ic * 2u];
-      Si3 = pCoef16[(3u * ic * 2u) + 1u];*/
-      VectInC = *(shortV*)(pCoef16 + (ic * 2u));
-      VectInA = *(shortV*)(pCoef16 + (ic * 2u *2u));
-      VectInD = *(shortV*)(pCoef16 + (ic * 2u *3u));
+      W1 = riscv_radix4_twiddle_q15(pCoef16, qLen, ic);
+      W2 = riscv_radix4_twiddle_q15(pCoef16, qLen, 2u * ic);
+      W3 = riscv_radix4_twiddle_q15(pCoef16, qLen, 3u * ic);
+      W1c = shufflev4(W1, neg2(max2(W1, wMin)), conjW);
+      W1s = shufflev4(W1, W1, swapW);
+      W2c = shufflev4(W2, neg2(max2(W2, wMin)), conjW);
+      W2s = shufflev4(W2, W2, swapW);
+      W3c = shufflev4(W3, neg2(max2(W3, wMin)), conjW);
+      W3s = shufflev4(W3, W3, swapW);
+
       /*  Twiddle coefficients index modifier */
       ic = ic + twidCoefModifier;
 
       /*  Butterfly implementation */
-      for (i0 = j; i0 < fftLen; i0 += n1)
+      for (i0 = j; i0 < totalLen; i0 += n1)
       {
         /*  index calculation for the input as, */
         /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
@@ -1292,141 +1175,63 @@ void riscv_radix4_butterfly_inverse_q15(
         i2 = i1 + n2;
         i3 = i2 + n2;
 
-        /*  Reading i0, i0+fftLen/2 inputs */
-        /* Read ya (real), xa(imag) input */
-        T0 = pSrc16[i0 * 2u];
-        T1 = pSrc16[(i0 * 2u) + 1u];
-
-        /* Read yc (real), xc(imag) input */
-        S0 = pSrc16[i2 * 2u];
-        S1 = pSrc16[(i2 * 2u) + 1u];
-
+        A = pSi[i0];
+        B = pSi[i1];
+        C = pSi[i2];
+        D = pSi[i3];
 
-        /* R0 = (ya + yc), R1 = (xa + xc) */
-        R0 = clip(T0 + S0,  -32768,32767);
-        R1 = clip(T1 + S1, -32768,32767);
-        /* S0 = (ya - yc), S1 = (xa - xc) */
-        S0 = clip(T0 - S0,  -32768,32767);
-        S1 = clip(T1 - S1,  -32768,32767);
-
-        /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
-        /* Read yb (real), xb(imag) input */
-        T0 = pSrc16[i1 * 2u];
-        T1 = pSrc16[(i1 * 2u) + 1u];
-
-        /* Read yd (real), xd(imag) input */
-        U0 = pSrc16[i3 * 2u];
-        U1 = pSrc16[(i3 * 2u) + 1u];
-
-        /* T0 = (yb + yd), T1 = (xb + xd) */
-        T0 = clip(T0 + U0,  -32768,32767);
-        T1 = clip(T1 + U1,  -32768,32767);
+        /* R = (a + c), S = (a - c), T = (b + d) */
+        R = add2v(A, C);
+        S = sub2(A, C);
+        T = add2v(B, D);
 
         /*  writing the butterfly processed i0 sample */
-        /* xa' = xa + xb + xc + xd */
-        /* ya' = ya + yb + yc + yd */
-        pSrc16[i0 * 2u] = ((R0 >> 1u) + (T0 >> 1u)) >> 1u;
-        pSrc16[(i0 * 2u) + 1u] = ((R1 >> 1u) + (T1 >> 1u)) >> 1u;
-
-        /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc) - (xb + xd) */
-        R0 = (R0 >> 1u) - (T0 >> 1u);
-        R1 = (R1 >> 1u) - (T1 >> 1u);
-
-        /* (ya-yb+yc-yd)* (si2) - (xa-xb+xc-xd)* co2 */
-       // out1 = (q15_t) ((Co2 * R0 - Si2 * R1) >> 16);
-        /* (ya-yb+yc-yd)* co2 + (xa-xb+xc-xd)* (si2) */
-       // out2 = (q15_t) ((Si2 * R0 + Co2 * R1) >> 16);
-        VectInB[0] = R0;
-        VectInB[1] = -R1;
-        out1 = dotpv2(VectInA,VectInB)>>16;
-        VectInB[0] = R1;
-        VectInB[1] = R0;
-        out2 = dotpv2(VectInA,VectInB)>>16;
-
-        /*  Reading i0+3fftLen/4 */
-        /* Read yb (real), xb(imag) input */
-        T0 = pSrc16[i1 * 2u];
-        T1 = pSrc16[(i1 * 2u) + 1u];
-
-        /*  writing the butterfly processed i0 + fftLen/4 sample */
-        /* xc' = (xa-xb+xc-xd)* co2 - (ya-yb+yc-yd)* (si2) */
-        /* yc' = (ya-yb+yc-yd)* co2 + (xa-xb+xc-xd)* (si2) */
-        pSrc16[i1 * 2u] = out1;
-        pSrc16[(i1 * 2u) + 1u] = out2;
+        /* a' = a + b + c + d */
+        pSi[i0] = sra2(add2v(sra2(R, one), sra2(T, one)), one);
 
-        /*  Butterfly calculations */
-        /* Read yd (real), xd(imag) input */
-        U0 = pSrc16[i3 * 2u];
-        U1 = pSrc16[(i3 * 2u) + 1u];
+        /* R = (a + c) - (b + d) */
+        R = sub2(sra2(R, one), sra2(T, one));
 
-        /* T0 = yb-yd, T1 = xb-xd) */
-        T0 = clip(T0 - U0, -32768,32767);
-        T1 = clip(T1 - U1,  -32768,32767);
+        /* c' = (a - b + c - d) * W2 */
+        pSi[i1] = pack2(dotpv2(W2c, R) >> 16, dotpv2(W2s, R) >> 16);
 
-        /* R0 = (ya-yc) - (xb- xd) , R1 = (xa-xc) + (yb-yd) */
-        R0 = (S0 >> 1u) + (T1 >> 1u);
-        R1 = (S1 >> 1u) - (T0 >> 1u);
+        /* T = (b - d), Tj = -j * (b - d) */
+        T = sra2(sub2(B, D), one);
+        Tj = shufflev4(T, neg2(T), rotJ);
 
-        /* S1 = (ya-yc) + (xb- xd), S1 = (xa-xc) - (yb-yd) */
-        S0 = (S0 >> 1u) - (T1 >> 1u);
-        S1 = (S1 >> 1u) + (T0 >> 1u);
+        /* R = (a - c) - j * (b - d), S = (a - c) + j * (b - d) */
+        S = sra2(S, one);
+        R = add2v(S, Tj);
+        S = sub2(S, Tj);
 
         /*  Butterfly process for the i0+fftLen/2 sample */
-       // out1 = (q15_t) ((Co1 * S0 - Si1 * S1) >> 16u);
-       // out2 = (q15_t) ((Si1 * S0 + Co1 * S1) >> 16u);
-
-        VectInB[0] = S0;
-        VectInB[1] = -S1;
-        out1 = dotpv2(VectInC,VectInB)>>16;
-        VectInB[0] = S1;
-        VectInB[1] = S0;
-        out2 = dotpv2(VectInC,VectInB)>>16;
-
-        /* xb' = (xa-yb-xc+yd)* co1 - (ya+xb-yc-xd)* (si1) */
-        /* yb' = (ya+xb-yc-xd)* co1 + (xa-yb-xc+yd)* (si1) */
-        pSrc16[i2 * 2u] = out1;
-        pSrc16[(i2 * 2u) + 1u] = out2;
+        /* b' = (a + j * b - c - j * d) * W1 */
+        pSi[i2] = pack2(dotpv2(W1c, S) >> 16, dotpv2(W1s, S) >> 16);
 
         /*  Butterfly process for the i0+3fftLen/4 sample */
-      //  out1 = (q15_t) ((Co3 * R0 - Si3 * R1) >> 16u);
-
-      //  out2 = (q15_t) ((Si3 * R0 + Co3 * R1) >> 16u);
-
-        VectInB[0] = R0;
-        VectInB[1] = -R1;
-        out1 = dotpv2(VectInD,VectInB)>>16;
-        VectInB[0] = R1;
-        VectInB[1] = R0;
-        out2 = dotpv2(VectInD,VectInB)>>16;
-        /* xd' = (xa+yb-xc-yd)* Co3 - (ya-xb-yc+xd)* (si3) */
-        /* yd' = (ya-xb-yc+xd)* Co3 + (xa+yb-xc-yd)* (si3) */
-        pSrc16[i3 * 2u] = out1;
-        pSrc16[(i3 * 2u) + 1u] = out2;
-
-
+        /* d' = (a - j * b - c + j * d) * W3 */
+        pSi[i3] = pack2(dotpv2(W3c, R) >> 16, dotpv2(W3s, R) >> 16);
       }
     }
     /*  Twiddle coefficients index modifier */
     twidCoefModifier <<= 2u;
   }
-  /*  End of Middle stages process */
+  /* end of middle stage process */
 
 
   /* data is in 10.6(q6) format for the 1024 point */
-  /* data is in 8.8(q8) format for the 256 point   */
-  /* data is in 6.10(q10) format for the 64 point  */
-  /* data is in 4.12(q12) format for the 16 point  */
-
-  /* start of last stage process */
-
+  /* data is in 8.8(q8) format for the 256 point */
+  /* data is in 6.10(q10) format for the 64 point */
+  /* data is in 4.12(q12) format for the 16 point */
 
   /*  Initializations for the last stage */
   n1 = n2;
-
   n2 >>= 2u;
 
+  /* start of last stage process */
+
   /*  Butterfly implementation */
-  for (i0 = 0u; i0 <= (fftLen - n1); i0 += n1)
+  for (i0 = 0u; i0 <= (totalLen - n1); i0 += n1)
   {
     /*  index calculation for the input as, */
     /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
@@ -1434,85 +1239,51 @@ void riscv_radix4_butterfly_inverse_q15(
     i2 = i1 + n2;
     i3 = i2 + n2;
 
-    /*  Reading i0, i0+fftLen/2 inputs */
-    /* Read ya (real), xa(imag) input */
-    T0 = pSrc16[i0 * 2u];
-    T1 = pSrc16[(i0 * 2u) + 1u];
-    /* Read yc (real), xc(imag) input */
-    S0 = pSrc16[i2 * 2u];
-    S1 = pSrc16[(i2 * 2u) + 1u];
-
-    /* R0 = (ya + yc), R1 = (xa + xc) */
-    R0 = clip(T0 + S0,  -32768,32767);
-    R1 = clip(T1 + S1, -32768,32767);
-    /* S0 = (ya - yc), S1 = (xa - xc) */
-    S0 = clip(T0 - S0,  -32768,32767);
-    S1 = clip(T1 - S1,  -32768,32767);
+    A = pSi[i0];
+    B = pSi[i1];
+    C = pSi[i2];
+    D = pSi[i3];
 
-    /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
-    /* Read yb (real), xb(imag) input */
-    T0 = pSrc16[i1 * 2u];
-    T1 = pSrc16[(i1 * 2u) + 1u];
-    /* Read yd (real), xd(imag) input */
-    U0 = pSrc16[i3 * 2u];
-    U1 = pSrc16[(i3 * 2u) + 1u];
-
-    /* T0 = (yb + yd), T1 = (xb + xd) */
-    T0 = clip(T0 + U0, -32768,32767);
-    T1 = clip(T1 + U1,  -32768,32767);
+    /* R = (a + c), S = (a - c), T = (b + d) */
+    R = add2v(A, C);
+    S = sub2(A, C);
+    T = add2v(B, D);
 
     /*  writing the butterfly processed i0 sample */
-    /* xa' = xa + xb + xc + xd */
-    /* ya' = ya + yb + yc + yd */
-    pSrc16[i0 * 2u] = (R0 >> 1u) + (T0 >> 1u);
-    pSrc16[(i0 * 2u) + 1u] = (R1 >> 1u) + (T1 >> 1u);
-
-    /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc) - (xb + xd) */
-    R0 = (R0 >> 1u) - (T0 >> 1u);
-    R1 = (R1 >> 1u) - (T1 >> 1u);
-
-    /* Read yb (real), xb(imag) input */
-    T0 = pSrc16[i1 * 2u];
-    T1 = pSrc16[(i1 * 2u) + 1u];
+    /* a' = a + b + c + d */
+    pSi[i0] = add2v(sra2(R, one), sra2(T, one));
 
     /*  writing the butterfly processed i0 + fftLen/4 sample */
-    /* xc' = (xa-xb+xc-xd) */
-    /* yc' = (ya-yb+yc-yd) */
-    pSrc16[i1 * 2u] = R0;
-    pSrc16[(i1 * 2u) + 1u] = R1;
+    /* c' = a - b + c - d */
+    pSi[i1] = sub2(sra2(R, one), sra2(T, one));
 
-    /* Read yd (real), xd(imag) input */
-    U0 = pSrc16[i3 * 2u];
-    U1 = pSrc16[(i3 * 2u) + 1u];
-    /* T0 = (yb - yd), T1 = (xb - xd) */
-    T0 = clip(T0 - U0,  -32768,32767);
-    T1 = clip(T1 - U1,  -32768,32767);
+    /* T = (b - d), Tj = -j * (b - d) */
+    T = sra2(sub2(B, D), one);
+    Tj = shufflev4(T, neg2(T), rotJ);
+    S = sra2(S, one);
 
     /*  writing the butterfly processed i0 + fftLen/2 sample */
-    /* xb' = (xa-yb-xc+yd) */
-    /* yb' = (ya+xb-yc-xd) */
-    pSrc16[i2 * 2u] = (S0 >> 1u) - (T1 >> 1u);
-    pSrc16[(i2 * 2u) + 1u] = (S1 >> 1u) + (T0 >> 1u);
-
+    /* b' = a + j * b - c - j * d */
+    pSi[i2] = sub2(S, Tj);
 
     /*  writing the butterfly processed i0 + 3fftLen/4 sample */
-    /* xd' = (xa+yb-xc-yd) */
-    /* yd' = (ya-xb-yc+xd) */
-    pSrc16[i3 * 2u] = (S0 >> 1u) + (T1 >> 1u);
-    pSrc16[(i3 * 2u) + 1u] = (S1 >> 1u) - (T0 >> 1u);
+    /* d' = a - j * b - c + j * d */
+    pSi[i3] = add2v(S, Tj);
   }
-  /* end of last stage  process */
+
+  /* end of last stage process */
 
   /* output is in 11.5(q5) format for the 1024 point */
   /* output is in 9.7(q7) format for the 256 point   */
   /* output is in 7.9(q9) format for the 64 point  */
   /* output is in 5.11(q11) format for the 16 point  */
 
-
 #else
   q15_t R0, R1, S0, S1, T0, T1, U0, U1;
   q15_t Co1, Si1, Co2, Si2, Co3, Si3, out1, out2;
   uint32_t n1, n2, ic, i0, i1, i2, i3, j, k;
+  uint32_t totalLen = fftLen * numBlocks;
+  uint32_t qLen = (fftLen * twidCoefModifier) >> 2u;   /* Quarter-wave length of the twiddle table */
 
   /* Total process is divided into three stages */
 
@@ -1528,9 +1299,7 @@ void riscv_radix4_butterfly_inverse_q15(
   /* Index for twiddle coefficient */
   ic = 0u;
 
-  /* Index for input read and output write */
-  i0 = 0u;
-
+  /* Butterfly counter */
   j = n2;
 
   /* Input is in 1.15(q15) format */
@@ -1538,118 +1307,117 @@ void riscv_radix4_butterfly_inverse_q15(
   /*  Start of first stage process */
   do
   {
-    /*  Butterfly implementation */
-
-    /*  index calculation for the input as, */
-    /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
-    i1 = i0 + n2;
-    i2 = i1 + n2;
-    i3 = i2 + n2;
-
-    /*  Reading i0, i0+fftLen/2 inputs */
-    /* input is down scale by 4 to avoid overflow */
-    /* Read ya (real), xa(imag) input */
-    T0 = pSrc16[i0 * 2u] >> 2u;
-    T1 = pSrc16[(i0 * 2u) + 1u] >> 2u;
-    /* input is down scale by 4 to avoid overflow */
-    /* Read yc (real), xc(imag) input */
-    S0 = pSrc16[i2 * 2u] >> 2u;
-    S1 = pSrc16[(i2 * 2u) + 1u] >> 2u;
-
-    /* R0 = (ya + yc), R1 = (xa + xc) */
-    R0 = __SSAT(T0 + S0, 16u);
-    R1 = __SSAT(T1 + S1, 16u);
-    /* S0 = (ya - yc), S1 = (xa - xc) */
-    S0 = __SSAT(T0 - S0, 16u);
-    S1 = __SSAT(T1 - S1, 16u);
-
-    /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
-    /* input is down scale by 4 to avoid overflow */
-    /* Read yb (real), xb(imag) input */
-    T0 = pSrc16[i1 * 2u] >> 2u;
-    T1 = pSrc16[(i1 * 2u) + 1u] >> 2u;
-    /* Read yd (real), xd(imag) input */
-    /* input is down scale by 4 to avoid overflow */
-    U0 = pSrc16[i3 * 2u] >> 2u;
-    U1 = pSrc16[(i3 * 2u) + 1u] >> 2u;
-
-    /* T0 = (yb + yd), T1 = (xb + xd) */
-    T0 = __SSAT(T0 + U0, 16u);
-    T1 = __SSAT(T1 + U1, 16u);
-
-    /*  writing the butterfly processed i0 sample */
-    /* xa' = xa + xb + xc + xd */
-    /* ya' = ya + yb + yc + yd */
-    pSrc16[i0 * 2u] = (R0 >> 1u) + (T0 >> 1u);
-    pSrc16[(i0 * 2u) + 1u] = (R1 >> 1u) + (T1 >> 1u);
-
-    /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc)- (xb + xd) */
-    R0 = __SSAT(R0 - T0, 16u);
-    R1 = __SSAT(R1 - T1, 16u);
-    /* co2 & si2 are read from Coefficient pointer */
-    Co2 = pCoef16[2u * ic * 2u];
-    Si2 = pCoef16[(2u * ic * 2u) + 1u];
-    /* xc' = (xa-xb+xc-xd)* co2 - (ya-yb+yc-yd)* (si2) */
-    out1 = (q15_t) ((Co2 * R0 - Si2 * R1) >> 16u);
-    /* yc' = (ya-yb+yc-yd)* co2 + (xa-xb+xc-xd)* (si2) */
-    out2 = (q15_t) ((Si2 * R0 + Co2 * R1) >> 16u);
-
-    /*  Reading i0+fftLen/4 */
-    /* input is down scale by 4 to avoid overflow */
-    /* T0 = yb, T1 = xb */
-    T0 = pSrc16[i1 * 2u] >> 2u;
-    T1 = pSrc16[(i1 * 2u) + 1u] >> 2u;
-
-    /* writing the butterfly processed i0 + fftLen/4 sample */
-    /* writing output(xc', yc') in little endian format */
-    pSrc16[i1 * 2u] = out1;
-    pSrc16[(i1 * 2u) + 1u] = out2;
-
-    /*  Butterfly calculations */
-    /* input is down scale by 4 to avoid overflow */
-    /* U0 = yd, U1 = xd) */
-    U0 = pSrc16[i3 * 2u] >> 2u;
-    U1 = pSrc16[(i3 * 2u) + 1u] >> 2u;
-
-    /* T0 = yb-yd, T1 = xb-xd) */
-    T0 = __SSAT(T0 - U0, 16u);
-    T1 = __SSAT(T1 - U1, 16u);
-    /* R0 = (ya-yc) - (xb- xd) , R1 = (xa-xc) + (yb-yd) */
-    R0 = (q15_t) __SSAT((q31_t) (S0 + T1), 16);
-    R1 = (q15_t) __SSAT((q31_t) (S1 - T0), 16);
-    /* S = (ya-yc) + (xb- xd), S1 = (xa-xc) - (yb-yd) */
-    S0 = (q15_t) __SSAT((q31_t) (S0 - T1), 16);
-    S1 = (q15_t) __SSAT((q31_t) (S1 + T0), 16);
-
     /* co1 & si1 are read from Coefficient pointer */
-    Co1 = pCoef16[ic * 2u];
-    Si1 = pCoef16[(ic * 2u) + 1u];
-    /*  Butterfly process for the i0+fftLen/2 sample */
-    /* xb' = (xa-yb-xc+yd)* co1 - (ya+xb-yc-xd)* (si1) */
-    out1 = (q15_t) ((Co1 * S0 - Si1 * S1) >> 16u);
-    /* yb' = (ya+xb-yc-xd)* co1 + (xa-yb-xc+yd)* (si1) */
-    out2 = (q15_t) ((Si1 * S0 + Co1 * S1) >> 16u);
-    /* writing output(xb', yb') in little endian format */
-    pSrc16[i2 * 2u] = out1;
-    pSrc16[(i2 * 2u) + 1u] = out2;
-
+    riscv_radix4_twiddle_co_si_q15(pCoef16, qLen, ic, &Co1, &Si1);
+    /* co2 & si2 are read from Coefficient pointer */
+    riscv_radix4_twiddle_co_si_q15(pCoef16, qLen, 2u * ic, &Co2, &Si2);
     /* Co3 & si3 are read from Coefficient pointer */
-    Co3 = pCoef16[3u * ic * 2u];
-    Si3 = pCoef16[(3u * ic * 2u) + 1u];
-    /*  Butterfly process for the i0+3fftLen/4 sample */
-    /* xd' = (xa+yb-xc-yd)* Co3 - (ya-xb-yc+xd)* (si3) */
-    out1 = (q15_t) ((Co3 * R0 - Si3 * R1) >> 16u);
-    /* yd' = (ya-xb-yc+xd)* Co3 + (xa+yb-xc-yd)* (si3) */
-    out2 = (q15_t) ((Si3 * R0 + Co3 * R1) >> 16u);
-    /* writing output(xd', yd') in little endian format */
-    pSrc16[i3 * 2u] = out1;
-    pSrc16[(i3 * 2u) + 1u] = out2;
+    riscv_radix4_twiddle_co_si_q15(pCoef16, qLen, 3u * ic, &Co3, &Si3);
 
     /*  Twiddle coefficients index modifier */
     ic = ic + twidCoefModifier;
 
-    /*  Updating input index */
-    i0 = i0 + 1u;
+    /*  The same butterfly of every block */
+    for (i0 = n2 - j; i0 < totalLen; i0 += n1)
+    {
+      /*  Butterfly implementation */
+
+      /*  index calculation for the input as, */
+      /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
+      i1 = i0 + n2;
+      i2 = i1 + n2;
+      i3 = i2 + n2;
+
+      /*  Reading i0, i0+fftLen/2 inputs */
+      /* input is down scale by 4 to avoid overflow */
+      /* Read ya (real), xa(imag) input */
+      T0 = pIn16[i0 * 2u] >> 2u;
+      T1 = pIn16[(i0 * 2u) + 1u] >> 2u;
+      /* input is down scale by 4 to avoid overflow */
+      /* Read yc (real), xc(imag) input */
+      S0 = pIn16[i2 * 2u] >> 2u;
+      S1 = pIn16[(i2 * 2u) + 1u] >> 2u;
+
+      /* R0 = (ya + yc), R1 = (xa + xc) */
+      R0 = __SSAT(T0 + S0, 16u);
+      R1 = __SSAT(T1 + S1, 16u);
+      /* S0 = (ya - yc), S1 = (xa - xc) */
+      S0 = __SSAT(T0 - S0, 16u);
+      S1 = __SSAT(T1 - S1, 16u);
+
+      /*  Reading i0+fftLen/4 , i0+3fftLen/4 inputs */
+      /* input is down scale by 4 to avoid overflow */
+      /* Read yb (real), xb(imag) input */
+      T0 = pIn16[i1 * 2u] >> 2u;
+      T1 = pIn16[(i1 * 2u) + 1u] >> 2u;
+      /* Read yd (real), xd(imag) input */
+      /* input is down scale by 4 to avoid overflow */
+      U0 = pIn16[i3 * 2u] >> 2u;
+      U1 = pIn16[(i3 * 2u) + 1u] >> 2u;
+
+      /* T0 = (yb + yd), T1 = (xb + xd) */
+      T0 = __SSAT(T0 + U0, 16u);
+      T1 = __SSAT(T1 + U1, 16u);
+
+      /*  writing the butterfly processed i0 sample */
+      /* xa' = xa + xb + xc + xd */
+      /* ya' = ya + yb + yc + yd */
+      pSrc16[i0 * 2u] = (R0 >> 1u) + (T0 >> 1u);
+      pSrc16[(i0 * 2u) + 1u] = (R1 >> 1u) + (T1 >> 1u);
+
+      /* R0 = (ya + yc) - (yb + yd), R1 = (xa + xc)- (xb + xd) */
+      R0 = __SSAT(R0 - T0, 16u);
+      R1 = __SSAT(R1 - T1, 16u);
+      /* xc' = (xa-xb+xc-xd)* co2 - (ya-yb+yc-yd)* (si2) */
+      out1 = (q15_t) ((Co2 * R0 - Si2 * R1) >> 16u);
+      /* yc' = (ya-yb+yc-yd)* co2 + (xa-xb+xc-xd)* (si2) */
+      out2 = (q15_t) ((Si2 * R0 + Co2 * R1) >> 16u);
+
+      /*  Reading i0+fftLen/4 */
+      /* input is down scale by 4 to avoid overflow */
+      /* T0 = yb, T1 = xb */
+      T0 = pIn16[i1 * 2u] >> 2u;
+      T1 = pIn16[(i1 * 2u) + 1u] >> 2u;
+
+      /* writing the butterfly processed i0 + fftLen/4 sample */
+      /* writing output(xc', yc') in little endian format */
+      pSrc16[i1 * 2u] = out1;
+      pSrc16[(i1 * 2u) + 1u] = out2;
+
+      /*  Butterfly calculations */
+      /* input is down scale by 4 to avoid overflow */
+      /* U0 = yd, U1 = xd) */
+      U0 = pIn16[i3 * 2u] >> 2u;
+      U1 = pIn16[(i3 * 2u) + 1u] >> 2u;
+
+      /* T0 = yb-yd, T1 = xb-xd) */
+      T0 = __SSAT(T0 - U0, 16u);
+      T1 = __SSAT(T1 - U1, 16u);
+      /* R0 = (ya-yc) - (xb- xd) , R1 = (xa-xc) + (yb-yd) */
+      R0 = (q15_t) __SSAT((q31_t) (S0 + T1), 16);
+      R1 = (q15_t) __SSAT((q31_t) (S1 - T0), 16);
+      /* S = (ya-yc) + (xb- xd), S1 = (xa-xc) - (yb-yd) */
+      S0 = (q15_t) __SSAT((q31_t) (S0 - T1), 16);
+      S1 = (q15_t) __SSAT((q31_t) (S1 + T0), 16);
+
+      /*  Butterfly process for the i0+fftLen/2 sample */
+      /* xb' = (xa-yb-xc+yd)* co1 - (ya+xb-yc-xd)* (si1) */
+      out1 = (q15_t) ((Co1 * S0 - Si1 * S1) >> 16u);
+      /* yb' = (ya+xb-yc-xd)* co1 + (xa-yb-xc+yd)* (si1) */
+      out2 = (q15_t) ((Si1 * S0 + Co1 * S1) >> 16u);
+      /* writing output(xb', yb') in little endian format */
+      pSrc16[i2 * 2u] = out1;
+      pSrc16[(i2 * 2u) + 1u] = out2;
+
+      /*  Butterfly process for the i0+3fftLen/4 sample */
+      /* xd' = (xa+yb-xc-yd)* Co3 - (ya-xb-yc+xd)* (si3) */
+      out1 = (q15_t) ((Co3 * R0 - Si3 * R1) >> 16u);
+      /* yd' = (ya-xb-yc+xd)* Co3 + (xa+yb-xc-yd)* (si3) */
+      out2 = (q15_t) ((Si3 * R0 + Co3 * R1) >> 16u);
+      /* writing output(xd', yd') in little endian format */
+      pSrc16[i3 * 2u] = out1;
+      pSrc16[(i3 * 2u) + 1u] = out2;
+    }
 
   } while(--j);
 
@@ -1674,18 +1442,15 @@ void riscv_radix4_butterfly_inverse_q15(
     for (j = 0u; j <= (n2 - 1u); j++)
     {
       /*  index calculation for the coefficients */
-      Co1 = pCoef16[ic * 2u];
-      Si1 = pCoef16[(ic * 2u) + 1u];
-      Co2 = pCoef16[2u * ic * 2u];
-      Si2 = pCoef16[2u * ic * 2u + 1u];
-      Co3 = pCoef16[3u * ic * 2u];
-      Si3 = pCoef16[(3u * ic * 2u) + 1u];
+      riscv_radix4_twiddle_co_si_q15(pCoef16, qLen, ic, &Co1, &Si1);
+      riscv_radix4_twiddle_co_si_q15(pCoef16, qLen, 2u * ic, &Co2, &Si2);
+      riscv_radix4_twiddle_co_si_q15(pCoef16, qLen, 3u * ic, &Co3, &Si3);
 
       /*  Twiddle coefficients index modifier */
       ic = ic + twidCoefModifier;
 
       /*  Butterfly implementation */
-      for (i0 = j; i0 < fftLen; i0 += n1)
+      for (i0 = j; i0 < totalLen; i0 += n1)
       {
         /*  index calculation for the input as, */
         /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
@@ -1805,7 +1570,7 @@ void riscv_radix4_butterfly_inverse_q15(
   n2 >>= 2u;
 
   /*  Butterfly implementation */
-  for (i0 = 0u; i0 <= (fftLen - n1); i0 += n1)
+  for (i0 = 0u; i0 <= (totalLen - n1); i0 += n1)
   {
     /*  index calculation for the input as, */
     /*  pSrc16[i0 + 0], pSrc16[i0 + fftLen/4], pSrc16[i0 + fftLen/2], pSrc16[i0 + 3fftLen/4] */
@@ -1889,3 +1654,23 @@ void riscv_radix4_butterfly_inverse_q15(
 
 #endif
 }
+
+/**    
+ * @brief  Q15 CIFFT butterfly process reading the first stage inputs from a separate buffer.   
+ * @param[in]      *pIn16           points to the input buffer, only read by the first stage. It may be equal to pSrc16.   
+ * @param[out]     *pSrc16          points to the buffer that holds the result, of Q15 data type.   
+ * @param[in]      fftLen           length of the FFT.   
+ * @param[in]      *pCoef16         points to twiddle coefficient buffer.   
+ * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.   
+ * @return none.   
+ */
+
+void riscv_radix4_butterfly_inverse_oop_q15(
+  const q15_t * pIn16,
+  q15_t * pSrc16,
+  uint32_t fftLen,
+  q15_t * pCoef16,
+  uint32_t twidCoefModifier)
+{
+  riscv_radix4_butterfly_inverse_batch_q15(pIn16, pSrc16, fftLen, pCoef16, twidCoefModifier, 1u);
+}
@@ -55,6 +55,20 @@ uint32_t fftLen,
 q31_t * pCoef,
 uint32_t twidCoefModifier);
 
+void riscv_radix4_butterfly_oop_q31(
+const q31_t * pIn,
+q31_t * pSrc,
+uint32_t fftLen,
+q31_t * pCoef,
+uint32_t twidCoefModifier);
+
+void riscv_radix4_butterfly_inverse_oop_q31(
+const q31_t * pIn,
+q31_t * pSrc,
+uint32_t fftLen,
+q31_t * pCoef,
+uint32_t twidCoefModifier);
+
 void riscv_bitreversal_q31(
 q31_t * pSrc,
 uint32_t fftLen,
@@ -93,6 +107,7 @@ void riscv_cfft_radix4_q31(
   const riscv_cfft_radix4_instance_q31 * S,
   q31_t * pSrc)
 {
+  RISCV_PROFILE(riscv_cfft_radix4_q31);
   if(S->ifftFlag == 1u)
   {
     /* Complex IFFT radix-4 */
@@ -168,6 +183,317 @@ void riscv_radix4_butterfly_q31(
   q31_t * pCoef,
   uint32_t twidCoefModifier)
 {
+  riscv_radix4_butterfly_oop_q31(pSrc, pSrc, fftLen, pCoef, twidCoefModifier);
+}
+
+/**    
+ * @brief  Q31 CFFT butterfly process reading the first stage inputs from a separate buffer.   
+ * @param[in]      *pIn             points to the input buffer, only read by the first stage. It may be equal to pSrc.   
+ * @param[out]     *pSrc            points to the buffer that holds the result, of Q31 data type.   
+ * @param[in]      fftLen           length of the FFT.   
+ * @param[in]      *pCoef           points to twiddle coefficient buffer.   
+ * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.   
+ * @return none.   
+ */
+
+RISCV_DSP_FASTCODE(riscv_radix4_butterfly_oop_q31)
+void riscv_radix4_butterfly_oop_q31(
+  const q31_t * pIn,
+  q31_t * pSrc,
+  uint32_t fftLen,
+  q31_t * pCoef,
+  uint32_t twidCoefModifier)
+{
+#if defined (USE_DSP_RISCV)
+
+  uint32_t n1, n2, ia1, ia2, ia3, i, j, k, nBfly;
+  q31_t t1, t2, r1, r2, s1, s2, co1, co2, co3, si1, si2, si3;
+  q31_t xa, xb, xc, xd;
+  q31_t ya, yb, yc, yd;
+  q31_t p0, p1;
+  q31_t *pC1, *pC2, *pC3;
+  q31_t *pSi0;
+  q31_t *pSi1;
+  q31_t *pSi2;
+  q31_t *pSi3;
+  const q31_t *pIn0, *pIn1, *pIn2, *pIn3;
+
+  /* Every butterfly first loads its four complex inputs into registers, so    
+   * no input is read again after an output has been stored, and all    
+   * pointers and twiddle indexes advance by a constant stride which maps    
+   * to post-increment loads/stores and hardware loops. The twiddle products    
+   * keep the upper 32 bits of the 64-bit product (mulh) and give the same    
+   * results as the plain C path. */
+
+  /* Start of first stage process */
+
+  /*  Initializations for the first stage */
+  n2 = fftLen >> 2u;
+
+  pSi0 = pSrc;
+  pSi1 = pSi0 + 2u * n2;
+  pSi2 = pSi1 + 2u * n2;
+  pSi3 = pSi2 + 2u * n2;
+
+  pIn0 = pIn;
+  pIn1 = pIn0 + 2u * n2;
+  pIn2 = pIn1 + 2u * n2;
+  pIn3 = pIn2 + 2u * n2;
+
+  pC1 = pCoef;
+  pC2 = pCoef;
+  pC3 = pCoef;
+
+  /*  Calculation of first stage */
+  for (j = n2; j > 0u; j--)
+  {
+    /* Twiddle coefficients for the indexes ia1, 2 * ia1 and 3 * ia1 */
+    co1 = pC1[0];
+    si1 = pC1[1];
+    co2 = pC2[0];
+    si2 = pC2[1];
+    co3 = pC3[0];
+    si3 = pC3[1];
+    pC1 += 2u * twidCoefModifier;
+    pC2 += 4u * twidCoefModifier;
+    pC3 += 6u * twidCoefModifier;
+
+    /* input is in 1.31(q31) format and provide 4 guard bits for the input */
+    xa = pIn0[0] >> 4u;
+    ya = pIn0[1] >> 4u;
+    xb = pIn1[0] >> 4u;
+    yb = pIn1[1] >> 4u;
+    xc = pIn2[0] >> 4u;
+    yc = pIn2[1] >> 4u;
+    xd = pIn3[0] >> 4u;
+    yd = pIn3[1] >> 4u;
+
+    /* xa + xc, xa - xc, ya + yc, ya - yc, xb + xd, yb + yd */
+    r1 = xa + xc;
+    r2 = xa - xc;
+    s1 = ya + yc;
+    s2 = ya - yc;
+    t1 = xb + xd;
+    t2 = yb + yd;
+
+    /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+    pSi0[0] = r1 + t1;
+    pSi0[1] = s1 + t2;
+    pSi0 += 2u;
+
+    /* (xa + xc) - (xb + xd), (ya + yc) - (yb + yd) */
+    r1 = r1 - t1;
+    s1 = s1 - t2;
+
+    /* xc' = (xa-xb+xc-xd)co2 + (ya-yb+yc-yd)(si2), yc' = (ya-yb+yc-yd)co2 - (xa-xb+xc-xd)(si2) */
+    mult_32x32_keep32(p0, r1, co2);
+    multAcc_32x32_keep32(p0, s1, si2);
+    mult_32x32_keep32(p1, s1, co2);
+    multSub_32x32_keep32(p1, r1, si2);
+    pSi1[0] = p0 << 1u;
+    pSi1[1] = p1 << 1u;
+    pSi1 += 2u;
+
+    /* (yb - yd), (xb - xd) */
+    t1 = yb - yd;
+    t2 = xb - xd;
+
+    r1 = r2 + t1;
+    r2 = r2 - t1;
+    s1 = s2 - t2;
+    s2 = s2 + t2;
+
+    /* xb' and yb' with the co1, si1 twiddle */
+    mult_32x32_keep32(p0, r1, co1);
+    multAcc_32x32_keep32(p0, s1, si1);
+    mult_32x32_keep32(p1, s1, co1);
+    multSub_32x32_keep32(p1, r1, si1);
+    pSi2[0] = p0 << 1u;
+    pSi2[1] = p1 << 1u;
+    pSi2 += 2u;
+
+    /* xd' and yd' with the co3, si3 twiddle */
+    mult_32x32_keep32(p0, r2, co3);
+    multAcc_32x32_keep32(p0, s2, si3);
+    mult_32x32_keep32(p1, s2, co3);
+    multSub_32x32_keep32(p1, r2, si3);
+    pSi3[0] = p0 << 1u;
+    pSi3[1] = p1 << 1u;
+    pSi3 += 2u;
+
+    pIn0 += 2u;
+    pIn1 += 2u;
+    pIn2 += 2u;
+    pIn3 += 2u;
+  }
+
+  /* data is in 5.27(q27) format */
+  /* end of first stage process */
+
+  /* start of Middle stages process */
+
+  /* each stage in middle stages provides two down scaling of the input */
+
+  twidCoefModifier <<= 2u;
+  nBfly = 1u;
+
+  for (k = fftLen / 4u; k > 4u; k >>= 2u)
+  {
+    /*  Initializations for the middle stage */
+    n1 = n2;
+    n2 >>= 2u;
+    nBfly <<= 2u;
+    ia1 = 0u;
+
+    for (j = 0u; j < n2; j++)
+    {
+      /*  index calculation for the coefficients */
+      ia2 = ia1 + ia1;
+      ia3 = ia2 + ia1;
+      co1 = pCoef[ia1 * 2u];
+      si1 = pCoef[(ia1 * 2u) + 1u];
+      co2 = pCoef[ia2 * 2u];
+      si2 = pCoef[(ia2 * 2u) + 1u];
+      co3 = pCoef[ia3 * 2u];
+      si3 = pCoef[(ia3 * 2u) + 1u];
+      /*  Twiddle coefficients index modifier */
+      ia1 = ia1 + twidCoefModifier;
+
+      pSi0 = pSrc + 2u * j;
+      pSi1 = pSi0 + 2u * n2;
+      pSi2 = pSi1 + 2u * n2;
+      pSi3 = pSi2 + 2u * n2;
+
+      /* fftLen / n1 butterflies share the same twiddle coefficients */
+      for (i = nBfly; i > 0u; i--)
+      {
+        xa = pSi0[0];
+        ya = pSi0[1];
+        xb = pSi1[0];
+        yb = pSi1[1];
+        xc = pSi2[0];
+        yc = pSi2[1];
+        xd = pSi3[0];
+        yd = pSi3[1];
+
+        /* xa + xc, xa - xc, ya + yc, ya - yc, xb + xd, yb + yd */
+        r1 = xa + xc;
+        r2 = xa - xc;
+        s1 = ya + yc;
+        s2 = ya - yc;
+        t1 = xb + xd;
+        t2 = yb + yd;
+
+        /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+        pSi0[0] = (r1 + t1) >> 2u;
+        pSi0[1] = (s1 + t2) >> 2u;
+        pSi0 += 2u * n1;
+
+        /* (xa + xc) - (xb + xd), (ya + yc) - (yb + yd) */
+        r1 = r1 - t1;
+        s1 = s1 - t2;
+
+        /* xc' = (xa-xb+xc-xd)co2 + (ya-yb+yc-yd)(si2), yc' = (ya-yb+yc-yd)co2 - (xa-xb+xc-xd)(si2) */
+        mult_32x32_keep32(p0, r1, co2);
+        multAcc_32x32_keep32(p0, s1, si2);
+        mult_32x32_keep32(p1, s1, co2);
+        multSub_32x32_keep32(p1, r1, si2);
+        pSi1[0] = p0 >> 1u;
+        pSi1[1] = p1 >> 1u;
+        pSi1 += 2u * n1;
+
+        /* (yb - yd), (xb - xd) */
+        t1 = yb - yd;
+        t2 = xb - xd;
+
+        r1 = r2 + t1;
+        r2 = r2 - t1;
+        s1 = s2 - t2;
+        s2 = s2 + t2;
+
+        /* xb' and yb' with the co1, si1 twiddle */
+        mult_32x32_keep32(p0, r1, co1);
+        multAcc_32x32_keep32(p0, s1, si1);
+        mult_32x32_keep32(p1, s1, co1);
+        multSub_32x32_keep32(p1, r1, si1);
+        pSi2[0] = p0 >> 1u;
+        pSi2[1] = p1 >> 1u;
+        pSi2 += 2u * n1;
+
+        /* xd' and yd' with the co3, si3 twiddle */
+        mult_32x32_keep32(p0, r2, co3);
+        multAcc_32x32_keep32(p0, s2, si3);
+        mult_32x32_keep32(p1, s2, co3);
+        multSub_32x32_keep32(p1, r2, si3);
+        pSi3[0] = p0 >> 1u;
+        pSi3[1] = p1 >> 1u;
+        pSi3 += 2u * n1;
+      }
+    }
+    twidCoefModifier <<= 2u;
+  }
+
+  /* End of Middle stages process */
+
+  /* data is in 11.21(q21) format for the 1024 point as there are 3 middle stages */
+  /* data is in 9.23(q23) format for the 256 point as there are 2 middle stages */
+  /* data is in 7.25(q25) format for the 64 point as there are 1 middle stage */
+  /* data is in 5.27(q27) format for the 16 point as there are no middle stages */
+
+  /* start of Last stage process */
+  /*  Initializations for the last stage */
+  pSi0 = pSrc;
+
+  /*  Calculations of last stage */
+  for (j = fftLen >> 2u; j > 0u; j--)
+  {
+    xa = pSi0[0];
+    ya = pSi0[1];
+    xb = pSi0[2];
+    yb = pSi0[3];
+    xc = pSi0[4];
+    yc = pSi0[5];
+    xd = pSi0[6];
+    yd = pSi0[7];
+
+    r1 = xa + xc;
+    r2 = xa - xc;
+    s1 = ya + yc;
+    s2 = ya - yc;
+    t1 = xb + xd;
+    t2 = yb + yd;
+
+    /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+    pSi0[0] = r1 + t1;
+    pSi0[1] = s1 + t2;
+
+    /* xc' = xa - xb + xc - xd, yc' = ya - yb + yc - yd */
+    pSi0[2] = r1 - t1;
+    pSi0[3] = s1 - t2;
+
+    t1 = yb - yd;
+    t2 = xb - xd;
+
+    /* xb', yb' */
+    pSi0[4] = r2 + t1;
+    pSi0[5] = s2 - t2;
+
+    /* xd', yd' */
+    pSi0[6] = r2 - t1;
+    pSi0[7] = s2 + t2;
+
+    pSi0 += 8u;
+  }
+
+  /* output is in 11.21(q21) format for the 1024 point */
+  /* output is in 9.23(q23) format for the 256 point */
+  /* output is in 7.25(q25) format for the 64 point */
+  /* output is in 5.27(q27) format for the 16 point */
+
+  /* End of last stage process */
+
+#else
+
   uint32_t n1, n2, ia1, ia2, ia3, i0, j, k;
   q31_t t1, t2, r1, r2, s1, s2, co1, co2, co3, si1, si2, si3;
 
@@ -181,6 +507,7 @@ void riscv_radix4_butterfly_q31(
   q31_t *pSi1;
   q31_t *pSi2;
   q31_t *pSi3;
+  const q31_t *pIn0, *pIn1, *pIn2, *pIn3;
   q63_t xaya, xbyb, xcyc, xdyd;
   /* Total process is divided into three stages */
 
@@ -204,6 +531,11 @@ void riscv_radix4_butterfly_q31(
   pSi2 = pSi1 + 2 * n2;
   pSi3 = pSi2 + 2 * n2;
 
+  pIn0 = pIn;
+  pIn1 = pIn0 + 2 * n2;
+  pIn2 = pIn1 + 2 * n2;
+  pIn3 = pIn2 + 2 * n2;
+
   /*  Calculation of first stage */
   do
   {
@@ -211,24 +543,24 @@ void riscv_radix4_butterfly_q31(
 
     /*  Butterfly implementation */
     /* xa + xc */
-    r1 = (pSi0[0] >> 4u) + (pSi2[0] >> 4u);
+    r1 = (pIn0[0] >> 4u) + (pIn2[0] >> 4u);
     /* xa - xc */
-    r2 = (pSi0[0] >> 4u) - (pSi2[0] >> 4u);
+    r2 = (pIn0[0] >> 4u) - (pIn2[0] >> 4u);
 
     /* xb + xd */
-    t1 = (pSi1[0] >> 4u) + (pSi3[0] >> 4u);
+    t1 = (pIn1[0] >> 4u) + (pIn3[0] >> 4u);
 
     /* ya + yc */
-    s1 = (pSi0[1] >> 4u) + (pSi2[1] >> 4u);
+    s1 = (pIn0[1] >> 4u) + (pIn2[1] >> 4u);
     /* ya - yc */
-    s2 = (pSi0[1] >> 4u) - (pSi2[1] >> 4u);
+    s2 = (pIn0[1] >> 4u) - (pIn2[1] >> 4u);
 
     /* xa' = xa + xb + xc + xd */
     *pSi0++ = (r1 + t1);
     /* (xa + xc) - (xb + xd) */
     r1 = r1 - t1;
     /* yb + yd */
-    t2 = (pSi1[1] >> 4u) + (pSi3[1] >> 4u);
+    t2 = (pIn1[1] >> 4u) + (pIn3[1] >> 4u);
 
     /* ya' = ya + yb + yc + yd */
     *pSi0++ = (s1 + t2);
@@ -237,9 +569,9 @@ void riscv_radix4_butterfly_q31(
     s1 = s1 - t2;
 
     /* yb - yd */
-    t1 = (pSi1[1] >> 4u) - (pSi3[1] >> 4u);
+    t1 = (pIn1[1] >> 4u) - (pIn3[1] >> 4u);
     /* xb - xd */
-    t2 = (pSi1[0] >> 4u) - (pSi3[0] >> 4u);
+    t2 = (pIn1[0] >> 4u) - (pIn3[0] >> 4u);
 
     /*  index calculation for the coefficients */
     ia2 = 2u * ia1;
@@ -291,6 +623,11 @@ void riscv_radix4_butterfly_q31(
     /*  Twiddle coefficients index modifier */
     ia1 = ia1 + twidCoefModifier;
 
+    pIn0 += 2u;
+    pIn1 += 2u;
+    pIn2 += 2u;
+    pIn3 += 2u;
+
   } while(--j);
 
   /* end of first stage process */
@@ -487,6 +824,8 @@ void riscv_radix4_butterfly_q31(
 
   /* End of last stage process */
 
+
+#endif
 }
 
 
@@ -546,6 +885,317 @@ void riscv_radix4_butterfly_inverse_q31(
   q31_t * pCoef,
   uint32_t twidCoefModifier)
 {
+  riscv_radix4_butterfly_inverse_oop_q31(pSrc, pSrc, fftLen, pCoef, twidCoefModifier);
+}
+
+/**    
+ * @brief  Q31 CIFFT butterfly process reading the first stage inputs from a separate buffer.   
+ * @param[in]      *pIn             points to the input buffer, only read by the first stage. It may be equal to pSrc.   
+ * @param[out]     *pSrc            points to the buffer that holds the result, of Q31 data type.   
+ * @param[in]      fftLen           length of the FFT.   
+ * @param[in]      *pCoef           points to twiddle coefficient buffer.   
+ * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.   
+ * @return none.   
+ */
+
+RISCV_DSP_FASTCODE(riscv_radix4_butterfly_inverse_oop_q31)
+void riscv_radix4_butterfly_inverse_oop_q31(
+  const q31_t * pIn,
+  q31_t * pSrc,
+  uint32_t fftLen,
+  q31_t * pCoef,
+  uint32_t twidCoefModifier)
+{
+#if defined (USE_DSP_RISCV)
+
+  uint32_t n1, n2, ia1, ia2, ia3, i, j, k, nBfly;
+  q31_t t1, t2, r1, r2, s1, s2, co1, co2, co3, si1, si2, si3;
+  q31_t xa, xb, xc, xd;
+  q31_t ya, yb, yc, yd;
+  q31_t p0, p1;
+  q31_t *pC1, *pC2, *pC3;
+  q31_t *pSi0;
+  q31_t *pSi1;
+  q31_t *pSi2;
+  q31_t *pSi3;
+  const q31_t *pIn0, *pIn1, *pIn2, *pIn3;
+
+  /* Every butterfly first loads its four complex inputs into registers, so    
+   * no input is read again after an output has been stored, and all    
+   * pointers and twiddle indexes advance by a constant stride which maps    
+   * to post-increment loads/stores and hardware loops. The twiddle products    
+   * keep the upper 32 bits of the 64-bit product (mulh) and give the same    
+   * results as the plain C path. */
+
+  /* Start of first stage process */
+
+  /*  Initializations for the first stage */
+  n2 = fftLen >> 2u;
+
+  pSi0 = pSrc;
+  pSi1 = pSi0 + 2u * n2;
+  pSi2 = pSi1 + 2u * n2;
+  pSi3 = pSi2 + 2u * n2;
+
+  pIn0 = pIn;
+  pIn1 = pIn0 + 2u * n2;
+  pIn2 = pIn1 + 2u * n2;
+  pIn3 = pIn2 + 2u * n2;
+
+  pC1 = pCoef;
+  pC2 = pCoef;
+  pC3 = pCoef;
+
+  /*  Calculation of first stage */
+  for (j = n2; j > 0u; j--)
+  {
+    /* Twiddle coefficients for the indexes ia1, 2 * ia1 and 3 * ia1 */
+    co1 = pC1[0];
+    si1 = pC1[1];
+    co2 = pC2[0];
+    si2 = pC2[1];
+    co3 = pC3[0];
+    si3 = pC3[1];
+    pC1 += 2u * twidCoefModifier;
+    pC2 += 4u * twidCoefModifier;
+    pC3 += 6u * twidCoefModifier;
+
+    /* input is in 1.31(q31) format and provide 4 guard bits for the input */
+    xa = pIn0[0] >> 4u;
+    ya = pIn0[1] >> 4u;
+    xb = pIn1[0] >> 4u;
+    yb = pIn1[1] >> 4u;
+    xc = pIn2[0] >> 4u;
+    yc = pIn2[1] >> 4u;
+    xd = pIn3[0] >> 4u;
+    yd = pIn3[1] >> 4u;
+
+    /* xa + xc, xa - xc, ya + yc, ya - yc, xb + xd, yb + yd */
+    r1 = xa + xc;
+    r2 = xa - xc;
+    s1 = ya + yc;
+    s2 = ya - yc;
+    t1 = xb + xd;
+    t2 = yb + yd;
+
+    /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+    pSi0[0] = r1 + t1;
+    pSi0[1] = s1 + t2;
+    pSi0 += 2u;
+
+    /* (xa + xc) - (xb + xd), (ya + yc) - (yb + yd) */
+    r1 = r1 - t1;
+    s1 = s1 - t2;
+
+    /* xc' = (xa-xb+xc-xd)co2 - (ya-yb+yc-yd)(si2), yc' = (ya-yb+yc-yd)co2 + (xa-xb+xc-xd)(si2) */
+    mult_32x32_keep32(p0, r1, co2);
+    multSub_32x32_keep32(p0, s1, si2);
+    mult_32x32_keep32(p1, s1, co2);
+    multAcc_32x32_keep32(p1, r1, si2);
+    pSi1[0] = p0 << 1u;
+    pSi1[1] = p1 << 1u;
+    pSi1 += 2u;
+
+    /* (yb - yd), (xb - xd) */
+    t1 = yb - yd;
+    t2 = xb - xd;
+
+    r1 = r2 - t1;
+    r2 = r2 + t1;
+    s1 = s2 + t2;
+    s2 = s2 - t2;
+
+    /* xb' and yb' with the co1, si1 twiddle */
+    mult_32x32_keep32(p0, r1, co1);
+    multSub_32x32_keep32(p0, s1, si1);
+    mult_32x32_keep32(p1, s1, co1);
+    multAcc_32x32_keep32(p1, r1, si1);
+    pSi2[0] = p0 << 1u;
+    pSi2[1] = p1 << 1u;
+    pSi2 += 2u;
+
+    /* xd' and yd' with the co3, si3 twiddle */
+    mult_32x32_keep32(p0, r2, co3);
+    multSub_32x32_keep32(p0, s2, si3);
+    mult_32x32_keep32(p1, s2, co3);
+    multAcc_32x32_keep32(p1, r2, si3);
+    pSi3[0] = p0 << 1u;
+    pSi3[1] = p1 << 1u;
+    pSi3 += 2u;
+
+    pIn0 += 2u;
+    pIn1 += 2u;
+    pIn2 += 2u;
+    pIn3 += 2u;
+  }
+
+  /* data is in 5.27(q27) format */
+  /* end of first stage process */
+
+  /* start of Middle stages process */
+
+  /* each stage in middle stages provides two down scaling of the input */
+
+  twidCoefModifier <<= 2u;
+  nBfly = 1u;
+
+  for (k = fftLen / 4u; k > 4u; k >>= 2u)
+  {
+    /*  Initializations for the middle stage */
+    n1 = n2;
+    n2 >>= 2u;
+    nBfly <<= 2u;
+    ia1 = 0u;
+
+    for (j = 0u; j < n2; j++)
+    {
+      /*  index calculation for the coefficients */
+      ia2 = ia1 + ia1;
+      ia3 = ia2 + ia1;
+      co1 = pCoef[ia1 * 2u];
+      si1 = pCoef[(ia1 * 2u) + 1u];
+      co2 = pCoef[ia2 * 2u];
+      si2 = pCoef[(ia2 * 2u) + 1u];
+      co3 = pCoef[ia3 * 2u];
+      si3 = pCoef[(ia3 * 2u) + 1u];
+      /*  Twiddle coefficients index modifier */
+      ia1 = ia1 + twidCoefModifier;
+
+      pSi0 = pSrc + 2u * j;
+      pSi1 = pSi0 + 2u * n2;
+      pSi2 = pSi1 + 2u * n2;
+      pSi3 = pSi2 + 2u * n2;
+
+      /* fftLen / n1 butterflies share the same twiddle coefficients */
+      for (i = nBfly; i > 0u; i--)
+      {
+        xa = pSi0[0];
+        ya = pSi0[1];
+        xb = pSi1[0];
+        yb = pSi1[1];
+        xc = pSi2[0];
+        yc = pSi2[1];
+        xd = pSi3[0];
+        yd = pSi3[1];
+
+        /* xa + xc, xa - xc, ya + yc, ya - yc, xb + xd, yb + yd */
+        r1 = xa + xc;
+        r2 = xa - xc;
+        s1 = ya + yc;
+        s2 = ya - yc;
+        t1 = xb + xd;
+        t2 = yb + yd;
+
+        /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+        pSi0[0] = (r1 + t1) >> 2u;
+        pSi0[1] = (s1 + t2) >> 2u;
+        pSi0 += 2u * n1;
+
+        /* (xa + xc) - (xb + xd), (ya + yc) - (yb + yd) */
+        r1 = r1 - t1;
+        s1 = s1 - t2;
+
+        /* xc' = (xa-xb+xc-xd)co2 - (ya-yb+yc-yd)(si2), yc' = (ya-yb+yc-yd)co2 + (xa-xb+xc-xd)(si2) */
+        mult_32x32_keep32(p0, r1, co2);
+        multSub_32x32_keep32(p0, s1, si2);
+        mult_32x32_keep32(p1, s1, co2);
+        multAcc_32x32_keep32(p1, r1, si2);
+        pSi1[0] = p0 >> 1u;
+        pSi1[1] = p1 >> 1u;
+        pSi1 += 2u * n1;
+
+        /* (yb - yd), (xb - xd) */
+        t1 = yb - yd;
+        t2 = xb - xd;
+
+        r1 = r2 - t1;
+        r2 = r2 + t1;
+        s1 = s2 + t2;
+        s2 = s2 - t2;
+
+        /* xb' and yb' with the co1, si1 twiddle */
+        mult_32x32_keep32(p0, r1, co1);
+        multSub_32x32_keep32(p0, s1, si1);
+        mult_32x32_keep32(p1, s1, co1);
+        multAcc_32x32_keep32(p1, r1, si1);
+        pSi2[0] = p0 >> 1u;
+        pSi2[1] = p1 >> 1u;
+        pSi2 += 2u * n1;
+
+        /* xd' and yd' with the co3, si3 twiddle */
+        mult_32x32_keep32(p0, r2, co3);
+        multSub_32x32_keep32(p0, s2, si3);
+        mult_32x32_keep32(p1, s2, co3);
+        multAcc_32x32_keep32(p1, r2, si3);
+        pSi3[0] = p0 >> 1u;
+        pSi3[1] = p1 >> 1u;
+        pSi3 += 2u * n1;
+      }
+    }
+    twidCoefModifier <<= 2u;
+  }
+
+  /* End of Middle stages process */
+
+  /* data is in 11.21(q21) format for the 1024 point as there are 3 middle stages */
+  /* data is in 9.23(q23) format for the 256 point as there are 2 middle stages */
+  /* data is in 7.25(q25) format for the 64 point as there are 1 middle stage */
+  /* data is in 5.27(q27) format for the 16 point as there are no middle stages */
+
+  /* start of Last stage process */
+  /*  Initializations for the last stage */
+  pSi0 = pSrc;
+
+  /*  Calculations of last stage */
+  for (j = fftLen >> 2u; j > 0u; j--)
+  {
+    xa = pSi0[0];
+    ya = pSi0[1];
+    xb = pSi0[2];
+    yb = pSi0[3];
+    xc = pSi0[4];
+    yc = pSi0[5];
+    xd = pSi0[6];
+    yd = pSi0[7];
+
+    r1 = xa + xc;
+    r2 = xa - xc;
+    s1 = ya + yc;
+    s2 = ya - yc;
+    t1 = xb + xd;
+    t2 = yb + yd;
+
+    /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+    pSi0[0] = r1 + t1;
+    pSi0[1] = s1 + t2;
+
+    /* xc' = xa - xb + xc - xd, yc' = ya - yb + yc - yd */
+    pSi0[2] = r1 - t1;
+    pSi0[3] = s1 - t2;
+
+    t1 = yb - yd;
+    t2 = xb - xd;
+
+    /* xb', yb' */
+    pSi0[4] = r2 - t1;
+    pSi0[5] = s2 + t2;
+
+    /* xd', yd' */
+    pSi0[6] = r2 + t1;
+    pSi0[7] = s2 - t2;
+
+    pSi0 += 8u;
+  }
+
+  /* output is in 11.21(q21) format for the 1024 point */
+  /* output is in 9.23(q23) format for the 256 point */
+  /* output is in 7.25(q25) format for the 64 point */
+  /* output is in 5.27(q27) format for the 16 point */
+
+  /* End of last stage process */
+
+#else
+
   uint32_t n1, n2, ia1, ia2, ia3, i0, j, k;
   q31_t t1, t2, r1, r2, s1, s2, co1, co2, co3, si1, si2, si3;
   q31_t xa, xb, xc, xd;
@@ -558,6 +1208,7 @@ void riscv_radix4_butterfly_inverse_q31(
   q31_t *pSi1;
   q31_t *pSi2;
   q31_t *pSi3;
+  const q31_t *pIn0, *pIn1, *pIn2, *pIn3;
   q63_t xaya, xbyb, xcyc, xdyd;
 
   /* input is be 1.31(q31) format for all FFT sizes */
@@ -581,28 +1232,33 @@ void riscv_radix4_butterfly_inverse_q31(
   pSi2 = pSi1 + 2 * n2;
   pSi3 = pSi2 + 2 * n2;
 
+  pIn0 = pIn;
+  pIn1 = pIn0 + 2 * n2;
+  pIn2 = pIn1 + 2 * n2;
+  pIn3 = pIn2 + 2 * n2;
+
   do
   {
     /*  Butterfly implementation */
     /* xa + xc */
-    r1 = (pSi0[0] >> 4u) + (pSi2[0] >> 4u);
+    r1 = (pIn0[0] >> 4u) + (pIn2[0] >> 4u);
     /* xa - xc */
-    r2 = (pSi0[0] >> 4u) - (pSi2[0] >> 4u);
+    r2 = (pIn0[0] >> 4u) - (pIn2[0] >> 4u);
 
     /* xb + xd */
-    t1 = (pSi1[0] >> 4u) + (pSi3[0] >> 4u);
+    t1 = (pIn1[0] >> 4u) + (pIn3[0] >> 4u);
 
     /* ya + yc */
-    s1 = (pSi0[1] >> 4u) + (pSi2[1] >> 4u);
+    s1 = (pIn0[1] >> 4u) + (pIn2[1] >> 4u);
     /* ya - yc */
-    s2 = (pSi0[1] >> 4u) - (pSi2[1] >> 4u);
+    s2 = (pIn0[1] >> 4u) - (pIn2[1] >> 4u);
 
     /* xa' = xa + xb + xc + xd */
     *pSi0++ = (r1 + t1);
     /* (xa + xc) - (xb + xd) */
     r1 = r1 - t1;
     /* yb + yd */
-    t2 = (pSi1[1] >> 4u) + (pSi3[1] >> 4u);
+    t2 = (pIn1[1] >> 4u) + (pIn3[1] >> 4u);
     /* ya' = ya + yb + yc + yd */
     *pSi0++ = (s1 + t2);
 
@@ -610,9 +1266,9 @@ void riscv_radix4_butterfly_inverse_q31(
     s1 = s1 - t2;
 
     /* yb - yd */
-    t1 = (pSi1[1] >> 4u) - (pSi3[1] >> 4u);
+    t1 = (pIn1[1] >> 4u) - (pIn3[1] >> 4u);
     /* xb - xd */
-    t2 = (pSi1[0] >> 4u) - (pSi3[0] >> 4u);
+    t2 = (pIn1[0] >> 4u) - (pIn3[0] >> 4u);
 
     /*  index calculation for the coefficients */
     ia2 = 2u * ia1;
@@ -664,6 +1320,11 @@ void riscv_radix4_butterfly_inverse_q31(
     /*  Twiddle coefficients index modifier */
     ia1 = ia1 + twidCoefModifier;
 
+    pIn0 += 2u;
+    pIn1 += 2u;
+    pIn2 += 2u;
+    pIn3 += 2u;
+
   } while(--j);
 
   /* data is in 5.27(q27) format */
@@ -854,4 +1515,6 @@ void riscv_radix4_butterfly_inverse_q31(
   /* output is in 5.27(q27) format for the 16 point */
 
   /* End of last stage process */
+
+#endif
 }
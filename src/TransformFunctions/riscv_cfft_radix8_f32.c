@@ -41,6 +41,7 @@
 * -------------------------------------------------------------------- */
 
 #include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
 
 /**    
 * @ingroup groupTransforms    
@@ -131,19 +132,32 @@
 
 
 /*    
-* @brief  Core function for the floating-point CFFT butterfly process.   
+* @brief  Runs the radix-8 stages of the floating-point CFFT butterfly process.   
+* @param[in]      *pIn             points to the input buffer, only read by the first stage. It may be equal to pSrc.   
 * @param[in, out] *pSrc            points to the in-place buffer of floating-point data type.   
 * @param[in]      fftLen           length of the FFT.   
 * @param[in]      *pCoef           points to the twiddle coefficient buffer.   
 * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.   
+* @param[in]      stopLen          stages are processed while the butterfly span is larger than stopLen:   
+*                                  1 runs all stages, 8 leaves the last stage to the caller.   
+* @param[in]      numBlocks        number of transforms of fftLen samples stored back to back, every stage    
+*                                  is run over all of them with the same twiddle factors.   
+* @param[in]      mode             RISCV_RADIX8_SWAP_IN, RISCV_RADIX8_SWAP_OUT and RISCV_RADIX8_SCALE flags of the inverse transform, 0 for the forward one.   
+* @param[in]      scale            factor of the first stage outputs with RISCV_RADIX8_SCALE.   
 * @return none.   
 */
 
-void riscv_radix8_butterfly_f32(
+RISCV_DSP_FASTCODE(riscv_radix8_stages_f32)
+static void riscv_radix8_stages_f32(
+const float32_t * pIn,
 float32_t * pSrc,
 uint16_t fftLen,
 const float32_t * pCoef,
-uint16_t twidCoefModifier)
+uint16_t twidCoefModifier,
+uint16_t stopLen,
+uint16_t numBlocks,
+uint32_t mode,
+float32_t scale)
 {
    uint32_t ia1, ia2, ia3, ia4, ia5, ia6, ia7;
    uint32_t i1, i2, i3, i4, i5, i6, i7, i8;
@@ -157,14 +171,29 @@ uint16_t twidCoefModifier)
    float32_t co2, co3, co4, co5, co6, co7, co8;
    float32_t si2, si3, si4, si5, si6, si7, si8;
    const float32_t C81 = 0.70710678118f;
+   uint32_t totalLen = (uint32_t) fftLen * numBlocks;
+   const float32_t *pRe, *pIm;
+   float32_t *pOutRe, *pOutIm;
+   uint32_t scaled = mode & RISCV_RADIX8_SCALE;
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+   uint32_t qLen = ((uint32_t) fftLen * twidCoefModifier) >> 2u;
+#endif
+
+   /* The inverse transform reads the input with the real and imaginary parts swapped */
+   pRe = ((mode & RISCV_RADIX8_SWAP_IN) != 0u) ? pIn + 1 : pIn;
+   pIm = ((mode & RISCV_RADIX8_SWAP_IN) != 0u) ? pIn : pIn + 1;
 
    n2 = fftLen;
    
-   do 
+   while(n2 > stopLen)
    {
       n1 = n2;
       n2 = n2 >> 3;
       i1 = 0;
+
+      /* and swaps them back in the last stage */
+      pOutRe = ((n2 == 1u) && ((mode & RISCV_RADIX8_SWAP_OUT) != 0u)) ? pSrc + 1 : pSrc;
+      pOutIm = ((n2 == 1u) && ((mode & RISCV_RADIX8_SWAP_OUT) != 0u)) ? pSrc : pSrc + 1;
       
       do
       {
@@ -175,38 +204,51 @@ uint16_t twidCoefModifier)
          i6 = i5 + n2;
          i7 = i6 + n2;
          i8 = i7 + n2;
-         r1 = pSrc[2 * i1] + pSrc[2 * i5];
-         r5 = pSrc[2 * i1] - pSrc[2 * i5];
-         r2 = pSrc[2 * i2] + pSrc[2 * i6];
-         r6 = pSrc[2 * i2] - pSrc[2 * i6];
-         r3 = pSrc[2 * i3] + pSrc[2 * i7];
-         r7 = pSrc[2 * i3] - pSrc[2 * i7];
-         r4 = pSrc[2 * i4] + pSrc[2 * i8];
-         r8 = pSrc[2 * i4] - pSrc[2 * i8];
+         r1 = pRe[2 * i1] + pRe[2 * i5];
+         r5 = pRe[2 * i1] - pRe[2 * i5];
+         r2 = pRe[2 * i2] + pRe[2 * i6];
+         r6 = pRe[2 * i2] - pRe[2 * i6];
+         r3 = pRe[2 * i3] + pRe[2 * i7];
+         r7 = pRe[2 * i3] - pRe[2 * i7];
+         r4 = pRe[2 * i4] + pRe[2 * i8];
+         r8 = pRe[2 * i4] - pRe[2 * i8];
+         if(scaled != 0u)
+         {
+            r1 *= scale;  r5 *= scale;  r2 *= scale;  r6 *= scale;
+            r3 *= scale;  r7 *= scale;  r4 *= scale;  r8 *= scale;
+         }
          t1 = r1 - r3;
          r1 = r1 + r3;
          r3 = r2 - r4;
          r2 = r2 + r4;
-         pSrc[2 * i1] = r1 + r2;   
-         pSrc[2 * i5] = r1 - r2;
-         r1 = pSrc[2 * i1 + 1] + pSrc[2 * i5 + 1];
-         s5 = pSrc[2 * i1 + 1] - pSrc[2 * i5 + 1];
-         r2 = pSrc[2 * i2 + 1] + pSrc[2 * i6 + 1];
-         s6 = pSrc[2 * i2 + 1] - pSrc[2 * i6 + 1];
-         s3 = pSrc[2 * i3 + 1] + pSrc[2 * i7 + 1];
-         s7 = pSrc[2 * i3 + 1] - pSrc[2 * i7 + 1];
-         r4 = pSrc[2 * i4 + 1] + pSrc[2 * i8 + 1];
-         s8 = pSrc[2 * i4 + 1] - pSrc[2 * i8 + 1];
+         p1 = r1 + r2;
+         p2 = r1 - r2;
+         r1 = pIm[2 * i1] + pIm[2 * i5];
+         s5 = pIm[2 * i1] - pIm[2 * i5];
+         r2 = pIm[2 * i2] + pIm[2 * i6];
+         s6 = pIm[2 * i2] - pIm[2 * i6];
+         s3 = pIm[2 * i3] + pIm[2 * i7];
+         s7 = pIm[2 * i3] - pIm[2 * i7];
+         r4 = pIm[2 * i4] + pIm[2 * i8];
+         s8 = pIm[2 * i4] - pIm[2 * i8];
+         if(scaled != 0u)
+         {
+            r1 *= scale;  s5 *= scale;  r2 *= scale;  s6 *= scale;
+            s3 *= scale;  s7 *= scale;  r4 *= scale;  s8 *= scale;
+         }
          t2 = r1 - s3;
          r1 = r1 + s3;
          s3 = r2 - r4;
          r2 = r2 + r4;
-         pSrc[2 * i1 + 1] = r1 + r2;
-         pSrc[2 * i5 + 1] = r1 - r2;
-         pSrc[2 * i3]     = t1 + s3;
-         pSrc[2 * i7]     = t1 - s3;
-         pSrc[2 * i3 + 1] = t2 - r3;
-         pSrc[2 * i7 + 1] = t2 + r3;
+         /* all inputs are read before the first store, the swapped in-place stages need it */
+         pOutRe[2 * i1] = p1;   
+         pOutRe[2 * i5] = p2;
+         pOutIm[2 * i1] = r1 + r2;
+         pOutIm[2 * i5] = r1 - r2;
+         pOutRe[2 * i3] = t1 + s3;
+         pOutRe[2 * i7] = t1 - s3;
+         pOutIm[2 * i3] = t2 - r3;
+         pOutIm[2 * i7] = t2 + r3;
          r1 = (r6 - r8) * C81;
          r6 = (r6 + r8) * C81;
          r2 = (s6 - s8) * C81;
@@ -219,17 +261,17 @@ uint16_t twidCoefModifier)
          s5 = s5 + r2;
          s8 = s7 - s6;
          s7 = s7 + s6;
-         pSrc[2 * i2]     = r5 + s7;
-         pSrc[2 * i8]     = r5 - s7;
-         pSrc[2 * i6]     = t1 + s8;
-         pSrc[2 * i4]     = t1 - s8;
-         pSrc[2 * i2 + 1] = s5 - r7;
-         pSrc[2 * i8 + 1] = s5 + r7;
-         pSrc[2 * i6 + 1] = t2 - r8;
-         pSrc[2 * i4 + 1] = t2 + r8;
+         pOutRe[2 * i2] = r5 + s7;
+         pOutRe[2 * i8] = r5 - s7;
+         pOutRe[2 * i6] = t1 + s8;
+         pOutRe[2 * i4] = t1 - s8;
+         pOutIm[2 * i2] = s5 - r7;
+         pOutIm[2 * i8] = s5 + r7;
+         pOutIm[2 * i6] = t2 - r8;
+         pOutIm[2 * i4] = t2 + r8;
          
          i1 += n1;
-      } while(i1 < fftLen);
+      } while(i1 < totalLen);
       
       if(n2 < 8)
          break;
@@ -249,6 +291,16 @@ uint16_t twidCoefModifier)
          ia6 = ia5 + id;
          ia7 = ia6 + id;
                   
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+         /*  fold the twiddle factors of the group from the quarter-wave table */
+         riscv_twiddle_fold_f32(pCoef, qLen, ia1, &co2, &si2);
+         riscv_twiddle_fold_f32(pCoef, qLen, ia2, &co3, &si3);
+         riscv_twiddle_fold_f32(pCoef, qLen, ia3, &co4, &si4);
+         riscv_twiddle_fold_f32(pCoef, qLen, ia4, &co5, &si5);
+         riscv_twiddle_fold_f32(pCoef, qLen, ia5, &co6, &si6);
+         riscv_twiddle_fold_f32(pCoef, qLen, ia6, &co7, &si7);
+         riscv_twiddle_fold_f32(pCoef, qLen, ia7, &co8, &si8);
+#else
          co2 = pCoef[2 * ia1];
          co3 = pCoef[2 * ia2];
          co4 = pCoef[2 * ia3];
@@ -263,6 +315,7 @@ uint16_t twidCoefModifier)
          si6 = pCoef[2 * ia5 + 1];
          si7 = pCoef[2 * ia6 + 1];
          si8 = pCoef[2 * ia7 + 1];         
+#endif
          
          i1 = j;
          
@@ -276,28 +329,35 @@ uint16_t twidCoefModifier)
             i6 = i5 + n2;
             i7 = i6 + n2;
             i8 = i7 + n2;
-            r1 = pSrc[2 * i1] + pSrc[2 * i5];
-            r5 = pSrc[2 * i1] - pSrc[2 * i5];
-            r2 = pSrc[2 * i2] + pSrc[2 * i6];
-            r6 = pSrc[2 * i2] - pSrc[2 * i6];
-            r3 = pSrc[2 * i3] + pSrc[2 * i7];
-            r7 = pSrc[2 * i3] - pSrc[2 * i7];
-            r4 = pSrc[2 * i4] + pSrc[2 * i8];
-            r8 = pSrc[2 * i4] - pSrc[2 * i8];
+            r1 = pRe[2 * i1] + pRe[2 * i5];
+            r5 = pRe[2 * i1] - pRe[2 * i5];
+            r2 = pRe[2 * i2] + pRe[2 * i6];
+            r6 = pRe[2 * i2] - pRe[2 * i6];
+            r3 = pRe[2 * i3] + pRe[2 * i7];
+            r7 = pRe[2 * i3] - pRe[2 * i7];
+            r4 = pRe[2 * i4] + pRe[2 * i8];
+            r8 = pRe[2 * i4] - pRe[2 * i8];
+            s1 = pIm[2 * i1] + pIm[2 * i5];
+            s5 = pIm[2 * i1] - pIm[2 * i5];
+            s2 = pIm[2 * i2] + pIm[2 * i6];
+            s6 = pIm[2 * i2] - pIm[2 * i6];
+            s3 = pIm[2 * i3] + pIm[2 * i7];
+            s7 = pIm[2 * i3] - pIm[2 * i7];
+            s4 = pIm[2 * i4] + pIm[2 * i8];
+            s8 = pIm[2 * i4] - pIm[2 * i8];
+            if(scaled != 0u)
+            {
+               r1 *= scale;  r5 *= scale;  r2 *= scale;  r6 *= scale;
+               r3 *= scale;  r7 *= scale;  r4 *= scale;  r8 *= scale;
+               s1 *= scale;  s5 *= scale;  s2 *= scale;  s6 *= scale;
+               s3 *= scale;  s7 *= scale;  s4 *= scale;  s8 *= scale;
+            }
             t1 = r1 - r3;
             r1 = r1 + r3;
             r3 = r2 - r4;
             r2 = r2 + r4;
             pSrc[2 * i1] = r1 + r2;
             r2 = r1 - r2;
-            s1 = pSrc[2 * i1 + 1] + pSrc[2 * i5 + 1];
-            s5 = pSrc[2 * i1 + 1] - pSrc[2 * i5 + 1];
-            s2 = pSrc[2 * i2 + 1] + pSrc[2 * i6 + 1];
-            s6 = pSrc[2 * i2 + 1] - pSrc[2 * i6 + 1];
-            s3 = pSrc[2 * i3 + 1] + pSrc[2 * i7 + 1];
-            s7 = pSrc[2 * i3 + 1] - pSrc[2 * i7 + 1];
-            s4 = pSrc[2 * i4 + 1] + pSrc[2 * i8 + 1];
-            s8 = pSrc[2 * i4 + 1] - pSrc[2 * i8 + 1];
             t2 = s1 - s3;
             s1 = s1 + s3;
             s3 = s2 - s4;
@@ -372,13 +432,209 @@ uint16_t twidCoefModifier)
             pSrc[2 * i4 + 1] = p3 - p4;
             
             i1 += n1;
-         } while(i1 < fftLen);
+         } while(i1 < totalLen);
          
          j++;
       } while(j < n2);
       
       twidCoefModifier <<= 3;
-   } while(n2 > 7);   
+
+      /* The later stages work in place on data that is already scaled */
+      pRe = pSrc;
+      pIm = pSrc + 1;
+      scaled = 0u;
+   }
+}
+
+/*    
+* @brief  Core function for the floating-point CFFT butterfly process.   
+* @param[in, out] *pSrc            points to the in-place buffer of floating-point data type.   
+* @param[in]      fftLen           length of the FFT.   
+* @param[in]      *pCoef           points to the twiddle coefficient buffer.   
+* @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.   
+* @param[in]      mode             RISCV_RADIX8_SWAP_IN, RISCV_RADIX8_SWAP_OUT and RISCV_RADIX8_SCALE flags of the inverse transform, 0 for the forward one.   
+* @param[in]      scale            factor of the first stage outputs with RISCV_RADIX8_SCALE.   
+* @return none.   
+*/
+
+void riscv_radix8_butterfly_f32(
+float32_t * pSrc,
+uint16_t fftLen,
+const float32_t * pCoef,
+uint16_t twidCoefModifier,
+uint32_t mode,
+float32_t scale)
+{
+   riscv_radix8_stages_f32(pSrc, pSrc, fftLen, pCoef, twidCoefModifier, 1u, 1u, mode, scale);
+}
+
+/*    
+* @brief  Floating-point CFFT butterfly process reading the first stage inputs from a separate buffer.   
+* @param[in]      *pIn             points to the input buffer, only read by the first stage. It may be equal to pSrc.   
+* @param[out]     *pSrc            points to the buffer that holds the result, of floating-point data type.   
+* @param[in]      fftLen           length of the FFT.   
+* @param[in]      *pCoef           points to the twiddle coefficient buffer.   
+* @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.   
+* @param[in]      mode             RISCV_RADIX8_SWAP_IN, RISCV_RADIX8_SWAP_OUT and RISCV_RADIX8_SCALE flags of the inverse transform, 0 for the forward one.   
+* @param[in]      scale            factor of the first stage outputs with RISCV_RADIX8_SCALE.   
+* @return none.   
+*/
+
+void riscv_radix8_butterfly_oop_f32(
+const float32_t * pIn,
+float32_t * pSrc,
+uint16_t fftLen,
+const float32_t * pCoef,
+uint16_t twidCoefModifier,
+uint32_t mode,
+float32_t scale)
+{
+   riscv_radix8_stages_f32(pIn, pSrc, fftLen, pCoef, twidCoefModifier, 1u, 1u, mode, scale);
+}
+
+/*    
+* @brief  Floating-point CFFT butterfly process of several transforms stored back to back.   
+* @param[in, out] *pSrc            points to the in-place buffer of <code>numBlocks * 2 * fftLen</code> values.   
+* @param[in]      fftLen           length of each FFT.   
+* @param[in]      *pCoef           points to the twiddle coefficient buffer.   
+* @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.   
+* @param[in]      numBlocks        number of transforms.   
+* @param[in]      mode             RISCV_RADIX8_SWAP_IN, RISCV_RADIX8_SWAP_OUT and RISCV_RADIX8_SCALE flags of the inverse transform, 0 for the forward one.   
+* @param[in]      scale            factor of the first stage outputs with RISCV_RADIX8_SCALE.   
+* @return none.   
+*    
+* \par    
+* The twiddle factors of a butterfly group are loaded once and applied to the same group of every    
+* transform, so the twiddle loads and the loop setup of a stage are shared by all blocks.    
+*/
+
+void riscv_radix8_butterfly_batch_f32(
+float32_t * pSrc,
+uint16_t fftLen,
+const float32_t * pCoef,
+uint16_t twidCoefModifier,
+uint16_t numBlocks,
+uint32_t mode,
+float32_t scale)
+{
+   riscv_radix8_stages_f32(pSrc, pSrc, fftLen, pCoef, twidCoefModifier, 1u, numBlocks, mode, scale);
+}
+
+/*    
+* @brief  Floating-point CFFT butterfly process with the output written in natural order.   
+* @param[in, out] *pSrc            points to the input buffer, used as work buffer by all but the last stage.   
+* @param[out]     *pDst            points to the first output bin of this transform.   
+* @param[in]      fftLen           length of the FFT.   
+* @param[in]      *pCoef           points to the twiddle coefficient buffer.   
+* @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.   
+* @param[in]      dstStride        distance in complex samples between two consecutive output bins.   
+* @param[in]      mode             RISCV_RADIX8_SWAP_IN, RISCV_RADIX8_SWAP_OUT and RISCV_RADIX8_SCALE flags of the inverse transform, 0 for the forward one.   
+* @param[in]      scale            factor of the first stage outputs with RISCV_RADIX8_SCALE.   
+* @return none.   
+*    
+* \par    
+* The last radix-8 stage reads its eight inputs from <code>pSrc</code> and writes the outputs    
+* straight to their digit reversed positions in <code>pDst</code>, so no separate bit reversal    
+* pass over the buffer is needed. Output bin <code>n</code> is stored at <code>pDst[2*n*dstStride]</code>,    
+* which lets the radix-8-by-2 and radix-8-by-4 columns interleave their bins in one buffer.    
+* <code>pDst</code> must not overlap <code>pSrc</code>.  RISCV_RADIX8_SWAP_IN and RISCV_RADIX8_SCALE    
+* belong to the first stage and need an <code>fftLen</code> of at least 64.    
+*/
+
+void riscv_radix8_butterfly_ordered_f32(
+float32_t * pSrc,
+float32_t * pDst,
+uint16_t fftLen,
+const float32_t * pCoef,
+uint16_t twidCoefModifier,
+uint16_t dstStride,
+uint32_t mode,
+float32_t scale)
+{
+   uint32_t m, d, t, rev;
+   uint32_t step;
+   
+   float32_t r1, r2, r3, r4, r5, r6, r7, r8;
+   float32_t t1, t2;
+   float32_t s3, s5, s6, s7, s8;
+   float32_t *pIn, *pOutRe, *pOutIm;
+   uint32_t swap = ((mode & RISCV_RADIX8_SWAP_OUT) != 0u) ? 1u : 0u;
+   const float32_t C81 = 0.70710678118f;
+
+   /* All stages but the last one work in place */
+   riscv_radix8_stages_f32(pSrc, pSrc, fftLen, pCoef, twidCoefModifier, 8u, 1u, mode, scale);
+
+   /* Output k of butterfly m is bin k * fftLen/8 + rev(m), rev being the digit reversed m */
+   step = 2u * dstStride * (fftLen >> 3);
+   pIn = pSrc;
+
+   for (m = 0u; m < (fftLen >> 3); m++)
+   {
+      rev = 0u;
+      t = m;
+      for (d = fftLen >> 3; d > 1u; d >>= 3)
+      {
+         rev = (rev << 3) | (t & 7u);
+         t >>= 3;
+      }
+      pOutRe = pDst + 2u * dstStride * rev + swap;
+      pOutIm = pDst + 2u * dstStride * rev + (1u - swap);
+
+      r1 = pIn[0] + pIn[8];
+      r5 = pIn[0] - pIn[8];
+      r2 = pIn[2] + pIn[10];
+      r6 = pIn[2] - pIn[10];
+      r3 = pIn[4] + pIn[12];
+      r7 = pIn[4] - pIn[12];
+      r4 = pIn[6] + pIn[14];
+      r8 = pIn[6] - pIn[14];
+      t1 = r1 - r3;
+      r1 = r1 + r3;
+      r3 = r2 - r4;
+      r2 = r2 + r4;
+      pOutRe[0]         = r1 + r2;   
+      pOutRe[4u * step] = r1 - r2;
+      r1 = pIn[1] + pIn[9];
+      s5 = pIn[1] - pIn[9];
+      r2 = pIn[3] + pIn[11];
+      s6 = pIn[3] - pIn[11];
+      s3 = pIn[5] + pIn[13];
+      s7 = pIn[5] - pIn[13];
+      r4 = pIn[7] + pIn[15];
+      s8 = pIn[7] - pIn[15];
+      t2 = r1 - s3;
+      r1 = r1 + s3;
+      s3 = r2 - r4;
+      r2 = r2 + r4;
+      pOutIm[0]         = r1 + r2;
+      pOutIm[4u * step] = r1 - r2;
+      pOutRe[2u * step] = t1 + s3;
+      pOutRe[6u * step] = t1 - s3;
+      pOutIm[2u * step] = t2 - r3;
+      pOutIm[6u * step] = t2 + r3;
+      r1 = (r6 - r8) * C81;
+      r6 = (r6 + r8) * C81;
+      r2 = (s6 - s8) * C81;
+      s6 = (s6 + s8) * C81;
+      t1 = r5 - r1;
+      r5 = r5 + r1;
+      r8 = r7 - r6;
+      r7 = r7 + r6;
+      t2 = s5 - r2;
+      s5 = s5 + r2;
+      s8 = s7 - s6;
+      s7 = s7 + s6;
+      pOutRe[step]      = r5 + s7;
+      pOutRe[7u * step] = r5 - s7;
+      pOutRe[5u * step] = t1 + s8;
+      pOutRe[3u * step] = t1 - s8;
+      pOutIm[step]      = s5 - r7;
+      pOutIm[7u * step] = s5 + r7;
+      pOutIm[5u * step] = t2 - r8;
+      pOutIm[3u * step] = t2 + r8;
+
+      pIn += 16u;
+   }
 }
 
 /**    
@@ -0,0 +1,381 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_radix8_q31.c
+*
+* Description:  Radix-8 decimation in frequency stages of the Q31 CFFT,
+*               with radix-2 and radix-4 first stages for the lengths that
+*               are not a power of 8.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/* cos(pi/4) in Q31 */
+#define C81_Q31  0x5A82799A
+
+/*
+* Twiddle idx of a table for tabLen points, which holds the first 3/4 of the
+* circle; the last quarter is the conjugate of the first one.
+*/
+static inline void riscv_radix8_twiddle_q31(
+    const q31_t * pCoef,
+    uint32_t tabLen,
+    uint32_t idx,
+    q31_t * pCo,
+    q31_t * pSi)
+{
+    if (idx < ((3u * tabLen) >> 2))
+    {
+        *pCo = pCoef[2u * idx];
+        *pSi = pCoef[(2u * idx) + 1u];
+    }
+    else
+    {
+        idx = tabLen - idx;
+        *pCo = pCoef[2u * idx];
+        *pSi = -pCoef[(2u * idx) + 1u];
+    }
+}
+
+/* (xr + j*xi) * (co - j*si), halved by the rounded 32x32 high multiply,
+   stored with the real part at pOut[re] */
+static inline void riscv_radix8_cmul_q31(
+    q31_t * pOut,
+    uint32_t re,
+    q31_t xr,
+    q31_t xi,
+    q31_t co,
+    q31_t si)
+{
+    q31_t p0, p1;
+
+    mult_32x32_keep32_R(p0, xr, co);
+    mult_32x32_keep32_R(p1, xi, co);
+    multAcc_32x32_keep32_R(p0, xi, si);
+    multSub_32x32_keep32_R(p1, xr, si);
+
+    pOut[re] = p0;
+    pOut[1u - re] = p1;
+}
+
+/*
+* Radix-8 stages on fftLen points (a power of 8) of a table for
+* fftLen * twidCoefModifier points.  The first stage reads from pIn, which
+* may be equal to pSrc, shifted right by 2 + inShift; the data between the
+* stages is scaled by 1/8 per stage with 2 guard bits, inShift is 2 for full
+* scale input.  The shifts truncate: rounding them carries a full scale DC
+* input past 1.0 in the last stage.  The outputs of each
+* butterfly are stored in bit reversed order, so the result is in the bit
+* reversed order of a radix-2 transform.  With ifftFlag the real and
+* imaginary parts are swapped when the first stage reads and when the last
+* stage writes, which turns the forward transform into the inverse one.
+*/
+static void riscv_radix8_butterfly_q31(
+    const q31_t * pIn,
+    q31_t * pSrc,
+    uint32_t fftLen,
+    const q31_t * pCoef,
+    uint32_t twidCoefModifier,
+    uint32_t inShift,
+    uint8_t ifftFlag)
+{
+    const q31_t *pI = pIn;                       /* input of the current stage */
+    q31_t *pO;                                   /* outputs of a butterfly */
+    uint32_t re = ifftFlag;                      /* offsets of the real and */
+    uint32_t im = 1u - ifftFlag;                 /* imaginary parts read */
+    uint32_t sh = 2u + inShift;                  /* input shift of the stage */
+    uint32_t tabLen = fftLen * twidCoefModifier; /* points of the twiddle table */
+    uint32_t n1, n2, i, j, k;
+    q31_t co[8], si[8];
+    q31_t x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i;
+    q31_t x4r, x4i, x5r, x5i, x6r, x6i, x7r, x7i;
+    q31_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;
+    q31_t b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i;
+    q31_t t0, t1;
+
+    /* all stages but the last one, twiddled */
+    for (n1 = fftLen; n1 > 8u; n1 >>= 3)
+    {
+        n2 = n1 >> 3;
+
+        for (j = 0u; j < n2; j++)
+        {
+            for (k = 1u; k < 8u; k++)
+            {
+                riscv_radix8_twiddle_q31(pCoef, tabLen, k * j * twidCoefModifier, &co[k], &si[k]);
+            }
+
+            for (i = j; i < fftLen; i += n1)
+            {
+                x0r = pI[2u * i + re] >> sh;
+                x0i = pI[2u * i + im] >> sh;
+                x1r = pI[2u * (i + n2) + re] >> sh;
+                x1i = pI[2u * (i + n2) + im] >> sh;
+                x2r = pI[2u * (i + 2u * n2) + re] >> sh;
+                x2i = pI[2u * (i + 2u * n2) + im] >> sh;
+                x3r = pI[2u * (i + 3u * n2) + re] >> sh;
+                x3i = pI[2u * (i + 3u * n2) + im] >> sh;
+                x4r = pI[2u * (i + 4u * n2) + re] >> sh;
+                x4i = pI[2u * (i + 4u * n2) + im] >> sh;
+                x5r = pI[2u * (i + 5u * n2) + re] >> sh;
+                x5i = pI[2u * (i + 5u * n2) + im] >> sh;
+                x6r = pI[2u * (i + 6u * n2) + re] >> sh;
+                x6i = pI[2u * (i + 6u * n2) + im] >> sh;
+                x7r = pI[2u * (i + 7u * n2) + re] >> sh;
+                x7i = pI[2u * (i + 7u * n2) + im] >> sh;
+
+                /* a = x[k] + x[k+4], b = (x[k] - x[k+4]) * W8^k */
+                a0r = x0r + x4r;  a0i = x0i + x4i;
+                a1r = x1r + x5r;  a1i = x1i + x5i;
+                a2r = x2r + x6r;  a2i = x2i + x6i;
+                a3r = x3r + x7r;  a3i = x3i + x7i;
+                b0r = x0r - x4r;  b0i = x0i - x4i;
+                t0 = (x1r - x5r) + (x1i - x5i);
+                t1 = (x1i - x5i) - (x1r - x5r);
+                mult_32x32_keep32_R(b1r, t0, C81_Q31);
+                mult_32x32_keep32_R(b1i, t1, C81_Q31);
+                b1r <<= 1;        b1i <<= 1;
+                b2r = x2i - x6i;  b2i = x6r - x2r;
+                t0 = (x3i - x7i) - (x3r - x7r);
+                t1 = -((x3r - x7r) + (x3i - x7i));
+                mult_32x32_keep32_R(b3r, t0, C81_Q31);
+                mult_32x32_keep32_R(b3i, t1, C81_Q31);
+                b3r <<= 1;        b3i <<= 1;
+
+                /* radix-4 butterflies of the even (a) and odd (b) outputs */
+                x0r = a0r + a2r;  x0i = a0i + a2i;
+                x1r = a0r - a2r;  x1i = a0i - a2i;
+                x2r = a1r + a3r;  x2i = a1i + a3i;
+                x3r = a1r - a3r;  x3i = a1i - a3i;
+                x4r = b0r + b2r;  x4i = b0i + b2i;
+                x5r = b0r - b2r;  x5i = b0i - b2i;
+                x6r = b1r + b3r;  x6i = b1i + b3i;
+                x7r = b1r - b3r;  x7i = b1i - b3i;
+
+                pO = pSrc + 2u * i;
+
+                /* X0 */
+                pO[0] = (x0r + x2r) >> 1;
+                pO[1] = (x0i + x2i) >> 1;
+                /* X4 */
+                riscv_radix8_cmul_q31(pO + 2u * n2, 0u, x0r - x2r, x0i - x2i, co[4], si[4]);
+                /* X2 */
+                riscv_radix8_cmul_q31(pO + 4u * n2, 0u, x1r + x3i, x1i - x3r, co[2], si[2]);
+                /* X6 */
+                riscv_radix8_cmul_q31(pO + 6u * n2, 0u, x1r - x3i, x1i + x3r, co[6], si[6]);
+                /* X1 */
+                riscv_radix8_cmul_q31(pO + 8u * n2, 0u, x4r + x6r, x4i + x6i, co[1], si[1]);
+                /* X5 */
+                riscv_radix8_cmul_q31(pO + 10u * n2, 0u, x4r - x6r, x4i - x6i, co[5], si[5]);
+                /* X3 */
+                riscv_radix8_cmul_q31(pO + 12u * n2, 0u, x5r + x7i, x5i - x7r, co[3], si[3]);
+                /* X7 */
+                riscv_radix8_cmul_q31(pO + 14u * n2, 0u, x5r - x7i, x5i + x7r, co[7], si[7]);
+            }
+        }
+
+        twidCoefModifier <<= 3u;
+        pI = pSrc;
+        re = 0u;
+        im = 1u;
+        sh = 2u;
+    }
+
+    /* last stage, no twiddles and one bit less of shift */
+    sh -= 1u;
+    for (i = 0u; i < fftLen; i += 8u)
+    {
+        x0r = pI[2u * i + re] >> sh;
+        x0i = pI[2u * i + im] >> sh;
+        x1r = pI[2u * i + 2u + re] >> sh;
+        x1i = pI[2u * i + 2u + im] >> sh;
+        x2r = pI[2u * i + 4u + re] >> sh;
+        x2i = pI[2u * i + 4u + im] >> sh;
+        x3r = pI[2u * i + 6u + re] >> sh;
+        x3i = pI[2u * i + 6u + im] >> sh;
+        x4r = pI[2u * i + 8u + re] >> sh;
+        x4i = pI[2u * i + 8u + im] >> sh;
+        x5r = pI[2u * i + 10u + re] >> sh;
+        x5i = pI[2u * i + 10u + im] >> sh;
+        x6r = pI[2u * i + 12u + re] >> sh;
+        x6i = pI[2u * i + 12u + im] >> sh;
+        x7r = pI[2u * i + 14u + re] >> sh;
+        x7i = pI[2u * i + 14u + im] >> sh;
+
+        a0r = x0r + x4r;  a0i = x0i + x4i;
+        a1r = x1r + x5r;  a1i = x1i + x5i;
+        a2r = x2r + x6r;  a2i = x2i + x6i;
+        a3r = x3r + x7r;  a3i = x3i + x7i;
+        b0r = x0r - x4r;  b0i = x0i - x4i;
+        t0 = (x1r - x5r) + (x1i - x5i);
+        t1 = (x1i - x5i) - (x1r - x5r);
+        mult_32x32_keep32_R(b1r, t0, C81_Q31);
+        mult_32x32_keep32_R(b1i, t1, C81_Q31);
+        b1r <<= 1;        b1i <<= 1;
+        b2r = x2i - x6i;  b2i = x6r - x2r;
+        t0 = (x3i - x7i) - (x3r - x7r);
+        t1 = -((x3r - x7r) + (x3i - x7i));
+        mult_32x32_keep32_R(b3r, t0, C81_Q31);
+        mult_32x32_keep32_R(b3i, t1, C81_Q31);
+        b3r <<= 1;        b3i <<= 1;
+
+        x0r = a0r + a2r;  x0i = a0i + a2i;
+        x1r = a0r - a2r;  x1i = a0i - a2i;
+        x2r = a1r + a3r;  x2i = a1i + a3i;
+        x3r = a1r - a3r;  x3i = a1i - a3i;
+        x4r = b0r + b2r;  x4i = b0i + b2i;
+        x5r = b0r - b2r;  x5i = b0i - b2i;
+        x6r = b1r + b3r;  x6i = b1i + b3i;
+        x7r = b1r - b3r;  x7i = b1i - b3i;
+
+        /* X0 X4 X2 X6 X1 X5 X3 X7, real and imaginary parts swapped back for the inverse */
+        pO = pSrc + 2u * i;
+        pO[0u + ifftFlag] = x0r + x2r;
+        pO[1u - ifftFlag] = x0i + x2i;
+        pO[2u + ifftFlag] = x0r - x2r;
+        pO[3u - ifftFlag] = x0i - x2i;
+        pO[4u + ifftFlag] = x1r + x3i;
+        pO[5u - ifftFlag] = x1i - x3r;
+        pO[6u + ifftFlag] = x1r - x3i;
+        pO[7u - ifftFlag] = x1i + x3r;
+        pO[8u + ifftFlag] = x4r + x6r;
+        pO[9u - ifftFlag] = x4i + x6i;
+        pO[10u + ifftFlag] = x4r - x6r;
+        pO[11u - ifftFlag] = x4i - x6i;
+        pO[12u + ifftFlag] = x5r + x7i;
+        pO[13u - ifftFlag] = x5i - x7r;
+        pO[14u + ifftFlag] = x5r - x7i;
+        pO[15u - ifftFlag] = x5i + x7r;
+    }
+}
+
+/*
+* Radix-2 first stage for fftLen = 2 * 8^k; the halves go through the
+* radix-8 stages with every second twiddle.  For the inverse the stage reads
+* and writes with real and imaginary parts swapped, like the radix-8 ones.
+*/
+static void riscv_cfft_radix8by2_q31(
+    const q31_t * pIn,
+    q31_t * pSrc,
+    uint32_t fftLen,
+    const q31_t * pCoef,
+    uint8_t ifftFlag)
+{
+    uint32_t re = ifftFlag, im = 1u - ifftFlag;
+    uint32_t n2 = fftLen >> 1;
+    uint32_t i;
+    q31_t xa, ya, xb, yb;
+
+    for (i = 0u; i < n2; i++)
+    {
+        xa = pIn[2u * i + re] >> 2;
+        ya = pIn[2u * i + im] >> 2;
+        xb = pIn[2u * (i + n2) + re] >> 2;
+        yb = pIn[2u * (i + n2) + im] >> 2;
+
+        pSrc[2u * i + re] = (xa + xb) >> 1;
+        pSrc[2u * i + im] = (ya + yb) >> 1;
+        riscv_radix8_cmul_q31(pSrc + 2u * (i + n2), re, xa - xb, ya - yb, pCoef[2u * i], pCoef[2u * i + 1u]);
+    }
+
+    riscv_radix8_butterfly_q31(pSrc, pSrc, n2, pCoef, 2u, 0u, ifftFlag);
+    riscv_radix8_butterfly_q31(pSrc + fftLen, pSrc + fftLen, n2, pCoef, 2u, 0u, ifftFlag);
+}
+
+/*
+* Radix-4 first stage for fftLen = 4 * 8^k; the quarters go through the
+* radix-8 stages with every fourth twiddle.
+*/
+static void riscv_cfft_radix8by4_q31(
+    const q31_t * pIn,
+    q31_t * pSrc,
+    uint32_t fftLen,
+    const q31_t * pCoef,
+    uint8_t ifftFlag)
+{
+    uint32_t re = ifftFlag, im = 1u - ifftFlag;
+    uint32_t n4 = fftLen >> 2;
+    uint32_t i;
+    q31_t x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i;
+    q31_t s0r, s0i, s1r, s1i, d0r, d0i, d1r, d1i;
+
+    for (i = 0u; i < n4; i++)
+    {
+        x0r = pIn[2u * i + re] >> 3;
+        x0i = pIn[2u * i + im] >> 3;
+        x1r = pIn[2u * (i + n4) + re] >> 3;
+        x1i = pIn[2u * (i + n4) + im] >> 3;
+        x2r = pIn[2u * (i + 2u * n4) + re] >> 3;
+        x2i = pIn[2u * (i + 2u * n4) + im] >> 3;
+        x3r = pIn[2u * (i + 3u * n4) + re] >> 3;
+        x3i = pIn[2u * (i + 3u * n4) + im] >> 3;
+
+        s0r = x0r + x2r;  s0i = x0i + x2i;
+        d0r = x0r - x2r;  d0i = x0i - x2i;
+        s1r = x1r + x3r;  s1i = x1i + x3i;
+        d1r = x1r - x3r;  d1i = x1i - x3i;
+
+        /* Y0 Y2 Y1 Y3 */
+        pSrc[2u * i + re] = (s0r + s1r) >> 1;
+        pSrc[2u * i + im] = (s0i + s1i) >> 1;
+        riscv_radix8_cmul_q31(pSrc + 2u * (i + n4), re, s0r - s1r, s0i - s1i,
+                              pCoef[4u * i], pCoef[4u * i + 1u]);
+        riscv_radix8_cmul_q31(pSrc + 2u * (i + 2u * n4), re, d0r + d1i, d0i - d1r,
+                              pCoef[2u * i], pCoef[2u * i + 1u]);
+        riscv_radix8_cmul_q31(pSrc + 2u * (i + 3u * n4), re, d0r - d1i, d0i + d1r,
+                              pCoef[6u * i], pCoef[6u * i + 1u]);
+    }
+
+    for (i = 0u; i < 4u; i++)
+    {
+        riscv_radix8_butterfly_q31(pSrc + 2u * i * n4, pSrc + 2u * i * n4, n4, pCoef, 4u, 0u, ifftFlag);
+    }
+}
+
+/**
+* @brief  Radix-8 based Q31 CFFT of riscv_cfft_q31() and riscv_cfft_oop_q31().
+* @param[in]      *pIn     points to the complex input, may be equal to pSrc.
+* @param[out]     *pSrc    points to the complex output, in bit reversed order.
+* @param[in]      fftLen   length of the FFT, 16 to 4096.
+* @param[in]      *pCoef   points to the twiddle table for fftLen points.
+* @param[in]      ifftFlag forward (0) or inverse (1) transform.
+* @return none.
+*
+* \par
+* Powers of 8 run radix-8 stages only; 2 * 8^k and 4 * 8^k start with a
+* radix-2 or radix-4 stage.  64 points take 2 stages instead of the 3 of
+* radix-4, 4096 points 4 instead of 6.  The output is scaled down by
+* fftLen like the one of the radix-4 transform.
+*/
+void riscv_cfft_radix8_q31(
+    const q31_t * pIn,
+    q31_t * pSrc,
+    uint32_t fftLen,
+    const q31_t * pCoef,
+    uint8_t ifftFlag)
+{
+    switch (fftLen)
+    {
+    case 64u:
+    case 512u:
+    case 4096u:
+        riscv_radix8_butterfly_q31(pIn, pSrc, fftLen, pCoef, 1u, 2u, ifftFlag);
+        break;
+
+    case 16u:
+    case 128u:
+    case 1024u:
+        riscv_cfft_radix8by2_q31(pIn, pSrc, fftLen, pCoef, ifftFlag);
+        break;
+
+    case 32u:
+    case 256u:
+    case 2048u:
+        riscv_cfft_radix8by4_q31(pIn, pSrc, fftLen, pCoef, ifftFlag);
+        break;
+
+    default:
+        break;
+    }
+}
@@ -0,0 +1,242 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_scaled_q31.c
+*
+* Description:  Q31 complex FFT with a per-stage scaling schedule or
+*               conditional block floating-point scaling.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+extern void riscv_bitreversal_32(
+    uint32_t * pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t * pBitRevTable);
+
+/* 4*sqrt(2) and 2*sqrt(2) in Q10, the growth of a twiddled radix-4 and radix-2 output */
+#define RISCV_CFFT_GROWTH4  5793
+#define RISCV_CFFT_GROWTH2  2897
+
+/* Twiddle factor k of the table for fftLen points, negated sin for the inverse */
+static inline void riscv_cfft_scaled_twiddle_q31(
+    const q31_t * pCoef,
+    uint32_t k,
+    uint8_t ifftFlag,
+    q63_t * pCos,
+    q63_t * pSin)
+{
+    *pCos = pCoef[2u * k];
+    *pSin = pCoef[2u * k + 1u];
+    if(ifftFlag == 1u)
+    {
+        *pSin = -*pSin;
+    }
+}
+
+/* Right shift that keeps a stage with the given growth (Q10) from overflowing */
+static uint32_t riscv_cfft_scaled_shift_q31(
+    const q31_t * pSrc,
+    uint32_t numValues,
+    q63_t growth,
+    uint32_t maxShift)
+{
+    q63_t peak = 0, x;
+    uint32_t shift = 0u;
+
+    while(numValues > 0u)
+    {
+        x = *pSrc++;
+        x = (x < 0) ? -x : x;
+        peak = (x > peak) ? x : peak;
+        numValues--;
+    }
+
+    peak = (peak * growth) >> 10;
+    while((shift < maxShift) && ((peak >> shift) > 0x7FFFFFFF))
+    {
+        shift++;
+    }
+
+    return (shift);
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+* @brief  Q31 complex FFT with a caller-chosen scaling of the stages.
+* @param[in]      *S              points to an instance of the Q31 CFFT structure.
+* @param[in, out] *p1             points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+* @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]      bitReverseFlag  flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+* @param[in]      scaleSchedule   bit s set scales stage s, or RISCV_CFFT_SCALE_BFP.
+* @return the number of right shifts applied, the output is the transform times 2^-shift.
+*
+* \par
+* The transform runs a radix-2 stage when log2(fftLen) is odd and radix-4 stages after it, stage 0
+* is the first one.  A scaled radix-4 stage shifts its outputs right by 2, a scaled radix-2 stage
+* by 1; RISCV_CFFT_SCALE_ALL scales every stage, log2(fftLen) shifts like riscv_cfft_q31().  Stages
+* left unscaled keep the low-level content that riscv_cfft_q31() shifts out and saturate if the
+* input does not have the headroom for their growth.
+* \par
+* With RISCV_CFFT_SCALE_BFP each stage first finds the peak of the block and shifts by the least
+* amount, 0 to 3 bits for radix-4 and 0 to 2 for radix-2, that rules out an overflow; a small input
+* is not scaled until it has grown.  Add the returned shift to the exponent of the input to get
+* the exponent of the output.
+* \par
+* The inverse transform is not scaled by 1/fftLen beyond the returned shift.  The sums of a stage
+* are 64-bit, so unscaled stages lose no bits before the saturation.
+*/
+
+uint32_t riscv_cfft_scaled_q31(
+    const riscv_cfft_instance_q31 * S,
+    q31_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    uint32_t scaleSchedule)
+{
+  RISCV_PROFILE(riscv_cfft_scaled_q31);
+    uint32_t fftLen = S->fftLen;
+    const q31_t *pCoef = S->pTwiddle;
+    uint32_t n1, n2, i, j, k, l, m;
+    uint32_t modifier = 1u;                      /* twiddle index step of the stage */
+    uint32_t stage = 0u;
+    uint32_t shift, total = 0u;
+    q63_t co1, si1, co2, si2, co3, si3;
+    q63_t xar, xai, xbr, xbi, xcr, xci, xdr, xdi;
+    q63_t r1r, r1i, r2r, r2i, s1r, s1i, s2r, s2i;
+    q63_t yr, yi;
+
+    n1 = fftLen;
+
+    /* radix-2 first stage for the odd powers of 2 */
+    if((31u - __CLZ(fftLen)) & 1u)
+    {
+        if((scaleSchedule & RISCV_CFFT_SCALE_BFP) != 0u)
+        {
+            shift = riscv_cfft_scaled_shift_q31(p1, 2u * fftLen, RISCV_CFFT_GROWTH2, 2u);
+        }
+        else
+        {
+            shift = scaleSchedule & 1u;
+        }
+
+        n2 = n1 >> 1u;
+        for (i = 0u; i < n2; i++)
+        {
+            l = i + n2;
+            riscv_cfft_scaled_twiddle_q31(pCoef, i, ifftFlag, &co1, &si1);
+
+            xar = p1[2u * i];
+            xai = p1[2u * i + 1u];
+            xbr = p1[2u * l];
+            xbi = p1[2u * l + 1u];
+
+            p1[2u * i] = clip_q63_to_q31((xar + xbr) >> shift);
+            p1[2u * i + 1u] = clip_q63_to_q31((xai + xbi) >> shift);
+
+            yr = clip_q63_to_q31((xar - xbr) >> shift);
+            yi = clip_q63_to_q31((xai - xbi) >> shift);
+            p1[2u * l] = clip_q63_to_q31(((yr * co1) + (yi * si1)) >> 31);
+            p1[2u * l + 1u] = clip_q63_to_q31(((yi * co1) - (yr * si1)) >> 31);
+        }
+
+        n1 = n2;
+        modifier = 2u;
+        total += shift;
+        stage++;
+    }
+
+    /* radix-4 stages, outputs stored in bit reversed order */
+    while(n1 > 1u)
+    {
+        if((scaleSchedule & RISCV_CFFT_SCALE_BFP) != 0u)
+        {
+            shift = riscv_cfft_scaled_shift_q31(p1, 2u * fftLen, RISCV_CFFT_GROWTH4, 3u);
+        }
+        else
+        {
+            shift = ((scaleSchedule >> stage) & 1u) << 1u;
+        }
+
+        n2 = n1 >> 2u;
+        for (j = 0u; j < n2; j++)
+        {
+            riscv_cfft_scaled_twiddle_q31(pCoef, j * modifier, ifftFlag, &co1, &si1);
+            riscv_cfft_scaled_twiddle_q31(pCoef, 2u * j * modifier, ifftFlag, &co2, &si2);
+            riscv_cfft_scaled_twiddle_q31(pCoef, 3u * j * modifier, ifftFlag, &co3, &si3);
+
+            for (i = j; i < fftLen; i += n1)
+            {
+                k = i + n2;
+                l = k + n2;
+                m = l + n2;
+
+                xar = p1[2u * i];
+                xai = p1[2u * i + 1u];
+                xbr = p1[2u * k];
+                xbi = p1[2u * k + 1u];
+                xcr = p1[2u * l];
+                xci = p1[2u * l + 1u];
+                xdr = p1[2u * m];
+                xdi = p1[2u * m + 1u];
+
+                r1r = xar + xcr;  r1i = xai + xci;
+                r2r = xar - xcr;  r2i = xai - xci;
+                s1r = xbr + xdr;  s1i = xbi + xdi;
+                s2r = xbr - xdr;  s2i = xbi - xdi;
+
+                if(ifftFlag == 1u)
+                {
+                    /* W4 = +j for the inverse */
+                    s2r = -s2r;
+                    s2i = -s2i;
+                }
+
+                /* y0 */
+                p1[2u * i] = clip_q63_to_q31((r1r + s1r) >> shift);
+                p1[2u * i + 1u] = clip_q63_to_q31((r1i + s1i) >> shift);
+
+                /* y2, stored second */
+                yr = clip_q63_to_q31((r1r - s1r) >> shift);
+                yi = clip_q63_to_q31((r1i - s1i) >> shift);
+                p1[2u * k] = clip_q63_to_q31(((yr * co2) + (yi * si2)) >> 31);
+                p1[2u * k + 1u] = clip_q63_to_q31(((yi * co2) - (yr * si2)) >> 31);
+
+                /* y1 = r2 - j*s2, stored third */
+                yr = clip_q63_to_q31((r2r + s2i) >> shift);
+                yi = clip_q63_to_q31((r2i - s2r) >> shift);
+                p1[2u * l] = clip_q63_to_q31(((yr * co1) + (yi * si1)) >> 31);
+                p1[2u * l + 1u] = clip_q63_to_q31(((yi * co1) - (yr * si1)) >> 31);
+
+                /* y3 = r2 + j*s2 */
+                yr = clip_q63_to_q31((r2r - s2i) >> shift);
+                yi = clip_q63_to_q31((r2i + s2r) >> shift);
+                p1[2u * m] = clip_q63_to_q31(((yr * co3) + (yi * si3)) >> 31);
+                p1[2u * m + 1u] = clip_q63_to_q31(((yi * co3) - (yr * si3)) >> 31);
+            }
+        }
+
+        n1 = n2;
+        modifier <<= 2u;
+        total += shift;
+        stage++;
+    }
+
+    if(bitReverseFlag)
+        riscv_bitreversal_32((uint32_t*)p1,S->bitRevLength,S->pBitRevTable);
+
+    return (total);
+}
+
+/**
+* @} end of ComplexFFT group
+*/
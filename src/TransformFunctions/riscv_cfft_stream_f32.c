@@ -0,0 +1,455 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_stream_f32.c
+*
+* Description:  Floating-point four-step CFFT streamed from L2 through
+*               tiles in L1.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/*
+* @brief  Transforms the columns or rows of one tile in L1.
+*/
+
+typedef void (*riscv_cfft_stream_tile_f32)(
+  const riscv_cfft_stream_instance_f32 * S,
+  uint32_t tile,
+  float32_t * pIn,
+  float32_t * pOut,
+  uint8_t ifftFlag);
+
+/*
+* @brief  Geometry of the tiles of one pass in L2.
+*/
+
+typedef struct
+{
+  float32_t *pBase;                              /* first word of tile 0 */
+  uint32_t tileStep;                             /* words between two tiles */
+  uint32_t rowSize;                              /* bytes of a row of a transfer */
+  uint32_t numRows;                              /* rows of a transfer */
+  uint32_t stride;                               /* bytes between two rows in L2 */
+} riscv_cfft_stream_geom_f32;
+
+/*
+* @brief  Double-buffered pass over numTiles tiles, as riscv_stream_process() with 2D transfers.
+*/
+
+static void riscv_cfft_stream_pass_f32(
+  const riscv_dma_instance * D,
+  const riscv_cfft_stream_instance_f32 * S,
+  const riscv_cfft_stream_geom_f32 * pIn,
+  const riscv_cfft_stream_geom_f32 * pOut,
+  uint32_t numTiles,
+  uint32_t tileWords,
+  riscv_cfft_stream_tile_f32 func,
+  uint8_t ifftFlag)
+{
+  float32_t *pTileIn[2], *pTileOut[2];           /* Tiles in L1 */
+  uint32_t idIn[2], idOut[2] = {0u, 0u};         /* Transfer identifiers */
+  uint32_t t, b;
+
+  pTileIn[0] = S->pL1;
+  pTileIn[1] = pTileIn[0] + tileWords;
+  pTileOut[0] = pTileIn[1] + tileWords;
+  pTileOut[1] = pTileOut[0] + tileWords;
+
+  idIn[0] = D->start(D->ctx, pTileIn[0], pIn->pBase, pIn->rowSize, pIn->numRows, pIn->rowSize, pIn->stride);
+
+  for (t = 0u; t < numTiles; t++)
+  {
+    b = t & 1u;
+
+    D->wait(D->ctx, idIn[b]);
+
+    if((t + 1u) < numTiles)
+    {
+      idIn[b ^ 1u] = D->start(D->ctx, pTileIn[b ^ 1u], pIn->pBase + ((t + 1u) * pIn->tileStep),
+                              pIn->rowSize, pIn->numRows, pIn->rowSize, pIn->stride);
+    }
+
+    if(t >= 2u)
+    {
+      D->wait(D->ctx, idOut[b]);
+    }
+
+    func(S, t, pTileIn[b], pTileOut[b], ifftFlag);
+
+    idOut[b] = D->start(D->ctx, pOut->pBase + (t * pOut->tileStep), pTileOut[b],
+                        pOut->rowSize, pOut->numRows, pOut->stride, pOut->rowSize);
+  }
+
+  D->wait(D->ctx, idOut[(numTiles - 1u) & 1u]);
+}
+
+/*
+* @brief  Step 1 and 2, column FFTs of length N1 and twiddle factors W_N^(n2*k1).
+*
+* The tile holds the rows n1 of tileSize adjacent columns, element (n1, t) at n1*tileSize+t.
+* Every column is gathered into the work buffer after the four tiles, transformed and written
+* back to the same layout multiplied by the twiddle factor.
+*/
+
+static void riscv_cfft_stream_cols_f32(
+  const riscv_cfft_stream_instance_f32 * S,
+  uint32_t tile,
+  float32_t * pIn,
+  float32_t * pOut,
+  uint8_t ifftFlag)
+{
+  uint32_t N1 = S->pCol->fftLen;
+  uint32_t T = S->tileSize;
+  float32_t *pWork = S->pL1 + (8u * N1 * T);     /* Column being transformed */
+  const float32_t *pLo = S->pTwiddle;            /* W_N^lo */
+  const float32_t *pHi = S->pTwiddle + (2u * N1);  /* W_N^(hi*N1) */
+  float32_t sg = (ifftFlag != 0u) ? 1.0f : -1.0f;
+  float32_t wr, wi, xr, xi;
+  uint32_t t, k, n2, lo, hi, dlo, dhi;
+
+  for (t = 0u; t < T; t++)
+  {
+    for (k = 0u; k < N1; k++)
+    {
+      pWork[2u * k] = pIn[2u * ((k * T) + t)];
+      pWork[(2u * k) + 1u] = pIn[(2u * ((k * T) + t)) + 1u];
+    }
+
+    riscv_cfft_f32(S->pCol, pWork, ifftFlag, 1u);
+
+    /* The exponent n2*k1 advances by n2 = dhi*N1 + dlo per output */
+    n2 = (tile * T) + t;
+    dlo = n2 % N1;
+    dhi = n2 / N1;
+    lo = 0u;
+    hi = 0u;
+
+    for (k = 0u; k < N1; k++)
+    {
+      wr = (pHi[2u * hi] * pLo[2u * lo]) - (pHi[(2u * hi) + 1u] * pLo[(2u * lo) + 1u]);
+      wi = sg * ((pHi[2u * hi] * pLo[(2u * lo) + 1u]) + (pHi[(2u * hi) + 1u] * pLo[2u * lo]));
+      xr = pWork[2u * k];
+      xi = pWork[(2u * k) + 1u];
+      pOut[2u * ((k * T) + t)] = (xr * wr) - (xi * wi);
+      pOut[(2u * ((k * T) + t)) + 1u] = (xr * wi) + (xi * wr);
+
+      lo += dlo;
+      hi += dhi;
+      if(lo >= N1)
+      {
+        lo -= N1;
+        hi++;
+      }
+    }
+  }
+}
+
+/*
+* @brief  Step 3 and 4, row FFTs of length N2 and transpose of the tile.
+*
+* The tile holds tileSize contiguous rows k1, the output tile holds element (k2, t) at
+* k2*tileSize+t so that bins k1 + N1*k2 are written with one 2D transfer.
+*/
+
+static void riscv_cfft_stream_rows_f32(
+  const riscv_cfft_stream_instance_f32 * S,
+  uint32_t tile,
+  float32_t * pIn,
+  float32_t * pOut,
+  uint8_t ifftFlag)
+{
+  uint32_t N2 = S->pRow->fftLen;
+  uint32_t T = S->tileSize;
+  uint32_t t, k;
+
+  for (t = 0u; t < T; t++)
+  {
+    riscv_cfft_f32(S->pRow, pIn + (2u * t * N2), ifftFlag, 1u);
+
+    for (k = 0u; k < N2; k++)
+    {
+      pOut[2u * ((k * T) + t)] = pIn[2u * ((t * N2) + k)];
+      pOut[(2u * ((k * T) + t)) + 1u] = pIn[(2u * ((t * N2) + k)) + 1u];
+    }
+  }
+
+  (void) tile;
+}
+
+/*
+* @brief  Step 3 of the in-place transform, row FFTs of length N2 written back to the rows.
+*/
+
+static void riscv_cfft_stream_rows_inplace_f32(
+  const riscv_cfft_stream_instance_f32 * S,
+  uint32_t tile,
+  float32_t * pIn,
+  float32_t * pOut,
+  uint8_t ifftFlag)
+{
+  uint32_t N2 = S->pRow->fftLen;
+  uint32_t T = S->tileSize;
+  uint32_t t;
+
+  for (t = 0u; t < T; t++)
+  {
+    riscv_cfft_f32(S->pRow, pIn + (2u * t * N2), ifftFlag, 1u);
+  }
+
+  memcpy(pOut, pIn, 2u * T * N2 * sizeof(float32_t));
+
+  (void) tile;
+}
+
+/*
+* @brief  In-place transpose of the R x R complex squares of a matrix of R rows and ld columns in L2.
+*
+* Blocks of B x B elements (I, J) and (J, I) are loaded into L1, transposed there and stored
+* back swapped, so every transfer moves B rows of B contiguous elements.
+*/
+
+static void riscv_cfft_stream_squares_f32(
+  const riscv_dma_instance * D,
+  float32_t * pL1,
+  float32_t * pBuf,
+  uint32_t R,
+  uint32_t ld,
+  uint32_t B)
+{
+  float32_t *pA = pL1, *pB = pL1 + (2u * B * B);  /* Blocks in L1 */
+  float32_t *pSq, *pIJ, *pJI;
+  float32_t re, im;
+  uint32_t rowSize = B * 2u * sizeof(float32_t); /* bytes of a row of a block */
+  uint32_t stride = ld * 2u * sizeof(float32_t); /* bytes between two rows in L2 */
+  uint32_t q, I, J, r, c, id;
+
+  for (q = 0u; q < (ld / R); q++)
+  {
+    pSq = pBuf + (2u * q * R);
+
+    for (I = 0u; I < (R / B); I++)
+    {
+      for (J = I; J < (R / B); J++)
+      {
+        pIJ = pSq + (2u * B * ((I * ld) + J));
+        pJI = pSq + (2u * B * ((J * ld) + I));
+
+        D->start(D->ctx, pA, pIJ, rowSize, B, rowSize, stride);
+        id = D->start(D->ctx, pB, pJI, rowSize, B, rowSize, stride);
+        D->wait(D->ctx, id);
+
+        for (r = 0u; r < B; r++)
+        {
+          for (c = r + 1u; c < B; c++)
+          {
+            re = pA[2u * ((r * B) + c)];
+            im = pA[(2u * ((r * B) + c)) + 1u];
+            pA[2u * ((r * B) + c)] = pA[2u * ((c * B) + r)];
+            pA[(2u * ((r * B) + c)) + 1u] = pA[(2u * ((c * B) + r)) + 1u];
+            pA[2u * ((c * B) + r)] = re;
+            pA[(2u * ((c * B) + r)) + 1u] = im;
+
+            re = pB[2u * ((r * B) + c)];
+            im = pB[(2u * ((r * B) + c)) + 1u];
+            pB[2u * ((r * B) + c)] = pB[2u * ((c * B) + r)];
+            pB[(2u * ((r * B) + c)) + 1u] = pB[(2u * ((c * B) + r)) + 1u];
+            pB[2u * ((c * B) + r)] = re;
+            pB[(2u * ((c * B) + r)) + 1u] = im;
+          }
+        }
+
+        /* On the diagonal both blocks are the same one */
+        D->start(D->ctx, pJI, pA, rowSize, B, stride, rowSize);
+        id = D->start(D->ctx, pIJ, pB, rowSize, B, stride, rowSize);
+        D->wait(D->ctx, id);
+      }
+    }
+  }
+}
+
+/*
+* @brief  In-place transpose of a matrix of m x n chunks of chunkSize words in L2.
+*
+* Chunk i moves to (i*m) mod (m*n-1), the chunks of a cycle are moved from the smallest
+* position of the cycle with one chunk saved in L1 and two slots that alternate.
+*/
+
+static void riscv_cfft_stream_chunks_f32(
+  const riscv_dma_instance * D,
+  float32_t * pL1,
+  float32_t * pBuf,
+  uint32_t m,
+  uint32_t n,
+  uint32_t chunkSize)
+{
+  float32_t *pSave = pL1;                        /* First chunk of the cycle */
+  float32_t *pSlot[2];                           /* Chunks in transit */
+  uint32_t last = (m * n) - 1u;                  /* Chunks 0 and last stay */
+  uint32_t bytes = chunkSize * sizeof(float32_t);
+  uint32_t s, p, src, id, b;
+
+  pSlot[0] = pL1 + chunkSize;
+  pSlot[1] = pSlot[0] + chunkSize;
+
+  for (s = 1u; s < last; s++)
+  {
+    /* Skip the cycle unless s is its smallest position */
+    p = (s * m) % last;
+    while(p > s)
+    {
+      p = (p * m) % last;
+    }
+
+    if(p < s)
+    {
+      continue;
+    }
+
+    D->start(D->ctx, pSave, pBuf + (s * chunkSize), bytes, 1u, bytes, bytes);
+
+    /* Position p receives the chunk at (p*n) mod last, the wait for a load also
+       covers the store of the same slot two moves before */
+    p = s;
+    src = (p * n) % last;
+    b = 0u;
+
+    while(src != s)
+    {
+      id = D->start(D->ctx, pSlot[b], pBuf + (src * chunkSize), bytes, 1u, bytes, bytes);
+      D->wait(D->ctx, id);
+      D->start(D->ctx, pBuf + (p * chunkSize), pSlot[b], bytes, 1u, bytes, bytes);
+
+      p = src;
+      src = (p * n) % last;
+      b ^= 1u;
+    }
+
+    id = D->start(D->ctx, pBuf + (p * chunkSize), pSave, bytes, 1u, bytes, bytes);
+    D->wait(D->ctx, id);
+  }
+}
+
+/**
+ * @brief Floating-point CFFT streamed from L2 through tiles in L1.
+ * @param[in]      *D        points to the DMA hook.
+ * @param[in]      *S        points to an instance of the streamed floating-point CFFT structure.
+ * @param[in, out] *pBuf     points to the complex input of <code>2*N</code> words in L2, overwritten.
+ * @param[out]     *pDst     points to the complex output of <code>2*N</code> words in L2, in natural order, may be <code>pBuf</code>.
+ * @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @return none.
+ *
+ * \par
+ * The data is seen as a matrix of N1 rows and N2 columns, <code>x[N2*n1 + n2]</code>, and the
+ * transform is computed in four steps:
+ * <pre>
+ *    1. N2 FFTs of length N1 over the columns
+ *    2. multiplication of element (k1, n2) by W_N^(n2*k1), results written back to pBuf
+ *    3. N1 FFTs of length N2 over the rows
+ *    4. X[k1 + N1*k2] = element (k1, k2), written to pDst
+ * </pre>
+ * Steps 1 and 2 move <code>tileSize</code> columns per transfer and steps 3 and 4 <code>tileSize</code> rows,
+ * with the same double buffering as riscv_stream_process(), so L1 only holds the tiles and the twiddle tables
+ * of the instance, the tables of the two sub-transforms stay where they are linked.  A transform of 4096 points as 64 x 64 with
+ * <code>tileSize = 2</code> uses 4.5 KB of L1 for the tiles.  The sub-transforms are computed by
+ * riscv_cfft_f32(), the inverse transform is scaled by <code>1/N</code>.
+ *
+ * \par
+ * When <code>pDst</code> is <code>pBuf</code> step 3 writes the rows back and step 4 is an in-place transpose
+ * of the N1 x N2 matrix, so no second buffer is needed in L2 and the working memory stays the L1 buffer of the
+ * instance for any length.  With R = min(N1, N2) the transpose swaps blocks of the R x R squares and, when N1
+ * differs from N2, permutes the rows of R elements along the cycles of the permutation.  This costs two more
+ * passes over the data than the transform to a separate <code>pDst</code>.
+ */
+
+void riscv_cfft_stream_f32(
+  const riscv_dma_instance * D,
+  const riscv_cfft_stream_instance_f32 * S,
+  float32_t * pBuf,
+  float32_t * pDst,
+  uint8_t ifftFlag)
+{
+  RISCV_PROFILE(riscv_cfft_stream_f32);
+  riscv_cfft_stream_geom_f32 in, out;
+  uint32_t N1 = S->pCol->fftLen, N2 = S->pRow->fftLen;
+  uint32_t T = S->tileSize;
+  uint32_t R, B;
+
+  /* Columns n2 = tile*T .. tile*T+T-1, rows of T complex values N2 apart */
+  in.pBase = pBuf;
+  in.tileStep = 2u * T;
+  in.rowSize = T * 2u * sizeof(float32_t);
+  in.numRows = N1;
+  in.stride = N2 * 2u * sizeof(float32_t);
+  out = in;
+
+  riscv_cfft_stream_pass_f32(D, S, &in, &out, N2 / T, 2u * N1 * T, riscv_cfft_stream_cols_f32, ifftFlag);
+
+  if(pDst == pBuf)
+  {
+    /* Rows k1 = tile*T .. tile*T+T-1 transformed in place */
+    in.pBase = pBuf;
+    in.tileStep = 2u * T * N2;
+    in.rowSize = T * N2 * 2u * sizeof(float32_t);
+    in.numRows = 1u;
+    in.stride = 0u;
+    out = in;
+
+    riscv_cfft_stream_pass_f32(D, S, &in, &out, N1 / T, 2u * N2 * T, riscv_cfft_stream_rows_inplace_f32, ifftFlag);
+
+    /* Largest block side for which two blocks fit in the L1 buffer */
+    R = (N1 < N2) ? N1 : N2;
+    B = R;
+    while((4u * B * B) > RISCV_CFFT_STREAM_L1_SIZE(N1, N2, T))
+    {
+      B >>= 1u;
+    }
+
+    /* N1 x N2 to N2 x N1, as R x R squares and chunks of R elements */
+    if(N1 > N2)
+    {
+      riscv_cfft_stream_chunks_f32(D, S->pL1, pBuf, N1 / N2, N2, 2u * R);
+      riscv_cfft_stream_squares_f32(D, S->pL1, pBuf, R, N1, B);
+    }
+    else
+    {
+      riscv_cfft_stream_squares_f32(D, S->pL1, pBuf, R, N2, B);
+
+      if(N2 > N1)
+      {
+        riscv_cfft_stream_chunks_f32(D, S->pL1, pBuf, N1, N2 / N1, 2u * R);
+      }
+    }
+
+    return;
+  }
+
+  /* Rows k1 = tile*T .. tile*T+T-1 in, bins k1 + N1*k2 out */
+  in.pBase = pBuf;
+  in.tileStep = 2u * T * N2;
+  in.rowSize = T * N2 * 2u * sizeof(float32_t);
+  in.numRows = 1u;
+  in.stride = 0u;
+
+  out.pBase = pDst;
+  out.tileStep = 2u * T;
+  out.rowSize = T * 2u * sizeof(float32_t);
+  out.numRows = N2;
+  out.stride = N1 * 2u * sizeof(float32_t);
+
+  riscv_cfft_stream_pass_f32(D, S, &in, &out, N1 / T, 2u * N2 * T, riscv_cfft_stream_rows_f32, ifftFlag);
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_cfft_stream_init_f32.c
+*
+* Description:  Initialization function of the floating-point CFFT
+*               streamed from L2 through tiles in L1.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function of the floating-point CFFT streamed from L2 through tiles in L1.
+ * @param[out] *S        points to an instance of the streamed floating-point CFFT structure.
+ * @param[in]  *pCol     points to the CFFT instance of length N1, e.g. riscv_cfft_sR_f32_len64.
+ * @param[in]  *pRow     points to the CFFT instance of length N2.
+ * @param[in]  tileSize  number of columns and rows moved per transfer, divides N1 and N2.
+ * @param[out] *pTwiddle points to a buffer of RISCV_CFFT_STREAM_TWIDDLE_SIZE(N1, N2) words in L1.
+ * @param[in]  *pL1      points to a buffer of RISCV_CFFT_STREAM_L1_SIZE(N1, N2, tileSize) words in L1.
+ * @return     The function returns RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>tileSize</code>
+ * is 0 or does not divide both lengths.
+ *
+ * \par
+ * The length of the transform is <code>N = N1*N2</code>.  The twiddle factors <code>W_N^e</code>,
+ * <code>e < N</code>, of the transform are the products of two factors of the tables
+ * <code>W_N^lo</code>, <code>lo < N1</code>, and <code>W_N^(hi*N1)</code>, <code>hi < N2</code>,
+ * which are computed in double precision.
+ */
+
+riscv_status riscv_cfft_stream_init_f32(
+  riscv_cfft_stream_instance_f32 * S,
+  const riscv_cfft_instance_f32 * pCol,
+  const riscv_cfft_instance_f32 * pRow,
+  uint16_t tileSize,
+  float32_t * pTwiddle,
+  float32_t * pL1)
+{
+  RISCV_PROFILE(riscv_cfft_stream_init_f32);
+  uint32_t N1 = pCol->fftLen, N2 = pRow->fftLen;
+  uint32_t N = N1 * N2;
+  uint32_t i;
+  double phi;
+
+  if((tileSize == 0u) || ((N1 % tileSize) != 0u) || ((N2 % tileSize) != 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < N1; i++)
+  {
+    phi = (6.28318530717958647692 * (double) i) / (double) N;
+    pTwiddle[2u * i] = (float32_t) cos(phi);
+    pTwiddle[(2u * i) + 1u] = (float32_t) sin(phi);
+  }
+
+  for (i = 0u; i < N2; i++)
+  {
+    phi = (6.28318530717958647692 * (double) i) / (double) N2;
+    pTwiddle[2u * (N1 + i)] = (float32_t) cos(phi);
+    pTwiddle[(2u * (N1 + i)) + 1u] = (float32_t) sin(phi);
+  }
+
+  S->fftLen = N;
+  S->pCol = pCol;
+  S->pRow = pRow;
+  S->tileSize = tileSize;
+  S->pTwiddle = pTwiddle;
+  S->pL1 = pL1;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_czt_f32.c
+*
+* Description:  Floating-point chirp-Z transform through the CFFT
+*               (Bluestein's algorithm).
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup ChirpZ Chirp-Z Transform
+ *
+ * The chirp-Z transform computes numBins bins of the DTFT of inputLen complex samples at any
+ * frequency spacing:
+ * <pre>
+ *    X[k] = sum(n=0..inputLen-1) x[n] * exp(-j*2*pi*(fStart + k*fStep)*n),   0 <= k < numBins
+ * </pre>
+ * with fStart and fStep in cycles per sample.  A narrow band is resolved with numBins bins of
+ * fStep = band/numBins, where the DFT would need 1/fStep points for the same spacing.
+ *
+ * \par
+ * Bluestein's algorithm writes n*k as (n^2 + k^2 - (k-n)^2)/2, which turns the transform into the
+ * convolution of the chirped input with a chirp, computed with a forward and an inverse CFFT of a
+ * length L >= inputLen+numBins-1.  The chirps and the spectrum of the convolution chirp are computed
+ * once by the initialization function; a transform is the two CFFTs and three complex multiplications.
+ *
+ * \par
+ * The Q31 transform runs riscv_cfft_scaled_q31() with block floating-point scaling and returns the
+ * exponent of its output.  See also the \ref ZoomFFT, which gets the same resolution from a stream.
+ */
+
+/**
+ * @addtogroup ChirpZ
+ * @{
+ */
+
+/**
+* @brief  Floating-point chirp-Z transform.
+* @param[in]      *S     points to an instance of the floating-point CZT structure.
+* @param[in]      *pSrc  points to the <code>inputLen</code> complex input samples.
+* @param[out]     *pDst  points to the <code>numBins</code> complex output bins.
+* @return none.
+*/
+
+void riscv_czt_f32(
+  const riscv_czt_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_czt_f32);
+  const riscv_cfft_instance_f32 *pCfft = S->pCfft;
+  uint32_t fftLen = pCfft->fftLen;
+  uint32_t inputLen = S->inputLen;
+  float32_t *pBuf = S->pScratch;
+
+  /*  Chirped input, zero padded to the CFFT length */
+  riscv_cmplx_mult_cmplx_f32((float32_t *) pSrc, (float32_t *) S->pPre, pBuf, inputLen);
+  riscv_fill_f32(0.0f, &pBuf[2u * inputLen], 2u * (fftLen - inputLen));
+
+  /*  Convolution with the chirp, the 1/fftLen of the inverse is in the filter */
+  riscv_cfft_f32(pCfft, pBuf, 0u, 1u);
+  riscv_cmplx_mult_cmplx_f32(pBuf, (float32_t *) S->pFilter, pBuf, fftLen);
+  riscv_cfft_f32(pCfft, pBuf, RISCV_FFT_INVERSE_NOSCALE, 1u);
+
+  /*  Output chirp */
+  riscv_cmplx_mult_cmplx_f32(pBuf, (float32_t *) S->pPost, pDst, S->numBins);
+}
+
+/**
+* @} end of ChirpZ group
+*/
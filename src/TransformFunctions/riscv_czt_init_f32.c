@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_czt_init_f32.c
+*
+* Description:  Initialization function for the floating-point chirp-Z
+*               transform.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ChirpZ
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point CZT.
+* @param[out]    *S          points to an instance of the floating-point CZT structure.
+* @param[in]     inputLen    number of complex input samples.
+* @param[in]     numBins     number of output bins.
+* @param[in]     fStart      frequency of bin 0 in cycles per sample.
+* @param[in]     fStep       bin spacing in cycles per sample.
+* @param[in]     *pCfft      points to a CFFT instance of length <code>inputLen+numBins-1</code> or longer.
+* @param[out]    *pCoef      points to a buffer of RISCV_CZT_COEF_SIZE(inputLen, numBins, pCfft->fftLen) words.
+* @param[in]     *pScratch   points to the scratch buffer of <code>2*pCfft->fftLen</code> words.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>inputLen</code> or <code>numBins</code> is 0 or the CFFT is too short.
+*
+* \par Description:
+* The chirps are computed in double precision with the phases reduced modulo one turn, so long
+* transforms keep the accuracy of the single-precision tables.  The spectrum of the convolution
+* chirp is computed with <code>pCfft</code> and folds in the 1/fftLen of the inverse transform.
+* The coefficient and scratch buffers must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_czt_init_f32(
+  riscv_czt_instance_f32 * S,
+  uint16_t inputLen,
+  uint16_t numBins,
+  float32_t fStart,
+  float32_t fStep,
+  const riscv_cfft_instance_f32 * pCfft,
+  float32_t * pCoef,
+  float32_t * pScratch)
+{
+  RISCV_PROFILE(riscv_czt_init_f32);
+  uint32_t fftLen = pCfft->fftLen;
+  float32_t *pPre = pCoef;
+  float32_t *pPost = pCoef + (2u * inputLen);
+  float32_t *pFilter = pPost + (2u * numBins);
+  float64_t turns;
+  uint32_t n;
+
+  if((inputLen == 0u) || (numBins == 0u) || (((uint32_t) inputLen + numBins - 1u) > fftLen))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  exp(-j*2*pi*(fStart*n + fStep*n^2/2)), demodulation and chirp of the input */
+  for (n = 0u; n < inputLen; n++)
+  {
+    turns = ((float64_t) fStart * n) + (0.5 * (float64_t) fStep * ((float64_t) n * n));
+    turns = 6.283185307179586 * (turns - floor(turns));
+    pPre[2u * n] = (float32_t) cos(turns);
+    pPre[(2u * n) + 1u] = (float32_t) -sin(turns);
+  }
+
+  /*  exp(-j*pi*fStep*k^2), chirp of the output */
+  for (n = 0u; n < numBins; n++)
+  {
+    turns = 0.5 * (float64_t) fStep * ((float64_t) n * n);
+    turns = 6.283185307179586 * (turns - floor(turns));
+    pPost[2u * n] = (float32_t) cos(turns);
+    pPost[(2u * n) + 1u] = (float32_t) -sin(turns);
+  }
+
+  /*  exp(+j*pi*fStep*m^2) for -inputLen < m < numBins, negative m wrapped to the end */
+  riscv_fill_f32(0.0f, pFilter, 2u * fftLen);
+  for (n = 0u; n < numBins; n++)
+  {
+    pFilter[2u * n] = pPost[2u * n];
+    pFilter[(2u * n) + 1u] = -pPost[(2u * n) + 1u];
+  }
+  for (n = 1u; n < inputLen; n++)
+  {
+    turns = 0.5 * (float64_t) fStep * ((float64_t) n * n);
+    turns = 6.283185307179586 * (turns - floor(turns));
+    pFilter[2u * (fftLen - n)] = (float32_t) cos(turns);
+    pFilter[(2u * (fftLen - n)) + 1u] = (float32_t) sin(turns);
+  }
+
+  riscv_cfft_f32(pCfft, pFilter, 0u, 1u);
+  riscv_scale_f32(pFilter, 1.0f / (float32_t) fftLen, pFilter, 2u * fftLen);
+
+  S->inputLen = inputLen;
+  S->numBins = numBins;
+  S->pCfft = pCfft;
+  S->pPre = pPre;
+  S->pPost = pPost;
+  S->pFilter = pFilter;
+  S->pScratch = pScratch;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of ChirpZ group
+*/
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_czt_init_q31.c
+*
+* Description:  Initialization function for the Q31 chirp-Z transform.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ChirpZ
+ * @{
+ */
+
+/* exp(-j*2*pi*turns) in Q31 */
+static void riscv_czt_phasor_q31(
+  float64_t turns,
+  q31_t * pDst)
+{
+  turns = 6.283185307179586 * (turns - floor(turns));
+  pDst[0] = clip_q63_to_q31((q63_t) llround(cos(turns) * 2147483648.0));
+  pDst[1] = clip_q63_to_q31((q63_t) llround(-sin(turns) * 2147483648.0));
+}
+
+/**
+* @brief  Initialization function for the Q31 CZT.
+* @param[out]    *S          points to an instance of the Q31 CZT structure.
+* @param[in]     inputLen    number of complex input samples.
+* @param[in]     numBins     number of output bins.
+* @param[in]     fStart      frequency of bin 0 in cycles per sample.
+* @param[in]     fStep       bin spacing in cycles per sample.
+* @param[in]     *pCfft      points to a Q31 CFFT instance of length <code>inputLen+numBins-1</code> or longer.
+* @param[out]    *pCoef      points to a buffer of RISCV_CZT_COEF_SIZE(inputLen, numBins, pCfft->fftLen) words.
+* @param[in]     *pScratch   points to the scratch buffer of <code>2*pCfft->fftLen</code> words.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>inputLen</code> or <code>numBins</code> is 0 or the CFFT is too short.
+*
+* \par Description:
+* The frequencies are given in floating point so that the bin spacing is not limited to the
+* resolution of a Q31 value.  The spectrum of the convolution chirp is computed with
+* riscv_cfft_scaled_q31() in block floating point, its exponent is kept in the instance.
+* The coefficient and scratch buffers must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_czt_init_q31(
+  riscv_czt_instance_q31 * S,
+  uint16_t inputLen,
+  uint16_t numBins,
+  float32_t fStart,
+  float32_t fStep,
+  const riscv_cfft_instance_q31 * pCfft,
+  q31_t * pCoef,
+  q31_t * pScratch)
+{
+  RISCV_PROFILE(riscv_czt_init_q31);
+  uint32_t fftLen = pCfft->fftLen;
+  q31_t *pPre = pCoef;
+  q31_t *pPost = pCoef + (2u * inputLen);
+  q31_t *pFilter = pPost + (2u * numBins);
+  uint32_t n;
+
+  if((inputLen == 0u) || (numBins == 0u) || (((uint32_t) inputLen + numBins - 1u) > fftLen))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  exp(-j*2*pi*(fStart*n + fStep*n^2/2)), demodulation and chirp of the input */
+  for (n = 0u; n < inputLen; n++)
+  {
+    riscv_czt_phasor_q31(((float64_t) fStart * n) + (0.5 * (float64_t) fStep * ((float64_t) n * n)), &pPre[2u * n]);
+  }
+
+  /*  exp(-j*pi*fStep*k^2), chirp of the output */
+  for (n = 0u; n < numBins; n++)
+  {
+    riscv_czt_phasor_q31(0.5 * (float64_t) fStep * ((float64_t) n * n), &pPost[2u * n]);
+  }
+
+  /*  exp(+j*pi*fStep*m^2)/2 for -inputLen < m < numBins, negative m wrapped to the end */
+  riscv_fill_q31(0, pFilter, 2u * fftLen);
+  for (n = 0u; n < numBins; n++)
+  {
+    pFilter[2u * n] = pPost[2u * n] >> 1;
+    pFilter[(2u * n) + 1u] = -(pPost[(2u * n) + 1u] >> 1);
+  }
+  for (n = 1u; n < inputLen; n++)
+  {
+    riscv_czt_phasor_q31(-0.5 * (float64_t) fStep * ((float64_t) n * n), &pFilter[2u * (fftLen - n)]);
+    pFilter[2u * (fftLen - n)] >>= 1;
+    pFilter[(2u * (fftLen - n)) + 1u] >>= 1;
+  }
+
+  S->filterShift = (uint8_t) (riscv_cfft_scaled_q31(pCfft, pFilter, 0u, 1u, RISCV_CFFT_SCALE_BFP) + 1u);
+  S->inputLen = inputLen;
+  S->numBins = numBins;
+  S->pCfft = pCfft;
+  S->pPre = pPre;
+  S->pPost = pPost;
+  S->pFilter = pFilter;
+  S->pScratch = pScratch;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of ChirpZ group
+*/
@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_czt_q31.c
+*
+* Description:  Q31 chirp-Z transform through the block floating-point
+*               CFFT (Bluestein's algorithm).
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ChirpZ
+ * @{
+ */
+
+/* pDst = pSrcA * pSrcB / 2, the halving keeps the sum of two products in range */
+static void riscv_czt_mult_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t numSamples)
+{
+  q31_t a, b, c, d;
+
+  while(numSamples > 0u)
+  {
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    *pDst++ = (q31_t) ((((q63_t) a * c) - ((q63_t) b * d)) >> 32);
+    *pDst++ = (q31_t) ((((q63_t) a * d) + ((q63_t) b * c)) >> 32);
+
+    numSamples--;
+  }
+}
+
+/**
+* @brief  Q31 chirp-Z transform.
+* @param[in]      *S     points to an instance of the Q31 CZT structure.
+* @param[in]      *pSrc  points to the <code>inputLen</code> complex input samples.
+* @param[out]     *pDst  points to the <code>numBins</code> complex output bins.
+* @return the exponent of the output, the output is the transform times 2^-shift.
+*
+* \par
+* The two CFFTs scale in block floating point, so a weak input keeps its precision and the
+* returned shift, which is negative when the output is larger than the transform, varies from
+* call to call.  The three complex multiplications halve their products.
+*/
+
+int32_t riscv_czt_q31(
+  const riscv_czt_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  RISCV_PROFILE(riscv_czt_q31);
+  const riscv_cfft_instance_q31 *pCfft = S->pCfft;
+  uint32_t fftLen = pCfft->fftLen;
+  uint32_t inputLen = S->inputLen;
+  q31_t *pBuf = S->pScratch;
+  int32_t shift;
+
+  /*  Chirped input, zero padded to the CFFT length */
+  riscv_czt_mult_q31(pSrc, S->pPre, pBuf, inputLen);
+  riscv_fill_q31(0, &pBuf[2u * inputLen], 2u * (fftLen - inputLen));
+
+  /*  Convolution with the chirp */
+  shift = (int32_t) riscv_cfft_scaled_q31(pCfft, pBuf, 0u, 1u, RISCV_CFFT_SCALE_BFP);
+  riscv_czt_mult_q31(pBuf, S->pFilter, pBuf, fftLen);
+  shift += (int32_t) riscv_cfft_scaled_q31(pCfft, pBuf, 1u, 1u, RISCV_CFFT_SCALE_BFP);
+
+  /*  Output chirp */
+  riscv_czt_mult_q31(pBuf, S->pPost, pDst, S->numBins);
+
+  /*  Three halvings and the filter exponent, less the gain fftLen of the unscaled inverse */
+  return (shift + (int32_t) S->filterShift + 3 - (int32_t) (31u - __CLZ(fftLen)));
+}
+
+/**
+* @} end of ChirpZ group
+*/
@@ -0,0 +1,294 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dct2_f32.c
+*
+* Description:  Fixed-size floating-point DCT-II and DCT-III.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/*
+* A length N DCT-II splits into a length N/2 DCT-II of the sums
+* a[n] = x[n] + x[N-1-n], which gives the even outputs, and a length N/2
+* DCT-IV of the differences d[n] = x[n] - x[N-1-n], which gives the odd ones.
+* Since 2*cos(t)*cos(u) = cos(u+t) + cos(u-t), the DCT-II W of
+* u[n] = 2*cos(pi*(2n+1)/(2N))*d[n] satisfies W[k] = Y[k] + Y[k-1] for the
+* DCT-IV Y, with Y[-1] = Y[0].  The odd outputs follow from
+* Y[0] = W[0]/2 and Y[k] = W[k] - Y[k-1].
+*
+* The recursion costs (N/2)*log2(N) multiplications, 12 for N = 8, and only
+* multiplies by 2*cos() <= 2, so it behaves in fixed-point as well.  The
+* DCT-III runs the transposed flow graph in the reverse order.
+*
+* riscvDct2Coef_f32 holds 2*cos(pi*(2n+1)/(2N)), n = 0 .. N/2-1, for
+* N = 2, 4, 8, 16 and 32, the values of length N start at N/2-1.
+*/
+
+static const float32_t riscvDct2Coef_f32[31] =
+{
+  1.414213562f, 1.847759065f, 0.765366865f, 1.961570561f,
+  1.662939225f, 1.111140466f, 0.390180644f, 1.990369453f,
+  1.913880671f, 1.763842529f, 1.546020907f, 1.268786568f,
+  0.942793474f, 0.580569355f, 0.196034281f, 1.997590912f,
+  1.978353020f, 1.940062506f, 1.883088130f, 1.807978586f,
+  1.715457220f, 1.606415063f, 1.481902251f, 1.343117910f,
+  1.191398609f, 1.028205488f, 0.855110187f, 0.673779707f,
+  0.485960360f, 0.293460949f, 0.098135349f
+};
+
+/*
+* @brief  In-place unnormalized DCT-II, X[k] = sum x[n]*cos(pi*(2n+1)*k/(2N)).
+* @param[in,out] *p     points to the N values.
+* @param[in]     *pTmp  points to a scratch buffer of 2*N values.
+* @param[in]     N      length, a power of two from 1 to 32.
+*/
+
+static void riscv_dct2_core_f32(
+  float32_t * p,
+  float32_t * pTmp,
+  uint32_t N)
+{
+  const float32_t *pCoef;
+  uint32_t M = N >> 1u, n;
+  float32_t y;
+
+  if(N == 1u)
+  {
+    return;
+  }
+
+  pCoef = &riscvDct2Coef_f32[M - 1u];
+
+  /*  Sums for the even outputs and weighted differences for the odd outputs */
+  for (n = 0u; n < M; n++)
+  {
+    pTmp[n] = p[n] + p[N - 1u - n];
+    pTmp[M + n] = (p[n] - p[N - 1u - n]) * pCoef[n];
+  }
+
+  riscv_dct2_core_f32(pTmp, pTmp + N, M);
+  riscv_dct2_core_f32(pTmp + M, pTmp + N, M);
+
+  /*  Interleave the even outputs with the DCT-IV recovered from W */
+  y = 0.5f * pTmp[M];
+  p[0] = pTmp[0];
+  p[1] = y;
+
+  for (n = 1u; n < M; n++)
+  {
+    y = pTmp[M + n] - y;
+    p[2u * n] = pTmp[n];
+    p[(2u * n) + 1u] = y;
+  }
+}
+
+/*
+* @brief  In-place transposed DCT-II, x[n] = sum X[k]*cos(pi*(2n+1)*k/(2N)).
+* @param[in,out] *p     points to the N values.
+* @param[in]     *pTmp  points to a scratch buffer of 2*N values.
+* @param[in]     N      length, a power of two from 1 to 32.
+*/
+
+static void riscv_dct3_core_f32(
+  float32_t * p,
+  float32_t * pTmp,
+  uint32_t N)
+{
+  const float32_t *pCoef;
+  uint32_t M = N >> 1u, n;
+  float32_t w, a, d;
+
+  if(N == 1u)
+  {
+    return;
+  }
+
+  pCoef = &riscvDct2Coef_f32[M - 1u];
+
+  /*  Even inputs and the transposed DCT-IV recurrence of the odd inputs */
+  w = 0.0f;
+
+  for (n = M - 1u; n > 0u; n--)
+  {
+    w = p[(2u * n) + 1u] - w;
+    pTmp[M + n] = w;
+    pTmp[n] = p[2u * n];
+  }
+
+  pTmp[M] = 0.5f * (p[1] - w);
+  pTmp[0] = p[0];
+
+  riscv_dct3_core_f32(pTmp, pTmp + N, M);
+  riscv_dct3_core_f32(pTmp + M, pTmp + N, M);
+
+  /*  Butterflies of the even and odd halves */
+  for (n = 0u; n < M; n++)
+  {
+    a = pTmp[n];
+    d = pTmp[M + n] * pCoef[n];
+    p[n] = a + d;
+    p[N - 1u - n] = a - d;
+  }
+}
+
+static void riscv_dct2_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t N)
+{
+  float32_t tmp[64];
+  uint32_t n;
+
+  for (n = 0u; n < N; n++)
+  {
+    pDst[n] = pSrc[n];
+  }
+
+  riscv_dct2_core_f32(pDst, tmp, N);
+}
+
+static void riscv_dct3_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t N)
+{
+  float32_t tmp[64];
+  float32_t scale = 2.0f / (float32_t) N;
+  uint32_t n;
+
+  /*  The 2/N scaling and the half weight of X[0] make it the inverse of the DCT-II */
+  pDst[0] = pSrc[0] * (0.5f * scale);
+
+  for (n = 1u; n < N; n++)
+  {
+    pDst[n] = pSrc[n] * scale;
+  }
+
+  riscv_dct3_core_f32(pDst, tmp, N);
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup DCT2 DCT Type II and III
+ *
+ * \par
+ * Fixed-size DCT-II and its inverse, the DCT-III, for the block sizes of image and audio codecs.
+ * The DCT-II is computed without normalization:
+ * <pre>
+ *    X[k] = sum(x[n] * cos(pi * (2n+1) * k / (2N))), n = 0, 1, ..., N-1
+ * </pre>
+ * and the DCT-III returns the input of the DCT-II:
+ * <pre>
+ *    x[n] = 2/N * (X[0]/2 + sum(X[k] * cos(pi * (2n+1) * k / (2N)))), k = 1, 2, ..., N-1
+ * </pre>
+ * \par
+ * The length is part of the function name, N = 8, 16 or 32.  There is no instance structure and no
+ * initialization function, the transforms only use N-1 constants.  A fast recursive factorization needs
+ * <code>(N/2)*log2(N)</code> multiplications, 12 for N = 8, 32 for N = 16 and 80 for N = 32.
+ * \par
+ * <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+ */
+
+/**
+ * @addtogroup DCT2
+ * @{
+ */
+
+/**
+* @brief  8-point floating-point DCT-II.
+* @param[in]  *pSrc points to the 8 input samples.
+* @param[out] *pDst points to the 8 output coefficients.
+* @return none.
+*/
+
+void riscv_dct2_8_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_dct2_8_f32);
+  riscv_dct2_f32(pSrc, pDst, 8u);
+}
+
+/**
+* @brief  16-point floating-point DCT-II.
+* @param[in]  *pSrc points to the 16 input samples.
+* @param[out] *pDst points to the 16 output coefficients.
+* @return none.
+*/
+
+void riscv_dct2_16_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_dct2_16_f32);
+  riscv_dct2_f32(pSrc, pDst, 16u);
+}
+
+/**
+* @brief  32-point floating-point DCT-II.
+* @param[in]  *pSrc points to the 32 input samples.
+* @param[out] *pDst points to the 32 output coefficients.
+* @return none.
+*/
+
+void riscv_dct2_32_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_dct2_32_f32);
+  riscv_dct2_f32(pSrc, pDst, 32u);
+}
+
+/**
+* @brief  8-point floating-point DCT-III, the inverse of riscv_dct2_8_f32().
+* @param[in]  *pSrc points to the 8 input coefficients.
+* @param[out] *pDst points to the 8 output samples.
+* @return none.
+*/
+
+void riscv_dct3_8_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_dct3_8_f32);
+  riscv_dct3_f32(pSrc, pDst, 8u);
+}
+
+/**
+* @brief  16-point floating-point DCT-III, the inverse of riscv_dct2_16_f32().
+* @param[in]  *pSrc points to the 16 input coefficients.
+* @param[out] *pDst points to the 16 output samples.
+* @return none.
+*/
+
+void riscv_dct3_16_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_dct3_16_f32);
+  riscv_dct3_f32(pSrc, pDst, 16u);
+}
+
+/**
+* @brief  32-point floating-point DCT-III, the inverse of riscv_dct2_32_f32().
+* @param[in]  *pSrc points to the 32 input coefficients.
+* @param[out] *pDst points to the 32 output samples.
+* @return none.
+*/
+
+void riscv_dct3_32_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_dct3_32_f32);
+  riscv_dct3_f32(pSrc, pDst, 32u);
+}
+
+/**
+* @} end of DCT2 group
+*/
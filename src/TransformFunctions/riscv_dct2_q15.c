@@ -0,0 +1,304 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dct2_q15.c
+*
+* Description:  Fixed-size Q15 DCT-II and DCT-III.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/*
+* The factorization is the one of riscv_dct2_f32.c.  The intermediate values
+* are kept in 32 bits with RISCV_DCT2_Q15_GUARD fractional bits below the
+* Q15 LSB and are not scaled between the stages, the multiplications by
+* 2*cos() use Q31 cosines and a 64-bit product.  Only the outputs are scaled
+* and saturated.  No intermediate value exceeds 2^7 times the largest input
+* for N <= 32, so 8 guard bits fit in 32 bits with Q15 inputs.
+*
+* riscvDct2Coef_q31 holds cos(pi*(2n+1)/(2N)), n = 0 .. N/2-1, for
+* N = 2, 4, 8, 16 and 32, the values of length N start at N/2-1.
+*/
+
+#define RISCV_DCT2_Q15_GUARD    8
+
+static const q31_t riscvDct2Coef_q31[31] =
+{
+  0x5A82799A, 0x7641AF3D, 0x30FBC54D, 0x7D8A5F40, 0x6A6D98A4, 0x471CECE7,
+  0x18F8B83C, 0x7F62368F, 0x7A7D055B, 0x70E2CBC6, 0x62F201AC, 0x5133CC94,
+  0x3C56BA70, 0x25280C5E, 0x0C8BD35E, 0x7FD8878E, 0x7E9D55FC, 0x7C29FBEE,
+  0x78848414, 0x73B5EBD1, 0x6DCA0D14, 0x66CF8120, 0x5ED77C8A, 0x55F5A4D2,
+  0x4C3FDFF4, 0x41CE1E65, 0x36BA2014, 0x2B1F34EB, 0x1F19F97B, 0x12C8106F,
+  0x0647D97C
+};
+
+/*
+* @brief  In-place unnormalized DCT-II, X[k] = sum x[n]*cos(pi*(2n+1)*k/(2N)).
+* @param[in,out] *p     points to the N values.
+* @param[in]     *pTmp  points to a scratch buffer of 2*N values.
+* @param[in]     N      length, a power of two from 1 to 32.
+*/
+
+static void riscv_dct2_core_q15(
+  q31_t * p,
+  q31_t * pTmp,
+  uint32_t N)
+{
+  const q31_t *pCoef;
+  uint32_t M = N >> 1u, n;
+  q31_t y;
+
+  if(N == 1u)
+  {
+    return;
+  }
+
+  pCoef = &riscvDct2Coef_q31[M - 1u];
+
+  /*  Sums for the even outputs and weighted differences for the odd outputs */
+  for (n = 0u; n < M; n++)
+  {
+    pTmp[n] = p[n] + p[N - 1u - n];
+    pTmp[M + n] = (q31_t) ((((q63_t) (p[n] - p[N - 1u - n]) * pCoef[n]) + 0x20000000) >> 30);
+  }
+
+  riscv_dct2_core_q15(pTmp, pTmp + N, M);
+  riscv_dct2_core_q15(pTmp + M, pTmp + N, M);
+
+  /*  Interleave the even outputs with the DCT-IV recovered from W */
+  y = pTmp[M] >> 1;
+  p[0] = pTmp[0];
+  p[1] = y;
+
+  for (n = 1u; n < M; n++)
+  {
+    y = pTmp[M + n] - y;
+    p[2u * n] = pTmp[n];
+    p[(2u * n) + 1u] = y;
+  }
+}
+
+/*
+* @brief  In-place transposed DCT-II, x[n] = sum X[k]*cos(pi*(2n+1)*k/(2N)).
+* @param[in,out] *p     points to the N values.
+* @param[in]     *pTmp  points to a scratch buffer of 2*N values.
+* @param[in]     N      length, a power of two from 1 to 32.
+*/
+
+static void riscv_dct3_core_q15(
+  q31_t * p,
+  q31_t * pTmp,
+  uint32_t N)
+{
+  const q31_t *pCoef;
+  uint32_t M = N >> 1u, n;
+  q31_t w, a, d;
+
+  if(N == 1u)
+  {
+    return;
+  }
+
+  pCoef = &riscvDct2Coef_q31[M - 1u];
+
+  /*  Even inputs and the transposed DCT-IV recurrence of the odd inputs */
+  w = 0;
+
+  for (n = M - 1u; n > 0u; n--)
+  {
+    w = p[(2u * n) + 1u] - w;
+    pTmp[M + n] = w;
+    pTmp[n] = p[2u * n];
+  }
+
+  pTmp[M] = (p[1] - w) >> 1;
+  pTmp[0] = p[0];
+
+  riscv_dct3_core_q15(pTmp, pTmp + N, M);
+  riscv_dct3_core_q15(pTmp + M, pTmp + N, M);
+
+  /*  Butterflies of the even and odd halves */
+  for (n = 0u; n < M; n++)
+  {
+    a = pTmp[n];
+    d = (q31_t) ((((q63_t) pTmp[M + n] * pCoef[n]) + 0x20000000) >> 30);
+    p[n] = a + d;
+    p[N - 1u - n] = a - d;
+  }
+}
+
+/*
+* @brief  Rounds, shifts and saturates the results to Q15.
+*/
+
+static void riscv_dct2_out_q15(
+  const q31_t * pIn,
+  q15_t * pDst,
+  uint32_t N,
+  uint32_t shift)
+{
+  uint32_t n;
+
+  for (n = 0u; n < N; n++)
+  {
+#if defined (USE_DSP_RISCV)
+    pDst[n] = (q15_t) clip((pIn[n] + (1 << (shift - 1u))) >> shift, -32768, 32767);
+#else
+    pDst[n] = (q15_t) __SSAT((pIn[n] + (1 << (shift - 1u))) >> shift, 16);
+#endif
+  }
+}
+
+static void riscv_dct2_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t N,
+  uint32_t log2N)
+{
+  q31_t buf[32];
+  q31_t tmp[64];
+  uint32_t n;
+
+  for (n = 0u; n < N; n++)
+  {
+    buf[n] = (q31_t) pSrc[n] << RISCV_DCT2_Q15_GUARD;
+  }
+
+  riscv_dct2_core_q15(buf, tmp, N);
+
+  /*  The outputs are divided by N */
+  riscv_dct2_out_q15(buf, pDst, N, log2N + RISCV_DCT2_Q15_GUARD);
+}
+
+static void riscv_dct3_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t N)
+{
+  q31_t buf[32];
+  q31_t tmp[64];
+  uint32_t n;
+
+  /*  Half weight of X[0] */
+  buf[0] = (q31_t) pSrc[0] << (RISCV_DCT2_Q15_GUARD - 1);
+
+  for (n = 1u; n < N; n++)
+  {
+    buf[n] = (q31_t) pSrc[n] << RISCV_DCT2_Q15_GUARD;
+  }
+
+  riscv_dct3_core_q15(buf, tmp, N);
+
+  /*  The outputs are multiplied by 2 */
+  riscv_dct2_out_q15(buf, pDst, N, RISCV_DCT2_Q15_GUARD - 1u);
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup DCT2
+ * @{
+ */
+
+/**
+* @brief  8-point Q15 DCT-II.
+* @param[in]  *pSrc points to the 8 input samples.
+* @param[out] *pDst points to the 8 output coefficients.
+* @return none.
+*
+* <b>Scaling and Overflow Behavior:</b>
+* \par
+* The outputs are the unnormalized DCT-II divided by N, so they cannot overflow.  The DCT-III functions
+* take coefficients in this format and return x[n] = 2 * (X[0]/2 + sum(X[k] * cos(pi * (2n+1) * k / (2N)))),
+* which is the input of the DCT-II.  Outputs of the DCT-III outside of the Q15 range are saturated.
+*/
+
+void riscv_dct2_8_q15(
+  const q15_t * pSrc,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_dct2_8_q15);
+  riscv_dct2_q15(pSrc, pDst, 8u, 3u);
+}
+
+/**
+* @brief  16-point Q15 DCT-II.
+* @param[in]  *pSrc points to the 16 input samples.
+* @param[out] *pDst points to the 16 output coefficients, divided by 16.
+* @return none.
+*/
+
+void riscv_dct2_16_q15(
+  const q15_t * pSrc,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_dct2_16_q15);
+  riscv_dct2_q15(pSrc, pDst, 16u, 4u);
+}
+
+/**
+* @brief  32-point Q15 DCT-II.
+* @param[in]  *pSrc points to the 32 input samples.
+* @param[out] *pDst points to the 32 output coefficients, divided by 32.
+* @return none.
+*/
+
+void riscv_dct2_32_q15(
+  const q15_t * pSrc,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_dct2_32_q15);
+  riscv_dct2_q15(pSrc, pDst, 32u, 5u);
+}
+
+/**
+* @brief  8-point Q15 DCT-III, the inverse of riscv_dct2_8_q15().
+* @param[in]  *pSrc points to the 8 input coefficients.
+* @param[out] *pDst points to the 8 output samples.
+* @return none.
+*/
+
+void riscv_dct3_8_q15(
+  const q15_t * pSrc,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_dct3_8_q15);
+  riscv_dct3_q15(pSrc, pDst, 8u);
+}
+
+/**
+* @brief  16-point Q15 DCT-III, the inverse of riscv_dct2_16_q15().
+* @param[in]  *pSrc points to the 16 input coefficients.
+* @param[out] *pDst points to the 16 output samples.
+* @return none.
+*/
+
+void riscv_dct3_16_q15(
+  const q15_t * pSrc,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_dct3_16_q15);
+  riscv_dct3_q15(pSrc, pDst, 16u);
+}
+
+/**
+* @brief  32-point Q15 DCT-III, the inverse of riscv_dct2_32_q15().
+* @param[in]  *pSrc points to the 32 input coefficients.
+* @param[out] *pDst points to the 32 output samples.
+* @return none.
+*/
+
+void riscv_dct3_32_q15(
+  const q15_t * pSrc,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_dct3_32_q15);
+  riscv_dct3_q15(pSrc, pDst, 32u);
+}
+
+/**
+* @} end of DCT2 group
+*/
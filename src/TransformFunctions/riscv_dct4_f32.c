@@ -131,7 +131,7 @@
 /**    
  * @brief Processing function for the floating-point DCT4/IDCT4.   
  * @param[in]       *S             points to an instance of the floating-point DCT4/IDCT4 structure.   
- * @param[in]       *pState        points to state buffer.   
+ * @param[in]       *pState        points to the state buffer of length 2*N, or NULL for the scratch pool.
  * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.   
  * @return none.   
  */
@@ -141,6 +141,20 @@ void riscv_dct4_f32(
   float32_t * pState,
   float32_t * pInlineBuffer)
 {
+  RISCV_PROFILE(riscv_dct4_f32);
+  uint32_t scratchMark = riscv_dsp_scratch_mark(); /* scratch pool depth on entry */
+
+  /* State buffer from the scratch pool when the caller passes none */
+  if(pState == NULL)
+  {
+    pState = (float32_t *) riscv_dsp_scratch_push(2u * (uint32_t) S->N * sizeof(float32_t));
+  }
+
+  if(pState == NULL)
+  {
+    return;
+  }
+
   uint32_t i;                                    /* Loop counter */
   float32_t *weights = S->pTwiddle;              /* Pointer to the Weights table */
   float32_t *cosFact = S->pCosFactor;            /* Pointer to the cos factors table */
@@ -287,7 +301,7 @@ void riscv_dct4_f32(
     i--;
   } while(i > 0u);
 
-
+  riscv_dsp_scratch_pop(scratchMark);
 }
 
 /**    
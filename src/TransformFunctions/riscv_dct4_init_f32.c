@@ -16456,6 +16456,7 @@ riscv_status riscv_dct4_init_f32(
   uint16_t Nby2,
   float32_t normalize)
 {
+  RISCV_PROFILE(riscv_dct4_init_f32);
   /*  Initialize the default riscv status */
   riscv_status status = RISCV_MATH_SUCCESS;
 
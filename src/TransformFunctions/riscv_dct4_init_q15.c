@@ -4222,6 +4222,7 @@ riscv_status riscv_dct4_init_q15(
   uint16_t Nby2,
   q15_t normalize)
 {
+  RISCV_PROFILE(riscv_dct4_init_q15);
   /*  Initialise the default riscv status */
   riscv_status status = RISCV_MATH_SUCCESS;
 
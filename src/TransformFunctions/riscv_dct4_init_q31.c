@@ -8302,6 +8302,7 @@ riscv_status riscv_dct4_init_q31(
   uint16_t Nby2,
   q31_t normalize)
 {
+  RISCV_PROFILE(riscv_dct4_init_q31);
   /*  Initialise the default riscv status */
   riscv_status status = RISCV_MATH_SUCCESS;
 
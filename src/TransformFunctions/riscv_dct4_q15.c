@@ -47,10 +47,32 @@
  * @{    
  */
 
+/*
+* @brief  DCT2 output Y2(k), the real part of the product of one FFT output and one weight.
+* @param[in]  *pA  points to the complex FFT output.
+* @param[in]  *pW  points to the complex weight.
+* @return     Y2(k) in 1.15 format.
+*/
+
+static inline q15_t riscv_dct4_y2_q15(
+  const q15_t * pA,
+  const q15_t * pW)
+{
+#if defined (USE_DSP_RISCV)
+  /* Re(a) * Re(w) - Im(a) * Im(w) by one packed dot product with (Re(w), -Im(w)), rounded once
+     from 2.30 rather than twice from 3.13, which keeps it within a few LSB of the scalar path.
+     -Im(w) does not overflow, the imaginary parts of the weights are greater than -1 */
+  return ((q15_t) clip(dotpv2(*(shortV *) pA, pack2(pW[0], -pW[1])) >> 15, -32768, 32767));
+#else
+  /* 3.13 real part of the product as riscv_cmplx_mult_cmplx_q15, to 1.15 by shifting left by 2 bits */
+  return ((q15_t) __SSAT(((((q31_t) pA[0] * pW[0]) >> 17) - (((q31_t) pA[1] * pW[1]) >> 17)) << 2, 16));
+#endif
+}
+
 /**    
  * @brief Processing function for the Q15 DCT4/IDCT4.   
  * @param[in]       *S             points to an instance of the Q15 DCT4 structure.   
- * @param[in]       *pState        points to state buffer.   
+ * @param[in]       *pState        points to the state buffer of length 2*N, or NULL for the scratch pool.
  * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.   
  * @return none.   
  *     
@@ -67,10 +89,25 @@ void riscv_dct4_q15(
   q15_t * pState,
   q15_t * pInlineBuffer)
 {
+  RISCV_PROFILE(riscv_dct4_q15);
+  uint32_t scratchMark = riscv_dsp_scratch_mark(); /* scratch pool depth on entry */
+
+  /* State buffer from the scratch pool when the caller passes none */
+  if(pState == NULL)
+  {
+    pState = (q15_t *) riscv_dsp_scratch_push(2u * (uint32_t) S->N * sizeof(q15_t));
+  }
+
+  if(pState == NULL)
+  {
+    return;
+  }
+
   uint32_t i;                                    /* Loop counter */
   q15_t *weights = S->pTwiddle;                  /* Pointer to the Weights table */
   q15_t *cosFact = S->pCosFactor;                /* Pointer to the cos factors table */
   q15_t *pS1, *pS2, *pbuff;                      /* Temporary pointers for input buffer and pState buffer */
+  q15_t *pW;                                     /* Temporary pointer for the cos factors and the weights */
   q15_t in;                                      /* Temporary variable */
 
 
@@ -94,14 +131,11 @@ void riscv_dct4_q15(
    */
 
         /*-------- Pre-processing ------------*/
-  /* Multiplying input with cos factor i.e. r(n) = 2 * x(n) * cos(pi*(2*n+1)/(4*n)) */
-  riscv_mult_q15(pInlineBuffer, cosFact, pInlineBuffer, S->N);
-  riscv_shift_q15(pInlineBuffer, 1, pInlineBuffer, S->N);
-
   /* ----------------------------------------------------------------    
-   * Step1: Re-ordering of even and odd elements as    
-   *             pState[i] =  pInlineBuffer[2*i] and    
-   *             pState[N-i-1] = pInlineBuffer[2*i+1] where i = 0 to N/2    
+   * Multiplying input with cos factor i.e. r(n) = 2 * x(n) * cos(pi*(2*n+1)/(4*n))    
+   * and Step1, re-ordering of even and odd elements, in one pass:    
+   *             pState[i] =  r(2*i) and    
+   *             pState[N-i-1] = r(2*i+1) where i = 0 to N/2    
    ---------------------------------------------------------------------*/
 
   /* pS1 initialized to pState */
@@ -113,39 +147,31 @@ void riscv_dct4_q15(
   /* pbuff initialized to input buffer */
   pbuff = pInlineBuffer;
 
+  /* pW initialized to the cos factors */
+  pW = cosFact;
 
   /* Initializing the loop counter to N/2 */
   i = (uint32_t) S->Nby2;
 
   do
   {
-    /* Re-ordering of even and odd elements */
-    /* pState[i] =  pInlineBuffer[2*i] */
-    *pS1++ = *pbuff++;
-    /* pState[N-i-1] = pInlineBuffer[2*i+1] */
-    *pS2-- = *pbuff++;
+#if defined (USE_DSP_RISCV)
+    /* the product saturated and doubled, as riscv_mult_q15 followed by riscv_shift_q15 by 1 */
+    *pS1++ = (q15_t) clip(mulsN(pbuff[0], pW[0], 15) << 1, -32768, 32767);
+    *pS2-- = (q15_t) clip(mulsN(pbuff[1], pW[1], 15) << 1, -32768, 32767);
+#else
+    *pS1++ = (q15_t) __SSAT(__SSAT((((q31_t) pbuff[0] * pW[0]) >> 15), 16) << 1, 16);
+    *pS2-- = (q15_t) __SSAT(__SSAT((((q31_t) pbuff[1] * pW[1]) >> 15), 16) << 1, 16);
+#endif
+    pbuff += 2;
+    pW += 2;
 
     /* Decrement the loop counter */
     i--;
   } while(i > 0u);
 
-  /* pbuff initialized to input buffer */
-  pbuff = pInlineBuffer;
-
-  /* pS1 initialized to pState */
-  pS1 = pState;
-
-  /* Initializing the loop counter */
-  i = (uint32_t) S->N;
-
-  do
-  {
-    /* Writing the re-ordered output back to inplace input buffer */
-    *pbuff++ = *pS1++;
-
-    /* Decrement the loop counter */
-    i--;
-  } while(i > 0u);
+  /* Writing the re-ordered output back to inplace input buffer */
+  riscv_copy_q15(pState, pInlineBuffer, S->N);
 
 
   /* ---------------------------------------------------------    
@@ -155,19 +181,14 @@ void riscv_dct4_q15(
   riscv_rfft_q15(S->pRfft, pInlineBuffer, pState);
 
  /*----------------------------------------------------------------------    
-  *  Step3: Multiply the FFT output with the weights.    
+  *  Step3, post-processing and normalization in one pass: the real part of
+  *  the product of the FFT output and the weights is Y2(k), converted to
+  *  DCT-IV by the equation    
+  *       Y4(k) = Y2(k) - Y4(k-1) and Y4(-1) = Y4(0)    
+  *       Hence, Y4(0) = Y2(0)/2    
+  *  and multiplied with the normalizing factor sqrt(2/N).  The imaginary
+  *  parts of the product are never used, so they are not computed.    
   *----------------------------------------------------------------------*/
-  riscv_cmplx_mult_cmplx_q15(pState, weights, pState, S->N);
-
-  /* The output of complex multiplication is in 3.13 format.    
-   * Hence changing the format of N (i.e. 2*N elements) complex numbers to 1.15 format by shifting left by 2 bits. */
-  riscv_shift_q15(pState, 2, pState, S->N * 2);
-
-  /* ----------- Post-processing ---------- */
-  /* DCT-IV can be obtained from DCT-II by the equation,    
-   *       Y4(k) = Y2(k) - Y4(k-1) and Y4(-1) = Y4(0)    
-   *       Hence, Y4(0) = Y2(0)/2  */
-  /* Getting only real part from the output and Converting to DCT-IV */
 
   /* Initializing the loop counter */
   i = ((uint32_t) S->N - 1u);
@@ -178,45 +199,33 @@ void riscv_dct4_q15(
   /* pS1 initialized to pState */
   pS1 = pState;
 
+  /* pW initialized to the weights */
+  pW = weights;
+
   /* Calculating Y4(0) from Y2(0) using Y4(0) = Y2(0)/2 */
-  in = *pS1++ >> 1u;
+  in = (q15_t) (riscv_dct4_y2_q15(pS1, pW) >> 1u);
   /* input buffer acts as inplace, so output values are stored in the input itself. */
-  *pbuff++ = in;
+  *pbuff++ = ((q15_t) (((q31_t) in * S->normalize) >> 15));
 
-  /* pState pointer is incremented twice as the real values are located alternatively in the array */
-  pS1++;
+  /* the real values are located alternatively in the array */
+  pS1 += 2;
+  pW += 2;
 
   do
   {
     /* Calculating Y4(1) to Y4(N-1) from Y2 using equation Y4(k) = Y2(k) - Y4(k-1) */
-    /* pState pointer (pS1) is incremented twice as the real values are located alternatively in the array */
-    in = *pS1++ - in;
-    *pbuff++ = in;
-    /* points to the next real value */
-    pS1++;
-
-    /* Decrement the loop counter */
-    i--;
-  } while(i > 0u);
-   /*------------ Normalizing the output by multiplying with the normalizing factor ----------*/
-
-  /* Initializing the loop counter */
-  i = (uint32_t) S->N;
-
-  /* pbuff initialized to the pInlineBuffer(now contains the output values) */
-  pbuff = pInlineBuffer;
-
-  do
-  {
-    /* Multiplying pInlineBuffer with the normalizing factor sqrt(2/N) */
-    in = *pbuff;
+    in = (q15_t) (riscv_dct4_y2_q15(pS1, pW) - in);
     *pbuff++ = ((q15_t) (((q31_t) in * S->normalize) >> 15));
 
+    /* points to the next real value */
+    pS1 += 2;
+    pW += 2;
+
     /* Decrement the loop counter */
     i--;
   } while(i > 0u);
 
-
+  riscv_dsp_scratch_pop(scratchMark);
 }
 
 /**    
@@ -47,10 +47,34 @@
  * @{    
  */
 
+/*
+* @brief  DCT2 output Y2(k), the real part of the product of one FFT output and one weight.
+* @param[in]  *pA  points to the complex FFT output.
+* @param[in]  *pW  points to the complex weight.
+* @return     Y2(k) in 1.31 format.
+*/
+
+static inline q31_t riscv_dct4_y2_q31(
+  const q31_t * pA,
+  const q31_t * pW)
+{
+  q31_t re;                                      /* 3.29 real part of the product */
+
+  /* rounded as riscv_cmplx_mult_cmplx_q31 does in each build */
+#if defined (USE_DSP_RISCV)
+  re = subnr((q31_t) (((q63_t) pA[0] * pW[0]) >> 32), (q31_t) (((q63_t) pA[1] * pW[1]) >> 32), 1, 1);
+#else
+  re = ((q31_t) (((q63_t) pA[0] * pW[0]) >> 32) >> 1) - ((q31_t) (((q63_t) pA[1] * pW[1]) >> 32) >> 1);
+#endif
+
+  /* to 1.31 by shifting left by 2 bits */
+  return (clip_q63_to_q31((q63_t) re << 2));
+}
+
 /**    
  * @brief Processing function for the Q31 DCT4/IDCT4.   
  * @param[in]       *S             points to an instance of the Q31 DCT4 structure.   
- * @param[in]       *pState        points to state buffer.   
+ * @param[in]       *pState        points to the state buffer of length 2*N, or NULL for the scratch pool.
  * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.   
  * @return none.   
  * \par Input an output formats:    
@@ -68,10 +92,25 @@ void riscv_dct4_q31(
   q31_t * pState,
   q31_t * pInlineBuffer)
 {
+  RISCV_PROFILE(riscv_dct4_q31);
+  uint32_t scratchMark = riscv_dsp_scratch_mark(); /* scratch pool depth on entry */
+
+  /* State buffer from the scratch pool when the caller passes none */
+  if(pState == NULL)
+  {
+    pState = (q31_t *) riscv_dsp_scratch_push(2u * (uint32_t) S->N * sizeof(q31_t));
+  }
+
+  if(pState == NULL)
+  {
+    return;
+  }
+
   uint16_t i;                                    /* Loop counter */
   q31_t *weights = S->pTwiddle;                  /* Pointer to the Weights table */
   q31_t *cosFact = S->pCosFactor;                /* Pointer to the cos factors table */
   q31_t *pS1, *pS2, *pbuff;                      /* Temporary pointers for input buffer and pState buffer */
+  q31_t *pW;                                     /* Temporary pointer for the cos factors and the weights */
   q31_t in;                                      /* Temporary variable */
 
 
@@ -95,14 +134,11 @@ void riscv_dct4_q31(
    */
 
         /*-------- Pre-processing ------------*/
-  /* Multiplying input with cos factor i.e. r(n) = 2 * x(n) * cos(pi*(2*n+1)/(4*n)) */
-  riscv_mult_q31(pInlineBuffer, cosFact, pInlineBuffer, S->N);
-  riscv_shift_q31(pInlineBuffer, 1, pInlineBuffer, S->N);
-
   /* ----------------------------------------------------------------    
-   * Step1: Re-ordering of even and odd elements as    
-   *             pState[i] =  pInlineBuffer[2*i] and    
-   *             pState[N-i-1] = pInlineBuffer[2*i+1] where i = 0 to N/2    
+   * Multiplying input with cos factor i.e. r(n) = 2 * x(n) * cos(pi*(2*n+1)/(4*n))    
+   * and Step1, re-ordering of even and odd elements, in one pass:    
+   *             pState[i] =  r(2*i) and    
+   *             pState[N-i-1] = r(2*i+1) where i = 0 to N/2    
    ---------------------------------------------------------------------*/
 
   /* pS1 initialized to pState */
@@ -114,39 +150,26 @@ void riscv_dct4_q31(
   /* pbuff initialized to input buffer */
   pbuff = pInlineBuffer;
 
+  /* pW initialized to the cos factors */
+  pW = cosFact;
 
   /* Initializing the loop counter to N/2 */
   i = S->Nby2;
 
   do
   {
-    /* Re-ordering of even and odd elements */
-    /* pState[i] =  pInlineBuffer[2*i] */
-    *pS1++ = *pbuff++;
-    /* pState[N-i-1] = pInlineBuffer[2*i+1] */
-    *pS2-- = *pbuff++;
+    /* the product saturated and doubled, as riscv_mult_q31 followed by riscv_shift_q31 by 1 */
+    *pS1++ = clip_q63_to_q31((q63_t) clip_q63_to_q31(((q63_t) pbuff[0] * pW[0]) >> 31) << 1);
+    *pS2-- = clip_q63_to_q31((q63_t) clip_q63_to_q31(((q63_t) pbuff[1] * pW[1]) >> 31) << 1);
+    pbuff += 2;
+    pW += 2;
 
     /* Decrement the loop counter */
     i--;
   } while(i > 0u);
 
-  /* pbuff initialized to input buffer */
-  pbuff = pInlineBuffer;
-
-  /* pS1 initialized to pState */
-  pS1 = pState;
-
-  /* Initializing the loop counter */
-  i = S->N;
-
-  do
-  {
-    /* Writing the re-ordered output back to inplace input buffer */
-    *pbuff++ = *pS1++;
-
-    /* Decrement the loop counter */
-    i--;
-  } while(i > 0u);
+  /* Writing the re-ordered output back to inplace input buffer */
+  riscv_copy_q31(pState, pInlineBuffer, S->N);
 
 
   /* ---------------------------------------------------------    
@@ -155,20 +178,20 @@ void riscv_dct4_q31(
   /* pInlineBuffer is real input of length N , pState is the complex output of length 2N */
   riscv_rfft_q31(S->pRfft, pInlineBuffer, pState);
 
-  /*----------------------------------------------------------------------    
-   *  Step3: Multiply the FFT output with the weights.    
-   *----------------------------------------------------------------------*/
-  riscv_cmplx_mult_cmplx_q31(pState, weights, pState, S->N);
-
-  /* The output of complex multiplication is in 3.29 format.    
-   * Hence changing the format of N (i.e. 2*N elements) complex numbers to 1.31 format by shifting left by 2 bits. */
-  riscv_shift_q31(pState, 2, pState, S->N * 2);
+ /*----------------------------------------------------------------------    
+  *  Step3, post-processing and normalization in one pass: the real part of
+  *  the product of the FFT output and the weights is Y2(k), converted to
+  *  DCT-IV by the equation    
+  *       Y4(k) = Y2(k) - Y4(k-1) and Y4(-1) = Y4(0)    
+  *       Hence, Y4(0) = Y2(0)/2    
+  *  and multiplied with the normalizing factor sqrt(2/N).  The imaginary
+  *  parts of the product are never used, so they are not computed.  The
+  *  32-bit lanes leave nothing to pack, the pass saves the loads and stores
+  *  of the separate multiply, shift, extraction and normalizing passes.    
+  *----------------------------------------------------------------------*/
 
-  /* ----------- Post-processing ---------- */
-  /* DCT-IV can be obtained from DCT-II by the equation,    
-   *       Y4(k) = Y2(k) - Y4(k-1) and Y4(-1) = Y4(0)    
-   *       Hence, Y4(0) = Y2(0)/2  */
-  /* Getting only real part from the output and Converting to DCT-IV */
+  /* Initializing the loop counter */
+  i = (S->N - 1u);
 
   /* pbuff initialized to input buffer. */
   pbuff = pInlineBuffer;
@@ -176,48 +199,33 @@ void riscv_dct4_q31(
   /* pS1 initialized to pState */
   pS1 = pState;
 
+  /* pW initialized to the weights */
+  pW = weights;
+
   /* Calculating Y4(0) from Y2(0) using Y4(0) = Y2(0)/2 */
-  in = *pS1++ >> 1u;
+  in = riscv_dct4_y2_q31(pS1, pW) >> 1u;
   /* input buffer acts as inplace, so output values are stored in the input itself. */
-  *pbuff++ = in;
+  *pbuff++ = ((q31_t) (((q63_t) in * S->normalize) >> 31));
 
-  /* pState pointer is incremented twice as the real values are located alternatively in the array */
-  pS1++;
-
-  /* Initializing the loop counter */
-  i = (S->N - 1u);
+  /* the real values are located alternatively in the array */
+  pS1 += 2;
+  pW += 2;
 
   while(i > 0u)
   {
     /* Calculating Y4(1) to Y4(N-1) from Y2 using equation Y4(k) = Y2(k) - Y4(k-1) */
-    /* pState pointer (pS1) is incremented twice as the real values are located alternatively in the array */
-    in = *pS1++ - in;
-    *pbuff++ = in;
+    in = riscv_dct4_y2_q31(pS1, pW) - in;
+    *pbuff++ = ((q31_t) (((q63_t) in * S->normalize) >> 31));
+
     /* points to the next real value */
-    pS1++;
+    pS1 += 2;
+    pW += 2;
 
     /* Decrement the loop counter */
     i--;
   }
 
-
-        /*------------ Normalizing the output by multiplying with the normalizing factor ----------*/
-
-  /* Initializing the loop counter */
-  i = S->N;
-
-  /* pbuff initialized to the pInlineBuffer(now contains the output values) */
-  pbuff = pInlineBuffer;
-
-  do
-  {
-    /* Multiplying pInlineBuffer with the normalizing factor sqrt(2/N) */
-    in = *pbuff;
-    *pbuff++ = ((q31_t) (((q63_t) in * S->normalize) >> 31));
-
-    /* Decrement the loop counter */
-    i--;
-  } while(i > 0u);
+  riscv_dsp_scratch_pop(scratchMark);
 }
 
 /**    
@@ -0,0 +1,210 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dwt_f32.c
+*
+* Description:  Floating-point multi-level discrete wavelet transform by lifting.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup DWT Discrete Wavelet Transform
+ *
+ * \par
+ * The discrete wavelet transform splits a block into approximation coefficients s and detail
+ * coefficients d, one of each per pair of samples, and repeats on the approximation for further
+ * levels.  The functions factor the Haar and Daubechies-4 filter banks into lifting steps, which
+ * work on the samples in place and need about half the multiplications of the two decimating FIR
+ * filters, and no state or scratch buffer.  The block is extended periodically at its ends.
+ * \par
+ * With the pairs (e, o) of even and odd samples of a level, the Haar wavelet computes
+ * <pre>
+ *    d = o/2 - e/2
+ *    s = e + d
+ * </pre>
+ * and the Daubechies-4 wavelet
+ * <pre>
+ *    s1[i] = e[i] + sqrt(3) * o[i]
+ *    d1[i] = o[i] - sqrt(3)/4 * s1[i] - (sqrt(3)-2)/4 * s1[i-1]
+ *    s[i]  = (sqrt(3)-1)/2 * (s1[i] - d1[i+1])
+ *    d[i]  = (sqrt(3)+1)/2 * d1[i]
+ * </pre>
+ * Both are the orthonormal transforms scaled by 1/sqrt(2) per level, so that the approximation is
+ * the local mean of the samples at every level and the coefficients of a full-scale input stay in
+ * range in the fixed-point formats.  The inverse transform undoes the scaling.  The Daubechies-4
+ * lifting runs in one pass per level, the intermediate values stay in registers.
+ * \par Coefficient layout
+ * The coefficients stay where the lifting steps write them.  After level l the detail coefficient i
+ * of that level is at <code>i*2^l + 2^(l-1)</code>, and after the last level L the approximation
+ * coefficient i is at <code>i*2^L</code>.  The inverse transform takes the same layout, after
+ * thresholding or quantizing the detail coefficients in place.
+ * \par
+ * <code>blockSize</code> must be a multiple of <code>2^numLevels</code>.
+ */
+
+/**
+ * @addtogroup DWT
+ * @{
+ */
+
+#define RISCV_DWT_SQRT3_F32  1.7320508075688772f
+
+/* Haar lifting of the pairs p[2*i*st], p[(2*i+1)*st] */
+static void riscv_dwt_haar_f32(
+  float32_t * p,
+  uint32_t numPairs,
+  uint32_t st,
+  uint8_t inverseFlag)
+{
+  float32_t *pe = p;                             /* Even sample or approximation */
+  float32_t *po = p + st;                        /* Odd sample or detail */
+  float32_t e, o, d;
+  uint32_t i;
+
+  for (i = 0u; i < numPairs; i++)
+  {
+    if(inverseFlag == 0u)
+    {
+      e = *pe;
+      d = 0.5f * (*po - e);
+      *pe = e + d;
+      *po = d;
+    }
+    else
+    {
+      d = *po;
+      e = *pe - d;
+      o = e + (2.0f * d);
+      *pe = e;
+      *po = o;
+    }
+
+    pe += 2u * st;
+    po += 2u * st;
+  }
+}
+
+/* Daubechies-4 lifting of the pairs p[2*i*st], p[(2*i+1)*st] */
+static void riscv_dwt_db4_f32(
+  float32_t * p,
+  uint32_t numPairs,
+  uint32_t st,
+  uint8_t inverseFlag)
+{
+  const float32_t c1 = 0.25f * RISCV_DWT_SQRT3_F32;          /* sqrt(3)/4 */
+  const float32_t c2 = 0.25f * (RISCV_DWT_SQRT3_F32 - 2.0f); /* (sqrt(3)-2)/4 */
+  const float32_t cs = 0.5f * (RISCV_DWT_SQRT3_F32 - 1.0f);  /* (sqrt(3)-1)/2 */
+  const float32_t cd = 0.5f * (RISCV_DWT_SQRT3_F32 + 1.0f);  /* (sqrt(3)+1)/2 */
+  uint32_t last = 2u * (numPairs - 1u) * st;     /* Offset of the last pair */
+  float32_t s0, d0, sCur, dCur, sNext, dNext, sPrev, o;
+  uint32_t i;
+
+  if(inverseFlag == 0u)
+  {
+    /* s1 and d1 of pair 0, with s1[-1] = s1[numPairs-1], are needed again by the last pair */
+    sPrev = p[last] + (RISCV_DWT_SQRT3_F32 * p[last + st]);
+    s0 = p[0] + (RISCV_DWT_SQRT3_F32 * p[st]);
+    d0 = p[st] - (c1 * s0) - (c2 * sPrev);
+    sCur = s0;
+    dCur = d0;
+
+    /* Pair i is written once pair i+1 is read */
+    for (i = 0u; i < numPairs; i++)
+    {
+      if((i + 1u) < numPairs)
+      {
+        sNext = p[2u * (i + 1u) * st] + (RISCV_DWT_SQRT3_F32 * p[((2u * (i + 1u)) + 1u) * st]);
+        dNext = p[((2u * (i + 1u)) + 1u) * st] - (c1 * sNext) - (c2 * sCur);
+      }
+      else
+      {
+        sNext = s0;
+        dNext = d0;
+      }
+
+      p[2u * i * st] = cs * (sCur - dNext);
+      p[((2u * i) + 1u) * st] = cd * dCur;
+
+      sCur = sNext;
+      dCur = dNext;
+    }
+  }
+  else
+  {
+    /* d1[0] and s1[-1] = s1[numPairs-1] before pair 0 is overwritten */
+    d0 = (RISCV_DWT_SQRT3_F32 - 1.0f) * p[st];
+    sPrev = ((RISCV_DWT_SQRT3_F32 + 1.0f) * p[last]) + d0;
+    dCur = d0;
+
+    for (i = 0u; i < numPairs; i++)
+    {
+      dNext = ((i + 1u) < numPairs) ? ((RISCV_DWT_SQRT3_F32 - 1.0f) * p[((2u * (i + 1u)) + 1u) * st]) : d0;
+      sCur = ((RISCV_DWT_SQRT3_F32 + 1.0f) * p[2u * i * st]) + dNext;
+
+      /* o = d1[i] + sqrt(3)/4 * s1[i] + (sqrt(3)-2)/4 * s1[i-1], e = s1[i] - sqrt(3) * o */
+      o = dCur + (c1 * sCur) + (c2 * sPrev);
+      p[2u * i * st] = sCur - (RISCV_DWT_SQRT3_F32 * o);
+      p[((2u * i) + 1u) * st] = o;
+
+      sPrev = sCur;
+      dCur = dNext;
+    }
+  }
+}
+
+/**
+ * @brief Floating-point multi-level discrete wavelet transform.
+ * @param[in,out] *pSrcDst     points to the block of samples, transformed in place.
+ * @param[in]     blockSize    number of samples, a multiple of <code>2^numLevels</code>.
+ * @param[in]     numLevels    number of levels, 1 or more.
+ * @param[in]     wavelet      RISCV_DWT_HAAR or RISCV_DWT_DB4.
+ * @param[in]     inverseFlag  0 for the forward transform, 1 for the inverse transform.
+ * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the block cannot be split numLevels times.
+ *
+ * \par
+ * The forward transform runs the levels from 1 to numLevels on the approximation coefficients, the
+ * inverse transform from numLevels back to 1.
+ */
+
+riscv_status riscv_dwt_f32(
+  float32_t * pSrcDst,
+  uint32_t blockSize,
+  uint8_t numLevels,
+  riscv_dwt_wavelet wavelet,
+  uint8_t inverseFlag)
+{
+  RISCV_PROFILE(riscv_dwt_f32);
+  uint32_t level, st;
+
+  if((numLevels == 0u) || (numLevels > 31u) || ((blockSize & ((1u << numLevels) - 1u)) != 0u) || (blockSize == 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (level = 0u; level < numLevels; level++)
+  {
+    /* Distance of the samples of the level, 1 at level 1 */
+    st = (inverseFlag == 0u) ? (1u << level) : (1u << (numLevels - 1u - level));
+
+    if(wavelet == RISCV_DWT_HAAR)
+    {
+      riscv_dwt_haar_f32(pSrcDst, blockSize / (2u * st), st, inverseFlag);
+    }
+    else
+    {
+      riscv_dwt_db4_f32(pSrcDst, blockSize / (2u * st), st, inverseFlag);
+    }
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of DWT group
+ */
@@ -0,0 +1,232 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dwt_q15.c
+*
+* Description:  Q15 multi-level discrete wavelet transform by lifting.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup DWT
+ * @{
+ */
+
+/* Lifting constants of the Daubechies-4 wavelet */
+#define RISCV_DWT_SQRT3_Q14    28378             /* sqrt(3) in 2.14 */
+#define RISCV_DWT_C1_Q15       14189             /* sqrt(3)/4 in 1.15 */
+#define RISCV_DWT_C2_Q15       (-2195)           /* (sqrt(3)-2)/4 in 1.15 */
+#define RISCV_DWT_CS_Q15       11994             /* (sqrt(3)-1)/2 in 1.15 */
+#define RISCV_DWT_CD_Q14       22381             /* (sqrt(3)+1)/2 in 2.14 */
+#define RISCV_DWT_ICS_Q13      22381             /* sqrt(3)+1 in 3.13 */
+#define RISCV_DWT_ICD_Q15      23988             /* sqrt(3)-1 in 1.15 */
+
+/* a * b >> shift with a rounded 32-bit product */
+#define RISCV_DWT_MUL(a, b, shift)  ((((a) * (b)) + (1 << ((shift) - 1))) >> (shift))
+
+/* Haar lifting of the pairs p[2*i*st], p[(2*i+1)*st] */
+static void riscv_dwt_haar_q15(
+  q15_t * p,
+  uint32_t numPairs,
+  uint32_t st,
+  uint8_t inverseFlag)
+{
+  q15_t *pe = p;                                 /* Even sample or approximation */
+  q15_t *po = p + st;                            /* Odd sample or detail */
+  q31_t e, d;
+  uint32_t blkCnt = numPairs;                    /* Loop counter */
+#if defined (USE_DSP_RISCV)
+  shortV even = { 0, 2 };                        /* First and second halves of two pairs */
+  shortV odd = { 1, 3 };
+  shortV one = { 1, 1 };
+  shortV w0, w1, eV, oV, dV;
+
+  /* Two adjacent pairs per iteration on the first level */
+  if(st == 1u)
+  {
+    blkCnt = numPairs >> 1u;
+
+    while(blkCnt > 0u)
+    {
+      w0 = *(shortV *) pe;
+      w1 = *(shortV *) (pe + 2);
+      eV = shufflev4(w0, w1, even);
+      dV = shufflev4(w0, w1, odd);
+
+      if(inverseFlag == 0u)
+      {
+        /* d = o/2 - e/2, s = e + d */
+        dV = sub2(sra2(dV, one), sra2(eV, one));
+        eV = add2v(eV, dV);
+      }
+      else
+      {
+        /* e = s - d, o = 2 * (d + e/2) */
+        eV = sub2(eV, dV);
+        oV = sll2(add2v(dV, sra2(eV, one)), one);
+        dV = oV;
+      }
+
+      *(shortV *) pe = shufflev4(eV, dV, even);
+      *(shortV *) (pe + 2) = shufflev4(eV, dV, odd);
+      pe += 4;
+      blkCnt--;
+    }
+
+    po = pe + 1;
+    blkCnt = numPairs & 0x1u;
+  }
+#endif
+
+  while(blkCnt > 0u)
+  {
+    if(inverseFlag == 0u)
+    {
+      e = *pe;
+      d = ((q31_t) *po >> 1) - (e >> 1);
+      *pe = (q15_t) (e + d);
+      *po = (q15_t) d;
+    }
+    else
+    {
+      d = *po;
+      e = *pe - d;
+      *pe = (q15_t) e;
+      *po = (q15_t) ((d + (e >> 1)) << 1);
+    }
+
+    pe += 2u * st;
+    po += 2u * st;
+    blkCnt--;
+  }
+}
+
+/* Daubechies-4 lifting of the pairs p[2*i*st], p[(2*i+1)*st], 32-bit intermediates */
+static void riscv_dwt_db4_q15(
+  q15_t * p,
+  uint32_t numPairs,
+  uint32_t st,
+  uint8_t inverseFlag)
+{
+  uint32_t last = 2u * (numPairs - 1u) * st;     /* Offset of the last pair */
+  q31_t s0, d0, sCur, dCur, sNext, dNext, sPrev, o;
+  uint32_t i;
+
+  if(inverseFlag == 0u)
+  {
+    /* s1 and d1 of pair 0, with s1[-1] = s1[numPairs-1], are needed again by the last pair */
+    sPrev = p[last] + RISCV_DWT_MUL(RISCV_DWT_SQRT3_Q14, p[last + st], 14);
+    s0 = p[0] + RISCV_DWT_MUL(RISCV_DWT_SQRT3_Q14, p[st], 14);
+    d0 = p[st] - RISCV_DWT_MUL(RISCV_DWT_C1_Q15, s0, 15) - RISCV_DWT_MUL(RISCV_DWT_C2_Q15, sPrev, 15);
+    sCur = s0;
+    dCur = d0;
+
+    /* Pair i is written once pair i+1 is read */
+    for (i = 0u; i < numPairs; i++)
+    {
+      if((i + 1u) < numPairs)
+      {
+        o = p[((2u * (i + 1u)) + 1u) * st];
+        sNext = p[2u * (i + 1u) * st] + RISCV_DWT_MUL(RISCV_DWT_SQRT3_Q14, o, 14);
+        dNext = o - RISCV_DWT_MUL(RISCV_DWT_C1_Q15, sNext, 15) - RISCV_DWT_MUL(RISCV_DWT_C2_Q15, sCur, 15);
+      }
+      else
+      {
+        sNext = s0;
+        dNext = d0;
+      }
+
+      p[2u * i * st] = (q15_t) __SSAT(RISCV_DWT_MUL(RISCV_DWT_CS_Q15, sCur - dNext, 15), 16);
+      p[((2u * i) + 1u) * st] = (q15_t) __SSAT(RISCV_DWT_MUL(RISCV_DWT_CD_Q14, dCur, 14), 16);
+
+      sCur = sNext;
+      dCur = dNext;
+    }
+  }
+  else
+  {
+    /* d1[0] and s1[-1] = s1[numPairs-1] before pair 0 is overwritten */
+    d0 = RISCV_DWT_MUL(RISCV_DWT_ICD_Q15, p[st], 15);
+    sPrev = RISCV_DWT_MUL(RISCV_DWT_ICS_Q13, p[last], 13) + d0;
+    dCur = d0;
+
+    for (i = 0u; i < numPairs; i++)
+    {
+      dNext = ((i + 1u) < numPairs) ? RISCV_DWT_MUL(RISCV_DWT_ICD_Q15, p[((2u * (i + 1u)) + 1u) * st], 15) : d0;
+      sCur = RISCV_DWT_MUL(RISCV_DWT_ICS_Q13, p[2u * i * st], 13) + dNext;
+
+      /* o = d1[i] + sqrt(3)/4 * s1[i] + (sqrt(3)-2)/4 * s1[i-1], e = s1[i] - sqrt(3) * o */
+      o = dCur + RISCV_DWT_MUL(RISCV_DWT_C1_Q15, sCur, 15) + RISCV_DWT_MUL(RISCV_DWT_C2_Q15, sPrev, 15);
+      p[2u * i * st] = (q15_t) __SSAT(sCur - RISCV_DWT_MUL(RISCV_DWT_SQRT3_Q14, o, 14), 16);
+      p[((2u * i) + 1u) * st] = (q15_t) __SSAT(o, 16);
+
+      sPrev = sCur;
+      dCur = dNext;
+    }
+  }
+}
+
+/**
+ * @brief Q15 multi-level discrete wavelet transform.
+ * @param[in,out] *pSrcDst     points to the block of samples, transformed in place, 4-byte aligned.
+ * @param[in]     blockSize    number of samples, a multiple of <code>2^numLevels</code>.
+ * @param[in]     numLevels    number of levels, 1 or more.
+ * @param[in]     wavelet      RISCV_DWT_HAAR or RISCV_DWT_DB4.
+ * @param[in]     inverseFlag  0 for the forward transform, 1 for the inverse transform.
+ * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the block cannot be split numLevels times.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The Haar lifting halves the samples before taking their difference, so neither coefficient can
+ * overflow; the inverse restores the odd samples without their least significant bit, an error of at
+ * most 1 LSB per level.  With <code>USE_DSP_RISCV</code> the first level runs on two pairs at a time
+ * with the packed shift, add and subtract instructions; the inverse does not saturate, which holds
+ * for coefficients of the forward transform and for detail coefficients shrunk towards zero.
+ * \par
+ * The Daubechies-4 lifting keeps its intermediate values in 32 bits, rounds the products with the
+ * constants in 1.15 and 2.14 format and saturates the coefficients to 1.15 format.  The round trip is exact to a few LSB
+ * per level.
+ */
+
+riscv_status riscv_dwt_q15(
+  q15_t * pSrcDst,
+  uint32_t blockSize,
+  uint8_t numLevels,
+  riscv_dwt_wavelet wavelet,
+  uint8_t inverseFlag)
+{
+  RISCV_PROFILE(riscv_dwt_q15);
+  uint32_t level, st;
+
+  if((numLevels == 0u) || (numLevels > 31u) || ((blockSize & ((1u << numLevels) - 1u)) != 0u) || (blockSize == 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (level = 0u; level < numLevels; level++)
+  {
+    /* Distance of the samples of the level, 1 at level 1 */
+    st = (inverseFlag == 0u) ? (1u << level) : (1u << (numLevels - 1u - level));
+
+    if(wavelet == RISCV_DWT_HAAR)
+    {
+      riscv_dwt_haar_q15(pSrcDst, blockSize / (2u * st), st, inverseFlag);
+    }
+    else
+    {
+      riscv_dwt_db4_q15(pSrcDst, blockSize / (2u * st), st, inverseFlag);
+    }
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of DWT group
+ */
@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_dwt_q31.c
+*
+* Description:  Q31 multi-level discrete wavelet transform by lifting.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup DWT
+ * @{
+ */
+
+/* Lifting constants of the Daubechies-4 wavelet */
+#define RISCV_DWT_SQRT3_Q30    1859775393        /* sqrt(3) in 2.30 */
+#define RISCV_DWT_C1_Q30       464943848         /* sqrt(3)/4 in 2.30 */
+#define RISCV_DWT_C2_Q30       (-71927064)       /* (sqrt(3)-2)/4 in 2.30 */
+#define RISCV_DWT_CS_Q30       393016785         /* (sqrt(3)-1)/2 in 2.30 */
+#define RISCV_DWT_CD_Q30       1466758609        /* (sqrt(3)+1)/2 in 2.30 */
+#define RISCV_DWT_ICS_Q29      1466758609        /* sqrt(3)+1 in 3.29 */
+#define RISCV_DWT_ICD_Q31      1572067139        /* sqrt(3)-1 in 1.31 */
+
+/* Headroom of the Daubechies-4 intermediates */
+#define RISCV_DWT_GUARD        3
+
+/* a * b >> shift with a rounded 64-bit product */
+#define RISCV_DWT_MUL(a, b, shift)  ((q31_t) ((((q63_t) (a) * (b)) + (1LL << ((shift) - 1))) >> (shift)))
+
+/* Haar lifting of the pairs p[2*i*st], p[(2*i+1)*st] */
+static void riscv_dwt_haar_q31(
+  q31_t * p,
+  uint32_t numPairs,
+  uint32_t st,
+  uint8_t inverseFlag)
+{
+  q31_t *pe = p;                                 /* Even sample or approximation */
+  q31_t *po = p + st;                            /* Odd sample or detail */
+  q31_t e, d;
+  uint32_t blkCnt = numPairs;                    /* Loop counter */
+
+  while(blkCnt > 0u)
+  {
+    if(inverseFlag == 0u)
+    {
+      e = *pe;
+      d = (*po >> 1) - (e >> 1);
+      *pe = e + d;
+      *po = d;
+    }
+    else
+    {
+      d = *po;
+      e = *pe - d;
+      *pe = e;
+      *po = (d + (e >> 1)) << 1;
+    }
+
+    pe += 2u * st;
+    po += 2u * st;
+    blkCnt--;
+  }
+}
+
+/* Daubechies-4 lifting of the pairs p[2*i*st], p[(2*i+1)*st], on the samples shifted right by RISCV_DWT_GUARD */
+static void riscv_dwt_db4_q31(
+  q31_t * p,
+  uint32_t numPairs,
+  uint32_t st,
+  uint8_t inverseFlag)
+{
+  uint32_t last = 2u * (numPairs - 1u) * st;     /* Offset of the last pair */
+  q31_t s0, d0, sCur, dCur, sNext, dNext, sPrev, o;
+  uint32_t i;
+
+  if(inverseFlag == 0u)
+  {
+    /* s1 and d1 of pair 0, with s1[-1] = s1[numPairs-1], are needed again by the last pair */
+    sPrev = (p[last] >> RISCV_DWT_GUARD) + RISCV_DWT_MUL(RISCV_DWT_SQRT3_Q30, p[last + st] >> RISCV_DWT_GUARD, 30);
+    o = p[st] >> RISCV_DWT_GUARD;
+    s0 = (p[0] >> RISCV_DWT_GUARD) + RISCV_DWT_MUL(RISCV_DWT_SQRT3_Q30, o, 30);
+    d0 = o - RISCV_DWT_MUL(RISCV_DWT_C1_Q30, s0, 30) - RISCV_DWT_MUL(RISCV_DWT_C2_Q30, sPrev, 30);
+    sCur = s0;
+    dCur = d0;
+
+    /* Pair i is written once pair i+1 is read */
+    for (i = 0u; i < numPairs; i++)
+    {
+      if((i + 1u) < numPairs)
+      {
+        o = p[((2u * (i + 1u)) + 1u) * st] >> RISCV_DWT_GUARD;
+        sNext = (p[2u * (i + 1u) * st] >> RISCV_DWT_GUARD) + RISCV_DWT_MUL(RISCV_DWT_SQRT3_Q30, o, 30);
+        dNext = o - RISCV_DWT_MUL(RISCV_DWT_C1_Q30, sNext, 30) - RISCV_DWT_MUL(RISCV_DWT_C2_Q30, sCur, 30);
+      }
+      else
+      {
+        sNext = s0;
+        dNext = d0;
+      }
+
+      p[2u * i * st] = clip_q63_to_q31((q63_t) RISCV_DWT_MUL(RISCV_DWT_CS_Q30, sCur - dNext, 30) << RISCV_DWT_GUARD);
+      p[((2u * i) + 1u) * st] = clip_q63_to_q31((q63_t) RISCV_DWT_MUL(RISCV_DWT_CD_Q30, dCur, 30) << RISCV_DWT_GUARD);
+
+      sCur = sNext;
+      dCur = dNext;
+    }
+  }
+  else
+  {
+    /* d1[0] and s1[-1] = s1[numPairs-1] before pair 0 is overwritten */
+    d0 = RISCV_DWT_MUL(RISCV_DWT_ICD_Q31, p[st] >> RISCV_DWT_GUARD, 31);
+    sPrev = RISCV_DWT_MUL(RISCV_DWT_ICS_Q29, p[last] >> RISCV_DWT_GUARD, 29) + d0;
+    dCur = d0;
+
+    for (i = 0u; i < numPairs; i++)
+    {
+      dNext = ((i + 1u) < numPairs) ? RISCV_DWT_MUL(RISCV_DWT_ICD_Q31, p[((2u * (i + 1u)) + 1u) * st] >> RISCV_DWT_GUARD, 31) : d0;
+      sCur = RISCV_DWT_MUL(RISCV_DWT_ICS_Q29, p[2u * i * st] >> RISCV_DWT_GUARD, 29) + dNext;
+
+      /* o = d1[i] + sqrt(3)/4 * s1[i] + (sqrt(3)-2)/4 * s1[i-1], e = s1[i] - sqrt(3) * o */
+      o = dCur + RISCV_DWT_MUL(RISCV_DWT_C1_Q30, sCur, 30) + RISCV_DWT_MUL(RISCV_DWT_C2_Q30, sPrev, 30);
+      p[2u * i * st] = clip_q63_to_q31((q63_t) (sCur - RISCV_DWT_MUL(RISCV_DWT_SQRT3_Q30, o, 30)) << RISCV_DWT_GUARD);
+      p[((2u * i) + 1u) * st] = clip_q63_to_q31((q63_t) o << RISCV_DWT_GUARD);
+
+      sPrev = sCur;
+      dCur = dNext;
+    }
+  }
+}
+
+/**
+ * @brief Q31 multi-level discrete wavelet transform.
+ * @param[in,out] *pSrcDst     points to the block of samples, transformed in place.
+ * @param[in]     blockSize    number of samples, a multiple of <code>2^numLevels</code>.
+ * @param[in]     numLevels    number of levels, 1 or more.
+ * @param[in]     wavelet      RISCV_DWT_HAAR or RISCV_DWT_DB4.
+ * @param[in]     inverseFlag  0 for the forward transform, 1 for the inverse transform.
+ * @return RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if the block cannot be split numLevels times.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The Haar lifting halves the samples before taking their difference, so neither coefficient can
+ * overflow; the inverse restores the odd samples without their least significant bit, an error of at
+ * most 1 LSB per level.
+ * \par
+ * The Daubechies-4 lifting shifts the samples right by 3 bits for the headroom of its intermediate
+ * values, multiplies with the constants in 2.30 format in 64 bits with rounding and saturates the coefficients to
+ * 1.31 format.  The round trip is exact to a few times 2^-28 per level.
+ */
+
+riscv_status riscv_dwt_q31(
+  q31_t * pSrcDst,
+  uint32_t blockSize,
+  uint8_t numLevels,
+  riscv_dwt_wavelet wavelet,
+  uint8_t inverseFlag)
+{
+  RISCV_PROFILE(riscv_dwt_q31);
+  uint32_t level, st;
+
+  if((numLevels == 0u) || (numLevels > 31u) || ((blockSize & ((1u << numLevels) - 1u)) != 0u) || (blockSize == 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (level = 0u; level < numLevels; level++)
+  {
+    /* Distance of the samples of the level, 1 at level 1 */
+    st = (inverseFlag == 0u) ? (1u << level) : (1u << (numLevels - 1u - level));
+
+    if(wavelet == RISCV_DWT_HAAR)
+    {
+      riscv_dwt_haar_q31(pSrcDst, blockSize / (2u * st), st, inverseFlag);
+    }
+    else
+    {
+      riscv_dwt_db4_q31(pSrcDst, blockSize / (2u * st), st, inverseFlag);
+    }
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+ * @} end of DWT group
+ */
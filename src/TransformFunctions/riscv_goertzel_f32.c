@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_goertzel_f32.c
+*
+* Description:  Floating-point Goertzel single-bin detector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Tone Detection
+ *
+ * \par
+ * The Goertzel algorithm computes a few bins of the spectrum of a block of samples without a full FFT,
+ * as needed for DTMF decoding or pilot tone detection.  Every bin is a second order resonator
+ * <pre>
+ *    s[n] = x[n] + 2*cos(2*pi*f) * s[n-1] - s[n-2]
+ * </pre>
+ * where <code>f</code> is the normalized frequency of the bin, not restricted to multiples of 1/blockSize.
+ * At the end of the block the power of the bin is
+ * <pre>
+ *    |X|^2 = s[n-1]^2 + s[n-2]^2 - 2*cos(2*pi*f) * s[n-1] * s[n-2]
+ * </pre>
+ * which equals the squared magnitude of the DFT of the block at frequency <code>f</code>.
+ * \par
+ * A bin costs one multiplication per sample, so 4 to 16 bins need fewer cycles than an FFT of the block.
+ * The processing function can be called several times per block, the power function ends the block
+ * and clears the states for the next one.  Two bins are updated per pass over the input.
+ * \par Fixed-point behavior
+ * The Q31 and Q15 functions keep the states in Q31.  The input is scaled by <code>2^-scaleShift</code>,
+ * and the states of a bin at frequency <code>f</code> are bounded by <code>blockSize * max|x| / sin(2*pi*f)</code>,
+ * or <code>blockSize * (blockSize + 1) / 2 * max|x|</code> at f = 0 and f = 0.5.  scaleShift must keep
+ * that bound below 1.0 for the bins and block length in use.  The power is returned in Q31 as
+ * <code>|X * 2^-scaleShift|^2</code>.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+* @brief  Processing function for the floating-point Goertzel detector.
+* @param[in]  *S         points to an instance of the floating-point Goertzel structure.
+* @param[in]  *pSrc      points to the block of input samples.
+* @param[in]  blockSize  number of samples to process.
+* @return none.
+*/
+
+void riscv_goertzel_f32(
+  const riscv_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_goertzel_f32);
+  const float32_t *pCoef = S->pCoefs;            /* Coefficient pointer */
+  float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pIn;                          /* Input pointer */
+  float32_t c0, c1, a1, a2, b1, b2, x, s;        /* Coefficients and states of two bins */
+  uint32_t bin, blkCnt;                          /* Loop counters */
+
+  /*  Two bins per pass share every input load */
+  for (bin = (uint32_t) S->numBins >> 1u; bin > 0u; bin--)
+  {
+    c0 = pCoef[0];
+    c1 = pCoef[1];
+    a1 = pState[0];
+    a2 = pState[1];
+    b1 = pState[2];
+    b2 = pState[3];
+
+    pIn = pSrc;
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      x = *pIn++;
+
+      /*  s[n] = x[n] + c * s[n-1] - s[n-2] */
+      s = x + (c0 * a1) - a2;
+      a2 = a1;
+      a1 = s;
+
+      s = x + (c1 * b1) - b2;
+      b2 = b1;
+      b1 = s;
+
+      blkCnt--;
+    }
+
+    pState[0] = a1;
+    pState[1] = a2;
+    pState[2] = b1;
+    pState[3] = b2;
+
+    pCoef += 2u;
+    pState += 4u;
+  }
+
+  /*  Last bin of an odd number of bins */
+  if((S->numBins & 1u) != 0u)
+  {
+    c0 = pCoef[0];
+    a1 = pState[0];
+    a2 = pState[1];
+
+    pIn = pSrc;
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      s = *pIn++ + (c0 * a1) - a2;
+      a2 = a1;
+      a1 = s;
+
+      blkCnt--;
+    }
+
+    pState[0] = a1;
+    pState[1] = a2;
+  }
+}
+
+/**
+* @brief  Power of the bins of the floating-point Goertzel detector.
+* @param[in]  *S    points to an instance of the floating-point Goertzel structure.
+* @param[out] *pDst points to the <code>numBins</code> output powers |X|^2.
+* @return none.
+*
+* The states are cleared, the next call of riscv_goertzel_f32() starts a new block.
+*/
+
+void riscv_goertzel_power_f32(
+  const riscv_goertzel_instance_f32 * S,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_goertzel_power_f32);
+  const float32_t *pCoef = S->pCoefs;            /* Coefficient pointer */
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t s1, s2, h, re;                       /* States of the bin, c/2 and real part */
+  uint32_t bin;                                  /* Loop counter */
+
+  for (bin = S->numBins; bin > 0u; bin--)
+  {
+    s1 = pState[0];
+    s2 = pState[1];
+    h = 0.5f * *pCoef++;
+
+    /*  |X|^2 = s1^2 + s2^2 - c * s1 * s2, written as |s1 - exp(-j*2*pi*f) * s2|^2
+     *  to avoid the cancellation of the large states near f = 0 and f = 0.5 */
+    re = s1 - (h * s2);
+    *pDst++ = (re * re) + ((s2 * s2) * (1.0f - (h * h)));
+
+    *pState++ = 0.0f;
+    *pState++ = 0.0f;
+  }
+}
+
+/**
+* @} end of Goertzel group
+*/
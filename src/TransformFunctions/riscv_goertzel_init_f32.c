@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_goertzel_init_f32.c
+*
+* Description:  Initialization function for the floating-point Goertzel
+*               detector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point Goertzel detector.
+* @param[out]    *S         points to an instance of the floating-point Goertzel structure.
+* @param[in]     numBins    number of bins.
+* @param[in]     *pFreqs    points to the <code>numBins</code> normalized frequencies f/fs of the bins, from 0 to 0.5.
+* @param[out]    *pCoefs    points to a buffer of <code>numBins</code> words that receives the coefficients 2*cos(2*pi*f).
+* @param[out]    *pState    points to a buffer of <code>2*numBins</code> words for the states.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>numBins</code> is 0 or a frequency is outside of [0, 0.5].
+*
+* \par Description:
+* The states are cleared.  The coefficient and state buffers must stay valid as long as the instance is used.
+* For a bin k of an N point DFT the frequency is k/N.
+*/
+
+riscv_status riscv_goertzel_init_f32(
+  riscv_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  const float32_t * pFreqs,
+  float32_t * pCoefs,
+  float32_t * pState)
+{
+  RISCV_PROFILE(riscv_goertzel_init_f32);
+  uint32_t k;
+
+  if(numBins == 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0u; k < numBins; k++)
+  {
+    if((pFreqs[k] < 0.0f) || (pFreqs[k] > 0.5f))
+    {
+      return (RISCV_MATH_ARGUMENT_ERROR);
+    }
+
+    pCoefs[k] = (float32_t) (2.0 * cos(6.283185307179586 * (float64_t) pFreqs[k]));
+  }
+
+  S->numBins = numBins;
+  S->pCoefs = pCoefs;
+  S->pState = pState;
+
+  /*  Clear the states */
+  riscv_fill_f32(0.0f, pState, 2u * (uint32_t) numBins);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of Goertzel group
+*/
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_goertzel_init_q15.c
+*
+* Description:  Initialization function for the Q15 Goertzel detector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q15 Goertzel detector.
+* @param[out]    *S          points to an instance of the Q15 Goertzel structure.
+* @param[in]     numBins     number of bins.
+* @param[in]     *pFreqs     points to the <code>numBins</code> normalized frequencies f/fs of the bins, from 0 to 0.5.
+* @param[in]     scaleShift  right shift applied to the input after its conversion to Q31, from 0 to 31.
+* @param[out]    *pCoefs     points to a buffer of <code>numBins</code> words that receives the coefficients 2*cos(2*pi*f) in Q30.
+* @param[out]    *pState     points to a buffer of <code>2*numBins</code> words for the states.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>numBins</code> is 0, <code>scaleShift</code> is larger than 31 or a frequency is outside of [0, 0.5].
+*
+* \par Description:
+* The states are cleared.  The coefficient and state buffers must stay valid as long as the instance is used.
+* The coefficient of f = 0 saturates to 0x7FFFFFFF.  See the \ref Goertzel group for the choice of <code>scaleShift</code>.
+*/
+
+riscv_status riscv_goertzel_init_q15(
+  riscv_goertzel_instance_q15 * S,
+  uint16_t numBins,
+  const float32_t * pFreqs,
+  uint8_t scaleShift,
+  q31_t * pCoefs,
+  q31_t * pState)
+{
+  RISCV_PROFILE(riscv_goertzel_init_q15);
+  uint32_t k;
+  float64_t val;
+
+  if((numBins == 0u) || (scaleShift > 31u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0u; k < numBins; k++)
+  {
+    if((pFreqs[k] < 0.0f) || (pFreqs[k] > 0.5f))
+    {
+      return (RISCV_MATH_ARGUMENT_ERROR);
+    }
+
+    /*  2*cos(2*pi*f) in Q30, rounded */
+    val = floor((2.0 * cos(6.283185307179586 * (float64_t) pFreqs[k]) * 1073741824.0) + 0.5);
+    pCoefs[k] = (val > 2147483647.0) ? 0x7FFFFFFF : (q31_t) val;
+  }
+
+  S->numBins = numBins;
+  S->scaleShift = scaleShift;
+  S->pCoefs = pCoefs;
+  S->pState = pState;
+
+  /*  Clear the states */
+  riscv_fill_q31(0, pState, 2u * (uint32_t) numBins);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of Goertzel group
+*/
@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_goertzel_q15.c
+*
+* Description:  Q15 Goertzel single-bin detector.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+* @brief  Processing function for the Q15 Goertzel detector.
+* @param[in]  *S         points to an instance of the Q15 Goertzel structure.
+* @param[in]  *pSrc      points to the block of input samples.
+* @param[in]  blockSize  number of samples to process.
+* @return none.
+*
+* <b>Scaling and Overflow Behavior:</b>
+* \par
+* The input is converted to Q31 and shifted right by <code>scaleShift</code>, the coefficients are in Q30 and the
+* products are computed in 64 bits.  The states wrap around if they exceed the bound given in
+* the description of the \ref Goertzel group.
+*/
+
+void riscv_goertzel_q15(
+  const riscv_goertzel_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_goertzel_q15);
+  const q31_t *pCoef = S->pCoefs;                /* Coefficient pointer */
+  q31_t *pState = S->pState;                     /* State pointer */
+  const q15_t *pIn;                              /* Input pointer */
+  q31_t c0, c1, a1, a2, b1, b2, x, s;            /* Coefficients and states of two bins */
+  uint32_t bin, blkCnt;                          /* Loop counters */
+  uint8_t shift = S->scaleShift;                 /* Input scaling */
+
+  /*  Two bins per pass share every input load */
+  for (bin = (uint32_t) S->numBins >> 1u; bin > 0u; bin--)
+  {
+    c0 = pCoef[0];
+    c1 = pCoef[1];
+    a1 = pState[0];
+    a2 = pState[1];
+    b1 = pState[2];
+    b2 = pState[3];
+
+    pIn = pSrc;
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      x = ((q31_t) *pIn++ << 16) >> shift;
+
+      /*  s[n] = x[n] + c * s[n-1] - s[n-2] */
+      s = x + (q31_t) (((q63_t) c0 * a1) >> 30) - a2;
+      a2 = a1;
+      a1 = s;
+
+      s = x + (q31_t) (((q63_t) c1 * b1) >> 30) - b2;
+      b2 = b1;
+      b1 = s;
+
+      blkCnt--;
+    }
+
+    pState[0] = a1;
+    pState[1] = a2;
+    pState[2] = b1;
+    pState[3] = b2;
+
+    pCoef += 2u;
+    pState += 4u;
+  }
+
+  /*  Last bin of an odd number of bins */
+  if((S->numBins & 1u) != 0u)
+  {
+    c0 = pCoef[0];
+    a1 = pState[0];
+    a2 = pState[1];
+
+    pIn = pSrc;
+    blkCnt = blockSize;
+
+    while(blkCnt > 0u)
+    {
+      s = (((q31_t) *pIn++ << 16) >> shift) + (q31_t) (((q63_t) c0 * a1) >> 30) - a2;
+      a2 = a1;
+      a1 = s;
+
+      blkCnt--;
+    }
+
+    pState[0] = a1;
+    pState[1] = a2;
+  }
+}
+
+/**
+* @brief  Power of the bins of the Q15 Goertzel detector.
+* @param[in]  *S    points to an instance of the Q15 Goertzel structure.
+* @param[out] *pDst points to the <code>numBins</code> output powers in Q31.
+* @return none.
+*
+* The power |X * 2^-scaleShift|^2 is computed in 64 bits and saturated to Q31.
+* The states are cleared, the next call of riscv_goertzel_q15() starts a new block.
+*/
+
+void riscv_goertzel_power_q15(
+  const riscv_goertzel_instance_q15 * S,
+  q31_t * pDst)
+{
+  RISCV_PROFILE(riscv_goertzel_power_q15);
+  const q31_t *pCoef = S->pCoefs;                /* Coefficient pointer */
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t s1, s2, t;                               /* States of the bin and c/2 * s1 */
+  q63_t acc;                                     /* Power in Q61 */
+  uint32_t bin;                                  /* Loop counter */
+
+  for (bin = S->numBins; bin > 0u; bin--)
+  {
+    s1 = pState[0];
+    s2 = pState[1];
+
+    /*  |X|^2 = s1^2 + s2^2 - c * s1 * s2, c * s1 * s2 is 2 * (c/2 * s1) * s2 */
+    t = (q31_t) (((q63_t) *pCoef++ * s1) >> 31);
+    acc = (((q63_t) s1 * s1) >> 1) + (((q63_t) s2 * s2) >> 1) - ((q63_t) t * s2);
+
+    /*  Q61 to Q31, the power is not negative */
+    acc >>= 30;
+    *pDst++ = (acc < 0) ? 0 : ((acc > 0x7FFFFFFF) ? 0x7FFFFFFF : (q31_t) acc);
+
+    *pState++ = 0;
+    *pState++ = 0;
+  }
+}
+
+/**
+* @} end of Goertzel group
+*/
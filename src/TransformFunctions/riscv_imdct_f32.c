@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_imdct_f32.c
+*
+* Description:  Floating-point inverse modified discrete cosine transform.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MDCT
+ * @{
+ */
+
+/**
+* @brief  Processing function for the floating-point IMDCT.
+* @param[in]  *S     points to an instance of the floating-point MDCT structure.
+* @param[in]  *pSrc  points to the N MDCT coefficients, which are not modified.
+* @param[out] *pDst  points to the N output samples.
+* @return none.
+*
+* \par
+* The DCT-IV output u[2k] of one post-twiddled bin lands in one half of the unfolded frame
+* and u[N-1-2k] in the other, at the same two positions p1 and p2 of the output and of the
+* overlap buffer.  Each bin therefore completes two output samples from the overlap and
+* replaces the same two overlap samples, in one pass without an unfolded frame.
+*/
+
+void riscv_imdct_f32(
+  const riscv_mdct_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_imdct_f32);
+  const float32_t *pW = S->pWindow;              /* First half of the window */
+  const float32_t *pTw = S->pTwiddle;            /* Pre- and post-twiddle factors */
+  float32_t *pZ = S->pScratch;                   /* Output of the FFT */
+  float32_t *pOv = S->pOverlap;                  /* Second half of the previous frame */
+  uint32_t N = S->N;                             /* Number of coefficients */
+  uint32_t H = N >> 1u;                          /* Length of the FFT */
+  uint32_t k, p1, p2;                            /* Loop counter and output positions */
+  float32_t re, im, c, s;                        /* Temporary variables */
+  float32_t a, b;                                /* DCT-IV outputs of the overlap and of the output */
+  float32_t scale = 2.0f / (float32_t) N;        /* Scaling of the inverse transform */
+
+  /* Pair X[2k] and X[N-1-2k] with the scaled pre-twiddle */
+  for (k = 0u; k < H; k++)
+  {
+    c = pTw[2u * k] * scale;
+    s = pTw[(2u * k) + 1u] * scale;
+    re = pSrc[2u * k];
+    im = pSrc[N - 1u - (2u * k)];
+    pDst[2u * k] = (re * c) + (im * s);
+    pDst[(2u * k) + 1u] = (im * c) - (re * s);
+  }
+
+  riscv_cfft_mixed_f32(&S->Scfft, pDst, pZ, 0u);
+
+  /* u[2k] goes to the overlap, u[N-1-2k] to the output */
+  for (k = 0u; (2u * k) < H; k++)
+  {
+    c = pTw[2u * k];
+    s = pTw[(2u * k) + 1u];
+    re = pZ[2u * k];
+    im = pZ[(2u * k) + 1u];
+    a = (re * c) + (im * s);
+    b = (re * s) - (im * c);
+
+    p1 = H - 1u - (2u * k);
+    p2 = H + (2u * k);
+    pDst[p1] = pOv[p1] + (pW[p1] * b);
+    pDst[p2] = pOv[p2] - (pW[p2] * b);
+    pOv[p1] = -(pW[p2] * a);
+    pOv[p2] = -(pW[p1] * a);
+  }
+
+  /* u[2k] goes to the output, u[N-1-2k] to the overlap */
+  for (; k < H; k++)
+  {
+    c = pTw[2u * k];
+    s = pTw[(2u * k) + 1u];
+    re = pZ[2u * k];
+    im = pZ[(2u * k) + 1u];
+    b = (re * c) + (im * s);
+    a = (re * s) - (im * c);
+
+    p1 = (2u * k) - H;
+    p2 = (3u * H) - 1u - (2u * k);
+    pDst[p1] = pOv[p1] + (pW[p1] * b);
+    pDst[p2] = pOv[p2] - (pW[p2] * b);
+    pOv[p1] = -(pW[p2] * a);
+    pOv[p2] = -(pW[p1] * a);
+  }
+}
+
+/**
+* @} end of MDCT group
+*/
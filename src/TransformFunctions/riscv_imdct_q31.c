@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_imdct_q31.c
+*
+* Description:  Q31 inverse modified discrete cosine transform.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MDCT
+ * @{
+ */
+
+/**
+* @brief  Processing function for the Q31 IMDCT.
+* @param[in]  *S     points to an instance of the Q31 MDCT structure.
+* @param[in]  *pSrc  points to the N MDCT coefficients scaled down by N, which are not modified.
+* @param[out] *pDst  points to the N output samples.
+* @return none.
+*
+* \par
+* The pre-twiddle halves its products and riscv_cfft_q31() scales down by N/2.  The
+* post-twiddle shifts its 2.62 sums right by 32 - log2(2*N) rather than 31, which scales the
+* unfolded frame back up before it is rounded.  The unfolded frame is kept in 2.30 format, it
+* holds the windowed input plus its alias and reaches sqrt(2), and so is the overlap buffer.
+* The output samples and the overlap are unfolded, windowed and added as in riscv_imdct_f32().
+*/
+
+void riscv_imdct_q31(
+  const riscv_mdct_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  RISCV_PROFILE(riscv_imdct_q31);
+  const q31_t *pW = S->pWindow;                  /* First half of the window */
+  const q31_t *pTw = S->pTwiddle;                /* Pre- and post-twiddle factors */
+  q31_t *pZ = S->pScratch;                       /* Input and output of the FFT */
+  q31_t *pOv = S->pOverlap;                      /* Second half of the previous frame */
+  uint32_t N = S->N;                             /* Number of coefficients */
+  uint32_t H = N >> 1u;                          /* Length of the FFT */
+  uint32_t shift = 32u - S->outShift;            /* Right shift of the post-twiddle */
+  uint32_t k, p1, p2;                            /* Loop counter and output positions */
+  q31_t re, im, c, s;                            /* Temporary variables */
+  q31_t a, b;                                    /* Unfolded samples of the overlap and of the output */
+
+  /* Pair X[2k] and X[N-1-2k] with the pre-twiddle, in 2.30 format */
+  for (k = 0u; k < H; k++)
+  {
+    c = pTw[2u * k];
+    s = pTw[(2u * k) + 1u];
+    re = pSrc[2u * k];
+    im = pSrc[N - 1u - (2u * k)];
+    pZ[2u * k] = (q31_t) ((((q63_t) re * c) + ((q63_t) im * s)) >> 32);
+    pZ[(2u * k) + 1u] = (q31_t) ((((q63_t) im * c) - ((q63_t) re * s)) >> 32);
+  }
+
+  riscv_cfft_q31(&S->Scfft, pZ, 0u, 1u);
+
+  /* u[2k] goes to the overlap, u[N-1-2k] to the output */
+  for (k = 0u; (2u * k) < H; k++)
+  {
+    c = pTw[2u * k];
+    s = pTw[(2u * k) + 1u];
+    re = pZ[2u * k];
+    im = pZ[(2u * k) + 1u];
+    a = clip_q63_to_q31((((q63_t) re * c) + ((q63_t) im * s)) >> shift);
+    b = clip_q63_to_q31((((q63_t) re * s) - ((q63_t) im * c)) >> shift);
+
+    p1 = H - 1u - (2u * k);
+    p2 = H + (2u * k);
+    pDst[p1] = clip_q63_to_q31(((q63_t) pOv[p1] << 1) + (((q63_t) pW[p1] * b) >> 30));
+    pDst[p2] = clip_q63_to_q31(((q63_t) pOv[p2] << 1) - (((q63_t) pW[p2] * b) >> 30));
+    pOv[p1] = (q31_t) (-(((q63_t) pW[p2] * a) >> 31));
+    pOv[p2] = (q31_t) (-(((q63_t) pW[p1] * a) >> 31));
+  }
+
+  /* u[2k] goes to the output, u[N-1-2k] to the overlap */
+  for (; k < H; k++)
+  {
+    c = pTw[2u * k];
+    s = pTw[(2u * k) + 1u];
+    re = pZ[2u * k];
+    im = pZ[(2u * k) + 1u];
+    b = clip_q63_to_q31((((q63_t) re * c) + ((q63_t) im * s)) >> shift);
+    a = clip_q63_to_q31((((q63_t) re * s) - ((q63_t) im * c)) >> shift);
+
+    p1 = (2u * k) - H;
+    p2 = (3u * H) - 1u - (2u * k);
+    pDst[p1] = clip_q63_to_q31(((q63_t) pOv[p1] << 1) + (((q63_t) pW[p1] * b) >> 30));
+    pDst[p2] = clip_q63_to_q31(((q63_t) pOv[p2] << 1) - (((q63_t) pW[p2] * b) >> 30));
+    pOv[p1] = (q31_t) (-(((q63_t) pW[p2] * a) >> 31));
+    pOv[p2] = (q31_t) (-(((q63_t) pW[p1] * a) >> 31));
+  }
+}
+
+/**
+* @} end of MDCT group
+*/
@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mdct_f32.c
+*
+* Description:  Floating-point modified discrete cosine transform.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup MDCT MDCT/IMDCT
+ *
+ * The modified discrete cosine transform maps a frame of 2N samples to N coefficients,
+ * with frames that overlap by N samples.
+ * <pre>
+ *    X[k] = sum(n=0..2N-1) w[n] * x[n] * cos(pi/N * (n + 1/2 + N/2) * (k + 1/2))
+ *    y[n] = 2/N * w[n] * sum(k=0..N-1) X[k] * cos(pi/N * (n + 1/2 + N/2) * (k + 1/2))
+ * </pre>
+ * The inverse transform adds the first half of y to the second half of the previous frame,
+ * which cancels the time-domain aliasing and restores the input N samples late when the window
+ * satisfies the Princen-Bradley condition <code>w[n]^2 + w[n+N]^2 = 1</code>, for instance the
+ * sine window and the Kaiser-Bessel derived window.
+ *
+ * \par Algorithm
+ * Both directions are a DCT-IV of N points computed by an N/2-point complex FFT.  The MDCT
+ * windows and folds the frame into the N real inputs of the DCT-IV and pairs them into N/2
+ * complex values with the pre-twiddle in the same pass.  After the FFT the post-twiddle yields
+ * two coefficients per complex value.  The IMDCT pairs the coefficients with the pre-twiddle,
+ * and after the FFT the post-twiddle, the unfolding into 2N samples, the window and the
+ * overlap-add with the previous frame share one pass.  No buffer of 2N values is needed.
+ * \par
+ * The floating-point functions use riscv_cfft_mixed_f32(), so N/2 may be any product of the
+ * factors 2, 3 and 5: the frame sizes N = 120, 240, 480 and 960 of the low-delay audio codecs as
+ * well as the powers of two.  The Q31 functions use riscv_cfft_q31() and support the powers of
+ * two from N = 32 to 8192.
+ *
+ * \par Instance Structure
+ * An instance holds the FFT, the twiddle factors, the window and the scratch and overlap buffers.
+ * The window is passed as its first half, the N values <code>w[0] ... w[N-1]</code> of a symmetric
+ * window, as riscv_window_f32() and riscv_window_q31() write them for a window of length 2N.
+ * An instance is initialized with riscv_mdct_init_f32() or riscv_mdct_init_q31().  The MDCT and
+ * the IMDCT share the scratch buffer, so an instance must not run both at the same time.
+ *
+ * \par Fixed-point Behavior
+ * riscv_mdct_q31() returns the coefficients scaled down by N.  riscv_imdct_q31() takes
+ * coefficients in that format and returns the samples in 1.31 format, so a round trip restores
+ * the input.  The Q31 IMDCT scales the output of its FFT up by 2N, which leaves about
+ * 31 - log2(2N) significant bits in the output samples.
+ */
+
+/**
+ * @addtogroup MDCT
+ * @{
+ */
+
+/**
+* @brief  Processing function for the floating-point MDCT.
+* @param[in]  *S     points to an instance of the floating-point MDCT structure.
+* @param[in]  *pSrc  points to the frame of 2*N samples, which is not modified.
+* @param[out] *pDst  points to the N MDCT coefficients.
+* @return none.
+*
+* \par
+* The window and the folding of quarters a, b, c, d of the frame into (-c_r-d, a-b_r) are
+* applied while the DCT-IV inputs u[2n] and u[N-1-2n] are paired with the pre-twiddle.
+*/
+
+void riscv_mdct_f32(
+  const riscv_mdct_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_mdct_f32);
+  const float32_t *pW = S->pWindow;              /* First half of the window */
+  const float32_t *pTw = S->pTwiddle;            /* Pre- and post-twiddle factors */
+  float32_t *pZ = S->pScratch;                   /* Output of the FFT */
+  uint32_t N = S->N;                             /* Number of coefficients */
+  uint32_t H = N >> 1u;                          /* Length of the FFT */
+  uint32_t n, k;                                 /* Loop counters */
+  float32_t re, im, c, s;                        /* Temporary variables */
+
+  /* u[2n] from the second half of the frame, u[N-1-2n] from the first half */
+  for (n = 0u; (2u * n) < H; n++)
+  {
+    re = -(pSrc[(3u * H) - 1u - (2u * n)] * pW[H + (2u * n)]) - (pSrc[(3u * H) + (2u * n)] * pW[H - 1u - (2u * n)]);
+    im = (pSrc[H - 1u - (2u * n)] * pW[H - 1u - (2u * n)]) - (pSrc[H + (2u * n)] * pW[H + (2u * n)]);
+
+    c = pTw[2u * n];
+    s = pTw[(2u * n) + 1u];
+    pDst[2u * n] = (re * c) + (im * s);
+    pDst[(2u * n) + 1u] = (im * c) - (re * s);
+  }
+
+  /* u[2n] from the first half of the frame, u[N-1-2n] from the second half */
+  for (; n < H; n++)
+  {
+    re = (pSrc[(2u * n) - H] * pW[(2u * n) - H]) - (pSrc[(3u * H) - 1u - (2u * n)] * pW[(3u * H) - 1u - (2u * n)]);
+    im = -(pSrc[H + (2u * n)] * pW[(3u * H) - 1u - (2u * n)]) - (pSrc[(5u * H) - 1u - (2u * n)] * pW[(2u * n) - H]);
+
+    c = pTw[2u * n];
+    s = pTw[(2u * n) + 1u];
+    pDst[2u * n] = (re * c) + (im * s);
+    pDst[(2u * n) + 1u] = (im * c) - (re * s);
+  }
+
+  riscv_cfft_mixed_f32(&S->Scfft, pDst, pZ, 0u);
+
+  /* X[2k] and X[N-1-2k] are the real and the negated imaginary part of the post-twiddled bin k */
+  for (k = 0u; k < H; k++)
+  {
+    c = pTw[2u * k];
+    s = pTw[(2u * k) + 1u];
+    re = pZ[2u * k];
+    im = pZ[(2u * k) + 1u];
+    pDst[2u * k] = (re * c) + (im * s);
+    pDst[N - 1u - (2u * k)] = (re * s) - (im * c);
+  }
+}
+
+/**
+* @} end of MDCT group
+*/
@@ -0,0 +1,257 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mdct_init_arena.c
+*
+* Description:  MDCT/IMDCT instances with the tables, overlap and scratch
+*               buffers taken from an arena.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MDCT
+ * @{
+ */
+
+/**
+ * @brief  Size of the twiddle and overlap buffers of the floating-point MDCT/IMDCT.
+ * @param[in]  N          number of MDCT coefficients.
+ * @param[in]  imdctFlag  0 for an instance that only runs the MDCT, 1 if it also runs the IMDCT.
+ * @return     bytes the buffers take from the arena, <code>2*N+2</code> twiddle words and N overlap samples for the IMDCT.
+ */
+
+uint32_t riscv_mdct_get_buffer_size_f32(
+  uint16_t N,
+  uint8_t imdctFlag)
+{
+  uint32_t bytes = RISCV_DSP_ARENA_ROUND(((2u * (uint32_t) N) + 2u) * sizeof(float32_t));
+
+  if(imdctFlag != 0u)
+  {
+    bytes += RISCV_DSP_ARENA_ROUND((uint32_t) N * sizeof(float32_t));
+  }
+
+  return (bytes);
+}
+
+/**
+ * @brief  Size of the scratch buffer of the floating-point MDCT/IMDCT.
+ * @param[in]  N  number of MDCT coefficients.
+ * @return     bytes of the shared scratch region the instance needs, N samples.
+ */
+
+uint32_t riscv_mdct_get_scratch_size_f32(
+  uint16_t N)
+{
+  return (RISCV_DSP_ARENA_ROUND((uint32_t) N * sizeof(float32_t)));
+}
+
+/**
+ * @brief  Initialization function for the floating-point MDCT/IMDCT with the buffers taken from an arena.
+ * @param[out]    *S          points to an instance of the floating-point MDCT structure.
+ * @param[in]     N           number of MDCT coefficients, N/2 a product of the factors 2, 3 and 5.
+ * @param[in]     *pWindow    points to the first half of the window of length 2*N.
+ * @param[in]     imdctFlag   0 for an instance that only runs the MDCT, 1 if it also runs the IMDCT.
+ * @param[in,out] *pArena     points to the arena the buffers are taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena is too small, otherwise the status of riscv_mdct_init_f32().
+ *
+ * \par
+ * The twiddle factors and the overlap buffer are persistent, the scratch buffer is shared with the other
+ * instances of the arena.
+ */
+
+riscv_status riscv_mdct_init_arena_f32(
+  riscv_mdct_instance_f32 * S,
+  uint16_t N,
+  const float32_t * pWindow,
+  uint8_t imdctFlag,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_mdct_init_arena_f32);
+  uint32_t used = pArena->used;
+  uint32_t scratch = pArena->scratch;
+  float32_t *pTwiddle;
+  float32_t *pOverlap = NULL;
+  float32_t *pScratch;
+  riscv_status status = RISCV_MATH_LENGTH_ERROR;
+
+  pTwiddle = (float32_t *) riscv_dsp_arena_alloc(pArena, ((2u * (uint32_t) N) + 2u) * sizeof(float32_t));
+
+  if(imdctFlag != 0u)
+  {
+    pOverlap = (float32_t *) riscv_dsp_arena_alloc(pArena, (uint32_t) N * sizeof(float32_t));
+  }
+
+  pScratch = (float32_t *) riscv_dsp_arena_scratch(pArena, riscv_mdct_get_scratch_size_f32(N));
+
+  if((pTwiddle != NULL) && ((pOverlap != NULL) || (imdctFlag == 0u)) && (pScratch != NULL))
+  {
+    status = riscv_mdct_init_f32(S, N, pTwiddle, pWindow, pScratch, pOverlap);
+  }
+
+  /*  Give the buffers back if the arena is too small or the parameters are rejected */
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    pArena->used = used;
+    pArena->scratch = scratch;
+  }
+
+  return (status);
+}
+
+/**
+ * @brief  Length of the bit reversal table of the N/2-point Q31 CFFT.
+ * @param[in]  fftLen  length of the CFFT.
+ * @return     number of table entries, 0 for an unsupported length.
+ */
+
+static uint16_t riscv_mdct_bitrev_length_q31(
+  uint16_t fftLen)
+{
+  uint16_t length;
+
+  switch (fftLen)
+  {
+    case 16u:
+      length = RISCVBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH;
+      break;
+    case 32u:
+      length = RISCVBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH;
+      break;
+    case 64u:
+      length = RISCVBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH;
+      break;
+    case 128u:
+      length = RISCVBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH;
+      break;
+    case 256u:
+      length = RISCVBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH;
+      break;
+    case 512u:
+      length = RISCVBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH;
+      break;
+    case 1024u:
+      length = RISCVBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH;
+      break;
+    case 2048u:
+      length = RISCVBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH;
+      break;
+    case 4096u:
+      length = RISCVBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH;
+      break;
+    default:
+      length = 0u;
+      break;
+  }
+
+  return (length);
+}
+
+/**
+ * @brief  Size of the table and overlap buffers of the Q31 MDCT/IMDCT.
+ * @param[in]  N          number of MDCT coefficients.
+ * @param[in]  imdctFlag  0 for an instance that only runs the MDCT, 1 if it also runs the IMDCT.
+ * @return     bytes the buffers take from the arena, <code>7*N/4</code> twiddle words, the bit reversal table of the
+ * N/2-point CFFT and N overlap samples for the IMDCT.
+ */
+
+uint32_t riscv_mdct_get_buffer_size_q31(
+  uint16_t N,
+  uint8_t imdctFlag)
+{
+  uint32_t bytes = RISCV_DSP_ARENA_ROUND(((7u * (uint32_t) N) / 4u) * sizeof(q31_t));
+
+  bytes += RISCV_DSP_ARENA_ROUND((uint32_t) riscv_mdct_bitrev_length_q31(N / 2u) * sizeof(uint16_t));
+
+  if(imdctFlag != 0u)
+  {
+    bytes += RISCV_DSP_ARENA_ROUND((uint32_t) N * sizeof(q31_t));
+  }
+
+  return (bytes);
+}
+
+/**
+ * @brief  Size of the scratch buffer of the Q31 MDCT/IMDCT.
+ * @param[in]  N  number of MDCT coefficients.
+ * @return     bytes of the shared scratch region the instance needs, N samples.
+ */
+
+uint32_t riscv_mdct_get_scratch_size_q31(
+  uint16_t N)
+{
+  return (RISCV_DSP_ARENA_ROUND((uint32_t) N * sizeof(q31_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q31 MDCT/IMDCT with the buffers taken from an arena.
+ * @param[out]    *S          points to an instance of the Q31 MDCT structure.
+ * @param[in]     N           number of MDCT coefficients, a power of two from 32 to 8192.
+ * @param[in]     *pWindow    points to the first half of the window of length 2*N.
+ * @param[in]     imdctFlag   0 for an instance that only runs the MDCT, 1 if it also runs the IMDCT.
+ * @param[in,out] *pArena     points to the arena the buffers are taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena is too small, RISCV_MATH_ARGUMENT_ERROR if <code>N</code> is
+ * not a supported value, otherwise the status of riscv_mdct_init_q31().
+ *
+ * \par
+ * The twiddle factors, the bit reversal table and the overlap buffer are persistent, the scratch buffer is
+ * shared with the other instances of the arena.
+ */
+
+riscv_status riscv_mdct_init_arena_q31(
+  riscv_mdct_instance_q31 * S,
+  uint16_t N,
+  const q31_t * pWindow,
+  uint8_t imdctFlag,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_mdct_init_arena_q31);
+  uint32_t used = pArena->used;
+  uint32_t scratch = pArena->scratch;
+  uint16_t bitRevLength = riscv_mdct_bitrev_length_q31(N / 2u);
+  q31_t *pTwiddle;
+  uint16_t *pBitRevTable;
+  q31_t *pOverlap = NULL;
+  q31_t *pScratch;
+  riscv_status status = RISCV_MATH_LENGTH_ERROR;
+
+  if(bitRevLength == 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  pTwiddle = (q31_t *) riscv_dsp_arena_alloc(pArena, ((7u * (uint32_t) N) / 4u) * sizeof(q31_t));
+  pBitRevTable = (uint16_t *) riscv_dsp_arena_alloc(pArena, (uint32_t) bitRevLength * sizeof(uint16_t));
+
+  if(imdctFlag != 0u)
+  {
+    pOverlap = (q31_t *) riscv_dsp_arena_alloc(pArena, (uint32_t) N * sizeof(q31_t));
+  }
+
+  pScratch = (q31_t *) riscv_dsp_arena_scratch(pArena, riscv_mdct_get_scratch_size_q31(N));
+
+  if((pTwiddle != NULL) && (pBitRevTable != NULL) && ((pOverlap != NULL) || (imdctFlag == 0u)) && (pScratch != NULL))
+  {
+    status = riscv_mdct_init_q31(S, N, pTwiddle, pBitRevTable, pWindow, pScratch, pOverlap);
+  }
+
+  /*  Give the buffers back if the arena is too small or the parameters are rejected */
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    pArena->used = used;
+    pArena->scratch = scratch;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MDCT group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mdct_init_f32.c
+*
+* Description:  Initialization function for the floating-point MDCT/IMDCT.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MDCT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point MDCT/IMDCT.
+* @param[out]    *S          points to an instance of the floating-point MDCT structure.
+* @param[in]     N           number of MDCT coefficients, even and N/2 a product of the factors 2, 3 and 5.
+* @param[out]    *pTwiddle   points to a buffer of <code>2*N+2</code> words that receives the twiddle factors.
+* @param[in]     *pWindow    points to the first half of the window of length <code>2*N</code>, N values.
+* @param[in]     *pScratch   points to the scratch buffer of length N.
+* @param[in]     *pOverlap   points to the IMDCT overlap buffer of length N, or NULL if the instance only runs the MDCT.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>N</code> is not a supported value.
+*
+* \par Description:
+* The first <code>N+2</code> words of <code>pTwiddle</code> receive the twiddle factors of the N/2-point
+* riscv_cfft_mixed_f32(), the last N the pre- and post-twiddle factors cos(pi*(8*k+1)/(8*N)),
+* sin(pi*(8*k+1)/(8*N)) for k = 0, 1, ..., N/2-1.  The overlap buffer is cleared, so the first
+* IMDCT output is the first half of its frame alone.
+* All buffers must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_mdct_init_f32(
+  riscv_mdct_instance_f32 * S,
+  uint16_t N,
+  float32_t * pTwiddle,
+  const float32_t * pWindow,
+  float32_t * pScratch,
+  float32_t * pOverlap)
+{
+  RISCV_PROFILE(riscv_mdct_init_f32);
+  riscv_status status;
+  float32_t *pTw = pTwiddle + N + 2u;            /* Pre- and post-twiddle factors */
+  float32_t phase;
+  uint32_t k;
+
+  if((N & 1u) != 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  Initialize the N/2-point complex FFT */
+  status = riscv_cfft_mixed_init_f32(&S->Scfft, N / 2u, pTwiddle);
+
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  for (k = 0u; k < (N / 2u); k++)
+  {
+    phase = (3.14159265358979f * (float32_t) ((8u * k) + 1u)) / (float32_t) (8u * N);
+    pTw[2u * k] = cosf(phase);
+    pTw[(2u * k) + 1u] = sinf(phase);
+  }
+
+  S->N = N;
+  S->pTwiddle = pTw;
+  S->pWindow = pWindow;
+  S->pScratch = pScratch;
+  S->pOverlap = pOverlap;
+
+  if(pOverlap != NULL)
+  {
+    riscv_fill_f32(0.0f, pOverlap, N);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of MDCT group
+*/
@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mdct_init_q31.c
+*
+* Description:  Initialization function for the Q31 MDCT/IMDCT.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MDCT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q31 MDCT/IMDCT.
+* @param[out]    *S             points to an instance of the Q31 MDCT structure.
+* @param[in]     N              number of MDCT coefficients, a power of two from 32 to 8192.
+* @param[out]    *pTwiddle      points to a buffer of <code>7*N/4</code> words that receives the twiddle factors.
+* @param[out]    *pBitRevTable  points to a buffer of RISCVBITREVINDEXTABLE_FIXED_*_TABLE_LENGTH entries of the N/2-point
+* CFFT that receives the bit reversal table.
+* @param[in]     *pWindow       points to the first half of the window of length <code>2*N</code>, N values.
+* @param[in]     *pScratch      points to the scratch buffer of length N.
+* @param[in]     *pOverlap      points to the IMDCT overlap buffer of length N, or NULL if the instance only runs the MDCT.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>N</code> is not a supported value.
+*
+* \par Description:
+* The first <code>3*N/4</code> words of <code>pTwiddle</code> and <code>pBitRevTable</code> receive the tables of the
+* N/2-point riscv_cfft_q31() from riscv_cfft_runtime_init_q31(), the last N words the pre- and post-twiddle factors
+* cos(pi*(8*k+1)/(8*N)), sin(pi*(8*k+1)/(8*N)) for k = 0, 1, ..., N/2-1.  The overlap buffer is cleared.
+* All buffers must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_mdct_init_q31(
+  riscv_mdct_instance_q31 * S,
+  uint16_t N,
+  q31_t * pTwiddle,
+  uint16_t * pBitRevTable,
+  const q31_t * pWindow,
+  q31_t * pScratch,
+  q31_t * pOverlap)
+{
+  RISCV_PROFILE(riscv_mdct_init_q31);
+  riscv_status status;
+  q31_t *pTw = pTwiddle + ((3u * N) / 4u);       /* Pre- and post-twiddle factors */
+  float64_t phase;
+  float64_t val;
+  uint32_t k;
+  uint8_t outShift = 0u;
+
+  if((N & 1u) != 0u)
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  Initialize the N/2-point complex FFT, which checks the length */
+  status = riscv_cfft_runtime_init_q31(&S->Scfft, N / 2u, pTwiddle, pBitRevTable);
+
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  for (k = 0u; k < (N / 2u); k++)
+  {
+    phase = (3.141592653589793 * (float64_t) ((8u * k) + 1u)) / (float64_t) (8u * N);
+
+    /*  Rounded, a cosine that rounds to 1.0 saturates to 2147483647 */
+    val = floor((cos(phase) * 2147483648.0) + 0.5);
+    pTw[2u * k] = (q31_t) ((val > 2147483647.0) ? 2147483647.0 : val);
+    pTw[(2u * k) + 1u] = (q31_t) floor((sin(phase) * 2147483648.0) + 0.5);
+  }
+
+  /*  log2(2*N) */
+  while((1uL << outShift) < (2uL * N))
+  {
+    outShift++;
+  }
+
+  S->N = N;
+  S->outShift = outShift;
+  S->pTwiddle = pTw;
+  S->pWindow = pWindow;
+  S->pScratch = pScratch;
+  S->pOverlap = pOverlap;
+
+  if(pOverlap != NULL)
+  {
+    riscv_fill_q31(0, pOverlap, N);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of MDCT group
+*/
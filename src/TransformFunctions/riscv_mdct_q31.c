@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mdct_q31.c
+*
+* Description:  Q31 modified discrete cosine transform.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MDCT
+ * @{
+ */
+
+/**
+* @brief  Processing function for the Q31 MDCT.
+* @param[in]  *S     points to an instance of the Q31 MDCT structure.
+* @param[in]  *pSrc  points to the frame of 2*N samples, which is not modified.
+* @param[out] *pDst  points to the N MDCT coefficients, scaled down by N.
+* @return none.
+*
+* \par
+* The windowed samples are halved so that the folded sums do not overflow, and
+* riscv_cfft_q31() scales down by N/2, which together give the scaling by N.
+*/
+
+void riscv_mdct_q31(
+  const riscv_mdct_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  RISCV_PROFILE(riscv_mdct_q31);
+  const q31_t *pW = S->pWindow;                  /* First half of the window */
+  const q31_t *pTw = S->pTwiddle;                /* Pre- and post-twiddle factors */
+  q31_t *pZ = S->pScratch;                       /* Input and output of the FFT */
+  uint32_t N = S->N;                             /* Number of coefficients */
+  uint32_t H = N >> 1u;                          /* Length of the FFT */
+  uint32_t n, k;                                 /* Loop counters */
+  q31_t re, im, c, s;                            /* Temporary variables */
+
+  /* u[2n] from the second half of the frame, u[N-1-2n] from the first half, in 2.30 format */
+  for (n = 0u; (2u * n) < H; n++)
+  {
+    re = -(q31_t) (((q63_t) pSrc[(3u * H) - 1u - (2u * n)] * pW[H + (2u * n)]) >> 32)
+      - (q31_t) (((q63_t) pSrc[(3u * H) + (2u * n)] * pW[H - 1u - (2u * n)]) >> 32);
+    im = (q31_t) (((q63_t) pSrc[H - 1u - (2u * n)] * pW[H - 1u - (2u * n)]) >> 32)
+      - (q31_t) (((q63_t) pSrc[H + (2u * n)] * pW[H + (2u * n)]) >> 32);
+
+    c = pTw[2u * n];
+    s = pTw[(2u * n) + 1u];
+    pZ[2u * n] = clip_q63_to_q31((((q63_t) re * c) + ((q63_t) im * s)) >> 31);
+    pZ[(2u * n) + 1u] = clip_q63_to_q31((((q63_t) im * c) - ((q63_t) re * s)) >> 31);
+  }
+
+  /* u[2n] from the first half of the frame, u[N-1-2n] from the second half */
+  for (; n < H; n++)
+  {
+    re = (q31_t) (((q63_t) pSrc[(2u * n) - H] * pW[(2u * n) - H]) >> 32)
+      - (q31_t) (((q63_t) pSrc[(3u * H) - 1u - (2u * n)] * pW[(3u * H) - 1u - (2u * n)]) >> 32);
+    im = -(q31_t) (((q63_t) pSrc[H + (2u * n)] * pW[(3u * H) - 1u - (2u * n)]) >> 32)
+      - (q31_t) (((q63_t) pSrc[(5u * H) - 1u - (2u * n)] * pW[(2u * n) - H]) >> 32);
+
+    c = pTw[2u * n];
+    s = pTw[(2u * n) + 1u];
+    pZ[2u * n] = clip_q63_to_q31((((q63_t) re * c) + ((q63_t) im * s)) >> 31);
+    pZ[(2u * n) + 1u] = clip_q63_to_q31((((q63_t) im * c) - ((q63_t) re * s)) >> 31);
+  }
+
+  riscv_cfft_q31(&S->Scfft, pZ, 0u, 1u);
+
+  /* X[2k] and X[N-1-2k] are the real and the negated imaginary part of the post-twiddled bin k */
+  for (k = 0u; k < H; k++)
+  {
+    c = pTw[2u * k];
+    s = pTw[(2u * k) + 1u];
+    re = pZ[2u * k];
+    im = pZ[(2u * k) + 1u];
+    pDst[2u * k] = clip_q63_to_q31((((q63_t) re * c) + ((q63_t) im * s)) >> 31);
+    pDst[N - 1u - (2u * k)] = clip_q63_to_q31((((q63_t) re * s) - ((q63_t) im * c)) >> 31);
+  }
+}
+
+/**
+* @} end of MDCT group
+*/
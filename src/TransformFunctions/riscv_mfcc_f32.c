@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mfcc_f32.c
+*
+* Description:  Floating-point mel-frequency cepstral coefficients.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/*  Mel energies are raised to this value before the logarithm */
+#define RISCV_MFCC_ENERGY_FLOOR   1.0e-20f
+
+/*
+* @brief  Fast natural logarithm.
+* @param[in]  x     positive normal value.
+* @return     ln(x), the absolute error is below 3e-5.
+*
+* x = 2^e * m with m in [sqrt(0.5), sqrt(2)) is read from the bits of the
+* float, ln(m) is a degree 5 least squares fit in (m - 1) that is exact at 1.
+*/
+
+static float32_t riscv_mfcc_log_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u;
+  int32_t e;
+  float32_t t;
+
+  u.f = x;
+  e = ((u.i >> 23) & 0xFF) - 127;
+  u.i = (u.i & 0x007FFFFF) | 0x3F800000;
+
+  if(u.f > 1.41421356f)
+  {
+    u.f *= 0.5f;
+    e++;
+  }
+
+  t = u.f - 1.0f;
+
+  return (((float32_t) e * 0.693147181f) +
+          (t * (0.999904977f + (t * (-0.499502411f + (t * (0.337924348f +
+          (t * (-0.26946338f + (t * 0.166697762f))))))))));
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup MFCC Mel-Frequency Cepstral Coefficients
+ *
+ * \par
+ * The MFCC front end reduces a frame of <code>fftLen</code> real samples to <code>numCoefs</code>
+ * cepstral coefficients, which is the usual input of keyword spotting and speech recognition:
+ * - the frame is windowed and transformed with riscv_rfft_fast_f32(),
+ * - the power spectrum of the <code>fftLen/2+1</code> bins is weighted by <code>numFilters</code> mel filters,
+ * - the natural logarithm of each mel energy is taken,
+ * - a DCT-II with orthonormal scaling returns the first <code>numCoefs</code> coefficients.
+ * \par
+ * A mel filter is a triangle that only covers a few bins, so the filterbank is stored sparsely:
+ * the start bin and the number of weights of each filter, and the nonzero weights of all filters
+ * one after the other.  The mel energies cost one multiply-accumulate per nonzero weight instead
+ * of <code>numFilters*(fftLen/2+1)</code> for a dense matrix.
+ * \par
+ * The logarithm is a polynomial approximation with an absolute error below 3e-5, which is far below
+ * the resolution of the features.  Energies are floored at 1e-20 before the logarithm.
+ * \par
+ * The DCT-II is a <code>numCoefs</code> x <code>numFilters</code> table built by riscv_mfcc_init_f32(), e.g. 13 x 40 values,
+ * and needs neither the state buffer nor the tables of riscv_dct4_f32().
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+* @brief Processing function for the floating-point MFCC.
+* @param[in]     *S      points to an instance of the floating-point MFCC structure.
+* @param[in]     *pSrc   points to the frame of <code>fftLen</code> samples.
+* @param[out]    *pDst   points to the <code>numCoefs</code> cepstral coefficients.
+* @param[in]     *pTmp   points to a scratch buffer of <code>2*fftLen</code> values.
+* @return none.
+*/
+
+void riscv_mfcc_f32(
+  riscv_mfcc_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pTmp)
+{
+  RISCV_PROFILE(riscv_mfcc_f32);
+  uint32_t L = (uint32_t) S->fftLen >> 1u;       /* Number of complex bins */
+  float32_t *pSpec = pTmp + S->fftLen;           /* Packed spectrum, then mel energies */
+  const float32_t *pCoefs = S->pFilterCoefs;     /* Weights of the current filter */
+  const uint16_t *pPos = S->pFilterPos;          /* Start and length of the current filter */
+  float32_t re, im, energy;
+  uint32_t i;                                    /* Loop counter */
+
+  /*  Window the frame and compute its real FFT */
+  riscv_mult_f32((float32_t *) pSrc, (float32_t *) S->pWindow, pTmp, S->fftLen);
+  riscv_rfft_fast_f32(&S->Srfft, pTmp, pSpec, 0u);
+
+  /*  Power spectrum from DC to Nyquist, X[0] and X[fftLen/2] are packed in the first bin */
+  pTmp[0] = pSpec[0] * pSpec[0];
+  pTmp[L] = pSpec[1] * pSpec[1];
+
+  for (i = 1u; i < L; i++)
+  {
+    re = pSpec[2u * i];
+    im = pSpec[(2u * i) + 1u];
+    pTmp[i] = (re * re) + (im * im);
+  }
+
+  /*  Log mel energies, only the nonzero weights of each filter are visited */
+  for (i = 0u; i < S->numFilters; i++)
+  {
+    riscv_dot_prod_f32((float32_t *) pCoefs, pTmp + pPos[0], pPos[1], &energy);
+    pCoefs += pPos[1];
+    pPos += 2;
+
+    if(energy < RISCV_MFCC_ENERGY_FLOOR)
+    {
+      energy = RISCV_MFCC_ENERGY_FLOOR;
+    }
+
+    pSpec[i] = riscv_mfcc_log_f32(energy);
+  }
+
+  /*  DCT-II of the log mel energies */
+  for (i = 0u; i < S->numCoefs; i++)
+  {
+    riscv_dot_prod_f32(S->pDctCoefs + (i * S->numFilters), pSpec, S->numFilters, &pDst[i]);
+  }
+}
+
+/**
+* @} end of MFCC group
+*/
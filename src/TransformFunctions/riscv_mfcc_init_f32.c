@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_mfcc_init_f32.c
+*
+* Description:  Initialization function for the floating-point MFCC.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point MFCC.
+* @param[out]    *S             points to an instance of the floating-point MFCC structure.
+* @param[in]     fftLen         length of a frame, a power of two from 32 to 4096.
+* @param[in]     numFilters     number of mel filters, at most <code>fftLen</code>.
+* @param[in]     numCoefs       number of cepstral coefficients, from 1 to <code>numFilters</code>.
+* @param[in]     *pWindow       points to the window table of length <code>fftLen</code>.
+* @param[in]     *pFilterPos    points to the start bin and the length of each filter, <code>2*numFilters</code> values.
+* @param[in]     *pFilterCoefs  points to the nonzero weights of all filters, one filter after the other.
+* @param[out]    *pDctCoefs     points to a buffer of <code>numCoefs*numFilters</code> values that receives the DCT-II table.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>fftLen</code>, <code>numFilters</code> or <code>numCoefs</code> is not a supported value or a filter does not fit in the <code>fftLen/2+1</code> bins.
+*
+* \par Description:
+* Filter m covers the bins <code>pFilterPos[2*m]</code> to <code>pFilterPos[2*m]+pFilterPos[2*m+1]-1</code> of the power spectrum,
+* its <code>pFilterPos[2*m+1]</code> weights follow the weights of filter m-1 in <code>pFilterCoefs</code>.
+* \par
+* The DCT-II table is computed for the requested size only, with the orthonormal scaling folded in:
+* <code>pDctCoefs[k*numFilters+m]</code> = s(k) * cos(pi*k*(m+0.5)/numFilters), s(0) = sqrt(1/numFilters) and s(k) = sqrt(2/numFilters) for k > 0.
+* The buffers must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_mfcc_init_f32(
+  riscv_mfcc_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t numFilters,
+  uint16_t numCoefs,
+  const float32_t * pWindow,
+  const uint16_t * pFilterPos,
+  const float32_t * pFilterCoefs,
+  float32_t * pDctCoefs)
+{
+  RISCV_PROFILE(riscv_mfcc_init_f32);
+  riscv_status status;
+  uint32_t k, m;
+  float32_t scale;
+
+  if((numCoefs == 0u) || (numCoefs > numFilters) || (numFilters > fftLen))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  Every filter must lie within the bins DC to Nyquist */
+  for (m = 0u; m < numFilters; m++)
+  {
+    if(((uint32_t) pFilterPos[2u * m] + pFilterPos[(2u * m) + 1u]) > ((uint32_t) (fftLen >> 1u) + 1u))
+    {
+      return (RISCV_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  /*  Initialize the real FFT of a frame */
+  status = riscv_rfft_fast_init_f32(&S->Srfft, fftLen);
+
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  /*  Compute the DCT-II table for the requested size */
+  for (k = 0u; k < numCoefs; k++)
+  {
+    scale = sqrtf(((k == 0u) ? 1.0f : 2.0f) / (float32_t) numFilters);
+
+    for (m = 0u; m < numFilters; m++)
+    {
+      pDctCoefs[(k * numFilters) + m] = scale *
+        cosf((3.14159265358979f * (float32_t) k * ((float32_t) m + 0.5f)) / (float32_t) numFilters);
+    }
+  }
+
+  S->fftLen = fftLen;
+  S->numFilters = numFilters;
+  S->numCoefs = numCoefs;
+  S->pWindow = pWindow;
+  S->pFilterPos = pFilterPos;
+  S->pFilterCoefs = pFilterCoefs;
+  S->pDctCoefs = pDctCoefs;
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of MFCC group
+*/
@@ -104,6 +104,7 @@ void riscv_rfft_f32(
   float32_t * pSrc,
   float32_t * pDst)
 {
+  RISCV_PROFILE(riscv_rfft_f32);
   const riscv_cfft_radix4_instance_f32 *S_CFFT = S->pCfft;
 
 
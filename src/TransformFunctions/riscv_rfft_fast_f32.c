@@ -42,22 +42,31 @@
 
 #include <riscv_dsp/riscv_math.h>
 
+/*
+* Bins k and fftLen-k of the split stages read the same two input samples with
+* their roles swapped, so each iteration loads the pair once and produces both
+* outputs, which halves the data loads and the loop count.  The expressions
+* are the ones of the one bin per iteration loop, so the results are unchanged.
+*/
+
 void stage_rfft_f32(
   riscv_rfft_fast_instance_f32 * S,
   float32_t * p, float32_t * pOut)
 {
    uint32_t  k;								   /* Loop Counter                     */
+   uint32_t  L = (S->Sint).fftLen;           /* Length of the complex FFT        */
    float32_t twR, twI;						   /* RFFT Twiddle coefficients        */
    float32_t * pCoeff = S->pTwiddleRFFT;  /* Points to RFFT Twiddle factors   */
+   float32_t * pCoeffB;                     /* Twiddle factors of bin fftLen-k  */
    float32_t *pA = p;						   /* increasing pointer               */
    float32_t *pB = p;						   /* decreasing pointer               */
+   float32_t *pOutB;                          /* decreasing output pointer        */
    float32_t xAR, xAI, xBR, xBI;				/* temporary variables              */
    float32_t t1a, t1b;				         /* temporary variables              */
    float32_t p0, p1, p2, p3;				   /* temporary variables              */
+   float32_t twBR, twBI, q0, q1, q2, q3;     /* temporary variables of bin fftLen-k */
 
 
-   k = (S->Sint).fftLen - 1;					
-
    /* Pack first and last sample of the frequency domain together */
 
    xBR = pB[0];
@@ -80,8 +89,13 @@ void stage_rfft_f32(
    *pOut++ = 0.5f * ( t1a - t1b );
 
    // XA(1) = 1/2*( U1 - imag(U2) +  i*( U1 +imag(U2) ));
-   pB  = p + 2*k;
+   pB  = p + 2*(L - 1u);
    pA += 2;
+   pCoeffB = S->pTwiddleRFFT + 2*(L - 1u);
+   pOutB = pOut + 2*(L - 2u);
+
+   /* Bins 1 to fftLen/2-1 and fftLen-1 down to fftLen/2+1 */
+   k = (L >> 1u) - 1u;
 
    do
    {
@@ -107,6 +121,8 @@ void stage_rfft_f32(
 
       twR = *pCoeff++;
       twI = *pCoeff++;
+      twBR = pCoeffB[0];
+      twBI = pCoeffB[1];
 
       t1a = xBR - xAR ;
       t1b = xBI + xAI ;
@@ -118,40 +134,79 @@ void stage_rfft_f32(
       p2 = twR * t1b;
       p3 = twI * t1b;
 
+      /* Bin fftLen-k swaps the roles of xA and xB */
+      q0 = twBR * (xAR - xBR);
+      q1 = twBI * (xAR - xBR);
+      q2 = twBR * t1b;
+      q3 = twBI * t1b;
+
       *pOut++ = 0.5f * (xAR + xBR + p0 + p3 ); //xAR
       *pOut++ = 0.5f * (xAI - xBI + p1 - p2 ); //xAI
 
+      pOutB[0] = 0.5f * (xBR + xAR + q0 + q3 ); //xBR
+      pOutB[1] = 0.5f * (xBI - xAI + q1 - q2 ); //xBI
+
       pA += 2;
       pB -= 2;
+      pCoeffB -= 2;
+      pOutB -= 2;
       k--;
    } while(k > 0u);
+
+   /* Bin fftLen/2 reads the same sample as xA and xB */
+   xBI = pB[1];
+   xBR = pB[0];
+   xAR = pA[0];
+   xAI = pA[1];
+
+   twR = *pCoeff++;
+   twI = *pCoeff++;
+
+   t1a = xBR - xAR ;
+   t1b = xBI + xAI ;
+
+   p0 = twR * t1a;
+   p1 = twI * t1a;
+   p2 = twR * t1b;
+   p3 = twI * t1b;
+
+   *pOut++ = 0.5f * (xAR + xBR + p0 + p3 ); //xAR
+   *pOut++ = 0.5f * (xAI - xBI + p1 - p2 ); //xAI
 }
 
-/* Prepares data for inverse cfft */
+/* Prepares data for inverse cfft, scale is 0.5 times the scaling of the inverse transform */
 void merge_rfft_f32(
 riscv_rfft_fast_instance_f32 * S,
-float32_t * p, float32_t * pOut)
+float32_t * p, float32_t * pOut,
+float32_t scale)
 {
    uint32_t  k;								/* Loop Counter                     */
+   uint32_t  L = (S->Sint).fftLen;        /* Length of the complex FFT        */
    float32_t twR, twI;						/* RFFT Twiddle coefficients        */
    float32_t *pCoeff = S->pTwiddleRFFT;		/* Points to RFFT Twiddle factors   */
+   float32_t *pCoeffB;                      /* Twiddle factors of bin fftLen-k  */
    float32_t *pA = p;						/* increasing pointer               */
    float32_t *pB = p;						/* decreasing pointer               */
+   float32_t *pOutB;                        /* decreasing output pointer        */
    float32_t xAR, xAI, xBR, xBI;			/* temporary variables              */
    float32_t t1a, t1b, r, s, t, u;			/* temporary variables              */
-
-   k = (S->Sint).fftLen - 1;					
+   float32_t twBR, twBI, rB, sB, tB, uB;   /* temporary variables of bin fftLen-k */
 
    xAR = pA[0];
    xAI = pA[1];
 
    pCoeff += 2 ;
 
-   *pOut++ = 0.5f * ( xAR + xAI );
-   *pOut++ = 0.5f * ( xAR - xAI );
+   *pOut++ = scale * ( xAR + xAI );
+   *pOut++ = scale * ( xAR - xAI );
 
-   pB  =  p + 2*k ;
+   pB  =  p + 2*(L - 1u) ;
    pA +=  2	   ;
+   pCoeffB = S->pTwiddleRFFT + 2*(L - 1u);
+   pOutB = pOut + 2*(L - 2u);
+
+   /* Bins 1 to fftLen/2-1 and fftLen-1 down to fftLen/2+1 */
+   k = (L >> 1u) - 1u;
 
    while(k > 0u)
    {
@@ -165,6 +220,8 @@ float32_t * p, float32_t * pOut)
 
       twR = *pCoeff++;
       twI = *pCoeff++;
+      twBR = pCoeffB[0];
+      twBI = pCoeffB[1];
 
       t1a = xAR - xBR ;
       t1b = xAI + xBI ;
@@ -174,16 +231,46 @@ float32_t * p, float32_t * pOut)
       t = twI * t1a;
       u = twR * t1b;
 
+      /* Bin fftLen-k swaps the roles of xA and xB */
+      rB = twBR * (xBR - xAR);
+      sB = twBI * t1b;
+      tB = twBI * (xBR - xAR);
+      uB = twBR * t1b;
+
       // real(tw * (xA - xB)) = twR * (xAR - xBR) - twI * (xAI - xBI);
       // imag(tw * (xA - xB)) = twI * (xAR - xBR) + twR * (xAI - xBI);
-      *pOut++ = 0.5f * (xAR + xBR - r - s ); //xAR
-      *pOut++ = 0.5f * (xAI - xBI + t - u ); //xAI
+      *pOut++ = scale * (xAR + xBR - r - s ); //xAR
+      *pOut++ = scale * (xAI - xBI + t - u ); //xAI
+
+      pOutB[0] = scale * (xBR + xAR - rB - sB ); //xBR
+      pOutB[1] = scale * (xBI - xAI + tB - uB ); //xBI
 
       pA += 2;
       pB -= 2;
+      pCoeffB -= 2;
+      pOutB -= 2;
       k--;
    }
 
+   /* Bin fftLen/2 reads the same sample as xA and xB */
+   xBI =   pB[1]    ;
+   xBR =   pB[0]    ;
+   xAR =  pA[0];
+   xAI =  pA[1];
+
+   twR = *pCoeff++;
+   twI = *pCoeff++;
+
+   t1a = xAR - xBR ;
+   t1b = xAI + xBI ;
+
+   r = twR * t1a;
+   s = twI * t1b;
+   t = twI * t1a;
+   u = twR * t1b;
+
+   *pOut++ = scale * (xAR + xBR - r - s ); //xAR
+   *pOut++ = scale * (xAI - xBI + t - u ); //xAI
 }
 
 /**
@@ -319,8 +406,13 @@ float32_t * p, float32_t * pOut)
 * @param[in]  *S              points to an riscv_rfft_fast_instance_f32 structure.
 * @param[in]  *p              points to the input buffer.
 * @param[in]  *pOut           points to the output buffer.
-* @param[in]  ifftFlag        RFFT if flag is 0, RIFFT if flag is 1
+* @param[in]  ifftFlag        RFFT if flag is 0, RIFFT if flag is 1, RIFFT without the 1/fftLenRFFT scaling if flag is RISCV_FFT_INVERSE_NOSCALE
 * @return none.
+*
+* \par
+* The inverse transform folds its 1/fftLenRFFT scaling into the multiplications of the merge stage
+* and runs riscv_cfft_f32() with RISCV_FFT_INVERSE_NOSCALE, so the scaling takes no pass of its own.
+* With RISCV_FFT_INVERSE_NOSCALE the output is fftLenRFFT times the scaled one.
 */
 
 void riscv_rfft_fast_f32(
@@ -328,17 +420,18 @@ riscv_rfft_fast_instance_f32 * S,
 float32_t * p, float32_t * pOut,
 uint8_t ifftFlag)
 {
+  RISCV_PROFILE(riscv_rfft_fast_f32);
    riscv_cfft_instance_f32 * Sint = &(S->Sint);
    Sint->fftLen = S->fftLenRFFT / 2;
 
    /* Calculation of Real FFT */
    if(ifftFlag)
    {
-      /*  Real FFT compression */
-      merge_rfft_f32(S, p, pOut);
+      /*  Real FFT compression, with the scaling of the inverse */
+      merge_rfft_f32(S, p, pOut, (ifftFlag == RISCV_FFT_INVERSE_NOSCALE) ? 1.0f : 1.0f / (float32_t) S->fftLenRFFT);
 
-      /* Complex radix-4 IFFT process */
-      riscv_cfft_f32( Sint, pOut, ifftFlag, 1);
+      /* Complex radix-8 IFFT process */
+      riscv_cfft_f32( Sint, pOut, RISCV_FFT_INVERSE_NOSCALE, 1);
    }
    else
    {
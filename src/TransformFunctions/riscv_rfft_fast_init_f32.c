@@ -52,85 +52,272 @@
  * @{   
  */
 
+#if RISCV_DSP_FFT_LEN(16)
+/**   
+* @brief  Initialization function for the 32-point floating-point real FFT.  
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_f32 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.  
+*   
+* Only references the tables of the 32-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+riscv_status riscv_rfft_fast_init_32_f32(
+  riscv_rfft_fast_instance_f32 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_32_f32);
+  riscv_cfft_instance_f32 * Sint = &(S->Sint);
+
+  Sint->fftLen = 16u;
+  S->fftLenRFFT = 32u;
+  Sint->bitRevLength = RISCVBITREVINDEXTABLE__16_TABLE_LENGTH;
+  Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable16;
+  Sint->pTwiddle     = (float32_t *) RISCV_CFFT_TWIDDLE_F32(16);
+  S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_32;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(32)
+/**   
+* @brief  Initialization function for the 64-point floating-point real FFT.  
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_f32 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.  
+*   
+* Only references the tables of the 64-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+riscv_status riscv_rfft_fast_init_64_f32(
+  riscv_rfft_fast_instance_f32 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_64_f32);
+  riscv_cfft_instance_f32 * Sint = &(S->Sint);
+
+  Sint->fftLen = 32u;
+  S->fftLenRFFT = 64u;
+  Sint->bitRevLength = RISCVBITREVINDEXTABLE__32_TABLE_LENGTH;
+  Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable32;
+  Sint->pTwiddle     = (float32_t *) RISCV_CFFT_TWIDDLE_F32(32);
+  S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_64;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(64)
+/**   
+* @brief  Initialization function for the 128-point floating-point real FFT.  
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_f32 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.  
+*   
+* Only references the tables of the 128-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+riscv_status riscv_rfft_fast_init_128_f32(
+  riscv_rfft_fast_instance_f32 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_128_f32);
+  riscv_cfft_instance_f32 * Sint = &(S->Sint);
+
+  Sint->fftLen = 64u;
+  S->fftLenRFFT = 128u;
+  Sint->bitRevLength = RISCVBITREVINDEXTABLE__64_TABLE_LENGTH;
+  Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable64;
+  Sint->pTwiddle     = (float32_t *) RISCV_CFFT_TWIDDLE_F32(64);
+  S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_128;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(128)
+/**   
+* @brief  Initialization function for the 256-point floating-point real FFT.  
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_f32 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.  
+*   
+* Only references the tables of the 256-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+riscv_status riscv_rfft_fast_init_256_f32(
+  riscv_rfft_fast_instance_f32 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_256_f32);
+  riscv_cfft_instance_f32 * Sint = &(S->Sint);
+
+  Sint->fftLen = 128u;
+  S->fftLenRFFT = 256u;
+  Sint->bitRevLength = RISCVBITREVINDEXTABLE_128_TABLE_LENGTH;
+  Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable128;
+  Sint->pTwiddle     = (float32_t *) RISCV_CFFT_TWIDDLE_F32(128);
+  S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_256;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(256)
+/**   
+* @brief  Initialization function for the 512-point floating-point real FFT.  
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_f32 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.  
+*   
+* Only references the tables of the 512-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+riscv_status riscv_rfft_fast_init_512_f32(
+  riscv_rfft_fast_instance_f32 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_512_f32);
+  riscv_cfft_instance_f32 * Sint = &(S->Sint);
+
+  Sint->fftLen = 256u;
+  S->fftLenRFFT = 512u;
+  Sint->bitRevLength = RISCVBITREVINDEXTABLE_256_TABLE_LENGTH;
+  Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable256;
+  Sint->pTwiddle     = (float32_t *) RISCV_CFFT_TWIDDLE_F32(256);
+  S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_512;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(512)
+/**   
+* @brief  Initialization function for the 1024-point floating-point real FFT.  
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_f32 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.  
+*   
+* Only references the tables of the 1024-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+riscv_status riscv_rfft_fast_init_1024_f32(
+  riscv_rfft_fast_instance_f32 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_1024_f32);
+  riscv_cfft_instance_f32 * Sint = &(S->Sint);
+
+  Sint->fftLen = 512u;
+  S->fftLenRFFT = 1024u;
+  Sint->bitRevLength = RISCVBITREVINDEXTABLE_512_TABLE_LENGTH;
+  Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable512;
+  Sint->pTwiddle     = (float32_t *) RISCV_CFFT_TWIDDLE_F32(512);
+  S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_1024;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(1024)
+/**   
+* @brief  Initialization function for the 2048-point floating-point real FFT.  
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_f32 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.  
+*   
+* Only references the tables of the 2048-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+riscv_status riscv_rfft_fast_init_2048_f32(
+  riscv_rfft_fast_instance_f32 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_2048_f32);
+  riscv_cfft_instance_f32 * Sint = &(S->Sint);
+
+  Sint->fftLen = 1024u;
+  S->fftLenRFFT = 2048u;
+  Sint->bitRevLength = RISCVBITREVINDEXTABLE1024_TABLE_LENGTH;
+  Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable1024;
+  Sint->pTwiddle     = (float32_t *) RISCV_CFFT_TWIDDLE_F32(1024);
+  S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_2048;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(2048)
+/**   
+* @brief  Initialization function for the 4096-point floating-point real FFT.  
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_f32 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.  
+*   
+* Only references the tables of the 4096-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+riscv_status riscv_rfft_fast_init_4096_f32(
+  riscv_rfft_fast_instance_f32 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_4096_f32);
+  riscv_cfft_instance_f32 * Sint = &(S->Sint);
+
+  Sint->fftLen = 2048u;
+  S->fftLenRFFT = 4096u;
+  Sint->bitRevLength = RISCVBITREVINDEXTABLE2048_TABLE_LENGTH;
+  Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable2048;
+  Sint->pTwiddle     = (float32_t *) RISCV_CFFT_TWIDDLE_F32(2048);
+  S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_4096;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
 /**   
 * @brief  Initialization function for the floating-point real FFT.  
 * @param[in,out] *S             points to an riscv_rfft_fast_instance_f32 structure.
 * @param[in]     fftLen         length of the Real Sequence.  
-* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.  
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.  
 *   
 * \par Description:  
 * \par   
 * The parameter <code>fftLen</code>	Specifies length of RFFT/CIFFT process. Supported FFT Lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096.   
 * \par   
 * This Function also initializes Twiddle factor table pointer and Bit reversal table pointer.   
+* \par   
+* As the length is only known at run time, this function references the tables of every supported length.
+* When the length is fixed, the riscv_rfft_fast_init_<fftLen>_f32() functions link the tables of that length only.
 */
 riscv_status riscv_rfft_fast_init_f32(
   riscv_rfft_fast_instance_f32 * S,
   uint16_t fftLen)
 {
-  riscv_cfft_instance_f32 * Sint;
+  RISCV_PROFILE(riscv_rfft_fast_init_f32);
   /*  Initialise the default riscv status */
   riscv_status status = RISCV_MATH_SUCCESS;
-  /*  Initialise the FFT length */
-  Sint = &(S->Sint);
-  Sint->fftLen = fftLen/2;
-  S->fftLenRFFT = fftLen;
 
   /*  Initializations of structure parameters depending on the FFT length */
-  switch (Sint->fftLen)
+  switch (fftLen)
   {
+#if RISCV_DSP_FFT_LEN(2048)
+  case 4096u:
+    status = riscv_rfft_fast_init_4096_f32(S);
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(1024)
   case 2048u:
-    /*  Initializations of structure parameters for 2048 point FFT */
-    /*  Initialise the bit reversal table length */
-    Sint->bitRevLength = RISCVBITREVINDEXTABLE2048_TABLE_LENGTH;
-    /*  Initialise the bit reversal table pointer */
-    Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable2048;
-    /*  Initialise the Twiddle coefficient pointers */
-		Sint->pTwiddle     = (float32_t *) twiddleCoef_2048;
-		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_4096;
+    status = riscv_rfft_fast_init_2048_f32(S);
     break;
+#endif
+#if RISCV_DSP_FFT_LEN(512)
   case 1024u:
-    Sint->bitRevLength = RISCVBITREVINDEXTABLE1024_TABLE_LENGTH;
-    Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable1024;
-		Sint->pTwiddle     = (float32_t *) twiddleCoef_1024;
-		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_2048;
+    status = riscv_rfft_fast_init_1024_f32(S);
     break;
+#endif
+#if RISCV_DSP_FFT_LEN(256)
   case 512u:
-    Sint->bitRevLength = RISCVBITREVINDEXTABLE_512_TABLE_LENGTH;
-    Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable512;
-		Sint->pTwiddle     = (float32_t *) twiddleCoef_512;
-		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_1024;
+    status = riscv_rfft_fast_init_512_f32(S);
     break;
+#endif
+#if RISCV_DSP_FFT_LEN(128)
   case 256u:
-    Sint->bitRevLength = RISCVBITREVINDEXTABLE_256_TABLE_LENGTH;
-    Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable256;
-		Sint->pTwiddle     = (float32_t *) twiddleCoef_256;
-		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_512;
+    status = riscv_rfft_fast_init_256_f32(S);
     break;
+#endif
+#if RISCV_DSP_FFT_LEN(64)
   case 128u:
-    Sint->bitRevLength = RISCVBITREVINDEXTABLE_128_TABLE_LENGTH;
-    Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable128;
-		Sint->pTwiddle     = (float32_t *) twiddleCoef_128;
-		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_256;
+    status = riscv_rfft_fast_init_128_f32(S);
     break;
+#endif
+#if RISCV_DSP_FFT_LEN(32)
   case 64u:
-    Sint->bitRevLength = RISCVBITREVINDEXTABLE__64_TABLE_LENGTH;
-    Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable64;
-		Sint->pTwiddle     = (float32_t *) twiddleCoef_64;
-		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_128;
+    status = riscv_rfft_fast_init_64_f32(S);
     break;
+#endif
+#if RISCV_DSP_FFT_LEN(16)
   case 32u:
-    Sint->bitRevLength = RISCVBITREVINDEXTABLE__32_TABLE_LENGTH;
-    Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable32;
-		Sint->pTwiddle     = (float32_t *) twiddleCoef_32;
-		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_64;
-    break;
-  case 16u:
-    Sint->bitRevLength = RISCVBITREVINDEXTABLE__16_TABLE_LENGTH;
-    Sint->pBitRevTable = (uint16_t *)riscvBitRevIndexTable16;
-		Sint->pTwiddle     = (float32_t *) twiddleCoef_16;
-		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_32;
+    status = riscv_rfft_fast_init_32_f32(S);
     break;
+#endif
   default:
     /*  Reporting argument error if fftSize is not valid value */
     status = RISCV_MATH_ARGUMENT_ERROR;
@@ -0,0 +1,267 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_rfft_fast_init_q31.c
+*
+* Description:  Initialization functions for the Q31 fast real FFT.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+#include <riscv_dsp/riscv_const_structs.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+#if RISCV_DSP_FFT_LEN(16)
+/**
+* @brief  Initialization function for the 32-point Q31 fast real FFT.
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_q31 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.
+*
+* Only references the tables of the 32-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+
+riscv_status riscv_rfft_fast_init_32_q31(
+  riscv_rfft_fast_instance_q31 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_32_q31);
+  S->Sint = riscv_cfft_sR_q31_len16;
+  S->fftLenRFFT = 32u;
+  S->pTwiddleRFFT = (q31_t *) twiddleCoef_rfft_32_q31;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(32)
+/**
+* @brief  Initialization function for the 64-point Q31 fast real FFT.
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_q31 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.
+*
+* Only references the tables of the 64-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+
+riscv_status riscv_rfft_fast_init_64_q31(
+  riscv_rfft_fast_instance_q31 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_64_q31);
+  S->Sint = riscv_cfft_sR_q31_len32;
+  S->fftLenRFFT = 64u;
+  S->pTwiddleRFFT = (q31_t *) twiddleCoef_rfft_64_q31;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(64)
+/**
+* @brief  Initialization function for the 128-point Q31 fast real FFT.
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_q31 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.
+*
+* Only references the tables of the 128-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+
+riscv_status riscv_rfft_fast_init_128_q31(
+  riscv_rfft_fast_instance_q31 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_128_q31);
+  S->Sint = riscv_cfft_sR_q31_len64;
+  S->fftLenRFFT = 128u;
+  S->pTwiddleRFFT = (q31_t *) twiddleCoef_rfft_128_q31;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(128)
+/**
+* @brief  Initialization function for the 256-point Q31 fast real FFT.
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_q31 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.
+*
+* Only references the tables of the 256-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+
+riscv_status riscv_rfft_fast_init_256_q31(
+  riscv_rfft_fast_instance_q31 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_256_q31);
+  S->Sint = riscv_cfft_sR_q31_len128;
+  S->fftLenRFFT = 256u;
+  S->pTwiddleRFFT = (q31_t *) twiddleCoef_rfft_256_q31;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(256)
+/**
+* @brief  Initialization function for the 512-point Q31 fast real FFT.
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_q31 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.
+*
+* Only references the tables of the 512-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+
+riscv_status riscv_rfft_fast_init_512_q31(
+  riscv_rfft_fast_instance_q31 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_512_q31);
+  S->Sint = riscv_cfft_sR_q31_len256;
+  S->fftLenRFFT = 512u;
+  S->pTwiddleRFFT = (q31_t *) twiddleCoef_rfft_512_q31;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(512)
+/**
+* @brief  Initialization function for the 1024-point Q31 fast real FFT.
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_q31 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.
+*
+* Only references the tables of the 1024-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+
+riscv_status riscv_rfft_fast_init_1024_q31(
+  riscv_rfft_fast_instance_q31 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_1024_q31);
+  S->Sint = riscv_cfft_sR_q31_len512;
+  S->fftLenRFFT = 1024u;
+  S->pTwiddleRFFT = (q31_t *) twiddleCoef_rfft_1024_q31;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(1024)
+/**
+* @brief  Initialization function for the 2048-point Q31 fast real FFT.
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_q31 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.
+*
+* Only references the tables of the 2048-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+
+riscv_status riscv_rfft_fast_init_2048_q31(
+  riscv_rfft_fast_instance_q31 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_2048_q31);
+  S->Sint = riscv_cfft_sR_q31_len1024;
+  S->fftLenRFFT = 2048u;
+  S->pTwiddleRFFT = (q31_t *) twiddleCoef_rfft_2048_q31;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+#if RISCV_DSP_FFT_LEN(2048)
+/**
+* @brief  Initialization function for the 4096-point Q31 fast real FFT.
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_q31 structure.
+* @return        The function returns RISCV_MATH_SUCCESS.
+*
+* Only references the tables of the 4096-point transform, so linking it with -Wl,--gc-sections does not pull in the tables of the other lengths.
+*/
+
+riscv_status riscv_rfft_fast_init_4096_q31(
+  riscv_rfft_fast_instance_q31 * S)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_4096_q31);
+  S->Sint = riscv_cfft_sR_q31_len2048;
+  S->fftLenRFFT = 4096u;
+  S->pTwiddleRFFT = (q31_t *) twiddleCoef_rfft_4096_q31;
+
+  return (RISCV_MATH_SUCCESS);
+}
+#endif
+
+/**
+* @brief  Initialization function for the Q31 fast real FFT.
+* @param[in,out] *S             points to an riscv_rfft_fast_instance_q31 structure.
+* @param[in]     fftLen         length of the Real Sequence.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* The parameter <code>fftLen</code>	Specifies length of RFFT/CIFFT process. Supported FFT Lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096.
+* \par
+* The instance only holds the CFFT instance of half the length and a twiddle table of <code>fftLen</code> words,
+* instead of the realCoefAQ31 and realCoefBQ31 tables of riscv_rfft_init_q31().
+*/
+
+riscv_status riscv_rfft_fast_init_q31(
+  riscv_rfft_fast_instance_q31 * S,
+  uint16_t fftLen)
+{
+  RISCV_PROFILE(riscv_rfft_fast_init_q31);
+  /*  Initialise the default riscv status */
+  riscv_status status = RISCV_MATH_SUCCESS;
+
+  /*  Initializations of structure parameters depending on the FFT length */
+  switch (fftLen)
+  {
+#if RISCV_DSP_FFT_LEN(2048)
+  case 4096u:
+    status = riscv_rfft_fast_init_4096_q31(S);
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(1024)
+  case 2048u:
+    status = riscv_rfft_fast_init_2048_q31(S);
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(512)
+  case 1024u:
+    status = riscv_rfft_fast_init_1024_q31(S);
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(256)
+  case 512u:
+    status = riscv_rfft_fast_init_512_q31(S);
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(128)
+  case 256u:
+    status = riscv_rfft_fast_init_256_q31(S);
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(64)
+  case 128u:
+    status = riscv_rfft_fast_init_128_q31(S);
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(32)
+  case 64u:
+    status = riscv_rfft_fast_init_64_q31(S);
+    break;
+#endif
+#if RISCV_DSP_FFT_LEN(16)
+  case 32u:
+    status = riscv_rfft_fast_init_32_q31(S);
+    break;
+#endif
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    status = RISCV_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  return (status);
+}
+
+/**
+* @} end of RealFFT group
+*/
@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_rfft_fast_q31.c
+*
+* Description:  Q31 real FFT computed with a half-length complex FFT and a
+*               packed-real split stage.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/*
+* The split coefficients of riscv_split_rfft_q31() are derived on the fly from
+* the RFFT twiddle factor tw(k) = (sin(2*pi*k/N), cos(2*pi*k/N)):
+*   A1 = 0.5 * (1 - sin),  A2 = -0.5 * cos,  B1 = 0.5 * (1 + sin)
+* which replaces the realCoefAQ31 and realCoefBQ31 tables.
+*/
+
+/* Prepares the output of the forward transform from the CFFT of the packed data */
+static void stage_rfft_q31(
+  riscv_rfft_fast_instance_q31 * S,
+  q31_t * p, q31_t * pOut)
+{
+   uint32_t  k;                             /* Loop Counter                     */
+   uint32_t  L = (S->Sint).fftLen;          /* Length of the complex FFT        */
+   q31_t *pCoeff = S->pTwiddleRFFT + 2;     /* Points to RFFT Twiddle factors   */
+   q31_t *pIn1 = p + 2;                     /* increasing pointer               */
+   q31_t *pIn2 = p + (2u * L) - 1u;         /* decreasing pointer               */
+   q31_t CoefA1, CoefA2, CoefB1;            /* Split coefficients               */
+   q31_t outR, outI;                        /* Temporary variables for output   */
+
+   /* DC and Nyquist bins are real, pack them in the first complex sample */
+   pOut[0] = (p[0] + p[1]) >> 1;
+   pOut[1] = (p[0] - p[1]) >> 1;
+   pOut += 2;
+
+   k = L - 1u;
+
+   while(k > 0u)
+   {
+      CoefA1 = 0x40000000 - (pCoeff[0] >> 1);
+      CoefA2 = -(pCoeff[1] >> 1);
+      CoefB1 = 0x40000000 + (pCoeff[0] >> 1);
+      pCoeff += 2;
+
+      /* outR = pIn1[0] * A1 - pIn1[1] * A2 + pIn2[0] * B1 - pIn2[1] * A2 */
+      /* outI = pIn1[1] * A1 + pIn1[0] * A2 - pIn2[1] * B1 - pIn2[0] * A2 */
+      mult_32x32_keep32_R(outR, *pIn1, CoefA1);
+      mult_32x32_keep32_R(outI, *pIn1++, CoefA2);
+      multSub_32x32_keep32_R(outR, *pIn1, CoefA2);
+      multAcc_32x32_keep32_R(outI, *pIn1++, CoefA1);
+      multSub_32x32_keep32_R(outR, *pIn2, CoefA2);
+      multSub_32x32_keep32_R(outI, *pIn2--, CoefB1);
+      multAcc_32x32_keep32_R(outR, *pIn2, CoefB1);
+      multSub_32x32_keep32_R(outI, *pIn2--, CoefA2);
+
+      *pOut++ = outR;
+      *pOut++ = outI;
+
+      k--;
+   }
+}
+
+/* Prepares the packed spectrum for the inverse CFFT */
+static void merge_rfft_q31(
+  riscv_rfft_fast_instance_q31 * S,
+  q31_t * p, q31_t * pOut)
+{
+   uint32_t  k;                             /* Loop Counter                     */
+   uint32_t  L = (S->Sint).fftLen;          /* Length of the complex FFT        */
+   q31_t *pCoeff = S->pTwiddleRFFT + 2;     /* Points to RFFT Twiddle factors   */
+   q31_t *pIn1 = p + 2;                     /* increasing pointer               */
+   q31_t *pIn2 = p + (2u * L) - 1u;         /* decreasing pointer               */
+   q31_t CoefA1, CoefA2, CoefB1;            /* Split coefficients               */
+   q31_t outR, outI;                        /* Temporary variables for output   */
+
+   /* Unpack the real DC and Nyquist bins */
+   pOut[0] = (q31_t) (((q63_t) p[0] + p[1]) >> 2);
+   pOut[1] = (q31_t) (((q63_t) p[0] - p[1]) >> 2);
+   pOut += 2;
+
+   k = L - 1u;
+
+   while(k > 0u)
+   {
+      CoefA1 = 0x40000000 - (pCoeff[0] >> 1);
+      CoefA2 = -(pCoeff[1] >> 1);
+      CoefB1 = 0x40000000 + (pCoeff[0] >> 1);
+      pCoeff += 2;
+
+      /* outR = pIn1[0] * A1 + pIn1[1] * A2 + pIn2[0] * B1 + pIn2[1] * A2 */
+      /* outI = pIn1[1] * A1 - pIn1[0] * A2 - pIn2[1] * B1 + pIn2[0] * A2 */
+      mult_32x32_keep32_R(outR, *pIn1, CoefA1);
+      mult_32x32_keep32_R(outI, *pIn1++, -CoefA2);
+      multAcc_32x32_keep32_R(outR, *pIn1, CoefA2);
+      multAcc_32x32_keep32_R(outI, *pIn1++, CoefA1);
+      multAcc_32x32_keep32_R(outR, *pIn2, CoefA2);
+      multSub_32x32_keep32_R(outI, *pIn2--, CoefB1);
+      multAcc_32x32_keep32_R(outR, *pIn2, CoefB1);
+      multAcc_32x32_keep32_R(outI, *pIn2--, CoefA2);
+
+      *pOut++ = outR;
+      *pOut++ = outI;
+
+      k--;
+   }
+}
+
+/**
+* @ingroup groupTransforms
+*/
+
+/**
+* @addtogroup RealFFT
+* @{
+*/
+
+/**
+* @brief Processing function for the Q31 fast real FFT.
+* @param[in]  *S              points to an riscv_rfft_fast_instance_q31 structure.
+* @param[in]  *p              points to the input buffer, it is modified by the function.
+* @param[out] *pOut           points to the output buffer.
+* @param[in]  ifftFlag        RFFT if flag is 0, RIFFT if flag is 1
+* @return none.
+*
+* \par
+* Works as riscv_rfft_fast_f32(): a real sequence of <code>fftLenRFFT</code> samples is transformed
+* with a CFFT of <code>fftLenRFFT/2</code> points, and the spectrum is stored as <code>fftLenRFFT/2</code>
+* complex values where the real parts of the DC and Nyquist bins share the first one,
+* <code>pOut[0]</code> = X[0] and <code>pOut[1]</code> = X[fftLenRFFT/2]. The inverse transform
+* reads the same layout.
+* \par
+* The scaling is the one of riscv_rfft_q31() for the same length, so the input and output format
+* tables of riscv_rfft_q31() apply.
+*/
+
+void riscv_rfft_fast_q31(
+riscv_rfft_fast_instance_q31 * S,
+q31_t * p, q31_t * pOut,
+uint8_t ifftFlag)
+{
+  RISCV_PROFILE(riscv_rfft_fast_q31);
+   riscv_cfft_instance_q31 * Sint = &(S->Sint);
+   uint32_t i;
+
+   /* Calculation of Real FFT */
+   if(ifftFlag)
+   {
+      /*  Real FFT compression */
+      merge_rfft_q31(S, p, pOut);
+
+      /* Complex IFFT process */
+      riscv_cfft_q31( Sint, pOut, ifftFlag, 1);
+
+      for(i = 0; i < S->fftLenRFFT; i++)
+      {
+         pOut[i] = pOut[i] << 1;
+      }
+   }
+   else
+   {
+      /* Calculation of RFFT of input */
+      riscv_cfft_q31( Sint, p, ifftFlag, 1);
+
+      /*  Real FFT extraction */
+      stage_rfft_q31(S, p, pOut);
+   }
+}
+
+/**
+* @} end of RealFFT group
+*/
@@ -8310,6 +8310,7 @@ riscv_status riscv_rfft_init_f32(
   uint32_t ifftFlagR,
   uint32_t bitReverseFlag)
 {
+  RISCV_PROFILE(riscv_rfft_init_f32);
 
   /*  Initialise the default riscv status */
   riscv_status status = RISCV_MATH_SUCCESS;
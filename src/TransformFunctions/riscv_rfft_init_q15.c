@@ -2166,6 +2166,7 @@ riscv_status riscv_rfft_init_q15(
     uint32_t ifftFlagR,
     uint32_t bitReverseFlag)
 {
+  RISCV_PROFILE(riscv_rfft_init_q15);
     /*  Initialise the default riscv status */
     riscv_status status = RISCV_MATH_SUCCESS;
 
@@ -2187,42 +2188,60 @@ riscv_status riscv_rfft_init_q15(
     /*  Initialization of coef modifier depending on the FFT length */
     switch (S->fftLenReal)
     {
+#if RISCV_DSP_FFT_LEN(4096)
     case 8192u:
         S->twidCoefRModifier = 1u;
         S->pCfft = &riscv_cfft_sR_q15_len4096;
         break;
+#endif
+#if RISCV_DSP_FFT_LEN(2048)
     case 4096u:
         S->twidCoefRModifier = 2u;
         S->pCfft = &riscv_cfft_sR_q15_len2048;
         break;
+#endif
+#if RISCV_DSP_FFT_LEN(1024)
     case 2048u:
         S->twidCoefRModifier = 4u;
         S->pCfft = &riscv_cfft_sR_q15_len1024;
         break;
+#endif
+#if RISCV_DSP_FFT_LEN(512)
     case 1024u:
         S->twidCoefRModifier = 8u;
         S->pCfft = &riscv_cfft_sR_q15_len512;
         break;
+#endif
+#if RISCV_DSP_FFT_LEN(256)
     case 512u:
         S->twidCoefRModifier = 16u;
         S->pCfft = &riscv_cfft_sR_q15_len256;
         break;
+#endif
+#if RISCV_DSP_FFT_LEN(128)
     case 256u:
         S->twidCoefRModifier = 32u;
         S->pCfft = &riscv_cfft_sR_q15_len128;
         break;
+#endif
+#if RISCV_DSP_FFT_LEN(64)
     case 128u:
         S->twidCoefRModifier = 64u;
         S->pCfft = &riscv_cfft_sR_q15_len64;
         break;
+#endif
+#if RISCV_DSP_FFT_LEN(32)
     case 64u:
         S->twidCoefRModifier = 128u;
         S->pCfft = &riscv_cfft_sR_q15_len32;
         break;
+#endif
+#if RISCV_DSP_FFT_LEN(16)
     case 32u:
         S->twidCoefRModifier = 256u;
         S->pCfft = &riscv_cfft_sR_q15_len16;
         break;
+#endif
     default:
         /*  Reporting argument error if rfftSize is not valid value */
         status = RISCV_MATH_ARGUMENT_ERROR;
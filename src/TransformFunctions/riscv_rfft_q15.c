@@ -91,6 +91,7 @@ void riscv_rfft_q15(
     q15_t * pSrc,
     q15_t * pDst)
 {
+  RISCV_PROFILE(riscv_rfft_q15);
     const riscv_cfft_instance_q15 *S_CFFT = S->pCfft;
     uint32_t i;
     uint32_t L2 = S->fftLenReal >> 1;
@@ -150,6 +151,13 @@ void riscv_split_rfft_q15(
     q31_t outR, outI;                              /* Temporary variables for output */
     q15_t *pCoefA, *pCoefB;                        /* Temporary pointers for twiddle factors */
     q15_t *pSrc1, *pSrc2;
+#if defined (USE_DSP_RISCV)
+    shortV A, B, nA, nB;                           /* Twiddle factors and their negations */
+    shortV Ac, As, Bq;                             /* (Ar, -Ai), (Ai, Ar) and (Bi, -Br) */
+    shortV conjMask = { 0, 3 };                    /* Shuffle mask for (re, -im) */
+    shortV swapMask = { 1, 0 };                    /* Shuffle mask for (im, re) */
+    shortV rotMask = { 1, 2 };                     /* Shuffle mask for (im, -re) */
+#endif
 
 
     //  pSrc[2u * fftLen] = pSrc[0]; 
@@ -164,6 +172,35 @@ void riscv_split_rfft_q15(
 
     while(i < fftLen)
     {
+#if defined (USE_DSP_RISCV)
+        A = *(shortV *) pCoefA;
+        B = *(shortV *) pCoefB;
+        nA = neg2(A);
+        nB = neg2(B);
+        Ac = shufflev4(A, nA, conjMask);
+        As = shufflev4(A, A, swapMask);
+        Bq = shufflev4(B, nB, rotMask);
+
+        /* outR = pSrc1 . (Ar, -Ai) + pSrc2 . (Br, Bi) */
+        outR = sumdotpv2(*(shortV *) pSrc2, B, dotpv2(*(shortV *) pSrc1, Ac)) >> 16;
+
+        /* outI = pSrc1 . (Ai, Ar) + pSrc2 . (Bi, -Br) */
+        outI = sumdotpv2(*(shortV *) pSrc1, As, dotpv2(*(shortV *) pSrc2, Bq)) >> 16;
+
+        /* update input pointers */
+        pSrc1 += 2u;
+        pSrc2 -= 2u;
+
+        /* write output and its complex conjugate */
+        *(shortV *) &pDst[2u * i] = pack2(outR, outI);
+        *(shortV *) &pDst[(4u * fftLen) - (2u * i)] = pack2(outR, -outI);
+
+        /* update coefficient pointer */
+        pCoefB = pCoefB + (2u * modifier);
+        pCoefA = pCoefA + (2u * modifier);
+
+        i++;
+#else
         /*    
         outR = (pSrc[2 * i] * pATable[2 * i] - pSrc[2 * i + 1] * pATable[2 * i + 1]    
         + pSrc[2 * n - 2 * i] * pBTable[2 * i] +    
@@ -203,6 +240,7 @@ void riscv_split_rfft_q15(
         pCoefA = pCoefA + (2u * modifier);
 
         i++;
+#endif
     }
 
     pDst[2u * fftLen] = (pSrc[0] - pSrc[1]) >> 1;
@@ -238,6 +276,13 @@ void riscv_split_rifft_q15(
     q15_t *pCoefA, *pCoefB;                        /* Temporary pointers for twiddle factors */
     q15_t *pSrc1, *pSrc2;
     q15_t *pDst1 = &pDst[0];
+#if defined (USE_DSP_RISCV)
+    shortV A, B, nA, nB;                           /* Twiddle factors and their negations */
+    shortV Bc, Ar, nBs;                            /* (Br, -Bi), (-Ai, Ar) and (-Bi, -Br) */
+    shortV conjMask = { 0, 3 };                    /* Shuffle mask for (re, -im) */
+    shortV rotMask = { 3, 0 };                     /* Shuffle mask for (-im, re) */
+    shortV swapMask = { 1, 0 };                    /* Shuffle mask for (im, re) */
+#endif
 
     pCoefA = &pATable[0];
     pCoefB = &pBTable[0];
@@ -248,6 +293,35 @@ void riscv_split_rifft_q15(
 
     while(i > 0u)
     {
+#if defined (USE_DSP_RISCV)
+        A = *(shortV *) pCoefA;
+        B = *(shortV *) pCoefB;
+        nA = neg2(A);
+        nB = neg2(B);
+        Bc = shufflev4(B, nB, conjMask);
+        Ar = shufflev4(A, nA, rotMask);
+        nBs = shufflev4(nB, nB, swapMask);
+
+        /* outR = pSrc2 . (Br, -Bi) + pSrc1 . (Ar, Ai) */
+        outR = sumdotpv2(*(shortV *) pSrc1, A, dotpv2(*(shortV *) pSrc2, Bc)) >> 16;
+
+        /* outI = pSrc1 . (-Ai, Ar) + pSrc2 . (-Bi, -Br) */
+        outI = sumdotpv2(*(shortV *) pSrc2, nBs, dotpv2(*(shortV *) pSrc1, Ar)) >> 16;
+
+        /* update input pointers */
+        pSrc1 += 2u;
+        pSrc2 -= 2u;
+
+        /* write output */
+        *(shortV *) pDst1 = pack2(outR, outI);
+        pDst1 += 2u;
+
+        /* update coefficient pointer */
+        pCoefB = pCoefB + (2u * modifier);
+        pCoefA = pCoefA + (2u * modifier);
+
+        i--;
+#else
         /*    
         outR = (pIn[2 * i] * pATable[2 * i] + pIn[2 * i + 1] * pATable[2 * i + 1] +    
         pIn[2 * n - 2 * i] * pBTable[2 * i] -    
@@ -283,6 +357,7 @@ void riscv_split_rifft_q15(
         pCoefA = pCoefA + (2u * modifier);
 
         i--;
+#endif
     }
 
 }
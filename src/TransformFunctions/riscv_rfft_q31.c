@@ -91,6 +91,7 @@ void riscv_rfft_q31(
     q31_t * pSrc,
     q31_t * pDst)
 {
+  RISCV_PROFILE(riscv_rfft_q31);
     const riscv_cfft_instance_q31 *S_CFFT = S->pCfft;
     uint32_t i;
     uint32_t L2 = S->fftLenReal >> 1;
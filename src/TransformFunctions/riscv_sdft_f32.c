@@ -0,0 +1,210 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sdft_f32.c
+*
+* Description:  Floating-point sliding DFT.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup SlidingDFT Sliding DFT
+ *
+ * \par
+ * The sliding DFT keeps a few bins of the DFT of the last <code>fftLen</code> samples up to date
+ * with every new sample.  A bin costs one complex multiply-accumulate per sample, independent of
+ * <code>fftLen</code>, so the bins can be watched on every sample instead of once per FFT frame.
+ * The samples of the window are kept in a delay line of <code>fftLen</code> values.
+ * \par
+ * The functions use the modulated form of the sliding DFT.  With j the index of a sample modulo
+ * <code>fftLen</code>, bin k accumulates
+ * <pre>
+ *    Y[k] += (x[j] - x[j-fftLen]) * exp(-i*2*pi*k*j/fftLen)
+ * </pre>
+ * and the bin of the window that starts at sample s is <code>X[k] = Y[k] * exp(i*2*pi*k*s/fftLen)</code>.
+ * Unlike the recursion <code>X[k] = (X[k] + x[n] - x[n-fftLen]) * exp(i*2*pi*k/fftLen)</code>
+ * the bins are never multiplied by a twiddle factor, so rounding errors are not fed back and a
+ * twiddle factor with a magnitude other than 1 cannot make the bins grow or decay.
+ * \par
+ * The processing function takes a block of samples and writes the bins of the window ending at the
+ * last sample of the block, as interleaved <code>{real, imag}</code> values.  They equal the bins
+ * <code>k</code> of riscv_cfft_f32() applied to the window, and the Q15 bins equal those of
+ * riscv_cfft_q15(), which are scaled by <code>1/fftLen</code>.
+ * \par Fixed-point behavior
+ * The Q15 function rounds the input to Q15 scaled by <code>1/fftLen</code> before it enters the
+ * delay line, which limits the accuracy in the same way as the scaling of riscv_cfft_q15().
+ * The accumulators are Q31 and hold the exact sum of the products of the window, so a sample adds
+ * exactly what it subtracts <code>fftLen</code> samples later and there is no drift however long
+ * the function runs.
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+* @brief  Processing function for the floating-point sliding DFT.
+* @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.
+* @param[in]     *pSrc      points to the block of input samples.
+* @param[out]    *pDst      points to the <code>2*numBins</code> output values.
+* @param[in]     blockSize  number of samples to process.
+* @return none.
+*/
+
+void riscv_sdft_f32(
+  riscv_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_sdft_f32);
+  const float32_t *pW = S->pTwiddle;             /* Twiddle table {cos, sin} of fftLen entries */
+  const uint16_t *pBin;                          /* Bin index pointer */
+  const float32_t *pIn;                          /* Input pointer */
+  float32_t *pState;                             /* Accumulator pointer */
+  float32_t *pDelay = S->pDelay;                 /* Delay line */
+  float32_t d;                                   /* x[j] - x[j-fftLen] */
+  float32_t re0, im0, re1, im1;                  /* Accumulators of two bins */
+  uint32_t fftLen = S->fftLen;
+  uint32_t idx = S->delayIndex;                  /* Oldest sample of the delay line, the index j */
+  uint32_t k0, k1, m0, m1, i;                    /* Bins and their twiddle indexes */
+  uint32_t blkCnt, len, bin, cnt;                /* Loop counters */
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /*  A chunk of at most fftLen samples only subtracts samples of the delay line */
+    len = (blkCnt < fftLen) ? blkCnt : fftLen;
+
+    pBin = S->pBins;
+    pState = S->pState;
+
+    /*  Two bins per pass share every input and delay line load */
+    for (bin = (uint32_t) S->numBins >> 1u; bin > 0u; bin--)
+    {
+      k0 = pBin[0];
+      k1 = pBin[1];
+      m0 = (k0 * idx) % fftLen;
+      m1 = (k1 * idx) % fftLen;
+      re0 = pState[0];
+      im0 = pState[1];
+      re1 = pState[2];
+      im1 = pState[3];
+
+      pIn = pSrc;
+      i = idx;
+
+      for (cnt = len; cnt > 0u; cnt--)
+      {
+        d = *pIn++ - pDelay[i];
+        i++;
+        if(i == fftLen)
+        {
+          i = 0u;
+        }
+
+        /*  Y += d * exp(-i*2*pi*k*j/fftLen) */
+        re0 += d * pW[2u * m0];
+        im0 -= d * pW[(2u * m0) + 1u];
+        re1 += d * pW[2u * m1];
+        im1 -= d * pW[(2u * m1) + 1u];
+
+        m0 += k0;
+        if(m0 >= fftLen)
+        {
+          m0 -= fftLen;
+        }
+        m1 += k1;
+        if(m1 >= fftLen)
+        {
+          m1 -= fftLen;
+        }
+      }
+
+      pState[0] = re0;
+      pState[1] = im0;
+      pState[2] = re1;
+      pState[3] = im1;
+
+      pBin += 2u;
+      pState += 4u;
+    }
+
+    /*  Last bin of an odd number of bins */
+    if((S->numBins & 1u) != 0u)
+    {
+      k0 = pBin[0];
+      m0 = (k0 * idx) % fftLen;
+      re0 = pState[0];
+      im0 = pState[1];
+
+      pIn = pSrc;
+      i = idx;
+
+      for (cnt = len; cnt > 0u; cnt--)
+      {
+        d = *pIn++ - pDelay[i];
+        i++;
+        if(i == fftLen)
+        {
+          i = 0u;
+        }
+
+        re0 += d * pW[2u * m0];
+        im0 -= d * pW[(2u * m0) + 1u];
+
+        m0 += k0;
+        if(m0 >= fftLen)
+        {
+          m0 -= fftLen;
+        }
+      }
+
+      pState[0] = re0;
+      pState[1] = im0;
+    }
+
+    /*  Push the chunk into the delay line */
+    for (cnt = len; cnt > 0u; cnt--)
+    {
+      pDelay[idx] = *pSrc++;
+      idx++;
+      if(idx == fftLen)
+      {
+        idx = 0u;
+      }
+    }
+
+    blkCnt -= len;
+  }
+
+  S->delayIndex = (uint16_t) idx;
+
+  /*  X = Y * exp(i*2*pi*k*s/fftLen) for the window starting at s = idx */
+  pBin = S->pBins;
+  pState = S->pState;
+
+  for (bin = S->numBins; bin > 0u; bin--)
+  {
+    m0 = ((uint32_t) *pBin++ * idx) % fftLen;
+    re0 = pState[0];
+    im0 = pState[1];
+
+    *pDst++ = (re0 * pW[2u * m0]) - (im0 * pW[(2u * m0) + 1u]);
+    *pDst++ = (re0 * pW[(2u * m0) + 1u]) + (im0 * pW[2u * m0]);
+
+    pState += 2u;
+  }
+}
+
+/**
+* @} end of SlidingDFT group
+*/
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sdft_init_f32.c
+*
+* Description:  Initialization function for the floating-point sliding DFT.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point sliding DFT.
+* @param[out]    *S         points to an instance of the floating-point sliding DFT structure.
+* @param[in]     fftLen     length of the window.
+* @param[in]     numBins    number of bins.
+* @param[in]     *pBins     points to the <code>numBins</code> bin indexes, from 0 to <code>fftLen-1</code>.
+* @param[out]    *pTwiddle  points to a buffer of <code>2*fftLen</code> words that receives the twiddle factors.
+* @param[out]    *pState    points to a buffer of <code>2*numBins</code> words for the accumulators.
+* @param[out]    *pDelay    points to a buffer of <code>fftLen</code> words for the delay line.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>fftLen</code> is smaller than 2, <code>numBins</code> is 0 or a bin index is not smaller than <code>fftLen</code>.
+*
+* \par Description:
+* <code>pTwiddle[2*m]</code> = cos(2*pi*m/fftLen) and <code>pTwiddle[2*m+1]</code> = sin(2*pi*m/fftLen) for m = 0, 1, ..., fftLen-1.
+* The accumulators and the delay line are cleared, so the window starts with <code>fftLen</code> zeros.
+* The bin indexes and the buffers must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_sdft_init_f32(
+  riscv_sdft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  float32_t * pTwiddle,
+  float32_t * pState,
+  float32_t * pDelay)
+{
+  RISCV_PROFILE(riscv_sdft_init_f32);
+  uint32_t m;
+  float64_t phase;
+
+  if((fftLen < 2u) || (numBins == 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (m = 0u; m < numBins; m++)
+  {
+    if(pBins[m] >= fftLen)
+    {
+      return (RISCV_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  /*  Compute the twiddle factors of one turn */
+  for (m = 0u; m < fftLen; m++)
+  {
+    phase = (6.283185307179586 * (float64_t) m) / (float64_t) fftLen;
+    pTwiddle[2u * m] = (float32_t) cos(phase);
+    pTwiddle[(2u * m) + 1u] = (float32_t) sin(phase);
+  }
+
+  S->fftLen = fftLen;
+  S->numBins = numBins;
+  S->delayIndex = 0u;
+  S->pBins = pBins;
+  S->pTwiddle = pTwiddle;
+  S->pState = pState;
+  S->pDelay = pDelay;
+
+  /*  Clear the accumulators and the delay line */
+  riscv_fill_f32(0.0f, pState, 2u * (uint32_t) numBins);
+  riscv_fill_f32(0.0f, pDelay, fftLen);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of SlidingDFT group
+*/
@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sdft_init_q15.c
+*
+* Description:  Initialization function for the Q15 sliding DFT.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q15 sliding DFT.
+* @param[out]    *S         points to an instance of the Q15 sliding DFT structure.
+* @param[in]     fftLen     length of the window, a power of two from 16 to 4096.
+* @param[in]     numBins    number of bins.
+* @param[in]     *pBins     points to the <code>numBins</code> bin indexes, from 0 to <code>fftLen-1</code>.
+* @param[out]    *pTwiddle  points to a buffer of <code>2*fftLen</code> values, aligned to 32 bits, that receives the twiddle factors.
+* @param[out]    *pState    points to a buffer of <code>2*numBins</code> words for the accumulators.
+* @param[out]    *pDelay    points to a buffer of <code>fftLen</code> values for the delay line.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>fftLen</code> is not supported, <code>numBins</code> is 0 or a bin index is not smaller than <code>fftLen</code>.
+*
+* \par Description:
+* <code>pTwiddle[2*m]</code> = cos(2*pi*m/fftLen) and <code>pTwiddle[2*m+1]</code> = sin(2*pi*m/fftLen) in Q15, for m = 0, 1, ..., fftLen-1.
+* The accumulators and the delay line are cleared, so the window starts with <code>fftLen</code> zeros.
+* The bin indexes and the buffers must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_sdft_init_q15(
+  riscv_sdft_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  q15_t * pTwiddle,
+  q31_t * pState,
+  q15_t * pDelay)
+{
+  RISCV_PROFILE(riscv_sdft_init_q15);
+  uint32_t m;
+  uint8_t shift = 0u;
+  float64_t phase, c, s;
+
+  if((fftLen < 16u) || (fftLen > 4096u) || ((fftLen & (fftLen - 1u)) != 0u) || (numBins == 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (m = 0u; m < numBins; m++)
+  {
+    if(pBins[m] >= fftLen)
+    {
+      return (RISCV_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  while((1u << shift) < fftLen)
+  {
+    shift++;
+  }
+
+  /*  Compute the twiddle factors of one turn, rounded and saturated to Q15 */
+  for (m = 0u; m < fftLen; m++)
+  {
+    phase = (6.283185307179586 * (float64_t) m) / (float64_t) fftLen;
+    c = floor((cos(phase) * 32768.0) + 0.5);
+    s = floor((sin(phase) * 32768.0) + 0.5);
+    pTwiddle[2u * m] = (q15_t) ((c > 32767.0) ? 32767.0 : c);
+    pTwiddle[(2u * m) + 1u] = (q15_t) ((s > 32767.0) ? 32767.0 : s);
+  }
+
+  S->fftLen = fftLen;
+  S->numBins = numBins;
+  S->delayIndex = 0u;
+  S->shift = shift;
+  S->pBins = pBins;
+  S->pTwiddle = pTwiddle;
+  S->pState = pState;
+  S->pDelay = pDelay;
+
+  /*  Clear the accumulators and the delay line */
+  riscv_fill_q31(0, pState, 2u * (uint32_t) numBins);
+  riscv_fill_q15(0, pDelay, fftLen);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of SlidingDFT group
+*/
@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_sdft_q15.c
+*
+* Description:  Q15 sliding DFT.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+* @brief  Processing function for the Q15 sliding DFT.
+* @param[in,out] *S         points to an instance of the Q15 sliding DFT structure.
+* @param[in]     *pSrc      points to the block of input samples.
+* @param[out]    *pDst      points to the <code>2*numBins</code> output values.
+* @param[in]     blockSize  number of samples to process.
+* @return none.
+*
+* <b>Scaling and Overflow Behavior:</b>
+* \par
+* The input is shifted right by log2(fftLen) with rounding.  The accumulators are Q31 and cannot
+* overflow, the output is rounded and saturated to the format of riscv_cfft_q15().
+* With USE_DSP_RISCV the twiddle factor is loaded as one packed <code>{cos, sin}</code> pair and
+* each accumulator is updated by a single dot product with <code>{d, 0}</code> or <code>{0, -d}</code>.
+* Both paths return the same values.
+*/
+
+void riscv_sdft_q15(
+  riscv_sdft_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_sdft_q15);
+#if defined (USE_DSP_RISCV)
+  const shortV *pW = (const shortV *) S->pTwiddle; /* Twiddle table {cos, sin} of fftLen entries */
+  shortV D0, D1;                                 /* {d, 0} and {0, -d} */
+#else
+  const q15_t *pW = S->pTwiddle;                 /* Twiddle table {cos, sin} of fftLen entries */
+#endif
+  const q15_t *pTw = S->pTwiddle;                /* Twiddle table for the output rotation */
+  const uint16_t *pBin;                          /* Bin index pointer */
+  const q15_t *pIn;                              /* Input pointer */
+  q31_t *pState;                                 /* Accumulator pointer */
+  q15_t *pDelay = S->pDelay;                     /* Delay line */
+  q31_t d;                                       /* x[j] - x[j-fftLen] */
+  q31_t re0, im0, re1, im1;                      /* Accumulators of two bins */
+  q63_t acc0, acc1;                              /* Output rotation */
+  uint32_t mask = (uint32_t) S->fftLen - 1u;     /* Index modulo fftLen */
+  uint32_t idx = S->delayIndex;                  /* Oldest sample of the delay line, the index j */
+  uint32_t k0, k1, m0, m1, i;                    /* Bins and their twiddle indexes */
+  uint32_t blkCnt, len, bin, cnt;                /* Loop counters */
+  uint8_t shift = S->shift;                      /* log2(fftLen) */
+  q31_t round = (q31_t) 1 << (shift - 1u);       /* Rounding of the input scaling */
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /*  A chunk of at most fftLen samples only subtracts samples of the delay line */
+    len = (blkCnt < S->fftLen) ? blkCnt : S->fftLen;
+
+    pBin = S->pBins;
+    pState = S->pState;
+
+    /*  Two bins per pass share every input and delay line load */
+    for (bin = (uint32_t) S->numBins >> 1u; bin > 0u; bin--)
+    {
+      k0 = pBin[0];
+      k1 = pBin[1];
+      m0 = (k0 * idx) & mask;
+      m1 = (k1 * idx) & mask;
+      re0 = pState[0];
+      im0 = pState[1];
+      re1 = pState[2];
+      im1 = pState[3];
+
+      pIn = pSrc;
+      i = idx;
+
+      for (cnt = len; cnt > 0u; cnt--)
+      {
+        /*  The delay line holds the scaled samples */
+        d = ((((q31_t) *pIn++) + round) >> shift) - pDelay[i];
+        i = (i + 1u) & mask;
+
+        /*  Y += d * exp(-i*2*pi*k*j/fftLen) */
+#if defined (USE_DSP_RISCV)
+        D0 = pack2(d, 0);
+        D1 = pack2(0, -d);
+        re0 = sumdotpv2(D0, pW[m0], re0);
+        im0 = sumdotpv2(D1, pW[m0], im0);
+        re1 = sumdotpv2(D0, pW[m1], re1);
+        im1 = sumdotpv2(D1, pW[m1], im1);
+#else
+        re0 += d * pW[2u * m0];
+        im0 -= d * pW[(2u * m0) + 1u];
+        re1 += d * pW[2u * m1];
+        im1 -= d * pW[(2u * m1) + 1u];
+#endif
+
+        m0 = (m0 + k0) & mask;
+        m1 = (m1 + k1) & mask;
+      }
+
+      pState[0] = re0;
+      pState[1] = im0;
+      pState[2] = re1;
+      pState[3] = im1;
+
+      pBin += 2u;
+      pState += 4u;
+    }
+
+    /*  Last bin of an odd number of bins */
+    if((S->numBins & 1u) != 0u)
+    {
+      k0 = pBin[0];
+      m0 = (k0 * idx) & mask;
+      re0 = pState[0];
+      im0 = pState[1];
+
+      pIn = pSrc;
+      i = idx;
+
+      for (cnt = len; cnt > 0u; cnt--)
+      {
+        d = ((((q31_t) *pIn++) + round) >> shift) - pDelay[i];
+        i = (i + 1u) & mask;
+
+#if defined (USE_DSP_RISCV)
+        re0 = sumdotpv2(pack2(d, 0), pW[m0], re0);
+        im0 = sumdotpv2(pack2(0, -d), pW[m0], im0);
+#else
+        re0 += d * pW[2u * m0];
+        im0 -= d * pW[(2u * m0) + 1u];
+#endif
+
+        m0 = (m0 + k0) & mask;
+      }
+
+      pState[0] = re0;
+      pState[1] = im0;
+    }
+
+    /*  Push the chunk into the delay line */
+    for (cnt = len; cnt > 0u; cnt--)
+    {
+      pDelay[idx] = (q15_t) ((((q31_t) *pSrc++) + round) >> shift);
+      idx = (idx + 1u) & mask;
+    }
+
+    blkCnt -= len;
+  }
+
+  S->delayIndex = (uint16_t) idx;
+
+  /*  X = Y * exp(i*2*pi*k*s/fftLen) for the window starting at s = idx, Q30 * Q15 to Q15 */
+  pBin = S->pBins;
+  pState = S->pState;
+
+  for (bin = S->numBins; bin > 0u; bin--)
+  {
+    m0 = ((uint32_t) *pBin++ * idx) & mask;
+    re0 = pState[0];
+    im0 = pState[1];
+
+    acc0 = ((q63_t) re0 * pTw[2u * m0]) - ((q63_t) im0 * pTw[(2u * m0) + 1u]);
+    acc1 = ((q63_t) re0 * pTw[(2u * m0) + 1u]) + ((q63_t) im0 * pTw[2u * m0]);
+
+    *pDst++ = (q15_t) __SSAT((q31_t) ((acc0 + 0x20000000) >> 30), 16);
+    *pDst++ = (q15_t) __SSAT((q31_t) ((acc1 + 0x20000000) >> 30), 16);
+
+    pState += 2u;
+  }
+}
+
+/**
+* @} end of SlidingDFT group
+*/
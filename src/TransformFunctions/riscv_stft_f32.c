@@ -0,0 +1,260 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_stft_f32.c
+*
+* Description:  Floating-point short-time Fourier transform.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <math.h>
+
+/*
+* @brief  Copies the frame out of the ring buffer and applies the window.
+* @param[in]  *S    points to an instance of the floating-point STFT structure.
+*
+* The oldest sample is at writeIndex, so the frame is the end of the ring
+* followed by its start.  The copy and the window share a single pass.
+*/
+
+static void riscv_stft_window_f32(
+  const riscv_stft_instance_f32 * S)
+{
+  const float32_t *pWin = S->pWindow;            /* Window pointer */
+  const float32_t *pIn = S->pRing + S->writeIndex; /* Ring pointer */
+  float32_t *pOut = S->pScratch;                 /* Frame pointer */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = (uint32_t) S->fftLen - S->writeIndex;
+
+  while(blkCnt > 0u)
+  {
+    *pOut++ = *pIn++ * *pWin++;
+    blkCnt--;
+  }
+
+  pIn = S->pRing;
+  blkCnt = S->writeIndex;
+
+  while(blkCnt > 0u)
+  {
+    *pOut++ = *pIn++ * *pWin++;
+    blkCnt--;
+  }
+}
+
+/*
+* @brief  Split stage of the real FFT that writes magnitudes or powers.
+* @param[in]  *S    points to an instance of the floating-point STFT structure.
+* @param[in]  *p    points to the output of the complex FFT.
+* @param[out] *pDst points to the fftLen/2+1 output bins.
+*
+* The bins are computed with the expressions of stage_rfft_f32(), two mirrored
+* bins per iteration, and reduced to |X|^2 or |X| before they are stored, so
+* the complex spectrum is never written out.
+*/
+
+static void riscv_stft_split_f32(
+  const riscv_stft_instance_f32 * S,
+  const float32_t * p,
+  float32_t * pDst)
+{
+  uint32_t k;                                    /* Loop Counter */
+  uint32_t L = (S->Srfft).Sint.fftLen;           /* Length of the complex FFT */
+  const float32_t *pCoeff = S->Srfft.pTwiddleRFFT; /* Twiddle factors of bin k */
+  const float32_t *pCoeffB;                      /* Twiddle factors of bin fftLen-k */
+  const float32_t *pA = p;                       /* increasing pointer */
+  const float32_t *pB;                           /* decreasing pointer */
+  float32_t *pOutB;                              /* decreasing output pointer */
+  float32_t twR, twI, twBR, twBI;                /* RFFT Twiddle coefficients */
+  float32_t xAR, xAI, xBR, xBI;                  /* temporary variables */
+  float32_t t1a, t1b, re, im, out;               /* temporary variables */
+  uint8_t powerFlag = S->powerFlag;
+
+  /* DC and Nyquist bins are real */
+  t1a = p[0] + p[0];
+  t1b = p[1] + p[1];
+
+  re = 0.5f * (t1a + t1b);
+  im = 0.5f * (t1a - t1b);
+
+  pDst[0] = (powerFlag != 0u) ? (re * re) : fabsf(re);
+  pDst[L] = (powerFlag != 0u) ? (im * im) : fabsf(im);
+
+  pA += 2;
+  pB = p + 2*(L - 1u);
+  pCoeff += 2;
+  pCoeffB = S->Srfft.pTwiddleRFFT + 2*(L - 1u);
+  pDst++;
+  pOutB = pDst + (L - 2u);
+
+  /* Bins 1 to fftLen/2-1 and fftLen-1 down to fftLen/2+1 */
+  k = (L >> 1u) - 1u;
+
+  while(k > 0u)
+  {
+    xBI = pB[1];
+    xBR = pB[0];
+    xAR = pA[0];
+    xAI = pA[1];
+
+    twR = *pCoeff++;
+    twI = *pCoeff++;
+    twBR = pCoeffB[0];
+    twBI = pCoeffB[1];
+
+    t1a = xBR - xAR;
+    t1b = xBI + xAI;
+
+    re = 0.5f * (xAR + xBR + (twR * t1a) + (twI * t1b));
+    im = 0.5f * (xAI - xBI + (twI * t1a) - (twR * t1b));
+    out = (re * re) + (im * im);
+    if(powerFlag == 0u)
+    {
+      riscv_sqrt_f32(out, &out);
+    }
+    *pDst++ = out;
+
+    /* Bin fftLen-k swaps the roles of xA and xB */
+    re = 0.5f * (xBR + xAR + (twBR * (xAR - xBR)) + (twBI * t1b));
+    im = 0.5f * (xBI - xAI + (twBI * (xAR - xBR)) - (twBR * t1b));
+    out = (re * re) + (im * im);
+    if(powerFlag == 0u)
+    {
+      riscv_sqrt_f32(out, &out);
+    }
+    *pOutB-- = out;
+
+    pA += 2;
+    pB -= 2;
+    pCoeffB -= 2;
+    k--;
+  }
+
+  /* Bin fftLen/2 reads the same sample as xA and xB */
+  xBI = pB[1];
+  xBR = pB[0];
+  xAR = pA[0];
+  xAI = pA[1];
+
+  twR = pCoeff[0];
+  twI = pCoeff[1];
+
+  t1a = xBR - xAR;
+  t1b = xBI + xAI;
+
+  re = 0.5f * (xAR + xBR + (twR * t1a) + (twI * t1b));
+  im = 0.5f * (xAI - xBI + (twI * t1a) - (twR * t1b));
+  out = (re * re) + (im * im);
+  if(powerFlag == 0u)
+  {
+    riscv_sqrt_f32(out, &out);
+  }
+  *pDst = out;
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup STFT Short-Time Fourier Transform
+ *
+ * \par
+ * The short-time Fourier transform cuts a stream of real samples into overlapping
+ * frames of <code>fftLen</code> samples that start every <code>hopSize</code> samples,
+ * multiplies each frame by a window and outputs the magnitude or power spectrum of it.
+ * \par
+ * The instance keeps the last <code>fftLen</code> samples in a ring buffer, so the input
+ * can be pushed in blocks of any size.  Every call outputs the frames completed by its block,
+ * <code>fftLen/2+1</code> bins per frame, from DC to Nyquist.
+ * \par
+ * A frame is computed with three passes over memory instead of the five of a
+ * copy, window, RFFT and magnitude chain:
+ * - the frame is copied out of the ring buffer and windowed in the same loop,
+ * - the complex FFT runs in place on the scratch buffer,
+ * - the split stage of the real FFT computes the magnitude or power of each bin directly.
+ * \par
+ * The window is a table of <code>fftLen</code> values given by the user, e.g. a Hann window.
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+* @brief Processing function for the floating-point STFT.
+* @param[in,out] *S         points to an instance of the floating-point STFT structure.
+* @param[in]     *pSrc      points to the block of input samples.
+* @param[in]     blockSize  number of samples to push.
+* @param[out]    *pDst      points to the output frames, <code>fftLen/2+1</code> values each.
+* @return        number of frames written to <code>pDst</code>.
+*
+* At most <code>blockSize/hopSize + 1</code> frames are output by a call.
+* Magnitudes and powers are not normalized, bin k of a frame of length N is |X(k)| or |X(k)|^2.
+*/
+
+uint32_t riscv_stft_f32(
+  riscv_stft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_stft_f32);
+  uint32_t numFrames = 0u;                       /* Number of output frames */
+  uint32_t blkCnt, i;                            /* Loop counters */
+  float32_t *pRing;                              /* Ring buffer write pointer */
+
+  while(blockSize > 0u)
+  {
+    /*  Push samples up to the next frame or the end of the ring */
+    blkCnt = (uint32_t) S->fftLen - S->writeIndex;
+
+    if(blkCnt > S->samplesToFrame)
+    {
+      blkCnt = S->samplesToFrame;
+    }
+
+    if(blkCnt > blockSize)
+    {
+      blkCnt = blockSize;
+    }
+
+    pRing = S->pRing + S->writeIndex;
+
+    for (i = 0u; i < blkCnt; i++)
+    {
+      pRing[i] = pSrc[i];
+    }
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    S->samplesToFrame -= (uint16_t) blkCnt;
+    S->writeIndex += (uint16_t) blkCnt;
+
+    if(S->writeIndex == S->fftLen)
+    {
+      S->writeIndex = 0u;
+    }
+
+    if(S->samplesToFrame == 0u)
+    {
+      /*  Window, transform and reduce the frame */
+      riscv_stft_window_f32(S);
+      riscv_cfft_f32(&(S->Srfft.Sint), S->pScratch, 0u, 1u);
+      riscv_stft_split_f32(S, S->pScratch, pDst);
+
+      pDst += (S->fftLen >> 1u) + 1u;
+      numFrames++;
+      S->samplesToFrame = S->hopSize;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+* @} end of STFT group
+*/
@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_stft_init_arena.c
+*
+* Description:  STFT instances with the ring and scratch buffers taken
+*               from an arena.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Size of the ring buffer of the floating-point STFT.
+ * @param[in]  fftLen  length of a frame.
+ * @return     bytes the ring buffer takes from the arena, <code>fftLen</code> samples.
+ */
+
+uint32_t riscv_stft_get_buffer_size_f32(
+  uint16_t fftLen)
+{
+  return (RISCV_DSP_ARENA_ROUND((uint32_t) fftLen * sizeof(float32_t)));
+}
+
+/**
+ * @brief  Size of the scratch buffer of the floating-point STFT.
+ * @param[in]  fftLen  length of a frame.
+ * @return     bytes of the shared scratch region the instance needs, <code>fftLen</code> samples.
+ */
+
+uint32_t riscv_stft_get_scratch_size_f32(
+  uint16_t fftLen)
+{
+  return (RISCV_DSP_ARENA_ROUND((uint32_t) fftLen * sizeof(float32_t)));
+}
+
+/**
+ * @brief  Initialization function for the floating-point STFT with the buffers taken from an arena.
+ * @param[out]    *S          points to an instance of the floating-point STFT structure.
+ * @param[in]     fftLen      length of a frame.
+ * @param[in]     hopSize     number of samples between the starts of two frames.
+ * @param[in]     powerFlag   magnitude spectra if flag is 0, power spectra if flag is 1.
+ * @param[in]     *pWindow    points to the window table of length fftLen.
+ * @param[in,out] *pArena     points to the arena the buffers are taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena is too small, otherwise the status of riscv_stft_init_f32().
+ *
+ * \par
+ * The ring buffer is persistent, the scratch buffer is shared with the other instances of the arena.
+ */
+
+riscv_status riscv_stft_init_arena_f32(
+  riscv_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  uint8_t powerFlag,
+  const float32_t * pWindow,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_stft_init_arena_f32);
+  uint32_t used = pArena->used;
+  uint32_t scratch = pArena->scratch;
+  float32_t *pRing;
+  float32_t *pScratch;
+  riscv_status status = RISCV_MATH_LENGTH_ERROR;
+
+  pRing = (float32_t *) riscv_dsp_arena_alloc(pArena, riscv_stft_get_buffer_size_f32(fftLen));
+  pScratch = (float32_t *) riscv_dsp_arena_scratch(pArena, riscv_stft_get_scratch_size_f32(fftLen));
+
+  if((pRing != NULL) && (pScratch != NULL))
+  {
+    status = riscv_stft_init_f32(S, fftLen, hopSize, powerFlag, pWindow, pRing, pScratch);
+  }
+
+  /*  Give the buffers back if the arena is too small or the parameters are rejected */
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    pArena->used = used;
+    pArena->scratch = scratch;
+  }
+
+  return (status);
+}
+
+/**
+ * @brief  Size of the ring buffer of the Q15 STFT.
+ * @param[in]  fftLen  length of a frame.
+ * @return     bytes the ring buffer takes from the arena, <code>fftLen</code> samples.
+ */
+
+uint32_t riscv_stft_get_buffer_size_q15(
+  uint16_t fftLen)
+{
+  return (RISCV_DSP_ARENA_ROUND((uint32_t) fftLen * sizeof(q15_t)));
+}
+
+/**
+ * @brief  Size of the scratch buffer of the Q15 STFT.
+ * @param[in]  fftLen  length of a frame.
+ * @return     bytes of the shared scratch region the instance needs, <code>fftLen</code> samples.
+ */
+
+uint32_t riscv_stft_get_scratch_size_q15(
+  uint16_t fftLen)
+{
+  return (RISCV_DSP_ARENA_ROUND((uint32_t) fftLen * sizeof(q15_t)));
+}
+
+/**
+ * @brief  Initialization function for the Q15 STFT with the buffers taken from an arena.
+ * @param[out]    *S          points to an instance of the Q15 STFT structure.
+ * @param[in]     fftLen      length of a frame.
+ * @param[in]     hopSize     number of samples between the starts of two frames.
+ * @param[in]     powerFlag   magnitude spectra if flag is 0, power spectra if flag is 1.
+ * @param[in]     *pWindow    points to the window table of length fftLen.
+ * @param[in,out] *pArena     points to the arena the buffers are taken from.
+ * @return        RISCV_MATH_LENGTH_ERROR if the arena is too small, otherwise the status of riscv_stft_init_q15().
+ *
+ * \par
+ * The ring buffer is persistent, the scratch buffer is shared with the other instances of the arena.
+ */
+
+riscv_status riscv_stft_init_arena_q15(
+  riscv_stft_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  uint8_t powerFlag,
+  const q15_t * pWindow,
+  riscv_dsp_arena * pArena)
+{
+  RISCV_PROFILE(riscv_stft_init_arena_q15);
+  uint32_t used = pArena->used;
+  uint32_t scratch = pArena->scratch;
+  q15_t *pRing;
+  q15_t *pScratch;
+  riscv_status status = RISCV_MATH_LENGTH_ERROR;
+
+  pRing = (q15_t *) riscv_dsp_arena_alloc(pArena, riscv_stft_get_buffer_size_q15(fftLen));
+  pScratch = (q15_t *) riscv_dsp_arena_scratch(pArena, riscv_stft_get_scratch_size_q15(fftLen));
+
+  if((pRing != NULL) && (pScratch != NULL))
+  {
+    status = riscv_stft_init_q15(S, fftLen, hopSize, powerFlag, pWindow, pRing, pScratch);
+  }
+
+  /*  Give the buffers back if the arena is too small or the parameters are rejected */
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    pArena->used = used;
+    pArena->scratch = scratch;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of STFT group
+ */
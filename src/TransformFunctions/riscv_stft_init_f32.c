@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_stft_init_f32.c
+*
+* Description:  Initialization function for the floating-point short-time
+*               Fourier transform.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point STFT.
+* @param[out]    *S          points to an instance of the floating-point STFT structure.
+* @param[in]     fftLen      length of a frame, a power of two from 32 to 4096.
+* @param[in]     hopSize     number of samples between the starts of two frames, from 1 to <code>fftLen</code>.
+* @param[in]     powerFlag   magnitude spectra if flag is 0, power spectra if flag is 1.
+* @param[in]     *pWindow    points to the window table of length <code>fftLen</code>.
+* @param[in]     *pRing      points to the ring buffer of length <code>fftLen</code>.
+* @param[in]     *pScratch   points to the scratch buffer of length <code>fftLen</code>.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>fftLen</code> or <code>hopSize</code> is not a supported value.
+*
+* \par Description:
+* The ring buffer is cleared.  The first frame is output once <code>fftLen</code> samples have been pushed.
+* The window, ring and scratch buffers must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_stft_init_f32(
+  riscv_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  uint8_t powerFlag,
+  const float32_t * pWindow,
+  float32_t * pRing,
+  float32_t * pScratch)
+{
+  RISCV_PROFILE(riscv_stft_init_f32);
+  riscv_status status;
+
+  if((hopSize == 0u) || (hopSize > fftLen))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  Initialize the real FFT of a frame */
+  status = riscv_rfft_fast_init_f32(&S->Srfft, fftLen);
+
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->fftLen = fftLen;
+  S->hopSize = hopSize;
+  S->writeIndex = 0u;
+  S->samplesToFrame = fftLen;
+  S->powerFlag = powerFlag;
+  S->pWindow = pWindow;
+  S->pRing = pRing;
+  S->pScratch = pScratch;
+
+  /*  Clear the ring buffer */
+  riscv_fill_f32(0.0f, pRing, fftLen);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of STFT group
+*/
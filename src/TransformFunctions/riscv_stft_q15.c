@@ -0,0 +1,250 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_stft_q15.c
+*
+* Description:  Q15 short-time Fourier transform.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/*
+* @brief  Copies the frame out of the ring buffer and applies the window.
+* @param[in]  *S    points to an instance of the Q15 STFT structure.
+*
+* The oldest sample is at writeIndex, so the frame is the end of the ring
+* followed by its start.  The copy and the window share a single pass, the
+* product is computed as in riscv_mult_q15().
+*/
+
+static void riscv_stft_window_q15(
+  const riscv_stft_instance_q15 * S)
+{
+  const q15_t *pWin = S->pWindow;                /* Window pointer */
+  const q15_t *pIn = S->pRing + S->writeIndex;   /* Ring pointer */
+  q15_t *pOut = S->pScratch;                     /* Frame pointer */
+  uint32_t blkCnt;                               /* Loop counter */
+  uint32_t part;                                 /* Part of the ring */
+
+  blkCnt = (uint32_t) S->fftLen - S->writeIndex;
+
+  for (part = 0u; part < 2u; part++)
+  {
+    while(blkCnt > 0u)
+    {
+#if defined (USE_DSP_RISCV)
+      *pOut++ = (q15_t) clip(mulsN(*pIn++, *pWin++, 15), -32768, 32767);
+#else
+      *pOut++ = (q15_t) __SSAT((((q31_t) (*pIn++) * (*pWin++)) >> 15), 16);
+#endif
+      blkCnt--;
+    }
+
+    /*  Wrap around to the start of the ring */
+    pIn = S->pRing;
+    blkCnt = S->writeIndex;
+  }
+}
+
+/*
+* @brief  Split stage of the real FFT that writes magnitudes or powers.
+* @param[in]  *S    points to an instance of the Q15 STFT structure.
+* @param[in]  *pSrc points to the output of the complex FFT.
+* @param[out] *pDst points to the fftLen/2+1 output bins.
+*
+* The bins are computed with the expressions of riscv_split_rfft_q15() and
+* reduced as in riscv_cmplx_mag_q15() or riscv_cmplx_mag_squared_q15() before
+* they are stored, so the complex spectrum is never written out.
+*/
+
+static void riscv_stft_split_q15(
+  const riscv_stft_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst)
+{
+  uint32_t i;                                    /* Loop Counter */
+  uint32_t fftLen = S->Srfft.fftLenReal >> 1u;   /* Length of the complex FFT */
+  uint32_t modifier = S->Srfft.twidCoefRModifier;
+  q31_t outR, outI;                              /* Temporary variables for output */
+  q31_t acc;                                     /* Squared magnitude */
+  const q15_t *pCoefA, *pCoefB;                  /* Temporary pointers for twiddle factors */
+  const q15_t *pSrc1, *pSrc2;
+  q15_t re;
+  uint8_t powerFlag = S->powerFlag;
+#if defined (USE_DSP_RISCV)
+  shortV A, B, nA, nB, X;                        /* Twiddle factors, their negations and the bin */
+  shortV Ac, As, Bq;                             /* (Ar, -Ai), (Ai, Ar) and (Bi, -Br) */
+  shortV conjMask = { 0, 3 };                    /* Shuffle mask for (re, -im) */
+  shortV swapMask = { 1, 0 };                    /* Shuffle mask for (im, re) */
+  shortV rotMask = { 1, 2 };                     /* Shuffle mask for (im, -re) */
+#else
+  q15_t im;
+#endif
+
+  /* DC and Nyquist bins are real */
+  re = (pSrc[0] + pSrc[1]) >> 1;
+  acc = (q31_t) re * re;
+  pDst[0] = (q15_t) (acc >> 17);
+
+  re = (pSrc[0] - pSrc[1]) >> 1;
+  acc = (q31_t) re * re;
+  pDst[fftLen] = (q15_t) (acc >> 17);
+
+  if(powerFlag == 0u)
+  {
+    riscv_sqrt_q15(pDst[0], &pDst[0]);
+    riscv_sqrt_q15(pDst[fftLen], &pDst[fftLen]);
+  }
+
+  pCoefA = &S->Srfft.pTwiddleAReal[modifier * 2u];
+  pCoefB = &S->Srfft.pTwiddleBReal[modifier * 2u];
+
+  pSrc1 = &pSrc[2];
+  pSrc2 = &pSrc[(2u * fftLen) - 2u];
+  i = 1u;
+
+  while(i < fftLen)
+  {
+#if defined (USE_DSP_RISCV)
+    A = *(shortV *) pCoefA;
+    B = *(shortV *) pCoefB;
+    nA = neg2(A);
+    nB = neg2(B);
+    Ac = shufflev4(A, nA, conjMask);
+    As = shufflev4(A, A, swapMask);
+    Bq = shufflev4(B, nB, rotMask);
+
+    /* outR = pSrc1 . (Ar, -Ai) + pSrc2 . (Br, Bi) */
+    outR = sumdotpv2(*(shortV *) pSrc2, B, dotpv2(*(shortV *) pSrc1, Ac)) >> 16;
+
+    /* outI = pSrc1 . (Ai, Ar) + pSrc2 . (Bi, -Br) */
+    outI = sumdotpv2(*(shortV *) pSrc1, As, dotpv2(*(shortV *) pSrc2, Bq)) >> 16;
+
+    /* |X|^2 of the bin as stored by riscv_split_rfft_q15() */
+    X = (shortV) pack2(outR, outI);
+    acc = dotpv2(X, X);
+#else
+    outR = *pSrc1 * *pCoefA;
+    outR = outR - (*(pSrc1 + 1) * *(pCoefA + 1));
+    outR = outR + (*pSrc2 * *pCoefB);
+    outR = (outR + (*(pSrc2 + 1) * *(pCoefB + 1))) >> 16;
+
+    outI = *pSrc2 * *(pCoefB + 1);
+    outI = outI - (*(pSrc2 + 1) * *pCoefB);
+    outI = outI + (*(pSrc1 + 1) * *pCoefA);
+    outI = outI + (*pSrc1 * *(pCoefA + 1));
+
+    /* |X|^2 of the bin as stored by riscv_split_rfft_q15() */
+    re = (q15_t) outR;
+    im = (q15_t) (outI >> 16u);
+    acc = (re * re) + (im * im);
+#endif
+
+    /* 3.13 power or 2.14 magnitude */
+    if(powerFlag != 0u)
+    {
+      pDst[i] = (q15_t) (((q63_t) acc) >> 17);
+    }
+    else
+    {
+      riscv_sqrt_q15((q15_t) (((q63_t) acc) >> 17), &pDst[i]);
+    }
+
+    /* update input pointers */
+    pSrc1 += 2u;
+    pSrc2 -= 2u;
+
+    /* update coefficient pointer */
+    pCoefB = pCoefB + (2u * modifier);
+    pCoefA = pCoefA + (2u * modifier);
+
+    i++;
+  }
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+* @brief Processing function for the Q15 STFT.
+* @param[in,out] *S         points to an instance of the Q15 STFT structure.
+* @param[in]     *pSrc      points to the block of input samples.
+* @param[in]     blockSize  number of samples to push.
+* @param[out]    *pDst      points to the output frames, <code>fftLen/2+1</code> values each.
+* @return        number of frames written to <code>pDst</code>.
+*
+* At most <code>blockSize/hopSize + 1</code> frames are output by a call.
+* \par
+* The bins are the ones of riscv_rfft_q15(), which are downscaled in the same way for every frame length,
+* followed by riscv_cmplx_mag_q15() (2.14 format) or riscv_cmplx_mag_squared_q15() (3.13 format).
+*/
+
+uint32_t riscv_stft_q15(
+  riscv_stft_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_stft_q15);
+  uint32_t numFrames = 0u;                       /* Number of output frames */
+  uint32_t blkCnt, i;                            /* Loop counters */
+  q15_t *pRing;                                  /* Ring buffer write pointer */
+
+  while(blockSize > 0u)
+  {
+    /*  Push samples up to the next frame or the end of the ring */
+    blkCnt = (uint32_t) S->fftLen - S->writeIndex;
+
+    if(blkCnt > S->samplesToFrame)
+    {
+      blkCnt = S->samplesToFrame;
+    }
+
+    if(blkCnt > blockSize)
+    {
+      blkCnt = blockSize;
+    }
+
+    pRing = S->pRing + S->writeIndex;
+
+    for (i = 0u; i < blkCnt; i++)
+    {
+      pRing[i] = pSrc[i];
+    }
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    S->samplesToFrame -= (uint16_t) blkCnt;
+    S->writeIndex += (uint16_t) blkCnt;
+
+    if(S->writeIndex == S->fftLen)
+    {
+      S->writeIndex = 0u;
+    }
+
+    if(S->samplesToFrame == 0u)
+    {
+      /*  Window, transform and reduce the frame */
+      riscv_stft_window_q15(S);
+      riscv_cfft_q15(S->Srfft.pCfft, S->pScratch, 0u, 1u);
+      riscv_stft_split_q15(S, S->pScratch, pDst);
+
+      pDst += (S->fftLen >> 1u) + 1u;
+      numFrames++;
+      S->samplesToFrame = S->hopSize;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+* @} end of STFT group
+*/
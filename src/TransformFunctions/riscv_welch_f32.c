@@ -0,0 +1,372 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_welch_f32.c
+*
+* Description:  Floating-point Welch power and cross spectral density
+*               estimate.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/*
+* @brief  Copies the segment of a channel out of its ring buffer and applies the window.
+* @param[in]  *S     points to an instance of the floating-point Welch structure.
+* @param[in]  *pRing points to the ring buffer of the channel.
+* @param[out] *pOut  points to the segment.
+*/
+
+static void riscv_welch_window_f32(
+  const riscv_welch_instance_f32 * S,
+  const float32_t * pRing,
+  float32_t * pOut)
+{
+  const float32_t *pWin = S->pWindow;            /* Window pointer */
+  const float32_t *pIn = pRing + S->writeIndex;  /* Ring pointer */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = (uint32_t) S->fftLen - S->writeIndex;
+
+  while(blkCnt > 0u)
+  {
+    *pOut++ = *pIn++ * *pWin++;
+    blkCnt--;
+  }
+
+  pIn = pRing;
+  blkCnt = S->writeIndex;
+
+  while(blkCnt > 0u)
+  {
+    *pOut++ = *pIn++ * *pWin++;
+    blkCnt--;
+  }
+}
+
+/*
+* Bins k and fftLen-k, 0 < k < fftLen/4, of the real FFT from the output of the
+* complex FFT, with the expressions of stage_rfft_f32().  Both read the same two
+* samples with their roles swapped.
+*/
+static inline void riscv_welch_bins_f32(
+  const float32_t * p,
+  const float32_t * pCoeff,
+  uint32_t L,
+  uint32_t k,
+  float32_t * pOut)
+{
+  float32_t xAR = p[2u * k];
+  float32_t xAI = p[(2u * k) + 1u];
+  float32_t xBR = p[2u * (L - k)];
+  float32_t xBI = p[(2u * (L - k)) + 1u];
+  float32_t twR = pCoeff[2u * k];
+  float32_t twI = pCoeff[(2u * k) + 1u];
+  float32_t twBR = pCoeff[2u * (L - k)];
+  float32_t twBI = pCoeff[(2u * (L - k)) + 1u];
+  float32_t t1a = xBR - xAR;
+  float32_t t1b = xBI + xAI;
+
+  pOut[0] = 0.5f * (xAR + xBR + (twR * t1a) + (twI * t1b));
+  pOut[1] = 0.5f * (xAI - xBI + (twI * t1a) - (twR * t1b));
+  pOut[2] = 0.5f * (xBR + xAR - (twBR * t1a) + (twBI * t1b));
+  pOut[3] = 0.5f * (xBI - xAI - (twBI * t1a) - (twBR * t1b));
+}
+
+/*
+* @brief  Split stage of the real FFT that accumulates the spectra of a segment.
+* @param[in,out] *S  points to an instance of the floating-point Welch structure.
+*
+* The bins of both channels are computed in registers, two mirrored bins per iteration,
+* and added to |X|^2, and with crossFlag to |Y|^2 and X*conj(Y), so the complex spectra
+* are never written out.  Bin fftLen/4 is its own mirror and is added after the loop.
+*/
+
+static void riscv_welch_split_f32(
+  riscv_welch_instance_f32 * S)
+{
+  uint32_t L = (S->Srfft).Sint.fftLen;           /* Length of the complex FFT */
+  const float32_t *pCoeff = S->Srfft.pTwiddleRFFT; /* RFFT twiddle factors */
+  const float32_t *pX = S->pScratch;             /* Complex FFT of the first channel */
+  const float32_t *pY = S->pScratch + (2u * L);  /* Complex FFT of the second channel */
+  float32_t *pXX = S->pAcc;                      /* |X|^2 accumulators */
+  float32_t *pYY = pXX + (L + 1u);               /* |Y|^2 accumulators */
+  float32_t *pXY = pYY + (L + 1u);               /* X*conj(Y) accumulators */
+  float32_t x[4], y[4];                          /* Bins k and L-k */
+  float32_t xr, xi, yr, yi;
+  uint32_t k, j;
+
+  /* DC and Nyquist bins are real */
+  xr = pX[0] + pX[1];
+  xi = pX[0] - pX[1];
+  pXX[0] += xr * xr;
+  pXX[L] += xi * xi;
+
+  if(S->crossFlag == 0u)
+  {
+    for (k = 1u; k < (L >> 1u); k++)
+    {
+      riscv_welch_bins_f32(pX, pCoeff, L, k, x);
+      j = L - k;
+      pXX[k] += (x[0] * x[0]) + (x[1] * x[1]);
+      pXX[j] += (x[2] * x[2]) + (x[3] * x[3]);
+    }
+
+    riscv_welch_bins_f32(pX, pCoeff, L, k, x);
+    pXX[k] += (x[0] * x[0]) + (x[1] * x[1]);
+  }
+  else
+  {
+    yr = pY[0] + pY[1];
+    yi = pY[0] - pY[1];
+    pYY[0] += yr * yr;
+    pYY[L] += yi * yi;
+    pXY[0] += xr * yr;
+    pXY[2u * L] += xi * yi;
+
+    for (k = 1u; k < (L >> 1u); k++)
+    {
+      riscv_welch_bins_f32(pX, pCoeff, L, k, x);
+      riscv_welch_bins_f32(pY, pCoeff, L, k, y);
+      j = L - k;
+      pXX[k] += (x[0] * x[0]) + (x[1] * x[1]);
+      pYY[k] += (y[0] * y[0]) + (y[1] * y[1]);
+      pXY[2u * k] += (x[0] * y[0]) + (x[1] * y[1]);
+      pXY[(2u * k) + 1u] += (x[1] * y[0]) - (x[0] * y[1]);
+      pXX[j] += (x[2] * x[2]) + (x[3] * x[3]);
+      pYY[j] += (y[2] * y[2]) + (y[3] * y[3]);
+      pXY[2u * j] += (x[2] * y[2]) + (x[3] * y[3]);
+      pXY[(2u * j) + 1u] += (x[3] * y[2]) - (x[2] * y[3]);
+    }
+
+    riscv_welch_bins_f32(pX, pCoeff, L, k, x);
+    riscv_welch_bins_f32(pY, pCoeff, L, k, y);
+    pXX[k] += (x[0] * x[0]) + (x[1] * x[1]);
+    pYY[k] += (y[0] * y[0]) + (y[1] * y[1]);
+    pXY[2u * k] += (x[0] * y[0]) + (x[1] * y[1]);
+    pXY[(2u * k) + 1u] += (x[1] * y[0]) - (x[0] * y[1]);
+  }
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Welch Welch Spectral Density
+ *
+ * \par
+ * Welch's method estimates the power spectral density of a stream of real samples as the
+ * average of the periodograms of overlapping windowed segments of <code>fftLen</code>
+ * samples that start every <code>hopSize</code> samples.  With a second channel the
+ * cross spectral density and the magnitude-squared coherence are estimated as well.
+ * \par
+ * The instance keeps the last <code>fftLen</code> samples of each channel in a ring buffer,
+ * so the input can be pushed in blocks of any size.  A segment is windowed while it is
+ * copied out of the ring, transformed in place by the complex FFT of the real FFT, and the
+ * split stage of the real FFT adds |X|^2, |Y|^2 and X*conj(Y) of each bin to the running
+ * sums, so neither the spectrum nor its magnitude is written out.
+ * \par
+ * riscv_welch_psd_f32(), riscv_welch_csd_f32() and riscv_welch_coherence_f32() read the average
+ * at any time, <code>fftLen/2+1</code> bins from DC to Nyquist.  The densities are one-sided and
+ * per cycle per sample, as scipy.signal.welch with fs = 1; divide by the sample rate for a
+ * density per Hz.  riscv_welch_reset_f32() restarts the average.
+ * \par
+ * The Q31 functions accumulate in 64 bits and output the average power spectrum without the
+ * density scaling, see riscv_welch_psd_q31().
+ */
+
+/**
+ * @addtogroup Welch
+ * @{
+ */
+
+/**
+* @brief Processing function for the floating-point Welch estimate.
+* @param[in,out] *S         points to an instance of the floating-point Welch structure.
+* @param[in]     *pSrcX     points to the block of samples of the first channel.
+* @param[in]     *pSrcY     points to the block of samples of the second channel, or NULL without crossFlag.
+* @param[in]     blockSize  number of samples to push.
+* @return        number of segments added to the average.
+*/
+
+uint32_t riscv_welch_f32(
+  riscv_welch_instance_f32 * S,
+  const float32_t * pSrcX,
+  const float32_t * pSrcY,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_welch_f32);
+  uint32_t fftLen = S->fftLen;
+  uint32_t numSegments = 0u;                     /* Number of segments added */
+  uint32_t blkCnt, i;                            /* Loop counters */
+  float32_t *pRing;                              /* Ring buffer write pointer */
+
+  while(blockSize > 0u)
+  {
+    /*  Push samples up to the next segment or the end of the ring */
+    blkCnt = fftLen - S->writeIndex;
+
+    if(blkCnt > S->samplesToSegment)
+    {
+      blkCnt = S->samplesToSegment;
+    }
+
+    if(blkCnt > blockSize)
+    {
+      blkCnt = blockSize;
+    }
+
+    pRing = S->pRing + S->writeIndex;
+
+    for (i = 0u; i < blkCnt; i++)
+    {
+      pRing[i] = pSrcX[i];
+    }
+    pSrcX += blkCnt;
+
+    if(S->crossFlag != 0u)
+    {
+      pRing += fftLen;
+
+      for (i = 0u; i < blkCnt; i++)
+      {
+        pRing[i] = pSrcY[i];
+      }
+      pSrcY += blkCnt;
+    }
+
+    blockSize -= blkCnt;
+    S->samplesToSegment -= (uint16_t) blkCnt;
+    S->writeIndex += (uint16_t) blkCnt;
+
+    if(S->writeIndex == fftLen)
+    {
+      S->writeIndex = 0u;
+    }
+
+    if(S->samplesToSegment == 0u)
+    {
+      /*  Window, transform and accumulate the segment */
+      riscv_welch_window_f32(S, S->pRing, S->pScratch);
+      riscv_cfft_f32(&(S->Srfft.Sint), S->pScratch, 0u, 1u);
+
+      if(S->crossFlag != 0u)
+      {
+        riscv_welch_window_f32(S, S->pRing + fftLen, S->pScratch + fftLen);
+        riscv_cfft_f32(&(S->Srfft.Sint), S->pScratch + fftLen, 0u, 1u);
+      }
+
+      riscv_welch_split_f32(S);
+
+      S->numSegments++;
+      numSegments++;
+      S->samplesToSegment = S->hopSize;
+    }
+  }
+
+  return (numSegments);
+}
+
+/**
+* @brief Power spectral density of the first channel, or of the second with crossFlag.
+* @param[in]  *S        points to an instance of the floating-point Welch structure.
+* @param[in]  channel   0 for the first channel, 1 for the second.
+* @param[out] *pDst     points to the <code>fftLen/2+1</code> output bins.
+* @return none.
+*
+* Bin k is the average of |X(k)|^2 over the segments divided by the sum of the squared window
+* values, doubled for the bins other than DC and Nyquist.  All bins are 0 before the first segment.
+*/
+
+void riscv_welch_psd_f32(
+  const riscv_welch_instance_f32 * S,
+  uint8_t channel,
+  float32_t * pDst)
+{
+  uint32_t L = (uint32_t) S->fftLen >> 1u;
+  const float32_t *pAcc = S->pAcc + ((channel != 0u) ? (L + 1u) : 0u);
+  float32_t scale;
+  uint32_t k;
+
+  scale = (S->numSegments == 0u) ? 0.0f : 2.0f / ((float32_t) S->numSegments * S->windowEnergy);
+
+  pDst[0] = 0.5f * scale * pAcc[0];
+  for (k = 1u; k < L; k++)
+  {
+    pDst[k] = scale * pAcc[k];
+  }
+  pDst[L] = 0.5f * scale * pAcc[L];
+}
+
+/**
+* @brief Cross spectral density of the two channels, the average of X*conj(Y).
+* @param[in]  *S        points to an instance of the floating-point Welch structure initialized with crossFlag.
+* @param[out] *pDst     points to the <code>fftLen/2+1</code> complex output bins.
+* @return none.
+*
+* The bins are scaled like those of riscv_welch_psd_f32().
+*/
+
+void riscv_welch_csd_f32(
+  const riscv_welch_instance_f32 * S,
+  float32_t * pDst)
+{
+  uint32_t L = (uint32_t) S->fftLen >> 1u;
+  const float32_t *pAcc = S->pAcc + (2u * (L + 1u));
+  float32_t scale;
+
+  scale = (S->numSegments == 0u) ? 0.0f : 2.0f / ((float32_t) S->numSegments * S->windowEnergy);
+
+  riscv_scale_f32((float32_t *) pAcc, scale, pDst, 2u * (L + 1u));
+  pDst[0] *= 0.5f;
+  pDst[1] *= 0.5f;
+  pDst[2u * L] *= 0.5f;
+  pDst[(2u * L) + 1u] *= 0.5f;
+}
+
+/**
+* @brief Magnitude-squared coherence of the two channels, |Sxy|^2/(Sxx*Syy).
+* @param[in]  *S        points to an instance of the floating-point Welch structure initialized with crossFlag.
+* @param[out] *pDst     points to the <code>fftLen/2+1</code> output bins, from 0 to 1.
+* @return none.
+*
+* A bin with no power in either channel is 0.  With a single segment every bin with power is 1.
+*/
+
+void riscv_welch_coherence_f32(
+  const riscv_welch_instance_f32 * S,
+  float32_t * pDst)
+{
+  uint32_t L = (uint32_t) S->fftLen >> 1u;
+  const float32_t *pXX = S->pAcc;
+  const float32_t *pYY = pXX + (L + 1u);
+  const float32_t *pXY = pYY + (L + 1u);
+  float32_t den;
+  uint32_t k;
+
+  for (k = 0u; k <= L; k++)
+  {
+    den = pXX[k] * pYY[k];
+    pDst[k] = (den > 0.0f) ? (((pXY[2u * k] * pXY[2u * k]) + (pXY[(2u * k) + 1u] * pXY[(2u * k) + 1u])) / den) : 0.0f;
+  }
+}
+
+/**
+* @brief Restarts the average, the samples in the ring buffers are kept.
+* @param[in,out] *S  points to an instance of the floating-point Welch structure.
+* @return none.
+*/
+
+void riscv_welch_reset_f32(
+  riscv_welch_instance_f32 * S)
+{
+  uint32_t L = (uint32_t) S->fftLen >> 1u;
+
+  riscv_fill_f32(0.0f, S->pAcc, ((S->crossFlag != 0u) ? 4u : 1u) * (L + 1u));
+  S->numSegments = 0u;
+}
+
+/**
+* @} end of Welch group
+*/
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_welch_init_q31.c
+*
+* Description:  Initialization function for the Q31 Welch spectral
+*               density estimate.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Welch
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the Q31 Welch estimate.
+* @param[out]    *S          points to an instance of the Q31 Welch structure.
+* @param[in]     fftLen      length of a segment, a power of two from 32 to 4096.
+* @param[in]     hopSize     number of samples between the starts of two segments, from 1 to <code>fftLen</code>.
+* @param[in]     crossFlag   one channel if flag is 0, two channels and their cross-spectrum if flag is 1.
+* @param[in]     *pWindow    points to the window table of length <code>fftLen</code>.
+* @param[in]     *pRing      points to the ring buffers, <code>fftLen</code> words per channel.
+* @param[in]     *pScratch   points to the scratch buffer, <code>fftLen</code> words per channel.
+* @param[in]     *pAcc       points to the accumulators, <code>fftLen/2+1</code> 64-bit words, <code>4*(fftLen/2+1)</code> with crossFlag.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>fftLen</code> or <code>hopSize</code> is not a supported value.
+*
+* \par Description:
+* The ring buffers and the accumulators are cleared.  The first segment is added once <code>fftLen</code>
+* samples have been pushed, a hop of fftLen/2 with a Hann window is the usual choice.
+* The buffers must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_welch_init_q31(
+  riscv_welch_instance_q31 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  uint8_t crossFlag,
+  const q31_t * pWindow,
+  q31_t * pRing,
+  q31_t * pScratch,
+  q63_t * pAcc)
+{
+  RISCV_PROFILE(riscv_welch_init_q31);
+  riscv_status status;
+  uint32_t numChannels = (crossFlag != 0u) ? 2u : 1u;
+
+  if((hopSize == 0u) || (hopSize > fftLen))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  Initialize the real FFT of a segment */
+  status = riscv_rfft_fast_init_q31(&S->Srfft, fftLen);
+
+  if(status != RISCV_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->fftLen = fftLen;
+  S->hopSize = hopSize;
+  S->writeIndex = 0u;
+  S->samplesToSegment = fftLen;
+  S->crossFlag = (crossFlag != 0u) ? 1u : 0u;
+  S->pWindow = pWindow;
+  S->pRing = pRing;
+  S->pScratch = pScratch;
+  S->pAcc = pAcc;
+
+  /*  Clear the ring buffers and the accumulators */
+  riscv_fill_q31(0, pRing, numChannels * fftLen);
+  riscv_welch_reset_q31(S);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of Welch group
+*/
@@ -0,0 +1,294 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_welch_q31.c
+*
+* Description:  Q31 Welch power and cross spectral density estimate.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/*
+* @brief  Copies the segment of a channel out of its ring buffer and applies the window.
+* @param[in]  *S     points to an instance of the Q31 Welch structure.
+* @param[in]  *pRing points to the ring buffer of the channel.
+* @param[out] *pOut  points to the segment.
+*/
+
+static void riscv_welch_window_q31(
+  const riscv_welch_instance_q31 * S,
+  const q31_t * pRing,
+  q31_t * pOut)
+{
+  const q31_t *pWin = S->pWindow;                /* Window pointer */
+  const q31_t *pIn = pRing + S->writeIndex;      /* Ring pointer */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = (uint32_t) S->fftLen - S->writeIndex;
+
+  while(blkCnt > 0u)
+  {
+    *pOut++ = (q31_t) (((q63_t) *pIn++ * *pWin++) >> 31);
+    blkCnt--;
+  }
+
+  pIn = pRing;
+  blkCnt = S->writeIndex;
+
+  while(blkCnt > 0u)
+  {
+    *pOut++ = (q31_t) (((q63_t) *pIn++ * *pWin++) >> 31);
+    blkCnt--;
+  }
+}
+
+/*
+* Bin k, 0 < k < fftLen/2, of the real FFT from the output of the complex FFT,
+* with the split coefficients of stage_rfft_q31().
+*/
+static inline void riscv_welch_bin_q31(
+  const q31_t * p,
+  const q31_t * pCoeff,
+  uint32_t L,
+  uint32_t k,
+  q31_t * pRe,
+  q31_t * pIm)
+{
+  q31_t aR = p[2u * k];
+  q31_t aI = p[(2u * k) + 1u];
+  q31_t bR = p[2u * (L - k)];
+  q31_t bI = p[(2u * (L - k)) + 1u];
+  q31_t coefA1 = 0x40000000 - (pCoeff[2u * k] >> 1);
+  q31_t coefA2 = -(pCoeff[(2u * k) + 1u] >> 1);
+  q31_t coefB1 = 0x40000000 + (pCoeff[2u * k] >> 1);
+
+  *pRe = (q31_t) ((((q63_t) aR * coefA1) - ((q63_t) aI * coefA2) - ((q63_t) bI * coefA2) + ((q63_t) bR * coefB1)) >> 32);
+  *pIm = (q31_t) ((((q63_t) aR * coefA2) + ((q63_t) aI * coefA1) - ((q63_t) bI * coefB1) - ((q63_t) bR * coefA2)) >> 32);
+}
+
+/*
+* @brief  Split stage of the real FFT that accumulates the spectra of a segment.
+* @param[in,out] *S  points to an instance of the Q31 Welch structure.
+*
+* The products of two 1.31 values are accumulated as 17.47 values.
+*/
+
+static void riscv_welch_split_q31(
+  riscv_welch_instance_q31 * S)
+{
+  uint32_t L = (S->Srfft).Sint.fftLen;           /* Length of the complex FFT */
+  const q31_t *pCoeff = S->Srfft.pTwiddleRFFT;   /* RFFT twiddle factors */
+  const q31_t *pX = S->pScratch;                 /* Complex FFT of the first channel */
+  const q31_t *pY = S->pScratch + (2u * L);      /* Complex FFT of the second channel */
+  q63_t *pXX = S->pAcc;                          /* |X|^2 accumulators */
+  q63_t *pYY = pXX + (L + 1u);                   /* |Y|^2 accumulators */
+  q63_t *pXY = pYY + (L + 1u);                   /* X*conj(Y) accumulators */
+  q31_t xr, xi, yr, yi;
+  uint32_t k;
+
+  /* DC and Nyquist bins are real */
+  xr = (pX[0] >> 1) + (pX[1] >> 1);
+  xi = (pX[0] >> 1) - (pX[1] >> 1);
+  pXX[0] += ((q63_t) xr * xr) >> 15;
+  pXX[L] += ((q63_t) xi * xi) >> 15;
+
+  if(S->crossFlag == 0u)
+  {
+    for (k = 1u; k < L; k++)
+    {
+      riscv_welch_bin_q31(pX, pCoeff, L, k, &xr, &xi);
+      pXX[k] += (((q63_t) xr * xr) + ((q63_t) xi * xi)) >> 15;
+    }
+  }
+  else
+  {
+    yr = (pY[0] >> 1) + (pY[1] >> 1);
+    yi = (pY[0] >> 1) - (pY[1] >> 1);
+    pYY[0] += ((q63_t) yr * yr) >> 15;
+    pYY[L] += ((q63_t) yi * yi) >> 15;
+    pXY[0] += ((q63_t) xr * yr) >> 15;
+    pXY[2u * L] += ((q63_t) xi * yi) >> 15;
+
+    for (k = 1u; k < L; k++)
+    {
+      riscv_welch_bin_q31(pX, pCoeff, L, k, &xr, &xi);
+      riscv_welch_bin_q31(pY, pCoeff, L, k, &yr, &yi);
+      pXX[k] += (((q63_t) xr * xr) + ((q63_t) xi * xi)) >> 15;
+      pYY[k] += (((q63_t) yr * yr) + ((q63_t) yi * yi)) >> 15;
+      pXY[2u * k] += (((q63_t) xr * yr) + ((q63_t) xi * yi)) >> 15;
+      pXY[(2u * k) + 1u] += (((q63_t) xi * yr) - ((q63_t) xr * yi)) >> 15;
+    }
+  }
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Welch
+ * @{
+ */
+
+/**
+* @brief Processing function for the Q31 Welch estimate.
+* @param[in,out] *S         points to an instance of the Q31 Welch structure.
+* @param[in]     *pSrcX     points to the block of samples of the first channel.
+* @param[in]     *pSrcY     points to the block of samples of the second channel, or NULL without crossFlag.
+* @param[in]     blockSize  number of samples to push.
+* @return        number of segments added to the average.
+*
+* The 64-bit accumulators hold at least 32768 full-scale segments, reset the average before that.
+*/
+
+uint32_t riscv_welch_q31(
+  riscv_welch_instance_q31 * S,
+  const q31_t * pSrcX,
+  const q31_t * pSrcY,
+  uint32_t blockSize)
+{
+  RISCV_PROFILE(riscv_welch_q31);
+  uint32_t fftLen = S->fftLen;
+  uint32_t numSegments = 0u;                     /* Number of segments added */
+  uint32_t blkCnt, i;                            /* Loop counters */
+  q31_t *pRing;                                  /* Ring buffer write pointer */
+
+  while(blockSize > 0u)
+  {
+    /*  Push samples up to the next segment or the end of the ring */
+    blkCnt = fftLen - S->writeIndex;
+
+    if(blkCnt > S->samplesToSegment)
+    {
+      blkCnt = S->samplesToSegment;
+    }
+
+    if(blkCnt > blockSize)
+    {
+      blkCnt = blockSize;
+    }
+
+    pRing = S->pRing + S->writeIndex;
+
+    for (i = 0u; i < blkCnt; i++)
+    {
+      pRing[i] = pSrcX[i];
+    }
+    pSrcX += blkCnt;
+
+    if(S->crossFlag != 0u)
+    {
+      pRing += fftLen;
+
+      for (i = 0u; i < blkCnt; i++)
+      {
+        pRing[i] = pSrcY[i];
+      }
+      pSrcY += blkCnt;
+    }
+
+    blockSize -= blkCnt;
+    S->samplesToSegment -= (uint16_t) blkCnt;
+    S->writeIndex += (uint16_t) blkCnt;
+
+    if(S->writeIndex == fftLen)
+    {
+      S->writeIndex = 0u;
+    }
+
+    if(S->samplesToSegment == 0u)
+    {
+      /*  Window, transform and accumulate the segment */
+      riscv_welch_window_q31(S, S->pRing, S->pScratch);
+      riscv_cfft_q31(&(S->Srfft.Sint), S->pScratch, 0u, 1u);
+
+      if(S->crossFlag != 0u)
+      {
+        riscv_welch_window_q31(S, S->pRing + fftLen, S->pScratch + fftLen);
+        riscv_cfft_q31(&(S->Srfft.Sint), S->pScratch + fftLen, 0u, 1u);
+      }
+
+      riscv_welch_split_q31(S);
+
+      S->numSegments++;
+      numSegments++;
+      S->samplesToSegment = S->hopSize;
+    }
+  }
+
+  return (numSegments);
+}
+
+/**
+* @brief Average power spectrum of the first channel, or of the second with crossFlag.
+* @param[in]  *S        points to an instance of the Q31 Welch structure.
+* @param[in]  channel   0 for the first channel, 1 for the second.
+* @param[out] *pDst     points to the <code>fftLen/2+1</code> output bins.
+* @return none.
+*
+* Bin k is the average over the segments of |X(k)/fftLen|^2, where X is the transform of the windowed
+* segment.  Multiplied by fftLen^2 divided by the sum of the squared window values, and doubled for
+* the bins other than DC and Nyquist, it is the one-sided density of riscv_welch_psd_f32().
+*/
+
+void riscv_welch_psd_q31(
+  const riscv_welch_instance_q31 * S,
+  uint8_t channel,
+  q31_t * pDst)
+{
+  uint32_t L = (uint32_t) S->fftLen >> 1u;
+  const q63_t *pAcc = S->pAcc + ((channel != 0u) ? (L + 1u) : 0u);
+  uint32_t k;
+
+  for (k = 0u; k <= L; k++)
+  {
+    pDst[k] = (S->numSegments == 0u) ? 0 : clip_q63_to_q31((pAcc[k] / (q63_t) S->numSegments) >> 16);
+  }
+}
+
+/**
+* @brief Average cross spectrum of the two channels, the average of X*conj(Y)/fftLen^2.
+* @param[in]  *S        points to an instance of the Q31 Welch structure initialized with crossFlag.
+* @param[out] *pDst     points to the <code>fftLen/2+1</code> complex output bins.
+* @return none.
+*
+* The bins are scaled like those of riscv_welch_psd_q31().
+*/
+
+void riscv_welch_csd_q31(
+  const riscv_welch_instance_q31 * S,
+  q31_t * pDst)
+{
+  uint32_t L = (uint32_t) S->fftLen >> 1u;
+  const q63_t *pAcc = S->pAcc + (2u * (L + 1u));
+  uint32_t k;
+
+  for (k = 0u; k < (2u * (L + 1u)); k++)
+  {
+    pDst[k] = (S->numSegments == 0u) ? 0 : clip_q63_to_q31((pAcc[k] / (q63_t) S->numSegments) >> 16);
+  }
+}
+
+/**
+* @brief Restarts the average, the samples in the ring buffers are kept.
+* @param[in,out] *S  points to an instance of the Q31 Welch structure.
+* @return none.
+*/
+
+void riscv_welch_reset_q31(
+  riscv_welch_instance_q31 * S)
+{
+  uint32_t L = (uint32_t) S->fftLen >> 1u;
+  uint32_t k;
+
+  for (k = 0u; k < (((S->crossFlag != 0u) ? 4u : 1u) * (L + 1u)); k++)
+  {
+    S->pAcc[k] = 0;
+  }
+  S->numSegments = 0u;
+}
+
+/**
+* @} end of Welch group
+*/
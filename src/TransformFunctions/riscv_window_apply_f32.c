@@ -0,0 +1,61 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_window_apply_f32.c
+*
+* Description:  Applies a floating-point half window table.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Window
+ * @{
+ */
+
+/**
+* @brief  Multiplies a floating-point frame by a window.
+* @param[in]  *pSrc       points to the frame of <code>windowLen</code> samples.
+* @param[in]  *pWindow    points to the half table of riscv_window_f32().
+* @param[out] *pDst       points to the windowed frame.
+* @param[in]  windowLen   length of the window and of the frame.
+* @return none.
+*
+* <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+*/
+
+void riscv_window_apply_f32(
+  float32_t * pSrc,
+  const float32_t * pWindow,
+  float32_t * pDst,
+  uint32_t windowLen)
+{
+  RISCV_PROFILE(riscv_window_apply_f32);
+  float32_t *pSrcEnd = pSrc + windowLen;         /* Second half, read backwards */
+  float32_t *pDstEnd = pDst + windowLen;
+  float32_t w;                                   /* Window sample */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /*  Both halves in one pass, one table read for two samples */
+  for (blkCnt = windowLen / 2u; blkCnt > 0u; blkCnt--)
+  {
+    w = *pWindow++;
+    *pDst++ = *pSrc++ * w;
+    *--pDstEnd = *--pSrcEnd * w;
+  }
+
+  /*  Centre sample of an odd window */
+  if((windowLen & 1u) != 0u)
+  {
+    *pDst = *pSrc * *pWindow;
+  }
+}
+
+/**
+* @} end of Window group
+*/
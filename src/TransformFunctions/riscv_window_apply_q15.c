@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_window_apply_q15.c
+*
+* Description:  Applies a Q15 half window table.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Window
+ * @{
+ */
+
+/**
+* @brief  Multiplies a Q15 frame by a window.
+* @param[in]  *pSrc       points to the frame of <code>windowLen</code> samples.
+* @param[in]  *pWindow    points to the half table of riscv_window_q15().
+* @param[out] *pDst       points to the windowed frame.
+* @param[in]  windowLen   length of the window and of the frame.
+* @return none.
+*
+* \par
+* The products are shifted right by 15 bits.  The window samples are not larger than 0x7FFF,
+* so the results fit the Q15 range without saturation.  With <code>USE_DSP_RISCV</code> the
+* multiplication and the shift are one <code>p.mulsN</code>.
+* <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+*/
+
+void riscv_window_apply_q15(
+  q15_t * pSrc,
+  const q15_t * pWindow,
+  q15_t * pDst,
+  uint32_t windowLen)
+{
+  RISCV_PROFILE(riscv_window_apply_q15);
+  q15_t *pSrcEnd = pSrc + windowLen;             /* Second half, read backwards */
+  q15_t *pDstEnd = pDst + windowLen;
+  q15_t w;                                       /* Window sample */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /*  Both halves in one pass, one table read for two samples */
+  for (blkCnt = windowLen / 2u; blkCnt > 0u; blkCnt--)
+  {
+    w = *pWindow++;
+#if defined (USE_DSP_RISCV)
+    *pDst++ = (q15_t) mulsN(*pSrc++, w, 15);
+    *--pDstEnd = (q15_t) mulsN(*--pSrcEnd, w, 15);
+#else
+    *pDst++ = (q15_t) (((q31_t) *pSrc++ * w) >> 15);
+    *--pDstEnd = (q15_t) (((q31_t) *--pSrcEnd * w) >> 15);
+#endif
+  }
+
+  /*  Centre sample of an odd window */
+  if((windowLen & 1u) != 0u)
+  {
+    *pDst = (q15_t) (((q31_t) *pSrc * *pWindow) >> 15);
+  }
+}
+
+/**
+* @} end of Window group
+*/
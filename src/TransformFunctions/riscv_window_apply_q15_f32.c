@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_window_apply_q15_f32.c
+*
+* Description:  Converts a Q15 frame to floating-point and applies a
+*               floating-point half window table.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Window
+ * @{
+ */
+
+/**
+* @brief  Converts a Q15 frame to floating-point and multiplies it by a window.
+* @param[in]  *pSrc       points to the Q15 frame of <code>windowLen</code> samples.
+* @param[in]  *pWindow    points to the half table of riscv_window_f32().
+* @param[out] *pDst       points to the windowed floating-point frame.
+* @param[in]  windowLen   length of the window and of the frame.
+* @return none.
+*
+* \par
+* Computes <code>pDst[n] = (pSrc[n] / 32768) * w[n]</code>, the output of riscv_q15_to_float()
+* followed by riscv_window_apply_f32() in one pass, e.g. from the ADC buffer to the input of
+* riscv_rfft_fast_f32().  The scale by 1/32768 is folded into the window sample, one
+* multiplication per table read.
+*/
+
+void riscv_window_apply_q15_f32(
+  q15_t * pSrc,
+  const float32_t * pWindow,
+  float32_t * pDst,
+  uint32_t windowLen)
+{
+  RISCV_PROFILE(riscv_window_apply_q15_f32);
+  q15_t *pSrcEnd = pSrc + windowLen;             /* Second half, read backwards */
+  float32_t *pDstEnd = pDst + windowLen;
+  float32_t w;                                   /* Scaled window sample */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /*  Both halves in one pass, one table read for two samples */
+  for (blkCnt = windowLen / 2u; blkCnt > 0u; blkCnt--)
+  {
+    w = *pWindow++ * (1.0f / 32768.0f);
+    *pDst++ = (float32_t) *pSrc++ * w;
+    *--pDstEnd = (float32_t) *--pSrcEnd * w;
+  }
+
+  /*  Centre sample of an odd window */
+  if((windowLen & 1u) != 0u)
+  {
+    *pDst = (float32_t) *pSrc * (*pWindow * (1.0f / 32768.0f));
+  }
+}
+
+/**
+* @} end of Window group
+*/
@@ -0,0 +1,64 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_window_apply_q31.c
+*
+* Description:  Applies a Q31 half window table.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Window
+ * @{
+ */
+
+/**
+* @brief  Multiplies a Q31 frame by a window.
+* @param[in]  *pSrc       points to the frame of <code>windowLen</code> samples.
+* @param[in]  *pWindow    points to the half table of riscv_window_q31().
+* @param[out] *pDst       points to the windowed frame.
+* @param[in]  windowLen   length of the window and of the frame.
+* @return none.
+*
+* \par
+* The products are computed in 64 bits and shifted right by 31 bits.  The window samples are
+* not larger than 0x7FFFFFFF, so the results fit the Q31 range without saturation.
+* <code>pSrc</code> and <code>pDst</code> may point to the same buffer.
+*/
+
+void riscv_window_apply_q31(
+  q31_t * pSrc,
+  const q31_t * pWindow,
+  q31_t * pDst,
+  uint32_t windowLen)
+{
+  RISCV_PROFILE(riscv_window_apply_q31);
+  q31_t *pSrcEnd = pSrc + windowLen;             /* Second half, read backwards */
+  q31_t *pDstEnd = pDst + windowLen;
+  q31_t w;                                       /* Window sample */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /*  Both halves in one pass, one table read for two samples */
+  for (blkCnt = windowLen / 2u; blkCnt > 0u; blkCnt--)
+  {
+    w = *pWindow++;
+    *pDst++ = (q31_t) (((q63_t) *pSrc++ * w) >> 31);
+    *--pDstEnd = (q31_t) (((q63_t) *--pSrcEnd * w) >> 31);
+  }
+
+  /*  Centre sample of an odd window */
+  if((windowLen & 1u) != 0u)
+  {
+    *pDst = (q31_t) (((q63_t) *pSrc * *pWindow) >> 31);
+  }
+}
+
+/**
+* @} end of Window group
+*/
@@ -0,0 +1,185 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_window_f32.c
+*
+* Description:  Floating-point window generator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Window Window Functions
+ *
+ * \par
+ * The window generators compute the Hann, Hamming, Blackman, Kaiser and sine windows of
+ * <code>windowLen</code> samples and store only their first half: the windows are symmetric,
+ * <code>w[windowLen-1-n] = w[n]</code>, so a table of <code>(windowLen+1)/2</code> values holds
+ * the whole window.
+ * <pre>
+ *    Hann       w[n] = 0.5 - 0.5*cos(2*pi*n/(windowLen-1))
+ *    Hamming    w[n] = 0.54 - 0.46*cos(2*pi*n/(windowLen-1))
+ *    Blackman   w[n] = 0.42 - 0.5*cos(2*pi*n/(windowLen-1)) + 0.08*cos(4*pi*n/(windowLen-1))
+ *    Kaiser     w[n] = I0(beta*sqrt(1 - (2*n/(windowLen-1) - 1)^2)) / I0(beta)
+ *    Sine       w[n] = sin(pi*(n+0.5)/windowLen)
+ * </pre>
+ * \par
+ * The sine window of even length 2N has <code>w[n]^2 + w[n+N]^2 = 1</code>, the condition for the
+ * time-domain aliasing cancellation of the MDCT, which the generator keeps to rounding by computing
+ * the second quarter from the first.  Its half table is the window riscv_mdct_init_f32() and
+ * riscv_mdct_init_q31() take.
+ * \par
+ * The window apply functions multiply a frame by a half table, the first half of the frame in
+ * forward order and the second half in reverse order, and convert the frame in the same pass:
+ * riscv_window_apply_q15_f32() turns Q15 ADC samples into the windowed floating-point input of
+ * riscv_rfft_fast_f32() without an intermediate buffer.  Applying a half table to a frame of ones
+ * expands it to the full table that riscv_stft_init_f32() takes.
+ * \par
+ * The cosines come from riscv_cos_f32(), the Kaiser window sums the power series of the modified
+ * Bessel function <code>I0</code> to single precision.  The Q31 and Q15 tables are the floating-point
+ * ones converted, with 1.0 saturated to the largest positive value.
+ */
+
+/**
+ * @addtogroup Window
+ * @{
+ */
+
+/**
+* @brief  Modified Bessel function of the first kind and order 0.
+*/
+
+static float32_t riscv_window_i0_f32(
+  float32_t x)
+{
+  float32_t q = 0.25f * x * x;                   /* (x/2)^2 */
+  float32_t term = 1.0f, sum = 1.0f;
+  uint32_t k;
+
+  for (k = 1u; (k < 64u) && (term > (sum * 1e-8f)); k++)
+  {
+    term *= q / (float32_t) (k * k);
+    sum += term;
+  }
+
+  return (sum);
+}
+
+/**
+* @brief  Computes the window samples first ... first+count-1.
+* @param[in]  type       window.
+* @param[in]  beta       shape parameter of the Kaiser window.
+* @param[in]  windowLen  length of the window.
+* @param[in]  first      first sample to compute.
+* @param[in]  count      number of samples.
+* @param[out] *pDst      points to the samples.
+* @return none.
+*
+* This function is also used by riscv_window_q31() and riscv_window_q15().
+*/
+
+void riscv_window_range_f32(
+  riscv_window_type type,
+  float32_t beta,
+  uint32_t windowLen,
+  uint32_t first,
+  uint32_t count,
+  float32_t * pDst)
+{
+  float32_t step, x, r, inv = 1.0f;
+  uint32_t n;
+
+  if(windowLen < 2u)
+  {
+    riscv_fill_f32(1.0f, pDst, count);
+    return;
+  }
+
+  step = (2.0f * PI) / (float32_t) (windowLen - 1u);
+
+  if(type == RISCV_WINDOW_KAISER)
+  {
+    inv = 1.0f / riscv_window_i0_f32(beta);
+  }
+
+  for (n = first; n < (first + count); n++)
+  {
+    x = step * (float32_t) n;
+
+    switch (type)
+    {
+      case RISCV_WINDOW_HANN:
+        *pDst++ = 0.5f - (0.5f * riscv_cos_f32(x));
+        break;
+
+      case RISCV_WINDOW_HAMMING:
+        *pDst++ = 0.54f - (0.46f * riscv_cos_f32(x));
+        break;
+
+      case RISCV_WINDOW_BLACKMAN:
+        *pDst++ = (0.42f - (0.5f * riscv_cos_f32(x))) + (0.08f * riscv_cos_f32(2.0f * x));
+        break;
+
+      case RISCV_WINDOW_SINE:
+        if(((windowLen & 1u) == 0u) && ((4u * n) >= windowLen))
+        {
+          /*  From the sample it pairs with, so that w[n]^2 + w[n+windowLen/2]^2 = 1 holds to rounding */
+          x = riscv_sin_f32((PI * ((float32_t) ((windowLen / 2u) - 1u - n) + 0.5f)) / (float32_t) windowLen);
+          riscv_sqrt_f32(1.0f - (x * x), pDst++);
+        }
+        else
+        {
+          *pDst++ = riscv_sin_f32((PI * ((float32_t) n + 0.5f)) / (float32_t) windowLen);
+        }
+        break;
+
+      default:
+        /*  r runs from -1 to 1 over the window */
+        r = ((2.0f * (float32_t) n) / (float32_t) (windowLen - 1u)) - 1.0f;
+        riscv_sqrt_f32(1.0f - (r * r), &x);
+        *pDst++ = riscv_window_i0_f32(beta * x) * inv;
+        break;
+    }
+  }
+}
+
+/**
+* @brief  Floating-point window generator.
+* @param[in]  type       window.
+* @param[in]  beta       shape parameter of the Kaiser window, ignored by the other windows.
+* @param[in]  windowLen  length of the window.
+* @param[out] *pDst      points to the half table of <code>(windowLen+1)/2</code> values.
+* @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>windowLen</code> is 0,
+* <code>type</code> is unknown or <code>beta</code> is negative.
+*
+* \par
+* A <code>beta</code> of 8.6 gives the sidelobe level of the Blackman window, 5 about that of the
+* Hamming window and 0 the rectangular window.
+*/
+
+riscv_status riscv_window_f32(
+  riscv_window_type type,
+  float32_t beta,
+  uint32_t windowLen,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_window_f32);
+
+  if((windowLen == 0u) || (type > RISCV_WINDOW_SINE) || (beta < 0.0f))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  riscv_window_range_f32(type, beta, windowLen, 0u, (windowLen + 1u) / 2u, pDst);
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of Window group
+*/
@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_window_q15.c
+*
+* Description:  Q15 window generator.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+extern void riscv_window_range_f32(
+  riscv_window_type type,
+  float32_t beta,
+  uint32_t windowLen,
+  uint32_t first,
+  uint32_t count,
+  float32_t * pDst);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Window
+ * @{
+ */
+
+/* Samples computed in floating-point per pass */
+#define RISCV_WINDOW_CHUNK  32u
+
+/**
+* @brief  Q15 window generator.
+* @param[in]  type       window.
+* @param[in]  beta       shape parameter of the Kaiser window, ignored by the other windows.
+* @param[in]  windowLen  length of the window.
+* @param[out] *pDst      points to the half table of <code>(windowLen+1)/2</code> values.
+* @return     RISCV_MATH_SUCCESS, or RISCV_MATH_ARGUMENT_ERROR if <code>windowLen</code> is 0,
+* <code>type</code> is unknown or <code>beta</code> is negative.
+*
+* \par
+* The samples are computed as in riscv_window_f32(), in chunks of RISCV_WINDOW_CHUNK values on the
+* stack, and converted with riscv_float_to_q15(), which saturates 1.0.
+*/
+
+riscv_status riscv_window_q15(
+  riscv_window_type type,
+  float32_t beta,
+  uint32_t windowLen,
+  q15_t * pDst)
+{
+  RISCV_PROFILE(riscv_window_q15);
+  float32_t buf[RISCV_WINDOW_CHUNK];             /* Floating-point samples */
+  uint32_t half = (windowLen + 1u) / 2u;         /* Length of the half table */
+  uint32_t n, count;
+
+  if((windowLen == 0u) || (type > RISCV_WINDOW_SINE) || (beta < 0.0f))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  for (n = 0u; n < half; n += count)
+  {
+    count = ((half - n) < RISCV_WINDOW_CHUNK) ? (half - n) : RISCV_WINDOW_CHUNK;
+    riscv_window_range_f32(type, beta, windowLen, n, count, buf);
+    riscv_float_to_q15(buf, pDst + n, count);
+  }
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of Window group
+*/
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_zoom_fft_f32.c
+*
+* Description:  Floating-point zoom FFT, complex mixer, decimator and a
+*               short CFFT.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup ZoomFFT Zoom FFT
+ *
+ * The zoom FFT analyzes a band of 1/decimation cycles per sample around centerFreq at a resolution
+ * of 1/(decimation*fftLen) cycles per sample, the resolution of a decimation*fftLen-point FFT, with
+ * an fftLen-point CFFT and a working set of a frame:
+ * <ol>
+ * <li>riscv_cmix_f32() moves the centre of the band to 0 Hz,</li>
+ * <li>a complex lowpass FIR decimator keeps every decimation-th output,</li>
+ * <li>every fftLen decimated samples, the frame is windowed and transformed.</li>
+ * </ol>
+ * The input is streamed in blocks; a frame takes decimation*fftLen input samples and the frames
+ * do not overlap.  For 0.1 Hz bins over 200 Hz at 8 kHz, decimation = 40 and fftLen = 2048 replace
+ * an 80k-point FFT.
+ *
+ * \par
+ * The spectrum of a frame is output centred: bin j is at centerFreq + (j - fftLen/2)/(decimation*fftLen)
+ * cycles per sample.  See also the \ref ChirpZ, which zooms on a block that is already in memory.
+ */
+
+/**
+ * @addtogroup ZoomFFT
+ * @{
+ */
+
+/**
+* @brief  Floating-point zoom FFT.
+* @param[in,out]  *S     points to an instance of the floating-point zoom FFT structure.
+* @param[in]      *pSrc  points to the <code>blockSize</code> complex input samples.
+* @param[out]     *pDst  points to the output spectra, <code>2*fftLen</code> values each.
+* @return number of spectra written to pDst, at most <code>blockSize/(decimation*fftLen)</code> rounded up.
+*/
+
+uint32_t riscv_zoom_fft_f32(
+  riscv_zoom_fft_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  RISCV_PROFILE(riscv_zoom_fft_f32);
+  uint32_t fftLen = S->pCfft->fftLen;
+  uint32_t numTaps = S->numTaps;
+  uint32_t decimation = S->decimation;
+  uint32_t blockSize = S->blockSize;
+  uint32_t frameIndex = S->frameIndex;
+  const float32_t *pCoeffs = S->pCoeffs;
+  float32_t *pState = S->pState;
+  float32_t *pFrame = S->pFrame;
+  const float32_t *px;
+  float32_t accRe, accIm, c;
+  uint32_t i, t, numFrames = 0u;
+
+  /*  Mix the block behind the last numTaps-1 samples */
+  riscv_cmix_f32(&S->Snco, (float32_t *) pSrc, &pState[2u * (numTaps - 1u)], blockSize);
+
+  for (i = decimation - 1u; i < blockSize; i += decimation)
+  {
+    /*  Lowpass output at sample i, real coefficients on the complex samples */
+    px = &pState[2u * i];
+    accRe = 0.0f;
+    accIm = 0.0f;
+    for (t = 0u; t < numTaps; t++)
+    {
+      c = pCoeffs[t];
+      accRe += c * px[2u * t];
+      accIm += c * px[(2u * t) + 1u];
+    }
+
+    pFrame[2u * frameIndex] = accRe;
+    pFrame[(2u * frameIndex) + 1u] = accIm;
+    frameIndex++;
+
+    if(frameIndex == fftLen)
+    {
+      if(S->pWindow != NULL)
+      {
+        riscv_cmplx_mult_real_f32(pFrame, (float32_t *) S->pWindow, pFrame, fftLen);
+      }
+      riscv_cfft_f32(S->pCfft, pFrame, 0u, 1u);
+
+      /*  Negative frequencies first */
+      riscv_copy_f32(&pFrame[fftLen], pDst, fftLen);
+      riscv_copy_f32(pFrame, &pDst[fftLen], fftLen);
+      pDst += 2u * fftLen;
+
+      frameIndex = 0u;
+      numFrames++;
+    }
+  }
+
+  /*  Keep the last numTaps-1 samples for the next block */
+  for (t = 0u; t < (2u * (numTaps - 1u)); t++)
+  {
+    pState[t] = pState[(2u * blockSize) + t];
+  }
+
+  S->frameIndex = (uint16_t) frameIndex;
+
+  return (numFrames);
+}
+
+/**
+* @} end of ZoomFFT group
+*/
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_zoom_fft_init_f32.c
+*
+* Description:  Initialization function for the floating-point zoom FFT.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ZoomFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point zoom FFT.
+* @param[out]    *S           points to an instance of the floating-point zoom FFT structure.
+* @param[in]     centerFreq   centre of the band in cycles per sample.
+* @param[in]     decimation   decimation factor, the band is 1/decimation cycles per sample wide.
+* @param[in]     numTaps      number of coefficients of the lowpass filter.
+* @param[in]     *pCoeffs     points to the lowpass coefficients, stored in time reversed order as for riscv_fir_decimate_f32().
+* @param[in]     *pWindow     points to the window of fftLen values applied to a frame, or NULL for none.
+* @param[in]     *pCfft       points to the CFFT instance of a frame.
+* @param[in]     blockSize    number of complex samples per call, a multiple of <code>decimation</code>.
+* @param[in]     *pState      points to the state buffer of <code>2*(numTaps+blockSize-1)</code> words.
+* @param[in]     *pFrame      points to the frame buffer of <code>2*fftLen</code> words.
+* @return        The function returns RISCV_MATH_SUCCESS if initialization is successful or RISCV_MATH_ARGUMENT_ERROR if
+* <code>blockSize</code> is not a multiple of <code>decimation</code>.
+*
+* \par Description:
+* The lowpass filter should pass the band, half of 1/decimation on each side of 0 Hz, and stop the
+* rest, as for a decimator.  The state is cleared and the first frame starts with the first sample.
+* The buffers must stay valid as long as the instance is used.
+*/
+
+riscv_status riscv_zoom_fft_init_f32(
+  riscv_zoom_fft_instance_f32 * S,
+  float32_t centerFreq,
+  uint16_t decimation,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  const float32_t * pWindow,
+  const riscv_cfft_instance_f32 * pCfft,
+  uint32_t blockSize,
+  float32_t * pState,
+  float32_t * pFrame)
+{
+  RISCV_PROFILE(riscv_zoom_fft_init_f32);
+
+  if((decimation == 0u) || (numTaps == 0u) || ((blockSize % decimation) != 0u))
+  {
+    return (RISCV_MATH_ARGUMENT_ERROR);
+  }
+
+  /*  The mixer turns by -centerFreq per sample */
+  riscv_nco_init_f32(&S->Snco, 0.0f, -6.283185307179586f * centerFreq);
+
+  S->decimation = decimation;
+  S->numTaps = numTaps;
+  S->blockSize = blockSize;
+  S->frameIndex = 0u;
+  S->pCoeffs = pCoeffs;
+  S->pWindow = pWindow;
+  S->pCfft = pCfft;
+  S->pState = pState;
+  S->pFrame = pFrame;
+
+  /*  Clear the state */
+  riscv_fill_f32(0.0f, pState, 2u * (numTaps - 1u));
+
+  return (RISCV_MATH_SUCCESS);
+}
+
+/**
+* @} end of ZoomFFT group
+*/
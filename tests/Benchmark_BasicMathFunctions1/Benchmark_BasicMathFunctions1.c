@@ -13,32 +13,15 @@ printf("\n\n")
 printf("\n\n")
 //#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
 #define MAX_BLOCKSIZE     32
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 /*
-  Benchmarking now is done with bench library, these were old functions
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
-*Also the correct results are printed for the current vectors which are calculated from the orignal library 
+*Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "BasicMathFunctions1"
+#include "../common/riscv_bench.h"
  float32_t srcA_buf_f32[MAX_BLOCKSIZE] =
 {
   -0.4325648115282207,  -1.6655843782380970,  0.1253323064748307,
@@ -169,34 +152,23 @@ float32_t result_f32_1;
 int i = 0 ;
 int32_t main(void)
 {
+  riscv_bench_header();
 
  /*Init*/ 
  /* 
-  set_pin_function(5, FUNC_GPIO);
-  set_gpio_pin_direction(5, DIR_OUT);
-  set_pin_function(6, FUNC_GPIO);
-  set_gpio_pin_direction(6, DIR_OUT);
-  CLR_GPIO_5() ;
-  CLR_GPIO_6() ;
 */
 /*Tests*/
 /*abs*/
 
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_abs_f32( srcA_buf_f32,result_f32,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_abs_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_abs_f32", "f32", MAX_BLOCKSIZE,
+    riscv_abs_f32( srcA_buf_f32,result_f32,MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_abs_q7(srcA_buf_q7,result_q7,MAX_BLOCKSIZE);
-  printf("riscv_abs_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
-  perf_stop();
+  RISCV_BENCH("riscv_abs_q7", "q7", MAX_BLOCKSIZE,
+    riscv_abs_q7(srcA_buf_q7,result_q7,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
 /*Results from pulpino were compared with results from RISCV m4 and also were checked by hand*/
@@ -204,22 +176,16 @@ int32_t main(void)
   printf("0x75 0x13 0x15 0x44 0x11 0x1C 0x52 0x0B 0x7D 0x6F 0x33  0x25 0x1A 0x4D 0x6F 0x26 0x01 0x0F 0x54 0x66 0x76 0x54 0x79  0x36 0x22 0x33 0x1F 0x61 0x54 0x35 0x6F 0x49");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_abs_q15(srcA_buf_q15,result_q15,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_abs_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_abs_q15", "q15", MAX_BLOCKSIZE,
+    riscv_abs_q15(srcA_buf_q15,result_q15,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
   printf("\nCorrect answer:\n");
   printf("0x7512 0x1375 0x1565 0x44C3 0x1188 0x1CA1 0x5264 0x0B20 0x7CFB 0x6EEE 0x3399 0x2518 0x1AB2 0x4D01 0x6F23 0x26FF 0x0121 0x0EDD 0x53B9 0x6688 0x76A2 0x5476 0x78AA 0x36B3 0x2245 0x3373 0x1E57 0x610A 0x5419 0x3501 0x6F00 0x4469");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_abs_q31(srcA_buf_q31,result_q31,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_abs_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_abs_q31", "q31", MAX_BLOCKSIZE,
+    riscv_abs_q31(srcA_buf_q31,result_q31,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
   printf("\nCorrect answer:\n");
@@ -229,19 +195,13 @@ int32_t main(void)
 
 /*add*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_add_f32(srcA_buf_f32, srcB_buf_f32, result_f32, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_add_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_add_f32", "f32", MAX_BLOCKSIZE,
+    riscv_add_f32(srcA_buf_f32, srcB_buf_f32, result_f32, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_add_q7(srcA_buf_q7, srcB_buf_q7, result_q7, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_add_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_add_q7", "q7", MAX_BLOCKSIZE,
+    riscv_add_q7(srcA_buf_q7, srcB_buf_q7, result_q7, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
 /*negatvie number are printed with FFFFFF before it because it is signed*/
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
@@ -249,11 +209,8 @@ int32_t main(void)
   printf("0x7F 0x26 0x2A 0x7F 0x22 0x38 0x7F 0x16 0x80 0x80 0x66 0x4A 0x34 0x7F 0x7F 0x4C 0x2 0xE2 0x80 0x7F 0x7F 0x7F 0x80 0x6C 0x44 0x66 0xC2 0x7F 0x7F 0x6A 0x80 0x7F");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_add_q15(srcA_buf_q15, srcB_buf_q15, result_q15, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_add_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_add_q15", "q15", MAX_BLOCKSIZE,
+    riscv_add_q15(srcA_buf_q15, srcB_buf_q15, result_q15, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
@@ -261,11 +218,8 @@ int32_t main(void)
   printf("0x7FFF 0x26EA 0x2ACA 0x7FFF 0x2310 0x3942 0x7FFF 0x1640 0x8000 0x8000 0x6732 0x4A30 0x3564 0x7FFF 0x7FFF 0x4DFE 0x242 0xE246 0x8000 0x7FFF 0x7FFF 0x7FFF 0x8000 0x6D66 0x448A 0x66E6 0xC352 0x7FFF 0x7FFF 0x6A02 0x8000 0x7FFF");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_add_q31(srcA_buf_q31, srcB_buf_q31, result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_add_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_add_q31", "q31", MAX_BLOCKSIZE,
+    riscv_add_q31(srcA_buf_q31, srcB_buf_q31, result_q31, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
   printf("\nCorrect answer:\n");
@@ -274,11 +228,8 @@ int32_t main(void)
 #endif
 
 /*dot product*/
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_dot_prod_q15(srcA_buf_q15,srcB_buf_q15,MAX_BLOCKSIZE,&result_q63_1);
-  perf_stop();
-  printf("riscv_dot_prod_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_dot_prod_q15", "q15", MAX_BLOCKSIZE,
+    riscv_dot_prod_q15(srcA_buf_q15,srcB_buf_q15,MAX_BLOCKSIZE,&result_q63_1));
 #ifdef PRINT_OUTPUT
  /*int pointer to print the long long on two halfs as printf doesn't print long long*/
   int * ptr = &result_q63_1;  /*for printing only*/
@@ -290,11 +241,8 @@ int32_t main(void)
   printf("0x2B4B3CAF7");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_dot_prod_q31(srcA_buf_q31,srcB_buf_q31,MAX_BLOCKSIZE,&result_q63_1);
-  perf_stop();
-  printf("riscv_dot_prod_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_dot_prod_q31", "q31", MAX_BLOCKSIZE,
+    riscv_dot_prod_q31(srcA_buf_q31,srcB_buf_q31,MAX_BLOCKSIZE,&result_q63_1));
 #ifdef PRINT_OUTPUT
   ptr = &result_q63_1;   /*for printing only*/
   ptr++;
@@ -305,19 +253,13 @@ int32_t main(void)
   printf("0xAD2DD380D7254");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_dot_prod_f32(srcA_buf_f32,srcB_buf_f32,MAX_BLOCKSIZE,&result_f32_1);
-  perf_stop();
-  printf("riscv_dot_prod_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_dot_prod_f32", "f32", MAX_BLOCKSIZE,
+    riscv_dot_prod_f32(srcA_buf_f32,srcB_buf_f32,MAX_BLOCKSIZE,&result_f32_1));
 #ifdef PRINT_OUTPUT
   printf("%d\n",1000*((int)result_f32_1));
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_dot_prod_q7(srcA_buf_q7,srcB_buf_q7,MAX_BLOCKSIZE,&result_q31_1);
-  perf_stop();
-  printf("riscv_dot_prod_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_dot_prod_q7", "q7", MAX_BLOCKSIZE,
+    riscv_dot_prod_q7(srcA_buf_q7,srcB_buf_q7,MAX_BLOCKSIZE,&result_q31_1));
 #ifdef PRINT_OUTPUT
   printf("0x%X ",result_q31_1);  
   printf("\n");
@@ -327,41 +269,29 @@ int32_t main(void)
 #endif
 
 /*Mult*/
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_mult_f32(srcA_buf_f32, srcB_buf_f32, result_f32, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_mult_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mult_f32", "f32", MAX_BLOCKSIZE,
+    riscv_mult_f32(srcA_buf_f32, srcB_buf_f32, result_f32, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_mult_q31(srcA_buf_q31, srcB_buf_q31, result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_mult_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mult_q31", "q31", MAX_BLOCKSIZE,
+    riscv_mult_q31(srcA_buf_q31, srcB_buf_q31, result_q31, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
   printf("\nCorrect answer:\n");
   printf("0x6B132EAF 0x02F557F6 0x03938A93 0x24F0A28B 0x0266C7B8 0x066774EA 0x35099158 0x00F788F7 0x7A070E8E 0x6021C4AE 0x14CD4B7F 0x0AC0515C 0x059148FB 0x2E54309C 0x607F8913 0x0BE1980C 0x00028D60 0x01B9A5DB 0x36C2890E 0x522252B8 0x6DF556CD 0x37BB6513 0x71BE11AC 0x17609E61 0x092D1DA8 0x14AEA869 0x07310244 0x499130BD 0x37419A55 0x15F2E380 0x6041F8B2 0x24909BF0");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_mult_q15(srcA_buf_q15, srcB_buf_q15, result_q15, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_mult_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mult_q15", "q15", MAX_BLOCKSIZE,
+    riscv_mult_q15(srcA_buf_q15, srcB_buf_q15, result_q15, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
   printf("\nCorrect answer:\n");
   printf("0x6B12 0x02F5 0x0393 0x24F0 0x0266 0x0667 0x3508 0x00F7 0x7A08 0x6022 0x14CC 0x0ABF 0x0591 0x2E53 0x607E 0x0BE1 0x0002 0x01B9 0x36C2 0x5221 0x6DF3 0x37BB 0x71BF 0x1760 0x092C 0x14AE 0x0731 0x4991 0x3740 0x15F2 0x6042 0x248F");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_mult_q7(srcA_buf_q7, srcB_buf_q7, result_q7, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_mult_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mult_q7", "q7", MAX_BLOCKSIZE,
+    riscv_mult_q7(srcA_buf_q7, srcB_buf_q7, result_q7, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
   printf("\nCorrect answer:\n");
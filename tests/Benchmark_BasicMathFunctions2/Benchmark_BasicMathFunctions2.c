@@ -13,33 +13,17 @@ printf("\n\n")
 printf("\n\n")
 
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 //#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
 #define MAX_BLOCKSIZE     32
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
-*Also the correct results are printed for the current vectors which are calculated from the orignal library 
+*Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "BasicMathFunctions2"
+#include "../common/riscv_bench.h"
  float32_t srcA_buf_f32[MAX_BLOCKSIZE] =
 {
   -0.4325648115282207,  -1.6655843782380970,  0.1253323064748307,
@@ -167,22 +151,17 @@ q63_t result_q63[MAX_BLOCKSIZE];
 int i = 0 ;
 int32_t main(void)
 {
+  riscv_bench_header();
 /*Tests*/
 /*negate*/
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_negate_f32( srcA_buf_f32,result_f32,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_negate_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_negate_f32", "f32", MAX_BLOCKSIZE,
+    riscv_negate_f32( srcA_buf_f32,result_f32,MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_negate_q7(srcA_buf_q7,result_q7,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_negate_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_negate_q7", "q7", MAX_BLOCKSIZE,
+    riscv_negate_q7(srcA_buf_q7,result_q7,MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
@@ -190,11 +169,8 @@ int32_t main(void)
   printf("0x8B 0xED 0xEB 0xBC 0xEF 0xE4 0xAE 0xF5 0x7D 0x6F 0xCD 0xDB 0xE6 0xB3 0x91 0xDA 0xFF 0x0F 0x54 0x9A 0x8A 0xAC 0x79 0xCA 0xDE 0xCD 0x1F 0x9F 0xAC 0xCB 0x6F 0xB7");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_negate_q15(srcA_buf_q15,result_q15,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_negate_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_negate_q15", "q15", MAX_BLOCKSIZE,
+    riscv_negate_q15(srcA_buf_q15,result_q15,MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
@@ -202,11 +178,8 @@ int32_t main(void)
   printf("0x8AEE 0xEC8B 0xEA9B 0xBB3D 0xEE78 0xE35F 0xAD9C 0xF4E0 0x7CFB 0x6EEE 0xCC67 0xDAE8 0xE54E 0xB2FF 0x90DD 0xD901 0xFEDF 0x0EDD 0x53B9 0x9978 0x895E 0xAB8A 0x78AA 0xC94D 0xDDBB 0xCC8D 0x1E57 0x9EF6 0xABE7 0xCAFF 0x6F00 0xBB97");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_negate_q31(srcA_buf_q31,result_q31,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_negate_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_negate_q31", "q31", MAX_BLOCKSIZE,
+    riscv_negate_q31(srcA_buf_q31,result_q31,MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
@@ -217,20 +190,14 @@ int32_t main(void)
 
 /*offset*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_offset_f32(srcA_buf_f32, 1.2, result_f32, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_offset_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_offset_f32", "f32", MAX_BLOCKSIZE,
+    riscv_offset_f32(srcA_buf_f32, 1.2, result_f32, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_offset_q7(srcA_buf_q7, 0x15, result_q7, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_offset_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_offset_q7", "q7", MAX_BLOCKSIZE,
+    riscv_offset_q7(srcA_buf_q7, 0x15, result_q7, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
@@ -238,11 +205,8 @@ int32_t main(void)
   printf("0x7F 0x28 0x2A 0x59 0x26 0x31 0x67 0x20 0x98 0xA6 0x48 0x3A 0x2F 0x62 0x7F 0x3B 0x16 0x06 0xC1 0x7B 0x7F 0x69 0x9C 0x4B 0x37 0x48 0xF6 0x76 0x69 0x4A 0xA6 0x5E");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_offset_q15(srcA_buf_q15, 0x225A, result_q15, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_offset_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_offset_q15", "q15", MAX_BLOCKSIZE,
+    riscv_offset_q15(srcA_buf_q15, 0x225A, result_q15, MAX_BLOCKSIZE));
 
 
 #ifdef PRINT_OUTPUT
@@ -251,11 +215,8 @@ int32_t main(void)
   printf("0x7FFF 0x35CF 0x37BF 0x671D 0x33E2 0x3EFB 0x74BE 0x2D7A 0xA55F 0xB36C 0x55F3 0x4772 0x3D0C 0x6F5B 0x7FFF 0x4959 0x237B 0x137D 0xCEA1 0x7FFF 0x7FFF 0x76D0 0xA9B0 0x590D 0x449F 0x55CD 0x0403 0x7FFF 0x7673 0x575B 0xB35A 0x66C3 ");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_offset_q31(srcA_buf_q31, 0x33457193, result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_offset_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_offset_q31", "q31", MAX_BLOCKSIZE,
+    riscv_offset_q31(srcA_buf_q31, 0x33457193, result_q31, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
@@ -266,20 +227,14 @@ int32_t main(void)
 
 /*Scale*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_scale_f32(srcA_buf_f32, 1.2, result_f32, MAX_BLOCKSIZE);
-perf_stop();
-  printf("riscv_scale_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_scale_f32", "f32", MAX_BLOCKSIZE,
+    riscv_scale_f32(srcA_buf_f32, 1.2, result_f32, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_scale_q7(srcA_buf_q7, 0x15,1, result_q7, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_scale_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_scale_q7", "q7", MAX_BLOCKSIZE,
+    riscv_scale_q7(srcA_buf_q7, 0x15,1, result_q7, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
@@ -287,11 +242,8 @@ perf_stop();
   printf("0x26 0x06 0x06 0x16 0x05 0x09 0x1A 0x03 0xD6 0xDB 0x10 0x0C 0x08 0x19 0x24 0x0C 0x00 0xFB 0xE4 0x21 0x26 0x1B 0xD8 0x11 0x0B 0x10 0xF5 0x1F 0x1B 0x11 0xDB 0x17");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_scale_q15(srcA_buf_q15, 0x225A,1, result_q15, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_scale_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_scale_q15", "q15", MAX_BLOCKSIZE,
+    riscv_scale_q15(srcA_buf_q15, 0x225A,1, result_q15, MAX_BLOCKSIZE));
 
 
 #ifdef PRINT_OUTPUT
@@ -300,11 +252,8 @@ perf_stop();
   printf("0x3ED6 0x0A71 0x0B7B 0x24E8 0x0968 0x0F5D 0x2C38 0x05F8 0xBCEA 0xC475 0x1BB1 0x13E8 0x0E54 0x2954 0x3BA6 0x14EE 0x09B 0xF805 0xD30F 0x3708 0x3FAC 0x2D55 0xBF3C 0x1D5C 0x1264 0x1B9D 0xEFB7 0x3415 0x2D23 0x1C73 0xC46B 0x24B7");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_scale_q31(srcA_buf_q31, 0x33457193,1, result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_scale_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_scale_q31", "q31", MAX_BLOCKSIZE,
+    riscv_scale_q31(srcA_buf_q31, 0x33457193,1, result_q31, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
@@ -315,11 +264,8 @@ perf_stop();
 
 /*Shift Left*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_shift_q7(srcA_buf_q7, 3, result_q7, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_shift_q7(left): %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_shift_q7(left)", "q7", MAX_BLOCKSIZE,
+    riscv_shift_q7(srcA_buf_q7, 3, result_q7, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
@@ -327,11 +273,8 @@ perf_stop();
   printf("0x7F 0x7F 0x7F 0x7F 0x7F 0x7F 0x7F 0x58 0x80 0x80 0x7F 0x7F 0x7F 0x7F 0x7F 0x7F 0x08 0x88 0x80 0x7F 0x7F 0x7F 0x80 0x7F 0x7F 0x7F 0x80 0x7F 0x7F 0x7F 0x80 0x7F");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_shift_q15(srcA_buf_q15, 2, result_q15, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_shift_q15(left): %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_shift_q15(left)", "q15", MAX_BLOCKSIZE,
+    riscv_shift_q15(srcA_buf_q15, 2, result_q15, MAX_BLOCKSIZE));
 
 
 #ifdef PRINT_OUTPUT
@@ -340,11 +283,8 @@ perf_stop();
   printf("0x7FFF 0x4DD4 0x5594 0x7FFF 0x4620 0x7284 0x7FFF 0x2C80 0x8000 0x8000 0x7FFF 0x7FFF 0x6AC8 0x7FFF 0x7FFF 0x7FFF 0x0484 0xC48C 0x8000 0x7FFF 0x7FFF 0x7FFF 0x8000 0x7FFF 0x7FFF 0x7FFF 0x86A4 0x7FFF 0x7FFF 0x7FFF 0x8000 0x7FFF");
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_shift_q31(srcA_buf_q31, 1, result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_shift_q31(left): %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_shift_q31(left)", "q31", MAX_BLOCKSIZE,
+    riscv_shift_q31(srcA_buf_q31, 1, result_q31, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
@@ -356,31 +296,22 @@ perf_stop();
 
 /*Shift Right*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_shift_q7(srcA_buf_q7, -3, result_q7, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_shift_q7(right): %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_shift_q7(right)", "q7", MAX_BLOCKSIZE,
+    riscv_shift_q7(srcA_buf_q7, -3, result_q7, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_shift_q15(srcA_buf_q15, -2, result_q15, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_shift_q15(right): %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_shift_q15(right)", "q15", MAX_BLOCKSIZE,
+    riscv_shift_q15(srcA_buf_q15, -2, result_q15, MAX_BLOCKSIZE));
 
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_shift_q31(srcA_buf_q31, -1, result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_shift_q31(right): %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_shift_q31(right)", "q31", MAX_BLOCKSIZE,
+    riscv_shift_q31(srcA_buf_q31, -1, result_q31, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
@@ -388,39 +319,77 @@ perf_stop();
 
 /*sub*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_sub_f32(srcA_buf_f32, srcB_buf_f32, result_f32, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_sub_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_sub_f32", "f32", MAX_BLOCKSIZE,
+    riscv_sub_f32(srcA_buf_f32, srcB_buf_f32, result_f32, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_sub_q7(srcA_buf_q7, srcB_buf_q7, result_q7, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_sub_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_sub_q7", "q7", MAX_BLOCKSIZE,
+    riscv_sub_q7(srcA_buf_q7, srcB_buf_q7, result_q7, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_sub_q15(srcA_buf_q15, srcB_buf_q15, result_q15, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_sub_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_sub_q15", "q15", MAX_BLOCKSIZE,
+    riscv_sub_q15(srcA_buf_q15, srcB_buf_q15, result_q15, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_sub_q31(srcA_buf_q31, srcB_buf_q31, result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_sub_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_sub_q31", "q31", MAX_BLOCKSIZE,
+    riscv_sub_q31(srcA_buf_q31, srcB_buf_q31, result_q31, MAX_BLOCKSIZE));
+
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q31,MAX_BLOCKSIZE);
+#endif
+
+/*Vector multiply-add and scale-add*/
+  RISCV_BENCH("riscv_vmac_f32", "f32", MAX_BLOCKSIZE,
+    riscv_vmac_f32(srcA_buf_f32, srcB_buf_f32, srcA_buf_f32, result_f32, MAX_BLOCKSIZE));
+
+#ifdef PRINT_OUTPUT
+  PRINT_F32(result_f32,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_vmac_q7", "q7", MAX_BLOCKSIZE,
+    riscv_vmac_q7(srcA_buf_q7, srcB_buf_q7, srcA_buf_q7, result_q7, MAX_BLOCKSIZE));
+
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q7,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_vmac_q15", "q15", MAX_BLOCKSIZE,
+    riscv_vmac_q15(srcA_buf_q15, srcB_buf_q15, srcA_buf_q15, result_q15, MAX_BLOCKSIZE));
+
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q15,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_vmac_q31", "q31", MAX_BLOCKSIZE,
+    riscv_vmac_q31(srcA_buf_q31, srcB_buf_q31, srcA_buf_q31, result_q31, MAX_BLOCKSIZE));
+
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q31,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_axpy_f32", "f32", MAX_BLOCKSIZE,
+    riscv_axpy_f32(srcA_buf_f32, 0.5f, srcB_buf_f32, result_f32, MAX_BLOCKSIZE));
+
+#ifdef PRINT_OUTPUT
+  PRINT_F32(result_f32,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_axpy_q7", "q7", MAX_BLOCKSIZE,
+    riscv_axpy_q7(srcA_buf_q7, 0x40, 0, srcB_buf_q7, result_q7, MAX_BLOCKSIZE));
+
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q7,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_axpy_q15", "q15", MAX_BLOCKSIZE,
+    riscv_axpy_q15(srcA_buf_q15, 0x4000, 0, srcB_buf_q15, result_q15, MAX_BLOCKSIZE));
+
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q15,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_axpy_q31", "q31", MAX_BLOCKSIZE,
+    riscv_axpy_q31(srcA_buf_q31, 0x40000000, 0, srcB_buf_q31, result_q31, MAX_BLOCKSIZE));
 
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
@@ -0,0 +1,175 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "riscv_math.h"
+#include "riscv_expr.hpp"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 255
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The expressions of riscv_expr.hpp are compared with the chains of C kernels they fuse, in Q15, Q7, Q31
+and floating-point, on inputs that saturate every operation.  The fused and the chained
+clamp((a*x + b) >> 2) are both measured.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "BasicMathFunctions3"
+#include "../common/riscv_bench.h"
+
+using namespace riscv_expr;
+
+q15_t x_q15[BLOCK_SIZE], w_q15[BLOCK_SIZE], ref_q15[BLOCK_SIZE], tmp_q15[BLOCK_SIZE], out_q15[BLOCK_SIZE];
+q7_t x_q7[BLOCK_SIZE], w_q7[BLOCK_SIZE], ref_q7[BLOCK_SIZE], out_q7[BLOCK_SIZE];
+q31_t x_q31[BLOCK_SIZE], w_q31[BLOCK_SIZE], ref_q31[BLOCK_SIZE], tmp_q31[BLOCK_SIZE], out_q31[BLOCK_SIZE];
+float32_t x_f32[BLOCK_SIZE], w_f32[BLOCK_SIZE], ref_f32[BLOCK_SIZE], out_f32[BLOCK_SIZE];
+
+static void chain_q15(q15_t a, q15_t b)
+{
+  uint32_t n;
+
+  riscv_scale_q15(x_q15, a, 0, ref_q15, BLOCK_SIZE);
+  riscv_offset_q15(ref_q15, b, ref_q15, BLOCK_SIZE);
+  riscv_shift_q15(ref_q15, -2, ref_q15, BLOCK_SIZE);
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    ref_q15[n] = (ref_q15[n] < -4000) ? -4000 : ((ref_q15[n] > 4000) ? 4000 : ref_q15[n]);
+  }
+}
+
+static void fused_q15(q15_t a, q15_t b)
+{
+  span<const q15_t> x(x_q15, BLOCK_SIZE);
+  span<q15_t> y(out_q15, BLOCK_SIZE);
+
+  y = clamp((a * x + b) >> 2, -4000, 4000);
+}
+
+template <typename T>
+static int32_t same(const T * pA, const T * pB, uint32_t blockSize)
+{
+  uint32_t n;
+
+  for (n = 0; n < blockSize; n++)
+  {
+    if(pA[n] != pB[n])
+    {
+      return (0);
+    }
+  }
+
+  return (1);
+}
+
+int main(void)
+{
+  uint32_t n;
+  int32_t fail = 0, ok;
+
+  riscv_bench_header();
+
+  srand(11);
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    x_q15[n] = (q15_t) ((rand() & 0xFFFF) - 0x8000);
+    w_q15[n] = (q15_t) ((rand() & 0xFFFF) - 0x8000);
+    x_q7[n] = (q7_t) ((rand() & 0xFF) - 0x80);
+    w_q7[n] = (q7_t) ((rand() & 0xFF) - 0x80);
+    x_q31[n] = (q31_t) (((uint32_t) rand() << 16) ^ (uint32_t) rand());
+    w_q31[n] = (q31_t) (((uint32_t) rand() << 16) ^ (uint32_t) rand());
+    x_f32[n] = (float32_t) (rand() % 2001 - 1000) / 256.0f;
+    w_f32[n] = (float32_t) (rand() % 2001 - 1000) / 256.0f;
+  }
+
+  /* the extremes, for the saturation of negate and abs */
+  x_q15[0] = (q15_t) 0x8000;
+  x_q7[0] = (q7_t) 0x80;
+  x_q31[0] = INT32_MIN;
+
+  chain_q15(0x6000, 0x2000);
+  fused_q15(0x6000, 0x2000);
+  ok = same(ref_q15, out_q15, BLOCK_SIZE);
+  printf("CHECK riscv_expr q15 clamp((a*x + b) >> 2) %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* y = |x*w - x| + (-w) << 1 */
+  {
+    span<const q15_t> x(x_q15, BLOCK_SIZE), w(w_q15, BLOCK_SIZE);
+    span<q15_t> y(out_q15, BLOCK_SIZE);
+
+    riscv_mult_q15(x_q15, w_q15, ref_q15, BLOCK_SIZE);
+    riscv_sub_q15(ref_q15, x_q15, ref_q15, BLOCK_SIZE);
+    riscv_abs_q15(ref_q15, ref_q15, BLOCK_SIZE);
+    riscv_negate_q15(w_q15, tmp_q15, BLOCK_SIZE);
+    riscv_add_q15(ref_q15, tmp_q15, ref_q15, BLOCK_SIZE);
+    riscv_shift_q15(ref_q15, 1, ref_q15, BLOCK_SIZE);
+    y = (abs(x * w - x) + -w) << 1;
+    ok = same(ref_q15, out_q15, BLOCK_SIZE);
+
+    riscv_scale_q15(x_q15, 0x5000, 2, ref_q15, BLOCK_SIZE);
+    y = scale(x, 0x5000, 2);
+    ok = ok && same(ref_q15, out_q15, BLOCK_SIZE);
+
+    /* in place: the output is one of the inputs */
+    riscv_copy_q15(x_q15, out_q15, BLOCK_SIZE);
+    riscv_add_q15(x_q15, w_q15, ref_q15, BLOCK_SIZE);
+    y = y + w;
+    ok = ok && same(ref_q15, out_q15, BLOCK_SIZE);
+    printf("CHECK riscv_expr q15 mult, sub, abs, negate, add, shift, scale %s\n", ok ? "ok" : "bad");
+    fail |= !ok;
+  }
+
+  {
+    span<const q7_t> x(x_q7, BLOCK_SIZE), w(w_q7, BLOCK_SIZE);
+    span<q7_t> y(out_q7, BLOCK_SIZE);
+
+    riscv_mult_q7(x_q7, w_q7, ref_q7, BLOCK_SIZE);
+    riscv_add_q7(ref_q7, w_q7, ref_q7, BLOCK_SIZE);
+    riscv_negate_q7(ref_q7, ref_q7, BLOCK_SIZE);
+    riscv_scale_q7(ref_q7, 0x60, 1, ref_q7, BLOCK_SIZE);
+    y = scale(-(x * w + w), 0x60, 1);
+    ok = same(ref_q7, out_q7, BLOCK_SIZE);
+    printf("CHECK riscv_expr q7 mult, add, negate, scale %s\n", ok ? "ok" : "bad");
+    fail |= !ok;
+  }
+
+  {
+    span<const q31_t> x(x_q31, BLOCK_SIZE), w(w_q31, BLOCK_SIZE);
+    span<q31_t> y(out_q31, BLOCK_SIZE);
+
+    riscv_mult_q31(x_q31, w_q31, ref_q31, BLOCK_SIZE);
+    riscv_offset_q31(ref_q31, 0x40000000, ref_q31, BLOCK_SIZE);
+    riscv_abs_q31(x_q31, tmp_q31, BLOCK_SIZE);
+    riscv_sub_q31(ref_q31, tmp_q31, ref_q31, BLOCK_SIZE);
+    riscv_scale_q31(ref_q31, 0x50000000, 1, ref_q31, BLOCK_SIZE);
+    riscv_shift_q31(ref_q31, -3, ref_q31, BLOCK_SIZE);
+    y = scale(x * w + 0x40000000 - abs(x), 0x50000000, 1) >> 3;
+    ok = same(ref_q31, out_q31, BLOCK_SIZE);
+    printf("CHECK riscv_expr q31 mult, offset, abs, sub, scale, shift %s\n", ok ? "ok" : "bad");
+    fail |= !ok;
+  }
+
+  {
+    span<const float32_t> x(x_f32, BLOCK_SIZE), w(w_f32, BLOCK_SIZE);
+    span<float32_t> y(out_f32, BLOCK_SIZE);
+
+    riscv_mult_f32(x_f32, w_f32, ref_f32, BLOCK_SIZE);
+    riscv_scale_f32(ref_f32, 0.5f, ref_f32, BLOCK_SIZE);
+    riscv_offset_f32(ref_f32, 1.0f, ref_f32, BLOCK_SIZE);
+    riscv_abs_f32(ref_f32, ref_f32, BLOCK_SIZE);
+    y = abs(0.5f * (x * w) + 1.0f);
+    ok = same(ref_f32, out_f32, BLOCK_SIZE);
+    printf("CHECK riscv_expr f32 mult, scale, offset, abs %s\n", ok ? "ok" : "bad");
+    fail |= !ok;
+  }
+
+  RISCV_BENCH("riscv_expr chained", "q15", BLOCK_SIZE, chain_q15(0x6000, 0x2000));
+  RISCV_BENCH("riscv_expr fused", "q15", BLOCK_SIZE, fused_q15(0x6000, 0x2000));
+
+  return (fail);
+}
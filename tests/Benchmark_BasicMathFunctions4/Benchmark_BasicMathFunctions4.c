@@ -0,0 +1,213 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_math_inline.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define MAX_BLOCKSIZE 16
+#define NUM_TRIALS 8
+#define WINDOW 8
+#define NUM_WINDOWS 64
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*Every kernel of riscv_math_inline.h is compared with its library kernel on 1 to 16 elements of
+random data that includes the most negative values, the CHECK lines must report ok.  The benchmarks
+run 64 dot products, offsets and scalings of 8 elements through the library and inline, with the
+block size a constant.
+*/
+#define RISCV_BENCH_SUITE "BasicMathFunctions4"
+#include "../common/riscv_bench.h"
+
+float32_t srcA_f32[2 * MAX_BLOCKSIZE], srcB_f32[2 * MAX_BLOCKSIZE];
+q31_t srcA_q31[2 * MAX_BLOCKSIZE], srcB_q31[2 * MAX_BLOCKSIZE];
+q15_t srcA_q15[2 * MAX_BLOCKSIZE], srcB_q15[2 * MAX_BLOCKSIZE];
+float32_t lib_f32[2 * MAX_BLOCKSIZE], inl_f32[2 * MAX_BLOCKSIZE];
+q31_t lib_q31[2 * MAX_BLOCKSIZE], inl_q31[2 * MAX_BLOCKSIZE];
+q15_t lib_q15[2 * MAX_BLOCKSIZE], inl_q15[2 * MAX_BLOCKSIZE];
+
+q15_t signal_q15[NUM_WINDOWS + WINDOW];
+q15_t taps_q15[WINDOW];
+q63_t acc_q63[NUM_WINDOWS];
+q15_t out_q15[NUM_WINDOWS * WINDOW];
+
+static uint32_t seed = 12345u;
+
+static uint32_t next_rand(void)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return seed;
+}
+
+static void fill(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < 2u * MAX_BLOCKSIZE; i++)
+  {
+    srcA_f32[i] = (float32_t) ((int32_t) next_rand()) / 1073741824.0f;
+    srcB_f32[i] = (float32_t) ((int32_t) next_rand()) / 1073741824.0f;
+    srcA_q31[i] = (q31_t) next_rand();
+    srcB_q31[i] = (q31_t) next_rand();
+    srcA_q15[i] = (q15_t) next_rand();
+    srcB_q15[i] = (q15_t) next_rand();
+  }
+  /* saturation corners */
+  srcA_q31[1] = INT32_MIN;
+  srcB_q31[1] = INT32_MIN;
+  srcA_q15[1] = (q15_t) 0x8000;
+  srcB_q15[1] = (q15_t) 0x8000;
+  srcA_q15[2] = 0x7FFF;
+  srcB_q15[2] = 0x7FFF;
+  srcA_q15[3] = (q15_t) 0x8000;
+}
+
+#define SAME(A, B, N)  (memcmp((A), (B), (N) * sizeof((A)[0])) == 0)
+
+/* Library and inline kernel writing n elements of lib_T and inl_T */
+#define CHECK_VEC(T, N, LIB, INL)                                              \
+  do {                                                                         \
+    memset(lib_##T, 0x55, sizeof(lib_##T));                                    \
+    memset(inl_##T, 0x55, sizeof(inl_##T));                                    \
+    LIB;                                                                       \
+    INL;                                                                       \
+    if(!SAME(lib_##T, inl_##T, 2 * MAX_BLOCKSIZE)) bad |= 1u;                  \
+  } while(0)
+
+static uint32_t compare(const char *name, uint32_t (*check)(uint32_t n))
+{
+  uint32_t n, t, bad = 0u;
+
+  seed = 12345u;
+  for (t = 0u; t < NUM_TRIALS; t++)
+  {
+    fill();
+    for (n = 1u; n <= MAX_BLOCKSIZE; n++)
+    {
+      bad |= check(n);
+    }
+  }
+  printf("CHECK %s inline %s\n", name, bad ? "bad" : "ok");
+  return bad;
+}
+
+static uint32_t check_basic(uint32_t n)
+{
+  uint32_t bad = 0u;
+
+  CHECK_VEC(f32, n, riscv_add_f32(srcA_f32, srcB_f32, lib_f32, n), riscv_add_f32_inline(srcA_f32, srcB_f32, inl_f32, n));
+  CHECK_VEC(q31, n, riscv_add_q31(srcA_q31, srcB_q31, lib_q31, n), riscv_add_q31_inline(srcA_q31, srcB_q31, inl_q31, n));
+  CHECK_VEC(q15, n, riscv_add_q15(srcA_q15, srcB_q15, lib_q15, n), riscv_add_q15_inline(srcA_q15, srcB_q15, inl_q15, n));
+  CHECK_VEC(f32, n, riscv_sub_f32(srcA_f32, srcB_f32, lib_f32, n), riscv_sub_f32_inline(srcA_f32, srcB_f32, inl_f32, n));
+  CHECK_VEC(q15, n, riscv_sub_q15(srcA_q15, srcB_q15, lib_q15, n), riscv_sub_q15_inline(srcA_q15, srcB_q15, inl_q15, n));
+  CHECK_VEC(f32, n, riscv_mult_f32(srcA_f32, srcB_f32, lib_f32, n), riscv_mult_f32_inline(srcA_f32, srcB_f32, inl_f32, n));
+  CHECK_VEC(q31, n, riscv_mult_q31(srcA_q31, srcB_q31, lib_q31, n), riscv_mult_q31_inline(srcA_q31, srcB_q31, inl_q31, n));
+  CHECK_VEC(q15, n, riscv_mult_q15(srcA_q15, srcB_q15, lib_q15, n), riscv_mult_q15_inline(srcA_q15, srcB_q15, inl_q15, n));
+  CHECK_VEC(f32, n, riscv_scale_f32(srcA_f32, 0.75f, lib_f32, n), riscv_scale_f32_inline(srcA_f32, 0.75f, inl_f32, n));
+  CHECK_VEC(q15, n, riscv_scale_q15(srcA_q15, 0x6000, 2, lib_q15, n), riscv_scale_q15_inline(srcA_q15, 0x6000, 2, inl_q15, n));
+  CHECK_VEC(q15, n, riscv_scale_q15(srcA_q15, -0x2000, -1, lib_q15, n), riscv_scale_q15_inline(srcA_q15, -0x2000, -1, inl_q15, n));
+  CHECK_VEC(f32, n, riscv_offset_f32(srcA_f32, -0.25f, lib_f32, n), riscv_offset_f32_inline(srcA_f32, -0.25f, inl_f32, n));
+  CHECK_VEC(q15, n, riscv_offset_q15(srcA_q15, 0x4000, lib_q15, n), riscv_offset_q15_inline(srcA_q15, 0x4000, inl_q15, n));
+  CHECK_VEC(f32, n, riscv_negate_f32(srcA_f32, lib_f32, n), riscv_negate_f32_inline(srcA_f32, inl_f32, n));
+  CHECK_VEC(q15, n, riscv_negate_q15(srcA_q15, lib_q15, n), riscv_negate_q15_inline(srcA_q15, inl_q15, n));
+  CHECK_VEC(f32, n, riscv_abs_f32(srcA_f32, lib_f32, n), riscv_abs_f32_inline(srcA_f32, inl_f32, n));
+  CHECK_VEC(q15, n, riscv_abs_q15(srcA_q15, lib_q15, n), riscv_abs_q15_inline(srcA_q15, inl_q15, n));
+  CHECK_VEC(f32, n, riscv_dot_prod_f32(srcA_f32, srcB_f32, n, &lib_f32[0]), riscv_dot_prod_f32_inline(srcA_f32, srcB_f32, n, &inl_f32[0]));
+  CHECK_VEC(q31, n, riscv_dot_prod_q31(srcA_q31, srcB_q31, n, (q63_t *) &lib_q31[0]), riscv_dot_prod_q31_inline(srcA_q31, srcB_q31, n, (q63_t *) &inl_q31[0]));
+  CHECK_VEC(q31, n, riscv_dot_prod_q15(srcA_q15, srcB_q15, n, (q63_t *) &lib_q31[0]), riscv_dot_prod_q15_inline(srcA_q15, srcB_q15, n, (q63_t *) &inl_q31[0]));
+  return bad;
+}
+
+static uint32_t check_complex(uint32_t n)
+{
+  uint32_t bad = 0u;
+
+  CHECK_VEC(f32, n, riscv_cmplx_conj_f32(srcA_f32, lib_f32, n), riscv_cmplx_conj_f32_inline(srcA_f32, inl_f32, n));
+  CHECK_VEC(q15, n, riscv_cmplx_conj_q15(srcA_q15, lib_q15, n), riscv_cmplx_conj_q15_inline(srcA_q15, inl_q15, n));
+  CHECK_VEC(f32, n, riscv_cmplx_mult_cmplx_f32(srcA_f32, srcB_f32, lib_f32, n), riscv_cmplx_mult_cmplx_f32_inline(srcA_f32, srcB_f32, inl_f32, n));
+  CHECK_VEC(q15, n, riscv_cmplx_mult_cmplx_q15(srcA_q15, srcB_q15, lib_q15, n), riscv_cmplx_mult_cmplx_q15_inline(srcA_q15, srcB_q15, inl_q15, n));
+  CHECK_VEC(f32, n, riscv_cmplx_mag_squared_f32(srcA_f32, lib_f32, n), riscv_cmplx_mag_squared_f32_inline(srcA_f32, inl_f32, n));
+  CHECK_VEC(q15, n, riscv_cmplx_mag_squared_q15(srcA_q15, lib_q15, n), riscv_cmplx_mag_squared_q15_inline(srcA_q15, inl_q15, n));
+  CHECK_VEC(f32, n, riscv_cmplx_dot_prod_f32(srcA_f32, srcB_f32, n, &lib_f32[0], &lib_f32[1]),
+            riscv_cmplx_dot_prod_f32_inline(srcA_f32, srcB_f32, n, &inl_f32[0], &inl_f32[1]));
+  return bad;
+}
+
+static uint32_t check_statistics(uint32_t n)
+{
+  uint32_t bad = 0u;
+
+  CHECK_VEC(f32, n, riscv_mean_f32(srcA_f32, n, &lib_f32[0]), riscv_mean_f32_inline(srcA_f32, n, &inl_f32[0]));
+  CHECK_VEC(q15, n, riscv_mean_q15(srcA_q15, n, &lib_q15[0]), riscv_mean_q15_inline(srcA_q15, n, &inl_q15[0]));
+  CHECK_VEC(f32, n, riscv_power_f32(srcA_f32, n, &lib_f32[0]), riscv_power_f32_inline(srcA_f32, n, &inl_f32[0]));
+  CHECK_VEC(q31, n, riscv_power_q15(srcA_q15, n, (q63_t *) &lib_q31[0]), riscv_power_q15_inline(srcA_q15, n, (q63_t *) &inl_q31[0]));
+  CHECK_VEC(f32, n, riscv_max_f32(srcA_f32, n, &lib_f32[0], (uint32_t *) &lib_f32[1]), riscv_max_f32_inline(srcA_f32, n, &inl_f32[0], (uint32_t *) &inl_f32[1]));
+  CHECK_VEC(f32, n, riscv_min_f32(srcA_f32, n, &lib_f32[0], (uint32_t *) &lib_f32[1]), riscv_min_f32_inline(srcA_f32, n, &inl_f32[0], (uint32_t *) &inl_f32[1]));
+  CHECK_VEC(q15, n, riscv_max_q15(srcA_q15, n, &lib_q15[0], (uint32_t *) &lib_q15[2]), riscv_max_q15_inline(srcA_q15, n, &inl_q15[0], (uint32_t *) &inl_q15[2]));
+  CHECK_VEC(q15, n, riscv_min_q15(srcA_q15, n, &lib_q15[0], (uint32_t *) &lib_q15[2]), riscv_min_q15_inline(srcA_q15, n, &inl_q15[0], (uint32_t *) &inl_q15[2]));
+  return bad;
+}
+
+static void windows_lib(void)
+{
+  uint32_t w;
+
+  for (w = 0u; w < NUM_WINDOWS; w++)
+  {
+    riscv_dot_prod_q15(&signal_q15[w], taps_q15, WINDOW, &acc_q63[w]);
+    riscv_offset_q15(&signal_q15[w], 0x0100, &out_q15[w * WINDOW], WINDOW);
+    riscv_scale_q15(&out_q15[w * WINDOW], 0x4000, 1, &out_q15[w * WINDOW], WINDOW);
+  }
+}
+
+static void windows_inline(void)
+{
+  uint32_t w;
+
+  for (w = 0u; w < NUM_WINDOWS; w++)
+  {
+    riscv_dot_prod_q15_inline(&signal_q15[w], taps_q15, WINDOW, &acc_q63[w]);
+    riscv_offset_q15_inline(&signal_q15[w], 0x0100, &out_q15[w * WINDOW], WINDOW);
+    riscv_scale_q15_inline(&out_q15[w * WINDOW], 0x4000, 1, &out_q15[w * WINDOW], WINDOW);
+  }
+}
+
+int main(void)
+{
+  uint32_t fail = 0u, i;
+  q63_t accLib[NUM_WINDOWS];
+  q15_t outLib[NUM_WINDOWS * WINDOW];
+
+  riscv_bench_header();
+
+  fail |= compare("basic", check_basic);
+  fail |= compare("complex", check_complex);
+  fail |= compare("statistics", check_statistics);
+
+  for (i = 0u; i < NUM_WINDOWS + WINDOW; i++)
+  {
+    signal_q15[i] = (q15_t) next_rand();
+  }
+  for (i = 0u; i < WINDOW; i++)
+  {
+    taps_q15[i] = (q15_t) (next_rand() >> 17);
+  }
+
+  RISCV_BENCH("windows_lib", "q15", NUM_WINDOWS * WINDOW, windows_lib());
+  memcpy(accLib, acc_q63, sizeof(accLib));
+  memcpy(outLib, out_q15, sizeof(outLib));
+  RISCV_BENCH("windows_inline", "q15", NUM_WINDOWS * WINDOW, windows_inline());
+  i = SAME(accLib, acc_q63, NUM_WINDOWS) && SAME(outLib, out_q15, NUM_WINDOWS * WINDOW);
+  printf("CHECK windows inline %s\n", i ? "ok" : "bad");
+  fail |= !i;
+
+  return fail;
+}
@@ -0,0 +1,188 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 256
+#define NUM_LENGTHS 4
+#define MASK_WORDS ((BLOCK_SIZE + 31) / 32)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The clip, threshold and compare mask functions of every type run on random data of 1, 31, 77 and
+BLOCK_SIZE elements, which include the limits of the types, and must match a plain C loop; the clip
+functions are also run in place.  The mask words past the last element must be left alone and the
+unused bits of the last word cleared.  The benchmarks measure the Q15 functions next to the C loops
+they replace.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "BasicMathFunctions5"
+#include "../common/riscv_bench.h"
+
+float32_t src_f32[BLOCK_SIZE], dst_f32[BLOCK_SIZE];
+q31_t src_q31[BLOCK_SIZE], dst_q31[BLOCK_SIZE];
+q15_t src_q15[BLOCK_SIZE] __attribute__((aligned(4))), dst_q15[BLOCK_SIZE] __attribute__((aligned(4)));
+q7_t src_q7[BLOCK_SIZE] __attribute__((aligned(4))), dst_q7[BLOCK_SIZE] __attribute__((aligned(4)));
+uint32_t mask[MASK_WORDS + 1], refMask[MASK_WORDS + 1];
+
+static uint32_t seed = 4242u;
+
+static uint32_t next_rand(void)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return seed;
+}
+
+/* Reference mask of the elements in [low, high], returns the count */
+#define REF_MASK(SRC, LOW, HIGH, LEN)                                      \
+  do                                                                       \
+  {                                                                        \
+    memset(refMask, 0, sizeof(refMask));                                   \
+    refMask[MASK_WORDS] = 0xA5A5A5A5u;                                     \
+    refCount = 0;                                                          \
+    for (n = 0; n < (LEN); n++)                                            \
+    {                                                                      \
+      if(((SRC)[n] >= (LOW)) && ((SRC)[n] <= (HIGH)))                      \
+      {                                                                    \
+        refMask[n / 32] |= 1u << (n % 32);                                 \
+        refCount++;                                                        \
+      }                                                                    \
+    }                                                                      \
+    memset(mask, 0xFF, sizeof(mask));                                      \
+    mask[MASK_WORDS] = 0xA5A5A5A5u;                                        \
+    for (n = (((LEN) + 31) / 32); n < MASK_WORDS; n++) refMask[n] = 0xFFFFFFFFu; \
+  } while(0)
+
+int main(void)
+{
+  const uint32_t lengths[NUM_LENGTHS] = { 1, 31, 77, BLOCK_SIZE };
+  uint32_t n, i, len, count, refCount;
+  int32_t fail = 0, ok, bad;
+  q15_t lo15 = -9000, hi15 = 12000, ref15;
+  q7_t lo7 = -40, hi7 = 90, ref7;
+  q31_t lo31 = -0x30000000, hi31 = 0x50000000, ref31;
+  float32_t lo32 = -0.25f, hi32 = 0.6f, ref32;
+
+  riscv_bench_header();
+
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    src_q31[n] = (q31_t) next_rand();
+    src_q15[n] = (q15_t) (next_rand() >> 16);
+    src_q7[n] = (q7_t) (next_rand() >> 24);
+    src_f32[n] = (float32_t) ((int32_t) next_rand()) / 2147483648.0f;
+  }
+  src_q31[3] = (q31_t) 0x80000000;
+  src_q31[4] = 0x7FFFFFFF;
+  src_q31[5] = lo31;
+  src_q31[6] = hi31;
+  src_q15[3] = -32768;
+  src_q15[4] = 32767;
+  src_q15[5] = lo15;
+  src_q15[6] = hi15;
+  src_q7[3] = -128;
+  src_q7[4] = 127;
+  src_q7[5] = lo7;
+  src_q7[6] = hi7;
+  src_f32[5] = lo32;
+  src_f32[6] = hi32;
+
+  RISCV_BENCH("riscv_clip_q15", "q15", BLOCK_SIZE, riscv_clip_q15(src_q15, lo15, hi15, dst_q15, BLOCK_SIZE));
+  RISCV_BENCH("clip_loop_q15", "q15", BLOCK_SIZE,
+    for (n = 0; n < BLOCK_SIZE; n++) dst_q15[n] = (src_q15[n] < lo15) ? lo15 : ((src_q15[n] > hi15) ? hi15 : src_q15[n]));
+  RISCV_BENCH("riscv_threshold_q15", "q15", BLOCK_SIZE, riscv_threshold_q15(src_q15, lo15, 0, dst_q15, BLOCK_SIZE));
+  RISCV_BENCH("threshold_loop_q15", "q15", BLOCK_SIZE,
+    for (n = 0; n < BLOCK_SIZE; n++) dst_q15[n] = (src_q15[n] > lo15) ? src_q15[n] : 0);
+  RISCV_BENCH("riscv_cmp_range_mask_q15", "q15", BLOCK_SIZE, count = riscv_cmp_range_mask_q15(src_q15, lo15, hi15, mask, BLOCK_SIZE));
+  RISCV_BENCH("cmp_mask_loop_q15", "q15", BLOCK_SIZE,
+    memset(mask, 0, sizeof(mask));
+    for (n = 0; n < BLOCK_SIZE; n++) if((src_q15[n] >= lo15) && (src_q15[n] <= hi15)) mask[n / 32] |= 1u << (n % 32));
+  RISCV_BENCH("riscv_clip_q7", "q7", BLOCK_SIZE, riscv_clip_q7(src_q7, lo7, hi7, dst_q7, BLOCK_SIZE));
+  RISCV_BENCH("riscv_clip_q31", "q31", BLOCK_SIZE, riscv_clip_q31(src_q31, lo31, hi31, dst_q31, BLOCK_SIZE));
+  RISCV_BENCH("riscv_clip_f32", "f32", BLOCK_SIZE, riscv_clip_f32(src_f32, lo32, hi32, dst_f32, BLOCK_SIZE));
+
+  /* Clip, out of place and in place */
+  for (i = 0, bad = 0; i < NUM_LENGTHS; i++)
+  {
+    len = lengths[i];
+    riscv_clip_f32(src_f32, lo32, hi32, dst_f32, len);
+    riscv_clip_q31(src_q31, lo31, hi31, dst_q31, len);
+    riscv_clip_q15(src_q15, lo15, hi15, dst_q15, len);
+    riscv_clip_q7(src_q7, lo7, hi7, dst_q7, len);
+    for (n = 0; n < len; n++)
+    {
+      ref32 = (src_f32[n] < lo32) ? lo32 : ((src_f32[n] > hi32) ? hi32 : src_f32[n]);
+      ref31 = (src_q31[n] < lo31) ? lo31 : ((src_q31[n] > hi31) ? hi31 : src_q31[n]);
+      ref15 = (src_q15[n] < lo15) ? lo15 : ((src_q15[n] > hi15) ? hi15 : src_q15[n]);
+      ref7 = (src_q7[n] < lo7) ? lo7 : ((src_q7[n] > hi7) ? hi7 : src_q7[n]);
+      bad += (dst_f32[n] != ref32) + (dst_q31[n] != ref31) + (dst_q15[n] != ref15) + (dst_q7[n] != ref7);
+    }
+  }
+  memcpy(dst_q15, src_q15, sizeof(dst_q15));
+  riscv_clip_q15(dst_q15, lo15, hi15, dst_q15, BLOCK_SIZE);
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    ref15 = (src_q15[n] < lo15) ? lo15 : ((src_q15[n] > hi15) ? hi15 : src_q15[n]);
+    bad += (dst_q15[n] != ref15);
+  }
+  ok = (bad == 0);
+  printf("CHECK riscv_clip_X: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Threshold, a negative fill and a fill above the threshold */
+  for (i = 0, bad = 0; i < NUM_LENGTHS; i++)
+  {
+    len = lengths[i];
+    riscv_threshold_f32(src_f32, lo32, -1.0f, dst_f32, len);
+    riscv_threshold_q31(src_q31, lo31, hi31, dst_q31, len);
+    riscv_threshold_q15(src_q15, lo15, -32768, dst_q15, len);
+    riscv_threshold_q7(src_q7, lo7, hi7, dst_q7, len);
+    for (n = 0; n < len; n++)
+    {
+      bad += (dst_f32[n] != ((src_f32[n] > lo32) ? src_f32[n] : -1.0f));
+      bad += (dst_q31[n] != ((src_q31[n] > lo31) ? src_q31[n] : hi31));
+      bad += (dst_q15[n] != ((src_q15[n] > lo15) ? src_q15[n] : -32768));
+      bad += (dst_q7[n] != ((src_q7[n] > lo7) ? src_q7[n] : hi7));
+    }
+  }
+  ok = (bad == 0);
+  printf("CHECK riscv_threshold_X: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Masks, the words past the mask keep their value */
+  for (i = 0, bad = 0; i < NUM_LENGTHS; i++)
+  {
+    len = lengths[i];
+    REF_MASK(src_f32, lo32, hi32, len);
+    count = riscv_cmp_range_mask_f32(src_f32, lo32, hi32, mask, len);
+    bad += (count != refCount) + (memcmp(mask, refMask, sizeof(mask)) != 0);
+    REF_MASK(src_q31, lo31, hi31, len);
+    count = riscv_cmp_range_mask_q31(src_q31, lo31, hi31, mask, len);
+    bad += (count != refCount) + (memcmp(mask, refMask, sizeof(mask)) != 0);
+    REF_MASK(src_q15, lo15, hi15, len);
+    count = riscv_cmp_range_mask_q15(src_q15, lo15, hi15, mask, len);
+    bad += (count != refCount) + (memcmp(mask, refMask, sizeof(mask)) != 0);
+    REF_MASK(src_q7, lo7, hi7, len);
+    count = riscv_cmp_range_mask_q7(src_q7, lo7, hi7, mask, len);
+    bad += (count != refCount) + (memcmp(mask, refMask, sizeof(mask)) != 0);
+  }
+
+  /* Equality and the full range of the type */
+  REF_MASK(src_q15, -32768, -32768, BLOCK_SIZE);
+  count = riscv_cmp_range_mask_q15(src_q15, -32768, -32768, mask, BLOCK_SIZE);
+  bad += (count != refCount) + (memcmp(mask, refMask, sizeof(mask)) != 0) + (count == 0);
+  count = riscv_cmp_range_mask_q7(src_q7, -128, 127, mask, BLOCK_SIZE);
+  bad += (count != BLOCK_SIZE);
+  ok = (bad == 0);
+  printf("CHECK riscv_cmp_range_mask_X: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
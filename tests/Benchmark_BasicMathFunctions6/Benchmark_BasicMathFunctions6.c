@@ -0,0 +1,159 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 256
+#define MAX_LENGTH 40
+#define NUM_TAPS 30
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The Q15 and Q7 dot products and copies run on every pair of source and destination offsets 0 to 3
+and on 0 to 39 elements, and must match a plain C loop; the copies must leave the rest of the
+destination alone.  The Q15 FIR runs with its state at an even and at an odd address, on blocks of
+1 to 100 samples, and must match the convolution.  The benchmarks measure the dot products and
+copies with aligned and with odd-offset pointers.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "BasicMathFunctions6"
+#include "../common/riscv_bench.h"
+
+q15_t srcA_q15[BLOCK_SIZE + 4] __attribute__((aligned(4))), srcB_q15[BLOCK_SIZE + 4] __attribute__((aligned(4)));
+q15_t dst_q15[BLOCK_SIZE + 4] __attribute__((aligned(4)));
+q7_t srcA_q7[BLOCK_SIZE + 4] __attribute__((aligned(4))), srcB_q7[BLOCK_SIZE + 4] __attribute__((aligned(4)));
+q7_t dst_q7[BLOCK_SIZE + 4] __attribute__((aligned(4)));
+q15_t coeffs_q15[NUM_TAPS] __attribute__((aligned(4)));
+q15_t state_q15[NUM_TAPS + 100 + 1] __attribute__((aligned(4)));
+q15_t out_q15[BLOCK_SIZE], ref_q15[BLOCK_SIZE];
+
+static uint32_t seed = 146u;
+
+static uint32_t next_rand(void)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return seed;
+}
+
+/* Dot products and copies of len elements from offset oa to offset ob, returns the mismatches */
+static int32_t check_offsets(uint32_t oa, uint32_t ob, uint32_t len)
+{
+  q63_t sum15, ref15 = 0;
+  q31_t sum7, ref7 = 0;
+  uint32_t n;
+  int32_t bad = 0;
+
+  for (n = 0u; n < len; n++)
+  {
+    ref15 += (q31_t) srcA_q15[oa + n] * srcB_q15[ob + n];
+    ref7 += (q31_t) srcA_q7[oa + n] * srcB_q7[ob + n];
+  }
+  riscv_dot_prod_q15(&srcA_q15[oa], &srcB_q15[ob], len, &sum15);
+  riscv_dot_prod_q7(&srcA_q7[oa], &srcB_q7[ob], len, &sum7);
+  bad += (sum15 != ref15) + (sum7 != ref7);
+
+  memset(dst_q15, 0, sizeof(dst_q15));
+  memset(dst_q7, 0, sizeof(dst_q7));
+  riscv_copy_q15(&srcA_q15[oa], &dst_q15[ob], len);
+  riscv_copy_q7(&srcA_q7[oa], &dst_q7[ob], len);
+  for (n = 0u; n < BLOCK_SIZE + 4u; n++)
+  {
+    bad += dst_q15[n] != (((n >= ob) && (n < ob + len)) ? srcA_q15[oa + n - ob] : 0);
+    bad += dst_q7[n] != (((n >= ob) && (n < ob + len)) ? srcA_q7[oa + n - ob] : 0);
+  }
+
+  return bad;
+}
+
+/* The FIR with its state at state_q15 + offset over a run of block sizes, returns the mismatches */
+static int32_t check_fir(uint32_t offset)
+{
+  const uint32_t blocks[8] = { 7, 1, 2, 3, 4, 13, 100, 5 };
+  riscv_fir_instance_q15 S;
+  uint32_t pos = 0u, k, n, j;
+  int32_t bad = 0;
+  q63_t acc;
+
+  riscv_fir_init_q15(&S, NUM_TAPS, coeffs_q15, &state_q15[offset], 100u);
+  for (k = 0u; k < 8u; k++)
+  {
+    riscv_fir_q15(&S, &srcA_q15[pos], &out_q15[pos], blocks[k]);
+    pos += blocks[k];
+  }
+
+  /* y[n] = sum of pCoeffs[j] * x[n - (numTaps - 1) + j] */
+  for (n = 0u; n < pos; n++)
+  {
+    acc = 0;
+    for (j = 0u; j < NUM_TAPS; j++)
+    {
+      if(n + j >= NUM_TAPS - 1u)
+      {
+        acc += (q31_t) coeffs_q15[j] * srcA_q15[n + j - (NUM_TAPS - 1u)];
+      }
+    }
+    ref_q15[n] = (q15_t) __SSAT((q31_t) (acc >> 15), 16);
+    bad += out_q15[n] != ref_q15[n];
+  }
+
+  return bad;
+}
+
+int main(void)
+{
+  uint32_t n, oa, ob;
+  int32_t fail = 0, ok, bad;
+  q63_t sum15;
+  q31_t sum7;
+
+  riscv_bench_header();
+
+  for (n = 0u; n < BLOCK_SIZE + 4u; n++)
+  {
+    srcA_q15[n] = (q15_t) (next_rand() >> 16);
+    srcB_q15[n] = (q15_t) (next_rand() >> 16);
+    srcA_q7[n] = (q7_t) (next_rand() >> 24);
+    srcB_q7[n] = (q7_t) (next_rand() >> 24);
+  }
+  for (n = 0u; n < NUM_TAPS; n++)
+  {
+    coeffs_q15[n] = (q15_t) (next_rand() >> 18);
+  }
+
+  bad = 0;
+  for (oa = 0u; oa < 4u; oa++)
+  {
+    for (ob = 0u; ob < 4u; ob++)
+    {
+      for (n = 0u; n < MAX_LENGTH; n++)
+      {
+        bad += check_offsets(oa, ob, n);
+      }
+    }
+  }
+  ok = (bad == 0);
+  printf("CHECK dot_prod/copy offsets %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  ok = (check_fir(0u) == 0) && (check_fir(1u) == 0);
+  printf("CHECK fir_q15 odd state %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  RISCV_BENCH("riscv_dot_prod_q15", "q15", BLOCK_SIZE, riscv_dot_prod_q15(srcA_q15, srcB_q15, BLOCK_SIZE, &sum15));
+  RISCV_BENCH("riscv_dot_prod_q15_odd", "q15", BLOCK_SIZE, riscv_dot_prod_q15(srcA_q15, &srcB_q15[1], BLOCK_SIZE, &sum15));
+  RISCV_BENCH("riscv_dot_prod_q7", "q7", BLOCK_SIZE, riscv_dot_prod_q7(srcA_q7, srcB_q7, BLOCK_SIZE, &sum7));
+  RISCV_BENCH("riscv_dot_prod_q7_odd", "q7", BLOCK_SIZE, riscv_dot_prod_q7(srcA_q7, &srcB_q7[3], BLOCK_SIZE, &sum7));
+  RISCV_BENCH("riscv_copy_q15", "q15", BLOCK_SIZE, riscv_copy_q15(srcA_q15, dst_q15, BLOCK_SIZE));
+  RISCV_BENCH("riscv_copy_q15_odd", "q15", BLOCK_SIZE, riscv_copy_q15(&srcA_q15[1], dst_q15, BLOCK_SIZE));
+  RISCV_BENCH("riscv_copy_q7", "q7", BLOCK_SIZE, riscv_copy_q7(srcA_q7, dst_q7, BLOCK_SIZE));
+  RISCV_BENCH("riscv_copy_q7_odd", "q7", BLOCK_SIZE, riscv_copy_q7(&srcA_q7[1], dst_q7, BLOCK_SIZE));
+
+  return (fail);
+}
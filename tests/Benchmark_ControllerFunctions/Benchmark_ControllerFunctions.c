@@ -7,7 +7,6 @@
 #include "bar.h"
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 #define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(100*X[i])); \
 printf("\n\n")
 #define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
@@ -15,29 +14,14 @@ printf("\n\n")
 //#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
 #define MAX_BLOCKSIZE 32
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
-*Also the correct results are printed for the current vectors which are calculated from the orignal library 
+*Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "ControllerFunctions"
+#include "../common/riscv_bench.h"
 
  float32_t srcA_buf_f32[MAX_BLOCKSIZE] =
 {
@@ -106,6 +90,26 @@ void perf_enable_id( int eventid){
 riscv_pid_instance_f32 S_PID_f32;
 riscv_pid_instance_q15 S_PID_q15;
 riscv_pid_instance_q31 S_PID_q31;
+
+/*Batched PID, same gains as the single controllers and limits on the outputs*/
+#define NUM_LOOPS 12
+riscv_pid_batch_instance_f32 S_PIDB_f32;
+riscv_pid_batch_instance_q15 S_PIDB_q15;
+riscv_pid_batch_instance_q31 S_PIDB_q31;
+float32_t kp_f32[NUM_LOOPS], ki_f32[NUM_LOOPS], kd_f32[NUM_LOOPS];
+float32_t coeffsB_f32[3*NUM_LOOPS], stateB_f32[3*NUM_LOOPS], limitsB_f32[2*NUM_LOOPS];
+q15_t kp_q15[NUM_LOOPS], ki_q15[NUM_LOOPS], kd_q15[NUM_LOOPS];
+q15_t coeffsB_q15[3*NUM_LOOPS] __attribute__((aligned(4))), stateB_q15[3*NUM_LOOPS] __attribute__((aligned(4))), limitsB_q15[2*NUM_LOOPS];
+q31_t kp_q31[NUM_LOOPS], ki_q31[NUM_LOOPS], kd_q31[NUM_LOOPS];
+q31_t coeffsB_q31[3*NUM_LOOPS], stateB_q31[3*NUM_LOOPS], limitsB_q31[2*NUM_LOOPS];
+
+/*FOC step, the current controllers use the gains of the single PID controllers*/
+riscv_foc_instance_f32 S_FOC_f32;
+riscv_foc_instance_q31 S_FOC_q31;
+float32_t Va_f32 = 0, Vb_f32 = 0;
+q31_t Va_q31 = 0, Vb_q31 = 0;
+float32_t IdRef_f32 = 0.1, IqRef_f32 = 0.5;
+q31_t IdRef_q31 = 0x0800, IqRef_q31 = 0x4000;
 /*Vector Clarke Transform variables*/
 float32_t Ia_f32 = 0.7,  Ib_f32 = 0.9;
 float32_t pIalpha_f32 = 0,  pIbeta_f32 = 0;
@@ -117,6 +121,8 @@ float32_t theta_f32 = 1.2;
 q31_t theta_q31 = 0xF140;
 float32_t pSinVal_f32 = 0, pCosVal_f32 = 0;
 q31_t pSinVal_q31 = 0, pCosVal_q31 = 0;
+float32_t theta_blk_f32[MAX_BLOCKSIZE], cos_blk_f32[MAX_BLOCKSIZE];
+q31_t theta_blk_q31[MAX_BLOCKSIZE], cos_blk_q31[MAX_BLOCKSIZE];
 
 float32_t result_f32[MAX_BLOCKSIZE]; 
 q7_t result_q7[MAX_BLOCKSIZE];
@@ -129,6 +135,7 @@ int32_t resetStateFlag = 1;
 int i = 0,j = 0 ; /*loop counters*/
 int32_t main(void)
 {
+  riscv_bench_header();
 
 /*PID inits*/
   S_PID_f32.Kp = 0.7;
@@ -147,106 +154,131 @@ int32_t main(void)
   riscv_pid_init_q15(&S_PID_q15, resetStateFlag);
   riscv_pid_init_q31(&S_PID_q31, resetStateFlag);
 
+  for(i = 0; i < NUM_LOOPS; i++)
+  {
+    kp_f32[i] = S_PID_f32.Kp;  ki_f32[i] = S_PID_f32.Ki;  kd_f32[i] = S_PID_f32.Kd;
+    kp_q15[i] = S_PID_q15.Kp;  ki_q15[i] = S_PID_q15.Ki;  kd_q15[i] = S_PID_q15.Kd;
+    kp_q31[i] = S_PID_q31.Kp;  ki_q31[i] = S_PID_q31.Ki;  kd_q31[i] = S_PID_q31.Kd;
+    limitsB_f32[2*i] = -1.0f;  limitsB_f32[2*i+1] = 1.0f;
+    limitsB_q15[2*i] = -0x1000;  limitsB_q15[2*i+1] = 0x1000;
+    limitsB_q31[2*i] = -0x10000000;  limitsB_q31[2*i+1] = 0x10000000;
+  }
+  riscv_pid_batch_init_f32(&S_PIDB_f32, NUM_LOOPS, kp_f32, ki_f32, kd_f32, coeffsB_f32, stateB_f32, limitsB_f32, resetStateFlag);
+  riscv_pid_batch_init_q15(&S_PIDB_q15, NUM_LOOPS, kp_q15, ki_q15, kd_q15, coeffsB_q15, stateB_q15, limitsB_q15, resetStateFlag);
+  riscv_pid_batch_init_q31(&S_PIDB_q31, NUM_LOOPS, kp_q31, ki_q31, kd_q31, coeffsB_q31, stateB_q31, limitsB_q31, resetStateFlag);
+
+  S_FOC_f32.pidD = S_PID_f32;
+  S_FOC_f32.pidQ = S_PID_f32;
+  S_FOC_q31.pidD = S_PID_q31;
+  S_FOC_q31.pidQ = S_PID_q31;
+  riscv_pid_init_f32(&S_FOC_f32.pidD, resetStateFlag);
+  riscv_pid_init_f32(&S_FOC_f32.pidQ, resetStateFlag);
+  riscv_pid_init_q31(&S_FOC_q31.pidD, resetStateFlag);
+  riscv_pid_init_q31(&S_FOC_q31.pidQ, resetStateFlag);
+
 /*Tests*/
 /*PID*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  for(j=0;j<MAX_BLOCKSIZE;j++)
-  result_f32[j] =  riscv_pid_f32( &S_PID_f32, srcA_buf_f32[j] );
-  perf_stop();
-  printf("riscv_pid_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_pid_f32", "f32", MAX_BLOCKSIZE,
+    for(j=0;j<MAX_BLOCKSIZE;j++)
+    result_f32[j] =  riscv_pid_f32( &S_PID_f32, srcA_buf_f32[j] ));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  for(j=0;j<MAX_BLOCKSIZE;j++)
-  result_q15[j] =  riscv_pid_q15( &S_PID_q15, srcA_buf_q15[j] );
-  perf_stop();
-  printf("riscv_pid_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_pid_q15", "q15", MAX_BLOCKSIZE,
+    for(j=0;j<MAX_BLOCKSIZE;j++)
+    result_q15[j] =  riscv_pid_q15( &S_PID_q15, srcA_buf_q15[j] ));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  for(j=0;j<MAX_BLOCKSIZE;j++)
-  result_q31[j] =  riscv_pid_q31( &S_PID_q31, srcA_buf_q31[j] );
-  perf_stop();
-  printf("riscv_pid_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_pid_q31", "q31", MAX_BLOCKSIZE,
+    for(j=0;j<MAX_BLOCKSIZE;j++)
+    result_q31[j] =  riscv_pid_q31( &S_PID_q31, srcA_buf_q31[j] ));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
 
+/*Batched PID, one control tick of NUM_LOOPS controllers*/
+
+  RISCV_BENCH("riscv_pid_batch_f32(12)", "f32", NUM_LOOPS,
+    riscv_pid_batch_f32(&S_PIDB_f32, srcA_buf_f32, result_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(result_f32,NUM_LOOPS);
+#endif
+
+  RISCV_BENCH("riscv_pid_batch_q15(12)", "q15", NUM_LOOPS,
+    riscv_pid_batch_q15(&S_PIDB_q15, srcA_buf_q15, result_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q15,NUM_LOOPS);
+#endif
+
+  RISCV_BENCH("riscv_pid_batch_q31(12)", "q31", NUM_LOOPS,
+    riscv_pid_batch_q31(&S_PIDB_q31, srcA_buf_q31, result_q31));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q31,NUM_LOOPS);
+#endif
+
 /*Vector Clarke Transform*/
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_clarke_f32(Ia_f32, Ib_f32, &pIalpha_f32, &pIbeta_f32);
-  perf_stop();
-  printf("riscv_clarke_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_clarke_q31(Ia_q31, Ib_q31, &pIalpha_q31, &pIbeta_q31);
-  perf_stop();
-  printf("riscv_clarke_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_clarke_f32", "f32", 1,
+    riscv_clarke_f32(Ia_f32, Ib_f32, &pIalpha_f32, &pIbeta_f32));
+  RISCV_BENCH("riscv_clarke_q31", "q31", 1,
+    riscv_clarke_q31(Ia_q31, Ib_q31, &pIalpha_q31, &pIbeta_q31));
 #ifdef PRINT_OUTPUT
   printf("riscv_clarke_f32 = %d  %d\nriscv_clarke_q31 = 0x%X  0x%X\n\n",(int)(100*pIalpha_f32),(int)(100*pIbeta_f32),pIalpha_q31,pIbeta_q31 );
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_inv_clarke_f32( pIalpha_f32, pIbeta_f32, &Ia_f32, &Ib_f32);
-  perf_stop();
-  printf("riscv_inv_clarke_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_inv_clarke_q31( pIalpha_q31, pIbeta_q31, &Ia_q31, &Ib_q31);
-  perf_stop();
-  printf("riscv_inv_clarke_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_inv_clarke_f32", "f32", 1,
+    riscv_inv_clarke_f32( pIalpha_f32, pIbeta_f32, &Ia_f32, &Ib_f32));
+  RISCV_BENCH("riscv_inv_clarke_q31", "q31", 1,
+    riscv_inv_clarke_q31( pIalpha_q31, pIbeta_q31, &Ia_q31, &Ib_q31));
 #ifdef PRINT_OUTPUT
   printf("riscv_inv_clarke_f32 = %d  %d\nriscv_inv_clarke_q31 = 0x%X  0x%X\n\n",(int)(100*Ia_f32),(int)(100*Ib_f32),Ia_q31,Ib_q31 );
 #endif
 /*Sine Cosine*/
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_sin_cos_f32(theta_f32, &pSinVal_f32, &pCosVal_f32);
-  perf_stop();
-  printf("riscv_sin_cos_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_sin_cos_q31(theta_q31, &pSinVal_q31, &pCosVal_q31);
-  perf_stop();
-  printf("riscv_sin_cos_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_sin_cos_f32", "f32", 1,
+    riscv_sin_cos_f32(theta_f32, &pSinVal_f32, &pCosVal_f32));
+  RISCV_BENCH("riscv_sin_cos_q31", "q31", 1,
+    riscv_sin_cos_q31(theta_q31, &pSinVal_q31, &pCosVal_q31));
 #ifdef PRINT_OUTPUT
   printf("riscv_sin_cos_f32 = %d  %d\nriscv_sin_cos_q31 = 0x%X  0x%X\n\n",(int)(100*pSinVal_f32),(int)(100*pCosVal_f32),pSinVal_q31,pCosVal_q31 );
+#endif
+  /* Steps of 11.25 degrees */
+  for(i = 0; i < MAX_BLOCKSIZE; i++)
+  {
+    theta_blk_f32[i] = 11.25f * i;
+    theta_blk_q31[i] = (q31_t) (i * 0x08000000u);
+  }
+  RISCV_BENCH("riscv_sin_cos_block_f32", "f32", MAX_BLOCKSIZE,
+    riscv_sin_cos_block_f32(theta_blk_f32, result_f32, cos_blk_f32, MAX_BLOCKSIZE));
+  RISCV_BENCH("riscv_sin_cos_block_q31", "q31", MAX_BLOCKSIZE,
+    riscv_sin_cos_block_q31(theta_blk_q31, result_q31, cos_blk_q31, MAX_BLOCKSIZE));
+#ifdef PRINT_OUTPUT
+  printf("riscv_sin_cos_block_f32 = %d  %d\nriscv_sin_cos_block_q31 = 0x%X  0x%X\n",(int)(1000*result_f32[3]),(int)(1000*cos_blk_f32[3]),result_q31[3],cos_blk_q31[3] );
+  printf("Correct answer = 555  831 0x471CECE7  0x6A6D98A4\n\n");
 #endif
 /*Vector Park Transform*/
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_park_f32(Ia_f32, Ib_f32, &pIalpha_f32, &pIbeta_f32, pSinVal_f32, pCosVal_f32);
-  perf_stop();
-  printf("riscv_park_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_park_q31(Ia_q31, Ib_q31, &pIalpha_q31, &pIbeta_q31, pSinVal_q31, pCosVal_q31);
-  perf_stop();
-  printf("riscv_park_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_park_f32", "f32", 1,
+    riscv_park_f32(Ia_f32, Ib_f32, &pIalpha_f32, &pIbeta_f32, pSinVal_f32, pCosVal_f32));
+  RISCV_BENCH("riscv_park_q31", "q31", 1,
+    riscv_park_q31(Ia_q31, Ib_q31, &pIalpha_q31, &pIbeta_q31, pSinVal_q31, pCosVal_q31));
 #ifdef PRINT_OUTPUT
   printf("riscv_park_f32 = %d  %d\nriscv_park_q31 = 0x%X  0x%X\n\n",(int)(100*pIalpha_f32),(int)(100*pIbeta_f32),pIalpha_q31,pIbeta_q31 );
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_inv_park_f32( pIalpha_f32, pIbeta_f32, &Ia_f32, &Ib_f32, pSinVal_f32, pCosVal_f32);
-  perf_stop();
-  printf("riscv_inv_park_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_inv_park_q31( pIalpha_q31, pIbeta_q31, &Ia_q31, &Ib_q31, pSinVal_q31, pCosVal_q31);
-  perf_stop();
-  printf("riscv_inv_park_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_inv_park_f32", "f32", 1,
+    riscv_inv_park_f32( pIalpha_f32, pIbeta_f32, &Ia_f32, &Ib_f32, pSinVal_f32, pCosVal_f32));
+  RISCV_BENCH("riscv_inv_park_q31", "q31", 1,
+    riscv_inv_park_q31( pIalpha_q31, pIbeta_q31, &Ia_q31, &Ib_q31, pSinVal_q31, pCosVal_q31));
 #ifdef PRINT_OUTPUT
   printf("riscv_inv_park_f32 = %d  %d\nriscv_inv_park_q31 = 0x%X  0x%X\n\n",(int)(100*Ia_f32),(int)(100*Ib_f32),Ia_q31,Ib_q31 );
+#endif
+/*FOC step*/
+  RISCV_BENCH("riscv_foc_step_f32", "f32", 1,
+    riscv_foc_step_f32(&S_FOC_f32, Ia_f32, Ib_f32, theta_f32, IdRef_f32, IqRef_f32, &Va_f32, &Vb_f32));
+  RISCV_BENCH("riscv_foc_step_q31", "q31", 1,
+    riscv_foc_step_q31(&S_FOC_q31, Ia_q31, Ib_q31, theta_q31, IdRef_q31, IqRef_q31, &Va_q31, &Vb_q31));
+#ifdef PRINT_OUTPUT
+  printf("riscv_foc_step_f32 = %d  %d\nriscv_foc_step_q31 = 0x%X  0x%X\n\n",(int)(100*Va_f32),(int)(100*Vb_f32),Va_q31,Vb_q31 );
 #endif
   printf("End\n");
 
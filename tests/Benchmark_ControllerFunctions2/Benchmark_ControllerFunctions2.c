@@ -0,0 +1,318 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_QUAT 64
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*NUM_QUAT random orientations are processed per call in structure-of-arrays layout.  The product is timed
+against one riscv_mat_mult_f32() of the 4x4 left multiplication matrix per quaternion.  Every kernel is
+compared with a computation in double: 1e-5 for f32, a few LSB for Q31.  The Q31 product takes unit
+quaternions at half scale so that it does not saturate, the rotations full scale unit quaternions
+compared with their rotation matrix, as their norm is 1 only to the precision of the f32 quaternions.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "ControllerFunctions2"
+#include "../common/riscv_bench.h"
+
+float32_t qa_f32[4 * NUM_QUAT], qb_f32[4 * NUM_QUAT], qd_f32[4 * NUM_QUAT];
+float32_t v_f32[3 * NUM_QUAT], vd_f32[3 * NUM_QUAT], r_f32[9 * NUM_QUAT];
+q31_t qa_q31[4 * NUM_QUAT], qb_q31[4 * NUM_QUAT], qd_q31[4 * NUM_QUAT];
+q31_t v_q31[3 * NUM_QUAT], vd_q31[3 * NUM_QUAT], r_q31[9 * NUM_QUAT];
+float32_t mat_f32[16], col_f32[4], out_f32[4];
+double ref[9 * NUM_QUAT];
+
+static double rand_unit(uint32_t * pSeed)
+{
+  *pSeed = *pSeed * 1103515245u + 12345u;
+  return ((double)((int32_t)(*pSeed >> 16) & 0x7FFF) / 16384.0 - 1.0);
+}
+
+/* Element i of component c of the SoA arrays of the double reference */
+#define REF(c, i) ref[(c) * NUM_QUAT + (i)]
+
+static void ref_product(const double * a, const double * b, double * p)
+{
+  p[0] = a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3];
+  p[1] = a[0] * b[1] + a[1] * b[0] + a[2] * b[3] - a[3] * b[2];
+  p[2] = a[0] * b[2] - a[1] * b[3] + a[2] * b[0] + a[3] * b[1];
+  p[3] = a[0] * b[3] + a[1] * b[2] - a[2] * b[1] + a[3] * b[0];
+}
+
+/* q v q* as two products */
+static void ref_rotate(const double * q, const double * v, double * r)
+{
+  double qv[4] = { 0.0, v[0], v[1], v[2] }, conj[4] = { q[0], -q[1], -q[2], -q[3] }, t[4], u[4];
+
+  ref_product(q, qv, t);
+  ref_product(t, conj, u);
+  r[0] = u[1];
+  r[1] = u[2];
+  r[2] = u[3];
+}
+
+/* Rotation matrix of q times v, which is q v q* for a unit quaternion */
+static void ref_rotate_matrix(const double * q, const double * v, double * r)
+{
+  double w = q[0], x = q[1], y = q[2], z = q[3];
+
+  r[0] = (1.0 - 2.0 * (y * y + z * z)) * v[0] + 2.0 * (x * y - w * z) * v[1] + 2.0 * (x * z + w * y) * v[2];
+  r[1] = 2.0 * (x * y + w * z) * v[0] + (1.0 - 2.0 * (x * x + z * z)) * v[1] + 2.0 * (y * z - w * x) * v[2];
+  r[2] = 2.0 * (x * z - w * y) * v[0] + 2.0 * (y * z + w * x) * v[1] + (1.0 - 2.0 * (x * x + y * y)) * v[2];
+}
+
+static double max_err_f32(const float32_t * p, uint32_t count, double scale)
+{
+  double e, m = 0.0;
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    e = fabs(p[i] - ref[i] * scale);
+    m = (e > m) ? e : m;
+  }
+
+  return (m);
+}
+
+static double max_err_q31(const q31_t * p, uint32_t count, double scale)
+{
+  double e, m = 0.0;
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    e = fabs((double) p[i] - ref[i] * scale);
+    m = (e > m) ? e : m;
+  }
+
+  return (m);
+}
+
+int32_t main(void)
+{
+  uint32_t i, c;
+  uint32_t seed = 1u;
+  int32_t fail = 0, ok;
+  double a[4], b[4], p[4], v[3], r[3], norm, e;
+
+  riscv_bench_header();
+
+  for (i = 0; i < 4 * NUM_QUAT; i++)
+  {
+    qa_f32[i] = (float32_t) rand_unit(&seed);
+    qb_f32[i] = (float32_t) rand_unit(&seed);
+    qa_q31[i] = (q31_t)(qa_f32[i] * 1073741824.0f);
+  }
+  for (i = 0; i < 3 * NUM_QUAT; i++)
+  {
+    v_f32[i] = (float32_t) rand_unit(&seed);
+    v_q31[i] = (q31_t)(v_f32[i] * 1073741824.0f);
+  }
+
+/*Normalize*/
+  RISCV_BENCH("riscv_quaternion_normalize_f32", "f32", NUM_QUAT,
+    riscv_quaternion_normalize_f32(qa_f32, qd_f32, NUM_QUAT));
+  for (i = 0; i < NUM_QUAT; i++)
+  {
+    for (norm = 0.0, c = 0; c < 4; c++)
+      norm += (double) qa_f32[c * NUM_QUAT + i] * qa_f32[c * NUM_QUAT + i];
+    for (c = 0; c < 4; c++)
+      REF(c, i) = qa_f32[c * NUM_QUAT + i] / sqrt(norm);
+  }
+  e = max_err_f32(qd_f32, 4 * NUM_QUAT, 1.0);
+  ok = (e < 1e-5);
+  printf("CHECK riscv_quaternion_normalize_f32: error %.2e %s\n", e, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  RISCV_BENCH("riscv_quaternion_normalize_q31", "q31", NUM_QUAT,
+    riscv_quaternion_normalize_q31(qa_q31, qd_q31, NUM_QUAT));
+  for (i = 0; i < NUM_QUAT; i++)
+  {
+    for (norm = 0.0, c = 0; c < 4; c++)
+      norm += (double) qa_q31[c * NUM_QUAT + i] * qa_q31[c * NUM_QUAT + i];
+    for (c = 0; c < 4; c++)
+      REF(c, i) = qa_q31[c * NUM_QUAT + i] / sqrt(norm);
+  }
+  e = max_err_q31(qd_q31, 4 * NUM_QUAT, 2147483648.0);
+  ok = (e <= 8.0);
+  printf("CHECK riscv_quaternion_normalize_q31: error %.1f LSB %s\n", e, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Unit quaternions from here on, the Q31 ones at half scale */
+  for (i = 0; i < NUM_QUAT; i++)
+  {
+    for (norm = 0.0, c = 0; c < 4; c++)
+      norm += (double) qa_f32[c * NUM_QUAT + i] * qa_f32[c * NUM_QUAT + i];
+    for (c = 0; c < 4; c++)
+      qa_f32[c * NUM_QUAT + i] = (float32_t)(qa_f32[c * NUM_QUAT + i] / sqrt(norm));
+    for (norm = 0.0, c = 0; c < 4; c++)
+      norm += (double) qb_f32[c * NUM_QUAT + i] * qb_f32[c * NUM_QUAT + i];
+    for (c = 0; c < 4; c++)
+      qb_f32[c * NUM_QUAT + i] = (float32_t)(qb_f32[c * NUM_QUAT + i] / sqrt(norm));
+  }
+  for (i = 0; i < 4 * NUM_QUAT; i++)
+  {
+    qa_q31[i] = (q31_t)(qa_f32[i] * 1073741824.0f);
+    qb_q31[i] = (q31_t)(qb_f32[i] * 1073741824.0f);
+  }
+
+/*Product*/
+  RISCV_BENCH("riscv_mat_mult_f32 4x4", "f32", NUM_QUAT,
+    riscv_matrix_instance_f32 L, B, P;
+    riscv_mat_init_f32(&L, 4, 4, mat_f32);
+    riscv_mat_init_f32(&B, 4, 1, col_f32);
+    riscv_mat_init_f32(&P, 4, 1, out_f32);
+    for (i = 0; i < NUM_QUAT; i++)
+    {
+      float32_t w = qa_f32[i], x = qa_f32[NUM_QUAT + i], y = qa_f32[2 * NUM_QUAT + i], z = qa_f32[3 * NUM_QUAT + i];
+      mat_f32[0] = w;  mat_f32[1] = -x; mat_f32[2] = -y; mat_f32[3] = -z;
+      mat_f32[4] = x;  mat_f32[5] = w;  mat_f32[6] = -z; mat_f32[7] = y;
+      mat_f32[8] = y;  mat_f32[9] = z;  mat_f32[10] = w; mat_f32[11] = -x;
+      mat_f32[12] = z; mat_f32[13] = -y; mat_f32[14] = x; mat_f32[15] = w;
+      for (c = 0; c < 4; c++)
+        col_f32[c] = qb_f32[c * NUM_QUAT + i];
+      riscv_mat_mult_f32(&L, &B, &P);
+      for (c = 0; c < 4; c++)
+        qd_f32[c * NUM_QUAT + i] = out_f32[c];
+    });
+  RISCV_BENCH("riscv_quaternion_product_f32", "f32", NUM_QUAT,
+    riscv_quaternion_product_f32(qa_f32, qb_f32, qd_f32, NUM_QUAT));
+  for (i = 0; i < NUM_QUAT; i++)
+  {
+    for (c = 0; c < 4; c++)
+    {
+      a[c] = qa_f32[c * NUM_QUAT + i];
+      b[c] = qb_f32[c * NUM_QUAT + i];
+    }
+    ref_product(a, b, p);
+    for (c = 0; c < 4; c++)
+      REF(c, i) = p[c];
+  }
+  e = max_err_f32(qd_f32, 4 * NUM_QUAT, 1.0);
+  ok = (e < 1e-5);
+  printf("CHECK riscv_quaternion_product_f32: error %.2e %s\n", e, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  RISCV_BENCH("riscv_quaternion_product_q31", "q31", NUM_QUAT,
+    riscv_quaternion_product_q31(qa_q31, qb_q31, qd_q31, NUM_QUAT));
+  for (i = 0; i < NUM_QUAT; i++)
+  {
+    for (c = 0; c < 4; c++)
+    {
+      a[c] = qa_q31[c * NUM_QUAT + i] / 2147483648.0;
+      b[c] = qb_q31[c * NUM_QUAT + i] / 2147483648.0;
+    }
+    ref_product(a, b, p);
+    for (c = 0; c < 4; c++)
+      REF(c, i) = p[c];
+  }
+  e = max_err_q31(qd_q31, 4 * NUM_QUAT, 2147483648.0);
+  ok = (e <= 2.0);
+  printf("CHECK riscv_quaternion_product_q31: error %.1f LSB %s\n", e, ok ? "ok" : "bad");
+  fail |= !ok;
+
+/*Conjugate*/
+  RISCV_BENCH("riscv_quaternion_conjugate_f32", "f32", NUM_QUAT,
+    riscv_quaternion_conjugate_f32(qa_f32, qd_f32, NUM_QUAT));
+  ok = (memcmp(qd_f32, qa_f32, NUM_QUAT * sizeof(float32_t)) == 0);
+  for (i = NUM_QUAT; i < 4 * NUM_QUAT; i++)
+    ok &= (qd_f32[i] == -qa_f32[i]);
+  RISCV_BENCH("riscv_quaternion_conjugate_q31", "q31", NUM_QUAT,
+    riscv_quaternion_conjugate_q31(qa_q31, qd_q31, NUM_QUAT));
+  for (i = 0; i < 4 * NUM_QUAT; i++)
+    ok &= (qd_q31[i] == ((i < NUM_QUAT) ? qa_q31[i] : -qa_q31[i]));
+  qd_q31[1] = INT32_MIN;
+  riscv_quaternion_conjugate_q31(qd_q31, qd_q31, 1);
+  ok &= (qd_q31[1] == INT32_MAX);
+  printf("CHECK riscv_quaternion_conjugate: %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+/*Rotation*/
+  RISCV_BENCH("riscv_quaternion_rotate_f32", "f32", NUM_QUAT,
+    riscv_quaternion_rotate_f32(qa_f32, v_f32, vd_f32, NUM_QUAT));
+  for (i = 0; i < NUM_QUAT; i++)
+  {
+    for (c = 0; c < 4; c++)
+      a[c] = qa_f32[c * NUM_QUAT + i];
+    for (c = 0; c < 3; c++)
+      v[c] = v_f32[c * NUM_QUAT + i];
+    ref_rotate(a, v, r);
+    for (c = 0; c < 3; c++)
+      REF(c, i) = r[c];
+  }
+  e = max_err_f32(vd_f32, 3 * NUM_QUAT, 1.0);
+  ok = (e < 1e-5);
+  printf("CHECK riscv_quaternion_rotate_f32: error %.2e %s\n", e, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Full scale unit quaternions, 1.0 saturated to 0x7FFFFFFF */
+  for (i = 0; i < 4 * NUM_QUAT; i++)
+    qa_q31[i] = clip_q63_to_q31((q63_t)(qa_f32[i] * 2147483648.0));
+  RISCV_BENCH("riscv_quaternion_rotate_q31", "q31", NUM_QUAT,
+    riscv_quaternion_rotate_q31(qa_q31, v_q31, vd_q31, NUM_QUAT));
+  for (i = 0; i < NUM_QUAT; i++)
+  {
+    for (c = 0; c < 4; c++)
+      a[c] = qa_q31[c * NUM_QUAT + i] / 2147483648.0;
+    for (c = 0; c < 3; c++)
+      v[c] = v_q31[c * NUM_QUAT + i];
+    ref_rotate_matrix(a, v, r);
+    for (c = 0; c < 3; c++)
+      REF(c, i) = r[c];
+  }
+  e = max_err_q31(vd_q31, 3 * NUM_QUAT, 1.0);
+  ok = (e <= 4.0);
+  printf("CHECK riscv_quaternion_rotate_q31: error %.1f LSB %s\n", e, ok ? "ok" : "bad");
+  fail |= !ok;
+
+/*Rotation matrix*/
+  RISCV_BENCH("riscv_quaternion2rotation_f32", "f32", NUM_QUAT,
+    riscv_quaternion2rotation_f32(qa_f32, r_f32, NUM_QUAT));
+  /* Each matrix times the vector must give the rotated vector */
+  for (i = 0; i < NUM_QUAT; i++)
+    for (c = 0; c < 3; c++)
+      REF(c, i) = (double) r_f32[(3 * c) * NUM_QUAT + i] * v_f32[i] +
+                  (double) r_f32[(3 * c + 1) * NUM_QUAT + i] * v_f32[NUM_QUAT + i] +
+                  (double) r_f32[(3 * c + 2) * NUM_QUAT + i] * v_f32[2 * NUM_QUAT + i];
+  e = max_err_f32(vd_f32, 3 * NUM_QUAT, 1.0);
+  ok = (e < 1e-5);
+  printf("CHECK riscv_quaternion2rotation_f32: error %.2e %s\n", e, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  RISCV_BENCH("riscv_quaternion2rotation_q31", "q31", NUM_QUAT,
+    riscv_quaternion2rotation_q31(qa_q31, r_q31, NUM_QUAT));
+  for (i = 0; i < NUM_QUAT; i++)
+  {
+    double w = qa_q31[i] / 2147483648.0, x = qa_q31[NUM_QUAT + i] / 2147483648.0;
+    double y = qa_q31[2 * NUM_QUAT + i] / 2147483648.0, z = qa_q31[3 * NUM_QUAT + i] / 2147483648.0;
+
+    REF(0, i) = 1.0 - 2.0 * (y * y + z * z);
+    REF(1, i) = 2.0 * (x * y - w * z);
+    REF(2, i) = 2.0 * (x * z + w * y);
+    REF(3, i) = 2.0 * (x * y + w * z);
+    REF(4, i) = 1.0 - 2.0 * (x * x + z * z);
+    REF(5, i) = 2.0 * (y * z - w * x);
+    REF(6, i) = 2.0 * (x * z - w * y);
+    REF(7, i) = 2.0 * (y * z + w * x);
+    REF(8, i) = 1.0 - 2.0 * (x * x + y * y);
+  }
+  for (i = 0; i < 9 * NUM_QUAT; i++)
+    ref[i] = (ref[i] < 1.0) ? ref[i] : 2147483647.0 / 2147483648.0;
+  e = max_err_q31(r_q31, 9 * NUM_QUAT, 2147483648.0);
+  ok = (e <= 4.0);
+  printf("CHECK riscv_quaternion2rotation_q31: error %.1f LSB %s\n", e, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  printf("End\n");
+
+  return (fail);
+}
@@ -0,0 +1,165 @@
+#include <math.h>
+#include <stdio.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCKSIZE 64
+#define NUM_STAGES 2
+#define DIM 8
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The f64 kernels: a two stage 2 Hz lowpass at 48 kHz, whose poles are too close to z=1 for f32 coefficients,
+the inverse and the product of 8x8 matrices and a 64 element dot product.  The CHECK lines compare them with
+plain C references.
+*Linked against riscv_cmsis_dsp_lib the kernels run in soft double, against riscv_cmsis_dsp_lib_double
+(RISCV_DSP_BUILD_DOUBLE, build column scalar_d) in D extension instructions; tests/CMakeLists.txt builds both
+as Benchmark_DoublePrecision and Benchmark_DoublePrecision_d.
+*/
+#define RISCV_BENCH_SUITE "DoublePrecision"
+#include "../common/riscv_bench.h"
+
+float64_t src_f64[BLOCKSIZE], dst_f64[BLOCKSIZE], ref_f64[BLOCKSIZE];
+float64_t vecA_f64[BLOCKSIZE], vecB_f64[BLOCKSIZE];
+float64_t coeffs_f64[5 * NUM_STAGES];
+float64_t state_f64[2 * NUM_STAGES], refState_f64[2 * NUM_STAGES];
+
+float64_t A_f64[DIM * DIM], B_f64[DIM * DIM], Inv_f64[DIM * DIM], Prod_f64[DIM * DIM];
+
+/* Butterworth lowpass section of the bilinear transform, b0 b1 b2 a1 a2 with the CMSIS sign of a */
+static void lowpass(float64_t fc, float64_t q, float64_t * pCoeffs)
+{
+  float64_t k = tan(3.141592653589793 * fc);
+  float64_t norm = 1.0 / (1.0 + (k / q) + (k * k));
+
+  pCoeffs[0] = k * k * norm;
+  pCoeffs[1] = 2.0 * pCoeffs[0];
+  pCoeffs[2] = pCoeffs[0];
+  pCoeffs[3] = -2.0 * ((k * k) - 1.0) * norm;
+  pCoeffs[4] = -(1.0 - (k / q) + (k * k)) * norm;
+}
+
+static void ref_biquad(const float64_t * pSrc, float64_t * pDst, uint32_t n)
+{
+  uint32_t i, s;
+  float64_t x, y;
+
+  for (i = 0u; i < n; i++)
+  {
+    x = pSrc[i];
+    for (s = 0u; s < NUM_STAGES; s++)
+    {
+      const float64_t *c = &coeffs_f64[5u * s];
+      float64_t *d = &refState_f64[2u * s];
+
+      y = (c[0] * x) + d[0];
+      d[0] = (c[1] * x) + (c[3] * y) + d[1];
+      d[1] = (c[2] * x) + (c[4] * y);
+      x = y;
+    }
+    pDst[i] = x;
+  }
+}
+
+int main(void)
+{
+  riscv_biquad_cascade_df2T_instance_f64 S;
+  riscv_matrix_instance_f64 MatA = {DIM, DIM, A_f64};
+  riscv_matrix_instance_f64 MatB = {DIM, DIM, B_f64};
+  riscv_matrix_instance_f64 MatInv = {DIM, DIM, Inv_f64};
+  riscv_matrix_instance_f64 MatProd = {DIM, DIM, Prod_f64};
+  riscv_status status;
+  float64_t dot, ref, err;
+  uint32_t i, j, fail = 0u, ok;
+
+  riscv_bench_header();
+
+  for (i = 0u; i < BLOCKSIZE; i++)
+  {
+    src_f64[i] = 1.0 + (0.25 * sin(0.3 * (float64_t) i));
+    vecA_f64[i] = cos(0.1 * (float64_t) i);
+    vecB_f64[i] = 1.0 / (1.0 + (float64_t) i);
+  }
+  for (i = 0u; i < DIM; i++)
+  {
+    for (j = 0u; j < DIM; j++)
+    {
+      /* diagonally dominant, well conditioned */
+      A_f64[(i * DIM) + j] = (i == j) ? 4.0 + (float64_t) i : 1.0 / (1.0 + (float64_t) (i + (2u * j)));
+    }
+  }
+
+  /* Biquad cascade, a 2 Hz lowpass at 48 kHz */
+  lowpass(2.0 / 48000.0, 0.5411961001461969, &coeffs_f64[0]);
+  lowpass(2.0 / 48000.0, 1.3065629648763766, &coeffs_f64[5]);
+  riscv_biquad_cascade_df2T_init_f64(&S, NUM_STAGES, coeffs_f64, state_f64);
+  riscv_biquad_cascade_df2T_f64(&S, src_f64, dst_f64, BLOCKSIZE);
+  ref_biquad(src_f64, ref_f64, BLOCKSIZE);
+  ok = 1u;
+  for (i = 0u; i < BLOCKSIZE; i++)
+  {
+    ok &= (fabs(dst_f64[i] - ref_f64[i]) <= (1e-12 * fabs(ref_f64[i]) + 1e-300));
+  }
+  printf("CHECK riscv_biquad_cascade_df2T_f64 %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  RISCV_BENCH("riscv_biquad_cascade_df2T_f64", "f64", BLOCKSIZE,
+    riscv_biquad_cascade_df2T_f64(&S, src_f64, dst_f64, BLOCKSIZE));
+
+  /* Inverse and product, A * inv(A) = I */
+  for (i = 0u; i < (DIM * DIM); i++)
+  {
+    B_f64[i] = A_f64[i];
+  }
+  status = riscv_mat_inverse_f64(&MatB, &MatInv);
+  riscv_mat_mult_f64(&MatA, &MatInv, &MatProd);
+  ok = (status == RISCV_MATH_SUCCESS);
+  for (i = 0u; i < DIM; i++)
+  {
+    for (j = 0u; j < DIM; j++)
+    {
+      err = Prod_f64[(i * DIM) + j] - ((i == j) ? 1.0 : 0.0);
+      ok &= (fabs(err) < 1e-12);
+    }
+  }
+  printf("CHECK riscv_mat_inverse_f64 riscv_mat_mult_f64 %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* riscv_mat_inverse_f64 reduces its input to the identity, every run copies A first */
+  RISCV_BENCH("riscv_mat_inverse_f64", "f64", DIM * DIM,
+    for (i = 0u; i < (DIM * DIM); i++) B_f64[i] = A_f64[i];
+    status = riscv_mat_inverse_f64(&MatB, &MatInv));
+
+  RISCV_BENCH("riscv_mat_mult_f64", "f64", DIM * DIM,
+    riscv_mat_mult_f64(&MatA, &MatInv, &MatProd));
+
+  /* Dot product, four partial sums against a sequential sum */
+  riscv_dot_prod_f64(vecA_f64, vecB_f64, BLOCKSIZE, &dot);
+  ref = 0.0;
+  for (i = 0u; i < BLOCKSIZE; i++)
+  {
+    ref += vecA_f64[i] * vecB_f64[i];
+  }
+  ok = (fabs(dot - ref) <= 1e-13);
+  printf("CHECK riscv_dot_prod_f64 %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  RISCV_BENCH("riscv_dot_prod_f64", "f64", BLOCKSIZE,
+    riscv_dot_prod_f64(vecA_f64, vecB_f64, BLOCKSIZE, &dot));
+
+#ifdef PRINT_OUTPUT
+  for (i = 0u; i < BLOCKSIZE; i++)
+  {
+    printf("%d ", (int) (dst_f64[i] * 1000000.0));
+  }
+  printf("\n");
+#endif
+
+  return fail;
+}
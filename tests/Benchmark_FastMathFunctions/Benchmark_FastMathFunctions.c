@@ -6,33 +6,16 @@
 #include "string_lib.h"
 #include "bar.h"
 #include "bench.h"
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 //#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
 *Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "FastMathFunctions"
+#include "../common/riscv_bench.h"
 /* ouput variables*/
 float32_t result_f32;  
 q15_t result_q15;
@@ -47,67 +30,80 @@ volatile q31_t test_q31 = 0x48A3617B;
 volatile float32_t test_angle_f32 = 0.9;
 volatile q15_t test_angle_q15 = 0x0FD6;
 volatile q31_t test_angle_q31 = 0x07FFFFFF;
+#define TRIG_BLOCK 64
+float32_t angles_f32[TRIG_BLOCK], trig_f32[TRIG_BLOCK], trig2_f32[TRIG_BLOCK];
+q15_t angles_q15[TRIG_BLOCK], trig_q15[TRIG_BLOCK], trig2_q15[TRIG_BLOCK];
+q31_t angles_q31[TRIG_BLOCK], trig_q31[TRIG_BLOCK], trig2_q31[TRIG_BLOCK];
+riscv_nco_instance_f32 nco_f32;
+riscv_nco_instance_q15 nco_q15;
+riscv_nco_instance_q31 nco_q31;
+uint8_t recip_shift[TRIG_BLOCK];
 int32_t main(void)
 {
+  riscv_bench_header();
 
 /*Tests*/
 /*sqrt*/
   test_f +=2.0;
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_sqrt_f32(test_f,&result_f32);
-  perf_stop();
-  printf("riscv_sqrt_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_sqrt_f32", "f32", 1,
+    riscv_sqrt_f32(test_f,&result_f32));
 #ifdef PRINT_OUTPUT
   printf("%d ",(int)(result_f32*100));  
   printf("\n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_sqrt_q15(test_q15,&result_q15);
-  perf_stop();
-  printf("riscv_sqrt_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_sqrt_q15", "q15", 1,
+    riscv_sqrt_q15(test_q15,&result_q15));
 #ifdef PRINT_OUTPUT
   printf("0x%X ",result_q15);  
   printf("\n");
   printf("Correct answer = 0x305B \n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_sqrt_q31(test_q31,&result_q31);
-  perf_stop();
-  printf("riscv_sqrt_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_sqrt_q31", "q31", 1,
+    riscv_sqrt_q31(test_q31,&result_q31));
 #ifdef PRINT_OUTPUT
   printf("0x%X ",result_q31);  
   printf("\n");
   printf("Correct answer = 0x606CAE24 \n");
 #endif
 
+  for(i = 0; i < TRIG_BLOCK; i++)
+  {
+    angles_f32[i] = 0.1f * i;
+    angles_q15[i] = (q15_t) (i * 0x0200);
+    angles_q31[i] = (q31_t) (i * 0x02000000);
+  }
+
+  RISCV_BENCH("riscv_sqrt_vec_f32", "f32", TRIG_BLOCK,
+    riscv_sqrt_vec_f32(angles_f32, trig_f32, TRIG_BLOCK));
+#ifdef PRINT_OUTPUT
+  printf("%d\n", (int)(trig_f32[40]*100));
+  printf("Correct answer = 200\n");
+#endif
+  RISCV_BENCH("riscv_sqrt_vec_q15", "q15", TRIG_BLOCK,
+    riscv_sqrt_vec_q15(angles_q15, trig_q15, TRIG_BLOCK));
+  RISCV_BENCH("riscv_sqrt_vec_q31", "q31", TRIG_BLOCK,
+    riscv_sqrt_vec_q31(angles_q31, trig_q31, TRIG_BLOCK));
+#ifdef PRINT_OUTPUT
+  printf("0x%X 0x%X\n", trig_q15[5], trig_q31[5]);
+  printf("Correct answer = 0x23C6 0x23C6EF37\n");
+#endif
+
 /*cos*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  result_f32=riscv_cos_f32(test_angle_f32);
-  perf_stop();
-  printf("riscv_cos_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_cos_f32", "f32", 1,
+    result_f32=riscv_cos_f32(test_angle_f32));
 #ifdef PRINT_OUTPUT
   printf("%d ",(int)(result_f32*100));  
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  result_q15=riscv_cos_q15(test_angle_q15);
-  perf_stop();
-  printf("riscv_cos_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_cos_q15", "q15", 1,
+    result_q15=riscv_cos_q15(test_angle_q15));
 #ifdef PRINT_OUTPUT
   printf("0x%X ",result_q15);  
   printf("\n");
   printf("Correct answer = 0x5B3A \n");
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  result_q31=riscv_cos_q31(test_angle_q31);
-  perf_stop();
-  printf("riscv_cos_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_cos_q31", "q31", 1,
+    result_q31=riscv_cos_q31(test_angle_q31));
 #ifdef PRINT_OUTPUT
   printf("0x%X ",result_q31); 
   printf("\n");
@@ -116,35 +112,125 @@ int32_t main(void)
 
 /*sin*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  result_f32=riscv_sin_f32(test_angle_f32);
-  perf_stop();
-  printf("riscv_sin_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_sin_f32", "f32", 1,
+    result_f32=riscv_sin_f32(test_angle_f32));
 #ifdef PRINT_OUTPUT
   printf("%d ",(int)(result_f32*100));  
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  result_q15=riscv_sin_q15(test_angle_q15);
-  perf_stop();
-  printf("riscv_sin_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_sin_q15", "q15", 1,
+    result_q15=riscv_sin_q15(test_angle_q15));
 #ifdef PRINT_OUTPUT
   printf("0x%X ",result_q15); 
   printf("\n");
   printf("Correct answer = 0x59C4 \n"); 
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  result_q31=riscv_sin_q31(test_angle_q31);
-  perf_stop();
-  printf("riscv_sin_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_sin_q31", "q31", 1,
+    result_q31=riscv_sin_q31(test_angle_q31));
 #ifdef PRINT_OUTPUT
   printf("0x%X ",result_q31);  
   printf("\n");
   printf("Correct answer = 0x30FBC546 \n");
 #endif
 
+/*Block sin/cos and NCO*/
+
+  for(i = 0; i < TRIG_BLOCK; i++)
+  {
+    angles_f32[i] = 0.1f * i;
+    angles_q15[i] = (q15_t) (i * 0x0200);
+    angles_q31[i] = (q31_t) (i * 0x02000000);
+  }
+
+  RISCV_BENCH("riscv_sin_vec_f32", "f32", TRIG_BLOCK,
+    riscv_sin_vec_f32(angles_f32, trig_f32, TRIG_BLOCK));
+  RISCV_BENCH("riscv_cos_vec_f32", "f32", TRIG_BLOCK,
+    riscv_cos_vec_f32(angles_f32, trig2_f32, TRIG_BLOCK));
+  RISCV_BENCH("riscv_sin_vec_q15", "q15", TRIG_BLOCK,
+    riscv_sin_vec_q15(angles_q15, trig_q15, TRIG_BLOCK));
+  RISCV_BENCH("riscv_cos_vec_q15", "q15", TRIG_BLOCK,
+    riscv_cos_vec_q15(angles_q15, trig2_q15, TRIG_BLOCK));
+  RISCV_BENCH("riscv_sin_vec_q31", "q31", TRIG_BLOCK,
+    riscv_sin_vec_q31(angles_q31, trig_q31, TRIG_BLOCK));
+  RISCV_BENCH("riscv_cos_vec_q31", "q31", TRIG_BLOCK,
+    riscv_cos_vec_q31(angles_q31, trig2_q31, TRIG_BLOCK));
+#ifdef PRINT_OUTPUT
+  printf("%d %d 0x%X 0x%X 0x%X 0x%X\n", (int)(trig_f32[5]*100), (int)(trig2_f32[5]*100),
+    trig_q15[5], trig2_q15[5], trig_q31[5], trig2_q31[5]);
+  printf("Correct answer = 47 87 0x3C56 0x70E2 0x3C56BA70 0x70E2CBC6\n");
+#endif
+
+  /* 1 kHz at 48 kHz */
+  riscv_nco_init_f32(&nco_f32, 0.0f, 0.1308996939f);
+  riscv_nco_init_q15(&nco_q15, 0, 0x00AAAAAB);
+  riscv_nco_init_q31(&nco_q31, 0, 0x00AAAAAB);
+
+  RISCV_BENCH("riscv_nco_f32", "f32", TRIG_BLOCK,
+    riscv_nco_f32(&nco_f32, trig_f32, trig2_f32, TRIG_BLOCK));
+  RISCV_BENCH("riscv_nco_q15", "q15", TRIG_BLOCK,
+    riscv_nco_q15(&nco_q15, trig_q15, trig2_q15, TRIG_BLOCK));
+  RISCV_BENCH("riscv_nco_q31", "q31", TRIG_BLOCK,
+    riscv_nco_q31(&nco_q31, trig_q31, trig2_q31, TRIG_BLOCK));
+#ifdef PRINT_OUTPUT
+  printf("%d %d 0x%X 0x%X 0x%X 0x%X\n", (int)(trig_f32[1]*1000), (int)(trig2_f32[1]*1000),
+    trig_q15[1], trig2_q15[1], trig_q31[1], trig2_q31[1]);
+  printf("Correct answer = 130 991 0x42F 0x7FEE 0x4301F28 0x7FEDE854\n");
+#endif
+
+/*atan2, exp, log and reciprocal*/
+
+  /* Phase of the NCO outputs */
+  RISCV_BENCH("riscv_atan2_vec_f32", "f32", TRIG_BLOCK,
+    riscv_atan2_vec_f32(trig_f32, trig2_f32, angles_f32, TRIG_BLOCK));
+  RISCV_BENCH("riscv_atan2_vec_q15", "q15", TRIG_BLOCK,
+    riscv_atan2_vec_q15(trig_q15, trig2_q15, angles_q15, TRIG_BLOCK));
+  RISCV_BENCH("riscv_atan2_vec_q31", "q31", TRIG_BLOCK,
+    riscv_atan2_vec_q31(trig_q31, trig2_q31, angles_q31, TRIG_BLOCK));
+#ifdef PRINT_OUTPUT
+  printf("%d 0x%X 0x%X\n", (int)(angles_f32[30]*1000), angles_q15[30], angles_q31[30]);
+  printf("Correct answer = -2356 0x1F6B 0x1F6A7A36\n");
+#endif
+
+  for(i = 0; i < TRIG_BLOCK; i++)
+  {
+    angles_f32[i] = 0.1f * (i + 1);
+    angles_q15[i] = (q15_t) ((i + 1) * 0x0100);
+    angles_q31[i] = (q31_t) ((i + 1) * 0x01000000);
+  }
+
+  RISCV_BENCH("riscv_vlog_f32", "f32", TRIG_BLOCK,
+    riscv_vlog_f32(angles_f32, trig_f32, TRIG_BLOCK));
+  RISCV_BENCH("riscv_vlog_q15", "q15", TRIG_BLOCK,
+    riscv_vlog_q15(angles_q15, trig_q15, TRIG_BLOCK));
+  RISCV_BENCH("riscv_vlog_q31", "q31", TRIG_BLOCK,
+    riscv_vlog_q31(angles_q31, trig_q31, TRIG_BLOCK));
+#ifdef PRINT_OUTPUT
+  printf("%d 0x%X 0x%X\n", (int)(trig_f32[4]*1000), (uint16_t) trig_q15[4], trig_q31[4]);
+  printf("Correct answer = -693 0xE60F 0xF30795DF\n");
+#endif
+
+  /* Back to the inputs of the logarithms */
+  RISCV_BENCH("riscv_vexp_f32", "f32", TRIG_BLOCK,
+    riscv_vexp_f32(trig_f32, trig2_f32, TRIG_BLOCK));
+  RISCV_BENCH("riscv_vexp_q15", "q15", TRIG_BLOCK,
+    riscv_vexp_q15(trig_q15, trig2_q15, TRIG_BLOCK));
+  RISCV_BENCH("riscv_vexp_q31", "q31", TRIG_BLOCK,
+    riscv_vexp_q31(trig_q31, trig2_q31, TRIG_BLOCK));
+#ifdef PRINT_OUTPUT
+  printf("%d 0x%X 0x%X\n", (int)(trig2_f32[4]*1000), trig2_q15[4], trig2_q31[4]);
+  printf("Correct answer = 500 0x500 0x5000000\n");
+#endif
+
+  RISCV_BENCH("riscv_vinverse_f32", "f32", TRIG_BLOCK,
+    riscv_vinverse_f32(angles_f32, trig_f32, TRIG_BLOCK));
+  RISCV_BENCH("riscv_vinverse_q15", "q15", TRIG_BLOCK,
+    riscv_vinverse_q15(angles_q15, trig_q15, recip_shift, TRIG_BLOCK));
+  RISCV_BENCH("riscv_vinverse_q31", "q31", TRIG_BLOCK,
+    riscv_vinverse_q31(angles_q31, trig_q31, recip_shift, TRIG_BLOCK));
+#ifdef PRINT_OUTPUT
+  printf("%d 0x%X 0x%X %d\n", (int)(trig_f32[4]*1000), trig_q15[4], trig_q31[4], recip_shift[4]);
+  printf("Correct answer = 1999 0x6665 0x66666663 5\n");
+#endif
+
 /*More tests*/
 /*
 angle_q15 = 0x7FFF ;
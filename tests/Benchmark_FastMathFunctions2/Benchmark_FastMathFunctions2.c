@@ -0,0 +1,162 @@
+#include <math.h>
+#include <stdio.h>
+#include "riscv_math.h"
+#include "riscv_common_tables.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_POINTS 4096
+#define TWO_PI 6.283185307179586
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The sine of NUM_POINTS phases, spread over one period plus the wrap points, is computed by each
+accuracy tier: the polynomials and 64-interval tables of riscv_common_tables.h in f32 and Q31, and
+riscv_sin_f32/q15/q31 and riscv_cos_f32/q31 of the tier the library was built with.  The largest
+error against the double precision sine must be below the bound documented next to
+FAST_MATH_TABLE_SIZE, and riscv_sin_cos_f32/q31 must agree with the sine and cosine.  The CHECK lines
+must report ok.
+*/
+#define RISCV_BENCH_SUITE "FastMathFunctions2"
+#include "../common/riscv_bench.h"
+
+uint32_t phase[NUM_POINTS];
+float32_t turns_f32[NUM_POINTS], out_f32[NUM_POINTS];
+q31_t out_q31[NUM_POINTS];
+q15_t out_q15[NUM_POINTS];
+
+static double ref(uint32_t n)
+{
+  return sin(TWO_PI * (double) phase[n] / 4294967296.0);
+}
+
+static double err_f32(void)
+{
+  double e, m = 0.0;
+  uint32_t n;
+
+  for (n = 0; n < NUM_POINTS; n++)
+  {
+    e = fabs(out_f32[n] - ref(n));
+    m = (e > m) ? e : m;
+  }
+  return (m);
+}
+
+static double err_q31(void)
+{
+  double e, m = 0.0;
+  uint32_t n;
+
+  for (n = 0; n < NUM_POINTS; n++)
+  {
+    e = fabs(out_q31[n] / 2147483648.0 - ref(n));
+    m = (e > m) ? e : m;
+  }
+  return (m);
+}
+
+static int32_t report(const char *name, double err, double bound)
+{
+  int32_t ok = (err < bound);
+
+  printf("CHECK %s: error %d (1e-9), bound %d %s\n", name, (int) (err * 1e9), (int) (bound * 1e9), ok ? "ok" : "bad");
+  return (!ok);
+}
+
+int main(void)
+{
+  uint32_t seed = 5u, n;
+  int32_t fail = 0;
+  float32_t s_f32, c_f32;
+  q31_t s_q31, c_q31;
+  double e, m;
+
+  riscv_bench_header();
+
+  /* Random phases, the quarter points and their neighbours */
+  for (n = 0; n < NUM_POINTS; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    phase[n] = (n < 16) ? ((n >> 2) * 0x40000000u + (n & 3u) - 1u) : (seed & 0xFFFFFF80u);
+    turns_f32[n] = phase[n] / 4294967296.0f;
+  }
+
+  RISCV_BENCH("riscv_sin_poly_f32", "f32", NUM_POINTS,
+    for (n = 0; n < NUM_POINTS; n++) out_f32[n] = riscv_sin_poly_f32(turns_f32[n]));
+  fail |= report("riscv_sin_poly_f32", err_f32(), 1e-6);
+  RISCV_BENCH("riscv_sin_table64_f32", "f32", NUM_POINTS,
+    for (n = 0; n < NUM_POINTS; n++) out_f32[n] = riscv_sin_table64_f32(turns_f32[n]));
+  fail |= report("riscv_sin_table64_f32", err_f32(), 1.2e-6);
+  RISCV_BENCH("riscv_sin_poly_q31", "q31", NUM_POINTS,
+    for (n = 0; n < NUM_POINTS; n++) out_q31[n] = riscv_sin_poly_q31(phase[n]));
+  fail |= report("riscv_sin_poly_q31", err_q31(), 1e-8);
+  RISCV_BENCH("riscv_sin_table64_q31", "q31", NUM_POINTS,
+    for (n = 0; n < NUM_POINTS; n++) out_q31[n] = riscv_sin_table64_q31(phase[n]));
+  fail |= report("riscv_sin_table64_q31", err_q31(), 1e-6);
+
+  /* The functions of the tier the library was built with, positive phases in [0 1) */
+  RISCV_BENCH("riscv_sin_f32", "f32", NUM_POINTS,
+    for (n = 0; n < NUM_POINTS; n++) out_f32[n] = riscv_sin_f32((float32_t) (TWO_PI * (phase[n] >> 1) / 2147483648.0)));
+  RISCV_BENCH("riscv_sin_q31", "q31", NUM_POINTS,
+    for (n = 0; n < NUM_POINTS; n++) out_q31[n] = riscv_sin_q31((q31_t) (phase[n] >> 1)));
+  RISCV_BENCH("riscv_sin_q15", "q15", NUM_POINTS,
+    for (n = 0; n < NUM_POINTS; n++) out_q15[n] = riscv_sin_q15((q15_t) (phase[n] >> 17)));
+
+  for (n = 0; n < NUM_POINTS; n++)
+  {
+    phase[n] &= 0xFFFFFFFEu;
+  }
+  fail |= report("riscv_sin_f32", err_f32(), 3e-5);
+  fail |= report("riscv_sin_q31", err_q31(), 3e-5);
+
+  m = 0.0;
+  for (n = 0; n < NUM_POINTS; n++)
+  {
+    e = fabs(out_q15[n] / 32768.0 - sin(TWO_PI * (phase[n] >> 17) / 32768.0));
+    m = (e > m) ? e : m;
+  }
+#if defined (RISCV_MATH_SIN_COS_POLY) || defined (RISCV_MATH_SIN_COS_TABLE64)
+  /* Half an LSB and the saturation of +1 to 0x7FFF */
+  fail |= report("riscv_sin_q15", m, 4e-5);
+#else
+  /* The 512-entry Q15 table truncates the interpolation */
+  fail |= report("riscv_sin_q15", m, 2e-4);
+#endif
+
+  /* Cosine and the controller sine/cosine against the sine */
+  m = 0.0;
+  for (n = 0; n < NUM_POINTS; n++)
+  {
+    c_q31 = riscv_cos_q31((q31_t) (phase[n] >> 1));
+    e = fabs(c_q31 / 2147483648.0 - cos(TWO_PI * (phase[n] >> 1) / 2147483648.0));
+    m = (e > m) ? e : m;
+    c_f32 = riscv_cos_f32((float32_t) (TWO_PI * (phase[n] >> 1) / 2147483648.0));
+    e = fabs(c_f32 - cos(TWO_PI * (phase[n] >> 1) / 2147483648.0));
+    m = (e > m) ? e : m;
+  }
+  fail |= report("riscv_cos_f32/q31", m, 3e-5);
+
+  m = 0.0;
+  for (n = 0; n < NUM_POINTS; n++)
+  {
+    riscv_sin_cos_q31((q31_t) phase[n], &s_q31, &c_q31);
+    e = fabs(s_q31 / 2147483648.0 - sin(TWO_PI * (q31_t) phase[n] / 4294967296.0));
+    m = (e > m) ? e : m;
+    e = fabs(c_q31 / 2147483648.0 - cos(TWO_PI * (q31_t) phase[n] / 4294967296.0));
+    m = (e > m) ? e : m;
+    riscv_sin_cos_f32((float32_t) ((q31_t) phase[n] / 2147483648.0 * 180.0), &s_f32, &c_f32);
+    e = fabs(s_f32 - sin(TWO_PI * (q31_t) phase[n] / 4294967296.0));
+    m = (e > m) ? e : m;
+    e = fabs(c_f32 - cos(TWO_PI * (q31_t) phase[n] / 4294967296.0));
+    m = (e > m) ? e : m;
+  }
+  fail |= report("riscv_sin_cos_f32/q31", m, 3e-5);
+
+  return (fail);
+}
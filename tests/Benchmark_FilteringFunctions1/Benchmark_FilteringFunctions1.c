@@ -7,7 +7,6 @@
 #include "bar.h"
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 
 #define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(100*X[i])); \
 printf("\n\n")
@@ -18,29 +17,14 @@ printf("\n\n")
 #define NUM_STAGES 1
 #define CONV_BLOCKSIZE   ((2*MAX_BLOCKSIZE) - 1)
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
-*Also the correct results are printed for the current vectors which are calculated from the orignal library 
+*Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "FilteringFunctions1"
+#include "../common/riscv_bench.h"
  float32_t srcA_buf_f32[MAX_BLOCKSIZE] =
 {
   -0.4325648115282207,  -1.6655843782380970,  0.1253323064748307,
@@ -214,6 +198,7 @@ riscv_biquad_cascade_stereo_df2T_instance_f32 Sdf2stereo_f32;
 int i = 0 ;
 int32_t main(void)
 {
+  riscv_bench_header();
 
  /*Init*/ 
 /*biquad df1 inits*/
@@ -228,56 +213,38 @@ int32_t main(void)
 /*Tests*/
 /*biquad df1*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_biquad_cas_df1_32x64_q31( &S32x64_q31 ,srcA_buf_q31,result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_biquad_cas_df1_32x64_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_biquad_cas_df1_32x64_q31", "q31", MAX_BLOCKSIZE,
+    riscv_biquad_cas_df1_32x64_q31( &S32x64_q31 ,srcA_buf_q31,result_q31, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_biquad_cascade_df1_f32(&Sdf1_f32,srcA_buf_f32,result_f32,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_biquad_cascade_df1_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_biquad_cascade_df1_f32", "f32", MAX_BLOCKSIZE,
+    riscv_biquad_cascade_df1_f32(&Sdf1_f32,srcA_buf_f32,result_f32,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_biquad_cascade_df1_q15(&Sdf1_q15,srcA_buf_q15,result_q15,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_biquad_cascade_df1_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_biquad_cascade_df1_q15", "q15", MAX_BLOCKSIZE,
+    riscv_biquad_cascade_df1_q15(&Sdf1_q15,srcA_buf_q15,result_q15,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_biquad_cascade_df1_q31(&Sdf1_q31,srcA_buf_q31,result_q31,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_biquad_cascade_df1_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_biquad_cascade_df1_q31", "q31", MAX_BLOCKSIZE,
+    riscv_biquad_cascade_df1_q31(&Sdf1_q31,srcA_buf_q31,result_q31,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
 	
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_biquad_cascade_df1_fast_q15(&Sdf1_q15,srcA_buf_q15,result_q15,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_biquad_cascade_df1_fast_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_biquad_cascade_df1_fast_q15", "q15", MAX_BLOCKSIZE,
+    riscv_biquad_cascade_df1_fast_q15(&Sdf1_q15,srcA_buf_q15,result_q15,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif 
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_biquad_cascade_df1_fast_q31(&Sdf1_q31,srcA_buf_q31,result_q31,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_biquad_cascade_df1_fast_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_biquad_cascade_df1_fast_q31", "q31", MAX_BLOCKSIZE,
+    riscv_biquad_cascade_df1_fast_q31(&Sdf1_q31,srcA_buf_q31,result_q31,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
@@ -286,27 +253,18 @@ int32_t main(void)
 
 /*biquad df2*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_biquad_cascade_df2T_f32(&Sdf2_f32,srcA_buf_f32,result_f32,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_biquad_cascade_df2T_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_biquad_cascade_df2T_f32", "f32", MAX_BLOCKSIZE,
+    riscv_biquad_cascade_df2T_f32(&Sdf2_f32,srcA_buf_f32,result_f32,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_biquad_cascade_df2T_f64(&Sdf2_f64,srcA_buf_f64,result_f64,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_biquad_cascade_df2T_f64: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_biquad_cascade_df2T_f64", "f64", MAX_BLOCKSIZE,
+    riscv_biquad_cascade_df2T_f64(&Sdf2_f64,srcA_buf_f64,result_f64,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f64,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_biquad_cascade_stereo_df2T_f32(&Sdf2stereo_f32,srcA_buf_f32,result_f32,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_biquad_cascade_stereo_df2T_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_biquad_cascade_stereo_df2T_f32", "f32", MAX_BLOCKSIZE,
+    riscv_biquad_cascade_stereo_df2T_f32(&Sdf2stereo_f32,srcA_buf_f32,result_f32,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
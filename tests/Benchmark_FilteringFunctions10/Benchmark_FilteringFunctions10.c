@@ -0,0 +1,156 @@
+#include <math.h>
+#include <stdio.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(100*X[i])); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define L_FACTOR 3
+#define M_FACTOR 4
+#define NUM_TAPS 48
+#define DEC_TAPS 4
+#define BLOCK_SIZE 64
+#define UP_SIZE (BLOCK_SIZE * L_FACTOR)
+#define OUT_SIZE (UP_SIZE / M_FACTOR)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A 16 kHz to 12 kHz conversion (L_FACTOR/M_FACTOR) of BLOCK_SIZE samples with a NUM_TAPS prototype filter.
+riscv_fir_resample_q15/q31/f32 are compared with riscv_fir_interpolate followed by riscv_fir_decimate with
+DEC_TAPS taps.  The size column is the number of input samples.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions10"
+#include "../common/riscv_bench.h"
+
+float32_t coeffs_f32[NUM_TAPS];
+float32_t phaseCoeffs_f32[NUM_TAPS];
+float32_t decCoeffs_f32[DEC_TAPS];
+float32_t testInput_f32[BLOCK_SIZE];
+float32_t upOutput_f32[UP_SIZE];
+float32_t testOutput_f32[OUT_SIZE];
+float32_t interpState_f32[NUM_TAPS / L_FACTOR + BLOCK_SIZE - 1];
+float32_t decState_f32[DEC_TAPS + UP_SIZE - 1];
+float32_t resampleState_f32[NUM_TAPS / L_FACTOR + BLOCK_SIZE - 1];
+
+q31_t coeffs_q31[NUM_TAPS];
+q31_t phaseCoeffs_q31[NUM_TAPS];
+q31_t decCoeffs_q31[DEC_TAPS];
+q31_t testInput_q31[BLOCK_SIZE];
+q31_t upOutput_q31[UP_SIZE];
+q31_t testOutput_q31[OUT_SIZE];
+q31_t interpState_q31[NUM_TAPS / L_FACTOR + BLOCK_SIZE - 1];
+q31_t decState_q31[DEC_TAPS + UP_SIZE - 1];
+q31_t resampleState_q31[NUM_TAPS / L_FACTOR + BLOCK_SIZE - 1];
+
+q15_t coeffs_q15[NUM_TAPS];
+q15_t phaseCoeffs_q15[NUM_TAPS];
+q15_t decCoeffs_q15[DEC_TAPS];
+q15_t testInput_q15[BLOCK_SIZE];
+q15_t upOutput_q15[UP_SIZE];
+q15_t testOutput_q15[OUT_SIZE];
+q15_t interpState_q15[NUM_TAPS / L_FACTOR + BLOCK_SIZE - 1];
+q15_t decState_q15[DEC_TAPS + UP_SIZE - 1];
+q15_t resampleState_q15[NUM_TAPS / L_FACTOR + BLOCK_SIZE - 1];
+
+riscv_fir_interpolate_instance_f32 S_interp_f32;
+riscv_fir_decimate_instance_f32 S_dec_f32;
+riscv_fir_resample_instance_f32 S_resample_f32;
+riscv_fir_interpolate_instance_q31 S_interp_q31;
+riscv_fir_decimate_instance_q31 S_dec_q31;
+riscv_fir_resample_instance_q31 S_resample_q31;
+riscv_fir_interpolate_instance_q15 S_interp_q15;
+riscv_fir_decimate_instance_q15 S_dec_q15;
+riscv_fir_resample_instance_q15 S_resample_q15;
+
+int32_t main(void)
+{
+  uint32_t i;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    coeffs_f32[i] = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / 8.0f;
+    coeffs_q31[i] = (q31_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 13;
+    coeffs_q15[i] = (q15_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) >> 3);
+  }
+
+  for (i = 0; i < DEC_TAPS; i++)
+  {
+    decCoeffs_f32[i] = 0.25f;
+    decCoeffs_q31[i] = 0x20000000;
+    decCoeffs_q15[i] = 0x2000;
+  }
+
+  for (i = 0; i < BLOCK_SIZE; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    testInput_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    testInput_q31[i] = (q31_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 16;
+    testInput_q15[i] = (q15_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 1);
+  }
+
+/*Tests*/
+  riscv_fir_interpolate_init_q15(&S_interp_q15, L_FACTOR, NUM_TAPS, coeffs_q15, interpState_q15, BLOCK_SIZE);
+  riscv_fir_decimate_init_q15(&S_dec_q15, DEC_TAPS, M_FACTOR, decCoeffs_q15, decState_q15, UP_SIZE);
+  RISCV_BENCH("riscv_fir_interpolate_decimate_q15", "q15", BLOCK_SIZE,
+    riscv_fir_interpolate_q15(&S_interp_q15, testInput_q15, upOutput_q15, BLOCK_SIZE);
+    riscv_fir_decimate_q15(&S_dec_q15, upOutput_q15, testOutput_q15, UP_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,OUT_SIZE);
+#endif
+
+  riscv_fir_resample_init_q15(&S_resample_q15, L_FACTOR, M_FACTOR, NUM_TAPS, coeffs_q15, phaseCoeffs_q15, resampleState_q15, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_resample_q15", "q15", BLOCK_SIZE,
+    riscv_fir_resample_q15(&S_resample_q15, testInput_q15, testOutput_q15, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,OUT_SIZE);
+#endif
+
+  riscv_fir_interpolate_init_q31(&S_interp_q31, L_FACTOR, NUM_TAPS, coeffs_q31, interpState_q31, BLOCK_SIZE);
+  riscv_fir_decimate_init_q31(&S_dec_q31, DEC_TAPS, M_FACTOR, decCoeffs_q31, decState_q31, UP_SIZE);
+  RISCV_BENCH("riscv_fir_interpolate_decimate_q31", "q31", BLOCK_SIZE,
+    riscv_fir_interpolate_q31(&S_interp_q31, testInput_q31, upOutput_q31, BLOCK_SIZE);
+    riscv_fir_decimate_q31(&S_dec_q31, upOutput_q31, testOutput_q31, UP_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q31,OUT_SIZE);
+#endif
+
+  riscv_fir_resample_init_q31(&S_resample_q31, L_FACTOR, M_FACTOR, NUM_TAPS, coeffs_q31, phaseCoeffs_q31, resampleState_q31, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_resample_q31", "q31", BLOCK_SIZE,
+    riscv_fir_resample_q31(&S_resample_q31, testInput_q31, testOutput_q31, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q31,OUT_SIZE);
+#endif
+
+  riscv_fir_interpolate_init_f32(&S_interp_f32, L_FACTOR, NUM_TAPS, coeffs_f32, interpState_f32, BLOCK_SIZE);
+  riscv_fir_decimate_init_f32(&S_dec_f32, DEC_TAPS, M_FACTOR, decCoeffs_f32, decState_f32, UP_SIZE);
+  RISCV_BENCH("riscv_fir_interpolate_decimate_f32", "f32", BLOCK_SIZE,
+    riscv_fir_interpolate_f32(&S_interp_f32, testInput_f32, upOutput_f32, BLOCK_SIZE);
+    riscv_fir_decimate_f32(&S_dec_f32, upOutput_f32, testOutput_f32, UP_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,OUT_SIZE);
+#endif
+
+  riscv_fir_resample_init_f32(&S_resample_f32, L_FACTOR, M_FACTOR, NUM_TAPS, coeffs_f32, phaseCoeffs_f32, resampleState_f32, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_resample_f32", "f32", BLOCK_SIZE,
+    riscv_fir_resample_f32(&S_resample_f32, testInput_f32, testOutput_f32, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,OUT_SIZE);
+#endif
+
+  printf("End\n");
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+#include <math.h>
+#include <stdio.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(100*X[i])); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_TAPS 256
+#define BLOCK_SIZE 16
+#define STATE_SIZE (NUM_TAPS + BLOCK_SIZE - 1)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_fir_q15/q31/f32 and riscv_fir_circ_q15/q31/f32 filter BLOCK_SIZE samples with NUM_TAPS taps, the
+low latency case where moving the numTaps-1 state samples after every block is as expensive as the filter.
+The size column is the number of taps.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions11"
+#include "../common/riscv_bench.h"
+
+float32_t coeffs_f32[NUM_TAPS];
+float32_t testInput_f32[BLOCK_SIZE];
+float32_t testOutput_f32[BLOCK_SIZE];
+float32_t firState_f32[STATE_SIZE];
+float32_t circState_f32[2 * STATE_SIZE];
+
+q31_t coeffs_q31[NUM_TAPS];
+q31_t testInput_q31[BLOCK_SIZE];
+q31_t testOutput_q31[BLOCK_SIZE];
+q31_t firState_q31[STATE_SIZE];
+q31_t circState_q31[2 * STATE_SIZE];
+
+q15_t coeffs_q15[NUM_TAPS];
+q15_t testInput_q15[BLOCK_SIZE];
+q15_t testOutput_q15[BLOCK_SIZE];
+q15_t firState_q15[STATE_SIZE];
+q15_t circState_q15[2 * STATE_SIZE];
+
+riscv_fir_instance_f32 S_fir_f32;
+riscv_fir_instance_q31 S_fir_q31;
+riscv_fir_instance_q15 S_fir_q15;
+riscv_fir_circ_instance_f32 S_circ_f32;
+riscv_fir_circ_instance_q31 S_circ_q31;
+riscv_fir_circ_instance_q15 S_circ_q15;
+
+int32_t main(void)
+{
+  uint32_t i;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    coeffs_f32[i] = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / 64.0f;
+    coeffs_q31[i] = (q31_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 10;
+    coeffs_q15[i] = (q15_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) >> 5);
+  }
+
+  for (i = 0; i < BLOCK_SIZE; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    testInput_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    testInput_q31[i] = (q31_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 16;
+    testInput_q15[i] = (q15_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 1);
+  }
+
+/*Tests*/
+  riscv_fir_init_q15(&S_fir_q15, NUM_TAPS, coeffs_q15, firState_q15, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_q15", "q15", NUM_TAPS,
+    riscv_fir_q15(&S_fir_q15, testInput_q15, testOutput_q15, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,BLOCK_SIZE);
+#endif
+
+  riscv_fir_circ_init_q15(&S_circ_q15, NUM_TAPS, coeffs_q15, circState_q15, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_circ_q15", "q15", NUM_TAPS,
+    riscv_fir_circ_q15(&S_circ_q15, testInput_q15, testOutput_q15, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,BLOCK_SIZE);
+#endif
+
+  riscv_fir_init_q31(&S_fir_q31, NUM_TAPS, coeffs_q31, firState_q31, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_q31", "q31", NUM_TAPS,
+    riscv_fir_q31(&S_fir_q31, testInput_q31, testOutput_q31, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q31,BLOCK_SIZE);
+#endif
+
+  riscv_fir_circ_init_q31(&S_circ_q31, NUM_TAPS, coeffs_q31, circState_q31, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_circ_q31", "q31", NUM_TAPS,
+    riscv_fir_circ_q31(&S_circ_q31, testInput_q31, testOutput_q31, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q31,BLOCK_SIZE);
+#endif
+
+  riscv_fir_init_f32(&S_fir_f32, NUM_TAPS, coeffs_f32, firState_f32, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_f32", "f32", NUM_TAPS,
+    riscv_fir_f32(&S_fir_f32, testInput_f32, testOutput_f32, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,BLOCK_SIZE);
+#endif
+
+  riscv_fir_circ_init_f32(&S_circ_f32, NUM_TAPS, coeffs_f32, circState_f32, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_circ_f32", "f32", NUM_TAPS,
+    riscv_fir_circ_f32(&S_circ_f32, testInput_f32, testOutput_f32, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,BLOCK_SIZE);
+#endif
+
+  printf("End\n");
+
+  return 0;
+}
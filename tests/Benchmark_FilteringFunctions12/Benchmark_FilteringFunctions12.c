@@ -0,0 +1,123 @@
+#include <math.h>
+#include <stdio.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(100*X[i])); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_CHANNELS 8
+#define NUM_STAGES 4
+#define BLOCK_SIZE 32
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_biquad_cascade_multichan_df2T_f32/q31 filter BLOCK_SIZE frames of NUM_CHANNELS interleaved samples
+with one set of NUM_STAGES stages, they are compared with NUM_CHANNELS calls of riscv_biquad_cascade_df2T_f32
+and riscv_biquad_cascade_df1_q31 on contiguous blocks, one instance per channel.
+The size column is the number of channels.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions12"
+#include "../common/riscv_bench.h"
+
+/* b0, b1, b2, a1, a2 of every stage, the q31 set is scaled by 1/2 for postShift = 1 and used by both DF1 and DF2T */
+float32_t coeffs_f32[5 * NUM_STAGES];
+q31_t coeffs_q31[5 * NUM_STAGES];
+
+float32_t testInput_f32[NUM_CHANNELS * BLOCK_SIZE];
+float32_t testOutput_f32[NUM_CHANNELS * BLOCK_SIZE];
+float32_t monoState_f32[NUM_CHANNELS * 2 * NUM_STAGES];
+float32_t mcState_f32[NUM_CHANNELS * 2 * NUM_STAGES];
+
+q31_t testInput_q31[NUM_CHANNELS * BLOCK_SIZE];
+q31_t testOutput_q31[NUM_CHANNELS * BLOCK_SIZE];
+q31_t monoState_q31[NUM_CHANNELS * 4 * NUM_STAGES];
+q63_t mcState_q31[NUM_CHANNELS * 2 * NUM_STAGES];
+
+riscv_biquad_cascade_df2T_instance_f32 S_mono_f32[NUM_CHANNELS];
+riscv_biquad_casd_df1_inst_q31 S_mono_q31[NUM_CHANNELS];
+riscv_biquad_cascade_multichan_df2T_instance_f32 S_mc_f32;
+riscv_biquad_cascade_multichan_df2T_instance_q31 S_mc_q31;
+
+int32_t main(void)
+{
+  uint32_t i, c;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (i = 0; i < NUM_STAGES; i++)
+  {
+    coeffs_f32[5 * i] = 0.2f;
+    coeffs_f32[5 * i + 1] = 0.4f;
+    coeffs_f32[5 * i + 2] = 0.2f;
+    coeffs_f32[5 * i + 3] = 0.5f;
+    coeffs_f32[5 * i + 4] = -0.25f;
+
+    coeffs_q31[5 * i] = 0x0CCCCCCD;
+    coeffs_q31[5 * i + 1] = 0x1999999A;
+    coeffs_q31[5 * i + 2] = 0x0CCCCCCD;
+    coeffs_q31[5 * i + 3] = 0x20000000;
+    coeffs_q31[5 * i + 4] = -0x10000000;
+  }
+
+  for (i = 0; i < NUM_CHANNELS * BLOCK_SIZE; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    testInput_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    testInput_q31[i] = (q31_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 14;
+  }
+
+/*Tests*/
+  for (c = 0; c < NUM_CHANNELS; c++)
+  {
+    riscv_biquad_cascade_df2T_init_f32(&S_mono_f32[c], NUM_STAGES, coeffs_f32, &monoState_f32[c * 2 * NUM_STAGES]);
+  }
+  RISCV_BENCH("riscv_biquad_cascade_df2T_f32", "f32", NUM_CHANNELS,
+    for (c = 0; c < NUM_CHANNELS; c++)
+    {
+      riscv_biquad_cascade_df2T_f32(&S_mono_f32[c], &testInput_f32[c * BLOCK_SIZE], &testOutput_f32[c * BLOCK_SIZE], BLOCK_SIZE);
+    });
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,NUM_CHANNELS * BLOCK_SIZE);
+#endif
+
+  riscv_biquad_cascade_multichan_df2T_init_f32(&S_mc_f32, NUM_STAGES, NUM_CHANNELS, coeffs_f32, mcState_f32);
+  RISCV_BENCH("riscv_biquad_cascade_multichan_df2T_f32", "f32", NUM_CHANNELS,
+    riscv_biquad_cascade_multichan_df2T_f32(&S_mc_f32, testInput_f32, testOutput_f32, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,NUM_CHANNELS * BLOCK_SIZE);
+#endif
+
+  for (c = 0; c < NUM_CHANNELS; c++)
+  {
+    riscv_biquad_cascade_df1_init_q31(&S_mono_q31[c], NUM_STAGES, coeffs_q31, &monoState_q31[c * 4 * NUM_STAGES], 1);
+  }
+  RISCV_BENCH("riscv_biquad_cascade_df1_q31", "q31", NUM_CHANNELS,
+    for (c = 0; c < NUM_CHANNELS; c++)
+    {
+      riscv_biquad_cascade_df1_q31(&S_mono_q31[c], &testInput_q31[c * BLOCK_SIZE], &testOutput_q31[c * BLOCK_SIZE], BLOCK_SIZE);
+    });
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q31,NUM_CHANNELS * BLOCK_SIZE);
+#endif
+
+  riscv_biquad_cascade_multichan_df2T_init_q31(&S_mc_q31, NUM_STAGES, NUM_CHANNELS, coeffs_q31, mcState_q31, 1);
+  RISCV_BENCH("riscv_biquad_cascade_multichan_df2T_q31", "q31", NUM_CHANNELS,
+    riscv_biquad_cascade_multichan_df2T_q31(&S_mc_q31, testInput_q31, testOutput_q31, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q31,NUM_CHANNELS * BLOCK_SIZE);
+#endif
+
+  printf("End\n");
+
+  return 0;
+}
@@ -0,0 +1,119 @@
+#include <math.h>
+#include <stdio.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(100*X[i])); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_TAPS 64
+#define BLOCK_SIZE 64
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_lms_block_q15 and riscv_lms_norm_block_q15 update the coefficients once per block of BLOCK_SIZE samples,
+they are compared with riscv_lms_q15 and riscv_lms_norm_q15 that update them after every sample.
+riscv_lms_fdaf_f32 is the frequency-domain filter of NUM_TAPS taps, compared with riscv_lms_f32.
+The size column is the number of taps.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions13"
+#include "../common/riscv_bench.h"
+
+float32_t testInput_f32[BLOCK_SIZE];
+float32_t testRef_f32[BLOCK_SIZE];
+float32_t testOutput_f32[BLOCK_SIZE];
+float32_t testErr_f32[BLOCK_SIZE];
+float32_t coeffs_f32[NUM_TAPS];
+float32_t lmsState_f32[NUM_TAPS + BLOCK_SIZE - 1];
+float32_t fdafState_f32[11 * NUM_TAPS + 1];
+
+q15_t testInput_q15[BLOCK_SIZE];
+q15_t testRef_q15[BLOCK_SIZE];
+q15_t testOutput_q15[BLOCK_SIZE];
+q15_t testErr_q15[BLOCK_SIZE];
+q15_t coeffs_q15[NUM_TAPS];
+q15_t lmsState_q15[NUM_TAPS + BLOCK_SIZE - 1];
+
+riscv_lms_instance_f32 S_lms_f32;
+riscv_lms_fdaf_instance_f32 S_fdaf_f32;
+riscv_lms_instance_q15 S_lms_q15;
+riscv_lms_norm_instance_q15 S_norm_q15;
+
+int32_t main(void)
+{
+  uint32_t i;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (i = 0; i < BLOCK_SIZE; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    testInput_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 32768.0f - 0.5f;
+    testInput_q15[i] = (q15_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000);
+    seed = seed * 1103515245u + 12345u;
+    testRef_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 32768.0f - 0.5f;
+    testRef_q15[i] = (q15_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000);
+  }
+
+/*Tests*/
+  riscv_fill_q15(0, coeffs_q15, NUM_TAPS);
+  riscv_lms_init_q15(&S_lms_q15, NUM_TAPS, coeffs_q15, lmsState_q15, 0x100, BLOCK_SIZE, 0);
+  RISCV_BENCH("riscv_lms_q15", "q15", NUM_TAPS,
+    riscv_lms_q15(&S_lms_q15, testInput_q15, testRef_q15, testOutput_q15, testErr_q15, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testErr_q15,BLOCK_SIZE);
+#endif
+
+  riscv_fill_q15(0, coeffs_q15, NUM_TAPS);
+  riscv_lms_init_q15(&S_lms_q15, NUM_TAPS, coeffs_q15, lmsState_q15, 0x100, BLOCK_SIZE, 0);
+  RISCV_BENCH("riscv_lms_block_q15", "q15", NUM_TAPS,
+    riscv_lms_block_q15(&S_lms_q15, testInput_q15, testRef_q15, testOutput_q15, testErr_q15, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testErr_q15,BLOCK_SIZE);
+#endif
+
+  riscv_fill_q15(0, coeffs_q15, NUM_TAPS);
+  riscv_lms_norm_init_q15(&S_norm_q15, NUM_TAPS, coeffs_q15, lmsState_q15, 0x1000, BLOCK_SIZE, 0);
+  RISCV_BENCH("riscv_lms_norm_q15", "q15", NUM_TAPS,
+    riscv_lms_norm_q15(&S_norm_q15, testInput_q15, testRef_q15, testOutput_q15, testErr_q15, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testErr_q15,BLOCK_SIZE);
+#endif
+
+  riscv_fill_q15(0, coeffs_q15, NUM_TAPS);
+  riscv_lms_norm_init_q15(&S_norm_q15, NUM_TAPS, coeffs_q15, lmsState_q15, 0x1000, BLOCK_SIZE, 0);
+  RISCV_BENCH("riscv_lms_norm_block_q15", "q15", NUM_TAPS,
+    riscv_lms_norm_block_q15(&S_norm_q15, testInput_q15, testRef_q15, testOutput_q15, testErr_q15, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testErr_q15,BLOCK_SIZE);
+#endif
+
+  riscv_fill_f32(0.0f, coeffs_f32, NUM_TAPS);
+  riscv_lms_init_f32(&S_lms_f32, NUM_TAPS, coeffs_f32, lmsState_f32, 0.01f, BLOCK_SIZE);
+  RISCV_BENCH("riscv_lms_f32", "f32", NUM_TAPS,
+    riscv_lms_f32(&S_lms_f32, testInput_f32, testRef_f32, testOutput_f32, testErr_f32, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testErr_f32,BLOCK_SIZE);
+#endif
+
+  riscv_fill_f32(0.0f, coeffs_f32, NUM_TAPS);
+  riscv_lms_fdaf_init_f32(&S_fdaf_f32, NUM_TAPS, coeffs_f32, fdafState_f32, 0.1f);
+  RISCV_BENCH("riscv_lms_fdaf_f32", "f32", NUM_TAPS,
+    riscv_lms_fdaf_f32(&S_fdaf_f32, testInput_f32, testRef_f32, testOutput_f32, testErr_f32, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testErr_f32,BLOCK_SIZE);
+#endif
+
+  printf("End\n");
+
+  return 0;
+}
@@ -0,0 +1,98 @@
+#include <math.h>
+#include <stdio.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(100*X[i])); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define MAX_LEN_A 256
+#define MAX_LEN_B 128
+#define MAX_FFT_LEN 512
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_correlate_fft_f32/q31 are compared with riscv_correlate_f32/q31 for srcALen x srcBLen of 16x16, 64x32,
+128x128 and 256x128, the size column is srcALen.  The FFT functions take the direct path when
+riscv_correlate_fft_length() returns 0, "fftLen" lines print the choice.  The sizes where the direct
+path wins are used to tune RISCV_CORRELATE_FFT_RATIO.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions14"
+#include "../common/riscv_bench.h"
+
+float32_t srcA_f32[MAX_LEN_A];
+float32_t srcB_f32[MAX_LEN_B];
+float32_t result_f32[2 * MAX_LEN_A - 1];
+q31_t srcA_q31[MAX_LEN_A];
+q31_t srcB_q31[MAX_LEN_B];
+q31_t result_q31[2 * MAX_LEN_A - 1];
+float32_t scratch_f32[3 * MAX_FFT_LEN];
+
+uint32_t lenA[4] = {16, 64, 128, 256};
+uint32_t lenB[4] = {16, 32, 128, 128};
+
+int32_t main(void)
+{
+  uint32_t i, t, a, b;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (i = 0; i < MAX_LEN_A; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    srcA_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    srcA_q31[i] = (q31_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 12;
+  }
+
+  for (i = 0; i < MAX_LEN_B; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    srcB_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    srcB_q31[i] = (q31_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 12;
+  }
+
+/*Tests*/
+  for (t = 0; t < 4; t++)
+  {
+    a = lenA[t];
+    b = lenB[t];
+    printf("fftLen %d x %d: %d\n", (int) a, (int) b, (int) riscv_correlate_fft_length(a, b));
+
+    RISCV_BENCH("riscv_correlate_f32", "f32", a,
+      riscv_correlate_f32(srcA_f32, a, srcB_f32, b, result_f32));
+#ifdef PRINT_OUTPUT
+    PRINT_F32(result_f32,2 * a - 1);
+#endif
+
+    RISCV_BENCH("riscv_correlate_fft_f32", "f32", a,
+      riscv_correlate_fft_f32(srcA_f32, a, srcB_f32, b, result_f32, scratch_f32));
+#ifdef PRINT_OUTPUT
+    PRINT_F32(result_f32,2 * a - 1);
+#endif
+
+    RISCV_BENCH("riscv_correlate_q31", "q31", a,
+      riscv_correlate_q31(srcA_q31, a, srcB_q31, b, result_q31));
+#ifdef PRINT_OUTPUT
+    PRINT_Q(result_q31,2 * a - 1);
+#endif
+
+    RISCV_BENCH("riscv_correlate_fft_q31", "q31", a,
+      riscv_correlate_fft_q31(srcA_q31, a, srcB_q31, b, result_q31, scratch_f32));
+#ifdef PRINT_OUTPUT
+    PRINT_Q(result_q31,2 * a - 1);
+#endif
+  }
+
+  printf("End\n");
+
+  return 0;
+}
@@ -0,0 +1,97 @@
+#include <math.h>
+#include <stdio.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(100*X[i])); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define MAX_LEN 256
+#define NUM_LAGS 32
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_correlate_partial_f32/q15/q31 compute the NUM_LAGS lags -16..15 around zero lag of two sequences of
+MAX_LEN samples and are compared with riscv_correlate_f32/q15/q31, which compute all 2*MAX_LEN-1 lags.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions15"
+#include "../common/riscv_bench.h"
+
+float32_t srcA_f32[MAX_LEN];
+float32_t srcB_f32[MAX_LEN];
+float32_t result_f32[2 * MAX_LEN - 1];
+q31_t srcA_q31[MAX_LEN];
+q31_t srcB_q31[MAX_LEN];
+q31_t result_q31[2 * MAX_LEN - 1];
+q15_t srcA_q15[MAX_LEN];
+q15_t srcB_q15[MAX_LEN];
+q15_t result_q15[2 * MAX_LEN - 1];
+
+int32_t main(void)
+{
+  uint32_t i;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (i = 0; i < MAX_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    srcA_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    srcA_q31[i] = (q31_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 12;
+    srcA_q15[i] = (q15_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) >> 4);
+    seed = seed * 1103515245u + 12345u;
+    srcB_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    srcB_q31[i] = (q31_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 12;
+    srcB_q15[i] = (q15_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) >> 4);
+  }
+
+/*Tests*/
+  RISCV_BENCH("riscv_correlate_f32", "f32", MAX_LEN,
+    riscv_correlate_f32(srcA_f32, MAX_LEN, srcB_f32, MAX_LEN, result_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(result_f32,2 * MAX_LEN - 1);
+#endif
+
+  RISCV_BENCH("riscv_correlate_partial_f32", "f32", NUM_LAGS,
+    riscv_correlate_partial_f32(srcA_f32, MAX_LEN, srcB_f32, MAX_LEN, result_f32, -(NUM_LAGS / 2), NUM_LAGS));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(result_f32,NUM_LAGS);
+#endif
+
+  RISCV_BENCH("riscv_correlate_q31", "q31", MAX_LEN,
+    riscv_correlate_q31(srcA_q31, MAX_LEN, srcB_q31, MAX_LEN, result_q31));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q31,2 * MAX_LEN - 1);
+#endif
+
+  RISCV_BENCH("riscv_correlate_partial_q31", "q31", NUM_LAGS,
+    riscv_correlate_partial_q31(srcA_q31, MAX_LEN, srcB_q31, MAX_LEN, result_q31, -(NUM_LAGS / 2), NUM_LAGS));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q31,NUM_LAGS);
+#endif
+
+  RISCV_BENCH("riscv_correlate_q15", "q15", MAX_LEN,
+    riscv_correlate_q15(srcA_q15, MAX_LEN, srcB_q15, MAX_LEN, result_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q15,2 * MAX_LEN - 1);
+#endif
+
+  RISCV_BENCH("riscv_correlate_partial_q15", "q15", NUM_LAGS,
+    riscv_correlate_partial_q15(srcA_q15, MAX_LEN, srcB_q15, MAX_LEN, result_q15, -(NUM_LAGS / 2), NUM_LAGS));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q15,NUM_LAGS);
+#endif
+
+  printf("End\n");
+
+  return 0;
+}
@@ -0,0 +1,153 @@
+#include <math.h>
+#include <stdio.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(100*X[i])); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define STREAM_LEN 256
+#define KERNEL_LEN 32
+#define BLOCK_SIZE 32
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_conv_stream_f32/q31/q15 convolve a stream of STREAM_LEN samples, fed in blocks of BLOCK_SIZE, with a
+sequence of KERNEL_LEN samples and are compared with riscv_conv_f32/q31/q15 on the whole stream.
+The stream lines include the flush of the last KERNEL_LEN-1 outputs.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions16"
+#include "../common/riscv_bench.h"
+
+float32_t src_f32[STREAM_LEN];
+float32_t kernel_f32[KERNEL_LEN];
+float32_t coeffs_f32[KERNEL_LEN];
+float32_t state_f32[KERNEL_LEN + BLOCK_SIZE - 1];
+float32_t result_f32[STREAM_LEN + KERNEL_LEN - 1];
+q31_t src_q31[STREAM_LEN];
+q31_t kernel_q31[KERNEL_LEN];
+q31_t coeffs_q31[KERNEL_LEN];
+q31_t state_q31[KERNEL_LEN + BLOCK_SIZE - 1];
+q31_t result_q31[STREAM_LEN + KERNEL_LEN - 1];
+q15_t src_q15[STREAM_LEN];
+q15_t kernel_q15[KERNEL_LEN];
+q15_t coeffs_q15[KERNEL_LEN];
+q15_t state_q15[KERNEL_LEN + BLOCK_SIZE - 1];
+q15_t result_q15[STREAM_LEN + KERNEL_LEN - 1];
+
+riscv_conv_stream_instance_f32 S_f32;
+riscv_conv_stream_instance_q31 S_q31;
+riscv_conv_stream_instance_q15 S_q15;
+
+void stream_f32(void)
+{
+  uint32_t n;
+
+  for (n = 0; n < STREAM_LEN; n += BLOCK_SIZE)
+  {
+    riscv_conv_stream_f32(&S_f32, src_f32 + n, result_f32 + n, BLOCK_SIZE);
+  }
+
+  riscv_conv_stream_flush_f32(&S_f32, result_f32 + STREAM_LEN);
+}
+
+void stream_q31(void)
+{
+  uint32_t n;
+
+  for (n = 0; n < STREAM_LEN; n += BLOCK_SIZE)
+  {
+    riscv_conv_stream_q31(&S_q31, src_q31 + n, result_q31 + n, BLOCK_SIZE);
+  }
+
+  riscv_conv_stream_flush_q31(&S_q31, result_q31 + STREAM_LEN);
+}
+
+void stream_q15(void)
+{
+  uint32_t n;
+
+  for (n = 0; n < STREAM_LEN; n += BLOCK_SIZE)
+  {
+    riscv_conv_stream_q15(&S_q15, src_q15 + n, result_q15 + n, BLOCK_SIZE);
+  }
+
+  riscv_conv_stream_flush_q15(&S_q15, result_q15 + STREAM_LEN);
+}
+
+int32_t main(void)
+{
+  uint32_t i;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (i = 0; i < STREAM_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    src_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    src_q31[i] = (q31_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 12;
+    src_q15[i] = (q15_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) >> 4);
+  }
+
+  for (i = 0; i < KERNEL_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    kernel_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    kernel_q31[i] = (q31_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 12;
+    kernel_q15[i] = (q15_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) >> 4);
+  }
+
+  riscv_conv_stream_init_f32(&S_f32, kernel_f32, KERNEL_LEN, coeffs_f32, state_f32, BLOCK_SIZE);
+  riscv_conv_stream_init_q31(&S_q31, kernel_q31, KERNEL_LEN, coeffs_q31, state_q31, BLOCK_SIZE);
+  riscv_conv_stream_init_q15(&S_q15, kernel_q15, KERNEL_LEN, coeffs_q15, state_q15, BLOCK_SIZE);
+
+/*Tests*/
+  RISCV_BENCH("riscv_conv_f32", "f32", STREAM_LEN,
+    riscv_conv_f32(src_f32, STREAM_LEN, kernel_f32, KERNEL_LEN, result_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(result_f32,STREAM_LEN + KERNEL_LEN - 1);
+#endif
+
+  RISCV_BENCH("riscv_conv_stream_f32", "f32", STREAM_LEN,
+    stream_f32());
+#ifdef PRINT_OUTPUT
+  PRINT_F32(result_f32,STREAM_LEN + KERNEL_LEN - 1);
+#endif
+
+  RISCV_BENCH("riscv_conv_q31", "q31", STREAM_LEN,
+    riscv_conv_q31(src_q31, STREAM_LEN, kernel_q31, KERNEL_LEN, result_q31));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q31,STREAM_LEN + KERNEL_LEN - 1);
+#endif
+
+  RISCV_BENCH("riscv_conv_stream_q31", "q31", STREAM_LEN,
+    stream_q31());
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q31,STREAM_LEN + KERNEL_LEN - 1);
+#endif
+
+  RISCV_BENCH("riscv_conv_q15", "q15", STREAM_LEN,
+    riscv_conv_q15(src_q15, STREAM_LEN, kernel_q15, KERNEL_LEN, result_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q15,STREAM_LEN + KERNEL_LEN - 1);
+#endif
+
+  RISCV_BENCH("riscv_conv_stream_q15", "q15", STREAM_LEN,
+    stream_q15());
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q15,STREAM_LEN + KERNEL_LEN - 1);
+#endif
+
+  printf("End\n");
+
+  return 0;
+}
@@ -0,0 +1,92 @@
+#include <math.h>
+#include <stdio.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(100*X[i])); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define IMG_ROWS 32
+#define IMG_COLS 32
+#define MAX_KERNEL 5
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_conv2d_q7/q15/f32 filter an IMG_ROWS x IMG_COLS image with kernels of 3x3 and 5x5, which have dedicated
+code, and 4x4, which uses the generic path.  The size column is the kernel width.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions17"
+#include "../common/riscv_bench.h"
+
+float32_t src_f32[IMG_ROWS * IMG_COLS];
+float32_t kernel_f32[MAX_KERNEL * MAX_KERNEL];
+float32_t result_f32[IMG_ROWS * IMG_COLS];
+q15_t src_q15[IMG_ROWS * IMG_COLS];
+q15_t kernel_q15[MAX_KERNEL * MAX_KERNEL];
+q15_t result_q15[IMG_ROWS * IMG_COLS];
+q7_t src_q7[IMG_ROWS * IMG_COLS];
+q7_t kernel_q7[MAX_KERNEL * MAX_KERNEL];
+q7_t result_q7[IMG_ROWS * IMG_COLS];
+
+uint16_t kSize[3] = {3, 4, 5};
+
+int32_t main(void)
+{
+  uint32_t i, t, k, outLen;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (i = 0; i < IMG_ROWS * IMG_COLS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    src_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    src_q15[i] = (q15_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 1);
+    src_q7[i] = (q7_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) >> 7);
+  }
+
+  for (i = 0; i < MAX_KERNEL * MAX_KERNEL; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    kernel_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    kernel_q15[i] = (q15_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) >> 2);
+    kernel_q7[i] = (q7_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) >> 10);
+  }
+
+/*Tests*/
+  for (t = 0; t < 3; t++)
+  {
+    k = kSize[t];
+    outLen = (IMG_ROWS - k + 1) * (IMG_COLS - k + 1);
+
+    RISCV_BENCH("riscv_conv2d_f32", "f32", k,
+      riscv_conv2d_f32(src_f32, IMG_ROWS, IMG_COLS, kernel_f32, k, k, result_f32));
+#ifdef PRINT_OUTPUT
+    PRINT_F32(result_f32,outLen);
+#endif
+
+    RISCV_BENCH("riscv_conv2d_q15", "q15", k,
+      riscv_conv2d_q15(src_q15, IMG_ROWS, IMG_COLS, kernel_q15, k, k, result_q15));
+#ifdef PRINT_OUTPUT
+    PRINT_Q(result_q15,outLen);
+#endif
+
+    RISCV_BENCH("riscv_conv2d_q7", "q7", k,
+      riscv_conv2d_q7(src_q7, IMG_ROWS, IMG_COLS, kernel_q7, k, k, result_q7));
+#ifdef PRINT_OUTPUT
+    PRINT_Q(result_q7,outLen);
+#endif
+  }
+
+  printf("End\n");
+
+  return 0;
+}
@@ -0,0 +1,178 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define SIGNAL_LEN 512
+#define TILE_SIZE 64
+#define NUM_TAPS 32
+#define NUM_STAGES 2
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The streaming filters process SIGNAL_LEN samples in tiles of TILE_SIZE samples through four tiles in
+l1_*, the size column is SIGNAL_LEN.  They are compared with one call of the filter on the whole signal.
+PULPino has no DMA, so the transfers are done by riscv_dma_start_memcpy() and the cycles include the copies
+that a DMA would overlap with the processing.
+*Define PRINT_OUTPUT to compare the results of the streaming filters with the filters on the whole signal
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions18"
+#include "../common/riscv_bench.h"
+
+float32_t src_f32[SIGNAL_LEN], dst_f32[SIGNAL_LEN], ref_f32[SIGNAL_LEN], l1_f32[4 * TILE_SIZE];
+q31_t src_q31[SIGNAL_LEN], dst_q31[SIGNAL_LEN], ref_q31[SIGNAL_LEN], l1_q31[4 * TILE_SIZE];
+q15_t src_q15[SIGNAL_LEN], dst_q15[SIGNAL_LEN], ref_q15[SIGNAL_LEN], l1_q15[4 * TILE_SIZE];
+
+float32_t firCoeffs_f32[NUM_TAPS], firState_f32[NUM_TAPS + SIGNAL_LEN - 1];
+q31_t firCoeffs_q31[NUM_TAPS], firState_q31[NUM_TAPS + SIGNAL_LEN - 1];
+q15_t firCoeffs_q15[NUM_TAPS], firState_q15[NUM_TAPS + SIGNAL_LEN];
+
+/* 2nd order lowpass sections {b0, b1, b2, a1, a2}, the Q formats hold the coefficients divided by 2 */
+float32_t bqCoeffs_f32[5 * NUM_STAGES] =
+{
+  0.0675f, 0.1349f, 0.0675f, 1.1430f, -0.4128f,
+  0.0675f, 0.1349f, 0.0675f, 1.1430f, -0.4128f
+};
+q31_t bqCoeffs_q31[5 * NUM_STAGES];
+q15_t bqCoeffs_q15[6 * NUM_STAGES];
+float32_t bqState_f32[4 * NUM_STAGES];
+q31_t bqState_q31[4 * NUM_STAGES];
+q15_t bqState_q15[4 * NUM_STAGES];
+
+#define PRINT_CMP(NAME,X,Y,N) printf("%s: %s\n", (NAME), (memcmp((X), (Y), (N) * sizeof((X)[0])) == 0) ? "equal" : "differ")
+
+int32_t main(void)
+{
+  riscv_dma_instance D;
+  riscv_fir_instance_f32 fir_f32;
+  riscv_fir_instance_q31 fir_q31;
+  riscv_fir_instance_q15 fir_q15;
+  riscv_biquad_casd_df1_inst_f32 bq_f32;
+  riscv_biquad_casd_df1_inst_q31 bq_q31;
+  riscv_biquad_casd_df1_inst_q15 bq_q15;
+  riscv_biquad_cascade_df2T_instance_f32 bqT_f32;
+  uint32_t i, s;
+  uint32_t seed = 1u;
+  float32_t r;
+
+  riscv_bench_header();
+
+  riscv_dma_init(&D, NULL, NULL, NULL);
+
+  for (i = 0; i < SIGNAL_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    r = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / 2.0f;
+    src_f32[i] = r;
+    src_q31[i] = (q31_t)(r * 2147483647.0f);
+    src_q15[i] = (q15_t)(r * 32767.0f);
+  }
+
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    r = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / NUM_TAPS;
+    firCoeffs_f32[i] = r;
+    firCoeffs_q31[i] = (q31_t)(r * 2147483647.0f);
+    firCoeffs_q15[i] = (q15_t)(r * 32767.0f);
+  }
+
+  for (s = 0; s < NUM_STAGES; s++)
+  {
+    for (i = 0; i < 5; i++)
+    {
+      bqCoeffs_q31[5 * s + i] = (q31_t)(bqCoeffs_f32[5 * s + i] * 1073741824.0f);
+    }
+
+    /* {b0, 0, b1, b2, a1, a2} */
+    bqCoeffs_q15[6 * s] = (q15_t)(bqCoeffs_f32[5 * s] * 16384.0f);
+    bqCoeffs_q15[6 * s + 1] = 0;
+    for (i = 1; i < 5; i++)
+    {
+      bqCoeffs_q15[6 * s + i + 1] = (q15_t)(bqCoeffs_f32[5 * s + i] * 16384.0f);
+    }
+  }
+
+/*FIR*/
+  RISCV_BENCH("riscv_fir_f32", "f32", SIGNAL_LEN,
+    riscv_fir_init_f32(&fir_f32, NUM_TAPS, firCoeffs_f32, firState_f32, SIGNAL_LEN);
+    riscv_fir_f32(&fir_f32, src_f32, ref_f32, SIGNAL_LEN));
+  RISCV_BENCH("riscv_fir_stream_f32", "f32", SIGNAL_LEN,
+    riscv_fir_init_f32(&fir_f32, NUM_TAPS, firCoeffs_f32, firState_f32, TILE_SIZE);
+    riscv_fir_stream_f32(&D, &fir_f32, src_f32, dst_f32, SIGNAL_LEN, TILE_SIZE, l1_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_fir_stream_f32", dst_f32, ref_f32, SIGNAL_LEN);
+#endif
+
+  RISCV_BENCH("riscv_fir_q31", "q31", SIGNAL_LEN,
+    riscv_fir_init_q31(&fir_q31, NUM_TAPS, firCoeffs_q31, firState_q31, SIGNAL_LEN);
+    riscv_fir_q31(&fir_q31, src_q31, ref_q31, SIGNAL_LEN));
+  RISCV_BENCH("riscv_fir_stream_q31", "q31", SIGNAL_LEN,
+    riscv_fir_init_q31(&fir_q31, NUM_TAPS, firCoeffs_q31, firState_q31, TILE_SIZE);
+    riscv_fir_stream_q31(&D, &fir_q31, src_q31, dst_q31, SIGNAL_LEN, TILE_SIZE, l1_q31));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_fir_stream_q31", dst_q31, ref_q31, SIGNAL_LEN);
+#endif
+
+  RISCV_BENCH("riscv_fir_q15", "q15", SIGNAL_LEN,
+    riscv_fir_init_q15(&fir_q15, NUM_TAPS, firCoeffs_q15, firState_q15, SIGNAL_LEN);
+    riscv_fir_q15(&fir_q15, src_q15, ref_q15, SIGNAL_LEN));
+  RISCV_BENCH("riscv_fir_stream_q15", "q15", SIGNAL_LEN,
+    riscv_fir_init_q15(&fir_q15, NUM_TAPS, firCoeffs_q15, firState_q15, TILE_SIZE);
+    riscv_fir_stream_q15(&D, &fir_q15, src_q15, dst_q15, SIGNAL_LEN, TILE_SIZE, l1_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_fir_stream_q15", dst_q15, ref_q15, SIGNAL_LEN);
+#endif
+
+/*Biquad*/
+  RISCV_BENCH("riscv_biquad_cascade_df1_f32", "f32", SIGNAL_LEN,
+    riscv_biquad_cascade_df1_init_f32(&bq_f32, NUM_STAGES, bqCoeffs_f32, bqState_f32);
+    riscv_biquad_cascade_df1_f32(&bq_f32, src_f32, ref_f32, SIGNAL_LEN));
+  RISCV_BENCH("riscv_biquad_cascade_df1_stream_f32", "f32", SIGNAL_LEN,
+    riscv_biquad_cascade_df1_init_f32(&bq_f32, NUM_STAGES, bqCoeffs_f32, bqState_f32);
+    riscv_biquad_cascade_df1_stream_f32(&D, &bq_f32, src_f32, dst_f32, SIGNAL_LEN, TILE_SIZE, l1_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_biquad_cascade_df1_stream_f32", dst_f32, ref_f32, SIGNAL_LEN);
+#endif
+
+  RISCV_BENCH("riscv_biquad_cascade_df1_q31", "q31", SIGNAL_LEN,
+    riscv_biquad_cascade_df1_init_q31(&bq_q31, NUM_STAGES, bqCoeffs_q31, bqState_q31, 1);
+    riscv_biquad_cascade_df1_q31(&bq_q31, src_q31, ref_q31, SIGNAL_LEN));
+  RISCV_BENCH("riscv_biquad_cascade_df1_stream_q31", "q31", SIGNAL_LEN,
+    riscv_biquad_cascade_df1_init_q31(&bq_q31, NUM_STAGES, bqCoeffs_q31, bqState_q31, 1);
+    riscv_biquad_cascade_df1_stream_q31(&D, &bq_q31, src_q31, dst_q31, SIGNAL_LEN, TILE_SIZE, l1_q31));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_biquad_cascade_df1_stream_q31", dst_q31, ref_q31, SIGNAL_LEN);
+#endif
+
+  RISCV_BENCH("riscv_biquad_cascade_df1_q15", "q15", SIGNAL_LEN,
+    riscv_biquad_cascade_df1_init_q15(&bq_q15, NUM_STAGES, bqCoeffs_q15, bqState_q15, 1);
+    riscv_biquad_cascade_df1_q15(&bq_q15, src_q15, ref_q15, SIGNAL_LEN));
+  RISCV_BENCH("riscv_biquad_cascade_df1_stream_q15", "q15", SIGNAL_LEN,
+    riscv_biquad_cascade_df1_init_q15(&bq_q15, NUM_STAGES, bqCoeffs_q15, bqState_q15, 1);
+    riscv_biquad_cascade_df1_stream_q15(&D, &bq_q15, src_q15, dst_q15, SIGNAL_LEN, TILE_SIZE, l1_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_biquad_cascade_df1_stream_q15", dst_q15, ref_q15, SIGNAL_LEN);
+#endif
+
+  RISCV_BENCH("riscv_biquad_cascade_df2T_f32", "f32", SIGNAL_LEN,
+    riscv_biquad_cascade_df2T_init_f32(&bqT_f32, NUM_STAGES, bqCoeffs_f32, bqState_f32);
+    riscv_biquad_cascade_df2T_f32(&bqT_f32, src_f32, ref_f32, SIGNAL_LEN));
+  RISCV_BENCH("riscv_biquad_cascade_df2T_stream_f32", "f32", SIGNAL_LEN,
+    riscv_biquad_cascade_df2T_init_f32(&bqT_f32, NUM_STAGES, bqCoeffs_f32, bqState_f32);
+    riscv_biquad_cascade_df2T_stream_f32(&D, &bqT_f32, src_f32, dst_f32, SIGNAL_LEN, TILE_SIZE, l1_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_biquad_cascade_df2T_stream_f32", dst_f32, ref_f32, SIGNAL_LEN);
+#endif
+
+  printf("End\n");
+
+  return 0;
+}
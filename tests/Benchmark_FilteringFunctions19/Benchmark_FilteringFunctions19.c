@@ -0,0 +1,113 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define SIGNAL_LEN 256
+#define NUM_TAPS 32
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The complex FIR filters process SIGNAL_LEN complex samples.  With real taps they are compared with
+two calls of riscv_fir_q15 on the real and the imaginary parts, the CHECK line must report equal.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions19"
+#include "../common/riscv_bench.h"
+
+float32_t src_f32[2 * SIGNAL_LEN], dst_f32[2 * SIGNAL_LEN];
+q15_t src_q15[2 * SIGNAL_LEN], dst_q15[2 * SIGNAL_LEN], ref_q15[2 * SIGNAL_LEN];
+q15_t re_q15[SIGNAL_LEN], im_q15[SIGNAL_LEN], reOut_q15[SIGNAL_LEN], imOut_q15[SIGNAL_LEN];
+
+float32_t cfirCoeffs_f32[2 * NUM_TAPS], cfirState_f32[2 * (NUM_TAPS + SIGNAL_LEN - 1)];
+q15_t cfirCoeffs_q15[2 * NUM_TAPS], cfirState_q15[2 * (NUM_TAPS + SIGNAL_LEN - 1)];
+q15_t firCoeffs_q15[NUM_TAPS], firState_q15[NUM_TAPS + SIGNAL_LEN];
+
+int32_t main(void)
+{
+  riscv_cfir_instance_f32 cfir_f32;
+  riscv_cfir_instance_q15 cfir_q15;
+  riscv_fir_instance_q15 fir_q15;
+  uint32_t i;
+  uint32_t seed = 1u;
+  float32_t r;
+  int32_t fail = 0;
+
+  riscv_bench_header();
+
+  for (i = 0; i < 2 * SIGNAL_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    r = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / 2.0f;
+    src_f32[i] = r;
+    src_q15[i] = (q15_t)(r * 32767.0f);
+  }
+
+  for (i = 0; i < SIGNAL_LEN; i++)
+  {
+    re_q15[i] = src_q15[2 * i];
+    im_q15[i] = src_q15[2 * i + 1];
+  }
+
+  for (i = 0; i < 2 * NUM_TAPS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    r = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / NUM_TAPS;
+    cfirCoeffs_f32[i] = r;
+    cfirCoeffs_q15[i] = (q15_t)(r * 32767.0f);
+  }
+
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    firCoeffs_q15[i] = cfirCoeffs_q15[i];
+  }
+
+/*Real taps*/
+  RISCV_BENCH("riscv_fir_q15(2)", "q15", SIGNAL_LEN,
+    riscv_fir_init_q15(&fir_q15, NUM_TAPS, firCoeffs_q15, firState_q15, SIGNAL_LEN);
+    riscv_fir_q15(&fir_q15, re_q15, reOut_q15, SIGNAL_LEN);
+    riscv_fir_init_q15(&fir_q15, NUM_TAPS, firCoeffs_q15, firState_q15, SIGNAL_LEN);
+    riscv_fir_q15(&fir_q15, im_q15, imOut_q15, SIGNAL_LEN));
+  RISCV_BENCH("riscv_cfir_q15(real)", "q15", SIGNAL_LEN,
+    riscv_cfir_init_q15(&cfir_q15, NUM_TAPS, cfirCoeffs_q15, cfirState_q15, SIGNAL_LEN, 0);
+    riscv_cfir_q15(&cfir_q15, src_q15, dst_q15, SIGNAL_LEN));
+
+  for (i = 0; i < SIGNAL_LEN; i++)
+  {
+    ref_q15[2 * i] = reOut_q15[i];
+    ref_q15[2 * i + 1] = imOut_q15[i];
+  }
+  if(memcmp(dst_q15, ref_q15, sizeof(dst_q15)) != 0)
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_cfir_q15(real): %s\n", (fail == 0) ? "equal" : "differ");
+
+  RISCV_BENCH("riscv_cfir_f32(real)", "f32", SIGNAL_LEN,
+    riscv_cfir_init_f32(&cfir_f32, NUM_TAPS, cfirCoeffs_f32, cfirState_f32, SIGNAL_LEN, 0);
+    riscv_cfir_f32(&cfir_f32, src_f32, dst_f32, SIGNAL_LEN));
+
+/*Complex taps*/
+  RISCV_BENCH("riscv_cfir_q15(cmplx)", "q15", SIGNAL_LEN,
+    riscv_cfir_init_q15(&cfir_q15, NUM_TAPS, cfirCoeffs_q15, cfirState_q15, SIGNAL_LEN, 1);
+    riscv_cfir_q15(&cfir_q15, src_q15, dst_q15, SIGNAL_LEN));
+  RISCV_BENCH("riscv_cfir_f32(cmplx)", "f32", SIGNAL_LEN,
+    riscv_cfir_init_f32(&cfir_f32, NUM_TAPS, cfirCoeffs_f32, cfirState_f32, SIGNAL_LEN, 1);
+    riscv_cfir_f32(&cfir_f32, src_f32, dst_f32, SIGNAL_LEN));
+#ifdef PRINT_OUTPUT
+  for(i = 0 ; i < 16 ; i++)
+    {
+      printf("%d + i%d\n",(int)(dst_f32[2 * i]*1000),(int)(dst_f32[2 * i + 1]*1000));
+    }
+#endif
+
+  printf("End\n");
+
+  return fail;
+}
@@ -0,0 +1,102 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define PDM_BYTES 512
+#define PDM_R 64
+#define PDM_STAGES 4
+#define PCM_LEN 1024
+#define PCM_R 16
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The PDM decimator processes PDM_BYTES bytes of a random bitstream.  riscv_cic_decimate_q31 filters
+the same bits as samples of +-2^15, the CHECK line must report equal after the start-up transient.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions20"
+#include "../common/riscv_bench.h"
+
+uint8_t pdm[PDM_BYTES];
+q31_t bits_q31[8 * PDM_BYTES], out_q31[8 * PDM_BYTES / PDM_R];
+q15_t pdmOut_q15[8 * PDM_BYTES / PDM_R];
+uint16_t pdmLut[256 * PDM_STAGES];
+q31_t pdmState[PDM_STAGES * 3 - 1];
+q63_t cicState_q31[PDM_STAGES * 2];
+q15_t src_q15[PCM_LEN], dst_q15[PCM_LEN];
+q31_t cicState_q15[PDM_STAGES * 2];
+
+int32_t main(void)
+{
+  riscv_cic_decimate_pdm_instance_q15 cicPdm;
+  riscv_cic_decimate_instance_q31 cic_q31;
+  riscv_cic_decimate_instance_q15 cic_q15;
+  riscv_cic_interpolate_instance_q15 cicInterp_q15;
+  uint32_t i;
+  uint32_t seed = 1u;
+  q31_t ref;
+  int32_t fail = 0;
+
+  riscv_bench_header();
+
+  for (i = 0; i < PDM_BYTES; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    pdm[i] = (uint8_t)(seed >> 16);
+  }
+
+  for (i = 0; i < 8 * PDM_BYTES; i++)
+  {
+    bits_q31[i] = ((pdm[i >> 3] >> (7 - (i & 7))) & 1) ? 32768 : -32768;
+  }
+
+  for (i = 0; i < PCM_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    src_q15[i] = (q15_t)(seed >> 16);
+  }
+
+/*PDM to PCM*/
+  RISCV_BENCH("riscv_cic_decimate_pdm_q15", "q15", 8 * PDM_BYTES,
+    riscv_cic_decimate_pdm_init_q15(&cicPdm, PDM_STAGES, 1, PDM_R, pdmLut, pdmState);
+    riscv_cic_decimate_pdm_q15(&cicPdm, pdm, pdmOut_q15, PDM_BYTES));
+  RISCV_BENCH("riscv_cic_decimate_q31(bits)", "q31", 8 * PDM_BYTES,
+    riscv_cic_decimate_init_q31(&cic_q31, PDM_STAGES, 1, PDM_R, cicState_q31);
+    riscv_cic_decimate_q31(&cic_q31, bits_q31, out_q31, 8 * PDM_BYTES));
+
+  /* The first outputs differ, the PDM decimator starts from bits of 0 and the Q31 one from samples of 0 */
+  for (i = PDM_STAGES; i < 8 * PDM_BYTES / PDM_R; i++)
+  {
+    ref = (out_q31[i] > 32767) ? 32767 : out_q31[i];
+    if(ref != pdmOut_q15[i])
+    {
+      fail = 1;
+    }
+  }
+  printf("CHECK riscv_cic_decimate_pdm_q15: %s\n", (fail == 0) ? "equal" : "differ");
+
+/*PCM*/
+  RISCV_BENCH("riscv_cic_decimate_q15", "q15", PCM_LEN,
+    riscv_cic_decimate_init_q15(&cic_q15, PDM_STAGES, 1, PCM_R, cicState_q15);
+    riscv_cic_decimate_q15(&cic_q15, src_q15, dst_q15, PCM_LEN));
+  RISCV_BENCH("riscv_cic_interpolate_q15", "q15", PCM_LEN,
+    riscv_cic_interpolate_init_q15(&cicInterp_q15, PDM_STAGES, 1, PCM_R, cicState_q15);
+    riscv_cic_interpolate_q15(&cicInterp_q15, src_q15, dst_q15, PCM_LEN / PCM_R));
+#ifdef PRINT_OUTPUT
+  for(i = 0 ; i < 16 ; i++)
+    {
+      printf("%d\n",pdmOut_q15[i]);
+    }
+#endif
+
+  printf("End\n");
+
+  return fail;
+}
@@ -0,0 +1,143 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define SIGNAL_LEN 256
+#define NUM_TAPS 31
+#define NUM_PAIRS ((NUM_TAPS + 1) / 4)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The half-band filters are compared with riscv_fir_decimate and riscv_fir_interpolate by 2 on the
+full coefficients, the CHECK lines must report equal.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions21"
+#include "../common/riscv_bench.h"
+
+float32_t src_f32[SIGNAL_LEN], dst_f32[2 * SIGNAL_LEN];
+q15_t src_q15[SIGNAL_LEN], dst_q15[2 * SIGNAL_LEN], ref_q15[2 * SIGNAL_LEN];
+q31_t src_q31[SIGNAL_LEN], dst_q31[2 * SIGNAL_LEN], ref_q31[2 * SIGNAL_LEN];
+
+float32_t firCoeffs_f32[NUM_TAPS + 1], hbCoeffs_f32[NUM_PAIRS + 1];
+q15_t firCoeffs_q15[NUM_TAPS + 1], hbCoeffs_q15[NUM_PAIRS + 1];
+q31_t firCoeffs_q31[NUM_TAPS + 1], hbCoeffs_q31[NUM_PAIRS + 1];
+float32_t state_f32[NUM_TAPS + SIGNAL_LEN];
+q15_t state_q15[NUM_TAPS + SIGNAL_LEN];
+q31_t state_q31[NUM_TAPS + SIGNAL_LEN];
+
+int32_t main(void)
+{
+  riscv_fir_decimate_instance_f32 dec_f32;
+  riscv_fir_decimate_instance_q15 dec_q15;
+  riscv_fir_decimate_instance_q31 dec_q31;
+  riscv_fir_interpolate_instance_q15 interp_q15;
+  riscv_fir_halfband_instance_f32 hb_f32;
+  riscv_fir_halfband_instance_q15 hb_q15;
+  riscv_fir_halfband_instance_q31 hb_q31;
+  uint32_t i, n;
+  uint32_t seed = 1u;
+  float32_t r;
+  int32_t fail = 0;
+
+  riscv_bench_header();
+
+  for (i = 0; i < SIGNAL_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    r = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / 2.0f;
+    src_f32[i] = r;
+    src_q15[i] = (q15_t)(r * 32767.0f);
+    src_q31[i] = (q31_t)(r * 2147483647.0f);
+  }
+
+  /* Windowed sinc of half the band, every other tap but the center one is zero */
+  memset(firCoeffs_f32, 0, sizeof(firCoeffs_f32));
+  for (i = 0; i < NUM_PAIRS; i++)
+  {
+    n = (NUM_TAPS - 1) / 2 - (2 * i + 1);
+    r = sinf(1.57079633f * (2 * i + 1)) / (3.14159265f * (2 * i + 1))
+        * (0.54f + 0.46f * cosf(3.14159265f * (2 * i + 1) / ((NUM_TAPS + 1) / 2)));
+    firCoeffs_f32[n] = r;
+    firCoeffs_f32[NUM_TAPS - 1 - n] = r;
+  }
+  firCoeffs_f32[(NUM_TAPS - 1) / 2] = 0.5f;
+
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    firCoeffs_q15[i] = (q15_t)(firCoeffs_f32[i] * 32767.0f);
+    firCoeffs_q31[i] = (q31_t)(firCoeffs_f32[i] * 2147483647.0f);
+  }
+
+  for (i = 0; i < NUM_PAIRS; i++)
+  {
+    hbCoeffs_f32[i] = firCoeffs_f32[2 * i];
+    hbCoeffs_q15[i] = firCoeffs_q15[2 * i];
+    hbCoeffs_q31[i] = firCoeffs_q31[2 * i];
+  }
+  hbCoeffs_f32[NUM_PAIRS] = firCoeffs_f32[(NUM_TAPS - 1) / 2];
+  hbCoeffs_q15[NUM_PAIRS] = firCoeffs_q15[(NUM_TAPS - 1) / 2];
+  hbCoeffs_q31[NUM_PAIRS] = firCoeffs_q31[(NUM_TAPS - 1) / 2];
+
+/*Decimation by 2*/
+  RISCV_BENCH("riscv_fir_decimate_q15(2)", "q15", SIGNAL_LEN,
+    riscv_fir_decimate_init_q15(&dec_q15, NUM_TAPS, 2, firCoeffs_q15, state_q15, SIGNAL_LEN);
+    riscv_fir_decimate_q15(&dec_q15, src_q15, ref_q15, SIGNAL_LEN));
+  RISCV_BENCH("riscv_fir_halfband_decimate_q15", "q15", SIGNAL_LEN,
+    riscv_fir_halfband_decimate_init_q15(&hb_q15, NUM_TAPS, hbCoeffs_q15, state_q15, SIGNAL_LEN);
+    riscv_fir_halfband_decimate_q15(&hb_q15, src_q15, dst_q15, SIGNAL_LEN));
+  if(memcmp(dst_q15, ref_q15, (SIGNAL_LEN / 2) * sizeof(q15_t)) != 0)
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_fir_halfband_decimate_q15: %s\n", (fail == 0) ? "equal" : "differ");
+
+  RISCV_BENCH("riscv_fir_decimate_q31(2)", "q31", SIGNAL_LEN,
+    riscv_fir_decimate_init_q31(&dec_q31, NUM_TAPS, 2, firCoeffs_q31, state_q31, SIGNAL_LEN);
+    riscv_fir_decimate_q31(&dec_q31, src_q31, ref_q31, SIGNAL_LEN));
+  RISCV_BENCH("riscv_fir_halfband_decimate_q31", "q31", SIGNAL_LEN,
+    riscv_fir_halfband_decimate_init_q31(&hb_q31, NUM_TAPS, hbCoeffs_q31, state_q31, SIGNAL_LEN);
+    riscv_fir_halfband_decimate_q31(&hb_q31, src_q31, dst_q31, SIGNAL_LEN));
+  if(memcmp(dst_q31, ref_q31, (SIGNAL_LEN / 2) * sizeof(q31_t)) != 0)
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_fir_halfband_decimate_q31: %s\n", (fail == 0) ? "equal" : "differ");
+
+  RISCV_BENCH("riscv_fir_decimate_f32(2)", "f32", SIGNAL_LEN,
+    riscv_fir_decimate_init_f32(&dec_f32, NUM_TAPS, 2, firCoeffs_f32, state_f32, SIGNAL_LEN);
+    riscv_fir_decimate_f32(&dec_f32, src_f32, dst_f32, SIGNAL_LEN));
+  RISCV_BENCH("riscv_fir_halfband_decimate_f32", "f32", SIGNAL_LEN,
+    riscv_fir_halfband_decimate_init_f32(&hb_f32, NUM_TAPS, hbCoeffs_f32, state_f32, SIGNAL_LEN);
+    riscv_fir_halfband_decimate_f32(&hb_f32, src_f32, dst_f32, SIGNAL_LEN));
+
+/*Interpolation by 2*/
+  RISCV_BENCH("riscv_fir_interpolate_q15(2)", "q15", SIGNAL_LEN,
+    riscv_fir_interpolate_init_q15(&interp_q15, 2, NUM_TAPS + 1, firCoeffs_q15, state_q15, SIGNAL_LEN);
+    riscv_fir_interpolate_q15(&interp_q15, src_q15, ref_q15, SIGNAL_LEN));
+  RISCV_BENCH("riscv_fir_halfband_interpolate_q15", "q15", SIGNAL_LEN,
+    riscv_fir_halfband_interpolate_init_q15(&hb_q15, NUM_TAPS, hbCoeffs_q15, state_q15, SIGNAL_LEN);
+    riscv_fir_halfband_interpolate_q15(&hb_q15, src_q15, dst_q15, SIGNAL_LEN));
+  if(memcmp(dst_q15, ref_q15, 2 * SIGNAL_LEN * sizeof(q15_t)) != 0)
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_fir_halfband_interpolate_q15: %s\n", (fail == 0) ? "equal" : "differ");
+#ifdef PRINT_OUTPUT
+  for(i = 0 ; i < 16 ; i++)
+    {
+      printf("%d\n",(int)(dst_f32[i]*1000));
+    }
+#endif
+
+  printf("End\n");
+
+  return fail;
+}
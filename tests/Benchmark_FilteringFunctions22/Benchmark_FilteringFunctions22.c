@@ -0,0 +1,114 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define SIGNAL_LEN 256
+#define NUM_TAPS 33
+#define NUM_HALF ((NUM_TAPS + 1) / 2)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The symmetric FIR filters are compared with riscv_fir on the full set of taps, the CHECK lines must
+report equal.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions22"
+#include "../common/riscv_bench.h"
+
+float32_t src_f32[SIGNAL_LEN], dst_f32[SIGNAL_LEN];
+q15_t src_q15[SIGNAL_LEN], dst_q15[SIGNAL_LEN], ref_q15[SIGNAL_LEN];
+q31_t src_q31[SIGNAL_LEN], dst_q31[SIGNAL_LEN], ref_q31[SIGNAL_LEN];
+
+float32_t firCoeffs_f32[NUM_TAPS];
+q15_t firCoeffs_q15[NUM_TAPS + 1];
+q31_t firCoeffs_q31[NUM_TAPS];
+float32_t state_f32[NUM_TAPS + SIGNAL_LEN];
+q15_t state_q15[NUM_TAPS + 1 + SIGNAL_LEN];
+q31_t state_q31[NUM_TAPS + SIGNAL_LEN];
+
+int32_t main(void)
+{
+  riscv_fir_instance_f32 fir_f32;
+  riscv_fir_instance_q15 fir_q15;
+  riscv_fir_instance_q31 fir_q31;
+  riscv_fir_sym_instance_f32 sym_f32;
+  riscv_fir_sym_instance_q15 sym_q15;
+  riscv_fir_sym_instance_q31 sym_q31;
+  uint32_t i;
+  uint32_t seed = 1u;
+  float32_t r;
+  int32_t fail = 0;
+
+  riscv_bench_header();
+
+  for (i = 0; i < SIGNAL_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    r = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / 2.0f;
+    src_f32[i] = r;
+    src_q15[i] = (q15_t)(r * 32767.0f);
+    src_q31[i] = (q31_t)(r * 2147483647.0f);
+  }
+
+  memset(firCoeffs_q15, 0, sizeof(firCoeffs_q15));
+  for (i = 0; i < NUM_HALF; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    r = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / NUM_TAPS;
+    firCoeffs_f32[i] = r;
+    firCoeffs_f32[NUM_TAPS - 1 - i] = r;
+    firCoeffs_q15[i] = (q15_t)(r * 32767.0f);
+    firCoeffs_q15[NUM_TAPS - 1 - i] = firCoeffs_q15[i];
+    firCoeffs_q31[i] = (q31_t)(r * 2147483647.0f);
+    firCoeffs_q31[NUM_TAPS - 1 - i] = firCoeffs_q31[i];
+  }
+
+  RISCV_BENCH("riscv_fir_q15", "q15", SIGNAL_LEN,
+    riscv_fir_init_q15(&fir_q15, NUM_TAPS + 1, firCoeffs_q15, state_q15, SIGNAL_LEN);
+    riscv_fir_q15(&fir_q15, src_q15, ref_q15, SIGNAL_LEN));
+  RISCV_BENCH("riscv_fir_sym_q15", "q15", SIGNAL_LEN,
+    riscv_fir_sym_init_q15(&sym_q15, NUM_TAPS, firCoeffs_q15, state_q15, SIGNAL_LEN);
+    riscv_fir_sym_q15(&sym_q15, src_q15, dst_q15, SIGNAL_LEN));
+  /* riscv_fir_q15 runs the taps with a trailing zero, one sample later */
+  if(memcmp(dst_q15, ref_q15 + 1, (SIGNAL_LEN - 1) * sizeof(q15_t)) != 0)
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_fir_sym_q15: %s\n", (fail == 0) ? "equal" : "differ");
+
+  RISCV_BENCH("riscv_fir_q31", "q31", SIGNAL_LEN,
+    riscv_fir_init_q31(&fir_q31, NUM_TAPS, firCoeffs_q31, state_q31, SIGNAL_LEN);
+    riscv_fir_q31(&fir_q31, src_q31, ref_q31, SIGNAL_LEN));
+  RISCV_BENCH("riscv_fir_sym_q31", "q31", SIGNAL_LEN,
+    riscv_fir_sym_init_q31(&sym_q31, NUM_TAPS, firCoeffs_q31, state_q31, SIGNAL_LEN);
+    riscv_fir_sym_q31(&sym_q31, src_q31, dst_q31, SIGNAL_LEN));
+  if(memcmp(dst_q31, ref_q31, SIGNAL_LEN * sizeof(q31_t)) != 0)
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_fir_sym_q31: %s\n", (fail == 0) ? "equal" : "differ");
+
+  RISCV_BENCH("riscv_fir_f32", "f32", SIGNAL_LEN,
+    riscv_fir_init_f32(&fir_f32, NUM_TAPS, firCoeffs_f32, state_f32, SIGNAL_LEN);
+    riscv_fir_f32(&fir_f32, src_f32, dst_f32, SIGNAL_LEN));
+  RISCV_BENCH("riscv_fir_sym_f32", "f32", SIGNAL_LEN,
+    riscv_fir_sym_init_f32(&sym_f32, NUM_TAPS, firCoeffs_f32, state_f32, SIGNAL_LEN);
+    riscv_fir_sym_f32(&sym_f32, src_f32, dst_f32, SIGNAL_LEN));
+#ifdef PRINT_OUTPUT
+  for(i = 0 ; i < 16 ; i++)
+    {
+      printf("%d\n",(int)(dst_f32[i]*1000));
+    }
+#endif
+
+  printf("End\n");
+
+  return fail;
+}
@@ -0,0 +1,117 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define SIGNAL_LEN 256
+#define NUM_CHANNELS 16
+#define NUM_TAPS 64
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The f32 banks run once more with a rectangular prototype of one tap per channel, the synthesis bank
+must then reproduce the input of the analysis bank.  The Q15 analysis bank is compared with the f32 one
+scaled by the 1/M of riscv_cfft_q15.  The CHECK lines must report equal.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions23"
+#include "../common/riscv_bench.h"
+
+float32_t src_f32[SIGNAL_LEN], chan_f32[2 * SIGNAL_LEN], dst_f32[SIGNAL_LEN];
+q15_t src_q15[SIGNAL_LEN], chan_q15[2 * SIGNAL_LEN], dst_q15[SIGNAL_LEN];
+
+float32_t coeffs_f32[NUM_TAPS];
+q15_t coeffs_q15[NUM_TAPS];
+float32_t rect_f32[NUM_CHANNELS];
+float32_t astate_f32[NUM_TAPS - NUM_CHANNELS + SIGNAL_LEN], sstate_f32[NUM_TAPS];
+q15_t astate_q15[NUM_TAPS - NUM_CHANNELS + SIGNAL_LEN], sstate_q15[NUM_TAPS];
+float32_t scratch_f32[2 * NUM_CHANNELS];
+q15_t scratch_q15[2 * NUM_CHANNELS];
+
+int32_t main(void)
+{
+  riscv_pfb_analysis_instance_f32 ana_f32;
+  riscv_pfb_analysis_instance_q15 ana_q15;
+  riscv_pfb_synthesis_instance_f32 syn_f32;
+  riscv_pfb_synthesis_instance_q15 syn_q15;
+  uint32_t i;
+  uint32_t seed = 1u;
+  float32_t r;
+  int32_t fail = 0;
+
+  riscv_bench_header();
+
+  for (i = 0; i < SIGNAL_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    r = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / 2.0f;
+    src_f32[i] = r;
+    src_q15[i] = (q15_t)(r * 32767.0f);
+  }
+
+  /* Hann-windowed sinc of cut-off 1/(2M), sum of taps about 1 */
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    float32_t t = ((float32_t)i - (NUM_TAPS - 1) / 2.0f) / NUM_CHANNELS;
+    float32_t w = 0.5f - 0.5f * cosf(2.0f * PI * ((float32_t)i + 0.5f) / NUM_TAPS);
+    coeffs_f32[i] = w * ((t == 0.0f) ? 1.0f : sinf(PI * t) / (PI * t)) / NUM_CHANNELS;
+    coeffs_q15[i] = (q15_t)(coeffs_f32[i] * 32767.0f);
+  }
+  for (i = 0; i < NUM_CHANNELS; i++)
+  {
+    rect_f32[i] = 1.0f;
+  }
+
+  RISCV_BENCH("riscv_pfb_analysis_q15", "q15", SIGNAL_LEN,
+    riscv_pfb_analysis_init_q15(&ana_q15, &riscv_cfft_sR_q15_len16, NUM_TAPS, coeffs_q15, astate_q15, SIGNAL_LEN);
+    riscv_pfb_analysis_q15(&ana_q15, src_q15, chan_q15, SIGNAL_LEN));
+  RISCV_BENCH("riscv_pfb_synthesis_q15", "q15", SIGNAL_LEN,
+    riscv_pfb_synthesis_init_q15(&syn_q15, &riscv_cfft_sR_q15_len16, NUM_TAPS, coeffs_q15, sstate_q15, scratch_q15);
+    riscv_pfb_synthesis_q15(&syn_q15, chan_q15, dst_q15, SIGNAL_LEN));
+
+  RISCV_BENCH("riscv_pfb_analysis_f32", "f32", SIGNAL_LEN,
+    riscv_pfb_analysis_init_f32(&ana_f32, &riscv_cfft_sR_f32_len16, NUM_TAPS, coeffs_f32, astate_f32, SIGNAL_LEN);
+    riscv_pfb_analysis_f32(&ana_f32, src_f32, chan_f32, SIGNAL_LEN));
+  for (i = 0; i < 2 * SIGNAL_LEN; i++)
+  {
+    if(fabsf(chan_f32[i] / NUM_CHANNELS - (float32_t)chan_q15[i] / 32768.0f) > 0.002f)
+    {
+      fail = 1;
+    }
+  }
+  printf("CHECK riscv_pfb_analysis_q15: %s\n", (fail == 0) ? "equal" : "differ");
+
+  RISCV_BENCH("riscv_pfb_synthesis_f32", "f32", SIGNAL_LEN,
+    riscv_pfb_synthesis_init_f32(&syn_f32, &riscv_cfft_sR_f32_len16, NUM_TAPS, coeffs_f32, sstate_f32, scratch_f32);
+    riscv_pfb_synthesis_f32(&syn_f32, chan_f32, dst_f32, SIGNAL_LEN));
+
+  riscv_pfb_analysis_init_f32(&ana_f32, &riscv_cfft_sR_f32_len16, NUM_CHANNELS, rect_f32, astate_f32, SIGNAL_LEN);
+  riscv_pfb_analysis_f32(&ana_f32, src_f32, chan_f32, SIGNAL_LEN);
+  riscv_pfb_synthesis_init_f32(&syn_f32, &riscv_cfft_sR_f32_len16, NUM_CHANNELS, rect_f32, sstate_f32, scratch_f32);
+  riscv_pfb_synthesis_f32(&syn_f32, chan_f32, dst_f32, SIGNAL_LEN);
+  for (i = 0; i < SIGNAL_LEN; i++)
+  {
+    if(fabsf(dst_f32[i] - src_f32[i]) > 1e-5f)
+    {
+      fail = 1;
+    }
+  }
+  printf("CHECK riscv_pfb_synthesis_f32: %s\n", (fail == 0) ? "equal" : "differ");
+#ifdef PRINT_OUTPUT
+  for(i = 0 ; i < 16 ; i++)
+    {
+      printf("%d\n",(int)(dst_f32[i]*1000));
+    }
+#endif
+
+  printf("End\n");
+
+  return fail;
+}
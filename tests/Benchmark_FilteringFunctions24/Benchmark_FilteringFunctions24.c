@@ -0,0 +1,92 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define SIGNAL_LEN 256
+#define BLOCK_SIZE 32
+#define NUM_TAPS 1024
+#define NUPC_STATE_LEN 7583
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_fir_nupc_f32 filters SIGNAL_LEN samples in calls of BLOCK_SIZE samples and is compared with
+riscv_fir_f32, the CHECK line must report equal.  riscv_fir_fft_f32 with partitions of BLOCK_SIZE taps
+has the same latency.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions24"
+#include "../common/riscv_bench.h"
+
+float32_t src_f32[SIGNAL_LEN], dst_f32[SIGNAL_LEN], ref_f32[SIGNAL_LEN];
+float32_t coeffs_f32[NUM_TAPS];
+float32_t firState_f32[NUM_TAPS + SIGNAL_LEN - 1];
+float32_t fftState_f32[2 * BLOCK_SIZE * (2 * (NUM_TAPS / BLOCK_SIZE) + 3)];
+float32_t nupcState_f32[NUPC_STATE_LEN];
+
+riscv_fir_instance_f32 S_fir_f32;
+riscv_fir_fft_instance_f32 S_fir_fft_f32;
+riscv_fir_nupc_instance_f32 S_fir_nupc_f32;
+
+int32_t main(void)
+{
+  uint32_t i;
+  uint32_t seed = 1u;
+  int32_t fail = 0;
+
+  riscv_bench_header();
+
+  for (i = 0; i < SIGNAL_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    src_f32[i] = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / 2.0f;
+  }
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    coeffs_f32[i] = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / 64.0f;
+  }
+
+  if(riscv_fir_nupc_state_len_f32(NUM_TAPS, BLOCK_SIZE) > NUPC_STATE_LEN)
+  {
+    printf("NUPC_STATE_LEN too short\n");
+    return 1;
+  }
+
+  RISCV_BENCH("riscv_fir_f32", "f32", NUM_TAPS,
+    riscv_fir_init_f32(&S_fir_f32, NUM_TAPS, coeffs_f32, firState_f32, SIGNAL_LEN);
+    riscv_fir_f32(&S_fir_f32, src_f32, ref_f32, SIGNAL_LEN));
+  RISCV_BENCH("riscv_fir_fft_f32", "f32", NUM_TAPS,
+    riscv_fir_fft_init_f32(&S_fir_fft_f32, NUM_TAPS, coeffs_f32, fftState_f32, BLOCK_SIZE);
+    riscv_fir_fft_f32(&S_fir_fft_f32, src_f32, dst_f32, SIGNAL_LEN));
+  RISCV_BENCH("riscv_fir_nupc_f32", "f32", NUM_TAPS,
+    riscv_fir_nupc_init_f32(&S_fir_nupc_f32, NUM_TAPS, coeffs_f32, nupcState_f32, BLOCK_SIZE);
+    for (i = 0; i < SIGNAL_LEN; i += BLOCK_SIZE)
+    {
+      riscv_fir_nupc_f32(&S_fir_nupc_f32, src_f32 + i, dst_f32 + i, BLOCK_SIZE);
+    });
+  for (i = 0; i < SIGNAL_LEN; i++)
+  {
+    if(fabsf(dst_f32[i] - ref_f32[i]) > 1e-4f)
+    {
+      fail = 1;
+    }
+  }
+  printf("CHECK riscv_fir_nupc_f32: %s\n", (fail == 0) ? "equal" : "differ");
+#ifdef PRINT_OUTPUT
+  for(i = 0 ; i < 16 ; i++)
+    {
+      printf("%d\n",(int)(dst_f32[i]*1000));
+    }
+#endif
+
+  printf("End\n");
+
+  return fail;
+}
@@ -0,0 +1,100 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_TAPS 101
+#define NUM_STAGES 4
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The designed filters are checked at DC and at the Nyquist frequency, where their gains are sums of
+the coefficients, the CHECK lines must report equal.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions25"
+#include "../common/riscv_bench.h"
+
+float32_t firCoeffs_f32[NUM_TAPS];
+float32_t window_f32[NUM_TAPS];
+float32_t biquadCoeffs_f32[5 * NUM_STAGES];
+
+/* Gain at DC of a stage {b0, b1, b2, -a1, -a2} */
+static float32_t dc_gain(const float32_t * c)
+{
+  return (c[0] + c[1] + c[2]) / (1.0f - c[3] - c[4]);
+}
+
+int32_t main(void)
+{
+  uint32_t i;
+  float32_t sum, alt;
+  int32_t fail = 0;
+
+  riscv_bench_header();
+
+  /* Blackman window table */
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    window_f32[i] = 0.42f - 0.5f * cosf(2.0f * PI * i / (NUM_TAPS - 1))
+                          + 0.08f * cosf(4.0f * PI * i / (NUM_TAPS - 1));
+  }
+
+  RISCV_BENCH("riscv_fir_design_f32(lowpass)", "f32", NUM_TAPS,
+    riscv_fir_design_f32(RISCV_FIR_DESIGN_LOWPASS, NUM_TAPS, 0.1f, 0.0f, NULL, firCoeffs_f32));
+  for (i = 0, sum = 0.0f; i < NUM_TAPS; i++)
+  {
+    sum += firCoeffs_f32[i];
+  }
+  if(fabsf(sum - 1.0f) > 1e-5f)
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_fir_design_f32(lowpass): %s\n", (fail == 0) ? "equal" : "differ");
+
+  RISCV_BENCH("riscv_fir_design_f32(highpass,table)", "f32", NUM_TAPS,
+    riscv_fir_design_f32(RISCV_FIR_DESIGN_HIGHPASS, NUM_TAPS, 0.2f, 0.0f, window_f32, firCoeffs_f32));
+  for (i = 0, sum = 0.0f, alt = 0.0f; i < NUM_TAPS; i++)
+  {
+    sum += firCoeffs_f32[i];
+    alt += ((i & 1u) != 0u) ? -firCoeffs_f32[i] : firCoeffs_f32[i];
+  }
+  if((fabsf(sum) > 1e-5f) || (fabsf(alt - 1.0f) > 1e-3f))
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_fir_design_f32(highpass): %s\n", (fail == 0) ? "equal" : "differ");
+
+  RISCV_BENCH("riscv_fir_design_f32(bandpass)", "f32", NUM_TAPS,
+    riscv_fir_design_f32(RISCV_FIR_DESIGN_BANDPASS, NUM_TAPS, 0.1f, 0.2f, NULL, firCoeffs_f32));
+
+  RISCV_BENCH("riscv_biquad_design_f32", "f32", NUM_STAGES,
+    riscv_biquad_design_f32(RISCV_BIQUAD_DESIGN_LOWPASS, 0.1f, 0.7071f, 0.0f, biquadCoeffs_f32);
+    riscv_biquad_design_f32(RISCV_BIQUAD_DESIGN_PEAKING, 0.05f, 2.0f, 6.0f, biquadCoeffs_f32 + 5);
+    riscv_biquad_design_f32(RISCV_BIQUAD_DESIGN_LOWSHELF, 0.02f, 0.7071f, -6.0f, biquadCoeffs_f32 + 10);
+    riscv_biquad_design_f32(RISCV_BIQUAD_DESIGN_NOTCH, 0.2f, 4.0f, 0.0f, biquadCoeffs_f32 + 15));
+  if((fabsf(dc_gain(biquadCoeffs_f32) - 1.0f) > 1e-4f) ||
+     (fabsf(dc_gain(biquadCoeffs_f32 + 5) - 1.0f) > 1e-4f) ||
+     (fabsf(dc_gain(biquadCoeffs_f32 + 10) - 0.501187f) > 1e-4f) ||
+     (fabsf(dc_gain(biquadCoeffs_f32 + 15) - 1.0f) > 1e-4f))
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_biquad_design_f32: %s\n", (fail == 0) ? "equal" : "differ");
+#ifdef PRINT_OUTPUT
+  for(i = 0 ; i < 5 * NUM_STAGES ; i++)
+    {
+      printf("%d\n",(int)(biquadCoeffs_f32[i]*1000));
+    }
+#endif
+
+  printf("End\n");
+
+  return fail;
+}
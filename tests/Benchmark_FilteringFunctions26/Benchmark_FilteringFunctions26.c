@@ -0,0 +1,205 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_TAPS 32
+#define NUM_STAGES 2
+#define BLOCK_SIZE 64
+#define FFT_LEN 256
+#define MDCT_LEN 128
+#define ARENA_WORDS 2048
+#define SPARSE_TAPS 8
+#define SPARSE_DELAY 40
+#define DCT_LEN 128
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The filters built from the arena must output what the filters with caller buffers output, and the
+arena must hold exactly the buffer sizes plus the largest scratch size.  Kernels passed NULL scratch
+buffers must output what they output with caller buffers and leave the scratch pool empty, the CHECK
+lines must report equal.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions26"
+#include "../common/riscv_bench.h"
+
+uint64_t arena_mem[ARENA_WORDS];
+float32_t firCoeffs_f32[NUM_TAPS];
+float32_t firState_f32[NUM_TAPS + BLOCK_SIZE - 1];
+q15_t firCoeffs_q15[NUM_TAPS];
+q15_t firState_q15[NUM_TAPS + BLOCK_SIZE];
+q15_t biquadCoeffs_q15[6 * NUM_STAGES] = {
+  2000, 0, 4000, 2000, 16000, -6000,
+  4096, 0, -8192, 4096, 12000, -4000 };
+q15_t biquadState_q15[4 * NUM_STAGES];
+float32_t stftWindow_f32[FFT_LEN];
+q31_t mdctWindow_q31[MDCT_LEN];
+float32_t src_f32[BLOCK_SIZE];
+float32_t ref_f32[BLOCK_SIZE];
+float32_t out_f32[BLOCK_SIZE];
+q15_t src_q15[BLOCK_SIZE];
+q15_t ref_q15[BLOCK_SIZE];
+q15_t out_q15[BLOCK_SIZE];
+uint64_t pool_mem[512];
+q7_t sparseCoeffs_q7[SPARSE_TAPS] = { 40, -20, 10, 60, -30, 25, -5, 12 };
+int32_t sparseDelay[SPARSE_TAPS] = { 0, 3, 7, 12, 20, 27, 33, 40 };
+q7_t sparseState_q7[SPARSE_DELAY + BLOCK_SIZE];
+q7_t sparseScratchIn_q7[BLOCK_SIZE];
+q31_t sparseScratchOut_q7[BLOCK_SIZE];
+q7_t src_q7[BLOCK_SIZE];
+q7_t ref_q7[BLOCK_SIZE];
+q7_t out_q7[BLOCK_SIZE];
+float32_t dctState_f32[2 * DCT_LEN];
+float32_t dctRef_f32[DCT_LEN];
+float32_t dctOut_f32[DCT_LEN];
+
+int32_t main(void)
+{
+  uint32_t i, bytes, scratch;
+  int32_t fail = 0;
+  riscv_dsp_arena arena, small;
+  riscv_fir_instance_f32 firRef_f32, fir_f32;
+  riscv_fir_instance_q15 firRef_q15, fir_q15;
+  riscv_biquad_casd_df1_inst_q15 biquadRef_q15, biquad_q15;
+  riscv_stft_instance_f32 stft_f32;
+  riscv_mdct_instance_q31 mdct_q31;
+  riscv_fir_sparse_instance_q7 sparse_q7;
+  riscv_dct4_instance_f32 dct4_f32;
+  riscv_rfft_instance_f32 dctRfft_f32;
+  riscv_cfft_radix4_instance_f32 dctCfft_f32;
+  riscv_status status;
+
+  riscv_bench_header();
+
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    firCoeffs_f32[i] = 0.5f / (1.0f + i);
+    firCoeffs_q15[i] = (q15_t) (16384 / (1 + i));
+  }
+  for (i = 0; i < BLOCK_SIZE; i++)
+  {
+    src_f32[i] = sinf(0.3f * i);
+    src_q15[i] = (q15_t) (12000.0f * sinf(0.3f * i));
+    src_q7[i] = (q7_t) (100.0f * sinf(0.3f * i));
+  }
+  for (i = 0; i < FFT_LEN; i++)
+  {
+    stftWindow_f32[i] = 1.0f;
+  }
+  for (i = 0; i < MDCT_LEN; i++)
+  {
+    mdctWindow_q31[i] = 0x5A827980;
+  }
+
+  /* Filters with caller buffers */
+  riscv_fir_init_f32(&firRef_f32, NUM_TAPS, firCoeffs_f32, firState_f32, BLOCK_SIZE);
+  riscv_fir_f32(&firRef_f32, src_f32, ref_f32, BLOCK_SIZE);
+  riscv_fir_init_q15(&firRef_q15, NUM_TAPS, firCoeffs_q15, firState_q15, BLOCK_SIZE);
+  riscv_fir_q15(&firRef_q15, src_q15, ref_q15, BLOCK_SIZE);
+
+  /* Filters from the arena */
+  RISCV_BENCH("riscv_fir_init_arena_f32", "f32", NUM_TAPS,
+    riscv_dsp_arena_init(&arena, arena_mem, sizeof(arena_mem));
+    status = riscv_fir_init_arena_f32(&fir_f32, NUM_TAPS, firCoeffs_f32, BLOCK_SIZE, &arena));
+  fail |= (status != RISCV_MATH_SUCCESS);
+  riscv_fir_init_arena_q15(&fir_q15, NUM_TAPS, firCoeffs_q15, BLOCK_SIZE, &arena);
+  riscv_biquad_cascade_df1_init_arena_q15(&biquad_q15, NUM_STAGES, biquadCoeffs_q15, 1, &arena);
+  riscv_biquad_cascade_df1_init_q15(&biquadRef_q15, NUM_STAGES, biquadCoeffs_q15, biquadState_q15, 1);
+
+  riscv_fir_f32(&fir_f32, src_f32, out_f32, BLOCK_SIZE);
+  riscv_fir_q15(&fir_q15, src_q15, out_q15, BLOCK_SIZE);
+  if((memcmp(out_f32, ref_f32, sizeof(out_f32)) != 0) || (memcmp(out_q15, ref_q15, sizeof(out_q15)) != 0))
+  {
+    fail = 1;
+  }
+  riscv_biquad_cascade_df1_q15(&biquadRef_q15, src_q15, ref_q15, BLOCK_SIZE);
+  riscv_biquad_cascade_df1_q15(&biquad_q15, src_q15, out_q15, BLOCK_SIZE);
+  if(memcmp(out_q15, ref_q15, sizeof(out_q15)) != 0)
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_*_init_arena: %s\n", (fail == 0) ? "equal" : "differ");
+
+  /* Transforms sharing one scratch region */
+  status = riscv_stft_init_arena_f32(&stft_f32, FFT_LEN, FFT_LEN / 2, 1, stftWindow_f32, &arena);
+  fail |= (status != RISCV_MATH_SUCCESS);
+  status = riscv_mdct_init_arena_q31(&mdct_q31, MDCT_LEN, mdctWindow_q31, 1, &arena);
+  fail |= (status != RISCV_MATH_SUCCESS);
+
+  bytes = riscv_fir_get_buffer_size_f32(NUM_TAPS, BLOCK_SIZE)
+        + riscv_fir_get_buffer_size_q15(NUM_TAPS, BLOCK_SIZE)
+        + riscv_biquad_cascade_df1_get_buffer_size_q15(NUM_STAGES)
+        + riscv_stft_get_buffer_size_f32(FFT_LEN)
+        + riscv_mdct_get_buffer_size_q31(MDCT_LEN, 1);
+  scratch = riscv_stft_get_scratch_size_f32(FFT_LEN);
+  if(riscv_mdct_get_scratch_size_q31(MDCT_LEN) > scratch)
+  {
+    scratch = riscv_mdct_get_scratch_size_q31(MDCT_LEN);
+  }
+  if((riscv_dsp_arena_usage(&arena) != (bytes + scratch)) ||
+     ((uint8_t *) stft_f32.pScratch + (FFT_LEN * sizeof(float32_t)) != (uint8_t *) mdct_q31.pScratch + (MDCT_LEN * sizeof(q31_t))))
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_dsp_arena_usage: %s\n", (fail == 0) ? "equal" : "differ");
+
+  /* An arena one byte too small is rejected and left unchanged */
+  riscv_dsp_arena_init(&small, arena_mem, riscv_fir_get_buffer_size_f32(NUM_TAPS, BLOCK_SIZE) - 1u);
+  if((riscv_fir_init_arena_f32(&fir_f32, NUM_TAPS, firCoeffs_f32, BLOCK_SIZE, &small) != RISCV_MATH_LENGTH_ERROR) ||
+     (riscv_stft_init_arena_f32(&stft_f32, FFT_LEN, FFT_LEN, 0, stftWindow_f32, &small) != RISCV_MATH_LENGTH_ERROR) ||
+     (riscv_dsp_arena_usage(&small) != 0u))
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_dsp_arena exhausted: %s\n", (fail == 0) ? "equal" : "differ");
+
+  /* Scratch pool */
+  riscv_dsp_scratch_init(pool_mem, sizeof(pool_mem));
+  riscv_fir_sparse_init_q7(&sparse_q7, SPARSE_TAPS, sparseCoeffs_q7, sparseState_q7, sparseDelay, SPARSE_DELAY, BLOCK_SIZE);
+  riscv_fir_sparse_q7(&sparse_q7, src_q7, ref_q7, sparseScratchIn_q7, sparseScratchOut_q7, BLOCK_SIZE);
+  riscv_fir_sparse_init_q7(&sparse_q7, SPARSE_TAPS, sparseCoeffs_q7, sparseState_q7, sparseDelay, SPARSE_DELAY, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_sparse_q7(pool)", "q7", BLOCK_SIZE,
+    riscv_fir_sparse_init_q7(&sparse_q7, SPARSE_TAPS, sparseCoeffs_q7, sparseState_q7, sparseDelay, SPARSE_DELAY, BLOCK_SIZE);
+    riscv_fir_sparse_q7(&sparse_q7, src_q7, out_q7, NULL, NULL, BLOCK_SIZE));
+  if((memcmp(out_q7, ref_q7, sizeof(out_q7)) != 0) || (riscv_dsp_scratch_mark() != 0u))
+  {
+    fail = 1;
+  }
+
+  riscv_dct4_init_f32(&dct4_f32, &dctRfft_f32, &dctCfft_f32, DCT_LEN, DCT_LEN / 2, 0.125f);
+  memcpy(dctRef_f32, src_f32, sizeof(dctRef_f32) / 2);
+  memcpy(dctRef_f32 + BLOCK_SIZE, src_f32, sizeof(dctRef_f32) / 2);
+  memcpy(dctOut_f32, dctRef_f32, sizeof(dctOut_f32));
+  riscv_dct4_f32(&dct4_f32, dctState_f32, dctRef_f32);
+  riscv_dct4_f32(&dct4_f32, NULL, dctOut_f32);
+  if((memcmp(dctOut_f32, dctRef_f32, sizeof(dctOut_f32)) != 0) || (riscv_dsp_scratch_mark() != 0u) ||
+     (riscv_dsp_scratch_peak() != RISCV_DSP_ARENA_ROUND(2 * DCT_LEN * sizeof(float32_t))))
+  {
+    fail = 1;
+  }
+
+  /* A pool too small for the DCT4 state leaves the buffer untouched */
+  riscv_dsp_scratch_init(pool_mem, 2 * DCT_LEN * sizeof(float32_t) - 8u);
+  memcpy(dctOut_f32, dctRef_f32, sizeof(dctOut_f32));
+  riscv_dct4_f32(&dct4_f32, NULL, dctOut_f32);
+  if(memcmp(dctOut_f32, dctRef_f32, sizeof(dctOut_f32)) != 0)
+  {
+    fail = 1;
+  }
+  riscv_dsp_scratch_init(NULL, 0u);
+  printf("CHECK riscv_dsp_scratch pool: %s\n", (fail == 0) ? "equal" : "differ");
+#ifdef PRINT_OUTPUT
+  printf("arena bytes %d\n", (int) riscv_dsp_arena_usage(&arena));
+#endif
+
+  printf("End\n");
+
+  return fail;
+}
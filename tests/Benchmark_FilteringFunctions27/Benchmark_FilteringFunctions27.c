@@ -0,0 +1,190 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_TAPS 16
+#define NUM_STAGES 2
+#define BLOCK_SIZE 32
+#define NUM_BLOCKS 6
+#define FADE_LENGTH 48
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*After a swap without crossfade the filters must output what a filter whose coefficient pointer is
+changed at the block boundary outputs, during a FIR crossfade the output must be the FIR with linearly
+interpolated coefficients, and after a crossfade the outputs must be those of the new coefficients.
+The CHECK lines must report equal.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions27"
+#include "../common/riscv_bench.h"
+
+float32_t firBankA_f32[NUM_TAPS], firBankB_f32[NUM_TAPS];
+float32_t firState_f32[NUM_TAPS + BLOCK_SIZE - 1];
+float32_t firRefState_f32[NUM_TAPS + BLOCK_SIZE - 1];
+float32_t firFadeState_f32[NUM_TAPS + BLOCK_SIZE - 1];
+q15_t firBankA_q15[NUM_TAPS], firBankB_q15[NUM_TAPS];
+q15_t firState_q15[NUM_TAPS + BLOCK_SIZE];
+q15_t firRefState_q15[NUM_TAPS + BLOCK_SIZE];
+q15_t firFadeState_q15[NUM_TAPS + BLOCK_SIZE];
+float32_t biquadBankA_f32[5 * NUM_STAGES] = {
+  0.2f, 0.4f, 0.2f, 0.9f, -0.3f,
+  0.5f, -0.2f, 0.1f, 0.4f, -0.2f };
+float32_t biquadBankB_f32[5 * NUM_STAGES] = {
+  0.1f, 0.3f, 0.1f, 1.1f, -0.5f,
+  0.6f, 0.1f, -0.2f, -0.3f, -0.1f };
+float32_t biquadState_f32[2 * NUM_STAGES];
+float32_t biquadRefState_f32[2 * NUM_STAGES];
+float32_t biquadFadeState_f32[2 * NUM_STAGES];
+float32_t src_f32[NUM_BLOCKS * BLOCK_SIZE];
+float32_t out_f32[NUM_BLOCKS * BLOCK_SIZE];
+float32_t ref_f32[NUM_BLOCKS * BLOCK_SIZE];
+float32_t fadeOut_f32[BLOCK_SIZE];
+q15_t src_q15[NUM_BLOCKS * BLOCK_SIZE];
+q15_t out_q15[NUM_BLOCKS * BLOCK_SIZE];
+q15_t ref_q15[NUM_BLOCKS * BLOCK_SIZE];
+q15_t fadeOut_q15[BLOCK_SIZE];
+
+int32_t main(void)
+{
+  uint32_t i, b, k;
+  int32_t fail = 0;
+  float32_t g, acc;
+  riscv_fir_instance_f32 fir_f32, firRef_f32;
+  riscv_fir_instance_q15 fir_q15, firRef_q15;
+  riscv_biquad_cascade_df2T_instance_f32 biquad_f32, biquadRef_f32;
+  riscv_coeff_swap_instance swap;
+  float32_t *pEdit;
+
+  riscv_bench_header();
+
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    firBankA_f32[i] = 0.25f / (1.0f + i);
+    firBankB_f32[i] = ((i & 1u) != 0u) ? -0.05f : 0.08f;
+    firBankA_q15[i] = (q15_t) (firBankA_f32[i] * 32768.0f);
+    firBankB_q15[i] = (q15_t) (firBankB_f32[i] * 32768.0f);
+  }
+  for (i = 0; i < NUM_BLOCKS * BLOCK_SIZE; i++)
+  {
+    src_f32[i] = sinf(0.21f * i) + 0.5f * cosf(0.05f * i);
+    src_q15[i] = (q15_t) (src_f32[i] * 16000.0f);
+  }
+
+  /* Cost of a block without pending swap */
+  riscv_fir_init_f32(&fir_f32, NUM_TAPS, firBankA_f32, firState_f32, BLOCK_SIZE);
+  riscv_coeff_swap_init(&swap, firBankA_f32, firBankB_f32, 0u, NULL, NULL);
+  RISCV_BENCH("riscv_fir_swap_f32", "f32", BLOCK_SIZE,
+    riscv_fir_swap_f32(&fir_f32, &swap, src_f32, out_f32, BLOCK_SIZE));
+
+  /* FIR, swap without crossfade at block 2 */
+  riscv_fir_init_f32(&firRef_f32, NUM_TAPS, firBankA_f32, firRefState_f32, BLOCK_SIZE);
+  riscv_fir_init_f32(&fir_f32, NUM_TAPS, firBankA_f32, firState_f32, BLOCK_SIZE);
+  riscv_coeff_swap_init(&swap, firBankA_f32, firBankB_f32, 0u, NULL, NULL);
+  for (b = 0; b < NUM_BLOCKS; b++)
+  {
+    if(b == 2u)
+    {
+      pEdit = (float32_t *) riscv_coeff_swap_edit(&swap);
+      fail |= (pEdit != firBankB_f32);
+      riscv_coeff_swap_publish(&swap);
+      fail |= (riscv_coeff_swap_edit(&swap) != NULL);
+      firRef_f32.pCoeffs = firBankB_f32;
+    }
+    riscv_fir_swap_f32(&fir_f32, &swap, src_f32 + b * BLOCK_SIZE, out_f32 + b * BLOCK_SIZE, BLOCK_SIZE);
+    riscv_fir_f32(&firRef_f32, src_f32 + b * BLOCK_SIZE, ref_f32 + b * BLOCK_SIZE, BLOCK_SIZE);
+  }
+  if((memcmp(out_f32, ref_f32, sizeof(out_f32)) != 0) || (riscv_coeff_swap_edit(&swap) != firBankA_f32))
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_fir_swap_f32: %s\n", (fail == 0) ? "equal" : "differ");
+
+  /* FIR, crossfade over FADE_LENGTH samples from block 1, equal to interpolated coefficients */
+  riscv_fir_init_f32(&fir_f32, NUM_TAPS, firBankA_f32, firState_f32, BLOCK_SIZE);
+  riscv_coeff_swap_init(&swap, firBankA_f32, firBankB_f32, FADE_LENGTH, firFadeState_f32, fadeOut_f32);
+  for (b = 0; b < NUM_BLOCKS; b++)
+  {
+    if(b == 1u)
+    {
+      riscv_coeff_swap_publish(&swap);
+    }
+    riscv_fir_swap_f32(&fir_f32, &swap, src_f32 + b * BLOCK_SIZE, out_f32 + b * BLOCK_SIZE, BLOCK_SIZE);
+    if(b == 1u)
+    {
+      fail |= (riscv_coeff_swap_edit(&swap) != NULL);
+    }
+  }
+  for (i = 0; i < NUM_BLOCKS * BLOCK_SIZE; i++)
+  {
+    g = (i < BLOCK_SIZE) ? 0.0f : (i >= BLOCK_SIZE + FADE_LENGTH) ? 1.0f : (float32_t) (i - BLOCK_SIZE + 1) / FADE_LENGTH;
+    for (k = 0, acc = 0.0f; (k < NUM_TAPS) && (k <= i); k++)
+    {
+      acc += ((1.0f - g) * firBankA_f32[NUM_TAPS - 1u - k] + g * firBankB_f32[NUM_TAPS - 1u - k]) * src_f32[i - k];
+    }
+    if(fabsf(acc - out_f32[i]) > 1e-5f)
+    {
+      fail = 1;
+    }
+  }
+  printf("CHECK riscv_fir_swap_f32(crossfade): %s\n", (fail == 0) ? "equal" : "differ");
+
+  /* Q15 FIR, crossfade from block 1, equal to the new coefficients once it ends */
+  riscv_fir_init_q15(&fir_q15, NUM_TAPS, firBankA_q15, firState_q15, BLOCK_SIZE);
+  riscv_fir_init_q15(&firRef_q15, NUM_TAPS, firBankB_q15, firRefState_q15, BLOCK_SIZE);
+  riscv_coeff_swap_init(&swap, firBankA_q15, firBankB_q15, FADE_LENGTH, firFadeState_q15, fadeOut_q15);
+  for (b = 0; b < NUM_BLOCKS; b++)
+  {
+    if(b == 1u)
+    {
+      riscv_coeff_swap_publish(&swap);
+    }
+    riscv_fir_swap_q15(&fir_q15, &swap, src_q15 + b * BLOCK_SIZE, out_q15 + b * BLOCK_SIZE, BLOCK_SIZE);
+    riscv_fir_q15(&firRef_q15, src_q15 + b * BLOCK_SIZE, ref_q15 + b * BLOCK_SIZE, BLOCK_SIZE);
+  }
+  if(memcmp(out_q15 + BLOCK_SIZE + FADE_LENGTH, ref_q15 + BLOCK_SIZE + FADE_LENGTH,
+            (NUM_BLOCKS * BLOCK_SIZE - BLOCK_SIZE - FADE_LENGTH) * sizeof(q15_t)) != 0)
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_fir_swap_q15(crossfade): %s\n", (fail == 0) ? "equal" : "differ");
+
+  /* Biquad, crossfade from block 2, the state carries over to the new coefficients */
+  riscv_biquad_cascade_df2T_init_f32(&biquad_f32, NUM_STAGES, biquadBankA_f32, biquadState_f32);
+  riscv_biquad_cascade_df2T_init_f32(&biquadRef_f32, NUM_STAGES, biquadBankA_f32, biquadRefState_f32);
+  riscv_coeff_swap_init(&swap, biquadBankA_f32, biquadBankB_f32, FADE_LENGTH, biquadFadeState_f32, fadeOut_f32);
+  for (b = 0; b < NUM_BLOCKS; b++)
+  {
+    if(b == 2u)
+    {
+      riscv_coeff_swap_publish(&swap);
+      biquadRef_f32.pCoeffs = biquadBankB_f32;
+    }
+    riscv_biquad_cascade_df2T_swap_f32(&biquad_f32, &swap, src_f32 + b * BLOCK_SIZE, out_f32 + b * BLOCK_SIZE, BLOCK_SIZE);
+    riscv_biquad_cascade_df2T_f32(&biquadRef_f32, src_f32 + b * BLOCK_SIZE, ref_f32 + b * BLOCK_SIZE, BLOCK_SIZE);
+  }
+  if((memcmp(out_f32, ref_f32, 2 * BLOCK_SIZE * sizeof(float32_t)) != 0) ||
+     (memcmp(out_f32 + 2 * BLOCK_SIZE + FADE_LENGTH, ref_f32 + 2 * BLOCK_SIZE + FADE_LENGTH,
+             (NUM_BLOCKS * BLOCK_SIZE - 2 * BLOCK_SIZE - FADE_LENGTH) * sizeof(float32_t)) != 0))
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_biquad_cascade_df2T_swap_f32: %s\n", (fail == 0) ? "equal" : "differ");
+#ifdef PRINT_OUTPUT
+  for(i = 0 ; i < NUM_BLOCKS * BLOCK_SIZE ; i++)
+    {
+      printf("%d %d\n",(int)(out_f32[i]*1000),(int)(ref_f32[i]*1000));
+    }
+#endif
+
+  printf("End\n");
+
+  return fail;
+}
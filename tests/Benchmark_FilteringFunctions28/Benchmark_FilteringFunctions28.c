@@ -0,0 +1,143 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_SAMPLES 512
+#define BENCH_SIZE 256
+#define LOOKAHEAD 8
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The limiter must keep the output below its threshold and pass quiet input unchanged but delayed, the
+compressor and the AGC must settle on a constant input at the level of their static curves.
+The CHECK lines must report equal.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions28"
+#include "../common/riscv_bench.h"
+
+float32_t src_f32[NUM_SAMPLES];
+float32_t out_f32[NUM_SAMPLES];
+float32_t delay_f32[LOOKAHEAD];
+q15_t src_q15[NUM_SAMPLES];
+q15_t out_q15[NUM_SAMPLES];
+q15_t delay_q15[LOOKAHEAD];
+
+int32_t main(void)
+{
+  uint32_t i;
+  int32_t fail = 0;
+  float32_t peak;
+  riscv_dynamics_instance_f32 dyn_f32;
+  riscv_dynamics_instance_q15 dyn_q15;
+
+  riscv_bench_header();
+
+  /* Quiet tone with a loud burst in the middle */
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    src_f32[i] = ((i >= 200u) && (i < 320u) ? 0.95f : 0.2f) * sinf(0.37f * i);
+    src_q15[i] = (q15_t) (src_f32[i] * 32767.0f);
+  }
+
+  /* Peak limiter with lookahead */
+  riscv_dynamics_init_f32(&dyn_f32, RISCV_DYNAMICS_PEAK, 0.5f, 0.0f, 1.0f, 1.0f, 0.0f, 2000.0f, LOOKAHEAD, delay_f32);
+  RISCV_BENCH("riscv_dynamics_f32", "f32", BENCH_SIZE,
+    riscv_dynamics_f32(&dyn_f32, src_f32, out_f32, BENCH_SIZE));
+  riscv_dynamics_init_q15(&dyn_q15, RISCV_DYNAMICS_PEAK, 0.5f, 0.0f, 1.0f, 1.0f, 0.0f, 2000.0f, LOOKAHEAD, delay_q15);
+  RISCV_BENCH("riscv_dynamics_q15", "q15", BENCH_SIZE,
+    riscv_dynamics_q15(&dyn_q15, src_q15, out_q15, BENCH_SIZE));
+
+  /* Limiter: output below the threshold, quiet input only delayed */
+  riscv_dynamics_init_f32(&dyn_f32, RISCV_DYNAMICS_PEAK, 0.5f, 0.0f, 1.0f, 1.0f, 0.0f, 2000.0f, LOOKAHEAD, delay_f32);
+  riscv_dynamics_f32(&dyn_f32, src_f32, out_f32, NUM_SAMPLES);
+  for (i = 0, peak = 0.0f; i < NUM_SAMPLES; i++)
+  {
+    peak = (fabsf(out_f32[i]) > peak) ? fabsf(out_f32[i]) : peak;
+  }
+  for (i = 0; i < 192u; i++)
+  {
+    if(fabsf(out_f32[i] - ((i < LOOKAHEAD) ? 0.0f : src_f32[i - LOOKAHEAD])) > 1e-5f)
+    {
+      fail = 1;
+    }
+  }
+  if((peak > 0.505f) || (peak < 0.45f))
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_dynamics_f32(limiter): %s\n", (fail == 0) ? "equal" : "differ");
+
+  riscv_dynamics_init_q15(&dyn_q15, RISCV_DYNAMICS_PEAK, 0.5f, 0.0f, 1.0f, 1.0f, 0.0f, 2000.0f, LOOKAHEAD, delay_q15);
+  riscv_dynamics_q15(&dyn_q15, src_q15, out_q15, NUM_SAMPLES);
+  for (i = 0, peak = 0.0f; i < NUM_SAMPLES; i++)
+  {
+    peak = (fabsf(out_q15[i] / 32768.0f) > peak) ? fabsf(out_q15[i] / 32768.0f) : peak;
+  }
+  for (i = 0; i < 192u; i++)
+  {
+    if(abs(out_q15[i] - ((i < LOOKAHEAD) ? 0 : src_q15[i - LOOKAHEAD])) > 2)
+    {
+      fail = 1;
+    }
+  }
+  if((peak > 0.505f) || (peak < 0.45f))
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_dynamics_q15(limiter): %s\n", (fail == 0) ? "equal" : "differ");
+
+  /* Compressor 4:1 above 0.2, a constant 0.8 settles at 0.2 * 4^(1/4) */
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    src_f32[i] = 0.8f;
+    src_q15[i] = (q15_t) (0.8f * 32768.0f);
+  }
+  riscv_dynamics_init_f32(&dyn_f32, RISCV_DYNAMICS_RMS, 0.2f, 4.0f, 1.0f, 1.0f, 16.0f, 64.0f, 0u, NULL);
+  riscv_dynamics_f32(&dyn_f32, src_f32, out_f32, NUM_SAMPLES);
+  riscv_dynamics_init_q15(&dyn_q15, RISCV_DYNAMICS_RMS, 0.2f, 4.0f, 1.0f, 1.0f, 16.0f, 64.0f, 0u, NULL);
+  riscv_dynamics_q15(&dyn_q15, src_q15, out_q15, NUM_SAMPLES);
+  if((fabsf(out_f32[NUM_SAMPLES - 1u] - 0.28284f) > 0.003f) ||
+     (fabsf(out_q15[NUM_SAMPLES - 1u] / 32768.0f - 0.28284f) > 0.003f))
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_dynamics(compressor): %s\n", (fail == 0) ? "equal" : "differ");
+
+  /* AGC to 0.25 with at most 40 dB of gain: 0.02 settles at 0.25, 0.001 at 0.1 */
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    src_f32[i] = (i < NUM_SAMPLES / 2u) ? 0.02f : 0.001f;
+    src_q15[i] = (q15_t) (src_f32[i] * 32768.0f);
+  }
+  riscv_dynamics_init_f32(&dyn_f32, RISCV_DYNAMICS_PEAK, 0.25f, 0.0f, 100.0f, 1.0f, 16.0f, 16.0f, 0u, NULL);
+  riscv_dynamics_f32(&dyn_f32, src_f32, out_f32, NUM_SAMPLES);
+  riscv_dynamics_init_q15(&dyn_q15, RISCV_DYNAMICS_PEAK, 0.25f, 0.0f, 100.0f, 1.0f, 16.0f, 16.0f, 0u, NULL);
+  riscv_dynamics_q15(&dyn_q15, src_q15, out_q15, NUM_SAMPLES);
+  if((fabsf(out_f32[NUM_SAMPLES / 2u - 1u] - 0.25f) > 0.0025f) || (fabsf(out_f32[NUM_SAMPLES - 1u] - 0.1f) > 0.001f) ||
+     (fabsf(out_q15[NUM_SAMPLES / 2u - 1u] / 32768.0f - 0.25f) > 0.005f) ||
+     (fabsf(out_q15[NUM_SAMPLES - 1u] / 32768.0f - 0.1f) > 0.005f))
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_dynamics(agc): %s\n", (fail == 0) ? "equal" : "differ");
+
+  /* Invalid parameters */
+  if((riscv_dynamics_init_f32(&dyn_f32, RISCV_DYNAMICS_PEAK, 0.5f, 0.5f, 1.0f, 1.0f, 0.0f, 0.0f, 0u, NULL) != RISCV_MATH_ARGUMENT_ERROR) ||
+     (riscv_dynamics_init_q15(&dyn_q15, RISCV_DYNAMICS_PEAK, 0.5f, 0.0f, 300.0f, 1.0f, 0.0f, 0.0f, 0u, NULL) != RISCV_MATH_ARGUMENT_ERROR) ||
+     (riscv_dynamics_init_q15(&dyn_q15, RISCV_DYNAMICS_PEAK, 0.5f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, LOOKAHEAD, NULL) != RISCV_MATH_ARGUMENT_ERROR))
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_dynamics_init: %s\n", (fail == 0) ? "equal" : "differ");
+
+  return fail;
+}
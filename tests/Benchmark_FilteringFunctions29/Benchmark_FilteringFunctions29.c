@@ -0,0 +1,155 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 64
+#define NUM_BLOCKS 4
+#define LINE_LENGTH 96
+#define NUM_TAPS 4
+#define OMEGA 0.1f
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A slow sine runs through the delay lines block by block, integer taps must return the delayed input
+unchanged and fractional, ramped and summed taps the sine at the delayed times within the accuracy of
+cubic interpolation.  The CHECK lines must report equal.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions29"
+#include "../common/riscv_bench.h"
+
+float32_t state_f32[2 * LINE_LENGTH];
+q15_t state_q15[2 * LINE_LENGTH] __attribute__((aligned(4)));
+float32_t src_f32[NUM_BLOCKS * BLOCK_SIZE], out_f32[NUM_BLOCKS * BLOCK_SIZE];
+q15_t src_q15[NUM_BLOCKS * BLOCK_SIZE], out_q15[NUM_BLOCKS * BLOCK_SIZE];
+
+/* Runs the f32 and Q15 lines over the whole signal with the taps given in samples */
+static void run_taps(
+  const float32_t * pDelay,
+  const float32_t * pTarget,
+  const float32_t * pGain,
+  uint16_t numTaps)
+{
+  riscv_delay_line_instance_f32 S_f32;
+  riscv_delay_line_instance_q15 S_q15;
+  riscv_delay_line_tap_f32 taps_f32[NUM_TAPS];
+  riscv_delay_line_tap_q15 taps_q15[NUM_TAPS];
+  uint32_t b, t;
+
+  riscv_delay_line_init_f32(&S_f32, LINE_LENGTH, state_f32);
+  riscv_delay_line_init_q15(&S_q15, LINE_LENGTH, state_q15);
+
+  for (b = 0; b < NUM_BLOCKS; b++)
+  {
+    /* The taps ramp during block 1 only */
+    for (t = 0; t < numTaps; t++)
+    {
+      taps_f32[t].delay = (b <= 1u) ? pDelay[t] : pTarget[t];
+      taps_f32[t].target = (b == 0u) ? pDelay[t] : pTarget[t];
+      taps_f32[t].gain = pGain[t];
+      taps_q15[t].delay = (q31_t) (taps_f32[t].delay * 32768.0f);
+      taps_q15[t].target = (q31_t) (taps_f32[t].target * 32768.0f);
+      taps_q15[t].gain = (q15_t) (pGain[t] * 32767.0f);
+    }
+    riscv_delay_line_write_f32(&S_f32, src_f32 + b * BLOCK_SIZE, BLOCK_SIZE);
+    riscv_delay_line_read_f32(&S_f32, taps_f32, numTaps, out_f32 + b * BLOCK_SIZE, BLOCK_SIZE);
+    riscv_delay_line_write_q15(&S_q15, src_q15 + b * BLOCK_SIZE, BLOCK_SIZE);
+    riscv_delay_line_read_q15(&S_q15, taps_q15, numTaps, out_q15 + b * BLOCK_SIZE, BLOCK_SIZE);
+  }
+}
+
+/* Largest error against the sine at the delayed times, from block 1 on */
+static float32_t max_error(
+  const float32_t * pDelay,
+  const float32_t * pTarget,
+  const float32_t * pGain,
+  uint16_t numTaps,
+  float32_t * pErrQ15)
+{
+  float32_t d, ref, err = 0.0f;
+  uint32_t i, t;
+
+  *pErrQ15 = 0.0f;
+  for (i = BLOCK_SIZE; i < NUM_BLOCKS * BLOCK_SIZE; i++)
+  {
+    for (t = 0, ref = 0.0f; t < numTaps; t++)
+    {
+      d = (i < 2u * BLOCK_SIZE) ? pDelay[t] + (pTarget[t] - pDelay[t]) * (i - BLOCK_SIZE) / BLOCK_SIZE : pTarget[t];
+      ref += pGain[t] * 0.5f * sinf(OMEGA * ((float32_t) i - d));
+    }
+    err = (fabsf(out_f32[i] - ref) > err) ? fabsf(out_f32[i] - ref) : err;
+    *pErrQ15 = (fabsf(out_q15[i] / 32768.0f - ref) > *pErrQ15) ? fabsf(out_q15[i] / 32768.0f - ref) : *pErrQ15;
+  }
+  return (err);
+}
+
+int32_t main(void)
+{
+  uint32_t i;
+  int32_t fail = 0;
+  float32_t err, errQ15;
+  riscv_delay_line_instance_f32 S_f32;
+  riscv_delay_line_instance_q15 S_q15;
+  riscv_delay_line_tap_f32 taps_f32[NUM_TAPS] = { { 4.25f, 4.25f, 0.25f }, { 9.5f, 9.5f, 0.25f }, { 17.75f, 17.75f, 0.25f }, { 30.1f, 30.1f, 0.25f } };
+  riscv_delay_line_tap_q15 taps_q15[NUM_TAPS] = { { 139264, 139264, 8192 }, { 311296, 311296, 8192 }, { 581632, 581632, 8192 }, { 986317, 986317, 8192 } };
+  const float32_t intDelay[1] = { 5.0f }, fracDelay[1] = { 7.3f }, rampStart[1] = { 3.0f }, rampEnd[1] = { 11.0f };
+  const float32_t sumDelay[2] = { 4.25f, 9.75f }, gain1[1] = { 1.0f }, gain2[2] = { 0.5f, 0.5f };
+
+  riscv_bench_header();
+
+  for (i = 0; i < NUM_BLOCKS * BLOCK_SIZE; i++)
+  {
+    src_f32[i] = 0.5f * sinf(OMEGA * i);
+    src_q15[i] = (q15_t) (src_f32[i] * 32768.0f);
+  }
+
+  /* Four taps of a block */
+  riscv_delay_line_init_f32(&S_f32, LINE_LENGTH, state_f32);
+  riscv_delay_line_write_f32(&S_f32, src_f32, BLOCK_SIZE);
+  RISCV_BENCH("riscv_delay_line_read_f32", "f32", BLOCK_SIZE,
+    riscv_delay_line_read_f32(&S_f32, taps_f32, NUM_TAPS, out_f32, BLOCK_SIZE));
+  riscv_delay_line_init_q15(&S_q15, LINE_LENGTH, state_q15);
+  riscv_delay_line_write_q15(&S_q15, src_q15, BLOCK_SIZE);
+  RISCV_BENCH("riscv_delay_line_read_q15", "q15", BLOCK_SIZE,
+    riscv_delay_line_read_q15(&S_q15, taps_q15, NUM_TAPS, out_q15, BLOCK_SIZE));
+
+  /* An integer delay returns the input unchanged, Q15 within the rounding of the unit gain */
+  run_taps(intDelay, intDelay, gain1, 1u);
+  for (i = 0; i < NUM_BLOCKS * BLOCK_SIZE; i++)
+  {
+    if((out_f32[i] != ((i < 5u) ? 0.0f : src_f32[i - 5u])) ||
+       (abs(out_q15[i] - ((i < 5u) ? 0 : src_q15[i - 5u])) > 1))
+    {
+      fail = 1;
+    }
+  }
+  printf("CHECK riscv_delay_line_read(integer): %s\n", (fail == 0) ? "equal" : "differ");
+
+  /* A fractional delay */
+  run_taps(fracDelay, fracDelay, gain1, 1u);
+  err = max_error(fracDelay, fracDelay, gain1, 1u, &errQ15);
+  fail |= (err > 1e-4f) || (errQ15 > 3e-4f);
+  printf("CHECK riscv_delay_line_read(fractional): %s\n", (fail == 0) ? "equal" : "differ");
+
+  /* A delay ramped from 3 to 11 samples over block 1 */
+  run_taps(rampStart, rampEnd, gain1, 1u);
+  err = max_error(rampStart, rampEnd, gain1, 1u, &errQ15);
+  fail |= (err > 1e-4f) || (errQ15 > 3e-4f);
+  printf("CHECK riscv_delay_line_read(ramp): %s\n", (fail == 0) ? "equal" : "differ");
+
+  /* Delay and sum of two fractional taps */
+  run_taps(sumDelay, sumDelay, gain2, 2u);
+  err = max_error(sumDelay, sumDelay, gain2, 2u, &errQ15);
+  fail |= (err > 1e-4f) || (errQ15 > 3e-4f);
+  printf("CHECK riscv_delay_line_read(sum): %s\n", (fail == 0) ? "equal" : "differ");
+
+  return fail;
+}
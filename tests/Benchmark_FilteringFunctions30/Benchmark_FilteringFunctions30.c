@@ -0,0 +1,199 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define FRAME_LEN 240
+#define ORDER 10
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A frame of an AR(4) process is analyzed at order 10.  The autocorrelations of all types must match a
+double-precision reference at lags 0 to 10, and the reflection coefficients of the three Levinson-Durbin
+recursions the double-precision recursion on the same lags.  The Q15 coefficients then whiten the
+frame through riscv_fir_lattice_q15(), and the f32 ones run the analysis and the all-pole synthesis
+through the FIR and IIR lattice filters, which must return the frame.  An autocorrelation that is not
+positive definite must be reported singular.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions30"
+#include "../common/riscv_bench.h"
+
+float32_t x_f32[FRAME_LEN], e_f32[FRAME_LEN], y_f32[FRAME_LEN];
+q15_t x_q15[FRAME_LEN] __attribute__((aligned(4))), e_q15[FRAME_LEN];
+q31_t x_q31[FRAME_LEN];
+q15_t corr_q15[2 * FRAME_LEN - 1];
+float32_t r_f32[ORDER + 1], k_f32[ORDER], a_f32[ORDER], err_f32;
+q31_t r_q15[ORDER + 1], r_q31[ORDER + 1], a_q31[ORDER], k_q31[ORDER], err_q31;
+q15_t k_q15[ORDER];
+float32_t kRev_f32[ORDER], v_f32[ORDER + 1], state_f32[ORDER + FRAME_LEN];
+q15_t state_q15[ORDER];
+
+/* Autocorrelation in double precision */
+static void ref_autocorr(const double * pX, double * pR)
+{
+  uint32_t l, n;
+
+  for (l = 0; l <= ORDER; l++)
+  {
+    for (n = l, pR[l] = 0.0; n < FRAME_LEN; n++)
+    {
+      pR[l] += pX[n] * pX[n - l];
+    }
+  }
+}
+
+/* Reflection coefficients in double precision */
+static void ref_levinson(const double * pR, double * pK)
+{
+  double a[ORDER], t[ORDER], err = pR[0], acc;
+  uint32_t m, i;
+
+  for (m = 0; m < ORDER; m++)
+  {
+    for (i = 0, acc = pR[m + 1]; i < m; i++)
+    {
+      acc += a[i] * pR[m - i];
+    }
+    pK[m] = -acc / err;
+    for (i = 0; i < m; i++)
+    {
+      t[i] = a[i] + pK[m] * a[m - 1 - i];
+    }
+    memcpy(a, t, m * sizeof(double));
+    a[m] = pK[m];
+    err *= 1.0 - pK[m] * pK[m];
+  }
+}
+
+int32_t main(void)
+{
+  static const double ar[4] = { 2.0933, -2.5674, 1.7471, -0.7310 };
+  double xd[FRAME_LEN], rd[ORDER + 1], kd[ORDER], sx = 0.0, se = 0.0;
+  float32_t errR, errK, errQ15, errQ31, errK15, errK31, errY, scale;
+  uint32_t seed = 12345u, n, i;
+  int32_t fail = 0, shift15, shift31, ok;
+  riscv_status st;
+  riscv_fir_lattice_instance_q15 Sfir_q15;
+  riscv_fir_lattice_instance_f32 Sfir_f32;
+  riscv_iir_lattice_instance_f32 Siir_f32;
+
+  riscv_bench_header();
+
+  /* Resonances at 0.1 and 0.2 of the sample rate, pole radii 0.95 and 0.9 */
+  for (n = 0; n < FRAME_LEN; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    xd[n] = ((double) (seed >> 8) / 16777216.0 - 0.5) * 0.004;
+    for (i = 0; i < 4u && i < n; i++)
+    {
+      xd[n] += ar[i] * xd[n - 1 - i];
+    }
+  }
+  for (n = 0; n < FRAME_LEN; n++)
+  {
+    x_q15[n] = (q15_t) lrint(xd[n] * 32768.0);
+    xd[n] = x_q15[n] / 32768.0;
+    x_f32[n] = (float32_t) xd[n];
+    x_q31[n] = (q31_t) x_q15[n] << 16;
+  }
+
+  RISCV_BENCH("riscv_autocorr_f32", "f32", FRAME_LEN, riscv_autocorr_f32(x_f32, FRAME_LEN, r_f32, ORDER));
+  RISCV_BENCH("riscv_autocorr_q15", "q15", FRAME_LEN, shift15 = riscv_autocorr_q15(x_q15, FRAME_LEN, r_q15, ORDER));
+  RISCV_BENCH("riscv_autocorr_q31", "q31", FRAME_LEN, shift31 = riscv_autocorr_q31(x_q31, FRAME_LEN, r_q31, ORDER));
+  RISCV_BENCH("riscv_correlate_q15", "q15", FRAME_LEN, riscv_correlate_q15(x_q15, FRAME_LEN, x_q15, FRAME_LEN, corr_q15));
+  RISCV_BENCH("riscv_levinson_durbin_f32", "f32", ORDER, riscv_levinson_durbin_f32(r_f32, ORDER, k_f32, a_f32, &err_f32));
+  RISCV_BENCH("riscv_levinson_durbin_q15", "q15", ORDER, riscv_levinson_durbin_q15(r_q15, ORDER, k_q15, a_q31, &err_q31));
+  RISCV_BENCH("riscv_levinson_durbin_q31", "q31", ORDER, riscv_levinson_durbin_q31(r_q31, ORDER, k_q31, a_q31, &err_q31));
+
+  /* Lags relative to lag 0 */
+  ref_autocorr(xd, rd);
+  ref_levinson(rd, kd);
+  errR = 0.0f;
+  errQ15 = 0.0f;
+  errQ31 = 0.0f;
+  for (i = 0; i <= ORDER; i++)
+  {
+    errR = fmaxf(errR, (float32_t) fabs(r_f32[i] - rd[i]) / (float32_t) rd[0]);
+    errQ15 = fmaxf(errQ15, (float32_t) fabs(ldexp(r_q15[i] / 2147483648.0, -shift15) - rd[i]) / (float32_t) rd[0]);
+    errQ31 = fmaxf(errQ31, (float32_t) fabs(ldexp(r_q31[i] / 2147483648.0, -shift31) - rd[i]) / (float32_t) rd[0]);
+  }
+  ok = (errR < 1e-6f) && (errQ15 < 1e-8f) && (errQ31 < 1e-8f) && (r_q15[0] >= 0x40000000) && (r_q31[0] >= 0x40000000);
+  printf("CHECK riscv_autocorr: f32 %d, q15 %d, q31 %d (1e-9) %s\n", (int) (errR * 1e9f), (int) (errQ15 * 1e9f),
+         (int) (errQ31 * 1e9f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Reflection coefficients */
+  st = riscv_levinson_durbin_f32(r_f32, ORDER, k_f32, a_f32, &err_f32);
+  ok = (st == RISCV_MATH_SUCCESS);
+  st = riscv_levinson_durbin_q15(r_q15, ORDER, k_q15, a_q31, &err_q31);
+  ok = ok && (st == RISCV_MATH_SUCCESS);
+  st = riscv_levinson_durbin_q31(r_q31, ORDER, k_q31, a_q31, &err_q31);
+  ok = ok && (st == RISCV_MATH_SUCCESS);
+  errK = 0.0f;
+  errK15 = 0.0f;
+  errK31 = 0.0f;
+  for (i = 0; i < ORDER; i++)
+  {
+    errK = fmaxf(errK, (float32_t) fabs(k_f32[i] - kd[i]));
+    errK15 = fmaxf(errK15, (float32_t) fabs(k_q15[i] - kd[i] * 32768.0));
+    errK31 = fmaxf(errK31, (float32_t) fabs(k_q31[i] / 2147483648.0 - kd[i]));
+  }
+  ok = ok && (errK < 1e-4f) && (errK15 <= 1.0f) && (errK31 < 1e-6f);
+  printf("CHECK riscv_levinson_durbin: f32 %d (1e-6), q15 %d (1e-3 LSB), q31 %d (1e-9) %s\n",
+         (int) (errK * 1e6f), (int) (errK15 * 1e3f), (int) (errK31 * 1e9f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Prediction error of the Q15 lattice, about the energy the recursion predicts */
+  riscv_fir_lattice_init_q15(&Sfir_q15, ORDER, k_q15, state_q15);
+  riscv_fir_lattice_q15(&Sfir_q15, x_q15, e_q15, FRAME_LEN);
+  for (n = 0; n < FRAME_LEN; n++)
+  {
+    sx += (double) x_q15[n] * x_q15[n];
+    se += (double) e_q15[n] * e_q15[n];
+  }
+  scale = (float32_t) (err_q31 / (double) r_q31[0]);
+  ok = (se < 0.1 * sx) && (fabs(se / sx - scale) < 0.2 * scale);
+  printf("CHECK riscv_fir_lattice_q15: prediction gain %d dB, predicted %d dB %s\n", (int) (10.0 * log10(sx / se)),
+         (int) (-10.0 * log10(scale)), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Analysis and all-pole synthesis with the f32 coefficients */
+  riscv_fir_lattice_init_f32(&Sfir_f32, ORDER, k_f32, state_f32);
+  riscv_fir_lattice_f32(&Sfir_f32, x_f32, e_f32, FRAME_LEN);
+  for (i = 0; i < ORDER; i++)
+  {
+    kRev_f32[i] = k_f32[ORDER - 1 - i];
+    v_f32[i] = 0.0f;
+  }
+  v_f32[ORDER] = 1.0f;
+  riscv_iir_lattice_init_f32(&Siir_f32, ORDER, kRev_f32, v_f32, state_f32, FRAME_LEN);
+  riscv_iir_lattice_f32(&Siir_f32, e_f32, y_f32, FRAME_LEN);
+  for (n = 0, errY = 0.0f; n < FRAME_LEN; n++)
+  {
+    errY = fmaxf(errY, fabsf(y_f32[n] - x_f32[n]));
+  }
+  ok = (errY < 1e-4f);
+  printf("CHECK riscv_iir_lattice_f32: synthesis error %d (1e-9) %s\n", (int) (errY * 1e9f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* A sequence that is predicted exactly */
+  for (i = 0; i <= ORDER; i++)
+  {
+    r_f32[i] = 1.0f;
+    r_q31[i] = 0x40000000;
+  }
+  ok = (riscv_levinson_durbin_f32(r_f32, ORDER, k_f32, a_f32, &err_f32) == RISCV_MATH_SINGULAR) && (k_f32[0] == 0.0f);
+  ok = ok && (riscv_levinson_durbin_q31(r_q31, ORDER, k_q31, a_q31, &err_q31) == RISCV_MATH_SINGULAR) && (k_q31[ORDER - 1] == 0);
+  printf("CHECK riscv_levinson_durbin: singular %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
@@ -0,0 +1,196 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 200
+#define WINDOW 25
+#define NUM_CHANNELS 8
+#define NUM_FRAMES 64
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A noisy square wave runs through the moving averages of a 25-sample and a 16-sample window in blocks
+of different sizes, and the outputs must match the mean of the last samples to within one LSB, or
+the single-precision rounding for f32, like the boxcar riscv_fir_f32() it replaces.  Banks of 8 and 7
+exponential smoothers must match a double-precision recursion within the rounding of each type, and
+the Q15 bank with USE_DSP_RISCV the scalar recursion bit for bit.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions31"
+#include "../common/riscv_bench.h"
+
+float32_t x_f32[BLOCK_SIZE], y_f32[BLOCK_SIZE], fir_f32[BLOCK_SIZE];
+float32_t maState_f32[WINDOW], firCoeffs_f32[WINDOW], firState_f32[WINDOW + BLOCK_SIZE - 1];
+q15_t x_q15[BLOCK_SIZE], y_q15[BLOCK_SIZE], maState_q15[WINDOW];
+q31_t x_q31[BLOCK_SIZE], y_q31[BLOCK_SIZE], maState_q31[WINDOW];
+float32_t sx_f32[NUM_FRAMES * NUM_CHANNELS], sy_f32[NUM_FRAMES * NUM_CHANNELS], esState_f32[NUM_CHANNELS];
+q15_t sx_q15[NUM_FRAMES * NUM_CHANNELS] __attribute__((aligned(4)));
+q15_t sy_q15[NUM_FRAMES * NUM_CHANNELS] __attribute__((aligned(4)));
+q15_t esState_q15[NUM_CHANNELS] __attribute__((aligned(4)));
+q31_t sx_q31[NUM_FRAMES * NUM_CHANNELS], sy_q31[NUM_FRAMES * NUM_CHANNELS], esState_q31[NUM_CHANNELS];
+
+/* Largest error of the moving averages of one window length against the mean of the last samples */
+static void check_window(uint16_t winLen, const double * xd, float32_t * pErr, float32_t * pErr15, float32_t * pErr31)
+{
+  static const uint32_t blocks[4] = { 1, 37, 62, 100 };
+  riscv_moving_average_instance_f32 S_f32;
+  riscv_moving_average_instance_q15 S_q15;
+  riscv_moving_average_instance_q31 S_q31;
+  uint32_t n, j, b, start;
+  double mean;
+
+  riscv_moving_average_init_f32(&S_f32, winLen, maState_f32);
+  riscv_moving_average_init_q15(&S_q15, winLen, maState_q15);
+  riscv_moving_average_init_q31(&S_q31, winLen, maState_q31);
+  for (b = 0, start = 0; b < 4; start += blocks[b++])
+  {
+    riscv_moving_average_f32(&S_f32, x_f32 + start, y_f32 + start, blocks[b]);
+    riscv_moving_average_q15(&S_q15, x_q15 + start, y_q15 + start, blocks[b]);
+    riscv_moving_average_q31(&S_q31, x_q31 + start, y_q31 + start, blocks[b]);
+  }
+
+  *pErr = 0.0f;
+  *pErr15 = 0.0f;
+  *pErr31 = 0.0f;
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    for (j = 0, mean = 0.0; j < winLen && j <= n; j++)
+    {
+      mean += xd[n - j];
+    }
+    mean /= winLen;
+    *pErr = fmaxf(*pErr, (float32_t) fabs(y_f32[n] - mean));
+    *pErr15 = fmaxf(*pErr15, (float32_t) fabs(y_q15[n] - mean * 32768.0));
+    *pErr31 = fmaxf(*pErr31, (float32_t) fabs(y_q31[n] - mean * 2147483648.0));
+  }
+}
+
+int main(void)
+{
+  double xd[BLOCK_SIZE], yd[NUM_CHANNELS], alpha = 0.1;
+  float32_t err, err15, err31, errF, errS, errS15, errS31;
+  uint32_t seed = 2024u, n, c, i;
+  int32_t fail = 0, ok;
+  q15_t alpha_q15 = 0x0CCD, y15;
+  riscv_moving_average_instance_f32 S_f32;
+  riscv_moving_average_instance_q15 S_q15;
+  riscv_moving_average_instance_q31 S_q31;
+  riscv_exp_smooth_instance_f32 E_f32;
+  riscv_exp_smooth_instance_q15 E_q15;
+  riscv_exp_smooth_instance_q31 E_q31;
+  riscv_fir_instance_f32 Sfir_f32;
+
+  riscv_bench_header();
+
+  /* Square wave of period 50 with uniform noise, on a Q15 grid */
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    xd[n] = (((n / 25) & 1u) ? -0.6 : 0.6) + ((double) (seed >> 8) / 16777216.0 - 0.5) * 0.6;
+    x_q15[n] = (q15_t) lrint(xd[n] * 32768.0);
+    xd[n] = x_q15[n] / 32768.0;
+    x_f32[n] = (float32_t) xd[n];
+    x_q31[n] = (q31_t) x_q15[n] << 16;
+  }
+  for (i = 0; i < NUM_FRAMES * NUM_CHANNELS; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    sx_q15[i] = (q15_t) ((i % NUM_CHANNELS) * 3000 + (q15_t) ((seed >> 20) & 0x0FFF) - 0x800);
+    sx_f32[i] = sx_q15[i] / 32768.0f;
+    sx_q31[i] = (q31_t) sx_q15[i] << 16;
+  }
+
+  for (n = 0; n < WINDOW; n++)
+  {
+    firCoeffs_f32[n] = 1.0f / WINDOW;
+  }
+  riscv_fir_init_f32(&Sfir_f32, WINDOW, firCoeffs_f32, firState_f32, BLOCK_SIZE);
+  riscv_moving_average_init_f32(&S_f32, WINDOW, maState_f32);
+  riscv_moving_average_init_q15(&S_q15, WINDOW, maState_q15);
+  riscv_moving_average_init_q31(&S_q31, WINDOW, maState_q31);
+  riscv_exp_smooth_init_f32(&E_f32, NUM_CHANNELS, (float32_t) alpha, esState_f32);
+  riscv_exp_smooth_init_q15(&E_q15, NUM_CHANNELS, alpha_q15, esState_q15);
+  riscv_exp_smooth_init_q31(&E_q31, NUM_CHANNELS, 0x0CCCCCCD, esState_q31);
+
+  RISCV_BENCH("riscv_fir_f32", "f32", BLOCK_SIZE, riscv_fir_f32(&Sfir_f32, x_f32, fir_f32, BLOCK_SIZE));
+  RISCV_BENCH("riscv_moving_average_f32", "f32", BLOCK_SIZE, riscv_moving_average_f32(&S_f32, x_f32, y_f32, BLOCK_SIZE));
+  RISCV_BENCH("riscv_moving_average_q15", "q15", BLOCK_SIZE, riscv_moving_average_q15(&S_q15, x_q15, y_q15, BLOCK_SIZE));
+  RISCV_BENCH("riscv_moving_average_q31", "q31", BLOCK_SIZE, riscv_moving_average_q31(&S_q31, x_q31, y_q31, BLOCK_SIZE));
+  RISCV_BENCH("riscv_exp_smooth_f32", "f32", NUM_FRAMES * NUM_CHANNELS,
+              riscv_exp_smooth_f32(&E_f32, sx_f32, sy_f32, NUM_FRAMES));
+  RISCV_BENCH("riscv_exp_smooth_q15", "q15", NUM_FRAMES * NUM_CHANNELS,
+              riscv_exp_smooth_q15(&E_q15, sx_q15, sy_q15, NUM_FRAMES));
+  RISCV_BENCH("riscv_exp_smooth_q31", "q31", NUM_FRAMES * NUM_CHANNELS,
+              riscv_exp_smooth_q31(&E_q31, sx_q31, sy_q31, NUM_FRAMES));
+
+  /* Boxcar FIR of the same window from zero state */
+  riscv_fir_init_f32(&Sfir_f32, WINDOW, firCoeffs_f32, firState_f32, BLOCK_SIZE);
+  riscv_fir_f32(&Sfir_f32, x_f32, fir_f32, BLOCK_SIZE);
+  check_window(WINDOW, xd, &err, &err15, &err31);
+  for (n = 0, errF = 0.0f; n < BLOCK_SIZE; n++)
+  {
+    errF = fmaxf(errF, fabsf(y_f32[n] - fir_f32[n]));
+  }
+  ok = (err < 1e-6f) && (errF < 1e-6f) && (err15 <= 1.0f) && (err31 <= 1.0f);
+  printf("CHECK riscv_moving_average: window %d, f32 %d (1e-9), fir %d (1e-9), q15 %d, q31 %d (1e-3 LSB) %s\n", WINDOW,
+         (int) (err * 1e9f), (int) (errF * 1e9f), (int) (err15 * 1e3f), (int) (err31 * 1e3f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  check_window(16, xd, &err, &err15, &err31);
+  ok = (err < 1e-6f) && (err15 <= 0.5f) && (err31 <= 0.5f);
+  printf("CHECK riscv_moving_average: window 16, f32 %d (1e-9), q15 %d, q31 %d (1e-3 LSB) %s\n",
+         (int) (err * 1e9f), (int) (err15 * 1e3f), (int) (err31 * 1e3f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  ok = (riscv_moving_average_init_q15(&S_q15, 0, maState_q15) == RISCV_MATH_ARGUMENT_ERROR);
+  ok = ok && (riscv_exp_smooth_init_q15(&E_q15, NUM_CHANNELS, 0, esState_q15) == RISCV_MATH_ARGUMENT_ERROR);
+  ok = ok && (riscv_exp_smooth_init_f32(&E_f32, NUM_CHANNELS, 1.5f, esState_f32) == RISCV_MATH_ARGUMENT_ERROR);
+  printf("CHECK riscv_moving_average_init: arguments %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Smoothers of 8 channels, then of 7 for the odd channel of the Q15 pairs */
+  for (c = NUM_CHANNELS; c >= NUM_CHANNELS - 1; c--)
+  {
+    riscv_exp_smooth_init_f32(&E_f32, c, (float32_t) alpha, esState_f32);
+    riscv_exp_smooth_init_q15(&E_q15, c, alpha_q15, esState_q15);
+    riscv_exp_smooth_init_q31(&E_q31, c, 0x0CCCCCCD, esState_q31);
+    riscv_exp_smooth_f32(&E_f32, sx_f32, sy_f32, NUM_FRAMES);
+    riscv_exp_smooth_q15(&E_q15, sx_q15, sy_q15, NUM_FRAMES / 2);
+    riscv_exp_smooth_q15(&E_q15, sx_q15 + (NUM_FRAMES / 2) * c, sy_q15 + (NUM_FRAMES / 2) * c, NUM_FRAMES / 2);
+    riscv_exp_smooth_q31(&E_q31, sx_q31, sy_q31, NUM_FRAMES);
+
+    errS = 0.0f;
+    errS15 = 0.0f;
+    errS31 = 0.0f;
+    ok = 1;
+    memset(yd, 0, sizeof(yd));
+    memset(esState_q15, 0, sizeof(esState_q15));
+    for (n = 0; n < NUM_FRAMES; n++)
+    {
+      for (i = 0; i < c; i++)
+      {
+        yd[i] += alpha * (sx_f32[n * c + i] - yd[i]);
+        y15 = (q15_t) ((((q31_t) esState_q15[i] * (0x8000 - alpha_q15)) + ((q31_t) sx_q15[n * c + i] * alpha_q15) + 0x4000) >> 15);
+        esState_q15[i] = y15;
+        ok = ok && (sy_q15[n * c + i] == y15);
+        errS = fmaxf(errS, (float32_t) fabs(sy_f32[n * c + i] - yd[i]));
+        errS15 = fmaxf(errS15, (float32_t) fabs(sy_q15[n * c + i] - yd[i] * 32768.0));
+        errS31 = fmaxf(errS31, (float32_t) fabs(sy_q31[n * c + i] / 65536.0 - yd[i] * 32768.0));
+      }
+    }
+    ok = ok && (errS < 1e-5f) && (errS15 <= 0.5f / (float32_t) alpha) && (errS31 < 0.01f);
+    printf("CHECK riscv_exp_smooth: %d channels, f32 %d (1e-9), q15 %d, q31 %d (1e-3 LSB) %s\n", (int) c,
+           (int) (errS * 1e9f), (int) (errS15 * 1e3f), (int) (errS31 * 1e3f), ok ? "ok" : "bad");
+    fail |= !ok;
+  }
+
+  return (fail);
+}
@@ -0,0 +1,137 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 256
+#define NUM_STAGES 5
+#define NUM_CORES 3
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A 10th order lowpass, five biquads with staggered cutoffs and Qs, is converted from its cascade form
+to five parallel sections and a direct gain.  On white noise the floating-point parallel form, run at once,
+in two blocks and forked on three cores, must match riscv_biquad_cascade_df2T_f32(), and the Q15
+parallel form the floating-point output to within 40 dB.  Stages without poles and stages with the
+same poles must be refused.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions32"
+#include "../common/riscv_bench.h"
+
+float32_t cascade_f32[5 * NUM_STAGES], coeffs_f32[4 * NUM_STAGES], direct_f32;
+float32_t cascadeState_f32[2 * NUM_STAGES], state_f32[2 * NUM_STAGES];
+float32_t x_f32[BLOCK_SIZE], ref_f32[BLOCK_SIZE], y_f32[BLOCK_SIZE], scratch_f32[(NUM_CORES - 1) * BLOCK_SIZE];
+q15_t coeffs_q15[4 * NUM_STAGES] __attribute__((aligned(4)));
+q15_t state_q15[2 * NUM_STAGES + 2] __attribute__((aligned(4)));
+q15_t x_q15[BLOCK_SIZE], y_q15[BLOCK_SIZE];
+
+int main(void)
+{
+  riscv_biquad_cascade_df2T_instance_f32 Scas;
+  riscv_biquad_parallel_instance_f32 S_f32;
+  riscv_biquad_parallel_instance_q15 S_q15;
+  riscv_par_instance P;
+  riscv_status st;
+  float32_t err, peak, maxCoef;
+  double se, sy;
+  uint32_t seed = 7u, n, k;
+  int32_t fail = 0, ok;
+  int8_t postShift;
+
+  riscv_bench_header();
+
+  for (k = 0; k < NUM_STAGES; k++)
+  {
+    riscv_biquad_design_f32(RISCV_BIQUAD_DESIGN_LOWPASS, 0.04f + 0.05f * k, 0.6f + 0.3f * k, 0.0f, cascade_f32 + 5 * k);
+  }
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    x_q15[n] = (q15_t) ((int32_t) (seed >> 16) - 32768) >> 1;
+    x_f32[n] = x_q15[n] / 32768.0f;
+  }
+
+  st = riscv_biquad_parallel_convert_f32(cascade_f32, NUM_STAGES, coeffs_f32, &direct_f32);
+  ok = (st == RISCV_MATH_SUCCESS);
+  riscv_biquad_cascade_df2T_init_f32(&Scas, NUM_STAGES, cascade_f32, cascadeState_f32);
+  riscv_biquad_parallel_init_f32(&S_f32, NUM_STAGES, coeffs_f32, direct_f32, state_f32);
+  riscv_par_init(&P, NUM_CORES, NULL);
+
+  /* Q15 coefficients scaled by the power of 2 above the largest one */
+  for (k = 0, maxCoef = fabsf(direct_f32); k < 4 * NUM_STAGES; k++)
+  {
+    maxCoef = fmaxf(maxCoef, fabsf(coeffs_f32[k]));
+  }
+  for (postShift = 0; (float32_t) (1 << postShift) <= maxCoef; postShift++);
+  for (k = 0; k < 4 * NUM_STAGES; k++)
+  {
+    coeffs_q15[k] = (q15_t) lrintf(fminf(coeffs_f32[k] / (1 << postShift) * 32768.0f, 32767.0f));
+  }
+  riscv_biquad_parallel_init_q15(&S_q15, NUM_STAGES, coeffs_q15, (q15_t) lrintf(direct_f32 / (1 << postShift) * 32768.0f),
+                                 state_q15, postShift);
+
+  RISCV_BENCH("riscv_biquad_cascade_df2T_f32", "f32", BLOCK_SIZE, riscv_biquad_cascade_df2T_f32(&Scas, x_f32, ref_f32, BLOCK_SIZE));
+  RISCV_BENCH("riscv_biquad_parallel_f32", "f32", BLOCK_SIZE, riscv_biquad_parallel_f32(&S_f32, x_f32, y_f32, BLOCK_SIZE));
+  RISCV_BENCH("riscv_biquad_parallel_q15", "q15", BLOCK_SIZE, riscv_biquad_parallel_q15(&S_q15, x_q15, y_q15, BLOCK_SIZE));
+  RISCV_BENCH("riscv_biquad_parallel_par_f32", "f32", BLOCK_SIZE,
+              riscv_biquad_parallel_par_f32(&P, &S_f32, x_f32, y_f32, BLOCK_SIZE, scratch_f32));
+
+  /* Same filter from zero state, the parallel form in two blocks */
+  riscv_biquad_cascade_df2T_init_f32(&Scas, NUM_STAGES, cascade_f32, cascadeState_f32);
+  riscv_biquad_cascade_df2T_f32(&Scas, x_f32, ref_f32, BLOCK_SIZE);
+  riscv_biquad_parallel_init_f32(&S_f32, NUM_STAGES, coeffs_f32, direct_f32, state_f32);
+  riscv_biquad_parallel_f32(&S_f32, x_f32, y_f32, 100);
+  riscv_biquad_parallel_f32(&S_f32, x_f32 + 100, y_f32 + 100, BLOCK_SIZE - 100);
+  for (n = 0, err = 0.0f, peak = 0.0f; n < BLOCK_SIZE; n++)
+  {
+    err = fmaxf(err, fabsf(y_f32[n] - ref_f32[n]));
+    peak = fmaxf(peak, fabsf(ref_f32[n]));
+  }
+  ok = ok && (err < 1e-5f * peak);
+  printf("CHECK riscv_biquad_parallel_f32: direct %d, error %d (1e-9) of peak %d (1e-6) %s\n", (int) (direct_f32 * 1e9f),
+         (int) (err * 1e9f), (int) (peak * 1e6f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  riscv_biquad_parallel_init_f32(&S_f32, NUM_STAGES, coeffs_f32, direct_f32, state_f32);
+  riscv_biquad_parallel_par_f32(&P, &S_f32, x_f32, y_f32, BLOCK_SIZE, scratch_f32);
+  for (n = 0, err = 0.0f; n < BLOCK_SIZE; n++)
+  {
+    err = fmaxf(err, fabsf(y_f32[n] - ref_f32[n]));
+  }
+  ok = (err < 1e-5f * peak);
+  printf("CHECK riscv_biquad_parallel_par_f32: %d cores, error %d (1e-9) %s\n", NUM_CORES, (int) (err * 1e9f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  riscv_biquad_parallel_init_q15(&S_q15, NUM_STAGES, coeffs_q15, S_q15.direct, state_q15, postShift);
+  riscv_biquad_parallel_q15(&S_q15, x_q15, y_q15, BLOCK_SIZE);
+  for (n = 0, se = 0.0, sy = 0.0; n < BLOCK_SIZE; n++)
+  {
+    se += (y_q15[n] / 32768.0 - ref_f32[n]) * (y_q15[n] / 32768.0 - ref_f32[n]);
+    sy += (double) ref_f32[n] * ref_f32[n];
+  }
+  ok = (se < 1e-4 * sy);
+  printf("CHECK riscv_biquad_parallel_q15: postShift %d, SNR %d dB %s\n", postShift, (int) (10.0 * log10(sy / se)),
+         ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* A stage without poles, then two stages with the same poles */
+  memcpy(cascade_f32 + 5, cascade_f32, 5 * sizeof(float32_t));
+  st = riscv_biquad_parallel_convert_f32(cascade_f32, 2, coeffs_f32, &direct_f32);
+  ok = (st == RISCV_MATH_SINGULAR);
+  cascade_f32[8] = 0.0f;
+  cascade_f32[9] = 0.0f;
+  st = riscv_biquad_parallel_convert_f32(cascade_f32, 2, coeffs_f32, &direct_f32);
+  ok = ok && (st == RISCV_MATH_ARGUMENT_ERROR);
+  printf("CHECK riscv_biquad_parallel_convert_f32: errors %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
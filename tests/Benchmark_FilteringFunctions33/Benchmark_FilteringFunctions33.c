@@ -0,0 +1,150 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_SAMPLES 200
+#define NUM_TAPS 32
+#define NUM_STAGES 3
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The single-sample entry points are measured for one sample next to the block functions called with a
+block size of 1, the latency of a sample interrupt.  Sample by sample over a noise input they must
+match the block functions: riscv_fir_sample_q15() riscv_fir_q15() for an even and a direct sum for an
+odd number of taps, riscv_biquad_df1_sample_q15() riscv_biquad_cascade_df1_q15() and
+riscv_biquad_df2T_sample_f32() riscv_biquad_cascade_df2T_f32().  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions33"
+#include "../common/riscv_bench.h"
+
+q15_t firCoeffs_q15[NUM_TAPS] __attribute__((aligned(4)));
+q15_t firState_q15[NUM_TAPS] __attribute__((aligned(4)));
+q15_t sampleState_q15[2 * NUM_TAPS] __attribute__((aligned(4)));
+q15_t biquadCoeffs_q15[6 * NUM_STAGES] __attribute__((aligned(4)));
+q15_t biquadState_q15[4 * NUM_STAGES] __attribute__((aligned(4)));
+q15_t sampleBiquadState_q15[4 * NUM_STAGES] __attribute__((aligned(4)));
+float32_t biquadCoeffs_f32[5 * NUM_STAGES], biquadState_f32[2 * NUM_STAGES], sampleBiquadState_f32[2 * NUM_STAGES];
+q15_t x_q15[NUM_SAMPLES], ref_q15[NUM_SAMPLES], y_q15[NUM_SAMPLES];
+float32_t x_f32[NUM_SAMPLES], ref_f32[NUM_SAMPLES], y_f32[NUM_SAMPLES];
+
+int main(void)
+{
+  riscv_fir_instance_q15 Sfir;
+  riscv_fir_sample_instance_q15 Ssample;
+  riscv_biquad_casd_df1_inst_q15 Sdf1, Sdf1Sample;
+  riscv_biquad_cascade_df2T_instance_f32 Sdf2T, Sdf2TSample;
+  riscv_pid_instance_f32 Spid;
+  volatile q15_t out_q15;
+  volatile float32_t out_f32;
+  uint32_t seed = 11u, n, k;
+  int32_t fail = 0, ok, bad;
+  q63_t acc;
+
+  riscv_bench_header();
+
+  for (n = 0; n < NUM_SAMPLES; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    x_q15[n] = (q15_t) ((int32_t) (seed >> 16) - 32768);
+    x_f32[n] = x_q15[n] / 32768.0f;
+  }
+  for (k = 0; k < NUM_TAPS; k++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    firCoeffs_q15[k] = (q15_t) (((int32_t) (seed >> 16) - 32768) >> 3);
+  }
+  for (k = 0; k < NUM_STAGES; k++)
+  {
+    riscv_biquad_design_f32(RISCV_BIQUAD_DESIGN_LOWPASS, 0.05f + 0.1f * k, 0.7f + 0.5f * k, 0.0f, biquadCoeffs_f32 + 5 * k);
+    /* {b0, 0, b1, b2, a1, a2} with postShift 1 */
+    biquadCoeffs_q15[6 * k] = (q15_t) lrintf(biquadCoeffs_f32[5 * k] * 16384.0f);
+    biquadCoeffs_q15[6 * k + 1] = 0;
+    biquadCoeffs_q15[6 * k + 2] = (q15_t) lrintf(biquadCoeffs_f32[5 * k + 1] * 16384.0f);
+    biquadCoeffs_q15[6 * k + 3] = (q15_t) lrintf(biquadCoeffs_f32[5 * k + 2] * 16384.0f);
+    biquadCoeffs_q15[6 * k + 4] = (q15_t) lrintf(biquadCoeffs_f32[5 * k + 3] * 16384.0f);
+    biquadCoeffs_q15[6 * k + 5] = (q15_t) lrintf(biquadCoeffs_f32[5 * k + 4] * 16384.0f);
+  }
+
+  riscv_fir_init_q15(&Sfir, NUM_TAPS, firCoeffs_q15, firState_q15, 1);
+  riscv_fir_sample_init_q15(&Ssample, NUM_TAPS, firCoeffs_q15, sampleState_q15);
+  riscv_biquad_cascade_df1_init_q15(&Sdf1, NUM_STAGES, biquadCoeffs_q15, biquadState_q15, 1);
+  riscv_biquad_cascade_df1_init_q15(&Sdf1Sample, NUM_STAGES, biquadCoeffs_q15, sampleBiquadState_q15, 1);
+  riscv_biquad_cascade_df2T_init_f32(&Sdf2T, NUM_STAGES, biquadCoeffs_f32, biquadState_f32);
+  riscv_biquad_cascade_df2T_init_f32(&Sdf2TSample, NUM_STAGES, biquadCoeffs_f32, sampleBiquadState_f32);
+  Spid.Kp = 0.5f;
+  Spid.Ki = 0.1f;
+  Spid.Kd = 0.05f;
+  riscv_pid_init_f32(&Spid, 1);
+
+  RISCV_BENCH("riscv_fir_q15", "q15", 1, riscv_fir_q15(&Sfir, x_q15, y_q15, 1));
+  RISCV_BENCH("riscv_fir_sample_q15", "q15", 1, out_q15 = riscv_fir_sample_q15(&Ssample, x_q15[0]));
+  RISCV_BENCH("riscv_biquad_cascade_df1_q15", "q15", 1, riscv_biquad_cascade_df1_q15(&Sdf1, x_q15, y_q15, 1));
+  RISCV_BENCH("riscv_biquad_df1_sample_q15", "q15", 1, out_q15 = riscv_biquad_df1_sample_q15(&Sdf1Sample, x_q15[0]));
+  RISCV_BENCH("riscv_biquad_cascade_df2T_f32", "f32", 1, riscv_biquad_cascade_df2T_f32(&Sdf2T, x_f32, y_f32, 1));
+  RISCV_BENCH("riscv_biquad_df2T_sample_f32", "f32", 1, out_f32 = riscv_biquad_df2T_sample_f32(&Sdf2TSample, x_f32[0]));
+  RISCV_BENCH("riscv_pid_f32", "f32", 1, out_f32 = riscv_pid_f32(&Spid, x_f32[0]));
+  (void) out_q15;
+  (void) out_f32;
+
+  /* FIR, even number of taps against the block filter */
+  riscv_fir_init_q15(&Sfir, NUM_TAPS, firCoeffs_q15, firState_q15, 1);
+  riscv_fir_sample_init_q15(&Ssample, NUM_TAPS, firCoeffs_q15, sampleState_q15);
+  for (n = 0, bad = 0; n < NUM_SAMPLES; n++)
+  {
+    riscv_fir_q15(&Sfir, x_q15 + n, ref_q15 + n, 1);
+    y_q15[n] = riscv_fir_sample_q15(&Ssample, x_q15[n]);
+    bad += (y_q15[n] != ref_q15[n]);
+  }
+
+  /* Odd number of taps against the direct sum, coefficients in time reversed order */
+  riscv_fir_sample_init_q15(&Ssample, NUM_TAPS - 1, firCoeffs_q15, sampleState_q15);
+  for (n = 0; n < NUM_SAMPLES; n++)
+  {
+    for (k = 0, acc = 0; (k < NUM_TAPS - 1) && (k <= n); k++)
+    {
+      acc += (q31_t) firCoeffs_q15[NUM_TAPS - 2 - k] * x_q15[n - k];
+    }
+    acc >>= 15;
+    ref_q15[n] = (q15_t) ((acc > 0x7FFF) ? 0x7FFF : ((acc < -0x8000) ? -0x8000 : acc));
+    y_q15[n] = riscv_fir_sample_q15(&Ssample, x_q15[n]);
+    bad += (y_q15[n] != ref_q15[n]);
+  }
+  ok = (bad == 0);
+  printf("CHECK riscv_fir_sample_q15: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  riscv_biquad_cascade_df1_init_q15(&Sdf1, NUM_STAGES, biquadCoeffs_q15, biquadState_q15, 1);
+  riscv_biquad_cascade_df1_init_q15(&Sdf1Sample, NUM_STAGES, biquadCoeffs_q15, sampleBiquadState_q15, 1);
+  riscv_biquad_cascade_df1_q15(&Sdf1, x_q15, ref_q15, NUM_SAMPLES);
+  for (n = 0, bad = 0; n < NUM_SAMPLES; n++)
+  {
+    y_q15[n] = riscv_biquad_df1_sample_q15(&Sdf1Sample, x_q15[n]);
+    bad += (y_q15[n] != ref_q15[n]);
+  }
+  ok = (bad == 0);
+  printf("CHECK riscv_biquad_df1_sample_q15: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  riscv_biquad_cascade_df2T_init_f32(&Sdf2T, NUM_STAGES, biquadCoeffs_f32, biquadState_f32);
+  riscv_biquad_cascade_df2T_init_f32(&Sdf2TSample, NUM_STAGES, biquadCoeffs_f32, sampleBiquadState_f32);
+  riscv_biquad_cascade_df2T_f32(&Sdf2T, x_f32, ref_f32, NUM_SAMPLES);
+  for (n = 0, bad = 0; n < NUM_SAMPLES; n++)
+  {
+    y_f32[n] = riscv_biquad_df2T_sample_f32(&Sdf2TSample, x_f32[n]);
+    bad += (fabsf(y_f32[n] - ref_f32[n]) > 1e-6f);
+  }
+  ok = (bad == 0);
+  printf("CHECK riscv_biquad_df2T_sample_f32: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
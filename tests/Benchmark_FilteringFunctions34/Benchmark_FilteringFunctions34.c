@@ -0,0 +1,196 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_SAMPLES 256
+#define NUM_TAPS 63
+#define NUM_PAIRS ((NUM_TAPS + 1) / 4)
+#define CENTER ((NUM_TAPS - 1) / 2)
+#define MAX_BLOCK 33
+#define CARRIER 0.125f
+#define MODULATION 0.0078125f
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The Hilbert transformer of NUM_TAPS taps from riscv_hilbert_design_f32() is run over NUM_SAMPLES
+samples in blocks of 31 and 33 samples.  Its Q outputs must match riscv_fir_f32() with the full set of
+taps and, for Q15, the direct 64-bit sum bit for bit; its I outputs are the input delayed by CENTER.
+The envelope and phase of an AM tone, after the first NUM_TAPS samples, must be those of the tone
+delayed by CENTER.  The FFT method, riscv_rfft_fast_f32(), the negative bins zeroed, the inverse
+riscv_cfft_f32() and riscv_cmplx_mag_f32(), is measured next to riscv_hilbert_envelope_f32().  The
+CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions34"
+#include "../common/riscv_bench.h"
+
+float32_t coeffs_f32[NUM_PAIRS], fullCoeffs_f32[NUM_TAPS];
+q15_t coeffs_q15[NUM_PAIRS] __attribute__((aligned(4)));
+q15_t fullCoeffs_q15[NUM_TAPS];
+float32_t state_f32[NUM_TAPS + MAX_BLOCK - 1], firState_f32[NUM_TAPS + MAX_BLOCK - 1];
+q15_t state_q15[NUM_TAPS + MAX_BLOCK - 1] __attribute__((aligned(4)));
+float32_t x_f32[NUM_SAMPLES], am_f32[NUM_SAMPLES], ref_f32[NUM_SAMPLES], y_f32[NUM_SAMPLES], re_f32[NUM_SAMPLES];
+float32_t env_f32[NUM_SAMPLES], phase_f32[NUM_SAMPLES];
+q15_t x_q15[NUM_SAMPLES], am_q15[NUM_SAMPLES], y_q15[NUM_SAMPLES], re_q15[NUM_SAMPLES];
+q15_t env_q15[NUM_SAMPLES], phase_q15[NUM_SAMPLES];
+float32_t spectrum_f32[NUM_SAMPLES], analytic_f32[2 * NUM_SAMPLES];
+riscv_rfft_fast_instance_f32 Srfft;
+
+static float32_t envelope(uint32_t n)
+{
+  return 0.5f + 0.3f * cosf(6.28318531f * MODULATION * n);
+}
+
+int main(void)
+{
+  riscv_hilbert_instance_f32 S_f32;
+  riscv_hilbert_instance_q15 S_q15;
+  riscv_fir_instance_f32 Sfir;
+  uint32_t seed = 7u, n, k, blk;
+  int32_t fail = 0, ok, bad;
+  float32_t err, maxErr, maxPhaseErr, d;
+  q63_t acc;
+
+  riscv_bench_header();
+
+  ok = (riscv_hilbert_design_f32(NUM_TAPS, coeffs_f32) == RISCV_MATH_SUCCESS) &&
+       (riscv_hilbert_design_f32(NUM_TAPS + 2, coeffs_f32) == RISCV_MATH_ARGUMENT_ERROR) &&
+       (riscv_hilbert_init_f32(&S_f32, NUM_TAPS - 2, coeffs_f32, state_f32, MAX_BLOCK) == RISCV_MATH_ARGUMENT_ERROR) &&
+       (riscv_hilbert_design_f32(NUM_TAPS, coeffs_f32) == RISCV_MATH_SUCCESS);
+  printf("CHECK riscv_hilbert_design_f32 lengths %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+  riscv_float_to_q15(coeffs_f32, coeffs_q15, NUM_PAIRS);
+
+  /* Full antisymmetric taps in the order of riscv_fir_init_f32() */
+  memset(fullCoeffs_f32, 0, sizeof(fullCoeffs_f32));
+  memset(fullCoeffs_q15, 0, sizeof(fullCoeffs_q15));
+  for (k = 0; k < NUM_PAIRS; k++)
+  {
+    fullCoeffs_f32[2 * k] = coeffs_f32[k];
+    fullCoeffs_f32[NUM_TAPS - 1 - 2 * k] = -coeffs_f32[k];
+    fullCoeffs_q15[2 * k] = coeffs_q15[k];
+    fullCoeffs_q15[NUM_TAPS - 1 - 2 * k] = -coeffs_q15[k];
+  }
+
+  for (n = 0; n < NUM_SAMPLES; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    x_q15[n] = (q15_t) ((int32_t) (seed >> 16) - 32768);
+    x_f32[n] = x_q15[n] / 32768.0f;
+    am_f32[n] = envelope(n) * cosf(6.28318531f * CARRIER * n);
+    am_q15[n] = (q15_t) lrintf(am_f32[n] * 32768.0f);
+  }
+
+  riscv_hilbert_init_f32(&S_f32, NUM_TAPS, coeffs_f32, state_f32, NUM_SAMPLES / 8);
+  riscv_hilbert_init_q15(&S_q15, NUM_TAPS, coeffs_q15, state_q15, NUM_SAMPLES / 8);
+  riscv_fir_init_f32(&Sfir, NUM_TAPS, fullCoeffs_f32, firState_f32, NUM_SAMPLES / 8);
+  riscv_rfft_fast_init_f32(&Srfft, NUM_SAMPLES);
+
+  RISCV_BENCH("riscv_fir_f32", "f32", NUM_SAMPLES,
+    for (blk = 0; blk < NUM_SAMPLES; blk += NUM_SAMPLES / 8) riscv_fir_f32(&Sfir, x_f32 + blk, y_f32 + blk, NUM_SAMPLES / 8));
+  RISCV_BENCH("riscv_hilbert_f32", "f32", NUM_SAMPLES,
+    for (blk = 0; blk < NUM_SAMPLES; blk += NUM_SAMPLES / 8) riscv_hilbert_f32(&S_f32, x_f32 + blk, y_f32 + blk, NULL, NUM_SAMPLES / 8));
+  RISCV_BENCH("riscv_hilbert_q15", "q15", NUM_SAMPLES,
+    for (blk = 0; blk < NUM_SAMPLES; blk += NUM_SAMPLES / 8) riscv_hilbert_q15(&S_q15, x_q15 + blk, y_q15 + blk, NULL, NUM_SAMPLES / 8));
+  RISCV_BENCH("riscv_hilbert_envelope_f32", "f32", NUM_SAMPLES,
+    for (blk = 0; blk < NUM_SAMPLES; blk += NUM_SAMPLES / 8) riscv_hilbert_envelope_f32(&S_f32, am_f32 + blk, env_f32 + blk, NULL, NUM_SAMPLES / 8));
+  RISCV_BENCH("riscv_hilbert_envelope_q15", "q15", NUM_SAMPLES,
+    for (blk = 0; blk < NUM_SAMPLES; blk += NUM_SAMPLES / 8) riscv_hilbert_envelope_q15(&S_q15, am_q15 + blk, env_q15 + blk, NULL, NUM_SAMPLES / 8));
+  RISCV_BENCH("riscv_rfft_cfft_envelope_f32", "f32", NUM_SAMPLES,
+    memcpy(y_f32, am_f32, sizeof(y_f32));
+    riscv_rfft_fast_f32(&Srfft, y_f32, spectrum_f32, 0);
+    /* DC and Nyquist once, the positive bins doubled, the negative bins zero */
+    memset(analytic_f32, 0, sizeof(analytic_f32));
+    analytic_f32[0] = spectrum_f32[0];
+    analytic_f32[NUM_SAMPLES] = spectrum_f32[1];
+    riscv_scale_f32(spectrum_f32 + 2, 2.0f, analytic_f32 + 2, NUM_SAMPLES - 2);
+    riscv_cfft_f32(&riscv_cfft_sR_f32_len256, analytic_f32, 1, 1);
+    riscv_cmplx_mag_f32(analytic_f32, env_f32, NUM_SAMPLES));
+
+  /* Q and I against the full FIR, blocks of 31 and 33 samples */
+  riscv_hilbert_init_f32(&S_f32, NUM_TAPS, coeffs_f32, state_f32, MAX_BLOCK);
+  riscv_hilbert_init_q15(&S_q15, NUM_TAPS, coeffs_q15, state_q15, MAX_BLOCK);
+  riscv_fir_init_f32(&Sfir, NUM_TAPS, fullCoeffs_f32, firState_f32, MAX_BLOCK);
+  for (blk = 0, k = 0; blk < NUM_SAMPLES; blk += k)
+  {
+    k = (k == 31) ? 33 : 31;
+    riscv_fir_f32(&Sfir, x_f32 + blk, ref_f32 + blk, k);
+    riscv_hilbert_f32(&S_f32, x_f32 + blk, y_f32 + blk, re_f32 + blk, k);
+    riscv_hilbert_q15(&S_q15, x_q15 + blk, y_q15 + blk, re_q15 + blk, k);
+  }
+
+  for (n = 0, bad = 0; n < NUM_SAMPLES; n++)
+  {
+    bad += (fabsf(y_f32[n] - ref_f32[n]) > 1e-5f);
+    bad += (re_f32[n] != ((n >= CENTER) ? x_f32[n - CENTER] : 0.0f));
+  }
+  ok = (bad == 0);
+  printf("CHECK riscv_hilbert_f32: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  for (n = 0, bad = 0; n < NUM_SAMPLES; n++)
+  {
+    for (k = 0, acc = 0; (k < NUM_TAPS) && (k <= n); k++)
+    {
+      acc += (q31_t) fullCoeffs_q15[NUM_TAPS - 1 - k] * x_q15[n - k];
+    }
+    acc >>= 15;
+    acc = (acc > 0x7FFF) ? 0x7FFF : ((acc < -0x8000) ? -0x8000 : acc);
+    bad += (y_q15[n] != (q15_t) acc);
+    bad += (re_q15[n] != ((n >= CENTER) ? x_q15[n - CENTER] : 0));
+  }
+  ok = (bad == 0);
+  printf("CHECK riscv_hilbert_q15: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Envelope and phase of the AM tone, delayed by CENTER */
+  riscv_hilbert_init_f32(&S_f32, NUM_TAPS, coeffs_f32, state_f32, MAX_BLOCK);
+  riscv_hilbert_init_q15(&S_q15, NUM_TAPS, coeffs_q15, state_q15, MAX_BLOCK);
+  for (blk = 0, k = 0; blk < NUM_SAMPLES; blk += k)
+  {
+    k = (k == 31) ? 33 : 31;
+    riscv_hilbert_envelope_f32(&S_f32, am_f32 + blk, env_f32 + blk, phase_f32 + blk, k);
+    riscv_hilbert_envelope_q15(&S_q15, am_q15 + blk, env_q15 + blk, phase_q15 + blk, k);
+  }
+
+  maxErr = 0.0f;
+  maxPhaseErr = 0.0f;
+  for (n = NUM_TAPS; n < NUM_SAMPLES; n++)
+  {
+    err = fabsf(env_f32[n] - envelope(n - CENTER));
+    maxErr = (err > maxErr) ? err : maxErr;
+    d = phase_f32[n] - 6.28318531f * CARRIER * (n - CENTER);
+    err = fabsf(atan2f(sinf(d), cosf(d)));
+    maxPhaseErr = (err > maxPhaseErr) ? err : maxPhaseErr;
+  }
+  ok = (maxErr < 0.01f) && (maxPhaseErr < 0.02f);
+  printf("CHECK riscv_hilbert_envelope_f32: envelope error %d, phase error %d (1e-4) %s\n",
+         (int) (maxErr * 10000), (int) (maxPhaseErr * 10000), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  maxErr = 0.0f;
+  maxPhaseErr = 0.0f;
+  for (n = NUM_TAPS; n < NUM_SAMPLES; n++)
+  {
+    err = fabsf(env_q15[n] / 16384.0f - envelope(n - CENTER));
+    maxErr = (err > maxErr) ? err : maxErr;
+    d = phase_q15[n] / 8192.0f - 6.28318531f * CARRIER * (n - CENTER);
+    err = fabsf(atan2f(sinf(d), cosf(d)));
+    maxPhaseErr = (err > maxPhaseErr) ? err : maxPhaseErr;
+  }
+  ok = (maxErr < 0.01f) && (maxPhaseErr < 0.02f);
+  printf("CHECK riscv_hilbert_envelope_q15: envelope error %d, phase error %d (1e-4) %s\n",
+         (int) (maxErr * 10000), (int) (maxPhaseErr * 10000), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
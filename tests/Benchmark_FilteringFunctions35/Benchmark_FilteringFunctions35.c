@@ -0,0 +1,205 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define ROWS 96
+#define COLS 96
+#define BOX 8
+#define NUM_TAPS 7
+#define GAUSS_TAPS 5
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A random ROWSxCOLS Q7 frame is summed by riscv_integral_image_q7(); every BOXxBOX box sum of
+riscv_integral_box_q31() and a set of riscv_integral_box_sum() queries must match the nested loops,
+which are measured next to them.  The horizontal and vertical passes with NUM_TAPS random taps must
+match the direct sums bit for bit in Q7 and Q15, the Q15 taps scaled down so that the sums fit in 32 bits.  The separable Gaussian 1 4 6 4 1 must match the
+direct 2D filter with the outer product of the taps bit for bit in Q15, the first pass unshifted,
+and within 1 LSB in Q7.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions35"
+#include "../common/riscv_bench.h"
+
+q7_t img_q7[ROWS * COLS] __attribute__((aligned(4)));
+q15_t img_q15[ROWS * COLS] __attribute__((aligned(4)));
+q31_t integral[(ROWS + 1) * (COLS + 1)];
+q31_t boxes[(ROWS - BOX + 1) * (COLS - BOX + 1)], refBoxes[(ROWS - BOX + 1) * (COLS - BOX + 1)];
+q7_t taps_q7[8] __attribute__((aligned(4)));
+q15_t taps_q15[8] __attribute__((aligned(4)));
+q7_t gauss_q7[8] __attribute__((aligned(4))) = { 1, 4, 6, 4, 1 };
+q15_t gauss_q15[8] __attribute__((aligned(4))) = { 1, 4, 6, 4, 1 };
+q7_t out_q7[ROWS * COLS] __attribute__((aligned(4))), tmp_q7[ROWS * COLS] __attribute__((aligned(4)));
+q15_t out_q15[ROWS * COLS] __attribute__((aligned(4))), tmp_q15[ROWS * COLS] __attribute__((aligned(4)));
+
+static q31_t box_ref(uint32_t r0, uint32_t c0, uint32_t h, uint32_t w)
+{
+  q31_t sum = 0;
+  uint32_t r, c;
+
+  for (r = r0; r < r0 + h; r++)
+    for (c = c0; c < c0 + w; c++)
+      sum += img_q7[r * COLS + c];
+  return (sum);
+}
+
+static q31_t sat(q31_t x, q31_t lim)
+{
+  return (x >= lim) ? (lim - 1) : ((x < -lim) ? -lim : x);
+}
+
+int main(void)
+{
+  uint32_t seed = 11u, n, r, c, k, j;
+  int32_t fail = 0, ok, bad;
+  q31_t acc, d, maxErr;
+
+  riscv_bench_header();
+
+  for (n = 0; n < ROWS * COLS; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    img_q7[n] = (q7_t) ((int32_t) (seed >> 24) - 128);
+    img_q15[n] = (q15_t) ((int32_t) (seed >> 16) - 32768);
+  }
+  for (k = 0; k < NUM_TAPS; k++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    taps_q7[k] = (q7_t) ((int32_t) (seed >> 24) - 128);
+    /* |taps| < 4096, so NUM_TAPS full-scale products fit the 32-bit accumulator */
+    taps_q15[k] = (q15_t) (((int32_t) (seed >> 16) - 32768) >> 3);
+  }
+
+  RISCV_BENCH("riscv_integral_image_q7", "q7", ROWS * COLS,
+    riscv_integral_image_q7(img_q7, ROWS, COLS, integral));
+  RISCV_BENCH("riscv_integral_box_q31", "q31", ROWS * COLS,
+    riscv_integral_box_q31(integral, ROWS, COLS, BOX, BOX, boxes));
+  RISCV_BENCH("box_nested_loops", "q7", ROWS * COLS,
+    for (r = 0; r <= ROWS - BOX; r++)
+      for (c = 0; c <= COLS - BOX; c++)
+        refBoxes[r * (COLS - BOX + 1) + c] = box_ref(r, c, BOX, BOX));
+  RISCV_BENCH("riscv_image_filter_h_q7", "q7", ROWS * COLS,
+    riscv_image_filter_h_q7(img_q7, ROWS, COLS, taps_q7, NUM_TAPS, 7, out_q7));
+  RISCV_BENCH("riscv_image_filter_v_q7", "q7", ROWS * COLS,
+    riscv_image_filter_v_q7(img_q7, ROWS, COLS, taps_q7, NUM_TAPS, 7, out_q7));
+  RISCV_BENCH("riscv_image_filter_h_q15", "q15", ROWS * COLS,
+    riscv_image_filter_h_q15(img_q15, ROWS, COLS, taps_q15, NUM_TAPS, 15, out_q15));
+  RISCV_BENCH("riscv_image_filter_v_q15", "q15", ROWS * COLS,
+    riscv_image_filter_v_q15(img_q15, ROWS, COLS, taps_q15, NUM_TAPS, 15, out_q15));
+
+  /* Box sums */
+  ok = (memcmp(boxes, refBoxes, sizeof(boxes)) == 0);
+  printf("CHECK riscv_integral_box_q31 %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  bad = 0;
+  for (n = 0; n < 200; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    r = (seed >> 8) % ROWS;
+    c = (seed >> 20) % COLS;
+    j = 1 + (seed >> 1) % (ROWS - r);
+    k = 1 + (seed >> 12) % (COLS - c);
+    bad += (riscv_integral_box_sum(integral, COLS, r, c, j, k) != box_ref(r, c, j, k));
+  }
+  bad += (riscv_integral_box_sum(integral, COLS, 0, 0, ROWS, COLS) != box_ref(0, 0, ROWS, COLS));
+  ok = (bad == 0);
+  printf("CHECK riscv_integral_box_sum: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  riscv_integral_image_q15(img_q15, ROWS, COLS, integral);
+  bad = 0;
+  for (r = 0; r <= ROWS; r += 5)
+    for (c = 0; c <= COLS; c += 3)
+    {
+      acc = 0;
+      for (j = 0; j < r; j++)
+        for (k = 0; k < c; k++)
+          acc += img_q15[j * COLS + k];
+      bad += (integral[r * (COLS + 1) + c] != acc);
+    }
+  ok = (bad == 0);
+  printf("CHECK riscv_integral_image_q15: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Horizontal and vertical passes */
+  riscv_image_filter_h_q7(img_q7, ROWS, COLS, taps_q7, NUM_TAPS, 7, out_q7);
+  riscv_image_filter_h_q15(img_q15, ROWS, COLS, taps_q15, NUM_TAPS, 15, out_q15);
+  bad = 0;
+  for (r = 0; r < ROWS; r++)
+    for (c = 0; c <= COLS - NUM_TAPS; c++)
+    {
+      acc = 0;
+      for (k = 0; k < NUM_TAPS; k++)
+        acc += (q31_t) taps_q7[k] * img_q7[r * COLS + c + k];
+      bad += (out_q7[r * (COLS - NUM_TAPS + 1) + c] != sat(acc >> 7, 128));
+      acc = 0;
+      for (k = 0; k < NUM_TAPS; k++)
+        acc += (q31_t) taps_q15[k] * img_q15[r * COLS + c + k];
+      bad += (out_q15[r * (COLS - NUM_TAPS + 1) + c] != sat(acc >> 15, 32768));
+    }
+  ok = (bad == 0);
+  printf("CHECK riscv_image_filter_h_q7/q15: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  riscv_image_filter_v_q7(img_q7, ROWS, COLS, taps_q7, NUM_TAPS, 7, out_q7);
+  riscv_image_filter_v_q15(img_q15, ROWS, COLS, taps_q15, NUM_TAPS, 15, out_q15);
+  bad = 0;
+  for (r = 0; r <= ROWS - NUM_TAPS; r++)
+    for (c = 0; c < COLS; c++)
+    {
+      acc = 0;
+      for (k = 0; k < NUM_TAPS; k++)
+        acc += (q31_t) taps_q7[k] * img_q7[(r + k) * COLS + c];
+      bad += (out_q7[r * COLS + c] != sat(acc >> 7, 128));
+      acc = 0;
+      for (k = 0; k < NUM_TAPS; k++)
+        acc += (q31_t) taps_q15[k] * img_q15[(r + k) * COLS + c];
+      bad += (out_q15[r * COLS + c] != sat(acc >> 15, 32768));
+    }
+  ok = (bad == 0);
+  printf("CHECK riscv_image_filter_v_q7/q15: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Separable Gaussian against the direct 2D filter, the Q7 frame widened to Q15 */
+  for (n = 0; n < ROWS * COLS; n++)
+  {
+    img_q15[n] = img_q7[n];
+  }
+  RISCV_BENCH("riscv_image_filter_hv_q15", "q15", ROWS * COLS,
+    riscv_image_filter_h_q15(img_q15, ROWS, COLS, gauss_q15, GAUSS_TAPS, 0, tmp_q15);
+    riscv_image_filter_v_q15(tmp_q15, ROWS, COLS - GAUSS_TAPS + 1, gauss_q15, GAUSS_TAPS, 8, out_q15));
+  RISCV_BENCH("riscv_image_filter_hv_q7", "q7", ROWS * COLS,
+    riscv_image_filter_h_q7(img_q7, ROWS, COLS, gauss_q7, GAUSS_TAPS, 4, tmp_q7);
+    riscv_image_filter_v_q7(tmp_q7, ROWS, COLS - GAUSS_TAPS + 1, gauss_q7, GAUSS_TAPS, 4, out_q7));
+
+  bad = 0;
+  maxErr = 0;
+  for (r = 0; r <= ROWS - GAUSS_TAPS; r++)
+    for (c = 0; c <= COLS - GAUSS_TAPS; c++)
+    {
+      acc = 0;
+      for (j = 0; j < GAUSS_TAPS; j++)
+        for (k = 0; k < GAUSS_TAPS; k++)
+          acc += (q31_t) gauss_q15[j] * gauss_q15[k] * img_q7[(r + j) * COLS + c + k];
+      n = r * (COLS - GAUSS_TAPS + 1) + c;
+      bad += (out_q15[n] != (acc >> 8));
+      d = out_q7[n] - sat(acc >> 8, 128);
+      d = (d < 0) ? -d : d;
+      maxErr = (d > maxErr) ? d : maxErr;
+    }
+  ok = (bad == 0) && (maxErr <= 1);
+  printf("CHECK separable Gaussian: %d Q15 mismatches, Q7 error %d LSB %s\n", (int) bad, (int) maxErr, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
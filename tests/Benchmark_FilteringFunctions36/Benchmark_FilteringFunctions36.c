@@ -0,0 +1,121 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define FS 16000.0f
+#define F0 220.0f
+#define WINDOW 512
+#define MIN_LAG 20
+#define MAX_LAG 400
+#define FRAME (WINDOW + MAX_LAG)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A frame of a F0 Hz tone with three harmonics at FS Hz, a period of 72.73 samples, is estimated by
+riscv_pitch_yin_f32() on the direct path and on the FFT path, which must agree with the true period
+within 0.1 sample, and by riscv_pitch_yin_q15(), within 0.2 sample.  The Q15 estimator is measured
+next to a plain loop over the squared differences of every lag.  A frame of white noise must come
+out unvoiced with an aperiodicity above the threshold.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions36"
+#include "../common/riscv_bench.h"
+
+float32_t frame_f32[FRAME], noise_f32[FRAME];
+q15_t frame_q15[FRAME] __attribute__((aligned(4))), noise_q15[FRAME] __attribute__((aligned(4)));
+float32_t diff_f32[MAX_LAG + 1], scratch[3 * 1024];
+q31_t diff_q15[MAX_LAG + 1];
+q63_t ref_diff[MAX_LAG + 1];
+
+int main(void)
+{
+  riscv_pitch_yin_instance_f32 Sd, Sf;
+  riscv_pitch_yin_instance_q15 Sq;
+  uint32_t seed = 5u, n, t;
+  int32_t fail = 0, ok;
+  float32_t period = FS / F0, pd = 0.0f, pf = 0.0f, pn, ad, an;
+  q31_t pq = 0, pqn;
+  q15_t aq, aqn;
+  q63_t sum;
+  q31_t e;
+
+  riscv_bench_header();
+
+  for (n = 0; n < FRAME; n++)
+  {
+    float32_t w = 2.0f * 3.14159265f * F0 * (float32_t) n / FS;
+    frame_f32[n] = 0.4f * sinf(w) + 0.25f * sinf(2.0f * w + 0.3f) + 0.15f * sinf(3.0f * w + 1.1f);
+    seed = seed * 1664525u + 1013904223u;
+    noise_f32[n] = ((float32_t) (seed >> 8) / 16777216.0f) - 0.5f;
+  }
+  riscv_float_to_q15(frame_f32, frame_q15, FRAME);
+  riscv_float_to_q15(noise_f32, noise_q15, FRAME);
+
+  ok = (riscv_pitch_yin_init_f32(&Sd, WINDOW, MIN_LAG, MAX_LAG, 0.15f, diff_f32, NULL) == RISCV_MATH_SUCCESS);
+  ok &= (riscv_pitch_yin_init_f32(&Sf, WINDOW, MIN_LAG, MAX_LAG, 0.15f, diff_f32, scratch) == RISCV_MATH_SUCCESS);
+  ok &= (riscv_pitch_yin_init_q15(&Sq, WINDOW, MIN_LAG, MAX_LAG, 0x1333, diff_q15) == RISCV_MATH_SUCCESS);
+  ok &= (Sd.fftLen == 0u) && (Sf.fftLen == 1024u);
+  ok &= (riscv_pitch_yin_init_q15(&Sq, WINDOW, 1, MAX_LAG, 0x1333, diff_q15) == RISCV_MATH_ARGUMENT_ERROR);
+  ok &= (riscv_pitch_yin_init_q15(&Sq, WINDOW, MAX_LAG + 1, MAX_LAG, 0x1333, diff_q15) == RISCV_MATH_ARGUMENT_ERROR);
+  riscv_pitch_yin_init_q15(&Sq, WINDOW, MIN_LAG, MAX_LAG, 0x1333, diff_q15);
+  printf("CHECK init %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  RISCV_BENCH("squared_differences_loop", "q15", WINDOW * MAX_LAG,
+    for (t = 1; t <= MAX_LAG; t++)
+    {
+      sum = 0;
+      for (n = 0; n < WINDOW; n++)
+      {
+        e = frame_q15[n] - frame_q15[n + t];
+        sum += e * e;
+      }
+      ref_diff[t] = sum;
+    });
+  RISCV_BENCH("riscv_pitch_yin_q15", "q15", WINDOW * MAX_LAG,
+    pq = riscv_pitch_yin_q15(&Sq, frame_q15, &aq));
+  RISCV_BENCH("riscv_pitch_yin_f32", "direct", WINDOW * MAX_LAG,
+    pd = riscv_pitch_yin_f32(&Sd, frame_f32, &ad));
+  RISCV_BENCH("riscv_pitch_yin_f32", "fft", WINDOW * MAX_LAG,
+    pf = riscv_pitch_yin_f32(&Sf, frame_f32, NULL));
+
+  /* The difference function of the Q15 estimator is the plain one, scaled */
+  ok = 1;
+  for (t = 1; t <= MAX_LAG; t++)
+  {
+    ok &= (diff_q15[t] == (q31_t) (ref_diff[t] >> (33 - __CLZ(WINDOW))));
+  }
+  printf("CHECK q15 difference function %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  ok = (fabsf(pd - period) < 0.1f) && (fabsf(pf - period) < 0.1f) && (ad < 0.15f);
+#if defined(PRINT_OUTPUT)
+  printf("period %f direct %f fft %f aperiodicity %f\n", period, pd, pf, ad);
+#endif
+  printf("CHECK f32 period %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  ok = (fabsf((float32_t) pq / 65536.0f - period) < 0.2f) && (aq < 0x1333);
+#if defined(PRINT_OUTPUT)
+  printf("q15 period %f aperiodicity %d\n", (float32_t) pq / 65536.0f, aq);
+#endif
+  printf("CHECK q15 period %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  pn = riscv_pitch_yin_f32(&Sf, noise_f32, &an);
+  pqn = riscv_pitch_yin_q15(&Sq, noise_q15, &aqn);
+  ok = (pn == 0.0f) && (an >= 0.15f) && (pqn == 0) && (aqn >= 0x1333);
+  printf("CHECK noise unvoiced %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
@@ -0,0 +1,99 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 128
+#define NUM_STAGES 3
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A block of BLOCK_SIZE interleaved stereo pairs goes through a NUM_STAGES stage cascade with
+riscv_biquad_cascade_stereo_df1_q15(), over two calls to check that the state carries over.  Each
+channel must equal riscv_biquad_cascade_df1_q15() on that channel alone bit for bit.  The stereo filter
+is measured next to two mono filters on planar data, and next to the deinterleave, two mono filters and
+interleave that stereo data needs without it.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions37"
+#include "../common/riscv_bench.h"
+
+/* Lowpass, peaking and highpass stages in 2.14 format, {b0, 0, b1, b2, a1, a2} */
+q15_t coeffs[6 * NUM_STAGES] __attribute__((aligned(4))) = {
+   1114, 0,  2228,   1114, 24546, -12618,
+  16802, 0, -28956,  13110, 28956, -13528,
+  14706, 0, -29412,  14706, 29170, -13271
+};
+q15_t stereo[2 * BLOCK_SIZE] __attribute__((aligned(4)));
+q15_t stereoOut[2 * BLOCK_SIZE] __attribute__((aligned(4)));
+q15_t left[BLOCK_SIZE] __attribute__((aligned(4))), right[BLOCK_SIZE] __attribute__((aligned(4)));
+q15_t leftOut[BLOCK_SIZE] __attribute__((aligned(4))), rightOut[BLOCK_SIZE] __attribute__((aligned(4)));
+q15_t stateS[8 * NUM_STAGES] __attribute__((aligned(4)));
+q15_t stateL[4 * NUM_STAGES] __attribute__((aligned(4))), stateR[4 * NUM_STAGES] __attribute__((aligned(4)));
+
+int main(void)
+{
+  riscv_biquad_cascade_stereo_df1_instance_q15 S;
+  riscv_biquad_casd_df1_inst_q15 SL, SR;
+  uint32_t seed = 3u, n, k;
+  int32_t fail = 0, ok;
+
+  riscv_bench_header();
+
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    left[n] = (q15_t) ((int32_t) (seed >> 16) - 32768) >> 1;
+    right[n] = (q15_t) (12000.0f * sinf(0.05f * (float32_t) n));
+    stereo[2 * n] = left[n];
+    stereo[2 * n + 1] = right[n];
+  }
+
+  RISCV_BENCH("riscv_biquad_cascade_stereo_df1_q15", "q15", BLOCK_SIZE,
+    riscv_biquad_cascade_stereo_df1_init_q15(&S, NUM_STAGES, coeffs, stateS, 1);
+    riscv_biquad_cascade_stereo_df1_q15(&S, stereo, stereoOut, BLOCK_SIZE));
+  RISCV_BENCH("riscv_biquad_cascade_df1_q15_x2", "q15", BLOCK_SIZE,
+    riscv_biquad_cascade_df1_init_q15(&SL, NUM_STAGES, coeffs, stateL, 1);
+    riscv_biquad_cascade_df1_init_q15(&SR, NUM_STAGES, coeffs, stateR, 1);
+    riscv_biquad_cascade_df1_q15(&SL, left, leftOut, BLOCK_SIZE);
+    riscv_biquad_cascade_df1_q15(&SR, right, rightOut, BLOCK_SIZE));
+  RISCV_BENCH("deinterleave_df1_q15_x2_interleave", "q15", BLOCK_SIZE,
+    riscv_biquad_cascade_df1_init_q15(&SL, NUM_STAGES, coeffs, stateL, 1);
+    riscv_biquad_cascade_df1_init_q15(&SR, NUM_STAGES, coeffs, stateR, 1);
+    for (n = 0; n < BLOCK_SIZE; n++) { left[n] = stereo[2 * n]; right[n] = stereo[2 * n + 1]; }
+    riscv_biquad_cascade_df1_q15(&SL, left, leftOut, BLOCK_SIZE);
+    riscv_biquad_cascade_df1_q15(&SR, right, rightOut, BLOCK_SIZE);
+    for (n = 0; n < BLOCK_SIZE; n++) { stereoOut[2 * n] = leftOut[n]; stereoOut[2 * n + 1] = rightOut[n]; });
+
+  /* Two calls of half a block against the mono filters, in place for the stereo one */
+  riscv_biquad_cascade_stereo_df1_init_q15(&S, NUM_STAGES, coeffs, stateS, 1);
+  riscv_biquad_cascade_df1_init_q15(&SL, NUM_STAGES, coeffs, stateL, 1);
+  riscv_biquad_cascade_df1_init_q15(&SR, NUM_STAGES, coeffs, stateR, 1);
+  memcpy(stereoOut, stereo, sizeof(stereo));
+  for (k = 0; k < 2; k++)
+  {
+    riscv_biquad_cascade_stereo_df1_q15(&S, stereoOut + k * BLOCK_SIZE, stereoOut + k * BLOCK_SIZE, BLOCK_SIZE / 2);
+    riscv_biquad_cascade_df1_q15(&SL, left + k * BLOCK_SIZE / 2, leftOut + k * BLOCK_SIZE / 2, BLOCK_SIZE / 2);
+    riscv_biquad_cascade_df1_q15(&SR, right + k * BLOCK_SIZE / 2, rightOut + k * BLOCK_SIZE / 2, BLOCK_SIZE / 2);
+  }
+  ok = 1;
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    ok &= (stereoOut[2 * n] == leftOut[n]) && (stereoOut[2 * n + 1] == rightOut[n]);
+#if defined(PRINT_OUTPUT)
+    printf("%d %d %d %d\n", stereoOut[2 * n], leftOut[n], stereoOut[2 * n + 1], rightOut[n]);
+#endif
+  }
+  printf("CHECK stereo equals two mono filters %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
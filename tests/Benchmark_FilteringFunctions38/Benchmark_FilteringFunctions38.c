@@ -0,0 +1,230 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 256
+#define NUM_COEFS 4
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_iir_halfband_design_f32() must give the coefficients of the elliptic half-band of NUM_COEFS
+coefficients and a transition of 0.1.  The decimator must keep a tone of 0.0625 of the input rate
+and remove one of 0.375 by 60 dB, the interpolator must keep a tone and remove its image by 60 dB,
+measured over the second half of the output, where the tones have whole periods.  The
+Q15 filters must stay within a few LSB of the floating-point ones, a stereo instance must give
+each channel of two mono instances bit for bit, with 4 and with 3 coefficients, and a block split
+over two calls must give the outputs of one call.  The benchmarks measure the filters next to a
+31-tap Q15 half-band FIR decimator, which reaches 66 dB only with twice the transition.  The CHECK
+lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions38"
+#include "../common/riscv_bench.h"
+
+/* Elliptic half-band of 4 coefficients and a transition of 0.1 */
+const float32_t refCoeffs[NUM_COEFS] = { 0.0798664f, 0.2838293f, 0.5453237f, 0.8344119f };
+
+/* Kaiser half-band FIR of 31 taps, 66 dB from 0.35 of the input rate, first half and center */
+q15_t firCoeffs[9] __attribute__((aligned(4))) = { -26, 96, -236, 481, -893, 1617, -3177, 10327, 16384 };
+
+float32_t coeffs_f32[NUM_COEFS];
+q15_t coeffs_q15[NUM_COEFS] __attribute__((aligned(4)));
+float32_t src_f32[2 * BLOCK_SIZE], dst_f32[4 * BLOCK_SIZE];
+q15_t src_q15[2 * BLOCK_SIZE] __attribute__((aligned(4))), dst_q15[4 * BLOCK_SIZE] __attribute__((aligned(4)));
+q15_t left_q15[BLOCK_SIZE] __attribute__((aligned(4))), right_q15[BLOCK_SIZE] __attribute__((aligned(4)));
+q15_t outL_q15[2 * BLOCK_SIZE] __attribute__((aligned(4))), outR_q15[2 * BLOCK_SIZE] __attribute__((aligned(4)));
+float32_t left_f32[BLOCK_SIZE], right_f32[BLOCK_SIZE], outL_f32[2 * BLOCK_SIZE], outR_f32[2 * BLOCK_SIZE];
+q15_t state_q15[3][2 * (NUM_COEFS + 2)] __attribute__((aligned(4)));
+float32_t state_f32[3][2 * (NUM_COEFS + 2)];
+q15_t firState[31 + BLOCK_SIZE - 1] __attribute__((aligned(4)));
+
+/* Amplitude of the tone of frequency f (cycles per sample) in the second half of x[0 ... len-1] */
+static float32_t tone(const float32_t * x, uint32_t len, float32_t f)
+{
+  float32_t re = 0.0f, im = 0.0f;
+  uint32_t n;
+
+  for (n = len / 2u; n < len; n++)
+  {
+    re += x[n] * cosf(2.0f * PI * f * (float32_t) n);
+    im += x[n] * sinf(2.0f * PI * f * (float32_t) n);
+  }
+
+  return (4.0f * sqrtf((re * re) + (im * im)) / (float32_t) len);
+}
+
+/* Stereo instance of numCoefs coefficients against two mono ones, decimator and interpolator */
+static int32_t check_stereo(uint8_t numCoefs)
+{
+  riscv_iir_halfband_instance_q15 S2, SL, SR;
+  riscv_iir_halfband_instance_f32 F2, FL, FR;
+  uint32_t n;
+  int32_t bad = 0;
+
+  riscv_iir_halfband_init_q15(&S2, numCoefs, 2u, coeffs_q15, state_q15[0]);
+  riscv_iir_halfband_init_q15(&SL, numCoefs, 1u, coeffs_q15, state_q15[1]);
+  riscv_iir_halfband_init_q15(&SR, numCoefs, 1u, coeffs_q15, state_q15[2]);
+  riscv_iir_halfband_decimate_q15(&S2, src_q15, dst_q15, BLOCK_SIZE);
+  riscv_iir_halfband_decimate_q15(&SL, left_q15, outL_q15, BLOCK_SIZE);
+  riscv_iir_halfband_decimate_q15(&SR, right_q15, outR_q15, BLOCK_SIZE);
+  for (n = 0u; n < BLOCK_SIZE / 2u; n++)
+  {
+    bad += (dst_q15[2u * n] != outL_q15[n]) + (dst_q15[(2u * n) + 1u] != outR_q15[n]);
+  }
+
+  riscv_iir_halfband_init_q15(&S2, numCoefs, 2u, coeffs_q15, state_q15[0]);
+  riscv_iir_halfband_init_q15(&SL, numCoefs, 1u, coeffs_q15, state_q15[1]);
+  riscv_iir_halfband_init_q15(&SR, numCoefs, 1u, coeffs_q15, state_q15[2]);
+  riscv_iir_halfband_interpolate_q15(&S2, src_q15, dst_q15, BLOCK_SIZE);
+  riscv_iir_halfband_interpolate_q15(&SL, left_q15, outL_q15, BLOCK_SIZE);
+  riscv_iir_halfband_interpolate_q15(&SR, right_q15, outR_q15, BLOCK_SIZE);
+  for (n = 0u; n < 2u * BLOCK_SIZE; n++)
+  {
+    bad += (dst_q15[2u * n] != outL_q15[n]) + (dst_q15[(2u * n) + 1u] != outR_q15[n]);
+  }
+
+  riscv_iir_halfband_init_f32(&F2, numCoefs, 2u, coeffs_f32, state_f32[0]);
+  riscv_iir_halfband_init_f32(&FL, numCoefs, 1u, coeffs_f32, state_f32[1]);
+  riscv_iir_halfband_init_f32(&FR, numCoefs, 1u, coeffs_f32, state_f32[2]);
+  riscv_iir_halfband_decimate_f32(&F2, src_f32, dst_f32, BLOCK_SIZE);
+  riscv_iir_halfband_decimate_f32(&FL, left_f32, outL_f32, BLOCK_SIZE);
+  riscv_iir_halfband_decimate_f32(&FR, right_f32, outR_f32, BLOCK_SIZE);
+  for (n = 0u; n < BLOCK_SIZE / 2u; n++)
+  {
+    bad += (dst_f32[2u * n] != outL_f32[n]) + (dst_f32[(2u * n) + 1u] != outR_f32[n]);
+  }
+
+  riscv_iir_halfband_init_f32(&F2, numCoefs, 2u, coeffs_f32, state_f32[0]);
+  riscv_iir_halfband_init_f32(&FL, numCoefs, 1u, coeffs_f32, state_f32[1]);
+  riscv_iir_halfband_init_f32(&FR, numCoefs, 1u, coeffs_f32, state_f32[2]);
+  riscv_iir_halfband_interpolate_f32(&F2, src_f32, dst_f32, BLOCK_SIZE);
+  riscv_iir_halfband_interpolate_f32(&FL, left_f32, outL_f32, BLOCK_SIZE);
+  riscv_iir_halfband_interpolate_f32(&FR, right_f32, outR_f32, BLOCK_SIZE);
+  for (n = 0u; n < 2u * BLOCK_SIZE; n++)
+  {
+    bad += (dst_f32[2u * n] != outL_f32[n]) + (dst_f32[(2u * n) + 1u] != outR_f32[n]);
+  }
+
+  return bad;
+}
+
+int main(void)
+{
+  riscv_iir_halfband_instance_q15 S;
+  riscv_iir_halfband_instance_f32 F;
+  riscv_fir_halfband_instance_q15 H;
+  uint32_t n, seed = 38u;
+  int32_t fail = 0, ok, bad;
+  float32_t keep, reject, err;
+
+  riscv_bench_header();
+
+  ok = (riscv_iir_halfband_design_f32(NUM_COEFS, 0.1f, coeffs_f32) == RISCV_MATH_SUCCESS);
+  for (n = 0u; n < NUM_COEFS; n++)
+  {
+    ok = ok && (fabsf(coeffs_f32[n] - refCoeffs[n]) < 1e-4f);
+  }
+  ok = ok && (riscv_iir_halfband_design_f32(0u, 0.1f, coeffs_f32) == RISCV_MATH_ARGUMENT_ERROR);
+  ok = ok && (riscv_iir_halfband_design_f32(NUM_COEFS, 0.5f, coeffs_f32) == RISCV_MATH_ARGUMENT_ERROR);
+  ok = ok && (riscv_iir_halfband_init_q15(&S, NUM_COEFS, 3u, coeffs_q15, state_q15[0]) == RISCV_MATH_ARGUMENT_ERROR);
+  riscv_iir_halfband_design_f32(NUM_COEFS, 0.1f, coeffs_f32);
+  riscv_float_to_q15(coeffs_f32, coeffs_q15, NUM_COEFS);
+  printf("CHECK design %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Tones of 0.0625 and 0.375 of the input rate, the second one aliases to 0.25 of the output rate */
+  for (n = 0u; n < 2u * BLOCK_SIZE; n++)
+  {
+    src_f32[n] = 0.4f * sinf(2.0f * PI * 0.0625f * (float32_t) n) + 0.4f * sinf(2.0f * PI * 0.375f * (float32_t) n);
+  }
+  riscv_float_to_q15(src_f32, src_q15, 2u * BLOCK_SIZE);
+
+  riscv_iir_halfband_init_f32(&F, NUM_COEFS, 1u, coeffs_f32, state_f32[0]);
+  riscv_iir_halfband_decimate_f32(&F, src_f32, dst_f32, 2u * BLOCK_SIZE);
+  keep = tone(dst_f32, BLOCK_SIZE, 0.125f);
+  reject = tone(dst_f32, BLOCK_SIZE, 0.25f);
+  ok = (fabsf(keep - 0.4f) < 0.004f) && (reject < 0.0004f);
+
+  riscv_iir_halfband_init_q15(&S, NUM_COEFS, 1u, coeffs_q15, state_q15[0]);
+  riscv_iir_halfband_decimate_q15(&S, src_q15, dst_q15, 2u * BLOCK_SIZE);
+  err = 0.0f;
+  for (n = 0u; n < BLOCK_SIZE; n++)
+  {
+    err = fmaxf(err, fabsf(((float32_t) dst_q15[n] / 32768.0f) - dst_f32[n]));
+  }
+  ok = ok && (err < 8.0f / 32768.0f);
+  printf("CHECK decimate tones %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Tone of 0.125 of the input rate, the image at 0.4375 of the output rate must go */
+  riscv_iir_halfband_init_f32(&F, NUM_COEFS, 1u, coeffs_f32, state_f32[0]);
+  for (n = 0u; n < BLOCK_SIZE; n++)
+  {
+    src_f32[n] = 0.8f * sinf(2.0f * PI * 0.125f * (float32_t) n);
+  }
+  riscv_float_to_q15(src_f32, src_q15, BLOCK_SIZE);
+  riscv_iir_halfband_interpolate_f32(&F, src_f32, dst_f32, BLOCK_SIZE);
+  keep = tone(dst_f32, 2u * BLOCK_SIZE, 0.0625f);
+  reject = tone(dst_f32, 2u * BLOCK_SIZE, 0.4375f);
+  ok = (fabsf(keep - 0.8f) < 0.008f) && (reject < 0.0008f);
+
+  riscv_iir_halfband_init_q15(&S, NUM_COEFS, 1u, coeffs_q15, state_q15[0]);
+  riscv_iir_halfband_interpolate_q15(&S, src_q15, outL_q15, BLOCK_SIZE / 2u);
+  riscv_iir_halfband_interpolate_q15(&S, src_q15 + (BLOCK_SIZE / 2u), outL_q15 + BLOCK_SIZE, BLOCK_SIZE / 2u);
+  riscv_iir_halfband_init_q15(&S, NUM_COEFS, 1u, coeffs_q15, state_q15[0]);
+  riscv_iir_halfband_interpolate_q15(&S, src_q15, dst_q15, BLOCK_SIZE);
+  err = 0.0f;
+  for (n = 0u; n < 2u * BLOCK_SIZE; n++)
+  {
+    err = fmaxf(err, fabsf(((float32_t) dst_q15[n] / 32768.0f) - dst_f32[n]));
+    ok = ok && (dst_q15[n] == outL_q15[n]);
+  }
+  ok = ok && (err < 8.0f / 32768.0f);
+  printf("CHECK interpolate image %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Random stereo pairs, including the limits of Q15 */
+  for (n = 0u; n < BLOCK_SIZE; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    left_q15[n] = (q15_t) (seed >> 16);
+    seed = seed * 1664525u + 1013904223u;
+    right_q15[n] = (q15_t) (seed >> 16);
+  }
+  left_q15[5] = -32768;
+  right_q15[6] = 32767;
+  for (n = 0u; n < BLOCK_SIZE; n++)
+  {
+    src_q15[2u * n] = left_q15[n];
+    src_q15[(2u * n) + 1u] = right_q15[n];
+  }
+  riscv_q15_to_float(left_q15, left_f32, BLOCK_SIZE);
+  riscv_q15_to_float(right_q15, right_f32, BLOCK_SIZE);
+  riscv_q15_to_float(src_q15, src_f32, 2u * BLOCK_SIZE);
+  bad = check_stereo(NUM_COEFS) + check_stereo(NUM_COEFS - 1u);
+  ok = (bad == 0);
+  printf("CHECK stereo %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  riscv_iir_halfband_init_q15(&S, NUM_COEFS, 1u, coeffs_q15, state_q15[0]);
+  RISCV_BENCH("riscv_iir_halfband_decimate_q15", "q15", BLOCK_SIZE, riscv_iir_halfband_decimate_q15(&S, left_q15, outL_q15, BLOCK_SIZE));
+  riscv_fir_halfband_decimate_init_q15(&H, 31u, firCoeffs, firState, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_halfband_decimate_q15", "q15", BLOCK_SIZE, riscv_fir_halfband_decimate_q15(&H, left_q15, outL_q15, BLOCK_SIZE));
+  riscv_iir_halfband_init_q15(&S, NUM_COEFS, 2u, coeffs_q15, state_q15[0]);
+  RISCV_BENCH("riscv_iir_halfband_decimate_q15_stereo", "q15", BLOCK_SIZE, riscv_iir_halfband_decimate_q15(&S, src_q15, dst_q15, BLOCK_SIZE));
+  riscv_iir_halfband_init_q15(&S, NUM_COEFS, 1u, coeffs_q15, state_q15[0]);
+  RISCV_BENCH("riscv_iir_halfband_interpolate_q15", "q15", BLOCK_SIZE, riscv_iir_halfband_interpolate_q15(&S, left_q15, outL_q15, BLOCK_SIZE));
+  riscv_iir_halfband_init_f32(&F, NUM_COEFS, 1u, coeffs_f32, state_f32[0]);
+  RISCV_BENCH("riscv_iir_halfband_decimate_f32", "f32", BLOCK_SIZE, riscv_iir_halfband_decimate_f32(&F, left_f32, outL_f32, BLOCK_SIZE));
+  RISCV_BENCH("riscv_iir_halfband_interpolate_f32", "f32", BLOCK_SIZE, riscv_iir_halfband_interpolate_f32(&F, left_f32, outL_f32, BLOCK_SIZE));
+
+  return (fail);
+}
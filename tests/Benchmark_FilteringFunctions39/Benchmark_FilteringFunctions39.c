@@ -0,0 +1,248 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 64
+#define NUM_BLOCKS 3
+#define NUM_STREAMS 4
+#define NUM_TAPS 32
+#define NUM_STAGES 2
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*NUM_STREAMS streams share one copy of the FIR and Biquad DF1 coefficients of every type.  Each
+block is forked over NUM_STREAMS cores with riscv_par_fork_seq(), core i running stream i with its
+own state, and every stream must give the outputs of a riscv_fir_* or riscv_biquad_cascade_df1_*
+instance of its own bit for bit, over NUM_BLOCKS blocks.  The init functions must refuse 0 taps
+and 0 stages.  The benchmarks compare a shared stream with its plain instance.  The CHECK lines
+must report ok.
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions39"
+#include "../common/riscv_bench.h"
+
+/* {b0, 0, b1, b2, a1, a2} per stage with a postShift of 1: b = {0.1, 0.2, 0.1}, a1 = 1, a2 = -0.5 */
+const q15_t biquadCoeffs_q15[6 * NUM_STAGES] __attribute__((aligned(4))) = {
+  1638, 0, 3277, 1638, 16384, -8192,
+  1638, 0, 3277, 1638, 16384, -8192 };
+
+q15_t firCoeffs_q15[NUM_TAPS] __attribute__((aligned(4)));
+q31_t firCoeffs_q31[NUM_TAPS];
+float32_t firCoeffs_f32[NUM_TAPS];
+q31_t biquadCoeffs_q31[5 * NUM_STAGES];
+float32_t biquadCoeffs_f32[5 * NUM_STAGES];
+
+q15_t src_q15[NUM_STREAMS][BLOCK_SIZE] __attribute__((aligned(4)));
+q15_t dst_q15[NUM_STREAMS][BLOCK_SIZE] __attribute__((aligned(4)));
+q15_t ref_q15[BLOCK_SIZE] __attribute__((aligned(4)));
+q31_t src_q31[NUM_STREAMS][BLOCK_SIZE], dst_q31[NUM_STREAMS][BLOCK_SIZE], ref_q31[BLOCK_SIZE];
+float32_t src_f32[NUM_STREAMS][BLOCK_SIZE], dst_f32[NUM_STREAMS][BLOCK_SIZE], ref_f32[BLOCK_SIZE];
+
+/* State of the shared streams and of the plain instances */
+q15_t firState_q15[2][NUM_STREAMS][NUM_TAPS + BLOCK_SIZE] __attribute__((aligned(4)));
+q31_t firState_q31[2][NUM_STREAMS][NUM_TAPS + BLOCK_SIZE];
+float32_t firState_f32[2][NUM_STREAMS][NUM_TAPS + BLOCK_SIZE];
+q15_t biquadState_q15[2][NUM_STREAMS][4 * NUM_STAGES] __attribute__((aligned(4)));
+q31_t biquadState_q31[2][NUM_STREAMS][4 * NUM_STAGES];
+float32_t biquadState_f32[2][NUM_STREAMS][4 * NUM_STAGES];
+
+riscv_fir_shared_coefs_q15 firCoefs_q15;
+riscv_fir_shared_coefs_q31 firCoefs_q31;
+riscv_fir_shared_coefs_f32 firCoefs_f32;
+riscv_biquad_casd_df1_shared_coefs_q15 biquadCoefs_q15;
+riscv_biquad_casd_df1_shared_coefs_q31 biquadCoefs_q31;
+riscv_biquad_casd_df1_shared_coefs_f32 biquadCoefs_f32;
+
+riscv_fir_shared_state_q15 firStream_q15[NUM_STREAMS];
+riscv_fir_shared_state_q31 firStream_q31[NUM_STREAMS];
+riscv_fir_shared_state_f32 firStream_f32[NUM_STREAMS];
+riscv_biquad_casd_df1_shared_state_q15 biquadStream_q15[NUM_STREAMS];
+riscv_biquad_casd_df1_shared_state_q31 biquadStream_q31[NUM_STREAMS];
+riscv_biquad_casd_df1_shared_state_f32 biquadStream_f32[NUM_STREAMS];
+
+riscv_fir_instance_q15 fir_q15[NUM_STREAMS];
+riscv_fir_instance_q31 fir_q31[NUM_STREAMS];
+riscv_fir_instance_f32 fir_f32[NUM_STREAMS];
+riscv_biquad_casd_df1_inst_q15 biquad_q15[NUM_STREAMS];
+riscv_biquad_casd_df1_inst_q31 biquad_q31[NUM_STREAMS];
+riscv_biquad_casd_df1_inst_f32 biquad_f32[NUM_STREAMS];
+
+enum { FIR_Q15, FIR_Q31, FIR_F32, BIQUAD_Q15, BIQUAD_Q31, BIQUAD_F32, NUM_FILTERS };
+
+const char * const filterNames[NUM_FILTERS] = {
+  "fir q15", "fir q31", "fir f32", "biquad q15", "biquad q31", "biquad f32" };
+
+/* Runs the stream of the core on the filter *arg */
+static void run_stream(void * arg, uint32_t coreId, uint32_t numCores)
+{
+  (void) numCores;
+
+  switch (*(const int *) arg)
+  {
+  case FIR_Q15:
+    riscv_fir_shared_q15(&firStream_q15[coreId], src_q15[coreId], dst_q15[coreId], BLOCK_SIZE);
+    break;
+  case FIR_Q31:
+    riscv_fir_shared_q31(&firStream_q31[coreId], src_q31[coreId], dst_q31[coreId], BLOCK_SIZE);
+    break;
+  case FIR_F32:
+    riscv_fir_shared_f32(&firStream_f32[coreId], src_f32[coreId], dst_f32[coreId], BLOCK_SIZE);
+    break;
+  case BIQUAD_Q15:
+    riscv_biquad_cascade_df1_shared_q15(&biquadStream_q15[coreId], src_q15[coreId], dst_q15[coreId], BLOCK_SIZE);
+    break;
+  case BIQUAD_Q31:
+    riscv_biquad_cascade_df1_shared_q31(&biquadStream_q31[coreId], src_q31[coreId], dst_q31[coreId], BLOCK_SIZE);
+    break;
+  default:
+    riscv_biquad_cascade_df1_shared_f32(&biquadStream_f32[coreId], src_f32[coreId], dst_f32[coreId], BLOCK_SIZE);
+    break;
+  }
+}
+
+/* Filters one block of every stream with its plain instance, returns the mismatching samples */
+static uint32_t check_streams(int filter)
+{
+  uint32_t i, bad = 0u;
+
+  for (i = 0u; i < NUM_STREAMS; i++)
+  {
+    switch (filter)
+    {
+    case FIR_Q15:
+      riscv_fir_q15(&fir_q15[i], src_q15[i], ref_q15, BLOCK_SIZE);
+      bad += (memcmp(ref_q15, dst_q15[i], sizeof(ref_q15)) != 0);
+      break;
+    case FIR_Q31:
+      riscv_fir_q31(&fir_q31[i], src_q31[i], ref_q31, BLOCK_SIZE);
+      bad += (memcmp(ref_q31, dst_q31[i], sizeof(ref_q31)) != 0);
+      break;
+    case FIR_F32:
+      riscv_fir_f32(&fir_f32[i], src_f32[i], ref_f32, BLOCK_SIZE);
+      bad += (memcmp(ref_f32, dst_f32[i], sizeof(ref_f32)) != 0);
+      break;
+    case BIQUAD_Q15:
+      riscv_biquad_cascade_df1_q15(&biquad_q15[i], src_q15[i], ref_q15, BLOCK_SIZE);
+      bad += (memcmp(ref_q15, dst_q15[i], sizeof(ref_q15)) != 0);
+      break;
+    case BIQUAD_Q31:
+      riscv_biquad_cascade_df1_q31(&biquad_q31[i], src_q31[i], ref_q31, BLOCK_SIZE);
+      bad += (memcmp(ref_q31, dst_q31[i], sizeof(ref_q31)) != 0);
+      break;
+    default:
+      riscv_biquad_cascade_df1_f32(&biquad_f32[i], src_f32[i], ref_f32, BLOCK_SIZE);
+      bad += (memcmp(ref_f32, dst_f32[i], sizeof(ref_f32)) != 0);
+      break;
+    }
+  }
+
+  return (bad);
+}
+
+int main(void)
+{
+  riscv_par_instance P;
+  uint32_t i, n, seed = 39u;
+  int32_t fail = 0, ok;
+  int filter;
+
+  riscv_bench_header();
+
+  /* Random FIR coefficients of about 1/NUM_TAPS */
+  for (n = 0u; n < NUM_TAPS; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    firCoeffs_q15[n] = (q15_t) ((int32_t) (seed >> 16) - 32768) / NUM_TAPS;
+    firCoeffs_q31[n] = (q31_t) firCoeffs_q15[n] << 16;
+  }
+  riscv_q15_to_float(firCoeffs_q15, firCoeffs_f32, NUM_TAPS);
+
+  /* The Q15 biquad without the zero, scaled back by the postShift for f32 */
+  for (n = 0u; n < NUM_STAGES; n++)
+  {
+    for (i = 0u; i < 5u; i++)
+    {
+      q15_t c = biquadCoeffs_q15[(6u * n) + i + (i > 0u)];
+      biquadCoeffs_q31[(5u * n) + i] = (q31_t) c << 16;
+      biquadCoeffs_f32[(5u * n) + i] = (float32_t) c / 16384.0f;
+    }
+  }
+
+  ok = (riscv_fir_shared_coefs_init_q15(&firCoefs_q15, NUM_TAPS, firCoeffs_q15) == RISCV_MATH_SUCCESS);
+  ok = ok && (riscv_fir_shared_coefs_init_q31(&firCoefs_q31, NUM_TAPS, firCoeffs_q31) == RISCV_MATH_SUCCESS);
+  ok = ok && (riscv_fir_shared_coefs_init_f32(&firCoefs_f32, NUM_TAPS, firCoeffs_f32) == RISCV_MATH_SUCCESS);
+  ok = ok && (riscv_biquad_cascade_df1_shared_coefs_init_q15(&biquadCoefs_q15, NUM_STAGES, biquadCoeffs_q15, 1) == RISCV_MATH_SUCCESS);
+  ok = ok && (riscv_biquad_cascade_df1_shared_coefs_init_q31(&biquadCoefs_q31, NUM_STAGES, biquadCoeffs_q31, 1) == RISCV_MATH_SUCCESS);
+  ok = ok && (riscv_biquad_cascade_df1_shared_coefs_init_f32(&biquadCoefs_f32, NUM_STAGES, biquadCoeffs_f32) == RISCV_MATH_SUCCESS);
+  ok = ok && (riscv_par_init(&P, NUM_STREAMS, riscv_par_fork_seq) == RISCV_MATH_SUCCESS);
+
+  for (i = 0u; i < NUM_STREAMS; i++)
+  {
+    riscv_fir_shared_state_init_q15(&firStream_q15[i], &firCoefs_q15, firState_q15[0][i], BLOCK_SIZE);
+    riscv_fir_shared_state_init_q31(&firStream_q31[i], &firCoefs_q31, firState_q31[0][i], BLOCK_SIZE);
+    riscv_fir_shared_state_init_f32(&firStream_f32[i], &firCoefs_f32, firState_f32[0][i], BLOCK_SIZE);
+    riscv_biquad_cascade_df1_shared_state_init_q15(&biquadStream_q15[i], &biquadCoefs_q15, biquadState_q15[0][i]);
+    riscv_biquad_cascade_df1_shared_state_init_q31(&biquadStream_q31[i], &biquadCoefs_q31, biquadState_q31[0][i]);
+    riscv_biquad_cascade_df1_shared_state_init_f32(&biquadStream_f32[i], &biquadCoefs_f32, biquadState_f32[0][i]);
+
+    riscv_fir_init_q15(&fir_q15[i], NUM_TAPS, firCoeffs_q15, firState_q15[1][i], BLOCK_SIZE);
+    riscv_fir_init_q31(&fir_q31[i], NUM_TAPS, firCoeffs_q31, firState_q31[1][i], BLOCK_SIZE);
+    riscv_fir_init_f32(&fir_f32[i], NUM_TAPS, firCoeffs_f32, firState_f32[1][i], BLOCK_SIZE);
+    riscv_biquad_cascade_df1_init_q15(&biquad_q15[i], NUM_STAGES, (q15_t *) biquadCoeffs_q15, biquadState_q15[1][i], 1);
+    riscv_biquad_cascade_df1_init_q31(&biquad_q31[i], NUM_STAGES, biquadCoeffs_q31, biquadState_q31[1][i], 1);
+    riscv_biquad_cascade_df1_init_f32(&biquad_f32[i], NUM_STAGES, biquadCoeffs_f32, biquadState_f32[1][i]);
+  }
+  printf("CHECK init %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Every filter over NUM_BLOCKS blocks of random input, a different one for every stream */
+  for (filter = 0; filter < NUM_FILTERS; filter++)
+  {
+    uint32_t bad = 0u;
+
+    for (n = 0u; n < NUM_BLOCKS; n++)
+    {
+      for (i = 0u; i < NUM_STREAMS * BLOCK_SIZE; i++)
+      {
+        seed = seed * 1664525u + 1013904223u;
+        src_q15[i / BLOCK_SIZE][i % BLOCK_SIZE] = (q15_t) (seed >> 17);
+        src_q31[i / BLOCK_SIZE][i % BLOCK_SIZE] = (q31_t) (seed >> 1) - 0x40000000;
+      }
+      riscv_q15_to_float(src_q15[0], src_f32[0], NUM_STREAMS * BLOCK_SIZE);
+
+      P.fork(P.numCores, run_stream, &filter);
+      bad += check_streams(filter);
+    }
+
+    ok = (bad == 0u);
+    printf("CHECK shared %s %s\n", filterNames[filter], ok ? "ok" : "bad");
+    fail |= !ok;
+  }
+
+  ok = (riscv_fir_shared_coefs_init_q15(&firCoefs_q15, 0u, firCoeffs_q15) == RISCV_MATH_ARGUMENT_ERROR);
+  ok = ok && (riscv_fir_shared_coefs_init_q31(&firCoefs_q31, 0u, firCoeffs_q31) == RISCV_MATH_ARGUMENT_ERROR);
+  ok = ok && (riscv_fir_shared_coefs_init_f32(&firCoefs_f32, 0u, firCoeffs_f32) == RISCV_MATH_ARGUMENT_ERROR);
+  ok = ok && (riscv_biquad_cascade_df1_shared_coefs_init_q15(&biquadCoefs_q15, 0u, biquadCoeffs_q15, 1) == RISCV_MATH_ARGUMENT_ERROR);
+  ok = ok && (riscv_biquad_cascade_df1_shared_coefs_init_q31(&biquadCoefs_q31, 0u, biquadCoeffs_q31, 1) == RISCV_MATH_ARGUMENT_ERROR);
+  ok = ok && (riscv_biquad_cascade_df1_shared_coefs_init_f32(&biquadCoefs_f32, 0u, biquadCoeffs_f32) == RISCV_MATH_ARGUMENT_ERROR);
+  printf("CHECK arguments %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  riscv_fir_shared_coefs_init_q15(&firCoefs_q15, NUM_TAPS, firCoeffs_q15);
+  riscv_biquad_cascade_df1_shared_coefs_init_q15(&biquadCoefs_q15, NUM_STAGES, biquadCoeffs_q15, 1);
+  RISCV_BENCH("riscv_fir_q15", "q15", BLOCK_SIZE, riscv_fir_q15(&fir_q15[0], src_q15[0], ref_q15, BLOCK_SIZE));
+  RISCV_BENCH("riscv_fir_shared_q15", "q15", BLOCK_SIZE, riscv_fir_shared_q15(&firStream_q15[0], src_q15[0], dst_q15[0], BLOCK_SIZE));
+  RISCV_BENCH("riscv_biquad_cascade_df1_q15", "q15", BLOCK_SIZE, riscv_biquad_cascade_df1_q15(&biquad_q15[0], src_q15[0], ref_q15, BLOCK_SIZE));
+  RISCV_BENCH("riscv_biquad_cascade_df1_shared_q15", "q15", BLOCK_SIZE, riscv_biquad_cascade_df1_shared_q15(&biquadStream_q15[0], src_q15[0], dst_q15[0], BLOCK_SIZE));
+  RISCV_BENCH("riscv_fir_shared_f32", "f32", BLOCK_SIZE, riscv_fir_shared_f32(&firStream_f32[0], src_f32[0], dst_f32[0], BLOCK_SIZE));
+
+  return (fail);
+}
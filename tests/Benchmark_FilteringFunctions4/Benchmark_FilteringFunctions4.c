@@ -7,7 +7,6 @@
 #include "bar.h"
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 
 
 #define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
@@ -20,29 +19,14 @@ printf("\n\n")
 #define M 4
 #define CONV_BLOCKSIZE   ((2*MAX_BLOCKSIZE) - 1)
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
-*Also the correct results are printed for the current vectors which are calculated from the orignal library 
+*Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "FilteringFunctions4"
+#include "../common/riscv_bench.h"
  float32_t srcA_buf_f32[MAX_BLOCKSIZE] =
 {
   -0.4325648115282207,  -1.6655843782380970,  0.1253323064748307,
@@ -218,6 +202,7 @@ int i = 0 ;
 
 int32_t main(void)
 {
+  riscv_bench_header();
 
  /*Init*/ 
  /*Finite Impulse Response (FIR) Decimator Init*/
@@ -226,133 +211,91 @@ int32_t main(void)
   riscv_fir_decimate_init_q31(&S_decimate_q31,NUMTAPS, M,coeffs_decimate_q31,state_decimate_q31,MAX_BLOCKSIZE );
 /*correlate*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_correlate_f32(srcA_buf_f32, MAX_BLOCKSIZE, srcB_buf_f32, MAX_BLOCKSIZE, conv_result_f32 );
-  perf_stop();
-  printf("riscv_correlate_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_correlate_f32", "f32", MAX_BLOCKSIZE,
+    riscv_correlate_f32(srcA_buf_f32, MAX_BLOCKSIZE, srcB_buf_f32, MAX_BLOCKSIZE, conv_result_f32 ));
 #ifdef PRINT_OUTPUT
   PRINT_F32(conv_result_f32,CONV_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_correlate_q7(srcA_buf_q7, MAX_BLOCKSIZE, srcB_buf_q7, MAX_BLOCKSIZE, conv_result_q7 );
-  perf_stop();
-  printf("riscv_correlate_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_correlate_q7", "q7", MAX_BLOCKSIZE,
+    riscv_correlate_q7(srcA_buf_q7, MAX_BLOCKSIZE, srcB_buf_q7, MAX_BLOCKSIZE, conv_result_q7 ));
 #ifdef PRINT_OUTPUT
   PRINT_Q(conv_result_q7,CONV_BLOCKSIZE);
 #endif
 
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_correlate_q15(srcA_buf_q15, MAX_BLOCKSIZE, srcB_buf_q15, MAX_BLOCKSIZE, conv_result_q15 );
-  perf_stop();
-  printf("riscv_correlate_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_correlate_q15", "q15", MAX_BLOCKSIZE,
+    riscv_correlate_q15(srcA_buf_q15, MAX_BLOCKSIZE, srcB_buf_q15, MAX_BLOCKSIZE, conv_result_q15 ));
 #ifdef PRINT_OUTPUT
   PRINT_Q(conv_result_q15,CONV_BLOCKSIZE);
 #endif 
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_correlate_q31(srcA_buf_q31, MAX_BLOCKSIZE, srcB_buf_q31, MAX_BLOCKSIZE, conv_result_q31 );
-  perf_stop();
-  printf("riscv_correlate_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_correlate_q31", "q31", MAX_BLOCKSIZE,
+    riscv_correlate_q31(srcA_buf_q31, MAX_BLOCKSIZE, srcB_buf_q31, MAX_BLOCKSIZE, conv_result_q31 ));
 #ifdef PRINT_OUTPUT
   PRINT_Q(conv_result_q31,CONV_BLOCKSIZE);
 #endif
 
- perf_reset();
-  perf_enable_id(EVENT_ID);	
- riscv_correlate_opt_q7(srcA_buf_q7, MAX_BLOCKSIZE, srcB_buf_q7, MAX_BLOCKSIZE, conv_result_q7,scratch1,scratch2 );
- perf_stop();
-  printf("riscv_correlate_opt_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+ RISCV_BENCH("riscv_correlate_opt_q7", "q7", MAX_BLOCKSIZE,
+   riscv_correlate_opt_q7(srcA_buf_q7, MAX_BLOCKSIZE, srcB_buf_q7, MAX_BLOCKSIZE, conv_result_q7,scratch1,scratch2 ));
 #ifdef PRINT_OUTPUT
   PRINT_Q(conv_result_q7,CONV_BLOCKSIZE);
 #endif 
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_correlate_fast_q15(srcA_buf_q15, MAX_BLOCKSIZE, srcB_buf_q15, MAX_BLOCKSIZE, conv_result_q15 );
-  perf_stop();
-  printf("riscv_correlate_fast_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_correlate_fast_q15", "q15", MAX_BLOCKSIZE,
+    riscv_correlate_fast_q15(srcA_buf_q15, MAX_BLOCKSIZE, srcB_buf_q15, MAX_BLOCKSIZE, conv_result_q15 ));
 #ifdef PRINT_OUTPUT
   PRINT_Q(conv_result_q15,CONV_BLOCKSIZE);
 #endif
  
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_correlate_opt_q15(srcA_buf_q15, MAX_BLOCKSIZE, srcB_buf_q15, MAX_BLOCKSIZE, conv_result_q15 ,scratch1);
-  perf_stop();
-  printf("riscv_correlate_opt_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_correlate_opt_q15", "q15", MAX_BLOCKSIZE,
+    riscv_correlate_opt_q15(srcA_buf_q15, MAX_BLOCKSIZE, srcB_buf_q15, MAX_BLOCKSIZE, conv_result_q15 ,scratch1));
 #ifdef PRINT_OUTPUT
   PRINT_Q(conv_result_q15,CONV_BLOCKSIZE);
 #endif 
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_correlate_fast_opt_q15(srcA_buf_q15, MAX_BLOCKSIZE, srcB_buf_q15, MAX_BLOCKSIZE, conv_result_q15,scratch1);
-  perf_stop();
-  printf("riscv_correlate_fast_opt_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_correlate_fast_opt_q15", "q15", MAX_BLOCKSIZE,
+    riscv_correlate_fast_opt_q15(srcA_buf_q15, MAX_BLOCKSIZE, srcB_buf_q15, MAX_BLOCKSIZE, conv_result_q15,scratch1));
 #ifdef PRINT_OUTPUT
   PRINT_Q(conv_result_q15,CONV_BLOCKSIZE);
 #endif 
 
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_correlate_fast_q31(srcA_buf_q31, MAX_BLOCKSIZE, srcB_buf_q31, MAX_BLOCKSIZE, conv_result_q31 );
-  perf_stop();
-  printf("riscv_correlate_fast_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_correlate_fast_q31", "q31", MAX_BLOCKSIZE,
+    riscv_correlate_fast_q31(srcA_buf_q31, MAX_BLOCKSIZE, srcB_buf_q31, MAX_BLOCKSIZE, conv_result_q31 ));
 #ifdef PRINT_OUTPUT
   PRINT_Q(conv_result_q31,CONV_BLOCKSIZE);
 #endif
 
 /*Finite Impulse Response (FIR) Decimator*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_fir_decimate_f32( &S_decimate_f32,srcA_buf_f32,result_decimate_f32,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_decimate_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_decimate_f32", "f32", MAX_BLOCKSIZE,
+    riscv_fir_decimate_f32( &S_decimate_f32,srcA_buf_f32,result_decimate_f32,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_decimate_f32,MAX_BLOCKSIZE/M);
 #endif 
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_fir_decimate_q15( &S_decimate_q15,srcA_buf_q15,result_decimate_q15,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_decimate_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_decimate_q15", "q15", MAX_BLOCKSIZE,
+    riscv_fir_decimate_q15( &S_decimate_q15,srcA_buf_q15,result_decimate_q15,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_decimate_q15,MAX_BLOCKSIZE/M);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_fir_decimate_q31( &S_decimate_q31,srcA_buf_q31,result_decimate_q31,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_decimate_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_decimate_q31", "q31", MAX_BLOCKSIZE,
+    riscv_fir_decimate_q31( &S_decimate_q31,srcA_buf_q31,result_decimate_q31,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_decimate_q31,MAX_BLOCKSIZE/M);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_fir_decimate_fast_q15( &S_decimate_q15,srcA_buf_q15,result_decimate_q15,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_decimate_fast_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_decimate_fast_q15", "q15", MAX_BLOCKSIZE,
+    riscv_fir_decimate_fast_q15( &S_decimate_q15,srcA_buf_q15,result_decimate_q15,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_decimate_q15,MAX_BLOCKSIZE/M);
 #endif
 /*
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_fir_decimate_fast_q31( &S_decimate_q31,srcA_buf_q31,result_decimate_q31,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_conv_opt_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_decimate_fast_q31", "q31", MAX_BLOCKSIZE,
+    riscv_fir_decimate_fast_q31( &S_decimate_q31,srcA_buf_q31,result_decimate_q31,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_decimate_q31,MAX_BLOCKSIZE/M);
 #endif
@@ -7,7 +7,6 @@
 #include "bar.h"
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 
 
 #define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
@@ -21,29 +20,14 @@ printf("\n\n")
 #define M 4
 #define CONV_BLOCKSIZE   ((2*MAX_BLOCKSIZE) - 1)
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
-*Also the correct results are printed for the current vectors which are calculated from the orignal library 
+*Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "FilteringFunctions5"
+#include "../common/riscv_bench.h"
  float32_t srcA_buf_f32[MAX_BLOCKSIZE] =
 {
   -0.4325648115282207,  -1.6655843782380970,  0.1253323064748307,
@@ -232,14 +216,9 @@ int i = 0 ;
 
 int32_t main(void)
 {
+  riscv_bench_header();
 
  /*Init*/ 
-  set_pin_function(5, FUNC_GPIO);
-  set_gpio_pin_direction(5, DIR_OUT);
-  set_pin_function(6, FUNC_GPIO);
-  set_gpio_pin_direction(6, DIR_OUT);
-  CLR_GPIO_5() ;
-  CLR_GPIO_6() ;
 
  /*Finite Impulse Response (FIR) Filters Init*/
   riscv_fir_init_f32( &S_fir_f32,NUMTAPS,coeffs_fir_f32,state_fir_f32, MAX_BLOCKSIZE);
@@ -254,85 +233,58 @@ int32_t main(void)
 
 /*Finite Impulse Response (FIR) Filters*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_fir_f32(&S_fir_f32,srcA_buf_f32,result_f32,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_f32", "f32", MAX_BLOCKSIZE,
+    riscv_fir_f32(&S_fir_f32,srcA_buf_f32,result_f32,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_fir_q7(&S_fir_q7,srcA_buf_q7,result_q7,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_q7", "q7", MAX_BLOCKSIZE,
+    riscv_fir_q7(&S_fir_q7,srcA_buf_q7,result_q7,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_fir_q15(&S_fir_q15,srcA_buf_q15,result_q15,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_q15", "q15", MAX_BLOCKSIZE,
+    riscv_fir_q15(&S_fir_q15,srcA_buf_q15,result_q15,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_fir_q31(&S_fir_q31,srcA_buf_q31,result_q31,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_q31", "q31", MAX_BLOCKSIZE,
+    riscv_fir_q31(&S_fir_q31,srcA_buf_q31,result_q31,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_fir_fast_q15(&S_fir_q15,srcA_buf_q15,result_q15,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_fast_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_fast_q15", "q15", MAX_BLOCKSIZE,
+    riscv_fir_fast_q15(&S_fir_q15,srcA_buf_q15,result_q15,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_fir_fast_q31(&S_fir_q31,srcA_buf_q31,result_q31,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_fast_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_fast_q31", "q31", MAX_BLOCKSIZE,
+    riscv_fir_fast_q31(&S_fir_q31,srcA_buf_q31,result_q31,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
 
 /*Finite Impulse Response (FIR) Lattice Filters*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_fir_lattice_f32(&S_lattice_f32,srcA_buf_f32,result_f32,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_lattice_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_lattice_f32", "f32", MAX_BLOCKSIZE,
+    riscv_fir_lattice_f32(&S_lattice_f32,srcA_buf_f32,result_f32,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_fir_lattice_q15(&S_lattice_q15,srcA_buf_q15,result_q15,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_lattice_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_lattice_q15", "q15", MAX_BLOCKSIZE,
+    riscv_fir_lattice_q15(&S_lattice_q15,srcA_buf_q15,result_q15,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_fir_lattice_q31(&S_lattice_q31,srcA_buf_q31,result_q31,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_lattice_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_lattice_q31", "q31", MAX_BLOCKSIZE,
+    riscv_fir_lattice_q31(&S_lattice_q31,srcA_buf_q31,result_q31,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
@@ -7,7 +7,6 @@
 #include "bar.h"
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 
 
 #define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
@@ -26,29 +25,16 @@ printf("\n\n")
 #define POS_SHIFT 0 
 
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
-*Also the correct results are printed for the current vectors which are calculated from the orignal library 
+*Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
+*riscv_fir_interpolate_q15 is also measured for the 8 kHz to 48 kHz upsampling of voice prompts, VOICE_L = 6 phases of
+VOICE_PHASELENGTH taps.
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "FilteringFunctions6"
+#include "../common/riscv_bench.h"
  float32_t srcA_buf_f32[MAX_BLOCKSIZE] =
 {
   -0.4325648115282207,  -1.6655843782380970,  0.1253323064748307,
@@ -206,6 +192,13 @@ float32_t state_interpolate_f32[PHASELENGTH + MAX_BLOCKSIZE - 1u];
 q15_t coeffs_interpolate_q15[NUMTAPS] =  {0x7531, 0x3344,0xAA76, 0x01A1, 0x5C00,0x18};  
 q15_t state_interpolate_q15[PHASELENGTH + MAX_BLOCKSIZE - 1u]; 
 
+#define VOICE_L 6
+#define VOICE_PHASELENGTH 8
+riscv_fir_interpolate_instance_q15 S_voice_q15;
+q15_t coeffs_voice_q15[VOICE_L * VOICE_PHASELENGTH];
+q15_t state_voice_q15[VOICE_PHASELENGTH + MAX_BLOCKSIZE - 1u];
+q15_t voice_result_q15[VOICE_L * MAX_BLOCKSIZE];
+
 q31_t coeffs_interpolate_q31[NUMTAPS] =  {0x7531, 0x3344,0xAA76, 0x01A1, 0x5C00, 0x1801};  /*   stored in reverse order */
 q31_t state_interpolate_q31[PHASELENGTH + MAX_BLOCKSIZE - 1u];
 
@@ -245,6 +238,7 @@ int i = 0 ;
 
 int32_t main(void)
 {
+  riscv_bench_header();
 
  /*Init*/ 
  /*Finite Impulse Response (FIR) Interpolator Init*/
@@ -261,87 +255,72 @@ int32_t main(void)
   riscv_lms_norm_init_q31(&S_lms_norm_q31, NUMTAPS, coeffs_lms_norm_q31, state_lms_norm_q31, MU_q31, MAX_BLOCKSIZE,POS_SHIFT);
 /*Finite Impulse Response (FIR) Interpolator*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_fir_interpolate_f32(&S_interpolator_f32,srcA_buf_f32,interpolate_result_f32,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_interpolate_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_interpolate_f32", "f32", MAX_BLOCKSIZE,
+    riscv_fir_interpolate_f32(&S_interpolator_f32,srcA_buf_f32,interpolate_result_f32,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(interpolate_result_f32,L*MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_fir_interpolate_q15(&S_interpolator_q15,srcA_buf_q15,interpolate_result_q15,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_interpolate_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_interpolate_q15", "q15", MAX_BLOCKSIZE,
+    riscv_fir_interpolate_q15(&S_interpolator_q15,srcA_buf_q15,interpolate_result_q15,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(interpolate_result_q15,L*MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_fir_interpolate_q31(&S_interpolator_q31,srcA_buf_q31,interpolate_result_q31,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_interpolate_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  for (i = 0; i < VOICE_L * VOICE_PHASELENGTH; i++)
+  {
+    coeffs_voice_q15[i] = (q15_t) (((i * 0x2F31) & 0x3FFF) - 0x2000);
+  }
+  riscv_fir_interpolate_init_q15(&S_voice_q15,VOICE_L,VOICE_L * VOICE_PHASELENGTH,coeffs_voice_q15,state_voice_q15,MAX_BLOCKSIZE);
+
+  RISCV_BENCH("riscv_fir_interpolate_q15 8k to 48k", "q15", MAX_BLOCKSIZE,
+    riscv_fir_interpolate_q15(&S_voice_q15,srcA_buf_q15,voice_result_q15,MAX_BLOCKSIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(voice_result_q15,VOICE_L*MAX_BLOCKSIZE);
+#endif
+
+  RISCV_BENCH("riscv_fir_interpolate_q31", "q31", MAX_BLOCKSIZE,
+    riscv_fir_interpolate_q31(&S_interpolator_q31,srcA_buf_q31,interpolate_result_q31,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(interpolate_result_q31,L*MAX_BLOCKSIZE);
 #endif
 
 /*Infinite Impulse Response (IIR) Lattice Filters*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_iir_lattice_f32( &S_iir_f32, srcA_buf_f32, result_f32, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_iir_lattice_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_iir_lattice_f32", "f32", MAX_BLOCKSIZE,
+    riscv_iir_lattice_f32( &S_iir_f32, srcA_buf_f32, result_f32, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_iir_lattice_q15( &S_iir_q15, srcA_buf_q15, result_q15, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_iir_lattice_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_iir_lattice_q15", "q15", MAX_BLOCKSIZE,
+    riscv_iir_lattice_q15( &S_iir_q15, srcA_buf_q15, result_q15, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_iir_lattice_q31( &S_iir_q31, srcA_buf_q31, result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_iir_lattice_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_iir_lattice_q31", "q31", MAX_BLOCKSIZE,
+    riscv_iir_lattice_q31( &S_iir_q31, srcA_buf_q31, result_q31, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
 
 /*Normalized LMS Filters*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_lms_norm_f32(&S_lms_norm_f32, srcA_buf_f32,srcB_buf_f32,result_f32,err_signal_f32, MAX_BLOCKSIZE); 
-  perf_stop();
-  printf("riscv_lms_norm_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_lms_norm_f32", "f32", MAX_BLOCKSIZE,
+    riscv_lms_norm_f32(&S_lms_norm_f32, srcA_buf_f32,srcB_buf_f32,result_f32,err_signal_f32, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_lms_norm_q15(&S_lms_norm_q15, srcA_buf_q15,srcB_buf_q15,result_q15,err_signal_q15, MAX_BLOCKSIZE); 
-  perf_stop();
-  printf("riscv_lms_norm_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_lms_norm_q15", "q15", MAX_BLOCKSIZE,
+    riscv_lms_norm_q15(&S_lms_norm_q15, srcA_buf_q15,srcB_buf_q15,result_q15,err_signal_q15, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_lms_norm_q31(&S_lms_norm_q31, srcA_buf_q31,srcB_buf_q31,result_q31,err_signal_q31, MAX_BLOCKSIZE); 
-  perf_stop();
-  printf("riscv_lms_norm_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_lms_norm_q31", "q31", MAX_BLOCKSIZE,
+    riscv_lms_norm_q31(&S_lms_norm_q31, srcA_buf_q31,srcB_buf_q31,result_q31,err_signal_q31, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
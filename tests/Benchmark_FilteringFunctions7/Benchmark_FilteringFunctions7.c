@@ -7,7 +7,6 @@
 #include "bar.h"
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 
 
 #define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
@@ -25,29 +24,14 @@ printf("\n\n")
 #define MAXDELAY 8
 
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
-*Also the correct results are printed for the current vectors which are calculated from the orignal library 
+*Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "FilteringFunctions7"
+#include "../common/riscv_bench.h"
  float32_t srcA_buf_f32[MAX_BLOCKSIZE] =
 {
   -0.4325648115282207,  -1.6655843782380970,  0.1253323064748307,
@@ -229,6 +213,7 @@ int i = 0 ;
 
 int32_t main(void)
 {
+  riscv_bench_header();
 
  /*Init*/ 
 
@@ -242,68 +227,47 @@ int32_t main(void)
   riscv_fir_sparse_init_q15(&S_sparse_q15,NUMTAPS,coeffs_sparse_q15, state_sparse_q15, pTapDelay, MAXDELAY, MAX_BLOCKSIZE);
   riscv_fir_sparse_init_q31(&S_sparse_q31,NUMTAPS,coeffs_sparse_q31, state_sparse_q31, pTapDelay, MAXDELAY, MAX_BLOCKSIZE);
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_lms_f32( &S_lms_f32, srcA_buf_f32,srcB_buf_f32,result_f32,err_signal_f32, MAX_BLOCKSIZE); 
-  perf_stop();
-  printf("riscv_lms_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_lms_f32", "f32", MAX_BLOCKSIZE,
+    riscv_lms_f32( &S_lms_f32, srcA_buf_f32,srcB_buf_f32,result_f32,err_signal_f32, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
 
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_lms_q15(&S_lms_q15, srcA_buf_q15,srcB_buf_q15,result_q15,err_signal_q15, MAX_BLOCKSIZE); 
-  perf_stop();
-  printf("riscv_lms_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_lms_q15", "q15", MAX_BLOCKSIZE,
+    riscv_lms_q15(&S_lms_q15, srcA_buf_q15,srcB_buf_q15,result_q15,err_signal_q15, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
 
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_lms_q31(&S_lms_q31, srcA_buf_q31,srcB_buf_q31,result_q31,err_signal_q31, MAX_BLOCKSIZE); 
-  perf_stop();
-  printf("riscv_lms_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_lms_q31", "q31", MAX_BLOCKSIZE,
+    riscv_lms_q31(&S_lms_q31, srcA_buf_q31,srcB_buf_q31,result_q31,err_signal_q31, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
 /*Finite Impulse Response (FIR) Sparse Filters variables*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_fir_sparse_f32(&S_sparse_f32, srcA_buf_f32,result_f32, scratch_f32, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_sparse_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_sparse_f32", "f32", MAX_BLOCKSIZE,
+    riscv_fir_sparse_f32(&S_sparse_f32, srcA_buf_f32,result_f32, scratch_f32, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_fir_sparse_q7(&S_sparse_q7, srcA_buf_q7,result_q7, scratch_q7,scratchout, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_sparse_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_sparse_q7", "q7", MAX_BLOCKSIZE,
+    riscv_fir_sparse_q7(&S_sparse_q7, srcA_buf_q7,result_q7, scratch_q7,scratchout, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_fir_sparse_q15(&S_sparse_q15, srcA_buf_q15,result_q15, scratch_q15,scratchout, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_sparse_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_sparse_q15", "q15", MAX_BLOCKSIZE,
+    riscv_fir_sparse_q15(&S_sparse_q15, srcA_buf_q15,result_q15, scratch_q15,scratchout, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_fir_sparse_q31(&S_sparse_q31, srcA_buf_q31,result_q31, scratch_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fir_sparse_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fir_sparse_q31", "q31", MAX_BLOCKSIZE,
+    riscv_fir_sparse_q31(&S_sparse_q31, srcA_buf_q31,result_q31, scratch_q31, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
@@ -0,0 +1,128 @@
+#include <math.h>
+#include <stdio.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(100*X[i])); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 256
+#define PART_LEN 128
+#define MAX_TAPS 1024
+#define MAX_PARTITIONS (MAX_TAPS / PART_LEN)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_fir_f32/q31 and the fast convolution riscv_fir_fft_f32/q31 filter the same BLOCK_SIZE samples with
+512 and 1024 taps.  The fast convolution filters use partitions of PART_LEN taps, the size
+column is the number of taps.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions8"
+#include "../common/riscv_bench.h"
+
+float32_t coeffs_f32[MAX_TAPS];
+float32_t testInput_f32[BLOCK_SIZE];
+float32_t testOutput_f32[BLOCK_SIZE];
+float32_t firState_f32[MAX_TAPS + BLOCK_SIZE - 1];
+float32_t fftState_f32[2 * PART_LEN * (2 * MAX_PARTITIONS + 3)];
+
+q31_t coeffs_q31[MAX_TAPS];
+q31_t testInput_q31[BLOCK_SIZE];
+q31_t testOutput_q31[BLOCK_SIZE];
+q31_t firState_q31[MAX_TAPS + BLOCK_SIZE - 1];
+
+riscv_fir_instance_f32 S_fir_f32;
+riscv_fir_instance_q31 S_fir_q31;
+riscv_fir_fft_instance_f32 S_fir_fft_f32;
+riscv_fir_fft_instance_q31 S_fir_fft_q31;
+
+int32_t main(void)
+{
+  uint32_t i;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (i = 0; i < MAX_TAPS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    coeffs_f32[i] = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / 64.0f;
+    coeffs_q31[i] = (q31_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 10;
+  }
+
+  for (i = 0; i < BLOCK_SIZE; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    testInput_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    testInput_q31[i] = (q31_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 16;
+  }
+
+/*Tests*/
+  riscv_fir_init_f32(&S_fir_f32, 512, coeffs_f32, firState_f32, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_f32", "f32", 512,
+    riscv_fir_f32(&S_fir_f32, testInput_f32, testOutput_f32, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,BLOCK_SIZE);
+#endif
+
+  riscv_fir_fft_init_f32(&S_fir_fft_f32, 512, coeffs_f32, fftState_f32, PART_LEN);
+  RISCV_BENCH("riscv_fir_fft_f32", "f32", 512,
+    riscv_fir_fft_f32(&S_fir_fft_f32, testInput_f32, testOutput_f32, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,BLOCK_SIZE);
+#endif
+
+  riscv_fir_init_f32(&S_fir_f32, 1024, coeffs_f32, firState_f32, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_f32", "f32", 1024,
+    riscv_fir_f32(&S_fir_f32, testInput_f32, testOutput_f32, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,BLOCK_SIZE);
+#endif
+
+  riscv_fir_fft_init_f32(&S_fir_fft_f32, 1024, coeffs_f32, fftState_f32, PART_LEN);
+  RISCV_BENCH("riscv_fir_fft_f32", "f32", 1024,
+    riscv_fir_fft_f32(&S_fir_fft_f32, testInput_f32, testOutput_f32, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,BLOCK_SIZE);
+#endif
+
+  riscv_fir_init_q31(&S_fir_q31, 512, coeffs_q31, firState_q31, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_q31", "q31", 512,
+    riscv_fir_q31(&S_fir_q31, testInput_q31, testOutput_q31, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q31,BLOCK_SIZE);
+#endif
+
+  riscv_fir_fft_init_q31(&S_fir_fft_q31, 512, coeffs_q31, fftState_f32, PART_LEN);
+  RISCV_BENCH("riscv_fir_fft_q31", "q31", 512,
+    riscv_fir_fft_q31(&S_fir_fft_q31, testInput_q31, testOutput_q31, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q31,BLOCK_SIZE);
+#endif
+
+  riscv_fir_init_q31(&S_fir_q31, 1024, coeffs_q31, firState_q31, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_q31", "q31", 1024,
+    riscv_fir_q31(&S_fir_q31, testInput_q31, testOutput_q31, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q31,BLOCK_SIZE);
+#endif
+
+  riscv_fir_fft_init_q31(&S_fir_fft_q31, 1024, coeffs_q31, fftState_f32, PART_LEN);
+  RISCV_BENCH("riscv_fir_fft_q31", "q31", 1024,
+    riscv_fir_fft_q31(&S_fir_fft_q31, testInput_q31, testOutput_q31, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q31,BLOCK_SIZE);
+#endif
+
+  printf("End\n");
+
+  return 0;
+}
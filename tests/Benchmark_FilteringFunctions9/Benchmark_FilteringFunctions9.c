@@ -0,0 +1,111 @@
+#include <math.h>
+#include <stdio.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(100*X[i])); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_CHANNELS 16
+#define NUM_TAPS 32
+#define BLOCK_SIZE 64
+#define STATE_SIZE (NUM_TAPS + BLOCK_SIZE - 1)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_fir_multichan_q15/f32 filter NUM_CHANNELS blocks of BLOCK_SIZE samples with one set of NUM_TAPS
+coefficients, they are compared with NUM_CHANNELS calls of riscv_fir_q15/f32, one instance per channel.
+The size column is the number of channels.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "FilteringFunctions9"
+#include "../common/riscv_bench.h"
+
+float32_t coeffs_f32[NUM_TAPS];
+float32_t testInput_f32[NUM_CHANNELS * BLOCK_SIZE];
+float32_t testOutput_f32[NUM_CHANNELS * BLOCK_SIZE];
+float32_t firState_f32[NUM_CHANNELS * STATE_SIZE];
+
+q15_t coeffs_q15[NUM_TAPS];
+q15_t testInput_q15[NUM_CHANNELS * BLOCK_SIZE];
+q15_t testOutput_q15[NUM_CHANNELS * BLOCK_SIZE];
+q15_t firState_q15[NUM_CHANNELS * STATE_SIZE];
+
+riscv_fir_instance_f32 S_fir_f32[NUM_CHANNELS];
+riscv_fir_instance_q15 S_fir_q15[NUM_CHANNELS];
+riscv_fir_multichan_instance_f32 S_mc_f32;
+riscv_fir_multichan_instance_q15 S_mc_q15;
+
+int32_t main(void)
+{
+  uint32_t i, c;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    coeffs_f32[i] = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / 8.0f;
+    coeffs_q15[i] = (q15_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) >> 3);
+  }
+
+  for (i = 0; i < NUM_CHANNELS * BLOCK_SIZE; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    testInput_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    testInput_q15[i] = (q15_t)((((int32_t)(seed >> 16) & 0x7FFF) - 0x4000) << 1);
+  }
+
+/*Tests*/
+  for (c = 0; c < NUM_CHANNELS; c++)
+  {
+    riscv_fir_init_q15(&S_fir_q15[c], NUM_TAPS, coeffs_q15, &firState_q15[c * STATE_SIZE], BLOCK_SIZE);
+  }
+  RISCV_BENCH("riscv_fir_q15", "q15", NUM_CHANNELS,
+    for (c = 0; c < NUM_CHANNELS; c++)
+    {
+      riscv_fir_q15(&S_fir_q15[c], &testInput_q15[c * BLOCK_SIZE], &testOutput_q15[c * BLOCK_SIZE], BLOCK_SIZE);
+    });
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,NUM_CHANNELS * BLOCK_SIZE);
+#endif
+
+  riscv_fir_multichan_init_q15(&S_mc_q15, NUM_TAPS, NUM_CHANNELS, coeffs_q15, firState_q15, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_multichan_q15", "q15", NUM_CHANNELS,
+    riscv_fir_multichan_q15(&S_mc_q15, testInput_q15, testOutput_q15, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,NUM_CHANNELS * BLOCK_SIZE);
+#endif
+
+  for (c = 0; c < NUM_CHANNELS; c++)
+  {
+    riscv_fir_init_f32(&S_fir_f32[c], NUM_TAPS, coeffs_f32, &firState_f32[c * STATE_SIZE], BLOCK_SIZE);
+  }
+  RISCV_BENCH("riscv_fir_f32", "f32", NUM_CHANNELS,
+    for (c = 0; c < NUM_CHANNELS; c++)
+    {
+      riscv_fir_f32(&S_fir_f32[c], &testInput_f32[c * BLOCK_SIZE], &testOutput_f32[c * BLOCK_SIZE], BLOCK_SIZE);
+    });
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,NUM_CHANNELS * BLOCK_SIZE);
+#endif
+
+  riscv_fir_multichan_init_f32(&S_mc_f32, NUM_TAPS, NUM_CHANNELS, coeffs_f32, firState_f32, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_multichan_f32", "f32", NUM_CHANNELS,
+    riscv_fir_multichan_f32(&S_mc_f32, testInput_f32, testOutput_f32, BLOCK_SIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,NUM_CHANNELS * BLOCK_SIZE);
+#endif
+
+  printf("End\n");
+
+  return 0;
+}
@@ -7,35 +7,19 @@
 #include "bar.h"
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 
 
 //#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
 #define MAX_BLOCKSIZE 32
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
-*Also the correct results are printed for the current vectors which are calculated from the orignal library 
+*Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "InterpolationFunctions"
+#include "../common/riscv_bench.h"
  volatile float32_t srcA_buf_f32[MAX_BLOCKSIZE] =
 {
   -0.4325648115282207,  -1.6655843782380970,  0.1253323064748307,
@@ -105,8 +89,39 @@ q31_t result_q31;
 volatile float32_t X_f32 = 1.3;
 volatile int32_t X_Q = 0xA00000;
 
+#define NUM_POINTS 8
+float32_t points_x_f32[NUM_POINTS] = {2.35, 2.9, 3.05, 0.7, 4.2, 3.3, 2.1, 2.65};
+float32_t points_y_f32[NUM_POINTS] = {0.5, 1.25, 3.75, 2.0, 0.1, 2.9, 1.6, 3.4};
+q31_t points_x_q[NUM_POINTS] = {0x258000, 0x180000, 0x1C8000, 0x2F0000, 0x3A4000, 0x08C000, 0x2C0000, 0x010000};
+q31_t points_y_q[NUM_POINTS] = {0x080000, 0x1A0000, 0x364000, 0x200000, 0x018000, 0x2E8000, 0x0F0000, 0x3C0000};
+float32_t block_f32[NUM_POINTS];
+q7_t block_q7[NUM_POINTS];
+q15_t block_q15[NUM_POINTS];
+q31_t block_q31[NUM_POINTS];
+q15_t grid_q15[NUM_POINTS * NUM_POINTS];
+float32_t table_f32[MAX_BLOCKSIZE];
+q7_t table_q7[MAX_BLOCKSIZE];
+q15_t table_q15[MAX_BLOCKSIZE];
+q31_t table_q31[MAX_BLOCKSIZE];
+
+#define NUM_KNOTS 6
+float32_t knots_x_f32[NUM_KNOTS] = {0.0, 0.5, 1.25, 2.0, 3.0, 4.5};
+float32_t knots_y_f32[NUM_KNOTS] = {0.1, 0.62, 0.93, 0.81, 0.12, -0.75};
+float32_t spline_coeffs_f32[3 * (NUM_KNOTS - 1)];
+float32_t spline_temp_f32[2 * NUM_KNOTS - 1];
+float32_t delay_state_f32[MAX_BLOCKSIZE + 3];
+q31_t delay_state_q31[MAX_BLOCKSIZE + 3];
+q15_t delay_state_q15[MAX_BLOCKSIZE + 3] __attribute__((aligned(4)));
+float32_t delay_in_f32[MAX_BLOCKSIZE];
+q31_t delay_in_q31[MAX_BLOCKSIZE];
+q15_t delay_in_q15[MAX_BLOCKSIZE];
+float32_t delay_f32[MAX_BLOCKSIZE];
+q31_t delay_q31[MAX_BLOCKSIZE];
+q15_t delay_q15[MAX_BLOCKSIZE];
+
 int32_t main(void)
 {
+  riscv_bench_header();
 
  /*Init*/ 
 
@@ -118,76 +133,174 @@ int32_t main(void)
 /*Tests*/
 /*Linear Interpolation*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  result_f32 = riscv_linear_interp_f32(&S_linear_f32, X_f32);
-  perf_stop();
-  printf("riscv_linear_interp_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_linear_interp_f32", "f32", 1,
+    result_f32 = riscv_linear_interp_f32(&S_linear_f32, X_f32));
 #ifdef PRINT_OUTPUT
   printf(" %d\n",(int)(100*result_f32));
 #endif	
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  result_q7 = riscv_linear_interp_q7(srcA_buf_q7,X_Q,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_linear_interp_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_linear_interp_q7", "q7", MAX_BLOCKSIZE,
+    result_q7 = riscv_linear_interp_q7(srcA_buf_q7,X_Q,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   printf(" 0x%X\n",result_q7);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  result_q15 = riscv_linear_interp_q15(srcA_buf_q15,X_Q,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_linear_interp_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_linear_interp_q15", "q15", MAX_BLOCKSIZE,
+    result_q15 = riscv_linear_interp_q15(srcA_buf_q15,X_Q,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   printf(" 0x%X\n",result_q15);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  result_q31 = riscv_linear_interp_q31(srcA_buf_q31,X_Q,MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_linear_interp_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_linear_interp_q31", "q31", MAX_BLOCKSIZE,
+    result_q31 = riscv_linear_interp_q31(srcA_buf_q31,X_Q,MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   printf(" 0x%X\n",result_q31);
 #endif	
 /*Bilinear Interpolation*/
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  result_f32 = riscv_bilinear_interp_f32(&S_bilinear_f32, 3,2);
-  perf_stop();
-  printf("riscv_bilinear_interp_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_bilinear_interp_f32", "f32", 1,
+    result_f32 = riscv_bilinear_interp_f32(&S_bilinear_f32, 3,2));
 #ifdef PRINT_OUTPUT
   printf(" %d\n",(int)(100*result_f32));
 #endif	
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  result_q7 = riscv_bilinear_interp_q7(&S_bilinear_q7,3,2);
-  perf_stop();
-  printf("riscv_bilinear_interp_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_bilinear_interp_q7", "q7", 1,
+    result_q7 = riscv_bilinear_interp_q7(&S_bilinear_q7,3,2));
 #ifdef PRINT_OUTPUT
   printf("  0x%X\n",result_q7);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  result_q15 = riscv_bilinear_interp_q15(&S_bilinear_q15,3,2);
-  perf_stop();
-  printf("riscv_bilinear_interp_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_bilinear_interp_q15", "q15", 1,
+    result_q15 = riscv_bilinear_interp_q15(&S_bilinear_q15,3,2));
 #ifdef PRINT_OUTPUT
   printf(" 0x%X\n",result_q15);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  result_q31 = riscv_bilinear_interp_q31(&S_bilinear_q31,3,2);
-  perf_stop();
-  printf("riscv_bilinear_interp_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_bilinear_interp_q31", "q31", 1,
+    result_q31 = riscv_bilinear_interp_q31(&S_bilinear_q31,3,2));
 #ifdef PRINT_OUTPUT
   printf(" 0x%X\n",result_q31);
+#endif
+/*Block Interpolation*/
+  uint32_t i;
+  for (i = 0u; i < MAX_BLOCKSIZE; i++)
+  {
+    table_f32[i] = srcA_buf_f32[i];
+    table_q7[i] = srcA_buf_q7[i];
+    table_q15[i] = srcA_buf_q15[i];
+    table_q31[i] = srcA_buf_q31[i];
+  }
+  riscv_linear_interp_instance_f32 S_table_f32 = {MAX_BLOCKSIZE, 2.3, 0.1, table_f32};
+  riscv_bilinear_interp_instance_f32 S_grid_f32 = {5,5,table_f32};
+  riscv_bilinear_interp_instance_q7 S_grid_q7 = {5,5,table_q7};
+  riscv_bilinear_interp_instance_q15 S_grid_q15 = {5,5,table_q15};
+  riscv_bilinear_interp_instance_q31 S_grid_q31 = {5,5,table_q31};
+
+  RISCV_BENCH("riscv_linear_interp_block_f32", "f32", NUM_POINTS,
+    riscv_linear_interp_block_f32(&S_table_f32, points_x_f32, block_f32, NUM_POINTS));
+#ifdef PRINT_OUTPUT
+  printf(" %d %d\n",(int)(100*block_f32[0]),(int)(100*block_f32[NUM_POINTS-1]));
+#endif
+
+  RISCV_BENCH("riscv_linear_interp_uniform_f32", "f32", NUM_POINTS,
+    riscv_linear_interp_uniform_f32(&S_table_f32, 2.35, 0.05, block_f32, NUM_POINTS));
+#ifdef PRINT_OUTPUT
+  printf(" %d %d\n",(int)(100*block_f32[0]),(int)(100*block_f32[NUM_POINTS-1]));
+#endif
+
+  RISCV_BENCH("riscv_linear_interp_block_q7", "q7", NUM_POINTS,
+    riscv_linear_interp_block_q7(table_q7, MAX_BLOCKSIZE, points_x_q, block_q7, NUM_POINTS));
+#ifdef PRINT_OUTPUT
+  printf(" 0x%X 0x%X\n",block_q7[0],block_q7[NUM_POINTS-1]);
+#endif
+
+  RISCV_BENCH("riscv_linear_interp_block_q15", "q15", NUM_POINTS,
+    riscv_linear_interp_block_q15(table_q15, MAX_BLOCKSIZE, points_x_q, block_q15, NUM_POINTS));
+#ifdef PRINT_OUTPUT
+  printf(" 0x%X 0x%X\n",block_q15[0],block_q15[NUM_POINTS-1]);
+#endif
+
+  RISCV_BENCH("riscv_linear_interp_uniform_q15", "q15", NUM_POINTS,
+    riscv_linear_interp_uniform_q15(table_q15, MAX_BLOCKSIZE, X_Q, 0x48000, block_q15, NUM_POINTS));
+#ifdef PRINT_OUTPUT
+  printf(" 0x%X 0x%X\n",block_q15[0],block_q15[NUM_POINTS-1]);
+#endif
+
+  RISCV_BENCH("riscv_linear_interp_block_q31", "q31", NUM_POINTS,
+    riscv_linear_interp_block_q31(table_q31, MAX_BLOCKSIZE, points_x_q, block_q31, NUM_POINTS));
+#ifdef PRINT_OUTPUT
+  printf(" 0x%X 0x%X\n",block_q31[0],block_q31[NUM_POINTS-1]);
+#endif
+
+  RISCV_BENCH("riscv_bilinear_interp_block_f32", "f32", NUM_POINTS,
+    riscv_bilinear_interp_block_f32(&S_grid_f32, points_x_f32, points_y_f32, block_f32, NUM_POINTS));
+#ifdef PRINT_OUTPUT
+  printf(" %d %d\n",(int)(100*block_f32[0]),(int)(100*block_f32[NUM_POINTS-1]));
+#endif
+
+  RISCV_BENCH("riscv_bilinear_interp_block_q7", "q7", NUM_POINTS,
+    riscv_bilinear_interp_block_q7(&S_grid_q7, points_x_q, points_y_q, block_q7, NUM_POINTS));
+#ifdef PRINT_OUTPUT
+  printf(" 0x%X 0x%X\n",block_q7[0],block_q7[NUM_POINTS-1]);
+#endif
+
+  RISCV_BENCH("riscv_bilinear_interp_block_q15", "q15", NUM_POINTS,
+    riscv_bilinear_interp_block_q15(&S_grid_q15, points_x_q, points_y_q, block_q15, NUM_POINTS));
+#ifdef PRINT_OUTPUT
+  printf(" 0x%X 0x%X\n",block_q15[0],block_q15[NUM_POINTS-1]);
+#endif
+
+  RISCV_BENCH("riscv_bilinear_interp_grid_q15", "q15", NUM_POINTS * NUM_POINTS,
+    riscv_bilinear_interp_grid_q15(&S_grid_q15, 0, 0x80000, NUM_POINTS, 0, 0x80000, NUM_POINTS, grid_q15));
+#ifdef PRINT_OUTPUT
+  printf(" 0x%X 0x%X\n",grid_q15[0],grid_q15[NUM_POINTS * NUM_POINTS - 1]);
+#endif
+
+  RISCV_BENCH("riscv_bilinear_interp_block_q31", "q31", NUM_POINTS,
+    riscv_bilinear_interp_block_q31(&S_grid_q31, points_x_q, points_y_q, block_q31, NUM_POINTS));
+#ifdef PRINT_OUTPUT
+  printf(" 0x%X 0x%X\n",block_q31[0],block_q31[NUM_POINTS-1]);
+#endif
+/*Cubic Spline Interpolation*/
+  riscv_spline_instance_f32 S_spline_f32;
+
+  RISCV_BENCH("riscv_spline_init_f32", "f32", NUM_KNOTS,
+    riscv_spline_init_f32(&S_spline_f32, RISCV_SPLINE_NATURAL, knots_x_f32, knots_y_f32, NUM_KNOTS, spline_coeffs_f32, spline_temp_f32));
+
+  RISCV_BENCH("riscv_spline_f32", "f32", NUM_POINTS,
+    riscv_spline_f32(&S_spline_f32, points_x_f32, block_f32, NUM_POINTS));
+#ifdef PRINT_OUTPUT
+  printf(" %d %d\n",(int)(100*block_f32[0]),(int)(100*block_f32[NUM_POINTS-1]));
+#endif
+/*Fractional Delay*/
+  riscv_frac_delay_instance_f32 S_delay_f32;
+  riscv_frac_delay_instance_q31 S_delay_q31;
+  riscv_frac_delay_instance_q15 S_delay_q15;
+  for (i = 0u; i < MAX_BLOCKSIZE; i++)
+  {
+    delay_in_f32[i] = srcA_buf_f32[i];
+    delay_in_q31[i] = srcA_buf_q31[i];
+    delay_in_q15[i] = srcA_buf_q15[i];
+  }
+  riscv_frac_delay_init_f32(&S_delay_f32, RISCV_CUBIC_CATMULL_ROM, 0.3, delay_state_f32, MAX_BLOCKSIZE);
+  riscv_frac_delay_init_q31(&S_delay_q31, RISCV_CUBIC_CATMULL_ROM, 0x26666666, delay_state_q31, MAX_BLOCKSIZE);
+  riscv_frac_delay_init_q15(&S_delay_q15, RISCV_CUBIC_LAGRANGE, 0x2666, delay_state_q15, MAX_BLOCKSIZE);
+
+  RISCV_BENCH("riscv_frac_delay_f32", "f32", MAX_BLOCKSIZE,
+    riscv_frac_delay_f32(&S_delay_f32, delay_in_f32, delay_f32, MAX_BLOCKSIZE));
+#ifdef PRINT_OUTPUT
+  printf(" %d %d\n",(int)(100*delay_f32[3]),(int)(100*delay_f32[MAX_BLOCKSIZE-1]));
+#endif
+
+  RISCV_BENCH("riscv_frac_delay_q31", "q31", MAX_BLOCKSIZE,
+    riscv_frac_delay_q31(&S_delay_q31, delay_in_q31, delay_q31, MAX_BLOCKSIZE));
+#ifdef PRINT_OUTPUT
+  printf(" 0x%X 0x%X\n",delay_q31[3],delay_q31[MAX_BLOCKSIZE-1]);
+#endif
+
+  RISCV_BENCH("riscv_frac_delay_q15", "q15", MAX_BLOCKSIZE,
+    riscv_frac_delay_q15(&S_delay_q15, delay_in_q15, delay_q15, MAX_BLOCKSIZE));
+#ifdef PRINT_OUTPUT
+  printf(" 0x%X 0x%X\n",delay_q15[3],delay_q15[MAX_BLOCKSIZE-1]);
 #endif
   printf("End\n");
 
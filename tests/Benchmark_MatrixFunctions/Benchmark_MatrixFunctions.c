@@ -6,7 +6,6 @@
 #include <stdio.h>
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 
 #define PRINT_F32(X) printf("\n"); for(int i =0 ; i < (X.numRows)*(X.numCols) ; i++) printf("%d  ",(int)(X.pData[i])); \
 printf("\n\n")
@@ -18,32 +17,29 @@ printf("\n\n")
 printf("\n\n")
 
 
-/*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5() *(volatile int*) (GPIO_REG_PADOUT) = 0x00;
 //#define PRINT_OUTPUT
-
 /*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
 *Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
+*The riscv_mat_mult_f32 sweep multiplies square matrices of the sizes in sweepSize up to MAT_SWEEP_MAX, the size
+column is the number of output elements.  Three 64x64 matrices take 48 KB, more than the PULPino data RAM, so the
+default MAT_SWEEP_MAX is 32.
+*The sparse matrix functions multiply a SPARSE_DIM x SPARSE_DIM matrix with one nonzero element in eight
+by a vector and are compared with riscv_mat_vec_mult_f32 and riscv_mat_vec_mult_q15 on the dense matrix.
+*The batched small matrix functions are compared with one riscv_mat_mult_f32 or riscv_mat_inverse_f32 call per
+matrix for BATCH_COUNT matrices of each size 2x2, 3x3 and 4x4, the size column is the number of elements.
+*riscv_mat_eig_sym_f32 decomposes a random symmetric EIG_DIM x EIG_DIM matrix and riscv_mat_svd_f32 a random
+SVD_ROWS x EIG_DIM matrix, the CHECK lines compare the product of the factors with the input and the vectors
+with an orthonormal basis.
+*The Kalman filter runs KALMAN_STATES states with KALMAN_MEAS measurements and is compared with the textbook
+update P = (I - K * H) * P, K = P * H^T * inv(H * P * H^T + R) computed in the sweep buffers.  The CHECK line
+must report equal.
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "MatrixFunctions"
+#include "../common/riscv_bench.h"
 void riscv_mat_init_f64(riscv_matrix_instance_f64*, uint16_t , uint16_t , float64_t*);
 /*  4*4  */
 float32_t A_f32_4_4[16] =
@@ -158,14 +154,98 @@ q15_t ResultComp_q15_4_4[32];
 q31_t Result_q31_4_4[16];
 q31_t ResultComp_q31_4_4[32];
 q15_t scratch_q15[16];
-q15_t scratchComp_q15[32];
+int16_t exponent_q15;
+q15_t packed_q15[16];
+q7_t A_q7_4_4[16] =
+{
+  0x29,     0x54,      0x05,     0x6A,
+  0x2E,     0x51,      0xF2,     0x70,
+  0x04,     0x77,      0x56,     0x19,
+  0x22,     0x2D,      0xA5,     0x29,
+};
+float32_t Vec_f32_4[4] = {20.0, -3.5, 1.0, 12.0};
+q31_t Vec_q31_4[4] = {0x0153B2F1, 0x7F46A2C0, 0x0329D11E, 0x8018E23B};
+q15_t Vec_q15_4[4] = {0x0153, 0x7F46, 0x0329, 0x8018};
+q7_t Vec_q7_4[4] = {0x13, 0x74, 0xD3, 0x80};
+float32_t VecResult_f32_4[4];
+q31_t VecResult_q31_4[4];
+q15_t VecResult_q15_4[4];
+q7_t VecResult_q7_4[4];
+q7_t Result_q7_4_4[16];
+q7_t scratch_q7[16];
+q31_t requantMult_q31[4] = {0x5A82799A, 0x4B5E4A3C, 0x6A09E668, 0x40000000};
+uint8_t requantShift[4] = {1, 1, 2, 0};
+q15_t scratchComp_q15[64];
+q15_t packedComp_q15[64];
 float32_t Result_f64_4_4[16];
 riscv_status status ;
+float32_t Spd_f32_4_4[16] =
+{
+  4.0,     1.0,      0.5,     0.25,
+  1.0,     3.0,      0.75,    0.5,
+  0.5,     0.75,     2.0,     0.25,
+  0.25,    0.5,      0.25,    1.5,
+};
+float64_t Spd_f64_4_4[16] =
+{
+  4.0,     1.0,      0.5,     0.25,
+  1.0,     3.0,      0.75,    0.5,
+  0.5,     0.75,     2.0,     0.25,
+  0.25,    0.5,      0.25,    1.5,
+};
+float32_t Chol_f32_4_4[16];
+float32_t Solve_f32_4_4[16];
+float32_t Trans_f32_4_4[16];
+float32_t Ldlt_f32_4[4];
+float64_t Chol_f64_4_4[16];
+float64_t Solve_f64_4_4[16];
+float32_t Lstsq_f32_4_4[16];
+q31_t InvState_q31[32];
+int8_t InvExp[4];
+float32_t Rls_f32_4[4];
+float32_t RlsRow_f32_4[4];
+q31_t Qr_q31_4_4[16];
+q31_t QrR_q31_4_4[16];
+#define SPARSE_DIM 16
+float32_t SparseDense_f32[SPARSE_DIM * SPARSE_DIM];
+q15_t SparseDense_q15[SPARSE_DIM * SPARSE_DIM];
+float32_t Sparse_f32[SPARSE_DIM * SPARSE_DIM];
+q15_t Sparse_q15[SPARSE_DIM * SPARSE_DIM];
+uint32_t SparseRowPtr[SPARSE_DIM + 1];
+uint16_t SparseColIdx[SPARSE_DIM * SPARSE_DIM];
+float32_t SparseVec_f32[SPARSE_DIM];
+q15_t SparseVec_q15[SPARSE_DIM];
+float32_t SparseResult_f32[SPARSE_DIM];
+q15_t SparseResult_q15[SPARSE_DIM];
+#ifndef MAT_SWEEP_MAX
+#define MAT_SWEEP_MAX 32
+#endif
+#ifndef BATCH_COUNT
+#define BATCH_COUNT 16u
+#endif
+float32_t sweepA_f32[MAT_SWEEP_MAX * MAT_SWEEP_MAX];
+float32_t sweepB_f32[MAT_SWEEP_MAX * MAT_SWEEP_MAX];
+float32_t sweepResult_f32[MAT_SWEEP_MAX * MAT_SWEEP_MAX];
+uint16_t sweepSize[7] = {4, 8, 12, 16, 24, 32, 64};
+#define EIG_DIM 8
+#define SVD_ROWS 12
+#define KALMAN_STATES 12
+#define KALMAN_MEAS 2
+float32_t KalmanF_f32[KALMAN_STATES * KALMAN_STATES];
+float32_t KalmanQ_f32[KALMAN_STATES * KALMAN_STATES];
+float32_t KalmanP_f32[KALMAN_STATES * KALMAN_STATES];
+float32_t KalmanH_f32[KALMAN_MEAS * KALMAN_STATES];
+float32_t KalmanX_f32[KALMAN_STATES];
+float32_t KalmanXRef_f32[KALMAN_STATES];
+float32_t KalmanWork_f32[KALMAN_STATES * (KALMAN_STATES + 1)];
+float32_t KalmanZ_f32[KALMAN_MEAS] = {0.75f, -1.25f};
+float32_t KalmanR_f32[KALMAN_MEAS] = {0.04f, 0.09f};
 float32_t scale_f32 = 2.5;
 q15_t scale_q15 = 0x12B3;
 q31_t scale_q31 = 0x12C3F762;
 int32_t main(void)
 {
+  riscv_bench_header();
 
 /*Init Matrices*/
   riscv_matrix_instance_f32 MatA_f32_4_4;     
@@ -186,8 +266,23 @@ int32_t main(void)
   riscv_matrix_instance_q31 MatBComp_q31_4_4; 
   riscv_matrix_instance_q31 MatResult_q31_4_4;
   riscv_matrix_instance_q31 MatResultComp_q31_4_4;
+  riscv_matrix_packed_instance_q15 MatBPacked_q15_4_4;
+  riscv_matrix_packed_instance_q15 MatBCompPacked_q15_4_4;
+  riscv_matrix_instance_q7 MatA_q7_4_4 = {4, 4, A_q7_4_4};
+  riscv_matrix_instance_q7 MatResult_q7_4_4 = {4, 4, Result_q7_4_4};
+  riscv_mat_requant_q7 RequantTensor_q7 = {1, requantMult_q31, requantShift, -3};
+  riscv_mat_requant_q7 RequantRow_q7 = {4, requantMult_q31, requantShift, -3};
   riscv_matrix_instance_f64 MatA_f64_4_4;      
   riscv_matrix_instance_f64 MatResult_f64_4_4;
+  riscv_matrix_instance_f32 MatSpd_f32_4_4 = {4, 4, Spd_f32_4_4};
+  riscv_matrix_instance_f32 MatChol_f32_4_4 = {4, 4, Chol_f32_4_4};
+  riscv_matrix_instance_f32 MatSolve_f32_4_4 = {4, 4, Solve_f32_4_4};
+  riscv_matrix_instance_f32 MatTrans_f32_4_4 = {4, 4, Trans_f32_4_4};
+  riscv_matrix_instance_q31 MatQr_q31_4_4 = {4, 4, Qr_q31_4_4};
+  riscv_matrix_instance_q31 MatQrR_q31_4_4 = {4, 4, QrR_q31_4_4};
+  riscv_matrix_instance_f64 MatSpd_f64_4_4 = {4, 4, Spd_f64_4_4};
+  riscv_matrix_instance_f64 MatChol_f64_4_4 = {4, 4, Chol_f64_4_4};
+  riscv_matrix_instance_f64 MatSolve_f64_4_4 = {4, 4, Solve_f64_4_4};
 
   riscv_mat_init_f32(&MatA_f32_4_4, 4, 4, (float32_t *)A_f32_4_4);
   riscv_mat_init_f32(&MatB_f32_4_4, 4, 4, (float32_t *)B_f32_4_4);
@@ -213,209 +308,656 @@ int32_t main(void)
 
 /*Add*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_add_f32(&MatA_f32_4_4,&MatB_f32_4_4,&MatResult_f32_4_4);
-  perf_stop();
-  printf("riscv_mat_add_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_add_f32", "f32", 16,
+    riscv_mat_add_f32(&MatA_f32_4_4,&MatB_f32_4_4,&MatResult_f32_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_F32(MatResult_f32_4_4);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_add_q15(&MatA_q15_4_4,&MatB_q15_4_4,&MatResult_q15_4_4);
-  perf_stop();
-  printf("MatA_q15_4_4: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_add_q15", "q15", 16,
+    riscv_mat_add_q15(&MatA_q15_4_4,&MatB_q15_4_4,&MatResult_q15_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_Q(MatResult_q15_4_4);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_add_q31(&MatA_q31_4_4,&MatB_q31_4_4,&MatResult_q31_4_4);
-  perf_stop();
-  printf("MatA_q31_4_4: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_add_q31", "q31", 16,
+    riscv_mat_add_q31(&MatA_q31_4_4,&MatB_q31_4_4,&MatResult_q31_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_Q(MatResult_q31_4_4);
 #endif
 
 /*complex multiplication*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_cmplx_mult_f32(&MatAComp_f32_4_4,&MatBComp_f32_4_4,&MatResultComp_f32_4_4);
-  perf_stop();
-  printf("riscv_mat_cmplx_mult_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_cmplx_mult_f32", "f32", 16,
+    riscv_mat_cmplx_mult_f32(&MatAComp_f32_4_4,&MatBComp_f32_4_4,&MatResultComp_f32_4_4));
 #ifdef PRINT_OUTPUT
   PRINTCOMP_F32(MatResultComp_f32_4_4);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_cmplx_mult_q15(&MatAComp_q15_4_4,&MatBComp_q15_4_4,&MatResultComp_q15_4_4,scratchComp_q15);
-  perf_stop();
-  printf("riscv_mat_cmplx_mult_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_cmplx_mult_q15", "q15", 16,
+    riscv_mat_cmplx_mult_q15(&MatAComp_q15_4_4,&MatBComp_q15_4_4,&MatResultComp_q15_4_4,scratchComp_q15));
+#ifdef PRINT_OUTPUT
+  PRINTCOMP_Q(MatResultComp_q15_4_4);
+#endif
+  RISCV_BENCH("riscv_mat_cmplx_pack_q15", "q15", 16,
+    riscv_mat_cmplx_pack_q15(&MatBComp_q15_4_4,&MatBCompPacked_q15_4_4,packedComp_q15));
+  RISCV_BENCH("riscv_mat_cmplx_mult_packed_q15", "q15", 16,
+    riscv_mat_cmplx_mult_packed_q15(&MatAComp_q15_4_4,&MatBCompPacked_q15_4_4,&MatResultComp_q15_4_4));
 #ifdef PRINT_OUTPUT
   PRINTCOMP_Q(MatResultComp_q15_4_4);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_cmplx_mult_q31(&MatAComp_q31_4_4,&MatBComp_q31_4_4,&MatResultComp_q31_4_4);
-  perf_stop();
-  printf("riscv_mat_cmplx_mult_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_cmplx_mult_q31", "q31", 16,
+    riscv_mat_cmplx_mult_q31(&MatAComp_q31_4_4,&MatBComp_q31_4_4,&MatResultComp_q31_4_4));
 #ifdef PRINT_OUTPUT
   PRINTCOMP_Q(MatResultComp_q31_4_4);
 #endif
 
 /*inverse*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  status = riscv_mat_inverse_f32(&MatA_f32_4_4,&MatResult_f32_4_4);
-  perf_stop();
-  printf("riscv_mat_inverse_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_inverse_f32", "f32", 16,
+    status = riscv_mat_inverse_f32(&MatA_f32_4_4,&MatResult_f32_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_F32(MatResult_f32_4_4);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  status = riscv_mat_inverse_f64(&MatA_f64_4_4,&MatResult_f64_4_4);
-  perf_stop();
-  printf("riscv_mat_inverse_f64: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_inverse_f64", "f64", 16,
+    status = riscv_mat_inverse_f64(&MatA_f64_4_4,&MatResult_f64_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_F32(MatResult_f64_4_4);
 #endif
+  RISCV_BENCH("riscv_mat_inverse_q31", "q31", 16,
+    status = riscv_mat_inverse_q31(&MatA_q31_4_4,&MatResult_q31_4_4,InvState_q31,InvExp));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(MatResult_q31_4_4);
+#endif
+  RISCV_BENCH("riscv_mat_inverse_q15", "q15", 16,
+    status = riscv_mat_inverse_q15(&MatA_q15_4_4,&MatResult_q15_4_4,InvState_q31,InvExp));
+  RISCV_BENCH("riscv_mat_solve_q15", "q15", 16,
+    InvExp[0] = InvExp[1] = InvExp[2] = InvExp[3] = 0;
+    status = riscv_mat_solve_q15(&MatA_q15_4_4,&MatB_q15_4_4,&MatResult_q15_4_4,InvState_q31,InvExp));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(MatResult_q15_4_4);
+#endif
+
+/*symmetric positive definite decompositions and solvers, A * X = B*/
+
+  RISCV_BENCH("riscv_mat_cholesky_f32", "f32", 16,
+    status = riscv_mat_cholesky_f32(&MatSpd_f32_4_4,&MatChol_f32_4_4));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(MatChol_f32_4_4);
+#endif
+  RISCV_BENCH("riscv_mat_ldlt_f32", "f32", 16,
+    status = riscv_mat_ldlt_f32(&MatSpd_f32_4_4,&MatChol_f32_4_4,Ldlt_f32_4));
+  RISCV_BENCH("riscv_mat_cholesky_solve_f32", "f32", 16,
+    status = riscv_mat_cholesky_solve_f32(&MatSpd_f32_4_4,&MatB_f32_4_4,&MatChol_f32_4_4,&MatSolve_f32_4_4));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(MatSolve_f32_4_4);
+#endif
+  RISCV_BENCH("riscv_mat_inverse_f32 + riscv_mat_mult_f32", "f32", 16,
+    status = riscv_mat_inverse_f32(&MatSpd_f32_4_4,&MatChol_f32_4_4);
+    riscv_mat_mult_f32(&MatChol_f32_4_4,&MatB_f32_4_4,&MatSolve_f32_4_4));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(MatSolve_f32_4_4);
+#endif
+  RISCV_BENCH("riscv_mat_solve_lower_triangular_f32", "f32", 16,
+    status = riscv_mat_solve_lower_triangular_f32(&MatChol_f32_4_4,&MatB_f32_4_4,&MatSolve_f32_4_4));
+  RISCV_BENCH("riscv_mat_cholesky_f64", "f64", 16,
+    status = riscv_mat_cholesky_f64(&MatSpd_f64_4_4,&MatChol_f64_4_4));
+  RISCV_BENCH("riscv_mat_cholesky_solve_f64", "f64", 16,
+    status = riscv_mat_cholesky_solve_f64(&MatSpd_f64_4_4,&MatSpd_f64_4_4,&MatChol_f64_4_4,&MatSolve_f64_4_4));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(MatSolve_f64_4_4);
+#endif
+
+/*QR decomposition and least squares, A * X = B in the least-squares sense*/
+
+  RISCV_BENCH("riscv_mat_qr_f32", "f32", 16,
+    status = riscv_mat_qr_f32(&MatA_f32_4_4,&MatChol_f32_4_4,&MatResult_f32_4_4));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(MatChol_f32_4_4);
+#endif
+  RISCV_BENCH("riscv_mat_qr_f32 R only", "f32", 16,
+    status = riscv_mat_qr_f32(&MatA_f32_4_4,&MatChol_f32_4_4,NULL));
+  RISCV_BENCH("riscv_mat_lstsq_f32", "f32", 16,
+    status = riscv_mat_lstsq_f32(&MatA_f32_4_4,&MatB_f32_4_4,&MatChol_f32_4_4,Lstsq_f32_4_4,&MatSolve_f32_4_4));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(MatSolve_f32_4_4);
+#endif
+  /*four RLS updates of the R left by riscv_mat_lstsq_f32 with the rows of A*/
+  RISCV_BENCH("riscv_mat_qr_update_f32", "f32", 16,
+    for (uint32_t i = 0; i < 4; i++)
+    {
+      memcpy(RlsRow_f32_4, &A_f32_4_4[4 * i], sizeof(RlsRow_f32_4));
+      riscv_mat_qr_update_f32(&MatChol_f32_4_4,Rls_f32_4,RlsRow_f32_4,Vec_f32_4[i],0.99f);
+    });
+  /*the columns of A are scaled to norms below 1*/
+  for (uint32_t i = 0; i < 16; i++)
+    Qr_q31_4_4[i] = A_q31_4_4[i] >> 2;
+  RISCV_BENCH("riscv_mat_qr_q31", "q31", 16,
+    status = riscv_mat_qr_q31(&MatQr_q31_4_4,&MatQrR_q31_4_4,&MatResult_q31_4_4));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(MatQrR_q31_4_4);
+#endif
+
+/*Symmetric eigen-decomposition and singular value decomposition with Jacobi rotations*/
+
+  {
+    const uint32_t n = EIG_DIM, m = SVD_ROWS;
+    riscv_matrix_instance_f32 MatEigA = {EIG_DIM, EIG_DIM, sweepA_f32};
+    riscv_matrix_instance_f32 MatEigW = {EIG_DIM, EIG_DIM, sweepB_f32};
+    riscv_matrix_instance_f32 MatEigV = {EIG_DIM, EIG_DIM, sweepResult_f32};
+    riscv_matrix_instance_f32 MatSvdA = {SVD_ROWS, EIG_DIM, sweepA_f32};
+    riscv_matrix_instance_f32 MatSvdU = {SVD_ROWS, EIG_DIM, sweepB_f32};
+    float32_t val[EIG_DIM];
+    float32_t err = 0.0f, orth = 0.0f, e, ref;
+    uint32_t seed = 11u;
+    int32_t fail = 0;
+
+    /* random symmetric, indefinite */
+    for (uint32_t i = 0; i < n; i++)
+      for (uint32_t j = i; j < n; j++)
+      {
+        seed = seed * 1103515245u + 12345u;
+        sweepA_f32[i * n + j] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+        sweepA_f32[j * n + i] = sweepA_f32[i * n + j];
+      }
+
+    RISCV_BENCH("riscv_mat_eig_sym_f32", "f32", EIG_DIM * EIG_DIM,
+      status = riscv_mat_eig_sym_f32(&MatEigA,&MatEigW,&MatEigV,val,1e-6f));
+    fail |= (status != RISCV_MATH_SUCCESS);
+
+    /* A = V * diag(val) * V^T, V^T * V = I, largest first */
+    for (uint32_t i = 0; i < n; i++)
+      for (uint32_t j = 0; j < n; j++)
+      {
+        ref = 0.0f;
+        e = (i == j) ? -1.0f : 0.0f;
+        for (uint32_t k = 0; k < n; k++)
+        {
+          ref += sweepResult_f32[i * n + k] * val[k] * sweepResult_f32[j * n + k];
+          e += sweepResult_f32[k * n + i] * sweepResult_f32[k * n + j];
+        }
+        orth = (fabsf(e) > orth) ? fabsf(e) : orth;
+        e = fabsf(ref - sweepA_f32[i * n + j]);
+        err = (e > err) ? e : err;
+      }
+    for (uint32_t i = 1; i < n; i++)
+      fail |= (val[i] > val[i - 1]);
+    fail |= (err > 1e-5f) || (orth > 1e-5f);
+    printf("CHECK riscv_mat_eig_sym_f32: %s\n", (fail == 0) ? "equal" : "differ");
+
+    RISCV_BENCH("riscv_mat_eig_sym_f32 values only", "f32", EIG_DIM * EIG_DIM,
+      status = riscv_mat_eig_sym_f32(&MatEigA,&MatEigW,NULL,val,1e-6f));
+
+    for (uint32_t i = 0; i < m * n; i++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      sweepA_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    }
+
+    RISCV_BENCH("riscv_mat_svd_f32", "f32", SVD_ROWS * EIG_DIM,
+      status = riscv_mat_svd_f32(&MatSvdA,&MatSvdU,val,&MatEigV,1e-6f));
+    fail |= (status != RISCV_MATH_SUCCESS);
+
+    /* A = U * diag(val) * V^T, U^T * U = V^T * V = I, largest first */
+    err = 0.0f;
+    orth = 0.0f;
+    for (uint32_t i = 0; i < m; i++)
+      for (uint32_t j = 0; j < n; j++)
+      {
+        ref = 0.0f;
+        for (uint32_t k = 0; k < n; k++)
+          ref += sweepB_f32[i * n + k] * val[k] * sweepResult_f32[j * n + k];
+        e = fabsf(ref - sweepA_f32[i * n + j]);
+        err = (e > err) ? e : err;
+      }
+    for (uint32_t i = 0; i < n; i++)
+      for (uint32_t j = 0; j < n; j++)
+      {
+        e = (i == j) ? -1.0f : 0.0f;
+        ref = (i == j) ? -1.0f : 0.0f;
+        for (uint32_t k = 0; k < m; k++)
+          e += sweepB_f32[k * n + i] * sweepB_f32[k * n + j];
+        for (uint32_t k = 0; k < n; k++)
+          ref += sweepResult_f32[k * n + i] * sweepResult_f32[k * n + j];
+        orth = (fabsf(e) > orth) ? fabsf(e) : orth;
+        orth = (fabsf(ref) > orth) ? fabsf(ref) : orth;
+      }
+    for (uint32_t i = 1; i < n; i++)
+      fail |= (val[i] > val[i - 1]);
+    fail |= (err > 1e-5f) || (orth > 1e-5f);
+    printf("CHECK riscv_mat_svd_f32: %s\n", (fail == 0) ? "equal" : "differ");
+
+    if(fail)
+    {
+      return fail;
+    }
+  }
+
+/*Kalman filter, one time update and one update with KALMAN_MEAS measurements*/
+
+  {
+    const uint32_t n = KALMAN_STATES, m = KALMAN_MEAS;
+    riscv_kalman_instance_f32 Kalman;
+    riscv_matrix_instance_f32 MatKalmanF = {KALMAN_STATES, KALMAN_STATES, KalmanF_f32};
+    riscv_matrix_instance_f32 MatKalmanQ = {KALMAN_STATES, KALMAN_STATES, KalmanQ_f32};
+    riscv_matrix_instance_f32 MatKalmanP = {KALMAN_STATES, KALMAN_STATES, KalmanP_f32};
+    riscv_matrix_instance_f32 MatKalmanH = {KALMAN_MEAS, KALMAN_STATES, KalmanH_f32};
+    riscv_matrix_instance_f32 MatRefP = {KALMAN_STATES, KALMAN_STATES, sweepA_f32};
+    riscv_matrix_instance_f32 MatRefT = {KALMAN_STATES, KALMAN_STATES, sweepB_f32};
+    riscv_matrix_instance_f32 MatRefU = {KALMAN_STATES, KALMAN_STATES, sweepResult_f32};
+    float32_t *pRefPHt = sweepB_f32 + KALMAN_STATES * KALMAN_STATES;
+    float32_t *pRefS = pRefPHt + KALMAN_STATES * KALMAN_MEAS;
+    float32_t *pRefSInv = pRefS + KALMAN_MEAS * KALMAN_MEAS;
+    float32_t *pRefK = pRefSInv + KALMAN_MEAS * KALMAN_MEAS;
+    float32_t err = 0.0f, e, ref;
+    uint32_t seed = 7u;
+    int32_t fail = 0;
+
+    /* F = I + 0.1 * noise, P = Q = diagonal */
+    for (uint32_t i = 0; i < n * n; i++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      KalmanF_f32[i] = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) * 0.1f;
+      KalmanF_f32[i] += (i % (n + 1u) == 0u) ? 1.0f : 0.0f;
+      KalmanQ_f32[i] = (i % (n + 1u) == 0u) ? 0.01f : 0.0f;
+      KalmanP_f32[i] = (i % (n + 1u) == 0u) ? 1.0f + (float32_t)(i / n) * 0.1f : 0.0f;
+    }
+    for (uint32_t i = 0; i < m * n; i++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      KalmanH_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    }
+    for (uint32_t i = 0; i < n; i++)
+    {
+      KalmanX_f32[i] = (float32_t) i * 0.05f;
+    }
+
+    /* Reference: full P = F * P * F^T + Q, x = F * x */
+    riscv_mat_mult_f32(&MatKalmanF,&MatKalmanP,&MatRefT);
+    riscv_mat_trans_f32(&MatKalmanF,&MatRefU);
+    riscv_mat_mult_f32(&MatRefT,&MatRefU,&MatRefP);
+    riscv_mat_add_f32(&MatRefP,&MatKalmanQ,&MatRefP);
+    riscv_mat_vec_mult_f32(&MatKalmanF,KalmanX_f32,KalmanXRef_f32);
+
+    /* S = H * P * H^T + R, K = P * H^T * inv(S), x += K * (z - H * x), P = P - K * H * P */
+    for (uint32_t i = 0; i < n; i++)
+      for (uint32_t j = 0; j < m; j++)
+      {
+        pRefPHt[i * m + j] = 0.0f;
+        for (uint32_t k = 0; k < n; k++)
+          pRefPHt[i * m + j] += sweepA_f32[i * n + k] * KalmanH_f32[j * n + k];
+      }
+    for (uint32_t i = 0; i < m; i++)
+      for (uint32_t j = 0; j < m; j++)
+      {
+        pRefS[i * m + j] = (i == j) ? KalmanR_f32[i] : 0.0f;
+        for (uint32_t k = 0; k < n; k++)
+          pRefS[i * m + j] += KalmanH_f32[i * n + k] * pRefPHt[k * m + j];
+      }
+    {
+      riscv_matrix_instance_f32 MatRefS = {KALMAN_MEAS, KALMAN_MEAS, pRefS};
+      riscv_matrix_instance_f32 MatRefSInv = {KALMAN_MEAS, KALMAN_MEAS, pRefSInv};
+      riscv_matrix_instance_f32 MatRefPHt = {KALMAN_STATES, KALMAN_MEAS, pRefPHt};
+      riscv_matrix_instance_f32 MatRefK = {KALMAN_STATES, KALMAN_MEAS, pRefK};
+      status = riscv_mat_inverse_f32(&MatRefS,&MatRefSInv);
+      riscv_mat_mult_f32(&MatRefPHt,&MatRefSInv,&MatRefK);
+    }
+    for (uint32_t j = 0; j < m; j++)
+    {
+      pRefS[j] = KalmanZ_f32[j];
+      for (uint32_t k = 0; k < n; k++)
+        pRefS[j] -= KalmanH_f32[j * n + k] * KalmanXRef_f32[k];
+    }
+    for (uint32_t i = 0; i < n; i++)
+      for (uint32_t j = 0; j < m; j++)
+        KalmanXRef_f32[i] += pRefK[i * m + j] * pRefS[j];
+    for (uint32_t i = 0; i < n; i++)
+      for (uint32_t j = 0; j < n; j++)
+      {
+        ref = sweepA_f32[i * n + j];
+        for (uint32_t k = 0; k < m; k++)
+          ref -= pRefK[i * m + k] * pRefPHt[j * m + k];
+        sweepResult_f32[i * n + j] = ref;
+      }
+
+    status = riscv_kalman_init_f32(&Kalman,KALMAN_STATES,KalmanX_f32,&MatKalmanP,&MatKalmanF,&MatKalmanQ,KalmanWork_f32);
+    riscv_kalman_predict_f32(&Kalman,NULL);
+    status = riscv_kalman_update_f32(&Kalman,&MatKalmanH,KalmanZ_f32,KalmanR_f32);
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+      for (uint32_t j = i; j < n; j++)
+      {
+        e = fabsf(KalmanP_f32[i * n + j] - sweepResult_f32[i * n + j]);
+        err = (e > err) ? e : err;
+      }
+      e = fabsf(KalmanX_f32[i] - KalmanXRef_f32[i]);
+      err = (e > err) ? e : err;
+    }
+    fail |= (status != RISCV_MATH_SUCCESS) || (err > 1e-4f);
+    printf("CHECK riscv_kalman_update_f32: %s\n", (fail == 0) ? "equal" : "differ");
+
+    RISCV_BENCH("riscv_kalman_predict_f32", "f32", KALMAN_STATES * KALMAN_STATES,
+      riscv_kalman_predict_f32(&Kalman,NULL));
+    RISCV_BENCH("riscv_kalman_update_f32", "f32", KALMAN_STATES * KALMAN_STATES,
+      status = riscv_kalman_update_f32(&Kalman,&MatKalmanH,KalmanZ_f32,KalmanR_f32));
+    RISCV_BENCH("riscv_mat_mult_f32 + riscv_mat_trans_f32 + riscv_mat_add_f32", "f32", KALMAN_STATES * KALMAN_STATES,
+      riscv_mat_mult_f32(&MatKalmanF,&MatRefP,&MatRefT);
+      riscv_mat_trans_f32(&MatKalmanF,&MatRefU);
+      riscv_mat_mult_f32(&MatRefT,&MatRefU,&MatRefP);
+      riscv_mat_add_f32(&MatRefP,&MatKalmanQ,&MatRefP));
+
+    if(fail)
+    {
+      return fail;
+    }
+  }
 
 /*multiplication*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_mult_f32(&MatA_f32_4_4,&MatB_f32_4_4,&MatResult_f32_4_4);
-  perf_stop();
-  printf("riscv_mat_mult_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_mult_f32", "f32", 16,
+    riscv_mat_mult_f32(&MatA_f32_4_4,&MatB_f32_4_4,&MatResult_f32_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_F32(MatResult_f32_4_4);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_mult_q15(&MatA_q15_4_4,&MatB_q15_4_4,&MatResult_q15_4_4,scratch_q15);
-  perf_stop();
-  printf("riscv_mat_mult_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_mult_q15", "q15", 16,
+    riscv_mat_mult_q15(&MatA_q15_4_4,&MatB_q15_4_4,&MatResult_q15_4_4,scratch_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(MatResult_q15_4_4);
+#endif
+
+  RISCV_BENCH("riscv_mat_mult_bfp_q15", "q15", 16,
+    riscv_mat_mult_bfp_q15(&MatA_q15_4_4,&MatB_q15_4_4,&MatResult_q15_4_4,scratch_q15,&exponent_q15));
 #ifdef PRINT_OUTPUT
   PRINT_Q(MatResult_q15_4_4);
+  printf("exponent %d\n", exponent_q15);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_mult_q31(&MatA_q31_4_4,&MatB_q31_4_4,&MatResult_q31_4_4);
-  perf_stop();
-  printf("riscv_mat_mult_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_mult_q31", "q31", 16,
+    riscv_mat_mult_q31(&MatA_q31_4_4,&MatB_q31_4_4,&MatResult_q31_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_Q(MatResult_q31_4_4);
 #endif
 
+/*matrix vector multiplication*/
+
+  RISCV_BENCH("riscv_mat_vec_mult_f32", "f32", 16,
+    riscv_mat_vec_mult_f32(&MatA_f32_4_4,Vec_f32_4,VecResult_f32_4));
+#ifdef PRINT_OUTPUT
+  printf("\n"); for(int i = 0; i < 4; i++) printf("%d  ",(int)(VecResult_f32_4[i])); printf("\n\n");
+#endif
+
+  RISCV_BENCH("riscv_mat_vec_mult_q31", "q31", 16,
+    riscv_mat_vec_mult_q31(&MatA_q31_4_4,Vec_q31_4,VecResult_q31_4));
+#ifdef PRINT_OUTPUT
+  printf("\n"); for(int i = 0; i < 4; i++) printf("0x%X  ",VecResult_q31_4[i]); printf("\n\n");
+#endif
+
+  RISCV_BENCH("riscv_mat_vec_mult_q15", "q15", 16,
+    riscv_mat_vec_mult_q15(&MatA_q15_4_4,Vec_q15_4,VecResult_q15_4));
+#ifdef PRINT_OUTPUT
+  printf("\n"); for(int i = 0; i < 4; i++) printf("0x%X  ",VecResult_q15_4[i]); printf("\n\n");
+#endif
+
+  RISCV_BENCH("riscv_mat_vec_mult_q7", "q7", 16,
+    riscv_mat_vec_mult_q7(&MatA_q7_4_4,Vec_q7_4,VecResult_q7_4));
+#ifdef PRINT_OUTPUT
+  printf("\n"); for(int i = 0; i < 4; i++) printf("0x%X  ",VecResult_q7_4[i]); printf("\n\n");
+#endif
+
+/*sparse matrix vector multiplication*/
+
+  for (uint32_t i = 0; i < SPARSE_DIM * SPARSE_DIM; i++)
+  {
+    SparseDense_q15[i] = ((((i / SPARSE_DIM) * 5) + ((i % SPARSE_DIM) * 3)) % 8 == 0) ? (q15_t) (0x0123 * (i % 29)) : 0;
+    SparseDense_f32[i] = (float32_t) SparseDense_q15[i];
+  }
+  for (uint32_t i = 0; i < SPARSE_DIM; i++)
+  {
+    SparseVec_q15[i] = (q15_t) (0x0411 * i);
+    SparseVec_f32[i] = (float32_t) SparseVec_q15[i];
+  }
+  riscv_matrix_instance_f32 MatSparseDense_f32 = {SPARSE_DIM, SPARSE_DIM, SparseDense_f32};
+  riscv_matrix_instance_q15 MatSparseDense_q15 = {SPARSE_DIM, SPARSE_DIM, SparseDense_q15};
+  riscv_sparse_matrix_instance_f32 MatSparse_f32 = {0, 0, SparseRowPtr, SparseColIdx, Sparse_f32};
+  riscv_sparse_matrix_instance_q15 MatSparse_q15 = {0, 0, SparseRowPtr, SparseColIdx, Sparse_q15};
+  riscv_sparse_block_matrix_instance_q15 MatBlock_q15 = {0, 0, 2, 2, SparseRowPtr, SparseColIdx, Sparse_q15};
+
+  RISCV_BENCH("riscv_mat_vec_mult_f32 dense", "f32", SPARSE_DIM * SPARSE_DIM,
+    riscv_mat_vec_mult_f32(&MatSparseDense_f32,SparseVec_f32,SparseResult_f32));
+  RISCV_BENCH("riscv_mat_sparse_from_dense_f32", "f32", SPARSE_DIM * SPARSE_DIM,
+    status = riscv_mat_sparse_from_dense_f32(&MatSparseDense_f32,&MatSparse_f32,SPARSE_DIM * SPARSE_DIM));
+  RISCV_BENCH("riscv_mat_sparse_vec_mult_f32", "f32", SPARSE_DIM * SPARSE_DIM,
+    riscv_mat_sparse_vec_mult_f32(&MatSparse_f32,SparseVec_f32,SparseResult_f32));
+  RISCV_BENCH("riscv_mat_vec_mult_q15 dense", "q15", SPARSE_DIM * SPARSE_DIM,
+    riscv_mat_vec_mult_q15(&MatSparseDense_q15,SparseVec_q15,SparseResult_q15));
+  status = riscv_mat_sparse_from_dense_q15(&MatSparseDense_q15,&MatSparse_q15,SPARSE_DIM * SPARSE_DIM);
+  RISCV_BENCH("riscv_mat_sparse_vec_mult_q15", "q15", SPARSE_DIM * SPARSE_DIM,
+    riscv_mat_sparse_vec_mult_q15(&MatSparse_q15,SparseVec_q15,SparseResult_q15));
+  status = riscv_mat_sparse_block_from_dense_q15(&MatSparseDense_q15,&MatBlock_q15,(SPARSE_DIM * SPARSE_DIM) / 4);
+  RISCV_BENCH("riscv_mat_sparse_block_vec_mult_q15 2x2", "q15", SPARSE_DIM * SPARSE_DIM,
+    riscv_mat_sparse_block_vec_mult_q15(&MatBlock_q15,SparseVec_q15,SparseResult_q15));
+  MatBlock_q15.blockRows = 1;
+  MatBlock_q15.blockCols = 4;
+  status = riscv_mat_sparse_block_from_dense_q15(&MatSparseDense_q15,&MatBlock_q15,(SPARSE_DIM * SPARSE_DIM) / 4);
+  RISCV_BENCH("riscv_mat_sparse_block_vec_mult_q15 1x4", "q15", SPARSE_DIM * SPARSE_DIM,
+    riscv_mat_sparse_block_vec_mult_q15(&MatBlock_q15,SparseVec_q15,SparseResult_q15));
+#ifdef PRINT_OUTPUT
+  printf("\n"); for(int i = 0; i < SPARSE_DIM; i++) printf("0x%X  ",SparseResult_q15[i]); printf("\n\n");
+#endif
+
+/*Q7 multiplication with requantization*/
+
+  RISCV_BENCH("riscv_mat_mult_q7", "q7", 16,
+    riscv_mat_mult_q7(&MatA_q7_4_4,&MatA_q7_4_4,&MatResult_q7_4_4,NULL,scratch_q7));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(MatResult_q7_4_4);
+#endif
+
+  RISCV_BENCH("riscv_mat_mult_q7 per-tensor", "q7", 16,
+    riscv_mat_mult_q7(&MatA_q7_4_4,&MatA_q7_4_4,&MatResult_q7_4_4,&RequantTensor_q7,scratch_q7));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(MatResult_q7_4_4);
+#endif
+
+  RISCV_BENCH("riscv_mat_mult_q7 per-row", "q7", 16,
+    riscv_mat_mult_q7(&MatA_q7_4_4,&MatA_q7_4_4,&MatResult_q7_4_4,&RequantRow_q7,scratch_q7));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(MatResult_q7_4_4);
+#endif
+
+/*multiplication with a packed right-hand matrix*/
+
+  RISCV_BENCH("riscv_mat_pack_q15", "q15", 16,
+    riscv_mat_pack_q15(&MatB_q15_4_4,&MatBPacked_q15_4_4,packed_q15));
+
+  RISCV_BENCH("riscv_mat_mult_packed_q15", "q15", 16,
+    riscv_mat_mult_packed_q15(&MatA_q15_4_4,&MatBPacked_q15_4_4,&MatResult_q15_4_4));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(MatResult_q15_4_4);
+#endif
+
 /*fast multiplication*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_mult_fast_q15(&MatA_q15_4_4,&MatB_q15_4_4,&MatResult_q15_4_4,scratch_q15);
-  perf_stop();
-  printf("riscv_mat_mult_fast_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_mult_fast_q15", "q15", 16,
+    riscv_mat_mult_fast_q15(&MatA_q15_4_4,&MatB_q15_4_4,&MatResult_q15_4_4,scratch_q15));
 #ifdef PRINT_OUTPUT
   PRINT_Q(MatResult_q15_4_4);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_mult_fast_q31(&MatA_q31_4_4,&MatB_q31_4_4,&MatResult_q31_4_4);
-  perf_stop();
-  printf("riscv_mat_mult_fast_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_mult_fast_q31", "q31", 16,
+    riscv_mat_mult_fast_q31(&MatA_q31_4_4,&MatB_q31_4_4,&MatResult_q31_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_Q(MatResult_q31_4_4);
 #endif
 
+/*multiplication sweep*/
+
+  for (uint32_t t = 0; t < 7; t++)
+  {
+    uint16_t n = sweepSize[t];
+    uint32_t seed = 1u;
+    riscv_matrix_instance_f32 MatSweepA, MatSweepB, MatSweepResult;
+
+    if(n > MAT_SWEEP_MAX)
+    {
+      continue;
+    }
+
+    for (uint32_t i = 0; i < (uint32_t) n * n; i++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      sweepA_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+      seed = seed * 1103515245u + 12345u;
+      sweepB_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    }
+
+    riscv_mat_init_f32(&MatSweepA, n, n, sweepA_f32);
+    riscv_mat_init_f32(&MatSweepB, n, n, sweepB_f32);
+    riscv_mat_init_f32(&MatSweepResult, n, n, sweepResult_f32);
+
+    RISCV_BENCH("riscv_mat_mult_f32", "f32", (uint32_t) n * n,
+      riscv_mat_mult_f32(&MatSweepA,&MatSweepB,&MatSweepResult));
+#ifdef PRINT_OUTPUT
+    PRINT_F32(MatSweepResult);
+#endif
+  }
+
+/*batched small matrices, BATCH_COUNT matrices of each size in the sweep buffers*/
+
+  for (uint16_t dim = 2; dim <= 4; dim++)
+  {
+    uint32_t size = (uint32_t) dim * dim;
+    uint32_t seed = 1u;
+
+    for (uint32_t i = 0; i < BATCH_COUNT * size; i++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      sweepA_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+      seed = seed * 1103515245u + 12345u;
+      sweepB_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+
+      /* Diagonally dominant, so that every matrix can be inverted */
+      if((i % size) % (dim + 1u) == 0u)
+      {
+        sweepA_f32[i] += (float32_t) dim;
+      }
+    }
+
+    RISCV_BENCH("riscv_mat_mult_batch_f32", "f32", BATCH_COUNT * size,
+      riscv_mat_mult_batch_f32(sweepA_f32,sweepB_f32,sweepResult_f32,dim,BATCH_COUNT));
+
+    RISCV_BENCH("riscv_mat_mult_f32 per matrix", "f32", BATCH_COUNT * size,
+      for (uint32_t m = 0; m < BATCH_COUNT; m++)
+      {
+        riscv_matrix_instance_f32 MatBatchA = {dim, dim, sweepA_f32 + m * size};
+        riscv_matrix_instance_f32 MatBatchB = {dim, dim, sweepB_f32 + m * size};
+        riscv_matrix_instance_f32 MatBatchResult = {dim, dim, sweepResult_f32 + m * size};
+        riscv_mat_mult_f32(&MatBatchA,&MatBatchB,&MatBatchResult);
+      });
+
+    RISCV_BENCH("riscv_mat_inverse_batch_f32", "f32", BATCH_COUNT * size,
+      status = riscv_mat_inverse_batch_f32(sweepA_f32,sweepResult_f32,dim,BATCH_COUNT));
+
+    RISCV_BENCH("riscv_mat_inverse_f32 per matrix", "f32", BATCH_COUNT * size,
+      for (uint32_t m = 0; m < BATCH_COUNT; m++)
+      {
+        riscv_matrix_instance_f32 MatBatchA = {dim, dim, sweepA_f32 + m * size};
+        riscv_matrix_instance_f32 MatBatchResult = {dim, dim, sweepResult_f32 + m * size};
+        status = riscv_mat_inverse_f32(&MatBatchA,&MatBatchResult);
+      });
+
+    RISCV_BENCH("riscv_mat_vec_mult_soa_f32", "f32", BATCH_COUNT * dim,
+      riscv_mat_vec_mult_soa_f32(sweepA_f32,sweepB_f32,sweepResult_f32,dim,BATCH_COUNT));
+  }
+
 /*scale*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_scale_f32(&MatA_f32_4_4,scale_f32,&MatResult_f32_4_4);
-  perf_stop();
-  printf("riscv_mat_scale_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_scale_f32", "f32", 16,
+    riscv_mat_scale_f32(&MatA_f32_4_4,scale_f32,&MatResult_f32_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_F32(MatResult_f32_4_4);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_scale_q15(&MatA_q15_4_4,scale_q15,3,&MatResult_q15_4_4);
-  perf_stop();
-  printf("riscv_mat_scale_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_scale_q15", "q15", 16,
+    riscv_mat_scale_q15(&MatA_q15_4_4,scale_q15,3,&MatResult_q15_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_Q(MatResult_q15_4_4);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_mat_scale_q31(&MatA_q31_4_4,scale_q31,3,&MatResult_q31_4_4);
-  perf_stop();
-  printf("riscv_mat_scale_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_scale_q31", "q31", 16,
+    riscv_mat_scale_q31(&MatA_q31_4_4,scale_q31,3,&MatResult_q31_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_Q(MatResult_q31_4_4);
 #endif
 
 /*subtract*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_sub_f32(&MatA_f32_4_4,&MatB_f32_4_4,&MatResult_f32_4_4);
-  perf_stop();
-  printf("riscv_mat_sub_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_sub_f32", "f32", 16,
+    riscv_mat_sub_f32(&MatA_f32_4_4,&MatB_f32_4_4,&MatResult_f32_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_F32(MatResult_f32_4_4);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_sub_q15(&MatA_q15_4_4,&MatB_q15_4_4,&MatResult_q15_4_4);
-  perf_stop();
-  printf("riscv_mat_sub_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_sub_q15", "q15", 16,
+    riscv_mat_sub_q15(&MatA_q15_4_4,&MatB_q15_4_4,&MatResult_q15_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_Q(MatResult_q15_4_4);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_sub_q31(&MatA_q31_4_4,&MatB_q31_4_4,&MatResult_q31_4_4);
-  perf_stop();
-  printf("riscv_mat_sub_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_sub_q31", "q31", 16,
+    riscv_mat_sub_q31(&MatA_q31_4_4,&MatB_q31_4_4,&MatResult_q31_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_Q(MatResult_q31_4_4);
 #endif
 
 /*transpose*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_trans_f32(&MatA_f32_4_4,&MatResult_f32_4_4);
-  perf_stop();
-  printf("riscv_mat_trans_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_trans_f32", "f32", 16,
+    riscv_mat_trans_f32(&MatA_f32_4_4,&MatResult_f32_4_4));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(MatResult_f32_4_4);
+#endif
+  RISCV_BENCH("riscv_mat_trans_q15", "q15", 16,
+    riscv_mat_trans_q15(&MatA_q15_4_4,&MatResult_q15_4_4));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(MatResult_q15_4_4);
+#endif
+  RISCV_BENCH("riscv_mat_trans_q31", "q31", 16,
+    riscv_mat_trans_q31(&MatA_q31_4_4,&MatResult_q31_4_4));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(MatResult_q31_4_4);
+#endif
+
+/*in place transpose, the result is transposed back on every run*/
+
+  RISCV_BENCH("riscv_mat_trans_f32 in place", "f32", 16,
+    riscv_mat_trans_f32(&MatResult_f32_4_4,&MatResult_f32_4_4));
+  RISCV_BENCH("riscv_mat_trans_q15 in place", "q15", 16,
+    riscv_mat_trans_q15(&MatResult_q15_4_4,&MatResult_q15_4_4));
+  RISCV_BENCH("riscv_mat_trans_q31 in place", "q31", 16,
+    riscv_mat_trans_q31(&MatResult_q31_4_4,&MatResult_q31_4_4));
+
+/*product of a matrix with its transpose*/
+
+  RISCV_BENCH("riscv_mat_syrk_f32", "f32", 16,
+    riscv_mat_syrk_f32(&MatA_f32_4_4,&MatResult_f32_4_4,0,1));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(MatResult_f32_4_4);
+#endif
+  RISCV_BENCH("riscv_mat_trans_f32 + riscv_mat_mult_f32", "f32", 16,
+    riscv_mat_trans_f32(&MatA_f32_4_4,&MatTrans_f32_4_4);
+    riscv_mat_mult_f32(&MatA_f32_4_4,&MatTrans_f32_4_4,&MatResult_f32_4_4));
 #ifdef PRINT_OUTPUT
   PRINT_F32(MatResult_f32_4_4);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_trans_q15(&MatA_q15_4_4,&MatResult_q15_4_4);
-  perf_stop();
-  printf("riscv_mat_trans_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_syrk_q15", "q15", 16,
+    riscv_mat_syrk_q15(&MatA_q15_4_4,&MatResult_q15_4_4,1,1));
 #ifdef PRINT_OUTPUT
   PRINT_Q(MatResult_q15_4_4);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_mat_trans_q31(&MatA_q31_4_4,&MatResult_q31_4_4);
-  perf_stop();
-  printf("riscv_mat_trans_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_mat_syrk_q31", "q31", 16,
+    riscv_mat_syrk_q31(&MatA_q31_4_4,&MatResult_q31_4_4,1,1));
 #ifdef PRINT_OUTPUT
   PRINT_Q(MatResult_q31_4_4);
 #endif
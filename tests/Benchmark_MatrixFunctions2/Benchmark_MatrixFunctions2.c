@@ -0,0 +1,127 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define MAT_ROWS 102
+#define MAT_COLS 64
+#define ODD_COLS 61
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A dense layer of MAT_ROWS x MAT_COLS 4-bit weights is packed by riscv_mat_pack_q4() and multiplied with a
+Q7 vector by riscv_mat_vec_mult_q4_q7().  Without scales it is compared with riscv_mat_vec_mult_q7() on the
+weights times 16, the same 1.3 values in 1.7 format; with per-row zero points and per-row requantization with
+riscv_mat_mult_q7() on the weights minus their zero point, times the vector as a one-column matrix.  The
+second comparison is repeated with ODD_COLS columns, which leave a partial word of weights.  The CHECK
+lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "MatrixFunctions2"
+#include "../common/riscv_bench.h"
+
+q7_t w_q7[MAT_ROWS * MAT_COLS], wRef_q7[MAT_ROWS * MAT_COLS];
+uint32_t packed[MAT_ROWS * MAT_COLS / 8];
+q7_t vec_q7[MAT_COLS] __attribute__((aligned(4)));
+q7_t dst_q7[MAT_ROWS], ref_q7[MAT_ROWS];
+q7_t scratch_q7[MAT_COLS];
+int8_t zero[MAT_ROWS];
+q31_t mult[MAT_ROWS];
+uint8_t shift[MAT_ROWS];
+
+int32_t main(void)
+{
+  riscv_matrix_instance_q7 W, WRef, X, Y;
+  riscv_matrix_instance_q4 P;
+  riscv_mat_requant_q7 rq;
+  uint32_t i, r, c, cols;
+  uint32_t seed = 1u;
+  int32_t fail = 0, ok;
+
+  riscv_bench_header();
+
+  for (i = 0; i < MAT_ROWS * MAT_COLS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    w_q7[i] = (q7_t)((int32_t)(seed >> 28) - 8);
+  }
+  for (i = 0; i < MAT_COLS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    vec_q7[i] = (q7_t)(seed >> 24);
+  }
+  for (r = 0; r < MAT_ROWS; r++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    zero[r] = (int8_t)((int32_t)(seed >> 30) - 2);
+    mult[r] = 0x40000000 + (q31_t)(seed >> 3);
+    shift[r] = (uint8_t)(4u + (r & 3u));
+  }
+  rq.numMult = MAT_ROWS;
+  rq.pMultiplier = mult;
+  rq.pShift = shift;
+  rq.offset = 3;
+
+/*Symmetric weights, default scaling*/
+  for (i = 0; i < MAT_ROWS * MAT_COLS; i++)
+    wRef_q7[i] = (q7_t)(w_q7[i] * 16);
+  riscv_mat_init_q7(&W, MAT_ROWS, MAT_COLS, w_q7);
+  riscv_mat_init_q7(&WRef, MAT_ROWS, MAT_COLS, wRef_q7);
+  riscv_mat_pack_q4(&W, NULL, NULL, &P, (uint8_t *) packed);
+
+  RISCV_BENCH("riscv_mat_vec_mult_q7", "q7", MAT_ROWS,
+    riscv_mat_vec_mult_q7(&WRef, vec_q7, ref_q7));
+  RISCV_BENCH("riscv_mat_vec_mult_q4_q7", "q7", MAT_ROWS,
+    riscv_mat_vec_mult_q4_q7(&P, vec_q7, dst_q7));
+  ok = (memcmp(dst_q7, ref_q7, sizeof(ref_q7)) == 0);
+  printf("CHECK riscv_mat_vec_mult_q4_q7: %d x %d, %d bytes of weights instead of %d %s\n", MAT_ROWS, MAT_COLS,
+         (int)(MAT_ROWS * RISCV_MAT_Q4_ROW_BYTES(MAT_COLS)), MAT_ROWS * MAT_COLS, ok ? "ok" : "bad");
+  fail |= !ok;
+
+/*Zero points and per-row requantization, whole and partial words*/
+  for (cols = MAT_COLS; cols >= ODD_COLS; cols -= (MAT_COLS - ODD_COLS))
+  {
+    for (r = 0; r < MAT_ROWS; r++)
+      for (c = 0; c < cols; c++)
+        wRef_q7[r * cols + c] = (q7_t)(w_q7[r * MAT_COLS + c] - zero[r]);
+    for (r = 0; r < MAT_ROWS; r++)
+      memmove(&w_q7[r * cols], &w_q7[r * MAT_COLS], cols);
+    riscv_mat_init_q7(&W, MAT_ROWS, cols, w_q7);
+    riscv_mat_init_q7(&WRef, MAT_ROWS, cols, wRef_q7);
+    riscv_mat_init_q7(&X, cols, 1, vec_q7);
+    riscv_mat_init_q7(&Y, MAT_ROWS, 1, ref_q7);
+    riscv_mat_pack_q4(&W, zero, &rq, &P, (uint8_t *) packed);
+
+    if(cols == MAT_COLS)
+    {
+      RISCV_BENCH("riscv_mat_mult_q7 per-row", "q7", MAT_ROWS,
+        riscv_mat_mult_q7(&WRef, &X, &Y, &rq, scratch_q7));
+      RISCV_BENCH("riscv_mat_vec_mult_q4_q7 per-row", "q7", MAT_ROWS,
+        riscv_mat_vec_mult_q4_q7(&P, vec_q7, dst_q7));
+    }
+    else
+    {
+      riscv_mat_mult_q7(&WRef, &X, &Y, &rq, scratch_q7);
+      riscv_mat_vec_mult_q4_q7(&P, vec_q7, dst_q7);
+    }
+    ok = (memcmp(dst_q7, ref_q7, sizeof(ref_q7)) == 0);
+    printf("CHECK riscv_mat_vec_mult_q4_q7 zero points and per-row scales: %d columns %s\n", (int) cols,
+           ok ? "ok" : "bad");
+    fail |= !ok;
+  }
+
+#ifdef PRINT_OUTPUT
+  for (i = 0; i < 8; i++)
+    printf("%d %d\n", dst_q7[i], ref_q7[i]);
+#endif
+
+  printf("End\n");
+
+  return (fail);
+}
@@ -0,0 +1,278 @@
+#include <stdio.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+/*
+*Neural-network layers (riscv_math.h, groupNN) against the composition of library kernels they replace:
+*the q7 data widened with riscv_q7_to_q15, multiplied with riscv_mat_mult_fast_q15, narrowed with
+riscv_q15_to_q7 and biased with riscv_add_q7.  The lines of type q7-matmult measure the composition.
+*The composition truncates where the layers round, so the CHECK lines report the largest difference
+between the two outputs, which must not exceed 1; the program fails otherwise.
+*The inputs are small enough that the Q15 products of the composition do not saturate.
+*/
+#define RISCV_BENCH_SUITE "NNFunctions"
+#include "../common/riscv_bench.h"
+
+#define DIM_VEC      64
+#define NUM_ROWS     32
+#define DIM_IM_IN    8
+#define CH_IM_IN     4
+#define CH_IM_OUT    8
+#define DIM_KERNEL   3
+#define PADDING      1
+#define STRIDE       1
+#define DIM_IM_OUT   8
+#define COL_LEN      (CH_IM_IN * DIM_KERNEL * DIM_KERNEL)
+#define NUM_PIXELS   (DIM_IM_OUT * DIM_IM_OUT)
+#define POOL_KERNEL  2
+#define POOL_OUT     (DIM_IM_IN / POOL_KERNEL)
+#define ACT_SIZE     256
+
+/*Operand sizes of the composition, large enough for the fully-connected and the convolution calls*/
+#define MAX(a, b)    (((a) > (b)) ? (a) : (b))
+#define MAT_A_LEN    MAX(NUM_ROWS * DIM_VEC, CH_IM_OUT * COL_LEN)
+#define MAT_B_LEN    MAX(DIM_VEC, COL_LEN * NUM_PIXELS)
+#define MAT_C_LEN    MAX(NUM_ROWS, CH_IM_OUT * NUM_PIXELS)
+
+/*With weights and inputs in Q7 the composition computes (acc << 16) >> 15 >> 8, that is acc >> 7*/
+#define OUT_SHIFT    7
+#define BIAS_SHIFT   7
+
+q7_t vec_q7[DIM_VEC];
+q7_t wtFc_q7[NUM_ROWS * DIM_VEC];
+q7_t biasFc_q7[NUM_ROWS];
+q7_t outFc_q7[NUM_ROWS];
+q7_t refFc_q7[NUM_ROWS];
+q15_t vec_q15[DIM_VEC];
+q15_t wtFc_q15[NUM_ROWS * DIM_VEC];
+q15_t biasFc_q15[NUM_ROWS];
+q15_t outFc_q15[NUM_ROWS];
+
+q7_t im_q7[DIM_IM_IN * DIM_IM_IN * CH_IM_IN];
+q7_t wtConv_q7[CH_IM_OUT * COL_LEN];
+q7_t wtDw_q7[DIM_KERNEL * DIM_KERNEL * CH_IM_IN];
+q7_t biasConv_q7[CH_IM_OUT];
+q7_t outConv_q7[NUM_PIXELS * CH_IM_OUT];
+q7_t refConv_q7[NUM_PIXELS * CH_IM_OUT];
+q7_t outDw_q7[NUM_PIXELS * CH_IM_IN];
+q7_t bufferA_q7[2 * COL_LEN];
+q15_t im_q15[DIM_IM_IN * DIM_IM_IN * CH_IM_IN];
+q15_t wtConv_q15[CH_IM_OUT * COL_LEN];
+q15_t wtDw_q15[DIM_KERNEL * DIM_KERNEL * CH_IM_IN];
+q15_t biasConv_q15[CH_IM_OUT];
+q15_t outConv_q15[NUM_PIXELS * CH_IM_OUT];
+q15_t outDw_q15[NUM_PIXELS * CH_IM_IN];
+q15_t bufferA_q15[2 * COL_LEN];
+
+q7_t pool_q7[POOL_OUT * POOL_OUT * CH_IM_IN];
+q15_t pool_q15[POOL_OUT * POOL_OUT * CH_IM_IN];
+q7_t act_q7[ACT_SIZE];
+q15_t act_q15[ACT_SIZE];
+q7_t prob_q7[ACT_SIZE];
+q15_t prob_q15[ACT_SIZE];
+
+/*Operands of the composition*/
+q15_t matA_q15[MAT_A_LEN];
+q15_t matB_q15[MAT_B_LEN];
+q15_t matC_q15[MAT_C_LEN];
+q15_t matState_q15[MAT_B_LEN];
+q7_t col_q7[COL_LEN * NUM_PIXELS];
+q7_t res_q7[MAT_C_LEN];
+q7_t biasRep_q7[MAT_C_LEN];
+
+riscv_matrix_instance_q15 MatA, MatB, MatC;
+
+static void fill_inputs(void)
+{
+  uint32_t i, r = 1u;
+
+  /*Q7 values in [-8, 7], so that no Q15 product of the composition saturates*/
+  for (i = 0u; i < (NUM_ROWS * DIM_VEC); i++)
+  {
+    r = (r * 1103515245u) + 12345u;
+    wtFc_q7[i] = (q7_t) ((int32_t) (r >> 16) % 8);
+    wtFc_q15[i] = wtFc_q7[i];
+    if(i < DIM_VEC)
+    {
+      vec_q7[i] = (q7_t) ((int32_t) (r >> 8) % 8);
+      vec_q15[i] = vec_q7[i];
+    }
+    if(i < NUM_ROWS)
+    {
+      biasFc_q7[i] = (q7_t) ((int32_t) (r >> 20) % 16);
+      biasFc_q15[i] = biasFc_q7[i];
+    }
+    if(i < (CH_IM_OUT * COL_LEN))
+    {
+      wtConv_q7[i] = (q7_t) ((int32_t) (r >> 12) % 8);
+      wtConv_q15[i] = wtConv_q7[i];
+    }
+    if(i < (DIM_IM_IN * DIM_IM_IN * CH_IM_IN))
+    {
+      im_q7[i] = (q7_t) ((int32_t) (r >> 4) % 8);
+      im_q15[i] = im_q7[i];
+    }
+    if(i < (DIM_KERNEL * DIM_KERNEL * CH_IM_IN))
+    {
+      wtDw_q7[i] = (q7_t) ((int32_t) (r >> 14) % 8);
+      wtDw_q15[i] = wtDw_q7[i];
+    }
+    if(i < CH_IM_OUT)
+    {
+      biasConv_q7[i] = (q7_t) ((int32_t) (r >> 18) % 16);
+      biasConv_q15[i] = biasConv_q7[i];
+    }
+    if(i < ACT_SIZE)
+    {
+      act_q7[i] = (q7_t) (r >> 24);
+      act_q15[i] = (q15_t) (r >> 16);
+    }
+  }
+}
+
+/*Receptive fields of all output pixels as the columns of a COL_LEN x NUM_PIXELS matrix*/
+static void im2col_all(void)
+{
+  int32_t ix, iy;
+  uint32_t ox, oy, kx, ky, c, row;
+
+  for (oy = 0u; oy < DIM_IM_OUT; oy++)
+  {
+    for (ox = 0u; ox < DIM_IM_OUT; ox++)
+    {
+      row = 0u;
+      for (ky = 0u; ky < DIM_KERNEL; ky++)
+      {
+        for (kx = 0u; kx < DIM_KERNEL; kx++)
+        {
+          iy = (int32_t) ((oy * STRIDE) + ky) - PADDING;
+          ix = (int32_t) ((ox * STRIDE) + kx) - PADDING;
+          for (c = 0u; c < CH_IM_IN; c++, row++)
+          {
+            col_q7[(row * NUM_PIXELS) + (oy * DIM_IM_OUT) + ox] =
+              ((iy < 0) || (iy >= DIM_IM_IN) || (ix < 0) || (ix >= DIM_IM_IN)) ? 0 :
+              im_q7[(((iy * DIM_IM_IN) + ix) * CH_IM_IN) + c];
+          }
+        }
+      }
+    }
+  }
+}
+
+/*pOut = pM * pV + bias through the Q15 matrix multiplication, numCols columns of pV*/
+static void matmult_q7(
+  q7_t * pM,
+  q7_t * pV,
+  q7_t * bias,
+  uint16_t numRows,
+  uint16_t dim,
+  uint16_t numCols,
+  q7_t * pOut)
+{
+  uint32_t i;
+
+  riscv_q7_to_q15(pM, matA_q15, numRows * dim);
+  riscv_q7_to_q15(pV, matB_q15, dim * numCols);
+  riscv_mat_init_q15(&MatA, numRows, dim, matA_q15);
+  riscv_mat_init_q15(&MatB, dim, numCols, matB_q15);
+  riscv_mat_init_q15(&MatC, numRows, numCols, matC_q15);
+  riscv_mat_mult_fast_q15(&MatA, &MatB, &MatC, matState_q15);
+  riscv_q15_to_q7(matC_q15, res_q7, numRows * numCols);
+  for (i = 0u; i < (uint32_t) (numRows * numCols); i++)
+  {
+    biasRep_q7[i] = bias[i / numCols];
+  }
+  riscv_add_q7(res_q7, biasRep_q7, pOut, numRows * numCols);
+}
+
+static int32_t max_diff_q7(
+  q7_t * pA,
+  q7_t * pB,
+  uint32_t n)
+{
+  int32_t d, maxDiff = 0;
+  uint32_t i;
+
+  for (i = 0u; i < n; i++)
+  {
+    d = (int32_t) pA[i] - pB[i];
+    d = (d < 0) ? -d : d;
+    maxDiff = (d > maxDiff) ? d : maxDiff;
+  }
+
+  return maxDiff;
+}
+
+int32_t main(void)
+{
+  int32_t diffFc, diffConv;
+  uint32_t p, c;
+
+  fill_inputs();
+  im2col_all();
+  riscv_bench_header();
+
+  /*Fully-connected layer*/
+  RISCV_BENCH("riscv_fully_connected_q7", "q7", NUM_ROWS,
+              riscv_fully_connected_q7(vec_q7, wtFc_q7, DIM_VEC, NUM_ROWS, BIAS_SHIFT, OUT_SHIFT, biasFc_q7, outFc_q7));
+  RISCV_BENCH("riscv_fully_connected_q7", "q7-matmult", NUM_ROWS,
+              matmult_q7(wtFc_q7, vec_q7, biasFc_q7, NUM_ROWS, DIM_VEC, 1, refFc_q7));
+  RISCV_BENCH("riscv_fully_connected_q15", "q15", NUM_ROWS,
+              riscv_fully_connected_q15(vec_q15, wtFc_q15, DIM_VEC, NUM_ROWS, BIAS_SHIFT, OUT_SHIFT, biasFc_q15, outFc_q15));
+
+  /*Convolution layers*/
+  RISCV_BENCH("riscv_convolve_HWC_q7", "q7", NUM_PIXELS,
+              riscv_convolve_HWC_q7(im_q7, DIM_IM_IN, CH_IM_IN, wtConv_q7, CH_IM_OUT, DIM_KERNEL, PADDING, STRIDE,
+                                    biasConv_q7, BIAS_SHIFT, OUT_SHIFT, outConv_q7, DIM_IM_OUT, bufferA_q7));
+  RISCV_BENCH("riscv_convolve_HWC_q7", "q7-matmult", NUM_PIXELS,
+              matmult_q7(wtConv_q7, col_q7, biasConv_q7, CH_IM_OUT, COL_LEN, NUM_PIXELS, res_q7));
+  RISCV_BENCH("riscv_convolve_HWC_q15", "q15", NUM_PIXELS,
+              riscv_convolve_HWC_q15(im_q15, DIM_IM_IN, CH_IM_IN, wtConv_q15, CH_IM_OUT, DIM_KERNEL, PADDING, STRIDE,
+                                     biasConv_q15, BIAS_SHIFT, OUT_SHIFT, outConv_q15, DIM_IM_OUT, bufferA_q15));
+  RISCV_BENCH("riscv_depthwise_separable_conv_HWC_q7", "q7", NUM_PIXELS,
+              riscv_depthwise_separable_conv_HWC_q7(im_q7, DIM_IM_IN, CH_IM_IN, wtDw_q7, CH_IM_IN, DIM_KERNEL, PADDING,
+                                                    STRIDE, biasConv_q7, BIAS_SHIFT, OUT_SHIFT, outDw_q7, DIM_IM_OUT,
+                                                    bufferA_q7));
+  RISCV_BENCH("riscv_depthwise_separable_conv_HWC_q15", "q15", NUM_PIXELS,
+              riscv_depthwise_separable_conv_HWC_q15(im_q15, DIM_IM_IN, CH_IM_IN, wtDw_q15, CH_IM_IN, DIM_KERNEL,
+                                                     PADDING, STRIDE, biasConv_q15, BIAS_SHIFT, OUT_SHIFT, outDw_q15,
+                                                     DIM_IM_OUT, bufferA_q15));
+
+  /*Pooling layers*/
+  RISCV_BENCH("riscv_maxpool_q7_HWC", "q7", POOL_OUT * POOL_OUT,
+              riscv_maxpool_q7_HWC(im_q7, DIM_IM_IN, CH_IM_IN, POOL_KERNEL, 0, POOL_KERNEL, POOL_OUT, pool_q7));
+  RISCV_BENCH("riscv_avepool_q7_HWC", "q7", POOL_OUT * POOL_OUT,
+              riscv_avepool_q7_HWC(im_q7, DIM_IM_IN, CH_IM_IN, POOL_KERNEL, 0, POOL_KERNEL, POOL_OUT, pool_q7));
+  RISCV_BENCH("riscv_maxpool_q15_HWC", "q15", POOL_OUT * POOL_OUT,
+              riscv_maxpool_q15_HWC(im_q15, DIM_IM_IN, CH_IM_IN, POOL_KERNEL, 0, POOL_KERNEL, POOL_OUT, pool_q15));
+  RISCV_BENCH("riscv_avepool_q15_HWC", "q15", POOL_OUT * POOL_OUT,
+              riscv_avepool_q15_HWC(im_q15, DIM_IM_IN, CH_IM_IN, POOL_KERNEL, 0, POOL_KERNEL, POOL_OUT, pool_q15));
+
+  /*Activations, softmax first as ReLU works in place*/
+  RISCV_BENCH("riscv_softmax_q7", "q7", ACT_SIZE, riscv_softmax_q7(act_q7, ACT_SIZE, prob_q7));
+  RISCV_BENCH("riscv_softmax_q15", "q15", ACT_SIZE, riscv_softmax_q15(act_q15, ACT_SIZE, prob_q15));
+  RISCV_BENCH("riscv_relu_q7", "q7", ACT_SIZE, riscv_relu_q7(act_q7, ACT_SIZE));
+  RISCV_BENCH("riscv_relu_q15", "q15", ACT_SIZE, riscv_relu_q15(act_q15, ACT_SIZE));
+
+  /*The composition gives the convolution outputs channel by channel, the layer pixel by pixel*/
+  for (p = 0u; p < NUM_PIXELS; p++)
+  {
+    for (c = 0u; c < CH_IM_OUT; c++)
+    {
+      refConv_q7[(p * CH_IM_OUT) + c] = res_q7[(c * NUM_PIXELS) + p];
+    }
+  }
+  diffFc = max_diff_q7(outFc_q7, refFc_q7, NUM_ROWS);
+  diffConv = max_diff_q7(outConv_q7, refConv_q7, NUM_PIXELS * CH_IM_OUT);
+
+  printf("#CHECK,kernel,type,max_diff\n");
+  printf("CHECK,riscv_fully_connected_q7,q7,%d\n", (int) diffFc);
+  printf("CHECK,riscv_convolve_HWC_q7,q7,%d\n", (int) diffConv);
+
+  return ((diffFc > 1) || (diffConv > 1)) ? 1 : 0;
+}
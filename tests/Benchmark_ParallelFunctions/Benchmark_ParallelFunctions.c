@@ -0,0 +1,295 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define MAT_DIM 24
+#define FIR_TAPS 32
+#define FIR_BLOCK 256
+#define CONV_LEN_A 128
+#define CONV_LEN_B 32
+#define CFFT_LEN 512
+#define MAX_CORES 8
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.  The single-core function is measured first, then the
+parallel version for 1, 2, 4 and 8 cores.
+*PULPino has a single core, so the parallel functions are forked with bench_fork(), which runs the cores one
+after the other and measures the cycles of every core.  The longest core of every fork is its critical path, the
+sum over the forks is the time of a cluster without contention or fork overhead.  One SCALE line is printed per
+function and number of cores:
+*  #SCALE,suite,kernel,type,size,build,cores,critical,work,efficiency
+*with work the cycles of all cores and efficiency = 100 * critical(1 core) / (cores * critical) in percent.
+*Define PRINT_OUTPUT to compare the results of the parallel functions with the single-core functions
+*/
+#define RISCV_BENCH_SUITE "ParallelFunctions"
+#include "../common/riscv_bench.h"
+
+float32_t matA_f32[MAT_DIM * MAT_DIM], matB_f32[MAT_DIM * MAT_DIM];
+float32_t matC_f32[MAT_DIM * MAT_DIM], matRef_f32[MAT_DIM * MAT_DIM];
+q31_t matA_q31[MAT_DIM * MAT_DIM], matB_q31[MAT_DIM * MAT_DIM];
+q31_t matC_q31[MAT_DIM * MAT_DIM], matRef_q31[MAT_DIM * MAT_DIM];
+q15_t matA_q15[MAT_DIM * MAT_DIM], matB_q15[MAT_DIM * MAT_DIM], matPacked_q15[MAT_DIM * MAT_DIM];
+q15_t matC_q15[MAT_DIM * MAT_DIM], matRef_q15[MAT_DIM * MAT_DIM];
+
+float32_t firCoeffs_f32[FIR_TAPS], firSrc_f32[FIR_BLOCK], firDst_f32[FIR_BLOCK], firRef_f32[FIR_BLOCK];
+float32_t firState_f32[FIR_TAPS + FIR_BLOCK - 1], firStateRef_f32[FIR_TAPS + FIR_BLOCK - 1];
+float32_t firScratch_f32[RISCV_FIR_PAR_SCRATCH_SIZE(FIR_TAPS, FIR_BLOCK, 1u)];
+q31_t firCoeffs_q31[FIR_TAPS], firSrc_q31[FIR_BLOCK], firDst_q31[FIR_BLOCK], firRef_q31[FIR_BLOCK];
+q31_t firState_q31[FIR_TAPS + FIR_BLOCK - 1], firStateRef_q31[FIR_TAPS + FIR_BLOCK - 1];
+q31_t firScratch_q31[RISCV_FIR_PAR_SCRATCH_SIZE(FIR_TAPS, FIR_BLOCK, 1u)];
+q15_t firCoeffs_q15[FIR_TAPS], firSrc_q15[FIR_BLOCK], firDst_q15[FIR_BLOCK], firRef_q15[FIR_BLOCK];
+q15_t firState_q15[FIR_TAPS + FIR_BLOCK], firStateRef_q15[FIR_TAPS + FIR_BLOCK];
+q15_t firScratch_q15[RISCV_FIR_PAR_SCRATCH_SIZE(FIR_TAPS, FIR_BLOCK, 1u)];
+
+float32_t convA_f32[CONV_LEN_A], convB_f32[CONV_LEN_B];
+float32_t convDst_f32[CONV_LEN_A + CONV_LEN_B], convRef_f32[CONV_LEN_A + CONV_LEN_B];
+q31_t convA_q31[CONV_LEN_A], convB_q31[CONV_LEN_B];
+q31_t convDst_q31[CONV_LEN_A + CONV_LEN_B], convRef_q31[CONV_LEN_A + CONV_LEN_B];
+q15_t convA_q15[CONV_LEN_A], convB_q15[CONV_LEN_B];
+q15_t convDst_q15[CONV_LEN_A + CONV_LEN_B], convRef_q15[CONV_LEN_A + CONV_LEN_B];
+
+float32_t cfftSrc_f32[2 * CFFT_LEN], cfftBuf_f32[2 * CFFT_LEN], cfftRef_f32[2 * CFFT_LEN];
+float32_t cfftScratch_f32[2 * CFFT_LEN], cfftTwiddle_f32[RISCV_CFFT_PAR_TWIDDLE_SIZE(CFFT_LEN)];
+
+uint32_t numCoresList[4] = {1, 2, 4, 8};
+
+/*
+*Cycles of the forks of the measured call, see bench_fork()
+*/
+uint32_t benchCritical, benchWork;
+
+static void bench_fork(uint32_t numCores, riscv_par_func func, void *arg)
+{
+  uint32_t coreId, cycles, longest = 0;
+
+  for (coreId = 0; coreId < numCores; coreId++)
+  {
+    riscv_bench_timer_start(RISCV_BENCH_EV_CYCLES);
+    func(arg, coreId, numCores);
+    riscv_bench_timer_stop();
+    cycles = riscv_bench_timer_read(RISCV_BENCH_EV_CYCLES);
+
+    benchWork += cycles;
+    if(cycles > longest)
+    {
+      longest = cycles;
+    }
+  }
+
+  benchCritical += longest;
+}
+
+/*
+*Runs a statement using the parallel context P for every entry of numCoresList
+*/
+#define BENCH_SCALE(KERNEL, TYPE, SIZE, ...)                                             \
+  do                                                                                     \
+  {                                                                                      \
+    uint32_t _c, _base = 1;                                                              \
+    for (_c = 0; _c < 4; _c++)                                                           \
+    {                                                                                    \
+      riscv_par_init(&P, numCoresList[_c], bench_fork);                                  \
+      benchCritical = benchWork = 0;                                                     \
+      __VA_ARGS__;                                                                       \
+      if(_c == 0) _base = (benchCritical > 0) ? benchCritical : 1;                       \
+      printf("SCALE,%s,%s,%s,%d,%s,%d,%d,%d,%d\n", RISCV_BENCH_SUITE, (KERNEL), (TYPE),  \
+             (int)(SIZE), RISCV_BENCH_BUILD, (int)numCoresList[_c], (int)benchCritical,  \
+             (int)benchWork,                                                             \
+             (int)((100u * _base) / (numCoresList[_c] * ((benchCritical > 0) ? benchCritical : 1)))); \
+    }                                                                                    \
+  } while(0)
+
+#define PRINT_CMP(NAME,X,Y,N) printf("%s: %s\n", (NAME), (memcmp((X), (Y), (N) * sizeof((X)[0])) == 0) ? "equal" : "differ")
+
+int32_t main(void)
+{
+  riscv_par_instance P;
+  riscv_matrix_instance_f32 A_f32, B_f32, C_f32, Ref_f32;
+  riscv_matrix_instance_q31 A_q31, B_q31, C_q31, Ref_q31;
+  riscv_matrix_instance_q15 A_q15, B_q15, C_q15, Ref_q15;
+  riscv_matrix_packed_instance_q15 Packed_q15;
+  riscv_fir_instance_f32 fir_f32, firRefInst_f32;
+  riscv_fir_instance_q31 fir_q31, firRefInst_q31;
+  riscv_fir_instance_q15 fir_q15, firRefInst_q15;
+  riscv_cfft_par_instance_f32 cfft_f32;
+  uint32_t i;
+  uint32_t seed = 1u;
+  float32_t r;
+
+  /* With MAX_CORES the scratch of the parallel FIR filters is filled with the largest number of cores */
+  static float32_t firScratchMax_f32[RISCV_FIR_PAR_SCRATCH_SIZE(FIR_TAPS, FIR_BLOCK, MAX_CORES)];
+  static q31_t firScratchMax_q31[RISCV_FIR_PAR_SCRATCH_SIZE(FIR_TAPS, FIR_BLOCK, MAX_CORES)];
+  static q15_t firScratchMax_q15[RISCV_FIR_PAR_SCRATCH_SIZE(FIR_TAPS, FIR_BLOCK, MAX_CORES)];
+
+  riscv_bench_header();
+  printf("#SCALE,suite,kernel,type,size,build,cores,critical,work,efficiency\n");
+
+  for (i = 0; i < MAT_DIM * MAT_DIM; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    r = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    matA_f32[i] = r;
+    matA_q31[i] = (q31_t)(r * 67108864.0f);
+    matA_q15[i] = (q15_t)(r * 1024.0f);
+    seed = seed * 1103515245u + 12345u;
+    r = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    matB_f32[i] = r;
+    matB_q31[i] = (q31_t)(r * 67108864.0f);
+    matB_q15[i] = (q15_t)(r * 1024.0f);
+  }
+
+  for (i = 0; i < FIR_TAPS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    r = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / FIR_TAPS;
+    firCoeffs_f32[i] = r;
+    firCoeffs_q31[i] = (q31_t)(r * 2147483647.0f);
+    firCoeffs_q15[i] = (q15_t)(r * 32767.0f);
+  }
+
+  for (i = 0; i < FIR_BLOCK; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    r = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    firSrc_f32[i] = r;
+    firSrc_q31[i] = (q31_t)(r * 2147483647.0f);
+    firSrc_q15[i] = (q15_t)(r * 32767.0f);
+  }
+
+  for (i = 0; i < CONV_LEN_A; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    r = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / 8.0f;
+    convA_f32[i] = r;
+    convA_q31[i] = (q31_t)(r * 2147483647.0f);
+    convA_q15[i] = (q15_t)(r * 32767.0f);
+  }
+
+  for (i = 0; i < CONV_LEN_B; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    r = ((float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f) / 8.0f;
+    convB_f32[i] = r;
+    convB_q31[i] = (q31_t)(r * 2147483647.0f);
+    convB_q15[i] = (q15_t)(r * 32767.0f);
+  }
+
+  for (i = 0; i < 2 * CFFT_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    cfftSrc_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+  }
+
+  riscv_mat_init_f32(&A_f32, MAT_DIM, MAT_DIM, matA_f32);
+  riscv_mat_init_f32(&B_f32, MAT_DIM, MAT_DIM, matB_f32);
+  riscv_mat_init_f32(&C_f32, MAT_DIM, MAT_DIM, matC_f32);
+  riscv_mat_init_f32(&Ref_f32, MAT_DIM, MAT_DIM, matRef_f32);
+  riscv_mat_init_q31(&A_q31, MAT_DIM, MAT_DIM, matA_q31);
+  riscv_mat_init_q31(&B_q31, MAT_DIM, MAT_DIM, matB_q31);
+  riscv_mat_init_q31(&C_q31, MAT_DIM, MAT_DIM, matC_q31);
+  riscv_mat_init_q31(&Ref_q31, MAT_DIM, MAT_DIM, matRef_q31);
+  riscv_mat_init_q15(&A_q15, MAT_DIM, MAT_DIM, matA_q15);
+  riscv_mat_init_q15(&B_q15, MAT_DIM, MAT_DIM, matB_q15);
+  riscv_mat_init_q15(&C_q15, MAT_DIM, MAT_DIM, matC_q15);
+  riscv_mat_init_q15(&Ref_q15, MAT_DIM, MAT_DIM, matRef_q15);
+  riscv_mat_pack_q15(&B_q15, &Packed_q15, matPacked_q15);
+
+/*Matrix multiplication*/
+  RISCV_BENCH("riscv_mat_mult_f32", "f32", MAT_DIM * MAT_DIM, riscv_mat_mult_f32(&A_f32, &B_f32, &Ref_f32));
+  BENCH_SCALE("riscv_mat_mult_par_f32", "f32", MAT_DIM * MAT_DIM, riscv_mat_mult_par_f32(&P, &A_f32, &B_f32, &C_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_mat_mult_par_f32", matC_f32, matRef_f32, MAT_DIM * MAT_DIM);
+#endif
+
+  RISCV_BENCH("riscv_mat_mult_q31", "q31", MAT_DIM * MAT_DIM, riscv_mat_mult_q31(&A_q31, &B_q31, &Ref_q31));
+  BENCH_SCALE("riscv_mat_mult_par_q31", "q31", MAT_DIM * MAT_DIM, riscv_mat_mult_par_q31(&P, &A_q31, &B_q31, &C_q31));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_mat_mult_par_q31", matC_q31, matRef_q31, MAT_DIM * MAT_DIM);
+#endif
+
+  RISCV_BENCH("riscv_mat_mult_packed_q15", "q15", MAT_DIM * MAT_DIM, riscv_mat_mult_packed_q15(&A_q15, &Packed_q15, &Ref_q15));
+  BENCH_SCALE("riscv_mat_mult_packed_par_q15", "q15", MAT_DIM * MAT_DIM,
+    riscv_mat_mult_packed_par_q15(&P, &A_q15, &Packed_q15, &C_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_mat_mult_packed_par_q15", matC_q15, matRef_q15, MAT_DIM * MAT_DIM);
+#endif
+
+/*FIR*/
+  riscv_fir_init_f32(&firRefInst_f32, FIR_TAPS, firCoeffs_f32, firStateRef_f32, FIR_BLOCK);
+  RISCV_BENCH("riscv_fir_f32", "f32", FIR_BLOCK, riscv_fir_f32(&firRefInst_f32, firSrc_f32, firRef_f32, FIR_BLOCK));
+  BENCH_SCALE("riscv_fir_par_f32", "f32", FIR_BLOCK,
+    riscv_fir_init_f32(&fir_f32, FIR_TAPS, firCoeffs_f32, firState_f32, FIR_BLOCK);
+    riscv_fir_par_f32(&P, &fir_f32, firSrc_f32, firDst_f32, FIR_BLOCK, firScratchMax_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_fir_par_f32", firDst_f32, firRef_f32, FIR_BLOCK);
+#endif
+
+  riscv_fir_init_q31(&firRefInst_q31, FIR_TAPS, firCoeffs_q31, firStateRef_q31, FIR_BLOCK);
+  RISCV_BENCH("riscv_fir_q31", "q31", FIR_BLOCK, riscv_fir_q31(&firRefInst_q31, firSrc_q31, firRef_q31, FIR_BLOCK));
+  BENCH_SCALE("riscv_fir_par_q31", "q31", FIR_BLOCK,
+    riscv_fir_init_q31(&fir_q31, FIR_TAPS, firCoeffs_q31, firState_q31, FIR_BLOCK);
+    riscv_fir_par_q31(&P, &fir_q31, firSrc_q31, firDst_q31, FIR_BLOCK, firScratchMax_q31));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_fir_par_q31", firDst_q31, firRef_q31, FIR_BLOCK);
+#endif
+
+  riscv_fir_init_q15(&firRefInst_q15, FIR_TAPS, firCoeffs_q15, firStateRef_q15, FIR_BLOCK);
+  RISCV_BENCH("riscv_fir_q15", "q15", FIR_BLOCK, riscv_fir_q15(&firRefInst_q15, firSrc_q15, firRef_q15, FIR_BLOCK));
+  BENCH_SCALE("riscv_fir_par_q15", "q15", FIR_BLOCK,
+    riscv_fir_init_q15(&fir_q15, FIR_TAPS, firCoeffs_q15, firState_q15, FIR_BLOCK);
+    riscv_fir_par_q15(&P, &fir_q15, firSrc_q15, firDst_q15, FIR_BLOCK, firScratchMax_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_fir_par_q15", firDst_q15, firRef_q15, FIR_BLOCK);
+#endif
+
+/*Convolution*/
+  RISCV_BENCH("riscv_conv_f32", "f32", CONV_LEN_A, riscv_conv_f32(convA_f32, CONV_LEN_A, convB_f32, CONV_LEN_B, convRef_f32));
+  BENCH_SCALE("riscv_conv_par_f32", "f32", CONV_LEN_A,
+    riscv_conv_par_f32(&P, convA_f32, CONV_LEN_A, convB_f32, CONV_LEN_B, convDst_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_conv_par_f32", convDst_f32, convRef_f32, CONV_LEN_A + CONV_LEN_B - 1);
+#endif
+
+  RISCV_BENCH("riscv_conv_q31", "q31", CONV_LEN_A, riscv_conv_q31(convA_q31, CONV_LEN_A, convB_q31, CONV_LEN_B, convRef_q31));
+  BENCH_SCALE("riscv_conv_par_q31", "q31", CONV_LEN_A,
+    riscv_conv_par_q31(&P, convA_q31, CONV_LEN_A, convB_q31, CONV_LEN_B, convDst_q31));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_conv_par_q31", convDst_q31, convRef_q31, CONV_LEN_A + CONV_LEN_B - 1);
+#endif
+
+  RISCV_BENCH("riscv_conv_q15", "q15", CONV_LEN_A, riscv_conv_q15(convA_q15, CONV_LEN_A, convB_q15, CONV_LEN_B, convRef_q15));
+  BENCH_SCALE("riscv_conv_par_q15", "q15", CONV_LEN_A,
+    riscv_conv_par_q15(&P, convA_q15, CONV_LEN_A, convB_q15, CONV_LEN_B, convDst_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_CMP("riscv_conv_par_q15", convDst_q15, convRef_q15, CONV_LEN_A + CONV_LEN_B - 1);
+#endif
+
+/*Complex FFT*/
+  riscv_cfft_par_init_f32(&cfft_f32, CFFT_LEN, &riscv_cfft_sR_f32_len64, cfftTwiddle_f32, cfftScratch_f32);
+
+  RISCV_BENCH("riscv_cfft_f32", "f32", CFFT_LEN,
+    memcpy(cfftRef_f32, cfftSrc_f32, sizeof(cfftSrc_f32)); riscv_cfft_f32(&riscv_cfft_sR_f32_len512, cfftRef_f32, 0, 1));
+  BENCH_SCALE("riscv_cfft_par_f32", "f32", CFFT_LEN,
+    memcpy(cfftBuf_f32, cfftSrc_f32, sizeof(cfftSrc_f32)); riscv_cfft_par_f32(&P, &cfft_f32, cfftBuf_f32, 0));
+#ifdef PRINT_OUTPUT
+  r = 0.0f;
+  for (i = 0; i < 2 * CFFT_LEN; i++)
+  {
+    r = (fabsf(cfftBuf_f32[i] - cfftRef_f32[i]) > r) ? fabsf(cfftBuf_f32[i] - cfftRef_f32[i]) : r;
+  }
+  printf("riscv_cfft_par_f32: max difference %d e-6\n", (int)(r * 1000000.0f));
+#endif
+
+  printf("End\n");
+
+  return 0;
+}
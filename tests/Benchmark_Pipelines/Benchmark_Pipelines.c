@@ -0,0 +1,356 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+/* Keyword spotting front end: 1.024 MHz PDM -> CIC /32 -> FIR /2 -> 256-point spectrum every 128 samples -> mel bands */
+#define PDM_BYTES 1024
+#define CIC_STAGES 4
+#define CIC_R 32
+#define CIC_OUT (8 * PDM_BYTES / CIC_R)
+#define DEC_TAPS 32
+#define HOP (CIC_OUT / 2)
+#define FFT_LEN 256
+#define NUM_MELS 20
+#define KWS_PERIOD_US 8000u
+/* Field-oriented current loop at a 20 kHz PWM rate, FOC_STEPS periods */
+#define FOC_STEPS 32
+#define FOC_PERIOD_US 50u
+/* 8-channel 5-band equalizer, 1 ms blocks at 48 kHz */
+#define EQ_CHANNELS 8
+#define EQ_BANDS 5
+#define EQ_BLOCK 48
+#define EQ_PERIOD_US 1000u
+/* Clock of the cycle budgets */
+#ifndef RISCV_PIPE_CLOCK_HZ
+#define RISCV_PIPE_CLOCK_HZ 50000000u
+#endif
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*Three pipelines are run stage by stage and end to end on buffers they share, so the totals include the
+data hand-off and memory conflicts that the kernel benchmarks do not see.  Each stage and each total is
+compared with a budget, a share of the real-time period of one block: cycles at RISCV_PIPE_CLOCK_HZ on
+PULPino, nanoseconds on a host.  The BUDGET lines give the share of the budget each measurement takes.
+*The keyword spotting front end decimates a 1 kHz tone in a 1.024 MHz PDM bitstream to 16 kHz, which
+must come out in the mel band of 1 kHz.  The FOC current loop runs the separate clarke, park, PID and
+inverse functions, which must agree with riscv_foc_step_q31() bit for bit.  The equalizer filters eight
+channels of the same input, which must come out equal.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "Pipelines"
+#include "../common/riscv_bench.h"
+
+/* Share pct of the period of a pipeline, in the unit of the first event */
+#if defined (RISCV_BENCH_HOST)
+#define BUDGET(periodUs, pct) ((periodUs) * 10u * (pct))
+#else
+#define BUDGET(periodUs, pct) ((periodUs) * (RISCV_PIPE_CLOCK_HZ / 1000000u) / 100u * (pct))
+#endif
+
+/* Keyword spotting front end */
+uint8_t pdm[PDM_BYTES];
+uint16_t cicLut[256 * CIC_STAGES];
+q31_t cicState[CIC_STAGES * 3 - 1];
+q15_t pcm32k[CIC_OUT] __attribute__((aligned(4)));
+q15_t decCoeffs[DEC_TAPS] __attribute__((aligned(4)));
+q15_t decState[DEC_TAPS + CIC_OUT - 1] __attribute__((aligned(4)));
+q15_t frame[FFT_LEN] __attribute__((aligned(4)));
+q15_t window[FFT_LEN] __attribute__((aligned(4)));
+q15_t windowed[FFT_LEN] __attribute__((aligned(4)));
+q15_t spectrum[2 * FFT_LEN] __attribute__((aligned(4)));
+uint16_t melEdges[NUM_MELS + 1];
+q63_t mel[NUM_MELS];
+riscv_cic_decimate_pdm_instance_q15 S_cic;
+riscv_fir_decimate_instance_q15 S_dec;
+riscv_rfft_instance_q15 S_rfft;
+
+/* FOC current loop */
+q31_t Ia[FOC_STEPS], Ib[FOC_STEPS], theta[FOC_STEPS];
+q31_t sinV[FOC_STEPS], cosV[FOC_STEPS], Id[FOC_STEPS], Iq[FOC_STEPS], Vd[FOC_STEPS], Vq[FOC_STEPS];
+q31_t Va[FOC_STEPS], Vb[FOC_STEPS], fusedVa[FOC_STEPS], fusedVb[FOC_STEPS];
+riscv_pid_instance_q31 pidD, pidQ;
+riscv_foc_instance_q31 S_foc;
+
+/* Equalizer */
+q15_t eqIn[EQ_CHANNELS * EQ_BLOCK] __attribute__((aligned(4)));
+q15_t eqOut[EQ_CHANNELS * EQ_BLOCK] __attribute__((aligned(4)));
+q31_t eqBuf[EQ_CHANNELS * EQ_BLOCK];
+q31_t eqCoeffs[5 * EQ_BANDS];
+q63_t eqState[2 * EQ_BANDS * EQ_CHANNELS];
+riscv_biquad_cascade_multichan_df2T_instance_q31 S_eq;
+
+static void kws_cic(void)
+{
+  riscv_cic_decimate_pdm_q15(&S_cic, pdm, pcm32k, PDM_BYTES);
+}
+
+/* The newest hop is decimated straight into the second half of the frame */
+static void kws_decimate(void)
+{
+  riscv_copy_q15(frame + HOP, frame, FFT_LEN - HOP);
+  riscv_fir_decimate_q15(&S_dec, pcm32k, frame + FFT_LEN - HOP, CIC_OUT);
+}
+
+static void kws_spectrum(void)
+{
+  riscv_mult_q15(frame, window, windowed, FFT_LEN);
+  riscv_rfft_q15(&S_rfft, windowed, spectrum);
+}
+
+static void kws_mel(void)
+{
+  riscv_band_energy_q15(spectrum, FFT_LEN, melEdges, NUM_MELS, mel);
+}
+
+static void foc_sin_cos(void)
+{
+  uint32_t n;
+
+  for (n = 0; n < FOC_STEPS; n++)
+    riscv_sin_cos_q31(theta[n], &sinV[n], &cosV[n]);
+}
+
+static void foc_clarke_park(void)
+{
+  q31_t alpha, beta;
+  uint32_t n;
+
+  for (n = 0; n < FOC_STEPS; n++)
+  {
+    riscv_clarke_q31(Ia[n], Ib[n], &alpha, &beta);
+    riscv_park_q31(alpha, beta, &Id[n], &Iq[n], sinV[n], cosV[n]);
+  }
+}
+
+static void foc_pid(void)
+{
+  uint32_t n;
+
+  for (n = 0; n < FOC_STEPS; n++)
+  {
+    Vd[n] = riscv_pid_q31(&pidD, clip_q63_to_q31(0 - (q63_t) Id[n]));
+    Vq[n] = riscv_pid_q31(&pidQ, clip_q63_to_q31(0x10000000 - (q63_t) Iq[n]));
+  }
+}
+
+static void foc_inverse(void)
+{
+  q31_t alpha, beta;
+  uint32_t n;
+
+  for (n = 0; n < FOC_STEPS; n++)
+  {
+    riscv_inv_park_q31(Vd[n], Vq[n], &alpha, &beta, sinV[n], cosV[n]);
+    riscv_inv_clarke_q31(alpha, beta, &Va[n], &Vb[n]);
+  }
+}
+
+static void foc_fused(void)
+{
+  uint32_t n;
+
+  for (n = 0; n < FOC_STEPS; n++)
+    riscv_foc_step_q31(&S_foc, Ia[n], Ib[n], theta[n], 0, 0x10000000, &fusedVa[n], &fusedVb[n]);
+}
+
+static void eq_input(void)
+{
+  riscv_q15_to_q31(eqIn, eqBuf, EQ_CHANNELS * EQ_BLOCK);
+}
+
+static void eq_filter(void)
+{
+  riscv_biquad_cascade_multichan_df2T_q31(&S_eq, eqBuf, eqBuf, EQ_BLOCK);
+}
+
+static void eq_output(void)
+{
+  /* Master gain of -6 dB on the way out */
+  riscv_scale_q31(eqBuf, 0x40000000, 0, eqBuf, EQ_CHANNELS * EQ_BLOCK);
+  riscv_q31_to_q15(eqBuf, eqOut, EQ_CHANNELS * EQ_BLOCK);
+}
+
+/* Peaking filter of f0 Hz, gain g dB and quality q at 48 kHz, halved for a postShift of 1 */
+static void eq_peak(q31_t * pCoeffs, float32_t f0, float32_t g, float32_t q)
+{
+  float32_t A = powf(10.0f, g / 40.0f), w = 2.0f * 3.14159265f * f0 / 48000.0f;
+  float32_t alpha = sinf(w) / (2.0f * q), a0 = 1.0f + alpha / A;
+  float32_t c[5];
+  uint32_t k;
+
+  c[0] = (1.0f + alpha * A) / a0;
+  c[1] = -2.0f * cosf(w) / a0;
+  c[2] = (1.0f - alpha * A) / a0;
+  c[3] = 2.0f * cosf(w) / a0;
+  c[4] = -(1.0f - alpha / A) / a0;
+  for (k = 0; k < 5; k++)
+    pCoeffs[k] = (q31_t) (c[k] * 0.5f * 2147483648.0f);
+}
+
+int main(void)
+{
+  uint32_t n, c, k, best;
+  int32_t fail = 0, ok;
+  float32_t acc = 0.0f, x, y = 0.0f, m;
+  static const float32_t eqFreq[EQ_BANDS] = { 80.0f, 300.0f, 1000.0f, 3500.0f, 10000.0f };
+  static const float32_t eqGain[EQ_BANDS] = { 4.0f, -3.0f, 2.0f, -2.0f, 3.0f };
+
+  riscv_bench_header();
+  riscv_bench_budget_header();
+
+  /* First order sigma-delta of a 1 kHz tone, which repeats every 128 bytes */
+  for (n = 0; n < 8 * PDM_BYTES; n++)
+  {
+    x = 0.5f * sinf(2.0f * 3.14159265f * 1000.0f * (float32_t) n / 1024000.0f);
+    acc += x - y;
+    y = (acc >= 0.0f) ? 1.0f : -1.0f;
+    if(y > 0.0f)
+      pdm[n >> 3] |= (uint8_t) (0x80u >> (n & 7u));
+  }
+  /* Half-band style lowpass to 7 kHz at 32 kHz, Hann window, 20 mel bands from 1 to 128 */
+  for (k = 0; k < DEC_TAPS; k++)
+  {
+    x = (float32_t) k - (DEC_TAPS - 1) / 2.0f;
+    m = 0.5f - 0.5f * cosf(2.0f * 3.14159265f * (float32_t) k / (DEC_TAPS - 1));
+    decCoeffs[k] = (q15_t) (32767.0f * m * 0.4375f * ((x == 0.0f) ? 1.0f : sinf(3.14159265f * 0.4375f * x) / (3.14159265f * 0.4375f * x)));
+  }
+  for (n = 0; n < FFT_LEN; n++)
+    window[n] = (q15_t) (32767.0f * (0.5f - 0.5f * cosf(2.0f * 3.14159265f * (float32_t) n / FFT_LEN)));
+  m = 2595.0f * log10f(1.0f + 8000.0f / 700.0f);
+  for (k = 0; k <= NUM_MELS; k++)
+  {
+    x = 700.0f * (powf(10.0f, m * (float32_t) k / NUM_MELS / 2595.0f) - 1.0f);
+    melEdges[k] = (uint16_t) (1.0f + x * (FFT_LEN / 2 - 1) / 8000.0f + 0.5f);
+    if((k > 0) && (melEdges[k] <= melEdges[k - 1]))
+      melEdges[k] = melEdges[k - 1] + 1u;
+  }
+  melEdges[NUM_MELS] = FFT_LEN / 2 + 1;
+
+  ok = (riscv_cic_decimate_pdm_init_q15(&S_cic, CIC_STAGES, 1, CIC_R, cicLut, cicState) == RISCV_MATH_SUCCESS);
+  ok &= (riscv_fir_decimate_init_q15(&S_dec, DEC_TAPS, 2, decCoeffs, decState, CIC_OUT) == RISCV_MATH_SUCCESS);
+  ok &= (riscv_rfft_init_q15(&S_rfft, FFT_LEN, 0, 1) == RISCV_MATH_SUCCESS);
+
+  /* Electrical angle over FOC_STEPS periods of a 400 Hz rotor field, balanced currents of 0.3 */
+  for (n = 0; n < FOC_STEPS; n++)
+  {
+    x = 2.0f * 3.14159265f * 400.0f * (float32_t) n * FOC_PERIOD_US * 1e-6f;
+    theta[n] = (q31_t) ((fmodf(x / 3.14159265f + 1.0f, 2.0f) - 1.0f) * 2147483647.0f);
+    Ia[n] = (q31_t) (0.3f * cosf(x + 0.2f) * 2147483648.0f);
+    Ib[n] = (q31_t) (0.3f * cosf(x + 0.2f - 2.0943951f) * 2147483648.0f);
+  }
+  pidD.Kp = pidQ.Kp = S_foc.pidD.Kp = S_foc.pidQ.Kp = 0x20000000;
+  pidD.Ki = pidQ.Ki = S_foc.pidD.Ki = S_foc.pidQ.Ki = 0x02000000;
+  pidD.Kd = pidQ.Kd = S_foc.pidD.Kd = S_foc.pidQ.Kd = 0;
+  riscv_pid_init_q31(&pidD, 1);
+  riscv_pid_init_q31(&pidQ, 1);
+  riscv_pid_init_q31(&S_foc.pidD, 1);
+  riscv_pid_init_q31(&S_foc.pidQ, 1);
+
+  for (k = 0; k < EQ_BANDS; k++)
+    eq_peak(&eqCoeffs[5 * k], eqFreq[k], eqGain[k], 1.0f);
+  ok &= (riscv_biquad_cascade_multichan_df2T_init_q31(&S_eq, EQ_BANDS, EQ_CHANNELS, eqCoeffs, eqState, 1) == RISCV_MATH_SUCCESS);
+  for (n = 0; n < EQ_BLOCK; n++)
+  {
+    x = 0.3f * sinf(2.0f * 3.14159265f * 1000.0f * (float32_t) n / 48000.0f) + 0.1f * sinf(2.0f * 3.14159265f * 90.0f * (float32_t) n / 48000.0f);
+    for (c = 0; c < EQ_CHANNELS; c++)
+      eqIn[n * EQ_CHANNELS + c] = (q15_t) (x * 32767.0f);
+  }
+  printf("CHECK init %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Stage shares of the period; the rest is left to the application */
+  RISCV_BENCH("kws/cic_pdm", "q15", PDM_BYTES, kws_cic());
+  ok = riscv_bench_budget("kws/cic_pdm", BUDGET(KWS_PERIOD_US, 25u));
+  RISCV_BENCH("kws/fir_decimate", "q15", CIC_OUT, kws_decimate());
+  ok &= riscv_bench_budget("kws/fir_decimate", BUDGET(KWS_PERIOD_US, 15u));
+  RISCV_BENCH("kws/spectrum", "q15", FFT_LEN, kws_spectrum());
+  ok &= riscv_bench_budget("kws/spectrum", BUDGET(KWS_PERIOD_US, 25u));
+  RISCV_BENCH("kws/mel", "q15", NUM_MELS, kws_mel());
+  ok &= riscv_bench_budget("kws/mel", BUDGET(KWS_PERIOD_US, 5u));
+  RISCV_BENCH("kws/total", "q15", HOP, kws_cic(); kws_decimate(); kws_spectrum(); kws_mel());
+  ok &= riscv_bench_budget("kws/total", BUDGET(KWS_PERIOD_US, 70u));
+
+  RISCV_BENCH("foc/sin_cos", "q31", FOC_STEPS, foc_sin_cos());
+  ok &= riscv_bench_budget("foc/sin_cos", BUDGET(FOC_STEPS * FOC_PERIOD_US, 5u));
+  RISCV_BENCH("foc/clarke_park", "q31", FOC_STEPS, foc_clarke_park());
+  ok &= riscv_bench_budget("foc/clarke_park", BUDGET(FOC_STEPS * FOC_PERIOD_US, 4u));
+  RISCV_BENCH("foc/pid", "q31", FOC_STEPS, foc_pid());
+  ok &= riscv_bench_budget("foc/pid", BUDGET(FOC_STEPS * FOC_PERIOD_US, 4u));
+  RISCV_BENCH("foc/inverse", "q31", FOC_STEPS, foc_inverse());
+  ok &= riscv_bench_budget("foc/inverse", BUDGET(FOC_STEPS * FOC_PERIOD_US, 4u));
+  RISCV_BENCH("foc/total", "q31", FOC_STEPS, foc_sin_cos(); foc_clarke_park(); foc_pid(); foc_inverse());
+  ok &= riscv_bench_budget("foc/total", BUDGET(FOC_STEPS * FOC_PERIOD_US, 20u));
+  RISCV_BENCH("foc/riscv_foc_step_q31", "q31", FOC_STEPS, foc_fused());
+  ok &= riscv_bench_budget("foc/riscv_foc_step_q31", BUDGET(FOC_STEPS * FOC_PERIOD_US, 15u));
+
+  RISCV_BENCH("eq/q15_to_q31", "q31", EQ_CHANNELS * EQ_BLOCK, eq_input());
+  ok &= riscv_bench_budget("eq/q15_to_q31", BUDGET(EQ_PERIOD_US, 5u));
+  RISCV_BENCH("eq/biquad_multichan", "q31", EQ_CHANNELS * EQ_BLOCK, eq_filter());
+  ok &= riscv_bench_budget("eq/biquad_multichan", BUDGET(EQ_PERIOD_US, 50u));
+  RISCV_BENCH("eq/gain_q31_to_q15", "q31", EQ_CHANNELS * EQ_BLOCK, eq_output());
+  ok &= riscv_bench_budget("eq/gain_q31_to_q15", BUDGET(EQ_PERIOD_US, 10u));
+  RISCV_BENCH("eq/total", "q31", EQ_CHANNELS * EQ_BLOCK, eq_input(); eq_filter(); eq_output());
+  ok &= riscv_bench_budget("eq/total", BUDGET(EQ_PERIOD_US, 65u));
+  printf("CHECK budgets %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* The tone lands in the mel band of 1 kHz, bin 16 */
+  for (k = 0; k < 4; k++)
+  {
+    kws_cic();
+    kws_decimate();
+    kws_spectrum();
+    kws_mel();
+  }
+  best = 0;
+  for (k = 1; k < NUM_MELS; k++)
+    best = (mel[k] > mel[best]) ? k : best;
+#if defined(PRINT_OUTPUT)
+  printf("loudest mel band %d, bins %d to %d\n", (int) best, melEdges[best], melEdges[best + 1]);
+#endif
+  ok = (melEdges[best] <= 16u) && (16u < melEdges[best + 1]) && (mel[best] > 0);
+  printf("CHECK kws tone band %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  riscv_pid_reset_q31(&pidD);
+  riscv_pid_reset_q31(&pidQ);
+  riscv_pid_reset_q31(&S_foc.pidD);
+  riscv_pid_reset_q31(&S_foc.pidQ);
+  foc_sin_cos();
+  foc_clarke_park();
+  foc_pid();
+  foc_inverse();
+  foc_fused();
+  ok = 1;
+  for (n = 0; n < FOC_STEPS; n++)
+    ok &= (Va[n] == fusedVa[n]) && (Vb[n] == fusedVb[n]);
+  printf("CHECK foc chain equals riscv_foc_step_q31 %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  memset(eqState, 0, sizeof(eqState));
+  eq_input();
+  eq_filter();
+  eq_output();
+  ok = 1;
+  best = 0;
+  for (n = 0; n < EQ_BLOCK; n++)
+  {
+    best |= (eqOut[n * EQ_CHANNELS] != 0);
+    for (c = 1; c < EQ_CHANNELS; c++)
+      ok &= (eqOut[n * EQ_CHANNELS + c] == eqOut[n * EQ_CHANNELS]);
+  }
+  ok &= (best != 0u);
+  printf("CHECK eq channels %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
@@ -0,0 +1,223 @@
+#include <stdio.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+/*
+*Effect of the RISCV_DSP_FAST_PLACEMENT groups (riscv_math.h, RISCV_DSP_FASTDATA / RISCV_DSP_FASTCODE):
+*The PLACEMENT line tells which groups the library was built with and the BENCH lines of type f32, q31 and
+q15 measure the kernels of those groups with the tables and code where the library put them. Compare the
+logs of builds with different RISCV_DSP_FAST_PLACEMENT to see the effect of each group.
+*Within one run the lines of type <type>-twiddle-fast and <type>-bitrev-fast repeat the FFTs with a copy of
+the twiddle or bit reversal table in RISCV_DSP_FASTDATA_SECTION, against the library tables of the plain
+lines, which shows the effect of the data placement without rebuilding the library.
+*The linker script must map RISCV_DSP_FASTDATA_SECTION.* and RISCV_DSP_FASTCODE_SECTION.* to the fast memory.
+*/
+#define RISCV_BENCH_SUITE "Placement"
+#include "../common/riscv_bench.h"
+
+#define FFT_LEN     1024
+#define BLOCK_SIZE  256
+#define NUM_TAPS    32
+#define NUM_STAGES  4
+#define MAT_DIM     16
+
+#if defined (RISCV_DSP_FAST_TWIDDLE)
+#define PLACED_TWIDDLE "fast"
+#else
+#define PLACED_TWIDDLE "default"
+#endif
+#if defined (RISCV_DSP_FAST_BITREV)
+#define PLACED_BITREV "fast"
+#else
+#define PLACED_BITREV "default"
+#endif
+#if defined (RISCV_DSP_FAST_SINE)
+#define PLACED_SINE "fast"
+#else
+#define PLACED_SINE "default"
+#endif
+#if defined (RISCV_DSP_FAST_KERNELS)
+#define PLACED_KERNELS "fast"
+#else
+#define PLACED_KERNELS "default"
+#endif
+
+/*Twiddle table lengths of the FFT_LEN instances, quarter-wave tables with RISCV_MATH_COMPACT_TWIDDLE*/
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+#define TWIDDLE_LEN_F32  ((FFT_LEN / 4) + 1)
+#define TWIDDLE_LEN_Q15  ((FFT_LEN / 4) + 1)
+#else
+#define TWIDDLE_LEN_F32  (2 * FFT_LEN)
+#define TWIDDLE_LEN_Q15  ((3 * FFT_LEN) / 2)
+#endif
+#define TWIDDLE_LEN_Q31  ((3 * FFT_LEN) / 2)
+#define BITREV_LEN_MAX   RISCVBITREVINDEXTABLE1024_TABLE_LENGTH
+
+float32_t fft_f32[2 * FFT_LEN];
+q31_t fft_q31[2 * FFT_LEN];
+q15_t fft_q15[2 * FFT_LEN];
+
+/*Copies of the FFT tables in the fast data section*/
+float32_t fastTwiddle_f32[TWIDDLE_LEN_F32] RISCV_DSP_SECTION(RISCV_DSP_FASTDATA_SECTION, fastTwiddle_f32);
+q31_t fastTwiddle_q31[TWIDDLE_LEN_Q31] RISCV_DSP_SECTION(RISCV_DSP_FASTDATA_SECTION, fastTwiddle_q31);
+q15_t fastTwiddle_q15[TWIDDLE_LEN_Q15] RISCV_DSP_SECTION(RISCV_DSP_FASTDATA_SECTION, fastTwiddle_q15);
+uint16_t fastBitRev_f32[BITREV_LEN_MAX] RISCV_DSP_SECTION(RISCV_DSP_FASTDATA_SECTION, fastBitRev_f32);
+uint16_t fastBitRev_fixed[BITREV_LEN_MAX] RISCV_DSP_SECTION(RISCV_DSP_FASTDATA_SECTION, fastBitRev_fixed);
+
+riscv_cfft_instance_f32 Stw_f32, Sbr_f32;
+riscv_cfft_instance_q31 Stw_q31, Sbr_q31;
+riscv_cfft_instance_q15 Stw_q15, Sbr_q15;
+
+float32_t src_f32[BLOCK_SIZE];
+q31_t src_q31[BLOCK_SIZE];
+q15_t src_q15[BLOCK_SIZE];
+float32_t dst_f32[BLOCK_SIZE];
+q31_t dst_q31[BLOCK_SIZE];
+q15_t dst_q15[BLOCK_SIZE];
+float32_t coeffs_f32[NUM_TAPS];
+q31_t coeffs_q31[NUM_TAPS];
+q15_t coeffs_q15[NUM_TAPS];
+float32_t state_f32[NUM_TAPS + BLOCK_SIZE];
+q31_t state_q31[NUM_TAPS + BLOCK_SIZE];
+q15_t state_q15[NUM_TAPS + BLOCK_SIZE];
+float32_t sos_f32[5 * NUM_STAGES];
+q15_t sos_q15[6 * NUM_STAGES];
+float32_t sosState_f32[2 * NUM_STAGES];
+q15_t sosState_q15[4 * NUM_STAGES];
+float32_t matA_f32[MAT_DIM * MAT_DIM];
+float32_t matB_f32[MAT_DIM * MAT_DIM];
+float32_t matC_f32[MAT_DIM * MAT_DIM];
+float32_t sum_f32;
+q63_t sum_q63;
+q31_t sum_q31;
+q15_t sum_q15;
+
+riscv_fir_instance_f32 Sfir_f32;
+riscv_fir_instance_q31 Sfir_q31;
+riscv_fir_instance_q15 Sfir_q15;
+riscv_biquad_cascade_df2T_instance_f32 Sdf2T_f32;
+riscv_biquad_casd_df1_inst_q15 Sdf1_q15;
+riscv_matrix_instance_f32 MatA, MatB, MatC;
+
+static void fill_inputs(void)
+{
+  uint32_t i, r = 1u;
+
+  for (i = 0u; i < (2u * FFT_LEN); i++)
+  {
+    r = (r * 1103515245u) + 12345u;
+    fft_q31[i] = (q31_t) (r & 0xFFFF0000u) >> 4;
+    fft_q15[i] = (q15_t) (fft_q31[i] >> 16);
+    fft_f32[i] = (float32_t) fft_q15[i] / 32768.0f;
+    if(i < BLOCK_SIZE)
+    {
+      src_q31[i] = fft_q31[i];
+      src_q15[i] = fft_q15[i];
+      src_f32[i] = fft_f32[i];
+    }
+    if(i < (MAT_DIM * MAT_DIM))
+    {
+      matA_f32[i] = fft_f32[i];
+      matB_f32[i] = fft_f32[i + (MAT_DIM * MAT_DIM)];
+    }
+  }
+
+  /*Small coefficients keep the filters away from saturation*/
+  for (i = 0u; i < NUM_TAPS; i++)
+  {
+    coeffs_q31[i] = (q31_t) ((i * 0x00212345u) & 0x01FFFFFFu) - 0x01000000;
+    coeffs_q15[i] = (q15_t) (coeffs_q31[i] >> 16);
+    coeffs_f32[i] = (float32_t) coeffs_q15[i] / 32768.0f;
+  }
+  for (i = 0u; i < (6u * NUM_STAGES); i++)
+  {
+    sos_q15[i] = coeffs_q15[i % NUM_TAPS];
+    if(i < (5u * NUM_STAGES))
+    {
+      sos_f32[i] = coeffs_f32[i % NUM_TAPS];
+    }
+  }
+}
+
+/*Instances equal to the library ones except for one table, read from its copy in the fast data section*/
+static void copy_tables(void)
+{
+  Stw_f32 = riscv_cfft_sR_f32_len1024;
+  Sbr_f32 = riscv_cfft_sR_f32_len1024;
+  memcpy(fastTwiddle_f32, Stw_f32.pTwiddle, sizeof(fastTwiddle_f32));
+  memcpy(fastBitRev_f32, Sbr_f32.pBitRevTable, Sbr_f32.bitRevLength * sizeof(uint16_t));
+  Stw_f32.pTwiddle = fastTwiddle_f32;
+  Sbr_f32.pBitRevTable = fastBitRev_f32;
+
+  Stw_q31 = riscv_cfft_sR_q31_len1024;
+  Sbr_q31 = riscv_cfft_sR_q31_len1024;
+  memcpy(fastTwiddle_q31, Stw_q31.pTwiddle, sizeof(fastTwiddle_q31));
+  memcpy(fastBitRev_fixed, Sbr_q31.pBitRevTable, Sbr_q31.bitRevLength * sizeof(uint16_t));
+  Stw_q31.pTwiddle = fastTwiddle_q31;
+  Sbr_q31.pBitRevTable = fastBitRev_fixed;
+
+  /*The Q15 instance uses the same fixed-point bit reversal table as the Q31 one*/
+  Stw_q15 = riscv_cfft_sR_q15_len1024;
+  Sbr_q15 = riscv_cfft_sR_q15_len1024;
+  memcpy(fastTwiddle_q15, Stw_q15.pTwiddle, sizeof(fastTwiddle_q15));
+  Stw_q15.pTwiddle = fastTwiddle_q15;
+  Sbr_q15.pBitRevTable = fastBitRev_fixed;
+}
+
+int32_t main(void)
+{
+  uint32_t i;
+
+  fill_inputs();
+  copy_tables();
+
+  printf("#PLACEMENT,twiddle,bitrev,sine,kernels\n");
+  printf("PLACEMENT,%s,%s,%s,%s\n", PLACED_TWIDDLE, PLACED_BITREV, PLACED_SINE, PLACED_KERNELS);
+  riscv_bench_header();
+
+  /*TWIDDLE and BITREV tables, and the FFT butterflies of KERNELS*/
+  RISCV_BENCH("riscv_cfft_f32", "f32", FFT_LEN, riscv_cfft_f32(&riscv_cfft_sR_f32_len1024, fft_f32, 0, 1));
+  RISCV_BENCH("riscv_cfft_f32", "f32-twiddle-fast", FFT_LEN, riscv_cfft_f32(&Stw_f32, fft_f32, 0, 1));
+  RISCV_BENCH("riscv_cfft_f32", "f32-bitrev-fast", FFT_LEN, riscv_cfft_f32(&Sbr_f32, fft_f32, 0, 1));
+  RISCV_BENCH("riscv_cfft_q31", "q31", FFT_LEN, riscv_cfft_q31(&riscv_cfft_sR_q31_len1024, fft_q31, 0, 1));
+  RISCV_BENCH("riscv_cfft_q31", "q31-twiddle-fast", FFT_LEN, riscv_cfft_q31(&Stw_q31, fft_q31, 0, 1));
+  RISCV_BENCH("riscv_cfft_q31", "q31-bitrev-fast", FFT_LEN, riscv_cfft_q31(&Sbr_q31, fft_q31, 0, 1));
+  RISCV_BENCH("riscv_cfft_q15", "q15", FFT_LEN, riscv_cfft_q15(&riscv_cfft_sR_q15_len1024, fft_q15, 0, 1));
+  RISCV_BENCH("riscv_cfft_q15", "q15-twiddle-fast", FFT_LEN, riscv_cfft_q15(&Stw_q15, fft_q15, 0, 1));
+  RISCV_BENCH("riscv_cfft_q15", "q15-bitrev-fast", FFT_LEN, riscv_cfft_q15(&Sbr_q15, fft_q15, 0, 1));
+
+  /*SINE tables*/
+  RISCV_BENCH("riscv_sin_f32", "f32", BLOCK_SIZE,
+              for (i = 0u; i < BLOCK_SIZE; i++) { sum_f32 += riscv_sin_f32(src_f32[i] * 3.0f); });
+  RISCV_BENCH("riscv_sin_q31", "q31", BLOCK_SIZE,
+              for (i = 0u; i < BLOCK_SIZE; i++) { sum_q31 += riscv_sin_q31(src_q31[i] & 0x7FFFFFFF); });
+  RISCV_BENCH("riscv_sin_q15", "q15", BLOCK_SIZE,
+              for (i = 0u; i < BLOCK_SIZE; i++) { sum_q15 += riscv_sin_q15(src_q15[i] & 0x7FFF); });
+
+  /*KERNELS*/
+  riscv_fir_init_f32(&Sfir_f32, NUM_TAPS, coeffs_f32, state_f32, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_f32", "f32", BLOCK_SIZE, riscv_fir_f32(&Sfir_f32, src_f32, dst_f32, BLOCK_SIZE));
+  riscv_fir_init_q31(&Sfir_q31, NUM_TAPS, coeffs_q31, state_q31, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_q31", "q31", BLOCK_SIZE, riscv_fir_q31(&Sfir_q31, src_q31, dst_q31, BLOCK_SIZE));
+  riscv_fir_init_q15(&Sfir_q15, NUM_TAPS, coeffs_q15, state_q15, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_q15", "q15", BLOCK_SIZE, riscv_fir_q15(&Sfir_q15, src_q15, dst_q15, BLOCK_SIZE));
+  riscv_biquad_cascade_df2T_init_f32(&Sdf2T_f32, NUM_STAGES, sos_f32, sosState_f32);
+  RISCV_BENCH("riscv_biquad_cascade_df2T_f32", "f32", BLOCK_SIZE,
+              riscv_biquad_cascade_df2T_f32(&Sdf2T_f32, src_f32, dst_f32, BLOCK_SIZE));
+  riscv_biquad_cascade_df1_init_q15(&Sdf1_q15, NUM_STAGES, sos_q15, sosState_q15, 1);
+  RISCV_BENCH("riscv_biquad_cascade_df1_q15", "q15", BLOCK_SIZE,
+              riscv_biquad_cascade_df1_q15(&Sdf1_q15, src_q15, dst_q15, BLOCK_SIZE));
+  RISCV_BENCH("riscv_dot_prod_f32", "f32", BLOCK_SIZE, riscv_dot_prod_f32(src_f32, dst_f32, BLOCK_SIZE, &sum_f32));
+  RISCV_BENCH("riscv_dot_prod_q15", "q15", BLOCK_SIZE, riscv_dot_prod_q15(src_q15, dst_q15, BLOCK_SIZE, &sum_q63));
+  riscv_mat_init_f32(&MatA, MAT_DIM, MAT_DIM, matA_f32);
+  riscv_mat_init_f32(&MatB, MAT_DIM, MAT_DIM, matB_f32);
+  riscv_mat_init_f32(&MatC, MAT_DIM, MAT_DIM, matC_f32);
+  RISCV_BENCH("riscv_mat_mult_f32", "f32", MAT_DIM, riscv_mat_mult_f32(&MatA, &MatB, &MatC));
+
+  return 0;
+}
@@ -6,37 +6,19 @@
 #include "bar.h"
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 
 //#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
 #define MAX_BLOCKSIZE     32
 #define NUM_SAMPLES  16  /*size of array 32. num of elements are 16 as each 2 elements represnt a complex number */
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-
-
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
 *Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "StatisticsFunctions"
+#include "../common/riscv_bench.h"
  float32_t src_buf_f32[MAX_BLOCKSIZE] =
 {
   -0.4325648115282207,  -1.6655843782380970,  0.1253323064748307,
@@ -121,140 +103,115 @@ q15_t result_q15;
 q31_t result_q31;
 q63_t result_q63;
 uint32_t result_index = 0 ;
+riscv_stats_result_f32 stats_f32;
+riscv_stats_result_q15 stats_q15;
+riscv_stats_result_q31 stats_q31;
+riscv_running_stats_instance_f32 running_f32;
+riscv_running_stats_instance_q31 running_q31;
+#define HIST_BINS     8
+#define MEDIAN_WINDOW 5
+float32_t hist_edges_f32[HIST_BINS+1] = {-2.0, -1.5, -1.0, -0.5, 0.0, 0.5, 1.0, 1.5, 2.0};
+uint32_t hist_count[HIST_BINS];
+float32_t scratch_f32[MAX_BLOCKSIZE];
+q15_t scratch_q15[MAX_BLOCKSIZE];
+float32_t filtered_f32[MAX_BLOCKSIZE];
+q15_t filtered_q15[MAX_BLOCKSIZE];
+float32_t median_state_f32[MEDIAN_WINDOW];
+q15_t median_state_q15[MEDIAN_WINDOW];
+uint16_t median_heap[MEDIAN_WINDOW];
+uint16_t median_pos[MEDIAN_WINDOW];
+riscv_median_filter_instance_f32 median_f32;
+riscv_median_filter_instance_q15 median_q15;
 
 int32_t main(void)
 {
+  riscv_bench_header();
  /*Init*/ 
 /*Tests*/
 
 /*Max*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_max_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32, &result_index);
-  perf_stop();
-  printf("riscv_max_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_max_f32", "f32", MAX_BLOCKSIZE,
+    riscv_max_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32, &result_index));
 #ifdef PRINT_OUTPUT
   printf("value = %d index = %d\n",(int)(result_f32*100),result_index);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_max_q7(src_buf_q7, MAX_BLOCKSIZE, &result_q7, &result_index);
-  perf_stop();
-  printf("riscv_max_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_max_q7", "q7", MAX_BLOCKSIZE,
+    riscv_max_q7(src_buf_q7, MAX_BLOCKSIZE, &result_q7, &result_index));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X index = %d\n",result_q7,result_index);
 #endif  
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_max_q15(src_buf_q15, MAX_BLOCKSIZE, &result_q15, &result_index);
-  perf_stop();
-  printf("riscv_max_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_max_q15", "q15", MAX_BLOCKSIZE,
+    riscv_max_q15(src_buf_q15, MAX_BLOCKSIZE, &result_q15, &result_index));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X index = %d\n",result_q15,result_index);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_max_q31(src_buf_q31, MAX_BLOCKSIZE, &result_q31, &result_index);
-  perf_stop();
-  printf("riscv_max_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_max_q31", "q31", MAX_BLOCKSIZE,
+    riscv_max_q31(src_buf_q31, MAX_BLOCKSIZE, &result_q31, &result_index));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X index = %d\n",result_q31,result_index);
 #endif
 
 /*Mean*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_mean_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32);
-  perf_stop();
-  printf("riscv_mean_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_mean_f32", "f32", MAX_BLOCKSIZE,
+    riscv_mean_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32));
 #ifdef PRINT_OUTPUT
   printf("value = %d\n",(int)(result_f32*100));
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_mean_q7(src_buf_q7, MAX_BLOCKSIZE, &result_q7);
-  perf_stop();
-  printf("riscv_mean_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_mean_q7", "q7", MAX_BLOCKSIZE,
+    riscv_mean_q7(src_buf_q7, MAX_BLOCKSIZE, &result_q7));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X\n",result_q7);
 #endif  
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_mean_q15(src_buf_q15, MAX_BLOCKSIZE,&result_q15);
-  perf_stop();
-  printf("riscv_mean_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_mean_q15", "q15", MAX_BLOCKSIZE,
+    riscv_mean_q15(src_buf_q15, MAX_BLOCKSIZE,&result_q15));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X\n",result_q15);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_mean_q31(src_buf_q31, MAX_BLOCKSIZE, &result_q31);
-  perf_stop();
-  printf("riscv_mean_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_mean_q31", "q31", MAX_BLOCKSIZE,
+    riscv_mean_q31(src_buf_q31, MAX_BLOCKSIZE, &result_q31));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X\n",result_q31);
 #endif
 
 /*Min*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_min_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32, &result_index);
-  perf_stop();
-  printf("riscv_min_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_min_f32", "f32", MAX_BLOCKSIZE,
+    riscv_min_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32, &result_index));
 #ifdef PRINT_OUTPUT
   printf("value = %d index = %d\n",(int)(result_f32*100),result_index);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_min_q7(src_buf_q7, MAX_BLOCKSIZE, &result_q7, &result_index);
-  perf_stop();
-  printf("riscv_fir_sparse_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_min_q7", "q7", MAX_BLOCKSIZE,
+    riscv_min_q7(src_buf_q7, MAX_BLOCKSIZE, &result_q7, &result_index));
 #ifdef PRINT_OUTPUT
   printf("riscv_min_q7\nvalue = 0x%X index = %d\n",result_q7,result_index);
 #endif  
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_min_q15(src_buf_q15, MAX_BLOCKSIZE, &result_q15, &result_index);
-  perf_stop();
-  printf("riscv_fir_sparse_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_min_q15", "q15", MAX_BLOCKSIZE,
+    riscv_min_q15(src_buf_q15, MAX_BLOCKSIZE, &result_q15, &result_index));
 #ifdef PRINT_OUTPUT
   printf("riscv_min_q15\nvalue = 0x%X index = %d\n",result_q15,result_index);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_min_q31(src_buf_q31, MAX_BLOCKSIZE, &result_q31, &result_index);
-  perf_stop();
-  printf("riscv_min_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_min_q31", "q31", MAX_BLOCKSIZE,
+    riscv_min_q31(src_buf_q31, MAX_BLOCKSIZE, &result_q31, &result_index));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X index = %d\n",result_q31,result_index);
 #endif
 
 /*Power*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_power_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32);
-  perf_stop();
-  printf("riscv_power_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_power_f32", "f32", MAX_BLOCKSIZE,
+    riscv_power_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32));
 #ifdef PRINT_OUTPUT
   printf("value = %d\n",(int)(result_f32*100));
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_power_q7(src_buf_q7, MAX_BLOCKSIZE, &result_q31);
-  perf_stop();
-  printf("riscv_power_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_power_q7", "q7", MAX_BLOCKSIZE,
+    riscv_power_q7(src_buf_q7, MAX_BLOCKSIZE, &result_q31));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X\n",result_q31);
 #endif  
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_power_q15(src_buf_q15, MAX_BLOCKSIZE,&result_q63);
-  perf_stop();
-  printf("riscv_power_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_power_q15", "q15", MAX_BLOCKSIZE,
+    riscv_power_q15(src_buf_q15, MAX_BLOCKSIZE,&result_q63));
 #ifdef PRINT_OUTPUT
   int * ptr = &result_q63;
   ptr++;
@@ -262,11 +219,8 @@ int32_t main(void)
   printf("%X\n",*(ptr));
  
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_power_q31(src_buf_q31, MAX_BLOCKSIZE, &result_q63);
-  perf_stop();
-  printf("riscv_power_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_power_q31", "q31", MAX_BLOCKSIZE,
+    riscv_power_q31(src_buf_q31, MAX_BLOCKSIZE, &result_q63));
 #ifdef PRINT_OUTPUT
   ptr = &result_q63;
   ptr++;
@@ -276,84 +230,153 @@ int32_t main(void)
 
 /*RMS*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_rms_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32);
-  perf_stop();
-  printf("riscv_rms_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_rms_f32", "f32", MAX_BLOCKSIZE,
+    riscv_rms_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32));
 #ifdef PRINT_OUTPUT
   printf("value = %d\n",(int)(result_f32*100));
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_rms_q15(src_buf_q15, MAX_BLOCKSIZE,&result_q15);
-  perf_stop();
-  printf("riscv_rms_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_rms_q15", "q15", MAX_BLOCKSIZE,
+    riscv_rms_q15(src_buf_q15, MAX_BLOCKSIZE,&result_q15));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X\n",result_q15);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_rms_q31(srcB_buf_q31, MAX_BLOCKSIZE, &result_q31);
-  perf_stop();
-  printf("riscv_rms_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_rms_q31", "q31", MAX_BLOCKSIZE,
+    riscv_rms_q31(srcB_buf_q31, MAX_BLOCKSIZE, &result_q31));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X\n",result_q31);
 #endif
+  RISCV_BENCH("riscv_rms_q7", "q7", MAX_BLOCKSIZE,
+    riscv_rms_q7(src_buf_q7, MAX_BLOCKSIZE, &result_q15));
+#ifdef PRINT_OUTPUT
+  printf("value = 0x%X\n",result_q15);
+#endif
 
 /*Standard deviation*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_std_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32);
-  perf_stop();
-  printf("riscv_std_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_std_f32", "f32", MAX_BLOCKSIZE,
+    riscv_std_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32));
 #ifdef PRINT_OUTPUT
   printf("value = %d\n",(int)(result_f32*100));
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_std_q15(src_buf_q15, MAX_BLOCKSIZE,&result_q15);
-  perf_stop();
-  printf("riscv_std_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_std_q15", "q15", MAX_BLOCKSIZE,
+    riscv_std_q15(src_buf_q15, MAX_BLOCKSIZE,&result_q15));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X\n",result_q15);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_std_q31(src_buf_q31, MAX_BLOCKSIZE, &result_q31);
-  perf_stop();
-  printf("riscv_std_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_std_q31", "q31", MAX_BLOCKSIZE,
+    riscv_std_q31(src_buf_q31, MAX_BLOCKSIZE, &result_q31));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X\n",result_q31);
 #endif
+  RISCV_BENCH("riscv_std_q7", "q7", MAX_BLOCKSIZE,
+    riscv_std_q7(src_buf_q7, MAX_BLOCKSIZE, &result_q15));
+#ifdef PRINT_OUTPUT
+  printf("value = 0x%X\n",result_q15);
+#endif
 
 /*Variance*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_var_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32);
-  perf_stop();
-  printf("riscv_fir_sparse_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_var_f32", "f32", MAX_BLOCKSIZE,
+    riscv_var_f32(src_buf_f32, MAX_BLOCKSIZE, &result_f32));
 #ifdef PRINT_OUTPUT
   printf("riscv_var_f32\nvalue = %d\n",(int)(result_f32*100));
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_var_q15(src_buf_q15, MAX_BLOCKSIZE,&result_q15);
-  perf_stop();
-  printf("riscv_var_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_var_q15", "q15", MAX_BLOCKSIZE,
+    riscv_var_q15(src_buf_q15, MAX_BLOCKSIZE,&result_q15));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X\n",result_q15);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_var_q31(src_buf_q31, MAX_BLOCKSIZE, &result_q31);
-  perf_stop();
-  printf("riscv_var_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_var_q31", "q31", MAX_BLOCKSIZE,
+    riscv_var_q31(src_buf_q31, MAX_BLOCKSIZE, &result_q31));
 #ifdef PRINT_OUTPUT
   printf("value = 0x%X\n",result_q31);
 #endif
+  RISCV_BENCH("riscv_var_q7", "q7", MAX_BLOCKSIZE,
+    riscv_var_q7(src_buf_q7, MAX_BLOCKSIZE, &result_q15));
+#ifdef PRINT_OUTPUT
+  printf("value = 0x%X\n",result_q15);
+#endif
+
+/*Fused statistics*/
+
+  RISCV_BENCH("riscv_stats_f32", "f32", MAX_BLOCKSIZE,
+    riscv_stats_f32(src_buf_f32, MAX_BLOCKSIZE, RISCV_STATS_ALL, &stats_f32));
+#ifdef PRINT_OUTPUT
+  printf("mean = %d var = %d\n",(int)(stats_f32.mean*100),(int)(stats_f32.var*100));
+#endif
+  RISCV_BENCH("riscv_stats_q15", "q15", MAX_BLOCKSIZE,
+    riscv_stats_q15(src_buf_q15, MAX_BLOCKSIZE, RISCV_STATS_ALL, &stats_q15));
+#ifdef PRINT_OUTPUT
+  printf("mean = 0x%X var = 0x%X\n",stats_q15.mean,stats_q15.var);
+#endif
+  RISCV_BENCH("riscv_stats_q31", "q31", MAX_BLOCKSIZE,
+    riscv_stats_q31(src_buf_q31, MAX_BLOCKSIZE, RISCV_STATS_ALL, &stats_q31));
+#ifdef PRINT_OUTPUT
+  printf("mean = 0x%X var = 0x%X\n",stats_q31.mean,stats_q31.var);
+#endif
+
+/*Running statistics*/
+
+  riscv_running_stats_init_f32(&running_f32);
+  RISCV_BENCH("riscv_running_stats_push_f32", "f32", MAX_BLOCKSIZE,
+    riscv_running_stats_push_f32(&running_f32, src_buf_f32, MAX_BLOCKSIZE));
+  RISCV_BENCH("riscv_running_stats_evict_f32", "f32", MAX_BLOCKSIZE/2,
+    riscv_running_stats_evict_f32(&running_f32, src_buf_f32, MAX_BLOCKSIZE/2));
+  riscv_running_stats_get_f32(&running_f32, &stats_f32.mean, &stats_f32.var, &stats_f32.std);
+#ifdef PRINT_OUTPUT
+  printf("mean = %d var = %d\n",(int)(stats_f32.mean*100),(int)(stats_f32.var*100));
+#endif
+  riscv_running_stats_init_q31(&running_q31);
+  RISCV_BENCH("riscv_running_stats_push_q31", "q31", MAX_BLOCKSIZE,
+    riscv_running_stats_push_q31(&running_q31, src_buf_q31, MAX_BLOCKSIZE));
+  RISCV_BENCH("riscv_running_stats_evict_q31", "q31", MAX_BLOCKSIZE/2,
+    riscv_running_stats_evict_q31(&running_q31, src_buf_q31, MAX_BLOCKSIZE/2));
+  riscv_running_stats_get_q31(&running_q31, &stats_q31.mean, &stats_q31.var, &stats_q31.std);
+#ifdef PRINT_OUTPUT
+  printf("mean = 0x%X var = 0x%X\n",stats_q31.mean,stats_q31.var);
+#endif
+
+/*Histogram*/
+
+  RISCV_BENCH("riscv_histogram_f32", "f32", MAX_BLOCKSIZE,
+    riscv_histogram_f32(src_buf_f32, MAX_BLOCKSIZE, hist_edges_f32, HIST_BINS, hist_count));
+  RISCV_BENCH("riscv_histogram_uniform_f32", "f32", MAX_BLOCKSIZE,
+    riscv_histogram_uniform_f32(src_buf_f32, MAX_BLOCKSIZE, -2.0f, 2.0f, HIST_BINS, hist_count));
+  RISCV_BENCH("riscv_histogram_uniform_q15", "q15", MAX_BLOCKSIZE,
+    riscv_histogram_uniform_q15(src_buf_q15, MAX_BLOCKSIZE, -32768, 13, HIST_BINS, hist_count));
+#ifdef PRINT_OUTPUT
+  printf("bins = %d %d %d %d\n",(int)hist_count[0],(int)hist_count[1],(int)hist_count[2],(int)hist_count[3]);
+#endif
+
+/*Median*/
+
+  RISCV_BENCH("riscv_median_f32", "f32", MAX_BLOCKSIZE,
+    riscv_median_f32(src_buf_f32, scratch_f32, MAX_BLOCKSIZE, &result_f32));
+#ifdef PRINT_OUTPUT
+  printf("value = %d\n",(int)(result_f32*100));
+#endif
+  RISCV_BENCH("riscv_median_q15", "q15", MAX_BLOCKSIZE,
+    riscv_median_q15(src_buf_q15, scratch_q15, MAX_BLOCKSIZE, &result_q15));
+#ifdef PRINT_OUTPUT
+  printf("value = 0x%X\n",result_q15);
+#endif
+  RISCV_BENCH("riscv_percentile_f32", "f32", MAX_BLOCKSIZE,
+    riscv_percentile_f32(src_buf_f32, scratch_f32, MAX_BLOCKSIZE, 0.9f, &result_f32));
+#ifdef PRINT_OUTPUT
+  printf("value = %d\n",(int)(result_f32*100));
+#endif
+
+/*Median filter*/
+
+  riscv_median_filter_init_f32(&median_f32, MEDIAN_WINDOW, median_state_f32, median_heap, median_pos);
+  RISCV_BENCH("riscv_median_filter_f32", "f32", MAX_BLOCKSIZE,
+    riscv_median_filter_f32(&median_f32, src_buf_f32, filtered_f32, MAX_BLOCKSIZE));
+  riscv_median_filter_init_q15(&median_q15, MEDIAN_WINDOW, median_state_q15, median_heap, median_pos);
+  RISCV_BENCH("riscv_median_filter_q15", "q15", MAX_BLOCKSIZE,
+    riscv_median_filter_q15(&median_q15, src_buf_q15, filtered_q15, MAX_BLOCKSIZE));
+#ifdef PRINT_OUTPUT
+  printf("value = 0x%X\n",filtered_q15[MAX_BLOCKSIZE-1]);
+#endif
 
   printf("End\n");
   return 0 ;
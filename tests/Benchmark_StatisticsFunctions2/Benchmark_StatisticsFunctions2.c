@@ -0,0 +1,191 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_CELLS 256
+#define NUM_GUARD 2
+#define NUM_TRAIN 8
+#define RANK 12
+#define MAX_PEAKS 16
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A power spectrum with an exponential noise floor that rises fourfold at the middle carries five targets,
+two of them four cells apart.  The CA-CFAR and OS-CFAR thresholds of both types must match a direct
+computation over the training cells of every cell, edges included, and the peaks above them a direct
+search.  The CA-CFAR peaks must be the targets, the close pair merged to the higher one by the minimum
+distance, and a short index buffer must hold the first peaks.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "StatisticsFunctions2"
+#include "../common/riscv_bench.h"
+
+float32_t x_f32[NUM_CELLS], ca_f32[NUM_CELLS], os_f32[NUM_CELLS], scratch_f32[2 * NUM_TRAIN];
+q15_t x_q15[NUM_CELLS] __attribute__((aligned(4)));
+q15_t ca_q15[NUM_CELLS] __attribute__((aligned(4)));
+q15_t os_q15[NUM_CELLS] __attribute__((aligned(4)));
+q15_t scratch_q15[2 * NUM_TRAIN];
+uint32_t peaks_f32[MAX_PEAKS], peaks_q15[MAX_PEAKS], peaks_ref[MAX_PEAKS];
+
+static const uint32_t targets[5] = { 40, 44, 100, 180, 250 };
+static const float32_t levels[5] = { 0.4f, 0.6f, 0.3f, 0.8f, 0.7f };
+
+static int compare_double(const void * a, const void * b)
+{
+  double d = *(const double *) a - *(const double *) b;
+
+  return (d > 0.0) - (d < 0.0);
+}
+
+/* Mean and ordered statistic of the training cells of cell i */
+static void ref_cfar(const double * pX, uint32_t i, double * pMean, double * pOrder)
+{
+  double cells[2 * NUM_TRAIN];
+  uint32_t count = 0, j;
+
+  for (j = 1; j <= NUM_TRAIN; j++)
+  {
+    if(i >= NUM_GUARD + j)
+    {
+      cells[count++] = pX[i - NUM_GUARD - j];
+    }
+    if(i + NUM_GUARD + j < NUM_CELLS)
+    {
+      cells[count++] = pX[i + NUM_GUARD + j];
+    }
+  }
+  qsort(cells, count, sizeof(double), compare_double);
+  for (j = 0, *pMean = 0.0; j < count; j++)
+  {
+    *pMean += cells[j];
+  }
+  *pMean /= count;
+  *pOrder = cells[(RANK * count) / (2 * NUM_TRAIN)];
+}
+
+/* Local maxima above the threshold, closer ones merged to the higher */
+static uint32_t ref_peaks(const double * pX, const double * pThr, uint32_t minDistance, uint32_t * pIndex)
+{
+  uint32_t n = 0, i;
+
+  for (i = 1; i + 1 < NUM_CELLS; i++)
+  {
+    if((pX[i] > pThr[i]) && (pX[i] > pX[i - 1]) && (pX[i] >= pX[i + 1]))
+    {
+      if((n > 0) && (i - pIndex[n - 1] < minDistance))
+      {
+        pIndex[n - 1] = (pX[i] > pX[pIndex[n - 1]]) ? i : pIndex[n - 1];
+      }
+      else if(n < MAX_PEAKS)
+      {
+        pIndex[n++] = i;
+      }
+    }
+  }
+
+  return (n);
+}
+
+int main(void)
+{
+  double xd[NUM_CELLS], xq[NUM_CELLS], mean, order, thr[NUM_CELLS];
+  float32_t errCa = 0.0f, errOs = 0.0f, errCa15 = 0.0f, errOs15 = 0.0f;
+  uint32_t seed = 12345u, i, n, nRef, nF32, nQ15;
+  int32_t fail = 0, ok;
+  riscv_cfar_instance_f32 S_f32;
+  riscv_cfar_instance_q15 S_q15;
+
+  riscv_bench_header();
+
+  /* Exponential floor of mean 0.005, 0.02 in the upper half */
+  for (i = 0; i < NUM_CELLS; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    xd[i] = -log(((seed >> 8) + 1.0) / 16777217.0) * ((i < NUM_CELLS / 2) ? 0.005 : 0.02);
+  }
+  for (i = 0; i < 5; i++)
+  {
+    xd[targets[i]] = levels[i];
+  }
+  for (i = 0; i < NUM_CELLS; i++)
+  {
+    x_q15[i] = (q15_t) lrint(fmin(xd[i], 0.99) * 32768.0);
+    xq[i] = x_q15[i];
+    xd[i] = x_q15[i] / 32768.0;
+    x_f32[i] = (float32_t) xd[i];
+  }
+
+  ok = (riscv_cfar_init_f32(&S_f32, NUM_GUARD, NUM_TRAIN, RANK, 16.0f, scratch_f32) == RISCV_MATH_SUCCESS);
+  ok = ok && (riscv_cfar_init_q15(&S_q15, NUM_GUARD, NUM_TRAIN, RANK, 0x4000, 5, scratch_q15) == RISCV_MATH_SUCCESS);
+  ok = ok && (riscv_cfar_init_f32(&S_f32, NUM_GUARD, 0, 0, 16.0f, scratch_f32) == RISCV_MATH_ARGUMENT_ERROR);
+  ok = ok && (riscv_cfar_init_q15(&S_q15, NUM_GUARD, NUM_TRAIN, 2 * NUM_TRAIN, 0x4000, 5, scratch_q15) == RISCV_MATH_ARGUMENT_ERROR);
+  printf("CHECK riscv_cfar_init: arguments %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+  riscv_cfar_init_f32(&S_f32, NUM_GUARD, NUM_TRAIN, RANK, 16.0f, scratch_f32);
+  riscv_cfar_init_q15(&S_q15, NUM_GUARD, NUM_TRAIN, RANK, 0x4000, 5, scratch_q15);
+
+  RISCV_BENCH("riscv_cfar_ca_f32", "f32", NUM_CELLS, riscv_cfar_ca_f32(&S_f32, x_f32, ca_f32, NUM_CELLS));
+  RISCV_BENCH("riscv_cfar_ca_q15", "q15", NUM_CELLS, riscv_cfar_ca_q15(&S_q15, x_q15, ca_q15, NUM_CELLS));
+  RISCV_BENCH("riscv_cfar_os_f32", "f32", NUM_CELLS, riscv_cfar_os_f32(&S_f32, x_f32, os_f32, NUM_CELLS));
+  RISCV_BENCH("riscv_cfar_os_q15", "q15", NUM_CELLS, riscv_cfar_os_q15(&S_q15, x_q15, os_q15, NUM_CELLS));
+  RISCV_BENCH("riscv_find_peaks_f32", "f32", NUM_CELLS,
+              nF32 = riscv_find_peaks_f32(x_f32, NUM_CELLS, ca_f32, 0.0f, 5, peaks_f32, MAX_PEAKS));
+  RISCV_BENCH("riscv_find_peaks_q15", "q15", NUM_CELLS,
+              nQ15 = riscv_find_peaks_q15(x_q15, NUM_CELLS, ca_q15, 0, 5, peaks_q15, MAX_PEAKS));
+
+  /* Thresholds against the training cells of every cell */
+  for (i = 0; i < NUM_CELLS; i++)
+  {
+    ref_cfar(xd, i, &mean, &order);
+    errCa = fmaxf(errCa, (float32_t) fabs(ca_f32[i] - 16.0 * mean) / (float32_t) (16.0 * mean));
+    errOs = fmaxf(errOs, (float32_t) fabs(os_f32[i] - 16.0 * order));
+    ref_cfar(xq, i, &mean, &order);
+    errCa15 = fmaxf(errCa15, (float32_t) fabs(ca_q15[i] - fmin(16.0 * mean, 32767.0)));
+    errOs15 = fmaxf(errOs15, (float32_t) fabs(os_q15[i] - fmin(16.0 * order, 32767.0)));
+  }
+  ok = (errCa < 1e-5f) && (errCa15 <= 0.5f);
+  printf("CHECK riscv_cfar_ca: f32 %d (1e-9), q15 %d (1e-3 LSB) %s\n", (int) (errCa * 1e9f), (int) (errCa15 * 1e3f),
+         ok ? "ok" : "bad");
+  fail |= !ok;
+  ok = (errOs == 0.0f) && (errOs15 == 0.0f);
+  printf("CHECK riscv_cfar_os: f32 %d (1e-9), q15 %d LSB %s\n", (int) (errOs * 1e9f), (int) errOs15, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Peaks above the CA-CFAR thresholds */
+  for (i = 0; i < NUM_CELLS; i++)
+  {
+    thr[i] = ca_f32[i];
+  }
+  nRef = ref_peaks(xd, thr, 5, peaks_ref);
+  ok = (nF32 == nRef) && (memcmp(peaks_f32, peaks_ref, nRef * sizeof(uint32_t)) == 0);
+  for (i = 0; i < NUM_CELLS; i++)
+  {
+    thr[i] = ca_q15[i];
+  }
+  nRef = ref_peaks(xq, thr, 5, peaks_ref);
+  ok = ok && (nQ15 == nRef) && (memcmp(peaks_q15, peaks_ref, nRef * sizeof(uint32_t)) == 0);
+  ok = ok && (nF32 == 4) && (peaks_f32[0] == 44) && (peaks_f32[1] == 100) && (peaks_f32[2] == 180) && (peaks_f32[3] == 250);
+  ok = ok && (nQ15 == nF32) && (memcmp(peaks_q15, peaks_f32, nF32 * sizeof(uint32_t)) == 0);
+  printf("CHECK riscv_find_peaks: f32 %d, q15 %d peaks %s\n", (int) nF32, (int) nQ15, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* A fixed threshold, without and with the minimum distance, and a short buffer */
+  n = riscv_find_peaks_q15(x_q15, NUM_CELLS, NULL, 0x2000, 0, peaks_q15, MAX_PEAKS);
+  ok = (n == 5) && (peaks_q15[0] == 40) && (peaks_q15[1] == 44);
+  n = riscv_find_peaks_f32(x_f32, NUM_CELLS, NULL, 0.25f, 0, peaks_f32, 2);
+  ok = ok && (n == 2) && (peaks_f32[0] == 40) && (peaks_f32[1] == 44);
+  n = riscv_find_peaks_f32(x_f32, NUM_CELLS, NULL, 0.25f, 5, peaks_f32, 2);
+  ok = ok && (n == 2) && (peaks_f32[0] == 44) && (peaks_f32[1] == 100);
+  printf("CHECK riscv_find_peaks: fixed threshold %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
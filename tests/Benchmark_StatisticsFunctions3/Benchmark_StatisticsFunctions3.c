@@ -0,0 +1,366 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define DIM 32
+#define NUM_TEMPLATES 500
+#define NUM_WORDS 8
+#define K 5
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A feature vector is compared with NUM_TEMPLATES templates of DIM elements, template 0 equal to the
+vector and template 9 a copy of template 4.  riscv_dist_l2sq_q15() is timed against riscv_sub_q15() and
+riscv_power_q15() called on every template, the inputs are kept in half range so that the subtraction does
+not saturate and both give the same distances.  Every distance is compared with a direct computation
+in double, exactly for the integer ones, and the k nearest of every function with a stable sort of all
+its distances.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "StatisticsFunctions3"
+#include "../common/riscv_bench.h"
+
+q15_t vec_q15[DIM] __attribute__((aligned(4)));
+q15_t tpl_q15[NUM_TEMPLATES * DIM] __attribute__((aligned(4)));
+q15_t diff_q15[DIM];
+q7_t vec_q7[DIM] __attribute__((aligned(4)));
+q7_t tpl_q7[NUM_TEMPLATES * DIM] __attribute__((aligned(4)));
+float32_t vec_f32[DIM], tpl_f32[NUM_TEMPLATES * DIM];
+uint32_t vec_u32[NUM_WORDS], tpl_u32[NUM_TEMPLATES * NUM_WORDS];
+
+q63_t dist_q63[NUM_TEMPLATES], ref_q63[NUM_TEMPLATES], knn_q63[K];
+q31_t dist_q31[NUM_TEMPLATES], knn_q31[K];
+q15_t dist_q15[NUM_TEMPLATES], knn_q15[K];
+float32_t dist_f32[NUM_TEMPLATES], knn_f32[K];
+uint32_t dist_u32[NUM_TEMPLATES], knn_u32[K];
+uint32_t knn_index[K];
+double full[NUM_TEMPLATES], kept[K];
+
+/* The k nearest (largest when largest is set) of full[] by a stable selection, compared with the kept ones */
+static int32_t check_knn(const double * pFull, const double * pKept, const uint32_t * pIndex, uint32_t count,
+                         int32_t largest)
+{
+  uint8_t used[NUM_TEMPLATES];
+  uint32_t i, j, best;
+
+  if(count != K)
+  {
+    return (0);
+  }
+
+  memset(used, 0, sizeof(used));
+  for (i = 0; i < K; i++)
+  {
+    best = NUM_TEMPLATES;
+    for (j = 0; j < NUM_TEMPLATES; j++)
+    {
+      if(!used[j] && ((best == NUM_TEMPLATES) || (largest ? (pFull[j] > pFull[best]) : (pFull[j] < pFull[best]))))
+      {
+        best = j;
+      }
+    }
+    used[best] = 1;
+    if((pIndex[i] != best) || (pKept[i] != pFull[best]))
+    {
+      return (0);
+    }
+  }
+
+  return (1);
+}
+
+static uint32_t popcount_ref(uint32_t x)
+{
+  uint32_t n = 0;
+
+  while(x != 0u)
+  {
+    n += x & 1u;
+    x >>= 1;
+  }
+
+  return (n);
+}
+
+int32_t main(void)
+{
+  uint32_t i, j, t, count;
+  uint32_t seed = 1u;
+  int32_t fail = 0, ok, okK;
+  q63_t power;
+  double aa, ab, bb, d, e, maxErr;
+
+  riscv_bench_header();
+
+  for (i = 0; i < DIM; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    vec_q15[i] = (q15_t)(seed >> 16) >> 1;
+    vec_q7[i] = (q7_t)(seed >> 24);
+    vec_f32[i] = (float32_t) vec_q15[i] / 16384.0f;
+  }
+  for (i = 0; i < NUM_TEMPLATES * DIM; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    tpl_q15[i] = (q15_t)(seed >> 16) >> 1;
+    tpl_q7[i] = (q7_t)(seed >> 24);
+    tpl_f32[i] = (float32_t) tpl_q15[i] / 16384.0f;
+  }
+  for (i = 0; i < NUM_WORDS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    vec_u32[i] = seed;
+  }
+  for (i = 0; i < NUM_TEMPLATES * NUM_WORDS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    tpl_u32[i] = vec_u32[i % NUM_WORDS] ^ (seed & (seed >> 7) & (seed >> 13));
+  }
+
+  /* Template 0 is the vector, template 9 a copy of template 4 */
+  memcpy(tpl_q15, vec_q15, sizeof(vec_q15));
+  memcpy(tpl_q7, vec_q7, sizeof(vec_q7));
+  memcpy(tpl_f32, vec_f32, sizeof(vec_f32));
+  memcpy(tpl_u32, vec_u32, sizeof(vec_u32));
+  memcpy(tpl_q15 + 9 * DIM, tpl_q15 + 4 * DIM, DIM * sizeof(q15_t));
+  memcpy(tpl_q7 + 9 * DIM, tpl_q7 + 4 * DIM, DIM * sizeof(q7_t));
+  memcpy(tpl_f32 + 9 * DIM, tpl_f32 + 4 * DIM, DIM * sizeof(float32_t));
+  memcpy(tpl_u32 + 9 * NUM_WORDS, tpl_u32 + 4 * NUM_WORDS, NUM_WORDS * sizeof(uint32_t));
+
+/*Squared Euclidean*/
+  RISCV_BENCH("riscv_sub_q15+riscv_power_q15", "q15", NUM_TEMPLATES,
+    for (t = 0; t < NUM_TEMPLATES; t++)
+    {
+      riscv_sub_q15(vec_q15, tpl_q15 + t * DIM, diff_q15, DIM);
+      riscv_power_q15(diff_q15, DIM, &ref_q63[t]);
+    });
+  RISCV_BENCH("riscv_dist_l2sq_q15", "q15", NUM_TEMPLATES,
+    count = riscv_dist_l2sq_q15(vec_q15, tpl_q15, DIM, NUM_TEMPLATES, 0, dist_q63, NULL));
+  ok = (count == NUM_TEMPLATES) && (memcmp(dist_q63, ref_q63, sizeof(ref_q63)) == 0);
+  for (t = 0; t < NUM_TEMPLATES; t++)
+  {
+    for (power = 0, i = 0; i < DIM; i++)
+    {
+      power += (q63_t)(vec_q15[i] - tpl_q15[t * DIM + i]) * (vec_q15[i] - tpl_q15[t * DIM + i]);
+    }
+    ok &= (power == dist_q63[t]);
+    full[t] = (double) dist_q63[t];
+  }
+  RISCV_BENCH("riscv_dist_l2sq_q15 k", "q15", NUM_TEMPLATES,
+    count = riscv_dist_l2sq_q15(vec_q15, tpl_q15, DIM, NUM_TEMPLATES, K, knn_q63, knn_index));
+  for (i = 0; i < K; i++)
+    kept[i] = (double) knn_q63[i];
+  okK = check_knn(full, kept, knn_index, count, 0) && (knn_index[0] == 0) && (knn_q63[0] == 0);
+  printf("CHECK riscv_dist_l2sq_q15: distances %s, %d nearest %d %d %d %d %d %s\n", ok ? "ok" : "bad", K,
+         (int) knn_index[0], (int) knn_index[1], (int) knn_index[2], (int) knn_index[3], (int) knn_index[4],
+         okK ? "ok" : "bad");
+  fail |= !ok | !okK;
+
+  RISCV_BENCH("riscv_dist_l2sq_q7", "q7", NUM_TEMPLATES,
+    count = riscv_dist_l2sq_q7(vec_q7, tpl_q7, DIM, NUM_TEMPLATES, 0, dist_q31, NULL));
+  ok = (count == NUM_TEMPLATES);
+  for (t = 0; t < NUM_TEMPLATES; t++)
+  {
+    for (power = 0, i = 0; i < DIM; i++)
+    {
+      power += (vec_q7[i] - tpl_q7[t * DIM + i]) * (vec_q7[i] - tpl_q7[t * DIM + i]);
+    }
+    ok &= (power == dist_q31[t]);
+    full[t] = (double) dist_q31[t];
+  }
+  count = riscv_dist_l2sq_q7(vec_q7, tpl_q7, DIM, NUM_TEMPLATES, K, knn_q31, knn_index);
+  for (i = 0; i < K; i++)
+    kept[i] = (double) knn_q31[i];
+  okK = check_knn(full, kept, knn_index, count, 0);
+  printf("CHECK riscv_dist_l2sq_q7: distances %s, nearest %s\n", ok ? "ok" : "bad", okK ? "ok" : "bad");
+  fail |= !ok | !okK;
+
+  RISCV_BENCH("riscv_dist_l2sq_f32", "f32", NUM_TEMPLATES,
+    count = riscv_dist_l2sq_f32(vec_f32, tpl_f32, DIM, NUM_TEMPLATES, 0, dist_f32, NULL));
+  ok = (count == NUM_TEMPLATES);
+  for (t = 0; t < NUM_TEMPLATES; t++)
+  {
+    for (d = 0.0, i = 0; i < DIM; i++)
+    {
+      d += ((double) vec_f32[i] - tpl_f32[t * DIM + i]) * ((double) vec_f32[i] - tpl_f32[t * DIM + i]);
+    }
+    ok &= (fabs(d - dist_f32[t]) <= 1e-5 * (d + 1.0));
+    full[t] = (double) dist_f32[t];
+  }
+  count = riscv_dist_l2sq_f32(vec_f32, tpl_f32, DIM, NUM_TEMPLATES, K, knn_f32, knn_index);
+  for (i = 0; i < K; i++)
+    kept[i] = (double) knn_f32[i];
+  okK = check_knn(full, kept, knn_index, count, 0);
+  printf("CHECK riscv_dist_l2sq_f32: distances %s, nearest %s\n", ok ? "ok" : "bad", okK ? "ok" : "bad");
+  fail |= !ok | !okK;
+
+/*Manhattan*/
+  RISCV_BENCH("riscv_dist_l1_q15", "q15", NUM_TEMPLATES,
+    count = riscv_dist_l1_q15(vec_q15, tpl_q15, DIM, NUM_TEMPLATES, 0, dist_q31, NULL));
+  ok = (count == NUM_TEMPLATES);
+  for (t = 0; t < NUM_TEMPLATES; t++)
+  {
+    for (power = 0, i = 0; i < DIM; i++)
+    {
+      power += abs(vec_q15[i] - tpl_q15[t * DIM + i]);
+    }
+    ok &= (power == dist_q31[t]);
+    full[t] = (double) dist_q31[t];
+  }
+  count = riscv_dist_l1_q15(vec_q15, tpl_q15, DIM, NUM_TEMPLATES, K, knn_q31, knn_index);
+  for (i = 0; i < K; i++)
+    kept[i] = (double) knn_q31[i];
+  okK = check_knn(full, kept, knn_index, count, 0);
+  printf("CHECK riscv_dist_l1_q15: distances %s, nearest %s\n", ok ? "ok" : "bad", okK ? "ok" : "bad");
+  fail |= !ok | !okK;
+
+  RISCV_BENCH("riscv_dist_l1_q7", "q7", NUM_TEMPLATES,
+    count = riscv_dist_l1_q7(vec_q7, tpl_q7, DIM, NUM_TEMPLATES, 0, dist_q31, NULL));
+  ok = (count == NUM_TEMPLATES);
+  for (t = 0; t < NUM_TEMPLATES; t++)
+  {
+    for (power = 0, i = 0; i < DIM; i++)
+    {
+      power += abs(vec_q7[i] - tpl_q7[t * DIM + i]);
+    }
+    ok &= (power == dist_q31[t]);
+    full[t] = (double) dist_q31[t];
+  }
+  count = riscv_dist_l1_q7(vec_q7, tpl_q7, DIM, NUM_TEMPLATES, K, knn_q31, knn_index);
+  for (i = 0; i < K; i++)
+    kept[i] = (double) knn_q31[i];
+  okK = check_knn(full, kept, knn_index, count, 0);
+  printf("CHECK riscv_dist_l1_q7: distances %s, nearest %s\n", ok ? "ok" : "bad", okK ? "ok" : "bad");
+  fail |= !ok | !okK;
+
+  RISCV_BENCH("riscv_dist_l1_f32", "f32", NUM_TEMPLATES,
+    count = riscv_dist_l1_f32(vec_f32, tpl_f32, DIM, NUM_TEMPLATES, 0, dist_f32, NULL));
+  ok = (count == NUM_TEMPLATES);
+  for (t = 0; t < NUM_TEMPLATES; t++)
+  {
+    for (d = 0.0, i = 0; i < DIM; i++)
+    {
+      d += fabs((double) vec_f32[i] - tpl_f32[t * DIM + i]);
+    }
+    ok &= (fabs(d - dist_f32[t]) <= 1e-5 * (d + 1.0));
+    full[t] = (double) dist_f32[t];
+  }
+  count = riscv_dist_l1_f32(vec_f32, tpl_f32, DIM, NUM_TEMPLATES, K, knn_f32, knn_index);
+  for (i = 0; i < K; i++)
+    kept[i] = (double) knn_f32[i];
+  okK = check_knn(full, kept, knn_index, count, 0);
+  printf("CHECK riscv_dist_l1_f32: distances %s, nearest %s\n", ok ? "ok" : "bad", okK ? "ok" : "bad");
+  fail |= !ok | !okK;
+
+/*Cosine*/
+  RISCV_BENCH("riscv_dist_cosine_q15", "q15", NUM_TEMPLATES,
+    count = riscv_dist_cosine_q15(vec_q15, tpl_q15, DIM, NUM_TEMPLATES, 0, dist_q15, NULL));
+  ok = (count == NUM_TEMPLATES);
+  maxErr = 0.0;
+  for (t = 0; t < NUM_TEMPLATES; t++)
+  {
+    for (aa = ab = bb = 0.0, i = 0; i < DIM; i++)
+    {
+      aa += (double) vec_q15[i] * vec_q15[i];
+      ab += (double) vec_q15[i] * tpl_q15[t * DIM + i];
+      bb += (double) tpl_q15[t * DIM + i] * tpl_q15[t * DIM + i];
+    }
+    e = fabs(ab / sqrt(aa * bb) * 32768.0 - dist_q15[t]);
+    maxErr = (e > maxErr) ? e : maxErr;
+    full[t] = (double) dist_q15[t];
+  }
+  ok &= (maxErr <= 1.0) && (dist_q15[0] == 0x7FFF);
+  RISCV_BENCH("riscv_dist_cosine_q15 k", "q15", NUM_TEMPLATES,
+    count = riscv_dist_cosine_q15(vec_q15, tpl_q15, DIM, NUM_TEMPLATES, K, knn_q15, knn_index));
+  for (i = 0; i < K; i++)
+    kept[i] = (double) knn_q15[i];
+  okK = check_knn(full, kept, knn_index, count, 1) && (knn_index[0] == 0);
+  printf("CHECK riscv_dist_cosine_q15: error %.2f LSB %s, most similar %s\n", maxErr, ok ? "ok" : "bad",
+         okK ? "ok" : "bad");
+  fail |= !ok | !okK;
+
+  RISCV_BENCH("riscv_dist_cosine_q7", "q7", NUM_TEMPLATES,
+    count = riscv_dist_cosine_q7(vec_q7, tpl_q7, DIM, NUM_TEMPLATES, 0, dist_q15, NULL));
+  ok = (count == NUM_TEMPLATES);
+  maxErr = 0.0;
+  for (t = 0; t < NUM_TEMPLATES; t++)
+  {
+    for (aa = ab = bb = 0.0, i = 0; i < DIM; i++)
+    {
+      aa += (double) vec_q7[i] * vec_q7[i];
+      ab += (double) vec_q7[i] * tpl_q7[t * DIM + i];
+      bb += (double) tpl_q7[t * DIM + i] * tpl_q7[t * DIM + i];
+    }
+    e = fabs(ab / sqrt(aa * bb) * 32768.0 - dist_q15[t]);
+    maxErr = (e > maxErr) ? e : maxErr;
+    full[t] = (double) dist_q15[t];
+  }
+  ok &= (maxErr <= 1.0);
+  count = riscv_dist_cosine_q7(vec_q7, tpl_q7, DIM, NUM_TEMPLATES, K, knn_q15, knn_index);
+  for (i = 0; i < K; i++)
+    kept[i] = (double) knn_q15[i];
+  okK = check_knn(full, kept, knn_index, count, 1);
+  printf("CHECK riscv_dist_cosine_q7: error %.2f LSB %s, most similar %s\n", maxErr, ok ? "ok" : "bad",
+         okK ? "ok" : "bad");
+  fail |= !ok | !okK;
+
+  RISCV_BENCH("riscv_dist_cosine_f32", "f32", NUM_TEMPLATES,
+    count = riscv_dist_cosine_f32(vec_f32, tpl_f32, DIM, NUM_TEMPLATES, 0, dist_f32, NULL));
+  ok = (count == NUM_TEMPLATES);
+  for (t = 0; t < NUM_TEMPLATES; t++)
+  {
+    for (aa = ab = bb = 0.0, i = 0; i < DIM; i++)
+    {
+      aa += (double) vec_f32[i] * vec_f32[i];
+      ab += (double) vec_f32[i] * tpl_f32[t * DIM + i];
+      bb += (double) tpl_f32[t * DIM + i] * tpl_f32[t * DIM + i];
+    }
+    ok &= (fabs(ab / sqrt(aa * bb) - dist_f32[t]) <= 1e-5);
+    full[t] = (double) dist_f32[t];
+  }
+  count = riscv_dist_cosine_f32(vec_f32, tpl_f32, DIM, NUM_TEMPLATES, K, knn_f32, knn_index);
+  for (i = 0; i < K; i++)
+    kept[i] = (double) knn_f32[i];
+  okK = check_knn(full, kept, knn_index, count, 1);
+  printf("CHECK riscv_dist_cosine_f32: similarities %s, most similar %s\n", ok ? "ok" : "bad", okK ? "ok" : "bad");
+  fail |= !ok | !okK;
+
+/*Hamming*/
+  RISCV_BENCH("riscv_dist_hamming_u32", "u32", NUM_TEMPLATES,
+    count = riscv_dist_hamming_u32(vec_u32, tpl_u32, NUM_WORDS, NUM_TEMPLATES, 0, dist_u32, NULL));
+  ok = (count == NUM_TEMPLATES);
+  for (t = 0; t < NUM_TEMPLATES; t++)
+  {
+    for (j = 0, i = 0; i < NUM_WORDS; i++)
+    {
+      j += popcount_ref(vec_u32[i] ^ tpl_u32[t * NUM_WORDS + i]);
+    }
+    ok &= (j == dist_u32[t]);
+    full[t] = (double) dist_u32[t];
+  }
+  count = riscv_dist_hamming_u32(vec_u32, tpl_u32, NUM_WORDS, NUM_TEMPLATES, K, knn_u32, knn_index);
+  for (i = 0; i < K; i++)
+    kept[i] = (double) knn_u32[i];
+  okK = check_knn(full, kept, knn_index, count, 0);
+  printf("CHECK riscv_dist_hamming_u32: distances %s, nearest %s\n", ok ? "ok" : "bad", okK ? "ok" : "bad");
+  fail |= !ok | !okK;
+
+  /* Fewer templates than k */
+  count = riscv_dist_l2sq_q15(vec_q15, tpl_q15 + 3 * DIM, DIM, 3, K, knn_q63, knn_index);
+  ok = (count == 3) && (knn_index[0] < 3) && (knn_index[1] < 3) && (knn_index[2] < 3) &&
+       (knn_q63[0] <= knn_q63[1]) && (knn_q63[1] <= knn_q63[2]);
+  printf("CHECK riscv_dist k > numTemplates: %d %s\n", (int) count, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  printf("End\n");
+
+  return (fail);
+}
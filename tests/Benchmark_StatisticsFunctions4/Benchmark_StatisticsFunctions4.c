@@ -0,0 +1,314 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define CH 8
+#define CH_ODD 5
+#define SAMPLES 256
+#define LAMBDA 0.9
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*SAMPLES frames of CH channel-interleaved samples, real and complex, give the CH by CH covariance
+matrix.  riscv_covariance_q15/q31/f32() are timed against a de-interleave of every channel and one
+riscv_dot_prod per pair of the upper triangle, riscv_cmplx_covariance_f32() against riscv_cmplx_conj_f32()
+and riscv_cmplx_dot_prod_f32() per pair.  Every matrix is compared with a direct computation, exactly for
+the fixed-point ones, for CH and for an odd CH_ODD channels, then updated a second time with the
+forgetting factor LAMBDA.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "StatisticsFunctions4"
+#include "../common/riscv_bench.h"
+
+q15_t src_q15[2 * CH * SAMPLES] __attribute__((aligned(4)));
+q31_t src_q31[2 * CH * SAMPLES];
+float32_t src_f32[2 * CH * SAMPLES];
+q15_t chan_q15[CH * SAMPLES] __attribute__((aligned(4)));
+q31_t chan_q31[CH * SAMPLES];
+float32_t chan_f32[2 * CH * SAMPLES];
+float32_t conj_f32[2 * CH * SAMPLES];
+q31_t wide[2 * CH * SAMPLES];
+
+q63_t cov_q63[2 * CH * CH], ref_q63[2 * CH * CH];
+float32_t cov_f32[2 * CH * CH], base_f32[2 * CH * CH];
+double ref_f64[2 * CH * CH];
+
+/* Sums of x_i * conj(x_j) of integer samples, each product shifted right by shift, upper triangle mirrored */
+static void ref_cov_int(const q31_t * pSrc, uint32_t N, int32_t cmplx, uint32_t shift, q63_t lambda,
+                        uint32_t lambdaBits, q63_t * pCov)
+{
+  uint32_t i, j, n, w = cmplx ? 2u : 1u;
+  q63_t re, im, c, ar, ai, br, bi;
+
+  for (i = 0; i < N; i++)
+  {
+    for (j = i; j < N; j++)
+    {
+      re = im = 0;
+      for (n = 0; n < SAMPLES; n++)
+      {
+        ar = pSrc[(n * N + i) * w];
+        br = pSrc[(n * N + j) * w];
+        ai = cmplx ? pSrc[(n * N + i) * w + 1] : 0;
+        bi = cmplx ? pSrc[(n * N + j) * w + 1] : 0;
+        re += ((ar * br) >> shift) + ((ai * bi) >> shift);
+        im += ((ai * br) >> shift) - ((ar * bi) >> shift);
+      }
+      c = pCov[(i * N + j) * w];
+      if(lambda != 0)
+        re += (lambda == (((q63_t) 1 << lambdaBits) - 1)) ? c
+              : ((c >> lambdaBits) * lambda) + (((c & (((q63_t) 1 << lambdaBits) - 1)) * lambda) >> lambdaBits);
+      pCov[(i * N + j) * w] = re;
+      pCov[(j * N + i) * w] = re;
+      if(cmplx)
+      {
+        c = pCov[(i * N + j) * w + 1];
+        if(lambda != 0)
+          im += (lambda == (((q63_t) 1 << lambdaBits) - 1)) ? c
+                : ((c >> lambdaBits) * lambda) + (((c & (((q63_t) 1 << lambdaBits) - 1)) * lambda) >> lambdaBits);
+        pCov[(i * N + j) * w + 1] = (i == j) ? 0 : im;
+        pCov[(j * N + i) * w + 1] = (i == j) ? 0 : -im;
+      }
+    }
+  }
+}
+
+/* Same in double for floating-point samples */
+static void ref_cov_f64(const float32_t * pSrc, uint32_t N, int32_t cmplx, double lambda, double * pCov)
+{
+  uint32_t i, j, n, w = cmplx ? 2u : 1u;
+  double re, im, ar, ai, br, bi;
+
+  for (i = 0; i < N; i++)
+  {
+    for (j = 0; j < N; j++)
+    {
+      re = im = 0.0;
+      for (n = 0; n < SAMPLES; n++)
+      {
+        ar = pSrc[(n * N + i) * w];
+        br = pSrc[(n * N + j) * w];
+        ai = cmplx ? pSrc[(n * N + i) * w + 1] : 0.0;
+        bi = cmplx ? pSrc[(n * N + j) * w + 1] : 0.0;
+        re += ar * br + ai * bi;
+        im += ai * br - ar * bi;
+      }
+      pCov[(i * N + j) * w] = lambda * pCov[(i * N + j) * w] + re;
+      if(cmplx)
+        pCov[(i * N + j) * w + 1] = lambda * pCov[(i * N + j) * w + 1] + im;
+    }
+  }
+}
+
+static int32_t same_f32(const float32_t * pA, const double * pB, uint32_t len)
+{
+  uint32_t i;
+  double scale = 0.0;
+
+  for (i = 0; i < len; i++)
+    scale = (fabs(pB[i]) > scale) ? fabs(pB[i]) : scale;
+  for (i = 0; i < len; i++)
+  {
+    if(fabs(pA[i] - pB[i]) > 1e-5 * scale)
+      return (0);
+  }
+
+  return (1);
+}
+
+int32_t main(void)
+{
+  uint32_t i, j, n, k;
+  uint32_t seed = 1u;
+  int32_t fail = 0, ok, okOdd, okLambda;
+  float32_t re, im;
+
+  riscv_bench_header();
+
+  for (i = 0; i < 2 * CH * SAMPLES; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    src_q15[i] = (q15_t)(seed >> 16);
+    src_q31[i] = (q31_t) seed;
+    src_f32[i] = (float32_t) src_q15[i] / 32768.0f;
+  }
+  /* one channel of full-scale -1.0 samples */
+  for (n = 0; n < SAMPLES; n++)
+    src_q15[n * CH + 3] = -32768;
+
+/*Real Q15*/
+  RISCV_BENCH("riscv_dot_prod_q15 per pair", "q15", SAMPLES,
+    for (i = 0; i < CH; i++)
+      for (n = 0; n < SAMPLES; n++)
+        chan_q15[i * SAMPLES + n] = src_q15[n * CH + i];
+    for (i = 0; i < CH; i++)
+      for (j = i; j < CH; j++)
+      {
+        riscv_dot_prod_q15(chan_q15 + i * SAMPLES, chan_q15 + j * SAMPLES, SAMPLES, &ref_q63[i * CH + j]);
+        ref_q63[j * CH + i] = ref_q63[i * CH + j];
+      });
+  RISCV_BENCH("riscv_covariance_q15", "q15", SAMPLES,
+    riscv_covariance_q15(src_q15, CH, SAMPLES, 0, cov_q63));
+  /* Not compared with the dot products, whose xpulp pairs wrap on the -1.0 channel */
+  for (i = 0; i < CH * SAMPLES; i++)
+    wide[i] = src_q15[i];
+  ref_cov_int(wide, CH, 0, 0, 0, 15, ref_q63);
+  ok = (memcmp(cov_q63, ref_q63, CH * CH * sizeof(q63_t)) == 0);
+  riscv_covariance_q15(src_q15, CH, SAMPLES, (q15_t)(LAMBDA * 32768.0), cov_q63);
+  ref_cov_int(wide, CH, 0, 0, (q15_t)(LAMBDA * 32768.0), 15, ref_q63);
+  okLambda = (memcmp(cov_q63, ref_q63, CH * CH * sizeof(q63_t)) == 0);
+  riscv_covariance_q15(src_q15, CH, SAMPLES, 0x7FFF, cov_q63);
+  ref_cov_int(wide, CH, 0, 0, 0x7FFF, 15, ref_q63);
+  okLambda &= (memcmp(cov_q63, ref_q63, CH * CH * sizeof(q63_t)) == 0);
+  riscv_covariance_q15(src_q15, CH_ODD, SAMPLES, 0, cov_q63);
+  ref_cov_int(wide, CH_ODD, 0, 0, 0, 15, ref_q63);
+  okOdd = (memcmp(cov_q63, ref_q63, CH_ODD * CH_ODD * sizeof(q63_t)) == 0);
+  printf("CHECK riscv_covariance_q15: %s, odd channels %s, forgetting %s\n", ok ? "ok" : "bad",
+         okOdd ? "ok" : "bad", okLambda ? "ok" : "bad");
+  fail |= !ok | !okOdd | !okLambda;
+
+/*Real Q31*/
+  RISCV_BENCH("riscv_dot_prod_q31 per pair", "q31", SAMPLES,
+    for (i = 0; i < CH; i++)
+      for (n = 0; n < SAMPLES; n++)
+        chan_q31[i * SAMPLES + n] = src_q31[n * CH + i];
+    for (i = 0; i < CH; i++)
+      for (j = i; j < CH; j++)
+      {
+        riscv_dot_prod_q31(chan_q31 + i * SAMPLES, chan_q31 + j * SAMPLES, SAMPLES, &ref_q63[i * CH + j]);
+        ref_q63[j * CH + i] = ref_q63[i * CH + j];
+      });
+  RISCV_BENCH("riscv_covariance_q31", "q31", SAMPLES,
+    riscv_covariance_q31(src_q31, CH, SAMPLES, 0, cov_q63));
+  ok = (memcmp(cov_q63, ref_q63, CH * CH * sizeof(q63_t)) == 0);
+  ref_cov_int(src_q31, CH, 0, 14, 0, 31, ref_q63);
+  ok &= (memcmp(cov_q63, ref_q63, CH * CH * sizeof(q63_t)) == 0);
+  riscv_covariance_q31(src_q31, CH, SAMPLES, (q31_t)(LAMBDA * 2147483648.0), cov_q63);
+  ref_cov_int(src_q31, CH, 0, 14, (q31_t)(LAMBDA * 2147483648.0), 31, ref_q63);
+  okLambda = (memcmp(cov_q63, ref_q63, CH * CH * sizeof(q63_t)) == 0);
+  riscv_covariance_q31(src_q31, CH_ODD, SAMPLES, 0, cov_q63);
+  ref_cov_int(src_q31, CH_ODD, 0, 14, 0, 31, ref_q63);
+  okOdd = (memcmp(cov_q63, ref_q63, CH_ODD * CH_ODD * sizeof(q63_t)) == 0);
+  printf("CHECK riscv_covariance_q31: %s, odd channels %s, forgetting %s\n", ok ? "ok" : "bad",
+         okOdd ? "ok" : "bad", okLambda ? "ok" : "bad");
+  fail |= !ok | !okOdd | !okLambda;
+
+/*Real F32*/
+  RISCV_BENCH("riscv_dot_prod_f32 per pair", "f32", SAMPLES,
+    for (i = 0; i < CH; i++)
+      for (n = 0; n < SAMPLES; n++)
+        chan_f32[i * SAMPLES + n] = src_f32[n * CH + i];
+    for (i = 0; i < CH; i++)
+      for (j = i; j < CH; j++)
+      {
+        riscv_dot_prod_f32(chan_f32 + i * SAMPLES, chan_f32 + j * SAMPLES, SAMPLES, &base_f32[i * CH + j]);
+        base_f32[j * CH + i] = base_f32[i * CH + j];
+      });
+  RISCV_BENCH("riscv_covariance_f32", "f32", SAMPLES,
+    riscv_covariance_f32(src_f32, CH, SAMPLES, 0.0f, cov_f32));
+  memset(ref_f64, 0, sizeof(ref_f64));
+  ref_cov_f64(src_f32, CH, 0, 0.0, ref_f64);
+  ok = same_f32(cov_f32, ref_f64, CH * CH);
+  for (k = 0; k < CH * CH; k++)
+    ok &= (cov_f32[k] == cov_f32[(k % CH) * CH + k / CH]) && (fabsf(cov_f32[k] - base_f32[k]) < 1e-3f);
+  riscv_covariance_f32(src_f32, CH, SAMPLES, (float32_t) LAMBDA, cov_f32);
+  ref_cov_f64(src_f32, CH, 0, LAMBDA, ref_f64);
+  okLambda = same_f32(cov_f32, ref_f64, CH * CH);
+  riscv_covariance_f32(src_f32, CH_ODD, SAMPLES, 0.0f, cov_f32);
+  memset(ref_f64, 0, sizeof(ref_f64));
+  ref_cov_f64(src_f32, CH_ODD, 0, 0.0, ref_f64);
+  okOdd = same_f32(cov_f32, ref_f64, CH_ODD * CH_ODD);
+  printf("CHECK riscv_covariance_f32: %s, odd channels %s, forgetting %s\n", ok ? "ok" : "bad",
+         okOdd ? "ok" : "bad", okLambda ? "ok" : "bad");
+  fail |= !ok | !okOdd | !okLambda;
+
+/*Complex F32*/
+  RISCV_BENCH("riscv_cmplx_dot_prod_f32 per pair", "f32", SAMPLES,
+    for (i = 0; i < CH; i++)
+      for (n = 0; n < SAMPLES; n++)
+      {
+        chan_f32[2 * (i * SAMPLES + n)] = src_f32[2 * (n * CH + i)];
+        chan_f32[2 * (i * SAMPLES + n) + 1] = src_f32[2 * (n * CH + i) + 1];
+      }
+    riscv_cmplx_conj_f32(chan_f32, conj_f32, CH * SAMPLES);
+    for (i = 0; i < CH; i++)
+      for (j = i; j < CH; j++)
+      {
+        riscv_cmplx_dot_prod_f32(chan_f32 + 2 * i * SAMPLES, conj_f32 + 2 * j * SAMPLES, SAMPLES, &re, &im);
+        base_f32[2 * (i * CH + j)] = re;
+        base_f32[2 * (i * CH + j) + 1] = im;
+        base_f32[2 * (j * CH + i)] = re;
+        base_f32[2 * (j * CH + i) + 1] = -im;
+      });
+  RISCV_BENCH("riscv_cmplx_covariance_f32", "f32", SAMPLES,
+    riscv_cmplx_covariance_f32(src_f32, CH, SAMPLES, 0.0f, cov_f32));
+  memset(ref_f64, 0, sizeof(ref_f64));
+  ref_cov_f64(src_f32, CH, 1, 0.0, ref_f64);
+  ok = same_f32(cov_f32, ref_f64, 2 * CH * CH);
+  for (k = 0; k < 2 * CH * CH; k++)
+    ok &= (fabsf(cov_f32[k] - base_f32[k]) < 1e-3f);
+  riscv_cmplx_covariance_f32(src_f32, CH, SAMPLES, (float32_t) LAMBDA, cov_f32);
+  ref_cov_f64(src_f32, CH, 1, LAMBDA, ref_f64);
+  okLambda = same_f32(cov_f32, ref_f64, 2 * CH * CH);
+  riscv_cmplx_covariance_f32(src_f32, CH_ODD, SAMPLES, 0.0f, cov_f32);
+  memset(ref_f64, 0, sizeof(ref_f64));
+  ref_cov_f64(src_f32, CH_ODD, 1, 0.0, ref_f64);
+  okOdd = same_f32(cov_f32, ref_f64, 2 * CH_ODD * CH_ODD);
+  printf("CHECK riscv_cmplx_covariance_f32: %s, odd channels %s, forgetting %s\n", ok ? "ok" : "bad",
+         okOdd ? "ok" : "bad", okLambda ? "ok" : "bad");
+  fail |= !ok | !okOdd | !okLambda;
+
+/*Complex Q15 and Q31*/
+  RISCV_BENCH("riscv_cmplx_covariance_q15", "q15", SAMPLES,
+    riscv_cmplx_covariance_q15(src_q15, CH, SAMPLES, 0, cov_q63));
+  for (i = 0; i < 2 * CH * SAMPLES; i++)
+    wide[i] = src_q15[i];
+  ref_cov_int(wide, CH, 1, 0, 0, 15, ref_q63);
+  ok = (memcmp(cov_q63, ref_q63, 2 * CH * CH * sizeof(q63_t)) == 0);
+  riscv_cmplx_covariance_q15(src_q15, CH, SAMPLES, (q15_t)(LAMBDA * 32768.0), cov_q63);
+  ref_cov_int(wide, CH, 1, 0, (q15_t)(LAMBDA * 32768.0), 15, ref_q63);
+  okLambda = (memcmp(cov_q63, ref_q63, 2 * CH * CH * sizeof(q63_t)) == 0);
+  riscv_cmplx_covariance_q15(src_q15, CH_ODD, SAMPLES, 0, cov_q63);
+  ref_cov_int(wide, CH_ODD, 1, 0, 0, 15, ref_q63);
+  okOdd = (memcmp(cov_q63, ref_q63, 2 * CH_ODD * CH_ODD * sizeof(q63_t)) == 0);
+  printf("CHECK riscv_cmplx_covariance_q15: %s, odd channels %s, forgetting %s\n", ok ? "ok" : "bad",
+         okOdd ? "ok" : "bad", okLambda ? "ok" : "bad");
+  fail |= !ok | !okOdd | !okLambda;
+
+  RISCV_BENCH("riscv_cmplx_covariance_q31", "q31", SAMPLES,
+    riscv_cmplx_covariance_q31(src_q31, CH, SAMPLES, 0, cov_q63));
+  ref_cov_int(src_q31, CH, 1, 14, 0, 31, ref_q63);
+  ok = (memcmp(cov_q63, ref_q63, 2 * CH * CH * sizeof(q63_t)) == 0);
+  riscv_cmplx_covariance_q31(src_q31, CH, SAMPLES, (q31_t)(LAMBDA * 2147483648.0), cov_q63);
+  ref_cov_int(src_q31, CH, 1, 14, (q31_t)(LAMBDA * 2147483648.0), 31, ref_q63);
+  riscv_cmplx_covariance_q31(src_q31, CH, SAMPLES, 0x7FFFFFFF, cov_q63);
+  ref_cov_int(src_q31, CH, 1, 14, 0x7FFFFFFF, 31, ref_q63);
+  okLambda = (memcmp(cov_q63, ref_q63, 2 * CH * CH * sizeof(q63_t)) == 0);
+  riscv_cmplx_covariance_q31(src_q31, CH_ODD, SAMPLES, 0, cov_q63);
+  ref_cov_int(src_q31, CH_ODD, 1, 14, 0, 31, ref_q63);
+  okOdd = (memcmp(cov_q63, ref_q63, 2 * CH_ODD * CH_ODD * sizeof(q63_t)) == 0);
+  printf("CHECK riscv_cmplx_covariance_q31: %s, odd channels %s, forgetting %s\n", ok ? "ok" : "bad",
+         okOdd ? "ok" : "bad", okLambda ? "ok" : "bad");
+  fail |= !ok | !okOdd | !okLambda;
+
+#ifdef PRINT_OUTPUT
+  for (i = 0; i < CH; i++)
+  {
+    for (j = 0; j < CH; j++)
+      printf("%d ", (int)(cov_q63[i * CH + j] >> 30));
+    printf("\n");
+  }
+#endif
+
+  printf("End\n");
+
+  return (fail);
+}
@@ -0,0 +1,193 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_BINS 257
+#define BLOCK_SIZE 512
+#define NUM_LENGTHS 6
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_spectral_features_f32() runs on random spectra of 1, 63, 64, 65, 200 and NUM_BINS bins and
+must match one C loop per feature: the centroid and spread to a relative 1e-4, the rolloff at 85%
+and the flux exactly, with the previous spectrum replaced and the fields that are not selected left
+alone.  The zero crossings and energies of 1 to 40 and BLOCK_SIZE random Q15 and floating-point
+samples, with zeros and runs of one sign, must match a C loop and riscv_power_q15().  The benchmarks
+measure the fused functions next to the loops they replace.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "StatisticsFunctions5"
+#include "../common/riscv_bench.h"
+
+float32_t spec[NUM_BINS], prev[NUM_BINS], prevRef[NUM_BINS];
+q15_t src_q15[BLOCK_SIZE] __attribute__((aligned(4)));
+float32_t src_f32[BLOCK_SIZE];
+
+static uint32_t seed = 148u;
+
+static uint32_t next_rand(void)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return seed;
+}
+
+/* The features of pSpec one loop at a time, as a classifier computes them */
+static void features_loops(const float32_t * pSpec, float32_t * pPrev, uint32_t numBins, riscv_spectral_result_f32 * pRes)
+{
+  float32_t sum = 0.0f, sumK = 0.0f, sumK2 = 0.0f, run = 0.0f, d, flux = 0.0f;
+  uint32_t k;
+
+  for (k = 0u; k < numBins; k++)
+  {
+    sum += pSpec[k];
+    sumK += (float32_t) k * pSpec[k];
+  }
+  pRes->sum = sum;
+  pRes->centroid = (sum > 0.0f) ? (sumK / sum) : 0.0f;
+
+  for (k = 0u; k < numBins; k++)
+  {
+    d = (float32_t) k - pRes->centroid;
+    sumK2 += d * d * pSpec[k];
+  }
+  pRes->spread = (sum > 0.0f) ? sqrtf(sumK2 / sum) : 0.0f;
+
+  pRes->rolloff = 0u;
+  for (k = 0u; (k < numBins) && (sum > 0.0f); k++)
+  {
+    run += pSpec[k];
+    if(run >= 0.85f * sum)
+    {
+      pRes->rolloff = k;
+      break;
+    }
+  }
+
+  for (k = 0u; k < numBins; k++)
+  {
+    d = pSpec[k] - pPrev[k];
+    flux += d * d;
+    pPrev[k] = pSpec[k];
+  }
+  pRes->flux = flux;
+}
+
+static uint32_t crossings_loop_q15(const q15_t * pSrc, uint32_t blockSize)
+{
+  uint32_t n, count = 0u;
+
+  for (n = 1u; n < blockSize; n++)
+  {
+    count += ((pSrc[n] < 0) != (pSrc[n - 1u] < 0));
+  }
+
+  return count;
+}
+
+static int32_t close_to(float32_t a, float32_t b)
+{
+  return (fabsf(a - b) <= 1e-4f * fmaxf(fabsf(b), 1.0f));
+}
+
+int main(void)
+{
+  const uint32_t lengths[NUM_LENGTHS] = { 1, 63, 64, 65, 200, NUM_BINS };
+  riscv_spectral_result_f32 res, ref;
+  uint32_t n, i, len, count;
+  int32_t fail = 0, ok;
+  q63_t energy, power;
+  float32_t energy_f32, ref_f32;
+
+  riscv_bench_header();
+
+  /* Spectral features */
+  ok = 1;
+  for (i = 0u; i < NUM_LENGTHS; i++)
+  {
+    len = lengths[i];
+    for (n = 0u; n < len; n++)
+    {
+      spec[n] = (float32_t) (next_rand() >> 8) / 16777216.0f;
+      prev[n] = prevRef[n] = (float32_t) (next_rand() >> 8) / 16777216.0f;
+    }
+    spec[len / 3u] = 50.0f;
+
+    features_loops(spec, prevRef, len, &ref);
+    riscv_spectral_features_f32(spec, prev, len, 0.85f, RISCV_SPECTRAL_ALL, &res);
+    ok = ok && close_to(res.centroid, ref.centroid) && close_to(res.spread, ref.spread);
+    ok = ok && (res.rolloff == ref.rolloff) && close_to(res.flux, ref.flux) && close_to(res.sum, ref.sum);
+    ok = ok && (memcmp(prev, prevRef, len * sizeof(float32_t)) == 0);
+  }
+
+  /* Only the centroid, the previous spectrum stays */
+  memset(&res, 0xFF, sizeof(res));
+  memcpy(prevRef, prev, sizeof(prev));
+  spec[0] += 1.0f;
+  riscv_spectral_features_f32(spec, prev, NUM_BINS, 0.85f, RISCV_SPECTRAL_CENTROID, &res);
+  ok = ok && (res.rolloff == 0xFFFFFFFFu) && isnan(res.flux) && isnan(res.spread) && !isnan(res.centroid);
+  ok = ok && (memcmp(prev, prevRef, sizeof(prev)) == 0);
+
+  /* Silence */
+  memset(spec, 0, sizeof(spec));
+  riscv_spectral_features_f32(spec, prev, NUM_BINS, 0.85f, RISCV_SPECTRAL_ALL, &res);
+  ok = ok && (res.centroid == 0.0f) && (res.spread == 0.0f) && (res.rolloff == 0u) && (res.sum == 0.0f);
+  printf("CHECK spectral features %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Zero crossings: runs of one sign, zeros and the limits */
+  for (n = 0u; n < BLOCK_SIZE; n++)
+  {
+    src_q15[n] = (q15_t) (next_rand() >> 16);
+    if((n % 7u) < 3u)
+    {
+      src_q15[n] = (q15_t) (src_q15[n] & 0x7FFF);
+    }
+  }
+  src_q15[10] = 0;
+  src_q15[11] = -1;
+  src_q15[20] = -32768;
+  src_q15[23] = 32767;
+  src_q15[31] = 0;
+  for (n = 0u; n < BLOCK_SIZE; n++)
+  {
+    src_f32[n] = (float32_t) src_q15[n] / 32768.0f;
+  }
+
+  ok = 1;
+  for (len = 1u; len <= BLOCK_SIZE; len = (len < 40u) ? (len + 1u) : BLOCK_SIZE + 1u)
+  {
+    riscv_zcr_energy_q15(src_q15, len, &count, &energy);
+    riscv_power_q15(src_q15, len, &power);
+    ok = ok && (count == crossings_loop_q15(src_q15, len)) && (energy == power);
+
+    riscv_zcr_energy_f32(src_f32, len, &count, &energy_f32);
+    ref_f32 = 0.0f;
+    for (n = 0u; n < len; n++)
+    {
+      ref_f32 += src_f32[n] * src_f32[n];
+    }
+    ok = ok && (count == crossings_loop_q15(src_q15, len)) && close_to(energy_f32, ref_f32);
+  }
+  printf("CHECK zero crossings %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  for (n = 0u; n < NUM_BINS; n++)
+  {
+    spec[n] = (float32_t) (next_rand() >> 8) / 16777216.0f;
+  }
+  RISCV_BENCH("riscv_spectral_features_f32", "f32", NUM_BINS, riscv_spectral_features_f32(spec, prev, NUM_BINS, 0.85f, RISCV_SPECTRAL_ALL, &res));
+  RISCV_BENCH("features_loops_f32", "f32", NUM_BINS, features_loops(spec, prevRef, NUM_BINS, &ref));
+  RISCV_BENCH("riscv_zcr_energy_q15", "q15", BLOCK_SIZE, riscv_zcr_energy_q15(src_q15, BLOCK_SIZE, &count, &energy));
+  RISCV_BENCH("zcr_loop_power_q15", "q15", BLOCK_SIZE, count = crossings_loop_q15(src_q15, BLOCK_SIZE); riscv_power_q15(src_q15, BLOCK_SIZE, &power));
+  RISCV_BENCH("riscv_zcr_energy_f32", "f32", BLOCK_SIZE, riscv_zcr_energy_f32(src_f32, BLOCK_SIZE, &count, &energy_f32));
+
+  return (fail);
+}
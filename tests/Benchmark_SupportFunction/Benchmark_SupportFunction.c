@@ -6,7 +6,6 @@
 #include "bar.h"
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 
 
 #define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < Y; i++) printf("%d  ",(int)(X[i])); \
@@ -17,31 +16,14 @@ printf("\n\n")
 #define MAX_BLOCKSIZE     32
 
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-
-
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
 *Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "SupportFunction"
+#include "../common/riscv_bench.h"
  float32_t src_buf_f32[MAX_BLOCKSIZE] =
 {
   -0.4325648115282207,  -1.6655843782380970,  0.1253323064748307,
@@ -114,105 +96,224 @@ q7_t result_q7[MAX_BLOCKSIZE] = {0};
 q15_t result_q15[MAX_BLOCKSIZE] = {0};
 q31_t result_q31[MAX_BLOCKSIZE] = {0};
 
+/* Channel blocks */
+float32_t planar_f32[MAX_BLOCKSIZE];
+q7_t planar_q7[MAX_BLOCKSIZE];
+q15_t planar_q15[MAX_BLOCKSIZE];
+q31_t planar_q31[MAX_BLOCKSIZE];
+riscv_bfp_q15 bfp_q15 = { result_q15, MAX_BLOCKSIZE, 0 };
+riscv_bfp_q31 bfp_q31 = { result_q31, MAX_BLOCKSIZE, 0 };
+
+/* Sort positions and radix sort scratch */
+uint16_t sort_index[MAX_BLOCKSIZE];
+uint32_t sort_scratch[MAX_BLOCKSIZE];
+
+/* Ring buffer of two blocks */
+q15_t ring_mem_q15[2 * MAX_BLOCKSIZE];
+riscv_ringbuf_instance ring_q15;
+void *ring_span;
+
 
 int32_t main(void)
 {
+  riscv_bench_header();
  /*Init*/ 
 /*Tests*/
 
 /*Copy*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_copy_f32(src_buf_f32,result_f32, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_copy_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_copy_f32", "f32", MAX_BLOCKSIZE,
+    riscv_copy_f32(src_buf_f32,result_f32, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_copy_q7(src_buf_q7,result_q7, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_copy_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_copy_q7", "q7", MAX_BLOCKSIZE,
+    riscv_copy_q7(src_buf_q7,result_q7, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
 #endif  
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_copy_q15(src_buf_q15,result_q15, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_copy_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_copy_q15", "q15", MAX_BLOCKSIZE,
+    riscv_copy_q15(src_buf_q15,result_q15, MAX_BLOCKSIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q15,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_copy_q31", "q31", MAX_BLOCKSIZE,
+    riscv_copy_q31(src_buf_q31,result_q31, MAX_BLOCKSIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q31,MAX_BLOCKSIZE);
+#endif
+
+/*Interleave*/
+
+  /* Stereo frames, channel blocks of MAX_BLOCKSIZE/2 samples, and back */
+  RISCV_BENCH("riscv_deinterleave_f32(2)", "f32", MAX_BLOCKSIZE,
+    riscv_deinterleave_f32(src_buf_f32, 2, planar_f32, MAX_BLOCKSIZE / 2));
+  RISCV_BENCH("riscv_interleave_f32(2)", "f32", MAX_BLOCKSIZE,
+    riscv_interleave_f32(planar_f32, 2, result_f32, MAX_BLOCKSIZE / 2));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(planar_f32,MAX_BLOCKSIZE);
+  PRINT_F32(result_f32,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_deinterleave_q7(2)", "q7", MAX_BLOCKSIZE,
+    riscv_deinterleave_q7(src_buf_q7, 2, planar_q7, MAX_BLOCKSIZE / 2));
+  RISCV_BENCH("riscv_interleave_q7(2)", "q7", MAX_BLOCKSIZE,
+    riscv_interleave_q7(planar_q7, 2, result_q7, MAX_BLOCKSIZE / 2));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(planar_q7,MAX_BLOCKSIZE);
+  PRINT_Q(result_q7,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_deinterleave_q15(2)", "q15", MAX_BLOCKSIZE,
+    riscv_deinterleave_q15(src_buf_q15, 2, planar_q15, MAX_BLOCKSIZE / 2));
+  RISCV_BENCH("riscv_interleave_q15(2)", "q15", MAX_BLOCKSIZE,
+    riscv_interleave_q15(planar_q15, 2, result_q15, MAX_BLOCKSIZE / 2));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(planar_q15,MAX_BLOCKSIZE);
+  PRINT_Q(result_q15,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_deinterleave_q31(2)", "q31", MAX_BLOCKSIZE,
+    riscv_deinterleave_q31(src_buf_q31, 2, planar_q31, MAX_BLOCKSIZE / 2));
+  RISCV_BENCH("riscv_interleave_q31(2)", "q31", MAX_BLOCKSIZE,
+    riscv_interleave_q31(planar_q31, 2, result_q31, MAX_BLOCKSIZE / 2));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(planar_q31,MAX_BLOCKSIZE);
+  PRINT_Q(result_q31,MAX_BLOCKSIZE);
+#endif
+  /* Four channels */
+  RISCV_BENCH("riscv_deinterleave_q7(4)", "q7", MAX_BLOCKSIZE,
+    riscv_deinterleave_q7(src_buf_q7, 4, planar_q7, MAX_BLOCKSIZE / 4));
+  RISCV_BENCH("riscv_interleave_q7(4)", "q7", MAX_BLOCKSIZE,
+    riscv_interleave_q7(planar_q7, 4, result_q7, MAX_BLOCKSIZE / 4));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(planar_q7,MAX_BLOCKSIZE);
+  PRINT_Q(result_q7,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_deinterleave_q15(4)", "q15", MAX_BLOCKSIZE,
+    riscv_deinterleave_q15(src_buf_q15, 4, planar_q15, MAX_BLOCKSIZE / 4));
+  RISCV_BENCH("riscv_interleave_q15(4)", "q15", MAX_BLOCKSIZE,
+    riscv_interleave_q15(planar_q15, 4, result_q15, MAX_BLOCKSIZE / 4));
 #ifdef PRINT_OUTPUT
+  PRINT_Q(planar_q15,MAX_BLOCKSIZE);
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_copy_q31(src_buf_q31,result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_copy_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+
+/*Block floating-point*/
+
+  /* Inputs scaled down by 16, the first run normalizes them back */
+  riscv_shift_q15(src_buf_q15, -4, result_q15, MAX_BLOCKSIZE);
+  RISCV_BENCH("riscv_bfp_normalize_q15", "q15", MAX_BLOCKSIZE,
+    riscv_bfp_normalize_q15(&bfp_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q15,MAX_BLOCKSIZE);
+  printf("exponent %d\n", bfp_q15.exponent);
+#endif
+  riscv_shift_q31(src_buf_q31, -4, result_q31, MAX_BLOCKSIZE);
+  RISCV_BENCH("riscv_bfp_normalize_q31", "q31", MAX_BLOCKSIZE,
+    riscv_bfp_normalize_q31(&bfp_q31));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
+  printf("exponent %d\n", bfp_q31.exponent);
+#endif
+  RISCV_BENCH("riscv_bfp_denormalize_q15", "q15", MAX_BLOCKSIZE,
+    riscv_bfp_denormalize_q15(&bfp_q15, planar_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(planar_q15,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_bfp_denormalize_q31", "q31", MAX_BLOCKSIZE,
+    riscv_bfp_denormalize_q31(&bfp_q31, planar_q31));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(planar_q31,MAX_BLOCKSIZE);
+#endif
+
+/*Sort*/
+
+  RISCV_BENCH("riscv_sort_f32", "f32", MAX_BLOCKSIZE,
+    riscv_sort_f32(src_buf_f32, result_f32, sort_index, MAX_BLOCKSIZE, RISCV_SORT_ASCENDING));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(result_f32,MAX_BLOCKSIZE);
+  PRINT_Q(sort_index,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_sort_q7", "q7", MAX_BLOCKSIZE,
+    riscv_sort_q7(src_buf_q7, result_q7, sort_index, MAX_BLOCKSIZE, RISCV_SORT_DESCENDING));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q7,MAX_BLOCKSIZE);
+  PRINT_Q(sort_index,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_sort_q15", "q15", MAX_BLOCKSIZE,
+    riscv_sort_q15(src_buf_q15, result_q15, sort_index, sort_scratch, MAX_BLOCKSIZE, RISCV_SORT_ASCENDING));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q15,MAX_BLOCKSIZE);
+  PRINT_Q(sort_index,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_topk_f32(4)", "f32", MAX_BLOCKSIZE,
+    riscv_topk_f32(src_buf_f32, MAX_BLOCKSIZE, 4, result_f32, sort_index));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(result_f32,4);
+  PRINT_Q(sort_index,4);
+#endif
+  RISCV_BENCH("riscv_topk_q15(4)", "q15", MAX_BLOCKSIZE,
+    riscv_topk_q15(src_buf_q15, MAX_BLOCKSIZE, 4, result_q15, sort_index));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q15,4);
+  PRINT_Q(sort_index,4);
+#endif
+
+/*Ring buffer*/
+
+  /* Start off a block boundary, so that every block wraps */
+  riscv_ringbuf_init(&ring_q15, ring_mem_q15, 2 * MAX_BLOCKSIZE, sizeof(q15_t));
+  riscv_ringbuf_write(&ring_q15, src_buf_q15, 20);
+  riscv_ringbuf_read(&ring_q15, result_q15, 20);
+
+  RISCV_BENCH("riscv_ringbuf_write+read", "q15", MAX_BLOCKSIZE,
+    riscv_ringbuf_write(&ring_q15, src_buf_q15, MAX_BLOCKSIZE);
+    riscv_ringbuf_read(&ring_q15, result_q15, MAX_BLOCKSIZE));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q15,MAX_BLOCKSIZE);
+#endif
+  RISCV_BENCH("riscv_ringbuf_span+commit", "q15", MAX_BLOCKSIZE,
+    riscv_ringbuf_write_commit(&ring_q15, riscv_ringbuf_write_span(&ring_q15, &ring_span));
+    riscv_ringbuf_read_commit(&ring_q15, riscv_ringbuf_read_span(&ring_q15, &ring_span)));
+#ifdef PRINT_OUTPUT
+  printf("%u\n", (unsigned int) riscv_ringbuf_count(&ring_q15));
 #endif
 
 /*Fill*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_fill_f32(val_f32,result_f32, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fill_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fill_f32", "f32", MAX_BLOCKSIZE,
+    riscv_fill_f32(val_f32,result_f32, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_fill_q7(val_q7,result_q7, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fill_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fill_q7", "q7", MAX_BLOCKSIZE,
+    riscv_fill_q7(val_q7,result_q7, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
 #endif  
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_fill_q15(val_q15,result_q15, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fill_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fill_q15", "q15", MAX_BLOCKSIZE,
+    riscv_fill_q15(val_q15,result_q15, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_fill_q31(val_q31,result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_fill_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_fill_q31", "q31", MAX_BLOCKSIZE,
+    riscv_fill_q31(val_q31,result_q31, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
 
 /*convert float*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_float_to_q7(src_buf_f32,result_q7, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_float_to_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_float_to_q7", "f32", MAX_BLOCKSIZE,
+    riscv_float_to_q7(src_buf_f32,result_q7, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_float_to_q15(src_buf_f32,result_q15, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_float_to_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_float_to_q15", "f32", MAX_BLOCKSIZE,
+    riscv_float_to_q15(src_buf_f32,result_q15, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif  
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_float_to_q31(src_buf_f32,result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_float_to_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_float_to_q31", "f32", MAX_BLOCKSIZE,
+    riscv_float_to_q31(src_buf_f32,result_q31, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
@@ -220,27 +321,18 @@ int32_t main(void)
 
 /*convert q7*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_q7_to_float(src_buf_q7,result_f32, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_q7_to_float: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_q7_to_float", "q7", MAX_BLOCKSIZE,
+    riscv_q7_to_float(src_buf_q7,result_f32, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_q7_to_q15(src_buf_q7,result_q15, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_q7_to_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_q7_to_q15", "q7", MAX_BLOCKSIZE,
+    riscv_q7_to_q15(src_buf_q7,result_q15, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif  
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_q7_to_q31(src_buf_q7,result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_q7_to_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_q7_to_q31", "q7", MAX_BLOCKSIZE,
+    riscv_q7_to_q31(src_buf_q7,result_q31, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
@@ -248,27 +340,18 @@ int32_t main(void)
 
 /*convert q15*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_q15_to_float(src_buf_q15,result_f32, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_q15_to_float: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_q15_to_float", "q15", MAX_BLOCKSIZE,
+    riscv_q15_to_float(src_buf_q15,result_f32, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_q15_to_q7(src_buf_q15,result_q7, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_q15_to_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_q15_to_q7", "q15", MAX_BLOCKSIZE,
+    riscv_q15_to_q7(src_buf_q15,result_q7, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
 #endif  
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_q15_to_q31(src_buf_q15,result_q31, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_q15_to_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_q15_to_q31", "q15", MAX_BLOCKSIZE,
+    riscv_q15_to_q31(src_buf_q15,result_q31, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,MAX_BLOCKSIZE);
 #endif
@@ -277,27 +360,18 @@ int32_t main(void)
 
 /*convert q31*/
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_q31_to_float(src_buf_q31,result_f32, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_q31_to_float: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_q31_to_float", "q31", MAX_BLOCKSIZE,
+    riscv_q31_to_float(src_buf_q31,result_f32, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,MAX_BLOCKSIZE);
 #endif
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_q31_to_q7(src_buf_q31,result_q7, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_q31_to_q7: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_q31_to_q7", "q31", MAX_BLOCKSIZE,
+    riscv_q31_to_q7(src_buf_q31,result_q7, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q7,MAX_BLOCKSIZE);
 #endif  
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_q31_to_q15(src_buf_q31,result_q15, MAX_BLOCKSIZE);
-  perf_stop();
-  printf("riscv_q31_to_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));	
+  RISCV_BENCH("riscv_q31_to_q15", "q31", MAX_BLOCKSIZE,
+    riscv_q31_to_q15(src_buf_q31,result_q15, MAX_BLOCKSIZE));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q15,MAX_BLOCKSIZE);
 #endif
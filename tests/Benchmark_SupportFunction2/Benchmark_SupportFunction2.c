@@ -0,0 +1,97 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 32
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*With RISCV_DSP_SAT_STATS (CMake option of the same name) the saturating kernels count the values they
+clip: riscv_add_q15() on inputs of which 8 sums overflow, riscv_scale_q15() without overflow and
+riscv_shift_q31() by 4 bits on inputs of 2 to 5 bits of headroom must report the expected counts and
+headroom, printed as SATSTATS lines.  Without it the table must stay empty.  The CHECK lines must
+report ok.
+*/
+#define RISCV_BENCH_SUITE "SupportFunction2"
+#include "../common/riscv_bench.h"
+
+q15_t srcA_q15[BLOCK_SIZE], srcB_q15[BLOCK_SIZE], dst_q15[BLOCK_SIZE];
+q31_t src_q31[BLOCK_SIZE], dst_q31[BLOCK_SIZE];
+
+static void print_entry(void * ctx, const riscv_sat_stats_entry * e)
+{
+  (void) ctx;
+  printf("SATSTATS,%s,%d,%d,%d,%d\n", e->name, (int) e->calls, (int) e->values, (int) e->saturations,
+         (int) riscv_sat_stats_headroom(e));
+}
+
+static const riscv_sat_stats_entry * find_entry(const char * name)
+{
+  const riscv_sat_stats_entry *e;
+  uint32_t id;
+
+  for (id = 1u; (e = riscv_sat_stats_get(id)) != NULL; id++)
+  {
+    if(strcmp(e->name, name) == 0)
+    {
+      return (e);
+    }
+  }
+
+  return (NULL);
+}
+
+int main(void)
+{
+  const riscv_sat_stats_entry *add, *scale, *shift;
+  uint32_t n;
+  int32_t fail = 0, ok;
+
+  riscv_bench_header();
+
+  /* Sums of 0x6000 and 0x3000 overflow in the first 8 pairs */
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    srcA_q15[n] = (n < 8u) ? 0x6000 : 0x1000;
+    srcB_q15[n] = (n < 8u) ? 0x3000 : -0x0800;
+    src_q31[n] = (q31_t) (0x01000000 << (n & 3u));
+  }
+
+  RISCV_BENCH("riscv_add_q15", "q15", BLOCK_SIZE, riscv_add_q15(srcA_q15, srcB_q15, dst_q15, BLOCK_SIZE));
+
+  riscv_sat_stats_reset();
+  riscv_add_q15(srcA_q15, srcB_q15, dst_q15, BLOCK_SIZE);
+  riscv_scale_q15(srcA_q15, 0x4000, 0, dst_q15, BLOCK_SIZE);
+  riscv_shift_q31(src_q31, 4, dst_q31, BLOCK_SIZE);
+  riscv_sat_stats_dump(print_entry, NULL);
+
+  add = find_entry("riscv_add_q15");
+  scale = find_entry("riscv_scale_q15");
+  shift = find_entry("riscv_shift_q31");
+
+#if defined (RISCV_DSP_SAT_STATS)
+  /* 0x9000 is 16 bits, 1 bit over; 0x3000 has 1 bit of headroom; 0x08000000 << 4 is 32 bits */
+  ok = (add != NULL) && (add->calls == 1u) && (add->values == BLOCK_SIZE) && (add->saturations == 8u) &&
+       (riscv_sat_stats_headroom(add) == -1);
+  ok = ok && (scale != NULL) && (scale->saturations == 0u) && (riscv_sat_stats_headroom(scale) == 1);
+  ok = ok && (shift != NULL) && (shift->saturations == 8u) && (riscv_sat_stats_headroom(shift) == -1);
+  printf("CHECK riscv_sat_stats: add %d/%d, scale %d, shift %d %s\n", add ? (int) add->saturations : -1,
+         add ? (int) add->values : -1, scale ? (int) scale->saturations : -1,
+         shift ? (int) shift->saturations : -1, ok ? "ok" : "bad");
+#else
+  ok = (add == NULL) && (scale == NULL) && (shift == NULL);
+  printf("CHECK riscv_sat_stats: disabled, no records %s\n", ok ? "ok" : "bad");
+#endif
+  fail |= !ok;
+
+  return (fail);
+}
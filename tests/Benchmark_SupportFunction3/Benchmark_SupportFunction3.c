@@ -0,0 +1,268 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define FRAME_SIZE 512
+#define NUM_FRAMES 4
+#define CHUNK 64
+#define DECIMATION 4
+#define NUM_TAPS 32
+#define FFT_SIZE (FRAME_SIZE / DECIMATION)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The graph riscv_fir_decimate_q15() on chunks of 64 samples, riscv_rfft_q15() of 128 points,
+riscv_cmplx_mag_q15() and riscv_max_q15() is run by riscv_sdf_run() and by riscv_sdf_run_par() on 2 and
+3 stages, and compared with the same kernels chained by hand over whole frames.  The repetition vector
+and the edge capacities of riscv_sdf_init(), a 3:2 rate graph and a graph without a periodic schedule
+are checked as well.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "SupportFunction3"
+#include "../common/riscv_bench.h"
+
+typedef struct
+{
+  riscv_fir_decimate_instance_q15 S;
+  q15_t state[NUM_TAPS + CHUNK];
+  q15_t *pSrc;
+} decimate_node;
+
+typedef struct
+{
+  q15_t peak[NUM_FRAMES];
+  uint32_t index[NUM_FRAMES];
+  uint32_t count;
+} max_node;
+
+typedef struct
+{
+  int32_t next;
+  int32_t log[16];
+  uint32_t count;
+} count_node;
+
+q15_t input_q15[NUM_FRAMES * FRAME_SIZE];
+q15_t coeffs_q15[NUM_TAPS];
+q15_t frame_q15[FFT_SIZE];
+q15_t spectrum_q15[2 * FFT_SIZE];
+q15_t mag_q15[FFT_SIZE];
+q15_t refState_q15[NUM_TAPS + FRAME_SIZE];
+uint64_t arena_mem[2048];
+
+riscv_rfft_instance_q15 rfft;
+decimate_node decimate;
+max_node sink;
+count_node counter;
+
+static void decimate_fire(void * arg, const void * const * pIn, void * const * pOut)
+{
+  decimate_node *d = (decimate_node *) arg;
+
+  (void) pIn;
+  riscv_fir_decimate_q15(&d->S, d->pSrc, (q15_t *) pOut[0], CHUNK);
+  d->pSrc += CHUNK;
+}
+
+static void rfft_fire(void * arg, const void * const * pIn, void * const * pOut)
+{
+  /* the FFT works in place on its input, which the edge gives up after the firing */
+  riscv_rfft_q15((const riscv_rfft_instance_q15 *) arg, (q15_t *) pIn[0], (q15_t *) pOut[0]);
+}
+
+static void mag_fire(void * arg, const void * const * pIn, void * const * pOut)
+{
+  (void) arg;
+  riscv_cmplx_mag_q15((q15_t *) pIn[0], (q15_t *) pOut[0], FFT_SIZE);
+}
+
+static void max_fire(void * arg, const void * const * pIn, void * const * pOut)
+{
+  max_node *m = (max_node *) arg;
+
+  (void) pOut;
+  riscv_max_q15((q15_t *) pIn[0], FFT_SIZE, &m->peak[m->count % NUM_FRAMES], &m->index[m->count % NUM_FRAMES]);
+  m->count++;
+}
+
+static void produce_fire(void * arg, const void * const * pIn, void * const * pOut)
+{
+  count_node *c = (count_node *) arg;
+  int32_t *pDst = (int32_t *) pOut[0];
+  uint32_t k;
+
+  (void) pIn;
+  for (k = 0u; k < 3u; k++)
+  {
+    pDst[k] = c->next++;
+  }
+}
+
+static void consume_fire(void * arg, const void * const * pIn, void * const * pOut)
+{
+  count_node *c = (count_node *) arg;
+  const int32_t *pSrc = (const int32_t *) pIn[0];
+
+  (void) pOut;
+  c->log[c->count++ & 15u] = pSrc[0];
+  c->log[c->count++ & 15u] = pSrc[1];
+}
+
+static void noop_fire(void * arg, const void * const * pIn, void * const * pOut)
+{
+  (void) arg;
+  (void) pIn;
+  (void) pOut;
+}
+
+const riscv_sdf_node chain_nodes[4] =
+{
+  { decimate_fire, &decimate, 100u },
+  { rfft_fire, &rfft, 2000u },
+  { mag_fire, NULL, 300u },
+  { max_fire, &sink, 100u }
+};
+
+const riscv_sdf_edge chain_edges[3] =
+{
+  { 0u, 1u, CHUNK / DECIMATION, FFT_SIZE, sizeof(q15_t) },
+  { 1u, 2u, 2u * FFT_SIZE, 2u * FFT_SIZE, sizeof(q15_t) },
+  { 2u, 3u, FFT_SIZE, FFT_SIZE, sizeof(q15_t) }
+};
+
+static void chain_reset(void)
+{
+  riscv_fir_decimate_init_q15(&decimate.S, NUM_TAPS, DECIMATION, coeffs_q15, decimate.state, CHUNK);
+  decimate.pSrc = input_q15;
+  memset(&sink, 0, sizeof(sink));
+}
+
+static void chain_period(riscv_sdf_instance * G)
+{
+  decimate.pSrc = input_q15;
+  riscv_sdf_run(G, 1u);
+}
+
+int main(void)
+{
+  riscv_fir_decimate_instance_q15 ref;
+  riscv_sdf_instance G;
+  riscv_par_instance P;
+  riscv_dsp_arena arena;
+  riscv_sdf_node pair_nodes[2] = { { produce_fire, &counter, 0u }, { consume_fire, &counter, 0u } };
+  riscv_sdf_edge pair_edge = { 0u, 1u, 3u, 2u, sizeof(int32_t) };
+  riscv_sdf_node bad_nodes[3] = { { noop_fire, NULL, 0u }, { noop_fire, NULL, 0u }, { noop_fire, NULL, 0u } };
+  riscv_sdf_edge bad_edges[3] = { { 0u, 1u, 1u, 1u, 1u }, { 1u, 2u, 1u, 1u, 1u }, { 0u, 2u, 2u, 1u, 1u } };
+  q15_t refPeak[NUM_FRAMES];
+  uint32_t refIndex[NUM_FRAMES];
+  uint32_t n, f, stages;
+  int32_t fail = 0, ok;
+  riscv_status status;
+
+  riscv_bench_header();
+
+  srand(7);
+  for (n = 0; n < NUM_FRAMES * FRAME_SIZE; n++)
+  {
+    input_q15[n] = (q15_t) ((rand() % 0x4000) - 0x2000) + (q15_t) (0x3000 * sin(0.3 * n));
+  }
+
+  for (n = 0; n < NUM_TAPS; n++)
+  {
+    coeffs_q15[n] = (q15_t) (0x0800 * (1.0 - cos(2.0 * M_PI * (n + 1) / (NUM_TAPS + 1))));
+  }
+
+  riscv_rfft_init_q15(&rfft, FFT_SIZE, 0, 1);
+
+  /* the kernels chained by hand, one whole frame per stage */
+  riscv_fir_decimate_init_q15(&ref, NUM_TAPS, DECIMATION, coeffs_q15, refState_q15, FRAME_SIZE);
+  for (f = 0; f < NUM_FRAMES; f++)
+  {
+    riscv_fir_decimate_q15(&ref, &input_q15[f * FRAME_SIZE], frame_q15, FRAME_SIZE);
+    riscv_rfft_q15(&rfft, frame_q15, spectrum_q15);
+    riscv_cmplx_mag_q15(spectrum_q15, mag_q15, FFT_SIZE);
+    riscv_max_q15(mag_q15, FFT_SIZE, &refPeak[f], &refIndex[f]);
+  }
+
+  riscv_dsp_arena_init(&arena, arena_mem, sizeof(arena_mem));
+  status = riscv_sdf_init(&G, chain_nodes, 4u, chain_edges, 3u, 1u, &arena);
+  ok = (status == RISCV_MATH_SUCCESS) && (G.pRepeat[0] == 8u) && (G.pRepeat[1] == 1u) &&
+       (G.pRepeat[2] == 1u) && (G.pRepeat[3] == 1u) && (G.pFifo[0].capacity == FFT_SIZE) &&
+       (G.pFifo[1].capacity == 2u * FFT_SIZE) && (G.pFifo[2].capacity == FFT_SIZE);
+  printf("CHECK riscv_sdf_init: repeat %d %d %d %d, capacity %d %d %d, arena %d bytes %s\n",
+         (int) G.pRepeat[0], (int) G.pRepeat[1], (int) G.pRepeat[2], (int) G.pRepeat[3],
+         (int) G.pFifo[0].capacity, (int) G.pFifo[1].capacity, (int) G.pFifo[2].capacity,
+         (int) riscv_dsp_arena_usage(&arena), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  chain_reset();
+  riscv_sdf_run(&G, NUM_FRAMES);
+  ok = (sink.count == NUM_FRAMES);
+  for (f = 0; f < NUM_FRAMES; f++)
+  {
+    ok = ok && (sink.peak[f] == refPeak[f]) && (sink.index[f] == refIndex[f]);
+  }
+  printf("CHECK riscv_sdf_run: %d frames, peak %d at %d %s\n", (int) sink.count, (int) sink.peak[0],
+         (int) sink.index[0], ok ? "ok" : "bad");
+  fail |= !ok;
+
+  RISCV_BENCH("riscv_sdf_run", "q15", FRAME_SIZE, chain_period(&G));
+
+  /* the same chain pipelined on 2 and 3 cores, forked sequentially on the host */
+  for (stages = 2u; stages <= 3u; stages++)
+  {
+    riscv_par_init(&P, stages, NULL);
+    riscv_dsp_arena_init(&arena, arena_mem, sizeof(arena_mem));
+    status = riscv_sdf_init(&G, chain_nodes, 4u, chain_edges, 3u, (uint16_t) stages, &arena);
+    chain_reset();
+    if(status == RISCV_MATH_SUCCESS)
+    {
+      status = riscv_sdf_run_par(&P, &G, NUM_FRAMES);
+    }
+
+    ok = (status == RISCV_MATH_SUCCESS) && (sink.count == NUM_FRAMES) && (G.pStage[1] == 0u) &&
+         (G.pStage[2] == 1u) && (G.pStage[3] == stages - 1u) && (G.pFifo[1].copies == 2u);
+    for (f = 0; f < NUM_FRAMES; f++)
+    {
+      ok = ok && (sink.peak[f] == refPeak[f]) && (sink.index[f] == refIndex[f]);
+    }
+    printf("CHECK riscv_sdf_run_par: %d stages, %d frames %s\n", (int) stages, (int) sink.count,
+           ok ? "ok" : "bad");
+    fail |= !ok;
+  }
+
+  /* 3 elements in, 2 out: two producer and three consumer firings, the edge reaches position 6 */
+  memset(&counter, 0, sizeof(counter));
+  riscv_dsp_arena_init(&arena, arena_mem, sizeof(arena_mem));
+  status = riscv_sdf_init(&G, pair_nodes, 2u, &pair_edge, 1u, 1u, &arena);
+  riscv_sdf_run(&G, 2u);
+  ok = (status == RISCV_MATH_SUCCESS) && (G.pRepeat[0] == 2u) && (G.pRepeat[1] == 3u) &&
+       (G.pFifo[0].capacity == 6u) && (counter.count == 12u);
+  for (n = 0; n < 12u; n++)
+  {
+    ok = ok && (counter.log[n] == (int32_t) n);
+  }
+  printf("CHECK riscv_sdf 3:2: repeat %d %d, capacity %d %s\n", (int) G.pRepeat[0], (int) G.pRepeat[1],
+         (int) G.pFifo[0].capacity, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* node 2 would need one firing per firing of node 1 and two per firing of node 0 */
+  riscv_dsp_arena_init(&arena, arena_mem, sizeof(arena_mem));
+  status = riscv_sdf_init(&G, bad_nodes, 3u, bad_edges, 3u, 1u, &arena);
+  ok = (status == RISCV_MATH_SIZE_MISMATCH);
+  bad_edges[2].src = 2u;
+  bad_edges[2].dst = 0u;
+  ok = ok && (riscv_sdf_init(&G, bad_nodes, 3u, bad_edges, 3u, 1u, &arena) == RISCV_MATH_ARGUMENT_ERROR);
+  printf("CHECK riscv_sdf_init errors: %d %s\n", (int) status, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
@@ -0,0 +1,132 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define MAT_ROWS 100
+#define MAT_COLS 64
+#define TILE_ROWS 16
+#define NUM_TAPS 256
+#define TILE_TAPS 48
+#define BLOCK_SIZE 32
+#define NUM_BLOCKS 4
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_mat_vec_mult_stream_q15() and _q7() multiply a MAT_ROWS x MAT_COLS matrix streamed in tiles of
+TILE_ROWS rows, which do not divide MAT_ROWS, and are compared with riscv_mat_vec_mult_q15() and _q7() on
+the whole matrix.  riscv_fir_coeff_stream_q15() runs NUM_TAPS taps streamed in tiles of TILE_TAPS over
+NUM_BLOCKS blocks of BLOCK_SIZE samples and is compared with riscv_fir_q15().  PULPino has no DMA, so the
+transfers are done by riscv_dma_start_memcpy() and the cycles include the copies that a DMA would overlap
+with the processing.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "SupportFunction4"
+#include "../common/riscv_bench.h"
+
+/* Weights and coefficients, in flash or L2 on the target */
+q15_t mat_q15[MAT_ROWS * MAT_COLS];
+q7_t mat_q7[MAT_ROWS * MAT_COLS];
+q15_t firCoeffs_q15[NUM_TAPS];
+
+q15_t vec_q15[MAT_COLS], dst_q15[MAT_ROWS], ref_q15[MAT_ROWS];
+q7_t vec_q7[MAT_COLS], dst_q7[MAT_ROWS], ref_q7[MAT_ROWS];
+q15_t l1Mat_q15[RISCV_MAT_VEC_STREAM_L1_SIZE(TILE_ROWS, MAT_COLS)];
+q7_t l1Mat_q7[RISCV_MAT_VEC_STREAM_L1_SIZE(TILE_ROWS, MAT_COLS)];
+
+q15_t src_q15[NUM_BLOCKS * BLOCK_SIZE], out_q15[NUM_BLOCKS * BLOCK_SIZE], outRef_q15[NUM_BLOCKS * BLOCK_SIZE];
+q15_t firState_q15[NUM_TAPS + BLOCK_SIZE], firStateRef_q15[NUM_TAPS + BLOCK_SIZE];
+q15_t l1Fir_q15[RISCV_FIR_COEFF_STREAM_L1_SIZE(TILE_TAPS, BLOCK_SIZE)];
+q63_t acc_q63[BLOCK_SIZE];
+
+int32_t main(void)
+{
+  riscv_dma_instance D;
+  riscv_matrix_instance_q15 M_q15;
+  riscv_matrix_instance_q7 M_q7;
+  riscv_fir_instance_q15 fir, firRef;
+  uint32_t i, k;
+  uint32_t seed = 1u;
+  int32_t fail = 0, ok;
+
+  riscv_bench_header();
+
+  riscv_dma_init(&D, NULL, NULL, NULL);
+
+  for (i = 0; i < MAT_ROWS * MAT_COLS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    mat_q15[i] = (q15_t)(seed >> 16);
+    mat_q7[i] = (q7_t)(seed >> 24);
+  }
+
+  for (i = 0; i < MAT_COLS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    vec_q15[i] = (q15_t)(seed >> 16);
+    vec_q7[i] = (q7_t)(seed >> 24);
+  }
+
+  /* Taps of about 1/NUM_TAPS so that a few outputs saturate */
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    firCoeffs_q15[i] = (q15_t)((int32_t)(seed >> 16) - 32768) >> 5;
+  }
+
+  for (i = 0; i < NUM_BLOCKS * BLOCK_SIZE; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    src_q15[i] = (q15_t)(seed >> 16);
+  }
+
+  riscv_mat_init_q15(&M_q15, MAT_ROWS, MAT_COLS, mat_q15);
+  riscv_mat_init_q7(&M_q7, MAT_ROWS, MAT_COLS, mat_q7);
+
+/*Matrix vector multiplication*/
+  RISCV_BENCH("riscv_mat_vec_mult_q15", "q15", MAT_ROWS,
+    riscv_mat_vec_mult_q15(&M_q15, vec_q15, ref_q15));
+  RISCV_BENCH("riscv_mat_vec_mult_stream_q15", "q15", MAT_ROWS,
+    riscv_mat_vec_mult_stream_q15(&D, &M_q15, vec_q15, dst_q15, TILE_ROWS, l1Mat_q15));
+  ok = (memcmp(dst_q15, ref_q15, sizeof(dst_q15)) == 0);
+  printf("CHECK riscv_mat_vec_mult_stream_q15: %d rows in tiles of %d %s\n", MAT_ROWS, TILE_ROWS, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  RISCV_BENCH("riscv_mat_vec_mult_q7", "q7", MAT_ROWS,
+    riscv_mat_vec_mult_q7(&M_q7, vec_q7, ref_q7));
+  RISCV_BENCH("riscv_mat_vec_mult_stream_q7", "q7", MAT_ROWS,
+    riscv_mat_vec_mult_stream_q7(&D, &M_q7, vec_q7, dst_q7, TILE_ROWS, l1Mat_q7));
+  ok = (memcmp(dst_q7, ref_q7, sizeof(dst_q7)) == 0);
+  printf("CHECK riscv_mat_vec_mult_stream_q7: %d rows in tiles of %d %s\n", MAT_ROWS, TILE_ROWS, ok ? "ok" : "bad");
+  fail |= !ok;
+
+/*FIR with streamed coefficients*/
+  RISCV_BENCH("riscv_fir_q15", "q15", NUM_BLOCKS * BLOCK_SIZE,
+    riscv_fir_init_q15(&firRef, NUM_TAPS, firCoeffs_q15, firStateRef_q15, BLOCK_SIZE);
+    for (k = 0; k < NUM_BLOCKS; k++)
+      riscv_fir_q15(&firRef, src_q15 + k * BLOCK_SIZE, outRef_q15 + k * BLOCK_SIZE, BLOCK_SIZE));
+  RISCV_BENCH("riscv_fir_coeff_stream_q15", "q15", NUM_BLOCKS * BLOCK_SIZE,
+    riscv_fir_init_q15(&fir, NUM_TAPS, firCoeffs_q15, firState_q15, BLOCK_SIZE);
+    for (k = 0; k < NUM_BLOCKS; k++)
+      riscv_fir_coeff_stream_q15(&D, &fir, src_q15 + k * BLOCK_SIZE, out_q15 + k * BLOCK_SIZE, BLOCK_SIZE,
+                                 TILE_TAPS, l1Fir_q15, acc_q63));
+  ok = (memcmp(out_q15, outRef_q15, sizeof(out_q15)) == 0);
+  printf("CHECK riscv_fir_coeff_stream_q15: %d taps in tiles of %d, %d blocks %s\n", NUM_TAPS, TILE_TAPS,
+         NUM_BLOCKS, ok ? "ok" : "bad");
+  fail |= !ok;
+
+#ifdef PRINT_OUTPUT
+  for (i = 0; i < 8; i++)
+    printf("%d %d\n", out_q15[i], outRef_q15[i]);
+#endif
+
+  printf("End\n");
+
+  return (fail);
+}
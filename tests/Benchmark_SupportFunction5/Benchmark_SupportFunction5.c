@@ -0,0 +1,151 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 4096
+#define BAND 16
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A sine of 0.3 LSB of Q15 vanishes when it is truncated by riscv_q31_to_q15() and must survive the
+dithered conversion, with its amplitude measured by correlation.  The error of each noise shaping
+order is passed through a triangular lowpass, whose power must drop from order 0 to 1 to 2.  The
+floating-point and Q31 conversions of the same values must be equal, a stereo block converted in
+pieces must equal the whole block, and full scale inputs must saturate
+within the few LSB of the shaped noise instead of wrapping.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "SupportFunction5"
+#include "../common/riscv_bench.h"
+
+q31_t src_q31[BLOCK_SIZE];
+float32_t src_f32[BLOCK_SIZE];
+q15_t dst_q15[BLOCK_SIZE] __attribute__((aligned(4))), ref_q15[BLOCK_SIZE] __attribute__((aligned(4)));
+q31_t state[4], stateRef[4];
+
+/* Power of the error through a triangular lowpass of 2*BAND-1 taps, in LSB^2 */
+static float32_t band_power(void)
+{
+  float32_t sum = 0.0f, avg;
+  uint32_t n, k;
+
+  for (n = 2 * BAND; n < BLOCK_SIZE; n++)
+  {
+    for (k = 0, avg = 0.0f; k < 2 * BAND - 1; k++)
+    {
+      avg += ((k < BAND) ? (k + 1) : (2 * BAND - 1 - k)) * (dst_q15[n - k] - src_q31[n - k] / 65536.0f);
+    }
+    avg /= BAND * BAND;
+    sum += avg * avg;
+  }
+  return (sum / (BLOCK_SIZE - 2 * BAND));
+}
+
+int main(void)
+{
+  riscv_dither_instance S, Sref;
+  uint32_t n, seed = 99u, order;
+  int32_t fail = 0, ok, bad;
+  float32_t amp, corr, power[3];
+
+  riscv_bench_header();
+
+  /* A sine of 0.3 LSB of Q15, offset by half an LSB so truncation keeps it constant */
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    src_q31[n] = (q31_t) lrintf((0.5f + 0.3f * sinf(6.28318531f * n / 64.0f)) * 65536.0f);
+  }
+
+  riscv_dither_init(&S, 1, 0, 1u, state);
+  RISCV_BENCH("riscv_q31_to_q15", "q31", BLOCK_SIZE, riscv_q31_to_q15(src_q31, ref_q15, BLOCK_SIZE));
+  RISCV_BENCH("riscv_q31_to_q15_dither_order0", "q31", BLOCK_SIZE, riscv_q31_to_q15_dither(&S, src_q31, dst_q15, BLOCK_SIZE));
+  riscv_dither_init(&S, 1, 2, 1u, state);
+  RISCV_BENCH("riscv_q31_to_q15_dither_order2", "q31", BLOCK_SIZE, riscv_q31_to_q15_dither(&S, src_q31, dst_q15, BLOCK_SIZE));
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    src_f32[n] = src_q31[n] / 2147483648.0f;
+  }
+  RISCV_BENCH("riscv_float_to_q15", "f32", BLOCK_SIZE, riscv_float_to_q15(src_f32, ref_q15, BLOCK_SIZE));
+  RISCV_BENCH("riscv_float_to_q15_dither_order2", "f32", BLOCK_SIZE, riscv_float_to_q15_dither(&S, src_f32, dst_q15, BLOCK_SIZE));
+
+  /* The truncated sine is lost, the dithered one keeps its amplitude */
+  riscv_q31_to_q15(src_q31, ref_q15, BLOCK_SIZE);
+  riscv_dither_init(&S, 1, 0, 1u, state);
+  riscv_q31_to_q15_dither(&S, src_q31, dst_q15, BLOCK_SIZE);
+  for (n = 0, bad = 0, corr = 0.0f; n < BLOCK_SIZE; n++)
+  {
+    bad += (ref_q15[n] != 0);
+    corr += dst_q15[n] * sinf(6.28318531f * n / 64.0f);
+  }
+  amp = 2.0f * corr / BLOCK_SIZE;
+  ok = (bad == 0) && (fabsf(amp - 0.3f) < 0.05f);
+  printf("CHECK riscv_q31_to_q15_dither sine: amplitude %d (1e-3 LSB) %s\n", (int) (amp * 1000), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Noise shaping moves the error out of the low band */
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    src_q31[n] = (q31_t) seed >> 2;
+  }
+  for (order = 0; order < 3; order++)
+  {
+    riscv_dither_init(&S, 1, (uint8_t) order, 7u, state);
+    riscv_q31_to_q15_dither(&S, src_q31, dst_q15, BLOCK_SIZE);
+    power[order] = band_power();
+  }
+  ok = (power[1] < 0.1f * power[0]) && (power[2] < 0.5f * power[1]);
+  printf("CHECK riscv_q31_to_q15_dither shaping: band power %d %d %d (1e-6 LSB^2) %s\n",
+         (int) (power[0] * 1e6f), (int) (power[1] * 1e6f), (int) (power[2] * 1e6f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Same values as float, exact for multiples of 2^8 */
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    src_q31[n] &= ~0xFF;
+    src_f32[n] = src_q31[n] / 2147483648.0f;
+  }
+  riscv_dither_init(&S, 2, 2, 5u, state);
+  riscv_dither_init(&Sref, 2, 2, 5u, stateRef);
+  riscv_q31_to_q15_dither(&Sref, src_q31, ref_q15, BLOCK_SIZE);
+  riscv_float_to_q15_dither(&S, src_f32, dst_q15, BLOCK_SIZE);
+  ok = (memcmp(dst_q15, ref_q15, sizeof(dst_q15)) == 0);
+  printf("CHECK riscv_float_to_q15_dither: %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Stereo in pieces of 2, 6 and the rest */
+  riscv_dither_init(&S, 2, 2, 5u, state);
+  riscv_q31_to_q15_dither(&S, src_q31, dst_q15, 2);
+  riscv_q31_to_q15_dither(&S, src_q31 + 2, dst_q15 + 2, 6);
+  riscv_q31_to_q15_dither(&S, src_q31 + 8, dst_q15 + 8, BLOCK_SIZE - 8);
+  ok = (memcmp(dst_q15, ref_q15, sizeof(dst_q15)) == 0);
+  printf("CHECK riscv_q31_to_q15_dither blocks: %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Full scale saturates, an odd block size */
+  for (n = 0; n < 9; n++)
+  {
+    src_q31[n] = (n & 1) ? (q31_t) 0x80000000 : 0x7FFFFFFF;
+  }
+  riscv_dither_init(&S, 1, 2, 3u, state);
+  riscv_q31_to_q15_dither(&S, src_q31, dst_q15, 9);
+  for (n = 0, bad = 0; n < 9; n++)
+  {
+    bad += (n & 1) ? (dst_q15[n] > -32760) : (dst_q15[n] < 32760);
+  }
+  bad += (riscv_dither_init(&S, 0, 0, 0u, state) != RISCV_MATH_ARGUMENT_ERROR);
+  bad += (riscv_dither_init(&S, 1, 3, 0u, state) != RISCV_MATH_ARGUMENT_ERROR);
+  ok = (bad == 0);
+  printf("CHECK riscv_q31_to_q15_dither saturation: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
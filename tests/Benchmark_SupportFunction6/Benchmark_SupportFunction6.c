@@ -0,0 +1,211 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define NUM_BITS 1000
+#define K 7
+#define POLY0 0171
+#define POLY1 0133
+#define NUM_STEPS (NUM_BITS + K - 1)
+#define NUM_STATES (1 << (K - 1))
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*Random bits with a tail of K-1 zeros are encoded by the K = 7 code 0171, 0133 and sent as BPSK
+with Gaussian noise at Eb/N0 = 4 dB.  The Q7 and Q15 decoders must output the bits of a plain C
+decoder with 32-bit path metrics fed the same 3-bit and 8-bit soft decisions, and correct most of
+the channel errors.  A K = 5 code is decoded the same way, the steps fed in pieces must give the
+same bits, and a full decisions buffer or an unsupported code must be refused.  The CHECK lines
+must report ok.
+*/
+#define RISCV_BENCH_SUITE "SupportFunction6"
+#include "../common/riscv_bench.h"
+
+uint8_t bits[NUM_STEPS];
+q15_t soft_q15[2 * NUM_STEPS] __attribute__((aligned(4)));
+q7_t soft_q7[2 * NUM_STEPS] __attribute__((aligned(4)));
+q7_t metrics_q7[2 * NUM_STATES] __attribute__((aligned(4)));
+q15_t metrics_q15[2 * NUM_STATES] __attribute__((aligned(4)));
+uint32_t decisions[NUM_STEPS * RISCV_VITERBI_DECISION_WORDS(K)];
+uint8_t decoded[(NUM_STEPS + 7) / 8], expected[(NUM_STEPS + 7) / 8];
+uint8_t refDecisions[NUM_STEPS][NUM_STATES];
+
+static uint32_t seed = 12345u;
+
+static float32_t gaussian(void)
+{
+  float32_t u, v;
+
+  seed = seed * 1664525u + 1013904223u;
+  u = ((seed >> 8) + 1.0f) / 16777217.0f;
+  seed = seed * 1664525u + 1013904223u;
+  v = (seed >> 8) / 16777216.0f;
+  return (sqrtf(-2.0f * logf(u)) * cosf(6.28318531f * v));
+}
+
+/* Encodes bits[] with the code of constraint length k, soft bits of amplitude 64 (Q7) plus noise */
+static uint32_t encode(uint32_t k, uint32_t poly0, uint32_t poly1, float32_t sigma)
+{
+  uint32_t n, state = 0, reg, c, rawErrors = 0;
+  float32_t y;
+
+  for (n = 0; n < 2 * NUM_STEPS; n++)
+  {
+    if((n & 1) == 0)
+    {
+      reg = state | ((uint32_t) bits[n >> 1] << (k - 1));
+      state = reg >> 1;
+    }
+    c = __builtin_popcount(reg & ((n & 1) ? poly1 : poly0)) & 1;
+    y = (c ? -64.0f : 64.0f) + sigma * 64.0f * gaussian();
+    y = (y > 127.0f) ? 127.0f : ((y < -128.0f) ? -128.0f : y);
+    soft_q7[n] = (q7_t) lrintf(y);
+    soft_q15[n] = (q15_t) __SSAT(lrintf(y * 256.0f), 16);
+    rawErrors += ((y < 0.0f) != c);
+  }
+  return (rawErrors);
+}
+
+/* Viterbi decoder with 32-bit metrics of the soft bits shifted right by shift, ending in state 0 */
+static void reference(uint32_t k, uint32_t poly0, uint32_t poly1, const q15_t * pSrc, uint32_t shift)
+{
+  int32_t metric[NUM_STATES], next[NUM_STATES], bm, a, b;
+  uint32_t numStates = 1u << (k - 1), half = numStates >> 1, n, j, s, r0, r1;
+
+  for (s = 0; s < numStates; s++)
+  {
+    metric[s] = (s == 0) ? 0 : -1000000;
+  }
+  for (n = 0; n < NUM_STEPS; n++)
+  {
+    for (j = 0; j < half; j++)
+    {
+      r0 = __builtin_popcount((2 * j) & poly0) & 1;
+      r1 = __builtin_popcount((2 * j) & poly1) & 1;
+      bm = (r0 ? -1 : 1) * (pSrc[2 * n] >> shift) + (r1 ? -1 : 1) * (pSrc[2 * n + 1] >> shift);
+      a = metric[2 * j] + bm;
+      b = metric[2 * j + 1] - bm;
+      next[j] = (b > a) ? b : a;
+      refDecisions[n][j] = (b > a);
+      a = metric[2 * j] - bm;
+      b = metric[2 * j + 1] + bm;
+      next[j + half] = (b > a) ? b : a;
+      refDecisions[n][j + half] = (b > a);
+    }
+    memcpy(metric, next, sizeof(metric));
+  }
+  memset(expected, 0, sizeof(expected));
+  for (n = NUM_STEPS, s = 0; n > 0; n--)
+  {
+    expected[(n - 1) >> 3] |= (uint8_t) ((s >> (k - 2)) << (7 - ((n - 1) & 7)));
+    s = ((s << 1) | refDecisions[n - 1][s]) & (numStates - 1);
+  }
+}
+
+static uint32_t bit_errors(void)
+{
+  uint32_t n, errors = 0;
+
+  for (n = 0; n < NUM_STEPS; n++)
+  {
+    errors += (((decoded[n >> 3] >> (7 - (n & 7))) & 1) != bits[n]);
+  }
+  return (errors);
+}
+
+int main(void)
+{
+  riscv_viterbi_instance_q7 S7;
+  riscv_viterbi_instance_q15 S15;
+  uint32_t n, rawErrors, errors7, errors15;
+  int32_t fail = 0, ok, bad;
+  q15_t soft_q7_wide[2 * NUM_STEPS];
+
+  riscv_bench_header();
+
+  for (n = 0; n < NUM_STEPS; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    bits[n] = (n < NUM_BITS) ? (seed >> 31) : 0;
+  }
+  /* Es/N0 = Eb/N0 / 2 at rate 1/2, sigma^2 = 1 / (2 Es/N0) */
+  rawErrors = encode(K, POLY0, POLY1, sqrtf(1.0f / powf(10.0f, 0.4f)));
+  for (n = 0; n < 2 * NUM_STEPS; n++)
+  {
+    soft_q7_wide[n] = soft_q7[n];
+  }
+
+  riscv_viterbi_init_q7(&S7, K, POLY0, POLY1, metrics_q7, decisions, NUM_STEPS);
+  RISCV_BENCH("riscv_viterbi_acs_q7", "q7", NUM_STEPS, riscv_viterbi_acs_q7(&S7, soft_q7, NUM_STEPS));
+  RISCV_BENCH("riscv_viterbi_traceback_q7", "q7", NUM_STEPS, riscv_viterbi_traceback_q7(&S7, 0, decoded));
+  riscv_viterbi_init_q15(&S15, K, POLY0, POLY1, metrics_q15, decisions, NUM_STEPS);
+  RISCV_BENCH("riscv_viterbi_acs_q15", "q15", NUM_STEPS, riscv_viterbi_acs_q15(&S15, soft_q15, NUM_STEPS));
+  RISCV_BENCH("riscv_viterbi_traceback_q15", "q15", NUM_STEPS, riscv_viterbi_traceback_q15(&S15, 0, decoded));
+
+  /* K = 7, bit exact with the reference and far fewer errors than the channel */
+  riscv_viterbi_init_q7(&S7, K, POLY0, POLY1, metrics_q7, decisions, NUM_STEPS);
+  riscv_viterbi_acs_q7(&S7, soft_q7, NUM_STEPS);
+  riscv_viterbi_traceback_q7(&S7, 0, decoded);
+  reference(K, POLY0, POLY1, soft_q7_wide, 5);
+  errors7 = bit_errors();
+  ok = (memcmp(decoded, expected, sizeof(decoded)) == 0) && (errors7 * 10 < rawErrors);
+  printf("CHECK riscv_viterbi_acs_q7 K=7: %d bit errors, %d channel errors %s\n", (int) errors7, (int) rawErrors, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  riscv_viterbi_init_q15(&S15, K, POLY0, POLY1, metrics_q15, decisions, NUM_STEPS);
+  riscv_viterbi_acs_q15(&S15, soft_q15, NUM_STEPS);
+  riscv_viterbi_traceback_q15(&S15, 0, decoded);
+  reference(K, POLY0, POLY1, soft_q15, 8);
+  errors15 = bit_errors();
+  ok = (memcmp(decoded, expected, sizeof(decoded)) == 0) && (errors15 <= errors7);
+  printf("CHECK riscv_viterbi_acs_q15 K=7: %d bit errors %s\n", (int) errors15, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* K = 5 code 023, 035 with less noise, the steps in pieces of 1, 100 and the rest */
+  rawErrors = encode(5, 023, 035, 0.5f);
+  riscv_viterbi_init_q15(&S15, 5, 023, 035, metrics_q15, decisions, NUM_STEPS);
+  riscv_viterbi_acs_q15(&S15, soft_q15, 1);
+  riscv_viterbi_acs_q15(&S15, soft_q15 + 2, 100);
+  riscv_viterbi_acs_q15(&S15, soft_q15 + 202, NUM_STEPS - 101);
+  riscv_viterbi_traceback_q15(&S15, 0, decoded);
+  reference(5, 023, 035, soft_q15, 8);
+  bad = (memcmp(decoded, expected, sizeof(decoded)) != 0);
+  for (n = 0; n < 2 * NUM_STEPS; n++)
+  {
+    soft_q7_wide[n] = soft_q7[n];
+  }
+  riscv_viterbi_init_q7(&S7, 5, 023, 035, metrics_q7, decisions, NUM_STEPS);
+  riscv_viterbi_acs_q7(&S7, soft_q7, 1);
+  riscv_viterbi_acs_q7(&S7, soft_q7 + 2, 100);
+  riscv_viterbi_acs_q7(&S7, soft_q7 + 202, NUM_STEPS - 101);
+  riscv_viterbi_traceback_q7(&S7, -1, decoded);
+  reference(5, 023, 035, soft_q7_wide, 5);
+  bad += (memcmp(decoded, expected, sizeof(decoded)) != 0);
+  ok = (bad == 0) && (bit_errors() * 10 < rawErrors);
+  printf("CHECK riscv_viterbi_acs K=5 blocks: %d bit errors, %d channel errors %s\n", (int) bit_errors(), (int) rawErrors, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* A full decisions buffer, unsupported codes and end states */
+  bad = (riscv_viterbi_acs_q7(&S7, soft_q7, 1) != RISCV_MATH_LENGTH_ERROR);
+  bad += (riscv_viterbi_acs_q15(&S15, soft_q15, 1) != RISCV_MATH_LENGTH_ERROR);
+  bad += (riscv_viterbi_traceback_q7(&S7, 16, decoded) != RISCV_MATH_ARGUMENT_ERROR);
+  bad += (riscv_viterbi_init_q7(&S7, 8, 0371, 0247, metrics_q7, decisions, 1) != RISCV_MATH_ARGUMENT_ERROR);
+  bad += (riscv_viterbi_init_q7(&S7, 3, 07, 05, metrics_q7, decisions, 1) != RISCV_MATH_ARGUMENT_ERROR);
+  bad += (riscv_viterbi_init_q15(&S15, 7, 0170, 0133, metrics_q15, decisions, 1) != RISCV_MATH_ARGUMENT_ERROR);
+  bad += (riscv_viterbi_init_q7(&S7, 0, 07, 05, metrics_q7, decisions, 1) != RISCV_MATH_ARGUMENT_ERROR);
+  bad += (riscv_viterbi_init_q15(&S15, 40, 07, 05, metrics_q15, decisions, 1) != RISCV_MATH_ARGUMENT_ERROR);
+  ok = (bad == 0);
+  printf("CHECK riscv_viterbi errors: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
@@ -0,0 +1,162 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 256
+#define NUM_TAPS 64
+#define PART_LEN 64
+#define NUM_PARTS (NUM_TAPS / PART_LEN)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A Q15, a Q31 and a floating-point FIR filter are planned without and with measuring.  The planned
+filters must output what the chosen kernel outputs from the initial state, the measured choices must
+land in the wisdom table, a wisdom entry must select its kernel without measuring and only for the
+flags it was recorded with, and a full table or an entry naming a kernel that is not a candidate must
+be reported.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "SupportFunction7"
+#include "../common/riscv_bench.h"
+
+q15_t src_q15[BLOCK_SIZE], dst_q15[BLOCK_SIZE], ref_q15[BLOCK_SIZE], coeffs_q15[NUM_TAPS];
+q15_t state_q15[NUM_TAPS + BLOCK_SIZE - 1];
+q31_t src_q31[BLOCK_SIZE], dst_q31[BLOCK_SIZE], ref_q31[BLOCK_SIZE], coeffs_q31[NUM_TAPS];
+q31_t state_q31[NUM_TAPS + BLOCK_SIZE - 1];
+float32_t src_f32[BLOCK_SIZE], dst_f32[BLOCK_SIZE], ref_f32[BLOCK_SIZE], coeffs_f32[NUM_TAPS];
+float32_t state_f32[NUM_TAPS + BLOCK_SIZE - 1];
+float32_t state_fft[2 * PART_LEN * (2 * NUM_PARTS + 3)];
+riscv_dsp_wisdom_entry entries[4], saved[4];
+
+int main(void)
+{
+  riscv_fir_instance_q15 S15;
+  riscv_fir_instance_q31 S31;
+  riscv_fir_instance_f32 Sf;
+  riscv_fir_fft_instance_f32 Sfft;
+  riscv_fir_plan_instance_q15 P15;
+  riscv_fir_plan_instance_q31 P31;
+  riscv_fir_plan_instance_f32 Pf;
+  riscv_dsp_wisdom W, W2;
+  const riscv_dsp_wisdom_entry *pEntry;
+  uint32_t n, seed = 7u;
+  int32_t fail = 0, ok, bad;
+  float32_t err;
+
+  riscv_bench_header();
+
+  for (n = 0; n < NUM_TAPS; n++)
+  {
+    coeffs_f32[n] = sinf(0.2f * (n + 1)) / (n + 1);
+    coeffs_q31[n] = (q31_t) (coeffs_f32[n] * 0x20000000);
+    coeffs_q15[n] = (q15_t) (coeffs_q31[n] >> 16);
+  }
+  for (n = 0; n < BLOCK_SIZE; n++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    src_q31[n] = (q31_t) seed >> 2;
+    src_q15[n] = (q15_t) (src_q31[n] >> 16);
+    src_f32[n] = src_q31[n] / 2147483648.0f;
+  }
+
+  riscv_dsp_wisdom_init(&W, entries, 0, 4);
+
+  /* Q15 without measuring: the direct kernel */
+  riscv_fir_init_q15(&S15, NUM_TAPS, coeffs_q15, state_q15, BLOCK_SIZE);
+  riscv_fir_q15(&S15, src_q15, ref_q15, BLOCK_SIZE);
+  riscv_fir_init_q15(&S15, NUM_TAPS, coeffs_q15, state_q15, BLOCK_SIZE);
+  bad = (riscv_fir_plan_init_q15(&P15, &S15, NULL, NULL, BLOCK_SIZE, 0u, &W) != RISCV_MATH_SUCCESS);
+  riscv_fir_plan_q15(&P15, src_q15, dst_q15, BLOCK_SIZE);
+  bad += (P15.variant != RISCV_FIR_PLAN_DIRECT) || (W.numEntries != 0);
+  bad += (memcmp(dst_q15, ref_q15, sizeof(dst_q15)) != 0);
+
+  /* Measured with the fast kernel as candidate, recorded, the filter back to its initial state */
+  riscv_fir_init_q15(&S15, NUM_TAPS, coeffs_q15, state_q15, BLOCK_SIZE);
+  riscv_fir_plan_init_q15(&P15, &S15, src_q15, dst_q15, BLOCK_SIZE, RISCV_DSP_PLAN_MEASURE | RISCV_DSP_PLAN_ALLOW_FAST, &W);
+  pEntry = riscv_dsp_wisdom_find(&W, RISCV_DSP_PLAN_FIR_Q15, NUM_TAPS, BLOCK_SIZE, RISCV_DSP_PLAN_ALLOW_FAST);
+  bad += (pEntry == NULL) || (W.numEntries != 1) || ((pEntry != NULL) && (pEntry->variant != P15.variant));
+  riscv_fir_init_q15(&S15, NUM_TAPS, coeffs_q15, state_q15, BLOCK_SIZE);
+  P15.pFunc(&S15, src_q15, ref_q15, BLOCK_SIZE);
+  riscv_fir_init_q15(&S15, NUM_TAPS, coeffs_q15, state_q15, BLOCK_SIZE);
+  riscv_fir_plan_init_q15(&P15, &S15, src_q15, dst_q15, BLOCK_SIZE, RISCV_DSP_PLAN_MEASURE | RISCV_DSP_PLAN_ALLOW_FAST, NULL);
+  riscv_fir_plan_q15(&P15, src_q15, dst_q15, BLOCK_SIZE);
+  bad += (memcmp(dst_q15, ref_q15, sizeof(dst_q15)) != 0);
+
+  /* Wisdom selecting the fast kernel, only with the flag it was recorded with */
+  riscv_dsp_wisdom_add(&W, RISCV_DSP_PLAN_FIR_Q15, NUM_TAPS, BLOCK_SIZE, RISCV_DSP_PLAN_ALLOW_FAST, RISCV_FIR_PLAN_FAST, 0u);
+  riscv_fir_init_q15(&S15, NUM_TAPS, coeffs_q15, state_q15, BLOCK_SIZE);
+  riscv_fir_fast_q15(&S15, src_q15, ref_q15, BLOCK_SIZE);
+  riscv_fir_init_q15(&S15, NUM_TAPS, coeffs_q15, state_q15, BLOCK_SIZE);
+  bad += (riscv_fir_plan_init_q15(&P15, &S15, NULL, NULL, BLOCK_SIZE, RISCV_DSP_PLAN_MEASURE | RISCV_DSP_PLAN_ALLOW_FAST, &W) != RISCV_MATH_SUCCESS);
+  RISCV_BENCH("riscv_fir_plan_q15", "q15", BLOCK_SIZE, riscv_fir_plan_q15(&P15, src_q15, dst_q15, BLOCK_SIZE));
+  riscv_fir_init_q15(&S15, NUM_TAPS, coeffs_q15, state_q15, BLOCK_SIZE);
+  riscv_fir_plan_q15(&P15, src_q15, dst_q15, BLOCK_SIZE);
+  bad += (P15.variant != RISCV_FIR_PLAN_FAST) || (W.numEntries != 1);
+  bad += (memcmp(dst_q15, ref_q15, sizeof(dst_q15)) != 0);
+  riscv_fir_plan_init_q15(&P15, &S15, NULL, NULL, BLOCK_SIZE, 0u, &W);
+  bad += (P15.variant != RISCV_FIR_PLAN_DIRECT);
+  ok = (bad == 0);
+  printf("CHECK riscv_fir_plan_init_q15: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Q31 measured, then planned again from the saved table without measuring */
+  riscv_fir_init_q31(&S31, NUM_TAPS, coeffs_q31, state_q31, BLOCK_SIZE);
+  bad = (riscv_fir_plan_init_q31(&P31, &S31, src_q31, dst_q31, BLOCK_SIZE, RISCV_DSP_PLAN_MEASURE, &W) != RISCV_MATH_SUCCESS);
+  bad += (W.numEntries != 2) || (P31.variant != RISCV_FIR_PLAN_DIRECT);
+  riscv_fir_plan_q31(&P31, src_q31, dst_q31, BLOCK_SIZE);
+  riscv_fir_init_q31(&S31, NUM_TAPS, coeffs_q31, state_q31, BLOCK_SIZE);
+  riscv_fir_q31(&S31, src_q31, ref_q31, BLOCK_SIZE);
+  bad += (memcmp(dst_q31, ref_q31, sizeof(dst_q31)) != 0);
+  memcpy(saved, entries, sizeof(entries));
+  riscv_dsp_wisdom_init(&W2, saved, 2, 2);
+  bad += (riscv_fir_plan_init_q31(&P31, &S31, NULL, NULL, BLOCK_SIZE, RISCV_DSP_PLAN_MEASURE, &W2) != RISCV_MATH_SUCCESS);
+  bad += (P31.variant != RISCV_FIR_PLAN_DIRECT);
+  saved[1].variant = RISCV_FIR_PLAN_FAST;
+  bad += (riscv_fir_plan_init_q31(&P31, &S31, NULL, NULL, BLOCK_SIZE, RISCV_DSP_PLAN_MEASURE, &W2) != RISCV_MATH_ARGUMENT_ERROR);
+  bad += (riscv_dsp_wisdom_add(&W2, RISCV_DSP_PLAN_FIR_Q31, NUM_TAPS, BLOCK_SIZE, RISCV_DSP_PLAN_ALLOW_FAST, RISCV_FIR_PLAN_FAST, 0u) != RISCV_MATH_LENGTH_ERROR);
+  bad += (riscv_dsp_wisdom_add(&W2, RISCV_DSP_PLAN_FIR_Q31, NUM_TAPS, BLOCK_SIZE, 0u, RISCV_FIR_PLAN_DIRECT, 0u) != RISCV_MATH_SUCCESS);
+  bad += (W2.numEntries != 2) || (saved[1].variant != RISCV_FIR_PLAN_DIRECT);
+  ok = (bad == 0);
+  printf("CHECK riscv_fir_plan_init_q31: %d mismatches %s\n", (int) bad, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Floating point, direct or FFT convolution, the wisdom table full */
+  riscv_fir_init_f32(&Sf, NUM_TAPS, coeffs_f32, state_f32, BLOCK_SIZE);
+  riscv_fir_fft_init_f32(&Sfft, NUM_TAPS, coeffs_f32, state_fft, PART_LEN);
+  riscv_fir_f32(&Sf, src_f32, ref_f32, BLOCK_SIZE);
+  riscv_fir_init_f32(&Sf, NUM_TAPS, coeffs_f32, state_f32, BLOCK_SIZE);
+  riscv_dsp_wisdom_init(&W2, saved, 0, 1);
+  bad = (riscv_fir_plan_init_f32(&Pf, &Sf, &Sfft, src_f32, dst_f32, BLOCK_SIZE, RISCV_DSP_PLAN_MEASURE, &W2) != RISCV_MATH_SUCCESS);
+  riscv_fir_plan_f32(&Pf, src_f32, dst_f32, BLOCK_SIZE);
+  for (n = 0, err = 0.0f; n < BLOCK_SIZE; n++)
+  {
+    err = fmaxf(err, fabsf(dst_f32[n] - ref_f32[n]));
+  }
+  bad += (err > 1e-5f) || (W2.numEntries != 1);
+  riscv_dsp_wisdom_add(&W2, RISCV_DSP_PLAN_FIR_F32, NUM_TAPS, BLOCK_SIZE, 0u, RISCV_FIR_PLAN_FFT, 0u);
+  riscv_fir_init_f32(&Sf, NUM_TAPS, coeffs_f32, state_f32, BLOCK_SIZE);
+  riscv_fir_fft_init_f32(&Sfft, NUM_TAPS, coeffs_f32, state_fft, PART_LEN);
+  bad += (riscv_fir_plan_init_f32(&Pf, &Sf, &Sfft, NULL, NULL, BLOCK_SIZE, 0u, &W2) != RISCV_MATH_SUCCESS);
+  RISCV_BENCH("riscv_fir_plan_f32", "f32", BLOCK_SIZE, riscv_fir_plan_f32(&Pf, src_f32, dst_f32, BLOCK_SIZE));
+  riscv_fir_fft_init_f32(&Sfft, NUM_TAPS, coeffs_f32, state_fft, PART_LEN);
+  riscv_fir_plan_f32(&Pf, src_f32, dst_f32, BLOCK_SIZE);
+  for (n = 0, err = 0.0f; n < BLOCK_SIZE; n++)
+  {
+    err = fmaxf(err, fabsf(dst_f32[n] - ref_f32[n]));
+  }
+  bad += (err > 1e-5f) || (Pf.variant != RISCV_FIR_PLAN_FFT) || (Pf.pFft != &Sfft);
+  bad += (riscv_fir_plan_init_f32(&Pf, &Sf, NULL, NULL, NULL, BLOCK_SIZE, 0u, &W2) != RISCV_MATH_ARGUMENT_ERROR);
+  ok = (bad == 0);
+  printf("CHECK riscv_fir_plan_init_f32: %d mismatches, error %d (1e-9) %s\n", (int) bad, (int) (err * 1e9f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
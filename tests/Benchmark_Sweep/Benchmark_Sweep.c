@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+/*
+*Scaling sweeps of the main kernels with the shared harness in tests/common/riscv_bench.h: every kernel is
+measured over the block sizes, tap counts, stage counts and FFT lengths below and prints one SWEEP line per
+point and event with the cost per output sample and per operation (MAC, or radix-2 butterfly for the FFTs).
+*Plot per_sample against size to see where the setup and tail cost of a kernel is amortized, and against the
+largest sizes to see where it stops scaling because the data no longer fits the memory close to the core.
+*Lower RISCV_SWEEP_MAX_BLOCK, RISCV_SWEEP_MAX_TAPS or RISCV_SWEEP_MAX_FFT for cores with little data memory.
+*/
+#define RISCV_BENCH_SUITE "Sweep"
+#define RISCV_BENCH_EVENTS { RISCV_BENCH_EV_CYCLES, RISCV_BENCH_EV_INSTR }
+#include "../common/riscv_bench.h"
+
+#ifndef RISCV_SWEEP_MAX_BLOCK
+#define RISCV_SWEEP_MAX_BLOCK   256
+#endif
+
+#ifndef RISCV_SWEEP_MAX_TAPS
+#define RISCV_SWEEP_MAX_TAPS    64
+#endif
+
+#ifndef RISCV_SWEEP_MAX_STAGES
+#define RISCV_SWEEP_MAX_STAGES  8
+#endif
+
+#ifndef RISCV_SWEEP_MAX_FFT
+#define RISCV_SWEEP_MAX_FFT     1024
+#endif
+
+#define STATE_LEN  (RISCV_SWEEP_MAX_BLOCK + RISCV_SWEEP_MAX_TAPS)
+#define COEFFS_LEN (RISCV_SWEEP_MAX_TAPS + (6 * RISCV_SWEEP_MAX_STAGES))
+
+float32_t src_f32[2 * RISCV_SWEEP_MAX_FFT];
+q31_t src_q31[2 * RISCV_SWEEP_MAX_FFT];
+q15_t src_q15[2 * RISCV_SWEEP_MAX_FFT];
+q7_t src_q7[RISCV_SWEEP_MAX_BLOCK];
+
+float32_t dst_f32[RISCV_SWEEP_MAX_BLOCK];
+q31_t dst_q31[RISCV_SWEEP_MAX_BLOCK];
+q15_t dst_q15[RISCV_SWEEP_MAX_BLOCK];
+q7_t dst_q7[RISCV_SWEEP_MAX_BLOCK];
+q63_t dot_q63;
+
+/*Filter coefficients, also used for the biquad cascades (6 q15 or 5 q31/f32 per stage)*/
+float32_t coeffs_f32[COEFFS_LEN];
+q31_t coeffs_q31[COEFFS_LEN];
+q15_t coeffs_q15[COEFFS_LEN];
+q7_t coeffs_q7[COEFFS_LEN];
+
+float32_t state_f32[STATE_LEN];
+q31_t state_q31[STATE_LEN];
+q15_t state_q15[STATE_LEN];
+q7_t state_q7[STATE_LEN];
+
+riscv_fir_instance_f32 Sfir_f32;
+riscv_fir_instance_q31 Sfir_q31;
+riscv_fir_instance_q15 Sfir_q15;
+riscv_fir_instance_q7 Sfir_q7;
+riscv_biquad_casd_df1_inst_f32 Sdf1_f32;
+riscv_biquad_casd_df1_inst_q31 Sdf1_q31;
+riscv_biquad_casd_df1_inst_q15 Sdf1_q15;
+riscv_biquad_cascade_df2T_instance_f32 Sdf2T_f32;
+
+static const uint32_t blockSizes[] = { 1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024 };
+static const uint16_t tapCounts[] = { 4, 8, 16, 32, 64, 128 };
+static const uint8_t stageCounts[] = { 1, 2, 4, 8, 16 };
+
+static const riscv_cfft_instance_f32 * const cfft_f32[] =
+{
+  &riscv_cfft_sR_f32_len16, &riscv_cfft_sR_f32_len32, &riscv_cfft_sR_f32_len64, &riscv_cfft_sR_f32_len128,
+  &riscv_cfft_sR_f32_len256, &riscv_cfft_sR_f32_len512, &riscv_cfft_sR_f32_len1024, &riscv_cfft_sR_f32_len2048,
+  &riscv_cfft_sR_f32_len4096
+};
+
+static const riscv_cfft_instance_q31 * const cfft_q31[] =
+{
+  &riscv_cfft_sR_q31_len16, &riscv_cfft_sR_q31_len32, &riscv_cfft_sR_q31_len64, &riscv_cfft_sR_q31_len128,
+  &riscv_cfft_sR_q31_len256, &riscv_cfft_sR_q31_len512, &riscv_cfft_sR_q31_len1024, &riscv_cfft_sR_q31_len2048,
+  &riscv_cfft_sR_q31_len4096
+};
+
+static const riscv_cfft_instance_q15 * const cfft_q15[] =
+{
+  &riscv_cfft_sR_q15_len16, &riscv_cfft_sR_q15_len32, &riscv_cfft_sR_q15_len64, &riscv_cfft_sR_q15_len128,
+  &riscv_cfft_sR_q15_len256, &riscv_cfft_sR_q15_len512, &riscv_cfft_sR_q15_len1024, &riscv_cfft_sR_q15_len2048,
+  &riscv_cfft_sR_q15_len4096
+};
+
+#define NUM_OF(X) (sizeof(X) / sizeof((X)[0]))
+
+static void fill_inputs(void)
+{
+  uint32_t i, r = 1u;
+
+  for (i = 0u; i < (2u * RISCV_SWEEP_MAX_FFT); i++)
+  {
+    r = (r * 1103515245u) + 12345u;
+    src_q31[i] = (q31_t) (r & 0xFFFF0000u) >> 4;
+    src_q15[i] = (q15_t) (src_q31[i] >> 16);
+    src_f32[i] = (float32_t) src_q15[i] / 32768.0f;
+    if(i < RISCV_SWEEP_MAX_BLOCK)
+    {
+      src_q7[i] = (q7_t) (src_q15[i] >> 8);
+    }
+  }
+
+  /*Small coefficients keep the cascades and the accumulators away from saturation*/
+  for (i = 0u; i < COEFFS_LEN; i++)
+  {
+    coeffs_q31[i] = (q31_t) ((i * 0x00212345u) & 0x01FFFFFFu) - 0x01000000;
+    coeffs_q15[i] = (q15_t) (coeffs_q31[i] >> 16);
+    coeffs_q7[i] = (q7_t) (coeffs_q31[i] >> 24);
+    coeffs_f32[i] = (float32_t) coeffs_q15[i] / 32768.0f;
+  }
+}
+
+int32_t main(void)
+{
+  uint32_t b, t, s, f, n, taps, stages, len, log2n;
+
+  fill_inputs();
+  riscv_bench_header();
+  riscv_bench_sweep_header();
+
+  /*Element-wise and reduction kernels over the block size*/
+  for (b = 0u; (b < NUM_OF(blockSizes)) && (blockSizes[b] <= RISCV_SWEEP_MAX_BLOCK); b++)
+  {
+    n = blockSizes[b];
+    RISCV_BENCH_SWEEP("riscv_add_q15", "q15", n, 0, n, n, riscv_add_q15(src_q15, src_q15 + n, dst_q15, n));
+    RISCV_BENCH_SWEEP("riscv_add_f32", "f32", n, 0, n, n, riscv_add_f32(src_f32, src_f32 + n, dst_f32, n));
+    RISCV_BENCH_SWEEP("riscv_dot_prod_q15", "q15", n, 0, 1, n, riscv_dot_prod_q15(src_q15, src_q15 + n, n, &dot_q63));
+  }
+
+  /*FIR filters over the block size and the tap count, one MAC per tap and output*/
+  for (t = 0u; (t < NUM_OF(tapCounts)) && (tapCounts[t] <= RISCV_SWEEP_MAX_TAPS); t++)
+  {
+    taps = tapCounts[t];
+    for (b = 0u; (b < NUM_OF(blockSizes)) && (blockSizes[b] <= RISCV_SWEEP_MAX_BLOCK); b++)
+    {
+      n = blockSizes[b];
+      riscv_fir_init_f32(&Sfir_f32, taps, coeffs_f32, state_f32, n);
+      RISCV_BENCH_SWEEP("riscv_fir_f32", "f32", n, taps, n, n * taps, riscv_fir_f32(&Sfir_f32, src_f32, dst_f32, n));
+      riscv_fir_init_q31(&Sfir_q31, taps, coeffs_q31, state_q31, n);
+      RISCV_BENCH_SWEEP("riscv_fir_q31", "q31", n, taps, n, n * taps, riscv_fir_q31(&Sfir_q31, src_q31, dst_q31, n));
+      riscv_fir_init_q15(&Sfir_q15, taps, coeffs_q15, state_q15, n);
+      RISCV_BENCH_SWEEP("riscv_fir_q15", "q15", n, taps, n, n * taps, riscv_fir_q15(&Sfir_q15, src_q15, dst_q15, n));
+      riscv_fir_init_q7(&Sfir_q7, taps, coeffs_q7, state_q7, n);
+      RISCV_BENCH_SWEEP("riscv_fir_q7", "q7", n, taps, n, n * taps, riscv_fir_q7(&Sfir_q7, src_q7, dst_q7, n));
+    }
+  }
+
+  /*Biquad cascades over the block size and the stage count, five MACs per stage and output*/
+  for (s = 0u; (s < NUM_OF(stageCounts)) && (stageCounts[s] <= RISCV_SWEEP_MAX_STAGES); s++)
+  {
+    stages = stageCounts[s];
+    riscv_biquad_cascade_df1_init_f32(&Sdf1_f32, (uint8_t) stages, coeffs_f32, state_f32);
+    riscv_biquad_cascade_df1_init_q31(&Sdf1_q31, (uint8_t) stages, coeffs_q31, state_q31, 1);
+    riscv_biquad_cascade_df1_init_q15(&Sdf1_q15, (uint8_t) stages, coeffs_q15, state_q15, 1);
+    riscv_biquad_cascade_df2T_init_f32(&Sdf2T_f32, (uint8_t) stages, coeffs_f32, state_f32);
+    for (b = 0u; (b < NUM_OF(blockSizes)) && (blockSizes[b] <= RISCV_SWEEP_MAX_BLOCK); b++)
+    {
+      n = blockSizes[b];
+      RISCV_BENCH_SWEEP("riscv_biquad_cascade_df1_f32", "f32", n, stages, n, 5u * n * stages,
+                        riscv_biquad_cascade_df1_f32(&Sdf1_f32, src_f32, dst_f32, n));
+      RISCV_BENCH_SWEEP("riscv_biquad_cascade_df1_q31", "q31", n, stages, n, 5u * n * stages,
+                        riscv_biquad_cascade_df1_q31(&Sdf1_q31, src_q31, dst_q31, n));
+      RISCV_BENCH_SWEEP("riscv_biquad_cascade_df1_q15", "q15", n, stages, n, 5u * n * stages,
+                        riscv_biquad_cascade_df1_q15(&Sdf1_q15, src_q15, dst_q15, n));
+      RISCV_BENCH_SWEEP("riscv_biquad_cascade_df2T_f32", "f32", n, stages, n, 5u * n * stages,
+                        riscv_biquad_cascade_df2T_f32(&Sdf2T_f32, src_f32, dst_f32, n));
+    }
+  }
+
+  /*Complex FFTs over the length, (len / 2) * log2(len) radix-2 butterflies, computed in place on the inputs*/
+  for (f = 0u, len = 16u, log2n = 4u; (f < NUM_OF(cfft_f32)) && (len <= RISCV_SWEEP_MAX_FFT); f++, len <<= 1, log2n++)
+  {
+    RISCV_BENCH_SWEEP("riscv_cfft_f32", "f32", len, 0, len, (len / 2u) * log2n, riscv_cfft_f32(cfft_f32[f], src_f32, 0, 1));
+    RISCV_BENCH_SWEEP("riscv_cfft_q31", "q31", len, 0, len, (len / 2u) * log2n, riscv_cfft_q31(cfft_q31[f], src_q31, 0, 1));
+    RISCV_BENCH_SWEEP("riscv_cfft_q15", "q15", len, 0, len, (len / 2u) * log2n, riscv_cfft_q15(cfft_q15[f], src_q15, 0, 1));
+  }
+
+  return 0;
+}
@@ -7,7 +7,6 @@
 #include "riscv_const_structs.h"
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 
 
 #define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
@@ -17,31 +16,14 @@ printf("\n\n")
 //#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
 #define TEST_LENGTH_SAMPLES 128
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5() *(volatile int*) (GPIO_REG_PADOUT) = 0x00;
-
-
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
 *Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "TransformFunctions1"
+#include "../common/riscv_bench.h"
 
 float32_t testInput_f32[TEST_LENGTH_SAMPLES] = 
 {   
@@ -102,6 +84,9 @@ q31_t testInput_q31[TEST_LENGTH_SAMPLES] =
 0x00080000, 	0, 	0x110C0000, 	0, 	0x3A420000, 	0, 	0xA2120000, 	0, 
 };
 
+float32_t testOutput_f32[TEST_LENGTH_SAMPLES];
+riscv_bfp_q15 bfpInput_q15 = { testInput_q15, TEST_LENGTH_SAMPLES, 0 };
+
 uint32_t fftSize = 64;
 uint32_t ifftFlag = 0;
 uint32_t doBitReverse = 1;
@@ -110,26 +95,40 @@ uint32_t doBitReverse = 1;
 
 int32_t main(void)
 {
+  riscv_bench_header();
   //printf("bitrev =%d\n",doBitReverse);
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_cfft_f32(&riscv_cfft_sR_f32_len64, testInput_f32, ifftFlag, doBitReverse);
-  perf_stop();
-  printf("riscv_cfft_f32: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_cfft_f32", "f32", 64,
+    riscv_cfft_f32(&riscv_cfft_sR_f32_len64, testInput_f32, ifftFlag, doBitReverse));
 #ifdef PRINT_OUTPUT
   PRINT_F32(testInput_f32,fftSize);
 #endif
 
-  perf_reset();
-  perf_enable_id(EVENT_ID);	
-  riscv_cfft_q15(&riscv_cfft_sR_q15_len64, testInput_q15, ifftFlag, doBitReverse);
-  perf_stop();
-  printf("riscv_cfft_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_cfft_q15", "q15", 64,
+    riscv_cfft_q15(&riscv_cfft_sR_q15_len64, testInput_q15, ifftFlag, doBitReverse));
 #ifdef PRINT_OUTPUT
   PRINT_Q(testInput_q15,fftSize);
 #endif
 
+  RISCV_BENCH("riscv_cfft_bfp_q15", "q15", 64,
+    riscv_cfft_bfp_q15(&riscv_cfft_sR_q15_len64, &bfpInput_q15, ifftFlag, doBitReverse));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testInput_q15,fftSize);
+  printf("exponent %d\n", bfpInput_q15.exponent);
+#endif
+
+  RISCV_BENCH("riscv_cfft_ordered_f32", "f32", 64,
+    riscv_cfft_ordered_f32(&riscv_cfft_sR_f32_len64, testInput_f32, testOutput_f32, ifftFlag));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,fftSize);
+#endif
+
+  RISCV_BENCH("riscv_cfft_oop_f32", "f32", 64,
+    riscv_cfft_oop_f32(&riscv_cfft_sR_f32_len64, testInput_f32, testOutput_f32, ifftFlag, doBitReverse));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,fftSize);
+#endif
+
 
   printf("End\n");
 
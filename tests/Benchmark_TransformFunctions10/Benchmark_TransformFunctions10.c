@@ -0,0 +1,88 @@
+#include "riscv_math.h"
+#include "gpio.h" //for indication for benchmarking
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include <stdio.h>
+#include "riscv_const_structs.h"
+#include "bench.h"
+
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define FFT_LEN 256
+#define NUM_CHANNELS 4
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The batched CFFT of NUM_CHANNELS channels is measured next to the same channels transformed one
+by one, the reported length is the total number of complex samples.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions10"
+#include "../common/riscv_bench.h"
+
+float32_t testInput_f32[2*FFT_LEN*NUM_CHANNELS];
+q15_t testInput_q15[2*FFT_LEN*NUM_CHANNELS];
+
+uint32_t ifftFlag = 0;
+uint32_t doBitReverse = 1;
+
+static void fill_input(void)
+{
+  uint32_t i;
+  uint32_t seed = 1u;
+
+  for (i = 0; i < 2*FFT_LEN*NUM_CHANNELS; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    testInput_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    testInput_q15[i] = (q15_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000);
+  }
+}
+
+int32_t main(void)
+{
+  uint32_t c;
+
+  riscv_bench_header();
+
+/*Tests*/
+  fill_input();
+  RISCV_BENCH("riscv_cfft_f32", "f32", FFT_LEN*NUM_CHANNELS,
+    for (c = 0; c < NUM_CHANNELS; c++)
+      riscv_cfft_f32(&riscv_cfft_sR_f32_len256, testInput_f32 + 2*FFT_LEN*c, ifftFlag, doBitReverse));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testInput_f32,2*FFT_LEN);
+#endif
+
+  fill_input();
+  RISCV_BENCH("riscv_cfft_batch_f32", "f32", FFT_LEN*NUM_CHANNELS,
+    riscv_cfft_batch_f32(&riscv_cfft_sR_f32_len256, testInput_f32, NUM_CHANNELS, ifftFlag, doBitReverse));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testInput_f32,2*FFT_LEN);
+#endif
+
+  fill_input();
+  RISCV_BENCH("riscv_cfft_q15", "q15", FFT_LEN*NUM_CHANNELS,
+    for (c = 0; c < NUM_CHANNELS; c++)
+      riscv_cfft_q15(&riscv_cfft_sR_q15_len256, testInput_q15 + 2*FFT_LEN*c, ifftFlag, doBitReverse));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testInput_q15,2*FFT_LEN);
+#endif
+
+  fill_input();
+  RISCV_BENCH("riscv_cfft_batch_q15", "q15", FFT_LEN*NUM_CHANNELS,
+    riscv_cfft_batch_q15(&riscv_cfft_sR_q15_len256, testInput_q15, NUM_CHANNELS, ifftFlag, doBitReverse));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testInput_q15,2*FFT_LEN);
+#endif
+
+  printf("End\n");
+
+ return 0;
+}
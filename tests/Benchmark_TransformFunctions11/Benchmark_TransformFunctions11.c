@@ -0,0 +1,119 @@
+#include "riscv_math.h"
+#include "gpio.h" //for indication for benchmarking
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include <stdio.h>
+#include "riscv_const_structs.h"
+#include "bench.h"
+
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define FFT_LEN 256
+#define HOP_SIZE 128
+#define BLOCK_SIZE 640
+#define NUM_FRAMES (((BLOCK_SIZE - FFT_LEN) / HOP_SIZE) + 1)
+#define NUM_BINS ((FFT_LEN / 2) + 1)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A block of BLOCK_SIZE samples is pushed into a fresh STFT instance, which outputs NUM_FRAMES magnitude
+spectra of FFT_LEN samples every HOP_SIZE samples.  The same frames are also computed with the
+window, RFFT and magnitude functions called one after the other.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions11"
+#include "../common/riscv_bench.h"
+
+float32_t testInput_f32[BLOCK_SIZE];
+float32_t window_f32[FFT_LEN];
+float32_t ring_f32[FFT_LEN];
+float32_t scratch_f32[FFT_LEN];
+float32_t spectrum_f32[FFT_LEN];
+float32_t testOutput_f32[NUM_FRAMES*NUM_BINS];
+
+q15_t testInput_q15[BLOCK_SIZE];
+q15_t window_q15[FFT_LEN];
+q15_t ring_q15[FFT_LEN];
+q15_t scratch_q15[FFT_LEN];
+q15_t spectrum_q15[2*FFT_LEN];
+q15_t testOutput_q15[NUM_FRAMES*NUM_BINS];
+
+riscv_stft_instance_f32 S_stft_f32;
+riscv_stft_instance_q15 S_stft_q15;
+riscv_rfft_fast_instance_f32 S_rfft_f32;
+riscv_rfft_instance_q15 S_rfft_q15;
+
+int32_t main(void)
+{
+  uint32_t i, f;
+  uint32_t seed = 1u;
+  float32_t w;
+
+  riscv_bench_header();
+
+  /*Hann window and LCG-seeded input*/
+  for (i = 0; i < FFT_LEN; i++)
+  {
+    w = 0.5f - (0.5f * riscv_cos_f32((6.28318530717959f * (float32_t) i) / FFT_LEN));
+    window_f32[i] = w;
+    window_q15[i] = (q15_t) (w * 32767.0f);
+  }
+
+  for (i = 0; i < BLOCK_SIZE; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    testInput_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    testInput_q15[i] = (q15_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000);
+  }
+
+/*Init*/
+  riscv_rfft_fast_init_f32(&S_rfft_f32, FFT_LEN);
+  riscv_rfft_init_q15(&S_rfft_q15, FFT_LEN, 0, 1);
+
+/*Tests*/
+  RISCV_BENCH("riscv_stft_f32", "f32", BLOCK_SIZE,
+    riscv_stft_init_f32(&S_stft_f32, FFT_LEN, HOP_SIZE, 0, window_f32, ring_f32, scratch_f32);
+    riscv_stft_f32(&S_stft_f32, testInput_f32, BLOCK_SIZE, testOutput_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,NUM_BINS);
+#endif
+
+  RISCV_BENCH("riscv_stft_chain_f32", "f32", BLOCK_SIZE,
+    for (f = 0; f < NUM_FRAMES; f++)
+    {
+      riscv_mult_f32(testInput_f32 + (f * HOP_SIZE), window_f32, scratch_f32, FFT_LEN);
+      riscv_rfft_fast_f32(&S_rfft_f32, scratch_f32, spectrum_f32, 0);
+      riscv_cmplx_mag_f32(spectrum_f32, testOutput_f32 + (f * NUM_BINS), FFT_LEN / 2);
+    });
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,NUM_BINS);
+#endif
+
+  RISCV_BENCH("riscv_stft_q15", "q15", BLOCK_SIZE,
+    riscv_stft_init_q15(&S_stft_q15, FFT_LEN, HOP_SIZE, 0, window_q15, ring_q15, scratch_q15);
+    riscv_stft_q15(&S_stft_q15, testInput_q15, BLOCK_SIZE, testOutput_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,NUM_BINS);
+#endif
+
+  RISCV_BENCH("riscv_stft_chain_q15", "q15", BLOCK_SIZE,
+    for (f = 0; f < NUM_FRAMES; f++)
+    {
+      riscv_mult_q15(testInput_q15 + (f * HOP_SIZE), window_q15, scratch_q15, FFT_LEN);
+      riscv_rfft_q15(&S_rfft_q15, scratch_q15, spectrum_q15);
+      riscv_cmplx_mag_q15(spectrum_q15, testOutput_q15 + (f * NUM_BINS), NUM_BINS);
+    });
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,NUM_BINS);
+#endif
+
+  printf("End\n");
+
+ return 0;
+}
@@ -0,0 +1,91 @@
+#include "riscv_math.h"
+#include "gpio.h" //for indication for benchmarking
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include <stdio.h>
+#include "riscv_const_structs.h"
+#include "bench.h"
+
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define FFT_LEN 512
+#define NUM_FILTERS 40
+#define NUM_COEFS 13
+#define MAX_WEIGHTS (FFT_LEN + NUM_FILTERS)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The MFCC front end is measured on a 512-sample frame at 16 kHz with 40 triangular mel filters up
+to 8 kHz and 13 cepstral coefficients, the usual keyword spotting setup.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions12"
+#include "../common/riscv_bench.h"
+
+/* Mel spaced filter edges in bins, filter m rises from edge m to edge m+1 and falls to edge m+2 */
+const uint16_t melEdges[NUM_FILTERS + 2] =
+{
+    0,   1,   2,   4,   6,   8,  10,  12,  14,  16,  19,  21,  24,  27,
+   30,  33,  37,  41,  45,  49,  54,  59,  64,  69,  75,  81,  88,  95,
+  103, 110, 119, 128, 137, 148, 158, 170, 182, 195, 209, 224, 239, 256
+};
+
+float32_t testInput_f32[FFT_LEN];
+float32_t window_f32[FFT_LEN];
+float32_t scratch_f32[2*FFT_LEN];
+float32_t filterCoefs_f32[MAX_WEIGHTS];
+uint16_t filterPos[2*NUM_FILTERS];
+float32_t dctCoefs_f32[NUM_COEFS*NUM_FILTERS];
+float32_t testOutput_f32[NUM_COEFS];
+
+riscv_mfcc_instance_f32 S_mfcc;
+
+int32_t main(void)
+{
+  uint32_t i, m, k, a, b, c;
+  uint32_t numWeights = 0u;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  /*Hann window, triangular filters and LCG-seeded input*/
+  for (i = 0; i < FFT_LEN; i++)
+  {
+    window_f32[i] = 0.5f - (0.5f * riscv_cos_f32((6.28318530717959f * (float32_t) i) / FFT_LEN));
+    seed = seed * 1103515245u + 12345u;
+    testInput_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+  }
+
+  for (m = 0; m < NUM_FILTERS; m++)
+  {
+    a = melEdges[m];
+    b = melEdges[m + 1];
+    c = melEdges[m + 2];
+    filterPos[2*m] = (uint16_t) a;
+    filterPos[2*m + 1] = (uint16_t) (c - a + 1);
+
+    for (k = a; k <= c; k++)
+    {
+      filterCoefs_f32[numWeights++] = (k < b) ? ((float32_t) (k - a) / (float32_t) (b - a)) :
+                                                ((float32_t) (c - k) / (float32_t) (c - b));
+    }
+  }
+
+/*Tests*/
+  RISCV_BENCH("riscv_mfcc_init_f32", "f32", NUM_COEFS*NUM_FILTERS,
+    riscv_mfcc_init_f32(&S_mfcc, FFT_LEN, NUM_FILTERS, NUM_COEFS, window_f32, filterPos, filterCoefs_f32, dctCoefs_f32));
+
+  RISCV_BENCH("riscv_mfcc_f32", "f32", FFT_LEN,
+    riscv_mfcc_f32(&S_mfcc, testInput_f32, testOutput_f32, scratch_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,NUM_COEFS);
+#endif
+
+  printf("End\n");
+
+ return 0;
+}
@@ -0,0 +1,85 @@
+#include "riscv_math.h"
+#include "gpio.h" //for indication for benchmarking
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include <stdio.h>
+#include "riscv_const_structs.h"
+#include "bench.h"
+
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define MAX_DCT_LEN 32
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The fixed-size DCT-II and DCT-III are measured at 8, 16 and 32 points, each DCT-III runs on the
+output of the DCT-II of the same length.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions13"
+#include "../common/riscv_bench.h"
+
+float32_t testInput_f32[MAX_DCT_LEN];
+float32_t testCoef_f32[MAX_DCT_LEN];
+float32_t testOutput_f32[MAX_DCT_LEN];
+q15_t testInput_q15[MAX_DCT_LEN];
+q15_t testCoef_q15[MAX_DCT_LEN];
+q15_t testOutput_q15[MAX_DCT_LEN];
+
+int32_t main(void)
+{
+  uint32_t i;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (i = 0; i < MAX_DCT_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    testInput_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    testInput_q15[i] = (q15_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000);
+  }
+
+/*Tests*/
+  RISCV_BENCH("riscv_dct2_8_f32", "f32", 8, riscv_dct2_8_f32(testInput_f32, testCoef_f32));
+  RISCV_BENCH("riscv_dct3_8_f32", "f32", 8, riscv_dct3_8_f32(testCoef_f32, testOutput_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,8);
+#endif
+  RISCV_BENCH("riscv_dct2_16_f32", "f32", 16, riscv_dct2_16_f32(testInput_f32, testCoef_f32));
+  RISCV_BENCH("riscv_dct3_16_f32", "f32", 16, riscv_dct3_16_f32(testCoef_f32, testOutput_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,16);
+#endif
+  RISCV_BENCH("riscv_dct2_32_f32", "f32", 32, riscv_dct2_32_f32(testInput_f32, testCoef_f32));
+  RISCV_BENCH("riscv_dct3_32_f32", "f32", 32, riscv_dct3_32_f32(testCoef_f32, testOutput_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,32);
+#endif
+
+  RISCV_BENCH("riscv_dct2_8_q15", "q15", 8, riscv_dct2_8_q15(testInput_q15, testCoef_q15));
+  RISCV_BENCH("riscv_dct3_8_q15", "q15", 8, riscv_dct3_8_q15(testCoef_q15, testOutput_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,8);
+#endif
+  RISCV_BENCH("riscv_dct2_16_q15", "q15", 16, riscv_dct2_16_q15(testInput_q15, testCoef_q15));
+  RISCV_BENCH("riscv_dct3_16_q15", "q15", 16, riscv_dct3_16_q15(testCoef_q15, testOutput_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,16);
+#endif
+  RISCV_BENCH("riscv_dct2_32_q15", "q15", 32, riscv_dct2_32_q15(testInput_q15, testCoef_q15));
+  RISCV_BENCH("riscv_dct3_32_q15", "q15", 32, riscv_dct3_32_q15(testCoef_q15, testOutput_q15));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,32);
+#endif
+
+  printf("End\n");
+
+ return 0;
+}
@@ -0,0 +1,91 @@
+#include "riscv_math.h"
+#include "gpio.h" //for indication for benchmarking
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include <stdio.h>
+#include "riscv_const_structs.h"
+#include "bench.h"
+
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define MAX_FFT_LEN 2048
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_cfft_f32 and riscv_cfft_q15 are measured at 64, 128, 256 and 2048 points, which covers the
+radix-8 only and the radix8by2/radix8by4 first stages of the floating-point transform.
+Every run first restores its input with memcpy, which costs the same in both builds below.
+*Build the benchmark once as it is and once with the RISCV_DSP_COMPACT_TWIDDLE CMake option
+(RISCV_MATH_COMPACT_TWIDDLE), which reports the suite as TransformFunctions14_compact. The two sets
+of BENCH lines give the cycle cost of the quarter-wave twiddle tables against the RAM they save.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#if defined (RISCV_MATH_COMPACT_TWIDDLE)
+#define RISCV_BENCH_SUITE "TransformFunctions14_compact"
+#else
+#define RISCV_BENCH_SUITE "TransformFunctions14"
+#endif
+#include "../common/riscv_bench.h"
+
+float32_t testInput_f32[2 * MAX_FFT_LEN];
+float32_t testOutput_f32[2 * MAX_FFT_LEN];
+q15_t testInput_q15[2 * MAX_FFT_LEN];
+q15_t testOutput_q15[2 * MAX_FFT_LEN];
+
+int32_t main(void)
+{
+  uint32_t i;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (i = 0; i < (2 * MAX_FFT_LEN); i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    testInput_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    testInput_q15[i] = (q15_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000);
+  }
+
+/*Tests*/
+  RISCV_BENCH("riscv_cfft_f32", "f32", 64,
+    memcpy(testOutput_f32, testInput_f32, sizeof(float32_t) * 2 * 64);
+    riscv_cfft_f32(&riscv_cfft_sR_f32_len64, testOutput_f32, 0, 1));
+  RISCV_BENCH("riscv_cfft_f32", "f32", 128,
+    memcpy(testOutput_f32, testInput_f32, sizeof(float32_t) * 2 * 128);
+    riscv_cfft_f32(&riscv_cfft_sR_f32_len128, testOutput_f32, 0, 1));
+  RISCV_BENCH("riscv_cfft_f32", "f32", 256,
+    memcpy(testOutput_f32, testInput_f32, sizeof(float32_t) * 2 * 256);
+    riscv_cfft_f32(&riscv_cfft_sR_f32_len256, testOutput_f32, 0, 1));
+  RISCV_BENCH("riscv_cfft_f32", "f32", 2048,
+    memcpy(testOutput_f32, testInput_f32, sizeof(float32_t) * 2 * 2048);
+    riscv_cfft_f32(&riscv_cfft_sR_f32_len2048, testOutput_f32, 0, 1));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,2*2048);
+#endif
+
+  RISCV_BENCH("riscv_cfft_q15", "q15", 64,
+    memcpy(testOutput_q15, testInput_q15, sizeof(q15_t) * 2 * 64);
+    riscv_cfft_q15(&riscv_cfft_sR_q15_len64, testOutput_q15, 0, 1));
+  RISCV_BENCH("riscv_cfft_q15", "q15", 128,
+    memcpy(testOutput_q15, testInput_q15, sizeof(q15_t) * 2 * 128);
+    riscv_cfft_q15(&riscv_cfft_sR_q15_len128, testOutput_q15, 0, 1));
+  RISCV_BENCH("riscv_cfft_q15", "q15", 256,
+    memcpy(testOutput_q15, testInput_q15, sizeof(q15_t) * 2 * 256);
+    riscv_cfft_q15(&riscv_cfft_sR_q15_len256, testOutput_q15, 0, 1));
+  RISCV_BENCH("riscv_cfft_q15", "q15", 2048,
+    memcpy(testOutput_q15, testInput_q15, sizeof(q15_t) * 2 * 2048);
+    riscv_cfft_q15(&riscv_cfft_sR_q15_len2048, testOutput_q15, 0, 1));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,2*2048);
+#endif
+
+  printf("End\n");
+
+  return 0;
+}
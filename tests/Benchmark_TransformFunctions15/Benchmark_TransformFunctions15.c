@@ -0,0 +1,139 @@
+#include "riscv_math.h"
+#include "gpio.h" //for indication for benchmarking
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include <stdio.h>
+#include "riscv_const_structs.h"
+#include "bench.h"
+
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
+printf("\n\n")
+#define PRINT_Q(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("0x%X  ",X[i]); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define FFT_LEN 256
+#define NUM_BINS 8
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*NUM_BINS tone bins (the DTMF frequencies at 8 kHz rounded to bins of FFT_LEN) are computed from one
+block of FFT_LEN samples with the Goertzel detectors, with the sliding DFT, and with a real FFT
+followed by the squared magnitude of all bins, which is what the Goertzel and sliding DFT replace.
+*The sliding DFT updates its bins with every sample, so its cycles per sample are the ones to
+compare with the cost of one FFT per FFT_LEN samples.  Its instances are initialized once, every run
+slides the window over another FFT_LEN samples.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions15"
+#include "../common/riscv_bench.h"
+
+const uint16_t tone_bins[NUM_BINS] = {22u, 25u, 27u, 30u, 39u, 43u, 47u, 52u};
+float32_t tone_freqs[NUM_BINS];
+
+float32_t testInput_f32[FFT_LEN];
+float32_t scratch_f32[FFT_LEN];
+float32_t spectrum_f32[FFT_LEN];
+float32_t testOutput_f32[FFT_LEN];
+float32_t goertzel_coefs_f32[NUM_BINS];
+float32_t goertzel_state_f32[2 * NUM_BINS];
+float32_t sdft_twiddle_f32[2 * FFT_LEN];
+float32_t sdft_state_f32[2 * NUM_BINS];
+float32_t sdft_delay_f32[FFT_LEN];
+
+q15_t testInput_q15[FFT_LEN];
+q15_t scratch_q15[FFT_LEN];
+q15_t spectrum_q15[2 * FFT_LEN];
+q15_t testOutput_q15[FFT_LEN];
+q31_t testOutput_q31[NUM_BINS];
+q31_t goertzel_coefs_q15[NUM_BINS];
+q31_t goertzel_state_q15[2 * NUM_BINS];
+q15_t sdft_twiddle_q15[2 * FFT_LEN];
+q31_t sdft_state_q15[2 * NUM_BINS];
+q15_t sdft_delay_q15[FFT_LEN];
+
+riscv_goertzel_instance_f32 S_goertzel_f32;
+riscv_goertzel_instance_q15 S_goertzel_q15;
+riscv_sdft_instance_f32 S_sdft_f32;
+riscv_sdft_instance_q15 S_sdft_q15;
+riscv_rfft_fast_instance_f32 S_rfft_f32;
+riscv_rfft_instance_q15 S_rfft_q15;
+
+int32_t main(void)
+{
+  uint32_t i;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (i = 0; i < FFT_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    testInput_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    testInput_q15[i] = (q15_t)(((int32_t)(seed >> 16) & 0x7FFF) - 0x4000);
+  }
+
+  for (i = 0; i < NUM_BINS; i++)
+  {
+    tone_freqs[i] = (float32_t) tone_bins[i] / FFT_LEN;
+  }
+
+/*Init*/
+  riscv_goertzel_init_f32(&S_goertzel_f32, NUM_BINS, tone_freqs, goertzel_coefs_f32, goertzel_state_f32);
+  riscv_goertzel_init_q15(&S_goertzel_q15, NUM_BINS, tone_freqs, 8, goertzel_coefs_q15, goertzel_state_q15);
+  riscv_sdft_init_f32(&S_sdft_f32, FFT_LEN, NUM_BINS, tone_bins, sdft_twiddle_f32, sdft_state_f32, sdft_delay_f32);
+  riscv_sdft_init_q15(&S_sdft_q15, FFT_LEN, NUM_BINS, tone_bins, sdft_twiddle_q15, sdft_state_q15, sdft_delay_q15);
+  riscv_rfft_fast_init_f32(&S_rfft_f32, FFT_LEN);
+  riscv_rfft_init_q15(&S_rfft_q15, FFT_LEN, 0, 1);
+
+/*Tests*/
+  RISCV_BENCH("riscv_goertzel_f32", "f32", FFT_LEN,
+    riscv_goertzel_f32(&S_goertzel_f32, testInput_f32, FFT_LEN);
+    riscv_goertzel_power_f32(&S_goertzel_f32, testOutput_f32));
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,NUM_BINS);
+#endif
+
+  RISCV_BENCH("riscv_sdft_f32", "f32", FFT_LEN,
+    riscv_sdft_f32(&S_sdft_f32, testInput_f32, testOutput_f32, FFT_LEN));
+  riscv_cmplx_mag_squared_f32(testOutput_f32, testOutput_f32, NUM_BINS);
+#ifdef PRINT_OUTPUT
+  PRINT_F32(testOutput_f32,NUM_BINS);
+#endif
+
+  RISCV_BENCH("riscv_rfft_power_f32", "f32", FFT_LEN,
+    memcpy(scratch_f32, testInput_f32, sizeof(float32_t) * FFT_LEN);
+    riscv_rfft_fast_f32(&S_rfft_f32, scratch_f32, spectrum_f32, 0);
+    riscv_cmplx_mag_squared_f32(spectrum_f32, testOutput_f32, FFT_LEN / 2));
+#ifdef PRINT_OUTPUT
+  for (i = 0; i < NUM_BINS; i++) printf("%d  ", (int)(testOutput_f32[tone_bins[i]]*100));
+  printf("\n\n");
+#endif
+
+  RISCV_BENCH("riscv_goertzel_q15", "q15", FFT_LEN,
+    riscv_goertzel_q15(&S_goertzel_q15, testInput_q15, FFT_LEN);
+    riscv_goertzel_power_q15(&S_goertzel_q15, testOutput_q31));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q31,NUM_BINS);
+#endif
+
+  RISCV_BENCH("riscv_sdft_q15", "q15", FFT_LEN,
+    riscv_sdft_q15(&S_sdft_q15, testInput_q15, testOutput_q15, FFT_LEN));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,2*NUM_BINS);
+#endif
+
+  RISCV_BENCH("riscv_rfft_power_q15", "q15", FFT_LEN,
+    memcpy(scratch_q15, testInput_q15, sizeof(q15_t) * FFT_LEN);
+    riscv_rfft_q15(&S_rfft_q15, scratch_q15, spectrum_q15);
+    riscv_cmplx_mag_squared_q15(spectrum_q15, testOutput_q15, FFT_LEN / 2));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(testOutput_q15,FFT_LEN / 2);
+#endif
+
+  printf("End\n");
+
+  return 0;
+}
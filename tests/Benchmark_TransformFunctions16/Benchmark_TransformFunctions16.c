@@ -0,0 +1,90 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define FFT_N1 16
+#define FFT_N2 32
+#define FFT_LEN (FFT_N1 * FFT_N2)
+#define TILE_SIZE 2
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_cfft_stream_f32 computes a CFFT of FFT_LEN = FFT_N1 x FFT_N2 points with the data in a buffer that stands
+for L2 and TILE_SIZE columns or rows in L1, and is compared with riscv_cfft_f32 with the data in place.  The in-place call writes the bins back to the
+L2 buffer, which is how lengths above 4096 run with one buffer in L2.
+The default of 512 points fits the 32 KB of PULPino, the same code streams 4096 points and more from L2 on a
+PULP cluster.  PULPino has no DMA, so the copies of riscv_dma_start_memcpy() are part of the cycles.
+*Define PRINT_OUTPUT to print the largest difference between the two transforms
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions16"
+#include "../common/riscv_bench.h"
+
+float32_t input_f32[2 * FFT_LEN];
+float32_t buf_f32[2 * FFT_LEN];
+float32_t output_f32[2 * FFT_LEN];
+float32_t ref_f32[2 * FFT_LEN];
+float32_t twiddle_f32[RISCV_CFFT_STREAM_TWIDDLE_SIZE(FFT_N1, FFT_N2)];
+float32_t l1_f32[RISCV_CFFT_STREAM_L1_SIZE(FFT_N1, FFT_N2, TILE_SIZE)];
+
+int32_t main(void)
+{
+  riscv_dma_instance D;
+  riscv_cfft_stream_instance_f32 S;
+  uint32_t i;
+  uint32_t seed = 1u;
+#ifdef PRINT_OUTPUT
+  float32_t diff = 0.0f;
+#endif
+
+  riscv_bench_header();
+
+  for (i = 0; i < 2 * FFT_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    input_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+  }
+
+  riscv_dma_init(&D, NULL, NULL, NULL);
+  riscv_cfft_stream_init_f32(&S, &riscv_cfft_sR_f32_len16, &riscv_cfft_sR_f32_len32, TILE_SIZE, twiddle_f32, l1_f32);
+
+/*Tests*/
+  RISCV_BENCH("riscv_cfft_f32", "f32", FFT_LEN,
+    memcpy(ref_f32, input_f32, sizeof(input_f32));
+    riscv_cfft_f32(&riscv_cfft_sR_f32_len512, ref_f32, 0, 1));
+
+  RISCV_BENCH("riscv_cfft_stream_f32", "f32", FFT_LEN,
+    memcpy(buf_f32, input_f32, sizeof(input_f32));
+    riscv_cfft_stream_f32(&D, &S, buf_f32, output_f32, 0));
+
+  RISCV_BENCH("riscv_cfft_stream_f32_inplace", "f32", FFT_LEN,
+    memcpy(buf_f32, input_f32, sizeof(input_f32));
+    riscv_cfft_stream_f32(&D, &S, buf_f32, buf_f32, 0));
+
+#ifdef PRINT_OUTPUT
+  for (i = 0; i < 2 * FFT_LEN; i++)
+  {
+    diff = (fabsf(output_f32[i] - ref_f32[i]) > diff) ? fabsf(output_f32[i] - ref_f32[i]) : diff;
+  }
+  printf("riscv_cfft_stream_f32: max difference %d e-6\n", (int)(diff * 1000000.0f));
+
+  diff = 0.0f;
+  for (i = 0; i < 2 * FFT_LEN; i++)
+  {
+    diff = (fabsf(buf_f32[i] - ref_f32[i]) > diff) ? fabsf(buf_f32[i] - ref_f32[i]) : diff;
+  }
+  printf("riscv_cfft_stream_f32 in place: max difference %d e-6\n", (int)(diff * 1000000.0f));
+#endif
+
+  printf("End\n");
+
+  return 0;
+}
@@ -0,0 +1,101 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define FRAME_LEN 512
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The window apply functions are compared with a full window table applied by riscv_mult_f32/q15 and
+with riscv_q15_to_float followed by riscv_mult_f32, the CHECK lines must report equal.
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions17"
+#include "../common/riscv_bench.h"
+
+float32_t half_f32[FRAME_LEN / 2], full_f32[FRAME_LEN];
+q15_t half_q15[FRAME_LEN / 2], full_q15[FRAME_LEN];
+q31_t half_q31[FRAME_LEN / 2];
+float32_t src_f32[FRAME_LEN], dst_f32[FRAME_LEN], ref_f32[FRAME_LEN];
+q15_t src_q15[FRAME_LEN], dst_q15[FRAME_LEN], ref_q15[FRAME_LEN];
+
+int32_t main(void)
+{
+  uint32_t i;
+  uint32_t seed = 1u;
+  int32_t fail = 0;
+
+  riscv_bench_header();
+
+  for (i = 0; i < FRAME_LEN; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    src_q15[i] = (q15_t)((int32_t)(seed >> 16) - 32768);
+  }
+
+  RISCV_BENCH("riscv_window_f32(hann)", "f32", FRAME_LEN,
+    riscv_window_f32(RISCV_WINDOW_HANN, 0.0f, FRAME_LEN, half_f32));
+  RISCV_BENCH("riscv_window_f32(kaiser)", "f32", FRAME_LEN,
+    riscv_window_f32(RISCV_WINDOW_KAISER, 8.6f, FRAME_LEN, half_f32));
+  RISCV_BENCH("riscv_window_q31(blackman)", "q31", FRAME_LEN,
+    riscv_window_q31(RISCV_WINDOW_BLACKMAN, 0.0f, FRAME_LEN, half_q31));
+  RISCV_BENCH("riscv_window_q15(hann)", "q15", FRAME_LEN,
+    riscv_window_q15(RISCV_WINDOW_HANN, 0.0f, FRAME_LEN, half_q15));
+  riscv_window_f32(RISCV_WINDOW_HANN, 0.0f, FRAME_LEN, half_f32);
+
+  /* Full tables for the two-pass reference */
+  for (i = 0; i < FRAME_LEN / 2; i++)
+  {
+    full_f32[i] = full_f32[FRAME_LEN - 1 - i] = half_f32[i];
+    full_q15[i] = full_q15[FRAME_LEN - 1 - i] = half_q15[i];
+  }
+
+  RISCV_BENCH("riscv_mult_q15", "q15", FRAME_LEN,
+    riscv_mult_q15(src_q15, full_q15, ref_q15, FRAME_LEN));
+  RISCV_BENCH("riscv_window_apply_q15", "q15", FRAME_LEN,
+    riscv_window_apply_q15(src_q15, half_q15, dst_q15, FRAME_LEN));
+  if(memcmp(dst_q15, ref_q15, sizeof(dst_q15)) != 0)
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_window_apply_q15: %s\n", (fail == 0) ? "equal" : "differ");
+
+  RISCV_BENCH("riscv_q15_to_float+riscv_mult_f32", "f32", FRAME_LEN,
+    riscv_q15_to_float(src_q15, src_f32, FRAME_LEN);
+    riscv_mult_f32(src_f32, full_f32, ref_f32, FRAME_LEN));
+  RISCV_BENCH("riscv_window_apply_q15_f32", "f32", FRAME_LEN,
+    riscv_window_apply_q15_f32(src_q15, half_f32, dst_f32, FRAME_LEN));
+  for (i = 0; i < FRAME_LEN; i++)
+  {
+    if(fabsf(dst_f32[i] - ref_f32[i]) > 1e-6f)
+    {
+      fail = 1;
+    }
+  }
+  printf("CHECK riscv_window_apply_q15_f32: %s\n", (fail == 0) ? "equal" : "differ");
+
+  RISCV_BENCH("riscv_window_apply_f32", "f32", FRAME_LEN,
+    riscv_window_apply_f32(src_f32, half_f32, dst_f32, FRAME_LEN));
+  if(memcmp(dst_f32, ref_f32, sizeof(dst_f32)) != 0)
+  {
+    fail = 1;
+  }
+  printf("CHECK riscv_window_apply_f32: %s\n", (fail == 0) ? "equal" : "differ");
+#ifdef PRINT_OUTPUT
+  for(i = 0 ; i < 16 ; i++)
+    {
+      printf("%d\n",(int)(dst_f32[i]*1000));
+    }
+#endif
+
+  printf("End\n");
+
+  return fail;
+}
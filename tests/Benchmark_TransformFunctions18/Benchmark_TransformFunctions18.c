@@ -0,0 +1,105 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_common_tables.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define MDCT_N 480
+#define MDCT_N_Q31 256
+#define NUM_FRAMES 6
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*A signal runs through MDCT and IMDCT frame by frame with the sine window, the output must equal the
+input delayed by one frame, the CHECK lines must report equal.
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions18"
+#include "../common/riscv_bench.h"
+
+riscv_mdct_instance_f32 S_f32;
+riscv_mdct_instance_q31 S_q31;
+float32_t twiddle_f32[2 * MDCT_N + 2], window_f32[MDCT_N], scratch_f32[MDCT_N], overlap_f32[MDCT_N];
+q31_t twiddle_q31[7 * MDCT_N_Q31 / 4], window_q31[MDCT_N_Q31], scratch_q31[MDCT_N_Q31], overlap_q31[MDCT_N_Q31];
+uint16_t bitrev_q31[RISCVBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH];
+float32_t src_f32[(NUM_FRAMES + 1) * MDCT_N], dst_f32[NUM_FRAMES * MDCT_N], coef_f32[MDCT_N];
+q31_t src_q31[(NUM_FRAMES + 1) * MDCT_N_Q31], dst_q31[NUM_FRAMES * MDCT_N_Q31], coef_q31[MDCT_N_Q31];
+
+int32_t main(void)
+{
+  uint32_t i, f;
+  uint32_t seed = 1u;
+  int32_t fail = 0;
+
+  riscv_bench_header();
+
+  for (i = 0; i < (NUM_FRAMES + 1) * MDCT_N; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    src_f32[i] = (float32_t)((int32_t)(seed >> 16) - 32768) / 32768.0f;
+  }
+  for (i = 0; i < (NUM_FRAMES + 1) * MDCT_N_Q31; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    src_q31[i] = (q31_t)(seed & 0xFFFFFF00u) >> 1;
+  }
+
+  riscv_window_f32(RISCV_WINDOW_SINE, 0.0f, 2 * MDCT_N, window_f32);
+  riscv_window_q31(RISCV_WINDOW_SINE, 0.0f, 2 * MDCT_N_Q31, window_q31);
+  riscv_mdct_init_f32(&S_f32, MDCT_N, twiddle_f32, window_f32, scratch_f32, overlap_f32);
+  riscv_mdct_init_q31(&S_q31, MDCT_N_Q31, twiddle_q31, bitrev_q31, window_q31, scratch_q31, overlap_q31);
+
+  RISCV_BENCH("riscv_mdct_f32", "f32", MDCT_N,
+    riscv_mdct_f32(&S_f32, src_f32, coef_f32));
+  RISCV_BENCH("riscv_imdct_f32", "f32", MDCT_N,
+    riscv_imdct_f32(&S_f32, coef_f32, dst_f32));
+  RISCV_BENCH("riscv_mdct_q31", "q31", MDCT_N_Q31,
+    riscv_mdct_q31(&S_q31, src_q31, coef_q31));
+  RISCV_BENCH("riscv_imdct_q31", "q31", MDCT_N_Q31,
+    riscv_imdct_q31(&S_q31, coef_q31, dst_q31));
+
+  /* Frame f of the output completes input frame f from the frames f-1 and f */
+  riscv_mdct_init_f32(&S_f32, MDCT_N, twiddle_f32, window_f32, scratch_f32, overlap_f32);
+  riscv_mdct_init_q31(&S_q31, MDCT_N_Q31, twiddle_q31, bitrev_q31, window_q31, scratch_q31, overlap_q31);
+  for (f = 0; f < NUM_FRAMES; f++)
+  {
+    riscv_mdct_f32(&S_f32, src_f32 + f * MDCT_N, coef_f32);
+    riscv_imdct_f32(&S_f32, coef_f32, dst_f32 + f * MDCT_N);
+    riscv_mdct_q31(&S_q31, src_q31 + f * MDCT_N_Q31, coef_q31);
+    riscv_imdct_q31(&S_q31, coef_q31, dst_q31 + f * MDCT_N_Q31);
+  }
+
+  for (i = MDCT_N; i < NUM_FRAMES * MDCT_N; i++)
+  {
+    if(fabsf(dst_f32[i] - src_f32[i]) > 1e-5f)
+    {
+      fail = 1;
+    }
+  }
+  printf("CHECK riscv_mdct_f32/riscv_imdct_f32: %s\n", (fail == 0) ? "equal" : "differ");
+
+  for (i = MDCT_N_Q31; i < NUM_FRAMES * MDCT_N_Q31; i++)
+  {
+    if(fabs((float64_t) dst_q31[i] - (float64_t) src_q31[i]) > 2147483648.0 * 1e-4)
+    {
+      fail = 1;
+    }
+  }
+  printf("CHECK riscv_mdct_q31/riscv_imdct_q31: %s\n", (fail == 0) ? "equal" : "differ");
+#ifdef PRINT_OUTPUT
+  for(i = 0 ; i < 16 ; i++)
+    {
+      printf("%d\n",(int)(dst_f32[MDCT_N + i]*1000));
+    }
+#endif
+
+  printf("End\n");
+
+  return fail;
+}
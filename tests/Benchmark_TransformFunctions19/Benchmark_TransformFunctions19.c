@@ -0,0 +1,86 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define FFT_LEN 256
+#define NUM_BANDS 8
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The band energies of a real FFT spectrum must equal the sums of the squared magnitudes of their bins,
+the CHECK lines must report equal.
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions19"
+#include "../common/riscv_bench.h"
+
+riscv_rfft_fast_instance_f32 S_rfft_f32;
+riscv_rfft_instance_q15 S_rfft_q15;
+float32_t src_f32[FFT_LEN], spec_f32[FFT_LEN], mag_f32[FFT_LEN / 2 + 1];
+q15_t src_q15[FFT_LEN], spec_q15[2 * FFT_LEN] __attribute__((aligned(4)));
+float32_t energy_f32[NUM_BANDS];
+q63_t energy_q15[NUM_BANDS];
+/* Bands from DC to Nyquist, the first one holds DC only and the last one Nyquist only */
+uint16_t bandEdges[NUM_BANDS + 1] = { 0, 1, 4, 9, 20, 41, 80, 128, 129 };
+
+int32_t main(void)
+{
+  uint32_t i, b;
+  int32_t fail = 0;
+  float32_t ref;
+  q63_t ref_q15;
+
+  riscv_bench_header();
+
+  for (i = 0; i < FFT_LEN; i++)
+  {
+    src_f32[i] = 0.3f * sinf(0.31f * i) + 0.2f * cosf(1.7f * i) + 0.1f + ((i & 1u) ? 0.05f : -0.05f);
+    src_q15[i] = (q15_t) (src_f32[i] * 32767.0f);
+  }
+
+  riscv_rfft_fast_init_f32(&S_rfft_f32, FFT_LEN);
+  riscv_rfft_fast_f32(&S_rfft_f32, src_f32, spec_f32, 0u);
+  riscv_rfft_init_q15(&S_rfft_q15, FFT_LEN, 0, 1);
+  riscv_rfft_q15(&S_rfft_q15, src_q15, spec_q15);
+
+  RISCV_BENCH("riscv_band_energy_f32", "f32", FFT_LEN,
+    riscv_band_energy_f32(spec_f32, FFT_LEN, bandEdges, NUM_BANDS, energy_f32));
+  RISCV_BENCH("riscv_band_energy_q15", "q15", FFT_LEN,
+    riscv_band_energy_q15(spec_q15, FFT_LEN, bandEdges, NUM_BANDS, energy_q15));
+
+  /* Squared magnitudes from DC to Nyquist, DC and Nyquist are packed in the first bin */
+  mag_f32[0] = spec_f32[0] * spec_f32[0];
+  mag_f32[FFT_LEN / 2] = spec_f32[1] * spec_f32[1];
+  riscv_cmplx_mag_squared_f32(spec_f32 + 2, mag_f32 + 1, FFT_LEN / 2 - 1);
+  for (b = 0; b < NUM_BANDS; b++)
+  {
+    for (i = bandEdges[b], ref = 0.0f; i < bandEdges[b + 1]; i++)
+    {
+      ref += mag_f32[i];
+    }
+    if(fabsf(energy_f32[b] - ref) > 1e-5f * ref + 1e-6f)
+    {
+      fail = 1;
+    }
+  }
+  printf("CHECK riscv_band_energy_f32: %s\n", (fail == 0) ? "equal" : "differ");
+
+  for (b = 0; b < NUM_BANDS; b++)
+  {
+    riscv_power_q15(spec_q15 + 2 * bandEdges[b], 2 * (bandEdges[b + 1] - bandEdges[b]), &ref_q15);
+    if(energy_q15[b] != ref_q15)
+    {
+      fail = 1;
+    }
+  }
+  printf("CHECK riscv_band_energy_q15: %s\n", (fail == 0) ? "equal" : "differ");
+
+  return fail;
+}
@@ -0,0 +1,153 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define FFT_LEN 512
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The scaled transforms are compared with riscv_cfft_f32 of the same input: with RISCV_CFFT_SCALE_ALL
+they must shift by log2(FFT_LEN) like riscv_cfft_q15/q31, with RISCV_CFFT_SCALE_BFP a low-level tone
+must come out cleaner than from riscv_cfft_q15/q31, by at least 20 dB for Q15, and the inverse must
+bring the input back.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions20"
+#include "../common/riscv_bench.h"
+
+float32_t ref_f32[2 * FFT_LEN];
+q15_t src_q15[2 * FFT_LEN], buf_q15[2 * FFT_LEN];
+q31_t src_q31[2 * FFT_LEN], buf_q31[2 * FFT_LEN];
+
+/* Signal to noise ratio in dB of x * 2^shift against the reference, both in units of the input LSB */
+static float32_t snr_db(const float32_t * ref, const q31_t * x, uint32_t n, uint32_t shift)
+{
+  float32_t sig = 0.0f, err = 0.0f, d;
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    d = ldexpf((float32_t) x[i], (int) shift) - ref[i];
+    sig += ref[i] * ref[i];
+    err += d * d;
+  }
+  return 10.0f * log10f(sig / (err + 1e-30f));
+}
+
+/* Input of amplitude amp (in Q15 LSB), a tone between two bins and a weaker one */
+static void make_input(float32_t amp)
+{
+  uint32_t i;
+
+  for (i = 0; i < FFT_LEN; i++)
+  {
+    src_q15[2 * i] = (q15_t) (amp * (cosf(0.3711f * i) + 0.01f * cosf(2.2f * i)));
+    src_q15[2 * i + 1] = (q15_t) (amp * sinf(0.3711f * i));
+    src_q31[2 * i] = (q31_t) src_q15[2 * i] << 16;
+    src_q31[2 * i + 1] = (q31_t) src_q15[2 * i + 1] << 16;
+    ref_f32[2 * i] = (float32_t) src_q15[2 * i];
+    ref_f32[2 * i + 1] = (float32_t) src_q15[2 * i + 1];
+  }
+  riscv_cfft_f32(&riscv_cfft_sR_f32_len512, ref_f32, 0u, 1u);
+}
+
+static q31_t wide[2 * FFT_LEN];
+
+static float32_t snr_q15(uint32_t shift)
+{
+  uint32_t i;
+
+  for (i = 0; i < 2 * FFT_LEN; i++)
+  {
+    wide[i] = buf_q15[i];
+  }
+  return snr_db(ref_f32, wide, 2 * FFT_LEN, shift);
+}
+
+static float32_t snr_q31(uint32_t shift)
+{
+  uint32_t i;
+
+  for (i = 0; i < 2 * FFT_LEN; i++)
+  {
+    wide[i] = buf_q31[i] >> 8;
+  }
+  return snr_db(ref_f32, wide, 2 * FFT_LEN, shift + 8u - 16u);
+}
+
+int32_t main(void)
+{
+  uint32_t shift, shiftFwd, shiftInv, i;
+  int32_t fail = 0, ok;
+  float32_t snrFixed, snrScaled;
+
+  riscv_bench_header();
+
+  /* full scale input, every stage scaled */
+  make_input(16000.0f);
+  memcpy(buf_q15, src_q15, sizeof(buf_q15));
+  RISCV_BENCH("riscv_cfft_scaled_q15", "q15", FFT_LEN,
+    shift = riscv_cfft_scaled_q15(&riscv_cfft_sR_q15_len512, buf_q15, 0u, 1u, RISCV_CFFT_SCALE_ALL));
+  memcpy(buf_q15, src_q15, sizeof(buf_q15));
+  shift = riscv_cfft_scaled_q15(&riscv_cfft_sR_q15_len512, buf_q15, 0u, 1u, RISCV_CFFT_SCALE_ALL);
+  snrScaled = snr_q15(shift);
+  ok = (shift == 9u) && (snrScaled > 50.0f);
+  printf("CHECK riscv_cfft_scaled_q15 all stages: shift %u snr %d dB %s\n", shift, (int) snrScaled, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  memcpy(buf_q31, src_q31, sizeof(buf_q31));
+  RISCV_BENCH("riscv_cfft_scaled_q31", "q31", FFT_LEN,
+    shift = riscv_cfft_scaled_q31(&riscv_cfft_sR_q31_len512, buf_q31, 0u, 1u, RISCV_CFFT_SCALE_ALL));
+  memcpy(buf_q31, src_q31, sizeof(buf_q31));
+  shift = riscv_cfft_scaled_q31(&riscv_cfft_sR_q31_len512, buf_q31, 0u, 1u, RISCV_CFFT_SCALE_ALL);
+  snrScaled = snr_q31(shift);
+  ok = (shift == 9u) && (snrScaled > 100.0f);
+  printf("CHECK riscv_cfft_scaled_q31 all stages: shift %u snr %d dB %s\n", shift, (int) snrScaled, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* low-level input, scaled only where a stage could overflow */
+  make_input(200.0f);
+  memcpy(buf_q15, src_q15, sizeof(buf_q15));
+  riscv_cfft_q15(&riscv_cfft_sR_q15_len512, buf_q15, 0u, 1u);
+  snrFixed = snr_q15(9u);
+  memcpy(buf_q15, src_q15, sizeof(buf_q15));
+  shift = riscv_cfft_scaled_q15(&riscv_cfft_sR_q15_len512, buf_q15, 0u, 1u, RISCV_CFFT_SCALE_BFP);
+  snrScaled = snr_q15(shift);
+  ok = (shift < 9u) && (snrScaled > snrFixed + 20.0f);
+  printf("CHECK riscv_cfft_scaled_q15 bfp: shift %u snr %d dB, riscv_cfft_q15 %d dB %s\n",
+         shift, (int) snrScaled, (int) snrFixed, ok ? "ok" : "bad");
+  fail |= !ok;
+  shiftFwd = shift;
+
+  memcpy(buf_q31, src_q31, sizeof(buf_q31));
+  riscv_cfft_q31(&riscv_cfft_sR_q31_len512, buf_q31, 0u, 1u);
+  snrFixed = snr_q31(9u);
+  memcpy(buf_q31, src_q31, sizeof(buf_q31));
+  shift = riscv_cfft_scaled_q31(&riscv_cfft_sR_q31_len512, buf_q31, 0u, 1u, RISCV_CFFT_SCALE_BFP);
+  snrScaled = snr_q31(shift);
+  ok = (shift < 9u) && (snrScaled >= snrFixed);
+  printf("CHECK riscv_cfft_scaled_q31 bfp: shift %u snr %d dB, riscv_cfft_q31 %d dB %s\n",
+         shift, (int) snrScaled, (int) snrFixed, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* the inverse with bfp brings back the input times FFT_LEN * 2^-(shiftFwd + shiftInv) */
+  shiftInv = riscv_cfft_scaled_q15(&riscv_cfft_sR_q15_len512, buf_q15, 1u, 1u, RISCV_CFFT_SCALE_BFP);
+  for (i = 0; i < 2 * FFT_LEN; i++)
+  {
+    ref_f32[i] = ldexpf((float32_t) src_q15[i], 9 - (int) (shiftFwd + shiftInv));
+  }
+  snrScaled = snr_q15(0u);
+  ok = (snrScaled > 40.0f);
+  printf("CHECK riscv_cfft_scaled_q15 bfp inverse: shift %u snr %d dB %s\n", shiftInv, (int) snrScaled, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return fail;
+}
@@ -0,0 +1,131 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define MAX_FFT_LEN 256
+#define NUM_CHANNELS 2
+#define RFFT_LEN 512
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The inverse riscv_cfft_f32 is measured next to the forward one at 256 points, with and without the
+1/fftLen scaling (RISCV_FFT_INVERSE_NOSCALE), and so is the inverse riscv_rfft_fast_f32.
+*At 64, 128 and 256 points, one length for each of the radix-8, radix8by2 and radix8by4 paths, the
+inverse must bring back the input of the forward transform, the unscaled inverse must be fftLen times
+the scaled one and riscv_cfft_ordered_f32, riscv_cfft_oop_f32 and riscv_cfft_batch_f32 must give the
+result of riscv_cfft_f32.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions21"
+#include "../common/riscv_bench.h"
+
+float32_t src_f32[2 * MAX_FFT_LEN * NUM_CHANNELS];
+float32_t buf_f32[2 * MAX_FFT_LEN * NUM_CHANNELS];
+float32_t ref_f32[2 * MAX_FFT_LEN * NUM_CHANNELS];
+float32_t out_f32[2 * MAX_FFT_LEN];
+
+/* Largest difference between x * gain and the reference, relative to the largest reference value */
+static float32_t max_err(const float32_t * ref, const float32_t * x, uint32_t n, float32_t gain)
+{
+  float32_t peak = 0.0f, err = 0.0f, d;
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    d = fabsf(x[i] * gain - ref[i]);
+    err = (d > err) ? d : err;
+    peak = (fabsf(ref[i]) > peak) ? fabsf(ref[i]) : peak;
+  }
+  return err / peak;
+}
+
+static int32_t check_len(const riscv_cfft_instance_f32 * S)
+{
+  uint32_t L = S->fftLen, n = 2u * S->fftLen;
+  float32_t eTrip, eScale, eOrd, eOop, eBatch;
+  int32_t ok;
+
+  /* forward and scaled inverse */
+  memcpy(buf_f32, src_f32, n * sizeof(float32_t));
+  riscv_cfft_f32(S, buf_f32, 0u, 1u);
+  memcpy(out_f32, buf_f32, n * sizeof(float32_t));
+  riscv_cfft_f32(S, buf_f32, 1u, 1u);
+  eTrip = max_err(src_f32, buf_f32, n, 1.0f);
+  memcpy(ref_f32, buf_f32, n * sizeof(float32_t));
+
+  /* unscaled inverse */
+  memcpy(buf_f32, out_f32, n * sizeof(float32_t));
+  riscv_cfft_f32(S, buf_f32, RISCV_FFT_INVERSE_NOSCALE, 1u);
+  eScale = max_err(ref_f32, buf_f32, n, 1.0f / (float32_t) L);
+
+  /* the other entry points */
+  memcpy(buf_f32, out_f32, n * sizeof(float32_t));
+  riscv_cfft_ordered_f32(S, buf_f32, buf_f32 + n, 1u);
+  eOrd = max_err(ref_f32, buf_f32 + n, n, 1.0f);
+  riscv_cfft_oop_f32(S, out_f32, buf_f32, 1u, 1u);
+  eOop = max_err(ref_f32, buf_f32, n, 1.0f);
+  memcpy(buf_f32, out_f32, n * sizeof(float32_t));
+  memcpy(buf_f32 + n, out_f32, n * sizeof(float32_t));
+  riscv_cfft_batch_f32(S, buf_f32, NUM_CHANNELS, 1u, 1u);
+  eBatch = max_err(ref_f32, buf_f32 + n, n, 1.0f);
+
+  ok = (eTrip < 1e-5f) && (eScale < 1e-6f) && (eOrd < 1e-6f) && (eOop < 1e-6f) && (eBatch < 1e-6f);
+  printf("CHECK riscv_cfft_f32 inverse %u: round trip %d, noscale %d, ordered %d, oop %d, batch %d (1e-9) %s\n",
+         L, (int) (eTrip * 1e9f), (int) (eScale * 1e9f), (int) (eOrd * 1e9f), (int) (eOop * 1e9f),
+         (int) (eBatch * 1e9f), ok ? "ok" : "bad");
+  return !ok;
+}
+
+int32_t main(void)
+{
+  riscv_rfft_fast_instance_f32 R;
+  float32_t eTrip, eScale;
+  uint32_t i;
+  int32_t fail = 0, ok;
+
+  riscv_bench_header();
+
+  for (i = 0; i < 2 * MAX_FFT_LEN * NUM_CHANNELS; i++)
+  {
+    src_f32[i] = sinf(0.37f * i) + 0.25f * cosf(1.9f * i + 0.3f);
+  }
+
+  RISCV_BENCH("riscv_cfft_f32", "f32", MAX_FFT_LEN,
+    riscv_cfft_f32(&riscv_cfft_sR_f32_len256, buf_f32, 0u, 1u));
+  RISCV_BENCH("riscv_cfft_f32_inverse", "f32", MAX_FFT_LEN,
+    riscv_cfft_f32(&riscv_cfft_sR_f32_len256, buf_f32, 1u, 1u));
+  RISCV_BENCH("riscv_cfft_f32_inverse_noscale", "f32", MAX_FFT_LEN,
+    riscv_cfft_f32(&riscv_cfft_sR_f32_len256, buf_f32, RISCV_FFT_INVERSE_NOSCALE, 1u));
+
+  fail |= check_len(&riscv_cfft_sR_f32_len64);
+  fail |= check_len(&riscv_cfft_sR_f32_len128);
+  fail |= check_len(&riscv_cfft_sR_f32_len256);
+
+  /* real transform, the inverse writes to buf_f32 and reads the spectrum from out_f32 */
+  riscv_rfft_fast_init_f32(&R, RFFT_LEN);
+  memcpy(buf_f32, src_f32, RFFT_LEN * sizeof(float32_t));
+  riscv_rfft_fast_f32(&R, buf_f32, out_f32, 0u);
+  RISCV_BENCH("riscv_rfft_fast_f32_inverse", "f32", RFFT_LEN,
+    riscv_rfft_fast_f32(&R, out_f32, buf_f32, 1u));
+  memcpy(buf_f32, src_f32, RFFT_LEN * sizeof(float32_t));
+  riscv_rfft_fast_f32(&R, buf_f32, out_f32, 0u);
+  memcpy(ref_f32, out_f32, RFFT_LEN * sizeof(float32_t));
+  riscv_rfft_fast_f32(&R, out_f32, buf_f32, 1u);
+  eTrip = max_err(src_f32, buf_f32, RFFT_LEN, 1.0f);
+  riscv_rfft_fast_f32(&R, ref_f32, out_f32, RISCV_FFT_INVERSE_NOSCALE);
+  eScale = max_err(buf_f32, out_f32, RFFT_LEN, 1.0f / (float32_t) RFFT_LEN);
+  ok = (eTrip < 1e-5f) && (eScale < 1e-6f);
+  printf("CHECK riscv_rfft_fast_f32 inverse %u: round trip %d, noscale %d (1e-9) %s\n",
+         RFFT_LEN, (int) (eTrip * 1e9f), (int) (eScale * 1e9f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return fail;
+}
@@ -0,0 +1,126 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define FFT_LEN 1024
+#define INPUT_LEN 200
+#define NUM_BINS 64
+#define SCRATCH_LEN (2 * FFT_LEN + 4 * NUM_BINS)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_cfft_pruned_f32 and riscv_cfft_pruned_q15 are measured for 200 samples zero-padded to 1024
+points and the first 64 bins, next to riscv_cfft_f32 and riscv_cfft_q15 of the full padded frame.
+*The floating-point pruned bins must match the bins of the full transform for that case, for the
+same case with a scratch buffer that limits the sub-transforms to 32 points, and for 100 samples and
+4 bins wrapping around bin 0, which the planner runs with the input split.  The Q15 pruned bins must
+be at least as close to the floating-point bins as those of the full riscv_cfft_q15.  The CHECK
+lines must report ok and name the chosen split and sub-transform length.
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions22"
+#include "../common/riscv_bench.h"
+
+float32_t src_f32[2 * FFT_LEN];
+float32_t full_f32[2 * FFT_LEN];
+float32_t out_f32[2 * FFT_LEN];
+float32_t scratch_f32[2 * FFT_LEN];
+q15_t src_q15[2 * FFT_LEN];
+q15_t full_q15[2 * FFT_LEN];
+q15_t out_q15[2 * FFT_LEN];
+q31_t scratch_q15[SCRATCH_LEN / 2];
+
+static int32_t check_case(uint16_t inputLen, uint16_t firstBin, uint16_t numBins, uint32_t maxSubLen)
+{
+  riscv_cfft_pruned_instance_f32 S;
+  riscv_cfft_pruned_instance_q15 Sq;
+  float32_t peak = 0.0f, err = 0.0f, d;
+  q31_t errq = 0, errFull = 0, dq, re, im;
+  uint32_t i, k;
+  int32_t ok;
+
+  /* full transforms of the zero-padded input */
+  memset(full_f32, 0, sizeof(full_f32));
+  memcpy(full_f32, src_f32, 2u * inputLen * sizeof(float32_t));
+  riscv_cfft_f32(&riscv_cfft_sR_f32_len1024, full_f32, 0u, 1u);
+  memset(full_q15, 0, sizeof(full_q15));
+  memcpy(full_q15, src_q15, 2u * inputLen * sizeof(q15_t));
+  riscv_cfft_q15(&riscv_cfft_sR_q15_len1024, full_q15, 0u, 1u);
+
+  ok = (riscv_cfft_pruned_init_f32(&S, FFT_LEN, inputLen, firstBin, numBins, scratch_f32, 2u * maxSubLen) == RISCV_MATH_SUCCESS) &&
+       (riscv_cfft_pruned_init_q15(&Sq, FFT_LEN, inputLen, firstBin, numBins, (q15_t *) scratch_q15, 2u * maxSubLen + 4u * numBins) == RISCV_MATH_SUCCESS);
+  if(!ok)
+  {
+    printf("CHECK riscv_cfft_pruned %u/%u/%u: init bad\n", inputLen, firstBin, numBins);
+    return 1;
+  }
+
+  riscv_cfft_pruned_f32(&S, src_f32, out_f32);
+  riscv_cfft_pruned_q15(&Sq, src_q15, out_q15);
+
+  for (i = 0; i < numBins; i++)
+  {
+    k = (firstBin + i) & (FFT_LEN - 1u);
+    d = fabsf(out_f32[2 * i] - full_f32[2 * k]) + fabsf(out_f32[2 * i + 1] - full_f32[2 * k + 1]);
+    err = (d > err) ? d : err;
+    d = fabsf(full_f32[2 * k]) + fabsf(full_f32[2 * k + 1]);
+    peak = (d > peak) ? d : peak;
+    /* Q15 bins against the floating-point bins scaled by 1/fftLen */
+    re = (q31_t) lrintf(full_f32[2 * k] * (32768.0f / FFT_LEN));
+    im = (q31_t) lrintf(full_f32[2 * k + 1] * (32768.0f / FFT_LEN));
+    dq = abs(out_q15[2 * i] - re) + abs(out_q15[2 * i + 1] - im);
+    errq = (dq > errq) ? dq : errq;
+    dq = abs(full_q15[2 * k] - re) + abs(full_q15[2 * k + 1] - im);
+    errFull = (dq > errFull) ? dq : errFull;
+  }
+  err /= peak;
+
+  ok = (err < 1e-5f) && (errq <= errFull);
+  printf("CHECK riscv_cfft_pruned %u/%u/%u: %s split %u/%u points, f32 %d (1e-9), q15 %d lsb, full q15 %d lsb %s\n",
+         inputLen, firstBin, numBins, S.outputSplit ? "output" : "input", S.pSub->fftLen, Sq.pSub->fftLen,
+         (int) (err * 1e9f), (int) errq, (int) errFull, ok ? "ok" : "bad");
+  return !ok;
+}
+
+int32_t main(void)
+{
+  riscv_cfft_pruned_instance_f32 S;
+  riscv_cfft_pruned_instance_q15 Sq;
+  uint32_t i;
+  int32_t fail = 0;
+
+  riscv_bench_header();
+
+  for (i = 0; i < 2 * FFT_LEN; i++)
+  {
+    src_f32[i] = 0.5f * sinf(0.37f * i) + 0.25f * cosf(1.9f * i + 0.3f);
+  }
+  riscv_float_to_q15(src_f32, src_q15, 2 * FFT_LEN);
+
+  riscv_cfft_pruned_init_f32(&S, FFT_LEN, INPUT_LEN, 0u, NUM_BINS, scratch_f32, 2 * FFT_LEN);
+  riscv_cfft_pruned_init_q15(&Sq, FFT_LEN, INPUT_LEN, 0u, NUM_BINS, (q15_t *) scratch_q15, SCRATCH_LEN);
+
+  RISCV_BENCH("riscv_cfft_f32", "f32", FFT_LEN,
+    riscv_cfft_f32(&riscv_cfft_sR_f32_len1024, full_f32, 0u, 1u));
+  RISCV_BENCH("riscv_cfft_pruned_f32", "f32", FFT_LEN,
+    riscv_cfft_pruned_f32(&S, src_f32, out_f32));
+  RISCV_BENCH("riscv_cfft_q15", "q15", FFT_LEN,
+    riscv_cfft_q15(&riscv_cfft_sR_q15_len1024, full_q15, 0u, 1u));
+  RISCV_BENCH("riscv_cfft_pruned_q15", "q15", FFT_LEN,
+    riscv_cfft_pruned_q15(&Sq, src_q15, out_q15));
+
+  fail |= check_case(INPUT_LEN, 0u, NUM_BINS, FFT_LEN);
+  fail |= check_case(INPUT_LEN, 0u, NUM_BINS, 32u);
+  fail |= check_case(100u, FFT_LEN - 2u, 4u, FFT_LEN);
+
+  return fail;
+}
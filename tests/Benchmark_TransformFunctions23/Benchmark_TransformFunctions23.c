@@ -0,0 +1,195 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define INPUT_LEN 200
+#define NUM_BINS 64
+#define CZT_FFT_LEN 512
+#define F_START 0.1f
+#define F_STEP 0.0005f
+#define DECIMATION 16
+#define ZOOM_FFT_LEN 64
+#define NUM_TAPS 64
+#define BLOCK_SIZE 256
+#define ZOOM_BIN 5
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_czt_f32 and riscv_czt_q31 compute 64 bins 0.0005 cycles per sample apart from 0.1 cycles per
+sample for 200 samples, through 512-point CFFTs, and must match the DTFT computed in double precision.
+*riscv_zoom_fft_f32 analyzes the band of 1/16 cycles per sample around 0.1 with 64 bins; a tone 5 bins
+above the centre must peak in bin 32+5 of every spectrum.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions23"
+#include "../common/riscv_bench.h"
+
+float32_t src_f32[2 * INPUT_LEN];
+q31_t src_q31[2 * INPUT_LEN];
+float64_t ref_f64[2 * NUM_BINS];
+float32_t out_f32[2 * NUM_BINS];
+q31_t out_q31[2 * NUM_BINS];
+float32_t coef_f32[RISCV_CZT_COEF_SIZE(INPUT_LEN, NUM_BINS, CZT_FFT_LEN)];
+float32_t scratch_f32[2 * CZT_FFT_LEN];
+q31_t coef_q31[RISCV_CZT_COEF_SIZE(INPUT_LEN, NUM_BINS, CZT_FFT_LEN)];
+q31_t scratch_q31[2 * CZT_FFT_LEN];
+
+float32_t lowpass_f32[NUM_TAPS];
+float32_t window_f32[ZOOM_FFT_LEN];
+float32_t tone_f32[2 * BLOCK_SIZE];
+float32_t state_f32[2 * (NUM_TAPS + BLOCK_SIZE - 1)];
+float32_t frame_f32[2 * ZOOM_FFT_LEN];
+float32_t spec_f32[2 * ZOOM_FFT_LEN];
+
+/* Largest difference to the double-precision DTFT, relative to its largest bin */
+static float64_t max_err(const float32_t * x, float64_t gain)
+{
+  float64_t peak = 0.0, err = 0.0, d;
+  uint32_t i;
+
+  for (i = 0; i < 2 * NUM_BINS; i++)
+  {
+    d = fabs(x[i] * gain - ref_f64[i]);
+    err = (d > err) ? d : err;
+    peak = (fabs(ref_f64[i]) > peak) ? fabs(ref_f64[i]) : peak;
+  }
+  return err / peak;
+}
+
+static int32_t check_czt(void)
+{
+  riscv_czt_instance_f32 S;
+  riscv_czt_instance_q31 Sq;
+  float64_t eF32, eQ31, w;
+  int32_t shift, ok;
+  uint32_t n, k;
+
+  for (k = 0; k < NUM_BINS; k++)
+  {
+    ref_f64[2 * k] = 0.0;
+    ref_f64[2 * k + 1] = 0.0;
+    for (n = 0; n < INPUT_LEN; n++)
+    {
+      w = -6.283185307179586 * ((float64_t) F_START + k * (float64_t) F_STEP) * n;
+      ref_f64[2 * k] += src_f32[2 * n] * cos(w) - src_f32[2 * n + 1] * sin(w);
+      ref_f64[2 * k + 1] += src_f32[2 * n] * sin(w) + src_f32[2 * n + 1] * cos(w);
+    }
+  }
+
+  ok = (riscv_czt_init_f32(&S, INPUT_LEN, NUM_BINS, F_START, F_STEP, &riscv_cfft_sR_f32_len512, coef_f32, scratch_f32) == RISCV_MATH_SUCCESS) &&
+       (riscv_czt_init_q31(&Sq, INPUT_LEN, NUM_BINS, F_START, F_STEP, &riscv_cfft_sR_q31_len512, coef_q31, scratch_q31) == RISCV_MATH_SUCCESS) &&
+       (riscv_czt_init_f32(&S, INPUT_LEN, NUM_BINS, F_START, F_STEP, &riscv_cfft_sR_f32_len256, coef_f32, scratch_f32) == RISCV_MATH_ARGUMENT_ERROR);
+
+  riscv_czt_init_f32(&S, INPUT_LEN, NUM_BINS, F_START, F_STEP, &riscv_cfft_sR_f32_len512, coef_f32, scratch_f32);
+  riscv_czt_f32(&S, src_f32, out_f32);
+  eF32 = max_err(out_f32, 1.0);
+
+  shift = riscv_czt_q31(&Sq, src_q31, out_q31);
+  for (k = 0; k < 2 * NUM_BINS; k++)
+  {
+    out_f32[k] = (float32_t) out_q31[k];
+  }
+  eQ31 = max_err(out_f32, ldexp(1.0, shift - 31));
+
+  ok = ok && (eF32 < 1e-5) && (eQ31 < 1e-6);
+  printf("CHECK riscv_czt %u/%u: f32 %d, q31 %d (1e-9), q31 shift %d %s\n",
+         INPUT_LEN, NUM_BINS, (int) (eF32 * 1e9), (int) (eQ31 * 1e9), (int) shift, ok ? "ok" : "bad");
+  return !ok;
+}
+
+static int32_t check_zoom(void)
+{
+  riscv_zoom_fft_instance_f32 S;
+  float32_t f, p, best;
+  uint32_t i, j, peak = 0, numFrames = 0, numPeak = 0;
+  int32_t ok;
+
+  /* windowed-sinc lowpass at half the decimated rate, Hann windows */
+  for (i = 0; i < NUM_TAPS; i++)
+  {
+    f = (float32_t) i - 0.5f * (NUM_TAPS - 1);
+    lowpass_f32[i] = (0.5f - 0.5f * cosf(6.2831853f * (i + 0.5f) / NUM_TAPS)) *
+                     ((f == 0.0f) ? 1.0f : sinf(3.14159265f * f / DECIMATION) / (3.14159265f * f / DECIMATION)) / DECIMATION;
+  }
+  for (i = 0; i < ZOOM_FFT_LEN; i++)
+  {
+    window_f32[i] = 0.5f - 0.5f * cosf(6.2831853f * i / ZOOM_FFT_LEN);
+  }
+
+  riscv_zoom_fft_init_f32(&S, F_START, DECIMATION, NUM_TAPS, lowpass_f32, window_f32,
+                          &riscv_cfft_sR_f32_len64, BLOCK_SIZE, state_f32, frame_f32);
+
+  /* tone ZOOM_BIN bins above the centre, three frames */
+  f = F_START + (float32_t) ZOOM_BIN / (DECIMATION * ZOOM_FFT_LEN);
+  for (j = 0; j < (3 * DECIMATION * ZOOM_FFT_LEN) / BLOCK_SIZE; j++)
+  {
+    for (i = 0; i < BLOCK_SIZE; i++)
+    {
+      p = 6.2831853f * fmodf(f * (j * BLOCK_SIZE + i), 1.0f);
+      tone_f32[2 * i] = cosf(p);
+      tone_f32[2 * i + 1] = sinf(p);
+    }
+    if(riscv_zoom_fft_f32(&S, tone_f32, spec_f32) == 1u)
+    {
+      numFrames++;
+      best = 0.0f;
+      for (i = 0; i < ZOOM_FFT_LEN; i++)
+      {
+        p = spec_f32[2 * i] * spec_f32[2 * i] + spec_f32[2 * i + 1] * spec_f32[2 * i + 1];
+        if(p > best)
+        {
+          best = p;
+          peak = i;
+        }
+      }
+      numPeak += (peak == ZOOM_FFT_LEN / 2 + ZOOM_BIN);
+    }
+  }
+
+  ok = (numFrames == 3u) && (numPeak == 3u);
+  printf("CHECK riscv_zoom_fft_f32: %u frames, %u peaks in bin %u %s\n",
+         numFrames, numPeak, ZOOM_FFT_LEN / 2 + ZOOM_BIN, ok ? "ok" : "bad");
+  return !ok;
+}
+
+int32_t main(void)
+{
+  riscv_czt_instance_f32 S;
+  riscv_czt_instance_q31 Sq;
+  riscv_zoom_fft_instance_f32 Sz;
+  uint32_t i;
+  int32_t fail = 0;
+
+  riscv_bench_header();
+
+  for (i = 0; i < 2 * INPUT_LEN; i++)
+  {
+    src_f32[i] = 0.5f * sinf(0.37f * i) + 0.25f * cosf(1.9f * i + 0.3f);
+  }
+  riscv_float_to_q31(src_f32, src_q31, 2 * INPUT_LEN);
+
+  riscv_czt_init_f32(&S, INPUT_LEN, NUM_BINS, F_START, F_STEP, &riscv_cfft_sR_f32_len512, coef_f32, scratch_f32);
+  riscv_czt_init_q31(&Sq, INPUT_LEN, NUM_BINS, F_START, F_STEP, &riscv_cfft_sR_q31_len512, coef_q31, scratch_q31);
+  riscv_zoom_fft_init_f32(&Sz, F_START, DECIMATION, NUM_TAPS, lowpass_f32, window_f32,
+                          &riscv_cfft_sR_f32_len64, BLOCK_SIZE, state_f32, frame_f32);
+
+  RISCV_BENCH("riscv_czt_f32", "f32", NUM_BINS,
+    riscv_czt_f32(&S, src_f32, out_f32));
+  RISCV_BENCH("riscv_czt_q31", "q31", NUM_BINS,
+    riscv_czt_q31(&Sq, src_q31, out_q31));
+  RISCV_BENCH("riscv_zoom_fft_f32", "f32", BLOCK_SIZE,
+    riscv_zoom_fft_f32(&Sz, tone_f32, spec_f32));
+
+  fail |= check_czt();
+  fail |= check_zoom();
+
+  return fail;
+}
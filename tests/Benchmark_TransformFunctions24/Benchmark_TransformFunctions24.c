@@ -0,0 +1,177 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define FFT_LEN 256
+#define HOP_SIZE 128
+#define NUM_SAMPLES 2048
+#define BLOCK_SIZE 100
+#define NUM_BINS (FFT_LEN / 2 + 1)
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*riscv_welch_f32 is measured for one segment of 256 samples with a hop of 128, next to the chain it
+replaces: window, riscv_rfft_fast_f32, riscv_cmplx_mag_squared_f32 and riscv_add_f32.
+*The samples are pushed in blocks of 100.  The floating-point PSD and CSD must match the average of
+the periodograms computed with riscv_rfft_fast_f32, the coherence of a channel with a scaled copy of
+itself must be 1, and the Q31 average power spectrum, scaled to a density, must match the
+floating-point PSD.  The CHECK lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions24"
+#include "../common/riscv_bench.h"
+
+float32_t x_f32[NUM_SAMPLES];
+float32_t y_f32[NUM_SAMPLES];
+q31_t x_q31[NUM_SAMPLES];
+float32_t win_f32[FFT_LEN];
+q31_t win_q31[FFT_LEN];
+float32_t ring_f32[2 * FFT_LEN];
+float32_t scratch_f32[2 * FFT_LEN];
+float32_t acc_f32[4 * NUM_BINS];
+q31_t ring_q31[FFT_LEN];
+q31_t scratch_q31[FFT_LEN];
+q63_t acc_q63[NUM_BINS];
+float32_t seg_f32[FFT_LEN];
+float32_t segY_f32[FFT_LEN];
+float32_t spec_f32[FFT_LEN];
+float32_t specY_f32[FFT_LEN];
+float32_t mag_f32[FFT_LEN / 2];
+float32_t refP_f32[NUM_BINS];
+float32_t refC_f32[2 * NUM_BINS];
+float32_t out_f32[2 * NUM_BINS];
+q31_t out_q31[NUM_BINS];
+
+/* Largest difference to the reference, relative to the largest reference value */
+static float32_t max_err(const float32_t * ref, const float32_t * x, uint32_t n)
+{
+  float32_t peak = 0.0f, err = 0.0f, d;
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    d = fabsf(x[i] - ref[i]);
+    err = (d > err) ? d : err;
+    peak = (fabsf(ref[i]) > peak) ? fabsf(ref[i]) : peak;
+  }
+  return err / peak;
+}
+
+int32_t main(void)
+{
+  riscv_welch_instance_f32 S;
+  riscv_welch_instance_q31 Sq;
+  riscv_rfft_fast_instance_f32 R;
+  float32_t energy, eP, eC, eQ, minCoh, t;
+  uint32_t i, k, n, numSeg = 0, seed = 12345u;
+  int32_t fail = 0, ok;
+
+  riscv_bench_header();
+
+  for (i = 0; i < NUM_SAMPLES; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    x_f32[i] = 0.4f * sinf(0.3f * i) + 0.2f * ((float32_t) (seed >> 8) / 16777216.0f - 0.5f);
+    y_f32[i] = -0.5f * x_f32[i];
+  }
+  for (i = 0; i < FFT_LEN; i++)
+  {
+    win_f32[i] = 0.5f - 0.5f * cosf(6.2831853f * i / FFT_LEN);
+  }
+  riscv_float_to_q31(x_f32, x_q31, NUM_SAMPLES);
+  riscv_float_to_q31(win_f32, win_q31, FFT_LEN);
+  riscv_power_f32(win_f32, FFT_LEN, &energy);
+
+  /* benchmarks, one segment per call */
+  riscv_welch_init_f32(&S, FFT_LEN, HOP_SIZE, 0u, win_f32, ring_f32, scratch_f32, acc_f32);
+  riscv_welch_f32(&S, x_f32, NULL, FFT_LEN - HOP_SIZE);
+  RISCV_BENCH("riscv_welch_f32", "f32", FFT_LEN,
+    riscv_welch_f32(&S, x_f32, NULL, HOP_SIZE));
+  riscv_rfft_fast_init_f32(&R, FFT_LEN);
+  RISCV_BENCH("riscv_welch_f32_chain", "f32", FFT_LEN,
+    riscv_mult_f32(x_f32, win_f32, seg_f32, FFT_LEN);
+    riscv_rfft_fast_f32(&R, seg_f32, spec_f32, 0u);
+    riscv_cmplx_mag_squared_f32(spec_f32, mag_f32, FFT_LEN / 2);
+    riscv_add_f32(refP_f32, mag_f32, refP_f32, FFT_LEN / 2));
+  riscv_welch_init_q31(&Sq, FFT_LEN, HOP_SIZE, 0u, win_q31, ring_q31, scratch_q31, acc_q63);
+  riscv_welch_q31(&Sq, x_q31, NULL, FFT_LEN - HOP_SIZE);
+  RISCV_BENCH("riscv_welch_q31", "q31", FFT_LEN,
+    riscv_welch_q31(&Sq, x_q31, NULL, HOP_SIZE));
+
+  /* reference, average of the periodograms of the segments */
+  memset(refP_f32, 0, sizeof(refP_f32));
+  memset(refC_f32, 0, sizeof(refC_f32));
+  for (n = 0; n + FFT_LEN <= NUM_SAMPLES; n += HOP_SIZE)
+  {
+    riscv_mult_f32(&x_f32[n], win_f32, seg_f32, FFT_LEN);
+    riscv_mult_f32(&y_f32[n], win_f32, segY_f32, FFT_LEN);
+    riscv_rfft_fast_f32(&R, seg_f32, spec_f32, 0u);
+    riscv_rfft_fast_f32(&R, segY_f32, specY_f32, 0u);
+    refP_f32[0] += spec_f32[0] * spec_f32[0];
+    refP_f32[FFT_LEN / 2] += spec_f32[1] * spec_f32[1];
+    refC_f32[0] += spec_f32[0] * specY_f32[0];
+    refC_f32[FFT_LEN] += spec_f32[1] * specY_f32[1];
+    for (k = 1; k < FFT_LEN / 2; k++)
+    {
+      refP_f32[k] += spec_f32[2 * k] * spec_f32[2 * k] + spec_f32[2 * k + 1] * spec_f32[2 * k + 1];
+      refC_f32[2 * k] += spec_f32[2 * k] * specY_f32[2 * k] + spec_f32[2 * k + 1] * specY_f32[2 * k + 1];
+      refC_f32[2 * k + 1] += spec_f32[2 * k + 1] * specY_f32[2 * k] - spec_f32[2 * k] * specY_f32[2 * k + 1];
+    }
+    numSeg++;
+  }
+  for (k = 0; k < NUM_BINS; k++)
+  {
+    t = ((k == 0) || (k == FFT_LEN / 2)) ? 1.0f : 2.0f;
+    refP_f32[k] *= t / (numSeg * energy);
+    refC_f32[2 * k] *= t / (numSeg * energy);
+    refC_f32[2 * k + 1] *= t / (numSeg * energy);
+  }
+
+  /* two channels pushed in blocks */
+  riscv_welch_init_f32(&S, FFT_LEN, HOP_SIZE, 1u, win_f32, ring_f32, scratch_f32, acc_f32);
+  riscv_welch_init_q31(&Sq, FFT_LEN, HOP_SIZE, 0u, win_q31, ring_q31, scratch_q31, acc_q63);
+  n = 0;
+  for (i = 0; i < NUM_SAMPLES; i += BLOCK_SIZE)
+  {
+    k = (NUM_SAMPLES - i < BLOCK_SIZE) ? NUM_SAMPLES - i : BLOCK_SIZE;
+    n += riscv_welch_f32(&S, &x_f32[i], &y_f32[i], k);
+    riscv_welch_q31(&Sq, &x_q31[i], NULL, k);
+  }
+
+  riscv_welch_psd_f32(&S, 0u, out_f32);
+  eP = max_err(refP_f32, out_f32, NUM_BINS);
+  riscv_welch_csd_f32(&S, out_f32);
+  eC = max_err(refC_f32, out_f32, 2 * NUM_BINS);
+  riscv_welch_coherence_f32(&S, out_f32);
+  minCoh = 1.0f;
+  for (k = 0; k < NUM_BINS; k++)
+  {
+    minCoh = (fabsf(out_f32[k] - 1.0f) > fabsf(minCoh - 1.0f)) ? out_f32[k] : minCoh;
+  }
+  ok = (n == numSeg) && (eP < 1e-5f) && (eC < 1e-5f) && (fabsf(minCoh - 1.0f) < 1e-4f);
+  printf("CHECK riscv_welch_f32: %u segments, psd %d, csd %d (1e-9), coherence %d (1e-6) %s\n",
+         n, (int) (eP * 1e9f), (int) (eC * 1e9f), (int) (minCoh * 1e6f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Q31 average power spectrum to density, times fftLen^2 over the window energy */
+  riscv_welch_psd_q31(&Sq, 0u, out_q31);
+  for (k = 0; k < NUM_BINS; k++)
+  {
+    t = ((k == 0) || (k == FFT_LEN / 2)) ? 1.0f : 2.0f;
+    out_f32[k] = t * (float32_t) out_q31[k] / 2147483648.0f * FFT_LEN * FFT_LEN / energy;
+  }
+  eQ = max_err(refP_f32, out_f32, NUM_BINS);
+  ok = (Sq.numSegments == numSeg) && (eQ < 1e-3f);
+  printf("CHECK riscv_welch_q31: %u segments, psd %d (1e-9) %s\n",
+         (unsigned) Sq.numSegments, (int) (eQ * 1e9f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return fail;
+}
@@ -0,0 +1,222 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define BLOCK_SIZE 256
+#define NUM_LEVELS 4
+#define STEP_POS 151
+#define NUM_TAPS 4
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The Haar and Daubechies-4 transforms of 4 levels are measured on 256 samples, next to one level
+built from two riscv_fir_decimate_q15 filters.
+*The input is a slow sine with a step.  At every level the energy of the coefficients must be half
+the energy of the approximation they replace, the Daubechies-4 details of a ramp must vanish away
+from the ends, the largest Haar detail of level 1 must sit at the step, the Q15 and Q31 coefficients
+must match the floating-point ones, and every inverse transform must return the input.  The CHECK
+lines must report ok.
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions25"
+#include "../common/riscv_bench.h"
+
+float32_t x_f32[BLOCK_SIZE], w_f32[BLOCK_SIZE];
+q15_t x_q15[BLOCK_SIZE] __attribute__((aligned(4))), w_q15[BLOCK_SIZE] __attribute__((aligned(4)));
+q31_t x_q31[BLOCK_SIZE], w_q31[BLOCK_SIZE];
+q15_t lo_q15[BLOCK_SIZE / 2], hi_q15[BLOCK_SIZE / 2];
+q15_t stateLo_q15[NUM_TAPS + BLOCK_SIZE - 1], stateHi_q15[NUM_TAPS + BLOCK_SIZE - 1];
+q15_t coefLo_q15[NUM_TAPS] = { 15826, 27411, 7345, -4240 };
+q15_t coefHi_q15[NUM_TAPS] = { -4240, -7345, 27411, -15826 };
+
+/* Energy of the samples p[0], p[st], ... of a block of n */
+static double energy(const float32_t * p, uint32_t n, uint32_t st)
+{
+  double e = 0.0;
+  uint32_t i;
+
+  for (i = 0; i < n; i += st)
+  {
+    e += (double) p[i] * p[i];
+  }
+  return (e);
+}
+
+/* Checks the energy split of every level of the forward transform of x_f32 */
+static int32_t check_energy(riscv_dwt_wavelet wavelet)
+{
+  double eIn = energy(x_f32, BLOCK_SIZE, 1), eOut;
+  uint32_t l;
+  int32_t ok = 1;
+
+  memcpy(w_f32, x_f32, sizeof(w_f32));
+  for (l = 1; l <= NUM_LEVELS; l++)
+  {
+    /* One level on the approximation of the previous one, moved to the front of the block */
+    riscv_dwt_f32(w_f32, BLOCK_SIZE >> (l - 1), 1, wavelet, 0);
+    eOut = energy(w_f32, BLOCK_SIZE >> (l - 1), 1);
+    ok = ok && (fabs(eOut - 0.5 * eIn) < 1e-5 * eIn);
+    eIn = energy(w_f32, BLOCK_SIZE >> (l - 1), 2);
+    for (uint32_t i = 0; i < (BLOCK_SIZE >> l); i++)
+    {
+      w_f32[i] = w_f32[2 * i];
+    }
+  }
+  return (ok);
+}
+
+/* Largest round-trip error, in units of the LSB of the type */
+static float32_t round_trip(riscv_dwt_wavelet wavelet, float32_t * pErrQ15, float32_t * pErrQ31)
+{
+  float32_t err = 0.0f;
+  uint32_t i;
+
+  memcpy(w_f32, x_f32, sizeof(w_f32));
+  memcpy(w_q15, x_q15, sizeof(w_q15));
+  memcpy(w_q31, x_q31, sizeof(w_q31));
+  riscv_dwt_f32(w_f32, BLOCK_SIZE, NUM_LEVELS, wavelet, 0);
+  riscv_dwt_f32(w_f32, BLOCK_SIZE, NUM_LEVELS, wavelet, 1);
+  riscv_dwt_q15(w_q15, BLOCK_SIZE, NUM_LEVELS, wavelet, 0);
+  riscv_dwt_q15(w_q15, BLOCK_SIZE, NUM_LEVELS, wavelet, 1);
+  riscv_dwt_q31(w_q31, BLOCK_SIZE, NUM_LEVELS, wavelet, 0);
+  riscv_dwt_q31(w_q31, BLOCK_SIZE, NUM_LEVELS, wavelet, 1);
+
+  *pErrQ15 = 0.0f;
+  *pErrQ31 = 0.0f;
+  for (i = 0; i < BLOCK_SIZE; i++)
+  {
+    err = fmaxf(err, fabsf(w_f32[i] - x_f32[i]));
+    *pErrQ15 = fmaxf(*pErrQ15, fabsf((float32_t) (w_q15[i] - x_q15[i])));
+    *pErrQ31 = fmaxf(*pErrQ31, fabsf((float32_t) ((double) w_q31[i] - x_q31[i])) / 65536.0f);
+  }
+  return (err);
+}
+
+/* Largest difference of the fixed-point coefficients to the floating-point ones, in LSB */
+static void coef_error(riscv_dwt_wavelet wavelet, float32_t * pErrQ15, float32_t * pErrQ31)
+{
+  uint32_t i;
+
+  memcpy(w_f32, x_f32, sizeof(w_f32));
+  memcpy(w_q15, x_q15, sizeof(w_q15));
+  memcpy(w_q31, x_q31, sizeof(w_q31));
+  riscv_dwt_f32(w_f32, BLOCK_SIZE, NUM_LEVELS, wavelet, 0);
+  riscv_dwt_q15(w_q15, BLOCK_SIZE, NUM_LEVELS, wavelet, 0);
+  riscv_dwt_q31(w_q31, BLOCK_SIZE, NUM_LEVELS, wavelet, 0);
+
+  *pErrQ15 = 0.0f;
+  *pErrQ31 = 0.0f;
+  for (i = 0; i < BLOCK_SIZE; i++)
+  {
+    *pErrQ15 = fmaxf(*pErrQ15, fabsf(w_q15[i] - w_f32[i] * 32768.0f));
+    *pErrQ31 = fmaxf(*pErrQ31, (float32_t) fabs(w_q31[i] / 2147483648.0 - w_f32[i]) * 32768.0f);
+  }
+}
+
+int32_t main(void)
+{
+  riscv_fir_decimate_instance_q15 Slo, Shi;
+  float32_t err, errQ15, errQ31, errC15, errC31, peak;
+  uint32_t i, at;
+  int32_t fail = 0, ok;
+
+  riscv_bench_header();
+
+  for (i = 0; i < BLOCK_SIZE; i++)
+  {
+    x_f32[i] = 0.4f * sinf(0.05f * i) + ((i >= STEP_POS) ? 0.3f : -0.2f);
+    x_q15[i] = (q15_t) lrintf(x_f32[i] * 32768.0f);
+    x_f32[i] = x_q15[i] / 32768.0f;
+    x_q31[i] = (q31_t) x_q15[i] << 16;
+  }
+
+  memcpy(w_f32, x_f32, sizeof(w_f32));
+  memcpy(w_q15, x_q15, sizeof(w_q15));
+  memcpy(w_q31, x_q31, sizeof(w_q31));
+  RISCV_BENCH("riscv_dwt_f32_haar", "f32", BLOCK_SIZE, riscv_dwt_f32(w_f32, BLOCK_SIZE, NUM_LEVELS, RISCV_DWT_HAAR, 0));
+  RISCV_BENCH("riscv_dwt_f32_db4", "f32", BLOCK_SIZE, riscv_dwt_f32(w_f32, BLOCK_SIZE, NUM_LEVELS, RISCV_DWT_DB4, 0));
+  RISCV_BENCH("riscv_dwt_f32_db4_inverse", "f32", BLOCK_SIZE, riscv_dwt_f32(w_f32, BLOCK_SIZE, NUM_LEVELS, RISCV_DWT_DB4, 1));
+  RISCV_BENCH("riscv_dwt_q15_haar", "q15", BLOCK_SIZE, riscv_dwt_q15(w_q15, BLOCK_SIZE, NUM_LEVELS, RISCV_DWT_HAAR, 0));
+  RISCV_BENCH("riscv_dwt_q15_haar_inverse", "q15", BLOCK_SIZE, riscv_dwt_q15(w_q15, BLOCK_SIZE, NUM_LEVELS, RISCV_DWT_HAAR, 1));
+  RISCV_BENCH("riscv_dwt_q15_db4", "q15", BLOCK_SIZE, riscv_dwt_q15(w_q15, BLOCK_SIZE, NUM_LEVELS, RISCV_DWT_DB4, 0));
+  RISCV_BENCH("riscv_dwt_q15_db4_inverse", "q15", BLOCK_SIZE, riscv_dwt_q15(w_q15, BLOCK_SIZE, NUM_LEVELS, RISCV_DWT_DB4, 1));
+  RISCV_BENCH("riscv_dwt_q31_haar", "q31", BLOCK_SIZE, riscv_dwt_q31(w_q31, BLOCK_SIZE, NUM_LEVELS, RISCV_DWT_HAAR, 0));
+  RISCV_BENCH("riscv_dwt_q31_db4", "q31", BLOCK_SIZE, riscv_dwt_q31(w_q31, BLOCK_SIZE, NUM_LEVELS, RISCV_DWT_DB4, 0));
+
+  /* One level of the Daubechies-4 filter bank with two decimators */
+  riscv_fir_decimate_init_q15(&Slo, NUM_TAPS, 2, coefLo_q15, stateLo_q15, BLOCK_SIZE);
+  riscv_fir_decimate_init_q15(&Shi, NUM_TAPS, 2, coefHi_q15, stateHi_q15, BLOCK_SIZE);
+  RISCV_BENCH("riscv_fir_decimate_q15_pair", "q15", BLOCK_SIZE,
+    riscv_fir_decimate_q15(&Slo, x_q15, lo_q15, BLOCK_SIZE);
+    riscv_fir_decimate_q15(&Shi, x_q15, hi_q15, BLOCK_SIZE));
+  RISCV_BENCH("riscv_dwt_q15_db4_level", "q15", BLOCK_SIZE, riscv_dwt_q15(w_q15, BLOCK_SIZE, 1, RISCV_DWT_DB4, 0));
+
+  /* Energy split of the levels */
+  ok = check_energy(RISCV_DWT_HAAR) && check_energy(RISCV_DWT_DB4);
+  printf("CHECK riscv_dwt_f32: energy of the levels %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Vanishing moments of Daubechies-4 */
+  for (i = 0; i < BLOCK_SIZE; i++)
+  {
+    w_f32[i] = 0.001f * i - 0.1f;
+  }
+  riscv_dwt_f32(w_f32, BLOCK_SIZE, 1, RISCV_DWT_DB4, 0);
+  for (i = 2, peak = 0.0f; i < BLOCK_SIZE - 2; i += 2)
+  {
+    peak = fmaxf(peak, fabsf(w_f32[i + 1]));
+  }
+  ok = (peak < 1e-6f);
+  printf("CHECK riscv_dwt_f32: db4 details of a ramp %d (1e-9) %s\n", (int) (peak * 1e9f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* The step shows in the level 1 Haar details */
+  memcpy(w_q15, x_q15, sizeof(w_q15));
+  riscv_dwt_q15(w_q15, BLOCK_SIZE, NUM_LEVELS, RISCV_DWT_HAAR, 0);
+  for (i = 1, at = 0, peak = 0.0f; i < BLOCK_SIZE; i += 2)
+  {
+    if(fabsf((float32_t) w_q15[i]) > peak)
+    {
+      peak = fabsf((float32_t) w_q15[i]);
+      at = i;
+    }
+  }
+  ok = (at == STEP_POS);
+  printf("CHECK riscv_dwt_q15: step at %d %s\n", (int) at, ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Fixed-point coefficients */
+  coef_error(RISCV_DWT_HAAR, &errQ15, &errQ31);
+  coef_error(RISCV_DWT_DB4, &errC15, &errC31);
+  ok = (errQ15 <= 2.0f) && (errC15 <= NUM_LEVELS) && (errQ31 < 1e-2f) && (errC31 < 1e-2f);
+  printf("CHECK riscv_dwt_q15/q31: coefficients haar %d/%d, db4 %d/%d (1e-3 LSB of q15) %s\n",
+         (int) (errQ15 * 1e3f), (int) (errQ31 * 1e3f), (int) (errC15 * 1e3f), (int) (errC31 * 1e3f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* Round trips */
+  err = round_trip(RISCV_DWT_HAAR, &errQ15, &errQ31);
+  ok = (err < 1e-6f) && (errQ15 <= 2 * NUM_LEVELS) && (errQ31 < 1e-3f);
+  printf("CHECK riscv_dwt haar round trip: f32 %d (1e-9), q15 %d LSB, q31 %d (1e-3 LSB of q15) %s\n",
+         (int) (err * 1e9f), (int) errQ15, (int) (errQ31 * 1e3f), ok ? "ok" : "bad");
+  fail |= !ok;
+  err = round_trip(RISCV_DWT_DB4, &errQ15, &errQ31);
+  ok = (err < 1e-5f) && (errQ15 <= 2 * NUM_LEVELS) && (errQ31 < 1e-3f);
+  printf("CHECK riscv_dwt db4 round trip: f32 %d (1e-9), q15 %d LSB, q31 %d (1e-3 LSB of q15) %s\n",
+         (int) (err * 1e9f), (int) errQ15, (int) (errQ31 * 1e3f), ok ? "ok" : "bad");
+  fail |= !ok;
+
+  /* 100 samples cannot be split 3 times */
+  ok = (riscv_dwt_f32(w_f32, 100, 3, RISCV_DWT_HAAR, 0) == RISCV_MATH_ARGUMENT_ERROR) &&
+       (riscv_dwt_q15(w_q15, 100, 2, RISCV_DWT_HAAR, 0) == RISCV_MATH_SUCCESS);
+  printf("CHECK riscv_dwt: argument check %s\n", ok ? "ok" : "bad");
+  fail |= !ok;
+
+  return (fail);
+}
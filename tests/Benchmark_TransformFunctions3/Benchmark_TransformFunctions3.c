@@ -7,7 +7,6 @@
 #include "riscv_const_structs.h"
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 
 
 #define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
@@ -17,31 +16,14 @@ printf("\n\n")
 //#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
 #define RFFT_LEN  32
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5() *(volatile int*) (GPIO_REG_PADOUT) = 0x00;
-//#define PRINT_OUTPUT
-
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
 *Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "TransformFunctions3"
+#include "../common/riscv_bench.h"
 
 
 
@@ -65,17 +47,15 @@ float32_t result_f32[RFFT_LEN] = {0};
 
 int32_t main(void)
 {
+  riscv_bench_header();
  /*Init*/ 
  /*rfft Init*/
   riscv_rfft_fast_init_f32(&S_rfft_f32 , RFFT_LEN);
  /*Tests*/
 
  /*rfft*/
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_rfft_fast_f32(&S_rfft_f32, testInput_f32,result_f32 ,ifftFlag);
-  perf_stop();
-  printf("riscv_cfft_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_rfft_fast_f32", "f32", RFFT_LEN,
+    riscv_rfft_fast_f32(&S_rfft_f32, testInput_f32,result_f32 ,ifftFlag));
 #ifdef PRINT_OUTPUT
   PRINT_F32(result_f32,RFFT_LEN);
 #endif
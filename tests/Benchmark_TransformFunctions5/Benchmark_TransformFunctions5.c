@@ -7,7 +7,6 @@
 #include "riscv_const_structs.h"
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 
 
 #define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
@@ -17,31 +16,14 @@ printf("\n\n")
 //#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
 #define RFFT_LEN  32
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5() *(volatile int*) (GPIO_REG_PADOUT) = 0x00;
-
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
 *Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "TransformFunctions5"
+#include "../common/riscv_bench.h"
 
 q31_t testInput_q31[RFFT_LEN] = 
 {   
@@ -58,21 +40,28 @@ q31_t testInput_q31[RFFT_LEN] =
 uint32_t ifftFlag = 0;
 uint32_t doBitReverse = 0;
 riscv_rfft_instance_q31 S_rfft_q31;
-q31_t result_q31[RFFT_LEN] = {0};  
+riscv_rfft_fast_instance_q31 S_rfft_fast_q31;
+q31_t result_q31[2 * RFFT_LEN] = {0};  /*riscv_rfft_q31 writes the full complex spectrum*/
 
 int32_t main(void)
 {
+  riscv_bench_header();
 /*Init*/ 
 /*rfft Init*/
   riscv_rfft_init_q31(&S_rfft_q31 , RFFT_LEN,ifftFlag,doBitReverse);
+  riscv_rfft_fast_init_q31(&S_rfft_fast_q31 , RFFT_LEN);
 /*Tests*/
 
 /*rfft*/
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_rfft_q31(&S_rfft_q31, testInput_q31,result_q31);
-  perf_stop();
-  printf("riscv_rfft_q31: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_rfft_q31", "q31", RFFT_LEN,
+    riscv_rfft_q31(&S_rfft_q31, testInput_q31,result_q31));
+#ifdef PRINT_OUTPUT
+  PRINT_Q(result_q31,RFFT_LEN);
+#endif
+
+/*rfft fast*/
+  RISCV_BENCH("riscv_rfft_fast_q31", "q31", RFFT_LEN,
+    riscv_rfft_fast_q31(&S_rfft_fast_q31, testInput_q31,result_q31 ,ifftFlag));
 #ifdef PRINT_OUTPUT
   PRINT_Q(result_q31,RFFT_LEN);
 #endif
@@ -7,7 +7,6 @@
 #include "riscv_const_structs.h"
 #include "bench.h"
 
-#define EVENT_ID 0x00  /*number of cycles ID for benchmarking*/
 
 #define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
 printf("\n\n")
@@ -16,31 +15,14 @@ printf("\n\n")
 //#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
 #define RFFT_LEN  128
 /*
-  this macros used for benchmarking, they are not friendly as they affect other GPIOs, but the main purpose here is to minimize the overhead,
-a more fierndly version will be
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) &=  0xDF;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) |=  0x10;
-#define CLR_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) &=  0xEF;
-*/
-
-#define SET_GPIO_6()     *(volatile int*) (GPIO_REG_PADOUT) =  0x20;
-#define CLR_GPIO_6()    *(volatile int*) (GPIO_REG_PADOUT) =  0x00;
-#define SET_GPIO_5()     *(volatile int*) (GPIO_REG_PADOUT) =  0x10;
-#define CLR_GPIO_5() *(volatile int*) (GPIO_REG_PADOUT) = 0x00;
-
-
-/*
-*Each function has a GPIO pin (5 and 6 alternatively ) set before it runs and is cleared after it finish running
-to measure the time of execution of each function.
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
 *Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
 *Also the correct results are printed for the current values which are calculated from the orignal library 
 and also were checked by hand
 */
-void perf_enable_id( int eventid){
-  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(eventid));
-  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
-};
+#define RISCV_BENCH_SUITE "TransformFunctions7"
+#include "../common/riscv_bench.h"
 
 
 
@@ -91,6 +73,7 @@ q15_t state_q15[4*RFFT_LEN] = {0};
 riscv_status status;
 int32_t main(void)
 {
+  riscv_bench_header();
 /*Init*/ 
 /*rfft Init*/
   status = riscv_cfft_radix4_init_q15(&S_cfft_q15,RFFT_LEN/2,ifftFlag,doBitReverse);
@@ -101,11 +84,8 @@ int32_t main(void)
   printf("status = %d\n",status);
 /*Tests*/
 /*dct*/
-  perf_reset();
-  perf_enable_id(EVENT_ID);
-  riscv_dct4_q15(&S_dct_q15,state_q15, testInput_q15);
-  perf_stop();
-  printf("riscv_dct4_q15: %s: %d\n", SPR_PCER_NAME(EVENT_ID),  cpu_perf_get(EVENT_ID));
+  RISCV_BENCH("riscv_dct4_q15", "q15", RFFT_LEN,
+    riscv_dct4_q15(&S_dct_q15,state_q15, testInput_q15));
 #ifdef PRINT_OUTPUT
   PRINT_Q(testInput_q15,RFFT_LEN);
 #endif
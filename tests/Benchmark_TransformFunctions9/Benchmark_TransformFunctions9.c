@@ -0,0 +1,91 @@
+#include "riscv_math.h"
+#include "gpio.h" //for indication for benchmarking
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include <stdio.h>
+#include "riscv_const_structs.h"
+#include "bench.h"
+
+
+
+#define PRINT_F32(X,Y) printf("\n"); for(int i =0 ; i < (Y); i++) printf("%d  ",(int)(X[i]*100)); \
+printf("\n\n")
+//#define PRINT_OUTPUT  /*for testing functionality for each function, removed while benchmarking*/
+#define MAX_FFT_LEN 512
+#define MAX_MIXED_LEN 480
+/*
+*Each function is measured with the shared harness in tests/common/riscv_bench.h, which prints one
+BENCH line per function and performance event.
+*The mixed-radix CFFT is measured at the LTE-style lengths 60, 120, 240 and 480 next to riscv_cfft_f32
+at the power of two length the input would otherwise be zero padded to.
+*Define PRINT_OUTPUT to print the results to check for the functionality of the functions(may be slow)
+*/
+#define RISCV_BENCH_SUITE "TransformFunctions9"
+#include "../common/riscv_bench.h"
+
+float32_t testInput_f32[2*MAX_FFT_LEN];
+float32_t testOutput_f32[2*MAX_FFT_LEN];
+float32_t twiddle_f32[2*(MAX_MIXED_LEN+1)];
+
+uint32_t ifftFlag = 0;
+uint32_t doBitReverse = 1;
+
+typedef struct
+{
+  uint16_t mixedLen;                       /* length of the mixed-radix transform */
+  const riscv_cfft_instance_f32 * pPadded; /* power of two transform used with zero padding */
+} fftLengthPair;
+
+const fftLengthPair lengths[] =
+{
+  {  60, &riscv_cfft_sR_f32_len64  },
+  { 120, &riscv_cfft_sR_f32_len128 },
+  { 240, &riscv_cfft_sR_f32_len256 },
+  { 480, &riscv_cfft_sR_f32_len512 },
+};
+
+riscv_cfft_mixed_instance_f32 S_mixed;
+riscv_status status;
+
+int32_t main(void)
+{
+  uint32_t i, l;
+  uint32_t seed = 1u;
+
+  riscv_bench_header();
+
+  for (l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+  {
+    /*Init*/
+    for (i = 0; i < 2*MAX_FFT_LEN; i++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      testInput_f32[i] = (float32_t)((int32_t)(seed >> 16) & 0x7FFF) / 16384.0f - 1.0f;
+    }
+    status = riscv_cfft_mixed_init_f32(&S_mixed, lengths[l].mixedLen, twiddle_f32);
+    printf("status = %d\n",status);
+
+/*Tests*/
+    RISCV_BENCH("riscv_cfft_mixed_f32", "f32", lengths[l].mixedLen,
+      riscv_cfft_mixed_f32(&S_mixed, testInput_f32, testOutput_f32, ifftFlag));
+#ifdef PRINT_OUTPUT
+    PRINT_F32(testOutput_f32,2*lengths[l].mixedLen);
+#endif
+
+    /*zero padded input*/
+    for (i = 2*lengths[l].mixedLen; i < 2*lengths[l].pPadded->fftLen; i++)
+    {
+      testInput_f32[i] = 0.0f;
+    }
+    RISCV_BENCH("riscv_cfft_f32", "f32", lengths[l].pPadded->fftLen,
+      riscv_cfft_f32(lengths[l].pPadded, testInput_f32, ifftFlag, doBitReverse));
+#ifdef PRINT_OUTPUT
+    PRINT_F32(testInput_f32,2*lengths[l].pPadded->fftLen);
+#endif
+  }
+
+  printf("End\n");
+
+ return 0;
+}
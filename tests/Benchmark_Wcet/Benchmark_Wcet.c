@@ -0,0 +1,129 @@
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+/*
+*Worst-case execution time of the kernels that typically run in a sample interrupt or a control tick, with
+tests/common/riscv_wcet.h: every kernel is run cold and warm on eight adversarial input sets (saturating
+extremes, a sweep of the whole range for the range reductions and table lookups of sqrt/sin/cos/atan2,
+subnormal and huge f32 values) and prints one WCET line per event with the minimum, the maximum, the
+jitter and the input set of the maximum.
+*Budget an interrupt with the max column of the xpulp or scalar build it runs; define RISCV_WCET_COLD()
+to flush the instruction cache of a PULP system with caches.
+*/
+#define RISCV_BENCH_SUITE "Wcet"
+#define RISCV_BENCH_EVENTS { RISCV_BENCH_EV_CYCLES, RISCV_BENCH_EV_INSTR, RISCV_BENCH_EV_IMISS }
+#include "../common/riscv_wcet.h"
+
+#define A15  ((q15_t *) riscv_wcet_inA)
+#define B15  ((q15_t *) riscv_wcet_inB)
+#define A31  ((q31_t *) riscv_wcet_inA)
+#define B31  ((q31_t *) riscv_wcet_inB)
+#define AF   ((float32_t *) riscv_wcet_inA)
+#define BF   ((float32_t *) riscv_wcet_inB)
+#define O15  ((q15_t *) riscv_wcet_out)
+#define O31  ((q31_t *) riscv_wcet_out)
+#define OF   ((float32_t *) riscv_wcet_out)
+
+#define FIR_TAPS    16
+#define NUM_STAGES  2
+
+static q15_t firCoeffs_q15[FIR_TAPS] __attribute__((aligned(4))) = {
+  -120, 340, -610, 1020, -1730, 3010, -6010, 20010, 20010, -6010, 3010, -1730, 1020, -610, 340, -120 };
+static q15_t firState_q15[FIR_TAPS + RISCV_WCET_MAX_BLOCK - 1] __attribute__((aligned(4)));
+static q15_t sampleState_q15[2 * FIR_TAPS] __attribute__((aligned(4)));
+/* {b0, 0, b1, b2, a1, a2} with postShift 1 */
+static q15_t biquadCoeffs_q15[6 * NUM_STAGES] __attribute__((aligned(4))) = {
+  1200, 0, 2400, 1200, 26000, -12000,
+  1200, 0, 2400, 1200, 29000, -14500 };
+static q15_t biquadState_q15[4 * NUM_STAGES] __attribute__((aligned(4)));
+static float32_t biquadCoeffs_f32[5 * NUM_STAGES] = {
+  0.0732f, 0.1464f, 0.0732f, 1.5870f, -0.7324f,
+  0.0732f, 0.1464f, 0.0732f, 1.7700f, -0.8850f };
+static float32_t biquadState_f32[2 * NUM_STAGES];
+
+static riscv_fir_instance_q15 Sfir;
+static riscv_fir_sample_instance_q15 Ssample;
+static riscv_biquad_casd_df1_inst_q15 Sdf1;
+static riscv_biquad_cascade_df2T_instance_f32 Sdf2T;
+static riscv_pid_instance_q15 Spid;
+
+static void reset_fir_q15(void) { riscv_fir_init_q15(&Sfir, FIR_TAPS, firCoeffs_q15, firState_q15, RISCV_WCET_MAX_BLOCK); }
+static void reset_fir_sample_q15(void) { riscv_fir_sample_init_q15(&Ssample, FIR_TAPS, firCoeffs_q15, sampleState_q15); }
+static void reset_df1_q15(void) { riscv_biquad_cascade_df1_init_q15(&Sdf1, NUM_STAGES, biquadCoeffs_q15, biquadState_q15, 1); }
+static void reset_df2T_f32(void) { riscv_biquad_cascade_df2T_init_f32(&Sdf2T, NUM_STAGES, biquadCoeffs_f32, biquadState_f32); }
+static void reset_pid_q15(void)
+{
+  Spid.Kp = 0x4000;
+  Spid.Ki = 0x0800;
+  Spid.Kd = 0x1000;
+  riscv_pid_init_q15(&Spid, 1);
+}
+
+/*
+*Scalar functions are run over the n inputs
+*/
+#define WCET_SCALAR(NAME, IN, OUT)                                  \
+static void run_##NAME(uint32_t n)                                  \
+{                                                                   \
+  uint32_t i;                                                       \
+  for (i = 0; i < n; i++) { OUT[i] = riscv_##NAME(IN[i]); }         \
+}
+
+WCET_SCALAR(sin_f32, AF, OF)
+WCET_SCALAR(cos_f32, AF, OF)
+
+/* The fixed-point sine takes [0, 1) for [0, 2*pi), the sign bit is cleared */
+static void run_sin_q15(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) { O15[i] = riscv_sin_q15(A15[i] & 0x7FFF); } }
+static void run_sin_q31(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) { O31[i] = riscv_sin_q31(A31[i] & 0x7FFFFFFF); } }
+
+static void run_sqrt_f32(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) { riscv_sqrt_f32(AF[i], OF + i); } }
+static void run_sqrt_q15(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) { riscv_sqrt_q15(A15[i], O15 + i); } }
+static void run_sqrt_q31(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) { riscv_sqrt_q31(A31[i], O31 + i); } }
+static void run_atan2_vec_f32(uint32_t n) { riscv_atan2_vec_f32(AF, BF, OF, n); }
+static void run_atan2_vec_q15(uint32_t n) { riscv_atan2_vec_q15(A15, B15, O15, n); }
+static void run_add_q15(uint32_t n) { riscv_add_q15(A15, B15, O15, n); }
+static void run_scale_q15(uint32_t n) { riscv_scale_q15(A15, 0x5B3C, 1, O15, n); }
+static void run_mult_q31(uint32_t n) { riscv_mult_q31(A31, B31, O31, n); }
+static void run_fir_q15(uint32_t n) { riscv_fir_q15(&Sfir, A15, O15, n); }
+static void run_df1_q15(uint32_t n) { riscv_biquad_cascade_df1_q15(&Sdf1, A15, O15, n); }
+static void run_df2T_f32(uint32_t n) { riscv_biquad_cascade_df2T_f32(&Sdf2T, AF, OF, n); }
+static void run_fir_sample_q15(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) { O15[i] = riscv_fir_sample_q15(&Ssample, A15[i]); } }
+static void run_df2T_sample_f32(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) { OF[i] = riscv_biquad_df2T_sample_f32(&Sdf2T, AF[i]); } }
+static void run_pid_q15(uint32_t n) { uint32_t i; for (i = 0; i < n; i++) { O15[i] = riscv_pid_q15(&Spid, A15[i]); } }
+static void run_cfft_q15(uint32_t n) { (void) n; riscv_cfft_q15(&riscv_cfft_sR_q15_len32, A15, 0, 1); }
+
+static const riscv_wcet_case cases[] = {
+  { "riscv_sin_f32",                 RISCV_WCET_F32, 32, run_sin_f32,             NULL },
+  { "riscv_cos_f32",                 RISCV_WCET_F32, 32, run_cos_f32,             NULL },
+  { "riscv_sin_q15",                 RISCV_WCET_Q15, 32, run_sin_q15,             NULL },
+  { "riscv_sin_q31",                 RISCV_WCET_Q31, 32, run_sin_q31,             NULL },
+  { "riscv_sqrt_f32",                RISCV_WCET_F32, 32, run_sqrt_f32,            NULL },
+  { "riscv_sqrt_q15",                RISCV_WCET_Q15, 32, run_sqrt_q15,            NULL },
+  { "riscv_sqrt_q31",                RISCV_WCET_Q31, 32, run_sqrt_q31,            NULL },
+  { "riscv_atan2_vec_f32",           RISCV_WCET_F32, 32, run_atan2_vec_f32,       NULL },
+  { "riscv_atan2_vec_q15",           RISCV_WCET_Q15, 32, run_atan2_vec_q15,       NULL },
+  { "riscv_add_q15",                 RISCV_WCET_Q15, 64, run_add_q15,             NULL },
+  { "riscv_scale_q15",               RISCV_WCET_Q15, 64, run_scale_q15,           NULL },
+  { "riscv_mult_q31",                RISCV_WCET_Q31, 64, run_mult_q31,            NULL },
+  { "riscv_fir_q15",                 RISCV_WCET_Q15, 64, run_fir_q15,             reset_fir_q15 },
+  { "riscv_biquad_cascade_df1_q15",  RISCV_WCET_Q15, 64, run_df1_q15,             reset_df1_q15 },
+  { "riscv_biquad_cascade_df2T_f32", RISCV_WCET_F32, 64, run_df2T_f32,            reset_df2T_f32 },
+  { "riscv_fir_sample_q15",          RISCV_WCET_Q15, 1,  run_fir_sample_q15,      reset_fir_sample_q15 },
+  { "riscv_biquad_df2T_sample_f32",  RISCV_WCET_F32, 1,  run_df2T_sample_f32,     reset_df2T_f32 },
+  { "riscv_pid_q15",                 RISCV_WCET_Q15, 1,  run_pid_q15,             reset_pid_q15 },
+  { "riscv_cfft_q15",                RISCV_WCET_Q15, 64, run_cfft_q15,            NULL },
+};
+
+int main(void)
+{
+  riscv_wcet_run(cases, sizeof(cases) / sizeof(cases[0]));
+
+  return 0;
+}
@@ -0,0 +1,878 @@
+#include <stdio.h>
+#include <string.h>
+#include "riscv_math.h"
+#include "gpio.h"
+#include "utils.h"
+#include "string_lib.h"
+#include "bar.h"
+#include "bench.h"
+
+/*
+*Every kernel below is checked against the plain C reference next to it for all block sizes 1..RISCV_REGRESS_MAX_BLOCK
+and five input patterns, see tests/common/riscv_regress.h.  Fixed-point outputs must be bit-exact, so a SIMD path of
+USE_DSP_RISCV that changes a result fails here.  The cases of CASE_WRAP skip the all-minimum pattern in the xpulp build:
+their pv.dotsp.h pairs wrap on two 0x8000 * 0x8000 products, as the kernels document.  Run the scalar and the xpulp build and compare the REGRESS lines to
+see the cycles per sample of both.
+*The references follow the scalar code of the library, which follows the original CMSIS kernels.
+*/
+#define RISCV_BENCH_SUITE "Regression"
+#include "../common/riscv_regress.h"
+#include "riscv_fir_fixed.h"
+
+#define A7   ((q7_t *) riscv_regress_inA)
+#define B7   ((q7_t *) riscv_regress_inB)
+#define A15  ((q15_t *) riscv_regress_inA)
+#define B15  ((q15_t *) riscv_regress_inB)
+#define A31  ((q31_t *) riscv_regress_inA)
+#define B31  ((q31_t *) riscv_regress_inB)
+#define AF   ((float32_t *) riscv_regress_inA)
+#define BF   ((float32_t *) riscv_regress_inB)
+
+#define FIR_TAPS_Q15   8
+#define FIR_TAPS_Q7    7
+#define CFIR_TAPS_Q15  5
+#define CONV_LEN_B     5
+
+static q15_t sat15(q63_t x) { return (q15_t) ((x > 32767) ? 32767 : ((x < -32768) ? -32768 : x)); }
+static q7_t sat7(q63_t x) { return (q7_t) ((x > 127) ? 127 : ((x < -128) ? -128 : x)); }
+static q31_t sat31(q63_t x) { return (q31_t) ((x > 0x7FFFFFFFLL) ? 0x7FFFFFFFLL : ((x < -0x80000000LL) ? -0x80000000LL : x)); }
+
+/*
+*Element-wise kernels: each case writes n outputs through the same loop for the library and the reference
+*/
+#define REGRESS_BINARY(NAME, T, A, B, EXPR)                        \
+static uint32_t run_##NAME(uint32_t n, void * pDst, int ref)       \
+{                                                                  \
+  T *pD = (T *) pDst;                                              \
+  uint32_t i;                                                      \
+  if(ref == 0) { riscv_##NAME(A, B, pD, n); return n; }            \
+  for (i = 0; i < n; i++) { pD[i] = (EXPR); }                      \
+  return n;                                                        \
+}
+
+#define REGRESS_UNARY(NAME, T, A, EXPR)                            \
+static uint32_t run_##NAME(uint32_t n, void * pDst, int ref)       \
+{                                                                  \
+  T *pD = (T *) pDst;                                              \
+  uint32_t i;                                                      \
+  if(ref == 0) { riscv_##NAME(A, pD, n); return n; }               \
+  for (i = 0; i < n; i++) { pD[i] = (EXPR); }                      \
+  return n;                                                        \
+}
+
+REGRESS_BINARY(add_q7,  q7_t,  A7,  B7,  sat7((q15_t) A7[i] + B7[i]))
+REGRESS_BINARY(add_q15, q15_t, A15, B15, sat15((q31_t) A15[i] + B15[i]))
+REGRESS_BINARY(add_q31, q31_t, A31, B31, sat31((q63_t) A31[i] + B31[i]))
+REGRESS_BINARY(add_f32, float32_t, AF, BF, AF[i] + BF[i])
+REGRESS_BINARY(sub_q7,  q7_t,  A7,  B7,  sat7((q15_t) A7[i] - B7[i]))
+REGRESS_BINARY(sub_q15, q15_t, A15, B15, sat15((q31_t) A15[i] - B15[i]))
+REGRESS_BINARY(sub_q31, q31_t, A31, B31, sat31((q63_t) A31[i] - B31[i]))
+REGRESS_BINARY(mult_q7,  q7_t,  A7,  B7,  sat7(((q15_t) A7[i] * B7[i]) >> 7))
+REGRESS_BINARY(mult_q15, q15_t, A15, B15, sat15(((q31_t) A15[i] * B15[i]) >> 15))
+REGRESS_BINARY(mult_q31, q31_t, A31, B31, sat31(((q63_t) A31[i] * B31[i]) >> 31))
+REGRESS_BINARY(mult_f32, float32_t, AF, BF, AF[i] * BF[i])
+
+REGRESS_UNARY(abs_q7,  q7_t,  A7,  sat7((A7[i] < 0) ? -(q15_t) A7[i] : A7[i]))
+REGRESS_UNARY(abs_q15, q15_t, A15, sat15((A15[i] < 0) ? -(q31_t) A15[i] : A15[i]))
+REGRESS_UNARY(abs_q31, q31_t, A31, sat31((A31[i] < 0) ? -(q63_t) A31[i] : A31[i]))
+REGRESS_UNARY(abs_f32, float32_t, AF, (AF[i] < 0.0f) ? -AF[i] : AF[i])
+REGRESS_UNARY(negate_q7,  q7_t,  A7,  sat7(-(q15_t) A7[i]))
+REGRESS_UNARY(negate_q15, q15_t, A15, sat15(-(q31_t) A15[i]))
+REGRESS_UNARY(negate_q31, q31_t, A31, sat31(-(q63_t) A31[i]))
+REGRESS_UNARY(copy_q7,  q7_t,  A7,  A7[i])
+REGRESS_UNARY(copy_q15, q15_t, A15, A15[i])
+REGRESS_UNARY(q15_to_q7, q7_t, A15, (q7_t) (A15[i] >> 8))
+REGRESS_UNARY(q31_to_q15, q15_t, A31, (q15_t) (A31[i] >> 16))
+REGRESS_UNARY(q31_to_q7, q7_t, A31, (q7_t) (A31[i] >> 24))
+
+/*
+*Kernels with a scalar parameter are run with two parameters, outputs [0, n) and [n, 2n)
+*/
+static uint32_t run_scale_q7(uint32_t n, void * pDst, int ref)
+{
+  q7_t *pD = (q7_t *) pDst;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_scale_q7(A7, 0x5B, 1, pD, n);
+    riscv_scale_q7(A7, -0x33, -2, pD + n, n);
+    return 2u * n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    pD[i] = sat7(((q15_t) A7[i] * 0x5B) >> (7 - 1));
+    pD[n + i] = sat7(((q15_t) A7[i] * -0x33) >> (7 + 2));
+  }
+  return 2u * n;
+}
+
+static uint32_t run_scale_q15(uint32_t n, void * pDst, int ref)
+{
+  q15_t *pD = (q15_t *) pDst;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_scale_q15(A15, 0x5B3C, 1, pD, n);
+    riscv_scale_q15(A15, -0x3311, -2, pD + n, n);
+    return 2u * n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    pD[i] = sat15(((q31_t) A15[i] * 0x5B3C) >> (15 - 1));
+    pD[n + i] = sat15(((q31_t) A15[i] * -0x3311) >> (15 + 2));
+  }
+  return 2u * n;
+}
+
+static uint32_t run_scale_q31(uint32_t n, void * pDst, int ref)
+{
+  q31_t *pD = (q31_t *) pDst;
+  q31_t in;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_scale_q31(A31, 0x5B3C1234, 1, pD, n);
+    riscv_scale_q31(A31, -0x33112233, -2, pD + n, n);
+    return 2u * n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    in = (q31_t) (((q63_t) A31[i] * 0x5B3C1234) >> 32);
+    pD[i] = sat31((q63_t) in << 2);
+    in = (q31_t) (((q63_t) A31[i] * -0x33112233) >> 32);
+    pD[n + i] = in >> 1;
+  }
+  return 2u * n;
+}
+
+static uint32_t run_shift_q7(uint32_t n, void * pDst, int ref)
+{
+  q7_t *pD = (q7_t *) pDst;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_shift_q7(A7, 3, pD, n);
+    riscv_shift_q7(A7, -5, pD + n, n);
+    return 2u * n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    pD[i] = sat7((q15_t) A7[i] << 3);
+    pD[n + i] = (q7_t) (A7[i] >> 5);
+  }
+  return 2u * n;
+}
+
+static uint32_t run_shift_q15(uint32_t n, void * pDst, int ref)
+{
+  q15_t *pD = (q15_t *) pDst;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_shift_q15(A15, 3, pD, n);
+    riscv_shift_q15(A15, -5, pD + n, n);
+    return 2u * n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    pD[i] = sat15((q31_t) A15[i] << 3);
+    pD[n + i] = (q15_t) (A15[i] >> 5);
+  }
+  return 2u * n;
+}
+
+static uint32_t run_shift_q31(uint32_t n, void * pDst, int ref)
+{
+  q31_t *pD = (q31_t *) pDst;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_shift_q31(A31, 3, pD, n);
+    riscv_shift_q31(A31, -5, pD + n, n);
+    return 2u * n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    pD[i] = sat31((q63_t) A31[i] << 3);
+    pD[n + i] = A31[i] >> 5;
+  }
+  return 2u * n;
+}
+
+static uint32_t run_offset_q7(uint32_t n, void * pDst, int ref)
+{
+  q7_t *pD = (q7_t *) pDst;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_offset_q7(A7, 0x25, pD, n);
+    riscv_offset_q7(A7, -0x71, pD + n, n);
+    return 2u * n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    pD[i] = sat7((q15_t) A7[i] + 0x25);
+    pD[n + i] = sat7((q15_t) A7[i] - 0x71);
+  }
+  return 2u * n;
+}
+
+static uint32_t run_offset_q15(uint32_t n, void * pDst, int ref)
+{
+  q15_t *pD = (q15_t *) pDst;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_offset_q15(A15, 0x2571, pD, n);
+    riscv_offset_q15(A15, -0x7102, pD + n, n);
+    return 2u * n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    pD[i] = sat15((q31_t) A15[i] + 0x2571);
+    pD[n + i] = sat15((q31_t) A15[i] - 0x7102);
+  }
+  return 2u * n;
+}
+
+static uint32_t run_offset_q31(uint32_t n, void * pDst, int ref)
+{
+  q31_t *pD = (q31_t *) pDst;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_offset_q31(A31, 0x25710000, pD, n);
+    riscv_offset_q31(A31, -0x71020000, pD + n, n);
+    return 2u * n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    pD[i] = sat31((q63_t) A31[i] + 0x25710000);
+    pD[n + i] = sat31((q63_t) A31[i] - 0x71020000);
+  }
+  return 2u * n;
+}
+
+static uint32_t run_fill_q15(uint32_t n, void * pDst, int ref)
+{
+  q15_t *pD = (q15_t *) pDst;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_fill_q15(A15[0], pD, n);
+    return n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    pD[i] = A15[0];
+  }
+  return n;
+}
+
+/*
+*Reductions, one or two outputs
+*/
+static uint32_t run_dot_prod_q7(uint32_t n, void * pDst, int ref)
+{
+  q31_t sum = 0;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_dot_prod_q7(A7, B7, n, (q31_t *) pDst);
+    return 1u;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    sum += (q15_t) A7[i] * B7[i];
+  }
+  *(q31_t *) pDst = sum;
+  return 1u;
+}
+
+static uint32_t run_dot_prod_q15(uint32_t n, void * pDst, int ref)
+{
+  q63_t sum = 0;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_dot_prod_q15(A15, B15, n, (q63_t *) pDst);
+    return 1u;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    sum += (q31_t) A15[i] * B15[i];
+  }
+  *(q63_t *) pDst = sum;
+  return 1u;
+}
+
+static uint32_t run_dot_prod_f32(uint32_t n, void * pDst, int ref)
+{
+  float32_t sum = 0.0f;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_dot_prod_f32(AF, BF, n, (float32_t *) pDst);
+    return 1u;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    sum += AF[i] * BF[i];
+  }
+  *(float32_t *) pDst = sum;
+  return 1u;
+}
+
+static uint32_t run_power_q7(uint32_t n, void * pDst, int ref)
+{
+  q31_t sum = 0;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_power_q7(A7, n, (q31_t *) pDst);
+    return 1u;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    sum += (q15_t) A7[i] * A7[i];
+  }
+  *(q31_t *) pDst = sum;
+  return 1u;
+}
+
+static uint32_t run_power_q15(uint32_t n, void * pDst, int ref)
+{
+  q63_t sum = 0;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_power_q15(A15, n, (q63_t *) pDst);
+    return 1u;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    sum += (q31_t) A15[i] * A15[i];
+  }
+  *(q63_t *) pDst = sum;
+  return 1u;
+}
+
+static uint32_t run_mean_q7(uint32_t n, void * pDst, int ref)
+{
+  q31_t sum = 0;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_mean_q7(A7, n, (q7_t *) pDst);
+    return 1u;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    sum += A7[i];
+  }
+  *(q7_t *) pDst = (q7_t) (sum / (int32_t) n);
+  return 1u;
+}
+
+static uint32_t run_mean_q15(uint32_t n, void * pDst, int ref)
+{
+  q31_t sum = 0;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_mean_q15(A15, n, (q15_t *) pDst);
+    return 1u;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    sum += A15[i];
+  }
+  *(q15_t *) pDst = (q15_t) (sum / (int32_t) n);
+  return 1u;
+}
+
+/*
+*Maximum and minimum as {value, index}, the index is the first occurrence
+*/
+static uint32_t run_max_q15(uint32_t n, void * pDst, int ref)
+{
+  q31_t *pD = (q31_t *) pDst;
+  q15_t v;
+  uint32_t i, idx = 0;
+
+  if(ref == 0)
+  {
+    riscv_max_q15(A15, n, &v, &idx);
+    pD[0] = v;
+    pD[1] = (q31_t) idx;
+    return 2u;
+  }
+
+  for (i = 1; i < n; i++)
+  {
+    idx = (A15[i] > A15[idx]) ? i : idx;
+  }
+  pD[0] = A15[idx];
+  pD[1] = (q31_t) idx;
+  return 2u;
+}
+
+static uint32_t run_min_q15(uint32_t n, void * pDst, int ref)
+{
+  q31_t *pD = (q31_t *) pDst;
+  q15_t v;
+  uint32_t i, idx = 0;
+
+  if(ref == 0)
+  {
+    riscv_min_q15(A15, n, &v, &idx);
+    pD[0] = v;
+    pD[1] = (q31_t) idx;
+    return 2u;
+  }
+
+  for (i = 1; i < n; i++)
+  {
+    idx = (A15[i] < A15[idx]) ? i : idx;
+  }
+  pD[0] = A15[idx];
+  pD[1] = (q31_t) idx;
+  return 2u;
+}
+
+static uint32_t run_max_q7(uint32_t n, void * pDst, int ref)
+{
+  q31_t *pD = (q31_t *) pDst;
+  q7_t v;
+  uint32_t i, idx = 0;
+
+  if(ref == 0)
+  {
+    riscv_max_q7(A7, n, &v, &idx);
+    pD[0] = v;
+    pD[1] = (q31_t) idx;
+    return 2u;
+  }
+
+  for (i = 1; i < n; i++)
+  {
+    idx = (A7[i] > A7[idx]) ? i : idx;
+  }
+  pD[0] = A7[idx];
+  pD[1] = (q31_t) idx;
+  return 2u;
+}
+
+static uint32_t run_min_q7(uint32_t n, void * pDst, int ref)
+{
+  q31_t *pD = (q31_t *) pDst;
+  q7_t v;
+  uint32_t i, idx = 0;
+
+  if(ref == 0)
+  {
+    riscv_min_q7(A7, n, &v, &idx);
+    pD[0] = v;
+    pD[1] = (q31_t) idx;
+    return 2u;
+  }
+
+  for (i = 1; i < n; i++)
+  {
+    idx = (A7[i] < A7[idx]) ? i : idx;
+  }
+  pD[0] = A7[idx];
+  pD[1] = (q31_t) idx;
+  return 2u;
+}
+
+/*
+*Complex kernels, n complex samples
+*/
+static uint32_t run_cmplx_conj_q15(uint32_t n, void * pDst, int ref)
+{
+  q15_t *pD = (q15_t *) pDst;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_cmplx_conj_q15(A15, pD, n);
+    return 2u * n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    pD[2 * i] = A15[2 * i];
+    pD[2 * i + 1] = sat15(-(q31_t) A15[2 * i + 1]);
+  }
+  return 2u * n;
+}
+
+static uint32_t run_cmplx_mag_squared_q15(uint32_t n, void * pDst, int ref)
+{
+  q15_t *pD = (q15_t *) pDst;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_cmplx_mag_squared_q15(A15, pD, n);
+    return n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    pD[i] = (q15_t) ((((q63_t) A15[2 * i] * A15[2 * i]) + ((q31_t) A15[2 * i + 1] * A15[2 * i + 1])) >> 17);
+  }
+  return n;
+}
+
+static uint32_t run_cmplx_mult_cmplx_q15(uint32_t n, void * pDst, int ref)
+{
+  q15_t *pD = (q15_t *) pDst;
+  q31_t a, b, c, d;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_cmplx_mult_cmplx_q15(A15, B15, pD, n);
+    return 2u * n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    a = A15[2 * i];
+    b = A15[2 * i + 1];
+    c = B15[2 * i];
+    d = B15[2 * i + 1];
+    pD[2 * i] = (q15_t) (((a * c) >> 17) - ((b * d) >> 17));
+    pD[2 * i + 1] = (q15_t) (((a * d) >> 17) + ((b * c) >> 17));
+  }
+  return 2u * n;
+}
+
+static uint32_t run_cmplx_mult_real_q15(uint32_t n, void * pDst, int ref)
+{
+  q15_t *pD = (q15_t *) pDst;
+  uint32_t i;
+
+  if(ref == 0)
+  {
+    riscv_cmplx_mult_real_q15(A15, B15, pD, n);
+    return 2u * n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    pD[2 * i] = sat15(((q31_t) A15[2 * i] * B15[i]) >> 15);
+    pD[2 * i + 1] = sat15(((q31_t) A15[2 * i + 1] * B15[i]) >> 15);
+  }
+  return 2u * n;
+}
+
+/*
+*Filters: a fresh instance per call so that every block size starts from a zero state
+*/
+static uint32_t run_fir_q15(uint32_t n, void * pDst, int ref)
+{
+  static q15_t state[FIR_TAPS_Q15 + RISCV_REGRESS_MAX_BLOCK];
+  riscv_fir_instance_q15 S;
+  q15_t *pD = (q15_t *) pDst;
+  q15_t *pCoeffs = B15;
+  q63_t acc;
+  uint32_t i, k;
+
+  if(ref == 0)
+  {
+    riscv_fir_init_q15(&S, FIR_TAPS_Q15, pCoeffs, state, n);
+    riscv_fir_q15(&S, A15, pD, n);
+    return n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    acc = 0;
+    for (k = 0; k < FIR_TAPS_Q15; k++)
+    {
+      if((i + k) >= (FIR_TAPS_Q15 - 1))
+      {
+        acc += (q31_t) pCoeffs[k] * A15[i + k - (FIR_TAPS_Q15 - 1)];
+      }
+    }
+    pD[i] = sat15(acc >> 15);
+  }
+  return n;
+}
+
+/*
+*Complex FIR with real taps, outputs [0, 2n), and with complex taps, outputs [2n, 4n)
+*/
+static uint32_t run_cfir_q15(uint32_t n, void * pDst, int ref)
+{
+  static q15_t state[2 * (CFIR_TAPS_Q15 + RISCV_REGRESS_MAX_BLOCK)];
+  riscv_cfir_instance_q15 S;
+  q15_t *pD = (q15_t *) pDst;
+  q15_t *pCoeffs = B15;
+  q63_t accRe, accIm;
+  q31_t xRe, xIm, bRe, bIm;
+  uint32_t i, k, cmplx, m;
+
+  for (cmplx = 0; cmplx < 2u; cmplx++)
+  {
+    if(ref == 0)
+    {
+      riscv_cfir_init_q15(&S, CFIR_TAPS_Q15, pCoeffs, state, n, (uint8_t) cmplx);
+      riscv_cfir_q15(&S, A15, pD + (2u * n * cmplx), n);
+      continue;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+      accRe = 0;
+      accIm = 0;
+      for (k = 0; k < CFIR_TAPS_Q15; k++)
+      {
+        if((i + k) >= (CFIR_TAPS_Q15 - 1))
+        {
+          m = i + k - (CFIR_TAPS_Q15 - 1);
+          xRe = A15[2 * m];
+          xIm = A15[2 * m + 1];
+          bRe = (cmplx != 0u) ? pCoeffs[2 * k] : pCoeffs[k];
+          bIm = (cmplx != 0u) ? pCoeffs[2 * k + 1] : 0;
+          accRe += (q63_t) xRe * bRe - (q63_t) xIm * bIm;
+          accIm += (q63_t) xRe * bIm + (q63_t) xIm * bRe;
+        }
+      }
+      pD[(2u * n * cmplx) + (2 * i)] = sat15(accRe >> 15);
+      pD[(2u * n * cmplx) + (2 * i) + 1] = sat15(accIm >> 15);
+    }
+  }
+  return 4u * n;
+}
+
+/*
+*Kernel generated for 7 taps with the coefficients compiled in, an odd count riscv_fir_q15 does not support
+*/
+static const q15_t fixedCoeffs_q15[7] = { 0x0123, -0x2000, 0x7FFF, -0x8000, 0x3039, 0x004D, -0x0005 };
+
+static RISCV_FIR_FIXED_Q15(riscv_fir_fixed_7_q15, 7u, fixedCoeffs_q15)
+
+static uint32_t run_fir_fixed_q15(uint32_t n, void * pDst, int ref)
+{
+  static q15_t state[7 + RISCV_REGRESS_MAX_BLOCK];
+  riscv_fir_instance_q15 S;
+  q15_t *pD = (q15_t *) pDst;
+  q63_t acc;
+  uint32_t i, k;
+
+  if(ref == 0)
+  {
+    riscv_fir_init_q15(&S, 7, (q15_t *) fixedCoeffs_q15, state, n);
+    S.pKernel = riscv_fir_fixed_7_q15;
+    riscv_fir_q15(&S, A15, pD, n);
+    return n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    acc = 0;
+    for (k = 0; k < 7u; k++)
+    {
+      if((i + k) >= 6u)
+      {
+        acc += (q31_t) fixedCoeffs_q15[k] * A15[i + k - 6u];
+      }
+    }
+    pD[i] = sat15(acc >> 15);
+  }
+  return n;
+}
+
+static uint32_t run_fir_q7(uint32_t n, void * pDst, int ref)
+{
+  static q7_t state[FIR_TAPS_Q7 + RISCV_REGRESS_MAX_BLOCK];
+  riscv_fir_instance_q7 S;
+  q7_t *pD = (q7_t *) pDst;
+  q7_t *pCoeffs = B7;
+  q31_t acc;
+  uint32_t i, k;
+
+  if(ref == 0)
+  {
+    riscv_fir_init_q7(&S, FIR_TAPS_Q7, pCoeffs, state, n);
+    riscv_fir_q7(&S, A7, pD, n);
+    return n;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    acc = 0;
+    for (k = 0; k < FIR_TAPS_Q7; k++)
+    {
+      if((i + k) >= (FIR_TAPS_Q7 - 1))
+      {
+        acc += (q15_t) pCoeffs[k] * A7[i + k - (FIR_TAPS_Q7 - 1)];
+      }
+    }
+    pD[i] = sat7(acc >> 7);
+  }
+  return n;
+}
+
+static uint32_t run_conv_q15(uint32_t n, void * pDst, int ref)
+{
+  q15_t *pD = (q15_t *) pDst;
+  q63_t acc;
+  uint32_t i, j;
+
+  if(ref == 0)
+  {
+    riscv_conv_q15(A15, n, B15, CONV_LEN_B, pD);
+    return n + CONV_LEN_B - 1u;
+  }
+
+  for (i = 0; i < (n + CONV_LEN_B - 1u); i++)
+  {
+    acc = 0;
+    for (j = 0; j <= i; j++)
+    {
+      if((j < n) && ((i - j) < CONV_LEN_B))
+      {
+        acc += (q31_t) A15[j] * B15[i - j];
+      }
+    }
+    pD[i] = sat15(acc >> 15);
+  }
+  return n + CONV_LEN_B - 1u;
+}
+
+static uint32_t run_conv_q7(uint32_t n, void * pDst, int ref)
+{
+  q7_t *pD = (q7_t *) pDst;
+  q31_t acc;
+  uint32_t i, j;
+
+  if(ref == 0)
+  {
+    riscv_conv_q7(A7, n, B7, CONV_LEN_B, pD);
+    return n + CONV_LEN_B - 1u;
+  }
+
+  for (i = 0; i < (n + CONV_LEN_B - 1u); i++)
+  {
+    acc = 0;
+    for (j = 0; j <= i; j++)
+    {
+      if((j < n) && ((i - j) < CONV_LEN_B))
+      {
+        acc += (q15_t) A7[j] * B7[i - j];
+      }
+    }
+    pD[i] = sat7(acc >> 7);
+  }
+  return n + CONV_LEN_B - 1u;
+}
+
+/*
+*Correlation of n samples with CONV_LEN_B samples, 2*max(n, CONV_LEN_B)-1 outputs:
+the kernel writes only the n + CONV_LEN_B - 1 lags that overlap, the others are zeroed beforehand
+*/
+static uint32_t run_correlate_q15(uint32_t n, void * pDst, int ref)
+{
+  q15_t *pD = (q15_t *) pDst;
+  uint32_t len = (n > CONV_LEN_B) ? n : CONV_LEN_B;
+  q63_t acc;
+  int32_t k, j, lag;
+
+  if(ref == 0)
+  {
+    memset(pD, 0, ((2u * len) - 1u) * sizeof(q15_t));
+    riscv_correlate_q15(A15, n, B15, CONV_LEN_B, pD);
+    return (2u * len) - 1u;
+  }
+
+  /* Output k holds lag k - (len - 1) of sum A[j] * B[j - lag] */
+  for (k = 0; k < (int32_t) ((2u * len) - 1u); k++)
+  {
+    lag = k - ((int32_t) len - 1);
+    acc = 0;
+    for (j = 0; j < (int32_t) n; j++)
+    {
+      if(((j - lag) >= 0) && ((j - lag) < CONV_LEN_B))
+      {
+        acc += (q31_t) A15[j] * B15[j - lag];
+      }
+    }
+    pD[k] = sat15(acc >> 15);
+  }
+  return (2u * len) - 1u;
+}
+
+#define CASE(NAME, IN, OUT) { "riscv_" #NAME, RISCV_REGRESS_##IN, RISCV_REGRESS_##OUT, run_##NAME, 0.0f, 0u }
+#define CASE_WRAP(NAME, IN, OUT) { "riscv_" #NAME, RISCV_REGRESS_##IN, RISCV_REGRESS_##OUT, run_##NAME, 0.0f, \
+                                   RISCV_REGRESS_PATTERN_MIN }
+#define CASE_F32(NAME, TOL) { "riscv_" #NAME, RISCV_REGRESS_F32, RISCV_REGRESS_F32, run_##NAME, (TOL), 0u }
+
+static const riscv_regress_case cases[] =
+{
+  CASE(add_q7, Q7, Q7),                CASE(add_q15, Q15, Q15),           CASE(add_q31, Q31, Q31),
+  CASE(sub_q7, Q7, Q7),                CASE(sub_q15, Q15, Q15),           CASE(sub_q31, Q31, Q31),
+  CASE(mult_q7, Q7, Q7),               CASE(mult_q15, Q15, Q15),          CASE(mult_q31, Q31, Q31),
+  CASE(abs_q7, Q7, Q7),                CASE(abs_q15, Q15, Q15),           CASE(abs_q31, Q31, Q31),
+  CASE(negate_q7, Q7, Q7),             CASE(negate_q15, Q15, Q15),        CASE(negate_q31, Q31, Q31),
+  CASE(scale_q7, Q7, Q7),              CASE(scale_q15, Q15, Q15),         CASE(scale_q31, Q31, Q31),
+  CASE(shift_q7, Q7, Q7),              CASE(shift_q15, Q15, Q15),         CASE(shift_q31, Q31, Q31),
+  CASE(offset_q7, Q7, Q7),             CASE(offset_q15, Q15, Q15),        CASE(offset_q31, Q31, Q31),
+  CASE(dot_prod_q7, Q7, Q31),          CASE_WRAP(dot_prod_q15, Q15, Q63),
+  CASE(power_q7, Q7, Q31),             CASE_WRAP(power_q15, Q15, Q63),
+  CASE(mean_q7, Q7, Q7),               CASE(mean_q15, Q15, Q15),
+  CASE(max_q7, Q7, Q31),               CASE(max_q15, Q15, Q31),
+  CASE(min_q7, Q7, Q31),               CASE(min_q15, Q15, Q31),
+  CASE(copy_q7, Q7, Q7),               CASE(copy_q15, Q15, Q15),          CASE(fill_q15, Q15, Q15),
+  CASE(q15_to_q7, Q15, Q7),            CASE(q31_to_q15, Q31, Q15),        CASE(q31_to_q7, Q31, Q7),
+  CASE(cmplx_conj_q15, Q15, Q15),      CASE_WRAP(cmplx_mag_squared_q15, Q15, Q15),
+  CASE(cmplx_mult_cmplx_q15, Q15, Q15), CASE(cmplx_mult_real_q15, Q15, Q15),
+  CASE_WRAP(fir_q15, Q15, Q15),        CASE(fir_q7, Q7, Q7),              CASE(fir_fixed_q15, Q15, Q15),
+  CASE_WRAP(cfir_q15, Q15, Q15),
+  CASE_WRAP(conv_q15, Q15, Q15),       CASE(conv_q7, Q7, Q7),             CASE_WRAP(correlate_q15, Q15, Q15),
+  CASE_F32(add_f32, 0.0f),             CASE_F32(mult_f32, 0.0f),          CASE_F32(abs_f32, 0.0f),
+  CASE_F32(dot_prod_f32, 1e-5f)
+};
+
+int32_t main(void)
+{
+  return riscv_regress_run(cases, sizeof(cases) / sizeof(cases[0]));
+}
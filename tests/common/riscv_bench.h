@@ -0,0 +1,346 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_bench.h
+*
+* Description:  Shared cycle-accurate benchmark harness for the
+*               tests/Benchmark_* programs.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+/*
+* Every measurement is repeated for each performance event listed in
+* RISCV_BENCH_EVENTS.  For each event the kernel is first run
+* RISCV_BENCH_WARMUP times without recording and then RISCV_BENCH_REPEAT
+* times with the counter enabled; the minimum and the median of the
+* recorded runs are reported.
+*
+* The output is one comma separated line per kernel and event:
+*
+*   #BENCH,suite,kernel,type,size,build,event,min,median
+*   BENCH,FilteringFunctions1,riscv_fir_q15,q15,32,xpulp,Cycles,612,614
+*
+* so that the logs of a scalar and of a USE_DSP_RISCV build can be
+* compared with a single grep/diff.  The counters are read through the
+* timer interface of riscv_bench_timer.h, on a host the only event is the
+* elapsed time in nanoseconds and the build is "host".
+*
+* Scaling sweeps use RISCV_BENCH_SWEEP(kernel, type, size, param,
+* samples, ops, statement) inside loops over the block size, tap count,
+* stage count or FFT length.  Besides the BENCH line they print the
+* minimum per output sample and per operation (MAC for filters, radix-2
+* butterfly for FFTs) with two decimals, the curves that show the fixed
+* cost of loop setup and tails at small sizes and the memory effects at
+* large ones:
+*
+*   #SWEEP,suite,kernel,type,size,param,build,event,min,per_sample,per_op
+*   SWEEP,Sweep,riscv_fir_q15,q15,64,16,xpulp,Cycles,1410,22.03,1.37
+*
+* Two ways of describing a measurement are supported:
+*
+* - RISCV_BENCH(kernel, type, size, statement) measures a statement in
+*   place, which keeps all locals of main() accessible.
+* - A table of riscv_bench_case entries passed to riscv_bench_run()
+*   registers kernels through small wrapper functions.
+*
+* Pipeline benchmarks measure each stage and the whole chain, then call
+* riscv_bench_budget(name, budget), which compares the minimum of the first
+* event of the last measurement with a budget in the same unit and prints
+*
+*   #BUDGET,suite,kernel,build,event,min,budget,percent
+*   BUDGET,Pipelines,kws/fir_decimate,xpulp,Cycles,7310,60000,12.18
+*
+* Define PRINT_OUTPUT before including this file to check the results of
+* the kernels: the harness then runs every kernel exactly once so in-place
+* kernels (FFTs, filters with state) still produce the expected output.
+*/
+
+#ifndef _RISCV_BENCH_H
+#define _RISCV_BENCH_H
+
+#include <stdio.h>
+#include "riscv_math.h"
+#include "riscv_bench_timer.h"
+
+#ifdef PRINT_OUTPUT
+#undef  RISCV_BENCH_WARMUP
+#undef  RISCV_BENCH_REPEAT
+#undef  RISCV_BENCH_EVENTS
+#define RISCV_BENCH_WARMUP   0
+#define RISCV_BENCH_REPEAT   1
+#define RISCV_BENCH_EVENTS   { RISCV_BENCH_EV_CYCLES }
+#endif
+
+#ifndef RISCV_BENCH_WARMUP
+#define RISCV_BENCH_WARMUP   1    /* runs discarded before measuring */
+#endif
+
+#ifndef RISCV_BENCH_REPEAT
+#define RISCV_BENCH_REPEAT   5    /* measured runs per event */
+#endif
+
+#ifndef RISCV_BENCH_EVENTS
+#define RISCV_BENCH_EVENTS   { RISCV_BENCH_EV_CYCLES,    \
+                               RISCV_BENCH_EV_INSTR,     \
+                               RISCV_BENCH_EV_LD_STALL,  \
+                               RISCV_BENCH_EV_JMP_STALL, \
+                               RISCV_BENCH_EV_TCDM_CONT }
+#endif
+
+#ifndef RISCV_BENCH_SUITE
+#define RISCV_BENCH_SUITE    "unnamed"
+#endif
+
+/* "_d" marks a build with hardware double precision, the f64 kernels of riscv_cmsis_dsp_lib_double */
+#if defined (__riscv_flen) && (__riscv_flen == 64)
+#define RISCV_BENCH_DOUBLE   "_d"
+#else
+#define RISCV_BENCH_DOUBLE   ""
+#endif
+
+#if defined (RISCV_BENCH_HOST)
+#define RISCV_BENCH_BUILD    "host"
+#elif defined (USE_DSP_RISCV)
+#define RISCV_BENCH_BUILD    "xpulp" RISCV_BENCH_DOUBLE
+#else
+#define RISCV_BENCH_BUILD    "scalar" RISCV_BENCH_DOUBLE
+#endif
+
+static const int riscv_bench_events[] = RISCV_BENCH_EVENTS;
+
+#define RISCV_BENCH_NUM_EVENTS  (sizeof(riscv_bench_events) / sizeof(riscv_bench_events[0]))
+
+/* Minimum of the first event of the last measurement, read by riscv_bench_budget() */
+static int riscv_bench_last_min;
+
+  /**
+   * @brief State of one measurement, iterated by riscv_bench_next().
+   */
+  typedef struct
+  {
+    const char *kernel;                    /**< name of the measured kernel. */
+    const char *type;                      /**< data type of the kernel (f32, q31, q15, q7, ...). */
+    uint32_t size;                         /**< problem size (block size, FFT length, number of elements). */
+    uint32_t param;                        /**< second sweep parameter (taps, stages), 0 if none. */
+    uint32_t numSamples;                   /**< output samples per run of a sweep, 0 for a plain measurement. */
+    uint32_t numOps;                       /**< operations (MACs, butterflies) per run of a sweep. */
+    uint32_t eventIdx;                     /**< index of the current event in riscv_bench_events. */
+    uint32_t run;                          /**< current run for the event, warm-up runs included. */
+    int samples[RISCV_BENCH_REPEAT];       /**< recorded counter values for the current event. */
+  } riscv_bench_state;
+
+  /**
+   * @brief One entry of a benchmark registration table.
+   */
+  typedef struct
+  {
+    const char *kernel;                    /**< name of the measured kernel. */
+    const char *type;                      /**< data type of the kernel. */
+    uint32_t size;                         /**< problem size. */
+    void (*run)(void *arg);                /**< wrapper calling the kernel once. */
+    void *arg;                             /**< argument handed to the wrapper. */
+  } riscv_bench_case;
+
+
+static inline void riscv_bench_header(void)
+{
+  printf("#BENCH,suite,kernel,type,size,build,event,min,median\n");
+}
+
+static inline void riscv_bench_budget_header(void)
+{
+  printf("#BUDGET,suite,kernel,build,event,min,budget,percent\n");
+}
+
+static inline void riscv_bench_sweep_header(void)
+{
+  printf("#SWEEP,suite,kernel,type,size,param,build,event,min,per_sample,per_op\n");
+}
+
+static inline void riscv_bench_begin(
+  riscv_bench_state * B,
+  const char * kernel,
+  const char * type,
+  uint32_t size)
+{
+  B->kernel = kernel;
+  B->type = type;
+  B->size = size;
+  B->param = 0u;
+  B->numSamples = 0u;
+  B->numOps = 0u;
+  B->eventIdx = 0u;
+  B->run = 0u;
+}
+
+static inline void riscv_bench_begin_sweep(
+  riscv_bench_state * B,
+  const char * kernel,
+  const char * type,
+  uint32_t size,
+  uint32_t param,
+  uint32_t numSamples,
+  uint32_t numOps)
+{
+  riscv_bench_begin(B, kernel, type, size);
+  B->param = param;
+  B->numSamples = numSamples;
+  B->numOps = numOps;
+}
+
+/* Prints a/b with two decimals without floating point, for the FPU-less cores */
+static inline void riscv_bench_print_ratio(
+  uint32_t a,
+  uint32_t b)
+{
+  uint32_t r = (b != 0u) ? (uint32_t) (((uint64_t) a * 100u) / b) : 0u;
+
+  printf("%d.%02d", (int) (r / 100u), (int) (r % 100u));
+}
+
+static inline int riscv_bench_next(
+  riscv_bench_state * B)
+{
+  return (B->eventIdx < RISCV_BENCH_NUM_EVENTS);
+}
+
+static inline void riscv_bench_start(
+  riscv_bench_state * B)
+{
+  riscv_bench_timer_start(riscv_bench_events[B->eventIdx]);
+}
+
+static inline void riscv_bench_report(
+  riscv_bench_state * B)
+{
+  int event = riscv_bench_events[B->eventIdx];
+  int tmp;
+  int i, j;
+
+  /* Insertion sort, RISCV_BENCH_REPEAT is small */
+  for (i = 1; i < RISCV_BENCH_REPEAT; i++)
+  {
+    tmp = B->samples[i];
+    for (j = i; (j > 0) && (B->samples[j - 1] > tmp); j--)
+    {
+      B->samples[j] = B->samples[j - 1];
+    }
+    B->samples[j] = tmp;
+  }
+
+  printf("BENCH,%s,%s,%s,%d,%s,%s,%d,%d\n", RISCV_BENCH_SUITE, B->kernel, B->type,
+         (int) B->size, RISCV_BENCH_BUILD, riscv_bench_timer_name(event),
+         B->samples[0], B->samples[RISCV_BENCH_REPEAT / 2]);
+
+  if(B->eventIdx == 0u)
+  {
+    riscv_bench_last_min = B->samples[0];
+  }
+
+  if(B->numSamples != 0u)
+  {
+    printf("SWEEP,%s,%s,%s,%d,%d,%s,%s,%d,", RISCV_BENCH_SUITE, B->kernel, B->type, (int) B->size,
+           (int) B->param, RISCV_BENCH_BUILD, riscv_bench_timer_name(event), B->samples[0]);
+    riscv_bench_print_ratio((uint32_t) B->samples[0], B->numSamples);
+    printf(",");
+    riscv_bench_print_ratio((uint32_t) B->samples[0], B->numOps);
+    printf("\n");
+  }
+}
+
+static inline void riscv_bench_stop(
+  riscv_bench_state * B)
+{
+  riscv_bench_timer_stop();
+
+  if(B->run >= RISCV_BENCH_WARMUP)
+  {
+    B->samples[B->run - RISCV_BENCH_WARMUP] = riscv_bench_timer_read(riscv_bench_events[B->eventIdx]);
+  }
+
+  B->run++;
+
+  if(B->run == (RISCV_BENCH_WARMUP + RISCV_BENCH_REPEAT))
+  {
+    riscv_bench_report(B);
+    B->run = 0u;
+    B->eventIdx++;
+  }
+}
+
+/*
+* Measures a statement in place.  The statement is executed
+* (RISCV_BENCH_WARMUP + RISCV_BENCH_REPEAT) times for every event.
+*/
+#define RISCV_BENCH(KERNEL, TYPE, SIZE, ...)                \
+  do                                                        \
+  {                                                         \
+    riscv_bench_state _bench;                               \
+    riscv_bench_begin(&_bench, (KERNEL), (TYPE), (SIZE));   \
+    while(riscv_bench_next(&_bench))                        \
+    {                                                       \
+      riscv_bench_start(&_bench);                           \
+      __VA_ARGS__;                                          \
+      riscv_bench_stop(&_bench);                            \
+    }                                                       \
+  } while(0)
+
+/*
+* Measures one point of a scaling sweep: SIZE and PARAM identify the point,
+* SAMPLES and OPS are the output samples and operations of one run.
+*/
+#define RISCV_BENCH_SWEEP(KERNEL, TYPE, SIZE, PARAM, SAMPLES, OPS, ...)                      \
+  do                                                                                         \
+  {                                                                                          \
+    riscv_bench_state _bench;                                                                \
+    riscv_bench_begin_sweep(&_bench, (KERNEL), (TYPE), (SIZE), (PARAM), (SAMPLES), (OPS));   \
+    while(riscv_bench_next(&_bench))                                                         \
+    {                                                                                        \
+      riscv_bench_start(&_bench);                                                            \
+      __VA_ARGS__;                                                                           \
+      riscv_bench_stop(&_bench);                                                             \
+    }                                                                                        \
+  } while(0)
+
+/*
+* Prints the share of a budget taken by the last measurement and returns 1
+* if it fits.  The budget is in the unit of the first event, cycles on
+* PULPino and nanoseconds on a host.
+*/
+static inline int riscv_bench_budget(
+  const char * kernel,
+  uint32_t budget)
+{
+  uint32_t used = (uint32_t) riscv_bench_last_min;
+
+  printf("BUDGET,%s,%s,%s,%s,%d,%d,", RISCV_BENCH_SUITE, kernel, RISCV_BENCH_BUILD,
+         riscv_bench_timer_name(riscv_bench_events[0]), (int) used, (int) budget);
+  riscv_bench_print_ratio(used * 100u, budget);
+  printf("\n");
+
+  return (used <= budget);
+}
+
+/*
+* Runs every entry of a registration table.
+*/
+static inline void riscv_bench_run(
+  const riscv_bench_case * pCases,
+  uint32_t numCases)
+{
+  riscv_bench_state B;
+  uint32_t i;
+
+  for (i = 0u; i < numCases; i++)
+  {
+    riscv_bench_begin(&B, pCases[i].kernel, pCases[i].type, pCases[i].size);
+    while(riscv_bench_next(&B))
+    {
+      riscv_bench_start(&B);
+      pCases[i].run(pCases[i].arg);
+      riscv_bench_stop(&B);
+    }
+  }
+}
+
+#endif /* _RISCV_BENCH_H */
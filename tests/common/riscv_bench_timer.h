@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_bench_timer.h
+*
+* Description:  Timer interface of the benchmark harness, over the PULP
+*               performance counters or the monotonic clock of a host.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+/*
+* riscv_bench.h only measures through the four functions below:
+*
+*   riscv_bench_timer_start(event)  resets and starts the counter of an event
+*   riscv_bench_timer_stop()        stops it
+*   riscv_bench_timer_read(event)   returns the count of the last measurement
+*   riscv_bench_timer_name(event)   returns the name printed in the BENCH lines
+*
+* On PULPino they drive the performance counters of utils.h/bench.h.  With
+* RISCV_BENCH_HOST, defined by the native CMake build of tests/, the only
+* event is the elapsed time in nanoseconds of clock_gettime(CLOCK_MONOTONIC).
+*/
+
+#ifndef _RISCV_BENCH_TIMER_H
+#define _RISCV_BENCH_TIMER_H
+
+/*
+* PULP performance counter event IDs
+* (see SPR_PCER_* in the PULPino spr-defs.h).
+*/
+#define RISCV_BENCH_EV_CYCLES      0x00   /* number of cycles */
+#define RISCV_BENCH_EV_INSTR       0x01   /* number of instructions */
+#define RISCV_BENCH_EV_LD_STALL    0x02   /* load use hazards */
+#define RISCV_BENCH_EV_JMP_STALL   0x03   /* jump register hazards */
+#define RISCV_BENCH_EV_IMISS       0x04   /* cycles waiting for instruction fetch */
+#define RISCV_BENCH_EV_TCDM_CONT   0x10   /* TCDM contention cycles */
+
+#if defined (RISCV_BENCH_HOST)
+
+#include <time.h>
+
+#ifndef RISCV_BENCH_EVENTS
+#define RISCV_BENCH_EVENTS   { RISCV_BENCH_EV_CYCLES }
+#endif
+
+static struct timespec riscv_bench_t0, riscv_bench_t1;
+
+static inline void riscv_bench_timer_start(
+  int event)
+{
+  (void) event;
+  clock_gettime(CLOCK_MONOTONIC, &riscv_bench_t0);
+}
+
+static inline void riscv_bench_timer_stop(void)
+{
+  clock_gettime(CLOCK_MONOTONIC, &riscv_bench_t1);
+}
+
+static inline int riscv_bench_timer_read(
+  int event)
+{
+  (void) event;
+  return (int) (((riscv_bench_t1.tv_sec - riscv_bench_t0.tv_sec) * 1000000000L) +
+                (riscv_bench_t1.tv_nsec - riscv_bench_t0.tv_nsec));
+}
+
+static inline const char * riscv_bench_timer_name(
+  int event)
+{
+  (void) event;
+  return "ns";
+}
+
+#else
+
+#include "utils.h"
+#include "bench.h"
+
+static inline void riscv_bench_timer_start(
+  int event)
+{
+  perf_reset();
+  cpu_perf_conf_events(SPR_PCER_EVENT_MASK(event));
+  cpu_perf_conf(SPR_PCMR_ACTIVE | SPR_PCMR_SATURATE);
+}
+
+static inline void riscv_bench_timer_stop(void)
+{
+  perf_stop();
+}
+
+static inline int riscv_bench_timer_read(
+  int event)
+{
+  return cpu_perf_get(event);
+}
+
+static inline const char * riscv_bench_timer_name(
+  int event)
+{
+  return SPR_PCER_NAME(event);
+}
+
+#endif /* RISCV_BENCH_HOST */
+
+#endif /* _RISCV_BENCH_TIMER_H */
@@ -0,0 +1,283 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_regress.h
+*
+* Description:  Reference-vs-optimized regression harness: bit-exactness
+*               over all block sizes and input patterns, and cycles per
+*               sample of every checked kernel.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+/*
+* A regression program registers its kernels in a table of
+* riscv_regress_case entries and calls riscv_regress_run().  For every
+* kernel, every block size n = 1 .. RISCV_REGRESS_MAX_BLOCK and every input
+* pattern (random, zeros, all maximum, all minimum, alternating extremes)
+* the library kernel and a plain C reference are run on the same inputs
+* and their outputs compared: fixed-point outputs must be bit-exact,
+* floating-point outputs must agree within the relative tolerance of the
+* case.  A case may list patterns that the USE_DSP_RISCV build skips, for
+* kernels whose xpulp path documents a wrap on them (the 32-bit sum of two
+* 0x8000 * 0x8000 products of pv.dotsp.h): the other patterns stay
+* bit-exact.  The kernel is then timed on random input of
+* RISCV_REGRESS_MAX_BLOCK samples through the timer of riscv_bench.h.
+*
+* The output is one line per kernel, plus one line per mismatch (at most
+* RISCV_REGRESS_MAX_REPORT per kernel):
+*
+*   #REGRESS,suite,kernel,type,build,checked,mismatches,cycles/sample
+*   REGRESS,Regression,riscv_add_q15,q15,xpulp,320,0,1.50
+*   MISMATCH,riscv_add_q15,n,pattern,index,got,expected
+*
+* so that the logs of a scalar and of a USE_DSP_RISCV build, or of two
+* releases, can be compared line by line.  riscv_regress_run() returns the
+* number of failing kernels, the exit code of the program.
+*/
+
+#ifndef _RISCV_REGRESS_H
+#define _RISCV_REGRESS_H
+
+#include "riscv_bench.h"
+
+#ifndef RISCV_REGRESS_MAX_BLOCK
+#define RISCV_REGRESS_MAX_BLOCK   64    /* block sizes 1 .. RISCV_REGRESS_MAX_BLOCK are checked */
+#endif
+
+#ifndef RISCV_REGRESS_MAX_REPORT
+#define RISCV_REGRESS_MAX_REPORT  4     /* mismatches printed per kernel */
+#endif
+
+#define RISCV_REGRESS_NUM_PATTERNS 5
+
+/* Pattern of all minimum inputs, the one on which the pairs of pv.dotsp.h wrap */
+#define RISCV_REGRESS_PATTERN_MIN  (1u << 3)
+
+/*
+* Input buffers: three vectors of 2*RISCV_REGRESS_MAX_BLOCK elements of any
+* type (complex kernels read 2*n values).  Outputs may hold up to
+* 4*RISCV_REGRESS_MAX_BLOCK elements of up to 64 bits.
+*/
+#define RISCV_REGRESS_IN_WORDS    (2 * RISCV_REGRESS_MAX_BLOCK)
+#define RISCV_REGRESS_OUT_WORDS   (8 * RISCV_REGRESS_MAX_BLOCK)
+
+  /**
+   * @brief Element type of the inputs or outputs of a case.
+   */
+  typedef enum
+  {
+    RISCV_REGRESS_Q7 = 0,                  /**< q7_t */
+    RISCV_REGRESS_Q15,                     /**< q15_t */
+    RISCV_REGRESS_Q31,                     /**< q31_t */
+    RISCV_REGRESS_Q63,                     /**< q63_t */
+    RISCV_REGRESS_F32                      /**< float32_t */
+  } riscv_regress_type;
+
+  /**
+   * @brief One kernel checked against its reference.
+   *
+   * run() computes the kernel on n samples of riscv_regress_inA/B/C into
+   * pDst, with the library (ref = 0) or with the reference (ref = 1), and
+   * returns the number of output elements.
+   */
+  typedef struct
+  {
+    const char *kernel;                    /**< name of the kernel. */
+    riscv_regress_type inType;             /**< type of the inputs. */
+    riscv_regress_type outType;            /**< type of the outputs. */
+    uint32_t (*run)(uint32_t n, void * pDst, int ref);  /**< runs the kernel or its reference. */
+    float32_t tol;                         /**< relative tolerance of floating-point outputs. */
+    uint32_t dspSkip;                      /**< patterns (1 << pattern) not checked by the USE_DSP_RISCV build. */
+  } riscv_regress_case;
+
+static q31_t riscv_regress_inA[RISCV_REGRESS_IN_WORDS];
+static q31_t riscv_regress_inB[RISCV_REGRESS_IN_WORDS];
+static q31_t riscv_regress_inC[RISCV_REGRESS_IN_WORDS];
+static q63_t riscv_regress_out[RISCV_REGRESS_OUT_WORDS / 2];
+static q63_t riscv_regress_ref[RISCV_REGRESS_OUT_WORDS / 2];
+
+static const char * const riscv_regress_type_names[] = { "q7", "q15", "q31", "q63", "f32" };
+
+static uint32_t riscv_regress_seed;
+
+static inline uint32_t riscv_regress_rand(void)
+{
+  riscv_regress_seed = (riscv_regress_seed * 1103515245u) + 12345u;
+  return riscv_regress_seed ^ (riscv_regress_seed >> 16);
+}
+
+/*
+* Fills one input buffer of the given type with a pattern, the buffers A,
+* B and C differ by their seed and the phase of the alternating pattern.
+*/
+static inline void riscv_regress_fill(
+  void * pBuf,
+  riscv_regress_type type,
+  uint32_t pattern,
+  uint32_t phase)
+{
+  uint32_t i, r;
+  int32_t v;
+
+  for (i = 0u; i < RISCV_REGRESS_IN_WORDS; i++)
+  {
+    r = riscv_regress_rand();
+
+    switch (pattern)
+    {
+      case 0u:  v = (int32_t) r;  break;                              /* random */
+      case 1u:  v = 0;  break;                                        /* zeros */
+      case 2u:  v = 0x7FFFFFFF;  break;                               /* maximum */
+      case 3u:  v = (int32_t) 0x80000000;  break;                     /* minimum */
+      default:  v = (((i + phase) & 1u) != 0u) ? 0x7FFFFFFF : (int32_t) 0x80000000;  break;
+    }
+
+    switch (type)
+    {
+      case RISCV_REGRESS_Q7:   ((q7_t *) pBuf)[i] = (q7_t) (v >> 24);  break;
+      case RISCV_REGRESS_Q15:  ((q15_t *) pBuf)[i] = (q15_t) (v >> 16);  break;
+      case RISCV_REGRESS_F32:  ((float32_t *) pBuf)[i] = (float32_t) (v >> 8) / 8388608.0f;  break;
+      default:                 ((q31_t *) pBuf)[i] = v;  break;
+    }
+  }
+}
+
+static inline int riscv_regress_equal(
+  const riscv_regress_case * C,
+  uint32_t i,
+  q63_t * got,
+  q63_t * exp)
+{
+  float32_t a, b, d;
+
+  switch (C->outType)
+  {
+    case RISCV_REGRESS_Q7:
+      *got = ((q7_t *) riscv_regress_out)[i];
+      *exp = ((q7_t *) riscv_regress_ref)[i];
+      break;
+    case RISCV_REGRESS_Q15:
+      *got = ((q15_t *) riscv_regress_out)[i];
+      *exp = ((q15_t *) riscv_regress_ref)[i];
+      break;
+    case RISCV_REGRESS_Q31:
+      *got = ((q31_t *) riscv_regress_out)[i];
+      *exp = ((q31_t *) riscv_regress_ref)[i];
+      break;
+    case RISCV_REGRESS_Q63:
+      *got = riscv_regress_out[i];
+      *exp = riscv_regress_ref[i];
+      break;
+    default:
+      a = ((float32_t *) riscv_regress_out)[i];
+      b = ((float32_t *) riscv_regress_ref)[i];
+      *got = (q63_t) (a * 1000000.0f);
+      *exp = (q63_t) (b * 1000000.0f);
+      d = (a > b) ? (a - b) : (b - a);
+      b = (b < 0.0f) ? -b : b;
+      return (d <= (C->tol * ((b > 1.0f) ? b : 1.0f)));
+  }
+
+  return (*got == *exp);
+}
+
+/*
+* Checks one kernel over all block sizes and patterns, times it and prints
+* its REGRESS line.  Returns the number of mismatches.
+*/
+static inline uint32_t riscv_regress_check(
+  const riscv_regress_case * C)
+{
+  uint32_t n, p, i, numOut, checked = 0u, bad = 0u;
+  int best = 0x7FFFFFFF, t, r;
+  q63_t got, exp;
+
+  for (n = 1u; n <= RISCV_REGRESS_MAX_BLOCK; n++)
+  {
+    for (p = 0u; p < RISCV_REGRESS_NUM_PATTERNS; p++)
+    {
+#if defined (USE_DSP_RISCV)
+      if((C->dspSkip & (1u << p)) != 0u)
+      {
+        continue;
+      }
+#endif
+
+      riscv_regress_seed = (n * 7919u) + p;
+      riscv_regress_fill(riscv_regress_inA, C->inType, p, 0u);
+      riscv_regress_fill(riscv_regress_inB, C->inType, p, 1u);
+      riscv_regress_fill(riscv_regress_inC, C->inType, p, 0u);
+
+      memset(riscv_regress_out, 0x55, sizeof(riscv_regress_out));
+      memset(riscv_regress_ref, 0x55, sizeof(riscv_regress_ref));
+
+      numOut = C->run(n, riscv_regress_out, 0);
+      C->run(n, riscv_regress_ref, 1);
+
+      for (i = 0u; i < numOut; i++)
+      {
+        checked++;
+        if(!riscv_regress_equal(C, i, &got, &exp))
+        {
+          if(bad < RISCV_REGRESS_MAX_REPORT)
+          {
+            printf("MISMATCH,%s,%d,%d,%d,0x%08X%08X,0x%08X%08X\n", C->kernel, (int) n, (int) p, (int) i,
+                   (unsigned) ((uint64_t) got >> 32), (unsigned) got,
+                   (unsigned) ((uint64_t) exp >> 32), (unsigned) exp);
+          }
+          bad++;
+        }
+      }
+    }
+  }
+
+  /* Fastest of a few runs on random input of the largest block */
+  riscv_regress_seed = 1u;
+  riscv_regress_fill(riscv_regress_inA, C->inType, 0u, 0u);
+  riscv_regress_fill(riscv_regress_inB, C->inType, 0u, 1u);
+  riscv_regress_fill(riscv_regress_inC, C->inType, 0u, 0u);
+
+  for (r = 0; r < RISCV_BENCH_REPEAT; r++)
+  {
+    riscv_bench_timer_start(RISCV_BENCH_EV_CYCLES);
+    C->run(RISCV_REGRESS_MAX_BLOCK, riscv_regress_out, 0);
+    riscv_bench_timer_stop();
+    t = riscv_bench_timer_read(RISCV_BENCH_EV_CYCLES);
+    best = (t < best) ? t : best;
+  }
+
+  t = (100 * best) / RISCV_REGRESS_MAX_BLOCK;
+  printf("REGRESS,%s,%s,%s,%s,%d,%d,%d.%02d\n", RISCV_BENCH_SUITE, C->kernel,
+         riscv_regress_type_names[C->outType], RISCV_BENCH_BUILD, (int) checked, (int) bad, t / 100, t % 100);
+
+  return (bad);
+}
+
+/*
+* Runs every entry of a registration table, returns the number of kernels
+* with mismatches.
+*/
+static inline int riscv_regress_run(
+  const riscv_regress_case * pCases,
+  uint32_t numCases)
+{
+  uint32_t i;
+  int failed = 0;
+
+  printf("#REGRESS,suite,kernel,type,build,checked,mismatches,%s/sample\n",
+         riscv_bench_timer_name(RISCV_BENCH_EV_CYCLES));
+
+  for (i = 0u; i < numCases; i++)
+  {
+    if(riscv_regress_check(&pCases[i]) != 0u)
+    {
+      failed++;
+    }
+  }
+
+  printf("REGRESS_SUMMARY,%s,%s,%d,%d\n", RISCV_BENCH_SUITE, RISCV_BENCH_BUILD, (int) numCases, failed);
+
+  return (failed);
+}
+
+#endif /* _RISCV_REGRESS_H */
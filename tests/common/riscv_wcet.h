@@ -0,0 +1,241 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_wcet.h
+*
+* Description:  Worst-case execution time harness: every kernel over
+*               adversarial input sets, cold and warm, with the minimum,
+*               maximum and jitter of each performance event.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+/*
+* A WCET program registers its kernels in a table of riscv_wcet_case
+* entries and calls riscv_wcet_run().  The fixed-data BENCH lines of
+* riscv_bench.h give the cost of one input; here every kernel is run on
+* RISCV_WCET_NUM_PATTERNS input sets chosen to reach the slow paths:
+*
+*   random     uniform over the whole range
+*   zeros      all zero
+*   maximum    all at the positive full scale
+*   minimum    all at the negative full scale
+*   alternate  alternating extremes, the saturation of every sum
+*   ramp       a sweep of the whole range, every branch of a range
+*              reduction or of a table lookup (f32: -RISCV_WCET_RANGE_F32
+*              to +RISCV_WCET_RANGE_F32)
+*   tiny       +-1 LSB, for f32 subnormal values
+*   huge       random signs of the full scale, for f32 +-1e30
+*
+* For every event and input set the kernel is run once cold, after
+* RISCV_WCET_COLD() and without warm-up, then RISCV_BENCH_REPEAT times
+* warm.  The minimum, the maximum over all runs, the jitter (maximum minus
+* minimum) and the input set of the maximum are printed, with a "/cold"
+* suffix when the maximum is a cold run:
+*
+*   #WCET,suite,kernel,type,size,build,event,min,max,jitter,worst
+*   WCET,Wcet,riscv_sin_f32,f32,32,xpulp,Cycles,1432,1611,179,tiny/cold
+*
+* RISCV_WCET_COLD() defaults to nothing on PULPino, whose instruction and
+* data memories have no cache; define it before including this file to
+* flush the instruction cache or the prefetch buffer of other PULP
+* systems.  On a host it evicts the data caches with a write over
+* RISCV_WCET_EVICT_BYTES.  Define it to nothing to report warm runs only.
+*/
+
+#ifndef _RISCV_WCET_H
+#define _RISCV_WCET_H
+
+#include <string.h>
+#include "riscv_bench.h"
+
+#ifndef RISCV_WCET_MAX_BLOCK
+#define RISCV_WCET_MAX_BLOCK    64      /* largest size of a case */
+#endif
+
+#ifndef RISCV_WCET_RANGE_F32
+#define RISCV_WCET_RANGE_F32    1000.0f /* range of the f32 ramp */
+#endif
+
+#define RISCV_WCET_NUM_PATTERNS 8
+
+#ifndef RISCV_WCET_COLD
+#if defined (RISCV_BENCH_HOST)
+#ifndef RISCV_WCET_EVICT_BYTES
+#define RISCV_WCET_EVICT_BYTES  (4 * 1024 * 1024)
+#endif
+static uint8_t riscv_wcet_evict[RISCV_WCET_EVICT_BYTES];
+#define RISCV_WCET_COLD()       memset(riscv_wcet_evict, (int) riscv_wcet_rand() & 0xFF, RISCV_WCET_EVICT_BYTES)
+#else
+#define RISCV_WCET_COLD()
+#endif
+#endif
+
+  /**
+   * @brief Element type of the inputs of a case.
+   */
+  typedef enum
+  {
+    RISCV_WCET_Q7 = 0,                     /**< q7_t */
+    RISCV_WCET_Q15,                        /**< q15_t */
+    RISCV_WCET_Q31,                        /**< q31_t */
+    RISCV_WCET_F32                         /**< float32_t */
+  } riscv_wcet_type;
+
+  /**
+   * @brief One kernel measured for its worst case.
+   *
+   * run() computes the kernel on the first size elements of
+   * riscv_wcet_inA/B/C.  reset(), when not NULL, is called before every run
+   * outside the measurement to clear the state of a filter.
+   */
+  typedef struct
+  {
+    const char *kernel;                    /**< name of the kernel. */
+    riscv_wcet_type inType;                /**< type of the inputs. */
+    uint32_t size;                         /**< number of input elements, at most RISCV_WCET_MAX_BLOCK. */
+    void (*run)(uint32_t n);               /**< runs the kernel. */
+    void (*reset)(void);                   /**< clears the state of the kernel, or NULL. */
+  } riscv_wcet_case;
+
+static q31_t riscv_wcet_inA[2 * RISCV_WCET_MAX_BLOCK];
+static q31_t riscv_wcet_inB[2 * RISCV_WCET_MAX_BLOCK];
+static q31_t riscv_wcet_inC[2 * RISCV_WCET_MAX_BLOCK];
+static q31_t riscv_wcet_out[4 * RISCV_WCET_MAX_BLOCK];
+
+static const char * const riscv_wcet_type_names[] = { "q7", "q15", "q31", "f32" };
+static const char * const riscv_wcet_pattern_names[RISCV_WCET_NUM_PATTERNS] =
+  { "random", "zeros", "maximum", "minimum", "alternate", "ramp", "tiny", "huge" };
+
+static uint32_t riscv_wcet_seed;
+
+static inline uint32_t riscv_wcet_rand(void)
+{
+  riscv_wcet_seed = (riscv_wcet_seed * 1103515245u) + 12345u;
+  return riscv_wcet_seed ^ (riscv_wcet_seed >> 16);
+}
+
+/*
+* Fills one input buffer of the given type with a pattern, the buffers A,
+* B and C differ by their seed and the phase of the alternating pattern.
+*/
+static inline void riscv_wcet_fill(
+  void * pBuf,
+  riscv_wcet_type type,
+  uint32_t pattern,
+  uint32_t phase)
+{
+  const uint32_t num = 2u * RISCV_WCET_MAX_BLOCK;
+  uint32_t i, r;
+  int32_t v, sign;
+  float32_t f;
+
+  for (i = 0u; i < num; i++)
+  {
+    r = riscv_wcet_rand();
+    sign = ((r & 0x100u) != 0u) ? -1 : 1;
+
+    switch (pattern)
+    {
+      case 0u:  v = (int32_t) r;  break;
+      case 1u:  v = 0;  break;
+      case 2u:  v = 0x7FFFFFFF;  break;
+      case 3u:  v = (int32_t) 0x80000000;  break;
+      case 4u:  v = (((i + phase) & 1u) != 0u) ? 0x7FFFFFFF : (int32_t) 0x80000000;  break;
+      case 5u:  v = (int32_t) (0x80000000u + (uint32_t) (((uint64_t) 0xFFFFFFFFu * i) / (num - 1u)));  break;
+      case 6u:  v = sign;  break;
+      default:  v = (sign > 0) ? 0x7FFFFFFF : (int32_t) 0x80000000;  break;
+    }
+
+    switch (type)
+    {
+      case RISCV_WCET_Q7:   ((q7_t *) pBuf)[i] = (q7_t) ((pattern == 6u) ? v : (v >> 24));  break;
+      case RISCV_WCET_Q15:  ((q15_t *) pBuf)[i] = (q15_t) ((pattern == 6u) ? v : (v >> 16));  break;
+      case RISCV_WCET_Q31:  ((q31_t *) pBuf)[i] = v;  break;
+      default:
+        switch (pattern)
+        {
+          case 5u:  f = RISCV_WCET_RANGE_F32 * (float32_t) (v >> 8) / 8388608.0f;  break;
+          case 6u:  f = (float32_t) sign * 1e-40f;  break;
+          case 7u:  f = (float32_t) sign * 1e30f;  break;
+          default:  f = (float32_t) (v >> 8) / 8388608.0f;  break;
+        }
+        ((float32_t *) pBuf)[i] = f;
+        break;
+    }
+  }
+}
+
+/*
+* Measures one kernel for one event over all input sets and prints its
+* WCET line.
+*/
+static inline void riscv_wcet_measure(
+  const riscv_wcet_case * C,
+  int event)
+{
+  uint32_t p, r;
+  int t, tMin = 0x7FFFFFFF, tMax = -1, worst = 0, worstCold = 0;
+
+  for (p = 0u; p < RISCV_WCET_NUM_PATTERNS; p++)
+  {
+    for (r = 0u; r <= RISCV_BENCH_REPEAT; r++)
+    {
+      /* Same inputs for every run, an in-place kernel overwrites them */
+      riscv_wcet_seed = p + 1u;
+      riscv_wcet_fill(riscv_wcet_inA, C->inType, p, 0u);
+      riscv_wcet_fill(riscv_wcet_inB, C->inType, p, 1u);
+      riscv_wcet_fill(riscv_wcet_inC, C->inType, p, 0u);
+
+      if(C->reset != NULL)
+      {
+        C->reset();
+      }
+
+      /* Run 0 is cold */
+      if(r == 0u)
+      {
+        RISCV_WCET_COLD();
+      }
+
+      riscv_bench_timer_start(event);
+      C->run(C->size);
+      riscv_bench_timer_stop();
+      t = riscv_bench_timer_read(event);
+
+      tMin = (t < tMin) ? t : tMin;
+      if(t > tMax)
+      {
+        tMax = t;
+        worst = (int) p;
+        worstCold = (r == 0u);
+      }
+    }
+  }
+
+  printf("WCET,%s,%s,%s,%d,%s,%s,%d,%d,%d,%s%s\n", RISCV_BENCH_SUITE, C->kernel,
+         riscv_wcet_type_names[C->inType], (int) C->size, RISCV_BENCH_BUILD, riscv_bench_timer_name(event),
+         tMin, tMax, tMax - tMin, riscv_wcet_pattern_names[worst], worstCold ? "/cold" : "");
+}
+
+/*
+* Runs every entry of a registration table for every event of
+* RISCV_BENCH_EVENTS.
+*/
+static inline void riscv_wcet_run(
+  const riscv_wcet_case * pCases,
+  uint32_t numCases)
+{
+  uint32_t i, e;
+
+  printf("#WCET,suite,kernel,type,size,build,event,min,max,jitter,worst\n");
+
+  for (i = 0u; i < numCases; i++)
+  {
+    for (e = 0u; e < RISCV_BENCH_NUM_EVENTS; e++)
+    {
+      riscv_wcet_measure(&pCases[i], riscv_bench_events[e]);
+    }
+  }
+}
+
+#endif /* _RISCV_WCET_H */
@@ -0,0 +1,14 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        bar.h
+*
+* Description:  Empty stand-in for the PULPino bar.h of the benchmark
+*               mains in the native build of tests/.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#ifndef _HOST_BAR_H
+#define _HOST_BAR_H
+
+#endif /* _HOST_BAR_H */
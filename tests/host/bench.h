@@ -0,0 +1,14 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        bench.h
+*
+* Description:  Empty stand-in for the PULPino bench.h of the benchmark
+*               mains in the native build of tests/.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#ifndef _HOST_BENCH_H
+#define _HOST_BENCH_H
+
+#endif /* _HOST_BENCH_H */
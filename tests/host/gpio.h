@@ -0,0 +1,14 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        gpio.h
+*
+* Description:  Empty stand-in for the PULPino gpio.h of the benchmark
+*               mains in the native build of tests/.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#ifndef _HOST_GPIO_H
+#define _HOST_GPIO_H
+
+#endif /* _HOST_GPIO_H */
@@ -0,0 +1,14 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        string_lib.h
+*
+* Description:  Empty stand-in for the PULPino string_lib.h of the benchmark
+*               mains in the native build of tests/.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#ifndef _HOST_STRING_LIB_H
+#define _HOST_STRING_LIB_H
+
+#endif /* _HOST_STRING_LIB_H */
@@ -0,0 +1,14 @@
+/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        utils.h
+*
+* Description:  Empty stand-in for the PULPino utils.h of the benchmark
+*               mains in the native build of tests/.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#ifndef _HOST_UTILS_H
+#define _HOST_UTILS_H
+
+#endif /* _HOST_UTILS_H */
@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""Stack and RAM footprint report of the CMSIS-DSP library.
+
+Reads the -fstack-usage (.su) and, when the compiler supports it, the
+-fcallgraph-info=su (.ci) files of a library build, the buffer sizes
+documented in riscv_math.h and the constant tables of the library archive,
+and writes one Markdown report of:
+
+* stack per public function: own frame and worst case including the
+  functions it calls inside the library,
+* state, scratch and table buffers of every instance structure and of the
+  functions taking a pState/pScratch/pTmp/pBuf argument, as documented,
+* size of every constant table (twiddles, bit reversal, coefficients).
+
+The CMake target footprint runs it on riscv_cmsis_dsp_lib:
+
+    cmake --build build --target footprint   # writes build/footprint.md
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+SU_LINE = re.compile(r'^(?P<file>.*?):(?P<line>\d+):(?P<col>\d+):(?P<func>[^\t]+)\t(?P<bytes>\d+)\t(?P<kind>[\w,]+)')
+CI_NODE = re.compile(r'node: \{ title: "(?P<title>[^"]+)" label: "(?P<func>[^\\"]+)\\n(?P<file>[^:\\"]+):\d+:\d+(?:\\n(?P<bytes>\d+) bytes \((?P<kind>[\w,]+)\))?')
+CI_EDGE = re.compile(r'edge: \{ sourcename: "(?P<src>[^"]+)" targetname: "(?P<dst>[^"]+)"')
+STRUCT = re.compile(r'typedef\s+struct\s*\w*\s*\{(?P<body>.*?)\}\s*(?P<name>\w+)\s*;', re.S)
+MEMBER = re.compile(r'^\s*(?:const\s+)?(?P<type>\w+)\s*\*\s*(?:const\s+)?\*?\s*(?P<name>\w+)\s*;\s*/\*\*<\s*(?P<doc>.*?)\s*\*/', re.M)
+PROTO = re.compile(r'/\*\*(?P<doc>(?:(?!\*/).)*)\*/\s*(?:\w+\s+)*?\w+\s*\*?\s*(?P<name>riscv_\w+)\s*\(', re.S)
+PARAM = re.compile(r'@param\[[\w, ]+\]\s*\*?(?P<name>p(?:State|Scratch\w*|Tmp|Buf\w*))\s+(?P<doc>.*)')
+SIZE_WORDS = re.compile(r'length|size|elements|samples|words|states|values|\d')
+
+ELEMENT_BYTES = {'q7_t': 1, 'q15_t': 2, 'q31_t': 4, 'q63_t': 8, 'float32_t': 4, 'float64_t': 8,
+                 'uint8_t': 1, 'int8_t': 1, 'uint16_t': 2, 'int16_t': 2, 'uint32_t': 4, 'int32_t': 4}
+
+
+def read_stack(objdir):
+    """Returns {(file, func): (func, path, bytes, kind)} and the call edges between those keys."""
+    frames = {}
+    edges = {}
+    for root, _, files in os.walk(objdir):
+        for name in files:
+            path = os.path.join(root, name)
+            if name.endswith('.su'):
+                with open(path) as f:
+                    for line in f:
+                        m = SU_LINE.match(line)
+                        if m:
+                            key = (os.path.basename(m.group('file')), m.group('func'))
+                            frames[key] = (m.group('func'), m.group('file'), int(m.group('bytes')), m.group('kind'))
+            elif name.endswith('.ci'):
+                with open(path) as f:
+                    text = f.read()
+                titles = {}
+                for m in CI_NODE.finditer(text):
+                    titles[m.group('title')] = (os.path.basename(m.group('file')), m.group('func'), m.group('bytes') is not None)
+                for m in CI_EDGE.finditer(text):
+                    src = titles.get(m.group('src'))
+                    dst = titles.get(m.group('dst'), ('', m.group('dst'), False))
+                    if src:
+                        edges.setdefault((src[0], src[1]), set()).add(dst if dst[2] else ('', dst[1], False))
+    return frames, edges
+
+
+def worst_case(frames, edges):
+    """Worst-case stack of every function, following the calls of the .ci files."""
+    by_name = {}
+    for key in frames:
+        by_name.setdefault(key[1], []).append(key)
+
+    memo = {}
+
+    def resolve(caller_file, callee):
+        if callee[0] and (callee[0], callee[1]) in frames:
+            return (callee[0], callee[1])
+        if (caller_file, callee[1]) in frames:
+            return (caller_file, callee[1])
+        keys = by_name.get(callee[1], [])
+        return keys[0] if len(keys) == 1 else None
+
+    def visit(key, path):
+        if key in memo:
+            return memo[key]
+        if key in path:
+            return (0, {'recursion'})
+        own = frames[key][2]
+        deepest, notes = 0, set()
+        if frames[key][3] != 'static':
+            notes.add(frames[key][3].replace(',', ' '))
+        for callee in edges.get(key, ()):
+            target = resolve(key[0], callee)
+            if target is None:
+                if callee[1] == '__indirect_call':
+                    notes.add('indirect calls')
+                elif not callee[1].startswith('__builtin'):
+                    notes.add('calls ' + callee[1])
+                continue
+            depth, sub = visit(target, path | {key})
+            deepest = max(deepest, depth)
+            notes |= sub
+        memo[key] = (own + deepest, notes)
+        return memo[key]
+
+    return {key: visit(key, frozenset()) for key in frames}
+
+
+def read_header(header):
+    with open(header, encoding='latin-1') as f:
+        text = f.read()
+
+    public = set(re.findall(r'\b(riscv_\w+)\s*\(', text))
+
+    instances = []
+    for m in STRUCT.finditer(text):
+        for mem in MEMBER.finditer(m.group('body')):
+            doc = ' '.join(mem.group('doc').split())
+            if re.search(r'length|size', doc) and mem.group('name').startswith('p'):
+                instances.append((m.group('name'), mem.group('name'), mem.group('type'), doc))
+
+    buffers = []
+    for m in PROTO.finditer(text):
+        for line in m.group('doc').splitlines():
+            p = PARAM.search(line)
+            if p and SIZE_WORDS.search(p.group('doc')):
+                buffers.append((m.group('name'), p.group('name'), ' '.join(p.group('doc').split())))
+
+    return public, instances, buffers
+
+
+def read_tables(lib, nm):
+    try:
+        out = subprocess.run([nm, '-S', '--size-sort', lib], capture_output=True, text=True, check=True).stdout
+    except (OSError, subprocess.CalledProcessError) as e:
+        sys.stderr.write('footprint: cannot read the symbols of %s: %s\n' % (lib, e))
+        return []
+    tables = []
+    for line in out.splitlines():
+        fields = line.split()
+        if len(fields) == 4 and fields[2] in 'rR':
+            tables.append((fields[3], int(fields[1], 16)))
+    return sorted(tables, key=lambda t: (-t[1], t[0]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--objdir', required=True, help='object directory of the library (holds the .su files)')
+    parser.add_argument('--header', required=True, help='path of riscv_math.h')
+    parser.add_argument('--lib', help='library archive, for the constant tables')
+    parser.add_argument('--nm', default='nm', help='nm of the toolchain')
+    parser.add_argument('-o', '--output', default='-', help='report file, - for stdout')
+    args = parser.parse_args()
+
+    frames, edges = read_stack(args.objdir)
+    if not frames:
+        sys.exit('footprint: no .su files under %s, build the library with -fstack-usage first' % args.objdir)
+    totals = worst_case(frames, edges)
+    public, instances, buffers = read_header(args.header)
+    tables = read_tables(args.lib, args.nm) if args.lib else []
+
+    out = sys.stdout if args.output == '-' else open(args.output, 'w')
+    w = out.write
+
+    w('# CMSIS-DSP footprint\n\n')
+    w('## Stack per public function\n\n')
+    w('Bytes of the own frame and worst case including the library functions it calls. ')
+    w('Without call graph information (-fcallgraph-info) the worst case is the own frame.\n\n')
+    w('| function | own | worst case | notes |\n|---|---:|---:|---|\n')
+    rows = [(k, v) for k, v in totals.items() if k[1] in public]
+    for key, (total, notes) in sorted(rows, key=lambda r: (-r[1][0], r[0][1])):
+        w('| %s | %d | %d | %s |\n' % (key[1], frames[key][2], total, ', '.join(sorted(notes))))
+
+    w('\n## Instance buffers\n\n')
+    w('Arrays an instance points to, as documented in riscv_math.h.\n\n')
+    w('| instance | member | element | bytes | length |\n|---|---|---|---:|---|\n')
+    for inst, member, etype, doc in instances:
+        w('| %s | %s | %s | %s | %s |\n' % (inst, member, etype, ELEMENT_BYTES.get(etype, '?'), doc))
+
+    w('\n## Function buffers\n\n')
+    w('State and scratch arguments of functions, as documented in riscv_math.h.\n\n')
+    w('| function | argument | size |\n|---|---|---|\n')
+    for func, param, doc in buffers:
+        w('| %s | %s | %s |\n' % (func, param, doc))
+
+    if tables:
+        w('\n## Constant tables\n\n')
+        w('Read-only data of the library, only the tables a program references are linked.\n\n')
+        w('| table | bytes |\n|---|---:|\n')
+        for name, size in tables:
+            w('| %s | %d |\n' % (name, size))
+        w('| **total** | %d |\n' % sum(t[1] for t in tables))
+
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+"""Twiddle and bit reversal tables of the CFFT for chosen lengths.
+
+Writes a C file with the tables riscv_common_tables.c ships for every
+length from 16 to 4096, for the lengths given by --sizes only:
+
+* twiddleCoef_N, twiddleCoef_N_q31, twiddleCoef_N_q15,
+* twiddleCoefQuarter_N, twiddleCoefQuarter_N_q15,
+* riscvBitRevIndexTableN, riscvBitRevIndexTable_fixed_N,
+* twiddleCoef_rfft_2N and twiddleCoef_rfft_2N_q31 of the real FFT of
+  length 2N, which runs the CFFT of length N, for N up to 2048.
+
+Every table keeps its RISCV_DSP_FASTDATA placement.  The values are
+computed the way the shipped ones were: f32 is the double printed with 9
+decimals, Q31 twiddles are floor(x * 2^31 + 0.05), Q15 twiddles
+floor(x * 2^15), the real FFT Q31 table round(x * 2^31).  The bit reversal
+tables list the swaps of the output permutation of riscv_cfft_f32() or
+riscv_cfft_q31()/riscv_cfft_q15(), by increasing position.
+
+The CMake option RISCV_DSP_FFT_SIZES runs it at build time:
+
+    cmake -DRISCV_DSP_FFT_SIZES="64;256" ...
+
+--verify regenerates every length and compares the tables with the shipped
+riscv_common_tables.c.  The twiddles and the fixed-point bit reversal
+tables match bit for bit.  For 16, 32, 256 and 2048 the shipped f32 bit
+reversal tables list a few independent swaps in another order; those are
+checked to have the same length and permutation.
+"""
+
+import argparse
+import math
+import re
+import struct
+import sys
+
+SIZES = (16, 32, 64, 128, 256, 512, 1024, 2048, 4096)
+
+HEADER = '''/* ----------------------------------------------------------------------
+* Project:      CMSIS DSP Library
+* Title:        riscv_fft_tables.c
+*
+* Description:  CFFT twiddle and bit reversal tables of the lengths %s,
+*               generated by utils/gen_fft_tables.py.
+*
+* Target Processor: RISC-V PULPino
+* -------------------------------------------------------------------- */
+
+#include <riscv_dsp/riscv_math.h>
+#include <riscv_dsp/riscv_common_tables.h>
+'''
+
+
+def f32(x):
+    return '%.9ff' % x
+
+
+def fixed(x, bits, offset):
+    scale = 1 << bits
+    v = max(min(math.floor(x * scale + offset), scale - 1), -scale)
+    return '0x%0*X' % ((bits + 1) // 4, v & ((scale << 1) - 1))
+
+
+def digit_reversed(n, fft_len):
+    """Position of bin n in the output of riscv_cfft_f32(), see riscv_bitreversal_init.c."""
+    k_cols = 2 if fft_len & 0x0490 else (4 if fft_len & 0x0920 else 1)
+    m_len = fft_len // k_cols
+    c, q = n % k_cols, n // k_cols
+    k, r = q // (m_len // 8), q % (m_len // 8)
+    m, d = 0, 1
+    while d < m_len // 8:
+        m, r, d = (m << 3) | (r & 7), r >> 3, d << 3
+    return c * m_len + 8 * m + k
+
+
+def bit_reversed(n, fft_len):
+    """Position of bin n in the output of riscv_cfft_q31() and riscv_cfft_q15()."""
+    return int(format(n, '0%db' % (fft_len.bit_length() - 1))[::-1], 2)
+
+
+def swaps(fft_len, perm):
+    """Swaps that move the sample of position perm(n) to n, for n = 0, 1, ..."""
+    where = list(range(fft_len))
+    at = list(range(fft_len))
+    out = []
+    for n in range(fft_len):
+        loc = where[perm(n, fft_len)]
+        if loc != n:
+            out += [8 * n, 8 * loc]
+            at[n], at[loc] = at[loc], at[n]
+            where[at[n]], where[at[loc]] = n, loc
+    return out
+
+
+def tables(sizes):
+    """Returns [(type, name, length, group, values)] for the CFFT lengths of sizes."""
+    out = []
+    for n in sizes:
+        w = [2 * math.pi * i / n for i in range(n)]
+        out.append(('float32_t', 'twiddleCoef_%d' % n, str(2 * n), 'TWIDDLE',
+                    [f32(g(a)) for a in w for g in (math.cos, math.sin)]))
+        out.append(('q31_t', 'twiddleCoef_%d_q31' % n, str(3 * n // 2), 'TWIDDLE',
+                    [fixed(g(a), 31, 0.05) for a in w[:3 * n // 4] for g in (math.cos, math.sin)]))
+        out.append(('q15_t', 'twiddleCoef_%d_q15' % n, str(3 * n // 2), 'TWIDDLE',
+                    [fixed(g(a), 15, 0.0) for a in w[:3 * n // 4] for g in (math.cos, math.sin)]))
+        out.append(('float32_t', 'twiddleCoefQuarter_%d' % n, str(n // 4 + 1), 'TWIDDLE',
+                    [f32(math.cos(a)) for a in w[:n // 4 + 1]]))
+        out.append(('q15_t', 'twiddleCoefQuarter_%d_q15' % n, str(n // 4 + 1), 'TWIDDLE',
+                    [fixed(math.cos(a), 15, 0.0) for a in w[:n // 4 + 1]]))
+        out.append(('uint16_t', 'riscvBitRevIndexTable%d' % n,
+                    'RISCVBITREVINDEXTABLE%s_TABLE_LENGTH' % format(n, '_>4'), 'BITREV',
+                    [str(v) for v in swaps(n, digit_reversed)]))
+        out.append(('uint16_t', 'riscvBitRevIndexTable_fixed_%d' % n,
+                    'RISCVBITREVINDEXTABLE_FIXED_%s_TABLE_LENGTH' % format(n, '_>4'), 'BITREV',
+                    [str(v) for v in swaps(n, bit_reversed)]))
+        if n < 4096:
+            w = [2 * math.pi * i / (2 * n) for i in range(n)]
+            out.append(('float32_t', 'twiddleCoef_rfft_%d' % (2 * n), str(2 * n), 'TWIDDLE',
+                        [f32(g(a)) for a in w for g in (math.sin, math.cos)]))
+            out.append(('q31_t', 'twiddleCoef_rfft_%d_q31' % (2 * n), str(2 * n), 'TWIDDLE',
+                        [fixed(g(a), 31, 0.5) for a in w for g in (math.sin, math.cos)]))
+    return out
+
+
+def write(sizes, out):
+    out.write(HEADER % ', '.join(str(n) for n in sizes))
+    for ctype, name, length, group, values in tables(sizes):
+        per_line = 2 if ctype != 'uint16_t' else 8
+        out.write('\nconst %s %s[%s] RISCV_DSP_FASTDATA(%s, %s) = {\n' % (ctype, name, length, group, name))
+        for i in range(0, len(values), per_line):
+            out.write('    %s,\n' % ', '.join(values[i:i + per_line]))
+        out.write('};\n')
+
+
+def read_shipped(path):
+    """Returns {name: [values]} of the constant tables of riscv_common_tables.c."""
+    with open(path) as f:
+        text = f.read()
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', '', text)
+    shipped = {}
+    for m in re.finditer(r'const\s+\w+\s+(\w+)\s*\[[^\]]*\][^=]*=\s*\{(.*?)\}\s*;', text, flags=re.S):
+        shipped[m.group(1)] = [v.strip() for v in m.group(2).split(',') if v.strip()]
+    return shipped
+
+
+def value(ctype, text):
+    """Bits of one table entry, f32 as its single precision encoding."""
+    if ctype == 'float32_t':
+        return struct.unpack('<I', struct.pack('<f', float(text.rstrip('fF'))))[0]
+    bits = {'q31_t': 32, 'q15_t': 16, 'uint16_t': 16}[ctype]
+    return int(re.sub(r'\(\w+\)', '', text), 0) & ((1 << bits) - 1)
+
+
+def permutation(entries, fft_len):
+    x = list(range(fft_len))
+    for a, b in zip(entries[0::2], entries[1::2]):
+        x[a // 8], x[b // 8] = x[b // 8], x[a // 8]
+    return x
+
+
+def verify(path):
+    shipped = read_shipped(path)
+    failed = 0
+    for ctype, name, _, _, values in tables(SIZES):
+        if name not in shipped:
+            print('%s: not in %s' % (name, path))
+            failed += 1
+            continue
+        mine = [value(ctype, v) for v in values]
+        theirs = [value(ctype, v) for v in shipped[name]]
+        if mine == theirs:
+            continue
+        if name.startswith('riscvBitRevIndexTable') and len(mine) == len(theirs):
+            fft_len = int(re.search(r'\d+$', name).group(0))
+            if permutation(mine, fft_len) == permutation(theirs, fft_len):
+                print('%s: same permutation, swaps in another order' % name)
+                continue
+        bad = [i for i in range(min(len(mine), len(theirs))) if mine[i] != theirs[i]]
+        print('%s: %d entries differ, lengths %d and %d, first at %s'
+              % (name, len(bad), len(mine), len(theirs), bad[:1]))
+        failed += 1
+    return failed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--sizes', help='CFFT lengths, separated by ; or ,')
+    parser.add_argument('--verify', metavar='TABLES_C', help='compare every length with riscv_common_tables.c')
+    parser.add_argument('-o', '--output', default='-', help='C file, - for stdout')
+    args = parser.parse_args()
+
+    if args.verify:
+        failed = verify(args.verify)
+        print('%d tables differ' % failed if failed else 'all tables match')
+        sys.exit(1 if failed else 0)
+
+    if not args.sizes:
+        parser.error('--sizes or --verify is required')
+    sizes = sorted({int(s) for s in re.split(r'[;,]', args.sizes) if s})
+    for n in sizes:
+        if n not in SIZES:
+            sys.exit('gen_fft_tables: %d is not a CFFT length, one of %s' % (n, ', '.join(map(str, SIZES))))
+
+    out = sys.stdout if args.output == '-' else open(args.output, 'w')
+    write(sizes, out)
+
+
+if __name__ == '__main__':
+    main()
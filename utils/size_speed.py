@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""Code size and speed report of the CMSIS-DSP library, per function family.
+
+Reads the code size of every function from the objects of a library build
+and the BENCH lines of tests/common/riscv_bench.h, and writes one Markdown
+report of:
+
+* .text bytes of every function family, compiled for size (the families of
+  RISCV_DSP_COMPACT, -Os and the plain loops of RISCV_MATH_COMPACT) or for
+  speed (-O3 and the 4x unrolled loops),
+* bytes and time of every benchmarked kernel, next to those of a baseline
+  build when one is given.
+
+The BENCH lines come from benchmark programs it runs (--bench, host builds)
+or from logs captured on the target (--log).  The CMake target size_speed
+runs every benchmark of a host build:
+
+    cmake --build build --target size_speed   # writes build/size_speed.md
+
+To compare both choices, build once with -DRISCV_DSP_COMPACT=ALL, then pass
+its size_speed.csv to the other build with -DRISCV_DSP_SIZE_SPEED_BASELINE.
+"""
+
+import argparse
+import csv
+import os
+import re
+import subprocess
+import sys
+
+FAMILY_DIR = re.compile(r'(?:^|[\\/])(?P<family>\w+)Functions[\\/]')
+BENCH_LINE = re.compile(r'^BENCH,(?P<suite>[^,]*),(?P<kernel>[^,]*),(?P<type>[^,]*),(?P<size>\d+),'
+                        r'(?P<build>[^,]*),(?P<event>[^,]*),(?P<min>\d+),(?P<median>\d+)\s*$')
+TIME_EVENTS = ('Cycles', 'ns')
+FIELDS = ('kernel', 'family', 'loops', 'bytes', 'type', 'size', 'event', 'min')
+
+
+def read_sizes(objdir, nm):
+    """Returns {function: (family, bytes)} of the code of the objects under objdir."""
+    objects = []
+    for root, _, files in os.walk(objdir):
+        for name in files:
+            path = os.path.join(root, name)
+            if name.endswith(('.o', '.obj')) and FAMILY_DIR.search(os.path.relpath(path, objdir)):
+                objects.append(path)
+    if not objects:
+        sys.exit('size_speed: no objects under %s, build the library first' % objdir)
+
+    sizes = {}
+    for path in sorted(objects):
+        family = FAMILY_DIR.search(os.path.relpath(path, objdir)).group('family')
+        try:
+            out = subprocess.run([nm, '-S', '--defined-only', path],
+                                 capture_output=True, text=True, check=True).stdout
+        except (OSError, subprocess.CalledProcessError) as e:
+            sys.exit('size_speed: cannot read the symbols of %s: %s' % (path, e))
+        for line in out.splitlines():
+            fields = line.split()
+            if len(fields) == 4 and fields[2] in 'tT':
+                sizes[fields[3]] = (family, int(fields[1], 16))
+    return sizes
+
+
+def read_bench(lines):
+    """Returns {(kernel, type, size): (event, min)}, the cycles (or ns) of every BENCH line."""
+    timings = {}
+    for line in lines:
+        m = BENCH_LINE.match(line.strip())
+        if not m:
+            continue
+        key = (m.group('kernel'), m.group('type'), int(m.group('size')))
+        known = timings.get(key)
+        if known is None or (m.group('event') in TIME_EVENTS and known[0] not in TIME_EVENTS):
+            timings[key] = (m.group('event'), int(m.group('min')))
+    return timings
+
+
+def run_bench(programs, logs):
+    lines = []
+    for program in programs:
+        try:
+            run = subprocess.run([program], capture_output=True, text=True, timeout=600)
+        except (OSError, subprocess.TimeoutExpired) as e:
+            sys.stderr.write('size_speed: cannot run %s: %s\n' % (program, e))
+            continue
+        if run.returncode != 0:
+            sys.stderr.write('size_speed: %s exited with %d\n' % (program, run.returncode))
+        lines += run.stdout.splitlines()
+    for log in logs:
+        with open(log, errors='replace') as f:
+            lines += f.read().splitlines()
+    return lines
+
+
+def read_baseline(path):
+    """Returns {(kernel, type, size): row} of a size_speed.csv."""
+    with open(path, newline='') as f:
+        return {(r['kernel'], r['type'], int(r['size'])): r for r in csv.DictReader(f)}
+
+
+def percent(value, base):
+    return '%+.0f%%' % (100.0 * (value - base) / base) if base else '-'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--objdir', required=True, help='object directory of the library')
+    parser.add_argument('--nm', default='nm', help='nm of the toolchain')
+    parser.add_argument('--compact', default='', help='RISCV_DSP_COMPACT, families separated by ; or ,')
+    parser.add_argument('--bench', action='append', default=[], help='benchmark program to run, repeatable')
+    parser.add_argument('--log', action='append', default=[], help='captured benchmark output, repeatable')
+    parser.add_argument('--baseline', help='size_speed.csv of another build to compare with')
+    parser.add_argument('--csv', help='also write the kernel table as CSV')
+    parser.add_argument('-o', '--output', default='-', help='report file, - for stdout')
+    args = parser.parse_args()
+
+    compact = {f for f in re.split(r'[;,]', args.compact) if f}
+    sizes = read_sizes(args.objdir, args.nm)
+    timings = read_bench(run_bench(args.bench, args.log))
+    baseline = read_baseline(args.baseline) if args.baseline else {}
+
+    def loops(family):
+        return 'compact' if family in compact else 'unrolled'
+
+    rows = []
+    for (kernel, ctype, size), (event, cycles) in sorted(timings.items()):
+        if kernel in sizes:
+            family, nbytes = sizes[kernel]
+            rows.append(dict(zip(FIELDS, (kernel, family, loops(family), nbytes, ctype, size, event, cycles))))
+
+    out = sys.stdout if args.output == '-' else open(args.output, 'w')
+    w = out.write
+
+    w('# CMSIS-DSP size and speed\n\n')
+    w('Families built for size: %s.\n\n' % (', '.join(sorted(compact)) if compact else 'none'))
+    w('## Code per family\n\n')
+    w('Bytes of the .text of every function, static helpers included.\n\n')
+    w('| family | loops | functions | bytes |\n|---|---|---:|---:|\n')
+    families = {}
+    for family, nbytes in sizes.values():
+        count, total = families.get(family, (0, 0))
+        families[family] = (count + 1, total + nbytes)
+    for family, (count, total) in sorted(families.items()):
+        w('| %s | %s | %d | %d |\n' % (family, loops(family), count, total))
+    w('| **total** | | %d | %d |\n' % (sum(c for c, _ in families.values()), sum(t for _, t in families.values())))
+
+    w('\n## Benchmarked kernels\n\n')
+    w('Bytes of the kernel itself and the minimum of its BENCH lines')
+    if baseline:
+        w(', against %s' % args.baseline)
+    w('.\n\n')
+    if baseline:
+        w('| kernel | loops | bytes | type | size | event | min | baseline loops | bytes | min | bytes vs baseline | min vs baseline |\n')
+        w('|---|---|---:|---|---:|---|---:|---|---:|---:|---:|---:|\n')
+    else:
+        w('| kernel | loops | bytes | type | size | event | min |\n|---|---|---:|---|---:|---|---:|\n')
+    for r in rows:
+        w('| %s | %s | %d | %s | %d | %s | %d |' % tuple(r[f] for f in FIELDS if f != 'family'))
+        if baseline:
+            b = baseline.get((r['kernel'], r['type'], r['size']))
+            if b:
+                w(' %s | %s | %s | %s | %s |' % (b['loops'], b['bytes'], b['min'], percent(r['bytes'], int(b['bytes'])),
+                                                percent(r['min'], int(b['min']))))
+            else:
+                w(' - | - | - | - | - |')
+        w('\n')
+
+    if out is not sys.stdout:
+        out.close()
+
+    if args.csv:
+        with open(args.csv, 'w', newline='') as f:
+            writer = csv.DictWriter(f, fieldnames=FIELDS)
+            writer.writeheader()
+            writer.writerows(rows)
+
+
+if __name__ == '__main__':
+    main()